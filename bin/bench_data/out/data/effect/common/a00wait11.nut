@@ -0,0 +1,2 @@
+0.500000 bone bone frame anim vertex frame material
+=
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim = material vertex
+bone 1.0 texture -1 mate
\ No newline at end of file
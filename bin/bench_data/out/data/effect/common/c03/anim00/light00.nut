@@ -0,0 +1,269 @@
+material texture frame
+anim vertex anim texture frame material material
+-1 -1 material frame frame vertex vertex 0.500000
+-1 texture vertex = 0.500000 material
+=
+-1 = vertex = bone texture material
+texture anim frame 1.0 0.500000
+-1
+vertex 0.500000 texture = vertex
+= =
+texture 0.500000 texture -1 material = bone -1 material bone material frame
+anim texture material
+1.0 1.0
+vertex -1 texture bone
+1.0 bone bone = frame texture texture
+= frame anim 0.500000
+texture 1.0
+0.500000 frame = 0.500000
+= -1
+material
+anim
+vertex
+frame =
+material texture frame = =
+1.0 1.0 = material bone
+frame 0.500000 bone = 1.0 material
+vertex frame 1.0 frame material frame -1 frame -1 -1 anim vertex
+1.0 anim texture anim texture bone
+0.500000
+= 0.500000 texture material
+1.0 = material 1.0 1.0 texture frame = 1.0 anim material -1
+texture material texture texture frame = 0.500000 material vertex material
+-1
+anim -1 anim
+vertex
+bone
+anim 0.500000
+texture 1.0 frame = vertex frame texture
+bone
+material texture = texture texture 0.500000 bone anim
+frame -1 bone
+frame =
+vertex bone
+material
+vertex material
+material
+frame vertex material 1.0 bone
+frame =
+vertex 1.0 material 0.500000 frame bone
+0.500000 1.0
+= bone
+anim
+frame texture 0.500000 -1 frame -1 1.0 material 1.0 anim -1 frame vertex material anim
+= vertex
+material material bone frame anim anim anim 1.0 -1
+texture material frame 0.500000 -1 frame 0.500000 = texture texture 0.500000 material
+anim material material vertex texture texture -1 anim anim bone
+anim -1
+=
+-1 bone
+-1 anim
+= 0.500000 0.500000 frame bone texture frame bone vertex material bone bone vertex = vertex 0.500000 1.0 0.500000 -1 -1 0.500000 -1 -1 material frame vertex =
+anim
+-1
+anim
+1.0 texture -1
+texture = = anim
+vertex bone
+vertex texture vertex
+-1 bone vertex vertex 0.500000 material texture anim bone anim frame bone -1 -1 vertex bone 1.0 1.0 anim 0.500000
+anim frame 1.0 vertex vertex
+vertex
+bone
+texture bone frame bone
+bone 0.500000 material bone material
+bone 1.0
+texture = bone anim frame = material anim 0.500000 vertex bone material = 1.0 frame
+material
+=
+= =
+bone material vertex
+anim vertex vertex frame texture 0.500000 -1 anim bone 1.0
+vertex anim 0.500000 texture 0.500000 anim 1.0 vertex
+texture
+1.0
+1.0 vertex
+vertex 0.500000 0.500000 =
+frame texture
+0.500000 bone
+anim vertex texture frame frame material
+1.0
+0.500000 bone
+texture
+texture texture 0.500000 texture texture = material vertex -1 =
+-1 = vertex =
+vertex material 0.500000 -1
+bone frame
+anim
+bone 0.500000 -1 anim frame
+frame
+-1 = frame bone 0.500000 texture -1 0.500000 anim
+-1 1.0 1.0 anim material
+0.500000 vertex texture vertex -1 anim 0.500000 frame 0.500000
+= bone 1.0 anim 0.500000 material 0.500000
+texture anim texture -1
+0.500000 texture bone 0.500000
+0.500000 texture -1 frame bone frame anim = anim anim -1 bone texture frame 0.500000 -1 1.0 bone anim vertex
+anim 0.500000 bone
+-1
+vertex
+bone anim
+texture -1 -1
+texture 0.500000 anim bone 0.500000
+= 0.500000 frame 1.0
+frame anim -1 material 1.0 material texture -1 material
+-1 material frame
+1.0 anim
+texture
+=
+material = 0.500000 = -1 texture texture -1 =
+frame bone material bone bone
+anim -1
+texture = -1 0.500000 -1 -1 anim material vertex
+-1 1.0
+1.0
+frame texture
+frame
+1.0 bone = bone -1 vertex 0.500000 material texture =
+-1 texture frame
+vertex 0.500000 0.500000 bone 1.0 texture bone
+texture
+-1 anim 0.500000 texture 1.0 = frame 0.500000 0.500000 material 1.0 texture bone frame 0.500000 = 0.500000 anim
+material 0.500000 anim anim anim vertex
+bone frame -1 vertex
+vertex anim bone texture anim bone bone 0.500000
+texture 0.500000 frame 1.0 0.500000 anim anim -1 =
+vertex
+frame 0.500000 -1 vertex vertex
+vertex
+bone material
+material vertex
+vertex 1.0 vertex
+1.0
+= -1
+= frame = 1.0 material material 0.500000 = 0.500000
+texture -1
+1.0 material bone vertex -1 = -1 = 0.500000 1.0 bone vertex anim =
+=
+material
+anim texture material bone 0.500000 texture 1.0
+frame
+bone 1.0 -1 material = vertex anim = -1 material vertex material
+bone 1.0 -1 material bone =
+texture
+= texture frame anim
+material texture
+material
+texture 0.500000 vertex 0.500000 frame 0.500000 1.0 0.500000
+0.500000
+material
+anim 1.0 anim bone frame frame material
+vertex -1 1.0 frame bone texture
+vertex texture -1 frame
+frame texture 0.500000
+bone 0.500000 anim vertex
+0.500000 vertex bone 0.500000 -1 1.0 0.500000 vertex = 1.0 texture vertex vertex material
+vertex
+frame 0.500000 =
+material bone
+anim anim
+bone
+1.0
+bone anim
+= texture frame material
+-1 texture
+material
+1.0 vertex texture material material
+vertex = =
+material
+bone -1 material anim = 1.0 = anim material -1 texture 1.0 frame bone anim anim vertex anim material
+-1 0.500000 vertex texture vertex
+material anim
+frame -1 bone
+vertex bone anim bone 0.500000 material material frame texture vertex
+frame frame frame -1 0.500000
+-1 frame bone
+anim
+vertex 1.0 vertex
+frame anim frame -1 = material
+anim bone vertex material 1.0
+bone 0.500000 frame 0.500000 frame vertex -1 1.0
+frame material texture 0.500000 1.0
+frame vertex frame
+bone -1 texture anim 1.0
+0.500000 1.0 1.0 1.0 1.0 -1 material frame -1 1.0 material
+1.0 texture
+-1 -1
+=
+vertex -1 -1 bone anim =
+frame texture texture texture
+texture
+anim frame
+vertex material
+anim
+vertex
+frame material =
+=
+vertex bone bone
+0.500000 1.0
+vertex -1 1.0 texture -1 anim anim bone
+-1
+= material material 1.0
+material bone -1 anim 0.500000 frame
+bone material frame bone =
+0.500000 texture = frame 1.0
+frame anim
+material = material anim
+-1 anim material 0.500000 1.0
+-1 frame
+1.0 texture anim = frame material frame -1 = = -1 vertex anim -1 texture
+= material 1.0 0.500000 vertex -1
+anim
+-1 frame = 1.0
+bone texture 1.0 vertex texture vertex bone 1.0 0.500000
+0.500000 frame material = frame anim
+1.0
+= bone bone -1 material material bone -1
+=
+1.0 = -1
+vertex texture 0.500000
+=
+-1
+-1 anim 1.0 bone anim 0.500000 material
+1.0
+frame material
+-1 texture bone texture texture frame bone
+anim 0.500000 frame 1.0 1.0 bone
+1.0
+bone = anim -1 vertex 1.0 frame anim =
+bone anim
+material
+material anim -1
+material vertex
+1.0 -1 vertex = 0.500000
+0.500000
+frame vertex
+1.0 vertex frame
+-1 vertex = -1 -1
+= material anim vertex -1
+frame vertex
+texture 1.0 1.0 texture 0.500000 = = 0.500000 vertex bone vertex vertex anim
+bone 1.0 frame =
+1.0
+material material
+0.500000
+vertex
+vertex frame bone 1.0 -1
+vertex bone
+frame material
+material texture frame
+material -1 anim 0.500000
+vertex
+bone
+-1 -1 material vertex
+anim
+bone = texture -1 0.500000 bone frame material material
+1.0
+anim vertex material anim
+frame
@@ -0,0 +1,3 @@
+frame
+0.500000 = bone
+vertex bone texture anim -1 0.500000 texture 1.0 = frame 1.0 frame
\ No newline at end of file
@@ -0,0 +1,294 @@
+=
+bone =
+bone
+bone frame anim
+1.0 frame
+frame 1.0
+anim =
+material anim texture bone texture material
+1.0 bone anim frame 0.500000 vertex
+texture -1 -1
+= 1.0 bone bone anim vertex frame anim material bone = vertex bone material vertex bone 0.500000 bone bone frame bone texture 0.500000
+bone
+1.0 bone vertex anim vertex material
+material texture = anim 1.0 0.500000
+texture -1
+texture vertex
+-1 material
+bone -1 = anim material bone anim anim 0.500000 -1 -1 anim
+1.0
+vertex 0.500000 =
+1.0 material 0.500000 = -1 -1 vertex
+bone material 1.0
+vertex vertex anim material
+anim
+material
+texture =
+texture 1.0 =
+texture material
+texture frame 0.500000
+vertex anim frame
+vertex vertex frame 1.0
+=
+anim anim = 1.0
+material
+material 1.0 material
+vertex 1.0 bone 0.500000
+vertex material anim anim 1.0 vertex =
+1.0 texture
+frame
+1.0 1.0
+anim
+frame material 1.0
+vertex
+0.500000 texture bone material bone = frame -1 material 1.0
+material 0.500000 1.0 texture 1.0 = vertex -1
+anim 0.500000
+vertex 0.500000 1.0 anim = bone frame = frame texture vertex frame
+-1 =
+anim anim 0.500000 0.500000 anim -1 bone bone -1 1.0 1.0 anim 0.500000
+0.500000 0.500000 1.0 vertex vertex material 1.0 0.500000
+bone = texture
+= = texture
+1.0
+0.500000 =
+vertex -1 0.500000 0.500000 -1 1.0 vertex material = 1.0 frame texture bone = = = texture 1.0
+bone -1
+frame vertex frame 1.0 =
+= bone vertex -1 texture frame anim
+0.500000 0.500000 -1
+anim
+-1 -1 texture frame
+-1 bone 0.500000 bone 1.0 1.0 -1 anim texture frame 1.0 0.500000 material
+0.500000 anim anim 1.0 0.500000 bone anim
+material material = bone
+anim = bone
+material material 0.500000
+= 0.500000 bone
+texture
+1.0 anim 0.500000 vertex material bone bone
+0.500000 vertex bone bone
+=
+anim bone frame
+vertex
+vertex
+anim 0.500000 texture 1.0 0.500000
+= vertex frame
+anim frame -1 anim bone frame
+-1 1.0
+vertex
+1.0 = anim 1.0 bone frame 0.500000
+material vertex = 1.0 0.500000 bone material
+frame 1.0 1.0 1.0 bone 1.0 anim -1 material texture frame
+anim frame = anim bone
+material vertex
+0.500000
+1.0 bone frame 1.0
+frame 0.500000 bone frame anim =
+-1 texture
+texture -1 vertex texture anim frame
+0.500000 vertex 0.500000
+0.500000
+material -1
+0.500000
+texture
+bone 1.0 vertex -1 vertex texture
+anim frame =
+material =
+-1 vertex vertex frame -1 vertex bone -1 vertex = 1.0
+material texture
+1.0 -1 vertex frame anim anim 0.500000 -1 texture bone
+material anim material
+-1 anim = frame
+anim
+anim material -1 0.500000 anim vertex 1.0 -1 =
+0.500000 material frame vertex = 1.0 frame
+-1 = 1.0
+-1
+1.0 = =
+frame
+texture material vertex = anim material
+frame vertex 0.500000 frame -1
+anim
+frame
+-1 vertex texture
+frame frame texture = material frame material 1.0
+material frame bone 1.0 bone 0.500000 1.0 1.0 0.500000 frame
+0.500000 0.500000
+frame texture 0.500000 bone frame
+1.0 vertex texture 1.0 texture
+-1 vertex frame texture
+texture material vertex
+frame = 1.0 frame
+anim
+texture bone 1.0 0.500000
+bone material anim 0.500000 anim =
+-1 texture
+frame 0.500000 1.0 vertex vertex
+= texture -1 =
+1.0 = vertex vertex
+frame 1.0
+bone bone = anim -1 1.0 = 0.500000 =
+0.500000 1.0 1.0 material = texture -1 1.0 1.0 texture anim anim
+1.0 frame = 0.500000 1.0 anim anim anim = 1.0 texture bone bone = 1.0 = material anim 1.0
+bone
+frame
+1.0 =
+vertex bone material material
+material vertex 0.500000 1.0 = bone frame
+material 0.500000 = vertex 0.500000 vertex
+= 0.500000 bone
+texture =
+= 0.500000
+anim
+1.0
+anim frame -1 texture 1.0 bone
+vertex
+material frame
+frame texture = frame = 1.0 anim 0.500000 frame anim frame
+frame bone anim vertex texture
+anim material
+anim frame = anim material 0.500000
+material material 1.0 1.0 material frame -1 bone material anim texture anim material
+0.500000 texture frame -1 = 0.500000
+frame bone 0.500000 frame -1
+texture = 0.500000 vertex
+= frame =
+frame
+1.0 frame material
+0.500000 = vertex vertex = material 0.500000 -1 frame 1.0
+-1 material
+texture 0.500000 0.500000 1.0 = anim vertex material material material
+=
+vertex anim 1.0
+texture material vertex -1 material = bone anim bone frame
+vertex -1
+anim 1.0 frame
+material 0.500000
+anim material frame
+0.500000 vertex bone 0.500000 anim anim anim anim material
+= texture 1.0 -1 = bone -1 material material -1 frame -1 material -1 bone
+= frame
+vertex 0.500000 material
+anim texture 0.500000 1.0 vertex frame 1.0 1.0 vertex bone -1 bone 1.0
+material frame
+bone 0.500000 anim 0.500000 =
+= = frame =
+vertex 1.0
+material material -1 frame bone -1 0.500000
+1.0 anim
+bone texture
+frame
+bone
+bone vertex material 0.500000 frame material bone
+0.500000
+-1 material texture vertex = vertex
+1.0 1.0 =
+1.0
+bone 0.500000 material
+bone bone
+material
+vertex
+anim texture material bone 0.500000
+0.500000 bone -1 texture = vertex
+-1
+texture 1.0
+bone texture =
+0.500000 anim frame material
+= frame texture
+texture 1.0 vertex 1.0 = frame 1.0 0.500000
+material material bone bone material frame bone -1 anim bone
+anim 1.0 = = anim 0.500000 anim anim
+vertex 0.500000
+frame
+material anim vertex
+vertex material
+material -1 -1 1.0 vertex vertex = bone
+anim
+-1 1.0 = bone
+material = material material
+anim 1.0 vertex
+anim = = 1.0 1.0 0.500000 0.500000 -1 =
+texture bone -1 frame 1.0
+vertex vertex anim frame -1 vertex bone vertex -1
+vertex
+= vertex
+vertex bone bone bone frame
+vertex 1.0 = bone vertex
+anim vertex 1.0 1.0 1.0 0.500000 bone material 1.0 material anim
+vertex 1.0 frame 1.0
+texture 0.500000 0.500000 anim frame vertex
+vertex 1.0
+-1 1.0 anim
+vertex texture material
+texture frame 0.500000 1.0 = anim vertex 1.0 -1 =
+bone vertex
+frame 1.0 material texture
+-1 bone
+bone bone texture -1 -1
+bone
+-1 frame texture anim texture =
+bone
+material 1.0
+texture
+vertex frame anim 0.500000 bone = anim
+bone texture -1 frame
+anim vertex
+0.500000 1.0 1.0
+0.500000 -1 1.0 1.0 texture texture bone -1
+1.0 vertex anim frame -1 vertex
+bone -1 frame bone vertex -1 = texture
+-1 -1 material frame anim bone 0.500000 = anim frame
+1.0 anim -1 material -1 bone
+vertex =
+frame vertex 1.0
+vertex = -1 =
+=
+frame
+1.0 1.0 frame material material = = bone 0.500000 = vertex 0.500000 bone bone vertex 1.0 frame material texture material = frame 0.500000 vertex 0.500000
+material
+1.0 material = texture
+material bone vertex
+frame anim
+1.0 -1 0.500000 texture 0.500000
+1.0 anim vertex material
+= material material material frame anim -1 -1 -1
+material -1 1.0 material material vertex frame anim
+bone vertex =
+anim texture
+vertex anim anim
+=
+material
+material bone anim
+frame frame material
+material texture material
+bone anim bone
+-1 texture vertex
+frame -1 =
+texture 0.500000 0.500000 frame 0.500000
+=
+frame material 0.500000 material
+frame
+-1 texture -1
+vertex
+vertex
+bone 0.500000 -1 = 0.500000 material bone
+-1 vertex frame =
+vertex
+material -1 1.0 anim bone
+anim = frame -1 -1 1.0 = vertex anim 1.0 = anim material -1 0.500000 bone 0.500000 -1 bone
+frame vertex
+anim
+vertex material material vertex anim anim
+anim frame bone bone 0.500000 bone bone bone
+anim anim = texture
+1.0 bone =
+texture 1.0 anim bone frame texture frame texture 1.0 1.0 0.500000 texture = anim 0.500000 0.500000 1.0 0.500000
+0.500000 frame -1 0.500000
+vertex texture texture
+0.500000 material
+bone 1.0 1.0 -1 material =
+material =
+= frame bone
+frame vertex anim
+vertex texture frame
\ No newline at end of file
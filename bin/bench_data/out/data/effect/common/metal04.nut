@@ -0,0 +1,158 @@
+texture material
+vertex = = 0.500000 vertex frame
+= -1 frame -1 vertex 0.500000
+material 0.500000 bone -1 -1
+-1
+material
+frame =
+frame 0.500000 material =
+1.0
+material
+material =
+= material 1.0 frame
+material
+bone bone vertex material
+anim
+bone 1.0 -1 material texture = texture material
+vertex bone
+texture -1 = material
+anim 0.500000 anim 0.500000 bone
+material
+0.500000
+anim 1.0 texture 0.500000
+-1 anim
+frame
+=
+0.500000 0.500000
+1.0 bone frame 0.500000 1.0 frame 1.0 material
+vertex material material material = 0.500000 vertex 1.0 frame
+1.0 = material -1 frame -1 frame material bone
+-1 0.500000 anim texture
+material anim bone -1 material -1 texture frame
+texture
+= material anim frame = vertex anim bone
+vertex 1.0
+material
+= texture anim
+texture frame vertex frame 1.0 -1 material
+vertex -1 anim material bone bone anim texture 0.500000
+anim anim -1 = material 1.0
+1.0
+0.500000 frame bone material
+-1 texture material vertex
+bone =
+anim bone
+bone
+vertex 1.0 anim -1
+-1 frame texture vertex bone 1.0 bone
+frame 1.0 anim vertex frame material
+material
+material texture 0.500000 anim 1.0
+frame texture
+material
+-1
+frame frame bone frame material material 0.500000 vertex vertex material vertex 0.500000
+texture vertex vertex frame
+1.0 = material 0.500000
+= vertex
+texture
+anim -1
+material vertex 1.0 vertex anim 0.500000 anim bone
+0.500000 0.500000
+material 1.0 anim texture -1
+-1 bone bone vertex anim material frame -1 bone frame 0.500000
+1.0 texture bone material material bone 0.500000 1.0 0.500000
+texture material -1 vertex 1.0
+bone = texture 1.0 texture texture 0.500000 material frame -1
+frame 1.0 bone
+-1 1.0 vertex
+texture anim -1
+anim
+texture material -1
+bone frame = vertex
+texture texture
+material bone bone
+texture material -1
+1.0 = material
+texture anim
+texture vertex 1.0 1.0
+anim frame
+1.0 0.500000
+= 1.0 texture 1.0 frame
+bone
+frame material vertex anim 1.0 =
+0.500000
+material -1 anim bone bone vertex anim
+1.0 frame frame
+bone
+texture
+vertex anim
+vertex frame anim material texture material texture anim anim = -1
+vertex material
+0.500000
+0.500000 anim vertex -1
+frame
+anim frame bone
+bone vertex
+vertex -1 frame
+vertex 0.500000 anim bone texture =
+frame = frame
+= frame
+bone -1 frame vertex frame frame material
+vertex
+=
+vertex bone
+-1
+= material
+bone 1.0 texture
+-1 bone texture
+1.0
+0.500000 frame = anim vertex
+texture 1.0
+vertex vertex bone material 1.0 frame material anim frame =
+bone material
+texture vertex bone bone 0.500000 0.500000
+bone
+1.0 vertex bone material frame vertex = frame
+anim = 1.0
+texture texture
+-1 vertex 1.0 frame = -1 bone bone
+anim -1 = =
+bone 1.0 anim vertex
+anim
+texture = bone material texture -1 1.0 1.0 frame material
+texture 1.0
+anim
+frame
+frame 1.0 bone -1
+bone
+1.0
+vertex 1.0
+anim 0.500000 -1 -1
+=
+vertex
+material -1 texture
+1.0 texture anim -1 = anim bone 0.500000 frame = anim texture bone material -1 anim -1 anim -1 -1 vertex 1.0 texture material
+texture texture
+0.500000
+material vertex 1.0
+1.0 vertex bone 0.500000 = -1 material frame frame frame 1.0 texture
+frame texture vertex 0.500000 = material
+-1
+anim
+frame = = bone frame 0.500000 -1 texture -1 texture =
+-1
+bone bone anim vertex bone texture
+0.500000 vertex
+texture anim vertex texture vertex
+-1 anim = frame frame texture 0.500000 frame bone 1.0 bone 0.500000 0.500000 texture -1 material bone 1.0 -1
+0.500000
+material 1.0 frame
+texture 1.0 anim -1 1.0 1.0 vertex texture
+texture
+vertex anim
+material frame
+bone material anim
+vertex -1
+material material material anim bone
+bone 0.500000 a
\ No newline at end of file
@@ -0,0 +1,5 @@
+anim
+anim
+anim bone -1 bone material
+bone material frame anim =
+0.500000 bone -
\ No newline at end of file
@@ -0,0 +1,113 @@
+1.0 material vertex
+1.0 texture -1
+frame frame frame material material 0.500000 anim
+texture 1.0 1.0 -1 0.500000 =
+1.0 frame
+material
+texture vertex
+texture 1.0 anim = anim vertex 0.500000
+1.0 1.0 1.0 anim material
+bone
+texture -1 0.500000 bone = bone 0.500000 frame texture texture 0.500000
+bone
+texture vertex 1.0
+frame
+vertex
+texture material vertex frame
+material anim
+anim anim 1.0 frame anim 0.500000 frame
+= anim 1.0 1.0 0.500000 1.0 0.500000 -1 -1 1.0 material
+= -1 0.500000 = = vertex bone 0.500000 -1 anim bone =
+bone vertex -1 vertex texture texture material
+texture
+bone 0.500000 1.0 texture 1.0 bone frame texture anim -1
+0.500000 anim material material frame texture texture texture 0.500000
+frame texture texture bone 0.500000 = bone material texture texture material
+-1
+texture 0.500000
+material texture anim = material material material 1.0
+anim 1.0 frame material 0.500000 1.0 -1 frame material anim -1
+frame anim anim texture texture 1.0 material
+0.500000 0.500000
+vertex
+anim -1 frame bone 1.0 -1 material -1 -1
+material vertex texture vertex = 1.0 anim anim bone vertex
+anim = bone texture -1
+bone 1.0 = vertex 0.500000
+= anim 0.500000
+1.0 material -1 0.500000 vertex frame
+anim bone -1
+anim frame
+= bone anim material
+texture texture = = frame = anim vertex -1 bone frame frame
+texture bone frame
+frame
+1.0 1.0 anim
+frame
+= material anim bone
+bone texture
+1.0 texture anim frame vertex 1.0 -1
+frame 1.0
+-1
+anim material bone bone vertex
+frame anim
+texture 1.0 frame frame
+-1
+texture vertex
+frame
+texture vertex -1 material vertex = material material -1 0.500000 0.500000 -1 vertex 1.0 bone bone vertex vertex bone
+anim 1.0 bone texture anim material = 1.0 0.500000 vertex =
+1.0
+texture 0.500000 0.500000 material 0.500000
+frame vertex texture texture
+bone vertex = vertex material
+texture anim vertex material
+vertex bone frame
+material vertex
+frame = 1.0
+anim frame
+= texture vertex 1.0
+texture
+vertex texture
+material
+= = frame = 0.500000 bone
+= -1 0.500000 frame
+-1 material
+material 0.500000 vertex =
+0.500000 vertex anim = anim = bone
+= texture anim
+material
+0.500000 texture
+material frame vertex 1.0 material
+anim bone =
+frame -1 anim
+= 1.0 bone 1.0 bone
+vertex -1 = =
+anim
+-1 material vertex
+anim 0.500000
+anim texture
+1.0 anim texture
+texture texture anim
+frame material anim frame material -1
+anim
+1.0 material
+-1
+-1 0.500000
+0.500000 1.0 bone anim =
+bone vertex anim
+bone
+anim
+anim
+anim
+material
+texture material
+frame bone
+-1
+0.500000 bone anim
+material
+bone material -1 1.0
+texture bone vertex anim 1.0 bone vertex material texture
+1.0 material anim
+anim = = anim anim -1 0.500000 -1
+textur
\ No newline at end of file
@@ -0,0 +1,3 @@
+material =
+texture
+frame bone materia
\ No newline at end of file
@@ -0,0 +1,9 @@
+bone texture
+bone anim -1
+0.500000 vertex texture = bone
+bone -1 bone
+anim 0.500000 0.500000 anim -1 -1 = = anim 0.500000 0.500000 texture = texture 0.500000 anim -1 =
+material
+1.0 bone vertex 0.500000
+= vertex
+vertex texture ani
\ No newline at end of file
@@ -0,0 +1,80 @@
+-1
+frame material frame -1 anim 1.0
+= vertex
+vertex =
+material
+bone vertex 0.500000 0.500000 texture material vertex 1.0
+0.500000 = vertex anim anim
+1.0
+0.500000 = 0.500000
+= anim 0.500000 =
+0.500000 -1 texture material bone
+-1 -1
+1.0 -1
+-1
+texture
+0.500000 1.0
+anim vertex
+texture texture -1 anim vertex =
+vertex frame
+anim bone vertex -1 anim
+0.500000 -1
+0.500000 frame frame frame material frame -1 0.500000 frame frame texture anim 1.0 vertex -1 material 1.0 texture bone frame material texture = vertex texture = material
+1.0 bone 0.500000 -1 texture -1 texture
+anim 0.500000 vertex
+vertex 0.500000 frame vertex 0.500000 = texture = -1 bone texture frame 0.500000
+=
+0.500000
+1.0
+anim frame frame vertex 1.0 frame = 0.500000 -1 = frame material texture anim
+= vertex
+0.500000 anim frame frame vertex texture 1.0 anim vertex
+texture
+bone
+= texture material bone material
+-1 0.500000 frame
+1.0 vertex = = -1 material
+-1 frame 0.500000 material vertex material -1 material
+= bone
+vertex 1.0 = frame 0.500000 vertex vertex
+texture texture 0.500000 1.0 material
+vertex
+bone -1 anim
+-1 frame
+frame
+material bone frame vertex texture 0.500000
+-1 vertex material = anim -1 -1
+texture 0.500000 0.500000 frame 1.0 -1 =
+vertex material
+-1
+1.0 0.500000 texture texture =
+texture material frame
+texture 1.0
+1.0 vertex
+1.0
+1.0
+-1
+texture material frame
+material vertex frame anim
+-1 material 1.0
+-1 material
+anim bone
+vertex
+frame bone
+= vertex material -1 0.500000 vertex texture vertex texture texture texture vertex frame 0.500000
+-1 anim anim -1 1.0 = 0.500000 bone vertex vertex 1.0 frame texture anim
+-1 = bone
+frame 0.500000 anim
+1.0
+bone material frame -1 frame -1 anim bone frame -1 -1 1.0 0.500000 frame -1 1.0 anim texture
+0.500000 material
+texture bone = 0.500000 1.0
+0.500000
+vertex material texture
+vertex
+bone material
+material material -1 1.0 bone = anim frame -1
+material 0.500000 1.0 frame
+0.500000
+vertex
+anim
\ No newline at end of file
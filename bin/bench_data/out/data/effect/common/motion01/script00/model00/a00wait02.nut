@@ -0,0 +1,8 @@
+anim anim
+0.500000 anim -1 anim texture
+0.500000 = -1 0.500000
+material bone anim texture
+= -1
+=
+material
+anim material vertex bone material 1.0 =
\ No newline at end of file
@@ -0,0 +1,181 @@
+bone
+bone 0.500000 vertex
+0.500000 material material vertex vertex vertex 1.0 anim
+anim
+anim bone -1 1.0 vertex
+texture = bone bone texture -1
+frame
+texture 1.0
+1.0 frame frame =
+= =
+anim bone texture -1 texture
+0.500000 1.0 texture
+material texture = 0.500000 vertex
+bone -1 =
+-1
+anim
+material 0.500000 -1 material 0.500000 -1 -1
+0.500000 vertex
+texture anim frame bone
+material -1
+0.500000
+bone material 1.0 -1 0.500000 = anim -1
+= bone texture
+=
+= -1 0.500000
+0.500000 =
+texture material
+frame -1 material anim
+0.500000 texture vertex anim
+texture
+frame anim =
+vertex bone material material
+texture frame
+1.0 = = anim
+vertex 1.0
+1.0 0.500000 -1
+texture
+vertex material bone
+= -1 1.0 vertex material
+-1 frame
+= = anim bone
+= 0.500000 anim bone anim
+-1 frame
+0.500000
+-1
+anim
+1.0 =
+texture
+vertex vertex
+anim =
+-1
+1.0 0.500000 material
+0.500000 material vertex frame frame anim texture
+= frame
+1.0 -1 texture
+frame anim texture
+vertex = anim anim material vertex material 1.0 1.0
+= 1.0
+1.0
+1.0 0.500000 texture bone 1.0 = anim
+frame
+1.0 -1
+frame material -1 texture texture bone -1 1.0 -1 vertex texture
+-1
+anim bone material
+= 0.500000 frame texture frame
+material
+bone vertex
+1.0
+1.0
+frame
+1.0 vertex 1.0 1.0 material
+0.500000 frame vertex 1.0 1.0 material bone vertex texture material texture 0.500000 0.500000
+vertex = 0.500000 frame vertex =
+1.0 =
+vertex
+=
+1.0
+-1 bone vertex -1 0.500000 = frame vertex -1 frame 0.500000 anim bone bone 0.500000 material
+0.500000 anim anim = 0.500000 anim bone anim frame -1 frame bone anim texture
+anim bone vertex 1.0 0.500000
+anim = 1.0 texture vertex -1
+1.0 vertex vertex
+frame vertex
+0.500000
+texture -1 = = -1 0.500000
+-1 frame bone material vertex vertex texture = material
+texture anim frame
+texture
+-1 material -1 -1
+bone frame
+material
+-1 0.500000 1.0 vertex 0.500000
+frame 1.0
+bone -1 = frame 1.0 vertex 0.500000
+frame 0.500000
+vertex 1.0
+material
+frame anim anim anim bone texture 0.500000 1.0 texture
+bone
+vertex 0.500000
+1.0 -1 vertex bone anim = bone vertex texture 0.500000 -1 1.0
+bone material
+texture
+anim material 0.500000 = material anim anim 1.0 =
+= =
+texture frame material
+anim
+vertex vertex anim texture texture bone 1.0 frame
+texture material bone
+bone bone 1.0 frame
+-1
+= vertex bone
+material
+= = material 0.500000 0.500000 -1 -1 -1 = =
+0.500000 vertex 0.500000 0.500000 bone anim material = material vertex bone anim anim material
+frame vertex
+bone
+-1
+vertex frame frame 0.500000 anim
+frame texture material anim 1.0 vertex
+vertex vertex
+-1 frame bone texture
+texture -1
+0.500000 =
+anim
+bone texture 0.500000 frame = material
+frame 0.500000 anim = -1 vertex -1 material
+0.500000 vertex
+anim = bone
+= -1 -1
+= 0.500000 bone -1 frame
+frame
+bone 1.0 texture anim
+frame anim 1.0 1.0 frame
+1.0 frame 0.500000
+frame
+frame 1.0
+bone 0.500000 vertex
+anim
+material texture vertex vertex
+0.500000 vertex vertex 0.500000 = bone
+0.500000 = frame vertex 0.500000
+vertex material
+material
+frame 0.500000 0.500000 vertex bone =
+vertex texture = -1
+1.0 material frame texture
+0.500000 frame frame =
+0.500000
+anim =
+bone
+= = texture
+frame material bone bone material
+vertex 0.500000 = 0.500000 texture -1 = anim vertex anim vertex anim bone
+material
+material
+1.0 frame
+0.500000 texture frame
+0.500000
+0.500000
+= anim vertex vertex bone -1 bone
+anim
+anim frame 1.0 -1
+-1
+texture
+texture frame vertex 0.500000
+vertex
+1.0
+0.500000 = bone 1.0 = texture texture
+0.500000 1.0 0.500000 texture
+1.0 -1
+anim
+material
+material anim frame = vertex frame
+anim =
+frame bone
+frame -1 0.500000 material frame bone 0.500000 = 0.500000
+vertex vertex texture =
+0.500000 texture
+frame -1 texture anim material 0.50000
\ No newline at end of file
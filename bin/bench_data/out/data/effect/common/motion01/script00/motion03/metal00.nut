@@ -0,0 +1 @@
+0.500000 0.500000 vertex 1.0 vertex anim 
\ No newline at end of file
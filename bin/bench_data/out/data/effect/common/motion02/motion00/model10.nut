@@ -0,0 +1,15 @@
+1.0 vertex frame = material
+material anim bone texture frame
+texture vertex material texture bone
+frame 1.0
+anim texture bone texture material = material frame anim texture texture = material material -1 frame = -1 texture
+-1
+vertex
+0.500000 anim
+texture bone 1.0 bone bone bone bone material texture frame -1 -1 anim
+1.0 bone -1 frame
+texture 1.0 0.500000 material
+anim material material bone 1.0
+vertex 1.0 anim
+1.0 = 1.0 -1
+0.500000 1.0 bone -1 anim frame = frame t
\ No newline at end of file
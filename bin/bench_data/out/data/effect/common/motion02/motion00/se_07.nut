@@ -0,0 +1,41 @@
+-1 anim vertex material
+texture
+anim 0.500000 bone vertex texture -1 0.500000 0.500000 = = =
+anim frame 0.500000 0.500000 anim 0.500000 1.0 vertex
+vertex
+1.0 0.500000 0.500000 1.0 frame 1.0 -1 0.500000 1.0
+material anim bone = bone = material 0.500000 frame 1.0 texture frame frame anim
+material material
+1.0 material 1.0 -1 vertex -1
+0.500000
+texture vertex 0.500000 bone -1 0.500000 -1 texture texture vertex anim vertex -1 bone = 1.0 texture -1 vertex
+anim =
+texture bone
+anim
+= material material vertex texture
+texture =
+material =
+-1
+1.0 bone anim = bone texture
+vertex texture
+vertex =
+-1 -1 anim 1.0
+material texture
+vertex 1.0 anim anim texture
+= texture frame 1.0
+vertex anim 0.500000 anim frame
+=
+= frame
+1.0 -1 0.500000 =
+anim anim -1 bone
+texture = 1.0 anim anim bone material texture
+anim bone bone material 1.0
+frame texture frame anim 0.500000 -1 texture texture
+texture = vertex = material texture
+bone 0.500000 material material frame = material frame -1 material
+vertex anim
+0.500000 0.500000
+anim
+= texture bone 1.0 material
+-1 1.0 vertex -1 bone = = material texture 0.500000
+materia
\ No newline at end of file
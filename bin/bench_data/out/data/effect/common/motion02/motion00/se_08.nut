@@ -0,0 +1,13 @@
+-1
+= anim
+-1
+material vertex
+= bone anim
+anim
+anim -1
+vertex
+1.0
+= -1 frame material
+material anim anim frame 0.500000 texture frame frame 0.500000
+0.500000 frame bone texture = 1.0 1.0 = texture = frame = frame anim 1.0 vertex
+material a
\ No newline at end of file
@@ -0,0 +1,6 @@
+texture
+anim
+material
+= material
+0.500000 anim bone frame
+1.0 1.0 vertex an
\ No newline at end of file
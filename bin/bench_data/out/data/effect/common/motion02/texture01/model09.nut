@@ -0,0 +1,3 @@
+anim = 0.500000 =
+= anim
+1.0 bone texture material vertex
\ No newline at end of file
@@ -0,0 +1,14 @@
+material anim bone
+material
+anim
+texture vertex 1.0 texture bone material
+anim
+bone vertex texture 1.0
+= material vertex = 0.500000 -1
+texture texture
+0.500000 frame 1.0 = material -1 0.500000 texture texture texture = texture
+material frame -1 bone material -1 frame vertex vertex texture
+frame
+bone
+= bone material
+texture -1 texture vertex text
\ No newline at end of file
@@ -0,0 +1,10 @@
+anim
+1.0 frame
+vertex
+material frame frame
+frame 1.0 material bone anim bone 1.0
+bone
+-1 material bone material =
+0.500000 =
+material vertex bone -1 texture = -1 bone anim = anim 0.500000
+material anim 1.0 frame anim vertex -1 texture = 1.0 0.50
\ No newline at end of file
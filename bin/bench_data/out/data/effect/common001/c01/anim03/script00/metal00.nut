@@ -0,0 +1,58 @@
+anim texture texture 1.0 bone frame material 0.500000 vertex -1
+1.0 0.500000 0.500000
+-1
+=
+vertex bone
+texture bone
+material texture texture anim 1.0
+material texture
+anim
+0.500000 material
+1.0
+anim = -1
+texture material
+texture bone 1.0 = anim material
+bone anim frame bone material vertex
+0.500000 0.500000
+texture 1.0 material material bone
+1.0
+-1 anim bone 1.0
+vertex vertex 0.500000 0.500000 frame material texture frame = bone = anim texture
+0.500000 texture = material bone vertex -1 bone texture 1.0 0.500000 1.0 = bone
+vertex 1.0 material -1
+bone frame texture
+material
+vertex 1.0 frame -1 1.0 -1
+1.0 = = material -1 = = anim = material material 0.500000 1.0
+material -1 1.0
+-1 -1 vertex anim material material
+= texture texture = = =
+texture
+-1 -1 0.500000 texture texture = material
+0.500000 frame 1.0 bone -1
+-1 1.0 vertex
+= material 0.500000 bone vertex
+material
+1.0 bone texture material -1 =
+bone = = 1.0 material 1.0
+texture vertex material anim material texture texture
+material texture frame vertex
+1.0 0.500000 -1 0.500000 frame
+-1
+material vertex texture
+1.0 = -1 1.0 bone texture material
+bone
+vertex anim vertex
+= vertex vertex vertex -1 anim = anim
+vertex
+anim
+1.0
+material anim
+texture -1 1.0 -1 texture
+-1 material
+bone
+material 0.500000 vertex = vertex texture -1 1.0
+anim
+-1
+-1 bone texture
+frame anim = 0.500000 bone 0
\ No newline at end of file
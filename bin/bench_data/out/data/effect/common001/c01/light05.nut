@@ -0,0 +1,15 @@
+bone material
+material
+frame
+-1 texture -1
+0.500000 material
+0.500000 0.500000
+0.500000 frame material 0.500000
+= anim anim anim vertex 1.0 vertex bone 0.500000 1.0 bone -1 texture anim frame 0.500000 1.0
+material vertex -1 1.0
+texture frame texture
+vertex bone vertex 1.0 -1 0.500000 0.500000 material -1 frame 0.500000
+bone = = material bone material texture
+bone = bone texture 1.0 bone bone 1.0 1.0 -1 texture anim
+=
+frame -1 1.
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture
+material vertex
+frame vertex -1
+bone texture
+0.500000 bone
+0.500000 frame
+-1 bone frame
+= material -1 1.0
+material frame -1 -1 0.500000
\ No newline at end of file
@@ -0,0 +1,58 @@
+vertex -1
+frame
+material material vertex material
+bone
+0.500000
+material texture -1
+frame bone
+anim vertex 1.0 -1 material frame frame =
+material
+vertex
+material
+vertex texture = vertex 1.0 1.0
+texture 0.500000
+vertex material material
+bone bone bone
+vertex frame
+material -1
+-1
+frame bone bone 1.0
+bone -1 -1 vertex texture = material -1
+= = bone vertex frame 0.500000 = = 0.500000 1.0
+bone anim
+frame -1 = anim texture 0.500000 material anim -1 texture material
+frame
+1.0 = -1 vertex 0.500000 1.0
+-1
+frame
+-1 texture 1.0 0.500000 -1 0.500000
+material -1 bone
+texture
+1.0 vertex texture = anim 1.0 -1 frame vertex
+bone anim vertex anim bone material
+texture
+1.0 anim
+texture =
+1.0
+texture -1 texture
+bone vertex bone
+0.500000 anim
+frame = 0.500000 texture anim =
+0.500000 bone
+vertex
+anim material = anim
+=
+material anim
+bone -1 frame -1 bone bone frame = 0.500000 = vertex
+texture anim = 0.500000 -1 material bone anim vertex texture
+anim anim frame
+bone anim 0.500000 vertex -1 vertex
+0.500000 material
+texture anim 1.0 1.0 frame vertex frame
+0.500000 material
+= 0.500000 frame
+vertex frame material
+= -1 bone -1 -1
+anim 1.0 material
+frame = -1 = 1.0
+frame
\ No newline at end of file
@@ -0,0 +1 @@
+0.500000 vertex -1 frame 1.0 bone
\ No newline at end of file
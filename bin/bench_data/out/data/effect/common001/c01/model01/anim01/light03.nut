@@ -0,0 +1,123 @@
+1.0 0.500000 anim frame texture
+texture
+anim material 0.500000 bone
+-1 = bone 0.500000
+-1 frame -1
+material texture 1.0
+anim
+material
+material bone texture = bone 0.500000 anim frame frame
+bone
+vertex material
+bone
+frame
+1.0 bone vertex material 1.0 bone
+0.500000 1.0
+0.500000 bone = 0.500000
+= material texture anim -1 vertex
+material
+= bone anim -1 anim anim 1.0 material frame material
+anim -1 texture 1.0
+anim frame = texture vertex
+bone material
+1.0 bone 1.0 anim -1 texture
+frame 0.500000 bone anim bone anim -1 -1
+frame vertex
+1.0 0.500000 =
+vertex frame frame material -1 vertex
+bone bone frame = bone vertex
+bone bone 0.500000 1.0 frame
+anim
+material 1.0
+material vertex 1.0 frame frame vertex 0.500000 vertex bone texture material texture material bone bone -1 1.0 texture bone material = bone material frame 0.500000 0.500000 -1 material -1 1.0
+anim 0.500000
+texture
+bone bone texture anim = vertex
+anim material texture texture texture 0.500000
+frame material texture bone texture = bone vertex vertex
+vertex bone frame bone material texture material texture -1 bone vertex anim = frame = texture -1
+0.500000 frame vertex texture = frame
+-1 = = 0.500000 bone -1 0.500000 vertex = texture 1.0 frame 0.500000 vertex
+material vertex anim = anim anim 0.500000 vertex anim
+anim vertex frame
+anim frame 0.500000 0.500000 bone -1
+vertex
+material frame -1 frame 0.500000 vertex
+bone material
+-1 frame vertex
+-1 frame
+-1 0.500000 -1 vertex vertex texture 0.500000 1.0 bone
+0.500000 texture bone texture bone
+anim
+= 1.0 vertex 1.0 bone frame
+vertex material bone 0.500000 material
+vertex bone -1 -1 -1
+anim
+-1 0.500000 anim = 0.500000 anim
+texture 1.0
+bone anim anim frame
+-1
+-1 frame bone vertex frame
+texture anim 0.500000 -1 frame texture
+frame bone frame -1 bone material bone material = material 1.0
+material -1
+vertex vertex anim material frame vertex texture material 0.500000 1.0 vertex texture
+1.0 -1 anim vertex
+1.0 texture anim
+bone texture 0.500000 frame -1
+anim
+vertex
+frame texture material
+bone 0.500000 1.0 0.500000
+0.500000 anim bone anim =
+vertex 1.0 anim 1.0 material
+texture = vertex texture material
+anim
+bone frame material = -1 vertex texture
+frame bone 0.500000 = -1 0.500000 bone material frame vertex 0.500000 1.0 0.500000 vertex anim
+bone = bone =
+anim
+bone = texture bone
+material material
+0.500000
+material bone
+anim
+1.0 vertex anim -1 material 0.500000 material 1.0 texture frame texture bone vertex frame -1 vertex -1 1.0 -1 -1 vertex
+vertex 1.0
+=
+-1 0.500000
+-1 vertex
+vertex texture 1.0
+bone frame -1 bone bone bone -1
+-1 material anim vertex frame
+frame
+-1
+=
+frame -1 texture
+texture texture
+0.500000
+texture anim anim 0.500000 -1
+frame texture 0.500000 bone
+= 0.500000 bone 1.0
+1.0 texture -1 anim texture texture bone -1 anim vertex
+1.0 -1
+1.0 material 0.500000 bone vertex material
+= texture texture = 0.500000 vertex = vertex material bone 0.500000 frame anim
+texture material = bone material
+material frame anim -1 1.0 0.500000 0.500000 = vertex
+1.0 -1 frame anim 0.500000 1.0 bone
+vertex -1 = -1 vertex bone 1.0 -1 anim anim
+material material
+bone 1.0 vertex bone
+-1
+1.0 anim
+0.500000 vertex =
+texture
+material
+vertex bone material
+0.500000 frame = vertex material -1
+-1 1.0
+= -1 material 1.0
+bone
+material 0.500000
+frame -1 bone anim = bone bone 
\ No newline at end of file
@@ -0,0 +1,175 @@
+frame
+1.0 anim anim 0.500000
+vertex 1.0 -1 anim texture bone vertex
+frame = bone bone
+frame -1
+bone 1.0
+0.500000
+texture
+anim vertex
+anim 0.500000
+bone vertex
+anim
+material 0.500000
+material
+bone
+frame anim bone 1.0 0.500000 1.0 0.500000 material = -1 material
+anim vertex 1.0
+vertex material material
+vertex 0.500000 -1 0.500000 texture vertex
+vertex bone 1.0 material 1.0 bone
+= 1.0 bone 0.500000
+0.500000 bone vertex -1 = anim vertex 1.0 1.0 = -1
+material 1.0 bone vertex bone vertex
+material material = -1 frame texture frame
+vertex
+frame vertex -1 material 0.500000
+texture = -1 = frame vertex
+= 0.500000 vertex
+0.500000 1.0 material anim texture material 0.500000 -1 texture
+bone -1 0.500000 1.0 0.500000 1.0 frame bone material
+bone -1 frame
+bone 0.500000 material anim frame
+material
+1.0 material
+texture -1 texture
+frame frame
+texture material anim 1.0 0.500000 0.500000 =
+=
+frame 0.500000 anim
+vertex bone bone anim frame
+material
+-1 = anim -1 0.500000 1.0 material -1 material -1 bone frame anim bone
+material
+bone bone material -1 = 0.500000 texture 1.0 vertex
+0.500000 material bone -1 =
+anim material
+anim frame
+-1 bone
+frame material vertex 0.500000 material = 0.500000 vertex 1.0 frame 1.0 = anim
+anim frame texture vertex frame texture anim
+0.500000
+texture 0.500000 0.500000
+= -1 1.0 frame frame anim vertex vertex
+= -1
+material bone vertex texture =
+frame
+-1 material anim vertex anim
+=
+anim 0.500000 1.0 1.0 material
+vertex
+texture material texture -1 bone vertex texture anim bone anim
+vertex 1.0
+1.0 material material
+vertex
+vertex
+material -1 texture 0.500000 vertex texture material = 0.500000 = vertex -1 = = 1.0 =
+1.0 1.0
+texture frame =
+0.500000 bone
+frame
+vertex -1 1.0 -1
+frame 1.0 bone
+anim
+-1 1.0 bone
+0.500000 texture vertex frame -1
+vertex 1.0 -1 -1 material
+texture = texture texture vertex -1 0.500000 material texture -1 1.0 0.500000 material 0.500000 = anim -1 anim texture = = vertex frame
+material
+bone -1 1.0 bone
+-1 bone
+= texture
+= frame = frame = 1.0 frame = anim = anim vertex texture bone vertex
+anim vertex
+bone bone
+bone
+frame material material
+texture vertex
+texture -1 1.0
+bone anim
+frame bone
+anim 0.500000
+0.500000 anim bone texture
+0.500000 anim
+1.0 1.0 bone 0.500000 -1 vertex = 0.500000 material material anim vertex
+-1 material bone 0.500000
+frame frame anim 0.500000 = =
+0.500000 0.500000 1.0 vertex material anim vertex
+-1 frame
+1.0
+-1 1.0 = bone = 1.0 material 0.500000 texture 0.500000 -1 bone -1 texture texture 1.0 -1
+vertex anim 1.0 material -1 material frame
+1.0 1.0 frame
+0.500000
+texture anim
+-1 anim 1.0
+texture texture
+anim 0.500000
+= 1.0
+0.500000 = bone
+bone
+frame -1 1.0
+vertex texture
+-1 0.500000
+1.0 bone bone material bone = = frame bone = texture frame bone -1 1.0
+1.0 = 0.500000 texture
+vertex frame 1.0 frame texture -1 frame
+0.500000 0.500000 texture
+bone 1.0
+texture -1 anim
+-1 material frame 1.0 frame vertex
+0.500000 anim
+= = vertex
+0.500000
+frame anim vertex
+0.500000
+1.0 vertex 0.500000
+=
+frame vertex
+bone texture bone
+anim
+texture 0.500000
+= anim vertex frame bone frame anim 1.0
+1.0 vertex frame
+1.0
+1.0 0.500000 -1 1.0 -1 texture -1
+texture vertex
+1.0 1.0
+texture 1.0 frame bone 0.500000
+texture material anim bone = vertex frame 1.0 1.0 frame vertex vertex material -1 vertex 0.500000 1.0 0.500000
+texture frame = anim
+bone texture 0.500000 1.0 0.500000 bone
+anim vertex anim -1
+frame =
+material -1 1.0 vertex texture
+= frame
+1.0 1.0
+-1 anim texture -1 bone 1.0
+-1 1.0 vertex -1
+anim
+= material
+0.500000 = 1.0
+material vertex -1
+frame frame material -1 -1
+bone frame vertex bone frame texture 1.0
+bone
+0.500000 anim
+frame texture 0.500000 frame vertex
+vertex -1 0.500000
+0.500000
+0.500000 0.500000 = material
+anim = anim material 1.0
+1.0
+vertex
+vertex 0.500000
+vertex texture material
+anim
+-1
+1.0
+anim 1.0 =
+vertex frame
+vertex material = bone texture texture frame 1.0 texture anim bone
+0.500000 0.500000
+= 1.0
+-1
+0.500000 -1 frame 0.500000 -1 textur
\ No newline at end of file
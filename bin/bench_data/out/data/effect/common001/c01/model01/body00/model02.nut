@@ -0,0 +1,3 @@
+=
+vertex material material texture
+-1
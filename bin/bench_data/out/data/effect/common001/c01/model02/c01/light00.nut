@@ -0,0 +1 @@
+T(:KygJ#{m}JzǘNr"@||,:l]r@%
\ No newline at end of file
@@ -0,0 +1,338 @@
+-1
+-1 texture 0.500000 bone vertex = 1.0 frame
+1.0
+material texture 0.500000
+frame
+-1 = vertex
+1.0 frame texture
+anim bone = vertex frame anim 0.500000
+material texture 0.500000 bone material 0.500000 = 0.500000 -1 anim
+bone -1 frame 0.500000 material -1
+frame frame
+1.0
+1.0 texture
+1.0
+anim =
+frame vertex frame anim
+anim
+frame frame
+bone
+vertex material
+anim 1.0 material vertex 1.0 1.0 bone -1 material 1.0 frame
+frame 0.500000 frame
+= 0.500000
+material material 1.0 -1 anim 1.0
+material 0.500000 1.0 texture
+-1
+0.500000 bone =
+0.500000 anim vertex vertex
+anim texture anim 1.0 0.500000
+-1 =
+-1 = frame vertex
+0.500000 bone material -1 0.500000
+1.0 0.500000 texture frame
+texture 1.0
+frame material texture frame frame = material -1 -1 0.500000
+0.500000 vertex 1.0 1.0 bone material
+vertex bone = frame
+texture
+bone -1 texture
+0.500000
+0.500000 texture frame
+anim vertex 0.500000
+material bone = -1
+texture frame bone anim material texture 0.500000
+anim = -1 bone bone material
+texture texture texture -1 anim
+-1 frame
+vertex -1
+anim material frame 1.0 =
+bone
+material frame texture
+-1 material bone 1.0 = material
+= texture = =
+0.500000 vertex
+material material frame bone = vertex texture =
+1.0 -1 material bone
+texture vertex bone
+bone texture
+0.500000 texture texture 1.0 0.500000 material 1.0 material anim material = texture 0.500000 =
+1.0 texture anim vertex frame texture
+texture 1.0
+vertex bone
+-1 bone -1 texture vertex material frame material vertex
+frame anim
+1.0 material frame 0.500000 bone
+frame vertex material material bone 1.0
+anim anim vertex frame
+vertex 1.0 texture anim
+-1
+-1 texture
+bone bone bone vertex bone anim texture material vertex bone texture -1 bone material bone
+anim texture vertex
+texture
+1.0 material 1.0 texture vertex
+vertex anim 1.0
+-1 frame -1 vertex vertex
+material
+frame
+-1 anim = frame 1.0 material = frame vertex 1.0 1.0 0.500000 -1
+0.500000 frame
+texture -1 texture 1.0
+1.0 vertex vertex vertex
+anim vertex frame texture
+frame
+anim
+material anim 0.500000
+anim -1 1.0 -1 material
+bone anim -1 -1 texture texture
+material = anim
+anim
+-1
+anim 0.500000 material bone
+bone anim -1
+-1 vertex anim 0.500000 frame material bone
+bone -1 texture 1.0
+frame bone vertex
+texture 1.0 anim texture -1 bone
+material texture 0.500000
+-1 texture anim texture -1 -1
+material =
+material 1.0 frame 0.500000 texture
+-1 material
+=
+material
+1.0 = material
+texture
+material material texture
+1.0
+texture = 1.0 -1 material 1.0 anim
+anim bone frame material
+-1
+vertex
+bone 1.0
+texture
+material = vertex material frame
+frame material 0.500000 1.0 texture = bone
+frame
+vertex texture frame texture bone frame vertex 0.500000 texture anim 0.500000 anim = 1.0 vertex -1 -1
+bone anim 0.500000
+material frame frame
+0.500000 =
+-1 1.0 bone
+vertex anim vertex bone 0.500000 1.0
+anim
+= = frame = bone
+material bone 1.0
+frame
+-1 -1 1.0 0.500000 material anim frame frame vertex
+-1 texture 1.0
+-1 0.500000 = bone
+vertex
+0.500000
+material 1.0
+0.500000 frame vertex frame 0.500000 = 1.0 1.0 = frame frame
+anim -1
+bone texture texture texture bone bone material
+vertex
+material material
+frame -1 frame frame anim vertex anim frame anim = texture
+= anim
+0.500000 texture vertex bone material
+anim anim material anim -1 frame =
+material vertex
+vertex bone -1 1.0 1.0 texture
+1.0 -1
+anim
+0.500000 frame 0.500000
+1.0 vertex anim 1.0 -1
+-1 vertex 0.500000 frame
+0.500000 1.0
+= anim
+-1
+vertex -1
+anim
+frame -1
+-1 -1 texture 1.0 anim vertex texture material
+vertex
+-1
+bone
+-1 -1 frame
+texture
+vertex 1.0 frame frame vertex frame anim
+material vertex vertex texture frame bone frame 1.0 = frame =
+material bone frame
+anim -1 texture vertex bone -1 vertex 1.0 anim vertex material 0.500000 frame material 0.500000 -1 vertex
+vertex frame 1.0 -1 = texture material
+frame
+texture =
+0.500000 texture -1 -1 anim anim -1 vertex
+0.500000 material vertex
+= frame anim material 0.500000 = frame 0.500000 material bone
+-1 bone =
+-1 bone
+anim frame
+= texture -1
+-1
+anim texture anim anim 1.0
+bone anim vertex
+material 0.500000 bone anim texture material
+vertex frame
+1.0 vertex -1 = 0.500000
+bone = = bone -1 bone
+texture bone
+vertex
+= 0.500000 -1 anim anim bone anim = -1
+=
+-1
+vertex vertex 1.0
+1.0 texture =
+bone texture anim
+-1 frame vertex
+bone anim material anim vertex
+= 0.500000 anim anim bone vertex =
+frame texture texture texture frame texture texture
+material
+texture
+material
+vertex -1 =
+frame
+0.500000 frame
+0.500000 = vertex 0.500000 1.0
+= bone 1.0 material vertex 0.500000
+vertex
+texture = frame anim 1.0 0.500000 material
+material
+1.0 material = 1.0 0.500000 anim bone -1 material 0.500000 anim material 0.500000 anim
+anim material 0.500000 0.500000 = =
+texture 0.500000 texture material
+1.0 frame
+frame texture texture 1.0
+material anim = 1.0 anim anim texture 1.0 frame anim
+frame
+material -1 anim texture
+texture 1.0 = texture frame texture
+bone bone vertex = anim anim bone
+-1 material 0.500000 -1 material -1 = = -1
+1.0
+anim
+vertex anim bone
+1.0 -1 anim
+-1 material vertex
+= anim frame
+vertex
+= -1
+1.0 anim
+material
+anim 0.500000
+texture texture material texture 1.0 texture material bone bone 0.500000
+1.0 -1
+texture 1.0 = anim = 0.500000
+0.500000
+texture
+bone = vertex 1.0 -1 frame vertex
+vertex frame = 0.500000 material 1.0 frame 0.500000 vertex frame bone = -1 texture
+bone
+1.0
+texture 1.0 0.500000 vertex bone
+texture anim texture -1 frame vertex
+anim 0.500000 -1 material texture texture 0.500000 bone anim = material
+1.0 texture vertex frame 0.500000 = 1.0
+material
+= 1.0 frame texture =
+0.500000 1.0
+= frame material anim 0.500000 bone = =
+vertex bone bone material
+-1 bone =
+0.500000 anim vertex
+vertex -1
+material
+-1 -1
+0.500000 1.0 -1 0.500000 -1
+0.500000
+1.0 frame
+bone vertex = vertex
+frame 1.0 0.500000
+= texture
+-1 vertex
+bone texture vertex
+= 0.500000 1.0 anim
+material
+0.500000 1.0
+vertex
+bone material -1 -1 frame 1.0 frame =
+= anim frame frame 1.0 = =
+vertex bone texture
+= -1
+texture -1 bone
+frame anim 0.500000 0.500000 anim bone = anim = 0.500000 0.500000 1.0 -1 texture -1 texture
+frame = =
+-1 frame 0.500000 bone
+frame anim 1.0
+anim 0.500000 -1 -1 bone
+-1
+anim 1.0 frame 1.0 1.0 -1 0.500000 bone vertex =
+=
+material vertex anim vertex texture frame = vertex
+bone bone
+= 1.0 vertex -1 frame = 0.500000 0.500000 bone vertex
+0.500000 1.0
+-1 -1
+bone texture -1 texture
+texture =
+vertex
+anim = 0.500000 = -1 frame anim material frame
+-1 bone texture 1.0 material vertex = anim material material
+anim texture -1 texture texture 0.500000 -1 material bone 1.0 vertex vertex
+= material anim
+0.500000
+= anim 1.0 material
+vertex frame material anim material
+0.500000 vertex
+frame vertex
+material material 1.0
+frame frame frame texture 0.500000
+-1 -1 vertex bone anim 0.500000 material =
+= material 0.500000 0.500000 frame
+1.0 material -1
+-1 material bone texture frame material
+1.0
+-1 texture bone vertex vertex 1.0 0.500000
+bone -1 vertex frame
+= frame
+bone bone
+= material texture
+anim 1.0 vertex
+-1 1.0 frame 1.0 anim anim vertex 0.500000 1.0 bone material 0.500000 frame 0.500000
+material 1.0 = bone
+material -1
+= = frame vertex anim 0.500000 1.0 -1 = frame material frame 1.0 bone
+0.500000
+anim vertex 1.0 1.0 1.0 vertex frame texture bone texture
+0.500000 = 0.500000 0.500000 anim 0.500000
+frame frame
+frame bone material 1.0 0.500000
+frame vertex texture -1 frame texture frame material
+bone -1 frame vertex 0.500000 anim 1.0
+anim =
+material frame -1 frame bone 0.500000
+0.500000
+-1 material anim
+0.500000 frame
+-1 0.500000 vertex =
+0.500000 material texture material 1.0 1.0 0.500000
+vertex
+frame -1
+0.500000 material bone bone
+= anim -1 = = texture material anim = anim texture -1
+= 1.0 texture vertex vertex -1 =
+=
+=
+0.500000
+frame
+frame = vertex material
+frame
+= -1 texture
+texture
+= = anim
+1.0
\ No newline at end of file
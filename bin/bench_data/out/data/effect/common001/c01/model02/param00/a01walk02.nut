@@ -0,0 +1,19 @@
+anim vertex
+frame
+frame
+frame -1 bone 0.500000 vertex bone texture
+-1
+texture frame -1 frame material -1
+anim
+material texture
+= frame 1.0 1.0 -1 = anim anim
+material bone material frame 1.0 = vertex texture bone
+1.0 0.500000 0.500000
+vertex 0.500000
+bone = anim 0.500000
+-1 texture
+anim vertex material texture anim
+0.500000 1.0 material vertex
+texture
+0.500000
+texture anim = material = bone = = texture 0.500000 -1 0.500000 frame 0.500000 0.500000 material texture bone 0.5
\ No newline at end of file
@@ -0,0 +1,186 @@
+= 1.0 frame
+material 0.500000 vertex
+= frame
+0.500000
+bone anim
+1.0
+-1 anim texture material 0.500000 vertex
+bone
+material
+material
+1.0 texture -1
+material frame vertex bone
+frame 0.500000 = anim material -1 = bone anim
+1.0 vertex
+material material
+-1 -1 frame 1.0 vertex
+vertex material vertex = bone 1.0 texture bone material material vertex material bone bone texture frame 0.500000
+1.0 anim
+1.0 vertex 1.0 0.500000
+vertex frame =
+anim frame texture 1.0 =
+frame anim bone = texture texture
+0.500000 frame frame material bone bone texture
+anim
+-1
+frame material material vertex = 1.0 anim
+texture 1.0 frame =
+vertex 0.500000 bone
+frame vertex vertex
+0.500000 0.500000
+material
+frame
+bone
+-1
+0.500000 0.500000 material
+anim material frame bone 1.0
+0.500000
+0.500000
+material frame anim
+= -1
+0.500000 1.0 1.0 -1 vertex
+texture bone 1.0
+1.0 bone material = 0.500000 bone vertex = material 0.500000 =
+bone
+1.0
+1.0
+-1
+-1
+anim -1
+-1 material =
+anim -1
+material 0.500000 texture vertex 1.0 frame
+1.0 = bone
+anim -1 material anim 1.0 vertex material -1 texture =
+0.500000 bone
+material texture
+-1 vertex 0.500000 texture 1.0 frame
+material texture
+-1 anim frame anim material 0.500000 texture 0.500000 -1 1.0 =
+0.500000
+vertex =
+= 0.500000
+0.500000 material
+vertex -1
+anim
+1.0 bone anim
+material bone 1.0 0.500000 bone 1.0 frame texture -1 material frame frame 0.500000 material frame
+texture
+= bone
+-1 = texture 0.500000 = = texture anim = texture 0.500000 vertex anim
+vertex = = bone
+bone -1 vertex
+vertex bone 0.500000
+texture frame 1.0
+-1
+texture
+anim bone texture 0.500000 frame -1 anim = frame anim
+anim 1.0 -1 frame frame
+frame = 0.500000 vertex frame
+-1 = material = anim -1 texture 0.500000 vertex =
+anim material anim 0.500000
+vertex anim bone anim material 0.500000 1.0 anim
+-1 anim 0.500000 anim bone anim
+-1 -1 texture anim 1.0
+texture texture
+0.500000 bone material = texture 1.0 vertex
+-1 frame
+-1 frame
+vertex frame frame
+vertex =
+0.500000 1.0 frame
+frame bone anim
+vertex
+texture
+-1 -1
+frame bone -1 0.500000 frame vertex vertex material 1.0
+frame bone
+= bone material = = 1.0 frame material texture 0.500000 material =
+frame texture anim
+material texture material
+texture -1 = vertex texture vertex 1.0 bone
+1.0
+-1 material frame 0.500000 bone bone
+=
+= material vertex -1 texture vertex 0.500000 bone
+material
+1.0 =
+1.0 = frame vertex
+=
+anim bone texture 1.0 1.0
+material bone 1.0 bone 1.0
+frame
+-1 -1 vertex bone material texture bone material
+material anim texture texture anim bone
+texture = -1
+anim
+= = material
+texture =
+material
+anim 0.500000 -1 -1
+0.500000 = 0.500000 texture
+frame
+frame frame 0.500000 0.500000
+=
+=
+bone =
+texture 1.0 vertex =
+1.0 0.500000 = = -1
+bone
+texture frame 1.0 anim bone bone 1.0 0.500000
+-1 1.0
+material bone
+0.500000
+texture frame
+material vertex
+0.500000 0.500000 anim 1.0 material vertex -1
+1.0 vertex = anim bone = = = =
+-1 =
+-1 frame =
+texture material
+1.0 = bone material -1
+= bone 0.500000
+frame texture -1 bone = texture material -1 texture
+texture material
+-1 vertex anim vertex
+= texture
+anim material
+-1 material vertex anim material bone 0.500000 =
+1.0
+anim anim -1 anim
+frame -1 1.0
+1.0 frame
+bone
+frame 1.0 bone
+bone vertex material material frame
+= 0.500000 0.500000 vertex texture 1.0 1.0 -1
+frame vertex texture -1 bone -1 1.0 =
+anim 1.0
+texture vertex 0.500000
+-1
+material texture
+anim = texture
+-1 frame
+material vertex
+frame
+bone 1.0 = vertex anim anim
+= frame
+= frame = -1 0.500000
+-1
+= material vertex
+anim
+=
+=
+material material vertex 1.0
+frame 1.0 vertex anim anim texture anim
+1.0 -1 bone vertex
+texture
+-1 -1 anim material
+= texture frame = vertex material bone 1.0
+-1 = frame texture
+vertex
+= bone
+texture bone vertex = bone -1 bone = texture 1.0 frame anim 1.0
+anim =
+-1 vertex 0.500000 = vertex bone 1.0 material vertex 0.500000 -1
+texture texture
\ No newline at end of file
@@ -0,0 +1,5 @@
+1.0
+= texture
+-1 1.0 0.500000 vertex
+1.0 -1 1.0 frame
+material = 0.5000
\ No newline at end of file
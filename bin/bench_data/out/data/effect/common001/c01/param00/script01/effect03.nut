@@ -0,0 +1,19 @@
+anim anim texture vertex
+= 1.0
+anim anim = 1.0 texture
+vertex 1.0 bone
+frame -1 bone anim texture bone
+material 1.0 0.500000 frame texture bone -1
+material 0.500000
+0.500000 -1 vertex
+anim frame
+frame vertex anim texture vertex texture texture
+0.500000 material texture vertex texture
+= material texture vertex -1 anim material frame bone
+frame = 1.0
+vertex = material 1.0
+anim 1.0
+bone
+bone bone
+frame -1 texture -1 1.0 -1
+anim vertex anim texture = t
\ No newline at end of file
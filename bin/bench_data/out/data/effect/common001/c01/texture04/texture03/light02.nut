@@ -0,0 +1,19 @@
+anim texture -1 vertex -1 1.0
+-1
+anim bone material texture
+= 1.0 anim = frame frame bone
+texture
+vertex
+material
+texture anim texture -1 material = -1 material
+0.500000 0.500000 texture vertex
+0.500000 vertex vertex
+frame
+material material
+material
+1.0 = vertex
+1.0 = texture material -1 frame
+texture
+vertex texture vertex 0.500000 bone -1 1.0 frame 0.500000 texture = anim bone
+0.500000
+bone = ani
\ No newline at end of file
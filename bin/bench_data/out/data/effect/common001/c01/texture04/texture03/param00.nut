@@ -0,0 +1,59 @@
+texture -1
+1.0 1.0 =
+anim material
+material
+0.500000
+vertex
+material
+texture
+bone 0.500000 texture
+1.0
+-1 1.0
+1.0
+-1
+=
+0.500000 vertex bone bone 0.500000 -1 vertex anim
+material texture material = -1
+material 1.0 bone texture 0.500000 bone
+0.500000 texture 0.500000 = bone anim bone frame vertex vertex 1.0 vertex frame material material anim bone 0.500000 vertex =
+texture
+frame frame 0.500000 anim =
+0.500000 0.500000 bone
+bone bone material bone
+-1
+texture = vertex = -1 vertex
+material
+1.0 frame -1 vertex vertex
+= 0.500000 bone
+material material material vertex material material = vertex = 0.500000 texture
+= texture vertex
+= bone 1.0 material material
+= 1.0 material
+1.0 texture
+vertex material frame bone 0.500000
+= 1.0 texture material material bone texture anim material bone vertex -1
+-1 anim
+material material -1 bone material -1 frame material
+= 0.500000 material vertex vertex 1.0 material = 0.500000 0.500000 -1 bone 1.0 vertex bone frame frame anim anim -1
+frame frame = frame 1.0 vertex = 0.500000
+-1 0.500000 1.0 0.500000 anim = frame
+texture material texture texture texture
+frame
+-1
+material vertex 1.0 vertex vertex 0.500000 bone bone vertex = = material 1.0
+vertex = anim
+frame
+texture frame bone material bone material bone texture frame 1.0 anim texture texture 1.0 texture bone material material
+anim anim vertex 1.0
+vertex vertex anim vertex
+frame anim
+-1 vertex anim
+texture 1.0 bone 0.500000 bone texture
+= vertex
+vertex bone
+bone
+material frame = anim =
+anim
+bone vertex 0.500000
+vertex frame -1
+vertex 0.500000 ani
\ No newline at end of file
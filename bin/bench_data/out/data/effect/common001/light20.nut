@@ -0,0 +1,47 @@
+bone material 1.0 bone 1.0 material
+1.0 -1 texture = frame anim 1.0
+texture
+texture 1.0 anim 0.500000 frame = 1.0
+1.0 0.500000 0.500000 -1 bone anim = anim material = bone material vertex -1 frame material
+material = 0.500000
+bone 1.0 vertex bone -1 texture
+-1 = texture vertex frame
+material anim 1.0 anim material
+material texture -1 texture anim -1 0.500000
+anim 1.0
+1.0 =
+0.500000 vertex = 0.500000 material 1.0 material frame material vertex bone frame = 1.0 texture material -1 0.500000 bone
+anim
+1.0 bone texture 0.500000
+= 1.0 0.500000 1.0 vertex frame texture
+material anim
+= texture
+frame frame
+=
+= bone frame anim texture texture 1.0
+material bone
+anim vertex 0.500000 1.0
+-1
+material 0.500000 bone -1 0.500000 -1
+1.0 vertex frame
+1.0 frame 1.0
+texture 0.500000 vertex -1
+1.0 texture
+= 0.500000 0.500000 frame frame 0.500000
+=
+anim
+frame anim vertex -1 =
+0.500000 material -1 0.500000 texture
+= texture 1.0 anim = 0.500000
+vertex
+vertex anim frame frame anim material texture
+texture
+1.0 -1 anim frame
+anim bone
+= -1
+material
+1.0 bone
+-1 material 0.500000 bone
+1.0 1.0 material
+material texture frame 1.0 bone 0.500000 bone 1.0 0.500000 = texture texture -1 frame vertex material vertex anim anim 1.0 -1 frame -1 0.500000 =
+vertex v
\ No newline at end of file
@@ -0,0 +1,10 @@
+-1 vertex vertex -1
+texture bone
+1.0 texture -1 -1 material 1.0 anim vertex vertex bone vertex material frame =
+1.0
+= vertex texture
+1.0 anim = =
+material 1.0
+= 1.0 bone material
+0.500000
+texture
\ No newline at end of file
@@ -0,0 +1,79 @@
+bone
+= -1 0.500000 1.0 anim
+vertex anim
+1.0 vertex anim 0.500000
+0.500000 material vertex anim texture 0.500000
+anim 0.500000
+bone vertex 1.0 anim 0.500000 -1
+material -1 anim
+-1 -1 =
+= = texture = bone
+= anim -1 =
+texture
+anim 1.0
+-1 texture 0.500000 frame -1 frame
+texture
+anim 1.0 0.500000 0.500000 0.500000
+-1 texture vertex material
+= material 0.500000 -1 -1 texture
+frame 0.500000 1.0
+anim material -1 frame anim = = vertex = texture frame texture
+1.0 vertex 1.0 vertex
+vertex
+texture texture = material -1 1.0
+frame = vertex 1.0 1.0 0.500000
+-1 = material material vertex 1.0
+anim -1
+vertex material 1.0 -1
+-1 =
+frame frame vertex
+0.500000 material frame bone -1 frame 0.500000 0.500000
+texture anim
+material bone material anim
+= material material frame frame = 0.500000 frame vertex
+1.0 -1 =
+=
+1.0 -1 -1
+texture material
+texture
+0.500000 material anim
+vertex
+vertex material vertex =
+1.0 = bone 1.0 material anim
+vertex material material = frame
+0.500000
+0.500000 vertex
+vertex -1 bone texture
+-1 -1 -1 -1
+frame
+1.0 frame frame bone 1.0 1.0 frame = 1.0 frame 1.0 anim =
+texture -1
+bone texture material frame 0.500000
+=
+material 1.0 material bone 0.500000
+-1
+-1 material
+= 0.500000 1.0 frame frame = -1 = =
+frame anim
+material bone anim = vertex = 0.500000 texture anim texture 0.500000 0.500000 texture
+texture material -1 material 1.0 texture
+frame
+=
+bone = bone = frame -1
+vertex vertex vertex 0.500000
+-1
+material 1.0 = vertex vertex anim
+vertex
+1.0 anim
+material 1.0 -1 1.0 material frame anim anim 1.0 texture
+frame
+bone 0.500000 -1
+-1 1.0
+anim 1.0
+texture material frame
+1.0 texture bone
+-1 frame 1.0 0.500000 anim 1.0 frame
+texture
+frame -1 1.0 texture
+material bone vertex
+vertex vertex 0.500000 texture bone texture frame 0.500000 anim anim 0.500000 tex
\ No newline at end of file
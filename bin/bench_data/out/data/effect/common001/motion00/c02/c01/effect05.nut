@@ -0,0 +1,293 @@
+material
+texture 0.500000 vertex
+1.0 anim
+-1 vertex
+vertex anim vertex
+bone
+0.500000 1.0 =
+1.0
+1.0
+material 0.500000 1.0 bone frame material texture vertex
+anim material material
+anim
+0.500000 bone bone -1 frame 0.500000 -1
+material
+1.0 material =
+bone
+material
+0.500000 bone 0.500000 bone anim vertex -1 texture anim
+frame 0.500000
+-1 0.500000 vertex
+vertex 1.0 anim anim bone = bone bone frame anim
+material 1.0 -1 vertex bone -1
+1.0 0.500000
+0.500000 frame anim texture material material
+bone anim = frame
+= material = texture 0.500000 = 1.0 material = anim
+-1 material 0.500000
+texture
+frame
+vertex bone texture material
+material -1
+bone anim
+frame 1.0 1.0
+material 0.500000 1.0 material -1 0.500000
+-1 anim 0.500000 frame
+texture frame 1.0
+anim
+texture
+anim =
+bone texture =
+1.0 = material texture
+frame anim
+anim
+material =
+anim
+bone vertex 1.0
+0.500000
+bone texture
+texture material -1 = vertex =
+0.500000 0.500000
+-1 frame anim 0.500000 vertex
+bone
+-1 0.500000 material 1.0 -1 vertex
+vertex
+=
+0.500000 = 1.0 bone
+0.500000 -1
+anim = -1
+frame anim
+material
+0.500000 vertex -1 frame 1.0 0.500000
+bone
+1.0
+1.0
+material bone 0.500000 1.0 bone 0.500000
+anim
+vertex anim 1.0 texture vertex
+vertex
+= 1.0 anim 0.500000 texture
+=
+frame texture
+=
+-1 bone 1.0 1.0 anim anim
+= anim
+= bone frame 1.0 = material = 0.500000 bone 1.0 anim 1.0 vertex vertex 1.0 anim
+frame
+frame vertex vertex
+-1
+1.0 anim 1.0 frame vertex =
+vertex anim 0.500000 anim anim
+material =
+=
+frame material
+frame anim
+0.500000
+0.500000 =
+vertex 0.500000 vertex anim frame =
+anim = anim material -1 vertex
+texture
+texture bone material = frame bone = frame
+frame texture anim texture 0.500000
+texture 1.0 1.0 = frame = 0.500000 material vertex vertex vertex
+1.0 bone anim texture -1
+texture
+material
+0.500000 material anim = =
+0.500000 bone
+texture material
+material 1.0
+material texture vertex bone bone anim -1 0.500000 texture bone
+frame frame vertex -1
+vertex =
+vertex frame
+1.0
+= material = texture
+-1 anim
+-1 bone bone vertex
+0.500000 vertex frame 0.500000 -1 anim
+texture anim anim 1.0 anim 0.500000
+0.500000
+anim
+vertex = texture
+-1 anim 1.0 = texture frame bone 1.0 vertex bone
+-1 frame
+1.0 texture material 1.0 bone material -1 =
+texture bone 1.0
+0.500000 bone
+bone vertex anim =
+-1
+anim frame
+vertex -1
+material 0.500000 texture anim = 1.0 anim texture texture bone
+1.0 vertex material
+material material
+material material material -1 material 0.500000 1.0 -1 frame 0.500000 material
+1.0 0.500000 vertex
+bone 0.500000 -1 frame
+=
+vertex vertex
+1.0
+= vertex 1.0 1.0 0.500000
+1.0
+texture bone 1.0 texture = anim
+-1 = anim material 0.500000 0.500000 0.500000
+vertex
+vertex 0.500000 vertex texture frame 1.0
+1.0
+frame 1.0
+0.500000 1.0
+texture
+material
+=
+frame -1
+vertex =
+vertex anim vertex
+vertex texture vertex = texture anim 1.0 = anim 1.0 bone frame =
+material =
+vertex material 0.500000 1.0 material vertex
+bone
+-1 1.0
+material anim
+0.500000 -1 = texture -1 anim
+texture -1 texture material texture
+material
+0.500000 vertex 1.0 frame anim frame frame material 1.0
+bone
+bone 0.500000 anim = anim anim texture -1
+bone
+material
+vertex -1 frame material frame
+-1 -1 0.500000
+vertex anim 0.500000
+0.500000
+material = 1.0 bone -1 1.0
+texture 1.0
+material 0.500000 -1 1.0 anim -1 material
+1.0
+1.0
+= anim =
+anim frame vertex texture anim vertex
+0.500000 bone = -1 material texture
+frame bone vertex vertex bone vertex frame frame 1.0
+texture 0.500000 anim frame -1 = frame 0.500000 anim bone 0.500000 anim
+vertex -1
+bone anim = frame
+frame texture material
+frame
+frame vertex
+frame 1.0 material bone frame 1.0 frame =
+1.0 bone -1 frame
+frame material
+frame =
+=
+1.0 frame = = texture
+1.0 -1 0.500000 frame -1 texture frame 0.500000
+anim vertex = anim 0.500000
+texture texture
+-1 vertex frame = frame
+texture vertex 0.500000 1.0 material
+-1 vertex material
+frame
+material bone frame frame 0.500000 bone 1.0 bone = -1 anim -1 anim 1.0 bone texture bone 0.500000 -1 vertex 1.0 anim vertex vertex frame
+texture frame 0.500000
+vertex
+-1 vertex frame
+anim = -1 vertex vertex anim
+bone -1 anim
+texture = bone vertex 1.0
+= material
+= bone anim
+= material frame material vertex
+bone frame
+vertex -1 -1
+texture -1
+frame
+1.0 material frame 1.0 bone anim -1 -1
+frame
+material material 0.500000
+-1 =
+vertex material material -1 texture frame
+= vertex 0.500000 anim
+anim frame material = frame -1
+-1
+vertex frame material texture
+-1 vertex
+anim anim texture bone 0.500000 bone 0.500000
+bone texture -1
+frame
+anim
+-1 0.500000 anim vertex bone anim frame material 1.0 0.500000 bone
+vertex material -1 material 1.0 bone
+vertex
+bone
+= texture = bone
+1.0
+material vertex vertex texture material bone vertex
+bone material frame
+-1 anim 0.500000 texture vertex
+anim
+frame bone
+texture material 0.500000 material vertex texture
+anim vertex = texture = vertex
+anim 0.500000 1.0 vertex 0.500000 bone material 1.0 -1 frame material bone vertex 0.500000 bone
+bone frame bone 1.0
+vertex texture
+material 1.0 anim
+0.500000 material vertex = 0.500000 0.500000
+texture
+0.500000
+vertex
+-1 0.500000 frame
+frame
+frame anim anim
+frame texture frame
+anim
+vertex material -1
+anim anim 0.500000 =
+texture 1.0 anim frame bone
+texture texture
+0.500000 vertex texture
+bone
+anim frame
+= = bone
+anim anim frame vertex anim 0.500000 vertex 1.0 = = material texture
+vertex
+anim 1.0 bone = frame
+material bone vertex bone 1.0 0.500000 frame =
+texture -1 material anim
+1.0 1.0 vertex bone = texture bone material -1 anim anim frame bone frame vertex anim material 0.500000 bone texture
+texture
+material 0.500000 bone
+bone
+vertex
+-1 0.500000 0.500000 =
+= texture 0.500000 anim -1 0.500000 material
+-1 =
+material 1.0 anim frame
+= -1 texture bone -1 0.500000 frame = anim 0.500000
+-1 1.0 0.500000
+texture vertex
+0.500000 = bone = = material material 1.0 0.500000
+texture anim = anim -1 material frame
+1.0 bone -1 0.500000 texture texture bone bone
+0.500000 0.500000 bone texture -1 anim texture = bone
+anim frame bone
+-1 bone texture 1.0
+vertex = material material texture
+0.500000 texture vertex
+0.500000
+texture texture frame
+vertex -1 0.500000 0.500000 bone bone 0.500000
+frame
+-1 anim vertex vertex frame anim
+material texture 1.0 material texture texture bone material texture
+=
+bone = material bone
+1.0 frame
+material bone frame texture
+-1 vertex
+=
+= 1.0 anim 0.500000 0.500000 0.500000
+= -1 material 1.0 material texture vertex bone 0.500000 frame = = bone material -1 -1 -1 frame -1 = 0.500000 material
+0.500000 anim bone frame anim frame frame = vertex 1.0 -1 vertex bo
\ No newline at end of file
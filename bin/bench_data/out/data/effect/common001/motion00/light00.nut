@@ -0,0 +1,62 @@
+anim 1.0 0.500000
+frame anim 0.500000 vertex
+1.0
+frame bone = =
+1.0 frame
+texture 1.0 1.0 frame anim
+vertex texture = anim 0.500000 material anim texture anim vertex 0.500000 anim texture
+frame
+-1 -1 = material frame = texture = vertex = -1 bone bone texture anim material anim 0.500000 material = bone frame 1.0 frame 1.0 =
+vertex
+frame frame = vertex
+-1 vertex
+-1 bone
+frame -1 frame
+0.500000 1.0 vertex bone anim
+= texture vertex = = frame 1.0 frame 1.0 1.0 1.0 1.0 = -1 frame = = texture = vertex
+bone texture -1 texture frame bone anim
+material
+1.0 0.500000 bone bone bone
+0.500000 frame anim bone 1.0 texture 0.500000
+bone = texture
+anim 0.500000 texture =
+texture bone
+texture -1 anim texture texture bone bone
+=
+bone 1.0 1.0 1.0 bone frame
+= bone
+frame bone vertex
+anim texture
+0.500000
+texture 1.0 -1 0.500000
+0.500000 0.500000 vertex frame
+1.0 0.500000 anim bone 0.500000 vertex texture material
+bone anim bone anim
+= material -1 vertex = -1 texture 1.0 material =
+texture
+texture
+vertex anim anim -1 frame 0.500000 -1 1.0 frame anim frame 0.500000 bone
+vertex = -1 material = material -1 1.0 texture texture vertex
+anim frame
+0.500000
+bone texture frame 1.0 anim
+1.0 texture 1.0 -1 anim
+0.500000 material material frame
+frame = vertex
+0.500000
+material texture -1 = frame 1.0 0.500000 0.500000
+0.500000 bone texture vertex -1 anim material material frame frame frame -1 anim vertex
+0.500000 bone vertex vertex material 1.0 0.500000 1.0 1.0 material 1.0 frame
+material
+1.0
+vertex -1 texture bone
+texture bone
+anim -1 1.0
+anim =
+frame anim vertex material 1.0 0.500000
+material
+frame 0.500000 -1 -1 = vertex
+texture 0.500000 = bone 1.0 1.0 1.0
+anim texture bone 1.0 0.500000
+anim 0.500000
+frame 1.0 vertex = anim 1.0 frame -1
\ No newline at end of file
@@ -0,0 +1,9 @@
+anim
+frame material
+bone frame
+= material anim
+anim 1.0
+material -1 1.0 0.500000
+vertex
+vertex texture vertex
+material frame f
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000
+vertex
+0.500000 frame frame
+0.500000 vertex -1 texture 0.500000
+0.500000 1.0 -
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex 1.0 texture texture texture bone = anim bone
+1.0 0.500000 frame
+verte
\ No newline at end of file
@@ -0,0 +1,202 @@
+material
+vertex
+anim bone = bone
+-1 material -1 texture
+material
+-1 -1 anim 1.0 = material texture
+= material vertex
+anim -1 texture vertex texture 1.0 =
+= vertex 1.0 bone 0.500000 0.500000 0.500000 = anim -1
+0.500000 = -1
+1.0 frame -1
+-1
+texture -1 vertex bone 0.500000 1.0 0.500000 -1
+1.0 texture vertex 0.500000 vertex anim =
+0.500000
+anim bone
+material anim 1.0 = anim =
+1.0 -1 material texture
+texture bone material -1
+anim frame
+vertex 1.0
+-1 vertex
+vertex
+0.500000 vertex vertex frame bone
+0.500000 1.0 bone
+vertex texture = anim
+anim material anim
+frame -1 frame
+1.0 0.500000
+texture material 1.0
+material vertex bone =
+bone
+1.0 vertex -1 1.0 texture vertex -1 anim 0.500000 -1
+material material texture
+0.500000 frame texture anim bone vertex 1.0 frame texture material 1.0 vertex
+vertex texture material -1
+-1 frame anim 1.0 -1 = -1 frame material
+material anim 0.500000 material
+anim anim -1 anim material
+= -1 vertex texture frame
+-1 texture 0.500000 texture
+bone anim texture 1.0 =
+0.500000 anim -1
+material frame
+1.0 -1 bone material vertex -1
+bone texture -1 frame 1.0 -1
+texture
+= anim anim vertex -1
+bone
+= texture frame 0.500000 frame bone vertex texture bone vertex vertex vertex 1.0 1.0 material
+-1
+frame texture anim texture frame texture material
+frame = bone frame bone bone bone
+1.0 material texture frame -1 0.500000
+anim material
+= vertex
+bone
+anim anim
+anim anim bone
+bone
+1.0 0.500000 = = anim
+-1
+1.0 vertex material frame vertex
+texture vertex
+frame 1.0
+bone vertex = frame 1.0 anim texture vertex bone
+= texture frame = = texture
+0.500000 -1 anim
+material 1.0 vertex
+texture 1.0 =
+material vertex vertex bone vertex 1.0 frame
+0.500000 material
+bone texture
+texture = 1.0 vertex -1 =
+= bone 0.500000 0.500000 texture = vertex texture
+frame
+anim material texture vertex frame material
+bone anim bone anim texture
+= texture = material
+1.0
+bone
+bone = 1.0
+= frame vertex material
+= material material 1.0 1.0 = bone material texture frame 0.500000 = = material
+1.0 vertex material
+frame frame vertex texture 1.0 1.0 -1 = -1 = frame bone
+-1 vertex
+anim = material = 0.500000 material anim
+vertex vertex = vertex =
+1.0
+texture 1.0 0.500000 material
+vertex
+1.0 material
+material
+material frame
+anim
+= -1 frame
+texture 0.500000
+texture
+-1 = anim texture frame anim anim = bone 0.500000 texture vertex -1 bone texture anim anim frame -1
+vertex texture anim bone anim 1.0 bone anim = 1.0 frame bone vertex 1.0 bone
+material anim material anim 0.500000 = frame
+material anim -1 material
+bone 0.500000 vertex bone vertex texture frame vertex
+-1
+vertex -1 1.0
+-1 anim bone material = frame =
+anim material -1
+0.500000 texture vertex vertex anim texture frame frame
+bone texture anim 1.0 frame 0.500000 0.500000 = material -1 0.500000 bone vertex =
+= anim =
+vertex 0.500000
+bone bone frame = material frame bone
+texture 1.0
+vertex 1.0 0.500000 -1 = frame material
+bone
+bone -1 bone
+= material 1.0 1.0 anim material = frame anim texture frame vertex frame
+0.500000 bone
+material -1 bone vertex frame 1.0
+material texture
+bone = frame vertex 1.0
+= vertex 1.0 material
+vertex = = 0.500000
+1.0 0.500000 vertex
+bone = 1.0 frame material -1 = 1.0 0.500000 1.0 0.500000 -1 vertex vertex
+0.500000
+bone bone
+-1
+frame 1.0 vertex = =
+material -1 anim 1.0 bone
+material = bone
+material -1
+1.0
+material
+1.0 texture =
+-1
+bone vertex
+vertex -1 1.0 material
+0.500000
+bone 1.0 bone = anim
+= anim bone texture = material material = 0.500000 anim
+= 1.0 bone -1 anim
+material material anim
+bone texture frame = 1.0 = texture = frame material -1 = anim
+anim frame vertex
+-1 0.500000
+-1 =
+bone 0.500000 texture -1 material frame 1.0 frame bone
+-1 -1 frame -1 frame
+= material
+anim
+vertex -1 1.0 material bone material 1.0
+= 0.500000 vertex
+-1 material texture 0.500000
+1.0 = anim anim frame texture bone 0.500000 = 1.0 -1 0.500000 -1
+= -1 -1
+frame
+material anim
+vertex -1 1.0 1.0
+0.500000
+texture anim 1.0 material texture texture anim 0.500000
+0.500000 0.500000 anim material = frame frame anim
+frame -1 = frame = vertex vertex anim -1
+0.500000
+1.0
+1.0 -1
+-1 0.500000 = 0.500000 anim 1.0
+material = = material
+frame
+1.0 -1 1.0 bone frame 1.0 frame material vertex texture texture bone
+material vertex frame frame bone -1 texture vertex
+vertex
+0.500000 -1 bone anim
+= = texture
+bone vertex
+-1 anim -1 -1 material 1.0
+frame texture vertex material material material bone frame 1.0 material 1.0 = bone -1 =
+anim frame frame texture
+anim 1.0
+0.500000 0.500000 1.0 = material
+frame material 1.0 vertex bone -1
+frame frame -1
+-1 1.0 = 0.500000
+texture
+vertex material
+texture bone frame 0.500000 frame -1 -1 0.500000
+material
+frame 0.500000
+= anim -1 texture vertex 0.500000
+0.500000 texture -1 texture texture -1
+0.500000
+material frame
+vertex 0.500000
+anim 0.500000 anim
+anim material anim
+= anim
+material frame frame
+= texture
+texture
+1.0
+verte
\ No newline at end of file
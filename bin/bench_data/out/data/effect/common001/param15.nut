@@ -0,0 +1,8 @@
+vertex texture texture texture
+bone bone
+vertex
+0.500000 frame
+0.500000 0.500000
+1.0 = bone = -1 vertex 0.500000 1.0 1.0 vertex
+-1
+texture vertex anim 0.
\ No newline at end of file
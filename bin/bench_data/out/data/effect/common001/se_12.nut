@@ -0,0 +1,270 @@
+anim 0.500000 1.0
+texture -1 vertex material texture
+texture vertex = anim
+1.0 frame 0.500000 material = anim frame frame
+bone
+texture 1.0
+0.500000 1.0 material
+1.0 bone 0.500000 bone bone -1 1.0 anim -1 frame bone material bone -1 anim material frame vertex anim 1.0 1.0 frame
+texture
+-1
+texture texture texture anim bone
+bone frame bone anim 0.500000 0.500000 =
+= frame frame frame anim
+0.500000
+texture anim 1.0 1.0 -1 0.500000 texture 1.0
+0.500000 texture
+=
+frame 0.500000
+1.0
+texture
+1.0 = anim 0.500000 0.500000 bone vertex bone
+=
+0.500000 material = anim vertex texture material material frame texture
+-1 0.500000 -1
+=
+bone
+0.500000 1.0
+texture
+vertex anim
+1.0 material vertex
+material vertex texture = vertex bone
+texture -1 0.500000
+frame =
+1.0 anim
+anim bone
+material anim bone 1.0 bone
+texture bone
+material
+frame 0.500000
+texture texture anim vertex
+bone frame 1.0
+frame texture 1.0 = 0.500000 0.500000 frame vertex texture -1 1.0
+1.0
+1.0
+-1
+anim
+frame texture bone
+material
+1.0 vertex anim material frame -1 material vertex
+1.0 anim 1.0 frame 0.500000 -1 0.500000 frame material 0.500000 -1 bone 1.0 material 0.500000 -1 frame texture
+= -1 frame texture vertex bone frame
+= vertex 0.500000 bone anim
+frame 1.0 texture
+texture 1.0 bone = -1
+anim 0.500000
+bone = material =
+bone 0.500000 bone 0.500000 0.500000 -1 bone frame vertex material 1.0 frame
+material
+texture anim texture vertex = vertex frame 0.500000
+frame 0.500000 anim 1.0 0.500000
+0.500000 material bone = frame -1 frame 1.0
+-1
+texture vertex 1.0 material
+0.500000 0.500000
+vertex vertex =
+vertex
+vertex frame anim bone
+1.0 -1 0.500000
+= 0.500000
+0.500000 texture
+=
+vertex
+anim material bone
+material anim 0.500000
+0.500000 0.500000 bone -1 bone bone
+vertex
+= 1.0 bone texture
+bone bone
+frame material
+vertex
+1.0 material
+anim frame texture bone
+texture -1
+0.500000
+bone
+0.500000
+= anim = frame = 1.0
+= = vertex material = frame
+= vertex anim bone texture 1.0 bone texture 1.0 anim frame =
+bone
+material
+-1 material bone material frame
+anim texture
+= -1 material
+bone bone frame
+= texture bone
+material 1.0 material material anim bone texture texture
+1.0 material vertex anim -1 frame bone anim bone 0.500000 0.500000 anim
+material -1 bone frame
+material
+anim vertex 0.500000 0.500000 bone vertex anim material 1.0 frame = 0.500000
+= = material bone texture
+frame 0.500000 = 0.500000 -1 texture 1.0 material
+vertex vertex
+= frame anim bone = vertex material = frame
+vertex material 0.500000 material
+1.0 vertex
+material frame
+0.500000 -1 anim = bone
+1.0 vertex 1.0 0.500000 texture anim
+anim material 0.500000
+-1 frame texture frame 1.0 material bone vertex -1 frame
+bone material vertex anim anim
+-1 frame frame bone anim texture anim vertex -1 texture bone anim =
+0.500000 vertex vertex bone
+0.500000
+texture
+vertex 1.0 texture 1.0 vertex vertex
+texture
+= bone -1
+=
+texture anim = =
+-1 -1 vertex
+= anim
+texture 1.0
+texture = 0.500000
+-1 1.0 material material
+material anim
+frame
+anim texture -1 texture frame
+vertex =
+material
+texture -1 = vertex frame -1 = frame vertex -1
+bone anim material 1.0
+1.0 = 1.0
+0.500000 = material texture -1 = 1.0
+-1 frame
+material
+anim anim vertex frame 1.0 = vertex 1.0 anim material bone
+material bone material = 0.500000 = -1 vertex =
+vertex 0.500000 frame
+bone anim 0.500000 -1
+bone
+-1
+=
+material
+texture = bone bone material
+material
+1.0
+anim -1 frame bone 0.500000
+texture
+vertex
+= bone frame material -1 bone = bone 1.0
+frame
+frame 0.500000 bone vertex texture
+= bone -1 material frame
+-1 texture
+frame
+anim = =
+1.0
+frame bone bone 0.500000 frame vertex 0.500000 anim
+anim
+1.0 material -1 anim
+anim
+anim bone bone = 0.500000
+bone 1.0
+0.500000 0.500000 anim 0.500000 0.500000 anim
+0.500000 1.0 = texture 0.500000 1.0
+1.0 =
+anim
+0.500000
+texture = = texture -1
+bone
+1.0
+texture -1 vertex bone bone frame
+bone 1.0
+material
+bone anim bone bone bone vertex vertex texture
+bone vertex frame
+-1 anim 0.500000
+0.500000 1.0
+frame 0.500000 =
+anim bone
+frame -1
+-1 frame bone vertex
+vertex anim
+= vertex
+texture material frame -1 = = texture 0.500000 -1 0.500000 0.500000 texture vertex
+bone bone anim vertex -1
+0.500000
+=
+bone material 1.0 frame
+material = 1.0 frame anim material = bone -1
+material
+anim
+-1 texture texture vertex frame
+frame = bone bone
+texture
+=
+= texture material
+material = = 0.500000 anim =
+bone = =
+texture material
+1.0 bone
+material
+bone
+material bone
+vertex = frame vertex bone vertex frame
+frame 1.0 0.500000 texture vertex material frame 0.500000
+0.500000 anim
+= -1 texture anim material bone anim = anim -1 0.500000 vertex
+-1 anim = frame frame = material
+anim anim anim
+=
+0.500000
+texture anim
+anim bone 0.500000 material anim
+bone 1.0 0.500000 -1 frame material anim
+frame texture 0.500000 material bone
+material vertex anim
+0.500000
+= texture 0.500000
+= 0.500000 vertex
+= texture
+material anim
+1.0 anim anim
+material
+anim material material vertex anim bone texture
+texture texture
+0.500000
+-1 =
+material anim vertex texture vertex frame 0.500000 -1 0.500000 vertex bone anim vertex
+frame
+texture
+vertex
+frame -1 1.0
+material -1 = 0.500000 = anim frame frame
+texture material
+0.500000 frame
+material
+-1 -1 texture texture anim frame
+-1
+anim
+material texture
+-1
+texture material -1 0.500000 bone 1.0 -1
+frame bone = -1 bone -1 frame vertex 0.500000 texture
+-1
+0.500000 -1 1.0
+anim frame vertex bone
+texture
+texture -1
+0.500000 bone anim
+= anim vertex = 1.0 material texture texture frame 1.0 bone = frame anim
+material texture texture 1.0 vertex frame = anim 1.0 frame
+0.500000 vertex material anim
+texture bone vertex 0.500000 bone bone
+-1 frame
+frame
+0.500000
+bone -1
+bone -1 0.500000
+bone texture bone = anim texture -1 texture material
+material = bone anim
+vertex -1 bone vertex -1
+-1
+vertex
+frame 1.0 0.500000 texture =
+texture anim vertex 0.500000 anim vertex frame
+bone
\ No newline at end of file
@@ -0,0 +1,243 @@
+material material
+bone frame texture
+1.0 material vertex
+texture vertex frame
+texture
+vertex 0.500000 frame 0.500000 0.500000
+=
+0.500000
+frame
+texture -1 =
+material
+texture bone 0.500000 anim -1
+= 1.0 anim 1.0 material texture frame 0.500000 1.0 vertex frame material
+1.0
+texture =
+texture
+anim frame frame -1 frame =
+anim =
+material 0.500000
+texture bone -1 0.500000 texture = = -1 frame anim material texture 1.0 frame 0.500000 bone 0.500000 -1 = material
+vertex vertex = vertex 1.0
+anim anim material bone 1.0 1.0 -1 vertex -1 bone frame = anim bone vertex anim material = 0.500000
+texture material
+0.500000
+anim
+texture 0.500000 = material 0.500000 bone
+=
+material 0.500000 -1
+1.0
+material -1 bone texture = -1 texture 1.0 anim -1 1.0 frame -1 1.0 vertex 0.500000 vertex bone -1 frame anim anim -1 texture
+anim bone bone
+-1 frame
+1.0
+material 1.0
+0.500000 bone material vertex -1 frame
+0.500000 -1 material -1 vertex anim frame material -1 frame -1 bone material anim -1 bone 1.0 0.500000 1.0 bone 1.0
+-1 1.0 texture
+-1 anim material texture texture frame
+1.0 anim material bone anim
+anim 0.500000
+0.500000
+bone
+frame bone frame
+texture = vertex 0.500000 1.0 vertex = frame
+frame =
+0.500000 material 1.0
+vertex
+vertex -1 material -1 texture material bone = anim
+0.500000 bone material
+1.0 frame bone 0.500000
+texture frame
+texture bone
+= 0.500000 1.0
+frame bone 1.0 bone anim 0.500000
+frame vertex -1 vertex material =
+vertex 0.500000 vertex material frame
+vertex material texture
+frame
+1.0 texture
+anim vertex vertex bone bone vertex 0.500000 frame texture bone vertex material -1 texture
+0.500000 texture
+-1
+texture material material 1.0 bone texture
+material texture 1.0 vertex
+1.0 texture
+-1
+0.500000 bone = texture frame =
+vertex vertex
+anim
+texture
+-1
+bone
+0.500000
+vertex material -1 frame
+vertex = texture bone frame
+material frame material material frame 0.500000 vertex
+material 1.0 material = =
+material
+bone 0.500000 frame
+anim
+= = vertex vertex 0.500000 = vertex bone
+frame frame vertex
+=
+material vertex material texture
+vertex material
+0.500000 texture
+frame
+-1 0.500000 = 0.500000 bone = material -1 frame -1 frame
+anim texture 0.500000 bone bone 1.0 frame
+bone anim anim = texture frame
+material material = frame anim 1.0 = 0.500000
+texture 1.0 frame 0.500000 texture
+bone anim vertex
+0.500000 frame texture -1 vertex material bone
+0.500000 bone texture frame
+= texture texture vertex -1 = texture
+= anim frame texture 1.0
+= frame
+= vertex bone
+= vertex
+-1 1.0 material bone anim texture = material texture =
+1.0 frame
+=
+texture 0.500000 vertex vertex frame anim 0.500000
+anim -1
+texture texture anim material texture bone
+bone texture -1 material
+0.500000 0.500000 texture frame
+0.500000 bone vertex texture
+frame 0.500000
+texture 0.500000 anim material
+= = vertex 0.500000
+= bone bone = 0.500000 texture
+frame 0.500000 -1
+0.500000 texture -1 anim texture -1 anim 1.0 -1
+-1 =
+vertex bone vertex = texture = bone bone 0.500000 texture
+0.500000
+vertex material material bone 0.500000
+= 0.500000 -1 material texture frame
+1.0 -1 texture 1.0
+anim frame anim vertex 0.500000 frame
+vertex anim material -1 bone
+bone 1.0 frame
+material
+1.0
+bone
+vertex bone material bone anim
+vertex -1 0.500000
+vertex vertex
+texture 0.500000 frame
+-1 frame anim vertex texture frame = -1 vertex
+texture texture texture material =
+=
+vertex = anim
+material bone
+vertex material bone
+-1 vertex material
+anim frame vertex 1.0 0.500000 frame texture
+bone anim
+vertex vertex 0.500000 = frame bone = texture frame
+frame = texture texture 1.0 texture anim frame -1
+anim
+material bone -1
+1.0 0.500000 1.0
+1.0 -1 texture bone bone bone -1 bone vertex frame
+1.0 1.0 material 0.500000
+texture
+0.500000 material anim bone
+bone
+vertex 0.500000 material material 1.0 -1 = = texture bone -1 frame bone bone
+bone
+texture
+anim
+= material vertex -1
+-1 anim anim
+-1 texture frame
+vertex material material frame frame 1.0 vertex texture 0.500000
+0.500000
+material texture
+-1
+anim vertex
+0.500000 material 1.0
+anim vertex
+material 1.0 frame
+material 1.0
+bone bone texture 0.500000 bone 0.500000 anim bone anim frame
+bone 1.0 material =
+texture texture
+= -1 -1 anim
+1.0 texture texture bone vertex
+material
+frame bone
+anim
+frame
+material material anim -1 anim = vertex = =
+1.0 frame = vertex texture texture 0.500000 vertex frame anim
+1.0 vertex
+0.500000 = bone 0.500000 bone vertex
+material -1
+= vertex anim 0.500000
+bone vertex -1 = material -1
+vertex -1 = anim frame bone frame
+frame material
+anim
+bone bone
+material frame frame = 1.0 1.0 -1 vertex = =
+material frame = frame -1 = = anim
+anim 1.0 1.0 -1 material 0.500000 0.500000 1.0 -1 anim =
+0.500000
+bone
+0.500000 bone frame -1 1.0 -1
+vertex 0.500000 vertex 0.500000
+material material
+texture frame
+vertex -1 texture bone frame 1.0
+anim 1.0 bone frame vertex 1.0 frame anim
+material
+0.500000
+= texture anim
+frame = 0.500000 1.0 texture vertex anim 1.0 vertex -1 material bone = 1.0
+texture -1 anim material
+frame texture bone bone vertex anim
+anim material
+anim anim anim material frame vertex anim
+= 0.500000 0.500000 vertex frame anim 1.0
+material 1.0 texture
+= texture vertex material anim
+texture texture
+frame frame anim anim bone
+frame 1.0 = texture frame
+0.500000 anim
+vertex material anim
+-1 bone vertex
+material = frame frame vertex bone
+frame 0.500000
+material material -1 vertex -1 material 0.500000 1.0
+vertex = 0.500000 = material =
+frame texture frame 1.0 bone 1.0 vertex vertex -1 0.500000 0.500000 bone
+0.500000 material texture vertex frame -1
+0.500000
+texture material 0.500000 bone 1.0 bone 0.500000 1.0 -1
+1.0 anim
+vertex
+-1 anim frame vertex material = texture vertex frame material
+vertex bone texture bone
+anim 0.500000 texture 1.0
+0.500000 texture 0.500000 0.500000 1.0 texture vertex material vertex anim bone bone -1 0.500000
+frame texture material texture 0.500000 frame anim 1.0 frame
+anim vertex 0.500000 frame material vertex 1.0 texture
+material -1
+-1 texture -1 vertex -1 1.0 material material material
+=
+anim frame bone
+material anim 0.500000 frame
+frame 0.500000 -1 -1 0.500000 frame 0.500000
+1.0 1.0
+bone = = anim
+bone =
+bone = vertex bone vertex
+vertex
+frame -1 frame texture = vertex = anim 1.0
+vert
\ No newline at end of file
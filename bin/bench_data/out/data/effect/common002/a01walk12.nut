@@ -0,0 +1,13 @@
+material
+frame bone -1
+= -1 texture
+bone 0.500000 material
+frame 1.0 0.500000 = vertex = -1 -1 bone
+frame
+material
+vertex
+-1 texture 1.0
+material =
+bone
+=
+bone bone m
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone =
+anim 0.500000 0.500000
+frame -1
+frame =
+anim =
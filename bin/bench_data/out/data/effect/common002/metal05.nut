@@ -0,0 +1,2 @@
+=
+vertex 1.0 frame texture frame = -1 material 0.500000 material anim = anim 
\ No newline at end of file
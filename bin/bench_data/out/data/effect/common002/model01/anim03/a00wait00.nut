@@ -0,0 +1,39 @@
+bone
+bone
+bone
+material material material frame anim vertex = frame anim 0.500000 1.0
+0.500000
+0.500000 vertex 1.0 0.500000
+1.0 texture -1 anim bone =
+texture 0.500000 1.0
+vertex vertex anim anim
+-1 frame 1.0 1.0 0.500000 1.0
+vertex bone material material
+vertex vertex frame -1 anim texture = vertex 1.0 vertex
+vertex bone material 1.0 anim texture material 0.500000 bone texture vertex
+bone 0.500000
+1.0 -1 = frame -1 = bone
+-1 -1
+material frame = anim texture =
+= bone 1.0 bone -1 texture -1 texture frame
+anim texture 1.0 -1
+texture vertex vertex vertex bone
+material vertex
+bone vertex
+-1 bone -1 texture texture = 0.500000 bone =
+1.0 bone
+-1 1.0 -1 texture anim = frame
+material -1 frame
+frame vertex
+= 0.500000 vertex vertex =
+0.500000 material
+0.500000 vertex bone -1
+1.0 vertex vertex
+vertex frame = 0.500000 vertex vertex bone -1 anim frame vertex 0.500000 1.0
+frame
+bone
+texture -1
+anim -1 -1 -1
+material -1 0.500000 1.0 bone
+0.500000
+frame -1 
\ No newline at end of file
@@ -0,0 +1 @@
+bone texture 0.500000 -1 material
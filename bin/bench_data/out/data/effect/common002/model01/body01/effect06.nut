@@ -0,0 +1,309 @@
+vertex frame 0.500000 -1
+0.500000 anim frame -1 anim frame anim material frame texture vertex -1 vertex -1 material
+anim material -1 0.500000 vertex
+frame 1.0 material
+anim
+0.500000 bone 0.500000
+0.500000
+material bone
+1.0 -1 1.0 anim
+vertex
+0.500000 -1 material frame
+-1 material = 1.0
+-1 = 1.0 material material bone
+frame texture frame
+material 1.0 anim
+bone anim vertex 0.500000 -1 bone = vertex bone 0.500000 bone frame
+bone frame
+-1
+1.0 bone vertex frame 1.0 frame
+material bone
+texture anim =
+0.500000 anim
+anim
+material vertex material bone 1.0 frame anim texture 0.500000 material anim material
+texture anim = texture 1.0
+bone
+texture 0.500000
+material vertex
+-1
+= = 1.0 1.0 vertex =
+anim 0.500000 1.0 0.500000 vertex vertex 1.0
+material vertex 1.0
+=
+-1 1.0 bone = frame anim texture
+-1 -1 texture
+-1 = 0.500000 = 1.0 vertex anim -1
+material 1.0
+= -1
+frame material 0.500000
+1.0 bone
+1.0 bone 1.0 bone vertex frame -1
+material vertex vertex 0.500000 texture material bone
+frame bone
+material 1.0 texture anim
+anim = 0.500000 frame
+= frame
+texture
+0.500000
+material texture
+0.500000 -1 -1
+frame =
+1.0
+bone 0.500000 vertex =
+frame anim 1.0
+anim anim texture texture vertex 1.0
+texture
+frame anim frame
+frame = anim
+1.0
+-1 anim anim material
+vertex frame 1.0
+= frame texture frame = frame = 1.0
+-1 0.500000
+material
+1.0 vertex = = 1.0 anim texture anim anim -1
+bone texture 0.500000 material vertex -1 texture texture 1.0
+anim frame bone -1
+bone 0.500000 texture
+-1
+texture
+1.0
+material -1 anim bone bone material material
+anim 1.0
+material 0.500000 vertex vertex bone
+frame bone
+frame frame
+anim vertex bone
+bone vertex anim anim
+texture
+anim =
+texture
+-1 = -1 -1 material vertex material 1.0 material texture anim bone -1 = -1
+frame vertex vertex
+vertex
+frame
+material
+vertex material bone
+-1
+vertex 1.0 -1
+vertex
+frame texture
+1.0 1.0
+1.0 1.0
+bone bone
+bone
+texture
+anim
+frame
+0.500000
+anim 0.500000 frame frame
+texture frame 0.500000 0.500000
+-1 texture
+0.500000 texture vertex bone
+frame
+anim
+bone material
+texture
+= frame
+-1 -1
+1.0 0.500000 0.500000 = material
+1.0
+frame texture = 1.0
+material
+texture texture -1 texture material vertex frame anim
+frame bone
+bone anim material texture texture bone 0.500000
+1.0 1.0 = 1.0 frame bone
+anim
+frame
+0.500000
+frame frame -1 frame
+frame =
+texture material anim texture = texture
+anim = texture = bone
+1.0
+bone anim material = bone anim = 1.0 1.0 vertex -1 1.0 frame
+vertex 0.500000 -1 texture
+= = 0.500000 1.0 texture anim
+frame material
+1.0 vertex
+vertex
+-1 frame 0.500000 -1 vertex frame 1.0 vertex
+bone vertex frame bone bone texture 1.0
+-1 material material 1.0
+frame
+-1 frame
+anim bone
+vertex 1.0 vertex anim -1 bone
+0.500000 bone 0.500000 bone 0.500000 bone material material anim material
+-1 texture
+anim texture = -1 0.500000 1.0 anim 0.500000 anim frame
+bone material frame texture bone -1 0.500000
+0.500000 =
+bone 0.500000 material
+= texture anim bone -1 frame bone
+-1 vertex frame vertex -1
+=
+bone frame -1
+0.500000 1.0 1.0 0.500000
+material 1.0 = -1 1.0
+bone
+frame 1.0 frame 0.500000 vertex 0.500000 -1
+material
+1.0
+1.0 = bone bone -1 material 0.500000 -1 1.0 frame anim
+= bone
+1.0
+= 1.0 material = bone 1.0 -1 bone
+frame material 0.500000
+1.0 -1 frame material 0.500000 -1
+anim 1.0
+frame bone 1.0 frame
+anim
+anim vertex frame
+texture
+= vertex
+texture
+0.500000 material
+1.0 = material material frame texture texture bone texture
+-1
+bone -1 vertex vertex 0.500000 anim bone bone -1 1.0
+vertex -1 anim anim 1.0
+0.500000
+0.500000 anim 1.0 = 1.0 anim material =
+-1 bone
+frame material frame material = vertex anim 0.500000 1.0
+vertex anim
+-1
+anim
+0.500000 anim 1.0
+vertex anim
+0.500000 frame texture 0.500000
+1.0 texture frame frame frame = bone
+frame =
+frame
+material
+= material texture
+anim
+=
+1.0 = material 1.0 bone frame
+anim material
+= bone material vertex
+vertex
+anim frame texture texture
+material
+0.500000 texture material vertex
+anim
+= vertex vertex
+= bone 1.0 texture material anim
+frame
+1.0
+anim 0.500000 0.500000 = bone
+material vertex vertex = material
+frame bone -1 frame anim
+1.0
+1.0 bone bone = -1 = texture
+-1
+vertex = bone
+-1 -1 vertex vertex frame -1 vertex texture 1.0 anim vertex texture
+0.500000 anim texture = 0.500000
+bone
+-1 1.0 anim = texture material texture bone vertex =
+material vertex -1 0.500000 =
+material material bone 1.0 vertex
+0.500000 texture
+anim texture -1
+0.500000 0.500000 frame 0.500000 anim material
+1.0 vertex -1
+material anim texture
+1.0 texture anim
+bone
+bone
+0.500000 1.0 -1 vertex 1.0 material 0.500000 =
+-1
+0.500000 0.500000 material
+vertex -1 vertex 0.500000 1.0
+vertex texture
+vertex frame texture = -1 anim
+anim material frame = anim 0.500000 frame 0.500000 frame = 1.0
+0.500000 -1
+-1 vertex
+texture bone 0.500000 bone vertex anim texture vertex
+material anim = 0.500000
+frame = = bone frame frame material -1 anim bone =
+frame
+anim material 0.500000 0.500000 material
+frame
+anim 1.0 frame
+bone anim vertex anim -1 = -1 frame
+-1
+bone material
+anim = 0.500000
+bone bone bone vertex
+vertex = 1.0
+bone
+anim
+material
+texture anim frame = -1
+vertex
+= =
+bone
+texture
+1.0 frame -1
+texture 1.0 vertex
+frame
+material vertex material 0.500000 material -1
+1.0 vertex 0.500000 0.500000
+vertex = texture 0.500000 vertex material frame vertex anim
+1.0
+texture = anim
+anim texture texture
+=
+1.0 anim texture material 0.500000 frame 0.500000
+-1 bone bone anim frame -1 texture frame 1.0 vertex -1 1.0 0.500000 anim = 0.500000
+vertex
+texture -1 bone vertex
+vertex
+bone
+bone
+anim vertex material anim frame frame
+frame
+frame
+anim
+material 0.500000
+vertex frame bone material -1
+anim 0.500000
+1.0 bone -1
+-1
+material material 0.500000
+vertex 0.500000 frame vertex
+material anim 1.0 bone
+bone
+= texture vertex texture texture 1.0 frame
+frame anim texture
+= anim =
+frame 1.0 vertex
+frame 1.0
+= 1.0 -1 1.0 0.500000 1.0 frame
+= = 1.0 frame
+= -1 frame material = 0.500000 -1 -1
+0.500000 anim
+bone anim = = material frame vertex texture
+0.500000
+frame -1 bone bone texture bone texture 1.0 vertex
+= -1 frame
+vertex frame bone texture
+=
+bone texture vertex anim =
+vertex 0.500000 1.0 anim = frame 0.500000 material anim vertex material anim bone vertex -1 1.0 0.500000 frame 0.500000 bone texture
+texture bone 1.0 = frame
+0.500000 0.500000
+0.500000
+vertex = anim frame bone vertex anim =
+frame anim
+anim anim anim texture =
+= frame -1
+bone -1
+= frame
+0.500000 text
\ No newline at end of file
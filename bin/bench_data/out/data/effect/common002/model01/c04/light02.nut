@@ -0,0 +1,8 @@
+bone = frame -1 anim texture bone
+material material 0.500000 =
+frame =
+1.0
+= bone vertex material material
+-1 anim anim
+bone
+material bone text
\ No newline at end of file
@@ -0,0 +1,4 @@
+texture = -1 material
+vertex 0.500000
+= anim
+1.0 1.0 frame texture bon
\ No newline at end of file
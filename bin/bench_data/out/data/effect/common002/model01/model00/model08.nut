@@ -0,0 +1,12 @@
+bone bone
+texture vertex
+1.0 -1 frame -1 0.500000 anim
+= texture 0.500000 vertex
+0.500000 frame 0.500000 material material 1.0 0.500000
+-1
+material 0.500000
+texture frame material 1.0 vertex bone material frame
+texture = texture 1.0 texture
+anim
+-1 bone = anim
+-1 1.0 vertex frame vertex 0.500000 material anim = m
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim anim =
+frame 1.0 anim
+vertex texture tex
\ No newline at end of file
@@ -0,0 +1,2 @@
+-1 vertex texture
+frame 0.500000 0.5
\ No newline at end of file
@@ -0,0 +1,4 @@
+texture material frame
+0.500000 bone = -1 anim = = 1.0 texture
+vertex
+= vertex frame
\ No newline at end of file
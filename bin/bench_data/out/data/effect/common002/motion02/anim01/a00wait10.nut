@@ -0,0 +1,263 @@
+bone bone anim
+bone
+vertex -1
+vertex vertex bone vertex 1.0
+-1 =
+anim vertex -1 =
+-1 -1 frame frame =
+material bone
+0.500000 anim 0.500000 texture = frame texture vertex
+texture texture bone bone -1
+anim
+-1 anim -1
+1.0 -1 1.0 bone
+bone = material = frame 0.500000 texture texture 0.500000 anim bone -1
+vertex
+material = 1.0 bone 1.0 bone 1.0 1.0
+frame = -1
+material
+bone 1.0 bone -1
+1.0 vertex texture
+frame material
+material 0.500000
+1.0 material
+-1
+1.0 bone 1.0 material vertex texture = 1.0 = anim anim bone frame frame
+vertex
+bone texture
+material 1.0
+=
+anim = 1.0 -1 vertex 0.500000 bone
+-1 1.0
+-1 1.0
+0.500000
+anim 0.500000 material material material texture 1.0 =
+1.0 0.500000 material anim texture vertex
+material 0.500000 anim -1 texture
+material anim
+material frame texture -1
+anim
+1.0
+bone texture bone = material
+anim
+bone frame
+-1 vertex 0.500000 bone material
+vertex
+bone frame texture
+-1 = = frame
+frame
+texture
+anim texture texture
+material texture =
+vertex 1.0
+texture vertex material anim frame
+texture vertex
+texture
+frame
+bone vertex bone
+texture bone bone material vertex =
+bone 1.0
+material bone material
+frame anim
+material texture -1
+vertex anim texture texture 1.0 material -1
+vertex frame
+frame =
+0.500000 0.500000 material 0.500000
+-1 0.500000 anim
+vertex anim vertex -1 texture
+bone material bone vertex -1
+0.500000 material 0.500000 anim vertex -1 0.500000 vertex bone anim vertex 0.500000 material =
+bone vertex 0.500000 0.500000 vertex bone texture texture
+anim frame bone
+vertex 1.0 vertex material 1.0 texture texture
+frame vertex frame anim
+vertex
+0.500000 bone anim
+= bone
+= 0.500000 material
+= texture -1
+anim 0.500000
+texture anim = anim bone =
+anim vertex bone texture
+vertex 1.0 texture anim frame
+=
+anim
+bone frame texture 1.0 vertex material texture material vertex anim anim 0.500000
+bone =
+anim bone -1 bone texture anim
+bone frame vertex 1.0 material 0.500000
+=
+1.0 1.0 vertex texture
+vertex material
+bone
+-1 = -1 vertex
+texture anim
+= anim
+= 1.0 vertex anim texture
+material = vertex material
+vertex
+texture
+texture texture
+0.500000 vertex vertex texture 1.0 -1 -1 frame frame frame =
+material frame 0.500000
+-1 -1 0.500000 material = texture vertex anim anim
+0.500000 0.500000 1.0
+texture
+0.500000
+0.500000 anim -1 texture 0.500000 bone
+anim
+1.0 vertex frame
+0.500000
+1.0
+anim texture = 1.0 -1 bone anim texture bone
+material
+= material texture 0.500000
+anim 1.0
+texture -1 texture 1.0 1.0 anim texture vertex bone -1
+anim -1 0.500000 bone anim 1.0
+texture 0.500000
+1.0
+texture
+1.0
+vertex anim texture bone 1.0
+= bone
+=
+anim 0.500000 frame
+vertex 0.500000 frame = 0.500000 1.0 -1 0.500000 0.500000
+anim -1 frame anim 1.0
+frame 0.500000 material
+vertex 0.500000 1.0 = material texture
+bone material
+bone
+1.0 0.500000 frame
+-1
+anim 1.0 -1 1.0 texture bone
+bone
+1.0 vertex
+texture
+material anim anim material texture
+bone
+1.0
+1.0 material
+1.0
+texture =
+0.500000 = -1 vertex texture anim anim -1 material 1.0 1.0 1.0 -1 texture bone frame texture texture material
+0.500000 0.500000 = bone 1.0 -1 bone
+1.0
+frame texture
+vertex = material
+frame = vertex
+vertex -1 1.0 vertex texture bone anim -1 frame bone
+bone vertex material
+frame frame -1 vertex vertex 0.500000 texture vertex texture = = texture
+-1 material -1 texture
+vertex bone
+bone vertex 1.0 material
+frame vertex
+material -1
+texture
+vertex 0.500000 anim
+anim vertex
+frame anim
+anim bone =
+1.0
+texture 1.0 anim frame 0.500000 anim 1.0 1.0
+anim 0.500000 -1
+anim bone vertex
+=
+bone vertex 0.500000
+texture
+anim vertex 1.0
+anim anim
+bone material material 0.500000
+anim
+1.0 texture 1.0 -1 anim
+-1 anim material = 0.500000
+anim
+texture 0.500000 anim vertex = 0.500000 -1
+-1 0.500000
+1.0 material anim anim vertex = anim material texture vertex anim anim = -1
+bone =
+0.500000 frame anim texture anim material anim
+frame vertex
+1.0 1.0
+= 0.500000 1.0 bone anim anim
+1.0 1.0 material -1 -1 bone
+material 0.500000 1.0 0.500000 texture 0.500000 bone
+= -1 anim
+anim 0.500000 anim frame 0.500000 = material bone vertex frame 1.0 anim =
+anim texture 0.500000 frame
+1.0
+vertex
+anim material frame 0.500000 anim anim 0.500000 vertex
+-1
+vertex texture vertex
+0.500000
+texture vertex = anim -1
+1.0
+1.0 bone -1 anim vertex bone
+texture 1.0 texture vertex
+bone 0.500000
+frame 1.0
+material bone frame 1.0 1.0 -1 = = frame -1 anim
+texture
+1.0
+anim anim = 1.0 anim bone -1 frame
+texture 1.0 texture -1 1.0 anim = 1.0 1.0
+1.0 anim -1
+texture texture
+=
+-1 texture
+-1 1.0 0.500000 frame
+= 1.0 frame
+frame bone 0.500000 0.500000 frame
+1.0
+bone vertex
+anim 0.500000 material
+texture
+vertex frame
+bone 0.500000 =
+1.0 -1 1.0
+frame
+frame bone
+vertex texture = 1.0 anim -1
+material texture texture =
+0.500000 1.0 = = 1.0 =
+1.0 anim anim bone
+bone texture texture frame
+texture
+1.0 texture material 1.0 texture 1.0 bone material frame -1
+frame frame
+0.500000 bone vertex frame
+vertex
+material material bone
+material frame texture
+vertex bone
+1.0
+0.500000 1.0 texture texture material texture anim material anim
+anim
+-1 texture 1.0 frame bone -1 texture = anim anim anim material
+bone
+vertex
+bone =
+= 0.500000 frame material 0.500000
+material anim 0.500000 bone material 1.0
+1.0 material frame
+= frame material
+-1 =
+= vertex 1.0 material frame 0.500000 anim
+= 1.0
+frame 1.0 texture material 1.0 -1 texture 1.0 1.0
+anim 1.0
+= 0.500000
+vertex
+-1 1.0
+frame 0.500000 = -1 material 0.500000
+vertex
+vertex texture bone = = 1.0
+-1 frame
+-1 -1 frame bone
+material
+bone
+fram
\ No newline at end of file
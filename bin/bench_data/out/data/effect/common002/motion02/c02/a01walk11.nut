@@ -0,0 +1 @@
+0.500000 1.0 vertex texture vertex frame = = 0.50000
\ No newline at end of file
@@ -0,0 +1,17 @@
+frame -1
+texture
+frame = texture 1.0
+0.500000
+vertex 0.500000 =
+0.500000 frame
+-1 bone anim texture
+0.500000 =
+0.500000
+-1 bone anim texture bone vertex 0.500000 frame
+0.500000
+-1 = = frame 0.500000
+material -1 material bone
+material frame 0.500000 material
+frame anim 0.500000 -1
+1.0 0.500000 frame
+-1 frame v
\ No newline at end of file
@@ -0,0 +1,55 @@
+bone texture
+= 0.500000 frame
+=
+anim vertex anim texture
+= texture = texture
+anim 0.500000 -1 0.500000 material -1 =
+texture 1.0 material material 1.0
+0.500000 vertex
+material
+bone
+-1 bone bone frame material
+material
+vertex texture texture anim 1.0
+-1 1.0 = texture material texture texture anim 1.0 = 1.0 texture -1
+bone texture anim
+anim anim -1
+= 1.0 0.500000 material 1.0 = frame texture material 1.0 0.500000 anim material frame material = 0.500000 anim 1.0 0.500000
+= -1 frame 1.0
+frame frame
+anim 0.500000 bone
+bone anim anim anim frame 0.500000 =
+= anim
+1.0
+-1 0.500000
+anim texture
+frame
+anim bone vertex frame 0.500000 -1 vertex bone anim 1.0
+vertex
+-1 frame vertex bone 1.0
+= 1.0 anim -1 = =
+frame -1 anim texture vertex 1.0 frame 0.500000 -1 anim 1.0 = vertex
+vertex vertex
+0.500000 bone vertex frame frame 1.0 vertex
+1.0 bone material bone vertex bone -1 texture 0.500000
+-1 material 1.0 frame 1.0 material frame 1.0 material = = material frame 0.500000 -1 vertex material
+0.500000 -1 bone texture material anim
+vertex
+1.0 bone
+anim
+0.500000 frame vertex material material
+bone bone 1.0
+texture 1.0
+texture texture
+-1 -1 0.500000 0.500000 frame
+texture
+vertex frame
+bone
+=
+frame material 0.500000 = =
+frame 0.500000 = frame frame anim vertex material 0.500000 vertex
+-1
+0.500000 texture
+frame -1
+1.0 anim
+anim -1 anim 0.500000
\ No newline at end of file
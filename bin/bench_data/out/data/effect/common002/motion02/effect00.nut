@@ -0,0 +1,59 @@
+texture
+-1 bone 1.0 frame bone vertex
+-1
+texture material texture frame frame =
+frame frame
+bone
+0.500000
+material
+-1 vertex
+vertex 0.500000 vertex = anim = vertex
+1.0 anim anim material = -1 anim
+frame material texture =
+1.0 -1 1.0 material
+0.500000
+bone = -1 bone = material 0.500000 material vertex = anim -1 1.0
+anim anim 0.500000 -1
+frame anim
+frame
+= -1 -1 -1 0.500000
+= 1.0 anim frame anim 1.0 -1 0.500000
+frame
+material 1.0 texture frame frame = frame anim anim -1
+0.500000
+material 0.500000 frame material -1 vertex 0.500000 texture vertex -1
+0.500000 anim 0.500000 -1 anim vertex
+1.0 anim bone 0.500000
+= frame -1 bone frame material material vertex = -1 1.0 material
+0.500000 0.500000
+frame bone
+frame frame anim
+material
+1.0 =
+vertex bone
+bone
+1.0 -1
+anim
+= material bone bone -1 0.500000
+0.500000 frame bone -1 anim texture anim
+frame texture -1 anim texture
+anim =
+anim material material texture material
+texture
+texture vertex anim 0.500000
+=
+frame 1.0 frame
+-1
+= 1.0 texture texture texture
+texture vertex 1.0 texture anim
+texture anim 1.0 = 0.500000 material frame
+-1 frame anim bone vertex frame texture frame 0.500000 texture frame frame frame
+= bone =
+anim material anim bone 0.500000 texture
+bone -1 -1 1.0 1.0
+frame texture material bone
+anim 1.0 vertex -1 0.500000 anim
+0.500000
+=
+0.500000 0.500000 bone vertex material 0.500000
+anim anim 1.0 ma
\ No newline at end of file
@@ -0,0 +1,25 @@
+texture bone bone texture bone vertex vertex 1.0 0.500000 texture frame 1.0 frame bone vertex
+material 0.500000 vertex 0.500000 1.0 -1 -1 vertex
+texture frame vertex bone material texture anim 1.0
+bone bone
+texture bone frame -1
+1.0 =
+vertex 1.0 anim frame -1 vertex texture
+1.0 anim bone
+frame 1.0 texture material texture 1.0 frame 1.0
+anim
+bone 0.500000
+anim anim anim -1 anim 1.0 anim = -1 -1
+bone
+material
+1.0 anim frame -1 -1 1.0
+bone -1 material 1.0 0.500000
+anim -1
+bone 1.0 frame texture -1 0.500000 bone texture 0.500000 1.0
+= bone 1.0
+= -1 1.0 = material -1 1.0 -1
+material vertex 0.500000 0.500000 -1 anim 0.500000 frame
+texture vertex texture 0.500000
+texture anim 0.500000
+frame vertex 0.500000 frame 1.0
+-1 vertex 0.500000 frame 
\ No newline at end of file
@@ -0,0 +1,10 @@
+frame -1 material
+frame texture frame -1 = = texture = -1 vertex -1 material
+anim
+bone 1.0
+=
+vertex frame
+1.0
+texture vertex texture bone anim bone texture = texture texture material anim vertex -1
+= frame = texture 1.0 frame frame texture -1
+vertex anim frame -1 0.5000
\ No newline at end of file
@@ -0,0 +1,230 @@
+anim 0.500000
+frame
+-1 = 1.0
+texture frame frame bone texture -1
+material
+anim
+texture = 1.0 texture -1
+0.500000
+0.500000 texture
+anim
+-1 vertex texture -1 = texture material = bone
+texture bone 0.500000
+0.500000 material -1 anim = material -1
+anim anim texture bone 0.500000 1.0
+-1 0.500000 1.0 -1 -1 anim frame vertex -1 material 0.500000 =
+-1 0.500000
+vertex vertex -1
+= 1.0 -1 vertex 1.0 texture vertex 0.500000 anim = 0.500000 = vertex 1.0 0.500000 -1 bone anim 0.500000 bone = bone
+bone -1 1.0 anim material
+1.0
+texture
+0.500000 0.500000 -1 material
+texture bone = = texture texture 0.500000
+bone
+anim
+bone -1 vertex material
+bone 0.500000 0.500000 -1 = anim texture frame
+1.0 0.500000 material vertex texture 1.0 anim = =
+bone =
+material 0.500000
+= = 0.500000 vertex 1.0 material texture
+-1 = 1.0 frame material anim texture texture
+anim
+vertex
+0.500000 = 1.0
+bone 1.0 vertex
+-1
+= = = 1.0 vertex
+= texture texture
+1.0
+anim vertex -1 0.500000 frame
+0.500000 anim frame
+frame
+material bone texture bone
+material vertex material vertex = = anim
+bone
+1.0 -1 material 1.0 = anim -1 anim -1 material frame anim material anim -1
+0.500000 vertex texture 1.0 -1 0.500000
+= anim
+0.500000 texture
+frame vertex 1.0 vertex 0.500000 frame texture frame
+frame frame
+bone =
+bone
+0.500000 =
+material
+= bone 1.0
+0.500000 material frame anim
+1.0
+material bone material 0.500000 0.500000 0.500000
+0.500000
+anim material = bone = vertex = anim 1.0 vertex
+vertex -1
+1.0
+bone
+frame anim -1 bone anim 0.500000
+vertex 1.0 0.500000 vertex bone -1 -1 frame frame bone 1.0 0.500000 texture 0.500000 anim 0.500000 1.0
+bone -1
+bone 0.500000 0.500000 anim 1.0 0.500000
+frame
+texture
+vertex 0.500000 1.0
+1.0 frame =
+anim texture -1 vertex anim
+anim
+texture
+material
+-1 1.0
+-1 frame anim -1 anim 0.500000 1.0
+1.0
+frame frame -1 vertex
+material -1 1.0 -1 bone vertex bone frame anim anim
+vertex 0.500000 texture -1 0.500000 vertex material material
+0.500000
+-1
+-1 vertex texture -1 texture =
+0.500000 -1
+0.500000
+vertex texture material -1 bone frame 0.500000 frame =
+0.500000 1.0
+0.500000 0.500000 1.0 material = frame frame anim material 0.500000 bone
+bone
+1.0 1.0 anim 1.0 frame bone -1 anim
+anim texture -1
+vertex
+1.0
+anim
+frame vertex frame -1 texture 1.0 vertex =
+= bone = =
+-1 texture 0.500000 0.500000 frame texture vertex -1
+texture
+anim bone = 0.500000 anim
+vertex vertex anim
+texture -1 material frame 0.500000 vertex frame frame vertex vertex bone frame anim = vertex frame 1.0 0.500000
+texture frame 1.0 1.0 vertex
+anim
+material vertex -1 vertex 1.0 1.0
+vertex
+= vertex
+= material bone material
+= texture = = frame bone frame vertex 1.0 0.500000
+frame texture frame texture texture
+-1 frame 1.0 1.0 = 0.500000
+material texture frame vertex bone -1 1.0 0.500000 0.500000 texture -1 frame frame vertex material
+texture anim vertex 1.0 material material
+anim
+anim = = =
+0.500000 vertex bone material = = bone frame = 0.500000
+=
+vertex = texture material anim 1.0 bone 0.500000
+frame frame frame frame
+=
+texture vertex 0.500000 frame anim 0.500000 material 1.0 1.0 frame vertex vertex frame frame
+=
+texture bone bone 1.0 -1 1.0 -1 = 1.0 1.0 0.500000
+1.0 texture frame anim bone frame material material texture frame material frame material vertex
+material
+anim material texture
+1.0 texture 0.500000 anim = 0.500000 frame anim texture =
+anim
+frame texture texture
+= anim 0.500000 material -1 texture material =
+0.500000
+0.500000 -1 anim texture 1.0 vertex
+frame bone 1.0 1.0 anim = -1
+1.0
+= 1.0 anim texture frame anim frame
+texture
+0.500000 -1 vertex bone material
+0.500000
+material bone
+bone
+= 1.0 anim frame anim bone
+0.500000
+anim anim -1 vertex
+bone 0.500000 anim -1 0.500000 frame bone = material
+vertex -1 anim 0.500000 0.500000 = bone bone = 1.0
+= texture
+-1 = material bone texture material
+vertex
+frame texture
+1.0 0.500000
+-1
+material material
+frame anim 1.0
+frame -1 1.0 texture 0.500000
+0.500000 texture
+bone bone frame
+1.0
+-1 material material material 1.0 material 0.500000 0.500000 bone vertex -1
+0.500000 frame material = frame
+= =
+frame
+bone frame
+vertex vertex frame 0.500000 material texture material bone 0.500000 -1 material 0.500000 1.0 material texture =
+frame
+1.0 texture vertex 0.500000 -1 -1 frame = material texture texture 1.0 0.500000
+frame material vertex
+vertex 1.0
+frame bone bone = vertex =
+material material 0.500000 texture
+0.500000 texture vertex vertex 1.0 material 1.0 texture
+= 1.0 = frame
+vertex 0.500000
+bone
+material material = bone bone anim -1 material
+1.0
+frame frame
+frame vertex 1.0
+anim vertex
+material bone anim -1
+frame anim vertex 1.0 -1 1.0 vertex bone anim 0.500000 0.500000 frame bone 0.500000 vertex 0.500000 0.500000
+=
+=
+anim
+material
+= vertex frame anim
+texture frame material material frame
+= =
+anim material frame anim frame 0.500000 texture 1.0 texture
+frame 0.500000 1.0
+frame material texture frame
+-1 frame bone -1 -1 vertex texture 0.500000 texture 0.500000 material vertex texture -1 = anim = = anim bone -1 material
+texture anim
+texture bone 0.500000 anim 0.500000 frame 0.500000 bone anim vertex 1.0
+-1 bone -1 0.500000 1.0 anim material vertex bone frame
+texture = texture frame texture frame material material material anim vertex
+vertex bone frame
+bone vertex 1.0 vertex
+texture
+material
+bone =
+0.500000 -1 anim anim
+-1 bone 0.500000 texture 0.500000 bone
+bone texture -1 texture
+texture material anim anim = bone frame bone anim texture
+1.0 vertex bone
+=
+0.500000
+texture material frame
+frame
+vertex -1 bone
+vertex
+material vertex bone bone anim frame
+1.0 = -1 1.0 -1
+= frame =
+-1 texture
+material texture material
+material 0.500000
+0.500000 bone
+texture
+bone
+0.500000 1.0 1.0 1.0 material 1.0 frame frame frame
+texture
+-1 1.0 = 0.500000 -1 anim 1.0 -1 = texture bone
+anim
+texture
+texture 1.0 bone material = material =
+vertex frame
+bone vertex frame anim bone 0.500000 frame material 
\ No newline at end of file
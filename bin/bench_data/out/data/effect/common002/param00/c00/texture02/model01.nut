@@ -0,0 +1,13 @@
+bone -1 =
+frame = anim anim 0.500000 -1 vertex 0.500000
+0.500000 bone material frame 0.500000
+frame frame frame -1 texture texture frame = frame
+bone 1.0 texture texture
+anim anim
+texture anim texture -1 vertex
+= bone texture frame bone material anim material 0.500000 vertex material
+vertex -1
+-1 frame -1
+0.500000 material vertex -1 frame bone 0.500000 bone
+= vertex frame 0.500000 -1 texture texture 1.0 frame
+bone frame = fram
\ No newline at end of file
@@ -0,0 +1,7 @@
+= = anim 1.0
+anim
+anim
+=
+0.500000
+= = bone
+bone
\ No newline at end of file
@@ -0,0 +1,94 @@
+= = vertex frame 1.0
+-1 frame 0.500000 material
+material vertex texture =
+vertex frame
+1.0 anim bone anim material
+bone anim
+0.500000 -1 -1 material bone = texture
+0.500000 1.0 bone bone
+vertex vertex
+bone
+-1 frame
+texture anim
+bone
+1.0 0.500000
+frame
+frame frame material vertex
+=
+bone bone material material
+bone =
+= =
+1.0
+1.0 frame =
+material =
+= -1
+texture
+1.0
+-1 0.500000 0.500000 vertex 1.0 frame anim material 0.500000 anim 0.500000 bone 0.500000 1.0 -1 0.500000 anim
+anim = texture texture 1.0 1.0 vertex frame vertex material
+texture material
+-1 frame vertex bone bone
+vertex
+1.0 0.500000
+frame -1
+1.0 vertex 0.500000 = frame texture
+vertex -1
+bone
+-1
+anim 0.500000 =
+1.0 = texture
+vertex = anim 1.0 bone
+0.500000
+= material anim frame anim
+0.500000
+1.0 material vertex vertex 1.0 material -1 anim
+0.500000 frame anim texture vertex 1.0 -1 = texture 1.0 0.500000
+texture
+1.0 bone 1.0 -1 1.0 material
+1.0 material
+bone material 1.0 frame
+material
+texture = frame -1 material
+texture -1 material
+=
+0.500000 = material
+-1 0.500000 bone
+-1 texture -1 material 1.0
+bone texture
+bone 0.500000 bone
+1.0 vertex anim texture frame vertex anim bone frame =
+0.500000 bone frame anim
+vertex
+1.0 = frame texture
+= frame anim = frame bone 0.500000 -1
+material
+frame texture 0.500000
+-1
+bone texture material
+texture 0.500000 material
+frame
+material = bone material
+-1 1.0 bone 0.500000 frame = 0.500000
+texture
+1.0 bone
+frame frame
+-1
+vertex 1.0 1.0 material bone anim anim = texture frame
+bone texture anim
+1.0
+vertex 1.0 frame
+material vertex -1 0.500000 0.500000 bone vertex
+anim 0.500000 material
+anim texture 1.0 1.0 -1 bone 0.500000 anim
+0.500000 frame 0.500000
+0.500000 vertex bone anim bone vertex frame material bone
+= vertex
+material
+=
+1.0
+bone = 1.0 -1
+=
+texture
+bone 0.500000 anim frame 1.0 0.500000
+texture bone -1 0.500000 anim = -1 material texture
+0.500000 1
\ No newline at end of file
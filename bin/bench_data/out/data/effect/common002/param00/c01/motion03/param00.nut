@@ -0,0 +1,98 @@
+texture 0.500000 frame anim 1.0 frame vertex -1 0.500000
+bone
+frame
+-1
+-1 vertex = anim bone frame material 0.500000 material material frame vertex
+= texture
+vertex 1.0 1.0 -1
+vertex vertex
+texture =
+bone 1.0 bone bone 0.500000 0.500000
+vertex vertex 0.500000
+material texture frame texture
+texture 1.0
+1.0 -1 material
+material material anim frame frame bone texture -1
+texture texture -1 vertex -1
+vertex
+vertex bone texture 1.0 -1
+1.0 texture
+texture
+1.0 frame =
+texture anim
+anim
+frame 1.0 material material material material frame frame
+texture material 0.500000 vertex = -1 vertex -1
+= 0.500000
+-1 1.0
+vertex = 0.500000 -1 texture
+anim 0.500000 1.0
+1.0
+frame 1.0 material
+anim = = vertex 1.0
+vertex anim material -1 bone
+anim
+= frame 1.0 1.0 0.500000 texture
+1.0
+anim material
+texture -1
+material
+frame bone
+vertex
+0.500000
+1.0 vertex frame 0.500000
+=
+texture frame 1.0 =
+0.500000 texture frame
+anim -1
+vertex
+vertex
+0.500000
+1.0
+-1 texture anim vertex anim
+anim material anim
+material -1 frame material
+material -1 0.500000 bone
+bone bone vertex -1 material frame material bone anim anim 0.500000 1.0 -1
+-1 0.500000
+0.500000
+frame frame anim -1 1.0 vertex 0.500000
+frame anim = -1 = texture
+frame 1.0
+=
+0.500000
+frame material =
+vertex vertex =
+-1 1.0 0.500000 -1 bone
+1.0 vertex
+bone -1 material frame
+texture
+1.0 anim bone bone 1.0 anim texture anim 1.0 1.0
+bone 0.500000 bone frame 0.500000 frame
+vertex vertex
+texture anim
+= vertex vertex
+texture 0.500000 vertex vertex 0.500000 =
+1.0
+vertex anim -1 frame texture frame vertex texture 1.0 -1 -1 = texture 1.0 material texture bone vertex bone
+= material anim anim anim 1.0 vertex 0.500000 bone = 0.500000 material material -1
+frame
+texture
+bone bone frame 0.500000 texture frame bone -1
+1.0 bone -1
+0.500000 material -1 anim 0.500000 texture bone = texture
+frame texture anim 0.500000 vertex -1 -1
+material bone
+-1
+= = 1.0 0.500000 -1 frame
+1.0 frame anim bone bone texture = frame = 1.0
+bone
+material = vertex vertex frame texture frame 0.500000 anim anim
+0.500000 1.0
+frame frame anim = frame
+material 0.500000 texture
+frame bone
+=
+= bone 0.500000 texture -1 0.500000
+1.0
+anim bo
\ No newline at end of file
@@ -0,0 +1 @@
+uUP%&E:ͭP#Ϳ	ckHw#9lzH(d{
\ No newline at end of file
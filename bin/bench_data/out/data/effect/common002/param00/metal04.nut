@@ -0,0 +1,89 @@
+= 0.500000 vertex 1.0 bone
+material = frame
+material bone = -1 bone material vertex anim texture frame
+texture anim
+0.500000
+frame material 0.500000 texture 1.0
+anim material anim =
+frame bone
+bone bone 0.500000
+anim vertex
+material anim 1.0 frame = 0.500000 1.0 bone anim
+material frame 1.0 = bone bone 1.0 material texture vertex vertex vertex anim 1.0
+frame bone anim 0.500000 frame bone frame = = -1 bone 0.500000 -1 vertex 1.0 0.500000 1.0 -1 frame
+bone
+frame -1
+bone anim = bone 1.0 anim
+frame 1.0 anim 1.0 = = -1 1.0 material 0.500000 -1 texture bone anim frame -1 anim -1 bone 1.0 -1
+anim frame anim
+0.500000 texture bone
+bone
+frame material material vertex
+material anim = bone -1 bone material anim 0.500000
+-1 anim frame
+1.0 = vertex -1 texture 0.500000 bone
+material vertex bone anim
+1.0 material -1
+vertex
+anim anim frame
+bone texture vertex
+anim texture anim bone
+frame vertex anim material 0.500000 = material material
+vertex 0.500000 bone 1.0 = 0.500000 texture material -1 =
+material
+bone
+texture texture vertex
+texture bone anim bone anim
+anim anim material texture 0.500000
+anim
+material frame bone anim =
+-1
+anim
+material 1.0 texture
+texture material material vertex 0.500000 0.500000 frame vertex anim 1.0 bone frame frame 0.500000 -1
+0.500000 1.0 bone
+1.0 -1 anim 1.0
+=
+1.0 bone
+= texture material 1.0 0.500000 vertex bone texture 1.0 vertex material 1.0 -1
+anim
+-1 vertex =
+frame texture -1
+material vertex 1.0 bone
+anim =
+= texture 1.0 texture 1.0 1.0 texture texture -1
+vertex 1.0 vertex anim texture material bone 1.0 texture
+vertex texture
+texture vertex frame anim vertex
+frame -1 texture texture =
+anim bone
+=
+vertex = bone texture bone 1.0 bone 0.500000 bone -1 1.0 bone
+texture 0.500000 vertex vertex 1.0 texture material frame material material
+= =
+texture texture
+=
+frame 1.0 material anim
+vertex
+=
+0.500000 0.500000
+anim
+bone
+frame = material texture texture anim 1.0 =
+texture 1.0 texture
+texture material
+texture -1 anim -1 -1
+texture texture = anim
+anim frame 0.500000 -1 texture
+anim bone = 1.0 -1 frame =
+-1 vertex
+anim frame
+=
+material
+texture -1
+1.0 bone 1.0
+anim 1.0
+-1
+0.500000 -1 0.500000
+frame
+-1 =
\ No newline at end of file
@@ -0,0 +1,303 @@
+texture
+bone
+-1 = -1
+1.0 texture material = bone 0.500000 vertex = 1.0 1.0 = material material -1 bone bone frame -1 -1 = material
+texture
+-1 -1 bone vertex frame frame
+anim vertex vertex material texture frame vertex = vertex frame 0.500000 anim texture vertex bone 0.500000
+anim
+0.500000 texture
+texture -1 0.500000
+bone
+anim anim
+0.500000 1.0
+material -1 material anim
+bone 1.0 -1
+1.0 anim bone
+0.500000
+vertex = -1 material frame = bone = 0.500000 1.0 bone anim
+0.500000
+bone
+texture = vertex
+1.0 =
+anim
+frame bone 0.500000 frame
+anim material material material vertex frame
+0.500000
+anim 1.0 -1 0.500000 material vertex frame bone -1 frame
+texture material vertex anim material anim texture = 1.0 vertex anim = 0.500000 frame vertex
+vertex = 1.0 material
+0.500000 bone =
+= texture vertex anim anim
+bone
+bone -1 texture texture frame -1
+bone bone
+vertex anim
+anim texture = 1.0 = 1.0
+bone
+-1 0.500000 vertex vertex 0.500000
+1.0 texture = 1.0
+bone frame frame frame texture
+texture 1.0 vertex material vertex
+anim anim material
+anim bone -1 0.500000
+anim = texture -1
+material anim -1 texture 1.0 1.0
+vertex
+anim 0.500000 1.0
+frame
+1.0 frame
+material 1.0 vertex bone 1.0 anim
+anim 0.500000 vertex material
+vertex bone
+bone bone vertex 0.500000 0.500000 bone 0.500000 vertex 0.500000 bone -1
+1.0 frame material -1 anim = 0.500000 texture 1.0 texture bone frame 1.0 texture frame bone = 1.0 frame material -1 = = frame = frame frame
+vertex anim frame
+0.500000 bone
+1.0 0.500000 -1 bone texture
+material anim
+= frame 1.0
+-1
+-1
+texture frame vertex -1 bone
+vertex
+material
+vertex
+bone anim 0.500000 1.0 -1
+vertex material
+bone =
+anim =
+0.500000 anim
+-1 bone
+= 0.500000 -1 bone texture
+0.500000 frame frame
+bone -1 vertex texture
+1.0 texture =
+frame = frame 0.500000
+1.0 frame frame 1.0
+1.0 =
+1.0 vertex
+bone
+-1 frame
+0.500000 material
+frame frame frame vertex material
+vertex
+bone -1 =
+frame bone vertex frame = anim vertex
+bone 0.500000 texture vertex
+anim 0.500000 bone
+vertex anim vertex -1 -1
+bone
+-1 bone anim material texture 1.0
+0.500000 -1 anim vertex
+0.500000 1.0 -1 anim
+=
+= 1.0
+= =
+bone 0.500000
+material
+=
+bone material material
+1.0 -1
+bone 0.500000 1.0 =
+texture 1.0 bone vertex vertex frame -1
+0.500000 0.500000
+frame anim
+material = frame = material -1 0.500000 1.0 frame frame -1 vertex = 0.500000
+bone -1 material anim = 0.500000 -1
+= vertex vertex anim 0.500000 frame vertex
+material material frame texture anim bone -1 material 0.500000
+-1
+= anim
+0.500000 =
+= 1.0 0.500000 0.500000 0.500000 0.500000 anim bone 1.0
+anim vertex =
+material
+= vertex frame
+bone frame texture anim bone frame 0.500000 -1 anim 0.500000 bone
+vertex bone anim
+texture
+material material frame
+bone 0.500000 bone = -1 texture -1
+0.500000
+texture 0.500000 0.500000
+1.0
+1.0 vertex anim anim frame anim 0.500000
+-1
+texture =
+material
+frame = -1 vertex 1.0 vertex frame material material texture material bone vertex material bone anim frame anim vertex
+anim texture texture
+= bone
+material = 0.500000 frame 1.0 0.500000 bone = vertex texture 1.0 bone 1.0 texture frame vertex =
+0.500000 -1
+anim
+bone
+anim
+anim
+anim bone
+frame
+0.500000
+anim texture bone = =
+material 0.500000
+frame anim anim
+= vertex frame frame
+1.0 1.0 0.500000
+-1 1.0 =
+0.500000
+vertex texture frame = material 0.500000
+texture
+= = bone -1 vertex -1
+texture bone material
+frame frame material texture
+material vertex 0.500000 0.500000 1.0
+bone = bone
+material
+material vertex -1 texture texture vertex bone vertex anim vertex material vertex material vertex 0.500000
+bone
+-1 anim vertex
+frame = vertex 1.0 = bone vertex
+-1 frame bone frame vertex material anim
+anim 0.500000
+material
+-1 1.0
+1.0 -1 vertex -1 texture anim anim =
+-1
+= material bone -1
+0.500000 bone bone material bone anim 0.500000 =
+frame
+1.0 vertex -1
+frame frame
+0.500000 bone anim texture
+bone vertex 0.500000 -1 -1 texture
+material material
+vertex texture = vertex texture
+bone = 1.0 -1 bone
+-1 frame = frame
+anim
+1.0
+material
+frame anim
+=
+anim -1 material
+0.500000 1.0
+material bone 1.0
+=
+texture 1.0 0.500000 bone -1 vertex vertex bone
+0.500000 anim
+vertex
+bone -1 -1 texture vertex bone 1.0 texture frame texture bone bone
+1.0 vertex
+vertex
+vertex vertex
+1.0 bone anim frame anim
+-1 anim 1.0 frame material
+vertex
+0.500000 texture
+1.0 0.500000 = bone
+bone bone frame = anim bone texture vertex bone anim bone 1.0 frame 1.0 1.0
+vertex anim
+1.0 anim
+-1 texture material 1.0
+1.0 vertex 1.0 anim -1 vertex
+= material
+bone vertex frame texture bone -1 anim 0.500000 frame vertex
+-1 0.500000
+bone texture
+0.500000 =
+bone 0.500000 0.500000 texture bone frame
+= = texture frame bone 0.500000 1.0 bone
+= = 1.0
+frame frame 1.0 vertex
+1.0 = texture bone anim material frame -1
+-1 vertex anim -1 anim
+bone bone vertex -1 anim
+0.500000 0.500000 frame vertex bone
+1.0 bone
+anim
+0.500000 anim bone vertex vertex vertex = bone texture bone bone -1 texture vertex vertex
+0.500000 bone material anim frame texture 0.500000
+material -1 vertex = material
+vertex = bone texture 1.0 bone 0.500000 frame
+anim 1.0 0.500000 -1 material material bone texture 1.0 =
+1.0 frame 1.0 vertex
+0.500000 0.500000 1.0
+0.500000 vertex = vertex =
+1.0 frame vertex 1.0 texture -1 frame 0.500000 bone frame bone texture 1.0 anim texture 1.0
+anim
+material
+=
+0.500000 anim
+material
+bone frame 0.500000 texture
+material
+bone 1.0 =
+frame 1.0 = 0.500000 1.0
+anim
+1.0 vertex -1 anim texture frame texture 0.500000 frame 0.500000 bone
+0.500000 -1 bone 1.0
+bone anim material anim material
+vertex = 0.500000
+texture bone bone vertex
+frame material texture 1.0 material texture
+bone 1.0 1.0 material 1.0
+texture texture 0.500000
+material
+bone -1 0.500000 -1
+frame
+frame vertex bone material
+-1
+vertex frame
+vertex texture = 0.500000 = vertex vertex 0.500000 texture vertex
+texture material 1.0
+0.500000
+= vertex texture
+material anim
+vertex = 1.0 bone 0.500000
+bone vertex
+-1
+0.500000 anim 1.0 1.0 1.0
+bone vertex
+0.500000 vertex 1.0
+0.500000 1.0 -1 anim vertex = 1.0 texture = texture 0.500000 =
+frame -1 texture anim 0.500000
+= texture -1 1.0
+texture
+vertex texture bone material anim
+anim = -1
+1.0 = texture
+1.0 1.0 texture =
+frame frame anim 1.0 -1 1.0 anim =
+1.0 bone 1.0 frame
+-1 texture 1.0 = texture texture bone 1.0 material
+anim vertex material texture = anim frame -1 1.0 1.0
+-1
+-1 anim
+vertex texture anim 0.500000 -1 1.0
+vertex texture
+-1 -1 bone
+frame 0.500000 -1 vertex frame
+bone
+=
+texture bone -1
+0.500000 = texture material anim anim
+frame texture
+1.0 bone texture material frame vertex anim
+= anim texture
+1.0
+material
+= texture material texture anim bone bone
+bone 0.500000
+frame
+-1
+0.500000 = -1
+bone
+bone bone
+-1 -1
+0.500000 material -1 material
+texture
+material texture 1.0 texture bone bone vertex 1.0 1.0
+1.0 bone
+0.500000
+texture vertex -1
+1.0 a
\ No newline at end of file
@@ -0,0 +1,46 @@
+texture 0.500000 anim
+frame
+= texture anim anim frame anim frame material 0.500000 0.500000 texture anim
+vertex
+-1
+1.0 0.500000 texture
+anim
+texture vertex 0.500000 material -1 -1 = 1.0 bone -1 anim material
+vertex
+vertex bone texture
+-1
+0.500000 -1
+vertex
+= = texture 1.0
+texture vertex
+0.500000 0.500000 1.0 =
+0.500000 -1 0.500000 bone 1.0 frame bone material anim vertex -1 vertex frame texture
+anim frame 0.500000 vertex 0.500000 0.500000
+1.0 bone -1 frame
+frame =
+texture bone -1 -1
+-1 -1 anim -1 bone -1 texture
+= frame
+vertex anim frame anim 1.0 texture anim
+frame 0.500000 1.0 material frame material vertex anim texture
+-1 anim =
+0.500000 vertex
+anim texture frame anim
+0.500000 frame -1
+= vertex
+0.500000 = anim frame
+vertex
+bone
+1.0 = 0.500000 = anim texture frame bone -1 frame 0.500000
+bone
+vertex bone material vertex -1 vertex frame vertex 0.500000
+-1 anim anim
+frame bone material texture
+frame = material bone 1.0 material frame 1.0 anim 1.0
+0.500000 vertex 1.0 material 1.0 -1 material
+1.0 vertex anim material 0.500000 anim -1 0.500000 -1 1.0 material = texture 0.500000 bone bone vertex texture bone 1.0
+0.500000 material vertex texture 1.0 1.0 vertex
+0.500000 bone bone vertex anim frame = =
+material frame anim = bone 1.0
+frame 1.0
+texture material -1 0.5000
\ No newline at end of file
@@ -0,0 +1,42 @@
+1.0 frame texture frame
+texture 0.500000
+texture anim = vertex material -1 = material bone 0.500000 anim bone
+1.0 material 0.500000
+1.0 vertex bone anim frame
+-1 -1 = material -1
+0.500000 = vertex
+frame frame =
+texture material =
+1.0 0.500000 material
+frame = 0.500000 0.500000 bone bone = material
+= bone
+0.500000 = texture frame frame
+= texture
+vertex
+0.500000 bone 1.0 = anim vertex anim anim
+= bone anim bone vertex =
+0.500000 0.500000 0.500000
+anim vertex
+anim 1.0 0.500000
+anim = frame
+1.0 vertex
+texture material
+bone
+=
+texture vertex -1 -1 vertex = vertex =
+anim =
+-1 texture
+1.0 frame bone 0.500000
+-1 0.500000
+= texture bone bone frame
+anim frame
+0.500000 texture material = frame
+-1
+= anim = 1.0
+= -1 vertex
+material
+-1 vertex texture bone anim frame material = frame 0.500000 1.0 = 0.500000 material
+anim 1.0
+material =
+1.0 = texture
+textu
\ No newline at end of file
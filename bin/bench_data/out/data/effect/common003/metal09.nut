@@ -0,0 +1,344 @@
+texture bone 0.500000
+1.0 1.0 -1 texture
+-1 -1 material 1.0
+frame frame
+vertex
+texture 1.0
+0.500000 frame texture 0.500000 0.500000 bone 1.0
+0.500000 frame anim
+texture bone texture material bone vertex material vertex material -1 frame 0.500000 anim anim bone texture frame 0.500000 vertex bone
+-1
+-1 1.0 = anim -1
+material = frame
+-1 bone 1.0 0.500000 bone 0.500000 texture texture
+texture material -1
+anim -1 0.500000 -1
+bone 1.0 material = material material texture
+1.0 anim -1
+frame
+0.500000 texture
+frame anim texture bone
+bone = material -1 texture -1 frame
+1.0 texture
+1.0 bone material frame =
+bone 1.0
+0.500000 material
+= 1.0 anim -1
+vertex =
+-1 material bone -1 vertex 0.500000 anim 1.0
+0.500000 anim frame = 0.500000 material
+texture anim
+= bone = -1 anim = vertex anim texture 0.500000 bone vertex = 1.0 frame = texture -1 bone 1.0
+=
+texture
+-1 frame texture 0.500000
+texture
+anim vertex -1
+anim anim 1.0 0.500000
+frame material anim
+material
+=
+frame vertex bone
+bone 0.500000 texture texture anim -1 texture texture 0.500000 texture
+= 1.0 frame =
+texture vertex anim -1 bone
+texture bone frame =
+1.0 material 0.500000 vertex
+vertex frame -1
+texture 0.500000
+0.500000 = 0.500000 1.0 material material anim
+anim
+bone bone -1 frame vertex bone 0.500000 0.500000 = material = frame -1 1.0 -1 -1 bone -1 anim 1.0 material
+frame bone
+bone 0.500000 0.500000
+-1
+1.0 texture
+0.500000 anim
+anim
+1.0 1.0 0.500000 0.500000 =
+material
+0.500000 vertex
+anim texture texture material 0.500000 0.500000
+anim
+-1 -1 0.500000 -1
+0.500000 bone frame
+0.500000 bone 1.0 = material 0.500000 material vertex frame = 1.0 0.500000 = -1 texture vertex material
+vertex
+frame frame material texture 0.500000 frame frame 0.500000
+bone material
+1.0 -1 texture anim vertex vertex 0.500000 vertex
+-1 vertex texture material bone material bone 0.500000
+material bone -1
+vertex vertex texture =
+1.0 frame bone material anim vertex vertex texture vertex
+material material anim bone -1 frame anim 1.0 texture
+= texture frame -1 1.0
+anim anim -1 bone 1.0
+bone material material = frame texture 1.0 -1 -1 material anim
+0.500000 texture bone 1.0 bone 1.0 1.0 =
+bone -1
+texture 0.500000 texture 1.0
+frame material material
+1.0 bone texture anim 1.0
+-1
+0.500000 1.0 texture anim
+bone material
+texture anim -1 material frame -1 vertex
+anim
+bone 1.0 texture material frame
+frame material = material
+0.500000
+texture 1.0 -1 vertex -1 anim frame
+texture -1 material
+vertex
+anim vertex anim
+frame texture 1.0 =
+anim
+material vertex anim = -1 anim anim frame texture
+=
+vertex anim bone
+-1
+anim bone 1.0
+1.0 1.0
+vertex
+1.0 1.0 = frame 0.500000
+1.0 texture 0.500000
+1.0 frame texture bone
+0.500000 material =
+material
+texture anim material -1 material anim 1.0 -1 texture bone anim
+-1 1.0 1.0 =
+=
+frame
+-1 material bone =
+texture
+1.0 material 0.500000
+material 1.0 texture
+texture = anim = anim
+-1 -1 1.0 frame 0.500000
+frame vertex
+frame frame
+-1 = 0.500000 vertex
+texture
+texture bone bone
+= texture 1.0 anim 0.500000 anim
+0.500000 vertex -1 vertex
+texture texture
+material bone texture
+bone
+bone = 1.0
+texture vertex frame
+anim vertex 1.0 material frame anim -1 texture = 0.500000 -1 anim frame
+anim
+frame
+bone anim material bone anim
+bone = texture frame
+0.500000
+texture frame
+texture 0.500000 bone material material material anim frame -1
+0.500000 -1 material
+= frame texture texture bone bone
+0.500000 1.0
+= vertex texture vertex =
+-1 vertex = = 0.500000 -1 -1
+anim
+1.0 anim
+1.0
+vertex texture 0.500000 texture
+texture
+bone 1.0 vertex material -1
+-1 anim frame material anim -1 texture = anim texture
+texture
+anim
+texture anim texture 1.0
+material vertex
+0.500000 material 1.0 frame -1 anim
+-1 anim =
+1.0 material material anim material
+-1 -1 = = = = vertex texture
+material bone
+vertex anim frame anim
+= = bone vertex 1.0 frame
+0.500000 -1
+0.500000 -1 -1 -1 anim 0.500000
+-1
+anim material
+anim
+anim anim 0.500000
+texture anim texture texture
+anim 0.500000
+1.0 texture material anim
+texture anim
+vertex texture 0.500000 0.500000 vertex bone bone = vertex anim -1 vertex anim
+0.500000 bone bone
+0.500000
+texture
+bone bone 0.500000 1.0
+vertex 1.0
+texture material vertex frame
+0.500000
+0.500000
+frame vertex anim texture texture bone material vertex =
+anim vertex 1.0 -1
+anim
+texture 1.0 anim 0.500000 anim 0.500000 frame vertex frame anim material
+bone
+1.0 0.500000
+-1 = texture 0.500000
+anim
+anim 1.0 anim
+-1
+0.500000 0.500000 0.500000 frame vertex vertex frame
+= frame frame 0.500000 anim
+-1 bone material 0.500000
+= -1 1.0
+frame -1
+anim material bone 0.500000
+0.500000 -1 0.500000
+frame vertex texture bone material
+0.500000
+material texture anim
+=
+vertex anim = material bone
+0.500000
+-1 1.0 -1 material material 1.0 bone vertex vertex material
+vertex
+material
+texture
+-1 texture 1.0
+=
+material
+1.0 bone frame anim =
+material anim
+-1 1.0 anim material anim
+frame frame
+anim bone anim bone
+texture 0.500000 bone -1 anim 1.0 0.500000 0.500000
+vertex material 0.500000
+material
+bone 0.500000
+0.500000 = 0.500000
+1.0 = material 0.500000 bone bone material 1.0 material
+anim anim texture
+1.0 -1 = vertex -1 anim = 1.0 bone 0.500000 =
+texture = 0.500000 texture
+-1 1.0 material vertex vertex 0.500000 material
+1.0 bone texture anim material anim
+frame
+anim texture
+= -1 =
+= 0.500000 vertex texture vertex 1.0 vertex 0.500000 -1
+vertex
+frame material
+vertex frame bone
+material 1.0 material frame
+=
+= -1 texture material vertex vertex
+anim
+anim vertex
+vertex 1.0
+bone vertex material
+bone texture frame vertex bone texture
+anim -1
+0.500000 material
+anim vertex
+bone = -1
+anim
+bone -1 frame
+anim frame bone material
+0.500000 bone = bone material bone
+anim vertex texture
+frame
+= -1 bone material material 1.0 texture 0.500000 vertex 0.500000
+0.500000 0.500000 = anim 1.0 1.0
+vertex material 1.0 frame 1.0
+material
+= texture = bone material texture
+= 1.0 0.500000 -1 vertex
+anim anim texture 0.500000 material anim
+vertex
+material -1 frame
+=
+bone anim texture vertex = -1
+1.0
+1.0 = material
+frame
+texture anim texture texture anim
+frame 1.0 frame anim
+= -1 bone texture bone
+texture 0.500000 -1 frame frame vertex bone
+1.0
+anim vertex vertex texture =
+frame
+frame frame
+-1 0.500000 bone texture 1.0 = anim
+frame
+1.0 bone
+material material anim
+bone 0.500000 -1 texture material vertex texture vertex
+1.0
+texture bone material material
+1.0 texture frame texture 0.500000 material vertex = bone
+material texture anim = texture vertex -1 frame
+0.500000
+0.500000 0.500000
+1.0 -1 material material texture 0.500000 -1 1.0 material bone texture
+1.0 = = 0.500000 0.500000
+frame
+material 1.0 texture 0.500000 = texture frame bone bone frame anim 0.500000 = material texture anim vertex bone material
+= 1.0 = -1
+=
+frame 0.500000 1.0 vertex texture 0.500000 texture 0.500000 bone 1.0
+bone bone 1.0 frame
+1.0 -1 0.500000 bone 1.0 texture material
+anim vertex anim
+frame
+-1 -1 1.0
+1.0 vertex -1 texture anim =
+texture 0.500000 bone -1 bone material texture =
+bone frame texture
+texture = 1.0
+0.500000 frame
+anim frame bone = bone anim material
+bone
+anim anim -1
+vertex
+0.500000 frame anim
+frame
+texture material anim =
+anim -1 vertex -1 1.0 vertex material anim
+texture bone anim
+0.500000 1.0 material frame vertex material anim
+material vertex texture frame texture vertex material bone -1 material texture 0.500000
+=
+1.0 0.500000
+frame anim 0.500000 bone
+frame
+frame bone
+texture anim frame texture material frame anim material texture
+frame material
+frame
+-1 anim anim vertex
+0.500000 frame texture frame texture material
+bone -1 = 1.0 1.0
+anim 0.500000 bone anim =
+material 0.500000 bone anim
+material vertex
+texture anim 0.500000 bone bone -1 frame
+material anim anim texture -1 texture bone frame
+material bone
+0.500000 vertex = vertex
+material vertex vertex frame frame anim anim bone vertex 1.0 anim
+-1
+bone
+-1 1.0
+vertex bone texture
+1.0
+= 1.0 vertex
+bone material frame
+0.500000 1.0 vertex vertex =
+1.0 1.0 0.500000 texture
+material bone anim 0.500000
+vertex texture anim
+vertex
+texture anim material 
\ No newline at end of file
@@ -0,0 +1,15 @@
+vertex 0.500000 anim vertex -1
+=
+anim
+anim bone material anim anim
+texture
+-1 texture texture frame
+vertex anim
+anim
+0.500000 anim =
+vertex 1.0 vertex bone 0.500000 anim texture vertex vertex
+material 0.500000 material
+-1 bone
+frame texture material 1.0 frame
+0.500000 = vertex 1.0
+0.500000 texture vertex bon
\ No newline at end of file
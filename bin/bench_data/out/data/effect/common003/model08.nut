@@ -0,0 +1,4 @@
+0.500000
+material material anim
+vertex vertex -1 anim frame frame anim anim vertex 1.0 =
+-1 anim anim
\ No newline at end of file
@@ -0,0 +1,27 @@
+1.0 texture anim
+anim frame 1.0
+0.500000 anim 1.0 -1 anim
+-1
+anim anim vertex material
+frame material anim
+= 1.0 material 0.500000 frame
+anim = -1 1.0
+=
+vertex frame material =
+texture
+material bone 1.0 -1
+material texture -1 -1 1.0
+texture = 0.500000 material 0.500000
+0.500000 bone
+= -1
+bone material =
+frame
+1.0
+-1 vertex
+bone bone
+anim -1 0.500000 frame material frame
+1.0 vertex texture 1.0 -1 frame 1.0
+material
+-1 vertex vertex
+vertex 1.0 -1
+= frame bone vertex = bone texture material material frame 0.500000 vertex texture material frame vertex frame material texture texture b
\ No newline at end of file
@@ -0,0 +1,53 @@
+anim 1.0
+0.500000 = bone -1 -1 vertex = texture 0.500000 anim bone 1.0 bone anim bone frame
+vertex vertex 0.500000 0.500000 -1 vertex vertex
+vertex texture 0.500000 anim
+-1 = material -1 frame vertex vertex anim
+0.500000
+texture 1.0 texture vertex -1 frame
+vertex anim bone material 1.0 vertex
+bone =
+frame anim bone
+1.0 =
+frame anim bone anim -1
+bone = 0.500000
+texture
+bone -1 texture 0.500000 -1 texture material frame frame = texture -1 frame anim -1 anim =
+frame texture material vertex anim texture 0.500000 1.0 = 0.500000
+1.0 1.0 frame anim
+bone material 0.500000 vertex texture bone texture -1 anim frame -1 -1 = -1 material
+-1 material texture 1.0 bone 1.0
+0.500000 1.0 1.0 vertex frame anim bone frame 1.0
+vertex 1.0 = frame frame 1.0 frame 0.500000 texture = bone vertex anim anim =
+material vertex vertex
+-1 0.500000
+texture
+texture anim frame
+frame
+bone
+1.0
+frame texture material texture material
+-1 -1 anim 0.500000 1.0 0.500000 anim 1.0 frame texture bone =
+texture
+0.500000 frame frame
+= bone -1 bone
+vertex bone
+frame = 0.500000 -1 anim anim
+texture -1 =
+frame -1 vertex -1 anim 1.0 0.500000 =
+= -1 frame material material
+-1 anim
+vertex bone
+texture
+bone vertex
+-1 = vertex material material
+material
+anim bone -1 -1 = texture -1 -1 vertex 1.0 vertex
+anim anim bone material
+= bone bone 1.0 =
+material vertex material 0.500000 material vertex anim
+texture frame material
+-1
+bone bone 0.500000 bone frame 0.500000 = bone 0.500000 0.500000 -1 frame
+= 1.0 1.0
+anim = -1 1.
\ No newline at end of file
@@ -0,0 +1,14 @@
+bone texture bone anim frame material vertex
+frame -1 1.0
+anim frame
+= texture 1.0 =
+0.500000 -1 texture texture -1 bone 0.500000 vertex vertex 0.500000 material vertex bone anim anim frame 1.0
+1.0 anim anim anim
+texture material texture =
+anim texture frame
+1.0 texture
+0.500000
+-1
+material bone
+1.0 =
+material -1 texture bone 0.500000 texture 1.
\ No newline at end of file
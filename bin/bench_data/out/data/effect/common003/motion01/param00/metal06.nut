@@ -0,0 +1,168 @@
+anim -1 material -1 frame vertex
+-1 anim
+-1 anim -1 0.500000 texture
+anim anim 1.0 anim
+material texture -1 = anim anim
+1.0 =
+anim
+frame vertex frame anim anim vertex
+anim = material = material vertex 1.0 = vertex frame 0.500000 0.500000 =
+= bone
+-1 vertex
+frame anim 1.0 = 0.500000 0.500000 material
+1.0
+frame
+= 0.500000 -1 0.500000 anim material = material anim = -1 texture -1
+0.500000 frame material
+bone bone frame = frame anim 1.0 anim material 1.0 1.0 texture material vertex
+vertex 1.0
+0.500000 anim texture anim 0.500000 0.500000
+anim
+bone material
+material 0.500000 frame 0.500000
+anim 0.500000 texture bone
+bone
+bone
+0.500000 texture frame 1.0 -1
+1.0
+vertex -1 frame bone
+-1
+anim = frame
+0.500000 1.0 texture anim = anim vertex 0.500000 material frame anim 0.500000
+= texture vertex frame 1.0 material vertex material texture 0.500000 =
+texture bone anim anim
+material anim 0.500000 -1
+1.0 vertex = =
+frame frame
+1.0 anim texture
+= vertex material texture
+= bone
+= texture -1 bone
+texture
+vertex material -1
+anim -1
+texture 0.500000 material material anim 1.0
+-1 anim vertex 0.500000 texture
+vertex anim 1.0 vertex anim 1.0
+texture
+-1 -1 1.0 bone bone frame texture texture bone texture material bone 1.0 bone frame = 1.0
+frame material anim anim 1.0 1.0 =
+material -1
+material
+anim bone anim material
+material = 1.0
+anim texture texture material vertex 1.0
+frame frame
+1.0
+1.0 0.500000
+frame =
+1.0
+frame
+frame frame
+texture vertex =
+frame
+material
+bone anim 1.0 bone
+texture 0.500000 0.500000 frame
+=
+0.500000
+frame -1
+=
+= anim material bone
+-1 = bone texture material texture material
+0.500000 0.500000 frame -1
+-1 anim
+1.0
+texture -1 bone material = material
+material frame 1.0
+1.0 0.500000 1.0 bone 1.0 vertex 0.500000 vertex frame frame =
+vertex = 1.0 frame 0.500000 frame
+frame bone 0.500000 frame
+vertex -1 0.500000 texture -1 = anim texture texture material bone =
+material 1.0 0.500000 frame = material -1
+material anim anim 1.0 1.0 0.500000 -1
+0.500000
+anim
+1.0
+= 0.500000 0.500000
+0.500000 material bone bone texture
+1.0 frame
+material material frame frame -1 = anim
+-1 -1 -1
+= bone frame material material -1
+vertex anim 1.0 = anim 0.500000
+-1
+texture 1.0 vertex 1.0
+-1 0.500000
+texture anim 1.0 bone = texture vertex -1 vertex material bone = anim 1.0 frame bone = anim -1 anim 1.0
+frame
+vertex frame
+material bone
+texture bone
+bone
+0.500000 texture bone 0.500000 = 0.500000 0.500000 material
+= -1 vertex
+texture texture
+1.0
+material = 0.500000 material frame = bone
+anim
+texture 1.0 vertex 0.500000
+material 1.0 texture -1
+texture = -1 texture 0.500000 = = anim vertex 0.500000
+-1 = 1.0 vertex = frame 1.0 texture =
+frame
+anim frame 0.500000 frame texture 1.0
+frame
+material vertex texture material vertex
+0.500000 bone vertex frame frame -1 0.500000 bone 0.500000
+anim material 0.500000 bone 0.500000
+-1 bone 1.0 bone 1.0 bone 1.0 = texture 0.500000 = anim 1.0 0.500000 1.0 texture
+= vertex texture 0.500000 material -1 vertex anim vertex bone material
+-1 frame anim = = 0.500000 0.500000 1.0 =
+0.500000 = -1
+texture anim anim
+material
+vertex
+frame 0.500000 texture anim 1.0
+frame frame frame texture = -1 =
+bone
+anim texture -1 texture
+bone 1.0 bone -1 -1
+0.500000
+=
+frame 1.0 vertex 1.0 material vertex texture 1.0 texture anim bone
+vertex = 0.500000
+material frame
+0.500000 vertex frame = -1 material material
+texture frame bone -1
+texture material texture
+frame = texture texture
+anim material material 1.0 material
+anim
+bone 0.500000 texture
+anim texture
+-1 texture 1.0
+frame bone 1.0 texture material texture = -1 vertex bone 1.0
+= = vertex
+0.500000 1.0 bone texture anim 1.0 material bone -1 material frame vertex anim frame -1 texture material
+1.0
+-1 frame 1.0 frame 0.500000 material = 0.500000 texture
+= anim
+texture vertex -1 texture
+bone anim
+frame 1.0 0.500000
+material anim frame
+material 1.0 0.500000 vertex -1 bone anim
+-1 frame
+texture vertex
+= anim texture 1.0 texture
+-1 -1 frame vertex
+anim frame
+vertex
+anim 1.0
+bone -1
+texture 0.500000 = = material
+texture bone texture 1.0
+material texture = vertex 0.500000 1.0
+=
+material 1.0 bone bo
\ No newline at end of file
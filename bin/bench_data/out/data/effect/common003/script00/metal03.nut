@@ -0,0 +1,16 @@
+=
+vertex anim 0.500000 frame texture frame =
+-1 0.500000 vertex 1.0 vertex
+anim
+vertex vertex
+material vertex -1
+bone vertex
+vertex bone 0.500000 0.500000 anim texture -1 bone anim 0.500000
+bone vertex
+-1 anim -1 1.0
+= material -1 bone texture vertex vertex frame -1 texture 0.500000 material frame anim 1.0
+texture material
+vertex -1 1.0 frame
+1.0 =
+-1 = = -1
+frame -1 0.5
\ No newline at end of file
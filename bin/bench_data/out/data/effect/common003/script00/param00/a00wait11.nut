@@ -0,0 +1,14 @@
+0.500000 = 1.0 anim =
+1.0 bone
+-1
+frame material texture bone 1.0 material 1.0 0.500000
+material -1
+1.0 anim vertex anim frame anim frame 1.0
+texture material bone -1 0.500000
+vertex frame texture 0.500000 material -1
+0.500000
+texture = material -1 texture
+texture =
+bone
+material vertex
+1.0 = material anim
\ No newline at end of file
@@ -0,0 +1,245 @@
+1.0 bone anim
+material
+anim 1.0 = vertex 1.0 material vertex anim 1.0 texture texture
+frame = -1 anim bone
+anim bone vertex
+= texture material 0.500000 1.0 = material material
+= 1.0 texture anim 1.0 0.500000
+bone anim
+-1 0.500000 = material
+= texture
+=
+-1 texture frame =
+frame
+1.0 anim
+frame texture bone material -1 material anim
+frame 0.500000 texture
+0.500000
+material frame texture material -1
+bone vertex vertex bone
+= vertex texture -1
+material frame material material -1 anim
+texture anim
+material = texture vertex
+anim material frame 1.0 frame anim material bone frame
+vertex = anim
+anim anim bone 0.500000 vertex 0.500000 = 1.0 -1 bone anim material
+texture anim vertex bone vertex
+anim
+texture
+-1
+-1 texture texture
+vertex vertex bone -1 0.500000 bone frame material bone
+= frame bone material
+material material -1 = frame material texture frame vertex texture vertex frame =
+bone material frame frame texture vertex frame vertex vertex
+anim material vertex 0.500000
+material vertex frame vertex
+material frame
+frame bone
+= -1 texture 0.500000 0.500000 1.0 = 0.500000 bone frame 1.0 -1 0.500000 vertex = material material bone
+vertex vertex
+bone 0.500000 frame
+vertex anim texture
+-1
+= bone frame
+texture
+= 0.500000
+0.500000 0.500000 vertex = anim 1.0
+-1 = vertex =
+0.500000 vertex bone
+0.500000 1.0
+= 0.500000
+0.500000 bone bone
+bone 1.0
+material bone = 1.0 frame bone frame
+0.500000
+texture texture
+0.500000
+vertex vertex vertex anim 1.0
+anim 1.0 frame = 1.0 =
+0.500000
+texture anim =
+bone
+0.500000 = frame
+vertex bone bone = frame material texture material
+texture 1.0 0.500000 anim 1.0 bone texture
+0.500000
+-1
+= 1.0 vertex bone = =
+material = texture
+-1 -1 vertex = anim
+-1
+0.500000 anim
+frame bone material frame 0.500000 0.500000 vertex
+1.0 = = frame material texture material material 1.0 material -1 bone
+-1 material 1.0
+material vertex
+= anim material
+vertex 0.500000 vertex texture frame 1.0 bone bone 0.500000 frame
+frame 1.0 -1 frame bone texture bone
+material 0.500000
+frame vertex material material
+1.0
+bone
+1.0 1.0
+texture = 0.500000
+material
+0.500000 bone texture material =
+frame = 1.0 1.0 vertex
+bone 0.500000 1.0 frame 0.500000 frame texture texture material -1 0.500000 = bone 0.500000 0.500000
+bone
+material texture
+anim bone anim -1 = vertex
+-1 material = vertex 0.500000 vertex = material
+bone
+bone 0.500000 -1 vertex vertex 1.0
+-1 vertex frame 1.0
+texture vertex anim vertex vertex frame = texture material = -1 0.500000 -1 texture
+texture = texture
+frame
+vertex 1.0 -1 vertex -1 anim material
+vertex frame
+anim bone vertex vertex
+-1
+-1
+material
+bone
+vertex = material vertex texture vertex frame
+-1 -1 =
+frame
+material 0.500000 frame bone = 1.0
+-1 bone
+0.500000
+vertex
+texture texture
+= frame 0.500000 1.0
+1.0
+bone 0.500000 = vertex texture anim material 1.0 frame vertex = 1.0
+texture 1.0 bone 0.500000 0.500000 0.500000 bone anim
+texture frame vertex
+vertex 0.500000 frame material
+0.500000 0.500000 1.0 -1 =
+= 1.0 bone
+material bone bone = vertex
+0.500000 frame anim 1.0 = material = material material = 0.500000 = vertex anim bone = bone material
+texture anim bone
+= -1 =
+vertex 0.500000 vertex
+frame
+-1
+= = anim texture =
+texture texture 0.500000 frame
+material anim -1 = -1 texture
+0.500000 bone -1 texture vertex
+0.500000
+material bone material -1 -1 bone = material
+0.500000
+anim bone 0.500000
+-1 texture = bone frame -1 anim material 0.500000 1.0 0.500000 anim texture anim -1
+bone -1 texture 0.500000 anim 0.500000 1.0 -1
+anim
+vertex 1.0
+anim
+-1 anim vertex texture
+vertex =
+texture anim bone vertex = =
+texture
+texture vertex frame anim texture material anim frame vertex
+1.0 material frame 0.500000 0.500000
+bone = = = anim texture bone
+frame 0.500000 -1 material frame
+vertex 0.500000
+vertex
+texture
+vertex
+-1 frame
+material frame vertex
+bone
+frame
+1.0 = 1.0
+-1
+-1 0.500000 1.0 = texture material
+-1 = bone 0.500000 1.0 -1 vertex frame frame frame bone bone frame texture
+1.0 bone
+frame material material vertex 0.500000 frame -1 -1 -1 frame material frame
+0.500000 texture
+bone
+material -1 bone bone
+-1 = vertex texture
+anim anim bone bone
+material -1
+= frame
+anim -1 anim
+texture
+anim
+1.0 bone material 1.0 1.0
+vertex = frame -1
+= texture = anim bone -1 1.0 texture bone
+=
+-1 material -1 vertex material bone
+= 0.500000 -1 material -1 material anim material
+vertex 0.500000
+frame = 1.0
+anim texture bone 1.0 texture bone 0.500000 vertex texture
+-1 frame
+1.0 bone
+=
+=
+bone vertex material material frame
+texture bone 1.0 anim
+material 1.0
+frame = bone
+0.500000 vertex 0.500000 =
+= 1.0 material frame texture 0.500000 material material
+=
+texture 0.500000
+texture bone =
+frame bone 1.0 frame -1 vertex 0.500000 1.0 frame anim texture
+texture = -1 frame 1.0 vertex material = texture material bone = 0.500000 material -1 texture
+vertex
+1.0
+=
+material texture texture
+vertex 1.0 texture
+texture anim bone
+-1 bone 0.500000 texture 0.500000 material
+texture
+anim anim
+frame frame vertex
+material 1.0 1.0
+vertex
+-1 0.500000 0.500000 -1 anim =
+texture texture material material
+=
+anim
+vertex = bone 1.0
+1.0 frame anim frame 0.500000 1.0 vertex vertex vertex 0.500000
+0.500000 material vertex frame bone
+0.500000 1.0
+vertex bone bone material bone vertex 0.500000 material
+vertex frame texture
+anim
+= vertex frame material -1 vertex anim
+texture 1.0 -1 = vertex anim bone = 0.500000 bone = bone vertex bone -1
+1.0 anim anim = vertex texture vertex material anim 0.500000
+=
+frame anim vertex 1.0 1.0
+material frame 0.500000 texture
+1.0 texture frame bone vertex anim vertex bone anim anim material anim frame frame anim material
+material
+1.0 material
+1.0 1.0
+vertex frame texture texture 1.0 frame vertex anim
+anim = bone vertex vertex
+material anim 1.0
+texture 0.500000 1.0 =
+-1 material bone vertex material anim texture frame
+bone bone
+= frame bone frame -1 = = frame 0.500000 -1 0.500000 0.500000 material 1.0
+0.500000
+material anim frame texture -1
+vertex vertex
+bone
+material = 0.500000 anim
+= 0.500
\ No newline at end of file
@@ -0,0 +1,3 @@
+1.0 0.500000 1.0 0.500000 texture =
+texture frame
+-1 frame
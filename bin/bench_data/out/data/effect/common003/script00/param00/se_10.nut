@@ -0,0 +1,81 @@
+-1
+texture material material
+frame anim anim
+anim anim 1.0 1.0 anim
+bone
+vertex 1.0 vertex anim 0.500000 bone material
+material
+frame 0.500000 = = 1.0 texture 1.0 vertex vertex
+vertex
+vertex 0.500000 vertex
+vertex anim anim frame 1.0 = -1
+frame texture
+1.0 -1 texture vertex frame texture
+1.0
+frame -1 vertex
+= texture
+anim frame
+frame
+0.500000 vertex material 1.0
+bone material 1.0 texture material texture
+material
+anim
+texture
+texture frame material 1.0
+frame
+-1 1.0 = 1.0 anim -1 frame
+vertex
+-1 material texture -1 vertex material frame frame frame 1.0 1.0
+material texture
+frame 0.500000 frame -1 vertex frame material 1.0 0.500000 0.500000 -1
+anim
+=
+frame 1.0 0.500000 vertex 1.0
+material vertex
+material vertex frame bone
+0.500000 =
+0.500000 = frame 0.500000 = anim bone -1 -1 anim = frame texture
+bone
+bone
+vertex material
+= bone bone = bone
+texture anim
+= vertex =
+bone material
+1.0 bone
+= frame bone
+=
+texture -1
+0.500000 anim texture
+-1 anim -1 texture
+-1 material vertex vertex texture
+=
+material bone
+1.0 = 1.0 material -1 frame -1 -1 texture = 0.500000 vertex vertex 0.500000 texture =
+frame
+anim
+=
+bone frame
+material frame bone
+bone anim bone material -1
+material bone anim -1 material -1 =
+= material texture vertex
+frame
+texture
+material bone frame
+=
+vertex
+-1 frame vertex
+vertex bone anim
+vertex
+texture bone frame
+frame -1 anim
+bone 1.0 material anim = 1.0 anim -1 material vertex bone frame
+0.500000
+1.0 frame frame material = -1 =
+bone -1 1.0 = vertex bone
+-1 0.500000
+0.500000 -1 0.500000 bone 1.0 bone -1
+frame -1 -1 1.0
+bone
+fr
\ No newline at end of file
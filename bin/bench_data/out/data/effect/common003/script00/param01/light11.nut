@@ -0,0 +1,108 @@
+texture vertex
+texture material 1.0 -1 0.500000 anim
+= material 1.0
+bone vertex
+frame
+anim
+0.500000 frame frame material 1.0 frame
+anim 0.500000 = 1.0
+anim 1.0 -1
+-1
+-1 1.0 material
+frame material material
+bone -1 = texture -1 = 1.0
+material frame frame 0.500000 -1 vertex vertex texture material texture
+-1 0.500000
+frame 0.500000 =
+bone anim
+= 0.500000 vertex vertex -1 1.0 = 1.0
+1.0 -1
+-1 frame 0.500000 bone
+=
+anim material
+material texture anim texture vertex -1 anim
+anim anim = 0.500000 1.0 anim material anim
+-1
+1.0 anim
+0.500000
+= texture 1.0 material vertex 1.0 bone material bone
+material 0.500000 =
+-1 anim vertex
+1.0
+material 1.0 1.0 material 0.500000
+-1 0.500000
+material vertex frame
+1.0 =
+material = vertex -1 vertex frame
+bone anim anim
+= bone 0.500000 vertex = = material texture
+1.0 1.0 = anim material 1.0 anim =
+bone 0.500000 material 0.500000 0.500000
+texture
+1.0
+0.500000
+material frame texture anim = frame bone 1.0
+-1
+anim anim
+= material =
+texture
+1.0 -1
+0.500000 frame 0.500000 anim texture material texture
+0.500000
+1.0 material
+0.500000 vertex anim vertex material anim anim vertex
+vertex frame 0.500000 bone texture vertex frame frame texture
+-1 material
+vertex texture bone -1 = = 0.500000 1.0 frame
+frame -1 vertex =
+1.0
+vertex frame 1.0 0.500000 material = 1.0
+anim bone frame 0.500000 frame
+texture 0.500000 material texture bone
+texture material 0.500000
+0.500000 = texture texture vertex
+1.0
+1.0 texture anim frame
+material bone vertex anim 0.500000 frame 1.0
+0.500000 vertex -1 vertex vertex material
+0.500000 = material bone -1 -1 0.500000
+anim bone 0.500000 = -1 material bone -1 material
+frame bone material
+= 0.500000 anim texture vertex 0.500000 vertex -1 texture bone bone
+bone frame material 1.0 vertex material -1
+= material texture
+1.0 material texture bone vertex frame -1 0.500000 frame 0.500000
+vertex
+1.0 bone 1.0 bone frame -1
+-1 1.0
+material frame -1 vertex -1 bone frame vertex frame
+1.0 bone 1.0 bone anim frame = vertex bone
+anim texture frame
+0.500000
+0.500000
+anim -1 -1 texture 0.500000 = 1.0 = frame bone
+material texture
+material
+= vertex -1 texture texture
+0.500000 =
+bone = material
+-1 =
+bone 0.500000
+= 0.500000 vertex = -1 texture
+1.0 texture frame vertex
+anim frame
+frame
+texture 0.500000 = -1 bone
+material 0.500000 vertex material = bone texture -1 -1 = vertex anim -1
+-1 frame anim anim vertex
+= bone
+1.0 = anim vertex 0.500000
+anim texture 1.0 0.500000 anim vertex -1 anim = frame vertex anim
+1.0
+1.0 frame anim frame
+1.0 anim = bone 0.500000 1.0 vertex = 1.0 -1 material vertex
+texture
+anim
+vertex
+1.0 1.0 bone vertex
+texture
\ No newline at end of file
@@ -0,0 +1,10 @@
+texture vertex frame material bone material
+frame 1.0 anim 1.0
+= 0.500000 anim = = bone anim =
+-1 anim
+0.500000 texture -1 anim 0.500000 material 1.0 anim
+= texture =
+frame vertex material vertex 0.500000 texture vertex frame frame bone =
+vertex
+1.0 material texture anim 0.500000
+vertex
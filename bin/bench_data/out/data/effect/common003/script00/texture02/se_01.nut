@@ -0,0 +1,6 @@
+1.0
+material anim vertex
+frame -1 material anim frame
+frame 1.0 0.500000 1.0
+vertex vertex
+0.500000 texture 1.0 -
\ No newline at end of file
@@ -0,0 +1,24 @@
+texture 1.0 -1
+0.500000
+material anim vertex
+bone anim 1.0 anim 1.0
+-1 texture -1 = texture 0.500000 material anim frame = 0.500000 1.0 frame -1
+vertex 0.500000 0.500000
+anim vertex material material 1.0
+texture vertex anim
+texture vertex
+anim 1.0 0.500000 0.500000
+texture = = material
+= vertex anim 1.0 0.500000 anim texture
+texture
+vertex 1.0
+anim
+vertex texture
+material -1
+-1
+texture 0.500000 bone anim -1 anim material
+anim = 0.500000 1.0 frame
+anim
+0.500000 0.500000 -1 1.0 anim frame = vertex material 1.0 bone anim texture
+-1 frame anim =
+1.0 0.50
\ No newline at end of file
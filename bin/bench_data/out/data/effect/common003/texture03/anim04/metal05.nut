@@ -0,0 +1,35 @@
+anim anim -1 -1
+0.500000 bone
+0.500000 material
+1.0
+anim material
+material texture material 1.0 1.0
+0.500000 0.500000 -1
+vertex material -1
+vertex -1 = frame vertex 1.0
+anim
+anim 0.500000 = frame 1.0 texture texture texture 1.0
+-1
+= texture vertex vertex anim -1 material = 1.0 vertex vertex texture 1.0 -1 anim 1.0 1.0 frame = -1 vertex anim
+vertex bone anim frame
+bone
+= frame texture
+vertex -1
+= -1
+vertex texture texture material
+texture material
+-1 anim frame
+= -1 1.0 vertex 1.0 frame
+vertex vertex -1 0.500000 0.500000 texture frame bone = frame 1.0
+anim
+anim = frame 0.500000 0.500000 texture material vertex
+0.500000 frame
+material 0.500000 vertex
+anim bone texture frame
+vertex anim frame
+material frame 1.0 =
+bone vertex
+= anim material material bone = bone frame -1 frame vertex
+anim frame texture 1.0 material 1.0 1.0 0.500000 1.0 = 1.0 -1
+material
+1.0
\ No newline at end of file
@@ -0,0 +1,104 @@
+vertex
+-1 anim bone frame 0.500000 = anim 0.500000
+material material
+1.0
+frame anim
+texture material = =
+frame texture -1 frame
+vertex material material anim 0.500000 anim 0.500000 frame vertex = = bone anim -1 = = anim frame
+= anim
+1.0 -1 -1 0.500000 anim vertex bone
+bone
+material
+-1
+= -1
+anim = vertex
+material -1 material texture frame bone
+anim vertex
+=
+bone -1 vertex =
+texture
+vertex
+0.500000 vertex
+material = 0.500000 1.0 material texture texture = vertex vertex anim 0.500000 material = texture -1 anim bone anim
+vertex 1.0 = material = = texture anim
+1.0 frame anim
+bone 0.500000
+bone frame frame texture -1 frame 1.0
+0.500000 = texture -1 texture 0.500000
+1.0 = texture vertex
+frame = 0.500000 1.0 1.0 bone texture 0.500000
+vertex anim anim
+texture 0.500000 = texture = frame 1.0 material 1.0 material 0.500000 1.0 texture vertex
+0.500000 -1 material
+material frame anim vertex
+anim bone vertex bone 0.500000 0.500000 frame material 1.0 material
+vertex =
+0.500000 bone 0.500000 anim 1.0 material
+= 1.0 anim vertex
+material 1.0 0.500000 frame
+bone bone 1.0
+bone
+anim frame
+-1 = bone 1.0 vertex 0.500000 texture -1 = anim material
+bone material =
+anim
+=
+bone
+vertex
+texture bone material bone bone frame bone
+material
+0.500000 material = anim
+anim frame
+-1 texture frame -1 material bone
+texture bone material 0.500000 0.500000
+1.0 0.500000 material material frame bone bone bone texture 0.500000 = -1 vertex
+1.0 frame -1 material
+bone bone anim bone bone bone = frame vertex
+-1 bone anim anim 0.500000 texture vertex anim frame bone
+material
+=
+bone =
+-1 = frame
+=
+texture -1
+1.0 1.0 anim frame anim
+-1 = texture 0.500000 frame bone 0.500000
+material -1 0.500000
+texture anim bone vertex material
+0.500000
+=
+bone
+= = anim anim
+bone material = material
+frame
+1.0
+bone frame -1
+anim 1.0 frame frame 1.0 -1 = texture vertex anim
+vertex bone bone
+texture 0.500000 anim bone
+frame anim -1
+0.500000 bone
+vertex
+-1 material frame
+texture = = bone
+vertex = anim 0.500000
+material
+material
+texture bone bone 1.0 0.500000 0.500000 0.500000 material frame
+vertex bone
+1.0
+vertex 0.500000 frame
+vertex frame 0.500000 anim material
+-1 frame
+-1
+texture vertex
+1.0 bone vertex frame
+texture 0.500000 bone
+-1 material
+frame 1.0
+vertex
+texture bone texture texture frame anim frame texture = texture -1 = material bone
+1.0 vertex -1
+-1
+vertex = bone texture m
\ No newline at end of file
@@ -0,0 +1,8 @@
+1.0 texture = bone 0.500000 0.500000
+0.500000 bone frame
+0.500000 material =
+material 1.0 bone texture -1 texture
+-1
+= bone = frame
+1.0
+frame 0.500000 1.0 -1 -1 ve
\ No newline at end of file
@@ -0,0 +1,50 @@
+-1
+bone
+1.0 vertex anim vertex
+-1 -1 vertex texture bone 1.0 frame 1.0
+0.500000 1.0
+anim -1 anim anim material -1 bone texture vertex 1.0 material texture -1
+frame
+1.0 bone
+vertex material frame 1.0 -1 0.500000
+anim texture vertex frame vertex anim
+vertex
+material
+= anim vertex material =
+material 1.0 frame anim texture 0.500000 anim
+= = -1 0.500000 vertex = material
+vertex = vertex bone
+bone -1 -1 = =
+-1
+vertex 1.0 texture material anim bone bone
+-1
+0.500000 -1 1.0 1.0
+material bone material anim bone vertex 0.500000 frame vertex anim vertex 1.0 anim
+= 0.500000 1.0 -1
+-1
+-1 bone bone vertex
+frame
+material -1 frame -1
+anim
+bone 0.500000 frame 1.0
+anim
+bone vertex
+vertex material frame 0.500000 frame vertex
+0.500000 anim material
+vertex 0.500000
+anim bone bone 0.500000 vertex -1 material bone
+1.0 material
+1.0 texture texture texture 1.0 frame
+0.500000 vertex 0.500000 anim
+-1 vertex bone material anim =
+-1 -1 = frame material 0.500000 texture vertex vertex texture -1 = 1.0 material frame
+1.0 1.0 -1 anim material 0.500000 vertex 0.500000
+0.500000 -1 0.500000 frame frame
+anim bone anim 0.500000 texture anim 1.0
+frame
+texture frame
+0.500000 material 1.0 frame anim texture 0.500000
+material 1.0
+0.500000 1.0 material -1
+material anim bone
+-1 -1 bone 0
\ No newline at end of file
@@ -0,0 +1,279 @@
+-1 texture 0.500000
+anim texture material
+0.500000 material frame material texture bone frame texture 0.500000 anim material
+material frame
+frame
+texture
+0.500000
+anim vertex frame material
+texture
+anim material 1.0 anim 0.500000
+0.500000 -1 0.500000 texture frame vertex material material
+texture anim 0.500000 = material
+0.500000 -1
+1.0 1.0
+bone material texture bone
+1.0 frame vertex
+-1 vertex 1.0
+texture -1
+vertex vertex = -1
+anim
+anim material texture frame = frame 1.0 0.500000
+frame vertex
+bone vertex frame -1
+material
+vertex 0.500000 -1 bone frame -1
+frame 1.0 vertex bone
+= = 0.500000 material texture frame 1.0 0.500000
+bone texture anim -1 1.0 anim texture texture -1
+anim
+vertex =
+anim 1.0 -1 texture
+frame
+bone -1 material bone -1
+bone -1 texture
+0.500000 0.500000 0.500000 anim bone anim material vertex texture texture frame = texture texture bone -1
+1.0 anim -1
+-1 0.500000 vertex material =
+vertex
+material
+anim
+frame material vertex bone = vertex =
+texture anim frame
+1.0 anim = 0.500000 texture 1.0 -1 -1 1.0 0.500000 vertex texture anim vertex
+= material =
+1.0
+texture anim -1
+anim
+texture material texture material 1.0
+vertex
+bone frame anim
+material
+material material -1 bone vertex -1
+=
+0.500000 0.500000
+-1 material
+= texture
+texture vertex frame frame bone -1 vertex material frame vertex 1.0 texture
+material texture 0.500000 bone
+= 0.500000 frame
+anim frame material =
+= texture texture anim anim -1 material
+material -1 bone
+frame vertex material vertex 1.0
+0.500000 1.0
+1.0 frame =
+-1
+texture
+texture frame 0.500000 texture
+bone 1.0 = bone texture material texture -1 material
+1.0
+anim anim frame
+= bone bone
+anim
+1.0 -1 1.0 -1
+0.500000
+material
+1.0 material -1 frame 0.500000 vertex 0.500000 0.500000 texture bone vertex material
+1.0 bone
+frame 0.500000 =
+=
+= material
+anim frame
+vertex
+-1 frame -1 anim vertex texture -1 bone -1 frame 1.0 0.500000 vertex anim -1 bone vertex
+1.0 texture texture vertex vertex
+texture
+bone
+= 1.0
+0.500000
+bone bone texture 1.0
+1.0
+anim 0.500000 1.0 -1
+1.0 texture -1 texture material texture
+frame frame
+vertex vertex
+-1 material material frame frame bone material
+1.0
+1.0 material -1 vertex texture
+material vertex 1.0 = = frame anim
+texture
+0.500000 material texture 1.0 vertex anim
+bone =
+1.0 0.500000 0.500000 texture bone
+material =
+bone material 1.0 vertex material = = 1.0
+-1 material bone = texture
+0.500000 bone
+= 0.500000 anim = 0.500000 vertex -1 material = 1.0
+material
+anim
+vertex -1 texture
+bone
+material = -1
+frame
+bone
+texture bone
+material
+bone frame texture
+= 0.500000
+bone
+0.500000 -1 anim
+texture frame
+vertex bone = -1 -1 0.500000 bone =
+bone
+-1 frame
+vertex texture bone
+-1 frame 0.500000
+anim texture texture
+1.0 bone
+=
+material bone anim material -1 0.500000
+0.500000 -1
+-1 vertex
+anim
+anim
+-1
+1.0 -1 0.500000 -1 1.0 texture bone 1.0 frame anim 0.500000 = bone material 0.500000 -1
+texture
+anim anim
+= 1.0 texture texture frame
+frame 1.0 anim -1
+anim = = texture 0.500000 material =
+texture bone texture 1.0 frame texture anim 1.0 material
+anim 1.0 -1 texture frame = material vertex -1 bone texture frame anim anim vertex 1.0 texture vertex -1
+anim =
+bone 1.0 -1 texture 0.500000 bone material 0.500000
+texture
+frame material
+1.0 vertex -1 1.0 anim
+material material vertex material
+texture bone
+vertex texture
+frame
+bone vertex frame 1.0 anim anim frame -1
+1.0
+bone
+vertex
+texture
+frame texture texture bone
+anim anim
+bone bone vertex bone material
+1.0 0.500000 bone
+frame
+-1 anim = 1.0
+material anim
+0.500000
+texture frame texture material material -1 0.500000 texture 0.500000 -1 frame anim vertex = frame
+vertex -1
+frame anim = -1 texture = material 0.500000
+-1 0.500000 texture
+anim texture
+vertex material
+frame vertex 1.0
+texture = texture material material material
+bone vertex
+texture
+= 1.0 1.0 vertex anim material texture
+vertex vertex anim frame
+frame frame
+frame
+bone
+bone anim
+-1
+vertex frame 1.0 bone frame material -1 texture 0.500000
+= texture 1.0 bone = bone 1.0 frame 0.500000 -1
+bone anim =
+0.500000 -1 anim 0.500000 anim vertex -1 0.500000 vertex material anim = = texture
+-1 anim
+material 1.0 1.0 material 1.0 bone = 0.500000 0.500000 0.500000
+0.500000
+frame 1.0 bone 0.500000 vertex
+vertex material anim vertex -1 = texture anim
+= frame anim vertex
+frame bone
+1.0 vertex
+-1 vertex = anim material anim frame vertex 0.500000 1.0 =
+1.0 frame bone -1 bone texture
+frame anim
+-1 bone anim 1.0
+bone = anim
+texture
+anim vertex bone
+anim
+bone
+material 0.500000 0.500000 texture 1.0 -1 0.500000
+bone texture
+texture -1 1.0 = bone -1
+= anim
+bone
+0.500000 anim
+1.0
+anim texture -1 -1 vertex 0.500000 anim = anim
+1.0 = vertex 1.0 vertex frame 1.0 material
+= 0.500000
+0.500000 1.0 0.500000
+frame material material texture anim = bone texture
+texture bone -1
+frame frame texture 0.500000
+0.500000 1.0 1.0 1.0 texture texture
+1.0
+1.0 bone -1
+frame vertex vertex 1.0 material
+1.0 frame 0.500000 anim 1.0 vertex material 1.0 1.0
+= material bone 0.500000
+0.500000 -1 1.0 material
+-1 frame frame anim
+1.0 bone 1.0 frame
+texture frame material frame frame -1
+vertex frame 0.500000 0.500000 anim
+vertex bone material vertex
+-1 bone = -1 1.0 material
+bone
+1.0 1.0 =
+anim -1 1.0 anim
+vertex anim material 0.500000 -1 0.500000 bone anim anim = texture material vertex
+= vertex
+vertex anim material anim bone -1 vertex
+anim
+anim = frame -1 texture bone
+vertex frame
+frame
+anim texture
+frame texture
+bone
+anim -1 0.500000 bone =
+anim 0.500000 material
+anim 1.0 bone -1
+material bone 1.0
+anim -1 frame frame vertex -1 anim 1.0 0.500000 0.500000
+1.0 vertex material 1.0 = frame -1 =
+vertex bone vertex -1 0.500000 anim 1.0 0.500000 anim
+0.500000
+anim vertex material
+material texture material = texture
+bone
+vertex material
+frame
+= anim vertex vertex vertex
+vertex
+anim vertex
+vertex 0.500000
+anim texture 0.500000
+material frame vertex material anim -1 = = vertex vertex frame vertex
+texture
+texture bone
+1.0 texture vertex -1
+texture -1 vertex bone material 0.500000 anim frame texture
+1.0 bone 1.0
+anim
+material frame -1 0.500000 frame
+=
+frame bone anim material anim anim material 1.0
+-1 -1 -1
+1.0 = =
+anim frame =
+bone
+-1 material anim frame
+-1 = anim texture 0.500000
+texture 
\ No newline at end of file
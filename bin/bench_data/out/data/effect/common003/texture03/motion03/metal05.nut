@@ -0,0 +1,13 @@
+material -1 bone 1.0 anim anim -1 = 0.500000 = 0.500000
+bone
+= material
+1.0
+anim
+-1
+material -1 anim
+frame
+1.0 0.500000 0.500000 bone 0.500000 material 1.0 frame vertex
+material
+-1 anim
+= =
+frame = frame bone text
\ No newline at end of file
@@ -0,0 +1,68 @@
+frame
+bone
+vertex
+anim = texture anim material 1.0
+texture texture
+material 0.500000 frame 1.0 vertex
+1.0 =
+frame bone 1.0
+frame -1 texture
+anim vertex
+1.0 0.500000 1.0 bone = 0.500000
+vertex vertex bone
+=
+anim texture -1 anim -1 = = 0.500000 texture = anim = bone
+frame 1.0 texture =
+material vertex 0.500000 material material frame vertex 0.500000 = anim texture 0.500000
+frame
+0.500000 texture anim bone material
+anim
+0.500000 frame -1 material bone material -1
+1.0 texture
+vertex -1
+vertex 1.0 bone material bone material texture texture texture -1
+bone 0.500000 1.0 material vertex 0.500000 bone 0.500000
+0.500000
+vertex material
+frame bone
+material
+frame texture
+-1 material 1.0 frame 1.0 = =
+texture texture material anim 0.500000
+0.500000 vertex 1.0 anim 1.0
+1.0
+vertex =
+vertex material frame
+-1 material
+texture bone 1.0
+texture -1
+-1
+1.0 0.500000 material texture -1
+frame texture 0.500000 = 0.500000 vertex
+anim -1
+texture
+frame 0.500000
+-1 0.500000 0.500000 material
+frame
+vertex vertex material texture anim frame texture texture anim
+material material texture
+-1 -1 anim
+bone
+frame
+= texture frame 0.500000 frame 1.0 -1 = anim 0.500000 bone
+1.0
+bone 1.0 =
+bone anim vertex material
+anim = material texture
+material texture texture material
+vertex 1.0 vertex anim
+= = bone
+= texture 0.500000 frame texture anim material vertex = frame bone frame anim
+-1 0.500000 -1 0.500000 1.0 1.0 1.0
+texture vertex
+bone
+bone
+= texture 1.0 material
+0.500000
+texture anim bone
+texture ve
\ No newline at end of file
@@ -0,0 +1,156 @@
+texture material frame
+bone
+texture anim texture -1 frame = bone
+=
+material vertex 1.0 material material
+1.0 -1 anim texture bone 0.500000
+texture
+anim
+anim material
+0.500000 vertex = anim -1 0.500000 1.0 0.500000 material
+0.500000
+= 1.0 -1
+= material texture -1 frame
+material bone bone 1.0
+texture 0.500000 vertex vertex
+bone 0.500000 1.0 = vertex texture anim anim
+frame vertex material bone
+vertex 1.0 frame bone = bone
+1.0
+anim bone 1.0 anim
+-1 material 0.500000 texture material anim frame frame material 1.0 anim 0.500000
+material anim bone
+vertex
+frame = 1.0 vertex frame
+-1 frame vertex
+bone
+bone = frame
+= -1 frame 1.0 0.500000 material
+= 1.0 anim anim
+1.0 vertex -1
+1.0 bone material anim 1.0 vertex
+texture 0.500000 frame
+1.0
+bone frame material 0.500000
+0.500000
+anim
+bone = anim texture frame
+= frame 0.500000 anim
+texture
+1.0 -1 vertex 1.0 frame 1.0 anim anim 1.0 frame frame frame vertex
+bone
+texture
+material
+vertex
+bone vertex 1.0 0.500000 material vertex vertex 0.500000 bone =
+bone -1
+1.0 -1 bone
+0.500000 =
+material -1
+= -1 frame 0.500000
+material frame bone =
+frame 0.500000 -1 = bone = vertex frame
+bone 1.0
+= frame
+anim
+material frame vertex 0.500000 1.0
+1.0 =
+anim = =
+-1 texture bone texture material
+texture frame anim
+-1 texture 0.500000 material 1.0 -1 bone =
+-1 vertex vertex
+texture
+frame
+-1 vertex vertex 0.500000
+0.500000 bone 0.500000 bone
+vertex texture
+texture texture -1 texture 0.500000
+-1 bone material 0.500000 frame 1.0 = 1.0 texture bone anim -1 vertex 1.0 1.0 -1
+texture -1 -1 vertex
+bone
+vertex = material 0.500000 0.500000 anim material 1.0 = = -1 = vertex
+texture
+=
+texture -1 = anim material = =
+0.500000
+0.500000 -1 -1 bone texture = vertex -1
+0.500000 material
+material anim
+= frame = material frame vertex anim vertex 0.500000 1.0 0.500000 = 1.0 bone texture = bone 0.500000
+=
+-1 texture 0.500000 texture
+-1 = vertex vertex
+frame material frame material 0.500000 = vertex -1 material 0.500000 0.500000 texture
+0.500000
+frame 1.0 frame frame material
+material
+anim anim -1 frame bone anim bone -1 1.0 = 1.0 material frame
+material bone = vertex vertex texture vertex
+0.500000 0.500000 -1 anim frame frame
+frame -1 1.0 anim material texture vertex
+frame frame
+= = 0.500000 vertex
+-1 texture material 0.500000 0.500000
+frame
+anim material 1.0
+frame material bone = texture anim
+vertex 1.0 1.0 texture
+-1
+material anim frame
+= -1 0.500000 texture
+frame -1 1.0 1.0
+anim
+bone =
+material
+anim 1.0 vertex frame anim 0.500000
+0.500000 -1 anim bone frame =
+-1 1.0
+-1 0.500000 0.500000 frame 0.500000
+= anim 1.0 vertex 1.0 bone vertex texture
+frame
+vertex texture -1 -1 -1 =
+-1 = frame
+bone
+frame texture texture
+anim texture =
+1.0 1.0 = bone = material 1.0 bone vertex
+-1
+frame bone 0.500000 = texture
+1.0 anim
+texture vertex frame bone =
+anim anim
+material
+0.500000 frame material = anim 1.0 texture
+texture material vertex frame vertex
+= 0.500000
+1.0 anim 1.0
+1.0 texture material 0.500000 1.0 = 1.0
+bone material vertex anim
+bone
+= bone 1.0 bone
+1.0
+=
+1.0 1.0 = vertex
+bone vertex bone anim 1.0
+bone 0.500000 frame vertex frame
+texture -1 anim
+1.0 -1 material = 1.0 frame 1.0
+vertex 0.500000 0.500000
+= -1 1.0 = anim vertex -1 anim
+anim material
+material
+material frame
+vertex texture 0.500000 0.500000 vertex
+texture 1.0
+material bone vertex texture anim
+1.0 1.0 texture
+= = vertex = bone 0.500000 anim 1.0 0.500000 1.0 bone
+-1
+bone anim texture material anim 0.500000 -1 material
+material = frame 0.500000 vertex material 1.0 0.500000 material 0.500000 texture -1 texture texture material 1.0 = anim vertex anim
+0.500000 -1
+0.500000
+1.0
+vertex
+anim texture frame -1 vertex 0.500000 material
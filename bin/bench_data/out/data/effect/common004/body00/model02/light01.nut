@@ -0,0 +1,203 @@
+-1
+texture
+texture 1.0 1.0
+texture frame vertex frame
+0.500000 -1 material
+anim anim material 0.500000 texture vertex vertex texture vertex
+texture material
+-1 -1 vertex
+vertex frame = -1 anim material material frame =
+vertex -1 bone texture bone 1.0
+= material = bone material anim bone
+= anim frame 1.0 anim
+bone frame 1.0 vertex texture -1 1.0
+material vertex bone
+anim = 1.0
+anim bone 0.500000 vertex
+bone
+anim 1.0
+frame bone 0.500000 anim 0.500000
+frame
+material anim
+1.0 frame
+texture material 0.500000
+material material vertex frame material material
+frame material anim 0.500000 -1 1.0
+= 0.500000
+texture
+anim
+frame -1
+frame material frame 1.0 material anim
+vertex
+-1 0.500000 material vertex frame 1.0 anim -1 1.0
+material
+= bone frame texture 1.0
+-1 texture 0.500000
+material
+texture
+anim -1 vertex 0.500000 =
+0.500000 = anim anim anim bone texture bone
+-1 -1 bone 0.500000 0.500000 -1 = bone anim 1.0 1.0
+1.0 material
+0.500000 vertex texture -1 anim 0.500000
+vertex
+frame 0.500000 texture =
+bone
+material vertex texture -1 -1 =
+vertex bone
+anim frame bone frame 0.500000
+bone material -1 1.0 frame 0.500000 frame anim frame 0.500000 material 0.500000 texture vertex
+-1 anim material
+=
+texture bone = vertex 0.500000 frame
+0.500000
+0.500000 texture vertex 0.500000 =
+material 1.0 0.500000 -1 material -1 0.500000 material frame =
+-1 bone 0.500000 texture material
+bone anim
+0.500000 material 0.500000 anim texture
+frame 1.0 bone
+texture
+=
+= vertex
+bone 1.0 vertex 1.0 bone texture texture =
+material texture vertex frame
+material material texture bone
+0.500000 =
+frame
+-1 frame frame
+anim 0.500000 -1 1.0 anim 1.0
+anim anim =
+frame
+-1 texture
+-1 texture
+material
+bone 1.0
+0.500000 1.0 -1 vertex texture material
+anim
+anim
+-1 anim 1.0
+texture
+-1 0.500000 -1 1.0 -1 texture
+0.500000 material material =
+= anim 0.500000 1.0
+= bone
+material anim 0.500000 -1 material
+= 1.0 = texture
+texture material material bone material vertex
+vertex
+0.500000
+vertex
+material = texture material -1 bone
+bone frame
+= = material anim vertex anim anim 0.500000 bone = bone 1.0 -1 0.500000 1.0 -1 anim texture texture material anim 1.0 1.0 texture 1.0 texture bone frame 1.0 texture bone frame 1.0
+bone = 0.500000 bone bone
+material material bone -1 = bone 0.500000 -1 bone texture bone material 1.0 frame = -1 vertex
+0.500000
+vertex 1.0 = material =
+texture frame -1 material frame 0.500000
+1.0 bone frame 0.500000 texture 1.0 anim
+bone -1
+frame bone texture vertex frame bone bone = = bone 0.500000 bone -1 anim
+= -1 texture bone -1 -1 frame vertex
+0.500000
+1.0 texture 0.500000 = bone = vertex texture
+1.0 vertex frame
+texture 1.0 frame material = texture
+vertex 1.0 anim 1.0
+1.0
+vertex frame 0.500000 anim 1.0
+bone material material texture texture anim 0.500000 1.0 0.500000
+material bone
+0.500000 0.500000 texture -1 bone material vertex
+= 0.500000 1.0 frame anim frame vertex vertex anim
+material
+bone
+1.0
+anim material
+material vertex anim -1 vertex
+texture material
+anim
+texture -1 material -1 material bone
+1.0 frame material bone anim bone material material -1 vertex texture anim
+0.500000 1.0
+= -1
+vertex
+=
+material texture
+bone bone
+-1 0.500000 1.0
+vertex
+bone material anim =
+anim vertex frame 0.500000 =
+= = 0.500000 -1 material = anim
+=
+=
+texture vertex frame material bone
+vertex anim
+texture vertex = vertex
+material anim bone material anim 0.500000
+-1
+1.0
+0.500000 material bone
+0.500000 material 1.0 frame -1 vertex bone material texture -1 frame
+texture material 0.500000 bone bone vertex frame = 1.0 0.500000 material 1.0 bone frame
+vertex bone 0.500000 vertex material bone = anim frame -1 vertex 1.0 frame
+1.0 bone 1.0 frame vertex frame
+= =
+= 1.0 1.0
+material material
+vertex material 1.0 material anim 1.0 0.500000 anim
+bone anim anim
+bone = anim -1 texture =
+texture
+-1 texture -1 bone
+material frame
+bone
+frame vertex bone frame material material frame vertex anim -1 anim frame 1.0 0.500000 anim
+1.0 -1
+material material anim
+= texture anim
+vertex frame 0.500000
+texture material
+-1 =
+anim bone vertex
+material 1.0 1.0 =
+vertex
+frame bone
+vertex
+0.500000
+-1 1.0
+-1 0.500000 1.0
+material 1.0 texture = texture -1 =
+anim 1.0
+0.500000
+vertex
+-1 material vertex
+frame
+material bone 1.0 1.0 1.0 frame
+-1 1.0
+0.500000 material anim
+= 1.0
+-1 texture
+= material bone
+0.500000
+vertex 0.500000 bone =
+= frame material texture = texture =
+material bone
+vertex frame 0.500000
+1.0 1.0 -1 material bone
+vertex = vertex -1
+anim bone 0.500000
+frame = = anim frame
+vertex
+0.500000 -1
+-1
+anim 0.500000 frame
+1.0
+bone
+anim 0.500000 texture
+texture frame vertex 0.500000 0.500000 0.500000 texture = = anim bone 1.0
+bone
+texture 0.500000 -1
+anim = -1 0.500000 vertex 1.0 0
\ No newline at end of file
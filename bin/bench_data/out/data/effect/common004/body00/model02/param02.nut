@@ -0,0 +1,14 @@
+vertex bone 1.0 material 0.500000 bone texture 1.0
+=
+material = frame vertex 0.500000
+= anim
+frame frame
+1.0 vertex
+vertex -1
+= vertex
+anim material material bone
+-1
+0.500000 0.500000
+= frame anim frame vertex bone -1
+vertex
+anim = anim
\ No newline at end of file
@@ -0,0 +1,22 @@
+= 0.500000 frame
+frame
+= bone 1.0 material
+= frame
+vertex material
+-1 1.0
+frame anim frame texture material
+-1
+vertex frame -1 anim 0.500000
+frame -1 frame anim vertex texture = 1.0 material =
+-1 1.0
+=
+texture
+anim = -1 -1 1.0 texture bone -1 -1
+bone
+material frame
+vertex = texture anim 1.0
+bone
+bone vertex frame 0.500000 texture
+texture
+-1 texture 0.500000 vertex material bone anim 0.500000 vertex
+frame anim vertex = a
\ No newline at end of file
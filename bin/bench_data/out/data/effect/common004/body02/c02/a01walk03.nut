@@ -0,0 +1 @@
+BL!F^2`0%Flre_0_xQwL?
\ No newline at end of file
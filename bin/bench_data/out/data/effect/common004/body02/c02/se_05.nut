@@ -0,0 +1,153 @@
+material
+texture -1 0.500000 bone
+vertex
+0.500000
+frame texture anim texture material =
+material texture material texture texture material texture
+= 0.500000 vertex 0.500000 1.0
+-1
+texture bone frame
+material
+bone frame material -1 1.0 material = texture frame -1
+0.500000 anim anim
+= bone 1.0
+=
+vertex
+-1 0.500000
+anim material
+frame -1 = vertex 1.0 frame = texture bone anim frame -1 0.500000
+vertex
+1.0
+-1 anim
+anim material texture
+1.0 frame frame anim 0.500000 material =
+material frame material bone
+-1 1.0 0.500000
+= frame anim texture bone material -1
+material
+= =
+material
+anim bone -1 bone frame 0.500000 texture
+bone frame texture texture material bone frame vertex anim
+texture vertex texture = vertex 0.500000 bone bone
+-1 material anim anim 0.500000 anim anim frame material bone texture 0.500000
+frame
+0.500000 0.500000 = material texture -1 vertex
+-1
+anim 0.500000 bone 1.0 vertex
+anim bone bone -1
+0.500000 1.0 material anim = 0.500000
+anim -1
+frame 1.0 0.500000 1.0 1.0 bone
+texture vertex
+vertex frame 1.0 -1
+0.500000 texture 1.0 material = texture 1.0 vertex -1 0.500000
+bone bone material anim texture
+0.500000 anim vertex vertex = vertex
+0.500000 0.500000 =
+material
+frame -1
+vertex
+0.500000 material -1 frame = -1 texture 1.0 = vertex 0.500000 bone
+= = -1 vertex
+0.500000 -1 bone anim texture 0.500000 anim
+material -1 bone 1.0 1.0 -1
+texture = bone
+0.500000 bone
+frame texture
+anim
+frame
+frame
+1.0
+-1 0.500000 0.500000 1.0 vertex 1.0 = bone material bone vertex anim vertex
+vertex 1.0 = 1.0
+1.0 bone
+frame
+frame vertex 1.0 = frame 1.0 bone
+bone
+1.0 texture
+0.500000 anim
+-1 vertex vertex
+material
+frame
+anim vertex texture =
+material 1.0 0.500000 1.0
+0.500000 -1
+1.0 frame texture
+texture texture 0.500000 anim anim -1 0.500000 frame bone vertex
+texture 1.0
+texture anim 0.500000 vertex
+=
+texture material -1
+bone
+1.0
+bone vertex anim
+vertex 0.500000 1.0
+frame -1 = vertex -1 = frame
+anim = -1 -1
+vertex 0.500000 vertex 0.500000 = frame anim vertex
+vertex -1 anim -1 material -1 0.500000 bone vertex texture material material material bone texture material 0.500000 anim = 1.0 vertex anim
+= material =
+1.0 1.0 1.0
+material 1.0 0.500000
+-1 anim vertex
+=
+texture
+bone texture material anim -1
+0.500000
+frame texture 1.0 1.0 bone bone anim -1 texture =
+texture
+material texture 1.0
+=
+frame frame frame 0.500000 0.500000 -1 vertex 1.0
+vertex texture texture 1.0 bone vertex anim 0.500000
+= frame vertex material bone -1 1.0 =
+bone vertex -1 0.500000
+=
+anim 0.500000
+1.0 frame material material
+bone
+texture material 1.0 bone = 0.500000 frame
+frame = anim -1
+=
+1.0 anim
+anim
+material =
+frame vertex texture 0.500000 vertex vertex bone
+vertex -1 -1 0.500000 -1 anim anim vertex frame vertex 1.0 vertex anim
+0.500000 1.0 frame
+bone vertex material frame 1.0 -1
+-1 anim anim 0.500000 1.0 anim material bone texture = frame 0.500000
+vertex -1 frame anim -1
+1.0 = 0.500000
+-1 = vertex
+frame
+-1
+-1 texture 1.0 texture
+material -1
+anim 0.500000
+0.500000 1.0
+vertex = frame
+1.0 bone anim material frame
+bone texture
+texture texture vertex bone 0.500000 anim 1.0 -1 1.0 texture material -1 -1
+-1 0.500000 0.500000 bone vertex
+anim 0.500000
+-1 -1 texture
+0.500000 0.500000 frame anim 1.0
+0.500000
+0.500000 bone
+= 1.0 texture
+vertex 0.500000 texture 1.0 0.500000 vertex 1.0 bone bone 0.500000 anim texture 1.0 anim 0.500000 -1 =
+texture material 1.0
+bone
+anim material texture = 1.0 = material bone
+vertex vertex
+frame
+anim
+0.500000 1.0
+-1 texture 1.0 0.500000 anim -1 -1 frame
+-1
+bone bone texture 0.500000 1.0
+1.0
+bone ver
\ No newline at end of file
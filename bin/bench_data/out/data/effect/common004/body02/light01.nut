@@ -0,0 +1,145 @@
+= 0.500000 -1 =
+-1 =
+1.0 = vertex frame
+= 1.0 vertex bone 1.0 bone
+frame = = bone
+texture -1 0.500000
+frame texture 1.0
+frame
+frame frame frame 1.0 1.0
+1.0
+material vertex
+material 1.0 bone 1.0
+1.0 -1 1.0
+texture frame
+texture bone vertex -1
+anim anim bone vertex frame = 1.0 bone frame
+=
+= texture -1 bone -1 -1 frame = = -1
+-1 vertex = material
+texture anim
+1.0 texture texture anim vertex = anim frame bone = 1.0 -1
+texture
+1.0 -1 0.500000 anim
+vertex vertex bone bone 1.0 = vertex
+anim =
+texture frame anim 1.0 0.500000 0.500000 anim -1 anim
+frame
+anim texture
+-1 =
+-1 -1 = 1.0
+material
+0.500000
+anim -1 vertex
+anim = material -1 -1 material bone -1
+anim bone
+bone vertex texture texture -1 vertex
+vertex frame 1.0 vertex = -1 = 1.0
+texture -1 anim
+material material material 0.500000 vertex
+-1 1.0 material frame bone 1.0 0.500000 1.0 0.500000 1.0 texture bone
+anim vertex bone frame bone -1
+1.0 texture -1 frame bone texture vertex material 0.500000 -1 vertex texture 0.500000 1.0
+= 0.500000
+anim
+material
+= 1.0
+bone -1 material 0.500000 frame bone 1.0 frame texture bone 1.0
+0.500000 frame vertex = frame
+frame
+texture = bone
+bone texture bone
+texture vertex anim frame frame bone
+0.500000 -1 -1
+0.500000 texture anim bone
+1.0 = 1.0 bone -1
+0.500000 0.500000 texture 1.0 frame 1.0 material = =
+frame texture material frame
+anim
+-1 texture
+vertex texture
+bone material
+anim bone material
+bone frame -1 0.500000 frame -1 1.0
+vertex
+anim
+vertex frame anim bone texture -1 texture
+vertex vertex
+anim
+= = texture anim bone =
+1.0 bone
+1.0 bone =
+material material 0.500000 =
+-1 frame anim frame vertex = bone = material material
+bone texture material -1 vertex
+texture 1.0 -1 = -1
+-1 -1 frame vertex
+bone 0.500000
+= texture frame = -1 texture 0.500000 bone vertex -1
+1.0 anim
+frame
+bone vertex = =
+vertex texture 1.0 0.500000 bone
+material bone 0.500000 -1
+texture material =
+vertex anim
+vertex =
+texture texture 1.0 frame 1.0 1.0 -1 0.500000 -1
+texture = vertex = 0.500000 = 0.500000 anim bone = anim
+0.500000 1.0 1.0
+1.0 1.0 anim
+texture anim =
+= bone anim vertex frame
+anim material 1.0 anim texture = texture -1 0.500000
+bone =
+0.500000 1.0
+=
+0.500000 material bone anim bone bone =
+vertex
+0.500000 -1 vertex
+texture anim =
+vertex anim
+texture
+texture 1.0 =
+-1 bone
+frame =
+bone
+anim 0.500000 anim
+anim 0.500000 vertex texture bone anim
+vertex bone
+frame bone = texture
+=
+1.0 =
+bone vertex 0.500000 texture material texture 0.500000 -1 -1 1.0 0.500000 material -1
+anim bone
+material 0.500000 texture anim
+= texture = material texture 1.0
+vertex material anim bone anim bone -1 frame
+vertex 0.500000 1.0 vertex
+0.500000 material 1.0 0.500000 bone -1
+texture 0.500000 frame
+= texture
+vertex texture -1 bone vertex
+frame anim material bone = vertex 1.0 frame frame
+vertex 1.0 1.0
+material 1.0 = bone
+0.500000 frame 1.0 = -1 anim = frame material
+texture
+bone = material material material = 0.500000 vertex
+material 0.500000 -1 bone
+anim texture
+frame material 0.500000 texture 1.0 texture
+bone 0.500000 bone
+=
+1.0 1.0 -1 anim material =
+=
+material 1.0 -1
+frame bone frame texture anim frame bone
+anim 0.500000
+texture vertex vertex anim
+-1
+0.500000 material material vertex texture 0.500000 material material texture 1.0 frame
+texture 1.0
+anim frame 1.0 texture vertex texture 1.0 = vertex = frame material vertex
+0.500000 material bone 0.500000
+-1 = = anim 1.0
@@ -0,0 +1,144 @@
+anim
+1.0 material texture texture 1.0 vertex
+1.0
+= anim texture -1 anim 1.0 -1 -1 anim
+bone -1
+frame
+anim 0.500000 0.500000
+0.500000 anim anim
+material bone vertex
+texture
+-1 bone
+anim frame = -1
+texture
+0.500000 anim = bone = vertex
+-1 material 0.500000 =
+vertex 1.0 material
+-1 texture vertex anim
+bone 0.500000 material texture
+= texture
+texture 0.500000 = frame
+= texture material
+bone
+= texture frame material bone material
+vertex 1.0 material 1.0 0.500000
+= 0.500000 anim texture bone -1 anim = = vertex 1.0 bone anim =
+= texture
+1.0 material bone 1.0
+material material
+0.500000
+0.500000 anim vertex frame 0.500000
+vertex bone
+-1 vertex bone -1
+texture material
+0.500000 -1
+1.0 -1 0.500000 frame 0.500000
+1.0 vertex
+-1 -1 0.500000 1.0 texture frame material material -1 anim
+1.0 bone anim
+bone 1.0 frame -1 texture frame bone frame = frame
+bone vertex anim -1
+= -1 texture anim 0.500000 bone
+bone = 0.500000
+material
+-1 anim
+frame vertex
+frame bone 1.0 frame texture 0.500000
+=
+bone texture
+frame -1
+anim 0.500000 0.500000 texture frame
+-1
+vertex anim -1 bone 0.500000
+frame texture -1 -1 0.500000
+texture 1.0
+frame
+texture anim vertex = bone
+= vertex vertex -1
+1.0 frame -1 frame = vertex = anim
+bone anim
+texture
+1.0 anim 1.0 1.0
+=
+= frame 1.0 frame -1
+1.0 bone
+texture
+frame
+frame
+material
+bone
+texture
+bone
+1.0
+bone bone vertex -1
+0.500000 frame material -1 0.500000 vertex 0.500000
+=
+frame 0.500000
+material bone
+material =
+1.0
+bone = frame texture texture 0.500000
+frame
+= frame
+texture
+1.0
+bone -1 -1 anim 0.500000 =
+bone material texture anim material
+1.0 vertex 0.500000
+0.500000 vertex 0.500000 anim frame 1.0 material
+bone texture 0.500000 frame
+=
+bone
+frame bone bone texture -1 -1 0.500000 texture texture 0.500000 0.500000 1.0 0.500000
+bone bone
+material = anim 0.500000 texture
+frame texture vertex -1 vertex
+material
+0.500000 0.500000 0.500000
+-1
+vertex anim
+material anim
+anim 1.0 anim
+0.500000
+vertex anim bone texture anim 1.0 0.500000
+-1 texture -1
+texture anim
+1.0 0.500000 bone frame
+texture frame frame
+0.500000 bone bone anim
+=
+vertex material 0.500000 = 1.0 frame = anim frame frame anim vertex frame anim
+= material
+= 0.500000 = vertex anim anim bone -1 -1 bone 0.500000 0.500000 bone texture -1 frame
+anim 1.0
+-1 = 1.0 texture anim material 0.500000 material 0.500000
+anim anim bone texture texture 0.500000 material bone texture material
+0.500000
+vertex
+bone 0.500000 0.500000 0.500000
+anim vertex vertex frame 0.500000
+vertex
+material
+vertex -1
+vertex 0.500000 texture 0.500000 anim 0.500000 bone texture vertex bone frame = =
+0.500000 anim vertex
+anim vertex
+0.500000 frame bone 0.500000 frame -1 vertex frame
+-1 material
+anim frame material anim 0.500000 1.0 -1
+frame
+texture 1.0
+= vertex vertex 0.500000
+texture 1.0 vertex material
+-1 bone = material
+texture frame vertex
+-1 material bone
+=
+frame 1.0 1.0
+frame -1 frame 0.500000
+material material material material =
+1.0
+1.0 material -1 = vertex bone -1 -1
+anim -1
+0.500000
+texture 0.500000 materi
\ No newline at end of file
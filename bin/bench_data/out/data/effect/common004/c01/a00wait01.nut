@@ -0,0 +1,11 @@
+bone anim frame material
+0.500000 texture
+1.0 texture vertex -1 frame bone 1.0 1.0
+= frame 1.0 -1 material vertex frame bone 0.500000 vertex 1.0 1.0 frame material frame
+vertex
+-1 material = anim texture
+anim -1 vertex texture
+1.0 texture bone anim 0.500000
+anim material 0.500000
+frame frame -1
+-1 bone material -1 1.0 material anim ve
\ No newline at end of file
@@ -0,0 +1,187 @@
+vertex anim 0.500000 anim anim vertex =
+texture
+material texture
+1.0 1.0 anim 1.0
+anim 1.0 vertex texture anim
+anim 1.0 1.0 1.0 bone texture
+frame bone = material texture
+-1
+material texture 0.500000 anim anim 1.0 1.0
+= material anim frame
+frame
+texture texture 0.500000 frame -1 1.0 vertex frame frame material
+material material frame
+frame texture frame -1 1.0 texture -1
+material 0.500000 anim = anim bone 1.0 0.500000
+vertex vertex 0.500000 0.500000 material vertex
+material 1.0 vertex anim
+-1 bone 0.500000
+vertex material =
+vertex
+-1 anim =
+-1 texture texture frame 0.500000
+material bone 1.0
+0.500000 anim 1.0 bone anim
+= anim texture -1 material -1
+1.0 texture
+-1 -1 vertex
+= 1.0 0.500000 texture
+= = anim texture texture material frame material material =
+bone texture frame 1.0 1.0 material bone frame anim frame
+material vertex anim
+vertex -1
+=
+anim
+anim texture texture anim -1
+= 0.500000 anim 1.0 0.500000
+frame 1.0
+vertex texture texture bone frame vertex
+anim 0.500000 frame texture texture
+material texture material vertex
+1.0 vertex = -1 bone anim
+texture frame texture texture =
+material -1 -1 anim 0.500000 vertex bone -1 texture vertex
+material bone 1.0
+-1 vertex texture 1.0 -1
+= =
+vertex bone vertex 1.0 -1 1.0 bone material = texture
+0.500000 1.0 = vertex frame 0.500000
+=
+= -1 -1
+bone anim
+texture bone -1
+= frame
+bone 1.0 frame 1.0
+1.0 anim
+texture vertex texture vertex texture
+1.0 -1 -1 texture = vertex
+vertex = texture
+bone
+= -1
+vertex anim
+vertex
+vertex frame material
+0.500000 bone
+1.0 -1 frame material vertex 1.0 vertex -1 -1 frame vertex -1
+anim 0.500000 0.500000 material anim 0.500000 -1 = 1.0 = anim
+vertex anim vertex
+-1 1.0 frame anim
+= -1 texture = bone bone anim = anim anim vertex
+bone frame =
+=
+texture 1.0
+bone texture bone 1.0 material 0.500000
+1.0 material 0.500000 frame vertex -1
+bone -1 anim bone 0.500000 -1
+1.0 material frame texture material anim -1 -1 -1 texture material
+-1 bone = -1 = texture texture 0.500000 0.500000
+frame
+bone
+-1 vertex anim -1 material
+vertex
+anim
+material material
+1.0 =
+1.0 vertex
+frame frame
+1.0 0.500000
+anim -1
+1.0
+texture 1.0
+vertex
+anim
+1.0 1.0 bone
+material vertex = 1.0 -1 anim -1 = = 0.500000 texture -1 bone = = vertex bone
+frame anim bone bone anim material
+frame = frame vertex
+material material -1 anim anim
+0.500000 vertex anim frame 1.0
+-1 1.0 bone texture frame
+frame 0.500000 frame frame bone
+1.0
+texture vertex frame texture anim frame anim anim
+frame 0.500000 0.500000
+frame texture
+vertex vertex -1 anim texture
+anim
+0.500000
+texture = bone
+material frame texture
+vertex
+-1 frame frame
+0.500000 bone vertex material
+-1
+= anim anim frame bone frame
+= frame vertex 0.500000 bone
+frame 0.500000
+frame = texture
+material
+material
+0.500000 vertex
+anim frame
+bone 0.500000
+frame = bone = frame frame 0.500000 1.0 frame
+= anim
+anim 0.500000 material vertex -1 -1 0.500000 frame material =
+-1 anim -1 texture
+texture
+bone 0.500000
+material = bone anim texture
+-1
+material -1 = vertex -1
+anim 0.500000
+frame anim bone anim bone texture material anim
+frame texture
+= texture
+frame
+anim texture
+-1
+= frame anim -1 =
+-1 = frame bone 0.500000 texture -1
+bone anim
+-1 vertex
+anim
+= frame material vertex
+material 0.500000
+0.500000 -1
+frame material
+0.500000 -1
+vertex = anim
+frame anim
+0.500000 anim 1.0 1.0 bone vertex = texture
+0.500000 0.500000 1.0 -1 0.500000
+0.500000 frame vertex frame bone -1 material bone 1.0
+vertex 1.0 = anim 1.0 texture texture 1.0 frame -1 1.0 = bone -1
+-1 = anim 0.500000
+vertex
+anim -1 1.0
+frame vertex frame 0.500000 = 0.500000 -1 frame material -1 anim anim -1 vertex vertex texture
+0.500000 frame -1 anim 1.0 1.0 = vertex anim 0.500000 0.500000
+material bone 0.500000 0.500000 vertex vertex =
+frame 0.500000 = anim -1 0.500000 bone
+-1 -1 texture bone 1.0
+-1
+texture = -1 texture anim
+material frame 0.500000 = vertex 0.500000 texture anim
+0.500000 bone -1
+-1
+frame
+-1 -1 anim 1.0 = 0.500000
+1.0 bone 0.500000 = bone
+vertex
+1.0 frame -1 -1
+frame 1.0 vertex 1.0
+material anim texture
+0.500000 -1 bone 0.500000
+anim frame
+anim bone material vertex
+-1 material bone
+material bone 1.0 bone texture bone
+= vertex
+texture material 0.500000 = bone
+vertex
+=
+texture = -1 0.500000 0.500000
+bone anim
+-1 material texture 0.500000 -1 anim
+1.0 texture vertex texture vertex a
\ No newline at end of file
@@ -0,0 +1,74 @@
+vertex texture -1 material
+anim 0.500000 =
+vertex bone 0.500000
+0.500000 1.0
+frame frame 0.500000 anim = anim
+frame material
+= =
+vertex
+0.500000
+-1 bone 1.0 material anim material -1 1.0 =
+frame bone
+frame 0.500000 material
+0.500000 material
+-1 bone anim 1.0 anim
+frame = material texture texture texture vertex
+1.0 texture bone = texture 1.0 frame bone anim frame material
+texture vertex frame texture
+= 0.500000 vertex
+-1 0.500000
+0.500000
+0.500000
+frame = -1
+0.500000 frame frame 0.500000
+bone anim vertex bone
+frame vertex
+=
+=
+frame -1 texture
+vertex
+= = 0.500000 vertex vertex
+-1 anim vertex bone
+1.0 = -1 texture frame bone 0.500000 vertex
+texture anim 0.500000 texture = material texture = 1.0
+1.0 bone
+anim
+anim = -1 = frame 1.0 anim
+frame 0.500000 1.0 0.500000
+= vertex texture
+0.500000 -1
+vertex material
+material
+vertex frame bone
+frame 0.500000 material 1.0 texture = = 1.0 1.0 material
+anim
+bone
+1.0 frame anim anim = 1.0 = 0.500000 1.0 frame -1 0.500000 0.500000 = vertex 1.0
+1.0
+material = texture 1.0 1.0
+anim
+=
+anim 1.0 0.500000
+= 1.0
+1.0 anim frame anim
+0.500000
+texture 1.0 vertex
+1.0 0.500000
+bone 0.500000 anim 1.0 material frame material 1.0
+material texture = vertex
+0.500000
+=
+texture
+0.500000 1.0 frame
+vertex frame bone -1 material 1.0 = 1.0 -1 material material 1.0 = material vertex
+material
+bone vertex
+-1
+0.500000 bone
+= 1.0 material bone 1.0
+0.500000 bone texture
+= texture vertex 0.500000 texture
+frame 0.500000 frame -1 0.500000 anim vertex
+bone
+-1
+bone vertex = -1 = -1 0.500000 frame = -1 texture vertex bone texture -1 =
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000
+anim frame texture
+1.0
+0.500000
+bone bone
\ No newline at end of file
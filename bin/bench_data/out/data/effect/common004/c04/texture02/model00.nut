@@ -0,0 +1,147 @@
+0.500000 texture material anim texture anim 1.0 texture vertex bone 0.500000 = texture frame anim texture vertex anim material 0.500000 texture
+frame
+0.500000 0.500000 material texture -1 -1 1.0
+texture 0.500000 material texture = bone texture texture frame 0.500000 material material -1 -1 = texture material -1 anim material
+= =
+vertex texture bone bone 1.0 = vertex frame frame anim anim 1.0 1.0 frame texture bone -1 bone
+vertex
+material =
+bone material -1
+-1 anim
+-1 0.500000 frame
+bone
+0.500000 0.500000 anim 0.500000 bone = bone bone
+=
+material frame
+material = material texture material
+-1 =
+frame -1 =
+0.500000 material material anim texture
+texture texture vertex 1.0 frame
+bone texture bone
+texture material
+0.500000 -1
+1.0 frame 0.500000 frame anim anim
+-1
+anim bone anim 0.500000 material 1.0 -1 anim
+0.500000 material =
+-1 1.0
+anim
+vertex frame 1.0 anim bone material -1 bone 1.0 texture anim frame frame anim = =
+1.0 frame texture = vertex
+= vertex = anim bone vertex frame anim -1
+=
+frame
+frame 1.0 vertex = material 0.500000 vertex anim = material vertex
+0.500000
+= vertex -1 anim
+0.500000
+1.0 material 1.0
+bone
+material 0.500000 material texture frame bone frame
+vertex
+frame material
+material
+vertex 0.500000
+frame anim anim frame vertex -1
+anim material 1.0 -1 bone anim =
+0.500000 bone 1.0 = 0.500000
+texture
+=
+bone frame =
+= 0.500000 texture material bone
+0.500000
+bone texture bone vertex
+0.500000 bone bone
+vertex frame vertex vertex frame
+= 1.0
+anim = frame
+frame 0.500000 vertex frame bone
+bone
+frame = anim frame 0.500000 vertex vertex
+-1 1.0 bone -1 texture
+-1 -1 frame anim anim anim 0.500000 anim anim 0.500000 0.500000 bone frame 0.500000 = anim bone
+texture texture material texture material anim -1
+vertex texture = 1.0 frame
+texture frame bone 0.500000 0.500000 anim
+frame 0.500000 0.500000
+0.500000 bone -1 -1 material 1.0 -1
+1.0
+0.500000 frame -1 material material -1 1.0
+texture
+bone -1
+0.500000 material material
+bone material
+bone
+anim 1.0 material texture 1.0 frame -1 texture bone 1.0 bone texture
+-1 frame 1.0 texture anim
+frame anim anim material vertex 1.0 1.0 -1 = 1.0 vertex texture -1 anim
+material material bone frame
+anim
+0.500000
+frame
+anim
+0.500000 =
+bone
+0.500000 texture 0.500000 -1 texture frame anim material = material 0.500000 bone bone 1.0 -1 -1 bone
+-1 texture anim bone 0.500000 1.0 =
+bone = = material
+frame
+= texture = bone -1
+vertex = bone 1.0 1.0 -1 material frame 1.0 = frame material bone 0.500000 0.500000 texture frame
+frame vertex -1 0.500000 material texture = -1 = -1
+anim bone 1.0
+vertex = bone 0.500000 -1 texture frame -1
+vertex = vertex bone 0.500000 1.0
+vertex
+frame 1.0
+-1 = bone vertex -1 bone
+0.500000 0.500000
+0.500000 anim frame
+anim
+frame -1
+vertex anim = frame -1 1.0 anim -1 frame texture
+material
+0.500000 = 1.0 texture material
+frame texture vertex
+frame vertex texture bone
+texture
+anim -1 frame anim
+bone
+vertex
+bone vertex
+frame 1.0 anim texture bone texture
+= frame
+-1 material
+material
+material 1.0 1.0 frame
+= =
+vertex
+= =
+vertex
+0.500000
+0.500000 frame bone material
+-1 anim
+1.0 texture
+frame -1 vertex vertex 0.500000 frame frame
+= 1.0 vertex
+0.500000 -1 frame texture anim material material material -1 anim -1 bone
+frame vertex frame
+vertex
+texture vertex -1 frame -1 anim bone material vertex material
+anim anim
+= frame
+frame anim texture
+bone anim
+1.0 texture
+anim vertex
+= = bone 0.500000 vertex
+1.0 bone = texture
+bone bone material = material material
+= frame vertex
+-1
+-1 = texture 0.500000 frame
+bone vertex =
+material -1
+texture frame vertex -1 0.500000 1.0 material material
+0.500000
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex material bone
+-1 anim 0.500000
+-1 bone material frame = vertex
+0.500000 vertex -1 texture vertex material
\ No newline at end of file
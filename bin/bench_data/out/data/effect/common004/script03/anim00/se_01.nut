@@ -0,0 +1,105 @@
+texture material -1 -1 -1 bone material 1.0
+vertex = vertex texture 0.500000
+material
+material 0.500000 texture
+= 0.500000 frame
+0.500000
+= frame frame bone vertex
+material bone bone material frame -1 = 1.0 1.0
+1.0
+0.500000 0.500000 -1 bone frame material vertex vertex material vertex bone 1.0 1.0 material
+texture = 1.0 material material 1.0 material 1.0 1.0
+bone material bone material -1 anim 0.500000 anim bone 0.500000
+-1 texture
+anim = -1 anim vertex 1.0 texture material
+vertex 1.0
+anim material = 0.500000 material 1.0
+material
+bone vertex -1 anim
+1.0
+frame frame material -1 1.0 material
+= anim
+-1 anim 0.500000 bone
+= bone
+texture 1.0 texture
+texture
+texture bone frame bone texture -1
+anim 1.0 material
+1.0 -1
+= 0.500000 texture
+vertex vertex vertex bone texture anim bone vertex
+vertex 1.0 texture
+anim
+-1 vertex
+0.500000
+-1 vertex -1 0.500000 texture
+material
+bone
+bone -1 1.0 0.500000
+bone
+vertex
+bone bone
+frame
+material bone vertex = 0.500000 -1
+vertex material texture texture -1 bone
+anim 0.500000 bone
+= 1.0 = vertex = frame material
+bone -1 0.500000 0.500000
+1.0
+0.500000 vertex anim -1
+0.500000 1.0 bone material anim material material anim
+bone anim 1.0 bone -1 bone frame texture bone
+material material -1 anim
+frame = vertex
+material -1 = = bone material vertex material anim bone
+vertex
+1.0 frame 1.0 bone
+0.500000 frame material material bone = anim
+0.500000 bone 0.500000 frame -1
+anim material
+-1 anim vertex texture texture bone
+1.0 texture frame
+material 0.500000 0.500000 anim
+1.0 frame frame anim
+material vertex
+= frame bone = 0.500000
+bone vertex
+bone = vertex 0.500000
+material material =
+texture frame vertex 1.0
+anim
+vertex 1.0 1.0
+vertex
+= bone texture frame -1 1.0
+-1 0.500000
+bone texture 1.0 anim 0.500000 frame bone material material frame
+material 1.0 material anim anim frame 1.0 material 0.500000 1.0
+bone bone
+vertex 0.500000
+material texture =
+0.500000 0.500000 frame 0.500000
+frame bone
+anim -1
+material anim frame frame =
+0.500000 material -1 vertex = material -1 -1 bone vertex -1 vertex -1 = anim bone -1
+bone bone -1 material
+-1 -1 1.0 vertex texture
+1.0 0.500000
+vertex 1.0 vertex bone -1 frame material anim -1 bone 0.500000 frame -1 vertex
+vertex anim vertex
+0.500000 vertex texture 0.500000 anim 0.500000 texture
+-1 anim
+frame frame
+material 0.500000 texture 0.500000 1.0 vertex 0.500000 anim vertex anim frame anim frame -1 anim
+=
+anim material bone material = 0.500000 1.0
+0.500000 1.0 anim 1.0 bone 0.500000 texture
+vertex -1 bone -1 1.0 -1 anim anim vertex
+-1
+= -1 material
+vertex
+material 0.500000 material
+texture
+bone material -1 1.0 1.0
+0.500000 material bone
+texture texture bone = frame materia
\ No newline at end of file
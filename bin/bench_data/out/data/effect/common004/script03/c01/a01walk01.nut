@@ -0,0 +1,98 @@
+0.500000
+material material 1.0
+1.0
+-1 bone bone 0.500000 -1 frame
+-1 vertex -1 0.500000 vertex vertex
+material material material anim -1 material material
+frame
+bone =
+-1 anim texture texture -1
+bone
+= frame 0.500000
+anim texture
+-1 =
+=
+anim material
+0.500000
+1.0 material -1
+frame material = frame -1
+material frame material
+vertex
+0.500000 frame -1 1.0
+texture
+0.500000 frame
+1.0 0.500000
+1.0
+texture =
+material = vertex =
+anim texture texture -1
+-1
+1.0
+-1 material
+1.0 frame
+bone
+frame anim texture material
+vertex
+texture -1 material frame frame texture frame frame -1 0.500000
+bone material material
+texture anim bone texture -1 = 1.0 -1
+frame = texture anim vertex texture
+-1
+1.0 texture frame anim frame
+-1
+frame bone
+frame 1.0 = = = texture
+=
+texture material
+1.0 vertex -1 vertex
+=
+bone 0.500000
+0.500000 texture
+vertex 1.0 = frame material frame anim
+texture
+bone 1.0 =
+-1 texture 1.0
+vertex 0.500000 anim -1 0.500000 1.0
+texture texture -1 texture
+0.500000 texture
+0.500000 1.0 vertex vertex
+1.0 texture
+0.500000
+=
+-1 -1 texture
+vertex frame anim = texture
+texture bone -1
+0.500000 -1 -1 vertex material
+material
+frame anim 1.0 texture
+1.0 frame vertex texture anim vertex
+bone vertex anim vertex -1
+bone -1 frame texture anim frame texture material
+anim
+anim
+0.500000
+1.0
+vertex
+= texture
+bone
+0.500000 vertex 0.500000 texture 0.500000 texture material texture 0.500000 bone 1.0 -1
+texture 0.500000
+frame 0.500000 bone 0.500000 1.0 vertex frame
+texture 1.0 material bone
+=
+frame
+anim -1 0.500000 1.0 vertex
+= frame 0.500000
+material bone vertex
+= vertex 1.0
+bone 0.500000
+0.500000 bone vertex
+1.0 =
+0.500000
+0.500000 vertex -1 1.0 vertex texture 1.0 vertex -1 0.500000
+anim texture 1.0 anim
+frame
+bone 0.500000 material bone = 1.0 anim
+0.500000 texture = 0.500000
+1.0
+bone texture material
@@ -0,0 +1,7 @@
+1.0 1.0 1.0 texture 0.500000 material
+1.0 anim
+texture bone
+frame material material texture 0.500000 1.0
+texture
+anim frame frame texture bone anim texture texture 1.0
+bone bone vertex 1.0 bo
\ No newline at end of file
@@ -0,0 +1,147 @@
+material
+-1 0.500000
+=
+anim
+= texture bone frame
+vertex
+anim
+= frame
+= -1 anim
+0.500000 frame anim bone
+frame
+0.500000 frame bone
+0.500000
+1.0 =
+frame 0.500000 texture vertex anim 0.500000 0.500000 1.0 material 0.500000 anim 1.0 frame frame -1 material 0.500000 material
+vertex
+0.500000 -1
+frame
+anim texture texture frame -1 -1 = vertex
+1.0 0.500000 0.500000 vertex frame
+anim =
+texture
+bone texture material vertex anim vertex material vertex = anim 1.0
+material anim material 1.0 bone =
+vertex -1
+0.500000 vertex anim anim 0.500000 0.500000 texture material vertex material -1 anim frame -1 material 0.500000 bone
+material 1.0 bone -1 1.0
+0.500000 material bone
+vertex
+frame =
+= 0.500000 texture
+bone 0.500000
+=
+1.0 material
+material
+texture anim
+1.0 = anim
+-1 -1 vertex anim
+0.500000
+=
+-1 1.0 1.0 = 1.0 texture 0.500000 anim
+0.500000 0.500000 -1 = texture 1.0 anim
+vertex 0.500000 bone vertex material vertex anim
+frame material
+frame bone vertex = bone frame 0.500000 texture material anim 1.0 texture -1 0.500000 bone bone frame bone vertex frame vertex anim texture 0.500000 1.0
+texture -1 1.0 = bone vertex
+vertex 1.0
+material vertex bone frame 1.0
+-1 frame -1
+= bone
+texture material
+vertex anim bone
+material bone
+vertex -1
+0.500000 = vertex 1.0 texture = vertex bone =
+1.0 -1 -1
+= -1 -1
+0.500000 1.0 0.500000 frame texture anim
+= texture anim texture
+-1
+frame 0.500000
+vertex texture texture 0.500000
+= 0.500000 bone frame = 0.500000 bone 0.500000
+0.500000 = vertex material
+frame texture anim anim 1.0 material anim
+bone anim
+0.500000 bone material texture vertex 0.500000
+anim anim
+texture bone 1.0 anim = material anim
+frame vertex
+material
+anim
+material 1.0
+= vertex -1 1.0 material anim texture
+material texture material material
+= frame
+vertex anim bone texture
+texture -1 bone
+0.500000
+frame
+texture texture
+vertex anim frame 1.0
+frame texture
+-1 0.500000 bone = material frame vertex frame anim frame material 0.500000 = texture vertex
+anim 0.500000 anim
+= anim
+0.500000 bone =
+texture
+anim 0.500000 frame -1 texture = 0.500000 0.500000
+1.0 1.0 anim
+0.500000
+texture
+-1 vertex frame -1
+bone
+-1 = bone 0.500000
+0.500000 material frame texture 1.0 0.500000 material texture vertex
+anim
+0.500000 0.500000 anim
+material
+0.500000 anim anim
+material -1 = 0.500000
+vertex 1.0 texture vertex = 0.500000 texture
+0.500000 -1 texture texture
+= vertex anim vertex
+0.500000
+texture vertex frame frame anim -1
+bone -1 0.500000 =
+anim 0.500000 -1
+frame bone 0.500000
+-1 1.0 vertex bone bone 1.0
+-1
+material texture =
+0.500000
+material texture 1.0 material texture texture = anim material
+-1 material material frame texture
+material texture
+texture
+frame material vertex 0.500000 bone -1 vertex 1.0 0.500000 frame -1
+-1 = anim
+texture 1.0 bone frame
+texture 0.500000 = 1.0
+-1
+anim anim 1.0 frame = anim 0.500000 = 1.0
+=
+=
+anim -1 =
+texture bone 1.0 1.0 bone
+material material
+=
+anim =
+= material
+texture vertex = 0.500000
+-1 texture texture = vertex -1 frame = material 0.500000 0.500000 -1 -1 anim = texture texture 0.500000 material -1
+frame
+1.0 1.0
+0.500000 frame bone = bone =
+bone
+material
+bone anim -1 1.0 0.500000
+bone frame texture bone texture vertex 1.0 bone 0.500000 =
+1.0 frame 1.0 bone frame
+1.0
+vertex material frame -1 bone anim =
+texture -1 = bone vertex
+1.0 1.0 texture 1.0
+texture
+frame material mater
\ No newline at end of file
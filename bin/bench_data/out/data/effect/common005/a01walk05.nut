@@ -0,0 +1,6 @@
+0.500000 anim texture 1.0 vertex material frame
+frame texture
+frame vertex vertex vertex -1 1.0 =
+material -1
+-1 bone = -1 anim frame bone 1.0 material =
+-1 1.0 material anim bone anim vertex = texture
\ No newline at end of file
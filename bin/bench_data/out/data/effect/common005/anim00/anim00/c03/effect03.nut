@@ -0,0 +1,6 @@
+frame 1.0
+1.0 -1 vertex 0.500000 bone bone
+=
+anim vertex = = material
+vertex -1 texture 0.500000 = =
+-1 bone texture 1.0 
\ No newline at end of file
@@ -0,0 +1,12 @@
+-1
+1.0 material
+-1
+1.0
+0.500000
+frame vertex
+material =
+anim vertex
+0.500000 bone
+1.0
+-1 =
+1.0 0.50
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex -1 bone anim texture texture -1 1.0
+-1 frame texture mat
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000
+texture bone anim vertex anim material text
\ No newline at end of file
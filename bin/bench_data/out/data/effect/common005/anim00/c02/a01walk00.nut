@@ -0,0 +1,16 @@
+bone
+-1 = texture = texture -1 texture 0.500000 material = texture bone texture 0.500000 0.500000
+vertex -1 vertex = frame 0.500000
+0.500000
+material -1 texture vertex material 0.500000 -1
+1.0 = 0.500000 -1 1.0 = = 1.0 material vertex anim anim 1.0 material -1 frame material anim
+-1
+vertex anim 1.0
+0.500000
+0.500000 0.500000 bone 0.500000
+1.0 material
+bone anim
+vertex
+frame frame
+1.0 frame frame 1.0 anim texture 1.0
+bone frame material anim vertex frame
@@ -0,0 +1,120 @@
+-1 0.500000 texture material 0.500000 material 0.500000 material texture texture frame 0.500000 = material
+bone 0.500000
+anim material bone frame
+material -1
+texture vertex material
+-1
+anim vertex frame vertex = frame frame texture bone frame vertex = 0.500000 -1
+1.0 bone
+material material
+bone 0.500000 0.500000 bone bone bone 0.500000 -1 = material anim
+anim 0.500000 material
+texture
+= texture texture
+texture -1 frame 1.0 bone bone 1.0 frame = -1 1.0
+frame bone texture texture 0.500000 vertex
+material
+material vertex material
+-1 vertex =
+bone
+0.500000
+-1
+material anim -1
+0.500000 -1 = -1 material bone
+= material
+0.500000
+vertex
+anim
+=
+0.500000 bone frame vertex
+anim anim -1 anim
+bone -1
+anim anim
+= bone
+1.0 frame -1 material texture -1
+material 0.500000
+bone texture 0.500000
+anim
+0.500000 -1 bone bone -1 0.500000 frame -1 texture anim 0.500000 frame -1 bone anim bone 0.500000 = frame
+anim material anim
+anim texture bone bone bone 0.500000 -1 anim -1
+0.500000 0.500000 bone 1.0 -1
+material vertex anim bone vertex anim anim
+-1 anim material -1
+bone material 0.500000 vertex
+frame
+vertex frame
+vertex bone
+=
+bone anim frame 0.500000 bone texture material
+material -1 frame vertex 0.500000 texture -1 anim vertex bone = vertex
+anim
+bone material
+= texture 1.0 bone 1.0
+material = material
+0.500000 anim material
+-1 vertex anim 1.0
+= material
+-1
+-1 = = 1.0 1.0 0.500000
+bone frame material anim -1 0.500000
+texture
+frame -1
+texture
+material bone
+-1
+1.0
+-1 = anim frame anim frame material texture vertex vertex texture 1.0 vertex 0.500000 1.0 vertex -1 = texture anim
+1.0 vertex 1.0
+vertex vertex = material texture
+vertex 1.0 bone
+material = frame
+= frame -1 frame =
+1.0 -1 bone
+1.0
+1.0
+=
+anim
+material material
+vertex
+material anim 1.0 frame
+material = = material -1 frame 0.500000 bone -1 -1 material bone
+= 1.0 1.0 1.0 frame 1.0 0.500000 = bone frame
+= -1 -1
+material anim 0.500000 anim material
+0.500000
+anim 1.0 texture frame vertex anim vertex -1 0.500000 bone material bone texture =
+vertex 1.0 anim frame 1.0
+1.0 bone -1 frame material
+anim anim
+frame 1.0 bone bone material
+material =
+1.0 bone
+material
+= anim frame =
+texture bone vertex anim vertex bone vertex -1 -1 anim 0.500000 -1 frame vertex -1 bone vertex 0.500000 -1 frame 1.0 frame vertex
+anim
+1.0 vertex -1
+1.0
+vertex vertex vertex frame
+anim anim
+frame = vertex -1 anim vertex 1.0
+bone
+vertex 0.500000 anim
+frame = material
+anim
+texture texture frame
+-1 bone material anim
+= 1.0
+=
+texture material vertex texture
+anim frame texture texture bone
+texture
+material material = 0.500000 material frame
+frame
+0.500000 frame 0.500000 frame
+anim
+0.500000 -1 material texture texture
+material 1.0 vertex bone material material
+anim anim texture 0.500000 material
+bo
\ No newline at end of file
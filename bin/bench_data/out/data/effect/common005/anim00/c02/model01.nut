@@ -0,0 +1,8 @@
+anim
+bone
+vertex material bone
+1.0 frame -1 bone material
+texture anim
+frame
+anim
+anim anim ve
\ No newline at end of file
@@ -0,0 +1,27 @@
+1.0
+0.500000
+vertex = anim = vertex 0.500000 anim texture bone
+bone bone 1.0 material 1.0 bone vertex = texture texture = 0.500000 -1 bone 0.500000 bone vertex
+anim =
+= 0.500000 -1
+frame 0.500000 = texture = = bone anim
+0.500000
+material vertex
+anim texture
+bone
+= anim -1 vertex texture frame material -1 = -1 1.0 anim -1
+bone vertex texture
+frame -1 0.500000 -1 0.500000
+vertex = = bone texture texture frame 1.0 vertex -1 frame = bone vertex
+anim 0.500000
+anim bone anim frame 1.0 material material anim = texture bone 0.500000 bone = frame material
+anim material
+-1 0.500000
+anim frame anim
+texture 0.500000
+bone
+vertex material material material texture 0.500000 texture
+bone texture 1.0 frame texture 1.0
+= vertex anim material bone vertex vertex
+anim texture material = 0.500000 -1
+0.500000 0
\ No newline at end of file
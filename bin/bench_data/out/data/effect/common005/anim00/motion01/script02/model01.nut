@@ -0,0 +1,14 @@
+material -1 material vertex anim 1.0 0.500000 = -1 0.500000 material material 1.0 -1
+= vertex -1 texture material
+material
+bone = texture vertex
+bone
+vertex 1.0 0.500000 1.0 bone
+1.0
+vertex material anim vertex
+= frame anim -1 -1
+material -1 -1 frame
+anim frame -1 = bone = -1 1.0 vertex
+texture
+0.500000 frame material
+-
\ No newline at end of file
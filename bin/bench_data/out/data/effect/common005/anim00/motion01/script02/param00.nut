@@ -0,0 +1 @@
+-1 texture texture bone bone vertex 1.0 texture material texture
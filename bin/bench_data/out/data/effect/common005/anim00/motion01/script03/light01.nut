@@ -0,0 +1,4 @@
+-1 material
+-1 bone
+bone frame texture material vertex = frame
+1.0 -1 0.500000 0.500000 -1 vertex frame 0.500000 vertex 
\ No newline at end of file
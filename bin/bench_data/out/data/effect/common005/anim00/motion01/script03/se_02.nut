@@ -0,0 +1 @@
+!*V_Βh`gGi$ԈfG\L<(LF_?wb!3CHJy!5>ꅢԤNTu1w-.܈לX9Ms2!;,Yܚ۷.QR#,!uZYflPRb`YZ³OĜ6R"^Og2Fra>w).
\ No newline at end of file
@@ -0,0 +1,6 @@
+vertex anim vertex vertex vertex frame
+texture =
+= material
+texture 1.0
+material 0.500000
+0.500000 vertex bone material bone anim = -1 material 1.0 
\ No newline at end of file
@@ -0,0 +1,237 @@
+=
+bone material bone = 0.500000
+0.500000 -1 anim -1 anim anim
+material 1.0 frame bone texture anim frame
+vertex texture 1.0
+material
+texture bone
+= 0.500000
+vertex frame anim -1 0.500000 bone vertex texture 1.0 vertex
+1.0
+texture = 0.500000 texture 0.500000 anim 0.500000 anim vertex
+vertex
+-1 anim = 0.500000 anim bone texture frame = -1 frame bone bone -1 anim 1.0 1.0 = 0.500000 texture bone
+= texture anim
+material material material 0.500000
+vertex
+anim 0.500000 -1 vertex -1 vertex =
+= 1.0 anim vertex 1.0
+1.0 bone
+vertex anim = frame -1 1.0 bone
+-1 material 0.500000
+anim frame texture
+material
+frame vertex anim material
+0.500000
+vertex frame 0.500000 -1
+anim
+1.0 frame frame
+frame vertex bone
+=
+1.0 vertex -1 material texture = vertex 0.500000
+texture
+anim 0.500000
+material
+0.500000 -1 frame bone bone bone = 0.500000
+bone material bone
+material
+0.500000 texture anim material vertex -1 texture
+0.500000
+vertex
+1.0 1.0 material material 0.500000 = 0.500000 anim bone frame bone 0.500000 1.0 vertex -1 = texture vertex
+texture
+texture texture 0.500000 -1
+1.0 texture 1.0 = anim
+frame 0.500000 1.0
+vertex vertex anim 1.0
+1.0 frame
+anim 1.0 -1 bone anim
+frame material frame texture texture texture bone material
+frame vertex 0.500000 =
+-1 vertex = = anim material material vertex
+texture 0.500000 vertex frame
+0.500000 1.0
+0.500000 = 0.500000 frame anim bone anim material frame texture material
+1.0
+anim
+=
+anim anim material material texture material 0.500000 material bone 0.500000
+bone
+bone -1 vertex
+bone bone bone -1 texture frame
+material vertex frame bone = = texture = vertex
+anim bone anim = = = anim
+anim
+bone texture vertex bone anim
+frame anim =
+frame vertex bone bone -1
+vertex vertex texture anim
+0.500000 bone 1.0 0.500000
+material
+material frame
+= bone 1.0 anim bone frame
+texture texture
+texture material texture 0.500000 anim
+vertex
+0.500000 anim 0.500000
+anim =
+vertex bone vertex
+frame 0.500000 = bone bone bone anim frame bone
+material = frame material
+frame
+= = frame = anim 1.0 0.500000 = vertex bone
+1.0 anim 0.500000 -1 = vertex anim material -1 texture material
+material bone
+anim
+= 0.500000 1.0
+frame
+1.0 frame 1.0
+vertex -1 = = 1.0 material -1
+material =
+1.0 material
+0.500000 -1 1.0
+anim
+0.500000 1.0 material vertex -1 material 0.500000 material
+bone vertex material 1.0 frame vertex -1 bone = 1.0 -1 frame
+0.500000 = bone 0.500000 -1 -1 0.500000
+texture -1
+material 0.500000 1.0 frame 1.0 frame = texture vertex vertex
+-1 0.500000
+bone 1.0 0.500000
+material frame -1
+material frame texture texture texture
+= anim
+bone = vertex
+-1 = bone
+bone texture anim material
+1.0 =
+anim 0.500000
+texture -1
+-1 bone anim
+frame texture -1
+1.0 -1 vertex texture frame
+material material texture -1 = frame frame
+= = 1.0
+anim -1
+anim
+frame -1 anim
+texture material 1.0 0.500000 anim
+vertex 0.500000 anim anim material anim = 0.500000 0.500000 anim material
+1.0 texture =
+=
+material
+-1 texture frame texture anim bone 1.0 = material vertex frame = anim
+texture 1.0 -1 -1 bone material anim bone frame material -1
+vertex
+-1
+1.0 frame
+texture bone vertex vertex anim vertex vertex anim bone anim anim texture
+-1
+material vertex anim material 1.0 vertex 1.0
+frame frame 1.0 frame
+frame
+texture
+material material
+1.0 1.0 anim material 1.0 anim texture -1 0.500000 material anim
+1.0
+texture = 0.500000 = 1.0 0.500000
+frame
+-1 -1 0.500000 1.0 vertex -1 anim
+1.0 vertex anim material
+= = anim frame 1.0 material 1.0 1.0
+anim 1.0 material
+-1
+texture bone anim texture 0.500000 frame
+vertex
+0.500000 1.0 -1 material 0.500000
+1.0 texture
+= texture
+bone anim = material 1.0 vertex
+= = frame frame texture 1.0 anim = = anim -1 material 0.500000
+vertex -1 texture 0.500000 -1 = texture -1
+0.500000 vertex = =
+bone material -1
+= texture = vertex bone bone =
+-1 material 0.500000 material bone frame
+= 0.500000 material -1 vertex
+material
+anim anim = -1
+vertex anim anim 1.0 texture bone vertex
+frame
+bone frame =
+frame texture
+= texture
+vertex
+1.0 anim material anim 0.500000 bone bone 1.0 texture 0.500000 bone 1.0 anim 1.0 anim 1.0 = vertex = material 0.500000 = frame
+1.0 frame texture =
+1.0 -1 vertex = frame
+vertex -1 -1
+texture material
+material material
+texture = frame
+-1 material vertex -1 material 1.0 0.500000
+anim material
+vertex
+0.500000 = = frame
+1.0
+anim
+material anim bone
+-1 texture 0.500000 0.500000
+bone texture frame material
+-1
+anim
+vertex 1.0 anim 0.500000 1.0 bone 1.0 frame frame 0.500000 texture
+material
+material material texture
+frame anim
+frame
+anim -1 -1 material -1 bone = vertex = vertex 1.0
+material bone
+0.500000 vertex = material
+material anim frame =
+0.500000 frame vertex vertex bone material material -1 = texture bone 0.500000 bone vertex anim bone vertex = texture material
+material texture frame
+-1 texture vertex
+0.500000
+bone frame vertex -1 =
+-1 anim bone
+0.500000 0.500000
+material -1 0.500000 frame bone -1
+1.0 -1 frame
+frame 0.500000
+= texture texture frame
+0.500000 = -1 frame texture vertex -1 -1 1.0 =
+texture bone bone frame
+material
+texture = 1.0 -1 texture
+=
+bone 0.500000 -1 frame
+anim anim material texture anim
+0.500000 material =
+anim -1 bone -1 = =
+anim 0.500000
+frame bone 1.0 texture 0.500000 texture anim frame bone
+anim
+texture vertex bone
+1.0 vertex
+1.0 0.500000 0.500000
+texture bone
+anim vertex vertex
+bone material bone -1 texture 1.0
+frame
+0.500000 = bone frame anim anim vertex 1.0
+vertex bone 1.0
+0.500000 -1
+1.0 0.500000 material
+0.500000 anim 1.0 bone 1.0
+texture vertex
+vertex
+= material material material texture vertex texture = 0.500000 bone
+0.500000 bone
+-1 texture bone material 0.500000 texture -1 frame
+vertex 1.0 vertex texture 1.0 = 0.500000 -1 bone material
+anim frame texture 0.500000 -1 0.500000 frame texture
+vertex texture frame texture
+material vertex
+frame material =
+= frame frame vertex v
\ No newline at end of file
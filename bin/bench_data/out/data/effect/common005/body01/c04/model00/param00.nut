@@ -0,0 +1,330 @@
+material anim
+anim
+texture -1 0.500000
+vertex frame = -1
+-1 material
+1.0 bone
+0.500000
+-1
+1.0
+material vertex -1 anim material
+= 1.0 vertex
+-1 = 1.0 1.0 anim 1.0 -1 -1 bone
+-1 material 0.500000 0.500000
+vertex material
+bone frame bone
+= material texture vertex
+0.500000
+-1 -1
+texture
+1.0 vertex
+1.0
+bone texture anim -1 1.0 1.0 = texture 1.0 0.500000 vertex
+vertex
+texture frame vertex 0.500000
+-1 = texture anim = vertex anim
+vertex = 1.0 1.0 vertex texture -1 material frame -1
+frame
+anim
+= vertex texture
+-1
+= material bone bone
+vertex =
+1.0 anim
+texture anim -1 frame 0.500000 texture frame 0.500000
+-1 anim -1
+frame = anim
+vertex 0.500000 material
+vertex
+= frame =
+-1 vertex bone vertex
+0.500000 material
+0.500000 material material -1 0.500000 vertex frame 0.500000 = anim = 1.0 -1
+1.0
+frame vertex
+1.0 anim 0.500000 anim anim
+texture texture vertex 1.0 texture anim texture
+-1 1.0 bone bone frame -1 vertex = material 1.0 material
+vertex
+0.500000
+-1
+bone 1.0
+1.0 =
+= = bone texture
+material
+anim 0.500000 1.0
+texture = anim bone anim vertex
+-1 vertex material anim vertex frame = vertex 1.0 1.0
+bone
+material material vertex vertex
+frame = frame bone frame
+1.0 -1
+vertex = frame
+1.0 bone
+material
+frame vertex 0.500000 -1 -1 0.500000
+bone material
+bone -1
+texture material vertex anim
+frame 1.0 texture
+vertex vertex = frame 0.500000 bone
+vertex = bone -1 texture 0.500000 frame 0.500000 1.0
+texture anim material -1 -1 -1 material vertex anim -1
+bone vertex texture 1.0
+frame texture texture 0.500000 -1 texture 1.0 texture
+frame 0.500000 1.0 0.500000
+= 1.0 vertex 1.0 vertex 0.500000 anim bone -1 1.0 bone = 0.500000 frame =
+bone anim
+bone
+texture = -1 frame 0.500000 vertex frame 0.500000 frame bone -1
+-1 frame anim
+frame 1.0
+-1 texture anim 0.500000 -1
+vertex -1 = = 0.500000 1.0 material = bone material 0.500000 material = =
+material
+0.500000
+bone anim
+frame = anim frame texture -1
+frame frame bone anim 0.500000 texture
+-1 vertex
+anim vertex 0.500000
+texture vertex texture
+1.0
+frame 1.0 material anim material material -1 anim vertex frame
+1.0 -1 material 1.0 bone frame vertex texture
+material texture texture bone
+=
+-1 material = = frame material 1.0 frame
+0.500000 1.0 0.500000 material -1 frame
+frame =
+vertex
+anim 0.500000
+1.0
+bone vertex material
+0.500000
+1.0 bone frame
+anim frame bone frame
+= =
+bone
+material vertex = bone
+texture 0.500000 = anim
+-1 bone 1.0 1.0
+-1 material 0.500000 vertex
+-1 texture
+vertex 1.0 bone frame
+vertex 1.0 1.0 material material 1.0
+anim 0.500000 -1 -1 vertex material
+frame
+bone 1.0 0.500000 1.0 bone
+vertex
+1.0 frame = -1 1.0
+material = anim
+= vertex 1.0 -1 texture
+texture =
+bone vertex texture
+vertex anim = -1
+material texture bone
+vertex texture 1.0 =
+texture frame texture
+0.500000 vertex 1.0 bone = frame
+= frame frame 1.0
+= bone anim texture
+anim =
+frame 1.0 material vertex anim
+bone
+vertex
+1.0 = 0.500000 bone bone material bone -1 1.0 = -1
+vertex texture texture bone
+anim
+-1 frame material frame bone = frame vertex anim bone
+= 0.500000 0.500000 frame texture 1.0 -1
+frame 0.500000 -1 frame anim 0.500000 -1 frame = 0.500000 material 1.0 bone
+material texture 1.0
+1.0 texture material anim 0.500000 material material
+-1 vertex
+= = material vertex 0.500000
+= =
+1.0 0.500000 vertex texture vertex anim texture
+= = bone 0.500000 1.0 texture 1.0 material
+frame -1
+0.500000 = texture
+= texture -1 bone texture vertex texture material bone
+frame
+0.500000
+1.0 material
+vertex 1.0 frame
+1.0 = texture
+0.500000 material 1.0 -1 0.500000 = frame frame
+= 0.500000 -1 anim = material anim 0.500000 -1 1.0
+1.0
+anim 1.0
+anim
+frame -1 = texture vertex vertex
+vertex bone frame 1.0 1.0 bone frame
+material anim = 0.500000 anim bone bone
+-1 0.500000 texture texture
+-1 vertex frame texture bone frame =
+vertex 1.0
+frame -1 = bone 1.0
+= anim vertex -1 texture material bone -1 vertex material -1 1.0 material bone = 0.500000 material
+1.0 bone
+frame frame bone frame bone material 0.500000 bone 0.500000
+-1 frame material 0.500000 0.500000 bone texture 0.500000
+0.500000
+0.500000 = 1.0 -1 -1 vertex anim frame vertex material 0.500000 vertex vertex material 0.500000 1.0 texture
+= 0.500000 vertex material 1.0
+material
+1.0
+anim -1 vertex frame =
+-1 0.500000 0.500000 anim texture 1.0
+texture
+1.0 bone 0.500000 material
+material material
+bone
+texture material
+vertex 0.500000 anim frame bone
+= = vertex 1.0
+-1 0.500000 vertex material -1 =
+-1 material 0.500000 0.500000
+0.500000 = 0.500000
+texture vertex anim material
+= anim texture
+bone
+= material 0.500000 0.500000 = texture texture
+anim = texture anim material
+frame anim anim vertex 0.500000 -1 anim 1.0 anim material anim -1 frame bone 0.500000 frame bone
+0.500000 material
+1.0 bone
+-1 -1 = 1.0 -1
+vertex anim
+vertex texture
+1.0 1.0
+-1 material
+frame anim material = bone -1 = bone texture texture
+bone
+= bone vertex -1 frame
+anim material anim 0.500000 material 1.0 anim
+material -1 material anim anim vertex frame
+material anim
+= =
+= 0.500000 anim = =
+-1
+= texture
+texture texture bone vertex anim -1 0.500000 1.0 material vertex
+texture bone -1 vertex frame 1.0 bone
+0.500000 material = = anim
+material frame
+texture material texture bone 0.500000 material frame -1 -1
+vertex bone bone 0.500000 = 1.0 -1 1.0 bone frame material
+material
+frame -1
+=
+frame material
+vertex texture material frame -1
+vertex 1.0
+1.0 1.0
+material
+= material frame frame bone bone
+anim 1.0 vertex material
+vertex = anim frame -1 = anim
+bone 1.0 texture
+vertex -1 anim vertex anim
+vertex frame vertex = vertex
+frame 0.500000 vertex material
+anim
+vertex
+anim frame
+-1 = material frame bone material frame
+frame
+0.500000 0.500000 = frame
+anim frame frame 0.500000
+bone
+0.500000
+texture bone
+= vertex vertex material 1.0 vertex
+material 1.0 material material -1 bone 0.500000 1.0 bone frame
+0.500000
+vertex
+vertex
+0.500000 frame -1
+anim frame bone
+0.500000 bone texture vertex material vertex texture = = texture frame
+0.500000
+1.0 texture = 1.0 material 1.0 =
+-1
+frame bone =
+texture 1.0 texture bone anim
+= 0.500000 -1 material 0.500000
+0.500000 texture 0.500000 anim
+0.500000 = 1.0 frame vertex
+-1 anim 0.500000
+= material 1.0 1.0 = 1.0 vertex vertex
+= 0.500000
+1.0 texture 1.0 -1 vertex vertex = 0.500000 anim -1
+=
+frame anim material frame
+material vertex
+bone material frame
+vertex bone material 0.500000
+frame 1.0 material texture
+0.500000 material = bone
+-1 anim frame anim texture
+vertex material -1
+vertex -1 = material frame -1
+material 0.500000 vertex 0.500000
+bone -1 vertex frame 1.0 0.500000 bone material
+-1 bone texture 0.500000 material vertex vertex
+material 1.0 texture
+anim material
+bone vertex
+anim anim 0.500000 vertex frame anim -1 bone 0.500000 1.0
+-1 frame 1.0 -1 vertex vertex 1.0 =
+0.500000 1.0 vertex vertex texture
+material 1.0 anim = 1.0 -1 frame vertex texture material 1.0 texture 0.500000 1.0 material texture
+1.0 vertex 1.0 bone 0.500000 bone 1.0
+frame material vertex
+bone
+= material = material
+bone texture 1.0 texture 0.500000 anim 0.500000 material texture vertex material
+0.500000 bone anim =
+1.0 texture texture anim bone material
+frame vertex texture vertex 1.0 frame 0.500000 = bone
+=
+material -1
+0.500000 material -1 vertex 0.500000
+material
+-1 bone
+frame
+vertex = anim 1.0 anim -1 texture
+vertex texture material
+-1 = bone material bone -1
+frame = vertex
+vertex -1 frame texture frame
+material 0.500000 1.0 1.0 -1
+texture -1 0.500000
+bone 0.500000
+1.0 vertex 1.0 material material texture anim = =
+= texture texture anim =
+vertex
+frame
+frame
+texture bone = frame = material = = vertex 0.500000
+frame
+material material frame anim -1 material texture
+bone 0.500000 0.500000 0.500000
+1.0 anim frame 0.500000
+material bone bone frame
+= vertex
+= anim 0.500000 frame material
+bone = texture frame frame
+texture = vertex -1 vertex material frame texture =
+material 0.500000 bone
+anim vertex vertex
+anim 1.0 bone -1 0.500000 frame = frame -1 = vertex 1.0 frame 0.500000 = texture material
+material vertex 0.500000 vertex texture bone
+0.500000 vertex 1.0 anim
+anim -1 0.500000 material
+texture vertex anim bone bone anim material 1.0 = anim material
+frame -1 -1 anim bone texture vertex frame -1
+material
+1.0 frame vertex = material text
\ No newline at end of file
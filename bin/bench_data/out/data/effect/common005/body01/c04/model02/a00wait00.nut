@@ -0,0 +1,4 @@
+vertex = = material material material
+-1 0.500000 -1 0.500000 vertex texture
+texture -1 0.500000
+1.0 anim material bone 0.500000 texture = material 1.0 frame -1 1.0 vertex anim anim a
\ No newline at end of file
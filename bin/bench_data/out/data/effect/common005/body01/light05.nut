@@ -0,0 +1,93 @@
+bone 0.500000 vertex -1
+texture anim frame -1
+texture
+material material 1.0 anim vertex anim
+anim
+= 0.500000 texture 1.0 frame 0.500000
+vertex frame texture
+0.500000
+bone
+-1
+texture
+bone = material = 1.0 material bone -1 = texture texture vertex
+0.500000 vertex texture
+texture
+vertex -1 anim 1.0 0.500000 frame 0.500000 frame 1.0 anim texture frame -1 -1 anim 1.0
+material
+1.0 bone bone -1 -1
+vertex 1.0 texture material anim frame material 0.500000 bone bone = =
+-1 = =
+vertex
+= = vertex bone vertex
+0.500000 0.500000
+frame =
+texture
+anim 0.500000 vertex texture bone
+bone texture anim vertex
+1.0
+anim
+0.500000 1.0 -1
+-1 1.0 texture
+vertex bone
+-1 1.0 -1 anim frame -1 material 1.0
+-1 1.0 1.0 anim frame texture 1.0
+0.500000 texture =
+0.500000
+0.500000 0.500000 vertex 0.500000 0.500000 1.0
+texture texture =
+1.0 -1
+0.500000 0.500000 -1 anim bone
+bone
+1.0 -1 -1 material
+bone texture
+bone frame texture
+=
+0.500000 0.500000
+=
+texture =
+bone frame vertex
+vertex
+frame vertex
+-1 0.500000 vertex 1.0 vertex
+1.0
+texture bone
+bone 1.0
+material 1.0 frame vertex material 0.500000
+anim
+frame
+1.0 bone material
+frame
+0.500000
+-1 frame
+frame material 1.0 texture anim frame frame vertex texture
+bone vertex 1.0 material -1 anim =
+frame material vertex anim
+-1 bone anim frame
+material -1 0.500000 texture anim
+-1 anim
+-1
+0.500000 1.0 vertex anim 0.500000 texture frame bone = material
+material = frame
+-1 texture 1.0 bone -1
+= material bone texture -1 vertex vertex material = -1 bone texture -1 -1 =
+vertex = texture = material vertex 1.0 bone vertex texture
+material 0.500000 -1 0.500000 anim vertex bone frame = material vertex bone
+anim bone
+0.500000 -1 texture = vertex 0.500000
+0.500000 material
+anim anim bone
+0.500000
+texture anim material
+= = texture vertex
+0.500000 anim -1 bone = material material anim
+0.500000 bone frame material bone
+vertex
+material = frame
+vertex frame bone 0.500000 = 1.0 = bone frame 1.0 = frame -1 material 1.0 frame bone 0.500000 frame 0.500000
+material = 0.500000 -1
+vertex -1 frame vertex
+= anim
+frame
+vertex = texture 0.500000
+= anim = = material bone
+frame 0.5
\ No newline at end of file
@@ -0,0 +1 @@
+@]=bf`Kb䪞$fOhdVPm~t4'`l
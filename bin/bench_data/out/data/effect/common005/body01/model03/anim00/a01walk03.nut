@@ -0,0 +1,50 @@
+anim
+material texture frame bone 0.500000
+0.500000 -1 material frame
+vertex 0.500000 = frame -1 vertex -1
+0.500000
+0.500000 bone vertex material -1 frame = material frame bone
+material anim texture 0.500000 anim 1.0 material = = 1.0 -1
+vertex
+vertex frame bone frame
+0.500000 -1 0.500000 texture = bone
+= bone -1 1.0 texture =
+frame bone -1 anim texture 0.500000 -1 1.0
+material texture frame
+0.500000 frame vertex
+anim 0.500000
+= material texture = vertex texture
+material 0.500000 -1 -1 anim vertex material bone frame texture
+vertex frame =
+material -1 anim anim 0.500000 0.500000 0.500000 material vertex frame texture 1.0
+bone material
+-1 = vertex
+1.0
+texture material
+0.500000 = bone
+material material
+1.0 texture =
+-1
+= material
+0.500000 -1 =
+bone
+0.500000 frame -1
+= material frame vertex 0.500000 = anim bone frame
+bone = material texture 0.500000 frame
+material frame anim
+= 1.0 bone anim 1.0 anim -1 1.0 0.500000 1.0 vertex anim frame bone anim
+texture bone
+0.500000 0.500000 material vertex anim vertex 1.0 anim 0.500000
+=
+-1
+0.500000 1.0 0.500000 vertex frame -1
+texture 0.500000 material
+= frame frame frame texture
+material
+material texture
+vertex 1.0
+frame -1 = vertex 1.0
+bone 0.500000 =
+frame vertex
+anim texture 0.500000 bone vertex anim = 1.0 texture material material anim
+anim
\ No newline at end of file
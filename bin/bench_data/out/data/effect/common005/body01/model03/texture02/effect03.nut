@@ -0,0 +1,4 @@
+texture
+texture 0.500000 frame
+1.0
+material texture -1 vertex frame bone texture -1 
\ No newline at end of file
@@ -0,0 +1,8 @@
+material = material = anim bone material -1 material
+= frame 1.0 frame texture bone
+vertex vertex -1 material frame 1.0
+vertex
+-1 anim material -1 bone texture
+0.500000
+bone vertex =
+bone anim material m
\ No newline at end of file
@@ -0,0 +1,42 @@
+-1 -1 -1
+1.0 -1
+bone anim = material = anim = texture
+bone -1
+1.0 bone
+texture = texture
+0.500000 texture texture
+bone anim 0.500000
+= = texture bone 1.0 anim anim 1.0 0.500000
+material
+frame
+vertex 0.500000 bone
+anim
+= -1 0.500000 texture 1.0 0.500000
+bone frame frame bone -1 anim texture = -1 0.500000
+bone
+-1 0.500000 texture frame anim vertex -1
+material -1 bone texture material -1 = bone texture 0.500000 material bone frame
+material material = anim frame vertex vertex
+-1 = -1 0.500000
+vertex =
+= material 0.500000
+frame = vertex -1 material = material 0.500000 texture 0.500000
+0.500000 0.500000 bone frame frame
+1.0
+frame texture
+0.500000 bone -1 texture = 0.500000 vertex texture frame
+anim bone bone -1
+anim = -1 material texture = anim bone texture vertex material 0.500000 bone material bone material frame 0.500000 vertex texture
+1.0 -1 1.0
+frame texture 1.0
+-1 -1 material -1 1.0
+=
+bone bone texture
+1.0 1.0
+bone anim texture
+= vertex -1 bone -1
+1.0
+1.0
+bone
+bone
+anim vertex material materi
\ No newline at end of file
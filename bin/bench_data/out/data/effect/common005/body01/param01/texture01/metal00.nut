@@ -0,0 +1,62 @@
+anim
+0.500000
+vertex = anim anim bone
+texture vertex -1 bone material
+frame texture
+material = 1.0 anim = texture -1 vertex frame
+texture = = bone anim
+1.0 material material -1 1.0 =
+material material
+vertex 1.0 anim frame = 1.0 vertex texture material vertex frame
+= frame 0.500000 0.500000
+frame
+bone 0.500000 = material 0.500000 anim 1.0 frame -1
+material bone texture 1.0
+= =
+bone frame 0.500000 = 0.500000
+bone 1.0 anim vertex 1.0 bone texture 1.0 = texture material
+anim
+1.0
+bone
+bone
+material anim
+vertex texture vertex
+= = = bone
+frame vertex 1.0 material texture material
+frame vertex 0.500000
+anim bone
+material = = anim texture frame 1.0
+=
+1.0 1.0
+bone texture
+material frame texture material vertex material = -1 1.0 frame frame vertex = frame
+1.0 = vertex 0.500000 texture anim bone anim
+0.500000 texture material
+0.500000 = texture -1 = anim
+material texture vertex frame 1.0 0.500000
+anim
+texture anim anim
+1.0 0.500000 bone bone material bone
+= vertex vertex anim frame -1 anim vertex 0.500000 bone
+frame
+anim texture material
+= texture vertex material 1.0 material 1.0 vertex -1 1.0 -1 -1 frame
+vertex anim material vertex texture 1.0
+=
+0.500000
+texture 0.500000 = -1 = texture material
+0.500000
+bone
+= 1.0
+texture
+1.0 bone
+1.0 -1 vertex 0.500000 anim
+-1 bone -1 texture vertex material 0.500000
+frame 1.0 texture material anim vertex
+texture bone material = = bone texture texture
+-1 frame 1.0 =
+vertex bone =
+material =
+0.500000 vertex
+0.500000 -1 bone
+bone anim frame = 1.0 1.0 anim texture 
\ No newline at end of file
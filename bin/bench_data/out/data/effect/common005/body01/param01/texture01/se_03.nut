@@ -0,0 +1,3 @@
+= texture 1.0 1.0 bone 1.0
+1.0
+0.500000 texture = = 1.0 texture ve
\ No newline at end of file
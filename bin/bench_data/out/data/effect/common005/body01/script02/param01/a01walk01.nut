@@ -0,0 +1,174 @@
+material = material
+bone anim = material 1.0 texture vertex 0.500000 0.500000
+material 0.500000
+texture 0.500000 -1 1.0 texture texture 0.500000
+texture vertex 0.500000
+material frame anim
+frame 1.0 material vertex
+anim 1.0 vertex material 1.0 material
+texture bone
+1.0 material bone bone bone frame
+vertex material -1 texture =
+material -1 frame vertex texture bone
+material texture vertex
+vertex bone frame vertex 0.500000 bone -1
+frame bone bone = material material
+= material frame texture 0.500000 -1 vertex
+1.0 bone
+0.500000 1.0 bone
+0.500000 bone 1.0 bone texture
+frame
+= 0.500000
+vertex material bone 1.0 material
+bone frame
+anim
+material
+1.0 = material 0.500000 -1 anim 1.0
+-1 1.0
+0.500000 -1 frame -1 1.0
+material 0.500000 bone 0.500000
+0.500000
+1.0
+0.500000 vertex
+texture vertex texture texture material
+anim 0.500000
+bone bone -1 material =
+1.0 0.500000 vertex
+bone anim texture material frame
+-1 -1 texture 0.500000 1.0 bone
+-1 -1 texture
+bone vertex anim -1 material 0.500000 frame
+0.500000 = 0.500000 vertex = material 0.500000 bone
+vertex 1.0 1.0 1.0 vertex material texture -1 =
+texture
+material 1.0 material -1
+texture texture vertex 0.500000 texture bone material bone bone
+0.500000
+vertex frame frame frame 0.500000 0.500000 0.500000
+anim vertex
+texture texture anim =
+texture anim
+frame = texture 0.500000 -1 material 1.0 -1 = = = bone anim
+anim texture
+1.0
+=
+bone 0.500000
+-1 1.0
+texture vertex
+vertex
+material vertex 0.500000 vertex = 1.0 vertex = bone frame 0.500000
+vertex
+bone frame
+frame
+frame
+=
+1.0 material
+anim material 0.500000 frame anim
+=
+texture
+texture
+= anim bone material -1 = anim
+vertex
+vertex 1.0 vertex -1 texture bone
+= anim texture 1.0 0.500000
+texture anim
+frame bone
+vertex
+0.500000 texture frame frame = 1.0
+frame material bone -1 texture
+vertex
+vertex
+= 0.500000 frame anim frame -1 material anim 0.500000 material 1.0
+anim frame bone 1.0
+0.500000
+-1
+vertex texture anim
+0.500000
+= anim vertex = anim -1 frame vertex
+material anim -1 1.0
+= vertex texture -1
+-1
+frame -1
+= texture 1.0 1.0 material 0.500000
+material anim 0.500000 1.0 0.500000 0.500000 1.0 -1 texture
+= bone texture
+=
+-1 frame
+bone anim
+1.0 bone -1
+1.0 1.0 -1 -1 0.500000 anim
+vertex
+-1 0.500000 anim anim
+frame
+texture vertex material -1 0.500000 -1 texture
+0.500000 = 1.0 texture frame frame 1.0
+frame anim anim texture 0.500000
+anim vertex
+1.0 texture 0.500000 material
+-1 material vertex
+frame material vertex
+= 0.500000 vertex frame
+vertex
+-1 vertex material bone material = frame -1 material
+0.500000 vertex
+= 0.500000
+-1 bone =
+vertex bone anim =
+material
+vertex vertex = 0.500000
+anim 1.0 1.0 vertex 1.0 bone 0.500000 anim
+-1 0.500000 = = material 1.0 vertex texture vertex
+0.500000
+texture 0.500000
+0.500000 bone 0.500000 1.0 vertex anim 0.500000 material frame = vertex -1
+texture 0.500000
+0.500000
+material
+vertex 0.500000 texture -1 frame anim frame -1 = texture
+vertex material texture anim frame texture vertex 0.500000 anim
+material
+vertex
+-1 frame -1
+frame
+vertex anim bone
+bone =
+1.0 bone texture 1.0
+texture
+=
+-1 frame texture
+bone material material material = texture 0.500000 vertex = 0.500000 anim bone
+vertex 0.500000
+0.500000 material 0.500000 0.500000 -1
+material bone material material bone vertex material vertex
+frame bone 1.0 -1
+material material
+-1 material
+vertex -1
+-1 -1
+bone material bone
+bone 1.0 material bone frame anim
+texture bone
+-1 frame frame material anim material material material material frame
+0.500000 0.500000 -1 1.0 anim anim
+vertex -1 vertex texture material -1
+0.500000 1.0
+= bone texture anim
+0.500000 bone
+0.500000 1.0 texture
+0.500000 = bone frame -1 anim = = 0.500000 texture
+= 0.500000 = 1.0 texture = texture 0.500000 material
+vertex material
+0.500000 frame material frame material vertex texture =
+texture 1.0 bone 0.500000 bone 1.0
+-1 0.500000
+texture bone vertex anim vertex
+texture anim
+1.0 vertex material frame 1.0
+anim texture
+= 1.0 material anim material material frame 1.0 =
+texture anim 1.0 texture bone
+0.500000 vertex = anim
+material -1
+1.0 anim vertex = =
+1.0 1.0
+material = material
\ No newline at end of file
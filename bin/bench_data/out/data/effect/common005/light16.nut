@@ -0,0 +1 @@
+frame vertex texture vertex vertex bone 0
\ No newline at end of file
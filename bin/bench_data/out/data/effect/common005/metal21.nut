@@ -0,0 +1,11 @@
+0.500000 = 0.500000 0.500000 texture anim -1 vertex 0.500000 texture texture texture material 0.500000
+anim
+vertex 1.0 = 0.500000 = material frame anim vertex
+1.0 bone texture material = vertex bone -1 bone frame 1.0 -1 vertex anim vertex = bone 1.0 material =
+vertex anim
+1.0 material texture 0.500000 =
+anim anim vertex 0.500000 vertex vertex bone = material = = anim bone
+anim -1 vertex 0.500000 vertex texture texture vertex vertex frame
+anim 1.0
+= 0.500000 -1 anim 0.500000
+frame texture
\ No newline at end of file
@@ -0,0 +1,16 @@
+anim
+texture
+material -1 1.0 -1 anim frame -1
+1.0 = -1 0.500000 = anim vertex
+material
+= frame material bone
+-1 1.0 0.500000
+-1 0.500000 material anim
+vertex
+frame vertex frame 0.500000 vertex bone frame bone texture
+anim
+texture anim
+texture bone vertex = 0.500000 texture bone =
+material material frame
+anim 0.500000
+bone bone -1 1.
\ No newline at end of file
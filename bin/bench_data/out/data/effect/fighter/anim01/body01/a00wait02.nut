@@ -0,0 +1,267 @@
+texture anim
+0.500000 =
+anim
+1.0 -1
+vertex 1.0
+0.500000 texture -1 1.0 material
+1.0
+material frame vertex 1.0
+bone anim 0.500000 frame bone vertex -1 texture
+anim texture frame
+bone
+-1 bone vertex texture texture
+bone texture 1.0 -1 anim
+frame 1.0 0.500000 =
+frame
+= texture vertex material material frame 0.500000 frame bone bone
+-1 vertex
+-1
+-1 1.0 1.0 vertex bone 0.500000 anim material 1.0 = anim
+texture vertex
+0.500000 1.0 =
+1.0 vertex 0.500000 vertex material
+anim texture texture = material anim material texture bone frame =
+frame
+material frame 0.500000 1.0 bone = 0.500000 0.500000
+bone texture anim frame
+texture
+1.0 bone anim frame vertex
+vertex -1
+frame -1 material = texture -1 frame bone material bone anim texture frame material -1 vertex = anim 1.0 bone 0.500000 texture 1.0
+texture bone bone frame =
+=
+1.0
+1.0 material 1.0
+= bone frame bone material
+vertex
+frame
+material vertex
+anim = vertex texture vertex
+anim texture 0.500000 material frame
+vertex 1.0 -1 0.500000
+= anim material 1.0 material frame = bone bone bone = 1.0 frame
+material anim 0.500000
+bone
+=
+bone
+0.500000 =
+vertex material 0.500000 1.0
+vertex texture
+0.500000
+frame
+-1 texture material bone bone anim texture = anim
+bone material
+0.500000 texture texture frame frame
+frame bone -1 texture -1 anim = =
+material material vertex texture =
+0.500000 frame anim anim
+= 1.0 1.0 -1
+material 0.500000
+bone
+0.500000
+bone 1.0 bone = texture
+1.0 0.500000 = texture
+frame texture material anim material
+frame
+frame 1.0
+bone =
+0.500000
+texture bone vertex = anim vertex
+bone bone
+=
+bone 0.500000
+texture material frame 1.0 material = -1 vertex
+vertex
+0.500000 = 0.500000 frame = = -1 = material =
+-1 vertex 0.500000
+0.500000 = vertex = bone frame -1
+texture frame 0.500000 anim
+frame 0.500000
+texture frame 0.500000 frame -1 bone texture anim = texture =
+= material -1 material -1 bone bone bone bone 0.500000 -1 1.0
+0.500000 bone material 1.0 bone -1 bone
+frame = vertex
+frame
+anim anim
+bone frame texture
+= -1
+frame anim anim material vertex
+0.500000 frame
+0.500000
+vertex -1
+= anim = = material anim 1.0 1.0 bone 1.0 material anim bone 1.0
+-1 0.500000
+= bone
+0.500000
+bone anim anim
+material
+1.0 vertex
+anim
+1.0 material =
+-1 vertex
+bone bone frame vertex 1.0 material vertex anim = frame frame 1.0 anim = frame 0.500000 bone = anim anim = vertex = vertex 0.500000
+anim vertex
+bone 1.0 0.500000 0.500000 anim anim -1 = bone material anim
+-1 = 1.0
+texture material anim bone
+anim 0.500000 vertex frame -1 material anim 0.500000 = texture frame
+-1 material 1.0 1.0 1.0
+texture
+texture frame material 1.0 -1 1.0 bone = frame 0.500000 0.500000 0.500000
+anim
+texture anim vertex anim frame 1.0 1.0 bone texture
+-1 material
+frame
+vertex material vertex -1 1.0
+vertex material 1.0
+frame 1.0 1.0
+material frame material material
+frame
+1.0
+-1 0.500000 vertex
+vertex
+anim -1 vertex -1 vertex -1 0.500000 0.500000
+bone frame frame
+-1 bone 1.0 -1 vertex texture = anim frame
+1.0 anim texture = 0.500000 -1 bone anim material 0.500000 1.0 = bone 0.500000 1.0 frame texture material =
+0.500000 -1
+bone
+0.500000 bone vertex 0.500000 -1 -1
+anim anim material vertex bone frame vertex material bone 0.500000 texture texture anim
+anim = frame anim
+0.500000 texture 1.0 -1
+texture texture frame -1 bone bone material frame 1.0 vertex =
+0.500000
+1.0 vertex texture bone 0.500000
+vertex vertex texture
+bone 0.500000 frame anim 0.500000 texture texture anim texture material bone
+-1 0.500000 -1 frame frame texture
+anim
+= frame bone texture bone
+= -1
+bone anim texture texture -1 -1 -1 material
+vertex 0.500000 texture
+bone 1.0 bone frame -1
+bone = 0.500000
+material 0.500000 bone
+frame 0.500000 texture anim texture anim material -1 = 1.0 -1 vertex = anim texture 0.500000
+frame -1
+material 0.500000 bone 1.0 = 1.0 texture
+material frame -1 0.500000 frame material texture anim texture texture
+material
+bone
+1.0 frame anim
+1.0 frame vertex 1.0
+=
+anim bone -1 bone bone bone -1 bone 0.500000
+bone bone vertex 0.500000 1.0 -1
+anim
+vertex bone
+= vertex 1.0 =
+-1
+bone vertex
+-1 vertex
+vertex 0.500000 texture 1.0 vertex = anim = 1.0 anim = -1 texture
+anim vertex vertex
+0.500000
+anim frame 0.500000 0.500000 texture frame bone vertex vertex -1 bone texture
+bone bone
+texture =
+material frame material bone -1 1.0 -1 1.0 anim frame -1
+1.0 0.500000 bone anim
+texture frame -1 -1 vertex -1 material
+material frame bone
+material anim bone material bone anim
+1.0 1.0
+1.0 = 0.500000
+=
+texture material -1 frame = = -1 vertex vertex = material
+bone
+material -1 -1 frame material 0.500000 bone texture
+texture
+texture -1 0.500000 anim texture texture material anim 1.0
+= -1 anim
+0.500000 -1 vertex material
+texture =
+-1 bone bone frame anim anim bone
+bone frame frame = anim 1.0 texture
+= bone texture material
+=
+frame = vertex 0.500000 texture bone
+= 1.0 -1 material 0.500000 frame bone
+vertex material 1.0 vertex material -1
+-1 bone material texture 1.0 1.0 anim
+frame material 0.500000 0.500000 1.0 =
+vertex 0.500000 vertex bone material
+0.500000 material = anim 1.0 frame 1.0 bone frame = 1.0
+1.0
+frame -1 frame texture 1.0 0.500000 vertex
+1.0 texture 1.0 bone bone
+-1 =
+= = texture 1.0 vertex vertex = anim bone -1 0.500000
+vertex 0.500000 frame 1.0 bone
+= frame
+-1
+frame
+bone
+-1 texture 1.0
+-1 texture -1 0.500000 -1
+1.0 -1 anim texture
+= bone anim
+0.500000 anim 0.500000 vertex
+anim frame
+material 1.0 bone vertex 0.500000 1.0 frame 0.500000 material bone 1.0 texture = anim -1 = 1.0
+-1 = -1 anim material texture vertex texture material
+-1
+material
+bone vertex 0.500000 0.500000
+vertex
+0.500000 anim 0.500000 -1 vertex = frame -1 0.500000
+anim 1.0 texture 1.0 0.500000 material texture
+frame
+1.0
+1.0 anim anim
+1.0
+bone
+material -1 frame
+1.0 -1 frame
+frame bone -1 vertex vertex frame
+material bone
+-1 -1 material bone texture 1.0
+material
+bone texture frame
+texture
+bone
+-1 1.0
+1.0
+texture frame material frame bone texture frame
+1.0 = 0.500000 anim material texture bone bone vertex anim
+bone 1.0 frame bone
+texture
+1.0 frame 0.500000 -1 material bone material 1.0
+=
+-1
+-1
+frame
+0.500000
+vertex
+vertex
+frame texture vertex texture 0.500000 anim material frame -1
+vertex
+texture = texture
+-1 frame = anim bone 1.0 vertex texture = frame -1 anim
+texture 0.500000 = = vertex 0.500000
+vertex frame 1.0 material
+frame
+vertex
+frame frame texture texture = texture bone anim texture
+frame 0.500000 material frame 1.0 bone -1
+0.500000 vertex texture 0.500000
+bone
+bone vertex
+texture
+anim = anim bone
+= material -1 vertex
+texture vertex
+=
+material = anim = 1.0 0.
\ No newline at end of file
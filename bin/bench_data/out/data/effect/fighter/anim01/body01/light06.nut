@@ -0,0 +1,8 @@
+=
+-1 vertex
+bone vertex =
+1.0 vertex frame = anim 1.0 vertex
+-1 = = 1.0 0.500000 -1 0.500000 material frame
+-1 frame bone material anim
+= -1 -1 frame = -1 material anim 1.0
+1.0
\ No newline at end of file
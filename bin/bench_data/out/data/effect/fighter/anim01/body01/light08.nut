@@ -0,0 +1,46 @@
+1.0 texture anim vertex material 1.0 1.0 texture -1
+material vertex -1 =
+anim bone frame frame = vertex frame material texture
+bone texture texture
+material
+bone frame vertex vertex 0.500000 vertex
+material 1.0 = anim 1.0 material texture 0.500000 frame vertex
+-1 bone material
+-1 bone 0.500000 -1 bone bone = vertex frame frame anim anim
+material = bone bone bone frame material
+texture 1.0 vertex
+= -1 texture
+texture
+-1
+-1 bone material material -1 -1 frame -1 vertex material bone material vertex bone bone 0.500000 material frame vertex 1.0
+0.500000 1.0 texture 0.500000 frame 1.0 -1 texture = 0.500000 -1 0.500000 vertex
+bone = bone -1 bone 1.0 anim -1
+frame 1.0
+=
+anim anim -1
+material
+-1 anim
+texture material bone -1 material -1 vertex 0.500000 texture = vertex 1.0 texture material 0.500000 -1 1.0 anim 1.0 0.500000 = 0.500000
+1.0 bone = frame vertex material -1 1.0 = material texture =
+0.500000 anim material vertex vertex
+-1
+= vertex anim
+frame
+anim = bone 1.0 texture = vertex texture 0.500000 1.0 bone vertex vertex anim anim anim anim 1.0 bone
+vertex material bone 1.0 material =
+= 0.500000
+1.0 anim = bone 0.500000 0.500000 anim anim bone frame anim 1.0 frame -1 bone
+=
+0.500000 -1 -1
+vertex
+vertex -1 -1 texture texture
+bone
+material vertex anim anim
+vertex bone vertex texture
+frame vertex frame anim frame material
+vertex
+material material bone material
+1.0 vertex -1 frame frame material
+= anim = anim
+anim bone frame 1.0 = bone vertex
+fra
\ No newline at end of file
@@ -0,0 +1,13 @@
+-1
+-1 bone 1.0
+material
+frame bone = = 1.0 frame
+bone
+bone material 0.500000
+1.0 =
+texture -1 anim material bone
+vertex material
+frame bone = frame = vertex 1.0
+material 1.0
+frame
+vertex vert
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture -1
+material
+material bone
+1.0 bone -1 material 1.0 material
+vertex material
+1.0
+texture vertex
+vertex
+= anim vert
\ No newline at end of file
@@ -0,0 +1,25 @@
+texture
+-1
+0.500000
+1.0 anim
+bone vertex bone anim frame bone
+vertex material = 1.0 bone frame
+anim bone -1 material
+vertex material -1 anim 1.0 frame
+frame material 0.500000 1.0 =
+=
+0.500000 1.0 bone
+frame anim = bone
+0.500000 texture -1
+anim
+= frame material vertex 0.500000 = texture
+material 0.500000 frame
+vertex material
+0.500000 anim vertex
+0.500000 material = material
+material
+anim 0.500000 1.0 -1
+= material 1.0 texture 1.0
+bone anim frame =
+bone anim 0.500000 0.500000 vertex = -1
+0.5000
\ No newline at end of file
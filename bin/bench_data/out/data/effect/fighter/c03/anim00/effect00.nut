@@ -0,0 +1,107 @@
+vertex material anim material 0.500000
+= 0.500000 anim
+texture vertex texture anim = -1
+1.0 = anim 0.500000 = material 0.500000 =
+1.0 0.500000
+-1 0.500000 -1 vertex anim frame 0.500000
+material = texture 1.0
+material 1.0 frame
+=
+anim bone anim
+=
+1.0 material texture = vertex
+0.500000 texture
+anim 0.500000 bone 1.0 -1 material
+1.0 bone = material vertex bone material material vertex frame
+vertex
+frame vertex frame
+frame texture 0.500000 bone 0.500000 0.500000
+1.0 -1
+0.500000 frame 0.500000 frame 1.0
+-1 bone
+1.0 frame
+anim 0.500000 = -1 anim 1.0 frame material bone
+anim bone
+vertex
+frame
+-1
+-1 material =
+vertex material frame 0.500000
+material -1
+0.500000 anim =
+anim 1.0 -1 -1 = frame texture texture -1
+bone
+=
+vertex -1 1.0 = frame
+1.0 material
+material material
+bone vertex anim texture
+=
+bone 0.500000
+0.500000 material = anim frame -1 texture material
+frame frame 0.500000 -1
+anim =
+anim
+bone material material -1 = anim material material -1 texture material frame 0.500000 0.500000 material 0.500000 anim vertex frame anim
+-1 texture
+texture material 0.500000
+bone -1 material material
+frame material frame vertex frame
+anim
+bone =
+vertex material
+= bone 0.500000 1.0
+anim frame
+vertex anim anim vertex 1.0
+1.0 material vertex anim
+texture texture 1.0
+anim texture
+material
+-1 vertex -1 bone bone
+-1 material
+= anim 1.0 = frame texture
+material -1 frame -1 material texture = material 1.0
+vertex vertex
+-1 0.500000 vertex = bone anim = frame 1.0 bone
+0.500000 bone frame 0.500000 frame 0.500000 anim bone anim frame
+frame vertex
+texture -1
+anim vertex -1 -1
+bone -1 anim frame texture texture texture
+-1 frame anim -1
+frame
+material
+texture -1
+0.500000 1.0 vertex texture texture
+0.500000 frame frame texture
+0.500000 texture = bone texture = texture
+bone -1 material texture
+= vertex anim anim frame bone vertex
+anim
+anim material 0.500000
+0.500000 frame 0.500000
+texture
+-1
+0.500000 1.0
+material
+anim = bone
+= = frame 0.500000
+bone 0.500000
+frame -1 texture anim -1 0.500000 frame = bone bone
+frame vertex texture vertex vertex anim
+= = 0.500000 bone = = bone anim
+texture frame
+-1
+bone bone material material
+material 0.500000 texture -1 anim texture
+bone bone
+0.500000 -1
+frame = = material = material anim
+0.500000 texture
+-1 0.500000 = anim frame
+=
+vertex 1.0
+material texture
+anim texture vertex
+= texture 1.0 bone 0.500000
+bone vertex bone vertex 1
\ No newline at end of file
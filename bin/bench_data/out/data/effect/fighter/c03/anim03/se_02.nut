@@ -0,0 +1,63 @@
+0.500000
+frame
+frame 1.0 material
+1.0 = vertex
+1.0 anim 1.0 material bone
+0.500000
+-1 anim vertex = 1.0 0.500000 anim
+bone
+texture 1.0 1.0 vertex
+texture = bone
+frame
+0.500000 1.0 texture
+texture bone anim vertex vertex frame
+-1 material = frame
+-1
+vertex = material -1 frame 0.500000 vertex
+1.0
+frame 1.0 anim bone
+-1 = vertex bone frame vertex
+texture 0.500000 texture 1.0
+1.0 bone 0.500000
+vertex 0.500000 anim 0.500000
+1.0 =
+frame 0.500000 0.500000 texture 1.0 0.500000 -1
+-1 vertex frame -1 = 1.0 frame texture
+-1
+frame anim -1 vertex texture = =
+0.500000 vertex anim anim material -1 texture
+vertex -1 -1 vertex 1.0
+1.0 =
+vertex material
+vertex -1 0.500000 vertex 1.0 material 0.500000 material vertex frame =
+material texture
+vertex
+anim texture 1.0 texture 1.0 anim vertex bone bone
+0.500000 0.500000 0.500000
+=
+material texture frame
+anim 0.500000 material frame
+frame
+material frame texture =
+texture frame frame
+vertex anim 1.0 bone -1
+texture texture material material
+= = anim anim 1.0 =
+1.0 anim material anim 0.500000
+0.500000
+bone
+1.0 texture 1.0 material
+0.500000 vertex texture 0.500000 bone 1.0 0.500000 frame frame frame
+= texture frame texture = = vertex bone bone
+vertex -1
+1.0 =
+anim -1
+1.0
+bone material texture
+material
+material texture anim 0.500000 0.500000 = = material 1.0
+frame
+-1 frame bone 1.0 anim vertex
+vertex = frame 1.0 anim material vertex 1.0 frame
+1.0 texture bone frame -1 bone bone bone bone frame
+frame texture material vertex 1.
\ No newline at end of file
@@ -0,0 +1,35 @@
+0.500000 =
+vertex -1 vertex bone material 0.500000
+= texture texture bone bone material anim 1.0
+frame -1 bone 0.500000 texture texture
+frame anim
+1.0 material -1 material 0.500000 frame material material 1.0 = frame
+-1
+bone
+frame
+vertex 0.500000 anim -1 -1
+texture = 1.0 material anim frame
+frame
+material 1.0 frame frame 0.500000
+-1 -1
+= 0.500000 bone vertex
+frame 1.0 0.500000 vertex frame material frame
+0.500000
+=
+= bone = vertex vertex
+= 1.0 0.500000 anim anim frame = 1.0 frame 1.0 -1 = frame
+texture frame 0.500000
+frame bone = = vertex -1 -1 material bone
+texture
+bone
+0.500000 0.500000 vertex
+anim 1.0
+frame 0.500000
+frame
+1.0 = texture texture = vertex bone = material texture = anim bone
+frame 0.500000 = frame vertex
+frame -1 1.0 bone vertex 1.0 anim 1.0 texture material = material bone 1.0 texture material =
+bone
+frame bone vertex =
+texture vertex
+1.0 anim material anim = -1 0.5000
\ No newline at end of file
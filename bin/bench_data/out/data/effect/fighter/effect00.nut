@@ -0,0 +1,9 @@
+=
+anim
+0.500000 -1 material vertex
+material material -1 = bone material texture =
+texture -1
+material 1.0 0.500000 1.0 -1 texture = texture
+texture -1
+texture bone material bone
+vertex 
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 -1 = 0.500000 0.500000 bone anim = 0.500000
+anim
+texture 1.0 vertex 1.0 = material 0.500000 = bone vertex =
+anim -1
+vertex -1 anim
+material bone frame te
\ No newline at end of file
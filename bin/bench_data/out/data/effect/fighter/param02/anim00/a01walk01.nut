@@ -0,0 +1,6 @@
+texture = 1.0 0.500000
+anim bone =
+anim
+-1
+frame
+texture 0.5
\ No newline at end of file
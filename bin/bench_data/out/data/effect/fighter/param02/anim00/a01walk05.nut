@@ -0,0 +1,7 @@
+frame anim bone
+frame texture vertex vertex 1.0 texture
+frame bone texture vertex frame material 1.0 anim frame
+anim frame 1.0 bone frame = vertex frame
+frame texture anim 1.0 texture bone 0.500000
+texture 0.500000 anim
+frame bone material vertex texture bone materi
\ No newline at end of file
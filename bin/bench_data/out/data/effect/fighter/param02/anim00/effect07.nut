@@ -0,0 +1,59 @@
+material -1 anim bone
+texture material -1 -1 material 0.500000 0.500000 material = texture 0.500000 frame
+= =
+-1 vertex
+material = material 0.500000 -1 material frame 0.500000 vertex bone
+1.0
+vertex
+0.500000
+1.0 1.0 = anim
+-1 material
+material 0.500000 material
+vertex -1 bone
+vertex 1.0 frame vertex 1.0 -1 texture -1 texture
+frame bone bone
+= -1 frame texture anim = anim 0.500000 bone bone material texture vertex 1.0 =
+-1
+1.0 material 0.500000 anim vertex anim
+frame anim =
+-1 frame = vertex
+material = -1
+1.0 bone 1.0 -1
+material
+1.0 texture -1 bone
+frame
+vertex 1.0 anim material
+bone material -1 frame = 0.500000 1.0 material anim
+texture -1
+0.500000 1.0 frame material -1 bone bone
+texture frame texture =
+anim 1.0 1.0 -1 material anim
+= texture bone
+-1 = texture = anim frame material 1.0 frame 1.0 1.0
+texture material -1 = 0.500000 = texture bone
+texture frame material -1 frame
+material =
+anim bone bone frame 1.0 material
+anim -1 anim vertex 1.0 anim
+frame bone -1
+frame
+texture = 1.0 1.0 material bone 0.500000 vertex = vertex vertex anim vertex
+bone 1.0 material vertex
+vertex anim
+texture 0.500000 = anim = 0.500000 1.0
+material 1.0 vertex -1 anim =
+anim -1 =
+texture material
+bone -1
+material
+frame 0.500000 texture
+0.500000 texture
+0.500000 material anim anim frame -1 -1
+anim frame 1.0
+material
+frame =
+0.500000 bone 1.0 0.500000 1.0 texture
+material texture frame frame
+vertex material texture frame texture =
+= 0.500000 vertex anim
+= ve
\ No newline at end of file
@@ -0,0 +1,4 @@
+frame 0.500000 vertex
+texture 1.0 0.500000 texture frame
+vertex anim 1.0
+anim 1.0
\ No newline at end of file
@@ -0,0 +1,10 @@
+texture
+= -1
+frame
+texture 0.500000 1.0
+anim = texture = bone
+vertex
+bone
+bone 0.500000 texture -1 = anim material = bone 0.500000 vertex material
+= 0.500000 0.500000 material vertex -1 anim material frame
+ma
\ No newline at end of file
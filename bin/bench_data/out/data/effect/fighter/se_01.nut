@@ -0,0 +1,85 @@
+frame -1 =
+1.0 bone
+0.500000 0.500000 vertex 1.0 frame frame vertex frame 0.500000 vertex 0.500000
+vertex material frame anim frame -1
+material 1.0 1.0
+frame frame anim anim -1 frame texture frame -1 material texture bone -1 bone frame
+anim bone
+vertex anim
+0.500000 frame frame bone
+1.0 material 0.500000 1.0 vertex 0.500000 0.500000 anim -1 = bone anim vertex anim bone texture = anim texture bone
+material anim = vertex vertex bone vertex frame material 0.500000 = 1.0 = material frame vertex vertex -1 1.0 texture
+material 0.500000 -1
+texture = material = bone
+anim texture -1 texture
+bone material -1 0.500000 bone
+= texture
+bone = frame 0.500000 bone -1 bone bone material vertex
+anim frame
+bone
+1.0 frame bone texture = 1.0
+vertex anim 1.0 1.0
+material -1 frame texture 1.0 -1
+bone material bone
+anim material anim
+vertex
+frame material
+bone
+0.500000
+=
+frame frame bone vertex material vertex material vertex vertex
+0.500000 texture -1 bone texture frame anim material texture
+1.0
+material
+0.500000 vertex frame bone
+vertex material
+vertex = texture 1.0 1.0 1.0 bone
+vertex anim vertex anim material
+frame
+bone 1.0 1.0 material
+anim vertex = -1 -1 0.500000 frame
+frame
+material frame material vertex
+=
+= -1 bone bone material
+texture bone anim 1.0
+frame
+frame 0.500000 = =
+anim material vertex
+vertex material 1.0 frame
+anim -1 -1 1.0
+bone texture 0.500000
+1.0
+1.0 anim
+texture
+texture = =
+0.500000 bone -1 0.500000
+texture frame 0.500000
+vertex = vertex anim vertex texture vertex vertex = 1.0 anim material bone
+frame
+0.500000
+anim texture = material 0.500000 = 0.500000
+texture frame texture
+bone texture anim
+frame texture -1 material
+= anim vertex material vertex texture 0.500000 0.500000 texture 1.0 -1
+texture 1.0
+0.500000
+=
+-1 vertex = =
+=
+material frame
+anim frame
+1.0 vertex = bone -1
+-1 material
+= material = -1 = frame
+vertex
+bone 0.500000 frame 1.0
+0.500000 1.0 anim vertex frame
+anim 1.0 material frame
+0.500000 -1
+1.0 texture
+= 0.500000 1.0 =
+frame
+0.500000 material vertex bone
+= texture materi
\ No newline at end of file
@@ -0,0 +1,4 @@
+material
+texture
+1.0 texture 1.0 1.0 -1
+-1 vertex vertex 1.0 bone material 0.5
\ No newline at end of file
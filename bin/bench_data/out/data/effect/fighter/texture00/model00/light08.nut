@@ -0,0 +1,10 @@
+anim bone -1 material
+-1
+texture -1 -1 0.500000 -1 -1 bone 0.500000
+1.0 material 0.500000 material material texture
+material vertex frame 0.500000 0.500000 vertex -1 material bone 0.500000 = bone bone 0.500000 bone frame material
+1.0 frame
+frame -1 texture
+= -1 frame 1.0 frame anim bone texture
+anim material
+material frame = -1 frame 0.500000 texture -1 = -1 material -1 = material frame 0.50
\ No newline at end of file
@@ -0,0 +1,38 @@
+-1
+anim vertex -1 vertex vertex
+1.0 frame vertex frame material anim frame bone vertex 1.0 = anim = -1 0.500000 = 0.500000 frame anim
+vertex frame = texture
+vertex 0.500000 vertex material 0.500000 frame bone vertex bone
+bone = anim anim anim
+1.0 1.0 -1 vertex
+anim bone 1.0
+texture
+frame
+bone 1.0 vertex
+frame
+frame
+vertex = anim vertex material
+1.0 vertex
+material
+anim
+anim 1.0
+= vertex 0.500000
+0.500000
+anim texture texture bone
+anim 0.500000
+1.0 vertex
+material -1 frame -1
+= 0.500000
+1.0 bone 1.0
+texture texture texture frame
+1.0 = frame
+material bone
+texture frame 1.0 anim texture
+material 1.0
+-1 material material anim -1
+frame
+texture 1.0 texture 0.500000 1.0
+material
+texture texture material 1.0 =
+= =
+material frame -1 0
\ No newline at end of file
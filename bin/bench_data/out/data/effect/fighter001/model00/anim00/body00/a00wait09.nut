@@ -0,0 +1,10 @@
+= =
+vertex
+texture vertex
+-1
+frame frame frame texture anim material material
+bone = 0.500000 vertex
+vertex = texture vertex
+texture 1.0 anim vertex 0.500000
+1.0 vertex 1.0 frame 0.500000 texture bone
+material 1.0 -1 material frame -1
@@ -0,0 +1,15 @@
+bone -1
+bone bone = bone texture
+material = bone = 1.0 -1
+anim = =
+= 0.500000 0.500000
+vertex
+bone frame vertex vertex
+vertex -1 1.0 0.500000 texture =
+bone = =
+anim 0.500000 frame anim texture 1.0 frame material
+frame
+material texture anim anim vertex -1 texture = 0.500000
+=
+vertex vertex
+bone 0.500000
\ No newline at end of file
@@ -0,0 +1,77 @@
+0.500000
+0.500000
+anim -1 = 0.500000 = = bone
+0.500000 1.0
+bone
+texture frame
+frame
+0.500000 vertex frame -1 texture vertex -1
+bone
+anim 1.0 0.500000 bone 1.0 vertex texture material texture
+= 0.500000 -1 0.500000 1.0 = = 0.500000 = vertex vertex = 0.500000 frame 1.0 vertex
+vertex bone vertex -1 -1 bone material anim 0.500000 -1 0.500000 material
+-1 anim texture material bone vertex
+= anim material vertex frame 0.500000
+0.500000 bone texture 1.0 -1 bone
+-1 0.500000 texture 0.500000 texture
+material bone bone texture material 1.0 -1 material bone material
+material 1.0 1.0 material
+= 1.0 frame bone 0.500000 = frame 0.500000
+texture
+1.0 0.500000 material 1.0 frame frame
+material texture texture 1.0
+-1 vertex
+=
+1.0 0.500000
+frame
+= -1 -1 bone
+-1 = frame texture frame anim 1.0
+0.500000 1.0 1.0
+1.0 material
+= 1.0 -1 frame material
+1.0 0.500000
+frame
+1.0
+anim frame 0.500000 0.500000 vertex -1 anim = =
+0.500000 -1 -1
+0.500000 anim
+0.500000 frame vertex texture frame
+material bone bone frame 0.500000 0.500000
+-1
+-1 = vertex =
+material bone texture 0.500000 1.0
+bone texture material frame 1.0 texture -1
+-1 -1 anim 1.0
+bone texture material material
+frame material 1.0 frame 0.500000 vertex 0.500000 1.0 anim vertex 1.0 bone = = frame material bone material = anim 0.500000 texture material 1.0 -1 anim
+frame
+texture texture -1 anim = 1.0 texture
+frame
+1.0 -1 frame material anim frame frame
+anim vertex = -1 bone anim
+bone vertex frame texture
+texture
+0.500000
+-1 0.500000 0.500000
+material -1 vertex -1 1.0 vertex =
+bone texture bone
+material
+texture
+material 0.500000 0.500000 bone frame texture bone
+0.500000 frame material
+material texture = vertex 0.500000 texture
+=
+frame anim
+bone anim 1.0 bone anim vertex vertex
+frame
+vertex -1 anim
+texture anim bone bone texture = 1.0 material 1.0 anim
+anim = -1 1.0 material material texture
+1.0
+vertex
+anim vertex
+1.0 material
+bone anim
+anim 1.0
+1.0
+1.0 0.500000 fra
\ No newline at end of file
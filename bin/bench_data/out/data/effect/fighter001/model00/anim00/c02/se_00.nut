@@ -0,0 +1,12 @@
+= bone anim
+texture texture -1
+1.0
+anim
+frame anim
+1.0 -1
+material -1 =
+0.500000 anim 1.0
+0.500000 anim 0.500000 = -1 1.0 anim frame material texture -1 bone bone 1.0 anim anim anim 1.0 -1 0.500000 -1 bone bone 1.0 1.0 texture bone material vertex material anim bone = 1.0 -1
+anim frame 1.0 -1
+-1 material
+= 0.500000 bone bone material bon
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 = = bone bone
+= vertex anim 0.500000 1.0 0.500000
+bone frame
+anim material 0.500000 -1 frame
+frame
+bone 0.5000
\ No newline at end of file
@@ -0,0 +1,13 @@
+bone
+=
+0.500000 material frame anim 1.0 frame
+vertex 0.500000 1.0
+material material 1.0 1.0
+bone = material vertex anim
+bone 0.500000 material
+= frame
+0.500000 1.0
+= 1.0 anim = -1 0.500000 material 0.500000 material bone anim frame 1.0
+=
+frame 0.500000 = anim anim 1.0 = = frame
+anim anim -1 anim material -1 0.500000 textu
\ No newline at end of file
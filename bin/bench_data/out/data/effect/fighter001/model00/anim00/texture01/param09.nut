@@ -0,0 +1,307 @@
+vertex frame
+frame 1.0 1.0 bone 1.0 bone vertex = anim -1 bone
+bone vertex texture 0.500000 0.500000 material vertex
+vertex 1.0 0.500000 = -1 -1 frame = = frame 0.500000 0.500000 1.0 vertex vertex bone -1 texture material vertex 1.0
+bone 1.0 1.0 texture material -1
+frame = vertex -1 frame -1 anim
+anim 1.0 texture bone = -1 bone
+anim bone 0.500000 -1 0.500000
+frame anim -1 1.0 texture
+frame
+-1
+frame anim texture
+0.500000 vertex frame
+texture
+1.0
+= texture
+= vertex material anim vertex
+-1 = 1.0 vertex bone vertex texture texture 0.500000 frame
+material texture = texture vertex
+-1 material anim = = = -1 vertex = = anim frame frame
+= 1.0 anim -1 material
+vertex
+0.500000 -1 frame material texture 0.500000 texture vertex anim texture material anim
+bone = 0.500000 material -1 anim frame anim 0.500000 material texture bone bone anim 1.0 0.500000 frame 0.500000 vertex vertex 0.500000 texture material 1.0 =
+material frame =
+= texture bone -1 frame = material anim anim anim 1.0 vertex
+frame 1.0
+vertex
+1.0 = -1 frame -1 = texture vertex texture bone -1
+material 1.0 vertex frame
+1.0 frame
+vertex 1.0
+anim bone vertex vertex 0.500000 -1 frame texture
+= bone
+1.0 bone anim anim
+= vertex -1 = 1.0 material = texture bone vertex frame material vertex material 0.500000
+bone 0.500000 material
+vertex
+0.500000 -1 0.500000 1.0 0.500000 material bone frame -1 0.500000
+bone 1.0 -1 =
+anim -1
+-1 texture bone texture
+0.500000 vertex bone texture texture anim
+bone material
+frame -1 0.500000 material 0.500000 texture frame 1.0
+vertex anim bone
+=
+-1
+material frame anim bone = anim 1.0 -1 bone
+1.0 bone
+frame 0.500000 bone bone
+vertex anim 0.500000 -1 1.0
+material
+vertex -1 anim
+texture
+-1 frame
+0.500000
+vertex
+frame -1 texture vertex
+-1
+bone 1.0
+bone frame
+0.500000 frame
+bone
+1.0 -1
+= bone 0.500000 bone
+vertex
+1.0 vertex
+frame
+1.0 frame
+frame -1
+frame texture anim texture frame 1.0 anim
+anim -1
+anim
+frame 1.0
+= -1 vertex 1.0 material texture material texture =
+1.0 vertex vertex anim frame frame
+bone bone anim 0.500000 -1 = = vertex = anim = texture 1.0
+texture material = material bone
+0.500000 -1 vertex =
+-1 1.0 material texture =
+= frame vertex 1.0 -1 frame
+frame =
+frame -1
+texture anim 1.0 0.500000 bone
+texture -1
+1.0 texture anim
+vertex 1.0
+1.0
+= -1 bone 0.500000
+vertex 1.0 -1 anim 1.0 material -1 anim bone 0.500000
+-1 frame
+material = 1.0 texture -1 texture frame -1 bone anim
+texture anim frame vertex texture anim bone 0.500000 = 1.0
+frame 1.0 vertex texture frame
+frame
+frame anim material bone 1.0 0.500000 -1 texture anim -1 anim bone = bone vertex
+bone anim texture 0.500000 -1
+frame texture frame
+material vertex =
+vertex 1.0 texture frame
+bone
+-1
+texture 1.0 1.0 -1
+bone
+= 1.0 texture
+material anim
+0.500000
+0.500000
+bone 0.500000 frame vertex bone material
+bone frame 0.500000 texture
+bone 0.500000 0.500000 0.500000 -1
+= 0.500000 material 0.500000 -1 bone vertex
+texture frame vertex -1 frame bone frame
+1.0 texture bone = anim
+vertex anim 0.500000 frame
+= = material frame
+texture bone -1 -1 frame 0.500000 bone = = vertex anim
+-1
+material texture 1.0
+= material texture
+material texture bone anim bone anim 0.500000
+1.0 0.500000
+vertex bone
+vertex vertex -1
+anim frame 0.500000 texture
+-1
+material 1.0 material 0.500000
+1.0 frame
+material 0.500000 = 0.500000 -1
+material -1 1.0 -1 material 0.500000 frame
+material texture
+=
+1.0 anim
+anim 1.0
+vertex material
+1.0 anim 0.500000 1.0 anim vertex 0.500000
+-1
+0.500000 texture
+0.500000
+-1 frame anim 1.0 bone = texture
+material 1.0 1.0
+= frame anim 1.0 texture 0.500000 = material 1.0 bone -1 vertex
+0.500000 bone frame bone texture bone material = texture -1 frame frame 1.0 vertex
+-1 anim = 1.0 texture 0.500000 texture
+bone -1 0.500000
+1.0 = = = anim anim =
+0.500000
+texture 0.500000 = vertex = = -1 vertex = 0.500000 =
+-1
+vertex texture anim
+1.0
+0.500000 texture = frame frame 1.0 texture 1.0 1.0 texture 0.500000 0.500000 anim
+-1 0.500000 vertex 0.500000 =
+-1 = vertex 1.0
+vertex 0.500000 material 0.500000 = texture
+0.500000 texture 0.500000 bone
+material material
+vertex 0.500000 frame vertex
+frame
+texture bone anim bone bone -1
+=
+vertex vertex bone 1.0
+0.500000 bone =
+1.0
+texture -1 texture -1 material frame material -1 -1 anim vertex 0.500000 vertex 0.500000 material frame bone frame
+vertex
+anim bone 0.500000 0.500000 material frame -1 anim frame = 0.500000 1.0 1.0 vertex frame anim =
+material
+-1 vertex vertex vertex
+1.0 frame texture frame 1.0 texture texture
+frame
+bone frame -1 texture
+= 0.500000 -1
+= material
+vertex bone
+vertex frame
+-1
+-1 bone 0.500000
+bone = frame = anim texture 0.500000
+bone -1 anim anim 0.500000
+material vertex
+material texture -1 -1 -1
+-1 = bone = frame 0.500000 vertex -1
+anim
+1.0 anim bone vertex -1 material bone
+texture -1 0.500000
+material -1 bone
+= material
+bone bone = bone 1.0
+frame
+0.500000 bone
+frame bone
+frame
+=
+0.500000
+vertex vertex vertex anim anim bone -1 1.0 texture anim
+-1
+frame 1.0 anim frame texture vertex = 0.500000
+-1 bone vertex bone
+material material
+material texture
+texture = material = 0.500000 =
+frame
+= bone 1.0 anim -1
+vertex 0.500000 material = -1 bone =
+=
+bone
+material
+1.0 material
+= material frame
+frame 0.500000 -1 =
+-1 0.500000 frame bone anim bone
+=
+vertex texture bone material
+= texture vertex 1.0 anim
+anim vertex = 1.0 vertex 1.0 anim frame
+vertex vertex vertex bone
+material material
+0.500000
+frame vertex 0.500000 = =
+vertex anim
+-1 material bone
+0.500000 =
+anim
+frame -1 1.0 bone bone
+-1 texture anim -1 texture -1 = 1.0 0.500000
+material vertex bone anim 0.500000 -1 vertex = -1 frame anim
+vertex
+anim -1 anim anim 1.0 1.0 bone 1.0 anim material = -1 0.500000 vertex bone 0.500000
+frame frame
+texture frame
+= = frame 1.0 anim 0.500000 = texture -1 frame 0.500000 vertex =
+frame bone = bone anim 1.0 material bone frame frame 0.500000 1.0 texture 0.500000 material = anim frame 0.500000
+0.500000 -1 material = frame
+anim -1 -1 texture
+=
+frame vertex vertex bone texture material material vertex
+-1 -1 =
+0.500000 anim vertex
+0.500000 = bone 1.0 frame 1.0 = -1 0.500000 material vertex material
+material
+anim frame vertex = texture -1 -1 = frame 1.0 frame = bone = -1 frame vertex vertex 0.500000 material -1 bone -1 0.500000
+anim vertex 1.0 = bone =
+material vertex
+0.500000 bone -1 frame vertex texture material frame material
+anim material bone material
+-1 bone frame material
+texture 0.500000 -1 material = vertex
+bone -1 1.0
+0.500000
+bone material frame 1.0 material 0.500000 texture 1.0 material
+bone bone anim
+= bone
+vertex
+anim material
+= 0.500000 0.500000 material
+vertex material
+vertex 0.500000 anim bone
+0.500000 =
+vertex -1 texture vertex 0.500000
+vertex anim texture material
+0.500000 1.0
+1.0 vertex 0.500000
+frame 0.500000 0.500000
+vertex -1 material
+material
+-1 = = 1.0
+material -1
+texture vertex vertex
+vertex
+0.500000 1.0 =
+bone = vertex
+bone texture anim -1
+frame frame
+material vertex
+bone anim
+material
+bone 1.0 1.0 anim -1
+anim material 0.500000 = = frame material
+=
+bone
+anim material
+anim texture
+anim anim = -1 0.500000 0.500000 texture material 0.500000 bone
+anim material frame bone
+frame vertex vertex anim 1.0
+anim
+material
+texture -1 bone -1 1.0 = anim anim texture 1.0 = bone texture anim material 1.0 bone = material 0.500000 = -1 1.0 texture = = 0.500000
+= frame -1 -1 anim 0.500000 material
+1.0
+0.500000 vertex
+texture -1 -1 material bone frame
+texture texture anim
+texture
+frame
+anim bone = 1.0 -1 0.500000
+vertex frame frame vertex -1 texture bone -1 texture -1 vertex vertex bone
+anim vertex 0.500000
+-1 material anim =
+-1
+-1 vertex
+vertex material
+frame vertex 0.500000 -1 1.0 vertex frame 1.0 material -1 0.500000 vertex 1.0 -1
+0.500000 0.500000 frame = anim frame frame 0.500000
+anim 
\ No newline at end of file
@@ -0,0 +1,253 @@
+1.0 1.0 anim = anim 1.0 bone
+bone anim texture -1
+bone -1
+material vertex 1.0 0.500000 vertex = frame material
+anim -1
+material
+anim 1.0
+= texture frame
+-1 -1
+material texture frame texture 0.500000
+bone -1
+= material bone texture material -1 1.0 texture
+0.500000 bone texture frame
+bone -1 vertex
+bone
+frame 1.0 anim texture bone =
+anim
+0.500000 = 1.0 vertex texture material
+frame frame
+vertex vertex vertex material anim
+1.0 texture 1.0 vertex =
+1.0 1.0 -1
+bone anim frame texture
+1.0 texture texture 0.500000 0.500000 texture = texture bone
+frame -1 anim bone -1 1.0 = = bone = bone material 1.0 -1 1.0
+texture texture
+1.0 bone 1.0
+1.0 material vertex 1.0 anim
+texture -1 bone frame
+material vertex
+1.0
+-1 1.0
+vertex texture texture
+= frame =
+anim anim 1.0
+texture
+0.500000
+frame bone
+bone 0.500000 -1
+texture texture
+=
+=
+material vertex bone 0.500000
+texture material -1 vertex frame 1.0 1.0 -1 1.0
+1.0 frame vertex
+-1 -1 texture
+bone -1
+frame -1
+texture anim 0.500000 anim texture 1.0 frame
+frame 1.0 vertex -1 1.0 1.0 -1
+material frame 0.500000 vertex
+texture 0.500000 0.500000 anim texture material anim
+frame texture
+bone
+anim
+bone 1.0 frame 1.0 material bone texture
+1.0 frame -1 vertex vertex material 0.500000 0.500000 frame 0.500000 0.500000
+bone texture vertex material frame
+-1 vertex frame anim
+0.500000 material
+= frame
+texture material texture 1.0
+= -1 bone 0.500000 texture material 0.500000 -1 1.0
+vertex
+= bone = anim material bone texture frame
+-1
+0.500000 bone -1 texture
+texture =
+texture 1.0
+material material vertex
+frame anim
+anim material 1.0
+-1
+bone bone 0.500000 = = -1 material -1 texture anim bone
+= -1 1.0 vertex
+vertex
+vertex bone vertex
+anim 1.0 bone
+= 1.0 -1 frame bone
+-1 material
+texture
+anim frame
+= vertex 0.500000
+1.0 -1
+-1 texture =
+1.0 material 1.0 texture -1 texture = frame
+material frame
+frame texture texture bone anim bone texture texture texture material
+anim anim 0.500000
+0.500000
+1.0 = =
+material anim -1
+frame bone =
+anim 0.500000
+anim vertex
+vertex 1.0 bone 0.500000 0.500000 = bone -1 -1 frame -1 texture
+0.500000 anim bone
+vertex -1
+vertex
+= anim
+bone 0.500000
+texture anim material
+-1 anim bone
+1.0 vertex vertex vertex anim
+anim 0.500000 1.0
+vertex
+material 0.500000 bone vertex texture texture anim bone = 0.500000 0.500000 1.0 -1 0.500000 1.0
+0.500000 vertex = 0.500000 anim 1.0 frame texture
+texture material anim bone material anim
+1.0 =
+frame
+bone vertex anim material -1 anim
+texture
+texture material
+material 0.500000 anim bone material material
+0.500000
+1.0 bone = -1 frame
+material 1.0
+-1
+frame frame 1.0
+0.500000
+vertex 1.0 texture -1 0.500000 -1
+texture 1.0 texture 0.500000 material material -1 material 0.500000 anim texture
+anim 1.0 anim = -1
+= texture frame vertex -1 bone texture 1.0
+= anim = = = -1 -1
+bone vertex frame
+material material = 1.0 1.0 -1
+material
+bone 1.0
+frame
+anim -1 material anim 0.500000
+0.500000 frame bone vertex frame frame bone texture =
+1.0 1.0 0.500000 material -1
+0.500000 bone texture texture anim frame -1 material = vertex
+vertex
+0.500000
+material vertex
+vertex anim material
+1.0 anim
+0.500000 bone material anim vertex
+0.500000 1.0 bone bone vertex 1.0 1.0 0.500000
+= frame -1 frame 0.500000 1.0 texture
+= = 0.500000
+vertex anim = 0.500000 bone frame 0.500000
+1.0 = material bone material anim 1.0
+texture texture anim frame
+0.500000 anim -1
+bone material
+texture anim material
+bone
+bone 0.500000
+-1 = frame frame = anim
+material bone -1 -1
+anim vertex
+texture material -1 texture frame material
+bone
+1.0 -1 anim
+= texture bone
+anim vertex
+0.500000 0.500000
+texture bone vertex
+vertex
+bone material 0.500000 -1 1.0 bone
+material 0.500000 anim 0.500000 texture
+= vertex anim texture
+0.500000 bone
+vertex 1.0 anim anim frame anim bone material -1 1.0 = anim vertex -1 vertex
+-1 texture bone vertex
+texture
+material material texture = 1.0 material bone -1
+texture
+frame material texture
+0.500000 vertex -1 =
+vertex bone
+1.0 0.500000 = anim
+0.500000 frame
+bone -1 1.0 texture anim frame 0.500000 -1 vertex
+vertex -1
+anim frame vertex = = vertex bone
+bone
+texture
+texture
+1.0 material = texture = -1 = 1.0 frame bone
+material
+= -1 bone
+0.500000 1.0 anim bone frame texture 1.0 1.0
+vertex
+anim
+texture frame
+0.500000 =
+= vertex texture 1.0 material
+material -1 frame frame 1.0 texture
+frame -1 anim
+= bone bone 0.500000 = vertex texture bone material
+vertex 1.0 frame bone
+material 1.0
+=
+material texture
+= frame -1 frame material
+1.0 -1 1.0 frame texture material = vertex vertex -1 1.0 anim
+0.500000 texture
+vertex frame
+1.0 frame
+-1 1.0
+0.500000 material
+= 0.500000 = frame frame 0.500000 -1
+0.500000 0.500000
+frame = frame frame = anim texture
+0.500000 1.0 bone
+vertex 1.0
+0.500000 1.0 0.500000 0.500000
+1.0
+= 0.500000 -1 0.500000
+anim 0.500000 vertex
+= anim
+anim -1
+anim 1.0 anim anim vertex bone = bone -1 frame 1.0 -1 material
+0.500000 texture frame 1.0 material vertex
+material
+= bone anim
+-1
+1.0 anim texture vertex
+anim 1.0 0.500000 -1 texture bone vertex anim
+= texture anim anim material bone 1.0
+vertex frame
+frame frame bone material = 0.500000 -1 vertex anim texture vertex frame material vertex 0.500000 anim -1 vertex = anim material -1
+bone vertex 0.500000 vertex
+vertex vertex =
+texture
+vertex
+vertex
+texture material frame texture
+-1 frame 0.500000 -1 0.500000 material vertex anim
+0.500000 1.0 = bone = texture
+anim bone = =
+frame -1 = frame vertex anim -1 -1 vertex material
+-1 bone texture frame = -1 material material
+= bone anim texture = material
+-1
+= vertex frame texture material 0.500000 anim frame texture 0.500000 texture
+anim 0.500000
+0.500000 bone anim
+frame = -1
+bone material frame frame vertex 0.500000 frame = vertex
+material 0.500000
+0.500000 1.0 bone
+0.500000
+frame -1 0.500000 = 0.500000 1.0 texture
+-1 -1 -1 bone material vertex = texture
+bone material
+vertex -1 anim material 0.500000 anim vertex vertex vertex
+0.500000 anim vertex material 0.500000 anim m
\ No newline at end of file
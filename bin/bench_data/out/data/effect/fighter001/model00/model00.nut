@@ -0,0 +1,71 @@
+1.0 anim texture 0.500000 material vertex anim 1.0
+0.500000 anim anim = anim -1 vertex 0.500000 anim
+0.500000 frame
+frame vertex texture anim =
+bone
+texture 1.0 anim frame frame texture -1 material
+-1
+material vertex
+material
+0.500000 0.500000 material anim -1 frame -1
+0.500000 -1
+material
+bone = material bone texture =
+= -1 = = bone
+anim -1 texture vertex bone anim
+anim -1 0.500000 -1 frame
+0.500000 anim = texture
+bone material texture 0.500000 -1
+0.500000 texture
+texture anim 0.500000 bone vertex 0.500000 vertex
+= -1 anim
+anim frame
+material = -1 bone frame material -1 vertex -1
+= texture anim texture
+frame bone frame 0.500000
+anim
+0.500000 = 0.500000 vertex
+texture frame -1
+frame 1.0 = 0.500000 bone anim texture frame
+material material vertex -1 =
+vertex bone texture vertex 1.0 bone 0.500000
+0.500000 1.0 anim
+-1 material 0.500000 -1 vertex frame bone 0.500000
+=
+0.500000 1.0 texture 1.0 texture frame material texture vertex material =
+vertex texture
+bone vertex bone -1 texture
+material
+bone frame 0.500000 = material 0.500000 anim bone 1.0 texture
+=
+bone frame material -1
+1.0 =
+frame anim 1.0 1.0
+vertex frame frame
+bone frame
+= anim
+bone texture 0.500000 texture 0.500000 anim material = vertex -1 material = material frame
+vertex vertex bone bone
+material
+1.0 texture vertex material
+material texture =
+texture
+texture 0.500000 -1 material frame frame
+frame material 0.500000 vertex =
+bone material
+-1
+bone
+0.500000 0.500000 frame vertex texture material -1
+anim frame material texture
+-1
+1.0 1.0 0.500000 vertex vertex 0.500000 material
+=
+frame
+texture material
+1.0 material
+1.0 anim frame = material =
+frame
+bone = vertex = 1.0 anim vertex frame 1.0 material
+material anim frame
+0.500000 anim 0.500000 =
+0.500
\ No newline at end of file
@@ -0,0 +1,11 @@
+0.500000 =
+0.500000 vertex
+frame 1.0
+material
+vertex bone bone bone material frame 0.500000
+material bone
+= bone -1 anim
+bone
+anim anim
+-1
+-1 texture texture bone -1 1.0 vertex materi
\ No newline at end of file
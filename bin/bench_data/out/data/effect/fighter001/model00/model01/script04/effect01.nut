@@ -0,0 +1,11 @@
+-1 =
+1.0 = = vertex 1.0 frame 1.0 -1 bone 1.0
+anim bone 1.0
+frame
+vertex anim texture vertex material
+material 0.500000
+anim
+texture frame 1.0 = = anim material
+vertex bone anim vertex vertex = -1 texture vertex material
+material
+1.0 = ve
\ No newline at end of file
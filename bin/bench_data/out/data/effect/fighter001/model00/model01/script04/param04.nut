@@ -0,0 +1,3 @@
+vertex vertex frame bone
+-1 material
+frame frame ve
\ No newline at end of file
@@ -0,0 +1,239 @@
+anim = 1.0 texture bone frame texture = frame
+frame 1.0 0.500000 0.500000 -1 frame texture bone 0.500000 texture material = 1.0 material
+texture anim texture material
+vertex texture 0.500000 anim
+material 1.0 vertex frame anim
+-1 1.0 1.0 -1
+material
+-1 1.0 frame anim
+frame
+1.0 frame
+anim
+bone
+1.0 = 0.500000 =
+bone vertex
+bone
+1.0 texture = vertex frame
+= anim texture = 1.0 = -1
+1.0 1.0 = material = frame
+=
+material = 1.0 anim 1.0 frame vertex 1.0
+texture anim
+0.500000 material 0.500000
+material frame bone texture
+1.0 vertex frame material
+material vertex -1
+vertex -1
+1.0 anim = material -1 vertex frame frame frame
+vertex material anim frame vertex material = 0.500000 -1 vertex vertex material
+-1
+0.500000 bone
+material anim = frame material
+frame frame texture vertex -1 texture anim vertex 0.500000 texture
+material texture 1.0 vertex
+=
+material frame material material =
+1.0 texture
+bone bone
+0.500000 texture
+frame texture -1 bone 0.500000 anim -1 frame
+frame
+-1 = bone -1 material texture bone
+vertex material bone material 0.500000 -1
+anim
+bone vertex vertex 1.0 1.0 texture 1.0 material frame -1
+anim material anim
+frame
+anim anim frame -1 vertex
+0.500000
+frame frame
+0.500000
+anim 0.500000 1.0 1.0 texture bone
+0.500000
+bone
+vertex vertex bone
+material
+anim
+bone material bone
+0.500000 material
+= vertex frame frame anim
+vertex
+frame anim = bone = frame
+1.0 vertex frame texture -1
+anim
+-1
+-1 0.500000
+vertex
+1.0 = anim -1 frame -1 vertex anim vertex 1.0 vertex frame
+texture frame material -1 bone =
+bone texture bone material = =
+texture -1 bone 1.0 0.500000 vertex 1.0
+frame -1
+material
+-1
+anim 1.0
+= texture
+anim anim vertex
+anim bone bone
+0.500000
+= bone anim
+material
+vertex frame -1 anim 0.500000 texture 0.500000 bone
+-1
+texture vertex anim -1 anim 1.0 1.0 = -1 vertex
+vertex texture 1.0
+0.500000 -1 -1
+texture vertex =
+frame = 1.0 1.0 = =
+frame -1
+= = material
+material
+1.0 vertex -1
+bone material
+texture bone
+1.0 frame 1.0 1.0 material -1 0.500000 frame bone bone texture material 1.0 bone
+vertex anim material
+1.0 -1 bone material -1 anim frame
+0.500000 0.500000 bone material
+material 0.500000 bone -1 frame bone
+bone =
+material = vertex texture anim
+anim 0.500000 frame
+texture
+0.500000 vertex material material texture texture frame
+=
+texture
+vertex material
+vertex texture =
+1.0
+= frame texture
+material frame 0.500000 anim vertex texture vertex texture 1.0 material
+material anim
+-1 anim 0.500000 anim texture 1.0
+frame vertex 0.500000 0.500000 =
+= = vertex
+bone texture anim frame 0.500000 = -1 = anim = anim bone texture
+anim bone -1
+-1
+texture texture
+0.500000
+0.500000 bone vertex 0.500000
+1.0 texture anim texture 0.500000 anim -1
+vertex
+frame texture 0.500000 = = bone
+vertex texture texture
+vertex vertex anim
+material 1.0 0.500000 anim 0.500000 0.500000 bone
+= material
+frame =
+0.500000 frame material frame texture 0.500000 0.500000 -1
+material -1
+bone texture anim vertex anim 0.500000 frame texture = anim texture
+anim vertex
+texture frame 0.500000 -1 -1 -1 0.500000 frame bone bone
+frame texture -1
+material texture 1.0 anim =
+bone = frame frame = anim 0.500000
+texture = frame 0.500000 vertex
+vertex texture frame = frame
+1.0 anim texture
+0.500000 anim bone =
+vertex -1 anim vertex
+0.500000
+0.500000 0.500000 texture 0.500000 material
+0.500000 material texture 0.500000 texture 1.0 0.500000 frame vertex
+0.500000
+0.500000
+frame 0.500000 bone
+vertex bone anim -1 material frame
+vertex = texture texture = vertex bone anim
+bone
+0.500000 1.0 material texture bone vertex frame vertex = vertex -1 -1
+= anim material 0.500000 anim texture texture 1.0 frame anim = bone
+-1 vertex = 1.0
+frame
+material 1.0 anim vertex -1 bone vertex vertex texture texture -1 anim texture
+bone
+frame = bone 0.500000 1.0 bone material texture 1.0 material material material 1.0 bone 1.0 = texture 0.500000
+bone anim bone
+frame vertex 1.0 texture = = anim -1 material anim texture texture -1 texture
+bone 0.500000
+= anim 1.0 = 0.500000
+1.0 0.500000
+bone 1.0 -1 material texture 0.500000 0.500000 anim material 0.500000
+vertex
+0.500000 vertex material = 1.0 vertex material = = anim vertex -1 bone
+frame
+1.0 texture
+1.0 frame
+0.500000
+frame anim 0.500000 bone 1.0
+bone
+0.500000 material
+frame material frame 0.500000 anim material texture frame = 1.0
+texture
+material material 1.0 bone texture
+-1 -1 1.0 texture frame frame
+vertex 0.500000
+material texture
+1.0 texture = texture
+1.0 1.0
+-1 vertex vertex vertex -1 1.0 0.500000 frame 1.0 frame 1.0 anim bone =
+-1 frame
+bone
+1.0 vertex bone vertex =
+material
+texture
+1.0
+frame anim = anim 0.500000 1.0 texture
+1.0 0.500000 material anim texture -1 vertex material anim
+= 1.0 = frame material 0.500000 -1 anim
+bone bone
+material 1.0 vertex frame anim frame vertex texture
+frame bone bone material anim
+frame material 0.500000 0.500000 frame vertex -1 bone anim 0.500000
+=
+vertex bone bone 1.0 0.500000 -1 1.0 1.0 vertex
+frame
+material vertex
+0.500000
+0.500000 anim
+material material material texture bone texture -1
+-1 frame texture texture
+texture bone
+texture frame 0.500000 -1 vertex material 0.500000 texture
+anim
+-1
+bone
+vertex = frame anim =
+vertex material 0.500000 anim 0.500000
+vertex material 1.0
+vertex vertex material
+texture vertex frame -1 material material material = 1.0
+frame = texture material 1.0
+vertex -1 material
+0.500000 frame bone material material bone texture texture material bone texture = = frame anim bone bone
+texture = vertex texture bone bone 1.0 anim
+frame = 0.500000
+material -1 -1 -1 material -1 vertex
+bone -1
+= 1.0 anim 1.0 vertex anim 1.0 1.0
+bone 1.0 vertex
+0.500000 material material anim vertex
+anim
+frame 1.0 0.500000 -1 material vertex = -1 bone bone material
+= -1
+material frame
+1.0 anim =
+bone frame texture frame vertex 0.500000
+1.0
+material vertex vertex bone
+1.0 vertex anim
+frame texture 0.500000
+frame vertex 1.0 bone anim bone bone frame anim frame -1
+anim -1 1.0 vertex
+texture
+=
+= vertex texture bone bone anim bone
+0.500000 = =
+texture
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex
+= -1 vertex vertex
+material fram
\ No newline at end of file
@@ -0,0 +1,3 @@
+1.0 vertex 1.0
+texture
+0.500000 bone v
\ No newline at end of file
@@ -0,0 +1,11 @@
+-1 vertex = 0.500000
+material anim frame material
+-1
+frame 1.0 -1 frame 1.0 1.0
+vertex 0.500000 bone
+material 0.500000 anim texture 0.500000
+= bone material vertex vertex
+anim bone texture
+texture -1 -1 texture texture material bone vertex material bone
+1.0 = texture
+bone te
\ No newline at end of file
@@ -0,0 +1 @@
+= anim bone = 0.500000 texture f
\ No newline at end of file
@@ -0,0 +1,7 @@
+-1 anim -1 texture 0.500000 -1 material material 0.500000 anim frame 0.500000 bone
+0.500000 texture 0.500000 vertex
+vertex texture
+= material anim 0.500000 = 0.500000 1.0 frame
+vertex
+frame =
+anim bone 0.500000 vertex anim -1 1.0 fr
\ No newline at end of file
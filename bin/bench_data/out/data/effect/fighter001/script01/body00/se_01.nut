@@ -0,0 +1,7 @@
+vertex 1.0 0.500000 frame texture 1.0 frame 0.500000 1.0 0.500000 1.0
+-1 anim -1 texture texture 0.500000
+frame
+texture texture = texture material 0.500000
+anim
+1.0 frame 1.0
+anim vertex mat
\ No newline at end of file
@@ -0,0 +1,50 @@
+1.0 1.0 texture material vertex bone
+= frame vertex material frame material texture vertex 1.0 0.500000 -1 1.0 vertex bone
+vertex 0.500000
+vertex vertex bone
+anim anim
+1.0 =
+frame
+=
+material frame vertex anim -1
+anim 1.0 =
+material 0.500000 = material texture
+material 0.500000 0.500000 frame
+anim frame
+1.0 vertex bone
+vertex material
+texture
+-1 1.0
+material 1.0 =
+vertex material material -1 -1 bone -1 frame -1
+bone material anim texture 0.500000
+vertex frame material bone frame = bone anim anim
+= 0.500000 frame texture anim 0.500000
+frame vertex frame vertex = =
+frame anim vertex texture anim bone
+0.500000
+anim 0.500000 -1 -1 1.0 bone bone material = material 0.500000 -1 frame
+0.500000 frame
+anim
+material = bone
+bone
+1.0 anim 1.0 anim
+1.0 anim material anim bone
+material 0.500000 -1 = =
+1.0 vertex 1.0 = bone
+vertex = frame texture =
+bone bone texture
+vertex anim vertex 0.500000 0.500000 texture vertex vertex
+= vertex =
+bone vertex 1.0 anim
+= anim -1 frame =
+1.0
+bone 0.500000 vertex anim bone
+-1 texture
+anim -1 1.0 1.0 frame vertex -1 0.500000 material material material -1 anim
+vertex
+0.500000 frame material
+material
+bone 0.500000 anim = anim 0.500000 frame material = bone
+anim 1.0 1.0
+0.500000 ver
\ No newline at end of file
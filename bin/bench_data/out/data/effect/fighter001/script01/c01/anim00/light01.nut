@@ -0,0 +1,6 @@
+texture
+-1 anim
+anim vertex vertex = anim
+anim
+anim texture bone -1 -1
+material 1
\ No newline at end of file
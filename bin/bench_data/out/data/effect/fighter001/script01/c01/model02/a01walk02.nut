@@ -0,0 +1,328 @@
+frame frame
+-1 anim 1.0 0.500000 1.0 frame bone =
+vertex anim 0.500000
+-1
+frame 1.0 0.500000 0.500000 anim vertex material texture = material texture material frame
+-1 = 1.0 -1 vertex = material -1 vertex anim 0.500000
+-1 vertex material = frame 1.0
+material = frame bone
+= 0.500000
+material material frame texture
+= 1.0
+material 1.0 1.0
+bone
+bone
+frame texture
+vertex
+0.500000
+material 1.0
+= texture
+frame bone
+1.0
+anim
+anim
+0.500000
+= anim material vertex
+texture
+-1 = = anim -1 frame = 1.0 frame bone = = = -1 vertex anim
+anim anim material
+bone frame
+1.0
+anim
+=
+texture vertex = -1
+vertex = bone
+material vertex
+1.0
+0.500000 1.0 -1 vertex bone
+-1 material 0.500000 vertex anim
+=
+anim vertex frame -1 material
+frame
+1.0
+0.500000 anim 0.500000 -1 vertex
+vertex
+= bone
+vertex texture texture
+material bone 0.500000 vertex 0.500000 material 1.0 = vertex
+=
+texture frame 0.500000 0.500000 anim -1 -1 texture anim
+frame
+anim 1.0 0.500000 vertex material
+-1 texture 1.0 vertex vertex
+= vertex 0.500000 bone anim frame
+frame =
+1.0 -1 0.500000 bone material bone
+texture = texture frame anim texture 1.0 frame frame anim
+= anim texture frame material texture -1 =
+bone frame vertex
+-1 =
+anim material frame bone = material anim
+1.0 material anim = -1
+-1 texture
+0.500000 vertex bone 1.0 -1 vertex texture material texture
+frame anim
+1.0
+0.500000 0.500000 bone frame bone 1.0 vertex frame = frame 0.500000 0.500000 vertex
+material bone texture vertex -1 -1
+bone vertex 0.500000 material 1.0 texture bone frame 1.0 material = anim
+texture texture
+=
+bone material
+frame =
+-1
+vertex vertex frame = frame anim anim
+texture 0.500000 texture 1.0 bone material anim = bone texture
+1.0 0.500000 = texture anim 0.500000 1.0 bone vertex
+material frame 1.0 =
+= frame
+texture vertex -1 -1 bone
+anim texture
+0.500000 texture vertex anim -1 anim vertex vertex 0.500000 vertex bone vertex 0.500000
+frame frame -1 = material
+-1 material texture texture
+-1
+texture = material =
+bone 0.500000
+-1
+= vertex anim =
+texture anim
+material texture texture bone
+anim = texture frame 1.0 0.500000
+anim anim
+0.500000 anim 0.500000 -1 vertex = frame vertex
+material texture
+1.0 bone
+texture material texture = anim
+-1 bone 0.500000
+1.0 frame texture bone frame
+= material
+bone 0.500000
+material 1.0 bone
+vertex texture texture bone vertex = vertex anim frame
+vertex -1
+anim anim
+0.500000
+1.0 texture 0.500000 -1 vertex material frame bone 1.0 1.0 frame -1 anim
+anim anim -1 -1 = =
+=
+=
+anim bone
+-1 frame frame anim
+frame anim
+=
+frame
+vertex material texture texture 0.500000 -1 anim
+texture material vertex 1.0 bone =
+material 0.500000 anim
+0.500000 material anim texture texture 0.500000 1.0 frame
+frame
+-1 0.500000 0.500000 -1 frame -1 1.0 0.500000 anim
+texture
+material 1.0
+-1
+bone 1.0
+0.500000 texture
+texture bone frame material
+material
+= anim anim frame 0.500000
+frame frame -1 1.0
+bone anim = material
+texture = 0.500000 1.0
+vertex
+anim anim texture bone material 1.0 -1
+anim material frame texture vertex 0.500000
+0.500000
+anim 1.0
+frame frame = bone 0.500000 = anim
+1.0 bone
+= anim 1.0
+anim material
+vertex = 0.500000
+vertex
+1.0 -1
+bone anim material =
+-1 = frame -1 material 1.0
+texture vertex frame frame -1 -1
+material 0.500000 1.0
+-1
+bone -1 1.0 anim 1.0 -1 frame
+bone texture vertex vertex bone = bone = bone 0.500000 -1 0.500000 anim bone =
+texture bone bone
+anim 1.0 = bone
+= 1.0
+vertex
+frame material vertex vertex material frame -1
+-1
+-1 texture anim 0.500000 vertex
+bone -1 frame
+anim texture vertex vertex = 1.0
+frame = anim
+texture material texture anim bone material =
+material material
+texture
+bone bone
+-1
+anim texture anim
+= 1.0 texture 1.0
+-1
+vertex
+1.0
+material frame -1 anim 0.500000 -1
+bone -1 anim texture
+bone 1.0 anim frame frame = -1 texture 0.500000 texture anim vertex
+bone -1 material bone -1
+vertex frame
+material = vertex
+vertex material texture frame texture = texture bone vertex 1.0
+texture bone -1 = =
+frame frame
+0.500000 bone frame material
+0.500000 bone frame
+anim frame frame anim vertex texture -1 0.500000 -1
+anim -1 -1 bone
+vertex bone = bone vertex
+bone bone 0.500000
+anim
+1.0 =
+material bone bone -1 texture
+1.0 = texture
+0.500000 -1 texture anim
+-1 = =
+-1 texture
+= 1.0 material
+-1
+-1 0.500000 frame
+frame =
+-1 frame texture
+anim = 0.500000 = frame 0.500000
+frame
+frame 0.500000 texture
+1.0 material
+-1 0.500000 0.500000
+= anim anim -1 material 1.0
+material
+0.500000 anim texture
+vertex
+-1
+= 0.500000 -1
+vertex anim bone 1.0 0.500000 = texture vertex bone 0.500000 = vertex 0.500000
+texture 1.0 texture 1.0 anim
+vertex 0.500000 anim vertex texture material bone vertex anim
+1.0 0.500000
+material material texture bone 0.500000
+anim 0.500000
+1.0 -1 frame bone texture texture bone
+anim texture bone = -1 0.500000 material
+0.500000
+1.0 -1
+= texture -1 texture = frame
+texture bone -1 0.500000 vertex
+-1
+frame 1.0
+0.500000
+= 0.500000 1.0 texture texture texture
+0.500000 = anim 0.500000 bone
+= anim -1
+vertex
+bone 0.500000
+1.0 1.0
+=
+bone 1.0 anim vertex
+=
+vertex texture 1.0 -1
+vertex anim frame anim texture
+anim =
+vertex
+1.0 anim texture = bone = texture = texture
+0.500000 vertex = vertex vertex texture bone
+vertex material
+-1 texture 0.500000 vertex -1 frame 1.0 anim -1 1.0 vertex
+texture -1 = vertex -1 anim =
+bone frame bone texture anim frame vertex bone bone bone -1
+0.500000
+1.0 bone bone 0.500000
+frame
+texture
+material 1.0 1.0 frame anim bone
+bone anim
+material
+material = vertex -1
+bone anim frame 1.0 vertex -1
+= 1.0 texture bone
+= 0.500000 vertex
+texture frame anim
+texture frame 0.500000 vertex texture 0.500000
+1.0
+=
+material
+anim 1.0 frame
+texture frame material bone bone
+frame bone bone frame
+0.500000 1.0 frame bone
+-1 material
+anim texture 0.500000 vertex frame frame texture
+bone vertex texture 1.0
+frame 0.500000
+= vertex frame
+material = 1.0 vertex
+vertex
+1.0 texture anim 0.500000 material vertex
+1.0
+vertex vertex anim frame = bone
+frame vertex
+bone
+1.0
+anim -1
+bone = 0.500000 anim 1.0
+= frame = material
+0.500000 anim anim
+bone
+-1
+-1 vertex texture
+frame
+anim material = bone anim material
+vertex -1 material material
+bone 1.0 1.0 anim 1.0 texture
+1.0 -1 -1 = 0.500000 bone
+= = bone
+material 1.0 -1 -1 vertex = vertex bone 1.0
+texture vertex anim bone
+1.0
+material anim =
+frame texture material
+bone material bone material anim -1 vertex
+frame 1.0 -1 bone 1.0 anim vertex texture vertex
+material material
+1.0 frame
+= 0.500000
+anim bone
+1.0 = = material
+-1 texture =
+material
+= -1 material 1.0 0.500000 1.0
+= vertex 1.0 1.0 -1
+vertex frame vertex 0.500000
+material vertex =
+-1 = vertex texture -1
+0.500000
+texture vertex anim vertex
+material
+-1 material 1.0 -1 0.500000
+frame frame
+= material vertex vertex bone
+material
+0.500000 anim anim 0.500000 frame 0.500000
+-1 anim
+frame material vertex texture bone 1.0
+= anim = 1.0 texture frame
+vertex
+material texture
+anim material frame 1.0 texture texture
+anim anim 0.500000 -1 material
+1.0 -1
+-1 anim frame texture
+material 0.500000
+anim 0.500000 anim bone
+bone texture material = vertex material = vertex
+frame material -1 -1 frame material = material bone 
\ No newline at end of file
@@ -0,0 +1,28 @@
+frame material =
+texture = 1.0 vertex material texture bone -1 material 1.0 = 1.0 texture vertex 1.0 =
+frame 1.0
+material
+anim
+material 0.500000 0.500000 material texture 1.0
+0.500000 vertex material anim -1
+frame -1
+0.500000
+texture 0.500000 0.500000
+= frame material -1
+bone -1 anim vertex material bone material texture -1 1.0 -1 0.500000 -1 vertex
+frame = 1.0 vertex
+-1 frame frame material bone = vertex = 1.0 texture bone
+texture
+frame
+bone 1.0 frame material bone
+frame anim anim texture
+1.0 -1 1.0 frame frame =
+bone -1 texture
+vertex vertex
+1.0 frame anim -1 material = frame
+material
+= 1.0 vertex texture 0.500000 0.500000
+frame texture 0.500000 -1
+0.500000 vertex -1 vertex bone frame = 1.0 texture
+1.0 vertex texture
+material 0.500000 
\ No newline at end of file
@@ -0,0 +1,18 @@
+-1 -1
+bone 0.500000 0.500000 -1
+material texture -1
+1.0 vertex anim
+vertex 0.500000 frame -1 material anim vertex 1.0
+= frame vertex texture
+vertex 1.0
+1.0 1.0 vertex anim
+0.500000
+1.0
+= anim material
+vertex texture bone
+anim frame
+-1 anim
+anim -1
+=
+frame
+bone te
\ No newline at end of file
@@ -0,0 +1,22 @@
+material
+1.0 bone
+material frame bone vertex texture
+= frame
+material material material
+material
+0.500000 vertex frame 0.500000 = 0.500000 material 0.500000 1.0 -1
+0.500000 bone frame anim 1.0
+vertex =
+vertex frame
+material
+frame
+-1 anim
+= bone texture vertex =
+bone anim
+frame =
+frame material bone
+frame texture texture frame anim 0.500000
+frame frame 0.500000 texture vertex
+anim material texture
+vertex material = 0.500000 =
+material
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim 0.500000
+-1 1.0 vertex 0.500000 bone bone texture
+=
+= material 1.0
+frame
+material 0.500000 material = frame
+vertex anim vertex
+1.0 = texture
\ No newline at end of file
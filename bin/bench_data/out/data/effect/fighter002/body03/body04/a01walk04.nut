@@ -0,0 +1,64 @@
+vertex
+frame 1.0 material -1
+1.0 = 1.0 vertex
+bone
+anim
+=
+0.500000 bone = bone
+0.500000 1.0 = material
+vertex
+0.500000
+0.500000 frame anim -1 = = frame -1 -1 vertex 1.0 1.0 frame = frame =
+0.500000
+texture frame bone
+0.500000 texture frame 1.0 1.0 frame material
+bone
+frame = -1
+frame texture
+material =
+vertex frame
+frame 1.0
+0.500000 0.500000 1.0
+-1 1.0
+texture = bone texture bone anim
+texture
+texture anim 0.500000 vertex 0.500000 texture = material 0.500000 -1 vertex frame frame bone
+= = = anim bone bone bone bone
+1.0 anim 0.500000 anim bone vertex
+= vertex texture texture frame 0.500000 0.500000
+bone
+texture -1
+texture bone
+texture texture 0.500000
+= texture vertex material texture material material -1
+0.500000 anim 0.500000
+texture frame vertex
+-1 = anim 1.0 vertex anim -1 = anim frame bone vertex frame texture -1 texture
+-1 vertex bone -1 1.0 0.500000 bone bone
+frame = texture texture frame = frame =
+bone anim 1.0
+1.0 = frame
+0.500000 anim 1.0
+bone 1.0 frame 0.500000 1.0 texture
+texture = material 1.0
+0.500000 =
+-1 =
+anim texture frame
+texture -1 0.500000 texture texture bone frame vertex -1 bone -1 0.500000 anim
+material material 1.0 material anim texture bone
+= frame anim material
+= -1 frame material vertex frame bone
+1.0 material
+vertex vertex bone -1
+anim texture
+bone vertex 1.0 1.0 =
+bone 1.0 material anim -1
+anim = -1 = vertex =
+vertex
+1.0
+bone -1 = material
+1.0
+vertex material
+= = = 1.0 vertex material = = 0.500000 1.0 -1 0.500000 0.500000
+frame 0.500000 vertex -1 frame anim material texture frame
+= 0.500000 material bone 
\ No newline at end of file
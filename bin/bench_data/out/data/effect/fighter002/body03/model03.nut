@@ -0,0 +1,152 @@
+frame bone -1 1.0
+bone texture anim
+0.500000 = bone anim 0.500000
+1.0
+bone = bone frame
+anim 1.0 -1
+=
+material 1.0 frame
+material frame -1 0.500000 material anim material
+frame =
+1.0 -1 texture
+anim
+material = frame 0.500000 frame anim
+bone
+material
+texture
+anim =
+= anim
+texture bone bone -1
+0.500000
+vertex vertex
+material -1 vertex
+anim
+1.0 0.500000 -1
+bone 1.0 anim anim
+-1 frame
+material bone frame
+frame 0.500000
+anim = 0.500000
+bone 1.0 1.0 frame -1 = frame material material
+texture
+texture anim =
+1.0 material -1 anim
+0.500000 -1 1.0 0.500000 0.500000
+-1 frame
+1.0 vertex
+0.500000 texture
+vertex 1.0 anim 1.0 frame = vertex
+vertex 1.0
+vertex texture material = -1 texture frame 0.500000
+anim
+-1 frame texture frame vertex
+material
+anim texture
+bone frame = = 1.0 frame bone
+0.500000 1.0 bone 0.500000 material bone
+vertex = 0.500000 bone vertex
+anim 1.0 1.0
+= =
+texture
+material = bone
+anim -1 0.500000 1.0 -1 anim bone
+texture 1.0 vertex bone
+texture
+bone = 0.500000 material -1 material 0.500000 material -1 1.0 material bone 1.0 bone
+frame = bone texture vertex frame frame frame
+bone
+vertex = 1.0 0.500000 anim
+anim -1
+anim material 0.500000
+-1 anim
+0.500000
+material 1.0 frame anim texture
+0.500000
+texture material = vertex texture -1 bone 1.0 0.500000 1.0 0.500000
+= 0.500000 anim texture
+anim
+vertex
+frame
+frame
+vertex texture vertex
+0.500000
+material texture texture 1.0 = vertex
+material
+anim bone 0.500000 0.500000 -1 material texture
+material -1 anim 1.0 vertex
+texture
+bone -1 0.500000 0.500000 texture
+anim material
+material
+0.500000 texture = = frame =
+-1 material bone texture -1 = frame texture texture frame anim 1.0 = texture = texture anim
+= 0.500000 anim
+texture vertex vertex texture texture
+1.0 vertex texture
+material = bone
+frame bone frame -1 bone -1
+material
+anim 1.0 0.500000 material frame
+frame =
+anim vertex texture 0.500000 vertex material
+1.0 0.500000 frame texture
+vertex vertex frame
+1.0 1.0 -1 anim vertex
+frame vertex vertex 0.500000 0.500000 bone anim = = = bone 0.500000 1.0 -1 0.500000
+=
+texture
+texture 1.0 bone =
+=
+bone -1 material 1.0 -1 vertex texture vertex = bone vertex vertex
+texture
+texture
+frame
+= 0.500000 0.500000 vertex vertex material 0.500000 -1 material
+bone bone bone bone material bone =
+1.0
+bone -1 =
+1.0 = anim anim 1.0 material 1.0 0.500000
+vertex
+texture anim = texture material vertex
+anim
+material
+= vertex 0.500000 0.500000 frame vertex
+material texture frame frame
+material
+1.0 frame 1.0 vertex 0.500000 frame anim frame 1.0 bone = 1.0 bone 1.0 0.500000 -1 bone
+frame =
+material material vertex material bone
+-1 frame texture 0.500000 anim 1.0 frame texture
+material vertex -1 frame -1 frame
+texture
+0.500000 material -1 =
+1.0 texture
+1.0
+= anim 1.0 anim
+1.0
+material material anim
+1.0
+-1 0.500000 -1 anim frame -1 bone frame material
+frame 1.0
+material texture material bone frame
+0.500000
+= texture
+-1 anim texture
+texture
+=
+-1
+0.500000 0.500000 frame 0.500000 bone =
+anim texture =
+vertex 0.500000 = material material 0.500000 -1 frame
+texture texture texture
+= vertex 0.500000 frame bone frame 0.500000 vertex
+material anim
+anim texture 0.500000 -1
+anim material
+-1
+texture anim bone vertex bone
+material 1.0 0.500000 texture anim vertex
+frame -1 material -1 0.500000 bone material
+= anim = material 1.0 0.500000
+0.500000 1.0 0.500000 1.0 bone frame -1 frame vertex frame
+1.0 = te
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1
+vertex
+1.0 vertex material vertex texture frame 0.500000 texture 1.0 -
\ No newline at end of file
@@ -0,0 +1,12 @@
+bone = 0.500000 -1 =
+-1
+vertex 1.0 = texture bone texture
+1.0 -1 = bone = bone 1.0
+anim -1 frame
+vertex
+=
+vertex
+anim vertex vertex frame anim 0.500000
+material vertex 0.500000
+0.500000
+bone vertex -1 frame 1.0 tex
\ No newline at end of file
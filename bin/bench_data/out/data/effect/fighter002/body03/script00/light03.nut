@@ -0,0 +1,3 @@
+bone material
+anim
+1.0 anim 1.0 frame -1 -1 vertex mate
\ No newline at end of file
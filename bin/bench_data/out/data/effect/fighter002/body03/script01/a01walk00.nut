@@ -0,0 +1,2 @@
+texture = material anim frame
+bone material bon
\ No newline at end of file
@@ -0,0 +1,9 @@
+anim
+0.500000 vertex frame 0.500000
+-1 0.500000 0.500000 vertex
+frame = 0.500000 =
+-1
+= 0.500000 frame material
+anim texture texture vertex
+material
+vertex
\ No newline at end of file
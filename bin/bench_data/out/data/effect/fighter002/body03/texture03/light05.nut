@@ -0,0 +1,8 @@
+anim frame bone = 0.500000 bone
+frame frame -1 -1 =
+= 0.500000
+1.0 anim frame 0.500000 -1
+= 1.0 bone bone material
+texture anim 0.500000 material texture 0.500000 -1
+anim 0.500000
+-1 
\ No newline at end of file
@@ -0,0 +1,12 @@
+1.0
+-1 bone texture 0.500000 = vertex = anim -1
+vertex =
+=
+1.0 bone 0.500000 bone
+= -1
+1.0
+vertex
+1.0
+bone
+0.500000
+frame bone 
\ No newline at end of file
@@ -0,0 +1,205 @@
+1.0 material vertex
+anim frame
+anim 0.500000 -1
+0.500000 0.500000 0.500000 -1 0.500000 0.500000 frame anim bone
+bone
+0.500000 texture
+-1
+-1 texture 1.0 -1 bone
+=
+= 1.0
+bone = frame texture 0.500000 -1 frame frame
+-1 texture 0.500000 bone -1
+vertex
+0.500000 1.0 1.0 texture texture 1.0 frame bone vertex =
+anim bone
+texture vertex 0.500000 0.500000 texture anim = = vertex
+= frame texture
+vertex material
+vertex
+texture bone
+bone
+bone anim material 0.500000 anim texture material anim bone 1.0 = =
+bone
+bone
+0.500000 bone vertex bone
+-1 anim frame -1 material = vertex anim frame texture bone texture anim
+1.0 -1 0.500000 0.500000 -1 material bone vertex material frame bone = -1 material 0.500000 = 0.500000 = 0.500000 = 1.0 material
+1.0 material -1 bone 0.500000 anim vertex 1.0 frame anim
+0.500000 0.500000 bone
+-1 1.0 anim
+= 0.500000 texture
+-1 bone frame bone
+vertex 0.500000 frame anim
+0.500000 -1 bone -1 material vertex
+1.0 anim
+vertex material bone -1 frame 1.0 anim
+texture
+1.0
+1.0
+1.0 -1 -1 texture bone -1 texture
+-1
+1.0 -1 anim material
+= anim 0.500000 anim -1 anim =
+-1
+= frame vertex 1.0 texture material
+anim texture =
+material texture material -1 -1 anim frame
+-1 0.500000 -1 0.500000 -1 -1
+material bone
+-1 -1 0.500000 = anim
+-1 anim 0.500000 -1 1.0 -1 frame material
+bone =
+0.500000 1.0 bone texture material anim
+frame vertex bone texture bone 1.0
+texture anim vertex vertex anim material = bone frame
+vertex material
+bone 1.0 bone texture
+anim
+0.500000 frame
+frame -1
+1.0
+1.0 vertex vertex material vertex
+= -1
+texture texture
+anim vertex
+bone -1 bone texture
+-1 = = -1 0.500000 anim
+= anim frame vertex 1.0 texture = 0.500000 0.500000
+material
+material
+-1
+anim anim = 0.500000 bone -1
+bone -1 -1 -1 -1 texture
+= material 1.0
+= vertex bone 1.0 vertex vertex -1 -1
+vertex 1.0
+= frame
+-1 0.500000
+texture
+bone frame bone frame texture
+material 1.0 material bone
+vertex -1
+material
+frame
+frame -1 anim vertex
+0.500000
+bone anim bone = frame -1
+anim frame = anim 0.500000
+material = -1 = vertex 0.500000
+1.0 texture 1.0 bone material
+bone
+anim frame -1 vertex
+= material vertex bone 0.500000 0.500000 vertex texture texture bone anim material texture anim 0.500000 = anim vertex
+material = bone texture 1.0
+0.500000
+anim 0.500000 material material = = frame texture 0.500000 frame frame
+vertex
+texture -1 bone
+0.500000
+0.500000
+1.0
+=
+bone 0.500000 -1 anim bone bone anim anim anim = anim anim bone material -1 texture anim
+0.500000 bone -1 bone 1.0 frame 1.0
+bone
+bone -1 0.500000 texture material
+bone bone -1
+anim
+anim texture texture vertex
+-1
+frame bone bone = anim
+material frame vertex
+frame material 0.500000
+anim texture
+1.0 vertex
+anim
+1.0 0.500000 material
+material = material
+-1 texture 1.0 vertex texture frame texture texture 1.0
+frame = material = bone texture texture material vertex 0.500000
+frame
+= -1 frame
+0.500000 vertex -1 material -1 material vertex -1 vertex 1.0
+1.0 bone bone
+texture -1 anim 0.500000 = = anim vertex -1 = anim texture bone anim 1.0 0.500000
+0.500000
+vertex vertex texture 0.500000
+texture =
+frame
+1.0
+material 0.500000 material = anim
+bone
+= 0.500000
+material
+0.500000 frame
+texture bone 0.500000 frame
+bone 0.500000
+frame frame 0.500000
+bone vertex
+-1 material = texture texture
+frame anim 0.500000 texture 1.0 material
+= anim material 1.0
+frame
+-1 bone
+material material vertex -1 0.500000 bone
+frame -1
+vertex 0.500000 frame 0.500000
+texture 1.0 bone 0.500000 = texture = 0.500000 anim bone bone -1 frame
+-1 frame vertex anim = bone
+= bone anim
+0.500000 material 1.0 = bone
+material anim
+1.0
+anim
+anim anim -1
+-1
+anim vertex anim bone = -1 =
+1.0 anim 0.500000 bone
+anim
+= texture 1.0 frame -1 =
+material texture = material -1 anim texture frame anim frame 1.0
+material 0.500000
+= = material =
+frame frame material
+0.500000
+frame texture material
+frame 0.500000
+1.0
+bone
+anim
+= bone frame
+vertex 1.0 = frame material bone 1.0 vertex
+= 1.0 material anim 1.0
+bone vertex
+= material
+1.0
+texture vertex = vertex
+texture 0.500000
+material
+0.500000 material anim
+frame texture bone
+-1 =
+0.500000 frame 0.500000 texture -1 anim anim texture -1 -1 vertex anim texture 1.0 anim -1 bone texture
+= 0.500000 material texture = bone = -1 =
+material
+bone
+material 1.0 bone anim bone
+bone
+1.0 bone vertex bone texture -1 bone
+material
+bone bone = material 0.500000 1.0
+= bone = 0.500000 -1 vertex texture material
+bone =
+=
+texture 1.0
+material texture
+frame 0.500000
+frame
+texture material bone bone
+frame anim
+=
+0.500000
+anim
+-1 -1 1.0 anim anim
+texture materi
\ No newline at end of file
@@ -0,0 +1,42 @@
+texture texture anim
+1.0 0.500000
+1.0 1.0 vertex 0.500000 0.500000
+frame anim
+1.0
+frame material vertex bone
+= bone vertex anim =
+-1 frame 1.0 texture bone -1 anim 1.0 bone 1.0 0.500000 vertex -1
+-1 bone vertex
+anim -1 1.0 texture anim bone -1 vertex frame
+texture vertex material
+0.500000
+material vertex vertex
+material anim vertex -1
+1.0
+1.0 vertex material
+0.500000 vertex vertex 1.0
+-1 bone bone -1
+= texture 0.500000 1.0 anim bone bone 1.0
+bone
+=
+material anim
+anim 0.500000 frame material 0.500000 anim frame
+material vertex anim = 0.500000
+material 0.500000 bone material frame material anim frame = bone
+vertex
+vertex vertex material texture -1
+= texture 1.0 texture
+texture
+texture anim material -1
+-1 texture vertex
+= vertex
+frame = texture material texture
+0.500000
+bone material anim
+material
+material frame -1 1.0 texture frame
+material texture anim 0.500000 = 1.0 material -1
+frame
+vertex
+-1 0.500000 bone texture -1 1.0 material
+bone mate
\ No newline at end of file
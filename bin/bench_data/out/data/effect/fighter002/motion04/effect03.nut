@@ -0,0 +1,22 @@
+material 0.500000
+1.0 =
+material vertex 1.0 texture
+material
+bone
+= texture 0.500000
+=
+bone material
+texture
+0.500000 frame
+0.500000
+frame anim
+-1 0.500000
+texture frame texture
+vertex bone vertex vertex anim
+= = = -1 0.500000 = vertex texture vertex material frame material
+1.0
+0.500000 vertex 1.0 bone
+texture 0.500000
+vertex material frame vertex 1.0
+1.0
+t
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 = vertex vertex
+texture
+anim -1
+-1 0.500000 = -1 vertex ver
\ No newline at end of file
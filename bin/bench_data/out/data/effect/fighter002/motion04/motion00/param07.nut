@@ -0,0 +1,2 @@
+0.500000 material 1.0
+1.0 = 1.0 material 1.0 material vertex vertex
@@ -0,0 +1,2 @@
+0.500000 0.500000 anim bone
+material 
\ No newline at end of file
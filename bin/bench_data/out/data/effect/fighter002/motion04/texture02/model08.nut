@@ -0,0 +1,45 @@
+0.500000 bone
+0.500000 material vertex 1.0 0.500000
+1.0 material
+bone 1.0
+frame vertex = anim
+vertex
+texture anim -1 vertex texture
+=
+vertex
+0.500000 vertex 1.0 -1
+= = frame
+0.500000 material texture = -1 bone
+= 1.0 vertex
+material anim 0.500000 = anim 0.500000 material
+texture -1 frame material anim
+= = 1.0 bone = vertex anim
+anim
+bone texture
+vertex
+texture
+texture frame
+0.500000
+material frame =
+texture -1 material
+-1
+= vertex
+material anim -1
+material 1.0
+frame -1 material texture bone -1 texture
+material vertex bone vertex bone = -1
+vertex 1.0 = bone
+= -1
+bone = -1 = 1.0
+1.0 0.500000 -1 frame
+texture 0.500000
+texture
+1.0 1.0 anim anim -1 bone
+bone -1
+-1 texture
+-1 material
+1.0
+vertex -1 material texture 1.0 anim material = bone 1.0
+vertex vertex
+-1 = material material -1 = material frame = frame = = vertex
+mate
\ No newline at end of file
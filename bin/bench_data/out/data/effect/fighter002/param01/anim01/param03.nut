@@ -0,0 +1,4 @@
+bone = frame
+anim texture
+0.500000
+frame 
\ No newline at end of file
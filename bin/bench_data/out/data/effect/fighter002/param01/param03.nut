@@ -0,0 +1,228 @@
+bone -1 texture material
+vertex 0.500000
+0.500000
+material = material bone anim anim -1
+texture
+texture texture 1.0 frame frame -1 material texture
+texture -1 texture
+= texture material -1
+0.500000 -1
+texture bone
+-1 anim texture frame material
+anim
+texture -1
+= vertex material 1.0 texture
+1.0 texture bone bone anim 0.500000
+anim frame texture
+anim vertex
+material 1.0 0.500000 vertex =
+anim 0.500000 frame texture
+texture vertex vertex vertex vertex
+material
+frame -1
+=
+bone
+bone vertex material 1.0 -1 vertex -1 texture
+texture texture
+frame
+anim texture 0.500000 material material = anim
+0.500000 bone
+bone
+texture 1.0 frame -1
+material
+0.500000
+anim bone material -1 texture vertex =
+frame bone material texture vertex anim vertex 0.500000
+frame texture vertex anim
+vertex
+material 1.0 frame anim
+-1 anim material anim = 0.500000 frame 0.500000 = 0.500000 vertex vertex material 1.0 = 1.0 0.500000 -1 1.0 =
+frame 1.0 bone material bone -1 1.0 -1 texture 1.0
+material -1 1.0 1.0
+anim
+vertex -1 texture material -1 vertex 0.500000 vertex
+bone frame vertex texture
+vertex bone -1
+material 1.0 -1 0.500000 frame
+anim bone frame -1
+frame anim 1.0
+=
+anim texture material texture -1 =
+-1 0.500000 -1 vertex bone 0.500000 0.500000 0.500000 bone bone
+bone frame material 0.500000 frame
+bone -1 vertex
+anim material frame 0.500000 0.500000 -1 texture 1.0
+vertex texture texture -1 bone vertex
+= -1 = 0.500000
+bone
+0.500000 material = 0.500000 1.0 frame anim anim bone
+= material = -1
+anim vertex anim anim texture = = 1.0 material
+0.500000 anim material
+material
+1.0 bone anim vertex -1 vertex 1.0 0.500000
+frame texture anim texture
+bone vertex 0.500000 bone anim -1 1.0 bone vertex bone texture -1 material material frame
+bone 0.500000 = vertex frame vertex texture =
+material = = material =
+= bone 0.500000 frame
+texture texture texture anim material anim 0.500000 bone
+anim 1.0
+1.0
+-1 texture
+anim vertex material material frame
+bone 1.0 frame
+-1
+-1 1.0
+frame vertex material 1.0 -1 -1 1.0
+anim texture bone frame 1.0 0.500000
+= = vertex -1 0.500000
+material
+bone bone vertex
+bone frame = -1 anim = frame frame
+material frame material frame 1.0 0.500000
+frame material vertex
+material 0.500000 bone
+1.0 material material bone anim material
+texture vertex 1.0 vertex 1.0 0.500000 bone frame material -1
+bone
+material
+0.500000 -1 vertex
+0.500000 = vertex frame
+=
+anim
+=
+bone
+0.500000 =
+vertex 1.0
+-1 = -1 bone frame anim
+texture 0.500000 0.500000 = vertex texture anim
+0.500000 anim 0.500000 vertex = 1.0
+frame
+frame
+0.500000 material -1
+=
+-1
+frame vertex
+bone anim texture 1.0 =
+0.500000 vertex
+material
+0.500000 0.500000 = texture material
+anim vertex
+frame anim -1
+texture
+= anim
+0.500000 = vertex bone bone -1 =
+bone
+frame
+material
+= anim -1 vertex vertex texture
+anim 0.500000 -1 -1 0.500000 material
+= = bone 1.0
+frame anim anim =
+-1 material texture = -1 -1 material
+bone = material texture
+= vertex 0.500000 texture 0.500000 = -1 0.500000 texture
+anim texture anim
+material
+anim
+0.500000
+anim = -1 -1 material anim
+1.0 frame = -1 = vertex = -1 = anim
+0.500000 -1 = 1.0 texture frame vertex
+vertex bone vertex frame
+=
+vertex -1 material frame anim
+vertex 1.0 texture material = vertex
+vertex
+vertex -1 vertex frame 1.0 anim
+anim vertex texture vertex -1 frame
+1.0 texture texture material -1 1.0 1.0 texture 1.0
+=
+vertex 1.0 anim
+1.0 anim 0.500000 bone texture
+1.0
+frame texture vertex 1.0
+= = 1.0
+frame
+material texture
+texture 1.0
+-1 anim 1.0 material anim texture
+frame frame vertex 1.0
+frame 0.500000
+frame
+material bone bone vertex
+-1 material -1 1.0 frame -1 anim
+0.500000
+1.0 frame 0.500000 bone
+frame 1.0 texture = -1
+anim 0.500000
+vertex -1
+0.500000 -1 anim frame anim material bone texture vertex material = material vertex vertex
+material anim 0.500000 1.0 0.500000 vertex texture frame bone
+material frame -1
+0.500000 bone frame vertex
+vertex texture anim
+vertex anim anim
+1.0 texture
+bone
+material material
+anim anim 1.0 bone material vertex
+-1 material
+= anim
+bone bone frame frame vertex texture 1.0 bone anim
+anim =
+=
+0.500000 = texture 0.500000 bone 0.500000 anim frame = frame -1 material 0.500000 -1 bone
+frame vertex
+frame texture -1
+0.500000 -1 anim bone
+= vertex 0.500000
+0.500000
+1.0
+0.500000 frame
+frame vertex 0.500000 texture
+material bone material
+material vertex =
+0.500000 0.500000 bone -1 1.0 = frame bone
+0.500000 texture bone anim
+texture 0.500000 material 1.0 anim 0.500000 = -1
+-1 texture 0.500000 0.500000 texture frame 1.0 1.0 1.0 = vertex 0.500000
+1.0 texture
+texture vertex
+bone 0.500000
+frame
+anim 1.0 vertex vertex
+-1 material = vertex bone frame = frame -1
+anim -1
+1.0 texture
+frame
+material bone 1.0 1.0 -1 material
+material 1.0
+= 1.0 1.0 texture
+=
+anim frame 0.500000 0.500000 frame = bone -1 vertex vertex 1.0
+=
+vertex -1
+material frame bone
+0.500000 0.500000
+0.500000 bone frame frame material bone =
+frame 1.0 anim
+0.500000 0.500000 1.0 texture frame 1.0 1.0 1.0 vertex = anim frame
+vertex
+bone 1.0 =
+vertex
+material 1.0 texture material -1
+vertex 1.0
+0.500000 bone texture
+vertex -1 anim
+-1 frame vertex 0.500000 anim 1.0 vertex
+texture material
+frame material bone 1.0
+-1
+material bone bone 1.0 0.500000 texture texture material vertex 0.500000 1.0 texture -1
+texture =
+-1
+= -1
+bone 0.500000 frame 0.500000 bone material vertex -1 vertex 0.500000 texture
+ma
\ No newline at end of file
@@ -0,0 +1,61 @@
+vertex frame 0.500000 1.0
+texture 0.500000
+bone texture
+material -1 0.500000 0.500000 texture bone
+frame 1.0 bone
+anim
+bone 0.500000
+bone
+-1 texture -1
+=
+-1
+1.0 vertex
+bone material frame bone 0.500000 -1 bone -1 material material
+anim 0.500000 bone texture vertex material
+frame = anim material =
+1.0 =
+-1
+frame material =
+vertex frame vertex 0.500000
+bone
+texture
+texture 1.0
+material = material texture material bone vertex vertex anim material = bone
+bone material
+vertex 0.500000 0.500000 vertex vertex
+anim vertex
+vertex anim vertex =
+frame 0.500000 material 0.500000 bone
+= material frame
+0.500000 -1 frame = frame bone = -1 = 1.0
+= 1.0 -1 texture = texture frame 1.0
+anim vertex vertex anim material
+0.500000 material 1.0
+1.0 texture anim anim -1
+bone
+anim
+anim bone
+0.500000 material anim
+bone -1 1.0
+-1 0.500000 1.0 1.0 texture -1 vertex 0.500000
+frame 0.500000
+material texture
+0.500000 = frame
+material 1.0 = material material anim material
+bone
+bone
+1.0 vertex 0.500000
+material anim -1 vertex = texture bone 0.500000
+texture 0.500000
+= 1.0 bone -1
+=
+bone
+bone material material texture
+anim
+bone = vertex frame texture anim bone 0.500000 material material
+texture
+bone
+frame frame frame bone
+0.500000 material bone = bone vertex anim anim vertex 0.500000 anim
+bone anim = -1 texture
+vertex vertex frame anim -1 =
@@ -0,0 +1 @@
+ј3vԗ"3MJc7,L#,sD5}
\ No newline at end of file
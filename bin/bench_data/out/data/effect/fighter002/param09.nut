@@ -0,0 +1 @@
+qV&,rԧg46$ <H)"N-s,4s7˲zF
\ No newline at end of file
@@ -0,0 +1,9 @@
+frame anim vertex
+frame material vertex = 1.0 0.500000 = anim frame = -1
+material anim material bone
+1.0
+= 0.500000
+vertex bone
+-1 frame anim
+bone texture bone texture frame
+= material bone tex
\ No newline at end of file
@@ -0,0 +1,44 @@
+1.0 material material 1.0
+vertex frame texture vertex
+vertex
+= texture = 0.500000 frame bone material
+vertex
+material 1.0 material frame bone
+1.0
+material 0.500000
+material
+0.500000 texture
+texture texture bone frame material = vertex anim 1.0 -1
+material
+bone
+frame -1 anim
+anim anim
+-1 texture anim 0.500000 frame
+texture
+vertex anim frame 0.500000 0.500000 bone =
+1.0
+-1 frame = 1.0 frame
+=
+0.500000 1.0
+frame
+1.0 vertex = material anim -1 bone = material anim
+0.500000 texture = anim
+material vertex =
+1.0 bone frame bone
+vertex -1 -1 frame -1 =
+anim
+0.500000 0.500000 anim frame -1 = texture -1 anim vertex 0.500000 texture frame vertex -1 -1 texture
+= -1 frame frame 0.500000 material 0.500000
+-1
+material -1 frame material anim = vertex vertex
+material bone vertex 0.500000 texture bone 1.0 = -1 vertex -1
+0.500000
+anim material material texture 1.0 1.0 material
+frame 1.0
+=
+bone bone bone frame
+1.0
+=
+material
+bone vertex
+material 1.0 text
\ No newline at end of file
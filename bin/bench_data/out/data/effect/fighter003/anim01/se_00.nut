@@ -0,0 +1,2 @@
+:OlT`OY6A%R1W\W{E
+g,λtSz'҇\nYYu==O;"9#_Ռ$ڒ!@ʝC{$}^QC
\ No newline at end of file
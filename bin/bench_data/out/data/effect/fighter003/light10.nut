@@ -0,0 +1 @@
+KWLtCY⾟pSSew79vx?\稦n/Cd77O3m	X\ u<GC'ݝSnL
\ No newline at end of file
@@ -0,0 +1,161 @@
+0.500000 -1 0.500000 =
+bone
+vertex vertex vertex 1.0 0.500000 anim texture bone vertex frame
+anim 1.0 material frame frame frame frame 1.0 -1 bone =
+0.500000 -1 frame 0.500000 texture -1
+-1 texture 1.0
+anim = 1.0
+vertex frame frame material = texture -1
+material -1 texture -1 0.500000
+material 0.500000
+bone
+frame
+texture vertex vertex anim bone
+vertex
+0.500000 = =
+texture
+vertex
+1.0 0.500000
+vertex texture -1 =
+anim frame 0.500000 0.500000
+frame 1.0 0.500000
+frame vertex = = vertex
+=
+frame frame texture anim frame frame material 1.0 -1 material
+-1 material bone frame 0.500000 material
+= vertex bone =
+frame anim vertex anim anim -1 texture vertex 0.500000 =
+texture
+-1 -1 vertex -1 anim bone 0.500000 texture -1
+frame texture = 0.500000 -1 texture = = 1.0
+material = anim -1 texture bone 0.500000
+0.500000 vertex frame vertex
+0.500000 0.500000 anim
+-1 1.0 0.500000 bone 1.0
+bone material 1.0 =
+frame 0.500000
+material material
+vertex = -1 texture
+bone
+texture bone
+= frame anim
+0.500000 = material vertex
+texture texture anim vertex
+frame 1.0 vertex anim 0.500000 texture anim
+anim =
+material -1 material
+texture
+0.500000 texture bone -1 vertex vertex 0.500000 vertex vertex
+1.0 bone = vertex = bone
+material
+0.500000 texture bone
+bone 0.500000 vertex bone vertex texture anim anim = bone = frame
+=
+texture
+vertex bone
+0.500000 -1
+anim 1.0 material vertex vertex
+0.500000 0.500000 texture anim anim =
+= 0.500000 vertex
+texture 0.500000
+=
+texture -1 texture
+-1 texture frame frame material bone material texture texture
+1.0 anim 0.500000 =
+1.0 -1 anim
+vertex vertex = texture bone 1.0 -1 frame
+texture -1 0.500000 vertex vertex material bone
+-1 1.0 1.0 = 1.0 frame = 1.0 anim frame
+vertex
+anim material
+anim
+-1 anim
+material frame 0.500000
+-1 0.500000
+= anim 0.500000 = anim
+1.0
+anim texture = frame anim
+vertex 0.500000 -1 texture anim
+anim texture bone = -1
+0.500000 texture
+= 1.0 bone =
+0.500000
+vertex frame 1.0 1.0 -1
+texture texture anim
+1.0 =
+1.0 bone frame
+anim
+0.500000
+1.0 frame bone 0.500000 = frame texture 0.500000
+1.0 vertex frame vertex
+anim material 1.0 bone
+0.500000 -1 bone bone vertex 0.500000 -1
+1.0 -1
+anim 1.0 material -1 anim frame texture -1
+material anim = vertex -1 = vertex frame bone material bone bone 1.0 -1 bone 1.0
+1.0
+frame -1 texture
+-1 vertex vertex 1.0 material bone 1.0 = material bone
+= material texture frame 0.500000 vertex -1 frame
+anim vertex
+texture
+bone frame
+material -1 -1 1.0 bone 0.500000 vertex
+0.500000 frame
+texture
+frame bone
+vertex anim
+frame 0.500000 1.0 = -1 1.0 frame texture bone material texture 1.0 =
+bone texture texture bone vertex 1.0 = vertex
+1.0 = 0.500000 vertex frame anim
+vertex
+-1 bone anim
+bone 1.0 0.500000 = 0.500000 frame -1 texture texture bone
+= 1.0 1.0 texture
+texture material frame 1.0 0.500000
+texture 0.500000 -1 material = 0.500000
+anim anim frame 1.0 texture frame anim vertex texture 1.0
+vertex anim = anim 0.500000 -1
+texture vertex frame vertex anim frame material 1.0 vertex -1 =
+material -1
+texture anim
+texture = material 1.0 = = vertex
+anim frame = texture texture texture frame frame
+frame frame frame 1.0 anim vertex
+= -1
+bone -1
+-1 bone 0.500000
+bone 0.500000 frame frame frame
+texture material vertex
+-1 -1
+frame
+-1
+frame 0.500000 bone 0.500000 -1 bone
+-1 frame bone material
+-1 -1 anim bone vertex 0.500000 anim bone bone
+frame
+-1 material bone -1 1.0 1.0
+= -1 bone =
+= frame texture bone 0.500000
+0.500000
+frame = bone -1 texture 1.0 anim =
+= -1 -1
+1.0 texture -1 frame vertex 0.500000 0.500000 -1 texture
+frame texture texture material 0.500000
+anim frame
+1.0 bone
+frame =
+= -1
+-1 0.500000 -1 -1
+anim 0.500000 texture material vertex
+bone
+= -1
+anim
+0.500000 -1 -1 vertex
+1.0 texture anim 0.500000 vertex bone anim 1.0 material frame texture
+texture
+0.500000
+anim
+-1 material
+texture 1.0 -1 vertex
+0.500000 anim texture vertex material -1 texture 1.0 
\ No newline at end of file
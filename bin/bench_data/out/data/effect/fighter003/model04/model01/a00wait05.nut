@@ -0,0 +1,172 @@
+frame frame texture
+=
+anim frame -1 1.0 =
+frame texture bone material
+-1 1.0
+material frame
+vertex -1 bone 0.500000 0.500000 anim
+texture
+0.500000 bone
+-1 -1
+1.0 0.500000 texture
+texture anim
+frame
+bone
+0.500000
+1.0
+anim 0.500000
+frame bone -1
+material texture anim
+texture anim
+=
+bone -1 texture frame
+= frame material anim material frame frame 1.0
+= =
+material anim vertex texture -1 texture
+-1 bone material anim texture vertex texture bone bone 0.500000 = material vertex
+vertex material -1 -1
+-1
+0.500000 frame
+vertex 0.500000 =
+anim texture bone =
+=
+anim
+0.500000 material
+anim = 1.0 texture 1.0 =
+material anim anim texture
+vertex texture 1.0 0.500000 bone
+texture 0.500000 material
+-1 0.500000 = 1.0 = frame
+-1 texture texture 1.0 material
+bone 0.500000 texture 1.0 anim frame
+-1 frame
+vertex
+-1
+anim bone
+anim vertex 0.500000 texture anim = = -1 material
+= texture frame frame vertex 0.500000 vertex 1.0 1.0 0.500000 -1
+1.0 material vertex
+1.0 0.500000 vertex vertex frame
+1.0 -1 bone
+vertex
+texture 1.0 -1
+bone 0.500000 vertex vertex 0.500000 vertex anim frame texture 1.0 vertex
+vertex = 1.0 material
+1.0
+-1 vertex 1.0
+texture frame material = 0.500000 1.0
+1.0
+vertex material -1 bone bone -1 vertex frame =
+0.500000 bone frame texture
+bone texture -1
+vertex vertex
+-1 texture bone
+= vertex anim 0.500000
+texture anim
+texture bone vertex bone
+-1 = anim -1
+1.0 frame
+anim texture anim
+= vertex
+anim
+bone = 1.0
+anim 0.500000 0.500000 -1 vertex bone 0.500000
+0.500000 material anim vertex
+-1 texture -1 bone bone -1 texture material 0.500000 vertex bone
+frame
+-1 bone -1
+=
+0.500000 frame
+0.500000 anim
+1.0 anim vertex
+material -1 -1
+texture =
+0.500000 texture vertex anim
+1.0 -1 1.0 vertex
+vertex material = = bone vertex anim 0.500000
+material -1 frame 0.500000
+anim -1
+bone texture = frame bone
+frame
+anim vertex
+bone -1 vertex texture texture -1 frame 0.500000 bone 1.0
+texture material vertex
+material frame = -1 -1 texture texture 0.500000 anim
+vertex =
+material 0.500000 texture vertex material
+material = -1 bone 0.500000 vertex 0.500000
+anim vertex texture
+vertex vertex
+=
+-1 frame texture
+material = frame bone frame
+material -1 bone
+material 1.0 material
+bone 1.0 vertex texture
+= = texture
+1.0
+1.0
+1.0 texture texture 1.0
+= bone texture vertex anim
+texture frame
+anim 0.500000
+vertex 1.0 anim = -1 = -1 material 0.500000 = 1.0 1.0 vertex vertex vertex
+vertex anim
+= texture =
+= vertex bone 1.0 texture
+= 0.500000 -1 bone
+frame texture vertex =
+0.500000 0.500000 vertex texture 0.500000 0.500000 anim -1 vertex anim bone material bone texture anim texture 0.500000 vertex
+0.500000 texture = anim vertex 1.0
+bone 1.0
+1.0 -1 vertex
+frame vertex 0.500000 bone material
+0.500000
+1.0 material bone vertex frame frame
+bone vertex 1.0 material material
+1.0
+bone -1
+= texture texture
+vertex = material
+bone -1 texture 1.0 bone bone bone vertex 1.0 -1 anim = vertex frame material material bone
+bone 0.500000 -1 0.500000 vertex vertex
+= vertex 0.500000 1.0
+0.500000 -1 bone 1.0 -1
+= 1.0
+1.0 0.500000 vertex vertex frame 0.500000 material bone material
+vertex
+frame 0.500000
+1.0 frame
+material
+-1 vertex 1.0 bone bone anim
+= texture -1 bone texture
+texture
+material
+=
+-1 bone
+-1 -1 anim = bone bone texture frame material = 1.0 texture
+bone 0.500000 bone bone material = 0.500000 frame 1.0 texture
+=
+1.0 anim
+= = 1.0 vertex material material anim
+anim 1.0 1.0 1.0 anim 1.0 0.500000 1.0 bone texture 1.0 material frame texture = frame
+1.0 0.500000 = vertex material 0.500000
+-1 bone = bone
+0.500000 anim vertex 1.0 vertex
+0.500000 bone =
+texture anim 1.0
+0.500000 anim material -1 0.500000 -1
+1.0 vertex
+texture vertex
+vertex vertex
+frame -1 vertex
+bone
+1.0
+1.0 material
+vertex
+bone
+frame anim = frame 0.500000
+0.500000
+0.500000 texture bone texture texture
+frame 0.500000 anim 1.0 bone bone
+1.0 
\ No newline at end of file
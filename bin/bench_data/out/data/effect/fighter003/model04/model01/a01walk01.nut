@@ -0,0 +1,7 @@
+anim anim
+texture frame -1
+=
+1.0 = bone 1.0
+bone 1.0
+anim =
+texture 1.0
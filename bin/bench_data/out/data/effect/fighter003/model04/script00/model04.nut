@@ -0,0 +1,3 @@
+anim bone bone
+= vertex vertex texture frame
+= ve
\ No newline at end of file
@@ -0,0 +1,23 @@
+frame frame
+-1 -1 texture vertex texture frame 1.0
+bone = -1 anim vertex vertex bone 0.500000 vertex texture
+= material 1.0
+texture texture
+texture
+-1 anim vertex material
+vertex bone anim bone 0.500000 anim -1
+0.500000 material
+= anim anim
+vertex bone 0.500000 texture vertex = frame 1.0 material material vertex anim vertex 1.0
+texture 0.500000
+texture material = bone -1
+anim frame
+0.500000 texture texture texture anim material anim material anim texture anim anim -1 bone material vertex
+bone
+0.500000 texture
+anim anim bone material anim = anim
+= anim texture
+0.500000
+-1 bone frame -1 -1 bone 0.500000 anim anim
+texture
+bone
@@ -0,0 +1 @@
+70d0[%TS$О;x%1bp$Q1j
\ No newline at end of file
@@ -0,0 +1,18 @@
+1.0 1.0 frame anim -1 0.500000
+anim
+1.0
+-1 0.500000 0.500000 vertex -1
+material 1.0 anim -1 = anim 0.500000 anim vertex 1.0
+anim texture 1.0 bone bone texture
+anim
+0.500000 -1 texture frame = -1 anim
+vertex -1 bone texture frame
+anim vertex
+-1 texture anim anim texture anim vertex 1.0
+= 1.0 frame bone
+material -1 texture
+= 0.500000 bone frame frame material
+bone
+texture
+frame -1 texture bone anim vertex
+0.500
\ No newline at end of file
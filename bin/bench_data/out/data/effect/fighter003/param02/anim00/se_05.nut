@@ -0,0 +1,5 @@
+= bone
+vertex
+= 1.0 texture frame
+frame texture bone -1 bone bone
+material = vertex bone anim 0.500000 -1 0.5
\ No newline at end of file
@@ -0,0 +1,17 @@
+= bone 0.500000 1.0 1.0
+texture -1
+=
+1.0 0.500000
+frame vertex
+texture
+vertex frame = material = texture 0.500000
+0.500000 =
+material
+1.0 vertex anim 0.500000 bone 1.0 vertex
+frame material
+texture -1
+-1 texture material anim 1.0
+bone frame anim 0.500000 anim
+-1 1.0 texture texture 1.0 = texture texture material
+1.0
+bone 1.0 1.0 v
\ No newline at end of file
@@ -0,0 +1,14 @@
+-1
+texture = 0.500000 -1 1.0 0.500000 1.0 anim
+1.0
+bone
+bone =
+=
+bone anim 1.0 frame material
+0.500000
+bone 0.500000 0.500000 1.0 vertex
+vertex frame
+vertex anim frame material
+frame
+texture
+0.500000
\ No newline at end of file
@@ -0,0 +1,171 @@
+0.500000 bone 0.500000 vertex = frame -1 bone frame 1.0 1.0 0.500000 anim
+1.0 0.500000 = anim texture -1 bone vertex -1 anim anim -1 material anim =
+1.0
+bone
+material 0.500000 1.0 1.0 texture vertex frame 1.0 texture material 1.0 -1 bone frame -1 frame = texture
+vertex
+texture anim texture 1.0
+vertex
+= vertex 0.500000 texture = vertex
+0.500000 = vertex 0.500000
+0.500000 bone bone -1 material =
+-1 1.0 texture 1.0 -1 bone
+bone -1 anim 0.500000 vertex 0.500000 anim texture texture
+frame bone frame frame
+-1
+bone material
+frame vertex anim 1.0 texture
+1.0 vertex bone
+0.500000
+texture vertex anim texture = 1.0 0.500000
+-1 1.0
+frame bone anim anim
+frame texture 1.0 frame anim frame
+material vertex 1.0 -1 bone texture -1 = texture material bone =
+bone texture bone bone material bone 1.0
+= anim bone texture material -1 1.0 vertex
+1.0 -1 0.500000 vertex
+= frame
+texture anim
+-1 texture
+0.500000 material = = material 0.500000 1.0 1.0 -1 -1
+vertex anim = -1 0.500000 texture
+texture 1.0 bone vertex 1.0 0.500000
+-1 vertex material
+frame 0.500000 = vertex texture
+frame anim =
+anim anim texture texture
+vertex 0.500000 anim bone anim texture anim
+bone
+frame anim =
+0.500000 texture 1.0
+1.0 bone = material -1
+= 0.500000
+frame
+= 1.0
+texture anim
+-1 anim anim 0.500000
+-1
+1.0
+-1 material
+material 0.500000 anim bone 1.0
+material anim texture bone =
+frame frame = texture material
+texture anim vertex vertex bone frame anim 0.500000 vertex
+0.500000 vertex bone frame
+frame texture vertex
+-1 material bone 0.500000 texture
+anim 0.500000 anim vertex bone bone vertex -1 vertex
+anim 0.500000 = anim bone material 1.0 texture bone material bone 0.500000 vertex vertex
+texture 1.0
+texture
+texture
+frame vertex 0.500000
+-1 = vertex material vertex = texture = vertex
+=
+1.0 anim material
+anim
+vertex 0.500000 = = 0.500000
+vertex = 1.0 0.500000 =
+vertex
+material texture
+material
+anim
+material vertex texture frame -1 material vertex
+-1 1.0 0.500000
+material vertex
+frame texture
+bone
+vertex = 1.0 -1 material
+1.0
+bone
+anim
+frame material material frame
+anim frame =
+-1
+texture 1.0 texture -1 bone vertex
+-1
+anim 1.0 -1
+material texture
+0.500000 bone bone frame material
+0.500000
+anim frame anim anim
+material
+texture frame anim 1.0
+frame
+anim -1
+0.500000
+anim vertex texture material
+-1 bone = bone
+material 0.500000 0.500000 0.500000 0.500000 material 1.0 texture
+texture
+material 1.0 anim material frame anim = material
+0.500000
+-1 -1 texture 0.500000
+bone -1 =
+frame material 1.0 vertex
+texture texture =
+texture anim =
+-1 vertex material vertex vertex
+vertex
+material
+vertex
+bone
+0.500000 0.500000
+vertex bone texture
+material anim 0.500000 anim texture -1
+anim texture
+anim
+bone vertex -1 = 1.0 material material -1
+material
+texture -1
+texture 1.0 frame = vertex vertex -1
+anim
+frame
+bone anim frame
+material
+bone -1 anim material
+texture
+frame texture frame
+material -1 anim =
+texture vertex bone anim bone = -1 -1
+material bone bone -1
+1.0 = vertex texture 1.0 -1 bone texture anim bone 0.500000 texture bone vertex
+material 1.0 -1
+1.0
+material 0.500000 texture -1 vertex 0.500000 0.500000 vertex texture 0.500000
+= 0.500000 0.500000
+material vertex
+bone
+bone bone frame
+=
+= bone texture
+-1 1.0 bone texture
+bone 0.500000 = anim material 1.0 -1
+material = 1.0 frame bone -1 texture anim = material material vertex 0.500000
+anim bone anim anim 0.500000
+1.0 = anim anim bone anim vertex vertex = -1
+material material
+texture
+texture
+1.0 0.500000 material vertex 1.0
+vertex -1
+= -1 vertex anim
+frame =
+texture
+material -1
+anim
+frame vertex bone -1 frame bone
+-1 vertex texture vertex vertex
+bone bone anim 0.500000 texture
+texture 1.0 1.0 -1 frame 0.500000 vertex frame
+1.0 1.0 frame bone texture texture
+bone
+material texture
+-1 bone material
+-1 anim material 0.500000 -1 0.500000
+frame vertex anim vertex 1.0
+1.0 material -1 texture 1.0
+bone anim -1 material
+texture texture material
+bone textur
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim 0.500000
+-1 texture vertex vertex
+material 0.5
\ No newline at end of file
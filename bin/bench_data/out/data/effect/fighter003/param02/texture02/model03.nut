@@ -0,0 +1,197 @@
+anim = = texture anim bone bone 0.500000 = 0.500000 anim anim texture texture texture material frame 0.500000
+frame material -1
+0.500000
+anim material anim frame 0.500000 frame frame material anim 1.0 texture
+0.500000 anim material =
+-1 frame vertex
+frame
+1.0
+1.0 0.500000 material 0.500000
+anim texture -1 anim 0.500000 frame material
+material frame bone texture
+bone
+0.500000
+0.500000 texture anim bone
+= vertex
+1.0
+texture frame frame texture
+frame vertex
+vertex material vertex vertex
+material -1
+1.0
+vertex
+1.0
+= frame
+frame = frame bone 1.0
+anim =
+vertex
+1.0
+1.0
+bone = = vertex material -1 -1
+bone
+bone anim texture = -1 material vertex
+= texture
+= 1.0 texture
+bone
+frame
+1.0 anim anim bone
+-1 bone material
+0.500000 anim 1.0 0.500000 0.500000 0.500000 = 1.0
+frame -1 texture
+anim frame
+vertex texture
+texture
+material
+-1
+material bone 1.0 frame -1 = texture frame
+material 0.500000 frame = -1 bone material
+bone -1
+frame vertex texture
+-1 1.0 bone bone anim anim texture
+0.500000
+0.500000
+-1 vertex = material texture bone anim bone
+frame -1
+bone vertex material = 1.0 frame
+= frame 0.500000 1.0 anim anim material material anim 0.500000 texture
+= texture 0.500000
+1.0 vertex
+material =
+frame 0.500000 bone anim = anim = anim 0.500000
+frame texture
+-1 = =
+1.0 -1 frame bone 1.0 =
+-1 1.0 anim anim bone vertex 0.500000
+1.0 1.0 = bone texture -1
+vertex = 0.500000 texture 1.0
+=
+material
+= bone -1 texture material material bone vertex texture anim
+frame
+= 0.500000 -1 texture texture = bone -1 1.0 1.0 1.0 = frame
+material bone bone
+frame anim texture bone anim 1.0
+-1
+=
+1.0 = bone -1 -1
+texture -1 anim 1.0 0.500000 vertex bone vertex 1.0 anim vertex 0.500000 texture texture
+0.500000 anim
+frame 1.0 frame
+-1 texture 1.0 frame = = -1 material
+0.500000 anim anim texture frame
+1.0 vertex frame -1 frame = material bone
+vertex vertex texture
+vertex anim 0.500000
+texture frame frame
+material frame vertex material bone 1.0 bone
+-1 -1 material texture anim texture vertex
+bone
+1.0
+vertex material
+anim bone
+anim = anim
+texture 1.0 -1 -1 0.500000 = bone =
+= = 1.0 anim frame vertex anim texture bone
+bone
+0.500000 1.0
+bone texture anim -1 frame -1 = 0.500000
+1.0 vertex 0.500000 texture bone bone texture 1.0 1.0 -1 bone frame -1
+anim bone bone vertex 1.0 -1 vertex
+anim
+bone bone 1.0 vertex
+bone texture 1.0 anim 1.0 -1
+= 1.0 =
+1.0 material
+0.500000
+= 1.0 bone texture frame texture
+texture 0.500000 bone texture vertex texture
+frame 1.0
+vertex material bone
+anim
+frame material vertex anim texture texture
+0.500000 1.0
+material =
+frame vertex
+frame = bone = bone material texture anim
+texture 1.0 anim frame -1
+= material
+anim vertex vertex anim
+1.0
+anim 0.500000 anim = vertex 0.500000 material
+bone material bone
+vertex texture vertex material
+-1
+vertex bone 0.500000
+vertex anim
+frame
+anim
+material
+frame 0.500000
+frame
+-1 bone material 1.0 vertex vertex
+0.500000
+-1 vertex 0.500000
+texture 0.500000 vertex texture
+-1
+-1 anim 0.500000 0.500000 = texture material
+0.500000 vertex -1 0.500000 material
+0.500000
+material
+frame
+-1 frame frame bone 1.0 0.500000 material
+0.500000 bone vertex
+bone 0.500000 anim texture
+vertex texture
+bone material texture -1 -1
+0.500000
+texture material
+= bone
+= texture material material
+1.0
+vertex vertex material
+vertex 1.0
+bone bone -1 frame -1
+anim = material
+1.0
+0.500000 anim 0.500000 -1
+1.0 -1
+vertex bone bone
+anim -1
+-1 0.500000
+texture
+frame vertex bone anim
+-1 vertex -1 material vertex vertex 0.500000 frame 1.0 anim
+1.0 material -1 vertex frame
+frame vertex = -1 -1
+texture -1 bone
+material texture material bone
+1.0 frame 1.0 frame bone frame material
+anim
+bone anim = 0.500000 material
+= 1.0 texture texture 0.500000
+= = 0.500000 material
+1.0
+material
+-1
+texture anim =
+anim -1 texture -1 = 1.0
+bone material 0.500000 anim -1 vertex frame texture -1
+= vertex 0.500000 texture frame
+anim
+bone anim anim frame texture frame
+frame
+frame 1.0
+texture
+anim 1.0
+-1 material
+frame
+anim -1 frame -1 1.0 -1 bone
+anim anim anim 1.0
+1.0 frame frame anim
+vertex vertex vertex anim vertex 0.500000 anim bone anim 0.500000 1.0 material -1 anim 1.0 material vertex
+anim frame anim texture
+= frame frame
+= bone
+1.0 material 0.500000
+= vertex texture bone bone material bone =
+bone 
\ No newline at end of file
@@ -0,0 +1,10 @@
+material 0.500000 vertex frame bone -1 -1 frame
+1.0 1.0 anim bone -1 1.0 material 1.0 bone frame
+-1
+material 0.500000 = anim material anim bone
+-1
+anim
+material
+= frame -1 frame anim 1.0 frame -1
+vertex
+texture 1.0 texture vertex vertex anim 1.0 frame 1.0 -1 0.500000 0.500000 frame material anim = mate
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone frame = anim
+vertex vertex -1 frame 1.0
+bone material material = te
\ No newline at end of file
@@ -0,0 +1,3 @@
+= texture -1 material -1
+material 1.0 anim vertex -1 frame texture
+anim vertex vertex bone
\ No newline at end of file
@@ -0,0 +1,69 @@
+-1 anim texture anim 1.0 texture 0.500000 anim frame
+= = material texture material 1.0 = 0.500000 anim
+vertex frame -1
+bone
+material material
+-1 bone = -1 -1 texture vertex frame
+1.0 texture material 0.500000
+bone material anim anim texture frame frame
+anim texture vertex frame =
+material material material bone frame texture anim texture vertex anim vertex -1
+= anim
+0.500000 = anim bone 1.0
+=
+= 1.0
+= 1.0 material
+vertex
+-1
+material anim 1.0 material texture
+vertex -1 = texture
+0.500000 = vertex =
+anim texture
+bone
+frame
+-1 bone
+0.500000 1.0
+vertex -1 texture texture frame 1.0 vertex bone -1
+0.500000 = = texture -1 -1 material
+0.500000 material vertex anim
+1.0 material frame -1 -1 1.0
+bone vertex texture
+0.500000 vertex material -1 = texture 0.500000 frame frame 0.500000 =
+anim anim anim vertex
+material -1 anim
+bone anim texture anim vertex vertex texture 0.500000 bone 1.0
+material -1 -1 anim -1 -1 anim 1.0
+material material 0.500000 1.0 frame anim material anim 0.500000 material
+vertex -1 0.500000 texture vertex
+anim anim material vertex = texture 1.0 = material = material bone anim material = bone
+frame
+frame material
+-1 vertex = frame = -1 1.0 1.0
+-1 vertex -1 0.500000 frame vertex 1.0 =
+texture vertex 0.500000 texture =
+anim vertex material
+vertex
+= texture texture texture 0.500000 1.0 = -1 vertex
+bone bone
+material = -1 -1 frame 0.500000 frame texture
+0.500000 frame 0.500000 frame bone anim
+1.0 frame
+vertex vertex bone
+-1 material
+frame material texture
+0.500000
+anim anim
+texture bone frame anim bone vertex = frame material material = = -1 0.500000
+material
+= -1 =
+1.0 anim -1 1.0
+vertex 0.500000 0.500000
+material 0.500000 bone = frame -1
+anim anim -1 vertex bone texture
+-1 anim anim
+anim anim 0.500000
+vertex texture -1
+1.0
+material = frame
+bone
+bone vertex 0.500000 anim 
\ No newline at end of file
@@ -0,0 +1,277 @@
+= texture
+frame bone material -1 -1 =
+texture
+0.500000 1.0 frame frame
+bone
+=
+bone
+frame texture texture
+frame texture 1.0 =
+= 1.0
+1.0
+1.0 1.0 material vertex bone frame texture =
+= 1.0 -1 vertex
+anim material
+-1 bone vertex bone vertex anim
+material frame anim material 1.0
+0.500000 frame anim vertex bone vertex
+1.0
+= 0.500000 1.0 = vertex = vertex = = texture frame -1 anim bone 0.500000 anim bone anim vertex anim 0.500000 texture 0.500000 texture frame vertex -1 0.500000 bone vertex frame = -1
+= texture
+= -1 anim texture
+texture -1 texture
+texture
+0.500000
+frame material
+0.500000 -1 0.500000 vertex 1.0 anim -1 bone 1.0 anim vertex -1 frame = texture
+-1
+frame vertex frame
+= 0.500000 =
+material anim material texture material =
+material = anim frame texture 1.0
+0.500000 0.500000
+=
+-1 frame vertex 0.500000 texture =
+material
+= vertex vertex 1.0 vertex -1
+material 0.500000 texture bone
+anim
+= texture frame bone anim 0.500000 frame vertex
+0.500000
+frame
+0.500000 0.500000
+=
+vertex 1.0 bone
+anim 1.0
+0.500000 material bone
+= anim frame frame
+vertex -1 0.500000 -1 material bone vertex 1.0 bone anim 0.500000 frame 0.500000 texture texture vertex
+material frame
+1.0 material anim
+vertex
+-1
+bone frame texture 0.500000 -1 texture anim vertex -1 -1 bone = texture material
+vertex
+bone anim vertex anim anim
+1.0 vertex vertex frame =
+texture
+frame 1.0 vertex vertex bone material frame
+= -1 vertex material vertex
+0.500000 bone
+frame material anim material
+0.500000
+vertex
+= texture -1 anim
+texture frame 0.500000
+-1 1.0 texture texture bone
+texture anim bone 1.0 1.0 1.0 1.0 bone -1 material anim frame bone
+= texture -1 bone vertex vertex =
+anim
+1.0 material
+frame anim
+-1 -1 frame -1 1.0 frame frame 1.0 0.500000
+anim vertex 0.500000 material -1 frame bone frame = bone material
+bone
+texture
+= 0.500000 vertex
+1.0 frame =
+1.0
+0.500000 vertex
+bone bone vertex anim
+texture vertex vertex material bone anim
+frame 1.0 vertex 0.500000
+texture frame 0.500000
+1.0 0.500000
+material
+texture bone
+= frame texture texture
+anim bone
+texture frame -1 texture texture =
+0.500000
+bone vertex material bone -1 texture
+= material vertex anim 0.500000
+vertex -1
+frame
+vertex
+-1
+material = texture -1 -1 1.0 vertex material 1.0 vertex bone anim vertex frame texture vertex frame 0.500000 1.0
+frame
+bone =
+-1 frame
+0.500000
+1.0
+= 1.0 vertex anim
+anim material anim 0.500000 material frame 1.0 material =
+-1 =
+frame material texture texture = = material material = bone -1 = = =
+texture =
+bone 0.500000 material anim texture frame 0.500000
+bone 1.0 texture
+bone material bone frame frame frame bone vertex 1.0
+anim
+anim = bone 1.0
+bone
+1.0 frame texture
+=
+1.0 material = 0.500000
+texture
+texture
+-1
+-1 frame texture 0.500000 anim material material
+bone
+bone
+anim 1.0 anim anim texture = texture bone vertex
+0.500000
+0.500000 vertex frame = texture 0.500000 = anim vertex
+0.500000 anim bone
+frame material 0.500000 vertex material material material -1 0.500000
+texture
+vertex vertex
+anim =
+bone
+=
+anim vertex
+-1 0.500000 vertex = = 1.0
+= -1
+vertex -1
+anim bone vertex vertex 1.0 frame material
+texture
+0.500000 0.500000 1.0 anim 1.0 material vertex material
+material -1
+anim anim
+0.500000 = anim =
+frame frame 0.500000 bone bone bone
+1.0 frame texture frame vertex 1.0 bone -1 anim = = 0.500000
+0.500000 bone 1.0 -1 -1 bone anim 1.0 -1 frame anim frame
+=
+anim anim anim
+vertex material frame texture -1 bone material texture 1.0 = = anim texture
+1.0 material material material
+frame frame bone
+vertex
+material =
+texture anim vertex vertex 0.500000 frame anim
+bone anim anim anim = frame texture 1.0 0.500000 material vertex
+texture
+anim
+-1
+1.0
+material vertex vertex
+anim anim frame -1 = material = bone bone 1.0 anim =
+0.500000 = =
+bone bone 0.500000 -1 material anim 1.0 material
+-1 texture 1.0
+material bone
+frame 1.0 anim 1.0
+vertex
+anim 0.500000 material vertex -1 texture bone = frame 0.500000 bone vertex
+= anim texture -1 vertex 1.0 anim frame 1.0 = material texture -1
+bone
+texture 0.500000 =
+frame vertex vertex material 0.500000 material texture material frame
+texture vertex bone
+material
+1.0
+bone vertex material frame frame texture
+-1
+material 0.500000
+material
+= frame bone
+material
+vertex 0.500000 frame
+texture 1.0 -1
+material -1
+= texture anim bone bone
+=
+=
+frame frame anim
+= bone -1 0.500000
+bone 0.500000 = material 1.0
+anim material texture
+0.500000
+=
+0.500000 vertex =
+material
+frame vertex
+frame -1 frame frame vertex =
+vertex = frame texture
+texture
+vertex frame material frame frame
+material 1.0 vertex
+bone -1 = material 1.0
+frame
+texture
+bone
+1.0 vertex =
+material frame -1 anim anim anim
+0.500000
+1.0
+bone 0.500000
+anim anim
+0.500000 frame
+vertex frame
+frame bone
+texture 1.0 -1
+frame
+= 0.500000
+frame
+vertex anim
+-1 frame vertex = texture texture
+0.500000 1.0
+material
+0.500000 vertex -1
+bone texture 0.500000 vertex
+texture 0.500000
+bone 1.0
+anim 0.500000 = material texture frame material
+anim 1.0 bone -1
+0.500000 -1 texture material anim
+bone 0.500000 1.0 0.500000 = material 0.500000 vertex -1
+-1 0.500000 vertex
+vertex vertex material vertex anim vertex
+frame = 0.500000 bone material
+frame material
+-1 frame texture vertex -1 material
+bone = material texture
+bone texture
+-1 vertex frame anim anim
+bone = texture 1.0
+-1
+vertex 1.0
+frame 0.500000
+frame frame frame
+1.0 0.500000 -1 anim
+0.500000 vertex
+texture 1.0 bone bone frame
+frame
+vertex 0.500000 1.0 0.500000 1.0 anim
+-1 vertex texture anim material
+vertex frame = anim bone frame anim frame 0.500000 frame = vertex
+0.500000 texture 1.0 anim texture = texture = vertex anim bone vertex material anim -1 vertex
+-1
+0.500000
+material -1 1.0
+bone
+-1 texture bone
+anim = -1 -1 bone
+material -1 0.500000
+1.0 texture vertex 0.500000
+= texture =
+bone
+bone bone
+anim vertex material bone
+anim 0.500000
+0.500000 frame
+material 1.0
+frame =
+vertex 1.0 0.500000 vertex -1
+1.0 vertex = texture 0.500000 frame material 1.0 frame
+frame = 0.500000 bone material 1.0
+anim
+-1 0.500000 1.0 =
+anim 1.0
+= -1
+1.0
+frame 0.500000 texture -1 1.0
+1.0 = =
+= bone anim 
\ No newline at end of file
@@ -0,0 +1,2 @@
+material
+frame texture = material fram
\ No newline at end of file
@@ -0,0 +1,39 @@
+bone
+texture material 1.0 vertex = -1
+vertex
+= -1 frame
+1.0 bone vertex
+-1 1.0 1.0 bone frame =
+1.0 vertex bone texture texture frame texture = material
+anim
+frame vertex 0.500000
+anim -1
+-1 -1 bone
+0.500000 texture -1 vertex frame vertex anim vertex =
+material 0.500000 anim = 1.0 anim material 1.0 1.0
+-1
+-1 bone
+0.500000
+= anim anim vertex 0.500000
+vertex
+anim vertex 1.0
+bone material 1.0 bone 0.500000 frame texture bone = anim
+frame texture
+bone bone
+frame vertex frame frame -1 = vertex
+frame
+vertex
+anim texture anim -1 bone
+material texture
+bone -1
+texture
+vertex -1
+bone = material anim material
+-1 -1 material bone
+1.0 0.500000 -1
+frame bone
+= vertex 0.500000
+anim vertex -1 = = texture
+-1 1.0 frame -1 vertex vertex
+frame
+t
\ No newline at end of file
@@ -0,0 +1,13 @@
+texture
+material
+material
+-1
+texture frame texture texture
+texture 0.500000 texture frame
+vertex
+1.0
+material
+-1
+1.0 texture = 0.500000 texture texture bone -1 material 0.500000 bone texture material -1 texture
+vertex frame = texture bone = vertex 1.0 -1 1.0 1.0
+frame bone verte
\ No newline at end of file
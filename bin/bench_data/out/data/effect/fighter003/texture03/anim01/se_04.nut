@@ -0,0 +1,12 @@
+material bone
+anim bone bone
+bone
+vertex material texture -1 -1
+anim
+anim frame 0.500000 frame material
+0.500000 -1
+frame
+bone
+vertex anim
+0.500000 bone bone
+anim bone tex
\ No newline at end of file
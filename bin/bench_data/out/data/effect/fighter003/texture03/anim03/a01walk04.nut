@@ -0,0 +1,3 @@
+bone 0.500000
+=
+texture frame = 0.500000 mat
\ No newline at end of file
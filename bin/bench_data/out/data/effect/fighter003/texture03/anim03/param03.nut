@@ -0,0 +1,219 @@
+-1 vertex
+-1 = -1 vertex frame 0.500000 0.500000 vertex 0.500000 frame = frame material
+bone 0.500000
+anim texture texture
+bone bone material vertex
+texture texture
+1.0 bone texture -1 frame
+frame anim 0.500000 texture = vertex -1 1.0 texture vertex anim texture
+vertex
+= = = anim -1 texture -1 -1 material vertex
+=
+= 0.500000
+bone anim vertex material -1 -1
+-1
+bone
+texture =
+1.0 anim vertex anim -1
+anim 1.0 = = 1.0
+1.0 = material material bone bone material anim 1.0 0.500000
+frame
+1.0 vertex
+anim
+frame
+anim material
+frame
+texture texture vertex
+texture anim
+frame 1.0 texture vertex texture anim
+texture texture
+1.0
+anim
+frame vertex frame vertex
+texture vertex 0.500000 anim frame anim
+0.500000
+-1
+frame
+texture vertex
+bone
+bone -1 vertex frame 1.0 material 1.0
+0.500000 0.500000 material
+0.500000 1.0
+0.500000 bone
+=
+texture
+bone 1.0 vertex = 0.500000 bone
+texture
+1.0 =
+frame 1.0
+vertex bone
+0.500000 anim = texture 0.500000 0.500000 texture 0.500000 1.0 material 0.500000 =
+texture -1 -1 -1
+1.0 material vertex anim vertex = frame texture
+1.0
+texture 0.500000 texture material 0.500000 -1 vertex material vertex -1
+1.0
+-1 1.0
+-1 0.500000
+frame texture material
+0.500000
+material -1 anim texture frame 0.500000
+bone material material texture
+frame
+0.500000
+-1 1.0
+material frame frame material anim material -1 frame bone bone
+frame anim
+frame 1.0 texture -1 1.0 frame material material -1 -1 1.0 vertex -1 0.500000
+anim
+frame vertex material frame material -1
+bone = frame bone 1.0 -1 = 0.500000 0.500000 0.500000
+material texture 0.500000 frame 1.0
+0.500000 vertex 1.0
+0.500000 -1 vertex 1.0 material anim bone
+material = 0.500000 = bone
+vertex
+= 0.500000 1.0
+texture
+vertex
+1.0 frame frame
+texture material bone
+=
+bone frame -1 material
+-1 1.0
+= vertex 1.0
+0.500000
+0.500000 1.0 material bone material
+1.0 -1 -1 vertex vertex texture
+-1 0.500000 -1
+0.500000
+frame
+vertex texture
+frame 1.0
+anim 1.0 anim = -1 bone frame 0.500000 material anim = = 0.500000 -1 0.500000 bone = 0.500000 anim 0.500000 material -1 material anim
+texture material
+material anim anim
+0.500000 material bone 1.0 vertex bone texture -1
+anim
+anim
+= 1.0
+texture bone vertex
+anim 1.0 anim -1 material anim
+-1 frame vertex material texture
+frame
+frame frame anim material bone texture texture texture
+texture anim vertex
+bone
+bone 0.500000 material frame 1.0 vertex 0.500000 -1 = texture
+bone
+anim 1.0 = =
+material
+frame texture
+1.0 texture bone
+0.500000 0.500000 -1 1.0 0.500000 texture bone bone
+frame
+material bone = anim texture 0.500000
+1.0 -1
+-1 1.0 vertex
+texture -1 material anim 0.500000 vertex = = texture frame -1 material vertex
+0.500000
+= frame anim 0.500000 texture 0.500000 1.0 material vertex
+texture vertex anim anim material
+vertex 1.0
+anim =
+= 1.0 bone material frame = anim = -1 1.0 vertex texture 1.0 -1 0.500000 = material
+1.0
+1.0 texture -1 material material 1.0 1.0 -1 material 1.0 material 0.500000 bone 1.0 frame 1.0
+material anim material
+material
+1.0 vertex
+=
+anim texture frame
+1.0
+vertex 1.0
+vertex =
+0.500000 1.0 = vertex anim material
+=
+0.500000 bone
+texture bone = material bone vertex frame 0.500000 anim anim = 0.500000 1.0 frame vertex frame material = bone -1 frame -1 0.500000 1.0
+-1 1.0 0.500000 frame texture material
+-1
+frame vertex 1.0
+bone 1.0 = material vertex
+vertex frame
+1.0 1.0 material bone -1
+0.500000 -1
+0.500000 0.500000 anim anim -1 bone frame -1 -1 material
+material 0.500000 = vertex vertex vertex
+vertex 1.0
+= vertex
+-1
+texture anim
+material = 0.500000 frame = frame bone vertex 0.500000 texture -1 1.0
+bone
+texture 1.0 vertex texture material material bone frame texture = bone texture 1.0 anim =
+0.500000 frame 1.0
+anim frame anim vertex 0.500000 frame texture 0.500000
+0.500000
+0.500000 texture -1
+vertex vertex vertex
+material vertex vertex
+frame -1 1.0 frame material bone -1 -1 = 1.0
+frame 0.500000 1.0 anim vertex frame texture 0.500000
+vertex -1
+texture 0.500000 0.500000 1.0 bone
+anim
+bone
+material
+vertex
+1.0 bone bone anim -1
+0.500000 bone vertex frame -1 0.500000
+1.0
+vertex vertex
+texture
+0.500000 bone -1
+vertex frame -1 =
+frame 1.0 anim 0.500000
+0.500000 anim 1.0 bone frame
+= 0.500000
+1.0 vertex bone
+= =
+texture frame = 1.0 1.0 -1 1.0 bone frame
+= 0.500000
+vertex frame anim = bone material anim anim material
+frame 1.0 1.0 vertex
+0.500000 1.0 0.500000 anim texture
+texture 0.500000 material material material
+anim -1 anim = material 1.0 -1
+anim -1 0.500000
+0.500000
+1.0 frame
+frame frame bone = material
+anim 1.0 1.0 material anim texture 0.500000 =
+texture = 0.500000 frame frame -1 vertex -1
+-1 bone texture bone 1.0 material anim
+vertex anim =
+-1 bone
+bone frame vertex
+frame bone anim 1.0 1.0
+1.0
+material = =
+material texture bone material 1.0 texture
+=
+vertex -1 anim bone 1.0
+texture
+-1 material frame
+bone anim -1
+1.0 = 1.0 0.500000 1.0 anim anim 1.0
+vertex material anim anim vertex bone texture texture
+frame -1 frame vertex 0.500000 1.0
+= -1 vertex material frame texture 0.500000 vertex =
+-1 -1 -1 =
+anim =
+material -1 = 1.0 texture bone frame texture anim 0.500000 vertex 1.0 vertex frame frame 1.0 1.0
+bone -1 vertex
+frame bone
+anim
+material
+vertex
+an
\ No newline at end of file
@@ -0,0 +1,28 @@
+anim frame
+frame anim
+0.500000 anim bone vertex = = bone frame
+vertex anim = -1 material = = material 0.500000 bone vertex
+anim vertex 0.500000 0.500000 bone vertex anim
+texture = 1.0 anim texture texture frame vertex vertex 0.500000 anim 0.500000 =
+0.500000 0.500000
+anim
+frame
+1.0
+anim 1.0 vertex 1.0 bone bone
+frame frame material vertex
+=
+1.0 material = -1 bone -1 vertex bone vertex 1.0 0.500000 material bone vertex
+material texture texture anim
+-1 -1
+material
+material anim frame anim 1.0 vertex anim texture frame 0.500000
+= 0.500000 1.0 1.0 -1 frame = anim bone
+anim
+anim -1 0.500000
+= vertex bone 0.500000 1.0 anim texture vertex
+1.0 bone 1.0 0.500000
+material -1 bone material bone frame 0.500000 vertex bone anim
+= material 0.500000 frame frame
+frame vertex
+= -1
+texture 0
\ No newline at end of file
@@ -0,0 +1,10 @@
+1.0
+0.500000 texture -1 0.500000
+-1 bone bone 1.0 vertex texture frame -1
+1.0 = anim frame anim texture anim
+material frame -1
+1.0 frame
+= texture anim anim
+bone
+1.0 texture
+texture 0.5000
\ No newline at end of file
@@ -0,0 +1,2 @@
+= = texture 1.0 -1 frame -1 frame = 0.500000 -1
+verte
\ No newline at end of file
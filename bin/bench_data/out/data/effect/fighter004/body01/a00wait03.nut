@@ -0,0 +1,32 @@
+anim frame texture
+0.500000
+material = 0.500000 anim
+0.500000 -1 vertex texture 1.0
+-1
+=
+material frame -1 bone =
+frame anim 0.500000 texture anim = 0.500000
+vertex material vertex =
+anim material anim frame = 1.0 -1
+1.0 anim texture -1
+anim 0.500000 = anim = bone = 0.500000
+material material
+bone bone -1 material anim bone vertex bone frame material vertex -1 = material frame =
+1.0
+anim 0.500000 -1 vertex bone = -1
+= = = = anim bone
+frame 0.500000 anim
+anim
+= -1 anim material frame frame
+texture 0.500000
+texture = frame
+-1 frame 1.0
+texture bone
+0.500000 0.500000
+1.0 = 1.0 0.500000
+anim vertex 1.0 0.500000 =
+=
+frame
+bone -1 material bone -1 texture
+vertex = material 0.500000 anim frame 0.500000 =
+1.0 f
\ No newline at end of file
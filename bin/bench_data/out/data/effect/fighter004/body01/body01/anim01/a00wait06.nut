@@ -0,0 +1,41 @@
+bone = vertex 0.500000 bone anim anim
+bone bone
+frame
+texture 0.500000 vertex texture frame
+anim -1 -1 anim
+-1 material 1.0
+anim material vertex
+0.500000 =
+bone 1.0 texture
+anim vertex
+material bone frame frame = bone
+anim texture vertex 0.500000
+bone
+=
+1.0 1.0 bone anim texture
+bone
+vertex anim
+0.500000 = texture 1.0
+1.0 0.500000 material 1.0 vertex frame texture texture texture bone
+texture -1 material frame frame
+material frame frame material 1.0 anim anim anim frame
+1.0 -1 frame
+frame
+anim 0.500000 material = 1.0
+-1 texture 1.0 material anim = 1.0 = material vertex 0.500000 = anim -1 vertex texture =
+material material
+texture -1 bone
+vertex vertex
+anim
+= = = frame -1 = vertex frame bone bone 1.0 anim
+-1 =
+frame 1.0 texture -1 texture bone
+1.0 material material
+material
+= 1.0
+anim vertex bone
+0.500000
+0.500000 material
+= texture -1 vertex 0.500000 texture material anim 1.0
+vertex anim material frame 1.0
+anim materia
\ No newline at end of file
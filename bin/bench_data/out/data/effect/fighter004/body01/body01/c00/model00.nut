@@ -0,0 +1,44 @@
+vertex
+anim
+frame 1.0 = 0.500000 material frame material bone anim -1
+vertex -1
+1.0 frame
+vertex
+1.0 texture 1.0 vertex material bone
+vertex
+0.500000 anim vertex = vertex vertex =
+bone texture
+0.500000 material 0.500000
+vertex
+1.0 -1
+-1 bone -1 material = material =
+-1 texture =
+anim material -1
+0.500000 bone bone frame material material
+0.500000 0.500000 bone texture anim -1 frame texture =
+frame texture 0.500000 = 1.0 material frame anim -1
+-1 vertex
+= anim 1.0 frame texture 0.500000 frame 1.0
+-1 bone -1 texture material -1 frame texture bone
+frame 0.500000
+anim
+0.500000 1.0 -1 material vertex
+texture
+frame 1.0
+bone
+1.0 -1
+texture anim = vertex 0.500000 frame material texture bone 1.0
+bone texture 0.500000 material 1.0 frame
+anim = 1.0 bone 1.0 texture anim anim -1
+bone
+texture -1 texture
+material
+1.0 1.0 0.500000 material 0.500000
+bone texture = = texture =
+-1 -1 =
+anim texture -1 anim = texture material 0.500000 -1 material
+=
+texture frame 1.0 frame bone anim =
+bone 1.0
+frame 0.500000
+material ve
\ No newline at end of file
@@ -0,0 +1,53 @@
+texture
+=
+bone
+frame material
+anim frame
+= frame
+bone
+material vertex
+-1 1.0 bone vertex bone -1 -1 bone anim 0.500000
+vertex
+0.500000 vertex -1 1.0 texture
+1.0 vertex texture
+1.0 1.0 -1 bone material anim 1.0 bone frame frame
+frame
+=
+vertex
+1.0 texture
+bone frame
+frame
+0.500000 1.0
+material 0.500000 -1 = vertex
+vertex vertex = -1 texture
+1.0
+= -1 = anim 1.0 vertex = bone 1.0
+= =
+1.0 0.500000
+bone
+1.0 anim vertex 1.0 -1 material material
+material
+bone
+vertex 1.0 bone frame frame
+1.0 -1 bone bone
+1.0 texture frame texture -1 frame
+vertex material
+vertex texture frame 1.0
+material texture 1.0 material frame
+0.500000
+0.500000 1.0
+1.0 = texture anim
+material frame 0.500000
+vertex -1
+texture material
+anim frame vertex = anim bone texture frame texture texture =
+frame vertex vertex texture 0.500000 -1
+-1 frame texture vertex
+1.0 material anim 0.500000 texture
+vertex 0.500000 =
+1.0 1.0
+texture = = frame
+material texture -1 texture anim 1.0 anim texture =
+texture bone
+material bone texture anim
+frame
\ No newline at end of file
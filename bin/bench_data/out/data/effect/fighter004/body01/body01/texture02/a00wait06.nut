@@ -0,0 +1,58 @@
+vertex 0.500000 texture frame
+texture = bone texture 0.500000 =
+1.0 0.500000 texture
+-1 material material texture
+material
+= material
+bone =
+= bone vertex bone bone -1 material material material
+-1
+texture vertex bone material frame 0.500000 texture texture material 1.0 frame frame
+-1 bone
+0.500000 material
+material vertex =
+vertex = 1.0
+= =
+0.500000 frame
+texture = frame =
+=
+frame 1.0 vertex 1.0 1.0 -1 1.0 = 1.0 0.500000 vertex = -1 vertex frame vertex
+material
+-1 = bone =
+vertex
+0.500000
+0.500000
+texture -1
+1.0 =
+frame = bone material texture frame
+0.500000 material -1
+1.0 = vertex texture frame 0.500000 vertex -1 material texture -1 material vertex material vertex -1 -1 1.0 anim 1.0 1.0
+0.500000 anim 0.500000
+-1 material 1.0
+vertex bone material 0.500000 material vertex
+= -1 vertex = frame 0.500000 = = 1.0
+0.500000 -1 texture material -1 frame
+texture 1.0 0.500000
+bone vertex texture 0.500000
+frame vertex 1.0 vertex
+= frame
+= anim bone anim
+-1 material texture bone material texture anim frame -1 -1 -1 anim texture 0.500000 1.0 texture
+anim vertex vertex frame 1.0 texture
+frame bone 0.500000 texture anim frame
+-1 anim
+frame
+vertex 0.500000 frame frame
+0.500000
+-1 0.500000
+frame 1.0
+0.500000 frame = 0.500000
+anim
+0.500000 bone -1 -1
+0.500000 -1 texture 0.500000 bone vertex = material frame
+= vertex anim bone
+-1
+frame
+-1 bone 0.500000 frame -1 = frame texture -1 frame anim = material
+0.500000 anim bone 1.0 anim
+-1 = texture material
\ No newline at end of file
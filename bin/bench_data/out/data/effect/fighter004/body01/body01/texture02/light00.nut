@@ -0,0 +1,135 @@
+material frame vertex texture 1.0 material 1.0 material
+-1 0.500000
+1.0
+frame material 0.500000 vertex
+frame
+material 0.500000 -1 texture frame = -1 =
+=
+material anim = =
+anim bone -1 -1
+=
+bone frame = vertex -1 vertex 1.0
+texture bone bone 1.0 material anim vertex 0.500000 bone -1 0.500000
+bone frame frame anim anim
+bone =
+texture
+frame texture = material texture vertex
+-1 frame -1 0.500000 anim 0.500000
+0.500000
+vertex 0.500000 vertex
+texture vertex frame texture anim -1
+texture anim
+frame -1 = frame -1 -1 0.500000
+0.500000 0.500000 =
+0.500000 material bone -1 vertex vertex anim anim vertex anim anim
+frame
+frame 0.500000 0.500000 vertex bone vertex
+vertex texture
+= = texture 0.500000 texture vertex 0.500000 anim
+frame frame anim -1
+texture 1.0 material 1.0
+-1
+material 0.500000
+-1
+-1 vertex
+anim 1.0 vertex
+anim 1.0
+material = texture
+vertex frame
+0.500000
+bone
+frame
+vertex 0.500000 = -1 -1 frame =
+texture material 1.0 frame = anim anim texture texture -1
+0.500000 material anim 1.0 frame
+anim anim anim 1.0
+0.500000 texture frame
+-1 = 1.0
+texture 0.500000 material -1 vertex
+texture = anim vertex 1.0 material material
+bone
+-1
+bone
+material frame anim -1 bone
+bone texture = 0.500000 material bone -1 -1 0.500000 frame
+= -1
+frame material 0.500000 material 0.500000 = bone =
+1.0 vertex
+anim frame anim
+-1 texture
+vertex texture -1 texture frame -1 =
+0.500000 =
+texture 0.500000
+bone bone
+1.0
+frame vertex anim -1
+texture anim anim 0.500000
+vertex -1 anim texture frame frame material bone
+material material bone
+anim frame 0.500000 0.500000
+= texture texture -1 frame bone 1.0 vertex 0.500000 material = frame frame
+-1 = texture -1 = 0.500000
+1.0 = -1 material texture
+anim
+anim -1 material frame
+frame material vertex
+texture = -1 anim anim
+vertex
+1.0 material 0.500000 frame
+bone vertex frame vertex anim 1.0 1.0 vertex
+texture frame anim bone bone
+bone
+bone vertex material 1.0 bone
+1.0 material -1 1.0
+bone anim vertex
+0.500000 texture material = bone anim bone bone 1.0 0.500000 0.500000
+bone anim texture
+texture
+-1 texture
+-1 bone 0.500000 anim
+1.0 bone bone
+vertex anim
+= vertex
+bone 0.500000 material
+texture anim material bone anim
+texture frame vertex
+vertex anim
+material material anim
+anim anim texture anim -1 bone
+texture -1
+bone anim = anim bone -1 0.500000 material
+anim -1 frame
+0.500000
+material 0.500000
+1.0
+material
+bone
+material 1.0 frame
+0.500000 anim
+vertex anim material
+texture
+0.500000 = 0.500000 0.500000 1.0 1.0 texture -1
+anim
+0.500000
+-1
+vertex anim = frame bone bone anim
+= anim vertex anim 1.0
+1.0 bone 1.0 material vertex vertex anim -1 frame -1 = material
+=
+1.0 -1 material
+= frame material material
+0.500000 =
+bone vertex =
+anim 0.500000
+0.500000
+anim 0.500000 bone 1.0 1.0 = bone vertex -1 texture vertex vertex 1.0 vertex 1.0
+frame frame vertex =
+1.0
+material
+material vertex anim 1.0 texture 1.0
+frame bone 1.0 frame anim =
+anim
+1.0
+frame vertex bone 0.500000
+vertex vertex = anim 1.0
+vertex vertex 0.500
\ No newline at end of file
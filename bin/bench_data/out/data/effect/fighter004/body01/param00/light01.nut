@@ -0,0 +1,3 @@
+vertex
+anim
+bone 1.0 frame anim -1 -1 ve
\ No newline at end of file
@@ -0,0 +1,55 @@
+= texture -1 frame bone -1 anim 1.0 1.0 material
+anim material
+vertex anim 0.500000 texture 0.500000 anim
+0.500000 anim
+frame frame 1.0
+frame vertex material bone -1 vertex bone = 1.0
+-1 1.0
+anim
+-1
+0.500000 frame vertex
+frame vertex material 1.0 frame
+1.0
+anim
+texture bone material material vertex
+0.500000 material =
+1.0
+1.0 frame bone 1.0 = material = vertex 0.500000
+bone
+texture bone
+vertex 1.0 frame vertex
+anim
+bone vertex
+vertex material bone 1.0 bone 1.0 frame 0.500000 anim material material -1 bone material -1 vertex = 0.500000 frame
+anim
+frame
+texture
+=
+0.500000 texture anim 1.0 0.500000 = frame
+frame frame
+texture
+vertex
+frame 1.0 bone bone 1.0 bone bone texture bone 1.0 anim material
+-1 texture texture
+texture bone
+anim -1 vertex bone
+frame frame
+anim -1
+frame
+1.0 0.500000
+texture
+-1
+vertex
+-1 vertex -1 =
+1.0 texture material -1 bone material material = bone
+texture frame anim
+material
+texture texture 0.500000 0.500000 1.0 material frame 0.500000 vertex =
+= = -1 1.0 material
+texture material
+texture frame vertex material
+-1
+vertex =
+material texture 0.500000
+anim vertex 0.500000
+vertex texture material material 0.500000 0.500000 vertex
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture vertex frame texture 1.0 -1
+material = vertex bone vertex 1.0 = =
+material
+anim
+texture
+frame material 0.500000 0.500000
+= frame
\ No newline at end of file
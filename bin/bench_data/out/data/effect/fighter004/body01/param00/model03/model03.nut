@@ -0,0 +1,22 @@
+1.0 texture =
+frame texture
+anim anim -1 0.500000 0.500000
+material 0.500000 bone anim anim =
+frame 0.500000 -1 texture = bone bone vertex texture
+material
+vertex vertex material = texture texture 1.0 texture 0.500000 0.500000 frame = 1.0 anim vertex
+0.500000 -1
+vertex texture
+anim 1.0 0.500000 bone
+texture -1 anim -1
+-1 texture vertex bone
+texture
+material
+anim 1.0 1.0 texture bone -1 material 0.500000
+vertex bone 1.0 material texture anim vertex vertex frame = anim bone material bone -1 frame material
+vertex material texture vertex
+frame material
+frame texture anim = bone
+vertex
+frame frame
+vert
\ No newline at end of file
@@ -0,0 +1,19 @@
+texture anim anim
+1.0 0.500000 =
+bone texture bone anim anim frame vertex bone frame -1 anim
+1.0 0.500000 vertex material 1.0 frame material frame
+material material
+bone
+anim -1 bone -1 frame texture anim frame material
+frame anim 1.0 = bone -1 frame
+frame -1 frame
+frame
+bone vertex
+1.0 = 0.500000 anim texture anim texture -1 vertex 1.0 bone frame frame
+-1 vertex 1.0
+vertex texture bone 1.0 0.500000 texture = -1 vertex -1
+0.500000 anim = vertex 0.500000 material
+1.0
+vertex
+1.0 anim material
+frame 0.500000 = 0.50
\ No newline at end of file
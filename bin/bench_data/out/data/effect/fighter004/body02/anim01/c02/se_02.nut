@@ -0,0 +1,11 @@
+= texture
+anim material
+-1
+material 0.500000 = 1.0 0.500000 anim = bone 1.0 1.0 material frame = frame frame anim 1.0 1.0 =
+anim
+-1 bone vertex = 1.0 anim frame material vertex texture
+bone 1.0 1.0
+anim vertex
+= 0.500000 frame =
+texture anim bone frame -1
+anim -1 texture bo
\ No newline at end of file
@@ -0,0 +1,38 @@
+material
+texture 0.500000 anim -1 bone material 1.0 material
+-1 texture
+vertex
+= material
+0.500000
+vertex texture 0.500000 -1 -1 = = -1 0.500000
+anim vertex texture
+vertex
+material
+material
+anim
+vertex
+anim
+= =
+1.0 0.500000
+bone
+1.0 1.0 bone anim frame bone bone
+material bone vertex = bone frame
+frame texture material frame
+vertex
+-1 material
+= frame vertex anim material bone anim texture 0.500000 texture 0.500000 0.500000
+anim material frame bone bone
+0.500000 0.500000
+=
+anim material 0.500000 = material bone =
+vertex
+frame
+-1 frame frame vertex -1
+material =
+0.500000 0.500000 1.0 = vertex
+0.500000 = frame 1.0 frame bone bone anim 1.0 bone texture vertex 1.0 1.0 bone 1.0
+vertex frame texture = texture
+0.500000
+-1
+vertex frame material vertex
+1.0 
\ No newline at end of file
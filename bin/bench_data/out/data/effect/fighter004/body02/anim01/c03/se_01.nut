@@ -0,0 +1,7 @@
+-1
+-1 -1 texture bone anim
+frame texture
+texture vertex
+texture
+frame frame 1.0 texture anim
+anim texture 0.500000 material bone 0.50
\ No newline at end of file
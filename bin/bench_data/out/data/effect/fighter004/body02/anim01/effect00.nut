@@ -0,0 +1,3 @@
+anim = frame =
+frame 1.0 -1
+frame m
\ No newline at end of file
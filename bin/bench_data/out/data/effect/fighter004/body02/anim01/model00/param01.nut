@@ -0,0 +1,7 @@
+bone = bone vertex =
+texture
+vertex -1 0.500000 1.0 0.500000 bone
+anim bone
+bone = frame anim material 0.500000 texture -1 bone = bone 1.0
+1.0 1.0 -1 0.500000 anim texture
+= = 
\ No newline at end of file
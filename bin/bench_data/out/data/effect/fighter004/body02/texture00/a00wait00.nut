@@ -0,0 +1,5 @@
+frame 0.500000 texture 0.500000
+-1
+-1 texture texture material
+bone
+texture = 0.500000 = material -1 bone texture frame 0.5
\ No newline at end of file
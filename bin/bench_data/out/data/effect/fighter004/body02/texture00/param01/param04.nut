@@ -0,0 +1,41 @@
+texture anim vertex = material -1 =
+= anim texture vertex anim bone bone bone
+texture vertex vertex bone material
+=
+frame bone vertex anim =
+= texture anim -1
+frame 1.0
+bone
+= vertex
+frame
+bone = 1.0 texture frame
+1.0 1.0 texture
+bone material material
+vertex
+-1 -1 = = anim texture 1.0 0.500000 = =
+1.0
+1.0 -1 vertex material 0.500000 texture frame anim vertex vertex texture vertex -1
+material texture
+-1 1.0 =
+vertex 1.0 -1 frame frame bone
+0.500000 -1
+=
+bone vertex material
+= vertex material bone
+-1 -1 material vertex vertex = 1.0 vertex vertex
+anim -1 bone material
+bone
+material
+texture -1 material frame anim = texture 0.500000 0.500000 1.0 vertex
+-1 0.500000
+bone 1.0 =
+frame
+material 1.0 -1 vertex frame bone bone vertex 1.0 =
+0.500000
+anim
+texture vertex
+bone -1 frame
+0.500000 frame
+texture frame
+frame
+anim m
\ No newline at end of file
@@ -0,0 +1,89 @@
+anim
+0.500000 anim vertex 1.0 bone vertex bone texture texture frame 0.500000 texture
+1.0 -1
+anim vertex
+material 0.500000
+anim bone bone frame anim =
+bone
+= = frame
+vertex -1
+= =
+= texture -1 bone bone anim bone
+material 0.500000 0.500000 frame =
+anim frame bone =
+vertex 1.0 vertex vertex
+material -1 anim = material 0.500000 texture bone material bone
+material
+-1 vertex bone anim
+= -1 material
+bone
+frame 0.500000 1.0
+-1 anim anim vertex = 0.500000 anim = bone -1
+= material = texture 0.500000 0.500000 0.500000 1.0 frame -1 0.500000 1.0
+1.0
+vertex bone
+-1 anim bone material material 0.500000
+-1 material
+= -1 bone anim 0.500000
+= bone = frame frame
+texture =
+=
+-1
+-1 =
+-1 -1 material
+vertex bone = bone anim
+bone =
+1.0
+vertex material 1.0 vertex vertex material frame vertex = vertex anim material = = frame 1.0 0.500000
+frame vertex texture material texture frame
+vertex frame vertex = vertex vertex
+frame -1 bone
+frame -1 -1 material material
+material texture texture
+0.500000 1.0 = 0.500000 -1
+material 1.0 vertex frame material frame
+1.0 -1 bone
+material frame
+texture
+-1 vertex
+texture = = texture
+-1 texture anim texture 0.500000 material -1 = bone frame 1.0 0.500000
+bone -1
+vertex
+0.500000 0.500000 1.0 bone texture 0.500000 vertex -1 1.0 material -1 bone anim 1.0 bone material 1.0
+bone anim
+= bone
+material 1.0 texture 1.0
+frame
+anim
+vertex anim = material
+-1 vertex -1 anim =
+-1 -1
+bone bone 1.0 vertex 0.500000
+frame anim anim
+-1 -1 texture 0.500000 0.500000
+vertex = -1 -1 texture = texture = frame 1.0
+bone
+texture = material -1 0.500000 0.500000
+0.500000 frame -1 = 0.500000 bone
+frame material material 0.500000
+=
+0.500000
+anim
+material texture material anim 0.500000 frame anim
+anim
+frame texture -1 material 0.500000 vertex
+1.0
+= = -1 0.500000 texture
+material texture
+1.0 frame
+vertex material
+vertex
+-1 0.500000 texture
+texture 1.0 vertex bone 1.0
+frame 1.0 bone 1.0 1.0 frame 1.0 anim
+0.500000 = =
+0.500000 0.500000
+-1 1.0 bone
+vertex = material texture =
+0.500000 vertex vertex material anim tex
\ No newline at end of file
@@ -0,0 +1,6 @@
+bone anim vertex vertex
+-1
+texture
+-1 anim anim 1.0 texture vertex vertex bone
+frame anim vertex 1.0 vertex material -1 0.500000 vertex bone 1.0 anim texture vertex -1 material =
+bone t
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex material frame -1 anim -1 bone vertex
+bone vertex anim -1 1.0 material vertex = anim -1 frame = anim
+-1
+texture -1 texture = bone frame anim bone vertex texture
\ No newline at end of file
@@ -0,0 +1,40 @@
+material frame
+1.0
+material texture 1.0 bone = 1.0
+0.500000 bone -1 frame vertex 1.0 -1
+material
+material material texture material
+texture bone 1.0
+= anim 0.500000
+anim 1.0 = bone bone anim -1 1.0 0.500000 vertex texture material
+frame frame 1.0
+-1 1.0
+texture vertex 0.500000 frame -1 bone -1
+anim frame 1.0 0.500000 texture
+0.500000 1.0 material
+vertex 1.0 texture
+-1 material
+frame -1 texture material
+1.0 anim frame
+1.0 texture
+material bone material material material vertex anim 1.0 0.500000 bone anim bone
+=
+anim 1.0
+bone frame bone texture anim 0.500000 -1 -1 frame
+=
+material material
+1.0
+0.500000 = anim
+-1 bone
+1.0 texture = = 1.0 frame anim 0.500000
+-1
+vertex anim
+material 0.500000
+frame
+texture vertex
+-1 material
+0.500000 =
+frame =
+material -1
+bone = 1.0 vertex
+= bone vertex 0.500000 material = material te
\ No newline at end of file
@@ -0,0 +1,5 @@
+= texture bone =
+-1 0.500000
+anim bone =
+material material -1 -1 anim
+=
@@ -0,0 +1 @@
+vertex anim = anim frame 0.500000 bone 0.500000 = material 1.
\ No newline at end of file
@@ -0,0 +1,6 @@
+= material bone bone
+= vertex bone vertex -1 anim bone anim =
+0.500000 material frame texture vertex
+anim frame
+material 1.0 texture = material frame anim = =
+frame texture texture 
\ No newline at end of file
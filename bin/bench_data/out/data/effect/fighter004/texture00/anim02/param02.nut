@@ -0,0 +1,9 @@
+texture
+-1
+-1 texture bone material
+0.500000
+material texture
+= -1 frame material = -1
+-1
+0.500000 material vertex 1.0
+0.50000
\ No newline at end of file
@@ -0,0 +1,89 @@
+-1
+0.500000 material = material anim = 1.0
+= = =
+vertex =
+material
+= = vertex -1
+material
+texture
+-1 bone =
+1.0
+anim
+material anim
+anim
+= texture
+bone vertex
+texture = 0.500000
+-1 frame
+frame
+bone material 1.0 1.0
+-1 -1 vertex = anim
+texture
+anim -1
+texture
+-1
+0.500000 -1 1.0
+1.0
+1.0
+bone
+texture
+1.0 = vertex 0.500000 =
+bone 1.0 texture bone 0.500000
+-1 0.500000 0.500000
+0.500000 -1
+= texture frame 1.0
+= texture 0.500000 anim
+vertex texture anim frame anim material 1.0 vertex frame -1 = bone
+0.500000
+texture 0.500000
+= =
+vertex
+bone texture anim
+-1
+0.500000 frame frame
+material 1.0
+1.0 frame bone -1
+vertex
+texture = frame
+material
+bone -1 1.0 bone
+=
+anim 0.500000 frame anim 1.0
+anim
+0.500000 frame vertex
+frame frame
+= texture
+frame vertex 1.0 frame
+-1 bone 0.500000 -1 = vertex = texture
+texture vertex
+vertex anim 0.500000 material 0.500000 1.0
+vertex = anim material
+texture 0.500000 frame anim texture material frame -1 material vertex 0.500000
+1.0 anim frame
+frame bone 1.0 texture
+-1 anim anim
+1.0 bone -1 bone texture
+texture frame -1 1.0 1.0 -1 frame bone frame
+vertex
+bone vertex
+frame -1 = -1 -1 material 1.0 0.500000 anim 1.0 frame frame bone texture material texture
+0.500000 -1 texture material texture 1.0 bone 1.0 material vertex bone bone bone
+texture -1 1.0 -1 material frame =
+material frame vertex 0.500000 frame anim anim = -1 vertex
+-1 0.500000 anim bone -1 texture -1
+material
+1.0 bone vertex 0.500000
+0.500000 vertex vertex
+vertex
+anim -1
+0.500000
+texture 1.0
+material
+-1 vertex vertex -1
+material
+frame vertex frame -1 1.0 anim -1 vertex vertex bone material texture texture 1.0 = 1.0 -1 material frame -1 material
+-1 -1 0.500000 = 1.0
+1.0 vertex anim
+frame anim =
+anim texture vertex
+frame -1 bone -1 frame texture = 1.0 0.50
\ No newline at end of file
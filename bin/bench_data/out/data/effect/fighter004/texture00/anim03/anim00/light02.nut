@@ -0,0 +1,5 @@
+frame
+bone material texture
+texture
+frame anim
+-1 
\ No newline at end of file
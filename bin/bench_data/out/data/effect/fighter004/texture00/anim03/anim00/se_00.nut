@@ -0,0 +1,101 @@
+frame
+material -1 texture vertex = material bone texture 0.500000 bone
+material vertex frame
+= 1.0 frame
+1.0
+vertex material anim bone bone = anim texture bone -1
+frame
+1.0
+frame
+anim vertex
+-1
+anim bone frame 0.500000 bone
+vertex anim frame =
+1.0 vertex 0.500000
+1.0 frame -1 0.500000 vertex frame -1 bone
+= bone = -1 material texture
+anim material material bone
+0.500000 1.0 -1 material 1.0 vertex = vertex material vertex anim bone -1
+vertex 0.500000
+-1
+vertex anim bone 0.500000
+material
+anim
+= frame frame anim texture -1 bone vertex
+0.500000 = -1
+anim bone = 0.500000 -1 texture
+0.500000
+material 1.0 material = material vertex
+vertex = texture frame 1.0 texture 1.0 0.500000
+0.500000
+material bone anim texture vertex frame
+= vertex material material
+vertex vertex
+0.500000 anim
+frame -1 bone = vertex
+-1 = =
+frame frame anim material vertex = frame material -1 vertex
+anim =
+0.500000 vertex =
+material -1 bone texture frame
+0.500000 0.500000
+1.0
+1.0 anim
+= material -1 =
+-1 texture material = =
+-1 anim material texture
+bone 1.0
+-1 1.0
+texture material material texture texture bone
+texture
+anim
+bone 1.0 1.0 bone
+frame 1.0 -1 material texture 0.500000 anim 1.0 -1
+1.0 texture frame -1 material
+-1 frame bone bone texture -1
+vertex =
+= bone bone
+-1 frame = 1.0 frame bone 1.0
+1.0 anim texture -1 = = -1 anim
+1.0
+= = 1.0
+bone vertex texture
+frame = = anim anim 1.0 vertex 1.0 texture frame frame
+1.0 frame
+-1 material frame
+vertex anim material
+texture
+= frame frame anim
+bone
+material = 0.500000 0.500000 texture vertex texture material material bone anim
+frame = 0.500000 texture anim = vertex 0.500000 bone -1 0.500000 bone 0.500000 -1 1.0 bone
+1.0
+bone anim = -1
+frame
+frame frame vertex vertex
+= anim
+bone vertex anim
+= texture vertex material
+0.500000 0.500000 material bone bone frame frame frame texture material texture
+frame frame 0.500000 vertex bone anim
+bone
+-1 bone
+-1 -1 1.0 = = anim
+-1 material 1.0 texture
+1.0 frame material -1
+= material anim 1.0
+texture bone bone texture texture texture frame
+material 1.0
+0.500000 texture
+-1 0.500000
+1.0 anim anim frame
+anim anim 1.0 frame bone vertex material
+vertex anim material bone anim frame
+-1
+1.0 anim
+material vertex 1.0 bone 1.0 = -1
+0.500000
+1.0 anim vertex material
+1.0 -1 anim material frame
+0.500000 -1 = texture 0.500000 -1 anim
+material vertex 1.0 = ve
\ No newline at end of file
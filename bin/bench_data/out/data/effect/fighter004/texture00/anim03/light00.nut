@@ -0,0 +1,15 @@
+frame material vertex vertex texture material
+= = -1 bone 1.0 0.500000 frame anim vertex 0.500000 bone 0.500000 bone 0.500000 -1
+material
+frame
+texture 1.0
+bone
+frame
+texture anim anim texture
+material
+1.0
+material 0.500000
+0.500000 material
+1.0 1.0 -1
+vertex
+bone anim fram
\ No newline at end of file
@@ -0,0 +1,74 @@
+frame
+texture vertex 1.0 0.500000
+-1 = 1.0
+-1 = 1.0
+texture
+-1 = 0.500000 anim = material anim 1.0 = anim
+frame texture
+0.500000
+vertex
+texture anim vertex
+frame anim =
+-1
+frame 1.0 -1 texture
+0.500000
+1.0
+= 1.0 material
+texture -1 =
+-1 frame texture vertex material vertex bone texture frame = texture
+-1 vertex
+texture texture 0.500000 frame -1 = material bone 0.500000
+vertex anim material material
+0.500000 frame vertex
+1.0
+1.0 vertex -1
+anim frame material =
+anim material 0.500000 bone
+anim 1.0 = bone material = material
+vertex
+texture texture
+-1 -1 texture bone texture 1.0 bone
+vertex texture
+frame
+material anim material bone material -1 frame material
+vertex frame anim vertex =
+vertex
+=
+anim texture bone material vertex anim vertex
+vertex vertex
+1.0 anim = material bone bone -1 bone vertex
+bone material
+frame texture = = 0.500000
+material anim
+bone vertex
+bone material material material material 1.0 0.500000 1.0 material bone 1.0
+bone
+vertex 0.500000 vertex 1.0 -1
+anim vertex = vertex -1
+bone bone anim
+texture bone
+-1 0.500000 anim 1.0 0.500000 anim vertex material
+bone
+vertex
+0.500000 vertex material 1.0 vertex = 1.0 material 1.0
+-1 bone -1 texture = anim
+frame texture frame texture -1
+material
+= -1 vertex anim anim material texture bone frame 1.0
+= material bone 0.500000 1.0 -1 -1 = material material anim
+bone
+0.500000
+-1 bone frame texture -1 vertex texture vertex -1
+vertex -1 anim =
+frame
+texture texture = 1.0 -1 1.0 0.500000 vertex
+bone 1.0
+= 1.0
+0.500000
+vertex texture material frame
+-1
+bone material 1.0 0.500000
+texture vertex -1
+= 1.0 =
+bone anim 1.0 material frame
+texture
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 1.0
+= frame anim
+0.500000 frame material m
\ No newline at end of file
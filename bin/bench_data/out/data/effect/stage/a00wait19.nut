@@ -0,0 +1,12 @@
+-1 bone 1.0 vertex -1
+material vertex
+= frame frame vertex bone -1
+vertex 0.500000
+material -1 vertex material
+0.500000 texture texture bone 0.500000 texture texture material
+1.0 0.500000 1.0 = -1 -1
+anim vertex -1 -1 texture = 1.0 anim frame
+= -1 -1
+vertex -1 -1 material 1.0 bone bone frame texture material
+texture
+bone texture frame 0.500000 fra
\ No newline at end of file
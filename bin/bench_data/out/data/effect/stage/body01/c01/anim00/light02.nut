@@ -0,0 +1,18 @@
+texture = bone
+frame material 1.0 0.500000
+vertex -1 -1
+0.500000 -1 bone 0.500000
+bone = texture texture
+vertex vertex
+-1
+-1
+= vertex anim -1 vertex vertex 1.0
+frame texture 0.500000 -1 0.500000
+vertex anim bone anim frame = = = material anim vertex = 1.0 texture 0.500000 texture
+-1
+frame
+frame
+frame 0.500000 0.500000 texture
+anim frame -1
+= = -1 -1 1.0 -1 = material anim frame anim
+ve
\ No newline at end of file
@@ -0,0 +1,314 @@
+bone
+anim vertex texture
+vertex vertex vertex
+0.500000
+texture 1.0
+texture frame material 0.500000
+= texture 0.500000 frame material anim 0.500000 vertex -1
+vertex anim 0.500000 0.500000 = anim vertex frame 1.0 bone frame
+texture
+1.0 vertex material vertex frame anim -1 frame
+bone bone = texture
+frame vertex
+1.0
+anim 1.0 material texture vertex vertex frame vertex
+frame frame -1 bone material material material vertex frame anim 1.0
+frame vertex -1
+0.500000
+0.500000
+anim
+-1
+=
+frame
+frame = anim texture
+frame frame
+=
+= frame 1.0
+material
+bone vertex
+-1
+vertex frame bone
+-1 =
+material anim bone =
+0.500000 1.0 1.0 frame 1.0
+-1
+=
+1.0 vertex = texture
+= 0.500000 -1 anim 0.500000 1.0 vertex
+bone -1 -1
+material
+anim frame vertex -1
+material anim material -1
+1.0
+frame bone
+frame bone texture -1 material
+vertex =
+material -1 frame material bone bone anim frame
+bone material bone vertex -1 1.0 = material vertex vertex
+-1 texture
+vertex 1.0 1.0 material anim
+bone frame = 0.500000
+frame vertex 0.500000 frame 1.0 =
+texture
+0.500000 bone texture vertex =
+texture 0.500000
+anim 0.500000 1.0
+material material -1 frame 1.0
+0.500000
+0.500000
+1.0 vertex bone bone texture -1 =
+-1 -1 material
+bone 0.500000 material = material material bone bone
+0.500000 = 0.500000 vertex bone frame = texture texture =
+= frame 0.500000 texture frame 0.500000 anim
+texture anim bone texture 1.0 vertex bone texture
+frame material
+vertex
+= material
+frame texture
+material bone texture anim material
+texture vertex -1 material 0.500000 = = anim bone = 0.500000 1.0 -1 frame texture texture 1.0 -1 vertex -1 material material
+=
+0.500000 1.0 texture anim 1.0 0.500000 = vertex = =
+vertex anim =
+vertex vertex = bone bone 0.500000
+anim anim 1.0 1.0 =
+material frame bone frame texture -1 anim
+-1 0.500000 0.500000 bone
+material
+0.500000 texture 1.0
+frame = = 0.500000 material texture
+material = 1.0 texture 0.500000
+material = -1 -1
+bone anim vertex 0.500000
+= anim texture bone vertex =
+bone
+texture 1.0 0.500000 material 0.500000 =
+1.0 frame texture anim bone bone texture material 1.0 texture vertex -1 material
+anim
+material =
+anim material vertex
+material material
+-1 texture -1
+material
+texture anim anim
+texture 0.500000 0.500000 1.0 anim 0.500000
+texture material material texture bone texture
+bone vertex 1.0
+bone 1.0 anim vertex bone -1 = 1.0 0.500000 = anim anim vertex texture
+frame texture 1.0
+frame -1 vertex 0.500000 = 1.0
+vertex -1 vertex 0.500000 -1 bone anim
+texture bone
+vertex 0.500000 frame texture
+0.500000 texture -1 1.0 anim -1 anim 0.500000 0.500000 1.0 material vertex
+vertex material -1 vertex 0.500000 anim
+texture
+-1
+-1 vertex texture texture frame material 1.0
+texture 0.500000 anim bone vertex 0.500000 texture
+bone
+0.500000
+anim
+0.500000 frame = -1
+= vertex frame material
+0.500000 -1
+bone material frame material
+anim
+vertex texture
+vertex frame 0.500000
+bone 0.500000 bone = frame vertex
+= vertex 1.0 bone = frame anim texture
+bone 0.500000 vertex vertex anim 1.0 1.0 texture 0.500000 vertex 1.0
+-1 material texture 1.0
+frame anim 1.0
+anim bone -1
+1.0 = anim 0.500000
+texture bone 0.500000
+anim frame frame frame vertex vertex
+anim 1.0 1.0
+frame anim frame
+0.500000 1.0 anim vertex bone 0.500000
+anim anim anim vertex -1
+texture
+texture vertex -1 vertex
+anim -1 frame
+1.0 vertex bone material bone = texture
+frame material
+bone 1.0 material
+1.0 -1 0.500000 bone
+1.0 1.0 material
+texture texture vertex
+= -1
+texture -1 = = 0.500000 anim vertex
+frame anim
+0.500000
+1.0 0.500000 frame -1 bone
+1.0 vertex 0.500000 material = bone bone 0.500000
+vertex vertex 0.500000
+material -1 texture = -1 bone -1
+texture bone 1.0 -1 anim 1.0 = frame
+texture texture
+anim frame
+frame
+material texture
+= frame material bone frame frame material frame = material bone anim frame
+= anim material = anim anim bone
+vertex frame -1
+vertex vertex -1
+bone
+-1 =
+anim vertex bone 1.0 = 1.0
+texture bone material texture = =
+= vertex
+material material
+1.0 0.500000 anim
+frame material texture anim 1.0
+=
+1.0
+frame anim
+1.0 0.500000
+anim texture 1.0
+frame material 0.500000 1.0 -1 anim = 0.500000 -1 frame vertex texture 0.500000 -1
+material frame texture anim -1 frame vertex
+frame anim frame = vertex
+= anim = bone =
+=
+anim anim 0.500000 material bone anim material 1.0 anim 1.0
+frame 1.0 1.0 -1 -1 vertex 1.0 1.0 0.500000 = = texture frame material vertex vertex
+texture anim
+1.0 frame = -1 vertex = material 0.500000
+material -1 texture 0.500000 -1
+vertex vertex
+bone frame texture bone texture -1 frame material frame = frame 0.500000 material
+bone vertex
+0.500000 1.0
+bone =
+vertex
+anim anim 1.0 = frame bone bone material material 1.0
+material anim
+bone vertex = -1 bone 0.500000 = texture 1.0 1.0 bone anim
+=
+= 1.0 material = frame material 1.0 vertex
+material 0.500000
+-1 1.0 frame
+vertex texture frame material 1.0 bone material
+texture frame
+-1 bone -1 texture bone 1.0 anim
+1.0 texture frame anim vertex frame frame anim vertex 0.500000
+anim
+vertex anim -1 1.0 anim vertex 0.500000
+vertex texture texture
+0.500000
+0.500000 -1 anim texture frame 1.0
+-1 1.0 texture
+anim
+0.500000 0.500000 frame 0.500000 anim texture -1
+0.500000 = frame -1 -1 = vertex 1.0
+material
+anim -1
+texture bone texture 0.500000 texture frame
+-1
+0.500000 bone
+vertex bone 1.0 frame anim
+-1 1.0 -1 bone
+material vertex 0.500000 frame -1 = bone 1.0 = anim
+-1 anim material -1 texture
+bone anim
+anim texture frame bone frame bone -1 frame = frame
+1.0 = frame
+-1
+vertex
+anim bone bone
+texture
+anim
+0.500000
+frame vertex material material 1.0
+= -1
+anim
+anim texture frame
+bone material -1 material -1 frame texture bone material -1
+-1
+frame = material frame material vertex frame
+frame = bone anim
+1.0 frame 0.500000 -1 bone 0.500000
+0.500000 = 0.500000 bone frame
+texture material 1.0 frame
+-1 anim vertex bone
+vertex -1 1.0 anim vertex -1 frame vertex vertex 0.500000 -1 bone
+frame 1.0 =
+texture anim
+anim vertex
+= material -1 frame vertex 1.0 1.0 material -1 vertex bone bone material anim
+1.0 =
+= bone = bone frame frame = -1 -1
+= bone anim vertex 1.0 frame
+anim vertex
+0.500000 =
+0.500000
+=
+bone material texture 0.500000
+material -1 texture frame bone = = bone vertex texture
+-1
+frame texture texture
+-1 = 1.0 vertex
+frame vertex frame anim -1 bone 1.0
+anim
+=
+=
+texture 0.500000 anim frame vertex
+0.500000 0.500000
+texture -1
+0.500000
+1.0 texture
+frame frame texture 0.500000
+bone frame
+frame texture
+vertex
+material
+material 1.0 -1 frame anim vertex texture texture frame -1 frame anim material -1 = = texture texture anim bone 1.0 1.0 frame frame -1 = texture
+frame vertex 1.0 bone = frame bone material 1.0 1.0
+vertex
+frame = frame = 1.0
+anim vertex 1.0 0.500000 bone 1.0 1.0 vertex material
+vertex
+anim 0.500000 anim =
+1.0 bone
+= = vertex 1.0
+anim anim vertex material = -1 frame texture vertex 1.0
+vertex material
+frame
+= anim
+1.0 texture texture 1.0 frame material
+anim anim
+frame 0.500000 bone 1.0 0.500000 = anim bone
+anim = 0.500000
+texture 0.500000
+vertex = bone
+0.500000 0.500000
+texture =
+-1 material frame anim bone = -1
+0.500000
+frame texture
+vertex -1 1.0
+-1 1.0 0.500000
+bone bone
+1.0 material
+frame
+bone 0.500000 frame = bone anim 1.0 1.0 vertex
+texture anim
+texture bone material = texture anim anim 0.500000 bone
+material
+-1 1.0 frame material
+0.500000 = bone 1.0 frame frame = 1.0 bone anim anim
+anim -1 0.500000 material 1.0 texture material -1 texture bone 0.500000 frame frame vertex = frame
+material 0.500000 frame material bone texture material anim =
+-1 -1 bone
+vertex bone
+vertex 1.0
+1.0 bone -1 bone bone -1 material
+vertex vertex bone 1.0 1.0 = frame 0.500000 1.0 bone vertex anim 0.500000 frame
+anim = -1
+anim = -1 material -1
+vertex frame frame
+material mater
\ No newline at end of file
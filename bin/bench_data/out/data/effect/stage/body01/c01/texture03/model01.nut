@@ -0,0 +1,71 @@
+material -1 texture
+-1 bone bone
+-1
+-1 -1 texture texture anim texture = texture 0.500000 texture bone
+frame bone
+1.0 = 1.0
+-1 -1 bone -1 texture -1
+material -1 -1 = material vertex
+= -1
+= frame
+1.0 anim 1.0 bone
+0.500000 anim
+=
+bone vertex frame material 0.500000
+vertex 0.500000 = vertex 0.500000 = texture
+=
+= = anim anim frame 1.0 vertex anim anim material 1.0 =
+vertex material bone material
+= material
+0.500000
+-1 anim texture anim = -1 -1 bone material 1.0
+=
+material texture frame texture texture
+-1 -1 0.500000
+0.500000 bone frame frame texture material bone anim 1.0 1.0
+= material vertex texture = bone 0.500000 -1 frame texture
+vertex texture
+vertex
+frame bone
+texture bone material bone 0.500000 frame vertex
+frame anim
+material texture material bone
+1.0 anim vertex bone material
+material
+texture 0.500000
+frame
+-1 -1 bone vertex
+vertex material material
+material
+anim
+0.500000 -1 bone 1.0 -1 texture texture vertex bone texture
+texture bone
+1.0 material = = frame vertex 0.500000 vertex 0.500000 vertex frame
+frame
+texture
+bone -1 texture = anim 0.500000 frame = 0.500000 material
+0.500000 = texture texture material anim 0.500000 bone
+frame 0.500000 bone
+vertex frame vertex texture anim bone
+frame =
+material
+frame = 1.0
+anim
+texture 1.0
+anim material -1 texture vertex 0.500000
+= bone vertex frame -1 0.500000 vertex anim
+texture -1 0.500000 =
+material bone
+anim
+frame 0.500000 1.0
+anim frame frame = vertex material
+bone 0.500000
+-1 =
+1.0
+0.500000 = material
+vertex vertex vertex texture vertex 0.500000
+bone
+bone
+vertex -1 -1 texture 1.0
+0.500000
+bone 1.0 0.500000 vertex -1 materi
\ No newline at end of file
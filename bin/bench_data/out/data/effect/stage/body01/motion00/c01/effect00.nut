@@ -0,0 +1,50 @@
+anim bone -1
+1.0
+= anim 1.0 material
+vertex
+anim bone
+1.0 vertex 0.500000 material frame =
+= frame vertex
+frame -1 texture vertex 0.500000
+vertex material vertex anim = vertex material -1 anim material
+vertex -1 bone
+vertex bone anim
+0.500000
+1.0 bone vertex 0.500000 = 1.0 bone anim bone material =
+1.0 =
+-1
+1.0 frame -1
+texture
+-1
+frame -1 vertex =
+material vertex 0.500000 anim
+anim frame
+frame
+1.0 0.500000 -1 anim 0.500000 -1
+-1
+-1
+bone 1.0 anim bone 0.500000 1.0 0.500000 = material anim 0.500000 -1
+frame bone material material anim = vertex
+0.500000
+material texture 1.0
+1.0 bone texture 0.500000 1.0
+bone -1 anim texture = bone -1 frame texture
+frame frame 1.0 1.0
+texture texture vertex texture
+bone vertex frame
+frame frame 0.500000
+material material anim vertex material
+vertex material frame 1.0
+bone
+anim 0.500000 = texture texture -1 0.500000 -1 vertex = material texture 1.0
+frame anim
+-1 frame anim frame texture 0.500000
+= 0.500000 1.0
+bone vertex material 1.0 = bone 0.500000 material 1.0 anim
+anim anim 1.0 bone anim bone = 1.0 0.500000 = material vertex
+1.0 0.500000 = vertex
+texture bone -1 0.500000 frame 1.0 bone = bone = anim bone -1
+vertex
+=
+texture vertex -1 anim 1.0 texture bone material anim bone frame texture frame bone
+a
\ No newline at end of file
@@ -0,0 +1 @@
+}xi~6ǳJIw~K{gmJ2&2pE?՘#x>Ƿ=Agתx^ht|삧2J'x
\ No newline at end of file
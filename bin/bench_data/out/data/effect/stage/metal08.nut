@@ -0,0 +1,183 @@
+= material = = =
+anim 1.0
+material = bone material =
+anim
+0.500000
+=
+0.500000 frame
+= vertex
+material
+texture anim anim anim frame 0.500000 anim vertex vertex
+= 1.0
+= = anim frame = bone
+frame = -1 vertex anim
+bone anim
+texture
+anim
+frame material -1 material
+1.0 anim vertex bone = 1.0 vertex -1
+1.0
+0.500000 texture -1 = vertex
+-1 texture texture bone material material =
+frame
+= vertex material frame texture
+material 0.500000 frame vertex = frame
+0.500000 anim bone material texture frame 1.0 0.500000
+anim vertex
+= -1 -1 texture frame 0.500000 bone
+0.500000 vertex frame vertex 0.500000 1.0 0.500000 -1 1.0 anim bone texture vertex frame -1 = vertex 1.0 bone 1.0 material 1.0 material = anim texture -1 1.0 =
+1.0 vertex vertex frame anim
+texture
+0.500000 texture
+anim bone bone = material frame material
+1.0 -1 bone material anim =
+texture 0.500000 1.0
+-1 0.500000
+vertex -1 -1
+= vertex 1.0
+vertex 0.500000
+anim 0.500000
+bone vertex frame -1
+-1 0.500000 material
+-1 material material
+-1 = texture material vertex
+material
+material 0.500000 -1
+material anim 0.500000 = vertex vertex 0.500000
+material frame vertex bone material 1.0 =
+0.500000 frame = frame vertex
+=
+texture 0.500000 frame
+= -1 bone material
+bone bone anim anim frame
+texture
+vertex
+0.500000 1.0 frame 0.500000 bone 0.500000 0.500000 material
+texture vertex 1.0 0.500000
+anim material material -1 frame -1 1.0 frame frame = frame
+= texture
+texture bone vertex bone = vertex
+texture material -1 0.500000 frame = texture 0.500000 =
+vertex
+anim frame texture frame
+frame
+anim 1.0 0.500000 -1 -1 texture bone = vertex frame -1 texture
+vertex 0.500000 1.0 frame
+material -1 texture -1 bone
+-1 texture vertex
+0.500000 material
+anim frame frame frame 0.500000 anim vertex bone frame 0.500000
+texture
+frame
+= 0.500000 1.0
+anim
+= anim texture texture -1 =
+-1 material
+material 0.500000
+anim = frame bone -1 -1 1.0 texture =
+texture = material vertex
+anim anim
+-1 0.500000 texture 1.0 frame 1.0
+texture frame
+anim
+material bone
+1.0 vertex frame
+vertex
+material
+texture bone bone texture
+= anim texture bone material bone 1.0 0.500000 0.500000
+texture frame anim anim -1 texture frame frame = bone -1 texture = vertex = bone -1
+1.0 bone
+vertex anim texture =
+= vertex vertex bone frame bone
+1.0 vertex
+anim material
+vertex
+material anim
+=
+frame 0.500000 anim frame anim bone -1 bone = anim -1 -1
+0.500000 material 0.500000 -1 anim
+bone 0.500000 = 0.500000 frame vertex -1
+0.500000 vertex = -1 = material -1
+1.0 1.0 0.500000
+0.500000
+texture frame material texture
+bone material anim 0.500000 texture vertex texture material
+bone anim texture frame 1.0
+0.500000
+0.500000
+frame material texture vertex anim texture material 0.500000 = vertex
+frame
+texture anim texture frame = = material
+0.500000 1.0 -1 texture material
+anim = material
+0.500000 0.500000 -1
+-1 frame vertex anim vertex texture 1.0 frame material bone anim -1
+texture material
+vertex 1.0 texture bone frame texture -1 anim vertex 0.500000
+material =
+material
+bone
+vertex vertex 0.500000 frame frame frame vertex
+= material
+anim vertex
+=
+-1 anim
+1.0 1.0 = bone material = -1 anim
+texture -1 -1
+vertex frame =
+=
+vertex vertex -1
+0.500000
+frame
+bone -1 vertex
+1.0 0.500000
+frame vertex bone = material 0.500000
+vertex
+material frame -1 0.500000 0.500000
+= 1.0 bone frame = 1.0 anim
+= 0.500000 vertex
+texture anim frame bone vertex 1.0 -1
+1.0
+1.0
+0.500000 bone frame
+= 1.0 bone anim 1.0 material
+1.0 -1 -1 1.0 anim
+bone bone material -1
+= material
+= bone anim material
+vertex 0.500000 0.500000
+frame anim
+0.500000
+-1
+= vertex texture frame texture anim -1
+= anim =
+bone -1 vertex
+-1
+vertex 0.500000
+= -1
+texture 1.0
+0.500000 frame
+bone
+1.0 material
+0.500000
+texture -1 bone
+vertex anim anim vertex
+-1 1.0 anim
+vertex = = = 1.0
+texture
+texture bone anim frame frame material =
+0.500000 = -1 texture 1.0 -1 -1 -1 1.0 = 1.0 frame 0.500000 1.0 -1
+frame 1.0 frame -1 frame
+bone =
+-1 0.500000 0.500000
+anim frame frame bone -1
+-1
+0.500000 texture 0.500000 anim vertex
+frame
+vertex 0.500000 bone vertex
+texture material vertex
+-1 =
+-1 -1 0.500000 1.0
+=
+1.0 vertex bo
\ No newline at end of file
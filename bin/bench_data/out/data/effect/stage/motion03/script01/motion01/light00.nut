@@ -0,0 +1,130 @@
+anim vertex -1 -1 material material
+1.0 bone
+material
+material 0.500000
+texture
+frame
+anim
+anim 1.0 frame anim
+frame frame = frame
+texture frame vertex
+0.500000 frame -1 vertex vertex
+1.0 texture
+= = anim 0.500000
+anim bone material -1 material =
+-1
+material
+anim material -1 1.0 bone
+frame vertex -1 0.500000 =
+texture
+0.500000 material bone material
+0.500000 -1 bone 0.500000 1.0 frame bone texture vertex frame
+texture material 1.0 material material -1
+vertex bone vertex 1.0
+frame
+-1 0.500000 -1 anim vertex 1.0 texture
+texture texture
+1.0 0.500000 frame = 0.500000 frame
+frame bone 1.0 = frame
+texture
+0.500000
+-1 texture frame -1
+frame
+bone -1 0.500000 bone frame material texture
+anim vertex = vertex vertex texture material frame 1.0
+material
+0.500000 -1 anim frame =
+bone
+material vertex
+vertex = 0.500000 texture texture
+anim
+bone
+vertex = texture 1.0 0.500000 1.0 anim 0.500000
+anim
+vertex
+0.500000
+bone
+bone = anim vertex material texture 1.0 frame
+texture vertex material
+texture bone vertex texture vertex -1 frame
+= 1.0
+texture
+0.500000 frame
+material anim = 1.0 bone texture 0.500000 bone frame
+anim
+vertex texture
+bone
+anim 1.0 material 0.500000
+-1 -1 frame
+vertex texture frame
+material anim
+bone texture
+= = frame frame frame 0.500000 = =
+0.500000 0.500000 -1 1.0 -1
+=
+-1 material anim
+0.500000 = vertex bone = material
+1.0
+1.0 material vertex -1
+frame vertex material 1.0 1.0 1.0 -1 bone = 0.500000 texture
+-1
+vertex
+anim material -1 material
+bone texture bone
+-1 vertex
+material anim anim anim frame
+vertex frame frame =
+material material -1
+anim vertex texture material -1 material 0.500000 = anim bone -1 frame
+frame -1 bone
+-1 frame vertex material material -1 = anim
+material = texture vertex frame vertex = -1 0.500000
+vertex vertex
+1.0
+bone bone frame bone
+=
+anim bone texture vertex 0.500000 0.500000 0.500000
+-1 vertex = -1 1.0 1.0
+1.0 frame anim 1.0 material =
+= texture vertex vertex -1 bone material texture
+frame material anim -1 anim material material material -1 vertex
+anim 1.0 = anim frame vertex 0.500000
+vertex material texture anim
+frame material bone material vertex vertex
+anim =
+texture bone -1 anim
+material 0.500000
+vertex anim anim = frame vertex = = -1 texture = bone bone 0.500000 frame texture
+1.0 = vertex
+1.0 0.500000 vertex
+material frame
+= vertex texture texture
+anim
+anim vertex
+texture texture
+bone texture
+bone -1
+anim =
+vertex frame anim -1 anim frame anim anim
+-1
+= frame frame frame bone 0.500000 vertex
+frame anim vertex = 1.0
+vertex frame frame
+= 1.0 material 1.0
+anim texture = texture
+material
+= anim =
+frame 0.500000 anim bone
+bone
+frame
+texture = anim frame frame
+frame -1 0.500000
+-1
+0.500000 vertex anim
+texture -1
+=
+bone bone bone material
+frame frame -1 bone
+-1 -1
+material = bone material
+frame 1.0 fram
\ No newline at end of file
@@ -0,0 +1,6 @@
+anim texture
+texture vertex -1 -1 anim vertex 1.0
+1.0 frame
+bone 0.500000 -1 material
+bone texture frame anim 1.0
+= texture
\ No newline at end of file
@@ -0,0 +1,37 @@
+texture material 0.500000
+material bone 1.0 = material anim
+frame
+texture 0.500000 frame -1 texture 1.0 0.500000 texture
+-1 anim frame vertex 0.500000 material vertex anim =
+material texture 1.0 anim -1 frame vertex 1.0 anim material
+frame
+bone texture material bone texture
+0.500000 0.500000 1.0 frame material bone anim
+anim
+vertex frame 0.500000
+-1
+-1 1.0 0.500000 bone
+-1 =
+bone vertex bone vertex texture = vertex
+-1
+anim material 0.500000 frame
+vertex 1.0 -1 bone frame
+texture material bone material texture = texture material = bone frame 1.0 -1 anim
+vertex anim 0.500000
+1.0
+anim anim 1.0
+-1 vertex texture vertex = -1 vertex =
+0.500000 -1
+-1
+frame 0.500000 frame
+1.0 texture = material bone 0.500000 =
+bone
+bone
+frame
+1.0
+material
+bone bone frame bone
+vertex
+=
+1.0 texture anim bone = = 0.500000 texture
+vertex -1 frame = -
\ No newline at end of file
@@ -0,0 +1,13 @@
+vertex frame = anim material
+anim
+= anim texture
+frame 0.500000 0.500000 bone texture bone
+0.500000 1.0 frame texture material material bone = bone
+1.0 material
+bone anim
+0.500000 anim frame frame texture anim bone
+texture 1.0 0.500000
+frame
+material anim -1
+0.500000
+vertex 1.0 mate
\ No newline at end of file
@@ -0,0 +1,18 @@
+bone vertex anim texture vertex = material anim bone
+= frame
+bone material 0.500000 frame 0.500000 = 1.0 texture frame
+material
+1.0
+0.500000
+-1 = 1.0 bone -1
+vertex 0.500000
+anim =
+= 1.0 frame
+bone
+texture
+-1 frame vertex vertex 1.0 = material anim
+vertex
+texture vertex
+vertex frame
+material bone material
+material vertex fr
\ No newline at end of file
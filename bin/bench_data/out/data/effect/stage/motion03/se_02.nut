@@ -0,0 +1,36 @@
+anim -1 frame texture texture anim
+0.500000 vertex vertex frame vertex vertex bone 0.500000 1.0 1.0 1.0 vertex
+bone 1.0
+bone
+-1 0.500000 1.0
+0.500000 vertex
+0.500000 material bone
+frame 1.0 material bone
+material
+bone -1 anim
+texture -1 1.0 1.0 anim vertex 1.0 bone texture material material vertex
+texture
+texture = anim texture vertex 0.500000 vertex
+0.500000
+texture anim -1 material
+= vertex frame anim
+frame
+0.500000 bone material vertex material
+material
+bone anim
+anim 0.500000
+anim =
+vertex
+1.0 vertex = vertex 0.500000
+0.500000 1.0 bone = vertex bone
+bone anim vertex
+anim bone
+-1 = texture
+= =
+material texture
+1.0 1.0
+texture 0.500000 =
+texture material anim bone
+0.500000
+vertex
+anim 0.500000 anim = frame texture fra
\ No newline at end of file
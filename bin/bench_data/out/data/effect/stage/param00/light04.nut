@@ -0,0 +1,109 @@
+= vertex material
+vertex material texture
+bone 1.0 anim bone 1.0
+0.500000 frame 0.500000 texture frame
+frame texture bone bone 1.0 vertex bone material frame 0.500000 0.500000 material frame
+0.500000 frame frame
+texture material 1.0 material texture texture anim
+0.500000
+vertex
+1.0 anim 0.500000 texture 1.0 bone
+frame 1.0 1.0
+-1 anim 1.0 vertex
+anim = 0.500000
+vertex texture bone bone texture
+1.0 frame texture
+1.0 = texture vertex 0.500000 -1
+0.500000
+texture
+0.500000 -1
+1.0 vertex bone anim material -1 bone texture
+0.500000 -1
+0.500000 frame
+0.500000
+bone
+vertex
+material 0.500000 material
+frame anim frame bone 0.500000 0.500000 vertex bone
+anim texture -1 -1 vertex bone 1.0 0.500000 vertex material frame =
+0.500000 frame
+1.0 frame bone
+material 0.500000 0.500000 bone = -1
+texture frame 0.500000 vertex
+= anim -1
+frame texture
+texture bone
+0.500000 vertex frame 0.500000 frame
+anim
+1.0 anim
+vertex vertex material 0.500000 frame 1.0
+material material material -1 = 1.0 1.0 material frame -1 frame
+= anim anim bone -1 1.0 -1 = frame 1.0 = material 0.500000
+vertex frame anim 0.500000 texture frame 1.0 0.500000 bone 0.500000 -1 bone
+1.0
+bone
+= bone 0.500000
+frame -1
+frame 0.500000
+anim 1.0 frame bone frame = frame = bone texture 1.0 =
+0.500000 material anim anim frame texture vertex texture material
+anim
+vertex bone
+texture frame vertex -1
+0.500000
+texture anim bone vertex vertex vertex bone material -1 bone texture vertex bone material
+0.500000 bone bone
+anim texture texture vertex frame frame anim
+-1 1.0 0.500000 vertex
+bone -1 bone texture frame 0.500000 vertex
+texture bone 0.500000 frame
+vertex frame 0.500000
+-1 1.0 0.500000 0.500000 bone
+0.500000 1.0 1.0 bone material texture frame anim 0.500000
+-1 anim material frame material material anim -1
+bone
+texture texture vertex -1 = material
+bone
+frame vertex 0.500000
+vertex
+material vertex -1 anim bone 0.500000 vertex bone
+1.0 1.0 1.0
+texture
+1.0 -1 bone 1.0
+bone 0.500000 1.0 anim -1 frame
+frame = anim 1.0 vertex =
+bone material
+anim material texture -1
+texture
+vertex bone anim anim bone vertex
+vertex vertex
+= vertex -1 1.0 bone = anim material
+-1 1.0 texture -1 vertex material 1.0 anim bone
+texture 0.500000 1.0
+material = 1.0
+-1 anim anim material material 0.500000 = 0.500000 = texture
+bone anim
+0.500000
+-1 anim anim 1.0 -1 = 0.500000
+anim 0.500000
+bone material texture
+anim
+-1 = frame
+frame
+= -1
+vertex -1 texture bone bone
+= material = bone = 1.0 =
+material vertex 0.500000 anim 0.500000 texture frame
+bone frame frame texture material 0.500000 bone texture
+texture
+texture 0.500000
+anim vertex
+-1 frame anim
+= 0.500000 =
+0.500000 0.500000 material 1.0 -1 material bone
+texture texture 0.500000 vertex anim 0.500000 -1
+=
+material texture = texture -1 -1 =
+0.500000
+material
+bone texture v
\ No newline at end of file
@@ -0,0 +1,17 @@
+bone
+bone =
+-1 bone 1.0 material = texture 1.0 -1 frame
+anim texture texture
+bone
+0.500000 0.500000
+frame texture bone
+vertex frame frame
+0.500000 = vertex material bone
+0.500000 0.500000
+= vertex material -1 1.0 0.500000 anim
+anim 1.0 material material -1 -1 1.0 vertex vertex vertex frame -1 bone 1.0 -1 texture
+0.500000
+0.500000
+bone
+frame bone vertex -1 material anim 0.500000
+material 0.5000
\ No newline at end of file
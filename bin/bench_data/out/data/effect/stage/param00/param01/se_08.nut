@@ -0,0 +1,3 @@
+anim 0.500000 bone bone
+= material texture bone frame material 1.0 frame
+anim 
\ No newline at end of file
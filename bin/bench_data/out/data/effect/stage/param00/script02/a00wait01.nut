@@ -0,0 +1,46 @@
+texture bone anim 1.0 frame -1 anim -1 = frame =
+0.500000 -1
+= anim
+vertex
+texture material
+material 0.500000 anim =
+0.500000
+-1 bone
+frame 0.500000
+1.0
+material =
+frame
+-1
+frame bone anim texture texture bone = texture = vertex 1.0
+-1 -1 texture texture -1 = texture
+anim
+-1 = 1.0 bone 1.0 bone anim texture
+frame vertex anim 0.500000
+material
+-1
+1.0
+vertex material
+= = bone 0.500000 frame
+frame anim frame 1.0 texture -1 frame texture 0.500000 material
+frame = 0.500000 vertex texture
+= = bone
+frame material 1.0 vertex frame = texture frame material = 0.500000 0.500000 = vertex 0.500000
+vertex = vertex =
+=
+material material texture bone =
+-1 =
+texture material 0.500000
+anim vertex
+-1
+bone bone
+frame texture = anim
+0.500000 = 1.0
+vertex material texture
+0.500000 -1 vertex
+1.0 texture vertex texture =
+vertex
+= vertex anim
+anim vertex
+frame vertex
+frame texture
+material frame -1 vertex ani
\ No newline at end of file
@@ -0,0 +1,28 @@
+0.500000 texture material
+frame
+1.0 anim texture
+0.500000
+texture texture texture vertex
+bone
+0.500000
+-1 anim frame -1 vertex material
+=
+vertex
+0.500000 0.500000
+-1 material 0.500000 bone vertex texture
+bone 0.500000 frame
+material 1.0
+vertex bone
+= 1.0 anim material vertex anim 1.0
+texture
+bone material
+vertex
+=
+anim
+0.500000 frame frame -1 1.0
+frame -1 material = bone anim anim frame bone anim 1.0
+anim 1.0 frame
+1.0 0.500000 -1
+texture
+bone anim 1.0 1.0
+ani
\ No newline at end of file
@@ -0,0 +1,76 @@
+-1
+anim = bone material
+frame 1.0 1.0 -1 anim vertex 1.0
+frame material 0.500000
+1.0 = texture
+bone vertex frame
+material
+texture material
+bone anim material 1.0 0.500000 material bone
+vertex = anim texture bone vertex
+= frame 0.500000 material
+1.0 -1 material frame
+anim
+anim
+1.0 0.500000 = 1.0 1.0 1.0 material
+0.500000
+bone
+anim
+bone bone 1.0 texture
+=
+anim texture = material frame = 0.500000 material vertex
+frame
+bone bone 1.0 anim
+anim = -1 1.0 = =
+= bone bone 0.500000
+frame material texture texture bone bone
+= frame -1 =
+texture -1 0.500000 0.500000 vertex vertex frame
+anim =
+0.500000 bone 0.500000 material texture 0.500000 -1 material material material 0.500000 material texture frame
+1.0 vertex
+anim texture
+= vertex anim vertex 0.500000 1.0 -1
+0.500000 frame 0.500000
+vertex material
+anim
+anim -1 vertex frame bone bone
+material vertex material anim
+1.0 texture
+0.500000
+anim
+anim
+vertex
+material
+-1 bone frame bone frame texture -1 1.0 vertex
+anim = -1 material 0.500000 1.0
+bone frame 1.0 vertex = frame
+frame 0.500000 bone = texture vertex vertex material 0.500000 texture = vertex
+1.0 frame 0.500000 = -1 -1 0.500000 vertex
+0.500000
+0.500000 frame = material
+bone texture
+vertex bone vertex vertex
+bone 1.0 frame anim frame -1 0.500000 anim material vertex =
+= bone texture 0.500000 0.500000 texture
+= anim texture -1 texture 1.0 anim
+frame = texture texture material frame 1.0 bone -1
+1.0 vertex vertex texture
+bone material
+vertex bone frame
+frame bone 0.500000 material
+= 0.500000 frame
+0.500000 frame anim
+texture bone 0.500000
+material -1
+material vertex = frame
+vertex
+= frame 0.500000 bone = frame = frame vertex = = vertex -1
+frame anim anim frame 1.0
+-1 vertex material texture bone 1.0 1.0 1.0 0.500000 texture -1 texture material anim vertex vertex 0.500000 0.500000 bone 0.500000 -1 vertex 0.500000
+1.0
+frame = -1
+vertex
+anim vertex
+texture = anim -1 = 0.500000
+vertex = vertex -1 bone 0.
\ No newline at end of file
@@ -0,0 +1,9 @@
+1.0
+frame
+0.500000 vertex
+anim vertex 0.500000 frame anim anim 1.0
+anim texture 0.500000
+vertex
+bone material
+bone =
+0.
\ No newline at end of file
@@ -0,0 +1,109 @@
+frame vertex material material vertex
+1.0
+anim 0.500000 anim frame texture 1.0 1.0 frame
+=
+0.500000 material frame frame bone bone
+-1
+texture frame = material bone 0.500000
+bone 1.0 anim texture 0.500000 -1 bone material 0.500000 vertex texture
+texture texture vertex = texture
+texture frame 0.500000 frame texture
+0.500000
+texture = = 1.0 vertex bone
+bone frame
+0.500000 1.0 material texture material frame frame vertex 0.500000 1.0 frame
+frame
+bone
+frame bone bone material vertex texture material anim
+texture frame texture vertex -1
+bone frame vertex 1.0 1.0 texture anim
+= -1 -1 -1 1.0 =
+anim anim texture
+texture
+vertex 0.500000 texture
+0.500000 -1 -1 anim frame anim -1 1.0
+anim
+texture 1.0 0.500000 1.0 1.0
+bone anim
+= material = anim vertex
+0.500000 frame frame frame = 0.500000 anim anim
+vertex frame
+bone texture 1.0 texture
+texture frame -1 vertex 1.0 material vertex frame -1 1.0
+= 0.500000
+anim texture texture 1.0 = 1.0 vertex -1 =
+-1 1.0 = -1 0.500000
+-1 1.0 texture frame 0.500000 vertex texture = anim
+frame -1 frame material 0.500000 frame
+bone
+vertex anim
+-1 -1 bone
+bone vertex anim frame 1.0 anim
+vertex
+vertex material texture
+bone anim material -1 0.500000 material 0.500000 texture 1.0
+vertex vertex = -1 vertex anim anim bone anim 1.0 anim
+-1 -1 1.0
+= anim -1 material
+0.500000
+0.500000 frame texture
+1.0 material
+1.0 anim =
+0.500000 anim vertex frame frame
+-1
+0.500000 bone 1.0 material anim
+texture vertex
+1.0 vertex 1.0
+frame -1 anim
+bone
+bone = frame 0.500000 0.500000 vertex bone texture
+bone bone =
+vertex bone = = = -1 0.500000
+bone vertex anim
+bone anim material anim -1 frame = = 1.0 -1
+-1 vertex bone frame texture anim 0.500000 -1 bone 1.0
+0.500000 = frame texture
+= material bone material 1.0
+-1 texture =
+= anim frame
+texture vertex
+anim
+texture frame
+vertex bone vertex texture
+material = 1.0 texture
+texture bone material frame 0.500000 anim =
+texture -1 anim 0.500000 0.500000 0.500000
+1.0
+texture texture material
+0.500000 1.0 0.500000
+0.500000 -1 anim texture frame vertex frame
+1.0
+anim
+texture 1.0 vertex anim =
+frame =
+vertex -1 = texture = frame anim material -1 1.0 vertex texture material anim -1 frame
+bone 0.500000 1.0 vertex
+-1 material
+vertex 0.500000
+frame frame material material texture vertex frame 1.0 vertex texture vertex frame bone texture
+0.500000
+1.0 1.0 1.0
+= bone material 0.500000 frame
+=
+bone =
+1.0 =
+0.500000 = anim -1 material
+0.500000
+0.500000
+material -1 =
+anim
+vertex material =
+bone
+-1 material 1.0 frame material bone
+frame frame
+= bone anim -1 0.500000 anim texture material texture 1.0 bone 0.500000
+1.0 anim texture texture anim
+bone
+0.500000 anim texture material texture =
+bone -1 bone = 1.0 -1 frame bone bone
+texture 
\ No newline at end of file
@@ -0,0 +1,17 @@
+material vertex
+bone -1 -1 texture 0.500000
+vertex frame -1 vertex frame frame 1.0 = = 1.0 frame -1 anim
+-1 texture texture
+material 1.0 material
+material 0.500000
+-1
+anim
+material anim material 0.500000
+= = -1 -1 frame
+anim vertex texture frame bone texture material bone
+vertex
+texture frame
+frame bone
+anim vertex texture
+frame bone texture material
+-
\ No newline at end of file
@@ -0,0 +1,14 @@
+texture
+vertex -1 frame 1.0 anim 0.500000 frame
+= bone frame
+texture frame material
+-1 anim material anim = 0.500000 texture
+texture
+anim 0.500000
+bone bone
+material
+anim
+texture -1
+frame material -1 0.500000 1.0 vertex anim
+-1 = 0.500000 anim = material texture vertex -1 -1 material 0.500000 texture anim -1
+anim frame material = -1 anim
\ No newline at end of file
@@ -0,0 +1,178 @@
+vertex texture
+anim 1.0
+frame =
+-1 material
+= = = frame texture texture =
+material
+anim vertex texture
+bone
+frame
+material vertex
+material
+frame
+0.500000 -1 -1 texture vertex bone bone bone 1.0 texture
+material
+-1 material anim bone 0.500000
+0.500000 bone -1 frame texture 1.0
+=
+-1 1.0 1.0 -1
+texture material -1 1.0
+= 0.500000 vertex = -1 frame anim vertex
+1.0 vertex anim 0.500000
+anim 1.0
+bone material -1 frame frame anim vertex anim
+bone bone texture vertex bone = =
+1.0 frame
+frame
+0.500000 frame
+anim texture 1.0
+anim vertex vertex 0.500000 vertex 0.500000 anim 1.0 texture
+bone 0.500000 1.0 0.500000 frame 1.0 bone anim frame bone = texture = bone
+vertex
+anim
+frame
+-1 1.0
+-1 bone
+0.500000 anim
+texture 1.0 texture texture 1.0 vertex
+vertex frame bone material material material
+bone = -1 bone 0.500000 =
+frame
+-1 -1
+texture
+1.0
+bone 0.500000 frame frame frame
+1.0 material texture
+material -1 = =
+=
+anim -1 bone frame bone
+1.0 = = anim 0.500000
+1.0
+texture = frame vertex -1 anim texture anim
+1.0
+-1
+material 1.0 = texture anim
+frame vertex -1 texture frame = = 0.500000 1.0
+texture 0.500000 0.500000 0.500000 anim material bone material bone
+material = texture frame
+0.500000 1.0
+0.500000 material -1 =
+frame vertex
+texture
+frame anim vertex
+anim 0.500000 1.0
+anim texture bone 1.0
+0.500000 anim -1 bone -1 0.500000 texture 0.500000 = vertex 0.500000
+= =
+-1
+material texture = frame
+bone anim 0.500000
+frame = material bone
+anim bone -1
+0.500000 material
+bone = 1.0 bone material bone 1.0 anim texture
+anim frame 0.500000 material = 1.0 texture vertex
+frame
+frame material
+=
+texture frame vertex
+material
+frame bone material
+= vertex 0.500000 0.500000 anim
+material material
+vertex -1 frame anim
+vertex = bone 1.0 frame bone texture
+anim 1.0 anim vertex texture 1.0
+texture texture texture
+0.500000 anim texture = 1.0
+material anim anim frame 0.500000 vertex
+anim -1 texture
+vertex
+bone material bone
+bone 0.500000 1.0
+= 0.500000 vertex
+anim 1.0 frame = = = 1.0 bone
+texture bone
+bone vertex 0.500000
+= anim frame texture -1
+0.500000
+frame
+vertex
+frame
+= 0.500000 1.0 0.500000
+-1 -1 vertex anim 0.500000
+anim
+vertex 1.0
+anim material bone
+frame anim bone 0.500000
+1.0 vertex = = 1.0 texture texture anim
+1.0 material 1.0
+-1 = bone texture
+= frame -1 0.500000 bone 0.500000
+frame texture anim vertex
+1.0
+1.0 -1 texture vertex
+-1 vertex vertex -1 0.500000
+= vertex anim texture vertex anim -1
+frame = 0.500000 vertex
+material
+material frame frame material material 0.500000 0.500000 vertex
+material 0.500000 1.0
+vertex bone -1 1.0
+bone 1.0 frame frame frame texture
+texture frame material anim texture
+1.0
+-1
+0.500000 frame
+-1 texture -1 anim
+material -1 1.0 frame
+1.0 0.500000 -1 frame
+=
+0.500000 1.0 texture
+texture vertex bone vertex vertex
+0.500000 1.0 bone =
+anim = -1 bone anim 0.500000
+vertex
+texture =
+bone
+= bone bone frame 0.500000
+frame 0.500000 texture vertex -1
+1.0
+vertex 0.500000 0.500000 0.500000 = 0.500000 vertex frame texture 0.500000
+bone
+texture vertex 0.500000 frame
+= -1 anim texture frame -1 vertex frame anim vertex 1.0 anim anim frame frame 0.500000
+=
+1.0
+anim texture material
+frame bone =
+-1
+frame bone anim
+1.0 = = texture anim frame anim frame
+0.500000 anim
+1.0 vertex bone 0.500000 texture = anim
+material
+0.500000 -1
+0.500000
+-1 anim = texture 0.500000 vertex
+1.0 texture frame bone
+material -1 bone
+= 0.500000 material 1.0 -1 1.0 frame
+vertex vertex bone 0.500000 -1 = texture bone frame 0.500000
+material texture 1.0 anim = 0.500000
+texture = texture 0.500000
+anim texture
+frame vertex 1.0 0.500000 material 1.0
+bone anim vertex 1.0
+= = texture
+= bone texture
+-1
+bone = -1 = frame frame anim -1 = texture texture anim vertex 0.500000 vertex frame
+texture vertex frame material vertex texture = material bone vertex
+= anim
+material anim texture
+frame 0.500000 1.0 bone texture bone 0.500000 -1 = material
+bone
+0.500000 = frame
+0.500000 texture 1.0 frame frame vertex
+0.500000 vertex anim frame -1 -1 -1 vertex 1.0 0.500
\ No newline at end of file
@@ -0,0 +1,123 @@
+0.500000 anim 0.500000 0.500000 -1 0.500000 0.500000 -1 -1
+material bone bone material material 0.500000 = =
+1.0 0.500000 0.500000 material anim -1 1.0 1.0 vertex bone 1.0
+-1 bone
+bone
+-1 = frame 1.0 bone 0.500000 1.0 = -1 texture material texture
+texture frame
+-1
+anim bone frame
+vertex vertex frame texture
+-1
+vertex
+material
+= 0.500000 1.0
+texture anim =
+0.500000
+1.0
+frame -1 1.0 0.500000 material = material
+anim material
+1.0
+material 0.500000
+anim 0.500000 texture 1.0 vertex -1 1.0 frame anim anim 0.500000 0.500000 material
+= 1.0
+anim 1.0 material material frame material texture
+vertex
+vertex frame texture 0.500000 0.500000 -1 bone material frame texture -1
+= = frame material
+anim
+texture
+1.0 vertex 0.500000 vertex anim 0.500000
+anim texture = material -1 frame anim frame
+bone texture frame
+bone frame anim material
+bone =
+=
+texture 0.500000 texture material bone material anim 0.500000 bone 0.500000 = material material 0.500000 texture
+frame bone = = frame
+bone vertex vertex texture vertex =
+anim
+vertex 0.500000
+0.500000 vertex 1.0 -1
+material
+=
+frame 1.0
+-1 -1 1.0 frame
+1.0
+frame material frame 0.500000 frame texture 0.500000 1.0 material
+= vertex
+-1 vertex texture = bone anim
+bone texture texture -1
+bone
+material 1.0 0.500000 texture vertex frame material bone vertex = texture
+material
+anim = anim 0.500000 vertex = vertex
+1.0
+vertex texture bone vertex
+bone -1 = material vertex 1.0 0.500000 texture
+-1 frame
+material -1
+texture texture 1.0 1.0 bone
+1.0 anim 0.500000 =
+bone 0.500000 0.500000 0.500000 anim texture 0.500000
+frame
+0.500000 0.500000 anim anim
+texture vertex texture vertex bone vertex = bone material bone material
+1.0 0.500000 texture vertex vertex =
+-1 -1
+= 0.500000 = -1 =
+anim vertex frame
+vertex anim material 0.500000 texture bone anim
+= -1 vertex bone anim -1
+vertex frame
+0.500000 texture
+0.500000
+1.0
+anim
+bone 0.500000 frame 0.500000 -1 -1
+bone material
+-1 material 1.0
+0.500000
+frame texture vertex frame
+material vertex 0.500000
+bone material material
+1.0 0.500000 frame -1 frame texture texture frame
+-1 bone
+1.0
+material bone
+anim =
+0.500000 anim vertex 1.0
+bone frame -1 anim 1.0 0.500000 texture texture = bone 1.0 0.500000
+material anim
+anim vertex vertex -1 -1 1.0 = = -1 texture
+-1 texture
+= frame 0.500000 material 1.0
+-1 texture -1 frame 0.500000 = 0.500000 texture anim frame
+1.0 material anim
+vertex
+1.0 1.0 vertex -1 bone -1 material texture bone
+anim vertex texture 0.500000 material -1 -1
+-1
+0.500000 0.500000 -1 anim 1.0
+vertex vertex 0.500000
+texture -1 =
+anim frame = -1 material 0.500000 -1 0.500000 1.0 1.0
+= vertex -1
+material frame
+texture frame
+bone
+= texture texture frame
+texture frame
+bone
+0.500000 material frame anim material anim anim anim -1
+= 1.0 -1 material anim 1.0
+anim
+1.0
+anim
+1.0 vertex -1 texture -1 frame
+anim anim bone
+texture
+1.0 vertex 0.500000 frame -1 bone anim vertex anim -1
+vertex 0.500000 bone
+vertex frame bone
+material = material -1 0.500000 vertex 
\ No newline at end of file
@@ -0,0 +1,70 @@
+0.500000 -1 anim vertex material -1 0.500000 vertex
+= vertex vertex frame = anim =
+frame -1 1.0 frame
+anim =
+0.500000 anim bone frame 1.0 bone material anim texture -1 -1 =
+bone
+1.0 0.500000 frame frame anim 1.0 material
+frame = vertex
+bone vertex anim -1 vertex 0.500000
+1.0 1.0 1.0
+frame 0.500000
+bone
+anim 1.0
+= material frame
+frame vertex = 1.0
+frame = 1.0 anim
+1.0 1.0 anim material texture
+vertex frame = material texture 1.0 =
+frame
+vertex frame -1 texture 1.0 anim =
+1.0 frame
+-1 anim
+-1 frame = frame anim
+anim bone
+material texture -1 vertex
+texture vertex
+1.0 material -1 1.0 1.0 0.500000 1.0 frame material texture 1.0 vertex vertex bone
+texture 1.0 material
+vertex texture 1.0 frame
+frame bone 1.0 bone
+0.500000 material
+0.500000 1.0 anim 1.0 frame texture texture = texture -1
+-1 frame = material 0.500000 vertex vertex texture bone frame 0.500000
+bone =
+vertex = =
+anim frame vertex
+anim
+1.0 -1 =
+material texture
+1.0 = 0.500000 vertex
+material texture texture -1 material frame texture -1 texture -1
+vertex -1 texture vertex 1.0 texture frame 0.500000 =
+-1
+texture material
+anim
+0.500000 vertex bone
+anim bone 1.0 vertex texture
+1.0 frame
+texture 1.0
+vertex -1 1.0 texture -1 texture
+1.0 0.500000 bone 0.500000 0.500000 -1 1.0 bone 1.0 frame 1.0 anim vertex
+material texture
+vertex -1 frame
+anim anim -1 = 1.0 1.0 frame = -1 -1
+=
+= -1 -1 bone
+frame bone frame anim = -1 bone 1.0
+= vertex anim vertex 1.0 frame -1 bone vertex 0.500000 frame vertex texture anim frame
+material material
+texture
+-1 texture vertex frame anim 0.500000 -1 vertex
+frame
+anim 0.500000 texture texture
+bone = = -1 texture frame
+anim =
+material texture bone material
+0.500000
+-1
+texture texture 1.0 texture material bone
+bone vertex texture materi
\ No newline at end of file
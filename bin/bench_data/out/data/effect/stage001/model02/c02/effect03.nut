@@ -0,0 +1,122 @@
+anim -1 texture vertex
+texture 0.500000
+frame vertex vertex frame
+anim
+bone
+material
+= texture 0.500000 bone frame anim
+bone anim frame
+-1 = 0.500000 0.500000 bone
+= bone = =
+frame
+material texture -1 vertex
+= vertex
+frame material texture texture
+vertex = bone
+texture 0.500000
+anim
+0.500000 = texture =
+=
+bone 1.0 bone bone anim vertex = -1 0.500000 bone vertex bone -1
+texture
+0.500000
+texture 1.0
+= anim material bone = bone
+vertex
+=
+material = -1 = = anim
+0.500000 1.0 material 1.0 material
+bone bone material bone
+0.500000 = vertex =
+1.0 frame texture
+texture texture vertex texture vertex texture frame
+0.500000 texture vertex 0.500000 vertex = anim material material anim texture vertex
+frame material texture anim
+vertex
+1.0 -1 bone 1.0 frame frame material bone material = material bone = bone = material anim vertex -1 1.0 texture bone =
+= = material 0.500000 vertex = material
+frame material anim texture anim 1.0 -1 texture 1.0 bone = material vertex bone
+-1 texture 0.500000 0.500000
+texture bone
+vertex
+material
+anim bone 0.500000
+-1 1.0 0.500000
+0.500000 1.0
+vertex texture
+1.0
+anim anim
+1.0 texture =
+=
+1.0
+0.500000 anim bone 0.500000 vertex anim
+bone bone
+texture anim -1 bone
+1.0 = bone
+0.500000 = vertex
+=
+frame texture -1 texture vertex anim
+vertex 1.0
+anim
+= texture bone frame material texture
+bone anim material vertex vertex
+1.0 = bone 1.0 vertex 0.500000 bone vertex 1.0 0.500000 = frame
+-1 1.0 texture 1.0 material
+anim material texture frame
+texture anim -1 -1 bone 0.500000 0.500000
+anim anim vertex -1 material vertex frame anim
+anim 1.0 bone = 1.0 frame
+frame = -1 = 1.0 1.0 texture = texture frame
+vertex
+texture anim texture
+bone
+=
+material 1.0 1.0 -1 anim 0.500000 = vertex =
+vertex frame vertex -1 vertex
+-1 =
+texture vertex
+bone anim texture -1 texture texture
+1.0 anim
+texture -1 frame anim anim
+material vertex anim vertex 0.500000 anim
+-1 = texture
+texture frame texture frame
+0.500000 frame -1 anim
+0.500000 1.0 vertex 0.500000 1.0 vertex
+bone 0.500000 1.0 1.0 bone
+bone
+0.500000 bone -1 = = material anim anim material texture frame
+= texture
+anim material
+= vertex material 0.500000 0.500000 bone texture vertex frame texture 1.0 vertex 1.0 0.500000 1.0 material texture -1
+frame bone -1 1.0 texture 0.500000 texture 1.0 -1
+anim bone frame
+texture -1 -1 bone anim frame 0.500000
+frame vertex material 0.500000 -1
+1.0 bone 0.500000 texture frame
+frame
+= frame
+anim bone -1 0.500000
+bone anim
+bone -1 1.0
+= 1.0 -1
+-1 frame -1 -1 0.500000 -1
+-1
+vertex -1
+anim
+vertex 0.500000 1.0
+material 1.0 vertex vertex
+texture -1 -1 vertex 0.500000
+frame
+frame texture
+material
+0.500000 anim bone
+-1
+1.0
+0.500000
+= anim anim bone texture vertex 0.500000 bone frame bone 1.0 texture -1 0.500000
+= texture anim -1
+texture 1.0 = 0.500000 1.0
+anim texture frame frame frame = 0.500000 anim 0.500000 material texture -1
+material
+-1 bone
\ No newline at end of file
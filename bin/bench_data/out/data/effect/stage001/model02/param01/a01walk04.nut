@@ -0,0 +1,46 @@
+0.500000 texture
+1.0 vertex 1.0
+anim 0.500000 1.0 anim bone
+1.0
+anim bone = vertex
+-1 anim 1.0 = vertex bone
+0.500000 -1 = texture -1 anim
+texture 0.500000 vertex texture
+-1
+texture
+-1 texture frame vertex material
+1.0 bone 0.500000 material material
+frame
+1.0 = 1.0 1.0
+texture 1.0 anim -1 bone
+-1 material anim
+-1 anim texture material anim -1
+material
+frame bone
+= 0.500000 bone material 0.500000 anim texture material
+1.0 material
+= frame vertex 0.500000 1.0
+-1 vertex
+material frame vertex 0.500000
+1.0 = anim
+texture material 1.0
+= 0.500000
+bone
+texture vertex material
+material bone
+material
+-1 -1 texture -1 1.0 material -1
+material -1 = anim -1 -1 = = bone = material anim material vertex vertex
+frame 1.0 anim bone -1 bone
+bone material 1.0 bone vertex
+texture texture vertex anim frame frame 1.0
+vertex vertex material texture anim -1 frame vertex 0.500000 =
+vertex =
+-1 -1 = frame
+texture = frame bone
+material texture -1 anim bone texture material -1 vertex 1.0 0.500000
+frame anim
+texture 1.0 texture vertex material bone
+= frame 0.500000
+0.500000 material
+ani
\ No newline at end of file
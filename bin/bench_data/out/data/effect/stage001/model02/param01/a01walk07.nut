@@ -0,0 +1,8 @@
+frame bone material
+= 0.500000 frame bone anim
+material 0.500000 vertex
+= bone 0.500000 frame vertex 0.500000
+vertex
+= texture material frame
+frame
+tex
\ No newline at end of file
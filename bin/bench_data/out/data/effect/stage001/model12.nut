@@ -0,0 +1,201 @@
+texture anim 0.500000 texture
+bone frame vertex -1 0.500000 -1
+= bone -1
+bone material material
+-1 material 0.500000
+bone -1
+=
+vertex -1
+material frame bone bone = = 0.500000 texture 1.0 vertex frame vertex frame material 1.0
+0.500000
+texture texture
+0.500000 frame
+-1
+-1 bone texture anim
+=
+frame frame anim frame -1 0.500000 frame 1.0
+texture 1.0 0.500000 -1
+frame material = vertex
+bone material 1.0 bone bone
+material
+-1 material anim material anim texture 0.500000 -1 = vertex texture 0.500000
+bone 0.500000 = material material vertex anim frame 0.500000 = = vertex 1.0 1.0 frame
+bone
+bone
+anim 0.500000 = anim frame 0.500000 0.500000 1.0 frame texture material material
+texture 0.500000 0.500000 material material vertex anim
+bone 0.500000 =
+1.0 1.0
+0.500000
+frame anim -1 material 0.500000
+1.0 vertex bone texture = anim bone anim = material
+vertex anim
+1.0 anim
+=
+anim =
+bone vertex anim 1.0 0.500000 -1 texture
+frame material
+-1 -1
+0.500000
+0.500000 material
+texture 1.0 material
+frame anim vertex
+-1 1.0
+texture
+material anim vertex bone material -1 texture 1.0 0.500000 bone anim
+= 0.500000 anim = frame material = bone vertex
+0.500000 -1 = frame material material texture anim material anim vertex vertex texture 0.500000 =
+material
+texture
+= vertex frame =
+vertex
+texture
+0.500000 anim texture 0.500000 = 1.0 anim anim bone bone texture texture 0.500000 = 1.0
+0.500000 material -1
+frame material vertex 0.500000 vertex -1 = 1.0 1.0 anim
+0.500000 anim anim = frame frame bone
+0.500000 frame
+anim -1 0.500000 bone anim
+0.500000 1.0 =
+anim 0.500000
+0.500000
+0.500000 anim bone
+-1 bone vertex frame texture 0.500000
+texture bone 0.500000
+anim
+0.500000 0.500000
+= bone
+bone material
+1.0
+material bone = anim 1.0 vertex
+0.500000 vertex
+frame frame bone
+-1 0.500000 1.0
+=
+= 0.500000 texture bone bone bone =
+material anim = 1.0 1.0
+material = 0.500000 texture =
+texture = 0.500000 bone frame texture bone 0.500000 -1 texture -1
+texture
+frame
+texture 0.500000 = = texture anim
+frame 1.0
+frame 0.500000 material vertex 1.0 texture 0.500000 vertex vertex anim 1.0 0.500000 vertex -1
+frame 1.0 =
+0.500000
+= 1.0
+anim texture = material 0.500000 bone
+frame
+= 1.0 material material 1.0
+vertex
+0.500000 anim 0.500000
+= = vertex
+frame
+texture 0.500000 texture bone bone material
+0.500000 vertex bone bone 0.500000
+vertex 1.0 frame bone vertex -1 1.0 anim
+1.0 frame bone
+anim frame =
+0.500000 1.0 -1 -1
+0.500000 1.0
+vertex -1 = frame bone texture 1.0 -1 1.0 vertex material 0.500000 anim material frame = 1.0 vertex anim
+anim anim 0.500000 anim
+vertex
+frame frame 1.0 1.0 1.0
+frame vertex
+anim anim vertex -1 -1 material texture =
+-1 0.500000
+frame
+-1 material texture frame anim
+anim bone 1.0 bone frame anim
+anim =
+bone material
+-1
+frame = 1.0 vertex frame
+0.500000
+texture material texture material
+= material bone
+anim
+anim -1 = frame texture material = texture
+1.0 bone texture texture frame 0.500000
+-1 material = vertex = vertex material 0.500000 0.500000 vertex
+1.0 1.0
+bone = material frame anim vertex frame anim anim -1 vertex 0.500000
+vertex 1.0 1.0 bone 0.500000 = = vertex texture 1.0
+=
+0.500000 anim
+=
+material
+-1 vertex anim
+vertex anim
+material
+anim 0.500000 frame 1.0 0.500000 texture material material 0.500000 bone -1 frame vertex vertex frame material texture
+bone anim 1.0 material
+bone
+= 0.500000 texture -1 texture
+material anim
+frame vertex
+-1
+= -1 =
+0.500000 1.0
+bone
+-1 vertex anim -1 anim -1
+vertex = texture material frame
+1.0
+texture
+anim bone
+0.500000 1.0 anim texture bone 1.0 frame
+bone texture anim
+anim frame -1 vertex bone = 0.500000 =
+anim 0.500000 vertex anim material -1 anim 1.0 texture 1.0
+bone
+frame frame anim material
+0.500000 bone bone
+0.500000 = -1 texture -1
+vertex
+1.0 frame material -1
+1.0 = frame
+anim anim texture 1.0 -1 bone -1 frame vertex texture
+-1
+material
+= texture
+1.0
+frame -1 frame
+1.0 anim material
+1.0 texture vertex
+-1 vertex texture 1.0 frame texture
+anim 1.0 frame =
+vertex bone
+texture texture
+frame anim
+texture
+-1 frame = material texture material frame
+bone 1.0 frame vertex frame 0.500000 = bone texture 0.500000 bone material vertex material
+anim =
+texture material frame
+material material material
+material bone 1.0
+anim = material = texture vertex = = 1.0
+frame 0.500000
+0.500000 anim anim
+=
+frame
+-1 bone =
+1.0 vertex
+frame
+anim 0.500000 bone -1 material
+anim
+anim texture
+bone 0.500000 anim vertex bone =
+vertex vertex
+texture texture
+frame 0.500000 bone =
+frame = texture -1 frame texture -1 frame material =
+vertex -1 -1 texture
+bone anim texture =
+frame 1.0
+material bone -1 1.0 = 0.500000 0.500000
+texture frame frame 0.500000
+-1 -1
+texture anim vertex
+-1 texture texture material 0.500000 0.500000 1.
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim
+anim
+material 1.0 =
+= anim vertex 0.500000 -1 bone material bone texture
+1.0 -1 texture 0.500000 texture 1.0 1.0 0.500000
+= bone -1 vertex material 1.0
+anim
+bone anim anim material 1.0 material 1.0 0.500000 1
\ No newline at end of file
@@ -0,0 +1,20 @@
+material
+material bone =
+1.0
+texture
+vertex vertex anim 0.500000
+-1 frame = vertex texture 1.0 material frame
+anim 0.500000 -1
+0.500000
+-1 0.500000 anim =
+bone 0.500000 -1 = bone
+-1 0.500000 frame bone bone 1.0 anim 1.0 texture vertex
+material anim -1 texture 0.500000 texture
+material 1.0
+=
+anim vertex vertex 0.500000 -1 texture vertex material anim material anim = -1 frame 1.0 frame texture texture -1
+=
+bone =
+= material
+texture =
+0.500000 -1 frame 0.500000 frame -1 vertex = -1 0.500000 material 0
\ No newline at end of file
@@ -0,0 +1,293 @@
+-1 frame frame frame material
+0.500000 = 1.0 1.0
+-1 frame vertex anim anim texture = frame frame vertex
+1.0
+bone = vertex anim texture frame -1 texture bone anim -1 texture material material texture frame
+0.500000 material -1 frame 0.500000 -1 -1 0.500000
+texture material vertex
+= -1 vertex
+= vertex
+anim bone
+-1
+texture
+= 0.500000
+material 1.0 bone
+0.500000 material anim frame -1 anim = 0.500000 bone material
+frame 0.500000 material vertex frame -1 0.500000 material
+= 0.500000 material bone frame
+frame anim 1.0 texture
+= 0.500000 0.500000
+=
+vertex = texture bone
+0.500000 bone bone
+anim 1.0 vertex
+material vertex 1.0 -1 texture material frame vertex vertex material anim material
+-1 anim vertex -1 = frame 0.500000 texture
+texture
+vertex
+1.0
+material -1 1.0 -1 0.500000 texture = vertex frame vertex -1
+frame
+0.500000 frame 1.0 vertex
+= vertex -1 1.0
+texture -1 0.500000 texture = -1 -1
+vertex
+1.0 bone frame 1.0 vertex =
+texture
+vertex material material frame anim = 1.0 texture 0.500000 texture 1.0 1.0
+1.0 material
+-1 material 0.500000
+texture 1.0 0.500000
+-1 -1 material
+1.0
+frame
+vertex frame = texture
+anim bone -1 anim = 0.500000 vertex 0.500000
+0.500000 =
+= material 1.0 0.500000 1.0
+vertex
+bone = texture frame texture bone
+anim anim
+0.500000 anim frame
+vertex material 1.0
+texture 1.0
+-1
+material =
+anim
+anim
+texture
+material
+anim material =
+texture anim
+vertex
+0.500000
+anim 0.500000 frame
+-1
+vertex = -1 1.0
+anim 1.0
+-1
+=
+=
+frame anim vertex frame 0.500000 0.500000 0.500000
+bone anim
+vertex
+texture vertex texture 1.0 1.0 bone 1.0 frame
+vertex frame
+frame material texture anim
+texture texture
+1.0 0.500000 frame
+= frame texture 0.500000
+texture
+= frame frame =
+=
+-1 frame
+bone anim
+material
+frame -1 bone -1
+0.500000
+vertex
+texture 0.500000 bone frame anim = texture vertex
+texture 1.0 bone frame -1 vertex
+1.0 1.0 texture material
+1.0
+vertex material bone texture anim -1 vertex vertex texture = bone
+-1 texture frame bone material frame
+bone 0.500000 anim material material
+material frame
+material material vertex
+1.0
+vertex
+frame anim
+anim bone
+1.0 = -1
+bone -1
+texture 0.500000 frame 0.500000 anim
+vertex frame
+vertex
+vertex anim 0.500000 0.500000 texture bone = =
+-1 =
+bone anim frame
+frame 1.0
+bone -1
+= texture = vertex bone bone material anim
+bone anim
+bone -1
+frame vertex 1.0 vertex
+vertex texture texture bone
+0.500000 anim
+frame texture
+anim anim texture bone -1 vertex texture = material
+=
+anim -1
+1.0 texture vertex 0.500000 -1 texture material = frame vertex vertex
+= texture
+bone bone 0.500000
+0.500000
+texture -1 texture vertex 0.500000 = anim vertex
+-1 0.500000 anim frame
+material = = = material = vertex -1 0.500000 bone
+texture
+vertex frame
+material
+material
+anim
+0.500000 texture
+-1 = frame material
+-1 material anim anim frame anim vertex 0.500000 0.500000 -1 bone bone 1.0
+1.0 =
+anim 0.500000 anim material frame
+material 0.500000 frame texture bone frame frame anim 1.0 1.0 1.0 = 0.500000 vertex = frame bone bone frame 1.0 texture frame
+= 0.500000
+vertex anim frame bone 1.0 0.500000 1.0 texture bone 0.500000 1.0 0.500000 frame anim 0.500000
+vertex material material frame texture frame anim
+frame frame texture
+material 0.500000 frame bone =
+frame -1 0.500000 material
+frame
+bone anim anim = frame frame bone texture frame -1 bone 0.500000 1.0
+1.0 bone -1 frame material bone 0.500000 material 0.500000 -1 frame
+vertex vertex 0.500000 anim = texture
+vertex -1 texture
+0.500000 bone vertex material texture
+anim
+texture
+material
+1.0
+bone 0.500000 vertex
+-1 anim vertex vertex anim vertex vertex
+texture
+texture
+frame 0.500000 bone anim
+0.500000 -1
+vertex bone anim = frame frame bone
+= anim
+bone bone
+frame 1.0
+frame vertex -1 texture
+= = texture
+anim
+-1 1.0 -1
+texture material 0.500000 1.0 bone anim frame frame bone texture anim texture
+0.500000 vertex anim
+anim 1.0 bone frame bone texture = texture -1
+bone 0.500000 texture = texture 1.0
+-1 frame material 0.500000 0.500000 material -1
+material texture anim
+1.0 frame vertex = vertex material 0.500000 bone texture
+-1 texture anim material 0.500000 =
+vertex
+= = 1.0 vertex bone frame
+vertex texture -1 frame
+1.0 material
+0.500000 vertex frame = frame anim -1 1.0 -1 -1 vertex bone -1 frame vertex 1.0 1.0 -1 vertex -1 material bone bone bone 1.0 material bone
+anim
+vertex
+bone vertex 1.0
+-1 material
+frame
+vertex =
+anim bone 0.500000 texture
+bone
+bone bone
+=
+= 0.500000
+= texture texture texture 1.0 1.0 = anim bone 0.500000
+bone
+frame
+frame anim frame 1.0 0.500000
+anim 1.0 -1 0.500000
+material = bone
+anim frame anim
+vertex anim
+bone -1 vertex texture -1 texture material -1 = 1.0 bone frame -1
+material
+-1
+bone = bone frame = frame 0.500000 1.0 anim material frame
+1.0 1.0 = -1 -1 bone
+material vertex bone
+-1 vertex bone frame 0.500000 material
+frame
+-1
+material anim
+material material = texture = -1 -1
+vertex = frame 1.0
+texture 0.500000 anim
+frame -1 bone material
+frame material
+texture = anim vertex material material
+frame frame
+0.500000
+1.0 texture
+0.500000 texture -1
+0.500000 0.500000 vertex = 1.0
+0.500000 -1
+1.0 bone anim = 1.0 bone 0.500000 bone
+0.500000 bone
+frame anim 0.500000 0.500000 frame anim vertex
+vertex vertex anim
+bone
+anim = -1 vertex -1 -1 anim = 0.500000
+= -1 anim 1.0 1.0 bone vertex bone 0.500000 1.0 material
+-1
+texture frame -1 = anim material
+vertex
+anim anim
+frame
+anim frame
+-1 texture bone 1.0 texture frame material -1 vertex anim bone 0.500000
+1.0 1.0
+material -1
+material = material bone -1 vertex = =
+anim
+bone material frame frame vertex vertex material texture frame = texture
+frame material anim material
+0.500000 0.500000 material 0.500000
+frame = anim anim anim bone
+1.0 1.0 0.500000 texture 1.0 = texture 1.0 1.0 1.0
+vertex 0.500000 material
+1.0
+texture -1
+-1 anim
+bone 1.0 1.0 -1 1.0 vertex
+texture texture texture 0.500000
+= bone 0.500000 vertex anim material -1 1.0
+-1
+=
+=
+anim 1.0 -1 frame texture -1
+bone vertex = vertex -1 -1 vertex
+vertex material = texture 0.500000 texture 0.500000 1.0
+= = 1.0 bone anim
+-1 bone
+= texture
+bone
+vertex bone =
+anim frame frame
+frame anim texture
+bone anim anim -1 frame texture
+0.500000 anim 1.0
+-1
+0.500000 1.0 anim 0.500000
+-1 material
+frame -1
+0.500000
+material = bone
+texture texture
+vertex 0.500000 vertex material material -1
+1.0 vertex texture anim vertex texture = vertex vertex
+texture
+vertex vertex 0.500000
+frame texture 0.500000 vertex
+-1
+bone material
+0.500000 1.0 = bone vertex bone
+anim 1.0
+0.500000 0.500000
+1.0 material bone vertex
+texture bone material bone vertex material
+0.500000 0.500000 1.0
+texture = =
+0.500000
+frame 1.0 vertex bone 1.0 0.500000 vertex
+material -1 material 0.500000 anim anim texture -1 vertex
+anim frame 1.0 v
\ No newline at end of file
@@ -0,0 +1,10 @@
+vertex
+material
+-1 vertex = frame vertex texture
+-1 vertex
+bone anim anim material
+0.500000 1.0 frame bone 0.500000 bone bone frame texture texture
+0.500000 0.500000 1.0 material
+material
+material 1.0
+1.0 materi
\ No newline at end of file
@@ -0,0 +1,4 @@
+= = -1
+1.0
+anim material
+vertex 
\ No newline at end of file
@@ -0,0 +1,5 @@
+-1
+anim
+anim =
+= texture bone -1 0.500000 0.500000 frame bone
+-1 = vert
\ No newline at end of file
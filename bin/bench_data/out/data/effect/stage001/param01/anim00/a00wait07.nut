@@ -0,0 +1,145 @@
+anim 1.0 1.0
+anim texture
+anim
+1.0 texture 1.0 material = 0.500000 vertex texture = texture material texture = 0.500000 -1 bone
+1.0
+= bone
+1.0 = = 1.0 frame anim anim bone material -1 bone = 1.0
+frame
+frame vertex anim bone -1
+frame
+= 1.0 frame
+= vertex material = = anim material
+= =
+bone
+-1
+anim -1 1.0 vertex
+material -1 0.500000 0.500000 frame frame
+material material bone material 0.500000 texture material 0.500000 bone bone = texture -1 1.0 frame anim 0.500000
+material
+0.500000
+anim anim texture -1 frame frame anim bone -1 frame
+= 0.500000 vertex vertex
+texture -1 0.500000 bone
+texture anim 0.500000 1.0 frame material
+frame bone
+frame frame 1.0 bone -1 vertex 0.500000
+anim 1.0
+1.0
+0.500000 =
+frame vertex material = 0.500000 =
+frame anim bone 1.0 -1
+material bone bone vertex vertex frame anim 0.500000 texture frame texture
+frame vertex =
+vertex material texture 0.500000 anim 0.500000
+material 1.0
+frame texture anim
+= vertex
+vertex
+bone = vertex 1.0 texture texture material
+-1 = texture
+= 1.0 vertex -1 1.0
+frame frame = material
+vertex
+anim
+bone bone
+0.500000 texture
+material vertex 1.0 1.0
+vertex -1 vertex 1.0 frame
+=
+= vertex frame
+material
+material material = 1.0 bone
+0.500000 anim
+1.0 material 1.0
+0.500000 =
+0.500000 bone frame = vertex 1.0
+vertex
+= texture
+frame = = material = material 0.500000 frame vertex 0.500000 -1 = 0.500000 anim -1
+material frame anim bone anim anim material
+frame material 1.0
+anim material
+-1
+vertex bone
+anim
+-1 -1 vertex vertex 0.500000 1.0 frame bone 1.0 -1 vertex vertex -1 bone 1.0 1.0 -1 texture
+= anim 0.500000
+material
+frame
+=
+vertex
+anim frame
+= frame anim
+=
+texture
+vertex frame
+bone 1.0 texture vertex anim frame
+-1 anim texture anim -1 vertex texture 1.0
+-1 1.0 = anim
+1.0 material frame bone = = material bone anim
+texture = anim -1 bone
+bone 0.500000
+1.0 material vertex = vertex
+vertex =
+1.0 anim
+1.0 anim = texture 1.0 1.0
+vertex bone = = anim frame bone
+bone material
+vertex bone
+-1 texture
+vertex -1 frame
+frame material
+material 1.0 frame
+vertex material
+vertex bone 0.500000 -1 anim 1.0 vertex material
+1.0 0.500000 texture
+-1 vertex 1.0 -1 vertex 0.500000 texture
+vertex
+vertex material vertex 0.500000 bone 0.500000 vertex
+-1 0.500000 anim -1 = = -1 =
+-1 anim material vertex -1 -1 bone texture 1.0 0.500000 bone
+0.500000 0.500000 1.0
+=
+1.0 0.500000 -1 bone
+frame texture 1.0 -1 -1
+1.0 vertex = frame
+= 1.0
+vertex anim
+vertex frame bone
+texture
+vertex 0.500000 material
+material = 0.500000
+vertex = 0.500000
+vertex
+frame
+bone 1.0 frame -1 1.0
+-1
+-1 anim frame -1 frame anim frame -1 frame
+= 1.0
+= texture material
+-1
+texture texture vertex bone
+bone texture -1 bone vertex -1 texture
+texture material
+frame
+vertex vertex -1 bone 0.500000 frame vertex = 0.500000
+= 0.500000 texture
+texture frame
+vertex texture frame
+=
+texture material bone frame texture
+texture material
+= 0.500000 -1 frame material frame bone material texture =
+0.500000 1.0
+vertex
+0.500000 0.500000
+-1 0.500000 anim 1.0 texture
+frame
+vertex frame -1 -1 = 0.500000 material
+vertex = 1.0 frame frame
+anim
+0.500000 frame vertex = -1 vertex frame = 0.500000
+-1
+0.500000 1.0 frame frame anim
+frame anim texture 
\ No newline at end of file
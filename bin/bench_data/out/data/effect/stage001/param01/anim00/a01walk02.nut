@@ -0,0 +1,2 @@
+1.0 frame texture -1 0.500000 = 0.500000
+0.500000 -
\ No newline at end of file
@@ -0,0 +1 @@
+x=!*'2FHYaA
\ No newline at end of file
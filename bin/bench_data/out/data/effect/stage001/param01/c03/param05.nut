@@ -0,0 +1,107 @@
+0.500000 frame bone 0.500000
+material
+texture bone 1.0
+material = frame
+1.0 -1 = vertex
+texture bone -1 bone bone vertex frame vertex
+frame anim bone -1 = 1.0
+material -1 0.500000 -1 anim
+frame
+0.500000 bone
+bone
+vertex 0.500000
+texture
+bone
+bone -1
+frame
+bone bone
+bone texture
+bone frame vertex
+vertex
+frame 0.500000 vertex 0.500000
+texture anim vertex
+frame -1 texture anim
+anim
+bone material = = vertex frame texture bone
+texture 0.500000 0.500000 bone = bone
+0.500000 -1 -1
+= vertex 1.0
+texture material -1 vertex material frame 1.0 vertex frame
+1.0 bone
+0.500000 texture bone frame
+bone frame -1 bone frame texture -1 texture texture = 0.500000 0.500000 -1 =
+texture -1 anim
+vertex vertex
+texture 1.0 texture =
+material 0.500000 0.500000
+-1 bone anim
+anim -1
+bone =
+frame anim = anim material bone
+= =
+-1 vertex texture 1.0
+anim
+1.0 1.0 texture = anim anim = 0.500000 bone 1.0 anim bone -1
+bone bone bone frame material 0.500000
+= anim material texture 1.0 bone frame material
+bone -1 vertex =
+vertex frame 1.0 vertex bone material anim frame anim
+material bone bone
+0.500000
+anim
+vertex frame 0.500000
+1.0 material 0.500000 anim
+= vertex -1 vertex frame texture
+-1 texture frame texture -1 1.0 bone bone texture frame vertex 0.500000
+1.0
+material vertex vertex anim frame
+-1 0.500000 -1 0.500000
+bone
+= texture
+1.0 frame
+bone = 0.500000 frame
+material 1.0
+= texture
+0.500000 frame 1.0 = 0.500000
+vertex
+1.0 = 1.0 = 1.0 = material
+frame = texture
+frame
+1.0 bone vertex = frame = 1.0 frame frame
+frame
+bone -1 vertex texture texture anim
+frame vertex 0.500000 texture 1.0 1.0 -1
+0.500000 frame vertex frame bone bone
+= frame texture material 1.0 texture
+material 0.500000 bone
+1.0
+anim =
+1.0
+=
+= 1.0
+vertex 0.500000 material = vertex
+-1 0.500000 -1 1.0 1.0 1.0 material
+vertex 0.500000 bone = -1 material material anim bone bone -1 = vertex =
+1.0
+vertex =
+material 1.0
+1.0 0.500000 = bone
+0.500000 frame material material anim 1.0 bone vertex frame
+1.0 texture
+0.500000 bone
+-1 bone bone texture
+texture bone
+vertex -1
+texture anim frame frame texture
+frame frame bone
+anim -1
+material
+-1 0.500000 vertex bone anim = vertex
+texture 0.500000 texture texture vertex 0.500000 = frame bone -1 =
+frame 1.0 =
+material anim -1 anim
+anim -1
+1.0 vertex
+= -1
+vertex material frame bone vertex
+1.0 texture bone material 0.500000 bon
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex anim anim texture texture bone bone -1 texture 1.0 = anim -1
+texture anim frame 
\ No newline at end of file
@@ -0,0 +1,76 @@
+anim anim frame material 1.0 vertex
+0.500000
+texture
+-1 material -1 0.500000 1.0
+= anim -1 -1 -1
+texture
+= 1.0 material
+vertex 0.500000 1.0
+vertex
+texture 0.500000
+material bone anim
+0.500000
+vertex 1.0 texture texture
+bone texture -1 anim frame vertex bone texture -1 =
+material -1
+vertex 0.500000 material
+-1 bone texture 1.0 -1 anim 0.500000 vertex
+=
+texture frame bone = material
+frame anim 0.500000 frame
+vertex bone vertex 1.0 texture frame bone material -1 texture
+-1
+1.0 bone = material texture
+-1 texture bone =
+texture frame frame frame anim 0.500000
+anim 0.500000 vertex frame material 0.500000 anim
+anim
+0.500000 bone 0.500000 material texture material anim
+frame -1 texture material anim bone anim 1.0 -1 1.0 1.0 =
+material
+0.500000 material 1.0 texture vertex texture 1.0 vertex texture
+1.0 material
+=
+bone -1
+bone
+= texture
+frame =
+0.500000 1.0 anim vertex anim
+= bone material
+bone -1
+vertex bone -1
+1.0 1.0 anim anim
+texture = anim =
+vertex
+anim 1.0
+-1
+frame vertex texture material = =
+anim = -1
+frame
+bone = texture bone bone -1 0.500000 0.500000 vertex bone
+-1 material
+anim material
+texture anim = -1 texture
+0.500000
+vertex anim material 0.500000 bone frame -1
+texture
+bone vertex 1.0 material 0.500000 material texture frame 1.0 bone
+vertex 0.500000 bone frame texture
+1.0
+= 0.500000 = material frame bone material 1.0 = anim
+0.500000
+1.0 = anim bone -1
+texture bone texture 1.0 0.500000 1.0 -1 -1
+-1 frame
+texture material = vertex material = anim -1 material
+-1
+0.500000
+anim bone 1.0
+texture bone texture vertex texture material
+vertex anim anim -1
+bone -1 0.500000 1.0 material = 1.0 frame texture texture 0.500000 -1 anim frame
+anim = 1.0
+-1 1.0
+1.0 -1 = frame
+-1 1.0 0.500000
+anim b
\ No newline at end of file
@@ -0,0 +1,7 @@
+= material 0.500000 0.500000
+material
+0.500000 vertex =
+-1
+texture = = 1.0 bone
+-1 -1
+-1 a
\ No newline at end of file
@@ -0,0 +1,9 @@
+vertex
+0.500000 1.0 material
+frame bone bone -1 material 1.0 0.500000 texture bone =
+anim
+0.500000 bone 0.500000 -1
+vertex 0.500000 = texture -1 bone frame
+bone frame anim texture 1.0 0.500000 1.0 material
+frame
+0.500000 texture 1.0 texture material
\ No newline at end of file
@@ -0,0 +1,31 @@
+frame anim = material =
+-1 anim
+= vertex 0.500000 frame anim frame material anim -1 =
+-1 bone 1.0 = bone -1
+bone anim
+texture
+anim
+= material 1.0 1.0 vertex -1 texture frame texture
+frame frame vertex 1.0 material vertex 1.0 vertex bone texture 1.0 vertex bone frame
+bone vertex vertex vertex material 1.0 texture
+vertex
+texture
+= -1
+vertex
+anim 1.0 =
+anim = = anim texture bone = material vertex = frame
+1.0 texture anim
+vertex -1 anim
+vertex
+1.0 = frame vertex = frame -1 =
+1.0 = 1.0 bone frame vertex = bone
+frame anim
+bone
+texture
+0.500000 frame =
+frame 1.0
+vertex vertex
+-1 texture texture bone 0.500000 texture material texture vertex anim
+frame material
+-1 1.0
+material = anim ma
\ No newline at end of file
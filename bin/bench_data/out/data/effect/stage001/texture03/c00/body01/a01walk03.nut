@@ -0,0 +1,22 @@
+vertex 0.500000 0.500000 = bone -1 1.0 bone 1.0 material frame
+frame anim anim anim vertex = texture anim
+bone -1
+0.500000 -1
+texture =
+-1 1.0 bone material material frame bone material
+-1 texture 1.0 bone
+= anim vertex = vertex 1.0 1.0 = -1 vertex
+texture texture
+=
+anim
+material -1 vertex = vertex =
+anim
+= frame material
+0.500000 anim =
+frame 1.0
+0.500000 bone 1.0 1.0 1.0 bone vertex
+anim
+texture
+0.500000 -1 -1 bone -1 material
+anim texture = texture 0.500000 vertex 1.0 0.500000 texture
+material 
\ No newline at end of file
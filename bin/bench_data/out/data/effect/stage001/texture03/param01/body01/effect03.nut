@@ -0,0 +1,307 @@
+-1 anim bone texture =
+material bone texture anim
+texture frame 1.0 bone = bone anim = frame texture vertex anim anim =
+frame
+=
+vertex texture vertex -1 anim frame frame
+texture 0.500000 1.0
+= material anim
+material
+= -1 texture 0.500000 = bone
+frame
+1.0 bone
+frame
+anim
+anim anim
+= frame bone
+anim frame -1 frame = 0.500000 anim
+-1 1.0 vertex -1 0.500000 frame material -1 material material
+1.0 vertex
+bone texture bone vertex texture anim 1.0 0.500000 0.500000 anim material vertex material
+1.0 vertex anim
+0.500000
+0.500000 = 1.0 0.500000 vertex material 1.0
+bone
+=
+= bone
+anim
+material 1.0
+vertex frame material 1.0
+-1 -1 -1 vertex vertex bone = bone
+texture
+texture 1.0 bone texture frame
+anim
+frame bone 0.500000 =
+material 0.500000 material frame -1
+anim = frame bone
+0.500000 -1 -1 vertex
+bone texture
+bone
+material bone anim material
+0.500000 1.0 -1 texture
+= frame
+0.500000
+bone anim 1.0 0.500000 texture bone
+anim 1.0
+1.0 frame 1.0 -1
+material material texture vertex =
+frame bone vertex bone vertex material frame texture 0.500000 material 1.0 1.0 vertex texture anim anim = 0.500000 =
+bone
+frame bone anim vertex bone =
+texture = anim anim 1.0
+0.500000 -1 bone = vertex
+vertex = material anim
+bone anim
+= bone texture
+0.500000 1.0 material material
+vertex 0.500000 0.500000
+texture frame 1.0 1.0
+anim bone texture frame frame 1.0 -1 bone frame vertex frame
+material texture = 1.0
+frame
+vertex material material = material frame
+-1 bone texture 1.0 anim anim material
+texture
+anim texture vertex
+1.0 vertex = 1.0 = = anim material -1
+bone = material
+1.0
+bone 1.0 texture =
+1.0
+vertex frame vertex
+1.0 material
+material
+frame = -1 frame 0.500000 material 0.500000 vertex frame vertex texture 1.0 1.0 0.500000 -1
+= anim 1.0
+frame 0.500000
+texture frame 0.500000 = 1.0 material anim
+1.0
+= frame -1
+texture 1.0 frame material vertex texture
+vertex = 0.500000 material bone vertex texture texture -1
+vertex anim texture bone
+frame = 1.0 0.500000 texture -1 frame =
+anim
+texture 0.500000
+anim vertex material
+frame
+1.0
+0.500000 frame vertex 0.500000 0.500000 material = frame texture
+-1 anim texture
+material = anim -1 frame -1 texture 0.500000 bone =
+1.0 0.500000
+anim vertex -1
+frame
+-1 bone 1.0 -1 1.0 1.0
+= 1.0
+-1 = bone bone frame vertex 1.0 bone frame bone -1 material material 1.0 anim anim anim material bone =
+bone
+-1 -1
+material bone
+0.500000 bone bone
+bone vertex anim bone
+0.500000 = frame vertex 0.500000 -1 -1 0.500000 bone vertex vertex
+= vertex vertex bone -1 material 0.500000
+frame material bone 1.0 1.0 =
+vertex
+material 0.500000
+bone
+= frame bone =
+0.500000
+1.0 frame 0.500000 0.500000 material
+bone material texture bone
+anim vertex material 1.0
+0.500000 vertex anim anim
+vertex
+anim bone material
+material
+vertex texture texture -1 material =
+vertex -1 texture
+anim anim material 1.0 material vertex frame 1.0 -1 frame = texture vertex vertex anim material -1 material
+texture 0.500000 bone frame bone 0.500000
+-1 anim bone 1.0 texture
+0.500000 bone
+1.0 -1 0.500000 material 1.0
+material anim bone material = frame texture bone texture -1
+anim 0.500000 vertex -1 0.500000 material texture
+texture
+bone
+0.500000
+vertex = -1 0.500000 1.0
+= vertex
+0.500000 = material = 1.0
+texture
+vertex 0.500000 texture material 1.0 1.0 anim material
+anim anim frame
+1.0
+anim 0.500000 1.0 -1 1.0 -1 0.500000
+vertex
+1.0
+frame
+anim
+1.0 = -1 0.500000 = texture material texture material = material 1.0 frame 1.0 0.500000 frame frame
+frame anim bone vertex
+1.0 material = anim
+= bone
+texture material 1.0
+anim 0.500000 0.500000 vertex = frame 0.500000 anim =
+texture
+vertex -1 = anim
+-1 vertex material anim frame
+material
+= 1.0 frame 1.0 anim 0.500000
+0.500000
+1.0 bone texture
+material 0.500000 0.500000 0.500000
+material
+0.500000 texture -1 frame texture 1.0 vertex 0.500000 0.500000
+frame 1.0
+= -1 = -1 = material 1.0 =
+bone
+texture vertex material bone anim = 1.0 1.0 0.500000 1.0 material vertex material = = vertex frame material
+vertex material frame -1 -1 = -1
+material 1.0
+1.0 bone -1
+vertex anim vertex texture texture bone material anim bone anim
+vertex 1.0 frame frame
+anim
+material vertex =
+anim texture bone
+texture bone material 0.500000 vertex
+texture = 0.500000
+= bone
+vertex anim = =
+anim -1 1.0 vertex
+material
+material material frame bone
+texture 1.0
+0.500000 material -1 vertex
+vertex texture frame
+vertex material = bone vertex
+texture frame frame
+1.0
+-1 texture anim material texture
+0.500000
+material 1.0 1.0 -1 = bone = material
+vertex texture = texture -1 material =
+0.500000 = =
+frame material = anim
+material
+texture anim
+= bone frame
+1.0 = material 1.0 material
+vertex -1 bone 0.500000 vertex
+0.500000
+anim bone material -1 -1 anim
+= 1.0 bone material
+= 0.500000
+material anim
+vertex bone frame
+bone vertex
+frame bone material
+1.0
+= frame
+0.500000
+-1 bone = frame vertex texture texture material
+-1 frame anim =
+material
+texture 1.0 -1 material
+0.500000
+0.500000
+frame
+anim
+bone
+-1 vertex bone = material anim 0.500000 material anim anim bone 0.500000
+texture anim 1.0 anim material -1 0.500000 0.500000 0.500000 texture -1 material
+vertex frame =
+1.0
+vertex material material vertex -1 texture
+texture 1.0 anim
+anim -1
+0.500000 -1 vertex
+anim
+=
+material = vertex anim bone vertex vertex
+frame
+texture texture vertex = = 1.0 0.500000 bone = texture frame frame anim = bone
+bone vertex -1 anim -1 texture
+bone
+frame 1.0
+texture 1.0 material 0.500000 frame material anim =
+vertex vertex
+material = = vertex frame -1 0.500000 vertex
+texture
+bone bone
+0.500000 frame -1
+texture frame anim texture anim 1.0 -1 bone =
+anim
+frame bone texture frame material 1.0
+bone vertex bone 0.500000 anim vertex
+bone
+-1 = material
+0.500000 anim -1 = bone texture vertex
+anim frame
+-1 vertex frame bone bone
+vertex texture
+0.500000 material
+0.500000 texture 1.0 vertex
+vertex
+= bone material anim bone -1 vertex 1.0 0.500000 = vertex
+= vertex 0.500000
+frame texture = 1.0
+-1 0.500000
+-1 vertex 1.0
+= = 0.500000
+material texture
+0.500000 0.500000
+1.0
+bone = vertex vertex = material frame -1 -1
+frame 1.0 anim vertex frame -1 -1 0.500000 vertex
+0.500000 -1 bone material -1
+bone material frame
+frame
+1.0 = material
+material vertex frame frame
+anim -1 frame = bone anim = -1 bone
+bone frame
+material
+material = frame frame frame material = =
+material
+= material material
+bone
+texture 1.0 frame 0.500000
+bone anim 1.0 vertex anim =
+= -1 bone 0.500000 bone bone frame frame material = -1
+1.0 texture
+vertex -1 0.500000 bone bone
+material bone anim 0.500000 bone bone
+0.500000
+1.0 texture texture
+vertex vertex 1.0 -1 texture
+material texture bone bone material material bone vertex texture frame 1.0 = -1 -1
+bone texture texture
+vertex
+= 0.500000
+material = = texture vertex = 1.0 bone 0.500000 1.0 0.500000 -1 anim 1.0 1.0 bone vertex 1.0
+0.500000 -1 anim frame -1 frame = 0.500000
+= = 1.0
+= vertex = = 1.0 material = bone vertex anim
+bone = =
+texture 1.0 anim 1.0 =
+vertex
+=
+= bone 1.0 vertex -1
+bone vertex
+bone 0.500000 -1 anim
+= anim
+texture bone material 1.0 0.500000 bone -1 texture frame = bone
+-1 1.0 = texture anim -1 bone texture
+1.0 texture bone 0.500000 bone material texture vertex bone -1 0.500000 vertex texture
+=
+bone 1.0 material 0.500000
+bone 0.500000 texture frame
+0.500000 bone texture -1
+texture frame bone anim material texture
+texture -1 -1 0.500000 material anim anim 0.500000 bone -1 -1 vertex material -1 anim anim
+-1
+f
\ No newline at end of file
@@ -0,0 +1,72 @@
+texture material bone =
+0.500000
+1.0 =
+-1
+bone 0.500000 bone
+anim frame anim anim
+texture anim 1.0
+frame bone vertex texture vertex material anim frame = frame anim
+-1 texture frame -1 -1 0.500000
+bone material texture bone -1
+-1 0.500000 material = 0.500000 material material texture
+material
+1.0
+= texture =
+0.500000 anim
+texture material texture vertex
+texture
+vertex
+0.500000 = anim -1
+texture bone
+vertex 1.0
+bone =
+frame material
+bone
+0.500000 anim -1 frame =
+frame
+material -1 vertex vertex material bone = 1.0
+material material anim vertex -1
+anim
+bone
+1.0 bone = 0.500000 = bone
+anim 1.0 frame
+-1 =
+bone 1.0 texture frame anim 1.0
+1.0 1.0 frame texture texture 1.0 -1 frame frame 1.0
+0.500000
+anim
+material 1.0 frame material material -1 texture texture
+frame
+1.0 texture anim material 1.0 -1 bone bone
+material vertex 0.500000 -1 anim
+anim vertex
+frame -1 -1 material anim 0.500000 = vertex -1 bone
+bone 1.0
+0.500000 frame anim
+material
+material 0.500000 frame anim
+anim texture = =
+vertex
+bone -1 frame anim -1 vertex
+= texture 1.0 anim
+= anim 0.500000
+texture
+bone 1.0 -1 frame
+anim 0.500000 0.500000 material -1 bone
+-1 anim bone
+0.500000 bone
+0.500000 anim material texture vertex = bone 0.500000
+=
+-1 bone texture
+texture
+0.500000 anim = material vertex 1.0 anim 0.500000 texture
+= material -1 material frame
+frame vertex -1 frame
+0.500000 vertex material texture texture
+=
+frame bone material 1.0 1.0
+anim
+0.500000 0.500000 frame frame = vertex bone
+= vertex
+anim frame
+material b
\ No newline at end of file
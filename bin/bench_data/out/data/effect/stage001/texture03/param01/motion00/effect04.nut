@@ -0,0 +1,134 @@
+bone -1
+1.0 texture 0.500000 vertex bone = = vertex 0.500000 =
+vertex texture 0.500000 = bone -1 -1 vertex
+bone 1.0 frame anim
+0.500000 0.500000 1.0
+texture material 1.0 frame 0.500000 bone
+0.500000 anim
+vertex texture anim
+anim material 0.500000 -1 1.0 1.0 anim 0.500000
+texture
+vertex -1
+bone -1 frame
+-1 bone
+bone -1
+material vertex material material 1.0 0.500000
+bone bone texture 0.500000
+frame texture material -1
+1.0 anim bone
+= material
+texture 0.500000
+0.500000 vertex =
+0.500000 0.500000 -1
+-1 anim 0.500000 -1 texture bone anim = bone
+vertex texture texture material 1.0 bone vertex vertex -1 frame anim texture
+texture texture material
+1.0 1.0 texture -1 1.0 bone
+0.500000
+bone 1.0 -1 bone bone -1 texture
+frame 1.0
+0.500000 texture = anim 0.500000 0.500000 vertex texture
+frame = = anim = frame frame
+1.0
+frame material
+-1 anim -1 1.0 anim
+frame bone material 0.500000 = material bone
+=
+vertex = texture
+anim material frame
+anim 1.0 vertex texture
+frame
+anim
+anim
+1.0 texture bone 0.500000
+-1 0.500000 1.0
+anim vertex texture anim bone
+anim -1
+0.500000 -1 bone 1.0 bone -1 1.0 bone material material =
+= = bone vertex bone 1.0 0.500000 = anim -1 =
+texture 0.500000 = 0.500000 material 1.0 material
+0.500000
+bone material = material
+vertex
+=
+1.0 texture 1.0 0.500000 texture 1.0 1.0
+0.500000 vertex 1.0 frame material anim bone =
+=
+vertex
+1.0 0.500000 material texture
+-1 frame -1 = =
+-1 material
+0.500000 anim -1
+bone vertex vertex vertex 0.500000
+= anim material 1.0
+=
+bone vertex anim 0.500000 anim 0.500000 anim vertex 0.500000 -1 bone = vertex -1
+=
+vertex frame = 1.0 0.500000 vertex 0.500000 0.500000
+-1
+material bone vertex texture 0.500000
+=
+texture 0.500000 vertex 1.0 vertex bone material =
+anim 0.500000 -1 1.0 bone 1.0 vertex
+material
+texture material -1 vertex material 0.500000 material texture 0.500000 -1 1.0 frame bone 1.0 anim material anim material 0.500000 texture 1.0 =
+0.500000 0.500000 0.500000 vertex
+-1 -1 = texture texture
+frame texture -1
+anim 0.500000 vertex
+vertex bone texture
+anim frame 0.500000 1.0
+bone
+vertex frame 0.500000 material 1.0 anim frame anim 0.500000 0.500000 bone
+1.0
+=
+vertex 0.500000 = = =
+-1 anim frame = material 1.0 vertex material bone = material
+bone
+vertex vertex
+anim texture frame material -1 texture
+bone 0.500000 = texture
+vertex
+= texture anim = bone -1 frame frame 0.500000 frame
+vertex bone
+bone
+vertex
+vertex = texture -1 anim
+texture material vertex texture bone texture 0.500000 -1
+anim material anim bone
+bone
+bone = vertex
+bone anim texture 0.500000 0.500000
+anim material 1.0
+0.500000
+anim anim
+material 1.0 -1 -1 material vertex 0.500000 vertex = bone
+bone texture
+texture 0.500000 anim 1.0 = vertex
+0.500000
+material bone anim
+-1 bone material anim -1 anim vertex texture
+-1
+-1 1.0
+material vertex 0.500000 -1
+1.0 anim -1 -1 bone 1.0 vertex -1 1.0 0.500000 =
+texture frame
+anim frame vertex texture 1.0
+0.500000
+0.500000 material = vertex =
+frame bone 0.500000 anim 0.500000 -1
+frame 0.500000
+1.0 frame
+frame texture
+=
+frame anim
+frame frame 0.500000
+material anim bone 0.500000 anim bone = 0.500000 1.0 anim = anim
+anim
+0.500000 1.0 material bone anim
+texture
+anim
+material bone anim -1
+1.0 0.500000 bone 0.500000 1.0 vertex 0.500000 frame frame anim
+anim vertex bone anim vertex frame material material anim = anim -1 vertex
+bone text
\ No newline at end of file
@@ -0,0 +1,12 @@
+= 0.500000 material texture bone 0.500000 texture -1 anim -1 -1 1.0 anim frame -1 vertex = 0.500000
+texture = 0.500000 anim -1 0.500000 0.500000 anim 1.0 material vertex
+texture texture =
+frame material
+material material vertex texture bone
+bone
+texture 1.0 0.500000 anim vertex anim texture 1.0
+frame 0.500000
+bone texture =
+= 0.500000
+-1 0.500000 material
+fr
\ No newline at end of file
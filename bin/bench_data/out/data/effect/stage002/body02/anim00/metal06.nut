@@ -0,0 +1,2 @@
+1.0 frame
+material anim 1.0 anim material bo
\ No newline at end of file
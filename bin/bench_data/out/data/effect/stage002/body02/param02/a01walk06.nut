@@ -0,0 +1,185 @@
+1.0 texture frame material 0.500000
+vertex -1 1.0 bone
+0.500000 = frame material 0.500000 0.500000
+bone
+frame = bone vertex
+1.0 -1 bone = anim = 1.0 1.0 vertex frame
+texture
+bone 1.0 -1 -1 vertex -1 frame bone 1.0 0.500000 texture
+anim
+frame frame texture 1.0 -1 1.0 frame -1 frame vertex 1.0 frame bone bone material material frame -1 anim material bone
+1.0
+texture
+1.0 material bone = -1 anim bone
+frame
+texture texture
+anim anim 1.0 frame frame -1
+texture vertex
+0.500000
+1.0
+anim
+1.0 -1 =
+material material
+texture
+1.0
+bone frame texture bone texture
+-1 = 1.0 texture 0.500000 0.500000
+bone
+0.500000 anim 0.500000 0.500000
+-1 0.500000 material vertex frame 1.0 bone texture material material -1 vertex vertex vertex
+-1 texture
+0.500000
+0.500000 frame material 0.500000 0.500000 = frame material material 1.0 -1 material 1.0 bone anim
+material frame
+-1
+vertex anim anim material 0.500000 anim
+-1 vertex 0.500000 -1 frame = -1 texture texture texture 1.0
+0.500000 texture
+1.0
+= frame = vertex
+material =
+-1 = 1.0 -1 0.500000
+= 1.0 material -1 anim = bone -1 0.500000 =
+material bone vertex 0.500000 bone
+frame vertex bone vertex bone =
+frame anim
+texture 1.0
+1.0 material bone vertex = frame -1 material -1 = material =
+-1 bone bone 0.500000 material -1 frame
+texture
+bone 1.0 1.0 0.500000 frame vertex
+bone
+bone material 1.0 = texture 0.500000 vertex 1.0 material anim texture 1.0 texture vertex bone
+material
+bone
+-1 -1 -1
+0.500000 texture
+1.0 anim anim material frame bone
+frame
+vertex -1
+anim anim anim 0.500000
+texture anim bone anim material frame
+-1 -1
+bone -1 frame texture
+texture = anim 1.0 frame material frame
+0.500000 -1 frame texture = vertex
+anim
+texture 0.500000 -1 1.0 bone
+anim
+anim -1
+frame 0.500000 1.0
+texture frame material frame
+= -1 anim texture frame = = -1 texture 1.0
+-1 bone
+0.500000 1.0 frame -1 material bone 1.0 1.0 1.0 = 0.500000 anim bone anim anim
+vertex bone texture material -1 vertex vertex -1 texture 0.500000 1.0 -1
+0.500000 =
+material anim texture = texture 0.500000 vertex texture bone frame 1.0 0.500000 = frame material 0.500000
+bone material 0.500000 anim 1.0 0.500000
+anim 1.0
+= anim bone =
+frame
+0.500000
+anim anim anim frame
+-1
+frame anim frame -1 =
+0.500000 1.0 anim 0.500000 vertex 0.500000 1.0 anim = 0.500000 vertex vertex anim
+frame
+anim material vertex
+bone
+material
+texture texture material
+frame
+1.0
+bone -1 0.500000 -1 -1
+1.0 anim
+anim
+frame = anim 1.0 bone frame 0.500000
+anim
+material texture 1.0 = material
+-1
+0.500000 anim anim material anim bone bone 1.0 material 0.500000 -1 texture
+0.500000 bone
+bone = =
+frame -1 material 1.0
+anim anim 1.0 texture 1.0 bone = material texture material
+frame
+texture 1.0 bone texture
+-1 1.0 -1 -1
+texture anim
+anim frame 0.500000 0.500000 frame vertex vertex texture =
+vertex texture
+texture 0.500000 = material
+texture
+vertex bone
+frame 1.0
+frame 1.0 vertex
+texture
+anim texture frame
+1.0 texture
+vertex vertex
+bone material
+bone bone 1.0 = 1.0 -1
+=
+0.500000 0.500000 frame
+texture
+-1 bone
+anim = -1
+texture texture 0.500000
+bone anim 1.0 0.500000 -1 bone material texture bone vertex texture vertex 1.0 1.0 texture =
+anim = anim
+frame frame anim bone bone bone material material
+anim vertex 1.0 0.500000 -1 material
+= frame texture
+bone = vertex vertex bone material = 0.500000 material = -1 material texture
+1.0 bone = -1 bone texture
+material anim anim -1 1.0 material bone anim vertex
+frame
+bone
+texture
+anim -1
+texture anim
+bone
+=
+0.500000 anim = =
+material bone 0.500000 anim = 0.500000
+-1
+=
+0.500000
+1.0 vertex vertex frame frame 0.500000 frame anim anim material anim material
+bone material
+0.500000
+frame 1.0 vertex
+anim frame bone 1.0 -1 1.0 anim vertex
+1.0
+= material frame texture = texture material
+texture vertex 1.0 -1
+material -1 1.0
+0.500000
+-1
+anim texture 0.500000 anim = 1.0 texture bone material bone
+1.0 frame texture vertex vertex bone
+= 0.500000 frame frame bone material texture frame = frame vertex
+vertex
+texture frame frame 0.500000 anim bone
+frame texture material
+1.0 texture texture = vertex frame frame frame = bone vertex material material anim texture
+bone
+0.500000 = frame 1.0 =
+1.0 frame -1 vertex
+1.0
+frame bone material 0.500000
+material frame 1.0 1.0 bone anim anim -1 bone = = -1 texture bone frame frame = anim 0.500000 anim
+texture
+vertex bone -1 -1 frame anim
+= bone bone = bone = material = frame bone
+texture texture -1 1.0 frame anim
+anim
+1.0 bone
+anim frame bone texture material -1 =
+frame anim bone vertex texture 1.0 vertex -1 bone 0.500000 frame texture 0.500000 material
+= -1
+frame vertex vertex 0.500000
+anim anim anim
+texture material
+verte
\ No newline at end of file
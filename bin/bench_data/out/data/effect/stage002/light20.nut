@@ -0,0 +1,28 @@
+-1 texture
+frame bone -1 = material -1 material vertex texture bone 0.500000 0.500000 1.0 0.500000
+texture vertex 0.500000 texture frame material 0.500000 vertex bone material frame
+bone
+vertex material
+vertex texture anim
+-1 texture 0.500000
+1.0 texture texture
+material
+texture material
+texture 1.0 frame bone vertex frame
+bone material -1 material bone 0.500000
+1.0
+anim = texture bone
+bone frame
+frame
+-1 vertex
+vertex
+bone 1.0 texture vertex bone
+texture vertex
+vertex 1.0 1.0 anim bone vertex 1.0 -1 material texture 0.500000 = frame
+frame
+0.500000 1.0
+0.500000
+material material 0.500000 material
+= = material 1.0 texture
+anim = 0.500000 bone 1.0 material
+material bon
\ No newline at end of file
@@ -0,0 +1,5 @@
+vertex 1.0
+frame
+texture -1 1.0
+-1 frame
+material 0.50000
\ No newline at end of file
@@ -0,0 +1,31 @@
+texture =
+bone
+1.0 bone anim vertex -1 anim 1.0 1.0 material 1.0 frame
+frame frame frame anim vertex 1.0 frame bone frame material -1
+frame -1 material material bone 0.500000 1.0
+anim -1 texture = 0.500000
+frame
+vertex
+bone material material
+-1 -1 vertex material
+=
+bone
+frame 1.0 frame bone
+0.500000 0.500000 = -1 bone 1.0 material frame
+vertex
+material
+material
+texture -1 bone texture frame 0.500000 texture
+1.0 bone bone
+texture 0.500000 1.0
+bone material
+anim -1
+anim
+= 1.0 -1 frame
+0.500000 anim material anim vertex texture vertex -1 frame material frame anim texture
+0.500000 material -1 anim = bone
+=
+bone anim vertex 0.500000
+material =
+0.500000 texture
+anim 0.500000 bone material te
\ No newline at end of file
@@ -0,0 +1,6 @@
+material
+-1
+bone bone texture 1.0 texture
+= -1
+= bone texture bone =
+0.500000 1.0 1.0 material 
\ No newline at end of file
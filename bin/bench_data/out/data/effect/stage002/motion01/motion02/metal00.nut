@@ -0,0 +1,24 @@
+0.500000 material anim
+vertex =
+frame frame material vertex
+material material anim 0.500000 = -1 = = = 0.500000
+1.0 anim bone
+anim frame
+0.500000 material 0.500000
+bone vertex anim 1.0 texture vertex frame -1 frame vertex material
+texture
+material -1 0.500000 = vertex = bone 1.0 frame material texture
+material bone vertex -1 bone 0.500000 bone frame frame
+material bone vertex =
+-1 texture 0.500000 frame vertex vertex bone
+texture
+1.0
+1.0
+-1 bone -1
+= 0.500000
+frame
+vertex 1.0 vertex = 1.0
+-1 anim texture
+material frame bone bone material = material vertex
+material -1 0.500000 -1 texture vertex texture
+anim anim 1.0 anim vertex mat
\ No newline at end of file
@@ -0,0 +1,2 @@
+texture frame material
+= 0.500000 material 0.500000 0.
\ No newline at end of file
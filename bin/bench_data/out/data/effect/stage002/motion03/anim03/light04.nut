@@ -0,0 +1,132 @@
+texture
+anim texture 1.0
+-1 frame texture
+texture 0.500000 -1
+= -1 1.0 vertex
+-1 anim
+0.500000 1.0 texture vertex = anim -1 vertex bone texture texture
+-1 frame 0.500000 0.500000 0.500000 1.0
+-1 texture
+vertex texture frame bone material anim 1.0
+frame
+= = -1
+material bone -1 bone 1.0 bone
+vertex bone 1.0 bone =
+material 0.500000
+bone anim frame
+= 1.0 = texture =
+texture 0.500000 texture
+=
+texture vertex = bone -1 1.0 = -1 bone
+1.0
+frame anim -1 material = texture anim frame 0.500000 = = anim
+frame vertex 0.500000 -1 -1
+vertex = = frame anim frame frame -1 frame material -1 material 1.0 texture
+frame
+vertex
+1.0 -1 frame vertex vertex
+=
+frame
+0.500000 frame bone 0.500000 frame 0.500000 texture texture
+vertex
+bone
+-1 vertex
+0.500000 bone
+texture 0.500000
+material texture -1
+anim 1.0 bone bone
+0.500000 bone
+material anim texture -1 0.500000 1.0
+frame bone = vertex
+bone
+-1
+-1 vertex 0.500000
+frame
+bone texture frame 1.0 -1
+anim 0.500000
+frame -1
+anim
+frame = texture = material vertex frame
+bone frame material
+bone texture
+1.0 material 1.0 anim
+0.500000 = = anim = frame = anim
+-1 anim
+frame
+0.500000 0.500000
+1.0 anim = -1
+1.0 0.500000
+frame
+-1
+1.0 -1 = 0.500000
+frame texture vertex
+= bone vertex
+texture
+material -1 1.0 material
+frame
+texture = anim -1 texture bone
+= 0.500000 -1
+vertex
+vertex texture vertex material vertex vertex texture anim anim bone anim =
+1.0
+0.500000 -1 -1 1.0 0.500000
+0.500000 texture
+material
+= 0.500000 -1 -1
+anim
+1.0 frame bone
+frame
+bone texture 1.0 -1
+1.0
+frame -1 -1
+anim 1.0
+bone bone bone frame frame anim
+frame 0.500000
+anim
+texture vertex
+texture 1.0 anim = -1
+0.500000
+frame
+vertex
+1.0
+-1 =
+0.500000 texture texture material frame -1 frame -1
+0.500000 texture frame anim
+texture anim -1
+=
+texture
+bone
+frame = vertex
+1.0
+frame material
+vertex texture anim
+=
+0.500000
+texture
+= -1
+texture bone
+anim vertex material
+texture bone bone
+anim texture vertex anim frame material frame 0.500000 material 1.0 vertex
+vertex frame 1.0 material material
+0.500000 vertex
+material
+frame
+vertex anim 0.500000 texture -1
+material texture
+= anim
+anim -1 = 1.0 -1 vertex bone material anim bone
+-1 texture vertex vertex bone bone
+frame frame texture anim -1 -1
+0.500000 -1
+-1 texture -1 material texture
+anim 1.0 anim
+-1 anim 0.500000
+frame -1 texture -1 texture anim 0.500000 0.500000 frame
+frame
+bone 1.0 frame -1
+bone
+-1 -1
+vertex 1.0 anim material material = = 0.500000
+frame 0.500000 texture -1 frame -1 =
+1.0 = texture 0.500000 m
\ No newline at end of file
@@ -0,0 +1,10 @@
+material 1.0
+1.0 vertex
+=
+=
+-1 material -1 texture material vertex
+= anim material -1 frame texture 1.0
+0.500000
+= frame -1 0.500000 bone 1.0 = anim
+material anim = 0.500000 0.500000
+0.500000 -1 -1 bone ve
\ No newline at end of file
@@ -0,0 +1,260 @@
+anim bone bone =
+material anim texture -1 -1 frame = material
+-1 1.0
+frame 0.500000 frame texture -1
+= 1.0 anim
+material bone anim
+-1 bone
+bone texture =
+= -1 -1
+anim bone bone 0.500000 bone
+vertex
+anim = =
+-1
+material -1 anim 1.0 1.0 -1 anim = -1 vertex 1.0
+=
+texture
+0.500000 = = vertex 0.500000 bone
+0.500000 bone anim
+texture bone vertex
+0.500000 material vertex texture
+frame anim anim bone
+texture
+0.500000
+bone material texture bone frame vertex -1 anim
+-1 material -1
+1.0 frame texture 0.500000 1.0 1.0 material -1 vertex
+0.500000
+texture
+vertex anim
+texture -1 bone 0.500000 bone
+1.0
+texture 1.0
+anim anim = vertex anim 0.500000 frame anim anim texture
+= anim vertex texture texture material
+vertex -1 vertex vertex
+-1
+anim frame texture 1.0 -1 -1 1.0 texture -1 bone 0.500000 material
+vertex
+-1 = material = -1 anim
+vertex = frame vertex =
+anim frame
+= 1.0 0.500000 -1 = 1.0 = 1.0
+texture -1 bone
+0.500000 bone 1.0 material
+frame vertex frame -1 frame
+texture material 0.500000 -1 texture
+material anim 0.500000 = 0.500000 vertex bone
+1.0 frame
+=
+bone -1 texture -1
+anim
+material material anim material texture 0.500000 vertex vertex 0.500000 material anim 0.500000 0.500000
+-1
+1.0 frame frame material material
+-1 =
+vertex material -1 =
+texture -1 bone texture
+-1 -1 0.500000 0.500000
+= vertex bone frame = frame frame anim 0.500000 anim -1 anim -1 material
+= vertex bone material -1 0.500000
+0.500000 frame frame texture
+texture =
+texture
+= texture =
+anim bone
+= bone bone = anim -1 -1 1.0
+anim texture anim
+-1 frame vertex vertex
+=
+= texture vertex = =
+1.0 -1
+1.0 1.0 anim vertex
+bone frame 1.0 texture anim material
+material vertex
+0.500000 frame
+= -1
+1.0 -1 frame 0.500000 vertex vertex 0.500000 -1 -1
+vertex
+frame
+bone
+anim material texture -1 frame vertex bone -1
+material -1 vertex
+-1 0.500000 vertex texture 0.500000 vertex material
+anim bone bone texture anim
+=
+= frame
+material texture = vertex vertex
+material vertex -1
+anim =
+bone vertex -1 vertex anim
+= material bone 1.0 -1 -1 texture material texture
+material
+texture anim anim
+vertex
+vertex material
+-1 0.500000
+-1 1.0 0.500000 vertex
+0.500000 = texture 1.0
+material bone 1.0 1.0 frame 0.500000 material 1.0 material 0.500000
+bone material frame vertex
+material
+-1 0.500000 0.500000
+material frame
+texture 1.0
+frame
+0.500000 vertex
+0.500000 anim 1.0 0.500000 frame
+frame frame = vertex anim
+frame -1 =
+material
+anim anim
+vertex frame material 1.0
+anim
+bone 0.500000 0.500000 material bone frame frame frame = -1
+-1
+anim
+0.500000 frame
+1.0 =
+bone frame 0.500000 bone
+-1
+material = texture frame = vertex bone
+0.500000 material
+anim anim
+bone frame -1 texture material
+anim 0.500000 material 0.500000 material texture texture
+anim texture anim anim vertex bone vertex 0.500000 anim
+-1 anim
+0.500000 1.0 0.500000 anim frame texture 0.500000
+0.500000 anim texture = material anim texture
+= bone
+texture -1 -1 anim
+-1 1.0 = texture
+vertex bone texture 0.500000 =
+anim
+anim
+anim material 1.0
+material frame
+vertex texture frame bone
+1.0 = anim
+anim 1.0 material
+anim 0.500000 material
+material texture texture 0.500000 =
+-1 = vertex
+bone
+material material texture
+texture bone =
+= 0.500000 0.500000 material = frame 0.500000 0.500000
+1.0 -1 material anim -1 frame anim
+frame texture vertex -1 texture vertex -1
+frame =
+bone bone
+texture
+bone 1.0 bone
+1.0 = 1.0
+frame 1.0 -1
+material anim
+bone
+texture
+anim vertex bone -1
+texture
+1.0 anim frame = vertex 1.0 frame
+0.500000 -1 material
+0.500000 vertex texture material 1.0
+vertex -1 frame bone
+vertex texture anim vertex
+material 1.0
+-1 0.500000
+bone -1 vertex
+=
+texture vertex
+bone 1.0 bone bone -1 0.500000 material = 1.0 frame 0.500000 texture
+material
+material 0.500000 bone 1.0 1.0 texture material 1.0 -1
+1.0 bone 1.0 = material
+= -1 0.500000
+texture = material = = 1.0
+1.0 1.0 -1
+anim texture
+0.500000 anim -1
+0.500000 1.0 1.0 vertex
+bone = material 1.0
+vertex 0.500000 -1
+frame
+frame texture 0.500000 vertex
+1.0 0.500000 -1
+texture material =
+-1 material
+-1
+= frame vertex 0.500000 = anim material texture bone
+frame -1 texture
+= -1
+-1 vertex bone
+texture
+0.500000
+1.0 -1 bone
+= anim vertex
+vertex material texture 1.0 material material
+material anim = 0.500000 anim
+-1 texture =
+material =
+1.0 frame
+anim frame =
+-1 texture texture texture = 1.0 -1 0.500000
+-1
+vertex = 0.500000 bone anim material 0.500000 material -1 1.0 0.500000 vertex frame vertex vertex
+anim frame
+anim
+-1 material 1.0 material anim texture frame = frame
+frame
+material material 0.500000 texture -1 0.500000
+vertex 1.0 1.0 1.0
+bone 1.0 1.0 -1 0.500000 material
+0.500000 -1 0.500000 material texture texture 1.0 1.0 frame vertex anim material anim
+texture
+bone material material texture
+texture bone texture
+frame texture frame
+frame 1.0 material anim anim anim -1
+anim frame
+bone
+anim 1.0
+anim vertex 1.0
+1.0
+0.500000 0.500000 1.0 1.0
+1.0 1.0 = anim vertex material anim 1.0 1.0
+-1 1.0 bone
+0.500000 anim
+0.500000 -1 0.500000 0.500000
+vertex = vertex 1.0 1.0 bone
+anim =
+= anim
+-1 -1
+bone
+= vertex 0.500000 = anim material = vertex texture
+1.0 1.0
+-1 bone
+bone
+0.500000 anim texture frame -1 0.500000 texture
+-1 1.0 bone = = bone anim
+texture material frame
+anim
+-1 frame material vertex anim
+vertex
+bone texture
+anim -1 = frame 0.500000 anim vertex vertex 1.0 1.0 anim -1 bone
+0.500000 texture
+frame anim -1
+1.0
+-1
+texture anim
+material =
+bone
+= vertex material 1.0 1.0 vertex frame
+anim
+texture
+texture
+anim vertex
+= vertex
+anim 1.0 anim texture 1.0 texture
+texture bone material anim
\ No newline at end of file
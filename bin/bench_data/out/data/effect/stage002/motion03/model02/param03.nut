@@ -0,0 +1,31 @@
+-1 texture -1
+material vertex = 0.500000
+bone anim
+1.0
+1.0
+frame 1.0 0.500000 vertex
+-1 -1 = material bone
+bone -1 -1
+frame
+material -1 frame -1
+1.0 = frame 0.500000 anim -1 anim =
+0.500000 anim bone = material
+anim texture -1
+0.500000 anim
+1.0 anim
+bone bone 0.500000
+vertex frame
+1.0 texture 0.500000 vertex 1.0
+anim texture = frame 1.0
+bone 0.500000 0.500000 bone anim
+1.0
+bone anim texture 0.500000
+1.0
+material frame frame
+1.0 material
+bone texture anim texture 0.500000 material anim vertex bone vertex 1.0 1.0 -1 texture bone material
+anim
+= bone
+anim material
+material
+bone -1 0.500
\ No newline at end of file
@@ -0,0 +1,16 @@
+vertex
+material 0.500000 1.0
+vertex 0.500000 material 1.0 0.500000
+texture 1.0 1.0
+= 1.0
+0.500000 frame
+1.0 bone -1 1.0
+0.500000
+= frame -1 = 1.0 -1 texture anim bone
+1.0 texture
+vertex = texture
+-1 1.0 texture 0.500000 = frame -1 anim
+bone
+frame material vertex frame bone
+-1 material 1.0 1.0 vertex =
+frame = material
\ No newline at end of file
@@ -0,0 +1,57 @@
+1.0
+0.500000
+vertex material
+anim = material frame material 1.0 frame material -1 1.0 vertex bone anim
+bone bone =
+material
+0.500000 bone =
+1.0 =
+bone
+anim texture
+0.500000
+0.500000 0.500000 frame 1.0
+bone material anim =
+texture material vertex frame 1.0 frame
+= frame
+0.500000 texture 1.0
+anim
+texture -1 anim
+texture
+texture bone material vertex =
+bone vertex frame anim -1
+anim =
+= bone 1.0 0.500000 = vertex anim anim 1.0 bone material material anim -1 anim
+-1 0.500000 1.0
+0.500000 anim bone texture frame material
+= vertex anim bone frame
+1.0 = 0.500000
+0.500000 frame 1.0 = anim
+vertex material -1
+anim frame
+frame vertex =
+vertex 0.500000 bone = = bone
+anim material 1.0
+texture 1.0 1.0 texture 1.0
+anim
+1.0
+1.0 = -1 1.0 -1 material bone
+vertex material frame anim vertex -1
+=
+texture texture frame -1 0.500000
+= material material 1.0
+frame bone bone texture =
+vertex -1 0.500000 0.500000 material
+anim
+material 0.500000 material vertex
+material vertex anim -1
+material frame
+texture texture frame material = 1.0 anim bone
+texture
+texture =
+anim texture
+material texture texture texture 1.0
+vertex frame material vertex vertex -1 1.0 -1 0.500000
+material anim -1
+frame 0.500000 = 1.0
+material texture
+1.0 anim = 
\ No newline at end of file
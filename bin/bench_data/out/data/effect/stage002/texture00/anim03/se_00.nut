@@ -0,0 +1,9 @@
+texture bone
+1.0 1.0 1.0 frame bone = bone texture -1 = bone
+1.0 =
+bone frame 0.500000 bone 0.500000 = 1.0 bone anim
+-1 anim 0.500000
+bone bone = = anim -1 texture
+bone frame = texture vertex
+material
+0.500000 vertex 1.0 0.5000
\ No newline at end of file
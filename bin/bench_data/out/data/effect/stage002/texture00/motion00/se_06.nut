@@ -0,0 +1,91 @@
+vertex texture anim texture
+frame
+anim vertex
+-1
+bone frame 1.0 texture frame
+frame vertex anim bone anim vertex bone
+1.0 anim
+1.0 bone frame
+material anim material 0.500000 texture frame vertex
+anim frame bone bone bone -1
+-1 0.500000 material frame vertex
+-1 bone
+texture vertex
+texture 1.0 texture frame -1 1.0
+texture material material anim
+1.0 frame
+texture
+-1 1.0 0.500000
+frame
+-1 texture 0.500000 =
+anim
+anim 1.0 vertex
+texture
+frame anim
+vertex 0.500000 bone anim material material texture anim texture vertex material
+vertex material texture
+texture material frame = vertex frame = anim -1 -1 vertex 1.0
+1.0 0.500000 frame
+1.0 vertex
+0.500000 vertex -1 vertex
+-1
+frame anim
+bone vertex material
+vertex frame bone texture
+0.500000 texture
+bone vertex 1.0 frame anim -1
+material -1
+anim bone
+material 0.500000
+texture -1
+anim
+bone texture
+1.0 1.0
+texture 1.0
+texture = =
+0.500000 vertex material 1.0 -1 frame
+frame
+= vertex
+material bone 0.500000
+0.500000 material
+1.0 0.500000 material vertex texture 0.500000 bone anim bone frame material bone 1.0 material
+material = anim anim = material texture anim
+= = frame
+texture
+bone bone bone 0.500000
+vertex
+anim 0.500000
+1.0
+frame anim anim -1 vertex vertex 0.500000
+frame 1.0 = material texture vertex material
+bone
+anim anim bone texture material = -1 1.0 = material = 0.500000 -1 bone
+frame texture vertex -1 material texture = -1 material
+anim -1 material
+bone frame
+bone 0.500000 vertex vertex vertex = vertex = -1 1.0
+0.500000 texture frame
+frame -1 texture -1
+-1 1.0 anim
+texture
+material
+= =
+bone material 0.500000 0.500000 material = texture anim frame texture = frame frame material material 1.0 bone texture anim 1.0 bone
+vertex 1.0 texture
+bone 0.500000 texture frame frame -1
+0.500000 = vertex -1 material = -1 material 1.0 anim anim
+frame bone
+anim
+material = vertex 0.500000
+1.0 anim
+frame frame frame =
+material
+texture 0.500000 -1 anim anim
+vertex frame = frame vertex -1 1.0 material
+material 1.0 texture vertex anim anim frame 1.0 1.0 anim
+texture bone
+material 0.500000 frame 0.500000
+frame texture texture
+bone anim frame
+= bone vertex = -1 -1
+vertex vert
\ No newline at end of file
@@ -0,0 +1,19 @@
+vertex 0.500000 0.500000 anim 0.500000 vertex 0.500000
+material
+1.0 vertex frame bone frame = =
+anim vertex vertex material frame =
+texture texture
+material vertex bone texture material texture 0.500000
+1.0
+1.0
+bone
+0.500000
+texture bone material texture anim
+-1 1.0 0.500000
+anim =
+texture anim -1 material vertex bone = = 0.500000
+frame texture 0.500000 material vertex texture 0.500000 = 0.500000 material bone
+material =
+-1
+texture material
+-1 bone -1 frame mater
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture bone
+0.500000 -1
+frame frame anim
+anim -1 material bone material vertex =
+material
+bone
+anim -1 = 
\ No newline at end of file
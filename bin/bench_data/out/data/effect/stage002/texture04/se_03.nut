@@ -0,0 +1,6 @@
+vertex
+frame 0.500000 0.500000 -1 1.0 -1 = material
+0.500000 frame material frame
+frame 1.0 -1 =
+= texture
+1.0
\ No newline at end of file
@@ -0,0 +1,14 @@
+1.0 anim material
+bone
+bone anim vertex 0.500000 vertex frame texture frame
+-1
+texture 0.500000
+texture
+1.0 0.500000 frame vertex frame
+texture
+1.0 frame -1
+frame 1.0 bone frame
+bone 1.0 texture -1 0.500000
+material = vertex frame
+1.0 -1 = bone -1
+= bone texture bone texture
\ No newline at end of file
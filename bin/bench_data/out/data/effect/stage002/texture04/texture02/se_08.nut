@@ -0,0 +1,5 @@
+vertex
+0.500000 material
+anim anim
+texture
+texture texture 1.0 t
\ No newline at end of file
@@ -0,0 +1,71 @@
+vertex
+-1 anim frame material texture texture bone frame material material material vertex frame
+bone =
+vertex = vertex -1
+bone frame material 0.500000 anim frame 1.0 0.500000 frame anim
+-1
+frame material bone 1.0
+bone frame
+=
+bone -1 frame 1.0 vertex
+material 0.500000 1.0 bone material frame texture -1
+0.500000 0.500000 1.0 frame 1.0
+-1 -1 1.0 = 1.0 -1
+texture
+1.0
+material anim 1.0 = = bone 0.500000 frame frame texture 1.0 vertex vertex frame texture
+1.0 1.0 =
+bone bone 1.0
+frame material = = material -1
+vertex
+texture material = = vertex anim 0.500000 frame frame texture texture
+vertex 0.500000 0.500000 vertex
+material material 1.0 1.0 frame bone 0.500000 = 0.500000
+1.0
+frame
+vertex bone
+1.0
+= anim texture texture frame
+= -1 vertex anim material texture -1 -1 texture
+1.0
+texture =
+1.0
+frame -1
+material 0.500000 material frame bone
+texture vertex
+texture = material = 1.0 anim 0.500000
+material = texture material texture texture
+bone texture vertex
+anim anim 0.500000
+bone 1.0
+frame vertex = 1.0 1.0 frame material =
+1.0
+material material
+1.0 1.0
+frame
+= 0.500000 material
+0.500000 1.0 -1 anim texture frame
+anim
+bone
+1.0
+0.500000 -1 -1
+vertex
+bone frame material material =
+texture = bone 0.500000
+-1
+vertex vertex
+frame texture
+material
+vertex vertex = -1 vertex texture -1 1.0 1.0
+-1
+=
+0.500000 =
+0.500000
+bone
+anim -1
+= 0.500000
+1.0
+anim material -1 = 0.500000 1.0 vertex material vertex frame
+bone 0.500000 bone 1.0 anim anim = material anim texture
+anim frame texture vertex
+=
\ No newline at end of file
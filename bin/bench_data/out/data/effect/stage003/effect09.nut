@@ -0,0 +1,15 @@
+-1 material anim bone bone texture material texture frame = = 1.0 vertex = vertex bone = = vertex bone bone material
+bone vertex anim vertex bone
+1.0 vertex material frame =
+0.500000 1.0
+=
+texture 1.0 -1 = texture vertex
+frame
+vertex frame = -1
+material
+material texture
+frame -1
+-1 = texture 1.0 1.0
+anim anim material
+anim
+-1 texture ver
\ No newline at end of file
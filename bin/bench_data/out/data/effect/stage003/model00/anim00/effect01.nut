@@ -0,0 +1,33 @@
+bone anim
+bone bone bone
+-1 0.500000 vertex -1 1.0
+1.0 anim
+material frame 0.500000 -1 -1 frame -1 texture 1.0 0.500000 anim
+anim 0.500000 frame material
+material frame anim texture
+1.0 texture material bone anim
+frame anim
+bone material bone 0.500000
+material frame vertex 1.0
+frame =
+frame 1.0 bone bone =
+bone frame 0.500000
+vertex texture bone vertex
+vertex texture = 0.500000
+-1 -1 texture texture texture
+anim frame
+-1 bone vertex 0.500000 0.500000
+anim
+frame = texture material -1
+anim vertex material
+vertex =
+1.0
+vertex 0.500000 frame frame 1.0
+-1
+= -1 0.500000 vertex vertex vertex -1 texture frame
+frame
+bone
+1.0
+material
+vertex
+1.
\ No newline at end of file
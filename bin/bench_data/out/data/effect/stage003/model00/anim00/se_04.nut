@@ -0,0 +1,209 @@
+anim
+0.500000 bone
+bone bone material 0.500000 =
+bone 0.500000 0.500000 -1 1.0 frame bone bone =
+-1 frame 1.0 vertex frame 0.500000 0.500000
+texture 0.500000 texture 1.0 frame material
+texture 1.0 =
+material texture = 0.500000 1.0 frame = anim material frame =
+0.500000 bone frame texture vertex = 1.0 vertex frame material vertex anim 0.500000
+1.0 material 1.0 texture vertex bone bone -1 anim vertex material anim texture material texture 1.0 frame texture = frame material frame = frame
+= -1 bone bone frame
+-1 frame 0.500000 vertex
+texture material
+frame anim
+anim material 1.0 material 0.500000 material texture -1 bone
+-1
+frame vertex -1
+1.0 frame frame
+= frame anim
+texture bone vertex = frame texture anim
+material anim vertex
+texture texture
+frame 1.0
+vertex
+0.500000 -1 -1 material material vertex 0.500000 anim =
+bone bone 1.0
+-1
+=
+= bone = =
+frame frame = anim
+0.500000
+bone 0.500000 texture
+anim material -1 1.0
+-1 bone 1.0 texture frame 1.0 texture bone
+vertex vertex vertex
+1.0 texture vertex 1.0
+anim
+bone 1.0 -1
+texture frame frame frame anim anim texture
+1.0 frame
+vertex -1 =
+1.0 1.0 1.0 0.500000 anim 0.500000 material bone 0.500000 bone 1.0 -1 =
+texture texture texture
+bone 0.500000 material 1.0 vertex 1.0 frame vertex texture anim material bone bone frame vertex 1.0 1.0 frame frame -1 1.0
+material material
+anim =
+-1
+anim anim -1 1.0
+frame material vertex texture anim material
+-1
+= bone bone -1 1.0 material bone material bone =
+0.500000 texture frame
+texture material anim vertex
+0.500000 frame
+bone
+anim = material =
+frame 0.500000
+vertex 0.500000 -1 vertex material material anim 1.0
+material
+-1 material frame 0.500000
+vertex material
+-1 vertex bone
+anim -1
+frame bone 1.0
+= 0.500000 0.500000 vertex frame
+material vertex anim 0.500000 -1 frame
+0.500000 texture frame
+anim =
+anim =
+texture vertex
+vertex 1.0 material
+bone frame = vertex -1 material =
+0.500000 1.0 material material
+frame
+vertex
+material
+= frame
+material 0.500000
+vertex
+bone material
+bone =
+frame anim
+frame
+1.0 bone anim anim bone = vertex frame vertex bone
+=
+= anim = material vertex
+vertex material = bone 0.500000 = 0.500000 = texture
+-1 1.0
+anim frame 0.500000
+texture anim texture 1.0
+0.500000
+1.0 vertex 0.500000
+-1 material vertex anim frame anim frame = material
+texture
+texture vertex
+-1
+1.0 = = texture
+material 1.0 material 1.0 =
+vertex anim 0.500000 bone 0.500000
+bone texture frame 0.500000 1.0 =
+vertex bone texture 0.500000
+= 1.0 texture material 1.0 bone =
+frame
+bone
+material anim texture
+material bone bone frame texture -1
+material anim vertex -1 frame 1.0 bone
+-1
+bone =
+= material =
+anim material material anim texture texture
+frame anim 1.0
+anim
+texture 0.500000 = = frame anim = -1 texture 1.0 frame bone bone vertex 1.0 anim texture frame
+anim
+0.500000
+material texture
+0.500000 -1
+vertex anim
+bone vertex bone = = -1 texture
+-1 vertex material
+bone texture = frame -1 vertex 0.500000
+bone bone material vertex 1.0
+0.500000 frame texture bone 1.0
+texture bone anim anim 1.0 vertex
+0.500000 0.500000 texture =
+-1
+-1 bone
+0.500000 -1 anim bone frame bone material bone 1.0 bone
+material 0.500000 1.0 -1 frame
+vertex
+-1
+0.500000
+= anim
+0.500000 bone -1 1.0 =
+= bone anim material
+-1 material -1 = material
+material vertex vertex vertex -1 bone
+frame
+-1
+= bone
+frame 0.500000 0.500000
+vertex 0.500000 material texture
+1.0 anim
+=
+bone
+anim
+bone
+= material texture texture -1 material 0.500000
+-1 frame
+bone vertex
+anim anim 1.0 frame
+frame
+texture texture frame 1.0
+vertex frame 0.500000 frame bone -1
+1.0 texture = anim 1.0 frame =
+anim -1 0.500000
+material
+vertex
+anim
+= texture 0.500000
+0.500000 0.500000 bone vertex bone
+texture frame = vertex
+frame 0.500000 = = frame 1.0 =
+= frame
+vertex bone
+-1 texture texture anim material vertex anim -1 bone frame = frame -1 texture -1 1.0 bone 0.500000 anim 0.500000 vertex bone 0.500000
+1.0 -1 anim
+frame
+1.0
+vertex = = 0.500000
+= 0.500000 =
+material material = anim
+-1
+bone frame vertex material anim bone
+0.500000 = frame texture
+vertex anim bone 0.500000 = -1 bone texture
+frame frame texture bone anim texture vertex
+texture
+texture material bone
+anim bone
+vertex
+frame
+texture frame
+anim -1
+vertex 0.500000 = 1.0 -1 -1
+material 1.0
+1.0
+-1 material material material = 1.0 1.0 anim
+bone
+= vertex
+anim =
+texture material vertex -1
+texture vertex anim material = = = anim 0.500000 material
+anim anim
+bone
+= anim
+0.500000
+1.0 vertex 1.0 anim
+vertex =
+frame
+= material -1 =
+anim
+texture 0.500000 vertex
+1.0
+0.500000 bone
+anim
+1.0 -1
+1.0 frame -1
\ No newline at end of file
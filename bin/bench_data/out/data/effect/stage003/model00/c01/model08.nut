@@ -0,0 +1,26 @@
+vertex 1.0 bone anim
+material
+material vertex anim 1.0
+= vertex = texture 0.500000 -1 vertex bone = bone =
+material -1 material -1 -1
+anim anim material texture
+anim
+frame material -1 frame material 0.500000 -1 material frame -1 texture = texture material texture frame
+texture material
+= anim 0.500000 vertex 1.0 = = anim frame bone 0.500000 1.0 -1 1.0 0.500000 material texture =
+0.500000 anim texture 1.0
+anim anim vertex
+anim anim -1
+vertex
+material frame anim -1
+frame material = vertex
+bone frame
+=
+frame frame texture material
+0.500000
+bone -1 bone -1 -1 -1 material
+bone bone frame bone
+-1 -1 material vertex = 1.0 vertex 1.0 1.0 material bone
+bone bone 0.500000 vertex -1 material
+-1 vertex -1 bone
+0.500000 ani
\ No newline at end of file
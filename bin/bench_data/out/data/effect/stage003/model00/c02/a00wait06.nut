@@ -0,0 +1,324 @@
+bone material 1.0
+= texture
+anim -1 vertex texture
+= 1.0 -1 bone vertex
+-1 texture = frame =
+= -1
+-1
+= frame 0.500000 texture 1.0
+material vertex
+texture
+vertex anim anim = 0.500000 =
+= texture
+bone frame 1.0 texture bone texture texture texture bone 1.0 =
+bone anim vertex -1 -1 frame material 0.500000 vertex frame
+-1 vertex material bone -1 texture = -1 anim 0.500000 bone
+bone vertex texture
+bone =
+1.0 1.0 bone =
+material
+frame bone material anim bone 0.500000 vertex anim
+= material anim anim anim =
+bone frame = frame frame 1.0
+anim 0.500000 vertex material texture
+anim -1 texture material 1.0 material 1.0 0.500000 texture 0.500000 -1 1.0
+bone material material vertex
+anim 0.500000 -1 1.0 frame
+anim anim anim 1.0 material
+texture texture anim
+-1
+-1 1.0 material
+vertex vertex vertex texture
+vertex texture 0.500000 anim = texture bone vertex -1 =
+vertex 1.0 frame
+-1
+0.500000
+1.0
+material
+-1 1.0 texture -1 frame frame material
+texture = material 1.0
+material
+material
+bone texture texture bone vertex bone anim 1.0 vertex vertex =
+material -1
+bone bone bone texture
+vertex bone material frame 0.500000 -1 -1
+-1 anim anim texture 0.500000
+= = vertex
+material material
+anim texture material anim -1 frame 0.500000 -1 anim =
+-1
+texture
+material bone
+=
+material texture anim -1 material anim vertex material frame frame
+texture vertex bone 1.0 material 0.500000 = vertex frame vertex
+-1
+vertex texture
+bone
+anim 1.0 texture = material material frame 0.500000
+frame -1 frame 0.500000 material
+bone
+=
+0.500000 = vertex frame
+1.0
+vertex
+frame
+-1 bone -1
+vertex bone texture
+material material -1 frame
+texture material 0.500000 texture bone = 0.500000
+material
+texture texture frame bone frame
+texture anim = 0.500000 vertex
+anim
+1.0 vertex
+frame
+1.0 anim material = texture texture 0.500000 vertex bone
+material 0.500000 texture -1 texture vertex 1.0 vertex
+= anim anim frame 1.0 material texture anim
+vertex
+vertex 1.0 frame frame vertex 1.0 = 0.500000
+0.500000 -1 -1 vertex frame texture 1.0 1.0 = texture -1 vertex bone material
+vertex frame
+bone material -1 vertex
+bone frame
+-1 -1 vertex
+frame vertex anim
+anim = 0.500000 texture vertex
+0.500000 0.500000 -1
+texture
+-1
+0.500000 frame anim
+=
+=
+texture
+bone bone frame
+anim -1 vertex =
+-1 texture = frame material -1 material
+anim frame texture
+material 1.0 anim anim anim
+material texture =
+=
+1.0
+0.500000 0.500000 material 1.0 frame vertex 1.0 frame texture -1
+-1 frame texture bone texture vertex 0.500000
+anim frame
+0.500000 vertex vertex anim texture anim material vertex 0.500000
+0.500000 vertex
+vertex bone material 1.0
+bone bone =
+material -1
+bone vertex anim
+bone 1.0
+0.500000 material bone frame material 1.0 1.0 = 0.500000 material bone
+1.0 1.0 texture
+0.500000 1.0 material
+1.0 0.500000 texture 1.0 1.0
+material
+material texture = bone vertex texture
+frame bone anim
+texture
+material texture anim texture -1 = 1.0
+0.500000
+anim
+anim frame
+1.0 frame bone
+anim bone -1 frame 1.0 texture 0.500000 -1 anim =
+1.0 vertex -1 anim -1
+texture
+material frame
+anim 0.500000
+= 0.500000 anim
+bone -1
+= bone -1 1.0 = texture -1 anim material
+texture 0.500000 anim 1.0
+1.0 material
+vertex -1 frame
+frame anim vertex -1
+frame
+material anim texture anim -1 frame frame 0.500000 texture anim
+-1
+1.0 bone 1.0 anim
+0.500000 = vertex
+texture 0.500000
+vertex = vertex 0.500000 anim =
+1.0 frame
+anim
+vertex vertex = frame
+bone
+material anim bone texture = texture = anim frame vertex material
+bone texture
+texture anim
+material material vertex texture material material material = -1 = bone = bone vertex
+-1 =
+bone -1 1.0 vertex bone
+bone frame 0.500000
+material =
+1.0 -1
+1.0 frame
+texture -1
+anim
+material
+frame = 0.500000 vertex 0.500000 1.0
+0.500000 frame frame
+texture
+= bone material material texture vertex 1.0 -1
+frame -1 1.0 texture bone texture anim = 0.500000 bone 0.500000 texture anim material
+anim bone vertex
+0.500000 1.0 anim 1.0 1.0 frame texture
+1.0
+1.0 texture -1
+0.500000 -1 material texture frame vertex frame bone bone
+-1 frame anim
+bone
+bone material texture
+bone 0.500000 bone
+vertex
+1.0 -1
+material = texture
+anim texture
+texture
+vertex bone
+bone
+frame 0.500000
+material
+anim frame -1 0.500000
+material
+anim 1.0 1.0
+-1 0.500000 0.500000 = material = 1.0 1.0
+material = frame material
+anim
+vertex vertex 0.500000 =
+anim 0.500000 1.0
+= -1 0.500000 anim vertex bone anim
+-1
+frame
+bone -1 = vertex
+bone
+frame bone
+1.0
+frame 0.500000 = -1
+frame frame
+frame bone vertex vertex anim texture anim
+material vertex = texture =
+= anim anim vertex = -1 0.500000 bone 0.500000
+material material frame vertex frame vertex texture bone
+texture frame
+texture
+bone
+1.0 0.500000
+0.500000 texture 0.500000 0.500000 bone
+anim texture anim -1
+vertex -1
+vertex texture texture
+0.500000
+1.0 1.0 -1 anim
+frame anim bone -1
+texture =
+material
+anim texture = bone -1 1.0 = frame 0.500000 texture frame
+-1 frame
+material -1 -1 =
+1.0
+texture bone frame
+=
+anim
+0.500000 anim bone anim
+1.0
+material = vertex
+=
+frame bone = frame
+vertex 0.500000 material
+-1 vertex
+1.0 bone anim
+bone 0.500000 material material anim
+-1 frame material bone bone 1.0
+=
+-1 bone
+vertex
+-1 anim frame
+frame
+material 1.0
+anim vertex bone 1.0 vertex 0.500000 1.0 -1 vertex
+1.0
+0.500000 1.0 frame = frame
+frame =
+texture -1
+0.500000 1.0 bone
+anim
+=
+vertex
+1.0
+= vertex 1.0 -1 material bone 0.500000 vertex -1
+= 1.0 = 0.500000 vertex anim
+0.500000 1.0 material frame bone material
+= 0.500000
+texture = material
+material 1.0 -1 -1 -1
+texture
+material = 0.500000
+bone anim vertex
+bone frame vertex frame texture texture bone
+texture frame
+0.500000 bone 0.500000 material -1
+texture texture material = bone = 0.500000 -1 bone vertex anim anim 0.500000 material texture -1
+material
+texture frame material frame -1 1.0 frame -1
+frame anim anim
+1.0
+material bone vertex
+vertex 1.0
+bone
+vertex -1
+-1
+bone 0.500000 bone =
+1.0 material 0.500000
+texture 1.0
+0.500000 0.500000 material
+bone
+-1 anim anim frame 1.0
+= 0.500000 frame bone = texture texture = -1 frame
+vertex
+material vertex 0.500000 anim bone texture frame 1.0 0.500000 frame frame texture = -1
+1.0
+texture =
+-1 1.0
+-1 1.0 frame bone -1
+vertex frame = anim 0.500000 -1 bone 1.0 vertex
+vertex
+0.500000 0.500000
+-1 anim bone frame material
+texture 1.0 1.0 texture anim -1 texture anim
+bone frame = anim
+material
+frame frame material
+-1
+0.500000
+vertex
+1.0 = 1.0 bone = -1 0.500000 vertex 0.500000
+1.0
+bone vertex frame -1
+vertex vertex texture
+anim
+0.500000 =
+material material material 1.0 anim
+1.0
+material = texture material
+anim vertex vertex
+= 1.0 material frame anim
+0.500000 texture material
+vertex material frame texture bone material = frame
+-1 anim 0.500000 texture -1
+= bone frame anim
+-1 material material
+frame 0.500000 vertex anim vertex 1.0 0.500000 texture 1.0
+anim material 0.500000 bone 1.0
+0.500000 0.500000
+anim
+texture
+texture anim vertex -1 bone
+texture
+frame = texture vertex anim vertex
+vertex frame frame =
+fram
\ No newline at end of file
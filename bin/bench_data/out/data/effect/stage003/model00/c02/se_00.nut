@@ -0,0 +1,5 @@
+0.500000 -1 material anim =
+0.500000 anim bone
+bone vertex frame
+0.500000
+frame -1
@@ -0,0 +1,22 @@
+bone
+material 0.500000 bone
+bone 1.0 material bone bone bone
+1.0 texture bone 1.0 frame -1 frame 1.0 vertex frame texture frame
+0.500000 texture texture -1 =
+vertex
+bone 0.500000 = anim
+0.500000 vertex material anim material -1 material
+bone anim
+anim
+vertex 1.0 -1 vertex = -1 0.500000 bone = vertex frame -1
+frame anim
+material -1 anim 0.500000 frame
+anim vertex -1
+1.0 bone = material 0.500000 -1 vertex vertex
+material
+frame
+frame 1.0
+0.500000 = 0.500000 texture anim frame frame
+vertex
+1.0
+verte
\ No newline at end of file
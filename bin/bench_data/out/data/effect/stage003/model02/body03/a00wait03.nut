@@ -0,0 +1,159 @@
+frame
+vertex frame vertex
+bone
+bone material bone vertex
+vertex
+texture
+texture
+-1 texture bone 1.0 material 1.0 anim vertex frame anim anim material frame material texture 0.500000 vertex anim anim anim texture texture 0.500000 = texture
+bone
+texture
+anim vertex vertex anim frame anim frame
+bone
+0.500000 -1
+0.500000
+= = material material vertex frame frame
+material texture 1.0 frame frame
+0.500000 bone
+-1 1.0 = -1 0.500000 -1 = 1.0
+0.500000
+-1 -1 anim vertex
+texture 0.500000 material anim 0.500000 vertex
+frame -1 texture
+frame = material
+frame anim 0.500000 =
+bone frame
+1.0 material
+frame 1.0 0.500000
+material
+vertex = anim material
+vertex = anim texture
+bone 1.0 material
+= texture material vertex
+anim bone vertex = vertex
+0.500000 bone frame 1.0
+0.500000
+texture bone
+0.500000 texture
+bone anim
+bone 0.500000 0.500000 material anim texture frame 1.0 anim 0.500000
+material 1.0 -1 vertex
+frame vertex texture = vertex bone vertex material
+-1 texture
+-1
+frame -1 frame = -1
+1.0
+material frame 0.500000
+-1 anim bone bone -1 frame
+frame =
+1.0 -1 1.0 bone texture -1 vertex
+vertex texture -1 1.0 1.0
+material frame
+vertex anim vertex 1.0 0.500000
+bone
+1.0 = texture =
+1.0 material 1.0
+vertex
+anim material frame = frame frame
+frame vertex
+frame bone anim 1.0
+bone bone -1
+material -1 vertex
+= vertex material bone bone bone -1 material =
+vertex bone bone texture -1 -1 frame = frame
+= 0.500000 -1
+vertex 0.500000 bone frame vertex
+texture -1
+frame vertex material
+0.500000 -1
+frame
+anim bone material
+frame texture
+0.500000
+texture = = bone
+1.0 0.500000
+anim vertex 0.500000 vertex 0.500000 vertex 0.500000
+1.0 -1 anim
+frame frame frame material frame vertex
+1.0 material
+vertex
+1.0 bone bone
+-1 material
+=
+bone bone
+0.500000
+bone vertex -1
+= -1
+0.500000 vertex vertex
+texture bone 0.500000 bone 1.0
+anim anim
+texture =
+bone frame frame = 0.500000 vertex
+material 0.500000 anim bone frame -1 texture 0.500000
+bone texture 1.0 material =
+vertex
+-1
+anim 0.500000 = -1
+material frame material
+frame 0.500000
+texture 1.0 frame
+-1 frame texture 1.0 texture
+=
+0.500000
+material texture = 0.500000 anim
+1.0 anim
+vertex bone texture material material
+material vertex
+1.0 bone
+anim frame vertex 0.500000 1.0 bone = texture 0.500000 texture 0.500000 material material
+1.0
+vertex
+1.0 = material 1.0 material -1 = -1
+= = vertex 0.500000 1.0 anim vertex 1.0 anim = material
+anim anim 0.500000 vertex -1 vertex vertex
+anim
+0.500000 material 1.0
+0.500000 vertex bone = -1 1.0 vertex
+-1 frame = 0.500000
+= vertex material frame 0.500000
+texture
+anim frame vertex frame
+-1 anim anim anim frame bone vertex 1.0
+= texture anim anim anim bone
+texture texture
+bone bone 0.500000
+bone -1 1.0 material frame material anim bone
+= texture texture
+vertex
+-1 vertex
+texture -1 = = 1.0 bone
+1.0 material
+0.500000 1.0 = material 0.500000
+anim = 1.0 bone -1 0.500000 -1 bone texture
+anim
+frame bone bone frame
+1.0
+frame frame = 0.500000 anim texture frame material frame material 1.0 0.500000 -1 0.500000 bone anim
+material = anim material anim =
+1.0 material -1 -1 = texture anim
+0.500000 texture bone
+bone material -1
+material texture material -1 bone
+vertex = anim
+= 0.500000
+0.500000
+anim frame 0.500000
+frame bone texture 1.0 anim bone = material material
+0.500000 0.500000 vertex 1.0
+0.500000 0.500000
+texture
+-1 1.0 frame
+anim texture frame texture frame
+material = texture anim vertex material
+anim
+0.500000
+material anim
+frame -1
+bone texture
+vertex
+anim fram
\ No newline at end of file
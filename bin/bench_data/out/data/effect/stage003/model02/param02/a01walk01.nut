@@ -0,0 +1,51 @@
+anim vertex 1.0 0.500000
+1.0 material
+frame material material -1
+=
+bone
+anim
+bone bone
+0.500000 vertex texture 1.0 1.0 1.0 = = = = bone 1.0 vertex
+texture -1
+0.500000 anim anim material
+0.500000 anim
+0.500000
+0.500000 -1 =
+material = anim
+= bone anim
+1.0
+vertex material frame 1.0
+1.0 vertex
+bone
+texture bone material = vertex 0.500000 1.0 frame
+material material vertex = vertex = material
+vertex
+0.500000 vertex 0.500000 -1 bone bone 0.500000 vertex
+0.500000 =
+1.0 frame
+0.500000 material 0.500000 0.500000 vertex texture frame -1 texture -1 0.500000 anim anim
+0.500000 material -1 =
+=
+0.500000 -1 vertex material = material 1.0
+-1 1.0
+texture = 1.0 1.0 1.0 = vertex bone bone texture
+vertex anim bone anim vertex
+-1 anim
+texture bone = 1.0
+vertex
+1.0 anim 0.500000
+0.500000 vertex =
+material = 0.500000
+1.0 bone
+0.500000 = material material = texture anim vertex -1 material =
+0.500000 1.0 material -1 1.0 1.0 -1
+texture 1.0 frame 1.0 vertex material
+1.0
+=
+material
+vertex frame -1 material texture
+1.0
+bone bone
+texture anim
+texture
+ma
\ No newline at end of file
@@ -0,0 +1,5 @@
+texture -1
+vertex -1 frame frame
+bone =
+bone -1 frame
+bon
\ No newline at end of file
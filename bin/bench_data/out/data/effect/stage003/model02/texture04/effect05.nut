@@ -0,0 +1,16 @@
+texture vertex =
+anim
+frame
+material
+0.500000 0.500000 material anim -1
+frame material material
+= -1 material = material anim 0.500000 material 1.0 0.500000
+texture
+1.0 anim
+anim
+vertex vertex
+texture
+anim bone = 1.0 material
+material
+vertex
+1
\ No newline at end of file
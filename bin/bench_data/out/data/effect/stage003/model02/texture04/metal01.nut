@@ -0,0 +1,12 @@
+anim 0.500000 material frame
+vertex =
+0.500000 = material texture 0.500000
+frame
+= -1 bone 0.500000
+= -1 frame
+vertex texture material
+bone =
+anim material 1.0 0.500000 bone
+=
+frame material bone
+bone vertex texture 0.500000 1
\ No newline at end of file
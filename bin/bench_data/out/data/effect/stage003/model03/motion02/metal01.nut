@@ -0,0 +1,42 @@
+material anim 1.0 bone frame frame frame anim texture -1 vertex = bone
+bone
+-1 1.0
+bone vertex -1 frame 1.0
+material material = material
+0.500000 vertex 1.0 -1 1.0
+0.500000
+anim 1.0
+bone
+= 1.0 0.500000
+0.500000 anim texture -1 1.0 anim material 1.0 anim anim
+1.0
+anim -1 bone 1.0 0.500000 material
+anim anim vertex 0.500000 1.0 texture material
+vertex -1 bone 1.0 -1 = texture material
+anim
+frame texture texture 1.0 material -1 vertex
+anim material texture 1.0
+= anim material -1
+bone material
+frame material material anim 0.500000
+-1
+vertex material texture vertex vertex anim bone 1.0 1.0 material
+anim frame
+bone frame 1.0 = anim material -1
+1.0 0.500000 texture 1.0 material = -1 frame -1
+-1
+frame -1
+vertex = bone frame
+vertex vertex 1.0 vertex anim bone frame
+material anim bone frame texture 1.0 vertex texture
+material 1.0 1.0 0.500000
+= = vertex -1 material
+material = 1.0 frame -1 texture 0.500000
+bone 1.0 0.500000
+-1 texture vertex bone texture
+texture
+bone 1.0 =
+1.0 -1 =
+0.500000 bone
+texture
+material
\ No newline at end of file
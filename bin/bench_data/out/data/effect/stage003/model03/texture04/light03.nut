@@ -0,0 +1,158 @@
+1.0 1.0 anim
+1.0 vertex bone material bone vertex = frame vertex
+anim
+-1 vertex 0.500000 -1 anim -1
+material texture frame bone texture
+1.0 anim -1 texture bone 0.500000 texture
+0.500000
+anim
+bone
+=
+frame
+vertex 1.0 0.500000 -1 anim
+= bone
+bone
+material material anim
+texture vertex bone
+bone 1.0 vertex
+anim = material material material anim material anim texture bone 1.0 =
+1.0 = bone -1
+1.0 anim anim material 0.500000 anim bone -1 anim texture
+material vertex frame texture = vertex frame -1 1.0 = bone = 0.500000 texture
+anim bone
+bone
+anim 1.0 texture anim vertex 0.500000 -1 texture
+frame bone
+material vertex bone
+1.0 0.500000 frame
+anim
+anim texture bone
+texture -1 frame = vertex vertex frame
+bone material texture material material 0.500000 frame material = 1.0 0.500000 anim 0.500000 bone
+texture bone material texture
+texture 1.0 vertex material
+bone vertex 1.0 vertex vertex 1.0 anim = texture frame -1 vertex
+anim material
+-1 1.0 material frame = frame bone bone texture 1.0 bone vertex
+frame vertex
+1.0
+1.0 frame
+vertex 0.500000 =
+anim 1.0 vertex 1.0 -1 =
+anim -1 anim material 0.500000 frame 0.500000 frame 0.500000
+texture bone bone material texture = vertex = anim 1.0 texture 0.500000 -1 frame 0.500000 0.500000 bone anim texture
+bone 0.500000 material material 1.0
+bone
+bone anim material texture
+vertex bone 1.0 =
+1.0 -1 vertex bone
+frame material
+vertex vertex bone bone
+1.0 material
+anim material 0.500000
+bone bone texture -1 texture frame anim vertex -1 material
+0.500000 vertex vertex 1.0 -1
+texture texture bone
+frame anim material
+texture
+anim
+= = anim =
+bone
+texture 0.500000
+texture texture 1.0 1.0 anim 0.500000 vertex texture texture vertex 0.500000 material
+material -1 material
+bone 0.500000
+frame texture 1.0 1.0
+frame
+-1 texture -1
+0.500000 1.0 -1 anim 0.500000
+bone 1.0 anim vertex material frame anim anim anim frame -1 material frame vertex bone 0.500000 bone -1
+=
+material 0.500000 texture -1 -1 1.0 frame 0.500000
+bone
+0.500000
+texture frame 0.500000 frame
+frame -1 bone frame material 1.0 texture bone material bone frame texture anim
+-1 material = vertex texture
+-1
+texture
+1.0
+-1 1.0
+bone vertex anim anim 0.500000 1.0 vertex =
+1.0 0.500000 vertex bone
+1.0 material
+anim texture -1
+texture
+frame 1.0 anim -1 anim
+0.500000 = 0.500000 texture texture
+frame -1 -1 anim material
+-1
+bone texture
+texture anim = anim bone anim -1 texture = frame
+0.500000 vertex vertex
+bone =
+0.500000 texture
+frame vertex 1.0 vertex 1.0
+frame 0.500000 material vertex -1 bone = 1.0 vertex texture material -1 =
+vertex
+bone bone 0.500000 anim bone
+texture
+texture
+material
+vertex frame material
+=
+vertex texture 0.500000 -1 vertex
+frame -1 1.0
+1.0 frame 1.0 material 0.500000 = frame bone 1.0 -1 -1 bone
+1.0
+texture bone = material bone 0.500000 0.500000 1.0 bone frame 0.500000 material bone texture 0.500000
+0.500000 = texture vertex
+bone vertex material 0.500000 frame texture
+anim material 0.500000 0.500000 bone -1 1.0 vertex = frame -1
+texture = anim texture -1 1.0 texture = -1
+-1
+vertex
+anim
+1.0
+texture frame
+-1 = 1.0 anim frame bone
+vertex
+anim bone texture
+material
+bone
+vertex 0.500000 = 1.0 = vertex 0.500000 0.500000 1.0 texture 1.0 texture anim
+texture anim material 0.500000
+frame bone
+= 1.0 1.0 = material
+anim
+frame vertex 1.0 frame anim
+0.500000 = = vertex
+0.500000 material texture
+bone frame
+=
+-1
+= texture = anim frame = bone -1 0.500000 1.0
+-1
+vertex
+anim 0.500000 1.0 material material anim
+vertex texture 1.0 = texture
+0.500000 frame material
+material
+vertex vertex
+material 0.500000 material material frame 0.500000 vertex
+material -1 -1 0.500000 texture texture texture anim texture vertex =
+0.500000 frame 1.0 1.0 = frame material frame = anim bone
+1.0 = bone 0.500000 1.0 anim
+-1 frame texture texture 0.500000 vertex -1
+-1
+anim anim -1 material
+frame
+texture
+material vertex bone = frame -1 -1 vertex frame texture vertex vertex frame -1 material -1 0.500000
+0.500000 material
+1.0 frame 0.500000 bone
+anim
+vertex =
+= frame material -1
+= texture frame 1.0
+0.
\ No newline at end of file
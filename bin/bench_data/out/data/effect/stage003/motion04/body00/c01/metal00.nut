@@ -0,0 +1,251 @@
+1.0 frame texture = 1.0 bone
+1.0 anim anim = anim
+frame anim = vertex
+-1 vertex vertex -1
+vertex
+texture
+= 0.500000
+1.0 material frame
+material texture vertex -1 1.0 = = frame bone bone anim -1 texture frame = -1 material bone anim =
+texture
+texture material material 0.500000 = -1 = vertex 1.0 material
+material vertex 1.0 material bone 0.500000 bone -1 frame -1 bone
+vertex -1
+material texture
+material
+bone anim vertex bone
+anim
+material material
+-1
+material texture frame anim frame material bone = -1 vertex bone
+anim 1.0
+bone bone -1 -1 1.0 -1 1.0 1.0 -1 frame
+bone -1 1.0 0.500000 bone vertex = material material -1
+= 0.500000
+vertex 1.0 material 1.0
+1.0 texture vertex vertex frame bone = = bone
+-1 = bone vertex material
+vertex vertex
+1.0
+texture 0.500000 anim
+0.500000 bone 0.500000 material bone anim material vertex = -1
+material bone anim material frame
+vertex
+bone texture material texture -1 vertex 0.500000 frame frame vertex 0.500000 vertex bone frame
+texture
+frame anim vertex
+=
+vertex anim texture
+texture
+-1 vertex =
+vertex 0.500000 bone material bone vertex texture
+0.500000
+bone
+1.0 material = 0.500000 anim material
+frame vertex -1 texture
+material 1.0 texture
+frame
+1.0 anim texture 0.500000
+bone frame =
+vertex
+anim frame = -1 frame material
+frame = anim
+-1
+0.500000 bone anim vertex
+frame -1 texture
+bone
+0.500000 material anim frame anim
+vertex vertex -1 -1 material bone 0.500000 0.500000 vertex
+=
+anim anim anim frame frame 1.0 -1
+bone -1 material 0.500000 1.0 0.500000 anim
+vertex frame frame anim
+vertex -1
+1.0 material material frame 1.0 vertex = -1
+1.0 material frame material = bone frame 0.500000 =
+anim vertex
+vertex
+-1 vertex
+0.500000
+vertex -1 0.500000 vertex =
+1.0 =
+frame = frame
+texture bone
+vertex anim = 1.0 anim = anim
+frame texture bone
+frame vertex frame frame -1 anim 1.0 texture anim -1 anim
+-1 vertex
+0.500000 = 0.500000
+material anim anim bone frame bone anim anim frame frame 1.0
+vertex texture -1 -1 bone 1.0 texture 0.500000 1.0
+texture =
+anim
+anim
+frame 1.0 texture = frame
+texture = anim
+texture frame -1 bone
+material texture
+frame
+1.0 -1 =
+frame frame texture anim 0.500000 = vertex
+material
+-1 frame =
+= 1.0 texture vertex texture bone
+0.500000
+= =
+anim
+-1
+1.0 texture texture -1 vertex = 1.0 vertex
+frame
+0.500000 frame vertex 1.0 bone
+frame vertex bone anim
+anim -1 1.0 material 1.0 vertex
+anim
+vertex -1 frame bone texture 1.0
+material texture texture material material -1 -1 frame texture 0.500000 anim 1.0
+material texture material 1.0 -1 anim -1 anim
+vertex bone frame 1.0
+0.500000 material
+1.0
+texture material 1.0 vertex frame -1 vertex vertex anim 0.500000 anim anim bone -1 = texture vertex
+-1 -1 bone -1
+material vertex material anim texture
+material
+anim frame
+vertex bone frame frame material
+anim = -1
+texture = = texture frame
+= -1 frame anim
+frame
+-1
+-1 anim texture anim = vertex
+bone material
+-1 texture 1.0
+0.500000 -1 =
+0.500000 -1 0.500000 = material = material 0.500000 =
+material = texture 0.500000
+vertex vertex
+=
+anim =
+texture
+vertex vertex = 1.0 vertex material material
+bone
+vertex bone
+material -1
+vertex vertex vertex frame
+vertex vertex
+1.0 frame = 0.500000 1.0
+frame
+anim material material 1.0
+anim
+vertex texture material -1
+texture anim bone
+frame
+frame =
+vertex 1.0 frame
+1.0
+anim bone = bone material bone anim vertex anim vertex texture vertex
+texture = 1.0 material anim 0.500000 bone frame frame
+material material texture = 1.0
+-1 = anim frame = 1.0 frame texture 0.500000 -1 bone bone
+= texture
+frame 0.500000
+frame 1.0 -1
+0.500000 = material 0.500000 1.0 vertex frame -1
+= material frame texture frame frame -1 texture anim
+vertex texture 1.0 =
+0.500000
+texture
+-1 -1
+texture vertex frame frame -1 -1 texture = material -1 material
+anim
+1.0 material 1.0 -1
+frame
+0.500000 frame frame material vertex
+material
+frame texture 1.0 vertex material anim
+vertex frame = bone -1 bone vertex anim -1 bone anim 0.500000 0.500000 material
+bone -1 texture
+material -1
+anim texture material
+texture
+bone vertex
+-1 -1 anim
+anim = texture anim 1.0 bone -1 -1 = anim
+= =
+bone anim
+vertex anim
+texture 0.500000 bone 0.500000 texture = bone
+-1 material anim
+0.500000 anim
+= frame 1.0 bone bone =
+vertex frame 1.0 bone -1
+frame 0.500000 texture material frame texture frame vertex
+= material anim = 1.0 material -1 anim bone bone
+frame
+-1
+bone frame frame
+-1 1.0 bone anim material material material 1.0 1.0 -1 -1 -1 0.500000 -1 material -1 texture -1
+1.0 bone = -1 1.0 frame bone
+1.0 bone frame texture 1.0 frame anim
+1.0 anim
+= material = texture -1 vertex 1.0
+= -1 = vertex texture frame
+1.0 frame
+material 1.0
+bone 0.500000 anim anim 0.500000 texture
+1.0 bone anim
+0.500000 -1 vertex
+vertex anim
+= = -1 material anim anim 0.500000 = = bone -1 anim bone material 0.500000 texture frame
+1.0 0.500000
+material frame
+bone bone
+vertex vertex -1 texture
+texture 0.500000 1.0 -1 frame -1 frame anim
+-1 material
+frame
+1.0 -1 0.500000
+0.500000 bone anim
+=
+vertex
+vertex -1 -1 -1 bone = vertex vertex material 0.500000 0.500000 -1
+bone 1.0 -1 material 0.500000 bone 1.0 = texture
+texture 1.0 frame texture texture bone
+= -1 -1 bone anim
+0.500000 vertex = frame texture bone frame bone vertex anim 1.0 = material frame
+frame texture 1.0 material 0.500000 -1 material
+anim
+frame frame material frame
+= -1 frame
+vertex frame vertex 1.0 1.0
+anim material -1 1.0 = texture vertex anim 1.0 anim vertex bone
+1.0 bone anim -1
+anim
+vertex
+0.500000 frame
+texture anim frame texture -1 anim vertex
+bone -1 1.0
+frame anim 1.0 -1 0.500000 frame
+frame = frame 0.500000
+0.500000 material material material = 1.0 = 0.500000
+bone
+anim
+bone anim frame = vertex
+texture -1
+texture frame -1
+1.0 frame
+texture 1.0 frame anim frame texture
+1.0 0.500000
+= -1 vertex anim
+0.500000 frame texture bone
+material =
+1.0 texture
+anim material texture -1 material anim vertex texture
+anim
+-1 0.500000 = 0.500000
+vertex texture 1.0 0.500000
+= bone bone texture
+material texture texture
+bone
+tex
\ No newline at end of file
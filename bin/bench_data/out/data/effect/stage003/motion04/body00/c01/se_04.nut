@@ -0,0 +1,81 @@
+0.500000
+=
+-1 frame material = vertex 1.0 anim vertex
+anim texture -1 =
+frame material 0.500000 vertex
+0.500000 -1
+0.500000 material
+texture 0.500000 vertex material
+frame anim 0.500000
+texture =
+0.500000 frame = 0.500000
+1.0 material bone texture
+frame texture = bone
+-1
+frame
+0.500000 frame -1 anim = frame 0.500000 1.0 anim texture 1.0 1.0
+material vertex
+= bone vertex
+-1
+1.0
+material
+0.500000 anim
+material anim -1
+vertex material anim =
+frame material vertex
+= bone frame material = frame
+anim =
+anim anim vertex = texture
+1.0
+anim = frame vertex material 0.500000
+vertex 0.500000
+anim = frame 0.500000 -1
+-1 anim bone -1 material
+material
+material
+anim
+-1 anim frame
+frame vertex vertex = frame 1.0 vertex frame
+texture material frame
+-1 0.500000 1.0 0.500000 material =
+texture
+1.0
+= bone = 1.0 material
+0.500000 material -1 0.500000 0.500000
+-1 -1 -1
+texture vertex texture
+bone
+bone anim
+texture 1.0 -1 bone 1.0 -1 -1 anim -1 0.500000
+texture anim
+frame -1 material 1.0 vertex
+frame texture 1.0 vertex vertex
+texture
+0.500000 anim =
+1.0 frame anim frame 0.500000 texture vertex frame anim
+frame
+1.0 =
+vertex
+=
+vertex
+bone = bone material material material 0.500000 anim
+vertex vertex material bone = material
+vertex = = vertex 0.500000
+-1
+texture 0.500000 material 0.500000 1.0 0.500000 anim
+anim
+bone
+1.0 bone -1 1.0 texture frame anim
+anim 0.500000
+0.500000
+frame anim vertex = = vertex
+material frame
+-1
+0.500000 -1
+0.500000
+material 0.500000 bone material texture 1.0 anim bone
+= material frame material bone
+1.0 0.500000
+-1
+anim =
+= material anim = frame 1.0 1.0 1.0 verte
\ No newline at end of file
@@ -0,0 +1,6 @@
+1.0
+-1 bone anim material material bone -1
+= frame -1 -1 1.0 vertex vertex =
+1.0 material 0.500000 0.500000
+vertex bone frame material 0.500000 frame
+= bone 1.0 texture bo
\ No newline at end of file
@@ -0,0 +1,305 @@
+anim
+= frame vertex 0.500000 vertex
+material = = -1 -1 material 0.500000 1.0 1.0
+bone 1.0 frame vertex texture
+anim bone vertex vertex anim anim
+1.0 texture anim
+1.0 frame
+vertex
+0.500000 1.0 1.0 bone texture bone bone frame bone vertex vertex vertex frame
+=
+frame 0.500000 = =
+frame texture = bone frame bone anim
+frame texture 0.500000 anim
+=
+bone bone
+bone frame
+frame 0.500000
+1.0 0.500000
+=
+1.0
+bone = = material vertex -1 anim
+vertex
+= texture
+1.0 material vertex texture material
+vertex frame -1
+bone vertex bone
+vertex 1.0 anim -1 bone = frame texture
+1.0 -1 frame texture material -1 anim 0.500000 material
+anim -1 material 1.0 vertex 1.0 vertex -1 = vertex = 0.500000
+anim = texture = 1.0 1.0 = texture
+frame vertex
+frame = anim bone frame anim material = anim = frame texture
+texture frame -1 = material 0.500000
+anim
+= bone
+= -1 -1
+bone
+bone 1.0 vertex 1.0
+bone anim -1 bone -1 frame
+material 1.0 -1 1.0 bone material material vertex = -1 frame
+1.0 1.0 -1 1.0 bone frame 0.500000 frame 1.0
+anim material texture anim -1
+0.500000
+1.0 =
+bone
+material texture 0.500000
+vertex anim
+anim material 1.0 anim material
+-1
+material -1 frame 1.0 anim 1.0
+1.0 = vertex
+vertex vertex
+=
+1.0 anim -1
+bone texture
+frame
+0.500000 0.500000 material material
+frame
+frame texture anim 1.0 anim 0.500000
+= bone
+anim vertex 1.0 vertex 0.500000 material frame
+vertex
+vertex anim texture = material bone anim bone vertex = 1.0
+material
+frame vertex vertex = material = 1.0 bone bone
+vertex
+-1 1.0 material
+anim material 0.500000 bone =
+texture bone = bone frame vertex material = bone anim material 1.0 anim 0.500000 texture
+0.500000 1.0 anim material
+bone
+texture texture
+frame
+bone bone -1
+anim = -1
+1.0 frame = vertex =
+anim texture
+vertex texture vertex bone 1.0 = -1 material anim 1.0 material frame frame frame vertex material bone 0.500000 -1 texture texture
+frame -1 material
+frame anim bone vertex 1.0 frame frame
+texture anim 1.0 -1 vertex =
+= bone -1 vertex frame -1 1.0 anim
+frame 1.0 0.500000 vertex texture vertex = bone texture anim texture 1.0
+vertex texture 1.0 1.0
+material
+anim
+0.500000 0.500000
+texture
+material texture vertex anim
+bone =
+frame
+-1 frame 1.0
+material bone
+-1
+-1 material frame = anim
+texture 1.0
+1.0
+vertex texture 0.500000
+1.0
+anim frame
+texture = bone material =
+-1 bone frame
+vertex anim 1.0 frame texture
+= = material 0.500000
+= =
+anim = bone
+0.500000
+bone -1
+anim 1.0
+vertex -1 bone frame =
+0.500000 texture = bone anim
+0.500000 0.500000
+vertex texture anim 0.500000 0.500000 material
+bone
+anim
+anim
+texture bone anim frame anim -1 material texture texture texture
+1.0 0.500000
+anim vertex
+-1 1.0
+frame
+texture = 0.500000 -1 frame = 1.0 vertex 1.0
+frame anim = 1.0 1.0 vertex -1 texture 0.500000 anim material bone 1.0 = anim frame
+frame bone
+vertex bone
+texture
+material bone 0.500000 anim frame
+0.500000 material vertex vertex -1 texture =
+material bone vertex
+frame -1 = 1.0 texture frame -1
+vertex anim anim 0.500000 -1
+vertex bone texture anim vertex
+0.500000 frame material bone frame anim texture
+1.0 -1 bone anim vertex 0.500000 bone anim
+frame anim 0.500000 -1 anim frame -1 1.0 bone 1.0
+0.500000 vertex
+0.500000 material
+anim
+0.500000
+frame texture material
+bone vertex
+1.0 frame material texture = material vertex 0.500000
+frame 0.500000 1.0
+1.0
+-1 material
+material
+frame =
+texture material
+= 0.500000 anim
+texture
+vertex anim anim bone
+0.500000 1.0
+texture 1.0
+= 1.0
+material material = bone bone
+frame =
+anim = 1.0 texture -1
+0.500000 0.500000 vertex 0.500000 vertex texture
+1.0 0.500000 1.0 = texture frame
+anim
+anim 0.500000
+frame material anim 0.500000 vertex vertex
+frame bone
+-1 = texture
+vertex
+frame
+frame texture 0.500000 bone 0.500000 material vertex material
+frame 1.0
+0.500000 vertex 0.500000 material 0.500000 material anim vertex 0.500000 vertex
+bone
+= texture
+texture anim
+material 1.0 anim material
+material -1 texture anim -1 0.500000 anim 1.0 -1 vertex 0.500000 frame 1.0 anim -1 1.0 bone -1
+texture -1 = vertex vertex material = -1 vertex
+-1 material frame material -1
+anim vertex
+bone material bone 1.0 texture 0.500000 0.500000
+material vertex 0.500000 vertex vertex
+texture 1.0
+0.500000 0.500000 frame
+vertex
+vertex frame texture -1
+1.0
+-1 frame
+anim frame 0.500000 anim bone 1.0 = bone
+texture material 0.500000 vertex
+material vertex texture frame = -1 frame anim -1 -1
+anim bone 1.0 bone 0.500000 1.0 texture
+-1
+frame material
+frame vertex vertex
+-1 = vertex vertex
+-1 bone
+-1 material frame = anim bone
+1.0 anim material 0.500000 material 0.500000 1.0
+0.500000 vertex bone material
+anim = vertex 1.0
+= texture
+bone = material
+material
+texture
+texture material
+anim -1
+texture
+0.500000 bone 1.0
+vertex -1 -1 material -1 = -1
+1.0 texture
+vertex anim
+texture 0.500000 frame vertex texture = texture
+texture 1.0 1.0 1.0 0.500000 vertex 1.0 0.500000 bone 1.0 1.0 texture anim material texture material
+frame
+-1 frame 1.0 frame material 1.0
+material texture
+material
+bone bone material frame
+-1 bone =
+= bone frame texture bone
+1.0
+1.0 material vertex 0.500000 bone
+material
+=
+texture 1.0 texture
+texture anim texture material frame frame =
+anim -1 anim 0.500000 frame anim vertex vertex bone anim 1.0 = bone material anim frame material
+1.0 texture material vertex texture material anim 1.0 bone
+texture
+vertex
+material
+-1 texture frame 1.0 bone material =
+anim
+material vertex
+material -1 frame anim
+bone material vertex material = material
+bone material
+anim -1 material material frame
+= frame -1 frame
+vertex texture 0.500000
+vertex frame
+bone
+0.500000
+frame vertex
+-1 = frame -1 = material vertex 0.500000
+texture vertex 1.0 = texture vertex 1.0 material 1.0
+= bone bone bone anim
+-1 = material bone bone
+bone = texture = frame
+= frame
+-1 frame material
+vertex 1.0
+bone -1
+bone 1.0 frame 1.0
+bone
+0.500000
+texture bone 1.0
+texture
+frame
+1.0
+frame anim material 0.500000
+anim
+anim = vertex 1.0 = 0.500000 frame texture material bone bone
+material texture bone anim 1.0 =
+-1 material texture = vertex bone 1.0 texture texture 0.500000 1.0 frame 1.0
+1.0 vertex 0.500000 0.500000 vertex texture
+vertex 0.500000
+1.0 vertex anim
+anim bone
+vertex
+1.0
+material
+bone frame bone material
+-1
+1.0 material
+anim
+texture
+material
+-1 vertex 1.0
+0.500000
+-1 anim bone anim 0.500000 texture
+0.500000 material anim vertex bone =
+-1
+1.0 bone
+bone
+1.0
+= bone =
+= vertex
+0.500000 vertex
+0.500000 1.0
+vertex texture =
+-1 -1 frame frame vertex = frame
+vertex 0.500000 1.0
+anim
+= material texture 1.0 bone
+=
+texture -1 anim 0.500000 texture material material frame frame bone
+-1 0.500000 texture material -1 texture vertex
+1.0 1.0 material -1 frame anim
+material frame -1
+1.0 material texture vertex -1 vertex 0.500000 1.0 material
+bone material bone anim material material frame
+vertex frame
+= frame 0.500000 -1
+texture anim = bone
+bone 1.0
+materia
\ No newline at end of file
@@ -0,0 +1,163 @@
+0.500000
+1.0 1.0 -1 -1 vertex frame 1.0 0.500000 vertex material
+frame texture 1.0 vertex frame vertex
+frame = frame -1
+texture anim material anim =
+texture
+texture vertex
+texture
+vertex -1 1.0 material 0.500000 frame
+1.0 anim -1 1.0 material -1 0.500000
+anim bone -1 vertex 0.500000 anim bone = -1 material texture anim -1 frame -1 vertex vertex =
+1.0
+-1
+1.0
+material material
+material 1.0 material anim material = vertex anim
+vertex
+bone material
+anim material vertex -1
+texture texture texture
+texture material = bone material vertex material
+bone 1.0 frame = 0.500000
+bone frame 1.0 vertex
+vertex anim 1.0 -1 -1 anim -1 texture bone bone material
+1.0 anim texture texture 0.500000 -1
+=
+frame bone -1 material -1 frame 0.500000 material 1.0 anim 0.500000
+anim anim
+= bone
+0.500000
+1.0 -1
+anim
+frame
+frame 0.500000 bone
+1.0 vertex frame anim
+material 0.500000 texture material frame texture
+anim
+1.0 material = anim = anim 1.0
+frame bone
+bone vertex frame
+vertex texture
+material material
+anim = bone
+0.500000
+-1 0.500000 0.500000 texture texture 0.500000
+material
+vertex -1 material bone frame material texture
+-1
+-1 texture
+anim
+texture
+vertex -1
+texture = frame
+=
+anim 1.0 = anim
+anim
+= 1.0 bone bone frame =
+vertex -1
+anim
+bone
+=
+= 1.0
+vertex frame texture
+anim anim
+vertex anim -1 0.500000 anim = = material vertex texture
+frame 0.500000 material
+anim 1.0 vertex texture 0.500000 1.0
+vertex = -1
+=
+material -1 bone 0.500000 -1 -1
+bone -1
+texture anim material bone texture 0.500000
+vertex material material anim = frame =
+frame
+material
+vertex anim material material texture
+0.500000
+texture material texture
+frame material 0.500000
+= 0.500000 frame = = 1.0 0.500000 vertex 0.500000 material 1.0 0.500000 1.0 anim texture =
+material bone
+vertex material vertex =
+texture 1.0 bone
+-1 anim 0.500000 vertex frame vertex frame =
+0.500000 bone
+0.500000 texture frame frame 0.500000
+vertex 0.500000 1.0 material =
+1.0 texture texture bone 0.500000 frame
+material
+vertex
+1.0 -1 0.500000 texture material anim -1 = texture frame 0.500000 1.0 frame
+vertex 0.500000 frame -1 vertex -1 0.500000 bone anim 1.0 -1 anim 1.0 1.0 = bone anim
+anim
+0.500000 0.500000
+0.500000 1.0 material
+anim 0.500000 = frame 1.0 frame vertex material bone bone vertex vertex =
+1.0 texture texture
+bone
+= texture = -1 -1 0.500000 1.0
+texture 0.500000 texture
+material 0.500000 texture
+texture material 1.0 material 1.0 frame -1 material material frame 0.500000
+1.0 frame material = -1 1.0
+material =
+bone frame material
+=
+bone anim
+vertex
+1.0 bone -1
+frame = bone
+0.500000 vertex vertex frame
+bone texture 0.500000 bone = texture vertex
+0.500000 material frame anim 1.0
+-1 = -1 0.500000 material 0.500000
+material 1.0
+1.0 texture bone
+texture
+1.0 frame frame
+frame
+texture vertex
+material = 0.500000
+1.0
+= 0.500000
+frame
+anim
+material material vertex =
+anim 0.500000
+material material 1.0
+-1 frame anim texture
+= -1 vertex
+vertex
+1.0
+frame = vertex bone 0.500000 1.0 frame frame -1
+-1 anim 1.0 vertex 0.500000 0.500000 vertex = 1.0
+0.500000 = 1.0 material
+texture
+material frame -1 1.0
+texture 0.500000 1.0
+frame material
+vertex vertex
+frame
+vertex 1.0 = frame anim
+0.500000 vertex = texture
+1.0 vertex = frame frame 1.0 0.500000 1.0 = = vertex 0.500000 = texture =
+0.500000
+anim 1.0 vertex
+texture -1
+material =
+anim 0.500000
+texture anim 1.0 material
+1.0 1.0
+texture 0.500000 material vertex -1
+vertex material bone material texture bone 0.500000 anim =
+bone texture
+frame vertex texture anim vertex
+-1
+bone bone anim anim material anim material -1 -1 0.500000 vertex
+0.500000 0.500000 frame
+bone vertex frame
+material
+frame 1.0 vertex
+0.500000
+texture -1 1.0 material frame 0
\ No newline at end of file
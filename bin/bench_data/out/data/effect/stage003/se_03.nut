@@ -0,0 +1,36 @@
+vertex
+frame 0.500000
+=
+-1 vertex 1.0 bone vertex
+-1 texture =
+anim
+-1 vertex 0.500000 texture -1 vertex frame 0.500000 frame = -1
+1.0 vertex = frame
+= -1 bone material material = bone material frame anim
+texture anim bone texture
+anim 1.0 0.500000 bone material 0.500000 bone
+vertex texture 0.500000
+1.0 1.0 anim bone anim bone texture
+-1 frame frame = 0.500000 0.500000 texture anim = anim -1 1.0
+frame texture material
+=
+anim 1.0 material bone bone 1.0 texture 1.0 texture texture
+texture -1 -1 material anim 1.0 -1 = -1 bone texture
+material 0.500000 vertex
+-1 0.500000
+= -1 vertex
+vertex texture -1 material
+bone
+vertex frame 1.0 material material texture
+= vertex bone material frame
+frame
+-1
+material
+bone anim 1.0
+-1
+= vertex bone 1.0 1.0 texture material material 0.500000 material
+bone material
+texture frame
+vertex
+0.500000 anim frame bone
+frame = bone 0.500000 
\ No newline at end of file
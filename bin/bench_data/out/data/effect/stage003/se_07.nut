@@ -0,0 +1,134 @@
+material frame
+= bone
+material
+1.0
+material
+frame texture material texture 1.0 bone texture
+texture anim anim material frame bone texture
+bone
+bone 1.0 frame frame = -1
+=
+=
+texture anim
+texture 1.0 texture
+1.0 -1 0.500000
+material frame
+= -1
+-1
+vertex vertex
+vertex
+anim
+texture texture
+=
+vertex bone = frame frame 1.0 material = = texture material material 0.500000 material
+material 0.500000
+anim bone vertex anim bone
+-1 material 1.0 anim frame bone material 0.500000 frame material =
+1.0 1.0
+texture vertex frame 0.500000 1.0 vertex frame
+= bone vertex texture
+texture texture -1 frame = vertex = anim 1.0 material -1 1.0 bone = bone vertex 0.500000 material material
+bone material vertex -1
+-1 0.500000
+frame anim
+1.0 = = texture texture -1
+0.500000 material 1.0 0.500000 vertex =
+-1 1.0
+= 1.0 frame 0.500000 vertex -1 -1 -1 = anim anim
+1.0 anim 0.500000 material texture 1.0 = anim material anim
+frame material = bone 1.0 anim -1
+frame vertex material frame -1 vertex frame anim anim 1.0
+1.0 bone
+0.500000 material -1 0.500000 vertex 0.500000 material vertex 1.0 = frame
+-1 =
+0.500000 1.0
+anim =
+bone =
+0.500000 -1
+anim material anim bone bone 1.0 = anim 0.500000
+material
+1.0 1.0 vertex bone
+texture vertex 1.0 bone texture
+frame
+-1 = anim texture anim =
+vertex
+bone texture 1.0
+= texture = anim frame -1 bone frame
+frame
+bone texture 1.0 vertex
+0.500000 -1 1.0 texture frame
+-1 bone frame anim
+texture
+anim -1 -1 bone
+frame vertex texture frame 1.0 1.0
+1.0 0.500000 1.0 = = 0.500000 anim anim bone texture vertex bone -1 bone frame frame vertex = -1 -1 texture
+vertex vertex 1.0
+1.0
+frame anim 1.0 material texture
+0.500000 bone vertex texture material
+-1
+-1 anim frame 1.0 texture = frame 0.500000 texture frame vertex texture = = 0.500000
+texture anim 1.0 bone -1 bone bone
+material
+1.0
+anim bone material bone
+= 0.500000 frame material frame
+vertex material
+-1 -1 0.500000 -1 bone
+1.0
+frame texture bone 0.500000
+bone
+vertex = 1.0 -1 anim texture frame
+vertex -1
+1.0 = frame 0.500000 -1 -1 1.0 -1
+texture
+= texture anim -1 0.500000 frame -1 frame = bone
+frame 1.0 frame
+vertex
+anim frame
+frame -1
+bone 0.500000 = vertex
+0.500000
+= -1 = bone 1.0 1.0 -1 anim anim frame 0.500000 material 0.500000 1.0 vertex 0.500000 anim texture
+-1 anim texture -1 texture 1.0 0.500000 = bone texture vertex -1 0.500000 anim material anim -1
+bone anim material texture =
+0.500000
+anim
+1.0 frame 0.500000 frame material frame vertex
+-1 material bone -1 = material = 0.500000 frame material =
+bone = 1.0
+1.0
+-1
+-1 0.500000 =
+material = bone 1.0
+0.500000 anim texture 0.500000 vertex material
+1.0
+frame texture texture 1.0
+frame
+texture -1
+material
+-1
+frame 1.0
+0.500000 bone
+=
+material
+=
+anim vertex texture 1.0 anim -1 texture material vertex
+anim 1.0
+texture material anim
+1.0 anim = = bone 1.0 1.0 -1 -1 -1 anim = texture texture texture bone 0.500000 = texture
+bone = anim
+anim bone
+bone -1 material 1.0 1.0
+= 0.500000
+anim anim 1.0 vertex vertex
+texture
+bone = = frame
+0.500000 -1
+bone
+frame = frame vertex = = = -1 = 0.500000 -1 = anim -1 0.500000
+texture 0.500000 -1
+material 1.0
+frame material material frame -1
+anim bone
+text
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 frame = 0.500000 vertex
+vertex
+1.
\ No newline at end of file
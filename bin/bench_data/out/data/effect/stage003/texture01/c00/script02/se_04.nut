@@ -0,0 +1,20 @@
+frame material
+vertex anim bone
+=
+texture -1 texture texture
+1.0
+1.0 material texture = 1.0 anim
+frame material texture
+= material bone 1.0 0.500000 1.0 frame anim
+= -1 frame texture vertex vertex material 0.500000
+= 0.500000
+material = vertex
+texture texture 1.0 -1
+texture material 1.0 -1 texture frame bone -1 texture
+1.0 -1 = 0.500000 -1 -1
+material anim 1.0 = 1.0 0.500000 vertex -1 texture frame bone texture -1 texture bone material
+material frame
+frame vertex 1.0
+frame
+-1
+texture -1 texture
\ No newline at end of file
@@ -0,0 +1,72 @@
+1.0 -1
+bone 1.0 anim
+material bone vertex texture vertex = anim texture
+= = -1 1.0 frame -1 -1
+frame =
+material frame bone -1
+frame =
+frame 1.0 -1 frame
+bone
+1.0 frame =
+vertex anim frame bone anim
+vertex
+anim texture
+0.500000 1.0 frame
+1.0 anim 1.0 anim =
+-1 1.0 texture vertex vertex
+anim = material vertex vertex material vertex -1 bone 1.0 anim texture
+1.0 -1 0.500000 frame bone
+vertex
+texture frame
+material vertex bone 0.500000
+0.500000 vertex material material material vertex vertex
+-1 anim frame bone
+1.0
+frame bone vertex material 1.0
+-1
+vertex vertex
+bone
+frame
+frame 1.0 texture anim material
+0.500000 frame 0.500000 texture texture vertex bone material
+1.0
+anim bone = vertex 1.0 1.0 texture
+anim -1
+material -1 0.500000
+frame bone -1 bone material vertex anim vertex
+-1 frame -1 anim 0.500000 vertex
+=
+-1
+frame anim -1 anim bone = frame
+anim bone
+0.500000 texture bone 1.0 frame = 0.500000 texture 0.500000 texture material = bone bone
+bone 1.0 0.500000 anim anim 1.0
+bone frame texture
+vertex material
+1.0 anim vertex 1.0
+= =
+frame
+0.500000 =
+0.500000 anim 0.500000 bone anim -1 0.500000 material texture
+1.0 frame bone
+material vertex vertex material = -1
+material bone -1
+bone
+frame 0.500000 1.0 1.0 vertex
+-1
+texture bone
+-1 texture
+0.500000 -1
+frame texture 1.0 1.0 -1 frame = 1.0 bone 1.0 0.500000 =
+frame material
+anim
+material vertex vertex 1.0 texture vertex -1
+1.0 =
+frame texture 1.0 vertex -1
+0.500000
+material -1
+0.500000 0.500000 anim frame = texture 1.0
+= -1 frame -1 texture 1.0
+anim
+1.0 0.500000 frame -1 -1 bone = -1 material
+m
\ No newline at end of file
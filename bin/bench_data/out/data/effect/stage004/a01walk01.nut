@@ -0,0 +1,20 @@
+frame bone 1.0 bone 0.500000 =
+bone material bone frame texture texture
+1.0 0.500000 frame material material
+1.0
+vertex
+=
+bone material texture vertex
+= -1 frame
+1.0 frame -1 1.0 bone
+material -1 anim texture texture -1 vertex material
+vertex =
+anim material vertex bone bone
+1.0 -1 material anim = frame 0.500000
+-1 -1 -1 vertex
+0.500000 anim 1.0 frame bone bone texture 1.0 -1
+=
+texture frame
+0.500000 bone 0.500000 -1 = bone
+0.500000 texture bone frame
+= bone -1 1.0 frame material 1.
\ No newline at end of file
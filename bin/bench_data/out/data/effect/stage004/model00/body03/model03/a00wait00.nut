@@ -0,0 +1,14 @@
+1.0 1.0 -1 anim bone
+1.0 vertex 0.500000 -1 anim =
+texture material anim -1 1.0 texture
+bone bone material
+texture bone
+texture =
+1.0 texture
+frame
+material
+0.500000 anim vertex
+anim bone
+texture bone
+=
+ani
\ No newline at end of file
@@ -0,0 +1,33 @@
+1.0
+vertex 0.500000 material anim
+0.500000 -1 material = material material vertex material =
+material anim anim 0.500000 vertex 0.500000 texture
+material
+-1
+vertex texture
+texture 1.0 -1 anim -1 anim frame bone bone
+= anim 1.0 texture bone material -1 = frame
+=
+material =
+= bone texture
+0.500000 1.0 vertex 1.0 -1 texture 0.500000 0.500000 anim vertex 1.0 1.0 texture 0.500000 frame vertex -1 bone vertex bone anim
+material
+frame anim
+material 1.0 vertex -1
+vertex
+anim vertex anim bone frame -1
+material vertex -1 -1
+vertex bone texture -1 0.500000 -1 1.0 frame anim bone vertex vertex
+anim
+anim vertex
+-1 bone frame = frame vertex 0.500000 vertex 0.500000 material 1.0 0.500000 -1
+1.0 1.0 1.0 frame
+anim frame 0.500000 bone anim texture -1 material 0.500000 vertex frame frame
+anim anim anim bone vertex
+0.500000 1.0 vertex vertex
+= -1
+anim 1.0 vertex
+material
+1.0 vertex = anim
+anim material material vertex bone
+0.500000 -1 = texture -1 -1 
\ No newline at end of file
@@ -0,0 +1,277 @@
+anim 0.500000 bone frame -1 vertex
+0.500000 anim
+0.500000 1.0 material texture 1.0 frame frame anim
+1.0
+= frame 0.500000
+0.500000 -1 0.500000
+= material 0.500000
+frame texture material 1.0
+vertex
+anim
+material
+= texture texture anim 1.0 0.500000 = frame anim frame bone
+texture
+anim
+-1 anim material texture texture 0.500000 0.500000 -1 frame vertex 0.500000 anim
+0.500000
+anim material material anim -1 vertex = = frame
+1.0 texture bone
+= bone
+material
+= frame texture 1.0 = anim frame anim vertex anim = =
+= frame 1.0
+vertex material frame
+vertex texture -1 -1 bone 1.0 bone
+material bone
+texture -1 1.0 -1 anim -1
+texture
+texture 0.500000
+bone
+1.0
+-1 = texture anim 0.500000
+bone
+1.0 bone
+= anim material vertex bone bone anim anim
+anim -1
+1.0 anim 0.500000 texture anim 0.500000 anim 0.500000 vertex vertex 0.500000
+1.0 -1 material
+texture 1.0 frame anim
+=
+vertex frame = 1.0
+= vertex 1.0 frame frame vertex frame 0.500000 = 1.0 1.0 = anim bone 1.0
+-1 frame 0.500000 material = bone
+material -1
+0.500000 vertex texture texture vertex 1.0 vertex anim
+texture
+texture texture 1.0 material bone
+-1 frame 0.500000 texture
+0.500000
+= anim bone 0.500000 0.500000 1.0 anim material frame -1 -1
+anim = 1.0
+anim
+bone anim 1.0 1.0
+vertex -1 1.0 0.500000 = -1
+bone anim vertex
+texture vertex vertex bone -1 material 1.0 1.0 =
+vertex bone texture
+0.500000 anim
+material material vertex frame
+bone texture vertex anim
+-1 material -1 0.500000
+texture vertex bone =
+anim vertex
+=
+0.500000 vertex anim material texture
+anim = 0.500000
+1.0 frame = bone
+= material material bone =
+vertex
+-1 vertex bone texture bone = -1
+-1
+1.0 texture = texture texture 1.0 -1 0.500000 bone anim anim
+= anim anim vertex anim anim = frame
+anim texture
+bone 0.500000 -1 0.500000 = bone texture frame vertex 1.0
+frame vertex
+material 1.0 1.0 anim -1 -1 frame 1.0 bone
+vertex 0.500000 anim
+=
+material texture
+0.500000 bone
+-1 =
+material
+-1 material
+anim
+= bone -1 bone frame -1 0.500000 -1 -1
+anim material 1.0
+anim
+1.0 vertex anim texture frame frame anim 0.500000 frame frame material = bone frame texture frame anim frame -1 0.500000
+material
+= 1.0 = texture bone bone
+texture material frame
+1.0 vertex =
+-1 anim bone = =
+frame material vertex
+anim
+material frame
+texture -1 vertex bone -1
+texture
+-1 1.0 0.500000 material
+material -1 0.500000 anim 0.500000 -1 frame = 0.500000
+-1 anim
+0.500000 anim frame frame texture -1
+frame -1 material 1.0 bone material
+bone =
+vertex
+material = bone 1.0 1.0
+0.500000
+-1 0.500000
+frame
+= frame vertex = frame material texture texture 0.500000
+1.0 vertex bone frame
+frame vertex
+material
+frame 1.0 anim 0.500000
+bone 0.500000
+texture material 1.0 frame texture texture frame
+-1 vertex
+frame 0.500000 vertex 0.500000
+material -1 frame
+frame 1.0 frame
+0.500000 material
+1.0 -1 bone texture texture
+material
+frame 1.0 vertex frame
+-1
+-1
+1.0
+frame 0.500000
+texture
+-1 anim
+-1
+-1 0.500000 -1
+anim texture = =
+-1
+texture
+material 0.500000 = = anim material
+material 0.500000 1.0 frame texture frame
+frame 0.500000 bone 0.500000
+texture texture
+material 0.500000 frame -1 texture
+anim -1 0.500000 texture
+0.500000 frame material = material
+frame bone vertex 0.500000 1.0 =
+= vertex vertex
+material -1 0.500000
+frame
+vertex vertex
+frame -1 bone 0.500000 = 0.500000
+1.0 material vertex frame 1.0 vertex
+vertex
+material frame
+texture = anim
+bone 1.0 -1 material
+material texture texture 1.0 -1 = frame vertex bone bone material -1 anim = texture 1.0 -1 frame
+0.500000 frame 0.500000 0.500000 1.0 texture = frame material bone 1.0 0.500000 material -1 texture material
+anim = frame
+-1
+1.0 anim
+= 1.0
+frame material = = = texture 1.0 material anim 1.0 texture -1
+frame vertex frame anim 1.0 vertex 1.0 frame bone anim
+frame
+0.500000 = 0.500000 vertex
+material
+material material anim = vertex 1.0 -1 1.0 bone vertex = anim vertex 1.0 vertex = -1 bone -1
+texture
+vertex frame -1
+anim vertex 0.500000
+anim
+anim material vertex 1.0 0.500000 anim material vertex material anim
+0.500000
+vertex = 1.0 vertex
+bone -1
+0.500000 texture bone texture frame 0.500000 0.500000 material =
+= material
+texture
+anim
+anim -1 bone
+frame
+texture 0.500000 bone frame
+=
+-1 anim
+=
+texture
+anim vertex 0.500000 -1
+0.500000
+bone texture
+texture
+material vertex = texture 0.500000 0.500000 0.500000
+vertex bone frame material vertex bone texture vertex -1 -1 1.0 texture
+frame
+1.0 anim bone frame frame bone texture -1 material
+anim
+0.500000 texture vertex anim
+frame vertex bone -1 vertex
+vertex -1 vertex
+material -1 frame anim -1 texture -1 vertex texture 0.500000 -1 -1 = 1.0
+-1 1.0 = texture
+anim frame bone frame
+anim 1.0 -1 = bone =
+frame anim anim
+texture vertex anim anim
+vertex 0.500000 anim
+1.0
+material 0.500000 material anim texture
+0.500000 0.500000
+texture
+1.0 = frame frame
+material
+bone
+anim material bone vertex
+material vertex
+1.0 frame
+0.500000 bone texture
+bone 1.0 vertex vertex vertex vertex anim -1 anim bone -1 1.0 =
+vertex bone anim vertex 1.0
+vertex vertex
+anim bone material -1 0.500000 bone
+-1 =
+vertex frame
+-1 -1 vertex bone frame -1 -1 -1 = texture texture texture
+-1
+1.0 -1 vertex 1.0
+frame -1 bone anim 0.500000 = bone 1.0 texture texture bone material 1.0 1.0 -1 0.500000 =
+vertex = bone
+=
+bone material
+material
+bone 0.500000 vertex 1.0
+0.500000 bone 0.500000 material = texture material -1 bone
+0.500000 -1
+frame frame
+vertex
+frame material
+-1
+0.500000 vertex texture texture 0.500000 1.0
+= material
+0.500000
+anim frame 0.500000
+vertex -1 anim 1.0
+bone frame = texture frame
+material material frame 0.500000
+0.500000 frame vertex 0.500000
+0.500000 = = bone -1
+texture
+bone anim vertex bone bone anim frame = vertex 0.500000
+-1 = anim
+-1
+anim frame
+texture
+1.0
+frame
+vertex texture anim vertex 1.0 bone texture vertex material 1.0 vertex = 0.500000 1.0 1.0
+anim anim
+vertex texture 1.0
+material
+= -1
+texture texture 1.0 = material material 1.0 0.500000 vertex -1
+vertex
+0.500000
+material anim vertex vertex vertex = frame -1 vertex vertex -1 -1
+frame vertex
+0.500000
+0.500000
+bone
+0.500000 anim vertex 1.0 0.500000
+texture material material
+texture 1.0 -1
+material vertex material 1.0 1.0
+1.0 texture 0.500000
+-1 vertex material anim anim frame vertex material frame bone bone
+1.0 1.0 frame anim material 0.500000
+texture 1.0 1.0 texture
+material
+frame bone
+-1 vertex
+verte
\ No newline at end of file
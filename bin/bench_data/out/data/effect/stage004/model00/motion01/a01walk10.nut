@@ -0,0 +1,4 @@
+texture 1.0 bone =
+0.500000
+bone
+frame anim 1.0 bone vertex
\ No newline at end of file
@@ -0,0 +1,4 @@
+anim
+-1 -1 frame vertex bone vertex bone bone 1.0 frame
+vertex vertex
+-1 anim texture -1 0.5000
\ No newline at end of file
@@ -0,0 +1,3 @@
+frame -1
+1.0 bone texture texture -1
+vertex
@@ -0,0 +1,179 @@
+bone 0.500000
+vertex -1 anim
+0.500000 0.500000 0.500000 bone texture bone
+material = bone = frame -1
+vertex material material =
+anim
+0.500000
+vertex
+vertex 1.0 texture bone frame 0.500000 0.500000 frame vertex 0.500000 texture
+vertex = bone 1.0 0.500000
+vertex
+material frame
+anim = = anim vertex vertex -1 = material
+0.500000 material anim 0.500000 material material -1
+texture material = material
+vertex material
+1.0 bone
+vertex
+material =
+texture -1 material frame 0.500000 frame texture
+vertex 0.500000
+vertex material -1 texture 0.500000 material = = material anim vertex texture material vertex bone bone
+-1 1.0
+material = -1 texture
+0.500000 material material =
+material
+= 1.0 texture vertex texture 0.500000 texture material
+anim frame
+bone -1 texture frame anim bone
+material texture bone texture material frame
+vertex frame -1 =
+1.0 1.0 frame
+-1 vertex
+frame bone
+0.500000 0.500000
+material material bone -1 frame vertex
+material material vertex texture
+anim
+0.500000 texture bone material anim -1 bone
+0.500000
+= bone = = material vertex frame vertex anim material
+1.0 anim
+bone 1.0 0.500000 texture 0.500000 texture bone frame texture bone material
+anim material material
+0.500000 frame
+texture material -1 frame
+texture 0.500000
+texture texture bone texture vertex vertex 0.500000 frame
+0.500000 -1
+0.500000
+frame texture texture
+= 0.500000 1.0 frame
+frame
+=
+0.500000 material 1.0 frame
+1.0 texture vertex bone texture = vertex
+1.0 = texture 1.0
+1.0 material bone frame -1
+texture 0.500000 bone material vertex bone
+1.0 0.500000
+texture 1.0 1.0 frame vertex
+anim material frame material bone texture bone material bone
+1.0
+1.0 = vertex
+-1
+= -1
+= 1.0 texture texture 0.500000
+frame bone material 1.0 frame
+vertex texture texture material 1.0
+0.500000 vertex
+0.500000 bone
+texture 0.500000 material
+anim = 0.500000 material material bone material
+bone 1.0 0.500000
+anim
+material texture
+vertex material vertex
+1.0 = bone 1.0 0.500000 -1 texture 1.0
+1.0 material texture material 0.500000
+texture vertex
+vertex
+-1 0.500000 0.500000 0.500000 -1 frame frame frame texture anim 0.500000 -1 1.0 = material -1 vertex frame vertex vertex
+0.500000 frame texture 0.500000
+texture material frame
+bone 1.0 anim frame vertex
+= material
+frame
+anim frame
+texture bone -1 -1 vertex
+1.0 anim anim material texture
+vertex anim
+material 0.500000 frame anim 1.0
+material
+-1 1.0 bone
+0.500000 texture 0.500000
+vertex =
+1.0 1.0 vertex 1.0 -1 frame =
+anim
+-1 texture
+material 1.0 bone frame anim material 0.500000
+-1
+vertex texture 1.0 frame
+bone
+frame texture
+material
+1.0 =
+texture frame
+vertex bone
+-1 anim bone vertex material 1.0 1.0 vertex bone
+material
+-1 material -1 vertex
+=
+material texture
+bone 1.0 1.0 material anim = = 0.500000 bone
+vertex
+material
+texture 1.0 texture 0.500000
+0.500000 frame 0.500000 = anim frame frame anim = texture bone bone vertex anim anim
+1.0 -1 bone 1.0 anim
+material
+material 0.500000 1.0 frame
+anim -1 anim material
+-1
+vertex 0.500000 = 0.500000
+anim vertex
+-1 1.0 texture vertex frame material frame 0.500000 0.500000
+frame
+bone anim bone
+bone
+texture vertex anim
+anim = 1.0
+frame
+bone frame 0.500000 vertex texture texture
+-1 material 1.0 material -1 vertex 1.0 vertex material 1.0 -1 frame
+bone texture = = -1 = frame 1.0
+0.500000 1.0 anim 0.500000 0.500000 0.500000 bone 0.500000 anim anim 0.500000
+1.0
+texture material frame vertex bone 1.0
+1.0 material 0.500000 vertex
+material = = vertex material 0.500000
+texture = material vertex vertex texture texture
+texture texture
+vertex
+material 0.500000
+0.500000
+0.500000 = 1.0 anim material
+=
+0.500000 texture 0.500000
+material bone vertex anim = bone =
+0.500000 = 1.0 bone
+-1 material anim material texture
+0.500000 texture -1 bone = anim vertex -1
+bone -1 texture 1.0
+texture bone vertex
+anim vertex material
+= frame -1 0.500000 1.0 texture
+material 0.500000
+frame -1 vertex =
+frame texture -1
+1.0 vertex material material vertex anim vertex = -1 texture bone frame -1 texture 0.500000
+0.500000 frame
+anim
+texture bone bone bone
+material bone anim
+1.0 0.500000 0.500000 anim vertex -1
+0.500000 vertex
+1.0 1.0 1.0 frame = texture
+anim 1.0 -1 0.500000 vertex -1 material = anim =
+1.0
+material frame
+-1 -1
+1.0 anim
+vertex bone 0.500000
+material -1 =
+1.0 = -1
+anim = texture frame
+-1 texture texture 1.0
+0.500000
+-1 material bone anim
\ No newline at end of file
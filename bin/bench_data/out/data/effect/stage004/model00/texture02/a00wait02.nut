@@ -0,0 +1,9 @@
+=
+bone 1.0
+anim
+anim
+= bone anim
+texture texture
+anim
+-1 1.0
+-
\ No newline at end of file
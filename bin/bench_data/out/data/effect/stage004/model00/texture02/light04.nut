@@ -0,0 +1,3 @@
+anim 1.0 vertex anim
+-1 = -1 0.500000 frame 1.0 material anim 1.0 vertex =
+anim
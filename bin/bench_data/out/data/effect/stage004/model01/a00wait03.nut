@@ -0,0 +1,38 @@
+frame vertex vertex frame
+0.500000 0.500000 0.500000
+texture
+= vertex material material = = frame anim
+bone = vertex 0.500000 -1 vertex
+anim texture texture -1
+anim texture 1.0 texture frame
+vertex vertex vertex -1 anim
+-1 material
+=
+material
+frame frame frame frame =
+texture -1 vertex frame vertex frame bone bone anim
+anim vertex vertex
+1.0
+1.0 -1
+0.500000
+material
+= bone
+= bone vertex
+vertex 1.0 -1 1.0 anim texture anim 1.0 material
+material material
+anim frame 1.0 material material
+vertex texture
+material bone
+= 0.500000 -1 0.500000 bone 1.0
+1.0
+material
+anim -1 material
+1.0 texture = material texture frame frame = 1.0 = material material bone
+material = anim
+0.500000 1.0 1.0 0.500000 frame
+0.500000 bone
+1.0 frame frame = texture 1.0 vertex bone = -1
+anim
+material texture = =
+texture -1 anim texture
+1.0 anim
\ No newline at end of file
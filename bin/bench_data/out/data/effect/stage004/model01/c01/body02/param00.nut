@@ -0,0 +1,13 @@
+=
+0.500000
+0.500000 material frame material frame vertex 0.500000 frame frame 1.0
+= 1.0
+bone -1 material
+=
+= vertex material texture bone 0.500000 material bone anim bone =
+= material
+anim
+= bone 1.0 -1 = texture -1
+= anim
+-1 0.500000 bone = texture bone texture
+= 0.500000 frame anim vertex 0.500000
\ No newline at end of file
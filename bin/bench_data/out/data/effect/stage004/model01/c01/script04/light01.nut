@@ -0,0 +1,352 @@
+frame vertex material
+-1 1.0 -1 = texture vertex 1.0 frame
+1.0 material =
+-1
+anim anim
+anim vertex texture
+0.500000
+texture -1
+material texture -1
+texture anim bone
+= 0.500000 vertex vertex vertex
+-1 bone anim
+-1 bone
+vertex
+1.0
+1.0 -1 -1 -1 =
+bone bone
+0.500000 bone
+bone material
+anim frame material frame texture
+= bone
+anim
+vertex
+vertex
+0.500000
+texture
+0.500000 material
+frame frame -1
+texture texture bone
+vertex
+= 1.0 0.500000 texture material -1 bone 1.0 texture
+= bone
+-1 -1 -1
+frame
+material texture
+0.500000
+anim 0.500000
+bone material material material texture = anim texture 1.0 1.0
+0.500000 -1 material vertex bone texture 0.500000
+anim frame 0.500000 vertex anim anim anim = 0.500000
+-1 frame bone
+1.0 -1 = material
+bone vertex -1 vertex 0.500000 = = bone = material 0.500000 material 1.0 material
+1.0 0.500000
+1.0 material texture
+material
+-1 0.500000 texture 1.0
+frame vertex 1.0 0.500000 vertex
+texture = texture vertex vertex = texture bone anim vertex frame material 1.0 0.500000 -1
+bone vertex
+anim material
+material
+=
+0.500000 anim
+material frame frame
+1.0 1.0
+bone
+= 1.0 -1 anim -1 -1 bone bone
+material vertex -1 frame bone 0.500000 -1 -1 bone
+frame 1.0 texture
+-1
+vertex bone material
+texture frame anim -1 = = anim
+vertex frame
+0.500000 vertex -1 0.500000 frame 0.500000
+texture vertex bone frame 1.0
+bone 1.0 frame
+-1 vertex 1.0 frame material
+vertex texture = 0.500000 0.500000
+texture material material
+texture material material = 1.0
+0.500000 vertex material -1
+1.0
+texture bone bone
+= vertex
+=
+material -1 0.500000 bone frame bone
+0.500000 1.0 = texture 0.500000 -1 vertex 1.0
+= texture
+0.500000 frame 1.0
+anim 1.0 = bone anim 0.500000
+anim
+bone texture frame material = anim bone anim -1 material 0.500000 1.0 -1 = anim -1 texture anim material
+0.500000
+material 1.0 1.0 -1 bone vertex
+vertex frame vertex anim
+anim anim
+frame anim -1 anim anim -1 anim bone = 0.500000 anim 1.0 texture
+0.500000 0.500000
+bone texture 0.500000 texture texture texture frame
+0.500000
+vertex texture
+bone = vertex vertex = material
+-1 frame anim 1.0 anim frame
+0.500000 = bone frame vertex frame 1.0
+0.500000 anim frame material
+frame 0.500000
+0.500000 -1 bone = vertex bone anim
+0.500000 -1 vertex
+anim frame =
+-1
+0.500000 anim vertex
+= bone texture texture 0.500000 1.0 vertex material texture
+-1
+anim 1.0 = vertex bone material texture 1.0 1.0 -1 frame 1.0 =
+vertex 1.0 =
+texture -1 vertex vertex 0.500000 frame vertex 0.500000 vertex =
+bone
+0.500000 material
+frame vertex bone frame 0.500000 frame -1 bone
+= 1.0 =
+vertex 1.0 1.0 -1 material texture bone 1.0 frame texture texture anim -1 0.500000 vertex -1 texture texture =
+bone
+bone = = frame anim
+anim texture
+1.0 texture texture frame -1 frame 0.500000
+anim texture material 0.500000 material 1.0 anim vertex anim
+vertex
+texture
+0.500000 1.0 anim frame vertex 1.0 vertex frame -1 frame texture frame 1.0 frame material -1 anim -1 bone
+anim texture
+=
+-1 1.0 0.500000 0.500000 -1
+1.0 anim material
+frame = 1.0 texture = frame
+anim 0.500000 1.0 0.500000
+texture anim frame 1.0 bone
+bone 1.0 anim anim anim = 0.500000 texture
+0.500000 -1 texture 0.500000 0.500000 1.0
+frame bone bone 0.500000 bone anim 0.500000
+bone -1 material -1 1.0 = 0.500000
+anim texture material
+vertex anim frame
+-1 bone -1 -1 -1 1.0
+-1
+material
+texture
+bone material texture bone
+vertex = = 0.500000 bone
+frame -1 1.0 -1 -1 anim material -1 frame texture vertex 0.500000 texture frame vertex 0.500000
+vertex
+= 1.0
+frame 1.0 1.0 bone -1 1.0 frame -1
+bone -1
+anim frame
+frame
+bone
+0.500000 frame =
+vertex 0.500000 texture material
+frame = 1.0
+0.500000 -1
+frame = vertex texture = -1 frame
+-1
+vertex texture material
+bone
+anim
+0.500000 bone 1.0
+vertex material
+0.500000 0.500000 = 1.0 0.500000 vertex anim anim texture
+bone texture = texture
+bone = -1 =
+anim -1 frame texture frame frame = frame 1.0 bone bone = 0.500000 0.500000 bone bone 1.0 0.500000 material
+0.500000 vertex
+= anim frame -1 frame material
+= = frame
+vertex material 0.500000 bone 0.500000 -1 bone material
+1.0 0.500000 -1 texture 1.0
+=
+= texture frame vertex
+vertex anim material texture 1.0
+1.0 texture frame frame =
+vertex texture material bone 0.500000 -1 material
+1.0 vertex vertex -1 1.0 bone texture
+0.500000 -1
+1.0 texture
+1.0 bone texture -1 1.0 = bone
+1.0 bone anim texture bone
+bone anim vertex
+= -1 vertex vertex vertex 0.500000 bone texture bone
+-1 vertex frame
+material = bone texture material texture
+material texture bone 0.500000 texture
+anim
+1.0 = frame bone
+0.500000 = texture 0.500000 bone
+frame -1 anim
+bone -1 anim
+=
+bone =
+anim =
+material
+1.0 1.0 material bone -1 0.500000 frame = anim bone texture
+material vertex
+texture
+-1
+0.500000 = anim
+vertex
+bone 1.0 vertex anim 0.500000 bone = 1.0 anim bone = frame = anim 1.0
+0.500000
+-1
+material vertex
+= 1.0
+frame = 0.500000 anim 1.0 vertex -1 vertex vertex
+vertex 1.0 texture material -1 vertex =
+frame -1 bone
+vertex texture
+0.500000 material 1.0 bone 0.500000 material
+frame 0.500000 -1 frame anim -1 vertex material
+frame anim texture anim anim bone
+-1 vertex frame texture texture texture bone = anim 1.0 vertex frame texture =
+= 0.500000 vertex texture vertex
+material anim anim
+1.0 material 0.500000 frame
+bone = frame = 1.0 0.500000 bone material
+= frame
+texture
+bone = 0.500000
+texture texture bone
+frame material 1.0 anim
+1.0 1.0 = texture -1 material anim
+1.0
+1.0
+bone frame frame
+anim frame -1 1.0
+frame
+= -1
+frame frame anim 0.500000 1.0 0.500000 -1 anim material = 0.500000 1.0 material frame frame
+frame anim
+texture =
+bone 0.500000 -1 1.0 vertex vertex
+frame material bone texture
+0.500000 0.500000 -1 material material
+0.500000 = = -1 1.0 = bone
+1.0 1.0
+bone
+1.0 -1 0.500000 anim texture
+1.0 1.0 texture 0.500000 0.500000 bone bone texture anim 0.500000 -1 texture
+-1 = material texture bone frame 1.0 vertex
+=
+= vertex
+frame 0.500000
+0.500000 0.500000 frame vertex 0.500000
+frame frame texture frame anim = = -1
+1.0
+=
+1.0 0.500000 -1 anim bone
+vertex
+1.0 1.0
+= texture material texture frame material 0.500000 frame = = frame frame
+frame 0.500000 1.0 material
+1.0 1.0
+1.0
+bone anim texture anim
+-1 frame texture 1.0 anim
+0.500000 =
+-1 anim frame 0.500000 0.500000 anim
+frame = = 0.500000 anim
+-1
+1.0 1.0 1.0
+material -1 0.500000 0.500000 -1 texture vertex 1.0 1.0
+= = texture anim
+= bone material
+-1 vertex bone
+=
+1.0
+0.500000 0.500000 vertex anim vertex
+vertex
+texture frame
+bone
+1.0 -1
+anim 0.500000 anim -1 bone
+-1 frame texture
+texture vertex 1.0
+=
+frame frame bone anim texture texture
+bone frame vertex material frame
+bone bone vertex anim frame =
+frame -1
+frame -1 vertex 0.500000
+= vertex bone
+0.500000 bone anim -1 -1 frame 0.500000 1.0 anim
+anim
+vertex material 0.500000 anim
+bone
+texture
+texture 0.500000 frame bone 0.500000 = material
+0.500000 vertex 0.500000
+1.0
+anim frame
+0.500000 = texture texture frame anim texture 0.500000 = anim bone
+= frame
+1.0 frame = -1 frame -1 =
+vertex 0.500000 material
+bone
+anim 0.500000 -1 bone bone frame vertex
+bone 1.0
+=
+1.0 0.500000
+anim =
+1.0 vertex
+vertex
+anim vertex vertex 0.500000 -1 -1
+0.500000 -1
+material anim
+frame frame bone vertex
+0.500000 = 1.0 frame 0.500000 texture material 1.0 material = 0.500000 texture 0.500000
+anim = bone -1
+texture = = = 0.500000
+anim
+-1 material material -1
+0.500000 vertex
+= -1 material texture 0.500000 =
+frame bone anim bone =
+frame
+frame -1 vertex frame anim
+anim bone
+vertex anim vertex
+0.500000 texture 0.500000
+texture
+anim anim 1.0
+anim 0.500000 frame 0.500000 -1 = vertex = 0.500000 texture
+frame
+texture bone =
+0.500000 -1 texture bone = anim vertex
+-1 frame
+frame 1.0 material
+1.0
+-1 anim -1 material bone frame anim 0.500000
+texture frame bone 1.0 texture
+texture
+= 0.500000
+frame texture frame texture = 1.0
+material vertex frame frame bone
+frame 1.0 anim vertex 1.0 anim -1
+vertex 1.0 vertex texture
+vertex -1 bone vertex
+texture frame frame
+texture
+frame = texture texture texture = bone 1.0
+anim
+bone vertex
+texture = -1 texture
+vertex
+1.0 1.0
+anim
+material anim texture vertex bone vertex texture texture = texture 1.0 -1 vertex
+material 0.500000
+= = -1
+vertex vertex
+material texture = 0.500000
+-1 anim texture -1
+vertex vertex an
\ No newline at end of file
@@ -0,0 +1,2 @@
+}8]Vc.tPBxgc2	1}:%ը3/
+Uِ1'H.]	ǣ; Ik$6vn
\ No newline at end of file
@@ -0,0 +1,3 @@
+texture 1.0
+-1 vertex texture
+vertex 0.
\ No newline at end of file
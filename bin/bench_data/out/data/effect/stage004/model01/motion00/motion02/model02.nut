@@ -0,0 +1,12 @@
+0.500000
+anim texture 1.0 1.0
+texture anim anim material
+-1 -1 0.500000 anim anim anim
+anim bone material vertex 1.0
+bone
+-1 -1 anim
+anim = anim = = 0.500000 vertex 0.500000 -1 -1 texture
+0.500000 1.0 vertex
+0.500000
+frame frame = frame 0.500000 frame vertex 1.0 material -1 1.0 bone
+texture -1 0
\ No newline at end of file
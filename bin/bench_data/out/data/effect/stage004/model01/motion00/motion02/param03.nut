@@ -0,0 +1 @@
+-1 material anim 1.0 anim vertex anim frame bone frame anim 
\ No newline at end of file
@@ -0,0 +1 @@
+texture material vertex = bone anim
\ No newline at end of file
@@ -0,0 +1,6 @@
+1.0 vertex 0.500000 vertex anim
+anim 0.500000
+vertex bone 1.0 material 0.500000
+frame
+0.500000
+texture 
\ No newline at end of file
@@ -0,0 +1,3 @@
+= anim
+texture = material anim = frame 1.0 = material texture
+materi
\ No newline at end of file
@@ -0,0 +1 @@
+nD\yĪThS_&"ʍ7Jːy*zWX*Iڇ!
\ No newline at end of file
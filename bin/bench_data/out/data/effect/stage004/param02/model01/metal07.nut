@@ -0,0 +1,18 @@
+-1 bone
+bone = anim
+anim bone
+-1 anim material =
+frame bone anim texture material vertex anim
+bone -1 1.0 texture 1.0 bone frame
+0.500000 material bone
+= bone -1 0.500000 0.500000 bone 1.0 material 0.500000 anim
+vertex vertex frame anim
+anim texture bone = = anim -1
+anim
+0.500000
+vertex 1.0 frame 1.0 texture bone = material
+bone 0.500000
+= 1.0 vertex texture bone
+material material material
+= 1.0 1.0 = bone material texture
+0.500000
\ No newline at end of file
@@ -0,0 +1,4 @@
+1.0 =
+frame texture 1.0 anim -1 =
+texture = anim texture 1.0 -1 vertex 1.0 1.0 anim
+ma
\ No newline at end of file
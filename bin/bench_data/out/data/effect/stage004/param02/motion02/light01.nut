@@ -0,0 +1,12 @@
+vertex frame bone bone texture anim anim anim 1.0
+frame frame vertex frame vertex 0.500000 texture bone
+texture bone texture = 1.0 0.500000 frame
+1.0 bone -1 -1 -1 0.500000
+bone -1 bone texture 1.0
+bone -1 anim -1 anim texture material frame vertex
+material vertex bone 1.0
+texture texture
+material texture anim 1.0 texture anim
+frame 0.500000
+anim
+material vertex mat
\ No newline at end of file
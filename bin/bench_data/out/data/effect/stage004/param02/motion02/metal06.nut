@@ -0,0 +1,255 @@
+bone -1 0.500000 material frame
+= -1 vertex vertex
+1.0 material -1 anim
+= 1.0 0.500000
+frame anim = frame material -1 anim 0.500000
+frame frame
+anim anim
+1.0 texture bone
+texture vertex -1
+1.0 anim vertex 0.500000
+-1 = texture
+texture 1.0 =
+= frame -1 texture
+-1 0.500000 0.500000 frame vertex =
+= 0.500000
+1.0 = 1.0 -1
+texture 0.500000
+vertex = bone 0.500000 vertex texture frame = frame bone bone
+0.500000
+-1
+frame -1
+= texture vertex
+vertex 0.500000 0.500000 = frame 1.0 -1 texture material
+1.0
+vertex = texture vertex texture -1 anim
+frame = -1 0.500000 texture 0.500000
+frame = vertex material frame
+material
+= bone =
+bone 0.500000 1.0
+frame -1 =
+anim material frame
+1.0 material = 1.0 = 0.500000 material 1.0
+frame = 1.0 -1 1.0 0.500000 1.0 = texture 0.500000 frame material material anim bone material 1.0
+texture
+anim
+= material 1.0 -1
+material bone -1 bone vertex anim anim -1 1.0 frame texture frame anim
+frame
+frame frame material frame frame 1.0 material anim
+0.500000 material 0.500000
+0.500000 texture -1
+bone texture anim -1 bone -1 0.500000 = 1.0 anim texture -1 -1 1.0
+texture 0.500000 -1 -1 vertex =
+vertex 1.0 bone
+1.0 anim 0.500000 1.0 1.0 frame vertex anim texture
+1.0 -1 anim anim
+bone
+texture = frame 0.500000 0.500000 vertex =
+frame
+frame texture vertex
+vertex texture texture vertex texture 1.0 material bone
+-1
+anim bone anim
+bone vertex frame 1.0
+texture 0.500000 vertex 0.500000 0.500000 -1 material anim
+=
+anim texture material 1.0
+1.0 bone bone
+0.500000 -1
+anim
+1.0 bone material
+-1 -1
+vertex
+0.500000 texture frame anim texture 0.500000 texture vertex anim material bone
+=
+material anim
+bone vertex vertex material -1 -1 1.0 -1 -1 anim
+0.500000 =
+0.500000 texture texture bone anim anim frame
+vertex = = bone 1.0 texture
+texture frame bone material material -1
+frame 1.0 1.0
+frame bone
+bone texture -1
+= vertex
+texture
+= material -1 anim texture texture material anim
+-1
+= anim material
+0.500000
+bone anim
+anim vertex
+frame anim frame texture 1.0 vertex
+1.0 vertex 1.0 frame bone
+vertex texture 1.0
+1.0 frame anim -1
+bone -1
+frame -1 material
+= material frame frame
+material
+material 0.500000
+bone frame vertex texture frame material 0.500000 = =
+1.0 material bone texture texture frame bone
+1.0 texture texture 0.500000 1.0 material
+bone frame = bone
+= bone
+texture 1.0
+texture
+= frame 1.0 material material bone frame bone texture -1 bone 1.0 vertex frame anim frame frame frame frame texture bone
+vertex -1 bone
+bone =
+frame frame
+0.500000 vertex
+material
+vertex
+anim
+= anim anim bone
+frame texture material 0.500000 1.0 texture 0.500000
+texture material material 0.500000 0.500000 texture 0.500000
+bone -1 anim
+anim material vertex anim 1.0 = 1.0 material vertex frame texture -1 texture material vertex bone vertex anim =
+0.500000 -1 0.500000 = frame = texture anim texture vertex texture frame vertex material 1.0 1.0 1.0 frame 0.500000
+anim
+1.0 1.0 bone 0.500000 0.500000 texture 0.500000 -1 material
+0.500000
+anim anim bone frame frame
+bone frame -1 material
+-1 vertex = vertex 0.500000 material
+anim material 0.500000 anim bone
+bone
+= anim
+-1 vertex frame anim material texture bone bone anim
+0.500000 frame anim -1
+= material bone -1 1.0 0.500000 1.0 vertex
+-1
+0.500000 -1
+anim anim
+bone frame
+-1 texture -1 anim bone anim
+-1
+anim 1.0 material texture bone vertex = vertex = vertex texture frame 0.500000
+1.0
+anim frame bone
+anim -1 1.0
+vertex anim
+1.0 material
+-1 material = anim material vertex material texture -1 bone frame material
+frame
+= anim anim material texture
+vertex
+vertex
+anim
+frame frame -1 bone frame frame
+1.0
+texture = anim
+-1 anim texture = =
+texture texture vertex texture
+1.0
+material
+vertex
+-1 frame -1 1.0 0.500000 vertex vertex -1
+texture
+frame vertex material anim 0.500000 anim anim 1.0 anim texture material -1
+vertex texture
+1.0 bone 0.500000 -1 bone bone 1.0 frame frame texture
+1.0 anim
+texture vertex frame = = anim =
+material
+=
+material
+0.500000 1.0
+vertex
+vertex 1.0 = anim bone vertex -1 = 0.500000
+texture 0.500000 anim -1 -1
+texture
+1.0 texture 0.500000 = vertex
+texture frame
+texture
+vertex
+vertex bone anim = 1.0
+1.0 -1 -1 1.0 vertex
+= 1.0 -1
+texture 0.500000 vertex
+frame
+vertex = vertex
+anim texture vertex texture texture
+-1 anim = material =
+0.500000
+frame texture texture = frame
+vertex =
+anim texture
+0.500000 bone bone
+0.500000 = anim bone texture texture material
+-1 texture
+-1 frame vertex 1.0 0.500000 anim vertex texture frame 1.0 frame frame 1.0 texture anim texture
+-1 material -1 anim material 1.0
+frame vertex anim -1
+-1 material
+1.0 0.500000 anim vertex bone texture texture -1 texture bone texture material bone
+bone frame vertex 1.0 texture
+bone =
+0.500000
+= vertex
+1.0
+bone -1 anim = 1.0 frame texture bone 1.0
+1.0 bone
+texture material
+-1
+material
+-1
+-1 = anim vertex 0.500000 bone
+material frame bone 1.0 anim
+vertex anim frame anim 0.500000 vertex material
+bone
+bone texture texture = bone = = texture -1 = texture
+vertex vertex anim texture 0.500000 vertex -1 -1 frame frame material
+= 1.0 = vertex 1.0 = -1
+material bone 0.500000 texture
+frame vertex texture vertex frame 0.500000 = = 1.0 1.0 =
+frame bone
+frame anim = -1 frame -1 texture
+bone 0.500000 material 0.500000 texture = anim frame frame
+material
+material 0.500000 1.0 frame 0.500000
+0.500000 1.0 anim -1 material -1 1.0 anim
+texture
+anim frame -1 vertex texture 0.500000
+vertex 1.0
+material anim
+0.500000 1.0
+vertex material
+texture material
+1.0
+texture vertex
+bone material
+0.500000 0.500000 -1 = vertex
+anim anim
+0.500000
+material vertex -1 frame bone 0.500000 = vertex
+0.500000 vertex anim texture vertex texture
+bone anim texture texture
+bone anim texture
+texture 1.0 0.500000 -1 frame
+frame material = material -1 -1 = = vertex
+texture 0.500000 -1 material = 0.500000 frame 0.500000 bone
+1.0 frame 1.0 0.500000 material bone
+vertex texture 0.500000
+bone
+= bone material vertex material vertex -1
+1.0 bone frame material bone vertex = =
+bone material -1 0.500000 1.0 vertex 1.0
+0.500000
+anim material vertex
+= bone anim = frame anim
+bone
+vertex
+0.500000 anim
+anim texture 1.0 1.0 vertex
+1.0 vertex
+material vertex bone
+anim = vertex 1.0
+texture texture material material
+-1
+1.0 1.0 0.500000 0.
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex
+vertex anim frame texture vertex material vertex = ver
\ No newline at end of file
@@ -0,0 +1,15 @@
+anim = bone = 1.0 0.500000 frame
+vertex = vertex anim vertex frame
+vertex
+frame
+= bone
+frame -1 frame bone
+texture 0.500000 material anim -1
+= = 1.0
+vertex =
+=
+bone -1
+= 1.0
+material 1.0 material
+material texture 0.500000 =
+anim frame material material 
\ No newline at end of file
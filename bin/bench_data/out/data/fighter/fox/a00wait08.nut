@@ -0,0 +1,108 @@
+vertex bone
+vertex
+1.0 1.0 texture vertex 0.500000 vertex = anim
+bone = bone
+bone 0.500000
+bone texture 1.0 texture frame
+anim = 0.500000 anim 1.0 texture = material texture
+1.0
+0.500000 -1 texture = -1 1.0 1.0 vertex = vertex anim
+-1 material anim = 1.0 0.500000 anim texture vertex anim frame =
+-1 material vertex
+material material material -1
+bone frame anim
+bone 0.500000 =
+0.500000 vertex vertex frame bone bone
+bone frame -1 texture texture material
+frame
+vertex texture
+1.0 material = -1 vertex material 1.0 -1 frame
+material 1.0 bone -1 frame vertex texture -1 vertex -1 bone texture = material 0.500000
+texture -1
+=
+anim frame
+anim bone
+anim frame =
+1.0 0.500000 bone vertex
+vertex texture
+anim frame 0.500000 frame vertex
+0.500000 0.500000 material texture
+1.0 material frame
+frame anim
+1.0 1.0 vertex = vertex
+material
+= 1.0 -1
+0.500000
+bone
+anim vertex frame texture material
+bone 1.0 vertex vertex
+anim -1
+texture 1.0 =
+0.500000
+bone
+= -1 frame
+vertex bone
+1.0
+0.500000 = frame
+texture 0.500000 material 1.0
+vertex texture -1 material 1.0 = 0.500000 0.500000
+material
+material anim frame texture frame =
+vertex 0.500000 -1 0.500000
+anim frame bone bone material 0.500000 = frame 1.0
+=
+bone
+material = anim material 0.500000 vertex anim = anim 0.500000 = = bone texture material texture
+vertex
+1.0
+0.500000 material
+vertex
+-1 anim
+anim bone bone -1 material -1 material
+-1
+bone texture
+0.500000
+bone 0.500000 = frame texture
+frame 1.0 anim
+bone anim 1.0
+1.0
+texture -1 material 1.0 0.500000 bone anim 0.500000
+0.500000 bone
+anim texture
+vertex
+1.0 bone = 0.500000 frame -1
+= frame anim bone frame
+texture bone bone anim 0.500000 vertex
+-1 texture frame
+0.500000 -1 frame anim bone frame = = 0.500000 = 1.0 bone -1
+0.500000
+-1 1.0 vertex frame
+material vertex 1.0 texture frame = 0.500000 1.0 frame = frame 0.500000 texture anim 0.500000
+0.500000 anim 1.0 vertex vertex anim = anim
+anim material anim -1
+material = vertex frame vertex bone 0.500000
+0.500000 anim 0.500000 frame bone =
+-1 material anim texture
+1.0
+= 1.0
+frame anim bone -1 0.500000
+vertex
+material
+material
+0.500000
+bone 1.0 bone bone frame texture vertex texture 1.0 material material
+1.0 1.0 -1 -1 texture frame anim
+0.500000
+vertex
+=
+material texture texture
+anim anim bone vertex 1.0 0.500000
+= 0.500000 -1
+bone bone
+0.500000 material anim bone = texture 0.500000 frame 1.0 frame vertex bone texture 0.500000 texture
+frame =
+anim vertex
+-1 vertex vertex anim = -1 =
+1.0 texture bone texture 1.0 material vertex vertex 0.500000 frame
+1.0
+bone 0.500000 1.0 vertex ani
\ No newline at end of file
@@ -0,0 +1,35 @@
+anim
+bone
+bone = material vertex 0.500000 0.500000
+vertex material
+texture anim frame 0.500000 material
+material
+texture 0.500000
+0.500000 vertex
+vertex anim = bone
+1.0
+=
+frame bone 1.0 -1 material = bone = = vertex
+material material texture 1.0
+0.500000 texture frame -1
+0.500000 texture
+texture
+0.500000 bone anim =
+anim anim 1.0 vertex
+-1 frame bone vertex 1.0 frame
+texture
+material texture anim = -1 bone
+0.500000 bone anim
+vertex texture
+0.500000
+anim
+frame
+0.500000
+texture
+texture
+-1
+material
+texture frame
+vertex 0.500000 material
+vertex texture
+texture vertex frame = -1 texture material 1.0 1.0 0.500000 1.0 -1 texture anim = vertex = bone b
\ No newline at end of file
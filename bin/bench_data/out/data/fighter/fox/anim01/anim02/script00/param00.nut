@@ -0,0 +1,307 @@
+vertex texture = texture texture
+-1 anim
+anim bone
+anim material
+anim bone
+bone -1
+= texture bone
+material material
+frame = vertex 1.0 -1 -1
+0.500000 material
+anim
+= 0.500000 anim
+anim
+-1 1.0
+texture frame anim
+bone
+texture frame texture 1.0 = vertex bone 0.500000
+1.0 material 1.0 -1
+0.500000 -1 bone anim bone bone = 1.0 1.0 bone
+material material material frame vertex material 1.0 material anim vertex anim material
+=
+= anim 0.500000 0.500000
+vertex
+bone
+frame
+bone bone
+texture bone -1 bone
+vertex bone
+-1 material -1 anim material
+vertex vertex anim texture texture 1.0 1.0 texture vertex 1.0
+material material
+0.500000 bone
+texture 0.500000 texture
+= material =
+vertex
+0.500000 material material 0.500000 -1 -1 -1 frame 0.500000 bone texture vertex 0.500000
+1.0
+material = material
+1.0 bone
+texture frame frame vertex
+frame
+-1 vertex -1
+=
+0.500000 vertex material 1.0 = vertex = texture =
+texture vertex = 1.0
+material bone 1.0
+-1
+frame vertex material vertex texture -1
+1.0
+0.500000
+anim anim vertex
+1.0 material
+bone 0.500000 anim
+frame
+material vertex 0.500000 bone =
+0.500000 anim frame 1.0 0.500000 = 0.500000 texture = bone -1 bone vertex
+= = anim frame 0.500000 frame bone = vertex anim
+1.0
+anim material
+-1 vertex
+vertex
+= frame -1 vertex
+0.500000 0.500000
+texture =
+=
+texture
+material frame
+-1 =
+-1 = 1.0 texture material 1.0 1.0
+texture
+0.500000
+0.500000 = 0.500000 anim bone
+frame material 0.500000 -1 bone frame bone bone
+anim = bone 1.0 texture
+0.500000
+vertex material 0.500000
+frame -1
+-1 bone
+-1 vertex = =
+anim frame 1.0 anim vertex texture
+anim 0.500000 1.0
+anim material bone -1
+texture anim bone frame
+frame material 0.500000 =
+1.0 -1
+-1
+-1 -1 texture
+= 0.500000 material vertex 1.0 0.500000 vertex vertex bone 1.0
+0.500000 -1 bone material -1 material anim 1.0 1.0 = texture
+1.0 0.500000 -1
+bone material 0.500000 bone vertex -1
+0.500000 anim vertex vertex
+vertex frame
+bone -1
+0.500000 0.500000 bone bone material
+vertex frame 0.500000 = anim
+bone texture
+vertex = -1 bone
+-1 1.0 frame vertex anim texture -1 -1 anim vertex -1 = = -1 -1 frame texture 0.500000
+vertex texture
+=
+0.500000 1.0 bone
+vertex
+1.0 texture texture material = 0.500000 bone frame material
+1.0 material 0.500000 anim 1.0 bone material material
+vertex frame -1 frame bone frame texture frame texture texture
+material bone material 1.0 anim bone texture material
+0.500000 material
+0.500000 -1 0.500000 vertex 1.0
+-1 =
+anim
+1.0 = material 0.500000 -1
+frame texture
+texture texture bone 0.500000
+material
+vertex 1.0 anim material
+material texture = vertex
+frame
+anim -1 bone
+-1
+1.0 = 0.500000
+1.0 1.0 0.500000 anim material texture
+anim bone bone =
+anim bone material frame = 1.0 0.500000 texture
+vertex 0.500000 texture anim frame bone -1 texture texture bone
+frame material
+0.500000 vertex material vertex anim
+-1 0.500000 anim anim frame anim vertex vertex texture material
+vertex 1.0 0.500000 -1
+anim material material
+vertex 1.0 material = bone bone = -1
+texture 0.500000 frame frame material =
+vertex bone vertex = anim
+-1
+= 1.0
+-1 vertex vertex = -1 bone material texture
+=
+vertex bone vertex vertex
+material -1 frame vertex
+0.500000
+material frame material
+vertex 0.500000 texture -1 0.500000 1.0 material anim 0.500000 texture
+frame vertex
+material anim frame
+=
+vertex bone -1
+bone texture 1.0 material = vertex
+bone -1
+texture = 1.0 = 1.0
+anim 1.0 = frame
+1.0 texture material 1.0
+vertex = texture texture texture anim 1.0 material bone
+0.500000 1.0 texture -1 texture anim texture frame frame 0.500000
+frame material = 0.500000 1.0 0.500000 anim bone 0.500000
+= 0.500000
+= bone
+0.500000 material
+0.500000 anim anim frame
+frame
+texture -1
+= texture vertex material
+= = texture 1.0 material vertex 1.0
+1.0
+= texture texture 0.500000
+material material material frame
+bone frame material bone = vertex material bone
+material bone
+frame material
+frame
+material anim material vertex
+bone 0.500000 texture
+0.500000
+1.0 -1 bone = texture 0.500000 vertex
+0.500000 vertex frame 1.0 texture frame -1
+vertex 1.0
+frame frame
+anim anim
+1.0
+material material material anim vertex frame 0.500000
+-1
+frame -1 vertex
+texture
+=
+vertex bone material vertex anim material 0.500000 vertex frame anim = -1 0.500000
+vertex
+material
+anim -1 0.500000 0.500000
+anim bone vertex
+material frame vertex bone frame texture 0.500000 1.0
+anim
+bone
+-1 1.0 = 0.500000
+vertex -1 1.0 =
+anim
+anim bone -1 1.0
+= -1 texture texture 1.0
+frame
+=
+frame 0.500000
+texture
+-1 material =
+-1
+-1
+frame frame frame
+material texture = 0.500000 frame bone bone frame -1 =
+anim
+anim
+anim bone = material
+material bone bone 1.0 anim frame
+texture texture 1.0 frame anim vertex
+material vertex =
+bone
+=
+vertex
+bone
+bone anim
+-1
+bone
+= 1.0 1.0
+= texture anim vertex = 1.0
+-1 1.0 1.0 = texture = bone vertex 0.500000 texture 0.500000 1.0 anim material
+vertex vertex bone vertex
+1.0 = frame 1.0 anim
+= bone
+texture
+0.500000 frame bone material
+0.500000 = vertex 0.500000 frame = frame texture frame
+0.500000 = 0.500000 1.0 texture =
+= material
+bone anim
+0.500000 bone
+vertex frame bone vertex texture anim material
+vertex -1 bone material
+material material = 1.0 0.500000 material
+0.500000
+material texture bone
+material =
+=
+texture -1 texture texture
+texture anim -1 -1 -1 -1 -1 anim 0.500000 1.0 material
+=
+bone
+-1
+vertex frame frame 1.0 1.0 = 0.500000 bone frame -1 frame
+material
+texture
+material
+bone -1 texture 0.500000 anim
+texture vertex -1 texture texture
+anim =
+0.500000 1.0 = bone frame
+material texture texture vertex 1.0
+anim
+0.500000
+vertex 0.500000 1.0
+vertex texture frame vertex 1.0 frame 0.500000
+anim texture anim 0.500000 frame frame
+material texture
+= 0.500000 vertex = bone
+vertex 0.500000
+bone texture 0.500000
+bone 0.500000 vertex vertex
+frame texture
+1.0 -1
+vertex anim material
+material texture texture = vertex 1.0 1.0 anim
+= 1.0 1.0 frame frame 1.0 anim frame material -1 material vertex = vertex
+1.0 texture
+=
+0.500000 1.0
+bone vertex 0.500000 anim = material
+0.500000 anim
+0.500000 material vertex bone vertex material vertex =
+-1 1.0 bone
+0.500000 frame 1.0
+-1 material texture frame bone bone frame 0.500000 frame -1 frame
+frame
+bone = 1.0 frame texture 1.0 bone bone
+material 0.500000
+vertex -1
+0.500000 anim
+vertex 1.0
+texture
+anim bone texture texture
+vertex
+vertex anim 0.500000
+= vertex anim
+1.0 vertex anim bone
+texture vertex bone
+bone =
+bone -1 material
+vertex 1.0 bone frame 0.500000 texture texture -1 material 1.0 = 0.500000
+bone = material frame vertex =
+-1 frame
+anim = = bone
+texture 0.500000 -1 anim
+anim anim bone material 1.0 bone
+frame anim
+texture vertex
+texture = frame frame frame 1.0 1.0 0.500000 anim vertex frame bone = =
+0.500000
+vertex
+material anim texture 0.500000 -1 = -1 0.500000 material
+0.500000 vertex material texture material 0.500000 vertex 0.500000 material texture
+material vertex 0.500000 material
+0.500000
+0.500000 = fram
\ No newline at end of file
@@ -0,0 +1,4 @@
+1.0
+texture bone vertex anim
+1.0 material bone -1 material frame -1 material bone anim
+1.0 -1 frame = vertex anim vertex -1 texture 
\ No newline at end of file
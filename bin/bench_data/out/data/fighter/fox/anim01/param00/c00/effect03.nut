@@ -0,0 +1,194 @@
+frame -1 anim frame vertex bone material
+0.500000 1.0
+bone texture
+vertex texture 0.500000 0.500000 frame texture
+texture vertex -1 texture 0.500000 anim texture
+anim
+=
+material bone vertex
+0.500000 -1 1.0 =
+1.0
+material 0.500000 = bone texture -1 bone
+1.0 -1
+1.0 material
+vertex 1.0
+material
+1.0 0.500000 material texture = -1 -1 vertex frame texture
+texture texture
+1.0
+vertex anim texture frame
+vertex bone material
+texture texture
+-1
+texture
+material
+=
+-1 0.500000 frame material
+bone
+anim frame 1.0 texture anim 0.500000 = material
+0.500000 bone =
+1.0 -1 1.0 =
+bone 1.0 texture anim
+1.0 0.500000 anim
+1.0 anim = texture vertex 0.500000 0.500000 vertex
+vertex
+0.500000
+1.0 texture bone frame frame -1 texture
+material
+anim 0.500000
+-1
+-1
+anim vertex
+anim -1
+= frame -1 anim = anim vertex
+frame material =
+material = bone
+anim anim
+anim -1 texture -1
+vertex 1.0
+vertex 1.0 frame -1
+-1 1.0 bone anim vertex material 1.0 0.500000 frame 1.0
+bone 1.0 frame vertex 1.0
+1.0 frame anim texture texture = vertex material
+anim material 0.500000 texture bone
+frame 0.500000
+bone texture -1 frame =
+anim -1 frame
+1.0
+texture
+vertex
+frame = texture bone material texture texture frame texture -1 material texture vertex
+vertex vertex
+0.500000 vertex bone vertex frame texture -1
+anim
+-1 1.0
+-1 1.0 texture
+=
+vertex
+0.500000 -1 =
+material
+vertex 1.0
+vertex
+= texture 0.500000 anim material anim bone texture = frame 0.500000
+vertex texture
+1.0 material
+frame frame = anim bone texture
+bone 0.500000 material frame
+texture bone frame vertex
+texture frame texture texture texture 0.500000
+texture
+texture material material anim frame texture frame bone bone texture -1 = anim frame vertex 1.0 -1 vertex -1 texture
+material frame = material vertex material -1 material bone 1.0 anim
+anim 1.0 texture 0.500000
+frame vertex texture material = material
+texture 1.0 1.0 vertex 1.0 = anim
+anim 0.500000 -1 bone bone frame vertex anim texture
+material 0.500000 vertex 1.0 anim 0.500000 material
+1.0
+vertex vertex -1 1.0 vertex vertex 1.0
+= anim frame texture
+-1 = material 0.500000 anim =
+frame -1 vertex -1 material
+texture texture bone
+-1 -1
+1.0
+0.500000 frame texture texture
+anim material 1.0 material
+0.500000
+bone =
+texture texture
+material bone texture bone 0.500000
+= material material
+vertex -1 anim material anim = =
+1.0 vertex
+anim bone
+anim frame
+texture frame anim vertex
+material material vertex material material bone
+material
+1.0 bone 1.0
+frame 0.500000 -1
+anim bone
+vertex frame = 1.0
+bone 1.0 1.0 1.0 1.0 texture
+bone frame texture frame -1 -1 bone vertex -1
+texture texture -1 -1 1.0 bone frame
+= frame anim = material -1 -1 0.500000 material = frame frame
+0.500000 bone anim bone
+material vertex texture frame
+bone 0.500000 -1 vertex
+bone texture = vertex -1 anim
+-1 vertex
+-1 frame 1.0
+bone 1.0
+-1 bone 0.500000 -1 vertex
+=
+frame -1
+vertex 0.500000 1.0 anim anim
+material -1 bone 0.500000
+-1 frame 1.0 0.500000 0.500000 anim = frame frame 1.0 frame 0.500000
+1.0 material
+bone vertex -1
+1.0 texture anim material texture vertex 0.500000
+-1
+anim 1.0 anim
+= vertex
+bone texture
+1.0 vertex -1 frame vertex material
+anim = frame
+1.0 vertex
+anim anim
+= = 1.0 material
+= anim material frame
+bone frame -1
+= texture
+anim
+1.0 -1 vertex texture vertex vertex bone 0.500000 anim = bone material
+vertex
+-1 texture anim frame
+-1 anim vertex texture anim bone material vertex material 0.500000 texture -1 -1 texture bone
+-1 1.0 anim material
+1.0 -1 1.0 frame
+frame texture =
+0.500000
+1.0 material anim
+1.0
+0.500000 bone material
+=
+texture anim =
+bone anim bone vertex bone vertex bone frame texture anim material -1
+frame 1.0
+-1 vertex bone material frame bone vertex bone
+= bone =
+= material texture texture frame
+0.500000 vertex anim texture
+anim = vertex 1.0 1.0
+material
+frame anim vertex 1.0 anim 0.500000 bone texture texture 0.500000 anim
+material material anim
+1.0
+anim texture anim 0.500000 frame
+0.500000 vertex anim 0.500000
+= 0.500000 bone vertex frame 0.500000 -1 frame anim vertex
+-1 bone 1.0
+bone
+= vertex vertex 1.0
+-1
+material 1.0 = = texture material bone = = anim frame texture texture material = anim
+1.0 1.0 = anim
+0.500000 -1
+bone
+material
+-1 bone anim 0.500000 bone = = material 1.0 1.0 = anim 0.500000 material 0.500000 0.500000
+= -1 -1 0.500000 = vertex -1 anim frame -1 -1 anim anim frame material
+anim
+= vertex frame anim
+= frame material frame = material bone 1.0 texture anim = frame bone -1 -1
+texture 0.500000 texture = bone anim
+vertex anim
+0.500000 anim
+1.0 anim -1
+=
+-1
+vertex
+= -
\ No newline at end of file
@@ -0,0 +1,177 @@
+frame anim -1 1.0 0.500000 anim anim = 0.500000 = material
+material 1.0 1.0 1.0 vertex 0.500000
+bone 0.500000 texture texture
+texture
+0.500000 =
+anim anim -1
+anim -1
+0.500000 material
+frame vertex frame vertex
+texture =
+0.500000 0.500000 -1 0.500000 0.500000 1.0 =
+frame
+frame 1.0 texture bone
+vertex -1 0.500000
+bone bone = 0.500000 bone -1 bone 0.500000 material
+-1 = material bone 1.0
+vertex bone
+texture 1.0 material
+1.0
+0.500000 bone 0.500000 frame
+texture frame frame 0.500000
+vertex material bone 1.0 texture anim
+0.500000 texture
+bone
+1.0 -1
+anim = anim
+frame
+material -1 0.500000
+vertex 1.0
+bone 1.0 vertex material bone -1
+material vertex material
+frame
+frame anim frame bone = bone 1.0
+material material anim -1 texture vertex bone 0.500000
+bone texture
+frame material
+frame texture 1.0 -1 0.500000 material anim
+material material
+0.500000
+material vertex anim
+texture bone
+0.500000 -1 frame material bone
+frame frame bone frame
+material vertex vertex
+anim bone
+vertex 1.0 anim bone
+= material texture
+0.500000 0.500000 1.0 vertex = 0.500000 vertex -1 frame anim texture frame texture anim -1 -1 = -1 vertex
+= vertex bone 1.0 0.500000
+texture vertex
+texture -1
+texture -1
+frame
+frame
+1.0 frame 0.500000 material -1 = 1.0 -1
+anim
+0.500000 bone vertex
+material -1 anim 0.500000 bone
+anim material frame 0.500000 texture 1.0
+material
+texture bone -1 texture bone
+material -1
+vertex frame
+frame anim anim
+-1 texture vertex
+vertex frame
+bone
+0.500000 material 0.500000 bone frame
+vertex bone anim
+1.0
+texture = 0.500000 1.0
+vertex 1.0
+-1
+-1
+material 1.0 bone anim 1.0 anim texture vertex -1 = anim 1.0 anim material bone material material 1.0
+anim 0.500000 bone texture anim frame frame =
+anim anim bone
+texture material vertex 1.0 anim 1.0
+texture
+material
+bone -1 bone bone material = material bone anim anim 0.500000 texture -1 bone frame vertex bone 1.0
+anim vertex vertex
+bone anim -1 material 1.0 1.0 frame = texture
+anim 0.500000 1.0 = vertex vertex -1 vertex
+0.500000
+1.0 texture vertex
+material
+1.0
+= anim
+= material texture = frame anim = -1 bone 1.0
+frame frame 0.500000 1.0 bone texture material bone -1 1.0 material material texture 0.500000 0.500000 0.500000 frame
+0.500000 0.500000 vertex vertex bone bone =
+0.500000
+frame material bone =
+0.500000
+1.0
+-1
+anim 0.500000 material
+material
+material
+vertex anim
+material
+1.0 frame 0.500000 -1 anim material
+bone =
+anim anim texture
+= anim = bone = = vertex
+1.0 material frame frame material vertex bone material vertex frame
+= =
+0.500000 anim -1
+-1 material -1
+frame frame bone
+frame -1
+1.0 texture = 0.500000 frame vertex bone frame frame anim material anim material material bone
+frame
+texture vertex
+vertex -1
+material vertex vertex vertex = = frame bone
+anim
+= vertex vertex frame 1.0
+0.500000
+vertex
+1.0 0.500000 -1 vertex
+0.500000 material frame =
+-1 material
+=
+0.500000 = bone anim texture
+anim = texture -1 0.500000 anim
+-1 bone
+= material
+0.500000 anim anim
+1.0
+vertex frame texture =
+frame 1.0
+vertex = texture vertex texture = = material
+frame 1.0
+vertex
+texture bone material material -1 anim anim material bone bone
+material vertex -1 frame texture 1.0 0.500000 anim 0.500000
+frame texture = 1.0 vertex anim 1.0 texture
+0.500000 frame material = anim
+-1 bone
+1.0
+0.500000 1.0 bone 0.500000 -1 1.0 texture
+anim 1.0 -1 frame
+frame
+material
+1.0 bone
+anim -1 1.0 texture bone 0.500000 -1 -1 bone bone vertex 0.500000 texture
+texture material -1 texture
+material anim -1 = 1.0
+-1 1.0
+texture frame
+0.500000 anim texture
+= material
+vertex texture vertex -1
+-1 anim vertex bone anim -1 material
+-1
+anim texture 0.500000 1.0 material
+anim
+material bone texture material = bone vertex
+vertex material
+frame 0.500000
+frame -1
+vertex frame
+0.500000 0.500000 texture vertex 0.500000 =
+frame vertex
+0.500000 anim
+anim -1
+-1 =
+frame material 0.500000 -1 = -1 bone
+texture -1 texture anim bone -1
+anim = anim 1.0
+=
+0.500000 frame
+1.0 bone = vertex material
+0.500000 vertex material frame -1 -1
+fr
\ No newline at end of file
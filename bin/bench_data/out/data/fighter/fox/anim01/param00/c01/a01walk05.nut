@@ -0,0 +1,141 @@
+0.500000
+bone vertex
+vertex
+1.0
+anim 1.0 -1 frame
+-1 1.0 material
+0.500000 -1
+texture
+0.500000
+vertex
+0.500000 material frame
+1.0 -1 0.500000 vertex material
+material
+0.500000 -1 anim texture
+-1 1.0
+-1
+-1 -1 0.500000
+frame vertex
+vertex =
+vertex
+1.0
+vertex anim -1
+texture
+frame texture
+vertex vertex 1.0 0.500000 frame
+0.500000
+0.500000 1.0 frame = vertex texture bone 1.0 material
+material 1.0
+-1 0.500000
+material 1.0 vertex vertex texture bone = -1 vertex -1
+1.0 anim 1.0 texture texture
+material 1.0 vertex frame anim vertex material 1.0 vertex material material anim -1
+0.500000 material frame material = 0.500000 anim
+-1 -1 texture material
+bone 1.0
+bone material
+bone
+= bone -1 material frame texture = frame -1 1.0
+= texture
+material 0.500000 = 0.500000
+anim =
+texture
+-1 vertex material frame bone texture =
+0.500000 0.500000 -1 0.500000 0.500000 frame
+anim vertex
+anim texture texture
+vertex = -1 0.500000 material 1.0 vertex 1.0 frame 1.0
+frame
+1.0 frame vertex
+texture vertex frame frame
+vertex bone
+material 1.0 0.500000
+0.500000
+texture 1.0 0.500000
+bone vertex
+0.500000 1.0
+bone -1
+anim
+vertex = 0.500000
+vertex
+= material 0.500000 1.0 bone
+-1 frame 1.0 bone
+material
+= texture material 0.500000 material material vertex -1 vertex
+frame
+material
+0.500000 = texture anim 1.0
+0.500000
+1.0 vertex 1.0 bone
+0.500000
+= material
+1.0 -1 bone 1.0 vertex material anim texture bone
+texture
+-1 vertex texture texture
+anim bone frame vertex
+frame
+=
+material anim
+texture texture bone texture 0.500000
+bone frame texture vertex material material frame
+frame frame frame material bone = material vertex -1
+-1 0.500000
+frame frame
+bone bone
+= -1
+anim anim frame texture vertex
+1.0 anim
+texture 0.500000 texture = =
+= material texture =
+0.500000 vertex -1 texture frame
+1.0
+vertex bone 0.500000
+= material frame
+anim
+texture 1.0 bone texture -1 -1 frame = anim
+anim material vertex = -1 1.0 anim texture bone texture
+1.0 bone texture material frame 0.500000
+= texture frame
+material material frame frame texture vertex =
+vertex
+vertex vertex 1.0 0.500000 0.500000 -1 vertex 1.0 vertex vertex -1
+1.0 anim
+texture 1.0 frame
+texture
+1.0 anim
+texture = frame
+0.500000 material 1.0 0.500000 1.0 -1
+bone frame -1
+material = frame frame
+1.0
+-1 vertex anim material = 1.0
+anim vertex 1.0 1.0 0.500000 -1 frame
+= bone 0.500000
+anim texture frame 1.0 0.500000
+1.0 = anim -1 vertex
+texture bone
+material material frame = frame 0.500000 = frame = anim vertex 1.0 material frame anim 1.0 frame bone
+texture vertex
+texture
+-1 -1
+frame
+frame 0.500000
+material 0.500000
+0.500000 1.0
+bone vertex anim vertex
+frame
+anim frame material
+bone anim texture texture 1.0
+vertex
+material anim
+1.0 -1 material bone -1
+material texture 0.500000
+-1
+= frame 0.500000
+material =
+1.0 texture
+anim bone 0.500000
+1.0 vertex anim texture frame vertex
+bone texture vertex material anim
+anim -1 bone
+anim 0.500000 anim text
\ No newline at end of file
@@ -0,0 +1,125 @@
+material
+1.0 =
+frame vertex
+-1
+vertex bone -1
+frame 0.500000 0.500000 vertex material
+texture bone
+1.0
+frame material frame
+bone material = texture =
+0.500000
+anim vertex vertex anim =
+0.500000 -1 anim texture -1 -1 texture anim
+0.500000 1.0 1.0
+frame texture
+1.0
+anim
+anim texture material
+frame
+material anim bone frame bone
+bone 0.500000 0.500000
+texture
+bone 1.0 bone
+frame anim = frame anim texture 1.0
+anim = 0.500000 0.500000
+vertex bone frame bone
+vertex -1 1.0 anim material vertex
+anim vertex material frame frame
+vertex 0.500000 texture material vertex anim
+material 0.500000 texture 1.0 anim 0.500000 vertex material 0.500000 = frame 1.0
+1.0 texture frame frame
+frame
+vertex -1 bone texture -1
+material bone 1.0 1.0
+material vertex -1 bone vertex bone -1 material anim
+bone vertex vertex anim material material anim 0.500000 vertex bone
+vertex 0.500000 1.0 vertex
+1.0 material 1.0 = anim 0.500000 0.500000
+-1 vertex material
+-1 frame texture = vertex = anim vertex texture 1.0 texture
+-1 1.0 anim 0.500000 1.0
+texture =
+anim anim texture anim
+1.0 -1 anim 1.0 frame -1 vertex material texture texture = 1.0 anim
+vertex material bone
+-1
+material vertex anim texture frame
+vertex
+frame
+frame 1.0 -1 -1 = -1 -1
+anim material bone frame
+bone anim frame
+anim 0.500000
+material material -1 texture bone
+1.0
+texture 1.0 bone 1.0 material texture 1.0 1.0 -1 bone -1
+frame 1.0 =
+1.0 texture bone texture = texture texture 1.0 frame 1.0 frame =
+material anim
+anim 0.500000 bone = 1.0 1.0 0.500000 1.0
+frame anim
+material frame texture 0.500000
+vertex
+bone
+texture texture 0.500000 = 0.500000 texture -1
+vertex bone frame
+-1 -1
+-1
+vertex = vertex vertex 0.500000 material frame = anim 1.0
+material
+bone -1
+-1 texture bone 1.0 -1 1.0 0.500000
+1.0 anim material
+= -1
+vertex texture -1
+material 1.0 material vertex
+0.500000 material 1.0 = -1 texture
+vertex
+material = texture frame 1.0
+texture bone material
+bone 0.500000
+-1
+frame 0.500000
+frame material 1.0
+material bone bone frame -1 anim
+frame 1.0 -1 -1
+frame material frame anim
+1.0 0.500000 frame
+0.500000 material material bone 1.0 bone frame
+0.500000 bone -1
+0.500000
+vertex frame
+material anim texture
+1.0
+= =
+bone 1.0 = 1.0 1.0 material -1 texture vertex 1.0 anim -1 anim 0.500000 -1 -1 frame bone texture 0.500000
+material frame 1.0
+anim 1.0
+vertex frame vertex = 0.500000 -1 1.0 texture vertex
+anim =
+=
+bone 0.500000 material 1.0 1.0 0.500000 material texture
+0.500000 bone 1.0
+0.500000 anim frame
+frame texture 1.0 -1 vertex material
+= texture material anim vertex frame
+texture = = texture
+1.0
+frame = = 1.0 vertex = texture frame 0.500000
+vertex 1.0 frame anim bone 0.500000 0.500000 -1 bone anim 1.0
+texture
+texture
+1.0 texture -1
+=
+1.0 material
+texture
+vertex -1 anim texture -1 frame texture texture 1.0 1.0 texture 0.500000 = -1 1.0 bone = 1.0 =
+anim
+-1 1.0 0.500000 material bone material 1.0
+-1 0.500000 vertex
+texture material
+0.500000 -1 = material bone texture
+bone
+1.0 vertex vertex -1 -1 anim frame
+an
\ No newline at end of file
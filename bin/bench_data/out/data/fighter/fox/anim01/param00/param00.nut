@@ -0,0 +1,102 @@
+frame
+1.0 frame
+texture vertex frame 0.500000 0.500000 = anim -1
+=
+vertex vertex
+0.500000
+anim
+0.500000 -1 -1 texture 1.0 = material frame
+1.0 material
+bone 1.0 anim frame = frame frame -1 vertex
+0.500000 material material -1 0.500000
+-1 frame
+0.500000 anim texture = = vertex
+vertex =
+anim bone frame bone =
+material
+vertex
+material
+1.0
+0.500000
+texture vertex =
+-1 bone 0.500000
+vertex -1 = vertex
+frame = frame
+material anim
+anim anim
+material bone texture 0.500000
+1.0 anim frame material -1 material anim
+= 1.0
+bone
+=
+1.0
+bone
+vertex 1.0
+vertex 1.0 1.0 frame = vertex
+material anim 0.500000 texture 0.500000 anim vertex
+0.500000
+vertex
+-1
+material = 1.0 material vertex frame anim
+vertex material 1.0
+=
+vertex
+-1 texture texture = bone anim bone -1
+material = 1.0 frame material vertex 0.500000
+bone vertex vertex vertex frame = 0.500000 material 0.500000 -1
+material -1 -1 bone 0.500000 anim vertex vertex 0.500000 material -1 frame vertex
+bone = bone -1 texture vertex frame
+anim
+anim
+material texture 1.0 frame material material =
+1.0 vertex material
+anim
+frame frame material = = vertex
+vertex 0.500000 texture material material texture material 0.500000 frame -1 vertex texture bone 0.500000
+texture 0.500000
+= material = bone material 0.500000 anim -1 material
+anim = vertex frame anim
+material -1 0.500000 vertex bone
+= material material vertex frame 0.500000 texture 1.0
+material
+anim material
+material 1.0 1.0 bone 0.500000 material -1 = -1 -1 texture texture = texture
+material
+vertex anim 1.0 texture 0.500000
+vertex frame
+anim anim 0.500000 texture
+frame 0.500000 0.500000 material 0.500000 1.0 anim -1 texture
+bone 0.500000 frame =
+0.500000 1.0 bone
+1.0 vertex texture bone -1
+vertex vertex 1.0
+texture
+0.500000 frame -1 texture vertex -1 1.0
+0.500000 anim
+frame frame 1.0 vertex material 0.500000
+material =
+0.500000 frame 0.500000 vertex vertex texture = anim 1.0 vertex
+0.500000 1.0 anim -1 vertex 1.0 =
+anim anim
+= texture anim material material material = vertex
+texture
+material material material bone texture
+vertex texture vertex
+anim = anim material texture
+material material frame frame frame
+= anim vertex material material texture
+bone texture bone
+material frame -1 material bone texture anim = texture 1.0 vertex 0.500000 material
+vertex = -1 -1 material = material
+texture 0.500000 1.0 bone texture 0.500000 0.500000 material
+1.0
+=
+texture anim bone 0.500000 0.500000
+frame vertex
+-1 bone anim
+-1 =
+bone 0.500000 anim vertex frame anim frame anim
+frame
+texture = vertex frame frame
+material material 1.0
+anim material -1 frame 0.50
\ No newline at end of file
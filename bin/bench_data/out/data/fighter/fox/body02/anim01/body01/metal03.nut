@@ -0,0 +1,3 @@
+= bone
+-1 -1 -1 -1 1.0 vertex 0.500000
+0.500000 anim bo
\ No newline at end of file
@@ -0,0 +1,33 @@
+anim frame
+anim frame anim material 0.500000 1.0 texture 1.0 anim frame bone texture
+texture 1.0
+frame = frame frame -1 1.0 bone
+-1 frame frame
+1.0 1.0 -1 texture = frame -1
+material
+-1 0.500000 -1 frame -1 = anim 1.0 -1
+bone bone 0.500000 texture
+= -1 0.500000 = texture texture vertex 0.500000 frame
+frame 1.0
+1.0 material
+texture material vertex
+vertex bone vertex -1 bone
+anim = = 1.0 vertex vertex texture texture bone texture
+0.500000 vertex = -1 1.0
+material 1.0 vertex
+=
+0.500000 0.500000 0.500000 frame anim frame = texture
+1.0 vertex -1 frame texture
+0.500000 bone texture
+anim anim vertex material
+1.0 vertex anim 1.0 1.0 bone material
+frame = frame bone material
+= 0.500000 material
+material bone -1 = frame
+material frame material 0.500000 1.0 frame material vertex 0.500000 material -1
+vertex -1
+0.500000
+vertex vertex
+anim texture 0.500000 = anim vertex material texture anim 1.0
+frame frame vertex material
+0.500000 vertex 0.5
\ No newline at end of file
@@ -0,0 +1,289 @@
+-1 material
+frame 1.0 0.500000 bone
+bone
+-1
+1.0 1.0 = texture texture
+frame texture material anim
+frame vertex -1
+material -1 0.500000 material 1.0
+-1 1.0
+anim frame material 0.500000 anim vertex 0.500000 0.500000 1.0 frame -1 0.500000 -1
+material texture texture -1 anim
+= -1
+anim bone 1.0 vertex
+0.500000
+vertex texture 0.500000 anim
+0.500000
+= 1.0 = bone anim
+frame -1 texture
+texture frame frame frame frame 0.500000 vertex =
+-1 texture 0.500000 frame frame 0.500000 -1 = -1 0.500000 -1
+1.0
+0.500000
+anim 0.500000 frame anim
+0.500000
+0.500000 bone anim 1.0 material = material
+= = vertex bone texture
+0.500000 bone vertex
+-1 0.500000 0.500000
+bone
+vertex frame frame 1.0
+frame
+= texture 0.500000
+bone texture
+anim 1.0 1.0 anim vertex
+1.0
+texture = = material
+bone 1.0 0.500000 0.500000 material bone 1.0 anim 1.0 vertex bone frame 0.500000
+-1 material 1.0 frame -1
+bone vertex
+frame -1
+frame bone texture anim bone
+0.500000 -1 anim = vertex
+= -1
+1.0 vertex material
+= -1 vertex vertex = 0.500000 0.500000 -1 -1 -1
+-1 texture anim = =
+0.500000 =
+-1 vertex material = = anim 1.0 anim 1.0
+vertex vertex
+texture material material = texture -1 vertex bone anim anim -1 0.500000 texture anim material texture anim -1 -1 1.0 vertex
+bone bone vertex -1 texture -1 anim
+frame anim
+-1 material vertex -1 -1 bone
+-1
+= 0.500000 = material = frame = bone -1
+texture anim
+vertex anim 1.0
+bone frame texture 0.500000 vertex texture material 0.500000 =
+= vertex 0.500000 texture
+vertex bone texture bone -1 bone -1 material
+-1
+anim
+-1 bone 1.0 = material bone anim
+-1 texture bone 1.0 material 1.0 0.500000 frame
+= 0.500000
+frame frame material -1 texture anim material texture 1.0 material frame 0.500000
+-1 vertex vertex
+-1
+1.0 1.0 bone 1.0 0.500000
+anim
+0.500000
+0.500000 =
+1.0 0.500000
+0.500000 texture bone
+vertex
+-1 vertex material
+1.0
+-1 frame
+anim anim
+material frame texture 0.500000 texture -1
+=
+1.0
+1.0 1.0
+1.0 material
+bone 0.500000 material texture 1.0 vertex texture anim
+1.0 1.0 texture
+-1 material = bone bone
+frame 0.500000
+-1
+frame
+0.500000 0.500000 frame
+bone vertex
+anim
+=
+-1 material bone 0.500000
+1.0 vertex
+1.0 vertex anim bone vertex
+1.0 -1 vertex frame 1.0 anim material = 1.0
+0.500000 =
+anim 0.500000
+anim 1.0
+1.0
+frame material material
+frame
+bone frame bone vertex
+1.0 0.500000
+anim = vertex 0.500000
+anim 1.0 -1
+-1 -1 vertex texture
+frame material 0.500000 0.500000 = vertex 0.500000
+frame
+-1 vertex
+vertex material
+0.500000
+0.500000 frame 1.0 bone -1
+1.0 texture =
+frame bone frame = = 0.500000 = vertex = material vertex
+texture
+vertex = texture material frame -1
+anim 0.500000 anim -1 -1 =
+0.500000
+anim -1 frame
+vertex anim bone
+frame = material -1 -1
+bone anim 1.0 -1 1.0
+1.0 vertex texture vertex 1.0 bone texture vertex vertex 1.0 -1 texture
+vertex vertex 1.0 0.500000
+texture
+= 1.0 texture 0.500000 bone
+material 0.500000 =
+-1 vertex bone anim frame 1.0
+bone 1.0 vertex 0.500000 0.500000 1.0 -1 1.0 material = vertex vertex
+vertex 0.500000
+material texture texture texture 1.0 texture texture texture = bone
+-1 -1 bone frame material frame -1
+1.0 frame bone vertex frame = = 1.0
+-1
+bone anim
+anim texture 0.500000 texture material
+frame 1.0 =
+1.0 = vertex
+material = frame vertex
+-1 1.0 -1 = vertex 1.0 material bone material texture frame
+bone
+anim bone frame bone frame 1.0 frame texture -1
+texture anim -1 0.500000 1.0
+-1 vertex bone texture texture anim
+=
+frame vertex texture -1 0.500000 = vertex -1 = = texture
+frame bone
+-1 -1 0.500000 anim vertex frame 0.500000
+0.500000 frame
+material vertex -1 -1 frame texture 0.500000 texture
+vertex
+frame bone 0.500000 frame -1 texture
+frame 0.500000 anim 1.0 texture -1 1.0 anim frame vertex 1.0 material -1 1.0 bone texture
+frame -1 -1 bone bone
+=
+0.500000 -1
+bone vertex texture bone
+bone frame 0.500000 vertex anim anim = frame bone 0.500000
+0.500000 texture texture anim
+0.500000
+vertex
+= frame
+vertex
+anim -1
+anim anim -1 1.0 =
+texture 1.0 texture frame vertex bone vertex = vertex 1.0 1.0 texture = texture bone material frame
+1.0 1.0 frame 1.0 anim texture -1
+vertex -1 material texture vertex = anim anim
+frame vertex bone
+bone anim frame -1 -1 vertex frame
+texture = =
+bone -1 bone material 1.0
+anim vertex = bone texture = 1.0
+0.500000 0.500000
+frame
+-1 0.500000 frame
+bone vertex texture
+bone anim -1
+0.500000
+1.0 bone texture 1.0 anim texture frame
+bone 1.0 1.0 texture
+texture 0.500000
+vertex
+material anim = 0.500000
+= frame -1 = bone bone material
+frame texture 1.0
+1.0 texture -1 1.0 1.0 = vertex =
+texture frame -1
+-1 texture 0.500000 anim = bone anim 0.500000 bone material = texture anim 0.500000 anim material vertex 1.0 anim
+anim frame texture vertex 0.500000 texture vertex -1
+-1 0.500000 1.0 material
+=
+-1 frame vertex material 0.500000 bone 1.0 anim
+vertex
+bone texture material frame
+frame
+bone
+= bone -1 vertex -1 frame
+texture material
+anim -1
+1.0
+frame
+vertex vertex
+frame
+-1
+anim 0.500000 =
+-1
+vertex texture 0.500000 0.500000 anim texture frame frame 0.500000 material bone texture material
+-1
+texture 0.500000 0.500000 material vertex bone
+frame material 1.0 -1 frame 1.0
+=
+1.0
+texture 1.0 anim
+0.500000 bone
+vertex 0.500000
+-1 frame -1 frame material
+1.0 bone frame bone texture frame texture anim frame 0.500000 bone -1 bone
+material anim
+texture
+vertex 1.0 =
+texture
+frame material 0.500000
+0.500000
+frame anim bone texture -1 = frame
+material 0.500000 bone 1.0
+texture frame
+anim
+-1 bone
+bone anim -1 texture 1.0 0.500000 0.500000 -1
+anim frame
+frame material
+-1 1.0 1.0 anim texture = anim
+material 1.0 bone 0.500000 = -1
+= texture bone
+bone bone anim
+frame
+=
+anim material = anim vertex -1 bone
+frame
+texture
+0.500000 frame vertex
+vertex material 0.500000
+-1 1.0 material
+anim bone 1.0
+0.500000 bone anim material material material
+1.0 vertex
+0.500000 0.500000 = material anim
+-1 material
+texture anim vertex material 1.0
+frame vertex
+bone texture anim bone anim texture
+-1 material
+1.0 -1 -1 bone vertex = material bone vertex
+= anim vertex vertex =
+frame material material
+-1 anim = bone texture
+bone = vertex 1.0
+= bone 1.0 frame =
+1.0
+texture -1
+bone anim material frame = -1 -1
+texture bone material
+anim = 1.0 0.500000 bone vertex = texture texture 1.0 = -1 0.500000 =
+-1 =
+0.500000 bone
+0.500000
+bone
+material
+-1 = texture frame 1.0 frame frame anim vertex =
+0.500000 -1 material frame -1 material anim vertex
+frame vertex anim vertex frame = 1.0
+texture
+texture = texture texture 1.0 0.500000
+= frame vertex vertex anim frame 1.0
+material
+-1 0.500000 1.0 texture = anim frame
+= 0.500000 = texture texture vertex texture
+anim -1
+texture material =
+anim texture
+bone = bone =
+anim 0.500000 material 1.0 1.0 bone
+= = 0.500000 vertex frame -1 texture 0.500000 0.500000 material 1.0
+-1 frame
+1.0 0.500000 -1 = bone texture bone frame f
\ No newline at end of file
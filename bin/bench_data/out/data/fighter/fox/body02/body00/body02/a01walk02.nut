@@ -0,0 +1,149 @@
+0.500000 = 1.0 texture material
+material -1 0.500000 anim
+bone anim -1
+vertex material material texture frame
+frame
+-1 bone
+0.500000 bone texture vertex 1.0
+-1 bone 0.500000 1.0 0.500000 material
+anim = bone texture
+-1
+0.500000
+vertex
+frame texture 0.500000 frame
+bone material bone bone material vertex material anim texture
+0.500000 1.0
+bone material frame texture 1.0 frame bone -1
+texture
+anim texture anim -1 material vertex -1 frame bone
+material frame bone bone bone -1 -1 material
+-1 material bone material
+bone 1.0 0.500000 material material
+vertex
+0.500000 frame 0.500000
+material vertex vertex = frame 1.0
+frame = bone material = anim vertex anim = texture
+material
+material bone
+-1 vertex 1.0
+vertex texture material
+1.0 material
+frame
+1.0 -1 texture
+frame 0.500000 vertex frame 1.0
+bone
+1.0
+-1
+1.0 vertex
+texture
+-1
+material = -1
+material
+bone
+vertex bone = material texture material bone
+anim =
+1.0
+frame 1.0 bone texture 1.0 material frame anim 0.500000
+-1 anim texture = texture
+vertex
+texture bone
+-1
+material
+1.0
+-1 material -1
+texture
+0.500000 0.500000
+bone
+1.0 texture anim material 1.0 =
+bone = frame texture material bone material
+-1
+anim -1 bone anim anim
+anim = 0.500000 frame
+0.500000
+= -1 frame 1.0 vertex -1
+-1 1.0 frame 0.500000 material 0.500000 anim anim = vertex
+0.500000 anim vertex vertex anim
+= texture anim
+texture
+1.0
+bone
+bone
+anim bone material material frame bone texture bone = 0.500000 0.500000
+vertex frame frame = =
+anim texture
+0.500000
+material bone bone 1.0 -1
+anim
+frame
+0.500000 0.500000 -1 material vertex 1.0 frame material
+= -1 vertex vertex 0.500000 0.500000
+material
+vertex anim = anim -1
+0.500000 1.0 bone
+-1
+-1
+vertex
+material material
+1.0 0.500000
+anim anim 1.0
+vertex material anim 1.0 1.0
+material bone
+texture material texture vertex anim -1 material -1 -1 1.0 1.0 frame
+vertex -1
+vertex
+bone 1.0
+1.0
+-1 = -1 0.500000 0.500000 1.0 -1 1.0
+material
+material material vertex 0.500000 material material anim 0.500000
+vertex bone texture = vertex 0.500000 1.0
+anim texture material 0.500000
+frame anim 0.500000 anim
+anim
+frame
+texture texture
+bone vertex -1 -1
+-1 material
+material
+-1 anim anim vertex frame texture
+= -1
+bone
+vertex =
+0.500000 bone
+bone
+bone material 0.500000 =
+0.500000 bone -1 texture
+0.500000 bone -1
+bone texture = -1 frame anim bone 0.500000
+1.0
+vertex = material
+frame frame
+anim bone = 1.0 anim
+0.500000
+anim frame
+frame bone anim 0.500000 anim 1.0
+0.500000 1.0 0.500000 0.500000 -1 0.500000 frame vertex
+texture anim = frame frame -1 frame
+vertex
+0.500000
+= 0.500000 -1 anim material =
+anim bone anim =
+texture -1 0.500000 vertex frame vertex material 0.500000 material
+1.0 material bone
+texture = =
+= bone anim
+-1 bone vertex material 0.500000 material bone 0.500000
+bone
+bone 1.0 bone material
+anim
+1.0
+frame = texture texture = -1 material texture frame anim -1 frame
+anim
+bone
+anim material material 1.0 bone 1.0 texture -1 vertex
+bone 0.500000
+0.500000 vertex -1 = 0.500000
+0.500000
+material material
+texture bone -1 1.0 frame
+1.0 1.
\ No newline at end of file
@@ -0,0 +1,37 @@
+0.500000 anim =
+vertex
+1.0 texture
+-1 anim anim -1
+=
+bone vertex
+bone 0.500000
+= vertex bone 0.500000
+frame
+1.0 =
+material vertex texture frame bone
+0.500000
+vertex
+0.500000 frame 0.500000 anim texture vertex
+frame
+vertex material
+0.500000 0.500000 bone
+0.500000 = = material = bone 1.0 texture
+-1 bone
+0.500000 bone
+vertex 1.0 -1 1.0 anim
+anim vertex vertex 1.0 texture
+frame vertex bone bone 0.500000 -1 = 1.0 frame 0.500000 0.500000 vertex frame vertex 1.0
+frame -1 anim = = 1.0
+= 1.0 0.500000 -1
+anim vertex -1 1.0
+-1 anim bone
+1.0 anim texture texture frame material 0.500000 anim -1 anim
+frame = -1 anim frame -1 vertex texture = material texture vertex = vertex 0.500000 0.500000 = -1 = material = 1.0
+frame -1 -1 bone bone anim bone -1 vertex
+texture -1 anim anim anim vertex texture = bone 1.0 anim 1.0
+1.0 = 0.500000
+frame bone
+texture
+vertex texture = 1.0 frame
+frame texture bone
+= = bone frame frame texture -1
\ No newline at end of file
@@ -0,0 +1,247 @@
+material vertex vertex frame material
+1.0 bone vertex anim
+texture
+material 1.0 -1 0.500000 anim 1.0 = 0.500000
+0.500000 0.500000 bone -1
+anim 0.500000 -1 0.500000 frame anim
+bone frame
+anim vertex vertex 0.500000 frame anim texture 0.500000 vertex anim frame
+frame material material anim anim
+texture 0.500000 = = frame
+bone = material
+texture = 0.500000 material vertex texture
+frame anim -1 anim = anim bone vertex
+anim -1
+anim vertex
+=
+-1 material
+material
+vertex -1 vertex anim anim vertex = 0.500000
+0.500000 anim = material frame 1.0 0.500000 frame vertex 1.0 =
+0.500000 0.500000 vertex -1 -1 anim frame 1.0 anim vertex texture frame anim frame
+0.500000 1.0
+material 0.500000 0.500000
+vertex anim bone 0.500000 bone vertex 0.500000 1.0
+texture -1 frame anim anim 0.500000
+anim material anim
+=
+anim
+anim 0.500000 bone anim
+texture
+vertex
+frame frame = anim 0.500000 material texture bone vertex material -1 texture frame 1.0 anim = 0.500000 anim 1.0
+bone bone 0.500000
+texture material
+bone 0.500000 1.0 texture anim -1
+texture frame 1.0 -1
+0.500000 frame
+material
+-1 texture
+vertex
+0.500000 texture texture texture vertex -1
+1.0 vertex
+anim bone
+material vertex frame
+0.500000 anim 1.0 1.0 0.500000
+= frame
+1.0 anim
+=
+bone 1.0
+0.500000 material 1.0 -1 -1 material -1 anim texture
+= texture frame
+frame = -1 frame = vertex bone material texture 1.0 material frame texture
+texture texture
+0.500000 -1 anim frame -1
+1.0
+= = anim bone
+frame
+0.500000 -1
+material
+= bone frame bone
+vertex
+= anim = anim
+frame
+texture vertex -1
+anim material
+material = material material
+vertex
+anim bone texture 1.0
+anim
+= vertex texture vertex
+1.0 =
+frame
+1.0
+frame
+texture -1 0.500000 anim anim anim material 1.0 0.500000
+bone
+vertex -1
+1.0
+texture 1.0
+bone material
+0.500000 = bone -1 bone
+anim
+vertex 1.0
+material
+material
+-1 frame
+anim 1.0 material 1.0 frame 0.500000 frame material -1 material 0.500000 -1 0.500000 -1 anim -1
+anim bone
+bone 1.0 anim vertex texture frame
+=
+bone
+=
+anim vertex
+bone 0.500000 = =
+1.0 1.0 0.500000 anim -1 anim 1.0 bone material
+material 0.500000 texture
+=
+1.0 anim
+texture bone
+frame material texture vertex material -1 texture frame frame material
+texture 1.0 -1
+texture 1.0 = -1 =
+texture 1.0 1.0
+= = texture
+bone bone bone -1 vertex material
+1.0 frame vertex
+-1 frame 1.0 anim
+= -1 1.0
+0.500000 texture
+frame
+texture 1.0 frame
+0.500000 texture frame
+anim texture -1 material -1 1.0 bone 0.500000 bone 0.500000 0.500000 bone -1 -1
+0.500000 1.0 1.0
+material
+anim 1.0
+frame vertex 1.0 material bone 1.0 frame 0.500000 vertex
+vertex texture 1.0 = vertex frame material
+vertex -1 1.0
+material material anim = frame 1.0 vertex anim 1.0 -1 =
+1.0 1.0
+bone 0.500000 -1 = -1
+bone frame
+bone material anim bone 1.0 1.0 material 0.500000 -1 anim = 1.0 vertex = = material -1 texture
+0.500000 bone frame material
+-1 0.500000 = material texture material -1
+anim 0.500000 0.500000 = vertex material anim anim frame
+frame material frame bone bone
+bone = 1.0 anim
+bone = -1
+0.500000 -1
+0.500000 1.0
+= texture anim
+vertex
+bone bone 0.500000 1.0 frame -1 0.500000 frame = = vertex
+material
+-1 bone
+frame
+anim
+0.500000 texture vertex vertex
+texture = vertex
+1.0 frame
+= material 0.500000 anim 1.0
+anim
+1.0
+anim vertex texture
+1.0
+frame =
+0.500000 anim
+texture
+bone material
+=
+texture -1 -1 1.0 = texture anim
+anim texture frame
+frame bone texture
+material -1 texture
+-1 texture -1
+texture vertex bone 0.500000 -1 1.0 frame
+bone frame texture 0.500000 vertex anim material
+bone vertex
+1.0 =
+frame -1
+vertex bone frame texture 1.0 anim vertex
+-1
+1.0 1.0 anim -1
+material -1 0.500000
+vertex 0.500000 0.500000 material
+= vertex texture material material anim
+-1
+bone bone frame = vertex material texture 1.0 -1 anim
+frame texture 1.0 -1 0.500000
+material = anim
+bone bone anim vertex
+bone anim 0.500000 frame frame -1 =
+material vertex -1 1.0
+-1 bone anim frame
+=
+1.0 -1 =
+=
+anim
+material
+bone bone material
+bone anim = texture texture texture =
+1.0
+texture texture texture 1.0 bone texture 0.500000 texture
+texture
+1.0
+texture 0.500000 1.0 vertex -1
+1.0 vertex
+material
+material 0.500000
+vertex 0.500000 1.0 vertex -1 -1 material
+anim = texture anim
+frame material 0.500000
+texture texture -1
+0.500000 1.0 -1 0.500000 0.500000 vertex = texture texture texture anim -1 texture anim
+=
+1.0 frame -1 1.0 0.500000
+material 0.500000 -1 anim
+anim
+-1
+texture texture
+=
+bone frame
+texture anim 1.0 = -1 -1 material
+-1 anim texture frame -1 -1 material
+-1 0.500000
+material -1 texture anim
+= -1 anim -1 texture frame 1.0 =
+-1 frame vertex
+texture
+anim
+texture
+frame = anim bone material
+frame
+frame frame =
+= bone = texture bone
+vertex vertex
+bone anim frame
+frame
+= texture -1
+bone anim -1
+-1 anim
+0.500000 0.500000 1.0
+vertex frame 0.500000 0.500000 material -1 -1
+bone anim bone
+frame 0.500000
+bone vertex frame texture
+1.0 anim anim anim
+1.0 frame = anim texture
+material vertex bone
+-1 -1 frame frame bone
+=
+texture
+bone 0.500000 anim =
+= material
+vertex 1.0
+material
+= frame texture anim vertex
+frame material vertex bone frame
+material frame texture 0.500000 -1
+bone 0.500000
+material anim bone
+= texture 0.500000 0.500000 -1 texture texture
+frame frame 1.0 =
+frame 0.500000 vertex
+1.0 texture texture 1.0 frame anim fr
\ No newline at end of file
@@ -0,0 +1,16 @@
+frame vertex texture anim frame 0.500000 bone = frame
+frame -1 -1 material frame material material material material
+1.0 -1 1.0 texture 1.0
+material = -1 1.0 texture anim anim
+bone -1 -1 texture material -1
+bone -1 anim vertex
+0.500000 frame anim -1 = bone 1.0 -1 =
+1.0 vertex material anim material 0.500000
+anim 1.0 anim 0.500000 = material anim vertex -1 =
+material 1.0 vertex 0.500000 material 1.0
+vertex
+bone
+= material bone = = frame -1 frame
+0.500000 anim -1 anim 1.0 anim frame = -1
+vertex material
+verte
\ No newline at end of file
@@ -0,0 +1,255 @@
+-1 -1 texture
+bone texture bone
+= texture frame material
+anim anim
+frame texture texture
+material = -1 = material
+0.500000 texture
+-1 bone
+vertex =
+texture material frame -1
+0.500000 = material texture vertex material texture frame material
+material bone vertex
+1.0 texture frame
+= frame 1.0 bone 1.0 vertex =
+bone 0.500000 0.500000 anim anim 1.0
+-1 material -1
+texture vertex bone
+=
+0.500000 0.500000
+0.500000 material = vertex
+texture -1 anim
+anim bone
+0.500000 -1 texture
+vertex 1.0 bone material frame bone 1.0 frame material = texture
+frame 0.500000 frame
+texture frame anim bone 1.0 bone 1.0 1.0
+vertex texture vertex -1 vertex frame 1.0 texture -1 frame
+bone =
+1.0 = frame 1.0 bone
+=
+anim
+anim material bone 0.500000 frame frame 1.0 bone texture
+bone =
+-1 0.500000
+material -1 anim 1.0 texture texture -1
+frame material bone vertex
+= bone vertex 0.500000 -1 frame texture
+0.500000 = = material bone 0.500000
+anim vertex vertex vertex 1.0
+anim
+material material 1.0 bone anim vertex
+texture texture -1 0.500000 -1 anim bone frame material 1.0 anim vertex 0.500000 anim material anim 0.500000
+1.0
+frame texture
+material
+material = 1.0 -1 1.0 material 1.0
+-1
+material 1.0 1.0 texture
+0.500000 material 1.0 bone = bone
+frame
+1.0 = -1 bone vertex frame texture
+material bone 0.500000 1.0
+1.0 = = vertex
+texture
+= 0.500000 material material frame texture
+anim 1.0 anim vertex anim
+anim 0.500000 = frame frame texture material frame anim texture bone 1.0
+material vertex frame
+bone = material
+bone -1 1.0 material material bone
+texture anim
+vertex vertex
+frame
+= anim
+material -1 bone frame material vertex vertex
+vertex anim
+1.0 material material bone
+=
+material vertex material = 1.0 texture bone 0.500000 anim material -1 vertex bone texture texture frame 1.0 texture frame = frame bone texture texture
+anim frame -1 vertex
+texture vertex texture = 0.500000 texture = anim vertex frame -1
+bone
+0.500000 1.0 vertex 0.500000
+material
+material
+= bone bone -1 frame
+texture = = texture =
+anim = = texture
+texture -1 anim bone bone = = 1.0 texture texture material -1 frame anim vertex vertex
+1.0
+frame texture 1.0 texture -1 1.0 -1 material
+= 1.0
+= anim = anim 0.500000 -1 anim frame 0.500000
+frame material vertex 1.0 material -1
+frame -1 1.0 =
+vertex 0.500000 vertex frame
+vertex anim 0.500000 texture =
+texture = frame = 1.0 =
+material texture vertex -1
+anim
+=
+frame
+0.500000
+-1
+vertex
+anim 0.500000 texture -1 =
+anim texture vertex
+0.500000
+vertex 0.500000 -1 vertex -1 vertex
+texture -1
+0.500000 vertex -1 0.500000 anim
+anim bone
+0.500000 texture vertex -1 bone texture vertex 0.500000 = anim texture
+frame texture frame frame bone frame bone material 0.500000 material = frame 1.0 -1 vertex vertex texture
+vertex bone texture
+bone
+anim -1
+anim bone -1 -1 -1 texture 1.0 material 1.0 anim
+texture anim 1.0 -1
+vertex material = 1.0
+anim frame vertex -1 frame -1 0.500000 = frame 1.0 frame anim
+1.0 vertex frame anim -1 bone vertex
+-1 texture
+frame = vertex
+-1
+0.500000 vertex
+frame anim -1
+0.500000 texture 0.500000
+frame vertex anim vertex bone vertex
+frame bone vertex 0.500000 0.500000 texture texture anim material
+anim frame
+texture texture 1.0
+material
+anim 0.500000
+material vertex 1.0
+texture texture
+frame 1.0 -1 bone -1
+1.0 -1 0.500000
+vertex 0.500000 bone frame material
+bone texture
+-1 anim 0.500000 material texture
+1.0 0.500000 texture
+texture
+vertex vertex texture 1.0 = 1.0
+anim vertex
+vertex 0.500000 texture 0.500000 0.500000
+vertex 0.500000 0.500000
+anim vertex 1.0 bone
+-1 texture -1 vertex -1 0.500000 = =
+texture -1 anim
+anim material texture texture
+1.0
+= texture 1.0 frame
+material material -1 anim vertex texture material 0.500000 0.500000
+anim texture material =
+anim
+texture 0.500000 bone vertex
+texture
+1.0 1.0 0.500000 bone anim 1.0 bone
+bone 1.0
+vertex frame
+material material material material texture anim texture frame frame
+material -1 bone
+frame
+0.500000 frame material texture =
+=
+anim
+1.0 vertex
+frame 1.0
+texture
+material
+0.500000 = 0.500000 0.500000 0.500000 1.0
+-1 material material bone texture 0.500000
+anim frame
+texture -1 anim vertex 0.500000 -1 material frame = =
+1.0 -1 vertex
+0.500000 -1 = 0.500000 vertex bone 1.0
+-1 bone
+-1 =
+frame
+0.500000 1.0 0.500000
+= frame frame 0.500000 material texture
+1.0
+material 1.0 vertex frame vertex 0.500000
+=
+0.500000
+1.0 anim texture -1 = vertex frame anim
+frame texture 1.0 vertex
+material -1 material
+anim material 0.500000 anim 0.500000 bone
+vertex
+bone
+bone bone = anim
+vertex
+vertex anim 1.0
+texture texture = bone bone =
+anim texture anim
+bone anim texture
+material 1.0 anim
+anim
+1.0 anim
+= bone anim anim 1.0 = anim bone 1.0 anim material 1.0 bone anim
+vertex bone
+= -1 1.0 material
+= material frame texture 0.500000 material frame 1.0 bone -1
+1.0 material
+material bone
+= material 0.500000 vertex texture material
+material bone anim
+-1 bone material
+1.0 bone -1 bone
+frame
+0.500000
+1.0 vertex texture vertex
+texture
+bone anim
+= bone = frame 0.500000 -1 0.500000 0.500000 bone 1.0 texture 1.0 frame bone 1.0 texture vertex = bone frame material
+texture texture
+frame
+texture = 1.0 -1 0.500000 anim 0.500000 -1 1.0 material material vertex anim 1.0 texture 1.0 anim 0.500000 0.500000
+vertex texture = 1.0 bone 1.0 frame anim anim -1 vertex -1
+material texture
+material 0.500000 texture -1 frame
+texture
+vertex anim
+material
+0.500000 1.0 bone 1.0 0.500000 -1 texture anim 0.500000
+0.500000 0.500000
+vertex = anim -1 1.0 frame
+anim = -1
+-1 texture vertex bone
+0.500000 bone 0.500000 vertex
+0.500000 vertex material
+frame bone
+1.0
+-1
+0.500000 -1
+= =
+texture
+anim 0.500000 material texture bone material
+vertex 0.500000 material texture vertex -1
+frame 1.0
+1.0
+vertex 0.500000 bone
+frame anim
+1.0 1.0 texture = = = = material 1.0 =
+-1 texture vertex
+material 0.500000
+frame bone texture
+bone vertex frame material = -1 vertex vertex texture vertex
+1.0 texture
+bone vertex anim bone 0.500000 texture material 0.500000 anim = anim
+frame =
+=
+frame frame
+frame = vertex -1 = bone anim material
+1.0 vertex vertex
+vertex bone = -1
+0.500000 0.500000 texture
+anim -1 0.500000 vertex = frame 1.0 0.500000 frame -1 material texture bone material anim
+vertex texture
+frame bone frame 0.500000
+material texture
+vertex anim -1 anim bone vertex texture
+frame vertex frame -1 bone 1.0 
\ No newline at end of file
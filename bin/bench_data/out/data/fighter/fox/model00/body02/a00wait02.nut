@@ -0,0 +1,10 @@
+vertex
+vertex vertex vertex
+frame = bone -1 = bone = 1.0 -1 texture anim
+anim 1.0 = material
+anim bone 1.0 0.500000 frame
+0.500000 texture
+anim bone material -1 frame anim
+frame
+-1 =
+texture material materi
\ No newline at end of file
@@ -0,0 +1,261 @@
+1.0
+texture 1.0 bone material vertex material
+bone = 0.500000 -1 material 1.0 bone material anim frame 0.500000 = texture material
+1.0 anim vertex -1 frame 0.500000 material =
+vertex
+frame
+material
+0.500000 0.500000 bone anim = anim bone
+frame bone -1
+frame frame
+0.500000 0.500000 vertex texture material -1 vertex = vertex = 0.500000 texture = 1.0 0.500000
+frame
+anim
+vertex texture bone frame texture 0.500000 texture texture material bone frame 0.500000
+1.0 texture 0.500000 vertex
+vertex frame
+-1
+vertex
+= 0.500000 anim 0.500000
+-1 texture frame -1 1.0 anim
+1.0
+-1 0.500000 0.500000 anim
+texture
+anim
+-1
+-1 anim 0.500000 anim 1.0 bone
+frame vertex 1.0 0.500000 -1
+texture 0.500000 -1 anim
+vertex material bone = texture bone texture anim -1 = texture frame
+bone 1.0
+= anim texture frame
+texture -1
+vertex 1.0 vertex vertex vertex material vertex
+frame texture frame anim anim frame
+anim texture
+bone = material bone 0.500000 texture
+vertex
+frame frame frame material frame texture material 1.0 vertex = frame -1 = frame texture material 1.0 material material
+bone 1.0 = texture anim
+texture material vertex = bone vertex vertex bone bone
+anim vertex 1.0 material 0.500000 = bone texture 1.0 1.0 vertex material bone
+-1 -1
+anim material frame
+anim
+frame vertex texture anim =
+material = 0.500000
+1.0
+0.500000 1.0 -1
+=
+bone
+1.0 anim 0.500000 = bone anim
+anim anim
+vertex
+material
+bone anim
+texture 1.0
+1.0
+-1 1.0 0.500000 texture bone = material anim
+-1 frame -1 bone
+0.500000 vertex 1.0 material -1 texture
+bone anim
+frame material
+= texture 1.0 material
+material
+texture bone 1.0
+0.500000 bone material frame
+bone vertex = =
+1.0 = frame anim material
+-1 1.0
+texture 1.0 material bone
+0.500000 anim 0.500000 frame
+anim vertex material frame texture material 1.0 anim = frame vertex frame -1 material
+1.0 = material = 0.500000
+anim 0.500000 material
+anim
+1.0 texture
+-1 -1 frame 1.0 = anim 1.0 material -1
+0.500000 bone
+frame
+1.0 anim material bone vertex
+-1 texture
+anim material
+anim
+vertex texture = anim vertex
+anim
+texture 1.0 material bone bone 1.0
+1.0
+texture
+texture material = 0.500000
+frame
+material -1 0.500000 0.500000
+=
+texture bone frame 1.0 material bone -1 vertex
+frame = frame
+-1 texture 1.0 vertex
+anim vertex frame = frame vertex
+-1 bone
+1.0 texture
+anim
+1.0 vertex = frame anim frame
+0.500000 material -1 frame texture material material = anim frame bone
+material bone -1 frame texture material
+vertex bone
+anim
+material anim = 1.0 0.500000 frame material texture = 0.500000 -1 texture
+bone
+0.500000 frame texture -1 vertex material bone 0.500000 texture bone
+frame -1 = 1.0 = frame = vertex
+= material
+-1 -1 0.500000 bone -1 frame frame
+material =
+bone 0.500000
+= bone vertex
+vertex anim material 1.0 1.0 vertex
+texture texture 1.0 frame
+anim material bone material vertex vertex 1.0
+bone 0.500000
+0.500000
+1.0 vertex
+0.500000 0.500000 1.0 bone = anim -1 texture material anim
+0.500000
+frame bone -1 anim
+anim material = anim -1
+bone = texture
+0.500000 texture = bone material
+anim texture vertex texture texture 1.0 anim texture anim vertex frame bone vertex anim frame
+=
+material = vertex = frame material vertex vertex
+frame anim 1.0 1.0 1.0 texture 0.500000 -1 bone
+texture 0.500000 bone -1 texture -1 1.0
+1.0 material
+anim 1.0
+anim
+0.500000 frame material texture frame texture = anim
+vertex -1 texture bone
+material 1.0 bone material bone texture 1.0 material
+-1
+= material material
+frame material
+-1
+vertex 0.500000 texture frame vertex anim frame texture 1.0
+= anim 0.500000 frame frame
+0.500000
+vertex
+texture frame = -1 material texture -1 0.500000 -1 1.0 -1 0.500000 anim -1
+texture material
+0.500000 bone frame 1.0 0.500000 1.0
+= bone -1 anim
+0.500000
+0.500000
+frame
+anim anim texture material 1.0 -1 = -1 frame
+-1 0.500000 anim vertex = 1.0
+-1
+frame
+anim
+0.500000 1.0 0.500000 material material frame frame
+1.0 0.500000 = frame frame 1.0
+-1 texture
+bone
+= vertex 1.0 frame 1.0 frame texture texture material 1.0 frame -1 vertex
+0.500000 texture anim
+bone
+anim 1.0
+vertex
+0.500000
+frame vertex
+bone bone -1 texture material
+vertex frame texture texture frame vertex = 1.0 bone
+1.0 bone
+material texture vertex vertex anim frame anim 1.0 material vertex vertex -1 anim =
+0.500000 0.500000
+texture
+anim
+vertex frame
+-1 0.500000 = 0.500000
+= frame 0.500000 vertex -1 frame vertex texture vertex anim vertex texture vertex frame bone anim = bone 1.0 = material
+=
+-1
+bone anim 0.500000 vertex vertex material material
+material -1 bone 0.500000 vertex 1.0 vertex anim vertex
+bone anim
+0.500000 -1 -1 vertex -1
+-1 -1 texture
+1.0
+-1 bone 1.0 vertex vertex 0.500000 texture material
+-1
+0.500000
+vertex material vertex 0.500000 bone -1
+1.0 anim
+vertex vertex
+1.0
+frame anim -1 1.0
+0.500000
+frame anim
+vertex 0.500000 bone
+= -1
+texture -1 -1 1.0 texture 1.0 texture = -1 frame material -1
+frame vertex bone 0.500000
+1.0 bone 1.0
+texture
+bone
+frame frame
+texture 1.0 1.0 1.0 1.0 frame material
+material 1.0 anim material
+-1 1.0
+vertex 1.0
+= frame 1.0 -1 material vertex
+vertex texture frame -1 anim vertex 1.0 -1
+=
+bone 0.500000 0.500000 bone = material vertex frame anim bone anim 1.0
+-1
+anim texture bone 0.500000
+1.0
+bone bone 0.500000
+= material texture material
+= texture 1.0 anim
+1.0 vertex
+frame
+texture vertex frame
+-1
+1.0 texture = -1 anim
+bone 1.0 anim 1.0 -1
+frame bone anim 1.0
+1.0 material
+material
+texture bone
+-1 material
+-1 anim
+= anim anim
+vertex material material = = material anim -1 -1
+-1 0.500000 bone 1.0 texture bone material
+texture
+anim -1 bone =
+0.500000 vertex 1.0 1.0 vertex 0.500000
+-1 vertex 1.0 anim vertex = texture = 1.0 anim = =
+anim
+-1 =
+vertex anim anim texture vertex texture
+texture material
+-1 frame
+0.500000 anim
+material vertex bone
+frame material 0.500000 -1
+= vertex vertex anim 0.500000
+0.500000 vertex 0.500000 texture vertex bone
+bone material bone
+= texture
+frame
+bone 1.0
+material
+vertex -1 -1
+texture
+=
+frame 0.500000
+0.500000 1.0 =
+material = 0.500000 frame
+texture -1 = =
+material texture
+material bone bone
+materi
\ No newline at end of file
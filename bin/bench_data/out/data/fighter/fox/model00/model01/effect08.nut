@@ -0,0 +1,19 @@
+bone bone bone texture frame anim
+texture anim
+anim
+anim = vertex -1 =
+frame
+anim 0.500000 -1 =
+0.500000
+anim
+1.0 = frame
+vertex
+vertex 1.0 frame
+1.0 0.500000 vertex vertex -1 texture frame = material 0.500000 = texture
+anim
+anim bone bone 0.500000 anim bone = frame bone anim vertex = 0.500000 bone vertex -1 material 1.0 vertex frame frame bone = -1
+material texture
+anim material
+0.500000 = bone
+vertex
+= texture = -1 mate
\ No newline at end of file
@@ -0,0 +1,105 @@
+1.0
+= material frame -1
+frame
+texture
+texture texture
+1.0 vertex 1.0 1.0 0.500000
+0.500000 1.0 frame 1.0 -1
+-1 -1 anim -1 1.0 vertex anim frame = 1.0 anim vertex texture
+texture 1.0 material bone
+= bone bone 1.0 frame
+= frame texture 0.500000 vertex 0.500000 bone bone 0.500000 texture anim 0.500000
+0.500000 0.500000 anim texture frame frame
+vertex vertex
+texture texture
+=
+= 1.0 vertex frame
+material = bone
+0.500000
+material texture
+texture vertex bone = frame 1.0 bone texture 1.0 anim
+texture 0.500000
+vertex material -1 vertex -1 anim anim material material
+material
+material = -1 material = anim texture texture texture 1.0 texture 0.500000
+-1
+material bone -1 frame anim 1.0 vertex material
+texture
+material anim anim = 0.500000
+-1 -1 1.0 material texture frame bone anim 0.500000 vertex = 1.0 = 0.500000 -1 vertex 1.0
+bone 0.500000 -1 anim anim
+material
+=
+anim = 0.500000 1.0
+= -1
+= 0.500000 vertex bone
+bone material vertex frame
+anim texture texture 0.500000 anim = anim material bone =
+vertex -1 bone =
+1.0 texture frame anim -1 bone anim vertex 1.0 =
+0.500000 texture bone frame material frame material material
+anim frame
+anim 1.0
+anim 1.0 texture
+anim bone
+0.500000 -1
+0.500000 vertex -1 =
+frame material anim vertex texture
+texture 1.0
+-1 = frame material 0.500000
+texture material material 1.0 texture
+material
+bone -1 vertex bone material texture material 0.500000 bone
+0.500000 vertex
+vertex 1.0 bone
+0.500000 = vertex
+texture
+= anim vertex -1 texture anim 1.0 1.0 texture anim 1.0
+vertex -1
+bone frame
+0.500000 anim vertex
+frame
+texture texture
+1.0
+frame 1.0
+vertex texture = vertex 1.0 anim material
+=
+1.0
+-1 bone = material bone frame =
+= material
+0.500000 frame anim bone vertex frame = anim 0.500000
+bone frame
+vertex -1 -1 bone vertex
+=
+bone texture frame material 0.500000 material 0.500000 anim bone 1.0 texture
+1.0 -1
+frame vertex
+0.500000 -1 vertex texture material = texture
+-1 = frame 0.500000 0.500000 1.0
+0.500000
+bone
+-1 bone
+material texture = 0.500000 -1 frame
+anim anim
+frame frame 1.0 0.500000
+frame -1 texture
+0.500000 anim texture texture
+vertex = = 1.0 bone
+-1 = texture material
+-1
+bone
+-1
+material 1.0 -1
+-1 0.500000
+vertex = = =
+=
+anim
+= frame
+-1 vertex
+bone anim
+anim 0.500000 0.500000
+frame
+= vertex vertex frame
+0.500000 vertex
+material texture frame texture bone = frame
+1.0 1
\ No newline at end of file
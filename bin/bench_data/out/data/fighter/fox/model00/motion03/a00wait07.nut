@@ -0,0 +1 @@
+texture = anim 0.500000 vertex mat
\ No newline at end of file
@@ -0,0 +1,8 @@
+= -1 = -1
+frame vertex vertex texture 0.500000 1.0 anim = anim
+=
+-1 0.500000 material
+= = -1
+-1
+bone anim 1.0
+material text
\ No newline at end of file
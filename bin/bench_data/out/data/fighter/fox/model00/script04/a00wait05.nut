@@ -0,0 +1,19 @@
+vertex material
+texture vertex frame = material -1 = material 0.500000 0.500000 bone 1.0 texture
+texture
+anim frame
+frame bone 0.500000 material -1
+= = material
+= -1 material frame
+anim vertex
+0.500000
+texture texture bone vertex bone bone texture
+1.0 1.0
+texture frame bone texture texture = bone
+vertex frame
+anim -1 material = = anim
+1.0 material texture material 1.0
+vertex bone 0.500000 vertex bone texture material texture
+frame bone texture = = anim frame
+bone anim
+1.0
\ No newline at end of file
@@ -0,0 +1,285 @@
+-1 bone frame texture texture
+anim = material
+texture -1 anim 1.0 = =
+0.500000
+1.0 -1
+-1 vertex
+=
+anim frame vertex 1.0 anim vertex vertex frame -1 frame frame
+-1
+0.500000
+frame
+material frame texture frame texture -1 = -1 = material anim
+vertex
+= -1 vertex -1 vertex = material -1 bone =
+= vertex anim frame
+vertex -1
+anim 0.500000
+vertex = anim 0.500000 material anim material bone
+frame
+0.500000 -1 bone frame 0.500000 vertex material = 0.500000 -1 texture bone anim vertex vertex bone
+-1 1.0 0.500000 bone = vertex texture 0.500000
+=
+material = material
+anim 0.500000 bone -1 = 1.0 frame 1.0 vertex texture anim anim texture
+vertex 0.500000 anim anim frame 1.0 vertex
+material -1 = = vertex
+-1 material texture
+1.0
+frame material
+bone 0.500000
+1.0 frame frame
+frame material
+0.500000 material bone material 1.0 vertex 0.500000 anim
+texture 0.500000 -1 1.0 -1 texture bone frame vertex = bone -1
+frame =
+material
+anim
+bone 1.0 frame frame material vertex 0.500000
+anim
+material material
+bone
+texture
+vertex -1 frame
+texture bone bone 0.500000 material anim bone bone vertex bone material 0.500000 material
+anim vertex
+frame -1 0.500000 frame 0.500000 1.0 1.0 anim bone material vertex material 0.500000 material -1 bone texture frame vertex frame =
+= material
+= anim bone
+=
+=
+= =
+vertex
+frame 0.500000 anim
+-1 vertex = =
+texture anim bone
+frame = =
+1.0 1.0 = texture 0.500000 bone texture
+vertex frame anim = 0.500000
+material vertex 1.0 anim
+= anim vertex
+material = bone
+-1
+bone
+vertex
+0.500000
+material bone bone
+anim 0.500000 = anim vertex 1.0
+0.500000 = bone bone -1 bone
+anim material 0.500000 -1 -1 bone
+texture texture frame bone texture
+frame material = -1
+frame = bone material
+texture material =
+material frame texture texture vertex
+material
+anim
+anim 0.500000 -1 texture frame texture vertex anim -1 0.500000 -1 texture
+texture -1 vertex 1.0 0.500000 1.0 frame texture
+anim
+-1 frame = =
+1.0 -1 vertex = = frame =
+0.500000 0.500000 1.0 anim -1 1.0 texture
+bone frame = -1 = material anim 0.500000 -1 1.0 = anim 0.500000
+frame material = 0.500000
+texture frame texture 0.500000 texture texture 0.500000 -1 texture
+0.500000 anim 0.500000 frame
+texture anim
+-1 = texture
+frame
+-1
+frame vertex 1.0
+material
+anim anim bone
+= 0.500000
+frame frame frame -1 1.0 =
+material material texture material
+texture
+texture vertex anim vertex anim anim frame 0.500000 =
+material vertex 1.0 texture material
+0.500000 vertex 1.0 bone material
+texture 1.0 0.500000 anim bone 1.0 -1
+0.500000
+anim anim
+0.500000 = material
+material anim texture
+vertex bone texture 1.0 vertex material vertex =
+= 1.0 0.500000 material
+bone 1.0 material
+bone 1.0 vertex bone anim anim frame 1.0 0.500000 material =
+-1 vertex -1 1.0
+1.0
+bone
+texture 0.500000 -1 0.500000
+= = 0.500000 texture bone anim vertex texture
+frame 0.500000 = frame frame = texture vertex material
+0.500000 vertex =
+-1 anim material
+texture vertex 0.500000 material 0.500000 -1 0.500000 material
+material vertex bone texture
+1.0
+frame material
+frame
+= material vertex 0.500000
+0.500000
+anim vertex bone bone 0.500000
+vertex 1.0
+-1 texture
+0.500000 -1 anim 1.0 texture vertex texture -1 material
+= anim vertex 1.0 1.0 = -1
+0.500000 material -1 =
+material
+bone
+1.0
+-1 anim 1.0
+frame 0.500000 frame
+1.0 = = =
+texture -1 -1
+-1
+material frame
+vertex
+material 0.500000 -1 frame = -1 bone texture bone frame frame 1.0
+-1 vertex bone anim -1
+texture = vertex
+frame 1.0 material anim anim
+bone anim anim 1.0 texture
+= material bone anim
+material texture vertex
+0.500000
+anim vertex
+material texture 0.500000
+bone bone texture frame anim 1.0 anim bone material anim = material
+anim vertex
+anim texture material -1
+vertex bone -1 anim vertex vertex
+-1 -1 -1 vertex = 0.500000
+bone material frame -1 = material frame = = 1.0
+texture 0.500000
+texture 0.500000
+texture vertex frame vertex material vertex 0.500000 bone =
+texture vertex bone anim material vertex = material
+material anim anim
+texture texture
+anim anim = -1 -1
+1.0 0.500000
+1.0 -1 anim texture texture anim -1
+0.500000
+1.0 material frame bone
+0.500000
+1.0 0.500000 frame 1.0
+bone bone = material texture vertex 1.0 texture
+bone 1.0 1.0
+1.0 texture
+-1 bone vertex frame vertex =
+frame
+texture =
+material = frame = = anim texture 0.500000 -1 vertex
+-1 material frame texture vertex material
+vertex texture
+frame texture 0.500000 0.500000 1.0 material -1 vertex
+= frame
+vertex
+anim -1 bone bone = vertex material 0.500000 0.500000 vertex vertex bone bone frame frame = frame texture material vertex
+anim material
+=
+= texture
+-1 0.500000 material = frame
+material frame
+vertex bone 1.0 texture = =
+vertex texture = bone -1 = -1 frame vertex
+1.0 bone vertex = bone = texture
+material vertex material 1.0 -1
+texture -1 texture -1 material texture =
+anim
+bone = texture 1.0
+vertex material texture
+frame
+vertex
+material bone 1.0
+0.500000 bone material = frame vertex = bone
+anim texture vertex
+= texture = frame
+bone texture material frame 0.500000
+= frame
+anim
+bone texture vertex bone = 1.0 1.0 anim texture anim
+anim = -1 vertex material
+texture 0.500000
+material
+texture = 1.0 bone 1.0 material -1 bone
+texture bone =
+vertex frame vertex 1.0
+-1 material frame material
+material
+vertex bone
+1.0 =
+frame bone
+anim vertex vertex
+= = vertex
+vertex 1.0
+-1
+frame frame
+0.500000 frame texture bone material texture anim
+anim
+-1
+material
+texture vertex = bone vertex material texture texture anim bone vertex 1.0 0.500000 bone 0.500000 texture
+1.0 vertex material
+= 1.0
+1.0 vertex = =
+anim frame 0.500000 bone
+frame
+0.500000
+frame
+= material = anim 1.0 1.0 bone -1 = frame 0.500000 = texture bone
+material =
+bone frame
+texture anim vertex 0.500000 -1 1.0 1.0 = -1 anim bone anim
+frame material 1.0 -1
+anim
+bone anim
+frame material
+-1 texture
+=
+-1
+=
+material 1.0 frame -1
+-1 1.0 texture frame 0.500000 frame bone -1 anim bone texture material anim anim material 0.500000 material bone
+vertex bone
+1.0 anim
+bone 0.500000 = material 1.0 = 0.500000 0.500000 = texture anim 1.0 anim
+0.500000 1.0 bone
+frame material vertex
+frame anim anim
+anim
+vertex
+material
+material anim 1.0 frame bone
+-1 1.0 -1 bone -1 frame 1.0
+material vertex -1 texture vertex material material 1.0 material
+0.500000 texture anim vertex frame frame
+1.0 anim 1.0 vertex bone bone = = 0.500000 -1 0.500000 = = =
+anim
+texture frame bone vertex
+-1
+1.0 material vertex bone bone vertex -1
+1.0
+texture
+1.0
+material 1.0
+anim 0.500000 vertex 0.500000 material texture material = anim 1.0 1.0 texture
+texture 1.0 1.0 0.500000 = -1
+vertex
+=
+= -1 1.0
+frame = vertex texture frame
+bone material 0.500000 0.500000
+bone 0.500000 material
+vertex vertex bone 0.500000 texture vertex -1 frame anim = material frame 1.0 frame bone
+anim -1
+texture
+0.500000
+-1 material 1.0 bone bone bone 1.0 bone
+texture bone -1 texture bone frame
+frame bone texture
+frame
\ No newline at end of file
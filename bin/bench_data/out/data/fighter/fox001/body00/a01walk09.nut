@@ -0,0 +1,4 @@
+frame
+bone material
+frame bone bone 0.500000 frame material
+vertex ve
\ No newline at end of file
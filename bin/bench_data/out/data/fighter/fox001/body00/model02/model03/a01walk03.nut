@@ -0,0 +1,51 @@
+1.0 bone anim
+0.500000 vertex
+vertex -1
+anim
+0.500000 texture -1 1.0
+0.500000 = material texture
+material bone texture 1.0 frame 0.500000
+anim anim -1 vertex
+1.0
+= 0.500000 vertex material material anim bone 1.0 0.500000
+texture 1.0 vertex 0.500000
+material 1.0 -1 = material 0.500000 anim 0.500000
+vertex anim 0.500000
+-1 1.0
+1.0 = 0.500000 vertex bone bone
+anim anim texture -1 anim frame frame
+vertex -1 anim
+1.0 bone 1.0 bone 1.0 -1 material anim 0.500000 texture bone
+material
+0.500000 vertex texture 0.500000
+texture -1 bone 0.500000 texture
+1.0
+1.0 frame anim material 0.500000 1.0 1.0 1.0
+texture anim anim frame = material vertex texture anim texture -1 = bone = bone
+vertex
+material
+frame texture texture
+anim
+= material frame material
+-1 anim 1.0 material texture =
+0.500000 bone material texture anim material frame vertex = material
+material
+= texture = 0.500000 texture texture bone
+material frame bone anim vertex 0.500000 = texture bone texture texture 0.500000 material
+-1 vertex
+bone
+vertex = -1
+frame
+frame
+texture =
+vertex -1 bone anim 0.500000
+= 0.500000 = 1.0
+frame
+vertex
+0.500000 material bone anim 1.0
+frame
+0.500000 0.500000 texture
+anim 0.500000 bone anim vertex
+= -1
+bone
+bone texture 1.0 0.500000 anim vertex frame texture 0.500000 
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone frame bone 0.500000 frame frame anim vertex vertex anim 0.500000 anim
+texture texture -1
+material 0.500000 = texture vertex 0.500000 texture
+frame vertex -1 1.0 bone 1.0
+-1 anim bone 1.0 bone bone = 1.
\ No newline at end of file
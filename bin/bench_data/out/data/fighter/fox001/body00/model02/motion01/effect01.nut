@@ -0,0 +1 @@
+anim -1 = texture 0.500000 materia
\ No newline at end of file
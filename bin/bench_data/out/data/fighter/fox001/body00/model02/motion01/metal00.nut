@@ -0,0 +1,33 @@
+material frame 0.500000 material bone 0.500000
+anim =
+material
+bone 1.0 -1 = texture vertex material 1.0
+frame frame 1.0
+material vertex texture
+material
+material vertex
+material bone
+= anim anim
+-1 -1 = anim material frame anim -1 texture
+1.0 frame frame
+= bone vertex -1 frame = material vertex =
+1.0 texture anim texture bone
+0.500000 -1 vertex bone
+bone frame frame frame -1 frame
+anim 0.500000 anim = 1.0 texture
+anim -1 vertex frame material
+vertex 0.500000 vertex bone 1.0 anim
+frame
+1.0 texture vertex
+0.500000 = -1
+0.500000 anim texture anim anim vertex -1
+anim
+vertex
+anim -1 = material
+material bone
+-1 0.500000 anim -1 -1 vertex -1 0.500000 1.0 material -1 -1 anim
+-1 vertex 1.0 -1 material frame
+0.500000 0.500000 0.500000 1.0 texture vertex
+material material
+vertex material -1 = vertex -1 anim texture frame
+= 0.500000 -1
\ No newline at end of file
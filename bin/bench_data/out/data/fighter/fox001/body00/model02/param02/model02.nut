@@ -0,0 +1,194 @@
+1.0 1.0 material
+-1 material
+anim 1.0 -1
+frame vertex
+bone bone 0.500000
+-1 frame bone = anim 1.0 material 1.0 bone
+0.500000
+= vertex
+vertex texture
+1.0 texture
+material anim
+1.0
+frame
+1.0
+-1 0.500000 -1
+-1
+vertex = texture frame 1.0
+-1 material vertex
+=
+vertex vertex 1.0 0.500000 =
+= -1 material vertex material frame
+texture 0.500000 -1 bone vertex
+0.500000
+material material
+-1 = 1.0 frame texture texture frame = = texture 1.0 anim texture bone material texture vertex vertex -1 anim
+1.0 = texture vertex anim anim
+-1 anim -1 -1 texture bone = = bone -1 bone frame frame
+anim anim material 0.500000
+frame
+0.500000 anim texture texture bone -1 material texture vertex anim
+=
+vertex frame
+0.500000
+anim -1 texture
+texture bone =
+anim 0.500000 material vertex = material texture texture texture texture texture
+texture 0.500000 -1
+bone
+material vertex bone
+material material
+material -1 1.0 bone
+bone vertex material
+material anim anim
+vertex frame -1 vertex vertex anim
+bone vertex bone bone 0.500000 frame -1 texture =
+1.0 bone
+anim material frame anim vertex
+-1 frame
+vertex material texture 0.500000 frame vertex
+frame frame =
+material
+0.500000 0.500000 texture
+-1
+bone -1 anim
+bone =
+vertex texture
+bone
+texture 1.0 1.0 vertex texture
+bone
+1.0 anim bone 1.0 texture anim bone = -1 vertex
+0.500000
+vertex 1.0
+texture bone texture material -1 material
+vertex material 1.0
+1.0 bone anim texture
+vertex frame
+0.500000 vertex bone = frame
+-1 vertex frame
+anim vertex material frame vertex
+anim = 0.500000
+1.0 0.500000
+texture
+0.500000 -1 0.500000 -1
+-1
+anim
+texture
+0.500000 -1 0.500000 anim -1 frame 0.500000 frame bone frame material material
+-1 bone 1.0 bone anim material 0.500000 anim texture
+material bone
+-1 = vertex frame 0.500000
+0.500000 anim
+texture 1.0 texture frame
+anim anim anim
+-1 anim texture bone frame frame
+1.0
+texture =
+0.500000 vertex -1 frame anim bone 0.500000
+=
+vertex anim -1
+=
+-1
+-1 vertex
+0.500000 -1 vertex
+frame anim =
+anim
+material anim frame bone anim
+0.500000 vertex
+anim vertex bone material
+1.0
+anim = vertex
+frame
+texture vertex 1.0 frame
+anim
+frame material = vertex vertex
+material 0.500000 anim
+= = 1.0 vertex -1 -1 anim
+texture material -1 frame texture
+bone vertex texture bone
+bone
+material = bone -1 bone
+frame vertex texture material bone frame = -1
+1.0 texture
+bone material 1.0
+= anim 0.500000 -1
+texture bone bone
+frame -1 0.500000 -1
+-1 -1 material frame anim anim texture 0.500000
+= anim
+material
+anim
+anim
+frame material texture
+frame -1 1.0 texture
+-1
+1.0 = frame
+anim = 1.0
+=
+bone bone frame 0.500000
+bone = = vertex texture =
+-1
+texture -1 -1 texture material material texture vertex material 1.0 anim
+texture -1 = vertex
+material
+material 1.0 anim
+vertex 0.500000
+frame bone bone -1 vertex 1.0 anim 1.0 frame vertex texture = bone
+1.0 0.500000
+material frame = frame anim frame
+texture bone
+0.500000
+material frame bone bone frame =
+frame 1.0
+vertex
+1.0 0.500000
+-1
+-1
+-1
+-1 frame -1
+1.0 = anim texture
+1.0 frame material 0.500000 = 1.0
+= = material 1.0 1.0
+= 1.0 frame 0.500000
+-1 material = = = anim
+material 0.500000
+vertex 0.500000 frame
+0.500000 frame
+texture
+vertex
+frame
+frame
+-1 1.0 frame -1
+vertex vertex -1 1.0 vertex material -1 -1 frame 1.0
+1.0 material -1 anim texture 1.0
+1.0
+bone material bone bone
+1.0 =
+vertex texture anim
+texture anim frame
+0.500000 vertex
+= =
+anim -1 bone -1
+1.0 =
+1.0 texture bone vertex 0.500000 = anim bone
+frame = vertex -1
+texture vertex
+material anim texture
+material texture anim anim 0.500000
+-1 1.0 bone = texture -1 bone
+1.0 1.0 texture
+1.0 vertex
+-1 frame -1
+frame texture anim anim 0.500000 0.500000 =
+1.0
+= anim
+frame
+bone
+material
+bone material frame
+1.0 bone texture 0.500000 frame frame
+bone
+bone
+bone
+1.0 texture texture
+texture fram
\ No newline at end of file
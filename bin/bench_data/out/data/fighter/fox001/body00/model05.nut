@@ -0,0 +1,8 @@
+-1 bone bone =
+=
+0.500000 frame
+0.500000 frame frame
+bone
+0.500000 bone frame
+bone bone vertex
+1.0 texture bone 
\ No newline at end of file
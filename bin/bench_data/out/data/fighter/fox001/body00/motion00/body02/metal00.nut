@@ -0,0 +1 @@
+1.0 = texture anim 0.500000 0.500000 bone
\ No newline at end of file
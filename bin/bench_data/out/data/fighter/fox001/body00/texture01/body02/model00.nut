@@ -0,0 +1,2 @@
+texture 0.500000 0.500000 1.0 texture vertex
+-1 ve
\ No newline at end of file
@@ -0,0 +1,7 @@
+=
+1.0 frame 0.500000 bone bone bone texture bone frame vertex
+bone frame
+bone = =
+0.500000 =
+material 0.500000
+-
\ No newline at end of file
@@ -0,0 +1,11 @@
+bone -1 bone anim frame material texture texture -1 -1
+frame anim 1.0 frame texture
+material -1 texture bone 1.0
+vertex vertex frame
+1.0 material
+texture = vertex 0.500000 frame 1.0 material material material 1.0 0.500000 material frame anim anim material
+material texture texture 1.0 bone
+texture
+=
+=
+an
\ No newline at end of file
@@ -0,0 +1,8 @@
+0.500000 anim frame texture
+texture 1.0
+frame -1 -1
+bone
+frame
+anim
+texture texture = 1.0
+frame anim anim 
\ No newline at end of file
@@ -0,0 +1,36 @@
+anim -1
+material
+texture 1.0
+=
+anim = material material
+-1 vertex -1 = vertex = anim
+vertex anim texture material
+= texture -1 1.0 material 1.0 = texture frame material bone 1.0 0.500000 anim material -1 0.500000 bone 1.0 anim texture anim = 0.500000 material 0.500000 material material bone
+anim material
+texture bone 1.0 -1 texture
+-1 frame texture -1 1.0 =
+anim texture material bone
+anim 1.0
+0.500000 -1
+vertex
+1.0 texture anim 1.0
+texture
+1.0 texture =
+bone 1.0 0.500000 texture vertex
+vertex 0.500000 -1
+frame
+-1 0.500000 vertex texture frame 0.500000
+= texture vertex = anim 1.0 anim = frame bone bone 0.500000 = 1.0
+texture anim bone frame frame
+anim = vertex 1.0
+vertex bone 0.500000
+0.500000 frame 1.0 1.0 texture
+texture
+anim bone 1.0 anim
+vertex
+bone
+= material 1.0 material = bone -1 1.0 -1 = anim bone bone material anim
+-1 0.500000 1.0
+0.500000 frame -1 anim
+1.0 bone -1 1.0 -1 = = frame anim vertex material frame
+-1 0.500000 vertex -1 vertex texture 
\ No newline at end of file
@@ -0,0 +1,61 @@
+-1 frame
+= -1 1.0
+material vertex = =
+material
+0.500000 material
+anim material
+0.500000 1.0 frame bone anim
+0.500000 = -1 material anim vertex vertex -1
+-1 0.500000 vertex texture bone bone bone
+material
+vertex 0.500000 = frame 1.0 bone anim anim -1 frame -1
+frame 1.0 material
+anim
+frame frame =
+vertex frame 1.0 -1 -1 = bone 0.500000
+1.0 0.500000 anim vertex frame
+anim frame 1.0
+-1 texture
+vertex
+= material texture -1 bone anim 1.0
+material bone 1.0 bone material
+frame
+0.500000 anim
+-1 0.500000
+vertex
+anim anim 1.0
+bone 1.0 anim
+anim 0.500000 =
+material texture material frame 1.0
+bone
+1.0 texture
+frame vertex
+frame = -1 anim -1
+material 0.500000
+frame = vertex texture
+texture
+anim material anim material bone 0.500000
+bone
+= 1.0 1.0 vertex 1.0 bone
+bone anim 0.500000
+0.500000 1.0
+material -1 1.0 0.500000 = =
+0.500000 vertex = = 1.0 frame 1.0 frame bone = -1
+anim 1.0 texture texture texture bone texture 1.0 = 1.0 bone texture anim anim
+0.500000 1.0 material 0.500000 = texture frame
+-1 = texture 1.0 texture = 0.500000 = texture vertex bone texture
+vertex vertex 0.500000
+1.0
+vertex 0.500000 0.500000 -1 0.500000 vertex 1.0
+bone vertex texture
+0.500000 material
+1.0 anim vertex texture bone texture frame frame
+= vertex texture 0.500000
+1.0 = material material 1.0 bone texture vertex
+= texture vertex vertex 0.500000 bone
+material
+texture
+vertex 0.500000
+texture
+frame = -1 texture frame texture 1.0 = material vertex
+anim frame bone frame =
\ No newline at end of file
@@ -0,0 +1,6 @@
+= = material -1
+= frame 1.0 frame anim anim bone frame
+=
+bone
+1.0 material frame
+=
@@ -0,0 +1 @@
+1.0 0.500000 anim material anim v
\ No newline at end of file
@@ -0,0 +1,17 @@
+-1 1.0 = bone
+frame 1.0
+vertex
+= = texture
+0.500000 -1 texture
+bone material
+frame
+vertex texture texture 1.0
+0.500000
+anim = bone
+= texture = 1.0 frame 1.0
+=
+bone =
+bone = 1.0 bone
+material 1.0
+texture = texture anim 1.0
+bone material bone anim
\ No newline at end of file
@@ -0,0 +1,12 @@
+frame frame anim 0.500000 -1 = anim bone 1.0 frame
+= frame 0.500000
+bone
+vertex 1.0 bone
+1.0 anim bone
+bone vertex
+anim
+texture 1.0
+vertex
+=
+anim -1
+vertex vertex textur
\ No newline at end of file
@@ -0,0 +1,57 @@
+texture vertex
+material
+= 1.0 vertex -1 anim anim -1 vertex
+=
+1.0 =
+-1 1.0 0.500000 0.500000
+vertex
+1.0 anim =
+0.500000 anim
+0.500000 frame vertex texture
+1.0 frame bone -1
+-1 texture =
+bone 1.0 texture material texture -1 0.500000 anim 1.0 frame vertex 0.500000 0.500000 anim
+= vertex
+bone 0.500000 material 0.500000
+anim -1
+texture
+bone vertex
+texture material texture bone = anim texture frame texture bone
+frame texture vertex 1.0 0.500000 material
+frame 0.500000 0.500000 -1 1.0 material 0.500000
+vertex texture material anim frame frame material anim texture bone
+-1 anim =
+material
+anim frame
+material
+= 1.0 = bone texture bone frame
+material anim frame frame =
+-1
+frame -1 material
+anim 1.0 0.500000 -1 material
+anim
+-1
+anim
+0.500000
+0.500000 material -1 0.500000 -1 anim 1.0 = 1.0 0.500000 material texture 0.500000 vertex 0.500000 bone = = frame -1 material vertex texture
+frame texture material material
+bone
+= vertex material anim anim frame material =
+= 1.0 vertex 1.0 anim
+material
+=
+vertex material
+-1
+material frame frame -1
+anim -1 bone material frame
+material frame texture 0.500000 = 0.500000
+1.0 frame
+vertex -1 material -1 vertex -1 anim texture
+= vertex frame material
+vertex frame bone texture texture
+frame frame vertex anim -1 -1 = vertex 1.0 frame frame texture anim
+anim material
+frame bone frame
+-1 material 1.0 -1 anim texture frame texture 0.500000
+frame
+frame vertex 1.0 material -1 anim
\ No newline at end of file
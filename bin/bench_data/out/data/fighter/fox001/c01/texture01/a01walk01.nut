@@ -0,0 +1,11 @@
+vertex =
+0.500000 material -1 bone
+frame = material anim
+1.0 0.500000 = frame texture
+-1 = 1.0 1.0 texture vertex 1.0 0.500000 frame 0.500000 anim
+vertex texture anim -1 0.500000
+=
+0.500000
+1.0
+bone
+= 
\ No newline at end of file
@@ -0,0 +1,221 @@
+material -1 anim material = texture material = material frame material material texture bone vertex 0.500000 material vertex anim = 1.0 bone material 1.0 -1 vertex = 1.0
+1.0 anim bone vertex = = material = -1
+0.500000 frame -1
+material frame vertex
+= -1 material bone
+vertex
+vertex vertex 0.500000
+-1
+frame material texture =
+material vertex texture = -1
+frame = anim material
+1.0 -1 anim texture vertex
+1.0 frame 0.500000
+texture
+texture texture bone
+texture vertex anim
+= texture bone
+bone
+frame bone 0.500000 1.0 =
+0.500000 0.500000
+vertex bone anim anim vertex bone vertex -1
+0.500000
+anim frame = texture
+0.500000 = vertex
+anim
+bone -1 anim anim bone texture
+bone
+material 0.500000 -1 =
+texture -1 1.0
+texture = 0.500000
+vertex texture
+1.0 anim texture -1 = -1 material material anim material
+vertex
+frame
+0.500000
+material 0.500000 = material material bone = vertex
+vertex 1.0
+bone frame 0.500000 vertex bone -1
+0.500000 vertex frame material
+bone
+1.0 anim vertex = -1 frame frame vertex bone
+texture -1 0.500000 1.0 = bone
+frame
+1.0 vertex anim -1 frame material frame material
+texture = bone material texture texture frame 0.500000
+material material
+material frame frame
+= -1 1.0 -1 vertex
+0.500000 -1 bone
+frame = anim
+-1 material material 1.0 frame bone
+= vertex anim
+= material =
+frame texture = material = anim vertex
+= anim bone texture 1.0 frame 1.0
+material
+texture
+material
+frame
+-1 anim material 1.0
+0.500000 bone
+1.0 -1 0.500000
+texture anim material = =
+1.0 bone vertex 0.500000 material =
+= material =
+0.500000
+texture
+texture
+vertex
+bone 0.500000 =
+0.500000 vertex = -1 anim anim vertex frame texture frame bone material texture
+-1 vertex material texture frame 0.500000 material material -1 -1 -1 -1 0.500000
+0.500000
+anim
+bone 1.0 material
+-1
+vertex anim vertex anim texture frame -1
+=
+bone -1
+texture frame texture frame material texture vertex material material frame anim bone bone
+= texture material = texture frame
+anim vertex
+-1 anim = vertex
+texture
+anim = texture
+vertex
+anim 1.0 1.0 frame -1
+frame vertex 1.0 texture 0.500000
+= 1.0 -1 1.0 material
+bone 0.500000
+frame material texture frame
+vertex -1 frame anim frame
+= texture anim vertex vertex
+material
+bone frame material -1 texture -1 bone vertex 1.0 -1 bone frame
+= 0.500000
+= material 0.500000 frame
+0.500000 = anim anim vertex frame bone material material 1.0
+1.0
+0.500000
+-1 material
+frame 0.500000 = texture = frame
+0.500000 bone
+1.0
+material vertex material
+anim = -1 1.0 vertex
+frame texture
+texture frame vertex -1 vertex anim
+1.0 1.0
+material bone 0.500000
+= = 1.0 anim texture -1 bone vertex bone vertex frame texture vertex
+-1
+material
+bone anim texture anim
+frame anim
+material anim frame -1 vertex
+bone
+= 1.0
+frame 1.0 material vertex -1 anim frame bone frame
+vertex texture 1.0
+vertex vertex material 1.0 -1 frame -1
+1.0 = 0.500000 0.500000 = anim =
+0.500000 frame
+material = anim frame =
+0.500000 0.500000 material -1 anim
+frame
+texture = 0.500000 0.500000
+1.0 vertex texture bone =
+1.0 -1 -1 texture vertex material
+0.500000
+-1 1.0
+texture anim -1 0.500000 bone 1.0 texture 0.500000 1.0 -1
+=
+1.0 1.0
+1.0 1.0 texture -1 frame material
+0.500000
+texture
+anim 0.500000 frame 1.0 texture anim -1 vertex frame frame 0.500000 vertex 0.500000 = frame frame bone bone frame frame frame 0.500000
+bone
+1.0
+material 0.500000
+0.500000 bone 0.500000 0.500000 = frame =
+material
+0.500000
+1.0
+0.500000
+texture vertex 0.500000 frame
+1.0
+material -1 texture 0.500000 material frame = -1
+= = anim = bone bone vertex -1 frame frame vertex anim
+frame anim
+0.500000
+frame texture = material material -1
+= material
+-1 0.500000 texture
+vertex 1.0
+1.0 anim bone
+frame = texture
+anim 1.0 vertex texture 0.500000
+-1 -1 bone material vertex frame frame vertex frame = 0.500000
+texture -1 vertex anim anim vertex = anim material 1.0 vertex 0.500000
+anim vertex vertex frame texture 1.0 material texture
+vertex
+0.500000 material
+0.500000 texture = texture = 1.0
+texture anim texture
+anim vertex
+bone texture
+frame
+texture frame
+vertex bone 1.0 vertex 1.0 1.0 vertex
+= texture -1 bone
+vertex -1
+1.0
+1.0 vertex texture
+frame 1.0 material 1.0 0.500000 material bone 0.500000 frame -1 material
+1.0
+= -1 frame -1 material vertex
+frame
+material
+material 0.500000 vertex = -1 0.500000 0.500000 texture texture vertex frame texture
+vertex 0.500000 vertex texture 1.0 anim
+texture = -1
+bone
+0.500000 bone = 1.0 texture vertex
+texture
+-1 texture texture anim texture 1.0 texture anim anim = texture texture 0.500000
+0.500000
+-1 vertex -1 material 1.0 0.500000 -1 = 1.0 texture frame =
+anim material 0.500000 anim frame texture bone
+material texture vertex
+bone
+texture vertex frame = frame 1.0
+bone -1 material = texture
+material = anim
+= 0.500000 bone vertex
+1.0
+frame
+texture -1 vertex
+frame frame -1
+vertex
+= anim frame anim -1 0.500000 anim vertex texture anim
+vertex material 0.500000
+= frame vertex 1.0 material anim -1 -1 anim material
+vertex
+= bone
+0.500000 bone = -1 -1 vertex 0.500000 0.500000
+0.500000
+= vertex texture vertex 0.500000 material bone bone 1.0 frame texture material material -1 material
+vertex bone bone 0.500000 = texture material
+vertex anim 1.0 bone vertex 0.500000 -1 material bone = texture frame = = anim bone texture bone
+frame anim
+0.500000 -1
+= anim frame
+=
+material
+material vertex
+0.500000 bone frame
+-1 0.500000 texture 0.500000 bone -1 anim vertex
+= material
+= texture 0.500
\ No newline at end of file
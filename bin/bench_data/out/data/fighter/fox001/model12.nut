@@ -0,0 +1,221 @@
+vertex -1
+anim texture vertex material
+0.500000
+-1 -1 anim texture texture
+frame frame frame bone
+material texture = frame frame
+texture bone
+material
+1.0 anim bone -1
+=
+material = -1
+material
+bone
+texture
+bone = frame
+anim material -1
+anim 0.500000 material bone
+vertex 1.0 = 1.0 material 0.500000
+texture anim vertex 0.500000 -1 vertex bone material
+vertex
+frame
+-1
+texture bone -1 frame = vertex anim material 1.0 frame 1.0
+1.0 1.0 vertex 1.0 = anim = = texture -1
+bone texture
+frame =
+0.500000
+0.500000 material
+texture
+material
+1.0 -1
+1.0 frame anim
+vertex
+anim 0.500000 material vertex =
+1.0
+-1 texture 1.0
+frame =
+-1 -1 -1
+0.500000 texture frame bone
+material = anim 1.0 anim vertex bone = texture 0.500000
+bone texture
+vertex 0.500000 texture = 0.500000
+anim texture 0.500000 =
+anim = -1 vertex bone 1.0 texture 0.500000 vertex anim
+frame anim
+bone frame 0.500000 = material
+texture material material bone 0.500000 -1 -1 bone 1.0 -1 anim frame 1.0 bone -1
+anim
+frame material = bone material texture frame bone
+material anim frame 0.500000
+bone
+bone 0.500000
+texture anim vertex frame texture bone
+texture frame bone = 0.500000 bone
+-1 bone 1.0
+frame
+vertex vertex
+anim 0.500000
+= = 1.0 anim bone
+1.0 -1 bone texture vertex = -1 0.500000
+=
+1.0 -1 0.500000 -1 material
+frame
+texture 0.500000 vertex
+material 0.500000 anim
+0.500000 material frame -1 vertex vertex
+material texture
+1.0 = =
+vertex anim bone texture material material texture anim bone 0.500000 bone 0.500000 frame material 0.500000
+anim 1.0 vertex 0.500000 bone
+1.0
+= 1.0 1.0
+anim vertex = bone material
+0.500000 = frame vertex vertex material anim bone anim anim
+material 1.0 -1 1.0 -1
+vertex
+bone material = 0.500000 = 0.500000
+vertex bone -1 frame 0.500000 material frame
+0.500000 bone
+material -1
+frame =
+-1
+material frame
+frame bone 0.500000 = -1
+-1 bone frame
+bone texture material -1 = material material 1.0 texture = frame -1 texture 0.500000
+bone
+frame
+bone frame material
+1.0 -1 vertex material vertex texture material
+frame vertex 0.500000 frame vertex texture
+-1 vertex
+bone 1.0 1.0 0.500000
+-1 bone bone vertex = material frame frame frame texture
+bone material anim anim -1
+1.0 material = frame
+0.500000 = -1
+anim bone
+bone material material 0.500000 material =
+0.500000
+vertex
+1.0 0.500000
+1.0 anim
+anim frame = texture = vertex frame texture
+material bone
+anim
+0.500000
+-1 texture texture frame -1 vertex bone
+frame -1 material
+=
+frame = bone 1.0 frame 0.500000
+-1 texture texture 1.0
+1.0 frame 0.500000 0.500000 anim -1 -1 -1 bone
+anim vertex texture frame
+bone anim -1
+anim -1 = material vertex material -1 0.500000 anim -1 -1 bone -1 frame material 1.0 frame -1
+anim anim
+anim frame
+0.500000 -1 anim vertex bone frame -1
+0.500000
+0.500000
+bone vertex -1 vertex -1 texture bone material bone = -1 =
+material bone
+frame
+material bone
+bone -1 frame vertex
+0.500000
+frame 1.0
+vertex texture 1.0 material frame
+= frame -1 0.500000
+0.500000 = anim
+anim anim frame
+-1 1.0
+anim material 0.500000 -1 texture
+vertex texture material 1.0 1.0 1.0 = texture
+frame anim
+bone 1.0 0.500000 vertex
+material 0.500000 texture 0.500000 1.0
+material
+material
+vertex
+material 0.500000 frame
+bone
+0.500000 0.500000 frame
+anim 0.500000 texture bone
+anim texture 1.0
+1.0 bone material
+-1 frame
+bone material 0.500000 bone material bone bone anim texture vertex material 0.500000 frame 0.500000
+= texture 0.500000 =
+0.500000 anim 1.0 bone = frame texture vertex
+=
+-1 =
+= frame bone -1 material vertex vertex 0.500000 bone 0.500000 material frame bone material
+material texture
+-1 texture bone frame 0.500000 = material frame vertex 1.0 bone
+texture 0.500000
+= = 0.500000 0.500000 bone -1 vertex anim
+1.0 -1 material = frame frame
+vertex vertex 1.0 bone 0.500000 bone texture material -1
+vertex material
+0.500000 0.500000
+material 0.500000 bone
+bone frame anim 1.0 material vertex anim
+frame 1.0 material
+texture anim material anim 1.0 vertex
+material
+bone -1 0.500000 bone
+frame = = anim 0.500000
+anim
+texture -1 0.500000 bone 0.500000
+bone
+material anim
+frame material
+bone vertex -1
+1.0 0.500000 texture 0.500000
+material =
+anim frame 0.500000 texture vertex 0.500000 texture
+anim vertex texture material vertex 0.500000 anim anim texture vertex texture material vertex -1 material
+frame vertex 0.500000 anim 1.0
+bone 0.500000 1.0 vertex frame anim frame
+vertex -1 vertex frame bone bone 1.0 vertex bone bone
+texture = anim frame frame frame vertex -1
+texture vertex
+=
+= anim 0.500000
+frame anim 0.500000 -1 0.500000 frame bone anim = vertex
+1.0 -1 anim
+= vertex vertex
+material anim vertex bone 0.500000 vertex texture bone vertex 0.500000 texture 0.500000 0.500000 =
+1.0 material 1.0
+bone material
+1.0
+anim
+= anim material
+vertex -1 bone -1 anim texture = material material 0.500000 = material = bone vertex
+-1 1.0 1.0
+material
+anim frame -1 0.500000 vertex 1.0 1.0
+vertex = texture anim vertex vertex 1.0 -1 bone frame 0.500000
+bone material anim material 0.500000
+bone frame 1.0 texture anim 1.0 frame -1
+texture anim
+-1 anim texture vertex -1
+texture
+texture vertex vertex material
+vertex anim anim
+material texture material
+frame frame
+texture material material vertex bone = = 1.0 texture frame vertex = material
+material
+= -1 texture
+-1 1.0 0.500000
+1.0
+texture texture 1.0 frame -1
+material frame bone texture vertex
+frame bone frame -1 0.500000 = = = -1 -1 material vertex
+1.0 material material
+material frame
+texture
+text
\ No newline at end of file
@@ -0,0 +1,238 @@
+= vertex = anim anim 1.0 1.0 anim
+material
+bone 1.0
+= vertex vertex
+0.500000 -1
+bone texture
+1.0 = texture
+texture material 1.0 vertex
+vertex anim vertex 0.500000 -1 1.0 -1 1.0 1.0 =
+=
+1.0 texture texture
+vertex material texture frame anim
+vertex material material 0.500000 1.0 -1 material 0.500000
+texture 0.500000
+anim = -1
+texture material frame = 0.500000 anim 1.0 -1 material 1.0 frame -1 1.0 anim vertex 1.0 frame 0.500000
+frame texture bone = frame texture bone material =
+anim 1.0 frame texture 1.0 material
+texture material texture bone texture 1.0 frame vertex 1.0 vertex
+bone -1 -1 bone =
+bone
+-1 vertex vertex material bone 0.500000 1.0 = 1.0 1.0
+1.0
+=
+1.0 1.0 material
+anim anim = anim vertex
+= texture -1 vertex bone
+0.500000 texture 0.500000 =
+anim bone 1.0 material material texture = 1.0
+0.500000 1.0 -1 bone frame vertex
+anim frame -1 0.500000 anim bone material anim
+1.0 = 1.0 -1
+1.0 0.500000 texture
+bone texture 1.0 bone texture -1 frame anim 0.500000 material material = vertex bone bone
+material 1.0
+-1 1.0 material
+0.500000
+-1 frame -1 texture = -1 1.0 1.0 0.500000
+anim -1 anim
+material anim
+=
+anim = = bone texture
+= texture material material texture anim anim bone = texture 1.0 1.0 1.0
+= bone anim
+material 0.500000 frame 1.0
+1.0 0.500000 texture = anim frame 0.500000
+1.0 1.0 vertex
+0.500000 0.500000 vertex
+texture frame material frame anim vertex bone 0.500000 anim
+anim
+vertex
+anim vertex
+-1
+material anim
+= 0.500000 1.0
+frame 1.0 0.500000 vertex 0.500000 1.0 material = material 0.500000 =
+= 1.0 material vertex bone frame anim
+bone texture -1 anim frame
+-1 vertex 0.500000 vertex
+-1 material 1.0 vertex
+-1 anim 1.0 frame 0.500000 material anim 0.500000 material material
+0.500000 = vertex frame 1.0 anim material
+bone material material anim material 1.0
+anim texture
+texture
+anim =
+1.0 bone
+vertex = = texture anim
+texture material bone
+1.0 texture 0.500000 = 0.500000 frame anim material
+= texture texture 0.500000
+bone 1.0 vertex anim =
+material
+frame 1.0
+0.500000
+0.500000 material bone material
+frame bone 1.0
+0.500000
+1.0 anim 1.0 anim
+-1
+1.0
+frame frame -1 = vertex anim bone bone vertex bone frame -1
+frame anim anim 1.0 0.500000 texture bone -1 =
+-1 -1 anim frame
+frame
+-1
+0.500000 =
+0.500000 vertex 0.500000
+0.500000 texture anim
+-1 frame =
+texture vertex material material anim -1 bone 0.500000 = material 1.0 0.500000 texture -1
+anim 1.0
+=
+anim 0.500000
+vertex material 0.500000
+-1 bone -1 anim texture = bone
+bone
+-1 bone texture -1 = bone bone 0.500000 frame
+bone anim 0.500000 frame bone material texture =
+0.500000 material material texture vertex
+bone frame = material material
+vertex 0.500000 = = vertex frame texture frame 0.500000
+frame =
+frame 1.0
+material 1.0 = 1.0 texture
+material
+vertex
+-1 texture bone -1
+texture vertex 0.500000
+-1 1.0
+=
+bone =
+frame 1.0
+frame 0.500000 -1
+anim
+0.500000 0.500000
+frame bone = -1 anim 1.0 texture 0.500000 bone 1.0 vertex -1 anim
+-1 -1 bone bone 1.0
+vertex 1.0 material 1.0 bone
+1.0 =
+1.0 = material = anim frame
+frame = 1.0 vertex vertex bone
+material 0.500000 0.500000
+anim material material
+texture
+vertex
+material frame =
+material frame = frame anim material anim
+frame bone bone -1 1.0 1.0
+1.0 texture
+material -1
+-1
+bone
+bone frame vertex
+anim bone -1 -1 1.0 material material 1.0
+bone texture
+bone bone -1 1.0 0.500000 vertex texture frame frame
+frame 1.0 texture 1.0 texture 0.500000 1.0 texture
+material texture frame -1 = -1 texture 1.0 0.500000
+0.500000 frame = = 1.0
+-1 1.0 bone material frame anim bone texture texture =
+texture
+-1 -1 vertex -1 material
+material
+1.0 1.0 0.500000
+material
+material bone 0.500000 = frame vertex vertex
+texture -1 1.0
+0.500000 frame vertex anim frame 0.500000
+=
+frame
+-1 =
+bone frame 0.500000 vertex material frame anim material =
+vertex 0.500000 material -1 -1 =
+1.0
+0.500000 frame =
+frame =
+texture
+anim 0.500000 vertex 0.500000 -1 = frame -1 = material
+=
+= vertex
+frame bone = bone texture vertex = texture anim anim
+0.500000 frame anim
+1.0 vertex anim frame texture
+material frame anim anim = 0.500000 anim anim texture 1.0 anim texture -1 = bone
+anim 1.0 -1 1.0 bone bone =
+0.500000 -1 bone 1.0 bone texture frame
+-1
+0.500000
+bone =
+-1 -1 -1 bone bone
+bone -1 anim material texture texture -1
+0.500000 0.500000 = vertex
+1.0
+texture -1 anim
+-1 1.0 frame material vertex texture frame 1.0
+1.0 frame 1.0 -1
+1.0 -1 0.500000
+frame
+vertex vertex -1
+bone vertex bone 1.0 -1
+anim -1 anim -1 anim bone texture
+= 0.500000 1.0
+-1 texture
+0.500000 0.500000 -1 1.0
+anim 1.0 0.500000 1.0 = anim texture = anim = -1 0.500000 frame -1
+=
+frame -1 0.500000 vertex material material material vertex 0.500000 bone = anim bone 1.0 =
+anim
+bone -1
+= texture frame bone frame anim
+bone = 0.500000 material material 1.0
+texture frame frame
+vertex
+texture frame material bone 1.0 material anim bone =
+texture material 1.0 bone = 0.500000 frame material material
+vertex -1 vertex = material = = 1.0 material bone
+texture frame
+bone
+anim frame
+0.500000 frame texture
+=
+vertex
+frame =
+texture 0.500000
+bone = vertex vertex
+anim texture -1 material -1 anim = anim 1.0 1.0
+=
+0.500000 -1 -1 1.0
+texture vertex = -1 bone
+material
+bone
+bone -1 =
+vertex
+bone
+material vertex frame = -1 = vertex 0.500000
+anim frame
+bone frame 0.500000 -1 -1 texture vertex bone vertex vertex 0.500000 bone frame = material anim
+-1
+vertex vertex
+-1 = bone 0.500000
+texture 0.500000 texture frame frame 1.0 material
+0.500000 anim frame
+texture texture vertex 0.500000 anim -1
+texture 1.0 material bone vertex vertex frame texture anim vertex vertex frame
+texture bone 0.500000 anim 0.500000 anim -1
+anim
+= texture frame = bone =
+vertex anim = texture vertex
+1.0
+bone
+material frame -1 texture material
+0.500000 texture texture -1 bone anim -1 anim
+-1 = 1.0
+-1 1.0 1.0 material material 0.500000 frame anim
+texture -1
+anim vertex 0.500000
+frame material vert
\ No newline at end of file
@@ -0,0 +1,4 @@
+material frame 1.0 anim bone anim bone bone vertex -1
+vertex material 0.500000 -1
+frame
+1.0 = 1.0 anim
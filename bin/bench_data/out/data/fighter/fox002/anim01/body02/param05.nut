@@ -0,0 +1,16 @@
+material 1.0 bone texture bone
+0.500000 anim
+anim frame material bone
+0.500000 bone material
+1.0 frame texture 1.0 1.0 material -1 1.0 vertex material 0.500000 vertex material vertex
+=
+frame texture
+vertex -1
+= anim 0.500000 =
+-1 =
+texture 1.0 bone frame
+= vertex 1.0 material 0.500000 texture -1 anim
+1.0 vertex 1.0 vertex bone -1 texture =
+texture vertex
+vertex material frame
+= 1
\ No newline at end of file
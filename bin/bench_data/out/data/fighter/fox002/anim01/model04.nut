@@ -0,0 +1,10 @@
+frame -1
+0.500000
+1.0 1.0 1.0 0.500000 anim 0.500000 = -1 frame -1
+vertex vertex
+anim
+material
+frame = 0.500000
+0.500000 frame
+material
+bone = 0.500000 = 
\ No newline at end of file
@@ -0,0 +1,15 @@
+=
+vertex vertex = material vertex
+frame 0.500000 -1 =
+0.500000
+1.0
+material 1.0
+material vertex
+texture bone
+bone vertex
+1.0 1.0 1.0 vertex bone = texture
+-1 1.0 frame vertex texture material = frame vertex = texture material vertex
+texture 1.0 anim bone
+=
+anim
+fram
\ No newline at end of file
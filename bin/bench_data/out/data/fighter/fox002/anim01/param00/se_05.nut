@@ -0,0 +1,77 @@
+texture vertex anim frame frame 1.0
+= anim texture texture texture bone
+= =
+0.500000 vertex 0.500000 = vertex
+-1 0.500000 bone
+anim
+frame 1.0 vertex texture vertex = anim
+=
+bone 1.0
+vertex 0.500000 bone 0.500000
+material 1.0 frame material
+vertex anim
+bone texture bone
+material material 0.500000 1.0
+anim texture
+anim =
+texture -1
+-1 anim 1.0 -1 bone texture 1.0 texture
+-1 anim anim anim =
+1.0
+frame
+anim
+1.0 0.500000 vertex -1 -1 vertex -1 vertex 0.500000 -1
+frame vertex vertex frame material 0.500000 frame -1 anim frame 0.500000 anim bone bone 0.500000 = 1.0 texture texture -1 anim 1.0 1.0
+anim texture 1.0 texture texture
+1.0
+= frame
+texture texture bone material texture
+frame vertex -1 material
+= frame 1.0 1.0 1.0 bone = = bone 0.500000
+frame material 1.0
+frame bone 1.0 texture anim texture
+1.0
+frame = -1 =
+-1
+texture
+texture = bone anim 0.500000 = 0.500000 -1 vertex bone 0.500000 frame texture
+-1 frame bone 0.500000 vertex anim -1 frame -1 material
+1.0 anim frame texture
+vertex vertex 1.0 -1 anim = texture anim anim bone -1 0.500000 1.0 vertex anim anim texture
+bone
+frame = bone
+frame -1 anim texture material
+1.0 material 1.0 0.500000 vertex vertex
+vertex bone =
+anim frame 0.500000 = 1.0 bone 0.500000 = vertex 1.0 1.0 -1
+material bone
+texture texture vertex material -1 anim anim = = 1.0 1.0 texture
+0.500000 0.500000 bone vertex texture texture
+anim
+-1 material 0.500000 material -1 anim
+vertex 1.0 texture bone texture
+-1 1.0 vertex bone material
+frame anim 0.500000 1.0 anim
+anim frame frame
+material bone 0.500000 = texture
+bone texture anim 1.0 =
+frame anim
+0.500000
+vertex texture -1 frame 1.0 material anim material 0.500000 frame =
+frame
+= -1 =
+vertex frame
+0.500000 material material 1.0
+vertex -1 = bone
+vertex
+-1 anim 1.0 anim anim 0.500000 texture -1 texture = texture frame 0.500000 0.500000
+0.500000 = -1 texture vertex anim 1.0
+=
+0.500000 0.500000 -1
+anim vertex = -1 texture bone =
+-1
+material
+1.0 bone vertex -1 texture
+1.0
+texture material texture material
+= vertex bone frame 1.0 0.500000 frame b
\ No newline at end of file
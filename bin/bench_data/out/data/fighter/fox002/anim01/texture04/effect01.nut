@@ -0,0 +1,2 @@
+frame texture 0.500000 anim
+vertex = verte
\ No newline at end of file
@@ -0,0 +1,114 @@
+vertex
+bone
+0.500000 1.0 material
+0.500000
+texture -1
+anim vertex
+texture frame 1.0
+bone anim texture -1
+anim 1.0
+-1
+-1
+vertex -1 1.0 -1 -1 1.0 -1
+0.500000 1.0
+vertex vertex
+-1
+material bone = 1.0 bone 1.0 = bone 1.0 -1 vertex 0.500000 texture material
+material -1 1.0 anim -1 bone
+texture = = material material material frame vertex
+anim texture = anim texture 0.500000 vertex texture = frame
+0.500000 1.0
+frame
+vertex
+1.0 bone
+bone
+-1 frame
+vertex =
+1.0 material bone bone frame frame
+frame material -1 material material frame = bone = frame
+vertex
+= bone
+1.0 -1 0.500000 bone 0.500000
+bone anim 0.500000 bone -1
+texture frame material 1.0 1.0 vertex -1
+anim -1 1.0 1.0
+1.0
+0.500000 texture frame
+vertex =
+1.0 vertex -1 vertex
+vertex
+bone material material
+1.0 1.0 material frame bone material material
+texture anim frame vertex anim texture anim 0.500000
+texture material material texture material bone material
+texture 1.0 1.0 bone texture
+bone =
+frame bone frame anim vertex
+1.0
+material
+material -1 texture material texture = bone 1.0 anim vertex anim
+bone 0.500000 vertex bone
+1.0 frame vertex = -1 0.500000 0.500000
+= 1.0 0.500000
+0.500000 -1 vertex
+1.0 0.500000 -1
+bone
+bone material
+= -1 = vertex
+texture 1.0
+vertex -1 vertex texture anim material
+0.500000 bone =
+texture -1
+= bone
+anim
+= texture
+1.0
+vertex
+vertex texture frame anim
+0.500000 bone
+anim frame vertex 0.500000 material
+texture -1 0.500000
+texture vertex frame anim frame
+0.500000
+frame material anim
+0.500000 0.500000 = vertex
+frame 1.0
+anim 1.0 bone anim anim
+vertex
+vertex 0.500000 -1 vertex texture material bone vertex frame bone material anim anim frame
+material = bone anim
+frame -1 1.0
+vertex
+material frame 0.500000 texture
+frame frame
+anim -1 texture
+-1 vertex material
+texture texture 1.0 = vertex
+bone
+0.500000
+bone
+frame = = -1
+anim bone frame
+=
+1.0 1.0 vertex 0.500000 frame
+anim -1 anim 0.500000 anim anim
+anim 0.500000
+-1
+1.0 =
+vertex
+1.0 = 0.500000 -1 texture anim -1 anim -1 = bone 0.500000 texture material 0.500000 material
+bone frame vertex
+-1 frame
+material
+1.0 -1 1.0 -1
+bone texture vertex -1 anim bone =
+bone frame 1.0 0.500000
+1.0 bone material 1.0 texture material material anim frame
+anim texture anim 1.0 frame anim bone material texture
+= = 1.0 anim material = material material frame
+texture
+-1
+texture
+=
+material = 1.0
+= 
\ No newline at end of file
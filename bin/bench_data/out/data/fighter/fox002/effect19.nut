@@ -0,0 +1,3 @@
+frame = material vertex 1.0 material
+frame = frame
+0.500000 a
\ No newline at end of file
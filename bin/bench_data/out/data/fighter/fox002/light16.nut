@@ -0,0 +1,40 @@
+-1
+bone
+-1 1.0
+1.0 frame texture -1
+material 1.0 1.0 texture
+texture 0.500000 bone 1.0 =
+= frame
+bone frame bone -1
+material
+0.500000 frame -1 anim material 1.0
+-1 frame texture texture material texture =
+vertex
+texture -1
+texture -1 bone
+0.500000
+vertex
+0.500000 vertex
+anim 0.500000
+material bone
+0.500000 material vertex -1 bone vertex anim
+0.500000
+texture =
+= 0.500000 1.0 -1
+frame
+= -1
+-1
+0.500000 -1 0.500000 1.0
+anim
+-1
+bone
+texture
+material anim vertex texture
+texture bone
+1.0
+0.500000 1.0 bone frame 1.0 bone -1 frame anim anim 0.500000 frame material
+texture
+material 1.0 -1 vertex anim
+frame = = = material texture material texture = material
+0.500000 texture =
+anim -1 0.500000 material vertex vertex -1 0.50
\ No newline at end of file
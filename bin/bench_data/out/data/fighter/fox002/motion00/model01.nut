@@ -0,0 +1,22 @@
+= frame frame texture 0.500000
+0.500000 vertex 0.500000
+0.500000
+texture bone texture material
+frame 1.0 0.500000 anim bone
+bone frame =
+frame
+texture
+-1 vertex material frame
+texture
+= 1.0 frame -1 bone
+0.500000
+anim
+frame bone bone -1 bone =
+bone bone
+bone
+0.500000 vertex
+vertex frame bone
+vertex 0.500000 frame bone bone 1.0
+= 1.0 vertex
+-1 0.500000 bone -1
+0.500000 texture anim mate
\ No newline at end of file
@@ -0,0 +1,9 @@
+bone =
+0.500000 -1 vertex bone vertex
+frame
+-1 = material
+material
+0.500000 1.0
+-1
+vertex 0.500000 frame -1
+vertex = texture 1.0 anim material bone frame texture anim 
\ No newline at end of file
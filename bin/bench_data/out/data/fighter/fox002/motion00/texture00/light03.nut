@@ -0,0 +1,64 @@
+vertex anim texture
+texture 0.500000 texture -1 anim
+vertex
+bone anim anim 1.0 -1
+-1 =
+frame -1 material frame 1.0 material bone material bone = 1.0 anim
+texture 1.0 texture bone vertex vertex material material 0.500000
+bone bone bone -1
+anim
+frame = 0.500000 vertex
+1.0 frame 1.0 material vertex bone frame 1.0 material
+bone bone 0.500000 vertex
+1.0 0.500000 texture = anim bone
+texture anim 1.0
+=
+material -1 0.500000
+texture = frame
+bone
+= -1
+0.500000 bone frame -1
+1.0 bone vertex -1 -1
+-1 1.0 =
+1.0 frame
+1.0
+-1 frame anim 1.0 bone
+frame bone
+texture material vertex
+vertex bone 0.500000 texture texture 0.500000
+anim -1 vertex 0.500000 = -1 -1
+material 1.0
+=
+= material -1 1.0 frame material material 1.0 vertex -1
+-1 material texture vertex vertex vertex
+-1 material material 1.0 -1 frame = material
+-1 vertex -1 1.0
+=
+anim texture frame = -1 1.0 bone =
+=
+texture vertex
+bone -1 =
+-1 material bone 1.0 anim 1.0 -1 -1
+bone 1.0
+vertex frame -1 material = bone
+1.0 material frame frame 1.0 frame
+anim -1 anim -1 =
+0.500000 1.0 bone
+1.0 material 1.0 texture anim bone
+=
+1.0 vertex
+-1 1.0 1.0 =
+vertex 1.0
+frame 0.500000 0.500000
+vertex =
+= bone -1 frame vertex material
+material
+1.0
+0.500000 = texture frame
+1.0 1.0 =
+vertex anim
+= 1.0 = frame anim texture = -1
+-1 texture
+material bone -1 0.500000 material bone material =
+bone 0.500000
+material material anim bone texture = 0.500000 material -1 texture vertex frame material = vertex 
\ No newline at end of file
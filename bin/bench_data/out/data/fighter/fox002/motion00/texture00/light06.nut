@@ -0,0 +1,6 @@
+texture bone -1 texture 0.500000
+bone material
+bone
+vertex 1.0
+anim anim
+0.500000 anim material 1.0 texture 0.
\ No newline at end of file
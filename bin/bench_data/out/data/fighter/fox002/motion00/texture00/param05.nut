@@ -0,0 +1,10 @@
+material
+-1
+material vertex 0.500000
+1.0 = material anim vertex material
+vertex -1
+bone material
+=
+material -1 frame
+bone texture
+fr
\ No newline at end of file
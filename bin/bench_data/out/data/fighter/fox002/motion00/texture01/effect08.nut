@@ -0,0 +1,11 @@
+texture frame
+1.0 bone
+anim
+bone 1.0 -1 bone frame
+bone 1.0
+0.500000 0.500000
+vertex
+material
+bone
+texture frame
+0.50
\ No newline at end of file
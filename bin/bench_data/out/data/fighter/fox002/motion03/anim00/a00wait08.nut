@@ -0,0 +1,235 @@
+-1 =
+bone anim vertex vertex frame texture bone 1.0 frame bone
+vertex
+material 0.500000 0.500000 vertex = texture
+0.500000
+1.0 frame -1 vertex
+1.0 -1 bone
+=
+0.500000 texture = bone = anim bone
+-1 anim
+frame frame frame 0.500000 frame anim
+bone 1.0 material anim
+0.500000 material =
+material material vertex vertex
+vertex 1.0 vertex texture -1 texture material frame anim vertex texture vertex material = frame
+texture
+0.500000 vertex
+= anim vertex = vertex
+= bone
+-1 bone 1.0 frame bone texture -1 -1 bone
+0.500000 texture -1 -1 = texture bone
+1.0
+-1
+vertex anim anim
+frame 0.500000
+frame
+frame
+material
+frame bone
+anim
+anim
+material
+0.500000 bone vertex 0.500000
+texture
+texture
+0.500000 -1 1.0 frame
+1.0 bone = 1.0 vertex bone bone bone bone = =
+frame bone anim 0.500000 1.0 texture
+bone
+anim
+-1 anim
+texture
+0.500000 1.0 0.500000 frame 0.500000 vertex texture material = vertex material 1.0
+= 1.0 -1 frame 0.500000 frame = 1.0
+texture material
+=
+frame
+material -1 frame vertex
+-1 texture 1.0 frame =
+-1
+1.0 texture -1 bone
+1.0 material material -1 0.500000 = -1 anim -1 anim -1
+= = frame anim
+frame = bone vertex
+bone vertex texture frame anim texture -1 anim material vertex material 1.0 vertex
+1.0 material
+anim
+material -1 0.500000 texture 0.500000 anim
+=
+frame anim
+vertex -1 material vertex bone bone 1.0 texture -1 frame -1 texture frame -1
+=
+1.0 frame = 1.0 = vertex
+-1 -1 = frame -1 -1 0.500000 1.0 frame
+= 0.500000 =
+=
+1.0
+texture 0.500000 1.0
+1.0 texture
+anim vertex = 0.500000 bone bone frame 0.500000 texture texture
+material material = 0.500000 vertex
+bone
+bone 1.0 0.500000 anim
+frame 0.500000
+bone bone = material texture bone = material
+bone frame =
+texture
+anim
+-1 anim
+frame anim vertex material 1.0
+= 1.0 0.500000 vertex texture anim -1 1.0 anim
+material vertex
+frame 0.500000 = bone frame anim = 0.500000
+texture = 1.0 = -1 texture
+anim
+anim bone 1.0
+-1 anim = anim material
+frame -1 material anim anim =
+= -1 =
+= texture vertex anim material
+1.0 vertex
+texture
+0.500000
+material frame frame
+1.0 vertex = = bone 1.0 texture material = bone
+0.500000 -1 = vertex 0.500000 texture bone
+bone 0.500000 material material
+material
+vertex
+texture
+1.0 material 1.0 -1 = 0.500000 bone
+= vertex anim
+texture 0.500000 bone material texture 0.500000 anim material anim vertex anim
+vertex anim vertex frame
+anim 0.500000 bone vertex frame 0.500000
+0.500000 texture -1 0.500000
+-1 frame
+vertex material texture 1.0 frame texture anim 1.0 -1 texture material vertex =
+0.500000 vertex anim bone 1.0 = material
+0.500000 anim 0.500000 bone frame bone
+material anim bone texture 1.0
+bone
+material 1.0 texture bone = bone
+vertex 1.0 = =
+material
+frame texture 0.500000 = anim 1.0 1.0 1.0
+vertex
+frame
+bone
+frame =
+material
+material material texture frame anim = -1 texture texture
+anim bone 1.0 anim texture
+-1 material
+frame bone 1.0
+1.0
+bone
+= vertex anim -1 vertex texture
+texture texture frame vertex bone 0.500000
+vertex frame anim
+bone
+1.0 anim bone = -1 =
+texture
+material = bone texture -1
+bone frame anim anim
+=
+texture -1 bone
+bone frame frame 0.500000 0.500000 texture anim 1.0 bone
+vertex bone
+-1 bone =
+anim
+vertex
+-1 vertex anim -1 frame
+anim = anim anim frame material texture 1.0
+0.500000
+texture
+texture anim 1.0 1.0 anim -1
+anim
+frame 0.500000
+anim
+frame
+bone
+frame
+1.0
+texture frame
+-1 -1 0.500000
+-1 frame -1
+frame texture 0.500000 material material
+= material -1 anim
+0.500000 texture material 1.0 -1 vertex anim 0.500000 =
+bone bone
+1.0
+material
+=
+vertex bone texture material anim
+-1
+-1
+vertex
+= anim texture = 1.0 material
+0.500000 -1 bone
+vertex -1 -1 frame frame
+1.0
+-1
+vertex
+material -1 0.500000 bone texture material 1.0
+material
+anim 1.0 1.0 0.500000 vertex
+texture texture bone frame 1.0 frame vertex frame -1
+-1
+= bone bone bone
+frame 1.0
+0.500000
+texture -1 bone
+bone anim = frame
+0.500000
+frame -1
+frame anim anim
+=
+-1 material
+1.0 frame
+bone
+= texture
+vertex 1.0 bone
+frame texture texture -1 -1 frame
+-1
+1.0
+1.0 1.0 vertex
+material 1.0 frame material
+bone =
+texture = -1 1.0 -1 bone 1.0 anim texture -1 vertex material material 0.500000
+1.0 bone 1.0
+texture bone -1 vertex texture material frame 0.500000 = bone anim anim
+anim = frame bone vertex 0.500000 bone
+-1 1.0 bone bone
+bone texture 1.0 anim frame frame frame frame texture frame material frame -1 bone 0.500000 1.0 frame
+material
+0.500000 bone -1
+material texture -1 anim
+texture -1 1.0 frame
+1.0
+texture
+texture vertex 1.0
+anim = vertex = 1.0 anim anim
+texture = 0.500000
+-1 vertex 0.500000 -1 0.500000 0.500000 material 1.0 0.500000 0.500000 vertex 1.0 -1 bone texture =
+= material bone
+=
+texture bone 1.0 -1 0.500000 texture
+1.0 -1 texture vertex -1 vertex vertex anim 0.500000 texture
+1.0
+-1 frame
+material
+vertex material vertex
+= -1 0.500000 frame vertex material = 0.500000 anim =
+texture
+texture vertex material bone = texture anim texture
+anim texture
+texture 1.0 0.500000 vertex
+0.500000 bone 0.500000
+= vertex vertex vertex bone -1 texture 0.500000 texture bone 0.500000 1.0 frame
+material vertex bone anim anim
+bone = bone
+anim =
+texture -1
+= material 0.500000 0.500000 -1 -1 te
\ No newline at end of file
@@ -0,0 +1,56 @@
+vertex anim 1.0 texture 1.0 bone
+0.500000 1.0 frame material -1 0.500000 bone
+material 0.500000 0.500000 anim anim 0.500000
+1.0 1.0 -1 1.0 material
+-1 anim anim = anim -1 =
+anim = material vertex -1
+-1 -1 bone anim
+1.0
+vertex 1.0 texture vertex
+=
+anim
+0.500000 material
+1.0 texture material =
+material texture vertex vertex
+material bone texture -1 -1
+1.0 -1 -1 anim vertex texture =
+bone 1.0
+frame frame 1.0 0.500000
+-1 -1 1.0 frame vertex bone texture vertex frame -1 -1 texture frame 0.500000 = texture
+material 0.500000 bone = texture bone frame -1
+anim vertex texture texture
+anim texture
+material vertex
+-1
+= -1
+-1
+material 0.500000
+-1
+bone anim bone bone bone
+material 1.0
+=
+anim = material bone bone frame = anim vertex -1 texture
+bone
+= vertex anim
+vertex 1.0 texture vertex =
+=
+-1 material
+0.500000 anim =
+texture material
+0.500000 0.500000 0.500000 -1 anim 1.0 material frame vertex frame
+texture -1 texture
+frame bone vertex -1 texture
+texture = anim frame anim 0.500000 0.500000 anim material 0.500000
+bone bone
+= texture material anim
+0.500000 vertex
+material 0.500000 vertex
+-1 bone 1.0
+1.0 1.0 frame material
+1.0 anim vertex = -1 texture
+texture -1 -1 frame material texture bone 0.500000 anim material -1 0.500000 1.0 0.500000 material anim frame -1 -1 frame 1.0 anim
+bone
+vertex -1
+bone =
+frame
+t
\ No newline at end of file
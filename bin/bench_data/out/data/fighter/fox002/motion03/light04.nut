@@ -0,0 +1,13 @@
+anim
+bone 1.0 0.500000 -1 texture
+texture bone 1.0 frame = anim
+vertex anim anim texture
+-1 0.500000 bone
+0.500000 -1 material material
+bone texture
+1.0 1.0 = texture
+=
+texture vertex 1.0
+0.500000 =
+texture
+anim = material t
\ No newline at end of file
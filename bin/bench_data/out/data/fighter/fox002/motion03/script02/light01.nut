@@ -0,0 +1,108 @@
+vertex anim bone frame 1.0
+0.500000 frame 0.500000 vertex 0.500000 vertex = frame frame material 1.0 bone
+material texture material -1
+frame bone 0.500000 material material material
+= 1.0 anim texture
+frame -1 0.500000 material anim 0.500000 -1
+material
+material 1.0 1.0 anim -1 material 0.500000 texture bone material bone -1 vertex frame material = texture
+0.500000 anim -1 vertex
+= material
+0.500000 -1 anim
+anim
+1.0
+1.0 = -1 bone texture
+0.500000 = frame
+0.500000 0.500000 texture -1
+= vertex bone
+frame texture 1.0 anim
+= frame vertex vertex =
+frame
+-1 0.500000 -1 -1 frame = vertex texture 0.500000 -1 material 1.0 1.0 texture -1
+material = 1.0 vertex
+0.500000 bone
+-1
+anim
+= vertex 0.500000 frame
+texture anim = = texture anim -1 0.500000 1.0 material vertex material 1.0 0.500000 0.500000 anim bone frame 1.0 anim texture = 0.500000
+texture frame bone 1.0 0.500000 = frame material texture = bone = texture = material 0.500000 = frame
+texture frame frame 1.0 = = 0.500000 material 0.500000 texture -1 vertex = texture texture = = vertex bone vertex texture vertex material 1.0 bone frame bone bone
+frame frame
+-1 bone texture -1 1.0 frame
+frame 0.500000 1.0 vertex 1.0 texture bone
+texture
+material -1 1.0
+bone frame texture -1
+frame
+1.0 1.0 vertex -1 bone 0.500000 bone -1 material bone
+bone material anim anim bone =
+= 0.500000 = anim
+material texture
+1.0
+bone
+=
+-1 material 1.0
+frame
+= 1.0 1.0 bone
+vertex vertex vertex material 0.500000 = material
+vertex anim 1.0 material = 0.500000 -1 0.500000 =
+0.500000
+1.0 bone bone 0.500000 0.500000
+anim material bone vertex frame anim 0.500000
+texture material material = texture
+=
+bone 0.500000 = frame anim
+-1
+vertex
+anim 1.0 anim texture
+vertex 1.0
+anim
+material 0.500000 frame bone
+= 1.0 texture 0.500000
+= anim
+-1 texture material frame
+vertex anim -1 anim
+bone
+-1 material
+-1
+anim material bone frame
+1.0 vertex texture
+texture vertex 1.0
+vertex frame =
+anim texture 0.500000
+-1 vertex 0.500000 1.0 texture anim
+vertex anim
+= frame texture
+texture frame material
+-1 -1
+vertex 1.0 = -1
+1.0 texture anim
+-1
+frame 0.500000 bone frame = anim
+texture texture = -1
+bone frame 1.0 1.0 bone vertex 1.0 material 1.0 texture
+anim vertex vertex
+0.500000 vertex bone 1.0 0.500000
+anim 1.0 = anim texture 1.0 0.500000
+anim frame vertex vertex -1 material
+anim anim = = 0.500000
+= 1.0 bone = anim anim = frame material
+= -1 bone bone
+texture -1
+-1
+1.0
+1.0 = 0.500000 0.500000
+= bone
+-1 1.0 material material vertex frame
+bone bone anim -1 bone
+material = material -1 frame =
+frame 1.0 =
+anim
+0.500000 -1 -1 vertex 0.500000
+-1
+texture
+anim bone bone frame bone anim
+vertex -1 0.500000 -1 frame -1
+texture
+vertex frame
+frame 0.500
\ No newline at end of file
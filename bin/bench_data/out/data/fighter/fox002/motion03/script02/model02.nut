@@ -0,0 +1,38 @@
+texture texture
+0.500000 frame frame -1
+vertex bone material material vertex
+vertex frame 0.500000 anim
+-1
+0.500000 frame = -1 bone texture frame
+= anim = anim -1
+0.500000 bone = 0.500000 0.500000 = 0.500000 anim -1 anim -1 texture
+vertex -1 anim -1
+vertex = 1.0 bone material vertex
+anim
+1.0
+-1
+1.0 frame =
+anim -1 = vertex
+anim anim texture = 0.500000 anim
+bone
+bone vertex 0.500000
+material anim bone
+anim 1.0 frame bone
+vertex bone anim texture -1 frame
+texture = material
+material anim material frame anim
+material 1.0 anim bone frame vertex = texture texture material material frame -1 texture anim bone -1 anim 0.500000 anim anim = frame
+frame -1 bone frame
+bone
+vertex 0.500000 =
+vertex
+vertex 1.0
+-1 frame texture texture
+=
+bone
+bone frame bone
+vertex 0.500000 anim bone texture
+anim -1 -1 frame frame
+texture
+frame
+-1
\ No newline at end of file
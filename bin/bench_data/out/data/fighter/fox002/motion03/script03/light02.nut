@@ -0,0 +1,114 @@
+material frame 0.500000
+texture
+bone = texture vertex =
+1.0 = 0.500000 vertex = bone anim
+-1 vertex texture vertex texture -1 = -1 1.0 0.500000 anim = = vertex anim frame anim = anim texture bone vertex 1.0 0.500000 bone -1 = -1 -1 frame
+vertex anim 0.500000 1.0 =
+vertex frame 0.500000 frame vertex = =
+-1 anim
+material anim
+frame
+bone vertex
+bone material 0.500000
+vertex vertex
+1.0 material
+-1 0.500000 material -1 anim 1.0 anim frame -1 vertex material material frame
+vertex bone
+1.0 =
+material
+-1 bone frame
+1.0 1.0 1.0 frame 1.0 anim 0.500000 vertex anim frame 1.0 1.0
+0.500000 -1 vertex 1.0 bone
+anim texture anim
+bone anim vertex vertex texture 1.0
+frame
+material 1.0
+= 1.0
+1.0
+0.500000 frame
+bone anim frame 1.0 frame texture 0.500000
+= vertex texture 1.0
+texture 0.500000 1.0 = anim 1.0 1.0 material
+bone = 1.0 1.0 material 0.500000 0.500000
+1.0 1.0 -1 = bone bone
+1.0 -1 anim
+vertex anim -1 anim 0.500000
+anim vertex 0.500000 texture -1
+0.500000 texture
+1.0 texture -1 frame 0.500000
+texture anim frame
+vertex vertex
+-1
+bone anim = = frame material
+anim 0.500000 vertex vertex bone frame 0.500000
+texture =
+1.0 vertex anim frame -1 vertex anim -1 -1
+anim 0.500000 anim
+-1 bone
+texture 0.500000 bone frame texture
+material bone vertex bone 1.0 -1
+vertex
+texture frame
+=
+1.0
+vertex anim frame
+frame
+0.500000
+vertex 1.0
+anim = material = texture -1 bone texture 1.0
+-1
+-1 bone 1.0 0.500000 texture
+0.500000
+1.0 frame
+vertex
+1.0 anim = 0.500000
+= 1.0 -1 bone texture
+= 1.0 vertex frame
+0.500000 material 1.0
+= 1.0 =
+= -1
+texture 0.500000 texture 1.0 = =
+anim 1.0
+texture material
+texture frame
+material
+0.500000
+texture
+material vertex bone 1.0 -1
+anim
+texture
+material
+anim
+vertex 0.500000 frame =
+texture
+frame
+anim 0.500000 1.0 bone
+texture -1
+= anim frame 0.500000 anim
+1.0 0.500000
+texture 0.500000 vertex anim -1 material 1.0 anim
+=
+anim 1.0 0.500000 vertex 0.500000 bone
+texture
+bone bone vertex frame -1 1.0 material 1.0 0.500000 -1 frame
+= texture
+bone bone
+material texture vertex -1
+= anim
+anim frame 1.0
+-1 =
+anim texture bone frame =
+1.0 material
+vertex 0.500000 frame 1.0 = -1 0.500000 0.500000 frame frame material = anim 1.0
+-1 material 1.0 frame
+material vertex 1.0 -1
+material bone -1 frame
+bone -1 = material anim -1 material
+texture
+texture 1.0 vertex
+frame anim
+anim vertex 0.500000 material
+anim
+texture 1.0 vertex
+1.0 material
+0.500000 -1
\ No newline at end of file
@@ -0,0 +1,3 @@
+= 0.500000 bone = frame vertex 0.500000 texture material texture anim 1.0
+= -1
+vertex textu
\ No newline at end of file
@@ -0,0 +1,17 @@
+0.500000 texture frame frame =
+= 0.500000
+material vertex frame texture material
+-1 -1 = material bone texture
+bone
+frame bone material bone
+material material
+vertex 0.500000
+0.500000 material = texture 0.500000 material frame
+1.0 material texture = frame
+0.500000 bone 1.0
+bone vertex bone vertex anim =
+=
+anim 1.0
+= 0.500000 0.500000 = -1 = material bone bone
+texture -1 material
+frame anim anim 0.500000
\ No newline at end of file
@@ -0,0 +1,6 @@
+=
+vertex
+1.0
+frame 0.500000 vertex bone
+texture
+0.50000
\ No newline at end of file
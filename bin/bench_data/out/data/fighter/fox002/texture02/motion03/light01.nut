@@ -0,0 +1,259 @@
+anim material vertex 1.0 = bone
+= 0.500000 frame 0.500000 1.0
+0.500000 vertex 0.500000 1.0 0.500000 -1 = 1.0
+= = material
+vertex texture vertex
+material -1 = vertex bone
+1.0
+= vertex anim material
+frame
+0.500000
+vertex texture vertex
+0.500000
+-1
+frame vertex
+bone anim material material material anim frame
+material frame frame vertex anim anim 1.0
+1.0
+-1 material 1.0 bone material material
+0.500000 0.500000 bone
+0.500000 material bone material
+frame frame
+-1 anim
+=
+1.0 bone frame frame
+material vertex 1.0 bone
+texture bone = 1.0 vertex
+vertex -1 1.0 bone
+1.0 -1 texture
+-1
+texture vertex anim texture texture material -1
+material =
+material 1.0 frame vertex
+vertex texture texture vertex 1.0 material material texture texture -1 0.500000 frame
+1.0 anim bone
+frame 0.500000 texture 1.0 frame 1.0
+= material = vertex
+0.500000 material = vertex = =
+texture texture
+anim = bone
+material 0.500000 frame
+material
+0.500000
+texture 0.500000 vertex material anim bone
+1.0 vertex
+texture material
+texture vertex
+material anim vertex -1
+texture bone
+texture
+= =
+vertex bone = -1 anim = = -1 vertex -1 = material material anim -1 bone 1.0 =
+bone
+material = 1.0
+1.0 0.500000 -1 vertex 1.0 bone frame 1.0 material -1 vertex 0.500000 0.500000 bone frame 1.0 = 1.0 material
+= vertex vertex 0.500000 = -1 frame -1 material anim 1.0 vertex -1 0.500000
+= 0.500000
+frame material
+vertex 1.0
+= anim bone
+anim 1.0 anim vertex 1.0
+texture texture material vertex
+1.0 1.0 0.500000 1.0
+1.0 =
+frame -1 material texture 0.500000
+texture vertex
+frame =
+material
+material
+1.0 material 1.0 vertex bone =
+vertex
+bone 1.0 -1
+0.500000 vertex texture bone vertex 0.500000 frame
+= frame =
+0.500000 frame
+vertex
+bone texture = =
+anim material texture texture anim frame vertex texture material anim
+vertex anim
+vertex 1.0 frame frame -1 bone bone
+-1 texture 0.500000 texture 1.0
+1.0
+bone
+anim 0.500000
+-1 =
+bone frame texture 0.500000 texture
+1.0 -1
+frame
+texture = vertex
+material -1 =
+-1 1.0 anim texture material
+= texture vertex anim = 1.0 material bone = 1.0
+0.500000 bone -1 bone anim = = 0.500000 bone anim
+material -1 = 0.500000 bone vertex 1.0 bone bone
+0.500000
+0.500000 bone texture 0.500000
+vertex vertex anim bone 1.0 0.500000 material -1 vertex material bone texture anim
+bone vertex bone = bone vertex frame 1.0 frame bone -1
+0.500000 frame
+1.0 material 1.0
+texture vertex frame texture frame anim texture
+frame material anim 0.500000
+-1 frame texture anim
+vertex vertex
+0.500000
+bone anim anim vertex
+frame = frame
+vertex 1.0 material -1 frame material -1 vertex
+frame
+frame bone
+texture vertex = vertex material 0.500000
+0.500000 bone frame texture 1.0 = texture 0.500000
+material vertex -1 material 0.500000
+-1 = 1.0
+-1
+anim -1 -1 1.0 frame anim anim material
+material anim
+0.500000 vertex = material = 1.0 material vertex 1.0 anim
+-1 1.0 texture bone 1.0 anim
+bone anim
+anim
+bone -1
+texture
+frame texture 0.500000 -1 material texture 1.0 -1 anim material 0.500000 frame vertex
+frame 1.0 texture = material
+bone
+bone
+material frame -1 material = -1
+=
+-1 anim
+bone vertex = -1
+1.0
+frame frame 0.500000 texture
+material bone
+-1 anim
+1.0 vertex
+texture material material texture
+bone anim 0.500000 bone anim vertex
+0.500000 bone vertex = 0.500000 material 1.0
+material frame
+1.0 bone -1 -1 = bone texture 0.500000 -1 1.0 bone bone vertex vertex
+frame -1
+1.0
+material material vertex 1.0 bone
+0.500000 1.0 texture 0.500000 texture
+texture vertex vertex bone bone -1
+0.500000 0.500000 material anim 0.500000 bone
+vertex vertex texture 1.0 = texture
+1.0
+texture vertex
+0.500000 1.0 -1 bone vertex = vertex frame 0.500000 bone 1.0 0.500000 1.0 1.0 frame material
+0.500000
+bone = material
+1.0 1.0 1.0
+bone frame -1
+material
+material -1
+= frame 0.500000 material frame 0.500000 anim bone
+vertex = 1.0 bone = texture -1
+0.500000 -1 = 0.500000
+frame 0.500000 frame
+anim bone anim = frame 1.0 anim 1.0 texture 0.500000 texture anim 0.500000 1.0 material -1 0.500000 -1 vertex frame -1 vertex = 1.0 -1 material bone frame vertex frame
+texture
+material vertex anim vertex
+1.0 1.0 frame -1
+bone -1 1.0 frame texture
+anim
+bone bone material bone
+bone 0.500000 vertex 0.500000 = -1 =
+texture material material material
+1.0 -1 material material vertex = = -1 =
+bone bone = vertex 0.500000 1.0
+1.0
+1.0 =
+0.500000 frame frame 0.500000 vertex -1 1.0 bone -1 frame frame 0.500000 texture
+anim anim frame anim anim
+-1 bone 0.500000
+material -1 1.0 anim frame -1 material 0.500000
+texture anim 0.500000 vertex -1
+-1 vertex
+0.500000
+frame -1 bone texture
+frame vertex frame -1 bone 1.0
+0.500000 anim vertex
+bone anim 1.0 0.500000 vertex texture
+anim
+material vertex
+material -1 1.0 0.500000 material
+material texture
+anim frame anim 1.0 vertex
+1.0 0.500000 texture texture anim anim 0.500000 vertex
+= 1.0 = bone 0.500000
+anim -1 frame 0.500000 texture
+1.0
+material frame = -1 frame = texture vertex vertex frame vertex vertex =
+1.0 0.500000 bone vertex
+material 1.0 -1 bone
+0.500000
+texture =
+0.500000
+bone = vertex 0.500000
+1.0
+frame frame
+-1 0.500000 1.0
+anim 0.500000
+-1 1.0 material frame bone texture anim
+bone
+0.500000
+-1 vertex -1 bone = 0.500000 1.0 vertex 1.0 anim 1.0 = anim
+-1 anim
+bone vertex bone 0.500000 anim anim bone 0.500000 1.0
+bone -1 frame 0.500000 -1 1.0 vertex
+= -1
+frame = bone anim 1.0 vertex = texture bone vertex 1.0 0.500000 -1
+-1 1.0 frame anim frame anim
+-1 0.500000 0.500000 -1 frame material texture
+material vertex vertex frame texture frame bone anim bone vertex
+-1
+vertex texture vertex 0.500000 anim texture anim
+anim = 1.0 vertex frame
+0.500000 frame -1 -1
+texture 0.500000
+1.0
+anim anim
+0.500000
+0.500000
+-1 1.0 bone
+1.0 material -1
+0.500000 material
+1.0
+1.0 frame vertex vertex anim bone anim frame
+1.0 frame 0.500000 1.0 anim vertex 1.0
+= bone 1.0 0.500000
+-1
+bone material = -1
+material
+material
+bone material
+bone
+= anim -1 -1 texture 1.0 anim texture
+-1 frame 1.0 -1
+anim -1 anim anim vertex anim
+bone
+= material -1 1.0 anim
+1.0 -1
+= anim 0.500000 material bone -1 -1 = bone bone anim anim 1.0
+= bone
+material 0.500000 -1 material -1 bone anim -1 -1 1.0 texture frame
+bone bone bone -1
+=
+-1 -1 frame texture = anim material anim
+bone
+frame -1
+vertex -1 material anim material bone bone vertex
+bone texture
+frame 1.0 -1 frame anim
+vertex bone
+1.0 frame bone 0.500000 texture =
+anim
+0.500000
@@ -0,0 +1,9 @@
+frame
+0.500000
+material texture
+anim texture material frame
+texture material anim
+texture 1.0 -1 1.0
+material
+frame vertex
+te
\ No newline at end of file
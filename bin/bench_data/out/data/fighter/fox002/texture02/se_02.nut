@@ -0,0 +1,40 @@
+-1 bone
+frame frame material vertex anim = 0.500000 material material
+texture bone
+-1 vertex texture 0.500000
+frame texture anim 1.0 -1 material
+material 0.500000 material vertex
+-1 1.0
+bone vertex 0.500000 0.500000
+= frame bone frame vertex anim = material
+bone bone frame bone 1.0 1.0 0.500000
+vertex material -1 -1 bone texture
+= bone bone 0.500000 0.500000 1.0
+bone -1 anim
+material 1.0 1.0 0.500000 anim vertex -1 material 0.500000 = -1 texture bone texture bone bone frame frame =
+0.500000
+1.0
+0.500000 0.500000
+-1 anim 0.500000 material
+anim
+material frame material
+= 0.500000 1.0 frame
+material
+-1
+material anim bone anim 1.0
+anim
+material
+0.500000 frame
+bone bone material 0.500000 bone vertex -1 anim anim
+texture 1.0 texture bone bone vertex
+texture = vertex
+1.0
+0.500000 1.0 anim anim -1
+-1
+=
+frame
+vertex anim anim 1.0 texture 0.500000
+-1
+1.0 = 0.500000 frame texture
+vertex
+0.500000 = 1.0 bone bone 0.500000 vertex 1.0 vertex material ma
\ No newline at end of file
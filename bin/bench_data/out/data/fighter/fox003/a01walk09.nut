@@ -0,0 +1 @@
+Ŵ6iÍr76FPq:oZ
\ No newline at end of file
@@ -0,0 +1,8 @@
+texture = -1
+=
+= frame
+0.500000 anim 1.0 0.500000 = frame bone = -1 texture
+bone
+frame material frame material anim frame
+vertex 0.500000 -1
+vertex textu
\ No newline at end of file
@@ -0,0 +1,67 @@
+1.0 bone -1
+1.0 material texture bone texture anim 0.500000 0.500000
+1.0
+1.0 0.500000 frame
+= = material material
+anim 1.0 vertex
+-1
+material
+material 1.0 =
+= bone texture material
+bone -1 0.500000
+bone bone vertex anim material = =
+material material anim
+vertex
+0.500000 bone vertex material
+bone frame 0.500000
+= bone 1.0 texture anim bone material
+bone frame
+-1
+texture vertex
+frame vertex
+= bone bone
+texture frame
+frame
+= 1.0
+bone frame bone 1.0 bone 0.500000 material
+-1 -1 bone vertex = material 1.0 texture material =
+texture
+0.500000 anim
+material =
+= texture bone frame texture frame
+bone 0.500000
+= frame = = material -1 0.500000
+material
+1.0 material -1 = -1
+bone
+anim
+bone
+vertex
+bone vertex anim = bone
+vertex
+bone
+1.0
+material bone
+0.500000 0.500000 bone -1
+bone frame vertex frame
+material
+texture 1.0 frame bone vertex
+vertex frame bone
+anim = 0.500000
+frame 0.500000 -1 bone = material -1 texture material vertex vertex bone vertex
+0.500000 -1
+vertex
+texture 1.0 frame = texture
+1.0 vertex = 1.0
+0.500000 1.0 = anim texture =
+vertex
+= -1 =
+vertex
+= -1 bone -1
+1.0 texture
+-1
+= material -1 bone -1 texture anim texture frame anim
+= -1
+vertex material frame bone -1
+frame
+1.0 texture =
\ No newline at end of file
@@ -0,0 +1,32 @@
+bone -1 anim 0.500000 1.0 0.500000 texture frame bone
+anim 0.500000 frame 1.0 anim -1
+material
+frame texture 1.0
+frame 0.500000 0.500000 = -1
+0.500000 texture = -1 -1
+frame
+material anim anim 1.0
+anim anim frame
+1.0
+frame vertex vertex = 1.0 0.500000 bone texture texture 0.500000 -1 -1 0.500000 1.0
+texture
+texture
+=
+texture 1.0
+anim material -1 = 0.500000 1.0 vertex -1 vertex 0.500000 -1 frame vertex 0.500000
+vertex 1.0 anim
+=
+1.0 = frame material frame 1.0 bone -1 bone texture
+1.0
+vertex 0.500000 -1 bone = bone vertex texture -1 texture vertex -1
+material -1 frame
+bone material = 0.500000 -1 material -1 -1
+1.0 anim anim material = vertex
+vertex
+material
+material
+frame
+= material -1 1.0 vertex frame
+0.500000 material vertex vertex material 1.0 anim 0.500000 frame texture
+anim
+1.0 frame -1 0.500000 vertex mate
\ No newline at end of file
@@ -0,0 +1,363 @@
+bone bone texture texture anim bone =
+frame 1.0
+texture =
+= 1.0 1.0 frame anim
+-1 vertex =
+texture 0.500000 1.0 frame
+-1 material bone material 1.0 frame -1
+1.0 = vertex
+frame
+bone texture 1.0 =
+texture vertex texture anim 0.500000 vertex material -1 anim vertex =
+bone
+0.500000 1.0 frame -1 texture
+texture frame 1.0 -1 vertex 1.0 1.0
+-1 vertex 0.500000 = 1.0
+frame
+texture frame -1 0.500000 frame 0.500000 1.0
+frame
+= 0.500000 1.0 -1
+anim -1 frame
+-1
+-1 -1 =
+material
+bone -1 0.500000 frame =
+material
+bone 1.0 anim
+texture
+= =
+texture material vertex
+0.500000 0.500000 material
+material -1
+-1 0.500000
+anim anim material = -1 frame
+material texture anim = texture bone
+texture material bone 0.500000 material -1 1.0
+frame
+texture bone bone 1.0 = = 0.500000 0.500000 material
+1.0 bone = bone frame 0.500000 -1 bone texture
+frame
+anim vertex
+vertex bone vertex 1.0
+frame bone texture vertex
+0.500000 1.0 = 0.500000 1.0 vertex bone bone
+bone = vertex 1.0 anim vertex 0.500000
+-1 =
+bone frame 1.0 bone 1.0 anim anim -1
+0.500000 = frame texture vertex
+texture
+texture anim 0.500000
+anim
+bone frame
+vertex 0.500000
+anim 0.500000 material material
+0.500000 vertex bone
+anim 1.0 vertex texture material 1.0 anim =
+-1 -1
+1.0 texture vertex -1
+-1 anim 1.0 -1 material texture texture 0.500000 1.0 0.500000
+0.500000 -1 material texture 0.500000 -1 = -1 1.0
+frame
+1.0 texture vertex
+anim -1 1.0 1.0 material = bone anim 1.0 texture texture
+0.500000 material texture material vertex anim
+vertex -1
+bone
+-1 0.500000 texture
+= anim 0.500000 =
+texture =
+vertex
+-1 -1 texture
+=
+bone vertex 1.0
+material material
+= bone
+-1 0.500000 anim anim bone 0.500000 bone
+= bone 0.500000 =
+anim
+= anim 1.0 texture
+1.0 0.500000 1.0 =
+texture bone bone material texture
+texture vertex texture anim
+texture -1
+bone texture bone 1.0 anim anim = texture frame
+bone texture
+= 0.500000 1.0 anim
+1.0 = anim -1
+frame frame 0.500000 0.500000 1.0
+1.0 0.500000 frame frame = frame
+1.0 bone vertex
+texture -1 = frame 0.500000
+anim
+1.0
+= anim 1.0 -1 1.0 bone vertex
+= 1.0
+-1 material anim anim
+0.500000
+texture frame material bone
+texture 1.0
+vertex bone
+material anim frame -1
+-1 frame
+-1
+texture 0.500000 frame -1 material -1 0.500000 texture
+anim
+frame vertex -1 -1 material bone = 1.0 material material 0.500000
+-1 bone -1 1.0 0.500000 bone -1 frame material
+anim
+material bone
+1.0 1.0 -1 1.0 -1 bone
+vertex frame -1 0.500000 texture frame
+= = anim =
+1.0
+material 1.0
+frame
+frame
+1.0 texture texture frame material anim
+anim vertex
+-1 frame
+bone texture 0.500000 0.500000 vertex 0.500000 0.500000 =
+-1
+1.0 material texture
+-1 0.500000 0.500000 anim anim
+material 0.500000 vertex
+0.500000 -1 texture
+material frame 1.0 frame =
+anim material vertex 0.500000 1.0 0.500000 0.500000 -1
+texture 1.0
+1.0 0.500000 = material
+anim 1.0 bone
+frame anim
+0.500000
+material anim 1.0 frame -1 0.500000
+0.500000 1.0 anim material -1
+-1 vertex
+anim frame
+frame
+material -1 1.0 texture
+bone 1.0 -1 anim
+vertex frame texture
+texture texture frame 1.0 texture texture
+-1
+= vertex vertex anim anim frame
+-1 frame
+texture = vertex 0.500000
+frame anim
+1.0
+1.0 texture material material bone
+-1 anim
+anim
+0.500000 bone
+-1
+= vertex
+material = texture 1.0 -1 vertex = frame texture bone
+-1 vertex bone
+= 1.0 material
+material 0.500000 1.0 texture
+1.0 bone texture 1.0 1.0 material = bone material vertex texture texture 0.500000
+bone
+= anim vertex frame
+= material bone anim bone vertex frame
+texture vertex anim texture
+frame material 0.500000 = = material material frame texture
+1.0 anim
+vertex bone
+1.0 -1 vertex frame -1 1.0
+anim bone bone anim = vertex frame -1 material
+vertex
+texture material 1.0 0.500000
+= texture material texture vertex 0.500000 1.0 bone -1 frame
+vertex anim vertex -1 vertex texture
+-1
+vertex
+= frame anim -1
+material
+bone = 0.500000
+vertex frame
+vertex
+-1 0.500000
+-1 frame
+texture
+1.0 texture vertex = -1 texture
+= bone
+frame = bone anim 0.500000
+texture =
+0.500000 -1
+anim material anim 0.500000 -1 1.0 material
+bone material -1 material bone = =
+-1 -1 = material 0.500000
+=
+0.500000
+anim frame anim
+bone
+anim anim texture -1 -1 frame material material -1 bone -1 vertex
+-1 = 0.500000
+texture -1 -1
+vertex -1
+1.0 frame
+= vertex -1 anim anim
+-1 bone
+material -1 texture -1
+bone frame frame = material anim
+material 1.0
+bone
+texture vertex
+bone anim
+vertex frame = vertex
+=
+=
+bone bone
+bone
+-1 -1
+bone
+material bone vertex = bone -1 -1 0.500000 -1 -1
+material 0.500000 frame texture
+anim = 1.0 anim = texture texture
+vertex texture = anim bone
+frame -1 0.500000 frame anim material
+frame frame
+frame 0.500000 material vertex 1.0 1.0
+0.500000
+bone vertex
+1.0
+bone texture 1.0 anim material -1 bone bone 0.500000 -1 vertex texture bone =
+1.0 0.500000 material texture
+-1 frame vertex
+bone vertex 0.500000 0.500000
+1.0
+vertex material texture texture bone
+material material material 0.500000 material texture bone material vertex 1.0 0.500000 frame
+= frame
+material bone
+frame texture bone 0.500000
+texture vertex
+material frame =
+vertex vertex frame frame
+vertex = -1
+-1
+vertex texture =
+0.500000 texture material 1.0 0.500000 material 0.500000 material anim anim
+material vertex frame -1 0.500000 -1 texture frame anim 0.500000 -1 material
+texture
+bone = 0.500000 0.500000 material 0.500000 1.0 bone
+-1 texture anim = texture bone vertex 1.0
+-1 1.0 material frame material
+vertex anim material anim
+= vertex
+-1 = texture
+frame
+texture frame texture = material
+texture texture texture material 1.0 -1 0.500000 bone material bone frame
+material
+anim = bone material bone frame material material 1.0 0.500000
+0.500000 bone = frame = vertex 0.500000 1.0 = 1.0 1.0
+anim
+= vertex
+anim = texture -1 texture 0.500000 -1 = frame anim vertex anim
+0.500000 -1
+1.0 1.0 vertex 1.0 material -1
+0.500000 anim -1 0.500000 -1 1.0 1.0
+bone texture -1 frame bone anim 0.500000
+bone
+0.500000
+material frame -1 frame -1
+frame
+=
+-1 texture bone
+1.0
+0.500000 material 0.500000 vertex 0.500000 1.0 vertex bone
+= = 0.500000 vertex anim material texture anim vertex material
+1.0 material
+vertex -1
+bone
+= vertex texture vertex
+1.0 bone
+anim bone material = 1.0
+= =
+vertex bone -1 bone vertex -1 0.500000 anim 0.500000 = bone
+bone
+frame frame
+bone material anim 1.0
+texture bone bone texture
+material
+bone
+vertex
+1.0 vertex vertex bone = =
+0.500000 vertex vertex
+vertex material -1
+bone bone bone bone = = 0.500000 anim
+vertex
+vertex
+material
+-1 texture
+0.500000 anim frame
+1.0 = 1.0 texture
+bone anim
+1.0 -1 bone anim vertex =
+bone
+1.0 = -1 = material
+frame texture
+=
+-1 =
+texture
+texture 0.500000
+bone anim =
+0.500000 = vertex -1
+1.0 texture 0.500000
+-1 vertex anim
+0.500000
+anim texture 0.500000 vertex
+frame 0.500000 material
+texture -1 material texture
+1.0
+-1 0.500000 material
+frame 0.500000 vertex texture = -1 frame texture
+vertex
+vertex
+0.500000 bone 1.0 material vertex 1.0 = 1.0 vertex = frame
+texture
+frame bone 1.0 vertex
+material
+frame
+0.500000 vertex -1
+frame frame bone
+= anim frame
+-1
+= -1 1.0 vertex -1
+texture frame
+-1 -1 -1 material = material -1 -1 anim texture -1 bone = material
+0.500000 vertex 1.0 -1
+0.500000
+-1 texture bone bone -1
+texture = vertex
+1.0 anim
+= =
+texture texture texture bone material texture material
+frame -1
+0.500000 1.0 frame texture 0.500000 vertex texture
+0.500000 frame frame = anim anim texture = vertex = anim
+0.500000
+material
+material
+-1 bone frame anim 1.0 material frame
+-1
+= 1.0
+texture -1
+0.500000 frame = 1.0
+material -1
+= frame bone material =
+material frame material anim vertex
+frame
+frame -1 vertex 1.0 0.500000 -1
+anim = 0.500000 texture material bone 1.0 -1 0.500000 1.0 1.0
+vertex
+=
+texture
+texture vertex bone anim
+vertex material bone
+1.0 texture
+vertex = texture vertex
+anim vertex
+= material
+0.500000 texture -1 -1 -1 0.500000 0.500000 0.500000 0.500000 vertex
+vertex vertex tex
\ No newline at end of file
@@ -0,0 +1,55 @@
+bone 1.0 =
+frame = anim frame 1.0 frame texture frame 0.500000 = 0.500000 1.0
+1.0 bone = texture 0.500000 material
+anim material material vertex 0.500000 -1 bone
+anim
+material 0.500000
+texture
+=
+anim =
+texture
+bone texture -1
+1.0 0.500000
+0.500000 -1 = anim texture vertex
+= vertex anim 1.0 = -1
+material 1.0 -1
+bone 0.500000
+-1 frame frame
+frame
+bone
+material 1.0
+0.500000 anim frame -1 material -1 -1 = 1.0 0.500000 vertex
+frame vertex -1 -1 bone anim frame frame 1.0 texture anim 1.0 material
+0.500000
+bone bone vertex 1.0
+texture vertex 1.0
+material anim 0.500000
+1.0
+texture
+=
+bone -1 0.500000 0.500000 vertex bone -1 0.500000 1.0 material
+texture vertex bone frame =
+anim anim material bone
+1.0 -1
+frame 1.0 vertex vertex
+-1 frame
+-1 -1
+frame
+-1 bone anim
+-1 0.500000 -1 0.500000 = vertex -1 material
+= anim 1.0 frame
+material material
+frame
+material anim 1.0 frame -1 material =
+vertex bone 0.500000
+1.0 0.500000 material frame anim bone anim
+0.500000 bone texture bone -1 = frame
+= 1.0 0.500000 material texture 0.500000 texture material texture 0.500000 bone 1.0 bone material
+vertex frame frame 1.0 material -1 anim -1 texture
+0.500000 0.500000
+= texture frame = texture
+0.500000 vertex
+frame frame
+material anim = anim anim bone
+vertex = material texture = material texture vertex
+-1 -1 -1
\ No newline at end of file
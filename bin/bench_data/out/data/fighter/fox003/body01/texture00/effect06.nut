@@ -0,0 +1,291 @@
+-1 0.500000 0.500000
+0.500000
+1.0 vertex material material texture 0.500000
+anim texture bone -1
+texture frame =
+vertex 0.500000
+-1
+0.500000
+texture =
+material texture frame frame bone = 0.500000 vertex bone vertex anim 1.0 1.0 = frame vertex -1 anim = -1 bone 1.0 bone -1 1.0
+material material
+vertex
+-1
+material
+-1 vertex 0.500000 material material texture -1 material 0.500000
+anim -1
+bone
+-1 vertex material = 0.500000 = texture -1 -1 0.500000 1.0 bone
+-1 -1 bone
+vertex texture texture 0.500000
+0.500000 anim texture vertex -1 texture
+vertex =
+-1 1.0 vertex material 0.500000 =
+vertex 1.0 frame
+material material material -1 texture -1
+vertex vertex 0.500000
+frame anim 1.0 texture frame texture vertex
+anim vertex
+bone 0.500000 anim bone anim
+1.0
+anim -1 bone
+bone
+bone
+vertex
+texture texture
+bone 1.0
+bone anim
+1.0 = material = -1 bone material = -1 material = anim
+1.0 texture
+-1 material
+anim
+frame frame 0.500000 = material -1 material material anim texture texture texture =
+=
+=
+bone bone
+1.0
+bone texture -1 vertex
+= 1.0 vertex =
+= vertex frame
+-1 texture
+=
+-1 -1 0.500000
+0.500000 frame material -1 =
+material material texture frame vertex
+= anim =
+frame 1.0 1.0 anim vertex material = 0.500000 frame = = 0.500000 1.0 material frame 0.500000 frame vertex -1 bone 0.500000 material frame texture
+vertex bone 0.500000
+0.500000 bone 0.500000
+0.500000 material material
+bone
+texture material 0.500000 vertex -1
+=
+0.500000 frame material 0.500000 bone texture material material anim texture
+anim = vertex bone = bone 0.500000
+anim bone material 0.500000 texture =
+= = 0.500000
+1.0
+material
+bone
+-1
+bone vertex
+vertex frame
+1.0 bone
+-1 -1 0.500000
+texture -1
+material = vertex frame anim 0.500000 vertex 1.0 frame material
+= -1
+0.500000 texture frame 1.0
+bone 0.500000 material 0.500000 0.500000 material texture material = 1.0
+bone anim
+bone 0.500000 = -1
+anim = material
+vertex material 0.500000 texture material
+bone material frame bone 0.500000 anim = 0.500000 = = anim 1.0
+1.0 0.500000
+0.500000 1.0 vertex material vertex bone
+0.500000
+frame vertex
+anim material vertex frame 0.500000 bone anim 0.500000 0.500000 anim 1.0 texture
+0.500000 vertex 0.500000 vertex
+texture
+anim material vertex
+= 1.0 0.500000 bone anim
+1.0 texture = bone frame
+-1 vertex anim = vertex frame 0.500000
+0.500000 frame 0.500000 = material
+texture texture material anim
+material anim material
+-1 frame anim
+anim 0.500000 material = material material vertex anim = frame texture
+vertex
+anim bone
+vertex -1 frame -1 1.0 -1
+texture 0.500000 anim 0.500000 texture = -1 texture
+texture vertex frame frame texture
+vertex texture texture = 1.0 material texture 0.500000 vertex vertex 0.500000 -1 material = = material 0.500000
+0.500000 bone
+anim frame
+texture texture bone material bone -1
+anim anim
+bone material 1.0 anim 1.0 1.0 anim = 0.500000 material 1.0
+frame material vertex bone
+anim bone bone 1.0
+bone
+frame material
+frame material material =
+material
+frame
+anim bone
+vertex texture
+bone texture material material 0.500000 anim
+bone
+texture frame = 0.500000 =
+bone 1.0 anim bone 1.0 material 1.0 -1 -1 = 0.500000 material = vertex
+1.0 -1
+frame bone anim texture texture texture bone bone = anim 1.0 material
+0.500000
+anim
+texture vertex bone -1 frame 1.0 1.0 texture 0.500000 frame 0.500000
+1.0 material
+-1
+bone frame vertex frame
+texture material material texture vertex
+frame bone frame bone =
+1.0 vertex
+material 1.0
+= 0.500000 texture 0.500000 frame
+1.0 bone frame vertex texture
+1.0 frame anim = = 0.500000
+1.0
+texture =
+vertex 0.500000 -1 anim
+1.0 0.500000 -1 1.0
+anim frame texture
+-1 vertex texture 0.500000
+bone -1 anim
+1.0
+anim
+vertex anim = 1.0 -1 material =
+vertex anim texture frame
+anim anim anim anim anim texture 1.0 0.500000 vertex -1 =
+frame material frame 1.0 -1 frame 0.500000 texture vertex
+= material bone
+anim texture vertex = -1 -1 vertex
+vertex material 0.500000 vertex -1 0.500000
+frame texture anim
+vertex 0.500000
+0.500000
+vertex
+bone -1 anim 1.0 = material texture = anim 1.0 frame anim anim material
+material 0.500000
+material frame
+-1
+-1 = anim -1 frame 1.0
+material = anim
+frame anim 1.0 material vertex = bone = material vertex -1 0.500000 frame 1.0 bone frame texture
+bone material 0.500000
+bone anim bone
+0.500000 vertex material
+material =
+-1 1.0 bone bone anim bone bone 0.500000
+frame anim anim
+= material = -1
+= -1
+bone -1 = -1 1.0
+material -1 -1
+=
+-1 material anim texture
+material -1 bone 1.0
+bone texture frame frame bone frame -1 frame anim
+= bone bone
+= texture = 0.500000 1.0 frame -1 frame anim frame
+1.0
+anim
+anim
+material anim anim anim texture texture 0.500000 -1 = 0.500000
+anim 1.0 1.0 anim -1
+vertex
+anim bone
+texture anim
+frame 1.0 = =
+= vertex frame 1.0 material material bone 1.0
+texture bone vertex
+-1 0.500000 anim bone
+-1 -1 frame frame -1
+frame frame bone 1.0
+-1 material
+frame vertex =
+vertex anim 0.500000
+-1 0.500000 0.500000 material anim texture
+0.500000
+bone
+material
+frame
+frame bone
+0.500000 material material bone bone frame -1 material texture
+anim anim =
+texture material material -1 texture 0.500000 0.500000 bone texture material frame vertex -1 =
+frame bone frame material material -1 = = texture = frame
+anim texture texture frame
+1.0 frame
+bone bone vertex 0.500000 = -1
+texture = anim = 0.500000 anim texture material
+bone vertex material texture = frame
+-1 frame
+0.500000 1.0 1.0 frame bone
+texture 1.0 0.500000 frame
+0.500000 texture
+texture
+= bone vertex texture -1 frame bone texture -1
+material material
+texture bone
+texture frame bone -1
+= 1.0 material
+bone
+anim vertex 0.500000 vertex bone material
+frame 1.0 =
+anim vertex -1 =
+-1 anim
+frame 1.0
+0.500000 -1 vertex 0.500000 0.500000 vertex anim texture material anim anim frame bone
+anim 1.0 1.0 texture frame vertex
+bone anim 0.500000
+vertex vertex =
+frame
+bone material material 1.0
+material -1 -1 = vertex 1.0 -1
+texture
+0.500000 frame -1 -1 1.0 material
+frame 1.0 1.0 frame
+texture material frame 1.0
+bone anim
+-1 0.500000
+frame
+frame
+0.500000 1.0 -1 vertex
+texture bone vertex
+-1
+bone 1.0 0.500000 1.0
+1.0 1.0 vertex vertex -1 =
+-1
+1.0 material vertex
+anim
+-1 anim
+bone texture
+vertex anim -1 = 1.0 0.500000 frame
+0.500000
+vertex
+texture 1.0 1.0 anim 1.0 frame -1 material
+material
+bone texture
+material bone frame bone = vertex texture frame -1 1.0 0.500000
+1.0 -1
+-1 bone
+bone texture
+texture anim vertex texture texture 0.500000 -1 1.0
+vertex
+texture -1 bone =
+vertex
+frame bone
+material -1
+1.0 bone material -1 = 0.500000 0.500000 texture
+anim material
+anim 1.0 texture
+material
+0.500000 0.500000 anim
+vertex material material vertex material
+anim
+texture frame
+bone material frame
+-1
+anim material
+-1 vertex
+-1 frame texture frame
+texture texture bone vertex -1 vertex 0.500000 anim texture
+= frame material anim -1
+= = -1 bone
+vertex
+-1 0.500000 texture
+frame -1 material 0.500000 material vertex 1.0
+bone 0.5
\ No newline at end of file
@@ -0,0 +1,24 @@
+0.500000 frame
+1.0 anim
+vertex texture bone material 1.0 bone anim
+anim texture material -1 0.500000 -1 anim material =
+bone vertex
+frame bone frame
+1.0 =
+frame 1.0 texture anim anim bone texture 0.500000
+texture anim texture 1.0
+material
+frame
+frame anim
+anim texture = material
+0.500000 0.500000 -1
+= -1
+0.500000
+vertex 1.0 -1
+-1 texture bone 1.0 frame material texture 0.500000
+-1 texture 0.500000 bone frame
+frame = texture texture
+0.500000
+1.0 frame 0.500000
+bone 0.500000 texture texture bone bone frame
+0.500000 
\ No newline at end of file
@@ -0,0 +1,10 @@
+-1 -1 = -1 texture frame
+vertex
+bone =
+frame -1 = 0.500000
+anim -1
+-1 bone
+bone frame = 0.500000 0.500000 = -1 -1
+0.500000
+= =
+-1
\ No newline at end of file
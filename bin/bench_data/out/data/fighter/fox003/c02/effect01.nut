@@ -0,0 +1,2 @@
+뒼Z߽ף*r&6$85J:ޙ\a
+_J2ݐ3IdZ(ǆ6e"t>(m||fA܎g^p:ꂆi2àxG+ݠqa'Rm!i_es!v,@v~5Y|v%eG`|]J/Ef<,NP]Tyt|D)^@}p4(y;Qk>ԐzfIwŗI!űhW
\ No newline at end of file
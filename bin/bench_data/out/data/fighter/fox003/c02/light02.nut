@@ -0,0 +1,5 @@
+texture
+anim 0.500000
+1.0
+texture frame 1.0
+v
\ No newline at end of file
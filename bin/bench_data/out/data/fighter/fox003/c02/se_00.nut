@@ -0,0 +1,6 @@
+frame
+= texture anim texture 1.0 = bone
+frame material material
+=
+material material frame vertex
+bone 1
\ No newline at end of file
@@ -0,0 +1,275 @@
+vertex material -1 0.500000 0.500000 frame -1
+vertex
+anim 1.0 = 0.500000 anim 1.0 0.500000 -1 0.500000 frame
+-1 bone
+frame anim texture =
+texture 0.500000 material vertex = -1 bone texture material
+bone 0.500000 -1 bone bone = bone = anim bone vertex
+texture frame bone frame bone 0.500000 texture 1.0 = vertex texture 0.500000 1.0 material bone material 1.0
+frame 1.0
+frame
+bone frame
+material 0.500000 frame vertex material 0.500000
+1.0 material anim
+texture = 1.0
+= texture
+bone material
+frame
+vertex = 1.0 anim frame texture bone anim texture 1.0 = 1.0 anim anim 0.500000 1.0 vertex
+1.0 material bone = 0.500000 = texture =
+1.0 anim
+frame -1 anim frame material
+texture vertex
+= vertex 0.500000
+anim 0.500000
+texture 0.500000 0.500000 bone -1 frame = = vertex vertex texture texture
+material 1.0
+-1 frame frame
+texture
+bone 1.0 material
+material -1 1.0 1.0 material vertex = 1.0 bone texture -1
+texture 1.0 frame 0.500000
+0.500000 frame texture anim vertex -1 texture
+= -1 bone vertex
+= -1 0.500000 = material texture
+texture
+anim 0.500000 texture
+0.500000 -1 -1 frame anim material 0.500000
+1.0 vertex texture 1.0 texture vertex
+1.0 material = 1.0 texture texture 1.0 1.0
+frame 1.0
+vertex bone
+texture 1.0
+= bone = bone material bone texture vertex =
+1.0 -1 texture vertex texture bone 1.0 vertex 1.0 1.0 texture
+frame
+= vertex texture frame -1 texture
+bone
+vertex -1 anim material
+-1 texture anim
+vertex material
+0.500000 frame bone
+bone
+anim = vertex frame 0.500000 vertex material -1
+= -1 frame = anim 1.0 anim 1.0
+anim =
+anim
+vertex frame
+-1
+frame 0.500000
+-1 0.500000 0.500000 vertex
+frame
+-1 frame material vertex -1 material -1 material material material
+= anim 0.500000
+1.0 frame = -1 anim
+material vertex
+1.0 bone frame texture texture vertex
+anim 1.0 anim anim anim 0.500000 frame
+-1 anim material 1.0
+1.0 0.500000
+anim
+vertex -1 frame frame bone -1
+frame bone anim
+1.0 -1 1.0 bone
+= bone
+frame material 0.500000
+bone bone material material bone
+1.0 material anim 0.500000 = 0.500000 anim
+frame bone
+0.500000
+texture
+0.500000 material
+-1
+anim anim anim
+0.500000 vertex -1
+1.0
+1.0 vertex
+frame -1 material
+=
+0.500000 bone anim
+bone -1 anim
+= frame texture 1.0 vertex texture material 1.0 = anim 1.0 = anim anim 0.500000 0.500000 texture
+-1 0.500000 vertex texture
+0.500000 frame frame
+frame anim anim
+anim
+anim = anim bone = frame -1 0.500000 vertex
+frame
+-1 bone frame -1 frame 0.500000 material vertex texture 1.0 1.0 1.0
+-1 = frame frame material
+0.500000 0.500000
+=
+vertex
+texture
+material vertex texture frame texture anim bone material -1
+material material 1.0
+=
+material vertex
+anim = 1.0 -1 material
+bone 1.0 texture bone anim anim material
+1.0
+material 1.0 texture 0.500000 0.500000 material = material anim -1 material anim material
+0.500000 vertex anim
+= -1 frame
+1.0 1.0 texture
+1.0
+vertex
+=
+frame = vertex
+1.0 0.500000 =
+0.500000 1.0
+material -1
+texture material
+anim vertex
+vertex
+texture texture
+frame
+vertex vertex texture vertex texture vertex
+1.0 frame 1.0 anim bone 1.0 vertex 1.0 texture =
+0.500000
+anim material vertex texture texture anim 0.500000 anim 1.0 1.0
+0.500000
+0.500000 0.500000 1.0
+texture
+vertex
+bone vertex 0.500000 =
+anim anim -1 anim
+bone frame frame
+=
+1.0 anim
+bone vertex
+1.0 0.500000 =
+-1 = 1.0 0.500000 bone
+= frame 1.0
+texture bone
+vertex
+0.500000
+vertex bone
+-1 texture material = vertex = = 0.500000 frame
+frame = vertex vertex bone = anim
+1.0 texture
+texture
+0.500000 1.0 anim
+material 1.0 texture bone bone
+frame texture material -1
+1.0 texture
+=
+= material texture bone 1.0 material vertex
+vertex = bone 0.500000
+bone 1.0 bone
+anim
+anim bone
+material = 0.500000 = bone -1
+bone material 1.0 = -1 0.500000
+vertex
+texture anim = 0.500000
+0.500000 -1 bone -1 material
+= vertex anim anim vertex
+anim = 0.500000 = vertex texture
+0.500000 = texture vertex
+1.0
+-1 bone 0.500000 vertex
+0.500000 vertex texture =
+0.500000 = -1 material =
+bone
+-1 anim texture material 1.0 anim
+vertex
+bone
+material frame
+vertex material -1
+-1 -1 0.500000
+texture 0.500000 = vertex bone frame 1.0 material anim vertex 1.0 -1
+0.500000 bone 0.500000
+texture bone 1.0
+= vertex anim material 0.500000 texture
+-1 material bone 1.0 =
+texture -1 0.500000 0.500000
+vertex
+bone material -1 frame = = 0.500000 anim vertex bone
+-1
+anim
+vertex material vertex material = = bone anim texture anim frame anim material
+bone
+material
+material
+bone texture -1 1.0 -1 vertex
+bone texture -1 bone anim bone bone texture
+frame anim texture material
+0.500000 1.0
+frame vertex 0.500000 texture
+frame texture
+1.0 anim 1.0 = frame 0.500000
+bone anim
+anim vertex
+=
+frame = 0.500000
+anim anim
+vertex frame texture vertex texture -1 material
+anim bone
+= bone 0.500000
+bone
+vertex frame = bone
+= bone =
+bone material vertex
+1.0 0.500000
+frame
+texture 1.0 frame material vertex 1.0 frame vertex -1 frame bone
+texture
+texture frame material material frame
+vertex frame anim frame anim bone
+anim 0.500000 material 0.500000 -1 -1 bone
+anim 0.500000 anim material material bone vertex bone 0.500000 -1 texture texture
+-1 material vertex
+0.500000 anim = material anim texture frame material
+= material
+= frame material frame
+material -1 texture -1
+bone vertex =
+0.500000 -1 bone material
+frame texture frame
+-1 0.500000 material frame anim material = 1.0
+0.500000 1.0 vertex vertex texture anim
+anim
+texture frame
+=
+material =
+frame frame
+material
+material = 1.0
+vertex bone -1 texture material -1 frame
+vertex material vertex frame texture 0.500000
+vertex -1
+frame vertex 0.500000 frame vertex texture vertex
+frame bone texture -1 -1 vertex = =
+anim bone frame
+frame anim
+anim
+vertex 0.500000 -1 1.0 vertex
+bone anim -1 anim -1
+1.0 = bone 0.500000 -1
+anim vertex
+1.0 vertex 1.0
+= bone texture 1.0 anim -1
+vertex -1 texture
+1.0 -1 1.0 texture vertex 0.500000 -1 -1 0.500000
+= 0.500000 =
+= vertex material 1.0
+anim anim -1 bone texture frame texture texture anim frame = texture vertex texture
+1.0 -1 0.500000 bone material frame -1 texture 0.500000 frame 1.0 1.0
+frame 1.0 -1 material 0.500000 anim vertex = vertex
+1.0 = = = texture = material
+anim vertex
+0.500000
+bone material -1 material 0.500000 material bone
+vertex
+-1 0.500000 -1 -1 texture anim texture 1.0 = bone 0.500000 texture
+= 1.0 = anim material vertex frame
+=
+0.500000
+1.0 frame vertex bone material vertex frame
+bone
+texture texture
+material anim bone anim frame material 0.500000 frame bone material
+= 1.0 texture bone 1.0
+= bone 1.0
+texture 1.0
@@ -0,0 +1,5 @@
+bone bone
+frame anim -1 frame frame 1.0 = texture frame
+-1
+-1 bone -1 vertex vertex anim 0.500000
+0.
\ No newline at end of file
@@ -0,0 +1,7 @@
+-1
+-1 bone 0.500000 anim
+= -1 -1 =
+bone material 1.0 -1
+0.500000 0.500000 material -1 = 0.500000
+0.500000
+= anim texture texture = anim bone 1.0 bo
\ No newline at end of file
@@ -0,0 +1 @@
+0.500000 0.500000 anim bone material anim 1.0 0.50000
\ No newline at end of file
@@ -0,0 +1,197 @@
+frame 1.0 bone 1.0 vertex
+anim bone
+-1 material bone vertex 1.0
+anim =
+anim vertex
+0.500000 1.0
+material bone
+vertex bone
+vertex bone texture 0.500000 0.500000
+vertex
+-1 frame
+anim vertex
+texture -1 texture bone
+1.0 =
+1.0 material frame material -1 frame texture = anim -1 material 0.500000 vertex
+texture
+anim -1 anim texture anim -1 bone vertex bone texture vertex
+vertex frame frame
+= frame vertex 1.0 vertex -1
+bone anim
+-1 1.0 0.500000
+bone -1 0.500000 texture
+frame frame = 0.500000 =
+-1 0.500000 bone material
+-1 = =
+vertex
+vertex
+frame material
+-1
+texture anim -1 vertex texture anim vertex bone 0.500000 1.0
+material vertex
+vertex = 1.0 material -1 material = 0.500000
+0.500000
+= -1 anim = material
+1.0 1.0 material = 1.0 vertex
+frame 0.500000
+frame frame anim frame 1.0 vertex 1.0 1.0 material vertex
+anim
+1.0 -1 = frame material
+texture
+bone anim 0.500000 anim
+anim 1.0 vertex anim
+material vertex
+vertex anim texture
+anim 1.0 texture anim 0.500000 vertex material
+bone material -1 -1
+0.500000
+= -1
+1.0
+texture
+anim frame vertex bone
+anim frame vertex anim
+bone
+0.500000 vertex -1
+= material = = material frame vertex anim frame
+=
+vertex material
+vertex -1 material vertex 0.500000
+anim
+vertex material 1.0 =
+=
+material bone
+-1 -1 vertex -1
+frame vertex anim texture texture
+-1 vertex
+= anim -1 anim 1.0 texture
+frame
+0.500000
+frame frame anim texture
+anim bone anim vertex anim
+frame 1.0 bone anim bone
+texture 1.0
+vertex = 1.0 material texture frame -1 texture
+= texture anim
+= vertex = frame =
+anim material vertex 1.0 1.0 vertex
+frame bone
+frame -1 bone texture
+texture
+material
+vertex
+1.0 frame
+1.0 anim anim texture = =
+-1 -1 = anim 0.500000 vertex texture
+frame 1.0 -1 = material = texture frame bone bone
+-1 vertex material bone -1 1.0 0.500000 texture material frame frame = 1.0
+anim 0.500000 frame
+= frame vertex texture vertex 1.0 anim
+anim bone texture vertex
+= -1 = anim frame
+0.500000 texture anim vertex frame
+1.0 texture
+material material
+-1 -1 anim = 0.500000 frame bone
+anim frame
+frame 1.0 0.500000 -1 bone
+1.0 texture frame
+anim vertex = anim 1.0 bone 0.500000 material
+bone bone 0.500000 0.500000 vertex bone -1 frame 0.500000
+0.500000 =
+0.500000 -1 -1 -1
+anim frame vertex
+vertex 0.500000
+anim
+vertex texture bone frame 1.0 frame texture frame vertex -1 = bone
+vertex 1.0 1.0
+bone vertex bone -1
+texture
+material material
+-1
+=
+vertex
+vertex = bone 0.500000 frame
+material material
+bone
+= anim material bone material
+vertex 0.500000 0.500000
+vertex material vertex frame material =
+0.500000 material
+material = 0.500000 -1 anim 1.0 0.500000 texture vertex 1.0 -1 1.0
+-1 -1 material 0.500000 0.500000
+frame bone =
+=
+material = texture
+0.500000 vertex texture = vertex
+material
+material 0.500000 0.500000
+anim vertex
+texture -1 material -1 anim -1 =
+frame 0.500000
+anim -1
+anim
+material material
+bone -1
+vertex -1 anim bone 0.500000
+1.0 0.500000 bone
+frame 1.0
+0.500000 -1
+anim
+anim frame 1.0 = frame = texture texture frame vertex
+vertex 1.0 -1 1.0 -1
+texture bone frame 1.0
+texture
+1.0 bone -1
+0.500000 = vertex 0.500000
+-1 texture frame texture
+= anim -1 anim -1 texture -1 = -1 1.0 -1 vertex vertex anim
+= vertex texture material 1.0 1.0 anim frame =
+texture
+-1 0.500000
+vertex frame vertex bone bone
+0.500000 -1 material = vertex frame 0.500000 =
+0.500000 1.0 0.500000 vertex
+bone 1.0 0.500000 = material 1.0 texture = bone
+vertex
+0.500000
+anim bone
+1.0
+frame anim texture
+0.500000 material material
+material anim
+anim = bone texture material frame
+frame -1
+texture bone 0.500000 1.0 material
+frame vertex 1.0 =
+bone 0.500000
+1.0 1.0 vertex vertex 1.0 1.0
+texture anim
+bone
+bone
+1.0 material 1.0
+vertex -1
+material 0.500000
+vertex material 0.500000
+1.0 texture bone
+-1 -1 vertex
+-1 1.0 -1
+-1 0.500000 material
+texture bone bone anim bone -1
+material bone 1.0 vertex
+vertex vertex 1.0
+0.500000
+bone
+vertex texture frame
+1.0 frame 1.0
+-1 frame = bone
+texture anim frame anim -1
+0.500000 vertex anim material -1
+-1
+1.0
+= = frame
+vertex -1 = texture
+anim
+bone 1.0 1.0
+frame = texture
+vertex anim -1
+= anim = bone bone = = = fram
\ No newline at end of file
@@ -0,0 +1,7 @@
+bone = texture anim anim
+-1
+-1 0.500000
+bone
+frame vertex texture
+material frame
+frame anim vertex -
\ No newline at end of file
@@ -0,0 +1,93 @@
+texture 0.500000 texture material 0.500000 texture anim texture frame =
+material material -1
+material 1.0 material
+bone = texture texture texture
+vertex anim anim
+anim
+anim 1.0
+0.500000 anim anim texture -1 -1 material bone material anim 0.500000 texture material
+anim
+0.500000 -1 bone
+material =
+= 0.500000 bone
+= frame vertex bone
+bone
+anim -1
+0.500000
+texture -1 = =
+0.500000 bone vertex
+-1 =
+material -1 anim 0.500000 0.500000
+1.0 -1
+0.500000 =
+bone -1
+0.500000 material
+bone frame = material = bone 1.0 material material anim vertex texture anim material = = frame
+bone =
+anim bone texture vertex texture
+-1 0.500000 -1
+vertex material vertex = 0.500000
+bone
+material 1.0
+bone bone
+vertex 0.500000
+-1 anim
+texture texture
+0.500000 = 1.0
+1.0 anim
+0.500000 material
+frame
+bone texture anim vertex
+anim bone bone texture material
+= 1.0
+= = = texture vertex frame 0.500000 bone 0.500000 -1 bone frame = anim frame material
+texture
+material
+1.0 -1 bone frame
+anim
+bone frame anim
+-1 0.500000 -1 texture = material
+1.0 vertex anim frame
+vertex texture 0.500000 frame
+texture 0.500000 texture frame = anim vertex
+bone
+anim material 0.500000 material anim material vertex vertex frame
+material 0.500000 =
+bone
+= texture
+= bone 1.0
+1.0 1.0 texture
+vertex bone anim material texture bone
+vertex frame 1.0 texture bone
+-1
+material 0.500000 anim frame anim material
+texture 0.500000 0.500000 1.0 material frame
+-1 0.500000 -1 vertex 1.0
+anim frame anim bone 1.0
+0.500000
+bone vertex frame vertex
+texture
+material
+texture
+bone
+frame texture texture 0.500000 anim = = bone material anim 0.500000
+texture anim 0.500000
+frame -1
+texture bone vertex
+=
+bone bone material vertex texture
+material
+anim material
+anim -1 bone
+1.0 0.500000
+bone = vertex bone bone = = 0.500000 0.500000 anim texture 0.500000 frame bone = material frame anim
+= vertex
+vertex vertex vertex -1 = 1.0 bone vertex frame -1 anim material -1 anim 0.500000 texture anim = bone 0.500000
+= material anim frame texture 1.0
+bone
+vertex = frame vertex material bone = texture bone texture
+bone bone 0.500000 = 0.500000
+texture
+0.500000 0.500000 -1 = bone anim anim
+texture anim 0.500000 1.0 -1 frame
+vertex vertex bone frame -1 fr
\ No newline at end of file
@@ -0,0 +1,12 @@
+= texture
+texture 0.500000 =
+= 1.0 material bone
+material texture frame texture =
+material
+anim
+material
+1.0
+= texture 1.0
+=
+1.0 -1
+material vert
\ No newline at end of file
@@ -0,0 +1,78 @@
+vertex material bone
+texture
+bone material
+vertex = material material frame bone texture vertex = bone material material 0.500000 bone vertex bone 1.0 1.0 = = bone -1
+frame -1
+bone vertex = 1.0 -1 frame bone anim texture vertex 1.0
+bone = = bone = anim bone material
+-1 0.500000
+bone material bone
+vertex material
+1.0
+vertex 0.500000 anim -1 bone frame = texture anim frame vertex = material
+texture texture
+0.500000 vertex 0.500000
+anim
+vertex 0.500000 material texture -1 bone -1 frame material anim =
+texture 0.500000 =
+= = 1.0 -1
+frame bone anim 0.500000 -1 vertex texture texture
+1.0 texture bone -1
+0.500000 =
+= frame 0.500000 frame 1.0
+= bone vertex
+0.500000 = bone bone -1 anim -1 anim 1.0
+1.0
+texture anim vertex
+0.500000 1.0 = vertex
+1.0 bone frame 0.500000 bone -1 frame = anim texture -1
+vertex 0.500000 anim
+=
+-1 = texture = frame
+texture
+frame -1
+1.0 vertex 0.500000 -1
+= material
+vertex bone -1 texture 1.0 frame bone material
+bone bone 1.0 anim material
+bone texture texture frame anim
+material
+anim 0.500000 = -1
+vertex vertex material
+bone 1.0 texture -1 texture texture
+= 0.500000
+frame frame vertex bone anim material 0.500000 material frame
+texture
+vertex = = 1.0
+anim -1
+material vertex material -1 -1 1.0 texture 0.500000 frame vertex
+frame = anim = material = -1
+frame 1.0 =
+vertex
+0.500000 1.0 bone material
+anim 0.500000 1.0 anim vertex -1 frame -1 -1
+1.0 0.500000 texture -1 frame
+anim frame =
+texture
+0.500000 0.500000 = 0.500000 vertex 1.0 = texture anim material
+0.500000 = bone bone 0.500000 vertex texture
+-1
+1.0 frame 1.0 1.0 anim material texture 0.500000 anim
+bone = bone frame material bone 1.0 anim = -1
+1.0 bone =
+0.500000 vertex = = vertex vertex 1.0 -1
+= = texture -1 vertex 1.0 = anim 1.0
+vertex bone frame 1.0
+1.0 frame
+anim 1.0 vertex = 1.0 0.500000 0.500000 texture frame 0.500000 frame bone frame
+texture
+1.0 frame = anim
+0.500000 vertex frame
+texture
+frame bone 1.0
+-1 vertex bone vertex bone frame texture -1 = bone
+vertex frame 1.0 vertex anim
+frame
+= = -1
+1.0 texture anim
+1.0 bone texture ve
\ No newline at end of file
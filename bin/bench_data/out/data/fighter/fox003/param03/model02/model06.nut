@@ -0,0 +1,67 @@
+texture
+frame
+material anim anim material frame texture 1.0 frame -1 bone bone anim =
+material
+= -1 frame
+texture bone
+0.500000
+frame = anim
+anim anim
+frame material vertex
+vertex texture
+1.0 -1 anim material
+texture vertex bone vertex anim frame = -1 material vertex bone bone =
+-1
+= frame frame vertex
+anim
+frame 0.500000 vertex
+anim material texture frame anim
+-1 material
+-1 = 0.500000 frame anim bone
+frame 0.500000 = bone
+0.500000 =
+vertex
+material 1.0 1.0
+0.500000 vertex = 0.500000
+bone bone
+0.500000
+= vertex vertex
+bone bone bone material texture 1.0
+material anim
+-1 material texture 1.0
+texture bone frame material =
+-1 bone anim texture bone
+material = 1.0 material = bone 1.0 1.0
+frame -1
+texture
+frame vertex
+anim anim frame vertex material vertex vertex bone 1.0 bone
+1.0 material anim bone -1 vertex material anim
+0.500000 1.0
+material 1.0 =
+texture 0.500000 1.0 bone texture -1
+material frame 1.0 vertex = texture = texture
+bone texture 0.500000 -1 1.0 = 0.500000 = bone material material texture material =
+0.500000 vertex
+-1
+frame 0.500000
+anim
+material
+material
+1.0 material texture 0.500000 anim = -1
+=
+frame texture vertex frame bone 0.500000 -1 frame -1 material frame
+texture
+frame frame 0.500000
+0.500000
+frame 1.0 vertex -1 texture vertex
+texture material texture vertex
+bone texture 1.0 bone vertex -1 = bone material frame 1.0
+vertex vertex -1 =
+=
+texture vertex frame bone frame
+material
+texture vertex -1 anim material = frame
+-1 frame
+bone
+1.0
\ No newline at end of file
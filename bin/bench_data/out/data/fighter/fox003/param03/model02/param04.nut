@@ -0,0 +1,3 @@
+frame material material -1 = material material anim bone -1
+frame 1.0 texture
+materia
\ No newline at end of file
@@ -0,0 +1,101 @@
+1.0 anim frame frame frame bone = frame
+0.500000 1.0 material = texture frame 1.0
+vertex material -1 1.0 anim
+1.0
+bone = 0.500000 1.0
+-1 -1 material 0.500000
+bone
+0.500000
+anim
+-1 1.0 vertex 1.0 anim material
+-1 texture
+1.0
+frame anim
+-1
+material 1.0 =
+bone material anim 0.500000 texture vertex =
+material frame 1.0 material -1
+0.500000
+material bone
+texture frame -1 anim material
+texture
+anim texture anim
+material material 0.500000
+texture texture bone vertex
+frame
+texture frame frame -1
+anim -1 bone
+vertex 1.0 0.500000 bone
+anim anim 1.0
+material material
+0.500000 = bone =
+1.0 bone frame material texture frame
+material vertex frame material frame
+1.0 vertex anim 0.500000 = material bone anim
+anim -1 frame -1
+texture material
+anim
+anim 1.0
+texture material
+frame 0.500000 texture material
+vertex bone vertex 0.500000 1.0 -1 bone 0.500000 texture texture bone -1 -1 -1 vertex 0.500000
+-1
+0.500000 material
+bone
+= bone frame
+frame -1
+frame
+= =
+frame texture 1.0
+= = 1.0 material =
+frame anim
+-1 = vertex anim 1.0 = frame 1.0 1.0 frame 1.0
+frame anim 1.0 texture material vertex anim
+-1 1.0
+frame
+0.500000
+0.500000 anim
+0.500000 bone frame 1.0 anim texture 0.500000 texture =
+1.0
+= = vertex material 0.500000 texture
+vertex -1 anim texture
+vertex material bone
+frame bone
+bone
+bone =
+1.0 texture 0.500000
+vertex vertex
+1.0 vertex 0.500000 1.0 = material texture frame 0.500000 0.500000 1.0 vertex
+0.500000
+1.0 bone bone material vertex material
+vertex 0.500000 frame
+material material material vertex anim anim
+anim material =
+vertex frame vertex frame 1.0 frame frame vertex anim anim 1.0 material texture bone bone
+anim material
+texture vertex
+= bone
+-1 0.500000
+vertex 1.0
+texture material 1.0
+0.500000 anim texture anim anim
+vertex bone 1.0 anim
+1.0 bone
+= vertex frame
+vertex vertex
+frame material texture vertex material anim material anim = anim vertex anim
+texture -1
+vertex anim -1
+-1 frame bone =
+bone material anim
+anim 1.0 vertex anim -1 frame
+bone
+= 0.500000 texture anim bone anim material vertex
+material = vertex
+texture bone -1 bone anim anim vertex
+bone texture -1 = anim texture
+0.500000 bone bone
+= bone -1 vertex 1.0
+vertex 0.500000 texture
+1.0 material =
+0.500000 1
\ No newline at end of file
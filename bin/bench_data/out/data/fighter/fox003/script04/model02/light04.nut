@@ -0,0 +1,162 @@
+= anim material 1.0 vertex 1.0
+-1
+-1
+1.0 1.0
+anim = -1 material
+frame
+bone 0.500000 -1 1.0
+-1 frame -1 texture
+bone
+texture vertex
+texture -1 material frame
+-1 material frame texture = bone -1 frame
+1.0 -1
+bone texture 0.500000
+texture material
+-1 material frame anim 1.0 material 0.500000 anim material
+vertex material
+anim bone bone = vertex anim material anim frame 1.0 vertex
+0.500000 texture anim = 1.0
+texture texture 1.0
+0.500000 bone
+frame texture = -1 -1 vertex 0.500000 anim
+-1 material
+material texture
+= texture bone texture
+-1 texture
+anim
+vertex 1.0 = texture texture 1.0 vertex
+material -1 material bone bone = vertex -1 material 1.0 -1
+-1
+1.0 frame =
+material
+frame texture anim texture vertex
+= -1
+-1 material -1 vertex 0.500000
+anim frame frame material
+bone
+=
+bone frame 0.500000
+vertex anim bone material 1.0
+anim vertex bone
+0.500000 0.500000 anim
+frame frame texture 0.500000 frame texture -1
+frame material bone frame vertex 1.0 anim material 0.500000 vertex vertex texture
+vertex 1.0 frame 0.500000 -1 1.0 texture bone -1 frame -1 vertex 1.0 material bone anim 0.500000 material 1.0 1.0
+texture = = 0.500000 anim
+frame
+-1 frame
+texture texture = -1 anim
+vertex frame vertex
+anim texture
+= frame
+frame texture vertex texture anim vertex
+bone 1.0 texture
+0.500000
+vertex -1 material =
+=
+1.0 anim frame material 1.0 0.500000 = = frame
+0.500000 vertex anim
+-1 frame =
+material anim
+1.0 1.0 frame
+1.0 -1
+material vertex frame
+= 0.500000
+-1 1.0 bone material 0.500000 -1 frame -1 -1 =
+vertex vertex = 1.0
+bone
+0.500000 0.500000
+0.500000 anim texture = bone texture 1.0
+material
+vertex =
+-1
+vertex
+anim
+anim 0.500000 texture texture bone anim =
+vertex 1.0
+texture
+= bone texture material frame vertex
+1.0
+0.500000 -1 vertex -1 1.0 vertex
+bone texture
+vertex anim vertex -1
+texture 1.0
+material
+frame material material
+bone =
+material
+anim vertex 0.500000 =
+-1 texture 0.500000 vertex bone
+frame 1.0 vertex material 1.0 bone 1.0 0.500000 1.0 vertex = vertex anim anim 1.0 vertex vertex frame material
+=
+bone vertex = anim 1.0 vertex frame -1 = 1.0 -1
+texture texture anim = anim frame frame 0.500000 texture anim 1.0
+1.0 material texture material -1
+-1 vertex frame -1 vertex frame frame 0.500000 0.500000
+vertex = 0.500000 texture
+1.0 anim anim 0.500000 material frame anim bone frame 0.500000
+1.0
+bone anim -1 -1
+0.500000 bone 0.500000 1.0 1.0 vertex anim
+bone = 1.0 texture
+anim -1 -1 -1 -1 vertex 0.500000 0.500000 bone material vertex texture
+-1 anim
+=
+1.0
+0.500000 frame bone 0.500000 =
+material material 1.0
+anim -1 -1 vertex frame 1.0 bone frame vertex texture material =
+1.0 vertex -1
+texture vertex -1 -1
+frame texture anim
+-1 1.0
+0.500000
+bone bone material
+vertex material material material vertex anim texture anim -1
+-1 0.500000
+-1
+1.0
+= texture
+anim bone
+= =
+1.0 =
+0.500000 1.0
+frame frame vertex material texture
+= -1 texture bone
+bone
+vertex vertex 0.500000 texture
+1.0 texture
+anim
+0.500000 frame anim -1
+texture
+texture texture
+-1 anim
+vertex
+frame -1 1.0 1.0 anim = = -1
+= vertex 0.500000 bone
+anim bone texture
+-1 0.500000 anim =
+-1 material frame
+vertex 0.500000
+texture vertex
+-1 = -1 material
+anim -1
+material bone 0.500000 vertex 1.0
+vertex
+0.500000 0.500000 bone = 1.0
+=
+=
+texture
+anim anim -1 bone frame 0.500000
+vertex 1.0 0.500000 frame -1 anim
+0.500000 0.500000 frame 0.500000
+bone = -1 bone -1 = texture 0.500000 0.500000 bone 0.500000
+anim
+vertex texture
+frame
+= frame anim bone anim vertex -1 anim 1.0 material material
+-1 vertex texture
+frame material -1 -1 bone frame texture
+texture = bone
+f
\ No newline at end of file
@@ -0,0 +1 @@
+1.0 1.0 texture anim 0.500000 vertex anim bone -1 texture 
\ No newline at end of file
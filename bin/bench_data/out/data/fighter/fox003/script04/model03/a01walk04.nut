@@ -0,0 +1 @@
+1.0 material 0.500000 frame = frame m
\ No newline at end of file
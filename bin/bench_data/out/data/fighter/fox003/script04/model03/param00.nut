@@ -0,0 +1,110 @@
+1.0 texture
+0.500000 0.500000 anim frame
+bone material = anim -1 material anim
+= 0.500000 vertex
+texture
+frame bone 0.500000
+texture texture vertex = = frame 1.0 frame 1.0 0.500000 frame
+frame texture
+bone 0.500000 anim
+1.0 texture = anim -1 = 1.0
+1.0
+anim vertex 1.0 0.500000 bone
+bone
+frame 0.500000 1.0 0.500000 frame texture bone material anim 1.0 texture frame anim
+texture vertex material bone 0.500000
+0.500000 vertex material = anim
+-1 0.500000
+= 0.500000 1.0 texture bone bone anim
+= -1 0.500000 bone
+-1
+anim texture anim 0.500000
+frame 1.0 vertex = anim material vertex
+=
+frame anim = texture bone -1 anim -1 = texture
+frame material bone 1.0 bone = vertex -1 frame
+frame
+frame
+0.500000 frame -1 material bone texture
+= frame 0.500000 bone vertex frame
+=
+-1 bone 1.0 = -1 texture
+material vertex material
+texture
+texture = material bone frame 1.0 frame 1.0 frame vertex anim frame -1 vertex texture anim -1
+bone -1
+frame
+texture frame = frame bone
+= 1.0 vertex material 0.500000 anim -1 0.500000 frame material 1.0 vertex material anim =
+1.0 anim texture 1.0 0.500000
+= 0.500000 frame bone material
+-1
+bone frame
+texture frame 0.500000 frame 0.500000 = -1 anim material = = = anim = anim material frame material
+material frame = 1.0 material
+anim frame = bone
+anim bone 0.500000 vertex 1.0 frame 1.0
+1.0 vertex
+=
+material
+bone 1.0 bone vertex anim material
+-1 texture
+anim -1 bone
+frame bone frame
+vertex
+vertex bone frame 0.500000 frame bone 0.500000 = -1 -1
+bone anim anim frame
+anim
+material anim
+0.500000 vertex 1.0
+frame texture 0.500000
+-1
+frame frame texture =
+material
+=
+-1 frame texture
+material material anim -1 material bone 1.0 0.500000 -1 vertex 1.0 0.500000 vertex texture
+bone
+0.500000 texture 0.500000 1.0 frame texture = bone frame
+texture 1.0 anim 0.500000 frame material -1 anim material
+1.0 texture
+1.0
+= vertex texture frame
+vertex frame =
+anim
+= -1
+anim bone frame texture
+material -1
+vertex 0.500000
+anim texture vertex
+0.500000 = texture texture texture bone
+1.0
+-1 anim
+bone bone material 1.0 = frame texture
+1.0
+anim vertex vertex -1 vertex 1.0 material anim vertex -1 texture -1
+material
+0.500000 -1 anim -1 = -1 -1 0.500000 anim anim frame frame
+0.500000
+frame
+frame anim
+anim
+0.500000
+-1 1.0 bone -1 anim 1.0 vertex -1 bone frame frame
+texture =
+texture
+material -1 material
+-1 1.0
+anim bone material
+material texture material
+bone 0.500000
+0.500000 0.500000 0.500000 1.0 -1
+frame bone 1.0 -1 0.500000
+texture texture -1 1.0
+anim
+-1
+=
+anim anim texture material anim bone bone material material
+-1 frame material material material vertex
+-1 frame frame
+bone frame
\ No newline at end of file
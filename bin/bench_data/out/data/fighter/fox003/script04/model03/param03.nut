@@ -0,0 +1,51 @@
+anim 1.0 bone bone 0.500000 vertex
+0.500000 bone 1.0 0.500000 anim 1.0 1.0
+-1
+frame anim
+material 0.500000
+= 0.500000
+1.0 anim frame frame
+1.0
+1.0
+anim 1.0 texture frame vertex
+vertex frame vertex bone -1 texture 1.0 1.0 vertex frame texture bone material -1
+0.500000 vertex material 0.500000 -1
+0.500000 =
+-1 frame vertex =
+0.500000 frame 1.0
+material anim
+vertex texture 1.0 material vertex = material vertex
+0.500000 vertex bone texture bone vertex bone texture texture 0.500000 -1 0.500000 frame bone bone frame texture anim vertex -1 bone vertex 0.500000
+-1 1.0 0.500000
+texture = =
+1.0 -1
+-1 =
+texture frame material bone 1.0
+bone frame texture texture frame anim
+frame bone
+anim 0.500000
+-1
+0.500000
+material anim vertex vertex vertex
+material = anim 1.0 anim -1 frame texture
+1.0 bone
+material
+0.500000
+vertex vertex vertex
+material = bone
+-1
+0.500000 0.500000 frame
+anim
+texture anim frame frame texture frame
+vertex frame = 0.500000
+vertex
+vertex 0.500000
+bone -1 anim texture
+anim 1.0 texture bone frame vertex 0.500000
+-1 material
+material frame 0.500000 = texture texture = bone anim vertex -1 bone texture material
+0.500000 material vertex anim
+bone -1
+=
+anim 0.500000 1.0
+a
\ No newline at end of file
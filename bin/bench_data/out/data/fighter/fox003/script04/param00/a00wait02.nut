@@ -0,0 +1,234 @@
+=
+frame -1
+0.500000 anim vertex texture
+texture -1 bone
+0.500000
+texture
+= anim = bone
+-1
+-1 -1 0.500000 frame -1 material
+vertex 1.0 0.500000 0.500000 0.500000 1.0 material = -1 = 1.0 anim
+vertex -1
+frame 1.0
+= texture material
+frame -1 vertex
+0.500000 vertex 1.0 vertex anim material frame -1 material vertex 0.500000 1.0 0.500000 = = -1 1.0 1.0 vertex anim bone material
+vertex 1.0 -1
+bone
+vertex anim
+-1 material
+frame material vertex
+=
+texture
+anim 1.0 bone
+0.500000
+0.500000 texture
+texture
+1.0
+bone -1 texture
+vertex =
+anim frame
+frame material material 1.0 frame anim 1.0
+vertex
+anim -1 material anim = material anim
+bone
+texture
+anim frame anim frame
+0.500000
+1.0 material 1.0
+vertex = texture
+1.0 anim frame anim 1.0
+vertex
+material material 0.500000 texture 0.500000
+anim
+bone = texture
+bone = material
+material
+1.0 bone anim -1 -1 1.0
+texture material = anim texture 1.0 material bone frame bone vertex material = texture bone
+frame frame
+anim anim -1 texture 0.500000 bone =
+texture = 1.0 vertex bone
+anim 1.0 -1
+1.0 vertex 0.500000 bone
+1.0 1.0 material texture texture texture -1 1.0 frame
+anim bone
+material
+bone
+texture bone -1 vertex anim anim 0.500000 material -1
+frame
+vertex 0.500000 frame -1 1.0 -1 -1 bone bone vertex anim 0.500000 0.500000 -1 material frame frame texture
+material bone anim 1.0 bone 1.0 anim
+texture frame =
+bone frame = material bone -1 0.500000 0.500000
+-1
+vertex
+= -1
+bone vertex
+bone
+anim
+vertex texture = 1.0 0.500000
+frame frame anim 0.500000 texture texture vertex 0.500000
+= 1.0 texture 1.0 vertex bone frame =
+texture
+bone -1 anim bone vertex 0.500000
+vertex
+0.500000 frame texture 1.0
+0.500000 bone
+-1 1.0 -1 frame texture 0.500000 bone -1 bone bone = texture 0.500000
+= frame anim bone
+vertex material
+0.500000 -1
+frame 0.500000
+0.500000 material material bone anim bone anim -1 bone frame 1.0 = 0.500000 bone material
+material vertex frame
+vertex =
+= texture
+0.500000
+frame
+1.0 0.500000
+frame
+1.0 material = anim -1 anim frame bone texture vertex =
+frame
+material 1.0 anim 1.0 -1 bone 1.0 =
+bone
+1.0
+anim
+0.500000
+= =
+=
+=
+-1 1.0 bone bone vertex = bone 1.0 anim
+anim frame texture frame 1.0 frame 0.500000 1.0 1.0
+material vertex bone anim
+anim
+anim 0.500000
+= -1 frame bone texture 1.0 bone =
+vertex anim
+anim material = anim -1 bone -1
+anim vertex
+vertex 0.500000 anim = bone
+1.0 vertex bone texture texture
+vertex
+-1 texture
+anim vertex =
+bone
+material
+bone material
+bone
+anim bone 1.0
+material 0.500000 1.0 texture
+material =
+frame frame
+material
+-1
+1.0 anim
+vertex = 0.500000 0.500000 texture 0.500000 1.0 vertex -1 vertex frame 0.500000 vertex bone frame =
+vertex texture texture bone -1 0.500000 1.0 material
+-1 -1 frame vertex
+frame
+texture =
+=
+material -1 material frame -1 -1 texture
+-1 vertex
+anim
+bone bone -1 texture frame
+vertex 1.0 frame vertex 0.500000 vertex frame -1
+vertex = bone
+frame vertex
+anim texture anim frame = 1.0 0.500000
+= = texture -1 material
+anim anim
+frame =
+texture material
+1.0 texture
+frame vertex 1.0 vertex texture 1.0 vertex material
+bone anim material
+0.500000 =
+vertex
+0.500000 1.0 0.500000
+material 0.500000 material anim texture frame material texture frame
+-1
+frame
+anim anim
+frame texture
+vertex
+0.500000 -1 0.500000 frame
+material 0.500000 0.500000
+frame anim vertex material
+material -1
+0.500000
+0.500000 = 1.0
+= =
+texture anim material -1 -1 1.0 0.500000
+bone -1
+anim vertex texture
+texture material
+anim
+1.0
+bone 1.0
+vertex 1.0 material -1 material anim -1 = texture -1
+0.500000
+frame bone
+=
+material bone
+frame frame =
+0.500000 = texture 1.0 1.0 0.500000 0.500000
+-1
+texture material -1 frame = 1.0
+vertex
+texture
+texture texture material vertex anim
+-1 = 0.500000 material material 1.0 -1 texture material vertex
+0.500000 anim material bone
+= vertex frame frame 0.500000
+bone =
+1.0 bone 1.0
+anim vertex vertex = = anim frame material material vertex -1 bone
+1.0 0.500000 = vertex
+0.500000 frame = -1 anim anim frame vertex texture vertex bone material material
+frame
+-1 1.0 vertex vertex =
+bone material texture bone vertex material
+texture anim
+= anim
+=
+1.0 anim vertex 0.500000 = = = bone
+material
+texture
+1.0 1.0 1.0 = frame
+0.500000 bone -1 frame 1.0 1.0 texture
+frame = -1
+=
+frame
+anim 0.500000 -1 texture texture
+= bone 1.0 frame
+1.0 -1 material = frame
+frame vertex anim anim = -1 material
+vertex texture = -1 frame material vertex -1
+1.0
+bone frame
+material
+material 0.500000
+frame
+0.500000 = anim
+1.0
+vertex bone = bone bone vertex
+frame
+frame material -1
+texture 1.0 vertex bone texture bone -1 =
+-1 = 0.500000 1.0 1.0
+=
+1.0 = texture vertex anim bone
+0.500000 0.500000 frame
+anim 1.0 texture anim
+bone
+0.500000 frame -1 0.500000 0.500000 -1 bone 1.0
+0.500000 frame frame = 0.500000 material anim -1
+frame bone -1 = anim frame =
+frame
+= anim material frame -1
+vertex vertex frame 1.0 vertex 0.500000
+= bone
+1.0 texture
+frame texture anim frame -1 bone bone 1.0 0.50000
\ No newline at end of file
@@ -0,0 +1,6 @@
+-1 bone texture = 1.0 frame 0.500000
+frame 1.0
+anim 1.0 texture bone -1 bone
+anim anim = =
+texture 1.0 0.500000 material anim
+t
\ No newline at end of file
@@ -0,0 +1,2 @@
+g$gJ=s*BQ9ݔ#NJZW
+&=WσZOjôV2Gl
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000 = = texture
+-1 0.500000
+= frame
+1.0 material
+0.50
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 = bone 0.500000 material -1
+material
+frame -1 texture v
\ No newline at end of file
@@ -0,0 +1,59 @@
+anim = -1
+1.0 material frame 1.0 texture
+1.0 0.500000 anim
+frame
+texture vertex
+1.0 vertex
+frame vertex -1 1.0 1.0 anim texture texture
+1.0 bone anim
+=
+material 0.500000 anim
+-1
+bone texture
+vertex vertex material anim -1 1.0 vertex anim -1 frame
+1.0 anim
+1.0 material 0.500000 = -1 0.500000 =
+vertex 0.500000 1.0 1.0 anim
+texture 1.0 bone bone
+=
+-1 bone bone anim material bone anim vertex frame 0.500000 frame
+frame = bone
+vertex texture 1.0
+-1
+texture -1 vertex vertex vertex -1 vertex frame -1
+bone = 0.500000 0.500000
+0.500000
+-1
+anim
+1.0 anim
+texture 0.500000
+frame vertex
+texture 0.500000 texture texture vertex texture
+anim -1 = =
+1.0 bone 0.500000
+1.0 material vertex -1
+1.0
+1.0 material bone material =
+-1 -1 bone texture = vertex texture
+anim frame 0.500000 -1
+material bone -1
+0.500000 vertex material
+texture
+texture -1 1.0
+0.500000
+bone
+-1 vertex vertex anim material frame frame texture
+bone anim
+anim
+anim anim frame
+1.0 material bone
+vertex =
+-1 frame
+=
+0.500000 anim 1.0
+-1 frame material material =
+frame
+texture bone vertex 1.0 frame material vertex 0.500000 bone
+bone texture frame bone 1.0
+bone anim vertex frame material
+frame frame
\ No newline at end of file
@@ -0,0 +1,4 @@
+anim material bone = =
+anim material
+0.500000
+b
\ No newline at end of file
@@ -0,0 +1 @@
+(ΞѨG朩{q2I$cnaX:vnqcSBfR&[\/28ޟ_mqU1[Ȥ8(nam1y_G(r4O/)~Pwfrٟvq+_L[PaF!W.E%cVO'M7qGn$<㙈6ګp
\ No newline at end of file
@@ -0,0 +1,39 @@
+texture texture material 0.500000 0.500000 bone texture
+1.0
+bone frame anim
+= texture 0.500000 -1 -1 texture = vertex vertex texture vertex frame 0.500000 bone anim
+frame
+texture material frame
+bone 1.0 material =
+anim
+bone
+0.500000 = frame -1
+vertex 1.0 0.500000 anim
+1.0 =
+0.500000 material 1.0 0.500000 1.0 0.500000
+1.0 frame 0.500000 anim -1 = vertex
+=
+vertex anim 1.0 material 1.0 material
+0.500000 material material bone
+0.500000 anim 1.0 bone
+1.0
+material
+material frame
+= material anim
+-1
+anim anim
+0.500000 vertex
+vertex bone 1.0
+frame frame
+-1 -1 0.500000
+vertex
+0.500000 anim vertex bone 1.0 =
+frame
+vertex -1 1.0
+-1 frame
+frame = frame texture vertex texture
+material 1.0 texture 0.500000 -1 -1 =
+=
+-1 = bone 0.500000 frame
+= texture
+1.0 fr
\ No newline at end of file
@@ -0,0 +1,99 @@
+vertex
+anim -1
+0.500000 bone 1.0
+=
+vertex
+material texture
+bone texture
+1.0 0.500000
+vertex
+texture = = texture = 1.0
+1.0 -1 material bone
+= frame 0.500000 material
+-1
+anim frame vertex frame anim vertex 0.500000
+= anim material 1.0 frame
+=
+= vertex = bone texture
+bone = anim material anim material 0.500000 -1 material -1 vertex vertex material
+material
+anim vertex 1.0 vertex 0.500000 bone
+material
+=
+= material vertex frame bone
+-1 vertex 0.500000 1.0 = = material -1 0.500000 vertex texture 0.500000 bone
+1.0 1.0 frame material
+bone 1.0 1.0
+texture 1.0 -1 -1
+-1 material -1 vertex anim
+1.0 0.500000
+frame material vertex 1.0 1.0 anim
+bone = -1 material
+vertex material
+1.0 vertex
+frame frame 1.0 = -1 0.500000
+material 0.500000 bone = 1.0 1.0 0.500000 1.0 anim vertex 1.0 anim bone
+bone anim
+= 0.500000 -1 -1 anim -1 anim vertex
+anim vertex texture
+-1 anim = 1.0 bone frame frame 1.0 material anim
+frame -1
+material 0.500000
+0.500000
+= texture
+frame
+0.500000 texture
+texture
+material -1 = -1 anim bone =
+vertex bone
+vertex
+frame anim vertex = material
+frame 0.500000 vertex 1.0
+1.0 0.500000 =
+frame vertex texture
+-1 -1 bone 0.500000 vertex
+=
+bone
+0.500000 texture =
+-1
+0.500000 -1
+material vertex 1.0 anim vertex anim -1 = texture 0.500000 1.0
+bone 1.0 = bone frame
+1.0 frame 1.0 anim frame
+anim bone material -1 =
+vertex frame
+= anim = 0.500000 frame
+texture frame anim 0.500000 anim
+texture 0.500000 material anim bone =
+anim
+material bone 0.500000 -1 material
+texture bone 0.500000 anim
+texture
+bone
+= anim 0.500000
+0.500000 0.500000 frame
+1.0 bone bone = = material vertex anim
+vertex anim
+-1 anim
+-1
+vertex
+material anim = bone
+frame
+-1 material texture bone material material -1
+frame 1.0
+bone anim -1 frame = anim material 0.500000 -1
+-1 = 1.0 vertex anim
+texture bone
+0.500000 material
+= anim frame frame material
+frame material bone frame
+vertex anim
+texture material
+1.0 bone
+1.0 =
+-1 anim
+frame -1
+-1
+bone -1 frame anim
+1.0
+1.0
\ No newline at end of file
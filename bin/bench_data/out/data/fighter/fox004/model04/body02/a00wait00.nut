@@ -0,0 +1,165 @@
+bone -1 1.0 bone 1.0
+texture 0.500000
+material bone -1 vertex texture frame = frame 0.500000
+material 1.0 =
+vertex 1.0 bone -1
+texture anim -1 frame 0.500000 frame
+-1 frame
+anim anim
+texture material 1.0 -1 bone vertex bone -1 = vertex
+= 1.0 = = anim bone 1.0
+anim bone vertex anim -1 material anim frame
+1.0
+vertex texture
+anim 0.500000 1.0 material
+material vertex = -1 texture
+frame =
+=
+1.0 anim vertex frame
+vertex
+bone bone
+material texture
+= frame
+vertex texture material -1
+vertex = -1 vertex bone frame bone
+0.500000 = texture
+vertex -1 bone anim texture
+1.0 = 1.0 anim
+frame frame
+anim texture
+0.500000 texture = vertex material
+vertex
+0.500000 anim texture bone -1
+bone bone texture vertex bone material 0.500000 0.500000
+material anim bone -1 vertex texture
+vertex = 0.500000 anim = -1 0.500000
+bone 0.500000 texture = -1 frame frame = texture bone frame vertex anim 0.500000 material vertex texture anim
+texture texture
+vertex
+frame
+-1 1.0 -1
+vertex -1 frame = 0.500000 0.500000 material frame
+= 1.0 material anim
+= = -1 frame 0.500000 1.0 material bone anim frame
+frame
+= anim 1.0 frame 0.500000
+0.500000 bone 1.0 anim bone texture =
+texture
+texture = bone 1.0 texture
+1.0
+material 0.500000 vertex vertex bone material vertex -1 1.0
+material material vertex bone bone texture 0.500000
+= = 1.0 anim bone bone texture =
+0.500000 material
+= bone material
+1.0 -1 1.0 vertex frame bone -1 bone frame
+vertex = texture vertex texture
+-1 bone 1.0 bone frame
+bone
+vertex 0.500000
+material
+1.0
+-1
+frame
+texture
+anim texture 1.0 texture = bone
+bone vertex = frame -1 material 0.500000
+texture anim texture
+texture 1.0 -1 = bone
+vertex = 1.0 1.0
+anim frame vertex 1.0 -1 anim vertex
+bone -1 =
+-1 = frame
+frame 0.500000
+-1 vertex -1 0.500000
+texture 0.500000 anim
+anim frame
+vertex
+material
+1.0 vertex
+material bone anim bone material 0.500000 texture bone =
+0.500000 vertex
+bone material
+1.0 = texture
+bone frame material
+-1 anim vertex = anim
+vertex texture frame 1.0 bone
+vertex -1 1.0
+vertex vertex 1.0 frame 0.500000 frame = 0.500000 texture 0.500000 vertex =
+material texture = frame material
+1.0 material
+1.0
+1.0 1.0 1.0 material 0.500000 -1 =
+texture material bone texture
+0.500000
+= -1
+=
+1.0
+texture
+0.500000
+frame bone material anim frame anim
+= frame frame = anim
+frame
+0.500000
+vertex 0.500000 bone texture material anim texture bone 0.500000 -1 vertex bone = vertex
+bone 1.0
+frame vertex 1.0 1.0
+anim vertex -1 material
+texture bone = = 0.500000
+bone texture bone -1 anim frame texture anim
+-1 bone anim
+bone material texture anim 1.0
+material -1 0.500000 texture 1.0 0.500000 frame frame -1 = 0.500000 texture vertex anim 0.500000
+0.500000 -1
+vertex anim
+0.500000 material
+-1 -1
+bone
+vertex frame -1 1.0 texture vertex
+bone
+-1 anim frame material
+bone vertex anim vertex
+bone -1
+anim
+1.0 =
+material 1.0 vertex
+frame vertex anim -1 = 1.0
+texture -1 =
+-1 -1
+texture 1.0
+0.500000 anim 1.0 vertex material
+anim -1 1.0 material vertex
+texture material material anim 1.0
+bone material
+material 0.500000 0.500000
+vertex
+= frame material 1.0 bone
+anim 0.500000 vertex 1.0 frame 1.0 1.0 vertex
+material 1.0 anim
+texture = material anim texture = material
+frame 0.500000 anim -1
+texture
+anim 1.0 texture texture
+-1
+-1 -1 1.0 = = = material material material vertex texture anim material bone material 1.0 1.0
+-1 texture anim 0.500000 material
+frame 0.500000 1.0
+0.500000 bone -1 frame frame 1.0 frame 0.500000 = bone 1.0 1.0 material =
+vertex
+-1
+anim texture 1.0 anim =
+frame anim 0.500000 =
+bone
+= = texture
+anim anim material material -1 = 1.0
+material = 0.500000 1.0
+material texture anim material anim =
+= = frame
+bone 0.500000 frame vertex
+material
+material
+frame
+1.0
+-1 bone frame 0.500000 -1 1.0 0.500000 texture = material
+-1 material anim
+0.5000
\ No newline at end of file
@@ -0,0 +1,142 @@
+vertex material = material texture = vertex bone = 1.0 1.0 texture = 1.0 0.500000 = vertex 0.500000 1.0 frame frame texture -1
+= bone texture = material 1.0 =
+1.0 = bone anim frame material =
+vertex anim 0.500000 frame vertex -1 anim anim 1.0
+anim
+texture 1.0 anim texture = vertex material 1.0 = = material 0.500000 vertex frame 0.500000 bone anim vertex texture material vertex material texture bone bone -1 material 1.0 -1 -1 material anim 0.500000 0.500000 anim material texture
+1.0 vertex material -1 = -1 1.0 = texture
+0.500000 frame 0.500000 0.500000 texture
+1.0
+-1 anim
+1.0
+vertex
+1.0
+vertex
+frame texture
+anim bone
+= frame bone material -1 texture anim 1.0
+texture vertex vertex bone anim anim 0.500000 frame -1 0.500000 1.0 1.0 0.500000 bone 0.500000 vertex
+texture 1.0
+material
+0.500000
+-1
+anim
+-1 material bone vertex material texture texture vertex
+vertex 1.0 bone -1
+frame -1 frame -1 1.0 = bone texture vertex
+-1 frame
+material texture vertex texture -1
+material 1.0 frame 0.500000 1.0 -1 material = = material
+-1 -1 = bone material
+-1
+material = texture
+material -1 texture material 0.500000 -1
+bone
+= material texture texture bone = vertex material
+texture = -1 -1 0.500000 material -1
+= = 0.500000
+=
+texture
+0.500000 vertex frame texture -1 0.500000 texture 1.0
+bone
+-1 anim texture anim 1.0 texture
+bone = bone 0.500000 vertex frame -1
+-1 frame anim
+-1 bone
+bone frame anim
+bone -1 bone vertex
+0.500000
+texture = -1 0.500000 0.500000
+1.0 frame frame texture frame 1.0
+texture material anim 1.0 texture anim
+material vertex =
+= material 1.0 1.0 material frame = 1.0 =
+anim bone = 1.0 vertex material = material
+material bone vertex 0.500000 frame bone = texture bone bone vertex bone 0.500000 -1
+-1 frame
+= =
+material
+-1 bone material
+= anim =
+texture
+vertex
+-1 -1
+material
+texture
+1.0 =
+vertex frame texture material
+bone 0.500000
+0.500000
+frame =
+1.0
+vertex
+material
+bone 0.500000
+vertex = bone material
+-1 anim vertex anim
+vertex 0.500000 texture -1
+0.500000 texture 1.0 anim vertex vertex = 1.0 vertex
+anim frame 1.0
+anim
+bone -1 1.0
+= = texture bone bone vertex -1 1.0 anim
+=
+frame
+bone
+1.0 =
+= material vertex frame texture -1 =
+0.500000 = 0.500000 material = anim 0.500000 vertex
+vertex
+-1 anim vertex 0.500000 1.0 = = anim
+-1
+=
+material -1 vertex 0.500000
+bone bone -1
+anim vertex material vertex bone
+bone -1 texture texture -1 anim texture anim
+frame -1 -1
+1.0
+bone = =
+bone frame vertex 1.0
+1.0 0.500000 frame
+texture frame -1 anim bone = material 1.0 1.0 anim material anim anim bone -1 material vertex material frame = -1 material material frame material 0.500000
+bone frame anim bone 0.500000 material 0.500000 0.500000 1.0
+anim -1 -1
+material
+1.0 = -1 texture anim =
+1.0 1.0 1.0 -1 1.0
+material
+vertex frame frame -1 = 0.500000
+anim
+= vertex texture
+frame 0.500000 = frame bone -1 -1 0.500000
+texture = material bone
+material texture -1 material vertex 1.0
+bone
+0.500000 texture = 0.500000 texture
+bone frame frame = 1.0 0.500000 1.0 -1
+bone 0.500000 anim
+material
+texture
+texture = 0.500000
+-1 frame frame
+material vertex
+vertex material frame 1.0 texture material bone bone 1.0 frame
+-1 0.500000 1.0 -1 -1 material texture -1 texture
+1.0
+1.0 frame material vertex bone -1 vertex texture bone
+material frame 0.500000
+texture vertex
+texture
+material material texture anim frame bone frame bone -1
+= material vertex 1.0 0.500000 vertex
+-1 texture 0.500000
+-1 vertex bone
+=
+bone
+bone texture frame
+anim frame material material anim
+1.0 1.0 frame 0.500000 0.500000 texture bone
+texture
+anim 0.500000 frame material -1 1.0 vertex
+0.5
\ No newline at end of file
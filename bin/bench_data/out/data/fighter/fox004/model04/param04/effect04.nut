@@ -0,0 +1,9 @@
+texture material 1.0 anim
+frame
+material 1.0 texture = 0.500000 0.500000 vertex
+bone
+bone -1 material
+0.500000 vertex = 0.500000 texture bone frame = anim anim
+bone texture 0.500000 texture
+anim frame anim bone frame frame 0.500000 0.500000 material 1.0
+= vertex
\ No newline at end of file
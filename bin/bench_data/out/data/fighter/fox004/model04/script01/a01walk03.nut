@@ -0,0 +1,12 @@
+0.500000 material -1 = anim frame
+frame
+frame
+1.0 texture material vertex
+-1 1.0 bone anim bone
+0.500000 texture
+-1
+vertex =
+-1 texture material = 1.0 1.0
+vertex anim bone
+-1
+1
\ No newline at end of file
@@ -0,0 +1,73 @@
+0.500000
+1.0
+1.0
+vertex
+vertex 0.500000 bone frame
+texture -1 0.500000 bone
+= bone 1.0 frame
+1.0 -1 -1 texture bone
+material frame material frame
+frame anim vertex = texture bone anim =
+texture
+material -1 texture = = material -1 texture material material vertex -1 = frame
+material texture texture
+-1 frame frame
+= bone material material texture frame
+anim -1
+1.0
+0.500000
+0.500000
+0.500000 frame anim -1 -1 = material
+frame texture -1 1.0 anim anim
+vertex
+vertex
+material
+0.500000 frame anim material vertex 1.0 anim 0.500000
+-1 frame anim material
+anim = -1 bone =
+texture vertex
+material
+0.500000
+anim -1 texture vertex 0.500000 1.0
+material =
+-1 texture material 0.500000 material
+bone vertex = 1.0
+bone bone 1.0 1.0 frame frame anim material 0.500000 frame
+frame vertex vertex
+0.500000 bone frame 0.500000 frame vertex 0.500000 = anim
+0.500000 material
+material
+1.0 -1
+1.0 frame 1.0 texture vertex texture
+texture texture texture anim material
+frame 0.500000 texture
+1.0 = texture
+-1
+vertex
+material vertex 0.500000 0.500000
+material frame -1 1.0 texture frame = bone = bone 1.0 0.500000 material anim
+anim texture vertex 0.500000
+1.0 -1 bone frame frame = = vertex frame
+0.500000 = material texture 1.0 anim 1.0 material 1.0 1.0 frame bone 1.0 1.0 vertex 1.0 anim texture vertex bone anim
+texture frame
+= -1 1.0 frame -1
+0.500000
+vertex
+frame texture
+material
+-1
+0.500000 vertex
+1.0 vertex vertex anim 0.500000 = 0.500000 1.0
+bone = 0.500000 frame 1.0 anim material frame material
+texture
+frame 0.500000 vertex
+-1 = texture
+= 0.500000 = anim anim
+frame 0.500000 1.0 texture -1 = 1.0
+1.0
+anim -1
+1.0 1.0 anim
+0.500000 vertex
+vertex -1 vertex =
+= material 0.500000 vertex bone anim = frame
+1.0 -1 frame -1 texture textu
\ No newline at end of file
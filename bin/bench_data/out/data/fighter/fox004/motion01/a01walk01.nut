@@ -0,0 +1,7 @@
+0.500000 -1 = -1
+1.0 vertex =
+texture
+-1
+= anim frame
+texture material 0.500000 frame
+bone bone material 0.500000 = anim 1.0
\ No newline at end of file
@@ -0,0 +1,34 @@
+material 0.500000 frame anim 0.500000 -1 0.500000 anim material
+material 1.0
+0.500000
+0.500000 1.0 anim =
+1.0
+0.500000 = vertex
+bone 1.0 0.500000
+texture
+texture -1 1.0 0.500000 bone = anim anim anim vertex 0.500000
+texture frame =
+-1 -1 anim vertex 0.500000 0.500000 texture
+material
+material bone -1 anim 1.0 frame vertex
+1.0
+vertex vertex -1
+material
+texture texture texture =
+-1 anim
+1.0 frame
+= = frame = -1 anim texture = bone bone material = texture anim
+material material bone frame bone -1 1.0 -1 anim = = material 1.0
+material = material
+vertex frame
+bone -1 anim 1.0 anim
+0.500000 -1 =
+vertex texture = 1.0 = frame bone 0.500000 =
+anim texture bone vertex bone -1 0.500000 0.500000
+1.0 texture texture
+-1
+texture = anim frame -1 vertex frame -1 -1 frame -1 bone anim vertex frame 0.500000
+anim 0.500000 -1 frame -1 -1 material anim material 0.500000 texture bone
+vertex bone frame = bone -1 0.500000 0.500000 1.0
+anim
+material 1.0 a
\ No newline at end of file
@@ -0,0 +1,8 @@
+-1 anim = bone
+texture anim 0.500000 material 0.500000 1.0 frame texture anim bone 1.0
+1.0 0.500000 0.500000 0.500000
+texture = = material frame material anim frame texture frame = =
+1.0 = 1.0 vertex
+anim -1 texture
+0.500000
+-1 an
\ No newline at end of file
@@ -0,0 +1,173 @@
+vertex -1 =
+texture frame anim texture 0.500000 anim vertex vertex vertex 1.0 = 0.500000 texture bone 1.0
+anim 1.0 vertex anim texture -1
+anim
+1.0 -1 vertex 0.500000 material frame texture 1.0
+vertex
+-1
+bone 0.500000 1.0 vertex
+vertex 0.500000 vertex anim = texture 0.500000 material bone vertex anim vertex frame 0.500000 -1
+material material 1.0 0.500000
+bone vertex 0.500000 texture bone -1 0.500000 -1 texture texture
+-1 -1
+1.0
+texture texture vertex
+1.0 material
+texture vertex vertex bone material
+-1 bone vertex
+texture material 1.0 texture frame 1.0
+0.500000
+texture bone 0.500000 -1
+frame anim 1.0 -1 material material material 1.0
+0.500000
+0.500000 frame 0.500000
+bone 1.0 vertex
+0.500000 0.500000 1.0 texture
+bone
+texture
+= 1.0 texture anim vertex texture = -1
+1.0 bone
+bone
+1.0 material
+0.500000 anim
+frame bone material
+0.500000 material
+vertex 1.0
+bone 1.0
+vertex texture
+anim
+-1 -1 1.0 material material
+frame anim
+1.0
+-1 anim bone
+= frame anim anim frame vertex -1 anim bone
+1.0 = = bone anim material
+material
+vertex texture vertex frame
+0.500000 -1 1.0
+frame -1 texture vertex frame 1.0 anim frame material
+frame bone = =
+=
+vertex 0.500000 0.500000 0.500000 0.500000 1.0
+material
+material texture
+-1 =
+material 1.0
+anim
+vertex 0.500000 -1 frame = 0.500000 frame anim
+1.0 vertex material -1 1.0 texture 1.0 texture anim anim vertex anim
+vertex = anim
+vertex vertex vertex material
+bone bone material texture 0.500000 0.500000 bone bone
+bone texture material
+vertex -1
+anim vertex
+frame vertex frame 0.500000 anim 0.500000 anim
+anim
+anim -1
+vertex
+texture frame frame
+=
+material
+1.0 0.500000 material texture frame = frame frame bone anim 0.500000 =
+material = material texture
+= vertex = vertex
+0.500000
+=
+anim
+-1
+vertex
+material material 0.500000 = frame 1.0 1.0 vertex vertex anim
+0.500000
+bone
+-1 vertex 1.0 frame =
+texture 0.500000 bone
+vertex bone frame vertex
+-1 1.0 -1
+1.0 texture bone texture vertex
+anim material anim
+texture =
+1.0 frame
+frame frame
+texture
+bone
+frame = frame frame
+= anim
+-1 anim frame 0.500000 -1 vertex = = frame
+frame
+anim 0.500000 -1
+-1 frame frame material -1 -1
+frame
+0.500000 frame
+anim texture anim
+vertex 0.500000 material 0.500000 frame
+bone anim bone 0.500000
+texture vertex material 0.500000
+bone bone anim
+frame -1 = frame 0.500000 0.500000
+frame texture frame
+anim = vertex anim bone 1.0 =
+vertex bone -1 material = material vertex bone = -1 texture anim -1 = = -1
+material -1 vertex texture anim
+bone
+frame = 0.500000 -1 = -1 = 1.0
+anim frame
+anim
+1.0
+frame = texture bone = texture material
+-1 anim
+-1 = -1 bone bone bone texture texture anim
+bone 0.500000 -1 vertex bone material frame anim material = 1.0 1.0 texture = material anim bone frame frame vertex
+material -1
+0.500000
+vertex
+frame bone
+anim frame material
+0.500000 0.500000
+material anim -1 0.500000 bone
+anim anim material vertex = = = = texture frame anim material frame = 0.500000
+texture
+-1 anim
+vertex anim = =
+= 0.500000
+material vertex bone = =
+anim texture -1 -1
+vertex
+0.500000 = -1 frame vertex material bone
+frame anim =
+0.500000 -1 0.500000 = frame bone frame
+0.500000
+0.500000 vertex vertex 0.500000
+1.0 anim
+-1 anim frame -1 1.0
+1.0 bone -1 material frame texture vertex
+material frame material frame material vertex -1 = = = vertex material anim 1.0 0.500000 =
+-1
+frame texture vertex frame material 1.0
+texture bone anim
+1.0 vertex anim
+material texture =
+1.0 material = material
+frame anim =
+= 1.0 1.0 = frame texture material
+0.500000
+1.0 texture frame
+vertex bone
+texture 1.0 texture 0.500000 vertex texture
+1.0
+anim bone anim texture texture anim 1.0
+frame material
+anim texture 1.0 1.0
+frame vertex anim
+vertex anim
+0.500000 vertex
+1.0
+anim 0.500000
+material frame vertex
+-1
+texture
+anim vertex -1 texture texture -1 0.500000 = anim frame
+texture material vertex = material vertex
+texture -1 anim
+-1 texture texture anim vertex anim material
+bon
\ No newline at end of file
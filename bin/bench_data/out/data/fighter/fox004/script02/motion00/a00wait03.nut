@@ -0,0 +1,48 @@
+bone
+vertex vertex -1 frame = 1.0 material =
+= bone
+vertex material
+-1 = material anim
+texture
+-1 1.0 1.0
+= 0.500000 texture 0.500000 0.500000 material
+bone
+anim bone
+= = frame
+material
+anim
+1.0 =
+vertex vertex 0.500000
+0.500000 texture anim vertex 1.0 material
+texture frame
+0.500000 = frame material
+0.500000 0.500000
+bone
+texture texture -1 =
+bone frame vertex 0.500000 anim bone -1 vertex
+anim
+texture vertex material
+bone texture 1.0 frame texture
+anim
+material vertex bone vertex -1
+-1 vertex 0.500000 0.500000 1.0 texture = bone 0.500000
+vertex vertex material texture vertex material bone anim
+frame
+texture material
+1.0 -1
+bone 0.500000 bone anim vertex 0.500000 = 0.500000 anim material bone -1 anim
+material 0.500000 vertex -1 -1
+anim 1.0
+texture frame frame bone
+frame
+0.500000
+bone -1 = bone
+-1 0.500000 vertex material material vertex anim
+texture bone vertex vertex frame
+texture frame
+texture 1.0
+-1 anim material bone texture = 1.0 vertex
+-1 0.500000 -1 frame vertex
+material =
+vertex -1 material vertex bone material anim vertex 1.0 material frame texture texture bone = 1.0 -1 1.0 vertex anim frame 0.500000
+ani
\ No newline at end of file
@@ -0,0 +1,65 @@
+bone
+0.500000
+vertex texture
+texture texture frame anim
+= texture 1.0 bone
+0.500000
+bone
+texture
+material
+= vertex vertex
+anim
+0.500000 bone anim material frame -1 0.500000 texture
+= anim frame texture material 0.500000 anim texture
+= 1.0 texture 0.500000
+texture
+material -1 1.0 anim
+vertex =
+1.0
+material
+= frame
+-1 -1 anim = vertex vertex vertex 1.0 bone
+0.500000 =
+0.500000
+vertex frame
+bone 1.0 vertex vertex 0.500000
+frame material
+0.500000 anim frame frame frame
+1.0 vertex frame material
+anim bone material
+frame material -1 anim 0.500000
+material anim bone
+texture bone
+frame material bone texture 1.0
+texture vertex texture frame material -1 = material
+vertex anim vertex 1.0 anim -1 anim 1.0
+material -1 1.0 material = 1.0 -1 anim
+0.500000
+bone vertex 1.0 vertex
+texture
+= vertex
+texture
+-1 -1 texture
+anim bone bone vertex
+0.500000
+texture
+texture vertex frame
+0.500000 bone vertex
+-1
+frame = vertex 1.0 = = anim bone 1.0 0.500000 texture texture
+0.500000 vertex
+frame
+material = material 1.0 bone
+bone 1.0 material texture texture vertex texture bone anim = anim anim frame material 0.500000 texture vertex
+anim
+anim
+1.0 0.500000
+vertex -1 texture
+anim
+-1 =
+texture vertex
+texture 1.0
+0.500000 = -1 vertex
+= 1.0 material 0.500000 texture
+= vertex
+ve
\ No newline at end of file
@@ -0,0 +1,9 @@
+anim
+frame
+= texture vertex anim 0.500000 = texture
+= 0.500000 1.0 1.0
+0.500000 texture -1 anim vertex anim 1.0 vertex material frame -1 anim
+0.500000
+bone anim
+-1 vertex material = texture 0.500000 anim
+1.0 material anim t
\ No newline at end of file
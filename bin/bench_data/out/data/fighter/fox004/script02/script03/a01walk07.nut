@@ -0,0 +1,8 @@
+-1
+= anim bone material 1.0 vertex bone
+bone
+anim vertex
+texture anim 1.0 material bone anim vertex frame anim = -1
+material bone
+1.0
+= texture frame frame 0.500000
\ No newline at end of file
@@ -0,0 +1,2 @@
+-1 vertex -1 anim bone bone =
+-1 texture fra
\ No newline at end of file
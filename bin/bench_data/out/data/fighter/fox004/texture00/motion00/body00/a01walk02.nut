@@ -0,0 +1,14 @@
+material material 0.500000 -1 frame bone 0.500000 frame texture texture texture
+= anim material
+frame
+-1
+texture bone 0.500000 = 1.0 bone 0.500000 material
+= material anim
+texture 0.500000
+material anim anim bone
+vertex bone = 0.500000 -1 =
+1.0 texture
+texture
+0.500000 anim frame frame frame material 1.0 -1 =
+1.0 -1 texture
+v
\ No newline at end of file
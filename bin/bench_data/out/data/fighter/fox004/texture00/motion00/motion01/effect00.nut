@@ -0,0 +1,59 @@
+anim 0.500000 = 1.0
+frame 0.500000 bone material bone texture =
+texture = texture
+material texture bone -1
+material 1.0
+frame bone -1 -1 1.0 0.500000 texture -1 vertex 1.0 anim -1 frame vertex
+vertex vertex 0.500000
+bone material bone bone material bone texture -1 frame bone vertex
+= bone = anim bone = = 0.500000
+vertex bone
+0.500000
+vertex vertex 1.0
+bone 1.0 -1 vertex -1 vertex texture
+= 1.0 1.0 -1
+anim frame =
+-1
+anim 1.0
+frame = material
+anim frame
+anim texture = vertex
+1.0 -1 vertex anim
+frame material 0.500000
+0.500000 anim texture 1.0 vertex = material
+bone
+-1 bone vertex
+frame material
+material bone frame vertex
+-1 vertex bone material frame material anim 0.500000
+bone
+anim 0.500000
+1.0 texture material
+vertex = 0.500000
+= vertex
+frame 1.0 0.500000 material anim
+1.0 frame -1
+= material -1
+frame
+bone -1 vertex vertex vertex anim 1.0
+frame material frame material = bone frame
+bone frame
+= 0.500000 1.0
+vertex =
+0.500000 vertex -1
+-1 bone vertex -1 material
+-1 =
+bone
+anim material
+frame frame
+vertex anim anim
+= material material
+material anim anim 1.0 anim 1.0
+vertex frame = 0.500000 material =
+frame bone
+= bone bone 0.500000 0.500000 frame
+1.0 material
+0.500000 texture vertex
+texture bone = = bone anim vertex -1
+-1 -1 0.500000 0.500000 1.0 material 1.0
+text
\ No newline at end of file
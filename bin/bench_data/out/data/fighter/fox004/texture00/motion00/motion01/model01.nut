@@ -0,0 +1,13 @@
+= bone
+1.0 material = anim 1.0 anim bone = 0.500000 0.500000 vertex 1.0 1.0 -1 texture bone = bone
+frame = vertex 1.0 material 0.500000 bone frame = =
+1.0 anim
+anim 1.0 bone
+vertex texture =
+vertex bone anim bone frame anim 1.0 anim 0.500000 anim frame -1
+bone anim -1
+vertex material
+bone frame
+-1
+texture 1.0 frame bone frame vertex material
+bon
\ No newline at end of file
@@ -0,0 +1,188 @@
+bone vertex 1.0 0.500000 1.0 -1 1.0 0.500000 0.500000 1.0
+1.0 vertex 0.500000 texture vertex bone 1.0 vertex anim
+frame 0.500000 1.0 anim 0.500000 0.500000 1.0 vertex frame 1.0
+anim
+vertex -1 1.0 anim -1
+material 1.0 vertex frame
+material material anim
+-1 frame texture bone -1 1.0 bone bone = -1
+-1 texture =
+-1 vertex texture
+material 0.500000 = vertex
+frame bone frame texture
+bone material = 0.500000
+frame bone bone material = -1 -1
+0.500000
+frame -1 texture = texture bone -1 texture 0.500000 texture
+material
+1.0 bone texture
+material material anim texture frame frame texture bone
+-1 anim bone
+frame vertex frame = frame 0.500000 anim frame material -1 vertex vertex frame 0.500000 0.500000
+bone anim texture
+vertex
+= bone vertex texture -1 = bone
+= texture -1 1.0 -1 bone bone
+0.500000
+1.0
+vertex =
+texture -1 anim material anim texture 1.0 anim =
+anim bone
+anim
+= bone bone 1.0 vertex = -1 0.500000 -1
+0.500000 frame texture
+0.500000 texture 0.500000 material vertex texture anim 1.0 bone -1
+=
+anim bone
+0.500000 0.500000
+material
+frame -1 bone
+vertex frame material =
+frame 0.500000 -1 texture material 1.0 = bone vertex
+1.0 -1 0.500000
+-1 0.500000 -1 0.500000
+frame
+= vertex -1 frame bone = material bone vertex anim 0.500000 0.500000 = =
+anim bone bone texture = 1.0 material
+material frame vertex bone frame material
+frame 1.0 = = anim 0.500000 material
+material
+bone -1 1.0
+=
+-1 vertex 0.500000 = texture material material material 0.500000 bone bone anim material vertex
+texture
+frame anim 1.0
+bone anim material =
+-1 vertex
+anim
+-1 texture
+0.500000 1.0
+= material
+bone material
+1.0 -1 texture texture
+vertex 1.0 anim -1
+=
+0.500000 texture = texture frame -1 material
+1.0
+anim
+vertex = anim anim texture vertex 0.500000 1.0 1.0
+vertex frame
+vertex frame vertex texture
+1.0 texture
+0.500000
+vertex 0.500000 1.0 0.500000
+bone bone
+texture -1 1.0 material vertex anim = 0.500000 frame frame material
+bone 1.0
+=
+texture anim 1.0 frame bone anim bone 1.0 frame -1
+bone = 0.500000
+= vertex texture -1 = 0.500000
+-1 bone material 1.0 = bone =
+material
+vertex anim
+anim 0.500000 frame = 0.500000 0.500000 =
+vertex frame material 0.500000 -1 -1 texture bone -1 frame anim = material
+frame bone material anim bone frame
+anim 1.0 vertex
+-1 material anim
+=
+frame = 1.0 anim vertex -1 frame 0.500000 material = 1.0
+texture
+0.500000 bone 0.500000 0.500000 material
+vertex
+frame material anim material
+-1
+1.0
+material material
+-1 -1
+texture
+bone
+material
+material = bone vertex 1.0 frame
+= anim
+0.500000
+material
+bone 1.0 = frame anim frame
+bone 1.0 texture vertex =
+anim 1.0 material 1.0 -1
+material texture vertex -1 frame
+material bone texture
+-1 1.0 material 0.500000 vertex anim anim
+material = anim
+bone
+-1 anim -1 vertex texture material frame 0.500000 -1 anim material -1 frame 0.500000
+anim -1 texture vertex = frame frame 1.0 anim =
+frame -1 texture 0.500000 vertex 0.500000 -1 0.500000 material -1 texture
+0.500000 material bone
+1.0
+vertex
+frame bone = texture material -1 vertex anim material
+frame 1.0 -1 0.500000 0.500000
+vertex bone
+bone
+frame -1
+vertex bone = vertex frame
+1.0 bone texture -1 0.500000 frame
+-1
+bone
+texture bone
+0.500000 1.0 0.500000
+-1 anim bone
+vertex
+= 0.500000 texture
+-1 = vertex
+-1 anim
+frame anim anim vertex 0.500000 vertex material
+1.0 texture = frame vertex texture
+1.0
+anim anim -1 -1 material = frame
+anim
+material texture 1.0 1.0 =
+-1 bone frame 0.500000
+1.0 texture
+-1
+frame -1 bone frame = -1
+bone vertex = anim texture frame -1 -1 bone material
+1.0 0.500000 texture anim -1
+anim
+= anim -1
+frame
+= material texture vertex anim texture
+= 1.0
+vertex bone 1.0 anim = vertex
+material anim frame vertex 0.500000 vertex texture vertex bone = 0.500000 texture anim
+1.0 vertex
+-1 texture material frame =
+anim 1.0 -1 -1 =
+1.0 bone frame anim
+material
+anim anim
+1.0
+vertex texture
+1.0 vertex material -1 anim = frame material vertex -1 -1 = frame
+texture vertex frame material material
+anim frame
+1.0
+-1 1.0 bone frame -1 -1 anim texture vertex
+-1 1.0
+frame material vertex
+vertex
+=
+vertex texture -1 1.0 0.500000
+0.500000
+= frame
+=
+bone
+0.500000 0.500000 = anim frame frame
+0.500000
+material material texture texture bone frame 0.500000 vertex bone
+anim -1 bone texture 0.500000 0.500000
+texture material = 0.500000 bone bone
+frame material 0.500000 1.0 frame
+frame vertex anim anim
+texture = material anim
+1.0 0.500000 0.500000 vertex -1 anim =
+-1 texture
+bone 0.500000
+-1 frame vertex texture materia
\ No newline at end of file
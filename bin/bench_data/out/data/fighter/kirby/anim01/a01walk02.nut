@@ -0,0 +1,20 @@
+1.0 = frame -1 vertex
+-1 0.500000 = frame = anim 0.500000 frame
+anim 1.0 vertex
+vertex
+frame texture
+material 1.0 -1 material texture material
+vertex frame 0.500000
+1.0 -1 1.0 anim
+texture = bone material
+vertex
+bone vertex
+texture
+= 0.500000 vertex bone material texture
+anim anim = texture bone frame bone frame bone bone
+anim
+0.500000
+1.0
+1.0 bone 1.0
+frame bone
+= material texture material anim vertex 1.0 0.500000 ver
\ No newline at end of file
@@ -0,0 +1,53 @@
+vertex anim anim frame 1.0 texture 0.500000 bone
+= = 0.500000
+1.0 0.500000
+material 0.500000
+0.500000
+material material 1.0 material =
+anim = 0.500000 material
+anim =
+=
+anim bone
+anim texture
+0.500000 frame 0.500000 vertex
+0.500000
+= -1 = material material
+material 0.500000
+anim
+0.500000 bone
+1.0 = texture vertex bone frame
+-1 1.0
+-1 anim texture
+anim
+= = frame
+texture frame anim 1.0 frame 0.500000 = frame bone 1.0 -1 0.500000 0.500000 texture = bone 1.0 -1 texture material = vertex 1.0 vertex
+frame = bone 0.500000 -1 anim frame vertex = texture
+frame anim
+vertex
+-1
+material bone = bone material
+-1 = anim material vertex
+bone 0.500000 vertex
+anim 1.0
+= vertex bone bone -1 anim
+bone
+vertex -1
+vertex vertex bone anim = = texture texture material
+1.0 anim vertex -1
+0.500000
+material 1.0
+vertex -1 1.0
+frame
+bone
+material texture
+0.500000
+bone bone -1 -1 texture frame
+bone -1 -1 texture
+frame anim -1 1.0
+anim =
+anim 1.0 texture
+bone
+bone texture material
+anim texture frame
+frame anim 0.500000
+frame mater
\ No newline at end of file
@@ -0,0 +1,33 @@
+0.500000 texture material -1 -1 bone -1 texture bone 0.500000 bone =
+vertex
+material
+bone material = frame anim
+texture = vertex -1 bone frame texture bone 1.0 texture
+material 1.0
+material bone material
+0.500000 0.500000 anim
+anim
+frame
+texture frame frame texture material -1
+-1 -1 -1 -1 anim
+anim = texture = 1.0 =
+1.0 frame texture frame frame =
+-1 anim
+1.0 0.500000
+1.0 texture frame anim
+-1 1.0
+texture 1.0 0.500000 vertex material
+material vertex anim texture vertex
+= -1 anim 0.500000 texture = 0.500000 -1
+= anim bone 0.500000
+anim
+0.500000
+frame bone -1 vertex texture = -1 texture -1
+frame texture 1.0 frame texture 0.500000 anim texture anim
+vertex bone -1 bone
+0.500000 0.500000 -1
+frame
+-1 = 1.0 texture texture texture 0.500000 0.500000 texture
+frame = texture anim 0.500000 0.500000 frame texture
+= frame vertex 1.0 frame anim 0.500000 material
+tex
\ No newline at end of file
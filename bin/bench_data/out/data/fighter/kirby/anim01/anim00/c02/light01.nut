@@ -0,0 +1,36 @@
+frame
+0.500000 material vertex
+texture texture
+bone
+material
+frame
+vertex
+-1 = frame anim =
+texture texture
+texture
+-1
+-1 0.500000
+texture 0.500000 1.0 vertex bone bone
+0.500000 1.0
+vertex =
+0.500000 -1 bone texture
+bone
+1.0 vertex vertex 0.500000 bone = 1.0
+vertex
+-1 0.500000 0.500000 = -1 -1
+=
+bone frame
+1.0
+-1
+1.0 texture texture anim 1.0 0.500000
+=
+bone
+anim 1.0 frame material
+vertex = bone -1 frame = -1 1.0 0.500000 material frame material material
+0.500000 material bone vertex vertex -1 anim
+frame anim
+bone anim vertex frame
+-1 vertex frame -1
+-1 = material bone vertex vertex -1 -1 = -1 bone bone material
+frame
+0.500000 frame 1.0 0.500000 textu
\ No newline at end of file
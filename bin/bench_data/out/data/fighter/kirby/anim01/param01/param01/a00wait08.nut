@@ -0,0 +1,37 @@
+texture = =
+material material
+bone
+frame bone 1.0 material 0.500000 material
+-1 = material
+0.500000 texture = = texture vertex
+1.0 1.0 texture -1
+anim =
+0.500000
+material material -1 1.0 material 0.500000 bone frame frame material
+bone texture material vertex bone material
+material
+=
+1.0
+-1 texture material material -1
+texture
+anim 0.500000
+anim frame
+material 0.500000 = frame
+bone = frame 0.500000 1.0 bone texture material = bone 0.500000 frame material
+material frame 1.0
+material = material 1.0
+1.0 bone
+frame anim material
+-1 -1
+1.0 = frame = 0.500000 anim
+bone 1.0 = material = material anim material material bone
+0.500000
+0.500000 vertex
+texture
+-1 frame anim material -1
+frame bone frame
+bone
+-1 texture texture bone = = -1 material -1
+material
+texture vertex vertex
+material vertex mate
\ No newline at end of file
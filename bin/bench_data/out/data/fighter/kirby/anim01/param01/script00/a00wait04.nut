@@ -0,0 +1,12 @@
+0.500000 vertex 1.0
+material = texture
+0.500000 0.500000
+vertex vertex
+bone
+frame
+vertex texture = anim -1 texture bone 1.0
+anim frame anim bone material
+anim -1 texture 0.500000
+1.0
+frame vertex
+1.0 fr
\ No newline at end of file
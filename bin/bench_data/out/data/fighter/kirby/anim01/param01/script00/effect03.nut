@@ -0,0 +1,4 @@
+frame material vertex bone 1.0
+1.0
+vertex frame
+frame materi
\ No newline at end of file
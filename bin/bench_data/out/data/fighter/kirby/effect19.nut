@@ -0,0 +1,14 @@
+= vertex anim 0.500000 = -1 -1 anim =
+1.0 frame texture 0.500000 0.500000
+=
+material material -1 0.500000 vertex 1.0 bone
+= texture anim -1
+0.500000 texture anim
+0.500000 material texture texture
+0.500000
+1.0 =
+texture
+0.500000 anim 1.0
+frame -1 0.500000
+material anim anim -1
+material 1.0 fra
\ No newline at end of file
@@ -0,0 +1,11 @@
+1.0 0.500000 bone
+1.0
+frame anim anim frame 1.0 1.0 material
+material 0.500000 anim vertex = bone texture texture anim = texture bone texture anim texture -1 0.500000
+bone texture 0.500000
+1.0 vertex 0.500000 1.0 -1 = anim
+material -1 -1 vertex
+= 1.0 -1 frame frame material frame -1
+1.0
+bone
+-1 fra
\ No newline at end of file
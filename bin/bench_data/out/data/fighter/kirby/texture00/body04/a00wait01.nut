@@ -0,0 +1,25 @@
+vertex material material 1.0
+1.0
+material vertex
+0.500000
+=
+1.0 vertex = material material vertex texture 1.0 vertex
+vertex -1 material texture
+bone texture =
+frame 1.0 anim 0.500000
+vertex bone =
+1.0 = -1 0.500000
+bone frame
+frame anim frame bone
+bone 1.0 bone material bone
+anim
+vertex vertex material vertex bone -1 anim texture 0.500000 = 1.0 bone frame bone 0.500000 material -1 material material 1.0 1.0 -1 bone 0.500000 =
+1.0 material bone material
+1.0 vertex bone
+1.0 texture
+anim frame 1.0
+vertex frame texture
+material -1 -1 0.500000 -1
+bone -1 vertex = 0.500000 anim 1.0 1.0 material = 0.500000 frame material texture material bone
+texture texture bone
+anim texture bone vertex texture texture texture 0.
\ No newline at end of file
@@ -0,0 +1,336 @@
+frame = vertex vertex
+texture vertex
+1.0
+frame frame vertex bone 1.0 -1
+frame = texture texture material = = 1.0 -1 texture texture 1.0 0.500000 0.500000
+vertex material texture texture
+= = material
+1.0
+1.0 1.0 0.500000 anim vertex anim bone
+material
+anim frame vertex texture 0.500000 texture material material 0.500000
+vertex =
+= frame 0.500000 vertex -1 1.0 texture texture material
+texture = texture = 0.500000 anim = bone
+material 1.0
+-1 1.0 texture 0.500000 = frame 1.0 1.0
+0.500000
+anim -1 frame bone texture
+texture material
+vertex anim material
+anim = = -1
+-1
+bone anim texture bone frame 0.500000 material vertex
+1.0 -1 -1
+-1 0.500000 material vertex bone -1 frame frame material bone
+anim
+0.500000 = bone bone bone material texture bone vertex
+-1 1.0 vertex texture =
+texture 0.500000
+anim
+1.0 bone
+1.0 0.500000 texture 1.0 0.500000 0.500000 texture
+anim texture 0.500000
+vertex
+material frame frame
+-1 1.0 0.500000 frame material
+0.500000 = material 1.0 -1 material vertex vertex
+material 0.500000 -1 anim
+1.0 texture anim
+vertex material vertex vertex material material anim 1.0
+1.0 anim
+anim frame -1 anim
+material texture = material -1 = texture frame
+=
+0.500000 material frame vertex
+frame texture
+0.500000 texture -1
+1.0 anim vertex
+= = -1 1.0 1.0 material material
+1.0 texture anim texture
+frame bone
+anim
+-1 0.500000 material texture material material
+vertex -1 = frame -1
+1.0
+=
+-1 material
+1.0 -1 anim
+material 0.500000 bone -1 vertex 1.0 0.500000
+texture
+-1 -1 vertex
+anim 0.500000 vertex
+bone anim 0.500000
+anim 1.0 bone
+1.0 material
+vertex 1.0
+texture bone anim
+anim
+bone
+1.0 = frame
+-1 material bone = 0.500000 bone material
+vertex vertex = = material vertex vertex bone
+0.500000 material
+anim vertex 0.500000 texture frame
+texture = -1
+-1
+vertex 0.500000 bone -1 1.0 bone bone 0.500000 material bone = bone texture -1 0.500000
+= 1.0
+vertex
+1.0 texture material anim anim anim
+anim 1.0 -1 texture vertex material anim
+bone = 0.500000 material anim material 0.500000
+material = 0.500000 material 1.0 0.500000 anim -1 anim -1 vertex = 1.0
+texture
+frame 1.0 = bone anim
+bone bone material 1.0 anim material bone
+material 0.500000 anim -1 bone
+frame vertex 1.0 anim 0.500000 0.500000
+texture frame
+-1 material -1 texture 0.500000 0.500000 vertex
+texture =
+material 1.0 = anim -1 frame
+frame material
+1.0 bone texture -1 vertex bone
+bone material material bone anim = bone frame frame 0.500000 vertex 1.0 anim -1
+material frame
+0.500000 texture
+anim 1.0 1.0 1.0 anim frame bone
+0.500000 0.500000 = texture texture vertex -1 frame = bone vertex frame anim
+texture bone anim anim material 0.500000 frame
+anim material texture bone frame frame
+bone frame vertex 1.0 vertex frame
+= anim
+bone -1 anim bone texture
+bone vertex 1.0
+bone
+bone
+1.0 frame
+=
+1.0 1.0
+-1 anim
+material -1 material bone frame anim -1 = material
+texture bone vertex frame texture
+-1 -1 =
+material 0.500000 anim =
+bone
+0.500000 vertex
+= texture 0.500000 anim =
+anim
+0.500000 -1 = -1
+vertex material texture 1.0 frame -1 = 0.500000 frame bone material
+texture =
+0.500000 anim anim material anim = material frame = vertex = texture anim 0.500000 1.0 1.0
+bone 0.500000
+0.500000 = 0.500000 bone
+-1
+vertex anim 1.0 anim -1 bone vertex anim 0.500000 1.0 -1 vertex
+bone
+vertex = frame material anim = frame frame frame -1 texture texture =
+frame frame vertex -1 -1
+texture 0.500000 material
+= bone =
+0.500000 anim
+material
+frame =
+bone
+bone = 0.500000 = -1 anim vertex
+frame material =
+texture = anim -1 material material vertex
+texture
+vertex 1.0 =
+-1 texture = vertex material 1.0
+vertex 0.500000 material anim
+vertex
+texture anim
+0.500000 texture =
+bone bone
+material vertex
+anim material 1.0
+texture 1.0 -1 bone frame 1.0 frame anim frame
+material anim
+material 1.0 vertex 0.500000 vertex frame frame texture
+anim
+0.500000 -1 bone frame texture = = 1.0 -1 -1 -1
+bone texture material
+-1 =
+vertex
+vertex = anim anim texture -1 = 1.0
+0.500000 material
+frame anim
+texture 0.500000 bone texture = 1.0 0.500000 bone -1 texture = =
+texture
+texture -1 material 0.500000 -1
+anim 0.500000 texture vertex frame -1 material
+1.0
+frame 1.0 frame anim 1.0 0.500000 material vertex 0.500000 anim -1 -1 vertex frame
+vertex = bone -1 material 0.500000 frame anim
+texture
+frame bone bone
+-1
+bone anim
+-1 anim frame 0.500000 bone anim
+bone
+-1
+texture anim
+material material anim
+texture -1 1.0 texture -1 frame frame vertex
+texture frame
+bone material vertex bone
+frame frame
+= vertex = texture frame
+=
+-1
+-1 frame
+bone 0.500000 = vertex
+0.500000
+= 1.0 frame anim 1.0
+anim
+vertex
+vertex
+vertex
+material = = 1.0 material texture 1.0 1.0 texture frame
+0.500000 vertex
+-1 material =
+= texture
+anim
+= material bone frame vertex
+bone 1.0 vertex -1 vertex frame
+vertex anim vertex anim vertex vertex anim anim -1 = bone
+bone material 0.500000 -1 bone vertex 1.0 frame
+anim material -1 -1 0.500000 vertex anim = 0.500000
+anim texture texture bone frame anim 0.500000
+bone 1.0 1.0 1.0 frame texture anim
+1.0 -1 bone 1.0
+anim
+vertex
+0.500000 0.500000
+0.500000 vertex
+0.500000 1.0
+texture texture
+1.0 0.500000 = material 1.0 bone bone 0.500000 =
+= 0.500000 frame -1 0.500000 -1 bone
+frame
+texture
+bone vertex texture 1.0 vertex texture material frame = -1 0.500000 material 1.0 bone
+0.500000 vertex frame anim =
+frame
+bone material
+frame anim
+vertex material
+frame
+0.500000
+frame -1 -1
+frame bone texture 1.0 frame anim bone 1.0 vertex anim anim texture vertex material vertex 0.500000
+= vertex vertex frame -1 = 1.0 material texture material texture 0.500000
+frame vertex -1
+texture frame
+anim
+frame anim
+-1
+texture -1 0.500000 material material bone 0.500000 bone =
+frame
+vertex material
+= material 1.0 bone
+= anim anim
+texture anim bone 0.500000 anim = anim
+bone =
+bone frame
+vertex 1.0 texture texture
+frame
+=
+-1
+1.0
+=
+1.0
+1.0 vertex frame
+-1 anim
+material anim -1
+anim 0.500000 vertex
+bone frame
+texture 1.0 =
+0.500000
+material -1 frame = texture -1 texture
+anim 1.0 vertex
+material
+= material bone -1 bone
+= material texture
+-1
+anim vertex bone
+1.0 anim material frame
+= texture
+frame vertex texture vertex
+=
+frame bone bone 0.500000
+anim 1.0
+anim
+bone -1 1.0 -1 -1 material 1.0
+anim material =
+bone anim
+1.0
+material 1.0
+texture anim vertex bone frame material texture -1 frame
+1.0
+1.0 bone
+material vertex 1.0 -1 bone 0.500000 texture material =
+0.500000
+texture
+0.500000
+anim vertex
+anim material texture 0.500000 -1 bone texture
+frame frame bone -1 frame bone
+frame 0.500000
+0.500000 anim = 0.500000
+material anim
+texture = frame material material bone 0.500000 -1
+material bone bone 0.500000 material 1.0 frame frame
+material
+frame bone bone anim bone texture
+=
+1.0 bone
+anim frame
+= vertex anim
+vertex 0.500000 -1 anim anim -1
+texture texture -1 anim bone bone
+-1 frame texture material
+-1 = vertex anim
+=
+0.500000
+bone
+bone
+1.0
+= vertex -1 1.0 anim
+bone
+= texture
+texture 1.0 anim 0.500000
+-1 -1
+texture bone texture anim anim = frame frame anim bone
+1.0 anim
+texture bone 0.500000 bone 0.500000 frame texture anim material bone
+material 1.0 bone anim anim
+= vertex material 1.0 material
+1.0
+anim frame vertex
+vertex
+texture texture texture
+texture texture
+texture
+0.500000 1.0 material anim anim frame bone 0.500000
+1.0 frame anim 0.500000
+texture bone anim 0.500000 material material
+-1 texture 0.500000 frame vertex frame -1 anim 1.0
+bone 0.500000 anim frame bone
+0.500000 bone
+1.0 frame
+texture anim 0.500000 bone -1 anim 1.0 anim 0.500000 anim =
+material frame bone
+material -1 1.0
+frame
+vertex frame texture
+1.0
+0.500000 anim
+bone bone 0.500000 material = anim 0.500000 = bone frame
+0.500000 texture frame 1.0 = 0.500000 anim -1
+material
+frame
+material b
\ No newline at end of file
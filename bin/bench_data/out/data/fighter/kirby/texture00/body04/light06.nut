@@ -0,0 +1,92 @@
+0.500000 -1 0.500000 0.500000 bone
+0.500000 vertex frame 0.500000 = 1.0 =
+1.0 1.0 0.500000 material material material vertex bone
+1.0
+material anim bone = -1
+bone material 1.0 frame
+frame vertex material vertex 0.500000
+texture
+0.500000 anim
+0.500000 vertex vertex
+texture = -1 anim =
+1.0 frame bone 1.0 texture =
+material 0.500000 material 1.0 texture anim -1
+vertex 0.500000 frame
+-1 vertex
+0.500000
+texture
+anim 0.500000 anim vertex 0.500000 = anim anim frame -1 -1 vertex
+-1 vertex bone = vertex =
+0.500000 -1 material bone = 1.0 1.0 texture anim bone frame -1
+0.500000 1.0 texture 0.500000 vertex texture 0.500000 frame = texture 1.0
+material anim
+texture 0.500000 anim
+1.0 anim = 1.0 frame 1.0
+bone = anim
+1.0 vertex
+texture -1 bone
+bone anim
+vertex texture
+bone -1 vertex texture 0.500000 frame texture
+material vertex texture texture anim texture 0.500000 1.0 texture 1.0 1.0 material bone vertex frame vertex = 0.500000
+=
+anim 0.500000 -1 frame
+anim frame 0.500000 1.0
+material material vertex bone vertex texture vertex
+texture
+texture bone anim -1 1.0 -1 = bone vertex
+texture
+vertex 0.500000
+bone -1 0.500000
+anim texture vertex -1 material
+texture 0.500000
+vertex texture 0.500000 0.500000
+anim
+texture -1 1.0 vertex 0.500000 -1 vertex
+bone anim frame
+vertex
+=
+anim
+= material texture 0.500000 -1
+bone material texture anim frame material 0.500000 0.500000 -1 bone anim frame anim frame = bone 0.500000 1.0 vertex 1.0 -1 frame = frame
+vertex -1 frame 0.500000
+texture
+bone
+bone bone
+1.0 0.500000 1.0 bone anim 1.0
+texture
+= texture =
+material
+texture 0.500000 0.500000
+=
+material material
+anim
+-1 bone bone
+anim = material vertex
+0.500000
+anim
+0.500000 1.0
+-1
+-1 anim = material
+vertex vertex texture 1.0
+anim
+texture material -1 frame
+anim material bone vertex
+-1 frame material =
+1.0 texture bone texture bone texture material -1
+frame material
+frame vertex 0.500000
+texture 1.0 1.0
+-1 0.500000 frame anim anim 0.500000 0.500000 = material bone bone 1.0
+bone -1 = = texture
+-1
+texture frame 1.0 -1 bone texture vertex vertex anim -1 anim -1 = texture = texture 0.500000 material
+=
+anim 0.500000 frame
+frame = 0.500000
+bone bone frame
+bone material -1 vertex 1.0 = -1 material
+-1 texture material frame 1.0 -1 material material -1
+texture
+-1 frame 1.0 bone bone material material
+anim te
\ No newline at end of file
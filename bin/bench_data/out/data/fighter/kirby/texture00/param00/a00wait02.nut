@@ -0,0 +1,148 @@
+material
+= material -1 texture
+bone material -1
+= material frame =
+0.500000
+vertex anim
+material
+anim frame 0.500000 texture = texture 0.500000 0.500000
+material texture
+= texture
+frame texture
+anim anim material -1 vertex
+frame
+= 0.500000
+frame texture vertex = texture 1.0 = 0.500000 1.0
+bone frame texture frame vertex = texture
+texture
+texture = = frame
+anim anim 0.500000 1.0
+1.0 anim frame 0.500000
+frame -1 texture 0.500000 0.500000 = material -1 vertex
+1.0 -1 bone 0.500000 -1 frame 0.500000 texture =
+0.500000
+texture anim
+frame
+texture texture frame 1.0 vertex vertex
+frame material texture 1.0
+= anim anim
+0.500000 -1 texture anim =
+=
+frame anim vertex
+bone 1.0
+1.0 0.500000 material 0.500000 vertex =
+-1 0.500000 0.500000 texture -1
+1.0
+texture 0.500000 =
+material -1 -1 vertex material
+texture = = anim = texture anim
+frame frame vertex -1 0.500000 1.0 anim vertex bone
+frame frame anim -1
+0.500000 texture bone
+bone -1 frame -1
+0.500000 frame 0.500000 -1 = 1.0 -1 anim -1 texture bone 1.0 = = vertex
+-1 -1
+material vertex anim texture bone bone 0.500000 1.0
+0.500000 0.500000 bone material
+= 0.500000 vertex
+= -1 = 0.500000 material 0.500000 1.0 texture
+vertex -1 material frame material frame material anim frame
+1.0 texture = material frame frame 1.0
+1.0 anim frame bone texture
+= 0.500000
+-1
+bone bone vertex
+0.500000
+1.0 1.0
+= material material
+1.0
+anim
+bone
+bone -1 bone
+0.500000 vertex anim 0.500000 anim 0.500000 anim material 0.500000 -1 1.0 0.500000
+1.0 material vertex
+texture vertex material frame 1.0 -1 anim -1 material vertex bone frame frame texture frame vertex material -1 vertex
+1.0 material texture vertex 1.0 frame
+1.0
+=
+anim =
+anim frame
+anim
+-1 vertex vertex anim 1.0 = 0.500000
+0.500000 0.500000 -1 vertex bone bone bone
+vertex texture anim
+bone material anim vertex
+anim frame
+=
+texture
+texture frame texture
+0.500000
+texture vertex = material texture texture
+0.500000 vertex 1.0 anim
+= bone frame
+anim bone
+frame material frame vertex 0.500000 frame material 0.500000
+frame frame
+= 1.0 = texture
+anim vertex bone 1.0 frame bone vertex bone
+1.0 anim vertex material
+anim vertex
+texture
+-1 0.500000 -1 frame 0.500000 texture 1.0 0.500000
+-1
+=
+= frame
+bone texture vertex
+0.500000 anim
+= -1 -1 anim bone = material texture material
+texture
+anim frame texture 0.500000 0.500000 bone bone anim
+1.0 vertex
+bone vertex texture =
+-1
+bone 1.0 frame vertex vertex 1.0 1.0
+0.500000 = texture frame
+anim
+vertex 0.500000 texture bone
+texture material 1.0 material = = frame = 0.500000
+material material = material anim 1.0 anim texture texture
+frame
+anim texture
+texture
+= bone
+bone =
+0.500000 bone -1 bone -1 =
+material
+-1 1.0 0.500000 bone 0.500000 frame vertex texture
+material anim
+1.0 =
+anim
+-1 0.500000 frame vertex 1.0
+1.0 1.0 =
+0.500000
+bone
+vertex
+0.500000
+vertex anim
+=
+material -1 texture bone = anim
+texture texture bone material -1
+0.500000 texture material -1 vertex material vertex anim
+bone
+anim 1.0 bone anim material frame texture 1.0 1.0
+= anim
+1.0 vertex material =
+= 0.500000
+=
+= -1 -1 0.500000 1.0
+material material 0.500000
+-1 1.0 material bone anim =
+bone = material
+frame -1
+= 1.0 frame material 0.500000 0.500000 0.500000 -1 0.500000 1.0
+=
+material vertex
+-1 = anim vertex frame
+anim texture texture frame texture -1
+texture
+material -1
\ No newline at end of file
@@ -0,0 +1,32 @@
+vertex
+0.500000 anim
+0.500000 -1 0.500000 frame -1 material
+bone vertex anim texture vertex
+texture = 0.500000 material 1.0 = texture vertex 1.0 0.500000 vertex anim material 0.500000 bone
+frame
+0.500000 -1
+bone vertex anim 1.0 frame frame
+vertex texture
+1.0
+anim
+frame -1 frame frame -1
+-1
+anim 1.0 material
+vertex -1 texture vertex 0.500000 1.0 texture
+= =
+1.0 0.500000
+-1 frame frame 1.0 bone = anim
+material vertex 1.0
+bone
+material
+anim
+=
+-1 frame = bone frame frame texture 1.0 = 1.0 material texture frame = 1.0 =
+=
+texture = material vertex -1 vertex anim = frame
+anim 1.0 vertex
+material -1
+frame
+=
+frame material 0.500000 frame frame 0.500000 -1 anim
+0.500000 = frame = bone 0.500000 material material anim vertex ani
\ No newline at end of file
@@ -0,0 +1,17 @@
+0.500000
+frame -1 frame -1 material material anim material
+frame 0.500000
+material
+= bone 1.0 bone anim texture
+bone -1 = vertex frame
+bone anim
+frame =
+frame 0.500000
+bone = anim texture frame anim
+material texture vertex -1
+material anim
+1.0 anim = 0.500000
+frame
+texture -1 vertex
+anim anim
+texture 0.50000
\ No newline at end of file
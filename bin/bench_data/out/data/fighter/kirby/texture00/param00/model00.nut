@@ -0,0 +1,17 @@
+0.500000 frame
+0.500000 vertex
+0.500000
+bone material 0.500000 -1 bone
+0.500000 1.0 material
+1.0 anim vertex vertex -1 frame 1.0
+frame
+frame
+texture anim
+= 1.0 frame frame
+=
+bone bone texture -1 bone vertex = material -1 anim
+anim
+1.0 material
+texture
+1.0 = 0.500000 frame anim anim -1 frame anim
+anim anim vertex an
\ No newline at end of file
@@ -0,0 +1,39 @@
+0.500000
+anim 0.500000 1.0 vertex =
+texture vertex material frame material frame = material bone anim bone vertex bone = material 1.0 = 1.0 anim 1.0
+material
+1.0
+1.0 vertex material = 1.0 bone 0.500000 -1 anim
+material
+1.0
+bone
+-1 = material
+0.500000 bone -1
+material 0.500000 frame -1 vertex
+1.0 0.500000
+= anim vertex frame material anim texture
+0.500000 anim vertex
+-1 vertex
+frame = frame frame 0.500000
+=
+texture material
+bone =
+= texture
+material 0.500000 0.500000 0.500000 -1 = frame bone material bone 1.0 bone -1
+1.0 texture 0.500000
+0.500000 material
+=
+material = bone texture 0.500000 anim 1.0
+1.0 material
+material anim bone texture
+-1 bone anim bone vertex
+bone = 0.500000
+frame vertex
+bone 0.500000 -1
+= texture anim
+= texture 1.0
+1.0 bone 0.500000 -1
+1.0 texture frame
+=
+-1 bone material = anim 1.0 =
+= frame -1 an
\ No newline at end of file
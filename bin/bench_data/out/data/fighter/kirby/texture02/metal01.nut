@@ -0,0 +1,6 @@
+vertex
+0.500000
+anim
+bone
+-1 material
+bone material vertex bone material
\ No newline at end of file
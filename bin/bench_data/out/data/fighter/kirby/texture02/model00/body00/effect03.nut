@@ -0,0 +1,122 @@
+= bone = frame texture 1.0
+=
+vertex
+texture 0.500000 frame frame vertex
+bone material vertex
+1.0 1.0 -1 = bone vertex vertex 1.0
+bone 0.500000 = 0.500000 frame frame bone 0.500000 vertex anim material 0.500000 1.0 material = vertex =
+-1 1.0 texture anim
+frame -1 -1 = bone 1.0 texture -1 material -1
+= 0.500000 frame frame 1.0 texture
+frame = -1 texture -1 texture anim texture texture = -1 material
+1.0 anim texture 0.500000 material bone vertex material anim anim
+-1
+frame anim
+vertex
+= = vertex
+1.0 material bone texture anim = frame
+frame frame material -1 anim
+bone = texture vertex anim 1.0
+texture
+vertex material
+texture frame material
+1.0 = material texture vertex = texture 1.0 material
+bone = vertex anim frame
+texture frame frame
+1.0 = 0.500000
+1.0 frame 1.0 0.500000 texture
+anim -1
+material frame 0.500000 -1
+vertex
+anim bone 1.0
+1.0
+anim vertex bone frame -1 =
+-1
+frame -1 = -1 anim frame bone frame
+bone material -1
+frame
+frame texture 1.0 0.500000 bone =
+bone frame
+anim =
+texture 0.500000 bone
+material 1.0 vertex
+bone = = frame frame anim material bone 1.0
+texture =
+0.500000 -1
+vertex 1.0 1.0
+vertex = material
+1.0
+bone anim bone -1 frame material
+bone
+texture bone =
+texture = 1.0 frame -1
+frame
+= anim 1.0 =
+vertex texture 0.500000 = frame 1.0
+anim
+frame texture 1.0 texture vertex vertex bone anim 1.0 vertex
+anim
+frame
+bone 1.0 bone = =
+texture material = vertex -1
+vertex 1.0 -1
+bone anim frame
+frame =
+0.500000 -1 vertex texture vertex
+1.0
+material 1.0 texture frame
+= material 1.0 texture -1
+texture
+0.500000 1.0 1.0 material vertex bone frame
+frame vertex
+vertex
+=
+frame
+0.500000
+vertex
+-1 material texture vertex = vertex
+material bone
+anim
+vertex 1.0 bone 0.500000
+= material material 1.0 frame anim anim vertex frame 0.500000
+0.500000 =
+0.500000 frame material
+frame texture bone -1 frame -1 anim
+1.0 bone vertex = frame anim -1 frame
+1.0 vertex bone bone frame 0.500000
+1.0 frame material vertex
+texture 1.0 vertex texture vertex vertex
+vertex frame texture 1.0
+= = -1 1.0 vertex anim
+vertex vertex frame = = material bone anim -1 anim
+-1 = frame 0.500000 anim texture
+=
+0.500000 1.0
+material anim -1 texture = frame frame material
+1.0 material vertex vertex texture anim bone texture vertex
+texture
+= bone
+vertex texture -1 -1 1.0 -1 0.500000 frame
+vertex
+texture texture anim
+anim
+bone bone
+= frame
+-1 material
+0.500000 anim vertex -1 anim vertex anim 0.500000
+vertex -1 frame
+0.500000 bone vertex = =
+0.500000
+anim anim texture
+= anim frame
+0.500000 bone 1.0 1.0 -1
+0.500000 =
+frame material bone material
+bone
+bone vertex 0.500000 material frame
+frame vertex -1
+-1 bone bone frame 0.500000 = -1 texture bone bone vertex 0.500000 = vertex
+= = bone bone 0.500000
+frame = bone texture
+bone frame -1 bone material
+= frame frame 1.0 materi
\ No newline at end of file
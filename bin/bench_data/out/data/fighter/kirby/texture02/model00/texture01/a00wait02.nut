@@ -0,0 +1,11 @@
+frame texture
+1.0 -1 frame frame 0.500000 vertex 1.0 vertex frame vertex
+= anim =
+anim bone bone =
+=
+0.500000 texture
+texture
+texture vertex -1 anim -1 texture 1.0
+vertex texture
+frame
+-1 
\ No newline at end of file
@@ -0,0 +1,6 @@
+material
+vertex
+0.500000 texture -1 texture = anim vertex
+1.0 vertex -1 texture texture material frame bone anim material
+-1 1.0
+material anim vertex -1 materia
\ No newline at end of file
@@ -0,0 +1,32 @@
+vertex texture 0.500000 texture anim frame 1.0
+0.500000 vertex vertex bone = 1.0 anim 1.0 texture =
+frame vertex = -1 = material bone
+anim 0.500000 material
+anim bone frame 1.0
+-1
+anim
+0.500000 1.0 vertex = material
+-1 -1 anim vertex anim 0.500000 texture -1 0.500000 material anim bone anim 1.0
+vertex
+= -1
+material
+1.0 frame texture texture -1 0.500000
+frame 0.500000 vertex texture
+frame = = 0.500000 texture frame
+= = 0.500000 0.500000 1.0 vertex bone 1.0 =
+frame material 0.500000 -1
+anim -1 vertex
+frame = material = -1
+1.0 vertex material
+vertex bone frame 0.500000 0.500000 -1 bone frame frame
+anim anim
+frame anim texture vertex anim -1
+= material =
+material
+vertex =
+bone vertex -1 bone
+frame
+=
+material = = = bone bone material 0.500000 = 0.500000 bone -1 anim texture anim texture 0.500000 texture 1.0
+=
+bone 
\ No newline at end of file
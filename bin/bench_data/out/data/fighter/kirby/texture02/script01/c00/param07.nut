@@ -0,0 +1,131 @@
+texture
+1.0 bone = texture -1
+= 1.0 0.500000
+material texture material material
+0.500000 texture
+-1 1.0 material frame material
+0.500000 texture material texture texture material
+material
+vertex -1 texture 1.0 bone material anim texture
+material vertex 0.500000 -1
+anim 1.0 texture
+-1 texture vertex frame 1.0 -1 1.0 = 1.0 material -1
+= material frame material 1.0 =
+bone bone
+texture frame = 0.500000
+1.0
+0.500000
+= anim
+1.0 1.0
+=
+= -1 1.0 1.0 texture vertex = =
+1.0 material
+frame
+material frame 0.500000 frame bone -1 vertex
+anim frame
+material 1.0 anim
+0.500000 0.500000
+0.500000 material 1.0
+material
+anim
+anim
+material bone
+frame anim material frame = 0.500000 = material
+1.0 bone 1.0 0.500000
+vertex
+-1 frame anim -1 texture anim 0.500000 frame texture anim vertex texture material vertex bone bone material vertex anim
+bone
+-1 1.0
+bone bone
+bone = anim vertex
+texture -1 anim frame -1 bone
+anim =
+anim
+vertex frame bone texture
+0.500000 texture 0.500000 0.500000 bone anim
+material texture 0.500000 texture
+anim anim 1.0 texture
+-1 1.0
+-1
+0.500000 1.0 -1 material = 1.0 vertex
+0.500000 frame
+bone
+anim
+texture
+1.0 texture bone bone = material material bone 0.500000 frame
+-1 material = -1 texture vertex bone material material
+1.0 material texture
+0.500000
+frame vertex
+frame 0.500000 texture -1 1.0
+-1 anim 0.500000
+frame
+anim
+1.0 vertex 1.0
+vertex
+anim frame anim texture material 1.0
+1.0 0.500000 -1 bone
+anim texture bone 0.500000 = 1.0 material 0.500000 = -1 bone vertex texture anim texture vertex frame
+0.500000 material material anim vertex
+1.0 material
+bone anim bone frame vertex 0.500000 vertex = -1 material -1 frame
+1.0 texture bone
+0.500000 -1 = frame texture vertex
+anim -1 1.0 anim
+frame -1 = 1.0
+1.0 anim
+texture material vertex
+bone anim texture = material vertex
+0.500000 bone vertex bone
+1.0 anim 1.0
+0.500000 =
+anim
+texture 1.0 frame
+anim material bone 1.0 1.0
+= frame vertex bone material
+texture
+vertex material 0.500000 frame bone frame
+1.0 vertex texture -1 material bone
+bone vertex frame =
+frame texture
+frame = -1 vertex 0.500000 1.0
+-1 bone anim vertex texture
+vertex
+= 1.0 vertex 0.500000
+material
+= frame
+vertex frame 1.0 vertex material anim
+material anim material 0.500000 frame 1.0
+bone
+material 1.0
+vertex anim
+1.0 material
+anim 0.500000 frame
+anim frame
+anim -1 = frame
+texture
+0.500000 frame bone 1.0 material vertex -1
+-1 =
+1.0 frame bone anim frame = frame 0.500000 material = anim
+frame 1.0 0.500000
+bone -1
+bone vertex
+= texture anim = -1 material
+anim
+bone 0.500000
+=
+material
+frame
+-1 frame 0.500000 -1
+-1 texture
+frame -1
+= texture 1.0 0.500000 texture 0.500000 1.0 material bone anim
+material =
+1.0 vertex = anim frame texture bone bone 0.500000 = frame 1.0 0.500000 -1 = 0.500000 1.0 -1
+anim bone anim 1.0 anim 0.500000 = material vertex 1.0
+vertex vertex 1.0
+1.0 frame -1 frame -1
+0.500000 vertex anim vertex 0.500000
+-1 vertex
+anim =
+text
\ No newline at end of file
@@ -0,0 +1,262 @@
+1.0 0.500000 material -1 material bone frame 1.0 anim material anim -1
+anim texture anim
+vertex
+0.500000 frame
+frame bone
+material bone
+vertex vertex
+frame vertex 1.0 -1
+-1 bone
+anim anim bone
+texture anim
+vertex = 0.500000 vertex
+0.500000 frame texture vertex anim frame
+1.0
+1.0 bone -1 material bone frame 0.500000
+0.500000 anim -1 vertex 1.0
+frame texture material
+1.0 -1 0.500000 frame 0.500000 texture
+0.500000
+texture = frame
+1.0 = anim bone material anim material 0.500000 = = 0.500000
+0.500000 0.500000 0.500000 material
+material = vertex
+anim
+texture -1 = = frame vertex 0.500000
+0.500000 texture 1.0
+bone frame material = =
+bone frame 1.0
+frame texture =
+vertex frame = texture = 1.0
+texture texture material 0.500000 1.0 0.500000 -1 vertex
+1.0 material vertex 0.500000
+frame
+= bone anim anim
+texture vertex material
+anim
+frame material texture frame anim frame vertex = texture frame
+= = 1.0 -1 -1
+bone
+1.0 = vertex 1.0 bone = anim
+bone -1 texture bone texture
+1.0 vertex bone 0.500000 texture vertex vertex texture vertex
+bone
+-1 frame
+1.0
+anim
+-1 0.500000 = -1
+anim -1
+texture = 0.500000 anim bone
+vertex bone -1 texture 1.0 0.500000 = -1 texture
+frame vertex 1.0
+frame
+texture =
+material 0.500000 texture = material -1 1.0 material anim -1
+-1 =
+0.500000
+texture 1.0 texture 0.500000 vertex 1.0 bone
+= -1 bone bone 1.0 -1
+1.0 texture 0.500000 1.0
+-1 vertex
+=
+material = vertex vertex -1 -1
+0.500000 texture -1
+-1
+-1 0.500000 texture frame
+material vertex
+vertex
+frame 0.500000 0.500000 frame texture
+0.500000
+1.0
+vertex = material = = vertex anim 0.500000
+-1 material
+vertex
+vertex
+0.500000 material bone bone = = = material
+=
+-1
+-1 1.0 frame = 1.0 = 0.500000 -1
+texture
+bone vertex = -1 1.0 texture vertex vertex
+1.0 material
+-1 bone
+frame 0.500000 1.0 anim anim 0.500000 -1 0.500000 -1
+1.0
+0.500000
+-1 bone bone -1 vertex
+texture frame vertex = vertex anim bone 0.500000 1.0 material material anim 1.0 texture frame 0.500000 -1 frame 0.500000 -1
+= 0.500000 frame 1.0 -1 anim texture 0.500000 material
+texture texture bone anim
+1.0 frame
+material frame frame bone anim material texture 0.500000
+-1
+anim = vertex -1 -1
+anim frame -1 = material bone
+1.0 1.0 bone
+material vertex texture 1.0 material bone = vertex bone
+= frame bone
+anim
+material texture -1 =
+texture -1 anim -1 = anim material texture anim vertex
+bone anim bone = anim
+material anim texture -1 anim
+0.500000
+frame material frame
+1.0 1.0 = 0.500000 bone frame
+texture = material 1.0
+material 0.500000 0.500000 anim 1.0 bone bone
+1.0 = vertex 0.500000 1.0 = 0.500000 material anim 1.0
+1.0 bone 0.500000 0.500000 material frame -1 frame =
+texture
+bone
+1.0
+texture material 1.0 anim
+= 0.500000 1.0 -1
+1.0
+1.0
+vertex 1.0 frame -1 frame
+texture = = -1 -1 material frame
+= 0.500000
+frame
+bone
+frame texture material material -1 bone bone anim vertex 1.0 texture = -1 1.0
+1.0
+bone = vertex 0.500000 anim texture = material texture material anim bone frame 0.500000
+-1 bone anim
+bone 1.0
+frame
+bone 1.0
+anim
+= 0.500000 -1 0.500000
+vertex frame = bone material texture
+= -1 0.500000 bone frame = -1 =
+0.500000 anim frame
+= 0.500000
+anim
+-1 = material
+material texture texture 1.0 vertex 0.500000
+-1
+material material
+texture 1.0 0.500000 -1 1.0 frame anim
+vertex material material frame material 1.0 bone 0.500000 texture anim
+anim
+vertex anim anim
+1.0 frame frame
+anim 0.500000 bone 0.500000 0.500000 1.0 vertex anim anim bone
+anim texture
+bone texture
+material 0.500000 0.500000
+material
+anim 0.500000
+0.500000
+vertex material material
+=
+=
+anim
+material
+anim
+vertex = bone material texture =
+1.0 bone anim
+bone material frame
+texture
+vertex anim
+texture vertex
+0.500000 texture material 1.0 vertex material = 0.500000 vertex
+bone 1.0 anim
+frame frame texture anim 0.500000
+frame
+bone material texture
+-1 material 0.500000 material bone
+vertex =
+anim -1 = 0.500000
+texture 0.500000 frame texture material frame 0.500000 texture
+vertex
+bone = texture 0.500000 1.0 0.500000
+bone = -1
+= vertex -1 0.500000 0.500000 vertex anim -1 1.0 frame
+frame 1.0 -1 0.500000 vertex
+material
+= anim = 1.0 -1 0.500000 bone texture 1.0 -1 frame bone 1.0 anim material 1.0 0.500000 material
+material material
+bone -1
+0.500000 texture bone vertex = 1.0 =
+= 1.0 anim
+texture 0.500000
+vertex = vertex = material
+-1 =
+= anim frame = texture vertex 0.500000 1.0
+bone 0.500000 -1
+frame -1 frame bone
+=
+anim
+anim
+material 0.500000
+1.0
+texture material texture bone 1.0
+0.500000 bone = 0.500000 texture
+material 0.500000 anim
+1.0 texture 0.500000 = 0.500000 -1 bone 1.0
+= -1 0.500000 bone texture frame
+= frame material
+1.0 1.0
+=
+material
+1.0 bone -1
+frame frame bone 1.0
+= anim
+bone material
+anim
+=
+anim material
+= = 1.0 anim bone 1.0 anim vertex
+=
+= texture vertex material 0.500000 material -1 frame anim
+vertex
+material vertex frame anim anim
+-1
+vertex frame
+bone
+anim 0.500000
+1.0
+-1
+-1 -1 0.500000 material
+material 1.0 vertex
+anim
+1.0 frame
+material -1 texture 0.500000
+material material material vertex material
+-1 frame
+material frame -1 bone material 0.500000 =
+-1 texture
+frame
+anim
+frame -1 anim -1
+1.0
+bone anim 1.0
+1.0 frame texture -1 frame vertex 0.500000 bone
+1.0 = bone
+= bone bone -1
+-1 bone material
+0.500000 material
+0.500000 = texture anim 0.500000 vertex material
+frame vertex
+anim -1 0.500000 texture material
+vertex vertex anim anim anim texture
+frame
+vertex frame anim -1 = material texture
+material material
+frame 1.0
+-1 -1 1.0 1.0
+vertex material texture texture
+texture texture vertex 0.500000 bone =
+0.500000 = material anim material -1 texture 0.500000 anim
+-1 texture frame anim =
+vertex
+-1 anim vertex
+bone -1
+vertex
+material
+= texture anim
+=
+= vertex vertex -1 vertex frame texture
+bone 
\ No newline at end of file
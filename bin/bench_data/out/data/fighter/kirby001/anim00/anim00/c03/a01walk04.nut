@@ -0,0 +1,24 @@
+material vertex vertex 1.0 material bone
+frame 0.500000 = anim =
+0.500000 =
+anim 1.0 bone
+-1 1.0 1.0 frame bone material -1 frame
+vertex 1.0 texture
+material 0.500000 material material vertex 1.0 1.0
+bone vertex
+bone 0.500000
+-1 texture frame = anim frame
+-1 = = frame = bone anim material -1
+material 0.500000
+0.500000 texture
+material
+vertex texture 1.0 bone
+1.0 material bone material
+texture 1.0 anim vertex bone
+frame vertex frame material material vertex
+vertex
+bone 0.500000 -1 1.0 material 1.0 bone 1.0 0.500000 bone 1.0 =
+anim bone texture
+bone texture
+bone anim frame material material vertex material = material 0.500000 = material frame vertex
+a
\ No newline at end of file
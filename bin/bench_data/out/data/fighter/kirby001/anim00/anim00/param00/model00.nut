@@ -0,0 +1,5 @@
+-1 -1 =
+texture vertex
+frame 0.500000 1.0
+0.500000 anim material 1.0 vertex -1 frame frame -1
+frame = material frame 1.0 bone vertex f
\ No newline at end of file
@@ -0,0 +1,15 @@
+-1 vertex =
+material 0.500000 frame = vertex
+bone
+0.500000 0.500000
+1.0 = bone
+0.500000 frame -1
+=
+bone vertex anim -1 1.0 = = 1.0 1.0 vertex =
+-1 vertex bone texture 0.500000 vertex frame
+1.0 material anim
+0.500000
+anim bone 0.500000 -1 0.500000
+vertex material material texture = = 1.0 -1
+vertex
+bone = bone vertex fr
\ No newline at end of file
@@ -0,0 +1,204 @@
+-1
+0.500000 bone frame anim
+frame material
+-1 texture material vertex bone bone
+frame
+material 1.0 1.0 -1
+vertex
+texture anim anim
+anim = bone bone frame vertex 0.500000 texture bone anim material
+-1
+vertex 0.500000 1.0 vertex texture
+texture
+1.0
+= material frame frame anim
+material vertex -1
+frame 1.0 = texture anim 0.500000 = vertex 0.500000
+1.0 anim bone
+frame
+material
+0.500000 anim
+=
+1.0 material 0.500000 0.500000
+1.0
+vertex 1.0 texture =
+vertex
+vertex material
+anim material 1.0 vertex 0.500000 = frame
+1.0
+frame -1
+-1 texture
+0.500000 bone
+0.500000 0.500000 -1
+material
+vertex
+-1 material
+material anim frame material
+frame
+frame vertex vertex bone 0.500000 material vertex
+anim 0.500000
+-1 bone vertex frame
+material vertex
+0.500000 material
+0.500000 anim
+bone = texture -1
+material = -1
+vertex = material -1 1.0
+texture
+-1 =
+material
+texture 0.500000
+1.0
+=
+texture
+0.500000
+anim
+1.0 0.500000
+= -1 frame texture -1 anim frame -1 -1 -1
+vertex =
+-1 -1
+frame texture anim vertex anim frame anim bone
+0.500000
+= -1 material frame anim = material 0.500000 -1 texture
+1.0 0.500000 anim = 1.0 anim vertex texture
+material
+0.500000
+1.0
+bone anim bone
+1.0 0.500000 texture 0.500000 -1 vertex frame bone
+bone
+frame 0.500000
+-1
+= texture frame material
+frame material
+material
+texture -1 0.500000 vertex 1.0 texture -1
+frame
+anim texture
+texture 1.0 texture anim vertex bone 0.500000 -1 0.500000
+= 1.0 vertex
+material
+1.0 texture bone
+frame 1.0 = bone material material texture
+=
+-1 vertex material -1 0.500000 -1 material
+anim
+bone bone 1.0
+vertex frame
+0.500000 bone -1 texture bone texture frame = bone
+bone 0.500000 vertex = texture texture texture texture anim frame
+0.500000 -1
+=
+1.0 vertex
+anim material frame
+material
+1.0 material material material
+material bone material
+texture frame
+bone -1
+=
+1.0
+vertex 0.500000 0.500000 vertex bone texture = 1.0 0.500000
+material = 1.0 material anim
+0.500000
+frame material bone anim frame material frame
+-1 1.0
+frame 0.500000
+0.500000 0.500000
+= material -1
+bone texture -1 = 0.500000 bone
+0.500000
+frame vertex frame
+texture
+vertex
+anim anim
+1.0
+material 1.0
+bone anim -1 texture texture vertex frame
+bone = bone material bone bone texture
+1.0 1.0
+1.0 -1
+anim
+bone material vertex vertex
+0.500000 vertex texture 1.0 anim anim frame material
+= -1
+texture anim
+anim texture 0.500000 1.0 bone bone texture bone anim
+-1 texture bone
+texture -1 0.500000
+= frame
+material bone
+1.0 = = 1.0 = bone anim anim -1 1.0
+frame
+= frame -1 bone =
+frame vertex
+0.500000 anim bone material anim 1.0
+vertex
+anim 0.500000 0.500000
+bone material
+texture texture
+vertex anim 1.0 -1 texture = = anim bone 1.0
+bone
+bone material material -1 1.0
+material frame 1.0
+vertex
+= texture = anim frame
+0.500000 texture = 1.0 0.500000 texture 1.0 anim 1.0 0.500000 vertex = = texture -1 material =
+-1
+= -1 = frame frame material 1.0 =
+1.0 frame vertex = frame anim
+texture 0.500000 1.0 =
+frame
+bone 1.0 anim bone = vertex vertex vertex bone texture 0.500000 = -1
+anim material
+0.500000 -1 frame frame texture
+0.500000 vertex anim frame 1.0 frame anim vertex material = anim 0.500000 1.0 material
+frame 1.0 bone material 1.0
+material
+0.500000 = vertex -1 1.0 = 1.0 anim
+0.500000 material
+-1 anim
+anim texture = 0.500000 =
+bone vertex -1
+material texture frame
+frame
+vertex material anim 1.0
+1.0 frame bone vertex 0.500000
+frame -1 1.0 frame = bone 0.500000 bone
+vertex vertex = -1 0.500000 -1 0.500000
+material -1 -1
+vertex
+1.0 -1 anim 1.0 1.0 0.500000 bone bone = = material frame
+texture = 1.0 anim
+anim bone
+0.500000 -1 material texture
+-1 vertex anim vertex 0.500000 = bone
+anim 1.0 texture material
+0.500000 texture frame material
+1.0 material frame -1 bone material = material vertex
+frame vertex = frame
+1.0
+texture texture frame anim 1.0 vertex 1.0 = 1.0
+texture 0.500000
+vertex 0.500000 vertex material
+anim anim bone = = material
+vertex =
+vertex
+-1 0.500000 0.500000 texture 1.0 material vertex = texture 0.500000 frame texture material anim bone = vertex 0.500000 -1 =
+bone
+= frame anim anim = frame 0.500000 0.500000
+bone vertex vertex material anim -1 bone
+texture material texture = 0.500000 material 0.500000 texture anim frame = anim texture 0.500000 -1
+= vertex texture
+1.0 material texture -1 frame texture material 1.0 material
+texture frame
+-1 = texture 1.0 material
+-1 1.0
+anim vertex
+0.500000 vertex = 1.0 anim 0.500000
+frame texture texture
+-1 0.500000
+texture
+bone texture = 0.500000
+frame -1 vertex 0.500000 bone
+0.500000 1.0
\ No newline at end of file
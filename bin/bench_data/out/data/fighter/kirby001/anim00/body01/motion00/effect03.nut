@@ -0,0 +1,44 @@
+0.500000 vertex
+0.500000 material material
+bone 1.0
+vertex
+material material texture 1.0 material
+material 0.500000
+bone -1
+-1 material bone =
+texture
+-1
+material bone bone anim anim
+= vertex -1
+= vertex 1.0 0.500000 frame
+-1 bone -1 frame frame frame frame
+1.0
+-1 material material 1.0 bone -1 vertex vertex -1
+0.500000
+material
+bone
+-1 texture vertex 1.0 material
+1.0
+texture frame = 1.0
+1.0 -1
+1.0 texture = 1.0 = vertex
+-1 1.0
+-1 = -1
+frame
+material 1.0 texture 1.0 anim =
+texture texture vertex
+1.0
+1.0 -1 texture texture = material frame anim
+= -1
+-1 frame texture vertex
+anim
+vertex -1 material
+frame -1 bone 1.0 vertex = material vertex
+anim = 1.0 vertex bone
+bone anim texture 1.0
+anim bone vertex texture 0.500000 0.500000 0.500000
+material bone
+0.500000 bone
+frame frame bone 0.500000 anim
+anim
+0.500000
\ No newline at end of file
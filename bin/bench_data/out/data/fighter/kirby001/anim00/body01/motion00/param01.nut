@@ -0,0 +1 @@
+T9Q	X9a7oYx8;;r
\ No newline at end of file
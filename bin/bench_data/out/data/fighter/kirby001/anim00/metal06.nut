@@ -0,0 +1 @@
+e8r-TTq*J훃ל`܅$WԨ\m;PJRvJ!3]nG$Af cSj6r5ƆϢKd6ir"wx%`|Gi[
\ No newline at end of file
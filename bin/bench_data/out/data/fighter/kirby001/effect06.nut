@@ -0,0 +1,29 @@
+1.0 frame -1 vertex anim bone bone = material material bone texture material bone -1 -1 0.500000
+texture
+= 0.500000 anim bone frame texture texture anim = -1 texture -1 vertex vertex
+bone 0.500000 frame = texture
+= vertex = 1.0 texture 1.0 frame bone anim bone
+0.500000 anim 0.500000 vertex
+1.0
+0.500000 frame texture bone texture
+frame 0.500000
+vertex material 0.500000
+frame 1.0 frame texture
+= material anim
+=
+-1 material
+0.500000
+anim anim
+vertex = material = 0.500000 bone = =
+= 0.500000 0.500000 material material vertex anim bone -1
+1.0 material -1 -1 =
+=
+material bone texture vertex 0.500000 = anim 1.0 material anim
+0.500000 texture anim 0.500000 frame material = = 0.500000 = -1 texture
+= 0.500000 -1 bone
+-1 0.500000 0.500000 1.0 texture
+bone material
+1.0 frame
+anim material = = 0.500000 frame
+frame
+textu
\ No newline at end of file
@@ -0,0 +1,307 @@
+1.0 -1 material -1 -1 0.500000
+bone bone
+0.500000 texture = anim frame = -1 texture frame
+bone bone 1.0 1.0 = anim frame 0.500000
+bone texture -1
+0.500000 -1 =
+= = material material
+anim
+0.500000
+texture
+texture
+0.500000
+-1 -1 frame -1 bone material vertex vertex bone material = vertex 0.500000 anim bone
+-1 anim anim frame material 1.0 anim 1.0 material
+bone
+anim material
+vertex -1
+bone anim anim
+bone vertex anim
+0.500000 bone
+anim
+0.500000 material material
+bone
+bone
+material
+texture = bone
+vertex
+1.0 anim anim texture =
+texture -1 vertex -1 texture anim = -1
+= texture frame texture
+vertex
+texture frame frame 0.500000 1.0
+texture frame material frame
+-1
+anim texture
+= 0.500000 vertex -1 = bone material bone vertex bone texture 1.0 0.500000 = 1.0 -1 bone anim 1.0 -1 = -1 anim 1.0 anim 0.500000
+texture = frame 1.0 anim material = material vertex -1 -1
+0.500000 texture vertex bone
+material texture material frame texture 0.500000 1.0
+texture bone
+vertex vertex anim vertex
+anim
+material vertex 0.500000 1.0
+1.0 material 1.0 frame frame bone 0.500000 material vertex
+vertex bone texture
+texture material anim anim anim frame
+= 1.0 texture frame
+texture
+frame vertex
+vertex bone
+0.500000 -1 1.0 1.0
+texture
+0.500000 material anim frame 1.0 0.500000
+vertex
+vertex texture frame bone -1 = frame
+texture frame
+anim 1.0 -1
+frame 0.500000
+-1 1.0
+0.500000
+anim anim
+material = texture
+-1 frame material = 1.0 texture
+1.0 -1 material = material texture 1.0 vertex vertex material anim anim = 0.500000 =
+1.0
+frame anim = 1.0 vertex frame =
+0.500000 0.500000 texture
+-1 anim bone = -1
+1.0 -1 texture
+0.500000 texture -1 0.500000 =
+vertex
+frame frame bone anim 1.0 0.500000 = texture 1.0
+anim vertex vertex texture anim
+vertex material bone
+-1
+1.0
+= anim frame 0.500000 frame
+anim
+material texture
+vertex frame
+material -1 anim vertex = = anim
+0.500000 bone anim 1.0 bone 1.0 1.0 = frame = texture =
+0.500000 frame
+vertex texture frame -1 0.500000 -1
+anim bone vertex bone bone
+frame material 0.500000
+material frame material =
+0.500000 = frame vertex
+=
+vertex 0.500000 vertex frame 1.0
+vertex
+bone 1.0 = vertex
+bone frame vertex
+= texture anim
+vertex anim 1.0
+bone 0.500000 frame material anim 0.500000
+0.500000 1.0
+1.0 anim vertex -1 frame frame 0.500000
+frame vertex
+0.500000 = 1.0 frame -1 = material 1.0 -1 -1 -1
+-1 0.500000 texture 1.0
+anim -1 vertex
+texture anim 1.0 frame material -1 0.500000 texture
+-1
+frame
+texture texture material
+= texture
+frame frame = = anim 0.500000 vertex frame -1 -1 1.0
+vertex -1 texture 1.0 material vertex texture -1
+anim anim texture
+vertex -1 0.500000
+bone frame anim
+1.0 anim -1 frame
+frame anim 0.500000 bone vertex frame -1 anim = -1
+vertex vertex vertex = = vertex texture vertex 1.0
+vertex bone bone
+0.500000 frame bone
+0.500000 texture
+= bone anim -1 1.0
+vertex = -1 -1 bone
+-1 texture bone = anim
+anim -1 0.500000
+1.0
+= 1.0 -1
+0.500000 vertex
+bone material -1 =
+bone vertex frame vertex
+vertex -1 1.0 = texture = 0.500000 -1 1.0 1.0 0.500000 vertex vertex material = texture bone
+vertex 0.500000 anim = frame
+bone 1.0 material material
+bone -1 -1 1.0 =
+anim
+vertex anim
+anim
+anim 1.0 texture 0.500000 =
+bone
+= bone
+=
+=
+bone texture
+1.0 material texture = 1.0 texture -1
+0.500000
+1.0 = 1.0 =
+bone anim
+anim material frame frame material 1.0 =
+0.500000 frame material = 0.500000 -1 anim
+anim 0.500000
+frame
+texture frame 1.0
+anim
+vertex = frame
+1.0
+bone 1.0 vertex
+0.500000
+1.0
+=
+texture bone
+material vertex
+0.500000 anim texture
+vertex =
+material texture material
+1.0 -1 material = bone material anim bone bone anim
+= material 1.0
+material anim
+vertex frame 1.0
+texture -1 texture frame
+bone 1.0 1.0 texture
+frame material
+= -1 vertex
+vertex -1 material 0.500000
+anim bone -1
+frame texture 1.0 frame texture bone bone material 1.0
+texture anim 1.0 bone 1.0 texture vertex
+1.0 material
+anim vertex texture material frame texture frame 1.0
+= material bone
+texture
+bone
+=
+frame vertex =
+-1 = =
+-1 material texture vertex
+material = 0.500000 vertex 1.0
+vertex
+bone anim
+=
+frame vertex anim texture material = material
+material -1 1.0
+anim 1.0
+material frame vertex = 0.500000 vertex texture material 1.0 texture 0.500000
+vertex
+0.500000 0.500000
+= -1
+vertex vertex anim texture
+material = vertex
+texture -1 anim
+0.500000
+0.500000 bone
+texture
+vertex = texture
+material material -1
+anim 0.500000
+-1 bone 1.0 texture 0.500000 texture
+1.0 bone frame -1 material material texture
+=
+= anim bone material bone
+frame
+-1 -1
+frame
+vertex
+anim
+0.500000 frame bone -1 1.0 vertex
+bone 1.0
+= bone frame 1.0
+= = texture = bone
+anim 1.0 texture frame
+material =
+vertex anim texture
+anim texture -1 = anim texture texture texture 0.500000
+0.500000 material material frame frame 1.0 material vertex frame vertex vertex 0.500000 0.500000 material texture 1.0
+=
+material
+vertex 1.0 1.0 material 1.0 vertex
+texture material material texture
+vertex bone
+material texture material 1.0 -1 texture = 0.500000 texture 1.0 0.500000 frame material 1.0 -1 0.500000 0.500000 -1 anim
+vertex
+0.500000 bone
+texture 1.0 bone texture 0.500000 vertex material
+1.0 -1 -1 texture
+texture 0.500000
+1.0 = anim 0.500000
+= anim -1
+texture 1.0 0.500000 -1 texture -1 -1 = -1 material 0.500000
+-1
+anim frame = -1 -1 -1 =
+material
+vertex texture bone 0.500000 vertex = frame anim
+anim
+material 0.500000 1.0 texture
+1.0
+vertex
+frame
+material 1.0 1.0 frame
+texture -1 = =
+=
+1.0 =
+=
+bone bone texture
+vertex 1.0 bone -1
+frame
+1.0 1.0 bone
+bone vertex 1.0 = = anim
+material texture
+1.0 1.0
+vertex anim texture vertex material = anim texture =
+1.0 1.0 1.0 material -1 1.0 0.500000 texture texture 1.0 = 0.500000 bone anim
+1.0 bone
+vertex
+0.500000 0.500000 1.0
+-1
+vertex -1 vertex
+frame 0.500000 texture bone
+-1 anim anim
+= = bone 1.0 bone -1 texture anim
+anim -1 bone material bone 0.500000 material 1.0
+1.0 -1 material anim
+bone frame bone bone material anim
+texture vertex 1.0 -1
+frame = anim
+material 1.0 = -1 0.500000 frame
+frame vertex anim
+texture texture
+1.0 texture anim frame 1.0 material bone bone
+vertex =
+-1
+anim bone vertex frame frame -1
+bone frame
+bone material 0.500000 vertex texture texture anim = 0.500000 vertex
+1.0 1.0 material bone frame
+=
+0.500000 vertex anim
+anim
+anim anim 0.500000 texture anim -1 vertex
+vertex
+= texture =
+1.0 material
+material
+0.500000
+= frame texture = texture 0.500000
+vertex 1.0
+material = anim bone
+vertex
+0.500000 =
+0.500000 -1 0.500000 1.0 anim 1.0
+anim
+0.500000 material texture
+-1 texture texture material
+bone frame 1.0 texture
+0.500000 anim frame = texture
+-1 material
+texture = -1 texture
+0.500000
+0.500000 material bone material bone material 1.0
+texture texture 0.500000 material bone
+bone material
+0.500000 bone anim ver
\ No newline at end of file
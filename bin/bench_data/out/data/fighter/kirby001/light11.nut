@@ -0,0 +1,89 @@
+1.0
+bone =
+-1 texture material vertex = -1 vertex material anim vertex bone vertex 0.500000 = vertex -1 = texture texture 1.0 vertex texture
+material
+frame
+vertex
+= bone texture 1.0 bone
+anim
+0.500000 -1 -1
+vertex frame
+= 0.500000
+frame anim
+vertex -1
+material 0.500000 bone = 1.0 -1 vertex 1.0 0.500000
+material anim texture
+0.500000 material
+vertex anim material material
+material 1.0 vertex 0.500000
+0.500000 =
+bone anim
+frame
+anim anim
+bone frame anim material 0.500000
+bone
+frame 0.500000 = anim
+bone texture vertex
+-1
+frame frame
+frame
+material material vertex
+1.0 = texture
+-1 texture anim
+-1 material 0.500000
+-1 vertex bone
+material 1.0 vertex vertex
+1.0 frame texture material
+= 1.0 texture anim 0.500000 1.0
+1.0 -1 vertex -1 anim frame bone 1.0 anim material
+-1 1.0 vertex vertex frame material
+bone 1.0 1.0 anim anim material vertex
+texture material
+0.500000
+0.500000
+anim
+1.0 bone 0.500000 texture frame 1.0 texture
+1.0 bone texture
+=
+1.0 anim texture = -1 1.0 vertex 0.500000 0.500000 vertex -1
+-1 vertex
+0.500000 1.0 1.0 vertex texture vertex
+= 1.0 frame
+=
+=
+0.500000 bone = vertex vertex material = anim
+bone bone
+anim
+vertex
+vertex
+material anim bone anim material -1
+vertex
+frame material material vertex frame frame material
+1.0 anim frame frame bone bone anim
+vertex material anim 1.0
+bone
+frame frame bone anim 1.0 texture texture vertex material
+frame material bone bone vertex vertex -1 vertex
+-1 -1 bone =
+1.0 bone
+= anim 1.0
+material
+vertex
+frame 1.0
+texture frame bone
+1.0 0.500000 0.500000 frame bone vertex vertex -1 anim anim texture
+texture bone
+anim -1 bone
+bone 0.500000
+-1
+vertex material
+material material 1.0
+-1 texture = anim -1 texture frame frame vertex 0.500000
+anim bone -1 texture
+0.500000
+bone frame anim frame texture
+1.0 bone texture
+0.500000 -1 -1
+texture vertex 0.500000 material frame material 1.0 bone vertex texture
+material material 0.500000 anim material bone
+1.0 = bone 1.0 a
\ No newline at end of file
@@ -0,0 +1,70 @@
+anim
+texture
+texture anim bone texture -1 1.0
+-1 1.0
+frame
+-1
+= anim bone
+= anim material = anim frame
+-1 bone texture =
+1.0 1.0 frame 1.0 frame bone frame frame vertex 0.500000 material
+bone bone 0.500000 0.500000 material material frame
+1.0 texture
+frame material frame 0.500000 bone -1
+bone 0.500000 bone bone = bone
+=
+anim bone texture
+texture
+bone -1
+vertex 1.0 frame
+bone = texture -1
+1.0
+frame 1.0
+material 1.0 vertex material -1 frame frame -1 texture
+0.500000 texture
+anim material
+= material vertex material material bone texture
+-1 vertex material
+frame
+= vertex anim = anim anim 0.500000 bone anim anim -1 vertex -1
+= frame texture bone
+bone
+= 1.0 = material 0.500000
+material material anim material material -1 1.0 anim = -1 vertex
+frame material texture 0.500000
+frame material vertex frame
+bone bone
+frame bone = anim material frame
+0.500000
+vertex vertex vertex
+=
+vertex material
+-1 texture bone bone 1.0 anim
+frame anim -1 vertex frame = vertex = bone bone 1.0 -1 frame
+=
+material
+1.0 1.0 0.500000 bone
+frame
+frame
+material anim -1 frame bone material
+texture 1.0 anim material =
+anim
+=
+-1 vertex frame 0.500000
+=
+anim 0.500000 = frame 0.500000
+frame anim
+0.500000 vertex anim material texture 0.500000 material 1.0
+0.500000
+texture 0.500000 anim =
+anim texture
+-1 frame bone bone vertex -1 1.0 vertex vertex 0.500000 vertex = anim anim material frame
+vertex bone 1.0 =
+vertex
+material 1.0
+0.500000 vertex
+0.500000 0.500000
+1.0 texture bone material frame
+vertex
+bone vertex = texture frame 0.500000 texture bone
+anim frame texture anim textur
\ No newline at end of file
@@ -0,0 +1,210 @@
+1.0 frame material texture material 0.500000 = bone 1.0 =
+-1 material material bone frame texture = 0.500000 material
+1.0 material
+anim
+= -1 bone
+frame -1 0.500000 -1 frame 1.0 vertex
+vertex vertex frame texture frame 1.0 material 1.0 anim frame
+-1 1.0
+= vertex frame 0.500000
+vertex material 1.0 frame texture -1 =
+0.500000 anim -1 1.0 frame 0.500000 texture
+frame bone
+vertex frame anim
+anim material 0.500000 material bone bone
+= bone
+-1 texture anim
+frame -1 0.500000 -1
+frame =
+-1 -1 vertex anim
+= 1.0 vertex 1.0 = = 1.0 bone 0.500000 material 0.500000 = texture vertex bone
+texture -1
+anim bone frame frame 0.500000 material
+anim texture vertex anim 0.500000
+0.500000 0.500000
+frame =
+=
+frame -1 vertex material = 1.0 1.0 =
+material = 0.500000
+material vertex -1 =
+texture
+-1 vertex
+frame
+1.0
+0.500000 0.500000 texture 1.0 anim vertex = texture texture
+= bone
+material material vertex
+anim = = 1.0 1.0 =
+1.0 vertex -1 vertex 1.0
+material
+material
+0.500000 -1
+frame material anim anim texture
+1.0 vertex -1 bone -1 0.500000 vertex bone = 0.500000 0.500000 0.500000 frame = -1 =
+texture 1.0 frame
+bone texture = frame
+vertex 1.0 1.0 1.0 material
+frame
+-1
+anim material
+= material = 0.500000 0.500000 0.500000 0.500000 bone vertex
+0.500000 bone anim texture frame anim material 1.0 material 0.500000 0.500000 -1 =
+texture
+frame texture bone
+material -1
+-1 frame
+0.500000 = -1 anim 1.0 anim frame frame texture bone = texture 0.500000 anim 0.500000 frame anim = vertex material = frame 0.500000 frame bone
+vertex anim anim
+0.500000
+bone 0.500000 anim
+1.0
+material
+anim = anim vertex = 0.500000 anim frame = 1.0
+frame anim 1.0 vertex
+0.500000
+texture vertex
+1.0 bone
+material = = texture vertex frame
+0.500000 bone
+anim texture texture 1.0 1.0 = 0.500000
+vertex vertex anim frame -1 1.0
+bone anim 1.0 -1 vertex anim
+-1 material material bone texture anim anim
+anim
+anim -1
+1.0 0.500000 0.500000 material
+-1
+frame 0.500000 0.500000 0.500000 bone material bone bone
+anim
+bone
+frame texture 0.500000 bone vertex frame
+0.500000 bone
+texture
+bone 1.0
+1.0
+bone = material anim frame vertex frame 0.500000 material frame = texture bone vertex
+texture bone
+texture 1.0 frame frame
+1.0
+material bone 0.500000 anim 1.0 -1 texture anim texture =
+frame
+1.0 vertex frame vertex = frame 0.500000 bone = 1.0 bone vertex
+1.0
+= texture material texture frame material frame
+frame texture
+anim -1 0.500000 texture material
+-1 bone
+anim
+anim 0.500000 -1
+= = material frame material -1 = vertex
+1.0 = vertex
+0.500000 1.0 frame
+-1 material vertex
+bone frame = bone -1
+anim
+0.500000 texture anim 0.500000 bone = material frame bone material
+0.500000
+1.0
+frame
+material 0.500000 =
+= vertex bone vertex texture =
+texture
+vertex bone 1.0 vertex frame 0.500000
+texture 1.0
+bone = frame anim bone vertex
+0.500000 0.500000 frame 0.500000 -1
+0.500000 texture anim bone
+0.500000 1.0 texture
+1.0 bone -1 vertex
+= 1.0
+0.500000 texture anim 1.0 frame
+texture 1.0 1.0 0.500000 bone frame = material material
+-1
+bone frame
+material 1.0 0.500000 anim = frame anim texture anim
+frame bone
+=
+frame
+bone 1.0 0.500000
+vertex vertex material = anim
+vertex anim anim bone -1
+material
+material frame
+0.500000
+frame 1.0 material vertex anim
+bone vertex
+anim
+= vertex
+1.0
+= 1.0
+frame 0.500000 1.0 vertex
+material 0.500000 bone
+frame 0.500000 texture material frame
+vertex material
+vertex frame = = texture -1 1.0 bone bone =
+0.500000 anim texture bone -1 vertex vertex 0.500000
+vertex -1 0.500000 bone
+1.0 frame material -1
+anim
+texture
+-1
+= texture vertex 0.500000 texture frame
+vertex material 1.0 vertex material
+0.500000
+material
+frame
+anim
+frame -1 material =
+1.0 0.500000
+material -1
+vertex 0.500000
+bone 0.500000 frame = 0.500000 0.500000 = texture
+anim
+material 0.500000 frame = material texture 0.500000
+frame anim 0.500000 1.0 bone vertex 1.0
+frame
+= frame texture
+material texture material
+bone
+-1
+0.500000
+vertex anim frame bone anim material -1 = frame
+1.0 = vertex
+-1 anim
+0.500000
+vertex frame bone = anim bone vertex
+vertex vertex -1 = bone 0.500000 0.500000
+material material =
+1.0 1.0
+material texture 1.0 vertex -1 bone =
+0.500000 frame
+0.500000
+texture = material material
+texture texture 0.500000 material bone 0.500000 material
+0.500000 bone
+frame
+texture = texture bone
+bone
+texture 1.0
+-1 frame texture = material
+material
+=
+-1 0.500000 0.500000
+1.0
+-1 anim = vertex bone frame = texture frame
+anim anim = 1.0 anim 0.500000
+frame frame frame vertex bone material anim material frame
+bone
+1.0
+bone bone bone texture bone bone -1 1.0 texture
+frame 0.500000
+0.500000 = vertex anim -1 frame anim frame -1 bone 0.500000 vertex
+-1 texture -1 vertex
+=
+material -1 frame frame texture frame texture
+0.500000 anim
+bone vertex frame 0.500000 material frame =
+frame
+material = material =
+frame frame
+vertex 0.500000 -1 0.500000 vertex bone 1.0 material texture -1 frame 1.0 texture
@@ -0,0 +1,42 @@
+anim
+anim frame anim bone
+texture texture 1.0
+1.0 1.0
+0.500000 anim anim vertex anim =
+texture 0.500000 anim
+0.500000 bone
+material -1 frame material frame material
+anim = frame
+frame
+-1 anim bone texture
+-1 1.0 frame anim texture 0.500000
+0.500000 texture -1 1.0 frame = 1.0
+material frame -1 -1 bone
+material 1.0 frame
+bone frame material vertex 0.500000 -1 material frame texture
+-1 material
+vertex 1.0 1.0 0.500000
+texture bone = 0.500000
+frame
+bone anim anim 1.0 material
+= texture texture material material = material bone texture frame 1.0 frame
+vertex
+anim -1
+material bone material
+1.0
+= material -1
+texture vertex
+vertex -1
+frame frame frame
+frame
+frame 0.500000 1.0 0.500000 vertex vertex
+material texture anim = frame 0.500000
+= 0.500000 anim bone
+= frame
+bone material
+material frame texture 1.0
+= vertex vertex vertex 0.500000 anim material bone = texture frame
+material frame
+1.0 texture
+frame 1.0
+anim 0.500000 -1 material anim = anim texture 0.500000 
\ No newline at end of file
@@ -0,0 +1,257 @@
+=
+anim texture -1 texture material frame vertex anim anim anim 0.500000
+bone
+-1 1.0 = = anim 1.0 0.500000
+1.0 vertex bone frame anim 1.0
+bone =
+anim material frame
+1.0 1.0
+bone 0.500000 texture
+0.500000
+1.0 vertex = texture
+1.0 anim anim -1 1.0
+-1 -1 material 0.500000 -1 texture 0.500000 vertex 0.500000 -1
+frame
+-1
+-1 1.0 anim
+texture material texture anim anim 0.500000 frame
+bone
+0.500000
+-1 material
+texture vertex 1.0 frame bone bone
+vertex -1
+= material frame texture
+-1 material material material vertex -1 material vertex 0.500000
+= 0.500000 =
+vertex bone texture bone
+frame 1.0 bone
+vertex bone
+texture frame
+-1
+texture -1 material -1 1.0 frame
+material 1.0
+0.500000 =
+1.0 1.0 anim = =
+frame frame -1 0.500000 anim material
+0.500000 anim -1 frame = frame 0.500000 1.0 -1 texture 0.500000 bone 1.0 -1
+bone
+vertex vertex frame texture anim material anim
+0.500000 anim vertex vertex
+vertex material bone
+1.0 frame
+frame frame
+frame 1.0 1.0 = anim 0.500000
+bone
+anim
+-1 = -1 texture
+bone material -1 1.0
+0.500000
+texture frame 0.500000 1.0 1.0 vertex vertex bone = 1.0 vertex
+texture 1.0 -1 material
+anim 0.500000 -1 anim anim frame -1
+frame anim anim texture 0.500000 anim material 1.0 frame = anim
+texture
+bone anim frame bone
+vertex 1.0 -1 1.0 texture bone texture 1.0 texture
+texture -1 frame -1 = material texture anim = 0.500000 0.500000 1.0 texture bone 1.0
+texture 0.500000
+0.500000 1.0
+bone
+material texture bone
+-1 1.0
+material material frame = frame texture vertex
+material anim
+vertex vertex = 1.0 texture texture 1.0 texture
+1.0 vertex anim 0.500000 texture
+-1
+-1 0.500000 frame material anim
+-1 frame texture vertex 0.500000 = frame 1.0 =
+material frame 1.0
+bone material
+material -1 vertex = -1
+anim 0.500000 anim frame frame frame = vertex -1
+frame anim
+-1 1.0 texture -1 1.0 1.0
+texture frame texture
+frame -1
+material =
+vertex -1 1.0 bone -1 1.0 bone =
+texture
+vertex bone -1
+= anim -1 0.500000 vertex material 0.500000
+frame
+anim bone vertex vertex -1
+= 1.0 material vertex
+material -1 frame = bone 0.500000
+1.0 frame 0.500000
+-1 1.0 bone vertex texture
+bone bone 0.500000 anim
+vertex -1 0.500000 1.0
+-1 1.0
+= anim bone anim bone frame -1 0.500000 anim
+-1
+0.500000 = frame
+texture bone
+0.500000 texture bone anim 0.500000
+material
+=
+texture texture 1.0 0.500000 vertex anim = anim
+material 0.500000 frame texture vertex
+vertex
+anim material
+bone
+texture texture material
+0.500000 0.500000 bone vertex =
+bone = material 1.0
+vertex -1 bone
+-1
+bone
+material texture texture = 0.500000 0.500000 0.500000
+=
+=
+1.0 = bone 1.0 0.500000 1.0 vertex 1.0 frame anim
+frame = anim
+frame frame 0.500000
+frame anim vertex material = bone
+0.500000 1.0
+-1 1.0 1.0 -1 anim 0.500000
+material 0.500000
+=
+1.0 0.500000 = vertex material = material texture frame anim 1.0 anim -1 frame = 1.0 texture =
+texture material
+texture anim bone anim bone
+vertex 0.500000 material texture vertex vertex -1 = 0.500000 texture vertex anim anim vertex 0.500000
+= vertex
+frame
+frame
+material vertex 1.0 frame 0.500000 texture vertex = bone
+= bone frame frame frame
+texture
+1.0 bone -1 = vertex
+1.0
+material texture material frame vertex
+= 1.0 = bone anim anim anim vertex material material
+texture
+texture
+material = bone anim -1 anim
+-1 -1 -1 -1 = 1.0 bone
+1.0 texture
+material texture
+material vertex texture 0.500000 0.500000 -1
+bone = anim frame = frame -1
+texture = =
+= anim
+material anim
+vertex
+texture
+frame material frame 1.0
+0.500000 anim frame 1.0
+= 0.500000 frame = frame
+0.500000 texture -1
+=
+frame 1.0 1.0 texture bone 0.500000 material
+0.500000
+1.0 anim bone -1 bone -1
+-1 texture 1.0
+texture material vertex vertex frame anim
+frame frame
+= vertex anim anim
+1.0 bone anim frame material vertex
+-1 texture
+bone bone bone
+texture -1
+vertex
+material anim
+bone -1 vertex frame
+0.500000 0.500000 -1 bone texture vertex
+1.0 anim
+material 0.500000 vertex anim vertex texture texture bone material frame 0.500000 1.0 anim anim
+material 0.500000
+-1 bone =
+vertex vertex vertex frame 0.500000 =
+material
+anim 1.0
+1.0
+0.500000 texture bone 0.500000 -1 bone frame frame bone bone
+material material material 1.0 vertex
+1.0 texture = 1.0 -1
+texture
+= anim
+0.500000 frame vertex 1.0 bone material
+texture
+= texture
+-1
+= frame 0.500000 vertex
+texture 0.500000 anim -1 frame frame -1
+material bone texture 0.500000 0.500000 frame material bone -1 frame
+1.0
+1.0 texture
+1.0 = anim frame 0.500000 frame =
+texture = = -1
+material anim -1 material
+-1 = -1 = vertex 0.500000
+anim frame
+bone frame frame
+-1 = vertex
+1.0 = 0.500000
+-1
+bone
+vertex material
+frame vertex bone texture bone anim
+texture bone 1.0 1.0
+1.0 0.500000 frame bone texture vertex texture 0.500000 frame frame material 0.500000 material
+vertex 1.0 = anim vertex
+frame = = bone
+bone
+frame = 1.0 anim 0.500000
+material bone
+texture
+-1 frame frame vertex 1.0 material
+vertex 0.500000 material
+material 1.0
+anim -1 = 1.0
+anim vertex 0.500000 0.500000
+= vertex 1.0
+= 0.500000 0.500000 material
+frame
+-1 vertex 0.500000 = bone = -1 = frame = material bone material 1.0 material anim -1
+material = anim anim
+0.500000
+texture
+vertex
+bone bone 1.0 bone
+material material bone
+texture = texture -1 0.500000 -1 vertex
+-1 -1 bone
+1.0 texture -1 vertex
+material -1 vertex 1.0 0.500000 1.0 anim
+texture
+= frame =
+anim 1.0 =
+frame
+material
+= = frame = material frame texture
+0.500000 1.0
+texture vertex bone material texture texture material
+anim =
+vertex texture texture
+anim texture
+1.0
+vertex = bone 0.500000
+= = texture
+anim texture vertex vertex material bone anim bone
+bone anim vertex texture 0.500000 -1 0.500000 1.0 1.0 frame
+=
+-1 frame bone
+anim vertex -1
+vertex =
+-1 texture vertex 0.500000 material bone 0.500000 frame
+1.0 =
+-1 0.500000 -1 texture texture frame frame
+vertex texture
+texture vertex 1.0 1.0 material material material = =
+= material frame anim 1.0 vertex
+= 0.500000 0.500000
+vertex bone -1 bone 1.0 anim frame
+anim
+frame anim bone = bon
\ No newline at end of file
@@ -0,0 +1,18 @@
+= bone vertex frame
+frame
+material texture vertex 1.0 anim -1 = 0.500000
+vertex
+0.500000
+=
+1.0 material bone -1
+bone texture 0.500000 frame
+material
+= 1.0 -1 0.500000 =
+frame material material
+material bone 0.500000
+vertex
+bone texture
+anim material = = vertex vertex
+frame vertex
+material bone =
+0.500000 1.
\ No newline at end of file
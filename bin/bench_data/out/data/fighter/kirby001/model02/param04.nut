@@ -0,0 +1,134 @@
+1.0 -1
+frame -1 1.0
+vertex
+bone
+-1
+frame = = 0.500000
+vertex frame
+-1 1.0 0.500000
+-1 material frame 0.500000
+vertex 0.500000 frame anim
+texture
+= 0.500000 frame bone bone
+= 0.500000
+anim material texture bone =
+vertex material 0.500000 =
+frame 0.500000 texture 0.500000 vertex frame frame bone frame
+0.500000
+= 1.0
+1.0
+bone -1 = =
+frame frame
+material vertex material 1.0 material bone -1
+=
+texture
+= 0.500000 1.0 1.0 bone anim 0.500000 -1 =
+material
+vertex
+vertex frame -1 1.0 0.500000
+0.500000 1.0
+-1 -1 =
+1.0 -1 -1 0.500000
+bone 0.500000 bone anim -1
+1.0 bone -1 material
+frame material frame -1 -1 1.0 texture 1.0 -1 material
+frame 1.0 vertex
+frame 1.0 frame 1.0 -1 vertex vertex material texture anim -1 vertex
+-1 bone frame
+texture 1.0 bone
+1.0 -1 frame
+anim 0.500000 = frame bone
+1.0 -1 frame vertex
+material = 0.500000 vertex vertex vertex vertex bone
+anim vertex bone anim vertex
+= material 1.0 bone 1.0
+material vertex
+1.0
+anim -1 anim material
+= texture
+anim frame anim 1.0 material frame 1.0 0.500000 vertex 0.500000 texture -1 material bone
+1.0 anim
+material frame anim
+material material bone -1 texture frame -1 vertex
+bone material = anim vertex = bone
+material material -1 -1 -1
+vertex
+bone
+anim 0.500000 frame frame
+anim
+material
+0.500000 material
+frame
+frame vertex material material -1 0.500000 material material vertex vertex
+vertex 1.0 = 0.500000 -1 frame bone
+texture vertex frame =
+-1 1.0 0.500000 frame
+0.500000
+texture
+1.0 1.0 0.500000 1.0 texture anim
+0.500000 -1
+0.500000 bone bone 0.500000 1.0 texture
+texture =
+1.0 0.500000 bone 1.0 texture
+vertex = frame
+frame
+= -1 bone bone bone anim anim
+anim
+material material = 0.500000 texture frame texture =
+material vertex = frame anim bone material
+-1 =
+material
+anim vertex frame texture texture
+-1 anim texture texture -1
+frame -1 texture texture -1 0.500000 = frame 0.500000 material texture -1 frame anim
+texture material -1 vertex
+anim vertex texture anim
+1.0 1.0
+texture -1
+1.0 -1 anim anim 0.500000
+bone texture
+1.0
+=
+0.500000 anim texture anim
+bone 0.500000 anim
+frame material
+bone 0.500000 texture vertex frame texture 1.0 material 1.0
+frame 0.500000 material anim -1
+1.0 1.0
+0.500000 material anim
+vertex
+bone texture frame bone 1.0
+material texture vertex = texture texture -1 frame 0.500000 bone bone 0.500000 bone anim 0.500000 texture frame bone
+anim
+vertex 1.0
+vertex = 0.500000 frame
+vertex 1.0
+anim anim
+1.0 vertex 1.0 texture
+material frame -1 texture vertex
+anim 1.0
+vertex frame
+material material 0.500000 texture material -1 material texture
+0.500000 -1
+anim
+0.500000 frame anim
+frame 0.500000
+0.500000
+-1 frame material 0.500000 anim
+frame -1 material vertex
+-1 texture -1 frame frame 0.500000 texture material
+texture 1.0 1.0
+bone material frame
+0.500000 vertex
+anim texture 1.0 frame anim material 0.500000 anim anim
+-1 texture
+bone material 1.0
+anim
+-1 0.500000 anim 1.0 1.0 -1 1.0
+anim
+=
+bone
+vertex
+vertex frame vertex vertex material -1
+1.0 -1 anim bone vertex 1.0 = bone bone material =
+= material frame
\ No newline at end of file
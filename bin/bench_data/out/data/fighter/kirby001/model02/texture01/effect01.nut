@@ -0,0 +1,8 @@
+material vertex
+vertex -1 texture vertex texture 0.500000 anim bone anim -1 material
+-1 anim bone 1.0
+frame = bone -1 anim
+=
+anim vertex material
+texture texture 0.500000 1.0 vertex
+1.0 ver
\ No newline at end of file
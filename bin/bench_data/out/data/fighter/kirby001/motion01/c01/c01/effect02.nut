@@ -0,0 +1,105 @@
+frame texture
+1.0 -1 bone
+vertex bone bone vertex =
+0.500000 vertex -1 texture bone -1 bone
+anim frame
+0.500000 anim
+anim 0.500000 0.500000 texture anim bone 1.0 frame anim vertex -1 0.500000
+0.500000 material -1
+anim anim texture frame
+vertex texture texture vertex frame anim 0.500000 texture anim vertex vertex material 0.500000 vertex anim vertex
+= bone =
+vertex texture
+material 1.0
+frame
+-1 bone
+material frame frame bone = 1.0
+bone -1 -1
+anim
+=
+0.500000 texture -1 bone vertex
+frame
+vertex -1
+material material texture
+bone bone 1.0 0.500000
+-1 material
+frame -1 1.0 0.500000
+1.0
+1.0 bone 1.0 frame vertex texture frame
+material vertex anim
+= texture -1 frame 1.0 frame -1 0.500000
+1.0 anim vertex
+vertex bone 1.0
+0.500000 0.500000
+vertex 0.500000 anim texture anim material
+= anim texture
+-1 =
+0.500000 anim -1
+anim texture -1 = texture
+0.500000
+1.0 1.0 vertex texture 1.0
+1.0 frame frame 1.0 0.500000 0.500000 bone
+1.0
+frame 1.0 anim frame
+texture -1 bone
+1.0 texture
+-1 = 0.500000 material frame
+bone = bone frame
+1.0 vertex 1.0 1.0
+-1 texture -1 bone material vertex 0.500000 1.0 0.500000 =
+bone anim 0.500000 anim texture bone 1.0 0.500000 bone bone = texture bone texture material material bone vertex anim texture
+=
+1.0 -1 0.500000 texture
+0.500000 -1 vertex anim
+-1
+anim -1 vertex anim texture vertex texture -1
+anim = 1.0
+frame -1 bone anim 0.500000 = 0.500000 1.0 0.500000 material vertex -1 1.0
+frame texture 0.500000
+material bone texture texture material
+1.0 texture -1
+= material bone 0.500000 bone texture
+anim 0.500000 material 0.500000
+-1
+bone
+vertex -1 texture bone bone material frame frame vertex -1 vertex bone 1.0 -1
+material anim anim material material material frame 0.500000 -1 bone 0.500000
+anim 1.0
+= frame
+frame texture
+vertex
+-1 vertex bone
+frame bone bone
+-1
+1.0 1.0
+= bone 1.0 bone anim texture
+vertex 0.500000 material
+0.500000
+0.500000 0.500000
+vertex = 0.500000 anim 0.500000 vertex frame
+anim
+= texture bone frame texture vertex bone
+material 1.0 material
+texture
+-1 texture
+texture vertex 1.0 1.0 0.500000 = =
+vertex = = texture
+frame
+texture vertex bone 0.500000 material 0.500000 =
+0.500000 frame bone anim
+=
+vertex frame
+= anim bone 1.0 bone frame
+bone material 1.0
+frame bone material
+frame
+anim bone
+0.500000 1.0 anim
+vertex 0.500000 0.500000 bone -1 texture vertex texture vertex texture bone 0.500000 material vertex 1.0
+vertex texture frame material = bone material bone frame frame = vertex bone 0.500000 1.0 vertex frame -1 anim bone -1 -1 =
+vertex material 1.0 = bone
+0.500000
+frame frame 1.0 bone
+= =
+material texture vertex frame bone anim -1 = frame
+-1 -1 frame 1.0
@@ -0,0 +1,15 @@
+= =
+bone frame = = vertex 0.500000
+material frame vertex 0.500000 vertex bone texture
+vertex frame vertex bone
+bone 0.500000 frame texture texture
+-1
+1.0 0.500000 1.0
+texture = texture
+frame 1.0 texture
+texture material frame -1
+vertex = 1.0 texture -1 -1 0.500000 = frame 0.500000 = bone bone 0.500000 anim
+frame -1 texture -1 0.500000 bone texture material = vertex bone bone = material
+material material -1 texture
+frame
+material ve
\ No newline at end of file
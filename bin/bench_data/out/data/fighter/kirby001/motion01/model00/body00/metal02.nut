@@ -0,0 +1,9 @@
+texture 1.0 bone = bone 1.0 bone bone
+-1 -1 -1 -1 texture
+vertex bone
+vertex
+0.500000 = anim =
+vertex
+1.0 0.500000 1.0 0.500000
+0.500000 0.500000 texture vertex
+1.0 bone 
\ No newline at end of file
@@ -0,0 +1,100 @@
+anim material 0.500000 frame
+1.0 1.0 texture frame anim
+-1 anim vertex vertex
+vertex material vertex 1.0
+anim texture =
+0.500000
+= 1.0 0.500000 bone anim anim =
+frame frame anim
+-1 = anim texture frame bone 0.500000 vertex texture bone = =
+texture vertex material
+=
+0.500000
+anim 1.0 frame 1.0 anim 0.500000 1.0 bone material
+frame = texture bone vertex = -1
+bone
+vertex
+texture material
+frame texture anim frame
+bone texture material = bone frame 0.500000 texture
+frame material -1 anim material anim vertex 0.500000 bone 1.0
+material =
+1.0
+anim material -1
+-1 vertex bone vertex texture = frame bone frame frame 1.0 vertex material material -1 vertex
+-1 texture
+material
+1.0
+=
+1.0 material bone frame -1
+1.0 bone
+material = anim
+material 1.0 -1
+frame frame material material
+vertex
+-1
+1.0
+1.0 bone 0.500000 frame frame = frame
+vertex -1 -1 texture 1.0 0.500000 vertex 0.500000
+vertex 0.500000 1.0
+material 1.0 =
+= 0.500000 =
+frame -1 anim texture anim
+0.500000
+anim bone
+frame -1
+vertex material vertex bone vertex texture bone
+texture texture vertex 1.0
+vertex 1.0
+texture
+bone 0.500000 frame anim 0.500000
+frame anim bone
+1.0
+anim frame
+material
+=
+-1
+material = 0.500000 texture
+texture 0.500000 =
+-1 bone = vertex -1
+material anim material texture
+texture vertex
+0.500000 0.500000 1.0 0.500000
+texture
+anim 0.500000
+0.500000 vertex
+1.0 1.0
+-1
+1.0 =
+vertex texture -1 texture 0.500000 vertex =
+material vertex = bone
+= -1 material bone
+frame material
+= 1.0
+material material
+material
+anim
+bone
+material
+anim material frame =
+0.500000 bone
+1.0 -1 material material = vertex -1
+vertex
+anim 0.500000 texture
+= texture 1.0 anim frame frame 0.500000
+bone -1 = frame
+texture
+frame
+0.500000 bone
+-1 1.0 anim
+= texture
+bone anim -1 0.500000 frame texture -1
+= material
+= frame
+= -1 -1 vertex bone 1.0
+0.500000 texture texture bone 0.500000 frame =
+-1
+-1 anim anim 0.500000 0.500000
+frame 0.500000
+material
+frame anim material mat
\ No newline at end of file
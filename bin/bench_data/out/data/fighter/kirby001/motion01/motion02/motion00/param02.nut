@@ -0,0 +1,291 @@
+anim material bone anim =
+anim 1.0
+-1 -1
+-1 texture
+anim = vertex = frame material 0.500000 1.0 bone = anim 0.500000
+anim = bone 1.0 vertex
+anim bone bone
+-1 bone frame 1.0 vertex frame
+-1 0.500000 material
+material 1.0 0.500000 1.0 vertex texture bone -1 frame -1 texture material material frame
+bone
+material
+frame
+=
+anim frame
+frame frame
+texture texture material 0.500000 bone 0.500000 frame anim
+material 0.500000 vertex
+1.0
+bone
+texture texture
+texture 0.500000 0.500000 -1
+=
+material vertex bone 1.0 bone frame 1.0 frame 1.0
+vertex 0.500000 anim frame material
+-1
+frame texture bone = vertex material bone
+-1 frame
+texture 0.500000 texture material vertex -1 vertex
+vertex 0.500000
+material material 1.0 anim
+bone = anim frame
+vertex
+bone -1 material anim
+vertex anim frame frame 1.0
+0.500000 material frame texture
+material 0.500000 vertex vertex texture frame frame 0.500000
+-1
+=
+vertex 0.500000 -1 0.500000 1.0
+1.0 -1 -1
+anim vertex material 0.500000 bone -1 bone -1 1.0 =
+anim frame anim 0.500000 0.500000 anim vertex
+frame -1 vertex
+= material
+0.500000 anim
+vertex 0.500000 material frame 0.500000 frame material texture anim bone vertex
+vertex
+=
+frame = bone 0.500000
+0.500000 texture bone frame bone 1.0
+0.500000 frame
+vertex material
+anim 0.500000
+= bone anim frame -1 vertex frame -1 material
+0.500000
+0.500000
+vertex texture texture bone
+1.0
+texture -1 0.500000 texture 0.500000
+-1 material bone
+1.0
+1.0 -1 -1 texture
+= anim
+-1 material -1 -1 frame vertex texture
+anim vertex bone
+bone anim 0.500000 vertex -1 vertex vertex material bone material texture material 0.500000 -1
+anim
+anim = 0.500000
+texture
+vertex 1.0
+bone
+material
+frame 0.500000 vertex -1
+bone material = texture material anim frame texture 1.0 0.500000 material texture material material
+material
+bone
+frame frame
+vertex anim material 1.0
+material material material
+texture vertex
+=
+= vertex anim =
+frame 0.500000 -1 anim -1 0.500000 frame = 0.500000 anim -1 1.0 material 1.0 1.0 -1 -1 1.0
+bone vertex -1 bone -1 anim vertex bone
+anim anim 1.0 frame 0.500000
+-1
+1.0 0.500000
+-1 texture
+vertex 0.500000
+0.500000 texture bone material 1.0 0.500000
+0.500000
+texture
+bone texture frame
+1.0 1.0 -1 0.500000 bone anim 1.0
+frame -1 anim = -1 material 1.0
+bone anim frame
+0.500000 vertex
+anim material anim 1.0 anim
+material 0.500000 -1 texture frame 1.0 texture
+texture texture texture -1
+anim vertex vertex vertex
+-1 1.0 = 0.500000 texture bone bone 0.500000
+anim
+0.500000 bone bone
+-1
+vertex vertex frame frame anim
+frame 1.0 texture texture -1 anim material 0.500000 frame 0.500000 frame material bone frame
+0.500000
+material frame
+anim -1
+anim
+material texture
+bone = anim =
+-1 -1 1.0 frame
+material 1.0
+anim texture 1.0 texture 0.500000 material frame
+-1 material = texture 0.500000 vertex
+0.500000 0.500000 material
+anim anim vertex
+anim
+0.500000 0.500000 texture = bone bone bone 1.0 anim material
+0.500000 1.0 bone
+= = texture -1 vertex vertex 0.500000 vertex material 1.0 material
+anim -1
+-1
+= vertex texture frame
+vertex material bone
+= 1.0 =
+anim
+vertex -1 frame 0.500000 material vertex texture texture 0.500000 bone material bone bone -1
+1.0 frame frame
+1.0 material 0.500000 anim -1
+frame 0.500000
+texture 0.500000 -1
+frame
+bone
+frame 0.500000 1.0 anim vertex texture -1 0.500000 anim vertex
+-1 texture
+texture
+bone
+material 0.500000 1.0 anim 0.500000 0.500000 -1 frame vertex -1
+anim
+texture texture = material 0.500000 vertex 0.500000
+1.0
+-1 = = = vertex anim 0.500000 frame = anim
+texture frame
+vertex -1 = frame anim vertex frame
+1.0 =
+vertex
+bone 0.500000
+frame
+vertex
+bone 0.500000
+0.500000 0.500000 texture anim
+=
+frame
+anim frame anim vertex bone vertex texture 0.500000 1.0 = 1.0 bone -1 1.0
+-1 frame
+vertex texture -1
+vertex -1 texture
+-1 vertex
+-1
+texture 0.500000 texture 0.500000 = material = = = -1 0.500000 vertex
+material
+bone vertex bone bone
+vertex bone = frame frame
+texture bone
+material
+0.500000 0.500000 1.0 anim anim
+-1 1.0 1.0 1.0 = 1.0
+vertex material -1 1.0 0.500000 bone bone vertex
+frame
+frame 1.0
+= bone vertex material 1.0 -1 1.0 texture
+vertex = 0.500000 1.0 vertex 0.500000 texture vertex 1.0 0.500000
+0.500000
+-1 =
+vertex texture =
+anim bone 0.500000 0.500000 material = frame
+vertex material anim
+bone vertex frame texture frame anim
+1.0
+vertex bone vertex anim anim anim vertex 1.0 frame
+texture 0.500000
+-1 = material
+texture frame = = -1 bone frame
+material frame vertex material
+0.500000 -1 =
+vertex bone material texture texture vertex = =
+0.500000 -1
+anim
+anim 0.500000 frame material
+frame material -1
+bone texture
+0.500000 vertex bone vertex bone
+bone 1.0 -1 bone vertex vertex 1.0
+=
+anim
+=
+0.500000 1.0 =
+0.500000 -1 =
+anim frame 0.500000
+0.500000 -1
+texture 1.0 texture = vertex vertex -1 -1 bone texture = -1
+1.0 -1 vertex = = 0.500000 anim = frame = = vertex
+vertex vertex texture vertex 0.500000 1.0 1.0 0.500000
+-1 frame 0.500000 bone material
+0.500000 = 1.0
+anim anim anim =
+anim anim = anim
+anim = = = texture material -1
+frame = anim bone texture = 1.0
+0.500000 frame
+= -1 1.0 = = = 1.0
+-1 anim texture bone 1.0 material
+texture
+anim frame vertex texture -1
+frame -1 0.500000 -1 1.0 vertex bone
+= = 1.0
+texture vertex material -1 vertex -1
+bone
+frame texture material frame frame anim frame frame vertex bone
+texture
+anim 1.0
+bone material = 1.0 material material bone
+anim texture
+0.500000 vertex vertex 1.0 anim = 0.500000 material material
+anim
+material frame frame
+-1 -1
+bone 0.500000
+-1 material bone 0.500000 vertex 0.500000 anim bone texture -1
+anim bone frame texture 1.0 anim
+vertex
+1.0
+frame = anim
+frame -1 texture 0.500000 0.500000 = anim
+1.0 = material
+1.0
+vertex vertex -1 anim
+texture bone =
+anim
+= 0.500000
+1.0 texture -1 anim
+= = frame 0.500000
+material = anim
+0.500000
+vertex frame
+-1 bone
+anim frame
+anim -1 vertex =
+= -1
+vertex
+anim 0.500000 0.500000 0.500000 anim
+bone
+texture -1 1.0 vertex frame material bone texture bone
+texture = material texture texture material =
+vertex -1 1.0 bone
+1.0 0.500000 anim 0.500000
+material = = texture anim = 1.0 frame anim
+material anim 1.0 0.500000 vertex material
+vertex 0.500000 anim
+bone 1.0
+texture bone 0.500000
+-1 0.500000 texture
+anim frame material
+1.0
+texture frame material texture
+bone 1.0 = anim anim anim material vertex material 0.500000 material bone material material 1.0 material anim vertex texture frame vertex = anim -1 1.0 vertex texture
+bone = anim
+= texture
+texture
+vertex frame vertex
+0.500000 vertex = frame frame -1 texture = = bone
+material anim = 0.500000 material
+frame =
+0.500000 = 1.0 = = = vertex anim bone
+-1 0.500000 1.0
+0.500000 bone 0.500000 anim -1 bone bone texture = =
+anim anim anim
+1.0 frame anim texture = texture vertex
+texture 1.0 bone 1.0 material 0.500000 bone bone vertex =
+1.0
+material material frame 0.500000 -1 texture -1
+1.0 -1
+material -1 -1 =
+vertex 1.0 = vertex = 1.0 vertex = 0.500000
+1.0
+bone 0.500000
+vertex
\ No newline at end of file
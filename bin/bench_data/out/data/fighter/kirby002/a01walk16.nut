@@ -0,0 +1,23 @@
+-1 material 0.500000 material 0.500000
+0.500000
+-1 0.500000 frame texture vertex =
+material 0.500000 -1 frame = -1 material anim
+anim vertex 0.500000 bone frame anim anim frame frame frame -1 bone
+frame -1
+anim vertex
+texture 0.500000 1.0 vertex = bone bone
+material material = 1.0 bone = anim
+vertex -1
+0.500000 bone anim 1.0
+-1 1.0 1.0 anim 0.500000 bone frame 0.500000 frame
+anim 0.500000 material anim 0.500000 1.0 bone
+texture
+frame 0.500000
+-1
+-1 vertex material vertex texture bone
+texture
+frame
+vertex vertex
+0.500000 texture
+vertex 0.500000
+an
\ No newline at end of file
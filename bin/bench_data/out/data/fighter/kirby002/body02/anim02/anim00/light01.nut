@@ -0,0 +1,47 @@
+material
+-1 -1 1.0 texture texture 0.500000 vertex material
+-1 frame frame frame 0.500000 -1 -1 material vertex vertex bone
+vertex
+material =
+frame frame texture material
+anim
+= anim anim bone frame =
+-1 = vertex anim anim -1
+vertex
+frame -1 texture material 0.500000
+bone anim vertex
+-1 frame
+= bone
+material
+texture 0.500000 1.0 = frame vertex anim vertex -1 1.0 frame material bone
+0.500000 frame -1 bone bone = 0.500000 anim 1.0
+= anim = vertex 1.0 -1
+anim texture 1.0 anim
+texture -1 texture
+bone -1 0.500000 = -1
+0.500000 0.500000
+frame
+vertex 0.500000 material material 0.500000 anim material vertex vertex -1 -1 1.0 bone anim anim
+anim texture
+1.0 bone
+-1
+0.500000
+vertex frame =
+0.500000 frame 0.500000 0.500000
+0.500000 0.500000 texture
+texture bone = texture 1.0
+texture vertex
+=
+1.0 =
+texture
+1.0 material = vertex bone
+0.500000
+anim
+vertex anim texture -1 texture -1 texture -1
+= 1.0 vertex texture anim
+0.500000 vertex bone = texture 0.500000 -1 anim 1.0 texture material frame bone
+anim
+1.0 material bone
+frame -1 vertex
+1.0 material
+material = bone 1.0 vertex = 0.500000
@@ -0,0 +1,5 @@
+1.0 =
+-1 1.0 vertex texture
+-1 material
+texture 1.0 = = texture
+anim frame 0.500000 anim
\ No newline at end of file
@@ -0,0 +1,5 @@
+= -1
+texture
+material
+0.500000 = texture 0.500000 1.0 1.0 anim texture vertex
+texture
\ No newline at end of file
@@ -0,0 +1,142 @@
+0.500000 anim 1.0 material vertex
+material
+frame
+=
+-1 texture anim material 0.500000 1.0 -1
+= vertex
+texture texture =
+vertex -1 1.0
+= = texture texture bone
+0.500000 -1
+= 1.0 1.0 = frame 0.500000
+1.0 = frame 0.500000 material material
+texture anim anim
+= -1 material bone = vertex vertex
+vertex -1
+material 1.0 texture
+frame vertex anim material 1.0 texture material
+frame 0.500000 bone
+-1 bone material = -1 anim material 0.500000 texture 1.0 material texture bone vertex bone
+0.500000 bone
+0.500000 material frame anim vertex
+vertex
+material anim 0.500000 =
+-1 frame = vertex
+material frame material
+texture -1 texture
+= texture -1 bone = vertex anim frame
+frame frame =
+= anim 0.500000 anim
+1.0 texture
+texture
+= anim
+vertex 0.500000 material bone bone -1 0.500000
+0.500000 frame = anim
+-1 -1 texture
+-1 frame bone frame 0.500000
+bone
+vertex vertex anim bone
+frame
+material
+0.500000 1.0 frame bone -1 vertex
+material texture 0.500000 frame bone
+anim frame 0.500000 vertex = bone 0.500000
+texture = bone -1 0.500000 texture
+frame
+vertex bone frame =
+bone -1 anim texture 0.500000 anim frame 1.0 -1 frame vertex vertex anim anim anim material anim
+0.500000
+texture anim frame
+-1 = anim vertex 0.500000
+material vertex 0.500000 -1 0.500000 bone bone frame
+-1 1.0 0.500000
+vertex frame frame -1 1.0 material bone vertex material 0.500000 1.0 anim bone 1.0 0.500000 texture 1.0
+= frame
+material frame bone
+1.0 anim
+1.0 vertex anim 1.0 texture
+vertex vertex anim = anim material bone frame vertex vertex vertex -1 anim material -1 -1
+0.500000
+-1 frame bone
+texture texture -1 = 0.500000 frame vertex anim vertex vertex
+= texture frame
+0.500000 1.0 frame
+texture anim
+= = -1 frame -1
+-1 material bone -1 = 0.500000 1.0 -1 -1
+frame bone
+anim vertex vertex
+frame 0.500000 frame
+material = = 1.0 -1
+frame 1.0 -1
+bone
+material
+anim
+material material 0.500000 bone
+material -1 material
+frame texture material 0.500000
+texture anim frame
+vertex anim 1.0 1.0 0.500000 1.0 bone
+= vertex
+texture anim
+vertex = material -1 0.500000 bone anim material bone anim =
+bone
+anim anim 1.0
+frame bone
+vertex anim frame vertex material 0.500000 vertex texture frame anim texture material bone
+vertex bone -1 anim anim
+frame
+0.500000
+-1 material = = -1 frame 0.500000
+vertex vertex =
+bone texture
+bone
+frame material
+= =
+frame texture = 1.0 bone texture
+bone
+=
+1.0 1.0 = material material
+texture
+anim
+vertex -1 texture 0.500000 texture material = texture
+1.0
+anim frame
+-1 0.500000 bone anim material 1.0 1.0 -1
+-1 -1 -1 texture anim 0.500000 =
+material 0.500000 bone
+vertex
+=
+1.0
+frame material
+1.0 vertex material 1.0 frame =
+anim frame
+material frame material
+bone 1.0 = 0.500000 vertex
+-1 0.500000 texture
+material
+bone -1 = = anim = anim =
+0.500000 = 1.0 material anim
+1.0 -1 = 0.500000 =
+= 1.0 bone -1
+material =
+anim
+bone -1 anim bone anim texture 0.500000 anim material material bone vertex anim = bone bone = bone anim
+anim anim anim =
+bone -1 bone texture anim
+material = 0.500000 vertex vertex
+1.0 frame texture frame -1 = frame
+0.500000 texture bone vertex
+-1 1.0
+1.0 material
+texture vertex 0.500000
+frame 1.0 bone 1.0 = texture 1.0 texture
+-1 material frame material vertex -1 material 1.0 frame -1
+anim
+frame texture =
+0.500000
+1.0 =
+= material frame -1 0.500000
+-1 material texture frame vertex texture anim 1.0
+= material
+texture material
\ No newline at end of file
@@ -0,0 +1,306 @@
+texture texture vertex material material vertex bone 0.500000 1.0 1.0 -1
+= =
+texture 0.500000 texture 0.500000 vertex
+0.500000 texture material
+=
+= bone
+vertex
+anim 1.0 -1 material
+bone
+vertex vertex frame material
+frame frame 0.500000 vertex texture
+-1 anim =
+material =
+anim
+-1 -1 1.0 texture 1.0 -1 -1 1.0 = texture = material -1 -1 frame texture material material material material vertex bone anim 0.500000
+0.500000 material frame texture 0.500000
+1.0 texture
+vertex texture
+bone
+bone vertex material vertex anim 1.0 0.500000 0.500000
+-1 anim
+material 0.500000 0.500000
+bone
+= texture
+= bone -1 -1
+material material 0.500000 anim vertex texture
+-1
+0.500000
+= material vertex material 0.500000 texture
+-1 frame 0.500000 1.0 frame
+bone =
+frame material bone
+= texture vertex 0.500000
+frame -1 -1
+frame
+texture 1.0
+bone = texture 0.500000 -1 1.0 0.500000 anim vertex =
+material frame frame bone 0.500000 material 0.500000 0.500000 0.500000 frame bone frame
+texture
+0.500000 1.0 1.0 1.0 0.500000 vertex frame vertex -1 texture
+anim
+bone -1
+vertex vertex = =
+frame material -1 texture texture anim
+material
+-1
+frame 0.500000 frame anim 0.500000
+material =
+anim 0.500000
+= texture vertex
+texture bone texture bone
+vertex
+vertex 1.0 bone
+1.0 material bone
+=
+0.500000 bone material material anim -1 bone bone texture
+vertex = -1 anim texture anim
+= 1.0 texture
+bone -1 0.500000 frame texture material
+anim
+frame 0.500000
+-1
+0.500000
+vertex bone material 1.0 anim texture -1 frame material
+texture
+vertex 1.0 texture texture anim
+1.0 -1 =
+anim -1 material bone bone bone vertex
+0.500000
+anim vertex -1 1.0 texture vertex vertex anim material bone
+= = 0.500000 1.0
+texture bone
+texture 1.0 frame 0.500000
+material vertex 0.500000 = bone = 1.0
+bone = anim anim texture -1 =
+vertex frame
+texture texture = material 0.500000 -1 anim anim bone material -1 anim texture -1 bone anim anim
+1.0 = -1 frame 1.0
+vertex 1.0 vertex anim
+vertex -1 material vertex texture = frame 0.500000 material anim
+1.0
+vertex vertex material
+-1 bone texture
+frame = 1.0 anim texture material -1
+material
+bone anim vertex material bone anim anim 1.0 vertex -1 texture
+0.500000
+frame
+bone texture
+texture bone -1
+0.500000
+frame
+frame bone
+bone 0.500000 material
+-1 material
+anim =
+vertex anim texture = anim anim material
+0.500000 = anim anim = = anim
+material 0.500000 0.500000 0.500000 -1 -1 = vertex bone 0.500000 -1 texture bone =
+0.500000 0.500000 0.500000
+vertex = 1.0 material
+-1 -1 material
+vertex anim = frame 0.500000
+-1
+frame bone
+anim bone frame
+-1
+frame = frame =
+anim
+0.500000 frame -1 vertex 1.0
+bone -1 = texture texture vertex
+frame material
+bone
+-1 frame 0.500000 1.0 material
+=
+-1 material 1.0 anim = 1.0 vertex
+material vertex
+bone =
+texture material material
+frame 1.0
+=
+1.0 -1 = 1.0 bone
+vertex 1.0 anim material
+0.500000 texture bone
+material anim 1.0 1.0 bone
+material frame bone bone 1.0 0.500000 material texture =
+texture =
+= = -1 vertex texture
+anim anim bone bone
+= frame frame frame vertex texture -1
+anim anim anim anim frame vertex vertex -1 1.0
+material
+anim vertex
+vertex
+-1 frame = 0.500000 bone 1.0 = material frame -1
+vertex
+1.0 texture texture bone
+anim anim material bone vertex
+bone material
+0.500000 texture vertex
+bone
+texture frame vertex
+0.500000 -1 0.500000 -1 vertex -1 0.500000 anim anim -1
+material = 1.0 = bone
+bone 0.500000 texture
+= 1.0
+-1
+= 1.0 0.500000 1.0 = 0.500000 1.0
+= frame
+anim
+material frame 0.500000 1.0 1.0 vertex
+= 0.500000 material frame -1 material
+frame anim material anim
+0.500000 anim 1.0 vertex texture vertex
+frame 1.0 0.500000 frame bone -1
+1.0 1.0
+material texture frame
+frame
+-1 frame =
+1.0 1.0 0.500000 1.0 0.500000 bone 0.500000 -1 1.0 = anim =
+1.0 = vertex material
+1.0
+texture
+vertex -1 -1
+-1 material material frame
+0.500000 =
+texture 1.0 vertex 1.0 -1 -1 frame
+1.0 1.0 texture material
+vertex texture texture -1 -1 -1 bone
+material
+1.0 frame 0.500000 frame 0.500000
+frame 0.500000
+frame =
+1.0 bone -1 bone -1 0.500000
+1.0 -1 0.500000 = 1.0
+0.500000 anim bone frame
+material -1
+vertex vertex material
+anim = bone -1 0.500000
+material -1 bone -1 =
+vertex
+-1 vertex =
+1.0 0.500000 material material anim -1 0.500000 = 0.500000 1.0 vertex bone
+anim material frame 1.0 material frame
+texture anim
+anim
+0.500000
+-1 material
+anim 0.500000 -1
+-1 1.0 -1 = anim anim bone = 0.500000
+anim 1.0
+vertex texture 0.500000 0.500000 frame frame bone 1.0 texture
+-1 frame
+anim
+bone frame frame frame frame frame anim material =
+material = frame material 0.500000 = vertex
+anim material material =
+1.0 texture texture
+-1 texture
+= texture vertex vertex
+=
+bone bone frame
+texture vertex
+-1 0.500000 material 0.500000 = = texture vertex frame vertex
+texture -1 0.500000 1.0
+= 0.500000 material material texture frame material -1 vertex 0.500000
+-1 bone
+anim 1.0
+0.500000 material vertex = material texture 1.0 = 1.0 = =
+vertex texture frame bone bone = 0.500000 0.500000 -1 texture
+frame 1.0
+-1
+0.500000
+frame frame
+-1
+texture
+frame bone frame = bone
+texture = anim frame -1 1.0 = -1
+material 0.500000 frame
+anim
+-1
+anim texture vertex
+= vertex
+frame texture 1.0 = -1 bone
+material vertex
+-1 anim -1 texture
+=
+bone bone = frame material bone texture = 1.0
+-1 bone -1 -1
+= = 1.0
+material bone 1.0
+frame anim
+texture 0.500000 = 1.0 1.0 bone -1 1.0 vertex
+vertex
+texture =
+texture -1 0.500000 -1 0.500000 texture frame = frame frame frame anim 0.500000 bone
+1.0 frame texture
+-1
+=
+= = 0.500000
+frame 1.0 1.0 frame material bone -1
+0.500000 anim vertex anim =
+0.500000 frame 1.0 bone bone
+anim =
+frame
+vertex vertex bone 1.0 material anim anim bone
+anim = -1 = frame vertex 0.500000 1.0 1.0 1.0 vertex = -1 material vertex bone 0.500000
+vertex
+-1 0.500000 frame
+= texture anim
+0.500000 0.500000
+vertex 0.500000
+-1 vertex frame
+anim bone = material bone -1 0.500000 = anim frame =
+-1 1.0 bone
+1.0 material material 0.500000 = frame anim bone bone vertex frame material bone 1.0
+anim material 1.0
+1.0
+=
+bone frame bone =
+0.500000
+1.0 bone texture 0.500000 bone 0.500000 anim
+texture -1
+bone material 1.0
+bone 0.500000 = texture 1.0
+vertex material
+anim vertex 1.0
+=
+material 1.0 bone material texture texture = anim = material bone anim anim bone vertex
+=
+frame texture texture = vertex = bone texture bone frame texture bone anim vertex 0.500000
+1.0 material = = 0.500000 anim
+texture material
+= vertex = vertex 0.500000 1.0 frame
+texture frame 1.0 1.0 anim material bone = texture material
+1.0 texture vertex -1 1.0
+frame
+vertex texture
+texture frame bone
+texture texture
+1.0
+material 1.0 material frame 1.0 bone material 1.0 0.500000 0.500000
+bone
+material
+-1
+texture
+=
+-1 vertex 1.0 0.500000 texture
+anim 1.0
+anim
+bone vertex =
+frame material frame 1.0 vertex
+vertex -1
+material anim texture 1.0 1.0 texture = = = vertex vertex texture 1.0
+0.500000 =
+material anim 1.0 vertex 1.0 anim frame frame material
+material 1.0 material anim anim -1
+frame material anim -1 vertex 1.0 -1
+=
+1.0 1.0 vertex anim 0.500000 bone bone bone texture
+1.0 frame 0.500000 1.0 -1 texture 0.500000 0.500000 vertex
+0.500000 anim bone
+texture 1.0
+0.500000 vertex = 0.500000 material = 1.0 bone frame
+vertex anim texture = texture vertex
+0.500000 material
\ No newline at end of file
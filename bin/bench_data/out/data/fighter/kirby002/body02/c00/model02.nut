@@ -0,0 +1,3 @@
+bone
+vertex bone texture texture bone material anim
+vertex b
\ No newline at end of file
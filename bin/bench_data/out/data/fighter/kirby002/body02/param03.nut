@@ -0,0 +1,23 @@
+frame vertex anim
+anim -1
+texture
+1.0 texture
+anim
+0.500000
+vertex -1 1.0 = frame material vertex 0.500000 anim bone
+anim bone = = =
+=
+bone
+anim
+bone anim frame 1.0 -1
+frame 1.0 -1 1.0 frame texture bone material -1 material
+vertex 1.0
+1.0 texture texture material 0.500000 = 1.0 = anim material
+anim vertex -1 anim 0.500000
+anim = frame vertex 1.0 = bone -1 anim
+anim -1
+texture 1.0 vertex
+bone
+vertex
+material
+=
\ No newline at end of file
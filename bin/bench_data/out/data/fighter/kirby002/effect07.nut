@@ -0,0 +1,16 @@
+0.500000 0.500000
+-1 vertex bone vertex anim -1
+anim vertex
+frame
+0.500000
+bone
+material
+-1
+1.0 material
+texture vertex bone
+1.0 = frame
+-1 0.500000 1.0 texture 0.500000
+-1 -1 vertex -1
+anim
+anim bone vertex = =
+material material material 0.500000 
\ No newline at end of file
@@ -0,0 +1,12 @@
+material vertex anim =
+-1
+frame anim
+vertex frame frame vertex texture = texture 1.0 anim bone 0.500000
+material 0.500000
+bone frame vertex
+0.500000 frame vertex anim
+-1 bone vertex material anim
+anim texture frame 1.0
+0.500000 anim texture bone -1 texture bone texture texture 0.500000 material = anim
+1.0 0.500000 0.500000 -1 =
+1.0 = verte
\ No newline at end of file
@@ -0,0 +1,14 @@
+material 1.0
+1.0
+frame vertex bone anim 0.500000 bone bone
+0.500000 = frame
+vertex 0.500000 =
+texture bone texture vertex
+-1 material anim texture
+anim frame texture -1 bone
+material texture
+vertex vertex -1 -1 bone -1 texture vertex frame 0.500000 vertex anim texture 0.500000 0.500000
+vertex bone material
+texture
+texture texture bone vertex = 1.0
+0.500000 bone
\ No newline at end of file
@@ -0,0 +1,60 @@
+-1
+anim = vertex
+anim -1 frame = material frame 1.0 1.0 frame material bone vertex 1.0 bone
+= anim 0.500000 vertex bone vertex -1
+0.500000 = =
+= frame
+frame =
+frame
+frame texture texture texture = texture = anim anim bone
+anim
+bone anim bone -1 0.500000 frame -1
+texture 1.0
+anim material = 0.500000 frame
+-1
+-1 vertex 0.500000 0.500000 1.0 0.500000 material 0.500000 anim material 1.0 vertex anim frame anim
+0.500000 vertex
+bone 1.0 -1 material -1 texture bone
+texture
+0.500000 material 0.500000 -1 frame -1
+bone
+vertex
+vertex frame anim
+0.500000 0.500000
+material
+frame
+= anim 0.500000 texture bone bone
+=
+-1 material
+=
+=
+= material anim
+anim material 0.500000 -1 = frame anim 0.500000 0.500000 bone
+material bone 1.0
+1.0
+-1 bone vertex
+-1
+anim
+-1 texture -1 -1 frame =
+0.500000 0.500000
+frame material anim -1 frame
+1.0 bone anim frame anim 0.500000 anim 0.500000
+frame anim bone 1.0 -1
+texture -1 frame
+bone = material material frame = material 1.0 1.0 anim bone
+-1 texture vertex 1.0 anim 1.0 anim -1 texture frame bone 1.0 material = material
+material vertex
+anim material texture -1 0.500000
+= 0.500000
+vertex texture anim 1.0 vertex
+= material texture 0.500000 anim
+1.0 frame texture 1.0 -1 -1 1.0 anim -1 texture 0.500000 vertex
+texture material
+material bone
+frame = -1 1.0 vertex bone texture
+texture 0.500000 frame material
+-1 anim material vertex 0.500000 0.500000 = = = 1.0 texture -1 0.500000 texture 1.0 anim -1 material = -1 vertex material frame
+bone vertex material 0.500000
+material frame -1 texture frame = frame -1
+= vertex material
+verte
\ No newline at end of file
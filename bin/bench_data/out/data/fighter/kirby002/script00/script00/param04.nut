@@ -0,0 +1,323 @@
+material bone material 0.500000 -1
+= 0.500000 1.0 vertex
+vertex
+= 1.0 material = texture material material texture 1.0 -1
+bone frame
+=
+material -1 -1 bone
+=
+vertex 1.0 vertex
+0.500000 material frame anim texture 1.0 anim
+vertex frame 0.500000 0.500000 texture
+1.0 bone frame 1.0 anim -1
+vertex texture = anim
+=
+= -1
+1.0 frame anim material vertex 0.500000 1.0 frame anim
+0.500000 0.500000 vertex
+=
+frame material = 1.0 1.0 anim vertex frame material 1.0 texture =
+bone 1.0 bone vertex
+=
+1.0 frame = bone 0.500000 -1 material bone
+texture material -1 0.500000 vertex -1 -1 1.0
+bone material anim
+material anim -1 = 1.0
+texture frame anim
+= vertex material -1 =
+0.500000
+anim 1.0 vertex
+texture anim 1.0
+bone anim vertex = anim 1.0 texture
+-1 anim -1 texture texture 1.0 0.500000 0.500000
+anim 0.500000 bone -1
+material -1
+= texture texture 1.0 bone =
+texture texture material 0.500000 1.0 1.0 texture
+texture
+texture 1.0 -1 anim
+bone anim
+bone anim vertex material vertex vertex 1.0
+vertex
+= -1
+=
+material texture anim bone -1 anim -1 bone material
+anim material
+-1 anim
+anim vertex 0.500000 1.0 anim
+=
+= -1
+vertex
+anim 0.500000 -1 texture 0.500000 1.0 = -1 material frame -1
+-1 texture
+vertex frame
+frame
+0.500000
+= material
+= frame texture material material
+material -1 -1 bone -1 material
+texture bone
+texture
+1.0 vertex -1 anim vertex anim anim 1.0
+frame -1 frame material
+vertex = = material anim frame -1 bone 0.500000
+bone
+0.500000 -1 = anim
+0.500000
+material
+material
+frame vertex frame
+vertex vertex texture 1.0 texture 0.500000 anim texture anim 0.500000 material
+1.0 0.500000
+bone texture frame -1
+0.500000 texture 1.0 bone vertex bone
+= -1 = -1 vertex anim material frame
+frame bone bone 1.0 vertex material
+anim
+material -1 1.0 texture -1 vertex anim
+1.0 = texture
+frame -1 material anim material
+-1 material vertex = frame material vertex 1.0 bone
+-1
+= -1 -1
+texture bone anim anim -1 texture material
+vertex vertex
+0.500000
+vertex
+texture 0.500000 1.0 1.0 bone 0.500000 -1 = anim
+vertex frame = = -1 bone texture 0.500000 texture texture vertex material
+texture 1.0 vertex frame vertex anim
+vertex material texture texture = = material texture -1 anim = texture vertex 0.500000 vertex texture anim anim
+frame bone material vertex = = =
+material
+material texture -1
+bone frame = frame = vertex 0.500000 anim
+vertex
+1.0
+1.0 frame -1
+anim texture frame anim =
+-1 =
+bone frame material vertex = 1.0 vertex
+-1 texture texture =
+frame -1 texture vertex
+bone 1.0
+= anim
+vertex frame frame
+vertex
+frame anim -1 texture vertex
+frame anim
+=
+0.500000 0.500000
+anim material -1
+= -1 = frame
+0.500000 material -1 texture = frame vertex 1.0 =
+-1 0.500000
+bone 0.500000
+= -1 frame bone
+1.0 vertex vertex frame vertex 0.500000 material 1.0 vertex
+vertex
+anim anim
+texture texture 1.0 anim = frame 0.500000 = anim 1.0 texture -1 -1 = texture anim = vertex
+bone
+frame frame texture frame material anim 1.0 texture bone
+bone texture material
+frame -1 material
+vertex 0.500000 1.0 -1
+vertex anim bone vertex vertex frame texture
+material -1 frame = vertex
+texture vertex frame vertex anim
+-1
+material -1 0.500000
+1.0 texture anim vertex vertex
+material frame
+texture frame
+material 0.500000 vertex
+texture -1 texture -1 frame vertex frame
+bone vertex frame
+-1 0.500000 bone material
+1.0 0.500000
+-1 vertex frame
+material texture
+vertex texture anim
+-1 frame
+texture bone bone
+bone
+frame bone -1 anim
+frame = 0.500000
+-1 anim texture bone
+0.500000 0.500000
+anim
+frame vertex
+= = texture vertex anim frame -1
+vertex anim 1.0
+frame vertex
+bone
+0.500000 = anim
+anim
+material anim -1 -1
+frame
+vertex anim material = material -1 material = anim
+material anim material anim material vertex anim
+texture bone vertex bone texture -1 vertex
+frame
+bone vertex
+anim -1
+material = = anim
+1.0 bone texture -1 frame bone bone texture 1.0 -1 -1 vertex = frame -1 =
+material vertex
+bone
+texture =
+=
+anim vertex
+material material 0.500000
+frame -1
+bone -1 vertex
+anim bone
+vertex texture
+bone bone 1.0 anim = vertex
+vertex frame
+frame 0.500000 anim bone
+material
+= = material = 1.0 = texture 1.0 1.0 frame
+frame
+1.0 vertex frame =
+0.500000 texture
+material 0.500000 texture
+1.0 anim
+0.500000 texture vertex texture -1 texture 1.0 material
+-1 =
+anim bone frame
+anim texture frame bone frame
+material bone material bone
+1.0 frame 1.0 material frame -1 = 0.500000 0.500000 0.500000 = bone anim
+material
+0.500000 0.500000 1.0 frame
+vertex vertex -1 1.0
+frame anim 0.500000 vertex
+material anim material anim anim
+0.500000 material 1.0 0.500000
+-1
+vertex =
+1.0 texture -1 = -1 anim -1
+anim vertex frame
+1.0 bone -1 texture
+texture
+material anim
+1.0
+-1 =
+anim 0.500000 vertex vertex
+1.0 0.500000
+0.500000 0.500000 0.500000 1.0 1.0 = frame
+1.0 bone vertex = bone
+1.0 =
+-1
+frame = frame material
+bone frame
+material frame
+frame 1.0
+-1 0.500000 frame frame 1.0 -1
+material = =
+anim 0.500000 bone bone material bone bone material bone =
+anim
+1.0
+texture
+material
+vertex anim = = 0.500000
+bone -1 0.500000
+bone bone = = anim
+1.0
+1.0 anim material bone bone
+frame
+bone bone texture 0.500000 vertex
+anim
+anim anim = frame
+=
+texture frame 1.0
+-1 = -1 vertex bone 1.0 bone frame
+1.0 bone 1.0 1.0 -1 1.0 anim 0.500000 -1
+anim
+0.500000 0.500000 = anim
+bone anim 1.0 vertex frame texture texture
+1.0 vertex
+0.500000
+anim 0.500000 0.500000 bone
+anim
+1.0
+material
+1.0
+1.0 frame = -1 vertex
+material texture =
+frame material
+bone
+= bone 1.0 0.500000
+0.500000
+0.500000 =
+frame vertex 1.0
+1.0 vertex frame -1
+anim 0.500000 anim 0.500000 vertex anim material anim anim material
+anim bone bone 1.0 texture texture material frame material
+frame
+bone texture texture anim
+-1
+bone
+frame -1
+1.0 vertex
+0.500000
+0.500000 vertex vertex 1.0 -1
+anim 1.0 = vertex
+vertex 0.500000 -1 1.0 0.500000 1.0
+anim 0.500000
+bone anim 1.0 frame = -1 vertex vertex texture
+anim 0.500000 frame -1 vertex texture vertex material bone
+1.0 frame = texture
+= 1.0
+material 1.0 0.500000
+0.500000 frame = = anim material texture texture bone
+anim vertex vertex
+material frame anim anim
+anim bone =
+anim
+= = texture
+= = vertex frame bone texture
+vertex
+material 1.0 0.500000
+frame texture vertex
+material vertex
+material -1 anim texture
+anim texture 0.500000
+material
+frame = texture anim -1 material frame 1.0
+bone bone
+= anim vertex anim 0.500000
+1.0
+0.500000 -1 1.0 vertex texture bone texture vertex
+anim anim
+vertex texture material 1.0 bone 0.500000
+-1
+material =
+1.0
+-1 frame bone anim texture 1.0 vertex
+-1 anim
+frame 1.0 anim frame -1
+0.500000 -1 texture material texture texture
+bone
+bone
+bone bone
+frame material frame 1.0 frame bone frame anim texture vertex texture
+= frame
+-1 = anim anim bone
+= vertex 1.0 material = anim anim bone frame 1.0
+texture frame
+1.0 = =
+texture anim anim anim -1 material texture material material = material = bone
+0.500000 = material
+material = -1 bone frame anim frame bone =
+1.0 texture 0.500000 1.0 frame bone =
+texture
+frame material bone
+anim
+= frame texture
+bone bone vertex
+1.0
+texture
+vertex textu
\ No newline at end of file
@@ -0,0 +1,77 @@
+material frame material texture
+-1 material
+frame 0.500000 material anim texture = frame
+anim anim anim -1 0.500000
+0.500000 -1 bone
+= frame texture texture vertex -1 bone
+bone
+0.500000 texture
+texture frame = 0.500000 vertex 1.0 bone frame 1.0
+vertex
+frame frame
+-1 texture 0.500000 0.500000
+anim frame frame bone
+anim =
+=
+0.500000 bone
+-1 frame bone bone
+anim -1
+frame 1.0 texture bone 0.500000 texture material material
+texture
+-1 anim vertex bone
+bone
+material vertex
+texture texture vertex -1 1.0 -1
+material bone anim anim frame frame
+material -1 1.0 0.500000 anim material vertex material -1
+= frame
+-1 0.500000 bone -1 1.0
+-1 1.0 -1 1.0
+0.500000
+frame bone
+= vertex vertex vertex texture =
+bone 0.500000 bone texture = -1 0.500000 = 0.500000 1.0 vertex
+frame
+0.500000 -1 = 0.500000
+-1 0.500000 bone material
+= 1.0
+anim
+anim
+texture
+= = anim -1 frame 0.500000 bone texture bone
+anim anim material -1
+frame
+texture
+anim 1.0
+bone
+anim -1
+frame 0.500000 -1 -1
+material -1 bone material material
+= anim
+= anim
+anim = -1 = = texture = texture
+1.0 texture anim bone -1 frame -1 = -1 bone = -1 vertex frame
+texture 1.0 bone 0.500000
+anim 0.500000 texture bone bone
+=
+-1 -1 -1
+vertex frame bone
+anim
+bone anim 0.500000 = anim frame 1.0 =
+frame 0.500000 1.0
+-1 =
+material = 0.500000 vertex
+= anim bone 0.500000 bone anim
+material material texture bone 1.0 bone texture bone frame = frame anim texture texture bone -1 1.0
+bone anim material 0.500000 vertex -1 frame
+= texture 1.0 material texture
+material anim 0.500000 vertex
+-1
+material material bone frame = texture anim
+0.500000 material anim = =
+bone frame bone = =
+material 1.0 bone -1 bone
+vertex texture 0.500000
+vertex material bone 0.500000 -1 = 0.500000
+vertex bone material material
+textu
\ No newline at end of file
@@ -0,0 +1,96 @@
+1.0 material
+texture
+frame
+vertex
+material
+texture vertex 0.500000 vertex
+= -1 material
+anim
+bone frame texture
+bone
+frame -1 anim
+frame -1 material 0.500000 = 1.0
+texture 1.0 bone frame = = vertex anim vertex bone 0.500000
+material 1.0 frame = frame frame
+bone anim
+= -1 0.500000 1.0 0.500000 anim
+material
+texture bone -1 anim texture 0.500000 =
+bone frame -1 bone = frame anim -1 0.500000
+1.0 frame bone
+-1 vertex texture 0.500000 1.0 material bone
+bone
+vertex
+vertex 0.500000 frame anim
+=
+-1 material 1.0
+material = 0.500000 texture frame 0.500000 -1 anim texture vertex 0.500000
+vertex = 1.0
+-1
+=
+anim
+=
+bone texture
+-1
+anim texture
+bone texture texture
+= -1 bone
+= texture material
+1.0 texture vertex material 1.0 texture 0.500000 -1 material -1
+bone -1 bone =
+1.0
+0.500000 anim =
+frame bone
+-1
+frame frame vertex
+1.0
+-1
+1.0 0.500000
+bone vertex
+vertex texture anim texture 0.500000 texture vertex = material 0.500000
+frame material 1.0 bone
+frame
+anim material
+bone 0.500000 1.0
+1.0 material bone 1.0
+vertex bone 0.500000 0.500000 1.0 material texture vertex 0.500000 vertex texture -1
+texture
+= anim frame -1
+frame frame 1.0
+= bone -1 -1 vertex material bone bone
+bone -1 1.0 anim vertex vertex 0.500000 = bone texture bone -1 0.500000 material 0.500000 bone anim
+texture -1 vertex bone 1.0 material
+vertex 0.500000 -1 material -1 -1 texture 1.0 texture
+bone bone = -1
+= texture material 1.0 0.500000
+material -1
+1.0 vertex 1.0 vertex
+material 0.500000 1.0
+0.500000 = =
+texture 1.0 = =
+frame 0.500000 frame 1.0 = material vertex
+texture
+= texture 1.0 bone anim
+= = -1
+= frame
+1.0
+-1
+0.500000
+1.0 1.0 material bone
+1.0 -1
+material vertex 0.500000 0.500000 = frame
+bone
+bone vertex 1.0 1.0 -1
+bone frame -1 vertex vertex frame 0.500000 1.0 anim
+vertex vertex texture 1.0 -1 frame anim anim anim anim anim
+vertex
+bone = vertex texture texture texture vertex bone material 1.0
+material vertex bone bone material vertex material
+anim frame material -1 -1
+vertex anim frame
+1.0 -1 anim = texture = -1
+texture bone 1.0 0.500000 texture
+vertex frame
+0.500000 frame bone bone
+material vertex vertex
+0.500000 texture frame material frame 
\ No newline at end of file
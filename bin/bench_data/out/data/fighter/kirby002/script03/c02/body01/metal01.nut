@@ -0,0 +1,61 @@
+1.0 -1 frame bone frame -1 texture 0.500000
+-1 anim vertex
+1.0 frame
+bone -1 0.500000 bone
+bone -1 bone 1.0 material vertex -1 texture bone vertex
+0.500000
+-1 texture 0.500000 vertex bone anim material = vertex bone frame frame vertex anim frame frame bone 1.0 anim = bone material vertex texture bone 0.500000 anim
+-1 material 1.0 =
+= vertex frame
+= -1 1.0 -1 1.0 texture = bone material material frame
+anim 1.0
+texture material
+frame
+0.500000 1.0
+material 1.0 bone
+vertex 0.500000
+frame material texture anim 1.0
+-1
+= -1 -1 -1 1.0 anim =
+anim anim vertex bone 1.0 bone
+anim -1 = material vertex anim frame anim 0.500000 = 0.500000 material
+anim 1.0 -1 anim
+anim 1.0 frame texture
+anim -1 0.500000
+1.0 texture bone texture texture =
+texture vertex vertex 0.500000 -1
+vertex frame
+frame 0.500000
+1.0 vertex texture 0.500000
+bone bone frame =
+-1
+anim material material = vertex
+material
+=
+-1
+0.500000 frame bone 1.0 bone
+0.500000 bone
+anim material -1 0.500000 material material frame material bone 1.0 texture texture 0.500000 bone anim
+frame frame bone anim
+0.500000 -1
+anim
+1.0 vertex -1 vertex 1.0 frame
+0.500000 0.500000 -1 material texture 1.0 anim frame
+= 1.0 material
+-1 0.500000
+= anim frame frame =
+anim material frame 1.0 -1 = anim = anim material frame bone 1.0 0.500000 -1 vertex material anim -1 anim bone
+frame bone texture material
+vertex bone = texture 1.0 material
+bone
+0.500000 -1 1.0 1.0 bone
+frame texture =
+-1
+= =
+bone -1 0.500000 0.500000 -1
+vertex 1.0
+bone bone 0.500000 bone
+anim
+anim texture
+0.500000 anim 0.500000 =
+= = material -1 bone = anim 1.0 0.500000 -1 -1 texture bone frame bone 
\ No newline at end of file
@@ -0,0 +1,6 @@
+texture 0.500000 =
+1.0
+texture anim
+-1
+=
+= anim 
\ No newline at end of file
@@ -0,0 +1,68 @@
+texture
+material texture -1 1.0
+material 1.0 0.500000 frame = = material texture bone
+material anim 0.500000
+bone vertex
+frame vertex anim = 1.0
+frame = bone
+vertex =
+vertex
+0.500000 vertex texture
+0.500000 0.500000 vertex material 1.0 -1 = anim texture 1.0 1.0 vertex anim
+vertex
+vertex material texture material = bone
+vertex material vertex -1 0.500000 material frame bone =
+1.0
+vertex texture
+anim
+1.0 material texture = bone
+anim 1.0 vertex 0.500000 0.500000
+-1 anim vertex anim vertex = texture frame
+bone frame 1.0 -1
+frame 1.0 texture = bone 0.500000
+= frame
+material = vertex bone bone texture =
+-1
+frame frame texture = anim
+frame vertex
+texture 0.500000 frame texture 1.0 = bone -1 material = vertex material -1 bone vertex 1.0
+1.0
+material anim vertex = = bone
+material frame texture texture
+vertex material texture vertex
+= bone
+bone
+bone = frame bone
+texture 1.0 frame vertex
+frame anim 0.500000
+anim -1
+-1 1.0 vertex 1.0 -1 = bone frame frame
+1.0 bone
+-1 =
+1.0 bone
+bone 0.500000
+bone bone material 1.0 = vertex 1.0
+anim -1 texture frame 0.500000 vertex
+vertex
+-1
+frame frame = anim = frame frame 0.500000 -1
+0.500000
+0.500000 -1
+vertex -1 vertex
+=
+texture
+frame bone 1.0
+texture = texture anim anim anim bone
+vertex material 0.500000 frame
+frame
+texture bone
+0.500000
+texture 0.500000 frame 0.500000 texture = = texture -1 frame 0.500000 -1 texture texture material 1.0 1.0 -1 texture texture bone anim 0.500000
+material -1 = 0.500000 frame
+texture vertex vertex material vertex
+= frame 1.0 anim anim frame
+anim texture
+anim vertex = material 0.500000 0.500000 frame
+1.0 anim =
+vertex frame
+1.0
\ No newline at end of file
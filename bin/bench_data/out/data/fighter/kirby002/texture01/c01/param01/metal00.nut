@@ -0,0 +1,5 @@
+=
+-1 texture = = = texture 0.500000 anim
+= bone 1.0 anim
+= anim
+= fr
\ No newline at end of file
@@ -0,0 +1,207 @@
+= bone 1.0
+0.500000 0.500000 material -1 texture
+vertex -1
+0.500000
+anim 0.500000 vertex
+= bone
+material vertex
+vertex anim
+vertex anim 1.0
+1.0
+vertex material frame anim
+0.500000
+bone anim texture texture -1 1.0
+material material
+frame 1.0
+material material texture
+bone
+frame 0.500000 -1 1.0 frame = anim texture -1 -1 vertex = texture bone texture bone anim bone
+0.500000 frame material material 1.0 = -1 anim anim
+-1 frame 0.500000
+anim 0.500000 anim texture 0.500000 bone
+=
+-1 1.0 texture
+material
+bone vertex vertex texture
+material
+= vertex
+-1 frame material 1.0 frame bone anim = vertex =
+material texture bone
+0.500000
+= material bone frame anim material 1.0 = anim vertex vertex frame material
+frame =
+bone 0.500000 bone bone 1.0 texture anim anim
+= frame -1
+1.0 material vertex 1.0 -1 0.500000 -1 0.500000
+0.500000 -1
+material -1 bone = 1.0
+vertex
+frame
+= material
+= frame
+1.0 vertex 1.0 texture 0.500000 anim bone 0.500000
+vertex frame anim material anim -1
+1.0 vertex bone -1 bone =
+frame vertex texture bone
+material frame 1.0 vertex material anim 0.500000 frame anim bone
+texture material material = vertex
+1.0 vertex
+frame -1 material frame
+material frame
+vertex bone anim vertex
+= anim frame 0.500000 material
+-1 frame bone -1 material frame
+0.500000 1.0
+anim
+frame anim 0.500000 1.0 bone = material material
+0.500000 texture frame
+anim frame = material vertex frame 0.500000
+anim 0.500000 bone 1.0 texture bone 1.0 material frame -1 texture texture frame texture 1.0 = 1.0 = frame frame
+frame 0.500000 frame bone frame bone -1 =
+texture
+material material material frame 1.0 frame 0.500000 frame
+0.500000 = -1 bone
+0.500000 -1 -1 vertex bone 1.0 anim
+bone 0.500000
+texture
+= anim = texture anim bone -1 0.500000 = bone -1 material -1 anim = vertex
+-1
+vertex -1 -1
+anim vertex
+-1
+frame
+frame
+0.500000 1.0
+anim 1.0 = frame = 1.0 texture
+frame vertex 0.500000 1.0
+-1 anim material vertex
+frame
+-1 = -1 anim
+vertex material anim vertex anim
+= material
+material anim texture 0.500000 texture = bone texture
+texture anim 1.0 anim vertex 0.500000 1.0
+texture vertex
+0.500000
+bone = bone
+texture
+anim -1
+material bone vertex -1 frame
+anim material
+anim 0.500000 bone 1.0 anim
+1.0 0.500000 -1
+-1
+bone 0.500000 bone -1 1.0 texture -1 vertex 1.0 texture texture
+vertex 1.0
+=
+bone
+anim -1 -1
+anim material -1
+1.0 bone material texture 1.0 = bone 0.500000 material anim
+-1
+-1 -1 0.500000
+vertex = frame 1.0 material
+1.0
+texture -1 vertex anim = =
+texture anim = frame 1.0 frame frame material
+texture
+texture bone material material 0.500000
+0.500000
+texture material -1
+material
+-1 material 0.500000 vertex
+texture
+bone anim 0.500000 texture -1
+material = =
+material bone
+anim 0.500000 -1
+bone anim
+texture -1
+1.0 = -1
+bone bone
+1.0 = = frame anim frame vertex bone -1 material vertex 1.0
+texture
+vertex 1.0 0.500000
+1.0 material frame = 0.500000 0.500000 = 1.0 = bone vertex
+anim
+anim
+bone
+vertex
+texture texture
+vertex
+vertex anim bone
+vertex bone =
+= texture
+texture = bone vertex material
+texture texture frame
+-1
+texture 0.500000 vertex
+anim material material bone texture anim material
+= bone 1.0 material
+-1 anim bone material
+-1 bone 0.500000 vertex 0.500000 frame -1 bone = -1 anim 0.500000 anim bone -1 frame
+texture vertex bone frame texture texture = bone frame = vertex frame
+vertex 0.500000
+0.500000
+= 1.0 texture 0.500000
+1.0 material =
+1.0 vertex -1 vertex frame texture 1.0 vertex
+0.500000
+anim material
+1.0 -1 anim anim -1
+-1 material frame -1 vertex 0.500000
+0.500000 vertex texture
+frame =
+anim 0.500000 texture = = = 0.500000 texture bone bone 1.0 -1 0.500000 frame 0.500000 -1 texture
+=
+0.500000 1.0 material 0.500000 vertex 1.0 = frame vertex frame
+1.0
+frame
+anim -1 material -1 -1 0.500000 1.0 frame = = 1.0
+=
+bone 1.0 anim 1.0 1.0 vertex bone material texture
+texture
+= frame bone = anim
+vertex
+frame
+anim frame material 1.0 texture bone
+texture = -1 -1 = bone -1 frame bone
+vertex vertex material = frame material bone =
+=
+texture vertex
+texture vertex = frame bone 1.0
+0.500000 vertex texture
+1.0 vertex
+vertex 1.0 material anim bone 0.500000
+texture frame 1.0
+1.0
+vertex
+0.500000
+-1 0.500000 anim
+= 0.500000 frame = =
+0.500000 frame texture bone anim material =
+-1 -1 frame
+=
+material 1.0 material
+vertex = frame
+anim
+0.500000
+bone bone
+-1 -1 0.500000 0.500000 = vertex
+1.0
+-1
+texture
+bone
+frame
+-1 0.500000 -1 material
+= 0.500000
+1.0 texture anim
+texture texture anim frame 1.0 texture
+=
+frame
+frame bone vertex vertex bone -1 1.0 bone frame -1 texture 1.0 vertex
+anim 1.0 frame 1.0 0.500000 0.500000
+=
+bone -1
+anim frame 1.0 material texture
+= textu
\ No newline at end of file
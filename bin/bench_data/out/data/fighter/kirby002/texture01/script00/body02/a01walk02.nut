@@ -0,0 +1,26 @@
+0.500000 0.500000
+texture
+1.0 anim anim 1.0 bone -1 -1
+texture
+vertex bone 1.0
+-1
+texture
+-1
+anim texture 0.500000 texture vertex
+-1 vertex vertex
+0.500000
+vertex
+material 1.0 1.0
+0.500000 -1
+-1 -1 = -1 -1 anim vertex =
+frame 0.500000 frame
+texture
+material frame anim bone material vertex 0.500000 frame anim
+material vertex vertex texture material
+-1 -1
+bone
+1.0 vertex anim texture
+vertex
+material vertex 0.500000 -1 bone = 0.500000 bone 1.0 anim
+anim
+= -1 -1 bon
\ No newline at end of file
@@ -0,0 +1,107 @@
+material
+material 0.500000 bone
+frame bone
+0.500000 1.0
+anim anim -1 bone 0.500000
+frame
+-1 -1 =
+bone anim = bone = -1 1.0 = vertex
+texture 1.0 0.500000 texture material anim 0.500000 material frame anim
+= bone vertex
+anim
+0.500000 anim frame anim -1
+frame frame 0.500000 1.0
+vertex frame bone -1 material
+texture vertex frame bone texture
+anim
+=
+-1
+vertex -1 anim = material
+-1 material anim anim -1 material 0.500000
+bone
+vertex
+anim 1.0
+anim 1.0 =
+material bone material material
+0.500000 bone frame
+-1 0.500000 anim =
+frame -1 1.0 frame material material
+bone frame -1 anim texture
+texture
+texture vertex anim
+bone = 1.0 texture = material 0.500000 1.0 1.0 material
+0.500000
+material material frame
+texture anim
+anim material = material material texture = texture 1.0
+= 0.500000
+bone anim -1 = 1.0 vertex
+material bone material =
+frame -1
+anim frame =
+-1 1.0
+vertex 0.500000 anim
+1.0 vertex 1.0 material material
+=
+vertex
+bone
+bone
+frame -1
+texture material -1 bone texture bone =
+1.0
+texture bone anim vertex
+1.0 0.500000 vertex
+-1 = material -1 texture
+0.500000 1.0 vertex frame frame frame 1.0 frame
+anim frame 0.500000 vertex material -1 material 0.500000 material texture
+bone anim -1
+material frame 1.0
+= bone -1 bone texture 0.500000 1.0 -1
+frame = material
+-1
+texture anim anim
+0.500000 =
+vertex
+material vertex frame 0.500000 anim 0.500000 frame texture vertex
+frame
+0.500000 vertex texture
+frame frame
+frame -1 bone = frame
+-1 -1 1.0 =
+= material
+anim material
+0.500000 0.500000 anim = material
+1.0 bone 1.0 -1 =
+=
+bone
+vertex vertex texture bone
+material 1.0 texture bone vertex texture
+frame 0.500000 vertex 0.500000 bone anim
+vertex texture texture material 1.0 vertex frame
+texture 0.500000 texture
+bone anim -1 vertex -1
+material vertex frame -1 vertex material =
+frame bone material
+texture 0.500000 =
+anim 1.0 -1
+bone texture material anim bone texture 0.500000 frame bone bone vertex frame
+frame = texture material texture
+frame texture = frame
+-1
+anim
+1.0 = vertex
+vertex texture
+vertex bone texture bone
+1.0
+texture texture material vertex
+0.500000
+bone 1.0 frame vertex anim 0.500000 -1 frame -1 anim texture bone
+frame frame
+0.500000
+1.0 vertex material vertex
+frame 0.500000 bone
+material frame = vertex -1 0.500000 0.500000 -1 bone
+bone vertex = frame = vertex vertex frame -1 frame texture -1 vertex 0.500000 frame
+frame 1.0 material
+bone frame
+material frame 0.500000 material vertex
\ No newline at end of file
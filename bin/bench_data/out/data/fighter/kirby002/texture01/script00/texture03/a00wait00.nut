@@ -0,0 +1,18 @@
+anim
+1.0 frame frame = vertex bone bone -1 =
+frame -1 bone
+anim frame
+vertex 0.500000 anim = texture texture
+anim
+texture bone =
+= material texture frame
+frame material
+material anim bone anim 1.0
+bone
+anim 0.500000 material frame
+vertex = material material 0.500000
+anim
+1.0 = anim
+-1 texture vertex frame frame
+= = vertex anim 0.500000 texture 0.500000
+0.500000 0.500000 texture 1.0 material -1 anim bone frame -1 anim 1.0 frame 
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 material
+0.500000 anim anim vertex frame material anim 1.0 frame 0.500000 material
+1.0
+anim frame anim 1
\ No newline at end of file
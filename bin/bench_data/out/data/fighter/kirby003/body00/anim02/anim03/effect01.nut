@@ -0,0 +1,29 @@
+bone material 0.500000
+1.0 -1 bone = =
+0.500000
+material
+vertex vertex 0.500000 frame frame
+-1 material material vertex texture vertex frame vertex -1 =
+vertex anim bone 1.0 texture
+1.0
+texture =
+vertex
+1.0 frame 1.0 anim 0.500000 material
+1.0 1.0 anim texture
+vertex
+-1 -1
+vertex texture material vertex = material frame
+1.0 0.500000 0.500000 0.500000
+vertex material
+1.0 0.500000
+bone material bone anim 0.500000 texture
+= texture texture
+anim -1
+vertex frame
+= frame
+-1 bone material =
+bone material = vertex frame vertex =
+0.500000
+anim anim anim 0.500000 material
+= material
+-1 bone 1.0 frame 0.500000 texture t
\ No newline at end of file
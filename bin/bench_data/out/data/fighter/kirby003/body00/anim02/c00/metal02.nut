@@ -0,0 +1,11 @@
+frame
+texture bone
+anim anim 0.500000 -1 vertex material -1
+1.0 texture 1.0 anim bone bone anim 0.500000 1.0 anim frame anim 0.500000 1.0
+bone bone bone vertex frame 0.500000 0.500000 -1
+vertex bone
+texture vertex anim texture frame
+bone
+0.500000
+bone vertex = vertex texture
+material material material fr
\ No newline at end of file
@@ -0,0 +1,306 @@
+0.500000 -1
+= bone texture
+material 0.500000 0.500000
+0.500000 1.0 1.0 vertex = -1 -1 texture
+0.500000
+-1 = -1 texture bone
+bone = 1.0 1.0
+frame vertex
+-1 bone
+-1 frame vertex texture 1.0 anim
+-1
+vertex -1 texture bone 0.500000
+0.500000 -1 material vertex 1.0
+frame
+1.0
+texture
+anim texture
+anim material 1.0
+1.0 frame = 0.500000
+material material anim anim texture frame material frame anim anim
+1.0 -1
+texture
+0.500000 0.500000 frame = 1.0 anim frame bone bone 1.0 anim -1
+1.0
+=
+material
+-1 material
+anim = 0.500000 1.0 =
+frame
+frame frame frame anim frame
+1.0
+1.0 -1 vertex vertex anim -1 texture
+0.500000 anim
+0.500000 1.0 material anim frame =
+vertex bone texture
+anim
+bone bone -1
+material
+anim 0.500000 -1 texture -1
+material -1 0.500000
+1.0 vertex vertex texture
+bone 0.500000 vertex vertex = texture
+anim vertex 1.0 = 0.500000 anim -1
+-1
+material
+0.500000
+0.500000
+1.0 = -1 frame vertex
+-1 anim -1 material anim
+anim material
+= frame
+frame
+1.0 -1 vertex vertex 0.500000 0.500000 material
+bone -1
+material bone texture
+= frame texture 1.0 = vertex 1.0 bone = texture material bone anim frame 1.0 frame vertex 0.500000
+0.500000
+bone = = -1 0.500000 bone
+vertex anim 1.0 bone -1 texture 1.0
+texture =
+0.500000
+= 1.0
+-1 frame bone material 1.0 frame frame anim
+1.0 0.500000 =
+= 1.0 bone
+texture = = vertex material 0.500000 anim anim texture -1 vertex texture
+texture
+-1
+material texture -1 material bone anim 1.0
+vertex
+1.0 1.0 texture bone frame texture -1 -1
+frame =
+frame 1.0
+texture =
+0.500000 material 0.500000 frame frame vertex frame texture
+= bone
+frame
+-1
+vertex bone vertex
+anim
+1.0 bone
+vertex texture anim frame bone
+anim 0.500000 material = frame -1 = frame texture material =
+bone texture texture texture frame 1.0
+=
+-1 0.500000 1.0 texture
+frame frame
+0.500000 material
+-1 =
+1.0 texture -1 0.500000 anim texture 1.0 frame material texture
+frame
+material =
+bone vertex material bone
+0.500000 1.0 bone
+vertex texture
+material -1 material bone -1 bone
+= texture = texture frame = 1.0
+material frame 1.0 0.500000 anim
+frame material
+frame 1.0
+vertex
+texture texture 1.0
+vertex texture bone 1.0
+= frame = frame material
+texture
+-1 material
+bone
+bone 0.500000 -1 texture bone -1
+frame
+-1
+-1 0.500000 material vertex
+anim 1.0 1.0
+anim texture texture texture frame
+material
+1.0
+= = bone texture frame texture 0.500000 material 0.500000 -1 frame
+material
+1.0 frame
+texture = bone
+-1 anim material texture
+frame
+1.0 vertex texture material bone vertex
+vertex
+1.0
+anim texture -1
+texture =
+1.0 -1 1.0 texture bone 1.0 anim frame -1
+1.0 texture vertex frame bone anim = frame = 1.0 -1 =
+= texture
+material
+texture frame bone bone material
+frame
+anim
+frame material
+texture texture
+vertex = anim
+anim vertex bone vertex
+1.0 = bone
+material = frame 0.500000 material frame material = material
+material
+material frame
+0.500000 = = bone -1 bone 0.500000 material
+frame anim
+0.500000
+texture
+vertex = -1 -1 -1
+= -1 vertex = bone anim bone material 0.500000 = -1 0.500000
+0.500000 material
+0.500000 1.0 frame 1.0
+1.0 =
+0.500000 texture bone frame anim
+material bone
+1.0 0.500000 material bone
+vertex bone
+0.500000
+anim
+=
+-1 = vertex 0.500000 0.500000 texture bone -1
+texture vertex 0.500000
+bone 1.0 anim
+0.500000 frame =
+vertex 0.500000 material
+-1 bone 1.0 material -1 1.0
+bone
+= anim
+material
+vertex frame
+frame 1.0 0.500000 vertex
+0.500000
+0.500000 0.500000
+1.0 texture
+vertex = frame 0.500000
+0.500000 bone bone texture
+-1 = vertex
+-1 frame = -1 =
+1.0 -1 0.500000
+0.500000
+texture bone
+texture vertex
+-1 0.500000 -1 bone material
+-1 -1 -1 0.500000 vertex texture
+vertex = anim material texture anim -1 1.0 material
+-1 anim anim material material = frame
+texture vertex frame = 0.500000 frame bone texture =
+vertex bone bone anim 0.500000
+material vertex vertex = 0.500000 material 0.500000 0.500000 0.500000 texture 1.0 frame
+1.0 = frame material texture texture
+texture anim
+vertex bone 0.500000 0.500000 1.0
+bone
+frame 0.500000 -1 bone material vertex texture
+0.500000
+-1 vertex anim
+bone anim
+-1
+1.0 anim vertex material -1 anim -1 material
+anim anim frame material -1 anim vertex 0.500000 material
+anim = texture
+texture 0.500000
+bone
+bone 0.500000 vertex = texture material anim -1 vertex 0.500000 bone 1.0 texture
+1.0 -1
+0.500000 1.0 -1
+anim
+texture
+bone vertex anim
+vertex 0.500000
+frame vertex frame
+bone bone 0.500000 -1 -1 vertex
+0.500000 bone
+-1 frame frame material 1.0 texture
+-1 texture anim 1.0 anim frame bone anim
+-1 frame bone material vertex -1
+material bone
+material bone
+vertex vertex =
+= -1
+1.0
+1.0 bone bone bone anim
+anim vertex 0.500000
+texture texture = material 0.500000 anim = frame texture bone -1 0.500000 -1
+-1 texture
+0.500000 0.500000
+frame -1
+frame = bone material
+bone frame anim 1.0 texture 0.500000 -1 material -1
+-1 =
+anim 0.500000 frame 0.500000 bone = vertex 0.500000 0.500000 0.500000
+-1 material
+vertex bone vertex
+=
+anim
+vertex
+material -1
+material
+= 1.0 = bone texture
+frame frame = anim texture = frame
+material bone anim bone 1.0 0.500000 texture frame bone frame 1.0 -1
+bone bone frame anim bone 1.0 =
+= frame frame 0.500000 vertex 0.500000 0.500000 -1
+vertex -1 material -1 -1 frame material 0.500000
+vertex material bone
+frame -1 vertex
+0.500000 bone anim vertex vertex
+bone bone
+-1 1.0
+bone vertex
+-1 bone
+vertex vertex 1.0 material -1 material
+texture bone
+anim bone vertex material texture bone = 1.0
+material anim texture
+texture bone -1 bone -1 vertex 1.0 0.500000
+= anim vertex texture =
+bone vertex 1.0 -1 vertex
+0.500000 1.0
+texture anim frame material 1.0 texture
+1.0 texture
+-1
+-1 anim 1.0
+frame
+frame
+texture
+=
+frame
+vertex texture = material -1 anim texture material
+vertex vertex
+frame = vertex bone 0.500000 = 1.0 vertex material -1
+anim
+1.0 material 1.0
+1.0
+anim
+vertex material
+frame = anim
+-1 1.0
+texture anim vertex material texture = -1
+0.500000 1.0
+1.0 0.500000 anim
+1.0 texture 1.0 texture material 1.0 texture vertex =
+-1 anim anim material 0.500000
+frame anim vertex
+bone anim frame 1.0
+0.500000
+texture = texture texture anim 1.0 -1 = = anim
+anim vertex
+frame 1.0 material vertex -1 frame anim bone material texture material vertex
+vertex vertex
+anim
+material material = 0.500000 anim material texture 1.0
+texture 0.500000
+material
+material
+0.500000
+0.500000 anim anim texture 0.500000 anim anim -1
+=
+vertex = 0.500000
+vertex anim frame 0.500000
+0.500000
+vertex bone vertex vertex
+bone bone frame
+= -1
+= 1.0 1.0
+texture
+-1 -1
+frame -1 -1 vertex bone
+0.5000
\ No newline at end of file
@@ -0,0 +1,9 @@
+0.500000 = bone material texture
+= material
+vertex -1
+material vertex material
+texture 1.0 1.0
+anim frame -1 = bone
+=
+= anim
+bone frame bone frame f
\ No newline at end of file
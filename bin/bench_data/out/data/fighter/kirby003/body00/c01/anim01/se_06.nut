@@ -0,0 +1 @@
+3R{	80	{?0훒e-|rȽ,[0kdZ8'0B`s1<F
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 0.500000 = =
+bone anim anim 0.500000 =
+vert
\ No newline at end of file
@@ -0,0 +1,3 @@
+texture
+material bone vertex material = texture 0.500000 frame
+bone 
\ No newline at end of file
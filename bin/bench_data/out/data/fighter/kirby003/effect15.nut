@@ -0,0 +1,12 @@
+= frame
+bone frame vertex frame bone 0.500000 anim vertex 0.500000 material =
+material vertex
+-1
+anim vertex = = vertex -1
+anim
+-1
+bone bone
+= frame frame bone 1.0 texture material texture
+0.500000 -1 = anim
+-1 = anim
+texture -1
@@ -0,0 +1,12 @@
+material material texture bone frame frame anim
+-1
+texture anim texture 1.0 anim
+= = 0.500000 -1 1.0 -1 -1 material 0.500000
+-1 anim texture -1 0.500000 material texture -1
+texture 0.500000 1.0
+= vertex 1.0 1.0 bone bone = anim anim =
+material vertex frame vertex frame
+1.0
+vertex 1.0
+0.500000 vertex frame material
+-1
\ No newline at end of file
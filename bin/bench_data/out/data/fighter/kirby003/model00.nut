@@ -0,0 +1,14 @@
+vertex texture vertex frame = = -1 bone material -1 material
+bone frame material anim material
+=
+= vertex
+1.0 vertex 0.500000 anim vertex
+frame vertex material vertex vertex material
+anim
+texture 1.0 material 0.500000 frame anim anim
+=
+vertex
+frame anim
+frame frame 1.0 -1 1.0 0.500000 0.500000 anim
+-1 1.0 anim frame anim
+anim frame 1.0 0.500000 = anim material material 1.0 bone material texture vertex vertex anim 1.0 mater
\ No newline at end of file
@@ -0,0 +1,16 @@
+texture
+bone 0.500000 frame material
+= 0.500000 anim 1.0 -1
+0.500000 -1 frame bone 1.0
+anim texture
+anim
+1.0 material
+0.500000 -1 anim
+texture -1 1.0 0.500000 bone bone frame material material = texture frame -1 anim
+anim frame texture = bone -1 material anim = =
+material bone frame texture 1.0
+= bone -1 texture 1.0 -1 texture -1 frame texture
+-1 0.500000 bone
+frame
+frame =
+texture vertex bone texture anim 0.500000 frame
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 bone -1
+bone anim = bone
+b
\ No newline at end of file
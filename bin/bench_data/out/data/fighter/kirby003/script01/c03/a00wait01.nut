@@ -0,0 +1 @@
+$a5ia~69vҿ"_4%nB .n4HZ
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture frame vertex 0.500000 = bone
+anim -1 texture
+0.500000
+frame -1
+vertex
+material
+bo
\ No newline at end of file
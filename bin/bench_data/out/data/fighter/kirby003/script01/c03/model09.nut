@@ -0,0 +1,3 @@
+-1 material = 1.0 = texture bone frame vertex bone vertex
+-1 material = -1 vertex texture vertex vertex -1 = = bone vertex material 0.500000 =
+-1 material
\ No newline at end of file
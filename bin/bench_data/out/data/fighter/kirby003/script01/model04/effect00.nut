@@ -0,0 +1,296 @@
+= material material 0.500000 0.500000 frame 0.500000
+1.0 material vertex bone frame bone texture 0.500000 bone frame
+=
+frame
+bone
+texture
+frame 0.500000 frame anim anim -1
+texture frame -1
+texture
+0.500000 bone material
+1.0 material texture
+material bone material
+= bone bone 0.500000
+frame anim bone -1
+vertex = 1.0 texture frame material anim = =
+1.0 -1 = material
+frame anim bone bone 0.500000 bone vertex texture
+= vertex 0.500000 vertex
+anim 0.500000
+anim
+frame anim vertex
+-1
+1.0 bone
+frame
+anim 1.0 frame
+bone bone -1 =
+frame
+texture = -1 bone 1.0 0.500000
+texture -1
+material texture anim
+=
+texture anim = anim bone bone
+material =
+anim frame vertex texture frame = material material -1
+=
+1.0 anim -1 -1 = 1.0 bone frame texture anim -1 material -1 vertex texture frame bone frame vertex bone bone material 1.0 vertex frame
+frame anim 1.0
+0.500000 bone frame anim
+bone material texture vertex vertex 1.0 0.500000 1.0 = vertex vertex anim =
+vertex vertex = -1 = vertex
+-1 vertex bone bone 1.0
+vertex texture
+vertex 1.0 1.0 -1
+frame frame
+=
+0.500000
+= texture 0.500000
+=
+texture -1
+bone = = frame frame
+vertex frame
+1.0
+vertex 0.500000 bone = -1 bone anim -1 vertex vertex texture
+bone frame 0.500000 bone 1.0 vertex vertex material vertex texture anim
+anim
+anim -1 1.0 bone
+anim anim texture 1.0 1.0 frame anim
+anim bone bone material anim
+-1 1.0 texture frame anim material 1.0 vertex anim 1.0 0.500000
+frame texture = anim
+material vertex anim -1
+texture = texture -1 -1 anim anim material material anim material vertex
+bone 0.500000 material anim =
+anim 0.500000
+texture 1.0 1.0 vertex 1.0 vertex
+texture anim bone 0.500000 0.500000 1.0
+anim -1 bone anim =
+-1 frame -1 -1
+0.500000 vertex frame anim 0.500000 1.0 vertex texture material bone frame 0.500000 -1 anim -1 bone anim 1.0 bone material 0.500000 1.0 1.0 = vertex frame
+texture texture
+anim vertex
+texture
+1.0
+0.500000 anim -1 vertex frame
+1.0 texture
+0.500000 = 1.0 =
+-1 anim
+1.0 frame
+material
+= vertex -1
+bone = frame
+texture 1.0 material = -1
+material 0.500000
+-1
+anim
+anim texture frame
+vertex material vertex texture
+vertex 1.0 frame 1.0
+texture 0.500000 -1
+material
+1.0 anim 1.0 0.500000
+-1
+texture
+bone frame
+bone vertex frame frame material texture vertex 0.500000 -1
+frame vertex -1
+vertex material =
+1.0 = = vertex
+texture bone 1.0
+material
+anim bone = vertex vertex bone 0.500000 texture vertex
+= -1 bone vertex frame material
+= 0.500000 frame vertex
+frame
+=
+bone = bone material frame = bone bone anim texture 1.0 material vertex 0.500000 vertex
+vertex =
+anim 0.500000 -1 = -1 frame 0.500000 -1 -1
+-1
+= -1
+material 1.0 texture vertex texture
+-1
+0.500000
+-1 texture
+material vertex bone
+=
+vertex 1.0
+1.0 0.500000
+0.500000 1.0 1.0 anim bone 1.0 =
+texture
+0.500000 0.500000 -1
+1.0
+anim 0.500000 texture
+=
+1.0 material
+-1 frame vertex 1.0 bone bone texture 1.0 material bone
+1.0
+0.500000 frame 0.500000
+= vertex -1 anim texture
+anim frame bone = 1.0 material
+0.500000 texture texture vertex
+= material
+anim material
+-1 -1
+anim
+=
+= 0.500000 0.500000
+= 0.500000 frame texture vertex -1 frame
+1.0 0.500000
+frame vertex
+bone bone frame frame frame texture material material
+frame texture texture
+texture = 1.0 frame material
+frame -1 0.500000 0.500000
+frame
+frame
+0.500000 texture 0.500000
+material frame
+material vertex anim =
+vertex
+material bone 1.0 -1
+0.500000 -1 vertex anim
+0.500000
+1.0
+1.0 0.500000 -1 frame material 1.0 -1 -1
+vertex 0.500000 frame material
+anim 0.500000 = 0.500000 material =
+0.500000 material
+texture anim vertex -1 0.500000 frame frame
+texture
+0.500000 1.0
+bone
+=
+-1 vertex -1
+1.0 -1
+=
+frame vertex texture
+vertex bone = frame bone
+vertex = vertex frame frame frame vertex texture texture
+-1 1.0
+bone
+= vertex bone 1.0 material 0.500000 texture 1.0
+vertex 1.0 frame
+1.0 material
+material texture frame 0.500000
+= 1.0 vertex
+frame = material -1
+0.500000 1.0 bone frame
+anim texture 1.0
+1.0 = = bone frame vertex texture 1.0 1.0 anim frame =
+anim = 1.0 0.500000
+frame 0.500000 anim -1 1.0 -1
+vertex material bone 1.0 bone vertex 0.500000
+material =
+anim texture bone 1.0 vertex 0.500000 1.0 1.0 material anim vertex vertex anim = material -1 -1 -1
+vertex
+-1 0.500000
+material
+anim -1 material -1 0.500000
+vertex 1.0 anim frame
+bone bone frame 1.0
+vertex anim 1.0 anim 1.0 -1 1.0 -1 texture material = texture -1 frame bone
+bone
+0.500000 frame
+-1 material
+vertex anim = material
+bone
+= = 0.500000
+texture
+vertex anim material bone texture = 0.500000 vertex material -1
+bone = 0.500000 texture frame bone vertex frame bone material
+1.0 frame texture 0.500000
+-1 texture = bone
+-1 texture anim
+vertex texture
+= vertex
+texture anim
+0.500000 =
+anim material
+material =
+anim texture frame material texture -1 -1 frame
+1.0 bone vertex -1 1.0
+1.0 frame vertex -1 frame
+material texture 0.500000 anim 1.0 vertex
+vertex vertex 1.0
+vertex 1.0 = = = material
+1.0 texture
+vertex texture =
+=
+= vertex = texture
+1.0 anim 0.500000 -1 material texture material 0.500000 1.0 -1 frame = 1.0 = texture frame vertex = anim
+0.500000
+bone frame 1.0
+bone
+= bone anim
+1.0 material vertex
+= material material material vertex vertex texture material
+vertex material texture
+material vertex frame material vertex
+vertex anim frame 0.500000 -1 0.500000 frame texture anim anim vertex vertex
+-1 1.0 material texture 0.500000 anim = frame
+bone
+texture texture texture 1.0 material anim
+-1 frame
+texture 1.0
+bone
+1.0 frame anim 0.500000
+bone = vertex vertex
+material
+= frame vertex -1 material 1.0
+texture
+0.500000
+texture anim 1.0 = -1 0.500000 texture anim
+0.500000 material bone = bone 1.0
+anim =
+vertex
+frame
+bone = vertex frame -1 anim bone frame material 1.0 frame texture bone
+0.500000 0.500000
+anim = bone bone frame frame texture anim -1
+=
+texture texture
+material -1 material -1
+=
+1.0 vertex texture
+texture vertex
+-1 -1 texture anim 0.500000 0.500000 = texture
+texture frame texture 0.500000 0.500000 frame
+bone anim texture
+bone texture
+0.500000 material -1 material frame anim
+bone
+texture material 0.500000 vertex = = frame = 1.0 material bone
+1.0
+vertex texture 1.0
+material 0.500000
+0.500000
+=
+anim 1.0 1.0 texture
+bone -1
+anim 0.500000 0.500000
+bone -1 frame texture = vertex -1 vertex -1 vertex 0.500000 texture 0.500000 vertex bone
+material texture 0.500000 bone 1.0 material material frame -1 -1
+0.500000 vertex vertex 0.500000 anim material
+= = 0.500000 bone
+1.0 -1 0.500000
+-1
+texture -1 1.0 vertex anim texture =
+0.500000 frame
+1.0 frame anim
+bone 1.0 0.500000
+= bone frame
+material 0.500000 1.0 = texture
+frame bone bone = frame vertex bone
+bone bone -1 0.500000 1.0 1.0 material -1 = vertex = 0.500000
+0.500000 texture -1 vertex anim bone 1.0 1.0 frame frame texture -1
+=
+material texture texture
+frame
+anim
+texture texture frame texture
+1.0 material -1 frame material = = texture -1 material 1.0
+frame =
+texture 0.500000 1.0
+anim -1 1.0 bone 1.0
+anim 1.0 m
\ No newline at end of file
@@ -0,0 +1,174 @@
+1.0 texture = material bone bone frame
+vertex 1.0
+vertex vertex texture bone anim
+material texture material texture texture material vertex 1.0 frame texture 0.500000 -1
+bone frame material anim
+vertex vertex
+frame bone anim
+vertex vertex anim vertex anim vertex
+vertex bone material frame -1 -1
+bone vertex
+anim bone vertex = 0.500000 1.0 -1
+material 0.500000 =
+1.0
+-1 0.500000 material -1 frame
+texture 0.500000 -1 bone bone
+material material frame vertex =
+1.0 anim bone -1 1.0
+0.500000 texture 0.500000 vertex
+1.0
+bone frame bone
+anim
+-1 material texture
+material frame anim texture -1
+bone anim 1.0 = frame
+vertex 0.500000 texture 0.500000 -1 1.0 0.500000
+frame material =
+frame =
+1.0
+1.0
+texture frame 0.500000
+1.0 anim 1.0 vertex =
+texture
+anim -1 anim texture
+texture = bone = bone texture texture texture vertex vertex texture
+= frame
+0.500000 material bone
+material
+-1 texture
+frame texture
+= vertex anim
+=
+1.0 bone
+anim
+vertex vertex vertex 0.500000
+material
+frame -1 -1 vertex material material -1 vertex bone anim texture
+0.500000 frame frame -1 0.500000 0.500000 texture 0.500000
+vertex anim 0.500000 0.500000
+0.500000
+bone texture anim -1 1.0 1.0
+bone 0.500000 texture 1.0 =
+= = -1 0.500000 texture
+bone material anim 0.500000 frame
+material
+bone 1.0 bone material texture anim
+frame
+material
+bone 0.500000 1.0 bone
+0.500000 anim
+material = 0.500000 texture 0.500000 bone -1 anim
+1.0 0.500000
+0.500000 1.0 bone = bone -1 bone frame anim anim anim vertex
+0.500000 vertex
+0.500000 1.0 material anim texture 0.500000 texture anim -1 frame texture frame material frame -1
+0.500000 bone -1 0.500000
+0.500000 anim
+1.0 frame vertex material 1.0 0.500000 material vertex vertex material
+0.500000 texture 1.0
+vertex =
+0.500000 1.0 =
+frame 0.500000 bone -1 material texture bone 0.500000 bone anim
+bone frame bone
+frame
+frame frame -1 0.500000 = -1 -1 -1 material 0.500000 1.0
+frame
+bone anim bone bone vertex bone
+vertex -1 -1 texture texture anim frame texture texture 1.0 0.500000
+frame material
+bone
+0.500000 vertex
+texture frame -1 -1 1.0 anim
+frame
+0.500000
+anim
+0.500000 1.0
+texture bone 0.500000 anim bone
+= -1 0.500000
+bone
+bone -1 0.500000 -1 = 0.500000 anim
+texture
+vertex material material material material 0.500000 material texture = 0.500000 vertex 0.500000 -1 1.0
+vertex 1.0 1.0 frame material 0.500000
+=
+texture 0.500000 = vertex 0.500000 anim
+-1 0.500000 bone 1.0 material bone bone texture = 0.500000
+= -1 0.500000 material material vertex
+frame anim anim = bone 1.0
+-1
+frame -1 = texture bone
+0.500000 texture
+anim
+texture bone vertex material
+=
+vertex -1 material
+-1 material 0.500000 vertex 1.0 vertex bone = texture texture -1 texture
+1.0
+material -1 bone
+1.0 = vertex anim
+texture anim frame 1.0 anim -1 frame
+material 0.500000 1.0 material
+=
+frame 0.500000
+material -1 bone material =
+vertex frame 1.0 = 1.0 -1 texture
+-1 1.0
+-1
+= = -1 material 1.0 anim = = texture 1.0 bone
+bone
+bone texture
+1.0 anim
+-1 1.0 anim bone 1.0 frame
+-1 = 1.0 1.0 -1 material
+texture material -1 frame anim material 0.500000 material frame
+frame =
+vertex
+anim 0.500000 material bone material 1.0 texture bone frame = -1 -1 material
+bone
+material texture
+-1 bone 0.500000 material vertex
+frame frame 0.500000 frame vertex frame
+-1
+texture
+= -1
+=
+anim = vertex
+texture material
+frame vertex -1
+frame texture = 0.500000 -1
+vertex 0.500000 bone texture =
+0.500000
+anim vertex -1 bone anim anim frame
+vertex
+material anim
+texture
+-1
+-1 1.0
+frame -1 bone
+0.500000 = bone
+-1 vertex texture 0.500000
+1.0
+bone 1.0
+vertex =
+texture frame = 1.0 -1 anim 1.0 -1 frame = material = frame
+0.500000
+material
+bone = texture vertex = -1
+vertex frame 1.0
+0.500000 anim 1.0
+= anim = -1
+1.0 0.500000 anim = = frame 0.500000
+= frame -1 frame -1 frame 0.500000 texture vertex
+anim
+bone vertex
+bone vertex frame texture
+-1 texture bone
+anim texture vertex 1.0
+= material anim anim 0.500000
+-1 1.0 vertex frame
+anim vertex texture frame texture 1.0 1.0 frame bone anim 0.500000 vertex vertex
+vertex = vertex
+0.500000
+vertex 1.0 frame -1
+material
+-1
\ No newline at end of file
@@ -0,0 +1,41 @@
+= anim vertex
+frame frame
+1.0 0.500000 vertex 0.500000 bone
+bone bone
+texture
+vertex 1.0 vertex 1.0
+=
+-1 =
+0.500000 0.500000 material bone anim material texture -1 frame 0.500000 texture 1.0 1.0 1.0 bone frame
+texture
+1.0 -1 0.500000
+0.500000 = = = 1.0 bone vertex -1 vertex -1
+1.0 anim anim vertex 0.500000 1.0
+bone
+material -1 frame vertex
+texture anim 0.500000
+1.0 anim
+bone vertex material 0.500000 1.0
+vertex 1.0 = anim = = = 0.500000
+= texture -1 bone = -1 anim bone 1.0 0.500000 frame
+0.500000 = vertex
+bone bone texture
+texture anim anim texture 1.0
+1.0
+texture
+material frame =
+bone bone anim
+1.0
+= = 0.500000 texture -1 material 1.0 material texture material vertex vertex 1.0
+1.0
+anim
+material
+0.500000
+material vertex
+anim anim
+frame -1 material
+=
+anim -1
+texture -1 material vertex -1 1.0
+anim bone = -1 anim material frame
+material vertex ma
\ No newline at end of file
@@ -0,0 +1,206 @@
+bone
+=
+frame
+texture bone = vertex -1
+=
+0.500000
+material material 1.0
+vertex
+anim
+bone anim 1.0 -1 -1
+frame bone 1.0 bone -1 frame anim 1.0 bone frame 1.0 0.500000 bone = material bone 0.500000 frame
+bone = frame
+1.0
+anim material
+= vertex material -1 anim vertex -1 1.0 1.0 texture
+1.0 bone -1
+1.0 0.500000 anim
+frame bone -1 frame vertex 1.0 frame texture 0.500000
+0.500000 =
+-1
+anim
+anim
+texture
+vertex = -1 0.500000 =
+vertex = texture material anim
+material 1.0 vertex
+texture material
+= texture 0.500000 texture 1.0 material anim material vertex
+anim texture anim material 1.0
+anim bone bone material anim anim anim
+-1
+=
+vertex material 0.500000 0.500000 -1
+material bone texture bone 0.500000 frame = 0.500000 vertex 0.500000 1.0
+bone frame bone
+vertex anim bone frame texture 1.0
+vertex
+bone bone 0.500000 1.0 bone texture frame anim material 1.0
+= frame
+vertex material -1 =
+texture 1.0 texture vertex
+= vertex vertex 1.0 material
+material frame anim material 0.500000 texture vertex
+bone
+= material =
+texture 0.500000 1.0 0.500000 0.500000 frame -1 vertex vertex material = 1.0 frame bone -1 frame bone anim texture frame material anim vertex
+anim material vertex 1.0
+material bone
+anim anim
+frame anim
+= 1.0 1.0
+vertex
+anim bone 1.0 texture anim = -1
+vertex vertex
+anim anim = texture
+-1 1.0 anim texture texture =
+anim vertex -1
+material bone
+anim -1 bone anim
+-1 frame vertex
+-1 frame
+-1 bone
+anim
+frame 0.500000 anim
+texture texture
+-1 vertex texture
+= texture vertex vertex -1 texture vertex anim bone
+0.500000
+0.500000
+anim anim bone = -1 vertex material -1 frame bone bone anim -1 1.0
+material anim -1 vertex bone -1 frame
+0.500000 = 1.0
+-1
+-1 0.500000 1.0 1.0
+bone
+= 1.0 bone -1 -1 texture =
+anim
+anim frame vertex
+0.500000 material
+frame
+-1 =
+bone = 0.500000 -1
+frame
+vertex
+vertex anim -1 0.500000 frame material
+= 0.500000 frame texture 1.0 = 0.500000 -1 anim
+anim 1.0 1.0
+0.500000 bone
+1.0 1.0 0.500000 frame 1.0 = texture material
+= vertex -1 texture frame
+bone material frame bone -1 anim material -1 0.500000
+0.500000 1.0
+texture material 0.500000 =
+anim
+-1 material 0.500000 anim
+-1 = anim 0.500000 vertex vertex 1.0 frame frame texture
+-1 = vertex = bone material frame texture
+vertex
+0.500000
+vertex vertex
+material
+texture 0.500000 material frame vertex anim frame bone material -1 -1 texture
+1.0 -1 material = vertex bone anim -1 1.0 vertex anim 0.500000 texture 1.0 vertex
+1.0 frame
+texture
+1.0 vertex
+0.500000 texture vertex 1.0 vertex 0.500000 vertex material -1 anim
+texture
+frame material texture 1.0
+1.0 1.0 = 1.0 bone anim 1.0 frame frame anim
+-1 bone frame frame -1 = 1.0
+0.500000 frame material vertex
+1.0 bone = texture material anim 0.500000 0.500000
+1.0 bone bone 1.0 anim 0.500000 material -1 bone
+bone 0.500000
+1.0 vertex
+1.0 0.500000
+vertex material vertex = texture texture frame = = bone frame = material
+vertex material texture 1.0 = = = -1 anim frame = bone 0.500000 material
+1.0 texture
+material -1 1.0 vertex 1.0
+0.500000 texture texture texture 0.500000 bone anim -1
+material
+material -1 1.0
+0.500000
+anim
+anim
+material bone = bone vertex frame anim 1.0 texture
+anim material anim
+frame bone texture
+-1 frame vertex
+0.500000 1.0 -1 1.0
+material
+bone
+1.0 = vertex 0.500000 texture
+texture -1
+0.500000 vertex frame 1.0 vertex
+0.500000 vertex frame 0.500000 texture -1 anim vertex bone -1 texture frame texture
+material
+frame =
+1.0 frame frame material frame frame vertex material texture frame
+-1 -1
+= frame vertex -1 vertex -1 0.500000 material = material -1
+= texture vertex 1.0 frame frame vertex 1.0 anim bone texture texture -1
+material bone texture bone texture frame material 0.500000 material bone
+= anim frame = 1.0
+frame 0.500000
+anim material vertex 1.0 = 0.500000 1.0 vertex 0.500000 texture
+1.0 0.500000 vertex anim vertex texture 1.0 vertex
+frame bone 0.500000 texture
+= 0.500000 bone vertex 0.500000 texture
+material texture
+1.0
+1.0 1.0 -1 0.500000
+vertex 0.500000
+= material = texture bone = bone -1 frame -1 material 0.500000
+= texture
+= vertex
+frame vertex material anim
+0.500000 texture
+vertex =
+bone 1.0 bone
+-1 anim anim = material vertex
+= frame
+material
+= frame 1.0
+bone
+1.0
+bone bone bone bone anim frame bone
+-1 = 0.500000
+anim texture
+anim texture
+anim anim 0.500000
+material
+material frame material -1 1.0 =
+vertex 1.0 vertex material
+material anim -1 vertex
+0.500000 texture frame frame material 1.0 vertex
+0.500000 texture
+vertex bone
+0.500000 material -1 material frame frame
+vertex
+= 1.0
+vertex bone
+-1 = bone
+texture frame frame bone anim -1 material material 1.0 texture
+vertex bone 1.0 anim
+bone anim bone anim 0.500000 anim bone vertex
+0.500000 vertex -1 frame
+frame
+anim
+vertex
+texture bone texture material frame material 0.500000 material frame texture anim =
+vertex 1.0
+texture
+material
+texture
+bone vertex 1.0 frame
+= material
+=
+material
+-1
+anim vertex vertex texture vertex -1 1.0 anim frame
+texture 1.0 bone = bone texture bone
+anim 1.0 anim anim
+frame material material anim material 0.500000 bone te
\ No newline at end of file
@@ -0,0 +1 @@
+h~h_] v7lnq$dC]+Wjiy4PŹyy04f8Djj?
\ No newline at end of file
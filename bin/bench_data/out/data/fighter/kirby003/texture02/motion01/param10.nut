@@ -0,0 +1,42 @@
+= anim 1.0 1.0 = anim frame texture
+-1 material anim
+bone material = 1.0 1.0
+frame frame texture material texture = =
+-1 1.0 1.0 texture
+bone
+=
+0.500000 -1 0.500000 vertex =
+=
+0.500000 material 1.0 vertex
+anim texture = = texture 1.0 = 1.0 frame
+anim
+= anim 0.500000 1.0
+= -1 vertex 0.500000 -1 texture texture anim
+-1 anim
+material = =
+bone 1.0
+bone frame
+texture anim = 1.0 vertex frame anim 1.0 vertex
+vertex
+bone texture texture
+anim anim frame
+vertex
+-1
+0.500000
+-1 frame -1
+1.0 0.500000 0.500000 texture bone
+=
+texture material texture 1.0 vertex 1.0 frame
+vertex -1 0.500000 0.500000
+anim bone anim =
+0.500000 material anim 1.0
+= 0.500000 texture 0.500000 anim bone material 0.500000 anim material
+-1 vertex
+anim
+1.0 frame
+texture frame vertex = 0.500000 bone material vertex -1 0.500000 -1 bone frame 0.500000 frame = -1 material material vertex material
+anim frame bone = -1 =
+bone
+-1 vertex
+vertex material vertex bone frame 1.0 anim vertex anim vertex = vertex
+texture anim 0.500000 -1 -1 1.0 fr
\ No newline at end of file
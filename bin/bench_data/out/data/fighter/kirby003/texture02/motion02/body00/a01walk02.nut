@@ -0,0 +1,5 @@
+bone
+anim 1.0 vertex
+anim
+anim = -1
+bone texture 1.0
\ No newline at end of file
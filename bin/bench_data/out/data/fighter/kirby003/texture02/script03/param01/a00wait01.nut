@@ -0,0 +1,4 @@
+-1
+-1 anim -1 texture anim texture vertex material = 0.500000 vertex 1.0
+-1 1.0 = 0.500000 bone
+texture
\ No newline at end of file
@@ -0,0 +1,211 @@
+1.0 material
+0.500000 material 1.0 0.500000
+frame bone vertex frame
+1.0
+vertex
+= 0.500000 1.0 material
+0.500000 1.0 =
+-1
+-1 anim bone material material
+texture 1.0
+material bone 0.500000 = 1.0 0.500000 frame anim 1.0
+1.0 1.0 anim texture 0.500000 vertex
+texture -1 vertex 1.0 texture 1.0 vertex vertex -1 -1 = bone 1.0 vertex =
+0.500000
+texture 1.0 0.500000
+-1 vertex texture 1.0 texture -1
+bone 1.0 0.500000 -1 1.0 -1 frame 1.0 frame
+-1
+1.0 -1
+material = 0.500000 = -1 frame material frame material
+vertex 1.0
+material
+=
+texture vertex 1.0 = material 1.0 vertex 1.0 vertex
+1.0 = material texture anim
+vertex -1
+frame -1 vertex anim bone
+frame
+material texture 1.0 0.500000
+0.500000 0.500000 vertex
+vertex
+-1 material 1.0 material -1 1.0 anim
+-1 -1
+anim frame frame 1.0
+frame anim -1
+1.0
+frame -1 = texture vertex
+bone anim
+vertex anim bone 1.0
+vertex 1.0 frame anim
+material
+texture
+vertex vertex frame = 0.500000 0.500000 vertex -1 frame 0.500000 1.0 = anim anim 1.0
+bone
+1.0 1.0
+vertex vertex
+texture material texture material bone
+material bone -1 -1 frame = bone
+-1
+texture 0.500000 bone vertex texture
+anim frame frame vertex anim vertex bone anim texture texture =
+-1 = -1 frame texture 1.0
+vertex 1.0
+frame frame texture anim vertex bone texture texture
+texture = bone
+vertex 1.0 anim 0.500000 bone material 1.0 frame vertex material bone -1 texture
+0.500000
+material =
+=
+=
+0.500000 anim
+texture
+0.500000 bone bone
+material
+texture
+1.0
+bone 0.500000 0.500000
+frame anim anim material =
+vertex
+anim 1.0 anim
+bone 0.500000 anim texture
+material bone bone
+= -1 -1 frame texture -1 = vertex
+=
+bone material anim anim bone vertex 0.500000
+-1
+0.500000 texture 0.500000 texture bone -1 frame vertex bone =
+anim -1
+material
+anim vertex material
+= 0.500000 vertex 1.0 = frame -1 vertex -1 frame = = anim frame anim 1.0 = texture texture bone
+vertex -1 texture -1
+-1 -1 texture vertex texture texture -1 1.0
+texture 1.0 -1 frame 1.0
+frame = 0.500000 vertex anim texture
+bone material vertex
+-1 1.0 0.500000
+0.500000
+material frame -1 vertex bone 1.0 material anim = bone 1.0 frame vertex texture
+bone frame bone 1.0 vertex 1.0 anim -1 material bone 1.0
+material texture
+frame -1 anim anim =
+vertex -1 bone -1 bone
+1.0 = texture frame vertex
+anim
+0.500000 vertex
+material
+=
+=
+bone anim frame bone anim -1 1.0
+bone vertex anim -1 0.500000
+frame 1.0 texture 1.0
+texture
+material
+texture = frame bone texture material frame vertex
+anim
+frame bone 1.0
+anim
+vertex
+bone = anim
+0.500000 vertex
+material material -1 vertex 0.500000 vertex 0.500000 = 0.500000 bone 1.0
+material vertex material
+texture anim anim anim 1.0 texture -1
+= -1
+= -1 -1 0.500000 frame = bone material -1 1.0 anim frame texture vertex 1.0 frame texture
+0.500000
+texture 0.500000
+1.0 texture = bone texture vertex bone anim -1
+-1 = 1.0
+bone 1.0 anim 1.0
+0.500000 = anim
+frame 0.500000
+0.500000
+vertex anim
+anim
+1.0
+frame 1.0
+texture bone bone frame bone 1.0 1.0
+bone anim =
+anim
+bone
+1.0
+0.500000 = 0.500000
+vertex
+texture anim 1.0 0.500000 1.0 anim frame = frame
+-1
+anim anim anim =
+vertex bone =
+frame
+anim anim anim vertex
+material -1 0.500000
+-1 bone
+0.500000 frame
+vertex frame texture material material = material 0.500000 vertex
+1.0 -1 -1 =
+bone anim
+vertex -1 material texture frame
+vertex 1.0 -1 anim frame
+vertex bone = 0.500000 1.0 anim frame material
+texture frame -1 = frame 0.500000
+= = frame
+vertex frame
+= anim 0.500000 texture 1.0
+material = frame
+1.0 = material =
+texture frame -1 texture 0.500000 1.0 texture texture texture
+texture
+0.500000
+material material material = -1
+0.500000
+frame texture = material -1 bone bone
+material
+bone anim 1.0 vertex frame 0.500000
+texture -1
+frame frame
+material 0.500000 texture 1.0 bone vertex
+= 1.0
+anim
+1.0 anim frame
+= = = = 1.0 anim material frame
+0.500000 bone
+-1 0.500000
+texture bone anim
+0.500000 0.500000
+bone =
+anim 0.500000 bone 0.500000 bone = material 0.500000 -1 bone material material
+-1 1.0 vertex 0.500000 1.0
+1.0 vertex 1.0 bone anim
+texture material
+vertex frame -1 1.0
+= anim 0.500000 frame material
+material vertex = texture 1.0
+1.0 1.0
+= texture material frame texture vertex vertex anim 1.0 -1 texture bone bone
+anim 0.500000 texture frame
+vertex 0.500000 -1 material anim vertex = vertex -1 = 1.0 -1
+-1
+-1 bone 1.0 bone bone = -1 bone -1 anim = material anim -1 0.500000 anim -1 texture material frame bone
+material 1.0
+frame
+1.0 frame 1.0 1.0 anim = -1 material material
+bone
+bone
+1.0
+texture
+1.0
+material
+vertex frame 1.0 frame vertex 0.500000 vertex texture
+1.0 vertex 0.500000 bone bone vertex
+vertex 1.0 1.0 texture frame
+frame material vertex -1
+vertex vertex
+-1
+0.500000 texture
+vertex
+material anim 0.500000 bone bone 1.0 anim
+texture frame
+material anim frame
+vertex anim -1
+bone = frame = = = frame = bone texture material mat
\ No newline at end of file
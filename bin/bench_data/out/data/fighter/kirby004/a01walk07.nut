@@ -0,0 +1,2 @@
+= anim anim = vertex frame frame material
+v
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1
+-1
+texture vertex anim
+-1 vertex vertex mat
\ No newline at end of file
@@ -0,0 +1,134 @@
+0.500000 -1 -1 -1 bone = anim
+= = 0.500000 0.500000 = -1 texture
+= frame 1.0
+0.500000 material 0.500000 vertex anim 1.0 =
+vertex 1.0 frame vertex = bone bone material material
+frame
+1.0 bone
+frame 0.500000 frame
+texture material texture = -1 vertex 1.0 texture
+= texture 0.500000 bone 1.0 anim frame material 1.0 texture anim =
+0.500000 0.500000 texture
+1.0 anim material frame -1 anim texture = anim bone material
+texture
+= bone
+-1 frame
+bone
+0.500000 0.500000
+frame
+1.0 bone frame anim texture
+vertex -1 vertex
+1.0 bone 1.0
+texture bone material 1.0 texture 1.0 -1 bone 1.0 0.500000 =
+material texture
+bone anim vertex
+frame
+texture texture
+= anim material -1 1.0 frame vertex vertex material = texture = =
+-1 -1 -1 0.500000 vertex 0.500000 bone frame -1
+1.0 frame = anim material material
+=
+1.0
+material vertex bone bone frame 0.500000 -1 vertex bone -1 1.0 material anim anim anim
+texture vertex 1.0 bone
+material frame
+0.500000 vertex bone frame = frame =
+1.0 anim
+bone 1.0 -1 anim
+bone 0.500000 bone = = frame vertex
+frame -1 vertex
+vertex = 0.500000 0.500000 = 0.500000
+-1 frame anim bone
+=
+0.500000 bone = -1 anim texture
+anim
+material material texture
+anim anim texture = = bone anim =
+texture
+material
+= texture -1 anim texture texture 1.0
+bone
+vertex
+vertex material texture vertex 0.500000 bone 1.0
+1.0 frame material frame -1 material
+bone 0.500000
+bone anim
+anim -1
+vertex anim
+= 0.500000
+= anim
+texture
+frame -1 = 0.500000 vertex = 1.0 bone 1.0 texture frame 0.500000 bone material
+=
+1.0
+vertex vertex anim vertex frame bone vertex 1.0 -1 = material -1 1.0 1.0 bone 0.500000 material texture frame 1.0 vertex material
+bone bone frame
+anim
+anim
+= 0.500000 -1
+material 1.0
+material
+anim -1 vertex
+-1
+-1 -1 vertex 1.0 frame
+material 0.500000 anim frame = material -1 -1 material bone bone frame 1.0 anim
+vertex vertex texture bone bone 0.500000 texture anim bone vertex
+material
+1.0 anim 0.500000 -1
+-1
+anim 0.500000 = = material
+= 1.0 material bone texture = texture texture
+1.0 texture frame
+material 1.0 1.0
+bone texture texture texture anim anim
+texture frame frame vertex bone vertex
+bone vertex -1 material -1
+= -1
+frame material =
+1.0
+vertex vertex =
+bone
+material bone material
+anim = bone
+1.0 =
+bone
+0.500000 -1
+= 1.0
+= frame frame anim bone bone 1.0 frame
+-1 material bone
+material bone anim vertex material
+material
+0.500000 anim material 1.0 frame
+= vertex = material 0.500000 = 0.500000 texture -1 anim texture
+frame anim 1.0
+bone
+-1 frame anim vertex anim 0.500000
+-1
+1.0 anim =
+material
+frame bone anim material frame bone = frame
+frame bone
+-1 1.0 material -1 -1 vertex texture texture anim
+= frame texture bone = vertex
+material
+texture
+-1 material material anim = 1.0 1.0
+vertex vertex = frame vertex
+1.0
+= 1.0 bone
+texture -1 frame vertex 1.0
+texture vertex = material vertex
+1.0 frame
+bone material bone texture vertex anim texture 0.500000 0.500000 texture -1 material material
+=
+0.500000 anim frame 0.500000
+1.0 1.0 vertex bone = 0.500000 -1 0.500000 =
+frame
+bone texture
+-1 vertex
+material 1.0 0.500000 = vertex anim
+texture anim vertex 0.500000 anim -1 frame
+1.0 texture texture -1 = frame 1.0 -1 vertex texture material
+= bone
+1.0 1.0 1.0 frame
+texture frame 
\ No newline at end of file
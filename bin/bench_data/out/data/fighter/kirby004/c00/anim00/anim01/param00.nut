@@ -0,0 +1,17 @@
+vertex vertex frame -1 1.0
+frame 1.0 anim -1 vertex 0.500000
+material material -1 -1 0.500000 = = material
+=
+1.0 material material
+material texture vertex =
+bone = 1.0 =
+1.0 bone frame
+-1 1.0
+-1 vertex
+texture 1.0 texture
+frame material
+anim
+vertex
+-1 bone 0.500000 frame texture frame anim
+-1
+anim 0.5
\ No newline at end of file
@@ -0,0 +1,49 @@
+bone texture anim anim anim bone anim
+texture texture texture
+bone
+anim 1.0 0.500000 texture
+= material 0.500000
+-1 vertex
+frame
+vertex bone anim
+material texture -1 texture
+bone vertex material frame
+material
+0.500000 0.500000
+1.0 0.500000 0.500000
+material texture = 1.0 frame
+frame anim material frame = bone anim bone
+material
+1.0 vertex -1 = 1.0 1.0
+texture anim -1 vertex frame
+vertex 0.500000 vertex
+texture anim texture
+bone
+texture
+vertex
+material texture frame 0.500000
+1.0 anim
+= anim 1.0
+0.500000 bone texture bone
+material 1.0
+bone = frame texture -1
+=
+frame
+texture bone
+bone texture
+-1
+vertex bone texture vertex 1.0 bone anim = frame frame -1 -1 1.0
+bone
+anim = texture material bone anim frame 0.500000 1.0 -1 anim material 1.0 vertex
+1.0
+=
+1.0 0.500000 0.500000 1.0 texture
+vertex material frame
+-1 texture
+vertex -1 material frame anim 0.500000 vertex anim material
+material 0.500000 = =
+material
+anim = = anim vertex 0.500000 material frame texture
+0.500000 anim bone = material vertex
+0.500000
+-1 anim vertex -1 = fra
\ No newline at end of file
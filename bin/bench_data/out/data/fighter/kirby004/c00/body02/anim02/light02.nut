@@ -0,0 +1,20 @@
+frame 0.500000 -1
+texture
+0.500000 anim 1.0 frame texture = 1.0 = vertex frame = -1 vertex texture material texture texture frame -1 vertex frame = 1.0 anim
+1.0 frame
+anim material
+vertex anim 1.0 material
+frame anim 1.0
+anim
+= material
+vertex = = 1.0 = anim texture material vertex 0.500000
+0.500000 material
+frame -1 texture
+texture frame -1 frame texture
+anim vertex -1 anim frame material texture frame vertex frame -1 anim
+bone -1
+frame 0.500000 texture texture 1.0 -1 texture -1 texture = material frame 1.0 material
+vertex vertex frame frame
+anim 0.500000 0.500000
+1.0 frame vertex = frame = material texture =
+anim 0.500
\ No newline at end of file
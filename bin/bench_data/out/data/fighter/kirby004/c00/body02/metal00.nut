@@ -0,0 +1,11 @@
+material texture material texture
+1.0
+-1
+material bone 1.0 texture material vertex frame
+-1 texture frame material vertex
+material material texture texture
+vertex material
+-1 anim
+-1 anim
+anim texture
+bone 0.500000 frame = frame -1 material
@@ -0,0 +1,5 @@
+vertex material vertex
+bone 1.0 -1 0.500000
+texture material -1 1.0 anim frame material material
+texture texture 1.0 = frame
+textu
\ No newline at end of file
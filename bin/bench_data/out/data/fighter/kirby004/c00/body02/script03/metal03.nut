@@ -0,0 +1,48 @@
+= = texture frame = bone = 0.500000 frame 0.500000 material
+-1 material texture
+material
+bone
+vertex anim 0.500000
+frame bone material bone
+anim
+frame
+material
+anim 1.0 frame texture bone vertex
+= = material vertex 1.0
+texture
+1.0 anim = anim 1.0 0.500000 vertex frame material frame
+= texture = 0.500000 material vertex 0.500000
+texture 0.500000 vertex
+0.500000 0.500000 vertex frame anim frame material
+frame
+anim texture -1 material
+1.0 texture -1
+texture
+vertex
+= 0.500000 1.0
+-1
+-1
+vertex bone bone 1.0 0.500000
+0.500000 vertex anim 0.500000 bone frame texture vertex
+1.0 -1
+vertex
+= -1 = texture = texture bone
+=
+= texture bone -1
+frame texture
+0.500000 -1 1.0 vertex = material 0.500000 1.0
+texture bone
+= anim
+= texture
+bone texture vertex 1.0
+frame anim
+texture bone bone 1.0 =
+-1 frame texture
+-1 -1 1.0 0.500000 frame
+frame texture texture
+= 1.0 anim -1
+0.500000
+1.0
+1.0 texture bone
+texture bone -1
+= texture 0.500000 anim vertex vertex t
\ No newline at end of file
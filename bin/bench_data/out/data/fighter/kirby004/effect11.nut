@@ -0,0 +1,13 @@
+0.500000 0.500000
+material
+-1 texture -1
+-1 1.0 1.0
+frame bone texture material material 1.0 vertex
+bone frame 0.500000 1.0 1.0
+texture texture anim
+material 1.0 1.0
+0.500000 vertex anim
+frame
+bone 1.0
+= frame texture
+vertex vertex anim 0.500000 anim 0.500000 
\ No newline at end of file
@@ -0,0 +1 @@
+texture bone material -1 = texture anim -1
\ No newline at end of file
@@ -0,0 +1,134 @@
+bone bone
+vertex 1.0 = -1 material 1.0 anim bone
+texture
+frame frame 1.0 0.500000 material vertex texture 1.0 -1 -1
+frame frame = frame 1.0 bone = material texture texture
+1.0 -1
+vertex material bone texture
+1.0 material
+0.500000 -1 bone frame material vertex bone = =
+texture material vertex vertex vertex anim
+bone material
+-1 frame = bone
+bone 0.500000 vertex
+-1 vertex frame
+material
+vertex
+anim -1
+= frame texture vertex frame 0.500000
+1.0 = texture bone bone
+bone
+texture = material bone 1.0 bone bone frame
+material 1.0 -1 frame anim
+bone 1.0 texture -1 vertex 0.500000
+bone -1 -1 vertex vertex frame
+material texture bone material
+anim -1 -1 vertex anim material
+material material 1.0 bone 1.0 frame anim vertex frame bone texture anim 0.500000
+texture
+bone
+1.0 1.0 -1 anim material 0.500000 = texture
+1.0 0.500000
+0.500000
+= anim
+=
+texture
+anim frame anim material vertex bone vertex bone anim -1
+0.500000 0.500000
+texture 0.500000
+anim = frame material = = bone frame bone texture = -1 frame
+= = = -1
+texture 1.0 material
+-1 -1 material
+0.500000 -1 0.500000 1.0 -1 -1
+material
+0.500000
+material
+frame vertex frame bone anim -1
+frame material vertex
+1.0 1.0 texture = 0.500000
+0.500000 anim 1.0 texture 1.0 = material -1 vertex 1.0 =
+material anim frame texture bone
+-1 vertex 0.500000 0.500000 bone bone 1.0 anim =
+texture texture frame
+0.500000 1.0 bone texture 0.500000 material
+frame vertex 0.500000 -1 anim = bone
+1.0
+0.500000 1.0
+-1 1.0 frame bone 0.500000 frame
+vertex 1.0 = bone vertex frame vertex anim 1.0 bone 0.500000 bone
+material material
+0.500000
+= 1.0 material bone material -1 = -1 texture -1 0.500000 0.500000
+material vertex material
+material = frame 1.0 anim = anim 1.0 1.0 0.500000
+vertex
+frame frame
+material 0.500000 0.500000
+bone texture frame
+anim
+-1 texture 1.0 = -1 bone -1
+bone
+bone bone 1.0 anim vertex vertex bone
+texture 0.500000
+vertex 1.0
+-1 anim
+anim
+-1
+frame material anim
+-1 texture
+1.0 vertex vertex vertex frame bone texture vertex anim texture =
+frame
+-1 = bone frame 0.500000
+material = texture texture -1 vertex vertex frame vertex -1
+anim vertex = material 0.500000 texture anim frame 0.500000 -1 material =
+vertex
+bone
+= 0.500000 texture anim
+0.500000 frame
+0.500000 frame bone
+material frame
+anim vertex
+anim material -1 1.0 0.500000 bone 1.0 vertex
+= vertex anim texture texture anim vertex
+vertex -1 0.500000 anim 1.0
+1.0 -1 = texture -1 -1 material frame 0.500000 texture vertex bone anim
+= 0.500000 texture bone
+material 1.0
+anim
+anim vertex -1 frame texture vertex anim -1
+bone vertex bone 0.500000 anim =
+anim material material bone
+-1
+anim = -1
+anim
+1.0 1.0 anim
+texture material
+vertex
+texture anim 0.500000 bone
+anim vertex
+texture
+1.0
+-1 anim 1.0 material = frame frame 0.500000 material
+-1 texture
+1.0 material
+1.0 texture frame
+texture vertex -1 texture bone bone anim 1.0 vertex
+vertex bone anim = vertex vertex -1 -1
+anim material vertex vertex vertex
+anim
+frame frame material
+1.0 0.500000 anim bone
+bone material bone material material 1.0
+frame = material frame 0.500000 0.500000 -1 material 1.0 vertex
+frame anim
+= bone 1.0
+vertex
+material 1.0 bone -1
+texture anim texture frame anim
+frame frame texture texture vertex frame -1 0.500000
+anim = -1 texture anim
+bone bone texture bone material bone
+frame
+material frame material = anim
+bone 1.0 bone vertex bone frame frame texture 0.500
\ No newline at end of file
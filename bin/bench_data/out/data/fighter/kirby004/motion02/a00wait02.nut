@@ -0,0 +1,71 @@
+material bone
+0.500000 anim 1.0 material
+material bone
+frame texture
+1.0 1.0 anim anim material material bone vertex vertex 1.0 -1 vertex bone -1 = bone frame frame
+1.0 -1 = vertex -1 bone material -1 material anim vertex
+material vertex anim
+vertex
+= anim
+anim 0.500000 frame
+bone frame
+0.500000 vertex bone anim
+texture
+vertex
+frame
+vertex frame anim 0.500000 texture vertex material vertex = 0.500000 texture texture texture vertex
+anim
+= 1.0
+bone -1 vertex = =
+1.0 anim -1 anim frame texture texture
+bone = vertex bone texture material = texture texture
+= 0.500000 frame -1
+vertex =
+anim 1.0 texture frame anim = 1.0 = texture vertex 1.0
+= texture anim
+anim bone texture
+-1
+vertex 1.0 1.0
+vertex 0.500000
+vertex vertex
+frame anim 1.0 =
+bone
+= anim 0.500000 0.500000 material
+frame 0.500000 1.0 texture anim
+0.500000 bone
+= frame anim
+vertex
+vertex
+anim material texture = -1
+0.500000 anim 1.0
+bone
+0.500000
+-1 -1
+frame 0.500000
+texture frame 1.0 bone 1.0
+vertex
+=
+texture =
+= frame -1 -1 texture 1.0
+texture =
+frame 1.0 vertex =
+1.0 vertex -1 anim 0.500000 -1 anim texture -1 bone = frame
+anim
+0.500000 = 0.500000
+1.0 texture texture vertex material frame
+material bone anim
+material
+bone bone 0.500000 -1 0.500000 = bone vertex texture
+texture
+1.0
+frame texture vertex 0.500000 -1
+= -1 frame = 0.500000 vertex -1
+-1 material
+frame bone vertex frame -1 material texture material material
+1.0 0.500000 1.0 0.500000 0.500000
+material material 1.0 1.0
+-1 bone 0.500000 texture 1.0 vertex texture
+anim frame 0.500000 vertex vertex 1.0
+frame material
+material vertex
+vertex 0.500000 texture 0.500000 anim material vertex material -1 = 
\ No newline at end of file
@@ -0,0 +1,21 @@
+anim frame texture material
+bone
+vertex frame vertex
+texture frame vertex bone 0.500000 frame vertex =
+= material
+bone
+anim 1.0
+-1
+texture material
+= = vertex material material 1.0 vertex = texture -1
+frame 0.500000 1.0
+anim vertex bone anim frame bone material frame = texture texture anim frame = = anim 1.0 frame
+material
+1.0 frame texture texture
+material -1 material bone 1.0 = material anim vertex -1 material material
+texture =
+anim
+-1 anim
+texture
+bone texture vertex material -1 material frame
+texture -1 texture frame -1 vertex 1.0 anim vertex bone ma
\ No newline at end of file
@@ -0,0 +1,47 @@
+frame anim
+1.0 = -1
+anim -1 material
+0.500000
+vertex
+material -1 anim vertex bone 0.500000 frame material
+frame = 0.500000 frame
+frame 1.0 -1
+-1 vertex = -1 bone
+1.0 material vertex 1.0
+anim bone bone
+0.500000 =
+= 1.0 = 1.0
+texture
+material material anim frame
+texture anim 0.500000 vertex = texture =
+material texture bone
+texture = 0.500000 material material
+texture texture texture 1.0
+vertex 0.500000 -1
+material material 1.0 material
+material vertex anim
+bone bone 0.500000 -1 0.500000
+0.500000 anim
+= 0.500000 frame anim
+1.0 anim anim
+texture bone
+anim material = material = anim =
+bone
+0.500000 bone
+bone bone
+material
+frame material -1 vertex
+anim
+vertex material anim 0.500000 -1 vertex = 0.500000
+= vertex texture 0.500000 bone = -1 frame bone 1.0 frame
+=
+frame 0.500000 anim = 1.0 vertex
+= texture frame 1.0 0.500000 anim anim
+frame
+texture
+1.0 frame frame texture
+-1 -1 texture 1.0
+vertex 0.500000 vertex material texture material
+material 1.0
+material vertex
+anim vertex = vertex 1.0 anim material texture mat
\ No newline at end of file
@@ -0,0 +1,192 @@
+bone frame =
+vertex
+material texture material frame frame = = 1.0 texture 0.500000 bone bone vertex material anim -1 1.0 texture
+bone material 1.0 0.500000
+0.500000 vertex 1.0 vertex 0.500000 bone vertex = -1 frame vertex
+-1 material 1.0 material 1.0
+-1 vertex 0.500000 vertex -1
+anim -1 anim -1 0.500000 texture 0.500000 vertex frame texture anim
+anim vertex frame bone -1 frame
+texture
+1.0
+material texture 1.0 -1 0.500000 texture vertex frame material 1.0 0.500000
+bone 0.500000
+= anim -1
+frame texture anim 1.0 0.500000 0.500000
+bone 1.0
+= 0.500000 = material
+frame material material texture 0.500000 texture
+texture frame frame = anim anim texture
+frame frame -1 material 0.500000 frame
+bone bone =
+texture vertex 0.500000 material -1 texture
+-1 texture vertex bone anim vertex
+= bone
+texture texture 0.500000 texture -1 frame 0.500000 bone vertex
+material frame
+0.500000 frame texture = -1
+vertex 1.0 bone texture anim bone material
+= bone
+anim -1
+vertex bone = 1.0 frame material texture texture 0.500000 vertex frame 0.500000 0.500000 = frame 1.0
+texture = -1 material
+texture -1 -1 texture
+texture = material frame vertex
+anim 0.500000 material 1.0 material material 0.500000 anim anim
+0.500000 vertex vertex 1.0
+frame
+frame
+vertex 0.500000 bone
+bone texture 1.0 -1 vertex 1.0 material = texture material texture frame material texture
+frame texture 0.500000 -1 1.0 anim 1.0
+-1 vertex
+material 1.0 material anim
+frame bone
+frame anim 1.0 material anim texture
+frame -1 bone material
+0.500000 0.500000
+0.500000 -1 0.500000 anim vertex bone 0.500000 frame anim
+1.0
+1.0 anim 1.0 material anim
+=
+frame -1 vertex
+frame
+0.500000 frame -1 vertex anim material
+anim = 0.500000 vertex frame bone anim material frame vertex = frame vertex material vertex
+vertex bone material anim material =
+1.0
+1.0
+bone vertex material 1.0 vertex material
+frame 1.0 0.500000 material material material vertex frame material
+anim material 0.500000 anim texture
+=
+1.0 material bone 1.0
+vertex
+1.0 =
+texture 0.500000 -1
+vertex frame -1
+material anim 0.500000
+frame
+vertex
+-1 frame anim
+0.500000
+anim 1.0 -1 -1 texture = frame 0.500000 texture vertex bone anim
+-1
+frame -1 1.0 1.0
+anim = material anim 1.0 vertex frame bone
+0.500000 = vertex vertex
+= 1.0 vertex anim
+bone
+vertex 1.0 texture
+texture -1 -1
+texture texture
+texture texture 1.0 bone anim vertex bone
+0.500000 anim material -1 texture anim bone
+bone
+= 0.500000 1.0 1.0 frame
+-1 frame
+=
+1.0 0.500000
+0.500000
+frame bone texture 1.0 frame 0.500000
+1.0 -1 -1
+anim
+1.0
+vertex anim 1.0
+0.500000 vertex
+frame
+-1 bone texture
+1.0
+anim vertex anim
+bone -1 1.0 bone
+texture bone
+texture frame frame
+material frame material vertex frame texture 0.500000
+texture
+0.500000 anim 1.0 = frame
+bone frame =
+anim -1 frame frame 0.500000 1.0
+0.500000 = bone material -1 anim
+frame texture bone
+bone
+=
+texture bone
+anim material material vertex 1.0
+1.0
+texture texture
+vertex vertex 1.0 texture bone anim
+= 0.500000 frame vertex material -1 frame 0.500000 anim vertex 1.0 0.500000 texture texture anim bone
+frame bone texture -1 texture
+vertex 1.0 texture
+material vertex -1
+vertex
+material 1.0 texture =
+texture frame texture anim bone material bone vertex -1 -1
+1.0 1.0
+vertex
+anim frame
+1.0
+frame -1 bone
+anim 0.500000 bone
+= anim
+anim
+0.500000
+vertex frame -1
+texture vertex frame
+-1 0.500000 -1 vertex 0.500000 -1 0.500000 0.500000 frame bone
+vertex -1
+frame bone material vertex vertex vertex vertex
+vertex
+material anim
+0.500000 material anim material 0.500000 material 1.0 0.500000 1.0
+frame
+frame bone texture anim anim = frame texture -1 material anim material = 0.500000 texture bone
+1.0 anim
+= texture
+frame
+=
+bone texture vertex
+anim
+-1 0.500000
+= = 1.0 = anim 1.0 -1 = =
+-1 anim
+material frame frame 0.500000 material texture material texture -1 = bone frame material texture =
+material bone =
+material
+= bone 0.500000
+-1 1.0 bone
+frame texture -1 0.500000
+0.500000 material = material bone frame 1.0 -1
+0.500000 = -1 bone = frame vertex frame -1 -1 frame anim -1 0.500000 -1
+vertex 1.0 bone -1 texture
+-1
+vertex
+vertex
+texture material vertex anim vertex -1 bone = =
+0.500000 bone material frame 1.0
+frame
+0.500000 -1 1.0 vertex
+frame texture 0.500000 1.0 = vertex -1 0.500000 vertex frame 0.500000
+0.500000 frame 0.500000 frame 0.500000 material
+=
+=
+=
+material -1
+texture material material bone 0.500000
+bone
+texture -1 texture 1.0
+vertex -1
+anim 1.0 -1
+frame
+-1
+0.500000 frame
+vertex 0.500000 = material
+= = = texture anim
+material vertex -1 frame material = 1.0 frame
+bone vertex -1 frame 1.0 anim
+1.0 vertex
+vertex
+= texture anim frame bone 1.0
+= 0.500000
+material bone
+bon
\ No newline at end of file
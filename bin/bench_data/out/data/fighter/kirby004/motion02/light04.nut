@@ -0,0 +1,33 @@
+-1 = texture = texture frame vertex
+0.500000
+1.0 -1 material -1 1.0
+frame 0.500000 material frame
+1.0 material
+texture vertex bone texture -1 vertex
+-1 = 0.500000 material = 1.0 vertex material =
+vertex bone 1.0 frame
+vertex = bone
+-1 vertex
+1.0 bone material texture vertex 1.0 -1 = 1.0 -1 bone texture 1.0 frame
+texture
+frame 0.500000 material 0.500000
+0.500000
+0.500000 anim texture anim texture vertex material
+1.0 0.500000 -1 1.0 0.500000
+material 0.500000
+-1 = vertex bone anim bone
+1.0 -1 texture bone bone bone anim = 0.500000 1.0 bone vertex material
+anim texture 0.500000 frame texture
+-1
+texture = -1 material 1.0 frame
+material
+material 0.500000
+texture
+material
+-1 texture = = bone -1
+vertex frame texture 0.500000 texture material
+texture -1 -1 -1 1.0 texture bone 1.0 = bone -1 vertex =
+0.500000 material anim material
+vertex vertex
+texture = -1 frame texture texture material -1 1.0 texture frame vertex material
+0.500000 -1 vertex bone material vertex bone 0.500000 1.0
\ No newline at end of file
@@ -0,0 +1,6 @@
+1.0
+texture 0.500000 frame texture = vertex 1.0 1.0 = = 1.0 1.0
+texture
+bone anim bone 0.500000
+0.500000
+vertex frame
\ No newline at end of file
@@ -0,0 +1,14 @@
+bone = frame frame
+= 1.0 texture = -1
+1.0 material
+material 0.500000 texture bone frame 0.500000 vertex bone
+1.0 0.500000 frame bone
+-1 -1 0.500000 =
+frame -1
+bone
+1.0 material
+frame frame
+frame -1 frame frame
+vertex bone anim frame -1 1.0 1.0 0.500000
+1.0
+frame = texture bone 0.500000 b
\ No newline at end of file
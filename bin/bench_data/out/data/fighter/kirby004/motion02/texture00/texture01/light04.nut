@@ -0,0 +1,4 @@
+anim -1 anim
+bone anim -1 texture vertex
+vertex bone material material bone -1 frame 1.0 bone
+-1 bone anim = =
\ No newline at end of file
@@ -0,0 +1,11 @@
+anim material
+texture =
+0.500000
+frame -1 vertex vertex bone = 0.500000 frame
+1.0 vertex
+bone material
+vertex texture
+anim material texture 0.500000 texture
+frame 0.500000
+0.500000 = 1.0 0.500000 -1 anim -1
+1.0 
\ No newline at end of file
@@ -0,0 +1,6 @@
+bone vertex 1.0 1.0 anim frame frame
+anim 1.0 -1 -1 1.0 frame = = 0.500000 1.0 material texture 0.500000 1.0
+bone -1
+1.0 frame = bone
+= 1.0 0.500000
+a
\ No newline at end of file
@@ -0,0 +1,3 @@
+texture material =
+frame
+material t
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000
+bone frame frame 0.500000 1.0
+anim anim texture -1 = frame anim 1.0
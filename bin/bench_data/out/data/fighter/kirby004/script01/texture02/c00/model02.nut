@@ -0,0 +1,158 @@
+-1
+-1
+0.500000 0.500000 material 0.500000 1.0 0.500000 bone frame anim
+1.0 -1
+frame anim
+frame
+bone = -1 = bone material material material
+= 0.500000 frame vertex texture -1
+vertex vertex
+frame 0.500000 0.500000
+-1 texture 0.500000 0.500000
+anim vertex
+vertex
+-1
+frame
+vertex bone material anim
+bone vertex vertex anim bone bone
+anim texture 1.0
+material vertex
+0.500000 anim anim frame vertex vertex anim 0.500000 -1
+material 1.0 texture frame =
+0.500000 anim material 1.0
+vertex -1
+-1
+anim anim = texture 0.500000 1.0
+1.0 material anim
+frame
+bone -1
+=
+1.0 0.500000 vertex anim 1.0
+0.500000 bone
+anim
+texture
+material bone
+= material 0.500000 anim 1.0 =
+-1 1.0 1.0 -1 texture vertex anim
+frame =
+0.500000 texture 1.0 0.500000 vertex -1 frame
+frame frame material frame vertex 0.500000 0.500000
+anim -1 0.500000 material vertex 0.500000
+texture = vertex
+-1 0.500000 frame material
+frame vertex -1 1.0
+= 1.0 1.0 -1 bone 1.0
+material
+0.500000 anim
+1.0 -1 vertex 0.500000 = 0.500000 anim frame =
+-1 =
+vertex
+= 0.500000
+material material bone
+bone = 0.500000 material
+texture
+-1 0.500000 frame texture bone material
+-1 texture 0.500000
+frame
+1.0
+= -1 texture anim =
+vertex = vertex vertex vertex -1
+bone frame material
+-1 vertex =
+material
+1.0 1.0 vertex 1.0 vertex texture -1
+vertex
+vertex 0.500000 = -1 texture
+material material = anim frame
+frame vertex 1.0
+1.0 1.0 frame = vertex material 1.0 vertex material = material vertex -1 1.0
+0.500000 1.0 texture
+-1
+1.0 frame -1 = bone = material
+material bone frame 1.0 = 0.500000 texture -1 -1 texture = 1.0
+bone anim anim
+frame bone
+-1 material
+material
+0.500000
+anim
+0.500000 bone material texture
+1.0
+0.500000
+frame
+bone texture
+vertex material
+= bone 0.500000 anim texture anim
+-1 vertex vertex frame
+anim anim
+0.500000 = anim bone texture
+1.0 =
+texture frame 1.0 material = -1
+texture -1 = bone
+= -1 frame frame material -1 bone material 0.500000 material frame frame
+anim -1
+0.500000 1.0 = 1.0 bone
+vertex anim anim vertex 1.0 vertex bone vertex 1.0
+material vertex
+anim 0.500000 anim -1 material = vertex material
+= -1 frame bone 0.500000 0.500000 0.500000
+frame
+texture
+texture
+texture 0.500000
+frame
+= anim 1.0 =
+= bone bone texture = frame bone
+1.0 anim 1.0
+0.500000
+= frame
+= frame material vertex frame bone -1 bone frame 1.0 -1 0.500000 frame bone bone vertex vertex
+anim bone anim
+frame
+bone 0.500000 0.500000 0.500000 anim
+-1
+1.0 0.500000 anim
+material -1
+bone 1.0
+= -1 bone
+frame frame anim texture vertex anim 1.0 texture anim
+frame 1.0 =
+frame vertex bone =
+bone bone frame
+bone
+frame
+= material
+-1 -1 bone texture -1 bone vertex texture bone texture bone frame material texture -1
+frame
+material anim frame
+texture vertex = -1 0.500000
+1.0 1.0
+material vertex -1 0.500000 frame texture 1.0 1.0 anim -1 anim
+0.500000 1.0 -1 vertex anim -1 vertex
+anim texture
+material 0.500000 texture -1 frame
+texture bone
+material 0.500000 0.500000 -1 material vertex
+material
+vertex bone vertex frame 1.0
+bone material texture
+bone 1.0
+1.0
+vertex anim =
+bone
+texture -1 -1 vertex
+vertex
+0.500000 0.500000 frame vertex
+=
+0.500000
+= vertex frame
+anim frame -1 0.500000
+-1 texture -1 bone 1.0 material vertex -1 anim texture material material = -1 = 0.500000 1.0 material
+material texture material 0.500000
+-1
+frame frame 1.0 frame anim frame 0.500000 -1 frame frame frame material vertex -1
+texture frame anim anim 0.500000 0.500000 1.0 0.500000 -1
+bone 1.0
+material
+anim 0.500000 vertex 1.0 anim -1 material texture = texture = 1.0 anim -1 anim frame
+bone
\ No newline at end of file
@@ -0,0 +1,39 @@
+frame vertex
+0.500000 texture
+frame
+material material
+vertex 0.500000 -1
+= -1
+0.500000
+= texture texture bone 1.0
+texture 1.0 bone -1 = frame
+= 1.0
+-1 frame anim
+1.0 material -1 texture = vertex
+-1 vertex =
+vertex material
+bone 0.500000 1.0 frame bone material =
+bone 1.0 vertex 1.0 vertex
+frame material
+0.500000
+1.0 frame
+material anim texture -1 1.0 = vertex material frame material 1.0 bone
+-1 anim frame texture -1 bone
+0.500000 texture vertex material 0.500000 1.0 anim
+-1
+anim frame material material texture vertex bone 0.500000
+frame frame
+1.0
+bone anim 1.0 anim 0.500000 bone anim vertex
+-1 texture frame texture bone 0.500000 material
+=
+anim bone 1.0 frame 0.500000 vertex anim -1 texture
+anim bone -1 vertex = = 0.500000 texture bone 0.500000 -1 texture
+= 0.500000 bone
+= vertex
+frame material bone
+1.0
+-1 material anim -1
+frame vertex = material 1.0
+-1
+1.0
\ No newline at end of file
@@ -0,0 +1,6 @@
+= texture
+texture 0.500000 bone anim 1.0 anim
+-1
+anim vertex vertex = vertex 0.500000 bone
+texture material 0.500000 material texture texture -1 anim vertex
+material 0.500000 = -1 anim texture 0.500000 texture 1.0 -1 bone vertex tex
\ No newline at end of file
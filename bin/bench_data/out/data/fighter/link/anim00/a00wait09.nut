@@ -0,0 +1,6 @@
+texture vertex 1.0
+-1 anim
+1.0
+bone
+0.500000 -1 material frame bone material 1.0 1.0
+frame frame -1 material 1.
\ No newline at end of file
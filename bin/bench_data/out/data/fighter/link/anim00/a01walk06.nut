@@ -0,0 +1,7 @@
+anim anim anim
+anim
+bone frame 1.0
+anim bone material texture
+material vertex
+-1 bone anim
+-1 = material -1 =
@@ -0,0 +1,105 @@
+= 1.0 -1 -1 -1 frame anim -1
+material
+anim
+frame anim = material anim 0.500000 vertex vertex 0.500000 frame bone
+-1 1.0 -1 frame
+bone
+= vertex frame texture
+anim frame anim vertex -1
+-1
+texture
+material
+material anim anim vertex texture vertex 1.0
+bone = bone
+anim material
+texture
+bone material = 1.0
+material
+=
+frame material material vertex frame material texture vertex anim 0.500000
+0.500000 anim bone anim frame = vertex material
+vertex material vertex =
+frame
+vertex material anim vertex
+anim texture texture texture material 1.0
+frame texture bone
+-1 = = =
+=
+-1
+material texture 0.500000
+anim bone vertex 0.500000
+vertex 1.0 0.500000 frame
+material material -1 texture
+= anim bone bone bone = 1.0 vertex
+vertex 0.500000
+texture 0.500000 texture texture 0.500000
+1.0 anim bone = frame bone 1.0 1.0 0.500000 material texture anim
+vertex anim =
+frame = -1 material 0.500000 vertex
+1.0 frame 0.500000 -1
+-1 material 1.0 -1 vertex 1.0 frame vertex 0.500000 anim bone
+anim 1.0 = texture
+0.500000
+1.0 0.500000 vertex 0.500000 0.500000 0.500000 0.500000 0.500000
+anim vertex vertex -1 0.500000
+bone -1
+= bone frame 0.500000 1.0 anim vertex bone
+vertex = =
+=
+0.500000 0.500000 vertex = 0.500000 anim -1 texture material 0.500000 0.500000 1.0
+=
+frame frame frame vertex =
+vertex frame
+1.0 anim
+0.500000 material
+vertex vertex
+anim texture -1 anim texture =
+texture texture -1
+anim vertex anim 1.0 1.0 vertex
+0.500000
+vertex frame texture material bone
+frame = =
+material -1 anim -1 bone texture vertex texture
+vertex vertex bone texture bone
+1.0
+0.500000 anim material anim texture
+frame material 0.500000 = texture -1 frame -1 bone 0.500000
+anim
+frame = 0.500000 = -1 vertex
+-1 frame material -1 anim vertex anim 1.0 anim 1.0 = texture -1 texture frame material bone material -1 bone frame anim
+0.500000 0.500000 bone
+-1 bone 0.500000 -1 vertex -1
+-1
+texture anim vertex -1
+anim
+-1 bone 1.0
+vertex anim =
+material
+texture material bone = anim
+0.500000 1.0 texture 1.0 material 1.0 =
+vertex vertex vertex = vertex frame material bone bone material texture
+0.500000 texture
+-1 -1 = frame material 0.500000
+vertex 1.0 = material material =
+-1 frame anim = anim material
+texture = -1
+0.500000 frame 1.0 0.500000 anim 1.0 anim frame
+0.500000 texture 1.0 vertex frame = = = = = 1.0 bone -1 material =
+-1
+frame material texture
+texture frame bone
+texture texture = bone texture
+-1 material
+0.500000
+texture vertex anim
+-1 1.0
+anim 0.500000
+0.500000
+-1
+material 0.500000
+vertex bone texture anim vertex anim =
+= 0.500000 -1 1.0 vertex material vertex frame = vertex material texture anim
+1.0 1.0 anim
+texture 0.500000 0.500000 1.0
+0.500000 bone
+-1 bone -1 0.500000 1.0 -1 bo
\ No newline at end of file
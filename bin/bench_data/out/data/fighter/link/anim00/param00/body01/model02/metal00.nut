@@ -0,0 +1,6 @@
+texture
+texture = -1 material texture
+material
+frame texture = frame
+1.0 = frame bone =
+bone material 0.500000 = anim bone anim 0.5000
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim bone
+frame = vertex material = frame
+texture texture
+texture frame 0.500000 anim -1
+anim vertex bone anim frame vertex
+=
+anim
+-1 0.500000 material = 0.500000 textur
\ No newline at end of file
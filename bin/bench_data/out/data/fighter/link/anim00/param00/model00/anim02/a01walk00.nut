@@ -0,0 +1,43 @@
+= 0.500000
+vertex vertex
+1.0
+material anim
+1.0 1.0 1.0 material = vertex vertex
+=
+vertex = frame
+1.0 frame = anim material
+-1 material material
+vertex anim frame anim
+material frame bone vertex vertex anim frame 0.500000
+0.500000 =
+= 1.0
+material -1 vertex
+material = = frame
+= material
+= 1.0
+frame 1.0
+-1 0.500000 0.500000 bone texture bone texture anim 0.500000 0.500000 = 1.0 -1 texture anim
+texture
+1.0 vertex 0.500000 texture vertex
+-1 material anim
+anim = vertex anim material
+texture
+material = bone 1.0 frame anim vertex
+anim
+frame
+material -1 material vertex material -1 bone
+1.0 bone
+-1
+frame
+frame 1.0
+frame 0.500000 vertex
+0.500000 0.500000 material bone anim
+bone
+vertex -1 = bone = bone
+1.0 -1
+material
+anim 0.500000 = -1 vertex
+bone 0.500000 frame bone 1.0
+1.0 1.0 frame
+1.0 vertex 1.0
+vertex ve
\ No newline at end of file
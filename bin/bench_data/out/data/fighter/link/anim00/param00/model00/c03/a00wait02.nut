@@ -0,0 +1,10 @@
+bone material
+-1 1.0
+bone vertex
+0.500000 1.0 vertex 1.0
+anim 0.500000 texture
+anim anim vertex
+anim frame frame vertex texture frame
+anim =
+0.500000 bone
+anim vertex -1 bone vertex 0.500000 = 
\ No newline at end of file
@@ -0,0 +1,15 @@
+texture
+1.0
+bone -1 0.500000 = frame anim frame = material material bone anim vertex
+anim vertex bone 1.0
+bone frame 1.0 anim
+texture texture texture material texture -1 frame anim = material
+=
+1.0
+anim
+-1 vertex 1.0 -1 texture anim 0.500000 bone = anim = anim
+anim 0.500000
+bone -1
+0.500000
+= =
+0.500000 anim f
\ No newline at end of file
@@ -0,0 +1,86 @@
+bone texture bone frame frame bone 1.0 anim -1
+frame bone
+-1 -1 = 1.0 vertex
+1.0 frame
+vertex frame bone bone -1 texture bone anim 0.500000
+texture bone
+anim
+bone anim vertex vertex = texture
+material frame
+anim material 1.0 0.500000
+1.0 bone 0.500000 texture
+texture anim bone frame -1 material
+frame = material
+material -1 vertex
+texture =
+1.0 frame = frame 1.0
+material material anim material material frame = 0.500000
+texture anim material bone 1.0 anim frame material texture vertex =
+texture frame frame bone bone texture vertex vertex vertex frame = vertex material
+-1 =
+vertex
+material anim bone material material
+0.500000
+-1 anim
+0.500000 frame -1 bone texture =
+anim frame frame
+anim bone vertex 0.500000 bone texture
+vertex bone anim bone
+anim vertex = 1.0 texture texture 1.0 1.0 -1
+vertex anim -1 anim 0.500000 frame vertex bone
+= texture texture material anim vertex frame vertex vertex frame vertex
+= = frame material
+texture = anim
+vertex 0.500000 1.0 1.0 0.500000 material vertex =
+-1 texture material =
+= 0.500000 texture = -1 bone 1.0
+0.500000 -1
+frame bone =
+frame 0.500000 = anim = 0.500000 = texture = texture vertex 0.500000
+anim = 0.500000 texture
+1.0 anim =
+vertex -1 -1 texture anim
+texture 1.0
+frame vertex anim vertex texture
+texture -1
+1.0
+1.0 material frame anim bone vertex frame bone anim -1 = texture frame -1 -1 vertex texture
+vertex anim material material
+frame frame
+vertex 0.500000 anim
+texture frame -1 texture anim
+anim frame texture anim -1 texture 1.0 material
+vertex 1.0 frame 0.500000 1.0 frame
+1.0 texture = 0.500000 vertex texture texture 0.500000
+1.0 material material frame =
+texture 0.500000 vertex frame
+texture vertex 1.0 = texture -1
+texture
+-1 material 1.0 -1 material = frame frame 0.500000 texture 0.500000 anim -1 material 1.0 -1
+frame frame 0.500000 texture frame 0.500000 = 1.0
+bone
+bone anim
+0.500000 frame vertex 1.0
+= bone bone vertex
+=
+anim
+texture anim
+vertex -1 texture bone = texture frame -1 vertex texture bone = 1.0 =
+frame
+texture frame 0.500000 bone frame 0.500000 texture texture
+= =
+= bone
+bone 0.500000 -1
+1.0 material anim =
+= 0.500000
+vertex 1.0
+0.500000 0.500000
+anim
+anim anim 1.0 anim -1 texture
+= 1.0 frame frame
+anim material -1 anim 1.0
+bone 1.0 texture 1.0
+-1 material 0.500000 vertex material 1.0 vertex
+-1 =
+=
+1.0 vertex bone bone = bone
@@ -0,0 +1,6 @@
+= frame material vertex
+1.0 = vertex bone
+material
+= texture 1.0 frame 0.500000
+-1
+0.500000
\ No newline at end of file
@@ -0,0 +1,8 @@
+bone bone anim texture
+frame material anim =
+1.0 -1 bone frame
+frame = frame bone
+anim
+= frame 0.500000 1.0 material
+texture texture
+= materi
\ No newline at end of file
@@ -0,0 +1,91 @@
+texture -1 1.0
+frame -1 = texture
+-1 = texture texture
+frame anim
+vertex -1 -1 = bone 1.0 = vertex 0.500000
+vertex = frame material texture
+texture vertex frame -1
+= texture
+texture
+= bone -1
+texture
+texture texture
+= frame
+0.500000 = bone frame
+= anim
+texture
+bone
+texture = = material vertex bone -1 frame texture texture
+bone 1.0
+bone texture
+texture
+bone = = =
+0.500000
+0.500000
+anim texture -1 anim = anim frame bone bone texture vertex frame frame
+1.0 vertex
+anim 0.500000 anim vertex frame 0.500000 = vertex 1.0 1.0
+texture frame
+0.500000
+-1
+1.0
+frame 1.0 texture anim anim
+bone bone = texture bone = vertex
+frame anim material
+material
+-1 frame
+vertex
+texture
+material 0.500000 -1 0.500000
+frame = anim = material anim vertex frame frame frame anim
+bone material -1 -1 vertex 1.0 bone = bone 1.0 anim vertex 1.0 bone 0.500000 frame 1.0
+= vertex anim
+= 1.0
+frame -1 material
+vertex texture frame 0.500000
+texture frame material
+-1 vertex material 1.0 anim frame vertex
+anim texture
+= -1 vertex vertex material
+= -1 1.0 frame
+1.0 anim bone anim = 1.0
+= 0.500000
+-1 1.0 frame 1.0
+frame frame bone bone
+texture
+vertex vertex = 1.0 material
+1.0 frame frame frame 0.500000 bone anim 1.0 frame
+vertex bone texture anim texture frame
+-1
+vertex =
+bone texture vertex
+1.0 texture texture
+frame 0.500000
+anim texture 0.500000 vertex bone = 0.500000 -1 1.0 1.0 vertex texture texture material vertex bone 1.0 material
+= frame anim -1 bone frame frame
+1.0 frame anim material
+1.0
+anim anim 0.500000 anim 1.0 = 1.0 material 0.500000 frame frame bone frame texture 1.0
+anim vertex
+material texture material -1
+frame anim material vertex anim frame frame texture
+anim
+material
+bone frame 0.500000
+material frame 0.500000 = = 0.500000 material
+= material
+bone material
+bone = 0.500000 frame anim bone vertex
+frame anim 0.500000
+=
+-1 bone
+frame bone
+bone bone vertex material vertex anim
+vertex
+-1 texture bone 1.0
+vertex
+frame bone
+-1 anim
+-1 1.0 0.500000 1.0 vertex =
+anim
+textur
\ No newline at end of file
@@ -0,0 +1,154 @@
+anim frame vertex frame frame texture anim
+texture bone material frame = anim texture material
+frame =
+1.0
+material material
+material
+0.500000 material anim 1.0
+frame -1 1.0 1.0
+texture material anim
+vertex 1.0 anim
+anim 0.500000 -1 vertex 0.500000 bone bone
+0.500000 0.500000 frame 1.0
+frame -1 bone 1.0 texture = bone material frame
+vertex 0.500000 = bone = -1 bone material vertex texture -1 frame
+bone = =
+texture bone 1.0 0.500000 texture material
+vertex vertex 1.0
+= bone
+-1
+-1
+1.0
+-1 0.500000
+material 0.500000
+1.0 material
+1.0 0.500000 1.0
+texture anim =
+0.500000 0.500000 vertex 1.0 bone anim =
+bone anim
+=
+vertex 1.0
+= 1.0 vertex 1.0 frame vertex bone anim 1.0 frame 0.500000 texture bone texture
+bone frame texture material
+=
+anim 1.0
+texture
+bone = 1.0 texture anim
+material vertex
+1.0 =
+vertex
+material 0.500000 1.0 material
+vertex -1 texture material anim 1.0
+0.500000 material 1.0 = vertex texture texture 1.0
+vertex material 1.0 anim bone -1
+vertex anim
+-1
+0.500000 =
+anim anim vertex material
+material vertex -1 1.0
+material anim vertex bone frame
+anim bone 0.500000 bone texture bone
+texture bone 1.0 0.500000
+1.0 anim
+-1
+1.0 0.500000 = 0.500000 0.500000 bone anim
+= frame 0.500000 material
+anim
+anim
+vertex =
+vertex 1.0 anim material vertex 0.500000
+material
+material
+-1 vertex frame frame =
+texture
+bone
+0.500000 texture anim
+anim -1 bone
+texture
+material -1 -1 1.0 0.500000
+texture =
+material -1
+material 0.500000 -1 = texture bone texture anim material frame material frame = vertex material 0.500000 anim anim bone 1.0
+anim frame
+= material vertex = -1 bone = anim anim 1.0 frame vertex vertex -1
+vertex anim -1 texture frame
+material
+anim -1 0.500000 1.0 1.0 anim anim
+frame = -1 = frame
+1.0 = material = texture texture 0.500000 bone texture
+vertex texture texture material
+bone = material = texture 1.0 1.0 frame
+anim =
+frame
+0.500000 0.500000 = bone texture texture bone bone material = 0.500000 1.0 1.0 material 1.0 bone texture anim material vertex
+=
+anim
+1.0 -1 vertex
+-1
+frame 0.500000
+1.0 vertex material bone vertex
+anim = vertex
+bone bone 0.500000 -1 0.500000
+texture
+anim
+anim anim = = frame = -1 texture
+bone
+1.0 material
+=
+material 0.500000 texture
+material anim
+frame bone -1 1.0
+0.500000 0.500000 material anim anim bone frame material vertex
+bone vertex = vertex
+texture frame = = texture 0.500000 0.500000 frame
+anim -1 0.500000 texture -1 vertex
+bone material bone 0.500000 0.500000 bone
+-1
+material -1 1.0 anim 0.500000 -1 texture texture bone
+frame
+texture frame
+frame 1.0
+bone texture -1 vertex frame 0.500000 -1
+1.0 anim
+anim -1
+anim
+anim 1.0 vertex texture texture 0.500000 vertex 1.0 bone 1.0 = vertex -1 bone material 0.500000 material vertex bone 1.0 anim vertex vertex material texture =
+bone 0.500000
+texture -1 texture anim
+-1
+vertex
+= anim material 0.500000 texture vertex 0.500000
+1.0
+1.0 1.0 bone frame bone
+bone texture
+= bone bone
+bone 0.500000 vertex material
+texture vertex 0.500000
+texture
+= material
+frame = frame
+1.0 texture material bone -1 material anim frame 1.0 bone bone
+material
+0.500000
+bone 0.500000 1.0 bone
+= texture
+material texture texture anim 0.500000 1.0 = anim vertex vertex frame texture 0.500000 material
+anim material
+material = -1 vertex
+= material
+anim
+bone material anim bone
+frame texture frame vertex
+-1 0.500000
+frame bone anim -1 frame frame
+-1 bone -1 vertex anim bone =
+= material vertex material 1.0 1.0 bone
+vertex 0.500000 vertex
+bone -1
+vertex material = anim material bone texture
+frame
+frame frame anim
+texture frame
+1.0 material vertex bone anim
+anim = anim = frame -1 material -1 anim = texture
+-1 frame = material 1.0 vertex = material bone bone bone frame
\ No newline at end of file
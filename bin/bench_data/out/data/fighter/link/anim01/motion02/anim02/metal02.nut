@@ -0,0 +1,35 @@
+frame vertex -1 0.500000
+anim
+1.0 material 0.500000 -1 vertex 0.500000 frame
+vertex
+-1
+bone material 1.0 0.500000 0.500000 1.0 vertex anim = = = anim bone material frame frame = frame texture 1.0 texture material -1 bone -1 1.0 vertex 0.500000 0.500000
+texture =
+texture vertex 0.500000 = 1.0 -1
+bone = bone bone texture
+= bone vertex 0.500000 vertex = 0.500000 = texture
+material 0.500000 texture
+vertex vertex vertex 0.500000
+material vertex
+frame material anim texture frame 1.0
+1.0 vertex 0.500000 1.0 0.500000 1.0 0.500000 0.500000
+-1 0.500000
+frame
+= 1.0 1.0 anim -1
+bone material
+0.500000
+1.0 texture material -1 texture frame
+bone 1.0 0.500000
+-1
+anim 0.500000
+material
+= 0.500000 frame texture
+1.0 -1 0.500000
+bone
+=
+material 0.500000
+texture
+vertex = anim
+anim vertex 0.500000
+-1 1.0
+vertex frame 0.50000
\ No newline at end of file
@@ -0,0 +1,6 @@
+-1
+vertex -1 = bone = frame -1
+-1 bone
+-1 frame
+material
+text
\ No newline at end of file
@@ -0,0 +1,82 @@
+texture
+= material 1.0
+vertex 0.500000 anim vertex anim
+1.0 bone 0.500000 vertex
+bone vertex vertex bone -1
+=
+material material texture -1 0.500000 0.500000
+1.0 vertex vertex bone texture -1 anim frame vertex -1
+frame anim 1.0 anim texture bone frame frame 1.0 1.0
+= 0.500000
+1.0 bone bone texture
+vertex material frame texture
+bone anim texture
+anim texture bone
+bone material
+0.500000
+0.500000 vertex 0.500000 vertex 0.500000 0.500000 0.500000 texture vertex -1 frame material
+material material -1 1.0 anim -1 bone
+anim
+0.500000 material
+bone =
+frame
+=
+vertex
+anim
+0.500000 material material 1.0 anim 1.0 1.0 1.0 = material
+0.500000 =
+frame bone 0.500000
+-1 -1 -1 frame 0.500000 vertex material 1.0 anim 1.0
+material =
+-1
+texture -1 0.500000 bone -1
+= texture texture 0.500000 anim
+vertex 0.500000 frame -1
+frame
+material 0.500000 bone 1.0 material
+anim 1.0 1.0
+= 0.500000 =
+material
+0.500000 material vertex bone vertex
+bone
+vertex
+vertex = frame material 0.500000 bone vertex vertex 0.500000 bone
+-1 vertex texture 1.0 vertex
+0.500000 1.0 0.500000
+anim material 0.500000 vertex
+bone texture -1 bone
+frame anim
+anim bone material frame frame 1.0
+0.500000 material
+bone -1 -1 bone
+bone vertex bone 1.0 vertex texture material 1.0 material
+-1 frame texture
+= 0.500000
+texture =
+0.500000 -1 texture material = material 0.500000 anim vertex = = frame frame -1 0.500000 anim = material vertex bone
+-1 texture frame -1 -1 frame -1 1.0 texture material texture 0.500000 anim frame
+-1 -1
+texture material bone 1.0
+-1
+bone anim frame vertex vertex anim bone
+texture
+frame
+-1
+texture 0.500000
+0.500000 vertex anim = bone
+vertex frame anim frame
+vertex texture
+texture 1.0
+0.500000 -1
+bone frame texture texture vertex vertex -1 texture texture frame
+=
+texture anim texture
+0.500000
+bone bone -1
+texture anim frame
+material
+=
+texture 1.0 1.0 1.0 frame material bone anim anim -1 = vertex 1.0
+= frame material 1.0 material
+= vertex frame
+vertex vertex frame anim anim 0.500000 = -1 frame textu
\ No newline at end of file
@@ -0,0 +1,119 @@
+0.500000 frame -1 =
+bone -1 bone texture anim
+material material texture
+0.500000 frame frame -1 material
+anim
+1.0 bone
+texture frame vertex
+vertex anim texture =
+1.0
+material -1 = 0.500000 0.500000 frame bone bone
+1.0 bone 0.500000
+= vertex material anim frame =
+frame
+-1 0.500000 anim 0.500000
+anim bone -1
+1.0
+anim = 0.500000 1.0 = frame -1 = 1.0 vertex
+texture
+texture
+bone
+texture 1.0 frame material bone anim vertex 0.500000 1.0
+bone bone texture 1.0 frame
+frame material vertex
+= -1 0.500000 1.0 vertex 1.0 0.500000 bone material texture = texture material
+= bone
+0.500000 = 0.500000 0.500000
+vertex bone = 0.500000 bone texture
+1.0 frame material
+-1 -1
+= anim material bone
+1.0 vertex texture
+texture
+-1 texture texture 1.0 =
+frame 0.500000 1.0 frame
+bone -1 texture 0.500000
+material material texture
+frame vertex frame
+frame -1 vertex
+bone
+vertex frame vertex texture 0.500000 vertex 0.500000 = frame 1.0
+0.500000 material material -1 1.0
+1.0 1.0 = texture -1 frame 1.0 0.500000
+bone
+0.500000 vertex 0.500000 frame 1.0 texture =
+material = 1.0 1.0 -1
+frame
+0.500000 bone
+vertex
+vertex
+0.500000 texture anim bone material material material 1.0 -1 0.500000
+0.500000 material
+vertex 1.0
+frame 0.500000 material
+material texture material
+1.0 bone frame
+texture 1.0 texture
+0.500000 frame anim frame -1
+anim material
+vertex
+frame = -1 =
+= = vertex material material bone texture
+anim vertex = -1
+texture
+1.0 0.500000
+0.500000
+bone material anim
+texture = bone
+frame 0.500000 texture
+bone
+1.0 frame
+material 0.500000 frame -1 vertex 0.500000 0.500000 anim
+1.0 frame
+bone = anim -1 0.500000 texture 1.0 material vertex 1.0 0.500000 vertex
+bone bone texture
+frame bone material bone material texture
+anim anim texture = bone frame
+texture vertex material
+bone vertex
+-1
+material
+1.0 -1 anim -1 frame 0.500000
+= 1.0 1.0 -1
+texture frame
+1.0 anim texture
+0.500000 1.0 frame bone bone frame texture anim -1 = = material
+frame bone material -1 -1 vertex 0.500000 texture
+material bone
+bone vertex texture texture
+bone
+vertex
+frame
+material -1 texture 1.0 = texture
+1.0 0.500000
+material = 0.500000 material
+frame
+material
+1.0 bone anim 1.0
+anim vertex -1 material 0.500000 -1 frame
+material vertex material
+frame -1
+bone = -1 bone anim -1 anim -1 material =
+texture bone 1.0 1.0
+bone material
+frame
+0.500000
+-1 texture texture -1 = -1
+vertex 0.500000 material vertex
+1.0 material -1 frame = vertex
+frame texture vertex
+anim
+vertex texture vertex anim
+-1 0.500000 0.500000 1.0 material frame material
+bone bone bone frame
+1.0 =
+bone
+1.0
+frame anim
+anim
+frame frame anim bone mate
\ No newline at end of file
@@ -0,0 +1,368 @@
+bone
+= vertex -1
+=
+frame vertex vertex 1.0 -1 frame
+0.500000 frame 1.0 frame -1
+0.500000
+-1 -1 frame material -1 vertex = frame frame = bone 1.0 bone =
+-1 = =
+frame material 1.0 1.0 bone
+bone material 0.500000 =
+anim
+frame = frame =
+0.500000 vertex anim frame -1 anim 1.0 vertex -1 anim 0.500000
+material anim -1 material frame material = anim bone anim 1.0 1.0 bone bone frame = frame texture material
+anim
+-1 frame material 1.0
+-1 texture 0.500000 1.0 vertex
+anim bone bone = texture -1 texture frame frame texture bone = 1.0
+-1 0.500000 material 1.0 -1 = -1 texture
+0.500000 bone
+material 0.500000 bone material vertex texture
+-1 0.500000 frame bone
+material vertex -1 vertex 1.0 material frame anim 1.0 = = bone =
+bone 0.500000 material bone
+material texture vertex
+material anim -1 -1 bone frame
+-1
+-1
+vertex
+vertex 1.0
+texture anim -1 1.0
+0.500000 bone material texture
+1.0 texture -1 1.0 texture vertex anim anim vertex
+anim material
+texture 1.0
+1.0 1.0 vertex 1.0 vertex material 1.0 frame
+bone 0.500000 texture
+1.0 frame
+-1 = bone 1.0 1.0 -1
+anim anim texture
+1.0 bone
+0.500000 -1 vertex frame
+bone material
+texture 1.0
+= vertex
+-1
+= anim -1 = =
+frame
+0.500000 vertex material = -1 bone
+texture
+anim 0.500000
+anim frame texture
+anim 0.500000 vertex
+vertex anim
+material vertex
+frame material anim = frame -1 0.500000 =
+material texture -1 frame material texture frame 1.0 1.0 frame
+material material vertex texture vertex = anim 0.500000
+0.500000 vertex
+texture frame 0.500000 -1 bone
+1.0 vertex frame = anim = texture vertex
+vertex
+material 0.500000 1.0 -1 frame frame 0.500000 = = 0.500000 1.0 frame 0.500000
+vertex bone 0.500000 -1 1.0 texture -1 vertex bone 0.500000 -1 bone
+0.500000
+0.500000 -1 1.0 anim = material texture -1 = = frame
+1.0 texture anim 1.0 bone
+-1
+= texture -1
+frame vertex = texture frame bone frame
+texture anim bone 1.0 vertex
+0.500000
+-1
+material 0.500000 1.0 1.0 bone = -1 0.500000 anim -1
+0.500000
+-1 anim vertex material = texture bone texture
+vertex frame bone 0.500000 frame
+material =
+vertex 1.0
+texture bone texture
+0.500000 frame
+material
+material
+-1
+0.500000 anim
+= 1.0 -1
+= 1.0 1.0 vertex
+vertex anim vertex bone
+texture
+bone
+material
+= vertex = anim -1 anim -1
+bone anim material 0.500000 texture bone bone
+bone = bone vertex
+bone
+bone
+-1 -1 1.0 -1 vertex
+bone bone anim frame material = -1 0.500000 frame frame
+frame
+material texture vertex texture texture vertex frame anim
+material 1.0 vertex
+texture vertex anim -1 1.0 1.0
+0.500000 texture frame
+bone frame texture 1.0 -1
+frame 1.0 = bone material = =
+0.500000
+vertex 0.500000
+= vertex bone texture
+material anim
+material
+= 1.0 = vertex
+1.0 anim texture =
+-1 =
+vertex = vertex anim material bone 0.500000 bone vertex frame 1.0 texture -1 = material vertex texture
+texture frame 1.0 material anim vertex
+1.0 frame 0.500000
+frame -1 material bone 1.0 frame 0.500000 1.0 -1 texture material
+0.500000 frame material texture -1 1.0
+-1 material 0.500000 vertex = anim anim vertex frame = 0.500000 0.500000
+material
+texture
+frame bone anim texture
+vertex = texture vertex 1.0 bone
+0.500000 frame -1 -1
+frame vertex 0.500000 material
+texture bone = bone
+frame 1.0 = frame vertex
+anim
+-1 vertex frame vertex vertex -1 bone
+= 1.0 = frame
+0.500000 0.500000 0.500000
+frame
+0.500000 texture vertex
+frame material texture texture 0.500000 frame -1
+=
+bone = material 0.500000
+-1 -1 0.500000 bone 0.500000 bone
+anim frame texture texture -1 1.0 =
+0.500000 anim
+= vertex
+anim = vertex -1 vertex
+frame =
+0.500000 texture texture
+1.0
+0.500000
+vertex frame 1.0
+texture anim material frame texture texture frame
+0.500000
+vertex vertex
+material material
+anim 1.0 frame 1.0 vertex material 0.500000 anim
+=
+vertex
+bone 0.500000 vertex -1 texture texture material bone bone 0.500000
+1.0 0.500000 anim frame =
+bone 1.0 vertex texture =
+-1
+anim
+-1
+1.0
+texture
+1.0 0.500000 vertex 1.0 1.0 texture -1
+bone
+vertex texture = frame material texture texture vertex bone = 1.0 bone -1 = 0.500000 bone material
+-1 0.500000
+anim anim 0.500000 1.0 = =
+bone
+material
+material texture 1.0
+material anim anim
+anim
+texture
+texture texture bone 1.0 vertex bone texture bone -1
+material
+anim texture frame texture
+0.500000 0.500000
+bone vertex material 0.500000 vertex 1.0 frame
+anim frame texture
+=
+anim
+texture bone
+vertex texture
+anim
+material
+material
+vertex bone 0.500000 =
+=
+0.500000
+-1 bone 0.500000 = texture vertex 0.500000 vertex anim texture 1.0
+-1 anim 1.0 = frame
+texture bone
+anim
+1.0 0.500000
+anim texture frame 1.0 -1 = texture anim bone vertex
+= =
+vertex -1 = bone
+texture anim bone = bone -1 vertex 0.500000
+anim frame material vertex 1.0 1.0 -1 1.0 1.0 1.0 0.500000 -1 vertex frame frame anim bone -1 anim 1.0 0.500000
+material = bone texture texture 0.500000 -1 0.500000 anim
+frame
+bone
+vertex texture
+vertex material
+-1 = -1 =
+bone
+= vertex 1.0
+material texture material frame
+texture material bone bone = frame material
+1.0
+1.0 anim material
+-1 -1 -1
+-1 vertex
+bone material bone 0.500000
+frame
+= bone
+anim = frame = material bone
+texture frame texture
+-1
+frame
+0.500000 -1 1.0
+material
+material
+anim material = material frame texture
+bone = -1
+= frame material
+= 1.0 = texture
+1.0 vertex material anim bone
+bone material vertex anim
+frame bone bone
+0.500000 =
+-1 vertex texture texture = = material frame material vertex bone anim -1
+frame
+anim 0.500000
+anim bone material
+-1 = 0.500000
+texture =
+1.0 = texture
+vertex anim =
+0.500000
+bone
+frame 1.0 0.500000 bone texture
+frame
+texture anim vertex material bone material material texture
+-1
+anim material anim material texture 1.0
+frame
+material
+material frame
+1.0 texture
+texture anim
+0.500000 anim
+0.500000 = frame 1.0 -1 1.0 vertex vertex
+=
+texture 0.500000
+anim vertex -1 vertex = anim 1.0 material material material
+0.500000
+-1 vertex frame material =
+0.500000 -1 = bone 0.500000
+bone
+-1 -1
+1.0
+bone -1
+anim 1.0 frame material =
+1.0 -1 = -1
+texture frame 0.500000 0.500000 0.500000 frame anim
+anim material frame frame anim texture
+= anim texture = anim frame material bone texture -1
+material bone frame texture bone -1
+1.0 texture 0.500000
+0.500000
+bone 1.0 bone -1 bone
+1.0
+-1
+bone material frame anim 1.0 vertex
+bone frame 0.500000 frame anim material vertex
+0.500000
+1.0
+0.500000
+frame -1 frame 1.0
+= texture
+1.0 vertex anim bone
+frame
+1.0
+bone
+anim bone
+0.500000 frame bone
+-1 anim material
+1.0
+bone bone 1.0
+-1 material vertex -1 frame anim 1.0 bone -1 bone
+= frame texture material 0.500000 frame -1 0.500000 -1 frame
+anim -1 0.500000 material
+= =
+anim =
+= anim anim 1.0 anim bone 1.0
+= bone material 1.0 vertex
+0.500000 = anim 1.0 -1 0.500000 material
+anim -1
+frame -1 frame -1 1.0 texture -1 -1 vertex material anim
+frame
+frame frame
+material 1.0 frame -1 texture
+frame
+-1
+-1 frame material vertex vertex -1 vertex
+material vertex vertex material vertex =
+texture frame
+frame anim frame texture
+= vertex frame vertex bone texture -1 0.500000 material = texture
+material -1 1.0 anim -1 -1
+material vertex
+vertex 1.0 -1 anim
+0.500000 bone material frame frame = =
+0.500000
+0.500000 vertex
+material vertex bone =
+0.500000
+frame anim
+vertex 1.0 bone -1
+anim texture
+material
+0.500000 -1 frame
+-1 0.500000 vertex -1 frame frame frame
+anim
+frame = -1 vertex vertex
+anim texture =
+= = -1
+1.0
+anim
+1.0 1.0 -1 0.500000
+frame 1.0
+-1 bone 0.500000
+vertex
+texture material = frame
+0.500000 1.0 = 1.0 1.0 vertex -1 vertex
+material 0.500000 anim = =
+texture anim frame
+texture material 1.0 vertex frame = frame 1.0 1.0 frame material
+= material
+1.0 material frame material frame bone material frame frame frame
+= material texture
+material vertex anim vertex
+0.500000 anim
+0.500000
+material -1 bone material 0.500000 bone
+-1 bone 0.500000 bone
+= frame anim material
+=
+0.500000
+anim material
+material vertex vertex =
+-1 frame anim =
+-1 texture = bone 0.500000
+bone anim anim = = material anim material frame
+1.0 material
+anim frame anim texture bone 1.0
+-1
+0.500000 frame
+anim frame material
+bone texture texture
+1.0 =
+texture vertex =
+= -1 bone -1
+-1 -1 anim 1.0
+material vertex
+1.0 0.500000
+bone -1 = frame texture material anim
+f
\ No newline at end of file
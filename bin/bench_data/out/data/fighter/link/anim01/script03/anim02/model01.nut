@@ -0,0 +1,39 @@
+material
+bone = frame bone
+-1 material anim = bone =
+anim bone 1.0 frame -1
+anim
+frame material
+= frame bone texture frame
+= bone frame =
+frame anim = texture frame bone
+texture
+1.0 1.0
+vertex
+anim anim
+texture 1.0 vertex texture vertex
+1.0
+=
+bone = texture
+bone
+0.500000 texture vertex 0.500000 vertex texture 0.500000
+material
+1.0
+1.0
+material anim frame 0.500000 vertex bone vertex 1.0
+0.500000
+1.0
+anim
+texture -1 1.0 frame texture frame
+1.0 1.0 -1 0.500000 frame -1 material vertex = material
+material -1 1.0 -1 material anim frame vertex anim = texture
+0.500000 frame
+=
+vertex -1 1.0
+bone
+-1 = 1.0 -1 texture
+-1 material anim anim 0.500000
+1.0 0.500000
+texture 1.0 = anim = vertex
+0.500000 material -1 = texture anim texture texture vertex
+ve
\ No newline at end of file
@@ -0,0 +1,70 @@
+-1 = =
+1.0 anim 1.0 =
+material material
+0.500000 = vertex frame vertex bone 1.0 frame = frame -1 texture
+texture texture frame vertex bone
+anim 0.500000 material 0.500000 = 1.0 bone texture
+material texture
+anim material
+material material vertex -1 material 1.0 frame -1 bone 1.0
+frame bone material bone 1.0 texture bone bone = = bone -1 0.500000 0.500000 frame bone texture bone
+material texture anim -1 -1
+texture
+frame
+bone 0.500000 bone
+vertex vertex
+material 1.0
+= material anim texture
+1.0 vertex
+0.500000
+0.500000 texture 1.0 -1 1.0 texture 0.500000 texture -1 texture 0.500000
+frame frame
+bone frame anim bone
+-1 bone
+-1
+texture =
+=
+= anim 0.500000 vertex 0.500000 frame 0.500000
+= bone texture 0.500000 1.0
+0.500000 material 0.500000 texture bone -1
+-1 -1 1.0 frame 1.0
+vertex
+bone
+1.0
+frame material
+bone texture =
+-1 frame 1.0 0.500000 =
+0.500000 texture 1.0 0.500000
+0.500000 bone 0.500000 frame = -1 anim bone anim
+1.0 texture 1.0 = = vertex material 0.500000 anim = -1 -1 =
+-1
+anim texture
+1.0 1.0 texture
+anim vertex 1.0 vertex
+-1 = frame bone = -1
+frame
+bone =
+= vertex vertex texture frame vertex = texture texture = material 0.500000 1.0 frame
+0.500000 anim texture frame material -1 -1 vertex 0.500000 0.500000 texture bone frame bone
+texture anim -1 0.500000 frame
+-1
+anim vertex -1 0.500000
+anim anim 0.500000
+0.500000 texture material
+vertex -1
+material
+0.500000 vertex frame 0.500000
+= -1 vertex 1.0 anim texture -1 0.500000 texture bone =
+vertex vertex material
+frame anim texture -1 frame
+1.0 -1 0.500000 vertex = -1
+texture bone bone 0.500000 0.500000 bone bone 0.500000 material vertex
+vertex material 1.0 1.0 anim
+texture bone 0.500000
+= material
+= vertex material = 1.0
+bone bone texture texture anim frame
+frame bone -1 vertex
+frame bone = texture anim
+= = bone
+frame tex
\ No newline at end of file
@@ -0,0 +1,94 @@
+anim -1
+material
+0.500000 anim frame 0.500000
+texture frame texture material material
+anim frame material 0.500000 = frame = 1.0
+frame vertex
+bone vertex material
+1.0 vertex
+material
+0.500000 frame
+0.500000 1.0 frame vertex material texture texture bone
+anim vertex anim -1 texture texture
+frame
+anim
+= 0.500000 vertex frame bone vertex
+0.500000 anim vertex = texture
+texture
+vertex texture vertex frame 0.500000
+= =
+vertex vertex
+frame vertex -1 material
+1.0 = material -1 vertex material
+vertex
+0.500000 anim texture
+anim
+1.0 0.500000
+anim
+1.0 texture
+frame material bone
+bone
+vertex bone anim material vertex
+texture bone 0.500000 =
+= 0.500000 texture
+frame
+1.0 -1
+= -1
+texture bone anim frame =
+frame material
+frame
+bone anim
+anim frame vertex texture texture
+material anim texture = -1
+0.500000 -1 frame
+anim 1.0 texture
+= -1 -1 = 1.0 bone 1.0 bone material bone anim vertex material -1
+= texture =
+anim
+-1 -1 material material
+= = 0.500000 texture bone
+texture frame 0.500000 bone material vertex =
+frame
+vertex texture frame frame
+vertex
+material bone bone 1.0 texture =
+texture frame vertex 0.500000 anim -1
+material bone vertex
+bone = frame
+material -1 frame bone bone -1
+texture -1 vertex anim anim texture
+anim texture texture
+material texture
+material 1.0 anim material frame bone vertex 1.0 bone frame -1 vertex vertex
+frame
+material texture = material material frame material -1 material texture
+bone texture 0.500000 0.500000 anim 1.0 vertex material 0.500000 0.500000
+anim -1 frame material material anim
+material anim texture frame vertex anim texture
+-1 frame vertex
+= 1.0
+anim 1.0 anim
+material 0.500000 =
+-1 material
+=
+0.500000 texture 1.0
+material
+1.0 1.0 0.500000
+bone frame anim vertex frame bone anim
+-1 = vertex = 0.500000 texture
+= -1 -1 material
+bone = = vertex bone
+=
+1.0
+bone material
+1.0
+=
+material vertex 0.500000 vertex texture texture 1.0
+material
+material vertex frame
+= -1 bone
+frame
+1.0
+-1
+material anim material frame frame vertex anim vertex
+texture texture 1.0 0.500000 0
\ No newline at end of file
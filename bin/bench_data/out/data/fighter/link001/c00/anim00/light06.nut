@@ -0,0 +1,20 @@
+vertex =
+bone -1 0.500000 bone -1 0.500000 texture bone anim 1.0 1.0 material 1.0 material
+material anim 0.500000 -1
+vertex
+texture texture
+=
+texture vertex texture = 1.0 vertex 1.0 -1
+1.0 bone texture
+-1 1.0 bone vertex vertex =
+0.500000 frame frame 0.500000 texture material
+0.500000
+= vertex 0.500000 frame frame
+-1 frame 0.500000 material material frame frame 0.500000
+material vertex anim vertex 0.500000 frame
+frame 0.500000 vertex 0.500000
+0.500000
+vertex = anim
+texture
+frame = anim
+frame
\ No newline at end of file
@@ -0,0 +1,68 @@
+material
+vertex texture bone 0.500000 -1
+material texture vertex texture -1 bone frame texture material -1
+frame material material 0.500000
+frame 0.500000 1.0 1.0
+-1 bone 0.500000 material -1
+-1 anim -1
+material = material anim texture
+material texture
+= vertex texture bone 0.500000 0.500000 0.500000 -1 1.0 vertex -1 anim texture = bone bone
+-1 anim 1.0 0.500000 anim anim 1.0 bone 1.0
+1.0 frame texture frame
+=
+= = 0.500000 vertex =
+-1
+= material anim = 0.500000 -1 = 0.500000
+frame
+frame material
+anim anim bone 1.0 1.0 texture frame texture bone
+bone material texture =
+texture
+anim = frame
+material texture -1 material anim
+= anim material 0.500000 vertex texture 1.0 1.0 texture
+vertex
+vertex anim material vertex vertex
+-1 vertex texture vertex 0.500000 frame anim material texture bone 1.0 vertex material =
+vertex anim 1.0 1.0 = -1 texture -1 material anim material texture 0.500000 anim
+1.0 -1 -1 material texture bone texture = texture bone
+0.500000 bone bone
+texture bone bone =
+-1 frame -1
+bone anim frame anim anim
+0.500000 vertex anim -1 anim texture -1 1.0 1.0 bone vertex frame vertex material material = bone
+-1 -1 1.0 anim -1 = 1.0 -1 texture vertex anim texture 1.0 material -1
+material
+texture bone texture material 1.0
+vertex texture
+material bone
+0.500000
+anim material frame frame = = -1 = material frame texture 1.0 -1 -1 0.500000
+vertex texture 0.500000
+vertex vertex = = bone bone -1 =
+material 1.0 frame texture frame material
+bone anim bone
+anim
+anim material
+-1 0.500000 vertex frame
+= 1.0 material 0.500000 anim
+anim = bone vertex
+frame
+vertex bone 0.500000 frame vertex
+vertex bone material bone vertex -1 vertex
+bone material material
+bone anim frame 1.0 -1 0.500000
+= = anim 1.0 0.500000
+=
+frame
+texture texture
+-1
+texture
+0.500000 =
+-1 anim
+1.0
+frame anim
+material vertex = bone 0.500000 vertex 0.500000 1.0 bone vertex bone bone = texture
+material vertex 0.500000
+1.
\ No newline at end of file
@@ -0,0 +1,11 @@
+material 0.500000 vertex 0.500000
+0.500000
+= frame bone material
+=
+-1 anim material 0.500000 = 0.500000 anim vertex
+-1 texture anim texture anim 1.0 bone -1 = frame material = frame texture 1.0 vertex 1.0
+frame -1 = frame frame texture -1 1.0 material = frame
+texture -1 -1 bone
+material
+-1 anim
+1.0 ma
\ No newline at end of file
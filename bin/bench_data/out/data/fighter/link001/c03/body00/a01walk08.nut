@@ -0,0 +1,73 @@
+material
+0.500000
+0.500000 texture bone = 1.0 material = frame bone -1 = anim
+material bone 0.500000 vertex
+material
+= texture frame texture =
+0.500000 -1
+texture texture vertex frame
+= 0.500000 1.0
+-1 vertex
+material
+anim
+frame 1.0 1.0
+= 0.500000 bone frame
+vertex
+1.0 bone bone texture anim material bone
+material texture -1 0.500000
+1.0 = anim
+0.500000 1.0 1.0
+bone anim material = = frame anim 0.500000 0.500000 1.0
+frame material texture 0.500000
+0.500000 frame bone
+frame anim 0.500000
+texture -1 bone
+frame texture
+material 0.500000 material
+bone
+-1
+1.0
+frame texture vertex anim
+= 0.500000
+= frame
+1.0
+-1 -1 frame anim 1.0
+-1
+frame 1.0 1.0 anim anim 0.500000 bone = -1
+=
+anim vertex frame material = 1.0
+texture
+anim -1 bone vertex 0.500000
+vertex -1 texture 1.0 vertex -1 material frame = frame 0.500000 0.500000 -1
+bone
+frame = bone -1
+anim vertex frame 0.500000 material
+= 1.0 bone anim
+bone =
+bone texture
+bone 1.0 anim bone 1.0 material material vertex
+1.0 vertex material material
+frame = 0.500000
+vertex 1.0
+texture -1 texture bone vertex
+1.0 = -1
+frame material texture
+=
+0.500000 material texture
+anim texture anim 0.500000
+texture bone -1
+texture
+frame
+frame
+vertex 1.0 0.500000 vertex 0.500000 vertex -1 bone 0.500000 anim
+0.500000 anim
+0.500000 material anim 0.500000 bone
+material texture =
+= = -1 = -1 1.0 texture texture
+vertex 0.500000 vertex anim texture anim 1.0 = 1.0 = bone bone 1.0
+anim 0.500000 1.0
+texture frame texture
+vertex 1.0 -1 vertex frame vertex frame
+material 0.500000 vertex -1 bone material material = bone 1.0 frame
+texture 0.500000
+0.5
\ No newline at end of file
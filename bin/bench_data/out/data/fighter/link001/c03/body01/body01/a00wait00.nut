@@ -0,0 +1,2 @@
+texture = anim 0.500000 1.0 = anim bone 1.0
+material 1.0 material material bone = 1.0 0.500000 bone bone ma
\ No newline at end of file
@@ -0,0 +1,14 @@
+= frame 0.500000
+bone -1 = vertex texture frame bone
+0.500000 1.0
+= = -1
+1.0 material
+material = texture
+vertex -1 material material
+anim
+0.500000
+-1 bone
+frame = vertex
+anim anim
+-1
+frame frame
\ No newline at end of file
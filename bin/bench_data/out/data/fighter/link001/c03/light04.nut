@@ -0,0 +1,74 @@
+0.500000
+bone anim
+vertex vertex vertex bone vertex
+bone frame
+0.500000 = bone anim vertex texture
+texture 0.500000
+material
+anim
+bone -1 frame material bone material
+vertex vertex
+1.0 0.500000 1.0 bone
+1.0 material =
+texture
+-1 texture
+bone = texture
+0.500000 bone frame 1.0
+material bone bone vertex -1 -1
+-1 texture 0.500000 -1 vertex
+anim bone 0.500000 = = frame 1.0
+texture -1
+material 1.0 texture
+0.500000 material 0.500000 material
+material 0.500000
+-1
+bone anim
+= anim bone
+= = = frame
+-1
+vertex -1 = frame texture anim frame frame
+bone 0.500000 -1 bone bone anim material 1.0 vertex texture frame frame
+anim
+texture texture
+1.0 anim -1 bone = vertex material -1 bone bone =
+-1 bone = texture texture 1.0 0.500000 frame
+bone 1.0
+vertex texture -1 vertex anim texture
+1.0 1.0 anim bone 0.500000 -1
+texture vertex 1.0 texture bone 1.0 = frame -1
+-1 -1
+material frame 0.500000
+frame
+bone texture 0.500000 texture vertex
+anim anim =
+vertex = vertex
+anim -1 material frame = 1.0 -1 frame 1.0 1.0
+material bone material
+1.0 = bone texture -1
+= frame 0.500000 frame
+material bone bone =
+material material frame material texture material
+= anim frame
+=
+anim texture 1.0
+anim -1
+1.0
+material texture = 1.0 1.0
+frame bone texture material
+texture bone material 0.500000 anim anim -1 anim vertex bone texture material 1.0 frame
+1.0 material frame texture
+frame
+vertex frame 0.500000 vertex
+bone -1 material
+texture 1.0 anim
+-1 material = 0.500000 bone bone 0.500000 material -1 anim bone
+texture bone bone 0.500000 bone = material anim texture
+anim
+anim vertex
+= 1.0 anim bone vertex = anim
+bone texture = anim bone bone
+bone vertex 1.0 material material bone anim material 0.500000
+material vertex = frame
+texture
+bone bone
+-1 bone -1 -1
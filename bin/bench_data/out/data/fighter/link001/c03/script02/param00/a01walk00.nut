@@ -0,0 +1,211 @@
+0.500000 = 0.500000
+material vertex anim frame material frame = -1
+0.500000 0.500000
+anim
+= material frame 1.0 vertex
+texture
+texture frame frame
+bone material anim =
+1.0 vertex 0.500000 anim
+anim frame = = material vertex vertex 1.0 bone anim texture anim
+frame -1 = material
+frame texture
+texture
+vertex -1 1.0
+= frame
+anim frame 0.500000
+bone material material material bone material texture frame
+0.500000 texture bone = material vertex anim
+0.500000 texture 0.500000
+0.500000 = = frame frame anim material = 1.0
+bone
+anim -1
+texture
+-1 =
+0.500000
+0.500000 -1
+bone
+0.500000 texture = anim material 0.500000 1.0 vertex vertex vertex = bone
+-1
+-1 anim 0.500000
+0.500000 vertex vertex = bone texture vertex material anim = texture -1
+-1 material 1.0 0.500000 bone frame bone
+texture
+texture
+texture = vertex texture 0.500000 texture
+1.0 bone material
+frame -1
+vertex -1
+material texture
+0.500000 anim 1.0 1.0 vertex vertex
+-1 material -1 texture
+vertex texture
+texture vertex material -1 = material 1.0 = frame bone
+anim frame frame
+vertex anim 0.500000 anim bone texture
+anim = texture material
+-1 vertex
+= vertex
+0.500000 -1 1.0 vertex
+material 0.500000 anim bone texture
+bone = material bone
+frame material bone
+anim
+=
+0.500000 material vertex material texture frame
+1.0 material anim
+0.500000 -1
+vertex
+material
+-1 -1
+vertex texture 0.500000 0.500000
+material
+bone -1 = material material bone texture = texture 0.500000
+material 0.500000 vertex vertex
+bone
+material bone anim anim
+bone -1 1.0 0.500000 material 0.500000 =
+0.500000 bone =
+texture 0.500000 bone texture
+0.500000 0.500000
+anim material vertex 0.500000
+0.500000 material vertex anim 0.500000 = -1 frame
+texture anim -1
+-1 0.500000
+vertex
+0.500000 1.0 -1
+-1
+texture 0.500000 bone
+vertex
+0.500000 material material material frame vertex 1.0 bone -1
+frame anim frame
+texture material anim
+-1
+bone 1.0
+anim 1.0 frame frame anim
+vertex material frame texture
+anim bone
+0.500000
+1.0
+vertex material -1 anim frame bone frame = anim 1.0 0.500000 bone
+-1
+1.0 frame texture material vertex = material
+frame vertex
+-1 vertex
+1.0 -1 = material material anim 0.500000 vertex vertex material material anim vertex
+anim material vertex bone material
+frame = bone bone frame 0.500000 material texture frame
+frame bone 1.0 anim
+texture
+vertex
+-1 -1 -1
+vertex
+texture -1 1.0 material =
+1.0
+bone bone anim
+= anim
+vertex
+frame 1.0 texture 1.0 bone vertex material -1 = 0.500000 bone
+anim frame
+vertex texture 1.0 texture material texture
+frame
+= 1.0
+material anim -1
+vertex =
+anim 1.0 1.0
+vertex = frame bone anim anim anim frame
+texture frame -1
+frame frame material 1.0 1.0
+anim vertex frame bone anim
+vertex texture -1 frame material =
+-1 anim anim
+material frame vertex texture material bone anim
+vertex
+frame
+texture material texture
+frame anim vertex 0.500000
+material anim frame
+material
+0.500000 0.500000 bone anim 0.500000
+vertex
+0.500000 1.0
+vertex
+bone =
+anim
+1.0 0.500000 anim -1 anim frame 1.0 bone texture
+= frame 1.0 texture vertex vertex
+0.500000 texture bone
+= texture = frame material vertex
+vertex vertex anim vertex = = texture 0.500000 texture 0.500000 frame = vertex anim frame -1 0.500000 vertex anim texture = 1.0 0.500000 = material =
+0.500000
+vertex material material vertex
+-1
+vertex 0.500000 bone texture vertex 0.500000 texture
+1.0
+1.0 1.0 frame material
+texture
+-1 bone = anim
+anim = bone material bone material material frame texture texture
+= texture material
+anim texture anim
+frame 0.500000
+bone bone = material
+= 1.0 -1
+1.0
+0.500000 frame bone 1.0 bone
+anim bone
+-1 vertex bone 0.500000
+frame 0.500000
+1.0 anim
+vertex texture
+anim
+bone texture vertex
+= =
+vertex
+texture
+-1 anim
+= bone 0.500000 vertex 0.500000 material vertex material material texture anim frame -1
+frame material frame anim material
+0.500000 -1 1.0 0.500000 texture
+1.0 vertex = vertex material 1.0
+bone anim frame material texture frame anim texture 0.500000
+= vertex 1.0 material texture vertex
+anim anim 0.500000 =
+anim texture 0.500000 frame material = -1 vertex -1 bone bone
+material 0.500000 bone
+= bone
+bone
+frame frame
+bone -1 material 0.500000 vertex vertex vertex anim 0.500000 1.0 texture bone 1.0 frame 0.500000 bone 1.0 -1 1.0 -1 0.500000
+bone
+frame bone bone -1
+bone 0.500000 texture vertex
+vertex -1 -1 1.0 -1
+material bone -1 0.500000
+0.500000 =
+material
+1.0 1.0 anim material anim anim 1.0 material
+bone
+vertex
+anim -1 0.500000
+bone -1
+-1 anim vertex material vertex anim 0.500000 1.0 -1 anim texture -1 vertex -1 material
+material texture frame
+vertex 0.500000 anim 0.500000 -1 bone frame vertex 1.0 -1 frame frame
+anim 1.0
+= 1.0 = anim 0.500000 0.500000 anim material 0.500000 1.0 texture anim
+material
+= vertex -1 frame
+frame
+vertex frame material
+bone
+frame bone bone bone anim 1.0 -1 -1 texture bone texture
+= = frame anim texture vertex
+material material = texture
+anim bone material = material vertex
+1.0 bone anim
+vertex material 0.500000 frame frame
+1.0
+=
+frame 0.500000 1.0
+anim frame materi
\ No newline at end of file
@@ -0,0 +1,262 @@
+material
+1.0 -1 1.0 material
+vertex
+bone texture 1.0
+-1 texture
+anim anim -1 1.0
+1.0 -1 1.0 = = texture
+= anim = = -1 texture bone -1 vertex
+0.500000
+anim = bone
+vertex frame anim 1.0 -1 vertex vertex anim -1 anim 1.0 0.500000
+-1 material
+frame
+= = -1 1.0 anim 0.500000
+1.0 = frame
+vertex 0.500000 frame
+texture bone
+material =
+frame = bone 1.0
+texture anim 0.500000 0.500000 vertex texture anim vertex
+anim = texture 0.500000
+frame = = texture
+anim = = -1 = -1 material -1 frame = vertex -1 = vertex
+1.0 vertex
+anim
+texture material bone
+material
+= bone
+vertex frame -1 texture bone = 0.500000 anim
+frame texture
+-1
+-1 vertex bone vertex
+1.0 =
+-1 anim
+material vertex vertex vertex
+bone
+anim = anim 0.500000
+1.0 = anim frame 0.500000 = 0.500000 = material -1 0.500000 anim texture material vertex anim -1
+material frame texture anim texture =
+1.0 = 0.500000
+vertex -1 anim -1
+bone frame frame
+= texture frame bone bone vertex frame
+vertex 0.500000 = 1.0 texture 1.0
+anim
+frame anim bone texture material
+bone material
+vertex -1
+anim anim
+= anim
+bone vertex frame
+-1
+anim = 0.500000
+anim vertex vertex texture = -1
+anim material
+-1 texture
+bone frame anim anim 0.500000 -1
+0.500000 1.0 1.0 =
+=
+texture
+-1 vertex
+-1 = vertex 0.500000
+bone vertex 1.0 anim -1 texture texture vertex
+1.0 material anim
+vertex vertex
+1.0 =
+bone frame
+material anim frame bone
+= -1 bone vertex
+1.0
+1.0 0.500000
+-1 0.500000 frame bone 0.500000
+material = 1.0 1.0 1.0 0.500000 1.0
+texture
+1.0 1.0
+vertex 0.500000 -1 1.0 texture 0.500000 1.0 material = 1.0 bone texture bone frame vertex frame anim
+= 1.0 texture -1 1.0 material bone material texture 1.0 -1 material material
+anim
+anim = frame -1 vertex 1.0 material texture -1
+material
+bone texture vertex -1 1.0
+-1 bone = vertex
+vertex
+material
+anim frame
+= -1
+-1 = material
+-1 = anim
+frame material
+0.500000 = =
+texture vertex texture material = frame bone material bone = 0.500000
+material
+material
+bone anim frame 0.500000 = -1 =
+texture 1.0 = bone material
+anim
+= vertex = vertex anim bone bone 1.0 1.0
+material bone 0.500000 bone
+frame material
+1.0 material 1.0
+=
+texture material frame = texture 1.0 bone frame frame vertex
+texture
+vertex 1.0 frame material 1.0 frame material = frame
+material bone
+0.500000 frame 0.500000 material 0.500000 material
+-1 -1 frame 1.0 0.500000 material bone texture frame vertex -1 material material
+anim material
+= 0.500000 1.0 -1
+anim
+material -1 1.0 anim =
+material
+-1 anim = 1.0 0.500000 0.500000 1.0
+material 0.500000 1.0 vertex texture vertex
+material vertex =
+-1 vertex anim bone
+0.500000 1.0 = 0.500000 material
+-1 texture
+material -1 material texture
+0.500000 1.0
+bone 1.0 1.0 -1 bone anim texture bone texture -1 frame = vertex
+-1 material -1 vertex 0.500000 = frame frame
+=
+bone material vertex -1
+0.500000 1.0 vertex material = material -1 0.500000 = vertex -1 =
+-1
+=
+= -1 = -1 texture frame vertex bone texture
+-1 0.500000 anim -1
+texture -1
+= frame anim -1 1.0 bone frame frame
+material = frame
+texture material texture
+texture vertex -1
+1.0 -1
+anim texture
+= =
+0.500000 texture = -1 -1 1.0
+frame = 0.500000 frame
+bone material vertex bone material anim vertex vertex -1 -1 0.500000 frame material anim frame 1.0
+vertex
+0.500000 frame
+frame =
+vertex bone
+1.0 1.0 1.0
+anim
+bone bone = texture anim -1 bone
+1.0 1.0
+frame 0.500000 vertex bone
+material material
+= material
+-1
+bone frame material 0.500000 = texture vertex
+-1 vertex -1 vertex bone = vertex frame vertex material bone anim 1.0 vertex = material =
+1.0 1.0 1.0 bone bone 0.500000 1.0 1.0
+0.500000
+texture frame
+anim
+0.500000
+anim -1 material anim =
+texture vertex 0.500000 bone bone bone bone vertex = bone
+=
+-1 = bone 0.500000 -1 material
+texture vertex
+frame material =
+material = 1.0 anim vertex
+vertex =
+anim anim vertex 1.0 material vertex anim texture texture
+material bone 0.500000 = = texture
+frame -1
+frame bone 0.500000 0.500000 vertex texture = texture -1 bone frame bone frame vertex
+frame frame
+material vertex
+vertex anim
+-1 material
+1.0 vertex bone bone texture
+material anim material
+1.0 vertex
+1.0
+1.0
+texture
+0.500000
+frame =
+texture 1.0 0.500000 frame frame
+-1 vertex 1.0
+0.500000 vertex material = -1 vertex
+-1 frame vertex vertex anim 0.500000 anim
+1.0 material
+texture 0.500000
+vertex bone = material -1
+-1 0.500000 1.0 bone
+vertex 1.0
+material frame 1.0 = 0.500000
+texture =
+frame bone material 0.500000 material frame frame
+=
+1.0 vertex vertex
+bone 0.500000 anim anim
+-1 bone frame frame = texture 1.0
+0.500000 = = texture = bone vertex
+material 0.500000 vertex texture 1.0 bone 1.0 1.0 -1 anim frame vertex 1.0
+texture frame
+material = = material vertex
+0.500000 -1 -1 0.500000 1.0
+material bone 1.0 texture bone material 1.0 frame
+vertex
+0.500000 bone = anim
+texture 0.500000
+1.0 1.0 vertex = vertex
+frame texture 0.500000
+0.500000 -1
+anim anim frame
+frame
+0.500000 anim frame 0.500000 material anim material texture =
+= anim bone frame
+frame
+anim 1.0 1.0 bone
+=
+0.500000 -1
+material -1
+material = texture texture frame anim vertex
+vertex 1.0 texture 1.0 0.500000
+0.500000 texture frame 0.500000 -1 -1
+vertex 0.500000
+bone
+-1 = texture 0.500000 vertex material
+material anim bone -1 frame 1.0 bone
+= frame = = anim vertex anim =
+material vertex -1
+anim material
+frame bone 0.500000 texture
+1.0 -1 frame -1 -1 1.0 1.0 bone = -1 1.0
+0.500000 texture = vertex anim 1.0 = frame
+-1 -1 texture bone
+frame texture vertex bone
+material bone -1
+material frame frame anim anim
+anim bone -1
+anim texture 0.500000 frame anim
+texture
+vertex frame material =
+texture 0.500000 material vertex frame anim vertex material anim anim
+0.500000 vertex vertex -1 material vertex -1
+0.500000
+-1 vertex frame =
+1.0 bone vertex bone = -1 vertex 1.0 = = vertex frame texture anim anim vertex 0.500000
+material -1 frame 1.0 0.500000 bone vertex 0.500000 0.500000 = bone -1 bone anim bone material frame
+=
+0.500000 bone anim = 0.500000 material bone bone 1.0 texture
+bone -1 texture frame frame anim frame
+0.500000 -1 texture anim material
+1.0
+1.0 anim texture -1 anim material material
+texture 1.0 1.0 0.500000 =
+material
+vertex 0.500000
+anim 1.0 material material
+1.0 -1 bone bone
+bone bone anim
+texture
+material bone
+frame -1 texture = 0.500000 -1 -1 frame = ver
\ No newline at end of file
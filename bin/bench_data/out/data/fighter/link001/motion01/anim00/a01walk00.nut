@@ -0,0 +1,18 @@
+bone 0.500000
+anim
+anim frame
+texture =
+-1 0.500000 0.500000 0.500000 frame
+vertex material = -1 vertex 0.500000 texture vertex
+texture
+vertex 1.0
+vertex
+-1
+material
+frame texture 1.0 texture anim = -1 0.500000 vertex
+material
+0.500000 -1 -1 frame
+1.0 material -1
+texture
+= texture texture anim 0.500000 bone vertex material -1 -1 -1
+texture 
\ No newline at end of file
@@ -0,0 +1,27 @@
+material bone -1 1.0
+= anim
+bone
+texture vertex
+anim vertex bone
+frame
+vertex
+vertex frame
+anim bone
+frame material 0.500000 material
+material
+0.500000 vertex
+=
+bone = 1.0 -1 0.500000 anim
+frame
+material texture = texture 1.0 texture
+material 1.0 1.0 texture
+-1
+= vertex 1.0
+frame vertex
+vertex
+0.500000 texture material vertex material
+anim = 1.0 texture texture frame frame frame 0.500000
+bone = 1.0
+vertex vertex
+0.500000 bone = vertex
+bone frame frame anim a
\ No newline at end of file
@@ -0,0 +1,8 @@
+material 0.500000
+vertex material = 0.500000
+frame material 1.0 =
+vertex vertex 1.0 0.500000 vertex 1.0 -1 frame
+anim vertex
+1.0 material
+material 0.500000 vertex frame material
+frame anim vertex vertex 0.500000
\ No newline at end of file
@@ -0,0 +1,91 @@
+0.500000 texture bone
+material
+0.500000 = 0.500000
+0.500000
+texture
+= vertex frame =
+material 1.0 texture texture anim anim anim bone vertex bone 1.0 texture frame 0.500000 = texture vertex bone 1.0 1.0 0.500000
+= frame
+0.500000 frame material texture frame
+0.500000 anim 1.0 anim
+0.500000
+anim 0.500000
+vertex 1.0 = material
+1.0
+-1 vertex frame = vertex
+-1 -1 -1
+= bone 1.0 material
+= =
+bone
+frame material -1 =
+0.500000 1.0
+-1 texture = texture bone -1 0.500000
+vertex anim 1.0 frame -1
+0.500000
+material 1.0 bone material frame
+-1 1.0
+-1 -1 anim texture material vertex material vertex 1.0 = anim = texture anim
+frame
+vertex bone
+frame material vertex anim
+= -1
+0.500000 0.500000 texture 1.0 1.0 1.0
+vertex -1 vertex vertex -1 1.0 texture = 0.500000
+-1
+anim
+anim
+vertex
+frame 1.0 0.500000
+frame material texture vertex material frame 1.0 frame
+-1 anim anim frame 0.500000 vertex
+vertex vertex -1 0.500000 1.0 =
+anim frame 1.0
+material
+1.0 1.0 texture bone frame texture
+texture texture anim frame 1.0
+texture 0.500000
+texture texture texture anim -1 bone vertex
+vertex -1 bone frame = -1 -1 anim 1.0 0.500000
+-1 bone vertex 0.500000 vertex frame material
+=
+texture material vertex bone
+=
+1.0 0.500000 vertex anim anim
+material vertex texture bone
+material 1.0 texture
+= material material 1.0 -1 0.500000 -1
+frame 0.500000 vertex texture
+texture material anim = 1.0
+= =
+-1 1.0 =
+0.500000 frame vertex
+bone 1.0
+vertex bone frame
+0.500000
+texture
+0.500000 1.0
+0.500000 0.500000 -1 1.0 0.500000 vertex bone 1.0
+1.0 bone
+vertex
+texture
+vertex texture texture material 0.500000 material -1 anim
+-1 vertex
+frame -1 material
+anim texture 1.0 bone material = 1.0 -1 texture
+0.500000 texture = 0.500000 frame 0.500000 material
+material material bone -1 -1 vertex
+1.0
+frame bone -1 0.500000
+= material 0.500000 1.0 anim
+material 0.500000 1.0 0.500000
+material vertex
+material
+vertex = anim 0.500000 1.0 material
+=
+anim vertex = anim
+0.500000 material bone 1.0 1.0 -1 = -1 vertex bone 0.500000 vertex
+=
+anim frame = texture texture anim frame -1 vertex
+material anim texture 1.0 anim
+frame anim bone 0.500000 =
+vert
\ No newline at end of file
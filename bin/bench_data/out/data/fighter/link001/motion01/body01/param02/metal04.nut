@@ -0,0 +1,16 @@
+vertex anim material
+-1 vertex material 0.500000 -1
+frame frame 0.500000 bone
+0.500000 0.500000 -1 vertex bone
+bone 1.0 texture
+=
+=
+material material bone -1 bone bone frame bone material material texture vertex anim
+anim bone 0.500000 frame anim
+vertex frame
+texture 0.500000
+= material 1.0 anim
+0.500000 1.0 vertex -1 frame = anim material
+vertex bone frame = texture -1 texture frame material material frame 0.500000 -1 texture
+material
+vertex frame 0.500000
\ No newline at end of file
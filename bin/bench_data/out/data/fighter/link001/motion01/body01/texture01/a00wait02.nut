@@ -0,0 +1,79 @@
+0.500000 vertex bone
+1.0 bone vertex
+-1 bone 0.500000
+material material vertex vertex anim anim vertex bone
+1.0 vertex = material frame texture vertex material anim anim vertex = texture 1.0 frame
+anim 1.0 1.0 -1 material vertex
+frame frame 1.0 vertex anim material frame -1
+1.0 texture vertex =
+-1 1.0 0.500000 -1 frame 1.0 vertex -1 bone -1
+texture
+1.0
+bone 0.500000 frame
+bone
+-1 texture anim = 0.500000 material = anim -1 frame 1.0 = 0.500000 -1 -1 = 1.0 bone texture frame frame material
+anim bone material
+texture 1.0 material
+bone texture
+0.500000 texture = = anim -1 vertex
+texture texture = vertex
+anim frame -1 1.0
+vertex -1 frame 0.500000 0.500000 0.500000 vertex texture bone frame
+material frame = 0.500000 texture anim = anim
+texture = vertex
+= -1
+material vertex
+frame texture anim
+frame -1 0.500000 material bone material 1.0 0.500000 anim 0.500000 material = vertex = 0.500000 bone frame = 1.0
+texture frame 0.500000 = 1.0 0.500000
+texture
+frame texture
+bone vertex texture anim -1 frame anim
+1.0 0.500000 vertex vertex -1 = frame frame bone = -1 0.500000 vertex
+1.0 texture frame 1.0 bone material
+anim frame vertex
+bone
+bone vertex 1.0
+0.500000 = material frame 1.0
+bone = material 0.500000
+-1 1.0 anim
+bone 1.0 vertex
+1.0 0.500000 =
+vertex frame
+= frame 0.500000 0.500000 bone vertex material bone
+1.0
+1.0 bone
+vertex
+= bone vertex
+material
+1.0
+material 0.500000 bone vertex
+frame -1 vertex texture bone 0.500000
+anim anim 0.500000 frame
+vertex -1
+= 1.0 material material material bone 0.500000 -1
+frame = vertex 0.500000 vertex vertex -1 -1 0.500000 vertex
+texture anim bone anim
+frame
+= 1.0 frame
+frame
+0.500000 = 0.500000
+0.500000
+vertex = frame = 1.0 0.500000 material anim 1.0
+-1
+vertex texture
+anim -1
+1.0
+vertex 0.500000 bone frame anim frame
+bone
+vertex
+material 1.0 = = anim frame frame
+vertex bone frame =
+0.500000 bone
+-1 frame = vertex vertex vertex 0.500000 vertex
+1.0 = material material
+material 1.0
+1.0 frame anim
+texture vertex bone 1.0 material 0.500000 material = = anim texture texture
+frame -1 = = 0.500000 1.0 1.0 frame anim frame
+f
\ No newline at end of file
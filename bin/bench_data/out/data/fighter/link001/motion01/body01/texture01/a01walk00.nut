@@ -0,0 +1,95 @@
+bone
+1.0
+frame 0.500000 0.500000
+texture
+1.0 vertex 1.0
+0.500000 material -1
+frame texture texture
+= anim
+bone 1.0 frame anim -1 1.0 1.0
+0.500000
+-1 vertex
+0.500000 vertex anim
+-1
+frame vertex
+0.500000 bone vertex
+anim
+-1
+vertex bone frame
+bone texture
+bone
+-1 -1 texture material anim anim material 1.0
+= bone material 0.500000 -1 material = 0.500000
+0.500000 0.500000 vertex frame -1 frame material anim vertex material frame frame texture anim material frame = 1.0 -1
+anim 0.500000 =
+0.500000 -1 anim 1.0
+= = 1.0 1.0 1.0 = 0.500000
+anim material
+=
+texture
+1.0 0.500000 material bone -1 -1 frame vertex = frame
+vertex -1 = 1.0 = 0.500000 material
+anim 0.500000 frame anim
+0.500000 bone texture
+bone
+material =
+material texture texture
+anim anim anim texture
+frame -1
+frame -1 bone material
+bone 0.500000
+= bone
+bone -1 vertex anim -1 0.500000 texture anim
+= anim
+vertex
+1.0 texture 0.500000
+bone 1.0 1.0 anim anim 1.0 frame 1.0 frame anim texture
+0.500000
+1.0
+1.0 0.500000 -1 =
+material = texture texture material = -1 = 0.500000 0.500000 vertex 0.500000
+-1 -1 bone vertex anim
+0.500000 frame =
+material
+bone
+-1 material
+texture
+frame
+-1 texture
+anim vertex
+frame
+material material texture = material texture bone frame 1.0 bone
+vertex
+frame 1.0 0.500000 material
+-1
+texture 1.0 frame vertex frame
+= frame material vertex anim
+frame frame
+texture 1.0 = -1
+=
+-1 vertex
+frame frame
+1.0 bone 1.0 = anim
+0.500000 -1 vertex texture frame anim material 0.500000 = material
+0.500000 anim 1.0 frame bone 1.0 vertex
+anim
+material
+1.0
+texture 1.0 -1 = texture = = material bone frame texture frame -1 vertex 1.0
+1.0 1.0 0.500000 bone 1.0 anim 0.500000 = anim frame = 0.500000 anim 1.0 texture
+0.500000 bone 0.500000
+anim frame vertex 1.0 frame
+= -1 -1
+0.500000 texture -1 0.500000 1.0 bone frame 1.0
+-1
+texture anim material
+frame =
+texture
+frame bone 1.0 0.500000 bone vertex material
+-1 material 0.500000
+vertex bone =
+0.500000 texture -1
+frame 1.0
+=
+frame anim
+frame 
\ No newline at end of file
@@ -0,0 +1,33 @@
+0.500000 -1 0.500000 = 0.500000
+-1 anim anim
+bone bone
+texture frame bone -1 -1
+vertex 0.500000 bone frame material
+= vertex vertex vertex vertex material
+texture 1.0 material -1 material texture frame anim 1.0 = bone
+vertex texture material bone anim -1 anim 0.500000
+bone -1 vertex
+material frame
+bone vertex anim -1
+-1 bone bone texture 1.0 1.0
+texture material
+anim vertex = anim
+=
+anim 0.500000
+bone anim texture = frame 1.0 0.500000 frame
+1.0 material =
+vertex frame 0.500000 frame vertex 1.0
+-1
+material frame bone = -1 1.0 texture texture bone frame material
+frame 0.500000 texture frame anim
+frame
+= = material texture = -1
+0.500000 1.0
+0.500000 1.0 frame texture anim 1.0 = 1.0 bone
+vertex
+0.500000 1.0
+= bone -1
+material -1 vertex bone 0.500000 texture = 0.500000
+frame
+vertex
+= anim
\ No newline at end of file
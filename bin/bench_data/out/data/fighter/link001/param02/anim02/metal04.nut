@@ -0,0 +1,4 @@
+0.500000 -1 frame
+-1
+1.0 bone frame =
+bone material 1.0 = 
\ No newline at end of file
@@ -0,0 +1,38 @@
+0.500000 -1 frame
+texture -1
+frame =
+1.0 material
+=
+bone
+anim vertex vertex 1.0 1.0
+= texture bone
+-1
+texture vertex frame
+bone material
+-1 bone 1.0
+-1
+material material 1.0 =
+0.500000 bone
+0.500000 bone bone
+frame texture vertex -1 material 1.0 anim vertex -1 bone 0.500000 anim frame
+-1 0.500000 -1 -1 0.500000
+-1 -1
+texture
+bone -1 0.500000 0.500000
+frame -1 bone bone
+vertex
+0.500000
+0.500000 texture frame vertex 1.0 texture material
+=
+texture anim
+0.500000 anim -1 texture material
+= 1.0 = material vertex
+= 1.0 =
+anim vertex material vertex material texture -1 anim 0.500000 vertex -1 1.0 =
+anim vertex
+frame frame anim vertex
+= 1.0
+texture
+texture -1 0.500000
+= 1.0
+bone -1 1.0 bone = = 0.500000 
\ No newline at end of file
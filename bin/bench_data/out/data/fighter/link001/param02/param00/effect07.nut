@@ -0,0 +1,178 @@
+0.500000 1.0
+anim anim
+texture material bone
+-1 frame -1
+1.0 material frame vertex material 0.500000 -1
+1.0 0.500000 -1 bone anim vertex bone
+anim
+frame
+material
+frame
+material vertex anim 1.0 = -1 vertex
+vertex texture vertex -1 anim 0.500000 texture
+1.0
+texture 1.0 vertex vertex 0.500000 -1 = texture
+material = =
+= frame -1
+texture anim
+material 0.500000 -1 vertex -1
+-1 frame = texture
+anim
+texture bone = 0.500000 frame
+texture vertex
+frame frame
+1.0 1.0 frame
+material vertex material
+vertex
+0.500000 anim 1.0 -1 1.0 = 1.0 vertex = -1 frame 0.500000
+material texture 0.500000 -1 vertex vertex anim vertex 0.500000
+0.500000 anim
+vertex =
+texture -1 -1 texture bone texture vertex
+frame frame frame material bone anim anim
+vertex bone texture
+0.500000 material frame texture vertex
+texture material texture
+= texture -1 0.500000 anim 0.500000 0.500000 anim
+frame 1.0 frame material material anim anim vertex 0.500000 frame 0.500000
+0.500000 material texture anim
+= material -1 anim vertex
+frame anim anim texture 1.0 1.0 -1 vertex
+vertex
+texture =
+vertex = anim -1 1.0 texture vertex frame
+anim
+material frame vertex
+frame 0.500000 -1
+0.500000 vertex
+texture 1.0 = 0.500000 1.0 anim 1.0 bone vertex =
+bone vertex = bone bone
+anim
+vertex material
+bone -1 material vertex texture =
+texture -1 material
+0.500000
+frame bone material = -1 0.500000 bone material texture
+0.500000 = frame
+material texture = material anim 1.0 =
+material 0.500000 material
+anim bone material
+0.500000 frame
+bone frame vertex 1.0 frame -1 vertex -1 bone
+bone = frame
+anim 1.0 =
+bone bone -1 0.500000
+vertex
+frame
+texture vertex
+= bone vertex
+texture anim
+vertex anim
+bone -1 bone = frame 1.0 -1
+material material bone vertex
+material -1
+0.500000 anim 1.0 1.0
+texture frame
+1.0 material bone anim texture = bone -1 frame -1
+1.0
+vertex texture 1.0
+texture material 1.0
+material
+= = 0.500000 = bone material
+-1 0.500000 frame 1.0 texture anim
+texture
+0.500000
+1.0 frame texture texture
+bone anim
+= texture
+bone 0.500000
+-1 1.0
+vertex 1.0
+=
+1.0 bone
+= frame
+0.500000 texture
+bone
+frame
+frame 1.0
+1.0 texture -1 1.0 -1 -1 0.500000
+= -1
+texture vertex frame
+0.500000 bone frame frame texture 1.0 =
+frame frame -1 -1 -1
+frame
+-1 1.0 material
+vertex = bone bone vertex texture texture
+material anim
+= anim
+1.0 anim
+material
+-1
+-1
+material frame 1.0 0.500000 vertex 0.500000 bone
+material
+vertex
+material vertex -1
+anim
+-1
+anim bone material vertex
+material anim
+1.0 anim frame 0.500000 material texture texture -1
+bone
+vertex
+anim = texture anim = bone
+vertex
+material -1
+-1
+texture
+1.0 texture
+-1 anim vertex material = material bone = anim vertex = bone
+bone 1.0 texture anim
+=
+1.0 vertex frame
+frame bone
+frame frame
+0.500000 material
+frame 1.0 anim anim vertex texture =
+material texture
+texture frame material 1.0
+texture
+-1 0.500000
+-1 = frame -1 bone material
+0.500000 material vertex -1 texture
+-1 frame
+frame texture 0.500000 -1 -1
+frame 0.500000 bone
+texture material
+0.500000 anim -1 = = texture
+1.0 1.0 0.500000 -1 -1 1.0 texture material -1 1.0 anim bone 1.0 texture bone -1 = material -1 vertex material vertex frame material material vertex = anim bone bone = 0.500000 texture bone
+= frame vertex material = texture 0.500000 1.0 vertex -1
+texture texture
+frame = vertex
+0.500000 = frame -1 texture
+=
+frame material
+0.500000 vertex
+0.500000 = bone
+-1 frame frame material 0.500000 material anim material bone 1.0 frame bone 0.500000 vertex bone vertex
+1.0
+-1
+0.500000
+frame texture =
+0.500000
+bone
+0.500000 anim texture anim vertex texture 0.500000 texture texture anim
+1.0 material 0.500000 0.500000 = bone -1 bone frame
+0.500000 0.500000
+vertex
+0.500000
+1.0
+vertex 1.0 anim bone
+-1 = -1
+= bone
+1.0 frame 1.0 = texture material anim anim 1.0 -1 1.0 -1
+bone = material texture 1.0
+material
+material vertex
+anim material -1
+bone vertex 1.0 = vertex anim texture 1.0 1.0 vertex = anim = -1 tex
\ No newline at end of file
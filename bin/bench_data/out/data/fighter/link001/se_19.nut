@@ -0,0 +1,2 @@
+0.500000 vertex -1
+1.0 texture material bone f
\ No newline at end of file
@@ -0,0 +1 @@
+'SRrbQh׆!uǪ*]"^KB+2R0q#jiK̉gq6]9íu9rZ<fDUrrkg	[2G$ڙi?C__)+A0/Sp>xϲmqMMn2]LWOOh*]d05NLJ|ʭaX\ɣ`(3JBXlh^ Zkc)[aE+>Ffw0|4\)Qq)sn˱8YR¹OHn*~ShQyg4S?%n*`Z^~%y9$ȶHč@JMXCOWv
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture vertex frame
+-1
+-1 anim frame 0.500000
+texture frame vertex =
+0.500000 = anim bone
+vertex
+-1 vertex frame 0.500000 -1 1.
\ No newline at end of file
@@ -0,0 +1,106 @@
+0.500000 frame anim 1.0
+bone
+0.500000 texture frame 1.0 texture bone = material frame anim material
+anim
+-1 1.0
+1.0 frame
+bone -1 frame -1 material = frame = anim bone anim frame bone material
+texture material anim frame
+material
+bone anim = anim -1
+= vertex bone bone
+texture bone material frame anim =
+frame 1.0 bone texture anim vertex 0.500000
+material
+bone anim
+1.0
+material -1 = = -1 -1 texture material
+vertex texture 1.0 vertex frame texture
+anim 0.500000 frame 1.0
+-1 frame -1 bone frame texture bone
+frame =
+material vertex
+-1 texture frame
+frame 1.0 1.0 -1 vertex
+material frame bone texture
+material =
+-1 0.500000 0.500000 vertex texture texture
+texture
+= texture anim material vertex 1.0 material vertex 1.0 vertex
+material = bone -1
+bone = vertex 0.500000 frame = 1.0 bone
+material
+frame
+bone
+= vertex anim = 0.500000 0.500000 -1
+1.0 -1
+0.500000 texture bone -1 texture 1.0 =
+anim
+bone anim 0.500000 bone
+frame texture anim -1 1.0
+frame 0.500000 1.0 1.0 -1 material material texture =
+= frame vertex frame material 0.500000 bone -1 texture 1.0
+0.500000 frame 0.500000 anim -1 -1 1.0
+frame
+bone
+anim 0.500000
+-1 = bone
+bone
+-1 frame
+-1
+texture
+texture vertex
+frame =
+=
+-1 material -1
+frame material bone
+vertex frame = 1.0 1.0 frame -1 bone bone frame 0.500000 anim anim frame
+texture = 1.0 bone bone vertex
+=
+frame frame = 0.500000
+= bone bone 0.500000
+texture material
+0.500000 0.500000 anim
+1.0
+= bone -1
+0.500000 anim
+1.0 frame
+bone 1.0
+= vertex texture material bone frame frame -1 = frame frame 1.0 0.500000
+-1 =
+0.500000 0.500000 1.0 texture frame
+anim frame material vertex
+vertex
+texture bone
+-1 = anim 0.500000 texture
+0.500000
+0.500000 texture -1 material anim
+vertex material
+frame anim -1 material frame
+-1 = texture
+material frame bone bone =
+vertex
+bone vertex texture =
+0.500000 vertex bone 1.0 0.500000 = vertex anim -1 0.500000 material
+0.500000 vertex
+anim anim
+material material -1 bone anim 0.500000 1.0
+= 1.0 bone =
+= -1 texture
+bone -1 bone
+0.500000 bone vertex -1 material -1 material 1.0 0.500000 texture
+texture bone vertex vertex vertex frame 1.0 -1
+frame anim
+1.0
+material bone
+material frame bone = texture 1.0 frame
+=
+material texture material frame = frame vertex
+texture anim frame vertex -1
+-1 texture 0.500000 texture texture
+texture =
+1.0
+anim
+0.500000
+texture vertex
+= 0.500000 = tex
\ No newline at end of file
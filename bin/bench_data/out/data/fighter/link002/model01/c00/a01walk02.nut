@@ -0,0 +1,308 @@
+0.500000 vertex anim material = 0.500000 frame 1.0 material 1.0
+texture
+0.500000 anim frame vertex -1 anim
+texture frame -1 material vertex
+-1 = 1.0 0.500000 1.0 material material
+bone
+= material vertex frame 1.0 vertex vertex
+-1 anim texture
+-1 1.0
+texture = anim vertex
+texture material -1 frame material 1.0 material frame anim frame -1 -1 1.0 0.500000
+-1 -1 vertex material
+1.0 1.0 anim frame 1.0
+0.500000 vertex
+0.500000 texture frame texture
+-1 bone -1
+frame
+texture 1.0 bone 1.0
+bone vertex
+bone frame texture 1.0 bone -1
+material vertex bone 1.0 frame bone vertex -1 -1 = -1 -1 vertex
+bone anim vertex
+bone frame bone texture anim 0.500000 frame material anim -1 anim texture anim 0.500000 = material 0.500000 frame vertex -1 vertex material material material bone = -1 material bone =
+=
+1.0 texture
+frame
+-1 vertex 0.500000 0.500000 anim =
+-1 -1
+vertex frame
+= frame
+bone texture = 1.0
+vertex -1 anim
+frame vertex
+-1 vertex vertex
+anim
+1.0
+material bone 0.500000 vertex
+anim anim = vertex 0.500000 texture 1.0 =
+frame 0.500000
+texture
+frame
+bone bone
+0.500000
+-1 frame
+0.500000
+-1 frame 1.0 material frame
+vertex anim anim
+bone 1.0 -1 anim
+0.500000
+0.500000
+0.500000 texture bone -1 = 0.500000
+1.0 1.0
+= 1.0 1.0 0.500000 material
+bone
+-1 material vertex -1 0.500000 vertex texture vertex = anim bone vertex frame
+0.500000 material 1.0 vertex
+= 0.500000 anim bone 1.0 vertex texture anim vertex vertex -1 anim 1.0 -1 frame 0.500000 frame
+-1 0.500000 texture anim 0.500000 anim 0.500000 = 1.0
+0.500000 anim anim = bone
+-1
+0.500000 frame
+anim
+frame
+frame
+1.0 = vertex bone 0.500000 bone anim anim -1 0.500000 texture
+vertex -1 anim frame bone 1.0 0.500000 material
+bone material material = bone texture
+material
+material 1.0 bone =
+material anim -1 =
+frame
+1.0 anim bone 0.500000 texture vertex -1 anim vertex 1.0
+texture texture = = material texture anim 1.0 frame
+bone texture texture bone
+anim
+texture 0.500000 bone texture vertex anim 1.0 texture texture 1.0 1.0 anim frame 0.500000 anim bone = vertex texture 1.0 1.0 vertex
+texture
+anim vertex = texture
+1.0
+= bone
+=
+anim vertex vertex texture texture vertex -1 -1 bone
+-1 frame material frame vertex material
+frame material 1.0 =
+material -1 vertex =
+= vertex vertex 0.500000 frame vertex
+1.0
+anim 1.0 =
+0.500000 0.500000 1.0
+vertex material texture material
+bone texture frame texture bone
+=
+bone material 1.0 texture = bone vertex bone
+-1 vertex 1.0 vertex
+texture frame material
+0.500000 1.0
+=
+vertex 0.500000 vertex =
+frame -1 frame vertex bone frame
+1.0 0.500000
+= 0.500000 1.0 vertex 0.500000
+texture
+texture 1.0
+anim vertex texture -1 1.0
+0.500000
+material 0.500000 anim frame bone = texture frame material
+material
+anim =
+frame
+-1
+vertex
+frame vertex
+1.0 anim texture texture bone frame
+bone vertex vertex vertex material
+1.0 0.500000
+= -1 -1 material anim texture vertex
+anim 1.0 material bone
+bone -1
+1.0
+texture
+texture
+=
+-1 anim bone material 0.500000 bone
+anim bone 0.500000
+vertex frame vertex
+material 0.500000 =
+frame material anim vertex 0.500000 1.0 bone -1 -1 vertex material vertex =
+0.500000 material = -1 anim anim frame
+= anim
+texture
+texture 1.0
+1.0 vertex bone texture material frame material texture bone texture vertex frame
+anim frame
+vertex vertex material material
+texture bone frame bone
+anim anim 0.500000
+-1 1.0
+texture
+bone bone 1.0 vertex material -1 vertex 1.0 1.0 anim bone frame 0.500000 1.0 texture 1.0 0.500000
+0.500000 material anim material bone -1 anim frame
+vertex
+= 1.0 anim
+-1 anim = anim frame 0.500000 material =
+anim
+material anim
+0.500000
+bone = material
+vertex 0.500000 vertex -1 1.0 anim = frame frame frame
+-1
+-1 bone
+-1 anim
+-1 anim bone bone
+= 1.0
+-1 anim
+1.0 anim -1 material -1 0.500000 -1
+0.500000
+0.500000 -1 = frame frame = -1 texture
+-1 vertex texture vertex 0.500000 = bone frame
+frame texture = vertex -1 0.500000
+frame
+0.500000 = material
+vertex vertex texture = = -1
+texture vertex frame
+anim =
+vertex 1.0 frame
+0.500000 = 0.500000
+texture = vertex material
+texture
+vertex material -1 -1 frame vertex
+texture = bone texture
+-1 -1 0.500000
+material anim
+vertex material material frame anim
+vertex
+material
+vertex vertex frame bone frame -1 0.500000
+frame -1 = 0.500000 = anim
+bone
+1.0 1.0 1.0 0.500000 bone frame = bone
+1.0 anim 1.0 frame
+vertex
+-1 anim 0.500000
+anim bone vertex anim
+texture = 0.500000 texture = -1
+vertex -1 vertex -1 anim material vertex 1.0 vertex material frame = material -1 bone vertex 0.500000 -1
+frame -1 anim 0.500000 material frame anim bone anim =
+anim vertex texture frame vertex -1 material
+-1
+texture texture texture -1 0.500000 vertex 1.0 -1 -1 material 1.0
+anim anim texture texture material texture texture bone
+= 0.500000 texture
+texture 1.0 material
+=
+0.500000
+0.500000
+=
+= 1.0 bone texture
+frame material
+1.0 bone frame material -1
+frame texture texture bone vertex
+material -1 0.500000 bone bone 0.500000 anim material
+material 1.0 anim texture material texture
+1.0 -1
+frame -1 anim 1.0
+vertex material
+-1 = 0.500000 = anim =
+-1 frame
+1.0 bone frame = anim
+= =
+material
+bone material
+texture 0.500000 bone bone bone vertex frame 0.500000 -1 = material
+material texture frame
+0.500000 texture anim -1 1.0 texture anim vertex 1.0 -1
+bone vertex frame anim bone = 0.500000 frame material frame 0.500000 =
+0.500000
+0.500000
+-1 anim 0.500000 material 1.0 bone texture = 0.500000
+texture anim 0.500000 frame
+= texture 1.0 texture bone 0.500000 texture
+anim frame bone texture =
+0.500000 -1 0.500000 material anim texture = = 0.500000 anim material
+frame material anim 1.0
+texture -1 bone 0.500000
+-1 1.0 vertex 0.500000
+material 0.500000 0.500000 1.0 1.0
+anim frame texture vertex vertex 1.0 vertex
+0.500000 vertex
+texture anim
+-1 0.500000
+texture frame 1.0 material 1.0
+material 1.0
+bone -1
+0.500000 frame -1
+vertex bone 0.500000 1.0
+-1 vertex -1 -1 0.500000
+frame vertex -1
+frame material = texture anim bone frame 1.0 anim texture bone
+-1 1.0 0.500000 anim anim
+frame
+bone = frame vertex
+texture
+1.0 material
+0.500000 bone = 1.0
+material
+1.0
+bone material texture texture vertex 0.500000 1.0 = material = 0.500000 0.500000
+0.500000 1.0 texture 1.0
+1.0 texture -1 bone 0.500000 vertex
+texture frame 1.0
+1.0
+vertex -1 anim = vertex material
+anim frame texture 0.500000 vertex 0.500000 bone 1.0 vertex 1.0
+1.0 1.0 frame
+= frame frame material material material vertex vertex texture 0.500000 -1 texture -1 material = -1 1.0 bone
+= 1.0 -1 anim 0.500000 =
+vertex
+1.0
+0.500000 anim 1.0 frame bone -1 -1 bone 0.500000 material
+material 1.0 1.0 vertex 1.0 -1
+-1 texture frame frame vertex vertex =
+texture frame frame 0.500000 texture
+anim = 1.0 anim
+0.500000
+-1
+vertex -1 = frame = 0.500000 anim
+anim -1
+material
+1.0 texture anim
+= 0.500000
+0.500000
+0.500000 bone
+material 1.0
+frame
+anim 1.0 material
+= -1 frame anim
+material -1 material -1
+material =
+-1 frame 0.500000 = anim anim texture 0.500000 -1 vertex
+material vertex -1 frame 1.0 =
+texture
+frame = vertex
+texture 0.500000
+material texture = 1.0
+vertex bone anim vertex texture 0.500000
+anim =
+texture
+1.0 1.0
+texture -1 anim -1 anim anim = 0.500000
+1.0 -1 -1 anim 0.500000
+-1
+bone 1.0 -1
+material frame 0.500000 -1
+bone -1 vertex = vertex =
+anim =
+-1
+= anim material texture
+anim = material 0.500000 0.500000 =
+vertex
+0.500000
+= bone frame frame vertex -1
+-1 material material bone material
+vertex
+vertex material vertex anim 0.500000 frame
+material 1.0 1.0
+anim
+bone texture 1.0 1.0
+= =
@@ -0,0 +1,8 @@
+0.500000
+bone vertex texture =
+anim frame -1
+-1 -1 bone 1.0 frame
+material vertex
+1.0
+frame 0.500000 texture
+anim vertex 
\ No newline at end of file
@@ -0,0 +1,5 @@
+= =
+-1 material 1.0 material = bone
+anim material bone frame vertex = anim bone = = material bone vertex = anim frame
+0.500000 frame
+= 
\ No newline at end of file
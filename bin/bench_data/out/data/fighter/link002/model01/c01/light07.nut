@@ -0,0 +1,102 @@
+material 0.500000
+= bone 1.0 -1 frame texture bone vertex frame texture material anim = texture 0.500000 bone
+bone -1
+anim anim
+material =
+material -1
+1.0 anim -1 -1 anim
+texture bone bone material
+frame texture frame material bone 1.0 = vertex
+1.0 -1 0.500000 texture bone = frame bone
+= texture material =
+= anim material vertex texture = material anim anim anim frame vertex 1.0 1.0
+frame anim material -1 texture anim 1.0
+vertex
+= -1 1.0 1.0 = 0.500000 1.0 anim
+material material = anim
+vertex anim -1 vertex 0.500000 1.0 frame
+anim anim
+material frame anim
+-1 vertex frame
+1.0 -1 1.0 material -1 bone 1.0 1.0 material bone
+0.500000
+anim
+=
+1.0 bone bone texture material
+anim
+anim bone 1.0
+= 1.0 texture frame bone texture -1 1.0
+= frame material frame material
+-1
+= frame 0.500000
+-1 anim = frame bone
+= material 1.0
+0.500000 -1 material material texture
+vertex frame =
+vertex
+bone texture -1 frame 1.0 material vertex vertex texture vertex
+texture
+anim
+texture 1.0 0.500000 material
+texture
+1.0 bone =
+0.500000
+anim vertex bone anim
+frame = 0.500000 vertex material anim anim
+= vertex
+bone anim vertex frame texture frame 0.500000 texture texture 0.500000 frame 1.0 anim texture 1.0 =
+texture vertex 0.500000 vertex frame 1.0 -1 = =
+0.500000 material 0.500000 texture
+texture texture vertex = = frame
+-1 material anim = = bone vertex vertex material vertex anim
+material texture = -1 bone
+1.0 = -1 0.500000
+vertex material
+-1
+frame texture frame
+anim material frame frame =
+1.0 texture vertex anim -1 frame anim
+texture vertex bone
+-1
+bone =
+material material 0.500000 =
+frame 1.0
+1.0
+bone texture
+material
+texture texture frame frame texture anim
+anim 1.0 vertex = 0.500000 frame 0.500000 =
+1.0 frame vertex anim
+-1 anim -1 bone texture anim 1.0 frame 1.0 1.0
+texture bone texture 0.500000 anim = 1.0
+bone
+anim
+frame =
+frame = texture
+= bone
+-1 anim texture
+vertex
+-1 -1 vertex texture 0.500000 0.500000 texture material material frame = anim anim material
+0.500000
+anim 1.0
+0.500000
+texture 0.500000
+bone anim vertex =
+bone -1
+anim texture anim -1 bone material anim
+material bone
+material
+vertex
+1.0
+bone bone 0.500000 vertex 1.0 = bone 1.0 texture -1 texture anim 0.500000 0.500000 material frame
+texture 1.0 = texture vertex vertex texture frame bone frame -1 anim
+= texture
+vertex
+anim
+anim anim
+=
+material
+1.0 anim
+material
+-1 frame
+anim 1.0
\ No newline at end of file
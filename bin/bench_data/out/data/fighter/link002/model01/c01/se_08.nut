@@ -0,0 +1,4 @@
+1.0 vertex
+texture
+= frame = -1 material 1.0 1.0
+verte
\ No newline at end of file
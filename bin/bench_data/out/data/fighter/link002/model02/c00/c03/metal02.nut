@@ -0,0 +1,78 @@
+frame = 1.0 vertex bone material -1 = bone 1.0
+texture -1 1.0 0.500000
+= vertex
+vertex bone material anim vertex = 0.500000
+bone 1.0 anim 0.500000 -1 = anim -1 vertex 0.500000
+vertex 0.500000 texture anim material material 1.0 material = 1.0 anim frame 0.500000 =
+0.500000 vertex 0.500000 -1
+anim 1.0 texture
+frame
+texture
+anim = texture -1 anim
+bone 0.500000
+texture anim material
+0.500000 =
+texture bone
+frame 1.0 frame 0.500000 1.0
+bone vertex texture = = texture frame vertex vertex vertex 0.500000
+0.500000
+anim = material 0.500000 material
+=
+1.0 vertex anim
+vertex 0.500000 0.500000 vertex material
+material = 1.0 = -1 bone
+-1 vertex
+frame material
+frame 0.500000 texture 0.500000
+anim
+bone
+=
+0.500000 frame
+frame
+vertex = = = vertex -1
+bone
+material -1 anim
+texture
+0.500000 1.0
+bone -1
+-1 vertex material material anim
+0.500000 texture bone bone
+frame =
+material vertex 1.0 texture texture texture vertex texture
+vertex 1.0
+anim 0.500000 1.0 -1
+=
+1.0
+vertex
+bone vertex -1 vertex material vertex = =
+1.0 0.500000 =
+=
+anim material texture texture -1 frame -1 texture 1.0 material material anim texture =
+texture
+material
+anim
+1.0 -1
+vertex frame 1.0 vertex =
+texture
+-1
+texture 1.0 -1 = frame 1.0 texture -1 material vertex texture 0.500000 material 1.0
+material
+-1 -1
+1.0
+1.0 anim bone frame =
+0.500000 anim -1
+anim frame bone frame
+-1
+anim anim -1
+=
+bone bone
+1.0 texture -1 frame vertex anim vertex material texture
+material 0.500000 bone bone =
+bone
+frame = 1.0 1.0 vertex frame
+anim
+-1 frame bone 0.500000 material
+texture texture frame = anim
+frame material 1.0
+material anim texture = texture =
+anim m
\ No newline at end of file
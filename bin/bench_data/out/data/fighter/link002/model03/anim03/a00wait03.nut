@@ -0,0 +1,8 @@
+anim anim vertex -1 material
+-1
+texture frame frame
+vertex
+vertex anim -1 1.0 anim frame
+material frame bone = frame anim
+anim bone
+material 
\ No newline at end of file
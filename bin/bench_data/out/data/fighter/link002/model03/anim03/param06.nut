@@ -0,0 +1,78 @@
+material -1 texture 1.0 texture vertex 0.500000 vertex -1 = bone 0.500000 bone bone
+=
+texture = = anim bone
+= 0.500000 -1 bone
+vertex frame frame 1.0
+anim
+texture
+material
+0.500000 material 0.500000 frame 0.500000 bone 0.500000 vertex 1.0 0.500000 bone bone = vertex texture anim texture
+bone
+anim vertex texture
+bone texture vertex texture anim -1 = = = vertex 0.500000 1.0
+1.0 0.500000 vertex texture material = material -1 = vertex
+material -1 anim anim vertex
+frame texture
+vertex frame 0.500000 anim
+texture
+-1 material bone texture
+1.0 -1 1.0 frame frame bone
+1.0 -1 -1 0.500000 1.0
+bone frame vertex = anim 1.0 1.0 -1
+anim material
+texture anim vertex
+texture
+= -1 0.500000
+1.0
+frame
+bone texture material
+anim texture
+texture 0.500000 material -1 material -1
+bone 0.500000 -1 vertex
+material =
+= bone
+anim vertex 0.500000 = -1 texture anim
+1.0 vertex
+material -1 1.0 vertex anim material = 1.0 material -1 texture
+bone
+anim = material -1 1.0 = frame anim material 1.0 0.500000 = anim 0.500000 material frame
+frame
+-1 texture = =
+1.0 anim
+-1 material 0.500000 texture frame
+texture 0.500000
+1.0 vertex material vertex -1 = = -1
+frame
+vertex = anim vertex
+texture anim
+0.500000 -1
+0.500000 anim -1
+vertex vertex =
+frame material
+bone
+= = anim 0.500000 frame material vertex anim -1
+-1 -1 vertex 1.0 0.500000 texture -1
+-1 = frame
+1.0 frame material frame vertex frame material texture
+frame material texture texture vertex anim
+texture
+0.500000
+-1 texture material texture vertex 1.0 vertex
+0.500000
+anim
+material texture -1
+0.500000 material 1.0 texture bone texture anim bone
+bone 1.0 frame
+-1 1.0 vertex material frame material 0.500000 frame
+texture
+=
+bone frame frame anim bone 1.0 bone vertex frame vertex texture bone 0.500000
+vertex frame = texture
+material 0.500000 anim texture texture
+texture = -1 0.500000 0.500000 0.500000 = texture bone material texture
+frame texture
+vertex texture
+= texture bone bone material material =
+=
+anim 0.500000 frame anim
+texture 1.0 0.500000 -1 bone 0.5
\ No newline at end of file
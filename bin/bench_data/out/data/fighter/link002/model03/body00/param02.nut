@@ -0,0 +1,2 @@
+anim
+1.0 frame vertex 1.0 material mat
\ No newline at end of file
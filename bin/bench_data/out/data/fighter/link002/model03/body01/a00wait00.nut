@@ -0,0 +1,70 @@
+0.500000 frame 0.500000 frame anim bone frame material
+= bone -1 vertex 1.0
+= material
+texture vertex
+frame 0.500000 vertex
+1.0 material 0.500000
+anim bone 1.0 anim vertex anim 1.0
+bone 1.0 1.0 0.500000
+texture anim =
+anim
+frame
+1.0 1.0
+frame
+0.500000 frame
+1.0 vertex frame anim
+bone
+-1
+bone material = =
+1.0
+0.500000 vertex -1 bone
+frame anim bone frame anim 1.0
+material 0.500000 0.500000 bone 0.500000 material vertex = =
+0.500000 anim -1 =
+vertex
+frame vertex -1
+1.0 = frame bone frame =
+material -1 texture frame = frame material vertex 0.500000 frame =
+frame bone
+anim vertex 1.0 material material 0.500000 = =
+frame vertex 0.500000 0.500000 frame 0.500000 1.0 material 1.0 1.0 -1 1.0 material frame anim
+material
+1.0
+texture bone = texture -1
+= -1 -1 material material
+bone vertex 0.500000 = 0.500000 =
+anim
+bone material 1.0 vertex material 0.500000 1.0 -1 -1 bone texture
+frame -1 -1 vertex texture bone material = = -1
+bone frame
+= 1.0 anim frame 0.500000 anim
+frame bone 1.0 frame 1.0 bone anim frame 0.500000 anim
+0.500000 = anim 0.500000 bone
+= frame bone 0.500000
+material = anim -1 anim
+material bone 0.500000 0.500000 bone anim 1.0
+1.0 frame
+frame
+0.500000 0.500000 anim
+vertex
+1.0 anim 1.0 texture vertex 0.500000
+vertex
+frame
+1.0
+material
+-1 1.0 1.0 material bone
+frame frame
+bone 0.500000 texture 1.0 1.0 1.0
+material 1.0 0.500000
+vertex material texture vertex material
+0.500000 anim
+bone
+bone 0.500000 material anim
+frame
+bone 1.0
+0.500000 1.0 texture -1
+vertex = 0.500000 anim
+0.500000 vertex 1.0 1.0 material texture material material 0.500000 anim
+bone 0.500000 vertex bone vertex anim vertex material texture 1.0
+1.0
+anim bone
\ No newline at end of file
@@ -0,0 +1,302 @@
+0.500000 frame 1.0
+vertex
+1.0 vertex
+= frame
+1.0 anim
+anim vertex bone
+0.500000 = =
+material material 0.500000
+texture bone -1 vertex material vertex bone =
+vertex frame
+= -1 =
+bone vertex frame 1.0 -1 -1 material = anim bone
+vertex -1 0.500000 = bone anim vertex texture material material
+frame 1.0
+0.500000 = bone material 0.500000 vertex material 0.500000 =
+material material frame
+anim frame texture -1
+1.0
+1.0 frame
+bone 1.0
+= = anim 1.0 = vertex anim = -1 1.0 = texture frame bone = frame bone vertex
+frame anim texture 1.0 frame -1 = 1.0 vertex frame
+texture material bone 0.500000
+frame vertex
+0.500000
+vertex bone = texture vertex frame material
+bone material
+texture
+= bone anim
+bone 0.500000 vertex
+= material -1 1.0
+texture vertex
+0.500000
+-1
+1.0 = vertex 1.0
+0.500000 =
+1.0 bone -1 anim 0.500000
+anim material
+anim
+0.500000 anim 0.500000 0.500000
+frame frame -1
+vertex frame = -1
+= material
+0.500000 frame
+vertex
+= texture texture -1
+bone -1 1.0
+texture vertex 1.0 frame texture
+anim anim material frame bone 0.500000 0.500000 texture
+frame
+0.500000
+bone frame 1.0
+-1 = -1
+texture =
+frame vertex frame
+-1 bone 1.0
+-1 material vertex vertex
+bone
+texture 1.0 bone anim 1.0 bone bone anim material = -1 vertex anim 1.0 anim 1.0
+1.0
+frame = bone
+-1 frame 0.500000 anim
+-1
+0.500000 material texture 0.500000
+0.500000 vertex texture -1 = -1 0.500000 bone anim
+material anim anim 0.500000 material
+material vertex vertex =
+texture material -1 vertex anim bone frame vertex frame vertex
+bone -1 material 0.500000 bone texture -1 texture -1
+material material
+-1 0.500000 -1 1.0 = material material material texture material -1
+texture
+material
+anim bone anim
+=
+=
+vertex material 0.500000
+anim anim texture texture texture vertex 0.500000 anim
+1.0
+1.0 -1 bone 1.0
+texture frame 1.0 0.500000 vertex
+texture frame =
+texture = texture =
+vertex
+bone material
+0.500000
+0.500000 0.500000
+bone bone
+bone = anim frame
+material vertex
+anim
+vertex texture vertex bone bone = material
+anim 1.0 material
+0.500000 =
+-1 vertex
+= -1 1.0 material 0.500000 =
+vertex texture 0.500000 material
+bone material vertex frame
+texture
+0.500000 material 1.0 0.500000 texture 0.500000 vertex = 1.0
+vertex =
+-1 material vertex bone
+bone
+0.500000 material anim 1.0 0.500000 -1
+bone frame frame frame -1 0.500000 frame
+bone
+bone -1 frame -1 bone texture texture =
+1.0 bone
+bone
+bone
+texture = 1.0
+vertex 1.0
+-1 vertex = vertex -1 bone frame vertex
+material anim vertex
+0.500000 1.0
+-1
+1.0 0.500000 bone vertex vertex
+= frame texture 1.0 1.0 0.500000 1.0 -1
+texture =
+0.500000 anim anim texture 0.500000 material 1.0 frame
+-1 1.0 frame
+0.500000
+frame frame material 1.0
+anim
+frame bone 1.0 texture anim anim texture material bone -1 material -1 bone
+texture = texture anim -1 -1
+material bone
+1.0 bone bone
+= frame 0.500000 frame texture vertex vertex -1 anim anim 1.0 -1
+material anim bone frame anim 0.500000 frame frame 1.0 bone 0.500000 -1 vertex vertex
+bone anim = = 1.0 frame frame
+anim
+anim
+texture
+bone 0.500000 texture -1 -1 texture -1 texture bone
+bone
+0.500000
+-1 1.0
+frame 0.500000 texture material
+1.0 material
+anim
+bone texture
+bone bone bone 1.0 = 0.500000 anim texture material anim
+material
+bone =
+=
+vertex 0.500000 0.500000 0.500000 -1 1.0 -1 1.0 vertex texture
+material =
+1.0 bone 1.0
+texture bone bone anim texture = texture bone anim 1.0 1.0 vertex vertex anim
+material texture
+anim
+vertex anim -1 bone
+anim bone texture frame
+bone vertex = 1.0 0.500000
+anim -1 -1
+0.500000
+-1 vertex
+vertex
+vertex texture 0.500000
+anim bone
+frame
+= texture bone
+material
+-1 -1 frame frame bone texture 0.500000 0.500000 frame -1 frame 0.500000 material vertex
+anim -1 material
+vertex vertex anim
+-1 0.500000
+-1
+vertex material bone
+-1
+vertex -1 bone vertex 0.500000 bone 1.0 texture bone -1 0.500000 bone 0.500000
+1.0 = material 0.500000 vertex bone
+material bone anim bone 1.0 anim
+vertex
+vertex = -1 texture -1 =
+anim -1 material 1.0 1.0 anim = 0.500000 frame anim frame
+0.500000
+anim -1 texture
+frame texture
+vertex
+0.500000 texture 1.0 vertex bone vertex frame
+anim
+-1 vertex
+anim texture 1.0 bone texture material -1
+frame anim
+texture = material material 1.0 0.500000 -1 anim frame texture frame
+anim
+material bone frame 0.500000
+vertex material material bone
+anim bone texture texture = anim vertex 1.0 texture
+frame anim texture texture vertex vertex material material texture frame anim
+material
+-1 frame =
+material
+= anim
+-1 frame
+bone
+0.500000 -1
+-1 texture material 0.500000 frame 0.500000 texture -1 1.0 texture = =
+frame
+vertex texture bone vertex
+0.500000
+= anim 1.0 bone texture
+vertex -1 anim vertex
+frame
+material anim
+1.0
+texture frame
+-1 material 0.500000
+bone -1 =
+frame 0.500000 anim
+-1 bone
+bone
+= 1.0 material 1.0 -1 1.0 -1 anim
+bone 0.500000 1.0 vertex
+anim -1 texture vertex 1.0 anim texture frame
+frame
+bone = -1 =
+anim
+material
+vertex frame bone
+0.500000 material -1 -1
+= 0.500000 0.500000 =
+material 1.0 anim
+bone
+texture bone anim material 0.500000
+vertex bone 0.500000
+= bone
+texture 1.0 0.500000 1.0
+vertex =
+0.500000
+material = bone material bone
+frame anim material vertex = vertex
+1.0 1.0
+texture frame
+vertex frame material = frame bone 0.500000 frame
+-1 -1 anim 1.0 = frame 0.500000 = bone vertex anim vertex 0.500000
+1.0 bone vertex 0.500000 0.500000 vertex anim frame -1
+anim frame
+= frame
+= vertex = frame
+frame texture anim texture -1 anim material vertex texture
+vertex
+= = material
+vertex
+1.0 material frame
+0.500000 0.500000 frame
+-1 vertex anim = anim bone texture
+frame 1.0 frame 1.0
+bone material =
+texture 1.0 material texture bone = = frame
+0.500000
+1.0 0.500000 bone -1 frame vertex 1.0 vertex = 1.0 = 1.0 -1 material bone =
+frame frame
+1.0
+frame 0.500000
+=
+anim vertex -1
+anim -1 texture bone texture
+frame material material -1 =
+material texture = bone bone -1 vertex
+frame
+material 0.500000 0.500000 bone
+1.0 bone -1 = bone
+= =
+frame texture
+bone -1 0.500000
+frame
+texture anim
+bone texture
+0.500000 texture -1 vertex material vertex
+anim
+0.500000
+= 0.500000
+texture
+material texture 1.0 anim
+= -1 1.0
+= bone texture -1 material vertex anim vertex anim texture = anim
+-1 material vertex
+anim
+material vertex
+-1 anim 1.0 frame bone = 1.0
+material frame 0.500000
+anim
+frame material
+1.0 vertex 0.500000
+vertex -1 1.0 anim anim 1.0
+=
+-1 anim
+-1
+1.0 -1 bone texture bone texture
+= = 0.500000
+material 0.500000 anim material -1 1.0
+0.500000 = bone
+texture vertex 1.0 anim frame
+= 0.500000 frame 1.0 frame vertex 1.0 0.500000 material
+frame = -1 bone
+frame material bone 1.0 anim 0.500000 frame anim
+= 0.500000 1.0 material 0.500000 material texture anim -1
+bone vertex material material texture material anim -1 texture vertex 0.500000 -1
+-1 verte
\ No newline at end of file
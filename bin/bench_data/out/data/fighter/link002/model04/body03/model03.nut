@@ -0,0 +1,171 @@
+= 1.0 texture material
+texture anim
+texture 0.500000
+anim anim anim material texture texture = vertex
+1.0 1.0 0.500000 anim 1.0
+1.0 material texture
+texture 1.0
+texture 1.0 1.0 frame texture
+1.0
+frame vertex 1.0 anim -1 texture -1
+-1 -1 1.0
+material frame texture
+1.0 bone
+frame
+0.500000 bone vertex 0.500000 0.500000 bone
+anim vertex texture 0.500000 frame -1 material bone vertex -1 -1
+texture anim anim
+frame
+vertex material
+anim
+vertex -1 vertex 1.0 1.0 texture texture
+texture vertex -1
+texture 0.500000
+vertex frame material
+1.0 vertex texture texture
+1.0
+bone
+frame anim
+-1 vertex frame material bone 0.500000 0.500000 bone 0.500000 0.500000
+anim material =
+texture
+0.500000 anim
+bone
+frame
+1.0
+-1 material frame 0.500000 anim bone
+frame bone texture
+vertex material
+material frame bone frame
+material
+texture
+= material frame material
+bone material frame material anim
+-1 frame -1 material = -1 0.500000 0.500000 =
+vertex vertex =
+texture 1.0 -1 anim material = -1
+0.500000 bone vertex = bone anim
+frame frame frame
+-1 -1 frame 1.0 vertex material texture bone = 1.0 = anim
+-1
+0.500000 -1 = anim
+-1
+texture
+vertex
+frame -1
+anim bone = frame frame = -1 1.0
+anim 1.0 material material vertex texture 0.500000
+-1 bone material anim
+bone bone anim 1.0 frame anim
+frame -1 -1 bone -1
+texture
+=
+= anim 1.0 bone anim material texture 0.500000 -1
+1.0 0.500000 = -1 = texture -1 vertex texture frame material anim 1.0 anim anim
+vertex
+anim -1 vertex
+-1
+0.500000 material vertex
+-1 1.0 bone = 1.0 bone anim material
+0.500000
+1.0 0.500000 bone texture 1.0 vertex
+material material texture material
+-1
+vertex bone 0.500000 vertex = bone
+texture
+vertex
+= bone texture -1 0.500000 1.0
+vertex vertex
+-1 vertex anim -1 anim = material vertex
+vertex texture texture vertex -1 frame frame 0.500000 -1 0.500000
+material
+texture 1.0 0.500000 0.500000 vertex 1.0 0.500000
+texture vertex vertex
+vertex
+texture anim
+bone
+anim
+material -1 -1 1.0 bone material texture 1.0
+material -1 frame anim texture
+material bone
+anim texture texture
+material
+material
+= bone
+1.0 texture frame frame
+frame = 1.0 frame
+anim 1.0 1.0 = = 0.500000
+vertex vertex 0.500000 frame 0.500000 frame = 1.0
+anim -1 vertex -1 frame
+0.500000 material
+1.0 bone
+material bone -1
+bone anim anim
+vertex frame 0.500000 texture
+anim frame texture anim vertex = frame
+-1
+anim material texture -1 anim anim vertex
+anim anim anim material texture frame
+anim 1.0 frame
+1.0
+=
+-1 bone
+0.500000 vertex 1.0
+material material frame
+= 0.500000
+texture texture vertex
+anim vertex = texture
+bone
+-1 material
+texture bone
+texture
+texture vertex anim
+anim frame bone bone 1.0 anim frame material
+bone = texture bone -1 material bone anim
+material vertex
+frame
+material texture texture 1.0
+1.0 anim frame = -1 0.500000 texture
+texture
+0.500000 vertex = 1.0 1.0 bone
+anim material bone texture bone bone material vertex texture 1.0 anim bone texture frame bone bone vertex vertex
+texture 0.500000 =
+vertex anim vertex
+vertex 1.0
+1.0 anim bone = 0.500000 1.0
+1.0 bone
+=
+bone material 0.500000 material material -1
+anim
+vertex anim -1 bone bone bone
+vertex 1.0 0.500000 material
+1.0 bone bone = frame
+0.500000
+anim 0.500000
+-1 bone bone 1.0 1.0 vertex = anim bone material
+= vertex 1.0 frame anim vertex frame = bone anim =
+texture anim = material
+material 0.500000 bone bone
+anim vertex frame anim bone = frame 1.0 -1 material bone texture 0.500000 -1 vertex bone material 1.0 = frame material texture 1.0 0.500000 0.500000 vertex texture anim -1 -1
+1.0
+material texture 1.0 -1 -1 material 0.500000 anim material
+1.0 0.500000 -1
+=
+bone frame = 0.500000 0.500000 = bone
+= bone frame frame
+0.500000
+texture
+0.500000 texture 0.500000 anim
+material -1
+texture
+bone -1 texture vertex -1 vertex material vertex frame 0.500000 0.500000 material bone frame
+=
+bone 0.500000 frame -1 texture 1.0
+material vertex texture material = -1 bone = = anim texture 0.500000 -1 bone 1.0 anim frame material frame
+texture
+-1 bone anim texture 1.0
+bone anim frame -1 texture
+texture vertex -1
+1.0 bone texture
+material material frame 1.0 1.0 -1
+bone anim -1 frame anim bone 
\ No newline at end of file
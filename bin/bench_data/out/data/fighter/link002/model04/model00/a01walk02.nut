@@ -0,0 +1,100 @@
+0.500000 vertex bone vertex texture
+vertex anim
+-1 texture
+anim vertex material bone
+1.0 1.0 frame 0.500000
+material
+-1
+bone
+= 0.500000 -1 -1 material
+1.0 texture anim anim texture
+0.500000
+frame anim vertex frame
+material = material 0.500000 texture vertex 0.500000 -1 frame material frame
+=
+frame 0.500000
+texture
+anim material vertex = 0.500000
+texture material
+= texture = = frame -1 material =
+-1 vertex anim
+frame bone
+bone
+1.0 anim -1
+anim = 1.0 texture frame frame 0.500000 texture frame vertex = 0.500000 frame vertex 0.500000 = frame bone
+0.500000 1.0 material vertex 1.0
+frame
+vertex
+0.500000 = texture anim bone texture
+bone
+vertex =
+material 0.500000 = 0.500000
+0.500000
+texture vertex 0.500000
+vertex anim frame
+= texture bone
+-1 texture
+= vertex 0.500000 -1 material anim vertex
+0.500000 bone vertex material
+0.500000 0.500000
+frame anim frame -1 texture 0.500000
+= vertex frame vertex anim -1
+= anim 1.0 1.0 0.500000
+material
+texture anim
+1.0 texture texture =
+texture frame 0.500000
+material -1 material 1.0
+-1 vertex vertex bone
+frame bone
+material 0.500000 vertex 1.0 anim -1 bone
+1.0 material
+bone frame vertex -1
+frame material
+bone anim
+bone
+0.500000
+material -1 material frame
+bone
+1.0
+=
+bone vertex bone
+frame bone = -1 -1 -1 anim
+material anim anim 0.500000 1.0 1.0
+anim 0.500000 0.500000 material
+vertex anim -1 material bone = anim
+0.500000 1.0 material
+-1
+-1 vertex = anim frame anim 0.500000 0.500000 0.500000 bone
+anim = 1.0 vertex vertex frame -1 = material
+texture
+frame texture vertex vertex 1.0 texture 1.0 0.500000
+= frame texture
+bone
+texture -1
+texture
+-1
+vertex frame -1 texture = frame vertex anim anim 0.500000
+bone 1.0
+0.500000 anim
+=
+=
+vertex anim bone 0.500000 bone material bone frame bone = vertex
+0.500000
+= -1 texture
+texture -1 bone
+1.0
+1.0
+anim 0.500000
+frame -1 material
+frame
+1.0 bone bone material frame -1 texture 0.500000 0.500000 frame = -1 1.0 0.500000 vertex 0.500000 0.500000 = vertex 0.500000
+=
+anim
+0.500000 bone material material material bone frame
+frame vertex 1.0
+bone texture -1 =
+1.0 vertex frame bone
+= bone anim
+bone frame -1 frame bone anim
+b
\ No newline at end of file
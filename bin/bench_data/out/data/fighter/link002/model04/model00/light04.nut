@@ -0,0 +1,122 @@
+1.0
+bone anim texture 1.0 bone bone 0.500000
+1.0 vertex vertex
+frame
+bone bone vertex bone anim 0.500000 frame
+= frame
+-1
+texture anim frame texture bone
+1.0 0.500000 frame material
+0.500000 material anim = vertex 1.0 1.0
+0.500000
+material
+0.500000 1.0 vertex anim 0.500000 1.0
+bone
+-1 = vertex texture 0.500000 vertex 1.0 texture
+-1 = 1.0 -1 vertex 1.0 bone anim
+-1 texture 0.500000 1.0
+-1
+= vertex =
+1.0 anim frame vertex
+frame = bone -1 texture = anim 0.500000 frame material texture material
+material bone vertex vertex
+= frame -1 bone frame
+anim
+-1 vertex material -1
+-1
+-1
+anim -1
+0.500000 -1 -1 1.0
+material 1.0 bone =
+material = frame anim
+frame bone 1.0 vertex frame = 1.0
+anim
+vertex bone texture anim
+texture -1 material material = frame bone
+-1
+-1 -1 =
+1.0 1.0 anim -1
+-1 0.500000
+-1 -1 material
+texture
+bone
+-1 0.500000 0.500000 1.0 1.0 0.500000 material bone anim 1.0 bone bone 1.0 texture bone anim frame anim 0.500000
+0.500000 bone = 1.0
+frame texture vertex frame vertex
+anim
+-1 0.500000 material texture -1 1.0 bone frame
+bone
+= 1.0 frame material
+anim anim 0.500000
+anim = anim 0.500000
+-1
+-1 anim
+bone bone 1.0
+vertex texture material = -1 vertex texture
+vertex
+1.0 0.500000 1.0 anim material 1.0 vertex = anim
+frame material = material texture
+1.0
+bone = bone bone
+vertex -1 anim bone texture
+1.0 vertex frame anim
+-1 frame
+bone frame vertex 1.0 = 0.500000 material = anim frame anim 1.0 = -1 = vertex vertex texture 1.0
+1.0 1.0 = bone -1 frame texture frame texture material anim
+-1 texture 0.500000 anim
+1.0 bone frame
+texture material
+-1
+0.500000
+-1 vertex 1.0 frame
+= texture bone texture
+= bone vertex
+frame texture 1.0 1.0 -1 anim
+= material bone
+anim 1.0 1.0 bone = 0.500000 -1 = -1 1.0
+1.0 0.500000 anim vertex = texture vertex material anim
+material 0.500000 material
+texture material vertex 0.500000
+texture 0.500000
+0.500000 frame 1.0 -1 0.500000 texture = =
+material bone = anim 0.500000 -1 -1 0.500000 frame material 1.0 material material bone texture texture
+bone
+texture 0.500000 anim
+material
+0.500000
+-1 = frame
+frame texture
+texture bone material
+texture
+0.500000
+material texture
+bone
+texture
+0.500000 bone -1 -1
+1.0
+= = -1 bone anim bone bone 1.0
+bone vertex bone 0.500000 -1 1.0 anim 0.500000 0.500000 -1
+-1
+-1 vertex frame 1.0
+bone anim 0.500000 -1 bone texture
+material 0.500000
+vertex
+anim bone anim
+frame material 1.0 1.0 vertex anim = material frame bone =
+texture
+texture frame material bone anim
+= anim
+0.500000
+frame
+1.0
+frame = -1 frame = 0.500000 material bone -1 1.0 vertex texture = material =
+0.500000 1.0
+0.500000 1.0 vertex frame
+0.500000 material bone -1 =
+vertex texture 0.500000
+anim = -1 anim
+= 1.0 texture
+frame frame
+frame 1.0
+bone
+= bone material
\ No newline at end of file
@@ -0,0 +1,271 @@
+vertex frame material = anim frame anim anim texture -1 -1 bone 0.500000 material
+texture = frame texture = bone bone vertex -1 bone frame material -1 -1 -1
+texture
+1.0
+texture = frame
+bone anim bone bone frame
+bone
+anim = material frame
+texture texture material bone
+0.500000 texture anim -1 texture
+vertex
+vertex vertex 0.500000 vertex material bone 0.500000 1.0 bone 0.500000 material texture frame
+bone vertex
+anim
+texture bone anim 0.500000 bone 0.500000 anim
+frame = texture 0.500000 texture
+frame
+anim 0.500000
+vertex
+1.0 -1 anim
+anim vertex -1 -1 texture 1.0 bone
+1.0 frame anim
+texture 1.0 frame 0.500000 texture
+0.500000 0.500000 texture frame material bone
+= -1
+vertex
+anim anim 0.500000 0.500000 =
+1.0
+frame frame material bone
+1.0 -1 = anim anim = texture 0.500000 0.500000 anim anim vertex vertex bone 0.500000 = 0.500000 material 1.0 material
+vertex
+=
+= bone material 1.0 -1 anim bone 0.500000
+frame material bone = frame
+0.500000 vertex
+anim bone vertex =
+texture
+material = material
+frame -1 -1 1.0
+bone bone anim bone material texture frame anim 0.500000
+material frame -1 0.500000
+0.500000 -1 0.500000 bone frame 0.500000 material
+texture texture 0.500000 0.500000
+anim bone material texture
+material
+material bone
+texture bone texture
+0.500000 0.500000 frame 0.500000
+0.500000 1.0 vertex
+0.500000 0.500000
+1.0 -1 frame
+= anim
+anim -1 1.0 vertex material bone
+material
+vertex
+= = frame vertex vertex
+-1
+texture vertex 1.0 anim 0.500000 0.500000 -1
+-1 frame -1 material 0.500000
+anim bone
+0.500000 anim vertex
+0.500000 vertex
+texture 1.0 frame
+frame = -1 material bone
+bone bone
+frame = texture
+-1 texture anim material
+texture = -1 material
+0.500000
+-1 anim texture
+texture bone anim = vertex frame vertex frame
+bone material vertex frame
+vertex -1 anim frame -1 0.500000 0.500000
+material 1.0 frame frame
+1.0 -1 frame bone
+1.0 frame
+frame
+= 0.500000 bone
+material bone 1.0 1.0 1.0
+texture -1
+-1 1.0
+bone material bone
+=
+= material
+-1 texture 1.0 vertex
+=
+vertex vertex vertex material
+1.0 -1
+1.0 anim -1 anim frame
+vertex
+anim anim 0.500000
+frame = 0.500000 = 0.500000 0.500000
+texture texture anim
+frame 1.0 -1 1.0 1.0 bone 1.0 frame 0.500000 anim
+0.500000 vertex 1.0
+-1 anim
+bone = anim material anim 1.0
+1.0 0.500000 1.0 1.0
+anim
+-1
+0.500000 frame
+1.0 bone
+vertex texture frame
+frame texture
+vertex anim anim
+material -1 frame material
+material
+-1 frame 0.500000 0.500000 1.0 -1
+frame frame 1.0
+bone 1.0 anim 0.500000 0.500000
+vertex
+-1 0.500000 bone material = -1
+bone anim texture texture
+1.0
+bone texture 0.500000
+texture
+bone vertex bone -1
+1.0 -1 texture anim
+1.0
+material
+material
+0.500000 vertex anim texture = vertex = bone
+anim material
+anim
+vertex 1.0 1.0 bone =
+anim 1.0
+1.0
+texture frame
+texture =
+anim frame 1.0 material anim 1.0
+texture
+material
+frame material anim
+material
+0.500000
+material material 1.0
+= -1 vertex texture 1.0 texture
+vertex
+frame 0.500000 = bone frame frame frame -1 frame = 1.0
+-1 0.500000 = 0.500000 -1
+material bone vertex material 1.0
+0.500000 -1 0.500000 vertex
+-1 frame
+1.0
+texture anim =
+bone vertex
+anim anim 0.500000 anim vertex
+-1 =
+1.0 material bone = anim
+= frame anim material texture 0.500000 -1
+= 1.0
+vertex = anim vertex 0.500000 0.500000 1.0 = bone
+0.500000 =
+frame vertex texture anim -1 =
+0.500000 =
+-1 =
+-1 bone frame texture
+texture 0.500000
+0.500000
+-1 frame bone =
+texture material vertex -1 0.500000
+-1
+1.0 0.500000 vertex -1 = vertex bone frame vertex material
+= texture 1.0 frame 1.0
+= vertex
+texture vertex texture 0.500000 texture
+= frame 0.500000 anim -1 texture material bone
+0.500000 0.500000 texture 0.500000 -1 anim vertex
+anim
+vertex texture
+frame
+1.0 material frame texture
+bone material anim material anim -1 1.0 frame
+1.0 frame
+0.500000 1.0
+-1 texture = material frame = 0.500000 vertex
+vertex material material
+= = -1 1.0 bone frame anim 0.500000
+0.500000 -1 anim -1 material =
+1.0
+0.500000 -1 texture bone texture anim material bone
+frame 1.0 texture =
+= texture = bone 1.0 material bone
+frame
+-1 1.0
+vertex frame anim -1
+0.500000 frame vertex -1 texture 0.500000 material = -1 texture -1 -1 bone
+1.0 bone 0.500000 texture material texture =
+vertex 0.500000 frame frame bone
+bone
+1.0 0.500000
+anim anim frame material
+-1 anim bone anim
+bone
+bone texture = 0.500000 anim
+frame 0.500000
+frame
+texture = = 1.0
+1.0 -1 material 1.0 0.500000
+anim anim 0.500000 bone
+0.500000 1.0 texture frame =
+vertex material = bone frame 0.500000 anim material vertex
+material bone -1 vertex
+= 0.500000 -1 0.500000 -1 1.0 anim -1
+texture
+-1 vertex -1 frame anim
+=
+material texture
+material vertex texture = anim texture frame frame vertex material anim
+-1 vertex vertex -1
+1.0 0.500000 frame -1 texture texture = 1.0 1.0
+material frame material = material frame bone texture
+anim
+material bone frame 1.0
+= bone frame frame 0.500000 bone =
+frame 1.0 = frame bone = = vertex
+0.500000 frame material 1.0 1.0 texture frame material anim material vertex bone anim 1.0
+-1 frame texture texture -1 bone 1.0 vertex frame -1 frame
+anim -1
+frame frame 0.500000 0.500000 -1 -1 = texture
+anim material 0.500000 1.0 anim
+vertex anim
+1.0 1.0 bone
+vertex
+0.500000 bone
+1.0 frame -1 texture frame material =
+anim material material 0.500000
+frame vertex bone = bone anim
+=
+texture texture
+texture
+vertex
+frame texture = = vertex anim bone -1 frame = 1.0 0.500000 = anim
+-1 vertex
+material
+= material texture
+= bone
+material texture
+1.0
+0.500000 frame anim
+anim
+anim -1 texture texture vertex bone bone anim 1.0
+1.0
+0.500000 frame anim texture vertex texture texture
+-1 vertex frame =
+0.500000 1.0 0.500000 vertex
+bone vertex texture = = bone 1.0 bone
+material material texture texture
+-1 material 0.500000 0.500000 material
+= texture 0.500000 material material 0.500000 vertex
+texture
+anim = frame vertex vertex bone anim anim 1.0 texture material texture material texture bone 1.0
+0.500000 0.500000 anim
+bone bone
+bone material material frame bone
+=
+= 1.0 material bone
+bone 1.0 vertex bone
+texture bone 1.0 bone
+0.500000 1.0 bone material
+vertex 0.500000
+1.0 -1 vertex -1 1.0 = material texture anim =
+0.500000
+-1
+vertex material vertex texture
+0.500000
+frame frame 0.500000 frame vertex = frame
+vertex frame -1 =
+vertex vertex = texture -1
+1.0 material frame 0.500000 = anim anim
+1.0 bone
\ No newline at end of file
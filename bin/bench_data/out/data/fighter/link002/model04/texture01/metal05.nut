@@ -0,0 +1,19 @@
+vertex -1 0.500000 = = vertex material 1.0 0.500000 material material 1.0 bone material anim =
+anim vertex
+material
+0.500000 material vertex vertex
+bone
+vertex material anim frame anim 0.500000
+-1 texture texture =
+vertex anim -1 = vertex frame
+-1
+vertex bone
+=
+anim =
+bone 0.500000 texture
+texture texture bone
+= material
+anim 0.500000 1.0 texture bone 0.500000 -1 vertex material
+vertex anim = bone anim
+bone
+= frame bone vertex vertex -1 frame verte
\ No newline at end of file
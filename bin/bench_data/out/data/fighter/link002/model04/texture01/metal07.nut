@@ -0,0 +1,245 @@
+vertex = anim 1.0 frame
+-1
+material bone bone 1.0
+anim
+0.500000 anim bone texture anim 1.0 0.500000
+= frame texture
+bone vertex
+anim
+frame
+1.0 anim -1 anim -1 1.0
+texture vertex texture texture anim
+= bone anim 0.500000
+bone vertex
+material texture
+vertex 0.500000 bone vertex vertex
+0.500000
+anim
+bone frame material texture bone -1 bone 1.0 -1
+= -1
+0.500000 1.0 frame anim -1 material material frame texture
+-1
+material frame 1.0 -1 1.0 -1
+1.0 texture 1.0
+0.500000
+material material
+anim 0.500000 1.0 vertex 0.500000 texture -1 0.500000
+0.500000 frame
+bone 0.500000 material 1.0 0.500000 anim anim bone anim -1 frame -1 0.500000 material -1 vertex anim
+-1 1.0 0.500000
+=
+frame texture frame
+1.0 0.500000 bone vertex 1.0 -1 1.0
+bone -1 anim =
+frame vertex material anim 0.500000 texture -1 0.500000 vertex vertex
+material =
+-1 bone material = texture frame
+anim vertex 1.0
+bone texture
+anim -1
+texture frame = = texture vertex = -1 bone texture = 0.500000 = bone 1.0 anim
+bone 1.0 -1 material texture frame -1 anim 1.0
+anim =
+vertex
+vertex 1.0 -1 frame
+0.500000
+anim 0.500000 = bone 1.0 vertex
+-1 frame
+bone = = texture anim anim anim texture
+frame vertex = 1.0
+bone bone vertex anim
+frame anim material
+bone =
+= bone 1.0
+texture
+frame
+1.0 1.0 -1 1.0 vertex texture bone material vertex material
+frame bone
+material -1 vertex frame
+= anim -1 -1
+bone anim
+-1 anim -1 texture -1
+-1 = anim 1.0 = bone material 0.500000 material material 0.500000
+vertex anim = vertex = anim
+= -1
+-1 texture
+texture vertex anim
+anim
+anim
+material bone
+1.0 0.500000
+0.500000 material = bone texture
+-1 texture
+=
+1.0 -1 0.500000 =
+texture texture frame frame texture frame 1.0
+-1 = 0.500000 bone 0.500000 1.0
+vertex texture 1.0 0.500000 =
+1.0
+frame -1 -1
+material
+1.0 bone 1.0 texture texture
+anim anim
+anim bone anim frame anim material frame
+vertex 0.500000 0.500000
+0.500000 0.500000 vertex vertex
+-1 -1 texture = frame
+vertex =
+= texture = anim bone 0.500000
+=
+-1 bone texture vertex bone
+vertex
+vertex anim 0.500000 texture
+-1 -1 0.500000 frame bone bone 0.500000 0.500000 -1 frame = bone material frame -1
+-1
+material material = material 1.0 0.500000 anim 0.500000 = texture
+vertex -1 0.500000 -1 material
+=
+texture
+bone frame bone bone
+= frame
+material bone
+0.500000 0.500000 material
+vertex material 1.0 anim bone bone vertex
+anim texture frame bone 1.0 anim frame material -1 1.0
+vertex texture
+0.500000 material
+-1 anim 0.500000
+material -1 -1 vertex material anim
+anim -1 vertex bone
+1.0
+texture 0.500000 anim
+anim texture 0.500000
+1.0 vertex 0.500000
+0.500000 anim anim
+frame 1.0 anim vertex
+frame
+0.500000 1.0
+anim vertex -1 1.0 bone 1.0 1.0 material texture material = bone anim material -1 texture
+0.500000 texture
+0.500000 texture frame
+frame
+0.500000
+texture
+0.500000
+anim texture bone
+bone
+=
+anim
+texture
+= -1 texture frame
+= texture material vertex frame vertex vertex vertex 1.0 bone texture material -1 anim
+vertex 1.0
+-1
+-1 0.500000 1.0 1.0 texture
+vertex texture 0.500000 0.500000 -1
+material 0.500000 anim
+0.500000
+frame -1 0.500000 vertex material =
+texture = material
+-1 = bone
+0.500000 material vertex material
+material frame 1.0 0.500000 bone bone 0.500000 -1 anim
+0.500000
+= 1.0 1.0
+anim -1 texture
+frame material 0.500000 bone frame
+-1 frame frame
+texture
+frame 1.0 0.500000 = = bone -1 material frame
+frame
+material 0.500000 anim 0.500000 = anim vertex
+1.0 -1 = material vertex 1.0 texture frame
+material anim
+texture vertex
+1.0
+anim
+-1 anim material vertex material vertex
+bone
+texture 0.500000
+texture
+frame
+1.0 anim vertex bone 1.0
+0.500000 texture vertex 1.0 frame vertex = frame bone
+frame -1 texture -1 1.0 bone
+frame
+material vertex
+0.500000 anim material material
+texture bone
+1.0 material material frame anim frame =
+vertex
+material texture
+material = 0.500000 texture anim
+=
+0.500000 -1
+texture = frame = 0.500000
+1.0 -1 anim
+-1 vertex bone 1.0 0.500000 1.0 frame vertex frame vertex 0.500000
+anim texture
+frame texture -1 -1 texture material texture texture vertex
+vertex
+texture material material = anim 1.0
+anim anim 0.500000
+= vertex
+= 1.0 = texture 0.500000 material =
+texture =
+anim frame = anim texture 1.0 frame frame -1 = -1 frame 1.0
+0.500000 bone
+material
+bone texture texture material bone
+-1 frame
+= 0.500000 texture
+-1 bone vertex material bone anim 0.500000 anim bone
+vertex = bone 1.0 texture
+1.0 vertex bone vertex -1 texture material vertex = -1 bone material = texture texture 1.0 texture 1.0 bone bone bone -1 0.500000
+frame
+1.0
+vertex vertex
+0.500000 frame
+frame
+vertex
+texture -1 vertex bone -1 bone vertex
+1.0 0.500000 = texture
+vertex 0.500000 1.0
+frame frame
+bone -1 texture vertex frame = -1 0.500000
+anim -1 frame 0.500000 texture
+0.500000 texture = texture vertex anim 0.500000 bone
+material
+= -1 bone = frame material bone bone frame 0.500000 anim
+texture 0.500000 material
+anim 0.500000 0.500000 -1 texture bone
+-1
+bone
+texture
+-1
+material = bone bone bone anim
+= material 0.500000
+bone
+-1
+anim material = anim 0.500000
+= texture texture
+frame
+vertex
+texture vertex texture 1.0 = material
+bone
+1.0
+bone
+-1 frame vertex
+texture 0.500000 0.500000
+-1 = = material bone frame material
+anim 1.0 anim material frame =
+bone
+material -1 anim frame -1 -1
+frame vertex texture 0.500000 material anim
+frame
+vertex bone material bone -1 0.500000 vertex anim 0.500000 bone frame
+anim
+1.0 = 1.0
+material frame material = frame anim 1.0 0.500000 -1
+1.0 bone
+= -1
+frame 0.500000 =
+frame frame vertex 0.500000 frame
+frame
+anim
\ No newline at end of file
@@ -0,0 +1,25 @@
+1.0 material
+0.500000 texture = texture frame
+vertex = bone
+-1
+frame material vertex = anim material
+vertex frame material
+material
+frame
+1.0 0.500000 bone material -1 -1 anim = anim 1.0 1.0 anim
+0.500000 material
+anim = texture 1.0
+bone =
+0.500000 vertex
+0.500000 texture
+material anim 0.500000 1.0
+0.500000 material texture 1.0 bone bone -1 -1 bone texture bone bone 1.0 -1 anim 0.500000 anim = anim -1 material
+1.0 = 0.500000 material 0.500000 vertex texture anim vertex frame anim 0.500000 1.0 anim
+vertex = 1.0 1.0 frame material = = 0.500000 vertex
+frame 1.0 bone 0.500000
+anim texture texture -1 frame anim
+bone -1 material frame vertex anim material 0.500000 =
+frame vertex
+anim frame 1.0 0.500000 material material anim bone vertex -1
+bone vertex =
+frame f
\ No newline at end of file
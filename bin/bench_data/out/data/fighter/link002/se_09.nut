@@ -0,0 +1,31 @@
+texture anim anim texture 1.0
+vertex material
+bone = bone texture texture 1.0 vertex material -1 vertex frame bone bone
+1.0
+material 0.500000 0.500000
+-1 frame = -1
+material
+material frame 1.0 bone
+vertex
+frame texture texture
+0.500000 1.0
+1.0 frame -1
+material
+frame 1.0 texture
+vertex 0.500000 = frame -1 texture
+material frame texture
+material bone
+-1
+texture 1.0 vertex vertex
+material 0.500000
+0.500000 bone
+frame 0.500000 = material bone bone
+1.0 1.0
+bone anim texture
+texture
+texture anim texture material 0.500000 -1 bone bone
+-1 1.0
+-1
+=
+texture anim material vertex material 1.0 bone vertex
+material t
\ No newline at end of file
@@ -0,0 +1,8 @@
+0.500000 = 0.500000
+1.0 vertex texture texture = anim = frame anim bone
+anim frame
+anim texture texture 0.500000 0.500000 -1
+texture
+1.0 = 0.500000 0.500000 material texture
+texture texture anim = anim
+-1 bone 1.0 frame vertex
@@ -0,0 +1,69 @@
+material bone -1 -1 anim
+material 0.500000
+0.500000 material bone
+vertex 1.0 material 0.500000
+anim bone = anim texture -1 vertex
+bone frame
+material vertex frame -1 -1 =
+material
+anim texture texture 1.0 material frame -1 1.0 0.500000
+frame
+1.0 1.0 -1
+-1 bone 0.500000 texture anim
+= material material
+0.500000
+anim
+frame texture 0.500000 0.500000 vertex
+vertex
+0.500000 0.500000 texture
+0.500000 0.500000 0.500000 material
+anim material vertex vertex = material anim 1.0 material frame = 0.500000 = -1 =
+material 1.0
+frame
+=
+vertex frame
+1.0 vertex
+1.0 =
+frame texture 1.0
+bone texture bone frame vertex material anim material anim
+frame
+frame
+bone texture frame 0.500000 1.0 frame -1 vertex 1.0 vertex 1.0
+bone = texture
+=
+bone texture -1 1.0 anim frame texture bone -1 vertex
+texture = = -1
+texture frame 1.0 bone = 1.0 0.500000 frame texture
+texture
+-1
+texture -1
+texture texture material
+-1 material 0.500000 -1 texture vertex material = bone 0.500000 texture frame vertex
+texture = bone 1.0 texture frame
+1.0 material -1 texture vertex 1.0 bone
+vertex -1 -1 texture
+vertex 0.500000
+= texture material
+frame 1.0
+frame
+=
+frame 1.0 anim material
+material vertex anim
+bone
+= material 1.0
+vertex texture -1 1.0 1.0 anim 1.0 bone material
+frame 0.500000 bone material texture anim 0.500000
+material vertex anim -1 texture texture = = bone
+0.500000 vertex texture 1.0
+material vertex 1.0 frame frame
+vertex 0.500000 vertex texture material vertex vertex 1.0 1.0 -1
+0.500000 = material material bone material bone anim frame
+bone
+material
+texture material = -1
+vertex -1 frame vertex anim
+material frame texture
+-1 1.0 -1
+0.500000 1.0 frame -1 1.0 anim 0.500000 material
+bone = 0.500000 -1 frame
+anim = 
\ No newline at end of file
@@ -0,0 +1,36 @@
+bone frame = = material = anim
+anim material 1.0 = bone 1.0 frame
+texture
+frame anim vertex 0.500000 vertex anim
+1.0 -1 0.500000 material vertex frame material
+material frame
+1.0 0.500000 -1
+vertex
+0.500000 material 1.0 bone
+0.500000 frame 0.500000 bone bone vertex 1.0
+texture frame frame
+vertex anim
+texture bone anim 0.500000
+-1
+vertex bone
+texture -1 frame
+-1 0.500000
+frame
+vertex 0.500000 frame
+0.500000 = anim = 1.0 texture vertex
+texture
+anim texture
+-1 anim = anim
+anim = frame
+=
+0.500000 1.0 bone = material texture =
+bone 0.500000 texture 0.500000 = material = bone bone
+= vertex = =
+bone
+1.0
+=
+texture frame vertex
+= material anim = texture
+0.500000 bone -1 vertex -1 material
+anim bone texture 0.500000
+material frame bone text
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex
+=
+= bone frame bone = -1 anim bone 0.500000 frame
+fram
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture texture 0.500000
+1.0 bone -1 frame frame anim = bone -1 = 0.500000 =
+0.500000
+-1 0.500000
+= bone vertex frame texture
+0.500000
+vertex vertex anim 1.0 1.0 =
+texture
+material
\ No newline at end of file
@@ -0,0 +1,145 @@
+1.0
+0.500000 bone vertex material = bone
+texture vertex
+material bone frame
+0.500000 texture 1.0 material vertex vertex
+frame -1
+texture
+0.500000 = anim 1.0
+material
+= vertex vertex
+frame texture 1.0 material 1.0
+= 1.0
+1.0 material anim
+vertex bone anim -1 -1 0.500000 vertex texture -1 anim material
+bone -1 bone bone = material 1.0 0.500000
+-1 -1 vertex
+frame material
+texture vertex bone 1.0
+1.0 frame texture texture texture texture texture texture -1 vertex
+-1 -1 0.500000 frame anim material vertex vertex texture bone 0.500000 anim bone
+material 0.500000 -1 1.0 =
+bone -1 -1 = vertex 1.0 anim
+texture vertex -1 = frame material material vertex -1 bone = 0.500000 anim -1
+anim 0.500000 0.500000
+=
+frame
+0.500000 0.500000
+1.0 texture material 1.0 bone material 1.0 -1 texture texture
+= material
+material material texture -1 vertex
+frame texture material
+vertex 1.0 frame
+frame 0.500000 frame
+-1 vertex material texture material bone material texture texture
+material =
+texture vertex -1 = anim texture frame frame 1.0 = 1.0 material frame =
+bone = anim texture frame -1
+anim
+0.500000 0.500000
+texture anim anim bone 0.500000 material
+bone = anim 1.0 anim material -1 -1 vertex 0.500000 anim texture
+material =
+anim
+1.0 =
+0.500000 vertex bone frame bone bone
+-1 vertex = bone
+texture texture
+1.0 1.0 bone anim vertex =
+1.0
+= bone vertex 1.0 texture texture material material = = -1 vertex 1.0
+frame
+frame
+0.500000 -1 anim -1 1.0 0.500000 bone vertex anim material
+-1 = texture 0.500000 vertex
+1.0 frame material
+anim -1 0.500000
+material
+material 1.0 texture
+0.500000
+vertex
+-1 -1
+texture bone vertex
+-1 = = vertex material
+-1 1.0 -1 = vertex bone
+-1 vertex vertex texture texture
+0.500000 anim frame material = =
+frame
+vertex = =
+texture material
+-1 bone frame frame
+1.0 0.500000
+material
+0.500000 bone = -1 material bone bone texture texture
+bone 1.0 texture -1 material
+-1 1.0 = texture anim -1
+vertex = 1.0 material 0.500000 -1 -1 0.500000
+texture 1.0
+vertex
+anim 0.500000 -1 bone bone bone
+= 0.500000 vertex
+0.500000 frame -1 frame
+1.0
+vertex
+texture 1.0 vertex -1 anim -1
+0.500000 texture -1 = material 0.500000 0.500000 = frame
+0.500000 -1 vertex vertex material -1
+0.500000 anim vertex texture 1.0 bone anim material = 1.0 -1
+-1 material bone -1 -1
+0.500000
+texture = 1.0 1.0 1.0 1.0 material
+vertex texture
+vertex -1 texture texture
+= -1 vertex 1.0
+frame frame
+material texture anim 0.500000 = vertex texture
+material
+1.0 vertex = -1
+anim material 0.500000
+-1 texture
+frame 0.500000 -1 material
+= = 0.500000
+-1
+vertex anim frame
+frame
+0.500000 frame -1 frame 1.0 texture
+1.0 material
+0.500000 -1 vertex
+1.0 1.0 bone frame 1.0
+frame frame bone bone frame
+bone bone 1.0 vertex vertex
+anim frame =
+anim anim
+frame vertex
+bone frame 0.500000
+1.0 -1 material 0.500000 vertex texture
+anim 1.0 texture material
+1.0 vertex
+anim material
+material texture frame material
+frame vertex texture -1 = bone vertex texture 1.0 anim vertex 1.0 -1 vertex frame texture bone -1
+anim 1.0 vertex
+1.0
+material -1 anim
+vertex vertex frame material = texture 0.500000 texture texture frame 1.0 =
+0.500000
+frame
+anim 0.500000 texture
+1.0 0.500000
+texture anim -1 0.500000
+material
+1.0 vertex
+material bone material
+0.500000
+1.0 -1 -1 frame
+=
+1.0
+0.500000 frame bone frame 1.0 material -1 0.500000 -1
+1.0 frame texture texture
+= frame
+material anim 0.500000 vertex anim
+vertex anim
+frame
+frame = -1 material material
+texture -1 vertex frame vertex -1 0.500000 -1
+0.500000 material 1.0 frame 1.0 vertex 1.0 anim texture 1.0 
\ No newline at end of file
@@ -0,0 +1,5 @@
+=
+0.500000 texture anim
+bone anim
+1.0 material =
+material vertex 0.500000 -1 material 1.0 anim frame
\ No newline at end of file
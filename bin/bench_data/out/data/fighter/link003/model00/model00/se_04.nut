@@ -0,0 +1,9 @@
+bone vertex vertex
+bone
+0.500000 vertex vertex
+0.500000 anim anim 0.500000 = 0.500000 anim
+-1
+vertex 1.0 1.0 material frame bone
+vertex
+frame vertex vertex
+= 1.0 0.500000 0.500000 anim 1.0 t
\ No newline at end of file
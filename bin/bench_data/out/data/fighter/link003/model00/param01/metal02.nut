@@ -0,0 +1,6 @@
+= vertex vertex
+anim bone vertex
+1.0 bone material anim
+0.500000 material
+frame material frame anim texture
+verte
\ No newline at end of file
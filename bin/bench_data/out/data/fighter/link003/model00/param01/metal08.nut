@@ -0,0 +1,14 @@
+=
+= bone
+anim
+-1 frame vertex 0.500000 anim texture
+texture -1 -1
+= anim 1.0 bone material vertex texture 0.500000 -1 1.0
+texture
+-1 1.0
+= texture bone
+material
+frame
+0.500000 1.0 0.500000 -1
+vertex = bone frame material
+1.0
\ No newline at end of file
@@ -0,0 +1,33 @@
+bone bone
+vertex =
+=
+material 1.0 texture vertex -1
+vertex 1.0 material
+0.500000 vertex
+= = 1.0 1.0 frame bone
+0.500000 texture
+material -1 0.500000
+= texture 1.0 texture material anim texture -1
+vertex frame 0.500000
+texture 0.500000
+vertex
+anim vertex bone vertex 0.500000 texture
+anim vertex
+frame texture
+0.500000 0.500000 -1
+bone
+= texture vertex 1.0 texture frame
+anim bone material bone frame
+bone anim
+texture -1 -1 bone material 1.0 material frame anim 1.0
+bone texture texture material 0.500000 -1 0.500000 bone =
+1.0 0.500000 vertex 0.500000 material 0.500000 = material
+texture 1.0
+texture
+0.500000
+anim -1 1.0
+material frame
+-1 texture -1 -1 =
+vertex = texture = bone 1.0 =
+vertex bone = bone =
+1.0 0.50000
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone material vertex
+material anim
\ No newline at end of file
@@ -0,0 +1,14 @@
+= = texture -1 material 0.500000
+anim vertex
+material -1 frame
+texture
+bone anim 0.500000
+-1 vertex texture
+=
+anim bone 1.0
+anim
+texture 1.0 bone bone material 1.0 =
+anim material
+material
+0.500000 material
+0.500000 frame vertex -1 vertex b
\ No newline at end of file
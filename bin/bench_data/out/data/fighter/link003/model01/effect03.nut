@@ -0,0 +1,3 @@
+texture anim = -1
+bone frame =
+texture bon
\ No newline at end of file
@@ -0,0 +1,22 @@
+0.500000 0.500000
+vertex anim frame 1.0 0.500000 1.0 = bone texture anim frame anim anim
+1.0 bone
+anim bone texture 1.0
+vertex
+= -1 = vertex frame vertex anim anim 0.500000
+material
+anim
+0.500000 frame frame
+=
+vertex
+anim 1.0 anim vertex
+material vertex texture frame 1.0 material texture
+1.0 =
+1.0 0.500000
+vertex 0.500000
+frame 0.500000
+frame 1.0 bone
+bone anim -1 material
+-1 anim 0.500000
+= frame =
+1.0 bone -1 texture 1.0 frame materi
\ No newline at end of file
@@ -0,0 +1,16 @@
+texture
+frame frame -1 anim -1 anim
+bone
+vertex material bone 1.0 -1 frame material frame 1.0 frame texture 1.0 anim vertex
+0.500000 -1 0.500000 0.500000
+vertex
+material
+= texture
+= texture 1.0 frame texture 0.500000 anim vertex = = material =
+texture
+1.0 anim
+-1 texture material 1.0 vertex
+anim anim bone frame material
+0.500000 anim -1 texture
+= material -1 1.0 -1 -1 bone 0.500000 material material vertex material -1 material
+frame 0.50000
\ No newline at end of file
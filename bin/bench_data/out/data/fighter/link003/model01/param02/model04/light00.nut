@@ -0,0 +1 @@
+B*F'tHli7)'ٚaDwRy4T*
\ No newline at end of file
@@ -0,0 +1,317 @@
+bone
+= anim = = 0.500000
+vertex
+0.500000 -1
+frame material frame
+=
+texture
+=
+1.0 vertex -1 bone
+1.0 texture
+anim anim -1 anim texture = 0.500000 anim = -1
+bone
+material bone
+vertex
+material
+material texture frame
+texture vertex texture vertex
+= = 1.0
+anim 1.0 anim texture
+0.500000 1.0 texture 1.0 1.0
+1.0 material vertex material anim
+0.500000
+texture bone vertex material
+= 0.500000 frame texture frame = -1
+= 1.0 vertex = vertex -1 frame
+frame frame material 1.0 -1 1.0 bone anim
+-1
+bone vertex
+-1
+= texture bone 0.500000 bone frame
+1.0
+vertex
+-1 anim
+texture
+= -1 texture -1 0.500000 anim
+= 1.0 0.500000
+texture
+anim texture
+= 1.0 = = 1.0 anim = 1.0
+anim =
+texture texture 1.0 material vertex vertex -1 bone material =
+texture frame anim anim
+1.0 material bone vertex 1.0 0.500000 vertex -1 1.0 frame
+bone vertex
+frame
+1.0 material
+vertex 0.500000 -1
+vertex
+1.0 bone anim bone -1 anim
+-1 bone
+-1 frame material anim vertex bone material =
+1.0 -1 anim vertex anim -1 vertex 0.500000
+texture bone
+0.500000 vertex
+-1 1.0 =
+vertex -1
+bone 0.500000 material
+0.500000 -1
+material
+0.500000 vertex
+vertex -1 bone texture material 0.500000 =
+=
+frame material frame 1.0 anim frame =
+material
+bone material frame -1
+frame
+texture
+1.0
+-1
+material
+0.500000
+0.500000 material texture bone
+-1
+-1
+1.0
+= anim frame anim
+bone
+bone =
+vertex anim 1.0 material 0.500000
+-1 material frame frame
+bone material frame anim texture texture vertex -1 texture 0.500000 bone 0.500000 vertex bone 0.500000 texture = anim material vertex
+anim anim material
+vertex texture material anim material texture =
+texture 1.0 = material anim
+frame -1
+1.0 = frame
+texture
+bone 1.0 material anim =
+1.0 frame bone frame 1.0 bone material -1 1.0
+texture
+-1 = bone vertex texture -1 = bone -1 texture = frame -1
+anim vertex vertex 0.500000 = material
+0.500000
+1.0 anim anim frame
+texture 1.0 anim texture material
+= -1 frame anim frame = vertex frame frame 1.0 texture -1 = material texture -1 material
+bone texture -1 =
+1.0
+anim
+0.500000 anim
+-1 vertex frame frame 0.500000 texture
+vertex vertex
+bone -1
+frame
+vertex texture
+texture
+texture texture
+bone 1.0 anim
+-1 texture bone material
+0.500000 0.500000 material 0.500000 = -1 anim 0.500000 = bone bone frame = = frame frame
+texture =
+bone bone
+vertex frame 1.0 0.500000
+vertex texture
+anim material frame material bone
+material vertex bone
+0.500000 = -1 material
+bone
+frame material -1
+frame
+anim
+texture
+anim 1.0 1.0 1.0 0.500000
+texture frame
+1.0 0.500000
+-1 -1 frame bone 1.0 = bone
+1.0 = = 0.500000 frame
+-1 =
+vertex material material
+-1
+frame
+= -1 1.0 texture texture
+anim bone
+anim
+frame 1.0
+frame vertex
+1.0 frame
+-1 0.500000 =
+material
+frame anim
+bone vertex vertex frame
+texture texture frame 1.0
+frame 0.500000 -1 material anim frame
+-1 anim material
+texture -1
+material -1 texture 0.500000
+= anim =
+0.500000 texture material -1 vertex = 0.500000 material
+frame texture anim
+anim -1
+vertex -1
+= bone bone vertex -1 frame vertex
+vertex bone -1 vertex material
+-1 material material
+0.500000
+1.0 -1
+frame
+material
+frame anim -1 anim anim bone anim = vertex bone
+= 1.0
+1.0 = frame
+material = anim
+frame
+-1
+1.0 0.500000 bone frame =
+texture anim -1 texture frame 0.500000
+vertex -1
+frame material material
+anim
+material vertex material texture = 1.0 -1 bone anim 1.0 -1 material -1 texture 0.500000 = bone -1 texture
+1.0 texture
+texture bone 1.0
+0.500000 frame
+=
+-1 1.0 0.500000 vertex frame vertex =
+material frame
+material vertex vertex material vertex vertex 0.500000
+material vertex vertex vertex 1.0 anim vertex =
+0.500000 -1
+= vertex 1.0 -1
+-1 = frame = texture anim
+0.500000
+1.0 0.500000 frame material material texture
+= =
+=
+= 0.500000
+frame material
+1.0
+=
+0.500000 -1 vertex 1.0
+material anim
+0.500000 0.500000 1.0
+-1 anim anim vertex texture
+vertex =
+vertex vertex anim vertex anim material vertex -1 texture -1 1.0 -1 -1
+frame = 0.500000 bone 0.500000 texture vertex
+texture
+anim texture
+vertex 0.500000 material
+frame vertex frame
+vertex anim -1
+-1 =
+anim
+frame
+vertex 1.0 frame texture 0.500000 bone material
+bone texture vertex frame material anim 0.500000 vertex = =
+texture 0.500000
+material = 1.0
+-1
+texture
+texture
+texture material
+bone anim = bone 1.0
+frame 1.0 0.500000
+material frame vertex texture bone
+bone bone material -1
+anim 0.500000 bone bone = material 1.0 material
+-1
+anim anim frame
+-1 anim 1.0 anim anim
+anim
+frame material material bone 1.0 vertex vertex frame vertex
+-1 -1 material anim
+texture vertex = 1.0 texture 0.500000 anim
+material -1 1.0 material
+texture -1 frame
+anim vertex 0.500000
+anim
+material
+vertex frame 1.0 0.500000 anim anim material =
+material bone
+bone
+1.0 texture
+1.0 -1 1.0
+frame texture texture = 1.0
+bone = bone material material anim
+anim 0.500000 anim -1 frame
+texture anim -1
+vertex bone 1.0 bone -1
+bone 1.0 -1 = bone material frame material = anim frame
+frame 0.500000
+-1 1.0 bone -1 1.0 material
+material
+material
+frame -1 texture vertex -1 frame anim anim
+anim material
+-1 material bone material -1 -1 anim -1 frame anim
+bone material 1.0 1.0 bone vertex texture
+anim
+frame 1.0 anim
+1.0 -1 anim = material frame anim frame
+vertex 1.0 -1 anim material bone vertex vertex
+1.0 1.0
+vertex
+bone anim vertex vertex vertex material
+frame
+1.0 texture
+anim
+bone material bone anim frame vertex frame anim
+anim vertex -1 frame
+bone
+= anim = texture bone bone material texture = texture
+1.0 anim anim texture 0.500000 texture
+bone material -1 bone vertex
+texture frame
+frame
+bone material vertex bone anim vertex frame material
+-1
+-1 frame bone = 1.0 anim -1 material
+1.0 frame = 1.0 0.500000 =
+frame
+0.500000 -1 frame material texture texture anim texture frame material
+vertex
+= -1 = material 0.500000 texture vertex frame anim -1 1.0 bone 1.0 anim 1.0
+vertex 1.0 1.0
+material anim material 0.500000 vertex
+=
+0.500000
+vertex material = texture
+material 1.0 frame
+material bone =
+-1
+1.0 = texture
+vertex vertex 1.0 1.0 bone
+1.0
+= frame
+1.0 -1
+texture -1 bone texture texture
+1.0 texture bone -1
+vertex bone
+bone material material
+material
+anim frame
+= 1.0 material frame =
+bone bone material -1 -1 anim texture
+material material anim =
+-1 bone texture
+material material
+vertex 1.0 bone 1.0
+anim 0.500000 1.0 vertex frame material vertex bone
+material texture bone
+material texture
+0.500000 -1 0.500000 vertex = material texture bone 0.500000 anim material material bone material = 1.0 material 1.0
+= = texture material 0.500000 texture texture bone
+0.500000 0.500000 bone anim vertex frame vertex bone anim 0.500000
+-1 anim vertex 1.0
+1.0 =
+material material 0.500000 -1 1.0 bone anim
+1.0 anim anim
+texture = texture
+anim bone 0.500000 frame
+material
+= anim
+material =
+frame vertex
+texture texture 0.500000 anim anim vertex 1.0 = 1.0 vertex texture frame texture bone vertex = 0.500000 anim anim anim
+1.0 ve
\ No newline at end of file
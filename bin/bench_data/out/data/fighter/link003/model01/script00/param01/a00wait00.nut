@@ -0,0 +1,7 @@
+anim 0.500000 = material 1.0
+anim 0.500000 anim
+material vertex anim 0.500000 texture 0.500000
+vertex frame frame
+texture frame material vertex 1.0 material =
+1.0 0.500000 anim
+vertex 1.0 texture 0.500000 texture -1 =
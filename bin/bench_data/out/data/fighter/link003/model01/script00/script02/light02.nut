@@ -0,0 +1,10 @@
+texture
+bone
+-1
+bone
+bone
+material frame
+frame material anim = =
+1.0 texture
+anim material bone texture
+texture 0.500000 texture material
\ No newline at end of file
@@ -0,0 +1,118 @@
+0.500000 frame anim bone 0.500000 bone bone vertex anim = -1
+texture bone
+material material
+anim 1.0 0.500000 1.0 bone vertex
+frame frame vertex texture
+material
+texture 1.0 0.500000 1.0 frame
+texture
+1.0 frame
+bone 1.0 -1 -1 0.500000 1.0 1.0 =
+texture -1 material
+frame frame texture = = material
+1.0 texture
+frame frame anim bone
+texture vertex frame anim 0.500000 material material frame frame = frame =
+material
+vertex 1.0 frame
+-1 material -1
+texture
+material -1
+vertex 0.500000 1.0 vertex 0.500000 anim -1
+anim -1 material
+-1 anim
+bone 0.500000 material bone 0.500000 anim frame texture material texture texture
+anim vertex material frame =
+frame bone material 1.0 -1
+frame material
+1.0 frame anim bone texture frame material =
+vertex
+bone 0.500000
+0.500000 -1 anim bone vertex = anim
+texture frame 1.0 texture
+vertex -1 bone -1 vertex anim frame material = anim 1.0 texture =
+0.500000 vertex
+1.0
+texture bone vertex
+anim
+= vertex bone texture anim
+anim frame frame = texture bone
+frame vertex 1.0
+bone -1 material vertex texture anim frame
+frame material anim = 1.0 bone = 0.500000 0.500000
+bone
+texture frame texture -1
+0.500000 anim 0.500000
+vertex = 0.500000
+0.500000
+1.0
+0.500000 material vertex
+material material material material anim
+= =
+texture frame frame frame vertex material
+anim texture
+material material -1
+1.0 = texture frame bone = bone material 1.0 anim material texture 0.500000 anim frame
+frame
+frame texture
+= -1 frame bone anim anim vertex = frame frame anim bone material 0.500000 frame 1.0 material -1 vertex -1 texture bone = 1.0
+material -1
+1.0 bone = -1 anim
+vertex material anim frame material
+= 0.500000 anim
+bone -1 bone vertex texture
+0.500000 anim
+1.0 anim anim texture 0.500000 bone texture vertex anim -1 -1 anim 0.500000 =
+-1 1.0
+bone
+vertex material -1 0.500000 1.0
+anim
+1.0 bone frame vertex 0.500000 material
+0.500000 vertex 1.0 frame vertex anim material 0.500000
+1.0
+1.0
+0.500000 vertex texture material -1 texture 1.0 material
+texture 0.500000 -1 vertex vertex = bone 0.500000 bone =
+1.0
+0.500000 1.0 -1 texture 0.500000
+vertex = material texture 0.500000 bone anim anim anim = 0.500000
+vertex
+1.0 material -1 bone 1.0 material
+-1 frame
+anim texture
+frame -1 vertex material -1 material
+bone bone texture vertex -1 frame
+1.0 1.0
+= bone anim
+0.500000 bone
+frame bone material -1
+-1 vertex
+vertex frame material anim frame
+vertex = texture frame bone
+anim = texture 1.0 1.0 material
+1.0 = vertex
+frame frame bone 1.0 = vertex frame anim 0.500000
+1.0 0.500000 bone bone 0.500000 frame
+= material material frame = vertex anim vertex vertex bone vertex texture frame = material frame 0.500000 frame 1.0 = texture -1 = -1 1.0 0.500000 anim -1
+material 0.500000
+vertex anim material frame anim
+material bone bone anim vertex material vertex 0.500000 frame texture texture -1 material
+material material vertex = anim -1
+anim
+-1 material material -1 1.0
+vertex material
+= -1
+=
+material vertex -1 frame 0.500000
+0.500000 texture -1 bone vertex vertex frame bone material vertex anim
+= 1.0
+0.500000 = anim frame = anim frame
+=
+= vertex material
+frame
+texture
+material
+0.500000
+1.0
+anim anim
+-1 0.500000 texture
\ No newline at end of file
@@ -0,0 +1,26 @@
+= vertex texture
+vertex bone vertex 1.0 -1 1.0 -1
+anim 0.500000 1.0 frame = 0.500000 vertex -1
+texture anim 1.0 bone 0.500000 bone
+1.0 = anim 1.0
+= 1.0
+bone 1.0
+1.0 0.500000
+0.500000 bone
+material = material
+-1
+frame = 1.0 = vertex 1.0 -1
+material texture material -1 vertex material anim material bone anim anim vertex
+-1 vertex
+0.500000 vertex vertex
+vertex = texture
+bone 0.500000 0.500000
+material
+frame
+0.500000 vertex = 0.500000 material material
+= frame texture frame vertex
+texture 0.500000 anim material vertex 0.500000 anim
+1.0 texture -1 vertex = = texture
+1.0 anim
+= 1.0 1.0 1.0 texture texture bone
+vertex = fram
\ No newline at end of file
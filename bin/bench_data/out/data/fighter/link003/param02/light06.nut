@@ -0,0 +1,232 @@
+texture vertex -1
+0.500000 0.500000 anim
+0.500000 bone texture = 0.500000 = material
+frame
+texture anim
+frame
+anim
+= anim = 0.500000
+0.500000
+anim bone 0.500000 -1 vertex
+bone
+material frame frame anim
+bone bone
+vertex -1 material material 1.0 1.0 -1 = anim = = texture
+=
+-1 anim material 0.500000
+-1 texture texture anim 0.500000
+0.500000 1.0 frame material
+1.0 0.500000
+texture -1
+1.0
+0.500000
+= vertex -1 material
+texture texture anim
+1.0
+bone 0.500000
+-1 texture -1 vertex frame 0.500000
+= bone = frame texture
+material -1 anim
+texture anim 0.500000
+material =
+0.500000 material
+frame
+texture vertex bone anim vertex
+material
+1.0 1.0
+=
+material vertex bone vertex = 1.0 = texture
+material frame texture texture
+anim
+-1 1.0 bone frame
+0.500000 0.500000 -1
+1.0
+anim 0.500000 =
+vertex
+material vertex anim
+vertex bone 1.0 0.500000 texture = material -1 material texture bone texture anim = -1 bone -1 anim
+material 0.500000 = anim material vertex bone anim
+frame
+-1
+vertex 0.500000
+1.0 anim texture anim = material vertex anim bone frame 1.0 anim = 0.500000
+-1 anim -1
+bone bone 1.0 -1 = = anim anim
+=
+vertex texture anim 0.500000 1.0 vertex
+material
+bone vertex
+-1 material 1.0 frame
+texture =
+material material vertex = -1 1.0 -1 -1 anim 1.0 material =
+1.0 = bone vertex material
+0.500000 frame = = vertex -1 bone bone = 1.0
+1.0 = vertex anim vertex
+vertex
+frame
+frame material
+anim
+-1
+texture vertex material frame anim = 1.0 -1 bone -1 0.500000 material = 1.0 vertex anim
+texture frame
+frame frame
+vertex texture bone 0.500000 -1 material = anim frame 0.500000
+material 0.500000 material = 1.0
+frame
+material 1.0 -1 bone anim
+texture
+-1 0.500000 1.0 vertex
+vertex -1
+frame =
+texture -1 bone = -1
+material -1 bone
+0.500000 1.0 anim = 1.0
+anim material frame material 1.0
+anim 0.500000 1.0 frame frame anim -1 vertex vertex bone 0.500000 texture texture
+frame anim = -1
+0.500000 material -1
+-1 anim 1.0
+texture -1
+texture =
+material material frame material bone -1
+-1
+frame material -1 texture texture vertex -1 material 0.500000
+=
+vertex
+-1 0.500000 vertex
+vertex material
+material -1 vertex frame 1.0 0.500000
+anim
+anim 0.500000 vertex frame frame bone -1 1.0 bone
+1.0 anim frame 0.500000 texture
+frame anim
+bone 1.0
+frame vertex vertex
+-1
+frame material
+-1 anim
+0.500000
+material
+-1 1.0 bone vertex -1 vertex
+0.500000 0.500000
+bone
+0.500000 0.500000 anim 1.0 vertex texture -1 0.500000 1.0 bone material 0.500000
+1.0
+anim = 0.500000 frame 0.500000 vertex vertex
+texture 0.500000 frame
+0.500000 0.500000
+texture material frame bone -1 anim 0.500000 material material 0.500000
+texture
+0.500000 0.500000
+material texture -1 bone -1 -1
+anim -1 bone
+0.500000 frame
+-1 texture material
+anim 0.500000
+material bone 0.500000 anim
+frame
+vertex =
+material 1.0 material bone texture bone
+0.500000 bone bone texture
+texture
+frame vertex material
+material
+bone 1.0 frame anim
+-1
+bone frame material bone 1.0 texture
+texture
+anim bone material bone texture material
+anim frame = material
+vertex
+vertex texture
+texture bone anim vertex material material frame -1
+-1 bone texture 0.500000 anim -1 =
+0.500000
+-1 frame material texture
+bone material 1.0 -1
+vertex texture bone frame
+anim -1 -1 0.500000 = =
+1.0 vertex frame
+0.500000 -1 anim texture 1.0 0.500000 frame 0.500000 1.0
+0.500000
+frame = 0.500000
+-1
+= = 0.500000 vertex bone bone -1 bone vertex vertex texture -1 material
+anim frame 1.0
+0.500000 -1 frame
+frame
+anim material -1 anim anim vertex bone 0.500000 material -1 -1 = =
+anim
+anim
+-1 anim -1 bone = =
+frame texture = material vertex 1.0
+0.500000 = material frame -1
+vertex
+bone
+= = =
+texture vertex anim 1.0 texture vertex bone vertex texture vertex anim
+material bone texture anim
+frame
+vertex
+bone -1 bone 0.500000 vertex = vertex = = 1.0 anim
+material vertex = material anim material bone
+frame texture vertex = -1 anim = frame
+=
+vertex bone frame -1 bone 0.500000 = -1 -1
+0.500000
+frame bone
+material
+-1 =
+1.0 0.500000 texture vertex 1.0 frame -1 bone material
+anim
+-1 0.500000 material
+0.500000 bone texture frame -1 -1 vertex
+0.500000
+bone 0.500000 material 1.0 material frame
+0.500000
+-1 frame
+0.500000 material 1.0 1.0 0.500000 anim frame =
+material = -1 texture -1 texture = anim
+texture
+-1
+material frame
+bone -1 anim
+= 1.0 bone vertex material bone 1.0 anim texture 0.500000 -1 -1 material
+0.500000
+-1 1.0 vertex
+frame
+material -1 -1 frame 1.0 bone vertex 0.500000 frame
+anim material
+frame 1.0 = frame -1
+=
+material 1.0
+1.0 =
+texture -1
+frame frame
+vertex
+anim material frame vertex -1
+0.500000 texture material frame = = vertex texture
+anim
+anim frame frame 1.0 material 0.500000 bone vertex =
+-1
+1.0
+1.0
+material
+vertex
+frame anim anim
+1.0 vertex
+anim -1 frame frame vertex -1
+anim texture material
+frame -1 anim bone material -1 anim 0.500000 0.500000 -1 frame
+1.0 anim
+-1 0.500000
+0.500000 frame bone 1.0 vertex
+-1 material frame 0.500000 0.500000 frame texture -1
+-1 -1 -1 vertex vertex
+0.500000 anim 0.500000
+frame 1.0 material 1.0 frame texture frame material = vertex
+-1 bone
+1.0
+vertex 1.0 0.500000 1.0
+texture =
+0.
\ No newline at end of file
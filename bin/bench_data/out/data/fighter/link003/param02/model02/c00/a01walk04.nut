@@ -0,0 +1,6 @@
+material = 0.500000 texture anim -1 material
+anim
+bone texture anim 0.500000 -1 -1 vertex 0.500000 =
+=
+anim 1.0 texture material anim
+anim = texture = texture f
\ No newline at end of file
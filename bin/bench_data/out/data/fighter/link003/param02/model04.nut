@@ -0,0 +1,2 @@
+-1 -1 = -1 texture 0.500000 anim bone
+= material frame
\ No newline at end of file
@@ -0,0 +1,27 @@
+texture
+frame 1.0
+texture bone
+texture = bone 0.500000 -1 = vertex vertex
+-1 bone texture frame
+bone texture frame material bone =
+anim 1.0 bone texture material -1 anim 0.500000 -1
+material bone
+1.0 = = -1 1.0 material material texture =
+vertex
+bone bone anim
+material 0.500000 vertex
+vertex
+anim bone material 1.0 bone
+texture
+texture material
+frame bone 0.500000 -1 anim
+material 0.500000 = bone texture
+0.500000 1.0
+-1 material material
+bone frame vertex
+anim bone -1 = vertex frame texture
+1.0
+material
+0.500000 = 1.0 0.500000
+= texture = frame frame material
+bone textu
\ No newline at end of file
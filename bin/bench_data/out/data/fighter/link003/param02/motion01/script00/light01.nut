@@ -0,0 +1,279 @@
+texture 1.0 =
+= texture -1 -1 1.0
+vertex 0.500000 material
+0.500000
+anim
+anim -1 bone frame 0.500000 material 0.500000 vertex material
+texture material = texture bone anim texture frame -1 frame
+vertex -1 bone
+vertex -1 texture 1.0
+anim = material
+-1 = frame bone
+material material 0.500000
+-1
+-1
+vertex vertex =
+frame vertex bone 0.500000 0.500000 texture 1.0
+anim 0.500000 texture
+vertex
+material bone texture 1.0 -1 texture 1.0 1.0 vertex = 1.0 vertex vertex
+anim vertex =
+anim texture frame texture material material material material bone anim material bone
+anim = bone -1 0.500000 vertex
+0.500000
+0.500000
+texture
+anim texture 0.500000 frame 0.500000 = bone
+vertex
+1.0 0.500000
+material 0.500000 bone 1.0
+=
+frame vertex material 1.0 = = vertex vertex material 1.0
+frame frame 0.500000 = -1 = = 0.500000 0.500000 vertex
+bone
+1.0 -1 0.500000 anim
+bone -1 = bone -1 0.500000 1.0
+bone
+texture frame
+-1 0.500000 frame anim frame texture -1 anim frame = -1 material bone anim = 0.500000 -1 0.500000 material 1.0 material material = material anim -1 vertex bone 0.500000 material
+-1 material bone texture texture 1.0 frame 1.0 = material frame = -1 0.500000 1.0 = 0.500000 = vertex
+texture 1.0 1.0 vertex
+frame 1.0 frame = 0.500000
+frame -1
+= frame bone 1.0 1.0
+anim = anim
+vertex frame
+0.500000 anim 1.0 texture bone
+-1 bone texture material
+-1 material 1.0 0.500000 0.500000
+1.0 texture -1 material
+anim 0.500000 = 0.500000
+frame vertex bone 1.0 material 0.500000
+anim material 1.0 0.500000 texture
+-1 1.0 frame
+texture = vertex bone 0.500000 =
+anim 1.0 1.0
+material 1.0 anim anim 0.500000 texture vertex
+1.0 0.500000 anim
+0.500000
+texture 1.0
+anim -1
+anim 1.0 -1 vertex anim
+bone
+bone
+1.0 bone frame texture
+bone material vertex = frame =
+vertex bone anim
+-1 material frame material anim = anim
+frame frame material
+= = bone bone
+vertex texture
+-1 texture =
+vertex material vertex
+1.0
+0.500000
+0.500000 material anim
+texture
+1.0 frame
+vertex material anim
+0.500000 0.500000 material
+frame anim material bone
+material = material 0.500000
+-1 vertex texture -1 material texture
+texture material 0.500000
+0.500000 material -1 frame 1.0 frame texture vertex material texture anim 1.0 bone vertex texture
+frame
+frame -1 = texture -1
+texture material
+=
+anim = texture frame anim
+frame texture = 0.500000 material 0.500000 material
+0.500000 material 0.500000 texture
+0.500000 texture texture 1.0 bone
+material frame texture texture bone = -1 = material -1 vertex
+1.0 frame material
+-1 anim
+material bone bone frame vertex 0.500000 bone frame
+anim -1
+vertex
+frame = 1.0 1.0 0.500000 vertex
+1.0
+material
+texture
+= frame material vertex
+0.500000 material bone -1 bone bone 1.0 material -1 anim 1.0 0.500000 material frame frame vertex 0.500000 =
+1.0 frame = material
+bone
+frame texture
+-1 0.500000 frame =
+texture anim = anim -1 vertex
+frame anim
+1.0 -1 frame
+frame texture = anim frame
+material = anim vertex 1.0 texture -1 0.500000
+bone anim anim texture
+material anim 0.500000 vertex 1.0
+1.0 -1 texture frame anim anim 1.0 0.500000
+1.0 bone anim
+0.500000
+= anim
+0.500000 = frame
+anim anim
+bone anim anim texture
+bone 1.0 vertex texture -1 frame -1 frame
+1.0 1.0 bone -1 = 0.500000 1.0 vertex -1 bone anim
+0.500000 0.500000 material =
+frame
+material
+texture 0.500000
+= vertex
+bone -1 vertex
+texture -1 vertex material 0.500000 bone material -1 0.500000 1.0 vertex vertex bone anim
+material 1.0 anim bone -1 frame material
+material
+= material material = -1 = anim anim
+= vertex 1.0 material bone 0.500000 material -1 -1 material
+texture
+material frame frame = frame texture anim frame frame bone
+material anim frame
+vertex anim frame
+material 0.500000 frame
+= = frame 1.0
+vertex texture = 1.0
+anim
+-1 texture vertex 1.0 =
+texture frame 0.500000 0.500000
+= frame vertex 0.500000 1.0 anim = vertex =
+1.0
+= material 1.0 vertex texture anim -1 0.500000 anim anim 0.500000
+-1 1.0 vertex
+texture =
+= frame bone
+1.0 vertex 0.500000 material -1 -1 0.500000 bone frame
+bone
+material
+0.500000 vertex
+=
+1.0
+texture vertex 0.500000 material
+anim -1 =
+= 0.500000
+material vertex 1.0 material anim material 0.500000 frame bone material anim 1.0 0.500000 1.0
+texture
+frame vertex frame texture
+-1 0.500000 frame bone 1.0 frame texture
+-1 anim frame vertex anim bone
+material = bone 1.0
+-1
+frame -1
+-1 texture
+bone = material
+0.500000 anim
+frame anim anim 0.500000 0.500000
+frame = 0.500000
+bone frame frame vertex texture =
+frame -1
+1.0 vertex
+bone vertex material =
+-1 = bone 1.0 bone =
+0.500000 texture bone
+-1
+texture
+anim
+vertex 1.0 material
+bone frame = = material bone
+frame material material = frame
+anim 1.0 1.0 frame
+anim
+material
+material -1
+frame
+frame 1.0 texture material
+vertex 1.0 0.500000 bone vertex -1 vertex 0.500000 -1 = 1.0 material 0.500000
+-1 anim material -1 1.0
+0.500000 anim anim frame 1.0 texture frame 0.500000 = texture texture vertex
+bone = material
+material -1 bone
+frame 1.0
+1.0 1.0 anim
+texture texture bone
+frame 1.0 material = -1 bone 1.0 anim
+bone frame
+1.0 -1 =
+= 1.0 material = -1 material = vertex bone
+texture bone 1.0
+0.500000 0.500000 -1 =
+material 0.500000 texture anim
+texture -1 texture 0.500000 anim vertex
+anim 1.0 bone vertex frame
+texture texture anim
+vertex vertex
+anim
+anim -1 -1 1.0
+material vertex texture -1 texture -1 -1 material material bone vertex frame material -1 0.500000 anim texture anim bone -1 anim material bone
+bone
+vertex
+texture material 1.0 vertex
+anim
+= = 0.500000 anim texture =
+0.500000 material
+texture vertex 1.0 0.500000 0.500000 anim material
+1.0 -1 frame 0.500000 frame 0.500000 1.0
+vertex
+1.0 0.500000 =
+1.0 1.0 -1
+1.0 vertex = texture vertex
+texture anim texture 0.500000 anim
+material 0.500000 -1
+bone
+frame -1 anim -1 material 0.500000 frame bone frame material frame
+material texture 0.500000
+bone
+bone
+0.500000 bone 0.500000 -1 texture = = 1.0
+texture = frame
+bone -1 texture 0.500000 0.500000 vertex material material 0.500000 bone vertex
+frame 0.500000 1.0 material texture bone anim 0.500000 bone material material 1.0 bone bone
+vertex texture = -1
+material material vertex
+0.500000 0.500000 anim -1 texture
+vertex vertex frame material 1.0
+0.500000 1.0 1.0 material 0.500000
+anim
+=
+material -1 texture 0.500000 texture texture frame -1
+material frame material
+1.0 texture bone vertex frame = 1.0 anim
+bone frame vertex material 0.500000 0.500000
+1.0 0.500000
+frame = anim vertex 0.500000 texture 1.0 material bone bone texture 1.0 frame 0.500000 vertex material frame bone anim bone = frame
+material frame = bone
+-1
+bone 0.500000
+texture bone anim texture anim texture
+0.500000 1.0
+frame
+anim -1 anim vertex bone
+= vertex bone bone = 1.0 -1 -1 0.500000 material vertex 1.0
+vertex texture
+1.0 -1
+1.0 anim 0.500000 anim texture vertex anim bone anim
+= frame 0.500000 bone texture anim 0.500000 material texture anim
+vertex vertex texture texture = frame 0.500000 0.500000
+1.0 texture 0.500000
+-1
+= texture -1 vertex
+vertex material material
+= anim material anim 0.500000 bone = 1.0 texture vertex material frame -1 material
+bone vertex 0.500000 bone material anim bone vertex -1 frame
+frame
+vertex vertex bone
+material 1.0 1.0 -1 -1 bone
+anim -1
+vertex 1.0 bone texture =
+material 1.0 bone
+-1 bone 0.500000 bone bone =
+anim material = frame anim material vertex 0.500000 bone
+0.500000
+bone
+vertex frame vertex = frame vertex vertex texture frame f
\ No newline at end of file
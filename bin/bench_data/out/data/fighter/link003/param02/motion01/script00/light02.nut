@@ -0,0 +1,8 @@
+anim texture = vertex
+frame 1.0 frame texture -1
+vertex
+-1 anim frame -1 = 1.0
+1.0 frame
+0.500000 0.500000 texture = vertex
+material
+1.0 b
\ No newline at end of file
@@ -0,0 +1,29 @@
+vertex
+0.500000 texture frame
+-1 material bone
+0.500000 = -1 -1 1.0 anim -1 bone 0.500000
+= material
+anim material
+material
+vertex frame frame frame 1.0 =
+frame
+0.500000 0.500000 -1 1.0 bone =
+=
+material anim
+anim 0.500000 anim 0.500000 anim 1.0 -1 anim bone
+texture material
+1.0 frame frame 1.0 = -1
+anim 0.500000 bone frame texture = frame anim 1.0
+0.500000 texture 1.0 bone
+frame frame bone = 1.0
+-1 anim -1
+vertex 0.500000 texture vertex anim
+0.500000 1.0 -1
+-1 material = vertex 0.500000 0.500000 texture frame
+bone = = -1 1.0 material
+anim -1 vertex bone anim texture
+-1 vertex vertex 0.500000 anim 1.0 0.500000 vertex
+0.500000 -1 texture anim bone anim 1.0 = texture anim anim anim -1 = vertex 1.0 texture = 1.0 material = texture anim anim anim texture 0.500000 material -1 = bone 0.500000 = -1
+texture vertex bone frame 1.0 bone texture bone anim 0.500000
+vertex
+= bone = = material vertex bone 1.0 vertex texture = anim material vertex 0.500000 anim 1
\ No newline at end of file
@@ -0,0 +1,72 @@
+anim =
+bone -1 material = = 0.500000 vertex = material bone -1 -1
+vertex
+= vertex -1 frame 0.500000 anim
+material
+frame
+-1
+anim = 0.500000 0.500000 frame
+bone 0.500000 0.500000 vertex 0.500000 -1 bone vertex = anim =
+1.0 material
+1.0
+texture =
+texture =
+-1
+-1 material 0.500000 anim
+frame
+texture
+= -1
+material anim
+bone
+1.0 texture material
+frame = vertex
+-1 1.0 texture
+-1
+frame =
+frame texture vertex anim
+texture
+anim -1 anim vertex -1 bone
+1.0 =
+bone
+vertex -1
+material vertex = 0.500000 frame vertex 0.500000 material -1 0.500000 1.0 frame vertex material frame
+vertex
+-1
+0.500000
+material anim 1.0
+0.500000 vertex frame bone vertex frame
+0.500000 = bone 1.0
+texture bone anim bone
+0.500000
+anim
+-1 texture 1.0 -1 0.500000
+1.0 1.0 -1
+material = frame vertex texture 1.0 -1 anim
+-1 anim 0.500000
+vertex 1.0 1.0 bone
+-1 0.500000 bone bone anim material vertex 0.500000 frame frame 0.500000 -1 texture anim 0.500000 anim material -1 texture vertex bone vertex -1 frame
+1.0 -1 vertex 1.0 texture 0.500000 material = 0.500000 1.0
+material -1 material 0.500000 anim -1 material
+anim 0.500000 texture = = vertex vertex
+texture
+=
+texture -1
+material anim texture frame
+material bone vertex vertex -1 1.0 frame
+frame bone
+vertex -1 material
+1.0 texture 0.500000 =
+texture
+bone vertex frame
+0.500000
+1.0
+-1
+-1 texture texture
+material
+0.500000
+anim
+anim
+1.0 -1
+0.500000 texture vertex -1 bone
+0.500000
+fram
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim vertex texture 0.500000 texture = bone
+= frame
+= =
@@ -0,0 +1,112 @@
+0.500000 -1 0.500000
+material 0.500000 0.500000
+vertex = anim vertex 0.500000
+-1 bone
+0.500000 = frame 0.500000
+bone -1 anim anim anim -1 anim
+material bone -1 0.500000
+anim = = -1 texture bone bone
+bone
+anim
+bone bone anim
+-1 0.500000 0.500000 texture bone material 0.500000
+-1 texture texture = texture 0.500000
+-1 frame bone
+texture frame anim material =
+texture
+0.500000 0.500000 texture 0.500000 1.0
+1.0 bone material
+bone 0.500000 0.500000
+texture
+texture -1 0.500000 1.0 bone 1.0
+texture
+bone 0.500000 anim frame anim 0.500000 material vertex
+-1 anim material bone 1.0 material =
+anim 1.0 = material anim bone =
+texture -1 material =
+-1
+frame = frame 1.0 -1 material 1.0 frame vertex vertex
+anim 1.0 0.500000 -1 anim -1 = -1
+1.0 anim 0.500000
+0.500000 0.500000 -1 1.0 anim 0.500000 anim -1 texture bone
+0.500000 frame
+anim 0.500000
+0.500000 1.0 1.0 material 0.500000
+= frame frame 0.500000
+vertex
+1.0
+1.0 anim frame material frame anim vertex -1 1.0 = 0.500000 bone
+material
+bone anim anim = -1
+bone anim vertex
+material material
+bone frame frame bone 1.0 bone bone 0.500000 -1
+vertex 0.500000
+anim
+bone texture anim 1.0 0.500000 anim anim bone bone -1
+material material bone
+0.500000
+=
+= bone vertex texture = =
+vertex vertex frame
+0.500000 1.0
+0.500000
+texture vertex
+-1 -1 bone material anim anim material
+= texture = = -1 bone material frame -1 -1 bone
+-1 vertex
+anim
+texture vertex vertex
+anim 1.0 vertex -1 bone material -1 material anim -1
+anim vertex anim 1.0
+vertex = 0.500000 bone material frame 0.500000 anim
+texture -1
+vertex bone -1 bone
+texture 1.0 bone anim -1 bone
+material
+= 1.0 -1
+material 0.500000 vertex bone -1
+=
+= 0.500000
+-1 1.0
+material -1
+anim material anim vertex material vertex
+0.500000 0.500000 =
+material = material
+frame =
+1.0
+anim
+texture
+-1 =
+0.500000 bone =
+texture texture -1 frame anim anim = frame texture bone bone frame
+anim 0.500000 -1 frame = = material
+material 0.500000 = material =
+bone
+-1 vertex anim material 1.0 1.0
+1.0 = = 0.500000
+0.500000 vertex 1.0 frame texture
+0.500000 0.500000 = frame
+1.0 bone
+frame frame -1
+frame 0.500000
+frame
+0.500000 0.500000
+texture frame bone = material -1 vertex 0.500000 frame frame material material
+= anim vertex frame 0.500000 bone 0.500000
+1.0
+bone material
+vertex 0.500000
+bone
+-1 bone texture -1 frame
+vertex
+bone bone
+= 0.500000
+bone texture
+=
+texture -1
+-1 =
+vertex bone -1
+1.0 vertex
+0.500000 = vertex
+texture -1 material anim frame = texture mater
\ No newline at end of file
@@ -0,0 +1,19 @@
+anim -1 bone material bone
+frame 0.500000
+0.500000 material texture anim anim
+0.500000 =
+bone
+material -1 -1 -1 bone bone
+= 1.0 frame 0.500000 -1 frame bone frame anim bone -1
+-1 0.500000 material texture
+= 0.500000 anim
+material
+texture anim bone bone
+anim bone material vertex bone bone bone material 0.500000 1.0 bone 0.500000 bone frame 1.0 bone vertex -1
+0.500000 texture anim frame material vertex
+= texture anim vertex anim vertex
+texture
+= anim 1.0
+=
+anim
+mate
\ No newline at end of file
@@ -0,0 +1,3 @@
+frame 1.0 0.500000 anim frame 0.500000 frame material
+-1
+bone 
\ No newline at end of file
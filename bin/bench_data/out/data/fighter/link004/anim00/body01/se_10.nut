@@ -0,0 +1,3 @@
+vertex material material frame anim
+vertex = 1.0
+1.0 vertex materi
\ No newline at end of file
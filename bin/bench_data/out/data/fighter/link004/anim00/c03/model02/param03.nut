@@ -0,0 +1,16 @@
+bone 1.0 material
+vertex 0.500000
+= frame anim frame frame vertex -1 0.500000 0.500000 bone 1.0 frame bone 1.0 bone
+vertex vertex
+frame 0.500000 =
+=
+-1 1.0 1.0 0.500000 anim -1 texture -1 bone -1
+bone 1.0 vertex
+0.500000 vertex = anim 0.500000 frame
+frame bone 1.0
+frame anim material frame -1 material texture bone -1 0.500000 vertex vertex
+vertex
+= vertex vertex
+material
+1.0 texture anim = = 1.0 -1 1.0
+materia
\ No newline at end of file
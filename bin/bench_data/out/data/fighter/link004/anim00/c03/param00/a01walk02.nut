@@ -0,0 +1,178 @@
+= texture material frame 0.500000 material
+anim
+texture
+1.0 vertex 1.0 bone
+texture 1.0
+vertex
+= texture material = vertex texture frame bone vertex = vertex frame anim bone anim texture 0.500000 =
+= frame vertex bone
+bone bone anim bone -1 0.500000
+material 1.0 material anim vertex -1 anim texture 1.0 material 1.0 bone bone -1
+0.500000 anim -1 anim
+vertex bone anim -1 frame anim vertex 0.500000 0.500000 texture bone bone
+=
+frame bone anim 0.500000 texture -1 -1 bone material
+anim frame
+vertex bone -1 vertex -1 bone = 1.0
+bone 0.500000
+1.0 texture =
+frame
+vertex bone 1.0
+anim bone = = bone -1 = texture frame material
+-1 anim material
+vertex vertex anim bone bone anim -1 anim vertex texture = 1.0 = anim
+texture bone texture 0.500000 bone
+anim anim material anim
+material 0.500000 vertex
+1.0 1.0 0.500000 texture frame =
+bone 0.500000 material =
+texture 0.500000 0.500000 -1 material -1 vertex
+1.0 = material vertex frame 1.0 1.0 frame material bone frame bone = material frame = frame 0.500000 frame 1.0 material 0.500000 -1 frame anim -1 1.0
+0.500000 -1 1.0 frame 0.500000 vertex
+anim -1 bone
+material material material
+texture 0.500000
+material anim bone anim -1 = vertex
+material -1 vertex = 0.500000 frame -1 0.500000 = 0.500000 anim
+-1
+texture
+vertex 1.0 0.500000 texture texture anim texture texture
+material bone 0.500000 texture bone
+= texture
+material
+anim texture bone frame texture vertex
+1.0 = frame anim anim vertex 0.500000 anim bone material material -1 anim vertex =
+= bone material texture
+anim material frame material
+material bone bone material vertex 0.500000 material 1.0 frame frame texture 1.0 texture 0.500000 material frame
+texture
+anim frame texture = bone bone frame
+bone anim anim =
+bone
+0.500000
+0.500000 1.0
+0.500000 anim -1
+texture -1
+-1
+anim anim
+= 1.0 0.500000 -1 anim bone = frame
+0.500000 texture anim frame
+1.0 frame anim bone 0.500000 vertex -1 material anim = material 0.500000 anim
+anim
+material vertex
+= frame -1 = -1 =
+-1 frame
+1.0 = bone material 1.0
+anim
+material 0.500000 bone
+-1 vertex bone material =
+frame texture 0.500000
+1.0 vertex -1 frame = anim texture material
+vertex 1.0 anim
+anim
+anim frame anim bone -1 material
+bone -1 vertex
+anim
+texture
+0.500000 texture 1.0
+-1 = 1.0
+bone 1.0
+0.500000 anim
+-1 vertex material texture texture material -1 anim material vertex
+-1 vertex 0.500000 bone material frame -1 1.0 frame material material frame material
+= = vertex bone
+-1 frame material -1 vertex 0.500000
+vertex vertex =
+texture anim 0.500000 anim frame
+material
+anim anim
+bone
+texture
+texture texture 1.0 1.0 =
+=
+-1 material texture
+frame =
+vertex frame frame
+1.0 1.0 texture 1.0 texture
+material 1.0 frame bone -1 0.500000 texture anim -1 texture = 0.500000 texture bone material
+texture bone vertex frame =
+material 0.500000 1.0 frame
+texture 1.0
+= -1 1.0
+= vertex texture
+material frame 0.500000 material
+=
+0.500000 frame texture anim bone
+0.500000 anim = vertex
+vertex
+= anim frame
+-1 material material 1.0 material -1 material anim bone frame -1 bone anim vertex anim texture texture
+= vertex -1
+bone vertex texture 1.0 material 0.500000 bone material
+1.0 0.500000 vertex
+anim texture material bone frame
+bone
+1.0 texture texture
+1.0 1.0 -1 material vertex
+= vertex
+bone anim
+bone 1.0 =
+bone texture
+texture
+texture
+bone
+material texture 1.0 anim
+-1 vertex
+material bone = -1 bone
+= anim = =
+=
+= anim bone texture
+material bone material bone 0.500000
+vertex -1 texture
+texture vertex 1.0 -1
+0.500000 bone
+material anim
+1.0
+0.500000 0.500000
+material vertex frame
+material
+material
+material anim
+anim
+vertex bone material
+texture
+frame
+material texture
+texture
+anim bone texture
+0.500000 material 1.0 bone -1 anim vertex
+0.500000 0.500000
+anim -1 1.0 frame 1.0 1.0 = bone bone 1.0 material
+vertex 1.0
+bone vertex bone vertex bone material
+texture anim material
+texture
+material -1 material 0.500000 material anim anim 1.0 -1 0.500000 material
+vertex texture bone 0.500000
+= vertex texture
+material
+vertex frame 1.0
+-1 anim =
+texture frame -1 bone -1 bone vertex vertex vertex
+frame anim
+anim 1.0 = anim = 1.0
+-1 frame bone frame
+frame anim 0.500000 frame texture
+1.0 material bone texture
+bone vertex
+anim frame material = material texture anim
+material 0.500000 1.0 -1 = 0.500000 1.0 1.0 bone material
+-1 frame texture anim material bone anim -1 bone -1
+1.0 frame texture
+material 1.0 =
+vertex bone
+= vertex anim vertex bone -1
+bone 1.0 material
+vertex vertex anim
+= texture
+anim bone
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim anim material frame vertex anim
+1.0 = materi
\ No newline at end of file
@@ -0,0 +1,158 @@
+1.0 bone material 0.500000
+0.500000 bone texture frame -1 bone 1.0 texture 1.0 -1 0.500000 = bone vertex vertex texture
+anim texture material -1
+vertex
+0.500000 texture bone texture material frame 1.0
+frame 0.500000
+frame =
+0.500000 vertex
+material bone
+frame
+vertex texture bone 0.500000
+material = -1 texture 0.500000 anim bone
+bone material anim
+texture vertex bone
+anim
+1.0 frame
+bone = = = texture bone -1
+-1
+1.0 vertex
+= = anim anim texture -1 material
+vertex
+0.500000 material bone
+bone
+0.500000
+-1
+0.500000 material 0.500000 vertex 0.500000 vertex 1.0 = vertex
+anim = material vertex 1.0 frame material frame
+0.500000 texture 1.0 material vertex 0.500000
+bone bone texture material frame vertex anim material 0.500000 texture vertex material material texture -1 -1 texture
+texture
+anim
+vertex anim frame anim texture
+0.500000 1.0 bone anim -1 1.0 =
+1.0
+-1 material texture 1.0 vertex 1.0 -1 anim -1 1.0
+frame vertex = 0.500000 frame = bone = vertex -1 texture texture anim texture
+1.0 anim 0.500000 0.500000 material
+texture texture 0.500000 0.500000 vertex -1 -1 bone frame texture bone 0.500000 vertex
+material material vertex -1 anim 0.500000 anim -1 bone = 0.500000
+texture 1.0 = vertex anim 1.0 bone vertex -1 -1 anim
+bone anim bone
+-1 vertex vertex = texture
+texture
+anim
+bone -1 frame = 0.500000
+1.0 material vertex
+-1
+0.500000 -1 = frame -1 0.500000
+vertex material bone texture 1.0 frame = 0.500000 = -1 frame
+texture 1.0 material anim -1 -1
+1.0 = material anim 1.0 0.500000
+=
+anim bone texture anim texture material 1.0 1.0 -1
+-1 1.0 -1
+vertex
+anim 1.0 0.500000 vertex vertex texture
+0.500000 anim 0.500000 =
+frame = texture material
+anim bone material vertex vertex bone frame -1 material
+= texture = = 1.0
+0.500000 anim texture frame anim
+texture
+= 1.0 vertex -1
+= 1.0 frame bone vertex vertex =
+-1 frame = 0.500000 frame -1 0.500000 anim
+frame vertex anim frame
+vertex frame
+-1 =
+= bone
+0.500000 vertex
+-1 texture 1.0
+-1
+=
+material anim material frame vertex anim anim vertex
+frame
+vertex frame
+anim
+frame 0.500000 =
+bone 1.0 = =
+vertex bone 1.0
+vertex
+anim anim
+= -1 anim
+texture = texture
+-1 1.0
+1.0
+1.0 anim vertex frame 1.0 =
+vertex bone texture texture frame
+-1
+1.0 =
+bone 0.500000 -1 bone
+anim vertex texture frame frame
+1.0 -1
+bone texture
+material = frame -1 1.0
+= anim bone anim
+material material =
+frame texture vertex texture frame bone texture bone
+frame frame
+= vertex bone
+= -1 bone frame frame vertex anim 0.500000 material vertex
+texture
+-1 frame 1.0 material =
+= -1 bone
+1.0 =
+frame
+material anim vertex vertex 1.0 anim material
+bone bone -1
+= vertex material vertex frame bone -1 frame 1.0 -1 bone = anim 0.500000 frame -1 frame
+bone texture -1 frame
+texture 0.500000 texture anim -1 vertex texture bone material = vertex vertex bone
+=
+texture
+= frame 0.500000
+= 1.0 bone
+vertex vertex 1.0 = anim
+0.500000 texture -1
+anim 0.500000 material frame
+anim
+frame -1 frame material anim -1 0.500000 =
+= 0.500000 material 1.0 1.0
+-1 = frame anim vertex = texture 1.0
+texture texture
+= 0.500000 frame frame material vertex material material vertex
+material = frame anim
+= bone 1.0 1.0
+material
+-1 texture
+frame frame anim vertex vertex = 1.0 -1 bone texture material texture
+vertex vertex texture 0.500000 anim 1.0 bone
+frame vertex -1
+1.0 frame bone
+= texture -1
+0.500000
+-1
+0.500000
+= 1.0 1.0 0.500000
+1.0
+-1 = = material bone 0.500000
+0.500000 -1 material anim 1.0 texture 0.500000
+frame material frame texture 1.0
+0.500000 material bone texture 1.0 -1 anim
+texture frame 0.500000 material bone
+1.0 1.0 texture
+material anim bone
+texture
+= anim = 0.500000
+texture = bone
+= material bone 1.0 = 0.500000 0.500000 material =
+0.500000
+bone bone frame
+frame = bone vertex 1.0
+0.500000
+frame vertex = bone frame texture vertex 1.0 texture 1.0 vertex
+bone 0.500000 anim -1 frame vertex 1.0 material frame frame texture 1.0 anim 1.0 texture
+-1 0.500000 = 1.0 0.500000
+bone -1 vertex bone bone = material bone
+vertex = frame anim texture 0.500000 material 
\ No newline at end of file
@@ -0,0 +1 @@
+e!w]ȇja&l˫.-oIBSm>A13b$<tp2{(c
\ No newline at end of file
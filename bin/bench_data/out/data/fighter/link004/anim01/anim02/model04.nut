@@ -0,0 +1,81 @@
+1.0 bone 0.500000 bone
+material 0.500000 texture bone material
+texture 0.500000 -1
+1.0 -1
+material bone anim -1 vertex
+= bone 1.0 = anim bone
+bone vertex texture
+material vertex material vertex
+bone material anim bone
+1.0 anim
+-1
+frame anim
+1.0 0.500000 material anim 1.0 material -1 material
+frame
+anim = = -1 bone frame -1
+= bone
+-1 = frame material
+1.0 = bone
+=
+texture 1.0 anim
+= bone
+frame -1 = texture anim
+bone
+material
+frame 0.500000 bone anim bone 1.0 vertex -1 frame frame anim
+1.0
+1.0
+material vertex 1.0 -1 -1
+frame vertex -1 1.0 = 1.0
+texture anim
+-1 texture 0.500000 =
+= anim anim
+anim anim material frame -1 0.500000 anim bone = frame anim
+vertex bone 1.0 texture vertex texture
+0.500000 texture bone material
+material
+texture -1 = frame bone
+material
+1.0 material material material = =
+-1
+texture vertex material -1 0.500000 anim 0.500000 texture
+anim
+1.0
+bone material = anim frame -1 vertex
+-1 1.0
+anim
+frame -1 material bone 1.0 texture 1.0
+0.500000 1.0 0.500000 texture
+0.500000 vertex frame = vertex
+-1
+-1
+0.500000 0.500000 1.0
+=
+texture bone frame bone anim material frame 1.0 material
+vertex
+texture material -1 material texture -1 vertex
+frame vertex
+material
+anim 0.500000
+frame frame anim 0.500000 vertex bone 0.500000 bone
+1.0 1.0 anim = frame
+= anim
+= anim
+1.0 frame material =
+texture
+1.0 material -1 = = vertex
+0.500000 anim 1.0
+1.0
+vertex material
+material vertex material texture
+texture 1.0 frame frame 0.500000 texture bone -1 vertex frame frame
+anim = bone
+1.0 anim -1
+-1
+anim
+0.500000 anim anim vertex
+-1
+texture bone 0.500000 vertex 0.500000 material bone anim -1 texture 0.500000
+texture material
+=
+frame
\ No newline at end of file
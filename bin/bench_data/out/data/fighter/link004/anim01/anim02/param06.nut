@@ -0,0 +1,39 @@
+-1
+vertex
+= 1.0 = frame = 1.0 -1 vertex frame = material vertex bone =
+0.500000 anim frame 1.0 -1
+=
+texture material vertex material 0.500000 frame
+anim vertex bone material anim 0.500000 1.0 1.0 texture
+anim bone frame = anim bone vertex
+-1
+texture frame
+texture material material texture 0.500000
+material
+0.500000 0.500000
+frame texture 0.500000 bone material anim
+frame anim frame 0.500000 -1 vertex vertex anim anim
+1.0 anim anim material bone = frame
+texture 1.0 bone -1 anim
+1.0 0.500000 bone vertex 0.500000
+texture 0.500000 frame 0.500000
+0.500000
+bone vertex texture =
+=
+frame material bone
+texture 1.0 frame texture 1.0
+1.0 material 0.500000
+anim frame frame 0.500000 bone 1.0
+=
+frame 0.500000 material 1.0 =
+texture vertex 0.500000 material frame = texture anim -1 texture frame frame material 1.0 bone 1.0
+frame
+texture frame
+bone -1
+= texture material anim texture anim 0.500000 =
+bone texture -1
+1.0
+0.500000 material
+material
+-1 frame vertex 1.0
+0.500000 t
\ No newline at end of file
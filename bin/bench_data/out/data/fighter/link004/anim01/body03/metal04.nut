@@ -0,0 +1,83 @@
+anim texture -1 bone = bone frame frame bone
+anim 0.500000
+anim =
+0.500000 vertex vertex vertex
+frame
+vertex anim
+0.500000 0.500000
+material vertex
+1.0
+anim material
+frame = 1.0 bone
+frame texture 1.0 -1 anim -1
+1.0
+1.0 anim
+frame bone 1.0 -1 = texture = 1.0
+material
+material material
+0.500000 frame
+0.500000 =
+0.500000
+material 0.500000
+vertex vertex
+1.0
+texture vertex frame 0.500000 0.500000 texture = material
+1.0 vertex = 1.0
+texture frame -1 1.0 texture = =
+0.500000 material frame texture 1.0 bone frame = frame = bone 1.0 texture 0.500000
+material anim vertex
+texture
+1.0 vertex = 1.0 frame
+1.0 texture material 0.500000
+frame material texture
+frame
+frame
+anim 0.500000 -1
+texture 1.0 material 0.500000 anim frame = frame
+anim texture
+-1 material
+= texture vertex 1.0
+0.500000 -1 0.500000
+anim 0.500000 0.500000 1.0 = bone bone vertex vertex texture
+texture
+bone anim vertex
+0.500000 = 0.500000 texture texture
+0.500000 -1
+=
+0.500000 -1 =
+0.500000 texture 1.0 texture anim
+frame
+0.500000 texture
+material -1 frame
+0.500000 texture
+=
+texture vertex
+1.0 1.0 frame vertex
+1.0 texture
+bone frame material 0.500000 material texture anim material anim
+vertex vertex
+0.500000 vertex anim
+vertex -1 -1 bone vertex frame
+=
+1.0 vertex 1.0 frame bone vertex
+vertex vertex anim texture
+material frame material -1 anim texture
+0.500000 1.0 frame
+bone material bone anim material vertex
+vertex texture frame texture frame texture
+= =
+bone
+material frame
+texture anim 1.0 1.0
+0.500000
+0.500000
+material material bone material anim material bone = = texture
+0.500000 0.500000
+vertex frame 0.500000 -1 anim 0.500000 material
+texture vertex bone frame texture anim bone 1.0 anim anim -1 bone 1.0
+1.0
+material vertex
+material 1.0 material -1 = vertex -1
+bone texture texture frame 0.500000 vertex
+vertex texture
+anim material 1.0 = vertex = 0.500000 vertex 0.500000 0.500
\ No newline at end of file
@@ -0,0 +1,73 @@
+texture frame vertex anim frame anim anim frame vertex
+0.500000 1.0
+frame 1.0 = anim = =
+= texture 0.500000
+= frame bone anim 1.0 -1 vertex material anim bone
+-1 vertex =
+material vertex
+1.0 vertex
+bone
+texture 1.0 vertex material
+texture 1.0 0.500000 1.0 texture
+1.0 = anim 0.500000 bone texture
+bone bone texture
+=
+frame material material bone
+=
+texture material
+vertex -1 = 1.0 material -1 anim
+frame
+vertex
+-1 vertex
+bone vertex -1
+-1 bone bone =
+1.0 frame texture texture vertex
+anim material bone
+0.500000 bone
+frame material anim
+frame
+material
+-1 bone -1
+frame material texture 0.500000 anim
+material
+0.500000 vertex vertex = vertex = =
+texture
+bone 1.0
+frame material material anim -1
+0.500000 vertex = frame 0.500000 -1
+anim
+bone -1
+frame 1.0
+vertex frame = 0.500000 vertex anim texture
+material = 1.0 0.500000
+material vertex
+-1 vertex frame = 0.500000 material texture 0.500000 texture frame
+anim
+texture vertex 0.500000
+=
+anim
+bone frame vertex anim
+texture frame anim anim 1.0
+bone 0.500000 texture material bone anim -1 vertex
+material
+material
+= texture 0.500000 bone texture texture 1.0
+vertex 0.500000
+anim
+0.500000 material vertex texture bone
+texture
+1.0
+bone bone vertex
+-1 material texture
+vertex anim texture
+0.500000 frame
+texture
+anim 0.500000 = 1.0 material 0.500000 vertex vertex
+vertex material 1.0 anim texture texture
+0.500000
+0.500000 0.500000 frame 1.0 -1 0.500000 0.500000 frame material material texture texture anim anim
+texture material =
+material = -1 bone
+1.0
+frame frame material material material frame texture = texture material
+-1 = 0.500000 = frame 1.0 texture 1.0 1.0 bone -1 0.500000 0.500000 frame texture ma
\ No newline at end of file
@@ -0,0 +1,184 @@
+texture
+0.500000
+frame
+vertex bone texture texture
+frame anim bone bone frame
+1.0 -1 bone anim texture anim
+bone -1
+-1
+0.500000 material 0.500000 =
+0.500000 1.0 frame vertex -1 -1 0.500000
+anim
+frame
+frame
+bone 1.0 frame
+-1
+= anim vertex material texture 0.500000 1.0 0.500000 frame
+texture frame texture frame
+frame vertex 1.0
+anim anim bone 0.500000 material 1.0 frame vertex
+bone
+frame -1 material
+1.0 texture texture
+texture texture -1
+-1 = texture anim
+texture
+texture vertex frame anim 0.500000
+anim -1 bone
+texture texture
+frame 1.0
+material 1.0 frame
+1.0 0.500000 anim texture =
+= 0.500000
+vertex bone frame
+= frame vertex
+frame frame anim texture frame frame 0.500000 -1
+-1 -1 material
+= -1 anim material anim frame
+0.500000
+1.0
+vertex texture material 1.0
+material -1 -1
+texture bone material anim vertex
+= anim vertex anim bone texture texture anim 0.500000 0.500000
+0.500000 bone bone anim
+frame 1.0
+0.500000 vertex 0.500000
+bone
+material texture texture 1.0
+texture = anim 0.500000 0.500000 =
+0.500000 vertex 0.500000 -1 anim
+anim
+-1 0.500000 0.500000 1.0 -1
+frame
+=
+material bone texture
+-1 1.0 bone material 0.500000
+material -1
+anim
+-1 -1 bone
+1.0 frame material =
+1.0
+texture frame material 0.500000 anim vertex texture
+material
+anim anim 0.500000 -1 = material = = 1.0 1.0
+frame texture bone
+material bone -1 frame = -1 material material material material
+bone anim 0.500000 = bone vertex anim 1.0
+material -1
+material 0.500000
+= anim frame
+-1 = 1.0 anim
+= texture 1.0 texture 1.0 -1 material -1 -1 material
+= bone vertex bone vertex 0.500000
+-1 vertex 0.500000 texture -1 1.0 anim 0.500000 =
+vertex material material bone
+frame vertex material
+0.500000 texture texture
+-1
+vertex
+bone = bone
+bone frame material anim 1.0 1.0
+bone frame
+= texture frame
+frame vertex
+frame 0.500000 1.0
+-1
+texture 1.0 bone texture
+= frame material
+-1
+1.0 anim
+anim
+-1 vertex texture
+anim 0.500000
+texture
+0.500000
+0.500000 frame 0.500000 texture
+1.0 frame 0.500000 -1 = =
+vertex material anim 1.0 frame bone
+texture
+anim 1.0 =
+1.0
+anim 0.500000
+frame 0.500000 0.500000 anim 1.0
+texture bone
+vertex
+1.0 frame
+0.500000 frame =
+anim 1.0 material
+0.500000 -1 texture frame 1.0 0.500000 1.0
+0.500000
+0.500000 material material -1 1.0 1.0 1.0 1.0 =
+1.0 bone
+0.500000
+0.500000 1.0
+=
+texture bone vertex
+1.0
+= frame anim anim
+texture anim
+0.500000 = vertex vertex bone
+bone 1.0 bone 1.0 -1 frame
+anim vertex
+material = = -1 1.0
+anim 0.500000 1.0 bone frame 1.0 -1
+vertex 0.500000 texture
+= 1.0 = vertex 0.500000 vertex = texture anim frame bone anim -1 anim texture 0.500000 frame bone -1 bone bone = texture
+frame bone anim 0.500000 vertex bone bone
+frame anim material
+vertex vertex -1 bone anim vertex
+0.500000 anim vertex 1.0 anim -1 bone
+frame = 0.500000 material frame
+texture anim anim = anim frame
+1.0 texture
+anim -1
+bone material
+anim material = anim bone vertex bone = 0.500000 frame 0.500000 bone
+-1 1.0 frame frame =
+bone anim 0.500000 frame material material
+0.500000 =
+texture bone -1 -1 texture -1 1.0 material 1.0
+0.500000 1.0
+1.0
+= 1.0 frame texture
+=
+0.500000 texture bone =
+0.500000 frame material -1 -1
+frame
+1.0 texture
+material material bone frame
+texture frame vertex 1.0 0.500000 = material frame 0.500000 texture
+material 0.500000 = = -1 frame anim
+1.0 anim bone bone bone 1.0 = texture 1.0
+vertex frame bone
+1.0 -1 -1
+texture bone 1.0 =
+material -1 bone vertex
+0.500000
+-1 material 1.0
+frame material -1 anim -1
+texture
+material
+bone vertex bone
+0.500000
+= -1 frame anim
+bone bone texture -1 1.0 0.500000 material vertex
+1.0 0.500000 texture material -1 bone material 1.0 material anim = bone 1.0 texture anim = 0.500000
+1.0
+anim
+-1 vertex
+texture
+vertex vertex 1.0 bone frame = material
+=
+bone material =
+frame texture bone texture texture
+vertex material
+vertex texture texture frame bone 1.0 frame bone
+frame anim -1 material texture
+= =
+=
+bone 0.500000 0.500000
+bone 1.0 texture -1 anim 0.500000 1.0 = texture -1 -1 1.0 1.0 1.0 frame material
+texture -1 bone anim = 0.500000
+bone vertex anim -1 =
+-1 1.0 frame frame material texture
\ No newline at end of file
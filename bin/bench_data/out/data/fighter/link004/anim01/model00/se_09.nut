@@ -0,0 +1,8 @@
+-1
+bone 1.0 0.500000 bone
+=
+material -1
+0.500000 =
+bone anim -1 1.0 1.0
+material
+1.0 = material 1.0 bone 0.500000 -1 texture = texture material materia
\ No newline at end of file
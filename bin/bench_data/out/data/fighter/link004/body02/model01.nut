@@ -0,0 +1,4 @@
+=
+anim texture
+-1
+= material texture = 0.50
\ No newline at end of file
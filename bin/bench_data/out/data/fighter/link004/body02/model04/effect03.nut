@@ -0,0 +1,88 @@
+material anim 0.500000 texture 1.0 material material texture frame bone
+1.0 -1
+= vertex 0.500000 -1 texture vertex = 0.500000
+= 1.0 texture -1 anim material
+material material 1.0
+texture -1 bone
+-1 0.500000 1.0
+1.0
+0.500000
+frame bone 1.0 bone -1 anim bone
+texture = texture texture frame 1.0 -1
+anim -1 0.500000
+texture
+texture -1 1.0 texture
+anim vertex -1 1.0 bone texture frame material bone anim =
+vertex
+vertex 1.0 = texture = = texture 1.0 material -1
+1.0 frame 1.0 1.0 frame 0.500000 texture -1 0.500000 -1
+frame anim 0.500000
+= 1.0
+texture 1.0
+bone bone = 0.500000 -1
+texture
+anim
+bone -1 frame anim
+texture 0.500000
+vertex
+0.500000 material
+vertex -1
+material vertex
+material bone anim 1.0 frame -1 anim
+-1
+0.500000
+1.0 1.0 bone texture = frame vertex 0.500000 -1 0.500000 -1
+texture = anim 1.0 bone 1.0
+-1 1.0 0.500000 =
+vertex
+frame
+bone = bone -1 vertex frame bone 1.0 frame frame material
+anim
+anim -1 texture
+frame = 1.0 0.500000 = material material bone 1.0 bone
+1.0 texture = texture 0.500000 -1 frame = material bone anim 0.500000 0.500000 vertex bone texture
+1.0
+bone
+anim
+bone material vertex
+0.500000 anim -1 vertex 0.500000 = 0.500000 1.0 bone vertex 1.0
+-1 material 1.0
+bone anim vertex material anim 1.0
+material material anim anim
+anim material
+-1 material frame 1.0 frame bone = 1.0 anim -1 texture vertex 1.0 0.500000 texture -1 = bone texture =
+1.0 0.500000 frame
+material vertex 1.0 1.0
+0.500000 vertex -1 1.0 -1
+=
+bone texture
+1.0 material
+bone
+0.500000 vertex vertex -1 texture
+anim texture vertex
+-1
+vertex 1.0 texture 0.500000
+frame 1.0 bone -1
+-1 1.0
+anim 1.0 vertex
+-1 1.0
+anim
+material
+0.500000
+texture material frame 0.500000
+=
+0.500000
+-1 0.500000 bone
+= 0.500000
+material material texture -1
+material
+=
+frame = frame frame -1 vertex texture texture bone 0.500000 anim 0.500000 = = texture -1
+vertex
+material
+1.0 1.0 0.500000
+material bone
+texture 0.500000 =
+texture =
+bone 1.0
+= anim 1.0 = = = = vertex = 0.500000 vertex material 1.0 b
\ No newline at end of file
@@ -0,0 +1,7 @@
+0.500000 = anim frame -1 0.500000 frame anim bone frame
+vertex 0.500000 =
+1.0 1.0 0.500000 = material 1.0
+texture 1.0 bone
+1.0 anim
+-1 frame texture -1
+-1 anim 0.500000 -1 
\ No newline at end of file
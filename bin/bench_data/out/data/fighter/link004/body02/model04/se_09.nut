@@ -0,0 +1,74 @@
+bone
+anim material frame =
+= bone texture 0.500000 frame texture vertex -1 =
+bone vertex frame
+anim -1 -1
+material
+0.500000 texture
+vertex texture vertex frame frame material anim
+material
+-1
+vertex bone bone
+vertex texture -1 frame
+vertex texture material anim -1 = 1.0 material texture -1 anim anim 0.500000 anim = = 1.0 0.500000 bone texture
+material texture bone 1.0 -1 1.0
+1.0 -1 0.500000 vertex texture anim
+bone texture
+anim
+1.0 frame anim 0.500000 anim texture bone vertex
+1.0 material
+= = vertex vertex material material 1.0
+1.0
+texture 1.0 anim
+anim = 1.0 texture -1 0.500000 material 1.0 frame = = 0.500000
+bone
+= bone =
+anim material vertex = anim =
+frame material anim =
+0.500000 material bone 0.500000
+anim
+= bone
+0.500000 vertex -1
+-1 frame anim 1.0 vertex vertex anim
+-1 anim = texture vertex 0.500000 vertex
+0.500000 frame vertex 0.500000 frame
+frame
+anim
+0.500000 =
+vertex -1 bone texture
+vertex -1
+anim vertex 1.0 bone
+anim 0.500000 -1 texture vertex
+material material
+bone 1.0 -1
+anim vertex -1 -1
+0.500000 texture texture
+texture anim texture = material vertex texture texture frame
+0.500000 texture
+vertex frame anim
+material bone 0.500000 bone material material -1 0.500000 vertex material 0.500000 texture
+1.0 -1
+frame -1 texture frame bone
+frame texture
+material texture anim bone 1.0 material
+= 0.500000 = -1
+material
+-1 bone
+1.0 vertex -1 0.500000 -1 = material 0.500000 0.500000 0.500000 material
+vertex
+=
+material
+anim
+0.500000 anim frame = = 0.500000 texture
+-1 frame 1.0
+anim
+vertex texture texture texture anim anim
+0.500000
+anim
+material bone 1.0 bone material = texture
+0.500000 1.0
+= texture
+frame
+-1 texture vertex = texture vertex = bone = -1
+vertex -1 bone = = 0.500000 vertex texture
+0.500000 v
\ No newline at end of file
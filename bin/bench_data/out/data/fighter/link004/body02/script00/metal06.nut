@@ -0,0 +1,3 @@
+texture 0.500000 vertex frame
+= 1.0
+0.50000
\ No newline at end of file
@@ -0,0 +1,5 @@
+material -1 anim frame 1.0 material -1
+-1 anim
+= frame
+frame anim material
+= material materi
\ No newline at end of file
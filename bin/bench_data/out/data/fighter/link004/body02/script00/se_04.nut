@@ -0,0 +1,287 @@
+-1 anim bone material
+0.500000 = vertex = = bone
+-1 = material 1.0
+1.0 1.0
+anim
+material material
+frame -1 -1 vertex bone frame vertex
+frame frame
+= texture 1.0
+bone = vertex bone anim -1 vertex
+vertex frame
+vertex
+material material frame
+-1
+vertex
+0.500000 -1 vertex
+= vertex texture -1 frame -1 0.500000 0.500000 frame anim
+frame
+texture anim = texture vertex material =
+material 1.0 0.500000
+bone frame
+frame vertex bone -1 material 0.500000 frame frame
+material
+texture =
+0.500000 bone
+0.500000 frame
+material 1.0 frame -1 1.0 anim frame
+anim = =
+1.0
+texture anim = = 0.500000
+anim
+-1 =
+vertex bone 0.500000
+0.500000 material material 0.500000 bone
+0.500000 frame 1.0 -1 texture frame texture 1.0
+anim = 1.0 material vertex frame = frame vertex 1.0 0.500000 vertex texture material
+anim vertex =
+texture 0.500000 anim
+= texture vertex 1.0 frame material anim
+0.500000 texture material bone
+texture texture -1 -1 =
+frame 0.500000 vertex 0.500000 vertex -1 -1 material frame -1
+frame bone -1 anim =
+material material frame bone
+anim 0.500000
+material
+vertex bone 1.0 frame
+bone 0.500000 -1
+1.0 texture 1.0
+frame vertex frame
+1.0 frame -1 material = texture
+bone material frame
+frame -1 texture 0.500000
+-1 = -1 0.500000 bone texture = material
+frame anim texture
+material -1
+-1
+anim 0.500000 material
+0.500000 1.0
+= frame
+texture frame
+material 0.500000 bone
+material
+0.500000 -1
+1.0
+vertex
+= frame 1.0
+bone bone 1.0
+anim bone =
+bone = material vertex
+frame -1 frame bone anim -1 -1 bone bone
+frame vertex
+material 0.500000 = texture material material texture
+material anim frame -1
+0.500000 material
+texture anim frame material bone 0.500000
+1.0 vertex = material 0.500000 material 0.500000
+frame 1.0
+material -1 anim
+vertex bone
+texture
+texture bone texture vertex
+anim anim texture anim frame anim = vertex = texture 0.500000 vertex
+material vertex
+bone texture frame texture vertex
+1.0 0.500000
+0.500000 material vertex = -1
+-1 anim
+texture
+1.0 material frame = frame texture 0.500000 bone 0.500000 material 0.500000 1.0 anim texture vertex -1 vertex material bone
+bone
+anim = texture
+texture
+=
+vertex vertex material = 1.0 1.0 0.500000 material frame bone 0.500000
+bone bone material material 1.0
+texture frame material material 1.0 anim -1 0.500000 frame
+=
+anim bone = =
+bone 1.0 -1 material material
+bone = vertex material 1.0 0.500000
+material
+bone
+anim 1.0 bone material -1 vertex material bone
+= material -1 frame 0.500000 0.500000 anim material 1.0 frame
+texture material anim material frame
+0.500000 vertex anim anim
+-1 texture = -1 vertex 1.0 = 1.0 -1
+0.500000 frame -1 =
+material anim bone vertex material frame bone texture texture anim bone texture = 1.0
+texture material material
+1.0 texture
+texture = bone
+-1 frame
+bone frame material bone material
+frame 1.0 material
+bone
+-1
+= frame
+bone
+anim -1
+frame 1.0 vertex vertex 0.500000 1.0 material anim frame vertex
+0.500000
+1.0 0.500000 material = -1 texture 0.500000
+frame frame material texture
+bone -1 frame bone
+texture texture = = anim
+bone = anim bone
+0.500000 frame bone
+texture
+vertex
+frame bone 0.500000 material = = = 0.500000 vertex
+= material 1.0 bone 0.500000 material bone 1.0 1.0 1.0 vertex
+frame 0.500000 frame
+bone 1.0 1.0 bone -1 0.500000
+1.0 material vertex bone 1.0 0.500000 frame material 0.500000 vertex
+vertex
+anim frame anim
+anim 0.500000
+frame = -1 -1 texture 1.0 frame 1.0
+anim frame 0.500000 anim vertex frame
+bone
+material = anim
+texture 1.0 -1 1.0 vertex 1.0
+frame bone
+bone
+= bone
+vertex material
+frame anim 0.500000
+-1 = 0.500000 -1
+=
+0.500000 bone anim -1 texture vertex material
+bone 0.500000
+anim
+= texture -1
+anim anim frame 0.500000 vertex bone anim bone -1 1.0 vertex -1
+anim
+texture
+= 1.0 material
+material
+anim vertex = 0.500000 -1 anim 1.0
+bone anim bone
+-1 texture material 1.0
+1.0 material
+1.0 anim bone material = frame bone 1.0 frame
+= vertex 1.0 1.0 anim anim -1 frame material bone vertex 1.0
+anim
+texture vertex
+texture bone frame 0.500000 0.500000 frame anim bone frame
+0.500000 texture bone material
+-1 = vertex anim vertex 0.500000 =
+=
+0.500000 vertex texture frame vertex texture = frame -1
+1.0 bone material
+bone bone =
+frame 0.500000 vertex bone = frame vertex 1.0
+frame texture texture material = 1.0
+frame 0.500000 texture anim texture anim
+vertex -1 anim = 1.0 texture material
+frame
+vertex 1.0 0.500000 0.500000
+anim 0.500000 -1 vertex material
+texture
+vertex texture
+0.500000 vertex anim frame 0.500000
+bone frame bone vertex
+texture frame frame -1 -1 vertex 0.500000
+-1 frame
+texture -1 = = 0.500000 bone -1 frame 0.500000
+bone -1
+-1 anim
+0.500000 bone
+-1 frame
+frame -1
+= 1.0 0.500000 texture -1 -1 bone
+texture bone frame
+1.0
+-1 1.0 anim vertex texture texture =
+bone = bone bone material 1.0 0.500000 material frame 0.500000 1.0 anim
+material anim anim vertex texture material vertex
+bone bone frame
+= anim 1.0 vertex vertex anim
+texture texture anim -1 frame
+0.500000 1.0 anim 0.500000 0.500000 anim texture -1
+1.0
+bone
+1.0 bone anim
+texture
+bone = texture = frame
+material vertex material material = bone -1 vertex
+1.0
+0.500000
+= 1.0 texture 1.0 0.500000 -1 material = vertex
+0.500000
+vertex 0.500000 material -1 = -1 anim = texture
+bone -1 = 1.0
+bone 1.0 -1 material texture frame bone
+-1 frame
+bone bone
+bone -1
+texture 1.0 =
+=
+bone 0.500000 material -1 texture texture texture texture anim -1 anim material material
+anim texture material frame vertex -1 = 1.0 bone
+material -1 0.500000 texture 1.0 1.0 frame texture 1.0 =
+-1 material
+vertex
+material 0.500000
+anim frame
+texture
+1.0 bone texture 1.0 frame bone
+= 1.0
+-1 -1
+frame
+vertex vertex 1.0 material
+anim -1 bone 1.0 material material
+1.0
+1.0 frame material 1.0
+texture
+vertex
+1.0 texture frame material
+-1
+material
+anim anim 0.500000 anim texture anim frame
+bone anim
+bone bone
+anim = -1 anim
+anim
+frame
+0.500000
+texture material frame -1 -1 bone bone 0.500000 material
+-1 vertex
+1.0 0.500000 frame frame
+1.0 bone 0.500000 frame
+anim = texture material vertex 0.500000
+1.0
+material texture
+anim
+-1
+material 1.0 anim anim vertex -1
+material 1.0 material frame anim anim bone 0.500000
+=
+anim
+anim bone
+0.500000 anim anim material bone = bone
+texture 0.500000
+= bone 0.500000
+vertex -1
+anim anim
+texture anim vertex bone 0.500000
+frame 0.500000
+= frame
+frame = bone
+-1 0.500000 material 1.0 vertex
+anim anim
+= = -1 anim 0.500000
+-1 -1 texture
+anim bone vertex
+0.500000 frame bone = 0.500000 = 1.0 =
+0.500000
+anim material 0.500000 bone bone texture
+bone material
+material anim texture anim frame bone frame 1.0 bone
+material anim
+=
+material vertex texture vertex texture anim
+frame 
\ No newline at end of file
@@ -0,0 +1,105 @@
+= = texture frame 0.500000
+0.500000 -1 = bone material
+0.500000 1.0 -1 = material
+material = material vertex anim -1
+bone 0.500000 frame vertex texture 0.500000 = -1 vertex
+1.0 frame
+frame =
+material anim anim
+material frame bone bone 0.500000
+0.500000 texture 0.500000 vertex
+vertex vertex anim bone anim = material -1
+frame -1
+1.0
+vertex -1 -1 texture
+vertex
+material anim
+anim -1 texture vertex 0.500000 bone 0.500000 1.0 0.500000
+1.0 =
+material
+bone 1.0
+1.0 frame 1.0 bone material -1 -1 texture anim texture frame bone bone texture
+frame texture 1.0 -1
+texture material frame material
+texture vertex
+frame
+frame =
+= frame =
+-1 = vertex
+0.500000 bone
+bone
+texture bone frame = material frame
+frame
+vertex -1 frame = texture
+texture
+1.0 bone material frame
+vertex texture
+frame vertex vertex material vertex
+-1 anim material bone frame texture 0.500000 vertex 1.0 bone -1 =
+frame texture frame texture vertex vertex = -1 anim anim
+=
+anim = 0.500000 bone frame texture
+vertex 0.500000
+texture texture material
+-1 -1
+frame 0.500000 -1 vertex bone anim anim material
+-1
+0.500000 vertex vertex
+-1
+=
+1.0 bone frame vertex
+anim bone anim 0.500000
+1.0 0.500000 texture material 1.0 0.500000 -1 =
+anim vertex texture material -1 0.500000 -1 vertex -1 frame -1
+material material
+-1 1.0 1.0
+1.0 material texture
+texture 0.500000 1.0
+0.500000 material material vertex
+bone 1.0 frame bone
+1.0 material vertex bone = anim
+= vertex
+material 0.500000 texture = = frame = frame
+= 1.0 vertex -1 = anim anim
+=
+anim 0.500000 -1 vertex =
+anim 0.500000
+1.0
+0.500000
+-1 frame -1
+= frame 1.0 texture bone bone texture -1 texture
+vertex -1
+vertex
+anim frame 1.0 frame frame = bone 1.0 material -1 1.0 bone frame -1 =
+texture vertex material
+frame frame -1 0.500000
+= bone anim -1 0.500000 material frame
+=
+anim bone vertex vertex vertex bone texture vertex anim frame
+-1 texture frame
+bone
+1.0 0.500000 material -1 anim 0.500000 bone 1.0 material material = texture material 0.500000
+= = -1
+-1 0.500000 material
+=
+texture
+vertex
+0.500000 = anim texture -1
+=
+= anim vertex -1 1.0
+vertex anim
+0.500000 texture 0.500000 frame frame 1.0 frame -1
+= anim
+1.0 anim -1 anim 0.500000 = vertex
+material 0.500000 frame bone frame -1 anim 0.500000 = bone frame vertex 1.0
+texture
+texture
+-1
+material -1 material
+texture texture texture 1.0 1.0 material
+0.500000 anim
+anim
+texture texture material
+= = =
+material
+anim vertex 
\ No newline at end of file
@@ -0,0 +1 @@
+.l|ʿ=,[Ʉfz!$w_nWN(eI&λW5TL/)0ؚ3+Pxfx@٤WCvr!
\ No newline at end of file
@@ -0,0 +1,4 @@
+bone 1.0
+-1 frame
+frame 1.0 0.500000 -1 1.0 = -1 0.500000 frame
+-1 = = vertex anim texture 0.500000 vertex frame -1 frame material vertex 0.500000 bone -
\ No newline at end of file
@@ -0,0 +1,173 @@
+1.0 bone
+-1 -1 frame 1.0 bone frame texture
+frame = 1.0 vertex 0.500000 = 1.0 bone vertex
+1.0 1.0 =
+1.0
+anim vertex
+1.0 frame 0.500000 bone 1.0 -1 0.500000 bone
+1.0 1.0 anim 1.0 material
+vertex
+0.500000 = -1 texture vertex material texture
+1.0 -1 -1
+0.500000 = frame 1.0 1.0 material frame anim = = -1
+0.500000
+texture 1.0 anim vertex texture 1.0 0.500000 material
+texture vertex texture texture
+bone anim
+frame 0.500000
+= = 0.500000 anim
+1.0 -1 anim 0.500000 0.500000 0.500000 anim = frame material -1 -1 anim bone 0.500000
+anim 1.0 bone 1.0 bone material vertex
+bone 0.500000 anim bone = texture
+vertex
+1.0 = = bone material frame bone bone anim 1.0 anim vertex 0.500000
+frame anim anim 0.500000 frame anim
+0.500000 vertex -1 -1
+material 1.0 texture
+texture -1 -1 material
+=
+-1 0.500000 bone
+texture = 0.500000 -1 bone vertex -1 texture frame texture 0.500000 =
+vertex
+material
+= -1 0.500000 texture = 0.500000 1.0 0.500000 material
+material frame frame
+texture 0.500000 = anim material bone
+frame material vertex vertex frame vertex
+1.0 material texture frame
+1.0 material material vertex
+frame -1 0.500000
+anim vertex bone 1.0 0.500000 material frame 1.0
+-1
+= 0.500000 frame
+frame
+=
+texture 0.500000 -1 frame vertex material =
+anim texture
+material
+texture
+frame
+vertex material 0.500000 texture frame frame frame material material
+1.0 frame 1.0 = anim anim
+-1 texture anim 0.500000 bone
+1.0 = material
+= bone
+bone anim 1.0 material material 1.0 frame
+texture -1 texture
+bone
+1.0 material frame bone
+-1 bone
+0.500000 =
+material 0.500000 bone bone = = 1.0 -1
+anim -1 anim vertex anim
+texture
+0.500000 -1 material
+material 1.0 texture
+frame
+material -1 texture
+-1 bone frame bone
+material 1.0 anim
+-1
+0.500000
+0.500000 anim 1.0 frame vertex 0.500000 vertex anim
+material
+texture 1.0
+= anim = bone material -1 = bone 1.0 -1 bone = frame texture -1 frame = -1 1.0 -1 bone material anim frame
+-1 =
+vertex vertex -1 material 0.500000
+material 0.500000 material
+=
+-1
+anim frame
+=
+material material
+vertex =
+0.500000 texture
+1.0 texture
+texture bone
+texture
+anim bone 1.0 anim -1
+bone frame vertex
+material 0.500000
+texture
+vertex frame
+-1 -1
+bone 1.0 material material
+material -1 bone anim
+0.500000 bone vertex vertex 0.500000 1.0 texture
+material vertex
+= 0.500000 1.0
+anim texture material
+=
+bone frame 0.500000 texture anim texture vertex material
+-1
+frame =
+-1 anim frame frame
+frame
+bone = -1 texture
+1.0
+texture
+-1 0.500000 anim = bone vertex 1.0 material
+frame = frame vertex 0.500000 1.0 -1
+0.500000 material 0.500000 -1 texture 0.500000
+bone frame 1.0 bone
+-1 -1
+frame material 0.500000 vertex 0.500000 bone -1
+= vertex 1.0 texture
+vertex 1.0 1.0
+vertex anim vertex -1 0.500000
+vertex vertex material frame =
+anim 0.500000 -1
+frame -1 vertex -1 = frame
+vertex
+bone material
+texture
+0.500000
+-1 frame bone -1 -1 frame
+anim
+=
+bone =
+0.500000 texture
+material frame = frame = frame
+= 1.0 frame vertex anim 0.500000 vertex frame = 1.0
+1.0 frame
+1.0 material frame 1.0 material = anim = vertex 0.500000
+-1 bone bone bone 0.500000
+0.500000 vertex 1.0 texture texture texture
+frame
+1.0 frame = -1 vertex 1.0 texture -1 =
+anim bone
+texture
+bone = material material anim anim
+vertex anim vertex
+anim 1.0 bone bone = 1.0 1.0
+texture
+vertex anim
+=
+texture texture -1 -1 anim bone bone
+texture
+material = 0.500000 =
+-1 material
+=
+1.0 0.500000 1.0 anim
+0.500000
+anim -1 1.0 anim
+-1
+anim frame texture
+= -1 bone
+1.0 =
+anim -1 vertex = frame bone anim 0.500000 bone 1.0 = -1 anim bone
+= 1.0 -1 frame
+-1
+-1 anim
+frame 0.500000 1.0 vertex frame vertex
+0.500000 = -1
+bone texture vertex
+anim material
+1.0
+1.0
+vertex 0.500000 0.500000 texture anim frame
+texture
+vertex bone
+-1 vertex bone texture
+m
\ No newline at end of file
@@ -0,0 +1,46 @@
+-1 anim texture bone anim frame -1 anim frame material 0.500000 0.500000 = texture texture
+-1 1.0 frame material =
+frame material
+-1
+anim
+bone anim anim -1 1.0 -1 bone 1.0
+anim vertex vertex = material
+1.0 = texture texture
+1.0
+-1 0.500000 -1
+0.500000
+0.500000 frame
+-1
+-1 0.500000 0.500000 material vertex
+-1 material frame 1.0 =
+anim vertex frame texture material -1
+material 1.0 material
+1.0
+anim = vertex
+1.0 -1
+-1 -1 vertex 1.0
+vertex frame
+texture
+0.500000
+texture anim frame 0.500000 frame
+1.0
+bone anim vertex bone texture frame bone
+texture = = -1 texture 1.0 frame
+bone vertex bone
+material material vertex
+vertex anim -1 anim
+texture
+texture texture
+texture
+material vertex anim frame frame
+texture anim vertex = frame 0.500000
+-1 1.0 0.500000 = material
+bone material
+=
+-1 1.0 frame
+vertex 0.500000 1.0 0.500000 frame 0.500000 0.500000 vertex -1
+= 1.0
+anim anim 1.0 = texture frame
+=
+vertex 1.0 =
+0.500000 vertex texture -1 anim =
\ No newline at end of file
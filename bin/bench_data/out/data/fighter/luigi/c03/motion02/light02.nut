@@ -0,0 +1,162 @@
+0.500000 frame material vertex
+bone anim vertex material texture 1.0 texture
+1.0
+vertex anim 1.0 texture frame texture texture anim =
+-1 anim bone = = -1 0.500000
+anim -1
+0.500000
+frame frame frame frame
+0.500000 vertex bone
+0.500000
+bone
+material material vertex
+material
+material
+0.500000 frame 1.0 bone frame -1 anim =
+vertex -1 bone 0.500000
+material anim bone
+1.0 0.500000 vertex material frame = = -1 material
+-1 bone
+1.0 material texture 0.500000
+frame
+1.0 frame texture
+texture = = = vertex 1.0 1.0 0.500000 frame 0.500000 anim
+material = anim -1 vertex texture -1 anim -1 texture material bone material
+bone 1.0 material frame -1 texture vertex -1 1.0 = frame vertex -1
+-1 vertex 0.500000 0.500000 1.0 bone frame vertex 1.0 1.0 vertex =
+0.500000 = anim
+=
+vertex 1.0 bone bone
+frame bone vertex
+anim = = 1.0 frame anim
+= material 0.500000
+bone material frame frame
+bone anim bone
+bone bone bone
+= texture texture material frame
+texture
+frame material vertex -1 texture -1 frame anim
+= bone = bone 1.0 material vertex
+anim 0.500000 1.0 bone = 1.0
+vertex vertex anim bone
+1.0
+frame
+-1 frame
+material anim -1 bone -1 frame bone =
+0.500000 texture = 1.0 material
+anim
+frame vertex
+= material frame frame
+-1 bone texture bone 0.500000 1.0 -1 0.500000
+= -1
+texture 0.500000 -1 bone = anim texture -1
+1.0
+bone 1.0
+1.0 vertex 0.500000 1.0 anim 1.0 = bone = material frame 0.500000
+bone frame
+0.500000 vertex frame material 0.500000 texture
+1.0
+material = anim vertex anim bone texture
+1.0 -1 vertex
+vertex -1 0.500000 bone
+anim frame
+texture material = frame 1.0
+vertex bone 1.0 bone
+frame 1.0
+-1 1.0 vertex 1.0 0.500000 = anim anim
+texture vertex
+1.0 vertex vertex
+anim 1.0
+1.0 -1 bone texture vertex
+frame bone anim
+texture anim vertex =
+material
+bone anim 0.500000 texture
+frame =
+-1 0.500000 texture vertex 0.500000 bone
+frame anim
+= frame frame bone
+bone frame bone 0.500000
+anim 1.0 anim
+material anim 1.0
+1.0 texture vertex material = frame bone material frame texture material frame material -1
+material
+bone frame
+texture texture = material -1 texture vertex = vertex bone
+bone = texture -1 bone 0.500000
+0.500000 anim
+0.500000
+frame vertex vertex vertex =
+bone frame -1 anim frame
+= 1.0 1.0 -1
+-1 vertex texture bone =
+-1
+texture texture texture = material 1.0
+-1 -1
+material bone vertex
+anim anim
+vertex 0.500000
+frame frame
+0.500000 anim -1 frame 1.0 anim
+texture 1.0 1.0
+frame frame
+bone frame 1.0 1.0
+texture 0.500000 =
+material
+1.0 bone
+frame vertex -1 = 0.500000
+material 1.0
+1.0 0.500000
+1.0 texture
+0.500000 -1 1.0
+texture = 1.0
+frame frame bone
+material
+vertex
+-1 vertex bone
+0.500000 0.500000
+vertex
+anim vertex vertex frame 1.0
+frame
+-1 -1 0.500000 vertex =
+vertex
+vertex
+1.0 bone = anim bone
+-1
+vertex
+-1 -1 vertex
+vertex vertex 1.0 -1
+1.0
+vertex frame -1 texture
+frame 1.0 bone 0.500000 0.500000 -1 material bone
+= texture = anim texture frame material anim 0.500000 = 0.500000 anim anim texture
+1.0 texture anim anim anim
+texture bone vertex texture
+bone 1.0 texture texture
+texture
+texture = -1 1.0
+texture bone vertex frame
+1.0 anim frame frame material anim vertex anim 0.500000 vertex texture anim -1
+=
+vertex = 1.0
+bone 0.500000 -1 frame vertex = 1.0 0.500000 texture -1 frame
+material anim -1 1.0 vertex = frame = bone bone
+1.0 bone frame
+=
+material bone -1
+= bone 0.500000 bone bone 0.500000 material = vertex -1
+texture = bone anim
+0.500000 bone -1 1.0 frame 1.0
+= 0.500000
+vertex material material vertex = material texture frame
+bone frame = -1 material
+-1 anim frame
+bone 0.500000 material material 1.0 -1
+bone 0.500000 texture
+vertex
+-1 anim 0.500000 -1 frame frame
+0.500000 material anim material anim anim material
+material
+bone 0.500000 material
+frame bone -1 anim
+bone frame 0.
\ No newline at end of file
@@ -0,0 +1,339 @@
+frame frame -1 bone 1.0 -1
+1.0 frame vertex frame = anim -1 frame texture frame
+0.500000 = anim 0.500000
+material -1 texture anim
+= vertex
+= frame
+1.0 vertex 0.500000 0.500000 frame texture anim
+material =
+frame = 0.500000 bone -1 = 0.500000 -1 bone 0.500000 vertex 0.500000
+1.0 1.0
+material material 1.0 material anim bone material texture
+1.0 0.500000 anim
+vertex 1.0 bone material frame
+-1 = 1.0 bone bone
+vertex texture
+bone material -1 anim
+= texture frame
+0.500000 bone texture 1.0
+material material anim material -1 texture = texture texture
+-1
+material 1.0 texture bone material
+anim texture vertex 0.500000 1.0
+material vertex texture
+anim
+= vertex
+texture texture
+texture =
+frame vertex anim = anim frame texture texture
+frame vertex frame bone 0.500000
+frame
+anim anim bone 1.0 -1 vertex
+texture -1
+texture texture 1.0 0.500000
+= texture frame frame 0.500000 vertex frame 1.0
+frame -1
+anim vertex
+texture vertex = bone = 1.0
+1.0 material 1.0
+texture 1.0
+= 1.0
+bone 1.0 material 0.500000 vertex material 1.0 -1 anim vertex
+vertex vertex 0.500000 -1 = bone = frame -1
+anim texture frame 0.500000
+vertex material frame texture
+-1 1.0 bone vertex
+= bone 0.500000 vertex
+bone frame frame frame texture
+texture vertex anim
+vertex 1.0 frame = vertex 0.500000
+material
+1.0 -1 anim
+-1 = texture frame texture 0.500000 vertex anim = vertex
+material 0.500000 =
+material texture
+texture
+-1 bone -1 =
+vertex bone vertex 1.0 anim bone 1.0 texture texture vertex
+anim frame -1 anim 1.0 0.500000 material frame
+-1
+vertex bone vertex 0.500000 1.0 = anim 1.0
+material = frame bone vertex
+frame 1.0 anim frame
+-1 vertex vertex
+-1 material
+material = 1.0 0.500000 texture frame frame texture material
+bone bone
+vertex =
+texture texture
+vertex = frame frame
+vertex
+=
+0.500000 bone 1.0
+-1 1.0
+bone
+vertex vertex 1.0 frame vertex frame frame = material vertex material
+vertex vertex material vertex
+anim anim
+-1 vertex frame vertex 0.500000 -1
+0.500000 bone material 1.0
+vertex 1.0 texture anim 0.500000
+anim
+0.500000 texture
+frame -1 material
+material material material anim anim = -1 0.500000 bone 1.0 anim frame =
+anim
+material texture
+texture
+anim
+material
+frame
+anim anim
+material anim texture vertex
+= 1.0 = 1.0
+1.0 material
+1.0 -1 material -1 texture =
+texture 0.500000 texture
+bone
+anim
+anim 1.0 bone
+= bone
+vertex
+-1 0.500000
+0.500000 =
+anim bone
+0.500000 frame
+frame vertex
+frame vertex
+-1 = 0.500000 1.0 bone
+1.0 0.500000 frame 1.0 anim -1 = -1
+anim bone -1 bone frame vertex material bone
+anim anim 0.500000 anim texture texture
+texture = = material 0.500000 texture 1.0
+-1 -1
+bone
+-1 -1
+texture
+1.0 -1 frame -1 0.500000 material 0.500000 0.500000 =
+anim vertex 0.500000 bone material = 0.500000 0.500000 frame material vertex texture frame vertex vertex anim bone material = material
+frame
+texture 1.0 = bone
+frame anim bone
+vertex material texture
+frame
+anim frame anim bone bone material 1.0 texture 1.0 0.500000 anim 0.500000 frame
+1.0
+1.0 frame = =
+= bone = 0.500000 frame anim =
+anim anim
+material
+texture frame bone vertex frame -1
+=
+vertex material
+0.500000
+0.500000 material
+anim = vertex texture
+-1 -1 bone 1.0 1.0 anim material
+material
+bone 0.500000 0.500000
+bone 0.500000
+texture
+0.500000 -1 material material 1.0 material vertex
+texture
+0.500000 bone vertex 0.500000 texture material
+frame
+-1 =
+1.0 0.500000 frame material
+bone
+= texture -1 = frame = vertex frame vertex material = vertex -1 frame vertex -1
+material = texture frame
+bone 0.500000 anim
+0.500000 vertex -1
+material
+1.0 1.0 vertex 0.500000 bone anim material -1 frame anim texture -1 1.0 texture
+texture texture -1 = anim material -1 material -1 1.0
+frame vertex material texture -1
+1.0 anim anim texture anim -1 -1 = texture
+bone 0.500000 1.0 bone
+0.500000
+anim anim 0.500000 material
+material material = 1.0 frame -1
+material
+frame anim
+0.500000 texture frame anim 1.0 -1 1.0 vertex vertex anim = anim texture -1
+=
+material
+1.0 anim material
+anim
+anim texture
+1.0 frame = vertex frame = bone texture bone frame vertex = anim vertex frame 1.0 -1
+texture 1.0 = anim
+texture = material
+0.500000 =
+anim
+material
+texture vertex
+vertex bone frame
+frame
+frame anim
+material = material -1
+texture
+bone 0.500000 bone -1 -1 anim
+bone anim frame vertex 0.500000
+vertex 0.500000
+-1 texture
+anim
+vertex
+-1
+material bone 0.500000
+material 1.0 frame 0.500000 vertex
+bone
+1.0 frame
+material anim 1.0 texture material
+frame vertex texture material -1
+frame -1 0.500000 anim anim
+-1 vertex vertex bone
+material vertex material anim anim
+bone = 0.500000 = texture anim
+-1 0.500000 texture
+= bone vertex anim frame vertex
+0.500000 =
+material
+vertex 0.500000
+0.500000 =
+texture
+vertex = bone material
+vertex material -1 = bone 1.0 anim anim texture bone material
+0.500000 frame anim -1
+anim 0.500000 = vertex 0.500000 material material frame 1.0 1.0 anim = anim 0.500000 frame frame texture
+bone
+-1 bone vertex -1 bone =
+bone anim frame vertex anim = 0.500000 = -1
+material
+texture = 1.0 0.500000
+= anim vertex
+vertex vertex = -1
+-1 = anim material material 1.0 texture = = 0.500000 vertex -1 bone anim
+1.0
+bone
+frame
+frame texture frame
+texture vertex anim texture vertex 1.0 0.500000 anim vertex
+bone -1 material material texture anim bone material -1
+vertex
+texture
+1.0
+frame frame vertex
+frame frame anim 1.0 1.0 1.0 texture
+material -1 bone frame bone
+texture frame
+material
+=
+texture bone
+frame
+texture -1
+-1 -1 frame 0.500000 texture
+1.0 bone vertex
+= material material
+material
+vertex anim anim material -1 bone anim anim material frame anim bone 1.0 vertex texture = vertex 1.0 material -1 vertex material = 1.0 bone
+texture
+vertex vertex material
+0.500000 bone bone 1.0
+frame = vertex material = material = 0.500000 material 1.0 anim
+material texture = -1 -1 -1 -1 texture
+frame 1.0 anim
+bone
+1.0 0.500000 bone texture = vertex anim texture anim material
+bone frame 0.500000
+0.500000 frame texture
+frame
+-1 anim texture frame 0.500000
+vertex =
+= 1.0
+1.0
+bone bone anim
+1.0
+0.500000 texture -1 vertex 0.500000 0.500000
+material -1
+material -1 bone
+1.0
+vertex
+1.0 material
+frame anim anim 0.500000 0.500000 anim texture 0.500000
+0.500000 material vertex
+= frame material 1.0 vertex material
+1.0 frame 1.0
+= anim 0.500000 vertex anim bone texture anim 1.0 material
+0.500000 vertex 0.500000
+0.500000 = frame 1.0 bone = 0.500000
+vertex bone
+1.0 material
+frame texture
+texture material
+bone bone =
+frame anim anim
+frame = bone frame 0.500000 -1 bone
+= 1.0 material
+0.500000 0.500000
+frame = 0.500000
+vertex texture
+material
+-1 frame -1 = material anim
+1.0 vertex
+= bone frame = bone =
+texture 0.500000 0.500000 1.0 1.0 0.500000 frame -1 0.500000
+1.0 0.500000
+anim bone 1.0 -1 =
+material
+= vertex 0.500000 bone 0.500000 anim
+vertex anim frame bone =
+anim
+= 1.0 vertex anim material frame
+material texture 1.0 bone material frame = = -1
+bone vertex bone
+texture -1
+texture 0.500000 texture
+= bone
+bone 1.0 material material anim vertex 1.0 vertex frame 1.0 1.0 material
+-1
+=
+texture anim material
+material bone
+anim
+0.500000 texture
+vertex 1.0
+bone frame 0.500000 -1 vertex 0.500000 bone 0.500000 texture vertex 1.0 bone
+1.0 = = 1.0
+frame anim
+-1 material 1.0
+vertex material 0.500000 material vertex -1 1.0
+vertex frame material 0.500000 0.500000 = -1 vertex 1.0 1.0 texture anim = =
+material 1.0 -1 =
+1.0 anim
+0.500000
+= texture bone vertex 0.500000
+1.0
+1.0 material 1.0 texture vertex bone material texture 1.0 1.0 material bone 1.0 anim material frame
+vertex frame material bone anim material frame material texture -1 -1
+texture vertex texture -1 bone texture = anim 0.500000 texture = 0.500000 material vertex 1.0 bone -1 1.0 1.0 bone texture = frame 0.500000 frame 0.500000 anim
+-1 vertex
+-1
+material -1 =
+0.500000 bone
+1.0 anim bone frame material bone 1.0
+-1 material anim
+bone
+-1
+frame = bone vertex
+texture
+frame
+texture
+1.0
+vertex
+vertex vertex -1 0.500000 -1 texture material -1 material vertex vertex texture material
+1.0 material texture
+texture
+frame frame
+vertex anim anim
+0.5
\ No newline at end of file
@@ -0,0 +1,7 @@
+0.500000 0.500000 material = texture 0.500000 bone
+-1 = -1 -1 frame anim
+0.500000 frame texture anim anim -1
+= 0.500000 anim
+-1 anim
+0.500000 vertex 0.500000 1.0
+-1 -1 texture bone bone mater
\ No newline at end of file
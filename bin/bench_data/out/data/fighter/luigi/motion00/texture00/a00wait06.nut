@@ -0,0 +1,4 @@
+0.500000 vertex texture -1 vertex
+-1 frame
+=
+-1 anim materia
\ No newline at end of file
@@ -0,0 +1,243 @@
+1.0 material 1.0 bone
+= frame texture 0.500000 0.500000 anim material 0.500000 = anim 1.0 -1 vertex anim = material
+1.0 vertex
+anim bone
+vertex frame
+vertex 0.500000 bone bone frame anim vertex frame 1.0
+frame 1.0 anim -1
+frame
+material 1.0 bone
+bone
+1.0 0.500000
+texture vertex
+vertex 0.500000 frame 0.500000
+frame vertex 0.500000
+bone = vertex = = 1.0 texture vertex anim
+material
+frame
+frame material
+material
+frame 1.0 bone texture bone
+texture
+frame -1 texture = anim frame vertex texture
+texture
+anim 1.0 bone bone vertex 0.500000
+-1 vertex -1 = bone vertex
+frame bone vertex texture 1.0
+texture -1 vertex
+vertex -1
+frame bone -1 vertex 1.0 bone
+1.0 vertex 1.0 = texture
+bone
+anim 1.0 = = 0.500000 1.0 1.0
+0.500000 vertex vertex
+0.500000 1.0
+=
+vertex
+texture
+-1 vertex -1 anim 0.500000 0.500000 bone frame anim
+1.0 frame bone anim
+anim 1.0 -1 -1
+material
+anim =
+anim
+bone texture
+0.500000
+1.0 anim
+material texture texture -1 = -1
+-1
+-1 bone
+frame =
+-1 anim vertex 0.500000 1.0 -1
+0.500000 1.0 texture =
+anim bone 0.500000 material 0.500000 frame anim
+0.500000 1.0 texture
+anim
+-1 = = -1 frame anim vertex
+= vertex bone
+texture
+material
+bone 0.500000
+frame frame -1 -1
+texture anim =
+material material vertex material
+vertex
+anim -1 1.0 frame = 1.0 vertex texture
+anim vertex anim material
+frame texture frame texture
+-1 -1 0.500000 anim vertex frame material texture vertex
+anim 0.500000 = = material 1.0 frame 1.0 texture 1.0 anim
+anim 1.0 texture bone material
+frame anim
+texture 1.0 anim
+= texture vertex 1.0 bone
+anim 0.500000 0.500000 texture anim = 1.0
+-1
+anim = bone anim frame bone material -1
+vertex
+bone texture 1.0
+vertex
+frame = vertex
+material 1.0 1.0
+1.0 vertex texture
+vertex material material frame anim texture = vertex
+= anim
+0.500000 0.500000 1.0
+-1
+material
+-1 vertex
+frame anim
+frame = 0.500000 bone
+vertex 1.0 material frame frame
+anim 0.500000 -1
+0.500000
+=
+frame material frame texture bone
+vertex frame
+frame bone
+0.500000
+texture vertex
+vertex texture texture bone -1 frame 0.500000 anim -1
+vertex frame frame
+bone
+texture = texture anim 1.0 bone 1.0
+0.500000 1.0 anim vertex
+anim bone
+-1 = anim
+bone
+material frame texture anim
+= texture anim bone bone
+=
+0.500000 -1 texture
+1.0 texture material material frame
+-1
+bone
+frame material
+-1
+material 1.0 0.500000
+bone vertex texture -1
+1.0 frame =
+anim = texture
+bone frame
+bone vertex texture
+material = 1.0 texture texture texture frame vertex 1.0
+material
+-1
+0.500000 1.0 material
+bone -1 1.0 -1 material
+frame material
+0.500000 0.500000 material anim 1.0 bone -1 anim 0.500000
+-1
+material
+vertex 0.500000 frame =
+frame 1.0 anim
+bone texture 1.0 material vertex anim
+0.500000 1.0 = 1.0 -1 1.0 vertex material
+1.0 material vertex -1 1.0 =
+texture
+0.500000 -1 frame frame vertex -1 frame material texture texture
+bone anim vertex texture 1.0 vertex texture anim frame anim
+1.0 frame 1.0 1.0
+1.0 = texture texture
+bone
+-1 -1 frame
+material
+texture 1.0 anim -1 material vertex anim texture bone vertex anim texture bone = bone 1.0 0.500000 bone vertex
+anim material material material
+texture = anim texture frame -1 bone bone vertex 0.500000 1.0 frame -1 -1 1.0
+1.0 vertex -1 -1
+vertex material frame
+-1 -1
+bone material
+anim anim
+vertex
+0.500000
+material = bone 0.500000 anim 1.0 material
+bone
+vertex 0.500000 -1 bone vertex -1 frame
+material -1 0.500000 vertex 1.0 1.0
+material frame
+-1 material = anim -1
+texture frame 0.500000 bone
+bone vertex
+texture 1.0 0.500000 texture texture bone anim
+0.500000 1.0 frame
+= frame
+1.0
+bone anim -1 anim
+= frame material
+0.500000 vertex material
+material anim material anim = -1 anim
+= vertex 0.500000 frame
+bone 0.500000 material 1.0 frame -1 vertex texture 1.0 texture
+= frame bone frame anim -1 = vertex bone
+= texture -1 1.0 = material frame 1.0
+=
+frame anim -1 -1 texture frame
+bone material material frame frame bone 1.0 bone material
+0.500000 -1 vertex 1.0 1.0 -1 vertex
+bone = anim anim anim -1 -1 =
+vertex frame vertex anim
+bone 0.500000 material anim texture
+1.0
+-1 1.0 0.500000 = material 0.500000 frame 1.0
+texture material = material = -1 material
+1.0 0.500000
+material
+vertex 0.500000 = frame frame 0.500000 =
+= material frame anim material =
+anim frame bone frame anim = 1.0 texture 0.500000 vertex
+1.0 material
+bone anim -1
+vertex
+anim material 0.500000 0.500000 0.500000 anim frame frame vertex 1.0 frame frame 0.500000 frame frame
+frame
+1.0 frame
+material =
+frame 0.500000 1.0 bone
+0.500000 vertex bone 1.0
+anim 0.500000 1.0 1.0 1.0 texture 0.500000 bone anim
+=
+texture -1 bone material
+bone
+anim frame 0.500000 bone material =
+-1 anim material bone bone = 0.500000 0.500000 frame anim 0.500000 material bone -1
+frame
+0.500000 0.500000 material vertex
+frame 1.0
+= texture 0.500000 0.500000 vertex
+0.500000 = material bone =
+-1 vertex
+-1 0.500000 -1 texture 0.500000 = material
+1.0 anim bone 0.500000 -1 -1 0.500000 material 0.500000 bone anim 0.500000 material = vertex texture 1.0 material
+-1 material anim
+frame material = anim 1.0 0.500000 material
+anim
+vertex
+frame 0.500000
+bone = = anim bone bone = vertex -1 =
+texture
+material vertex anim 1.0 0.500000 frame -1 0.500000
+= frame = -1 anim
+bone vertex
+1.0
+= anim
+vertex bone bone
+bone
+texture material 0.500000
+1.0 anim bone frame = frame 1.0
+-1 anim = anim
+vertex
+= anim frame = frame -1
+material bone 0.500000
+-1
+anim -1 frame -1 -1 -1 vertex bone bone -1 = -1 material frame -1 vertex vertex = vertex 0.500000 -1 anim frame
+anim vertex anim 1.0 texture 1.0 0.500000
+1.0 anim = bone
+0.500000 0.500000 anim
+-1 bone = vertex vertex texture frame texture material 0.500000 bone
+-1
+= =
+= material = =
+material 0.500000 vertex vertex frame texture texture = material
+anim vertex
@@ -0,0 +1,30 @@
+material 0.500000
+bone 0.500000
+anim bone 1.0 vertex vertex = material anim anim 1.0 material texture 0.500000 = 0.500000 0.500000 1.0
+-1 material bone texture
+-1 0.500000 -1 -1 frame
+1.0
+texture texture texture anim material 0.500000 material bone texture bone frame 1.0 texture material =
+bone texture = anim -1 material -1 -1 anim
+vertex anim 0.500000
+0.500000 0.500000
+1.0
+texture anim bone vertex material
+anim 0.500000 1.0 1.0
+1.0
+vertex 1.0 anim frame -1 anim anim -1
+frame frame bone vertex
+1.0
+1.0
+bone frame frame vertex = vertex
+frame material bone
+-1 texture
+material anim texture 1.0 -1 material material bone
+bone 1.0
+anim =
+0.500000 material
+texture
+texture anim material 1.0 =
+texture 0.500000 texture 1.0
+material vertex 0.500000
+0.500000 
\ No newline at end of file
@@ -0,0 +1,35 @@
+vertex
+bone
+1.0 frame
+-1
+anim bone anim
+vertex texture material bone
+1.0 material texture anim
+material anim vertex bone frame -1
+1.0 vertex
+1.0 =
+0.500000
+frame
+1.0 vertex texture texture material 0.500000 material
+vertex material vertex bone
+vertex anim = texture 1.0 = = vertex = anim
+texture anim material
+bone
+anim texture frame = vertex texture
+material
+1.0 = vertex vertex 0.500000 texture 0.500000
+= -1
+bone material vertex bone
+-1 bone frame
+vertex texture frame 0.500000 vertex 1.0 anim texture
+bone
+-1 bone
+bone 1.0 vertex 1.0 anim 1.0 bone anim = 0.500000
+=
+anim texture = material
+vertex
+material bone
+anim anim 1.0
+vertex bone = = 1.0 0.500000
+anim material texture bone 0.500000 anim frame 0.500000 =
+frame bone material material bon
\ No newline at end of file
@@ -0,0 +1,20 @@
+frame 0.500000 0.500000 anim = -1
+=
+vertex
+=
+1.0 frame material 0.500000
+bone
+0.500000 material texture -1
+0.500000 anim =
+frame
+bone anim texture 1.0 bone -1
+vertex texture
+bone vertex 0.500000 anim
+1.0 1.0 bone vertex anim
+texture texture 1.0
+0.500000 anim
+0.500000
+texture 1.0 bone
+material bone frame -1 material
+vertex
+materia
\ No newline at end of file
@@ -0,0 +1,204 @@
+0.500000 material vertex
+material frame 0.500000 1.0
+vertex
+1.0 anim frame = vertex vertex
+0.500000 vertex vertex vertex bone frame anim material bone texture -1 -1 = =
+vertex -1 vertex 1.0 texture
+0.500000 -1 -1 bone texture
+-1 material
+vertex texture frame material 0.500000 1.0 -1 =
+1.0 = 0.500000
+frame texture = bone bone 0.500000
+texture material material material vertex material 1.0 frame texture -1 1.0 -1 -1 bone = bone =
+material 1.0 anim 1.0
+=
+texture bone material material bone texture
+texture 0.500000 -1 texture 1.0 0.500000 texture bone 1.0 = anim
+texture vertex vertex anim
+0.500000 1.0
+material bone vertex
+bone material bone texture 1.0 material 1.0 material
+anim anim
+-1 bone -1 = -1 material 1.0 vertex = 0.500000 anim
+bone 0.500000 1.0 bone vertex anim texture
+frame 1.0 -1 vertex
+0.500000 bone vertex anim material -1 -1 -1 vertex 0.500000 0.500000
+texture material 0.500000 1.0 -1
+vertex 1.0
+vertex 1.0 vertex anim =
+frame texture -1
+-1 bone frame
+anim frame anim frame = bone
+vertex 0.500000 0.500000 vertex 0.500000 anim = 1.0 frame =
+=
+anim texture 1.0
+frame texture
+material texture frame
+0.500000 anim material texture = texture anim bone
+anim frame = texture frame anim -1 vertex -1 -1 frame anim vertex
+vertex
+anim anim material texture texture
+frame
+-1 anim frame
+vertex
+0.500000 0.500000
+= material 0.500000 vertex material frame 1.0 material anim bone
+0.500000 texture material
+0.500000 anim 0.500000
+= =
+material = = frame
+0.500000
+0.500000 vertex anim vertex -1 vertex texture -1
+texture
+vertex anim = anim
+1.0 texture bone material bone vertex bone =
+bone material material 1.0 = 0.500000
+1.0 frame
+texture -1 -1
+1.0 =
+texture
+frame -1
+bone = -1
+texture anim
+-1
+anim
+= anim 0.500000 texture -1
+bone
+texture anim material anim
+vertex
+texture bone -1 anim frame 0.500000
+frame 0.500000 = = anim vertex
+vertex bone =
+anim 1.0 vertex anim
+vertex -1 material material
+1.0 0.500000 anim
+vertex = =
+=
+bone -1 1.0 anim
+-1 0.500000 texture texture texture anim texture
+material frame texture
+frame anim vertex
+texture = anim vertex frame 1.0
+1.0
+-1
+texture 1.0 0.500000 material = 1.0 material =
+0.500000 frame = anim material
+bone texture vertex
+-1 1.0
+material =
+frame
+-1 vertex bone frame texture
+anim bone texture material
+anim frame 1.0
+anim -1 anim
+bone material vertex -1 anim -1 vertex
+0.500000 texture material -1 anim material bone -1 1.0 texture material
+1.0 bone
+anim bone -1 frame vertex anim
+-1
+=
+1.0
+= = = 1.0
+anim
+= -1 -1
+vertex 0.500000
+anim 1.0 texture
+texture vertex texture = frame
+= material texture
+frame
+bone anim bone anim 1.0 =
+1.0 texture anim
+bone
+frame 0.500000
+1.0
+vertex anim 0.500000
+bone material frame frame bone material
+texture
+frame -1
+1.0 1.0
+= 0.500000 anim bone anim 1.0
+0.500000 =
+anim 1.0
+frame anim
+anim
+material 0.500000 vertex
+-1
+vertex
+vertex bone 0.500000 -1 vertex frame = frame vertex
+vertex anim =
+anim -1 -1
+anim = -1 material bone vertex
+anim -1 anim texture = bone vertex 1.0
+frame -1 bone -1
+bone
+frame material material bone 1.0 anim
+=
+= 0.500000 0.500000 texture material
+texture
+1.0 -1
+anim material anim material vertex -1 -1 texture = material -1 -1 anim 1.0 0.500000 frame texture anim -1 anim 0.500000 0.500000 0.500000 0.500000 0.500000 anim material = vertex -1 frame
+frame material
+-1 1.0 bone bone anim vertex
+1.0 material 0.500000 frame
+= texture 0.500000 -1 1.0 0.500000 frame anim -1 vertex texture
+1.0 = -1 vertex anim
+anim material material texture
+-1
+anim = texture texture
+frame -1 1.0 -1
+bone texture material frame 1.0 material
+texture texture
+= frame
+= 0.500000
+-1 bone
+material texture vertex texture
+bone material
+1.0 -1 texture frame
+= =
+0.500000 1.0 texture
+material frame 1.0
+frame
+frame -1 frame vertex bone vertex
+vertex 1.0 vertex material
+bone
+anim -1 material texture
+-1
+anim frame bone
+frame 1.0 anim vertex frame =
+0.500000 bone
+frame 0.500000 bone anim = bone frame bone 0.500000
+anim anim frame = 0.500000 -1 bone 0.500000 = 1.0 anim = 1.0 material
+anim -1 = -1 bone -1 frame
+texture bone vertex -1 1.0 vertex
+texture
+bone anim 1.0
+vertex texture anim vertex
+1.0 material anim vertex
+1.0 bone material 0.500000 material vertex material material
+= anim
+= 0.500000
+material =
+anim -1 material frame 1.0 =
+0.500000 vertex -1 material =
+bone anim vertex material frame texture texture 0.500000
+vertex anim material vertex anim -1 0.500000
+vertex
+texture
+texture 0.500000 vertex
+0.500000 texture = 1.0 0.500000 =
+vertex = anim 0.500000 material -1 anim frame frame 1.0 1.0
+bone 1.0 vertex vertex
+frame material
+bone bone
+texture anim anim bone
+anim anim vertex vertex 1.0 vertex 0.500000 -1 1.0 bone 0.500000
+vertex 1.0
+anim material bone 1.0 1.0 texture =
+anim 0.500000 anim 1.0 1.0 bone bone frame
+frame anim anim 1.0
+0.500000
+material 0.500000
+frame material texture material bone 0.500000 0.500000
+frame 1.0
+vertex = = -1 bone =
+frame
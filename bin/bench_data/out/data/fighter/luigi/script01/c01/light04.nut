@@ -0,0 +1,65 @@
+vertex = anim vertex
+texture frame material vertex 1.0 1.0 material
+frame
+1.0
+frame -1 vertex
+texture 1.0 1.0
+frame frame
+= 1.0 frame 0.500000 0.500000 0.500000 vertex
+frame material
+-1 material -1 material frame material texture 1.0 =
+vertex texture 1.0 material vertex = -1 bone frame vertex 0.500000 texture
+bone texture anim 1.0 0.500000
+vertex material frame -1
+1.0 = bone bone frame
+-1
+1.0 vertex -1 -1 0.500000 = 0.500000 frame anim texture
+bone 1.0
+= =
+anim 0.500000 anim anim -1 0.500000 texture 0.500000
+bone 1.0 bone anim texture vertex = 0.500000
+= frame 0.500000 -1 texture
+bone 1.0
+-1
+0.500000 frame 0.500000 texture = frame bone material 1.0 frame texture anim
+texture =
+anim
+material material
+anim
+1.0
+-1 -1 bone material 0.500000 vertex 1.0 frame
+material material vertex
+vertex material bone
+material
+texture anim
+vertex anim
+-1 0.500000 bone texture material vertex frame
+-1 bone
+0.500000 anim 0.500000 vertex vertex
+frame bone material
+vertex
+-1 = anim vertex 0.500000 = vertex
+1.0 =
+texture anim anim
+= 0.500000 1.0 material
+0.500000 -1 anim = material 1.0 -1
+material anim texture bone frame
+1.0 texture texture bone vertex =
+1.0 -1 material 1.0
+0.500000 anim -1
+-1 anim frame 0.500000 0.500000 bone bone bone anim
+anim frame
+frame
+0.500000 1.0
+-1
+material = = anim 1.0 texture anim anim material -1
+vertex material bone
+anim
+=
+bone 1.0 texture frame 1.0 0.500000
+anim texture 0.500000 = frame 0.500000 vertex =
+frame material 0.500000 anim bone bone texture frame
+-1 texture
+frame -1 1.0
+anim
+materi
\ No newline at end of file
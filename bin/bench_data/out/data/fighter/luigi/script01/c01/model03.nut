@@ -0,0 +1,6 @@
+texture vertex
+= -1
+1.0 0.500000
+frame
+anim material vertex =
+0.500000 fra
\ No newline at end of file
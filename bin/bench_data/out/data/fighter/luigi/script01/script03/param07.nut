@@ -0,0 +1,328 @@
+1.0 0.500000 material
+material material frame anim 1.0 1.0 anim bone material
+-1 -1 frame material vertex anim bone = bone frame bone vertex -1
+bone anim bone bone -1
+vertex = anim texture = -1 material
+= frame
+material
+texture 1.0 bone 1.0
+vertex
+-1 frame bone = bone vertex
+frame anim frame -1
+texture
+frame
+1.0 material 1.0 0.500000 anim vertex 1.0 bone -1 material
+anim
+material
+texture material
+0.500000 vertex -1
+0.500000 bone -1 bone material texture = material 0.500000 anim = material frame frame anim material anim material
+bone frame bone -1
+= material = anim frame = material
+= 0.500000 = = vertex
+frame
+bone bone bone vertex material
+vertex 0.500000 bone
+texture -1 1.0 = 0.500000 1.0
+-1 frame
+bone texture
+texture 0.500000 material material
+0.500000 frame -1 vertex texture material vertex bone vertex
+-1 0.500000
+= vertex anim 1.0 texture
+vertex
+material = = frame anim
+vertex
+anim
+0.500000 frame frame anim = 1.0 material texture = texture vertex texture vertex vertex
+texture
+vertex material vertex 0.500000 -1
+-1 frame frame 0.500000
+bone frame
+material anim
+bone 1.0 anim bone vertex texture frame
+vertex anim
+texture frame 1.0 vertex texture
+bone bone
+bone -1 texture vertex
+bone vertex vertex vertex texture texture material
+anim 0.500000 bone
+vertex
+material -1
+0.500000 =
+= 0.500000 material 1.0 anim anim
+1.0
+0.500000 anim 0.500000
+-1 frame material
+texture anim 0.500000 material frame frame texture
+texture
+material
+1.0 1.0
+bone 1.0 vertex
+=
+anim 1.0 material
+1.0
+texture -1 anim vertex frame -1
+anim = = frame frame anim texture -1 material
+= -1 frame anim
+bone
+-1 = vertex texture anim frame 0.500000 -1 -1 texture anim
+frame
+texture 0.500000 frame bone texture
+-1 anim anim = 0.500000 material vertex material vertex bone anim vertex
+-1 bone anim
+texture =
+bone bone frame bone 0.500000 1.0
+0.500000 material anim vertex vertex -1 1.0 bone anim -1 0.500000
+texture
+anim
+texture
+frame -1 vertex texture anim 0.500000
+anim texture 0.500000 1.0
+vertex texture 1.0
+vertex vertex
+anim
+1.0 texture bone texture vertex material vertex 0.500000 anim
+anim vertex bone
+0.500000 = vertex = -1 material -1
+-1 frame frame = 1.0 texture = anim
+1.0
+-1
+0.500000 material material -1 anim -1 bone bone 1.0 anim vertex anim bone anim material texture
+vertex
+frame texture bone
+bone anim texture
+bone bone
+-1 frame bone
+material 0.500000 = vertex
+1.0 texture
+vertex bone frame vertex vertex material material vertex = frame
+vertex
+texture = 0.500000 =
+texture bone anim bone
+-1 texture anim anim -1 -1 vertex 0.500000 frame frame vertex frame anim texture = = 1.0 1.0 1.0
+material 1.0
+vertex material vertex bone frame material -1 vertex
+material = = bone anim material material
+1.0 frame material 0.500000 anim 1.0
+texture =
+0.500000 frame = frame
+0.500000 = texture anim bone
+= frame
+frame 0.500000 vertex frame
+0.500000
+=
+1.0 frame
+1.0 texture material material texture material 0.500000 anim anim
+vertex
+anim = 0.500000 material anim texture
+texture
+=
+frame 0.500000 1.0
+material 0.500000 frame frame texture frame 1.0 texture 1.0 0.500000
+-1
+0.500000 = -1 vertex 1.0 texture
+1.0
+=
+bone
+texture =
+frame vertex 1.0 texture texture
+-1
+frame 0.500000
+bone frame = frame
+= -1
+texture = texture texture bone frame -1 = anim
+texture bone
+texture
+anim bone texture
+anim
+anim texture
+1.0 vertex anim material anim =
+anim
+anim vertex -1
+1.0 anim 0.500000
+1.0
+vertex
+0.500000 1.0 bone
+anim material
+=
+texture anim bone 1.0
+texture material
+bone = 0.500000 vertex 1.0 -1 texture bone material
+texture texture vertex material texture = 0.500000 frame
+frame -1 anim
+material
+texture -1
+material frame =
+= -1 vertex -1
+vertex texture 1.0 frame -1
+texture -1 -1 bone vertex 0.500000 vertex frame texture bone material -1 1.0 0.500000
+bone vertex material material vertex texture bone bone vertex
+frame
+bone
+vertex
+frame texture texture anim -1 frame
+-1 0.500000 bone anim
+1.0 frame
+0.500000 frame vertex
+texture
+texture bone vertex
+vertex
+vertex frame material = 0.500000 texture -1 frame
+1.0
+material texture -1 vertex material material bone
+anim anim 1.0
+bone anim 0.500000 1.0
+material -1 -1
+= material 1.0
+-1 material -1 vertex 0.500000 material material 0.500000 =
+material -1 frame -1
+texture
+1.0 vertex frame texture material
+0.500000
+frame texture vertex frame material
+= frame frame texture frame vertex vertex
+texture
+texture 0.500000 texture -1 -1 anim bone
+vertex frame
+anim texture =
+bone vertex
+bone
+0.500000 anim
+frame
+bone -1 =
+-1
+anim = texture bone bone texture
+vertex = material
+-1 vertex 0.500000 vertex 0.500000
+frame
+texture
+vertex
+anim 1.0 1.0 1.0 = =
+-1 anim
+texture material
+bone texture frame -1
+0.500000 -1 bone 1.0 vertex frame bone vertex
+texture 0.500000 anim vertex frame 0.500000
+0.500000 vertex bone
+frame 1.0 bone
+anim material anim bone
+material
+= texture
+bone -1 = -1 vertex = frame frame
+texture
+1.0 texture vertex
+0.500000 anim texture
+frame anim 0.500000 vertex frame
+anim
+1.0 anim texture frame vertex bone
+anim vertex 1.0 =
+1.0 material 0.500000 0.500000 0.500000
+frame vertex bone bone = 0.500000 = 1.0 -1 0.500000 -1 anim -1 material material frame material anim
+material
+bone vertex frame frame anim
+vertex bone vertex texture = -1 anim
+1.0 anim material anim texture = 0.500000
+texture 1.0
+0.500000 = bone texture
+texture =
+= 0.500000 frame
+vertex -1 material = = texture = frame = anim vertex -1 anim vertex frame -1
+bone anim -1
+1.0 0.500000 bone
+bone
+texture
+frame material 1.0 -1 material 0.500000 texture
+frame -1 frame = =
+bone 1.0 vertex bone frame texture bone anim bone frame
+vertex texture
+1.0 = 1.0 material bone 0.500000
+= -1 frame
+vertex vertex 0.500000 anim bone
+-1 = 1.0 frame bone
+material
+anim anim
+1.0 material anim anim anim -1 0.500000 anim -1 bone
+-1
+anim bone 1.0 vertex texture
+vertex -1 -1 texture = 1.0
+1.0 vertex vertex vertex 0.500000 -1 1.0 0.500000 frame
+material 1.0 0.500000 vertex frame
+-1 -1
+0.500000 0.500000 1.0
+0.500000 vertex bone anim
+material -1 frame vertex texture
+bone texture bone = bone bone vertex texture 0.500000
+vertex
+=
+1.0 bone -1
+0.500000 bone
+1.0 -1 bone 0.500000 = texture
+material material 0.500000 0.500000 frame 0.500000 -1 material frame
+texture -1
+1.0 material material bone
+0.500000
+texture 0.500000 frame material 0.500000
+1.0 frame 0.500000 vertex 1.0 0.500000
+anim material vertex 1.0
+anim -1
+bone frame texture vertex 0.500000 =
+texture
+vertex vertex bone
+bone frame -1
+frame = 0.500000 texture = material
+bone frame 1.0 texture
+= bone material bone texture -1 -1 -1 -1 texture material frame frame -1
+vertex -1 -1 bone -1 anim 1.0 anim
+-1 vertex vertex 0.500000 anim material texture
+frame
+material vertex material 1.0 1.0 0.500000 frame 1.0 anim
+frame anim frame 0.500000 vertex
+frame frame material
+anim bone frame 1.0 -1
+=
+anim 0.500000
+-1
+anim bone frame
+anim frame frame
+-1
+frame anim 0.500000 vertex anim frame frame anim material 1.0
+0.500000 1.0 bone
+anim -1 =
+-1 material bone material
+anim
+-1 bone texture texture bone anim 1.0 bone texture =
+vertex anim 1.0 = anim
+vertex
+material = texture
+material material bone 1.0 vertex -1 -1 -1 texture frame 1.0 vertex vertex bone vertex
+vertex 0.500000 1.0
+anim frame
+vertex material
+0.500000
+1.0 frame
+1.0 -1 0.500000
+vertex bone bone 1.0 material material
+1.0
+material frame
+vertex
+0.500000 0.500000 material texture 1.0 material = anim = frame material
+frame vertex
+material frame
+bone
+material texture frame 1.0 -1 =
+0.500000
+-1 = 1.0
+= -1 anim -1 1.0 frame vertex bone -1
+texture -1 anim
+frame anim texture
+texture material frame bone
+texture
+texture anim
+1.0 0.500000 -1 -1 = = 0.500000 anim = vertex bone = anim bone
+texture material
+0.500000 bone
+texture
+texture = vertex
+bone 0.500000 = frame
+bone m
\ No newline at end of file
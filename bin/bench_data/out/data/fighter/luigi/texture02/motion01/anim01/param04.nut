@@ -0,0 +1,3 @@
+frame
+= vertex 0.500000 vertex texture bone
+texture frame fram
\ No newline at end of file
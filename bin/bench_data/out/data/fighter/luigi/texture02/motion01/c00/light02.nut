@@ -0,0 +1,3 @@
+0.500000 = -1 = = 1.0
+0.500000
+ma
\ No newline at end of file
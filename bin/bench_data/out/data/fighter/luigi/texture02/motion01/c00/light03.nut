@@ -0,0 +1 @@
+9"?vzMB>״Rn]4RwǉU !ds?l6IBؿdb*Askۨ[|8cfuvFUG)gUQ`k
\ No newline at end of file
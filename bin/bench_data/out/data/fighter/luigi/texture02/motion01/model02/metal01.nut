@@ -0,0 +1,22 @@
+anim material
+texture
+anim vertex frame texture -1 -1 = 0.500000 material
+anim material
+1.0 vertex vertex
+-1 bone texture
+material
+1.0
+anim texture
+0.500000 frame
+-1 vertex
+texture texture texture
+frame
+=
+anim frame material texture 1.0 1.0
+1.0 = anim
+anim anim
+texture bone
+vertex
+1.0 bone
+vertex anim
+bo
\ No newline at end of file
@@ -0,0 +1,22 @@
+1.0 0.500000 material vertex 1.0 texture bone vertex frame material texture -1 0.500000 material
+bone
+vertex 0.500000 material
+bone anim 0.500000 anim
+1.0 = material texture
+0.500000
+frame
+= 1.0 bone
+= 1.0 0.500000 frame
+texture material
+frame
+0.500000 texture = 0.500000 texture 0.500000
+1.0
+vertex 0.500000 0.500000
+0.500000
+bone = 1.0
+-1
+1.0 1.0 anim vertex anim vertex bone = anim material 0.500000 frame -1
+1.0 anim anim texture vertex texture = vertex texture texture frame texture vertex 1.0 material
+anim
+material anim 1.0 bone 0.500000 -1
+1
\ No newline at end of file
@@ -0,0 +1,13 @@
+material frame material
+1.0
+frame -1 frame 1.0
+vertex 1.0 texture bone texture
+0.500000 = vertex = texture frame vertex
+-1 anim material
+-1
+1.0
+=
+texture = 0.500000 bone anim texture texture bone vertex =
+-1 vertex = = frame
+frame anim 1.0
+texture b
\ No newline at end of file
@@ -0,0 +1,4 @@
+material anim 1.0 anim bone material
+frame bone bone 1.0 anim
+frame 0.500000 1.0 frame
+bone vertex 1.0
\ No newline at end of file
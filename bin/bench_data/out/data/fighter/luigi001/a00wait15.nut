@@ -0,0 +1,4 @@
+vertex
+material
+bone 1.0
+anim 0.500000 verte
\ No newline at end of file
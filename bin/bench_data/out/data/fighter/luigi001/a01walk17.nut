@@ -0,0 +1,13 @@
+material frame -1 =
+= frame frame anim 1.0 vertex anim
+bone texture
+frame 0.500000
+anim vertex =
+1.0 =
+texture bone
+= 0.500000 0.500000 -1
+= 1.0
+0.500000 anim vertex texture = 0.500000
+1.0 bone
+frame = texture anim frame vertex
+bone 
\ No newline at end of file
@@ -0,0 +1,25 @@
+texture
+1.0
+anim
+texture -1
+-1 material -1
+0.500000 0.500000 = material -1 = frame anim
+texture 1.0 frame bone material bone frame
+vertex vertex bone material texture
+= = anim bone texture
+-1 = = = 1.0 0.500000 texture vertex -1 anim
+material
+vertex
+texture anim frame
+bone = bone 1.0 texture bone 1.0 0.500000 frame
+0.500000 = 0.500000
+material
+texture bone texture bone
+-1 0.500000 0.500000 -1 0.500000 -1 1.0 vertex -1 0.500000
+frame vertex -1 -1 0.500000 vertex
+texture 0.500000 material = frame
+bone -1
+vertex
+material bone
+1.0 1.0
+bone bone anim texture
\ No newline at end of file
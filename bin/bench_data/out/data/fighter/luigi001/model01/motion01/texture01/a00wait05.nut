@@ -0,0 +1,71 @@
+bone anim frame 0.500000 = 1.0 texture
+anim 0.500000 vertex vertex
+0.500000 bone material = anim 1.0
+anim frame texture
+1.0 =
+bone anim
+= material
+frame texture 0.500000 = 1.0 vertex
+0.500000 -1 bone texture
+=
+material texture material 0.500000 1.0
+frame
+texture bone
+material texture 0.500000 material anim frame anim texture vertex anim material bone
+=
+material frame 1.0 vertex 0.500000 0.500000 material -1 vertex frame 0.500000 1.0 = material frame material
+frame frame = -1 bone frame
+1.0 anim 0.500000 bone =
+=
+material material
+texture anim frame 1.0 frame 1.0 frame bone bone vertex = material texture 0.500000 vertex texture
+vertex
+bone -1 anim 1.0 0.500000 anim bone frame frame vertex
+texture 0.500000 -1 -1
+texture material anim vertex 0.500000 vertex texture
+anim texture
+anim frame anim bone 1.0
+anim = -1 1.0
+vertex vertex bone -1 vertex frame anim frame vertex 0.500000 bone = anim
+bone frame anim -1
+bone vertex
+1.0 bone 0.500000 0.500000 frame anim bone
+frame -1 anim material
+0.500000 material
+-1 = material 0.500000 0.500000
+-1
+-1 =
+bone 1.0
+bone anim
+1.0
+material anim material texture
+texture = = anim bone 1.0 bone texture
+frame 0.500000 texture bone bone frame frame material material 0.500000 1.0 0.500000 1.0 texture 0.500000
+0.500000
+=
+vertex vertex 1.0
+-1 1.0 frame frame material texture 1.0 frame 1.0
+0.500000 vertex 0.500000
+vertex 0.500000
+texture anim
+texture 0.500000 material bone texture = vertex -1
+vertex bone -1 -1 -1
+1.0
+material -1
+material bone bone
+0.500000
+anim 0.500000 frame texture
+-1 0.500000 frame texture
+texture frame 1.0 1.0 =
+bone
+material vertex 0.500000
+1.0
+texture frame 0.500000 0.500000 vertex
+texture
+0.500000 =
+material -1 0.500000 bone 0.500000 =
+= 1.0 bone 1.0 bone anim
+0.500000 0.500000 bone = anim bone = bone
+vertex bone -1 -1
+0.500000 frame -1 -1 bone anim material 0.500000 1.0 0.500000 frame anim bone
+-1 0.500000 anim bone
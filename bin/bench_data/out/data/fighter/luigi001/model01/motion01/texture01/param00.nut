@@ -0,0 +1,78 @@
+0.500000 1.0 -1 bone
+material
+= texture anim = 0.500000 texture = =
+texture anim
+1.0 0.500000 texture material frame =
+material 0.500000
+material
+frame
+bone vertex bone
+material 1.0 1.0 -1 material 1.0 material bone bone
+frame 0.500000 vertex bone bone frame
+-1 texture 0.500000 vertex frame
+1.0 = frame
+anim
+-1 anim 1.0
+1.0
+texture material bone texture frame -1 -1 frame material
+texture material -1
+anim
+bone bone anim vertex = material texture -1 -1 = 1.0 bone
+0.500000
+vertex
+frame 1.0 texture anim material texture texture vertex anim
+anim
+1.0 1.0
+anim -1 anim 0.500000 anim
+material material frame
+=
+-1 frame 0.500000 material 1.0 0.500000 = vertex 1.0 -1 0.500000
+anim 0.500000 anim
+bone
+bone bone vertex
+material anim
+texture material 1.0 =
+-1 frame material texture bone
+texture = -1 -1 frame -1
+anim texture
+material material 1.0 -1
+bone
+-1
+texture frame bone -1 bone frame 1.0
+bone
+-1 = -1 texture 1.0 = frame 1.0 material texture -1 anim material
+texture bone frame -1 anim -1 -1 = -1 frame
+bone
+anim bone bone anim
+anim
+0.500000 texture 1.0 texture
+anim
+material bone
+= bone frame 0.500000
+frame texture 0.500000
+anim material bone bone
+vertex material texture -1 0.500000 vertex frame 1.0
+1.0
+anim 1.0 -1 frame bone texture
+vertex
+material anim -1
+material bone
+texture 1.0
+0.500000 texture material
+anim vertex = 1.0 material = =
+0.500000
+texture material 1.0 frame -1 bone 1.0
+= texture bone vertex material vertex = bone frame bone
+0.500000 vertex anim 0.500000 anim = texture
+material 0.500000 1.0
+vertex
+texture material frame material frame
+frame anim
+= =
+vertex
+texture 0.500000 0.500000 bone 0.500000 1.0 texture 0.500000 vertex material
+-1 material -1 frame
+1.0
+0.500000 vertex = 1.0 bone texture = vertex vertex = = anim = 0.500000 material bone anim
+material 0.500000
+= 1.0
\ No newline at end of file
@@ -0,0 +1,3 @@
+material 1.0 anim
+-1 frame frame
+materia
\ No newline at end of file
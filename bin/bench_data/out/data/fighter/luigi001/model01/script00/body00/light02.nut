@@ -0,0 +1,5 @@
+frame 1.0 frame -1 frame texture frame = bone anim anim material
+vertex
+-1
+0.500000
+texture 1.0 ani
\ No newline at end of file
@@ -0,0 +1,10 @@
+= bone
+texture anim
+= -1 bone
+=
+frame
+= texture
+material
+texture 0.500000 0.500000
+anim anim
+-1 vertex 0.500000 material 0
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000
+1.0 -1 frame vertex bone vertex frame
+= texture 0.500000
+1.0 frame
+vertex vertex
\ No newline at end of file
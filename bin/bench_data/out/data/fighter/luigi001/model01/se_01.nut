@@ -0,0 +1,19 @@
+bone
+= 1.0 bone
+= frame 0.500000
+1.0
+bone
+frame frame vertex
+frame material
+vertex frame = anim bone texture bone
+1.0 vertex -1 anim
+bone material
+anim anim
+-1
+texture vertex =
+texture anim
+1.0 texture 1.0
+0.500000
+bone bone material texture
+anim
+vertex 1.0 vertex 0.500000 -1 vertex material -
\ No newline at end of file
@@ -0,0 +1,32 @@
+anim frame
+1.0 bone
+bone 1.0 0.500000 0.500000 = vertex 0.500000 = -1 = texture 1.0 frame bone 0.500000 texture frame vertex
+bone texture anim vertex 1.0 material
+frame frame = texture =
+1.0 1.0 -1 vertex = material material vertex texture
+frame bone
+texture 0.500000
+-1 material
+= =
+texture 0.500000
+= texture
+= vertex bone -1 = vertex frame
+0.500000
+frame -1 frame vertex = vertex
+1.0 frame
+frame material frame
+-1 0.500000 bone
+vertex anim anim vertex 1.0 1.0
+frame material 0.500000 -1 material = 0.500000
+texture
+=
+1.0
+bone 0.500000 1.0 bone vertex anim
+bone bone anim
+texture 0.500000 0.500000 vertex bone material
+material
+1.0 material vertex bone material = 0.500000 material 0.500000 texture
+frame 0.500000
+0.500000 -1 = material
+frame
+vertex = material bone a
\ No newline at end of file
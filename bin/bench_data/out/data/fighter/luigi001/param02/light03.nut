@@ -0,0 +1,6 @@
+material 0.500000 texture
+0.500000 bone
+-1 material = bone -1 vertex -1 vertex anim vertex bone texture material
+= material 0.500000 bone material
+material
+-1
@@ -0,0 +1,207 @@
+texture
+material
+1.0 0.500000 -1
+-1 frame anim 0.500000 anim bone
+anim
+-1 -1 -1 0.500000
+vertex
+-1
+1.0 1.0
+material 0.500000 frame
+1.0 -1
+material material
+-1
+bone bone
+-1
+material
+texture frame frame
+= bone material texture texture vertex -1 bone 0.500000
+bone = vertex bone vertex texture anim -1 material
+frame anim
+texture
+bone
+vertex -1 = anim texture material 1.0 texture
+material material
+1.0 anim texture frame frame = bone vertex texture 1.0 material anim texture -1 0.500000 vertex 1.0 texture =
+material -1 frame material
+-1 anim -1 bone
+texture 1.0 -1 vertex material texture material frame
+-1 material anim vertex material -1 0.500000 material vertex
+frame = 0.500000 anim bone
+anim anim 0.500000 texture bone 0.500000 0.500000 0.500000 frame
+-1
+= = -1 bone material 1.0 0.500000
+= texture
+-1 1.0
+vertex
+material -1 anim texture 0.500000 frame vertex -1 0.500000 vertex bone frame frame -1
+bone 0.500000
+vertex texture
+-1 vertex bone material bone 1.0 bone vertex anim bone
+= 0.500000 -1
+frame
+= vertex
+= bone frame bone
+1.0
+anim anim = material material bone
+1.0 -1 0.500000 frame
+anim 1.0 anim 1.0 anim =
+1.0 1.0 -1 -1 frame frame -1
+0.500000 vertex bone vertex 0.500000
+texture frame frame 1.0 bone bone -1 vertex bone
+vertex bone frame frame
+-1 -1 1.0 material vertex texture vertex 0.500000 1.0 frame bone 0.500000 -1 bone texture = anim = 1.0 bone vertex = frame
+=
+0.500000
+= = 1.0
+1.0
+anim frame texture texture frame 0.500000 vertex texture material vertex
+vertex
+frame
+texture
+0.500000 bone material
+0.500000 anim 1.0
+anim
+-1 bone -1 bone 0.500000 0.500000 = anim material anim
+texture
+-1 = =
+material anim
+frame = texture
+frame -1 vertex
+-1
+1.0 1.0 -1
+-1 anim bone anim
+= -1 -1
+0.500000 texture =
+0.500000 frame material
+= anim anim
+texture frame bone -1 material = = frame texture
+1.0
+vertex frame vertex
+0.500000
+texture = texture material material anim -1
+texture
+0.500000 bone
+1.0
+-1
+material
+vertex vertex anim
+frame anim
+vertex = -1 0.500000 material 0.500000 =
+material
+=
+1.0 vertex material
+frame -1 vertex material
+vertex vertex 1.0 material
+material frame anim -1
+bone = texture material material texture vertex
+frame -1 anim bone frame material
+anim frame
+bone
+0.500000 1.0
+0.500000 -1 1.0 texture
+vertex -1 = frame anim vertex vertex texture -1 1.0 material
+bone bone 0.500000
+0.500000 1.0 anim
+1.0
+0.500000 =
+1.0 texture anim =
+-1 frame
+frame 1.0
+-1 material 0.500000 bone anim
+material bone 1.0
+anim
+material
+anim
+0.500000 frame
+vertex bone bone 1.0 texture 0.500000
+anim material bone vertex 0.500000 frame
+frame vertex material 0.500000 vertex 1.0
+anim texture texture frame anim bone
+material
+frame frame anim texture =
+-1 frame = = 0.500000 material
+vertex anim material vertex texture
+frame frame anim 0.500000 texture 1.0 bone
+1.0 texture frame material = frame texture 0.500000 texture
+frame material material bone 0.500000 anim bone vertex bone texture material
+0.500000 material 0.500000 frame texture texture 1.0
+frame texture 0.500000 0.500000 texture material anim 1.0 =
+material
+= vertex vertex bone
+1.0
+bone
+anim bone vertex material = = bone
+anim
+1.0 0.500000
+= bone
+vertex frame 0.500000 material 0.500000 vertex
+material -1
+material 1.0 1.0
+vertex
+=
+frame texture 0.500000 bone 0.500000 anim anim
+= 0.500000
+bone vertex
+1.0 = 1.0 vertex
+material
+material vertex
+1.0 0.500000
+frame bone
+0.500000 -1
+vertex bone anim material texture -1
+= texture -1
+bone 0.500000 material
+texture texture
+frame
+frame
+bone
+frame -1 1.0 material 1.0
+frame 1.0
+anim = frame
+bone 1.0 frame frame
+-1 anim vertex -1 texture 1.0
+vertex 1.0 -1 =
+anim texture
+1.0 texture 1.0
+1.0 0.500000 vertex 1.0 material -1
+anim frame
+anim frame texture
+vertex
+0.500000 texture material -1 bone 1.0 0.500000 material -1 1.0 texture -1 = = 0.500000 vertex = texture vertex -1 vertex bone bone vertex
+0.500000 anim
+1.0 material texture -1
+-1
+= frame
+=
+frame frame 1.0 frame texture 1.0 0.500000 -1 = texture texture 1.0 vertex 0.500000
+anim = 1.0 -1 vertex
+frame -1 -1 = vertex texture frame 1.0 0.500000 -1
+vertex texture
+texture
+material frame -1 texture bone bone vertex 0.500000
+material
+material bone = texture frame anim vertex anim
+texture frame vertex
+-1 texture material 0.500000 texture =
+material
+bone texture material -1 -1 = material -1
+0.500000 frame = 0.500000 -1
+bone anim
+= vertex anim 0.500000 = texture 0.500000 material vertex anim
+vertex
+frame
+texture frame frame vertex vertex material -1 1.0 1.0 -1 vertex
+=
+material
+bone = -1
+bone
+-1 material 0.500000
+= =
+-1
+vertex
+= frame texture material 1.0 texture
+material vertex
+bone
+-1 vertex vertex bone 0.500000 -1 vertex texture
+material 
\ No newline at end of file
@@ -0,0 +1,4 @@
+bone 1.0
+1.0 vertex anim
+material
+material
\ No newline at end of file
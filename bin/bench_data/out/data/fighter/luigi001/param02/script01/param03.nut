@@ -0,0 +1,369 @@
+0.500000 texture 0.500000
+bone
+texture frame
+bone bone
+bone
+bone vertex bone
+vertex material 1.0 anim
+1.0 -1 vertex
+anim
+material 0.500000 vertex
+bone texture
+vertex = frame
+material anim
+0.500000 material vertex 0.500000 vertex texture vertex texture bone 0.500000 texture
+frame texture
+= texture
+material -1 texture frame 0.500000 material frame material
+0.500000 frame vertex -1 material anim = frame
+bone 1.0 = anim -1 vertex
+anim = bone -1
+anim
+-1
+= texture
+frame
+= bone
+= bone
+material =
+1.0 anim 0.500000 texture
+bone frame bone texture -1 1.0 vertex bone bone texture 1.0 anim bone = -1
+bone material
+material
+texture = material 1.0
+vertex 0.500000 vertex -1 vertex bone
+-1 texture anim texture 0.500000
+frame anim frame material
+texture
+-1 material -1 frame bone texture texture
+frame
+vertex vertex bone 0.500000 -1 -1 0.500000 =
+bone frame
+bone
+vertex vertex = material anim -1 frame -1 vertex 0.500000 -1 vertex = frame 0.500000 -1 texture
+bone -1 frame -1 0.500000 vertex texture 1.0
+frame -1 bone
+frame = material
+frame = 1.0 material
+material
+texture texture -1 -1 frame
+material 0.500000 bone
+bone -1 1.0
+bone = 0.500000 texture anim 1.0
+texture anim
+vertex frame frame frame frame
+texture
+bone material frame texture
+texture
+material bone bone
+0.500000 -1 texture anim
+0.500000 = texture
+material texture 1.0 anim
+0.500000
+bone =
+0.500000
+anim 1.0
+= anim
+= 1.0 material frame vertex = vertex -1
+frame
+vertex anim
+bone 1.0 anim
+vertex material 1.0 bone
+anim bone -1 vertex bone frame
+material material 1.0 = anim 0.500000
+1.0 frame =
+= -1 texture material
+frame -1 bone frame anim
+material = vertex
+anim -1 = 1.0
+frame vertex -1 material texture
+=
+anim 1.0 bone texture = -1 0.500000 1.0
+frame
+0.500000 frame
+bone 1.0
+1.0 = bone texture 0.500000 vertex bone = vertex -1 material
+bone
+= -1 -1
+bone
+texture bone material material -1 frame vertex 0.500000 -1
+1.0 =
+vertex
+anim material
+texture = = bone vertex
+-1 bone
+-1 -1 -1 1.0 = vertex 0.500000 = = -1 vertex
+frame frame =
+anim material bone
+0.500000 texture anim
+vertex 1.0 0.500000 = -1 anim material
+anim bone 0.500000 -1
+-1
+material vertex = texture anim 1.0
+material material vertex -1 1.0 anim anim
+-1 0.500000 texture = vertex
+1.0
+bone texture bone 1.0 -1 0.500000 =
+-1 vertex bone
+bone anim material = texture vertex -1 frame vertex bone frame 1.0 vertex = = -1 -1 -1 bone bone anim = frame bone bone
+=
+material 1.0
+anim frame
+= texture =
+bone vertex texture frame material bone frame 0.500000 anim frame
+= texture vertex vertex
+texture 1.0 -1 -1 anim 0.500000 frame
+bone 0.500000
+bone 0.500000
+material 1.0 frame vertex vertex
+vertex frame = vertex
+= anim
+-1 = -1 1.0
+0.500000 0.500000 texture = material
+=
+material
+texture texture = frame
+-1
+bone 1.0
+frame texture
+-1 vertex -1 vertex bone
+0.500000 0.500000 material frame texture material anim -1 -1
+bone 1.0
+= texture
+0.500000
+texture frame frame 1.0 bone vertex vertex vertex bone 0.500000 0.500000 vertex anim -1
+= 0.500000
+bone bone texture
+vertex 0.500000
+frame
+frame frame frame 0.500000
+vertex texture 1.0 =
+texture 0.500000 0.500000 frame 1.0 material = 1.0
+anim -1 -1
+bone = -1 texture 0.500000 anim
+anim frame -1
+texture frame
+texture frame = -1 material -1 -1 0.500000
+vertex bone vertex vertex
+anim 0.500000 vertex
+-1 texture material 0.500000
+frame frame
+1.0 1.0 = material anim anim texture 0.500000
+bone material frame texture frame frame
+anim texture texture
+anim
+anim material 0.500000 -1 vertex
+texture
+0.500000
+vertex
+vertex =
+-1 vertex
+= -1 1.0
+anim bone anim 1.0 -1
+1.0 -1
+vertex 0.500000 =
+-1 bone material
+-1 = bone bone bone
+frame
+-1
+= anim bone anim bone
+1.0 1.0 material frame texture vertex
+anim material
+material texture = 0.500000 texture 0.500000
+texture 0.500000 texture
+1.0 = texture material bone
+frame texture -1
+1.0 0.500000 frame anim bone
+= frame anim texture 1.0 bone frame
+0.500000 material texture
+-1 = frame material 0.500000 -1 vertex -1 = vertex
+bone texture -1 material
+material =
+texture material
+anim
+anim
+0.500000 vertex frame material
+vertex
+1.0 material
+-1 bone vertex 0.500000 material vertex
+-1
+anim -1 material texture frame -1 vertex 0.500000 frame anim -1 anim bone -1
+anim 0.500000 vertex bone
+1.0 0.500000 material
+1.0 anim 1.0 frame
+texture -1 material texture anim vertex texture bone
+0.500000 anim vertex
+1.0 -1 -1 frame material =
+anim frame
+frame
+bone
+= material 0.500000 =
+vertex vertex
+= material frame = frame -1 1.0 1.0
+-1
+vertex -1
+0.500000
+material
+= frame = texture = anim bone
+material = -1
+1.0 -1
+frame vertex = vertex
+0.500000 material bone 0.500000 material 1.0 1.0 vertex 0.500000
+texture vertex frame anim material
+material vertex material anim 0.500000 frame = bone frame
+anim vertex -1 texture 0.500000 material anim = material 1.0 texture -1
+-1 = -1 frame vertex
+1.0
+-1 1.0 -1 anim
+material bone
+1.0 texture material
+0.500000
+bone frame frame = 0.500000 texture
+texture
+= vertex
+1.0
+frame 1.0 0.500000
+-1 1.0 0.500000 anim 0.500000 anim -1 anim
+1.0 texture anim frame texture
+1.0
+material = -1 material -1
+1.0 -1 -1 1.0 texture 0.500000 texture
+bone
+1.0 -1
+0.500000
+texture material frame material 0.500000 vertex material -1 frame bone -1 1.0
+1.0
+= material 1.0 material vertex
+=
+anim material
+vertex 1.0
+= texture material -1 texture
+anim 0.500000 = = frame -1 1.0 bone
+0.500000 vertex texture vertex bone = = 1.0 material anim 0.500000 1.0
+= 0.500000 frame 1.0 bone =
+bone = texture frame -1 vertex
+anim 0.500000
+-1 -1 material frame
+= = anim texture 1.0 vertex
+bone 0.500000
+bone
+material frame bone
+1.0
+vertex material
+frame -1 texture material
+1.0 texture anim material
+vertex
+material bone -1
+material
+frame frame -1 anim
+-1 0.500000 frame anim
+-1 anim texture -1 material vertex 0.500000 bone -1
+1.0
+material 1.0
+1.0 -1 -1 -1 = = -1 -1
+texture texture material material frame
+0.500000 material 0.500000 frame frame
+texture texture 0.500000 1.0 -1
+material
+-1 vertex
+vertex material 1.0
+frame frame = anim
+anim anim
+0.500000
+bone anim 1.0 -1
+frame 1.0 = anim -1
+frame frame 0.500000
+vertex
+frame texture anim material 1.0 anim 1.0 anim texture 1.0 0.500000 0.500000 frame material anim anim bone -1 vertex 0.500000 = texture
+-1 -1
+vertex
+bone -1 frame -1
+0.500000 0.500000
+anim 1.0 -1
+= vertex vertex =
+0.500000 frame 0.500000 frame
+material bone 0.500000 -1 bone 0.500000 anim 1.0 0.500000 -1 bone anim material -1 frame
+texture 0.500000 texture
+-1
+anim 1.0 texture 0.500000 =
+1.0 bone bone frame -1 frame anim =
+1.0 anim frame 0.500000 = 1.0 texture
+texture
+bone
+frame texture texture =
+vertex 0.500000
+bone -1
+anim
+material vertex
+0.500000
+0.500000
+0.500000 vertex bone
+1.0
+frame anim texture anim vertex 1.0 texture 1.0 anim texture 0.500000
+bone
+vertex texture material vertex 1.0 0.500000
+bone
+frame bone frame -1 = = anim
+0.500000 vertex 0.500000 -1
+vertex vertex 0.500000 material -1
+0.500000 texture 1.0 texture texture
+vertex vertex material anim
+material vertex texture 0.500000 1.0 bone -1
+bone
+1.0 frame
+frame material -1 texture bone
+texture texture material -1 bone 0.500000 -1
+material 1.0
+-1 frame
+bone
+0.500000 1.0 material -1
+0.500000 frame anim
+frame vertex 1.0 vertex 1.0 vertex -1 1.0 1.0
+-1 1.0 vertex
+0.500000 0.500000
+bone material frame
+=
+1.0 1.0 frame
+0.500000 material anim vertex
+vertex
+1.0 bone
+-1 0.500000 0.500000 material
+0.500000 0.500000 texture -1 anim vertex =
+frame
+vertex -1 vertex =
+bone 0.500000 texture bone
+bone texture texture
+bone = anim material 0.500000 bone
+vertex
+-1
+=
+anim frame material frame anim =
+bone 0.500000
+texture anim -1 vertex
+0.500000 texture 1.0 = material anim material
+anim
+bone anim vertex
+texture bone bone
+vertex 0.500000
+material
+texture
+-1 material texture 0.500000 1.0
+1.0 anim 0.500000 vertex
+vertex 1.0 frame = 1.0
+0.500000
+=
+-1 texture
+frame
+texture 1.0 anim vertex frame
+material
+= texture vertex texture
+vertex
+0.500000 1.0 bone material =
+frame texture -1
+1.0 =
+0.500000 -1 1.0 vertex
+= vertex frame material bone vertex anim
+bone 0.500000 texture anim vertex = frame frame = material 1.0
+0.500000 bone = anim frame
+1.0 vertex = 0.500000 -1 texture 1.0
+material texture 0.500000 vertex 1.0
+-1 = 1.0 anim 1.0 texture textu
\ No newline at end of file
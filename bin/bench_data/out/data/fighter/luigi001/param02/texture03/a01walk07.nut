@@ -0,0 +1,5 @@
+texture
+0.500000 0.500000
+vertex bone
+vertex bone
+anim 0.50
\ No newline at end of file
@@ -0,0 +1,34 @@
+0.500000
+material vertex
+= anim texture bone
+0.500000 0.500000 texture 1.0 bone 1.0
+anim vertex texture bone 1.0 vertex material vertex
+frame anim
+anim
+material
+anim 1.0
+anim 1.0 material vertex
+texture
+0.500000 vertex frame -1 =
+anim
+1.0 1.0 frame vertex anim material
+= -1 frame
+anim material texture
+0.500000 vertex
+1.0
+0.500000 = 0.500000 -1 -1 0.500000 texture bone
+anim -1 material 1.0 -1 anim frame anim texture anim texture texture
+bone -1 material vertex anim material frame anim frame texture -1 anim 0.500000 bone anim 1.0 0.500000 texture 1.0 bone = 0.500000 -1 anim texture 1.0
+=
+= =
+0.500000 texture
+texture frame texture
+1.0 anim
+vertex vertex frame 1.0
+anim vertex 1.0 material frame material texture vertex bone 0.500000 anim
+material 1.0 material vertex 1.0 -1 vertex
+1.0
+=
+vertex anim frame material -1
+texture
+frame textur
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000
+frame vertex anim anim bone
+texture anim
+vertex material anim vertex vertex
\ No newline at end of file
@@ -0,0 +1,2 @@
+kjaf,b{
+$km"qA^
\ No newline at end of file
@@ -0,0 +1,204 @@
+anim
+frame material =
+frame
+anim 1.0 = bone bone
+1.0
+frame -1 frame anim
+material = vertex 0.500000 -1 anim
+texture
+= anim 1.0 -1 1.0 frame
+vertex vertex 0.500000
+frame bone = = vertex
+texture
+=
+bone bone anim vertex bone anim bone texture
+frame bone frame 0.500000 bone -1
+anim -1 -1
+bone vertex
+frame frame texture
+frame -1 material
+1.0
+0.500000 = bone vertex 0.500000 material vertex
+1.0
+0.500000 bone material vertex
+material -1
+1.0 anim -1 bone 0.500000
+= 1.0 vertex 1.0 frame bone
+texture
+=
+=
+material vertex 1.0 frame frame = 1.0 frame 0.500000 bone
+frame frame
+1.0 vertex frame vertex anim
+material material material 1.0 bone
+material material =
+texture = frame anim bone -1 anim -1 vertex material -1
+0.500000 bone texture anim -1 1.0 vertex anim anim 0.500000 material material anim
+bone
+0.500000 0.500000 0.500000 -1 material vertex anim 0.500000
+material frame texture 1.0 vertex 0.500000 material 0.500000 -1 1.0
+=
+= = 0.500000
+texture anim
+bone bone -1 vertex bone = material vertex 0.500000 = = texture
+= 1.0 -1 texture
+= =
+bone texture
+-1 1.0 frame vertex texture material anim = frame bone frame texture
+frame material anim =
+= frame material -1 frame texture vertex
+frame -1
+= frame 1.0 = = texture vertex 1.0
+bone
+bone -1 0.500000 = -1 0.500000 1.0 texture bone = = =
+texture 0.500000 anim texture
+vertex 0.500000 vertex bone anim = material = 1.0
+texture -1 = vertex -1 0.500000
+anim -1 bone 1.0
+= frame
+= 0.500000 bone texture anim 1.0 = = 0.500000 frame = frame material
+= texture
+vertex frame bone bone
+texture bone
+1.0
+vertex bone vertex
+anim -1 vertex frame anim
+=
+0.500000 0.500000 -1 vertex frame 1.0 0.500000 anim
+texture vertex
+vertex -1 0.500000
+-1 1.0 material anim vertex
+anim -1
+anim -1 -1 -1
+-1
+-1
+frame anim
+1.0 = -1 anim material material frame material material anim
+0.500000 vertex
+= bone -1 texture
+material -1 vertex 0.500000 -1 anim
+texture frame 1.0 material -1 material texture 1.0 1.0
+bone bone
+1.0 0.500000 vertex texture -1
+=
+bone frame frame material
+= = bone vertex -1 1.0
+frame material texture -1 bone = 1.0
+= material
+1.0
+1.0
+1.0 0.500000
+1.0
+0.500000 1.0
+= anim = frame
+frame frame bone 0.500000 -1 frame
+anim vertex 0.500000 frame 1.0 texture anim 1.0
+material
+anim
+texture 1.0
+-1 -1
+0.500000 -1 anim anim
+frame bone texture -1 frame vertex = material 1.0 material
+bone -1 1.0 1.0 0.500000 0.500000 bone anim -1 anim vertex vertex bone anim texture bone vertex material
+1.0 material
+-1 1.0 anim
+material material =
+= -1 anim bone
+frame 0.500000 = = =
+material bone
+material -1 =
+-1 = frame
+texture
+1.0
+bone anim
+texture = material
+material 1.0
+anim 0.500000 0.500000
+1.0 bone bone vertex texture vertex material frame 0.500000 -1 vertex material = texture frame
+=
+bone vertex 1.0 1.0 -1 material
+1.0 texture 1.0 1.0 anim 1.0
+vertex 1.0
+frame
+-1 0.500000 bone 1.0 vertex anim material 0.500000
+1.0 material material bone vertex vertex 1.0 = bone texture vertex vertex
+vertex
+texture -1 anim -1 texture vertex bone material texture vertex 1.0
+anim frame vertex 0.500000 -1 texture frame 0.500000 -1
+bone texture frame
+vertex texture
+-1 -1
+texture
+bone material bone texture
+bone texture -1 -1 = anim 0.500000 1.0 = frame
+1.0 0.500000 1.0 -1
+material frame frame anim vertex 1.0
+material = 0.500000
+-1
+1.0
+-1 frame
+material -1 0.500000 1.0
+texture vertex
+anim -1 texture = = anim = texture material vertex = anim frame material
+anim 1.0 bone 0.500000
+bone texture frame anim
+= texture 0.500000 frame
+0.500000 anim 0.500000 vertex anim vertex material
+1.0 material anim 1.0 -1 material 1.0
+texture 1.0 vertex bone material = material material
+1.0
+bone -1 =
+material 0.500000 1.0 -1 texture bone material
+0.500000
+texture texture anim = -1 texture 0.500000
+material -1 anim vertex bone 0.500000 frame -1
+anim vertex bone bone 0.500000 1.0 frame frame texture
+frame vertex
+bone -1
+frame bone -1 1.0
+anim
+-1 texture
+anim anim 1.0 1.0 -1 -1 = frame 0.500000 bone bone vertex texture vertex 0.500000 vertex
+= material
+bone bone
+texture vertex
+0.500000
+= -1
+frame 0.500000 bone
+material
+vertex frame 1.0 frame -1
+bone
+material texture frame texture 0.500000
+vertex frame frame
+bone
+bone -1 bone
+anim
+bone -1
+bone
+0.500000 texture
+1.0 vertex texture frame frame bone
+-1 bone
+-1 anim
+texture =
+vertex texture -1
+bone
+= frame material vertex -1
+= anim -1 texture
+anim = frame
+vertex bone -1
+0.500000
+1.0
+0.500000
+bone
+1.0 texture texture
+texture
+bone 0.500000 frame texture
+bone bone
+texture frame
+anim bone -1 bone
+anim
+frame
+texture 0.500000 -1
+1.0
+0.500000
+0.500000 material anim bon
\ No newline at end of file
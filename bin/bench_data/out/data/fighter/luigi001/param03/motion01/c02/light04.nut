@@ -0,0 +1,124 @@
+1.0 vertex vertex = vertex
+-1 -1 = texture frame bone
+anim material = 0.500000 anim frame
+material
+material
+material frame frame
+0.500000 = = vertex vertex bone material
+frame vertex 1.0 = material frame anim
+material -1 texture 1.0 vertex anim bone material vertex
+0.500000 anim frame
+anim material
+frame material = bone
+material -1 frame material =
+anim = bone
+anim anim -1 frame 1.0 =
+-1 material material vertex texture = material 0.500000 material 1.0 = bone texture -1 material
+-1 bone anim anim -1 texture
+vertex = frame 0.500000 1.0
+-1 frame texture
+1.0 -1 -1 -1
+anim vertex -1 anim bone
+0.500000
+0.500000 = vertex
+material frame texture texture frame = -1 bone -1 0.500000
+= bone =
+frame frame bone 1.0 anim -1 1.0 frame frame anim 0.500000 frame 0.500000
+frame bone 0.500000
+0.500000
+= -1 0.500000
+anim material 0.500000 anim bone material
+-1 1.0 frame 0.500000 bone material texture
+bone 1.0
+frame
+texture bone texture
+= 0.500000 frame -1 vertex
+vertex frame 1.0 -1
+frame material 1.0 frame material frame material = texture
+0.500000 1.0 0.500000 texture =
+-1 material anim -1 0.500000 bone
+frame anim anim
+=
+material anim =
+anim
+anim 0.500000
+= -1 bone
+-1 material texture material texture
+anim = 0.500000 = -1 frame frame frame
+frame 0.500000 -1 0.500000
+anim texture
+-1 texture vertex
+material frame vertex material = 0.500000
+frame
+frame material texture 0.500000 = material
+-1
+texture material texture anim bone bone material
+1.0 0.500000 material bone 0.500000
+material bone vertex material anim
+1.0 texture texture frame = anim
+anim anim
+bone vertex material vertex vertex
+-1 material
+-1 -1 0.500000 texture texture
+0.500000 vertex anim frame
+bone bone = vertex
+material
+vertex bone 1.0 -1 0.500000 -1 texture texture material
+material
+bone texture = anim 1.0 frame = material material anim 0.500000 1.0 frame anim texture
+1.0 frame material vertex
+-1 material 0.500000 vertex 0.500000 1.0
+frame material vertex = bone vertex vertex 0.500000
+0.500000 =
+0.500000
+bone = anim
+-1 anim frame anim texture texture texture
+texture frame 0.500000 texture
+-1
+frame material bone
+frame frame frame
+0.500000
+0.500000 = texture bone frame -1 anim material material = -1 1.0
+frame
+= texture anim
+1.0
+0.500000 vertex vertex 0.500000
+vertex bone frame
+0.500000
+texture -1 frame
+vertex bone texture = frame bone 0.500000
+bone
+material 0.500000 vertex = bone = =
+vertex = 1.0
+-1 vertex
+-1 -1 bone
+frame bone -1 bone
+texture -1 anim =
+0.500000 1.0 -1 -1 = bone -1 =
+anim 0.500000 -1 frame = -1 vertex -1 0.500000
+vertex 1.0 anim
+frame -1 anim material
+frame texture vertex material -1 0.500000 bone bone frame
+texture -1 1.0 frame -1 material 0.500000 material -1 -1
+0.500000 material -1
+0.500000
+=
+anim
+anim
+1.0 frame material vertex vertex 0.500000 vertex
+frame 1.0 0.500000
+1.0 texture -1
+material anim vertex
+bone vertex =
+texture texture
+anim = = frame anim texture vertex 0.500000
+bone -1 -1
+0.500000 vertex
+bone 0.500000 1.0
+vertex texture frame bone 0.500000
+= 0.500000 anim 1.0 =
+0.500000
+-1 anim material frame
+-1
+-1 = texture bone material texture
+= = = vertex bone frame bone vert
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 material 1.0 0.500000 1.0 = bone 1.0 frame bone
+texture materia
\ No newline at end of file
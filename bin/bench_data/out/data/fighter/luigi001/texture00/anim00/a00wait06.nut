@@ -0,0 +1,5 @@
+frame
+-1
+vertex
+texture frame frame bone bone frame
+fr
\ No newline at end of file
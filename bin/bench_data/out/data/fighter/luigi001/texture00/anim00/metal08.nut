@@ -0,0 +1,22 @@
+= material
+texture texture 1.0
+frame 1.0 frame
+material vertex -1 material =
+material 0.500000 -1 bone vertex
+vertex 1.0 = texture material
+material
+= bone
+texture
+anim texture
+vertex vertex -1 0.500000 = anim anim vertex anim 0.500000 anim material -1 -1
+bone
+anim 1.0 0.500000 = 0.500000
+vertex texture
+= -1
+bone
+frame texture frame material frame anim anim 0.500000
+anim
+=
+= vertex texture anim 0.500000 -1 texture
+= material frame frame -1 bone 1.0 bone -1 texture = -1 0.500000
+-1 = anim -1 vertex 1.0 material 0.500000 frame 0.
\ No newline at end of file
@@ -0,0 +1,17 @@
+1.0 bone anim material
+-1
+material -1 bone vertex
+-1 anim frame -1
+-1 bone frame 1.0 bone material bone 0.500000 texture 0.500000 1.0
+bone 0.500000 material bone 0.500000
+1.0 texture
+material -1
+= anim
+= anim anim material -1 = = -1 1.0
+material vertex
+bone 1.0 = frame frame anim 1.0 anim -1 -1 frame
+0.500000 frame 0.500000
+-1
+1.0 frame 1.0 vertex frame
+material material bone = vertex frame 0.500000 material
+frame
\ No newline at end of file
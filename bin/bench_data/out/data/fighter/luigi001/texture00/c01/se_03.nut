@@ -0,0 +1,6 @@
+material
+material
+bone anim frame
+-1
+frame
+anim -1 material =
\ No newline at end of file
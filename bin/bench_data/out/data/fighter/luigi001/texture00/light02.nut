@@ -0,0 +1,3 @@
+frame material texture = = frame -1 1.0 material -1 material frame
+=
+b
\ No newline at end of file
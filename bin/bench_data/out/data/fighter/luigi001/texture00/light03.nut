@@ -0,0 +1,123 @@
+1.0 1.0
+material anim vertex 1.0
+0.500000
+texture = -1
+material anim
+0.500000 anim
+anim frame -1 bone anim = anim
+bone =
+vertex -1
+anim texture
+frame bone 1.0 frame bone 1.0 bone 0.500000
+frame
+vertex 1.0
+1.0 vertex
+material
+material anim
+1.0 1.0 anim -1
+1.0 frame frame vertex
+material
+-1 -1
+=
+texture frame = frame material texture frame material vertex
+material frame texture
+frame anim
+vertex frame texture = frame
+= = anim frame = 0.500000 0.500000
+material material 0.500000 -1
+1.0 anim
+material texture -1
+bone
+=
+material =
+= bone 1.0 anim material
+= vertex 1.0 anim bone
+texture = frame
+anim 1.0 bone
+material material frame material 0.500000 1.0 1.0 1.0
+1.0 -1
+anim bone texture material bone anim vertex material 1.0
+bone bone 0.500000
+-1 bone anim
+material
+frame
+frame
+1.0 -1 material frame 0.500000 -1 material =
+0.500000 0.500000 texture
+vertex
+vertex
+bone vertex
+=
+texture vertex vertex
+material bone 1.0
+anim 0.500000 0.500000 vertex = 1.0
+texture anim material bone texture =
+vertex
+=
+1.0
+= 0.500000 = 1.0 -1
+=
+0.500000 material material material texture material frame
+frame = 1.0
+1.0 bone = 1.0
+texture 0.500000 material frame =
+frame 0.500000 vertex bone
+1.0 1.0 frame frame = -1 1.0
+= 0.500000 vertex 0.500000 texture
+-1 material
+bone
+bone
+texture texture = frame 1.0 texture
+anim
+-1
+anim anim anim 1.0 -1 frame
+frame
+frame
+0.500000
+=
+texture = bone 0.500000
+anim bone =
+0.500000 0.500000 anim bone
+1.0 frame 0.500000 frame frame = = material material 0.500000 = frame = = =
+anim
+texture
+0.500000
+bone frame bone frame material anim 1.0
+bone texture = bone
+1.0
+texture bone bone texture vertex
+material -1 texture
+texture texture bone material vertex
+texture =
+anim 1.0 material -1 material -1
+vertex material 1.0 texture = vertex texture material material frame vertex -1
+bone texture anim frame 1.0 anim material bone
+1.0 0.500000 material
+0.500000
+-1 -1 -1 1.0
+material material -1 0.500000 1.0 bone -1 = -1 texture =
+0.500000 anim frame texture
+1.0
+frame -1 anim vertex 1.0 1.0
+frame
+1.0
+anim bone
+frame
+bone
+anim
+material material
+bone material vertex
+0.500000 texture anim vertex -1 texture
+anim = =
+texture 0.500000 bone -1 = = vertex anim bone = anim 0.500000 -1 1.0 texture bone texture anim material bone -1
+vertex anim anim 0.500000 0.500000 vertex material = -1 1.0 bone material
+frame 0.500000
+vertex anim =
+anim material anim anim vertex frame
+0.500000 anim = 1.0 vertex frame 1.0 anim texture -1 material = 1.0 1.0 = = material
+texture
+1.0 1.0
+texture 1.0 = bone bone texture anim
+1.0 bone anim -1
+anim 1.0 texture anim bone bone -1 frame frame texture material -1 -1 anim
+texture = 1.0 1.
\ No newline at end of file
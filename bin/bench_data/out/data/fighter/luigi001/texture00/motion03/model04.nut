@@ -0,0 +1,158 @@
+material
+material
+bone =
+=
+vertex texture vertex
+-1 texture
+=
+frame
+0.500000 -1 anim
+1.0 -1 -1 = -1 frame
+1.0
+=
+material
+frame
+anim anim bone vertex vertex = bone material
+texture material frame -1 = vertex 0.500000 anim anim anim anim
+0.500000 vertex
+frame
+=
+=
+0.500000 1.0 material frame bone 1.0 vertex
+1.0 = 0.500000 = texture -1 material vertex material
+texture -1
+anim -1
+-1 vertex = texture bone
+0.500000 = 1.0
+anim -1
+anim vertex texture =
+frame
+vertex material bone
+material
+0.500000 texture anim = vertex
+bone
+bone
+vertex bone
+bone frame bone anim texture = -1 0.500000 0.500000 0.500000 0.500000 0.500000 frame
+bone -1 frame = vertex
+-1
+frame 0.500000 material frame anim 1.0
+1.0 -1 texture material -1 material texture
+= texture
+bone bone vertex
+texture
+anim
+material -1 0.500000 texture frame bone -1 1.0 anim texture
+material
+1.0
+anim texture frame anim bone anim texture
+texture frame anim texture
+0.500000
+1.0 1.0 vertex texture bone = vertex texture = -1 1.0
+-1 1.0 bone 1.0
+-1 anim frame
+texture material
+material frame texture anim vertex 0.500000 anim = texture bone frame
+bone anim frame bone
+material = material frame =
+bone =
+texture 1.0 material frame frame vertex -1 0.500000
+bone = anim 0.500000 material
+= vertex 0.500000 vertex vertex = 1.0 0.500000 0.500000 texture = frame
+texture texture 1.0
+texture -1
+bone
+0.500000 = anim anim frame
+texture texture =
+= frame texture
+material texture bone bone vertex
+vertex 0.500000 material = = 1.0 frame 1.0
+bone
+bone vertex
+anim 0.500000
+-1 material frame bone anim bone texture anim
+bone material = material texture texture vertex frame 1.0 anim material material -1 0.500000 -1 bone
+-1 anim material
+-1
+-1 vertex 1.0 0.500000 1.0 anim 1.0 texture 1.0 anim
+anim anim material
+material texture 1.0 frame vertex vertex 0.500000 bone material 0.500000 bone -1 vertex anim
+1.0 1.0 texture bone material bone frame anim -1 1.0 texture 0.500000 vertex -1 vertex vertex = vertex texture material
+anim 0.500000 1.0
+1.0 frame frame vertex material vertex
+frame anim =
+texture
+anim vertex anim
+= material -1 frame
+material -1
+texture anim bone anim vertex
+material texture texture 0.500000 1.0
+bone texture -1 = 0.500000 texture vertex
+vertex = -1
+0.500000 1.0 1.0 bone -1
+= texture texture 0.500000 material texture
+-1 0.500000
+0.500000 anim 1.0 0.500000 anim 0.500000 0.500000 -1 = texture = vertex = =
+-1 = bone vertex -1 1.0 = texture 0.500000 material material anim
+0.500000
+texture 0.500000 bone texture texture bone 1.0 1.0 0.500000 material -1 bone
+frame 1.0 anim 1.0
+1.0 -1 material material = material
+= frame material frame anim
+anim
+frame
+material texture frame vertex
+vertex vertex texture texture
+vertex bone frame
+0.500000
+=
+frame material texture
+= -1 = frame vertex frame material
+bone anim
+frame anim frame 0.500000
+bone vertex vertex 1.0 texture = texture 1.0 0.500000 -1
+vertex
+texture anim bone anim -1
+anim material
+anim bone = frame 0.500000 anim
+1.0 bone = texture = frame
+0.500000 texture bone material vertex
+=
+material -1
+texture material
+frame bone
+bone
+1.0 bone 1.0 anim frame -1
+-1 1.0 = anim
+texture texture vertex vertex
+-1 0.500000 bone texture anim material material
+= frame material material bone material -1 frame material 1.0 anim texture -1 =
+0.500000 1.0 =
+anim = = frame 1.0 bone vertex 0.500000 frame texture vertex texture texture
+1.0 bone = frame material
+anim frame anim
+texture 1.0 1.0 -1 = texture -1 vertex frame bone material 0.500000 bone bone frame
+texture texture
+-1
+-1
+texture bone =
+texture 0.500000
+1.0 texture bone material -1 -1
+-1 frame = frame -1 texture frame vertex
+material -1 bone material
+texture 0.500000 frame -1 = 0.500000 frame 0.500000 -1
+frame -1 0.500000 anim frame -1 vertex 1.0 material 1.0 anim -1 bone texture
+material material frame 0.500000 1.0
+1.0 texture frame 0.500000 frame frame = bone bone vertex
+anim bone
+material = frame
+bone = vertex 0.500000 material
+frame anim 0.500000 0.500000 frame
+-1
+texture vertex = -1
+-1 vertex anim anim anim
+frame texture vertex anim frame =
+-1 = bone texture -1
+frame
+anim
+material 1.0 vertex 0.500000 frame bone 0.500000 bone anim material ma
\ No newline at end of file
@@ -0,0 +1 @@
+ғFiM9Zi\^s4Nywgf8efsMAx1*PWG=G1}x.z&wjmzXCvcpڬ|"514n-@_EK:D<Xqe,ޖGC0aIչ>EA΂mmw{kG^:9[Eme&5|㮈d%F(e3L?k V
\ No newline at end of file
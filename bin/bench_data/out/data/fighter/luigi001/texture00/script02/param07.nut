@@ -0,0 +1,7 @@
+material 1.0
+vertex
+-1 0.500000 0.500000
+= texture vertex 1.0 texture frame anim vertex
+anim frame vertex 1.0 texture 0.500000 texture material
+= vertex bone material material -1 anim 0.500000 material
+texture frame anim frame material
\ No newline at end of file
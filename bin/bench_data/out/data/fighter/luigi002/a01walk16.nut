@@ -0,0 +1,3 @@
+= texture
+=
+material material texture 0.50000
\ No newline at end of file
@@ -0,0 +1,9 @@
+bone frame bone material 1.0 material -1 texture
+vertex frame
+material bone 0.500000 material bone 0.500000 1.0 frame vertex 0.500000 -1
+bone vertex
+texture 0.500000 texture = anim material =
+anim frame bone anim =
+anim
+-1
+frame 
\ No newline at end of file
@@ -0,0 +1,2 @@
+FA9WCPԺ5$"x{p~
+~Y)C&E1hiRg	'D|];5yH(Gfs܏bJO?}u.Fs{v1Y؜vI䠛isE$+z8g󓺐tdڳ
\ No newline at end of file
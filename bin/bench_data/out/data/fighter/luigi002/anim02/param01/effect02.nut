@@ -0,0 +1,3 @@
+material
+anim = vertex = vertex = anim
+0.500000
\ No newline at end of file
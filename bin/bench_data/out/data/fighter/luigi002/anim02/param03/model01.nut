@@ -0,0 +1,192 @@
+1.0 material 1.0 1.0
+material -1 texture -1 -1 frame
+bone =
+-1
+material vertex
+= bone texture material -1 =
+texture = texture -1 1.0 -1 =
+0.500000
+1.0 = -1 vertex 0.500000 -1
+= texture bone
+=
+1.0 bone
+bone 0.500000 0.500000
+texture = texture bone material
+frame 1.0 0.500000 bone bone 0.500000
+anim bone 0.500000 material material material 1.0 anim frame = frame material 0.500000
+frame
+1.0 -1 bone
+-1 frame
+= material texture
+bone 1.0
+anim
+bone
+0.500000 anim
+bone vertex bone 1.0 bone
+texture vertex frame 1.0 1.0 texture -1 -1
+texture frame bone -1 0.500000
+1.0
+texture anim
+texture 1.0 anim texture
+bone 0.500000 anim anim
+texture
+frame
+= 0.500000 anim frame material
+1.0
+texture 0.500000
+anim anim = bone anim 1.0 vertex -1
+frame
+anim 0.500000 texture
+vertex
+vertex vertex bone 1.0 1.0 texture bone
+anim
+=
+-1 anim
+0.500000
+texture
+anim =
+= frame 1.0
+texture texture frame
+0.500000 =
+0.500000 material -1
+anim texture bone 0.500000 = vertex -1 material material =
+bone 1.0
+anim anim material = vertex material
+anim = 1.0
+0.500000 bone vertex bone bone
+1.0 material -1 vertex -1 texture
+frame 0.500000 = anim frame bone vertex 0.500000
+anim frame
+=
+material
+= = bone
+1.0 = 1.0 1.0
+vertex
+frame -1
+frame frame
+0.500000
+= anim frame material
+0.500000
+0.500000 1.0 vertex vertex anim bone
+material = anim -1 0.500000 = 1.0
+0.500000 bone texture 0.500000 anim
+frame frame anim frame frame frame 1.0 -1
+1.0 -1 1.0
+frame
+= =
+1.0 0.500000 -1 bone material 1.0
+texture
+0.500000 anim = 0.500000 frame texture vertex 1.0
+bone anim 0.500000
+vertex 1.0
+1.0 frame bone
+-1
+material anim frame
+0.500000 -1
+texture 0.500000
+1.0 bone -1 0.500000 frame material
+anim vertex texture -1 vertex
+= frame 1.0 1.0 material = 1.0 -1
+anim
+1.0 vertex frame bone bone
+texture = texture
+bone -1
+1.0 0.500000 bone texture anim -1 texture material =
+bone
+material
+frame
+frame bone 1.0 material bone = material material bone texture texture vertex material
+anim
+texture vertex frame material
+bone 1.0
+-1 vertex bone
+1.0 anim anim -1
+vertex texture 0.500000 frame = anim anim frame = texture material 0.500000 0.500000 -1 1.0 vertex anim vertex frame anim texture = bone
+1.0
+vertex vertex material
+0.500000 1.0 = = texture
+frame
+vertex texture 0.500000 anim -1 texture 1.0 0.500000 bone 0.500000
+anim 0.500000
+-1 texture = vertex texture
+bone material = -1 material frame frame texture vertex bone material
+=
+1.0 anim texture
+anim 1.0 = -1 texture
+vertex texture
+frame -1
+vertex anim 0.500000 anim anim bone anim frame frame
+bone = bone frame
+vertex
+0.500000 material
+vertex bone
+bone material bone -1 material frame -1 bone material
+vertex -1 bone
+bone 1.0
+=
+bone 1.0 bone frame material vertex
+material
+texture -1 =
+1.0 -1 anim material material texture 1.0
+1.0
+0.500000 vertex
+material vertex = 0.500000 anim vertex material
+-1 material 0.500000
+0.500000 -1 texture
+texture
+vertex vertex frame 1.0 texture
+texture frame anim bone 1.0 1.0 material
+-1
+0.500000 0.500000 anim
+material 1.0 -1 -1 1.0 texture 1.0 anim -1
+vertex bone 0.500000
+-1 bone bone 1.0 material
+material
+vertex 0.500000 texture -1 vertex bone frame
+vertex
+bone 1.0 = anim 0.500000 1.0
+material = -1
+frame texture anim
+=
+anim frame texture
+bone -1 1.0 frame texture frame
+vertex 1.0 frame 1.0 frame bone 0.500000 1.0 1.0 texture anim bone = 1.0 bone vertex frame
+texture 0.500000
+vertex 1.0 = 1.0
+anim
+texture 1.0 vertex
+texture
+material frame
+frame
+texture -1 = 1.0 0.500000
+material 1.0
+material anim texture -1
+= vertex bone = 1.0
+material
+= 0.500000 -1
+vertex bone bone bone
+= anim texture
+1.0
+texture bone 1.0 1.0 texture material material =
+bone texture = bone bone bone =
+-1 anim frame = 0.500000 0.500000 material -1 vertex texture 1.0
+=
+0.500000
+1.0 0.500000
+texture -1 vertex material 1.0 vertex
+material = bone 1.0 anim
+vertex
+1.0 texture material
+0.500000
+= 0.500000 =
+material
+1.0
+1.0
+= material 1.0 bone -1
+bone vertex bone texture bone -1 vertex frame
+vertex texture
+texture bone =
+anim material texture material
+texture 0.500000 bone texture -1 1.0 anim 0.500000
+vertex
+0.50
\ No newline at end of file
@@ -0,0 +1,192 @@
+bone material = frame anim
+= frame 0.500000 -1 = 1.0 texture = bone texture
+bone 0.500000 0.500000 frame bone -1 = = material 1.0 vertex vertex anim
+0.500000 bone 0.500000
+bone anim 0.500000 -1 0.500000 anim material
+texture
+1.0 material material anim 1.0 anim
+material vertex vertex -1 vertex texture -1 texture texture anim
+-1 anim texture
+0.500000
+-1
+0.500000 anim
+texture material texture vertex material frame 0.500000 1.0
+0.500000
+vertex anim 0.500000
+bone 0.500000 texture bone = -1 frame texture texture material
+-1 bone frame -1
+bone frame 1.0 anim vertex = vertex
+anim anim anim 1.0 texture anim anim material 1.0 vertex -1 1.0 material vertex =
+1.0 = = anim frame 1.0 1.0 vertex = anim 1.0 -1 vertex material
+0.500000 vertex material
+vertex
+= 0.500000 = frame
+= frame texture anim material vertex
+0.500000 = = 1.0 frame
+anim bone
+anim = = material 1.0 bone =
+vertex
+frame
+=
+texture 0.500000 frame 0.500000
+texture 1.0 -1 frame
+1.0 anim -1
+frame 0.500000 vertex -1 0.500000
+0.500000
+-1 vertex material -1 vertex vertex frame 1.0 material 1.0 material texture 1.0
+1.0 -1 0.500000
+texture
+= material
+material anim 0.500000 0.500000
+0.500000 vertex 1.0
+-1 frame -1
+bone anim vertex -1 -1
+texture anim frame = material frame texture vertex -1 0.500000
+vertex
+-1 bone
+bone anim vertex vertex bone bone material anim
+-1
+anim
+anim anim 0.500000
+0.500000 frame 0.500000 -1 1.0 =
+1.0
+0.500000 1.0 vertex
+0.500000 frame
+material = = anim 1.0
+frame vertex
+vertex frame
+frame 0.500000 material material
+material 0.500000 -1
+0.500000 frame bone 0.500000 vertex 0.500000
+0.500000
+material frame anim anim anim 0.500000
+material
+texture
+0.500000 bone 0.500000 -1 texture = 1.0 1.0 texture
+material anim =
+bone 0.500000 anim
+1.0 1.0 frame texture
+material
+frame anim 0.500000
+bone -1
+1.0 frame vertex anim anim
+0.500000
+0.500000 material -1 1.0 anim frame material bone -1
+texture 1.0 1.0 texture anim material bone anim = frame = = texture texture
+anim
+texture vertex bone texture
+0.500000 1.0 frame bone material vertex
+anim bone
+frame frame bone
+material texture frame bone bone material = vertex 1.0
+1.0 1.0 -1 frame 1.0 bone frame anim bone
+frame
+material bone material 1.0
+=
+material frame
+texture vertex bone -1 material
+bone frame 1.0
+texture bone material vertex -1 -1
+bone 0.500000 0.500000 bone anim = texture
+1.0
+bone
+1.0 -1
+frame =
+frame
+=
+=
+bone 1.0
+texture -1 1.0
+1.0
+vertex
+bone -1 0.500000
+-1 frame vertex vertex bone 1.0
+0.500000 -1 texture bone bone texture
+vertex vertex 0.500000 texture vertex = 0.500000 -1 0.500000
+bone 0.500000 0.500000
+vertex -1 0.500000 =
+=
+frame 1.0 0.500000
+anim -1 = 1.0 = material vertex vertex
+texture -1
+bone texture anim bone
+anim material 1.0 0.500000 texture frame vertex texture bone 0.500000
+anim vertex anim texture texture vertex material
+vertex -1 0.500000 1.0 bone -1 frame = bone material
+-1 vertex anim 1.0 1.0 material = texture material
+texture -1 vertex material 0.500000 0.500000 frame material 1.0 bone 0.500000 vertex anim
+material 0.500000
+bone bone
+anim 0.500000 = vertex vertex = frame 1.0 -1 bone vertex
+anim vertex vertex anim material vertex 1.0 material
+= 1.0 1.0 1.0
+bone =
+texture vertex texture vertex
+material vertex frame 1.0
+vertex -1 0.500000
+bone 0.500000
+anim vertex anim texture 1.0 0.500000
+-1
+bone
+bone vertex
+anim 0.500000
+-1
+frame =
+bone = bone frame anim -1
+bone bone material bone
+frame 0.500000 frame anim anim
+texture -1 1.0 frame texture material = material = texture
+frame texture anim =
+0.500000 anim material
+-1 -1
+texture frame = -1 bone 0.500000 =
+-1
+anim vertex
+= anim
+-1 frame material vertex bone vertex
+bone
+-1 bone
+0.500000 bone vertex frame
+= vertex 0.500000 1.0 frame bone
+vertex
+bone =
+= texture bone material vertex frame bone bone texture -1 anim anim texture 1.0 = 0.500000 anim texture material -1 bone bone
+texture -1 1.0 1.0 vertex
+-1 = anim material vertex frame
+vertex bone frame
+frame vertex bone
+-1 0.500000
+frame
+0.500000 1.0
+=
+0.500000 vertex 0.500000
+0.500000
+texture
+anim 0.500000 anim
+-1 material = = 0.500000
+-1 1.0 material 1.0
+= texture material 1.0 material
+vertex
+vertex
+0.500000 frame bone =
+= vertex texture 0.500000
+vertex vertex vertex
+= texture material bone texture 1.0 texture frame
+texture material anim material texture
+-1 material texture texture = anim frame = 0.500000 material anim
+material texture texture
+-1
+vertex vertex 0.500000 vertex material -1 bone texture anim frame = = frame bone
+0.500000
+1.0 bone
+= vertex anim 0.500000 0.500000 texture vertex texture -1 material
+0.500000 -1
+0.500000 =
+vertex vertex
+-1
+material material anim texture
+1.0 0.500000
+vertex 0.500000 texture
+0.500000 anim
+-1 0.500000 frame texture anim frame bone 1.0 texture texture vertex = texture texture 1.0 frame
+bone vertex texture 
\ No newline at end of file
@@ -0,0 +1 @@
+p)bA9llX$Rw6\9R`gL/
\ No newline at end of file
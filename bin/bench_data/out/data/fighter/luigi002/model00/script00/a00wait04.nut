@@ -0,0 +1,17 @@
+-1 texture 0.500000
+bone 0.500000 bone material
+0.500000 -1 0.500000 material
+frame -1 texture anim 1.0
+material = texture
+texture
+texture -1 = = -1 anim 0.500000 vertex -1 0.500000 -1 -1 bone material -1 texture
+-1 =
+texture =
+anim 1.0 -1 anim -1 = texture
+-1 vertex
+= vertex anim 1.0 material -1 0.500000 0.500000 vertex texture
+frame vertex anim -1 1.0 anim
+vertex
+texture
+material = -1 texture 0.500000 anim vertex 1.0
+-1 vertex 1
\ No newline at end of file
@@ -0,0 +1,368 @@
+1.0
+frame bone material bone
+1.0 -1 = bone -1 bone 1.0
+=
+1.0 anim frame 0.500000 anim
+-1
+material -1 material bone
+frame
+0.500000
+anim material material material 0.500000 0.500000 anim 0.500000 anim = 1.0 frame vertex anim texture -1 1.0 -1 material = =
+=
+1.0 bone vertex frame 0.500000
+0.500000 anim
+bone frame material
+bone = material
+material 0.500000
+1.0 frame -1 1.0 1.0 material 1.0 = 0.500000
+0.500000
+anim
+=
+vertex frame frame anim vertex 1.0 bone -1 = -1 anim 1.0 material 0.500000 0.500000
+1.0 0.500000 -1 vertex
+bone 0.500000
+material 1.0 1.0 1.0
+frame
+1.0 texture anim texture frame 0.500000 anim texture
+-1 -1 vertex 1.0 material texture vertex -1
+vertex frame
+1.0
+anim 1.0 anim anim
+vertex frame
+anim 0.500000 texture
+1.0 frame
+anim
+vertex frame material frame anim material frame bone vertex material
+1.0 frame -1 0.500000 -1
+anim
+frame bone bone = bone -1 = bone -1 material frame
+0.500000
+frame 1.0 frame
+1.0 frame
+bone 1.0 texture = 1.0 -1 frame vertex 0.500000 texture texture 0.500000 = 1.0 vertex -1 vertex vertex
+material vertex frame frame bone material anim
+vertex vertex
+material 0.500000 frame
+texture
+1.0 -1 texture texture texture bone
+anim
+-1 material 0.500000 vertex
+material material 1.0
+anim 0.500000 texture -1 bone =
+vertex -1 = frame -1 frame
+material 0.500000
+bone
+vertex texture texture 0.500000 vertex material vertex
+vertex bone 1.0
+vertex = vertex frame
+material anim
+vertex bone
+bone material 0.500000
+=
+frame 0.500000 material bone 0.500000 1.0 -1 = =
+vertex material bone texture frame
+-1 texture texture
+-1
+0.500000
+bone
+texture -1 material
+frame frame -1 anim anim
+vertex bone
+0.500000 material anim frame
+-1 material anim bone
+material 1.0 0.500000
+= texture
+vertex texture = anim frame
+texture material texture texture -1
+bone
+0.500000 texture
+= anim = bone bone
+vertex
+0.500000
+vertex
+texture texture anim frame
+anim
+bone =
+anim
+= vertex vertex anim vertex -1 anim 1.0 = = bone anim material = 1.0 -1
+frame
+frame 0.500000
+-1 anim 0.500000 1.0 = anim material 1.0 texture anim -1 0.500000 1.0
+0.500000 = 0.500000 texture
+0.500000 = texture vertex vertex
+vertex -1 -1 bone
+1.0 1.0 bone texture 1.0
+0.500000 frame
+material bone 1.0
+bone texture vertex bone
+bone bone frame -1 bone frame 0.500000
+=
+1.0 frame anim 1.0 0.500000 material 0.500000 0.500000 0.500000
+-1 -1 vertex
+= = material bone 1.0 material bone -1
+texture anim 1.0 material anim 0.500000 frame bone 0.500000 frame -1 anim
+anim 1.0 0.500000 bone material material vertex =
+bone anim 0.500000 texture -1
+anim material frame vertex material =
+frame bone texture vertex frame
+texture
+-1
+material material anim = = texture 1.0 texture
+= frame -1 1.0 bone vertex
+frame
+vertex -1 0.500000 vertex -1 frame
+0.500000 bone material material bone bone texture
+bone bone -1 bone bone texture
+= material material bone vertex frame 0.500000 bone
+anim texture bone texture vertex material texture 0.500000 1.0 anim
+texture = = frame
+1.0 vertex 0.500000 anim vertex material texture vertex -1 1.0
+-1
+anim
+frame 0.500000 -1 -1 bone
+texture
+vertex
+material frame bone anim 1.0 1.0 -1
+frame frame vertex
+frame bone = vertex 1.0 0.500000 1.0
+0.500000 =
+1.0 bone bone frame material frame anim frame frame texture frame bone vertex
+frame -1
+=
+anim texture 1.0 anim
+0.500000 anim
+vertex 0.500000 =
+frame
+anim 0.500000 -1 anim
+material
+texture =
+bone
+bone bone = texture anim =
+-1 anim 1.0 -1 material
+anim bone
+frame material
+anim 0.500000
+vertex
+= -1
+vertex bone
+= = 0.500000 texture 0.500000 bone 0.500000 vertex material bone frame 1.0 vertex
+= 1.0 frame 0.500000
+0.500000
+-1
+anim =
+0.500000 = anim bone 0.500000 frame 1.0
+-1
+anim = bone
+0.500000 1.0 frame
+-1 texture
+frame material
+texture texture = texture material texture
+material
+1.0 = -1
+anim material frame material vertex -1
+1.0 -1 texture 0.500000 texture -1
+bone
+material texture frame material 0.500000 bone vertex anim -1 texture
+anim 1.0 anim 0.500000 1.0
+1.0 anim -1 anim texture frame
+= vertex bone texture vertex bone frame texture vertex
+0.500000
+material
+texture texture
+vertex
+1.0 vertex 0.500000 material
+vertex material texture =
+material material anim texture bone anim -1
+= vertex
+anim 0.500000 1.0
+1.0 = -1 0.500000
+= texture frame -1 -1
+1.0 anim
+0.500000 texture 0.500000 = frame
+-1 frame anim
+texture
+frame
+anim -1 -1 anim 0.500000
+frame
+vertex frame
+1.0 1.0 vertex material anim bone -1 1.0 vertex texture -1
+-1
+1.0 = texture anim
+bone vertex
+frame texture anim
+bone bone
+anim anim
+0.500000 bone anim material
+texture
+frame vertex 0.500000 texture = anim anim vertex 1.0 bone
+0.500000 frame
+vertex
+vertex 1.0
+= frame texture 0.500000 = vertex anim texture 0.500000
+anim bone -1
+0.500000 0.500000 -1 =
+= 0.500000
+texture
+bone
+-1
+-1
+= vertex material material =
+-1 vertex
+bone -1
+0.500000 0.500000 -1 vertex 1.0 frame
+bone
+=
+-1
+anim frame vertex anim =
+-1 frame
+1.0
+bone 1.0 vertex
+anim = 0.500000 vertex 1.0 1.0 =
+0.500000 frame material frame material
+0.500000 bone -1 anim
+0.500000 texture
+anim 1.0 texture
+-1 texture
+= anim anim
+material
+1.0 material 1.0 = -1
+anim
+-1
+1.0 vertex
+material 1.0 anim 1.0 1.0 0.500000 -1
+vertex material texture =
+0.500000 = 1.0
+anim
+-1 anim frame =
+texture vertex frame
+vertex 0.500000 -1 = frame anim texture
+bone
+texture
+1.0 vertex =
+bone texture bone anim
+frame frame bone anim 0.500000
+1.0 vertex 0.500000
+material
+frame
+= frame
+material
+-1
+texture 0.500000
+vertex 1.0 1.0 material 1.0 vertex 0.500000 -1 bone -1 vertex bone anim
+frame bone frame vertex anim
+= material = 1.0 anim texture =
+frame
+material bone 1.0 0.500000 0.500000
+vertex
+texture vertex anim material
+anim 0.500000
+texture anim
+1.0 1.0 anim
+1.0 bone
+bone vertex
+-1 0.500000
+bone
+1.0
+1.0
+-1 frame 0.500000 anim vertex =
+0.500000 vertex 0.500000 -1
+0.500000
+bone
+1.0 texture bone
+anim frame
+frame =
+1.0 frame
+vertex -1 1.0 anim 0.500000 frame bone
+0.500000 -1
+material vertex
+1.0 bone
+material
+texture -1 bone -1 anim = frame vertex 1.0 material anim vertex material
+0.500000 frame texture material 0.500000
+texture texture
+= texture material -1 frame -1 1.0 anim 0.500000 material
+texture bone vertex 0.500000 texture anim 1.0
+texture
+0.500000 0.500000 frame -1 = vertex material
+texture anim -1 frame material vertex anim material 0.500000 vertex 1.0
+bone = -1 -1 anim 0.500000 0.500000 vertex texture bone
+1.0
+texture material anim 0.500000 vertex = bone material =
+material = -1 =
+frame bone anim =
+bone texture bone frame texture
+material 1.0 1.0 anim
+bone = -1 = frame anim anim 0.500000 texture -1 frame = 0.500000 0.500000 1.0 bone anim
+1.0 texture frame
+-1 1.0 texture -1
+= 0.500000 1.0 vertex
+1.0 texture bone
+vertex 1.0 bone 0.500000 =
+=
+frame frame 0.500000 bone -1 1.0 bone frame
+1.0 bone
+-1 bone -1 = material = = texture vertex =
+0.500000 1.0 0.500000
+bone material
+-1
+=
+-1
+0.500000 0.500000 material -1 =
+1.0 -1
+-1
+material anim texture 1.0 =
+0.500000 frame material bone 0.500000 material
+vertex texture 0.500000 -1 = vertex -1 bone
+anim material bone
+= vertex texture anim frame vertex bone
+-1
+bone bone bone = frame anim
+anim
+-1 texture 1.0
+= 1.0 vertex frame anim bone = anim vertex = -1 -1 0.500000
+-1
+1.0 = 1.0
+-1 1.0 =
+bone vertex 0.500000 frame bone -1
+-1 -1
+frame -1 0.500000 anim 0.500000
+1.0
+vertex =
+frame 1.0
+vertex 0.500000
+bone vertex
+= 0.500000 frame material anim frame frame 1.0
+vertex bone 1.0 = =
+frame -1 -1
+-1
+material texture vertex vertex
+1.0
+0.500000 0.500000 vertex
+frame 1.0 bone
+1.0 1.0 texture texture 1.0 -1 -1 =
+1.0 frame = anim frame
+anim anim
+0.500000 =
+anim material
+vertex 0.500000 -1 0.500000 anim 0.500000
+vertex texture -1
+anim material
+1.0 0.500000 -1
+bone
+texture -1 material
+=
+=
+0.500000 -1 anim anim material -1 0.500000 material
+bone
+material
+= texture bone 0.500000 1.0 0.500000 frame material texture 1.0 frame -1
+frame -1
+vertex bone anim bone texture material
+texture -1
+frame -1 vertex 0.500000 anim =
+frame
+frame 0.500000
+material material material
+anim material 1.0
+= 1.0
+0.500000 frame 0
\ No newline at end of file
@@ -0,0 +1,37 @@
+texture frame anim -1 1.0
+texture vertex anim frame frame frame vertex vertex anim anim 1.0 0.500000 0.500000
+1.0 vertex
+1.0
+1.0 vertex = -1 frame
+-1 texture =
+material
+0.500000
+= -1
+= vertex
+material bone
+1.0
+1.0 material frame
+-1
+1.0
+material
+material 1.0 = bone anim 1.0
+=
+frame vertex =
+= = -1
+texture
+1.0 bone texture bone 1.0
+0.500000 1.0 = 1.0 0.500000 bone vertex
+= =
+0.500000 0.500000 0.500000 = anim
+-1
+material
+frame 0.500000
+texture
+1.0 0.500000 material texture material
+0.500000 bone material 1.0 bone
+0.500000 material
+-1 1.0 -1 vertex anim
+1.0 -1 1.0 0.500000
+material
+vertex 0.500000
+frame material vertex -1 bon
\ No newline at end of file
@@ -0,0 +1,10 @@
+vertex
+anim material
+texture
+anim vertex
+frame texture -1
+anim 1.0 frame material
+= 0.500000 frame
+0.500000 material
+material -1 material
+-1 1.0
@@ -0,0 +1,7 @@
+material vertex texture = 1.0 frame bone
+-1 vertex texture
+bone anim 1.0 frame 0.500000 frame anim
+anim bone 1.0 = -1 = texture texture material
+frame frame
+frame anim 0.500000 0.500000 -1 frame bone frame anim vertex
+ani
\ No newline at end of file
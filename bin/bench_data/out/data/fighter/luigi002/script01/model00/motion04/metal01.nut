@@ -0,0 +1,109 @@
+-1 material bone anim
+1.0 anim bone vertex 1.0 = frame texture material texture texture frame bone 0.500000 frame anim frame 1.0 texture frame = frame 0.500000 = =
+texture material texture material anim frame = anim -1 0.500000
+0.500000
+-1
+0.500000 texture 1.0 material frame -1 -1 anim texture vertex -1
+vertex texture material
+bone
+anim material 1.0 material vertex texture =
+vertex texture material vertex -1 1.0 anim anim =
+vertex -1 -1
+1.0 0.500000 = = -1 material 1.0 =
+vertex material bone frame material 1.0 1.0 vertex vertex vertex
+vertex
+0.500000 1.0 1.0 = vertex anim = 1.0 texture
+material texture bone
+anim
+-1 anim bone
+bone frame -1 material vertex 0.500000 -1 texture 0.500000
+bone material bone 1.0 -1
+frame 0.500000 = 1.0 anim
+=
+texture texture texture texture 1.0 bone material 1.0 1.0 0.500000 0.500000 bone
+1.0 =
+= bone bone
+texture 1.0
+texture 0.500000
+1.0
+bone
+=
+= 1.0 vertex material texture texture bone texture 0.500000 0.500000
+= 0.500000 frame = 1.0 anim -1 material material vertex anim
+vertex 0.500000 = 1.0
+material 1.0 vertex
+0.500000 vertex texture texture
+-1 -1 frame anim -1 bone bone bone
+material =
+texture
+=
+frame
+= =
+frame texture frame anim
+1.0 frame = bone material = texture vertex -1 -1 vertex frame =
+= 0.500000 anim = vertex bone 0.500000
+= vertex vertex bone frame 1.0 material vertex vertex material =
+anim
+0.500000 vertex material 1.0
+frame anim frame bone frame
+anim frame
+= vertex = bone
+-1
+-1 -1 material -1 = frame
+0.500000
+vertex -1
+anim texture anim anim = anim 0.500000 anim
+1.0
+texture texture material texture frame material -1
+anim
+-1 material = texture bone 0.500000 vertex
+anim frame
+texture vertex
+bone 1.0 frame
+frame 0.500000 1.0 = anim texture vertex anim = -1 1.0 texture anim -1 = = anim 0.500000 vertex anim texture 0.500000 frame bone vertex 0.500000 vertex = = 0.500000 1.0 frame texture anim material frame = anim frame material 1.0
+frame -1 = material
+1.0 frame
+-1 0.500000 1.0 1.0 =
+bone
+vertex texture bone texture =
+vertex material 0.500000 bone
+frame material material vertex texture
+texture anim texture texture vertex frame vertex bone
+= = =
+bone
+anim material 1.0
+anim bone 1.0
+material
+texture = bone -1
+vertex anim material texture
+frame texture texture anim texture 0.500000
+0.500000 1.0 0.500000 frame
+texture bone 1.0 1.0 bone bone anim
+anim vertex texture material
+frame
+texture
+1.0 frame -1 vertex
+0.500000 -1 vertex
+anim
+bone
+bone vertex
+texture 1.0 0.500000 0.500000 -1 material
+vertex
+anim material bone 0.500000 1.0 = 0.500000 anim texture -1 vertex
+vertex bone 0.500000 0.500000 -1 = 0.500000 bone
+vertex material
+frame
+0.500000 anim
+material -1
+material -1 bone -1 =
+=
+-1 texture
+0.500000 1.0 texture 1.0 bone 0.500000 =
+texture material
+texture anim
+-1
+anim = material anim -1 material material
+anim
+1.0 bone
+= material
+frame -1 texture -1 0.50000
\ No newline at end of file
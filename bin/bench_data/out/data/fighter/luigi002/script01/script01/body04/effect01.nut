@@ -0,0 +1,5 @@
+0.500000 vertex vertex
+frame = texture -1 vertex = material
+frame frame anim
+= 1.0 anim
+vertex -1 texture ve
\ No newline at end of file
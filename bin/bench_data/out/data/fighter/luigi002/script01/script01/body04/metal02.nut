@@ -0,0 +1,32 @@
+=
+bone frame texture anim
+texture 1.0 vertex bone -1 vertex 1.0 material texture 0.500000 bone -1
+anim vertex = texture texture 0.500000 texture
+anim material texture vertex
+0.500000 vertex 0.500000 vertex
+frame anim frame 1.0 texture
+anim 0.500000 vertex bone texture anim texture 0.500000
+bone 1.0 1.0 bone frame bone 1.0 = material anim
+material vertex 1.0 frame vertex material vertex vertex bone material texture frame
+texture bone = vertex 0.500000 vertex
+-1 1.0 material 1.0 vertex anim texture texture vertex vertex anim texture
+anim -1 bone 0.500000
+vertex frame -1
+material vertex
+0.500000
+=
+vertex anim
+vertex = 0.500000 anim anim vertex
+vertex -1
+bone material 1.0 material frame frame
+anim bone anim 1.0 vertex
+vertex vertex 0.500000 0.500000 vertex frame 1.0
+bone vertex 1.0 frame vertex bone frame texture vertex 1.0 anim =
+material = texture material
+anim anim 1.0 texture
+texture bone
+-1 material
+vertex vertex =
+frame
+=
+material material -1 
\ No newline at end of file
@@ -0,0 +1,60 @@
+texture
+1.0 vertex bone frame = frame 1.0 -1 vertex vertex frame
+anim vertex 0.500000 vertex 0.500000 bone anim material
+1.0 = 0.500000 = 0.500000 frame
+= = 0.500000 -1 1.0 anim bone anim material 0.500000 material anim frame anim material frame material 1.0 0.500000 bone
+-1 anim
+= bone
+anim -1 material
+= 1.0 =
+vertex
+=
+0.500000 vertex frame = -1
+anim 1.0 frame 0.500000 vertex frame material vertex
+vertex vertex -1 anim
+-1
+anim vertex
+material texture = frame
+material = material
+bone
+frame material bone frame vertex = texture -1 0.500000 0.500000
+=
+= = vertex material material anim texture
+texture 0.500000
+anim
+0.500000 frame frame = anim material -1 anim 1.0
+texture 0.500000 = anim texture
+bone frame material -1 -1
+bone 1.0
+=
+bone 0.500000
+texture
+frame
+=
+vertex anim anim = material -1 texture 1.0 anim
+= frame 1.0 texture material material
+vertex
+bone 0.500000
+vertex texture
+-1 0.500000
+bone bone texture texture anim bone 0.500000 -1 0.500000 anim vertex texture
+texture material bone material anim
+bone frame texture anim = texture
+-1 -1
+frame
+anim
+bone = 1.0 1.0
+vertex = bone
+texture vertex vertex -1
+vertex
+vertex -1 anim anim -1 anim texture
+1.0
+material = material material frame bone bone material vertex 1.0 vertex texture
+0.500000 frame texture vertex
+anim bone
+1.0 vertex = texture -1 =
+anim anim material bone -1 0.500000 vertex = = vertex frame texture 0.500000 0.500000
+material 1.0 = texture anim texture -1 -1 texture
+bone 0.500000 frame anim vertex
+-1
+0.
\ No newline at end of file
@@ -0,0 +1,3 @@
+material texture 0.500000 0.500000
+material anim
+= vertex
\ No newline at end of file
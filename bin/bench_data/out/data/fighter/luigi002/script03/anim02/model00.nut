@@ -0,0 +1,275 @@
+anim frame frame
+= anim -1 frame
+texture
+anim
+material 0.500000
+= bone
+1.0
+vertex 1.0 texture anim frame
+material bone bone 0.500000 anim 1.0
+-1 -1 texture
+=
+bone
+0.500000 vertex
+texture frame frame -1 frame -1
+bone anim = material
+material vertex -1 frame
+= 1.0 -1 =
+bone anim
+0.500000 -1 texture
+texture texture 1.0 texture texture
+anim 0.500000 texture = -1 0.500000 anim bone anim anim material
+1.0 frame material texture vertex 1.0 vertex frame
+1.0
+0.500000 frame
+bone = -1 material vertex
+= frame -1 vertex frame
+texture frame
+bone
+0.500000 0.500000 -1
+frame
+= 1.0
+anim 0.500000 bone material material vertex texture anim frame texture =
+texture
+1.0 = material texture texture
+bone -1
+texture 1.0 vertex vertex = material
+anim -1 vertex bone 1.0 -1 = 1.0 = anim vertex 1.0 -1 material 1.0 texture frame
+= 0.500000 texture texture texture
+1.0 0.500000 frame material vertex texture
+vertex
+texture 0.500000 bone bone bone
+-1 anim 1.0
+bone frame vertex -1 = 1.0 material bone texture vertex frame texture = frame = bone texture -1 anim
+anim texture 1.0 0.500000 1.0 -1 0.500000 = frame -1 vertex =
+-1 anim
+=
+vertex
+frame vertex
+bone -1 =
+-1 vertex 1.0 texture 1.0 anim 0.500000 bone
+material 1.0
+texture texture
+material -1 texture frame
+1.0
+vertex frame
+texture
+anim frame 0.500000
+1.0
+1.0 texture vertex
+0.500000
+vertex bone 1.0
+anim =
+1.0
+-1 frame frame -1 frame bone vertex 0.500000
+bone = material = = texture
+-1
+bone material material
+frame
+bone bone vertex texture frame
+1.0 1.0 bone bone bone
+0.500000 frame 1.0 bone anim 0.500000 anim 1.0 material -1
+frame = 0.500000
+-1
+frame = anim
+anim -1 -1 material = 1.0 vertex bone texture -1 vertex -1 anim anim material texture texture 1.0 texture 0.500000 = 0.500000 material
+texture 1.0 vertex anim material
+1.0 0.500000
+bone anim
+-1
+anim -1
+anim anim
+vertex = -1 texture
+texture bone
+bone
+bone material texture 0.500000 anim vertex = = frame
+bone bone -1
+vertex
+-1
+=
+bone -1 texture anim bone texture material material vertex = frame 0.500000
+material = -1
+texture texture 0.500000
+material frame
+1.0 -1 bone material bone frame frame 1.0 frame frame bone 0.500000 vertex anim 1.0 material anim vertex
+frame -1 material bone texture vertex 1.0 material
+1.0 vertex
+material 1.0 texture 1.0 = bone
+bone
+vertex
+bone = frame 1.0 -1 bone frame
+frame anim frame
+anim anim vertex material 1.0
+texture frame vertex = = anim texture texture texture -1 frame
+1.0 frame -1 1.0 0.500000 1.0
+bone = 1.0 vertex = 0.500000
+vertex bone bone texture texture -1 texture -1 bone 1.0 texture 0.500000 material 1.0
+0.500000 bone anim 1.0 anim vertex
+frame frame vertex
+-1 texture
+-1
+= 0.500000
+-1 =
+vertex -1 material
+1.0
+0.500000
+0.500000 vertex -1
+= vertex -1
+bone 1.0
+material
+frame 0.500000 frame bone
+0.500000 bone -1 = anim = material texture -1 texture 1.0 bone material
+frame
+frame frame
+bone texture material = -1
+texture material 1.0 0.500000 frame
+= -1
+texture frame
+0.500000 0.500000 bone
+= frame texture material anim 0.500000 material vertex
+anim -1 = 0.500000 = 1.0 bone texture vertex 0.500000
+bone bone bone frame 0.500000 texture bone 0.500000
+-1 material
+1.0
+bone material vertex texture
+bone 1.0 = bone frame 1.0 texture
+material material
+material vertex anim material -1 anim
+anim
+material -1 anim 1.0 texture anim
+= anim
+vertex
+material frame material 1.0 material -1
+anim
+bone
+vertex
+0.500000 material bone
+0.500000 1.0
+vertex vertex anim frame anim vertex bone 1.0 0.500000
+material -1 1.0
+bone
+-1 -1 =
+texture anim
+bone bone vertex
+anim material bone frame vertex bone texture frame 0.500000 0.500000 -1 frame 1.0 material material
+-1 frame anim bone vertex =
+1.0 texture frame -1 material
+material -1
+vertex -1
+frame
+vertex -1 0.500000 1.0 1.0
+0.500000 anim frame vertex
+material bone
+1.0 -1 1.0 bone
+bone vertex texture = material frame -1 = bone vertex texture texture bone
+= -1
+anim anim anim
+frame bone
+0.500000 frame texture anim texture texture vertex texture texture bone -1 vertex texture anim = anim
+-1
+0.500000
+material -1
+-1 vertex = 1.0 1.0
+texture texture
+vertex 0.500000 -1 -1
+material
+material 1.0 frame 0.500000
+1.0 frame
+vertex -1 material frame
+vertex 1.0 0.500000 =
+bone material bone bone
+vertex material anim
+frame material -1 =
+vertex vertex 1.0
+frame vertex material 0.500000 bone bone 1.0 0.500000 = frame 0.500000 bone 1.0 frame vertex -1 material
+material material 0.500000 -1 1.0
+-1 0.500000
+texture = material
+bone material
+frame 0.500000 bone vertex material texture anim bone frame 0.500000 1.0 material bone anim
+material
+anim
+material -1 =
+frame material material vertex
+= texture anim
+-1 -1 -1
+material -1
+= 0.500000
+anim texture anim -1
+-1 vertex vertex anim texture -1 anim frame
+material
+1.0
+bone bone vertex texture 0.500000
+0.500000 vertex frame -1 anim -1 1.0
+bone 0.500000 texture -1 texture
+anim
+vertex
+bone
+0.500000 bone
+0.500000
+material 0.500000 material bone anim texture bone
+texture texture
+frame 1.0 bone material =
+0.500000 0.500000 vertex vertex
+texture bone bone
+1.0
+bone
+frame material anim
+anim bone frame -1
+anim -1 bone
+vertex frame anim bone 1.0 bone =
+0.500000 frame
+1.0 texture =
+frame
+frame bone 1.0 material 1.0
+bone
+bone
+texture anim
+bone material material
+0.500000 1.0 anim bone = 1.0 frame
+texture 1.0 anim = anim 0.500000 -1 texture
+material
+vertex vertex 0.500000 -1
+frame frame
+frame
+material -1 -1 material
+= = vertex material material anim frame
+anim frame 1.0 texture
+0.500000
+material vertex
+anim vertex 0.500000 -1 anim
+texture
+1.0
+anim 1.0
+frame 0.500000 frame 0.500000 material -1 material
+1.0
+= vertex anim anim 0.500000 =
+anim
+material vertex
+frame bone 0.500000 material
+1.0 1.0
+vertex vertex
+0.500000 1.0 frame 0.500000
+bone 0.500000 0.500000 -1 material 0.500000
+material frame
+=
+texture 0.500000
+-1
+texture material
+bone
+frame vertex frame frame
+bone -1
+-1 texture -1 texture =
+1.0 anim
+bone
+material -1 =
+vertex anim
+anim anim
+vertex =
+anim
+= = material texture vertex
+vertex texture anim
+vertex =
+vertex frame frame
+texture
+bone frame 0.500000 materi
\ No newline at end of file
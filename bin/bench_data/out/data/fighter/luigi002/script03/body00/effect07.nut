@@ -0,0 +1,335 @@
+material
+-1 bone bone
+anim 1.0 0.500000 material 0.500000 = = 1.0
+0.500000
+anim bone frame texture material texture anim vertex 1.0 -1 vertex
+vertex
+0.500000 0.500000 = = 0.500000 frame 0.500000 bone 1.0
+material 1.0 anim material
+texture 0.500000 anim texture
+= frame
+0.500000 vertex texture 1.0
+0.500000 anim = anim frame
+1.0
+texture vertex
+bone
+-1 material vertex vertex vertex
+texture 0.500000 frame
+= vertex = texture texture frame frame vertex -1 bone 0.500000 bone
+0.500000 1.0
+material texture texture = -1
+1.0 -1 vertex -1 bone -1 material texture 1.0 material
+material bone -1
+-1 = texture vertex = vertex material 1.0 = =
+material material
+material 1.0 vertex 1.0 anim -1
+-1 anim anim vertex
+texture texture
+-1 anim bone frame
+-1 = -1
+texture
+frame = texture bone bone
+0.500000
+anim -1 anim vertex -1 =
+= anim vertex texture material
+1.0 1.0 bone vertex vertex
+texture 0.500000
+-1 texture = anim -1 -1
+anim -1 1.0 1.0 = frame vertex -1 = -1 -1 0.500000 bone
+anim texture
+bone 1.0 1.0
+frame
+bone
+= vertex frame -1 -1
+material anim frame
+-1
+texture 0.500000 = 0.500000 vertex -1 frame material
+vertex -1 vertex anim texture 1.0 vertex bone -1 texture 0.500000 1.0 =
+-1 -1 material texture 1.0 material texture anim
+texture -1 texture bone vertex texture = vertex texture material 0.500000
+material texture
+0.500000 material = anim 1.0 material 1.0 1.0 vertex material bone vertex
+anim 1.0 anim = 1.0 -1 1.0 1.0 anim 1.0 texture
+vertex 0.500000 = -1 anim
+1.0 texture
+0.500000 0.500000 texture 0.500000 texture bone = texture texture = vertex
+1.0
+vertex vertex
+0.500000 texture
+material
+frame = anim = anim =
+texture 0.500000
+bone 1.0 vertex 1.0 1.0 material vertex
+0.500000 1.0 1.0 vertex 1.0 bone -1 texture 1.0 vertex 1.0
+vertex material = -1 frame
+vertex
+vertex frame anim material material
+vertex
+1.0 vertex
+bone
+texture material -1 0.500000 material -1 1.0
+frame vertex vertex = texture
+1.0 -1 material 0.500000 = vertex anim
+material 1.0 material frame frame 1.0 bone anim vertex 1.0 anim 0.500000
+0.500000 1.0
+= 0.500000 bone frame -1 0.500000
+0.500000 = 1.0
+texture
+texture texture =
+frame
+texture texture -1
+vertex vertex material material
+vertex texture anim
+0.500000 =
+material vertex anim anim =
+vertex anim frame texture -1 frame vertex
+bone texture texture anim
+frame bone -1
+1.0 texture vertex
+frame bone bone -1 0.500000
+0.500000 = material anim anim 0.500000 -1 -1 material
+-1 bone frame texture bone frame
+texture
+bone texture bone bone
+material = anim -1 frame anim bone 1.0 frame -1 0.500000 texture texture material 1.0 -1 1.0
+material -1
+-1 -1 -1 = anim bone
+0.500000
+anim 0.500000 = anim texture frame vertex
+material 0.500000 frame material 1.0 bone
+bone anim material
+=
+texture material 1.0 anim frame
+material
+texture
+0.500000 bone = anim -1 texture texture
+1.0
+0.500000 frame
+= = 1.0 -1 frame 1.0 vertex bone frame 0.500000
+bone anim vertex anim texture = texture 0.500000 anim anim = 0.500000 vertex bone = material frame frame
+1.0 material
+bone 0.500000 anim material vertex
+-1 bone frame texture
+vertex 1.0
+= 1.0 = frame vertex
+frame bone 0.500000 =
+-1 bone = -1 = texture anim vertex
+-1 material
+1.0 anim 1.0
+anim frame = anim anim texture frame vertex vertex bone material = = material -1
+material
+texture material
+frame
+=
+1.0 0.500000 0.500000 material vertex vertex = = material 1.0 0.500000 vertex
+vertex 0.500000 material vertex =
+vertex = material material
+1.0 anim 1.0 frame frame 1.0
+frame
+1.0 material 0.500000
+material vertex
+material
+-1 -1
+-1 texture texture 0.500000
+1.0 texture
+0.500000 frame
+= 1.0 frame
+frame material 1.0
+= -1 -1
+texture bone 0.500000 vertex vertex
+bone
+frame -1 1.0 -1 -1 vertex texture -1 =
+=
+-1
+vertex = 0.500000 bone =
+frame texture = 1.0 frame anim
+frame vertex
+1.0 1.0
+-1
+= anim
+-1 = 0.500000 1.0 bone material vertex
+anim
+1.0 anim 1.0 material texture vertex -1 -1
+=
+-1 texture anim frame
+material frame = texture frame bone frame
+-1
+-1 texture 1.0 bone
+bone
+bone
+texture
+vertex material
+-1 material
+anim frame =
+frame bone = material vertex
+bone anim texture anim
+vertex bone 1.0 texture anim
+vertex material frame anim
+vertex 1.0 material
+anim
+frame anim vertex
+bone bone material = texture material vertex texture
+texture anim 0.500000 material material bone anim = anim
+0.500000 frame -1 0.500000 = 0.500000 vertex 1.0
+frame 0.500000
+bone anim -1 texture 0.500000 -1
+anim -1 1.0 1.0 0.500000 anim
+0.500000
+vertex
+=
+anim anim texture
+bone -1 0.500000
+-1 1.0 1.0
+1.0 1.0 bone material material vertex material
+material -1
+anim = frame vertex
+= = vertex -1 material vertex texture vertex 1.0
+1.0 vertex = material vertex bone
+vertex -1 material 1.0 -1 bone 1.0 bone = 1.0 bone
+anim
+1.0 vertex
+= material texture
+material -1 frame =
+texture 1.0 anim material -1 1.0 =
+bone material
+material
+anim texture frame
+texture texture vertex
+1.0 texture -1
+0.500000 frame -1 vertex
+1.0 =
+frame material anim
+-1 1.0 anim texture
+-1 bone
+=
+-1 = -1 vertex frame
+anim
+-1 texture 1.0
+frame 1.0 0.500000 vertex
+-1 vertex bone
+anim 0.500000 =
+texture anim
+= vertex
+-1 material anim 0.500000
+-1
+vertex =
+anim
+frame 0.500000 texture bone material 0.500000 -1
+0.500000
+vertex vertex
+1.0
+vertex bone
+= 1.0 frame 1.0 material
+anim
+0.500000 vertex 0.500000 frame frame -1 frame 0.500000 texture -1 material = vertex
+texture = vertex 0.500000 0.500000 material
+1.0 texture -1
+-1 0.500000 vertex = = -1 1.0 bone vertex
+vertex anim -1 material
+1.0 material bone
+material bone material = -1 material texture
+vertex
+= = texture frame
+material bone 0.500000 anim
+= -1 anim anim 1.0 =
+texture 1.0
+0.500000 vertex texture
+frame vertex vertex vertex bone frame vertex frame
+0.500000 = frame material frame 1.0
+anim frame
+anim -1 frame vertex bone
+0.500000 frame frame =
+material = material 0.500000 1.0 material
+= 0.500000 material
+texture material frame bone 1.0
+1.0 frame
+-1 anim -1
+frame
+=
+= -1 texture
+0.500000 bone 0.500000 vertex vertex bone 1.0 -1 texture anim
+anim 0.500000 vertex bone 0.500000 vertex 0.500000 frame =
+vertex anim anim
+texture frame
+material
+1.0 bone bone
+bone
+material
+material texture frame material anim material anim
+0.500000
+= vertex =
+anim frame vertex
+material 1.0 0.500000
+texture material frame anim =
+texture material vertex frame
+frame
+=
+0.500000
+frame anim texture material
+anim bone vertex vertex 1.0
+-1 frame -1 0.500000
+vertex 0.500000
+-1 1.0 0.500000 bone frame material anim texture -1 anim 1.0
+anim vertex bone anim
+vertex
+frame
+material texture frame vertex material material 1.0 -1 1.0 1.0 1.0 1.0 frame
+bone texture vertex
+material vertex texture 0.500000 anim 0.500000 bone
+material
+bone anim anim
+anim
+bone 1.0
+texture =
+anim texture =
+frame -1
+anim
+1.0 texture
+= texture material
+texture material
+bone
+-1
+0.500000 bone material
+-1 1.0 frame vertex
+= material bone material material texture
+texture
+vertex -1 frame texture texture -1 vertex anim -1 -1
+material -1
+0.500000 texture = = frame
+texture 1.0
+bone 0.500000 0.500000 -1 bone bone frame anim material anim anim
+bone
+vertex -1 material
+anim
+-1 0.500000
+-1 0.500000
+material
+anim
+anim
+frame vertex frame
+0.500000 vertex anim material
+frame anim 1.0 1.0 bone
+bone
+= vertex -1 material = frame -1
+vertex frame frame -1 -1 -1 =
+vertex 0.500000 bone frame
+bone frame vertex -1 =
+texture anim
+-1 vertex 1.0 = 1.0
+= -1 texture anim -1 vertex texture
+anim vertex
+anim 0.500000 = =
+bone
+= anim 0.500000 material
+texture material material bone
+bone anim texture 1.0 bone
+bone 1.0 -1
+frame bone
+frame vertex texture material bone
+-1 anim bone -1 -1
+vertex material
+bone = material
+1.0 0.500000
+0.500000 vertex texture -1
+texture
+0.500000 0.500000 frame vertex =
\ No newline at end of file
@@ -0,0 +1,36 @@
+0.500000 material anim texture frame = bone anim -1 -1 vertex vertex bone 0.500000 = anim
+material anim bone 1.0
+bone = anim
+-1
+0.500000 material 0.500000 material bone -1 frame = 0.500000 1.0 bone material bone bone
+-1 material vertex
+vertex vertex bone texture
+0.500000
+vertex
+1.0 material bone 0.500000 texture
+0.500000 1.0 vertex frame 1.0 -1
+0.500000 bone material vertex
+-1
+vertex -1 1.0 1.0 bone 1.0 bone
+= texture
+=
+anim anim 1.0 frame
+texture frame bone vertex material texture
+bone anim
+0.500000
+vertex anim
+vertex 1.0 anim 1.0 anim vertex
+= texture anim
+texture anim vertex
+anim
+bone bone texture
+vertex vertex
+texture 1.0
+1.0 -1 1.0 0.500000
+anim bone -1 1.0 0.500000
+= texture frame vertex texture anim frame 1.0 -1 vertex bone vertex = vertex anim frame
+texture -1 texture
+material texture
+anim 0.500000 texture 0.500000 vertex bone 1.0 frame
+= texture frame = = material
+bone mate
\ No newline at end of file
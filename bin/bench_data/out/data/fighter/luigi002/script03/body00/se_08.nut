@@ -0,0 +1,6 @@
+material texture bone 1.0 material vertex texture vertex = 1.0
+bone
+-1 material = vertex = anim anim frame texture texture
+0.500000 -1
+vertex
+bo
\ No newline at end of file
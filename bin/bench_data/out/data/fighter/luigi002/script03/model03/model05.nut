@@ -0,0 +1,2 @@
+bone
+= bone vertex frame = 1.0 -1 a
\ No newline at end of file
@@ -0,0 +1,18 @@
+frame material anim = texture 1.0 anim bone frame -1
+anim 0.500000 texture
+vertex
+bone anim -1 anim material
+bone texture vertex
+frame texture 0.500000 material 0.500000 0.500000 -1
+texture material
+-1
+anim
+0.500000 frame
+-1
+frame material texture vertex
+0.500000 material material
+bone anim 0.500000 material bone texture anim bone
+=
+frame bone vertex frame
+frame
+1.0 material material anim 0.500000
\ No newline at end of file
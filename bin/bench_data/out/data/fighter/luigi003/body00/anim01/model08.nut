@@ -0,0 +1,77 @@
+material vertex = texture
+=
+material bone
+vertex
+frame
+anim material -1 vertex
+anim 1.0
+texture =
+material vertex 1.0 -1 =
+material vertex frame = vertex -1
+bone
+bone -1
+1.0 anim vertex
+material bone vertex
+material texture
+vertex texture texture = vertex texture = material 0.500000 material -1
+frame material = -1
+1.0
+bone
+frame
+texture
+frame -1 1.0
+-1 material 0.500000 anim 0.500000
+1.0 texture material 1.0 frame 0.500000 1.0 texture
+vertex =
+texture
+= texture 0.500000 = 1.0
+vertex vertex frame frame = 0.500000
+texture material bone 0.500000
+1.0 bone
+vertex
+-1 frame texture vertex texture
+texture anim 1.0 anim 0.500000
+-1 -1 bone 1.0 anim
+bone anim texture
+-1
+frame
+bone 1.0
+= anim 0.500000 texture bone
+bone 1.0
+bone -1 1.0 material
+material
+frame -1 -1
+frame =
+material
+0.500000 vertex frame bone -1 0.500000 bone
+-1 material =
+0.500000
+vertex
+0.500000
+= bone 1.0
+material texture
+= vertex
+= anim frame texture vertex 1.0 bone anim
+1.0
+= bone texture material
+0.500000 0.500000 0.500000 vertex vertex =
+anim anim
+anim -1 material anim
+-1
+frame anim texture 1.0 1.0
+0.500000 1.0 1.0 = material texture material
+-1 vertex material 0.500000 anim 0.500000 texture texture
+texture vertex
+vertex
+bone = anim
+bone = texture frame
+vertex bone 0.500000
+vertex frame bone -1 =
+material 1.0 bone frame
+texture = anim
+0.500000 frame vertex anim vertex texture anim
+frame material 1.0 0.500000
+0.500000 -1 anim 1.0
+anim
+1.0 frame 1.0 -1 vertex bone vertex 0.500000 texture
+1.0 textu
\ No newline at end of file
@@ -0,0 +1,137 @@
+= frame -1 texture frame bone vertex -1 bone frame
+anim -1 -1 0.500000 vertex
+0.500000 material frame
+bone frame 1.0
+-1 1.0 material
+-1 material bone 0.500000 -1 1.0 material
+texture anim -1 vertex
+= vertex
+texture
+-1 bone 1.0 0.500000
+vertex
+frame
+1.0 anim
+texture -1 1.0 anim texture vertex
+anim -1 anim material material vertex 0.500000
+vertex anim
+= 1.0 frame vertex
+1.0 vertex
+frame
+0.500000 bone vertex
+-1
+1.0 anim vertex =
+0.500000 vertex bone anim -1 vertex frame
+material vertex = anim 0.500000 0.500000 -1
+vertex
+= bone texture vertex material 1.0 0.500000
+0.500000 material 1.0
+texture
+frame
+texture bone
+texture = -1 vertex vertex -1 anim 1.0
+anim material
+= bone frame -1 1.0 vertex anim vertex = vertex material vertex = anim texture frame 0.500000 vertex texture
+-1 anim material material bone 0.500000 -1 frame
+-1 anim
+texture
+bone bone bone material frame -1 frame anim 0.500000 material bone anim texture bone vertex bone =
+vertex texture 1.0 texture texture vertex
+vertex -1
+material
+anim vertex texture 1.0
+vertex anim 0.500000 anim 1.0 1.0
+1.0 frame
+1.0 anim -1 material
+1.0 vertex
+texture 1.0 anim material frame
+vertex
+= texture texture 1.0 0.500000 vertex -1 -1 -1 anim = bone
+texture
+bone -1 1.0
+material texture
+anim
+texture bone anim -1
+-1 = 1.0 bone 0.500000 material vertex
+material anim
+= = material bone vertex material
+texture 1.0
+anim 1.0 = 0.500000 = 1.0 texture
+0.500000 =
+anim 0.500000 bone material = bone -1 bone frame
+material
+vertex = 1.0
+frame -1
+1.0 bone bone -1 vertex
+bone
+vertex = bone texture vertex anim bone -1 0.500000 texture
+bone frame -1
+bone material = frame vertex texture anim vertex vertex = -1 texture texture material -1 = bone frame 1.0
+0.500000 -1 vertex vertex frame anim
+vertex texture frame anim bone anim = 0.500000 vertex -1 vertex
+texture material
+= material
+1.0 material -1
+anim = bone
+material frame material 0.500000 1.0
+texture material bone vertex = material
+frame texture
+texture material 0.500000 frame frame frame -1 frame bone bone 1.0 bone
+vertex frame anim
+bone
+material = texture material 1.0 bone
+= = material bone
+-1 =
+1.0 frame material -1
+texture
+frame 1.0 material 1.0 -1 =
+= 1.0 vertex anim anim anim 0.500000 frame 0.500000
+anim
+-1 0.500000 -1 texture 0.500000 -1
+frame
+material vertex 0.500000 frame
+frame material anim = bone
+1.0 material material frame anim = 0.500000 material texture = -1 texture
+-1
+material 1.0 -1 anim anim -1 bone vertex -1 material anim
+anim
+= 1.0
+vertex 0.500000 0.500000
+texture 1.0 frame material
+1.0 frame frame
+anim texture 0.500000 anim -1 1.0 0.500000
+1.0 vertex texture vertex bone
+material frame
+0.500000 material vertex anim texture material
+vertex bone bone frame 1.0 texture = texture
+= material material texture
+-1 texture -1 1.0 material -1 frame material 0.500000
+material
+=
+anim -1
+1.0 anim -1 1.0 frame 0.500000 0.500000 vertex anim bone frame vertex
+1.0 bone -1
+bone bone
+bone material material 0.500000 -1
+-1 = vertex anim material anim 1.0
+anim texture vertex
+1.0 anim bone
+frame
+bone
+frame 0.500000 0.500000 =
+material = material 1.0 texture -1 frame
+= 0.500000 vertex texture
+bone 1.0 material bone
+bone material frame
+frame vertex
+vertex vertex
+frame 1.0 frame =
+material vertex 0.500000 frame
+vertex
+1.0 frame
+material -1
+frame vertex texture 0.500000 1.0 vertex -1 0.500000
+material texture vertex vertex
+1.0
+frame anim -1 frame = -1 material
+anim =
+-1 bone anim a
\ No newline at end of file
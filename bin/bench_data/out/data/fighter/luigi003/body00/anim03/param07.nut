@@ -0,0 +1,17 @@
+vertex bone 1.0 vertex 0.500000 material bone
+vertex vertex texture
+material anim bone
+= anim = material 0.500000 1.0 material bone bone anim =
+anim
+anim
+frame vertex bone texture
+frame texture
+bone = 1.0
+anim
+0.500000
+anim 0.500000 texture -1 0.500000 -1 -1
+bone vertex
+anim vertex texture 0.500000 = bone anim anim material frame -1 0.500000
+bone bone
+material frame
+0.500000 = anim
\ No newline at end of file
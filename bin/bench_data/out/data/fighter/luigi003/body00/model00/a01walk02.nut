@@ -0,0 +1 @@
+P+bjvEPY@iu\p+
\ No newline at end of file
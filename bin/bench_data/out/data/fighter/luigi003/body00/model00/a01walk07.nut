@@ -0,0 +1,6 @@
+bone material
+vertex frame =
+frame
+texture =
+material
+1.0
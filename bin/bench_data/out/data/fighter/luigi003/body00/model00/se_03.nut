@@ -0,0 +1,5 @@
+bone frame anim
+vertex =
+frame anim 0.500000 1.0
+texture vertex
+frame frame 1.0 frame 1.0 -1 vertex vert
\ No newline at end of file
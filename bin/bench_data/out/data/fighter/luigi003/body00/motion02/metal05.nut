@@ -0,0 +1 @@
+texture 0.500000 frame bone bone bone
\ No newline at end of file
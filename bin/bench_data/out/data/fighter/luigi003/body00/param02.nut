@@ -0,0 +1,8 @@
+= -1
+bone 0.500000 texture texture material vertex anim anim frame
+= material 0.500000 texture anim vertex 1.0 = anim material 1.0 bone
+0.500000
+material
+frame frame
+= anim frame -1 1.0 1.0 0.500000
+=
\ No newline at end of file
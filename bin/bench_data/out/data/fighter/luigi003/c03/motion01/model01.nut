@@ -0,0 +1,20 @@
+frame texture anim =
+-1 anim material bone
+material
+=
+bone
+1.0 texture =
+1.0 -1 0.500000 texture 1.0
+=
+texture
+bone texture bone
+-1 frame vertex texture 1.0
+frame bone
+anim
+material
+-1
+texture
+1.0
+= 0.500000 anim 0.500000
+vertex vertex bone = 0.500000 -1
+frame -1 ver
\ No newline at end of file
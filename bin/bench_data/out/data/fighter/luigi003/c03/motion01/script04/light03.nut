@@ -0,0 +1,9 @@
+bone 0.500000 =
+frame vertex material 1.0
+1.0 bone 0.500000 anim -1 1.0 1.0
+1.0
+= 1.0 1.0 frame frame bone frame
+anim 0.500000 1.0 anim
+bone texture 1.0 -1
+1.0 material
+vertex texture 
\ No newline at end of file
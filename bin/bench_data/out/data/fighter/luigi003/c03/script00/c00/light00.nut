@@ -0,0 +1,16 @@
+material -1 anim
+texture -1 anim material
+-1 anim
+= texture
+anim
+anim
+anim anim 0.500000
+= 0.500000 bone = vertex =
+vertex bone = bone 0.500000 1.0 material -1 vertex
+bone 1.0 1.0 material 0.500000 1.0 bone = anim vertex
+bone 1.0 bone texture
+material 1.0 0.500000 frame bone anim
+= frame -1 = frame 0.500000 frame 0.500000 material = bone
+anim
+anim -1 vertex anim -1 -1 =
+0
\ No newline at end of file
@@ -0,0 +1,159 @@
+1.0 1.0 bone frame anim 1.0 = anim
+material bone
+-1
+texture
+anim vertex
+= 1.0
+texture anim =
+1.0
+-1 material bone frame 1.0 anim = anim
+vertex material
+-1 = -1 0.500000 anim
+material 1.0 frame
+texture 1.0 bone 0.500000
+texture bone 0.500000 = 0.500000 frame
+frame frame -1 anim material
+-1 vertex material
+anim texture bone
+1.0 = material texture texture
+bone anim anim anim
+frame frame
+frame 1.0 0.500000 bone
+texture texture 0.500000 frame vertex material vertex
+=
+0.500000 material
+texture
+texture anim 1.0
+texture vertex material 1.0
+0.500000 material -1
+= frame
+texture 0.500000 0.500000 -1 anim texture
+bone bone = bone bone -1 0.500000
+0.500000 texture 1.0 0.500000 = anim anim 1.0 texture -1
+bone -1 frame -1 0.500000
+material
+=
+texture
+anim -1
+material frame bone -1 texture vertex 0.500000 = anim
+texture material texture anim texture
+bone bone bone texture anim material
+texture -1
+texture
+texture texture
+vertex 0.500000 bone =
+frame vertex
+texture bone = =
+0.500000
+anim
+frame
+material bone -1 1.0 = texture = bone =
+frame
+1.0 anim 1.0 -1 material 0.500000 vertex bone anim
+-1 anim material vertex -1 =
+anim 0.500000 1.0 frame
+-1 bone 0.500000 0.500000 1.0 texture
+bone 0.500000
+vertex =
+material
+=
+-1 anim
+0.500000 0.500000 bone vertex texture
+texture 1.0 bone vertex vertex
+texture texture
+= vertex texture
+0.500000 vertex =
+= = 1.0
+-1
+-1 anim
+bone frame anim -1 0.500000 material 0.500000 vertex
+bone vertex frame frame
+texture bone vertex 0.500000 -1
+vertex bone -1 = bone vertex
+vertex
+vertex frame frame -1
+-1 0.500000 vertex 1.0
+vertex 0.500000 0.500000 anim
+bone -1 frame anim texture frame 0.500000 material material anim frame texture
+bone frame 0.500000 bone vertex bone -1 1.0 -1 bone = bone
+vertex frame 0.500000 0.500000 vertex 0.500000
+material
+bone
+frame frame = frame anim 0.500000 bone
+= frame 1.0 material bone bone 0.500000 1.0
+anim vertex 1.0 0.500000
+frame
+vertex
+material -1 1.0 = anim
+= -1 texture texture vertex anim
+anim frame frame material =
+1.0 -1 frame vertex vertex
+bone
+material -1
+-1 texture 0.500000 bone = texture frame vertex frame 1.0 vertex frame 1.0 1.0
+material 1.0 anim bone
+vertex texture
+vertex material material vertex -1
+bone frame
+vertex
+frame
+material
+vertex texture -1 texture
+texture
+material vertex anim 1.0 0.500000 texture = bone 0.500000 vertex material 1.0 bone 0.500000 texture vertex 0.500000 frame
+frame bone 0.500000 = 1.0 1.0
+= =
+vertex frame
+material = frame anim anim frame material -1 = material
+material
+anim = 0.500000 texture material
+anim bone = anim
+anim
+anim material 1.0 vertex 0.500000 = texture 0.500000 1.0 material 0.500000 = = 1.0 0.500000 1.0 texture texture 1.0
+frame
+bone vertex material
+material anim texture
+anim 1.0 anim 1.0 frame 0.500000 texture material texture frame bone 0.500000 anim -1 0.500000 frame -1 bone = =
+material material vertex 1.0
+1.0 texture material vertex
+material 0.500000 0.500000 1.0
+= vertex
+0.500000
+material anim
+0.500000 frame anim vertex
+1.0 1.0 0.500000 -1
+vertex
+1.0 -1
+texture anim frame frame texture material
+0.500000 0.500000 anim texture 0.500000
+vertex
+-1 bone vertex texture vertex anim
+texture
+0.500000 material
+texture texture
+anim
+frame 0.500000 frame 0.500000 material
+material =
+frame
+-1
+anim frame texture
+0.500000 0.500000
+texture anim = -1
+frame vertex frame = vertex 0.500000 frame bone = =
+-1 texture
+1.0 = =
+anim material = -1 texture bone vertex
+vertex -1 bone material vertex 1.0 material bone vertex = material vertex
+= 1.0 -1
+frame anim 1.0 vertex
+-1 frame
+texture frame -1 = frame material
+bone -1 0.500000
+material
+vertex
+anim -1
+-1 frame texture anim
+-1
+texture -1 0.500000 material anim frame
+bone frame frame frame material
+bone bone mat
\ No newline at end of file
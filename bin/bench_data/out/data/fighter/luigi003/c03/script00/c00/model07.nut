@@ -0,0 +1,3 @@
+anim texture vertex material anim
+bone anim
+texture
@@ -0,0 +1,263 @@
+1.0 = 1.0 -1 -1 anim frame texture anim -1
+anim vertex 1.0 = 0.500000 texture -1 =
+frame frame 1.0 = material material 0.500000
+texture
+anim
+bone anim frame texture
+frame texture material -1 anim
+material vertex -1
+= =
+=
+bone 0.500000 0.500000 vertex vertex
+vertex texture
+texture material bone
+1.0 frame
+= 0.500000 texture 1.0 frame -1 1.0
+texture bone 1.0 frame vertex = -1
+= -1 frame = anim bone
+= bone bone frame texture anim = vertex frame
+bone texture vertex = material anim 1.0 1.0
+1.0 = = bone vertex bone 0.500000 bone frame texture frame
+texture material
+0.500000 bone 0.500000 bone 0.500000 -1 1.0 frame bone = bone
+-1
+1.0 0.500000 anim frame
+1.0 vertex
+frame
+material
+material frame texture
+= frame
+texture
+-1 1.0 0.500000 texture anim
+1.0
+1.0 bone vertex
+0.500000
+texture bone
+0.500000 anim material =
+anim texture -1 =
+anim bone vertex anim
+texture = 0.500000 frame
+anim = bone -1 -1 anim frame = frame texture anim
+0.500000 = frame anim frame 1.0 = frame frame -1 frame material anim vertex texture material bone
+0.500000 material vertex
+-1 0.500000 0.500000 bone
+frame vertex -1 -1
+texture
+texture bone frame -1
+material texture frame anim
+0.500000
+bone
+0.500000 bone vertex -1 -1 1.0 texture -1
+frame material 0.500000 = frame
+bone 0.500000
+-1 material frame material bone 0.500000 =
+anim material
+1.0 0.500000 material =
+vertex
+texture bone
+vertex
+0.500000 anim
+-1 bone vertex
+frame frame texture -1 0.500000 material anim
+material anim bone
+-1 = frame
+anim texture bone anim frame material vertex frame 1.0
+-1 frame = bone vertex frame
+0.500000 vertex 0.500000 = anim vertex texture -1 1.0 anim anim
+0.500000 0.500000 frame -1 1.0 anim texture 1.0
+1.0 texture
+-1 anim -1 bone
+1.0 = -1
+bone
+-1 anim
+bone vertex
+texture 0.500000
+vertex texture material bone 0.500000 texture = = -1 0.500000 frame 1.0 texture =
+0.500000 texture
+1.0 texture
+-1 texture
+anim 1.0 material vertex frame frame 1.0 anim
+1.0
+material -1
+=
+0.500000
+anim bone
+0.500000 0.500000
+-1 frame material
+0.500000 1.0 vertex 0.500000 texture bone anim
+0.500000 anim frame anim vertex 1.0 1.0 material material material anim frame vertex material
+vertex =
+material = vertex = vertex
+anim anim bone
+-1 1.0 = material texture material
+0.500000 frame
+texture 1.0 1.0
+= 1.0 = frame 1.0
+frame = vertex -1 texture anim
+= 1.0 -1 frame vertex
+1.0
+bone frame texture 1.0 vertex bone = texture material 1.0 anim bone texture 1.0
+texture anim texture bone texture vertex
+1.0 0.500000 frame
+0.500000 material
+vertex bone
+0.500000 0.500000
+0.500000 frame frame vertex = frame
+= = -1 = bone material
+frame 1.0 1.0 anim vertex 0.500000 frame
+-1 vertex 1.0 -1
+0.500000 frame material 1.0 -1 vertex anim
+1.0 vertex 1.0 texture 1.0
+0.500000 bone anim frame 1.0 bone frame
+texture frame frame frame bone bone 0.500000 frame vertex bone bone
+vertex 1.0 0.500000 frame frame bone bone texture material -1
+-1 vertex vertex anim -1
+1.0 material texture
+texture frame anim bone 1.0 frame frame
+0.500000 = 0.500000
+material texture
+vertex
+anim anim texture
+= = bone -1
+texture texture
+bone vertex
+bone
+anim material 1.0 material =
+bone -1
+texture
+anim
+frame = = bone material = anim
+frame
+1.0
+bone = anim -1 anim texture bone
+-1 material
+texture = 1.0 anim material = material 0.500000 texture vertex material texture texture 0.500000 material
+vertex 1.0 bone frame frame
+vertex
+vertex 0.500000 -1
+texture
+0.500000 vertex
+= vertex frame = -1 0.500000 = 0.500000 texture
+material
+vertex -1 frame
+-1 material texture
+= vertex material frame material texture -1
+vertex anim material material
+texture
+anim 0.500000
+frame texture
+frame vertex material material 0.500000 = texture
+anim -1 vertex
+texture 1.0 anim bone = anim -1 = material 1.0 = anim anim
+frame 0.500000 0.500000 1.0
+anim
+material
+frame
+frame 0.500000 bone 1.0
+-1 vertex anim anim texture =
+anim frame texture
+texture
+-1 material material
+material anim 0.500000 anim -1 = = 0.500000 vertex anim material -1 frame frame vertex anim texture anim
+texture frame frame 0.500000 vertex 0.500000 = = 0.500000 1.0 1.0 = 1.0
+texture vertex
+1.0 -1
+frame
+texture
+anim texture material
+material
+material -1 1.0 bone material
+1.0 -1 0.500000 vertex bone bone =
+1.0
+0.500000 texture -1 texture
+texture
+1.0
+frame texture vertex frame
+vertex 0.500000 anim vertex texture texture anim material 0.500000 vertex 0.500000 -1 vertex
+1.0
+material vertex
+texture vertex vertex
+= anim material material -1
+anim texture bone material 1.0 0.500000
+frame 1.0 frame frame 0.500000 vertex texture frame 0.500000 -1 0.500000 frame texture anim anim material anim texture anim = bone =
+frame frame
+material
+frame anim
+bone
+frame -1 bone -1 frame 0.500000 frame
+1.0
+= -1 = vertex
+0.500000 0.500000 vertex texture material vertex bone material =
+-1 frame
+-1
+-1 vertex material bone frame
+material frame 1.0 frame -1 texture = frame texture -1 frame 1.0 anim material 1.0 0.500000 anim 1.0 material material anim anim 1.0
+bone frame
+bone bone anim
+texture 1.0
+anim
+1.0 =
+material
+bone 0.500000 = -1 vertex bone frame texture frame
+texture texture frame 0.500000 -1 material -1
+vertex -1
+0.500000 0.500000 texture
+1.0
+-1 0.500000 vertex texture -1 bone vertex
+material =
+vertex
+-1 1.0
+vertex 0.500000 frame 0.500000 1.0 = 1.0 = = texture material
+-1 anim anim 0.500000 texture
+1.0 = texture material -1 vertex 1.0 material 0.500000 1.0 frame frame material texture material anim
+bone 0.500000
+1.0 bone texture = vertex vertex material frame -1 bone
+frame -1 bone =
+anim
+vertex -1 frame frame
+material vertex
+= 0.500000
+1.0
+= 1.0 bone
+anim 0.500000 = anim bone
+texture vertex
+1.0 frame = bone 0.500000 bone
+texture vertex
+0.500000 texture = frame = bone material bone texture = bone = vertex =
+0.500000 vertex material = texture frame = anim anim
+texture
+= material bone = 0.500000
+-1 = anim 1.0 material
+= 0.500000 bone
+anim 0.500000 bone anim 1.0 1.0 vertex
+-1
+0.500000 bone
+material 0.500000 -1 anim vertex
+bone 1.0 frame material
+bone
+bone frame
+vertex
+= vertex 1.0
+material anim
+vertex -1 bone
+= 0.500000 = material
+0.500000 vertex
+texture
+-1 anim 0.500000
+= 1.0 anim =
+0.500000 vertex frame
+vertex bone
+material
+material texture vertex frame
+-1 = -1 vertex -1 1.0 0.500000
+vertex -1 1.0 texture texture
+= vertex bone vertex = -1 material anim 1.0 0.500000 -1
+1.0
+vertex
+bone
+bone material
+0.500000 anim frame bone
+-1 vertex
+material 1.0 = material
+frame frame
+0.500000 vertex vertex text
\ No newline at end of file
@@ -0,0 +1,71 @@
+texture anim material
+texture 0.500000 vertex
+= bone material anim 1.0
+vertex -1 -1 1.0 anim -1 = texture texture vertex
+material frame texture frame
+-1 texture -1
+vertex 1.0 anim
+bone texture
+-1 anim
+0.500000 bone
+anim texture
+= frame anim -1 vertex frame vertex
+material material
+material anim
+= material
+0.500000 -1
+bone = -1 frame
+-1 0.500000 1.0 bone
+anim
+frame frame = -1 = 0.500000 1.0
+material
+anim vertex = 1.0
+-1
+1.0 = -1
+anim bone 1.0 0.500000 = anim
+1.0
+=
+vertex -1 bone 0.500000 vertex = -1 frame
+0.500000
+bone 0.500000
+texture 0.500000 frame -1 vertex 1.0 frame -1 -1
+0.500000
+anim
+-1
+vertex
+frame anim material
+texture = 1.0
+1.0 texture vertex bone =
+0.500000
+material -1 = anim
+= 0.500000 1.0
+frame
+vertex
+0.500000 vertex bone
+1.0 = material bone =
+vertex -1
+bone bone 0.500000 1.0 texture bone 0.500000
+0.500000 = anim = 0.500000 vertex material 1.0 frame material bone = frame 1.0 texture bone material
+=
+-1 texture
+vertex texture
+0.500000 vertex -1 -1 material material anim bone =
+anim vertex anim
+1.0
+texture material -1
+-1 texture material
+vertex
+texture
+frame
+bone material
+bone 0.500000
+texture bone texture frame material material
+0.500000 material
+material
+0.500000 bone material 1.0 frame anim frame =
+material = vertex = anim bone
+texture
+1.0 1.0
+1.0 1.0 anim
+-1 anim -1
+anim 1.0 vertex material = anim -1 = material vertex texture 0.500000 1.0 texture vertex t
\ No newline at end of file
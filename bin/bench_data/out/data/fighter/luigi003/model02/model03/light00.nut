@@ -0,0 +1,41 @@
+texture vertex
+bone =
+1.0 material
+material 0.500000
+vertex -1 = = texture vertex
+vertex
+0.500000 -1
+texture 0.500000 -1 0.500000
+texture frame -1 material = bone material 0.500000 =
+vertex anim material material frame -1 frame bone bone frame 0.500000 -1 0.500000 frame
+1.0 frame texture
+frame vertex
+vertex = anim -1 -1
+anim anim = anim
+texture bone = bone = 1.0 = material =
+texture -1 texture 1.0 vertex
+bone
+0.500000 vertex anim
+vertex frame
+vertex bone vertex -1 = = bone 1.0 material =
+frame 1.0 bone
+texture vertex
+0.500000 texture texture vertex
+= texture vertex material texture -1 1.0 0.500000 1.0 =
+bone 0.500000 1.0 frame
+frame 1.0 0.500000 -1 texture
+anim =
+anim = material bone
+1.0
+vertex
+anim
+material
+-1 frame bone material frame 1.0 material
+vertex
+anim -1 1.0 material anim
+frame
+bone 1.0 material bone = texture vertex 0.500000 0.500000 anim
+bone vertex texture
+texture bone anim -1
+texture
+bone texture bone material
\ No newline at end of file
@@ -0,0 +1,5 @@
+material
+= texture 0.500000 0.500000
+anim material material bone 0.500000
+bone anim
+an
\ No newline at end of file
@@ -0,0 +1,10 @@
+bone = bone = vertex 1.0
+material anim 1.0
+= texture =
+vertex vertex =
+-1 material material
+texture -1 bone material 0.500000
+bone
+= 1.0 bone anim = anim
+material bone
+bone 
\ No newline at end of file
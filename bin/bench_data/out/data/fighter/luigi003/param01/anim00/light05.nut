@@ -0,0 +1,21 @@
+= anim
+texture = texture
+anim
+=
+anim frame bone
+1.0
+frame material -1
+material
+1.0 bone anim 1.0
+material texture bone
+vertex anim vertex material anim texture
+vertex frame bone 0.500000
+frame -1 material
+vertex vertex
+0.500000
+vertex -1 1.0 1.0 texture
+frame
+frame 1.0 anim
+-1
+0.500000 frame
+-1 texture vertex bone 0.
\ No newline at end of file
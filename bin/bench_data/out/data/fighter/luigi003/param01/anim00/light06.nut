@@ -0,0 +1,114 @@
+bone bone -1
+anim material material bone -1 material
+bone = anim vertex vertex
+-1 frame material
+-1 -1 -1 1.0 anim =
+texture frame
+0.500000 0.500000
+-1
+vertex 1.0 frame
+frame frame 0.500000 frame frame texture texture bone anim
+bone
+1.0 0.500000 1.0 texture
+-1
+anim
+0.500000 texture
+-1 1.0 = anim texture vertex
+= = frame vertex -1
+1.0 0.500000 -1 material 0.500000
+= material = 1.0 -1
+anim =
+0.500000 = texture
+-1 bone vertex 0.500000
+texture = material
+frame = =
+bone vertex frame = frame -1 anim vertex 0.500000
+material texture texture vertex 1.0 bone
+bone frame frame 1.0 1.0 texture
+1.0 vertex frame texture frame texture 0.500000
+material
+frame anim vertex anim vertex frame
+1.0 frame 0.500000 0.500000
+vertex frame frame material texture material 0.500000
+vertex bone
+vertex = =
+-1 =
+1.0 anim material 1.0 vertex
+bone 1.0
+=
+texture frame
+= bone 1.0 frame 0.500000 bone 0.500000
+-1 bone
+1.0 texture anim
+vertex = 1.0
+frame frame vertex
+= frame bone 1.0 vertex
+1.0 0.500000 texture vertex
+=
+0.500000 bone anim = 1.0
+material frame
+material texture
+-1
+0.500000 -1
+= = frame -1
+-1 vertex bone material anim
+bone 0.500000 bone vertex material vertex -1 frame 0.500000 0.500000 = 1.0 -1 vertex material
+=
+vertex
+material
+0.500000
+1.0
+vertex frame frame bone anim anim
+= 0.500000 vertex 0.500000
+= bone vertex bone texture anim
+texture
+1.0 = -1
+-1 material material -1 anim
+texture bone material 1.0 vertex
+1.0
+texture bone 1.0 1.0 = = vertex
+-1 vertex
+0.500000
+texture
+= bone 0.500000 texture
+material anim vertex vertex = material texture
+1.0 0.500000 frame
+texture frame -1
+material
+material
+material
+anim 1.0 texture frame vertex anim 1.0 texture
+1.0
+frame -1
+= frame texture texture frame bone 0.500000
+bone 1.0 -1 frame material anim
+1.0 material -1 bone material vertex 1.0 frame = texture =
+1.0 bone anim vertex 0.500000 frame
+bone
+vertex
+0.500000 material anim vertex
+anim material
+anim
+material
+anim material anim
+anim
+material -1 = 0.500000 1.0
+bone = texture -1
+= vertex
+= anim frame material frame bone
+material anim
+bone 0.500000
+-1 bone texture frame
+anim -1
+1.0 frame vertex 1.0 anim bone texture material frame bone frame 1.0 frame
+bone texture texture
+= = frame texture -1
+vertex 0.500000
+vertex anim material 0.500000 frame
+= vertex anim frame
+0.500000 1.0 vertex 0.500000 =
+vertex material
+vertex
+-1
+= bone 0.500000
+= bone bon
\ No newline at end of file
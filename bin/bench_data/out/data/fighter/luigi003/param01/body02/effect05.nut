@@ -0,0 +1,203 @@
+=
+texture -1 vertex frame 1.0
+1.0 0.500000 frame frame material 1.0
+1.0 anim = material -1 -1 anim -1 bone texture bone material -1
+frame vertex frame material = anim
+1.0 0.500000 -1 bone
+-1 frame frame
+bone
+1.0 vertex vertex bone texture
+bone
+frame 1.0 1.0 texture 0.500000 0.500000 frame vertex frame bone -1 0.500000 frame anim anim
+1.0 0.500000 1.0
+material frame vertex texture material 0.500000 anim bone -1 texture -1 -1 anim vertex bone texture -1 frame 1.0
+bone 0.500000 0.500000 texture material
+frame -1 vertex bone
+-1 1.0
+frame 0.500000 1.0 = -1 bone 1.0 vertex frame anim 1.0 material bone -1 1.0 0.500000 vertex -1 -1
+anim 1.0 bone
+=
+texture bone -1 = texture = -1
+material texture texture material texture 1.0 = anim frame frame frame material
+texture material frame anim
+bone frame = -1 anim =
+0.500000 bone material material
+1.0 material
+1.0
+texture
+1.0 bone bone
+vertex 1.0 bone material
+material texture frame -1 0.500000 anim =
+texture material bone =
+bone 0.500000 frame frame
+anim texture = vertex
+1.0 0.500000 =
+1.0 anim -1 1.0
+material texture vertex
+material -1 bone -1 bone frame vertex
+bone frame bone
+-1
+= vertex 1.0
+frame vertex material frame frame texture =
+material texture 1.0 bone
+1.0 bone = texture -1 material
+texture = 1.0 =
+frame = material vertex frame texture 0.500000 0.500000 material
+material 1.0 vertex vertex = vertex = 0.500000 frame
+1.0
+anim 1.0 -1
+bone
+frame = vertex -1 bone texture
+= vertex
+material 0.500000 0.500000 0.500000 = anim 1.0 1.0 anim 0.500000 anim = anim vertex = vertex 0.500000
+material = texture frame anim -1 frame 1.0
+1.0
+material 1.0 -1
+1.0 0.500000
+0.500000 anim material -1 0.500000 = 1.0
+texture
+frame texture -1 = = texture = bone texture = 0.500000 anim vertex
+-1 0.500000 0.500000 frame
+vertex -1
+bone material texture anim
+frame vertex
+vertex
+texture
+material vertex 1.0 bone
+frame material 0.500000 texture material = material 0.500000 anim
+0.500000 bone anim material vertex 1.0 vertex = -1 texture bone 1.0 = frame material
+anim frame
+frame 0.500000 material 0.500000 material texture material
+1.0 texture bone -1 0.500000 frame = vertex anim material -1 0.500000 -1 -1 material material anim bone
+bone anim = anim
+0.500000 bone material
+frame material frame frame material anim anim 0.500000 texture texture = -1 -1 -1 bone 0.500000 bone anim 0.500000 vertex texture 1.0 bone 0.500000 material
+anim vertex
+vertex 1.0 1.0 anim anim anim bone
+= frame vertex vertex material frame material vertex vertex vertex
+1.0
+vertex
+1.0 =
+bone
+anim
+texture anim
+1.0 1.0 1.0 -1
+0.500000 vertex vertex vertex
+anim
+vertex frame
+= material
+1.0 frame material -1 -1 texture frame anim material bone
+anim
+texture anim
+texture bone
+0.500000 anim texture texture
+bone
+= -1
+frame 1.0 anim texture material 1.0 anim anim vertex
+= =
+1.0
+1.0 vertex material frame =
+0.500000
+vertex material -1 material -1 -1
+frame
+frame vertex =
+0.500000 = anim material
+frame
+0.500000 =
+1.0 anim 1.0
+-1 frame texture -1
+texture material texture
+0.500000 texture 1.0 1.0 frame -1
+= 0.500000 0.500000 texture bone vertex = vertex 1.0 vertex
+anim material
+vertex
+0.500000
+vertex 0.500000 -1
+1.0 0.500000 1.0 -1
+1.0
+= -1 material = 0.500000 =
+-1 anim bone bone -1 1.0 vertex 0.500000
+frame texture anim vertex 0.500000 1.0 frame
+-1
+bone
+= texture 0.500000
+bone texture bone -1 bone anim frame texture =
+anim = bone
+= bone vertex frame anim vertex
+0.500000
+vertex 0.500000
+material anim vertex
+-1 1.0
+= 0.500000 -1 texture 1.0 frame 1.0
+-1 frame frame bone
+-1 vertex material -1 anim -1
+material vertex frame
+frame vertex 1.0 1.0 material 1.0
+anim 0.500000 frame
+= -1 frame texture texture
+bone material anim material = frame
+frame 0.500000 -1
+bone texture frame 1.0
+0.500000 vertex frame -1
+bone 1.0
+texture
+vertex frame
+0.500000
+anim
+1.0 texture material 0.500000 frame
+bone
+0.500000
+-1 = -1 1.0 material vertex
+-1 bone 0.500000
+=
+anim 0.500000 anim =
+0.500000 =
+0.500000 frame texture vertex = vertex = anim 0.500000 vertex -1 0.500000 1.0
+texture 0.500000 1.0 bone
+material frame = 0.500000
+vertex 0.500000
+bone 0.500000 anim 1.0
+=
+texture material
+vertex 0.500000
+bone
+= = anim
+bone
+texture
+0.500000
+material = frame -1 bone texture anim = texture
+anim frame
+anim =
+material = texture anim 0.500000 0.500000 frame anim bone anim = anim
+bone bone frame vertex
+0.500000 1.0 frame bone frame vertex = vertex
+frame 0.500000 anim anim
+frame bone bone texture 1.0 frame -1
+0.500000
+-1 = frame
+-1 1.0 -1 0.500000 = frame
+frame vertex
+= material 1.0 frame = =
+material -1
+bone -1 = -1 = vertex anim 0.500000 bone anim
+frame anim bone bone
+bone anim
+bone
+texture = bone
+=
+0.500000 0.500000
+vertex
+= material 0.500000 material 0.500000 1.0 -1
+material bone anim texture 0.500000
+frame -1 material texture
+1.0 frame material material texture anim 0.500000 0.500000 anim bone bone 1.0 texture 1.0 frame texture
+texture
+= anim 0.500000
+frame =
+= frame 1.0 texture = -1 1.0
+material
+1.0 texture
+bone
+frame 0.500000
+bone vertex 0.500000 0.500000
+1.0 
\ No newline at end of file
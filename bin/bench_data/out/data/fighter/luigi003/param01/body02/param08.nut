@@ -0,0 +1,4 @@
+-1 = 0.500000 1.0 frame texture material 0.500000 texture material bone
+bone 1.0
+anim anim frame frame =
+-1 = frame fra
\ No newline at end of file
@@ -0,0 +1,5 @@
+texture
+1.0 0.500000
+texture = texture texture material 1.0 frame vertex vertex
+bone -1 -1
+frame material 0.500000 material 1
\ No newline at end of file
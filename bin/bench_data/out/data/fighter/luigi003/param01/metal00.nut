@@ -0,0 +1,18 @@
+material 1.0 texture frame material vertex -1 material
+1.0 -1
+-1 bone bone bone frame material frame
+material anim 1.0
+0.500000
+-1
+0.500000 vertex frame frame
+material
+anim 0.500000 =
+anim
+vertex
+= -1
+frame 1.0 1.0 0.500000 frame -1
+texture
+material texture vertex = = bone 1.0 = frame texture bone vertex texture frame texture 0.500000 0.500000 anim
+-1
+vertex frame 0.500000
+bone bon
\ No newline at end of file
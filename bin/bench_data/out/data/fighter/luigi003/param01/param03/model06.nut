@@ -0,0 +1,2 @@
+1.0 0.500000 anim texture
+0.5000
\ No newline at end of file
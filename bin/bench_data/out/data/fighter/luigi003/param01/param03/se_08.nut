@@ -0,0 +1,328 @@
+vertex = bone 0.500000
+-1 vertex 1.0 -1 = = bone -1
+texture -1 texture 0.500000
+0.500000 0.500000 frame vertex 1.0 -1 texture
+vertex 0.500000
+texture = material
+bone
+anim vertex bone 1.0 vertex anim 1.0 1.0 material 0.500000 vertex 0.500000 texture 0.500000 anim
+texture -1 -1 frame material material 0.500000 anim vertex anim
+= frame material frame
+= anim = -1
+vertex frame anim anim
+bone
+vertex material
+material bone texture = 1.0 texture frame =
+vertex 1.0 =
+anim 1.0 = 0.500000 vertex
+vertex frame -1 texture
+material
+-1 frame bone
+-1 bone bone vertex = frame = 1.0
+material -1 texture texture material
+vertex anim bone material material material 1.0
+material material
+-1 anim
+1.0 bone
+= = 0.500000 anim material
+0.500000 0.500000 texture frame
+-1 = = vertex texture
+texture
+anim 1.0 = = = 1.0 anim vertex
+-1 1.0
+frame material material texture vertex
+texture
+frame anim anim frame bone
+bone
+0.500000
+frame = texture -1 0.500000 texture =
+1.0
+1.0 material
+vertex anim bone material frame material
+anim
+vertex frame vertex
+anim anim =
+0.500000
+texture
+material material material vertex
+bone material texture = = = 0.500000 vertex vertex anim
+material -1
+bone 1.0 0.500000
+anim texture
+-1 frame = material anim 0.500000 texture bone 1.0 vertex frame -1 bone texture material anim material vertex material 1.0
+texture frame 0.500000 vertex -1 vertex 1.0 texture material anim = material vertex
+anim material
+0.500000
+-1
+1.0 anim
+= anim vertex texture frame texture 0.500000
+0.500000 bone 1.0 material material
+= -1 -1
+0.500000
+material bone material
+= frame anim 1.0
+1.0 material -1 0.500000
+vertex
+anim -1 vertex
+frame anim
+frame anim
+texture -1 0.500000 bone vertex
+-1 -1 vertex 1.0
+1.0 texture 0.500000 1.0 anim = =
+bone 1.0 texture vertex
+bone 1.0 = bone bone anim anim
+1.0 0.500000 = bone texture material 1.0 vertex
+vertex = -1
+bone bone
+-1 bone
+material vertex
+0.500000 = 1.0 bone texture 1.0 -1 anim
+0.500000 -1 vertex =
+1.0 0.500000 0.500000
+anim anim
+-1 = frame frame =
+anim
+0.500000 1.0
+bone
+texture -1 anim frame = = bone
+material
+0.500000
+-1
+bone anim anim -1
+= material material 1.0
+= material
+=
+frame bone texture vertex 1.0 0.500000 vertex
+0.500000 anim
+vertex
+-1 0.500000 anim bone bone -1 frame = vertex bone
+0.500000 0.500000 vertex 0.500000 0.500000 0.500000 -1 1.0
+texture anim vertex
+anim vertex = 1.0 anim texture -1 1.0 texture bone frame =
+1.0 bone material
+frame = bone texture 0.500000 = material
+bone frame
+0.500000 anim bone anim = material
+1.0 0.500000 texture 0.500000 bone material = 0.500000 1.0 material anim vertex
+0.500000 = frame
+0.500000 anim = anim anim = material
+1.0 1.0
+bone -1 -1 0.500000 anim =
+texture 0.500000 bone vertex
+= frame
+frame -1 texture anim anim 1.0 texture material =
+anim vertex anim 0.500000 frame texture texture = 1.0 texture anim material 1.0 -1
+anim anim
+bone
+0.500000 = material
+material 1.0 bone
+frame -1
+frame 1.0 -1
+anim
+frame anim = material -1
+0.500000 anim texture
+texture = =
+material frame
+= anim bone material
+frame vertex 0.500000 vertex 1.0 1.0 material -1 frame material anim bone vertex frame anim
+vertex = bone vertex
+-1 anim -1 material vertex anim material = 1.0
+= frame = = vertex material -1 0.500000 material
+vertex -1 frame
+texture material
+-1 vertex 1.0 0.500000 = vertex anim = 1.0 0.500000 = bone bone anim 0.500000 texture anim anim bone frame 1.0 anim
+texture vertex texture = 0.500000 1.0 vertex frame -1 frame
+texture 0.500000
+-1 texture -1 frame texture texture vertex material
+-1 -1 1.0 -1 bone 1.0
+anim
+material texture 1.0
+0.500000 0.500000 anim anim frame vertex texture 0.500000 1.0 0.500000 0.500000
+= material material =
+0.500000 anim = frame
+vertex 0.500000 frame bone =
+anim 0.500000
+texture
+vertex anim vertex = bone
+vertex
+material texture material 0.500000 frame
+anim texture
+frame =
+anim texture vertex material frame
+-1
+texture 1.0 frame
+1.0
+0.500000 -1 1.0
+material
+vertex texture 0.500000 1.0 -1
+texture 0.500000 0.500000 material anim texture frame -1
+frame 0.500000
+-1 bone = frame 0.500000 1.0 frame
+-1 1.0 anim 1.0 bone texture
+frame
+material 0.500000 texture = 0.500000 frame
+bone vertex 0.500000 material frame
+anim -1 0.500000 vertex frame vertex frame
+0.500000 bone frame = = material 1.0 1.0
+= texture texture
+anim
+-1
+vertex = = material bone frame texture
+frame texture
+texture 0.500000 vertex = =
+vertex
+material
+anim
+-1
+1.0
+= texture
+texture -1
+vertex 0.500000
+1.0 texture material 0.500000 texture
+vertex vertex frame vertex -1
+vertex
+frame -1 vertex -1 texture vertex bone texture
+material anim frame texture -1 1.0 =
+vertex vertex
+material frame
+0.500000 1.0 =
+frame vertex texture = 0.500000 material texture 1.0 0.500000 frame texture texture material vertex 1.0 frame = -1
+frame vertex
+frame material 1.0 vertex frame 0.500000 1.0 -1 0.500000 bone anim = texture texture
+= = vertex vertex vertex
+vertex material bone
+= 1.0 0.500000 0.500000 material 0.500000
+frame material bone =
+frame 0.500000 -1 anim
+= 1.0 -1
+vertex anim vertex texture texture
+1.0 =
+vertex -1 bone texture 0.500000 1.0
+frame
+0.500000 material frame
+texture vertex frame texture material material = = = material frame
+material bone
+bone texture 1.0 texture
+material bone = anim
+material frame anim material frame
+vertex material
+bone =
+vertex -1 -1 -1 anim texture = -1
+0.500000
+anim material bone 0.500000
+= -1 material vertex frame
+0.500000 =
+vertex texture 0.500000
+0.500000 1.0 material
+frame
+bone
+texture texture
+vertex material
+material
+frame 0.500000 material material material vertex -1 = texture bone texture anim
+material
+bone
+anim texture
+vertex bone
+texture 0.500000 anim frame vertex
+texture frame bone vertex vertex
+=
+anim 0.500000 vertex =
+1.0 material
+vertex 0.500000
+= texture bone
+1.0 texture
+-1 material
+vertex -1 texture 0.500000 1.0 0.500000 material
+texture material
+= 0.500000 0.500000 -1
+anim frame bone bone anim bone =
+= texture 0.500000
+= material
+= -1 vertex
+texture
+=
+bone
+texture
+1.0 anim material
+anim
+frame
+vertex -1 vertex -1 texture
+= 1.0
+vertex
+= anim
+0.500000 vertex -1
+1.0 frame texture bone =
+0.500000 1.0 -1 =
+= vertex -1
+1.0 frame bone 0.500000 -1 = material anim material
+= -1 1.0 1.0
+0.500000 bone 0.500000 =
+vertex
+anim frame 1.0 0.500000 1.0 material
+0.500000
+bone anim anim anim
+bone 0.500000 texture 1.0
+1.0 texture = vertex frame
+vertex 1.0
+anim 0.500000 vertex texture
+material material = material
+vertex texture material anim 1.0 material material vertex
+frame -1
+frame 0.500000 vertex
+material
+bone bone -1 anim -1
+anim material 0.500000 frame vertex frame
+vertex
+bone 0.500000 anim bone = bone
+1.0
+anim anim anim material texture anim
+texture
+frame
+bone
+0.500000 0.500000
+anim = 1.0
+frame material
+frame texture vertex 0.500000 bone -1
+frame frame = -1 bone texture
+1.0 0.500000 frame -1 = anim frame
+-1 vertex
+-1 vertex 0.500000 vertex material -1 0.500000 anim
+frame frame
+-1 frame 0.500000 anim =
+0.500000 frame vertex bone 1.0 = frame 0.500000
+0.500000 anim vertex texture
+vertex 0.500000
+bone material
+texture 0.500000 anim bone texture anim frame anim texture bone anim frame vertex vertex
+anim 1.0
+texture vertex texture 1.0 texture bone 0.500000 vertex texture frame bone
+texture -1 vertex anim bone frame 0.500000 material anim
+-1 texture -1
+bone material
+1.0 frame material 0.500000 0.500000 1.0 material
+vertex
+vertex bone frame 0.500000 bone -1 vertex 1.0 anim
+anim anim bone 1.0 material -1
+texture
+vertex = bone 0.500000
+vertex anim
+texture bone anim = bone frame bone frame frame 0.500000 material 1.0 frame bone bone
+-1
+frame -1 vertex material -1 texture -1 material frame anim texture material 1.0
+texture -1 0.500000
+vertex
+-1
+vertex
+1.0 texture frame
+vertex texture texture
+-1 texture
+vertex -1 0.500000 vertex 0.500000 texture vertex anim bone 1.0
+vertex
+material material -1 anim
+texture material -1 vertex
+material 0.500000 -1 1.0 anim vertex = frame 1.0
+anim vertex 0.500000 0.500000 texture =
+frame frame anim frame 0.500000 texture
+1.0 anim texture anim 0.500000 1.0 vertex anim =
+m
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame = anim
+bone bone anim bone vertex = anim
\ No newline at end of file
@@ -0,0 +1,53 @@
+1.0 =
+material
+=
+1.0 = 0.500000
+=
+anim material
+frame 0.500000 = 0.500000 material texture material
+1.0 1.0 texture
+0.500000
+0.500000 frame texture
+-1
+1.0 anim = anim vertex texture 0.500000 material
+vertex -1 frame
+bone texture -1 -1 -1
+anim
+-1 vertex = vertex frame 0.500000
+material vertex bone
+-1 1.0 anim frame =
+texture texture material anim texture
+0.500000 1.0
+anim 0.500000
+0.500000
+anim
+anim
+0.500000 1.0
+anim anim = material
+0.500000 texture
+vertex
+-1 vertex
+0.500000 anim texture texture anim 1.0
+vertex anim
+texture =
+texture 0.500000 vertex 0.500000 texture bone texture
+-1
+material 0.500000 = vertex bone 1.0
+-1 bone frame 1.0 1.0 texture 0.500000 texture 1.0 bone =
+= texture material =
+-1 anim
+texture material
+0.500000
+vertex anim
+material -1 texture texture material 1.0 material -1 material vertex
+-1 -1
+anim
+anim
+texture
+texture bone material bone vertex
+vertex frame anim
+= material = 1.0 texture texture vertex
+vertex 1.0 material
+0.500000
+-1 1.0 bone 0.500000 texture = 0.500000 0.500000 anim texture texture
+bone anim bone 1.0 bone
\ No newline at end of file
@@ -0,0 +1,42 @@
+vertex
+material anim vertex
+1.0
+material 1.0 1.0 vertex
+-1
+-1 = =
+vertex
+texture
+vertex bone 0.500000 0.500000 1.0
+= bone
+texture vertex
+-1 -1 0.500000 anim
+bone frame = 1.0 bone
+bone frame anim material 1.0 -1 bone -1 0.500000 1.0 0.500000 bone texture texture = material frame 1.0 vertex anim = =
+vertex 1.0
+material vertex -1 material 1.0 -1 bone = frame material = vertex -1 1.0 = bone =
+texture -1 anim vertex -1
+= bone 0.500000
+vertex = bone
+= 1.0
+vertex
+1.0 bone -1 1.0 frame 0.500000 anim 1.0 anim bone frame 0.500000 1.0 -1 1.0
+texture
+-1 material 0.500000 = =
+0.500000 =
+texture vertex bone
+anim material
+bone 1.0 texture -1 texture anim material 0.500000 material texture = anim -1
+frame =
+frame = bone
+material material
+frame
+frame vertex -1 frame
+bone = -1 texture 1.0 1.0
+anim material anim
+frame
+anim bone -1 0.500000 0.500000 = 1.0 bone -1
+-1
+frame = material frame 0.500000 =
+0.500000 1.0 texture 0.500000 0.500000
+bone bone
+1.0 ma
\ No newline at end of file
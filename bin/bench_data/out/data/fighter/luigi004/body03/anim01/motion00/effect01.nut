@@ -0,0 +1,12 @@
+anim anim 0.500000
+= = bone = 1.0 material 1.0
+frame
+anim vertex vertex bone
+frame bone 1.0
+vertex
+bone
+0.500000 1.0 material bone
+anim -1 0.500000 vertex material 1.0 -1
+= vertex anim frame vertex anim anim material
+0.500000 frame = anim vertex
+anim
\ No newline at end of file
@@ -0,0 +1,11 @@
+bone frame 1.0 -1 = bone material 1.0 anim anim
+material vertex material vertex texture texture bone anim
+= 1.0 vertex 1.0 = anim frame texture texture vertex 1.0
+bone vertex
+bone -1 material vertex anim anim
+= 0.500000 anim -1 frame
+0.500000 -1
+vertex frame material
+= anim bone material bone
+texture
+bone anim bone 1.0 0.500000 texture 1.0 -1 -1 texture
\ No newline at end of file
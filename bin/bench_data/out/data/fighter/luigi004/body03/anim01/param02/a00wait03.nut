@@ -0,0 +1,3 @@
+frame bone bone anim anim vertex anim
+=
+-1 -1
@@ -0,0 +1,3 @@
+1.0 vertex anim bone -1
+material 1.0 bone vertex 1.0 = texture vertex
+bone texture
\ No newline at end of file
@@ -0,0 +1,26 @@
+-1 =
+texture
+= 0.500000 anim material frame 1.0
+vertex
+vertex
+frame material 1.0
+frame =
+bone vertex -1
+-1
+texture material = -1 vertex
+vertex
+anim
+anim anim = texture vertex texture vertex bone material 1.0 0.500000 material vertex anim
+texture
+0.500000 0.500000 material vertex 0.500000 0.500000 bone vertex
+= = vertex 1.0 anim
+frame frame texture = material anim frame bone
+vertex texture frame material 1.0 texture
+= = = bone -1 anim -1 1.0 bone =
+bone material 0.500000 0.500000 texture = anim material bone = frame 0.500000 vertex 0.500000 material anim texture 0.500000 anim -1 1.0 texture material
+anim frame bone
+anim
+-1 texture 0.500000
+material vertex
+1.0 =
+vertex vertex 1.0 -1 anim 1.0 bone bone texture tex
\ No newline at end of file
@@ -0,0 +1,13 @@
+= frame
+anim = vertex 1.0
+vertex anim
+vertex vertex bone vertex 1.0 vertex -1 -1 frame texture = vertex
+= = vertex anim
+= 1.0 anim
+material
+-1 -1 bone texture 1.0 =
+0.500000
+1.0 =
+-1 1.0 texture vertex
+anim = = anim
+material 
\ No newline at end of file
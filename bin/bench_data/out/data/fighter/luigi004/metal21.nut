@@ -0,0 +1 @@
+.A-sH=ObP#8Kd˔?c۰S3^<ڈs[&;@K}(v¯3e\jlQ.!L殨E6F
\ No newline at end of file
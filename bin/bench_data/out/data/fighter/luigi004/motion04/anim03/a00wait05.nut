@@ -0,0 +1,34 @@
+bone = vertex
+0.500000 1.0 = material frame
+0.500000 frame
+1.0 1.0 anim bone =
+-1 anim frame frame bone 0.500000 frame = vertex frame 1.0
+anim 1.0 vertex vertex -1 material 1.0 -1 material texture material material
+anim -1 vertex bone anim -1 bone anim = 0.500000 -1 material -1
+-1 frame = =
+1.0 -1 vertex material texture frame vertex 0.500000 0.500000 material 0.500000 0.500000
+anim
+material = vertex vertex 1.0 frame
+vertex frame material anim -1 0.500000 texture anim frame frame vertex vertex frame
+material bone -1
+material 0.500000 texture bone =
+1.0 texture frame frame material 0.500000 =
+bone
+bone frame bone bone texture 1.0
+texture frame material bone anim texture
+= 1.0 1.0 texture anim
+0.500000 bone 1.0
+= -1
+= bone 1.0
+bone texture 1.0 0.500000 material anim vertex
+frame material -1 vertex frame anim material -1
+= frame -1 =
+anim anim bone 1.0
+= 1.0
+anim = texture 0.500000 texture -1 =
+material
+anim 0.500000 bone frame material material
+frame vertex 1.0 =
+bone
+0.500000 material
+a
\ No newline at end of file
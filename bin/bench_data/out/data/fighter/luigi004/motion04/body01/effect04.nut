@@ -0,0 +1,324 @@
+-1
+=
+0.500000
+bone -1
+texture
+texture
+vertex texture frame -1 material
+frame vertex 1.0 vertex
+bone = texture
+= anim anim 1.0 -1 anim texture
+texture
+frame texture anim
+0.500000 bone
+bone 1.0 0.500000 =
+0.500000 vertex = vertex 0.500000 material
+anim
+0.500000 material
+-1
+1.0
+anim anim material =
+0.500000 texture 1.0
+-1 anim vertex 1.0 1.0 0.500000 0.500000 anim vertex texture material material frame
+= 0.500000 1.0
+= material -1 anim
+material material 1.0
+frame
+= material 0.500000 -1 -1 0.500000
+frame
+0.500000
+1.0 bone bone vertex
+anim
+1.0
+frame
+bone frame 0.500000 material 1.0 frame -1 anim
+= frame 1.0
+anim anim
+vertex
+frame
+-1 0.500000 frame vertex frame anim
+= frame 1.0 texture material 1.0 1.0 anim anim 1.0 material =
+frame vertex vertex anim
+-1
+vertex
+0.500000 1.0
+material = = 1.0
+material vertex
+texture
+frame texture
+bone frame
+frame material bone texture 0.500000 frame bone bone
+anim anim -1
+frame -1
+frame = frame frame anim texture 0.500000 = texture
+0.500000 material frame bone vertex texture frame material anim vertex texture 1.0 material 1.0 0.500000 vertex
+frame bone texture
+bone
+= material bone -1
+bone
+vertex 0.500000 texture material texture material = bone texture 1.0 anim
+-1 bone = = material material
+bone
+0.500000
+texture -1 = anim -1 vertex
+anim material frame bone anim 1.0
+vertex
+frame material frame
+frame
+frame vertex vertex
+frame vertex 0.500000 anim
+anim
+vertex
+vertex = -1 -1 texture vertex material
+bone bone frame
+material =
+frame bone
+texture bone
+1.0
+anim = anim 1.0
+0.500000 bone = vertex 1.0 bone 1.0
+material vertex texture 0.500000 bone vertex anim
+-1 -1 vertex -1
+0.500000 =
+anim material material =
+vertex material 0.500000 texture
+vertex = bone
+=
+texture
+1.0 vertex anim
+0.500000 -1 = bone vertex -1 frame
+material = anim
+1.0
+1.0 material
+vertex 0.500000 0.500000 texture
+vertex bone
+= = vertex 1.0 texture vertex
+frame vertex
+material 1.0 material
+anim texture anim 0.500000 -1 1.0
+anim anim vertex
+bone bone
+bone = material
+anim 0.500000 anim -1 =
+-1
+material frame
+= vertex -1
+bone 1.0
+vertex material
+=
+vertex anim -1 texture bone 0.500000
+bone 1.0
+frame = material
+texture anim anim anim = texture 0.500000 frame material
+0.500000 0.500000
+0.500000 -1 -1
+frame 0.500000
+0.500000 bone 1.0 material frame texture 0.500000 1.0 frame anim -1 frame texture texture frame texture
+texture
+bone anim texture vertex
+anim texture
+= anim 0.500000 bone
+bone
+= texture vertex vertex texture material vertex -1 -1 1.0 texture material anim
+= frame texture vertex
+-1 -1 anim 1.0 bone = -1 anim 0.500000
+vertex vertex
+bone 1.0
+frame
+bone vertex bone
+-1 anim
+texture anim 1.0 vertex
+0.500000 0.500000 bone bone = frame bone 0.500000 bone 1.0 frame anim material 1.0 frame = texture 0.500000 0.500000 vertex
+vertex bone
+texture 0.500000 1.0
+bone vertex material
+texture =
+material frame
+material texture
+vertex vertex vertex = texture 0.500000 -1
+bone texture 1.0 frame bone
+0.500000
+= texture
+material -1 0.500000 1.0 material -1
+0.500000 frame
+1.0
+frame
+anim 0.500000 anim = = material
+-1 = bone
+anim vertex
+= frame = anim vertex material 0.500000 0.500000 vertex material
+material anim
+material -1
+=
+1.0 frame texture 0.500000 vertex texture vertex = = anim
+bone
+= material 0.500000
+= anim texture texture 0.500000 material -1 frame texture -1 bone material anim
+anim
+vertex
+-1 0.500000 -1
+1.0 material 1.0 texture
+0.500000 anim
+bone vertex
+1.0 material
+anim frame -1
+anim 0.500000
+texture vertex
+-1
+anim 1.0 anim material
+0.500000
+bone bone texture anim = =
+0.500000 -1 material vertex
+texture bone = -1
+bone
+anim 1.0 =
+material material
+bone anim 0.500000 bone
+-1
+0.500000
+-1 frame 0.500000
+vertex material = material vertex
+1.0 = bone
+texture frame
+material
+frame
+material 1.0 texture material frame frame vertex 1.0 1.0 =
+vertex anim = -1 texture texture 1.0 texture texture
+bone =
+=
+0.500000 = 1.0
+0.500000 material
+bone -1 vertex
+bone bone frame
+1.0 -1 anim 1.0
+= anim
+frame = vertex material =
+-1 =
+texture 0.500000 1.0 bone
+1.0 -1 bone vertex
+frame
+-1 material anim = material 0.500000
+bone 0.500000 material frame texture bone 0.500000
+texture
+material
+frame 0.500000 vertex
+material = frame -1
+material
+anim vertex -1 =
+texture -1
+anim 0.500000 frame
+0.500000 vertex 1.0 bone bone vertex vertex -1 = frame anim material anim bone texture texture
+frame texture
+-1
+bone frame =
+0.500000 bone texture anim
+frame
+material
+1.0 = texture
+anim anim
+1.0
+0.500000 0.500000 material -1 1.0
+texture
+texture
+material anim -1 anim texture
+vertex texture = -1
+frame frame
+texture anim frame frame material -1 texture texture 0.500000 -1 frame 0.500000 material
+-1
+texture texture
+0.500000 -1 1.0
+vertex material
+texture material texture
+material
+1.0 texture
+-1 texture
+vertex texture = frame
+bone
+frame material
+-1
+texture 1.0 bone frame 1.0
+bone frame 1.0 frame
+vertex -1 0.500000 frame
+-1 -1 texture -1
+0.500000 vertex
+anim
+= 0.500000
+material
+= vertex 1.0 bone 0.500000 material -1 vertex =
+anim bone 0.500000
+bone anim 0.500000 bone texture material vertex
+anim 0.500000 1.0 bone vertex vertex material frame
+texture -1 =
+texture
+vertex 0.500000 bone frame material texture frame 0.500000 frame 0.500000 bone -1
+vertex anim texture bone = vertex -1 = 1.0 1.0 anim 1.0 0.500000 =
+=
+frame
+1.0 0.500000 anim texture = 0.500000 1.0
+-1
+-1 = frame frame material anim
+1.0 material
+vertex
+frame
+0.500000 -1 material anim anim -1 1.0
+frame
+= vertex frame bone
+-1 bone bone
+frame -1 0.500000 bone
+texture = anim
+= frame
+=
+material
+vertex 1.0 = anim
+frame
+texture = frame frame material
+vertex 1.0 frame -1 1.0 vertex
+vertex
+texture bone
+0.500000 -1 frame
+bone = anim material 1.0 vertex -1 0.500000 0.500000 material
+=
+anim
+anim
+texture material
+0.500000
+1.0 bone frame texture vertex texture vertex vertex -1
+1.0 = vertex =
+texture
+material texture
+1.0 material texture texture
+vertex -1 vertex anim anim 1.0 anim 1.0 1.0 1.0
+anim vertex = 0.500000 material vertex
+anim
+bone material frame = 0.500000 vertex frame
+-1 anim -1 = vertex vertex = 0.500000
+= =
+vertex texture vertex
+bone bone
+anim bone -1
+= -1 anim anim material
+material = texture
+= frame texture
+1.0
+anim 0.500000 bone
+-1 texture anim
+material
+texture material 1.0 0.500000
+anim frame bone =
+=
+material bone texture vertex frame
+texture anim frame bone texture texture
+-1 vertex bone
+= = 1.0
+1.0 texture material
+bone bone texture frame bone vertex material 0.500000 =
+texture 0.500000 frame bone = = frame
+texture -1 anim
+0.500000 material =
+0.500000 = 0.500000 -1 0.500000 material frame
+1.0 material 1.0
+0.500000 vertex bone frame
+0.500000
+-1 material vertex
+-1 material frame = 1.0 material = vertex frame bone vertex frame = vertex 0.500000 bone texture
+vertex anim 1.0 0.500000 bone 1.0 frame
\ No newline at end of file
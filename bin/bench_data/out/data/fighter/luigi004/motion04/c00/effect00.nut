@@ -0,0 +1,6 @@
+0.500000
+vertex material material
+texture -1 vertex frame
+vertex bone anim
+vertex vertex 1.0 0.500000 bone 1.0 material vertex
+= 0.5
\ No newline at end of file
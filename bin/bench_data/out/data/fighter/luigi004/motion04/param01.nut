@@ -0,0 +1,50 @@
+= 1.0 = 1.0 frame 0.500000 frame
+vertex = = material frame material bone anim frame anim 0.500000 = -1 vertex
+anim 0.500000
+-1 frame vertex 0.500000 material = frame = material material =
+-1 1.0 0.500000 material bone 1.0
+anim
+-1 bone 1.0 frame vertex bone material =
+0.500000 1.0 bone bone
+material 0.500000 vertex material = vertex frame texture
+anim anim material frame texture texture frame material material 0.500000
+= texture -1 material
+anim 0.500000 vertex 0.500000 1.0
+texture
+texture anim anim vertex
+bone 0.500000
+1.0
+anim anim -1 material 0.500000 vertex = texture frame =
+frame anim
+0.500000 0.500000 texture
+0.500000 1.0
+0.500000 anim = 0.500000 1.0 texture 1.0 = texture vertex vertex = 0.500000 anim =
+anim
+vertex
+-1 1.0 material anim anim
+= -1
+material anim
+bone =
+anim
+material 1.0 vertex anim 1.0 vertex texture vertex anim frame = anim 0.500000
+frame 0.500000 vertex
+anim bone
+anim frame bone texture vertex vertex bone 0.500000
+anim frame 1.0 texture 0.500000 texture
+texture 0.500000 anim -1 vertex anim material = frame 1.0 bone
+bone 0.500000
+0.500000
+= texture vertex vertex anim material bone texture = = material 1.0 = vertex -1 texture
+texture material 0.500000 = texture
+bone -1 anim 1.0
+1.0 frame
+= material texture
+texture vertex bone bone 0.500000 vertex =
+texture
+anim bone
+anim anim frame bone
+0.500000 vertex vertex
+frame -1 vertex frame anim texture
+-1
+anim texture = texture = anim vertex
+material material frame ma
\ No newline at end of file
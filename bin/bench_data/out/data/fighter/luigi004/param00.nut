@@ -0,0 +1,8 @@
+1.0 =
+material bone vertex -1 texture
+anim
+= 0.500000 anim = anim 0.500000 bone anim 0.500000 bone
+-1 vertex anim anim frame anim frame vertex = texture anim = 0.500000 1.0
+1.0
+frame frame
+0.50
\ No newline at end of file
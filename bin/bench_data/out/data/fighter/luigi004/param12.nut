@@ -0,0 +1,50 @@
+material
+vertex 0.500000
+texture = -1 frame material
+material bone vertex
+material
+-1 0.500000 material
+1.0 0.500000
+vertex = = vertex
+1.0 material bone bone = 0.500000 anim
+1.0 0.500000 material vertex
+texture anim
+vertex
+material vertex bone 0.500000 vertex
+anim 0.500000
+anim vertex
+1.0
+bone
+material
+0.500000 1.0
+vertex bone frame anim
+texture 1.0 frame
+frame bone vertex 0.500000
+texture 0.500000 1.0 -1 vertex 1.0 0.500000 anim = vertex
+anim vertex
+= 0.500000 0.500000 = anim texture
+material
+anim
+=
+anim
+bone anim 0.500000 material material 0.500000 frame vertex texture material
+bone bone material material -1
+texture
+texture frame 1.0
+1.0 vertex 0.500000 frame vertex 0.500000 texture
+bone
+= -1 -1 texture vertex
+bone
+= frame material 0.500000
+texture frame
+anim anim material
+-1
+= = texture
+bone
+0.500000 = frame
+texture
+frame = vertex -1 bone
+anim frame texture frame
+bone bone -1 material texture 1.0 material vertex
+material
+texture texture bone
\ No newline at end of file
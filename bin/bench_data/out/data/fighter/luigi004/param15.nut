@@ -0,0 +1 @@
+0.500000 material 0.500000 -1 0.500000 vertex 
\ No newline at end of file
@@ -0,0 +1,14 @@
+frame 0.500000 -1 vertex 1.0 bone
+= bone vertex 1.0 bone bone vertex anim frame frame anim
+texture texture anim anim vertex
+bone texture
+texture 1.0 vertex
+frame anim vertex anim vertex
+vertex bone = bone frame vertex texture -1 1.0
+material anim -1 material
+vertex bone
+frame bone -1 texture vertex material 0.500000 material -1 material frame frame
+-1 = frame frame anim texture texture =
+material texture frame vertex 1.0 vertex bone 1.0 texture material =
+-1 texture
+1.0 -1 material -1 frame 
\ No newline at end of file
@@ -0,0 +1,6 @@
+1.0 material
+-1 1.0 0.500000
+texture
+bone texture
+1.0 0.500000
+bone 0.500000 frame material frame v
\ No newline at end of file
@@ -0,0 +1,52 @@
+vertex bone -1
+texture bone
+1.0 = = 1.0 vertex = material 0.500000 anim frame
+-1 material = frame 0.500000 bone bone 0.500000 texture texture vertex
+0.500000 bone
+bone
+0.500000
+texture
+frame
+=
+-1 vertex anim anim -1 anim material anim material frame
+material
+bone = frame vertex texture
+texture
+vertex
+frame =
+1.0 vertex
+vertex anim bone anim
+vertex
+texture anim vertex vertex
+anim 1.0 vertex frame
+-1
+material -1 anim 1.0 -1 1.0 texture
+-1 bone -1 -1 -1 vertex = vertex -1 0.500000
+= =
+= anim bone
+material texture texture vertex anim
+0.500000 frame 1.0
+-1 1.0
+0.500000 texture texture 0.500000 texture vertex
+material anim material
+-1 bone = texture frame
+material
+texture
+vertex
+vertex vertex
+0.500000 texture = -1 vertex bone material
+texture anim frame -1 anim
+anim anim -1
+vertex frame
+bone
+anim -1 material vertex bone texture frame 1.0 = = anim anim -1 vertex 1.0 vertex anim -1
+bone
+texture
+texture anim frame -1 frame
+material anim
+vertex -1 vertex
+material
+-1 frame
+bone -1 bone
+bone 1.0 frame
+texture
@@ -0,0 +1,71 @@
+0.500000
+frame texture vertex
+1.0 frame frame material
+0.500000 texture
+texture
+vertex -1 material
+bone = bone vertex vertex 1.0 = frame anim anim vertex 1.0 =
+texture -1 frame 0.500000 texture -1 1.0 1.0 frame = = 1.0 1.0
+1.0
+material = frame 0.500000
+frame = frame 0.500000 frame
+texture -1 texture
+frame
+texture texture = texture texture frame anim 0.500000
+bone frame bone bone vertex vertex
+anim = material 0.500000
+material bone
+=
+= texture vertex 0.500000 -1 vertex = =
+-1
+material 1.0
+= 0.500000
+1.0 material = vertex texture vertex
+frame = anim
+material material frame vertex = -1 vertex material 0.500000 bone material = 1.0 0.500000 0.500000
+0.500000
+bone bone material 0.500000 anim texture
+texture frame 0.500000 1.0 bone
+anim 0.500000
+material 0.500000 frame 0.500000
+anim texture vertex
+= frame
+anim vertex = vertex anim
+-1 anim bone vertex
+material vertex
+bone anim
+vertex 0.500000 material material 0.500000 frame bone 1.0
+bone 0.500000 = frame bone texture bone
+anim -1 anim = frame
+0.500000 -1 frame = 0.500000 0.500000 0.500000 vertex -1
+= material anim 0.500000 frame
+material 0.500000 -1
+= material = -1 -1
+material -1 0.500000 -1
+anim 0.500000 0.500000 0.500000
+-1 -1
+1.0 1.0 1.0 -1 frame -1 material
+anim
+-1 anim -1 bone = -1 anim
+= -1
+anim material
+0.500000 texture
+material 1.0 vertex texture
+material
+= = vertex vertex material anim
+1.0
+anim frame =
+vertex vertex
+anim material
+= texture material anim 1.0 material frame
+1.0 material frame material
+material -1 bone texture bone material texture 0.500000
+bone -1
+anim frame texture
+0.500000 bone
+=
+anim frame -1 frame
+texture
+texture -1 = texture vertex
+texture bone vertex
+anim 0.500000 bone 0.500000 frame bone textu
\ No newline at end of file
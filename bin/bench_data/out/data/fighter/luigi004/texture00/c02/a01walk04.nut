@@ -0,0 +1,2 @@
+-1 vertex 0.500000 vertex material bone vertex anim material 1.0
+fr
\ No newline at end of file
@@ -0,0 +1,12 @@
+0.500000
+vertex 0.500000 bone bone vertex 1.0 vertex
+vertex vertex anim
+vertex 1.0 bone frame -1
+1.0
+frame -1
+bone = 0.500000 material
+bone vertex bone vertex texture 1.0 1.0 vertex = 1.0 1.0 material -1
+texture 1.0 bone
+1.0 material frame 0.500000
+= texture
+mater
\ No newline at end of file
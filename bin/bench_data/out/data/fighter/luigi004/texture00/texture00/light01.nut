@@ -0,0 +1,6 @@
+-1 anim texture vertex vertex texture texture = bone
+=
+material bone frame
+texture material vertex 1.0 0.500000 = -1
+= material -1
+texture frame material fra
\ No newline at end of file
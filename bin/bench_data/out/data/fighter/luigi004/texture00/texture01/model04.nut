@@ -0,0 +1,10 @@
+bone material
+0.500000 1.0 frame =
+=
+anim
+0.500000 material frame
+anim
+frame anim
+0.500000 texture -1
+= 1.0 frame vertex
+tex
\ No newline at end of file
@@ -0,0 +1,38 @@
+= anim anim texture anim material
+= texture 0.500000 texture 0.500000 vertex material anim 1.0
+-1 frame anim
+frame
+0.500000 1.0 texture
+material -1 bone bone 0.500000
+anim
+0.500000 bone = 0.500000 anim
+material texture texture material material material 0.500000 material frame -1 -1 material 0.500000 = anim
+bone 0.500000
+anim
+texture
+vertex
+1.0 material = 0.500000 vertex 1.0 material
+texture
+frame 0.500000
+material -1
+-1 texture vertex anim = 0.500000 -1
+1.0
+vertex frame material -1 anim frame
+texture 0.500000
+texture material 0.500000 material -1
+texture = -1 bone material material anim -1
+material
+= anim -1 1.0 1.0 frame
+frame
+vertex -1
+frame -1
+material material
+bone 0.500000
+= frame bone material bone bone = vertex frame -1
+-1 1.0 -1 vertex
+anim 1.0 bone
+material frame
+material frame texture
+0.500000 0.500000 frame =
+frame
+1.0 = 0.500000 
\ No newline at end of file
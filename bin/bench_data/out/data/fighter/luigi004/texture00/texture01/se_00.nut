@@ -0,0 +1,18 @@
+vertex 0.500000 0.500000 -1 1.0 1.0 anim 0.500000 frame
+-1 anim
+texture
+-1 material
+texture texture
+= = -1 texture
+1.0
+-1
+anim
+material anim
+bone vertex anim texture bone
+texture anim 0.500000 material
+frame
+0.500000 bone frame material material =
+anim frame anim 1.0
+= vertex
+0.500000 1.0
+= 1.0
\ No newline at end of file
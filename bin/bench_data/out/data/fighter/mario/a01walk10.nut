@@ -0,0 +1,85 @@
+frame 0.500000 1.0 1.0 texture frame
+-1
+vertex bone texture 0.500000 -1 frame frame
+-1 texture bone
+1.0 = frame =
+0.500000 bone 1.0 0.500000
+texture
+texture vertex vertex = 1.0 -1
+frame
+anim 0.500000
+texture 0.500000 frame 0.500000 =
+frame vertex 0.500000
+0.500000 texture
+vertex vertex
+= material
+0.500000 frame
+0.500000 vertex anim anim material
+anim material
+= = -1 0.500000 1.0 bone texture anim bone 1.0
+material material material
+bone
+= 1.0 1.0 = bone bone
+texture vertex bone frame = vertex -1 bone frame
+anim
+0.500000 = frame bone vertex 1.0
+0.500000 material frame
+-1 anim frame -1
+texture -1 material texture = frame texture
+1.0 bone anim material vertex texture -1 texture
+= texture 0.500000
+1.0 texture 0.500000 bone = bone texture =
+bone anim
+=
+vertex 0.500000
+0.500000 frame 0.500000 -1 material vertex = -1
+vertex frame 0.500000 0.500000
+vertex
+texture frame bone vertex frame frame
+0.500000 1.0
+texture bone
+vertex
+frame -1 =
+frame bone
+= bone texture vertex
+= bone material material 0.500000
+-1 anim
+material texture
+1.0 1.0 material
+= frame bone 0.500000 bone vertex -1
+bone
+-1 material vertex material
+=
+= = texture
+1.0 material 0.500000 anim = = vertex texture anim anim bone material -1 1.0 0.500000 -1
+-1 1.0 =
+material material vertex -1 material texture frame 0.500000 anim material -1
+material
+material material bone material bone =
+-1 1.0
+bone 0.500000 0.500000 = -1 1.0
+texture 0.500000 0.500000
+vertex 1.0 frame texture frame material
+1.0 bone = bone 0.500000 anim texture vertex 0.500000
+anim
+1.0
+bone 1.0
+0.500000
+= texture anim frame 0.500000 -1 anim bone
+bone
+vertex texture
+= anim 0.500000
+frame
+anim
+=
+bone bone texture texture bone -1 anim texture
+-1 vertex material =
+anim 1.0 =
+0.500000 texture vertex -1
+anim
+frame texture frame =
+material
+texture texture bone vertex
+frame
+anim
+anim
\ No newline at end of file
@@ -0,0 +1,44 @@
+0.500000 -1
+1.0 =
+-1 material =
+frame material texture
+bone 1.0
+texture -1 texture =
+-1
+= anim 1.0 -1 0.500000 1.0
+-1 =
+material vertex 0.500000
+1.0 material 1.0 texture anim bone anim
+frame texture -1 frame
+anim anim 0.500000 anim
+0.500000 frame anim -1
+1.0 material -1 -1 1.0 anim
+1.0
+vertex bone material = texture frame
+vertex material
+= texture material vertex -1 vertex -1 anim
+bone
+anim texture texture 1.0 vertex bone material
+texture anim texture
+vertex vertex = anim material material = 0.500000 -1
+= texture -1
+1.0 0.500000 anim material
+0.500000 anim
+1.0 -1 1.0 material =
+texture 1.0 material vertex = 0.500000 0.500000
+anim 1.0 bone
+frame
+0.500000
+= frame 0.500000 = = bone anim vertex frame
+vertex
+0.500000 vertex frame
+frame anim material vertex frame vertex 1.0 bone frame -1 texture
+frame anim vertex 1.0
+material 1.0 frame bone anim = texture material 1.0 bone
+texture 0.500000
+texture
+bone material 0.500000 -1 frame 1.0 anim
+0.500000 -1 material frame frame -1
+material
+vertex 1.0 1.0 texture =
+bo
\ No newline at end of file
@@ -0,0 +1,21 @@
+material material 1.0 texture
+bone bone bone texture frame anim texture 0.500000
+anim 1.0
+= 1.0 bone
+vertex -1 = bone
+anim 1.0
+anim 1.0
+material = -1 texture = bone bone 0.500000 vertex
+frame =
+vertex bone
+material texture
+=
+texture 1.0
+material bone texture texture
+1.0 bone
+texture vertex anim bone 0.500000 = anim -1
+-1 1.0 0.500000 anim texture
+anim bone frame
+= frame
+bone vertex -1 =
+vertex te
\ No newline at end of file
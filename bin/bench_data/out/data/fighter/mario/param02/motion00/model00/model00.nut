@@ -0,0 +1,163 @@
+0.500000 =
+0.500000 = vertex -1 material bone frame = 0.500000 0.500000 -1 frame bone material texture 0.500000
+= material vertex anim bone
+= bone
+0.500000 texture
+-1 0.500000 0.500000 = frame 1.0 =
+material 1.0
+vertex material material anim material vertex vertex vertex 0.500000 anim frame bone
+vertex vertex -1 frame 1.0 1.0 bone vertex 0.500000 -1
+-1 texture -1 bone texture vertex
+0.500000 -1 frame anim
+0.500000 -1 -1 bone
+1.0 = 1.0 anim texture bone =
+= -1 -1 -1 frame bone 0.500000 -1 0.500000 frame 0.500000 1.0 material anim material bone vertex 0.500000 anim vertex 1.0
+vertex = anim frame frame
+bone vertex = anim frame material -1 1.0 anim
+-1 0.500000 0.500000
+=
+vertex
+1.0 -1
+frame texture bone 1.0 anim bone texture
+bone bone texture texture texture -1
+material frame
+0.500000 0.500000
+-1 -1 material texture material texture
+texture material
+anim
+bone
+0.500000 -1
+-1 -1 material
+bone = -1 material
+= -1
+= material frame frame 0.500000
+1.0
+bone = frame vertex 0.500000 0.500000 vertex bone bone
+anim texture texture bone anim = bone
+0.500000 anim bone -1
+0.500000 bone = frame vertex anim
+anim
+material
+frame 0.500000 texture texture bone
+= texture -1
+bone bone -1 texture 1.0 material material
+1.0 bone 1.0 bone -1 bone vertex texture
+anim bone =
+vertex
+anim
+frame -1 texture 1.0 material
+bone -1 1.0 bone
+texture texture 1.0 1.0
+= = texture
+anim 1.0
+material frame material anim 1.0 frame frame texture -1 frame
+= =
+= = 0.500000 vertex anim material
+= frame -1 vertex bone 0.500000 material
+anim vertex
+bone 0.500000
+vertex 1.0 -1 frame material texture bone frame
+vertex vertex
+frame
+= 0.500000
+0.500000 frame
+0.500000 0.500000 vertex =
+1.0 =
+0.500000
+0.500000 frame 0.500000 0.500000 0.500000 -1 anim material 1.0 texture
+0.500000 anim bone -1 frame
+-1 = vertex = frame bone -1 0.500000 material vertex
+material = vertex 1.0 anim anim 1.0 vertex -1 vertex texture texture texture -1 0.500000 bone frame 0.500000 bone vertex bone 0.500000 frame bone vertex material
+bone texture -1 material material bone = anim anim
+0.500000 = frame -1 bone bone =
+bone bone 1.0 -1 texture anim =
+1.0 material
+material -1 0.500000 anim =
+frame anim 1.0 anim frame bone 1.0 -1 vertex 1.0
+material
+-1 1.0 0.500000
+= frame 0.500000
+0.500000
+bone frame 0.500000 frame anim texture vertex
+anim frame 1.0 material bone material material
+material
+bone texture
+material -1
+vertex anim anim
+1.0 material anim anim =
+-1 = = vertex frame frame 0.500000
+= material frame -1 1.0 anim bone vertex texture material
+0.500000
+vertex vertex = 0.500000
+anim -1 0.500000 vertex
+-1 = 1.0 bone
+frame
+0.500000 material frame 0.500000
+-1 0.500000 texture anim material
+texture
+texture material = = -1
+0.500000 anim vertex 1.0 = frame = anim texture
+= vertex vertex texture anim bone =
+material
+0.500000 1.0 texture anim vertex
+= 0.500000 = 1.0 vertex anim
+anim
+material 1.0 0.500000 -1 frame material =
+1.0 anim 0.500000
+0.500000 = texture
+bone frame
+bone = 0.500000 0.500000 -1
+bone
+0.500000 frame 0.500000
+anim 1.0 bone 0.500000 material vertex
+anim bone 0.500000
+1.0
+frame 0.500000 bone vertex
+anim 0.500000 vertex -1 bone anim 0.500000 frame 1.0 texture texture bone texture vertex = texture 1.0 -1 = anim
+material texture bone =
+0.500000 = anim vertex frame texture material 0.500000 frame 0.500000
+anim texture anim material anim
+bone
+1.0 bone material
+bone -1
+vertex -1 -1
+vertex frame 1.0
+texture
+0.500000 -1 material vertex anim
+bone = 1.0 frame material vertex 0.500000 anim anim bone
+frame anim vertex frame 1.0 frame material
+0.500000 0.500000 0.500000
+-1 0.500000 = material
+= -1 frame
+-1 -1
+anim texture bone vertex -1
+texture
+1.0 0.500000
+bone vertex vertex
+0.500000 material -1
+vertex
+0.500000 vertex texture vertex vertex vertex
+-1
+= 1.0 -1 = 1.0
+anim frame anim bone bone
+0.500000 -1 frame -1 anim material
+vertex -1 = bone texture 1.0
+0.500000 anim vertex material
+anim 0.500000
+material material material
+vertex
+= frame
+texture 0.500000
+-1 -1
+texture texture anim
+texture vertex bone = vertex
+-1 vertex
+material anim
+anim 0.500000 material 1.0 frame bone frame frame frame
+material vertex 1.0 vertex texture anim -1 1.0 texture 0.500000 -1 material
+texture vertex 1.0 frame -1
+bone anim frame
+1.0 0.500000 anim frame anim vertex texture =
+= texture
+bone texture material texture frame 0.500000 material
+frame texture -
\ No newline at end of file
@@ -0,0 +1,2 @@
+= anim frame -1 frame
+material frame bone material -1 0.50
\ No newline at end of file
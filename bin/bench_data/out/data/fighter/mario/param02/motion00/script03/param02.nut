@@ -0,0 +1,30 @@
+frame 0.500000 1.0 texture frame anim
+bone
+= 1.0 material texture bone bone 0.500000
+1.0 0.500000
+bone vertex = vertex 1.0 material 1.0
+1.0 texture material
+material material
+bone -1 material bone
+1.0
+anim
+anim 1.0 vertex 1.0
+-1 anim frame texture bone bone material vertex 1.0 -1
+= frame
+1.0 bone
+bone texture
+material 0.500000 vertex
+-1 0.500000 = material 1.0 vertex
+= material
+frame texture
+anim
+texture texture bone material
+texture
+-1
+vertex 1.0 texture
+anim 0.500000
+bone -1 frame 1.0 = anim = 1.0
+1.0
+0.500000 -1 vertex
+=
+= 0.500000 -1
\ No newline at end of file
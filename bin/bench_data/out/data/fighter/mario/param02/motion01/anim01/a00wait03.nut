@@ -0,0 +1,262 @@
+1.0 1.0 -1 0.500000 frame
+vertex
+vertex
+texture
+anim
+frame
+frame bone
+texture 0.500000
+bone 1.0
+1.0 1.0 texture texture anim
+texture
+0.500000 = = anim = -1 =
+0.500000 bone 0.500000 bone texture -1
+anim bone 0.500000 vertex material material
+bone = 0.500000 vertex vertex texture 1.0 bone
+vertex = 0.500000 material -1
+1.0 anim
+material 1.0 material = = anim
+=
+-1 anim
+texture
+material texture material 0.500000 material
+anim 1.0
+anim 0.500000
+vertex
+vertex
+anim anim frame 1.0
+1.0
+-1 1.0 = 0.500000 material
+anim frame bone
+texture
+frame -1 =
+anim
+= 1.0 1.0 material
+material
+material vertex texture vertex
+bone bone frame
+vertex bone -1
+texture texture
+1.0 frame texture 1.0 0.500000 bone
+=
+texture bone
+texture material texture
+vertex = -1 =
+0.500000 vertex frame -1 bone anim
+bone
+frame -1 = -1 texture texture bone vertex 0.500000 material
+texture 1.0
+texture
+texture 0.500000 bone bone 0.500000 0.500000 texture frame
+0.500000 texture vertex texture material frame = vertex 0.500000 0.500000 material 1.0 = = -1
+= -1 bone
+= 0.500000
+vertex = 0.500000 1.0 vertex = -1
+texture
+vertex
+0.500000 bone 1.0 =
+material
+vertex texture texture 1.0 texture texture bone
+1.0 bone texture vertex material 0.500000 bone
+bone -1
+texture vertex
+= vertex bone =
+= texture anim frame -1
+vertex
+-1 texture
+frame
+vertex anim frame 0.500000 -1
+0.500000 material material 1.0 = texture frame
+-1 vertex material = texture texture texture texture texture frame
+1.0 frame anim bone = -1 frame texture 1.0
+-1 texture = vertex -1 0.500000
+frame vertex -1 anim material
+frame 0.500000 1.0
+anim 1.0
+vertex -1 anim -1 vertex
+1.0 anim frame
+1.0 bone 1.0 0.500000 texture 1.0 anim
+vertex frame
+anim texture -1 material material = 0.500000 0.500000 bone frame
+0.500000 1.0 frame vertex frame bone frame -1 0.500000 vertex 1.0 texture -1 1.0 -1 -1 = bone
+= bone
+texture
+anim texture
+anim
+-1
+bone frame 0.500000 vertex
+texture bone -1 bone bone
+material anim bone frame anim
+frame 0.500000 anim -1 1.0 1.0
+frame anim anim material texture
+-1 texture
+frame -1
+frame -1 frame = material texture
+frame texture
+= frame = 1.0 anim bone
+material anim material
+= 0.500000 frame
+material
+frame
+bone texture = texture 0.500000 vertex
+frame material
+material
+0.500000 frame bone material
+0.500000 frame 1.0
+bone 1.0 vertex anim = frame -1 frame 1.0
+material material = anim frame 1.0
+texture bone material bone
+-1 0.500000 vertex material frame bone material 0.500000 -1
+1.0 0.500000
+0.500000 0.500000 -1 0.500000 = frame bone = texture
+frame
+1.0
+1.0 texture
+frame 1.0 material
+bone
+bone texture
+1.0
+vertex anim
+= 0.500000 0.500000 0.500000 0.500000 0.500000
+anim -1
+material anim texture vertex 0.500000
+material
+bone vertex frame
+-1
+vertex anim 0.500000 bone -1 1.0
+anim bone material
+material 1.0
+bone bone = = material anim
+material = -1 texture = texture
+vertex
+-1 -1 texture vertex 0.500000 material
+0.500000 texture 0.500000 frame
+1.0
+-1 -1 texture texture texture -1 frame
+bone frame 1.0 texture
+= texture vertex
+1.0
+material -1 anim texture =
+-1 material
+material 0.500000 texture bone
+bone 0.500000 -1
+1.0 1.0 -1 -1 = frame material = -1 material -1 -1 1.0 0.500000
+0.500000
+1.0 1.0
+= 1.0 anim vertex = -1 material = 1.0 vertex frame frame bone texture 1.0
+texture bone 0.500000
+material = = -1 material
+=
+texture frame -1
+-1
+material vertex = vertex bone -1 1.0 material = vertex 1.0
+1.0 bone texture frame 0.500000 0.500000
+= = -1
+material texture frame bone = vertex
+bone
+-1
+vertex texture = texture 0.500000 1.0
+frame texture 0.500000 0.500000 texture anim bone 0.500000 0.500000 bone vertex anim vertex vertex 0.500000
+vertex
+frame
+1.0 0.500000 material texture anim anim frame vertex = material bone bone 1.0 texture material 1.0 material vertex
+material
+0.500000 vertex -1 anim
+0.500000
+bone vertex material
+vertex material bone bone 0.500000 0.500000 -1 frame bone bone frame texture material = 0.500000 = bone anim
+0.500000
+texture material 0.500000 bone
+0.500000 0.500000 0.500000 0.500000
+-1 0.500000
+= 1.0 texture material
+anim = -1 0.500000 bone
+frame material -1 = 1.0
+bone bone anim anim texture vertex
+anim bone 1.0 0.500000 vertex
+anim texture bone
+bone
+frame 0.500000 1.0 frame 0.500000
+0.500000 texture 1.0
+-1
+0.500000 texture frame
+texture = 0.500000 material = anim
+vertex 0.500000
+= 1.0 texture texture material bone
+vertex 0.500000 anim
+frame = material = 1.0
+= texture
+material
+material bone texture
+1.0
+texture
+frame 1.0 anim
+0.500000
+texture =
+frame material 0.500000
+bone
+material frame bone
+= -1 vertex 0.500000 1.0 vertex
+anim texture
+0.500000 1.0 texture 0.500000 anim
+1.0 texture
+0.500000
+material frame
+= 0.500000 frame texture
+vertex
+0.500000 bone -1 texture
+bone frame
+texture material -1
+1.0 anim =
+vertex -1 = material
+texture material vertex 0.500000 texture anim 1.0 frame texture 1.0 -1 0.500000 anim
+-1
+anim
+1.0 -1 = anim
+= texture
+bone
+anim
+0.500000 texture
+bone
+material
+bone -1 1.0
+anim
+bone 0.500000 frame frame texture anim
+material 0.500000 material frame -1 vertex material material vertex
+= vertex
+1.0 material = = = frame
+texture
+bone
+frame -1 = =
+= -1 vertex
+0.500000
+material material 1.0 anim -1 = anim = bone 1.0
+1.0 texture frame 0.500000 frame material 0.500000 texture
+texture texture bone 0.500000
+-1
+vertex
+-1 vertex 1.0 frame -1 0.500000 vertex bone vertex frame
+texture
+material 1.0 material anim anim = material -1 material -1 frame
+bone vertex bone bone texture material frame = anim texture vertex texture 1.0
+=
+vertex =
+-1 frame
+=
+anim 0.500000 0.500000 1.0
+anim anim -1 bone 1.0 1.0 0.500000
+material texture = = 0.500000 frame -1
+material
+bone
+vertex bone
+-1 texture 1.0 bone 1.0 frame -1
+anim 0.500000 material
+texture texture bone =
+anim
+frame -1 = anim 0.500000
+material texture bone = 1.0 bone vertex material anim vertex
+frame -1 vertex material -1 -1 texture vertex = 0.500000 1.0 = -1
+= -1 material material
+vertex 0.500000 anim
+1.0 material
+1.0 0.500000 vertex frame texture vertex 
\ No newline at end of file
@@ -0,0 +1,271 @@
+bone
+1.0 =
+-1 anim vertex material
+bone
+frame 1.0 anim = anim 0.500000 anim
+anim
+-1 -1 frame vertex 1.0
+bone
+texture
+= texture
+1.0
+vertex bone -1 texture vertex = 0.500000 bone vertex
+texture -1 anim
+=
+1.0 frame = frame texture 0.500000 bone 1.0 0.500000
+texture texture anim
+-1 1.0 bone bone
+anim
+vertex -1 1.0 vertex texture bone =
+material
+0.500000 1.0 -1 vertex texture material
+vertex bone bone 0.500000 texture 0.500000
+vertex 1.0
+vertex 0.500000 -1 texture
+bone
+-1 bone frame 1.0
+frame bone
+frame frame anim = frame frame texture 1.0
+anim
+material
+1.0 1.0 frame 1.0 anim -1 0.500000 0.500000 texture material texture
+material anim 1.0 anim bone anim =
+anim vertex -1 material anim
+0.500000 bone
+=
+bone
+frame 0.500000 texture
+bone
+vertex 0.500000
+vertex
+= material 0.500000 0.500000
+1.0
+anim -1
+-1 -1 1.0
+vertex 1.0 1.0 0.500000
+= anim vertex -1 0.500000
+1.0
+anim 1.0 anim 0.500000 bone frame
+1.0 = = 0.500000 frame
+1.0
+1.0 frame anim -1 -1 -1 frame
+frame vertex vertex
+frame
+0.500000 frame =
+bone
+=
+vertex material anim material anim texture =
+frame = frame texture frame
+anim 1.0 -1 texture
+=
+material -1 vertex -1 material bone
+anim
+vertex bone vertex
+0.500000 -1 texture = frame -1
+0.500000
+bone anim vertex vertex vertex -1 frame vertex -1 material material material
+1.0 frame 1.0 bone anim
+=
+= frame vertex vertex bone anim
+anim = frame bone
+vertex vertex frame frame texture bone 0.500000 vertex -1 1.0 1.0 = frame -1
+frame material vertex
+-1 -1 0.500000
+frame
+vertex texture frame texture
+material = vertex 0.500000 = -1
+0.500000 0.500000 material frame vertex material = anim
+material 0.500000 frame =
+vertex texture 0.500000 texture anim vertex vertex bone bone anim 1.0 frame
+bone frame vertex 0.500000 1.0
+-1 = -1 material -1 frame material 0.500000
+material bone
+-1
+material 1.0 anim
+anim anim anim
+anim -1
+anim
+-1 -1 frame
+texture = anim -1 0.500000 frame bone material bone material = 1.0 texture 0.500000 = material
+frame frame 1.0 vertex =
+material bone texture -1 vertex
+0.500000
+frame
+bone vertex anim
+material anim bone 1.0 vertex texture
+0.500000
+1.0 0.500000 frame material 1.0 vertex texture vertex frame frame
+anim vertex bone =
+anim anim vertex
+1.0
+material anim bone vertex 1.0 bone frame
+frame material vertex vertex -1
+material
+anim = = frame
+anim
+frame = texture -1 anim -1 -1 0.500000 vertex -1 texture 0.500000
+material frame frame frame = texture
+anim 1.0 vertex material bone frame 1.0 = bone =
+vertex
+-1 -1
+vertex bone material
+frame vertex bone frame frame material
+=
+= material material frame -1 material bone -1
+vertex
+texture
+=
+material material
+= =
+texture frame frame
+material
+0.500000 frame 0.500000
+0.500000
+anim 1.0 0.500000 anim 1.0 vertex = =
+anim
+= = = = texture
+material anim 1.0 material texture =
+= 1.0 -1 0.500000
+-1 1.0 -1 vertex 1.0
+1.0
+frame bone texture bone 1.0
+0.500000
+-1 1.0 vertex anim anim -1 bone vertex texture anim = -1
+vertex
+0.500000 0.500000 =
+frame frame vertex material bone 0.500000
+anim
+1.0 -1
+bone
+-1 texture -1 texture anim frame 0.500000 = vertex anim material bone 0.500000 material
+anim anim material vertex
+bone texture -1 = = = 1.0
+=
+= texture
+= texture anim texture anim frame = 0.500000
+frame
+0.500000 bone
+vertex material texture anim texture frame =
+= -1
+texture = vertex
+frame bone
+texture bone
+-1 0.500000 =
+frame frame anim
+= -1
+0.500000 bone
+= frame
+material texture
+material frame 0.500000
+texture -1 0.500000
+-1 anim anim vertex = texture anim 1.0 0.500000 bone = 1.0 frame
+frame 1.0 = texture bone bone material
+-1 -1 anim -1 anim material vertex -1 -1 bone 0.500000
+texture = -1 texture anim frame vertex 0.500000 0.500000 vertex texture
+-1 vertex 1.0
+= frame 0.500000 vertex bone bone frame frame -1
+= frame frame
+frame vertex bone frame = -1 anim material material texture
+= texture -1
+material
+1.0
+-1 texture anim
+1.0 material 1.0
+bone anim -1 bone
+anim anim
+0.500000 -1 texture 0.500000 anim vertex 1.0 -1 frame 1.0 -1
+bone texture -1 0.500000
+vertex
+material vertex vertex frame texture -1 anim
+frame anim bone
+anim
+vertex
+1.0 texture vertex =
+1.0
+0.500000 -1
+bone
+texture vertex = texture bone = anim bone frame 0.500000 frame anim frame vertex bone bone vertex texture frame
+1.0 texture
+-1
+anim 1.0 anim vertex bone anim material
+frame = texture material
+-1 0.500000 frame bone vertex
+0.500000 0.500000 vertex anim anim vertex
+material 0.500000
+bone -1 material vertex
+bone
+bone -1
+1.0 frame 1.0
+vertex bone
+anim
+texture texture anim
+vertex 0.500000 = 1.0 vertex 0.500000 bone texture
+vertex
+= 1.0 bone material
+vertex = -1 texture 1.0 frame bone
+texture
+1.0 -1 vertex
+frame anim bone frame
+frame 1.0 1.0 0.500000 frame
+0.500000 anim
+1.0 =
+material anim vertex = texture 1.0
+frame frame texture
+vertex bone texture 1.0 1.0 vertex
+bone vertex
+frame vertex material
+texture 1.0 1.0 -1
+texture material
+1.0 texture
+bone -1 texture -1 -1
+material -1 1.0 anim vertex -1
+0.500000 material texture 0.500000 anim -1 frame
+anim 0.500000
+bone material bone frame material anim = material
+texture -1 1.0 frame 0.500000
+frame
+frame 1.0 texture vertex frame -1
+vertex texture 0.500000 frame texture
+vertex material
+= anim vertex
+vertex texture vertex
+texture vertex
+frame material vertex vertex texture bone 0.500000 0.500000 =
+bone material frame
+texture
+vertex
+= material
+anim material frame anim
+anim -1 texture
+anim -1 -1
+vertex material texture
+0.500000 material anim bone 1.0 = -1
+texture 1.0 texture
+frame anim
+anim anim texture
+texture 0.500000 anim -1 material
+vertex
+0.500000 1.0 vertex material texture -1 = frame 0.500000
+texture anim -1 vertex
+= = anim
+1.0
+frame bone -1 anim anim
+material frame bone frame bone
+frame 0.500000
+1.0
+bone = texture =
+frame = vertex = material vertex frame frame -1 0.500000 vertex bone texture anim texture material anim 0.500000 = bone = vertex texture vertex
+vertex 1.0 material texture
+anim
+texture -1 = 0.500000 = -1 texture -1 texture frame bone 1.0 anim = 1.0 vertex 1.0 0.500000
+1.0 vertex texture -1 anim anim = anim 1.0
+0.500000 texture
+-1 texture material material frame 0.500000 =
+anim vertex texture
+0.500000
+1.0 vertex
+texture 1.0 texture -1 texture -1 = vertex = bone
+bone frame bone
+-1
+=
+= = 0.500000 vertex 0.500000 ani
\ No newline at end of file
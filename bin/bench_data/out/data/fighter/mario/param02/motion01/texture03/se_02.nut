@@ -0,0 +1,175 @@
+material texture 0.500000
+= anim anim -1 1.0
+= = vertex frame
+0.500000
+material 1.0 material -1
+-1 texture frame anim = = 0.500000 0.500000 -1 0.500000 -1 =
+1.0 material 0.500000 0.500000 vertex vertex -1 = texture frame texture bone = -1 frame vertex vertex =
+frame = anim texture frame
+material material material anim
+vertex 0.500000 -1 1.0
+texture frame material
+material = anim anim frame material =
+0.500000 = -1
+1.0 anim 0.500000
+material frame bone
+frame
+material
+texture
+-1
+= bone
+bone bone frame = bone 1.0
+bone -1 1.0
+vertex 1.0
+0.500000
+anim material
+1.0 1.0 1.0 frame material anim
+frame
+frame bone -1 frame texture frame 1.0 frame material =
+texture
+anim
+-1 -1 vertex texture =
+1.0
+0.500000
+bone frame = frame material material -1
+0.500000 bone -1
+frame 0.500000
+texture = texture
+= -1 =
+= vertex
+bone =
+texture
+1.0 texture 0.500000 0.500000 1.0
+-1
+= -1 1.0
+vertex material
+bone 0.500000 = 0.500000
+=
+1.0 = material
+anim 0.500000 bone = -1
+= 1.0 = anim
+-1 = anim texture vertex vertex bone vertex material = material
+frame 0.500000 = -1 texture bone frame 1.0 vertex anim
+material vertex bone material vertex anim bone
+-1 frame vertex vertex bone vertex bone bone
+0.500000
+anim 0.500000 frame 0.500000 frame
+0.500000
+bone anim 1.0 -1 -1 1.0 =
+-1
+1.0
+material anim =
+-1 1.0 vertex material
+vertex -1 anim 1.0 -1 vertex anim
+0.500000 =
+vertex 1.0 -1
+1.0 = 1.0 vertex frame
+bone
+anim texture
+1.0 0.500000
+0.500000 = anim 0.500000
+vertex 0.500000 0.500000 = material
+bone vertex texture vertex
+bone
+frame 1.0
+texture vertex = vertex 1.0 vertex frame texture frame bone texture 1.0 bone -1
+vertex vertex material frame
+0.500000 texture = texture
+1.0 frame material = frame
+anim material material vertex
+texture
+0.500000 1.0 = material = = vertex
+anim = material = 1.0 -1 bone =
+vertex texture texture material
+0.500000 anim 1.0 1.0 1.0 1.0 1.0
+vertex = texture = bone vertex anim = bone
+bone texture 1.0 0.500000
+1.0 vertex texture frame anim
+anim = material = texture anim frame 0.500000 bone bone bone -1 0.500000 -1 = 1.0 vertex
+frame
+0.500000 -1 anim -1 -1
+= = frame material texture -1
+-1 0.500000 texture bone
+bone frame frame
+texture texture frame -1 = -1
+anim frame texture -1 vertex
+anim 0.500000 0.500000 1.0
+1.0 anim 1.0 texture bone -1
+vertex texture = anim bone
+1.0
+material
+texture texture
+texture -1 1.0 bone
+frame frame
+-1
+1.0
+-1 vertex vertex frame bone
+vertex vertex 0.500000
+frame material 1.0 frame
+vertex vertex 1.0 anim
+frame material bone -1 = anim material anim vertex frame -1
+bone texture anim vertex vertex
+bone 0.500000
+vertex = bone
+vertex texture frame
+material bone 0.500000 texture -1 bone bone -1
+vertex frame anim frame vertex = vertex =
+frame material -1 texture -1
+vertex
+vertex
+0.500000 anim bone anim = material vertex -1 material -1
+0.500000 0.500000
+texture anim -1 = vertex texture anim anim
+vertex
+0.500000 bone material -1 texture
+texture
+frame bone vertex
+bone -1
+-1 frame 0.500000 frame =
+texture
+-1 1.0
+anim 1.0 0.500000 vertex
+= vertex
+1.0 vertex
+material anim material frame 0.500000 material material texture bone 0.500000
+-1 0.500000 texture =
+frame
+anim material
+= material 1.0 -1
+vertex texture bone anim frame material frame
+0.500000 -1 1.0 0.500000 = material
+material bone
+1.0
+anim frame = material
+vertex
+anim 0.500000 1.0 -1 -1 = 1.0 texture 1.0 bone -1 vertex -1 anim frame anim
+0.500000 = texture material frame
+1.0 1.0 -1 -1 material anim texture frame texture
+-1 = bone frame 0.500000
+0.500000 anim 0.500000 frame
+-1
+material
+-1 material bone
+0.500000 frame =
+material vertex
+anim bone
+0.500000 bone material
+vertex frame
+frame frame texture 0.500000
+material vertex = texture -1 0.500000
+bone = -1 anim vertex bone
+frame
+bone
+bone 1.0 = texture = bone 1.0 frame anim texture 1.0
+vertex texture 1.0 bone material
+frame -1 -1 1.0 1.0 frame anim material -1 = frame
+texture 0.500000 frame vertex material = 0.500000
+material bone frame material
+material 1.0
+anim
+texture -1
+bone
+anim 0.500000
+bone 1.0
+texture texture bone = frame frame anim anim =
+vertex frame 1.0 0.500000 = = 1.0 anim 0.500000 0.500000 -1 vertex
\ No newline at end of file
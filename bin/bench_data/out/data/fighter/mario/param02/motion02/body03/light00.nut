@@ -0,0 +1,83 @@
+vertex
+frame material
+0.500000 -1 -1 1.0 1.0
+texture vertex
+texture vertex material 0.500000 0.500000 1.0
+vertex
+material =
+= 0.500000 1.0
+frame texture = = 1.0
+anim
+frame
+=
+1.0 bone frame vertex anim frame
+texture vertex texture = -1 anim
+= texture texture material 0.500000 -1 anim 0.500000 frame
+=
+texture 0.500000
+texture bone texture
+-1 material frame
+material = = = =
+material 1.0 = anim material 0.500000 =
+-1 = -1
+-1 texture bone material
+frame
+material 1.0
+0.500000 =
+-1
+texture vertex 0.500000 1.0 = texture vertex material texture material
+frame vertex texture vertex
+1.0 -1
+vertex anim frame 1.0
+material vertex
+1.0 texture
+-1 = anim frame material 1.0 frame
+anim
+1.0 frame 1.0 -1 texture 0.500000 material bone =
+-1 vertex anim 0.500000 1.0 0.500000 bone
+0.500000 texture
+material
+0.500000 -1
+vertex bone
+bone
+texture = bone 0.500000 material bone frame texture vertex frame bone frame
+vertex bone 0.500000 = -1
+1.0
+1.0 texture 1.0
+texture anim = frame bone material
+texture
+= vertex vertex
+bone bone bone
+bone frame = frame
+1.0 frame
+bone -1 = 1.0 texture
+frame = anim anim
+bone material
+frame
+frame 0.500000 material texture
+frame bone bone 0.500000 = texture
+1.0 -1 1.0
+0.500000 material
+anim texture vertex texture = frame
+bone
+material
+bone
+= =
+= anim anim
+= texture 0.500000
+0.500000 anim 0.500000 vertex 0.500000 texture
+frame -1 anim bone bone
+0.500000
+frame
+bone bone bone texture
+bone texture -1 0.500000 0.500000 texture anim 1.0 anim anim
+1.0 = bone = vertex bone = bone frame bone vertex 0.500000
+1.0
+frame
+frame texture -1
+1.0 -1
+material
+bone 1.0 material
+0.500000 vertex -1 -1
+-1 bone
+ver
\ No newline at end of file
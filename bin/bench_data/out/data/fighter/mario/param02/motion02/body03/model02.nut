@@ -0,0 +1,3 @@
+anim
+texture vertex texture
+vertex
\ No newline at end of file
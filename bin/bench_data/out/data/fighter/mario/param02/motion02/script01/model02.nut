@@ -0,0 +1,12 @@
+0.500000
+texture
+= vertex
+texture frame vertex
+0.500000 anim
+material frame bone bone 0.500000 material frame
+material -1 anim
+=
+0.500000 vertex material
+material
+bone
+anim texture texture = material
\ No newline at end of file
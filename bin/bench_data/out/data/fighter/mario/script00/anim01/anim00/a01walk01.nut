@@ -0,0 +1,129 @@
+1.0 0.500000 frame frame bone vertex
+anim = anim 0.500000 -1 frame texture bone bone 1.0 vertex
+1.0 -1
+frame
+texture texture bone
+texture 0.500000
+vertex texture
+=
+texture 1.0 1.0 vertex = material
+1.0
+anim bone frame bone bone
+bone anim -1 bone
+0.500000 = material -1 0.500000 0.500000 bone
+= frame
+anim material
+frame
+frame
+anim 0.500000 bone vertex -1 texture bone vertex vertex vertex texture texture material material
+texture texture = material material 0.500000 frame -1
+texture
+bone
+vertex
+1.0
+anim 1.0 material =
+-1 anim bone bone
+1.0
+texture
+material frame 1.0 1.0 bone frame vertex texture
+0.500000 bone texture
+1.0 vertex
+vertex frame
+anim anim
+vertex
+= bone
+vertex vertex
+bone 1.0 1.0 -1 frame vertex -1 =
+anim vertex frame
+=
+0.500000
+bone material frame 1.0 0.500000 texture bone -1 1.0 = texture 1.0 = vertex 1.0 frame vertex = vertex = bone bone material = 1.0 0.500000 vertex material
+texture vertex
+0.500000
+= frame
+= =
+0.500000 anim
+anim bone anim 0.500000 vertex
+anim material -1 -1 anim
+frame -1 frame = 1.0 material texture -1 anim
+bone = 1.0 material
+-1 material = vertex
+texture vertex frame
+vertex bone
+anim material
+frame material 0.500000 frame = frame
+vertex frame anim
+= = texture frame 0.500000
+bone -1 vertex material 0.500000 bone texture frame = -1 frame
+bone frame -1 1.0 material bone frame bone
+1.0
+vertex vertex
+frame anim = material material material
+bone anim frame frame vertex frame
+anim 0.500000 vertex = texture bone =
+texture -1
+bone -1 frame
+bone
+texture material frame = =
+material -1 texture 1.0
+bone material material material frame frame bone -1 bone texture vertex texture
+0.500000
+material -1 vertex
+vertex anim 1.0 texture 1.0 = 0.500000 1.0 bone frame
+bone texture anim = 1.0
+-1 -1
+texture bone material
+anim frame vertex 0.500000 = anim
+0.500000 0.500000 bone texture bone texture anim
+anim bone frame material 0.500000 material texture frame frame vertex frame -1 anim anim bone
+material 0.500000 frame = 0.500000 1.0 -1 0.500000 bone 1.0
+-1 frame -1 material texture = texture vertex
+frame 1.0 1.0 anim 1.0 material frame
+texture bone vertex
+bone
+= bone vertex 0.500000 = = anim
+0.500000 bone bone material anim material bone texture
+texture texture = material bone
+-1
+0.500000 =
+vertex
+texture 0.500000 anim material vertex 0.500000 0.500000 frame vertex texture bone -1 = = = texture anim
+= 1.0 bone
+texture -1
+-1
+-1
+frame = bone bone frame
+bone =
+texture frame
+anim 0.500000
+frame = bone 0.500000 frame -1 0.500000 vertex
+bone vertex anim
+vertex
+material anim 1.0
+texture
+texture material material material material frame material 1.0 bone bone -1 material
+= material vertex anim -1 = material
+= texture 1.0 material -1
+-1 -1 bone material frame frame material texture
+-1 vertex 1.0
+texture material frame frame vertex
+=
+=
+0.500000 material 1.0 -1
+anim anim frame
+frame bone anim
+-1
+= texture 1.0
+1.0 bone
+material
+material 0.500000 material bone
+texture
+anim = bone 1.0
+vertex -1 0.500000 frame bone
+1.0
+anim vertex anim anim bone texture
+bone
+1.0 anim
+=
+vertex
+texture bone
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame -1 frame vertex vertex material anim
+bone 0.500000 -1 texture
\ No newline at end of file
@@ -0,0 +1,7 @@
+frame
+= frame
+texture = bone
+bone vertex -1 0.500000 vertex 1.0 -1 anim vertex = bone = texture anim -1 texture vertex
+texture 1.0 = 0.500000 1.0 vertex anim 0.500000 bone -1
+-1 frame bone
+fra
\ No newline at end of file
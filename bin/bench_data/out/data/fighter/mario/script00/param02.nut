@@ -0,0 +1,153 @@
+texture = frame -1 material
+texture
+anim texture
+vertex anim 1.0 anim anim 0.500000 texture = -1 material texture texture
+=
+texture vertex -1 material
+texture -1 1.0 0.500000 material =
+anim 0.500000
+-1
+= = vertex material texture anim
+material
+vertex frame vertex -1 texture vertex material texture 0.500000 vertex texture frame
+0.500000 material 0.500000 frame bone
+bone 1.0 1.0 1.0 0.500000
+anim vertex material
+-1 material material anim bone texture frame bone 0.500000 -1 vertex frame anim = frame vertex texture
+bone frame 0.500000 vertex frame
+= -1 frame texture texture
+vertex material = 0.500000 1.0 1.0 bone frame
+anim 0.500000 0.500000 0.500000 material texture texture
+0.500000 anim
+material bone frame 0.500000 -1 1.0 1.0
+bone = -1
+vertex frame = material -1 -1
+-1 texture vertex anim material anim 0.500000 1.0
+vertex
+vertex 0.500000
+anim bone texture anim
+anim
+vertex anim
+1.0 0.500000
+texture frame = vertex anim 0.500000 texture -1
+vertex material bone texture
+vertex texture anim material texture vertex 0.500000 bone
+0.500000 vertex material texture 0.500000 anim frame 1.0 0.500000
+anim
+=
+-1 1.0 material 1.0 frame bone material = bone
+=
+texture
+1.0 material texture frame 1.0 material -1 anim bone 0.500000
+anim -1 frame 1.0 texture
+material frame =
+-1 material = bone
+material
+= frame bone 1.0
+-1 material texture
+vertex
+frame -1
+bone vertex texture bone material anim
+bone material -1 vertex
+bone bone bone = 0.500000 texture 1.0
+frame frame anim material vertex =
+1.0 bone bone anim texture texture anim =
+material frame = texture vertex
+frame = 0.500000 -1
+material vertex 0.500000 -1
+= bone frame material vertex 0.500000
+1.0
+0.500000
+material
+material frame 0.500000 1.0
+frame 0.500000 = bone 0.500000
+vertex frame material 0.500000
+-1 frame = frame texture
+bone
+=
+material texture
+= anim material bone
+bone anim
+frame material frame 1.0 -1 1.0 anim
+anim = vertex 1.0 vertex -1 anim = 1.0
+1.0 1.0 0.500000 material frame =
+0.500000 frame 1.0 frame
+texture frame texture -1 vertex anim 1.0
+= -1
+1.0 vertex frame
+= = anim =
+vertex
+bone 1.0 -1 frame material -1 frame =
+-1 1.0 = vertex
+0.500000 frame
+material bone 0.500000
+material vertex bone 0.500000 material vertex 0.500000 -1 1.0
+-1 = -1
+anim = anim
+anim 0.500000 material bone anim anim
+vertex vertex vertex anim vertex 1.0 1.0 1.0 material bone 0.500000
+-1 bone anim texture bone
+anim 1.0 material
+= vertex -1 bone texture anim bone 1.0 frame anim
+bone = vertex
+0.500000
+material
+-1
+frame 0.500000 =
+anim
+frame 0.500000 -1
+-1 -1 texture
+vertex = -1 -1 0.500000
+texture 1.0 = 1.0 texture vertex anim material
+anim vertex
+1.0 anim -1 material = -1
+-1 -1
+=
+1.0 0.500000 -1
+material -1 vertex
+vertex anim anim
+1.0
+material 1.0
+bone
+bone frame = 1.0 =
+anim
+0.500000
+texture frame
+anim 0.500000 0.500000
+bone 1.0 vertex anim frame
+frame vertex
+anim 1.0 vertex bone
+texture 0.500000 1.0 0.500000
+0.500000
+vertex
+bone 0.500000 0.500000 material = -1 1.0 1.0 anim anim frame
+-1
+0.500000 bone anim vertex vertex 0.500000 -1 =
+= frame 0.500000 bone -1 frame texture anim
+material 1.0 frame material -1 = bone -1 vertex bone
+texture anim
+anim
+anim anim material
+0.500000 anim material
+frame
+bone bone
+material 0.500000 vertex 0.500000 anim -1
+= bone bone anim frame anim vertex
+= bone -1 anim bone
+material vertex -1 = anim frame
+anim -1 -1 vertex vertex
+frame 1.0 anim =
+= =
+= bone 0.500000 0.500000 bone = frame =
+material frame vertex material 1.0 vertex -1 vertex
+1.0 bone bone
+vertex texture
+= 0.500000 vertex =
+vertex vertex 0.500000 texture material anim anim = = -1 vertex vertex material anim
+1.0 material material material bone texture = vertex bone 1.0 0.500000 anim
+texture material -1 -1 vertex frame = bone
+bone anim
+=
+frame
+vertex texture
+-1 
\ No newline at end of file
@@ -0,0 +1,86 @@
+anim frame texture frame -1 -1 0.500000 vertex
+vertex = 1.0 texture material
+-1 vertex 1.0 texture frame 1.0 0.500000 anim anim material anim 1.0
+=
+texture 1.0 texture = material = = material bone bone
+= 0.500000 vertex 0.500000 bone
+anim frame anim 0.500000 1.0 frame texture
+vertex bone 1.0 bone 1.0 frame
+anim
+1.0 bone texture texture
+vertex -1 anim
+0.500000 texture frame bone -1 vertex 0.500000
+material 1.0 -1 vertex =
+material texture 1.0 material bone -1 0.500000
+frame 1.0
+0.500000 texture anim frame material
+= vertex 0.500000 = vertex
+frame bone material 0.500000 material 0.500000
+texture
+0.500000
+material texture = anim anim
+0.500000 1.0 anim bone bone anim frame = 0.500000 -1 0.500000 -1 0.500000 vertex vertex
+material -1 0.500000 vertex frame vertex
+bone
+anim -1
+anim -1 material material = vertex vertex bone bone vertex
+1.0 material bone anim frame
+vertex anim anim bone texture
+1.0
+texture
+frame material texture 1.0
+0.500000 frame 1.0
+1.0 anim
+1.0 frame 1.0 = -1
+0.500000 frame vertex = frame bone
+vertex texture material anim
+frame = 0.500000 -1 bone
+bone vertex
+1.0 = 1.0
+vertex anim frame
+material =
+1.0
+frame -1 frame
+anim frame bone 0.500000
+bone -1
+0.500000 material
+anim texture 0.500000
+0.500000
+vertex material bone 1.0 frame material texture
+0.500000 0.500000 0.500000
+vertex 1.0 0.500000 vertex bone 0.500000 frame = texture
+-1
+anim anim bone = vertex -1 1.0 1.0 anim
+vertex
+texture 1.0 material = 1.0 bone frame
+0.500000
+-1
+texture -1 anim vertex anim bone -1
+vertex
+texture texture 0.500000 -1
+vertex texture 1.0 bone frame material = = 1.0 material anim anim anim 0.500000
+-1 texture material texture vertex -1 frame frame vertex frame vertex
+anim 1.0
+frame bone 1.0
+0.500000
+1.0 bone 0.500000
+frame texture = 1.0
+bone -1 texture
+0.500000 0.500000 -1 vertex bone 0.500000
+anim texture
+material frame
+vertex frame =
+anim material 1.0 0.500000 1.0 0.500000 anim frame anim = texture 0.500000 = material anim texture anim bone
+0.500000 anim anim
+0.500000 vertex 1.0 anim =
+texture =
+-1 0.500000 bone
+bone frame texture vertex 0.500000 = texture -1 vertex material
+frame
+bone
+-1
+vertex 1.0 =
+frame -1 vertex
+0.500000 1.0 anim vertex
+1.0 material texture
+texture texture vertex vertex bone vertex bone frame frame te
\ No newline at end of file
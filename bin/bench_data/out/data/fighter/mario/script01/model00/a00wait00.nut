@@ -0,0 +1,3 @@
+material 0.500000 0.500000
+material anim
+anim 
\ No newline at end of file
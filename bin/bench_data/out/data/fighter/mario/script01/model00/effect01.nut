@@ -0,0 +1,29 @@
+anim -1 1.0 material material 0.500000 anim material
+texture anim -1 = anim material
+texture -1 0.500000 bone 0.500000 texture 0.500000 0.500000 frame vertex = frame vertex frame -1
+anim material
+material
+anim
+-1 texture vertex frame
+1.0 vertex vertex texture frame
+vertex material 1.0 anim = bone frame
+texture
+vertex vertex
+1.0 = frame material anim -1
+1.0 bone anim anim material
+bone texture frame bone
+material -1 bone texture -1 frame 1.0 vertex vertex 0.500000 -1 vertex
+1.0 1.0 0.500000
+1.0
+material
+vertex 0.500000 anim =
+frame = bone
+vertex material anim
+vertex
+vertex -1 -1 anim bone material -1 texture -1 material
+0.500000 material texture texture -1 frame 0.500000 = texture vertex 1.0
+frame
+0.500000 0.500000 anim anim 0.500000
+material anim -1 material frame 0.500000
+frame
+frame material 1.0 = vertex vertex 
\ No newline at end of file
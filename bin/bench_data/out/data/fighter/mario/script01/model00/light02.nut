@@ -0,0 +1,132 @@
+1.0
+0.500000
+1.0 frame
+vertex vertex frame
+frame -1
+frame texture anim 0.500000
+vertex 0.500000
+0.500000
+vertex material
+bone 1.0 frame -1 bone
+material material 1.0
+0.500000 = frame texture bone vertex
+bone
+anim 0.500000 texture
+frame
+material frame frame vertex material anim texture 1.0 -1 0.500000 vertex material bone texture texture vertex = 1.0 1.0 1.0 material
+vertex -1 anim texture 1.0 bone material 0.500000
+0.500000 bone
+0.500000 texture vertex
+frame texture texture 1.0
+-1
+-1 1.0 texture
+-1 texture 0.500000 bone texture
+texture 1.0 1.0 1.0
+texture -1 = -1 bone 0.500000 anim 0.500000 1.0 texture bone bone anim
+vertex frame 1.0
+bone
+anim material 1.0
+= anim
+texture frame texture 0.500000 vertex texture vertex bone material
+vertex
+0.500000 anim vertex
+frame material 1.0 1.0 -1 anim frame 1.0 vertex anim = bone frame
+0.500000 -1 -1
+anim
+1.0 =
+vertex
+1.0
+0.500000 material anim
+bone vertex bone frame 1.0
+1.0 1.0 vertex texture texture bone material bone
+anim 1.0 vertex material
+=
+material anim frame
+0.500000 frame anim texture texture vertex texture material
+vertex -1 bone 1.0 texture material bone anim -1
+bone texture 0.500000 frame
+0.500000 texture material
+1.0 = = vertex anim 0.500000 vertex vertex = vertex bone frame 0.500000 vertex anim 1.0 anim -1 texture vertex material bone
+vertex bone frame
+texture
+-1 0.500000 frame frame vertex frame anim -1
+texture anim texture material -1 frame
+bone
+= texture texture
+bone
+anim vertex
+frame 1.0
+-1 texture texture = anim texture
+bone frame frame
+anim bone vertex 0.500000 texture
+frame vertex vertex texture anim vertex = vertex
+1.0 0.500000 = texture material frame
+0.500000 -1
+= = frame texture
+vertex
+-1 material 1.0 material
+bone =
+material anim
+texture
+bone frame
+-1
+bone =
+vertex
+frame 0.500000
+vertex
+material material -1 vertex 1.0
+0.500000
+frame bone anim material
+bone
+texture = 0.500000 texture vertex 1.0
+anim vertex texture bone vertex
+1.0 -1 1.0 vertex = 1.0 texture material
+1.0 anim bone bone
+vertex texture 0.500000 texture
+bone texture anim
+bone frame material vertex
+material vertex texture vertex
+texture bone 1.0 -1 1.0 0.500000 -1 frame frame 1.0
+0.500000
+0.500000 bone
+0.500000 material 0.500000 bone bone material -1 =
+anim bone anim 0.500000
+material vertex 1.0 0.500000 1.0 bone frame material -1 0.500000
+anim -1 material
+-1
+frame
+frame bone frame anim 0.500000 vertex 1.0 bone bone 1.0
+frame material bone texture
+frame 1.0 anim material material
+-1 -1 = material vertex texture material 1.0 material material -1 vertex
+1.0 texture bone 1.0 material 1.0 = 1.0 bone 1.0
+texture vertex vertex
+1.0 frame bone
+texture frame material 1.0 1.0 texture texture
+vertex anim vertex bone vertex vertex frame texture 1.0 bone material
+texture vertex texture texture anim frame 0.500000 -1 anim frame
+1.0 frame = vertex anim
+bone
+-1 texture frame frame material bone material frame material -1 material
+material vertex 1.0 vertex = texture
+bone anim
+-1
+-1
+bone 0.500000 =
+anim anim vertex bone
+1.0 1.0
+material frame material frame bone
+bone anim -1 frame 0.500000 -1 0.500000
+bone frame vertex anim -1 0.500000 = vertex vertex 0.500000 bone bone anim material 1.0 =
+material
+0.500000 texture -1
+-1
+-1
+bone texture bone frame
+0.500000 -1
+frame bone frame bone = = texture 0.500000
+texture = -1
+0.500000 = vertex texture 1.0
+texture texture 1.0 texture material bone
+bone texture texture vertex vertex
+mat
\ No newline at end of file
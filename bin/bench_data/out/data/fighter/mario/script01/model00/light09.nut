@@ -0,0 +1,54 @@
+frame -1 = 1.0 1.0
+anim 1.0
+material material frame anim
+1.0 anim
+anim anim material frame bone
+frame
+=
+0.500000 vertex frame 1.0 -1 material
+anim =
+= frame vertex material
+-1 bone -1 = anim =
+vertex material 1.0 1.0 1.0 vertex 1.0 = 0.500000 0.500000
+bone bone frame
+= -1 material = vertex
+texture anim 1.0
+vertex 1.0 material vertex -1 vertex frame bone 0.500000
+-1 material anim
+material material
+frame
+bone texture
+texture 1.0 material frame
+texture
+vertex bone
+-1 0.500000 material
+vertex
+bone 0.500000 anim -1 texture anim -1 vertex vertex material bone 1.0
+1.0
+anim
+texture anim material frame
+frame
+-1 bone anim
+-1 frame texture
+vertex 0.500000 0.500000 -1
+-1 = = -1
+vertex frame
+bone 1.0 = texture 1.0 anim 1.0 texture
+=
+= texture frame frame -1
+vertex vertex
+= -1 frame frame bone = = 0.500000 bone
+anim 0.500000
+frame frame
+anim = -1
+-1 0.500000 bone -1 material
+bone bone vertex
+texture material 1.0 vertex 0.500000 vertex 0.500000 texture 0.500000 vertex frame =
+= vertex
+bone
+texture -1 0.500000 anim
+bone vertex
+bone = material anim =
+vertex
+1.0 frame = vertex bone texture material 0.500000 material
+material material frame anim 1.0 bone 
\ No newline at end of file
@@ -0,0 +1,100 @@
+1.0 material
+material
+1.0 = -1 = 1.0 0.500000 1.0 0.500000 texture
+-1 texture 0.500000
+bone anim
+bone 1.0
+texture frame
+material 1.0 frame
+0.500000
+anim
+frame anim
+material bone anim 1.0 = = =
+texture = bone anim vertex bone frame bone bone bone texture
+material anim vertex
+1.0 1.0 texture bone material -1 1.0 0.500000 1.0 = material anim
+vertex material 0.500000
+texture
+= frame material bone
+frame material
+texture -1
+vertex 1.0 texture
+material
+anim
+= texture anim material frame
+bone anim 0.500000
+1.0 = 0.500000 texture
+1.0 texture material bone material
+-1 vertex vertex
+frame anim bone material anim 1.0
+1.0 anim bone material =
+0.500000 0.500000 texture frame vertex material texture 1.0 frame 0.500000
+1.0 -1 0.500000
+texture
+texture vertex
+material 0.500000
+anim
+texture anim material material
+1.0 material 0.500000 anim
+0.500000 anim
+texture 0.500000 anim
+frame
+0.500000 1.0 -1
+1.0 1.0 = material = anim 0.500000 vertex -1
+1.0 -1 frame frame vertex 0.500000 material material texture material frame
+frame 1.0
+-1 material bone texture anim =
+1.0 frame material frame vertex anim 0.500000 0.500000 0.500000 frame 0.500000
+frame anim -1
+bone -1 0.500000 anim
+bone -1 bone
+0.500000 1.0 texture
+1.0 0.500000 texture vertex material texture -1
+bone
+anim bone 1.0 frame 0.500000
+material
+1.0 texture material -1
+0.500000 = = 0.500000 1.0
+frame vertex -1 texture 0.500000 material anim frame material 1.0 = bone material
+0.500000 vertex -1 bone material anim -1 0.500000
+texture 1.0 texture = frame 1.0
+material
+bone anim
+= texture -1 -1
+texture = vertex vertex =
+texture 0.500000 bone 1.0 -1 -1 -1
+-1
+texture -1
+frame texture
+texture
+material
+texture
+anim frame
+vertex anim bone frame
+1.0 -1 anim texture
+texture
+anim =
+texture anim bone bone anim
+0.500000 bone = material
+1.0 = bone 1.0 material texture 0.500000 anim 1.0
+bone 0.500000 bone
+bone vertex frame material =
+vertex material 0.500000 texture frame vertex =
+-1 vertex
+texture 0.500000 1.0 = texture =
+material
+anim
+bone =
+= anim frame
+texture = vertex -1 =
+anim material frame
+frame material
+vertex bone material bone
+frame frame 1.0 -1
+0.500000 frame = -1 bone texture texture
+texture texture vertex frame
+0.500000 texture
+-1 vertex
+material texture = anim 1.0 frame bone vertex frame anim texture
+0.500000 -1 0.500000
+vertex bone
\ No newline at end of file
@@ -0,0 +1 @@
+frame frame material material anim -1 1.0 = = material textur
\ No newline at end of file
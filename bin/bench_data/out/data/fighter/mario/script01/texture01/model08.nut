@@ -0,0 +1,5 @@
+= 0.500000 bone 1.0 -1 =
+frame texture vertex
+=
+bone
+vertex
\ No newline at end of file
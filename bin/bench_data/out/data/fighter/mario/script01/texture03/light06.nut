@@ -0,0 +1,9 @@
+m-.=`:u9)-l%69!U
+v1i6|w,L^疪
+>!<<Hܡ
+_ց noy)mxѿ7ZxC)=:2'Ihxiy#?&pQzwu[#ռLJ
+ML]ٌ0l4?,FSF1([kcpKW,QYI}\\2Vo|)0~ٱiF/Z ~fqP"&W񨮤[;6咯1](!m#:ō?w抾6^[|iQJ01/O5
+VYMϊ0Cb=XLh[I-˝	9h5?~Z0,"Y(6w8<1LeksQj/$pB+s{Q
+{{Imw]a(@G=fEg,~b룆-
+!r֨"
+qN:tq8z}:<%
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim = 0.500000 material
+material
\ No newline at end of file
@@ -0,0 +1,11 @@
+= -1
+texture material = material texture bone
+material texture
+-1 1.0
+= anim =
+0.500000 texture = -1 0.500000 -1
+1.0 material frame
+frame
+vertex
+0.500000 vertex
+1.0 frame 
\ No newline at end of file
@@ -0,0 +1,7 @@
+= bone
+frame bone material
+=
+material material texture 0.500000 vertex material = 0.500000 1.0 0.500000 1.0
+0.500000 bone material 1.0
+texture -1 texture
+vertex anim anim 1.0 0.500000 ve
\ No newline at end of file
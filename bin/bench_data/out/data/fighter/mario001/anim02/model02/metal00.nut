@@ -0,0 +1,74 @@
+= =
+0.500000 bone
+-1 vertex frame vertex
+texture = vertex material
+bone anim anim bone 0.500000
+frame texture vertex =
+0.500000 anim material
+bone
+vertex = vertex vertex frame bone texture material
+anim vertex = -1 anim anim texture
+material
+= frame
+anim anim 0.500000 0.500000 frame bone
+bone
+-1
+0.500000 material 0.500000 anim
+bone
+vertex -1 vertex -1 frame
+=
+bone bone material 1.0 texture -1 texture texture anim texture
+anim
+vertex
+texture material bone material bone 0.500000
+0.500000 -1
+vertex 1.0 frame vertex bone bone material = 1.0 0.500000 material -1 0.500000 1.0
+material texture 0.500000 texture 0.500000 1.0 1.0 =
+0.500000 frame
+frame
+anim
+vertex
+= -1 0.500000 anim
+anim vertex
+0.500000
+frame = anim bone
+= frame vertex 0.500000 material
+0.500000 material bone
+=
+frame = anim frame
+1.0 anim
+vertex 0.500000 texture =
+bone vertex 0.500000 vertex texture -1 vertex texture
+1.0 = vertex -1 =
+bone =
+bone texture 0.500000 1.0 vertex
+1.0
+= anim
+0.500000
+material -1
+0.500000 1.0 texture anim -1 vertex anim texture 1.0 anim frame vertex frame
+1.0 = bone anim frame =
+-1 -1
+anim 1.0
+frame texture 0.500000 = 0.500000 1.0 = -1 frame texture
+anim frame 0.500000 =
+vertex
+=
+bone
+-1 bone -1
+frame =
+texture -1 texture
+anim anim bone texture -1 frame -1 material material
+material
+frame
+material texture 1.0 bone texture anim =
+= vertex anim
+material material
+bone material bone material
+vertex frame material texture bone 0.500000
+bone material frame bone frame -1 material
+0.500000 anim material
+frame -1 frame anim texture vertex -1 = material texture
+vertex anim
+frame material = vertex 1.0 1.0
+texture 0.500000 = m
\ No newline at end of file
@@ -0,0 +1,34 @@
+1.0 bone 0.500000
+texture 1.0 material = frame anim
+texture texture
+0.500000
+material = bone vertex
+vertex -1 1.0 0.500000
+= -1
+texture
+anim
+0.500000 = 1.0 material material
+= 0.500000 texture vertex bone = -1
+bone bone = -1 frame
+bone
+bone 0.500000 bone anim bone 0.500000 material
+frame material bone vertex vertex
+material
+vertex
+texture = material -1
+vertex
+-1 0.500000 material = vertex bone
+1.0 material = = material anim bone material =
+anim
+bone 0.500000
+-1
+frame material = frame bone anim frame 1.0 1.0 vertex
+texture frame frame
+anim
+anim
+= 0.500000 0.500000 material material bone frame vertex
+frame anim 0.500000 frame = vertex 1.0 frame texture = 0.500000 material -1 texture bone texture
+bone anim
+-1 = texture 0.500000 material vertex -1 frame vertex =
+0.500000 material
+vertex frame material material frame material vertex v
\ No newline at end of file
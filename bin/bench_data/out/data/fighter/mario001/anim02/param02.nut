@@ -0,0 +1,2 @@
+~* T4{
+YH-1ǈ;
\ No newline at end of file
@@ -0,0 +1,24 @@
+frame 1.0 material
+1.0
+texture -1
+= =
+texture bone material
+frame
+1.0 = frame
+-1 -1 1.0 material bone 0.500000
+bone material 0.500000 -1
+vertex frame = vertex 1.0
+frame anim
+0.500000
+= = anim anim 1.0 0.500000 =
+= anim 1.0 frame = anim vertex
+0.500000
+0.500000 material
+material frame anim anim texture
+texture
+vertex -1
+anim bone -1
+anim -1
+material anim texture
+= = 0.500000 =
+0.500000 = 0.500000 vertex = bone = -1 bon
\ No newline at end of file
@@ -0,0 +1 @@
+b2>{'68G	ء2\.G-iQ)r%&XԻ6i:*Hy 7E@;h90PfS҃`oP06gSx&3U1*dMjY^*c|fP5K"Cdzy#,'aQ
\ No newline at end of file
@@ -0,0 +1,59 @@
+1.0 bone
+anim
+vertex
+texture texture
+0.500000 vertex texture
+-1 anim 1.0 bone
+vertex anim
+material 1.0 vertex texture material vertex frame anim anim bone frame vertex -1 -1 1.0 1.0 vertex anim material vertex
+texture 0.500000 vertex anim
+bone -1 bone 1.0 = vertex -1 0.500000 0.500000 1.0
+material -1 -1 = 1.0
+-1 =
+bone
+=
+texture 0.500000 -1 material
+0.500000 1.0 bone anim frame = vertex material material 1.0
+1.0 anim
+= 1.0 bone vertex 0.500000 texture
+vertex -1 vertex frame texture frame texture 1.0 vertex texture 1.0 material 0.500000 texture = 0.500000 vertex vertex =
+=
+-1
+vertex -1 bone
+0.500000 1.0 bone bone 1.0 frame = frame
+anim texture anim -1 = anim
+0.500000
+anim frame =
+-1 1.0
+0.500000 1.0 0.500000 0.500000 -1 = -1 bone 0.500000
+-1 vertex -1 = bone frame vertex =
+-1 material texture
+1.0
+= vertex
+vertex bone
+anim texture
+bone material
+vertex vertex texture
+material texture material = vertex = vertex 1.0 bone texture texture texture texture
+material
+0.500000
+material texture
+1.0 anim
+0.500000
+bone 1.0
+anim
+frame 1.0 -1 texture anim anim anim bone
+0.500000 material
+vertex texture
+material frame 1.0 1.0 -1
+material 0.500000
+1.0 frame
+=
+bone 0.500000 frame 1.0
+texture -1 texture
+bone
+texture
+texture anim 1.0 =
+= texture =
+material =
+1.0 ve
\ No newline at end of file
@@ -0,0 +1,17 @@
+0.500000 0.500000 -1 0.500000 anim vertex texture 0.500000 1.0 1.0 bone
+bone 0.500000 bone material frame bone texture 1.0
+anim
+bone vertex frame 1.0
+-1
+frame -1 frame texture material
+material texture vertex
+bone frame
+anim
+material bone
+material -1 material material frame
+bone 0.500000 bone 1.0 1.0
+anim 0.500000
+0.500000 = 1.0 1.0
+0.500000 0.500000 bone material -1 = 1.0 0.500000 frame texture vertex = vertex texture vertex =
+1.0 1.0 0.500000 frame
+anim f
\ No newline at end of file
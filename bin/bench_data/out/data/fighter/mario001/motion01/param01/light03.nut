@@ -0,0 +1,147 @@
+material -1
+anim anim vertex anim = material anim frame bone texture
+vertex -1 material anim anim frame 0.500000 1.0 vertex 1.0 vertex 1.0
+-1 = material
+texture
+texture
+vertex material anim -1 =
+bone anim -1 frame
+1.0 vertex texture frame material
+texture =
+0.500000 1.0
+anim
+material anim bone 0.500000 1.0 frame frame
+0.500000
+-1 frame
+bone anim anim
+texture vertex frame = frame 1.0 anim frame
+material vertex 1.0 texture texture material material bone bone texture anim -1
+=
+0.500000
+vertex bone vertex = = 1.0
+frame -1 0.500000 bone
+1.0 anim
+frame = -1
+=
+vertex = bone
+= texture -1 texture material texture =
+vertex -1 frame material vertex texture
+0.500000 bone -1 -1
+0.500000 texture 0.500000 bone
+1.0 1.0 frame 1.0
+texture 0.500000 bone
+bone
+bone
+0.500000
+anim texture anim
+texture texture bone 0.500000
+1.0 0.500000 =
+bone = vertex anim = material
+vertex material
+= bone texture 0.500000
+= -1 material bone
+material anim bone
+-1 -1 = = anim 1.0
+0.500000 0.500000 texture anim bone
+vertex
+vertex texture bone bone -1
+material 0.500000 frame 0.500000 -1 material
+0.500000 material 1.0
+texture
+bone material 0.500000 anim
+0.500000 frame bone
+vertex
+0.500000 bone = anim = texture vertex frame -1 = anim
+texture -1
+vertex
+0.500000
+material material material -1 1.0
+vertex
+material 0.500000
+0.500000 frame =
+anim
+-1
+bone =
+anim material
+texture texture bone
+= material = material anim anim anim anim
+-1 material = anim -1 = vertex anim -1 vertex =
+frame vertex frame bone bone
+material material 1.0
+-1 0.500000 = anim material material frame
+frame
+= vertex
+frame texture anim
+bone
+1.0 =
+frame
+bone bone frame -1 material anim
+material frame
+texture vertex 0.500000
+0.500000 texture 1.0 0.500000 vertex bone material texture anim vertex anim anim material texture = 0.500000
+material frame = material -1 vertex material anim vertex
+material
+-1 bone -1
+texture
+bone 0.500000
+anim
+anim -1 frame -1 1.0 texture
+0.500000 vertex bone material -1
+material = frame
+texture
+1.0 -1
+bone frame frame texture
+vertex anim texture
+material material
+-1 material frame = material
+texture 1.0 vertex
+bone material 0.500000 1.0 vertex bone -1 frame -1
+texture 0.500000 =
+vertex
+= texture 0.500000 vertex 1.0
+1.0 frame
+0.500000
+anim material vertex 0.500000 bone anim
+bone 0.500000 bone
+texture = bone
+-1 vertex texture anim
+vertex vertex anim =
+anim texture material
+frame 0.500000
+0.500000 =
+vertex = frame frame
+0.500000 =
+vertex bone
+material
+texture -1 frame anim =
+-1 0.500000
+=
+bone = -1 0.500000
+anim
+1.0
+= texture material bone vertex
+anim 1.0 0.500000 -1 frame frame
+anim anim vertex bone 1.0
+1.0
+texture material texture 0.500000 vertex vertex -1 frame -1
+frame texture -1 bone anim 1.0 frame bone -1
+anim bone 0.500000 frame -1 frame bone texture = anim
+bone 1.0 -1
+texture vertex 0.500000
+vertex bone vertex
+= = = frame material
+0.500000
+frame bone bone -1 texture 0.500000 material 1.0 -1 bone
+material frame texture
+frame vertex
+anim = texture bone vertex
+-1 1.0 bone -1 anim
+frame = anim 0.500000 0.500000 -1
+1.0 texture
+material
+= anim material
+-1 texture vertex texture -1 bone frame 1.0 vertex vertex
+0.500000
+1.0
+-1
+0.500000 1.
\ No newline at end of file
@@ -0,0 +1,15 @@
+vertex vertex texture
+= 1.0
+=
+frame bone material 1.0 1.0 =
+-1 bone
+texture
+frame vertex
+material
+anim 0.500000 1.0 anim
+frame 1.0 material
+frame
+bone bone texture 1.0 vertex anim
+=
+1.0 -1
+material bone =
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex -1 1.0 =
+-1 material anim texture frame
\ No newline at end of file
@@ -0,0 +1,6 @@
+frame vertex
+frame 0.500000
+vertex
+0.500000
+-1 anim 1.0 material
+ma
\ No newline at end of file
@@ -0,0 +1,14 @@
+0.500000
+material =
+bone vertex
+bone bone material anim
+texture -1
+frame
+texture 0.500000 1.0 1.0 1.0
+vertex 1.0 -1 bone vertex bone
+material -1 0.500000 material anim bone
+vertex bone -1 material anim vertex
+= vertex 0.500000 0.500000 frame
+anim bone
+1.0 vertex 0.500000
+1.0 mat
\ No newline at end of file
@@ -0,0 +1,63 @@
+1.0 = vertex bone frame =
+1.0 vertex -1 texture bone = texture vertex anim bone = vertex vertex 0.500000
+vertex
+0.500000 frame
+anim = vertex 0.500000
+-1
+0.500000 0.500000 texture frame anim anim material 0.500000 vertex = vertex -1 1.0 1.0 1.0 bone = 0.500000 material 1.0
+material frame vertex anim -1
+1.0 material 0.500000
+vertex
+= texture frame texture material
+-1
+0.500000 bone frame bone material = vertex vertex -1 bone frame 1.0 frame
+0.500000 0.500000
+1.0
+-1
+anim material frame anim anim
+-1
+frame texture material bone = anim material 1.0 -1 vertex = 0.500000
+-1 bone =
+1.0 frame vertex anim
+frame texture 0.500000
+frame texture
+frame = frame
+texture
+-1
+1.0 anim vertex anim
+material material
+= vertex material
+texture
+texture -1 frame frame -1
+0.500000 = anim 1.0 vertex
+= bone texture
+1.0 bone
+anim
+material bone
+= 1.0 1.0 bone bone bone
+= anim 0.500000 frame texture = vertex
+bone bone = = texture texture 0.500000 -1 material anim texture
+1.0 = 0.500000 texture texture anim bone =
+bone texture texture
+= 1.0 vertex anim =
+frame frame =
+1.0 0.500000
+material bone -1 0.500000
+anim bone material
+bone bone -1
+-1 material -1 -1 -1 texture
+0.500000 texture
+anim anim 1.0 texture -1
+= 1.0 bone vertex 0.500000 -1 1.0 0.500000
+frame =
+bone frame material = texture =
+material
+0.500000
+vertex 1.0 vertex texture
+=
+anim 0.500000 -1 frame = 0.500000 material material anim
+-1
+1.0 0.500000 anim frame
+0.500000 material
+= material vertex 1.0 0.500000
+frame = -1 anim 1.0 vertex texture 1.0 0.5
\ No newline at end of file
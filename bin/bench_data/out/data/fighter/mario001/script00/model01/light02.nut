@@ -0,0 +1,66 @@
+1.0
+vertex 1.0
+-1 = bone anim
+vertex = -1
+frame bone
+texture 1.0 anim bone
+bone
+texture 0.500000
+-1 texture =
+vertex -1 anim frame
+1.0
+= 1.0 material frame material bone
+frame bone -1 bone bone vertex 1.0
+frame frame
+texture 0.500000 frame
+1.0 vertex texture material frame
+anim
+vertex
+anim vertex
+=
+bone anim -1 1.0
+frame
+-1 frame frame anim
+vertex texture 1.0 frame frame material vertex -1
+frame vertex
+bone 0.500000 0.500000 texture
+-1 = vertex frame
+material vertex bone
+vertex
+vertex frame frame vertex
+bone texture 0.500000
+texture frame frame 1.0
+material = 1.0 -1 -1 -1
+= = 0.500000 1.0
+anim
+frame anim vertex material
+texture texture material vertex
+material bone
+vertex frame -1 1.0
+frame 0.500000
+anim
+1.0 = -1 frame 1.0 bone -1 vertex
+frame -1 1.0 = bone anim bone bone material 0.500000 vertex bone
+= material 0.500000 0.500000
+anim frame
+anim =
+1.0 anim vertex 1.0
+1.0 1.0 0.500000 frame vertex = 1.0
+anim material 0.500000 0.500000 1.0 bone anim
+anim 0.500000 bone vertex
+bone
+1.0 0.500000 =
+material =
+-1 bone anim texture 1.0 vertex
+=
+=
+frame vertex anim
+-1 0.500000 = = frame frame
+material
+0.500000 frame 1.0 material 1.0 material
+1.0 anim
+material material frame anim -1
+material
+= 0.500000 -1 anim bone texture 0.500000
+texture 0.500000 vertex frame =
+frame material
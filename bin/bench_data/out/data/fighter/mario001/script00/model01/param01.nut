@@ -0,0 +1,74 @@
+texture
+texture = 1.0 vertex -1 = material bone vertex
+0.500000 frame -1 texture -1
+0.500000 vertex frame
+-1 -1 0.500000 vertex frame material 0.500000 0.500000
+vertex 1.0
+frame vertex bone
+bone texture
+bone = 0.500000
+= material 1.0 bone anim 1.0 bone anim anim anim
+texture material
+material
+1.0
+= = anim = material
+0.500000
+bone
+=
+texture = vertex =
+-1
+anim material frame = vertex bone 0.500000
+anim 0.500000
+vertex
+vertex
+1.0 texture
+1.0 =
+= texture
+0.500000 1.0 -1
+0.500000 anim =
+frame 1.0 0.500000 1.0 frame
+bone
+1.0
+material vertex
+= vertex anim anim anim bone
+frame = texture
+material =
+=
+0.500000 material anim vertex = frame -1 0.500000 bone
+material 1.0 texture
+= 0.500000 material frame
+material
+anim anim
+texture texture -1 vertex
+bone vertex
+0.500000 1.0 vertex frame anim -1 bone vertex 0.500000 0.500000 -1
+-1 vertex 0.500000 frame frame frame
+frame frame texture
+=
+texture
+vertex vertex bone
+texture bone anim = 1.0
+material material bone 0.500000 material
+anim = 0.500000 vertex frame material anim 1.0 frame
+0.500000 texture 1.0 = bone
+1.0 texture
+-1
+material =
+material material = 1.0 material texture material material bone material material bone anim = texture 0.500000 0.500000 0.500000 material
+0.500000 vertex bone 0.500000
+1.0 -1 texture
+= 0.500000 0.500000 anim 1.0
+-1
+bone
+bone material texture 1.0
+texture bone
+material
+frame
+bone
+1.0
+anim 1.0 texture
+bone
+material bone frame 0.500000 1.0 material material
+texture
+1.0 frame
+texture
@@ -0,0 +1,113 @@
+1.0
+=
+texture 0.500000 material = anim
+texture 0.500000 vertex anim frame
+vertex 0.500000 =
+material texture bone material vertex -1 -1 bone 0.500000 frame bone bone anim = bone frame
+0.500000 -1 texture
+frame
+frame 1.0
+=
+texture anim texture = 0.500000 texture
+0.500000 -1
+bone vertex =
+frame material material texture 0.500000 frame anim -1 -1 -1
+bone texture anim = frame = -1 frame frame texture material frame
+bone frame = =
+material material
+= = vertex 0.500000 0.500000 material material material 1.0 bone vertex -1 material
+frame material material frame
+1.0
+anim = 0.500000 1.0
+0.500000 = texture frame frame
+bone
+= frame
+texture material frame
+1.0 = bone
+frame material -1
+frame
+0.500000 0.500000
+texture = 0.500000 1.0
+0.500000 bone vertex frame anim -1
+frame 0.500000 0.500000 1.0
+0.500000 0.500000 frame = material anim -1 bone anim = vertex
+anim texture 0.500000 material bone texture -1 texture = -1 bone frame frame 1.0 -1 material 1.0 anim bone = bone frame anim = -1
+texture material bone vertex -1 vertex
+0.500000
+-1 0.500000 vertex = anim material
+= vertex texture -1 1.0 anim
+1.0 texture vertex = -1 vertex frame 0.500000 1.0 0.500000 anim 0.500000 anim texture frame
+1.0 1.0 0.500000 material texture anim = vertex frame anim vertex 0.500000 material frame -1 = 0.500000
+-1
+-1 = material
+0.500000 anim
+vertex bone anim bone anim 0.500000 texture
+frame
+bone 1.0 anim
+material anim 0.500000 material = 1.0 anim -1 0.500000 anim -1 frame 0.500000 anim
+texture vertex = material
+= -1 -1 0.500000
+0.500000
+0.500000 0.500000 vertex bone -1 bone =
+vertex
+vertex -1
+bone 1.0 vertex -1 anim anim
+vertex frame -1 0.500000 -1
+0.500000
+= material 1.0 vertex
+1.0 texture texture
+bone
+vertex
+bone
+texture = vertex vertex
+0.500000 -1 bone
+-1 texture -1
+1.0 material
+anim 1.0 anim texture
+frame frame
+1.0 1.0 1.0 1.0 anim
+bone
+frame 1.0 anim material anim
+-1 frame frame anim 0.500000 frame -1 = 1.0
+-1 0.500000
+material material anim
+frame
+0.500000
+vertex 0.500000
+= = -1 frame 1.0 1.0 frame anim -1 0.500000 frame
+1.0 anim vertex material = anim
+-1 texture
+texture
+vertex anim -1 material material anim
+frame material vertex anim anim texture
+anim = texture
+material -1 0.500000
+1.0 =
+texture anim bone = = anim
+texture
+= 0.500000 anim bone vertex anim
+vertex texture material 0.500000 1.0 0.500000
+anim texture material 1.0
+-1 -1 vertex 1.0
+vertex material frame
+texture bone
+bone
+= 0.500000 1.0 = 0.500000 bone bone 0.500000 = 0.500000 0.500000 1.0 0.500000 -1 bone frame
+material = -1
+1.0 0.500000 0.500000
+anim 1.0 vertex
+texture anim -1 bone anim vertex vertex 0.500000 1.0 material frame -1 vertex bone frame vertex anim 1.0
+frame bone bone material
+material
+1.0 frame texture
+bone anim -1 material material bone -1 frame anim 0.500000 texture
+bone material 1.0 vertex material
+anim material 1.0 texture
+frame
+-1 material -1
+material
+= vertex 1.0 texture texture texture
+vertex material 1.0 frame anim material bone frame anim material material texture bone
+anim texture vertex
+vertex texture 0.500000
+0.500000 ver
\ No newline at end of file
@@ -0,0 +1,18 @@
+texture -1
+bone texture -1 texture anim -1 texture = -1
+bone texture texture texture material 0.500000 0.500000 -1 0.500000 anim frame = texture material material =
+= = -1 material texture
+material -1
+-1 0.500000 texture frame -1 1.0
+bone
+= anim
+frame
+0.500000 texture texture 1.0 bone frame -1
+frame vertex anim anim bone
+texture texture
+=
+1.0 =
+0.500000
+vertex bone frame
+material -1 texture
+1.0 frame ver
\ No newline at end of file
@@ -0,0 +1,7 @@
+-1 vertex
+1.0 texture material material vertex bone anim 0.500000
+frame vertex
+material frame 1.0 0.500000 -1 frame -1 = frame -1 vertex 0.500000
+= = anim material
+0.500000 vertex frame texture frame texture 1.0 material anim 0.500000 texture bone material = 0.500000 texture bone 1.0 0.500000 vertex =
+= te
\ No newline at end of file
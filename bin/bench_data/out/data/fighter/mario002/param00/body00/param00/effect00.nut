@@ -0,0 +1,27 @@
+1.0
+anim vertex bone anim frame texture
+bone anim 0.500000 material anim
+anim 1.0
+bone
+material -1 texture vertex = vertex
+frame frame vertex
+anim
+material material vertex material
+material frame 1.0 material material anim texture texture 0.500000 = texture
+= bone
+=
+anim 0.500000
+anim -1 -1
+material bone vertex -1
+0.500000 bone vertex texture 0.500000 anim -1 1.0 anim material frame -1
+=
+0.500000 0.500000 -1 1.0
+anim frame
+0.500000 vertex 0.500000 frame material 1.0
+bone -1 bone
+-1
+frame = 0.500000
+1.0 = frame
+frame bone material
+anim -1
+frame material -1 textur
\ No newline at end of file
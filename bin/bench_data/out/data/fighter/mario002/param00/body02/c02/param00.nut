@@ -0,0 +1,79 @@
+bone
+-1
+1.0
+anim vertex frame 1.0 anim = anim bone 1.0 bone vertex -1
+anim texture -1 = material bone
+material 1.0
+1.0
+= texture 1.0 -1
+texture
+-1
+vertex 0.500000 texture -1 1.0 0.500000
+1.0 material bone
+texture 0.500000 anim
+frame material anim material bone anim
+-1 frame 0.500000
+1.0 frame 0.500000
+material bone 0.500000 1.0
+anim anim
+texture material anim bone bone -1 0.500000 1.0 texture = 1.0 -1 bone 0.500000 bone material frame bone frame = = bone 1.0
+material -1
+anim frame 1.0 0.500000
+= =
+anim
+= texture = anim
+1.0
+texture vertex
+1.0 0.500000
+anim anim -1 frame
+1.0 material -1 frame
+vertex frame = texture anim -1 bone material texture bone texture 1.0 0.500000 anim
+-1 bone anim = frame material
+0.500000 1.0
+anim
+vertex
+material
+texture bone frame bone texture
+material frame material
+anim
+bone = material 1.0 material 0.500000
+frame 0.500000 bone -1 anim frame
+bone vertex bone
+= vertex anim 0.500000 1.0 bone anim = 1.0 bone
+vertex anim vertex vertex texture bone = material texture
+frame material =
+frame
+= 1.0 =
+frame 0.500000
+0.500000 -1 bone texture -1 material 0.500000 bone bone = frame texture bone
+frame 0.500000
+1.0 -1 1.0 anim frame frame =
+0.500000 frame frame -1
+= = texture
+0.500000 -1
+=
+= vertex material = texture material texture 0.500000
+-1
+-1 bone 0.500000 vertex 1.0
+-1 vertex 0.500000
+bone texture
+anim texture frame
+1.0 -1 anim bone material = anim texture
+anim -1
+0.500000 vertex
+= frame =
+-1 vertex 1.0 anim frame frame vertex -1 frame 0.500000 1.0 1.0 texture 1.0
+vertex -1 bone
+0.500000 -1
+frame vertex
+texture 0.500000 material
+anim
+0.500000 0.500000 material = frame material
+frame vertex
+0.500000 -1
+vertex bone
+anim vertex 0.500000 material
+bone texture
+anim bone 1.0 =
+frame material
+-1 texture texture frame anim
\ No newline at end of file
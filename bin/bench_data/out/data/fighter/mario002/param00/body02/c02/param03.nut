@@ -0,0 +1,32 @@
+anim
+vertex
+1.0 vertex frame texture
+frame anim
+texture bone material = texture
+-1
+1.0 bone = 0.500000 texture material 0.500000 vertex = anim = frame 1.0
+vertex
+bone
+bone
+1.0 bone 1.0
+frame texture bone frame 1.0 1.0 0.500000 texture anim 0.500000
+vertex = 1.0 0.500000 = 1.0 = bone = -1 bone material -1
+texture
+texture
+bone
+anim texture
+material bone
+-1 texture bone frame
+material =
+1.0 anim bone
+= -1 frame 0.500000 1.0 0.500000 -1 bone bone
+anim
+=
+bone
+bone texture anim material 0.500000 0.500000 = = vertex vertex 0.500000 vertex -1 anim material -1 bone -1 0.500000
+material 1.0
+0.500000
+-1 bone
+bone
+1.0 material
+anim texture 1.0 vertex 1.0 vertex 0.5
\ No newline at end of file
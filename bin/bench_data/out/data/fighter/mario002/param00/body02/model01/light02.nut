@@ -0,0 +1,47 @@
+1.0 material =
+1.0 vertex anim bone anim
+anim
+-1 frame -1 = 1.0 0.500000 1.0
+= anim
+1.0 material
+vertex anim -1 0.500000 frame anim vertex -1 = = vertex anim -1
+frame -1
+texture 0.500000
+frame bone
+0.500000
+texture 1.0 = bone bone texture anim -1 bone texture frame bone 0.500000 = -1
+vertex frame bone bone
+= = -1
+texture
+0.500000 frame material bone material bone frame frame vertex bone bone frame 0.500000 texture bone 1.0 frame vertex
+material anim -1
+1.0 bone 0.500000 -1
+texture 1.0
+anim
+material material frame vertex -1
+1.0 -1 vertex = frame material
+-1
+0.500000 vertex -1 anim -1 bone
+-1
+anim = = vertex
+texture 0.500000 bone
+bone 0.500000 vertex 1.0 material 1.0 =
+vertex material anim = anim anim
+texture
+1.0 frame -1 vertex frame =
+0.500000
+anim
+texture
+0.500000 anim 0.500000 1.0
+bone texture
+0.500000 texture anim = bone bone texture anim -1
+texture
+bone
+bone
+bone anim 0.500000 texture bone material -1 anim
+anim = vertex material
+anim
+frame anim anim 1.0 material 1.0 bone -1 anim 0.500000 -1
+-1
+bone vertex
+-1 material -1 an
\ No newline at end of file
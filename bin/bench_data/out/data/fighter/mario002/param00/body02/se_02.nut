@@ -0,0 +1,33 @@
+1.0 0.500000 anim vertex
+vertex
+texture anim 0.500000 texture texture texture bone 1.0 -1 0.500000 texture bone
+texture frame =
+=
+bone
+vertex bone bone vertex 1.0 vertex
+anim texture bone vertex
+vertex material -1 -1
+vertex = 1.0 anim 1.0 material anim
+-1 texture -1 bone frame frame frame 0.500000
+-1 frame 1.0 anim = frame -1 material
+vertex 0.500000 =
+bone texture bone material 1.0 vertex = 1.0 bone bone anim -1 anim
+texture texture
+texture bone material texture bone 1.0
+vertex 0.500000
+-1
+anim vertex
+frame texture
+texture
+texture
+1.0 material 0.500000 0.500000
+vertex texture 1.0 frame 1.0 0.500000 1.0 anim bone =
+0.500000 1.0
+=
+1.0 material 0.500000
+anim = -1 material anim vertex = texture = 0.500000
+=
+anim vertex 0.500000 vertex bone material frame
+-1 0.500000
+1.0
+material frame -1 frame 
\ No newline at end of file
@@ -0,0 +1,329 @@
+vertex 0.500000
+frame frame
+0.500000 material
+= material texture texture texture
+bone anim
+vertex bone
+bone frame texture texture
+-1 material bone =
+bone
+0.500000 bone bone bone bone vertex = texture
+anim 1.0 -1 anim vertex frame -1 = anim texture texture 1.0
+frame
+1.0 1.0 frame vertex 0.500000 = =
+material 1.0 bone bone
+texture = bone -1 =
+-1 -1 0.500000 vertex = frame frame material frame
+texture
+texture 0.500000 frame bone
+=
+vertex = texture anim vertex anim
+anim 0.500000 vertex frame bone texture = anim bone material bone texture 1.0
+1.0 material
+anim anim -1 material vertex frame anim vertex = texture anim material bone vertex -1 bone
+texture texture = -1 bone 1.0
+0.500000 1.0
+anim vertex bone bone
+= -1 0.500000 vertex -1 bone anim
+0.500000 vertex bone
+= frame
+0.500000 = bone -1
+1.0 0.500000 material -1 bone -1 =
+frame anim -1 texture bone
+0.500000 0.500000 frame = bone material anim frame anim texture vertex = material
+anim frame texture
+= 1.0 frame texture
+vertex bone = 0.500000 0.500000 vertex frame material -1
+1.0 = texture
+=
+1.0
+1.0 0.500000 -1 anim
+texture
+1.0 1.0 frame vertex bone texture frame
+vertex texture
+= 1.0 bone
+-1 -1 0.500000 vertex 0.500000 anim 1.0
+= texture = bone
+texture anim 1.0
+frame
+= anim material material -1 -1
+bone = vertex texture 1.0 0.500000 1.0 -1 frame material = 0.500000 0.500000
+frame
+material = -1 bone -1 vertex
+vertex frame
+1.0 -1 vertex frame frame
+=
+vertex texture
+frame material anim -1 0.500000
+frame -1 1.0
+vertex
+bone bone 0.500000 1.0 0.500000
+anim material
+vertex frame anim -1 texture bone 0.500000
+bone vertex -1
+0.500000 texture
+bone texture vertex material anim 1.0 0.500000
+1.0 material frame material anim bone
+material material
+bone frame texture -1 -1
+texture bone -1 0.500000 anim
+= 1.0 0.500000 bone vertex material 0.500000
+0.500000 -1 frame frame
+frame =
+frame
+anim bone 0.500000 0.500000 texture anim texture anim = material -1 texture vertex -1
+anim
+texture frame frame
+= bone
+texture
+0.500000 frame material bone
+= vertex 0.500000
+anim =
+bone texture
+-1 = frame
+= material
+1.0 vertex
+frame texture vertex 0.500000
+texture texture
+vertex 0.500000 material anim 0.500000 0.500000
+vertex
+=
+1.0
+anim -1 1.0 =
+frame
+anim 0.500000 -1
+vertex 1.0 = anim -1 -1
+1.0 vertex material -1 bone texture material
+bone
+-1
+1.0 vertex
+anim vertex vertex material frame
+anim 1.0
+material bone vertex -1 -1 vertex 0.500000
+anim 0.500000 1.0 anim 1.0 = texture 1.0 0.500000
+0.500000 1.0
+bone vertex -1 frame 0.500000 anim material
+material 1.0
+frame 1.0 0.500000 material bone anim
+texture frame anim vertex -1 anim
+1.0 0.500000
+vertex vertex 1.0 vertex = = anim
+=
+vertex 1.0
+1.0 =
+material frame
+bone material 0.500000 vertex anim texture 0.500000 frame anim -1
+0.500000 anim material
+texture
+= 1.0 = bone 0.500000 texture
+= 1.0
+0.500000 = bone texture bone frame anim 1.0 0.500000
+material anim -1 = vertex texture 0.500000
+texture vertex 1.0
+bone texture 1.0
+= 1.0
+vertex frame = 1.0 material
+anim anim vertex
+material
+bone vertex
+material =
+-1 0.500000 1.0
+bone
+bone
+1.0 bone = material vertex anim 1.0 anim
+1.0
+texture = 0.500000 bone
+material bone bone
+= anim
+texture
+anim
+anim vertex
+0.500000 frame
+bone texture frame
+texture texture 1.0 texture bone 0.500000
+1.0 bone texture 0.500000
+material
+vertex
+-1 -1
+-1 anim = 0.500000
+material
+= -1 anim
+vertex
+texture
+1.0
+1.0
+-1 texture texture vertex
+frame
+=
+bone 1.0
+texture anim material bone
+material =
+-1 vertex = texture bone bone 1.0 frame
+vertex 0.500000 1.0 material anim
+0.500000 bone bone
+1.0 material bone
+0.500000 bone anim
+-1
+0.500000 -1
+material 1.0 frame 0.500000 vertex 1.0 -1 vertex
+texture frame 0.500000 frame
+anim vertex 0.500000
+anim -1
+-1
+1.0 anim -1
+=
+material vertex vertex texture material
+anim -1 1.0 -1 vertex texture texture anim material
+bone frame 1.0 0.500000 material = -1 material frame frame bone anim vertex
+anim frame texture
+vertex 1.0 texture
+0.500000
+texture =
+1.0 texture
+vertex bone 1.0
+vertex texture texture 1.0 material texture frame vertex 0.500000
+frame anim
+= frame 0.500000
+0.500000 material anim material 1.0 frame frame -1 texture 1.0 material bone
+material frame 0.500000 texture texture -1 0.500000 -1 texture frame anim anim vertex anim frame
+vertex frame vertex
+-1 frame
+1.0 =
+= material anim vertex
+0.500000 frame bone anim material bone 1.0 material
+material -1 material -1 frame anim
+anim 0.500000 vertex
+material texture texture frame anim
+1.0 0.500000 anim anim 0.500000 bone
+vertex 1.0 frame vertex 0.500000 -1 frame 0.500000 =
+texture 0.500000 material frame vertex bone material material
+bone vertex texture
+1.0 material -1
+vertex anim = texture
+material vertex
+-1 bone texture
+-1
+= material 0.500000
+anim
+=
+anim bone
+anim
+-1
+vertex material
+-1 material 0.500000
+=
+-1 -1 -1 -1 material =
+-1 frame anim 1.0 material texture
+frame material frame -1
+-1 frame texture bone -1 material
+-1 vertex texture anim
+texture anim
+bone vertex material bone bone bone anim -1 = anim anim vertex texture anim material -1
+frame
+anim 0.500000 anim vertex
+= vertex anim = bone
+1.0
+= -1
+texture -1
+1.0 texture -1
+material
+material 0.500000 bone vertex
+frame
+= frame vertex texture
+anim anim
+frame
+frame 0.500000 texture vertex
+vertex vertex bone 1.0 -1 = texture -1 bone 0.500000 anim material frame texture
+anim 1.0 material
+material anim -1 anim
+1.0
+material = 1.0
+texture
+= -1
+1.0 frame
+material frame -1 material anim -1 vertex anim = texture
+1.0 texture anim
+bone bone frame texture 0.500000 frame 1.0
+vertex
+0.500000 vertex frame 0.500000
+vertex anim
+-1 frame vertex -1
+1.0 0.500000 vertex -1 -1 = texture
+0.500000
+bone -1 1.0 bone material
+0.500000
+texture = material vertex
+bone
+-1 bone texture anim =
+=
+frame vertex
+vertex 1.0 1.0 vertex vertex texture -1 =
+-1 0.500000 -1
+-1
+-1 material vertex material
+0.500000 -1 material = = 1.0 texture
+= 1.0 texture vertex 1.0 frame -1
+0.500000
+texture material 0.500000 = material
+1.0
+material anim texture 1.0 material -1 -1 frame
+bone
+-1 = 0.500000 frame -1 =
+anim frame
+bone material material frame
+vertex texture
+=
+frame 1.0 0.500000 0.500000 -1 0.500000
+vertex
+anim -1 frame bone = 1.0 texture texture = bone vertex = material vertex
+1.0 vertex vertex frame 1.0 -1 material
+bone
+texture frame
+texture vertex 0.500000 0.500000 -1
+-1 frame material vertex frame -1 = anim bone
+texture material 0.500000
+anim
+= frame = 0.500000 frame
+vertex
+= =
+-1
+texture anim material vertex anim anim bone frame bone
+-1 1.0 -1 = = frame bone
+vertex bone vertex vertex
+material 1.0 anim material anim
+= bone 0.500000
+vertex -1 -1 vertex vertex -1
+frame
+frame
+vertex vertex anim
+-1 texture 1.0 anim 1.0 = vertex
+material material
+=
+anim material vertex
+frame texture = texture material vertex 0.500000
+bone vertex
+= bone vertex -1 = -1
+material
+texture
+material material frame
+=
+-1
+vertex -1 frame 1.0
+frame frame bone = bone anim
+1.0
+texture -1 texture 1.0
+bone
+texture texture
+frame -1 anim -1 = -1 anim 0.500000 anim bone vertex
+1.0 0.500000 = anim 1.0
+vertex 0.500000 anim texture vertex anim frame anim vertex frame 0.500000
+1.0 vertex texture
+bone bone bone -1 vertex
+material 0.500000 anim
+0.500000
+bone bone bone bone frame vertex
+bone
+vertex texture
+bone material anim
+1.0 material
+texture -1 anim -1 anim
\ No newline at end of file
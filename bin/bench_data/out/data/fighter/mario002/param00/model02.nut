@@ -0,0 +1,31 @@
+0.500000
+vertex -1 -1 -1 bone 1.0
+material bone material
+bone texture
+1.0 = material 0.500000 vertex 1.0
+frame 1.0 0.500000 bone frame 1.0
+texture
+frame
+-1 1.0 texture
+texture material 1.0 anim bone bone
+=
+frame
+frame
+frame
+-1 texture 0.500000
+anim vertex
+=
+frame 1.0 texture vertex = bone 0.500000 frame =
+1.0 bone anim bone = bone
+frame vertex 1.0 frame
+vertex 0.500000 frame bone 1.0
+material 1.0 0.500000 texture texture 0.500000
+frame 1.0 frame anim 1.0 0.500000 texture
+frame bone
+= texture
+material bone material
+= 1.0
+bone
+material frame vertex
+vertex vertex frame 1.0 -1
+= anim anim frame 
\ No newline at end of file
@@ -0,0 +1,178 @@
+bone anim
+anim
+texture material 0.500000 bone bone
+texture 0.500000
+frame bone = frame 0.500000
+0.500000 anim -1 frame -1 vertex texture
+vertex
+1.0
+anim texture
+vertex
+= =
+1.0 texture 1.0 vertex
+anim -1 bone 1.0
+-1
+0.500000 frame 1.0 = anim
+bone -1 0.500000 frame bone bone vertex texture 1.0 = vertex anim anim bone texture
+texture frame texture
+texture material bone bone 1.0
+texture frame 0.500000 -1 texture vertex bone
+vertex bone 0.500000
+= -1 1.0
+vertex = -1
+texture = bone vertex =
+bone texture 0.500000 1.0 1.0 1.0 texture material
+bone 1.0 1.0 frame = anim 0.500000
+texture =
+texture
+anim texture 1.0
+texture 1.0 anim vertex
+frame material = texture texture =
+frame texture
+-1 -1
+1.0 vertex vertex 1.0 0.500000 texture -1 texture material texture =
+bone
+0.500000 -1 bone anim material material vertex
+anim 0.500000 vertex
+bone
+-1 anim texture
+material -1 = 1.0 texture
+texture frame = 0.500000 material = 0.500000
+material
+bone frame = texture vertex
+-1 anim bone vertex anim bone
+vertex 1.0 frame 1.0 material
+texture vertex texture frame
+= = vertex texture 0.500000 material anim -1 texture
+material texture -1 0.500000 = = texture material 1.0 texture 0.500000
+= -1 anim -1 material
+texture = = bone
+= anim = frame vertex 1.0 anim texture vertex = 1.0
+bone
+texture bone
+0.500000 = 1.0 0.500000 =
+0.500000 frame
+= -1
+vertex texture texture texture bone bone bone vertex
+bone -1
+frame frame -1 1.0
+material
+=
+-1 texture
+0.500000 = bone vertex -1 texture material texture = = texture = 0.500000 frame texture 0.500000 -1 texture
+frame anim = =
+vertex = 1.0 anim
+anim 1.0
+1.0 bone 0.500000 -1 1.0
+= -1 frame frame anim 0.500000 vertex
+-1 bone
+texture texture texture
+= 0.500000 = material
+anim material = 0.500000 material =
+frame
+-1 vertex 0.500000
+0.500000 1.0 vertex
+frame material 0.500000 -1 anim
+vertex
+bone frame 0.500000 1.0 -1 -1 texture -1 frame vertex
+bone = vertex 1.0 texture texture bone -1 bone vertex = 0.500000 vertex -1 bone texture anim anim vertex 0.500000 vertex frame
+1.0
+1.0 -1 frame bone vertex
+1.0 bone vertex
+bone
+-1
+anim bone frame
+vertex texture vertex 0.500000
+= 1.0 vertex
+vertex frame bone anim
+vertex 1.0 =
+vertex vertex
+bone frame material
+material anim bone
+anim vertex 1.0 frame anim 1.0 -1 = 1.0
+vertex 1.0 1.0 = 0.500000
+bone material -1 1.0 1.0 1.0
+bone 0.500000
+vertex texture 0.500000 -1 =
+anim -1
+=
+0.500000 frame frame
+anim anim 0.500000 material -1 = anim material vertex bone frame anim vertex vertex 0.500000 0.500000 bone
+-1 material bone bone -1 material -1 frame frame
+frame
+1.0 bone anim -1 = vertex
+vertex material bone 1.0 texture =
+vertex
+0.500000 bone vertex bone
+vertex 0.500000 material texture frame 1.0 0.500000 frame vertex vertex
+0.500000
+anim material
+1.0
+vertex material frame =
+0.500000 vertex 0.500000 = bone
+0.500000 frame
+=
+material 0.500000 material vertex -1 0.500000 texture material 0.500000 vertex
+bone 1.0
+0.500000 0.500000
+material
+bone frame = 0.500000 frame anim
+1.0 material =
+anim 1.0 vertex 1.0 0.500000 vertex frame 1.0
+vertex
+1.0 vertex 0.500000 material -1
+bone
+vertex = vertex
+= 1.0
+vertex
+vertex 1.0 material 0.500000
+material = -1 bone
+-1
+1.0 frame
+material bone
+frame
+0.500000 1.0 -1 0.500000 frame 0.500000 material vertex = -1
+vertex material frame frame anim -1 material anim material
+0.500000 frame vertex 1.0 frame vertex -1
+1.0 frame material material
+frame -1 frame material 1.0 vertex 0.500000 texture frame
+=
+vertex
+-1 material vertex = -1 frame =
+-1 0.500000
+frame anim
+vertex
+bone
+anim
+anim vertex =
+anim frame anim frame
+texture anim
+vertex 0.500000 anim
+texture material 1.0 material = material 1.0 -1 texture 0.500000 material
+1.0
+0.500000
+frame vertex 0.500000 texture anim
+-1 frame anim
+frame
+frame
+-1 = -1 vertex bone
+texture 0.500000 texture frame
+0.500000 material bone bone
+material 0.500000 bone = 0.500000 0.500000 1.0 -1
+anim frame frame bone anim
+= = material
+anim bone = 1.0 0.500000 frame vertex
+bone bone 0.500000 1.0 -1 -1 material =
+0.500000 bone bone
+anim 1.0 frame 1.0 1.0 = =
+bone frame texture vertex texture
+material
+-1 texture
+1.0
+frame 0.500000 -1 0.500000 -1 -1
+bone vertex
+-1 anim
+texture = -1 -1
+material 1.0 1.0
+material material bone
+0.500000 material
\ No newline at end of file
@@ -0,0 +1,187 @@
+-1
+texture anim anim
+bone bone vertex texture bone vertex
+anim -1 -1 anim 1.0 texture texture bone -1 -1 1.0 bone -1 vertex bone bone 0.500000 vertex material 1.0 -1 = material bone frame vertex
+frame texture
+= material 1.0 anim anim
+1.0 anim
+-1 0.500000 0.500000 bone
+vertex -1
+material 1.0 -1 = anim frame 1.0 1.0 anim texture frame
+texture frame
+anim = frame -1 vertex 1.0 anim anim -1 texture 0.500000 frame vertex anim frame anim
+anim = -1 anim anim anim
+1.0 bone
+texture
+1.0 vertex -1 vertex material frame
+texture 1.0 vertex vertex anim material
+texture vertex
+bone
+frame texture -1
+anim
+anim
+1.0
+-1
+-1 texture
+frame 0.500000 vertex
+1.0 0.500000
+1.0 0.500000 frame material vertex vertex bone
+1.0 0.500000 texture bone -1 texture bone
+0.500000 bone texture = frame 0.500000 0.500000
+anim
+-1
+1.0 1.0 material material -1 -1 texture
+vertex
+1.0 bone
+material
+= vertex 0.500000
+= 0.500000 vertex texture
+frame texture -1 1.0
+= -1 bone texture 0.500000 0.500000 texture anim anim vertex bone
+material
+texture
+vertex material
+texture frame
+frame vertex
+anim -1 = -1
+frame texture -1
+bone 1.0 frame
+anim frame texture 1.0 = 1.0 frame -1 vertex 1.0 0.500000 -1
+anim frame 1.0 1.0 -1 vertex -1 material anim bone
+texture =
+anim
+texture
+vertex bone 0.500000 vertex 1.0 bone bone
+-1
+0.500000
+frame
+-1 = material vertex
+material
+-1
+0.500000
+= anim vertex -1 -1 -1 bone
+bone texture frame
+1.0 vertex frame
+vertex texture texture 1.0 -1 1.0
+1.0 0.500000 texture frame
+-1 anim bone anim frame = bone anim frame vertex 0.500000
+vertex texture material texture material
+-1 0.500000
+=
+bone
+vertex -1 -1 0.500000 -1 material = bone bone material bone
+frame
+material bone = frame anim bone vertex
+vertex vertex 0.500000 material vertex 0.500000 -1 =
+-1 texture
+material frame 0.500000 bone bone texture 1.0 = -1 -1 = bone texture 1.0 -1
+texture vertex texture frame = texture material anim
+1.0
+0.500000 vertex material -1
+= anim material -1 = texture bone
+vertex = 1.0 0.500000 frame 0.500000 bone
+bone 0.500000 vertex
+anim vertex = vertex
+bone
+texture frame -1 texture 0.500000
+bone 1.0 -1 frame frame anim material
+texture bone
+material vertex vertex
+vertex anim texture frame
+material = anim = frame anim frame = anim -1 vertex
+texture
+material texture 0.500000 bone 1.0 frame
+texture texture
+material
+frame vertex texture bone
+material material anim 0.500000 material 1.0 0.500000
+= material material =
+frame bone
+=
+= texture -1 vertex
+-1 frame frame -1 vertex 0.500000 texture anim
+frame 1.0 0.500000
+anim
+1.0
+0.500000 bone
+1.0
+frame 1.0
+0.500000 texture
+texture -1
+material material
+=
+frame -1
+= vertex vertex 1.0 frame 1.0 -1
+anim 1.0 bone 1.0 1.0 bone vertex
+frame 0.500000 vertex
+1.0 anim frame vertex 0.500000 vertex bone 0.500000 -1 anim
+1.0 anim = 0.500000
+1.0 frame 1.0 material material vertex
+1.0 bone = anim material
+material
+frame vertex frame
+0.500000 vertex anim 0.500000 material
+texture texture = 1.0 frame
+texture vertex
+-1 anim = bone 0.500000
+bone material
+0.500000
+texture -1 bone
+1.0 material = material bone frame -1
+frame
+texture vertex
+1.0 material -1 frame bone 0.500000
+texture = texture vertex anim vertex
+anim frame anim vertex 1.0 texture texture
+0.500000 = bone
+1.0 -1 bone
+-1 = vertex
+1.0
+texture
+= 1.0 texture -1 bone bone = -1 anim
+vertex
+anim material -1
+-1 -1 anim bone anim -1 bone bone = bone
+frame
+bone bone
+bone bone
+=
+0.500000
+anim
+texture
+anim bone
+frame
+frame
+= texture bone
+bone anim
+anim frame material 0.500000 1.0 1.0 -1 -1 texture 0.500000 = frame = vertex
+1.0 bone bone 0.500000
+frame
+= vertex
+1.0 frame 0.500000
+bone
+frame vertex bone
+material =
+0.500000 -1 vertex
+vertex 1.0 = vertex bone texture -1 -1 texture material texture frame -1 texture 0.500000 1.0 texture material 1.0
+0.500000
+material 0.500000 1.0 material bone
+1.0 -1 texture -1 0.500000 -1 bone =
+0.500000 1.0
+1.0
+vertex 1.0 material frame = vertex bone material frame bone anim material -1 0.500000 anim 1.0 vertex
+= 1.0 anim
+= vertex anim material
+bone 0.500000 -1
+1.0 texture
+-1 1.0
+frame
+frame = vertex anim vertex vertex 0.500000 1.0 bone texture 1.0 frame anim 1.0 texture frame
+= material bone frame vertex 0.500000
+1.0
+1.0 anim material = texture
+-1 anim -1 1.0 frame = bone bone frame texture texture texture vertex = anim vertex 0.500000 texture
+frame material -1 -1 = 1.0 anim vertex
+anim 0.500000 frame
+material
+material material bone anim 0.500000 anim 1.0 -1 = vertex material 
\ No newline at end of file
@@ -0,0 +1,290 @@
+bone material
+-1
+vertex = vertex -1 texture
+-1 frame
+vertex bone 1.0 anim frame bone -1 material = frame texture
+texture vertex anim
+bone bone -1 1.0 -1 texture = material = anim texture anim
+material frame -1 bone vertex 0.500000
+frame vertex =
+bone = -1 -1 =
+bone material
+-1
+bone
+= vertex -1
+=
+0.500000 material texture 0.500000 material texture
+texture
+material bone frame texture
+bone = texture bone 0.500000 1.0 0.500000 0.500000 texture frame
+= frame frame texture 0.500000 =
+bone anim
+material 1.0 0.500000
+bone
+texture material vertex
+material vertex anim vertex bone bone vertex 1.0 = texture texture -1 1.0
+vertex material 1.0 -1 vertex 0.500000 anim 1.0 texture
+frame
+0.500000 1.0 -1 bone vertex texture bone vertex texture frame =
+0.500000
+bone 1.0
+-1
+bone anim
+vertex
+frame frame anim frame 0.500000 -1
+bone
+material
+vertex
+texture =
+vertex frame frame
+1.0
+-1
+anim 0.500000 frame 0.500000
+bone
+= vertex =
+anim 1.0 texture material 0.500000 0.500000 1.0 texture 1.0 anim
+frame
+bone
+texture
+bone vertex
+=
+1.0 material = 1.0 bone =
+material anim anim -1
+frame -1 1.0 vertex material
+anim anim
+-1 bone vertex material
+material anim 1.0
+vertex frame anim frame texture texture
+frame anim frame
+= material
+texture material
+bone texture 0.500000
+anim
+vertex =
+frame 0.500000 -1 1.0
+texture
+= 1.0 anim anim
+texture anim vertex
+0.500000 material 0.500000 0.500000 1.0 0.500000 bone material vertex = 1.0 texture frame bone anim 1.0 material anim
+material anim anim
+bone bone bone
+1.0 anim 0.500000 -1 material 1.0 anim
+frame -1 0.500000
+vertex
+texture
+0.500000 = bone bone vertex =
+=
+bone -1 -1 anim vertex texture vertex anim anim
+frame bone bone vertex
+texture 0.500000 = frame vertex 1.0 1.0
+= bone anim -1 texture vertex
+-1
+-1 1.0 -1 texture material vertex anim anim anim
+1.0 -1 texture -1
+-1
+= anim
+-1 = = vertex = =
+-1 vertex = frame material 0.500000
+material anim
+1.0 = texture 1.0 -1
+frame 1.0 0.500000 = texture frame material material bone
+frame 1.0 frame = frame =
+texture
+1.0
+1.0 0.500000
+anim texture
+0.500000
+1.0
+frame vertex
+frame = frame texture texture = bone 1.0 0.500000
+vertex
+=
+vertex -1
+bone -1 -1 -1 0.500000 material 1.0 anim 1.0 texture
+vertex
+texture anim texture =
+bone texture frame 0.500000
+0.500000 vertex bone material
+-1 texture bone -1 texture vertex =
+= texture frame frame -1 = texture vertex
+vertex
+= anim 0.500000 material frame
+anim -1
+bone 1.0 frame 1.0 =
+0.500000 1.0 frame
+frame
+0.500000 texture
+bone bone frame texture material
+-1
+texture
+material -1 bone
+anim
+0.500000 = bone bone
+texture frame 1.0 anim vertex vertex
+texture
+1.0 = 0.500000 frame material material =
+1.0 frame
+anim bone anim frame vertex anim texture = 0.500000 -1 = frame = bone anim material
+vertex = anim 1.0 bone material bone
+1.0
+= 0.500000 anim material bone texture 0.500000 vertex 0.500000
+vertex texture 1.0 texture frame texture
+-1 vertex bone
+frame
+=
+anim anim material material frame 0.500000
+1.0 -1 bone
+material -1 = 1.0
+vertex
+0.500000 bone
+material texture =
+vertex vertex
+1.0 1.0 0.500000
+anim
+material
+vertex vertex vertex 1.0 frame anim vertex
+frame material anim -1
+material material texture
+texture vertex anim 1.0
+bone =
+1.0 -1
+anim
+vertex bone 1.0
+=
+vertex 1.0 0.500000 vertex texture material bone
+texture anim material -1 bone 1.0 bone
+frame -1 =
+material texture
+= frame bone 1.0 frame 0.500000
+texture bone material = material = bone = = 0.500000 vertex anim anim
+material vertex
+1.0 = 0.500000 bone anim 1.0 1.0
+frame
+texture 0.500000 vertex -1 texture
+=
+material texture = vertex -1 vertex
+texture 1.0
+frame
+vertex anim -1 -1
+-1 anim
+anim -1
+0.500000 -1
+frame material
+0.500000 frame
+vertex
+material
+1.0 texture 0.500000
+-1 anim bone anim = 1.0 material texture frame frame bone material frame -1 anim anim = material vertex -1 = 0.500000 texture frame material
+1.0
+0.500000
+0.500000
+= = 1.0
+-1 texture frame vertex frame
+bone -1 vertex vertex -1 bone = vertex anim
+texture -1
+0.500000 texture 1.0 0.500000 = 1.0 vertex -1 -1 texture
+-1 texture 0.500000 texture bone 1.0
+bone texture 0.500000
+=
+frame
+= 1.0 material
+-1 -1
+material
+texture frame
+0.500000 frame
+bone anim vertex frame
+material vertex vertex bone vertex frame anim -1 -1 vertex
+texture -1 frame
+1.0 0.500000 = texture = bone
+anim
+0.500000 bone frame
+-1 = bone bone vertex -1
+frame
+texture 1.0 0.500000
+vertex -1 bone anim frame frame vertex vertex 0.500000
+-1 frame = -1
+1.0 bone = =
+anim anim bone anim -1 texture
+anim texture
+1.0
+-1
+-1
+material 1.0 -1 anim
+vertex material texture frame frame anim 1.0 1.0 anim frame frame
+0.500000 -1
+= material texture 0.500000 -1
+1.0 -1 bone vertex 0.500000 bone anim 1.0 frame
+bone vertex vertex frame
+0.500000 bone
+bone vertex frame -1 vertex bone bone bone 0.500000 1.0 bone
+anim
+material
+texture
+material 1.0 1.0 texture 1.0 frame bone 1.0 frame
+texture
+frame bone bone texture -1
+1.0 = anim
+vertex = -1
+1.0
+-1 vertex vertex 0.500000 -1 anim bone
+= = -1 frame vertex -1 texture 1.0
+=
+0.500000 =
+0.500000 anim -1 anim
+material = -1
+vertex
+anim 1.0 texture texture
+anim
+texture bone
+vertex -1 1.0 vertex = bone material material =
+material -1 anim
+-1 = vertex material
+material material vertex
+-1 0.500000 material anim
+bone
+vertex vertex =
+1.0 anim frame anim 0.500000
+vertex texture vertex bone bone 1.0
+anim bone 0.500000 bone material
+0.500000 = vertex anim vertex frame -1 vertex -1 frame anim vertex bone
+vertex texture frame
+frame frame
+bone anim anim vertex anim material 0.500000 anim bone 1.0 texture bone
+anim material 1.0 texture
+anim 1.0 -1 -1 1.0 texture bone material bone
+frame
+bone
+bone
+1.0
+bone bone 0.500000
+frame -1
+anim bone texture texture = vertex 1.0 material material 0.500000 anim
+0.500000
+= -1 frame bone
+vertex 1.0 texture -1 anim
+1.0 0.500000 texture -1 frame 1.0 0.500000 = 0.500000
+-1 material vertex texture material = material
+vertex
+-1 -1 -1
+material
+vertex
+= material
+frame
+vertex
+0.500000 frame texture -1
+1.0
+vertex
+vertex vertex
+0.500000 vertex = texture = = 0.500000 = vertex
+-1 anim anim frame
+frame
+texture anim =
+= material texture -1 0.500000 vertex bone frame
+-1 1.0
+= 1.0 bone -1 material
+frame vertex anim material material = frame 1.0
+bone material bone
+= bone 1.0 = 1.0 0.500000 bone bone -1
+vertex frame vertex 1.0 texture 1.0
+bone 1.0 material anim 1.0 = = bone = 1.0 vertex frame bone vertex bone -1 vertex frame anim frame
+ver
\ No newline at end of file
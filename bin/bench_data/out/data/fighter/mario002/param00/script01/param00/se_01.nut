@@ -0,0 +1,346 @@
+-1 -1 vertex
+-1 frame 1.0 -1
+= =
+material texture
+material 1.0 1.0 = frame =
+0.500000 1.0
+bone 1.0 vertex anim frame bone 1.0
+anim anim
+vertex anim texture vertex vertex
+-1
+-1 material 1.0 =
+texture anim texture
+-1 texture frame =
+1.0 anim
+anim bone texture anim
+vertex 1.0 texture texture
+= 0.500000 -1 =
+= bone 1.0 0.500000
+0.500000 = vertex -1 -1 bone material
+bone
+anim frame = = 1.0 = vertex material 1.0 frame texture 0.500000 vertex = anim 0.500000 0.500000
+vertex = =
+bone -1 bone vertex 0.500000 anim
+-1 anim
+texture anim anim -1 bone 1.0 material frame 1.0
+1.0 texture material bone = 1.0 bone bone =
+anim material frame material anim texture
+material material vertex = frame bone =
+bone anim
+0.500000 frame material
+texture material anim 0.500000 =
+0.500000
+0.500000 -1 1.0 bone = anim texture anim material 1.0
+bone 0.500000
+frame bone bone -1 texture material
+0.500000
+bone frame
+0.500000
+frame -1
+anim = bone vertex anim
+anim -1 material
+1.0 0.500000
+= bone -1 anim frame
+vertex texture
+-1 0.500000 vertex
+=
+bone 1.0 material frame
+texture
+texture
+vertex
+-1
+=
+anim -1
+texture texture 0.500000 texture = 1.0 bone 1.0
+frame frame 0.500000
+0.500000 1.0 vertex frame -1
+vertex
+frame anim
+anim vertex frame 1.0 anim bone bone bone 1.0 1.0 0.500000
+anim material material 0.500000
+1.0 = material -1 frame 0.500000 material -1
+material frame vertex vertex 0.500000 -1 bone material frame material anim
+1.0 frame
+1.0 = vertex material material
+vertex anim texture
+vertex -1 anim
+bone -1
+anim 1.0 vertex -1
+bone texture texture texture bone 0.500000
+1.0 0.500000
+material
+-1 texture
+1.0
+anim -1 frame
+anim
+frame bone material 1.0 material
+frame texture bone material
+vertex
+0.500000
+vertex 0.500000 =
+frame vertex
+bone anim material -1 = material -1 anim 1.0
+frame 0.500000 -1 = 1.0 = anim material
+material 0.500000 frame 1.0
+0.500000
+bone texture
+bone frame
+= material = -1 = vertex -1 texture 0.500000 texture frame -1
+1.0 bone texture texture anim bone anim bone anim
+1.0 anim 0.500000
+frame anim anim 0.500000
+frame -1 bone frame vertex 1.0 -1
+texture 1.0 = -1 frame
+bone
+0.500000 frame texture -1 anim anim -1
+= =
+material
+-1 = frame -1 vertex frame vertex -1
+material anim -1 0.500000 material
+1.0 material
+0.500000
+anim
+texture bone frame = texture
+0.500000
+vertex = 1.0 frame 1.0 bone
+frame 0.500000
+material material anim =
+-1 vertex 0.500000 = texture -1 texture frame = anim anim
+texture texture 1.0
+0.500000 -1 = 1.0 1.0 vertex anim
+frame 1.0
+= material
+frame -1
+vertex anim material frame texture frame
+1.0
+anim -1
+texture 0.500000 = material anim bone material texture 1.0
+= -1
+vertex
+0.500000 =
+bone texture
+frame
+bone
+0.500000
+vertex texture frame material
+material 1.0 0.500000
+0.500000 vertex
+0.500000 -1 1.0 0.500000 frame anim 1.0 anim anim
+-1 material
+= 0.500000 -1 1.0 -1
+anim material -1 material -1 bone material anim anim 0.500000 frame
+= = vertex
+vertex -1 texture anim bone 1.0
+-1 -1 frame
+texture =
+= -1 -1 bone = bone frame
+-1 anim 0.500000 = frame 0.500000 -1 bone
+1.0 -1 vertex frame anim vertex anim = texture -1
+vertex anim frame 0.500000 frame = 1.0
+bone 0.500000 frame bone frame frame 1.0 anim anim frame material anim texture
+bone texture -1 material vertex 1.0 anim frame 0.500000 = frame material vertex vertex 1.0 1.0
+1.0
+-1 frame bone = -1 vertex material frame vertex frame
+-1 texture material -1
+=
+vertex =
+bone anim material 0.500000 bone -1 texture
+vertex = = vertex
+0.500000 1.0 anim 1.0 1.0
+1.0 -1 = vertex frame vertex material 0.500000
+bone
+material
+0.500000
+anim
+0.500000 texture
+vertex
+1.0 =
+texture -1
+0.500000 bone frame anim 0.500000 material frame
+1.0 anim
+material 0.500000 = = 0.500000 anim material material
+bone frame -1 texture material =
+1.0 vertex frame -1 1.0 vertex anim
+0.500000 vertex 1.0 bone vertex anim bone 0.500000 anim -1 = = texture = 0.500000 0.500000 -1 material
+bone 0.500000 -1 vertex
+material bone anim
+anim material texture 1.0 anim bone
+frame 1.0 1.0 0.500000 frame 1.0
+= material anim texture frame
+= =
+= bone anim
+vertex anim material
+anim 0.500000
+1.0 texture vertex
+anim material 1.0
+0.500000 bone 0.500000
+0.500000 bone texture
+vertex 0.500000
+texture -1 1.0 -1
+vertex
+-1 1.0
+vertex material bone
+texture texture material
+vertex 1.0 -1
+1.0 1.0 texture
+material frame anim material
+material vertex
+= anim
+1.0
+0.500000 -1 0.500000
+vertex 1.0 = vertex
+texture =
+=
+-1
+frame 0.500000
+bone
+0.500000 texture texture -1 texture -1
+frame anim = bone -1 -1
+material frame bone texture
+vertex 0.500000 anim 0.500000 material material = -1 1.0
+anim = frame -1 anim frame -1
+1.0 1.0 -1 vertex material
+0.500000 texture anim
+frame texture vertex 1.0 frame = -1 1.0 bone vertex anim -1 anim
+-1 frame =
+material vertex vertex = frame texture anim material
+anim bone
+= -1 bone material 1.0 0.500000
+anim material
+0.500000 material 0.500000 anim -1
+material -1 = bone texture
+1.0 anim 0.500000 anim 0.500000 anim anim anim 0.500000
+-1
+anim
+1.0 1.0 = material
+texture bone vertex
+=
+material
+= 0.500000 anim vertex vertex material material 0.500000 -1 0.500000 -1 =
+vertex frame 1.0 = texture anim
+-1 0.500000 texture 1.0 texture 1.0 frame
+1.0 vertex material
+vertex
+anim
+vertex
+bone = material =
+0.500000 texture 1.0 material bone material material anim frame 0.500000
+anim texture 1.0 1.0 1.0 vertex -1 texture
+anim -1
+-1
+0.500000 -1 0.500000 1.0 1.0 =
+frame
+= = bone 1.0
+vertex bone
+anim
+vertex vertex anim bone 1.0 frame -1 vertex
+0.500000 -1 = = frame =
+0.500000 anim vertex vertex
+= material -1
+= =
+bone texture frame
+vertex 0.500000 0.500000 material = anim
+1.0 material vertex texture texture
+=
+material vertex anim
+=
+=
+-1 1.0 = material = 0.500000
+1.0
+0.500000 1.0 anim = anim anim
+texture material bone texture -1 material -1 anim frame anim texture
+texture frame =
+material
+material frame vertex
+1.0 texture texture frame 0.500000
+anim -1 1.0 anim anim
+= anim vertex anim anim vertex frame 1.0 bone
+bone bone anim 0.500000
+0.500000
+anim 1.0 = vertex = vertex anim texture 0.500000 1.0 anim -1 material material
+1.0 = anim bone texture bone
+texture = bone texture
+material bone anim material
+bone
+1.0 material -1 texture frame
+-1 = bone
+vertex -1 frame material
+0.500000 texture
+0.500000 = 0.500000 anim 1.0
+1.0
+vertex
+anim 1.0 frame texture
+0.500000
+texture 0.500000 material 0.500000
+-1 vertex
+-1 0.500000
+bone 0.500000 0.500000 = -1 -1
+vertex
+material = vertex anim
+bone 0.500000 frame texture
+anim 0.500000
+anim anim frame texture
+texture 0.500000 -1 0.500000 = 0.500000
+-1 vertex
+1.0 vertex frame material
+material bone
+material
+texture
+texture anim
+anim
+material = frame anim 1.0
+1.0 0.500000 0.500000
+-1 vertex
+0.500000 vertex vertex
+texture
+0.500000 vertex bone = vertex material 1.0 0.500000 -1 anim material vertex 0.500000
+= material texture 1.0 texture
+-1 texture
+texture
+frame anim vertex material bone
+frame
+material texture bone material = material bone material -1 0.500000 -1 0.500000 anim vertex anim = vertex material
+1.0
+-1 -1 material texture bone frame
+bone -1 = bone
+= 0.500000 -1 vertex vertex 0.500000 bone vertex frame frame 1.0 material texture 0.500000 material 1.0 vertex
+1.0 anim material 0.500000
+vertex
+-1 material 1.0 1.0 0.500000 vertex 0.500000
+texture
+frame anim vertex frame 1.0 vertex =
+material anim 1.0 -1
+material
+vertex -1
+0.500000 vertex 0.500000 material
+frame 0.500000
+-1
+0.500000 anim texture bone anim
+-1
+1.0
+frame bone -1 material -1 0.500000 1.0 1.0 0.500000 material 0.500000 -1 =
+-1 -1 frame
+1.0 material vertex anim 0.500000 0.500000
+anim -1 1.0 frame vertex
+vertex
+texture vertex -1 0.500000 vertex vertex texture
+vertex texture texture -1 -1 0.500000
+-1 =
+texture vertex -1 texture vertex -1 0.500000 0.500000 anim 0.500000 material
+0.500000 material
+anim
+material anim material vertex
+0.500000 texture 0.500000 -1 frame anim bone bone texture vertex
+frame
+material
+frame texture 0.500000 1.0
+material anim bone 0.500000
+0.500000 anim
+0.500000 anim material
+bone texture anim material anim
+material 1.0 = frame frame
+0.500000 texture material
+0.500000 bone 1.0 bone
+frame bone 1.0 bone material texture frame
+material bone vertex
+bone
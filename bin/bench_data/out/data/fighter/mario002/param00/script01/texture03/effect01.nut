@@ -0,0 +1,129 @@
+material vertex
+0.500000 vertex material 1.0 -1
+texture = material frame frame bone texture
+material
+= = vertex
+texture 0.500000 material frame anim =
+bone 0.500000 anim
+vertex frame anim
+material vertex
+bone texture bone
+vertex texture
+material =
+0.500000 1.0 0.500000 texture = vertex texture anim
+vertex texture texture
+frame = =
+frame -1 = bone anim -1 1.0 anim 0.500000 1.0 frame
+frame frame
+anim
+0.500000
+0.500000 -1 = 0.500000 vertex material
+bone anim vertex
+frame
+0.500000 bone
+bone 1.0 -1 0.500000 0.500000 frame
+= texture 0.500000 frame
+texture frame 0.500000 frame texture
+1.0 0.500000
+0.500000
+anim -1 bone =
+1.0 =
+bone bone bone bone = -1
+0.500000
+0.500000 texture
+material 0.500000
+vertex
+0.500000 texture anim 0.500000 anim frame
+=
+vertex
+anim anim 1.0 anim vertex
+bone vertex
+frame
+material vertex anim = -1 1.0 = texture = -1 1.0 1.0 frame bone = vertex
+material bone anim 0.500000
+anim texture anim anim
+0.500000 -1 anim vertex -1 -1
+vertex
+= vertex bone bone texture
+0.500000
+frame vertex 0.500000 1.0
+material 1.0 bone 1.0 =
+bone bone frame texture =
+0.500000 texture 0.500000 vertex bone material frame vertex
+texture 1.0 bone
+texture bone
+bone vertex 1.0 texture bone vertex 1.0
+frame 1.0 texture frame
+vertex texture frame
+material = = bone
+texture = 0.500000 anim material anim frame material 1.0 bone
+bone = anim material
+bone 0.500000
+vertex
+texture
+=
+anim 1.0 1.0
+0.500000 anim = -1
+anim texture = vertex 1.0 1.0 frame texture texture 0.500000 -1 1.0 = anim frame
+bone vertex bone bone
+bone vertex 0.500000 texture
+material material texture
+0.500000 frame vertex anim
+texture
+material bone vertex texture anim texture frame
+vertex material vertex
+-1 frame
+-1 material anim bone material texture
+vertex bone material material vertex -1 bone 1.0
+1.0 vertex
+frame = = = vertex
+0.500000
+bone frame anim 0.500000 vertex texture bone = bone material anim texture -1 frame 0.500000
+-1 1.0 = 0.500000 bone = frame =
+vertex
+-1
+frame
+vertex bone texture
+= frame
+frame anim bone texture -1 material bone anim vertex 1.0 material 0.500000 1.0 1.0 = material
+1.0
+anim bone 0.500000 1.0
+bone = 0.500000 vertex
+0.500000
+0.500000 frame anim texture 1.0 1.0
+0.500000 -1 0.500000 0.500000 bone frame frame bone vertex anim 0.500000 0.500000 bone = 0.500000 frame
+material bone bone 0.500000 bone vertex 0.500000 material bone
+0.500000 material vertex = -1
+bone
+texture bone 1.0 material vertex texture material
+frame
+bone material 0.500000 anim
+vertex material material vertex
+vertex texture material
+anim -1 frame vertex = -1 1.0
+frame =
+anim = vertex
+1.0
+-1 0.500000 vertex
+bone texture -1 anim 0.500000 material 0.500000 vertex 1.0 vertex
+0.500000 vertex -1 vertex = 1.0 0.500000
+frame bone
+anim
+texture vertex
+material
+material frame bone
+frame frame 1.0 -1
+1.0 0.500000 -1
+0.500000 0.500000
+texture vertex vertex
+0.500000 frame
+0.500000 bone frame 0.500000 = frame 0.500000 vertex bone vertex bone texture
+texture = 0.500000 frame vertex bone
+frame anim material = 0.500000 anim 0.500000 anim
+1.0 0.500000 -1 material bone
+bone
+=
+1.0 0.500000 anim =
+texture texture
+frame
+material 0.500000 0.500000 an
\ No newline at end of file
@@ -0,0 +1,86 @@
+texture anim anim frame
+anim 1.0 anim material texture vertex
+-1
+0.500000 bone = -1
+bone
+0.500000 vertex material bone frame 1.0 vertex anim
+-1 0.500000
+0.500000 = 0.500000 0.500000
+texture
+material 0.500000
+material texture frame -1 anim anim
+vertex anim material 0.500000 vertex texture vertex 1.0
+= -1
+texture
+0.500000
+-1
+material frame texture
+vertex -1 material
+-1 texture 0.500000
+= -1
+bone -1 bone
+-1
+bone -1 1.0 0.500000
+1.0 = -1 0.500000 1.0 1.0
+material -1 frame -1 -1 =
+0.500000 0.500000
+0.500000
+frame 1.0
+0.500000 1.0 bone
+frame
+texture
+frame
+= =
+0.500000
+0.500000
+texture
+anim bone texture
+anim bone 0.500000
+= vertex 1.0 bone 1.0 frame material 1.0
+-1 1.0
+bone -1
+vertex material 1.0 texture texture
+vertex material =
+frame = vertex anim
+material
+frame -1 = 0.500000 1.0 frame
+vertex texture
+anim texture vertex -1
+texture
+-1 material = 0.500000 0.500000 1.0 0.500000 material 1.0 0.500000
+anim = anim -1
+anim anim
+1.0 0.500000 vertex
+vertex vertex bone frame
+texture -1
+anim -1 1.0 frame frame material -1 material
+bone frame = texture bone = 1.0 1.0 0.500000 1.0 bone texture = anim bone
+texture = 0.500000 frame
+=
+0.500000 frame frame
+= frame anim 1.0 0.500000 -1 1.0 = vertex anim
+= vertex = anim =
+material
+0.500000 bone
+= texture = vertex material anim =
+vertex 0.500000
+material anim frame frame bone vertex vertex -1 frame frame
+texture 1.0 0.500000 frame
+vertex
+0.500000 frame
+bone material bone material vertex frame 1.0 anim material vertex anim = 0.500000 0.500000 bone anim
+frame -1
+-1 -1 = vertex texture anim
+1.0
+0.500000 vertex frame material
+anim
+1.0 =
+-1 texture vertex
+bone -1 anim -1
+anim
+0.500000 vertex
+frame 0.500000 bone =
+= material bone anim = anim texture 1.0 0.500000 anim
+1.0
+bone vertex bone 0.500000 0.500000
+0.500000 0.50
\ No newline at end of file
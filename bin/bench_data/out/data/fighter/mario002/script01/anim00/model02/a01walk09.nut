@@ -0,0 +1,140 @@
+vertex -1
+anim bone texture vertex 1.0 =
+vertex frame anim material 1.0 material -1 texture anim = 1.0
+texture vertex -1
+bone
+frame anim -1 0.500000 = material bone texture anim texture
+bone
+0.500000 texture -1 texture texture
+texture 0.500000 material 1.0 -1 = 1.0
+1.0 vertex -1 vertex material frame 0.500000 -1 vertex
+1.0
+-1 anim 1.0 0.500000 bone bone -1 -1 material 0.500000 texture 0.500000 = vertex bone bone 0.500000 texture anim material
+-1 texture
+vertex 0.500000 -1 -1 =
+-1
+material
+0.500000 1.0 anim -1 anim =
+1.0 bone frame -1 vertex texture bone texture 1.0
+frame 0.500000 frame material frame -1 1.0 vertex
+anim 1.0 -1 bone = material vertex 1.0 texture material = -1
+texture
+bone -1 frame material = vertex texture
+1.0 anim anim = 0.500000 = 0.500000 frame texture vertex anim 1.0 1.0 1.0 0.500000
+1.0 anim 0.500000 bone vertex
+= texture bone 1.0 texture
+anim vertex -1
+texture
+= vertex
+anim frame
+0.500000 frame 1.0
+texture =
+texture frame -1 1.0
+0.500000 1.0 =
+=
+material
+texture 1.0 texture frame texture vertex 1.0 bone
+bone anim bone material frame 1.0
+1.0 1.0 vertex = frame frame material
+=
+0.500000 texture anim -1 frame = frame frame -1
+vertex
+texture frame frame frame 1.0
+vertex
+frame
+-1 vertex vertex 1.0 anim vertex 0.500000 -1
+-1 bone -1 0.500000 vertex
+= = -1 material vertex bone
+1.0 1.0
+texture anim 1.0 vertex anim frame material 1.0 1.0 bone 0.500000 0.500000 bone
+1.0 bone frame
+anim 1.0 frame material texture =
+bone frame
+material
+anim vertex texture 0.500000 = 0.500000
+vertex -1 vertex frame texture texture texture
+anim
+-1 texture
+-1
+=
+vertex bone anim
+bone bone texture frame anim 0.500000
+-1
+0.500000 frame = anim vertex
+frame anim material
+1.0 frame
+0.500000 material material anim
+frame = vertex
+0.500000 -1 texture anim frame texture frame anim texture vertex texture = texture material frame
+=
+=
+texture texture frame
+anim material
+1.0
+texture material vertex vertex -1 anim = -1 frame = bone = bone 1.0 1.0 = vertex -1 texture -1
+bone -1
+=
+texture 1.0 bone bone material frame texture =
+vertex material
+1.0 bone
+anim -1
+= vertex
+= =
+0.500000 vertex
+0.500000 texture -1
+-1 texture material texture texture -1
+material
+= = 1.0 anim 1.0 anim material
+-1 texture -1 0.500000 texture anim material 0.500000 bone = =
+anim bone =
+bone = = -1 1.0
+0.500000 texture 0.500000 material 1.0 bone -1 anim texture 0.500000
+-1
+frame texture anim bone frame texture
+material frame texture
+vertex -1 1.0 anim
+material 1.0 texture 0.500000 vertex
+bone material = 1.0 0.500000
+vertex
+-1
+1.0 frame vertex 1.0
+anim
+anim 0.500000 -1
+bone
+-1
+anim 1.0
+bone vertex
+-1 texture 0.500000 bone
+bone -1 texture
+-1 0.500000 texture texture -1
+vertex vertex frame
+bone
+1.0
+vertex anim 1.0 0.500000 0.500000 1.0 vertex texture
+anim material
+anim frame vertex frame 1.0 vertex
+material material 0.500000
+material
+0.500000
+= 0.500000 =
+anim -1 material bone -1
+-1 -1 =
+1.0
+= frame bone material vertex texture
+frame vertex 1.0 vertex anim texture frame = vertex frame -1 0.500000
+0.500000 bone =
+material
+=
+0.500000 vertex material
+-1 vertex = material material vertex
+bone texture vertex
+frame anim = frame
+anim = 0.500000
+texture =
+anim 0.500000 0.500000
+frame -1 0.500000 anim
+=
+=
+material
+=
+bon
\ No newline at end of file
@@ -0,0 +1,7 @@
+1.0
+material
+frame texture 0.500000 material anim texture 1.0 bone
+1.0 1.0
+texture
+bone texture
+= = 0.500
\ No newline at end of file
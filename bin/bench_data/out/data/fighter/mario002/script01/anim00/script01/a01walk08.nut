@@ -0,0 +1,3 @@
+vertex texture = -1 =
+vertex
+0.500000 mat
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 vertex 0.500000 material
+1.0 materia
\ No newline at end of file
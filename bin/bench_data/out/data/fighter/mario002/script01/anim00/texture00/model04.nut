@@ -0,0 +1,110 @@
+anim frame bone vertex
+0.500000 texture vertex -1
+material
+-1 1.0 = -1
+bone -1 -1 = -1 anim
+material -1 texture texture vertex -1 1.0 texture
+bone material frame
+bone
+0.500000
+material 1.0 texture
+1.0 1.0 1.0
+vertex
+material
+frame bone anim
+1.0
+-1 vertex 0.500000 anim = -1 bone vertex anim material frame
+texture
+= 1.0
+material bone = -1
+-1
+-1 = = material texture texture vertex
+material bone anim
+frame vertex
+vertex frame bone vertex
+material frame frame
+texture 1.0 1.0 -1 vertex
+-1 = anim material
+frame -1 vertex 0.500000 1.0 vertex frame bone -1 0.500000 bone bone
+material =
+vertex 1.0 1.0 bone
+= -1
+1.0 -1 -1
+bone texture
+frame -1 anim
+anim bone material bone anim vertex 0.500000 material 0.500000 anim material -1 material 1.0 0.500000 = texture anim texture
+frame texture vertex frame
+1.0
+frame
+bone
+-1
+frame material frame 1.0 bone
+1.0
+material 0.500000 = 1.0 material
+anim
+material texture bone material 1.0 anim
+anim texture
+material 0.500000 anim frame -1 -1 material -1
+-1 vertex
+material
+-1 -1 texture material anim bone = = 1.0
+material
+texture
+-1 texture
+-1 -1 vertex = 0.500000 1.0 anim bone 1.0 -1
+1.0 frame vertex
+= bone frame 0.500000 0.500000 bone texture vertex vertex
+material material texture
+-1 anim 1.0 material material texture -1 vertex
+=
+vertex
+1.0 texture
+0.500000 0.500000 frame
+=
+bone anim
+texture -1 material
+bone frame bone texture vertex = anim texture 1.0 vertex =
+bone
+-1
+vertex vertex
+0.500000 = material bone frame frame anim 1.0
+vertex 0.500000
+vertex anim -1
+1.0
+frame bone 0.500000 0.500000 material
+material
+0.500000 0.500000 texture 1.0 -1 texture -1 texture texture 1.0 frame 1.0 frame 1.0 texture bone bone -1 = bone = anim anim bone anim vertex =
+vertex
+anim
+-1 material vertex frame bone
+1.0
+bone vertex = -1 frame 0.500000 texture = 1.0
+anim -1 frame texture -1 = texture frame -1 anim
+frame
+texture anim texture texture 1.0 0.500000
+frame
+frame
+material texture frame
+texture material -1 =
+-1
+texture
+frame vertex 1.0
+bone bone anim vertex vertex = 0.500000 0.500000 bone vertex 0.500000 vertex 0.500000 material vertex
+0.500000
+1.0 vertex texture texture texture 1.0 frame 0.500000 texture texture anim -1 bone 1.0 material
+material 1.0
+0.500000 vertex texture anim 0.500000
+material material -1 material
+-1 0.500000
+vertex
+-1 texture frame material
+bone
+bone -1 -1 texture 0.500000 1.0 vertex -1
+bone 1.0 texture texture bone =
+texture 1.0 vertex vertex bone 0.500000 anim
+frame anim
+vertex bone = texture
+= vertex =
+0.500000 0.500000 vertex =
+anim frame 1.0
+0.500000 texture material 1.0 frame
\ No newline at end of file
@@ -0,0 +1,34 @@
+-1
+anim = vertex 0.500000
+0.500000
+1.0 frame 1.0 texture vertex
+texture material -1 -1
+frame anim 0.500000 1.0 bone vertex vertex bone vertex anim 1.0 = material 0.500000 0.500000
+anim
+=
+material anim anim 0.500000 0.500000
+frame anim = frame 1.0 vertex material frame
+texture bone
+vertex material bone 0.500000
+anim bone -1 bone texture
+0.500000 vertex bone material 0.500000 0.500000 -1
+0.500000
+0.500000
+anim
+frame -1 material vertex = vertex texture
+bone -1
+= material
+-1 anim texture 1.0 vertex
+1.0 vertex
+bone bone material vertex frame texture
+0.500000
+-1 texture
+anim material
+texture = vertex 0.500000
+-1 material
+-1 anim -1 0.500000
+anim 1.0 =
+texture
+= 0.500000 texture
+-1 =
+material -
\ No newline at end of file
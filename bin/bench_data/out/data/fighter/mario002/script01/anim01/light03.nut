@@ -0,0 +1,71 @@
+0.500000 1.0 1.0
+-1 anim material
+bone material
+anim =
+=
+anim
+-1 1.0
+material
+-1 vertex
+-1 = =
+-1 anim material 1.0
+anim
+vertex 1.0 material vertex -1 vertex bone
+vertex 1.0
+frame vertex material vertex frame 1.0 material anim vertex anim vertex = anim
+material frame -1 material 1.0 anim material 0.500000 bone frame vertex 0.500000
+anim 1.0 frame anim
+bone anim 1.0 =
+0.500000 1.0 anim anim 0.500000 bone vertex frame anim bone 1.0
+= = 1.0 bone 1.0 material 1.0 1.0
+bone 1.0 0.500000
+= texture -1
+-1 bone vertex 0.500000 material 1.0 bone = 1.0 material bone
+frame vertex
+bone bone = -1 material -1 vertex
+frame anim 1.0 1.0
+vertex anim 0.500000 bone = anim frame material
+0.500000 = anim bone
+0.500000 bone -1 frame anim 1.0
+-1 anim
+frame material = -1 material
+vertex
+material 1.0 0.500000
+1.0 material
+frame 1.0
+frame -1 bone bone anim 0.500000 bone
+0.500000 material
+bone -1 material -1 1.0 texture texture
+bone
+texture
+anim = 0.500000 texture vertex
+1.0 vertex texture material material bone frame =
+vertex -1 material 0.500000 frame anim frame
+-1 1.0 texture
+texture texture
+texture -1 frame texture material material anim anim vertex frame 1.0 0.500000 -1 = 0.500000 -1 bone -1
+frame 1.0 1.0
+anim
+bone vertex frame bone 0.500000 texture vertex frame
+vertex
+vertex
+texture
+material
+bone material vertex
+-1 anim 0.500000 material material 1.0 1.0 1.0 texture frame 1.0
+material 0.500000 texture bone
+anim anim frame
+0.500000
+0.500000 -1
+-1 -1 frame = =
+bone frame 1.0 0.500000
+1.0
+anim
+-1 bone -1
+anim bone
+-1 vertex frame 1.0 vertex = texture anim anim bone frame frame material -1 material 0.500000 texture 0.500000 frame anim
+= bone
+bone frame vertex
+texture
+frame texture -1
+texture texture bone -1 0.500000 material bone frame 0.500000 0
\ No newline at end of file
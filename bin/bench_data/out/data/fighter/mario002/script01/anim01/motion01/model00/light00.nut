@@ -0,0 +1,2 @@
+bone anim texture anim = = = = 0.500000 material 0.500000 texture
+1.0 1.0 material texture a
\ No newline at end of file
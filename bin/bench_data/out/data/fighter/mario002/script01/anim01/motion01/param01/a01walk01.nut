@@ -0,0 +1,74 @@
+= bone
+material =
+frame 1.0
+material
+frame anim frame
+frame
+vertex anim 1.0 0.500000 = material 1.0 =
+anim
+1.0 0.500000 0.500000
+material anim 1.0 anim material = bone
+-1 1.0 = -1
+-1 bone frame anim
+= anim 0.500000
+bone
+-1 -1 bone vertex
+vertex anim 1.0 anim anim frame material texture vertex 0.500000
+frame vertex 1.0 vertex bone 0.500000 frame anim -1 anim frame texture = texture vertex frame =
+bone material 1.0 vertex texture
+bone texture
+= texture bone 1.0
+texture 0.500000 anim frame 0.500000 frame bone
+texture 1.0 bone frame
+=
+0.500000 0.500000 frame texture =
+bone vertex -1 vertex frame material texture 0.500000 anim
+bone material
+anim
+1.0 anim -1
+-1 -1 1.0 -1 vertex vertex anim = 0.500000 0.500000 0.500000 1.0 0.500000 frame -1 0.500000
+vertex vertex bone 0.500000 frame
+frame anim anim material
+1.0 0.500000 vertex texture -1 frame frame frame bone bone
+vertex frame
+anim frame bone
+= anim
+texture anim
+-1 frame material anim -1
+vertex
+bone texture 0.500000
+material frame vertex
+material
+vertex texture
+texture frame
+1.0 frame -1
+material vertex -1 anim texture texture
+-1 bone
+vertex
+0.500000 = texture = 0.500000 vertex 1.0 material frame
+0.500000 texture anim frame material
+-1 bone
+anim vertex frame 0.500000 texture -1 anim
+anim
+0.500000 frame material
+material 0.500000
+1.0 bone frame bone = material vertex vertex 0.500000 frame anim vertex -1 anim anim
+material vertex texture
+anim
+bone -1 material texture material bone
+anim bone 0.500000 frame vertex 1.0
+vertex frame material bone
+material = anim texture 1.0 texture
+bone = bone
+-1 = material material 1.0 0.500000 texture texture -1 frame 1.0 bone vertex vertex 0.500000 0.500000 material anim bone
+0.500000
+1.0 frame -1
+bone -1 0.500000 texture 1.0
+= -1 = bone
+1.0 vertex = frame vertex
+= bone material -1 material
+anim 1.0 0.500000 = material -1 0.500000 vertex
+texture anim
+material texture 1.0
+1.0 frame frame vertex
+vertex = m
\ No newline at end of file
@@ -0,0 +1,247 @@
+anim frame anim
+= texture 1.0
+0.500000 = 1.0 1.0 = vertex
+bone bone bone 1.0
+vertex bone vertex -1 0.500000 -1 bone texture
+frame = vertex
+0.500000 bone material
+= bone
+texture texture 0.500000 0.500000
+anim
+1.0
+-1
+material
+anim frame
+material frame vertex -1 frame vertex 0.500000 1.0
+material 0.500000 =
+texture vertex -1 = 0.500000 vertex vertex
+texture 1.0 vertex 0.500000 frame material
+vertex
+= 1.0
+0.500000
+texture texture -1 -1 1.0 texture bone = 0.500000 0.500000
+texture frame = anim =
+anim texture -1
+texture material vertex bone material anim material material 1.0 =
+1.0
+anim bone material -1
+material vertex 0.500000
+0.500000 vertex material bone frame 1.0 vertex 1.0 0.500000 bone anim
+0.500000 -1 bone frame frame vertex texture texture texture -1 = -1 1.0 -1
+anim
+vertex
+bone 0.500000 = 0.500000 0.500000
+anim anim
+material anim -1 texture 1.0 texture anim -1 vertex
+vertex
+vertex = frame = =
+0.500000 frame frame 0.500000 =
+-1 texture
+material texture vertex material bone material 1.0
+0.500000 bone texture anim -1 anim
+-1 0.500000
+anim 1.0
+1.0 frame = bone
+vertex -1 = = frame texture
+material = 1.0 1.0 frame vertex -1
+0.500000 = vertex vertex
+-1
+frame
+0.500000
+texture
+-1 vertex texture
+-1 vertex frame frame bone material anim anim texture frame frame bone vertex bone texture texture frame 0.500000 vertex
+material texture
+0.500000
+vertex 1.0 vertex frame
+1.0 bone bone = vertex -1
+anim texture bone -1 frame =
+1.0 = frame =
+texture texture -1 material 1.0 texture texture =
+0.500000
+material bone
+material material 1.0 bone
+frame material 0.500000 material -1 bone texture anim anim
+anim anim
+bone
+material material 0.500000
+1.0
+= -1
+anim anim
+0.500000 anim
+0.500000 bone material frame material vertex
+-1 anim material
+1.0 -1
+1.0 -1 1.0 anim -1 material bone 0.500000 material 1.0 material
+frame 1.0 texture texture 1.0 = 1.0 frame = anim anim bone
+texture
+1.0
+1.0 = 0.500000
+1.0 1.0 material 0.500000 bone
+vertex
+-1 0.500000 texture
+material frame
+= material = material material bone texture
+vertex vertex vertex
+vertex
+frame 1.0 bone bone texture bone texture 0.500000
+= bone vertex
+anim 1.0
+material material anim texture
+material 1.0 bone vertex
+frame material -1 frame
+1.0
+frame material vertex -1
+vertex = frame
+material bone
+material texture
+vertex bone 0.500000
+0.500000
+1.0 bone frame = vertex anim vertex
+bone bone anim -1 vertex 0.500000 -1
+frame
+texture frame anim bone = texture
+-1 anim 0.500000 bone 0.500000
+1.0 0.500000
+vertex 0.500000 vertex vertex 1.0 1.0 frame
+anim -1 frame
+= vertex 1.0
+texture 1.0
+vertex
+material anim 0.500000 = texture anim material
+-1 bone
+anim frame = material anim -1 material
+-1 material bone = bone 0.500000
+= -1 -1 = anim -1 = 1.0 frame texture material -1 0.500000 =
+frame 1.0 texture
+0.500000
+bone vertex bone vertex 0.500000
+material
+1.0 bone texture anim vertex anim vertex vertex frame anim frame -1 =
+bone
+bone bone frame
+texture vertex =
+frame bone
+material frame frame
+=
+bone 0.500000
+frame
+vertex texture
+vertex anim material texture
+anim
+frame
+= 1.0 vertex
+0.500000 anim 1.0 = bone
+material frame vertex frame vertex frame 0.500000 = bone material texture bone
+anim -1
+anim anim = 1.0 material frame bone material bone anim 0.500000 1.0
+frame
+0.500000 0.500000
+bone texture vertex
+material 0.500000 vertex
+vertex bone = -1
+bone -1 texture
+frame 0.500000 material frame = -1 material anim material
+0.500000 0.500000 bone -1
+1.0 anim 1.0
+anim material
+texture = bone bone frame
+-1 frame anim material frame -1 0.500000 vertex -1 1.0 texture
+frame = -1
+bone
+frame anim vertex texture =
+vertex -1 = material
+0.500000 anim frame anim bone bone
+frame frame 1.0
+1.0
+bone material 0.500000 material
+-1
+anim bone anim bone material frame =
+-1 bone
+bone -1
+-1 -1 0.500000
+material 1.0
+bone frame frame texture vertex frame bone vertex
+= anim
+frame 1.0 -1
+vertex bone 1.0 texture
+frame
+= anim vertex
+= -1 bone =
+anim texture
+anim bone -1 frame 0.500000
+1.0 bone frame
+vertex
+vertex anim bone
+= bone 0.500000
+-1 0.500000 -1 1.0 1.0 texture 0.500000 texture 0.500000
+-1
+bone vertex 1.0 material anim =
+anim
+frame material anim
+texture
+vertex vertex 1.0
+0.500000 texture vertex
+-1
+vertex = texture
+0.500000 0.500000 0.500000 bone
+= 1.0 vertex = =
+-1
+texture -1 anim vertex
+1.0 0.500000 vertex bone = bone -1 bone 0.500000 material vertex 0.500000 texture -1 -1 texture texture bone
+texture frame material 0.500000 frame = material
+bone
+0.500000 texture vertex bone
+bone vertex
+0.500000
+frame bone texture texture texture -1 anim 1.0 anim anim 1.0 vertex -1 anim
+vertex
+material anim material frame =
+1.0 1.0 0.500000
+frame bone material
+material
+bone texture
+=
+texture -1 0.500000
+frame
+texture anim material
+material
+1.0 1.0 = anim
+frame
+bone 1.0
+=
+material vertex -1 frame = material
+0.500000 material
+=
+-1 =
+bone -1 anim 1.0 0.500000 1.0 vertex material
+vertex vertex
+= 1.0
+0.500000 =
+material =
+vertex
+frame anim
+= 1.0 material
+texture vertex bone 1.0 anim
+frame anim bone = material
+0.500000
+1.0 texture anim vertex bone texture
+anim texture anim
+vertex anim
+-1 anim
+material anim material 1.0
+texture material bone -1 0.500000 vertex texture = material bone anim bone
+= bone material frame material texture
+vertex
+bone frame 1.0 = = anim
+vertex anim bone
+bone = = vertex bone
+vertex -1 material -1 texture 1.0
+vertex material texture texture
+anim material 1.0 vertex 1.0 vertex 0.500000 0.500000
+1.0
+frame frame
+=
+= vertex texture material -1 texture 1.0 -1 =
+bone 1.0
+1.0 material textu
\ No newline at end of file
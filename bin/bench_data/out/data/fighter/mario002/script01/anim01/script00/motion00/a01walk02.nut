@@ -0,0 +1,7 @@
+texture 0.500000
+bone
+material vertex -1 bone texture anim = vertex
+material material 1.0 texture = vertex texture frame frame material = frame frame 1.0 texture
+1.0 -1
+1.0 -1 0.500000 texture 1.0 1.0 = 1.0 vertex vertex anim 0.500000 -1 frame texture
+texture texture bone texture 0.500000 vertex material material bo
\ No newline at end of file
@@ -0,0 +1,36 @@
+texture material vertex vertex -1 -1
+texture
+vertex
+vertex
+= 1.0
+material anim material 1.0
+material vertex
+texture texture = = -1 = texture
+vertex frame bone 1.0 texture 0.500000 texture
+anim bone frame frame texture 1.0
+material frame
+-1 -1 vertex vertex 1.0 material material
+bone texture anim
+bone 0.500000 anim vertex 1.0 bone =
+bone -1 material material -1 1.0 0.500000 -1
+= bone = 1.0 frame frame frame texture texture material bone bone 1.0 vertex anim frame bone material vertex
+=
+frame
+material texture 0.500000
+-1 anim
+frame anim bone 0.500000 material -1 -1 frame vertex anim 0.500000 1.0 texture
+frame =
+= anim
+1.0 1.0
+texture vertex frame 0.500000 bone 1.0 vertex anim vertex material
+material texture
+anim material 1.0 1.0 = 1.0
+texture = = 1.0 0.500000 vertex frame material anim vertex anim
+texture 0.500000 vertex 0.500000 frame
+material
+vertex bone texture anim 0.500000 -1 material 0.500000 anim
+1.0 = 1.0 texture bone -1 =
+1.0 vertex
+frame -1 bone =
+material 1.0 anim bone bone -1 bone
+frame mate
\ No newline at end of file
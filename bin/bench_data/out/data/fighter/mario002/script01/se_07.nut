@@ -0,0 +1,75 @@
+material
+bone material bone 0.500000 anim 1.0 frame anim 0.500000 anim = frame
+frame
+=
+0.500000
+bone material 0.500000 anim anim 0.500000 frame
+frame
+material texture 0.500000 bone
+texture
+0.500000 vertex
+0.500000
+frame
+bone vertex anim 1.0 material 0.500000 frame anim
+0.500000
+frame
+-1 bone 1.0 =
+bone
+bone bone vertex 1.0 0.500000 anim anim
+0.500000 anim
+material
+material anim material
+frame material
+1.0 material anim frame
+0.500000
+material 1.0
+=
+0.500000 material anim
+material 1.0 0.500000 1.0 = bone
+frame 0.500000
+= texture -1
+anim texture texture
+1.0 bone =
+frame texture -1 1.0 = material bone -1
+-1 0.500000 0.500000
+material frame -1
+vertex -1 material frame anim frame material = frame
+vertex anim frame 0.500000
+bone texture bone material
+texture -1 bone -1
+frame bone 0.500000 1.0 material vertex texture 1.0
+=
+anim 0.500000 1.0
+-1 0.500000 bone
+1.0
+-1 0.500000 frame vertex
+1.0 material anim
+frame
+anim
+bone =
+-1
+bone -1
+frame -1
+= texture
+anim
+material material texture 0.500000 frame material texture texture
+texture bone = texture 1.0 = 0.500000
+material vertex material 1.0
+1.0
+bone = -1
+0.500000 1.0
+vertex anim texture
+= 0.500000 vertex 1.0 anim 1.0
+-1 bone frame bone 1.0 0.500000 material
+bone vertex 0.500000 bone
+bone
+bone -1 frame texture texture 1.0
+1.0 bone
+= 0.500000 -1 vertex anim
+-1 0.500000 anim
+-1 bone
+material anim 0.500000 =
+anim
+bone 0.500000 frame
+-1 anim -1 bone texture texture = bone 1.0
+material material vert
\ No newline at end of file
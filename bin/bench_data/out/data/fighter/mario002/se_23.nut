@@ -0,0 +1,223 @@
+vertex vertex
+0.500000 -1 material texture
+anim bone texture vertex frame -1 = 1.0 0.500000 texture
+anim texture texture
+0.500000 bone
+= texture material -1
+bone =
+-1
+texture anim anim 1.0 frame -1
+1.0 material vertex
+-1 vertex anim 0.500000
+= = bone bone
+1.0 vertex bone -1
+material
+texture 1.0
+0.500000
+vertex = material texture
+-1 = texture 0.500000 material frame anim anim bone
+anim = material anim bone material bone -1 anim frame anim
+-1
+anim
+-1 vertex
+-1
+texture anim = bone material
+frame
+1.0 material frame bone anim frame = 1.0 0.500000
+0.500000 bone
+anim 0.500000 1.0 = -1 material bone 1.0 -1 = material 1.0 -1 anim texture anim 0.500000
+= frame anim
+bone
+-1 = bone -1 = 0.500000
+0.500000 0.500000 vertex texture material 1.0 bone anim bone bone
+-1 texture
+material bone
+0.500000 material frame
+vertex texture
+material
+=
+vertex material anim bone frame frame 1.0 bone material 0.500000 vertex
+bone 0.500000 anim -1 -1 anim material = vertex frame material texture
+anim bone vertex 0.500000 vertex anim -1
+0.500000
+1.0 vertex = 0.500000
+-1 1.0 frame -1 material vertex =
+texture vertex anim
+bone -1 vertex bone anim texture texture -1 = -1 = bone vertex frame 0.500000 vertex anim 1.0 1.0 = 0.500000 anim 1.0 material vertex material vertex = vertex anim
+= texture -1 0.500000 bone texture 0.500000 = -1 frame material bone
+bone 1.0
+vertex anim anim
+= 0.500000 vertex vertex material -1 anim 1.0 anim vertex texture vertex
+= -1 vertex anim
+material
+vertex 0.500000
+=
+frame
+vertex
+anim 0.500000
+texture bone texture texture -1 = 1.0 material material = =
+anim
+texture anim frame = anim anim -1 0.500000 material bone vertex anim = material vertex 0.500000 vertex frame vertex
+vertex vertex
+= frame texture anim
+texture vertex bone 1.0
+vertex
+texture 1.0 material
+1.0
+0.500000 vertex vertex -1
+frame vertex -1
+material vertex
+bone 1.0 -1
+material =
+1.0 bone vertex anim anim bone
+0.500000 frame frame material
+texture texture
+anim 0.500000 material 0.500000 -1 = = = bone frame material
+-1 frame bone
+bone bone material
+anim = 1.0
+0.500000
+anim = bone material
+1.0
+anim = 1.0 0.500000 anim
+frame = texture texture frame vertex -1 =
+texture texture material 1.0 = bone = -1 material bone = frame
+1.0 1.0 vertex -1
+bone anim = material -1 anim material
+-1 anim bone
+-1 material -1 vertex vertex
+vertex anim -1 texture frame
+anim vertex 0.500000 texture vertex
+material 1.0 1.0 frame
+material material vertex material material
+frame
+frame
+texture frame
+-1 =
+=
+frame 0.500000 anim frame 1.0 material 0.500000
+= 1.0
+anim material frame material -1 bone
+1.0
+frame -1
+anim texture
+anim anim -1 material vertex vertex = =
+= 1.0 1.0 vertex 1.0
+frame 0.500000
+bone texture
+= vertex -1 anim 1.0 anim -1 = 0.500000 frame 1.0 vertex vertex = = frame frame texture
+1.0 vertex bone =
+bone frame
+material texture texture anim
+-1 bone 0.500000 bone material =
+vertex bone material frame material
+bone bone
+anim anim 1.0 1.0 = texture 1.0 0.500000
+vertex 0.500000 -1 bone material frame 0.500000 texture vertex
+= -1
+bone
+bone =
+1.0
+-1 texture
+1.0 0.500000
+material bone -1
+material material -1 texture
+vertex
+0.500000
+bone
+texture material frame frame bone anim texture bone material -1
+material bone
+material frame
+frame
+material anim
+texture frame anim material 0.500000
+anim 0.500000
+vertex 1.0 = bone bone = =
+texture 1.0 1.0 material 0.500000 = frame 1.0
+0.500000 vertex
+0.500000 1.0 bone material 1.0 anim
+texture frame 0.500000
+= anim
+texture
+= bone =
+frame -1 material
+material anim 0.500000
+texture 0.500000 material material vertex frame vertex anim bone
+texture frame =
+bone
+-1 vertex 1.0
+= vertex texture = 1.0
+frame 0.500000 0.500000
+1.0
+frame 1.0
+vertex
+=
+0.500000 texture -1 = bone = -1
+bone
+-1 1.0
+bone
+1.0 vertex
+vertex vertex 0.500000
+1.0 material
+=
+-1
+texture anim material anim material = = anim material -1
+= = bone 1.0 vertex anim
+bone frame
+= bone anim material material
+bone
+= material 0.500000 bone = anim texture anim 0.500000 1.0 0.500000 0.500000 = -1 -1 = texture frame vertex texture 0.500000 0.500000 anim = 1.0
+texture
+bone material
+material
+= vertex
+1.0 -1 bone
+1.0 bone
+material
+1.0 frame texture anim bone -1 0.500000 texture 0.500000 vertex frame material 0.500000
+0.500000 frame
+anim = anim bone
+-1 -1 anim vertex
+vertex -1 frame
+= material anim
+frame
+1.0 frame
+= = 1.0 = anim
+1.0 =
+anim 0.500000 -1 material
+-1 -1 frame anim -1 material vertex 0.500000 bone
+bone 1.0 -1 frame 0.500000 anim
+vertex 0.500000
+1.0 material -1 anim vertex texture material -1
+1.0 -1 -1 texture bone -1
+= 0.500000 material -1 1.0 material -1 texture
+frame
+-1 1.0 vertex 1.0 texture 0.500000 = texture = frame vertex 0.500000 0.500000
+0.500000
+vertex
+0.500000 texture bone -1 vertex -1
+vertex material
+vertex
+vertex anim bone
+= 1.0
+vertex
+frame bone texture -1
+vertex
+texture frame texture
+frame 1.0
+texture texture
+= vertex bone
+texture 1.0
+1.0
+anim
+anim bone vertex texture =
+anim 1.0 -1 = material
+bone
+frame vertex anim anim anim = frame material anim material texture 1.0 -1 anim =
+material 0.500000 anim
+anim material 0.500000 0.500000
+bone
+frame bone vertex
+vertex material texture bone =
+vertex
+1
\ No newline at end of file
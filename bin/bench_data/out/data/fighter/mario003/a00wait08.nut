@@ -0,0 +1,35 @@
+bone material =
+1.0 frame vertex
+material texture 1.0 0.500000 =
+bone vertex
+1.0 texture anim vertex
+anim -1 vertex -1
+= texture
+texture material 1.0
+bone 0.500000 vertex
+1.0 = 0.500000 -1 texture
+vertex material
+frame anim
+bone =
+= texture -1 =
+vertex 1.0 -1
+vertex =
+0.500000 material 0.500000
+vertex -1 1.0
+-1 texture
+frame material texture 0.500000 -1
+bone =
+frame anim anim
+frame material texture -1
+anim bone vertex
+0.500000
+vertex 1.0 texture
+bone material 1.0 vertex
+frame
+1.0 anim
+= 0.500000 texture
+bone bone vertex
+anim anim = anim
+material 1.0 bone material
+anim texture
+bone = 0.500000 frame = texture 0.500000 0.500000 frame anim
\ No newline at end of file
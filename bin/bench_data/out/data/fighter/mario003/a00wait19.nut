@@ -0,0 +1,7 @@
+-1
+-1
+vertex
+bone anim
+-1
+anim
+1.0 0.500000 fram
\ No newline at end of file
@@ -0,0 +1,250 @@
+material
+-1 texture
+0.500000 0.500000 1.0 -1 anim
+frame vertex material
+bone -1 vertex bone frame
+-1
+anim
+texture -1 texture bone 0.500000 = texture 1.0
+= bone frame 1.0 material -1 =
+material 0.500000 anim frame
+1.0
+-1 anim material texture
+texture texture texture material 1.0 vertex 1.0 frame 0.500000 material frame
+0.500000 0.500000 anim
+0.500000 bone
+texture 0.500000 anim frame 1.0 -1
+texture vertex
+anim -1 material frame bone -1 vertex
+vertex
+anim frame anim vertex
+-1
+vertex -1 frame -1 -1 -1 = texture 1.0 1.0
+vertex anim anim vertex = vertex 0.500000 frame vertex vertex =
+1.0 0.500000
+material 0.500000
+1.0 vertex vertex
+1.0 bone -1 texture
+texture vertex material
+texture
+= -1
+0.500000 material -1 texture anim
+0.500000 material 1.0 -1 1.0 anim
+1.0
+1.0
+-1 1.0 0.500000
+bone material
+bone
+texture anim texture = vertex
+-1 vertex
+vertex 1.0
+0.500000 vertex vertex bone 0.500000 anim
+anim = anim vertex frame bone = vertex = bone vertex
+vertex = bone frame
+-1 material material texture anim 1.0
+anim frame
+0.500000 0.500000 bone = bone texture -1
+texture material texture
+= frame bone vertex
+1.0
+bone texture vertex bone
+material
+bone 1.0
+-1 vertex frame material 0.500000
+= 1.0 texture texture 1.0 anim
+1.0 1.0 =
+anim
+material frame
+material
+1.0 0.500000
+material frame bone anim frame material texture
+0.500000 anim frame frame anim material anim material 1.0 frame anim 0.500000 = vertex
+bone bone material anim frame material
+bone material
+-1 material
+= frame bone frame
+= vertex
+anim bone = = anim 1.0 anim
+bone 0.500000 bone 0.500000 = anim = frame vertex -1 1.0 frame -1 vertex
+material 1.0 material 0.500000 1.0 anim 0.500000
+-1 0.500000 = 1.0 -1 vertex material 0.500000 texture texture
+-1
+anim
+0.500000 1.0 vertex material = 0.500000 bone -1
+texture 0.500000 -1 -1
+0.500000
+frame bone
+1.0 -1
+bone anim = material -1 texture = 0.500000 frame anim = material frame bone -1 0.500000 -1
+0.500000 =
+1.0 =
+1.0 1.0 anim
+0.500000 0.500000 1.0 bone anim -1 vertex 1.0 bone -1 vertex vertex
+bone material anim material
+0.500000
+material
+texture 1.0 material anim
+frame -1 anim anim
+bone
+1.0
+1.0 0.500000 anim 0.500000 texture = frame
+= 0.500000
+vertex material bone vertex
+bone
+-1
+= anim
+frame = -1 1.0 -1 anim =
+1.0 material 1.0 -1
+anim anim 1.0 bone material bone =
+-1 bone anim = material material anim frame
+texture texture
+1.0 frame bone
+vertex
+material bone anim -1 0.500000 -1 -1 frame 1.0 material
+-1
+1.0 texture -1 frame 0.500000
+vertex
+= frame vertex vertex 0.500000
+vertex 1.0 1.0 0.500000 anim anim frame 0.500000 bone 0.500000 -1
+anim texture frame frame frame 1.0
+= anim 0.500000 0.500000 1.0 -1 1.0 0.500000 -1 = texture vertex anim
+vertex material texture
+bone = -1 1.0 frame 0.500000 0.500000
+bone material
+material
+1.0 0.500000 anim 0.500000 -1
+1.0 vertex
+material = material
+vertex
+bone 1.0 material 0.500000 anim 0.500000 vertex bone bone 1.0
+1.0 frame -1 bone -1 frame 1.0 vertex -1 -1 anim texture anim material vertex texture texture 0.500000 vertex
+anim 0.500000 = 1.0
+anim material
+material
+vertex material
+anim anim
+= texture texture -1 frame vertex frame
+1.0 texture material material material
+1.0 = texture anim
+frame
+texture material 1.0 texture texture frame frame
+vertex material
+1.0
+material texture
+anim -1
+texture 1.0 bone -1 texture 0.500000 frame anim frame 0.500000 0.500000 vertex vertex material = bone 1.0 vertex frame frame 1.0 0.500000 =
+bone -1 = material frame bone
+0.500000 = frame 1.0
+= -1 = bone anim bone -1 1.0 texture vertex texture -1 -1
+= texture =
+anim = = anim = 0.500000 bone
+frame vertex vertex
+vertex
+vertex frame frame frame material
+bone 1.0 1.0 -1 frame
+anim
+0.500000 bone vertex anim
+anim material bone
+anim material 1.0
+-1
+0.500000 = texture
+texture = bone anim -1
+vertex anim frame vertex vertex -1 1.0 =
+anim
+anim
+vertex 0.500000 vertex -1 1.0 =
+vertex frame
+anim material bone texture anim bone material = bone 0.500000 1.0 vertex material
+texture vertex
+= bone -1 frame 0.500000
+bone frame vertex material
+= 1.0
+bone
+-1
+1.0 1.0 texture 1.0 vertex bone
+-1 0.500000
+1.0
+= bone 1.0 bone 1.0 texture material texture material 0.500000
+0.500000 frame material
+anim texture 0.500000 frame
+bone bone
+frame 1.0 frame texture
+1.0 0.500000 bone -1
+anim
+1.0 0.500000 bone material texture vertex material bone anim anim -1 bone
+vertex vertex material
+vertex 1.0 material 0.500000 material bone -1 -1
+-1 material
+0.500000
+texture -1 1.0 vertex 1.0 -1 0.500000
+0.500000 0.500000
+1.0 bone material
+1.0 texture
+material material
+vertex texture texture anim = 0.500000
+vertex material frame
+-1 vertex -1 -1 texture
+frame frame = texture 1.0
+material
+bone material
+texture vertex 0.500000 anim 0.500000 texture = -1
+vertex
+-1 anim
+vertex 0.500000 texture anim
+= -1
+texture -1 1.0
+frame texture
+bone anim material
+0.500000
+0.500000 frame
+frame
+=
+material
+texture
+frame
+texture vertex frame 0.500000 anim bone 0.500000
+-1
+-1 vertex bone
+material
+bone 0.500000
+anim
+-1 0.500000 =
+vertex = =
+vertex anim
+1.0 texture = texture
+1.0
+0.500000 -1 vertex =
+= -1 = anim texture
+frame = vertex
+frame = =
+vertex -1
+1.0 anim -1 vertex material = texture material
+texture texture 0.500000 texture frame texture vertex 1.0 material anim material
+-1 -1 = 0.500000 1.0 0.500000 1.0 bone frame anim 0.500000 0.500000 -1 texture vertex
+0.500000 1.0 -1 0.500000 -1 = 0.500000 frame texture
+material frame
+bone bone frame 0.500000
+= = -1 1.0 vertex = material
+anim
+texture bone
+texture frame
+0.500000 material vertex material
+bone frame 1.0 anim vertex
+texture
+frame material frame frame
+frame = bone 1.0 texture = =
+vertex material frame =
+vertex
+texture vertex
+texture 1.0 0.500000
+vertex material
+vertex frame frame frame
+= material 0.500000
+texture bone anim 0.500000 anim 1.0 frame 1.0 material 1.0 = = frame anim 1.0 vertex 1.0 bone frame bone texture 1.0 anim
+texture
+anim 0.500000 bone -1
+0.500000 frame
+texture texture bone anim frame texture -1
+0.500000
+bone
+= frame -1 tex
\ No newline at end of file
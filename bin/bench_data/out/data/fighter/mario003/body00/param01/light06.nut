@@ -0,0 +1,8 @@
+bone 0.500000 -1 -1
+= 1.0
+texture frame
+material
+= 0.500000 vertex material material bone -1
+-1
+texture = 0.500000 vertex vertex bone = bone =
+vertex -1 frame 0.500000 1.0 material 0.500000 frame material
\ No newline at end of file
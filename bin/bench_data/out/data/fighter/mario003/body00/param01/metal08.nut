@@ -0,0 +1 @@
+S 1w$.8Nt|<sq}^
\ No newline at end of file
@@ -0,0 +1,116 @@
+vertex
+-1
+texture -1
+-1 frame 1.0
+1.0 frame =
+texture =
+vertex =
+1.0 material texture
+texture bone anim -1
+bone texture -1
+bone vertex material frame material texture vertex
+bone frame texture
+0.500000 anim
+-1 texture frame bone texture
+= bone vertex
+1.0 frame texture -1 -1 bone bone
+anim texture texture 1.0
+frame
+anim 1.0 vertex
+1.0 0.500000 material
+material bone 1.0
+vertex frame texture bone frame -1 1.0 material frame
+1.0 anim = -1 0.500000 frame
+anim -1 anim
+material anim = bone 1.0 -1 1.0 -1 0.500000 texture 1.0
+1.0
+1.0 vertex anim
+bone 1.0
+material 0.500000
+0.500000 = material
+bone
+bone -1 0.500000
+frame
+vertex = vertex
+vertex material
+frame
+anim = 0.500000 bone bone 1.0 = 1.0
+=
+texture 1.0 anim bone -1
+anim bone anim anim texture
+0.500000 1.0 material bone frame
+= texture 1.0
+1.0 anim 1.0
+texture
+=
+anim
+vertex anim 1.0 = texture
+bone texture -1 frame = vertex
+=
+texture = bone texture texture frame
+texture -1
+=
+bone 0.500000 =
+1.0 material anim frame 1.0 anim texture -1 vertex texture vertex
+1.0 bone frame
+texture -1
+anim material 1.0 material 1.0 anim frame material = material
+anim 0.500000 texture material frame 0.500000 texture 0.500000 = = texture bone 1.0 texture 1.0
+0.500000 1.0
+material
+-1 0.500000 = anim
+0.500000 frame 1.0 frame frame
+anim
+texture anim
+anim = bone = texture 1.0 anim vertex
+1.0 -1 -1 0.500000 frame
+-1 =
+texture material anim
+=
+material anim vertex
+texture material -1
+bone material anim
+1.0
+bone vertex vertex
+frame texture -1 1.0 anim
+material texture
+material
+texture = material = bone anim material
+anim vertex frame anim
+frame = 1.0 0.500000 -1 bone = bone
+frame bone anim = 0.500000 = anim
+frame 1.0 material 0.500000 bone frame = anim -1
+material material 0.500000 bone frame texture 1.0 material = -1 anim =
+frame frame texture anim 1.0 vertex 1.0 texture texture
+= -1 anim 0.500000 material 1.0 anim texture
+anim -1 bone
+texture
+material
+-1
+anim vertex 0.500000 0.500000 frame material vertex 0.500000 texture
+= frame
+-1 texture vertex bone texture anim texture 0.500000 material material frame -1 texture
+material vertex
+1.0 material
+0.500000 = material
+0.500000
+anim vertex bone vertex
+material frame
+texture anim
+texture
+=
+frame = 0.500000 texture
+vertex frame bone
+texture frame -1 frame anim
+-1 vertex 0.500000 vertex frame material anim -1 bone 0.500000
+material
+bone material texture
+anim material
+texture 1.0 bone material bone anim = texture vertex 0.500000
+material texture 0.500000 vertex bone bone anim vertex
+frame bone bone -1
+material 1.0 -1 material
+vertex -1 anim material
+material bone bone 0.500000 -1 = texture = bone texture
+frame material vertex
+= bone -1
\ No newline at end of file
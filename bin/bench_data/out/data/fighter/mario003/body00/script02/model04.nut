@@ -0,0 +1,205 @@
+0.500000 vertex bone frame vertex
+-1 1.0 = texture -1 material -1 material
+0.500000 frame anim bone material vertex 0.500000
+material 0.500000 vertex 1.0
+vertex frame = = = 1.0 frame vertex
+-1 frame
+texture 0.500000 vertex -1 = 1.0 = texture texture texture 0.500000
+texture frame frame vertex = 1.0
+0.500000 material
+frame -1 =
+0.500000 = anim material material anim vertex 1.0 texture frame
+-1 material 0.500000 material -1 1.0
+1.0 1.0
+= bone texture
+anim 1.0 = 1.0 vertex
+frame
+= 0.500000 anim -1 -1
+anim
+vertex material frame frame anim 0.500000 -1 frame bone
+0.500000 material 0.500000 texture bone bone
+1.0 vertex =
+anim 1.0 = frame texture texture
+anim 0.500000
+vertex bone texture
+vertex
+material frame
+0.500000 -1 frame texture anim anim
+0.500000 =
+material 1.0 frame texture =
+anim 1.0 material -1 bone anim = 0.500000
+1.0 1.0
+bone frame material 1.0 frame vertex 0.500000 -1 frame
+frame vertex anim vertex vertex
+material -1 = anim anim material = frame vertex anim =
+= -1 anim anim vertex material 0.500000 0.500000
+=
+0.500000 0.500000
+-1 frame vertex material = material
+vertex = vertex
+texture anim texture frame frame -1 texture material -1 texture vertex material
+vertex = = texture = 1.0 bone frame texture
+vertex bone -1
+-1 0.500000 anim -1 frame -1 -1 vertex anim bone texture material material anim anim =
+0.500000
+0.500000 vertex 1.0 =
+material 0.500000 1.0
+1.0
+bone 0.500000 0.500000
+-1 0.500000
+material =
+= frame anim texture
+= frame -1
+0.500000 vertex
+bone -1 = bone 1.0
+frame
+bone
+material 0.500000
+frame -1 texture material material material frame -1 vertex 0.500000 texture
+=
+material
+texture vertex material
+-1 vertex
+texture material 0.500000 frame vertex material frame
+texture 1.0 vertex material 0.500000 = 1.0
+anim texture texture material = 0.500000 -1 texture
+anim 0.500000 1.0 -1
+vertex
+anim 1.0 texture
+material texture
+anim vertex 0.500000 texture
+anim
+bone vertex
+0.500000 frame
+-1 frame 0.500000 texture 1.0
+vertex vertex anim 0.500000 0.500000
+0.500000
+frame -1 frame
+frame
+1.0 -1 texture
+frame frame =
+anim 1.0 -1 0.500000
+vertex -1 material texture
+material texture -1 vertex 1.0 1.0 -1 frame bone
+frame
+anim
+vertex -1
+frame -1
+frame vertex material
+frame bone 1.0 -1 frame frame 0.500000 0.500000
+= =
+0.500000
+material vertex
+texture bone
+anim 0.500000
+anim
+-1
+anim = = anim = =
+1.0 material
+material material 1.0
+= -1 frame 1.0 vertex vertex frame -1 texture anim
+material = frame vertex 0.500000
+bone -1 texture vertex texture material vertex anim frame 1.0 0.500000 material 1.0
+-1
+material 1.0 0.500000 bone = vertex
+vertex vertex =
+1.0 bone
+=
+1.0
+bone anim texture = vertex texture
+texture -1
+= texture material vertex vertex
+= material 0.500000 texture 1.0 bone texture bone -1 = texture 1.0 bone
+material bone
+anim -1 bone 1.0 frame
+frame 1.0 0.500000 anim
+0.500000 anim 1.0 vertex 1.0 bone
+bone 0.500000
+texture
+bone 0.500000
+0.500000
+material
+texture bone = frame
+frame 0.500000 texture
+anim
+material
+anim 1.0 material
+vertex texture 1.0 bone
+-1 -1 vertex vertex frame
+material =
+frame texture
+frame frame texture 0.500000
+= 0.500000 anim frame -1
+material
+-1 vertex
+frame anim = -1 = = bone texture 0.500000 0.500000 0.500000
+frame material material vertex
+material bone anim 0.500000
+frame 1.0
+texture frame
+anim
+0.500000 material anim material texture 0.500000 bone 0.500000 1.0 1.0 texture 1.0
+vertex
+1.0
+anim
+0.500000 vertex 1.0
+texture 1.0 vertex 1.0 anim -1 material
+1.0 -1 -1
+material
+frame vertex bone frame
+1.0 anim anim = frame
+bone frame
+-1 texture bone
+1.0
+1.0 frame -1 0.500000
+0.500000 1.0 1.0 vertex
+-1 0.500000
+vertex vertex anim vertex texture material frame texture = 1.0 anim
+vertex 1.0 vertex bone anim 1.0 1.0 frame
+1.0 1.0 -1
+0.500000
+-1
+texture 0.500000 = = material vertex = -1 anim bone = frame bone
+1.0
+texture = 1.0 anim -1 0.500000
+-1
+1.0 material bone texture material texture frame =
+vertex
+1.0 -1 texture bone material
+1.0
+=
+0.500000 material bone
+texture 0.500000 =
+1.0 vertex anim bone 1.0
+frame =
+0.500000 -1 texture
+frame material texture bone = -1 texture
+anim 0.500000
+1.0
+0.500000 frame = 1.0 texture 0.500000 anim frame
+texture texture texture 0.500000 bone
+anim bone material
+frame anim 1.0 material
+frame vertex vertex
+= vertex vertex frame
+vertex anim =
+1.0 vertex vertex frame texture
+frame -1
+0.500000 =
+-1 anim texture anim bone -1
+bone -1 = texture bone
+texture = anim
+1.0 anim -1 = -1
+frame texture
+0.500000 frame frame -1 = = bone material texture anim bone bone 0.500000
+-1 frame vertex
+texture vertex =
+0.500000 vertex bone
+vertex 0.500000 -1 frame anim material bone
+frame
+=
+0.500000 anim -1 anim vertex 1.0 frame = = texture texture frame 0.500000 -1 = vertex texture -1 -1 -1 = -1 texture
+0.500000 material vertex texture
+material vertex 1.0
+1.0 frame frame vertex -1 anim 0.500000 -1 texture
+= material = vertex bone material mat
\ No newline at end of file
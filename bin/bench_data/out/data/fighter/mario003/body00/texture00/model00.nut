@@ -0,0 +1,22 @@
+texture -1
+1.0 0.500000
+-1 1.0
+= vertex = 1.0 -1 0.500000 texture
+1.0
+frame anim bone frame 0.500000 anim anim bone frame anim bone 1.0 vertex =
+material -1
+-1 vertex bone
+frame
+frame
+material material vertex 1.0 -1 1.0 -1 -1 0.500000
+0.500000 -1
+bone
+-1 -1
+vertex texture = material -1
+0.500000 1.0 1.0
+-1 anim
+bone = bone
+bone
+frame 0.500000 material
+0.500000 texture 0.500000 0.500000
+texture material 0.
\ No newline at end of file
@@ -0,0 +1,70 @@
+-1 vertex vertex
+-1
+1.0 material
+material
+= texture
+anim = material
+material
+frame bone frame vertex vertex vertex
+material frame
+-1 material -1
+frame 0.500000 0.500000 = 0.500000 -1
+vertex frame -1 = anim frame 1.0
+= vertex
+= vertex = texture -1
+= -1 -1 material bone -1 anim = 1.0 anim vertex 1.0
+texture
+frame anim texture 1.0 = material texture
+frame
+material
+anim
+frame anim material bone
+= 0.500000 0.500000 = = anim = = anim frame
+-1 anim texture bone
+frame 0.500000 vertex = texture
+frame = frame 1.0 0.500000
+material texture
+-1 1.0 vertex frame 0.500000 bone texture
+bone vertex vertex texture
+0.500000 frame -1 texture
+texture = vertex 0.500000 1.0 anim material 1.0 frame anim
+-1 1.0 vertex 0.500000
+1.0 0.500000 frame vertex anim
+anim
+1.0 frame bone 0.500000 texture texture vertex frame bone material bone frame bone 1.0 frame
+1.0 material 0.500000 texture bone
+vertex
+0.500000
+vertex -1 1.0 texture
+texture
+1.0 = anim frame 1.0
+0.500000
+=
+-1 bone -1 bone anim
+bone
+0.500000 1.0 bone
+-1
+bone =
+-1 vertex
+0.500000 bone -1 vertex
+0.500000
+bone -1 bone material
+vertex vertex 1.0
+anim frame
+1.0 frame
+texture 0.500000 texture bone
+texture 1.0 frame texture 0.500000 vertex frame = bone 1.0
+1.0 texture -1 anim 1.0 = 0.500000 -1 0.500000 1.0 vertex vertex texture -1 =
+material anim anim frame texture -1
+frame = anim
+-1 1.0
+vertex texture
+anim bone = -1
+0.500000 -1
+1.0
+-1 anim material frame
+material frame
+frame -1 1.0 0.500000 bone
+vertex = = texture -1 anim texture
+1.0
+frame vertex tex
\ No newline at end of file
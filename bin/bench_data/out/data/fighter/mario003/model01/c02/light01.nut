@@ -0,0 +1 @@
+M\WJ-im.b؀!ŏb+G@ޅMlLvpVr0LM{Y#r%UM&v~C2KvKy->ڵa28n<2OZx6pjbo$(m?I.>8[m=	jܗ=}\FS~*(p_'`(dU6(h#Ѻlܺ.Ũ$Qod$8xI;vxs0Rl3"Td|CNj.1HHjGN{WsOQmBrGD҆?y	78nV
\ No newline at end of file
@@ -0,0 +1,8 @@
+texture frame 1.0
+-1
+frame -1 -1 -1 texture -1
+-1 texture texture
+anim bone 0.500000 -1
+vertex texture frame
+anim
+= 1.0 vertex 0.500000 ve
\ No newline at end of file
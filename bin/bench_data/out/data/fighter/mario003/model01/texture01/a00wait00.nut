@@ -0,0 +1,8 @@
+1.0 -1 vertex
+anim = texture vertex frame
+material material material
+material vertex texture vertex texture bone 0.500000 0.500000
+frame
+-1 -1 texture = anim -1 -1 material
+vertex 0.500000 material
+-1 -1 = 
\ No newline at end of file
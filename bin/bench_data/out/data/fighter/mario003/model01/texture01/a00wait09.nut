@@ -0,0 +1,30 @@
+0.500000 anim anim anim
+frame
+vertex frame anim texture bone 1.0 -1
+texture
+frame vertex
+anim
+-1
+= -1
+material
+-1 = -1 -1 = texture
+anim texture
+material bone frame texture -1 1.0 texture material -1 vertex anim vertex -1
+anim
+-1 1.0
+0.500000
+vertex = 0.500000 -1 vertex
+frame
+vertex texture
+anim vertex
+texture anim frame frame vertex texture frame
+frame anim frame material 0.500000
+texture
+material anim 0.500000 material material 1.0 1.0 -1 0.500000 -1
+bone
+bone texture material texture
+bone 0.500000 texture
+= texture material 1.0 =
+anim vertex
+vertex -1 material texture frame texture frame material 0.500000
+= 1.0 vertex 0.500000 1.0 te
\ No newline at end of file
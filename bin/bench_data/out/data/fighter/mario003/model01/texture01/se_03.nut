@@ -0,0 +1,182 @@
+bone bone bone frame
+0.500000 vertex bone = bone -1
+=
+0.500000
+material 0.500000
+anim bone 0.500000 -1 anim material material
+vertex
+1.0 vertex texture bone bone
+-1 frame anim 1.0 1.0 material texture anim 1.0 bone vertex 0.500000 texture -1 1.0 = frame
+= anim 0.500000
+anim 0.500000 1.0
+texture
+= 0.500000
+material -1
+1.0 0.500000 vertex = -1 1.0
+frame texture material texture -1 material bone
+anim 1.0
+0.500000 bone anim = 0.500000 =
+material = 1.0 vertex 1.0
+anim
+1.0 bone 1.0 texture
+0.500000 texture
+-1 bone
+texture
+0.500000 vertex 1.0
+0.500000
+1.0 vertex
+texture vertex = texture bone texture bone vertex
+1.0
+= 0.500000 material frame anim texture 0.500000 =
+= anim = -1 material
+-1 frame
+-1 1.0 frame -1
+frame 1.0 0.500000 material frame bone bone material = 1.0 anim
+=
+vertex 1.0 1.0 = = -1
+anim 1.0 texture
+= 0.500000 anim bone material anim
+frame texture -1
+bone =
+frame 0.500000 vertex bone frame vertex 0.500000 anim material 1.0 frame
+1.0 anim
+texture 0.500000 bone
+-1
+frame -1 1.0 texture 1.0 material -1 material -1
+bone bone bone texture frame 1.0
+material
+0.500000
+-1 bone texture
+vertex vertex frame bone vertex
+0.500000
+= -1 bone -1 0.500000
+1.0 1.0
+= bone
+texture -1
+material
+anim
+bone material anim texture -1 anim frame texture 1.0 = bone frame bone
+-1 vertex texture
+texture frame = 0.500000 vertex texture anim material vertex vertex -1
+material material
+texture =
+frame vertex vertex
+1.0
+1.0 1.0 material vertex
+material vertex
+material material frame 1.0
+anim material frame 0.500000 vertex
+texture
+= 0.500000
+0.500000
+= material -1
+-1
+material
+vertex 1.0 anim -1 0.500000
+anim vertex vertex
+vertex 0.500000 -1 texture 0.500000 0.500000 material =
+-1 frame anim texture 0.500000 = = bone bone
+vertex 1.0 1.0
+0.500000 =
+1.0 1.0 0.500000
+frame = frame texture frame frame 1.0
+=
+frame
+-1 frame
+1.0 -1 = -1 frame texture
+-1
+bone
+= = material 0.500000 frame
+1.0 1.0 texture
+0.500000
+texture
+anim
+1.0 -1 material texture
+= material 0.500000 vertex = bone material bone -1 0.500000
+0.500000
+texture
+anim
+frame frame
+frame
+vertex
+bone anim anim anim frame material texture 1.0
+material frame 1.0 0.500000
+vertex
+-1
+texture material 0.500000 texture bone -1
+1.0 1.0
+-1
+material anim
+material bone
+1.0 bone material
+frame bone texture texture
+material -1 texture
+1.0
+texture
+bone
+1.0
+= texture vertex 0.500000 anim = bone = material
+= 0.500000
+material texture bone frame material
+1.0
+anim material 1.0 material
+= material 0.500000
+bone -1 vertex
+1.0
+-1 -1 0.500000
+anim frame anim = vertex = texture frame 0.500000 vertex
+1.0 =
+texture = texture
+-1
+frame bone
+1.0 frame
+texture bone frame 1.0 vertex vertex
+vertex 0.500000 material -1 texture -1 anim bone = anim 1.0 anim 0.500000
+0.500000 frame anim
+frame = frame texture material texture vertex anim =
+0.500000 bone
+texture vertex frame material
+= anim material
+1.0
+anim material 0.500000 material
+0.500000
+1.0 bone material
+-1 0.500000
+bone -1 texture
+1.0
+bone 0.500000 -1 frame 0.500000 anim
+bone material = frame material anim
+-1 1.0 material =
+frame bone material vertex texture 1.0 frame
+material frame material anim
+-1 1.0
+bone 0.500000 material 1.0 vertex
+0.500000 1.0
+= texture
+-1 material
+bone
+= material
+1.0 frame
+= vertex = anim
+0.500000 vertex = -1 0.500000 material -1 texture frame material texture
+= frame
+1.0 bone 0.500000 -1
+bone -1
+0.500000
+-1 anim 1.0
+texture -1
+-1
+texture material material 1.0 = =
+1.0
+0.500000 = anim -1 material anim
+vertex
+0.500000 material = texture bone = -1
+frame anim
+-1 texture -1
+bone texture texture 0.500000
+anim frame texture -1
+material material frame material 0.500000
+=
+-1 bone bone
+1.0 = bone
+0.500000 1.0 vertex 0.500000 vertex 
\ No newline at end of file
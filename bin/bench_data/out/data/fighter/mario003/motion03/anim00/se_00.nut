@@ -0,0 +1,29 @@
+texture anim -1 frame vertex texture
+anim =
+= texture 0.500000
+texture 1.0 1.0 = -1 material = texture
+anim
+bone material -1
+frame =
+1.0 bone frame texture
+texture 0.500000 material texture
+anim
+0.500000 anim frame 0.500000
+-1
+=
+bone vertex
+vertex anim anim
+frame texture material
+vertex
+1.0 frame 1.0
+0.500000 = 0.500000 = anim 1.0 vertex material material frame
+1.0 vertex
+bone bone =
+=
+1.0 1.0 -1
+texture frame texture 1.0
+material = material material
+0.500000 texture frame 0.500000 bone 1.0 material anim -1 frame bone
+= 0.500000 1.0 anim frame anim -1
+anim 1.0 bone
+0.500000
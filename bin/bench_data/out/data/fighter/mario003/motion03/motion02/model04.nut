@@ -0,0 +1,30 @@
+=
+1.0 frame -1
+anim
+0.500000 0.500000 bone anim 0.500000 texture vertex bone
+-1 material 1.0 material 0.500000 0.500000 frame -1 texture = frame material material 1.0 bone texture 1.0 vertex material texture bone
+0.500000 vertex
+0.500000 vertex
+1.0 material -1 vertex -1 = texture = frame
+bone
+-1 material 1.0 bone material texture 1.0 -1
+texture bone 0.500000
+1.0 =
+1.0 vertex
+1.0
+1.0 -1
+texture anim vertex 1.0 -1
+frame frame -1 bone 1.0
+anim anim = 1.0 anim anim = material material bone frame 1.0 -1 = 0.500000 =
+anim frame
+vertex
+anim vertex 1.0
+material anim
+bone frame
+bone 1.0 anim
+= vertex =
+anim frame bone
+vertex -1 =
+vertex = = -1
+frame 0.500000 0.500000
+=
\ No newline at end of file
@@ -0,0 +1,14 @@
+0.500000 material
+1.0 anim anim
+bone vertex
+= vertex material
+material 1.0 -1 0.500000 anim
+0.500000 vertex anim bone 1.0 -1 -1 frame vertex -1 frame texture = bone material frame 0.500000 frame
+= texture
+1.0 material 0.500000
+-1 texture vertex texture -1
+1.0 material -1
+1.0 frame vertex -1 0.500000 frame texture = 1.0 anim
+texture -1 1.0 frame
+1.0 texture material
+anim frame fra
\ No newline at end of file
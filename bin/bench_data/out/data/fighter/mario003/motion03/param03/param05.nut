@@ -0,0 +1 @@
+&X;("pkNT޲MI7gцʮ5BZWdu)4lnM,V[\tDo˵HF9g0P*lc|DZs4=#zc&2YEQFyRȜe3'>nQՔWbW\?G{q2&PtD6xO%4H
\ No newline at end of file
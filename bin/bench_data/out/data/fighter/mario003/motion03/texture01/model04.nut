@@ -0,0 +1,21 @@
+bone vertex frame bone
+anim
+texture bone vertex
+= anim material
+0.500000
+bone bone vertex frame material
+-1
+material 0.500000 0.500000 anim
+-1 0.500000 material anim
+bone vertex 1.0 material -1 material anim 1.0 bone material
+-1 texture 1.0
+bone anim
+0.500000
+texture
+-1 0.500000 1.0 anim material
+0.500000
+vertex
+anim bone texture texture texture frame
+bone anim 0.500000 0.500000 -1
+0.500000
+0.500000 anim -1 frame bon
\ No newline at end of file
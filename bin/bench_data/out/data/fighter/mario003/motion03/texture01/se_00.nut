@@ -0,0 +1,317 @@
+material vertex frame anim -1 vertex vertex = bone
+-1 -1
+-1 0.500000 frame 1.0 frame
+1.0 bone
+material material
+1.0 bone material texture texture material anim anim texture material
+0.500000
+bone 0.500000
+-1
+material material -1
+anim frame 0.500000 1.0 -1 0.500000
+= frame -1 bone anim = 1.0 vertex material
+0.500000
+bone texture texture anim -1 frame frame -1 1.0 -1
+1.0
+bone anim frame 0.500000 frame = material
+=
+bone bone =
+bone 0.500000 -1 material
+-1 anim texture frame -1
+bone bone =
+-1 bone material
+bone -1
+material texture anim
+0.500000 frame material
+anim = material =
+1.0 frame material
+texture bone -1 bone 1.0 anim 1.0 -1 -1 material bone bone material texture = material
+0.500000
+frame
+1.0 bone material 0.500000 1.0 frame material
+vertex
+material = =
+1.0 1.0
+vertex material anim texture
+texture vertex = anim 0.500000 material -1
+texture bone bone material
+= texture 0.500000 vertex
+frame 1.0 material = frame
+-1 texture
+frame = vertex vertex
+vertex = 1.0
+= frame
+-1 = anim
+0.500000
+=
+bone
+texture anim
+0.500000 1.0
+anim
+bone frame vertex vertex 0.500000
+anim
+material bone = frame
+-1 bone frame
+1.0 vertex vertex bone -1 1.0
+= texture
+frame vertex bone frame
+frame
+1.0 1.0 material
+texture bone bone
+anim material
+-1
+material
+= anim material anim
+frame 0.500000 1.0 frame vertex material 1.0 =
+material -1 = bone
+material
+material 0.500000 bone -1 0.500000 0.500000 texture
+bone
+0.500000 1.0 material 0.500000
+-1 material = frame
+vertex frame
+0.500000 -1 vertex = material vertex -1 = material
+-1 material
+vertex
+1.0 vertex
+bone
+vertex bone -1 0.500000 vertex 1.0 vertex 1.0
+material
+1.0 1.0 = material frame = frame -1 anim 1.0 0.500000 0.500000
+1.0 frame vertex bone
+bone 0.500000
+vertex -1 -1 frame anim
+vertex anim texture 1.0
+0.500000 1.0
+bone vertex bone frame frame anim texture
+=
+= material texture vertex 0.500000 anim vertex
+0.500000 texture vertex material texture
+1.0 0.500000 1.0 vertex
+frame
+= material = 1.0 frame vertex
+anim 0.500000 1.0
+vertex 0.500000 material frame 0.500000 1.0 texture frame -1 frame = = 0.500000 frame
+bone
+0.500000 texture material
+= =
+0.500000
+material
+frame material -1 1.0
+bone vertex frame 0.500000 -1 -1 vertex 0.500000 anim 1.0 material 1.0 0.500000 frame frame =
+anim 0.500000 = vertex
+bone 1.0 frame
+material texture texture frame frame
+bone bone = = anim -1 0.500000 = frame frame anim vertex texture = vertex =
+-1 vertex
+0.500000 vertex 0.500000 texture material
+texture vertex frame = = vertex bone = 0.500000
+0.500000 texture -1 1.0 texture anim texture = vertex
+material texture
+= texture 0.500000 frame -1
+vertex 1.0 0.500000 material
+anim -1
+material 0.500000 anim material
+0.500000 frame vertex
+frame bone
+1.0 bone
+= -1 anim 1.0 frame
+= bone bone -1 0.500000 bone vertex material
+texture frame anim vertex
+= bone = material vertex
+material =
+-1 frame
+0.500000 anim texture
+-1 frame
+bone
+0.500000 1.0 vertex vertex
+frame 0.500000 0.500000 = vertex frame
+= = frame
+anim =
+material
+1.0
+bone
+material bone = anim = frame 1.0
+material -1
+-1
+anim bone material 1.0 material material material anim frame
+material
+bone
+anim = vertex frame 1.0 bone
+1.0 0.500000 = 0.500000 anim frame material anim texture = anim -1
+anim 0.500000 -1 vertex
+-1 vertex texture
+anim anim
+frame frame material texture
+1.0 vertex
+frame texture bone material anim bone
+1.0 = 1.0 0.500000
+material
+-1 0.500000 texture
+vertex 0.500000 frame frame frame
+bone 0.500000 0.500000 0.500000
+material texture
+0.500000 frame -1 frame 0.500000 0.500000
+0.500000
+1.0
+bone anim anim anim
+-1 vertex texture = material
+0.500000 frame
+= 1.0
+bone frame anim = frame bone 0.500000
+vertex
+0.500000 -1 texture texture
+frame 1.0
+anim
+texture material bone material
+0.500000 -1 bone
+anim
+frame
+frame anim
+anim bone 0.500000
+1.0 0.500000 1.0 texture texture
+= 0.500000
+anim 0.500000 1.0 0.500000 0.500000 -1 material 1.0 texture =
+frame vertex
+frame
+material bone = texture texture
+anim
+bone
+vertex vertex -1 texture 1.0 bone anim vertex 1.0 material anim material
+vertex -1 texture bone
+texture
+texture 0.500000 =
+texture material 0.500000 material anim
+bone bone 1.0 material -1 0.500000 vertex =
+-1
+frame = = 1.0
+1.0 vertex 0.500000
+bone -1 bone bone anim =
+0.500000 material frame 0.500000 -1 -1 = frame anim bone frame
+=
+-1
+0.500000 0.500000 -1 -1
+material texture
+material anim
+1.0 anim texture -1 anim anim frame
+0.500000 vertex 0.500000
+1.0 texture material
+material -1 0.500000
+frame frame -1 bone
+-1 texture 1.0 anim bone anim 0.500000 anim
+0.500000 bone -1 texture 1.0 bone = texture vertex = bone
+texture bone vertex material bone bone 1.0 = vertex = 1.0 1.0 1.0
+texture = bone frame texture frame material material vertex -1 anim bone frame
+material 0.500000 texture anim texture
+=
+vertex bone = bone vertex = bone bone =
+frame frame -1 material
+bone material 0.500000 1.0 bone = material
+anim
+1.0 = bone -1 bone -1
+1.0
+= texture 0.500000 anim frame frame =
+= 0.500000
+vertex
+material material frame frame -1 material
+texture 0.500000 frame
+bone
+anim
+bone
+bone
+1.0
+material 0.500000
+texture
+anim -1 anim -1 vertex
+1.0 1.0 texture frame anim bone material anim bone 1.0 texture texture 0.500000
+anim -1 material
+frame texture
+texture 1.0 -1 bone bone
+anim vertex
+texture 0.500000 0.500000 1.0
+bone
+bone 1.0 bone 1.0
+1.0
+texture =
+frame -1
+vertex
+1.0
+texture -1
+-1 material -1 bone -1
+material
+bone 1.0 vertex vertex
+texture material
+1.0 anim 0.500000
+=
+vertex vertex
+= material 0.500000
+texture 0.500000 1.0 bone 0.500000
+0.500000
+vertex material 1.0
+vertex 0.500000 0.500000 frame bone bone 0.500000 anim 0.500000 material
+-1
+material =
+1.0 = -1
+1.0 1.0 vertex 1.0 anim
+material bone = anim bone texture vertex = material = vertex = frame texture 0.500000
+bone
+vertex
+=
+0.500000 vertex
+material frame anim 1.0 vertex vertex
+material
+1.0 = 1.0 = -1
+vertex frame
+1.0
+0.500000
+=
+texture -1 vertex
+frame 1.0 1.0 frame texture texture 0.500000
+vertex material material -1 -1 vertex material texture 1.0 texture
+-1 1.0
+bone bone =
+texture texture
+frame 0.500000
+frame = texture vertex material material 0.500000 material
+frame = vertex -1 anim frame
+frame
+frame anim
+frame
+-1
+= =
+anim
+vertex
+anim texture texture
+anim vertex -1 vertex material 0.500000 frame vertex texture
+vertex 1.0 -1 1.0 = vertex material
+-1 = = frame vertex
+texture
+1.0 = vertex material texture texture 1.0 = texture
+-1 = = vertex texture
+-1 -1 0.500000 -1 vertex anim texture bone
+-1 texture -1 material 0.500000 bone 1.0
+= texture -1 material -1
+texture material frame
+frame material = frame -1 bone -1
+anim
+-1 -1 = = -1 = = material texture material vertex vertex
+1.0 vertex 1.0 anim frame vertex =
+1.0 texture anim material = =
+material = = frame 1.0 -1 frame
+1.0 1.0
+vertex anim vertex bone
+material 0.500000 -1 -1 0.500000
+anim frame
+frame 1.0 texture = 1.0 vertex texture material material bone -1
+anim = frame
+vertex
+vertex bone 0.500000 anim vertex texture frame
+frame texture anim
+-1 material texture = 1.0 anim -1 -1 texture anim
+texture anim vertex frame frame anim frame texture 0.500000
+texture vertex material bone
+1.0 anim anim anim 0.500000
+1.0 0.500000 vertex vertex material
+= texture 1.0 bone texture bone
+material
+0.500000 texture 0.500000 bone
\ No newline at end of file
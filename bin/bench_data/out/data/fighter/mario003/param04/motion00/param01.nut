@@ -0,0 +1,10 @@
+anim texture
+0.500000 1.0
+material 1.0 vertex material
+material texture
+-1 -1 vertex texture bone
+0.500000 texture texture vertex anim
+vertex 1.0
+1.0
+bone vertex vertex 0.500000 material texture bone
+vertex texture texture mate
\ No newline at end of file
@@ -0,0 +1,21 @@
+1.0 bone
+= = -1 anim
+frame
+bone -1 -1
+bone 0.500000 -1
+material
+material frame bone
+texture
+vertex bone
+0.500000 0.500000 0.500000
+0.500000 anim
+frame texture material
+1.0 frame =
+frame material texture
+vertex 1.0 -1 vertex
+texture
+bone 1.0
+-1
+texture bone frame -1 anim vertex texture 1.0
+material = anim vertex vertex 0.500000 texture
+-1 -1 frame 0.500000 material
\ No newline at end of file
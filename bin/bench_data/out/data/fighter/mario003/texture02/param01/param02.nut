@@ -0,0 +1,9 @@
+0.500000 frame 1.0 bone material
+0.500000
+texture
+= vertex 1.0
+-1 1.0 -1 bone = 0.500000 0.500000 vertex frame vertex = 1.0
+1.0
+1.0
+0.500000 vertex 0.500000 0.500000 0.500000 -1 vertex = anim material
+anim vertex 0.500000 bone verte
\ No newline at end of file
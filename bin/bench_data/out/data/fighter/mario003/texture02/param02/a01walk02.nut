@@ -0,0 +1,114 @@
+material vertex material frame bone anim =
+vertex vertex material
+=
+0.500000 material = anim frame vertex anim 1.0 1.0
+1.0 frame material material
+material material vertex
+-1 -1 anim bone material material anim anim bone material -1 =
+bone = frame
+1.0 1.0 bone = vertex frame 0.500000 vertex 0.500000 bone -1
+vertex -1 anim bone anim vertex 1.0 1.0 -1 -1
+texture 1.0
+0.500000 frame bone
+=
+frame frame frame
+0.500000 -1 1.0
+vertex 1.0 bone texture
+frame frame
+-1 1.0
+-1
+material anim
+texture
+-1
+0.500000 0.500000
+-1 1.0 texture frame = = bone
+texture vertex vertex
+-1 anim texture
+vertex
+frame -1 1.0 vertex vertex
+= -1 material
+= = -1
+-1
+vertex
+anim
+vertex texture 0.500000
+=
+frame texture bone texture frame bone 0.500000 frame 1.0 texture 1.0 vertex frame vertex material
+0.500000 texture vertex 0.500000 frame 1.0 material =
+1.0 1.0 bone = bone frame
+= material = vertex -1
+vertex 1.0 1.0
+frame -1 frame = texture = material
+texture frame
+bone
+vertex material -1 texture bone 0.500000 texture = 0.500000 -1 -1 texture
+anim
+bone
+-1 = 1.0 material texture 1.0 1.0 anim material bone 0.500000
+1.0
+texture vertex
+1.0 = = 1.0 -1 vertex
+anim texture 0.500000 0.500000 = bone
+frame
+bone vertex
+=
+material
+texture
+anim
+anim 0.500000 1.0 anim -1 -1 material texture anim texture bone 1.0 0.500000 vertex anim
+anim
+= material material material 1.0
+-1 -1
+texture -1 texture = =
+1.0
+1.0
+0.500000 -1 vertex bone vertex
+anim
+bone = texture = 0.500000
+1.0 0.500000 1.0
+0.500000 -1 texture anim -1 frame
+frame bone -1 bone
+texture =
+bone material
+-1 texture 0.500000 -1 anim 0.500000 texture texture material
+frame anim anim 0.500000 1.0 bone material bone vertex
+=
+frame
+texture material =
+bone bone material frame material
+material -1 1.0 frame texture 0.500000 material
+0.500000 frame -1
+texture frame -1 1.0 0.500000
+material 1.0
+texture material anim material
+texture material anim = anim vertex material
+texture
+0.500000 bone -1 frame 1.0 1.0 frame bone -1 material
+texture frame
+anim texture anim -1 texture 1.0 = = bone 1.0 1.0 vertex
+0.500000 1.0 -1 material
+-1 1.0 1.0 bone texture 1.0 texture material
+frame 1.0 1.0 1.0 1.0 anim 1.0
+-1
+material
+bone -1
+-1 0.500000
+1.0 1.0
+1.0 0.500000 texture 1.0
+-1 =
+material frame bone anim vertex bone bone 1.0 bone texture frame =
+bone -1 -1 bone
+vertex anim material anim material
+1.0 -1 0.500000 bone material
+texture
+material 0.500000 bone
+-1 material 0.500000 frame anim 1.0 1.0 texture
+=
+material 0.500000 anim
+material frame
+1.0 1.0 anim
+= texture bone material -1
+texture 0.500000 bone
+=
+-1 frame =
+1.0 frame anim 1.0 mater
\ No newline at end of file
@@ -0,0 +1,4 @@
+texture
+0.500000 bone
+texture -1 material anim bone 1.0 0.500000 -1
+0.500000 material texture -1 bone
\ No newline at end of file
@@ -0,0 +1,67 @@
+texture frame
+1.0 frame
+0.500000 frame
+-1 frame
+material bone bone 0.500000 anim bone material -1 anim = 1.0 bone vertex texture
+texture
+texture bone texture frame -1 0.500000 -1 -1 frame
+0.500000 frame 1.0 vertex
+vertex
+frame vertex anim = material frame anim -1 =
+-1 texture 1.0
+bone material
+bone bone
+= = 0.500000
+0.500000 texture 0.500000
+0.500000 anim frame
+anim material 1.0 frame texture texture 1.0 anim 0.500000
+material frame = = =
+0.500000
+material 1.0
+anim -1
+texture
+0.500000 -1 frame frame vertex material vertex bone anim material -1 frame anim material anim vertex = frame texture texture
+frame 1.0 texture material
+-1 vertex texture
+0.500000 texture texture
+=
+material 1.0 frame 0.500000 = material
+bone vertex
+-1 vertex
+bone
+-1
+frame 1.0 -1 0.500000 0.500000 =
+vertex
+vertex material = texture texture
+1.0
+vertex
+= texture =
+0.500000 bone material texture material material
+=
+0.500000 -1 vertex frame
+texture anim frame texture -1 1.0 texture vertex 1.0
+texture bone 1.0
+bone vertex material texture = bone anim 0.500000 texture 1.0 material vertex 1.0 texture texture -1
+0.500000 anim vertex bone anim frame material vertex anim 1.0 -1 frame 0.500000 0.500000 = 0.500000 1.0 texture
+bone material bone 0.500000 1.0 frame -1 = frame 1.0
+anim vertex 0.500000 material = anim anim bone material material -1 frame -1 0.500000 0.500000 1.0 vertex -1 anim frame
+bone
+material texture material material
+1.0
+bone anim
+frame frame
+=
+material material = 1.0 =
+bone anim -1
+anim
+material texture texture
+0.500000 bone = bone anim
+vertex 0.500000 material 1.0 frame bone -1 frame
+1.0 texture 0.500000
+-1
+material
+texture material anim vertex -1
+0.500000 frame vertex 1.0 -1 0.500000 frame 1.0 1.0
+= -1 = vertex 0.500000 anim -1 frame 1.0 =
+-1 vertex material vertex anim material
+material textu
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone texture
+frame -1 anim frame frame -1 
\ No newline at end of file
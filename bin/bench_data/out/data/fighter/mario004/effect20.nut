@@ -0,0 +1,354 @@
+anim 0.500000 material
+material texture
+frame
+material
+0.500000
+material 0.500000 0.500000 1.0 texture
+frame
+material material
+-1 bone =
+material texture
+-1 material material texture bone texture -1 1.0 material 1.0
+= texture material
+texture texture vertex frame -1 = vertex bone vertex
+1.0 anim anim material 1.0 -1 bone
+0.500000
+-1 anim frame vertex
+anim
+=
+frame = = -1 material anim texture
+texture material material 1.0 0.500000 material 1.0 anim anim texture -1 material anim 1.0 -1
+anim
+vertex anim bone -1 =
+anim anim
+anim material anim -1 bone
+material
+frame =
+= 0.500000 vertex anim texture texture
+0.500000 frame
+0.500000 bone material 0.500000 -1 texture -1 1.0 vertex = anim = vertex 0.500000 frame
+0.500000 frame vertex material
+bone
+material
+material -1 frame 1.0
+bone material -1 -1 = -1 texture anim -1 vertex
+1.0
+material = frame frame bone frame 1.0 material
+= -1 material 0.500000
+= texture
+= -1 vertex = material 1.0 bone 1.0 = anim material frame vertex texture
+vertex 0.500000 = 0.500000 bone frame 0.500000
+-1 texture 0.500000 = -1 texture
+texture bone
+texture = vertex 1.0
+-1
+material -1 texture
+= vertex 1.0 vertex 1.0 frame vertex frame texture 1.0 anim bone anim
+vertex 0.500000
+frame frame frame bone =
+frame =
+0.500000 bone texture
+texture 1.0
+= -1
+texture
+material 0.500000 frame
+texture frame = vertex anim material
+texture texture anim 0.500000
+texture 0.500000
+= texture
+anim -1 vertex 1.0 frame -1 bone vertex
+frame 1.0 = anim bone 1.0 =
+= anim
+anim -1
+0.500000 = bone
+= 0.500000 frame = 0.500000 1.0 1.0
+1.0 frame material texture 0.500000 frame -1 texture frame -1 -1
+bone
+-1 1.0
+1.0 = vertex -1
+vertex bone 1.0 texture anim 0.500000 1.0 texture
+bone 1.0
+material
+frame texture 1.0 0.500000 bone
+texture frame frame = material = -1 bone anim texture
+vertex anim bone -1 1.0
+vertex bone = vertex frame texture vertex = 1.0 = anim 1.0
+frame material = frame 0.500000 -1
+1.0 texture 0.500000 1.0 texture frame 0.500000 1.0
+anim vertex =
+1.0 anim bone texture
+bone anim -1
+0.500000 anim 0.500000 material frame anim 1.0 anim vertex
+0.500000 1.0 frame 1.0
+=
+-1 material material = anim material anim 1.0 material 1.0
+0.500000 vertex
+= -1 vertex 1.0
+frame
+vertex
+texture
+bone
+bone = material frame anim frame
+vertex = frame frame
+material frame frame material frame
+1.0 texture 0.500000 0.500000
+material bone -1
+1.0 frame 1.0 1.0 -1 frame = texture vertex material 1.0 texture 0.500000 texture 0.500000 vertex = vertex -1
+= 1.0 0.500000
+-1
+texture
+anim
+material bone
+0.500000 anim texture anim = vertex = 0.500000 bone
+anim bone 0.500000
+1.0
+-1
+0.500000
+= material bone texture bone = texture frame
+anim material 1.0
+= -1 vertex texture bone 0.500000 material frame texture = anim frame vertex
+-1 -1 texture material -1
+frame -1 bone 1.0 = = anim
+-1
+= 1.0 bone = 0.500000
+anim 1.0
+-1 vertex -1 1.0
+0.500000 0.500000
+vertex 1.0 bone 1.0
+material
+anim texture texture vertex =
+bone material
+vertex
+1.0 =
+1.0 vertex 1.0 0.500000
+anim vertex
+anim anim anim = 1.0
+= frame
+texture vertex texture
+bone
+-1 =
+bone
+frame 0.500000
+1.0
+-1 material -1 -1 material =
+1.0 -1
+0.500000 frame
+= 1.0 anim vertex
+0.500000 material bone
+frame texture material -1 =
+frame vertex frame
+texture
+frame
+-1 -1
+frame anim 0.500000 vertex vertex texture vertex 0.500000
+vertex bone = frame
+bone bone material
+vertex
+material 1.0 -1 frame -1 texture anim
+=
+1.0 vertex = texture =
+0.500000
+1.0 1.0
+= -1 material bone
+texture
+bone texture
+frame frame texture
+-1 bone anim frame 1.0
+bone
+frame frame anim texture -1 vertex
+anim
+anim
+frame 0.500000 anim anim 1.0 1.0 vertex frame -1 anim texture 1.0
+vertex 1.0 =
+vertex material
+anim material material
+texture = 1.0 bone bone
+anim -1 frame vertex material
+=
+anim
+material
+0.500000 0.500000 vertex bone
+texture anim anim = anim material
+frame material bone = material =
+frame 0.500000 vertex -1 1.0 texture bone
+1.0
+vertex material -1 texture texture -1 vertex
+anim 0.500000 0.500000 bone bone vertex 1.0
+-1
+bone 0.500000 material 1.0
+texture bone material bone frame vertex 0.500000 0.500000 vertex material bone bone anim = anim 0.500000
+=
+0.500000
+vertex vertex material material vertex
+= frame = 1.0 = 0.500000 0.500000 vertex vertex anim vertex frame
+bone vertex = bone texture bone 1.0 1.0 -1 -1 frame -1 0.500000 1.0 anim 1.0 frame
+material
+= texture
+material vertex = frame
+frame bone
+0.500000 frame
+bone
+bone vertex bone texture 1.0 texture 0.500000 1.0 0.500000
+texture bone bone vertex texture
+anim
+0.500000 vertex -1 = vertex material
+material = vertex frame anim bone material
+bone 1.0 anim material bone vertex
+1.0 0.500000 texture texture anim 0.500000 0.500000 vertex
+bone bone = 0.500000
+anim =
+0.500000
+bone 0.500000 texture 0.500000 anim frame 0.500000 1.0 bone
+-1 bone 1.0 bone texture
+texture material
+bone -1 vertex frame = material texture vertex anim
+texture
+=
+-1 1.0 bone = 1.0 0.500000 bone -1 1.0 texture
+frame frame anim =
+frame vertex texture -1
+0.500000 bone 0.500000 material anim
+frame
+0.500000 bone 1.0 frame texture
+texture =
+=
+anim material material
+vertex 1.0
+-1
+frame texture vertex vertex
+material frame texture -1 = 1.0
+anim frame 1.0 texture
+-1
+= texture material frame vertex 1.0
+vertex anim
+material 0.500000 frame 1.0 1.0
+vertex material
+texture frame
+vertex = anim anim
+vertex 0.500000 =
+frame frame
+vertex 1.0
+bone bone vertex bone
+vertex vertex 0.500000 bone =
+anim
+frame anim 1.0 texture vertex vertex material bone frame anim
+vertex 0.500000 -1 frame vertex frame
+= bone vertex anim
+frame frame vertex anim
+vertex frame =
+1.0 1.0 vertex -1 frame bone
+= frame = bone
+1.0
+vertex anim vertex 0.500000
+frame
+0.500000
+vertex frame 0.500000 material -1 bone
+frame vertex = 0.500000
+texture -1
+anim =
+vertex 0.500000 -1 vertex frame -1 anim -1 frame
+= frame -1 vertex bone = frame -1
+material
+0.500000
+vertex
+= bone texture 1.0
+bone 0.500000
+0.500000 material -1
+1.0 material frame 0.500000 frame
+= texture material 0.500000 bone bone -1 anim = bone 1.0
+material vertex frame frame material -1 bone
+vertex 1.0 material texture frame 1.0
+-1
+anim bone
+bone vertex frame
+0.500000
+vertex = material anim 0.500000 texture 0.500000
+bone
+material
+frame = 1.0
+frame
+anim material anim
+1.0 frame bone -1
+1.0 -1
+bone
+bone
+-1
+1.0 -1 0.500000 -1 bone
+= -1 anim
+1.0
+=
+=
+frame frame 0.500000
+=
+1.0
+bone frame vertex
+0.500000 texture texture anim anim = frame texture
+-1 vertex bone frame
+bone material 0.500000
+texture
+frame texture
+vertex frame bone 1.0 bone texture -1 = texture
+bone bone material
+= 1.0 =
+vertex
+texture
+1.0
+material = material 0.500000 =
+material vertex 1.0
+= vertex bone anim vertex = bone 0.500000 0.500000 vertex 1.0
+0.500000 material 1.0
+= texture
+frame material bone vertex
+bone
+1.0 0.500000 0.500000 material 1.0 -1
+material material 0.500000
+texture
+1.0 vertex -1
+bone 0.500000 material anim vertex
+-1 frame vertex material vertex anim 1.0 texture bone anim = -1
+material
+vertex vertex material =
+0.500000 texture
+1.0 material vertex 0.500000 bone bone 1.0
+0.500000 -1 -1 vertex vertex
+material frame
+= anim bone anim bone
+texture vertex frame texture
+bone texture texture vertex -1 texture frame vertex frame frame 0.500000 texture 0.500000
+frame 1.0 vertex bone
+vertex -1 vertex bone
+= bone material 0.500000 frame 0.500000 = texture frame
+bone bone material texture texture 1.0 = material
+= frame
+anim 0.500000 = 0.500000 frame = -1
+bone 0.500000
+-1 vertex frame vertex 0.500000 anim 1.0
+frame 1.0 anim anim -1 anim 0.500000 1.0 material anim
+0.500000 vertex
+material anim texture frame
+1.0 anim anim material frame
+material
+1.0
+material bone frame anim
+frame material bone vertex texture 1.0
+bone 0.500000 frame 1.0 = -1
+texture texture -1 material vertex bone vertex 1.0 0.500000
+anim 1.0 anim frame 1.0 vertex -1 0.500000
+texture material vertex bone frame -1 = 1.0 = anim
+= = = -1 0.500000 bone = 1.0 =
+frame 0.500000 anim anim frame
+vertex frame
+bone frame vertex frame 1.0
+-1 vertex -1 = frame material bone texture anim vertex
+anim texture =
+frame -1 material bone
+material
+material frame 0.500000 1.0
+frame =
+bone
+material
+frame -1 -1 bone
+bone material
+vertex frame
+anim frame texture
+material textur
\ No newline at end of file
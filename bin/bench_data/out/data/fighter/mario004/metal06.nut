@@ -0,0 +1 @@
+0.500000 material anim bone frame 0.500000 materia
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 0.500000 texture
+texture
+0.500000 
\ No newline at end of file
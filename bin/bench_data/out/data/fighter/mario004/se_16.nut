@@ -0,0 +1,27 @@
+vertex
+0.500000 -1 material texture anim bone -1 0.500000
+vertex -1 0.500000 -1 -1 1.0 = material texture texture
+frame vertex anim
+anim 0.500000 anim vertex
+0.500000 frame -1 anim bone
+bone bone
+bone
+anim texture bone material material texture anim bone -1 -1 1.0 1.0 frame anim 1.0 material 0.500000 -1 texture
+texture
+vertex material material -1 =
+anim -1 material bone texture
+anim
+anim
+texture
+1.0 1.0 bone vertex bone material texture
+material = material texture -1
+= =
+frame bone 0.500000 1.0 material
+1.0 0.500000 = 0.500000 1.0 -1 bone 0.500000 texture 0.500000
+-1 vertex vertex frame = 1.0 0.500000 = 1.0 material -1
+frame frame bone -1
+-1 1.0 anim 1.0 vertex frame frame frame -1 -1 1.0 texture =
+bone
+texture 1.0 vertex
+0.500000 bone -1 texture -1
+anim bone material texture texture vertex bone bone
\ No newline at end of file
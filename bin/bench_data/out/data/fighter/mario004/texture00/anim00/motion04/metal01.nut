@@ -0,0 +1,333 @@
+1.0 1.0 anim texture 1.0 frame -1
+0.500000
+anim
+-1 texture = texture
+-1 anim = frame 1.0 =
+bone -1 material -1 = = vertex bone vertex material frame material
+texture anim
+0.500000
+bone anim frame material
+= -1 vertex vertex
+-1 0.500000 anim
+vertex frame
+1.0 = 1.0 = bone
+0.500000 anim texture vertex -1 frame frame frame
+1.0
+vertex frame vertex anim material
+1.0 frame bone vertex -1 material
+frame vertex texture frame = 0.500000 0.500000 = = bone texture -1 frame
+= frame -1 1.0 = 1.0 frame
+-1 1.0 material vertex
+frame -1 = texture 1.0 anim
+vertex = texture
+frame bone
+frame anim vertex 1.0
+1.0 -1 1.0 material material material bone vertex material = texture frame frame = -1
+bone frame texture
+-1
+texture 0.500000 frame 1.0 texture frame = material
+material anim material
+1.0 1.0
+= 1.0 -1
+-1
+-1 texture
+material
+-1 = 0.500000 0.500000
+= material texture 0.500000 = material 1.0
+-1 0.500000 texture
+anim
+bone
+material texture
+texture = = = =
+anim
+vertex bone
+frame frame bone texture
+0.500000 = texture texture material bone material
+0.500000
+1.0 material
+1.0
+-1
+frame =
+bone 0.500000 anim -1 0.500000 anim
+bone material -1 texture
+frame bone
+=
+bone 0.500000 material = bone -1 material vertex anim 0.500000 texture 0.500000 texture 0.500000 =
+texture anim anim -1
+material bone 0.500000 material
+-1 0.500000 material 1.0 bone frame = -1 1.0
+vertex bone
+material
+-1 = = material = frame anim 0.500000 vertex bone
+1.0 frame 0.500000 vertex
+frame frame
+= vertex 1.0 material
+texture anim anim -1
+texture 1.0 frame bone
+1.0 = =
+vertex anim frame bone
+bone = -1 0.500000 1.0
+anim material
+1.0 anim frame material
+= 0.500000
+-1 vertex =
+-1 = material = vertex
+frame material
+material
+frame 1.0 bone frame -1 = 1.0
+1.0 texture bone =
+frame texture bone
+material 1.0
+anim -1
+= =
+texture vertex
+frame vertex 0.500000
+=
+vertex anim frame frame 0.500000 0.500000
+material
+0.500000 bone 1.0
+material 0.500000 -1 texture anim
+vertex
+0.500000
+anim texture material
+texture bone vertex anim
+vertex
+anim
+bone 1.0 anim vertex vertex = anim vertex bone
+anim = anim 1.0 frame anim frame 0.500000
+material 1.0 material
+bone = bone
+=
+material 1.0 texture 0.500000 anim bone bone
+texture -1 anim 1.0
+= anim anim
+= material vertex 1.0 bone material anim = frame
+bone = anim
+vertex = texture 0.500000 = -1
+material
+material 1.0 texture bone bone 0.500000 = 0.500000 material
+frame -1 vertex material -1 texture
+anim bone texture = -1 -1
+bone
+vertex bone frame material texture -1 frame material anim = material =
+-1 texture anim
+0.500000 bone 1.0
+frame 1.0
+material texture material 0.500000 = texture = =
+=
+texture 0.500000 anim material bone 1.0 bone material bone vertex 0.500000 vertex material
+vertex material 1.0 material 1.0
+anim
+= = texture
+0.500000 = vertex frame -1 1.0 = vertex texture bone texture
+0.500000 0.500000 anim vertex
+bone -1 1.0 texture texture frame bone frame anim bone bone
+-1 =
+bone
+= -1 1.0 -1 -1 frame -1 1.0
+frame = = anim 1.0
+-1 -1 bone = 1.0 1.0 texture
+material
+texture frame =
+0.500000 0.500000 vertex
+texture
+anim = anim = texture 1.0 = bone
+1.0 1.0
+anim
+bone vertex 1.0 0.500000
+0.500000 = anim material 1.0
+=
+material
+= -1
+anim anim 0.500000
+0.500000
+vertex texture
+bone anim
+texture texture
+material
+-1 material vertex
+1.0 vertex 0.500000
+frame vertex texture =
+bone bone vertex 1.0 -1 texture texture anim
+anim 0.500000 anim -1 vertex texture -1 frame bone
+anim bone = frame =
+vertex = 1.0 texture
+-1 material = -1 0.500000
+material
+vertex -1 vertex frame -1 texture vertex
+bone
+frame material frame 0.500000
+1.0 vertex texture
+bone texture anim
+texture 0.500000 frame
+=
+1.0
+0.500000 vertex 0.500000 0.500000
+vertex frame texture anim bone 0.500000 bone = anim frame anim bone 1.0
+texture = -1 texture -1 = vertex
+material
+vertex frame
+=
+texture
+-1 -1 -1 1.0 -1 bone material -1 0.500000 anim
+1.0 bone 1.0 material material 0.500000 texture material 1.0 0.500000 frame bone 1.0
+-1 bone vertex anim 0.500000 texture
+vertex frame 0.500000 1.0
+frame
+bone texture anim = bone = vertex anim vertex
+vertex frame frame
+= 1.0 0.500000 1.0 0.500000 0.500000 = vertex vertex material
+= frame
+= material anim 1.0 vertex
+frame frame = material texture texture anim material material frame frame
+-1 vertex 0.500000 vertex
+-1 anim
+frame texture texture
+-1 -1 frame frame 1.0 bone
+vertex
+0.500000 bone 0.500000
+bone material texture bone frame vertex
+vertex vertex anim vertex texture
+frame = 0.500000 -1 vertex
+bone -1 anim
+frame
+frame 0.500000 vertex frame
+-1 vertex -1 anim anim
+anim frame 1.0 frame anim bone anim
+bone anim = bone 1.0 vertex 0.500000 bone texture
+0.500000
+frame
+-1 1.0
+-1 =
+-1
+1.0 -1 frame frame 0.500000
+1.0
+texture texture
+0.500000
+frame material 1.0 anim texture material 0.500000 = material frame 0.500000 anim
+anim frame =
+anim
+0.500000 frame
+1.0 0.500000
+anim vertex 1.0 bone vertex -1 -1 material =
+bone
+material frame -1
+frame vertex material 1.0 = 0.500000
+frame 0.500000
+frame
+bone
+-1 frame -1 bone =
+vertex vertex bone
+vertex anim
+frame texture bone -1 1.0
+-1
+bone
+1.0
+vertex bone 1.0 vertex
+0.500000 material texture anim
+-1 -1 bone 0.500000 = frame anim
+= bone vertex
+material -1
+vertex frame =
+material frame frame = 0.500000
+bone 0.500000
+0.500000
+1.0 -1
+-1 vertex
+bone vertex bone material
+-1
+bone anim
+-1
+bone
+= anim
+-1 frame
+0.500000 texture 1.0 texture
+1.0 0.500000 0.500000 material
+vertex bone 0.500000
+vertex 0.500000
+bone
+= bone = 1.0 anim material anim frame bone =
+material bone 0.500000 anim
+frame frame texture anim
+vertex
+texture 1.0 0.500000
+-1 1.0 bone = texture
+vertex 0.500000 bone
+vertex texture 1.0 1.0
+-1 vertex texture =
+vertex vertex 0.500000
+bone material 1.0
+= = material 1.0 1.0 bone = 1.0 0.500000 -1 anim material vertex anim texture 0.500000 = anim anim = vertex =
+vertex
+frame
+-1 vertex frame 0.500000 anim material vertex
+bone bone
+frame 1.0 anim
+material frame = frame anim material =
+material
+= 0.500000 anim 0.500000
+bone
+material texture = material anim frame anim texture 1.0 vertex
+bone
+vertex
+1.0 texture -1 texture
+= 0.500000 =
+bone texture material = texture texture vertex bone vertex material material
+= texture texture
+=
+frame texture
+bone vertex vertex frame frame material material 1.0 frame frame frame
+material -1 texture
+material
+1.0
+bone 0.500000 bone texture = texture
+frame
+anim texture frame anim -1 vertex frame texture bone frame
+material material anim =
+texture bone
+frame bone
+0.500000
+material material 0.500000 0.500000 0.500000
+texture
+1.0 = frame anim
+vertex
+frame frame bone -1 frame 0.500000 -1
+bone
+vertex vertex vertex
+material
+frame texture -1 frame = -1 material vertex anim
+bone bone 1.0
+0.500000 texture 0.500000 anim
+material
+bone texture
+1.0 frame
+= anim 0.500000 0.500000 bone
+1.0 bone anim
+vertex = bone material
+1.0 = =
+frame
+-1
+texture
+texture = texture
+=
+texture 1.0 vertex anim anim frame 1.0 texture 1.0
+0.500000
+1.0 0.500000 frame frame vertex bone anim 0.500000 -1 = vertex
+1.0 0.500000
+frame
+vertex frame
+frame bone
+= texture
+material 0.500000 anim =
+bone material
+frame
+vertex anim
+anim frame bone = 0.500000 bone anim
+vertex -1 frame 1.0 1.0
+vertex 1.0
+material = vertex -1 0.500000 texture texture 1.0
+bone 0.500000 bone
+vertex 0.500000
+= = texture 0.500000
+0.500000 material
+-1 materi
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 material 0.500000
+1.0 frame
\ No newline at end of file
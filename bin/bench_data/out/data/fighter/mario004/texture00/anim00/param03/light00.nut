@@ -0,0 +1,46 @@
+= -1 frame 1.0 0.500000 frame = vertex anim material = 0.500000 0.500000 -1 frame -1
+texture
+= vertex
+= = vertex texture
+vertex anim
+1.0
+anim
+frame anim texture -1 -1
+0.500000 material -1 1.0 vertex
+frame
+vertex -1 bone 1.0 bone 0.500000 vertex texture frame material 1.0 material -1
+anim
+frame material anim
+frame
+bone vertex
+= vertex frame =
+material -1
+frame anim 1.0 texture bone 0.500000 1.0
+0.500000 1.0
+texture
+1.0 vertex vertex -1
+vertex 1.0 frame frame frame frame
+=
+bone
+1.0 anim texture
+bone
+=
+=
+material frame =
+0.500000
+texture 1.0
+material material material texture 1.0 texture vertex -1 = 1.0 = texture frame bone
+bone vertex -1 frame
+1.0 vertex -1
+bone anim
+bone
+material
+texture
+texture frame
+-1
+vertex texture = anim
+1.0 0.500000 frame bone
+frame
+= material 1.0 texture
+0.500000 material 0.500000 -1 0.500000 0.500000 anim -1 -1 anim 0.500000 bone = material anim texture 0.500000
+= -
\ No newline at end of file
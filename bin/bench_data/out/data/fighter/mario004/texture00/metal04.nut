@@ -0,0 +1,283 @@
+texture = material 1.0
+bone
+texture = anim = material
+-1 frame anim 1.0 texture vertex
+material frame
+= bone
+0.500000 = anim
+1.0
+frame texture texture material frame
+1.0
+1.0 0.500000 0.500000 frame
+material =
+material -1 = frame texture vertex material frame vertex
+bone
+0.500000 texture texture material material
+0.500000 = = 1.0 1.0 1.0
+=
+texture 1.0 anim
+vertex texture texture texture
+-1 anim
+material 1.0 frame 1.0 1.0 texture
+bone frame bone bone 1.0
+frame 0.500000
+0.500000 0.500000 1.0 bone = 0.500000
+-1 anim 0.500000 = = frame frame =
+texture
+anim 1.0
+0.500000
+vertex bone anim 1.0
+= -1 frame
+vertex
+1.0 material
+-1 frame frame texture 0.500000 -1 0.500000
+material texture = 0.500000
+= vertex
+1.0 bone -1
+vertex vertex bone 0.500000 = -1 texture -1 1.0
+frame texture -1 -1 vertex = = 1.0
+= anim vertex -1
+-1 texture 0.500000
+1.0 material
+0.500000 anim anim bone 1.0 0.500000 0.500000 = vertex bone 1.0
+material bone material
+frame frame material material vertex
+= vertex anim material
+material -1 bone -1
+texture
+texture
+texture = 0.500000 frame = 1.0 material -1
+-1
+frame material frame texture
+0.500000
+anim bone frame 0.500000 frame anim material
+vertex vertex 1.0 frame vertex frame 0.500000 vertex
+material texture anim
+material -1 bone bone material vertex texture -1 bone -1 texture
+material 1.0 =
+=
+= anim texture = vertex 0.500000
+1.0
+0.500000 vertex 0.500000 = 1.0 -1 vertex frame
+vertex = bone frame 1.0 bone =
+anim bone material = anim anim
+texture frame -1 material
+anim
+-1 vertex 1.0
+bone
+frame 0.500000 frame anim 0.500000
+frame = 1.0
+bone frame
+0.500000
+anim
+anim 1.0
+anim 0.500000 anim = frame 0.500000 anim frame vertex 0.500000 -1 -1
+material texture texture
+1.0 -1 texture -1 = 1.0 material
+material = vertex 1.0 bone -1 vertex 0.500000 1.0 anim 0.500000 anim = bone
+vertex
+texture texture
+material vertex
+=
+=
+material anim -1
+0.500000 anim anim =
+bone material =
+texture = = material frame 1.0
+bone = material
+bone
+bone vertex -1 material frame -1 frame = -1 = -1
+bone =
+0.500000 frame material material frame material
+vertex vertex 1.0
+-1 anim
+texture
+vertex
+material 1.0 frame anim bone 1.0 = vertex vertex
+material bone -1
+material bone 0.500000 vertex frame material
+material
+-1 texture texture frame 1.0
+1.0
+frame material bone 1.0 0.500000 -1 texture 1.0 frame anim 1.0
+0.500000 =
+anim texture 0.500000
+frame
+texture
+= anim
+-1 bone
+=
+material = 0.500000
+anim
+frame
+= -1 material =
+-1 0.500000
+texture 0.500000
+material anim
+vertex bone 1.0
+vertex anim vertex = material frame 1.0 anim
+0.500000 1.0 bone vertex
+=
+-1
+anim material material 0.500000 0.500000
+-1
+1.0
+frame
+material frame
+0.500000
+vertex -1 frame
+texture anim = material bone 0.500000 bone frame texture =
+texture anim 0.500000 texture
+material frame
+bone
+0.500000 bone
+anim
+anim 1.0 -1 frame texture frame
+-1 bone texture bone 0.500000 1.0 frame 1.0 vertex
+bone
+-1 1.0 material frame 0.500000 1.0 texture vertex 0.500000
+frame 1.0 frame 0.500000 texture
+frame
+material
+bone 0.500000 anim vertex 1.0
+frame
+material
+vertex
+vertex anim anim
+0.500000 bone
+vertex frame 0.500000 texture 0.500000
+1.0
+= frame =
+texture vertex anim anim
+-1 =
+bone
+0.500000
+material
+1.0
+frame vertex -1 frame 0.500000
+-1 0.500000 vertex anim material frame 1.0 =
+-1 bone =
+=
+1.0 0.500000
+anim 1.0
+= 1.0
+-1 -1 1.0 0.500000 1.0
+= = frame 0.500000 = bone
+1.0 0.500000 1.0 frame = -1
+material
+anim material 0.500000 texture frame 1.0
+anim
+= texture = 0.500000 = material
+bone
+bone
+material 1.0 material -1 0.500000 vertex material vertex
+vertex 1.0
+texture = frame
+bone texture
+anim bone bone
+texture material 1.0
+vertex
+0.500000 -1
+texture 0.500000 frame
+vertex -1
+material
+frame texture 0.500000 vertex
+= material bone frame = texture vertex bone
+frame
+-1 = 0.500000 = = vertex -1 texture
+0.500000 frame anim 0.500000 bone material texture
+0.500000 anim
+anim 1.0
+0.500000 vertex 0.500000 frame vertex texture =
+material 0.500000
+material anim
+= vertex 1.0 = frame texture
+vertex 0.500000 1.0 material 1.0
+0.500000 bone material anim bone frame
+bone 0.500000 vertex 0.500000 1.0 1.0
+vertex 0.500000 texture
+bone anim 0.500000 bone vertex 1.0
+=
+frame
+vertex anim -1 bone texture
+frame vertex material = material
+vertex -1
+material =
+texture vertex anim 0.500000 -1 vertex bone texture
+material frame 0.500000 frame bone
+1.0 0.500000
+=
+material = material = -1
+anim
+anim anim
+-1 -1 -1 anim
+frame frame = material material
+1.0
+0.500000
+-1 texture
+texture texture
+vertex = anim texture bone
+anim frame bone bone vertex bone texture material
+= texture material = material = bone = frame
+vertex
+= -1 frame =
+texture
+frame anim frame anim
+vertex
+-1
+anim material frame 0.500000 1.0
+bone = material frame anim frame material material
+bone 0.500000 -1 =
+texture =
+0.500000 = bone bone -1 texture frame bone -1
+bone
+= 0.500000 texture = vertex bone 0.500000 texture
+frame vertex
+bone
+0.500000 vertex
+material bone material bone bone texture -1 0.500000
+bone 1.0 vertex
+=
+vertex 1.0 anim bone frame -1 texture -1 = -1
+material = -1 material frame 1.0
+material
+texture anim texture 1.0 anim bone frame 0.500000 0.500000
+anim
+-1 -1 texture texture 1.0 anim -1 -1 frame
+bone
+bone vertex -1 = material -1 -1
+material 0.500000 frame 1.0 1.0 1.0 anim bone texture anim
+0.500000 bone vertex
+0.500000
+-1 bone -1 0.500000 frame bone 0.500000 material -1
+material material material anim texture
+bone frame 0.500000 material
+material 1.0 = 1.0
+frame 1.0 material
+-1 bone -1 texture
+vertex texture =
+frame bone 1.0 anim texture -1
+0.500000 -1 = bone
+bone
+vertex texture texture = anim = vertex 0.500000 =
+vertex 0.500000 anim material anim
+bone anim bone -1 0.500000 1.0
+frame 0.500000 texture texture
+vertex -1 vertex
+= bone material -1
+-1 vertex material -1 0.500000
+material 1.0 frame texture vertex vertex = material frame 0.500000 material 0.500000 material bone = 0.500000 frame bone frame
+texture
+-1 -1 = anim = = texture bone = material 0.500000 0.500000 material
+1.0 anim -1 = texture = bone 1.0
+bone
+= -1
+0.500000 anim texture vertex
+anim bone bone -1 bone
+bone -1 vertex -1 1.0 anim material vertex frame
+0.500000 -1
+material vertex
+frame material = material 1.0 material vertex 1.0
+= frame anim
+-1 bone = bone frame
+vertex bo
\ No newline at end of file
@@ -0,0 +1,150 @@
+vertex 0.500000
+-1 material = 1.0 anim
+= -1
+0.500000 1.0 = vertex frame
+vertex 0.500000 material texture
+texture anim
+0.500000
+anim 1.0
+frame = -1 -1 1.0
+material bone texture anim 0.500000 vertex 0.500000 anim = frame 1.0 1.0
+material bone -1
+vertex frame anim texture -1 texture material frame =
+vertex material
+texture
+=
+anim texture = texture -1
+vertex =
+= 1.0
+material frame vertex 1.0
+0.500000 =
+0.500000 1.0 0.500000 anim
+frame -1 texture
+-1
+vertex vertex frame
+material =
+0.500000
+= material 0.500000 bone
+= anim texture
+material anim
+0.500000 1.0 texture
+texture bone 1.0 bone bone vertex frame material vertex
+frame anim
+material 0.500000 frame frame material
+vertex -1 -1 =
+= vertex
+material 0.500000
+1.0
+anim
+= 0.500000
+0.500000 anim frame
+texture
+0.500000 bone
+anim 0.500000
+bone anim texture
+= material material bone -1 -1 frame
+= bone
+anim anim = = 1.0 material
+frame
+-1 bone frame
+anim material
+anim
+anim bone = -1 texture
+frame = anim
+anim = -1 0.500000
+1.0 = material
+bone 1.0 1.0 anim anim 1.0 0.500000 anim 1.0
+bone = texture material
+= -1
+= 0.500000
+bone texture -1 =
+0.500000
+anim 0.500000 bone texture 0.500000 =
+= frame texture bone 1.0 bone = frame anim bone anim = = bone material 0.500000
+texture anim -1 vertex
+-1 bone frame texture texture anim
+1.0 material
+anim
+bone
+texture
+-1 -1
+0.500000 material vertex = =
+texture 1.0 = material 1.0
+frame bone 0.500000 texture 0.500000 bone 0.500000 frame bone 0.500000
+frame -1 1.0 frame -1 vertex =
+0.500000 -1 anim 0.500000 texture vertex material anim bone
+texture anim bone 0.500000 -1
+0.500000 anim 1.0 = 0.500000 -1 0.500000 material texture frame = anim material material = 1.0 1.0 vertex
+bone
+material texture texture
+vertex frame
+texture frame anim =
+frame vertex
+frame frame frame material = texture material 1.0 1.0
+material
+bone 1.0
+= vertex vertex bone material -1 -1 frame material = =
+bone = anim -1 vertex
+= texture
+anim frame frame
+bone texture
+-1 -1
+1.0 -1 frame 0.500000 -1 vertex
+-1
+1.0 -1
+material texture frame frame vertex vertex
+frame
+vertex 0.500000 anim texture bone 1.0
+material bone 1.0 1.0 bone
+1.0 -1 anim material -1 0.500000 frame
+vertex 0.500000 1.0
+= anim texture anim = anim material texture material frame material
+-1 material frame 1.0 = vertex
+material vertex bone vertex bone
+0.500000 material
+anim vertex
+= anim vertex
+texture
+1.0 bone vertex
+-1 -1 frame 0.500000 = bone frame bone
+frame material vertex =
+frame material
+material 0.500000
+1.0 texture
+= anim bone vertex =
+= frame 1.0
+= anim -1
+texture -1
+anim 1.0
+= frame
+frame texture = -1 0.500000 = vertex
+bone =
+material
+1.0
+vertex anim -1 vertex texture
+anim anim vertex
+vertex 1.0
+1.0 = =
+frame material
+texture -1 -1 -1
+texture 1.0
+anim anim
+texture
+vertex -1 anim = vertex material
+vertex -1 = anim -1
+0.500000 bone
+frame 1.0
+frame
+frame frame vertex
+0.500000 = = frame anim
+texture vertex 0.500000 anim frame anim anim frame 1.0 bone =
+-1 0.500000
+anim material 1.0 frame vertex
+0.500000 -1 bone
+anim
+vertex vertex 1.0 0.500000 frame
+1.0 1.0
+= bone frame 1.0
+1.0 1.0 vertex vertex bone
+-1 1.0 frame
+anim textur
\ No newline at end of file
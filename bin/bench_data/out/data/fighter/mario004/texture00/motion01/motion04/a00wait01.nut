@@ -0,0 +1,6 @@
+bone anim 1.0
+-1 bone = 1.0 anim bone -1 material -1 frame
+1.0
+1.0 bone
+=
+material 
\ No newline at end of file
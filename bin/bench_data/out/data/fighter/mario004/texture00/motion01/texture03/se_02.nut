@@ -0,0 +1,9 @@
+frame
+-1 = =
+vertex vertex 0.500000 material anim = = 1.0
+= 0.500000 bone = = = vertex texture
+0.500000 vertex frame anim
+bone -1
+anim
+1.0 anim =
+anim
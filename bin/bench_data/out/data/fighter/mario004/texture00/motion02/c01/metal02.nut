@@ -0,0 +1,122 @@
+vertex vertex anim
+frame anim -1 0.500000
+0.500000 anim anim = texture
+= bone
+0.500000 anim
+material material frame -1
+= -1
+frame
+= bone material bone texture 0.500000 1.0
+material -1
+bone -1 texture = frame material 0.500000 =
+vertex -1 0.500000
+1.0 material 0.500000
+0.500000 bone
+-1 frame = texture anim -1 anim 0.500000 vertex bone texture texture frame 1.0 texture texture bone -1 anim
+vertex frame
+texture texture anim 1.0 -1
+material 1.0 1.0 anim 0.500000 texture anim 0.500000 frame frame vertex
+1.0 bone
+=
+= bone material -1 1.0 bone =
+-1 bone
+texture texture bone
+=
+material frame
+1.0 anim
+= 0.500000 bone
+anim 1.0
+= material anim bone vertex -1 bone
+texture texture texture frame anim = -1 -1 material 1.0 texture frame vertex 0.500000 bone bone bone
+0.500000
+0.500000
+= -1 texture 1.0 frame anim frame -1
+0.500000 bone 1.0
+vertex
+texture bone -1 bone 0.500000
+bone texture bone
+texture 1.0 anim material vertex frame bone -1
+anim =
+anim
+bone frame =
+material = bone
+-1
+1.0
+material anim vertex -1 frame material -1 1.0 = bone material texture
+-1 vertex 1.0 bone
+texture texture 0.500000 frame texture texture
+vertex -1 0.500000 anim
+bone material frame -1
+vertex -1 1.0 -1 =
+bone bone = vertex texture material -1 vertex -1 texture bone
+1.0
+frame = =
+frame texture bone
+frame 0.500000 vertex
+0.500000
+texture material bone bone = 1.0 frame -1 bone -1 -1 vertex
+-1 -1 0.500000 frame 1.0 frame
+bone 1.0 frame
+0.500000
+material
+texture
+1.0
+= =
+frame vertex texture
+frame
+anim texture vertex 1.0 1.0 frame texture -1 0.500000 vertex
+anim 0.500000 1.0
+-1 bone
+-1 anim frame =
+frame
+material
+material 0.500000 1.0 = frame anim 0.500000
+1.0 frame 1.0
+texture 0.500000 frame
+anim
+bone
+-1 vertex = bone
+bone material 1.0 1.0 anim =
+bone anim 1.0 vertex -1 frame 0.500000 frame = texture 0.500000 = 1.0 texture =
+frame
+anim -1 anim anim
+-1 frame bone
+1.0 vertex vertex texture = texture texture material material 0.500000 -1 texture vertex = material
+frame anim 0.500000
+material vertex frame
+= anim =
+texture frame texture bone texture
+0.500000
+texture
+bone frame material bone
+bone 0.500000 frame bone material
+texture 1.0 bone -1 vertex vertex anim texture anim
+vertex anim -1 vertex bone 0.500000
+bone material
+texture material anim
+1.0 frame texture -1 texture = vertex = texture texture frame 1.0 -1 frame material
+0.500000
+material 0.500000 0.500000 vertex material 1.0 material anim
+-1 = =
+bone
+bone
+-1 material bone frame 1.0
+vertex -1 texture material anim = frame texture
+texture texture
+-1 -1 bone -1
+bone =
+texture frame 1.0 vertex bone bone anim anim material 0.500000 anim texture 0.500000
+vertex -1 bone
+anim
+frame
+vertex -1 material anim frame
+bone frame
+0.500000 material anim texture anim frame vertex vertex
+vertex
+material -1 0.500000
+=
+bone
+vertex
+texture material
+= material texture vertex texture texture texture frame = bone frame anim
+material
\ No newline at end of file
@@ -0,0 +1,6 @@
+frame
+0.500000 vertex
+texture vertex
+-1 -1
+0.500000 1.0 vertex
+a
\ No newline at end of file
@@ -0,0 +1 @@
+*k"`91Jx(^03U /E-)X4ZOPJ%꯬Xlr]|ݗ
\ No newline at end of file
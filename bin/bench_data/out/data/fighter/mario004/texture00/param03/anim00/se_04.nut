@@ -0,0 +1,36 @@
+texture 1.0
+bone -1 anim bone
+1.0 bone 1.0
+vertex anim anim vertex texture frame 1.0 texture anim 0.500000 texture anim material vertex vertex material 0.500000 -1 frame
+frame
+1.0 anim bone
+frame -1 texture bone material 0.500000 frame
+texture frame -1
+material
+frame
+bone material
+-1 0.500000 bone
+1.0 anim
+frame
+vertex material bone anim bone = texture
+material 1.0 frame frame bone bone -1 bone
+anim vertex bone
+frame frame = -1 = = bone frame
+material vertex
+anim vertex texture 1.0 -1 1.0 anim 1.0
+bone bone vertex bone
+material anim
+vertex bone material vertex vertex frame -1
+vertex 0.500000 = vertex frame = frame frame material texture material
+bone material = = frame material texture
+1.0 0.500000
+bone frame -1 frame texture =
+= 0.500000 material -1
+vertex 1.0 bone texture
+1.0 anim 0.500000 1.0 0.500000 material
+0.500000 material bone bone -1 = material material texture
+0.500000 1.0
+= texture
+0.500000
+bone material 1.0
+frame 0.
\ No newline at end of file
@@ -0,0 +1,5 @@
+anim =
+vertex 0.500000 anim frame
+1.0 material
+material
+-
\ No newline at end of file
@@ -0,0 +1,8 @@
+0.500000 -1 0.500000 anim anim texture bone -1 frame texture
+= = texture texture -1
+0.500000
+anim anim -1 1.0 anim material texture texture bone frame -1
+bone
+anim 1.0
+anim -1
+1.0 a
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex -1 texture -1
+vertex frame
+vertex frame = 0.5
\ No newline at end of file
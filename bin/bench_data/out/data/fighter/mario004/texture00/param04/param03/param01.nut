@@ -0,0 +1,16 @@
+anim
+-1 1.0
+= vertex bone -1 material material bone =
+= frame
+1.0 material
+0.500000 -1
+texture 0.500000 = = texture 1.0 frame texture anim 1.0 1.0 material frame material frame 1.0
+bone -1 0.500000 texture -1
+= = bone
+bone 0.500000 vertex texture frame anim -1 -1 1.0 1.0 0.500000 texture anim material anim 0.500000
+anim -1 frame 1.0 material 0.500000
+texture bone
+bone -1
+0.500000 1.0
+= vertex
+-1 anim frame material 0
\ No newline at end of file
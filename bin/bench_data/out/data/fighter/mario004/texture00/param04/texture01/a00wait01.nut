@@ -0,0 +1,45 @@
+anim -1 anim
+texture
+anim
+0.500000 frame bone frame bone texture
+material vertex
+texture -1 1.0
+material -1 material texture bone
+=
+0.500000 material vertex = vertex
+bone 1.0 bone = texture texture vertex 1.0 -1 bone anim -1 vertex
+material anim
+frame -1 -1 vertex =
+bone
+0.500000 0.500000 1.0
+material = frame bone material texture bone -1
+frame 0.500000 vertex texture
+0.500000 material 1.0 vertex bone anim -1 = = bone -1 = 1.0 vertex
+frame anim =
+-1 anim -1
+bone anim
+frame 0.500000
+= frame -1 vertex bone
+frame
+frame -1 texture -1
+-1 material
+= frame anim bone material -1
+1.0
+= vertex texture 0.500000
+texture
+frame vertex texture bone = anim 1.0 bone = material texture bone material -1
+0.500000
+frame
+= material =
+= 1.0 0.500000
+anim
+0.500000 texture = anim frame frame frame texture
+1.0
+-1
+anim
+texture vertex -1
+frame =
+vertex texture
+= -1
+texture material frame
+0.500000 1.0 vertex = 0.500000 1.0 frame vertex = = a
\ No newline at end of file
@@ -0,0 +1,58 @@
+material 0.500000 vertex 1.0
+vertex 1.0
+vertex frame bone
+0.500000 -1 texture = -1
+frame texture vertex = 1.0 bone 0.500000 1.0 bone
+-1
+bone bone
+bone
+= texture bone
+vertex
+-1 = vertex
+bone frame 0.500000 bone texture bone frame 0.500000 0.500000 anim 1.0
+-1 frame =
+vertex
+0.500000
+texture vertex anim = bone 1.0 bone anim -1 bone texture
+texture material =
+bone anim vertex anim
+bone
+= vertex -1 frame texture material texture
+material 1.0 1.0 anim 0.500000 texture 1.0 vertex -1 bone texture material bone -1 anim
+bone texture anim
+anim
+0.500000
+material 1.0
+material vertex material
+=
+vertex vertex frame anim bone 0.500000 0.500000 1.0 anim 0.500000
+-1
+material material
+1.0 bone anim anim
+material anim bone -1 1.0 vertex -1 -1
+1.0 material anim bone 0.500000 -1
+-1 -1 vertex anim
+1.0
+texture frame
+vertex bone
+frame
+bone
+anim = bone anim
+-1 texture
+1.0
+0.500000
+frame
+bone bone -1 frame anim bone
+material 0.500000
+vertex 0.500000
+1.0 -1 frame -1
+vertex
+texture texture material texture frame
+=
+1.0 frame vertex
+= -1 anim bone =
+anim bone
+material material anim 1.0 0.500000 0.500000 vertex frame 1.0
+material anim
+anim = anim
+0.500000
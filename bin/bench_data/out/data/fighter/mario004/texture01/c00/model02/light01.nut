@@ -0,0 +1,116 @@
+0.500000
+bone frame material material
+texture material
+vertex bone texture vertex vertex
+anim texture vertex anim -1
+-1 material material
+1.0 1.0 1.0
+texture material frame
+texture
+material 1.0 texture = 1.0
+frame
+= = 1.0 anim anim 1.0 material vertex 0.500000
+vertex 0.500000
+= 0.500000
+vertex vertex 1.0 anim =
+anim bone anim 1.0
+texture
+material 0.500000
+1.0 material
+vertex -1 frame texture
+-1 material material
+vertex bone vertex 0.500000 = 0.500000 bone
+1.0
+0.500000 -1 frame anim bone 0.500000 bone
+-1 bone 0.500000 -1 material
+0.500000 bone 0.500000 anim -1 bone texture 1.0 1.0 vertex
+1.0
+vertex bone material
+0.500000 0.500000
+texture 1.0 0.500000 =
+texture texture = bone = bone 1.0 vertex
+-1 1.0
+0.500000 = texture
+1.0
+-1
+bone material bone =
+frame bone
+texture -1
+frame material bone texture 0.500000 frame
+1.0
+0.500000 bone = vertex 1.0 texture 1.0 vertex material bone material 1.0 -1 = -1
+-1 0.500000
+vertex =
+frame
+-1 1.0 vertex frame vertex material = frame -1 =
+bone bone
+bone vertex vertex =
+anim
+1.0 1.0 vertex material = -1 bone frame 0.500000 -1
+frame bone = -1 bone
+= bone 0.500000 frame 0.500000 frame material vertex
+anim texture vertex
+0.500000
+=
+1.0
+texture -1 texture -1 0.500000
+1.0 = texture material frame frame
+1.0 = 1.0 anim -1 0.500000 -1 bone 1.0 frame
+vertex vertex
+-1
+anim material frame
+-1 anim
+= = 1.0
+vertex
+-1 texture frame
+-1 material 0.500000
+frame = texture
+texture 0.500000
+frame texture 1.0 texture 0.500000 bone
+texture material -1 vertex 1.0 bone bone = =
+= 0.500000 frame material frame
+0.500000 = material
+bone
+-1 0.500000 texture anim frame -1 anim anim
+=
+bone -1 material texture = texture 0.500000 bone anim 1.0 bone anim anim frame
+frame
+0.500000
+vertex = anim
+material vertex frame 1.0 vertex = 0.500000 vertex 0.500000
+-1 -1
+-1
+material frame
+vertex texture
+anim anim = material = texture
+0.500000 0.500000 1.0 material vertex
+bone 1.0 0.500000 texture texture = frame 1.0 texture
+texture 1.0 bone -1 material
+bone
+frame vertex
+-1
+frame material =
+0.500000 = vertex =
+1.0 anim texture bone
+texture texture anim = texture
+material material frame -1
+0.500000 anim
+vertex -1 vertex material
+material = frame vertex vertex bone vertex anim material frame bone material 1.0 0.500000
+bone texture texture frame frame frame frame
+vertex 0.500000 texture frame 1.0 frame bone material
+1.0 0.500000
+anim frame
+1.0 = texture
+material vertex 0.500000 material material bone anim 0.500000 -1 1.0 texture material anim -1
+frame 1.0 anim frame -1 -1 vertex
+frame anim vertex texture 0.500000 vertex material
+= material bone vertex frame = material
+frame vertex = = vertex = 0.500000 vertex vertex
+anim texture vertex
+material material
+frame
+frame 0.500000
+anim vertex texture 1.0 1.0
+material anim
+-1 0.500
\ No newline at end of file
@@ -0,0 +1,5 @@
+texture -1
+-1 1.0
+vertex
+= 0.500000 texture vertex
+anim b
\ No newline at end of file
@@ -0,0 +1,10 @@
+frame vertex
+= 0.500000 anim 1.0 bone = bone
+-1 vertex anim frame
+vertex bone
+material 0.500000 material vertex 0.500000 0.500000 texture = 0.500000 texture = vertex = anim vertex -1 0.500000
+0.500000
+bone = 1.0
+frame material frame
+vertex
+-
\ No newline at end of file
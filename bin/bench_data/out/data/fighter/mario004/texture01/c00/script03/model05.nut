@@ -0,0 +1 @@
+p>+9'C;')Ru]^MIbf#"'cGtxpM55	g;U=
\ No newline at end of file
@@ -0,0 +1,143 @@
+texture 0.500000 1.0
+= anim 0.500000 = -1
+1.0 -1 = material
+1.0 = 0.500000
+material texture
+material material 1.0 frame = 1.0
+-1 0.500000 anim bone 1.0 texture bone frame
+anim frame vertex
+0.500000 texture bone material frame -1 -1 frame vertex texture 1.0 material texture frame material -1 bone 0.500000
+bone = 0.500000
+bone
+vertex material
+1.0 frame
+material texture frame -1 =
+-1 -1
+vertex
+vertex frame
+anim bone vertex texture anim texture -1 = anim =
+anim anim
+= anim anim frame 1.0 bone bone vertex texture 0.500000
+-1
+vertex material
+1.0 anim
+0.500000 texture bone texture frame
+anim texture = anim anim texture vertex 1.0 = texture vertex -1 material
+texture
+vertex texture
+texture bone vertex
+bone 0.500000 texture bone 1.0 material vertex texture frame material
+= material anim 1.0 1.0 -1 vertex texture
+0.500000 vertex texture anim bone 0.500000 0.500000 -1 vertex texture material texture anim bone frame 1.0
+material 1.0 1.0 1.0
+texture -1 anim 1.0 frame
+anim
+frame 0.500000
+material = bone 1.0 material
+texture
+material -1
+-1 1.0 0.500000 material
+texture
+vertex
+anim 0.500000 material
+material material anim vertex bone
+material -1 1.0 texture 1.0
+anim anim -1 material texture
+bone
+vertex texture
+0.500000 vertex anim texture material
+anim material
+bone frame bone texture texture frame = = 1.0 texture material texture vertex bone
+1.0
+1.0 material 0.500000 = vertex 0.500000 bone
+texture -1 1.0 vertex bone material
+frame 1.0 1.0 =
+vertex material vertex vertex = frame texture vertex
+bone = bone -1 -1
+material anim -1
+texture texture
+-1 vertex vertex
+= vertex
+material =
+material
+1.0 vertex -1 frame vertex texture
+bone
+anim
+-1 = =
+frame -1 bone texture texture vertex 0.500000 frame
+= 0.500000
+-1
+1.0 anim texture bone vertex
+bone material 0.500000 -1
+bone
+bone vertex frame material -1 1.0 anim
+=
+bone material = bone
+texture
+-1 bone =
+-1 1.0 -1 0.500000 0.500000
+frame bone
+bone
+1.0 -1
+bone -1 material -1 material 1.0 0.500000 anim anim anim bone -1 vertex
+-1 vertex frame vertex material vertex
+texture vertex vertex vertex
+frame vertex material
+frame vertex bone vertex material = frame texture vertex frame vertex
+1.0 material
+texture
+=
+texture
+0.500000
+-1
+anim
+-1 0.500000
+texture = -1 frame vertex vertex vertex 1.0 vertex 0.500000
+vertex bone anim vertex
+texture material texture anim 0.500000 bone material = 0.500000 =
+texture 1.0 frame -1 material
+anim frame
+material vertex frame 0.500000 1.0 anim =
+1.0 1.0 texture texture
+-1 1.0
+-1 texture -1
+bone bone bone frame
+= 0.500000 bone frame 1.0 0.500000 0.500000 texture frame
+= bone
+frame
+= bone -1 anim bone -1 = frame
+0.500000 material texture
+material 1.0 0.500000 vertex frame
+0.500000 0.500000 = material bone
+frame
+-1 0.500000
+=
+frame
+1.0
+-1 -1 -1
+frame material = 1.0 material bone texture -1
+frame =
+bone -1 vertex
+anim =
+1.0 0.500000 bone
+texture vertex 0.500000 anim vertex
+1.0
+1.0
+-1
+= anim
+=
+material 0.500000 vertex frame
+= anim
+1.0 1.0 frame -1 bone
+1.0
+1.0 frame
+vertex vertex
+bone vertex
+bone 0.500000 frame bone -1 = vertex 0.500000 texture anim frame vertex frame
+frame vertex
+vertex bone
+vertex vertex vertex 0.500000
+0.500000
+= = frame bone frame 1.0
+-1 -1 bone texture
+anim material 
\ No newline at end of file
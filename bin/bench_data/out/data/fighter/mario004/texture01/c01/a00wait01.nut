@@ -0,0 +1,5 @@
+anim 0.500000 -1
+bone
+texture bone
+vertex anim
+anim
\ No newline at end of file
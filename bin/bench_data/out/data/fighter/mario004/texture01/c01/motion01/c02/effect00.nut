@@ -0,0 +1,17 @@
+-1 0.500000 = anim 0.500000 vertex frame
+=
+anim
+material
+bone
+= material vertex bone
+1.0 1.0
+vertex anim vertex texture
+material 0.500000 vertex vertex 0.500000 0.500000 vertex
+= anim bone
+anim 0.500000
+frame
+vertex frame
+1.0 texture =
+anim vertex vertex bone 0.500000
+anim anim bone
+0.500000 vertex frame ani
\ No newline at end of file
@@ -0,0 +1,12 @@
+bone 0.500000 1.0 frame = = texture
+bone material anim frame = texture = material bone
+texture 0.500000 =
+texture
+vertex = anim anim
+material frame
+1.0 =
+= = 1.0
+-1 frame
+texture =
+1.0 anim 1.0 texture anim bone 1.0 frame 1.0 vertex
+vertex frame
@@ -0,0 +1,3 @@
+frame 1.0 vertex -1 bone vertex anim vertex texture anim
+anim frame anim
+material bone
@@ -0,0 +1,3 @@
+frame 1.0 = vertex 1.0 material frame anim frame material
+-1 vertex
+vertex -1 
\ No newline at end of file
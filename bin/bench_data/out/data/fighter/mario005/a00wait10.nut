@@ -0,0 +1,149 @@
+0.500000 anim
+= anim 1.0 0.500000 texture bone material -1 =
+1.0
+texture bone 0.500000 material -1
+-1 texture
+material material
+0.500000
+0.500000 material material 0.500000 = bone 1.0 material frame frame
+material frame texture
+bone material = 1.0 frame anim vertex frame bone material texture material
+0.500000 vertex
+texture
+= =
+0.500000 1.0
+bone = anim = texture vertex vertex
+1.0 anim frame 0.500000 vertex vertex =
+bone texture -1 material anim
+bone vertex material
+texture
+= -1 anim = frame
+= = anim
+vertex = anim = vertex
+0.500000 frame
+-1
+0.500000 material anim material 0.500000
+frame material
+bone
+frame = frame 0.500000 frame 0.500000 anim anim vertex frame
+material 1.0 =
+-1 = vertex
+anim = 1.0 0.500000
+-1
+= vertex
+1.0 material texture material
+material texture vertex 0.500000
+= vertex
+bone
+bone vertex
+= 1.0 = vertex
+=
+1.0 -1
+material
+-1
+0.500000
+frame
+0.500000 0.500000 vertex 0.500000 1.0 frame texture material frame
+material
+= vertex material vertex bone 1.0 -1 material texture
+= -1 anim
+1.0 material texture texture
+anim bone
+frame bone =
+anim anim frame material
+= anim anim = anim material anim texture 0.500000 material anim 1.0 -1 1.0 = 0.500000 anim =
+frame 0.500000 1.0 bone vertex -1
+vertex -1 1.0
+vertex bone 0.500000 = = -1 0.500000 frame 0.500000 material frame -1 material
+-1 material
+vertex material =
+0.500000 = texture anim frame bone
+bone
+material
+material 0.500000 material
+= texture -1 0.500000 1.0 vertex
+-1 bone
+material texture 0.500000
+-1 frame -1 0.500000
+bone 1.0 vertex bone material
+= 1.0 0.500000
+=
+anim bone frame frame
+-1
+vertex bone
+1.0 = -1 texture material = 0.500000 texture anim -1
+1.0 anim 1.0 texture material 1.0 bone 1.0 -1 material vertex texture frame bone 1.0 material texture vertex 0.500000 material
+= vertex texture 1.0 = bone
+= 1.0
+vertex texture texture = 0.500000 -1 0.500000 vertex
+bone vertex anim
+texture = 0.500000 vertex 0.500000 bone material anim texture -1
+= = texture texture
+bone
+0.500000
+= anim texture vertex 1.0 0.500000
+anim
+= vertex
+material
+= anim anim -1 material
+1.0
+anim bone -1 1.0 bone bone
+0.500000 0.500000 bone material
+0.500000 frame frame vertex 1.0 anim frame texture texture bone
+vertex = 1.0
+bone frame 0.500000 0.500000
+anim
+material 0.500000
+-1 bone
+-1 -1 bone 1.0
+frame -1
+material
+0.500000
+anim bone = vertex material bone 0.500000 = vertex bone 0.500000
+bone = vertex
+frame anim =
+anim
+=
+-1 anim -1
+= vertex
+material 1.0 vertex texture
+vertex 0.500000 anim
+-1
+vertex
+0.500000 -1 frame vertex vertex frame material = texture
+vertex
+0.500000
+-1 texture
+1.0 1.0 1.0 bone bone -1 texture = 0.500000
+material 0.500000 1.0 texture = texture material
+0.500000
+frame anim texture -1 1.0 bone
+= frame = bone vertex 0.500000 material = vertex -1 =
+material
+-1 material frame -1 material 0.500000 anim
+material anim
+material
+= vertex material 1.0
+1.0 -1 -1 vertex
+1.0 frame anim anim material = frame
+bone
+1.0
+1.0 material
+-1 1.0 0.500000 texture
+= vertex bone frame vertex -1
+vertex
+-1 vertex
+material = material
+0.500000 material = = material = 0.500000 -1
+-1 texture material material texture
+0.500000 anim -1 1.0 -1
+bone texture -1 bone material 0.500000 anim 0.500000 anim material vertex anim 1.0
+vertex
+bone vertex 0.500000
+1.0 bone bone 1.0 0.500000 vertex
+0.500000 0.500000 bone = = anim frame 0.500000 1.0 1.0 vertex material bone frame 1.0
+0.500000
+bone = bone material 1.0 -1
+frame
+anim bone
+anim anim text
\ No newline at end of file
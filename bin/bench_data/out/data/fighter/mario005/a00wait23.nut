@@ -0,0 +1,285 @@
+texture -1
+=
+material texture anim -1
+1.0
+=
+anim 1.0 0.500000
+anim
+vertex 0.500000 bone 1.0 1.0 vertex frame material material anim -1
+1.0
+anim -1
+frame 1.0 -1
+1.0 texture texture
+= texture anim material material
+texture frame vertex 1.0
+0.500000 = 1.0 material 1.0 = -1 anim vertex material
+vertex
+texture material 0.500000 1.0
+frame
+1.0 vertex frame
+texture vertex
+texture
+1.0 0.500000 material material anim frame -1 1.0 material 1.0
+1.0
+1.0 bone
+frame frame -1
+-1 0.500000
+= -1 frame
+material 1.0 -1 frame texture vertex
+vertex 1.0 anim -1
+1.0
+-1 1.0 frame 1.0 material vertex anim -1 vertex frame 0.500000 frame anim anim texture 1.0 0.500000 0.500000 vertex texture texture vertex material
+vertex anim 1.0
+material texture material
+texture
+frame 1.0 frame 1.0 bone 1.0 vertex 1.0 anim material 0.500000 1.0 texture anim
+1.0 -1 = material anim -1
+0.500000
+bone
+0.500000
+-1 anim
+anim frame frame = 1.0 texture vertex =
+material -1 0.500000
+bone =
+1.0 bone frame 1.0 vertex texture
+1.0 vertex 0.500000 = -1 -1
+= anim 0.500000 frame frame
+texture frame vertex bone bone anim
+frame texture texture 1.0 -1 anim vertex anim
+anim bone
+0.500000 =
+frame anim anim =
+vertex bone
+bone -1 0.500000 material
+bone texture = material
+-1 anim anim
+bone 0.500000 vertex
+vertex =
+1.0 anim
+material
+vertex -1 vertex anim bone texture
+= texture frame texture
+1.0 material bone frame frame material frame
+0.500000 frame texture 0.500000 0.500000 1.0 frame -1 anim texture 0.500000 0.500000
+texture frame material texture
+frame
+anim -1 bone -1 0.500000
+bone frame material vertex -1
+=
+0.500000 = 0.500000 0.500000 texture anim
+texture anim =
+1.0
+material 0.500000
+=
+1.0 bone
+-1 texture frame bone
+texture
+0.500000 1.0 anim 1.0
+texture
+texture anim frame material anim = vertex
+0.500000 material frame
+texture texture texture vertex
+bone bone =
+bone
+bone -1 vertex 0.500000
+0.500000 texture 0.500000
+1.0 texture
+-1
+texture material
+frame
+material material
+anim 0.500000
+0.500000 material vertex 0.500000
+texture
+= 0.500000 texture -1 vertex frame anim material
+1.0 0.500000 1.0 -1 texture vertex vertex
+-1 0.500000 1.0 vertex material
+-1 texture vertex
+anim
+vertex
+anim
+-1
+vertex texture -1 bone bone
+vertex material anim
+anim
+1.0 vertex vertex material vertex anim texture bone
+anim
+1.0 texture vertex vertex -1 -1 vertex material 1.0 1.0
+-1 bone = bone frame 1.0
+material = -1
+0.500000 material
+= texture 0.500000 texture anim -1 texture -1
+material 0.500000 bone bone 0.500000 vertex 0.500000 material 1.0 material material texture frame frame -1 bone frame vertex anim bone 0.500000
+vertex vertex vertex
+0.500000
+vertex anim material
+-1 0.500000 texture = material texture -1 vertex bone
+anim vertex material 1.0
+frame anim
+vertex =
+0.500000 0.500000
+frame vertex anim material 1.0 texture 0.500000 texture texture bone -1
+0.500000 anim
+0.500000
+0.500000 bone frame bone anim 0.500000 vertex
+anim -1 frame -1 anim 0.500000 -1 bone
+-1 = texture texture frame frame bone texture
+vertex frame -1
+0.500000
+= texture
+vertex 1.0
+frame 0.500000 1.0 frame anim texture 0.500000 vertex 1.0 = frame frame material 1.0
+frame
+vertex 0.500000
+= 1.0 texture
+anim vertex bone 0.500000 0.500000 0.500000 1.0 anim 1.0 material vertex bone 1.0 texture frame bone
+anim bone material material vertex = material texture texture
+frame bone vertex bone bone -1 -1 1.0 0.500000
+bone anim frame
+vertex 1.0 bone 1.0 texture material
+material = anim -1 texture 1.0 -1 material bone anim anim vertex frame 1.0 1.0 texture = bone vertex 1.0
+vertex
+anim
+anim frame 1.0 vertex texture -1 -1 0.500000 = texture
+frame material bone
+texture texture material texture vertex vertex
+=
+anim
+0.500000 0.500000 = -1 = material vertex -1 frame vertex 1.0 material frame material frame 0.500000 texture = anim anim material anim
+bone frame
+anim texture -1 texture material 1.0 material -1 material
+vertex material
+bone
+frame frame anim 0.500000 frame 0.500000 1.0 anim texture = 1.0 -1 vertex
+vertex anim material
+bone texture
+-1
+= vertex =
+anim material
+= anim frame
+frame -1 1.0 texture frame -1
+texture 0.500000
+vertex vertex
+-1 frame -1 anim
+= 1.0
+1.0 anim material material vertex
+material
+frame -1 vertex 0.500000 = anim 0.500000 frame = anim -1
+-1 =
+0.500000 0.500000 = texture anim vertex frame
+= texture
+texture 1.0 material
+frame -1 vertex frame
+frame
+vertex
+0.500000
+vertex
+vertex frame material
+-1 1.0 frame 0.500000
+bone -1
+-1
+0.500000 anim texture 0.500000 vertex = frame frame 0.500000 frame
+anim
+frame
+= frame 0.500000
+texture texture
+-1 0.500000 bone frame vertex bone material
+-1
+frame material
+= bone
+-1 1.0 material 0.500000
+0.500000
+= bone texture =
+= anim 1.0 = texture
+= anim
+anim bone material -1
+material -1 1.0 bone material = 1.0 texture
+0.500000 vertex anim = texture bone anim
+texture frame anim bone material bone texture bone
+anim -1 vertex -1
+-1 bone
+-1 anim bone 0.500000 0.500000 = bone =
+texture
+-1 texture
+anim 0.500000
+-1 1.0 = 0.500000 bone
+texture = vertex
+vertex material -1
+material 0.500000 0.500000 1.0 frame
+= vertex
+bone bone 1.0 vertex -1 bone 0.500000 1.0 material material 1.0
+frame material
+-1 -1
+= texture
+material
+texture = -1 0.500000 bone frame -1 frame
+frame anim
+bone = frame frame texture frame
+bone
+vertex
+1.0 frame material vertex
+material -1
+1.0
+texture vertex
+anim anim 0.500000
+material texture material -1 bone
+-1
+frame bone
+texture texture material 1.0 texture 1.0
+bone bone vertex =
+bone
+texture 1.0 -1 = -1 0.500000 texture 1.0 material frame bone material
+frame
+bone
+vertex
+anim
+0.500000
+vertex anim material material =
+vertex anim texture
+vertex material 0.500000 -1
+1.0
+-1 = -1
+= = frame texture anim frame vertex -1 1.0 vertex texture anim texture
+bone vertex
+texture anim bone = bone frame = material
+bone anim vertex texture texture
+0.500000
+texture material
+-1 1.0
+= -1 -1 material texture vertex -1 vertex -1 bone texture vertex
+= = 1.0
+material =
+texture vertex 1.0
+bone 0.500000 bone texture frame material vertex
+material frame anim
+material 1.0 frame material 1.0
+anim bone
+frame
+0.500000 -1 = anim frame vertex
+-1 frame 1.0 0.500000 1.0
+0.500000 material 1.0 bone 1.0 1.0 -1
+material material
+texture material = vertex 0.500000 anim -1 bone = bone frame
+frame texture
+bone material texture bone 0.500000 bone = vertex 0.500000 vertex anim
+material texture = material = 1.0 bone 1.0 material material -1 -1 =
+material bone frame 0.500000 material 0.500000 -1 texture
+anim anim bone vertex
+-1 anim 1.0 material anim anim 1.0 0.500000 material
+0.500000 texture texture 1.0 vertex 1.0 frame frame anim 0.500000 bone 1.0
+-1
+anim
+bone frame
+1.0 bone 1.0 bone -1
+anim =
+material
+material vertex 1.0 -1 0.500000
+material
+= 1.0
+-1 -1 anim
+= -1 frame frame = bone vertex 1.0
+vertex
+anim 1.0 anim 0.500000
+anim 1.0
+anim 0.500000 = 1.0 anim vertex frame
+material texture -1 texture 
\ No newline at end of file
@@ -0,0 +1,3 @@
+=
+frame = = vertex 1.0 vertex -1 anim 0.500000 material
+1.0
\ No newline at end of file
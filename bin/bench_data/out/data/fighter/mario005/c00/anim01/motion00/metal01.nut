@@ -0,0 +1,30 @@
+bone =
+material
+vertex
+0.500000 -1
+frame -1
+vertex
+=
+material
+anim texture
+vertex 0.500000
+bone
+anim 1.0 frame vertex bone =
+texture bone
+bone vertex = vertex material
+anim anim vertex = 0.500000 1.0 -1 texture
+1.0
+bone bone = =
+bone 0.500000 0.500000 bone 1.0 -1 frame vertex -1 vertex anim -1 0.500000
+frame anim
+texture
+-1 0.500000 vertex
+vertex texture
+vertex 0.500000
+bone
+1.0
+frame frame = 1.0 bone =
+0.500000 texture 0.500000
+vertex = -1 anim vertex 0.500000 bone anim
+anim bone material texture 1.0 vertex texture vertex
+texture bon
\ No newline at end of file
@@ -0,0 +1,9 @@
+= -1 anim -1 anim vertex 0.500000 = bone bone bone = 0.500000 1.0 =
+material 1.0 anim texture -1 material texture material frame
+vertex anim bone bone = material anim material material material 0.500000 frame 0.500000
+bone
+=
+frame 1.0 texture
+= 1.0 1.0 material 0.500000
+-1 bone = material vertex vertex bone bone material frame
+b
\ No newline at end of file
@@ -0,0 +1,167 @@
+anim vertex frame texture material anim anim 1.0 frame -1
+-1 1.0 frame 0.500000
+material -1 texture anim vertex vertex material material bone 1.0 0.500000 bone = bone
+1.0 texture
+1.0
+= bone texture anim vertex texture vertex =
+vertex =
+bone
+frame vertex frame 0.500000 anim bone texture frame texture
+-1 material = material material frame
+anim -1 = frame -1 frame
+texture material
+= bone bone anim anim anim
+frame
+material -1 texture 1.0 bone 1.0 -1 texture frame 0.500000 anim texture
+vertex bone texture = -1 1.0 texture texture anim vertex -1 vertex texture frame vertex vertex
+0.500000
+texture frame vertex = 0.500000 texture anim vertex frame
+frame
+= texture = = 1.0
+texture frame
+frame
+= -1 1.0 =
+material vertex = frame
+material 1.0 = bone
+vertex 0.500000 frame anim 1.0 1.0 bone
+1.0 anim
+vertex
+= material 0.500000 material bone
+anim
+material material 0.500000 anim
+material anim frame
+material 0.500000
+-1
+vertex
+frame
+vertex
+= anim vertex
+texture = texture texture = =
+frame
+bone vertex material vertex bone
+vertex 0.500000
+texture vertex material
+=
+bone -1 bone frame texture 1.0 anim -1 anim vertex 1.0 texture 1.0 -1 1.0 1.0 -1 frame vertex =
+vertex
+= anim
+1.0
+bone material
+frame texture = frame 1.0 1.0
+-1
+texture anim = vertex vertex 0.500000 material frame anim = texture frame bone -1 vertex 1.0 0.500000 1.0 0.500000 material
+frame
+vertex vertex
+-1
+texture
+material
+frame texture
+frame = frame
+= material frame texture material texture =
+texture anim frame bone -1 frame
+anim bone bone material -1
+1.0 frame
+anim = -1 =
+-1 vertex -1 frame vertex
+bone
+0.500000 vertex = vertex
+vertex texture anim material bone 0.500000 material vertex
+-1 -1
+material
+0.500000 bone
+material texture bone material
+0.500000
+bone
+texture
+=
+0.500000 frame 0.500000
+frame
+= = 0.500000 material frame = texture texture = -1 vertex anim = material bone
+-1 texture anim frame anim
+frame = anim 0.500000 -1
+1.0 bone -1 anim 1.0 0.500000 vertex
+bone
+0.500000 frame
+1.0 = vertex = = = -1 frame anim texture texture
+-1
+vertex vertex
+frame vertex frame
+= =
+bone 0.500000
+frame vertex = material 1.0
+frame material -1 0.500000
+material texture
+= -1 vertex vertex anim bone material frame -1 0.500000 = 0.500000
+0.500000 texture frame 1.0 frame =
+material vertex -1
+bone
+-1 material texture
+anim 0.500000
+0.500000 -1 frame frame vertex 1.0
+vertex
+0.500000 1.0 1.0 vertex
+frame
+1.0
+-1 material frame =
+= material
+= bone -1 1.0 -1 anim vertex texture anim
+0.500000 = bone -1 -1 frame bone 0.500000 anim = material
+0.500000
+frame = -1 anim
+frame 1.0 bone 0.500000 = frame 1.0
+anim frame frame = frame anim vertex bone -1 = material
+vertex material 1.0
+vertex bone
+-1 texture material texture =
+-1 bone
+1.0 bone anim = 0.500000 material vertex anim
+-1 -1 material -1 vertex anim frame 0.500000 anim frame
+texture = = material vertex -1
+0.500000 anim texture 1.0 1.0
+frame 1.0 texture material = vertex
+vertex texture
+0.500000 material -1
+bone frame
+bone anim
+frame = bone material frame -1 =
+bone vertex anim
+bone
+anim bone 1.0 0.500000 bone texture 1.0 bone bone -1
+= material vertex frame texture bone bone 0.500000
+-1 bone = = =
+anim material anim material
+texture
+= anim = -1 -1
+0.500000 texture anim vertex anim bone -1 = texture frame 0.500000 0.500000 texture texture anim anim material anim -1
+0.500000 = frame bone bone 1.0 -1 texture = = vertex
+= 1.0 0.500000 -1
+1.0 frame
+=
+0.500000 bone 0.500000
+vertex = anim texture texture material anim anim
+bone anim
+material
+0.500000
+material frame =
+texture frame
+0.500000 -1
+anim -1 texture bone frame -1 frame anim
+frame 0.500000
+vertex vertex bone anim
+vertex anim
+bone
+anim bone texture
+anim 1.0 material texture texture anim texture 0.500000
+-1 frame -1 anim bone frame anim anim material
+frame anim -1 material
+= material texture bone -1 frame material 1.0 = -1
+anim bone
+vertex anim texture
+texture material 1.0
+texture frame = =
+vertex material
+vertex
+1.0 texture frame
+-1 -1 -1 =
+= anim anim vertex
+0.500000 0.50000
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 bone
+material frame
+material
+bone -1 vertex -1 0.500000 1.0 materia
\ No newline at end of file
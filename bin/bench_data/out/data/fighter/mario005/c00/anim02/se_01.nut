@@ -0,0 +1,50 @@
+anim
+bone 1.0 texture material frame frame frame
+frame
+texture material texture
+vertex
+vertex anim
+texture = anim
+0.500000
+-1 -1 0.500000 bone bone = -1 1.0 vertex anim anim vertex anim
+material texture =
+texture
+anim frame -1
+1.0 bone 1.0 =
+1.0
+-1 frame frame vertex =
+1.0 -1 anim texture -1 -1
+frame anim
+texture -1 vertex
+1.0 0.500000 material
+bone -1 = material
+anim material
+texture
+1.0
+-1 = frame -1 = 1.0 -1 0.500000 texture material bone 1.0
+0.500000 = vertex
+1.0 anim
+= texture = =
+= frame frame frame frame frame
+texture
+material texture 0.500000 texture material = 1.0
+1.0 material material vertex frame anim vertex material vertex
+= bone =
+frame
+texture
+frame -1 0.500000 1.0 1.0 -1 0.500000 vertex 0.500000 frame
+frame
+0.500000
+texture frame
+1.0
+material frame texture 0.500000
+= -1 =
+texture frame vertex = bone anim frame bone 1.0 1.0 vertex frame frame texture
+= vertex frame
+material 1.0 bone 1.0 bone 0.500000
+= frame vertex
+= 1.0
+anim vertex material
+texture
+material -1
+-1 1.0 vertex frame 1.
\ No newline at end of file
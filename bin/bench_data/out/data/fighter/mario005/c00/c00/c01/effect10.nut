@@ -0,0 +1,5 @@
+anim 0.500000
+0.500000
+0.500000
+0.500000 1.0 material vertex texture
+f
\ No newline at end of file
@@ -0,0 +1,110 @@
+texture frame
+=
+bone texture bone
+material texture -1 1.0 1.0
+anim anim
+anim 0.500000
+-1 vertex bone frame anim bone bone material = bone bone = -1 frame bone bone frame frame -1 = 1.0 frame frame 0.500000 1.0
+=
+1.0
+material bone
+-1 frame -1 anim bone
+-1 = 1.0 bone anim
+-1 1.0 anim
+bone 1.0 -1
+material -1 frame bone vertex texture -1
+1.0 =
+material anim anim =
+-1 = =
+0.500000
+-1
+1.0 material
+1.0 bone anim material -1 material vertex 0.500000 bone
+material anim
+-1
+texture material material bone bone frame -1 material -1
+texture vertex material
+texture
+texture
+= -1 material =
+=
+bone 0.500000 frame = anim anim texture 1.0 frame bone texture 0.500000 =
+bone = texture anim
+0.500000 = = anim anim anim frame -1 texture material texture
+1.0 1.0 -1
+0.500000 -1
+1.0
+bone frame
+-1
+vertex bone = frame
+vertex = anim 1.0 vertex bone
+material bone
+0.500000 = frame bone vertex vertex frame material = bone 0.500000 = frame
+frame
+anim vertex
+0.500000 vertex -1
+= vertex
+material anim texture anim 0.500000 vertex material anim
+-1 bone 1.0 0.500000
+material texture 0.500000
+0.500000 -1 texture bone
+frame
+frame = -1 1.0 = frame bone texture anim frame
+0.500000
+frame bone
+anim frame -1 texture frame =
+material anim = 1.0 -1 anim
+anim anim
+= material 1.0 texture 0.500000 = frame
+texture
+= texture = vertex 0.500000 frame
+1.0 -1 1.0
+material = bone =
+texture material bone
+material material vertex bone 1.0 = texture 1.0 material 0.500000 texture
+vertex vertex = material bone -1 texture
+texture texture -1 0.500000 =
+1.0 =
+= = bone texture frame texture
+0.500000 anim
+anim frame
+bone bone anim texture texture bone 1.0 anim 1.0 material frame
+vertex = anim frame vertex = -1 texture -1 frame 1.0
+1.0 frame frame
+1.0 vertex
+frame frame = texture material
+= =
+frame
+1.0 1.0 vertex 0.500000 vertex material frame =
+frame frame anim anim frame 0.500000
+=
+bone
+1.0 frame = material
+anim texture anim anim texture vertex 1.0 -1
+bone 1.0 texture vertex =
+-1 0.500000
+anim vertex texture vertex 0.500000 bone anim =
+vertex vertex
+vertex
+-1 -1 material
+material frame = -1 1.0 0.500000 frame 1.0 material
+vertex 0.500000 frame material texture texture
+1.0 vertex -1 texture vertex
+anim
+anim bone = bone
+vertex material
+frame 0.500000 material
+bone 0.500000
+= 1.0
+-1 material frame texture -1
+0.500000 vertex
+0.500000
+anim bone material anim 1.0 1.0 bone = material vertex texture
+bone 0.500000
+= bone = vertex
+texture
+frame -1 texture bone frame
+frame texture
+anim vertex anim -1 texture vertex anim frame 0.500000 = texture frame material
+material
+tex
\ No newline at end of file
@@ -0,0 +1,158 @@
+anim
+bone
+0.500000 anim
+material material 1.0
+material anim texture
+1.0
+material 0.500000 -1 = bone material
+=
+vertex -1 frame vertex
+frame texture = texture -1 texture
+= anim 1.0
+bone
+frame bone
+bone bone bone material bone
+vertex = texture
+= frame
+material texture -1 1.0 bone vertex
+anim 1.0 texture anim
+bone -1 =
+= frame frame 1.0 anim = material 1.0 anim vertex vertex
+texture 0.500000 material bone =
+0.500000 0.500000
+anim anim -1
+frame -1 frame texture 1.0 frame
+anim 0.500000
+0.500000
+-1 anim -1 = 0.500000 -1 anim frame frame
+material
+=
+frame frame 0.500000
+1.0
+0.500000 texture anim vertex material
+frame = material anim
+material material 0.500000 bone
+texture
+0.500000 anim vertex
+0.500000 0.500000
+=
+vertex 1.0 anim
+vertex =
+vertex
+material
+texture frame
+0.500000 0.500000 material
+1.0
+frame 0.500000
+-1
+-1
+-1 texture 0.500000 texture 1.0
+= vertex frame material 0.500000 vertex = frame 1.0
+0.500000 =
+frame -1 vertex frame
+0.500000
+-1 texture anim vertex
+anim -1 1.0 = 0.500000 frame
+texture
+bone material = = anim texture texture bone
+material =
+texture
+vertex texture bone
+-1
+bone -1 material texture
+= texture 0.500000
+= frame vertex frame -1 bone frame = 1.0 0.500000 bone -1
+texture
+0.500000 vertex
+0.500000 -1 frame 0.500000 0.500000 material
+anim
+material 1.0 0.500000 frame frame vertex -1 frame texture texture = -1 texture bone material 1.0 texture = bone bone material
+1.0 bone 1.0 anim anim -1 = = 1.0
+anim
+0.500000 vertex vertex 1.0 0.500000 0.500000 1.0 1.0
+1.0
+bone bone frame
+-1 frame 1.0 frame -1 anim material -1
+-1
+frame
+texture frame = texture 1.0 = texture anim 0.500000 texture
+material -1
+bone frame 0.500000
+bone frame frame
+material anim material frame
+-1 frame anim
+=
+anim 1.0
+= 0.500000 0.500000 1.0 0.500000 0.500000
+0.500000 0.500000 vertex 1.0
+1.0 material frame bone frame material
+= -1 vertex = texture
+-1 = 0.500000 texture = vertex texture
+anim 0.500000 frame 1.0
+bone texture 1.0
+= 0.500000 bone
+anim
+frame anim 1.0 vertex 0.500000 = bone
+frame 0.500000
+1.0 = vertex -1
+texture vertex 1.0 bone
+0.500000 bone bone
+frame anim -1 =
+bone texture
+frame anim material
+material vertex
+0.500000 vertex bone -1 texture
+material vertex anim
+material vertex
+anim vertex
+vertex = -1 anim vertex anim
+anim frame vertex
+material
+vertex texture 0.500000
+frame
+1.0 bone vertex frame
+0.500000 0.500000 anim =
+material = 1.0 texture material
+1.0 -1 1.0 0.500000 texture
+texture vertex = anim
+1.0 anim texture = texture frame
+texture texture
+= -1
+anim
+bone 0.500000
+bone
+bone frame frame -1 1.0 -1 anim texture
+anim anim anim texture vertex = = 0.500000 anim frame material
+bone frame material frame 1.0 material frame
+=
+= 1.0
+frame
+0.500000 anim vertex 0.500000
+frame vertex = vertex frame
+material = material 1.0 anim texture 1.0 texture bone frame
+material
+texture
+material -1 -1
+1.0 frame 1.0 bone
+vertex -1 frame 1.0
+bone vertex frame
+vertex texture
+bone frame vertex
+vertex
+frame
+frame -1 = = 1.0 0.500000 = -1 vertex
+texture texture vertex -1 material
+0.500000 bone texture 1.0
+1.0 0.500000 texture -1 0.500000 anim
+= texture =
+material
+0.500000 = anim bone = texture material = texture = 0.500000 texture -1
+vertex
+-1 anim material
+texture texture 0.500000 texture
+0.500000
+-1 = anim = bone texture
+frame = -1 bone
+anim anim
+1.0 anim texture material
+-1 = = frame bone 0.500000 0.500000 bone bone vertex -1 frame 0.500000 0.500000 texture material 0.500000 bone = mater
\ No newline at end of file
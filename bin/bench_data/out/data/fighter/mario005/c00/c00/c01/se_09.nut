@@ -0,0 +1,3 @@
+vertex anim 0.500000
+-1 anim
+0.500000 material -1
\ No newline at end of file
@@ -0,0 +1,305 @@
+=
+-1 frame frame frame 0.500000 vertex frame material material texture bone texture 0.500000 bone -1 -1 texture material 0.500000 1.0 -1
+anim anim 0.500000 vertex 1.0
+vertex 0.500000 0.500000
+texture
+material -1 frame frame anim anim
+0.500000 bone material 1.0
+frame 0.500000 vertex
+anim
+1.0 texture
+bone bone
+texture 1.0 vertex bone
+frame -1 anim
+bone texture -1
+frame -1 0.500000
+1.0
+0.500000 -1 anim 0.500000 bone 0.500000 anim frame -1 -1 frame
+1.0 anim texture texture
+1.0 frame vertex texture -1 = bone
+-1 vertex -1 frame
+anim
+material 0.500000 =
+texture vertex 1.0 0.500000 anim material
+= texture vertex
+bone anim = -1 frame vertex material = -1 texture bone =
+0.500000
+vertex
+= material
+vertex material material = bone frame
+anim frame
+frame
+0.500000 = frame -1 =
+texture frame 0.500000 texture texture
+= texture = texture material material bone -1
+frame vertex
+texture
+anim bone 1.0 material frame 1.0
+bone material material -1 texture material material 1.0 1.0 texture -1
+= frame bone anim
+vertex = 1.0
+bone
+texture -1 1.0 0.500000
+0.500000
+=
+= bone 1.0
+bone 1.0 vertex
+bone texture 0.500000 frame bone texture vertex material
+bone vertex
+1.0 material texture bone -1 1.0 1.0 0.500000 0.500000 bone vertex vertex anim
+frame bone vertex material material -1 material = 0.500000
+material 1.0
+=
+-1 material
+frame 0.500000 bone
+-1 material bone
+texture material
+1.0 1.0
+-1 vertex
+1.0 texture vertex material vertex vertex bone 0.500000 vertex anim bone frame = frame
+material 1.0 material
+texture
+0.500000 anim material anim -1 -1 = 0.500000
+vertex 0.500000 =
+frame
+1.0 anim bone 1.0 vertex = material
+frame texture vertex frame -1
+bone 1.0
+1.0
+bone -1 frame
+-1 frame 0.500000 anim 0.500000
+bone
+-1 = frame anim -1 anim anim
+bone bone frame texture frame
+0.500000 1.0 texture
+-1
+anim
+anim vertex texture bone frame anim vertex
+-1 vertex
+frame 0.500000
+texture -1 0.500000
+frame bone
+frame 0.500000 = vertex -1 material 1.0 0.500000 material texture material
+-1
+anim 0.500000 = texture
+0.500000
+frame
+vertex
+frame
+texture vertex vertex
+vertex frame
+frame material bone vertex 1.0 material frame frame texture -1
+1.0 bone
+= anim
+anim = anim anim
+1.0 0.500000 0.500000
+-1 = = bone anim material frame material
+= 0.500000 material -1 1.0 0.500000 bone anim 1.0 -1 0.500000 texture bone 1.0 material bone material
+= 1.0 1.0 frame vertex material texture texture material bone 0.500000 1.0 frame texture
+anim
+-1 0.500000 frame
+=
+-1
+anim texture anim
+0.500000 0.500000 frame
+texture =
+vertex frame
+material 0.500000 0.500000
+0.500000 = texture frame
+0.500000
+vertex
+texture 0.500000 material
+-1
+0.500000
+0.500000 -1 frame
+= -1 1.0
+bone 1.0 0.500000 = frame 0.500000
+anim bone 0.500000
+texture 0.500000 material
+1.0
+vertex 1.0 1.0
+texture
+0.500000 texture =
+1.0 -1 vertex anim bone vertex 0.500000 = 1.0 material
+frame texture material -1 frame -1
+1.0 = material anim bone 1.0
+= 1.0 anim
+bone -1 texture frame
+material
+vertex texture 0.500000 material 1.0 0.500000 material texture material material = bone texture bone
+frame
+texture
+bone bone = material bone texture
+material = bone anim material
+frame 1.0
+anim material 1.0 1.0 = material = material = texture texture
+vertex
+vertex texture
+= vertex texture bone -1 material frame 0.500000 bone frame frame
+frame frame
+0.500000 vertex texture
+bone 0.500000 material frame
+-1
+bone
+frame 1.0 vertex
+1.0 0.500000 = anim material texture 0.500000
+bone 0.500000 anim material 1.0 frame bone -1 material bone material bone = = anim
+bone
+material 1.0 0.500000
+bone frame
+vertex
+anim 0.500000 vertex 1.0 bone vertex texture -1 1.0
+=
+material texture
+0.500000 texture
+material 0.500000
+0.500000 frame = texture material bone material frame anim frame
+bone = = 1.0 bone 0.500000 = -1 bone anim frame
+= anim bone frame frame 1.0 = frame = frame 1.0 -1 texture
+= bone = material
+texture texture texture
+texture
+0.500000 1.0
+vertex texture material = -1 material
+vertex
+=
+anim
+material
+bone -1
+material vertex
+= -1 =
+vertex
+0.500000 0.500000
+texture bone frame frame frame frame texture
+1.0
+anim 0.500000 = anim vertex vertex material bone
+frame vertex 1.0
+texture 0.500000 anim texture bone texture -1
+0.500000
+bone frame
+1.0 =
+frame anim -1 vertex
+-1 texture texture
+= 0.500000
+0.500000 texture = = vertex frame
+bone -1 1.0 = vertex
+1.0
+1.0 1.0 = bone vertex
+texture
+1.0 frame vertex = frame frame 1.0 = 0.500000
+vertex
+texture bone -1 = vertex anim 0.500000 anim frame anim
+-1 texture anim
+0.500000
+0.500000 material 1.0
+0.500000 anim 0.500000 frame 1.0 1.0
+texture =
+= 0.500000 -1 = 1.0 = frame = bone 1.0 -1
+vertex frame material texture 1.0
+vertex
+1.0 vertex vertex anim
+material anim frame bone
+material
+bone texture =
+vertex 0.500000 texture material
+bone texture anim bone 1.0 bone anim -1 = frame texture 1.0
+anim bone -1 vertex -1 anim
+1.0 material
+bone bone bone material anim vertex
+vertex
+material 1.0 anim
+vertex 0.500000
+anim anim
+texture anim
+texture 1.0 1.0 texture = -1 anim -1
+texture -1 0.500000 anim -1 0.500000 -1
+frame vertex vertex bone -1 texture vertex = frame vertex -1 -1 vertex texture
+vertex -1 vertex bone
+bone
+frame vertex -1 -1 frame frame texture -1 vertex
+1.0 material material texture anim material -1 0.500000 frame -1 material 1.0 1.0 1.0 material material material
+texture
+texture 1.0
+material
+anim = 1.0 frame vertex material -1
+material frame texture material
+-1
+frame 1.0 bone texture anim
+vertex vertex -1 =
+material material 1.0 = = anim 1.0 1.0 -1 material =
+bone bone -1 0.500000 0.500000 bone vertex 1.0 anim vertex = 0.500000 material bone =
+material -1 0.500000
+material
+texture 0.500000 material texture
+1.0 anim
+vertex
+0.500000
+anim material material 0.500000 material = vertex material 0.500000 material bone -1 texture
+1.0
+texture vertex
+-1 material vertex frame bone vertex 0.500000 texture bone vertex material anim material bone texture frame
+frame frame
+material
+bone 1.0 texture material
+-1 = 1.0
+0.500000 bone frame texture
+bone anim =
+material bone vertex frame =
+vertex bone -1 anim =
+frame
+1.0
+material -1 texture
+bone
+1.0 frame anim
+bone material texture
+texture 1.0 -1
+= material texture
+= material material
+0.500000
+1.0 1.0 1.0 material bone texture = frame vertex -1 0.500000 vertex bone
+vertex = vertex
+-1 = frame
+anim anim
+= vertex material anim texture
+material frame =
+material
+frame = anim vertex -1 material -1 bone -1 texture = bone texture -1 material bone anim = texture 0.500000
+-1 texture -1 = =
+0.500000 material bone
+frame frame vertex 1.0 texture = 1.0 vertex vertex texture frame anim 0.500000 material -1
+0.500000 texture material texture material
+vertex
+1.0
+1.0 1.0 0.500000 1.0 1.0 bone vertex = vertex vertex 0.500000 material frame = frame = texture material anim
+frame anim 0.500000 0.500000 material
+vertex
+anim vertex frame anim
+frame 1.0 anim texture anim
+vertex
+1.0 vertex 1.0 0.500000
+texture 1.0 material
+= material anim
+-1 anim = frame
+bone material frame 1.0 texture vertex bone 0.500000 bone vertex bone = 0.500000
+frame anim
+= 1.0 material 1.0 0.500000 vertex 0.500000 frame
+frame material bone anim
+0.500000 material
+-1 0.500000
+bone material texture 1.0 material
+material frame
+texture
+material 1.0 material texture = frame -1
+vertex frame 1.0
+vertex
+= texture -1
+bone =
+1.0 vertex
+-1 frame
+texture -1 -1 0.500000 material frame vertex
+vertex 0.500000 anim frame texture frame -1
+1.0 bone -1 bone -1 anim
+= anim -1 1.0 0.500000
+vertex bone
+1.0 frame 1.0 anim 1.0
+0.50000
\ No newline at end of file
@@ -0,0 +1,10 @@
+bone
+= 1.0 =
+1.0
+material anim frame material = = 0.500000 vertex -1
+frame
+material anim
+texture
+-1 bone 1.0 material 0.500000 bone anim material frame 1.0 vertex texture = vertex anim anim bone frame texture = = = -1 anim -1 bone -1 material 0.500000 texture
+anim texture
+material anim 1.0
\ No newline at end of file
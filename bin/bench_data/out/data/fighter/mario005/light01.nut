@@ -0,0 +1,5 @@
+frame 0.500000
+anim -1 texture texture
+0.500000
+1.0
+1.0 f
\ No newline at end of file
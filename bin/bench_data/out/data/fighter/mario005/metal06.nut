@@ -0,0 +1,8 @@
+anim texture material
+0.500000 = bone bone
+material 0.500000 -1 vertex
+vertex
+frame anim texture vertex -1 1.0 texture
+texture -1 anim -1 anim anim frame 0.500000 0.500000 = texture frame material frame 1.0 frame 1.0 1.0 1.0 -1 vertex vertex -1
+bone material bone 1.0 texture vertex anim bone texture
+verte
\ No newline at end of file
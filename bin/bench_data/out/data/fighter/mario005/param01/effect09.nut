@@ -0,0 +1,2 @@
+vertex
+bone material 0.500000 1.0 texture frame 0.500000 -1 vertex anim fra
\ No newline at end of file
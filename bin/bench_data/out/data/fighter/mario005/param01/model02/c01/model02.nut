@@ -0,0 +1,78 @@
+= -1 0.500000 -1
+1.0
+1.0 bone
+-1
+anim -1 = vertex = anim
+texture bone frame -1 vertex anim 1.0
+material 1.0 = 0.500000 anim frame bone 1.0
+material 0.500000 1.0 bone = vertex material vertex anim = anim
+1.0 vertex texture frame
+-1 1.0 frame
+texture 0.500000 0.500000 1.0 texture bone vertex frame
+material vertex 0.500000
+vertex anim material
+bone anim frame 0.500000 0.500000 vertex 1.0
+0.500000 1.0
+vertex = material 0.500000 frame 0.500000 texture
+frame 0.500000 anim 1.0
+anim 0.500000 = texture -1
+0.500000 0.500000 -1 1.0 =
+0.500000 anim = = material = =
+1.0 bone
+bone anim texture frame anim 0.500000
+0.500000 anim 0.500000 vertex 1.0 -1 frame
+-1 anim vertex
+anim vertex material -1
+frame
+vertex -1 anim texture
+anim -1 0.500000 material = = anim vertex texture vertex anim anim vertex -1 vertex = material =
+anim 0.500000 bone anim
+anim 1.0
+anim
+0.500000
+frame = material = 1.0 1.0 frame texture
+frame material material vertex 0.500000 = anim
+= material 1.0
+anim bone
+bone 0.500000 vertex -1
+anim texture
+bone
+1.0
+= bone =
+vertex texture bone 0.500000 -1 anim anim vertex 1.0 vertex anim texture
+anim 0.500000 -1 0.500000 -1 -1 1.0 vertex texture
+material -1 = frame 1.0 -1 bone bone
+material
+0.500000 texture frame
+vertex vertex texture
+anim
+bone frame 0.500000 -1 frame material = -1 bone material 1.0 frame material = =
+vertex -1 anim anim
+material -1 bone
+bone -1 =
+material
+anim anim = vertex texture -1 1.0
+0.500000 bone vertex 1.0 =
+bone bone anim -1
+1.0 = = = = = texture
+bone 1.0
+anim
+material
+1.0 1.0 texture material texture
+bone
+bone 1.0 vertex
+= -1 anim
+-1 frame
+frame = bone -1 frame -1 frame 0.500000 material -1 1.0 bone frame anim
+bone texture bone -1
+frame 1.0 bone -1 -1 vertex 1.0 vertex = = anim frame = 1.0 frame
+anim texture
+= = 0.500000 anim texture 0.500000 -1 frame
+frame vertex 1.0
+vertex material bone 1.0 vertex bone frame frame texture
+1.0 1.0
+0.500000 vertex -1 frame
+frame 1.0 -1
+-1 texture bone 1.0 material
+vertex 0.500000 anim vertex -1
+= texture texture 0.5000
\ No newline at end of file
@@ -0,0 +1,6 @@
+= 0.500000 1.0 vertex material anim bone vertex 1.0
+vertex frame texture 0.500000 0.500000 -1 0.500000 material anim
+frame
+texture -1 anim
+bone
+vertex vert
\ No newline at end of file
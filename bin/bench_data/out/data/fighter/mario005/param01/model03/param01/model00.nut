@@ -0,0 +1,4 @@
+frame -1
+frame
+0.500000 anim 1.0 bone =
+1.0 = anim = f
\ No newline at end of file
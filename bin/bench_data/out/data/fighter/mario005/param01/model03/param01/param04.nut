@@ -0,0 +1,268 @@
+frame vertex
+anim
+frame -1
+texture bone = vertex bone material frame = texture
+0.500000
+-1 bone material vertex =
+= texture bone
+frame anim -1 texture -1
+1.0 frame
+frame
+vertex material bone anim
+anim 1.0 texture texture bone 0.500000
+0.500000 1.0 bone
+0.500000 0.500000 bone frame frame -1 frame 1.0 bone -1 vertex
+= 0.500000
+bone =
+0.500000
+anim vertex frame texture
+anim material
+1.0 material
+0.500000 anim bone anim frame material anim
+=
+material texture = frame
+vertex 1.0
+texture -1 bone 0.500000 texture anim
+0.500000
+-1
+1.0 bone bone 0.500000 bone vertex texture
+frame bone anim
+vertex = texture = =
+0.500000 frame
+1.0 frame = -1 -1
+texture -1
+texture material 0.500000 texture material 1.0 bone
+vertex vertex frame texture material
+bone frame texture -1 0.500000 anim
+1.0 texture material = -1 1.0 anim material vertex anim texture = material 1.0
+bone anim material texture =
+material -1 texture anim material vertex frame -1
+0.500000
+frame 0.500000
+= 1.0 = frame
+anim 1.0 1.0 frame
+vertex material
+frame material material
+-1 vertex
+= -1 vertex -1 vertex =
+texture
+material material bone 1.0 = bone material anim 1.0 texture material
+0.500000 texture 0.500000 texture
+bone anim
+= =
+bone -1 =
+frame
+-1 anim 0.500000 bone frame = texture -1 bone texture bone bone -1 texture = frame
+frame = material vertex
+anim vertex
+frame = bone vertex = 1.0 -1
+vertex vertex texture
+-1 0.500000 texture
+1.0 frame = frame texture material frame 0.500000
+bone anim = material
+texture = texture material texture
+anim bone texture
+frame
+material 1.0 texture texture 1.0 bone anim bone -1
+frame -1 0.500000 = frame frame bone bone anim bone material 1.0
+0.500000 bone
+0.500000 0.500000
+1.0
+material bone
+bone 1.0
+1.0 vertex
+frame 1.0 1.0 1.0 bone material 1.0 = texture 0.500000
+vertex vertex 1.0 =
+frame texture anim 1.0
+frame texture 1.0 = texture anim anim -1 texture -1 vertex frame material texture = bone 1.0 vertex anim
+1.0 frame texture
+anim texture = 0.500000 anim frame
+frame material
+0.500000 bone -1 0.500000 bone frame
+0.500000 texture bone 1.0 0.500000
+frame 1.0 = 0.500000 = = anim = anim material vertex 0.500000
+bone 1.0 anim
+= material
+material vertex vertex 1.0
+frame = bone texture -1
+-1 frame -1
+texture frame anim 1.0 anim material bone vertex 0.500000
+0.500000 vertex material material texture -1 anim vertex vertex
+bone material
+anim frame
+texture 1.0 0.500000 bone 1.0 frame 0.500000 anim 1.0 1.0 texture 0.500000 1.0 1.0 0.500000
+anim
+frame material material
+bone
+anim -1 bone frame anim
+anim -1 1.0 bone =
+texture texture material material vertex material = vertex bone bone
+anim 1.0
+0.500000
+-1 material anim material -1 bone
+1.0 0.500000 1.0 0.500000 anim frame
+= -1 material
+bone bone
+anim -1 texture frame texture anim
+0.500000 1.0
+= bone 0.500000 0.500000 0.500000 frame bone 1.0 -1 1.0 frame bone
+vertex texture vertex -1 frame -1
+anim 0.500000 1.0 1.0
+texture
+material
+anim = vertex
+anim -1 frame vertex
+-1
+bone
+frame = texture
+-1 1.0 frame vertex anim -1 =
+1.0
+=
+material 1.0 texture texture texture vertex vertex texture
+texture anim bone material vertex frame vertex frame -1 material
+1.0
+vertex
+anim texture
+anim vertex = anim texture
+texture 0.500000
+vertex anim
+frame texture 1.0
+-1 -1 frame -1 anim = anim 0.500000 0.500000 texture = 1.0
+texture 0.500000 bone 1.0 texture
+texture frame -1 0.500000 -1 texture 1.0 material = 1.0 vertex frame =
+material material
+texture
+-1
+-1 1.0 vertex -1 0.500000 = 0.500000 texture material = 1.0
+=
+texture bone = frame anim vertex 1.0 frame
+material bone
+=
+frame material
+anim vertex 1.0 vertex 1.0 bone = bone vertex
+=
+0.500000
+frame bone texture
+frame material material
+0.500000
+= -1 bone 0.500000 frame -1 material
+= material vertex
+vertex
+0.500000
+0.500000 anim
+1.0 bone
+= -1 =
+bone material
+bone
+frame 1.0
+bone vertex vertex
+= material = anim material
+0.500000
+-1
+-1
+-1
+bone vertex 1.0 vertex material material
+texture frame texture 1.0
+anim bone 1.0
+bone vertex -1
+bone anim frame = material bone texture
+bone frame bone
+frame 0.500000 vertex bone vertex 0.500000 1.0 anim frame bone material 0.500000 vertex 1.0 vertex -1
+frame
+1.0
+-1 texture -1 anim =
+-1 1.0 vertex bone texture
+bone -1 texture anim texture
+-1
+vertex
+anim bone -1
+0.500000 vertex frame bone frame bone material
+= =
+vertex texture
+material material -1 bone 1.0 texture material
+1.0
+vertex bone
+material = vertex anim vertex bone 0.500000 -1
+= 0.500000 texture = vertex 0.500000 material -1 = 0.500000 0.500000 bone
+0.500000 vertex vertex material anim bone 1.0 -1 bone frame
+texture texture material
+material 1.0 material
+= 1.0 material material vertex
+frame material
+bone
+-1 1.0
+1.0 0.500000 1.0 0.500000 1.0 anim vertex frame material bone texture
+0.500000 anim
+bone
+texture 0.500000 anim 0.500000 texture texture = texture -1 1.0 1.0
+1.0 texture = bone 1.0
+anim -1
+1.0 vertex 1.0 anim texture vertex
+anim
+0.500000
+frame = -1 frame
+material bone -1 frame frame = = 1.0
+anim bone -1 vertex anim
+material frame frame material
+bone material
+material = = = 1.0 material = anim 1.0 anim
+texture frame vertex texture vertex bone frame vertex bone = -1 texture texture =
+anim -1 1.0 anim
+frame
+texture frame frame texture anim 1.0 material 1.0 anim vertex 0.500000 -1 = anim = material
+= bone material frame vertex material anim
+frame 0.500000 frame
+0.500000 frame
+0.500000 vertex texture
+0.500000
+= vertex
+vertex 0.500000
+bone vertex texture vertex
+vertex anim vertex material vertex anim
+vertex vertex texture 0.500000
+anim vertex texture = frame
+texture
+frame
+material bone
+frame
+-1 material
+= 0.500000 frame texture frame texture bone
+texture
+vertex texture texture = material frame = vertex =
+frame
+1.0 texture
+1.0
+vertex material =
+anim = -1 texture 0.500000 vertex = -1 1.0 0.500000 material
+texture anim frame
+vertex material anim
+-1 bone
+0.500000 bone vertex vertex
+0.500000 vertex = vertex anim vertex
+vertex vertex anim material vertex bone -1 0.500000 material
+1.0 material vertex material = 1.0 material vertex
+0.500000
+material
+=
+vertex anim
+frame
+frame 0.500000
+vertex 0.500000
+material
+0.500000
+texture bone
+vertex frame anim
+bone 0.500000 0.500000 frame texture frame material
+texture frame = texture anim vertex
+= 0.500000 = material bone = 1.0
+anim frame = = 0.500000 frame = -1 1.0
+1.0 texture -1 frame =
+= material
+vertex
+1.0 material
+0.500000 bone anim 1.0
+=
+0.500000 anim
+0.500000 -1 material anim 1.0 0.500000 frame anim vertex
+frame
+frame = -1 material -1 -1
\ No newline at end of file
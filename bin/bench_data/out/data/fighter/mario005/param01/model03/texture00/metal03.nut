@@ -0,0 +1,2 @@
+frame
+0.500000 vertex anim 0.500000 = vert
\ No newline at end of file
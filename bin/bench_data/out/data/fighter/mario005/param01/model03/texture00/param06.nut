@@ -0,0 +1,6 @@
+0.500000
+0.500000
+0.500000 -1 1.0
+material
+= anim texture anim 0.500000 vertex vertex texture = vertex
+bone an
\ No newline at end of file
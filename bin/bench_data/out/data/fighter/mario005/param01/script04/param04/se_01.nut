@@ -0,0 +1,18 @@
+frame frame texture material anim bone
+= texture material
+= bone
+1.0 = anim = texture -1
+bone
+0.500000 material -1 -1 texture -1 texture
+texture -1
+vertex anim 1.0 frame material
+frame 0.500000 0.500000
+vertex -1 0.500000
+material texture 0.500000
+bone bone 1.0 -1 texture texture vertex 1.0 texture 1.0 -1 anim
+frame frame = -1 texture
+1.0 vertex anim frame 1.0 vertex = = 1.0
+frame 1.0 anim bone material 1.0 material frame
+-1 -1 bone
+-1 frame bone -1 1.0 texture =
+vertex frame material texture vertex 
\ No newline at end of file
@@ -0,0 +1,2 @@
+1.0 0.500000
+0.500000 bone material ve
\ No newline at end of file
@@ -0,0 +1,191 @@
+= 1.0
+-1 -1
+= frame
+bone texture
+anim -1 1.0 material -1 0.500000
+= anim
+= anim
+bone bone = material anim 0.500000 frame texture = 1.0 1.0 vertex
+0.500000 bone
+1.0
+texture 0.500000 = material texture frame frame
+anim texture 0.500000 1.0 0.500000 anim material
+1.0
+frame =
+1.0 1.0 bone anim 1.0
+texture
+vertex = frame material 1.0 = = material 1.0
+vertex
+1.0 frame
+vertex frame = 0.500000 frame frame -1 1.0
+frame bone 0.500000 -1 bone anim vertex 1.0 anim =
+material anim texture material texture
+material 1.0 -1
+= 1.0 vertex material = = material
+0.500000 1.0
+-1 texture anim frame bone material texture
+1.0 vertex texture
+bone anim
+material -1 material = 1.0
+vertex 0.500000 anim
+anim
+frame anim 0.500000 0.500000 frame -1 texture
+material = texture 0.500000 frame bone bone
+anim 0.500000 frame frame
+1.0
+texture 0.500000 vertex
+material anim 0.500000 1.0 1.0 vertex
+bone frame vertex 1.0
+anim 0.500000
+frame frame
+1.0 bone material material vertex material
+bone 1.0
+texture 0.500000 -1
+= material
+texture frame =
+-1 0.500000 frame material
+1.0 vertex 0.500000 anim frame
+bone
+1.0
+frame material 0.500000
+frame anim anim 1.0 0.500000 anim frame vertex 0.500000 = 1.0 bone material bone
+-1
+frame =
+= -1 anim vertex anim anim material
+material -1
+1.0 bone
+frame frame -1 = material texture -1 bone anim = anim vertex
+0.500000 vertex
+texture
+anim
+0.500000 bone anim material anim
+0.500000
+frame 1.0 anim
+0.500000 frame 1.0 bone -1 frame anim anim 1.0 0.500000
+anim vertex bone vertex anim frame vertex bone 0.500000 bone anim -1 bone anim vertex frame -1 0.500000
+texture 1.0
+0.500000 = texture bone frame texture
+frame bone material bone = 1.0
+vertex material material 0.500000 = bone frame -1 anim texture 1.0
+= frame bone texture texture 0.500000 0.500000 1.0
+frame bone anim 1.0
+-1 anim texture
+texture
+=
+bone 1.0 vertex -1 = = -1 = vertex
+vertex anim material anim bone anim texture material
+material bone = 0.500000 1.0 material
+texture
+= = 0.500000 1.0
+vertex anim 0.500000 1.0 material material
+bone texture vertex
+0.500000
+-1 1.0 material bone
+= material vertex = bone frame vertex frame vertex bone
+bone bone frame -1 anim = anim bone 0.500000 =
+anim = texture 1.0 = material vertex -1
+anim bone
+-1 -1 vertex anim
+texture
+anim texture -1 = material anim
+= -1
+-1 material anim texture
+-1
+= frame
+vertex material
+vertex
+material
+vertex material
+material -1 vertex texture material vertex -1 0.500000 material anim bone -1 anim
+anim frame
+material bone 0.500000
+vertex bone anim = =
+1.0 0.500000 -1 -1 texture texture 0.500000 = -1 texture vertex frame 0.500000 material 0.500000 material 0.500000
+0.500000
+frame vertex
+vertex
+texture anim = bone texture frame
+bone material anim frame frame bone 1.0
+0.500000
+material anim bone 1.0
+texture material
+0.500000 -1 material material frame = material texture material bone 1.0 0.500000 vertex -1 material 1.0 = material
+= frame material material = material 1.0
+1.0
+0.500000 1.0 anim
+1.0 0.500000 vertex 1.0 -1 vertex vertex texture vertex 1.0 material
+0.500000 vertex
+frame 1.0 1.0 vertex vertex
+anim
+bone
+vertex
+material
+texture
+material
+bone frame bone texture frame texture vertex texture bone material texture 1.0 material material
+0.500000
+-1 bone frame frame frame frame 0.500000 anim
+texture
+bone = = vertex texture vertex frame 1.0 1.0
+vertex -1 bone
+-1 0.500000
+0.500000 -1 bone bone = anim material 1.0 1.0 1.0 = bone 0.500000 material 0.500000
+texture -1 anim anim
+frame
+-1 1.0 texture
+material
+material
+anim material vertex
+vertex
+vertex anim 1.0 vertex material 1.0
+-1 texture frame
+texture
+anim =
+material 0.500000 frame = -1 anim
+bone
+anim texture material texture -1 -1 -1 vertex -1 material -1 frame 1.0 material 0.500000 -1 bone
+-1 vertex frame
+= material bone vertex 1.0 material vertex
+vertex 1.0 bone
+0.500000 vertex -1
+0.500000 bone material bone -1
+anim texture anim -1 vertex 1.0
+1.0 0.500000 = texture -1 texture -1 0.500000 = 0.500000 anim 1.0 anim vertex texture -1
+bone
+material
+bone texture frame anim vertex
+-1 =
+material anim 0.500000 vertex -1
+bone
+0.500000 material 0.500000 frame frame vertex 0.500000 = frame 1.0 texture bone vertex frame -1 1.0
+-1 anim material bone -1 texture =
+-1
+1.0 -1
+texture
+= = anim anim bone 1.0 0.500000 -1 texture vertex vertex
+vertex -1 vertex vertex 1.0 vertex
+bone -1 vertex texture = bone 1.0
+-1
+1.0 frame
+0.500000 -1
+bone frame 1.0 0.500000
+bone vertex texture
+vertex -1
+texture texture texture
+= bone material anim = material =
+vertex -1 bone
+material 1.0 1.0 0.500000
+vertex frame material 0.500000 bone frame = frame anim 0.500000 =
+vertex -1
+bone anim -1 vertex anim frame
+anim bone material anim
+1.0 anim -1 material
+= 1.0
+vertex 0.500000 texture anim
+0.500000
+anim
+frame bone
+texture -1
+frame 1.0 texture vertex frame
+frame 0.500000
+vertex frame a
\ No newline at end of file
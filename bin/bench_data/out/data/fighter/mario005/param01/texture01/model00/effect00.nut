@@ -0,0 +1,118 @@
+texture
+material 0.500000 0.500000 texture 0.500000 bone material -1 frame 1.0 anim bone 0.500000
+anim anim
+-1 frame texture bone -1 texture = texture
+0.500000 vertex anim frame material bone vertex anim 0.500000
+bone vertex bone frame frame
+anim frame texture
+vertex -1
+bone texture material =
+-1 material
+frame frame bone -1 frame material anim 1.0 1.0 1.0
+1.0 1.0
+material 1.0 vertex bone anim bone frame = anim 0.500000 bone anim frame
+material material texture
+texture 0.500000 vertex -1 1.0 1.0
+bone bone
+frame 0.500000
+material
+-1 vertex
+material 0.500000 -1 bone 0.500000 -1
+0.500000 -1
+-1 frame 1.0 = =
+-1
+0.500000 material anim anim frame texture
+material 0.500000 =
+texture
+-1 anim material
+1.0 -1 anim vertex texture anim vertex vertex frame = =
+texture
+anim material anim frame texture vertex
+-1 texture texture anim 0.500000
+-1 -1
+frame 0.500000 anim 1.0
+vertex
+vertex material 1.0 texture anim material 1.0
+= texture material 1.0 vertex -1
+1.0 material anim
+texture
+= 0.500000 material material 1.0 0.500000 bone material bone anim
+anim
+0.500000 1.0 0.500000 bone frame bone 0.500000 1.0 texture anim 1.0 -1 bone
+frame 1.0 vertex bone 0.500000 texture texture
+0.500000 anim
+= = bone
+1.0
+anim
+anim frame 0.500000 material 0.500000 0.500000 = vertex vertex -1
+vertex
+vertex bone -1 anim 0.500000 vertex
+anim frame frame -1
+0.500000
+-1 = frame vertex = material -1 vertex bone
+vertex = vertex
+bone material vertex -1 =
+anim vertex
+vertex bone
+vertex
+frame vertex 0.500000 bone
+0.500000 anim
+bone
+material vertex anim bone
+frame
+vertex 1.0 0.500000 vertex 1.0 material = = bone texture bone = anim
+0.500000
+vertex
+texture texture
+material material = = 0.500000 texture
+0.500000 0.500000 material
+frame 0.500000 material material anim anim
+material texture 0.500000 anim vertex 0.500000 1.0 bone bone = material -1
+1.0 -1 0.500000 texture bone frame 0.500000 material -1 =
+texture material anim anim vertex frame
+1.0 1.0 = vertex 1.0
+vertex
+material
+-1 1.0
+bone
+-1 anim
+-1 0.500000
+bone texture
+-1
+=
+-1 frame material = anim
+material
+frame material 0.500000 material material vertex material
+texture anim vertex texture vertex
+0.500000 = -1 texture 1.0 material frame bone =
+1.0
+0.500000 texture 1.0 anim
+0.500000 material 0.500000 frame 0.500000
+= -1 = = texture
+1.0
+0.500000 bone
+1.0 frame
+0.500000
+1.0 material anim
+material frame
+bone = 0.500000
+anim texture -1
+material material material
+1.0 1.0 -1 0.500000 vertex 1.0 -1 bone -1 1.0
+material 1.0 1.0 bone
+frame
+frame
+anim frame 1.0 frame texture frame =
+material 1.0
+1.0
+frame
+frame bone 0.500000 bone frame bone
+anim 1.0 0.500000 frame =
+anim -1
+1.0 1.0 anim 1.0
+1.0
+frame
+frame bone vertex frame
+texture -1 -1 -1 0.500000 vertex
+= material vertex
+0.500000
\ No newline at end of file
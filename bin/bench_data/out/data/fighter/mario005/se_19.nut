@@ -0,0 +1,15 @@
+vertex material material bone vertex
+= texture -1 -1
+frame material -1 vertex
+0.500000
+anim material texture 0.500000 vertex anim
+vertex 1.0 1.0 anim material 0.500000 vertex -1 vertex anim
+frame texture
+anim
+frame bone -1 texture =
+-1
+1.0 =
+frame vertex 0.500000 frame
+-1
+1.0 1.0 = -1 1.0 material
+1.0 0.500000 
\ No newline at end of file
@@ -0,0 +1,68 @@
+vertex vertex
+= anim
+0.500000 1.0 =
+=
+0.500000 material 1.0 texture 1.0 1.0 material material vertex material anim
+anim -1 texture -1 -1 material bone -1 anim vertex 0.500000
+1.0 frame texture 1.0
+material anim material
+1.0 material texture vertex =
+frame material -1
+bone frame 0.500000 = vertex
+bone vertex = frame 0.500000
+1.0
+material frame texture texture texture 0.500000
+-1 -1 bone 1.0 texture texture vertex frame -1 frame bone 0.500000 frame
+anim = 1.0 vertex texture frame anim
+= 0.500000 texture material
+vertex texture vertex -1 vertex material frame
+material vertex vertex -1
+1.0
+0.500000
+-1 frame anim bone vertex 1.0
+texture bone -1 = anim anim
+-1 anim
+material = material = 1.0 vertex material bone bone -1 = material bone vertex -1 = bone =
+0.500000 vertex 0.500000 frame =
+vertex
+-1 anim
+material
+1.0 0.500000
+bone material material -1 frame frame -1 1.0 0.500000
+material bone -1 -1 texture =
+anim frame = frame bone
+anim
+material
+1.0
+1.0 frame frame =
+texture =
+frame
+texture
+material frame frame frame
+frame
+material -1 -1 texture -1 1.0 bone material texture -1 anim
+bone =
+= vertex 1.0
+frame
+material -1 frame
+frame
+frame 1.0
+frame bone bone
+-1
+frame vertex vertex bone = 1.0 texture 0.500000 bone frame = frame
+-1 frame texture
+1.0
+= anim
+frame
+anim
+= 0.500000 material material
+vertex
+frame bone
+texture
+frame bone
+-1 material 1.0 texture =
+bone -1 -1 material anim bone material 1.0 0.500000
+0.500000 anim texture bone 1.0 texture material
+= = 0.500000 frame
+1.0
+texture 0.500000 1.0 bone mate
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 = frame =
+vertex 1.0 texture 
\ No newline at end of file
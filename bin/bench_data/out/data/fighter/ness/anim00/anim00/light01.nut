@@ -0,0 +1,18 @@
+material = 1.0 vertex bone
+= frame frame bone 0.500000 texture texture texture
+0.500000 frame material
+= 1.0 -1 bone texture -1 texture 0.500000 1.0 material
+bone vertex
+0.500000 -1 0.500000 bone 1.0
+anim anim anim 1.0 anim material 1.0
+frame 0.500000
+vertex anim frame vertex anim
+material
+vertex =
+bone anim texture
+-1 material anim
+material material texture frame bone vertex
+-1
+-1 1.0 bone
+texture texture = 0.500000 anim vertex
+1.0 material anim bon
\ No newline at end of file
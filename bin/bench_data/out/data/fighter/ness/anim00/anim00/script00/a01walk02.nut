@@ -0,0 +1 @@
+U8oF^5^uP@!n<l2֍J2bt]֋!>`<VnT,R`AJپ^bsKիYJ|
\ No newline at end of file
@@ -0,0 +1,39 @@
+0.500000 vertex -1 anim 0.500000
+bone anim 0.500000 bone
+frame
+= -1 0.500000 = material frame vertex
+= 1.0 texture bone frame
+anim
+1.0 anim 0.500000
+0.500000 anim 0.500000 vertex -1
+-1
+0.500000 -1 anim
+= = vertex -1 anim 1.0 = frame material =
+frame anim vertex
+-1 0.500000 anim = bone texture =
+vertex
+-1 material 1.0 = 0.500000 0.500000 1.0
+bone =
+frame material
+-1 texture anim 1.0 bone -1 =
+= vertex 1.0 vertex frame texture
+1.0
+texture 1.0 material
+bone 0.500000 vertex 1.0 1.0 =
+frame texture bone bone = bone -1
+bone texture 0.500000 -1 texture frame
+vertex 0.500000
+0.500000
+material vertex =
+material material texture vertex = -1 frame texture = material anim frame
+vertex anim bone material -1 anim
+frame bone material = 0.500000
+1.0 bone vertex
+-1 texture frame material vertex
+texture material 0.500000
+1.0 0.500000 vertex anim material
+1.0
+material
+vertex anim 1.0
+= vertex frame vertex
+anim 
\ No newline at end of file
@@ -0,0 +1,10 @@
+1.0 vertex material frame anim
+material -1 texture texture texture vertex
+1.0 0.500000
+1.0 0.500000 material bone
+= 0.500000 1.0 vertex bone -1 anim 0.500000
+-1
+bone anim 0.500000 0.500000 1.0 1.0 vertex
+0.500000 -1 = -1
+0.500000 frame
+bone anim 
\ No newline at end of file
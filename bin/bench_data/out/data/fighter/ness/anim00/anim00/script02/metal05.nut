@@ -0,0 +1,168 @@
+0.500000
+bone texture -1 -1
+anim bone -1 =
+anim frame vertex = bone bone material texture anim vertex anim anim frame
+=
+frame 1.0
+= anim texture
+frame frame 1.0 texture
+1.0
+frame vertex anim -1
+vertex vertex
+= texture bone frame vertex
+= 1.0 texture frame vertex anim
+anim
+bone texture
+material bone vertex -1 = -1 frame
+texture texture bone anim bone = bone frame =
+= texture = texture anim texture
+texture
+1.0 bone
+bone = material = vertex = 1.0 anim texture texture frame 0.500000 texture 1.0
+vertex texture -1 frame =
+1.0
+vertex material -1 frame frame material vertex vertex
+frame
+frame texture frame bone material -1 material texture
+bone material material material anim vertex material frame -1 0.500000
+= texture 0.500000
+material
+= frame
+anim vertex 1.0 texture 0.500000
+1.0 0.500000 -1 bone bone material frame -1 = material
+material bone
+-1 = -1 frame bone texture bone anim
+anim bone
+bone
+-1 material 0.500000
+bone material bone 0.500000
+vertex
+= material = 0.500000 texture
+material 1.0 0.500000 -1
+material 0.500000 = bone
+0.500000 -1 bone material = texture bone texture 0.500000 = 1.0 vertex
+texture texture material
+anim
+frame frame 0.500000 bone material frame -1
+texture frame
+-1
+frame
+0.500000
+texture material
+vertex frame = material texture 0.500000
+texture -1
+texture texture anim = 1.0
+-1 texture
+bone bone texture
+-1 texture anim -1 = texture vertex vertex bone material material -1 bone vertex = 0.500000 material 0.500000 material
+texture =
+1.0 material
+anim frame anim material
+=
+0.500000 0.500000
+texture frame
+anim frame
+-1 bone material anim anim 1.0
+material
+-1
+0.500000 0.500000 1.0
+-1 bone = vertex material texture vertex
+1.0 -1
+= -1
+-1 material anim bone 1.0 frame anim vertex
+material frame = -1
+-1 -1 texture -1
+1.0 anim
+anim bone
+frame 0.500000 -1
+anim = anim
+material anim
+anim
+bone -1 anim
+= frame vertex
+vertex -1
+= 1.0 vertex =
+= anim bone anim
+anim 0.500000 vertex bone
+1.0 frame = -1
+bone = -1 bone vertex
+material vertex 1.0 anim material bone
+-1 anim
+material
+1.0 frame anim texture -1
+bone frame -1 material anim 0.500000
+bone frame vertex =
+vertex
+0.500000 material = 0.500000
+texture bone bone texture vertex -1 material -1 anim
+vertex
+frame vertex anim 0.500000 -1
+frame
+= =
+1.0 1.0 1.0 frame =
+bone 1.0 0.500000 = vertex frame
+frame
+1.0 bone 1.0 texture texture vertex anim anim
+1.0 material bone vertex frame anim vertex 0.500000
+anim -1 = anim -1 anim anim frame anim
+bone =
+anim
+texture anim anim texture anim
+texture anim
+texture material
+anim anim bone vertex material bone
+texture
+anim bone vertex texture anim
+-1 1.0 -1
+texture
+0.500000 texture
+vertex material = bone = 1.0 vertex 1.0 0.500000
+-1 bone 1.0 frame frame vertex 0.500000
+anim material 0.500000 material
+bone 0.500000 -1
+-1 vertex 1.0 texture = anim vertex frame 0.500000 vertex
+bone bone
+-1 frame
+vertex vertex
+0.500000
+-1 vertex -1 anim texture vertex material anim anim vertex
+texture anim -1 bone
+texture
+= 1.0 0.500000 vertex texture 0.500000
+frame
+-1
+0.500000
+bone bone = 1.0 vertex anim frame vertex vertex bone bone texture -1 anim vertex 0.500000 frame -1 anim
+-1
+anim vertex
+bone frame -1 frame bone
+texture frame
+texture
+= frame
+= vertex material 0.500000 -1
+0.500000 = texture
+anim
+anim = = bone
+1.0 bone -1
+1.0 frame frame = vertex
+0.500000 texture
+1.0
+0.500000 = = texture
+vertex = texture frame frame anim
+0.500000 0.500000 -1 anim 1.0 anim -1 bone frame
+0.500000 = frame
+= -1 anim
+material 1.0
+anim 0.500000 anim texture
+0.500000 -1 0.500000 anim
+frame = frame bone -1 0.500000 1.0 1.0 = bone
+frame
+bone vertex bone vertex -1 0.500000 = =
+vertex material anim -1 vertex = material
+-1
+anim = = material bone frame vertex texture bone -1 vertex bone
+texture bone = 1.0 = -1
+-1 bone 1.0
+0.500000
+0.500000 anim anim 0.500000 frame = bone 1.0 anim vertex texture
+material -1 anim b
\ No newline at end of file
@@ -0,0 +1,10 @@
+-1
+-1
+1.0 anim
+texture = -1
+-1 = vertex = = 0.500000 bone -1
+1.0 material
+material bone
+0.500000 material anim frame
+anim anim
+-1 -1 anim 0.500
\ No newline at end of file
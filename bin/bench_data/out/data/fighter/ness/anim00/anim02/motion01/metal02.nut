@@ -0,0 +1,8 @@
+1.0 material = material 0.500000 vertex material
+material
+material = -1 texture = frame
+material 0.500000
+anim 0.500000
+0.500000 anim
+material 0.500000 0.500000 0.500000 1.0 vertex anim = 1.0
+vertex bone material 0.500000 1.0 -1 = anim m
\ No newline at end of file
@@ -0,0 +1,54 @@
+1.0 1.0 frame material bone vertex 0.500000 vertex 1.0 = =
+anim anim
+0.500000
+texture texture
+frame material 1.0 -1 texture
+-1 material frame = anim
+anim anim
+= texture 0.500000
+frame anim texture material vertex
+0.500000 vertex anim bone anim 0.500000
+bone material texture 0.500000 vertex
+bone
+texture
+bone frame = = frame = = anim frame vertex material 0.500000 0.500000
+frame material =
+bone 1.0 1.0
+material material 1.0 frame 0.500000 0.500000 texture
+= frame 0.500000 material
+0.500000 material
+1.0 texture 1.0
+= frame = texture anim frame 0.500000 texture vertex = vertex 0.500000 material -1 bone frame
+material 0.500000
+material texture bone
+0.500000 texture
+1.0 anim = bone
+1.0 1.0 texture texture
+vertex
+-1
+frame
+0.500000 1.0
+bone texture
+frame -1 frame
+= anim
+1.0
+vertex
+frame
+material material texture bone vertex
+texture anim = frame frame
+vertex 1.0 vertex
+material
+-1 material
+= texture
+anim -1 vertex
+1.0
+bone anim anim anim anim 1.0 vertex 1.0 bone
+frame bone
+material texture
+vertex -1 anim
+-1 1.0 0.500000
+= 0.500000 vertex material vertex
+material anim vertex bone -1 -1 texture material
+material anim bone texture -1 1.0 -1 1.0 material
+1.0 1.0 = 0.500000 anim
+0.500000 = bone = material 1.0 0.500000 material vertex texture
\ No newline at end of file
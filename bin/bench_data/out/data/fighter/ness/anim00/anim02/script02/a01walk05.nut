@@ -0,0 +1,313 @@
+frame texture anim anim
+texture vertex
+= -1 texture 0.500000 = frame bone texture vertex
+= anim 0.500000 texture
+=
+texture anim texture frame material
+= 0.500000
+texture
+=
+bone
+-1 0.500000 material
+frame frame 1.0 frame material anim
+vertex
+texture 0.500000 frame
+bone material vertex material frame 1.0 anim texture 1.0 anim material =
+anim 0.500000
+0.500000 1.0
+=
+0.500000
+1.0
+1.0 frame
+texture 0.500000 texture
+texture
+-1 -1
+= texture 1.0
+-1 0.500000 bone material -1
+frame frame bone -1
+=
+material 1.0 texture frame anim frame
+vertex = 0.500000 1.0
+1.0
+1.0 0.500000
+texture vertex 0.500000 material material 0.500000 0.500000
+material
+material bone bone material
+vertex anim bone
+0.500000 vertex
+frame frame 0.500000 1.0
+material 0.500000 = bone frame material
+anim
+= vertex -1 frame 0.500000
+1.0 1.0
+frame anim
+bone material frame 0.500000 vertex frame
+anim material 0.500000 = bone 1.0 -1 -1 bone 1.0 0.500000 1.0
+material frame texture frame
+texture
+0.500000 = frame frame anim
+bone = vertex
+frame bone = material
+vertex anim material 0.500000 0.500000 texture -1 texture = vertex
+1.0
+frame
+-1 1.0 1.0
+vertex
+frame frame frame
+= bone anim
+bone 0.500000 1.0 texture
+anim material 0.500000 -1 bone vertex material 0.500000 -1
+material =
+vertex 1.0 -1 anim
+texture
+vertex
+vertex vertex 0.500000 texture bone
+anim 1.0
+anim vertex = -1 vertex
+=
+-1 material
+= -1 frame anim -1
+0.500000 = =
+anim texture -1
+bone texture
+bone = = vertex material = 0.500000 frame 1.0 material vertex vertex
+texture frame texture 1.0 1.0 1.0 -1 = -1 anim bone frame vertex 0.500000 1.0 = vertex
+0.500000 frame anim frame -1 vertex frame texture
+0.500000 bone anim 0.500000 0.500000 vertex
+= vertex texture =
+frame
+texture vertex texture = material 0.500000 vertex
+0.500000
+material bone 0.500000 1.0
+material frame
+material material 1.0
+-1 1.0 -1 -1 0.500000 1.0 0.500000 bone
+-1 anim texture -1 material
+1.0 bone = anim vertex -1 texture
+= =
+anim bone
+frame -1 material
+bone = 1.0 anim 1.0
+vertex
+bone 1.0 texture -1 anim 0.500000 vertex bone -1 bone
+-1 0.500000 = vertex
+-1
+material
+material
+1.0
+bone
+anim 1.0 vertex material
+texture 1.0 texture texture frame anim bone
+vertex 0.500000
+0.500000
+-1
+frame frame anim 0.500000 anim -1
+frame
+bone vertex
+material
+texture 0.500000 anim 0.500000
+vertex bone
+=
+-1 0.500000
+anim frame 0.500000
+vertex texture
+material texture
+anim anim -1 material
+anim material
+anim anim anim bone -1 vertex
+0.500000 vertex
+material
+= anim 0.500000 1.0 anim material -1 0.500000 1.0
+0.500000 0.500000 frame
+= frame bone 1.0 texture frame
+-1 texture frame 0.500000 -1 0.500000 texture anim material texture texture 0.500000
+vertex frame material -1 texture -1 1.0
+anim anim
+1.0 anim texture bone material = frame 0.500000
+-1 1.0 bone -1
+0.500000 1.0
+anim material
+-1 -1 1.0 bone 1.0 material material texture -1
+anim
+frame = 0.500000 frame anim 1.0
+material material -1 anim 1.0
+0.500000
+bone = bone material frame texture
+vertex
+1.0 -1 frame frame 1.0 0.500000 material material =
+=
+-1
+texture vertex texture
+texture 0.500000
+-1 -1 -1 bone 1.0 vertex anim texture anim 1.0 0.500000 texture 1.0 material -1 1.0 material -1
+anim
+bone vertex anim = 1.0 vertex 0.500000
+material frame vertex
+bone
+0.500000
+texture 0.500000
+vertex
+1.0 texture = -1 frame anim -1 0.500000
+1.0 = frame frame material frame
+= frame vertex vertex vertex material -1 -1 frame = bone texture 1.0 1.0 = 1.0 1.0 = frame material
+-1
+bone frame = bone texture
+-1 bone texture frame bone texture bone bone anim frame
+texture bone material
+bone 0.500000 material
+vertex
+1.0 texture bone -1 bone
+= bone 0.500000 0.500000 vertex 0.500000 bone
+texture =
+frame material bone
+1.0 frame
+vertex
+0.500000 0.500000 -1 texture 0.500000 bone vertex frame vertex anim
+vertex -1 bone material material bone
+anim 0.500000
+-1 1.0
+material = material anim material
+bone frame bone vertex
+material
+-1 texture bone
+1.0 bone
+anim -1
+vertex
+-1
+material 1.0 = vertex 0.500000 1.0
+0.500000 bone bone
+vertex anim 0.500000 1.0 =
+anim material = texture frame =
+texture bone material anim =
+frame
+frame 0.500000 material 1.0 material anim anim bone 1.0
+0.500000 anim
+material anim frame bone -1 frame -1 = anim
+frame = vertex -1 texture vertex texture frame 0.500000 vertex bone 1.0 bone frame
+bone frame
+texture
+material
+1.0 anim frame = bone material material 0.500000
+anim anim -1 =
+-1 1.0 material = -1 0.500000
+frame 1.0
+= 1.0 -1 1.0 0.500000
+material anim = anim vertex material = -1
+1.0 vertex bone = texture texture
+bone 0.500000 = 1.0 bone bone vertex = texture 1.0 texture frame -1 vertex anim vertex
+=
+frame -1 = frame anim frame material = -1 0.500000 material 0.500000 material anim anim
+vertex vertex
+vertex
+0.500000 anim = -1
+bone -1 material texture
+bone bone
+frame material = material 1.0 = texture -1 texture texture 0.500000 -1 texture -1 material vertex = vertex 1.0 anim 1.0
+= anim texture bone
+frame 0.500000 bone anim texture
+1.0
+= frame
+bone material
+0.500000 0.500000
+0.500000 texture vertex
+bone vertex bone bone
+0.500000
+frame
+material bone bone anim = 1.0
+0.500000 1.0
+material vertex texture
+material
+-1 bone texture vertex -1 1.0 0.500000 -1 texture
+texture 1.0
+frame
+= vertex texture material texture -1 material = = vertex
+= = anim vertex texture 1.0 = 1.0
+frame -1 1.0 = 1.0
+material texture bone 1.0 0.500000 texture anim 0.500000 = 1.0
+=
+frame = anim = bone material -1 anim material vertex bone = -1 = 1.0 bone material 1.0 1.0 bone
+frame 1.0
+0.500000 bone texture -1
+anim material material frame bone =
+vertex frame -1 1.0
+-1 frame = material anim bone 0.500000 vertex -1 0.500000 0.500000
+anim -1 frame 1.0
+bone frame
+bone = anim
+0.500000 0.500000 bone vertex -1 vertex vertex
+material 1.0 vertex 1.0 = material
+=
+texture frame
+texture
+material
+1.0 frame material material
+1.0 -1 vertex material
+vertex texture 0.500000
+bone frame texture 1.0 =
+=
+0.500000
+anim anim = 1.0 texture 1.0 0.500000 frame 0.500000 -1 bone vertex
+=
+texture 1.0 0.500000 anim 0.500000 1.0
+frame -1
+vertex frame anim anim anim = = texture -1 material anim 1.0 bone 1.0 -1
+texture -1 vertex texture bone frame = texture material =
+frame
+frame =
+material material bone = bone bone anim = anim material -1 = = -1 vertex
+-1 bone
+= bone bone bone texture 1.0
+-1
+frame bone frame = -1
+bone frame 1.0 anim 1.0 1.0
+0.500000 texture -1 material anim anim
+anim material vertex anim frame =
+1.0 vertex = texture = -1 =
+bone vertex 0.500000
+anim
+0.500000 texture -1 vertex = texture =
+0.500000 texture 1.0 0.500000 vertex = -1
+frame =
+anim vertex 0.500000
+texture bone anim material 1.0 bone bone frame material 1.0 texture 1.0 0.500000 texture texture vertex anim bone bone
+1.0 1.0 frame bone 0.500000 bone 0.500000 1.0
+bone = vertex anim -1
+1.0 anim -1 anim vertex 1.0 frame material -1
+frame
+material
+bone
+1.0 material = = 1.0 anim frame bone frame =
+anim material
+bone 0.500000 = = 1.0 vertex texture bone = material
+vertex anim
+1.0 -1 0.500000 material
+vertex bone 1.0 1.0 1.0 vertex
+0.500000 =
+texture
+material 1.0
+1.0 -1 texture frame 1.0
+vertex texture vertex texture
+0.500000
+vertex texture -1 0.500000 -1 bone
+-1 anim -1 -1 -1 material material 1.0 = bone texture anim bone
+material anim = bone anim bone
+material
+=
+1.0 texture
+material texture
+0.500000 anim = texture = -1 1.0 frame texture
+anim 1.0 vertex
+vertex
+= anim -1
+frame bone vertex texture
+frame anim anim = vertex
+= frame 0.500000
+frame -1
+vertex vertex anim
+0.500000
+= =
+material
+0.500000 = bone
+bone
+bone
+0.500000 frame frame = anim material texture
\ No newline at end of file
@@ -0,0 +1,17 @@
+material texture bone frame 0.500000 anim = 1.0
+bone 1.0 0.500000 anim
+material anim 0.500000 = 0.500000
+-1
+-1 vertex
+anim vertex texture vertex anim
+frame material 1.0
+vertex
+vertex frame frame 0.500000 material vertex vertex vertex 1.0 frame texture vertex -1 anim
+= frame -1
+1.0 vertex
+material 0.500000 0.500000 -1 = anim
+texture = 0.500000
+material
+=
+1.0 texture
+= bone material texture -1 texture bone texture = material -1 0.500000 texture 1.0
\ No newline at end of file
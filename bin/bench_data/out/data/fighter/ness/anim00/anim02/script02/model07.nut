@@ -0,0 +1,152 @@
+1.0 0.500000 vertex frame texture texture
+-1 1.0 0.500000 bone
+material 0.500000 1.0
+vertex
+1.0 1.0
+frame frame bone 1.0 1.0
+-1 anim -1 = 0.500000 0.500000
+anim 0.500000 anim = bone
+texture material frame
+bone = =
+1.0
+= 0.500000 bone anim
+texture
+anim frame texture texture texture material anim
+bone material
+material material frame anim frame 0.500000 anim bone =
+frame -1 -1
+bone anim 0.500000
+0.500000 1.0 bone texture bone bone frame 1.0 frame bone -1 = = vertex
+0.500000
+-1 texture 1.0 = bone vertex texture 1.0 texture anim
+1.0 texture
+material
+material
+texture texture -1 anim
+anim
+-1 texture
+texture frame =
+texture
+texture 1.0
+vertex
+1.0 material
+frame frame
+-1 1.0 material texture = vertex anim frame bone texture
+-1 anim 0.500000 texture material
+vertex bone = anim vertex
+vertex vertex frame
+0.500000 1.0
+1.0
+1.0 frame -1
+bone texture material texture
+1.0 bone 0.500000
+texture bone material = vertex material 0.500000
+-1 vertex bone = texture 1.0 -1
+0.500000
+bone
+texture -1 = 0.500000 -1 texture vertex texture
+-1 vertex
+1.0 0.500000 1.0 material vertex 1.0 bone -1 texture -1 bone -1 frame anim
+1.0 texture frame vertex texture
+-1 = 0.500000 1.0 -1 frame anim
+= bone
+-1 frame frame
+0.500000 = bone anim -1 frame anim 1.0 texture
+frame texture
+-1 -1 material material
+anim
+vertex anim 0.500000
+-1 1.0 material
+texture
+-1 bone
+0.500000
+texture 0.500000 -1 vertex frame 1.0 material anim
+anim 0.500000 1.0 material 0.500000 frame anim 0.500000 vertex 1.0 material vertex =
+0.500000 -1
+frame frame frame 1.0 bone -1
+= = 1.0 = 1.0 bone
+material 1.0 anim vertex 1.0 texture vertex texture bone
+bone anim material material =
+= -1 -1
+=
+material material frame vertex vertex = -1 vertex texture material vertex material frame
+frame
+-1 anim vertex vertex = vertex = bone material 1.0 frame
+material frame anim -1
+-1 vertex = texture 0.500000 bone anim anim = material frame
+vertex frame
+1.0 texture material 1.0
+vertex anim =
+bone anim
+0.500000
+bone bone
+= texture 0.500000
+0.500000 1.0
+material frame anim 1.0 material -1
+0.500000 =
+0.500000 0.500000 -1 frame texture 0.500000 0.500000
+bone = 1.0 vertex
+frame frame anim 1.0 texture texture vertex frame
+bone texture material = =
+vertex -1 material 0.500000 anim 0.500000 vertex bone bone
+1.0
+= frame
+frame anim
+1.0
+-1 = frame 1.0 bone texture 0.500000 0.500000 frame texture -1 -1 texture
+vertex vertex bone material
+0.500000 -1 vertex vertex
+= -1
+bone 0.500000 1.0 anim texture anim material bone -1 vertex anim anim texture 0.500000 -1 1.0 anim 0.500000 frame 0.500000 frame 0.500000 -1 -1
+bone texture vertex
+= 1.0
+material = 0.500000 -1 anim bone material anim -1 anim anim bone texture anim anim 0.500000 bone texture texture bone material texture vertex bone = = vertex
+= bone frame material 0.500000 vertex
+bone
+1.0 texture
+0.500000 anim vertex 1.0 anim anim 0.500000 texture material texture anim 0.500000 material 1.0 bone 0.500000 =
+material
+= 0.500000 frame frame bone material frame = frame 0.500000 frame
+frame texture 0.500000 0.500000 -1
+material -1 = texture texture
+bone 1.0 frame
+frame =
+0.500000 frame anim
+1.0 =
+anim = material 1.0 vertex =
+anim -1 = bone bone frame
+bone texture
+frame frame 0.500000 material =
+1.0 = vertex frame -1 vertex material
+vertex -1
+= vertex -1 anim 0.500000 0.500000 = 1.0 vertex
+1.0
+bone 0.500000 1.0 0.500000 frame anim vertex
+frame
+material
+bone anim 1.0
+0.500000 -1
+1.0
+frame
+frame 0.500000 vertex vertex
+texture texture anim bone 1.0 1.0 vertex 1.0
+material
+= -1 vertex bone 1.0 anim
+-1
+1.0
+1.0 frame anim 0.500000 anim material 1.0
+anim 1.0 texture = -1
+vertex bone
+0.500000 = vertex vertex
+1.0 anim texture frame vertex 0.500000 =
+0.500000
+material anim bone vertex vertex bone = =
+bone = anim
+frame -1
+frame anim 1.0
+texture
+1.0
+vertex
+vertex texture = anim 1.0
+frame
+0.500000 = 1.0 = frame bon
\ No newline at end of file
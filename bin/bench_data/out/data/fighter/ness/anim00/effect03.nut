@@ -0,0 +1,288 @@
+0.500000 frame vertex
+texture bone -1 1.0
+frame
+bone
+1.0 texture anim
+material material material frame vertex 0.500000 0.500000
+frame vertex frame bone bone anim -1 bone frame 1.0
+bone 0.500000
+texture
+texture frame = material bone texture vertex 0.500000 0.500000 anim -1 0.500000 =
+= =
+= 1.0
+-1 frame texture
+-1 bone 1.0
+-1
+texture
+bone
+-1
+texture anim
+= -1 bone = bone
+texture anim vertex vertex bone vertex -1 =
+= =
+-1 texture vertex 1.0 bone bone
+-1 -1 vertex bone material bone vertex
+bone
+= bone = frame 1.0 material
+texture material frame 1.0 texture 0.500000 -1 1.0
+vertex anim texture material
+= 0.500000 material
+anim
+bone anim material
+vertex -1 -1 anim anim frame frame bone = material
+-1
+=
+bone texture 1.0
+texture
+0.500000
+bone = texture -1 = 1.0 -1 texture texture texture = vertex = texture material 0.500000 anim
+1.0 material material vertex material
+anim bone vertex
+anim frame anim frame
+-1 vertex 0.500000 -1 material
+=
+texture vertex
+texture 1.0 vertex 1.0
+0.500000 frame = vertex
+frame
+anim anim frame 0.500000
+texture = -1 =
+0.500000 vertex frame material vertex
+1.0 bone
+= 0.500000
+=
+texture
+texture bone material
+-1
+texture
+0.500000
+vertex vertex = 1.0 bone frame bone vertex
+texture = =
+= material bone 1.0 frame anim bone 0.500000 anim bone bone 0.500000 vertex
+frame 0.500000 -1 bone anim texture
+frame
+vertex vertex texture anim
+-1 -1
+0.500000
+frame
+0.500000
+0.500000 texture vertex texture material -1 material =
+vertex texture vertex anim 0.500000 0.500000
+anim =
+anim
+= material = anim frame
+anim
+frame bone vertex
+bone = texture frame 0.500000 anim bone 1.0 material
+bone
+= vertex material 1.0 texture -1 1.0 1.0 =
+1.0 = 0.500000 anim 0.500000 anim material 0.500000
+1.0 vertex vertex bone texture -1
+-1 bone 0.500000 frame
+vertex
+1.0 texture = 1.0 -1 0.500000 -1 vertex
+texture 1.0 0.500000 = material
+= texture
+0.500000 material vertex frame
+frame material texture
+anim frame
+-1
+0.500000 bone frame anim 0.500000
+material
+vertex vertex
+bone anim
+material
+= frame
+vertex 0.500000 material = texture vertex
+frame bone
+1.0 1.0 vertex
+anim vertex 0.500000 texture 1.0 material 1.0 material
+1.0 1.0 -1 0.500000 bone frame anim
+= = frame
+bone -1
+frame material 0.500000 0.500000 1.0 frame bone frame bone texture texture anim
+anim texture vertex 1.0 bone -1 vertex 0.500000 = material 1.0
+frame
+1.0
+material bone
+anim
+frame
+1.0 anim material texture 0.500000
+= vertex vertex texture 0.500000 texture =
+1.0 = 1.0 1.0
+bone material frame texture frame anim
+0.500000 =
+0.500000 texture 1.0 frame -1 -1 frame frame vertex material
+frame
+vertex anim -1 material vertex
+material material = anim
+-1
+vertex
+frame frame vertex frame frame =
+-1 anim texture
+1.0 anim 0.500000 0.500000
+anim
+= anim frame
+material -1 1.0 material frame
+= anim bone vertex = frame 1.0 -1 frame vertex vertex vertex = material 0.500000 -1
+= = frame vertex vertex frame material anim anim -1 0.500000 0.500000 vertex texture
+= bone 1.0
+=
+frame vertex texture =
+bone 1.0 = -1
+bone bone -1 bone -1 0.500000 anim vertex
+texture
+0.500000 vertex 0.500000 bone
+vertex frame
+bone =
+frame vertex
+frame frame
+0.500000
+material
+-1 = frame frame bone
+-1
+1.0 anim material = frame vertex material = 1.0 frame texture anim material frame -1 material = 0.500000 frame -1
+texture frame
+bone anim = texture material material = anim frame -1
+bone
+frame 0.500000
+= 1.0 anim 1.0 -1 vertex vertex vertex texture bone frame bone material = texture texture vertex
+bone vertex
+vertex
+1.0 1.0
+vertex anim 1.0
+material frame -1 texture
+bone vertex -1
+texture
+0.500000 anim bone -1
+1.0 bone -1 = =
+=
+bone
+1.0 0.500000
+= 1.0 frame -1 vertex = anim
+0.500000 bone frame
+material anim -1 anim anim frame vertex material -1
+1.0 texture frame
+1.0
+1.0
+0.500000 1.0 0.500000 texture =
+anim frame
+0.500000 anim vertex anim texture texture = frame 0.500000 anim -1 anim = bone vertex texture
+1.0 1.0
+-1 texture 1.0
+material -1 bone -1 1.0 0.500000
+anim
+-1 anim material = texture vertex vertex
+0.500000 frame material material -1 anim -1
+vertex = vertex frame -1
+material
+frame 0.500000 anim 0.500000 anim = vertex anim 0.500000 texture
+bone
+frame 0.500000 0.500000 frame
+material bone = texture material bone
+anim material 1.0
+anim texture -1 1.0 0.500000 frame = anim
+1.0 material -1 texture 0.500000 1.0 texture -1 anim -1 1.0 anim 1.0 = texture frame 0.500000 0.500000 = -1
+bone anim
+anim material
+anim frame vertex vertex anim bone material -1
+material frame anim 0.500000 -1
+anim
+anim texture material frame anim 1.0 frame anim
+1.0
+texture
+vertex
+1.0
+frame -1
+frame
+frame
+= 1.0 bone texture
+texture
+0.500000 bone texture texture texture frame = anim texture
+material 0.500000 bone -1 frame anim
+bone = vertex -1
+1.0 vertex
+frame 0.500000 0.500000 = -1
+vertex 0.500000 = =
+= =
+material 0.500000 anim vertex 0.500000 anim anim texture texture 0.500000 anim material vertex 0.500000 -1 anim 1.0 anim bone bone anim vertex
+vertex texture 1.0 1.0
+bone texture anim frame
+bone -1
+material
+anim vertex 0.500000
+1.0 texture
+texture
+0.500000
+1.0 1.0 frame bone frame
+anim frame
+frame -1 anim texture bone 0.500000 0.500000 =
+texture -1 -1
+frame 0.500000 1.0 frame -1 vertex anim 1.0 bone bone = 1.0 bone bone anim -1 0.500000 texture material 1.0 frame 1.0 anim 1.0 vertex
+frame -1
+0.500000 anim
+texture
+0.500000 vertex 1.0 vertex vertex
+vertex
+material frame material
+material bone =
+bone anim = -1 = material -1 0.500000 frame
+0.500000 0.500000 -1 anim
+frame
+0.500000
+texture texture
+anim vertex frame texture material
+anim anim
+-1 frame -1 -1 material vertex 0.500000 1.0
+material
+anim 1.0 frame material vertex frame = 0.500000 frame vertex material 1.0
+1.0 0.500000 frame bone
+-1
+-1 1.0 texture 0.500000
+= texture texture vertex frame texture
+= bone material bone
+anim vertex texture
+frame =
+material
+frame anim bone
+0.500000 texture material
+-1 anim
+1.0 bone
+0.500000
+anim texture -1 anim 1.0 -1
+0.500000 texture material 0.500000 1.0 material 1.0 =
+anim material
+frame 1.0
+texture 0.500000 vertex anim 1.0 vertex texture
+-1 vertex
+vertex anim texture anim 0.500000 vertex material texture texture anim vertex -1 vertex material =
+frame = vertex anim
+= bone
+=
+1.0 material vertex texture material =
+1.0 texture
+material
+anim frame 1.0
+bone bone -1 1.0 -1 material vertex 0.500000
+vertex 1.0 material 0.500000
+frame
+material vertex 1.0
+= frame anim bone anim = anim 0.500000 =
+material
+0.500000 anim -1 = vertex
+material texture texture
+-1 anim bone material -1 = 1.0 frame 0.500000 material material frame -1 anim
+frame 1.0 1.0
+bone 0.500000
+1.0 texture
+1.0
+vertex
+bone frame 1.0 frame bone vertex
+frame texture texture anim 1.0 material material 1.0 texture frame vertex frame vertex material frame
+material
+vertex
+frame 1.0 texture 0.500000 bone
+=
+anim = 1.0 =
+material 1.0 -1 0.500000 -1 1.0 frame material vertex vertex anim texture material 1.0 -1
+texture material = 1.0 0.500000 1.0
\ No newline at end of file
@@ -0,0 +1,19 @@
+1.0 frame = vertex anim
+= anim frame
+material
+=
+1.0 =
+=
+frame
+frame 0.500000 bone 1.0 texture anim texture bone -1 frame
+bone -1
+1.0
+= 1.0 vertex 1.0 material frame 1.0 material texture
+=
+0.500000 =
+frame
+-1 anim frame
+0.500000 material 0.500000 vertex texture
+0.500000 0.500000 = frame 0.500000 material vertex texture -1 anim = -1
+frame = frame
+vertex = anim -1
\ No newline at end of file
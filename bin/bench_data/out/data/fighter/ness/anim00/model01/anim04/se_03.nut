@@ -0,0 +1,24 @@
+material 1.0 vertex vertex
+1.0
+texture vertex 0.500000 frame
+= = anim
+-1 frame texture 0.500000
+vertex bone
+frame -1 = -1 vertex = frame material
+material bone bone frame bone frame frame frame frame
+material material anim texture
+anim material =
+1.0
+material anim 1.0 0.500000
+bone material texture
+vertex frame bone frame
+frame frame
+= = bone 0.500000 0.500000 0.500000 anim bone material 1.0 texture
+frame vertex texture
+0.500000
+material
+= anim =
+material 1.0 anim
+-1
+texture
+anim -1 v
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 anim
+vertex vertex material = -1 1.0 anim frame
+=
\ No newline at end of file
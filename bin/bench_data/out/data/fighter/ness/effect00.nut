@@ -0,0 +1,10 @@
+=
+anim texture material texture anim
+0.500000 frame
+frame texture frame 1.0 bone -1 1.0 1.0
+vertex 1.0 vertex
+vertex
+vertex = 1.0 material 0.500000 1.0 anim -1 0.500000 vertex vertex bone
+= texture vertex 1.0 frame
+anim
+0.500000 -1 vertex bon
\ No newline at end of file
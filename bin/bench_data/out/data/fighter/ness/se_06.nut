@@ -0,0 +1,126 @@
+frame
+1.0
+1.0 0.500000
+anim bone anim 0.500000 1.0 1.0 texture bone frame -1 frame
+material = material material
+bone material 0.500000 = 0.500000 bone 0.500000 = 0.500000 0.500000 =
+1.0 bone -1
+texture
+material
+material frame 0.500000 -1 anim -1 0.500000 -1 anim
+material material
+frame bone anim = -1 material texture 1.0
+bone bone 0.500000 bone frame 1.0
+=
+vertex
+frame frame 0.500000 texture
+bone
+1.0
+0.500000 vertex 0.500000 vertex vertex texture texture material
+-1
+1.0 0.500000
+material texture -1 1.0 vertex frame
+material bone material frame -1 1.0 frame texture anim = material = anim anim = bone 0.500000 0.500000
+anim bone 0.500000
+0.500000 bone material material material -1 texture
+anim material -1
+1.0 frame material texture 1.0 texture frame anim 0.500000
+texture
+bone vertex 1.0 bone -1
+material vertex anim anim -1
+1.0 0.500000 0.500000 0.500000
+vertex texture material 1.0 0.500000 vertex texture = 1.0 0.500000 = material
+bone texture texture = 1.0 -1 frame anim
+vertex
+vertex texture -1 material material bone frame vertex anim anim 0.500000 anim
+1.0 material bone
+1.0 0.500000 material
+-1 texture = 1.0 material = frame = texture 1.0 bone anim
+frame
+frame
+0.500000 anim anim
+-1 = = bone 0.500000
+texture frame 0.500000
+bone
+anim
+0.500000 1.0 bone -1 1.0 frame texture bone = 1.0
+bone material =
+anim 1.0
+anim vertex frame bone frame -1 = vertex
+anim material anim bone texture 0.500000
+0.500000
+texture = vertex bone frame texture
+1.0 texture vertex
+1.0 bone
+= 0.500000 frame texture
+anim = frame bone frame 1.0 material
+1.0 frame
+0.500000 bone texture -1 =
+vertex material -1 -1 anim 0.500000 = bone
+material -1 0.500000 1.0 texture =
+bone vertex bone frame = bone frame = material texture texture = texture vertex material anim texture
+1.0 -1 = texture material
+=
+anim bone bone texture -1
+0.500000 =
+= = bone vertex 0.500000 bone
+frame vertex vertex 0.500000
+1.0 0.500000 material bone 0.500000
+frame -1 vertex anim -1 0.500000 1.0 -1 -1 vertex 1.0 texture anim anim 0.500000 texture material = material
+1.0 material vertex
+vertex vertex -1 frame 1.0 0.500000 0.500000 -1 texture =
+texture
+material texture
+material -1 1.0 bone
+material vertex
+vertex 1.0 1.0 = texture anim anim
+-1 vertex 0.500000 texture -1 material
+vertex
+frame -1 material 0.500000 vertex vertex texture 1.0 texture material -1 = frame material texture frame -1 =
+frame 1.0
+anim
+bone material
+bone
+bone vertex vertex -1 0.500000 1.0 material
+= 0.500000 material vertex material frame -1 1.0 vertex anim material vertex frame
+1.0 -1 -1
+bone
+vertex anim 0.500000 texture 1.0
+texture 1.0 frame
+-1
+material
+1.0 1.0
+anim
+frame frame texture anim
+vertex vertex anim
+frame bone
+0.500000
+0.500000 bone material frame =
+frame 1.0
+0.500000 frame -1 material texture
+vertex 1.0 = texture
+0.500000 material vertex
+0.500000 vertex = vertex frame vertex anim anim
+= 1.0
+vertex
+-1 vertex
+frame
+frame vertex
+=
+vertex
+= bone texture
+material frame frame 0.500000 anim texture vertex 0.500000 vertex vertex bone
+= frame
+0.500000 anim = -1
+frame material frame
+anim frame bone bone 0.500000 1.0 texture material
+-1
+vertex
+material material =
+anim vertex
+bone
+frame
+= -1
+bone
+frame = anim
+0.500000 frame material 1.0 vertex texture = mater
\ No newline at end of file
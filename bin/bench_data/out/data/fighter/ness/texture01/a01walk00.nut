@@ -0,0 +1,4 @@
+3WDR|걞L:pn|,%'gdzdd{xs2;j8/y,:	CjRf<;会~]&m3yV@mw^ڽ*`?p͙r|'9opHB&\EsT`&]:uDQߣ٧/\aگ1v-k
+Z:Q|͙Z6ck#״6A*7g_!OŲ.{RwSZj6ۛˊFg5a&ӂ`k0{pfN#KY}:Uq)l3<}fo;mDh;zDȑ.%(zeun_='a	T()AVe4/^)fG+gDڧPX`:y24T摸`K+AwB3|m7F~Z%U̚
+|Lʾʍm\rN^"#MZhL3b\qBLLZB&aȤ| ֈM\+Q=]=Bywڰ*z{X2){d4d1ۘ8C
+g8:S@SwWHNMc<)4MYluȦ!4mC.zݮ]EOqܑ(ರ;%"(M%g"!=Xx73;]뱧QȌZ~KREE2PŇFG[.eóASi}ONio_NMk%JD޿UtM֠L}ɃAϮ|$_T?xΤ$qtqϥ߽ԙ%q$tt
\ No newline at end of file
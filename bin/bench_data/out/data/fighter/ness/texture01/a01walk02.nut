@@ -0,0 +1,55 @@
+anim vertex -1 0.500000 -1
+material frame texture -1
+1.0 bone vertex texture =
+frame vertex = material material 1.0 vertex vertex frame vertex
+-1 1.0 0.500000 bone texture texture 0.500000 0.500000 bone
+texture material
+material texture 1.0 bone texture frame 1.0
+-1
+bone
+anim material material
+vertex bone bone anim 0.500000
+texture
+bone -1
+frame
+1.0 bone 0.500000 vertex
+vertex
+frame vertex frame vertex
+-1
+texture material vertex material frame material material
+-1 texture
+anim anim
+anim
+anim
+0.500000
+material texture bone -1 bone
+-1
+vertex anim
+material
+anim 0.500000 anim -1 material frame
+1.0 = = anim
+anim
+=
+0.500000 frame material frame bone anim texture
+1.0 vertex 1.0 = vertex vertex
+anim 0.500000 0.500000 1.0 anim 0.500000 frame material 1.0 -1 =
+1.0 anim anim frame -1 1.0 0.500000 anim material bone texture texture = anim
+0.500000 bone 1.0 = material anim texture 0.500000 anim
+texture -1 0.500000 bone anim =
+bone frame anim
+-1 texture 0.500000 -1 material vertex
+frame texture = 1.0 0.500000
+= frame anim
+bone
+=
+vertex
+vertex = vertex
+frame =
+1.0 0.500000 1.0 bone vertex
+frame frame anim material texture
+texture 0.500000 bone bone 0.500000 texture material
+vertex material
+0.500000
+0.500000 -1
+vertex bone vertex
+0.5000
\ No newline at end of file
@@ -0,0 +1,275 @@
+= = frame = vertex
+0.500000 -1 0.500000 bone 1.0
+0.500000 -1 1.0 material 0.500000
+texture bone anim
+0.500000 =
+anim
+material vertex
+anim
+-1 bone
+-1
+material 0.500000
+material frame
+material anim
+= anim 0.500000 = frame
+= -1
+= bone
+1.0 bone 0.500000
+vertex
+vertex
+vertex 0.500000 texture 1.0
+texture vertex = -1 -1 -1 vertex frame -1 frame texture = = texture 0.500000 1.0 bone = 0.500000 =
+1.0 texture
+anim vertex 0.500000 0.500000 vertex 1.0 1.0 bone texture bone 1.0 vertex
+material 1.0 1.0 -1 anim
+texture
+vertex
+= 1.0 anim material 0.500000 frame
+texture
+texture
+vertex frame bone frame 0.500000
+texture
+bone 0.500000 frame -1
+bone vertex 1.0 1.0 = vertex
+0.500000 material = = anim anim texture 1.0 vertex
+frame bone 0.500000 -1 =
+material frame material = = material anim 0.500000 -1
+texture
+frame vertex anim frame
+1.0
+1.0 1.0 -1 -1
+-1 texture 1.0
+0.500000 bone
+texture 0.500000 =
+anim texture
+= = 1.0
+bone
+vertex
+bone = 0.500000 texture anim = material =
+= vertex material bone frame = bone anim frame
+= 1.0 vertex = frame -1 = frame
+frame
+texture -1
+bone -1 vertex 0.500000 0.500000 material
+bone vertex 1.0 material
+anim -1
+anim
+-1
+texture texture anim 1.0 anim
+material
+= bone vertex
+frame anim material frame
+anim material
+vertex = 1.0 0.500000 bone bone bone = texture =
+material
+bone anim
+= -1 material =
+anim anim
+-1
+anim 1.0 = -1
+vertex material anim material -1 frame frame 1.0 material material vertex vertex
+texture = vertex
+vertex =
+texture 1.0 1.0 anim
+frame
+0.500000 material texture
+material
+vertex = 0.500000
+vertex
+= 0.500000 material vertex 1.0 1.0
+material material texture
+texture -1
+frame
+-1
+vertex -1
+-1 material 1.0 material = = bone texture 0.500000 material 0.500000 vertex texture 1.0 material
+frame anim texture =
+texture texture
+= anim texture
+bone frame 0.500000 frame
+material = -1
+material bone anim 0.500000 frame 0.500000 anim -1 material vertex
+-1 0.500000 = frame texture = 1.0 = anim = frame texture = frame anim frame = 0.500000 bone anim 0.500000 anim
+vertex vertex
+anim
+vertex 0.500000
+material frame = bone texture material 0.500000 frame 1.0 1.0 bone frame 1.0 bone material -1 material 0.500000
+-1 material
+= material texture = texture material texture material texture 0.500000 texture
+0.500000
+1.0
+anim = texture
+bone
+1.0
+bone texture frame 1.0 material
+texture anim texture vertex =
+material -1 material texture material
+1.0 texture bone bone material frame
+0.500000 0.500000 = texture
+material -1
+bone 1.0 vertex vertex = vertex
+bone anim
+frame texture 0.500000 bone = 0.500000 texture frame
+1.0
+frame frame = frame 0.500000 anim texture -1 anim 0.500000 0.500000 bone
+= material 1.0 bone 1.0 1.0 anim
+-1 1.0 bone bone
+0.500000 material frame frame 1.0 bone material
+-1
+material
+texture
+anim
+material anim -1
+frame = = -1 material -1 bone = texture
+vertex 1.0 bone = -1 1.0 frame texture frame bone material frame material 1.0 1.0 1.0 0.500000 texture vertex anim 1.0
+vertex = -1 material = bone texture bone frame vertex =
+vertex material anim material
+material bone
+frame
+bone vertex material anim
+vertex material 1.0 bone texture -1
+frame 1.0
+material texture 1.0
+material -1 frame
+vertex 0.500000 frame 1.0 bone material vertex 0.500000 -1
+bone vertex bone bone
+1.0 vertex frame -1 frame 0.500000
+0.500000 anim 0.500000 material 1.0 vertex
+-1 material texture frame -1 bone = 0.500000 anim -1
+-1
+1.0 frame anim
+material material texture -1
+frame 1.0 frame frame = = anim texture material -1 material
+0.500000 material material anim texture 1.0 0.500000 anim
+frame 1.0 material
+material vertex =
+frame =
+anim vertex = anim 1.0 vertex texture 1.0 1.0 0.500000 bone = -1 anim material 1.0 vertex = frame 1.0 vertex texture -1 =
+material
+texture
+bone 0.500000 vertex 1.0 anim anim 0.500000 -1
+-1 bone frame = bone anim
+material
+-1
+vertex
+vertex texture vertex 0.500000
+1.0 frame texture material 0.500000 bone 1.0 anim vertex -1 1.0
+bone material
+vertex texture anim 1.0 bone
+bone material -1 1.0
+bone
+= = 1.0 anim material =
+-1 bone bone anim 1.0 material anim 0.500000 0.500000
+texture texture 0.500000 1.0 -1 frame 0.500000 vertex -1
+= material 1.0 texture
+1.0 bone -1 0.500000 = = -1
+material = material
+material anim bone
+=
+frame texture material frame 1.0 frame = =
+1.0
+= material 0.500000
+= texture texture bone
+anim = 0.500000 -1
+anim = = -1 -1 0.500000 1.0 -1 0.500000 -1 material frame material 1.0 = -1 bone frame
+= anim 1.0 =
+-1 vertex 0.500000 anim
+texture frame -1 material -1 = -1 vertex
+0.500000 bone frame vertex material frame bone texture
+frame vertex bone anim
+frame frame material 1.0 vertex -1
+-1 anim
+-1
+-1 -1 frame -1
+1.0
+=
+= -1 material 1.0 bone 0.500000
+bone bone
+frame anim anim material =
+anim frame
+frame
+texture -1
+vertex
+material material
+vertex texture
+= =
+anim
+frame texture vertex = = material
+-1 texture 0.500000 1.0 1.0 -1 material
+-1 1.0 anim
+0.500000 -1 1.0 = anim 0.500000
+frame texture anim material frame 0.500000 1.0
+bone = anim -1 frame
+texture texture frame 0.500000
+texture
+1.0
+bone 1.0 frame bone vertex bone material
+material
+0.500000 vertex material frame
+= 0.500000 1.0 material
+anim material anim frame texture
+anim vertex
+= anim
+texture texture material bone frame bone frame = vertex -1 frame texture material -1 -1 vertex texture vertex = -1
+1.0
+0.500000 -1 vertex bone 0.500000
+bone anim
+anim 0.500000 vertex
+vertex vertex
+frame = vertex
+anim
+texture bone bone anim anim texture 1.0 1.0 1.0 =
+texture vertex texture material vertex 1.0 material 0.500000 frame -1 material bone 0.500000
+bone texture
+texture bone frame 0.500000 0.500000 -1 material bone material bone anim texture
+anim
+-1
+0.500000 bone
+-1 0.500000
+anim material
+frame anim anim 0.500000 vertex vertex anim 1.0 material
+texture
+0.500000 vertex texture 0.500000
+anim = texture vertex 0.500000 -1 1.0 vertex
+texture = 1.0 texture anim anim material -1 frame vertex texture texture anim = frame -1
+anim texture anim frame
+frame 0.500000 anim 1.0
+-1 -1 1.0 1.0 -1 0.500000
+-1 material 1.0 frame anim bone 1.0
+texture 0.500000 = anim vertex = material vertex 0.500000 -1 texture frame 0.500000
+frame frame -1
+frame
+material -1 anim anim 1.0
+bone 0.500000
+material texture -1 vertex = frame anim texture
+=
+frame
+0.500000 frame 0.500000 frame vertex = vertex bone anim anim -1 1.0 0.500000
+= texture -1 1.0
+texture
+0.500000 -1 0.500000 frame frame vertex texture 0.500000 1.0
+0.500000 1.0
+= bone bone 0.500000
+frame
+1.0
+-1 = anim 1.0 = -1 texture anim bone
+frame bone
+vertex
+texture anim bone anim
+texture material material
+frame bone =
+anim frame frame texture 0.500000
+texture
+1.0 -1 1.0 material
+material = texture anim
+= -1 bone
+1.0 1.0 1.0 anim
+material vertex texture anim
+frame vertex bone -1
+bone -1
+= material frame
+0.500000
+vertex
+1.0 texture frame = material frame
+bone frame frame = texture bone material -1
+= frame vertex 0.500000 1.0 anim bone = vertex 0.50000
\ No newline at end of file
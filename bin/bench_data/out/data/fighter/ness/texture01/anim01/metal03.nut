@@ -0,0 +1,88 @@
+vertex bone -1 frame
+-1 anim 1.0 anim -1 = vertex texture 1.0
+bone frame 0.500000 texture anim
+material = texture
+0.500000
+0.500000 anim bone -1
+material 0.500000 vertex 0.500000 texture = 0.500000 -1 vertex texture
+bone 1.0 frame vertex
+texture =
+frame 1.0 -1 1.0
+1.0
+vertex bone -1 -1 vertex bone material bone anim
+material
+-1 -1 bone 1.0 0.500000
+0.500000 frame anim bone texture 0.500000 material 1.0 =
+texture 0.500000
+0.500000
+frame material frame 1.0 0.500000 anim -1 1.0 =
+anim vertex
+material material
+= texture vertex material 0.500000 bone material
+0.500000 frame anim
+0.500000 texture bone = material frame anim -1
+1.0 bone 0.500000
+vertex =
+1.0
+-1
+material 1.0
+vertex 0.500000 frame
+material anim bone
+frame bone material =
+frame 0.500000 vertex frame 1.0 frame
+frame anim
+bone
+-1 vertex texture 0.500000
+anim frame bone texture material 1.0 = bone texture material anim vertex -1 texture 0.500000 = material
+bone
+bone vertex 0.500000 bone material anim 0.500000 vertex
+texture 0.500000 anim 1.0 0.500000 0.500000 1.0 0.500000 =
+frame vertex frame 0.500000 1.0 bone = texture
+vertex
+bone = texture
+0.500000 anim = 1.0
+material vertex -1
+0.500000 bone bone -1
+anim
+anim texture
+1.0
+anim = material
+vertex
+material
+vertex anim
+-1 vertex
+-1 0.500000 vertex anim material
+anim material anim texture
+1.0 -1 material bone -1 anim frame = 1.0 texture vertex
+material
+bone
+anim = anim
+frame bone
+texture frame
+= = material =
+anim texture texture 0.500000
+frame
+= 1.0 bone -1 frame = = frame anim bone vertex texture bone
+= bone
+0.500000
+anim vertex
+texture texture
+-1 1.0 vertex = anim
+bone = anim -1 -1 = vertex material = frame 1.0 anim
+material vertex 0.500000 vertex -1 vertex anim anim 0.500000 = texture bone
+bone
+material anim anim 0.500000 bone -1 frame frame
+material bone anim anim
+texture
+-1 =
+1.0 anim bone anim material 0.500000 texture texture 1.0 anim 0.500000 material
+0.500000 frame material bone frame
+material
+1.0 bone frame bone
+texture
+vertex frame 0.500000 = anim
+= bone vertex frame
+-1 -1 -1
+anim anim -1
+material
+1.0 bone 0.50000
\ No newline at end of file
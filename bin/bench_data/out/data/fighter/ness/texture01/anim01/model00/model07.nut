@@ -0,0 +1,7 @@
+vertex vertex = material
+texture anim 1.0
+bone
+-1 material 0.500000 anim
+0.500000 frame material -1 vertex -1
+-1 -1 anim bone -1 bone -1 texture material anim bone -1 =
+texture m
\ No newline at end of file
@@ -0,0 +1,2 @@
+6.ypjN%hn%LLK;SBeekbE@ɞ!q,P`Idd+ KѾ=TFqwOwNX4)Ry"w2WrSJvMEҌ;eTopKg؝
+ZnHeGrӠ\9V"ACa XSʃn?ƾl{kZ,b33ͳ,mR]
\ No newline at end of file
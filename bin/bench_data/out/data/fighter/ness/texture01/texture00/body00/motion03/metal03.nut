@@ -0,0 +1,4 @@
+anim
+anim frame texture = material
+1.0 vertex
+= 0.50
\ No newline at end of file
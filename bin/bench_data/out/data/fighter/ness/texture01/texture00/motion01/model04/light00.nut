@@ -0,0 +1,9 @@
+material = vertex = anim
+anim vertex = -1
+texture -1
+-1 frame anim anim
+material texture frame -1 material
+1.0
+anim texture vertex =
+-1 -1 1.0 vertex
+= 
\ No newline at end of file
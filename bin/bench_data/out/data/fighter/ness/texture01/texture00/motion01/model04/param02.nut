@@ -0,0 +1,152 @@
+bone vertex
+material frame frame 0.500000 -1
+anim texture
+0.500000 = anim vertex = -1 bone
+= frame bone 0.500000
+vertex 1.0 texture
+1.0 material frame =
+texture -1
+material material -1
+-1 material
+0.500000
+1.0 material anim = anim =
+material
+-1
+material
+= -1 -1 1.0 anim vertex bone 0.500000 vertex
+frame vertex anim vertex 1.0 bone anim
+0.500000 bone 0.500000
+0.500000 1.0 1.0
+texture bone
+= -1 -1 anim 0.500000 0.500000
+0.500000 0.500000 frame material
+bone material
+vertex vertex 1.0 anim texture vertex -1 bone material
+-1 1.0
+anim = texture vertex
+texture 1.0
+material 1.0 frame vertex
+-1 vertex
+= vertex frame material -1 1.0 texture
+1.0
+anim anim
+0.500000
+0.500000
+0.500000 -1 =
+bone material texture material anim frame
+vertex vertex
+1.0 0.500000 1.0
+vertex texture -1 vertex
+texture 1.0
+texture
+vertex = 1.0 = 0.500000
+anim material 1.0 material =
+bone anim
+-1 -1
+bone = =
+bone material vertex
+frame anim vertex 1.0
+texture anim -1 vertex
+frame = texture material texture
+frame
+bone vertex
+anim 1.0 bone =
+1.0
+-1 texture texture
+anim
+-1
+0.500000 -1 texture
+anim frame vertex bone -1 material 0.500000 frame = frame =
+-1
+bone 1.0
+texture vertex vertex
+material = vertex frame
+texture =
+texture
+frame
+1.0
+bone =
+texture
+bone
+material vertex bone anim texture 0.500000 = texture material frame
+frame bone 0.500000 frame =
+-1
+= texture vertex
+bone vertex vertex
+bone
+-1 1.0 -1
+bone
+material
+vertex 1.0 1.0
+texture anim 0.500000
+texture anim material -1 texture bone vertex
+material = -1 anim 0.500000 vertex vertex
+vertex
+frame frame material -1 0.500000 0.500000
+bone bone -1 texture 0.500000 1.0 texture bone 1.0 -1 bone
+anim = texture 1.0 1.0 frame
+frame vertex anim texture = material
+vertex
+1.0 texture texture
+material 1.0 -1 0.500000
+0.500000 0.500000 texture 0.500000 vertex =
+texture 0.500000 anim -1 frame material 1.0 -1 -1 1.0 =
+1.0 anim anim frame bone
+anim
+material texture
+= texture 0.500000 vertex -1
+material
+material
+-1 1.0 -1 -1
+vertex
+anim
+anim material anim
+frame
+texture -1
+1.0 0.500000
+-1 = -1 texture frame
+= texture 0.500000 frame frame material 0.500000 vertex
+texture = bone 0.500000 = -1 anim
+=
+=
+material
+vertex frame frame texture texture
+vertex -1 texture bone 0.500000 1.0 bone bone vertex vertex -1 vertex anim 0.500000
+frame anim 0.500000 anim
+anim
+material 0.500000 frame = 1.0 vertex = texture frame -1 1.0 = vertex anim
+-1 material
+0.500000 -1 anim 0.500000
+anim -1 anim = material frame 0.500000 -1 =
+vertex 0.500000 = bone
+vertex =
+1.0
+frame
+=
+1.0 bone
+anim frame = material
+= =
+bone frame bone
+bone vertex vertex vertex bone
+anim bone
+frame bone material
+material -1 -1 1.0
+= texture 1.0 vertex bone material bone vertex -1 = bone bone anim frame material
+anim
+frame material
+frame = frame
+-1 = = 1.0
+bone material bone bone
+bone 1.0
+anim texture texture = frame frame 1.0 anim -1 = vertex =
+1.0
+0.500000 texture texture -1
+-1 -1
+material material material 1.0
+=
+bone -1 frame vertex 0.500000 1.0 material material -1
+0.500000 1.0
+vertex
+bone bone vertex
+0.500000 1.0 0.500000 material vertex material
+fram
\ No newline at end of file
@@ -0,0 +1,14 @@
+=
+vertex 1.0
+frame bone
+material texture anim 0.500000 -1 bone
+texture bone 0.500000 frame texture bone -1 vertex anim material vertex frame anim texture 1.0 -1 vertex vertex material texture bone
+= anim texture -1
+bone
+1.0 frame
+texture frame vertex bone 1.0 bone material frame vertex anim material anim 1.0 1.0
+material texture material vertex 1.0 vertex 1.0 bone = 0.500000 frame
+material material vertex
+material vertex
+anim = = vertex anim
+a
\ No newline at end of file
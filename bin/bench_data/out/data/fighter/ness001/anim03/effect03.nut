@@ -0,0 +1,8 @@
+frame
+= 1.0 frame = bone -1
+-1 texture -1
+= vertex
+bone material material = -1 0.500000
+vertex material
+texture material anim 1.0 =
+an
\ No newline at end of file
@@ -0,0 +1,98 @@
+anim 0.500000
+=
+material
+material = material 1.0
+texture anim bone 0.500000 -1
+1.0
+texture
+frame
+bone = vertex bone = -1 bone -1 = = 1.0 frame
+vertex frame
+= vertex
+texture texture frame
+anim 0.500000 1.0 material
+=
+frame 1.0
+material 0.500000 anim 1.0 vertex 0.500000 bone vertex anim
+= texture frame 1.0
+vertex
+bone vertex vertex anim -1 1.0
+= -1 0.500000 vertex
+material material
+-1 1.0
+texture
+vertex frame material anim bone vertex frame bone frame
+-1 -1 =
+bone 0.500000 anim 1.0 frame anim 1.0 -1 1.0 frame =
+texture anim material
+-1 frame 0.500000 anim = texture 0.500000 material
+frame 0.500000 material = -1 0.500000 -1
+-1
+frame bone
+0.500000 bone material
+bone 0.500000 bone
+= = bone =
+0.500000
+1.0 -1 texture material texture frame = anim
+vertex
+1.0 = texture material
+anim
+1.0 anim frame texture bone =
+-1 0.500000 vertex
+bone texture vertex
+frame anim -1
+vertex
+1.0
+1.0 0.500000
+vertex 0.500000 1.0 bone 1.0 vertex texture
+material texture anim -1
+material = vertex
+texture 0.500000 frame frame
+0.500000 bone -1 1.0 bone vertex 1.0
+= = frame
+vertex material = material
+1.0 material
+0.500000 1.0
+vertex
+anim
+material anim texture anim
+texture anim anim vertex material frame material
+anim vertex
+0.500000
+0.500000 frame
+-1 frame texture -1
+texture -1
+frame anim -1 bone 0.500000
+0.500000
+frame bone anim frame frame bone vertex texture =
+1.0 -1 vertex
+0.500000 = material 0.500000 bone
+frame material -1
+0.500000 texture
+bone material material -1 vertex
+bone bone
+bone texture material
+bone vertex
+bone 1.0
+0.500000 vertex
+1.0 material 0.500000 = = = material frame = texture vertex 0.500000 1.0 frame
+texture frame
+texture
+vertex vertex = 0.500000
+vertex =
+bone 1.0 texture frame texture
+1.0
+1.0 0.500000 bone 1.0 -1 vertex frame 1.0 texture 1.0 vertex
+vertex 0.500000
+-1
+bone frame anim texture anim 0.500000
+bone anim 1.0 frame frame anim 0.500000
+1.0 -1 bone anim bone
+bone
+vertex texture material texture vertex
+bone 0.500000
+1.0 material 1.0 1.0 bone vertex 0.500000 material 0.500000 0.500000 frame 1.0 bone material frame bone 0.500000 bone
+-1 frame bone frame
+-1 = texture
+bone texture
+ani
\ No newline at end of file
@@ -0,0 +1,53 @@
+-1 frame texture 1.0 vertex
+= 0.500000 texture frame frame = 1.0 vertex -1 texture = vertex -1
+texture = -1
+anim -1 texture -1 -1 bone material texture material
+0.500000 texture
+vertex vertex -1 1.0 vertex frame
+-1 anim
+frame
+1.0
+1.0 anim
+material 1.0 material frame -1
+bone -1
+vertex 1.0
+-1 0.500000
+0.500000 -1 vertex
+anim frame 0.500000
+texture 1.0 bone
+0.500000 -1 texture texture
+1.0 1.0 -1
+anim 0.500000 0.500000 bone bone
+bone material
+1.0
+= 0.500000 material =
+=
+vertex
+-1 material
+vertex texture 1.0
+material
+frame
+= vertex
+material -1 vertex
+-1
+texture
+anim
+1.0 texture vertex bone material = 1.0 1.0 0.500000 bone =
+texture 0.500000 material -1 vertex
+bone frame texture frame
+material anim vertex -1 1.0 frame 0.500000 -1 frame vertex 0.500000 =
+frame
+1.0 0.500000 0.500000 frame anim vertex bone
+material frame -1 1.0 =
+bone 1.0 1.0 frame frame
+frame
+anim =
+bone = 0.500000
+frame
+-1
+bone 0.500000
+vertex 0.500000 bone material 0.500000 bone 0.500000 anim
+bone material
+material 0.500000 texture -1
+vertex frame
+0.500000 0.50000
\ No newline at end of file
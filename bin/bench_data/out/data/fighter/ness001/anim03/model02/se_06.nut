@@ -0,0 +1,2 @@
+material texture 0.500000 bone material bone 0.500000
+anim -
\ No newline at end of file
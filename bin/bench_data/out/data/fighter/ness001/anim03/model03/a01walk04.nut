@@ -0,0 +1,60 @@
+1.0 material -1 -1 -1 0.500000 0.500000 bone
+=
+vertex =
+1.0
+1.0 -1
+1.0 1.0 bone =
+texture anim texture 1.0 texture
+frame
+0.500000 texture 0.500000 texture material 0.500000 -1
+anim =
+=
+bone
+-1 -1 1.0 anim
+1.0 -1 anim material vertex texture bone
+anim
+frame material = = material texture vertex
+vertex anim material vertex 0.500000
+anim vertex anim
+vertex texture vertex anim texture material
+1.0 1.0
+material anim
+bone 0.500000 bone
+0.500000 texture texture frame
+frame material vertex
+1.0 texture material frame = -1
+1.0 material = =
+= vertex bone = 0.500000 frame
+vertex
+texture bone = = vertex 0.500000
+texture 1.0 -1 frame -1
+vertex =
+anim texture anim
+bone 1.0
+texture
+0.500000
+texture vertex =
+-1 0.500000 = 1.0 bone
+bone
+anim
+0.500000
+material
+texture material -1 -1 material
+frame frame
+frame bone
+texture -1 anim -1 0.500000 texture bone anim -1
+1.0
+frame frame = = texture anim 1.0
+texture material
+anim -1 -1 vertex frame
+-1 =
+-1 -1 1.0
+-1 vertex material material 1.0 = anim
+material 1.0
+frame
+material bone 1.0 anim = =
+-1 vertex
+-1 bone
+0.500000 vertex 1.0 material anim vertex vertex
+texture frame
+anim anim 0.50000
\ No newline at end of file
@@ -0,0 +1,4 @@
+anim texture material
+-1 material
+bone =
+-1 material 0.500000 vertex = texture 0.500000 bone fram
\ No newline at end of file
@@ -0,0 +1,2 @@
+= material
+texture bone frame anim
\ No newline at end of file
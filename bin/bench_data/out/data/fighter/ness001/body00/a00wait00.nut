@@ -0,0 +1,29 @@
+0.500000
+anim
+= bone -1 anim vertex material anim 1.0 frame
+texture bone
+-1 vertex bone =
+0.500000 anim 1.0 bone bone 0.500000
+material bone
+bone
+bone
+vertex -1 -1 -1
+-1 texture
+-1 = -1 = frame bone frame vertex = vertex -1
+1.0 frame -1 = vertex -1 vertex frame
+vertex -1
+1.0 bone = bone 0.500000 anim texture texture 0.500000
+texture vertex
+0.500000
+texture texture 0.500000
+-1 = anim material
+frame frame
+anim
+material material frame -1 = texture = = 0.500000 vertex 1.0 anim 1.0 1.0 bone
+bone
+frame 1.0 bone texture
+vertex material anim -1 texture 0.500000 frame bone -1 bone bone
+=
+anim anim -1
+0.500000 -1
+mat
\ No newline at end of file
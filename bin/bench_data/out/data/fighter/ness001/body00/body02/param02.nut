@@ -0,0 +1,4 @@
+= 0.500000
+texture vertex 0.500000 material 0.500000 1.0 texture bone 0.500000 -1 1.0 material
+bone = vertex bone
+0.5000
\ No newline at end of file
@@ -0,0 +1,65 @@
+vertex
+frame 0.500000 -1 vertex bone 0.500000 1.0
+= -1 = frame anim bone = = -1 material bone 1.0 texture -1 1.0 texture material
+= = 0.500000 material = bone
+bone
+= material vertex frame
+0.500000 texture bone
+material
+-1 frame frame texture
+0.500000 anim vertex = vertex 0.500000 0.500000
+=
+=
+-1 anim anim frame vertex vertex anim material 1.0 -1 vertex bone 1.0 material bone frame
+0.500000 frame
+material
+texture anim
+0.500000 texture frame anim texture
+= = 0.500000
+1.0
+material vertex frame
+bone -1 0.500000 0.500000 = =
+texture bone anim
+frame anim material = = vertex
+0.500000 -1
+texture
+-1 0.500000 = 1.0 material texture material 1.0 vertex
+material
+frame
+texture 1.0 -1 = frame = 1.0 anim = 1.0
+frame
+material bone
+vertex anim
+texture material
+=
+frame frame =
+0.500000
+texture 0.500000 -1 material material
+0.500000 texture vertex =
+-1
+bone
+= vertex texture texture -1 vertex frame material
+material 0.500000 bone bone = bone bone anim
+= bone
+texture texture 1.0 vertex
+bone -1 0.500000 bone texture vertex vertex material frame anim
+anim = = texture 1.0
+=
+=
+frame bone bone vertex anim material =
+= material -1 1.0 anim vertex frame = = 1.0
+bone frame
+bone =
+-1 1.0 1.0 texture anim anim bone anim
+0.500000
+vertex -1
+material 1.0 0.500000 bone
+material = = bone
+bone -1 texture 0.500000
+anim 0.500000
+0.500000 vertex 0.500000 vertex vertex
+bone frame = material 1.0 = frame 0.500000 material
+material 0.500000
+-1 1.0 texture
+-1 -1 = texture
+bone anim 0.500000 = texture anim -1 0.500000 anim -1 1.0 vertex 1.0
\ No newline at end of file
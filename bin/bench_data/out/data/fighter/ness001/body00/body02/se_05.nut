@@ -0,0 +1,11 @@
+0.500000 = texture vertex frame = bone
+material 0.500000 anim = -1 = 1.0
+bone anim
+anim 0.500000 anim 0.500000 material -1 bone
+material frame -1 0.500000
+vertex
+1.0
+anim 0.500000
+= vertex texture
+bone
+vertex textu
\ No newline at end of file
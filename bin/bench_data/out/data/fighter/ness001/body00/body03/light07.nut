@@ -0,0 +1,8 @@
+texture vertex vertex vertex = -1 1.0 anim -1
+frame 1.0 -1 -1 0.500000 =
+1.0 texture -1 vertex -1
+bone
+1.0 frame anim frame
+1.0
+texture material vertex material 1.0 frame 0.500000
+bone bone -
\ No newline at end of file
@@ -0,0 +1,22 @@
+material anim bone vertex -1 1.0
+0.500000 texture material
+vertex frame bone texture
+texture = texture
+0.500000 = bone =
+bone bone
+1.0 = 1.0 = texture
+1.0
+frame material material
+-1 frame 0.500000
+0.500000 0.500000
+frame anim =
+texture texture
+texture 0.500000 -1 0.500000 bone material texture 1.0 1.0 material material
+= bone = -1
+frame 0.500000 anim 1.0 frame vertex = 1.0 frame bone
+texture
+anim texture bone
+1.0 anim anim 1.0 frame vertex 0.500000 texture frame 1.0
+-1
+bone bone 0.500000 anim 1.0
+-1 frame texture frame texture 1.0 0.50
\ No newline at end of file
@@ -0,0 +1,57 @@
+bone texture 1.0 vertex frame
+texture 0.500000 bone 1.0 texture vertex
+-1 anim material material
+material anim -1 0.500000 frame
+vertex
+material
+-1 -1 texture 1.0 frame
+texture -1 vertex 1.0 0.500000 -1
+vertex 0.500000 vertex frame
+= vertex anim 1.0 anim 1.0 frame
+frame
+texture texture -1 = = texture vertex -1 texture material 0.500000 texture 1.0 frame bone texture = material vertex 0.500000
+material frame 0.500000 -1 bone vertex frame anim 0.500000
+-1 =
+vertex frame
+-1 1.0
+vertex
+vertex bone
+= texture bone bone frame anim
+anim frame
+texture
+vertex
+vertex vertex anim -1 0.500000
+bone material bone
+0.500000 -1 texture anim anim anim
+material bone
+0.500000 frame
+frame texture 0.500000
+vertex = material
+1.0
+texture frame
+-1 material
+vertex
+0.500000 texture 1.0 -1 bone texture
+-1 vertex bone bone bone 1.0 0.500000 material anim 1.0 material vertex frame anim = frame
+anim -1 -1
+vertex bone -1 1.0 material -1
+frame 0.500000 frame
+vertex
+texture
+1.0
+material material texture 0.500000 0.500000 vertex
+vertex -1 -1
+vertex vertex material 0.500000 frame
+anim anim bone -1 texture frame anim
+vertex
+anim bone -1 = texture vertex bone = bone -1 0.500000
+= 0.500000 bone material 1.0 vertex frame
+anim texture material material
+vertex
+vertex
+frame material vertex
+vertex
+material material anim -1 =
+vertex
+texture anim texture
+-1 anim bone texture 
\ No newline at end of file
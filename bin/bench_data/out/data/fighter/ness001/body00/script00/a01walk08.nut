@@ -0,0 +1,44 @@
+material 1.0 0.500000 = anim -1 bone
+1.0 anim 0.500000 vertex =
+texture
+bone bone
+frame -1 bone -1
+anim bone -1
+vertex material
+anim -1 = frame
+bone
+anim anim -1 -1
+frame frame bone bone bone
+anim
+material frame bone bone vertex vertex
+texture
+= =
+vertex
+-1 frame
+anim
+anim frame anim 1.0 texture 1.0
+0.500000 1.0 bone 0.500000 frame
+-1 0.500000
+1.0 material
+frame = anim 0.500000 = -1 anim
+1.0 = frame = vertex
+frame 0.500000 -1 1.0 vertex material frame
+anim frame anim bone
+-1 texture 0.500000
+= material anim material -1
+vertex anim texture
+0.500000 anim 1.0
+= vertex
+1.0 material material anim vertex anim
+= texture vertex texture
+texture texture = 0.500000 0.500000 0.500000 1.0 0.500000
+1.0 bone texture anim anim 0.500000 material
+=
+0.500000 -1 frame =
+= texture
+frame anim
+0.500000 material 0.500000 -1 material
+vertex frame
+bone anim 0.500000 -1 material vertex bone 0.500000 =
+material texture material
+1.0 texture 
\ No newline at end of file
@@ -0,0 +1,41 @@
+vertex -1 0.500000 1.0 -1 anim 1.0 texture
+= = vertex
+0.500000 = bone frame = material
+-1
+anim -1 anim bone anim texture
+0.500000 material
+bone frame frame anim texture = -1
+anim texture bone 1.0 1.0 vertex material
+0.500000 bone texture texture 0.500000 =
+material 1.0 = 1.0 bone
+= bone 0.500000 frame = =
+= material
+frame frame texture frame 0.500000 1.0 -1 material texture = bone
+0.500000 anim 1.0
+bone = bone = 1.0 vertex frame texture vertex
+1.0 bone texture = -1 frame
+frame -1 texture frame
+frame vertex material texture
+0.500000 material -1
+frame 1.0
+texture vertex -1 texture material
+1.0 0.500000 material material
+texture
+-1 = anim bone
+frame
+= frame = =
+0.500000 anim 0.500000 frame vertex frame anim
+-1 -1 0.500000
+texture material
+frame 0.500000
+0.500000 material bone bone texture anim bone -1 0.500000 1.0
+texture =
+anim
+bone -1 bone
+0.500000
+frame
+1.0
+0.500000
+texture
+-1
+0.500000
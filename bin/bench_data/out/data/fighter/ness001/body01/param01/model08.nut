@@ -0,0 +1,65 @@
+0.500000 frame 0.500000 bone vertex -1 frame material vertex 1.0 1.0 bone -1 frame texture 0.500000
+texture -1 material frame
+1.0 texture 0.500000 = anim material 0.500000 bone frame -1
+anim frame 1.0
+= vertex anim anim
+material
+=
+frame texture bone
+bone
+vertex vertex bone
+-1
+material
+1.0 -1 material
+anim 0.500000
+0.500000 = texture bone material 1.0 frame -1 1.0 material
+= texture 1.0
+vertex 1.0 0.500000 material anim material
+=
+anim bone material material texture = frame anim frame
+vertex anim
+= texture
+anim bone material 1.0
+vertex 1.0 frame
+= texture -1 0.500000 vertex
+anim 0.500000
+frame
+frame anim material bone frame texture
+texture
+material -1 = = material material 1.0 = 0.500000 frame
+material anim
+-1
+frame material 1.0 material vertex 1.0 vertex frame 0.500000
+anim 1.0 -1 anim texture vertex
+0.500000 anim vertex texture bone -1 = anim 0.500000 1.0 bone anim = material vertex 0.500000
+frame -1 texture
+frame bone texture material
+material -1
+-1 0.500000
+frame material
+1.0
+texture 1.0 anim anim vertex frame bone
+bone 0.500000 frame = 0.500000 material anim -1 frame 0.500000 bone
+frame -1
+= = bone -1 vertex 1.0 anim 0.500000 0.500000
+material material
+anim vertex 0.500000 material
+bone frame material -1 = -1
+material -1 =
+anim
+material = anim
+-1 anim vertex
+material 1.0 texture
+1.0
+0.500000 0.500000
+material
+texture anim
+1.0 1.0 0.500000 frame anim texture 1.0 material 0.500000 bone texture = anim frame
+anim 0.500000
+0.500000 anim
+texture frame -1 = vertex = -1 = vertex frame texture texture texture = anim 1.0 -1 1.0 frame =
+texture 0.500000 texture
+frame 0.500000 vertex material bone bone
+0.500000 0.500000 material texture bone vertex
+1.0
+vertex
\ No newline at end of file
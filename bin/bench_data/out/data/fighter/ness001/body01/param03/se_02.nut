@@ -0,0 +1,10 @@
+= anim = =
+-1 1.0 0.500000 texture 0.500000 frame 0.500000
+1.0 -1 vertex anim frame vertex
+frame
+material material = texture bone = = vertex
+0.500000 anim
+texture
+1.0 1.0 frame -1
+texture frame 1.0 -1
+ve
\ No newline at end of file
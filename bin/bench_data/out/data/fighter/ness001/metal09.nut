@@ -0,0 +1,20 @@
+vertex
+=
+material material vertex vertex material texture material
+anim anim
+frame 0.500000 bone bone -1 =
+= texture 0.500000 = material vertex 0.500000 -1 1.0 1.0
+1.0 vertex
+frame texture
+material = anim anim material material
+bone
+-1 bone anim bone
+-1 -1
+anim
+anim -1 = 1.0 -1 bone
+= vertex = 1.0
+texture
+material anim 1.0 = texture =
+bone
+texture frame
+texture texture
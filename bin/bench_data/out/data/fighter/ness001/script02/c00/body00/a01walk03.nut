@@ -0,0 +1 @@
+LW^d{jջR,<{{5X*
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex
+= 0.500000 anim material mate
\ No newline at end of file
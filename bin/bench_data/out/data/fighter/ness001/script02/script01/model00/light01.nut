@@ -0,0 +1,33 @@
+texture 1.0 frame
+0.500000 = -1 material = anim frame
+texture -1 anim 0.500000 -1 texture -1 frame = -1
+texture 1.0
+0.500000 vertex 0.500000 material vertex frame bone 1.0 1.0 anim 1.0 -1 frame vertex = texture frame =
+vertex bone =
+anim 1.0 material 1.0 0.500000 = anim -1
+vertex texture vertex anim -1 texture
+anim
+-1 frame vertex bone 1.0 bone = -1 0.500000 0.500000 frame anim = bone -1 frame vertex anim frame material
+-1 frame anim
+vertex
+texture
+= bone bone
+frame 1.0 -1
+= = anim vertex 0.500000 bone
+frame material
+vertex -1 -1 texture vertex 1.0 material 0.500000 1.0 0.500000 -1 -1 texture
+texture
+material vertex texture 1.0 bone
+1.0 frame = -1 vertex frame
+= frame material vertex
+texture = material texture
+anim
+1.0
+anim -1 1.0 1.0
+material vertex
+material material 1.0 anim material texture
+material -1
+anim bone
+= vertex vertex = anim 1.0 0.500000 frame
+frame anim vertex anim 1.0
+ve
\ No newline at end of file
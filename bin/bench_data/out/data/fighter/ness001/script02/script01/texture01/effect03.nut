@@ -0,0 +1,119 @@
+bone = -1 0.500000 0.500000
+-1 frame 0.500000
+-1 frame
+anim -1 material
+bone
+frame frame anim
+material
+material frame
+anim texture -1 anim anim material texture
+vertex 0.500000 vertex bone 1.0 material
+1.0
+frame
+= bone bone 0.500000 vertex anim
+frame
+bone bone
+bone 1.0
+-1 1.0 anim texture 1.0 -1 = =
+0.500000 anim anim
+-1 anim frame anim texture anim -1 -1 material anim = bone anim -1
+texture
+vertex anim 1.0 frame vertex
+texture
+bone bone texture 1.0 bone -1 vertex
+material bone 1.0 vertex texture
+anim
+bone 0.500000 frame bone = material
+material -1 anim material =
+1.0
+bone texture = frame -1 texture anim vertex 0.500000
+0.500000
+1.0 1.0 material frame 0.500000 texture 1.0 bone =
+texture material 0.500000
+anim
+texture
+frame bone 0.500000 vertex frame material -1 -1 = = frame texture frame vertex
+anim anim frame
+= anim 1.0 -1 material bone frame bone frame anim
+vertex bone =
+anim
+0.500000 vertex
+vertex bone material material
+vertex
+bone bone vertex material
+vertex
+material texture texture texture =
+vertex = frame =
+frame -1
+frame 1.0
+0.500000 bone vertex 0.500000
+texture =
+texture material anim material 0.500000 bone
+material
+frame texture
+frame 0.500000 -1 0.500000
+anim
+bone anim -1 1.0
+vertex -1 1.0
+vertex material
+texture
+1.0 anim anim -1 vertex material 0.500000 material
+= =
+anim texture
+-1 -1 anim 0.500000 texture
+0.500000 -1 = texture 1.0 1.0 0.500000 -1 0.500000
+vertex
+= = vertex bone =
+anim anim texture = vertex material
+bone 1.0
+-1
+anim =
+material material texture = texture vertex
+frame frame -1 =
+anim vertex vertex -1
+0.500000
+bone 1.0 vertex = 0.500000
+frame bone = material texture -1 texture vertex frame -1
+1.0
+anim vertex anim = anim bone texture vertex vertex -1 1.0 = material
+1.0 = vertex 0.500000
+bone
+-1 material = texture frame
+0.500000 1.0 = anim frame texture anim
+material bone
+texture 0.500000 vertex bone anim anim vertex texture material frame
+-1 frame vertex vertex 1.0 material frame frame
+vertex bone frame vertex 0.500000 texture = vertex 1.0 bone
+material
+0.500000 bone bone anim 1.0 =
+vertex
+anim 0.500000 bone
+0.500000 anim = 1.0
+1.0 0.500000 texture 1.0 -1 material -1 = = texture 1.0 1.0
+frame = vertex -1
+frame texture
+0.500000 0.500000
+texture 1.0 frame
+1.0 vertex
+frame
+anim
+material anim
+-1 = vertex -1 texture material bone 0.500000 frame vertex vertex 1.0 anim vertex 0.500000 = -1 frame 0.500000 frame
+=
+bone bone frame
+frame bone
+-1 frame
+material 0.500000
+texture = material bone vertex = 1.0 material anim texture texture material
+-1
+vertex 1.0 anim
+=
+bone 0.500000
+=
+0.500000 -1 -1 anim texture vertex
+frame
+anim bone
+= anim 1.0 vertex
+-1 material
+material anim -1 vertex frame
+anim 0.500000 frame 
\ No newline at end of file
@@ -0,0 +1,195 @@
+vertex bone -1 1.0 frame
+texture =
+vertex =
+1.0 -1
+-1 bone frame
+frame 1.0 1.0 texture vertex bone texture -1 frame
+1.0
+bone anim 1.0 material anim 1.0 1.0
+= = texture 1.0 anim
+-1 anim bone = -1 vertex texture = bone -1 1.0 1.0
+1.0 vertex anim
+frame vertex = bone =
+bone anim = anim
+texture
+anim bone texture
+= frame 1.0
+material
+texture 0.500000 0.500000 0.500000
+0.500000 anim =
+vertex
+= = 0.500000
+material vertex
+vertex vertex 1.0 -1 frame
+vertex
+0.500000 0.500000 frame
+vertex
+0.500000 bone
+0.500000 vertex bone anim bone anim material
+texture =
+= bone
+1.0 -1
+-1
+frame bone vertex bone
+texture anim frame 1.0
+0.500000 0.500000 1.0
+anim 1.0 material
+vertex 1.0 texture 0.500000
+1.0 0.500000 0.500000 -1
+material material 1.0 anim anim
+-1 1.0
+material
+texture 1.0 vertex texture vertex
+frame anim -1 -1 texture 1.0 1.0 anim vertex anim =
+anim texture material
+1.0
+bone 1.0
+vertex anim
+0.500000 1.0 -1 bone texture vertex material anim 0.500000 1.0 0.500000 -1 frame
+= 1.0 material material frame 0.500000 = 0.500000 frame bone
+0.500000 = = material frame 1.0
+bone frame -1 bone 0.500000
+bone =
+frame frame texture
+texture
+= bone 0.500000 bone material bone vertex vertex bone vertex
+frame anim
+0.500000
+1.0
+bone vertex vertex 0.500000
+0.500000
+anim -1
+= bone
+bone
+= = vertex 0.500000 1.0
+vertex frame vertex -1 frame bone
+frame
+frame vertex 0.500000 texture vertex 0.500000 -1 -1 bone = -1
+vertex anim 1.0
+= vertex
+1.0 material 1.0
+= anim bone material
+anim frame -1 material
+-1 vertex anim 1.0
+1.0 = bone
+vertex material frame 1.0 = -1 0.500000 = 0.500000
+material material bone anim anim = anim
+0.500000
+-1
+-1 frame -1 0.500000 frame -1 -1
+-1 bone frame frame texture vertex material -1 vertex
+texture -1
+vertex
+frame frame material
+-1 1.0
+anim anim material = material vertex material vertex = bone anim
+= vertex texture material anim material
+1.0
+0.500000
+texture anim 0.500000
+texture material anim bone
+vertex vertex
+anim 0.500000
+bone bone 1.0
+-1 bone -1 1.0 -1
+bone bone
+vertex
+texture frame 0.500000 anim 1.0
+1.0 0.500000 anim = frame
+1.0 bone frame anim vertex frame frame = -1 material 0.500000 bone
+anim 1.0 bone
+0.500000
+texture frame 0.500000 anim 1.0
+vertex
+-1 -1
+texture vertex = vertex anim -1
+bone 0.500000 texture material 1.0 texture anim anim material bone texture
+anim texture bone material
+-1 bone vertex
+1.0 vertex
+0.500000 texture frame anim anim = frame anim 1.0 frame 0.500000
+0.500000
+0.500000 = 1.0 vertex material bone
+0.500000 frame = material frame =
+bone -1
+material
+vertex 0.500000 material bone
+anim
+1.0 frame anim frame material
+anim
+bone
+material
+1.0 bone vertex -1 texture texture = -1 material material 0.500000 vertex anim material bone vertex anim material bone vertex = 0.500000 =
+-1 -1
+1.0 -1 1.0
+-1 texture =
+material 0.500000
+material anim
+texture frame texture vertex material
+texture bone bone
+-1
+frame
+= = anim frame
+frame 0.500000 = 1.0
+anim material material 1.0
+frame
+material
+vertex texture texture bone vertex
+-1 -1 texture 1.0
+frame 0.500000 frame -1
+texture
+= -1
+material = frame = frame frame material
+vertex
+bone
+texture -1 texture material
+anim 1.0
+vertex vertex -1 vertex frame vertex 1.0
+0.500000
+0.500000 bone material material
+0.500000 1.0 anim = texture
+vertex frame -1 0.500000 vertex material anim 0.500000 = anim bone
+vertex -1 vertex
+material = frame texture material 0.500000 material texture frame material frame 0.500000 1.0
+vertex bone -1 material
+-1 = =
+1.0
+bone bone =
+material
+0.500000 texture
+texture
+1.0
+frame
+frame texture material 0.500000 = bone texture 1.0
+anim bone
+bone vertex material texture 0.500000 texture material
+material material
+1.0 0.500000 anim 0.500000 -1 texture =
+bone material 0.500000 1.0 0.500000 texture material 1.0 = vertex = frame -1
+-1 material texture anim material
+frame 1.0 frame anim
+-1 bone vertex 1.0 0.500000 0.500000
+frame
+material
+-1 0.500000 0.500000 vertex 0.500000 frame
+texture 1.0 bone
+anim frame
+0.500000 texture
+-1 material bone 1.0 0.500000 anim vertex
+bone
+-1 texture material anim bone texture bone
+frame 0.500000
+bone 1.0 frame 1.0 0.500000 -1 anim
+0.500000 0.500000
+vertex bone texture -1 -1 0.500000
+bone texture bone
+1.0 0.500000
+vertex texture anim
+material vertex
+0.500000 0.500000 texture
+1.0
+vertex frame vertex material -1 material bone vertex -1
+material bone texture 0.500000 material
+0.500000
+anim material = 1.0 anim
+bone frame bone ma
\ No newline at end of file
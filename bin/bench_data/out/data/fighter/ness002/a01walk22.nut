@@ -0,0 +1,58 @@
+material
+material
+vertex 1.0 material bone anim
+bone texture -1 0.500000 anim material = anim texture texture 0.500000 0.500000 1.0 = bone texture -1 vertex vertex bone
+bone frame
+anim 1.0 material texture = -1 vertex
+texture frame 1.0
+frame
+vertex bone vertex
+1.0 frame texture vertex texture
+texture vertex = = anim vertex bone
+anim bone bone material bone -1
+anim bone 0.500000 texture -1 = = -1 = 1.0
+anim = -1 texture = anim 0.500000 1.0 -1 bone frame bone material
+frame
+texture material -1 bone = 0.500000 anim vertex material 0.500000 vertex
+0.500000 material 1.0 -1 frame vertex
+material 0.500000
+0.500000
+material =
+material anim anim -1 vertex bone 1.0
+vertex material texture = = anim = 0.500000 -1 material 1.0 anim anim 1.0 texture material
+0.500000 -1 1.0 -1
+material anim anim 1.0 =
+-1
+= = =
+1.0 anim vertex
+anim = anim
+bone frame = 1.0
+0.500000 texture = 1.0
+1.0 anim texture material bone anim
+frame anim -1
+vertex 0.500000 -1
+bone frame vertex =
+1.0 -1 -1 bone texture
+frame frame vertex anim
+anim frame frame texture -1 material
+bone bone
+1.0
+frame anim -1 1.0
+1.0 =
+texture bone = 0.500000 material material
+frame
+1.0 anim 0.500000 anim = bone
+bone
+= -1
+frame frame texture -1 material bone material texture 1.0
+bone
+material
+= vertex
+1.0 material vertex bone
+= texture frame anim bone
+1.0 texture 0.500000 bone
+= vertex
+vertex anim bone anim
+bone texture 1.0
+0.500000 bone vertex =
+0.
\ No newline at end of file
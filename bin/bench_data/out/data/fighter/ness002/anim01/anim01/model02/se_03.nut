@@ -0,0 +1,15 @@
+0.500000
+frame anim vertex
+bone
+frame bone anim texture
+1.0 = texture
+vertex
+1.0
+0.500000 bone
+anim 1.0
+frame material frame = = frame vertex =
+0.500000
+-1 bone anim =
+anim 0.500000 1.0 anim = vertex
+frame
+0.500000 texture =
\ No newline at end of file
@@ -0,0 +1,76 @@
+0.500000 = = 0.500000 = 1.0 frame
+1.0 texture 0.500000 vertex anim texture bone frame bone 1.0
+1.0
+texture frame 0.500000 vertex 0.500000 vertex
+anim vertex frame anim anim 1.0 = -1 vertex 1.0 1.0 0.500000 texture material material = 0.500000 -1 0.500000 texture 0.500000 texture bone -1 anim = -1 vertex 1.0
+0.500000
+material = vertex frame 0.500000 material
+= texture 0.500000 0.500000
+vertex -1 frame
+1.0 1.0 frame
+texture texture
+-1 vertex frame 1.0
+material frame
+vertex
+vertex = material
+-1 0.500000 = bone vertex vertex
+anim
+anim anim bone 1.0
+texture 1.0 =
+frame bone vertex frame vertex 1.0 anim = texture -1 =
+= vertex
+frame bone
+1.0
+bone
+texture material = anim = texture -1 vertex frame bone =
+-1 -1
+frame vertex texture
+bone
+= texture texture
+-1
+texture
+frame 0.500000 frame -1 1.0 =
+0.500000 frame bone -1
+material -1 bone material frame texture 1.0 anim 0.500000 1.0 = 0.500000 material 1.0 anim anim 0.500000 -1
+texture
+anim = vertex
+= 1.0 vertex texture
+= 1.0 texture 0.500000 = texture 1.0
+-1 anim -1
+frame
+1.0 frame 1.0 1.0 material 0.500000 anim
+frame
+0.500000 frame frame
+vertex -1 = vertex
+-1 0.500000 frame vertex =
+texture = = material frame
+vertex 1.0 0.500000 frame
+vertex anim anim anim texture vertex vertex frame -1
+-1
+0.500000 -1 0.500000 = frame 1.0 -1 bone texture vertex
+texture frame frame
+0.500000 texture = frame
+0.500000
+anim -1 bone bone frame anim frame 0.500000 =
+-1 material frame texture vertex texture
+frame anim bone
+-1 bone bone -1
+= =
+frame
+0.500000 vertex anim = frame texture 1.0 bone
+vertex vertex anim
+=
+vertex
+frame 1.0 bone frame material
+1.0
+anim
+anim vertex
+0.500000 bone 0.500000 texture = = 1.0
+-1
+frame -1
+anim frame 1.0 anim material
+bone 0.500000 = anim material vertex
+=
+0.500000
+0.500000
+1.0 vertex -1 vertex 1.0 0
\ No newline at end of file
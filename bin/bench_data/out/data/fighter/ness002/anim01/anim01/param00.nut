@@ -0,0 +1,115 @@
+material
+anim bone anim 1.0 0.500000 vertex texture bone anim vertex frame anim vertex -1
+1.0 vertex
+vertex bone texture = frame
+1.0 material vertex bone vertex =
+vertex
+texture 0.500000 vertex bone
+1.0 1.0 texture vertex
+material
+=
+frame
+frame -1
+anim anim anim -1 bone -1 -1 anim 0.500000 = 0.500000 -1 bone texture texture
+0.500000 frame
+-1 1.0 texture
+bone 1.0 0.500000
+frame material
+vertex frame bone 0.500000 = frame 0.500000 =
+1.0 frame 0.500000 frame texture = 1.0 anim texture
+-1 1.0 1.0 vertex
+texture 0.500000 frame -1 bone = vertex = -1
+-1 =
+frame -1 = vertex -1 material 1.0 1.0 0.500000 frame material texture 0.500000
+=
+texture anim
+anim 0.500000
+1.0 -1 material frame vertex frame -1 texture anim
+= 1.0 anim material frame
+vertex
+1.0 =
+frame
+1.0
+bone = texture vertex anim 0.500000 vertex bone texture
+frame = -1 1.0 0.500000 frame
+frame 1.0 anim material material material
+-1 bone vertex material bone -1
+anim = =
+frame
+anim =
+=
+-1 vertex bone
+0.500000 0.500000 anim anim bone = =
+anim
+vertex bone 0.500000 0.500000 0.500000 texture frame vertex 0.500000 1.0 -1 1.0 texture frame = vertex
+material
+material =
+0.500000
+material anim
+1.0 -1 = vertex 1.0
+material -1 vertex = -1 frame bone 1.0
+1.0
+anim texture
+anim anim = 0.500000 = texture 0.500000 0.500000 vertex 1.0 anim
+1.0 1.0
+frame
+texture
+anim anim texture bone anim
+=
+1.0 vertex
+1.0
+vertex texture 1.0 material -1 texture
+texture
+1.0
+texture
+frame bone material vertex 0.500000 texture 1.0
+bone
+frame = frame -1
+material
+frame
+=
+0.500000
+0.500000 anim -1 bone bone 1.0 anim
+texture
+material
+anim 1.0 = anim material anim vertex anim texture
+vertex 1.0 material bone frame
+-1 material 0.500000 texture 0.500000
+-1 material 1.0
+texture bone -1 material bone -1
+-1 vertex anim vertex = texture material bone -1 texture texture 0.500000
+0.500000 anim 1.0
+frame
+-1 material -1
+anim texture
+= 0.500000 texture anim 1.0 = vertex 0.500000 anim texture 0.500000 bone vertex 1.0
+frame -1
+= material bone frame texture -1 bone
+0.500000 1.0 texture anim
+texture
+anim anim bone
+anim 1.0 -1
+frame material 1.0
+-1
+vertex -1 0.500000 anim anim anim
+0.500000
+= frame
+material
+-1 = -1
+= frame
+texture
+frame material 1.0 -1 frame frame 1.0 vertex bone 0.500000 vertex -1
+anim
+-1
+1.0 material material material anim 0.500000 frame bone bone frame 0.500000 anim bone frame anim 0.500000 -1 bone 0.500000 frame vertex bone anim
+anim frame texture
+anim 0.500000 -1 1.0 -1 frame 0.500000 material
+= vertex -1 material vertex anim
+0.500000 anim
+0.500000
+= bone 1.0
+material
+= texture frame = bone
+-1
+0.500000
+material material verte
\ No newline at end of file
@@ -0,0 +1,57 @@
+texture 0.500000 material
+texture = -1 material texture bone
+material 1.0 -1 -1 frame vertex material bone 1.0 texture 1.0 material 1.0 = material -1 0.500000 -1 = bone material
+anim
+-1
+anim material
+material vertex vertex material 1.0
+1.0 -1 -1 anim -1
+1.0 material material
+bone =
+material vertex 1.0 material = bone = -1 -1
+1.0 frame -1
+vertex
+anim
+-1 material
+anim vertex 0.500000 texture anim 1.0
+1.0 frame 0.500000 vertex
+0.500000 material 0.500000
+0.500000 anim -1 1.0 -1
+bone
+material frame frame vertex anim vertex -1 texture anim bone vertex 0.500000 frame anim material = material material material
+texture frame
+1.0 0.500000 anim texture
+texture vertex
+anim frame anim frame vertex -1 frame bone 1.0
+= material -1 -1
+anim 0.500000 material =
+anim frame frame vertex 1.0 bone
+anim bone material bone
+vertex -1 frame frame
+material material =
+material material anim vertex bone 0.500000 =
+0.500000 material frame vertex -1
+= material
+bone = frame texture anim
+texture anim vertex = anim -1
+texture -1 1.0 1.0 -1 bone
+bone texture
+material
+1.0 1.0 bone bone -1 -1 anim frame
+-1
+-1 1.0 1.0 1.0 texture anim frame
+material 0.500000 texture material material -1
+bone bone vertex
+vertex 0.500000 1.0 texture
+0.500000 1.0 anim
+bone
+anim vertex material anim
+anim frame material bone
+material bone
+vertex material texture
+frame material texture -1
+texture vertex frame
+bone material material anim anim = vertex bone bone -1 frame
+anim
+0.500000
+bone 
\ No newline at end of file
@@ -0,0 +1,157 @@
+-1 bone frame 0.500000 anim material
+-1
+=
+frame
+frame frame
+material = vertex -1 anim
+bone -1
+0.500000 vertex 0.500000 frame 0.500000 material
+frame -1 frame material anim bone
+vertex 1.0 bone 0.500000 vertex 0.500000 material frame 0.500000
+material -1 0.500000 1.0 0.500000 1.0
+vertex bone vertex
+0.500000
+frame
+material frame -1 -1 bone texture
+bone
+anim -1
+frame material
+bone anim = 0.500000 -1
+0.500000 frame frame
+0.500000 texture 1.0 0.500000 1.0 frame -1 texture bone -1
+bone bone anim
+= -1
+bone
+anim
+1.0 material frame vertex = = 0.500000 vertex
+-1 bone 1.0 bone material texture texture vertex 0.500000
+anim texture texture -1
+bone texture frame = vertex 0.500000 bone
+-1 anim 0.500000 frame vertex vertex
+vertex
+texture = 1.0 =
+1.0 = 0.500000 =
+material
+0.500000
+=
+material 0.500000 bone -1
+anim frame = -1 texture
+anim bone texture material anim anim texture anim
+anim vertex texture
+vertex 1.0
+vertex -1 material vertex
+0.500000 1.0 vertex vertex material material bone material material
+bone bone vertex bone -1 texture 0.500000 bone material =
+material
+material material frame anim -1
+anim -1
+0.500000 1.0 texture 0.500000 texture 0.500000
+bone bone
+= anim -1 bone vertex 1.0 0.500000 frame vertex material
+bone 0.500000
+texture = material vertex frame -1
+bone bone bone material
+1.0
+bone 1.0 -1 texture -1 vertex
+= texture 0.500000 texture
+0.500000
+0.500000 bone material anim material bone bone vertex -1 texture = = -1 anim frame
+frame
+= frame
+0.500000 vertex -1 vertex
+0.500000 bone
+texture
+vertex anim 1.0 1.0 -1 material 1.0 -1 vertex 1.0 bone -1
+0.500000
+texture
+frame anim
+vertex 0.500000
+frame bone
+bone anim
+0.500000
+vertex texture material 0.500000 0.500000 0.500000
+material
+texture anim
+material 0.500000 bone bone
+texture
+1.0 1.0 material
+frame 1.0 vertex vertex anim bone frame -1 material
+frame anim material
+= bone
+frame
+frame
+-1
+0.500000
+=
+= vertex material
+material -1 vertex material anim
+0.500000
+anim = texture -1 0.500000 bone frame
+material -1 frame texture frame
+texture anim frame anim 0.500000 material 0.500000 material anim vertex = 1.0 vertex frame 0.500000 1.0 frame
+1.0 =
+1.0
+vertex frame bone
+0.500000 anim texture
+1.0 0.500000 anim anim bone -1 vertex anim vertex anim bone = vertex
+1.0
+texture -1 frame bone
+0.500000 1.0
+anim frame vertex vertex 0.500000 1.0
+-1
+-1 texture = bone anim vertex texture 1.0 -1 bone 0.500000 = 1.0 1.0 frame
+= anim bone bone
+-1 texture anim
+-1
+=
+=
+0.500000 0.500000 1.0 = vertex anim texture anim
+bone frame
+texture 0.500000 material bone
+-1 -1 1.0 bone texture vertex
+frame vertex 1.0 1.0 material 0.500000
+=
+-1 1.0
+-1 texture
+=
+material bone
+bone texture texture frame
+vertex -1 0.500000 1.0 vertex bone bone
+material material vertex 0.500000 material 1.0
+1.0 1.0 1.0 0.500000 vertex = 1.0 0.500000
+frame texture frame
+vertex
+bone 1.0
+=
+1.0 anim
+-1
+bone vertex texture 0.500000 material frame bone bone vertex frame bone
+bone bone bone
+vertex
+frame anim 1.0 bone vertex bone anim
+material bone anim vertex 1.0 frame 0.500000 material frame frame vertex texture bone 0.500000 1.0 frame bone bone
+anim 1.0 vertex
+1.0 texture =
+0.500000 anim texture vertex material texture bone frame
+bone
+bone material
+frame vertex bone
+material anim
+1.0 anim
+vertex
+material
+material bone texture -1
+frame
+bone 0.500000 vertex = vertex -1
+bone texture texture bone
+vertex 0.500000 material 0.500000 anim texture anim
+= 0.500000 = -1 material vertex material frame
+vertex anim
+1.0 frame -1
+bone
+frame 0.500000 vertex texture
+vertex frame -1
+material
+0.500000 vertex
+1.0 material
+0.5000
\ No newline at end of file
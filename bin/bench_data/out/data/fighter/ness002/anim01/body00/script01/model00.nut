@@ -0,0 +1,69 @@
+bone vertex = -1 0.500000 vertex material = vertex -1 frame =
+0.500000 -1
+=
+bone -1 anim vertex 0.500000
+bone anim anim material frame -1 0.500000 vertex
+= vertex bone = vertex anim
+bone 0.500000 texture texture vertex 1.0
+0.500000
+vertex anim anim vertex -1 texture vertex
+= = material 1.0 frame
+frame
+material bone
+bone frame vertex texture -1
+material
+vertex 0.500000 -1 1.0 0.500000
+-1
+texture texture anim
+anim 0.500000 1.0 1.0 = 1.0 frame material
+vertex frame texture material 1.0 bone anim frame -1
+= -1 -1
+1.0 vertex
+frame 1.0 frame bone -1 -1 -1 vertex
+-1 texture = anim 0.500000 0.500000 texture bone 1.0 material material texture texture frame
+texture material
+bone
+vertex = -1 -1 = frame bone
+bone frame frame 1.0 0.500000 anim = 0.500000 1.0 material = 1.0 bone
+material
+=
+-1 material anim frame anim anim texture 1.0 frame frame
+material -1 0.500000 anim
+vertex
+bone -1 material frame frame anim = -1 -1
+vertex 0.500000 -1
+frame bone bone 0.500000 material -1 material
+bone
+frame bone vertex
+0.500000 texture anim texture material frame
+texture
+anim material bone 1.0
+texture
+texture vertex
+anim 1.0 = -1 = -1 1.0
+1.0 -1 frame -1 -1 anim anim =
+vertex 0.500000
+vertex 1.0 bone = material -1 frame vertex material
+1.0 0.500000 vertex
+0.500000 bone
+=
+vertex 0.500000 vertex material texture 0.500000 0.500000
+material
+1.0
+1.0 0.500000 0.500000 texture vertex material anim material 0.500000 1.0 -1 bone -1
+bone = = material 1.0 0.500000 frame frame = texture texture 0.500000 bone = -1 material 0.500000 vertex material anim vertex 0.500000 material bone -1 bone anim
+texture vertex
+0.500000
+material material
+1.0 1.0 -1 bone 1.0 1.0 anim -1 1.0 bone frame 0.500000 anim material -1 frame bone vertex 1.0 bone material vertex bone
+frame
+0.500000 material -1
+anim 0.500000 material
+material frame vertex texture
+-1 texture
+1.0 frame 1.0 -1 texture 0.500000
+anim
+frame =
+-1 material 0.500000 vertex
+vertex anim frame -1 material 0.500000 frame material
+1.0 material bone bone texture 1.0 vertex material = frame anim = anim texture texture frame 1.0 -1
\ No newline at end of file
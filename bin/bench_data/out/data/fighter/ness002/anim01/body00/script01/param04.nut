@@ -0,0 +1,56 @@
+material material texture -1 anim frame bone anim bone = 0.500000 = bone 1.0 -1
+anim
+vertex bone
+frame anim -1
+-1 = = texture texture bone
+anim bone material
+0.500000
+texture anim bone
+-1 material
+-1 -1
+frame vertex material frame 1.0 1.0 bone
+0.500000 anim vertex
+anim
+-1 material texture -1
+-1
+= 0.500000 material -1 0.500000 vertex
+= frame vertex
+0.500000 bone
+bone material anim bone texture 1.0
+material vertex 1.0 -1 0.500000 =
+vertex anim -1
+-1
+-1 bone
+-1 frame
+bone bone = -1 0.500000
+anim 1.0 1.0
+= 1.0 bone texture vertex texture
+material bone = vertex texture 0.500000
+= 0.500000 1.0
+-1
+bone -1
+vertex 1.0
+=
+bone vertex anim material
+vertex frame
+-1
+frame 1.0 anim material = 0.500000 = 1.0 vertex
+anim 0.500000 anim 1.0 texture -1 0.500000 vertex 0.500000 1.0 0.500000 0.500000 anim
+1.0 = texture
+texture frame texture material vertex
+texture 1.0 texture
+frame texture
+-1 frame material
+anim frame
+frame
+anim vertex vertex frame
+1.0
+1.0 anim vertex frame 1.0
+texture anim 1.0 anim texture
+1.0 vertex 1.0 1.0 =
+material
+vertex 0.500000 0.500000 -1
+frame
+= bone material 0.500000 bone vertex 1.0
+material = 1.0
+= 0.500000 1.0
\ No newline at end of file
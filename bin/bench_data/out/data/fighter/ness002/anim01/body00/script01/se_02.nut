@@ -0,0 +1,138 @@
+material frame texture material frame -1 = -1
+= vertex bone bone vertex
+vertex
+vertex bone
+anim anim material 1.0 texture anim bone
+texture bone anim texture 1.0 material bone frame
+0.500000 bone = = texture 1.0 1.0 material -1 frame
+frame bone
+texture
+vertex -1 = -1 = -1 material texture 0.500000 = material material
+material bone 0.500000
+frame 1.0 frame frame -1 frame frame anim 0.500000 bone frame frame -1 = = material -1 texture
+-1 texture 0.500000 bone
+1.0
+-1 texture = frame texture material 0.500000 vertex anim vertex vertex material 0.500000 -1
+= 1.0
+0.500000 1.0 0.500000 bone -1 frame bone 0.500000 -1
+-1 bone
+bone vertex texture 1.0
+frame bone
+0.500000 = material 1.0 1.0
+0.500000 0.500000
+= 0.500000 = vertex
+=
+vertex texture
+anim vertex frame 1.0 texture anim -1 -1 anim -1 1.0 frame frame bone
+texture frame
+material 0.500000
+0.500000
+1.0 material -1
+texture
+material 0.500000 anim material
+-1
+vertex 0.500000 material texture
+-1 -1 material texture = 0.500000 -1 0.500000
+vertex vertex texture -1 = anim material -1
+vertex material material = -1 material
+0.500000 1.0 bone texture 1.0 -1 anim material anim 0.500000 0.500000 -1 vertex
+texture anim frame anim
+-1 bone 1.0 anim material -1 frame =
+-1
+0.500000
+anim material
+-1 material anim =
+-1 vertex -1 vertex anim
+= 1.0 -1 1.0 bone
+-1 -1 frame 1.0 frame =
+1.0 0.500000 texture
+bone
+anim
+vertex =
+0.500000 = 0.500000 vertex texture 1.0
+frame -1 frame
+anim
+0.500000 texture material vertex vertex frame
+-1
+frame material material
+vertex anim 0.500000 1.0 = 1.0
+vertex vertex frame
+material frame frame -1
+-1 1.0 =
+bone material vertex
+= vertex 1.0 frame material 1.0 0.500000 1.0
+vertex bone bone =
+1.0 1.0 anim texture vertex anim -1 -1
+0.500000 frame anim vertex texture = bone
+1.0 frame frame 1.0 0.500000 texture frame bone frame
+bone frame material = = 1.0
+anim =
+texture 0.500000 material -1
+material bone
+material 1.0 bone material texture
+0.500000
+material anim
+0.500000 vertex = = 1.0
+anim texture = frame
+0.500000
+bone texture anim frame anim = material
+vertex 0.500000
+0.500000
+bone bone
+-1 material bone vertex bone 1.0 frame material 0.500000 -1 texture texture
+-1 1.0 frame frame bone bone texture -1
+frame 1.0 texture -1
+vertex
+= frame = 1.0 = -1 material texture vertex texture
+texture frame material material texture
+vertex vertex anim vertex 0.500000
+-1 1.0 = 1.0 anim 0.500000 texture frame texture texture
+anim vertex vertex texture texture bone bone 0.500000 vertex material
+1.0
+texture bone texture
+material anim frame material
+anim
+anim = anim bone 1.0 material =
+1.0 -1 vertex 1.0 frame 0.500000 material vertex 1.0 1.0 vertex anim anim texture
+material =
+texture
+vertex texture texture material = material
+-1 texture
+anim texture
+1.0 -1 anim
+bone bone
+0.500000 vertex 0.500000 -1 frame texture 0.500000 anim vertex 1.0 0.500000
+material
+anim 1.0 frame -1 vertex
+material = material = bone frame 1.0
+vertex anim
+vertex vertex
+material frame 0.500000 bone frame
+-1
+anim -1 anim -1 material texture texture 1.0
+frame
+material = material material
+texture material material frame
+anim = =
+vertex -1 0.500000 = = material
+material frame
+texture bone = bone
+1.0 bone -1 frame frame = anim texture material
+frame 1.0 -1
+texture texture 1.0 vertex
+bone 0.500000
+-1 frame vertex 0.500000 material material -1 -1 0.500000 0.500000
+material -1
+texture bone
+= -1 -1 1.0
+material
+anim frame anim vertex bone
+material vertex bone 1.0 0.500000
+-1
+-1 frame material 1.0
+vertex
+bone
+anim -1 0.500000 frame 1.0
+bone texture
+anim 1.0 frame material texture
+0.50000
\ No newline at end of file
@@ -0,0 +1,25 @@
+bone bone
+-1
+material material =
+-1 anim frame -1 vertex bone frame anim 0.500000 vertex
+=
+-1 frame material
+texture vertex bone
+0.500000 = bone bone texture -1
+frame anim material vertex
+frame bone
+=
+= frame = material
+vertex frame anim
+material vertex frame -1 0.500000 material =
+anim -1 texture material 0.500000 texture
+bone bone 0.500000 texture -1 =
+anim
+material material anim
+= -1 1.0 anim bone 0.500000 material
+frame
+texture
+1.0 1.0
+vertex
+texture bone anim
+bone -1 fra
\ No newline at end of file
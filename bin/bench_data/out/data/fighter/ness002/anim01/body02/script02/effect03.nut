@@ -0,0 +1,252 @@
+material = -1
+-1 = anim frame anim frame texture -1
+anim bone 1.0 -1 anim vertex texture -1 material
+vertex 1.0 =
+material vertex texture vertex 0.500000 frame anim anim = texture material anim material
+bone
+1.0 = 0.500000 =
+bone frame frame 0.500000
+material texture material
+1.0 0.500000 frame
+anim bone
+anim 1.0 -1 0.500000 =
+vertex vertex frame 1.0
+vertex
+frame
+= bone
+= texture
+anim 0.500000
+material 1.0 anim
+texture material bone material anim = vertex 0.500000 0.500000 0.500000 1.0 bone
+-1
+0.500000 vertex 0.500000
+frame frame = material frame 1.0 texture 1.0 bone
+-1 1.0 1.0 texture anim
+material material
+= =
+texture 1.0 vertex vertex vertex
+0.500000 0.500000
+texture
+frame = vertex anim 0.500000
+anim
+bone = vertex texture = texture
+vertex -1 frame vertex anim 0.500000 bone material 0.500000 0.500000 material 0.500000 vertex bone vertex frame
+vertex material
+texture = material frame 0.500000 bone
+-1 vertex anim material
+material material material 1.0 anim
+-1 bone material frame 1.0 1.0 -1 material
+0.500000 vertex = texture -1 texture -1 anim
+material
+-1 frame
+-1 texture anim
+texture frame
+material
+material =
+1.0
+texture texture vertex bone anim vertex -1 anim 1.0 anim
+material = frame 1.0
+0.500000 bone
+1.0 0.500000 anim
+-1
+-1 vertex
+material
+bone -1 frame vertex
+frame material -1 = anim texture =
+anim
+vertex bone
+0.500000
+material
+vertex =
+-1 vertex vertex anim bone
+-1
+bone bone
+0.500000
+frame texture frame vertex
+anim material vertex -1 = texture vertex bone 1.0
+0.500000 -1
+vertex 0.500000 1.0
+1.0
+-1 material 1.0
+frame = anim = frame -1
+material vertex -1 frame vertex
+-1 bone
+texture -1 0.500000 texture
+= bone anim 0.500000 bone vertex -1 bone
+= 0.500000 anim anim -1 bone bone texture 0.500000 bone 1.0
+0.500000 texture 0.500000 = frame
+bone vertex 1.0 1.0 1.0
+frame -1 0.500000 1.0
+material anim vertex -1 vertex frame material
+bone
+-1 -1 vertex texture
+= bone = = -1 frame anim -1 1.0 = texture texture vertex -1 texture anim = vertex vertex texture -1
+anim = 1.0 bone bone
+1.0 = 1.0 bone
+vertex texture
+bone
+bone anim bone frame 0.500000 -1
+frame = vertex texture bone
+texture 0.500000 material vertex = bone frame
+frame material material vertex texture
+anim -1 frame anim texture frame material texture material bone bone bone
+vertex frame 0.500000 1.0 vertex frame bone 0.500000
+texture bone -1
+bone frame bone material vertex
+vertex 0.500000 -1
+1.0 material bone vertex -1 0.500000 -1
+-1 texture
+1.0 frame 0.500000 anim anim -1 -1 -1 material
+anim 1.0
+=
+-1 frame
+vertex bone
+=
+material
+anim frame
+0.500000 0.500000 material vertex bone material
+-1 0.500000 1.0
+1.0
+frame 1.0 material 0.500000 = 0.500000
+anim texture 0.500000 anim
+0.500000 bone -1
+material
+material = material bone vertex = 1.0 vertex
+material anim =
+material 1.0
+0.500000 -1 0.500000 anim material
+texture
+anim 0.500000 vertex
+-1 1.0 texture
+material = 0.500000 material =
+material
+texture
+=
+material 1.0
+texture anim anim -1 bone texture material vertex frame anim
+anim -1 0.500000
+0.500000 material 0.500000 material
+vertex vertex
+-1
+0.500000 -1 vertex frame material texture vertex material
+= material
+1.0 material 1.0
+bone
+anim vertex
+vertex vertex 1.0 bone material 1.0 -1 0.500000
+-1 0.500000 anim frame = anim
+material frame 0.500000
+material frame
+0.500000 -1
+0.500000 = 0.500000 frame = 1.0 anim anim 0.500000 = frame
+1.0 material 0.500000 anim texture frame vertex
+1.0
+material = texture 0.500000 vertex
+material = material = material 0.500000 1.0
+texture vertex = 0.500000
+frame frame
+1.0 -1 material = 1.0 vertex 0.500000 frame 1.0 bone 0.500000 anim = =
+vertex
+1.0
+0.500000 = vertex
+0.500000 texture
+frame material
+vertex
+bone -1 1.0 1.0 1.0 -1 bone 0.500000 material material
+bone anim material
+0.500000 -1
+texture 0.500000
+material texture 1.0 texture
+-1
+material bone = frame texture vertex material
+0.500000 vertex = 1.0 bone 0.500000 frame
+frame bone 1.0
+0.500000 bone vertex -1 texture texture material
+anim anim 0.500000 vertex
+bone
+frame material =
+0.500000
+0.500000
+material bone texture
+texture
+texture
+vertex anim frame material
+anim -1
+vertex -1 = bone vertex
+vertex anim 1.0
+1.0 = 0.500000 bone bone -1 1.0 texture texture -1 texture 0.500000 bone bone anim material -1
+1.0 vertex anim 0.500000 texture bone frame -1 anim -1
+texture 1.0 1.0 frame frame bone = frame 1.0 material = 1.0 anim
+1.0 1.0 material anim
+vertex 1.0 texture anim texture material = anim -1
+material
+vertex anim vertex 1.0 texture
+0.500000 bone
+-1 vertex
+texture bone anim frame 1.0 -1 frame 0.500000 1.0 =
+-1 0.500000 anim frame
+vertex vertex 0.500000 0.500000 1.0 anim =
+bone = 0.500000 1.0 anim -1 vertex -1 1.0
+0.500000 -1
+vertex 1.0
+0.500000 0.500000 anim
+vertex -1 0.500000 bone 1.0 bone 1.0 vertex
+1.0 bone
+0.500000 texture material bone anim -1
+vertex material 0.500000 texture texture -1 0.500000 -1 1.0 material texture bone bone anim frame frame 0.500000 bone =
+material frame -1 material 1.0 bone frame
+material bone 1.0 1.0 frame 0.500000
+1.0 = anim vertex
+material
+anim bone = texture vertex
+anim = -1 -1 -1 vertex material 0.500000 vertex frame material 1.0
+-1 = material frame
+bone
+bone material frame vertex = 1.0 material
+-1 1.0 texture
+-1 texture vertex texture vertex
+1.0
+texture = 1.0
+bone bone anim bone
+bone vertex material bone
+0.500000 vertex texture vertex 0.500000 bone texture
+vertex
+-1 anim
+material 1.0 bone
+vertex =
+frame
+frame
+0.500000 vertex anim
+1.0 0.500000
+0.500000
+-1 frame bone
+= 1.0 -1 material = bone
+-1
+frame
+vertex anim =
+anim vertex -1 0.500000 -1 frame = bone material texture frame 0.500000 = = bone
+1.0 material 1.0
+texture anim texture
+= material anim frame vertex bone
+0.500000
+vertex -1 material texture
+-1
+bone texture -1 texture
+0.500000 frame = bone
+bone anim =
+bone frame = vertex
+=
+bone
+texture = = texture 0.500000 frame frame
+anim
+vertex bone vertex
+vertex 1.0 texture vertex
+-1 0.500000
+anim = texture 1.0 0.500000 texture frame 0.500000 anim 0.500000 anim = 0.500000
+texture = anim anim frame bone anim texture bone material frame texture anim anim 1.0 material = 0.500000 1.0
+texture anim
+anim material
+material material
+0.500000 0.500000
+material
+fram
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim vertex vertex = 0.500000 0.500000 1.0
+0.500
\ No newline at end of file
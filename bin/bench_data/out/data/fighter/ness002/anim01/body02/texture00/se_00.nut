@@ -0,0 +1,19 @@
+1.0 frame 1.0 material bone vertex frame anim material
+bone frame vertex vertex
+1.0
+=
+texture
+-1 -1 vertex
+texture = vertex
+1.0 =
+anim
+frame
+material 0.500000
+=
+material -1
+= -1
+texture 1.0 -1 bone texture 1.0
+-1 = anim vertex 1.0 0.500000 1.0 frame frame texture
+texture -1 bone 0.500000
+frame frame
+texture vertex bone material 1.0 fra
\ No newline at end of file
@@ -0,0 +1,36 @@
+1.0 0.500000
+bone vertex 1.0
+-1 texture
+frame 0.500000 =
+frame material anim
+= 0.500000 material
+bone = texture 1.0 -1
+material
+bone
+= texture material
+bone
+0.500000 =
+material material vertex texture anim
+vertex
+anim -1 0.500000 vertex = 0.500000 -1 vertex anim bone 1.0
+frame
+1.0
+bone bone material = vertex 0.500000
+= 0.500000
+bone anim 0.500000 =
+texture material 0.500000 -1
+bone =
+-1 = texture
+bone 0.500000 bone material -1 0.500000 material bone -1 1.0 vertex material
+frame bone material
+frame vertex
+material
+bone = = bone
+= -1 vertex 1.0 1.0 -1 -1
+vertex -1 material anim -1 bone -1 bone frame -1 frame
+vertex 0.500000 frame 1.0 1.0 bone anim
+texture texture
+material anim vertex vertex texture vertex vertex
+bone anim -1 = texture
+frame
+text
\ No newline at end of file
@@ -0,0 +1,85 @@
+anim frame bone texture frame 0.500000 anim 1.0 1.0 vertex
+vertex
+1.0
+1.0 =
+= 0.500000 1.0 1.0 bone material
+1.0 vertex
+vertex 0.500000 = vertex texture
+0.500000 frame
+texture 1.0
+texture
+frame 1.0 frame frame material
+bone frame material frame 1.0 anim bone
+vertex
+-1
+bone
+1.0
+vertex
+1.0 0.500000
+= anim
+frame -1 material 0.500000 1.0 1.0 material
+bone frame 0.500000
+anim bone 0.500000 anim
+1.0 -1 vertex = bone -1 vertex texture frame anim
+0.500000 = bone 0.500000
+-1 material anim material bone
+frame 1.0 material
+1.0
+0.500000
+-1 -1 material vertex -1
+bone anim -1 1.0 frame material material 1.0 =
+= anim -1
+0.500000
+0.500000 vertex vertex
+0.500000 0.500000 material 0.500000
+frame
+1.0 0.500000 texture = =
+-1 frame
+anim 0.500000 anim
+frame
+1.0
+-1 material
+bone anim -1 frame bone vertex bone
+vertex 1.0
+vertex frame 0.500000 bone 0.500000 0.500000 bone material
+1.0
+= 1.0
+texture
+material vertex = -1
+= -1 -1 material vertex texture vertex texture anim 0.500000 = texture frame bone frame texture 1.0 vertex
+0.500000 1.0 vertex -1 texture 0.500000 anim anim bone -1 vertex 1.0 anim anim = anim texture 1.0 frame bone 1.0 frame -1 material
+1.0
+anim 0.500000 texture texture material
+anim -1 =
+bone
+bone bone bone
+vertex 0.500000 frame
+bone 1.0 =
+texture anim
+-1
+texture
+anim frame material
+0.500000
+anim material frame frame anim
+0.500000
+frame texture 1.0 vertex frame 0.500000 texture 0.500000 0.500000
+frame frame
+texture
+material vertex = -1 vertex frame texture
+texture = = bone texture material
+1.0 vertex 1.0 anim 1.0 frame vertex
+1.0 0.500000 0.500000 =
+1.0 bone 0.500000 bone
+1.0 bone bone -1 frame texture anim anim =
+texture
+1.0 0.500000
+0.500000 frame 0.500000 bone 0.500000 0.500000
+frame
+1.0 anim vertex
+1.0 = frame bone =
+material
+frame
+vertex vertex
+anim anim
+frame
+material = anim = anim anim frame anim fr
\ No newline at end of file
@@ -0,0 +1,5 @@
+1.0 frame 0.500000 texture
+frame bone
+bone -1
+frame
+-1 0.500000 bone frame bone
\ No newline at end of file
@@ -0,0 +1,40 @@
+1.0 bone vertex vertex 1.0 0.500000 1.0 texture 1.0 vertex bone 0.500000
+bone material anim material material texture
+frame texture 1.0
+1.0 0.500000
+1.0 -1
+anim vertex frame -1 bone frame bone frame material 0.500000 0.500000
+anim texture vertex -1
+0.500000 = texture anim 0.500000 texture material
+texture 0.500000 = material
+1.0 frame frame
+bone anim texture bone -1 texture anim frame anim 0.500000 = 1.0 0.500000 bone 0.500000 material
+material frame material 1.0 bone 1.0 texture vertex 0.500000 = 1.0 anim 0.500000
+-1 vertex
+-1 =
+texture -1
+texture anim frame vertex
+frame vertex vertex frame texture =
+frame 1.0 vertex bone 1.0
+=
+texture
+anim
+0.500000 anim
+-1
+0.500000
+= vertex bone texture anim
+=
+bone frame vertex bone
+material vertex material anim
+material
+0.500000 vertex material -1 0.500000 1.0 anim
+bone 1.0
+material anim
+-1 material texture 0.500000 anim 0.500000
+-1 vertex
+-1 vertex anim
+0.500000 material vertex
+0.500000 anim = frame frame 0.500000
+vertex
+frame
+-1 b
\ No newline at end of file
@@ -0,0 +1 @@
+SqF~F<b@E9'Gqw8i
\ No newline at end of file
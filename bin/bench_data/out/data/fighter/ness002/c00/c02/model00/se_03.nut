@@ -0,0 +1,8 @@
+0.500000 anim
+material 1.0 vertex frame -1
+= = = anim 0.500000 texture = 0.500000 material
+anim bone vertex =
+vertex
+vertex frame -1
+1.0 -1
+texture material = -1 vertex texture anim 1.0 -1 b
\ No newline at end of file
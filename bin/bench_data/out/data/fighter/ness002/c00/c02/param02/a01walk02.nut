@@ -0,0 +1,14 @@
+1.0 0.500000 anim = -1
+= = 1.0
+anim 1.0 frame 1.0 -1 0.500000 texture vertex 0.500000
+frame 0.500000 vertex anim 1.0 vertex material vertex vertex material material -1 = 0.500000 anim
+1.0 anim
+bone = vertex anim anim frame = 1.0 bone 0.500000 = texture
+anim vertex -1 texture 1.0 vertex = =
+= anim
+vertex -1 vertex texture 1.0 material material bone = 1.0 anim frame bone
+-1
+anim anim =
+texture vertex bone vertex
+frame vertex material frame vertex -1 material texture
+vertex -1 1.0 texture = -1 =
\ No newline at end of file
@@ -0,0 +1,218 @@
+material texture vertex frame
+frame = 0.500000 vertex 1.0 0.500000 1.0 frame frame -1 bone -1 = texture anim
+bone
+anim bone 0.500000 frame material material 1.0 1.0
+material 0.500000 bone = 0.500000 vertex
+=
+vertex 1.0 frame 0.500000
+1.0 -1 1.0 frame 1.0 = 1.0 bone -1 0.500000 anim vertex
+material material
+bone
+0.500000
+material bone
+= 0.500000 1.0 material
+bone = 0.500000 bone 0.500000
+1.0 = vertex frame 1.0 anim anim
+material -1 1.0
+bone
+0.500000 1.0 texture 1.0 anim
+material -1 0.500000 vertex = frame 1.0
+0.500000
+texture
+0.500000 = bone texture =
+1.0 0.500000 material
+bone
+anim texture material material frame vertex 0.500000 frame 1.0 1.0 vertex
+material
+frame 0.500000 bone vertex 0.500000
+vertex 1.0 texture 1.0 frame anim material bone
+0.500000 0.500000 -1 bone
+material 0.500000 -1
+material frame anim frame bone = material = 1.0 = frame 1.0
+vertex -1
+bone
+material 1.0 texture texture = bone bone -1 anim texture frame
+anim bone = vertex
+material -1
+0.500000 frame
+bone -1
+frame = 1.0 0.500000 anim
+vertex
+material
+0.500000
+1.0
+material
+material -1 texture material vertex texture anim
+-1 material material
+-1
+material 0.500000 anim 0.500000 1.0 = texture -1 material material
+-1
+material 1.0 -1
+frame vertex
+0.500000 -1 texture frame 0.500000 vertex bone anim vertex 1.0 bone
+-1
+= bone vertex
+-1 =
+bone bone
+material -1
+bone material 0.500000 -1 = vertex bone
+1.0 = texture vertex vertex = -1 vertex 0.500000 = vertex material bone
+frame texture =
+= frame bone bone bone vertex = -1 material
+-1 bone = bone 1.0 =
+vertex material
+material =
+anim
+1.0 0.500000 texture frame frame
+anim
+1.0 frame frame frame
+=
+vertex anim anim material anim
+frame
+bone
+-1
+-1 = anim anim -1 vertex 1.0 1.0 vertex 1.0 bone
+texture
+0.500000 0.500000 texture anim 1.0 = texture material
+material texture texture frame 0.500000 -1 material bone texture
+vertex
+1.0 anim
+vertex = -1 = vertex texture
+material = texture anim -1 texture anim
+material texture
+bone 0.500000
+texture vertex texture 1.0 = texture = 0.500000 material 0.500000 0.500000 texture texture 1.0 material anim vertex anim anim
+0.500000 0.500000 frame anim
+texture
+material =
+frame vertex
+0.500000 vertex
+material
+anim material anim texture bone
+= bone bone -1
+0.500000 1.0 -1 1.0
+vertex -1 vertex texture vertex texture 0.500000 vertex
+= 0.500000 texture texture -1 frame = anim texture 0.500000
+-1 bone 0.500000 1.0 1.0 frame = = = -1 material material -1 material 0.500000 material
+texture 1.0 vertex anim 1.0 vertex texture anim
+frame
+1.0 bone bone material -1 0.500000
+-1 0.500000 1.0 =
+material material
+0.500000 -1 material
+bone texture vertex -1 1.0 vertex
+1.0 0.500000 -1 1.0
+bone anim -1 anim anim frame anim texture = bone
+bone bone
+bone vertex
+1.0
+material texture 0.500000 0.500000 vertex material
+anim anim -1
+material vertex anim frame -1 0.500000 frame material -1
+1.0
+-1 anim
+material -1
+material
+anim
+-1 anim = -1 1.0 anim 0.500000 0.500000 material
+0.500000
+=
+material -1 bone = material vertex 0.500000 bone 1.0 0.500000 1.0 vertex = -1 1.0 vertex 1.0 0.500000 vertex
+frame
+1.0 material -1 =
+bone
+1.0
+vertex 1.0 bone vertex texture
+frame
+bone -1
+= 0.500000
+vertex frame frame material
+1.0 1.0 1.0
+0.500000 material =
+material -1
+anim 1.0 vertex texture texture 0.500000
+frame 1.0 material
+vertex bone frame -1 1.0
+anim anim
+-1 = 1.0 1.0
+0.500000 bone vertex texture bone 0.500000 frame
+vertex anim anim
+anim 0.500000 -1 material vertex anim -1 vertex frame bone 1.0
+1.0 frame
+material -1 anim texture
+0.500000 bone
+-1
+vertex bone -1 = = 1.0 0.500000 texture
+material -1 vertex 0.500000 material vertex 1.0
+bone
+1.0 anim anim -1 bone vertex texture =
+material -1 0.500000 texture = anim
+frame material = -1
+frame vertex material 0.500000 texture texture -1 1.0 bone frame
+bone
+anim
+-1 vertex anim 0.500000
+0.500000 vertex texture anim
+material material anim vertex =
+-1 frame
+-1 vertex bone frame material
+= material
+1.0 0.500000
+=
+anim
+frame material 0.500000
+0.500000 -1
+material
+texture material 0.500000 bone
+vertex bone
+frame
+-1
+1.0 = = material frame
+material 0.500000 = texture anim vertex =
+frame texture 0.500000 material
+0.500000
+0.500000 1.0 material 1.0 0.500000 -1
+=
+material
+material frame
+bone
+vertex anim frame material 1.0 0.500000 1.0
+-1
+= = texture -1
+0.500000 -1
+1.0 -1 bone
+anim
+-1 anim anim =
+texture frame texture
+-1 material 1.0
+bone vertex = -1 vertex bone -1
+anim -1 0.500000 texture anim material =
+1.0
+-1 1.0
+anim
+0.500000
+1.0 = frame frame 1.0
+vertex = bone
+anim anim
+-1 =
+= frame -1 material 0.500000 vertex -1 1.0 0.500000 0.500000 bone 1.0 0.500000 frame frame = anim = bone 1.0 frame
+-1 -1 material material 1.0
+frame
+1.0 texture bone
+0.500000
+1.0 -1
+1.0
+bone anim 0.500000
+1.0 texture
+vertex bone frame texture
+material
+anim anim
+vertex vertex frame
+texture texture bone texture
+anim bone
+1.0 0.500000 vertex 1.0
+anim bone frame 1.0 1.0 bone bone 0.500000 bone
+anim vertex frame 1.0 anim material 0.500000
+-1 texture
+bone frame =
+1.0
\ No newline at end of file
@@ -0,0 +1,321 @@
+= anim -1
+texture -1 texture -1
+texture material = 0.500000
+1.0 material -1 0.500000
+texture texture = = 1.0 0.500000 material anim
+texture
+1.0 -1 = vertex
+1.0
+1.0 anim material texture = vertex
+-1
+anim bone 0.500000 bone = texture
+texture frame bone
+-1 -1 vertex vertex
+anim = = anim
+1.0 vertex
+texture texture material
+0.500000 texture -1 -1 frame
+frame 1.0
+vertex 1.0
+0.500000 -1
+material frame texture 0.500000 = = material texture 0.500000 0.500000 -1 1.0 0.500000 frame
+1.0 texture
+anim
+vertex bone
+vertex material -1 frame
+bone material 0.500000 1.0 anim bone
+0.500000 material texture 1.0 1.0 bone anim vertex frame -1 = frame = =
+1.0
+bone vertex material vertex frame texture 1.0
+bone material texture bone material -1 = 1.0 =
+-1 0.500000 frame texture 0.500000 bone 0.500000 texture anim 1.0 = frame frame frame anim 0.500000
+texture
+frame bone
+-1 anim anim frame -1 = bone
+0.500000 = texture =
+material anim -1 vertex anim 1.0
+vertex -1 frame -1
+bone material =
+anim texture frame
+material -1 bone
+frame 0.500000
+material vertex material bone = 1.0 anim =
+texture 0.500000
+anim
+vertex vertex
+1.0 bone texture
+0.500000
+texture anim frame 0.500000 =
+anim texture anim vertex
+1.0 = material 1.0 anim vertex
+-1 material =
+anim
+0.500000 1.0
+texture anim
+material frame vertex -1 vertex -1 = anim frame 1.0 vertex vertex -1 1.0
+0.500000 anim -1 0.500000 vertex vertex anim
+= 1.0
+1.0 bone material material
+0.500000 material
+texture bone -1 0.500000 =
+frame 0.500000 bone anim texture frame 0.500000 0.500000 texture anim bone vertex 0.500000 bone -1
+frame bone vertex 1.0
+frame
+frame 1.0 = bone
+1.0
+1.0 anim anim
+= anim = frame = material
+anim -1
+vertex 0.500000
+frame -1 =
+= =
+frame = vertex frame vertex
+-1
+bone
+-1
+anim anim
+= 0.500000
+= 1.0 bone frame
+1.0
+anim material
+0.500000 bone bone frame
+material 0.500000
+-1
+=
+-1
+frame
+frame
+vertex -1 bone bone bone bone frame anim vertex 1.0 material frame texture = material
+-1 = = anim 0.500000
+anim
+= =
+bone vertex bone
+material
+material anim -1 material -1 frame 1.0
+= = 1.0 -1 bone vertex anim = vertex = anim vertex vertex 1.0 1.0 anim
+anim
+vertex bone -1 -1 vertex vertex
+bone -1 frame vertex material
+1.0
+anim anim vertex
+material = material bone 1.0 bone 1.0
+frame
+frame bone vertex texture
+texture 0.500000 material = material
+anim 0.500000
+anim frame
+0.500000
+=
+0.500000 texture 0.500000 1.0 1.0 anim 0.500000
+material texture = texture
+-1
+anim frame anim frame texture vertex vertex bone anim 0.500000 bone bone = = material vertex = -1 texture 0.500000 -1
+bone bone vertex
+1.0 -1 texture frame
+-1 1.0 0.500000 frame
+=
+anim 0.500000 bone =
+-1 vertex vertex
+frame material
+0.500000
+1.0
+= texture -1 0.500000 anim
+-1 -1 = vertex
+1.0 frame
+texture material
+bone vertex
+1.0
+material bone frame material
+-1 vertex bone
+frame -1 1.0 texture material frame material
+texture 1.0 frame texture -1 anim
+vertex texture material 0.500000 frame
+frame anim texture texture texture
+texture frame =
+bone =
+vertex bone
+0.500000 = bone =
+-1
+material texture 0.500000
+0.500000 = vertex
+0.500000 0.500000 bone = material
+0.500000 0.500000 =
+0.500000 -1 -1
+anim bone frame bone texture
+-1
+anim material 1.0 1.0
+vertex -1
+= anim bone 1.0 frame
+=
+-1 bone
+0.500000 frame
+bone bone frame texture 0.500000 anim 0.500000 -1 anim bone anim vertex -1
+texture
+-1
+material
+=
+anim
+frame
+frame texture
+-1 = texture material vertex frame vertex 0.500000 material 1.0 bone bone
+vertex texture = = 0.500000 material
+vertex vertex 1.0 = anim
+frame texture texture
+0.500000 material = texture
+1.0
+anim texture material material = = bone 0.500000 material frame
+vertex = = -1 vertex 1.0
+bone
+1.0 -1
+vertex frame
+= = 0.500000
+-1 bone texture material vertex material material texture anim material material
+1.0 1.0
+vertex bone frame vertex frame
+material texture texture
+bone
+1.0
+material bone
+bone texture 0.500000
+0.500000
+= -1 material bone 1.0 1.0 vertex 0.500000 0.500000
+= bone frame 0.500000 1.0 = material -1 0.500000 frame texture frame 0.500000 bone material vertex 1.0 bone texture
+bone texture anim -1 0.500000 0.500000 material frame frame 0.500000
+bone texture
+1.0 0.500000
+= vertex bone = = 1.0 texture vertex =
+frame -1
+=
+vertex anim vertex anim frame frame vertex 0.500000 1.0 vertex = frame anim frame -1 1.0 frame
+anim anim frame
+0.500000 material =
+frame -1 frame frame
+vertex
+vertex 0.500000 anim 1.0 1.0 1.0 1.0 -1 anim = frame = bone anim -1
+texture anim frame 1.0 frame
+anim -1 0.500000 anim texture
+frame = vertex anim vertex = -1 vertex vertex
+bone texture = frame 0.500000 material 0.500000 bone vertex material texture texture
+anim
+0.500000
+material =
+-1 = bone frame vertex material frame anim
+0.500000 0.500000
+material anim 1.0
+texture 1.0 vertex
+bone anim -1 texture frame -1 0.500000
+texture bone
+bone
+anim
+vertex vertex anim frame anim -1 1.0 -1
+vertex 0.500000 = frame
+frame
+-1 texture = texture anim -1 frame = vertex material
+= material material =
+frame
+0.500000 -1 frame -1
+1.0 vertex = anim anim vertex
+material vertex texture texture vertex bone 1.0 0.500000
+-1
+anim anim = bone material anim 1.0 anim =
+-1
+= 0.500000 frame texture
+0.500000
+=
+0.500000 = 0.500000 texture -1 1.0 texture = 0.500000 1.0
+texture anim texture 0.500000 frame bone 1.0 -1 vertex 1.0 bone anim
+anim vertex frame anim
+1.0
+material
+vertex
+0.500000 texture 1.0 bone anim
+anim 1.0 1.0 = texture anim bone anim 1.0 -1 =
+material
+-1 vertex =
+material
+vertex vertex bone material
+0.500000 0.500000 = frame texture 0.500000 = frame texture = material -1 vertex =
+texture
+material = = bone texture 1.0 vertex vertex bone bone anim frame = frame texture texture bone vertex frame
+= texture -1 material bone = texture bone frame 1.0 -1 material 1.0 material
+1.0 = = = =
+vertex texture -1 texture
+bone 0.500000 frame
+-1 frame 1.0 =
+1.0 bone = frame -1 frame frame -1 frame 0.500000 -1
+vertex material bone
+texture material 0.500000
+=
+1.0 = -1 texture
+frame 1.0
+anim -1
+bone -1
+material
+-1 vertex frame frame bone bone texture texture
+-1 texture
+material = -1 vertex = vertex texture
+bone vertex anim frame frame anim vertex bone -1 texture anim material vertex frame bone anim -1 bone
+texture vertex frame 0.500000
+= texture 0.500000 -1 frame texture = bone bone = 1.0
+-1 -1 0.500000 anim vertex material
+1.0 vertex anim frame vertex -1
+anim 0.500000 0.500000
+= =
+frame bone texture frame 1.0 1.0 = material 0.500000 1.0 1.0 1.0 0.500000 1.0 -1 = -1 material vertex
+=
+vertex bone texture frame -1
+anim material 1.0
+material bone texture -1 1.0
+vertex
+anim
+-1
+texture anim bone
+0.500000 = material frame frame frame
+frame -1 1.0 1.0 bone -1 0.500000 bone material
+0.500000 texture = material = material = 1.0 vertex
+material texture = frame frame vertex vertex
+texture = anim
+material frame anim 0.500000
+material anim texture -1
+-1 bone vertex frame material frame -1
+texture material
+anim
+vertex vertex texture =
+anim
+texture
+0.500000 material material bone vertex 1.0 vertex -1 frame anim
+bone 0.500000 1.0 anim vertex
+anim frame
+0.500000
+1.0 1.0 vertex anim vertex anim
+0.500000
+= = 1.0 -1 frame = bone bone vertex -1 vertex vertex
+1.0 vertex 1.0 0.500000 vertex 1.0 1.0
+material
+frame bone -1 frame -1 1.0 1.0 = -1
+anim material = bone -1
+frame anim texture bone -1 = vertex
+anim
+0.500000 bone -1 frame vertex texture 1.0 =
+0.500000 frame = anim =
+0.500000
+texture = vertex anim
+bone = 1.0 frame vertex 0.500000 0.500000 texture vertex = frame vertex -1 0.500000
+bone
+material vertex bone bone 1.0 0.500000
+1.0 frame -1 bone 0.500000 texture 0.500000 -1 0.500000 -1 1.0 vertex
+= 1.0 -1
+1.0 =
+texture = vertex 0.500000 -1 0.500000 anim = 0.500000 = 1.0 texture 0.500000 material
+0.500000 frame
+0.500000 vertex = vertex 1.0 anim bone bone frame
+-1 0.500000
+0.500000 bone frame 1.0 bone anim vertex -1 anim frame
+frame -1
+0.500000 0.500000 bone bone -1 = bone
+frame vertex
+anim anim vertex bone
+anim 1.0 material
+vertex
+= anim anim -1 = -1
+frame -1 1.0 1.0 = texture -1 = vertex material vertex = m
\ No newline at end of file
@@ -0,0 +1,8 @@
+bone texture material = 0.500000
+bone -1 0.500000
+0.500000 =
+texture texture -1 -1 = texture
+anim material =
+-1
+texture
+anim material 1.0 texture 1.0 1
\ No newline at end of file
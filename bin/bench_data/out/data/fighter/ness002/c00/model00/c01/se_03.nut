@@ -0,0 +1,75 @@
+vertex vertex frame material anim 0.500000 -1 = = -1
+= frame
+frame texture 1.0 -1
+bone -1 1.0 anim material texture 1.0 texture
+vertex anim texture frame
+material texture
+vertex anim vertex
+texture
+texture -1 anim material
+texture frame vertex texture vertex anim 0.500000 vertex
+0.500000 texture 0.500000 -1 -1 material frame = vertex material frame bone vertex
+1.0
+bone -1 vertex material = =
+anim anim material 0.500000
+vertex
+=
+vertex 1.0
+texture 0.500000 0.500000 vertex
+0.500000 -1 material material bone
+0.500000 material vertex bone
+anim bone -1 texture
+anim vertex frame texture texture 1.0 vertex -1
+material bone bone anim = 1.0 = bone vertex -1 anim 1.0 material anim 1.0 vertex
+frame
+texture -1 -1 anim
+0.500000 = texture material 0.500000 bone -1
+1.0
+1.0 1.0
+-1
+1.0 0.500000
+texture anim material
+1.0 1.0
+frame frame anim texture
+material -1 = vertex
+1.0
+texture
+texture material 1.0
+= 0.500000 frame anim 0.500000 0.500000 material
+material 0.500000 texture 1.0
+anim 1.0 1.0 -1
+1.0 0.500000
+material
+vertex anim 0.500000
+anim frame = -1 bone anim
+texture 1.0 vertex anim 0.500000
+texture =
+frame vertex = =
+material vertex 0.500000 material
+0.500000
+1.0 material vertex texture 0.500000 = bone 0.500000 =
+0.500000 texture
+vertex vertex texture bone -1 anim
+0.500000 0.500000 material 0.500000 texture texture bone 0.500000
+1.0 anim
+anim frame
+vertex texture -1 frame vertex = 1.0 1.0
+frame
+= frame
+= texture
+vertex material
+material anim bone
+material material = 0.500000 bone anim
+anim -1 1.0
+texture vertex 0.500000 bone texture material = 0.500000
+anim -1 vertex
+material anim material -1 bone -1 0.500000 = material
+anim
+material 1.0 texture texture anim vertex bone
+1.0
+= 0.500000 vertex vertex vertex vertex
+1.0
+texture bone -1 = 1.0 0.500000 texture frame texture
+vertex
+texture
+bone = texture = material material frame 
\ No newline at end of file
@@ -0,0 +1,275 @@
+bone 0.500000 bone material 1.0 -1 1.0
+-1 = bone frame anim 1.0 -1 vertex bone
+1.0
+0.500000 = bone
+0.500000 -1 1.0 -1 = 0.500000 anim texture frame
+material anim material = -1 material
+1.0 anim vertex
+frame bone anim material =
+1.0 frame
+0.500000 0.500000 1.0
+texture bone anim frame = texture
+0.500000 vertex 0.500000
+bone texture bone anim bone
+0.500000 anim 0.500000
+= texture vertex
+material
+material texture
+texture
+1.0 0.500000 vertex
+anim bone frame -1 vertex
+-1 0.500000
+vertex -1 = texture -1
+frame
+= = 0.500000 = anim vertex anim
+anim anim -1 vertex anim texture 0.500000
+-1 = = -1 frame 0.500000 frame frame
+=
+anim vertex -1
+bone
+=
+1.0 =
+= 1.0 frame texture
+bone -1
+0.500000
+anim -1 vertex bone texture texture anim = material 0.500000 vertex
+anim frame bone bone frame bone 1.0 anim 0.500000 vertex bone bone frame -1
+vertex 0.500000 texture material material anim 0.500000 frame
+= texture 0.500000 frame
+anim vertex -1 material vertex
+frame vertex vertex
+material texture texture 0.500000 1.0 vertex 1.0 bone anim
+-1 bone 0.500000 texture
+texture
+1.0 frame
+frame material = -1
+bone
+-1 texture anim
+material 0.500000 vertex texture texture frame
+texture frame 0.500000 anim frame anim material 0.500000
+= -1 = anim vertex bone
+-1 frame
+-1 material -1
+material
+1.0 -1
+1.0 material
+1.0
+texture = bone 1.0 -1 anim frame 0.500000
+vertex 0.500000
+1.0 =
+1.0 0.500000 1.0 texture 0.500000 bone
+=
+material anim
+texture 1.0 texture = material anim 0.500000 frame
+frame vertex = -1 1.0
+vertex material
+0.500000
+bone 1.0 1.0 0.500000 vertex texture bone =
+1.0 anim frame = texture = frame vertex material 0.500000
+material texture vertex 1.0 material 0.500000
+=
+0.500000 -1
+frame 1.0 bone
+bone -1
+anim 1.0 vertex -1 texture bone frame
+= -1 material texture = material 1.0
+anim =
+-1
+material
+texture anim =
+0.500000 bone vertex
+material texture
+vertex 1.0 0.500000
+0.500000 material -1 = 0.500000
+-1 =
+vertex 0.500000 0.500000 1.0 -1
+=
+-1 0.500000 anim 0.500000 -1
+0.500000 texture anim
+vertex = 0.500000 vertex = texture vertex -1 0.500000 -1 anim anim 1.0 = -1
+vertex 1.0 1.0 frame
+frame
+anim
+0.500000 0.500000 -1 anim vertex bone
+texture frame frame 1.0
+0.500000
+vertex =
+anim
+= -1 1.0
+texture vertex texture bone frame
+frame frame -1
+0.500000 material material -1
+anim 1.0 vertex texture anim =
+texture
+anim
+material 1.0 anim texture frame frame
+1.0 -1 =
+frame
+frame
+anim
+1.0 bone -1
+material anim frame texture = 0.500000 -1 0.500000
+material frame -1 = bone -1 =
+texture anim texture frame frame bone
+frame texture 1.0 anim =
+-1 texture anim 1.0 1.0 texture
+1.0 1.0 anim frame vertex vertex -1 bone
+frame
+vertex texture -1 bone 1.0 texture -1 0.500000 = material texture 1.0 material -1 anim texture frame material texture 1.0 0.500000 0.500000 1.0
+texture
+material bone 1.0 0.500000
+0.500000 bone texture frame
+-1 vertex 1.0 0.500000 material
+bone
+1.0
+texture vertex frame frame =
+= texture 1.0 = material anim 1.0
+bone 1.0
+material vertex bone 0.500000
+-1 material
+texture
+anim frame vertex
+vertex =
+1.0 0.500000
+texture
+0.500000 = bone 0.500000 anim vertex = 1.0 = material
+= vertex anim bone
+anim = anim material 1.0
+bone vertex frame
+texture 0.500000
+1.0 anim
+=
+= 1.0 -1 bone 1.0 1.0 vertex frame
+bone texture bone anim
+vertex = material texture texture = frame vertex 1.0 texture -1 frame 0.500000 frame
+anim texture
+anim = = frame
+material texture vertex = bone 1.0
+texture 0.500000 texture bone
+1.0 1.0
+0.500000
+1.0 -1 = 0.500000 =
+material
+texture vertex bone 0.500000 frame
+material frame
+frame
+material
+frame
+anim
+material bone
+1.0 1.0
+= texture material
+vertex vertex bone vertex
+-1 1.0 =
+frame -1 0.500000
+vertex material material vertex
+1.0 frame
+1.0 vertex
+1.0 vertex anim
+texture 1.0
+bone
+texture 0.500000
+0.500000 vertex material -1 bone
+material bone
+texture = bone vertex texture
+frame material 1.0 frame 1.0 bone
+vertex texture anim 1.0
+anim frame texture
+1.0 vertex = material material anim
+texture vertex anim texture vertex = bone vertex 0.500000
+1.0 bone
+material frame bone bone frame 1.0 -1 1.0 bone frame
+texture material frame 1.0 anim -1 bone frame vertex bone 0.500000
+=
+frame texture material material
+texture = vertex material bone anim 1.0
+-1 anim anim texture 1.0 bone vertex frame 1.0 = 0.500000 = texture material -1 texture material
+= 0.500000 texture material
+frame
+vertex frame 0.500000 bone texture -1 anim anim -1 bone -1
+0.500000 1.0 -1 -1 bone bone -1 anim -1 0.500000 1.0 vertex frame texture
+material vertex vertex 1.0
+anim
+material -1 1.0 texture -1 0.500000 1.0
+=
+bone vertex anim =
+vertex anim = texture frame material material vertex texture frame
+-1 bone
+vertex -1 bone anim anim material texture frame bone 1.0
+-1 vertex anim frame
+material bone vertex
+= vertex
+1.0 = -1 bone -1 vertex 0.500000 bone
+frame 0.500000 1.0 texture vertex frame bone frame
+texture 0.500000 bone frame = 0.500000
+vertex vertex bone -1 anim = 1.0
+anim = texture texture frame
+texture vertex -1 1.0
+material bone material 0.500000
+material material 1.0 = bone bone
+texture
+material -1 anim material texture bone bone 1.0 bone vertex anim texture
+material texture material bone 1.0 vertex bone -1 material texture
+anim 0.500000 anim bone
+frame
+texture -1 vertex anim frame =
+0.500000 1.0 material texture
+1.0
+1.0
+1.0 anim texture frame frame = bone material
+1.0 anim anim -1 texture 0.500000
+anim anim =
+vertex -1
+-1 0.500000 -1
+material =
+frame frame anim
+bone = anim 0.500000 bone 0.500000 vertex = frame material 0.500000 material material 1.0 0.500000 anim frame vertex anim 1.0 bone -1
+texture = bone material 0.500000
+1.0 1.0 anim -1 texture
+vertex = -1
+frame
+bone texture -1
+0.500000
+1.0 0.500000 vertex = texture material vertex anim vertex 1.0 bone texture
+0.500000 anim anim frame -1 -1 -1
+texture frame material 0.500000 texture
+frame vertex
+material
+= 1.0 -1 1.0 1.0 1.0
+vertex texture material bone -1 = texture frame 0.500000
+1.0 anim anim = anim 0.500000
+anim frame frame material vertex frame
+frame -1 material texture vertex
+= anim vertex -1 anim
+frame 0.500000 material 1.0 texture 1.0
+= 0.500000 0.500000 anim frame bone = material material material
+-1 -1 vertex
+vertex frame = material frame
+-1 vertex anim material
+1.0
+-1 frame 1.0 material texture
+frame frame material
+1.0
+1.0 frame 1.0 = material
+material material bone
+= anim bone
+1.0 0.500000 anim -1 = = = material 0.500000 0.500000
+1.0 bone vertex vertex -1 = texture vertex bone anim material
+1.0
+anim 1.0 material anim
+material bone
+frame texture
+1.0 anim 1.0 -1
+frame = texture 0.500000
+-1 material
+0.500000 texture texture material 0.500000 0.500000
+=
+bone material texture 0.500000 vertex 1.0 bone bone = texture 0.500000
+=
+1.0
+frame
+anim texture bone frame texture bone -1 frame -1 bone texture = frame = vertex bone 0.500000 anim material frame -1 frame 1.0 bone -1 material
+frame = 0.500000
+= =
+vertex 1.0 anim 0.500000 -1 frame
+material -1 -1 anim anim b
\ No newline at end of file
@@ -0,0 +1 @@
+eu󠔦Si,$Q.@d4D%
\ No newline at end of file
@@ -0,0 +1,8 @@
+1.0 0.500000 1.0 vertex
+frame vertex -1
+bone 1.0 bone frame
+1.0 1.0 frame
+material texture frame 0.500000
+= 1.0 -1 material bone frame -1 frame anim = 0.500000 anim
+=
+texture 1.0 texture material frame
\ No newline at end of file
@@ -0,0 +1,262 @@
+-1 1.0
+vertex texture 0.500000 anim =
+frame vertex 0.500000 -1 bone vertex 0.500000 vertex bone
+bone = = bone 0.500000 vertex -1 1.0
+material -1 -1
+0.500000 -1 anim
+1.0 bone frame bone
+bone 0.500000 frame anim vertex vertex
+frame
+anim
+-1 = = 0.500000
+vertex
+bone 1.0
+-1 bone frame
+= bone 0.500000
+texture
+vertex frame 0.500000
+1.0 vertex bone 1.0 bone
+bone
+frame
+bone -1
+-1 frame anim 0.500000 1.0 anim anim = frame
+texture
+vertex
+material
+-1 bone frame vertex
+= texture
+bone
+1.0 frame 1.0 1.0 frame
+-1 material 0.500000 texture = anim vertex texture 0.500000
+anim vertex
+vertex
+texture texture
+vertex bone texture
+1.0
+= vertex
+-1
+bone -1
+vertex frame
+-1
+-1 bone 1.0 = 0.500000 = -1 =
+anim
+material
+texture
+vertex
+bone
+bone
+0.500000
+bone = frame 0.500000
+0.500000
+texture
+frame 1.0 0.500000 anim
+1.0
+0.500000
+frame
+vertex 1.0
+vertex = texture
+-1 0.500000 0.500000 material 0.500000 vertex texture frame anim 1.0 texture -1 material frame anim
+= material
+frame 0.500000
+0.500000
+frame material 1.0 vertex = 0.500000 texture material
+0.500000 = bone
+vertex -1 0.500000 texture texture material = = 1.0 1.0 -1 texture frame frame -1
+frame
+=
+-1 frame -1
+-1 = bone
+vertex
+frame frame anim material
+0.500000
+-1
+vertex material
+-1 0.500000 frame frame frame -1
+material bone 1.0 anim anim bone texture 0.500000 vertex
+0.500000 anim = vertex frame material vertex bone
+frame
+material frame 0.500000
+vertex = bone
+vertex 0.500000 frame 0.500000
+texture
+0.500000 vertex frame anim
+frame frame
+0.500000 = 0.500000
+=
+= vertex bone
+= frame anim bone 1.0 1.0 vertex
+= =
+material material vertex 1.0 vertex = material texture -1 material
+= 0.500000 -1 0.500000
+vertex anim bone = texture 0.500000 vertex bone 0.500000 0.500000 vertex frame 0.500000 vertex
+material 0.500000 1.0 = material texture 1.0 texture anim frame
+texture
+vertex 1.0 bone = bone bone
+1.0 1.0
+texture -1 = vertex
+material
+vertex texture = 1.0 1.0 =
+vertex -1 frame
+0.500000 material
+frame
+vertex = -1
+material frame
+= vertex
+texture
+bone bone
+= texture vertex texture
+bone 1.0
+vertex frame
+0.500000
+= bone = material frame
+0.500000 = 0.500000 vertex texture 1.0 -1 -1 0.500000 bone texture frame
+-1 vertex -1 vertex
+vertex texture vertex
+frame
+vertex -1 material
+bone material bone
+0.500000
+vertex anim
+material material -1 material
+0.500000 frame 1.0 frame -1 frame bone material 1.0 0.500000 0.500000
+= -1 1.0
+anim
+bone -1 vertex -1 texture frame 0.500000 -1 -1 frame anim = -1 texture material
+texture material vertex -1 frame frame bone = bone frame
+bone -1 -1 anim
+0.500000 material texture
+bone
+texture bone texture 1.0 vertex
+-1 = -1 anim 0.500000 vertex bone
+1.0
+bone = = bone = 0.500000 frame
+anim
+0.500000 = bone vertex vertex vertex 1.0 0.500000 0.500000 -1 = vertex
+-1 material 0.500000 vertex 0.500000 texture bone bone anim 0.500000
+-1 anim
+0.500000 anim frame texture vertex material 1.0 material 1.0 1.0 anim frame 1.0 0.500000 frame = texture -1 material 0.500000 texture bone material material
+1.0
+bone anim 0.500000
+= anim 1.0 frame
+vertex
+anim 0.500000 texture 0.500000
+=
+texture frame vertex 0.500000
+=
+frame material = = bone -1 material 0.500000 vertex
+vertex -1 1.0 1.0
+bone texture =
+-1 bone anim vertex = 1.0 texture
+1.0
+vertex -1 0.500000 texture 0.500000 anim = material frame -1 frame = 1.0 0.500000 bone anim vertex frame -1 0.500000 vertex texture texture material
+-1 0.500000 vertex texture material texture
+vertex
+bone
+0.500000 -1
+-1
+-1 texture 1.0 vertex
+frame = material 0.500000 material material 1.0 -1 bone
+0.500000 -1 0.500000
+1.0 material frame material
+material 0.500000 =
+texture texture bone
+texture
+texture bone -1 1.0 = -1 -1 bone
+frame
+-1
+anim = anim vertex
+texture 0.500000
+= 1.0 vertex 1.0 = texture
+texture -1
+= vertex = frame vertex -1 1.0 anim
+texture bone
+frame frame 1.0 material = bone vertex anim
+texture material vertex
+vertex
+anim -1
+vertex
+1.0 bone 1.0 vertex texture
+-1 1.0
+1.0 1.0 0.500000 = texture =
+material
+1.0 anim anim bone
+anim
+0.500000 = vertex
+bone material vertex
+0.500000
+anim texture
+bone
+texture frame 0.500000 bone
+1.0 texture 1.0
+-1 anim -1
+material bone
+1.0 frame texture texture texture frame 0.500000 bone = frame = -1 0.500000 texture
+0.500000 1.0 1.0 1.0 texture 0.500000 frame material 0.500000 1.0 bone material vertex anim 0.500000 texture 1.0
+-1 frame vertex 0.500000
+0.500000 anim 0.500000 anim
+texture -1 material 1.0 bone -1 0.500000 -1 = anim frame material -1 material material
+texture -1 bone
+texture texture 1.0 material
+vertex = bone
+vertex frame anim
+0.500000 vertex 1.0
+vertex texture 1.0 bone anim
+frame material
+1.0 = -1 bone frame
+bone anim
+texture material
+1.0 -1 bone material frame anim
+anim anim
+anim
+-1 anim
+frame
+anim 1.0 0.500000 = anim frame
+bone =
+bone material
+frame frame 1.0 anim anim material
+1.0 1.0
+= = texture = frame
+anim 0.500000
+0.500000
+vertex
+0.500000 1.0 0.500000
+-1
+-1 1.0 vertex =
+anim anim bone bone 0.500000 texture
+vertex bone
+-1
+anim bone
+= frame = =
+1.0
+1.0 = -1
+0.500000 -1 material
+= frame frame
+1.0
+material 0.500000 frame
+= anim -1 1.0 = -1 frame frame texture 1.0 texture 0.500000 vertex texture frame =
+-1 vertex
+vertex
+anim
+vertex vertex 0.500000 material -1
+material texture vertex vertex bone -1 = = material material 1.0 bone vertex
+=
+1.0 1.0 vertex vertex
+vertex material vertex material
+frame
+bone vertex
+material texture 1.0
+texture
+0.500000 vertex -1 vertex = vertex -1
+material -1
+frame frame = 0.500000 0.500000 texture -1 frame frame = texture frame anim =
+texture bone -1
+-1 0.500000 anim vertex
+texture =
+1.0 =
+anim = frame 0.500000 material
+-1
+anim texture material frame vertex
+-1
+vertex vertex
+anim vertex bone
+material material 0.500000 frame
\ No newline at end of file
@@ -0,0 +1,13 @@
+= frame
+1.0 vertex
+anim frame 1.0
+= texture -1
+vertex
+1.0 0.500000
+material
+frame = 1.0
+anim texture texture 1.0 -1 material material -1 anim
+anim
+anim texture
+1.0
+frame anim bone = 0.500000 1.0 anim bone vertex bone -1 = material 1.0 -1 0.500000 anim te
\ No newline at end of file
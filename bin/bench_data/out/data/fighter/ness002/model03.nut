@@ -0,0 +1,7 @@
+=
+texture = anim
+bone 1.0 material 0.500000 material
+texture 1.0
+texture
+material vertex 1.0 vertex texture
+ani
\ No newline at end of file
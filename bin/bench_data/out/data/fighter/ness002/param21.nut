@@ -0,0 +1,11 @@
+texture 0.500000 anim
+frame anim anim frame =
+material = = material
+texture 0.500000 anim texture
+vertex vertex
+anim
+vertex vertex
+1.0 1.0 vertex
+-1 material
+texture frame
+0.500
\ No newline at end of file
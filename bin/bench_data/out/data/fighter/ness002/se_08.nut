@@ -0,0 +1,49 @@
+frame
+1.0
+frame frame
+anim material 1.0 0.500000
+texture 0.500000
+frame 0.500000 frame
+frame
+-1 -1 -1
+texture
+0.500000 vertex material =
+frame material anim
+-1
+1.0 frame -1 0.500000 -1 0.500000 vertex 0.500000 texture material = anim
+anim material
+0.500000
+texture -1 = anim anim bone anim
+0.500000 = = = -1 bone -1 frame anim = vertex frame material 0.500000 1.0 bone anim 0.500000
+anim
+vertex 1.0 material 1.0 0.500000 frame vertex bone 0.500000
+anim material frame
+material anim bone anim
+0.500000 0.500000 frame material = material texture anim -1 -1
+vertex 0.500000 texture texture vertex anim frame
+0.500000 texture
+anim
+anim frame material
+material vertex vertex -1
+frame texture = 1.0 1.0 1.0 = -1
+material 0.500000 = material -1 -1 bone frame = material
+0.500000 0.500000 =
+bone anim
+-1 -1 -1
+1.0
+texture
+material
+bone
+texture 0.500000 material vertex
+0.500000 bone =
+-1
+1.0
+vertex
+texture 0.500000 1.0 frame texture -1
+= anim -1 bone 0.500000 -1 vertex 1.0 texture texture vertex 0.500000 1.0 0.500000
+bone -1
+-1 texture -1 material bone frame bone material material
+texture frame bone vertex = material material anim anim texture material 0.500000 frame bone 0.500000 0.500000 frame
+0.500000 1.0 material
+-1 = 1.0
+1.0 frame anim m
\ No newline at end of file
@@ -0,0 +1,13 @@
+1.0
+bone -1 vertex
+= 0.500000 frame
+bone frame material material material anim = 1.0 vertex frame
+material texture material
+frame material
+texture texture anim anim texture material 0.500000 bone 0.500000
+1.0
+vertex anim frame
+1.0 frame anim frame
+anim
+1.0 0.500000 -1
+anim 0.500000 ver
\ No newline at end of file
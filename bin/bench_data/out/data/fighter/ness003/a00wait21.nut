@@ -0,0 +1 @@
+GWE5*zL޹2BU$	Cn/88%G*U7tyƓ%'(Һώҋ<Ty8yXԯz#I@:OdDo_/*?B[i+pw%(B~oR{`DM@x.Ȉ3
\ No newline at end of file
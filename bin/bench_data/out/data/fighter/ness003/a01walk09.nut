@@ -0,0 +1,19 @@
+vertex
+0.500000 1.0 material texture vertex -1 0.500000 = frame
+texture frame
+material
+-1 1.0
+1.0 material bone texture -1
+anim vertex
+texture bone
+1.0
+1.0 vertex texture vertex texture 0.500000
+= 0.500000
+material bone = frame frame
+texture bone vertex texture material material
+0.500000 frame = anim -1 bone
+texture
+= vertex 0.500000 0.500000 vertex 1.0
+texture anim vertex -1 vertex bone texture = material anim
+0.500000 texture bone bone frame frame
+anim 0.500000 = bone b
\ No newline at end of file
@@ -0,0 +1,36 @@
+0.500000 material
+anim
+-1 material material
+anim texture -1 -1
+-1 0.500000 texture texture material =
+texture
+frame bone vertex material =
+frame
+texture bone
+0.500000 frame vertex
+frame frame material 1.0 1.0 vertex
+frame anim material 1.0 0.500000
+= 0.500000 vertex
+-1 material material -1 texture 0.500000 0.500000 = texture
+texture 1.0 texture bone
+0.500000
+anim = bone
+-1
+texture material
+frame -1 texture
+bone anim bone
+anim vertex material material texture texture material 1.0 = texture 1.0 bone = bone =
+vertex material
+vertex = 0.500000
+material 1.0 anim = material 0.500000
+texture anim bone anim anim -1 anim -1
+bone 1.0
+anim
+1.0 0.500000 frame 0.500000
+anim 1.0 1.0 bone material
+bone bone vertex anim 1.0
+frame material 1.0 -1
+= bone material frame
+texture 1.0
+material anim anim bone texture vertex
+texture frame bone anim material = frame 0.500000 bone frame bone frame 0.500000 0.500000 
\ No newline at end of file
@@ -0,0 +1,4 @@
+= =
+anim 0.500000
+-1 frame
+1.0 0.50
\ No newline at end of file
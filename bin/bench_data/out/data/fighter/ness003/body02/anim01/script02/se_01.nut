@@ -0,0 +1,70 @@
+1.0 bone frame 0.500000
+texture frame = anim 0.500000 -1
+-1 anim
+vertex -1 1.0 frame = vertex vertex texture 1.0 1.0 bone bone frame
+0.500000 texture 0.500000 0.500000
+1.0 anim
+1.0 material vertex = 0.500000 vertex anim material material 1.0 0.500000 vertex
+material =
+material anim texture texture
+material bone frame
+frame
+1.0 1.0 bone
+=
+material vertex -1 material frame = 1.0 -1
+-1 texture = 0.500000
+texture = texture
+bone vertex 0.500000 = -1 0.500000 frame frame -1 = 0.500000
+material
+1.0
+texture vertex texture
+material texture = texture anim
+material 1.0 frame 1.0 bone vertex = anim 1.0 texture
+-1 bone bone material -1 material material
+material material -1 texture texture 1.0
+-1 anim 1.0 anim 0.500000
+frame 0.500000 1.0 1.0
+material
+anim
+anim = anim
+texture 1.0 material = bone -1 vertex vertex material
+material = anim
+1.0
+1.0 0.500000
+bone vertex bone vertex
+0.500000
+anim
+bone vertex -1 -1 bone texture texture =
+frame 1.0 0.500000
+vertex bone =
+0.500000 =
+material texture
+-1 -1
+-1 = anim 1.0
+material texture = material = anim = anim 1.0
+material
+0.500000
+= anim -1 -1
+0.500000 -1 bone 1.0
+vertex material
+= bone 1.0
+material texture 0.500000 material anim vertex 0.500000 0.500000
+0.500000 texture material
+frame = anim texture = anim texture material
+0.500000 texture
+-1
+frame anim frame = = 1.0 0.500000
+anim vertex =
+=
+frame 1.0 anim vertex 0.500000 1.0
+frame 0.500000
+material
+bone material frame 1.0 vertex texture
+frame bone 0.500000 bone bone
+0.500000
+vertex 1.0 =
+frame anim
+anim bone
+anim 1.0 -1
+bone bone
+material vertex -1
\ No newline at end of file
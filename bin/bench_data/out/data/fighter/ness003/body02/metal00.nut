@@ -0,0 +1,18 @@
+texture material bone 1.0
+material
+0.500000
+-1
+bone = frame 0.500000 bone -1 1.0 anim
+texture texture texture -1 -1 vertex
+texture
+1.0 frame anim = 0.500000 -1 material 1.0 vertex 1.0
+= bone 1.0 vertex texture bone 0.500000 1.0 =
+texture frame frame vertex = = material -1 anim 0.500000 0.500000 vertex 1.0 = texture
+anim vertex 1.0 vertex 0.500000 material anim =
+-1 texture texture anim
+0.500000
+= frame 0.500000 texture
+texture material 0.500000 0.500000 bone
+anim -1 texture frame
+-1 frame = = anim
+1.0
\ No newline at end of file
@@ -0,0 +1,26 @@
+material
+bone frame 1.0
+1.0 frame
+anim anim texture texture vertex bone bone -1 frame bone 1.0 bone
+-1 frame -1 frame texture material material 0.500000 vertex -1 = 1.0 0.500000 vertex
+material
+material anim -1 vertex -1
+bone
+vertex anim anim texture
+-1
+material 0.500000 frame
+bone bone -1 1.0 vertex = frame
+vertex
+vertex
+bone
+texture 0.500000
+anim
+1.0
+vertex material = =
+0.500000
+frame 1.0 0.500000 texture frame
+frame
+1.0 =
+0.500000 = =
+0.500000
+material 1.0
\ No newline at end of file
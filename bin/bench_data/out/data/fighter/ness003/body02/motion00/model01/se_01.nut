@@ -0,0 +1,18 @@
+vertex
+anim
+bone
+texture texture
+1.0
+0.500000 1.0 = frame -1 bone bone vertex
+0.500000 material bone vertex 0.500000 bone anim 1.0 = anim
+anim
+frame vertex
+-1 texture =
+0.500000 -1 material frame material bone
+= 1.0 bone vertex
+anim material
+1.0 bone material
+-1 1.0 0.500000 0.500000 vertex material 0.500000 texture =
+bone -1 =
+material 0.500000
+material material vertex anim 
\ No newline at end of file
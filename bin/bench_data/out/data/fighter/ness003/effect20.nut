@@ -0,0 +1,8 @@
+anim
+material 0.500000 -1
+frame vertex bone vertex
+1.0
+texture
+-1 material
+vertex vertex material
+material texture vertex anim =
\ No newline at end of file
@@ -0,0 +1 @@
+yۢ͜v9q;]"nPxOsoW숻)4$>
\ No newline at end of file
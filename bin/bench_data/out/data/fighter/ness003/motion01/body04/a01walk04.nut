@@ -0,0 +1,28 @@
+anim
+1.0 frame frame
+bone 0.500000
+texture
+frame -1 bone material 0.500000
+anim vertex material material
+frame
+-1 0.500000
+vertex material material
+=
+vertex
+1.0 anim -1 frame
+-1 -1 material
+-1 anim
+0.500000
+material
+bone vertex
+frame = =
+frame anim anim 1.0 vertex texture material
+texture
+bone texture
+bone
+1.0 1.0 1.0 bone = bone material -1 -1 anim 0.500000
+-1 vertex 1.0 -1
+texture
+frame
+anim 0.500000
+texture vertex 1.0 texture texture texture = bone 1.0 ve
\ No newline at end of file
@@ -0,0 +1,27 @@
+texture
+bone material bone texture material vertex vertex 0.500000 = texture bone vertex material anim bone texture
+frame frame anim 0.500000 vertex =
+0.500000 = anim
+material
+frame -1 anim
+0.500000 -1 1.0 material bone anim vertex anim
+= 1.0
+-1 vertex
+anim
+material bone bone
+1.0
+material 1.0 vertex vertex -1 -1 frame -1 vertex material
+bone -1 1.0 anim frame anim
+material
+material 0.500000 1.0 anim 0.500000 material 1.0 material bone texture
+material
+texture frame = texture
+0.500000 anim material 0.500000 frame
+vertex = 0.500000 -1
+-1 =
+vertex frame -1 = vertex 0.500000
+-1 =
+frame material = bone -1
+frame anim
+material
+bone bone bone -1 mate
\ No newline at end of file
@@ -0,0 +1,5 @@
+=
+bone
+anim
+1.0
+bone = bone anim = material bone frame mate
\ No newline at end of file
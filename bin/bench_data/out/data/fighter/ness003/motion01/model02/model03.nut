@@ -0,0 +1,176 @@
+frame 1.0 anim
+frame frame texture texture 1.0 frame frame
+1.0 anim frame
+anim 0.500000
+0.500000 0.500000
+material material = 0.500000
+material texture 1.0 frame 0.500000 texture -1 0.500000 frame bone
+texture texture 1.0
+1.0 1.0
+material anim
+texture
+material frame
+= = 0.500000 bone frame 0.500000 -1
+= =
+bone = -1 0.500000 bone 0.500000 frame texture -1 frame frame
+material -1 1.0 texture
+material material -1 bone = bone anim -1 bone anim material =
+frame -1 = 1.0 bone anim 0.500000 frame
+texture -1
+1.0 material = 1.0 0.500000 vertex frame material
+-1
+= frame 1.0 = vertex
+-1
+bone = bone texture vertex frame = 0.500000
+-1 texture -1 1.0 material frame frame
+-1
+anim frame = bone anim -1
+-1 anim = 1.0 anim 1.0 bone bone frame material material -1 vertex
+bone anim 1.0 material 0.500000 0.500000 vertex vertex frame frame bone anim
+anim
+material anim
+bone bone 0.500000 -1 0.500000 material texture
+0.500000
+bone
+vertex anim vertex anim = material vertex 1.0 texture -1
+1.0 bone = vertex
+texture vertex
+anim anim frame
+= frame bone 0.500000 frame vertex bone frame -1 bone
+vertex bone anim 1.0
+vertex
+anim bone
+-1 1.0 = 1.0 bone texture
+anim vertex material frame bone texture frame 1.0 material frame
+-1 0.500000
+frame 0.500000 frame frame material
+vertex bone bone bone material frame bone bone vertex vertex material -1
+0.500000
+= = 1.0
+0.500000 anim texture 0.500000 texture vertex
+anim material bone -1 bone
+bone
+-1 -1 material texture -1 anim
+= vertex material
+frame anim
+material -1 =
+frame material texture 0.500000 0.500000
+bone bone bone
+frame
+0.500000 0.500000 =
+bone 1.0 0.500000 frame
+frame texture texture
+frame -1 frame vertex 0.500000 =
+vertex anim = anim 1.0 bone -1 = vertex -1 frame texture material 0.500000 -1 vertex 0.500000
+=
+0.500000 vertex
+1.0 bone bone -1
+texture
+-1 frame
+material
+frame 1.0 -1 = frame 1.0 vertex -1
+0.500000
+1.0
+= 1.0 anim vertex 1.0
+frame
+= -1 material 0.500000 vertex
+vertex
+frame
+vertex 1.0 vertex bone frame
+0.500000
+vertex 1.0 frame
+frame
+vertex 0.500000 = vertex frame frame material -1 texture
+material vertex texture frame texture 0.500000 anim vertex anim material anim = vertex bone frame texture texture
+bone =
+bone
+bone anim frame texture = -1 0.500000 anim -1 material
+anim = -1
+frame texture
+frame bone
+vertex bone =
+1.0 0.500000 1.0
+0.500000
+= 0.500000 material 1.0
+frame
+anim bone
+texture bone
+vertex anim material
+texture =
+1.0 material -1 bone
+frame vertex
+0.500000
+0.500000 0.500000 1.0
+material texture -1 bone 0.500000
+bone vertex bone 0.500000
+frame -1
+anim =
+-1 1.0 -1
+anim -1 bone =
+anim = material
+anim bone
+vertex
+texture texture texture = material frame
+0.500000 texture
+vertex bone
+material 1.0 1.0 0.500000
+bone 0.500000 = bone 1.0
+anim frame 0.500000 -1 1.0 = = texture
+anim = bone 0.500000 material 0.500000 vertex
+=
+0.500000 -1 =
+frame vertex
+1.0 anim bone
+0.500000 bone anim 1.0 anim = -1 1.0 0.500000
+texture
+1.0 0.500000 bone
+0.500000
+= frame vertex -1 texture 0.500000 -1
+vertex material
+-1
+vertex vertex texture
+frame 1.0 -1
+bone frame texture 0.500000 frame anim
+1.0 material anim material = 0.500000 vertex 1.0
+1.0 texture
+1.0
+frame 0.500000
+texture vertex 1.0
+anim
+-1
+1.0 0.500000 vertex
+material anim =
+=
+1.0 0.500000 material frame
+1.0
+0.500000 frame bone 1.0 -1
+0.500000 vertex bone frame bone vertex texture vertex -1 1.0
+frame anim anim anim = anim
+vertex 0.500000 bone anim
+-1 1.0
+frame -1 frame vertex
+bone anim
+=
+anim
+frame 1.0 anim material
+vertex texture frame frame
+frame -1 bone texture anim vertex 0.500000
+bone = 1.0
+texture vertex vertex
+-1
+texture
+texture -1
+1.0 1.0
+-1 1.0 0.500000
+-1 = frame 1.0 vertex 0.500000
+-1
+bone
+texture 1.0 bone anim texture anim -1 vertex bone anim anim
+vertex material material texture -1 = -1
+texture bone
+material -1 anim material
+=
+-1 = 0.500000
+0.500000 bone 0.500000 anim -1
+bone
+material = 0.500
\ No newline at end of file
@@ -0,0 +1,21 @@
+material 1.0
+= frame -1 1.0 texture -1
+texture material frame = -1 0.500000
+-1
+= = 0.500000 texture -1 texture 1.0 vertex
+bone =
+bone bone -1 material material bone texture 0.500000
+frame material
+bone 1.0 texture material vertex anim -1 vertex
+-1 anim texture bone material bone 1.0 texture vertex = anim
+texture anim vertex = texture 0.500000 = 0.500000 texture
+0.500000 1.0 -1 1.0 bone texture
+bone 1.0 anim -1 vertex 0.500000
+anim vertex frame 0.500000
+0.500000 0.500000 1.0 vertex texture frame anim texture
+material frame vertex
+texture 1.0 anim vertex = bone = anim vertex 0.500000
+material -1 vertex frame 1.0 frame 0.500000 material material = 0.500000 = vertex vertex material 0.500000 bone
+vertex
+-1
+0.500000 = anim -1 bone bone bone bone 1.0 -1 material material 0.500000 1.0 material
\ No newline at end of file
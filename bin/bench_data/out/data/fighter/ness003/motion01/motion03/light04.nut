@@ -0,0 +1,136 @@
+bone -1
+anim frame
+-1
+=
+bone -1
+0.500000 bone
+vertex = bone = 0.500000 anim material
+0.500000 = material
+-1
+texture bone 0.500000 vertex
+anim vertex material
+-1 -1 texture
+anim
+-1 -1 bone vertex 1.0 vertex frame
+material bone = = vertex 0.500000 0.500000
+material = bone
+vertex -1
+1.0 -1 anim material
+material -1 vertex 1.0 anim material bone
+material =
+bone anim frame frame
+vertex texture bone material
+anim
+0.500000 bone bone material anim vertex anim
+= bone = vertex material
+1.0
+texture 1.0 vertex
+0.500000 0.500000
+material
+frame
+= 0.500000 -1 0.500000 1.0
+1.0
+=
+= vertex 0.500000 vertex = 0.500000 anim -1 = 1.0
+1.0 texture vertex bone texture material anim bone =
+0.500000 frame material
+texture 1.0
+anim =
+0.500000 bone -1 = bone frame
+-1 0.500000 frame texture
+0.500000 texture = -1 material texture material -1 bone anim
+material texture
+-1 anim 1.0
+1.0 -1 anim = bone -1
+0.500000 vertex = bone 0.500000 vertex = -1 bone frame 1.0 0.500000
+= -1 texture
+texture 1.0 1.0 bone -1 0.500000
+vertex
+0.500000
+vertex
+texture vertex -1
+vertex
+= texture -1 -1 -1 texture -1
+vertex vertex 0.500000 material anim = 1.0
+0.500000 0.500000
+vertex
+bone
+texture vertex vertex anim
+1.0 vertex 0.500000
+= = = anim -1
+1.0
+1.0 bone
+0.500000
+anim = bone bone frame bone bone
+texture 0.500000 material bone
+frame = -1 -1 vertex
+vertex bone material
+vertex bone anim anim anim 1.0 anim texture -1 1.0
+-1
+texture 0.500000 = 0.500000 texture = texture
+1.0 material anim
+1.0 vertex =
+texture
+= texture frame
+vertex
+-1
+anim anim 0.500000 1.0 bone
+-1
+= bone
+texture
+1.0 texture 0.500000 vertex texture frame anim
+0.500000
+bone material = =
+material vertex 0.500000 frame
+=
+0.500000 frame texture texture
+frame -1 texture 0.500000 frame anim frame
+anim
+vertex frame texture
+vertex
+anim material material vertex -1 1.0 texture = texture frame
+texture 0.500000 material frame anim texture texture
+0.500000 texture frame texture =
+vertex frame frame bone 0.500000
+1.0 vertex material material frame bone bone frame 1.0 frame =
+-1
+-1 bone
+0.500000 frame vertex = -1 1.0 1.0 material = anim
+frame
+texture anim
+-1 vertex texture = 0.500000 anim
+bone texture =
+0.500000
+bone material
+vertex = 1.0 bone bone texture material 1.0 0.500000
+0.500000 vertex vertex =
+= texture texture 1.0 bone -1 anim texture frame 1.0 = -1 1.0
+material bone frame bone frame
+texture bone texture material frame material vertex
+frame -1 1.0 bone
+anim bone bone anim 0.500000 vertex = 1.0 vertex bone 1.0 vertex = =
+texture -1 material 1.0
+frame bone vertex 0.500000 =
+= frame bone = material anim 0.500000
+texture -1 vertex
+texture frame frame 1.0 1.0
+vertex 1.0 1.0 = 1.0 vertex -1 0.500000
+frame texture anim anim frame
+vertex texture
+anim 1.0
+anim
+0.500000
+material material -1 bone -1 vertex material =
+anim 0.500000 bone -1
+vertex 0.500000 frame frame
+frame frame texture
+-1 0.500000
+frame
+0.500000 bone
+material
+texture 1.0 frame
+material frame anim frame frame anim vertex -1 anim vertex texture
+texture
+1.0 0.500000
+material vertex frame = 1.0
+-1 anim an
\ No newline at end of file
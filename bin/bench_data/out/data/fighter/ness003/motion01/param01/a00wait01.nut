@@ -0,0 +1,5 @@
+anim
+=
+bone 1.0 anim 0.500000 texture
+vertex 0.500000 vertex material anim
+-1 frame materi
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex frame vertex
+vertex 1.0 frame material frame frame -1 vertex 1.0 -1
+-
\ No newline at end of file
@@ -0,0 +1,84 @@
+vertex = anim anim
+1.0 material texture material bone bone 1.0 -1 anim anim
+-1 0.500000 vertex vertex
+texture
+1.0 material
+1.0 0.500000 texture texture -1
+1.0 =
+-1 anim 0.500000 anim
+material anim bone
+anim -1 -1 = bone
+-1 material 0.500000 vertex
+material -1
+frame 1.0 material 1.0 frame
+anim material material frame 0.500000
+vertex
+material material
+1.0
+-1 -1 anim anim vertex anim 0.500000
+-1 -1
+0.500000 vertex frame vertex 1.0 1.0 material bone =
+material bone
+= 1.0 bone material
+-1 frame 0.500000 material
+anim
+texture
+anim texture texture frame
+1.0 texture = = anim
+vertex anim material -1 bone anim bone -1
+texture vertex 1.0 material -1
+vertex anim vertex
+texture 1.0 bone = = frame
+0.500000 0.500000
+anim frame
+texture
+anim vertex texture 0.500000 anim
+anim
+frame frame -1 bone 0.500000
+0.500000 vertex material = anim 0.500000 bone anim
+vertex
+material
+1.0 0.500000 texture 0.500000 vertex anim texture vertex =
+1.0 bone
+anim bone
+1.0 0.500000
+0.500000
+=
+texture
+texture
+anim bone texture -1 anim
+= texture -1
+0.500000 bone material anim
+anim -1 anim material 1.0
+texture
+material =
+1.0 texture anim
+vertex 0.500000 = 0.500000 0.500000 frame 0.500000 = material frame
+texture
+texture -1
+vertex
+= texture frame 0.500000 bone material
+0.500000
+1.0 0.500000
+texture
+-1 texture
+bone
+= -1 bone material -1 texture = material = =
+bone material bone
+frame material -1 texture -1 frame anim
+anim frame bone material bone material = =
+-1 vertex bone material
+-1 -1 = vertex
+texture
+bone = =
+material anim
+material material
+1.0 frame
+-1 0.500000
+material texture 1.0 texture
+material 1.0
+vertex material -1 bone 0.500000 bone
+0.500000
+frame bone = 0.500000 bone = frame = 1.0
+frame
+0.5
\ No newline at end of file
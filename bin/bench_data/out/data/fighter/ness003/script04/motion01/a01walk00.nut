@@ -0,0 +1,231 @@
+material = = bone bone 0.500000
+vertex 0.500000 material vertex 1.0 -1 0.500000 vertex
+material
+0.500000 vertex vertex bone 0.500000
+1.0 vertex vertex bone anim
+anim
+texture texture texture = frame 0.500000
+-1
+bone frame
+anim texture texture
+anim
+=
+vertex 0.500000 bone 1.0 anim vertex 0.500000 anim = anim
+texture 1.0 = = 1.0 anim
+bone frame = 1.0 0.500000
+vertex bone material 1.0 0.500000 =
+anim material frame material
+= 0.500000 1.0 = 0.500000 anim 0.500000 =
+= anim material
+material material vertex -1
+bone = =
+material -1 frame =
+-1 anim
+vertex
+1.0
+material
+bone frame
+material texture
+texture
+1.0 anim
+frame
+material
+0.500000 frame vertex vertex
+texture 0.500000
+= texture 0.500000 frame
+-1 vertex texture anim 0.500000 vertex
+-1 = 1.0
+anim
+0.500000 anim
+-1 0.500000 vertex
+texture -1 bone
+frame -1 = 1.0 bone anim 0.500000 =
+anim
+= material material bone frame = frame
+1.0 texture material
+= = material
+material 0.500000 1.0 bone
+1.0 1.0 =
+anim bone vertex
+bone anim frame
+texture
+0.500000 1.0 1.0 = vertex
+bone
+vertex
+bone
+1.0 texture 0.500000
+-1 0.500000 material
+1.0 anim material vertex -1 1.0 -1 frame texture
+0.500000 vertex
+-1
+0.500000 -1 frame = bone
+material vertex 0.500000
+=
+frame vertex -1
+frame bone bone -1
+-1
+= anim frame vertex vertex
+1.0 texture texture texture -1 bone material
+= bone vertex anim
+= 1.0 anim texture material
+-1 = 1.0
+1.0 material =
+= anim 0.500000 bone vertex anim frame anim texture bone material frame vertex 0.500000 material material 1.0 texture texture 1.0 = material 1.0
+bone
+texture material -1 0.500000 1.0 -1 vertex
+vertex 0.500000
+1.0 bone texture bone anim frame -1 material bone material anim 0.500000
+material
+frame
+bone bone 1.0
+1.0 material 0.500000
+-1
+0.500000 material bone bone bone vertex frame = -1 1.0 material bone
+vertex material 0.500000 vertex
+vertex bone bone
+vertex frame 1.0 1.0 anim frame frame
+bone -1
+0.500000 frame vertex
+1.0 vertex material frame frame
+= material = -1 =
+material texture
+-1 bone
+= -1
+= bone material anim material anim
+1.0 bone 1.0 1.0 1.0
+= 0.500000
+bone 0.500000 vertex -1 material anim vertex vertex material -1 material
+1.0 frame bone material 1.0 texture 0.500000
+1.0 = anim vertex vertex vertex 1.0 anim -1
+-1 -1 1.0 vertex bone
+frame bone -1 0.500000 = vertex = material bone
+anim vertex vertex bone bone anim 0.500000 frame 0.500000 material
+1.0 1.0 texture
+bone material vertex frame anim 1.0 material
+frame
+-1 1.0 bone frame -1 texture vertex 0.500000 bone -1
+texture texture
+0.500000 anim vertex
+anim
+texture anim anim
+texture bone bone
+material frame texture texture
+vertex
+material texture -1 frame anim bone 0.500000 frame
+= = bone
+bone
+bone
+bone
+vertex frame frame texture
+0.500000
+texture -1
+1.0 bone anim
+material anim anim texture vertex anim vertex vertex =
+texture
+bone bone material 0.500000 = frame 1.0 anim material = =
+bone material bone vertex
+0.500000 texture =
+material anim 0.500000 texture anim bone = frame 0.500000
+anim anim
+1.0 texture
+anim =
+frame
+frame texture bone frame = frame -1
+= frame =
+bone 0.500000 0.500000 1.0 1.0 -1 0.500000 0.500000 = 0.500000
+= anim 1.0 bone = bone 1.0 material -1 anim 1.0
+frame frame
+texture
+= 1.0 -1 frame material vertex 0.500000 anim texture frame -1
+0.500000
+-1 -1 texture 1.0 material texture anim material texture vertex
+frame =
+bone 0.500000
+vertex material
+texture
+material texture
+vertex vertex material frame bone vertex material bone bone texture 0.500000
+0.500000 texture anim 0.500000
+-1
+0.500000 = vertex 1.0
+frame texture 1.0
+= frame
+= 0.500000
+texture
+1.0 frame vertex
+material frame vertex anim frame anim
+frame 0.500000 vertex vertex
+0.500000 bone 0.500000 material 0.500000 0.500000 0.500000 1.0 = texture bone anim vertex -1 anim material texture material
+anim 1.0
+frame
+-1 -1 vertex
+bone vertex frame texture
+-1 1.0 bone =
+frame
+vertex texture =
+texture anim 1.0 -1 texture 0.500000 material anim =
+-1 frame frame 1.0
+anim -1
+material vertex -1 anim material material
+= material
+material = vertex = frame
+0.500000 -1 0.500000 -1 -1 texture anim texture
+= 1.0
+= -1 vertex frame anim bone =
+texture -1
+anim
+0.500000 = frame 0.500000 0.500000 =
+= material 0.500000 anim
+1.0 frame anim
+bone
+bone
+texture
+texture material frame
+-1 0.500000 1.0 material vertex 0.500000 1.0 -1
+texture 0.500000
+bone -1
+material material material
+vertex frame bone bone
+-1 texture -1
+bone 0.500000 bone anim
+texture texture vertex bone
+= anim material
+0.500000
+bone = = material material vertex
+-1 0.500000
+bone material -1 vertex 1.0
+frame 0.500000 bone bone
+= = texture material
+vertex anim
+frame material
+anim -1 -1 0.500000 bone anim
+frame vertex material = 0.500000 =
+bone bone material 0.500000 0.500000
+bone
+0.500000 frame 1.0 -1
+material bone -1 material vertex = = 0.500000 texture material anim
+frame material vertex frame bone texture 0.500000 -1
+= vertex frame
+bone = = =
+=
+frame anim
+vertex -1 = anim
+texture anim 0.500000 1.0 -1 0.500000 material
+-1 frame texture anim vertex -1 = 0.500000 bone bone 1.0 anim
+-1 anim vertex
+bone
+0.500000 1.0 1.0 0.500000
+bone frame texture
+anim
+texture
+frame
+0.500000 material material frame -1
+anim
+0.500000
+texture vertex -1 -1 anim material texture frame bone texture -1
+material
+-1
+vertex material 0.500000
+bone
+bone texture
+material vert
\ No newline at end of file
@@ -0,0 +1,25 @@
+material
+1.0 1.0 bone vertex frame
+frame
+material
+anim -1 material texture material 1.0
+vertex
+anim 0.500000 texture
+texture 0.500000 vertex = 0.500000 1.0
+=
+= bone bone
+-1 texture texture vertex
+material
+anim 0.500000 texture vertex material
+anim
+1.0
+0.500000
+= anim 1.0
+-1 =
+0.500000 1.0 1.0 anim anim
+anim
+1.0 material = material = material =
+=
+bone =
+-1
+frame material 0.500000 bone vertex material 1.0 texture -1 bone frame 0.50
\ No newline at end of file
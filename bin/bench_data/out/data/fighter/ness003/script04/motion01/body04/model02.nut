@@ -0,0 +1 @@
+1F [JJ\(kK$Ƀ)1d*0J
\ No newline at end of file
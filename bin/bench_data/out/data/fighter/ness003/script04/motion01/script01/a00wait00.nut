@@ -0,0 +1,304 @@
+vertex material
+anim texture
+anim 0.500000 1.0 anim 0.500000 bone anim vertex bone vertex vertex bone vertex 1.0 texture bone frame 1.0
+anim
+texture
+1.0 0.500000 0.500000 0.500000 anim vertex anim
+-1 vertex = 0.500000 texture 1.0 bone 1.0 anim = = -1 vertex material vertex 0.500000 0.500000
+frame anim = 0.500000
+-1 -1 -1 0.500000
+0.500000 1.0 -1 =
+1.0 material 0.500000 bone
+texture = 0.500000 vertex
+bone bone frame 1.0 material bone anim vertex
+= anim
+bone =
+bone
+= anim -1 -1 0.500000 anim texture
+bone material anim bone material texture
+1.0 = 1.0
+frame frame 0.500000 -1
+texture 1.0 anim -1 texture =
+material vertex =
+texture 1.0
+=
+anim = frame frame
+material
+-1 texture texture
+0.500000 -1 bone
+-1 material vertex 0.500000 vertex material = = 1.0 1.0 1.0 anim texture 0.500000
+vertex
+texture texture -1
+0.500000 material bone material 1.0
+bone anim bone anim 1.0 material vertex
+bone material material
+material vertex -1 texture = frame material
+texture frame texture = frame texture
+anim =
+= -1 = = texture 0.500000
+vertex anim
+0.500000 frame texture = texture bone vertex 1.0
+anim =
+bone material vertex vertex -1
+-1 vertex vertex frame frame
+texture
+1.0
+texture
+bone frame texture
+= 0.500000 texture
+texture = bone
+texture bone bone
+1.0
+0.500000 anim
+anim 1.0 bone 0.500000 material -1 1.0
+bone material -1 texture bone
+0.500000 bone texture frame =
+= bone 0.500000 = texture frame bone texture -1 texture -1
+-1 0.500000 1.0
+= frame = anim material
+material = bone
+bone
+anim
+= bone
+material
+vertex 1.0 1.0 anim frame
+0.500000 0.500000 1.0 1.0 texture
+-1 vertex -1 1.0 material 0.500000 0.500000
+= texture texture vertex =
+anim frame = -1
+0.500000 anim
+-1 bone material material
+-1 bone texture
+0.500000 -1
+anim vertex 1.0 0.500000 vertex material
+anim vertex
+vertex vertex 0.500000 -1 frame bone
+vertex anim -1 vertex
+texture material bone
+=
+bone -1
+vertex 0.500000 -1 material -1
+0.500000 bone 1.0 bone 0.500000 bone anim
+vertex = = = 1.0 frame frame 1.0 frame
+bone -1 vertex = material bone
+material vertex
+material 0.500000 bone
+0.500000 = bone anim bone
+-1 anim
+1.0
+1.0
+anim bone texture -1 material
+-1 texture texture
+= vertex vertex
+0.500000 = = =
+vertex
+texture bone
+frame texture frame vertex
+= =
+anim -1 texture
+= bone texture bone vertex 1.0
+bone
+-1 frame
+anim 1.0 1.0 bone =
+= 0.500000 = anim
+anim = 1.0 -1 anim material 0.500000 vertex
+-1 frame texture anim material
+vertex vertex -1
+=
+1.0 vertex vertex =
+texture
+bone texture = vertex
+=
+bone bone material bone
+texture anim texture -1 material
+frame =
+-1 vertex anim
+= frame =
+1.0 -1 vertex texture vertex
+anim
+material frame
+texture frame 0.500000 -1 -1 vertex
+-1 frame anim texture
+texture 0.500000 vertex 0.500000 bone 0.500000 1.0 frame -1 frame anim =
+material material = = vertex anim vertex texture -1
+material
+anim vertex material
+vertex = 1.0 frame -1 =
+bone anim -1 0.500000 anim
+=
+bone
+1.0 texture bone
+frame
+texture frame
+vertex texture 0.500000
+1.0 vertex texture 1.0 vertex material -1
+texture anim -1 bone bone
+anim
+anim vertex 0.500000 texture vertex -1 0.500000 vertex
+frame -1 =
+= bone = 0.500000
+1.0 1.0 bone frame =
+material frame
+bone texture
+1.0
+material frame frame frame anim -1 material frame texture material = anim material vertex
+-1 frame 0.500000
+= material material
+bone 0.500000 anim 1.0 0.500000 bone 1.0 1.0 1.0 frame texture texture bone 0.500000 vertex -1 bone 0.500000 material
+vertex 0.500000 -1 -1
+vertex -1 material material
+texture
+frame vertex material bone bone
+frame
+texture material vertex material
+vertex -1 0.500000 0.500000
+material bone frame vertex 0.500000 texture 0.500000
+vertex =
+=
+material texture 0.500000 anim frame 1.0 frame
+0.500000 -1 = material vertex
+texture
+bone -1 = vertex
+-1
+= 0.500000 texture frame = 1.0 anim
+0.500000
+-1
+vertex texture anim -1 0.500000
+material anim frame
+vertex
+vertex texture 0.500000 vertex vertex
+1.0
+0.500000 vertex anim = anim 1.0 = bone texture vertex
+frame material -1 frame
+1.0 0.500000 -1 0.500000 bone
+frame anim 1.0 -1 0.500000 material 1.0 1.0 vertex
+0.500000 vertex -1
+0.500000
+bone frame anim anim 1.0
+material vertex texture vertex -1 -1 -1 1.0 -1
+0.500000 0.500000 frame -1 0.500000 texture -1 0.500000 frame vertex = vertex material material 1.0 = 0.500000 anim
+bone
+1.0 -1 anim
+0.500000 = 1.0
+bone texture
+anim
+-1 -1
+vertex bone texture
+1.0
+= frame material
+0.500000 -1 bone
+1.0 0.500000
+vertex -1 anim 0.500000
+-1 1.0 1.0 1.0
+frame -1 texture 1.0 bone texture
+-1 anim =
+bone
+=
+1.0 frame frame vertex vertex bone = texture frame anim -1 1.0
+material
+0.500000
+texture texture
+texture
+texture texture frame -1 anim frame
+material texture material material
+material anim texture
+bone 1.0 vertex 1.0 0.500000 = 1.0 =
+bone
+vertex vertex = anim -1 0.500000 material 1.0 bone material anim -1 material frame texture anim 1.0
+bone
+frame
+frame frame 0.500000 = frame material bone anim 1.0 texture texture bone texture 0.500000 = 0.500000 1.0
+-1 vertex 1.0 =
+= anim 0.500000
+1.0 material anim 0.500000 material texture 0.500000 0.500000 vertex 0.500000 material =
+material
+vertex frame anim 0.500000 texture material
+frame
+vertex
+= -1 material anim -1 anim bone
+-1 0.500000 vertex material = 0.500000 vertex texture bone texture vertex material texture frame anim
+vertex bone material anim anim 0.500000 1.0
+bone 0.500000 bone bone 0.500000 texture
+-1 anim 1.0 = anim bone 1.0 bone = material -1 1.0 texture bone material bone
+frame -1 -1
+anim
+anim = -1 -1 bone 0.500000
+0.500000 1.0 texture
+frame
+material material = =
+bone 0.500000 frame
+1.0 anim bone
+material vertex -1 bone material vertex
+frame
+vertex 1.0 texture material
+1.0
+anim 0.500000 = bone bone
+vertex 0.500000 bone frame
+texture
+vertex anim bone -1 anim vertex
+texture 0.500000 bone
+bone -1 material -1 bone
+0.500000
+-1 0.500000 anim vertex 0.500000 material frame frame frame
+= frame vertex material
+texture anim material =
+-1 frame = -1 texture frame vertex
+material texture -1 = material frame -1 1.0
+1.0 bone anim frame anim 1.0
+1.0 bone texture
+material = material 1.0
+0.500000 = anim material
+0.500000 -1
+vertex = anim bone frame 0.500000 1.0 vertex
+anim 0.500000
+= 1.0
+0.500000 0.500000
+bone texture 0.500000 = anim frame bone
+anim material material bone frame bone vertex texture = -1
+1.0 texture = bone frame
+material material anim
+bone
+1.0 vertex
+0.500000 texture anim
+frame 0.500000 1.0 1.0
+0.500000
+bone 1.0
+vertex = bone bone =
+texture texture 1.0 =
+texture bone = texture material anim 1.0 texture -1 frame -1 -1 frame vertex texture = texture frame
+-1
+bone =
+bone
+0.500000 frame
+vertex 0.500000
+anim = 0.500000 bone bone vertex anim texture -1 material texture vertex = =
+frame 0.500000
+1.0 material
+texture
+vertex 1.0 frame bone material texture vertex 1.0 1.0 1.0 = = vertex -1 vertex bone
+=
+material 0.500000
+bone -1 bone frame
+1.0
+0.500000 texture texture
+bone vertex 1.0
+frame
+material
+vertex
+bone material material frame texture vertex -1
+-1 1.0 frame anim
+texture -1
+0.500000 vertex bone =
+-1 material
+texture vertex bone = anim 0.500000 = texture vertex material anim vertex texture 0.500000 material
+material vertex 1.0 material vertex anim
+=
+0.500000 0.500000
+vertex anim texture frame
+0.500000 frame 1.0 vertex bone vertex texture
+0.500000 -1 bone texture 0.500000 bone anim 1.0 1.0
+-1
+1.0
+texture bone frame texture vertex
+-1 -1 texture 1.0 0.500000 anim 1.0 texture
+0.500000 material vertex
\ No newline at end of file
@@ -0,0 +1,13 @@
+frame bone
+texture 0.500000 material 0.500000 vertex -1 = frame 0.500000
+vertex bone frame
+frame
+vertex texture
+texture
+-1 texture
+=
+bone
+texture
+1.0 vertex frame 1.0 vertex 0.500000
+1.0 vertex texture -1 texture bone
+-1 1.0 material
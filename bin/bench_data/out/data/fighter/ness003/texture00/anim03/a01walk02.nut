@@ -0,0 +1,2 @@
+= 0.500000 = material
+vertex 0.50
\ No newline at end of file
@@ -0,0 +1,84 @@
+= 0.500000
+=
+frame
+1.0 vertex
+-1 1.0
+texture
+=
+material texture vertex vertex
+0.500000 texture 1.0 1.0 bone -1
+vertex
+bone
+texture texture anim texture
+material texture
+-1
+0.500000 texture material material
+=
+texture frame
+= frame vertex vertex = frame vertex
+texture
+texture bone
+-1 = 1.0 =
+material texture bone material material bone
+= anim = frame material
+0.500000 anim frame vertex 1.0 =
+frame material bone 1.0 -1
+texture -1 vertex material
+frame
+bone
+vertex anim frame 0.500000 vertex vertex material -1
+frame vertex -1 -1 -1 material 1.0 vertex vertex bone frame material frame bone -1 frame
+material
+bone material
+-1
+vertex 1.0 1.0 = 0.500000 material bone frame anim
+frame texture
+anim -1 anim = bone material material 1.0 1.0 material = frame texture -1 0.500000 = 1.0
+-1 frame
+vertex =
+frame
+vertex material 1.0 material -1 1.0
+frame
+-1 material bone
+bone material -1 = -1 = -1 vertex = material = 1.0 texture material
+vertex frame vertex material texture frame frame 0.500000 material = bone vertex
+-1 bone
+-1 =
+frame
+anim material 0.500000 0.500000 = -1 bone texture bone
+vertex = 0.500000
+0.500000 bone vertex texture anim
+texture frame 0.500000 texture texture vertex 0.500000
+bone vertex bone 0.500000 1.0 material
+anim
+= material material material bone bone
+bone frame frame
+material
+bone anim 0.500000 1.0 0.500000 bone
+= vertex
+1.0 texture bone frame material 0.500000 anim texture
+0.500000
+0.500000
+anim 1.0
+anim bone texture -1 -1 frame material anim = -1 1.0 bone vertex
+material 1.0 1.0 anim material anim
+0.500000 -1 material texture = 1.0 texture
+material -1 0.500000 0.500000 1.0 0.500000
+1.0
+bone 1.0
+frame material 0.500000
+texture
+bone
+bone
+0.500000 frame bone bone 0.500000 material
+0.500000 =
+anim frame
+= -1 bone frame 0.500000 bone material
+= 1.0 material 0.500000 bone material material
+material vertex anim -1 -1 vertex material = vertex
+texture texture vertex =
+material bone 1.0 material texture 0.500000 =
+-1
+frame 1.0
+0.500000 = 0.500000 texture -1
+bone 1.0 anim 
\ No newline at end of file
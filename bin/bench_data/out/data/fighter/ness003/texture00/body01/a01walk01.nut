@@ -0,0 +1,240 @@
+= texture -1 texture -1 1.0 material bone
+-1 bone vertex
+= 1.0 0.500000 bone -1 material anim 1.0
+bone 1.0 bone 1.0 = material 1.0 bone
+bone
+texture anim -1 anim material 0.500000
+vertex
+bone material -1
+-1 texture 1.0
+vertex material bone vertex = 0.500000 vertex
+0.500000 1.0 bone frame
+texture texture
+texture vertex
+1.0 frame material anim bone
+bone -1 bone bone
+0.500000 material bone -1 bone
+material frame
+bone
+-1 0.500000
+-1 texture bone bone 0.500000 = texture 0.500000 = = = frame frame
+frame
+-1
+-1
+vertex
+vertex bone
+bone material material -1
+material texture
+anim -1
+texture
+= frame bone bone 1.0
+bone
+=
+frame frame
+vertex
+anim texture anim 1.0 bone anim
+frame material -1
+texture -1 anim
+0.500000
+= material bone material bone = bone
+vertex vertex anim frame material vertex -1 vertex vertex vertex
+=
+-1 -1
+vertex frame
+material bone
+= anim 1.0
+-1 material -1 0.500000
+anim bone anim
+vertex 1.0 frame vertex = vertex 1.0 frame frame material 1.0 0.500000 = 1.0 = vertex 0.500000 =
+-1 0.500000 anim = -1 bone anim vertex
+texture -1
+frame
+anim
+-1 0.500000
+0.500000 vertex
+= -1 1.0
+0.500000
+1.0 1.0 1.0 0.500000
+texture vertex vertex texture vertex
+bone bone
+-1
+frame material
+anim bone 0.500000
+anim bone material -1 -1 bone =
+texture -1 material bone material anim 1.0 = -1 bone bone vertex 1.0
+-1 = anim texture -1 vertex
+frame bone
+bone material
+= anim -1 frame bone
+=
+vertex =
+0.500000 = -1 bone 1.0 -1 -1
+vertex 1.0 bone
+frame bone
+frame texture bone -1
+vertex texture 0.500000 texture
+-1 vertex frame -1 frame = frame 0.500000 bone
+1.0
+texture
+frame
+material
+0.500000 1.0
+0.500000
+frame -1 frame 0.500000 1.0 anim bone vertex
+frame texture
+texture
+material texture
+bone
+1.0
+frame 1.0 -1 texture anim frame
+1.0 -1
+frame anim
+1.0 1.0 vertex -1 1.0 1.0 1.0 =
+bone
+0.500000 1.0 0.500000 = material frame -1
+vertex = anim -1
+0.500000 =
+vertex =
+anim = -1 frame texture 1.0 material 0.500000 0.500000
+vertex anim 0.500000 anim
+= 0.500000 0.500000 bone vertex frame -1
+frame anim
+texture = material vertex
+vertex vertex material anim 0.500000 bone frame
+material vertex 0.500000 frame texture
+0.500000 material texture material
+1.0 frame vertex 1.0 frame -1 bone
+texture
+bone frame 0.500000
+frame 0.500000
+= frame
+0.500000 texture material 0.500000 1.0 vertex = bone anim 1.0
+bone 0.500000
+1.0 1.0 0.500000
+material 1.0 1.0
+0.500000 -1 material
+vertex anim anim texture vertex 1.0
+anim texture 1.0 vertex bone vertex
+anim
+1.0
+bone bone -1 frame 0.500000
+frame material material material
+= texture
+1.0 1.0
+texture
+0.500000 vertex material
+1.0
+anim
+bone = vertex
+0.500000
+frame vertex
+anim = texture vertex = vertex anim
+frame 0.500000
+texture bone anim
+0.500000
+= anim
+0.500000 0.500000 material
+texture = frame vertex vertex
+bone vertex vertex vertex
+vertex 0.500000 1.0 texture texture frame texture
+material 1.0 = -1 -1 vertex =
+material
+frame frame -1 frame -1 bone
+bone anim bone anim
+frame texture anim texture = frame material vertex texture
+material 0.500000 bone frame -1 vertex
+texture anim frame vertex texture
+anim vertex
+= =
+texture frame
+= frame
+1.0
+0.500000 frame 1.0 material material bone anim 1.0 1.0 -1 anim material 0.500000 material
+texture
+material
+1.0 =
+1.0 = anim bone
+texture frame vertex 0.500000 texture bone material material
+anim vertex 0.500000
+frame
+1.0
+frame vertex texture anim 0.500000 bone
+bone vertex 1.0 bone
+= texture
+material
+frame bone
+anim
+frame texture
+material
+material material = bone material 1.0 vertex texture texture frame 0.500000 material texture frame texture = 1.0 frame bone 0.500000 0.500000 = frame vertex =
+frame
+texture 0.500000 0.500000 anim material texture material frame
+frame material = vertex
+1.0 bone 1.0 1.0
+anim frame vertex anim frame
+0.500000 frame = material material
+-1
+anim vertex anim frame vertex 1.0 1.0 = = bone =
+1.0 bone =
+anim anim vertex texture anim anim
+vertex -1 -1 frame = frame 1.0 vertex
+texture anim = material material 0.500000
+0.500000 anim -1 1.0 anim
+anim
+0.500000 vertex
+-1 frame = frame = 1.0 bone 1.0
+material material
+bone material anim 1.0 1.0 material = 0.500000
+anim -1 -1 material vertex 1.0
+-1
+material 1.0 0.500000 vertex vertex
+frame 0.500000 anim texture = 1.0 bone
+frame bone material material
+0.500000 1.0 1.0 anim material vertex =
+-1 1.0 = texture bone texture -1
+material material
+= anim vertex vertex 0.500000 material
+anim
+-1 texture 1.0 0.500000
+material bone 0.500000 material
+1.0 material anim vertex =
+texture = 1.0 texture
+1.0 1.0 frame bone bone frame bone
+= anim vertex
+=
+material 1.0 0.500000 0.500000 material 1.0 -1 = frame
+-1 0.500000 anim vertex
+material = 0.500000 -1
+1.0 vertex 1.0 -1
+bone bone = frame anim texture vertex material -1 bone
+anim material frame texture frame bone bone material texture
+material anim
+vertex -1 -1 anim
+texture frame
+0.500000 -1 0.500000 1.0
+0.500000
+frame
+anim texture anim 0.500000
+bone
+bone
+vertex
+vertex material frame material
+texture 0.500000
+bone 1.0
+material material anim anim frame material =
+-1 material -1 0.500000 0.500000 texture texture 1.0
+anim vertex
+vertex bone
+0.500000 frame material -1 material -1 0.500000 -1 -1
+bone
+bone anim frame material -1
+-1 =
+material
+-1
+-1 = texture frame bone material -1 material -1 vertex texture material -1
+0.500000
+material
+=
+anim
+=
+0.500000 1.0 texture 0.500000 bone vertex
\ No newline at end of file
@@ -0,0 +1,294 @@
+anim 0.500000 texture
+material frame bone
+frame
+1.0
+bone material bone 1.0 texture material material material
+bone texture
+texture =
+anim material 1.0 = texture 1.0 texture material vertex 0.500000 bone texture vertex bone vertex anim 0.500000 -1 0.500000 = frame bone =
+material frame bone bone
+material 0.500000
+1.0
+material frame frame material frame material anim -1 bone
+anim vertex texture
+vertex
+0.500000
+bone vertex bone frame 1.0 texture -1 texture =
+bone
+-1 = anim bone texture 1.0 = anim
+vertex anim texture
+-1 texture texture
+anim -1 = =
+frame anim =
+-1 bone frame vertex 0.500000 -1 bone
+1.0 texture
+= bone frame
+1.0 1.0 frame anim
+0.500000 texture frame material vertex -1 material 1.0
+bone frame anim
+material
+vertex 0.500000 texture frame texture bone 1.0 vertex texture frame 1.0
+vertex = anim anim frame texture 1.0
+0.500000 texture 1.0 texture -1 bone
+bone = texture 1.0
+texture 0.500000 0.500000 -1 = material
+= anim texture = -1 -1 bone material =
+frame bone frame frame 0.500000
+material frame -1 -1 frame = 1.0 anim vertex
+= 0.500000 texture
+1.0 = anim
+texture frame -1 bone 1.0 texture 0.500000 anim material
+vertex
+0.500000
+1.0
+bone 0.500000 =
+0.500000 1.0 -1 0.500000
+0.500000 anim 0.500000
+-1
+vertex
+0.500000 texture bone
+1.0
+anim = material
+bone frame frame =
+anim vertex -1 0.500000
+= -1 -1 bone 1.0 1.0 material frame vertex vertex texture frame =
+bone material anim texture anim 1.0 0.500000 -1 frame vertex bone = anim bone 0.500000 1.0 texture
+material vertex -1 1.0 vertex material -1 texture material
+texture frame 0.500000 bone
+0.500000 -1 1.0
+bone
+bone material texture
+material 1.0 bone = bone
+frame -1 vertex
+frame texture bone
+1.0 anim 1.0 material material anim material texture material
+vertex bone 1.0 bone anim 1.0
+= texture -1 texture 0.500000 1.0 vertex = -1
+bone texture vertex bone = frame vertex texture 0.500000 vertex frame
+anim texture
+material -1 material texture bone texture bone
+bone -1
+bone 1.0
+material texture 0.500000 -1 material -1
+bone material texture frame 0.500000 material
+frame
+0.500000
+anim anim 0.500000 anim
+anim 1.0
+1.0 vertex material
+texture
+bone 0.500000 -1 texture frame
+anim -1 frame -1
+texture material = anim 1.0
+bone material texture -1 = bone vertex
+texture
+= = frame bone vertex vertex
+= 1.0 vertex = -1
+= texture
+-1 1.0
+material texture
+frame -1 vertex
+anim bone
+1.0 bone
+frame material 0.500000
+0.500000
+bone
+vertex 0.500000 = =
+bone bone
+0.500000 0.500000 -1 bone
+bone
+frame vertex texture bone 1.0 = vertex material = frame 1.0 bone bone 1.0
+anim frame anim
+anim
+0.500000 =
+-1 frame
+0.500000 anim bone material -1 =
+vertex = -1
+anim texture texture -1 texture 0.500000 0.500000 = frame vertex texture -1 frame
+-1
+= anim
+bone
+bone bone
+bone = material
+-1 1.0 -1 texture texture anim texture frame
+1.0 bone -1 vertex = bone bone frame
+texture 0.500000 1.0 material =
+material vertex
+texture
+anim =
+= bone frame = frame 1.0 1.0 material -1 1.0
+-1 -1 -1
+frame texture
+texture frame 0.500000 vertex anim
+texture vertex 0.500000 frame texture
+texture 0.500000 material vertex frame -1
+0.500000 material bone bone
+-1
+texture 1.0
+anim material vertex material = texture frame -1 0.500000
+0.500000 = frame material -1 texture 0.500000 material texture -1
+anim
+material bone 1.0 0.500000
+0.500000 -1 0.500000
+material
+-1 0.500000 anim bone material vertex bone
+texture
+vertex anim 0.500000 texture material -1 1.0
+-1 frame vertex anim frame frame vertex anim -1
+0.500000
+0.500000 bone 0.500000 -1 anim 1.0
+1.0
+= material
+material bone
+frame 0.500000
+vertex
+vertex
+0.500000
+frame 1.0 material -1 bone material texture = frame
+1.0 material
+= anim bone
+-1 =
+0.500000 0.500000 frame
+vertex bone 0.500000 0.500000 1.0 vertex anim texture 0.500000 texture
+texture vertex 1.0 frame bone 1.0 texture
+= texture
+material anim frame 0.500000 0.500000 0.500000
+frame 1.0
+texture
+0.500000
+1.0
+0.500000
+material 0.500000
+1.0 = material
+texture frame
+1.0 texture 0.500000 = bone 1.0 -1
+1.0 anim
+0.500000
+texture bone
+material frame frame texture =
+frame
+texture bone
+-1 vertex frame 1.0
+= -1 -1 0.500000 -1 -1
+bone texture
+0.500000 bone = bone vertex
+frame
+bone 1.0 0.500000
+= bone frame 1.0 1.0 anim vertex
+texture texture material texture
+0.500000 texture texture bone vertex 0.500000 -1 texture texture -1 texture
+texture texture material 0.500000 texture
+material
+1.0 -1 = bone vertex -1 =
+1.0
+-1 frame
+vertex 0.500000 = vertex = material material frame 0.500000
+vertex anim anim = texture frame 1.0 bone = 0.500000 bone 1.0 0.500000 0.500000 -1 -1 vertex frame bone -1 0.500000 bone vertex frame vertex =
+material 0.500000 bone
+1.0 vertex frame 0.500000 texture anim 1.0 anim
+material -1 1.0
+vertex
+frame frame vertex anim bone bone
+anim 1.0 -1 material 1.0
+-1 vertex
+0.500000 frame
+=
+bone 0.500000 texture 0.500000 -1
+texture 0.500000 vertex bone bone
+0.500000 bone -1 bone
+= bone texture 0.500000 vertex bone 0.500000 0.500000 vertex frame
+vertex anim 1.0
+vertex 1.0
+vertex = texture material bone 1.0
+=
+bone material texture frame 1.0 vertex anim anim 1.0 1.0 -1
+anim
+frame texture 1.0
+-1 texture = anim 0.500000 anim = texture 0.500000 0.500000 0.500000
+0.500000 frame
+frame -1 frame 1.0 anim 1.0 bone = 1.0 texture
+= bone frame -1
+bone vertex anim material material
+texture -1
+material bone
+1.0
+bone
+texture anim 1.0 bone
+material material -1
+bone 0.500000
+= frame frame vertex frame 1.0 anim = = vertex vertex
+= frame material bone = texture material =
+frame material = -1 frame 1.0 1.0 1.0 anim 1.0 texture -1 frame
+anim frame
+texture -1 1.0 material
+0.500000
+0.500000 vertex
+-1 anim
+anim -1 frame frame anim
+frame -1 texture
+-1 bone bone vertex 0.500000 anim texture 1.0 texture
+texture = 0.500000 1.0 0.500000
+1.0
+-1 material = = vertex material
+-1 frame
+=
+material texture material = material -1 bone
+vertex -1 texture 0.500000 bone vertex
+=
+-1 bone 0.500000
+anim = -1 frame = vertex material 1.0 vertex -1 1.0
+1.0 frame
+1.0
+0.500000 1.0 0.500000 1.0
+material
+material
+material vertex vertex 1.0 texture = texture material
+anim anim frame
+material frame texture =
+frame material 1.0
+vertex anim 1.0 0.500000
+= anim material texture bone material bone
+frame vertex vertex
+anim
+-1 1.0 0.500000 frame 1.0 1.0 vertex 1.0
+bone
+bone -1 anim anim anim vertex anim
+0.500000 anim -1 material material -1
+texture
+frame
+texture
+1.0
+1.0 -1 bone texture frame vertex 1.0
+material
+bone
+vertex 0.500000
+1.0 = -1 0.500000 =
+texture
+material 0.500000 bone 1.0 anim
+1.0 0.500000
+= -1 bone 1.0
+1.0 -1 anim material = anim frame material material vertex vertex material anim anim
+texture texture
+material 1.0 material 0.500000 bone -1 bone
+0.500000 1.0 frame bone
+material
+1.0 -1
+anim anim -1 -1 anim material
+frame 1.0 -1
+anim anim 1.0 bone
+0.500000 anim texture frame -1 -1 1.0 bone anim material vertex = anim
+-1
+0.500000 texture 1.0
+= -1 0.500000
+-1
+anim
+anim
+= = 1.0 1.0 vertex material = -1
+-1
+frame -1 frame bone
+-1 material -1 vertex
+texture frame vertex anim -1
+anim 1.0 0.500000 texture vertex frame bone = bone frame material
+vertex anim anim 0.500000 vertex
+-1
+texture texture =
\ No newline at end of file
@@ -0,0 +1,39 @@
+-1 frame
+frame bone 1.0 1.0 -1
+0.500000 material anim bone 1.0 texture texture frame
+vertex
+0.500000 frame 1.0 = frame frame 1.0 material material
+texture material
+material -1
+vertex
+anim
+0.500000
+frame texture vertex 1.0 0.500000 anim frame frame
+-1 -1 material
+vertex =
+= frame anim 1.0 = -1 1.0
+material 0.500000 0.500000 =
+0.500000 0.500000 = 0.500000
+texture material = -1 1.0
+bone 1.0 texture texture
+material anim frame vertex =
+= bone 1.0 vertex vertex vertex
+vertex
+anim anim =
+bone texture 1.0 0.500000 vertex frame 0.500000 anim texture 1.0
+bone texture
+texture
+-1 1.0 frame
+bone
+vertex 1.0 bone
+-1 texture vertex
+bone
+1.0
+frame anim -1 anim
+vertex -1
+material frame = frame = frame
+material material
+=
+0.500000
+frame
+frame 1.0 = 1.0 bone
@@ -0,0 +1,139 @@
+material bone
+anim bone
+texture texture
+texture
+bone 1.0 0.500000 = texture
+texture -1
+material
+material material bone material -1
+anim 1.0 anim
+bone 1.0 anim bone vertex material anim anim texture = bone 1.0 texture texture
+texture vertex vertex 1.0 anim
+=
+bone 0.500000 1.0 frame vertex frame anim frame
+vertex -1 material 1.0 bone -1 bone texture material material anim frame = -1
+bone
+vertex material 1.0
+vertex
+frame 1.0
+0.500000 bone
+material -1
+bone 1.0
+1.0 vertex anim 1.0 -1 1.0
+bone frame 1.0 material
+1.0 texture texture 0.500000
+bone texture 1.0
+texture -1 texture bone bone anim =
+-1 1.0
+bone -1 1.0 frame material frame bone
+=
+-1 frame = frame vertex
+-1 material
+0.500000 bone anim frame vertex frame
+0.500000
+texture
+material
+vertex texture -1 1.0 1.0 0.500000 = bone = -1 frame bone = -1 =
+vertex
+anim material
+anim
+material -1 vertex 1.0 material
+vertex
+material = bone
+0.500000 -1 bone -1 material
+= vertex 0.500000 vertex
+=
+anim
+bone -1
+bone 1.0 frame
+texture texture
+-1 anim -1 1.0 texture vertex vertex vertex 0.500000 material 0.500000
+vertex 1.0 material material bone = texture 1.0 = -1
+vertex frame vertex vertex vertex
+texture bone 1.0 texture anim material 1.0 material frame -1 0.500000 texture 1.0
+material material frame
+0.500000 vertex anim
+1.0 -1
+-1
+texture
+1.0 bone texture anim
+material bone -1
+anim frame 0.500000
+= texture 1.0
+anim material = -1 anim frame bone texture
+material 1.0 bone
+-1 0.500000 = 1.0 bone =
+1.0 -1 vertex bone 0.500000 1.0 material
+-1 texture texture = -1 = =
+anim material
+material texture texture
+1.0
+vertex texture
+texture
+= anim vertex bone = vertex
+vertex -1 frame 1.0 frame 0.500000 1.0 anim = frame material frame bone
+1.0
+material anim frame -1 bone
+bone material texture
+anim 0.500000
+material vertex 0.500000 frame frame 1.0
+frame
+= =
+=
+vertex
+anim vertex
+anim
+anim = anim vertex anim
+anim bone bone = = 0.500000 0.500000 1.0 bone bone
+material vertex frame =
+texture
+1.0 -1 texture -1
+1.0
+1.0 material
+=
+material texture vertex texture bone 1.0 texture material texture anim
+vertex 1.0 1.0 vertex bone frame texture 0.500000 0.500000 texture
+-1 1.0 material 0.500000 bone bone texture frame
+0.500000 material texture anim anim material anim texture bone texture material frame material frame vertex = = frame -1 = bone texture
+vertex texture vertex
+frame
+-1
+= vertex texture bone frame anim vertex texture bone -1 anim
+-1 0.500000
+texture vertex
+= 1.0 1.0 frame texture material bone
+vertex texture
+-1 -1
+1.0
+bone = material 1.0 -1 1.0 bone material frame bone material 0.500000 texture
+material =
+vertex bone material 1.0
+1.0 bone 0.500000 material
+-1 bone 1.0 anim frame anim
+texture vertex 0.500000 -1
+anim vertex anim = vertex bone anim bone
+texture
+texture
+-1 material bone anim bone texture -1 = frame
+bone frame texture texture anim 0.500000 anim vertex
+-1
+= bone frame
+=
+material texture -1 0.500000 bone = anim texture anim 1.0 1.0 -1 frame vertex 0.500000 anim bone 1.0 texture 1.0 frame frame
+= = material bone anim
+0.500000 -1 vertex vertex = anim frame bone bone texture
+bone anim frame frame
+anim 1.0 anim = 1.0 frame = material
+texture texture texture
+= frame anim anim 0.500000
+= anim = texture
+texture 1.0 material bone =
+texture
+-1 = bone 1.0
+anim 0.500000 texture = = 1.0 texture bone 0.500000 texture
+0.500000
+texture =
+bone material -1
+vertex bone
+texture
+texture 0.500000 vertex 1.0 texture = texture anim bone texture 0.500000 -1 anim text
\ No newline at end of file
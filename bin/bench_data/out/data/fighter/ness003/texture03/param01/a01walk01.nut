@@ -0,0 +1,18 @@
+bone material 1.0
+material material anim vertex 1.0 -1 1.0
+frame bone 1.0 = frame vertex texture 1.0 frame -1
+-1 -1 vertex anim = anim
+bone bone = texture anim = 1.0 frame texture vertex 0.500000 = anim
+vertex = material material =
+1.0 -1 -1 anim anim = -1 0.500000 anim 1.0 0.500000 texture
+material bone
+1.0
+frame material material 1.0 =
+bone material =
+-1 bone 0.500000 1.0 material frame 0.500000
+bone
+-1 anim
+0.500000 bone vertex
+frame 1.0
+-1 bone
+an
\ No newline at end of file
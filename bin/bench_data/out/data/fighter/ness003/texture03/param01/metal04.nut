@@ -0,0 +1,130 @@
+bone
+-1 anim texture
+=
+0.500000 = -1 0.500000 = vertex
+anim = material frame
+1.0 -1 anim vertex anim frame anim
+vertex 1.0
+material material bone vertex texture anim = frame -1 frame = -1 -1 texture 1.0 bone
+bone 1.0 texture texture 1.0 texture frame =
+1.0 texture anim anim -1
+material
+1.0
+-1 vertex
+1.0 -1 = 0.500000 frame
+frame 1.0 vertex frame frame texture 0.500000 vertex bone -1 -1 anim vertex 1.0 -1 frame 1.0
+1.0 vertex -1 material 1.0
+material frame texture
+vertex = -1 anim 1.0 texture vertex texture texture
+bone material texture = texture -1 1.0 = material anim anim frame anim 1.0
+0.500000 1.0 material
+1.0 -1 1.0
+texture
+=
+bone anim frame anim material material material material = anim frame
+bone
+material frame
+= texture 0.500000
+-1
+-1 frame 0.500000 1.0
+-1 1.0
+vertex material 1.0 texture
+-1
+frame texture bone 1.0
+1.0 = material
+texture = texture = texture texture 1.0
+material
+anim 0.500000 -1 vertex material frame -1 frame vertex 0.500000 frame 0.500000 1.0 -1 material frame 1.0
+anim
+anim material texture 1.0 =
+texture frame -1 -1 1.0 anim texture =
+bone 0.500000 anim bone bone 0.500000
+material
+vertex
+1.0 anim 0.500000 frame 1.0
+bone
+1.0 anim bone
+vertex frame anim 1.0 frame
+bone material
+bone 0.500000
+material texture material = texture texture texture vertex material
+1.0 = -1 frame anim = anim -1
+frame bone bone texture material vertex texture
+0.500000
+anim 0.500000 0.500000
+1.0 = vertex = -1 frame frame = 1.0
+0.500000 = 0.500000 1.0 texture 1.0 vertex material frame frame frame material bone vertex frame bone
+0.500000 anim 1.0 1.0 frame vertex anim vertex vertex 0.500000 anim bone
+bone
+0.500000 -1 1.0
+= -1 texture bone anim = 1.0 frame bone
+=
+-1 1.0 bone
+0.500000
+1.0 frame
+texture
+anim
+bone
+vertex frame anim
+bone = vertex bone vertex material material vertex anim texture
+1.0 1.0 texture frame -1 0.500000 texture bone 0.500000 frame anim -1 bone bone frame
+material
+vertex bone
+-1 = anim anim
+=
+vertex -1 bone vertex
+anim frame vertex bone material 0.500000 1.0
+= 0.500000 vertex anim
+vertex vertex 1.0 frame -1 frame frame
+bone bone texture texture vertex
+anim
+-1 0.500000
+texture bone = bone material material 0.500000 anim -1 material 1.0
+0.500000 material
+material frame frame bone
+-1
+texture anim -1 1.0
+0.500000
+bone vertex frame texture texture
+-1 bone bone vertex
+bone frame bone vertex anim = bone
+1.0
+= -1
+material
+-1
+material bone 1.0 material = 0.500000 0.500000 anim = texture 0.500000
+0.500000 =
+texture = = = -1 bone 0.500000 = anim vertex vertex bone -1 1.0
+=
+vertex
+texture = -1 = vertex material texture 0.500000 frame 0.500000
+texture
+material
+-1 = anim
+texture
+vertex texture -1
+vertex
+= anim
+bone
+-1 1.0
+vertex -1 texture texture
+= 1.0 texture = texture
+= material texture 0.500000 vertex
+texture material frame = -1
+texture 1.0
+bone material =
+anim
+1.0 0.500000 1.0 = bone 1.0 material = 1.0 0.500000
+texture anim 1.0
+= vertex
+bone vertex 0.500000 0.500000 -1
+bone vertex
+texture
+bone
+bone -1 vertex
+anim -1 = -1
+bone material anim vertex vertex bone texture 1.0 material anim material frame
+bone texture
+texture vertex 1.0 bone anim frame vertex 1.0
+texture anim material
+frame bone frame -1 
\ No newline at end of file
@@ -0,0 +1,26 @@
+bone anim 0.500000 material texture frame anim anim texture 1.0 0.500000 vertex 0.500000 texture 1.0 0.500000
+= anim 1.0 texture
+= bone frame
+0.500000 bone
+bone 0.500000 anim texture 0.500000 texture material 0.500000 vertex material
+bone
+=
+texture
+texture vertex 1.0 bone 0.500000 material
+-1 bone
+-1 bone
+-1 -1 frame material 0.500000
+= = material
+0.500000 texture anim bone texture 1.0 0.500000
+material vertex bone 0.500000 1.0 = material vertex vertex 0.500000 frame frame material anim frame
+-1 vertex vertex material 1.0 = bone texture bone = = texture
+texture bone
+0.500000 texture frame bone 0.500000 =
+bone anim
+material 0.500000 anim =
+material
+1.0 1.0
+material
+1.0
+material 1.0 bone frame texture material material vertex vertex vertex material vertex = anim 0.500000 = 1.0 0.500000 material -1
+anim material mater
\ No newline at end of file
@@ -0,0 +1,43 @@
+bone 1.0
+texture 1.0 =
+1.0
+= 0.500000 texture texture texture
+vertex frame bone -1
+1.0 material vertex
+0.500000
+material
+= 0.500000 = =
+material
+= bone = = bone anim
+anim anim
+vertex 0.500000 -1 texture
+anim 1.0
+=
+texture material 1.0
+material = =
+frame material
+0.500000 vertex frame material 1.0
+material bone texture anim material -1
+vertex vertex material 1.0 anim
+anim 1.0 anim 0.500000 material texture
+-1 -1 bone
+material anim
+1.0 bone frame texture material material
+texture 1.0
+0.500000 anim
+vertex frame
+=
+frame bone bone texture anim bone material material material bone vertex -1
+= 1.0 = material
+anim vertex frame 0.500000 vertex material bone
+-1 material
+-1 -1 material bone frame
+bone texture material
+texture frame material
+anim anim
+bone frame anim
+bone anim -1 frame texture frame 0.500000 anim 0.500000 bone anim 0.500000
+= texture 0.500000 = = -1 vertex frame bone = texture vertex -1 = =
+1.0 material frame vertex = anim = 0.500000 0.500000
+vertex 1.0 material
+anim texture fr
\ No newline at end of file
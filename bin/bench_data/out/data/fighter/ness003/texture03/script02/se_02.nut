@@ -0,0 +1,5 @@
+bone = bone
+texture
+1.0 frame 1.0
+0.500000 anim vertex
+te
\ No newline at end of file
@@ -0,0 +1,3 @@
+material -1 bone 1.0 anim -1
+anim = -1 bone 1.0 bone material frame -1 0.500000 material
+0.500000 texture 1.0 material -1 
\ No newline at end of file
@@ -0,0 +1,15 @@
+0.500000 texture anim bone 1.0 bone
+=
+-1 0.500000 frame material 1.0 texture texture 1.0
+bone
+-1 -1 = 1.0
+anim vertex = 1.0 texture
+frame texture vertex -1 material bone vertex = vertex frame
+1.0
+=
+-1 bone -1
+texture bone bone material
+-1 -1 bone = anim texture 1.0 material frame
+1.0 bone vertex
+material -1 texture = material -1
+anim
@@ -0,0 +1,3 @@
+anim -1
+-1
+0.500000 texture texture 0.500000 1.0 b
\ No newline at end of file
@@ -0,0 +1,19 @@
+anim 1.0
+material -1 -1
+bone
+frame -1
+1.0 material -1 texture 1.0 0.500000 1.0 1.0
+anim 1.0 -1 material -1 -1 texture
+0.500000 = material frame
+frame material anim 0.500000 frame
+-1 material anim vertex
+1.0 vertex vertex anim material
+1.0 = 1.0 1.0 -1 texture anim material anim texture 0.500000 material frame material 0.500000 texture frame texture 0.500000 frame
+texture 0.500000 texture
+-1 = 1.0 -1 = vertex anim vertex frame 0.500000 -1 = 0.500000 vertex texture material 1.0 material
+-1 -1 material 1.0 bone
+-1 0.500000 =
+frame
+frame
+texture 1.0 material vertex frame 0.500000 texture bone
+material
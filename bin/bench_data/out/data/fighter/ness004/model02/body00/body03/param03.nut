@@ -0,0 +1,112 @@
+frame bone material
+0.500000
+bone =
+material vertex material bone material vertex bone
+vertex
+anim -1 anim -1 1.0
+vertex frame 0.500000 0.500000 bone texture 0.500000
+bone frame bone
+-1 bone frame
+0.500000
+0.500000 vertex texture 1.0 bone bone vertex bone 1.0 texture texture
+anim bone 0.500000 anim -1 anim = =
+frame anim 1.0 0.500000 1.0 frame bone 0.500000 material frame anim 1.0
+anim
+material
+-1 =
+vertex = texture
+-1 1.0 material anim
+1.0 =
+-1 bone
+frame bone -1 bone
+frame
+texture 0.500000
+frame
+material
+vertex anim -1 material bone vertex texture = 0.500000
+-1 0.500000 bone vertex -1 texture bone texture
+anim
+anim 0.500000
+=
+-1 frame anim 0.500000
+vertex texture
+0.500000 -1 texture frame
+anim texture -1 0.500000 0.500000 anim = 0.500000
+-1 -1 vertex
+frame texture frame = -1
+frame = anim 1.0 frame 0.500000 bone -1 anim vertex frame vertex
+anim
+vertex
+frame -1
+anim
+1.0 = -1 vertex anim
+= material
+= vertex = = 1.0 material bone 1.0 texture material = 1.0 -1 = bone bone vertex
+0.500000 bone 1.0 anim
+-1
+material material material = anim vertex -1 vertex anim
+-1
+bone bone anim texture
+0.500000 = 0.500000 = = vertex frame -1 vertex material
+bone texture
+0.500000 anim frame -1 0.500000 0.500000 material bone frame 1.0 -1 material vertex frame 1.0
+bone vertex material
+0.500000 texture bone
+anim bone texture bone vertex
+bone bone bone
+-1 frame material material
+texture = anim
+frame
+1.0 = 1.0 anim vertex
+texture
+1.0 = frame
+vertex
+= 1.0 -1 0.500000 -1 0.500000 =
+0.500000 texture
+anim bone
+0.500000 vertex
+= vertex 0.500000 0.500000 = 1.0 = -1 -1
+texture
+0.500000
+frame
+frame -1 0.500000 vertex bone
+0.500000 -1
+anim 1.0 =
+-1 texture bone 1.0
+frame 0.500000 =
+= 0.500000 bone 0.500000 anim frame 0.500000
+1.0 1.0 = anim frame bone frame
+bone material 0.500000 frame texture
+texture frame texture = material frame -1 material bone
+= 0.500000 bone material
+frame
+anim 1.0 anim 0.500000 -1 texture anim = -1 bone
+vertex 0.500000 0.500000 anim vertex material
+anim 0.500000 vertex
+frame -1
+-1 anim bone 1.0
+frame anim texture texture 0.500000 = frame
+material 1.0 -1 bone frame
+anim anim 0.500000 anim vertex frame 1.0 material =
+vertex
+texture
+anim 1.0 1.0
+0.500000 vertex material -1 texture -1 =
+-1 vertex texture material 0.500000 0.500000
+anim vertex vertex 0.500000 frame frame bone = 1.0 frame vertex
+frame material bone material 1.0 vertex texture material 0.500000 frame anim
+=
+frame vertex material material bone
+vertex anim -1
+texture = material anim vertex vertex
+bone material = frame material vertex
+material
+material =
+bone
+vertex
+1.0
+frame -1 1.0 vertex bone texture
+bone 1.0
+1.0 vertex anim
+bone frame anim = 0.500000
+0.500000 -1 bone 0.500000 0.500000 bone mater
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1
+-1 -1
+texture 1.0 bone
+0.500000 anim texture frame
@@ -0,0 +1,5 @@
+frame anim 1.0 bone
+anim bone
+texture = texture
+bone anim -1 anim =
+anim 1.0 material
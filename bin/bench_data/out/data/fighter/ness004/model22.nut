@@ -0,0 +1,2 @@
+texture vertex vertex texture
+verte
\ No newline at end of file
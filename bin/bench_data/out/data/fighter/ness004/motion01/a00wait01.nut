@@ -0,0 +1,45 @@
+vertex material bone texture
+1.0 1.0 = = bone bone material 0.500000 vertex
+1.0
+material anim material 0.500000 material = = = 0.500000 0.500000 anim
+material 0.500000 texture anim 1.0 vertex vertex vertex
+anim
+bone
+-1 material material
+material texture
+frame anim anim
+bone
+anim anim =
+texture
+material
+0.500000 anim frame 0.500000 frame -1 anim 0.500000 texture bone 1.0 -1
+0.500000 texture
+bone vertex 0.500000
+frame anim material vertex
+-1
+anim
+1.0 texture 1.0 =
+anim -1 vertex texture 0.500000 1.0 frame = vertex material anim vertex
+bone -1 = 0.500000 bone frame 0.500000 0.500000 = texture
+material
+vertex 0.500000 anim
+anim = material bone anim -1 -1
+1.0 material material = frame
+frame texture vertex vertex 1.0 bone 1.0 bone material =
+texture material texture vertex texture 1.0 anim texture -1 0.500000
+0.500000 -1 anim texture texture 0.500000 1.0 bone texture material
+frame -1 frame 0.500000 material -1 vertex 1.0 vertex
+vertex texture
+-1 = 0.500000
+bone
+frame
+0.500000 -1 bone = anim texture material
+bone
+texture
+bone bone texture 1.0
+vertex
+frame material material =
+frame
+bone vertex frame material anim material vertex bone texture
+0.500000 0.500000 -1
+-1 mat
\ No newline at end of file
@@ -0,0 +1,10 @@
+frame
+0.500000 -1 bone -1 texture anim texture
+-1 = 1.0 vertex anim bone bone 0.500000 -1 = bone
+= material
+-1 = material
+anim
+= anim 1.0
+texture texture
+anim = anim = texture
+anim 1.0 materi
\ No newline at end of file
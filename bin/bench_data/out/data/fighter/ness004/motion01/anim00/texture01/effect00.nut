@@ -0,0 +1,32 @@
+texture texture 1.0
+texture anim
+-1 vertex anim 1.0 -1 frame bone 1.0 frame 1.0 anim
+material anim material 0.500000 anim
+-1 -1
+1.0
+vertex vertex bone
+bone material texture texture vertex 0.500000
+0.500000 1.0 1.0
+0.500000 bone texture 0.500000 0.500000 = frame
+texture material frame vertex
+frame =
+vertex texture
+-1 1.0 frame texture
+bone material bone = vertex bone
+material vertex = 0.500000 vertex texture = anim bone vertex anim frame texture 0.500000
+anim
+texture -1 texture bone bone
+1.0
+frame
+anim
+texture
+anim vertex 1.0 anim 0.500000 1.0 frame texture
+vertex
+anim 0.500000 1.0 bone 0.500000 bone
+= = 1.0 -1 texture anim
+1.0
+bone frame texture texture
+material -1 0.500000 anim = = -1 anim bone texture
+bone vertex bone 0.500000 -1 texture 1.0 = =
+material
+anim
@@ -0,0 +1,18 @@
+vertex material anim 0.500000
+material
+-1
+texture
+= 1.0 frame 0.500000 -1
+frame material
+1.0 0.500000 0.500000 anim = 1.0 0.500000 anim
+1.0 anim
+frame material anim vertex
+vertex = texture vertex anim frame frame 0.500000 1.0 bone -1
+-1 = texture frame
+vertex vertex frame bone =
+material 1.0 = material -1
+vertex -1 anim frame -1 frame
+material vertex 1.0 anim 0.500000 anim 1.0
+bone = 1.0 vertex
+frame
+material 
\ No newline at end of file
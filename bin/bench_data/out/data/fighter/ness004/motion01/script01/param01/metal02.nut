@@ -0,0 +1,11 @@
+material -1 anim
+vertex
+texture
+0.500000 0.500000 0.500000 bone = material
+vertex 1.0 bone
+material 0.500000 vertex bone
+= vertex vertex vertex material material
+= texture bone material vertex 0.500000 vertex 0.500000
+texture
+0.500000
+vertex bo
\ No newline at end of file
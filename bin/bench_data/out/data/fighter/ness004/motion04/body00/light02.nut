@@ -0,0 +1,15 @@
+-1 vertex bone
+anim 0.500000 anim
+anim -1
+= 1.0
+bone material -1
+= frame vertex frame vertex material material
+vertex bone 1.0 material bone = frame vertex anim frame 0.500000 1.0 texture vertex
+0.500000 material
+1.0 = vertex frame -1 vertex bone
+material bone texture material -1 bone =
+anim bone
+bone bone bone texture material = 0.500000 1.0 texture 1.0 material bone = anim -1
+material 1.0 frame
+=
+m
\ No newline at end of file
@@ -0,0 +1,159 @@
+material bone vertex 0.500000 -1 bone bone material 0.500000
+texture material
+0.500000 -1 bone vertex material material 0.500000 vertex 1.0 anim frame 1.0 frame -1 vertex 1.0 = 1.0
+= =
+vertex 0.500000
+bone texture anim bone material -1 vertex texture
+material vertex frame bone material bone vertex = vertex bone bone 1.0 = 0.500000 material
+vertex texture frame = =
+=
+anim frame texture
+material bone bone 0.500000 material bone = bone
+= frame bone
+frame anim anim material bone bone vertex texture
+frame -1 = material vertex
+anim 0.500000 material anim
+anim -1
+anim anim -1 bone anim
+0.500000 1.0 = vertex bone anim 0.500000 vertex
+vertex
+material
+1.0 0.500000 = =
+anim anim = vertex
+frame frame material 0.500000 0.500000
+anim
+-1 -1 texture bone bone
+1.0 bone bone material vertex =
+vertex anim 1.0 vertex -1 =
+= frame
+bone 0.500000
+-1 texture vertex = bone
+= anim
+1.0 =
+1.0
+vertex = bone vertex texture
+bone
+-1 0.500000
+-1 anim 1.0 1.0 -1
+texture vertex
+vertex -1 1.0 = -1
+1.0
+=
+1.0 vertex bone material
+anim = material
+texture bone material
+frame 1.0 bone -1 bone = material anim texture bone 1.0 -1 frame 1.0
+material -1 0.500000 -1 texture 1.0 1.0 vertex = texture = 1.0 material
+0.500000
+vertex = vertex
+anim
+texture -1 texture material vertex = frame bone 1.0 = frame
+vertex =
+anim frame 0.500000 -1 1.0 -1 -1 1.0
+vertex bone anim = frame -1
+texture anim anim
+material material 1.0 1.0 texture texture anim texture texture =
+vertex vertex
+bone bone frame -1 -1
+1.0
+anim
+frame texture
+-1
+1.0 anim
+material bone texture = bone =
+-1
+anim texture 0.500000
+bone anim 0.500000 texture anim -1 anim -1 texture
+vertex vertex
+texture -1 = -1
+= material 0.500000
+texture bone bone
+frame bone frame
+bone
+anim = frame
+anim 0.500000
+material anim bone 1.0
+=
+texture frame
+material
+anim material texture
+-1 material texture frame 1.0 frame
+material material frame
+bone
+material
+= texture
+vertex
+bone material anim 0.500000 frame
+material 0.500000 anim 1.0 texture 0.500000 bone
+0.500000
+1.0 vertex =
+frame
+vertex = frame -1
+material frame
+material
+0.500000
+0.500000
+anim vertex -1 0.500000
+vertex anim texture anim -1 bone
+texture 0.500000
+bone bone
+vertex 0.500000 material bone 0.500000 vertex vertex bone texture vertex bone
+material =
+0.500000
+bone bone
+anim
+= 1.0 -1 anim -1 frame anim 0.500000
+=
+frame bone
+0.500000 texture -1 -1 vertex -1 frame vertex frame texture texture 0.500000 texture texture
+frame anim 1.0
+material material
+texture
+bone anim 1.0
+anim material anim
+-1
+0.500000 bone anim bone
+material 0.500000 vertex
+bone
+texture = anim 0.500000
+0.500000 =
+= material = -1 anim
+anim bone -1 frame bone vertex frame
+0.500000 frame
+= bone 0.500000 frame =
+1.0 = material -1 = material
+= -1 texture anim
+anim bone 0.500000 material
+= 0.500000
+bone -1 anim = vertex texture
+0.500000 0.500000 frame 0.500000 frame 0.500000 texture frame texture vertex material
+material = frame -1 1.0
+0.500000
+texture texture 0.500000 1.0 -1 = vertex
+anim
+anim vertex
+0.500000 texture 0.500000 material frame 1.0 0.500000
+vertex
+anim 0.500000 vertex bone
+bone
+1.0 = frame
+-1
+1.0 0.500000 anim
+0.500000
+1.0 1.0
+-1 1.0
+0.500000 vertex bone
+material bone -1 texture
+material bone bone bone bone frame
+frame 1.0
+material vertex bone frame
+= 0.500000 frame frame -1 = -1 -1 vertex
+vertex
+= 0.500000 material
+anim bone
+bone
+= -1 0.500000 frame frame
+texture anim texture = frame
+-1 material anim 0.500000
+1.0 0.500000 = anim -1
+0.500000 fra
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 = vertex -1 texture frame vertex material
+vertex anim bone texture anim bone material anim texture
+0.500000 0.50
\ No newline at end of file
@@ -0,0 +1,278 @@
+texture
+-1 bone anim texture vertex vertex anim material -1
+anim 1.0 frame anim bone material texture bone
+frame frame bone
+frame
+vertex 1.0 1.0 vertex anim bone = anim anim = 0.500000 bone material
+material = frame
+-1 -1 1.0 0.500000
+frame frame
+material
+frame frame
+bone
+-1 vertex
+material 0.500000 texture
+anim bone anim 1.0
+vertex anim anim
+bone 0.500000 material
+material texture texture = vertex = texture
+anim material texture frame vertex 0.500000 1.0 anim
+texture material =
+-1 bone
+= vertex vertex material anim material frame
+material -1 texture
+bone
+material =
+anim =
+bone
+= 0.500000 material 0.500000 = 1.0 frame frame
+frame
+0.500000
+bone 1.0 = frame texture = bone 0.500000 texture vertex texture
+= = bone material
+material -1 -1 anim vertex texture
+anim 1.0 frame
+0.500000 -1 0.500000
+anim
+material
+texture anim = anim 0.500000 -1
+vertex texture anim -1 0.500000 -1 material material texture material frame 1.0
+0.500000 vertex frame
+bone bone
+-1 texture 1.0 material 1.0 material bone
+frame material 0.500000 texture -1 = bone 0.500000
+texture -1 vertex anim
+0.500000
+frame texture frame = material anim
+frame
+texture 0.500000 0.500000
+-1 frame material = vertex
+-1 bone 1.0 bone vertex =
+0.500000 texture 0.500000 vertex frame vertex anim anim
+vertex material bone 1.0
+0.500000
+1.0 1.0 frame vertex vertex anim = material -1
+= -1 =
+frame
+frame anim anim texture -1 0.500000 1.0 -1 texture 0.500000 0.500000 0.500000 bone 1.0
+bone vertex
+texture
+material frame texture texture frame anim
+frame
+vertex anim vertex
+anim 0.500000
+= texture texture vertex texture bone material
+bone =
+bone 0.500000 texture texture
+0.500000 1.0
+bone frame vertex
+vertex 0.500000 = texture
+= bone
+bone
+vertex
+= bone material bone
+frame = texture
+= texture vertex frame anim texture texture =
+= material 1.0 0.500000 material
+1.0 0.500000 frame
+= texture
+0.500000 0.500000 -1 bone vertex 1.0 1.0 anim vertex 0.500000 bone texture bone material material
+-1
+1.0 vertex anim -1 texture anim
+=
+frame vertex texture 1.0 vertex 0.500000
+material texture 1.0 vertex material 0.500000 = anim -1 =
+anim texture material
+bone
+texture texture bone material = anim
+material =
+material
+= = bone
+vertex vertex vertex material vertex
+frame frame frame vertex material bone bone vertex frame 0.500000
+material material 1.0 1.0 frame bone vertex vertex material 1.0 1.0 material bone anim texture bone frame material frame material
+1.0 0.500000
+0.500000 1.0 1.0 0.500000
+bone 0.500000 0.500000 texture
+-1 =
+= -1
+0.500000 frame
+frame
+texture frame 1.0
+material 1.0 anim
+= material frame
+-1 =
+material = frame
+vertex 0.500000
+anim material
+= 0.500000
+0.500000 -1 -1
+frame
+frame texture 0.500000 anim material frame 0.500000 vertex material
+texture 1.0 anim
+-1
+bone -1 0.500000
+= material vertex material
+1.0 material bone
+-1 0.500000 vertex material frame -1 material material
+-1 0.500000 1.0 bone 0.500000 texture anim texture
+texture texture
+1.0 anim vertex -1 bone texture 0.500000
+texture 1.0 bone bone material
+= frame bone 1.0 frame frame
+-1
+=
+texture -1 0.500000 0.500000 anim
+material
+1.0 frame
+texture
+anim
+vertex anim =
+1.0 bone
+-1
+anim material -1 = texture 1.0
+anim material
+frame = = 1.0
+anim 1.0 material texture anim texture
+vertex texture
+bone
+vertex frame -1 = bone material
+frame
+frame texture 0.500000 1.0
+bone texture material frame
+material
+vertex 1.0 = material bone = -1 texture bone texture 0.500000
+texture
+vertex 0.500000 bone texture 0.500000 vertex
+anim material
+vertex frame 0.500000 -1 texture
+bone
+anim 1.0
+0.500000 bone vertex texture frame
+bone
+= texture 1.0 material 0.500000 1.0 = bone texture
+=
+0.500000 anim frame -1
+1.0 anim
+-1
+1.0 vertex
+bone
+material frame 1.0 frame
+texture vertex -1 material material 1.0
+material anim material anim
+anim vertex
+1.0 anim vertex 0.500000 vertex 0.500000
+material
+material anim vertex frame
+vertex -1 -1
+material
+bone -1 frame anim 1.0 = texture vertex
+material
+texture -1 frame
+-1 = bone
+-1 anim
+0.500000 material material frame -1 vertex 0.500000 material
+anim vertex
+-1 1.0
+anim 0.500000
+material texture material texture 1.0 1.0 vertex 0.500000 vertex frame material vertex texture 0.500000 1.0
+bone 0.500000 frame texture vertex bone 0.500000 1.0
+-1 1.0 1.0 vertex -1 vertex anim -1 frame
+texture 0.500000
+material 1.0 0.500000
+= = frame texture
+frame 0.500000 -1 1.0
+material
+vertex -1 1.0
+-1 texture -1 -1 texture 1.0 = material 1.0 material frame anim 0.500000 material 0.500000 material texture -1 = 1.0 bone anim texture
+material -1 vertex
+= -1 1.0 1.0 anim texture bone
+anim vertex anim frame
+1.0 anim -1 -1 anim 1.0 = frame 1.0 anim bone bone vertex -1 bone material material bone material frame frame 0.500000 frame frame
+bone
+texture
+0.500000 bone material = vertex texture 0.500000
+bone bone 1.0 frame frame texture frame
+=
+-1
+vertex
+vertex 1.0 frame bone bone =
+material -1
+texture bone texture vertex
+0.500000 1.0 texture bone
+bone frame texture material -1 1.0
+material material -1
+= 1.0
+0.500000 bone material 0.500000
+-1 =
+frame material frame 0.500000 vertex -1 1.0
+1.0 material
+frame 0.500000
+0.500000
+vertex texture texture 1.0
+vertex material
+0.500000 0.500000 1.0 -1 vertex -1
+1.0 1.0 texture
+1.0 texture -1 0.500000 0.500000
+vertex anim texture
+anim 1.0 = 0.500000 =
+=
+material frame =
+-1 frame
+texture bone frame
+0.500000 anim texture -1 vertex bone texture
+frame
+-1 material 1.0 0.500000
+vertex texture texture bone
+material
+0.500000 texture
+0.500000 -1 bone
+frame
+vertex bone 1.0 bone 1.0 1.0 1.0
+bone frame 0.500000
+texture -1 material 0.500000 texture texture 0.500000
+material =
+frame vertex anim 1.0 -1
+frame
+-1 vertex texture
+1.0
+frame -1 -1
+0.500000 -1 anim
+texture
+-1 anim -1 anim = frame
+frame frame
+0.500000
+material texture -1 vertex vertex anim
+= 0.500000 0.500000 -1
+vertex texture texture anim material
+frame 0.500000
+texture texture material vertex vertex texture material bone
+texture vertex 1.0 texture frame material = frame
+=
+bone 1.0 0.500000
+bone material
+anim
+1.0 frame vertex 1.0
+1.0
+1.0 1.0 1.0
+vertex texture
+bone texture 1.0 = 0.500000 -1 texture = =
+texture
+anim -1
+bone -1 material texture
+1.0 -1 frame = vertex 0.500000 material
+0.500000
+0.500000
+bone
+-1 texture = anim -1
+frame
+material
+texture
+vertex frame = 1.0 1.0 = bone texture = frame
+= -1 frame material 1.0 bone
+frame vertex 1.0 texture
+=
+anim frame 0.500000 material
+= material
+material bone frame vertex bone
+= vertex 
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex =
+anim -1
+1.0
+vertex vertex materi
\ No newline at end of file
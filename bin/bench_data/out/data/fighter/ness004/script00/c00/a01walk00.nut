@@ -0,0 +1,149 @@
+vertex 1.0 texture
+frame vertex material
+0.500000
+texture
+1.0
+=
+bone bone =
+material = = 1.0 1.0
+0.500000
+0.500000 material frame -1 texture 1.0 material frame material -1 -1 bone 1.0 material frame
+frame vertex texture vertex vertex vertex
+vertex
+vertex
+bone -1
+-1 =
+0.500000 =
+-1 1.0 -1 1.0 frame frame
+frame
+texture 1.0 = = -1 bone 0.500000 anim =
+frame -1 anim texture
+anim
+vertex frame
+frame
+1.0
+anim material
+frame
+= bone anim
+= frame
+0.500000 = -1 -1 anim bone
+-1 frame vertex vertex = 1.0 bone
+material = anim 1.0
+bone 0.500000
+0.500000
+anim
+1.0
+material vertex 0.500000 = -1 =
+vertex
+0.500000 0.500000
+0.500000 -1 texture 1.0 1.0 -1 material frame vertex -1 vertex
+0.500000 bone material -1
+frame 1.0 bone -1 material -1 1.0 bone vertex vertex -1 1.0 1.0 texture
+0.500000 0.500000 frame 1.0 bone
+1.0 anim 1.0 1.0
+material = -1 = frame
+0.500000
+bone frame
+bone 1.0 material bone material anim
+frame texture material 1.0 vertex
+material -1 frame 0.500000 -1 bone
+bone
+-1
+anim texture
+0.500000
+1.0 0.500000 -1 bone 1.0 frame texture -1 vertex vertex 0.500000 frame
+texture material
+anim
+= vertex vertex bone frame = 0.500000 frame -1 1.0
+vertex bone material
+vertex bone anim vertex
+anim texture -1 vertex
+1.0 texture vertex material
+=
+=
+vertex -1 material
+1.0 -1 -1 texture frame -1 =
+texture
+texture anim = material
+bone anim 1.0 material material -1
+1.0 -1
+-1 -1 material material bone
+-1 anim 0.500000
+anim frame material
+frame -1 anim
+-1 1.0 anim frame = texture bone anim
+1.0 bone texture
+0.500000 texture 0.500000 frame 0.500000 frame frame frame material
+vertex anim = 1.0
+anim material
+vertex 1.0 0.500000 bone vertex bone -1
+0.500000
+0.500000 -1 anim vertex -1 0.500000
+= vertex =
+bone material frame 1.0 = vertex frame material
+-1 frame bone texture -1
+= -1 bone bone texture texture bone
+frame 1.0 -1 bone anim bone frame -1 =
+vertex 0.500000 0.500000 -1 0.500000
+vertex
+texture material
+1.0 anim
+1.0 vertex = frame bone
+-1 anim texture anim
+1.0 vertex -1 1.0
+anim
+frame -1 bone = 0.500000
+texture
+texture anim bone
+-1 1.0 -1 1.0 vertex
+anim -1 0.500000 texture frame
+bone material frame 0.500000 0.500000 vertex texture = 0.500000
+bone
+bone
+vertex = texture
+-1 frame anim = 1.0 = frame texture
+anim frame = -1
+bone bone frame 1.0
+1.0 frame
+-1 1.0 anim vertex -1 bone
+bone
+= 0.500000 = texture anim anim texture bone frame bone material = anim material anim bone = 1.0 bone frame
+material anim anim anim frame
+1.0 vertex bone texture -1 vertex bone
+texture texture texture
+material 0.500000 material material
+material anim bone vertex frame texture
+0.500000 frame =
+= bone
+bone
+texture 0.500000 = =
+0.500000 -1 frame 0.500000 material
+=
+bone texture anim frame bone bone frame -1 texture -1
+0.500000
+frame = -1 -1 1.0
+texture texture 1.0 anim
+texture
+0.500000
+anim 1.0 anim -1 bone anim
+anim texture
+frame -1
+= texture
+frame
+=
+vertex -1 material material bone
+vertex bone
+bone -1 0.500000 1.0 bone anim frame
+anim frame -1 anim bone
+1.0 =
+texture texture bone = 1.0 frame
+bone texture
+vertex -1
+material -1 1.0 vertex
+1.0 material texture material anim 1.0 bone anim
+texture 0.500000 0.500000 bone texture
+vertex -1
+= anim vertex frame
+bone bone
+texture texture vertex texture
+0.500000 = vertex material 0.
\ No newline at end of file
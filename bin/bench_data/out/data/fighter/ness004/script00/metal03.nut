@@ -0,0 +1,63 @@
+1.0 frame material = material frame vertex
+anim 1.0
+material 1.0 0.500000
+anim =
+material anim
+bone material anim vertex anim -1
+= texture -1 1.0 vertex 0.500000 =
+= anim vertex
+= 0.500000 1.0
+frame vertex
+1.0 -1 anim
+anim 1.0 anim 0.500000 1.0 0.500000
+vertex
+1.0 anim 0.500000 = material 0.500000
+1.0
+-1
+material texture
+vertex texture 0.500000 bone bone vertex
+bone bone material anim material 1.0 frame material 1.0
+1.0 frame 1.0 vertex 0.500000
+bone = vertex -1 1.0
+bone -1 frame
+bone 1.0 frame -1 0.500000 material texture
+0.500000 bone = 1.0 = 0.500000 -1 -1
+bone vertex texture 1.0 0.500000 bone bone anim
+anim bone
+material
+0.500000 material anim vertex
+frame
+texture
+frame
+1.0 anim bone texture
+texture 1.0
+material texture = texture -1 frame vertex anim
+bone anim =
+0.500000 material
+0.500000 frame material 1.0 0.500000 frame
+frame vertex =
+texture
+frame vertex bone -1
+material anim anim material anim bone = 0.500000 anim 0.500000 -1 -1 vertex
+anim material 1.0 vertex frame 1.0 1.0 texture 0.500000 = anim
+= -1 -1 1.0 bone material
+frame 0.500000
+= material texture vertex 1.0 material bone
+bone texture 0.500000 anim
+material
+anim 0.500000 texture bone
+frame vertex vertex bone
+material anim
+-1
+vertex
+-1 = anim frame frame frame 1.0 anim vertex
+anim -1 0.500000 frame
+-1 vertex
+1.0 = material
+material frame texture anim material
+material 1.0 frame 1.0 bone
+texture -1
+vertex vertex
+texture
+1.0 vertex
+vertex -1
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex bone 1.0
+vertex texture vertex 1.0 bone 1.0
+materia
\ No newline at end of file
@@ -0,0 +1,17 @@
+bone vertex vertex texture vertex material -1 frame
+bone bone 0.500000 -1 -1 material -1 1.0 1.0
+1.0
+vertex frame -1 texture texture texture
+material material texture -1
+bone texture texture texture
+anim bone 0.500000 material 1.0 bone -1
+-1 -1
+anim anim material
+= = = texture anim
+texture anim
+vertex
+1.0 anim 0.500000
+0.500000 = 1.0 frame 0.500000
+material
+= frame vertex bone
+vertex texture = vertex frame 0.5000
\ No newline at end of file
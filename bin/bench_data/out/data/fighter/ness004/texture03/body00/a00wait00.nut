@@ -0,0 +1,34 @@
+1.0
+vertex
+texture vertex = 1.0 material vertex frame texture
+vertex
+-1 anim 1.0 frame
+1.0
+0.500000
+0.500000 bone bone =
+texture 0.500000
+0.500000
+frame texture
+vertex texture -1 = bone frame = texture = texture anim
+material
+-1 -1 -1 anim 0.500000 texture -1
+vertex vertex
+vertex -1
+frame 1.0
+1.0 anim 0.500000 bone vertex frame = material vertex
+texture
+anim =
+material -1 -1
+bone 1.0
+0.500000 = material 0.500000 0.500000 = texture 1.0 bone
+anim 0.500000 0.500000 texture
+1.0 material material -1
+0.500000 anim anim 0.500000 -1 0.500000 = material
+1.0 frame -1
+0.500000 texture 0.500000
+anim -1 = 1.0 anim -1 material material
+= material
+frame texture 1.0 vertex 0.500000 vertex 0.500000 -1
+frame frame 1.0 anim 0.500000
+vertex
+bone frame 0.500000 = vertex 0.500000 frame -1 material vertex frame -1 = -1 material textur
\ No newline at end of file
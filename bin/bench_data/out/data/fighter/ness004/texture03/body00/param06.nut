@@ -0,0 +1,37 @@
+frame bone 0.500000 1.0 frame 0.500000 material vertex frame texture
+1.0 0.500000
+1.0
+-1
+texture
+-1 material texture
+material
+texture texture
+material = = -1 -1
+anim
+frame = = texture vertex material frame vertex bone bone anim anim =
+0.500000 bone texture
+-1
+frame
+= 0.500000 vertex 1.0 = bone
+texture 0.500000 texture 1.0
+vertex =
+1.0 1.0 0.500000 vertex 1.0 =
+-1 vertex
+frame 1.0 = = 0.500000 anim
+bone
+material
+frame
+anim
+bone -1 = vertex material
+0.500000
+anim material bone -1 1.0 0.500000
+texture
+bone vertex -1
+anim 0.500000 anim 0.500000 material -1 -1 -1 frame material
+vertex bone anim 1.0 vertex
+= -1
+1.0
+vertex -1 anim anim
+material -1 0.500000
+-1 0.500000 frame bone bone
+vertex 0.500000 frame texture bone texture frame
\ No newline at end of file
@@ -0,0 +1,24 @@
+1.0 bone material -1 bone frame frame anim
+0.500000 texture = texture frame 0.500000
+= frame
+= texture frame
+anim -1 1.0 -1 vertex anim 0.500000
+bone
+anim
+anim
+1.0 =
+bone
+1.0 texture texture -1 vertex frame vertex 1.0 bone
+anim texture frame
+texture = material anim 1.0 vertex =
+= frame vertex -1 -1
+bone
+vertex 0.500000
+= -1
+bone
+vertex vertex -1 anim
+frame
+-1 texture frame vertex 1.0 frame bone 0.500000 0.500000 frame
+texture = vertex 0.500000 1.0 1.0 anim
+frame
+ani
\ No newline at end of file
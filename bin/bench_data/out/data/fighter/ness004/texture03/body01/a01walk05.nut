@@ -0,0 +1,31 @@
+-1 1.0 frame vertex =
+0.500000 0.500000 0.500000 bone = 0.500000
+-1
+1.0
+vertex anim vertex anim = vertex
+bone material = texture
+-1 texture frame 0.500000
+texture anim
+texture texture
+0.500000
+texture texture frame
+1.0 material -1 vertex 0.500000 bone material material vertex frame =
+texture 1.0 1.0
+material
+1.0 texture material
+-1 -1
+0.500000 1.0 anim vertex bone -1 0.500000
+anim
+frame
+texture
+= = anim frame frame texture frame vertex
+bone material 1.0 1.0 0.500000 texture 0.500000 bone texture = texture vertex
+frame = = material
+anim vertex
+material anim
+bone vertex bone
+vertex
+= frame frame frame texture -1 bone texture
+material 0.500000
+bone 0.500000
+frame 0.50000
\ No newline at end of file
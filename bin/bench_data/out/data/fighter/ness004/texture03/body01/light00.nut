@@ -0,0 +1,6 @@
+-1 -1 material
+1.0
+anim anim
+bone 0.500000 = material vertex = anim = anim =
+texture bone material anim 0.500000 = = 0.500000 = -1
+ve
\ No newline at end of file
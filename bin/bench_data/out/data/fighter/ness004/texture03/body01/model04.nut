@@ -0,0 +1,3 @@
+texture vertex bone vertex vertex anim
+frame
+bone 
\ No newline at end of file
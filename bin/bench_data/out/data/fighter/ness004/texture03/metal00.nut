@@ -0,0 +1,17 @@
+1.0 -1
+1.0 1.0 = -1 material 1.0 texture frame -1 frame =
+frame -1 1.0 0.500000 bone -1 1.0 texture
+frame
+-1 -1
+0.500000 anim -1 anim
+bone
+anim
+0.500000
+anim anim = vertex bone -1 1.0
+0.500000 material
+texture
+1.0
+material 0.500000 -1 1.0 anim bone bone
+= = -1 texture -1 frame material bone
+vertex
+frame 1.
\ No newline at end of file
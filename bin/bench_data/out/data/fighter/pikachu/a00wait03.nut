@@ -0,0 +1,47 @@
+frame 0.500000 -1 texture 1.0 vertex bone
+material
+-1 1.0
+-1 bone
+anim vertex
+-1 1.0 frame -1 0.500000 anim -1
+frame vertex
+anim frame material frame frame anim
+= anim =
+0.500000
+0.500000 bone frame 1.0
+= texture vertex anim
+vertex vertex
+-1 = anim -1 1.0
+anim vertex = vertex
+vertex anim
+1.0 -1 anim
+frame anim = material 1.0 0.500000 -1 frame
+material vertex
+vertex = material material -1 anim frame
+bone
+-1 material = 0.500000 frame vertex texture frame =
+bone vertex
+anim 1.0
+bone 1.0
+1.0 vertex anim
+texture 0.500000
+vertex
+frame material texture -1
+frame texture
+vertex
+bone
+=
+bone vertex bone = frame frame anim 0.500000 vertex
+-1 texture =
+frame -1 1.0 0.500000
+=
+vertex texture -1 anim bone
+0.500000 1.0 -1 anim
+1.0
+0.500000 1.0 =
+=
+-1 frame
+frame 1.0 bone material -1
+frame material =
+1.0
+material vertex 
\ No newline at end of file
@@ -0,0 +1,39 @@
+vertex 0.500000
+=
+0.500000
+= bone
+1.0
+=
+anim 1.0
+0.500000 = texture
+bone vertex
+bone texture
+1.0 texture =
+anim anim -1
+anim texture bone texture bone
+0.500000 frame vertex material texture = frame
+0.500000
+= bone material
+0.500000 1.0 vertex
+-1 0.500000
+material
+0.500000 0.500000 vertex
+vertex anim
+bone -1 texture frame 0.500000
+anim
+anim texture anim material
+texture
+= material 1.0
+material bone = frame = vertex bone
+-1 1.0 frame material material bone
+anim 1.0 texture 1.0 frame
+bone 1.0 = 1.0 0.500000 texture = = material material vertex texture vertex bone material
+material -1 vertex
+material -1 bone 1.0 anim 0.500000
+vertex
+texture frame -1 frame 0.500000 1.0 1.0 material anim 0.500000 vertex frame -1 1.0 frame frame
+texture
+frame
+frame 1.0 bone
+vertex material
+texture material 1.0 0.500000 anim 0.500000 bone = anim 1.0 1.0 vertex frame bone verte
\ No newline at end of file
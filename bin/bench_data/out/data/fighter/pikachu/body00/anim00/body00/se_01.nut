@@ -0,0 +1,114 @@
+-1 frame 0.500000 anim = = frame -1 bone frame
+vertex
+material texture 1.0 1.0 anim bone = 0.500000 bone
+material
+1.0 0.500000 frame 1.0 0.500000 texture vertex -1 anim
+= = 1.0 vertex 0.500000 = 0.500000 1.0
+= 0.500000 0.500000 anim
+anim = vertex vertex -1 material 0.500000 material bone bone 0.500000
+anim 1.0 anim
+anim vertex
+material texture vertex -1 material vertex 1.0
+1.0 texture
+= -1 material bone 1.0 frame texture
+0.500000 vertex -1 -1 vertex frame anim =
+=
+material
+-1 frame material texture anim vertex texture vertex vertex bone =
+bone texture
+frame 1.0 bone frame 0.500000
+bone anim
+material frame bone bone texture = texture bone material bone = =
+0.500000
+vertex texture texture 0.500000 -1
+vertex = = = 0.500000 -1 anim
+material vertex
+material =
+1.0 bone texture material
+vertex
+1.0 0.500000 1.0 frame -1 -1 bone frame texture
+0.500000 anim texture 1.0 anim
+= frame material
+bone -1 bone vertex anim material 0.500000
+vertex frame
+anim =
+texture bone = 1.0 texture texture texture material bone 1.0 -1
+anim
+-1 -1 bone
+texture
+= frame
+material material
+1.0 bone = material vertex anim texture frame frame anim vertex
+anim vertex
+0.500000 vertex material texture vertex frame material anim = = anim 1.0 texture 1.0 texture 0.500000 -1
+anim texture
+vertex
+=
+-1 =
+texture 0.500000
+anim 0.500000 anim
+frame = frame bone
+frame -1 vertex
+1.0 material
+=
+-1
+=
+anim material material texture
+= texture
+= bone
+vertex 0.500000 anim anim 0.500000 1.0 vertex material -1 frame bone
+texture -1 -1
+bone texture material anim material vertex anim 0.500000 1.0 vertex anim frame -1 1.0 anim texture 1.0 0.500000
+0.500000 anim
+vertex frame =
+anim
+frame vertex vertex 0.500000 =
+frame anim 0.500000 vertex 0.500000 0.500000
+material texture = 0.500000 anim material frame frame
+0.500000 vertex material 0.500000 anim
+vertex material bone bone
+= -1 material bone
+anim =
+material 1.0 vertex
+1.0 vertex anim material anim 1.0
+vertex texture
+texture -1 0.500000 = -1 texture =
+material anim frame bone frame
+bone 1.0 = material
+material = 0.500000 frame
+frame 1.0 -1 material vertex anim -1 = frame
+texture bone bone
+1.0
+texture
+-1 = 1.0 bone texture bone
+anim
+bone vertex =
+-1
+material material anim
+0.500000 vertex material bone 1.0
+0.500000
+texture
+texture 1.0 texture frame 0.500000
+=
+bone
+anim
+material bone 0.500000 0.500000 bone 1.0 0.500000 material 1.0 texture 0.500000 vertex texture -1
+frame
+texture texture bone
+frame 1.0
+frame =
+texture vertex -1 texture
+-1 material -1 frame texture material -1
+= anim = -1
+frame = bone
+-1
+vertex
+1.0 bone
+vertex
+-1
+0.500000 vertex bone
+material
+1.0 = = 1.0 1.0 frame vertex material -1 frame
+anim
+bone 0.500000 0.500000 vertex anim vertex texture anim
+vertex material anim frame 0.50000
\ No newline at end of file
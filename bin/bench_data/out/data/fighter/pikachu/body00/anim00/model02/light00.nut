@@ -0,0 +1,20 @@
+1.0 texture texture 1.0 =
+vertex 1.0 = texture vertex texture =
+texture -1 frame material = material vertex
+bone bone texture
+vertex 0.500000 vertex
+= = anim material -1 vertex -1 = -1 0.500000
+-1 vertex texture material = texture
+texture material texture
+0.500000 1.0 0.500000 vertex
+material
+frame bone -1 bone vertex
+vertex
+material -1 bone 0.500000 -1 0.500000 frame frame
+frame
+texture -1
+anim
+anim 1.0
+-1
+texture frame anim texture frame anim anim bone 1.0 anim frame -1
+material texture 1.0
\ No newline at end of file
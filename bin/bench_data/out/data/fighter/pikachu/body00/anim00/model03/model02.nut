@@ -0,0 +1,4 @@
+0.500000 bone 1.0
+frame vertex
+1.0 vertex
+0.500000 
\ No newline at end of file
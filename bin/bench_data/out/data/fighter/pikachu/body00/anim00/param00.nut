@@ -0,0 +1,4 @@
+texture material
+0.500000
+material frame bone 0.500000 bone 0.500000 0.500000 material anim
+vertex 0.5
\ No newline at end of file
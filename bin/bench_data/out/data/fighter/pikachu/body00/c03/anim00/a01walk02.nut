@@ -0,0 +1,21 @@
+vertex -1
+-1
+anim vertex 0.500000
+1.0 bone
+1.0 0.500000 anim = vertex vertex -1 0.500000 material 0.500000 material texture
+1.0 -1
+material material
+anim
+vertex texture texture
+anim = 1.0 = 0.500000
+material
+anim = material = anim = frame bone frame 0.500000
+texture texture = -1
+-1 vertex
+bone anim
+0.500000
+-1 frame
+-1
+1.0 frame
+material anim 1.0 1.0 0.500000
+0.500000 0.500000 -1 bone anim 0.500000 1.0 1.0 vertex fram
\ No newline at end of file
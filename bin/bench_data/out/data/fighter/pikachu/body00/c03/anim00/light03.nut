@@ -0,0 +1,11 @@
+0.500000 material vertex frame material anim 0.500000
+vertex bone vertex 1.0 anim frame anim
+vertex -1 = anim vertex 0.500000 vertex material texture
+anim 0.500000
+1.0 anim anim texture vertex bone 0.500000 frame material bone 1.0 1.0 frame -1 anim -1
+vertex vertex 1.0 0.500000
+anim 0.500000 vertex material material texture frame
+frame texture texture vertex = 1.0 frame bone
+bone
+1.0 = anim anim 0.500000 anim 0.500000
+vertex
\ No newline at end of file
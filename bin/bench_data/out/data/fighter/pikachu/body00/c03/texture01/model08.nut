@@ -0,0 +1,105 @@
+-1 bone vertex bone 1.0
+bone frame 0.500000 bone texture
+frame
+1.0 texture -1 frame texture -1 0.500000 material
+vertex anim bone
+material = =
+material
+0.500000 frame 1.0
+= bone
+vertex anim
+vertex
+= anim vertex -1
+1.0
+material vertex texture
+anim vertex 1.0
+bone 0.500000
+-1 -1 anim -1 =
+material texture = bone
+= 0.500000 -1 0.500000 bone
+1.0 bone 0.500000 texture frame material texture
+0.500000 frame bone frame frame 1.0 vertex -1 vertex
+anim
+vertex 0.500000 0.500000 0.500000 material texture = 0.500000
+texture = texture vertex material = =
+texture
+vertex = -1 anim
+= texture
+anim anim anim
+vertex anim bone 0.500000 vertex
+= -1 texture -1
+bone
+bone = 0.500000 1.0
+-1 = frame
+bone material
+texture vertex texture
+0.500000 anim 1.0 texture
+1.0 1.0
+1.0 material frame 1.0 material -1 = vertex 0.500000 anim
+-1
+frame bone texture frame bone material vertex
+0.500000 0.500000 1.0 bone anim -1 vertex
+bone bone bone -1 0.500000 anim anim frame 0.500000 frame
+vertex material texture
+texture anim 0.500000 anim bone
+material material material 1.0 0.500000 vertex
+texture texture 1.0 anim 0.500000
+material texture = bone
+bone -1 texture bone frame
+= -1
+1.0 = frame bone frame anim frame texture 0.500000
+frame vertex
+bone 0.500000
+1.0 vertex 1.0 0.500000 frame
+-1 -1 vertex texture 0.500000 1.0 anim bone bone vertex anim vertex
+vertex
+anim = anim anim
+frame frame frame
+bone
+frame
+vertex
+vertex
+bone
+-1 -1 anim
+1.0 0.500000 -1
+1.0 1.0 vertex 1.0 -1
+vertex bone frame
+anim
+vertex texture 0.500000 1.0 material
+material
+bone
+bone texture
+material frame frame texture bone
+bone
+bone frame 1.0 vertex -1
+texture vertex texture 0.500000 vertex
+1.0
+bone frame -1 texture material texture anim
+1.0 frame
+vertex 0.500000 vertex 1.0 -1 0.500000 -1 vertex vertex -1 vertex
+-1
+texture bone frame
+texture bone anim vertex -1 0.500000
+= 1.0
+bone material frame 0.500000 texture -1 texture
+vertex texture -1 anim material
+= material 1.0
+texture 1.0 -1 texture texture vertex
+0.500000
+anim frame bone anim texture = texture anim anim
+texture
+anim
+-1 texture
+-1 -1 -1 frame = 0.500000
+texture frame texture material anim bone
+-1 texture 1.0 -1 = 1.0 1.0 0.500000 material bone = bone 0.500000 bone = material bone
+vertex bone bone bone anim
+vertex texture bone 1.0 -1 = = vertex material
+material
+bone bone
+frame = 1.0
+texture 1.0
+1.0 frame texture anim material material material material -1 texture material
+frame vertex vertex material
+bone anim texture 0.500000 vertex material 0.500000 = bone frame vertex -1 -1 material frame 0.500000 bone
+1.0 1.0 anim bone texture 1.0 -1 -1 anim frame
\ No newline at end of file
@@ -0,0 +1,33 @@
+anim 1.0 anim = 1.0 bone = material anim =
+0.500000 frame 1.0 bone material anim 1.0 anim material texture
+1.0 =
+texture -1 -1 material -1 = = -1 frame vertex material material bone anim
+=
+texture texture vertex 0.500000 texture 0.500000 1.0 anim 1.0 bone frame -1 vertex
+1.0
+vertex texture texture vertex vertex
+-1 vertex anim anim texture material -1 frame
+-1 anim 0.500000 material
+anim vertex frame 1.0
+anim -1
+texture vertex -1 0.500000 texture vertex
+bone 1.0 bone texture = material 1.0 anim 1.0 bone material -1 bone bone bone vertex vertex
+= anim vertex = material vertex vertex
+vertex anim material bone
+anim frame
+frame texture anim -1 0.500000 = -1
+0.500000
+anim anim vertex frame
+0.500000 material vertex frame frame anim bone 0.500000
+bone material
+0.500000 material material 1.0
+0.500000 texture
+frame vertex 1.0
+material -1 texture anim frame
+= material texture material -1 bone frame texture material texture anim frame material -1 frame
+1.0 0.500000
+bone 1.0 vertex -1 1.0 1.0 bone
+bone
+material 0.500000 bone 1.0 0.500000 1.0 -1 vertex = texture texture bone texture anim
+anim bone bone anim texture
+-1 0.500000 anim 0.500000 material -1 vertex anim = bone
\ No newline at end of file
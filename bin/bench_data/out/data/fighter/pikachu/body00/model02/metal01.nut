@@ -0,0 +1,12 @@
+texture
+= anim bone anim
+frame
+0.500000
+bone vertex vertex -1 frame anim
+= material bone material material
+anim material anim
+frame anim vertex anim material bone
+vertex -1 vertex -1
+1.0 vertex texture
+material frame anim = anim
+anim material anim texture
\ No newline at end of file
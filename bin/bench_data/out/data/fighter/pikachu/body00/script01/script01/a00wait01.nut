@@ -0,0 +1 @@
+`Pom&z`}^$S\nA8FZwlJ&l܌F٤Pn(N4r4$8&<InL 4q+c:l,2157`&b@J'pyOΙj]{1"6ee@yۙ-l1LӺ#M٧હ rYψ/!1c/2+|dݿ
\ No newline at end of file
@@ -0,0 +1,156 @@
+= vertex material -1
+0.500000 material -1
+texture 0.500000 bone 1.0 bone texture
+0.500000 = material
+-1 material material 1.0 0.500000
+= =
+-1 frame 0.500000
+0.500000 bone
+material bone
+frame bone 1.0 bone
+1.0 = anim frame frame
+anim 1.0 frame 0.500000 vertex
+bone
+anim material frame anim
+0.500000
+1.0
+0.500000 frame
+frame material bone
+material texture
+0.500000 1.0 -1 bone material frame anim anim
+-1
+=
+texture
+1.0 texture texture
+vertex material frame
+= material bone texture bone
+1.0 texture vertex -1
+anim -1 anim
+vertex vertex 0.500000 texture bone vertex anim 0.500000 0.500000 vertex frame 0.500000
+texture vertex texture anim texture 1.0 material material 1.0
+anim
+anim
+texture anim
+frame
+material 1.0 -1
+= anim 1.0
+anim frame bone
+= bone frame -1
+anim
+1.0 texture
+= frame anim
+anim 0.500000
+material =
+anim
+1.0
+-1 1.0
+frame
+-1 0.500000
+-1 material
+bone
+1.0 0.500000 anim
+-1 -1 0.500000 0.500000 anim bone texture 0.500000 bone -1
+= 1.0 anim texture -1
+texture
+0.500000
+-1 -1
+texture anim
+vertex 1.0
+anim texture 0.500000 anim texture
+-1
+0.500000 vertex
+-1 anim
+vertex texture
+0.500000 =
+1.0 texture anim texture vertex 0.500000 bone
+frame material = frame =
+anim 0.500000 vertex =
+vertex =
+-1 0.500000 -1
+-1 bone
+bone 1.0 0.500000 frame material 1.0 bone bone
+-1 bone -1
+texture anim vertex
+material -1
+texture -1 -1
+1.0
+frame frame anim anim vertex anim
+=
+bone =
+0.500000 anim vertex bone anim material texture bone bone
+0.500000 1.0 -1
+=
+1.0 -1 bone 0.500000 texture
+-1 0.500000
+0.500000 bone = texture
+= bone 0.500000 frame
+1.0 bone
+material material
+1.0 anim -1
+0.500000 bone
+-1 texture material
+1.0 anim 1.0 material 0.500000 bone 1.0 texture = anim vertex 1.0
+0.500000 bone
+bone =
+material =
+bone anim material vertex
+anim -1 1.0 frame -1
+1.0 material 1.0 -1 anim vertex
+anim 1.0 vertex frame material
+material
+material =
+anim anim anim
+= material vertex vertex frame = anim material anim vertex
+bone
+vertex material
+= bone = 1.0
+1.0 0.500000 = frame material material =
+anim
+bone = bone anim =
+1.0 1.0 anim material material 1.0 bone vertex = -1 vertex frame texture
+material
+-1
+texture
+bone = = bone -1 material
+material bone 1.0
+material
+0.500000 material anim
+texture 0.500000 = = 0.500000 frame -1 vertex
+bone
+texture
+vertex material vertex = texture -1 0.500000 anim vertex vertex
+material -1 frame material material = anim 0.500000 texture -1 texture -1 bone bone = 1.0 -1 -1 vertex
+1.0
+=
+-1 material vertex
+= 1.0
+1.0 material
+frame -1
+1.0 vertex material
+texture vertex vertex bone = vertex
+vertex bone
+material 1.0 frame = vertex = -1
+texture
+= frame vertex vertex 1.0
+1.0
+bone = -1
+texture
+frame vertex
+texture vertex anim material texture
+material -1 -1 =
+texture bone -1 anim frame
+texture
+-1 material =
+texture
+anim vertex
+frame vertex vertex 1.0 frame
+texture frame -1
+texture 1.0
+1.0
+texture 1.0 texture bone
+anim -1 bone
+-1 material frame texture material
+anim -1
+= -1 0.500000 vertex
+frame anim frame = material material
+-1 mate
\ No newline at end of file
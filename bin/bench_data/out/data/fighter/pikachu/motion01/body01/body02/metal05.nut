@@ -0,0 +1,27 @@
+frame vertex vertex
+material frame material 0.500000
+vertex -1 vertex
+vertex = = 0.500000 0.500000 material vertex vertex 1.0 0.500000 -1 1.0 vertex material texture frame material bone 1.0
+0.500000 -1 anim -1 1.0 1.0 1.0
+bone vertex 1.0 0.500000
+vertex -1
+vertex
+texture
+0.500000
+0.500000 0.500000
+texture
+-1
+vertex
+= frame -1 frame 1.0 anim material -1 frame texture texture bone texture
+frame bone frame
+1.0
+texture 1.0 -1 0.500000
+anim 1.0 material vertex 1.0
+-1
+anim 1.0 anim frame
+material material material vertex 0.500000 0.500000 anim frame
+= -1 = material vertex
+0.500000 frame
+-1 frame texture material texture vertex
+1.0 1.0 frame 0.500000 material vertex anim vertex = vertex anim 0.500000 texture
+0.500000 = 1.0 -1 0
\ No newline at end of file
@@ -0,0 +1,13 @@
+material material anim anim frame
+material = 0.500000 =
+1.0 frame -1
+anim bone
+= = material 1.0
+-1 = frame 0.500000 frame bone frame 0.500000 -1 -1 bone
+material =
+texture
+frame
+frame material bone
+0.500000 = 0.500000 material anim -1 bone texture
+bone
+texture vertex bone
@@ -0,0 +1,25 @@
+0.500000
+vertex vertex anim -1 vertex = vertex bone 1.0 0.500000
+0.500000
+1.0
+anim texture frame 0.500000 frame
+1.0 anim anim = 0.500000 texture
+texture texture 0.500000 frame -1 anim bone =
+bone texture
+frame 0.500000
+1.0 texture -1
+bone
+1.0
+vertex material -1 -1 1.0 1.0 1.0
+material 0.500000 frame material -1 -1 bone
+=
+-1
+vertex bone
+1.0 texture bone
+= anim anim -1 texture
+anim = = anim anim 0.500000
+texture
+bone material = material bone 0.500000 texture
+0.500000
+-1 material material
+bone
\ No newline at end of file
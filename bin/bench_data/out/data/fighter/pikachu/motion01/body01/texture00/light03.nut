@@ -0,0 +1,75 @@
+-1
+material
+frame material
+= frame
+-1 bone =
+1.0 texture material frame
+= texture
+bone
+vertex
+vertex
+anim anim
+0.500000 1.0 1.0 frame 0.500000 1.0
+texture
+-1 0.500000 anim bone
+1.0
+material
+frame
+= frame frame 0.500000 vertex texture frame -1 material
+= bone anim 0.500000 -1
+1.0 vertex = anim
+material frame 1.0 bone
+0.500000
+-1 = 0.500000
+1.0 anim frame
+texture anim bone = material anim vertex frame 0.500000 1.0
+material material -1 -1 1.0
+= = -1
+-1 anim 0.500000
+0.500000 1.0 material
+vertex bone
+texture vertex bone -1
+= vertex bone -1 1.0
+bone bone 0.500000 frame anim 1.0 material
+texture bone 1.0 0.500000 -1
+-1 bone
+1.0 =
+= frame bone 0.500000 =
+-1 texture
+-1 = 1.0 vertex -1 vertex
+1.0 vertex -1 texture material
+0.500000 0.500000
+bone frame 0.500000 0.500000 1.0
+-1 = anim 1.0 -1 frame
+-1 texture anim frame -1
+1.0
+texture -1 vertex 0.500000
+1.0 bone 1.0
+= -1 bone 0.500000 vertex 0.500000 = vertex 0.500000
+0.500000
+material bone anim 1.0 material material vertex bone
+frame
+0.500000
+frame frame -1 texture = anim 1.0 -1 vertex frame -1 frame 1.0 bone
+-1 0.500000 0.500000 material
+0.500000 0.500000 bone bone bone
+= = = material = 0.500000 texture
+bone
+texture
+-1 = frame material -1 frame
+anim vertex
+1.0 0.500000 material
+vertex frame 1.0 vertex texture 1.0
+anim = texture texture
+1.0 anim
+-1 anim
+=
+1.0 frame =
+material
+= texture
+bone -1
+vertex 1.0 bone frame
+-1 =
+-1
+bone
+-1 material material frame material texture texture vertex vert
\ No newline at end of file
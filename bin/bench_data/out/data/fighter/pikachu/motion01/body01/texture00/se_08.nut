@@ -0,0 +1 @@
+lNW.D\C	rQ}mGu۝DV]-]Y
\ No newline at end of file
@@ -0,0 +1,30 @@
+= = material frame material = 0.500000
+texture vertex 1.0 0.500000
+= 0.500000
+anim material material =
+texture
+bone
+material frame 0.500000
+texture 0.500000 -1 anim frame vertex 0.500000 material frame
+material frame bone 0.500000
+bone 0.500000 bone anim anim anim 1.0 frame 1.0
+anim
+material 1.0 1.0 anim vertex anim
+bone
+-1
+=
+1.0
+anim bone bone vertex 0.500000
+material
+-1
+vertex
+1.0 frame bone texture
+anim anim
+-1 bone texture anim bone vertex material texture =
+frame bone 0.500000 texture bone
+vertex
+vertex =
+anim -1 material =
+frame vertex
+frame
+vertex texture 0.500000 bone 0.500000 bone 1.0 frame -1 frame 1.0 0.500000
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex -1 bone =
+-1 texture
+-1
+vertex 1.0 bone 
\ No newline at end of file
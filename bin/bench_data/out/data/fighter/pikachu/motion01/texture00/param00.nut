@@ -0,0 +1,181 @@
+vertex anim bone material anim frame
+-1 = = frame -1 bone bone 0.500000 = vertex texture = 1.0
+vertex
+1.0 texture
+material 0.500000 vertex 1.0 bone bone
+=
+bone 1.0
+bone 0.500000
+=
+anim bone vertex anim 1.0
+bone 1.0 anim 0.500000
+material anim
+frame = texture bone
+= -1
+material 1.0 frame = anim 1.0
+-1 0.500000
+vertex vertex =
+anim texture vertex 1.0 = vertex frame vertex = texture -1 -1 frame vertex 1.0
+texture bone 0.500000
+frame -1 texture
+1.0 vertex material anim 0.500000 1.0
+1.0 vertex vertex texture
+bone -1 -1 1.0 = = 0.500000 texture -1 = texture bone -1
+anim
+material
+bone vertex -1 anim texture 0.500000 bone bone
+anim frame = texture 1.0 vertex
+0.500000
+texture 0.500000 material anim vertex anim
+vertex vertex frame
+1.0 = bone
+frame material material
+material
+anim texture texture 1.0 0.500000
+bone 0.500000 0.500000 texture anim vertex frame
+material anim 1.0
+= texture frame anim 0.500000 texture
+frame 1.0
+material anim 0.500000 frame anim
+0.500000 -1
+-1 1.0 bone = anim
+material vertex vertex
+material
+bone frame
+material material
+anim
+1.0
+texture frame vertex bone = texture
+texture = frame 1.0
+vertex
+1.0
+bone 0.500000
+vertex
+anim 0.500000 material vertex vertex
+1.0 = 0.500000 1.0 texture 0.500000 -1 texture = -1
+texture texture
+-1 material
+anim
+-1 texture 0.500000 0.500000 anim frame
+= texture vertex
+-1 vertex = material 1.0 texture texture = frame
+1.0 -1
+texture texture -1 anim = frame frame
+bone
+bone material texture 0.500000
+1.0 frame bone = 1.0 1.0 texture anim vertex
+=
+vertex 1.0 frame 0.500000 bone
+material 0.500000 1.0 0.500000
+texture bone
+-1
+anim anim anim texture -1
+0.500000 material 1.0 vertex bone -1
+1.0 = 1.0 material -1 frame bone frame frame texture 1.0
+0.500000
+-1 vertex vertex material vertex 1.0 material material frame
+-1
+= frame -1
+vertex texture vertex frame = vertex =
+1.0 material material 0.500000 1.0 anim 1.0
+vertex material = texture anim anim
+1.0 -1 =
+vertex material vertex vertex frame
+= vertex frame 0.500000
+frame vertex texture
+vertex
+= 0.500000
+0.500000 = anim
+vertex
+-1 1.0 anim material anim = 1.0 0.500000 frame -1 =
+= material frame = vertex
+1.0 material bone
+-1 vertex
+= 0.500000 anim vertex 0.500000
+texture frame
+texture bone texture
+= 1.0 frame texture material vertex frame vertex bone
+-1 vertex 1.0 bone 0.500000 anim
+texture material -1 frame = -1
+-1 = frame 0.500000
+0.500000 bone
+0.500000 0.500000 texture anim
+material texture 0.500000
+texture frame
+bone texture
+= 0.500000 bone frame frame 0.500000 0.500000 bone material 1.0 = anim anim
+material frame anim
+bone = -1 vertex 1.0 vertex anim bone vertex material
+material -1
+vertex vertex texture vertex -1
+0.500000 material = anim material vertex texture
+0.500000 -1
+bone
+0.500000 texture
+-1 material vertex material
+bone -1
+anim texture frame vertex = =
+texture texture 0.500000
+bone
+vertex texture =
+frame
+1.0 vertex
+0.500000
+bone -1 vertex texture bone
+anim material bone
+1.0 anim material vertex -1 1.0 material
+-1
+frame 1.0 material -1 bone -1 frame bone bone 0.500000
+texture material
+bone anim vertex vertex anim texture -1 texture material material = vertex = 0.500000 = 0.500000 bone 0.500000 material material
+bone
+-1 0.500000
+bone material
+vertex
+= frame bone -1 texture texture bone =
+material frame
+-1 -1 material anim
+frame texture -1 1.0 anim
+material material anim 0.500000 = texture
+anim texture
+= vertex
+bone 1.0 vertex anim
+bone bone anim -1 0.500000 vertex texture
+0.500000 1.0 texture material
+anim texture anim
+material anim = 1.0
+-1 1.0 texture bone 0.500000 vertex
+vertex 0.500000
+texture frame texture
+= 0.500000 frame
+vertex 0.500000 0.500000 frame vertex 0.500000 material bone frame 0.500000 bone frame anim frame 0.500000
+vertex 1.0 material 1.0 0.500000
+1.0 vertex frame material texture 1.0 -1 anim texture material = texture
+anim texture = texture vertex
+-1 bone vertex 0.500000 anim = texture 1.0 -1
+= anim
+material texture -1
+bone
+material -1
+texture 0.500000 anim 0.500000 texture
+texture anim -1 = texture
+=
+vertex
+-1 1.0 anim -1 anim -1 material bone texture vertex anim texture 0.500000 1.0
+anim texture material anim
+1.0
+vertex 1.0 bone
+= 0.500000
+vertex -1
+1.0
+-1 frame 1.0 -1 1.0 bone vertex 1.0 -1 texture vertex bone =
+1.0 -1 texture vertex = anim = frame 0.500000 material vertex 0.500000 = frame frame = texture -1 frame vertex bone bone material frame frame = = bone
+= frame bone bone frame bone 0.500000 0.500000 texture -1
+texture texture 1.0
+= vertex anim texture = material vertex vertex material -1
+1.0 1.0 bone material texture 1.0 bone bone texture -1 texture material frame vertex material 1.0 bone texture -1 texture
+bone material
+0.500000 1.0 bone
+texture
+vertex
+material = 0.500000 0.500000 = texture -1 tex
\ No newline at end of file
@@ -0,0 +1,2 @@
+-1 material texture 1.0 0.500000 bone frame = =
+= = frame texture bone texture material -1 bone texture 0.500000 frame
\ No newline at end of file
@@ -0,0 +1,8 @@
+texture
+texture
+0.500000 bone 1.0 bone
+= bone texture material bone anim 0.500000
+material texture material vertex = bone frame 0.500000 bone
+anim 1.0 texture material
+texture
+= texture texture anim = -1 frame texture
\ No newline at end of file
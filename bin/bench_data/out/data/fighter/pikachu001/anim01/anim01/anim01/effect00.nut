@@ -0,0 +1,144 @@
+anim
+0.500000 frame frame
+-1 anim 0.500000 vertex
+-1 bone anim anim
+vertex -1
+frame
+1.0 material =
+texture -1 texture 0.500000
+bone frame 1.0
+bone
+= material 0.500000
+texture bone
+frame = frame bone texture
+-1 material texture
+bone
+0.500000 material
+= frame frame 0.500000
+1.0 anim material
+frame bone bone anim material
+frame
+vertex frame anim
+-1 1.0 =
+1.0
+1.0 -1 material vertex vertex
+-1 texture bone
+anim
+1.0
+bone frame 0.500000 texture
+= frame 1.0
+1.0
+1.0 0.500000
+= = vertex
+material
+-1 0.500000
+1.0 0.500000 texture 1.0 frame frame anim bone frame texture
+= = bone frame material
+anim 0.500000 anim 0.500000 anim bone vertex
+frame material
+=
+= -1 vertex vertex bone bone vertex vertex 0.500000 bone = bone texture = 1.0 1.0 0.500000 1.0 bone -1 anim
+frame
+frame -1
+anim material -1 0.500000 texture material vertex = frame 1.0
+vertex -1 = material = 0.500000
+texture bone 0.500000 bone 0.500000 =
+0.500000 texture = bone
+frame 0.500000 texture
+-1 anim frame frame bone
+anim = bone 0.500000 texture frame
+vertex texture
+frame 0.500000 1.0 frame
+bone anim 0.500000 -1
+anim 1.0 anim
+-1
+-1 bone =
+anim
+anim vertex frame texture vertex
+vertex 0.500000
+material 0.500000 -1 material material 1.0 anim bone
+vertex texture =
+frame
+texture 1.0 texture =
+frame -1 0.500000
+1.0
+= 1.0 bone texture
+texture frame -1 frame
+0.500000
+texture 0.500000 material bone frame material anim
+texture frame texture vertex 0.500000 -1 0.500000 vertex
+frame -1 bone vertex material 0.500000 1.0
+texture texture
+-1 frame
+material = vertex bone
+material vertex material
+anim bone frame texture -1 anim
+0.500000 1.0 -1 1.0
+anim 0.500000
+1.0 vertex material
+anim
+texture frame anim vertex texture texture 1.0 -1 = 1.0
+material
+-1 0.500000 texture = bone 0.500000 1.0 -1
+texture = frame
+frame material
+anim
+material vertex bone material anim
+vertex 1.0
+material material
+material
+anim 0.500000 frame bone frame = -1 anim
+0.500000 = frame 1.0
+frame bone vertex
+frame
+1.0 = bone
+=
+anim texture frame anim
+vertex -1
+material 0.500000
+= anim
+bone
+-1 1.0
+0.500000 frame
+= =
+-1 1.0 vertex
+= =
+material material vertex bone
+bone = = frame bone texture frame -1 -1
+texture material -1 bone 0.500000
+texture -1 -1 anim
+material
+frame frame 1.0 texture -1 anim vertex =
+texture material material material
+0.500000 material
+-1 = 1.0 vertex texture -1 vertex texture -1 bone
+-1
+1.0
+material material
+-1 vertex 1.0
+-1 texture
+frame -1
+material 0.500000 bone = anim
+-1 anim
+-1 0.500000 0.500000
+-1 1.0 material vertex =
+frame vertex -1
+anim texture =
+bone bone -1 -1
+bone
+0.500000 texture vertex 1.0
+1.0 1.0 frame = vertex texture frame frame bone
+texture 0.500000
+0.500000 0.500000 -1 vertex 1.0
+-1 material
+1.0 -1 0.500000 texture vertex
+0.500000
+material
+0.500000 bone bone vertex vertex 1.0 material texture
+material frame -1 1.0 -1 material
+material
+1.0
+0.500000 vertex texture = vertex
+texture = bone vertex frame vertex anim anim
+anim bone 1.0
+material frame texture vertex -1 1.0 anim -1 anim = 0.500000 0.500000 1.0 frame 0.
\ No newline at end of file
@@ -0,0 +1,16 @@
+-1
+-1 bone
+-1 texture texture texture 1.0 = bone vertex 1.0 anim -1 1.0 -1 material vertex 1.0
+bone bone frame vertex
+= -1
+anim 0.500000
+anim 0.500000 bone 1.0 -1 0.500000 material
+anim anim
+vertex
+anim = 0.500000 vertex vertex
+bone 0.500000 0.500000 = 0.500000 -1
+=
+frame
+frame
+frame vertex
+0.500000 material 0.500000 texture -1 bone material 
\ No newline at end of file
@@ -0,0 +1,16 @@
+0.500000 -1
+material
+1.0
+frame frame frame material 1.0
+=
+material bone anim
+1.0 1.0
+bone anim
+material texture
+1.0 -1 frame
+vertex bone bone texture
+1.0 = frame bone bone
+bone 1.0 frame texture 0.500000 bone material
+vertex texture
+-1
+= 0.
\ No newline at end of file
@@ -0,0 +1,45 @@
+anim texture material
+texture frame frame = -1 frame
+vertex
+texture = -1
+= 1.0 = 0.500000 = frame anim vertex -1
+=
+-1 vertex
+0.500000
+0.500000 =
+1.0
+anim bone bone
+1.0
+0.500000 0.500000 frame material
+material material anim vertex
+texture
+-1 texture material anim frame = frame 0.500000
+material frame 1.0 frame vertex vertex anim material frame
+0.500000 bone -1 anim 1.0 0.500000 bone anim 1.0 -1 texture -1 1.0 = anim 1.0 anim texture 0.500000 0.500000 -1 bone texture material texture material texture
+frame 1.0 1.0 0.500000
+-1 bone 0.500000 = bone = anim texture
+texture
+1.0 material frame texture -1 frame = bone texture frame
+texture vertex
+material bone
+-1
+vertex
+material
+-1 -1 material bone texture
+vertex 1.0 1.0
+frame = material bone
+-1 anim
+anim texture
+1.0
+vertex vertex vertex bone 1.0 texture
+frame vertex -1
+frame frame 0.500000 texture
+-1 -1 texture 0.500000 anim
+-1 bone 1.0
+0.500000 -1
+1.0 material anim anim
+1.0 1.0
+texture
+vertex
+1.0 bone = = vertex
+frame verte
\ No newline at end of file
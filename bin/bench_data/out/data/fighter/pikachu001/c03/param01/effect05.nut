@@ -0,0 +1 @@
+U`I(Wle{)wۊ*He=рƷUbl[8zI!+J`uY{	ilkC],hZ=9}Ҡ2:u#]ɖgMQc`;adގApQ^	j]R҇4ز&`ߥU zڅ>'#*vt"!f%u&;E@U
\ No newline at end of file
@@ -0,0 +1,2 @@
+material
+-1 -1 -1 material anim -1 bone -1
\ No newline at end of file
@@ -0,0 +1,188 @@
+= texture 1.0 bone material texture 0.500000 -1 = bone
+-1 material
+texture 0.500000 material vertex 1.0 1.0
+frame frame anim
+frame texture
+anim
+= bone
+frame texture 1.0
+-1
+anim vertex anim texture
+bone frame
+= texture anim frame = frame
+-1 texture texture
+-1 -1 vertex texture 1.0
+vertex -1 texture frame material 1.0 -1
+1.0
+material -1
+-1 vertex frame
+texture vertex
+0.500000
+texture material material
+anim frame
+frame anim 1.0 vertex = frame
+material 0.500000 bone frame
+anim texture
+frame 0.500000 1.0 material
+-1 frame frame texture
+-1
+1.0 = 0.500000 -1 = frame
+vertex texture = 0.500000 vertex 0.500000 bone frame
+vertex =
+0.500000 frame frame bone anim material = -1 0.500000 material
+material vertex bone frame texture bone
+= 0.500000
+bone 1.0
+0.500000 frame vertex
+frame 0.500000 0.500000 material
+1.0 frame 0.500000
+=
+texture 0.500000 frame 1.0
+material 1.0
+anim
+=
+bone
+bone
+anim texture material bone bone bone 1.0 anim
+anim bone 1.0 =
+=
+material frame anim texture
+anim
+= texture -1
+texture
+= -1 frame material bone
+= = frame vertex
+anim -1
+anim = -1 bone texture 1.0 1.0 = anim
+texture = = bone
+0.500000
+material
+bone
+0.500000 vertex 1.0
+frame vertex material frame material vertex = 0.500000 vertex texture frame 1.0 -1 = frame frame 1.0 -1 anim anim texture texture -1 frame vertex
+material = vertex vertex 0.500000 frame texture
+bone frame
+vertex 1.0
+vertex -1 bone
+texture = vertex
+vertex bone vertex
+0.500000 material = 0.500000 material bone 1.0 bone -1
+vertex 0.500000 texture -1 vertex = anim
+1.0 = bone 0.500000 vertex bone material 0.500000 material material
+bone material = = texture material
+bone
+= -1 -1 material frame 1.0
+= = frame texture bone
+0.500000 0.500000 0.500000
+frame vertex -1 texture frame
+bone
+material texture = bone anim
+frame anim texture = material anim material 0.500000 bone material anim 0.500000 anim anim 0.500000 texture bone texture
+texture
+-1 material anim
+1.0 frame 1.0 vertex frame
+vertex
+0.500000 frame -1 1.0 frame 0.500000 anim 0.500000
+-1 =
+vertex texture
+material texture anim anim
+anim bone bone 0.500000 1.0 frame -1 = = -1 material texture vertex 0.500000 = vertex texture vertex bone texture texture bone
+= frame anim 1.0 = anim vertex anim vertex
+vertex
+= -1 texture 1.0
+1.0
+frame
+frame anim
+bone 1.0 1.0
+texture
+1.0 frame
+anim anim vertex -1
+1.0
+texture vertex -1 vertex vertex
+= anim
+bone bone
+vertex 1.0 0.500000 material 0.500000 texture 0.500000 texture -1 bone anim vertex -1 1.0 material 0.500000 anim -1 texture frame bone = material material bone 0.500000
+frame
+frame vertex vertex = bone bone 0.500000 1.0 vertex material vertex bone material -1 = frame
+texture material
+0.500000
+1.0
+1.0 = = frame
+0.500000
+material vertex
+material anim
+vertex texture 0.500000 frame frame 1.0 frame -1 1.0 bone 0.500000 bone bone
+anim bone anim
+anim anim 1.0 vertex texture
+frame -1 1.0 0.500000 frame texture =
+bone -1
+vertex 0.500000 texture = frame
+vertex bone
+texture
+0.500000 material bone 1.0 material = = material 0.500000
+1.0
+material
+vertex anim -1 texture -1 texture frame 1.0 frame 0.500000 frame 0.500000 texture anim anim -1 material -1 -1
+1.0
+0.500000 bone
+anim
+anim vertex -1 frame = 0.500000
+material
+anim
+-1
+= frame =
+vertex vertex anim bone
+= 0.500000 anim
+bone
+texture frame frame frame
+-1 anim bone material vertex 1.0 vertex bone 1.0 bone frame frame = = -1 0.500000 = bone 1.0 material
+bone frame vertex -1 bone texture 0.500000 material frame -1
+= =
+texture = material 0.500000 material
+frame
+-1 -1 frame
+-1 1.0 -1
+texture bone
+1.0 1.0 vertex 1.0 texture vertex 1.0 anim texture material frame anim material
+vertex texture bone vertex 1.0
+=
+= anim anim
+anim frame
+frame 0.500000 anim frame material
+0.500000 texture anim
+0.500000
+= -1
+vertex
+material anim bone frame 0.500000 bone frame bone
+anim
+frame 1.0
+-1 material frame = bone frame anim frame material vertex bone
+anim
+material
+= -1 bone
+-1 bone =
+1.0 anim
+texture anim bone 1.0
+texture bone
+texture = vertex texture
+vertex
+vertex 0.500000 texture
+0.500000
+frame frame frame anim texture = frame 1.0 0.500000
+= anim bone 0.500000
+1.0 0.500000 frame
+bone 0.500000 bone bone
+anim = material
+bone
+texture anim texture 1.0 material bone material 1.0 material material material 1.0 frame
+0.500000 texture
+anim texture =
+bone anim -1 1.0 1.0 vertex anim 0.500000 -1
+1.0 bone bone anim bone 1.0 texture -1 -1 vertex -1
+bone bone anim texture material frame vertex 0.500000
+1.0
+vertex
+texture
+material material = bone 1.0 1.0 bone 0.500000
+frame texture 0.500000
+0.500000 te
\ No newline at end of file
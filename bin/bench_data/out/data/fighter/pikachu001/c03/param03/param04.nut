@@ -0,0 +1,3 @@
+-1
+frame bone vertex material anim 1.0 0.500000 frame material frame
+texture bone anim verte
\ No newline at end of file
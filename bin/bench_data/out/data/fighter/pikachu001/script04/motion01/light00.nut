@@ -0,0 +1,259 @@
+anim vertex
+frame 1.0 anim = texture frame texture texture vertex
+1.0 anim frame texture anim =
+1.0 texture
+bone 0.500000 material bone = 0.500000 -1
+-1 vertex frame material 0.500000 material 1.0 frame
+frame 1.0 = material vertex
+= bone texture
+vertex
+texture frame
+texture -1
+material
+-1
+0.500000 0.500000 -1 0.500000 1.0 material = -1
+= 1.0 bone
+1.0 bone anim bone
+bone frame = bone -1 = = -1 material texture
+frame frame
+material bone
+0.500000 texture = anim 0.500000 1.0
+bone -1 material =
+frame
+material 1.0 vertex 1.0 vertex -1 texture
+bone material
+material
+vertex
+material 1.0 anim = bone bone
+frame 0.500000 -1 vertex bone = vertex anim
+material
+frame 0.500000
+0.500000 bone
+-1 material anim material = vertex 0.500000 vertex
+=
+material frame anim
+1.0
+anim 1.0
+vertex anim 0.500000 bone 0.500000 anim = 0.500000
+anim anim 0.500000 frame -1 vertex material
+material material
+0.500000 vertex 1.0 = 0.500000 = 0.500000 anim
+=
+vertex texture
+frame material
+0.500000 0.500000 frame vertex texture
+anim frame texture frame material 1.0 =
+bone 1.0 vertex bone texture bone bone 1.0 vertex
+1.0 -1
+anim
+anim material
+-1 anim material 0.500000 = = bone texture
+material vertex 0.500000 -1
+1.0 vertex
+anim
+texture
+0.500000 -1 vertex =
+0.500000 0.500000 anim 0.500000 1.0 1.0
+material texture
+bone 1.0
+-1
+0.500000 frame texture vertex material
+texture 0.500000
+anim
+anim = texture texture vertex material
+= frame vertex = material 1.0 =
+bone
+1.0
+0.500000 anim
+1.0 bone vertex -1
+texture = -1 anim material 0.500000
+vertex 0.500000 texture texture
+= bone -1
+0.500000 material anim bone frame texture
+bone frame
+material 0.500000
+anim
+-1 texture
+= texture anim = material 0.500000 bone bone
+texture frame material frame texture 1.0
+bone material =
+= 0.500000 bone bone texture
+-1 material material = frame -1 texture
+1.0 texture material vertex 0.500000
+frame anim
+bone
+-1 anim -1 0.500000 bone
+texture 0.500000 1.0 1.0 -1 frame
+anim
+1.0
+= texture
+=
+frame material anim 1.0 frame bone bone 0.500000 1.0 bone -1 1.0
+-1 vertex anim frame
+frame frame anim 1.0 -1
+0.500000 bone = 1.0 anim frame bone = 1.0
+texture material 0.500000 1.0
+1.0 1.0 texture anim bone
+1.0 vertex bone material 1.0
+= 1.0
+bone 1.0 0.500000 vertex frame
+material 0.500000 -1 = frame
+-1 texture
+0.500000 material texture bone material texture
+frame material anim 0.500000 vertex = frame frame 0.500000 anim
+material texture bone frame 1.0 = frame 0.500000 = =
+texture vertex -1 0.500000 = = bone vertex 1.0 bone texture
+1.0
+= -1 material
+anim 1.0 = frame anim = vertex bone frame -1 material =
+bone
+anim
+bone texture 1.0
+bone 1.0 1.0 = frame frame bone
+-1 material bone =
+material frame material bone material bone
+1.0
+bone texture bone
+-1 =
+0.500000
+vertex = = frame vertex = material = anim frame texture = 0.500000 material -1 anim frame -1
+material =
+0.500000 frame vertex
+0.500000 vertex
+material vertex bone
+frame material vertex 1.0 material texture
+vertex anim
+bone material texture
+0.500000
+material material 0.500000 vertex
+anim anim 0.500000
+0.500000 anim 0.500000 anim 0.500000 -1 anim frame -1 frame material frame material 0.500000 frame material 0.500000 1.0 material texture = 1.0 -1 vertex 1.0
+= = 1.0 vertex 0.500000
+1.0 -1
+= -1 bone anim vertex 0.500000
+texture bone vertex anim -1 material 1.0
+material 0.500000 0.500000 1.0
+-1 -1
+-1 1.0 bone
+bone vertex material 0.500000 frame 1.0 bone
+anim material -1 1.0
+texture bone
+material material
+anim bone material = frame
+anim 0.500000 0.500000 -1
+1.0 texture
+= frame material
+1.0 vertex vertex 1.0 = material
+1.0 frame frame texture bone = 1.0 frame vertex -1
+anim bone frame vertex -1 anim
+material 1.0 texture
+= frame 1.0 vertex texture frame 0.500000 -1 vertex
+0.500000 bone frame vertex texture bone 0.500000 frame vertex 0.500000 1.0 anim 0.500000 frame frame = 0.500000 texture vertex anim anim
+vertex vertex 1.0 = bone
+= = material 0.500000 texture
+texture = bone -1
+0.500000 material 1.0 1.0
+vertex frame = 1.0
+-1
+texture texture -1 texture texture material texture 1.0
+frame material bone anim frame vertex
+0.500000
+material 0.500000 = vertex texture frame 1.0
+frame vertex = = anim
+anim vertex 1.0 0.500000 vertex
+bone texture texture
+= 0.500000
+= material anim 1.0 vertex anim 1.0 anim = -1
+bone material 0.500000
+-1 =
+frame = -1 texture = 0.500000 texture
+anim texture 1.0 frame
+anim vertex anim
+texture bone frame 1.0 vertex
+= -1 material 0.500000
+= = =
+=
+0.500000 bone = vertex 0.500000
+material 1.0 =
+1.0 material 1.0
+texture 1.0 anim 1.0 material frame frame
+texture
+0.500000 material 0.500000 = anim = 1.0 0.500000 material material vertex
+1.0
+bone material
+texture texture material = frame texture
+vertex
+= material 0.500000 material vertex vertex anim
+bone 0.500000
+1.0 0.500000 1.0 1.0 vertex 1.0 vertex vertex
+frame bone
+0.500000
+frame
+material = 0.500000
+= 0.500000
+frame anim =
+0.500000
+vertex texture = vertex bone 0.500000 bone
+texture = bone
+material bone -1
+texture frame -1 anim anim frame 1.0 texture texture 1.0
+frame anim -1
+= bone = -1 1.0
+anim anim
+vertex
+1.0 frame texture
+frame frame
+frame material anim texture -1 texture vertex
+0.500000 material material
+frame frame -1
+texture bone
+bone
+frame texture = -1 frame anim -1 vertex
+anim
+frame frame material
+0.500000 0.500000 material material anim = = anim = vertex
+material -1 -1 0.500000 1.0 material
+0.500000
+1.0 frame 0.500000 frame vertex
+frame
+0.500000 0.500000 vertex vertex -1
+material vertex texture anim frame material
+material 1.0
+frame bone -1 bone
+0.500000 -1 0.500000
+anim -1 frame -1 frame vertex 1.0
+bone frame anim
+1.0 vertex
+vertex vertex
+0.500000 -1 material anim bone frame =
+vertex anim
+anim
+material = -1 vertex
+material 0.500000 -1
+bone bone vertex frame material frame bone 1.0 bone
+vertex material bone
+-1
+0.500000 1.0 = anim
+material vertex
+vertex material 0.500000
+frame material material
+vertex vertex texture texture -1 vertex frame
+frame -1 material frame
+texture 1.0
+1.0 =
+bone -1 1.0 0.500000 bone
+bone material
+anim
+texture material
+vertex
+-1 1.0 vertex vertex = vertex 0.500000 texture
+material 0.500000 vertex texture 0.500000 material = frame
+material 0.500000 vertex
+material frame = 0.500000 1.0 1.0 material
+0.500000
+material material texture -1 anim
+frame -1 bone bone = material
+0.500000
+-1
+= frame material bone -1 -1
+materi
\ No newline at end of file
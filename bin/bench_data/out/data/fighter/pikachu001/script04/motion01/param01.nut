@@ -0,0 +1,5 @@
+vertex frame vertex -1 0.500000
+0.500000 = 0.500000 1.0 vertex frame
+vertex
+anim 1.0
+1.0 = vertex frame
\ No newline at end of file
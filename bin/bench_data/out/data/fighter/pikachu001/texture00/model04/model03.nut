@@ -0,0 +1,17 @@
+bone frame material
+frame bone
+-1 1.0 bone
+anim = material 1.0 bone
+texture 1.0 material frame -1 = bone = vertex = 0.500000 1.0 0.500000
+anim
+1.0 -1 bone texture texture bone bone 0.500000 bone vertex
+material
+vertex material material
+1.0 = -1 1.0 material
+1.0
+bone anim bone
+bone anim bone bone 1.0 bone material frame 1.0 anim bone texture
+material anim frame -1
+= bone
+0.500000 0.500000 texture bone -1
+te
\ No newline at end of file
@@ -0,0 +1,13 @@
+vertex anim 1.0
+frame 0.500000 material
+frame anim
+texture frame texture 1.0
+material = bone 1.0
+=
+1.0 material
+material material 0.500000
+0.500000 frame
+= = vertex bone bone
+0.500000 anim anim bone 1.0 frame 0.500000 vertex material 0.500000
+= = 1.0
+anim texture texture -1 -1 1.0 vertex anim -1 1.0 material textur
\ No newline at end of file
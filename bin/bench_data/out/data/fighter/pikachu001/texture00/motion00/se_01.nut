@@ -0,0 +1,2 @@
+[iH|%f'f"ܷ;1hzƖt˭58Z!
+8]tq7%"I_$
\ No newline at end of file
@@ -0,0 +1,7 @@
+frame material
+anim = 1.0 bone = anim
+anim 0.500000
+vertex texture 1.0 vertex vertex material 0.500000 0.500000 = frame -1 bone 0.500000
+= anim
+-1 0.500000 anim
+material texture 
\ No newline at end of file
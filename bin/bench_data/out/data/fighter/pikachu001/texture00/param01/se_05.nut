@@ -0,0 +1,124 @@
+bone 1.0
+texture vertex anim -1
+0.500000 -1 material anim = 0.500000 vertex anim = anim anim anim bone
+-1 = 1.0 vertex frame material 1.0 anim frame bone
+texture 1.0 texture vertex -1 1.0
+texture =
+anim
+0.500000
+vertex anim
+= 1.0 material frame
+0.500000 = 1.0 =
+=
+= 1.0 0.500000 anim vertex
+0.500000
+texture texture 0.500000 vertex bone texture texture 0.500000 frame bone texture
+bone 0.500000 bone
+frame 1.0
+0.500000 frame
+anim
+= 0.500000 texture frame 0.500000 1.0 bone
+-1 -1 anim -1 vertex anim vertex 1.0 0.500000 -1 material 0.500000 = -1 vertex -1
+= 0.500000 = -1 vertex frame 1.0 -1 texture bone 1.0 texture texture
+vertex
+bone vertex vertex
+frame
+= -1 anim
+texture material 1.0
+bone
+anim
+frame vertex
+texture frame frame frame vertex
+material material anim
+texture anim
+vertex material -1 frame -1
+texture 1.0 1.0
+-1 anim vertex anim vertex frame material anim
+texture
+vertex 0.500000 texture 0.500000 texture material
+texture anim vertex bone
+vertex vertex vertex = anim anim 1.0 bone texture 1.0 vertex 0.500000 bone material
+anim
+anim bone 1.0 texture
+frame frame 1.0 anim bone anim material frame anim
+texture bone -1 vertex 0.500000 1.0
+vertex vertex
+texture 1.0 0.500000
+anim texture vertex
+1.0
+vertex 1.0
+material 0.500000
+vertex 0.500000 bone
+vertex frame 1.0 texture anim
+material
+texture frame texture -1 anim frame = -1 -1
+1.0 =
+anim bone -1
+anim -1 frame bone 0.500000 frame
+vertex
+anim texture
+bone = 1.0 -1
+bone vertex material 0.500000
+frame vertex
+vertex anim anim
+bone
+texture
+1.0 0.500000 texture texture =
+vertex -1 1.0 anim 0.500000 vertex anim anim anim =
+frame anim 0.500000 =
+anim 0.500000 texture
+frame
+0.500000
+material
+anim
+texture = bone = = material 1.0 0.500000 bone
+material vertex vertex vertex
+frame = anim texture -1
+1.0 0.500000 0.500000 -1 = 1.0 = 0.500000
+-1 anim 1.0 bone = anim vertex
+-1 anim material frame = anim bone
+0.500000 0.500000
+material vertex anim
+1.0 texture
+bone vertex =
+1.0
+material frame
+texture
+anim -1
+1.0 -1 1.0
+-1
+= material anim 0.500000 1.0 0.500000
+0.500000 0.500000 1.0 0.500000 material bone frame
+anim
+1.0
+0.500000 1.0
+1.0
+-1 texture texture texture = vertex = material material
+frame
+texture vertex = frame material vertex bone texture = -1
+=
+=
+-1 material frame material 0.500000
+-1
+0.500000 anim 0.500000 vertex texture material
+material 0.500000 texture 0.500000 1.0 anim texture bone vertex frame
+vertex material
+material
+bone bone -1 vertex
+texture 1.0 material 0.500000 vertex anim
+frame 1.0 frame texture
+anim frame bone =
+-1 texture 1.0 -1 1.0 -1 frame
+1.0 frame vertex = bone anim
+anim texture = 1.0
+vertex
+= material vertex
+bone frame 1.0
+bone anim material vertex
+-1 1.0 vertex texture anim
+material 0.500000 -1 1.0 1.0 texture vertex
+bone 0.500000
+frame
+texture bone vertex material
+bone anim 0.500000 0.500000 =
+material texture vert
\ No newline at end of file
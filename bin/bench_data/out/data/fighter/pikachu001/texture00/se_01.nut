@@ -0,0 +1,24 @@
+= 1.0 vertex
+= frame frame bone bone 0.500000 frame
+material
+-1
+anim = -1
+bone
+= vertex vertex material 1.0 anim
+bone -1 material material frame 1.0
+bone
+1.0
+vertex 0.500000 bone material = 0.500000
+-1 frame 1.0 =
+material = -1 -1 bone
+0.500000
+0.500000 = vertex
+material 0.500000 anim
+material 0.500000 frame vertex
+0.500000
+material 0.500000
+0.500000 anim vertex vertex anim frame vertex
+bone anim =
+material material
+vertex 0.500000 material -1 bone vertex
+= anim vertex = 0.500000 material
\ No newline at end of file
@@ -0,0 +1,24 @@
+anim material anim texture 0.500000
+texture bone vertex anim
+frame material
+material -1
+anim =
+material 0.500000 bone
+vertex -1 vertex 0.500000 0.500000 material texture anim vertex
+0.500000
+material frame
+material texture 0.500000 vertex 1.0 0.500000
+0.500000 material 0.500000 = = anim -1 bone
+1.0 = bone frame material 1.0 bone 1.0
+material material material texture vertex 0.500000 0.500000
+-1 1.0 vertex material
+bone texture 0.500000 -1 1.0 1.0 = material bone 0.500000 material vertex
+= frame bone
+-1 bone vertex 1.0 vertex material anim frame texture 0.500000 = anim bone -1
+= vertex 1.0 bone material
+1.0 0.500000 vertex bone -1 = frame material
+= material anim bone
+0.500000 bone
+1.0 1.0
+bone material bone frame
+-1 -1 bone -1 texture anim bone bone -1 material material 1.0 f
\ No newline at end of file
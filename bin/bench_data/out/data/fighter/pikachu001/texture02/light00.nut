@@ -0,0 +1,292 @@
+frame material
+1.0 material anim 1.0 material =
+frame
+bone 0.500000 1.0 texture
+anim
+1.0
+anim texture -1 material 1.0 vertex vertex bone texture frame bone
+-1 frame 1.0 0.500000 texture frame frame bone anim
+vertex texture frame =
+1.0 texture frame bone -1 1.0 -1 = frame anim
+= 1.0
+= material anim -1 = -1
+material bone 1.0 -1 bone
+material frame texture frame -1
+texture 0.500000 1.0 texture
+vertex vertex -1 vertex =
+bone
+material = material vertex anim material frame
+1.0 texture -1
+texture 0.500000 vertex
+= frame 0.500000 1.0
+frame = frame
+anim
+bone 1.0 1.0 material vertex anim
+-1 material 0.500000
+texture
+anim =
+-1
+1.0 frame anim anim =
+bone vertex texture 1.0 =
+anim frame = material 1.0 -1 texture 1.0
+1.0 texture texture 1.0 -1 bone 0.500000 anim frame material
+frame
+texture
+anim -1 bone
+anim bone
+bone 1.0
+1.0 material vertex anim
+= anim -1 0.500000 = vertex = 1.0 = texture =
+vertex material 1.0 texture texture bone bone 0.500000 0.500000
+0.500000 = texture 1.0 bone -1 material bone
+anim material texture texture material = 1.0 bone texture texture texture = 0.500000
+0.500000 -1 anim material bone
+-1 frame -1 anim
+material material
+0.500000
+-1
+0.500000
+-1 0.500000
+material texture 0.500000 frame anim
+material bone 1.0 -1 material anim material material bone
+bone frame texture
+frame material frame 0.500000 =
+bone 0.500000 frame
+= 1.0
+material texture
+1.0
+vertex
+1.0 texture =
+anim
+texture
+frame frame = bone texture material material
+anim
+= material 0.500000 anim bone bone 0.500000 frame vertex
+bone bone =
+frame
+bone -1 vertex material texture frame 1.0
+1.0
+0.500000 bone =
+material = vertex anim vertex -1 frame 1.0 0.500000 bone vertex anim anim 1.0 material = frame
+texture texture anim
+texture 1.0
+frame = = 1.0 1.0 = 0.500000 texture anim anim bone
+anim vertex
+1.0 vertex = 1.0 anim
+material 1.0
+vertex 1.0 0.500000 1.0 1.0
+texture =
+1.0 = 1.0 anim bone 1.0 texture vertex
+1.0 vertex anim
+bone
+bone material bone material
+material
+1.0 = frame bone 1.0 anim bone bone material 1.0
+frame 1.0 frame
+bone
+texture 1.0 frame texture -1
+anim frame = texture
+frame
+-1 -1 1.0 bone 0.500000
+material
+material 0.500000
+frame vertex
+vertex texture frame
+vertex = anim
+texture
+= material 1.0 0.500000 1.0 -1 frame
+-1 0.500000 0.500000
+bone
+1.0 texture frame bone
+-1
+bone 0.500000 texture 0.500000 vertex vertex
+-1
+-1 texture = vertex =
+bone -1
+-1 frame material
+vertex frame vertex
+bone vertex vertex
+vertex texture 1.0 anim bone 0.500000 =
+vertex frame
+bone
+1.0 anim
+material -1 1.0
+anim 1.0 texture bone
+texture bone =
+0.500000
+-1 frame anim 1.0 1.0
+frame 1.0 =
+texture frame
+vertex bone vertex
+= vertex
+frame anim anim bone frame bone
+frame bone texture texture 0.500000
+1.0
+vertex anim
+bone
+= 1.0 texture -1 frame -1 frame frame -1 = 0.500000 1.0 bone -1
+-1 -1 frame 0.500000
+frame material = = frame
+anim texture frame = vertex
+anim
+-1
+anim 1.0 vertex -1 frame texture
+anim 0.500000 1.0 texture anim 1.0 texture frame 1.0 frame anim
+texture 1.0
+-1
+=
+anim material bone 1.0 bone = anim texture -1
+bone bone 0.500000 = = = vertex 0.500000 frame
+1.0 0.500000 0.500000 material vertex anim texture =
+-1 1.0 0.500000 anim 0.500000 texture bone vertex
+-1
+= anim = = bone -1 = frame material 0.500000
+vertex vertex = material anim
+1.0 -1 bone 1.0
+bone 0.500000
+1.0 texture bone vertex 0.500000 anim frame texture
+anim
+bone frame anim 1.0 material texture bone vertex
+0.500000 texture
+-1
+anim 0.500000 0.500000 texture 0.500000
+material -1
+-1
+vertex = -1 anim -1 = -1 1.0
+anim texture = = = texture material material bone material 0.500000 texture texture -1
+-1 material 1.0 bone texture anim frame frame
+=
+anim 0.500000
+material anim texture bone
+frame
+frame vertex 1.0
+material frame -1 vertex 1.0
+frame anim 0.500000
+vertex -1 1.0 frame = texture = vertex material -1 -1
+vertex -1 0.500000
+0.500000
+frame
+1.0
+bone
+0.500000
+anim material -1 0.500000 anim 1.0 material material 0.500000 anim texture
+frame frame
+material
+material
+=
+-1 = vertex
+frame bone
+0.500000 1.0 0.500000 bone anim 1.0 = -1 material frame
+1.0 material 0.500000
+texture
+bone
+= 0.500000
+vertex material = -1 frame frame vertex
+texture frame
+0.500000 =
+vertex -1 0.500000
+vertex 0.500000 frame = bone 0.500000 material bone vertex 1.0 0.500000 frame bone = material frame
+1.0
+vertex vertex
+-1 vertex vertex 0.500000 -1 1.0 =
+frame -1 0.500000 = 1.0
+frame texture 1.0 texture -1
+bone
+=
+vertex material 0.500000 texture 0.500000
+vertex vertex vertex = texture texture texture texture
+bone
+-1 =
+material
+bone 0.500000 = material = anim frame vertex bone vertex 0.500000 texture bone 0.500000 = 0.500000 0.500000
+bone -1 bone -1 0.500000 bone vertex anim frame bone texture
+-1 frame
+0.500000 = vertex texture texture anim anim
+1.0 frame material
+vertex material 0.500000 0.500000 =
+frame
+-1 anim = anim material -1 0.500000
+material
+1.0 texture
+0.500000 anim frame
+vertex =
+0.500000
+vertex -1
+texture anim 1.0 1.0 1.0 texture
+1.0
+vertex -1 material material
+0.500000
+-1
+-1 anim 0.500000 frame bone vertex
+frame
+texture material 1.0 material texture -1 anim
+bone
+texture material anim 0.500000 bone 1.0 anim
+bone anim texture anim material -1 bone 0.500000 texture anim
+anim anim -1 bone texture
+bone -1 bone
+texture 1.0 0.500000 frame -1 = material texture bone anim =
+anim anim material bone frame = 0.500000 -1
+frame = = material 0.500000 frame
+material
+bone material anim frame vertex
+1.0 = 1.0 1.0
+=
+bone -1 1.0 1.0 anim
+material bone texture vertex =
+frame
+texture = frame
+anim 1.0 0.500000
+= = 1.0
+vertex bone -1
+1.0 bone anim anim texture frame material 1.0 vertex material
+0.500000 -1 material anim
+1.0
+-1 1.0 -1 =
+anim material -1 -1
+vertex
+anim 0.500000 texture bone texture 0.500000 texture = material
+material 0.500000
+vertex vertex vertex
+material 1.0 anim texture bone 0.500000
+frame
+-1 -1 = texture anim
+1.0 bone 0.500000
+= -1 frame anim = bone
+bone
+1.0 material -1 -1 1.0 texture 1.0 texture material 1.0
+bone 1.0 frame =
+texture
+frame
+bone
+1.0 1.0 material vertex 0.500000 bone material frame anim anim
+0.500000 anim 1.0 material
+1.0 vertex -1 bone 1.0 anim bone
+vertex
+0.500000 =
+= = bone = vertex anim = bone
+texture anim frame bone 0.500000 1.0 texture -1 -1
+texture
+1.0
+0.500000 frame
+0.500000
+bone texture material frame texture bone = = 1.0 0.500000 -1
+0.500000
+0.500000 material texture vertex
+frame texture vertex 1.0 -1 1.0 -1 texture -1
+anim 1.0 frame bone = frame vertex
+anim bone = material texture
+vertex
+bone anim
+bone = texture 1.0 vertex 0.500000
+bone anim
+bone material
+frame frame 1.0 1.0 0.500000 material
+1.0 frame 0.500000 material = vertex
+texture -1 vertex 1.0
+1.0 frame frame texture bone bone frame -1 1.0 texture anim
+anim bone material anim frame -1 -1 anim
+= 1.0 anim = =
+frame
+vertex =
+= frame m
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex material 0.500000 = -1
+= 1.0 texture
+anim 0.500000 -1 t
\ No newline at end of file
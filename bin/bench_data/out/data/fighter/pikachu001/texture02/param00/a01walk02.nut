@@ -0,0 +1,101 @@
+anim
+bone material 1.0
+frame 1.0 vertex texture bone
+anim frame = texture -1 =
+-1 -1 1.0 vertex bone anim texture = = material bone frame vertex frame = material frame texture = 0.500000 anim bone bone
+material anim frame anim material material texture -1 = frame =
+0.500000 material
+1.0 0.500000 anim -1 bone
+frame
+anim
+vertex texture
+1.0 1.0
+anim 0.500000
+frame
+frame -1
+frame frame
+1.0 anim
+vertex 1.0 0.500000 -1 texture material 1.0 1.0 material 0.500000
+-1 frame texture texture -1 texture frame 0.500000
+frame -1
+1.0 1.0
+frame frame = material
+bone
+material
+-1 = texture
+1.0 -1 1.0
+vertex anim = frame =
+-1 bone texture 1.0 frame 0.500000 -1
+texture = texture
+= -1
+texture frame
+frame
+frame texture material vertex
+anim = texture
+anim -1
+vertex anim
+anim material anim
+1.0
+material
+1.0 1.0 texture anim 0.500000
+vertex frame bone
+0.500000
+-1 texture
+0.500000 0.500000 frame anim
+0.500000
+-1 = 1.0 material = anim anim bone vertex 0.500000 vertex material texture
+0.500000 texture 0.500000 texture 1.0
+-1 material texture -1 anim = =
+-1 texture
+= frame material texture 0.500000 bone anim vertex bone anim 0.500000 anim 0.500000 frame material material
+anim 0.500000
+anim
+texture texture 1.0 material
+texture material frame 1.0
+= =
+-1 anim
+1.0 texture
+anim anim 0.500000 vertex material vertex
+material
+vertex vertex -1 texture
+texture vertex
+1.0 -1 vertex
+material vertex bone 1.0 -1 vertex texture frame
+0.500000 anim
+bone -1 frame frame 1.0
+0.500000 0.500000 anim bone = vertex =
+-1 vertex
+0.500000 bone
+1.0 0.500000 0.500000 1.0 bone 1.0 frame bone texture
+vertex anim anim bone texture bone
+= -1 anim bone -1
+material frame anim material vertex
+material = vertex = material 0.500000 bone
+anim anim
+vertex
+1.0 frame texture 1.0
+texture -1 anim = bone
+anim texture 1.0 frame frame bone material
+= texture
+bone
+vertex
+frame 0.500000 =
+vertex bone = 1.0 = material 1.0 bone material vertex
+1.0
+-1
+vertex
+1.0 anim 0.500000 bone frame texture
+vertex 0.500000
+1.0 -1
+texture vertex
+anim
+anim anim material 1.0
+= anim
+frame material 0.500000 vertex
+texture bone frame = 0.500000 bone 0.500000
+frame -1 1.0 frame material anim
+material
+-1
+texture 0.500000 vertex
+bone 0.500000 texture
+vertex 0.500
\ No newline at end of file
@@ -0,0 +1,13 @@
+frame frame bone anim bone anim vertex 0.500000 1.0 vertex
+material texture vertex texture
+anim -1 frame anim
+0.500000 anim material anim
+= -1 -1 1.0 = vertex 1.0 bone
+-1
+1.0 material -1 anim
+texture
+vertex bone 0.500000 vertex bone -1 0.500000 anim vertex
+bone material 0.500000 vertex texture material
+material bone
+0.500000 1.0 frame vertex texture 1.0 frame frame
+0.500000 1.0 bone material fram
\ No newline at end of file
@@ -0,0 +1,129 @@
+vertex
+material = -1
+bone anim frame
+anim texture 0.500000
+-1
+anim 1.0
+material
+frame vertex material
+anim anim
+-1 vertex
+frame =
+= bone 0.500000 material material material 1.0
+0.500000 frame
+vertex anim material texture
+vertex 0.500000 vertex material -1 frame anim material 1.0 anim = material 0.500000 1.0
+frame 0.500000 anim
+1.0 frame 0.500000
+vertex bone 0.500000 1.0 = texture
+texture texture frame vertex vertex anim material frame = anim 1.0 = vertex vertex bone = vertex
+1.0
+-1 vertex = texture texture material 1.0 material
+texture material
+material texture -1 vertex bone bone texture anim texture material vertex 0.500000 bone
+0.500000 -1 1.0 anim bone =
+anim
+material
+-1 bone bone =
+= material frame
+frame anim anim bone -1 = 0.500000 0.500000
+1.0 material -1 bone 1.0 -1 anim material
+vertex material vertex material bone bone
+material -1
+-1 0.500000 =
+-1 bone 0.500000 frame bone
+vertex =
+frame = -1 vertex =
+-1
+material
+bone -1 material
+frame
+anim 0.500000 bone vertex
+1.0
+texture
+-1 -1 =
+vertex texture -1
+= material anim 1.0 texture material -1 -1 0.500000 frame = =
+material material bone = -1
+texture
+anim = -1 frame vertex vertex material bone texture -1 = 0.500000 bone anim -1 -1 0.500000 0.500000
+bone vertex
+frame
+anim = material anim material
+-1
+frame 0.500000 material material = =
+anim texture frame 0.500000 frame
+material frame 1.0
+material vertex
+0.500000 0.500000 frame texture
+frame vertex
+1.0 frame 1.0 anim -1
+0.500000 anim
+vertex frame
+bone
+=
+anim 1.0 texture frame
+frame 0.500000 material material -1 vertex
+material
+bone
+anim
+bone vertex 1.0
+bone 1.0 1.0 = vertex anim vertex 1.0
+frame material
+bone
+1.0
+frame anim anim texture
+=
+vertex
+material vertex frame
+frame = vertex =
+material -1 texture material anim = anim 1.0
+0.500000 =
+texture anim anim 0.500000 material 0.500000 material
+vertex frame -1
+1.0 1.0 texture -1 material
+frame frame
+texture 0.500000 -1 material 0.500000 anim texture texture anim 1.0
+texture vertex -1 0.500000 vertex vertex 1.0 0.500000 vertex 0.500000 = 1.0
+texture bone bone anim anim texture material -1 vertex frame vertex vertex = 1.0 vertex bone -1 anim 1.0
+texture vertex material -1 = -1
+bone
+1.0 1.0 0.500000 bone
+-1 texture 1.0
+-1 frame
+0.500000
+anim texture = -1 frame 1.0 bone frame frame 1.0 material bone material 1.0 texture
+= -1 material
+frame
+vertex texture 1.0 -1 texture frame frame =
+frame 0.500000 texture
+1.0
+1.0 texture bone material frame
+-1 -1 vertex =
+-1
+material = material 1.0
+0.500000 anim 1.0
+0.500000 material 0.500000 bone
+0.500000
+1.0 texture
+1.0 bone frame
+bone 0.500000 texture
+material bone
+vertex -1 material 1.0 1.0
+0.500000 = anim
+vertex
+vertex
+anim
+frame = material frame
+0.500000 texture
+1.0 material bone
+frame material frame texture material bone frame 1.0 texture material -1
+0.500000 material 0.500000 = 0.500000 1.0 1.0 frame material
+texture bone
+material =
+anim -1 frame
+texture -1 vertex frame = 0.500000
+anim
+anim 0.500000 =
+1.0 texture texture
+vertex bone bone material = texture -1
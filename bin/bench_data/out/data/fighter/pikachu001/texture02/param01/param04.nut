@@ -0,0 +1,11 @@
+material
+frame anim
+anim
+-1 bone vertex 0.500000 vertex material -1 = 0.500000 bone frame vertex anim texture
+bone bone
+texture -1
+bone
+texture
+1.0 = texture material vertex
+anim
+-1 0.50
\ No newline at end of file
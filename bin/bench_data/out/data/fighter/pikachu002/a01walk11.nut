@@ -0,0 +1,337 @@
+vertex bone vertex frame texture vertex
+= vertex anim material
+vertex
+0.500000 -1 anim vertex 1.0 anim 1.0 0.500000
+=
+anim 1.0 anim bone
+1.0 vertex 1.0 = 1.0 0.500000 texture 1.0 -1 -1 bone
+material 1.0 = anim bone -1 1.0 bone anim bone bone 0.500000 anim
+0.500000 vertex vertex anim vertex frame
+=
+material anim texture frame 1.0 material anim =
+texture
+material frame anim
+frame bone bone -1 1.0
+0.500000 vertex material anim texture -1
+texture -1 1.0
+vertex material 0.500000 frame -1 material 1.0 0.500000 texture = material texture 1.0
+texture
+frame 0.500000
+1.0 frame
+-1 material = -1 =
+bone
+bone
+frame
+bone texture texture bone -1
+-1
+material
+material 0.500000 vertex 0.500000
+bone 0.500000 0.500000 -1 material -1 bone
+= texture 1.0
+anim
+bone
+1.0 vertex
+1.0
+bone 1.0 texture -1 1.0 material bone 1.0 texture frame
+material 1.0 material frame -1 bone
+texture
+material
+-1
+anim material material 1.0
+material material material texture material
+material frame
+texture 0.500000 texture bone
+=
+frame
+material bone vertex -1 anim = vertex
+frame
+1.0 vertex
+material
+texture 0.500000
+vertex vertex
+anim material 1.0 material
+0.500000 = vertex
+bone 0.500000
+-1 0.500000
+vertex
+frame vertex texture vertex 0.500000 frame material bone anim frame vertex
+0.500000 0.500000 material = texture
+frame bone 0.500000
+frame
+vertex = material 0.500000 1.0 -1 = 0.500000
+frame
+-1
+frame -1 bone 1.0 =
+texture 0.500000 0.500000 = texture vertex
+texture vertex material
+anim anim bone vertex
+material -1 material texture material
+vertex = frame bone vertex anim texture vertex frame = 0.500000 material -1 material -1 material 1.0 frame material frame anim -1
+texture frame frame texture material -1 = material
+0.500000 anim 0.500000 =
+vertex =
+bone vertex
+= -1 frame 1.0 0.500000 = vertex
+texture =
+bone 0.500000
+texture bone 1.0 bone anim
+1.0 material frame =
+material 1.0 texture
+material 1.0 1.0
+bone
+-1 material anim 1.0 material bone
+frame = frame 0.500000
+vertex
+vertex material 1.0
+vertex
+1.0
+1.0 bone 0.500000 bone -1 anim 0.500000 frame
+frame
+frame texture material
+frame
+material =
+1.0 anim = anim texture 0.500000
+frame 1.0 -1
+vertex
+texture texture
+anim 0.500000
+bone frame 0.500000 vertex
+bone anim 1.0 frame frame anim
+1.0 material vertex vertex bone = vertex -1
+= material 1.0 texture vertex
+0.500000 bone bone
+= frame material = frame
+material = material
+vertex anim 0.500000 -1 0.500000
+1.0
+0.500000
+1.0 texture = anim = vertex
+vertex
+texture texture 0.500000 material
+bone 0.500000
+anim texture vertex 0.500000 texture
+-1
+=
+material -1 frame
+0.500000 vertex
+-1 bone anim frame anim
+=
+texture bone anim 0.500000 vertex
+bone
+= bone material texture
+anim 0.500000
+bone 1.0 anim 1.0 vertex material frame
+frame
+0.500000 -1 texture anim texture
+texture texture 0.500000
+material 0.500000 1.0
+material frame
+frame frame
+material
+material texture = texture bone
+1.0 0.500000 0.500000 vertex bone anim
+0.500000 -1 bone 1.0 material 1.0 -1 anim anim
+anim
+-1 0.500000 1.0 0.500000
+0.500000 -1 0.500000 anim material -1
+material
+= 0.500000
+= vertex bone material
+0.500000 texture
+texture bone
+anim 1.0 -1 0.500000
+material 0.500000 anim -1 = texture frame -1 bone
+-1 0.500000
+0.500000 anim
+anim
+-1 bone bone 1.0 anim texture
+vertex
+frame anim anim material
+vertex
+0.500000 material material
+texture 1.0 1.0 material anim texture = frame material =
+1.0
+0.500000
+anim
+material
+vertex material
+= =
+material 0.500000 bone
+vertex = material
+frame anim material
+1.0 1.0 frame -1
+vertex 1.0 texture
+1.0 -1
+material -1 vertex frame -1 anim -1 frame vertex 0.500000 frame 1.0 bone frame
+vertex
+= 0.500000
+anim anim -1
+1.0 frame
+anim bone frame texture -1 frame bone bone bone texture vertex
+1.0
+0.500000 1.0 material
+bone
+frame -1 -1 vertex = 1.0 -1 = 1.0 bone vertex texture frame =
+1.0
+material frame -1 1.0
+1.0 material
+texture
+texture 0.500000 anim
+-1
+-1
+texture frame 0.500000 =
+frame
+material = vertex vertex -1 bone material frame texture 0.500000 -1 texture 0.500000 vertex texture material -1 anim
+bone -1 anim 1.0 1.0 1.0 anim bone -1 texture
+anim
+bone
+bone = anim anim -1 vertex bone vertex
+texture 1.0 vertex texture material 0.500000 anim texture bone
+texture texture 0.500000 bone bone anim frame anim bone 0.500000 anim vertex vertex texture 0.500000 vertex bone material = texture material 0.500000 texture 0.500000 vertex = material frame = 1.0 vertex anim -1 0.500000 anim material -1 anim
+frame -1 material 1.0 =
+vertex vertex -1 -1
+anim = texture texture vertex = frame anim vertex vertex anim -1 0.500000
+frame 1.0 = texture vertex bone anim
+1.0 = vertex 0.500000 material
+0.500000 bone material anim vertex frame material =
+bone
+1.0
+1.0 0.500000 material vertex material 0.500000
+frame vertex 0.500000 bone =
+0.500000
+frame 1.0 vertex material
+vertex frame vertex = -1 anim 1.0 -1
+1.0 anim
+vertex
+0.500000 vertex
+material anim 0.500000 0.500000 texture 0.500000 =
+frame =
+bone 0.500000
+material = frame anim bone
+-1
+texture = 1.0 -1 -1 = frame texture texture =
+material bone material anim anim
+bone
+-1 vertex texture vertex 0.500000
+-1 1.0 anim frame material material
+0.500000
+material bone
+1.0
+frame
+bone frame vertex = -1 vertex 1.0 anim material bone bone = frame bone material 0.500000 -1 vertex = = =
+bone =
+vertex
+anim texture frame 0.500000
+frame
+1.0 texture
+frame -1 bone material 1.0 -1
+material material 0.500000
+=
+bone bone
+1.0
+1.0 vertex
+bone -1 vertex 0.500000 = vertex vertex -1 material bone anim
+=
+1.0 0.500000 = 0.500000
+vertex frame texture -1 vertex frame 1.0 -1 bone anim frame 1.0 =
+texture
+1.0 material texture = =
+frame 0.500000 bone 0.500000 = material vertex vertex
+1.0 = -1 0.500000
+texture
+0.500000 frame -1 1.0
+-1
+bone material
+= material -1
+= -1 anim bone -1 texture bone bone vertex
+anim
+anim 0.500000 anim vertex 0.500000 1.0 1.0
+bone
+material anim
+material
+= -1
+anim
+frame texture texture frame 1.0 -1
+material
+= -1 1.0 0.500000 0.500000 bone 0.500000 vertex
+frame 0.500000 -1 vertex -1 -1 bone =
+bone =
+frame material bone frame bone
+=
+1.0
+=
+material vertex vertex
+=
+material frame
+material
+anim
+0.500000 bone frame
+1.0 vertex bone anim -1
+0.500000 -1 = vertex
+texture texture 0.500000 vertex
+frame material = vertex
+1.0 0.500000 -1 bone -1
+material bone anim texture
+frame bone material bone 1.0 frame -1 material 1.0 vertex
+texture
+texture frame bone
+texture
+texture vertex bone texture 0.500000 material = anim
+1.0 -1 -1 0.500000 0.500000 vertex
+-1 -1 1.0 1.0 1.0
+frame anim
+anim texture
+vertex
+-1 material vertex vertex 0.500000 material 0.500000 anim = -1 material -1 -1 frame anim 0.500000 texture
+anim bone
+1.0 bone 0.500000
+0.500000
+material
+material texture frame
+0.500000 bone -1 texture frame material vertex 1.0 bone
+0.500000 vertex frame frame 1.0 1.0 -1
+-1 0.500000 0.500000 material
+-1 anim frame anim frame 1.0 material material 0.500000 0.500000 material material bone material 0.500000 = = vertex anim texture texture
+= 1.0
+anim 1.0
+= material
+material vertex vertex bone texture 0.500000 =
+vertex bone texture =
+0.500000 -1
+frame
+texture = vertex anim bone
+= vertex bone bone frame frame
+0.500000 anim material material vertex
+1.0 -1 -1
+= 1.0
+= = anim 0.500000 -1 bone -1
+1.0 material frame =
+= material frame
+vertex vertex vertex texture 0.500000 vertex anim 0.500000 anim material
+vertex =
+material -1 frame frame material anim material -1 1.0 bone -1 -1 anim material anim
+1.0 texture
+anim material frame
+vertex
+frame texture material = material frame
+texture
+texture
+= bone
+1.0 frame
+anim texture anim bone
+anim
+vertex material vertex
+frame -1 bone material anim
+-1 -1 vertex 1.0
+frame vertex
+frame bone 0.500000
+-1 0.500000 texture 1.0 bone anim bone anim
+anim 1.0 frame material
+-1 texture
+-1 bone texture material
+material bone
+-1 anim material material
+-1 frame anim texture
+0.500000 frame material frame texture
+anim
+0.500000 vertex
\ No newline at end of file
@@ -0,0 +1,322 @@
+frame
+texture frame = frame vertex 1.0 0.500000
+anim 1.0 = bone 1.0
+texture bone vertex anim frame texture bone
+0.500000 texture
+texture texture
+0.500000 frame vertex material material 1.0 texture = bone bone frame
+material = material 0.500000 frame texture
+1.0 0.500000 bone 0.500000
+anim
+frame -1
+0.500000 material bone material material
+-1 0.500000 = anim = material 0.500000 anim -1
+0.500000 material
+= texture
+1.0 0.500000 material bone -1 0.500000 bone 1.0 0.500000 1.0
+material frame 1.0 texture frame
+texture frame bone = texture vertex material
+1.0 vertex frame = frame
+= 1.0 1.0
+material
+0.500000 frame
+1.0 frame
+0.500000
+-1 material = = = -1 vertex 1.0 frame 0.500000 vertex
+material anim 1.0
+texture anim
+texture texture 0.500000 1.0 anim vertex
+material
+1.0 texture bone texture frame
+texture -1
+1.0 1.0 anim
+-1 = =
+material =
+material frame vertex anim 0.500000 bone material bone 1.0 = 1.0 bone 1.0 vertex material
+1.0 texture bone
+bone 1.0 frame
+anim -1 frame
+anim anim anim
+bone 0.500000
+= -1 frame frame vertex vertex
+= anim
+vertex texture
+=
+texture
+anim 0.500000 0.500000 anim texture
+vertex vertex -1 1.0 anim -1
+0.500000 anim material anim
+0.500000 anim -1 1.0 0.500000 0.500000
+anim 1.0
+vertex =
+anim -1
+vertex material 1.0
+= bone
+texture frame texture
+0.500000
+1.0 bone frame 1.0 bone bone texture 1.0 texture
+= frame 0.500000
+0.500000 -1 frame material
+texture 0.500000 material -1
+vertex 1.0 vertex frame
+frame bone
+-1 anim
+anim
+frame
+-1 vertex material 1.0 -1 bone frame bone
+-1
+bone
+material anim frame anim
+0.500000 0.500000 bone texture
+frame
+vertex anim texture 1.0 -1
+material material material
+frame
+frame 0.500000 vertex frame material frame
+vertex frame anim vertex 1.0 bone texture bone anim
+material anim
+frame
+= anim bone
+material anim texture
+frame anim 0.500000 = 1.0 1.0 material 1.0
+bone anim 1.0 texture 0.500000 material material texture -1
+material
+frame 0.500000
+anim
+= 1.0 1.0
+bone
+= -1 vertex =
+= vertex -1 1.0 texture
+material -1
+vertex
+0.500000 anim
+anim -1 anim frame
+anim -1 frame anim frame
+0.500000 frame -1 1.0
+texture
+anim 0.500000 material vertex
+material 0.500000 -1 material = -1 texture -1 material
+texture
+-1 0.500000 =
+anim
+texture material vertex
+bone texture anim 1.0 frame 1.0 -1 bone
+bone bone 0.500000
+material vertex 1.0 bone frame
+material anim
+= texture texture
+0.500000 vertex 1.0 0.500000 anim frame = bone vertex frame =
+vertex
+-1 0.500000 material 1.0 1.0 = frame 1.0 vertex =
+=
+1.0
+vertex
+vertex anim anim anim
+1.0 anim texture frame vertex -1 vertex frame = material
+frame anim
+= vertex texture
+0.500000 material anim 1.0 -1 -1 texture frame anim anim frame vertex texture
+-1 texture vertex -1 vertex 0.500000 texture anim frame anim bone texture vertex =
+texture -1 -1 = anim
+-1 -1 = frame texture
+texture 1.0
+= anim texture
+vertex texture 0.500000 bone frame
+material 1.0 = = anim vertex frame
+1.0 texture material 1.0 vertex 1.0 0.500000 frame bone texture texture anim bone
+frame
+= vertex
+=
+0.500000 -1
+vertex
+= material
+1.0
+1.0 -1
+vertex anim
+bone 0.500000 material
+0.500000 anim anim bone
+bone material frame vertex
+0.500000 frame
+= 1.0 bone material
+anim -1
+material
+anim frame
+=
+1.0 bone
+= material bone material
+1.0 frame
+0.500000
+material 1.0 -1
+= 1.0 1.0 1.0 vertex
+1.0
+texture
+bone texture
+frame anim
+1.0 1.0 1.0 frame -1 bone
+bone texture -1 1.0 material 0.500000 texture texture texture anim
+texture texture 1.0
+1.0 frame -1 vertex = 1.0 vertex texture texture bone
+0.500000
+vertex 0.500000
+0.500000 texture 0.500000 anim 1.0
+texture
+= =
+-1 frame 0.500000 texture
+-1 texture material
+-1 0.500000 texture anim
+=
+-1 1.0 bone
+1.0 =
+anim texture 0.500000 0.500000 anim 0.500000 bone 0.500000 material anim frame anim
+0.500000 bone 1.0
+-1 bone bone vertex -1
+texture 1.0
+=
+anim frame = bone -1 texture 1.0 frame bone 0.500000 material -1 -1 0.500000
+bone 0.500000 material frame texture frame 0.500000
+texture 1.0 vertex
+texture bone -1
+anim -1 anim frame bone vertex texture
+anim material bone anim material = vertex -1 0.500000 0.500000 texture = = 0.500000 anim texture
+texture 1.0
+frame
+0.500000 frame 1.0 anim
+bone frame 1.0
+= -1 frame
+= texture material texture material
+anim anim bone material
+texture -1 = anim 0.500000 vertex -1 -1
+material
+frame
+texture 1.0 0.500000 material 1.0
+1.0 1.0 bone anim bone
+=
+1.0 1.0 1.0 vertex
+bone 0.500000 material 1.0 material =
+0.500000 bone = bone bone texture 0.500000
+vertex 1.0 material texture = 0.500000 anim 0.500000 -1 0.500000 1.0 anim 0.500000 material
+material texture anim =
+material texture material = texture material frame anim vertex
+= bone
+texture 1.0
+-1
+anim bone anim texture anim = =
+material =
+bone vertex material -1 frame = = 0.500000 0.500000 material texture 1.0 anim texture material frame material bone 1.0 anim
+1.0 -1 texture = vertex 1.0
+anim
+= frame vertex frame
+0.500000 =
+anim bone -1 frame 0.500000 -1
+bone = = 1.0 frame texture = anim anim
+0.500000 material
+frame
+-1
+material vertex
+frame
+0.500000
+1.0 bone
+bone 1.0
+anim 1.0 1.0
+vertex frame 0.500000 material material frame frame texture
+bone bone material
+bone
+-1 1.0
+1.0
+1.0 anim
+vertex material = = frame 1.0
+1.0 anim = anim material
+-1 texture -1
+0.500000 frame vertex 1.0
+bone anim vertex texture anim 0.500000 -1 -1 material frame
+1.0 anim
+0.500000 texture bone
+-1 = texture bone material
+vertex
+vertex texture anim
+frame bone
+0.500000 anim 0.500000 1.0
+0.500000 0.500000 1.0 1.0
+frame 1.0
+1.0
+0.500000 -1 1.0 bone -1 bone anim
+1.0 = texture frame frame 0.500000 texture vertex 1.0 bone
+= texture anim 0.500000 1.0 texture -1 = vertex
+anim = frame frame anim
+frame = texture =
+1.0 bone = 0.500000 texture material -1 bone texture
+= frame 1.0 anim vertex -1 1.0 anim material
+0.500000 = texture
+vertex = -1 frame
+1.0 bone material 1.0 1.0 material material vertex 1.0
+-1 texture material material
+-1 bone
+frame
+frame vertex material material 1.0 frame
+material -1
+=
+material anim
+anim -1 bone -1 material frame frame
+texture frame
+anim anim vertex -1 1.0 frame 0.500000 -1
+-1 -1 -1
+frame bone =
+-1 0.500000 1.0
+frame
+0.500000
+=
+= -1
+-1 vertex anim -1 texture
+vertex vertex bone -1 bone
+anim vertex texture frame 1.0
+=
+anim -1
+texture anim
+material
+1.0 bone =
+1.0 frame 1.0 =
+= 0.500000
+1.0 bone -1 -1 vertex
+0.500000 material = vertex
+0.500000 material vertex 0.500000 -1 0.500000 anim bone 0.500000 -1 0.500000
+-1 vertex frame material 1.0 = texture 0.500000 texture vertex
+frame frame vertex frame anim 0.500000 material -1 1.0
+vertex
+1.0 frame bone
+anim =
+vertex = = -1 frame bone vertex 0.500000 bone 1.0 bone 0.500000 0.500000 material
+0.500000
+0.500000 =
+texture texture texture bone = -1 anim = vertex vertex
+1.0 material 1.0 bone 0.500000 1.0 anim material 0.500000 bone
+0.500000 frame anim
+vertex anim material
+-1 1.0 -1 -1 =
+material 0.500000 = bone vertex
+= vertex -1 anim frame anim 1.0 vertex 1.0 1.0
+0.500000 vertex -1
+1.0 material vertex
+frame vertex
+-1 frame
+texture 1.0 material 0.500000 texture vertex material
+frame bone vertex 0.500000 texture 0.500000 bone anim material bone 0.500000 0.500000 frame material bone = vertex -1 bone frame frame anim frame frame
+anim 0.500000 1.0
+-1 0.500000 bone =
+vertex 1.0 0.500000 0.500000 texture bone
+0.500000
+material bone material 1.0 anim = = vertex =
+bone bone
+= material bone frame vertex bone = -1 material frame
+frame
+frame = 1.0 1.0 material
+vertex frame -1
+0.500000 texture frame 0.500000 -1
+= 1.0 -1 vertex
+vertex vertex 0.500000 vertex material
+frame texture 0.500000
+-1
+anim vertex anim anim
+material texture
+vertex bone 1.0 =
+-1 -1
+vertex material 0.5
\ No newline at end of file
@@ -0,0 +1,7 @@
+vertex
+anim anim =
+bone = frame -1 bone texture anim
+anim anim
+1.0
+vertex frame anim 1.0
+0.500000 anim
\ No newline at end of file
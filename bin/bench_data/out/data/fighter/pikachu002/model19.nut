@@ -0,0 +1,142 @@
+bone texture anim bone 0.500000 0.500000 -1 =
+material vertex bone vertex -1 texture vertex frame
+0.500000 0.500000
+= 0.500000
+vertex anim texture frame bone -1
+1.0 = material texture
+= bone bone
+vertex material texture frame texture material bone material
+bone -1 bone
+1.0
+-1
+= 0.500000 0.500000 anim = anim 0.500000 1.0 anim texture frame -1 material 0.500000 1.0 anim -1 -1 -1
+anim texture bone = vertex frame 0.500000 1.0 vertex bone texture material = 0.500000
+anim texture texture
+frame bone
+material
+anim
+material material bone
+1.0
+texture texture material
+0.500000 anim 1.0 anim texture =
+= frame
+material 0.500000 -1
+1.0
+=
+texture -1 = =
+0.500000 -1
+1.0 vertex
+vertex frame texture frame vertex bone
+anim bone material bone frame texture 1.0
+bone = 0.500000
+anim
+1.0
+vertex = = vertex material material 0.500000 -1 anim anim anim material -1
+1.0 frame material
+1.0 material vertex
+vertex 1.0 bone bone 0.500000 bone
+frame anim texture
+bone 1.0 vertex texture anim frame 0.500000 1.0
+bone frame anim 0.500000 anim
+frame = bone frame
+= 1.0
+frame frame 0.500000 texture texture material material
+frame vertex
+vertex texture 1.0
+bone bone
+0.500000 = = vertex
+vertex material texture
+anim 0.500000 -1 -1 -1
+texture
+texture vertex 1.0 anim bone 0.500000 frame 0.500000 1.0 anim -1
+anim frame anim 0.500000
+vertex
+anim 1.0 texture anim
+anim
+-1 texture -1 =
+frame bone frame 0.500000 texture
+vertex anim 1.0 anim
+frame vertex = texture 0.500000 1.0 -1 0.500000
+frame
+= frame anim texture 1.0
+0.500000 material
+0.500000 bone 0.500000 bone
+0.500000 texture -1 frame texture bone anim
+material 1.0 frame frame texture bone material 0.500000 0.500000 -1
+0.500000 anim frame frame
+-1 1.0
+0.500000 = material anim 0.500000 bone -1 vertex
+-1 = -1 -1 anim bone vertex vertex 0.500000 anim 1.0 material 1.0 anim =
+material -1
+= frame vertex anim = texture
+anim material
+-1 0.500000 material
+0.500000 =
+vertex bone
+0.500000 frame frame
+0.500000 anim vertex 1.0 frame 0.500000 vertex =
+material = material material bone
+texture anim frame material
+= -1 bone texture 1.0
+frame bone
+frame frame anim material
+texture
+texture material
+material frame bone anim frame anim vertex
+-1
+1.0 material frame 1.0
+vertex
+bone material vertex 1.0 = frame -1
+texture frame frame 0.500000 =
+anim
+-1 anim 0.500000 = material
+vertex
+material anim
+bone vertex 0.500000 texture 1.0 bone anim
+frame material bone
+0.500000 vertex 1.0
+0.500000 anim 1.0
+texture -1 0.500000 anim texture anim bone bone material
+bone
+1.0 vertex vertex 1.0 material 0.500000 texture vertex bone 0.500000
+= 0.500000
+-1 = material material bone texture material 1.0 bone frame
+vertex
+0.500000 1.0 bone 0.500000 -1 -1
+anim 1.0 -1
+-1
+vertex
+-1
+bone
+0.500000 1.0 0.500000 texture 1.0 0.500000 frame material vertex = texture
+vertex
+-1 = 0.500000
+material 1.0 texture vertex anim
+bone vertex vertex 1.0 = anim 0.500000
+0.500000 vertex texture
+material bone
+0.500000 texture 1.0 -1
+-1
+material 1.0
+frame 0.500000 anim -1 anim 0.500000 bone -1 bone texture
+material
+anim
+vertex anim 1.0 bone vertex
+bone material bone anim 0.500000 material
+= 0.500000 = 0.500000 vertex vertex = -1 0.500000
+1.0 1.0 material frame
+frame material
+bone material 0.500000 anim texture = frame
+frame
+-1 -1 frame
+0.500000 frame anim frame 0.500000 frame =
+bone =
+material material 0.500000 = texture
+anim material vertex
+anim texture frame
+vertex
+= vertex bone 1.0 =
+-1 bone 1.0
+frame
+anim
+1.0 vertex
\ No newline at end of file
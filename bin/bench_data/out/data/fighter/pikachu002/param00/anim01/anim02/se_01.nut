@@ -0,0 +1,11 @@
+1.0
+= frame 1.0 0.500000
+vertex bone 1.0 material
+0.500000
+-1 bone
+-1
+frame bone frame 1.0 material -1 vertex frame texture 1.0
+bone material = anim
+1.0
+0.500000 1.0 texture = 1.0 vertex = = vertex =
+= verte
\ No newline at end of file
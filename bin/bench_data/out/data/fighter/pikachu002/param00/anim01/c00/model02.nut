@@ -0,0 +1,3 @@
+1.0
+material 0.500000
+= = = material
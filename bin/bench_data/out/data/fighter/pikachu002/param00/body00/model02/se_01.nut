@@ -0,0 +1,160 @@
+bone frame frame
+-1 bone = -1 1.0 bone
+texture 0.500000
+anim
+bone frame
+-1 -1 = bone anim -1 texture
+0.500000
+1.0
+bone
+material frame vertex -1 bone
+frame material -1 0.500000
+0.500000
+material 1.0 0.500000 anim
+anim vertex frame
+1.0 = 1.0 frame material anim texture anim
+vertex material 1.0
+0.500000
+texture = 0.500000
+vertex -1 =
+bone frame
+bone
+bone -1 vertex anim anim frame -1 bone bone
+frame
+1.0 bone -1 vertex 1.0 material anim
+vertex bone -1 texture texture
+anim anim
+vertex
+0.500000 = texture =
+bone
+bone
+bone = 0.500000 =
+anim material
+bone frame
+texture = -1 -1 bone 1.0 vertex
+= 1.0 frame anim = 1.0 1.0 texture
+anim
+vertex
+-1 texture vertex frame material = material
+material
+= anim 0.500000 0.500000 vertex 0.500000 frame 1.0
+=
+frame texture
+material bone = vertex =
+1.0 = anim -1 anim -1 0.500000 texture -1
+frame anim
+frame material
+frame vertex texture
+1.0 vertex
+texture -1 =
+= material texture texture
+1.0
+vertex frame
+frame
+-1 0.500000 vertex 1.0 1.0 0.500000 material texture bone -1 bone
+-1 anim
+vertex 1.0 1.0
+frame
+vertex -1 -1 anim texture = anim
+texture -1
+material
+bone vertex 1.0
+anim =
+texture bone anim -1 -1 0.500000 anim frame frame bone
+frame -1
+1.0 =
+frame
+material = =
+texture bone 1.0 vertex 0.500000 texture
+anim 1.0 anim vertex texture vertex
+frame 0.500000 frame
+anim frame texture
+0.500000 anim -1 0.500000 -1 anim bone
+anim = material = bone
+texture 0.500000 material -1
+bone 0.500000 material = material texture -1 1.0 texture anim vertex
+0.500000 0.500000 1.0 vertex bone -1
+0.500000 bone texture
+1.0 bone 0.500000 1.0 material frame
+= texture material
+= material -1 -1
+frame anim frame -1 -1 texture
+texture texture 1.0 -1 -1 0.500000 vertex texture material texture frame = -1 anim -1 = 0.500000 bone texture
+vertex bone vertex anim frame vertex =
+= frame anim bone = frame bone = -1
+-1 1.0
+frame
+material texture vertex -1 anim bone 0.500000
+frame =
+1.0 1.0 material 1.0 anim
+frame = texture = 0.500000 -1 bone = frame =
+0.500000 material bone texture anim bone 0.500000 texture
+1.0 texture
+vertex bone vertex material bone
+material
+frame 0.500000 0.500000 anim =
+vertex texture bone
+texture bone texture 0.500000 0.500000 1.0 material bone
+= 0.500000 material material 1.0 1.0 material 0.500000 frame anim anim texture
+0.500000 vertex = vertex
+=
+1.0 1.0 material
+texture
+-1 frame 1.0 frame anim vertex = 0.500000 anim 0.500000 vertex anim material texture
+bone anim =
+bone anim anim -1 bone vertex bone frame anim anim 0.500000 frame -1 texture -1 0.500000 = frame anim frame vertex
+1.0 texture anim
+bone frame -1 frame
+1.0 = vertex
+anim material = 1.0 anim vertex
+texture frame
+anim anim anim
+0.500000 texture texture
+bone 0.500000
+vertex = 0.500000 texture vertex
+= -1 1.0 0.500000
+bone texture = 1.0 frame
+-1 0.500000 texture bone bone frame
+material 0.500000 0.500000
+texture = 1.0 texture bone anim texture 1.0 1.0 frame material texture 0.500000
+material material anim = 0.500000 material
+bone =
+anim
+= -1
+bone texture
+frame 1.0 anim vertex
+-1 material
+0.500000 vertex frame vertex texture = vertex material vertex vertex anim bone 0.500000
+0.500000
+= bone bone
+0.500000 material frame
+= 1.0
+texture frame 0.500000 -1 frame bone 0.500000 1.0 0.500000
+frame
+-1 bone
+bone -1 frame
+frame
+vertex texture frame vertex anim
+0.500000 -1 =
+-1
+bone -1
+vertex 1.0
+anim
+anim -1 1.0 bone bone bone texture 0.500000 material vertex
+= 0.500000 anim vertex 1.0 material bone anim frame anim
+-1 1.0
+0.500000 material anim
+0.500000 -1 frame 0.500000 frame = material
+= frame frame -1
+frame vertex material material = texture
+= material
+bone 0.500000
+anim anim texture
+frame bone -1 material texture frame frame 0.500000 frame vertex 0.500000 bone -1 = material vertex vertex vertex 1.0 vertex 0.500000
+0.500000 frame bone anim = texture bone anim anim =
+anim frame
+1.0 texture 1.0
+-1 material -1 vertex
+0.500000
+= texture
+vertex bo
\ No newline at end of file
@@ -0,0 +1,353 @@
+material =
+vertex
+= anim anim material bone
+= = = vertex material 1.0 frame
+bone texture vertex texture frame bone material = frame
+texture texture material
+bone -1 material anim
+vertex -1 vertex
+bone vertex 0.500000
+1.0 -1 = vertex 0.500000 frame
+=
+anim bone = anim
+-1 frame
+texture
+bone
+1.0 =
+texture -1 0.500000 material frame 1.0 = -1 bone bone anim texture bone frame vertex
+=
+1.0 frame frame frame vertex -1 -1 material bone texture =
+texture
+= -1
+vertex
+material
+1.0
+material
+-1
+1.0 vertex 0.500000 -1 -1 0.500000 vertex bone 0.500000
+anim = 1.0
+0.500000 anim
+-1 = bone texture anim
+texture material
+frame = anim texture
+-1 -1 1.0 material
+texture
+vertex
+anim material 0.500000
+= = vertex
+bone texture anim anim texture material anim 1.0 vertex 1.0 texture anim 1.0 -1 anim 1.0 vertex 0.500000
+-1 texture texture material anim = 1.0 texture material -1
+= = texture texture bone material texture
+frame
+material
+= = vertex
+1.0 vertex
+frame
+material bone material -1 bone material bone
+1.0 = texture
+-1 = texture
+-1 texture 1.0 0.500000 0.500000 anim
+vertex anim vertex frame 0.500000 -1 anim
+bone bone
+1.0
+= frame bone material
+material bone frame -1 =
+anim = frame
+texture
+1.0 -1 = 1.0 vertex
+material
+0.500000 anim anim
+0.500000
+vertex 0.500000 frame frame anim texture texture material
+anim anim bone
+texture 0.500000 texture
+-1 = bone 0.500000 vertex texture
+texture bone
+=
+0.500000 vertex texture = texture 1.0 vertex
+bone frame -1 vertex bone texture 0.500000 texture
+-1 vertex
+texture
+=
+frame frame anim anim
+0.500000 -1 = vertex
+material frame 1.0 material
+-1
+bone 1.0 material 0.500000 frame
+= texture
+anim anim =
+texture
+texture texture
+frame anim 0.500000 -1
+frame = = 1.0 -1
+bone vertex vertex bone 0.500000 0.500000
+=
+1.0 frame vertex =
+-1
+1.0 -1 vertex vertex anim frame = 0.500000 vertex
+texture texture anim
+anim
+vertex 1.0 0.500000 anim material frame texture
+= -1 frame 1.0 1.0 material frame 1.0
+material bone anim material = 1.0 1.0
+vertex frame 1.0 bone frame frame frame
+=
+1.0 frame
+frame -1 anim anim
+-1
+= vertex
+=
+frame
+=
+= = = -1 vertex frame
+= anim
+0.500000 frame anim texture anim
+anim = 0.500000 =
+material frame material
+texture anim
+texture anim
+anim
+vertex
+bone bone -1
+0.500000 texture bone
+-1 texture
+bone
+texture -1 texture
+vertex texture = -1 anim 0.500000 1.0 texture vertex
+anim texture bone
+anim bone =
+-1 1.0 material anim
+1.0 -1 texture
+1.0 -1 texture frame
+-1 -1 material 0.500000 texture = vertex texture texture texture anim = texture anim = 1.0 frame
+= frame = anim 1.0
+texture vertex -1 material
+frame vertex frame = material frame
+material -1 0.500000
+frame 1.0
+1.0 bone frame =
+-1
+texture anim vertex = 1.0
+1.0 1.0 0.500000 material 0.500000 anim 1.0 frame texture
+anim
+texture =
+texture -1 bone 1.0 vertex 1.0 -1 anim = texture vertex anim anim 0.500000 texture
+0.500000 bone vertex
+= 0.500000 anim vertex -1 bone anim vertex bone -1 texture
+1.0 anim texture
+vertex bone -1 anim vertex
+1.0
+frame texture anim 1.0 1.0
+bone texture material
+vertex
+material 1.0 frame vertex material
+anim
+vertex bone material -1 -1
+anim texture material bone anim 0.500000 vertex texture -1 =
+-1 1.0
+texture -1
+=
+0.500000
+1.0 material 0.500000 1.0
+1.0
+frame 0.500000
+frame
+anim = material
+material vertex material 1.0 -1 1.0 frame anim -1
+bone anim = frame
+0.500000 0.500000 anim material material =
+= = -1
+vertex
+texture 1.0
+= frame vertex bone texture -1 = -1 frame
+-1
+material frame vertex 0.500000 anim frame -1 frame vertex
+material 0.500000 0.500000
+-1 vertex vertex texture 0.500000
+1.0
+= -1
+material -1 1.0 = anim 1.0 material material
+-1
+0.500000 0.500000 frame
+vertex frame anim 1.0 1.0 1.0
+0.500000 bone
+0.500000 vertex -1 anim 1.0 0.500000 1.0 texture
+texture bone 1.0 texture
+-1
+texture
+frame texture bone 1.0 frame 1.0 frame texture frame
+frame
+bone anim -1 = vertex vertex bone vertex
+-1
+=
+0.500000
+material 1.0 -1 vertex vertex 1.0 texture
+= material 0.500000
+texture
+bone texture bone frame anim material
+vertex material texture
+bone material frame
+anim 0.500000 bone vertex bone vertex 1.0 vertex
+bone -1 0.500000 -1
+anim anim 0.500000 vertex
+texture
+vertex anim bone
+material
+1.0
+= = material 0.500000 0.500000 anim texture
+vertex
+0.500000
+= texture
+material anim 1.0 0.500000 vertex = material bone 0.500000 0.500000
+vertex -1 frame 1.0
+bone material material 0.500000 frame
+0.500000
+0.500000 bone
+material -1 material
+frame anim texture -1 texture
+vertex texture bone bone =
+vertex frame vertex frame 0.500000 vertex 0.500000
+0.500000 frame material material frame texture vertex 1.0 material anim 0.500000 = -1 frame 0.500000 = texture 1.0 material 1.0 0.500000
+-1 bone -1 texture 0.500000 bone vertex bone 0.500000 material
+0.500000 vertex material -1
+bone anim anim texture bone anim frame
+= 1.0 anim
+-1 anim
+vertex 0.500000
+= frame bone vertex -1 1.0 texture 0.500000 texture
+texture frame 0.500000 anim anim frame = 1.0 frame
+anim
+= anim = -1
+vertex
+texture
+anim -1 frame vertex vertex
+1.0 0.500000 anim
+0.500000 0.500000 -1 anim =
+frame vertex anim -1
+-1 0.500000 anim anim texture bone 1.0 vertex frame
+texture 1.0 =
+=
+1.0 vertex
+material = 0.500000 material anim
+-1 frame -1
+material 0.500000
+-1 texture
+anim bone frame 1.0 0.500000 1.0 = material material vertex vertex 1.0 vertex bone
+-1
+frame texture material -1 = = texture bone
+anim
+vertex texture bone
+0.500000 bone -1 bone
+-1 -1 1.0 -1 vertex
+bone texture anim 1.0 = -1 anim = 1.0 =
+anim vertex texture 0.500000 0.500000 1.0 1.0 frame -1 0.500000 bone material
+0.500000 frame = 1.0 1.0 0.500000 anim
+material
+frame 0.500000 -1 anim -1 bone material
+= -1 -1 bone texture anim
+texture = vertex
+-1
+-1 0.500000 0.500000 bone =
+0.500000 =
+anim 1.0 1.0
+-1 1.0 bone vertex
+texture
+vertex 1.0 frame 1.0 texture texture frame frame vertex
+texture
+anim
+bone = texture = -1
+anim = 1.0 = bone
+bone material
+0.500000 anim
+frame vertex anim 0.500000 material vertex
+vertex anim material
+0.500000 texture 0.500000
+material bone material frame frame bone -1 bone anim vertex anim = 1.0 frame vertex -1 0.500000
+material
+-1 = 1.0 frame -1 vertex 0.500000
+-1
+material texture = 0.500000 vertex -1
+bone frame 1.0 0.500000
+frame vertex = bone material frame
+material material texture frame
+-1 =
+material bone texture 1.0 -1
+anim 0.500000 1.0 -1 vertex material
+0.500000 bone material texture =
+frame 1.0 = texture material frame 1.0 frame bone
+frame anim
+1.0 material =
+texture
+1.0 texture
+bone 1.0 0.500000 1.0 vertex texture
+bone material
+frame 1.0 texture 0.500000 bone bone texture material -1 1.0
+= -1 0.500000
+texture anim -1
+bone bone bone material 0.500000
+-1 material texture 0.500000 material frame
+frame
+frame anim = 0.500000 frame vertex anim
+anim = 0.500000 anim
+0.500000 =
+bone 0.500000
+= -1 frame bone = anim frame texture
+frame
+vertex -1
+0.500000
+0.500000 =
+anim vertex material bone
+=
+vertex
+-1 -1 0.500000 texture 1.0
+frame frame = -1 anim
+anim frame texture
+= -1
+material
+0.500000 = frame = 0.500000 anim bone vertex texture -1 texture 0.500000
+0.500000 texture vertex anim
+-1 material frame =
+1.0 texture frame bone material
+0.500000 -1 bone vertex bone -1 vertex = -1
+frame
+=
+vertex frame bone material
+= 0.500000 =
+= 1.0 1.0 frame bone
+0.500000
+texture bone vertex
+anim vertex bone frame -1 bone
+= 0.500000 vertex -1
+=
+bone anim
+= 0.500000 = texture
+vertex texture 1.0
+anim
+anim -1
+texture 0.500000 -1
+-1 0.500000 bone 0.500000 texture 1.0 bone frame texture -1
+material anim
+texture
+-1 = texture vertex
+-1 -1 1.0 anim 0.500000 0.500000 texture = texture 0.500000 frame 0.500000
+1.0 bone = vertex
+bone
+1.0 material 1.0 anim 1.0 1.0 frame
+vertex 0.500000
+-1
+texture 0.500000
+anim material 0.500000 material bone vertex 1.0 -1 1.0 = 1.0 vertex
+1.0 -1 texture
+bone
+1.0 bone 1.0
+-1
+anim frame = texture
+-1 bone texture 0.500000
+=
+texture vertex anim frame
+=
+-1 -1 bone
+anim
+material
+anim 1.0 -1
+bone -1 anim = -1 0.50
\ No newline at end of file
@@ -0,0 +1,252 @@
+texture bone -1 texture frame 1.0 1.0 0.500000 frame material frame texture
+1.0 -1 material bone
+1.0
+vertex 0.500000
+vertex material
+anim 0.500000
+bone
+vertex
+bone 1.0 bone
+0.500000 -1 texture = texture anim bone =
+bone 0.500000
+material
+= = 1.0 = texture texture 0.500000 1.0 frame frame
+bone
+-1
+frame anim texture
+texture frame = material
+anim frame frame 0.500000 bone
+anim texture -1 -1 =
+vertex
+frame
+1.0
+material 1.0 -1 0.500000 vertex vertex
+material bone anim 0.500000 0.500000 1.0 vertex bone = 0.500000
+texture frame texture vertex -1 -1 anim anim -1 vertex
+bone 0.500000
+= -1 material
+vertex -1 texture
+0.500000 anim texture
+vertex -1 anim material
+bone
+= material
+1.0 texture
+anim anim texture
+1.0
+0.500000
+frame 0.500000
+material vertex material
+frame
+frame anim vertex = material 0.500000 material texture texture
+0.500000 vertex
+texture vertex texture
+bone frame
+anim
+-1 frame
+=
+bone anim =
+material
+0.500000
+frame vertex -1 1.0 texture
+material material material material
+-1
+1.0 1.0 = 1.0 = = 1.0
+bone vertex bone 0.500000 = anim 0.500000
+1.0
+frame frame texture vertex texture
+anim
+frame bone frame -1 frame = -1 bone bone vertex 0.500000
+0.500000 1.0 vertex material
+anim
+0.500000 bone
+-1
+=
+vertex 1.0 texture
+anim
+bone
+1.0 material vertex vertex texture
+material vertex material texture =
+0.500000 bone anim vertex 1.0 material
+frame 1.0
+frame 0.500000 material material material 1.0 1.0 bone 0.500000 1.0 anim
+bone material
+1.0 bone frame 1.0
+material bone bone bone vertex -1 bone vertex vertex
+= anim 1.0
+0.500000 vertex vertex 0.500000 texture
+bone
+-1 anim -1
+1.0 -1 texture bone
+texture frame frame = vertex material
+anim 1.0 anim frame vertex
+anim bone 1.0 =
+material 1.0 vertex
+= texture 0.500000 0.500000 -1 0.500000 bone 0.500000 material -1
+vertex bone bone =
+-1 anim 0.500000 0.500000 0.500000
+0.500000 -1 1.0 anim material -1 bone material = 1.0
+frame
+0.500000 vertex 1.0
+0.500000 material 1.0 vertex
+frame
+vertex frame -1 -1 texture bone -1 frame
+-1
+material =
+0.500000
+material 1.0
+anim material anim anim texture bone vertex -1 anim vertex anim
+1.0 0.500000 anim = -1 anim frame texture
+frame bone 1.0 texture 0.500000 frame
+1.0 texture 1.0 anim vertex frame 0.500000 anim
+anim -1 anim 1.0 frame material 1.0 material bone -1 material
+material 0.500000 anim = frame
+anim frame anim 1.0 0.500000 1.0 -1 0.500000
+bone vertex = 1.0 frame frame anim -1 frame
+vertex anim material -1 vertex
+bone
+= vertex material vertex anim
+= -1
+anim texture 0.500000 anim
+vertex 1.0 -1 texture frame
+-1 frame -1 texture vertex
+bone vertex 0.500000 vertex
+vertex material
+frame
+texture bone
+texture vertex material bone 1.0 frame 0.500000
+material 1.0 frame
+vertex frame texture = frame 0.500000 anim anim 0.500000
+= texture 1.0 1.0
+1.0
+anim
+texture = frame -1 anim 1.0 bone frame =
+anim texture bone 1.0 material -1
+vertex anim
+material vertex = bone texture
+material
+vertex 1.0 frame
+0.500000 vertex -1 material bone
+-1
+vertex
+0.500000 vertex anim
+bone texture = 0.500000 texture bone = vertex -1 anim material frame =
+vertex
+frame frame
+1.0 vertex
+material anim 1.0 frame frame material texture anim bone 0.500000 texture 1.0 texture
+= 0.500000 -1 texture texture texture
+1.0 texture 0.500000 -1 material texture bone anim -1 bone frame =
+1.0 0.500000 frame -1 vertex
+texture bone anim
+anim material
+texture material 1.0 1.0 = 1.0
+frame =
+-1 anim
+0.500000 frame vertex 1.0 = 0.500000 anim material
+vertex bone
+material
+-1 1.0 -1 frame
+vertex vertex
+vertex -1 -1 frame -1
+texture frame vertex
+bone
+bone frame
+=
+1.0
+anim = anim
+material 0.500000
+vertex 1.0 =
+1.0 0.500000 frame frame frame
+vertex anim vertex texture 0.500000 frame 0.500000 bone
+-1 bone vertex =
+vertex material =
+texture frame bone 1.0 vertex vertex material 0.500000
+-1
+1.0 bone bone anim 0.500000 material
+vertex = frame bone material vertex = 0.500000 anim
+material vertex vertex -1
+= -1
+frame material 0.500000
+= =
+0.500000 bone 0.500000
+vertex bone
+-1 frame
+vertex frame = = material
+frame 0.500000
+1.0 frame -1 =
+= bone anim
+-1
+bone texture 1.0 vertex
+bone material vertex anim bone vertex
+frame
+anim anim vertex bone -1 vertex frame -1 vertex vertex -1 texture
+bone anim anim bone frame -1 1.0
+texture anim 0.500000 material = -1 vertex vertex 1.0
+texture vertex =
+= 0.500000 frame
+anim
+-1 vertex
+anim -1 material frame 1.0
+frame 1.0
+= vertex frame anim bone texture anim frame frame texture frame
+frame 0.500000 -1 bone
+0.500000 frame texture
+-1 anim material anim anim
+bone
+bone -1 1.0 -1 vertex
+-1 anim
+material = vertex
+material vertex texture
+material anim bone 0.500000
+vertex
+-1
+0.500000 vertex -1 frame
+= frame bone material = bone = texture material 1.0 -1
+texture 0.500000 frame 1.0 = = 1.0 bone
+-1 anim -1 0.500000 -1
+material bone 0.500000 texture material
+anim frame texture frame frame
+1.0 1.0
+anim
+bone
+1.0 -1 material
+texture 1.0 = -1 material = frame
+1.0
+= 1.0 -1 = texture
+texture
+1.0
+0.500000 vertex texture
+-1 bone
+= -1
+bone = 0.500000 -1
+bone vertex vertex bone texture
+vertex anim material 1.0 anim 1.0 anim
+anim
+-1 frame = material frame texture
+vertex
+material 0.500000 vertex -1 material
+bone -1 1.0 -1 material
+material
+material
+=
+anim 0.500000 material -1 bone vertex material
+texture vertex 1.0 1.0
+bone vertex
+= texture texture
+texture material = 0.500000 anim
+vertex material texture = 0.500000 0.500000 material material anim material 0.500000 vertex
+0.500000 texture -1 =
+bone =
+texture texture
+vertex vertex
+= texture texture frame
+anim 1.0 anim = texture
+material
+1.0 = vertex anim = anim frame anim frame -1 material
+-1
+=
+material -1 0.500000 -1 = anim anim 1.0
+-1
+= anim texture bone
+bone
+anim texture 
\ No newline at end of file
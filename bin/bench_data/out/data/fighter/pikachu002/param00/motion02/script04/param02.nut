@@ -0,0 +1,8 @@
+anim = bone frame bone -1
+vertex 0.500000 =
+1.0 bone =
+anim
+bone 0.500000 -1 frame material material 1.0 vertex anim 0.500000
+-1 anim bone 0.500000 anim frame 1.0 bone material =
+bone 0.500000 texture
+= material 0.500000 0.500000 frame
\ No newline at end of file
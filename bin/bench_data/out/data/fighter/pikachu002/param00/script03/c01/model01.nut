@@ -0,0 +1,389 @@
+-1 = texture anim -1 anim anim bone -1
+1.0 1.0
+anim texture 0.500000 -1 anim frame 0.500000
+anim
+vertex texture
+texture
+anim material
+1.0
+= 0.500000 frame
+-1 0.500000 texture texture -1 anim
+texture 0.500000 vertex
+bone vertex
+1.0 0.500000 anim
+= frame -1 anim -1 vertex texture -1 bone
+-1
+texture -1
+bone -1 -1 texture frame vertex frame
+material bone frame frame -1 -1 1.0 = frame texture texture material
+frame frame anim 0.500000 1.0 material
+bone
+anim bone bone = -1
+texture
+material 0.500000 anim -1 texture vertex material 1.0 bone
+bone frame
+anim
+vertex -1 frame = texture bone
+vertex
+vertex frame vertex anim anim 0.500000 1.0 0.500000 frame anim
+frame
+bone 0.500000 material
+material frame -1
+=
+anim =
+1.0 anim frame -1
+texture -1 0.500000
+= anim vertex vertex 0.500000
+= -1
+vertex texture texture bone = bone 0.500000 vertex texture
+vertex
+bone
+=
+frame bone
+= frame
+anim = material = texture anim
+1.0 =
+= -1 texture vertex anim
+1.0 0.500000
+bone -1 material
+0.500000 -1 material -1 texture
+0.500000 anim texture anim
+anim
+= anim texture 1.0
+texture
+=
+=
+texture 1.0 bone anim
+vertex frame -1
+0.500000
+material bone
+texture -1 bone
+-1 0.500000
+anim
+1.0 frame 0.500000 vertex -1
+anim material =
+-1 -1 = material bone
+0.500000 texture texture anim = 1.0
+material = 1.0
+-1
+-1 0.500000 vertex vertex = -1 anim
+bone 0.500000 bone frame
+0.500000 1.0 -1 bone
+bone
+1.0 = anim bone bone material vertex
+texture
+texture
+material
+vertex vertex vertex vertex frame bone
+texture material material
+material 0.500000 = 0.500000 texture
+-1 anim anim vertex
+vertex anim 0.500000 bone -1
+texture -1 vertex -1
+material vertex frame
+vertex anim
+-1 -1
+= 0.500000 = -1
+-1 -1 anim frame bone material
+texture -1 texture
+vertex 0.500000
+texture = = frame 1.0 =
+frame
+frame anim
+anim 0.500000 anim frame
+bone
+=
+-1 vertex material -1 = frame material frame
+anim 0.500000 material anim -1 = 1.0 0.500000
+material
+material texture frame anim =
+anim vertex anim material -1 material
+-1 = 1.0 vertex
+frame = 1.0
+texture 0.500000 vertex
+material -1 anim anim 1.0
+bone material
+1.0
+bone anim texture -1 frame
+1.0 1.0 frame anim anim 1.0 material
+anim bone
+vertex
+texture texture anim material texture anim vertex material
+texture -1
+texture
+vertex -1 -1 vertex frame -1 = 1.0 anim
+bone vertex texture
+material -1
+bone
+1.0 material 1.0 -1 material = 0.500000
+anim
+bone vertex
+bone anim = -1 =
+-1 = material frame 0.500000 vertex
+anim anim
+0.500000 texture
+texture 1.0 bone 1.0 anim frame -1
+frame -1 =
+-1
+= 1.0
+-1
+= -1 frame texture 1.0 0.500000
+vertex vertex material 0.500000 0.500000 material 1.0 bone texture vertex texture frame texture frame 1.0 -1 -1 frame
+frame bone frame frame
+-1 1.0 material material 0.500000 anim bone anim
+= anim
+-1 0.500000 bone 1.0 material vertex
+material 1.0 frame
+0.500000 vertex 0.500000 vertex -1 -1
+-1 frame
+-1 bone material
+0.500000 vertex 0.500000
+=
+1.0 material 1.0
+vertex 1.0
+anim frame
+1.0 -1
+1.0 -1 1.0
+1.0
+vertex anim 0.500000 -1 1.0
+frame texture material bone anim vertex = material
+material frame
+texture = -1 -1 frame
+frame 0.500000
+-1
+vertex vertex bone -1
+= anim 1.0 texture frame
+bone anim
+= 0.500000 texture vertex -1 texture vertex material bone
+frame texture
+0.500000 = 1.0 material
+anim
+= material bone vertex
+= anim -1 = = material =
+frame vertex
+texture 0.500000 vertex 0.500000 anim vertex anim
+texture -1 0.500000
+frame =
+1.0 texture
+bone material
+1.0 texture vertex bone frame 0.500000 -1 bone 0.500000 texture bone anim
+material
+1.0
+bone
+frame material
+anim 0.500000 anim
+0.500000
+0.500000 1.0 frame = frame 0.500000 anim
+0.500000
+1.0 anim frame 0.500000 vertex texture
+1.0
+material texture texture 0.500000
+1.0 frame bone frame
+= = frame anim material
+frame
+bone
+=
+bone 0.500000 texture =
+-1
+material 0.500000 frame = anim bone texture = bone
+frame frame = frame
+anim 0.500000 frame -1 1.0 -1
+0.500000 -1 -1
+material anim
+0.500000
+bone
+1.0
+1.0 bone
+texture
+bone
+bone vertex bone 1.0 vertex material 1.0
+0.500000
+frame
+=
+anim bone
+-1
+anim frame bone = bone
+frame
+1.0 texture bone
+= texture
+material frame 1.0
+vertex vertex 1.0 -1
+bone 1.0 anim vertex
+=
+material 1.0
+-1 texture frame
+0.500000
+1.0 vertex frame 1.0 1.0 bone anim
+1.0 vertex -1 vertex
+material = material material
+material bone material texture
+texture -1 texture =
+1.0 bone -1 texture -1 texture
+1.0
+frame bone 1.0 = 1.0 0.500000 0.500000
+0.500000 vertex
+material vertex 1.0 -1
+bone
+1.0 -1
+vertex 0.500000 -1 = 0.500000 0.500000 vertex texture
+texture
+-1 anim material
+1.0
+1.0 0.500000
+vertex = -1 material material = vertex
+-1
+-1 bone 1.0 bone -1 anim anim = material vertex vertex frame 1.0 vertex 1.0 texture
+texture 1.0 anim 0.500000 = 0.500000
+1.0 anim
+frame 1.0 = bone frame texture
+bone material anim bone anim vertex frame = material
+vertex texture texture bone 1.0 anim -1 texture texture -1
+frame frame 1.0
+anim -1
+bone bone
+-1
+-1 -1 texture
+material
+anim
+= -1
+-1
+= = anim 0.500000
+texture
+anim vertex texture frame material
+-1
+bone
+-1 1.0 bone
+frame 1.0 anim anim
+frame texture -1
+material -1 1.0 = vertex frame bone anim vertex
+frame = material 1.0 -1 0.500000 anim = 1.0
+1.0 = material 0.500000 bone material bone anim
+vertex
+material 1.0 = anim anim
+= material
+anim frame bone bone anim texture texture = -1 bone texture
+vertex vertex vertex texture bone texture anim
+0.500000 material material bone vertex
+anim anim 0.500000 frame
+=
+=
+-1
+= = bone
+0.500000 -1 =
+-1 frame -1
+frame -1 bone -1 1.0
+bone
+1.0 frame anim bone -1 bone material vertex texture material -1 vertex bone frame frame 1.0 anim
+-1 bone
+1.0 anim vertex 1.0 1.0 vertex
+texture = frame bone vertex bone = frame
+bone anim -1
+frame = -1
+frame
+= 1.0 material anim vertex
+vertex
+1.0 texture 0.500000 1.0 anim -1 bone 1.0 anim vertex
+vertex 0.500000 material anim texture frame bone texture
+bone texture
+frame frame bone
+vertex
+frame vertex bone bone bone vertex = 0.500000 texture frame
+anim -1
+frame anim material anim vertex material = frame material
+=
+frame -1 bone
+-1 vertex
+0.500000 = frame
+vertex texture =
+material = bone 0.500000 texture -1 =
+material bone frame
+0.500000 =
+anim
+anim
+= 1.0 anim material material
+frame
+0.500000
+frame -1
+texture frame -1 bone bone
+vertex
+anim texture
+0.500000
+frame
+material bone anim
+0.500000
+=
+vertex anim
+= material anim
+0.500000 material
+vertex 1.0 -1 1.0
+1.0 bone frame vertex texture
+material texture bone material vertex
+frame vertex =
+material
+-1
+bone vertex anim anim vertex texture bone
+1.0 = = bone -1
+-1 anim vertex material frame 1.0 anim
+material 1.0
+= anim -1 0.500000
+1.0 =
+=
+bone 0.500000
+texture 0.500000 =
+bone = -1 vertex
+1.0 anim bone vertex bone anim texture 1.0 0.500000 vertex texture vertex vertex -1
+vertex -1 frame
+frame vertex texture material -1 = =
+vertex anim bone
+texture
+anim bone bone vertex bone
+vertex bone bone frame =
+material vertex anim = = texture anim
+texture bone material frame anim texture
+bone material 1.0 -1 vertex texture vertex texture frame
+texture -1 frame
+material
+texture frame texture 1.0 anim
+vertex = =
+material 1.0 bone anim bone anim texture -1 anim -1 0.500000
+=
+bone 1.0
+0.500000 material bone
+-1
+frame = material anim 1.0
+texture anim material
+-1
+1.0 material vertex texture bone 0.500000 = texture vertex bone
+texture =
+-1 anim 0.500000
+0.500000 bone 0.500000 0.500000 vertex texture vertex -1 anim anim
+bone -1 material 0.500000
+texture
+texture =
+= material material material 1.0 bone
+0.500000
+vertex texture 0.500000 0.500000 material = 0.500000 -1 frame
+=
+-1 1.0 texture 0.500000
+bone
+frame texture = 0.500000 anim
+material texture frame
+bone
+texture 0.500000 anim texture = frame vertex frame 1.0 texture 0.500000 -1 vertex -1 anim
+texture = = -1 = frame texture = 0.500000
+= texture anim 1.0 frame =
+-1 bone = material =
+material
+bone material
+bone
+1.0 -1 0.500000 = frame texture material material
+-1 anim frame bone vertex
+material anim -1 vertex material
+material
+texture 1.0 anim = 0.500000 -1 = anim vertex anim = texture 0.500000
+material frame
+0.500000 material = anim anim
+1.0 -1 -1 texture
+frame = =
+material = -1
+0.500000 vertex anim vertex -1 material 0.500000 vertex frame
\ No newline at end of file
@@ -0,0 +1,6 @@
+2Ւw.Hߡ=ҡ:h8*?Ҍ͊͗O٨Zm$SE)}f|D 2	w)GD//CzºEk`8u;c@k<H^.>YSUr}Y[ƭ
+c޷@UIؗ޻e8י"0aYtAR/ tL5B=F~nM jÜ'demcikXFi~J?>aB~\i:ӏ6/V):lڜv͝`KřD+!?^H|XpNN\v!B"jv[Yj(O)S pPC7$Pp*	bh5>Z`p%(wyh<p%^[N aH7:&M5Tm9rv&JoCщEƼvݡrQ/L9cqrXZ]kK$$]K'Yb4߹w6TМ0-wJu/cbG.HSN,&)/ٍIF=@EÆEmwl3!`EDk%0O|jn%-k^m=$DtTc[ODZMTnE,h.Kz猄V?M>=g:;5p;)JcJ!
+på;,V߲Δ^G@B#mMx-V+Sm
+nYȃZ.C䱌^(/4 Sc39̕}ioM&>4v"!Ueq
+%nMsbj?
+m"^cD$uyp9#X	m("4r%,R	heh.X4
\ No newline at end of file
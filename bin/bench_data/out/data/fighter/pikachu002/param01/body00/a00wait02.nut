@@ -0,0 +1,13 @@
+-1
+-1 1.0
+-1 anim texture = bone
+0.500000 1.0 texture material
+vertex
+texture anim = material vertex bone frame material texture bone anim material material vertex
+anim = anim
+= 0.500000 =
+0.500000
+material vertex = frame frame material
+texture texture
+material
+-1 0.500000 anim anim 
\ No newline at end of file
@@ -0,0 +1,164 @@
+texture anim anim texture 0.500000
+bone 1.0 -1 anim vertex vertex frame 0.500000 anim 0.500000 = material bone
+anim 0.500000 anim vertex anim
+vertex 0.500000 1.0
+bone
+1.0 texture -1 vertex anim
+anim
+0.500000 vertex
+bone texture =
+texture 0.500000
+anim texture vertex bone -1
+-1 0.500000
+1.0
+frame -1 texture -1 1.0 0.500000
+texture vertex 1.0 vertex -1 0.500000 0.500000 material = texture -1 anim 1.0 material material = anim frame anim vertex
+1.0
+bone vertex = -1 1.0 bone frame 1.0 =
+material 1.0 texture bone
+texture = bone
+frame
+bone texture -1 0.500000 1.0 -1 =
+1.0 texture 0.500000 vertex 1.0
+anim anim anim 0.500000
+material
+1.0
+= anim texture
+material 0.500000 bone 0.500000 texture
+anim
+frame 0.500000 frame
+anim vertex 0.500000 = material -1 bone
+texture frame 0.500000
+frame material material bone texture
+bone =
+-1 vertex = 0.500000
+vertex 1.0 bone vertex material anim = anim anim
+anim
+anim texture anim bone
+anim bone
+material anim 0.500000
+-1 frame -1 0.500000 vertex bone anim vertex
+-1 bone bone
+texture texture frame = bone frame 0.500000
+0.500000 frame = -1
+-1 anim
+texture 0.500000 -1 0.500000 anim 1.0 -1 1.0 1.0 = 0.500000
+bone
+anim
+vertex frame material vertex anim texture vertex
+anim frame material 1.0 0.500000 = 0.500000 1.0 0.500000 vertex -1 texture
+=
+-1 texture frame vertex
+frame
+0.500000 material anim = 0.500000
+vertex
+0.500000 1.0
+bone texture 0.500000 0.500000 vertex
+1.0 anim
+1.0 = =
+vertex bone = texture vertex texture anim 0.500000
+vertex bone material
+-1 =
+=
+frame = texture
+vertex texture frame -1
+0.500000
+material frame bone
+anim -1 -1 bone -1 = frame -1
+0.500000 anim material material
+anim -1
+0.500000 frame frame material texture = vertex frame 0.500000 vertex anim
+anim anim bone frame anim frame -1 material
+anim frame
+bone
+0.500000 1.0
+anim 1.0 vertex bone vertex =
+texture texture 0.500000
+-1
+material
+0.500000 1.0 texture = vertex -1 -1 1.0
+material 0.500000 frame
+frame 0.500000 material anim anim
+bone = frame = vertex texture 0.500000 anim = frame
+material material texture anim
+frame = -1 0.500000
+vertex anim bone 0.500000 = = -1 bone
+frame anim = bone
+frame frame vertex
+0.500000 -1 anim -1
+= material 0.500000 frame anim -1
+= =
+vertex frame 1.0 material 1.0
+material
+texture frame frame
+bone anim
+=
+vertex vertex 1.0
+1.0 1.0 anim
+1.0
+0.500000 0.500000 bone bone material 0.500000
+frame 1.0
+texture vertex anim bone -1 vertex vertex anim bone
+texture anim anim frame 1.0
+0.500000 = bone
+material vertex bone material
+material
+-1 anim
+material = material -1 texture
+0.500000 bone -1 = -1 anim 0.500000 -1 1.0
+bone
+1.0
+-1 anim texture = = = bone
+-1 =
+texture 1.0 = vertex
+bone frame frame bone anim 0.500000 anim
+material 0.500000 -1
+bone
+frame -1
+vertex
+bone anim
+frame = texture 1.0 = -1 frame texture
+anim vertex
+1.0
+= frame
+-1
+frame
+0.500000 frame
+= texture = material anim texture anim anim 0.500000 0.500000 =
+0.500000 material = material 1.0 anim
+vertex bone
+frame = =
+vertex -1 -1
+1.0 frame frame = anim anim 0.500000 anim vertex -1 texture
+vertex
+-1 anim
+anim bone
+material
+=
+bone 1.0 texture
+bone bone frame bone frame = frame anim 0.500000 = anim texture anim -1 frame bone bone 1.0 material
+1.0 material 0.500000
+bone
+vertex frame anim
+1.0 bone
+frame bone material -1 0.500000 material = vertex
+vertex
+texture = material vertex vertex
+-1 -1 0.500000 bone texture
+= texture
+=
+texture vertex 1.0 frame anim vertex = material 1.0
+= bone 0.500000 material = frame = -1
+frame vertex anim material
+= texture = -1
+frame vertex 1.0 vertex texture 0.500000 vertex 0.500000
+-1 anim 1.0 vertex
+1.0 1.0 frame
+bone frame bone material = vertex texture material
+vertex vertex texture
+vertex 0.500000 frame material -1 material material
+texture
+= vertex 1.0
+= 1.0 =
+0.500000
+fra
\ No newline at end of file
@@ -0,0 +1,4 @@
+frame texture
+-1 = -1
+frame
+= -1 -1 = = = 1.0 materi
\ No newline at end of file
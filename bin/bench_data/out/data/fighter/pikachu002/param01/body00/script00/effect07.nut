@@ -0,0 +1,13 @@
+bone bone bone anim anim
+0.500000
+1.0 bone frame anim anim frame anim frame
+0.500000 anim material vertex anim -1 bone
+bone bone 0.500000
+-1 1.0 -1 -1 frame
+texture material
+bone vertex frame
+0.500000 vertex 1.0 material 0.500000 0.500000
+vertex
+texture vertex texture texture vertex 1.0 -1
+frame
+frame textu
\ No newline at end of file
@@ -0,0 +1,69 @@
+1.0
+-1 texture 0.500000
+1.0 frame frame anim frame material frame vertex 1.0
+vertex vertex frame
+1.0 =
+0.500000 frame 1.0 vertex 0.500000
+frame = 1.0
+anim 1.0 0.500000
+0.500000
+bone texture vertex frame 1.0 texture = texture 1.0
+vertex
+vertex vertex bone
+material frame
+frame 0.500000 vertex vertex bone texture vertex anim 1.0 0.500000
+= material bone 0.500000
+bone = anim
+material -1 vertex 0.500000 frame bone =
+anim vertex
+= bone anim = texture = anim anim
+bone
+= frame anim
+texture bone = texture = = 1.0 bone frame -1 1.0 material bone 0.500000 1.0 texture anim 1.0
+texture frame vertex
+frame 0.500000 anim 1.0 material 1.0 0.500000 0.500000 0.500000
+-1 material texture bone bone
+bone 0.500000 bone frame vertex bone =
+texture bone 1.0
+= 1.0 bone
+material anim
+vertex texture vertex vertex material
+= material material 1.0 vertex
+0.500000 material
+= anim 0.500000
+material vertex
+anim frame anim texture
+material
+bone 1.0 0.500000
+1.0 material material
+1.0 anim -1 -1 0.500000
+1.0
+frame
+texture anim vertex bone =
+texture
+frame
+frame 0.500000 texture 0.500000 bone = 1.0 0.500000 vertex
+=
+material -1 texture anim texture -1
+frame
+anim
+frame 0.500000 bone material
+anim vertex
+=
+texture bone -1 anim -1 bone 0.500000 frame 1.0 anim
+anim
+texture material texture anim = = 0.500000 0.500000 = frame texture 1.0 vertex
+anim vertex anim vertex anim material vertex 0.500000 = = =
+1.0 0.500000 material bone = material 1.0 =
+material 0.500000 = vertex =
+-1 anim frame frame = vertex texture vertex bone vertex frame
+-1
+anim frame material 1.0 vertex
+1.0
+vertex
+bone bone 1.0
+0.500000 texture 0.500000 texture material material bone 1.0
+-1
+0.500000 texture material texture vertex
+texture 0.500000
+1.0 material vertex 0.500000 bone material
\ No newline at end of file
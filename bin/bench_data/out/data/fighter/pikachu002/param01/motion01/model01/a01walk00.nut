@@ -0,0 +1,15 @@
+-1 1.0 0.500000
+bone =
+texture anim texture = bone frame 0.500000 vertex -1 material
+texture frame 1.0 anim -1 0.500000 =
+bone 0.500000 frame texture 0.500000 texture
+material
+vertex frame
+material
+frame
+-1 -1 material -1 1.0 vertex material frame texture 1.0
+anim vertex
+vertex 0.500000 -1 0.500000 anim -1 vertex anim 1.0 vertex 0.500000 material frame vertex 0.500000 0.500000
+bone
+material anim texture texture -1 texture vertex anim
+-1 anim texture vertex texture
\ No newline at end of file
@@ -0,0 +1,19 @@
+0.500000 material vertex material texture 0.500000 1.0 texture -1
+-1 anim frame vertex vertex anim vertex frame bone frame material
+1.0
+vertex material 0.500000 frame 1.0
+anim
+= frame 0.500000 0.500000
+material material
+0.500000
+texture frame -1 material = 0.500000
+anim anim anim frame anim anim
+-1
+0.500000 0.500000
+frame vertex bone bone
+bone bone
+anim -1 anim vertex texture frame anim frame vertex
+-1 texture frame anim 1.0
+texture bone vertex frame -1 material
+0.500000
+material frame
\ No newline at end of file
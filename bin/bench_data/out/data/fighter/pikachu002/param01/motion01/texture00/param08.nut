@@ -0,0 +1,191 @@
+= = bone = = bone 0.500000 anim
+anim anim
+frame 0.500000
+bone material
+material -1 1.0
+texture vertex -1 material vertex 1.0
+1.0 0.500000 = 1.0 anim texture frame 1.0 anim anim anim = vertex
+texture
+frame
+= 0.500000 1.0 texture bone frame
+vertex 0.500000 -1 frame = 0.500000 -1 -1
+material frame material material
+anim frame anim
+material anim
+0.500000 bone material 1.0 = = -1 texture
+material bone
+1.0 =
+0.500000
+bone
+1.0 texture
+vertex frame
+-1 vertex
+vertex 1.0
+1.0
+bone
+-1 frame
+frame 0.500000 frame
+=
+texture bone bone
+1.0 1.0 -1 0.500000 frame texture
+frame frame = = material 1.0 vertex vertex -1
+anim
+texture
+material
+0.500000 -1 1.0
+texture
+1.0 -1 material
+-1 -1 bone
+frame -1 -1 1.0 bone frame anim frame anim 0.500000 frame -1 frame
+0.500000
+anim vertex frame = -1 texture 1.0 -1
+vertex texture frame anim vertex vertex
+bone
+material
+texture
+bone bone -1 0.500000 =
+vertex = bone
+vertex
+frame material texture texture
+= material texture texture material
+0.500000 material -1 =
+anim
+vertex 1.0 0.500000
+-1
+anim frame frame material frame frame vertex 0.500000 bone 1.0 bone 0.500000 frame
+frame
+vertex texture -1 vertex material
+anim vertex texture texture =
+0.500000 material
+-1 1.0
+-1 anim
+anim bone 1.0 material = -1 material
+texture
+texture frame frame vertex anim = 1.0
+bone texture -1 -1 material anim anim
+anim
+vertex texture
+0.500000
+1.0 anim material anim -1 vertex =
+1.0 frame frame vertex texture vertex vertex 0.500000 0.500000
+frame bone material
+frame
+texture anim anim 1.0 anim
+anim -1 vertex texture
+anim texture
+1.0 vertex
+bone frame -1 texture texture anim
+= frame texture
+-1 vertex anim
+material bone
+1.0
+=
+0.500000
+=
+material
+anim -1
+= bone vertex =
+1.0 vertex -1 vertex material =
+texture
+material
+bone 0.500000 anim material material bone bone 0.500000 vertex vertex
+material
+texture
+vertex = texture material bone texture 1.0 = 1.0 0.500000 vertex
+vertex 0.500000
+frame
+0.500000 = anim frame 0.500000 =
+frame vertex
+anim 1.0
+bone vertex vertex 0.500000 vertex = -1
+material
+-1 anim 0.500000 bone
+texture
+anim anim texture
+1.0
+anim texture anim =
+-1
+bone
+=
+texture
+vertex 0.500000 -1
+=
+1.0 -1 0.500000 anim material material vertex
+bone
+0.500000
+-1 vertex frame 0.500000 1.0 = material anim vertex -1 frame 1.0 0.500000 vertex frame
+material = anim -1 texture vertex anim 0.500000 0.500000 material 0.500000 anim = bone material material
+vertex texture = = vertex anim bone 0.500000 bone 1.0
+texture =
+bone texture frame
+texture 0.500000 -1 0.500000
+1.0 texture -1 anim
+texture texture frame vertex material 1.0
+1.0
+-1 vertex texture 1.0 vertex
+anim = 0.500000 frame anim vertex texture vertex
+0.500000
+vertex frame 1.0 = anim material bone
+frame -1 frame 1.0 anim anim
+1.0 frame vertex vertex 0.500000 frame texture texture
+material
+bone bone vertex
+anim 0.500000 vertex 1.0 1.0 0.500000
+frame frame material 0.500000 frame anim texture anim =
+material 0.500000 texture material
+frame vertex texture
+0.500000
+vertex
+bone vertex = bone bone -1 texture anim
+bone material =
+0.500000 material
+texture 1.0 1.0 -1 -1
+frame
+1.0 material
+anim
+texture 1.0 = anim 0.500000 bone
+anim 0.500000 material = texture texture
+0.500000 frame
+0.500000 material -1 bone 1.0 material 0.500000 -1 texture -1 material bone
+bone material = -1 material
+= -1 =
+anim
+frame texture
+vertex vertex -1 vertex 1.0 1.0 0.500000
+1.0
+0.500000 frame
+1.0
+material anim
+vertex material 1.0 1.0
+texture -1 0.500000 0.500000
+= anim anim vertex texture
+texture material vertex
+0.500000 bone
+vertex frame
+material
+=
+anim = anim texture 0.500000 frame
+material vertex vertex -1
+texture
+0.500000 vertex
+anim frame 0.500000 texture frame = anim texture texture 1.0 = 1.0
+vertex frame
+texture texture
+1.0 frame 0.500000 -1 bone texture anim
+anim = 0.500000 = 0.500000 = bone
+anim bone
+-1 vertex vertex
+frame 1.0 material
+frame anim -1
+material material 1.0 vertex 1.0 0.500000 0.500000 1.0 1.0
+bone texture -1 vertex anim -1 vertex
+texture frame bone
+vertex vertex texture
+frame
+anim
+vertex
+=
+-1 bone -1 texture 0.500000 -1 texture vertex texture 0.500000 1.0
+= 1.0
+0.500000 material texture
+-1 material frame 1.0 bone 1.0 -1 =
\ No newline at end of file
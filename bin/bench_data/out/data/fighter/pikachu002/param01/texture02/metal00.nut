@@ -0,0 +1,75 @@
+anim 0.500000 0.500000 bone texture texture material
+texture frame = vertex
+texture anim anim -1
+-1
+0.500000
+material frame
+texture -1 1.0 material 1.0 material bone material anim
+frame frame bone
+= 1.0 anim 1.0 frame -1
+texture
+0.500000 1.0 bone
+-1 vertex texture material frame bone = 0.500000
+material -1 frame -1 -1 1.0 bone =
+frame -1
+= anim
+anim bone texture
+= bone anim
+material 1.0
+1.0 1.0
+anim -1
+1.0 bone material bone
+0.500000 -1 bone
+0.500000 texture material
+vertex bone 1.0 = texture = anim frame
+=
+= vertex
+vertex 1.0
+frame vertex 0.500000 frame frame 1.0 1.0 -1 frame anim
+material = = -1 = frame
+0.500000 0.500000
+bone 0.500000 anim -1 bone vertex 1.0
+0.500000 = 1.0
+=
+frame texture
+-1 0.500000 vertex -1 vertex vertex -1
+vertex
+1.0
+0.500000
+0.500000 texture 1.0 material =
+bone
+vertex
+= frame 0.500000
+texture -1 =
+-1 1.0 -1 frame 0.500000 1.0 -1 vertex = vertex material
+bone texture -1 1.0
+1.0 material anim
+texture bone bone frame
+frame -1 material
+0.500000
+vertex =
+material
+frame 0.500000 = -1 frame material =
+0.500000 material = anim
+-1 -1 -1 vertex 0.500000 = = = -1 frame 1.0 material
+anim 0.500000
+material
+material -1 texture frame 0.500000 anim anim 1.0
+anim vertex material -1
+bone -1 1.0
+0.500000
+material anim
+vertex
+0.500000 material -1 frame 0.500000
+0.500000 -1 0.500000 bone 0.500000 vertex vertex texture = 1.0
+anim
+0.500000 vertex
+-1 vertex texture
+texture
+vertex anim 1.0 bone anim
+bone
+frame -1
+texture = -1 anim anim texture
+-1 0.500000 = anim =
+-1 vertex frame 1.0 = -1
+-1 anim frame -1 frame materia
\ No newline at end of file
@@ -0,0 +1,5 @@
+1.0
+1.0 frame -1 frame frame material
+vertex texture bone = = vertex 1.0 vertex
+-1
+0.500000 material
\ No newline at end of file
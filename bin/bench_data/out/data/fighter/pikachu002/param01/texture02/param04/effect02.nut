@@ -0,0 +1,4 @@
+-1
+anim bone
+bone vertex -1
+vertex anim texture 0.500000 -1 fra
\ No newline at end of file
@@ -0,0 +1,2 @@
+= -1 vertex material 1.0
+texture anim bone
\ No newline at end of file
@@ -0,0 +1,8 @@
+1.0 bone vertex vertex
+0.500000 -1 0.500000
+texture 1.0 0.500000 anim
+material material 0.500000
+1.0 0.500000
+frame anim bone =
+=
+bone frame bone bo
\ No newline at end of file
@@ -0,0 +1,9 @@
+-1 texture = frame = 1.0 material frame 0.500000
+vertex 1.0 vertex frame -1
+material =
+0.500000 texture
+vertex
+anim 1.0 texture
+bone bone
+texture material bone texture 1.0
+0.5000
\ No newline at end of file
@@ -0,0 +1,25 @@
+material material frame
+vertex
+anim frame texture =
+frame anim 0.500000 -1
+1.0 = bone
+frame
+texture vertex anim anim
+= frame
+texture texture texture -1 material
+anim vertex 1.0 vertex = anim bone material vertex texture
+-1
+0.500000
+= 1.0 0.500000 -1 0.500000
+= vertex bone anim
+anim
+texture bone =
+= vertex anim bone vertex bone
+material vertex texture
+bone frame anim vertex
+-1
+1.0
+= 1.0
+-1 material = 0.500000 material
+-1 anim 0.500000
+1.0 vertex material frame 
\ No newline at end of file
@@ -0,0 +1,10 @@
+vertex material
+texture -1 texture material
+0.500000
+-1
+bone material 0.500000
+frame 1.0 frame 0.500000 =
+vertex
+1.0 0.500000 0.500000 anim -1 1.0 frame frame
+= frame anim texture
+frame mater
\ No newline at end of file
@@ -0,0 +1,80 @@
+-1
+material texture =
+material -1 -1 0.500000 vertex
+frame
+material =
+vertex vertex vertex material texture
+bone bone
+material
+-1 0.500000 frame vertex
+frame vertex texture
+0.500000 vertex frame frame
+1.0 anim
+= 1.0
+material
+texture material 1.0 bone vertex 1.0 texture frame texture texture 1.0 1.0 anim
+bone = texture
+vertex
+=
+bone
+-1
+bone material frame material anim 1.0 frame vertex 0.500000 0.500000 bone
+texture
+material texture anim
+anim texture -1
+vertex -1 1.0 0.500000 1.0 material frame frame =
+0.500000 -1 -1 frame
+0.500000 frame = material = anim vertex
+texture material
+= = 1.0 -1 = material
+bone vertex 0.500000 bone frame anim
+bone anim
+anim
+vertex vertex frame
+bone texture vertex 1.0
+0.500000
+bone -1
+frame = 0.500000 texture
+= frame frame
+= vertex texture anim = vertex -1 vertex material material 0.500000 0.500000 = texture
+bone
+frame -1 1.0 vertex vertex
+-1 bone
+-1
+= bone frame -1 = bone -1
+vertex 0.500000 anim =
+vertex -1 anim frame
+bone vertex vertex
+1.0 vertex 1.0
+= -1 1.0 = bone -1 vertex
+bone
+texture bone -1 bone 1.0 material material material material
+=
+vertex = material frame = 0.500000
+0.500000 =
+vertex anim anim frame texture
+0.500000 frame texture -1
+bone
+1.0 -1 material -1
+material bone vertex anim anim
+bone anim 1.0 vertex
+anim =
+vertex
+0.500000 texture = texture anim texture vertex
+vertex vertex anim bone vertex vertex
+= texture = bone 0.500000 anim 0.500000
+anim 0.500000 vertex
+bone 1.0 vertex = vertex 1.0 0.500000 anim frame =
+anim bone -1
+texture -1 vertex 1.0
+bone frame
+-1 0.500000 texture
+anim texture = 0.500000 material material
+material
+material texture frame
+texture
+frame bone bone 0.500000
+texture material 0.500000 =
+-1 = material 1.0 texture
+anim -1 -1 vertex = = bone bone = anim =
+0.500000 0.500000 = anim 1.
\ No newline at end of file
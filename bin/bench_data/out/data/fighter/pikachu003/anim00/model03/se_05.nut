@@ -0,0 +1,3 @@
+1.0 frame
+-1 0.500000 = bone -1 texture 1.0 0.500000 texture
+mater
\ No newline at end of file
@@ -0,0 +1,6 @@
+1.0 0.500000 frame
+anim vertex 0.500000
+frame vertex 1.0
+anim = anim 1.0
+anim anim frame anim anim material
+bone -1 0.500000 material anim material 1.0 vertex
\ No newline at end of file
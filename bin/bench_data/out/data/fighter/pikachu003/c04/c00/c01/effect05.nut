@@ -0,0 +1,11 @@
+vertex 1.0
+frame
+material 0.500000 = -1 vertex 0.500000
+material -1 material
+bone material
+-1 0.500000 1.0 vertex
+anim
+1.0 material -1 vertex 1.0 1.0 anim =
+= vertex anim 0.500000 bone bone 0.500000
+anim material frame material
+bone = frame = vertex anim
\ No newline at end of file
@@ -0,0 +1,5 @@
+Ik{Z"YE*]Yr]ix$E*Yz0|䘈f$գ ү2L-ʢrO1m+yt.Ĵdc˾j}yH +0tsWKX%q&qAΩ	VEK27}wĳ\!bify$LC-$5S)ohY?1~'ꮐLg%@Z҈p|ĎW7YNhGB5AaKtQdzA]?ˉ=d|NHYmrx$PrsZ)7w9rb)%Moc:`\3f;9Ղ2sD=#-T!օV+l	]`ēdۢ:7zy(r"%V=I-`K
+h|mI 4_Iwqn2jw(WqᰬGiD1tOи]+ȸ0j!b{f<Jm$S")B?}X6V-nri䯀q {I03pgMDw[1exB,2:ɭNX.?ۺ7R2*el
+ߥL+Ą(1AcDaALn $#c
+hkm%l"au#iWaFyvJh6Q&a7:Oh ԒK|Gys,ϓÅ4K:a]h/oGa=k:ŉp7bGH<Kʤ~$k]]|?V3}nC+2d3.\j`7_$n̻%- 4t衳mw] DhvgQ[ufWzwjlB\@J6޶|=ldLq`@HI%.Moyڃ'_`0Zj e?t=iwo_;oDoT6Ų1.
+tr}ҼƼ`@*=)D:h(Qb6]Qcw@FS}|yn{+=jtجJWYY<Óp"d쐦bv"3&DWFS4=1W[ER"p>y=q}c3Rk
\ No newline at end of file
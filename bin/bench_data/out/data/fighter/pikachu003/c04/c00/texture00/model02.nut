@@ -0,0 +1,2 @@
+0.500000 texture 0.500000
+material
\ No newline at end of file
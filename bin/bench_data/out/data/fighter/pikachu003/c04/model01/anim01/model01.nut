@@ -0,0 +1,64 @@
+material 1.0 1.0
+material vertex 0.500000
+texture frame vertex material vertex
+vertex
+-1
+-1 vertex bone texture material material texture
+vertex material
+material vertex 0.500000 = texture
+vertex frame anim 1.0 bone
+= 0.500000 -1 texture -1 texture anim = texture
+= bone anim bone
+material -1 frame = -1
+vertex = anim = anim -1 vertex texture
+1.0 material 1.0 1.0
+0.500000 anim 1.0
+frame
+vertex frame vertex -1
+= 0.500000
+bone =
+texture texture frame 0.500000 material = bone
+texture texture frame
+0.500000 anim bone texture material
+-1 frame -1 vertex vertex texture = = anim vertex 0.500000 -1
+anim
+=
+vertex material 0.500000
+= frame
+texture -1 = bone vertex bone vertex 1.0 frame anim = frame frame 0.500000 -1
+bone vertex = -1 bone
+0.500000
+vertex 1.0 anim
+anim material bone bone 1.0 vertex bone anim
+anim texture 1.0
+-1 vertex -1
+anim vertex frame anim bone anim texture anim 0.500000 1.0
+= 0.500000 = -1 anim frame -1 0.500000
+material 0.500000 texture vertex -1
+= 1.0 = -1
+material -1 = vertex frame material
+bone
+= material 1.0
+bone bone frame
+material frame
+1.0 texture
+= texture bone material anim anim material bone
+material material bone =
+anim vertex material vertex material 0.500000 vertex
+texture -1 bone frame
+= material = 0.500000 bone
+vertex material
+vertex -1 -1 vertex bone bone 1.0 texture
+0.500000 bone
+bone 1.0 vertex anim
+material = texture
+-1 material
+-1 anim material
+-1
+vertex anim
+anim material
+vertex texture
+-1
+1.0 anim -1 -1 1.0 0.500000
+-1 texture
+= material 0.500000
\ No newline at end of file
@@ -0,0 +1,11 @@
+= frame
+vertex anim material anim 0.500000
+texture frame anim frame = 1.0 anim
+0.500000
+material = = 1.0 material 1.0 =
+vertex vertex
+texture anim texture texture 1.0 bone
+frame = bone frame 1.0 -1 frame frame bone
+= vertex material anim 1.0 0.500000
+frame anim bone 0.500000
+0.
\ No newline at end of file
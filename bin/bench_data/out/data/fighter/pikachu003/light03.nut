@@ -0,0 +1,20 @@
+material = = anim bone -1 bone -1 texture
+material anim
+0.500000
+texture -1 1.0 texture anim vertex frame
+= frame texture bone 1.0
+= bone bone 1.0 texture 1.0
+anim
+-1
+frame 0.500000
+vertex bone 1.0
+= 0.500000 texture
+= -1 = vertex 0.500000 0.500000 -1 0.500000 frame texture frame texture frame
+-1
+bone 0.500000 1.0
+bone
+bone
+anim frame
+frame -1 anim frame 1.0 -1 -1
+vertex vertex
+1.0 -1 frame material 0.
\ No newline at end of file
@@ -0,0 +1,59 @@
+material texture
+= 0.500000 frame material
+texture texture vertex material material
+texture =
+1.0 material 1.0 vertex 1.0 = 1.0
+= texture frame frame
+frame frame 1.0 vertex 0.500000 anim frame anim 1.0
+0.500000 = vertex 1.0 bone =
+1.0 0.500000
+-1 texture
+-1
+=
+-1 bone 1.0 =
+1.0 vertex vertex frame anim
+= 1.0 bone
+anim 0.500000 1.0 frame anim anim = 1.0 anim bone
+1.0
+texture -1 material material 1.0 -1 1.0
+bone texture 0.500000 bone -1 0.500000 -1 -1 0.500000
+anim texture
+-1 -1 1.0 0.500000 = -1 material
+1.0 anim
+material frame -1
+anim
+texture bone -1 material 0.500000 -1
+bone
+material vertex
+material
+= bone
+texture material anim 1.0 vertex = -1 0.500000
+anim
+=
+anim texture
+anim -1
+bone 1.0 frame -1
+texture
+texture texture 0.500000
+frame -1 0.500000 = 1.0
+anim -1
+vertex bone
+anim material
+frame material anim material material
+1.0 anim
+0.500000 frame 0.500000
+= -1 -1 0.500000 =
+texture -1 1.0 vertex vertex texture frame 1.0 1.0 bone 0.500000 0.500000 -1
+= anim
+material = vertex vertex vertex material
+frame anim
+texture 1.0 frame anim frame
+= bone -1 0.500000
+vertex 0.500000 anim anim bone vertex bone frame frame texture 0.500000 material
+-1 0.500000 material -1 bone anim
+0.500000 texture
+-1
+-1 anim anim -1
+frame frame
+0.500000 bone -1
+bone material texture texture frame texture = frame vertex anim vertex 1.0 
\ No newline at end of file
@@ -0,0 +1,7 @@
+-1 anim 0.500000
+vertex 1.0
+vertex 0.500000
+texture
+0.500000
+-1
+0.500000 -1 0.500000 frame 1.0 texture -1 0
\ No newline at end of file
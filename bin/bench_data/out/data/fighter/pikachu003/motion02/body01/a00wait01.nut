@@ -0,0 +1,157 @@
+vertex anim -1 = 0.500000 vertex
+frame
+anim -1 =
+anim texture frame 0.500000
+bone
+frame frame = frame 0.500000 frame anim
+= -1
+vertex
+= 0.500000
+= -1
+vertex vertex bone
+material material -1
+=
+frame vertex vertex bone bone material -1 =
+bone
+frame
+anim material bone
+vertex 1.0 1.0 = material 1.0
+= -1 material
+texture 0.500000 0.500000 vertex 0.500000 bone bone bone -1 = frame -1 material 0.500000 texture
+bone texture material -1 vertex
+texture vertex vertex 1.0 0.500000 texture -1 texture material
+frame anim anim
+1.0 0.500000 = texture
+vertex =
+vertex vertex
+anim texture 0.500000 = vertex
+= 0.500000
+texture vertex bone 1.0 anim = -1 1.0 material frame
+1.0 texture frame vertex material = material
+vertex vertex
+frame material vertex frame
+= vertex
+= texture
+1.0 1.0
+texture
+anim
+material = vertex
+texture anim texture 1.0
+1.0
+1.0 material material texture
+1.0 1.0
+-1 anim material
+material vertex
+= 1.0 1.0 anim anim
+vertex 0.500000
+material 0.500000 frame = anim = -1 frame = frame
+vertex 0.500000 -1 0.500000
+frame 0.500000
+vertex material texture = anim
+1.0
+vertex = texture bone =
+anim
+texture anim 1.0 material anim 0.500000 anim
+-1
+anim = 0.500000
+texture
+material 0.500000 anim frame texture material
+bone anim vertex 0.500000 0.500000 = 0.500000 0.500000 vertex material -1 = = bone material 0.500000 anim 0.500000
+-1 texture
+vertex
+texture texture
+=
+= vertex anim anim 0.500000 0.500000 frame bone anim
+1.0 texture -1 vertex anim frame -1 0.500000 bone
+anim texture vertex = frame -1 0.500000 material -1 material 0.500000
+0.500000
+material
+1.0
+0.500000 1.0 1.0 = vertex
+0.500000
+-1
+anim vertex
+material texture frame
+= 1.0 anim texture frame 0.500000
+anim
+bone
+material bone anim material
+anim texture frame
+material -1 vertex -1 -1
+anim
+-1 = 1.0 texture frame
+= =
+material
+anim -1
+material vertex frame frame 0.500000 bone 0.500000 frame
+0.500000 bone 0.500000
+material frame material
+frame material
+vertex
+material bone texture
+anim = = 0.500000 vertex 1.0 material
+-1
+= -1 anim -1 material vertex
+material
+1.0 vertex -1 vertex anim 1.0 1.0 frame vertex material
+vertex anim vertex
+anim frame material vertex bone bone
+material frame -1 1.0 -1
+frame -1
+material frame frame = = 0.500000 bone bone anim
+1.0 = = frame
+material material material 1.0 texture = = 0.500000 anim 1.0 vertex
+anim bone =
+anim frame
+vertex
+-1
+vertex
+0.500000
+material
+= anim = texture
+anim bone anim -1 frame
+bone
+-1 material
+texture
+material -1 0.500000 = 1.0
+= anim anim anim
+1.0
+frame bone vertex 0.500000 bone 0.500000 bone material 1.0 texture
+= -1
+frame frame vertex frame = anim
+vertex
+1.0 anim texture =
+frame
+texture anim
+material 1.0 =
+-1 vertex frame anim -1 = anim
+1.0
+texture bone anim anim material -1 anim anim
+vertex bone
+vertex 1.0
+anim
+anim 0.500000
+= material bone =
+anim 1.0 texture material
+0.500000
+vertex vertex -1 texture material anim 0.500000
+anim = vertex
+1.0
+texture 0.500000 material vertex bone -1 texture
+material = vertex anim anim
+1.0 0.500000
+anim
+anim
+texture frame -1
+-1 anim -1 texture
+bone
+frame texture = texture = texture
+vertex 1.0 -1 = material vertex -1 material 1.0
+1.0
+1.0 frame -1
+-1 anim texture
+vertex -1 vertex bone
+= = frame
+bone
+texture
+1.0 -1 anim vertex 0.500000 = = material bone anim 0.500000 bone 
\ No newline at end of file
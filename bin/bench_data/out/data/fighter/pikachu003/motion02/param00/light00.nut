@@ -0,0 +1,66 @@
+texture 1.0 vertex frame
+material bone
+anim
+frame texture 0.500000 material
+texture texture 1.0 frame frame vertex 1.0
+0.500000 bone = material
+1.0 -1 frame
+texture 0.500000 1.0 -1
+0.500000 bone texture anim
+0.500000 vertex 1.0 vertex anim material 1.0 bone
+material
+1.0
+material anim 0.500000 frame -1 vertex
+1.0 0.500000
+material material
+frame anim 1.0
+vertex 1.0
+-1 anim anim
+bone
+-1 -1 0.500000 -1 -1
+anim
+anim frame 0.500000 vertex 0.500000 material bone
+-1 1.0 material material
+bone 0.500000 material texture 0.500000 anim
+vertex anim
+=
+texture -1 bone texture
+texture
+bone material 1.0 anim anim
+bone vertex 1.0 1.0 material texture bone
+material texture
+frame
+bone 0.500000 = 0.500000 texture 0.500000
+bone 0.500000
+material
+0.500000 0.500000 1.0
+frame texture
+1.0 bone frame bone
+vertex -1
+material frame -1 frame frame vertex vertex bone anim -1
+texture
+material anim vertex 0.500000 texture texture anim material
+material
+0.500000 = = =
+vertex
+texture = bone -1
+= bone texture 0.500000 anim texture 1.0 -1 material vertex 1.0
+anim frame
+-1 anim
+bone anim vertex vertex 0.500000 1.0 frame texture texture frame anim anim bone -1 anim texture material
+0.500000 frame texture 0.500000 vertex
+anim
+-1 material
+= material texture 1.0 0.500000
+-1 frame
+1.0 texture anim
+=
+-1 frame 1.0 frame anim vertex anim material bone
+bone
+frame -1 0.500000 anim
+= -1 -1 texture anim
+material vertex bone 1.0 bone
+bone -1 anim vertex -1 = texture texture texture
+0.500000
+material anim
+= -1 vertex
@@ -0,0 +1,4 @@
+_.yL۾>gKL=vL7("M	c!v>Zz}tߴۦdIeO:"D3iIग़͏{J7YOA%,KJw\+0:JfW؋:3.f|HXغt~b=-\<>s3to:مtH֍fldY@C}m2
+55"@;iGMDB:::\y~MӜ0?#X
+6
+|<nGACMafxfJpgZ
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame bone -1 frame
+frame material =
\ No newline at end of file
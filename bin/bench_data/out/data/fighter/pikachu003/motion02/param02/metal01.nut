@@ -0,0 +1,4 @@
+bone
+material
+texture 1.0 material
+texture bo
\ No newline at end of file
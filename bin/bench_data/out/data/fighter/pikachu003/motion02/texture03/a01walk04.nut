@@ -0,0 +1,74 @@
+frame bone -1 = material material texture
+frame material
+anim 1.0
+= texture
+texture 0.500000 = 1.0
+-1 1.0 frame bone = vertex 0.500000 anim = frame
+texture = vertex bone 1.0 = frame material
+= texture = texture
+vertex
+= 0.500000 = -1
+= anim 0.500000 0.500000 material -1
+1.0 vertex 0.500000 bone material frame
+= -1 texture frame
+bone -1 = anim 0.500000 frame vertex = -1
+bone anim anim = =
+1.0 0.500000 texture -1
+1.0 0.500000 bone
+=
+material
+=
+frame
+= -1 = bone frame frame frame material anim bone anim material
+bone material anim
+texture -1 = anim texture vertex 1.0
+vertex anim 0.500000 vertex
+vertex
+=
+material
+vertex
+bone -1 bone
+vertex
+=
+vertex = frame 0.500000
+0.500000 bone texture texture -1 -1 texture
+bone texture
+anim 1.0 vertex texture
+= anim
+vertex vertex material 0.500000
+vertex
+vertex frame 0.500000 material = vertex 0.500000 0.500000
+= = vertex
+1.0 anim
+=
+1.0
+0.500000 texture bone 1.0
+frame
+frame =
+anim
+-1 frame texture 0.500000 bone bone texture
+bone texture = bone bone texture 1.0 0.500000 = frame 0.500000 vertex texture
+anim 1.0 1.0 bone frame
+= material 1.0
+bone
+material bone
+frame -1 texture
+anim 1.0
+-1
+anim =
+anim frame
+texture frame material 1.0
+0.500000 1.0 anim -1 anim material texture texture -1 anim 0.500000 anim 0.500000 texture vertex
+0.500000 texture
+anim 1.0 bone frame
+vertex
+1.0
+material = texture 0.500000 -1 = texture
+bone 0.500000 = material
+texture anim anim
+= bone
+-1 bone frame texture bone material -1 anim bone
+=
+= = frame anim anim 0.500000
+0.500000 frame -1 material material material 1.0 texture material vertex
+material material texture material materia
\ No newline at end of file
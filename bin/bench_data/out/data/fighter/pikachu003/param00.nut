@@ -0,0 +1,4 @@
+texture
+material -1 vertex
+material 0.500000 0.500000 1.0 anim bone 0.500000 material
+f
\ No newline at end of file
@@ -0,0 +1,166 @@
+0.500000
+1.0 vertex
+=
+frame 1.0 bone texture
+texture
+bone vertex material frame anim 0.500000 vertex bone
+-1 material frame anim texture bone
+bone = 1.0 bone
+vertex
+1.0
+bone material
+vertex
+bone
+vertex = = material anim vertex material material vertex frame
+= bone
+anim 1.0 anim = bone anim
+= 0.500000 -1 material bone anim -1 -1 1.0
+frame bone
+-1 anim 1.0 frame
+0.500000
+material material material bone
+1.0 bone bone 1.0 =
+material
+material
+-1 vertex
+1.0 anim -1 texture 0.500000 = 1.0 -1 0.500000
+-1
+= 1.0
+-1 material =
+1.0 0.500000
+bone
+=
+1.0 material vertex 1.0 material anim -1
+-1 vertex 1.0 0.500000
+texture anim frame
+-1 vertex material
+= material
+1.0
+texture frame -1
+anim frame 1.0 vertex
+-1 texture bone 1.0 texture
+texture bone frame
+-1 bone
+anim anim bone frame 1.0 material
+material material bone
+material material =
+vertex
+material texture vertex material -1 anim material anim vertex 1.0 texture 0.500000
+material vertex
+vertex
+-1 texture
+1.0 material texture vertex bone
+anim frame
+bone 1.0 frame texture texture anim
+texture bone
+-1 material
+frame 0.500000 =
+vertex -1 texture
+texture texture = bone material = frame vertex -1
+frame =
+-1 0.500000 = 1.0 material texture vertex 1.0 anim
+bone anim
+anim frame 1.0 bone texture -1 -1
+texture bone material anim 0.500000 vertex = texture 0.500000 = anim
+anim 1.0 1.0 frame bone
+material
+bone bone 1.0 frame anim -1
+-1 anim frame -1
+material
+bone 1.0
+bone bone material vertex 1.0
+anim anim
+texture 0.500000 = = 1.0 bone
+0.500000 material = -1
+anim material anim material texture = material
+frame bone anim anim anim anim = 0.500000 1.0 vertex anim -1 0.500000
+material bone material texture material = =
+bone
+texture 0.500000
+0.500000 1.0
+1.0
+1.0 bone
+bone 0.500000
+material
+bone -1 0.500000
+frame
+texture
+vertex 0.500000
+vertex texture = -1
+frame texture 0.500000
+bone
+0.500000 texture -1 frame vertex
+vertex 1.0 anim =
+0.500000 vertex
+material anim -1 anim frame -1 = = material anim frame bone = = bone
+texture
+=
+anim -1 texture
+1.0 texture bone 0.500000
+1.0 bone
+vertex bone
+0.500000
+frame frame vertex texture 0.500000 bone
+anim frame -1 1.0
+-1 texture -1
+material bone frame material texture = =
+frame
+anim anim
+vertex 0.500000
+0.500000 0.500000 0.500000 vertex
+= anim anim
+bone frame vertex texture 0.500000
+anim texture
+frame
+0.500000 anim
+=
+0.500000 0.500000
+anim
+bone vertex frame texture vertex bone
+anim frame
+vertex texture
+0.500000 vertex 0.500000
+1.0 = bone
+= texture 0.500000 -1 anim anim bone anim
+1.0 texture 1.0 0.500000
+texture =
+1.0 -1 0.500000 texture 1.0 anim material bone anim 1.0 material
+vertex frame frame frame frame
+-1 anim =
+bone bone texture
+material 1.0 frame 1.0 material texture vertex anim 1.0 material texture bone 1.0 texture = material =
+-1 texture bone vertex frame frame material 1.0 vertex
+anim vertex
+vertex anim 0.500000 -1
+1.0
+anim bone frame -1 0.500000
+texture texture 1.0 1.0 0.500000 material
+anim bone anim -1 1.0
+bone 1.0 vertex material material
+1.0
+anim anim material 1.0
+-1 =
+-1 frame anim texture = -1 0.500000 material
+frame
+1.0 bone vertex anim 1.0 0.500000 frame 1.0
+-1 frame bone bone 0.500000 texture anim material frame anim 0.500000 material -1 anim material 0.500000 vertex texture anim
+1.0
+vertex
+-1 texture frame
+texture = texture -1 bone = = bone anim anim bone
+bone
+-1 = frame = material anim 0.500000 -1
+= -1 bone anim vertex
+anim 0.500000
+material
+bone anim 0.500000 frame bone material -1 bone frame anim = frame
+=
+vertex frame 0.500000
+anim 0.500000 anim
+texture -1
+= bone bone frame anim -1 =
+bone bone
+bone
+bone texture -1 bone
+texture 1.0 bone
+material 0.500000 = 0.50
\ No newline at end of file
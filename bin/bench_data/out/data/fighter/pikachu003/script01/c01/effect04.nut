@@ -0,0 +1,6 @@
+frame frame anim
+=
+material vertex
+vertex
+bone texture -1 -1 texture 1.0 vertex bone
+-1 ma
\ No newline at end of file
@@ -0,0 +1,28 @@
+vertex 0.500000 bone -1 material
+texture material texture = vertex texture material
+-1
+= 0.500000 1.0 frame material -1 = texture texture bone bone bone vertex 0.500000 texture frame frame vertex bone
+vertex material 1.0
+bone texture
+0.500000 texture frame texture bone -1
+0.500000 frame material -1
+anim bone 0.500000 =
+bone
+bone bone
+material
+anim frame 1.0
+anim 0.500000 1.0 texture
+material anim 1.0 0.500000
+material anim bone anim
+-1 = frame vertex
+frame =
+vertex -1 vertex -1
+-1 material anim frame = anim
+1.0 1.0 =
+vertex material
+= -1 vertex
+bone
+1.0
+texture =
+= frame
+material fr
\ No newline at end of file
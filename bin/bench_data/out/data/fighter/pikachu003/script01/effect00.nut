@@ -0,0 +1,71 @@
+= frame anim
+1.0
+-1
+material 0.500000
+-1 texture bone anim
+1.0 -1 0.500000
+frame texture texture
+-1
+anim vertex 1.0 = = 0.500000 1.0 frame vertex -1 material 0.500000 -1 material bone
+vertex = -1 material texture
+1.0 vertex frame texture vertex texture anim vertex
+material
+= 1.0 vertex anim 1.0 material anim vertex material frame 1.0 =
+texture 1.0 bone =
+anim
+frame 1.0 material
+= frame 0.500000 bone vertex 0.500000
+1.0 0.500000 1.0 -1
+= = texture 1.0 vertex = = bone
+=
+frame texture
+frame
+=
+1.0
+1.0 0.500000 bone anim 0.500000 = = anim vertex = material material = anim material bone
+vertex anim -1
+anim anim vertex
+-1 vertex -1 vertex frame frame texture = vertex bone bone bone frame 0.500000 bone anim -1 anim = = = -1 1.0 = bone 1.0 0.500000 material material
+frame
+frame 1.0 material
+=
+anim
+-1 1.0
+-1 1.0 frame 0.500000 vertex
+bone 0.500000 -1 material 0.500000 bone
+anim bone 1.0 -1 frame bone 0.500000 anim frame 0.500000 bone frame texture
+= material 1.0 anim vertex vertex texture frame bone
+1.0 anim material
+anim
+frame anim texture 0.500000 texture 1.0
+anim 0.500000
+= material texture anim = = frame 1.0 anim anim -1 = texture frame texture
+anim anim material = -1
+frame frame
+-1 bone anim
+material texture
+material 1.0 1.0 vertex = frame texture frame material 1.0 1.0 vertex 0.500000
+frame = texture
+0.500000
+-1 texture frame material = anim frame anim -1 bone vertex texture material bone texture
+vertex
+material
+vertex
+1.0 vertex bone -1 -1 bone 1.0
+0.500000
+1.0 bone
+material anim vertex texture texture
+frame frame -1 = vertex 1.0 texture 1.0 -1 frame 1.0 = 1.0 1.0 -1 material -1 bone 0.500000 texture vertex vertex 1.0 = anim 0.500000
+vertex = 0.500000
+bone =
+0.500000 = anim frame -1 0.500000 0.500000 vertex
+-1 bone frame -1 bone
+texture -1 bone anim texture -1
+material bone anim vertex
+frame
+material
+-1 0.500000 vertex anim
+texture anim anim
+0.500000 1.0 anim texture = anim -1 = material 1.0 0.500000 vertex
+1.0 vertex
+vertex
\ No newline at end of file
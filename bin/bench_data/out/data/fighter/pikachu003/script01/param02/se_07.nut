@@ -0,0 +1,3 @@
+frame -1 bone anim anim
+vertex 0.500000 -1 bone material
+1.0 vertex = = 
\ No newline at end of file
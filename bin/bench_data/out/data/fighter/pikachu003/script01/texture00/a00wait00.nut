@@ -0,0 +1,51 @@
+anim bone -1 bone vertex
+bone 0.500000 1.0 bone anim vertex anim
+vertex frame
+=
+vertex vertex
+frame anim anim texture 1.0 bone 0.500000 texture
+material bone -1 texture -1 -1
+anim frame 0.500000
+bone =
+frame texture = vertex =
+0.500000
+1.0 -1 1.0 0.500000 1.0
+1.0 1.0 -1 bone 0.500000 bone frame bone 0.500000 texture
+texture texture 0.500000 material anim
+vertex
+= 0.500000
+bone frame 1.0
+frame vertex 0.500000 = -1 material =
+=
+bone -1 texture material texture texture -1 texture 0.500000 anim material = -1 -1
+anim 0.500000
+-1 bone -1 1.0
+frame 1.0 material
+= -1
+texture 0.500000
+material texture anim bone material vertex
+bone texture = frame vertex bone anim -1
+material 0.500000
+1.0 material anim anim
+1.0 material = 0.500000
+1.0
+material vertex 0.500000 texture vertex bone
+texture vertex -1 1.0
+0.500000 1.0 -1 =
+vertex = 0.500000 frame
+-1 1.0 anim vertex
+bone frame = 0.500000
+vertex
+vertex
+anim texture anim bone -1 1.0 1.0 material texture 0.500000 frame 1.0
+1.0 0.500000 material material anim
+0.500000 = texture
+1.0 texture anim anim material bone
+anim
+-1 0.500000 =
+bone anim texture texture bone material 1.0 texture bone
+anim frame
+anim 0.500000 0.500000 bone anim bone 0.500000 = 0.500000 vertex vertex
+vertex
+anim vertex
+1.0
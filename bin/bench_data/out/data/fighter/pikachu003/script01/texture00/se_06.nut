@@ -0,0 +1,27 @@
+-1
+-1
+0.500000 -1
+texture frame 1.0 vertex frame material bone 0.500000 = texture frame material = vertex
+= = 0.500000 material frame vertex bone bone 0.500000 texture
+material
+bone = anim
+material vertex
+frame bone bone -1 bone -1
+1.0 anim material 1.0 frame material = material anim frame 0.500000 frame anim bone material bone bone
+frame
+= 0.500000 bone frame anim
+material
+0.500000 = bone bone
+bone -1 vertex
+0.500000 material -1
+material texture 1.0 material texture =
+-1 1.0 material = = 0.500000 texture bone 1.0 texture anim frame 0.500000 1.0 texture = material material texture vertex = texture frame frame 1.0 -1 material 0.500000 vertex
+vertex 1.0 1.0 vertex frame anim
+0.500000 bone frame =
+vertex
+anim
+vertex -1 vertex
+frame =
+frame frame
+frame frame anim anim anim -1
+anim 
\ No newline at end of file
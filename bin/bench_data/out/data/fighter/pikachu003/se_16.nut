@@ -0,0 +1,4 @@
+bone material vertex
+anim vertex 1.0 =
+anim 0.500000 1.0 -1 texture material -1
+texture 1.0 0.500000 bone 0.500000 = = material -1 -1
\ No newline at end of file
@@ -0,0 +1,12 @@
+material anim
+vertex vertex 0.500000 bone
+0.500000 texture -1
+= anim vertex texture
+texture vertex = texture bone 1.0 texture frame frame anim frame = -1 frame frame 1.0 vertex 1.0 = anim
+frame = texture
+0.500000 bone
+1.0
+vertex -1 anim = = texture -1
+1.0 0.500000 material
+1.0 1.0 bone
+anim bone frame vertex
\ No newline at end of file
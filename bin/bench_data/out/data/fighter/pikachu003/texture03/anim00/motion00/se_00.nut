@@ -0,0 +1,246 @@
+vertex frame
+frame
+=
+0.500000 frame = vertex texture anim bone vertex
+= texture -1
+material -1
+= 0.500000
+1.0 =
+frame vertex 1.0 anim material 1.0 anim vertex texture 0.500000 =
+1.0 1.0 frame frame
+texture
+vertex 0.500000 texture
+material 1.0 0.500000
+bone bone -1 material -1 frame 1.0 material = =
+texture
+0.500000
+0.500000 -1 vertex
+frame bone = material -1
+0.500000 anim bone bone -1 =
+bone vertex 0.500000 = texture 0.500000 1.0 0.500000 1.0 material = 0.500000 1.0 1.0 vertex
+frame bone texture
+anim anim anim
+frame 0.500000 frame vertex 0.500000 frame frame bone -1 bone
+bone = 0.500000 -1 frame 1.0 = -1
+1.0 0.500000 texture material vertex
+vertex anim texture -1 0.500000
+frame 1.0
+anim anim frame bone -1 texture anim
+anim
+1.0 = texture texture
+bone -1 anim vertex anim
+vertex
+anim bone
+-1 1.0 0.500000
+frame bone anim texture texture
+material =
+texture
+anim vertex anim bone -1
+-1 vertex anim texture texture texture
+bone bone
+1.0 anim
+0.500000
+frame -1 anim = = frame anim anim = -1 frame = bone texture
+-1 0.500000 vertex frame
+texture
+anim
+vertex 1.0
+bone
+anim
+-1 texture -1
+frame vertex texture
+bone
+anim vertex
+anim anim material frame
+vertex texture = -1
+frame 0.500000 -1 1.0 -1 -1 material 1.0 material 1.0
+material 0.500000 material anim 1.0 texture vertex
+vertex -1 bone vertex bone
+bone
+vertex anim anim bone frame 1.0 1.0 anim -1
+vertex -1 anim
+0.500000 bone 0.500000 material -1 anim 0.500000 texture texture = 1.0
+-1 -1
+frame frame material = 1.0 1.0 material 1.0
+texture = vertex
+texture
+texture 1.0 texture 0.500000
+texture 0.500000 frame bone -1 texture
+frame
+-1
+texture material 1.0 frame texture 0.500000 anim
+-1 frame -1 1.0 frame
+texture = texture texture -1 =
+material frame -1 anim
+frame -1 =
+bone
+frame
+frame frame
+-1 -1 anim frame texture -1 1.0
+frame -1 material -1 -1 anim 0.500000 material 1.0 1.0 material 1.0 -1 material 1.0
+bone material material texture 0.500000 1.0 vertex material 0.500000
+vertex material vertex bone frame 0.500000 anim
+1.0 vertex 1.0 bone = 0.500000
+0.500000 material = material vertex
+-1 -1 vertex
+= = vertex anim -1 1.0 texture
+anim -1 = frame anim
+anim frame
+anim
+-1
+bone -1 0.500000 1.0 -1 0.500000
+1.0
+0.500000 anim vertex = frame bone 0.500000
+-1 texture bone
+texture -1 vertex
+frame 0.500000
+bone material -1 anim
+1.0 bone = 1.0
+material bone
+material
+= =
+material -1 1.0 vertex vertex
+anim frame anim
+anim material frame -1 anim vertex frame -1
+material texture 1.0 1.0 texture vertex 1.0 texture bone -1 vertex material
+bone bone bone
+= -1 -1 -1 1.0 frame bone material 0.500000
+anim
+texture vertex texture frame bone material vertex = anim
+= = -1 anim material -1 frame 1.0 vertex = 0.500000
+= bone vertex frame
+material 1.0 bone 1.0 bone
+anim
+material = texture
+vertex material -1 anim texture vertex 0.500000 = 1.0 texture material
+anim -1 -1 material 0.500000 = 1.0 material bone frame anim texture frame 1.0 bone 1.0
+bone -1 frame 0.500000 bone bone 1.0 bone frame bone 0.500000
+0.500000 material
+-1
+= bone
+frame frame vertex material material 1.0 texture texture 0.500000 1.0 0.500000 = bone =
+-1
+anim vertex vertex -1 0.500000 material frame
+0.500000 anim -1 1.0
+frame 0.500000
+0.500000 texture material = = bone frame material anim bone vertex material
+texture frame anim material bone
+bone
+material vertex frame bone frame -1 vertex
+1.0
+frame vertex
+anim
+bone
+material
+bone 1.0 1.0
+= frame 0.500000 = frame = bone 0.500000 1.0
+bone material bone
+= -1 -1
+= bone frame frame -1
+=
+1.0 anim material 0.500000
+bone anim material -1
+0.500000 frame texture material texture 1.0 = vertex frame 0.500000 -1 anim material
+-1 vertex
+= anim vertex 0.500000
+vertex anim -1 vertex bone =
+bone 0.500000 = 0.500000 anim frame
+= -1 bone
+1.0 texture -1 anim -1 vertex
+0.500000
+frame anim 1.0 -1 vertex 1.0
+1.0
+anim 1.0 frame = texture = material
+1.0 -1 1.0 vertex frame vertex -1 texture = frame -1
+material
+material 0.500000
+= texture
+material = = -1 texture
+0.500000
+-1 frame vertex material anim = = 0.500000 = bone = 1.0
+=
+= frame -1
+bone
+0.500000 1.0
+frame 1.0 -1 -1 0.500000 bone material texture =
+vertex material anim 0.500000 0.500000 1.0
+vertex =
+= frame texture bone
+material 0.500000
+0.500000 0.500000 -1 frame
+0.500000 texture
+texture
+vertex
+1.0 texture = anim
+0.500000 0.500000 bone bone -1
+anim
+-1 frame bone texture
+0.500000 = vertex
+-1 bone frame frame texture bone bone
+texture -1 anim frame frame = 0.500000 -1 -1
+-1 1.0
+anim
+-1 anim vertex
+frame
+anim
+texture -1
+texture
+0.500000 bone vertex = anim
+anim 0.500000
+vertex vertex frame frame frame
+texture texture material
+= texture texture
+-1
+-1 0.500000
+= material = = = anim
+1.0 0.500000 material 0.500000 material material texture vertex 0.500000 anim frame vertex material bone anim = = 1.0
+= = anim
+-1 0.500000
+bone -1 0.500000 anim = texture
+-1 frame 0.500000 material bone texture 1.0
+=
+= vertex texture -1 -1 vertex
+0.500000 1.0
+0.500000 material anim frame 1.0 frame
+1.0
+= -1
+vertex -1
+vertex
+-1 vertex
+1.0 anim material 0.500000 frame texture 0.500000 bone
+material frame
+texture
+-1 material = 1.0
+frame frame texture
+0.500000
+0.500000 1.0
+0.500000
+bone
+0.500000 frame anim 0.500000 anim 1.0 = 0.500000
+frame material bone
+material bone
+texture vertex texture texture vertex bone 0.500000
+vertex
+bone frame vertex 1.0 bone bone material bone -1 bone frame
+vertex material anim
+frame texture =
+frame -1 frame bone
+-1
+bone anim
+vertex texture 0.500000 anim anim
+anim
+1.0
+0.500000 frame
+anim bone frame anim
+-1 bone
+0.500000 frame frame anim anim 0.500000 material bone material anim
+frame 0.500000 = = texture
+-1 -1 bone anim
+anim anim vertex -1
+vertex -1 vertex vertex 0.500000 material 0.500000 0.500000 = anim anim bone texture bone =
+frame
+material
+vertex anim
+material 0.500000 frame
+0.500000
+-1 1.0 material material 
\ No newline at end of file
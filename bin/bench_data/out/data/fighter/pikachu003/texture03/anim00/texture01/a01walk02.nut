@@ -0,0 +1,17 @@
+-1 texture 0.500000
+anim anim anim =
+material
+= 0.500000
+bone 0.500000
+-1 bone -1 material frame texture
+-1 bone 0.500000 0.500000
+vertex
+bone bone material 1.0 texture frame texture frame 1.0 0.500000 1.0 1.0 1.0 -1
+anim
+anim = vertex 1.0 texture = 0.500000 =
+-1 vertex frame material bone
+vertex anim material material frame = -1 bone
+= bone bone anim material
+anim material
+-1 frame 1.0 1.0 =
+texture ani
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone
+anim vertex vertex vertex texture
+frame 
\ No newline at end of file
@@ -0,0 +1 @@
+qL3[iYe=t++ORy/mGs1x)o,k|,d[wge .]Z֊R-!$4A ڛ!
\ No newline at end of file
@@ -0,0 +1,8 @@
+vertex
+material -1 =
+bone
+1.0 anim 0.500000 material anim 0.500000 frame 0.500000 material material
+anim
+vertex 1.0 -1 = -1 anim = -1 1.0 anim
+bone 0.500000
+1.0
\ No newline at end of file
@@ -0,0 +1,4 @@
+material anim = bone
+1.0 =
+=
+-1 material frame ve
\ No newline at end of file
@@ -0,0 +1,78 @@
+bone 1.0
+frame texture
+bone vertex -1 =
+texture -1 texture
+anim texture 1.0 texture texture = frame frame 0.500000 material texture material
+1.0
+frame frame frame texture 1.0 anim texture frame -1 =
+bone
+bone -1 anim anim -1 frame vertex
+anim -1 1.0 0.500000 = 0.500000 -1
+= frame 0.500000
+texture
+texture =
+0.500000 = 1.0 vertex bone
+-1 anim 0.500000 vertex anim 1.0 1.0
+vertex
+-1
+0.500000 anim -1
+anim
+bone 1.0
+texture vertex texture
+bone vertex anim -1
+0.500000 frame texture vertex = = anim vertex
+bone = -1 bone
+anim anim 0.500000
+texture bone -1 anim vertex texture frame
+-1 = anim = 0.500000
+0.500000
+vertex
+anim anim texture 0.500000 frame
+-1 frame
+=
+material texture bone -1 0.500000
+= -1
+bone bone 1.0 = -1 = bone
+texture texture -1 anim anim bone material 1.0 1.0 1.0 vertex vertex
+vertex frame
+-1
+1.0 bone
+0.500000 material vertex texture = texture
+texture
+anim = bone material
+texture -1
+bone anim
+vertex texture 0.500000
+= =
+anim
+material anim texture frame 0.500000 bone = 0.500000 material
+anim =
+vertex 0.500000
+0.500000
+vertex bone frame
+bone = anim anim bone vertex bone = 0.500000 vertex frame = 0.500000
+frame 1.0
+frame material -1
+bone
+texture anim
+0.500000 bone frame
+-1 vertex
+material bone 1.0
+anim texture bone
+texture 1.0 frame
+frame frame
+-1 0.500000 frame anim material bone texture texture
+bone
+anim
+1.0 texture material material frame frame vertex
+-1 anim anim
+anim
+anim anim texture vertex
+texture frame vertex 0.500000
+frame
+material material -1 bone vertex vertex -1 =
+= 1.0 bone bone
+vertex 1.0 vertex vertex vertex
+frame = bone
+1.0
+t
\ No newline at end of file
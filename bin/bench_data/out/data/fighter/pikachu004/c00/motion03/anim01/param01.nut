@@ -0,0 +1,64 @@
+-1 -1 -1 0.500000 texture anim bone bone anim
+-1 -1 vertex
+1.0 frame = material bone
+material 1.0 0.500000 0.500000 = = 0.500000 -1 texture material bone
+0.500000
+frame material 0.500000 anim 1.0
+frame bone texture anim -1
+1.0 =
+-1 1.0
+= material 0.500000 = bone 1.0 texture 1.0
+material texture
+material = bone
+frame frame
+material anim anim anim bone vertex
+-1 vertex bone texture anim -1 = bone material anim
+anim 1.0
+0.500000 vertex bone vertex frame
+-1
+frame
+=
+material
+material material
+1.0 anim texture -1 1.0 1.0 material material
+texture
+vertex = frame
+bone 1.0 = vertex material bone material = bone frame
+frame 0.500000 1.0
+1.0
+bone
+texture material anim 0.500000
+1.0
+1.0 0.500000
+1.0 -1 0.500000 0.500000
+vertex
+= =
+material
+anim =
+-1 -1
+material =
+anim
+anim
+material material material texture 0.500000 texture
+frame 1.0
+0.500000 material material -1 -1 frame -1 = vertex 1.0 -1 frame frame material texture texture = texture frame
+vertex = 0.500000 anim material 1.0 -1 0.500000 0.500000
+-1
+vertex 1.0 1.0
+anim material 0.500000
+= bone
+texture
+material material anim -1 vertex
+vertex -1 texture texture = frame
+0.500000
+0.500000 -1
+bone
+= frame 1.0 = bone 1.0 = -1 0.500000 anim 0.500000 1.0 -1 texture
+material vertex material texture -1 1.0 material anim texture
+1.0 texture texture material frame vertex =
+1.0
+material bone -1 texture material 1.0 material frame frame 0.500000 0.500000 1.0 material material vertex bone -1 bone frame anim bone texture
+texture vertex 1.0 texture 1.0
+anim texture -1 -1 frame vertex frame anim anim frame
+bone frame vertex -1 1.0
+frame 0.5
\ No newline at end of file
@@ -0,0 +1,10 @@
+-1 0.500000 0.500000 -1 1.0
+material anim 1.0
+0.500000
+0.500000 vertex anim
+vertex bone vertex vertex anim frame vertex bone
+bone
+texture 0.500000 vertex
+-1 vertex anim frame
+frame
+texture 0.5000
\ No newline at end of file
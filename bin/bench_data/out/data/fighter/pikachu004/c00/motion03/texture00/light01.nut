@@ -0,0 +1,42 @@
+= bone 0.500000 texture texture
+material frame material 0.500000 -1
+anim 0.500000 vertex
+texture vertex =
+material 1.0
+=
+-1 -1 0.500000
+texture bone texture
+0.500000
+anim bone frame anim
+texture frame material 1.0 anim material texture bone -1 bone frame -1
+= texture vertex texture vertex -1 0.500000
+-1
+material texture = 0.500000
+vertex
+-1 -1
+1.0 1.0 1.0
+= frame vertex bone = bone texture anim
+material bone -1 vertex = 0.500000 frame = texture
+-1 texture 1.0 bone = -1 vertex
+vertex = anim -1 material -1 =
+0.500000 frame texture
+=
+frame
+material
+0.500000 vertex anim -1 -1 anim anim material =
+anim
+material = anim
+texture
+texture -1 1.0
+material texture
+=
+material 1.0 0.500000 -1 1.0 vertex material frame frame material
+material vertex
+texture
+frame
+-1 anim vertex =
+material = 1.0
+anim
+1.0
+vertex = anim frame vertex
+-1 bone = -1 
\ No newline at end of file
@@ -0,0 +1,23 @@
+= 0.500000 0.500000 frame vertex bone
+-1
+1.0 1.0 bone 0.500000 1.0 anim material vertex texture
+texture anim frame vertex bone
+0.500000 material texture anim texture = 0.500000 0.500000 frame material -1 -1 frame
+texture = texture
+vertex -1
+material
+vertex vertex
+material bone material bone anim 1.0
+anim 1.0
+-1 = 0.500000 texture 0.500000
+1.0 bone -1 anim vertex texture
+-1 material -1 texture frame anim
+-1 bone frame texture 1.0 frame 0.500000
+bone -1 vertex frame bone bone bone 0.500000 -1 bone texture texture
+-1
+texture
+=
+material
+= texture texture bone
+bone texture
+bone -1 anim anim = 
\ No newline at end of file
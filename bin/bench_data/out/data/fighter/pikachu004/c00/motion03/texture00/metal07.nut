@@ -0,0 +1,12 @@
+anim vertex -1
+0.500000 frame material frame -1
+0.500000
+material material vertex
+bone
+material
+= = = 1.0 bone anim anim 1.0 bone 1.0 texture
+material -1 vertex = -1
+texture
+-1 material vertex
+1.0
+material texture 1
\ No newline at end of file
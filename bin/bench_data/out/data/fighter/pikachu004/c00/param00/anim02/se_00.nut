@@ -0,0 +1,72 @@
+texture
+material anim -1 frame bone -1
+1.0
+=
+anim material bone
+1.0 material
+= material bone
+anim anim vertex = = bone -1
+frame vertex 1.0 anim
+1.0 bone texture
+1.0 anim 1.0 bone texture bone =
+-1 1.0
+=
+anim
+bone
+0.500000 0.500000 -1 texture texture 0.500000
+1.0
+material bone frame 0.500000 bone anim -1 bone material frame anim material
+vertex bone vertex
+material texture frame
+1.0 -1 vertex vertex
+-1
+1.0
+texture vertex vertex bone
+vertex =
+anim 0.500000 bone vertex material bone frame
+bone
+frame frame
+vertex frame
+0.500000
+bone 1.0
+bone -1 bone 1.0 material 0.500000 frame 1.0 =
+1.0
+anim -1 anim 0.500000 0.500000 frame 0.500000 material bone
+texture texture vertex
+bone
+vertex 0.500000 bone =
+1.0 texture = texture
+1.0 0.500000
+texture frame
+bone frame -1
+anim vertex 0.500000 =
+=
+vertex anim frame 0.500000
+bone bone anim material bone frame frame texture
+bone = 0.500000 material =
+material anim texture 0.500000 anim 1.0 texture
+-1 0.500000 0.500000 1.0
+frame
+1.0 1.0 bone bone material bone anim 1.0 material 1.0 0.500000 frame 1.0
+1.0 = -1 bone anim bone
+texture bone frame frame 1.0 anim 0.500000 bone material bone texture texture = material
+0.500000 frame bone = vertex -1 bone
+material vertex
+= -1 -1 1.0 -1 vertex 0.500000 anim material frame bone vertex 1.0 -1 bone material -1 0.500000 = material bone -1 anim
+bone anim = vertex texture -1 bone = anim
+frame texture bone frame
+texture bone vertex = texture vertex
+texture anim 0.500000 bone bone -1 1.0
+1.0 texture -1 =
+1.0 0.500000
+texture anim texture
+-1 bone
+texture
+vertex bone
+-1 bone
+bone
+1.0 1.0 vertex bone 0.500000 material bone frame texture bone -1 0.500000 anim = bone
+-1 0.500000 0.500000 texture
+frame anim
+vertex
+materi
\ No newline at end of file
@@ -0,0 +1,4 @@
+texture 1.0 = 1.0
+0.500000
+frame 0.500000
+frame bone 0.500000 1.0 materia
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 material
+0.500000 -1 =
+frame 1.0 bone material 1.0
\ No newline at end of file
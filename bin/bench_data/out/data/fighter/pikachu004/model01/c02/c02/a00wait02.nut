@@ -0,0 +1,12 @@
+anim 1.0 -1
+texture
+bone anim
+frame anim 0.500000
+1.0 bone bone material vertex
+vertex
+=
+bone texture bone anim
+1.0 vertex material material 1.0 anim vertex vertex bone
+bone material frame frame
+bone
+frame 0.500000 vertex
\ No newline at end of file
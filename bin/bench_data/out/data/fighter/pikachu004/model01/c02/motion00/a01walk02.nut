@@ -0,0 +1,164 @@
+0.500000
+frame 0.500000 texture 1.0 vertex =
+texture texture 0.500000
+1.0 frame bone = texture -1 anim material bone
+0.500000 texture -1 1.0 texture 0.500000 1.0
+= = frame 1.0
+frame material material frame -1 -1 =
+anim -1 material material
+anim anim
+anim texture
+frame bone frame
+bone -1
+frame 0.500000 texture 0.500000 bone anim 1.0 0.500000
+0.500000 = 0.500000 frame material bone
+material vertex texture =
+= 0.500000 bone
+= 0.500000 0.500000 bone 1.0
+1.0
+bone = = material 0.500000
+vertex
+bone
+material
+material
+material -1
+anim =
+texture
+1.0 0.500000
+frame -1 0.500000 frame anim frame anim = material anim bone -1
+0.500000
+1.0
+= 1.0 -1 = 1.0 bone
+texture 1.0
+texture -1 vertex 1.0 1.0 -1
+vertex frame
+material vertex 1.0 material
+vertex
+vertex
+vertex texture material
+bone -1
+vertex material 0.500000 bone -1
+= -1 frame
+1.0 bone anim 0.500000 anim 1.0 texture 0.500000 material vertex anim texture
+=
+1.0
+0.500000 vertex
+=
+anim -1 anim -1 texture
+= frame = anim bone
+frame
+0.500000
+vertex -1 frame 1.0 = frame material texture vertex material texture =
+1.0
+0.500000 -1
+anim =
+frame material
+=
+bone
+frame bone material anim 0.500000 0.500000
+= 0.500000
+-1 vertex = 1.0 1.0 anim vertex bone -1
+anim -1
+vertex frame 1.0 vertex = vertex anim
+-1
+anim -1 -1 0.500000 1.0
+material frame
+texture = material
+vertex texture frame bone anim anim -1 1.0
+vertex frame texture = frame
+texture anim
+texture vertex frame bone 1.0
+vertex frame
+bone material
+= anim -1 texture 0.500000 = -1 = 0.500000 =
+frame material = bone
+1.0 -1 anim
+material = texture material vertex material =
+frame anim -1 1.0 = material
+anim
+-1
+bone frame vertex -1 1.0 -1 bone
+frame texture 0.500000
+=
+1.0 anim -1 vertex 0.500000
+1.0 texture material texture
+= vertex
+0.500000 material
+texture material frame
+material vertex -1 frame bone texture = vertex
+-1 -1 anim texture texture bone -1 bone
+bone material texture material frame vertex anim
+-1 vertex
+bone -1 =
+texture bone frame
+bone 0.500000
+frame frame 0.500000 -1 bone texture = material frame
+-1 0.500000 frame = frame 1.0 -1 texture texture vertex = bone 1.0 bone -1 anim
+0.500000 anim
+frame =
+1.0 anim 1.0 -1 = = bone vertex anim frame bone material 0.500000 frame bone
+frame texture
+texture material texture anim frame texture
+bone 1.0 0.500000 material -1 texture
+1.0 0.500000 texture vertex frame bone anim frame texture
+material 0.500000
+0.500000 bone bone
+0.500000 -1
+material frame anim 1.0 0.500000
+material 1.0 texture
+0.500000 anim texture 0.500000
+1.0
+material
+-1 texture -1 -1
+0.500000
+texture 1.0 0.500000 anim 1.0 anim
+frame texture texture material vertex texture 0.500000 -1 vertex
+frame
+frame bone
+bone -1
+frame = 0.500000 0.500000 -1 0.500000
+0.500000 anim
+frame anim vertex 0.500000 1.0
+bone
+anim frame frame texture 1.0
+material anim material material bone
+bone -1 = -1
+material frame bone
+1.0
+anim 1.0 bone
+anim anim anim
+1.0 bone
+1.0 1.0 bone frame -1 = bone 1.0
+anim vertex frame frame 0.500000 bone = frame vertex material 0.500000 material = anim bone 0.500000 bone 1.0 material anim
+1.0 frame material
+anim frame
+=
+1.0 frame material frame
+1.0 = texture 0.500000 -1 bone
+texture
+-1 vertex 0.500000
+texture
+= vertex
+0.500000
+= 0.500000 bone
+-1 vertex material bone anim frame
+1.0 -1
+0.500000
+0.500000
+material texture bone -1 anim texture 1.0
+anim anim -1 1.0 texture
+bone
+-1 material 0.500000 anim = 0.500000 vertex anim material 0.500000 vertex texture material
+=
+anim frame texture 1.0 = vertex bone texture = material 0.500000 1.0 = material texture
+bone texture
+texture 0.500000
+anim = texture vertex bone =
+1.0 1.0 = vertex -1 bone anim -1 0.500000 vertex
+bone frame anim
+0.500000 1.0 texture frame texture 1.0 -1 0.500000
+-1
+bone -1 vertex frame frame vertex texture anim 1.0 0.500000 material bone vertex 1.0 texture frame vertex
+texture
+-1
+1.0 texture = texture = texture 0.500000 bone 
\ No newline at end of file
@@ -0,0 +1,7 @@
+= 1.0 anim
+bone
+texture -1 = bone
+1.0 -1
+-1 0.500000 anim
+bone 1.0 vertex 0.500000 frame vertex -1 = =
+= vertex fra
\ No newline at end of file
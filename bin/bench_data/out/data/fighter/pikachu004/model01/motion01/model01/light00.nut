@@ -0,0 +1,13 @@
+= frame vertex vertex vertex material
+texture material
+-1 material = -1 = = = texture vertex bone bone
+texture -1 texture
+texture material vertex anim material
+= bone -1 0.500000 0.500000 -1 0.500000
+0.500000
+anim texture
+anim = frame -1 = 0.500000 vertex texture
+texture =
+anim bone
+bone material frame
+anim -1 -1
@@ -0,0 +1,4 @@
+texture =
+vertex material 1.0
+material material = texture
+t
\ No newline at end of file
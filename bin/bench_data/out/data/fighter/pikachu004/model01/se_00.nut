@@ -0,0 +1,99 @@
+= 0.500000 frame frame 1.0
+texture = material material
+anim = bone vertex
+bone
+0.500000 vertex bone texture anim frame frame = 1.0 vertex
+texture
+material
+bone vertex vertex anim
+anim =
+1.0 = vertex vertex
+frame anim material -1
+material 1.0 texture = 1.0 frame bone bone -1
+1.0 bone bone 0.500000 -1
+texture material anim
+bone vertex 0.500000 bone 0.500000 =
+material bone
+=
+bone
+0.500000
+anim material
+bone -1 texture
+-1 frame -1 0.500000 0.500000 material texture vertex frame frame material frame 1.0 0.500000 texture frame texture 1.0
+= texture texture anim = 1.0 anim
+= bone vertex anim
+0.500000 texture bone
+=
+anim texture 1.0 = texture 0.500000
+bone
+texture bone vertex -1
+0.500000 material 1.0 anim texture vertex
+1.0 bone bone
+1.0 bone
+1.0
+frame 0.500000 = vertex
+material texture = vertex =
+vertex = 1.0 frame vertex bone
+texture
+anim bone 0.500000
+texture material
+texture 1.0 1.0 0.500000 anim -1 bone -1
+-1 = material -1 texture
+bone bone texture -1
+=
+frame vertex = 0.500000
+bone
+texture 1.0 bone frame
+1.0 frame
+0.500000 anim
+-1
+0.500000 1.0 =
+1.0 texture = = texture vertex frame
+material texture -1 texture material frame texture =
+0.500000 bone frame
+-1
+anim
+-1 0.500000 vertex 1.0 material vertex vertex -1 bone 1.0 anim
+0.500000 =
+frame frame 0.500000 frame frame frame material = = vertex material = -1
+=
+anim frame = material material
+frame
+material frame
+1.0 material = bone 0.500000
+frame = vertex 1.0
+anim 1.0 1.0 anim anim
+0.500000 = -1 vertex = vertex material texture frame
+vertex vertex 0.500000 vertex =
+1.0
+material
+anim texture vertex frame
+vertex
+-1 material vertex
+bone bone -1 frame
+frame =
+= 0.500000 texture 1.0 vertex anim 0.500000
+texture
+=
+texture vertex 0.500000
+vertex anim -1
+texture -1 -1 frame material = = material anim 1.0 vertex bone
+1.0
+frame
+-1 texture texture -1 material
+= 1.0 vertex
+-1 anim texture bone
+material
+-1 anim frame 1.0
+material texture
+texture -1 frame 1.0 0.500000
+frame bone texture anim vertex -1 anim vertex 0.500000 1.0 material texture = vertex
+material = anim material 0.500000 1.0
+texture =
+0.500000 0.500000 material
+-1 bone
+texture 1.0 -1 1.0
+= = frame vertex 1.0 -1 frame bone texture material
+frame
+vertex 1.0 bone -1
+material 0.500000 0.500000
\ No newline at end of file
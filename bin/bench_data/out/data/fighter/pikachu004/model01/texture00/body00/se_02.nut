@@ -0,0 +1,17 @@
+vertex texture 1.0
+texture anim anim 0.500000
+anim -1 vertex 1.0 -1 texture material frame 0.500000 material anim frame 1.0 bone bone material
+anim vertex -1 bone 0.500000 =
+anim
+1.0
+0.500000 vertex = frame texture
+-1
+texture anim texture frame 1.0 = anim frame 0.500000 = -1 frame material
+texture 0.500000
+-1 1.0 0.500000 1.0 anim bone 1.0
+frame
+1.0
+vertex anim frame -1 0.500000
+0.500000 bone 0.500000
+vertex
+= frame 1.0 ve
\ No newline at end of file
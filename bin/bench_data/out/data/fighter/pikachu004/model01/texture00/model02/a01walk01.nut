@@ -0,0 +1,65 @@
+=
+frame
+= texture 1.0 0.500000
+material
+0.500000 = = texture -1 texture vertex 0.500000
+1.0 0.500000 texture vertex 0.500000 0.500000 0.500000 bone vertex material anim
+0.500000
+texture 0.500000 -1 -1
+frame
+material bone
+material texture =
+0.500000 vertex
+0.500000
+texture = texture -1 texture -1
+bone
+-1
+vertex vertex
+vertex -1 anim texture texture texture
+1.0
+1.0 1.0
+vertex 1.0 0.500000 = = 0.500000 material texture 1.0 0.500000 0.500000 -1 1.0 bone vertex material = texture -1 texture
+frame vertex anim -1 = 1.0
+texture texture -1 material 1.0 1.0 material 0.500000 texture -1 anim 0.500000 material
+-1 -1 1.0
+vertex -1
+material texture anim bone frame = =
+bone
+texture material 1.0 1.0 0.500000 vertex 1.0 0.500000 1.0 frame 1.0 texture anim vertex
+anim 1.0
+texture
+texture 1.0 1.0
+-1 frame -1 =
+frame 1.0
+0.500000 anim
+bone -1 1.0 material = -1
+-1 = bone
+material 1.0
+= = 0.500000 bone anim -1 vertex anim bone
+=
+-1 bone
+1.0 anim frame anim
+material material 1.0 texture anim 0.500000 -1
+frame texture 1.0 frame vertex frame anim 1.0 frame
+0.500000 texture -1 frame material
+texture
+= vertex -1 = -1 1.0 bone
+-1 frame 1.0 -1 = bone anim = = 1.0 0.500000 material -1 -1 0.500000 0.500000
+=
+1.0 =
+bone frame frame anim bone 0.500000 texture texture texture
+anim 1.0 material bone -1
+vertex
+-1 -1 -1 frame
+bone texture texture texture -1 -1 -1 -1
+vertex bone frame
+vertex bone bone material texture
+0.500000 -1 -1
+anim texture material material
+anim bone = material bone frame = anim texture texture bone frame texture -1
+material -1
+material
+1.0
+material -1 frame texture
+bone texture texture frame
+vertex bone f
\ No newline at end of file
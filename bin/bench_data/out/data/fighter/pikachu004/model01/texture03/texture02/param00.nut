@@ -0,0 +1,118 @@
+texture vertex vertex
+bone frame vertex texture anim -1 0.500000 = bone -1 -1 anim
+bone vertex vertex vertex 1.0 anim anim frame anim -1 = texture anim
+= anim
+-1 0.500000
+frame -1
+-1
+texture 1.0
+= frame bone -1 frame texture texture
+1.0 = vertex
+material
+1.0 -1 1.0 frame vertex texture bone bone texture 0.500000
+texture
+vertex 1.0 1.0
+frame bone 1.0 = vertex
+0.500000
+1.0 material
+0.500000 vertex anim material frame -1 0.500000 = bone -1 0.500000 material
+anim 1.0 anim frame material texture 1.0
+vertex bone 1.0 1.0 bone anim
+frame
+-1 vertex 0.500000
+material material anim 1.0 frame 1.0 material vertex = anim =
+1.0
+bone -1 = anim -1 bone bone 0.500000 material
+anim 1.0 1.0 texture texture
+texture 1.0 = anim =
+-1
+material -1 vertex bone -1 texture bone
+-1
+frame vertex vertex texture
+1.0 frame anim
+-1 0.500000 0.500000
+= vertex 1.0 -1
+frame texture
+vertex material
+texture material vertex = vertex
+material frame
+frame anim
+= 0.500000 vertex
+-1 =
+texture anim
+0.500000 texture material material
+bone -1 texture
+0.500000 anim frame
+texture anim
+bone
+= anim bone frame material texture 1.0 texture vertex vertex
+texture
+vertex 0.500000 frame
+-1 bone 0.500000 frame frame -1 0.500000 = material 0.500000 texture vertex 1.0
+1.0 material =
+0.500000 1.0 texture anim texture = 1.0 1.0 frame = 0.500000 material frame 0.500000 material texture 0.500000 -1 = 0.500000 texture bone
+0.500000
+1.0
+-1 anim
+material = 1.0
+bone anim = 0.500000
+anim
+-1 = 1.0
+material 0.500000 0.500000
+anim =
+= frame texture
+vertex -1 0.500000
+-1 anim
+1.0 =
+0.500000 0.500000 material 0.500000 frame 1.0 bone -1 1.0 bone anim bone material
+material frame 1.0
+vertex
+material
+= = frame anim vertex
+= texture vertex frame 0.500000 anim frame frame 1.0 material 0.500000 bone vertex 1.0
+anim vertex bone
+anim texture 1.0 bone 0.500000 material
+texture texture -1
+vertex texture
+material = frame texture
+frame 0.500000 frame vertex 0.500000 frame texture vertex anim = anim = frame 0.500000 frame
+anim
+anim anim frame
+material texture
+= = texture vertex vertex 1.0 1.0
+vertex bone 1.0
+-1 0.500000
+-1
+texture
+0.500000 1.0 texture
+texture
+-1 vertex bone material vertex bone 1.0 1.0 = -1
+vertex 1.0
+material frame material
+-1 = vertex texture
+frame vertex anim frame 1.0 vertex
+material
+vertex material = -1 texture
+bone vertex anim 0.500000 frame 1.0 material
+material -1 1.0 texture
+-1 bone vertex 0.500000
+= 0.500000
+vertex texture anim
+-1 0.500000
+0.500000 anim bone
+-1
+0.500000 -1 frame -1 anim
+texture vertex 1.0 = frame bone
+vertex -1
+1.0 0.500000 -1 material
+=
+0.500000 =
+=
+-1 0.500000
+= 0.500000
+= bone -1 = bone 1.0 frame material material
+anim 0.500000 -1
+anim frame 0.500000 = material material
+bone bone
+frame 0.500000 -1 anim = bone
+-1 ma
\ No newline at end of file
@@ -0,0 +1,15 @@
+texture = -1 vertex
+vertex
+frame -1 anim 1.0 frame
+texture = 0.500000 1.0
+=
+0.500000 frame 1.0 0.500000 bone
+frame -1 frame texture
+= texture 1.0 vertex
+vertex anim
+= 0.500000 1.0 = vertex bone -1 frame
+-1 vertex vertex material anim texture 0.500000 1.0 1.0 frame bone frame -1 = texture = 1.0 1.0 0.500000 0.500000 1.0 anim
+texture bone bone vertex
+frame
+anim
+bone vertex
\ No newline at end of file
@@ -0,0 +1,36 @@
+1.0
+0.500000 bone material
+frame -1 1.0 =
+1.0 = frame
+anim
+-1
+0.500000 frame
+-1 texture anim material =
+vertex 1.0 material anim anim
+-1 = texture material
+frame frame material anim -1
+1.0 0.500000 frame -1 frame frame material
+frame material bone 0.500000 texture anim vertex material -1
+0.500000 =
+vertex 1.0 1.0 frame = -1
+texture anim 1.0 = 0.500000 1.0 bone = -1 -1
+material material 1.0 frame frame texture material =
+material
+1.0 texture vertex
+material 0.500000
+anim -1 =
+bone frame texture
+-1 texture vertex
+anim
+= material
+texture material bone
+1.0 1.0
+bone
+0.500000 texture frame material bone
+material 0.500000 = bone texture
+texture frame
+frame frame 0.500000 material material -1 vertex anim texture vertex
+anim bone material
+bone = = frame frame anim
+anim
+= 0.500000 frame frame -1 -1 
\ No newline at end of file
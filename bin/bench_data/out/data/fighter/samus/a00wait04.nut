@@ -0,0 +1,5 @@
+-1 texture
+material
+-1 bone
+-1
+material vertex te
\ No newline at end of file
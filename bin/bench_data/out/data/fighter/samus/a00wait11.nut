@@ -0,0 +1,2 @@
+0.500000 1.0 -1 0.500000 vertex frame
+-1
\ No newline at end of file
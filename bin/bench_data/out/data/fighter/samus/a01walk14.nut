@@ -0,0 +1,85 @@
+0.500000 anim
+vertex vertex -1 material bone frame
+1.0 -1 vertex 1.0 texture = vertex frame
+1.0
+bone 1.0 anim
+material 0.500000 material 1.0
+texture
+vertex bone frame 0.500000
+vertex frame frame = -1
+0.500000 -1 0.500000 0.500000 1.0 anim material vertex anim bone material 0.500000 = vertex material
+0.500000
+vertex anim bone
+1.0
+frame
+texture =
+1.0 vertex vertex 0.500000 frame 0.500000 -1 vertex 0.500000 material anim 0.500000 material
+texture frame material bone 1.0 0.500000 bone -1 1.0
+0.500000 0.500000 0.500000 -1 anim -1
+vertex
+0.500000 texture bone =
+= -1 = texture 0.500000 anim
+texture -1 material = material anim anim material -1 texture 1.0
+= = vertex 0.500000 -1
+frame frame
+1.0 vertex
+1.0 frame
+material bone -1 bone bone material
+1.0 material
+-1
+1.0
+= 1.0 0.500000 frame texture 0.500000 0.500000 -1 anim anim material 0.500000
+1.0 bone 1.0 -1
+vertex vertex vertex
+frame texture -1 = -1 frame
+1.0 1.0
+-1 bone
+= bone anim = -1 = frame material texture bone anim anim
+material bone vertex frame anim anim 0.500000 0.500000 1.0 texture texture texture
+vertex -1
+vertex bone 1.0
+bone
+1.0
+texture -1 anim frame material 0.500000
+0.500000
+0.500000 anim
+1.0 texture
+1.0 texture bone material =
+0.500000 0.500000 texture -1 1.0 = vertex
+anim 0.500000 material texture 0.500000 bone frame material texture vertex texture
+bone = bone texture vertex
+0.500000 anim anim texture anim vertex anim
+= -1 texture -1 texture frame vertex
+material = bone 0.500000
+= =
+texture bone -1 = vertex material 0.500000 = 0.500000 frame
+-1 texture = 0.500000 anim vertex material bone anim frame bone vertex material 0.500000 -1
+vertex =
+material bone = 1.0 0.500000 material 0.500000 anim
+frame 1.0 0.500000 -1 bone
+=
+bone -1 frame texture
+1.0 -1 0.500000 = vertex 0.500000 texture
+bone 1.0 material
+frame texture frame 1.0 material frame
+vertex texture 1.0 texture
+1.0 texture -1 anim = 0.500000 texture 1.0 -1 0.500000 = anim 0.500000 vertex anim texture 0.500000
+-1 0.500000 = vertex vertex anim 0.500000 -1 material texture
+= =
+anim -1 1.0 = -1 texture 1.0 anim
+-1 texture material texture
+1.0
+-1 =
+-1 frame texture bone 0.500000 1.0 vertex vertex =
+frame
+1.0
+vertex
+bone 1.0
+texture material material vertex vertex frame
+0.500000
+0.500000 0.500000 = anim
+bone vertex
+1.0 1.0 bone
+frame
+anim
+0.
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex bone
+0.500000 texture vertex anim -1 bone frame
+bone frame bone = 
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 vertex
+0.500000
+1.0
+bone anim 1.0
+anim texture frame
+material bone frame texture = bone 1.0 = 0.500000 1.0 anim frame anim anim 
\ No newline at end of file
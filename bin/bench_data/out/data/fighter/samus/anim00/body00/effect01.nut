@@ -0,0 +1,149 @@
+texture material anim anim 1.0 0.500000 = anim
+anim = = anim
+=
+texture
+anim material
+bone vertex 1.0 frame
+1.0 texture
+0.500000
+1.0 =
+frame
+frame
+material texture bone material
+0.500000
+=
+= 1.0 bone -1 material -1 texture
+vertex texture
+1.0 anim texture
+texture 0.500000
+anim bone
+frame material vertex bone
+material
+bone bone texture
+0.500000 1.0
+material 1.0 0.500000 1.0 texture
+frame 0.500000 0.500000 texture anim = bone
+1.0
+material
+bone 1.0 -1 texture vertex
+0.500000 bone texture 1.0 vertex anim
+anim 0.500000
+= vertex 0.500000 = material -1
+texture 1.0
+= texture texture texture 0.500000
+material
+frame vertex vertex vertex material
+texture frame material
+frame
+frame vertex material 0.500000 vertex
+bone vertex = anim 0.500000 -1 = = bone = frame = = 1.0 -1 texture bone bone texture
+bone 0.500000 frame bone material
+frame anim -1
+-1 vertex
+0.500000 -1 = -1 material
+1.0 1.0 =
+anim 0.500000
+vertex material vertex vertex 1.0 1.0 = frame
+-1 = 0.500000 = = -1 1.0 texture material
+anim
+texture -1 material 1.0 texture
+-1 0.500000 -1
+vertex frame anim anim
+texture texture vertex material
+-1 0.500000
+anim material 1.0
+vertex texture
+vertex -1 0.500000 =
+frame 0.500000 1.0 -1 1.0
+bone =
+texture = texture anim bone -1
+-1 texture
+anim = -1 material texture anim frame 1.0 bone material 0.500000 anim texture -1
+frame bone 0.500000 1.0 -1 0.500000 = material material bone
+frame
+0.500000 0.500000 frame 1.0
+0.500000 vertex
+anim 1.0
+material 1.0
+vertex texture 0.500000 anim frame 0.500000 material 0.500000 bone 1.0 anim
+bone bone texture texture -1
+0.500000 frame vertex bone 0.500000 texture 1.0 material = texture = 0.500000 0.500000 texture -1 1.0
+1.0 material = bone bone bone 0.500000
+texture
+material 1.0
+anim texture anim vertex bone material bone
+-1 bone frame bone
+frame 0.500000 vertex anim
+vertex frame 0.500000 0.500000 bone =
+0.500000 texture
+material 0.500000 -1
+1.0 frame 0.500000 =
+anim vertex -1 anim = =
+bone -1 material anim frame material bone
+material
+bone = 0.500000 vertex anim
+1.0 =
+texture texture texture 0.500000 1.0 vertex
+0.500000 texture = bone anim -1
+texture
+-1 -1 texture 0.500000
+anim = -1 =
+anim
+texture frame
+bone bone
+texture vertex texture =
+material 1.0 = -1 material 1.0 1.0
+anim texture anim texture 0.500000 =
+anim -1
+material material
+material material anim texture material
+texture 1.0 1.0 0.500000 1.0 -1 bone
+frame anim
+bone anim
+frame
+1.0 bone -1 material
+frame material anim frame
+texture anim anim bone texture -1 vertex anim
+vertex 1.0 anim
+vertex frame
+material
+frame bone -1 =
+texture =
+= = material
+vertex = 0.500000 material material
+texture
+frame = bone vertex
+bone anim anim
+-1
+frame
+bone frame -1
+anim
+= = 0.500000 1.0 anim 0.500000 frame frame anim
+anim material
+bone texture 1.0 texture
+material vertex anim anim
+frame -1
+material bone texture texture bone -1
+frame -1
+anim frame 1.0
+1.0 material
+1.0 =
+anim anim anim
+0.500000 1.0 material texture vertex
+1.0
+frame material 0.500000 texture 0.500000
+vertex
+-1
+-1 0.500000
+=
+1.0
+vertex material material -1 0.500000
+vertex
+vertex vertex = vertex frame 0.500000 texture bone
+bone vertex anim anim
+frame -1
+texture
+bone 1.0
+anim material material frame bone
+= 0.500000
+-1 texture vertex 0.500000 = tex
\ No newline at end of file
@@ -0,0 +1,40 @@
+material frame texture vertex material texture anim = material
+1.0 -1 bone texture anim texture
+=
+texture
+= anim -1 -1
+texture
+frame 1.0 0.500000 = material
+= = frame vertex
+bone = = 1.0 1.0 material = material -1
+frame
+texture vertex frame material 1.0 1.0
+material bone -1 frame
+frame
+-1 0.500000 texture texture
+=
+-1 vertex
+frame vertex -1 material texture material material vertex
+vertex vertex texture 0.500000 anim anim bone vertex vertex
+anim
+vertex = frame 0.500000 anim 1.0 material material vertex
+texture -1 bone material material 0.500000 -1 texture vertex 1.0 vertex = bone material bone
+= texture
+frame 1.0 1.0 texture
+1.0 texture texture = frame vertex
+vertex texture 1.0 1.0 1.0 -1 0.500000 bone
+1.0 0.500000
+vertex -1 material bone material frame bone material anim
+material texture -1 material -1
+anim 0.500000 frame 0.500000 frame texture
+anim 1.0 1.0 anim texture = bone
+1.0 bone material 0.500000
+texture 1.0 0.500000
+frame material
+0.500000 material texture anim bone 0.500000
+-1 1.0
+material vertex bone material = = anim
+bone = texture
+anim texture material = 1.0 material anim = 1.0 bone -1 vertex anim frame vertex
+0.500000 0.500000
+1.
\ No newline at end of file
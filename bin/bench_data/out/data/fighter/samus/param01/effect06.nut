@@ -0,0 +1,4 @@
+texture material anim
+0.500000 = bone 0.500000
+vertex vertex texture = bone
+bone frame textu
\ No newline at end of file
@@ -0,0 +1,9 @@
+frame
+0.500000
+vertex bone
+= frame texture vertex texture
+-1 bone -1 vertex
+vertex material bone
+vertex
+frame
+ve
\ No newline at end of file
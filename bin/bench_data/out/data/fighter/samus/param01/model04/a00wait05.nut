@@ -0,0 +1,22 @@
+texture texture bone frame material material 0.500000 bone 0.500000 material
+-1
+0.500000
+anim frame frame
+= -1 0.500000 = = bone
+0.500000 vertex
+vertex material texture vertex
+material vertex
+= anim material
+vertex
+vertex
+material material 0.500000 -1 vertex anim
+anim
+anim
+bone
+0.500000 bone texture
+vertex
+bone 1.0 1.0 1.0 -1 0.500000 bone
+texture bone material material
+0.500000 1.0
+material = 0.500000
+verte
\ No newline at end of file
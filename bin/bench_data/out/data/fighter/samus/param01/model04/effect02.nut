@@ -0,0 +1,48 @@
+material
+bone -1
+material material
+material
+anim 0.500000
+material
+material 1.0
+material 1.0 1.0 1.0
+material 1.0 = material frame
+1.0
+0.500000 = -1 frame =
+1.0 =
+material = vertex bone texture = -1
+material texture material
+0.500000 texture -1 anim = 0.500000 = material
+vertex 0.500000 anim
+frame material
+bone 1.0 1.0 bone 1.0 1.0 vertex bone
+frame frame -1
+= 1.0 vertex anim material vertex 0.500000 material frame texture anim bone bone
+= = 1.0
+anim 1.0
+anim frame
+= material
+anim material = 0.500000
+vertex anim 1.0 -1 0.500000 vertex vertex 1.0 =
+texture -1 frame
+anim =
+0.500000 anim texture 0.500000
+0.500000 = bone = vertex = vertex -1
+texture frame material = texture frame 1.0 material 1.0
+-1 bone texture texture frame 0.500000 texture bone texture vertex
+= -1 -1 anim bone 1.0 vertex = 1.0 0.500000 anim
+bone -1 0.500000
+bone material 1.0 0.500000 texture 0.500000 texture bone = = -1 frame texture = = = texture bone anim anim frame texture anim -1
+anim anim 0.500000 anim 1.0 0.500000
+0.500000 texture = = vertex 0.500000 frame material material material
+texture -1 material material
+vertex material
+-1 -1 0.500000 1.0 bone
+material 1.0 material
+= = vertex texture
+texture
+bone
+bone -1 frame bone
+frame -1 material anim
+frame =
+vertex vertex anim anim
\ No newline at end of file
@@ -0,0 +1,99 @@
+0.500000 frame
+vertex 0.500000
+= vertex anim texture
+material
+vertex material = anim
+material
+vertex
+anim bone material -1 =
+0.500000 1.0 anim frame anim
+-1
+-1
+1.0 0.500000
+anim
+= material = texture texture
+1.0
+0.500000 -1 material -1 1.0 = texture
+texture anim bone
+= bone anim texture vertex
+frame
+bone 1.0
+material
+bone texture -1
+vertex 1.0
+0.500000 vertex
+material texture texture = = frame frame
+vertex vertex 1.0 anim anim material
+-1 material 1.0 = 0.500000
+texture 1.0 vertex
+material =
+vertex 0.500000 texture bone = frame 0.500000 1.0
+bone texture vertex frame -1 frame 1.0 texture anim frame anim = 1.0 material -1 material = vertex 1.0
+texture bone texture 1.0 =
+=
+0.500000
+0.500000
+texture 0.500000
+frame texture = 0.500000 anim 1.0
+texture texture = 0.500000 texture vertex 1.0 texture
+vertex material 0.500000
+frame
+1.0 anim frame texture vertex material
+bone bone 1.0 = material texture 1.0
+bone bone texture material anim
+vertex texture 0.500000 texture material anim
+0.500000 -1 frame -1 anim 1.0
+anim
+anim
+anim material material = 1.0
+1.0 vertex bone
+texture vertex vertex -1 -1
+-1 vertex
+-1 texture vertex =
+vertex 1.0 vertex
+-1 texture texture bone = 0.500000 0.500000 frame vertex = 1.0
+material bone anim bone texture =
+bone = frame texture -1 material vertex bone bone
+texture
+vertex material = = vertex 1.0 anim material
+= 0.500000 bone
+bone
+bone 0.500000 bone 0.500000 texture vertex anim 0.500000 -1 material 1.0 1.0 anim anim
+-1 vertex frame 1.0
+anim
+-1 1.0 material
+-1 bone material 0.500000 bone
+= texture frame frame material
+material frame anim frame material bone -1 0.500000 -1 1.0 1.0 anim 0.500000 = 0.500000 1.0 texture vertex
+0.500000 -1 texture =
+-1 = = texture material material
+1.0 anim
+1.0
+vertex material vertex
+1.0 material -1 0.500000
+frame
+anim -1
+0.500000 texture
+=
+bone -1 -1 texture 1.0
+1.0 bone -1 0.500000 =
+texture -1 1.0 texture frame 0.500000
+vertex
+anim = material material bone =
+material 0.500000 material
+bone -1 texture
+-1 0.500000 -1 texture anim 1.0 anim material texture material = = material -1 bone frame
+0.500000
+texture -1 bone
+anim
+1.0 0.500000 = vertex frame 0.500000
+frame bone anim material
+1.0 1.0 material
+frame texture 1.0 bone
+texture anim frame texture bone 1.0 vertex bone
+-1 frame 0.500000
+material anim anim texture 1.0
+1.0 frame
+texture bone =
+anim texture texture frame
+0.500000 frame texture
\ No newline at end of file
@@ -0,0 +1,104 @@
+-1
+frame 0.500000 vertex -1 = material frame 0.500000 frame
+frame
+frame vertex
+1.0 texture anim
+= vertex 0.500000
+anim anim
+material 1.0 vertex frame material
+vertex 0.500000 material -1 0.500000 0.500000 -1 -1
+texture 0.500000 bone
+bone
+=
+material
+0.500000 bone 1.0 material
+vertex
+= texture bone frame = frame bone material -1 material = -1 frame 0.500000 texture -1 anim
+frame 0.500000 material = anim
+texture anim material
+bone = 1.0 frame 1.0 material
+bone
+vertex material = vertex 0.500000 anim vertex vertex -1 1.0
+texture 1.0 bone
+= texture material texture 1.0 1.0 texture 1.0 anim vertex
+texture
+= texture vertex 1.0 texture 0.500000 frame
+vertex texture vertex
+1.0 1.0 material vertex
+0.500000 material
+-1 1.0
+bone bone
+= texture vertex
+-1 0.500000 0.500000
+0.500000
+material =
+0.500000
+anim = vertex texture
+anim material texture =
+frame -1
+bone 1.0
+bone
+material 0.500000
+= frame bone
+=
+material anim frame 1.0 1.0 texture 1.0
+material
+texture vertex texture = 0.500000 material
+vertex
+material vertex texture
+frame
+texture
+-1 1.0 anim = vertex bone bone material material 0.500000 texture material 0.500000 frame texture texture anim 0.500000 vertex anim = anim
+bone
+=
+0.500000
+vertex
+-1 -1 bone
+= 1.0 vertex -1 texture material anim bone -1
+material texture material 1.0
+material
+texture bone
+material vertex
+= bone -1 = frame -1
+= = frame
+texture bone -1 anim material anim
+anim -1 0.500000 anim 0.500000 material
+material vertex -1 1.0 vertex = vertex 1.0 texture
+material
+bone anim 0.500000 -1
+anim bone material bone texture = = = 1.0 vertex = -1
+bone 1.0 anim vertex bone
+bone -1
+vertex
+frame 1.0 frame frame texture 0.500000 texture vertex 0.500000
+vertex material bone 0.500000
+0.500000 vertex bone material
+1.0 0.500000 vertex 1.0
+vertex vertex texture frame vertex 1.0 vertex
+=
+vertex frame material = vertex bone vertex
+texture 0.500000 anim
+material 1.0 anim material 1.0 1.0 vertex texture bone anim vertex -1 1.0 material texture texture
+texture bone frame -1 = 1.0 = 1.0 1.0
+bone 0.500000 texture
+texture vertex
+texture
+= material -1 material material 1.0 = vertex
+= vertex
+bone 0.500000
+texture bone anim anim = texture vertex
+vertex texture material frame material 1.0 1.0 anim 0.500000 -1
+1.0 frame
+-1 vertex
+vertex frame bone 0.500000 material bone = 1.0
+material material
+material anim texture frame vertex frame vertex texture
+0.500000 bone vertex
+material material anim -1
+bone bone 0.500000 vertex bone bone 1.0
+frame 0.500000 -1 anim frame 0.500000 texture texture
+vertex material anim -1
+0.500000
+vertex
+vertex
+frame vertex 1.0 0.500000 1.0 tex
\ No newline at end of file
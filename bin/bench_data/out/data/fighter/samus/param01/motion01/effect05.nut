@@ -0,0 +1,167 @@
+1.0 0.500000 frame
+bone frame frame frame vertex material vertex -1 -1 0.500000 bone texture anim 0.500000 1.0 1.0 = texture =
+= anim anim anim = frame material
+bone anim anim 1.0 -1
+bone =
+=
+-1 1.0 bone 0.500000 frame 1.0 material material bone frame 0.500000 vertex 0.500000 bone
+frame vertex vertex texture texture
+frame texture frame material = bone texture frame
+-1 texture
+anim
+texture material frame vertex texture material frame texture frame anim frame =
+anim vertex vertex vertex material
+bone texture
+bone
+0.500000
+frame 0.500000 frame
+frame 1.0 bone
+material anim
+1.0
+bone -1 -1 =
+= vertex material
+anim bone bone -1 frame
+texture 0.500000 0.500000 0.500000 anim
+-1 1.0
+anim
+-1 frame -1 bone material texture material vertex vertex
+anim material
+anim 0.500000 =
+vertex
+material 0.500000 material = bone 0.500000 -1
+bone material =
+1.0
+vertex texture
+frame material vertex 0.500000
+= =
+1.0 = frame 0.500000
+1.0 texture
+bone vertex
+-1 texture texture
+vertex = texture -1 = -1 frame
+texture =
+-1 = = 1.0 1.0 bone vertex texture anim = 0.500000 material
+material anim vertex
+bone -1 0.500000 0.500000 material 0.500000 bone
+1.0 bone anim anim anim
+bone vertex 0.500000
+= = vertex material
+1.0 material 0.500000 bone 1.0
+0.500000
+0.500000
+-1 texture
+vertex
+bone
+material bone
+1.0 frame material -1 -1 material 0.500000 0.500000 frame vertex -1 0.500000 vertex 0.500000 texture
+vertex = vertex
+material 0.500000 -1 -1 frame 1.0 anim = bone bone
+-1 frame
+material
+vertex 0.500000 0.500000 texture
+material
+texture frame
+1.0 -1 texture
+material
+=
+bone bone
+frame frame vertex 0.500000 1.0 anim vertex 1.0 0.500000 0.500000 material 0.500000 -1 = texture bone
+= texture -1 vertex
+frame vertex anim -1 = texture 1.0 frame
+0.500000 -1
+1.0 -1 bone -1 anim
+anim 1.0 1.0 bone =
+= anim anim bone 1.0 texture =
+texture = material -1 -1 anim anim bone
+texture
+material
+1.0
+1.0 -1 = 0.500000
+0.500000 bone 1.0 0.500000 = = bone
+vertex frame
+material 0.500000 -1 0.500000 0.500000
+1.0 texture vertex texture vertex
+texture -1 texture -1
+vertex 0.500000 vertex
+= vertex frame
+frame 1.0 1.0 bone = vertex anim anim
+0.500000 bone
+1.0
+texture
+anim texture frame anim
+-1
+vertex 0.500000 material
+texture bone
+frame frame
+1.0 frame -1 0.500000 0.500000 0.500000
+vertex bone -1 frame vertex =
+vertex bone 0.500000 bone
+= texture texture
+vertex vertex
+anim
+anim
+texture
+vertex
+1.0 material 0.500000 bone bone = texture material vertex = frame 0.500000 -1 vertex anim anim
+texture anim
+anim
+material vertex -1 frame anim material
+-1 1.0
+bone frame texture = anim vertex texture material frame vertex = vertex 0.500000 =
+1.0 bone vertex
+=
+bone frame =
+= texture -1
+texture 1.0
+anim
+vertex 1.0
+bone 1.0 bone vertex bone
+1.0
+vertex = frame
+1.0 texture 0.500000
+-1 material texture -1 texture bone bone texture 0.500000 frame frame
+anim -1 bone
+frame material material -1 1.0 vertex -1 material frame 1.0 anim vertex 1.0
+frame -1 frame
+frame = -1 bone
+-1 bone
+bone bone vertex material
+1.0 vertex texture 1.0 0.500000 0.500000 bone vertex = = material -1 1.0 texture texture material -1 material 1.0 anim frame frame 1.0
+material
+frame anim -1 bone anim
+0.500000 1.0
+1.0
+texture
+anim material bone 0.500000 =
+material
+0.500000 vertex texture frame
+= -1 material bone bone
+= 0.500000
+vertex = anim material -1 bone
+0.500000
+frame
+0.500000 vertex =
+0.500000
+anim
+0.500000 frame
+0.500000 anim anim bone anim texture 1.0 vertex anim texture anim 1.0 vertex material 0.500000 texture
+-1 material 1.0
+texture frame
+texture 0.500000 texture bone frame vertex
+1.0 material 1.0 0.500000 texture
+1.0 bone vertex anim material bone frame bone 0.500000
+frame
+-1 1.0 0.500000 frame
+anim bone anim 1.0 bone vertex
+-1
+vertex
+frame
+frame texture
+material 1.0 texture frame material
+1.0 texture anim
+1.0 frame material material
+material bone =
+anim 0.500000
+1.0
+-1
+material 0.5
\ No newline at end of file
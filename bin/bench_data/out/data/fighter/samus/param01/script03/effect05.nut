@@ -0,0 +1,27 @@
+= texture = -1 texture
+frame anim anim 0.500000 anim material = vertex vertex
+texture bone
+vertex 0.500000 anim 1.0
+1.0 material material 0.500000 vertex = 0.500000 material 0.500000 vertex
+anim vertex anim
+bone frame material texture 0.500000 0.500000 texture
+bone =
+= 1.0 material anim anim
+0.500000 = -1
+vertex bone bone -1 = 0.500000 = material = bone bone
+anim = 1.0 1.0 anim anim bone
+vertex -1 material
+texture material
+anim
+frame material anim
+1.0 -1 bone
+frame
+vertex vertex vertex texture 0.500000 frame bone bone material = frame
+material -1
+-1 bone vertex =
+0.500000 bone
+-1
+material bone vertex
+1.0 = 1.0 -1
+bone
+anim frame
\ No newline at end of file
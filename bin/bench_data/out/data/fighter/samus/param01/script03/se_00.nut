@@ -0,0 +1,11 @@
+anim = -1 material
+-1 =
+=
+bone vertex bone
+material 1.0 -1 bone bone anim
+-1 bone bone frame 0.500000 vertex
+material 1.0 = anim material anim = anim vertex texture texture -1 = frame anim
+0.500000
+frame frame bone frame frame
+1.0 1.0
+vertex texture 0.5
\ No newline at end of file
@@ -0,0 +1,5 @@
+1.0
+=
+-1 =
+texture -1 material
+1.0 = 1.
\ No newline at end of file
@@ -0,0 +1,47 @@
+anim bone 1.0 vertex frame 1.0 1.0
+= 0.500000 frame
+material vertex texture
+material 0.500000 material
+bone
+texture material material
+anim -1 material bone bone vertex bone bone 1.0 =
+frame anim = anim
+anim
+-1 material -1
+material
+bone
+1.0 vertex bone
+texture
+texture
+-1 -1 bone material bone bone anim
+0.500000 anim texture
+frame
+texture vertex 1.0 = texture = 1.0 = frame anim frame anim = 0.500000 1.0 bone
+anim -1
+= 0.500000 1.0 0.500000 material
+= frame = = material bone 0.500000 material frame =
+vertex -1 bone
+bone
+frame
+frame 1.0 bone = texture anim 0.500000 texture material 0.500000 anim texture frame material texture =
+0.500000 vertex
+bone
+= anim 0.500000 1.0 bone
+anim texture anim
+anim
+vertex frame
+texture texture =
+frame -1 anim
+0.500000 vertex bone
+= 0.500000 -1 frame material anim
+frame
+=
+1.0 = 0.500000 bone 1.0 0.500000 vertex = texture
+texture -1 anim frame texture material
+bone material texture vertex vertex
+0.500000 material bone
+vertex
+texture 1.0
+0.500000 1.0
+anim = anim 0.500000 texture -1
+fra
\ No newline at end of file
@@ -0,0 +1,130 @@
+anim vertex anim
+bone -1
+-1 anim vertex anim vertex
+1.0 frame
+= 1.0 anim
+1.0 -1 -1 bone vertex vertex anim =
+-1 1.0 -1 frame =
+-1
+texture = frame 1.0 bone material anim texture
+texture
+= 1.0 = material 0.500000 = anim
+-1
+= -1 bone
+texture 0.500000 = 1.0 = bone =
+frame
+anim anim -1 =
+material anim vertex
+0.500000 1.0
+1.0
+0.500000 -1
+-1 1.0 vertex frame
+material 0.500000
+frame frame 0.500000 -1
+0.500000 1.0
+frame -1 0.500000 1.0 1.0 bone texture -1 0.500000
+0.500000 frame
+bone vertex material 1.0 vertex frame
+vertex
+material
+1.0 frame -1 anim anim bone
+1.0
+1.0 texture = = bone material
+texture texture
+material bone
+vertex texture frame
+= texture frame anim 0.500000 -1 texture texture
+0.500000 material 0.500000
+anim material
+bone
+texture 1.0
+anim 1.0 bone
+=
+texture
+0.500000 -1
+-1 bone vertex frame -1 = -1 =
+= 1.0
+texture
+0.500000 material 1.0 vertex anim frame vertex bone vertex 1.0 bone = bone bone anim
+= 1.0
+-1 = 1.0 1.0 = material
+texture 0.500000
+-1 = frame
+1.0 0.500000 texture
+anim material vertex
+material
+anim frame = frame
+texture
+material
+-1
+frame frame bone bone = vertex
+1.0 frame 1.0 1.0 vertex -1
+frame
+texture bone bone 1.0 frame material texture material 1.0
+=
+vertex
+bone bone vertex vertex
+frame anim vertex anim
+texture
+bone 0.500000
+0.500000 = anim anim -1 frame
+texture material 1.0 = frame
+= = frame =
+frame
+1.0 frame anim vertex 1.0 0.500000
+vertex anim material
+material 1.0 anim
+frame vertex frame
+vertex 1.0 frame frame
+texture texture vertex texture = anim 0.500000 anim 0.500000 -1 0.500000 0.500000 vertex
+texture frame
+=
+-1 0.500000 anim frame
+0.500000 anim
+frame -1 1.0
+material texture bone bone -1
+bone frame vertex
+anim frame = 1.0 0.500000
+1.0
+material -1
+= 0.500000 anim -1
+1.0 anim
+texture material material vertex anim
+-1 anim material
+anim vertex material
+frame bone bone -1
+texture texture = 1.0 0.500000 = vertex frame texture = -1 material
+0.500000
+0.500000 0.500000 0.500000 = 0.500000
+bone material frame = 1.0
+-1 =
+bone anim frame frame anim bone frame = bone frame
+frame texture material material
+bone frame
+0.500000 1.0 vertex 0.500000 1.0
+1.0 1.0 vertex material 1.0
+1.0 -1 anim material
+texture frame material
+=
+texture =
+texture bone 0.500000 frame material 1.0 -1 1.0
+texture -1 anim vertex material
+anim texture
+bone 0.500000 = vertex material 1.0 material vertex anim 0.500000 material material = frame
+material -1 = anim
+-1 texture -1 bone = vertex bone vertex material 0.500000 anim 0.500000 0.500000
+vertex
+bone vertex 1.0 bone
+= -1
+vertex frame vertex material vertex anim 1.0
+0.500000
+texture -1
+texture
+material vertex vertex anim anim
+-1 vertex -1
+bone texture
+1.0
+vertex bone frame 1.0 = 0.500000 -1 1.0 anim -1 bone
+vertex
+frame bone -1
+1.0 
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame material bone texture
+bone 1.0 vert
\ No newline at end of file
@@ -0,0 +1,100 @@
+vertex -1
+1.0 0.500000 anim
+=
+texture -1
+1.0 0.500000
+material material
+= -1 vertex material = 0.500000
+texture 1.0 texture -1 0.500000 anim
+texture vertex
+material 1.0 -1 0.500000 frame
+texture
+frame -1 anim = vertex vertex texture 1.0 anim vertex vertex texture -1
+0.500000
+-1
+-1
+texture
+anim anim = material bone bone
+material 0.500000 = = texture anim
+-1 vertex 0.500000 1.0 vertex
+0.500000 texture -1
+0.500000 -1 bone 0.500000 vertex 0.500000 frame
+frame texture frame
+vertex vertex anim texture
+vertex frame
+1.0 0.500000 bone
+= -1 bone bone
+texture
+1.0 = texture bone
+texture vertex 1.0 bone -1 anim 0.500000 1.0
+-1
+vertex texture vertex frame
+=
+vertex = texture frame vertex vertex
+material texture 0.500000 vertex anim
+frame =
+-1 texture vertex 1.0 -1 vertex anim -1 material
+0.500000 -1 -1 0.500000
+-1 bone
+vertex frame texture -1
+vertex bone
+texture 1.0
+-1 anim 0.500000
+frame = 0.500000 1.0 anim 1.0 anim 0.500000 texture
+vertex 0.500000 anim
+1.0
+vertex 0.500000 anim
+texture vertex bone
+material -1 texture texture =
+bone = 1.0
+bone
+1.0 0.500000 vertex 0.500000
+anim
+bone 1.0 material -1 0.500000 0.500000 =
+anim anim material frame frame
+0.500000 =
+-1
+= texture 0.500000 texture 0.500000
+0.500000 0.500000 = bone 1.0 0.500000 0.500000 1.0
+bone
+= =
+material -1 1.0
+-1 = vertex material material = material vertex
+anim
+= bone = -1 texture
+1.0
+-1 texture anim bone material
+-1 0.500000 1.0 frame material
+texture
+bone 1.0 vertex frame anim
+1.0
+texture 0.500000 bone
+anim frame 1.0
+vertex 0.500000 1.0 bone
+bone = 1.0 frame frame = -1
+texture
+1.0 1.0 vertex material material vertex = frame 0.500000
+= 1.0 texture
+vertex anim frame 0.500000 0.500000 1.0 anim vertex 1.0 vertex vertex 1.0 0.500000 -1
+-1 1.0 1.0 1.0 material = -1
+bone material texture texture bone material =
+0.500000 vertex
+bone frame frame texture material -1 texture
+0.500000 frame bone material material
+1.0 frame vertex frame frame -1 -1
+0.500000
+-1 = -1 -1 bone bone = anim material anim bone
+= 0.500000 =
+texture frame material frame
+1.0
+frame = vertex
+= -1 material texture
+frame frame -1 texture = bone material -1 0.500000 frame
+bone 0.500000 vertex material -1 material frame
+vertex
+vertex anim bone bone
+material
+anim 1.0 bone 1.0 -1 1.0 1.0 texture 1.0 material -1
+texture 1.0
+bone frame frame 1.0
+vertex frame bone 
\ No newline at end of file
@@ -0,0 +1,19 @@
+vertex
+0.500000
+texture =
+frame 1.0 material texture
+anim
+-1 frame
+frame = bone
+anim -1 0.500000 vertex vertex bone
+anim bone = texture
+material vertex frame 1.0 0.500000
+0.500000 material bone -1 bone texture 1.0 texture anim
+frame 1.0 frame material
+0.500000 = texture = frame 0.500000 = vertex texture
+vertex = =
+-1 texture texture anim anim =
+frame material vertex
+-1 = 0.500000 anim material 0.500000 vertex
+= material
+-1 0.500000 bone 
\ No newline at end of file
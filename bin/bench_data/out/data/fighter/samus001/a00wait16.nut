@@ -0,0 +1 @@
+4JbV+Px^{?ՈH]N.4
\ No newline at end of file
@@ -0,0 +1,11 @@
+vertex
+anim 0.500000 texture
+vertex frame
+-1
+-1 texture
+=
+anim = vertex -1 -1 -1
+bone texture bone
+vertex frame
+0.500000 -1 -1
+ma
\ No newline at end of file
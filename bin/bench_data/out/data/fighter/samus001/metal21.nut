@@ -0,0 +1,3 @@
+2#>paȽu7YqUN' DIgP+^'}&»pAn@(Uf׏MnRf<tTI7tlgW#6Mո%F-$rG)٢i(?8ڔQ"bKqx*E_h\ވrE3Csɍ뗕01\$璜&~kV`Õ!
+<ڞmb-gghTE>~*?1>2{hO3,̴dZ}m2czO̔׋(oQk͑GzV,FRWl\aԧSrzFq?\;%5̩jvߘQSR.21.:"D	Ӝ/2r@#44
+tHZǯAfDXtBF0%\}FZ:w0d:G '>^)>%t2m@0[)W#>ॹbC.u1
\ No newline at end of file
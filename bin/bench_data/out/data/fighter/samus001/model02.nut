@@ -0,0 +1,76 @@
+texture texture
+anim frame anim texture material
+frame texture texture
+-1 0.500000 vertex
+0.500000 =
+0.500000 texture
+material anim frame
+= 0.500000 = 0.500000 frame
+bone
+frame -1 vertex frame anim
+frame anim anim vertex -1 =
+anim bone frame
+-1 anim anim texture bone
+material vertex 0.500000
+1.0 vertex texture texture vertex frame vertex = =
+vertex vertex
+anim texture bone
+vertex
+anim vertex = 0.500000
+-1 anim texture
+1.0 = material 0.500000 0.500000 vertex bone frame
+-1 frame -1 1.0 1.0 -1 bone material 1.0 vertex
+texture bone =
+1.0 1.0 vertex 1.0 1.0 -1 bone material
+0.500000 material frame texture
+1.0
+= anim 1.0 material bone texture -1
+= 0.500000
+bone
+vertex texture
+bone -1 material bone bone bone 1.0 -1 bone
+= =
+bone frame 0.500000
+frame
+texture vertex -1 material vertex anim -1
+vertex -1 material vertex anim frame = frame anim
+material 1.0 bone
+= 1.0 anim 1.0 frame
+0.500000 material 0.500000 texture texture material
+bone
+vertex 1.0
+0.500000
+-1
+bone
+texture
+anim material
+-1
+material 0.500000 texture anim
+vertex 1.0 vertex texture
+frame = material material vertex
+material
+texture anim -1 material texture material 1.0 vertex texture -1
+=
+0.500000 = = anim = -1 = anim frame vertex = vertex
+anim bone -1
+0.500000 = texture
+1.0 1.0
+=
+bone frame bone 0.500000 bone frame
+bone
+0.500000
+material = anim frame material
+frame vertex
+material bone -1
+frame vertex 0.500000 frame anim 0.500000 0.500000 0.500000
+0.500000 bone texture 1.0 vertex texture
+texture 1.0
+0.500000
+vertex frame texture anim 0.500000
+= vertex = vertex 0.500000 vertex
+texture -1
+anim texture
+frame 0.500000 texture anim
+texture vertex -1 -1 0.500000 vertex 1.0 anim material material anim material
+frame
+vertex -1 bone 1.0 texture = anim 0.500000 texture 1.0 frame anim t
\ No newline at end of file
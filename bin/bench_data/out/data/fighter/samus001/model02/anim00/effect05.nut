@@ -0,0 +1,304 @@
+bone texture
+texture bone material
+anim
+vertex anim bone 0.500000 anim -1 anim 1.0 material anim
+anim anim anim -1 material bone
+vertex
+1.0 bone = 1.0 anim -1
+material
+1.0
+vertex vertex vertex vertex anim anim
+material
+bone
+frame = frame texture frame material 0.500000 1.0 0.500000 1.0 texture 0.500000 -1 bone vertex
+bone
+= 1.0
+=
+vertex
+material material 0.500000 material bone 0.500000 texture frame bone
+anim anim -1 anim 1.0 vertex 0.500000
+0.500000 =
+vertex bone 1.0
+frame anim bone 1.0
+frame = texture 0.500000 1.0 anim texture material vertex
+= material -1
+material
+=
+bone bone material material
+frame = texture 0.500000 = 1.0 material texture texture -1 texture material =
+0.500000 frame texture bone
+texture
+= = -1 texture 0.500000 -1 -1 material anim vertex anim 0.500000 bone =
+-1 1.0 1.0
+bone vertex 1.0 bone frame 0.500000 frame texture texture texture 0.500000
+-1 texture anim
+material texture
+= texture bone anim anim = frame
+1.0 = 1.0
+frame vertex anim bone
+-1 material 0.500000 -1 1.0 texture
+frame texture 0.500000
+anim material 0.500000
+material frame -1 frame 0.500000 -1 0.500000 vertex material anim -1 material 1.0 1.0 material
+vertex frame 1.0 vertex frame -1 0.500000 frame vertex bone frame frame 0.500000 -1
+texture anim
+anim bone material texture
+= bone
+bone
+vertex =
+material material
+1.0 1.0 1.0 -1 material bone -1 material vertex texture 1.0 1.0
+1.0 bone anim
+frame 0.500000 -1
+anim
+0.500000 1.0
+vertex bone vertex
+frame
+frame
+vertex bone material
+texture anim bone texture bone
+material
+frame material -1 anim 0.500000 texture
+1.0
+= texture texture texture texture material
+anim vertex 0.500000 1.0 1.0 anim material anim vertex anim anim frame frame anim vertex vertex
+vertex 1.0 = material material = vertex vertex texture
+texture
+texture
+-1 material frame bone bone
+= material
+bone
+-1
+frame = 0.500000 frame 1.0 texture
+texture
+frame texture
+1.0 1.0
+anim 1.0 -1 frame
+frame 1.0 texture bone vertex anim texture 1.0
+material -1 bone -1 -1 vertex
+1.0
+= vertex bone vertex 0.500000 texture vertex -1 texture -1 bone texture = = = material
+bone anim bone texture material 0.500000 anim frame vertex -1 = material 0.500000 material bone 1.0 material bone material
+material = -1 -1 0.500000 =
+bone anim
+anim 1.0
+vertex = -1 anim vertex material 1.0 -1 anim bone 1.0 0.500000 -1 bone
+0.500000 0.500000 anim bone
+vertex
+material frame
+material frame 0.500000 material texture vertex
+bone
+1.0 -1 vertex -1
+vertex 0.500000
+vertex bone material 1.0 0.500000 vertex material 0.500000 0.500000
+bone texture -1 vertex
+texture frame = texture
+0.500000
+texture anim bone
+vertex 1.0 = anim texture texture material -1
+anim frame texture -1 1.0 anim material -1 texture 1.0
+anim
+vertex 0.500000 1.0 -1
+bone frame material -1 frame
+material = texture bone -1
+frame =
+0.500000
+bone bone vertex texture vertex 1.0 0.500000
+= 0.500000 anim
+-1
+bone 0.500000 -1 = texture texture 1.0 -1
+texture 1.0 -1 frame
+bone 0.500000
+material
+frame = 0.500000 bone
+vertex
+= 1.0
+-1 = bone vertex 0.500000 vertex vertex material
+anim 0.500000 texture material -1 = bone frame -1 anim bone bone
+anim 0.500000 material material vertex frame
+material bone -1
+bone anim
+vertex = material
+-1 -1 material bone
+= texture -1 1.0 bone
+vertex -1
+1.0 frame
+frame
+texture 1.0 0.500000 anim material
+0.500000 bone 0.500000
+frame
+frame
+-1 material texture 0.500000 0.500000 vertex 0.500000
+vertex 1.0 material 0.500000 anim -1 0.500000 0.500000 frame texture anim texture 0.500000
+1.0 texture texture
+-1 1.0 bone texture = =
+material = bone = 0.500000 0.500000 vertex
+=
+0.500000
+frame -1 = anim
+bone
+bone frame material texture material =
+frame bone 1.0 anim 1.0 0.500000
+texture 0.500000 bone 0.500000 vertex material
+1.0 =
+anim 1.0 = anim vertex 0.500000 vertex vertex anim =
+texture vertex
+1.0 texture anim bone
+1.0
+1.0 anim
+material anim texture material anim
+-1 bone 0.500000 1.0 vertex -1
+= anim -1 1.0
+frame bone = bone
+-1 1.0
+1.0 anim frame bone frame anim = material frame bone =
+= material bone vertex
+material
+frame = anim =
+bone material material
+material
+vertex = = 1.0 frame vertex -1 = texture = -1 vertex
+vertex 0.500000 vertex vertex texture vertex 1.0 1.0 texture texture = -1
+vertex 1.0 0.500000 0.500000 =
+bone texture = = 1.0
+= -1 bone 0.500000
+material 0.500000 -1 anim anim texture texture
+material
+texture -1 frame
+bone 0.500000 -1 1.0 vertex
+1.0 texture frame = anim bone material 0.500000
+bone
+0.500000 frame anim bone
+0.500000 texture -1 = 1.0
+-1 bone -1
+= anim
+frame =
+material 1.0
+anim material -1 1.0 anim material material
+frame 1.0 frame 1.0 texture
+texture 1.0 1.0 = frame 1.0 texture
+vertex anim
+-1 -1
+material bone
+frame anim texture frame 1.0
+material anim
+frame = 1.0 bone bone
+bone
+anim
+= 1.0
+vertex frame = = 0.500000 1.0 0.500000 material = 1.0 bone frame anim frame anim vertex = material anim =
+texture 0.500000 anim 0.500000 texture vertex anim
+vertex
+0.500000
+anim
+= material anim = bone material anim anim 0.500000 1.0 = bone
+material vertex material anim 1.0 1.0 = = bone vertex vertex
+frame
+1.0
+texture
+vertex bone
+bone vertex
+bone
+material texture texture bone
+vertex = 1.0 = vertex frame
+bone 0.500000
+-1 frame texture bone bone
+vertex 1.0 material 1.0 material anim
+frame =
+material bone material texture 1.0 vertex texture
+anim material anim
+frame
+= material
+0.500000 anim -1 texture bone
+material texture anim texture 0.500000 0.500000 material
+1.0
+= vertex
+= material
+0.500000 texture material -1 material
+-1 vertex 0.500000 = texture =
+frame
+anim bone frame texture
+-1 = bone 0.500000 = -1
+bone vertex bone = -1 bone 0.500000 -1 anim
+texture frame
+0.500000 anim anim
+material bone anim
+bone
+anim -1 vertex vertex anim -1 anim 1.0
+-1
+texture 1.0 material texture
+-1 -1
+material bone bone anim texture
+vertex 0.500000 = texture
+material 0.500000
+-1 anim frame bone anim bone bone 1.0
+texture -1
+-1
+material material
+-1 0.500000
+= bone anim 0.500000
+anim 1.0 anim 0.500000 = =
+0.500000
+1.0 vertex -1 bone vertex anim anim
+= vertex bone
+frame anim 1.0
+= 1.0 vertex
+bone bone = material frame 1.0 anim
+bone 1.0 texture
+0.500000 texture material material 0.500000 0.500000 anim = =
+material
+vertex bone
+= 0.500000 frame material
+= frame -1 material anim anim
+0.500000 bone frame 0.500000 1.0 0.500000
+material
+vertex bone frame -1 bone
+= vertex bone texture
+bone
+frame
+texture anim material
+1.0 bone material material anim = material texture
+material
+anim vertex 1.0 -1 1.0
+anim
+1.0 -1 = anim texture bone vertex frame 1.0 -1 texture = 0.500000 vertex = frame frame 1.0
+=
+texture material anim frame bone 0.500000
+texture = texture = texture vertex
+0.500000 material -1 bone vertex material anim 0.500000
+anim
+=
+-1 bone bone 0.500000
+= frame
+material 0.500000 1.0 0.500000 anim
+-1 bone
+vertex material texture
+bone texture frame frame
+vertex -1 anim texture
+anim bone 1.0
+1.0 texture
+0.500000
+bone -1 frame -1 material -1 frame
+bone anim -1 material texture vertex -1 vertex frame bone 0.500000 1.0 vertex 1.0
+0.500000 bone texture frame material
+bone = 1.0
+1.0 1.0 = frame
+texture 1.0 bone
+0.500000 bone frame
+texture 1.0 0.500000 texture
+vertex texture
+texture bone
+vertex texture vertex
+texture 0.500000 anim
+1.0 bone 0.500000 anim texture
+0.500000 frame vertex material
+material material 0.500000 frame 1.0 texture anim material bone
+1.0
+0.500000 bone material anim anim material
+0.500000 vertex frame 0.500000 texture 0.500000 -1 0.500000 material 1.0 bone
+-1
+1.0
+1.0 vertex vertex frame material
+1.0
+1.0
+ver
\ No newline at end of file
@@ -0,0 +1,36 @@
+1.0 bone material
+vertex material bone anim frame 1.0 frame
+vertex 0.500000 frame anim 1.0 vertex =
+-1 vertex frame
+= texture
+material -1 1.0 0.500000
+= vertex = anim
+frame texture texture -1 bone 0.500000 material = vertex
+vertex texture -1 vertex material -1 anim -1 material texture =
+1.0 vertex bone
+bone 1.0
+1.0
+frame
+0.500000 vertex =
+= material anim -1 anim bone
+-1
+-1
+material
+vertex
+frame
+-1 anim anim texture -1 vertex -1 texture
+=
+=
+1.0 = 0.500000 material vertex
+anim = texture texture
+vertex 1.0 -1 = anim = anim
+frame material -1
+vertex
+anim 1.0 texture 0.500000 texture vertex
+vertex 0.500000 vertex 1.0 texture anim 1.0 material vertex -1
+bone frame
+0.500000 = frame 0.500000 frame = = bone -1 = 1.0 material 0.500000 bone material
+0.500000
+0.500000
+1.0 vertex frame
+b
\ No newline at end of file
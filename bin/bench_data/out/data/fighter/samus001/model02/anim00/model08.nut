@@ -0,0 +1,28 @@
+bone 0.500000 bone frame anim
+frame frame anim 0.500000
+=
+frame material frame anim -1 bone vertex = texture -1 frame frame
+1.0 material 1.0 anim =
+-1 1.0 vertex vertex
+frame anim
+material -1
+anim material texture
+1.0 1.0 material
+= = texture
+bone -1
+= 1.0 -1 0.500000 -1 frame 1.0 texture
+frame material material vertex
+-1
+texture 1.0 1.0 -1
+0.500000 frame bone
+texture
+0.500000 -1 material
+-1 frame material
+vertex material 0.500000 frame
+= bone bone
+material -1 texture texture 1.0 bone frame
+vertex vertex
+vertex material
+anim
+= 1.0 bone vertex bone bone
+0.500000 b
\ No newline at end of file
@@ -0,0 +1,13 @@
+-1 1.0 1.0
+material = 1.0 = anim anim
+0.500000
+0.500000
+bone anim
+vertex 1.0 anim anim 0.500000 bone texture anim
+texture
+vertex vertex = 1.0 1.0 anim = = 1.0 texture vertex
+bone frame 1.0 bone vertex
+texture vertex texture 0.500000 texture = -1
+texture 0.500000 0.500000 vertex vertex vertex frame anim -1 texture anim bone 1.0 =
+vertex -1 vertex anim 0.500000
+texture vertex bone frame frame tex
\ No newline at end of file
@@ -0,0 +1,9 @@
+= bone
+1.0
+frame anim vertex texture
+1.0
+material
+vertex -1 material texture texture frame vertex -1
+vertex bone -1 1.0 1.0 0.500000 texture 0.500000 frame = 1.0
+1.0 1.0 1.0 vertex
+fr
\ No newline at end of file
@@ -0,0 +1,21 @@
+frame
+vertex
+vertex anim = bone
+1.0
+1.0 frame
+1.0 = = frame anim material 0.500000 texture bone 1.0 0.500000 bone
+vertex -1
+texture -1 0.500000
+frame 1.0
+1.0 anim 1.0
+frame material 0.500000
+anim = bone
+material anim material
+vertex bone texture 0.500000
+1.0
+1.0 0.500000
+0.500000
+frame frame anim 1.0 bone
+material
+bone
+vertex 
\ No newline at end of file
@@ -0,0 +1,13 @@
+1.0 -1 1.0 bone
+= bone 0.500000
+bone
+vertex
+bone 1.0 material texture
+frame frame 1.0 material 0.500000 -1 bone 0.500000
+texture material
+1.0 1.0 vertex material 1.0 bone bone frame
+frame
+-1
+material 1.0 =
+vertex bone
+0.500000 texture textur
\ No newline at end of file
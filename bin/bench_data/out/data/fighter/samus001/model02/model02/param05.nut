@@ -0,0 +1,5 @@
+frame = -1 material vertex bone
+anim anim = = 1.0 = 1.0
+frame 0.500000 1.0
+anim vertex anim -1
+1.0 material -1 bone frame mate
\ No newline at end of file
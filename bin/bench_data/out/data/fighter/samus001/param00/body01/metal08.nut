@@ -0,0 +1 @@
+#PTk[S`@jyCCIjg_O)&">GIh
\ No newline at end of file
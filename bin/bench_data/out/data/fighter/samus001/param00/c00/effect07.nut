@@ -0,0 +1,23 @@
+= frame vertex = vertex
+vertex
+material 1.0
+1.0 bone -1 anim
+anim frame 1.0 0.500000 0.500000 texture 1.0 texture
+frame 1.0 vertex texture bone material texture vertex frame frame bone = 1.0 vertex 0.500000 bone
+texture 1.0 vertex vertex material 1.0 bone = material
+1.0
+=
+vertex 0.500000
+0.500000 -1 bone bone anim anim texture bone
+-1 vertex vertex material
+texture bone
+bone -1 bone anim frame
+material
+material
+= = -1 1.0 material anim
+vertex anim texture 1.0 -1
+= 0.500000 frame -1
+1.0 material texture anim frame 0.500000
+vertex
+0.500000 vertex frame -1 bone 0.500000 1.0 texture -1
+1
\ No newline at end of file
@@ -0,0 +1 @@
+v4C%ysa+c[ϧniQW=(^Hǡ"糷sbP8@bQD{2
\ No newline at end of file
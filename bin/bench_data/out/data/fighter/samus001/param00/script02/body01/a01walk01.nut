@@ -0,0 +1,26 @@
+vertex 0.500000
+anim
+frame =
+vertex 1.0 0.500000
+= bone -1
+material
+1.0 bone = 1.0 -1 material 0.500000 bone = -1 frame -1 texture anim vertex frame texture bone material
+texture anim bone vertex =
+vertex -1 bone vertex vertex bone texture bone bone frame texture material
+frame
+material vertex
+anim 1.0
+anim
+vertex
+frame vertex
+1.0
+anim bone anim
+texture vertex vertex -1
+texture vertex -1 texture bone 0.500000 anim frame 0.500000 frame texture 0.500000 1.0 frame
+frame -1 vertex
+anim bone bone anim frame
+=
+texture bone
+bone
+-1
+material vertex ver
\ No newline at end of file
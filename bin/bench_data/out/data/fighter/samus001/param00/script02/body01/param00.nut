@@ -0,0 +1,2 @@
+0.500000 = bone
+vertex anim 0.500000
\ No newline at end of file
@@ -0,0 +1,42 @@
+material = anim 0.500000 anim texture anim = 1.0 anim 1.0 texture bone bone -1
+1.0 texture
+vertex -1 -1 texture
+-1
+vertex 0.500000 = texture
+frame
+0.500000 anim
+anim vertex 0.500000 0.500000 material frame 1.0
+0.500000 material
+bone
+1.0 vertex 1.0 bone material
+frame 0.500000 anim bone -1 = material
+0.500000
+anim -1
+texture frame texture
+=
+frame vertex vertex
+frame =
+= 0.500000 0.500000 frame frame texture bone 1.0 material
+vertex texture
+anim texture
+anim bone
+frame texture
+-1 = -1 anim 0.500000 vertex
+1.0
+material = -1
+1.0
+bone 1.0 material
+anim =
+-1 bone
+bone material 1.0 texture
+frame
+anim 0.500000 bone texture
+0.500000 frame bone 0.500000 vertex 1.0
+frame = material
+anim texture
+frame bone 0.500000
+frame 1.0
+frame 1.0
+1.0
+anim
+1.0 -1 1.0 = 
\ No newline at end of file
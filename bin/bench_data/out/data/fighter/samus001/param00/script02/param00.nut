@@ -0,0 +1 @@
+sgTXynA@a	>R,[Ч
\ No newline at end of file
@@ -0,0 +1,33 @@
+bone vertex anim vertex 0.500000 frame vertex frame
+bone vertex bone -1
+bone -1 bone frame
+= bone
+anim bone
+0.500000 0.500000 -1 -1
+= 0.500000 vertex anim -1 1.0 = vertex 0.500000
+material
+0.500000 1.0
+vertex anim vertex texture material
+= 0.500000 = 0.500000 -1 -1 texture vertex
+texture frame vertex bone 1.0 frame -1 anim frame 0.500000
+frame texture anim frame texture -1
+texture = = bone 0.500000 = vertex bone texture 1.0
+-1
+-1 vertex 0.500000 vertex material
+frame
+vertex texture anim 1.0 frame material texture
+bone bone anim bone
+bone anim
+material
+bone
+texture
+-1 vertex vertex 0.500000 frame = 0.500000 material vertex =
+=
+=
+=
+0.500000
+0.500000 bone texture texture 0.500000 1.0 anim -1 material vertex = 0.500000 material anim = vertex
+frame
+material texture bone
+= frame 1.0 frame frame 0.500000 material anim bone
+texture 0.500000 material
\ No newline at end of file
@@ -0,0 +1,23 @@
+vertex -1
+= -1
+1.0 anim material texture material = 0.500000 1.0 = -1 1.0
+-1 bone = bone -1 bone
+texture
+frame
+1.0 material vertex frame = 0.500000 -1 -1 bone vertex = -1 =
+texture vertex 1.0 =
+frame frame -1 -1
+material
+0.500000 0.500000
+frame -1 frame frame
+material texture vertex -1 0.500000 vertex
+=
+anim
+texture vertex
+0.500000
+anim
+frame
+0.500000 bone texture 1.0 anim -1 bone bone bone frame
+vertex
+vertex
+vertex tex
\ No newline at end of file
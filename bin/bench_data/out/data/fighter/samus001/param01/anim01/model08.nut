@@ -0,0 +1,15 @@
+0.500000
+texture texture 0.500000
+material texture material 0.500000 =
+material 1.0 = =
+0.500000 anim
+1.0
+-1
+texture material anim
+= 0.500000 frame bone
+material
+1.0 bone anim texture = -1 0.500000 vertex -1
+1.0 vertex frame = texture anim anim
+-1 frame -1
+=
+v
\ No newline at end of file
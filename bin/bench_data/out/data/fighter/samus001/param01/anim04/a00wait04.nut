@@ -0,0 +1,51 @@
+1.0 texture
+vertex =
+material
+-1 frame -1 anim
+0.500000 1.0 frame = = vertex vertex frame frame
+0.500000 texture
+-1 -1
+frame vertex bone bone anim texture material
+frame bone
+frame texture -1 vertex 0.500000 vertex bone anim
+0.500000 = 0.500000 -1 anim anim 1.0 1.0 bone anim anim frame
+frame anim -1 texture frame
+-1 0.500000
+material frame 0.500000
+vertex 1.0 1.0 material frame 0.500000
+material
+= bone material =
+0.500000 texture material
+0.500000
+texture vertex
+frame bone 0.500000
+frame 0.500000 vertex
+anim bone = anim 0.500000 anim
+anim material
+bone
+0.500000 material
+frame = vertex -1
+texture
+0.500000 bone material vertex
+anim
+texture 0.500000
+= -1 anim
+vertex frame frame 1.0 bone vertex
+-1 texture = = bone
+-1 = texture -1
+anim
+bone 0.500000 vertex bone frame -1 vertex texture
+= =
+frame texture vertex frame vertex
+0.500000 material bone anim
+material vertex
+texture
+material -1
+= -1
+vertex =
+= vertex 0.500000 bone
+texture texture frame vertex bone 0.500000
+= frame
+0.500000 =
+1.0
+frame frame vertex vertex
\ No newline at end of file
@@ -0,0 +1,7 @@
+= vertex
+0.500000 =
+frame 0.500000 frame
+frame texture texture
+= 0.500000 =
+bone vertex anim -1 1.0 anim frame = bone -1
+frame 0.500000 textu
\ No newline at end of file
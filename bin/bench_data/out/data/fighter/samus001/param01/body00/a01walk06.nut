@@ -0,0 +1,6 @@
+= bone 1.0 -1 = bone material material material frame frame
+frame 1.0 texture 1.0 anim anim = vertex
+vertex frame vertex bone anim
+texture =
+0.500000 = texture
+t
\ No newline at end of file
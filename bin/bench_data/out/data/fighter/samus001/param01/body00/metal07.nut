@@ -0,0 +1,266 @@
+1.0 vertex bone -1 anim texture anim
+=
+bone 1.0
+0.500000 -1 anim
+frame bone -1 anim anim bone frame -1 vertex
+material texture texture vertex texture
+0.500000 -1 1.0 vertex anim
+0.500000
+bone texture frame -1 1.0 -1 = texture texture anim texture
+-1 =
+vertex frame
+-1 1.0 1.0 = texture
+material bone
+1.0 texture -1 -1
+frame 0.500000 frame texture 0.500000 vertex
+1.0 -1 vertex bone
+frame anim bone
+= material = 0.500000 material bone 1.0
+anim 1.0 vertex
+0.500000 0.500000 frame anim texture 0.500000
+vertex 1.0 vertex
+texture 1.0 = 0.500000 vertex
+frame texture 1.0 frame vertex material = material
+= texture =
+-1 frame
+= -1 = texture texture = = texture bone
+vertex anim -1
+material 0.500000 0.500000
+0.500000 anim 1.0
+1.0 0.500000 material bone
+0.500000 texture
+frame 0.500000 frame vertex =
+frame -1
+=
+-1
+-1 vertex texture -1 bone anim texture frame anim 0.500000
+= = anim vertex -1
+texture texture -1 -1 1.0 1.0 = vertex
+material
+material 1.0 texture -1 -1 anim material frame vertex anim 0.500000
+anim
+bone = 0.500000 = -1 vertex
+bone vertex material 1.0 = = 0.500000
+vertex
+anim
+vertex 0.500000 = -1 1.0 bone -1 = -1
+material -1 texture = anim texture
+0.500000 = texture anim texture 1.0 texture =
+frame = anim
+frame material = -1 anim 1.0
+0.500000 -1 texture frame vertex -1 vertex vertex bone material bone 0.500000 anim 0.500000 0.500000
+texture material
+0.500000 0.500000 -1 texture
+frame
+vertex 1.0 1.0 0.500000 texture 0.500000 bone frame texture frame 0.500000 frame texture 1.0
+-1 -1 texture 0.500000 0.500000 anim 1.0 1.0 = frame 1.0
+vertex anim
+1.0 bone -1 texture bone frame material anim frame texture 1.0 texture -1 frame bone = = anim
+anim = vertex
+frame material texture 1.0 1.0 0.500000
+bone -1 material vertex 0.500000 = material 1.0 texture 0.500000 -1 vertex texture 1.0 anim material material anim vertex
+0.500000 = material frame vertex bone material
+anim 0.500000 bone = -1 anim material
+frame
+anim
+frame anim texture 1.0 texture
+bone material 0.500000 0.500000 0.500000 vertex material frame bone
+1.0 frame
+vertex -1 = texture
+anim vertex = vertex
+= -1 1.0 vertex = 0.500000 anim
+= 1.0
+0.500000 0.500000 texture frame bone vertex frame
+1.0
+frame -1 anim
+bone
+material texture bone 1.0 frame bone
+texture material
+frame 0.500000 1.0
+0.500000 material texture
+0.500000 = frame 1.0 1.0 material 1.0 texture -1
+bone anim 0.500000 texture
+1.0 bone bone 0.500000 = = 0.500000 frame material 0.500000 texture texture anim texture frame vertex material 1.0 frame -1 vertex material vertex material anim vertex anim vertex material 0.500000 texture
+1.0 frame = bone
+vertex -1 material -1 bone 1.0 vertex 0.500000 bone 0.500000 frame material material material =
+vertex
+0.500000 vertex 1.0 0.500000 -1
+1.0
+1.0 1.0 1.0 material material vertex 0.500000 = 0.500000 = frame texture frame vertex
+bone material texture texture 0.500000 anim -1
+1.0 frame vertex frame anim -1 -1 -1
+material = bone 0.500000 texture
+-1 1.0 material =
+anim
+1.0
+texture
+vertex frame anim
+texture frame frame
+vertex 1.0
+frame 0.500000 material 0.500000
+anim vertex = -1 =
+0.500000 texture vertex vertex =
+-1 -1 0.500000 =
+1.0 anim frame vertex
+bone
+texture 1.0 1.0 0.500000 bone material 0.500000 vertex 1.0 1.0
+material
+material
+bone 0.500000 vertex bone = 0.500000 0.500000 vertex anim anim bone vertex 0.500000 1.0
+vertex anim -1
+0.500000 material bone frame =
+frame
+anim 1.0 0.500000
+material 0.500000
+0.500000 = -1
+-1 0.500000 anim 0.500000 bone vertex bone 1.0 material frame -1 anim frame 0.500000 -1 1.0 1.0 =
+material
+vertex vertex material 0.500000 -1
+anim
+texture 1.0
+texture texture 1.0 bone 0.500000 1.0 texture frame frame -1 frame vertex vertex bone -1
+= 1.0
+=
+=
+vertex -1 = texture
+vertex 0.500000
+-1
+frame 0.500000 = bone
+anim
+frame = 0.500000 material frame vertex vertex 0.500000 anim vertex texture = bone
+anim 1.0 -1 vertex = texture vertex
+texture
+=
+anim 1.0 frame 1.0 vertex 0.500000 -1 vertex frame
+-1 1.0 -1 bone
+anim material
+frame -1 1.0 bone frame
+-1 anim bone vertex material anim bone -1 = 1.0 anim -1 -1 1.0 bone material bone
+1.0 material = vertex anim frame material frame
+= material -1 vertex texture 1.0 vertex texture = frame = bone -1 -1 texture -1 frame 0.500000 0.500000 -1 bone texture anim = -1 bone material
+texture texture anim
+anim texture bone anim
+frame 0.500000 frame -1 frame
+frame -1
+= material material
+-1
+bone frame 0.500000
+0.500000
+vertex bone 0.500000 texture 0.500000 bone -1 =
+=
+vertex frame 1.0 -1 material -1 vertex = bone bone
+vertex frame -1 material anim anim = 1.0 = vertex 0.500000 bone
+vertex texture texture
+material vertex = texture material
+anim
+bone = 0.500000 -1
+frame anim
+anim 1.0 frame 0.500000
+vertex 1.0
+bone frame
+0.500000 0.500000
+= =
+0.500000 frame vertex
+texture bone
+1.0 -1 1.0 1.0 1.0
+1.0 material bone
+0.500000 = 1.0
+= vertex texture vertex 0.500000 bone bone anim anim -1 material -1 anim = texture frame
+vertex 0.500000 1.0
+anim
+0.500000 vertex = 0.500000 anim
+0.500000
+material = 1.0 0.500000 material texture anim frame -1
+texture -1 1.0 frame 0.500000 1.0 anim = material frame material bone texture
+1.0 =
+0.500000 0.500000 texture texture vertex
+material
+texture
+frame 1.0 1.0 anim
+vertex frame frame =
+texture texture = 0.500000
+texture 1.0 texture bone
+= frame
+material vertex vertex texture vertex vertex
+= frame
+bone
+-1 texture material
+=
+-1 -1 -1 0.500000 1.0 = bone frame
+-1 0.500000
+bone bone 1.0 1.0
+1.0 texture 0.500000 -1
+-1 texture frame material frame bone frame
+0.500000 bone vertex 0.500000 -1 material vertex -1 anim = frame anim = vertex texture
+bone material bone 1.0 0.500000 frame bone texture
+material 1.0 -1
+bone texture anim bone material material anim frame material vertex -1 material
+texture frame material anim material vertex anim texture vertex
+material frame
+anim vertex
+material
+texture bone 0.500000 -1
+texture
+anim
+0.500000
+bone material bone bone
+vertex material material frame -1 0.500000 bone bone -1 bone
+bone anim vertex bone = material bone 0.500000 texture texture 1.0 material
+-1 texture
+= bone = texture bone 1.0 texture material frame bone
+frame -1
+anim frame 0.500000 -1
+0.500000 1.0
+-1 -1
+-1 anim material bone -1
+vertex 0.500000 bone bone 1.0 material 1.0 1.0
+anim = 1.0 = =
+anim = anim texture = texture material bone vertex texture bone
+-1
+frame material bone vertex anim 1.0 =
+=
+frame
+frame texture
+-1 0.500000 texture -1 1.0 -1
+vertex = = texture
+frame bone 0.500000 bone
+material 1.0 vertex frame frame = 1.0 -1
+= 1.0 anim frame 1.0 0.500000 0.500000 = frame vertex
+1.0 vertex frame = bone -1
+0.500000 = texture bone bone
+0.500000
+0.500000 1.0 bone texture vertex texture
+material -1 1.0
+1.0 frame vertex 1.0 texture
+= material
+= frame vertex frame = frame
+anim
+vertex = = 0.500000
+1.0 0.500000 vertex vertex anim -1 anim bone bone texture anim 0.500000 anim 0.500000 0.500000 frame bone
+bone bone -1
+anim frame texture
+0.500000 anim anim vertex
+material 0.500000 1.0 vertex frame 1.0 =
+anim anim
+vertex texture anim 1.0 =
+-1 texture material
+=
+-1
+1.0 bone
+=
+frame bone anim 0.500000 -1
+anim bone frame
+1.0 texture bone
+1.0 -1 texture vertex
+1.0
+vertex -1 0.500000
+vertex vertex 0.500000 1.0 =
+material 0.500000 material 1.0 vertex -1
+material frame
+= bone bone
+1.0
+-1 texture material
+= 1.0 0.500000 anim 0.500000 vertex texture texture material texture frame 1.0 = vertex
+bone
+anim -1 material 0.500000 = 1.0
+1.0 0.500
\ No newline at end of file
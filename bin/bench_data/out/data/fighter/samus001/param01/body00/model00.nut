@@ -0,0 +1,90 @@
+material 1.0 =
+vertex
+= 0.500000 = -1 texture material -1
+bone bone material texture material
+vertex
+-1
+frame
+1.0 anim vertex material vertex
+anim 0.500000 vertex =
+material texture 0.500000 bone 0.500000
+bone bone
+frame 1.0 -1 bone 1.0 0.500000
+anim
+frame frame 0.500000 1.0 = frame material bone material vertex 0.500000 frame 0.500000 vertex bone 1.0 vertex frame 0.500000 texture material vertex material material 0.500000 1.0 material frame 1.0 material frame bone material -1 frame
+vertex bone 0.500000 texture
+= anim 0.500000 1.0 1.0 1.0 vertex bone material vertex
+bone material -1 bone
+1.0 = =
+frame material 0.500000
+0.500000 vertex 0.500000 =
+0.500000 anim texture
+frame
+-1 = bone
+frame bone = texture bone material =
+vertex
+texture -1
+0.500000 = = texture anim anim bone
+vertex -1 0.500000
+anim material = bone -1 material =
+= anim
+-1 frame frame
+= vertex texture
+vertex material =
+anim
+0.500000 material -1 0.500000 1.0 0.500000 -1 anim -1 anim
+bone -1 material = vertex =
+material 1.0
+= anim
+vertex texture 1.0
+frame
+bone
+anim
+bone texture material bone material material
+bone
+anim anim vertex -1 = = 0.500000 texture 1.0 0.500000 vertex = frame
+anim 1.0
+material material -1 bone
+vertex
+anim
+vertex bone
+material = material 0.500000
+bone -1
+vertex 1.0 -1 texture -1 -1 -1 frame -1 vertex
+bone 0.500000 anim bone anim
+anim
+frame
+1.0 vertex -1 =
+-1 0.500000 anim frame 0.500000 1.0 1.0 frame bone
+frame
+texture bone
+material 1.0 frame frame
+bone anim bone
+texture
+1.0 frame texture texture
+1.0 vertex material
+bone frame vertex -1 frame bone = frame material material anim 0.500000 -1 0.500000 0.500000 -1
+material = = vertex
+= material
+bone 0.500000 = bone
+vertex -1 frame bone -1 -1 -1
+texture bone texture -1 anim material vertex frame frame anim vertex
+texture
+anim -1
+= texture texture
+texture material = vertex 1.0
+frame
+material =
+0.500000
+-1 -1 1.0 =
+0.500000 0.500000
+frame
+frame
+-1 1.0 0.500000 material 0.500000 vertex 1.0 texture 0.500000 material -1 bone
+vertex bone
+texture bone material 1.0 0.500000
+frame 0.500000 vertex = =
+frame frame =
+=
+anim bone material 0.500000 vertex =
+bone vertex vertex
\ No newline at end of file
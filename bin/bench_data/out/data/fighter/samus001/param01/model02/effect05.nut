@@ -0,0 +1,76 @@
+anim vertex
+frame =
+anim vertex bone 1.0
+texture material
+-1 0.500000
+anim 1.0 0.500000 frame frame vertex 0.500000 material vertex frame vertex
+texture
+= = bone
+= = texture 0.500000 frame
+frame bone frame
+anim anim texture
+0.500000 frame vertex 1.0
+anim
+frame = -1 vertex bone -1 material vertex
+vertex 1.0
+vertex bone vertex vertex anim = material anim vertex 0.500000 0.500000 anim anim -1 anim 0.500000
+vertex frame 1.0
+texture vertex =
+= anim material anim vertex vertex texture 0.500000 vertex
+1.0
+material anim bone material
+= bone bone
+bone
+texture material
+bone
+frame = frame frame
+texture bone vertex 0.500000 anim
+texture = -1 bone bone anim -1 frame bone 0.500000 frame
+texture bone texture frame texture vertex
+vertex =
+bone
+bone 0.500000 bone 0.500000 anim -1 =
+1.0
+-1 anim
+0.500000 -1 1.0 vertex frame -1 0.500000 1.0 1.0
+texture material
+-1 1.0 -1 anim -1 = bone =
+1.0 material bone texture
+bone vertex
+bone texture
+1.0 = 0.500000 -1 -1
+bone material vertex 0.500000 vertex
+material material = -1 texture -1 vertex bone texture -1 frame
+1.0 = -1 0.500000
+anim vertex bone
+frame anim bone material anim -1 0.500000 0.500000 anim anim texture vertex
+-1 bone
+frame 1.0 -1 vertex material bone vertex 0.500000
+texture 1.0 anim texture 0.500000
+texture 1.0 texture frame vertex = -1 material vertex = vertex 1.0
+1.0 -1 bone anim texture
+bone
+0.500000
+frame = vertex frame texture texture -1 0.500000 bone material vertex material 1.0 0.500000 anim -1 = 1.0
+texture vertex -1 0.500000 frame -1 -1
+anim material
+= texture 1.0
+-1 -1 = anim = anim
+anim 0.500000 1.0 anim anim 1.0
+bone texture anim anim = bone bone
+material 1.0 = texture 0.500000 vertex 1.0 1.0
+vertex material -1 0.500000 frame
+material -1 1.0 0.500000 1.0 =
+1.0 frame 1.0 texture anim material texture
+1.0 0.500000 0.500000
+texture material
+1.0 anim material 0.500000
+-1 1.0 anim bone bone
+1.0
+vertex 0.500000 texture =
+texture frame anim
+0.500000 vertex anim material 1.0 -1 frame
+bone material 1.0 -1 texture material -1
+bone anim = vertex vertex material
+= 1.0
+fra
\ No newline at end of file
@@ -0,0 +1,146 @@
+anim
+frame
+1.0
+bone vertex
+vertex anim vertex texture
+bone
+material 0.500000 anim frame
+material
+vertex -1 material texture
+material
+vertex vertex material 0.500000
+-1 0.500000 bone 1.0 = bone bone -1 = bone
+-1 bone
+-1 vertex frame
+-1 anim bone bone
+bone 0.500000 = anim frame
+frame -1
+= 1.0
+material
+vertex frame frame frame =
+bone 1.0
+vertex -1 -1
+1.0 texture 0.500000 -1 1.0 -1 frame 0.500000 anim texture = material -1 frame
+= frame bone frame -1 anim -1 -1 anim anim material bone frame 0.500000 1.0 bone 0.500000 anim material
+anim material 1.0 texture vertex =
+= 1.0 anim texture frame 1.0 0.500000 frame 0.500000 anim frame texture bone
+vertex material
+1.0 bone = 1.0
+bone vertex
+anim texture
+1.0 0.500000 vertex
+frame bone bone -1 -1 frame = 1.0
+= bone material
+texture material
+texture frame
+anim texture vertex bone 1.0 -1 0.500000 bone 1.0
+1.0 anim
+0.500000 texture
+1.0 anim 0.500000 anim frame texture frame vertex frame bone
+bone -1
+texture texture 0.500000 -1 bone anim bone vertex texture vertex
+0.500000
+-1 = 0.500000 texture
+bone
+-1 = -1 vertex -1 vertex 0.500000 0.500000 1.0
+vertex texture = bone
+bone = texture bone
+= = vertex
+frame material = frame
+= -1 bone = = -1 0.500000 -1
+bone = 1.0
+bone frame 1.0 -1 1.0 0.500000 material 1.0 0.500000 anim material
+0.500000 anim
+frame 0.500000
+material -1 1.0 -1 = 0.500000
+vertex
+1.0
+vertex frame = frame bone frame frame bone 0.500000
+-1
+material vertex material texture vertex
+vertex
+anim =
+material bone
+0.500000 vertex = 1.0
+material 0.500000 texture material 1.0 texture
+material 1.0 texture
+1.0 -1 0.500000
+1.0 -1
+bone 1.0
+frame material anim texture =
+anim
+1.0 texture = = texture texture bone
+= anim material 0.500000
+anim
+= = -1
+bone anim = -1
+bone =
+vertex = 0.500000 frame 0.500000 frame frame
+=
+bone
+bone frame bone
+-1 bone -1 = 1.0 anim
+bone
+=
+1.0 material 0.500000
+1.0 = material anim bone bone material material bone
+= vertex 1.0
+0.500000 1.0 -1 frame 0.500000 texture texture vertex anim material anim 0.500000 anim
+frame 1.0 material frame material texture bone
+bone
+= frame frame -1 vertex -1
+texture frame
+bone
+1.0
+material
+material texture
+bone
+anim anim material 1.0 anim
+anim bone =
+material 0.500000 frame anim
+material material vertex
+= = frame bone frame texture texture 0.500000 = -1 material
+anim anim texture vertex 0.500000 1.0 texture
+-1 0.500000 bone frame frame 0.500000 vertex -1 = 1.0
+anim = bone texture
+0.500000 texture -1 vertex = -1 bone
+0.500000 -1 bone texture texture
+bone
+= 0.500000 1.0
+material bone -1 = anim
+material = anim
+bone
+-1
+material
+frame =
+vertex -1
+texture anim material 0.500000 -1
+= anim texture vertex 0.500000 texture 0.500000 anim 0.500000
+0.500000 anim material frame
+1.0 texture -1 material
+= 0.500000
+frame
+1.0 vertex anim material material texture -1 anim 0.500000 frame bone texture
+1.0 anim frame 1.0
+vertex
+-1 vertex
+vertex
+anim anim frame
+frame
+bone
+0.500000 -1 texture texture anim 1.0
+bone bone material bone bone
+=
+1.0 1.0 bone anim 0.500000 = anim 1.0 bone 1.0 -1
+material
+material = frame anim texture
+0.500000
+anim 1.0 vertex = anim anim vertex bone bone
+texture
+frame bone 0.500000 -1 0.500000 1.0 bone material
+bone material frame = 0.500000
+frame frame 0.500000
+0.500000 anim
+texture texture
+= bone anim 0.500000
+= material material 0.500000 material -1 vertex material material bone bon
\ No newline at end of file
@@ -0,0 +1,20 @@
+texture bone
+1.0 material vertex anim
+0.500000 = vertex 1.0 texture texture = vertex
+0.500000
+anim
+frame material 1.0 vertex material vertex
+texture anim 1.0 anim = 0.500000 0.500000
+anim
+bone frame material 1.0
+texture 1.0 anim
+frame frame
+bone material
+0.500000 bone bone vertex
+anim vertex
+= bone anim 1.0 texture bone -1
+= frame bone = vertex
+-1
+anim frame anim
+frame bone anim bone
+vertex vertex material fram
\ No newline at end of file
@@ -0,0 +1,193 @@
+vertex material
+vertex = 1.0 frame 1.0
+0.500000 bone
+texture texture 0.500000 = 0.500000
+bone
+anim 1.0 0.500000 texture 0.500000
+vertex
+frame
+frame -1
+= 0.500000
+-1
+1.0 material = frame anim -1 vertex texture bone
+bone anim bone anim anim = = 0.500000 0.500000 frame
+frame
+material texture -1 frame =
+vertex
+vertex bone material 0.500000 material texture vertex 1.0
+vertex
+vertex bone frame -1 texture material
+-1
+0.500000 vertex
+anim material =
+= material
+vertex = 0.500000 material
+frame anim frame
+0.500000 anim anim
+texture anim 0.500000 1.0 0.500000 anim
+material 0.500000
+bone
+vertex 0.500000 = 0.500000 vertex 1.0 1.0 = vertex anim 1.0
+1.0 texture material -1 texture texture
+0.500000 frame vertex
+texture 0.500000 anim bone texture material material vertex bone =
+material = material frame vertex =
+anim 1.0 -1 1.0 = -1 frame
+material bone material material frame frame 1.0
+vertex = =
+vertex
+anim 0.500000 -1 bone
+-1 material
+-1 = material
+anim bone 0.500000 1.0 = =
+bone vertex 0.500000
+material bone
+material frame 1.0 vertex = texture = 1.0 0.500000 texture -1 anim texture vertex
+1.0 -1 1.0
+bone = 0.500000 frame
+texture = 1.0 texture
+vertex
+texture bone texture 0.500000
+=
+material
+anim = -1 vertex
+frame vertex 1.0 material 0.500000 material frame vertex vertex bone = -1 anim
+material -1 0.500000 0.500000 1.0 frame frame 1.0 bone
+= 1.0 1.0 -1 frame
+material texture
+vertex 0.500000
+frame -1
+vertex
+vertex bone texture = bone bone 1.0
+0.500000
+texture anim vertex frame 0.500000 material = bone 0.500000 0.500000 texture
+1.0 = frame
+=
+texture material
+1.0 1.0 1.0 bone
+0.500000 bone
+1.0 0.500000 frame = 1.0 0.500000 1.0
+frame 0.500000 texture bone 0.500000
+bone material texture frame -1
+texture material bone 0.500000 = -1 -1 material = 0.500000 material = 1.0 texture frame -1 = frame texture -1 bone vertex
+material frame material material texture -1 anim
+0.500000
+= 0.500000
+bone bone texture
+bone material bone -1
+1.0 anim
+material vertex 1.0
+=
+0.500000 bone = -1 anim bone 0.500000 frame vertex texture texture
+bone anim material texture frame -1 anim
+material bone = anim material bone
+texture
+bone material -1 vertex vertex 0.500000 1.0 0.500000 texture -1 bone bone
+vertex material
+anim frame texture
+0.500000 material
+texture
+bone material 1.0 bone
+texture anim anim
+anim vertex bone bone frame
+vertex anim 0.500000 1.0 = 0.500000
+anim anim
+vertex vertex = anim 0.500000 1.0
+1.0
+1.0 bone anim frame frame
+material vertex
+bone -1 1.0
+-1 bone
+material material 1.0 1.0 bone -1 bone
+vertex anim
+anim 1.0 0.500000 0.500000 0.500000
+1.0
+vertex anim 1.0
+0.500000 -1 anim
+vertex
+material
+= 1.0
+0.500000 material frame bone vertex bone frame texture vertex texture
+0.500000 0.500000
+frame
+bone
+anim texture frame texture 0.500000 material 1.0 = frame frame
+texture
+vertex texture
+texture anim -1 material bone -1 0.500000
+frame
+material vertex
+0.500000
+1.0 texture 0.500000 texture
+vertex frame vertex frame
+anim bone -1
+1.0 0.500000 frame texture
+bone bone 0.500000 vertex material bone -1
+frame 0.500000 1.0 1.0 material vertex anim -1 -1 bone -1
+0.500000 anim frame anim
+=
+bone
+= = anim frame material texture frame
+vertex
+frame vertex vertex frame -1 bone 1.0 1.0 1.0 texture bone
+material bone anim -1
+=
+texture material = frame texture
+= material 0.500000
+anim
+frame
+0.500000 = vertex
+= vertex 1.0 frame
+1.0
+-1
+-1 frame bone
+0.500000 0.500000 bone -1 -1 vertex frame 0.500000 vertex -1
+1.0 anim bone
+=
+-1 anim = -1
+=
+texture
+-1
+anim
+frame anim frame 1.0 frame 1.0 1.0
+frame -1 0.500000 texture vertex material anim
+frame
+0.500000 frame
+1.0 bone
+vertex 1.0 vertex = vertex
+anim frame
+frame vertex 1.0 texture
+-1 = anim 0.500000 anim material vertex
+vertex 0.500000 -1 vertex material
+-1 = bone
+1.0 anim -1 texture
+material vertex material bone material texture -1 frame -1 frame 1.0 = = bone frame material
+anim = -1 = 0.500000 vertex vertex texture texture vertex anim frame
+-1 1.0
+frame material -1 1.0 0.500000 anim texture
+1.0 texture
+vertex = frame material anim 0.500000 material = = 1.0 anim
+vertex anim bone =
+bone -1 bone 1.0 -1 0.500000
+-1
+vertex vertex
+1.0 1.0 0.500000 texture bone -1 bone texture -1 texture texture texture bone = frame 1.0
+texture 0.500000 texture bone = -1 texture
+= =
+bone
+-1
+vertex texture 0.500000 material anim = frame 1.0 material frame
+0.500000 texture bone frame 1.0 anim frame 1.0 1.0
+texture -1 anim bone
+0.500000 bone
+1.0 vertex texture 1.0
+= bone bone
+0.500000 frame texture anim texture bone 1.0 texture
+vertex frame bone 0.500000 1.0
+frame
+frame anim material
+material vertex vertex material bone
+1.0
+bone
+frame frame 0.500000 frame 0.500000 vertex material bone
+0
\ No newline at end of file
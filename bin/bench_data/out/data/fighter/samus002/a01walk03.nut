@@ -0,0 +1,30 @@
+0.500000
+anim bone
+material vertex texture
+-1 0.500000
+anim material texture = texture
+frame texture vertex material
+vertex 0.500000 1.0
+anim
+-1 0.500000
+frame = vertex = texture
+-1
+vertex bone anim texture bone frame
+material material frame
+-1 anim vertex bone bone anim anim anim
+vertex 1.0 vertex
+vertex 1.0
+0.500000 texture = 0.500000 material
+frame vertex 0.500000
+-1 anim
+1.0 -1 frame = anim anim
+anim =
+-1
+vertex frame
+-1
+0.500000 anim
+material
+frame -1
+texture
+= vertex
+material texture material bone material
\ No newline at end of file
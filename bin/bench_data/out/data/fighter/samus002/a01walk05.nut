@@ -0,0 +1,112 @@
+texture anim 1.0 material -1 0.500000 bone
+frame frame texture
+material
+material material = material
+frame bone anim 0.500000
+bone vertex
+frame -1 frame
+-1 frame frame material bone frame
+anim anim
+material
+bone bone 0.500000 bone material 0.500000 texture material
+texture material bone = -1 texture texture texture
+bone
+material
+anim 0.500000 bone =
+-1 -1
+anim 1.0 texture 0.500000
+anim anim
+vertex 1.0
+frame texture = frame texture vertex 1.0 1.0 texture
+=
+texture
+anim 0.500000 0.500000 material vertex
+texture bone 1.0 material anim -1 anim
+bone anim 0.500000 frame 0.500000 vertex material bone
+frame anim anim material material 1.0 texture 1.0 1.0
+anim anim anim vertex frame anim 1.0
+0.500000 0.500000 material texture material material material bone material
+bone 1.0 frame vertex
+material = 1.0 bone
+0.500000
+frame frame material
+anim
+1.0 bone vertex = =
+1.0
+material bone 0.500000 0.500000 anim vertex bone material 1.0 texture
+= material
+frame 0.500000 vertex anim -1
+frame
+vertex bone = material 1.0
+0.500000
+vertex texture
+bone
+vertex
+material -1 0.500000
+texture 1.0 vertex = bone bone
+= material
+frame 1.0 material
+1.0 vertex vertex
+anim 1.0
+anim material
+vertex -1 texture 1.0 0.500000 -1 0.500000 0.500000 -1
+-1 anim 0.500000 material frame
+texture material 0.500000 0.500000 anim vertex -1 frame vertex texture bone
+frame bone bone -1
+=
+vertex
+vertex -1
+1.0 texture bone frame
+material = 0.500000 frame =
+vertex 0.500000
+bone 1.0 anim 0.500000 -1 1.0
+-1 = frame anim = anim material anim material 1.0 anim frame texture 0.500000 anim = frame
+0.500000
+frame bone = frame -1 = -1
+bone = -1
+-1 -1
+frame -1 = frame 0.500000 texture anim 0.500000 frame =
+-1 vertex
+1.0
+texture anim
+anim material
+texture
+0.500000 = 0.500000
+texture
+anim 0.500000
+0.500000 1.0 0.500000 frame 1.0 texture frame frame frame texture
+anim vertex -1 vertex material vertex material material 0.500000 0.500000
+frame material
+1.0
+frame texture texture bone 0.500000 =
+0.500000
+0.500000
+= texture frame = 1.0
+=
+anim = 1.0
+=
+=
+anim 0.500000
+0.500000
+= 0.500000
+bone = 1.0 anim frame anim -1
+-1 = texture frame vertex vertex texture material -1 = material = texture frame material 0.500000 0.500000 1.0 =
+1.0 = bone
+bone 1.0 vertex
+anim -1 = material anim -1 frame -1
+0.500000 1.0 vertex =
+texture
+1.0 frame texture bone 0.500000
+0.500000 texture -1 texture
+anim -1 bone frame bone
+= frame material
+frame
+bone frame frame anim anim -1 frame
+frame bone frame vertex 1.0 = texture texture 1.0
+1.0 texture -1 texture 0.500000
+frame frame
+anim -1 anim texture
+1.0 anim -1 bone texture 1.0 -1 bone anim material 1.0 bone texture -1 bone
+vertex -1 = bone anim bone material 0.500000 = 0.500000
+= frame
+ver
\ No newline at end of file
@@ -0,0 +1,72 @@
+-1 -1 material 1.0
+1.0 1.0 vertex bone frame
+texture = texture -1 texture
+vertex material anim vertex -1
+1.0 anim 0.500000 bone = texture
+1.0 material anim = -1 vertex bone 0.500000
+material
+anim texture anim
+1.0
+bone texture vertex vertex vertex anim 1.0 frame
+-1 = 1.0 frame
+frame 0.500000 material bone texture bone bone 0.500000 material vertex bone texture 1.0
+texture material = vertex -1 0.500000
+1.0 = 1.0 -1 bone anim vertex
+1.0
+bone anim 0.500000 texture
+vertex
+bone
+frame
+texture vertex anim
+texture
+0.500000
+1.0 bone -1 1.0
+1.0 vertex
+frame frame -1 0.500000
+-1
+1.0 -1 -1 -1 anim 0.500000 material bone 0.500000 bone
+bone bone frame material vertex vertex 1.0 = 1.0
+bone material
+0.500000 -1 frame texture texture frame material anim -1 texture 1.0 material texture
+material anim vertex = bone material material anim = anim -1 1.0 =
+-1 anim frame material =
+anim anim -1 vertex frame anim
+anim 0.500000 1.0 bone 1.0 bone material
+vertex 1.0
+-1 -1 vertex vertex
+bone
+anim 1.0 1.0 =
+vertex
+1.0 =
+anim vertex vertex
+frame anim 1.0
+texture -1 texture frame anim -1 material = anim
+bone -1 =
+texture texture
+texture = = = texture texture vertex
+1.0 -1
+texture material material = texture -1 vertex frame material bone
+vertex texture
+frame bone bone anim
+material material bone = material
+0.500000 = = bone = 1.0 vertex
+frame vertex = 0.500000 =
+material
+1.0 bone
+-1 1.0 0.500000 1.0
+1.0 vertex 0.500000 1.0 vertex material bone
+-1 frame = material 0.500000 =
+bone anim -1 anim bone -1
+material material 1.0 =
+texture 1.0 vertex bone
+bone anim = anim texture anim -1 = frame texture
+texture frame
+0.500000 anim vertex 1.0 = 1.0 vertex 1.0 0.500000 vertex 0.500000 0.500000
+bone -1 vertex
+bone = =
+vertex
+= frame vertex
+material = bone frame 1.0 vertex bone
+material frame
+= texture bone 1.0
+0.500000 1.0 vertex 1.0 = texture 
\ No newline at end of file
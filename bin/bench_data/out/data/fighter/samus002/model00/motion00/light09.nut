@@ -0,0 +1,9 @@
+bone 0.500000 texture = anim
+-1
+1.0
+material bone
+1.0
+0.500000 1.0 0.500000 material 0.500000
+= texture vertex frame texture material
+frame texture anim -1
+frame mat
\ No newline at end of file
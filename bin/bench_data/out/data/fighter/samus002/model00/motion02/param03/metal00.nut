@@ -0,0 +1,195 @@
+anim
+material
+frame texture material texture 1.0 material
+-1 1.0 frame 1.0 0.500000 0.500000
+material anim 1.0 0.500000 texture -1
+anim texture = bone 0.500000 bone frame 0.500000 bone frame
+texture 1.0 0.500000 texture vertex
+material material vertex
+-1 -1 vertex material -1 = bone -1
+frame texture
+= material texture 1.0 = = anim vertex frame 1.0 material material frame frame texture
+vertex bone frame vertex bone vertex
+-1 -1
+material material
+-1 vertex bone frame vertex bone bone
+= material 1.0 bone = vertex
+texture
+frame
+0.500000 =
+material texture 1.0 1.0 vertex 1.0
+frame
+=
+vertex 0.500000 bone
+material
+frame
+= texture anim 0.500000 frame -1 anim
+material material
+1.0 vertex = anim anim
+vertex texture vertex
+= texture frame frame
+-1
+frame -1 0.500000 texture
+texture = -1 anim anim
+frame
+anim
+0.500000 material bone -1 vertex anim = vertex
+texture material bone frame texture 1.0 1.0 -1 vertex texture 1.0 -1 frame frame bone 1.0 1.0 -1 = -1
+frame = 0.500000
+-1 1.0
+-1 1.0
+bone bone bone = bone vertex
+1.0 vertex
+bone material material material frame
+frame frame 1.0
+material = texture -1 vertex -1 vertex
+anim -1 texture 1.0 texture
+bone 1.0
+1.0 vertex
+vertex 1.0 anim
+anim
+frame
+frame 1.0
+bone
+=
+1.0 0.500000 = vertex bone
+-1
+texture vertex texture bone
+frame texture material
+texture material = 0.500000 = -1
+=
+texture material 1.0 texture
+-1 bone vertex
+-1 vertex
+1.0 1.0
+frame frame = = texture texture vertex vertex 0.500000 0.500000 frame = frame texture texture texture
+bone anim
+bone material texture frame vertex 0.500000 vertex bone vertex 1.0 = = texture texture vertex -1
+texture texture =
+texture frame
+texture texture anim material 0.500000
+vertex texture anim
+bone texture 1.0 material vertex =
+vertex texture
+material material -1 anim 0.500000 anim 0.500000 -1
+material -1 -1 bone material -1
+0.500000
+0.500000 0.500000 0.500000 texture 0.500000 0.500000 bone
+anim texture
+texture anim bone material
+1.0 = texture vertex
+anim anim vertex texture texture
+bone bone
+anim
+= 0.500000
+= 1.0 1.0 0.500000 vertex -1 material
+1.0 1.0 1.0 anim
+=
+frame
+texture frame -1 = -1 material
+texture material frame frame bone texture anim
+vertex
+vertex = = vertex
+0.500000 material -1 -1 -1 1.0 0.500000 anim -1 texture material -1 0.500000 vertex
+texture bone texture material material
+material frame
+-1
+0.500000 material anim
+frame frame 0.500000 anim vertex bone frame 1.0 material
+frame
+anim frame material = material = material frame anim bone anim material frame texture texture 0.500000 -1 1.0
+= 1.0
+bone texture
+vertex anim material
+material 1.0
+frame
+bone material texture vertex material material
+frame frame 1.0
+1.0 0.500000 0.500000 -1
+= 1.0 anim
+vertex texture
+texture bone -1 anim = = anim texture vertex
+frame
+0.500000
+frame bone = 1.0 bone -1
+1.0
+= = anim texture 1.0 -1 material = 1.0
+0.500000 frame
+vertex vertex
+anim = material 1.0
+texture 1.0 anim
+texture
+frame -1 material -1 -1
+material -1 0.500000
+anim
+=
+= 1.0 frame bone bone frame
+-1 0.500000
+material vertex -1 material vertex = frame material vertex material
+bone vertex 0.500000 -1 frame 0.500000 1.0 = 0.500000 frame = = 1.0 vertex 1.0
+material 1.0 bone frame
+material material vertex bone 0.500000 vertex anim material
+material 0.500000 texture material = material 1.0 1.0 -1
+vertex -1 frame texture frame anim -1 1.0 anim
+vertex 1.0 vertex vertex
+1.0 frame texture -1 material vertex
+vertex texture
+bone bone bone material
+-1 -1
+anim bone = texture 1.0 texture 0.500000
+anim anim frame anim
+frame
+frame
+vertex 0.500000 -1 anim
+anim bone = anim
+vertex
+vertex
+-1
+anim -1
+1.0 =
+bone 0.500000 material 0.500000 anim -1 bone = anim
+frame
+frame frame = = 0.500000 vertex 0.500000 0.500000 anim
+bone vertex = 1.0 anim
+vertex texture
+1.0
+0.500000 anim 0.500000 material -1 0.500000 1.0 frame material anim -1
+1.0 1.0
+texture
+texture texture = 1.0 0.500000 -1 0.500000 0.500000 vertex
+anim -1 = anim anim = texture bone frame 0.500000
+0.500000 anim 1.0
+texture
+material
+=
+anim frame 1.0 = frame frame vertex vertex vertex material 1.0 vertex
+material
+1.0 =
+material texture 1.0 1.0 1.0 material frame 0.500000
+bone 1.0 anim 1.0 1.0
+material anim material 0.500000 frame -1 1.0 = -1 frame 1.0 -1
+1.0
+vertex material = =
+1.0 texture
+1.0 vertex 0.500000 1.0 material anim frame 0.500000 texture 0.500000
+anim vertex 0.500000 anim = 0.500000 vertex vertex anim -1 -1
+=
+0.500000 material frame = = material =
+0.500000 -1
+vertex = -1 anim 1.0 = bone bone vertex
+bone bone
+= texture texture
+vertex = frame -1 anim anim
+1.0 1.0 material
+bone
+vertex texture
+frame bone
+frame
+vertex texture material texture 0.500000
+material = texture 0.500000 anim texture texture 1.0 0.500000
+vertex frame frame = 1.0 0.500000
+frame 1.0 texture
+vertex -1
+1.0
+0.500000 bone anim bone =
+texture 1.
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 1.0 0.500000 bone frame material
+anim texture vertex
+material material 0.500000 
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone vertex anim texture
+anim vertex = material bone -1 bone bone
+1.0 0.500000 -1 frame frame
\ No newline at end of file
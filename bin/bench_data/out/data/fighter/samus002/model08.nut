@@ -0,0 +1,44 @@
+bone 1.0 0.500000 anim
+frame
+0.500000 material
+material anim frame = texture 0.500000
+vertex 1.0
+= frame 1.0 vertex
+vertex
+material bone
+= 0.500000
+1.0 = texture
+-1 anim 0.500000
+anim =
+0.500000 0.500000
+vertex 1.0
+frame texture frame frame vertex 1.0
+bone material 1.0 material anim = bone
+frame
+0.500000 bone = anim -1 material texture frame
+vertex
+texture
+anim bone =
+=
+-1 frame
+1.0 = anim
+material
+-1 -1 0.500000 material 1.0
+vertex bone frame vertex material = vertex
+texture material
+bone bone = 1.0 texture vertex texture texture 0.500000
+vertex material 1.0
+-1
+texture frame
+vertex material texture texture 1.0
+material
+anim 1.0
+-1 material 0.500000
+frame =
+-1 anim -1
+0.500000
+-1 anim texture anim 0.500000 material -1
+frame
+anim anim texture vertex texture frame
+bone -1 = -1 anim
+anim material = 
\ No newline at end of file
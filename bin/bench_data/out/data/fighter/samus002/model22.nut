@@ -0,0 +1,40 @@
+= 1.0 texture
+bone vertex
+= anim
+= vertex texture vertex
+= texture
+material 1.0
+vertex
+bone 1.0
+-1 bone material
+anim 0.500000 1.0
+anim
+0.500000 -1
+= texture
+anim
+1.0 bone 0.500000 material
+material vertex 0.500000 bone anim
+anim 1.0 anim
+-1 frame
+0.500000 0.500000 0.500000 material = frame bone 1.0 vertex texture
+material bone
+1.0
+bone
+anim 0.500000 texture
+bone texture
+-1 texture 0.500000 -1
+texture = texture 1.0 = frame bone =
+bone
+vertex anim -1 vertex anim bone =
+0.500000 texture = material material material 1.0 anim frame texture
+bone -1 -1 bone -1 0.500000 vertex -1 texture anim frame frame anim vertex 1.0
+texture material material
+1.0 vertex vertex texture -1 material anim
+frame
+vertex
+-1
+bone vertex
+bone vertex anim anim 0.500000
+anim -1 =
+-1
+0.500000 bone
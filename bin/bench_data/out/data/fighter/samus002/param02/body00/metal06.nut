@@ -0,0 +1,5 @@
+frame vertex anim frame texture texture
+vertex vertex anim
+vertex anim
+vertex
+mat
\ No newline at end of file
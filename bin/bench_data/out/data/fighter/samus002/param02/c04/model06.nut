@@ -0,0 +1,9 @@
+bone anim frame
+anim frame 1.0 -1 1.0 anim vertex 0.500000 1.0 vertex frame material
+anim 0.500000 anim 0.500000 material 1.0 1.0 =
+bone
+bone bone 1.0 0.500000 vertex anim
+vertex material vertex frame anim bone 1.0
+0.500000 -1 material
+0.500000 texture 1.0 bone frame
+text
\ No newline at end of file
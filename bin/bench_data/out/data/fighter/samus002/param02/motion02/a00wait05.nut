@@ -0,0 +1,2 @@
+ 0#6ŞD48:`նYQqfekUv	rxt,~yy &1BH[!5#b2&ExZ_V!nt+O
+Wb6n]2QuI!uUv9xKV7toc5Բl͌Y
\ No newline at end of file
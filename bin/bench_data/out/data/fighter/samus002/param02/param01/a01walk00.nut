@@ -0,0 +1 @@
+frame 1.0 = -1 = bone -1 -1 = material 
\ No newline at end of file
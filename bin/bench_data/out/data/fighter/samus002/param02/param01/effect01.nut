@@ -0,0 +1,224 @@
+bone 1.0 texture =
+frame
+bone vertex = 1.0 = anim 0.500000 bone material
+frame = material
+0.500000
+0.500000 = frame
+material texture bone texture anim
+frame =
+1.0 texture 1.0 anim 0.500000
+frame 1.0 frame 0.500000 1.0 vertex texture frame texture anim 0.500000
+-1
+-1 -1 frame material frame = 1.0
+anim 0.500000
+anim vertex 0.500000 bone frame
+texture material = bone vertex texture material material 0.500000 bone
+1.0 bone frame material -1 =
+0.500000
+anim 1.0 -1 texture -1 anim
+anim
+texture anim bone = vertex 0.500000
+1.0 vertex = material 1.0
+-1 -1 anim -1 material vertex
+= frame 1.0 bone -1 material 1.0 = -1
+texture 0.500000 anim = vertex material material
+texture 0.500000 1.0 0.500000
+material
+material
+frame
+anim bone material = = anim anim anim 0.500000
+-1 bone texture
+bone 1.0 = 1.0 bone texture texture = 1.0 frame -1
+vertex bone 0.500000 anim -1 -1 material texture
+-1 = vertex frame bone texture =
+bone 1.0 1.0 vertex
+material vertex 0.500000 = material texture 0.500000 frame 1.0 texture
+=
+= material 1.0 frame vertex -1 vertex 0.500000
+texture
+texture 0.500000 anim 1.0
+bone
+-1
+texture 1.0 -1 -1 vertex 1.0
+anim material bone -1 material bone
+vertex
+frame
+material = material =
+1.0
+-1 vertex texture
+anim
+0.500000 frame texture 1.0 = 1.0 0.500000
+=
+anim
+bone = 0.500000 bone bone
+material anim 1.0 anim 0.500000 anim 1.0
+0.500000 1.0 texture
+vertex -1 bone anim -1 anim texture -1
+frame 0.500000
+vertex vertex
+-1 bone vertex material 0.500000 bone = 0.500000 = frame -1 = anim
+frame = 0.500000 material 0.500000 frame bone vertex 1.0
+vertex material = -1 bone = =
+vertex bone -1 bone bone anim
+0.500000 -1 1.0 = -1 -1 1.0 material texture bone frame bone vertex -1 0.500000 0.500000 = vertex
+anim
+material
+1.0
+-1 anim texture -1 material 0.500000 1.0 frame 1.0 vertex bone
+0.500000 -1 texture =
+material
+texture -1
+bone texture material texture -1 bone anim frame 0.500000 anim vertex -1 texture material
+bone
+material frame frame 1.0
+frame 0.500000 frame 0.500000 frame material
+texture 0.500000 frame -1 =
+frame bone -1 vertex anim -1
+vertex = -1
+-1
+-1 material bone 1.0 = anim material
+1.0 material texture
+-1 -1 -1 texture bone anim 1.0 frame vertex bone
+-1 = 1.0 texture = frame -1 0.500000 bone
+-1 material
+anim texture
+frame 1.0 frame material = = =
+= =
+1.0
+material bone 1.0 0.500000 -1 bone 1.0 = texture material bone texture 1.0 bone
+frame -1 0.500000
+0.500000 0.500000 =
+anim vertex 1.0 frame 0.500000 frame anim texture frame material 0.500000 frame -1 bone bone material vertex
+texture
+vertex anim 1.0 material = 0.500000 frame
+vertex material = anim -1 bone
+bone -1 bone
+vertex
+material
+frame frame
+-1 0.500000 anim vertex vertex 1.0 0.500000
+vertex
+vertex -1 frame vertex -1 bone = anim bone frame bone
+vertex
+= 1.0 frame vertex texture frame
+vertex material vertex vertex
+bone
+material material frame 0.500000 material -1 anim bone material bone material anim 1.0
+anim texture 1.0 = 1.0 material 1.0 material 1.0 vertex frame 1.0 -1 anim = 1.0
+1.0 0.500000 -1 material
+frame anim -1 frame vertex
+= 1.0 1.0 anim material -1
+frame 0.500000 anim
+anim
+0.500000 material
+bone
+bone 0.500000 anim vertex 0.500000
+1.0
+vertex texture = 1.0 material 1.0
+1.0
+frame
+frame material material bone
+= anim 1.0 0.500000 bone 0.500000 bone
+0.500000 -1 texture material material material anim anim = anim
+texture
+1.0 anim 1.0 anim frame 1.0 0.500000 1.0
+material 1.0 = anim material
+frame vertex material material vertex
+= material anim -1 texture 1.0 0.500000 0.500000
+material material 0.500000
+vertex = bone 0.500000
+anim frame frame anim 1.0
+material texture vertex material
+texture
+material frame frame material material vertex = texture = = bone -1
+anim 1.0 texture
+anim
+anim
+-1 -1
+texture
+-1
+frame bone
+frame -1 bone 1.0 frame
+material 1.0 material anim -1 vertex vertex 0.500000 1.0 material
+material material = frame 0.500000 = material
+vertex texture anim texture =
+frame = 0.500000 0.500000 vertex
+0.500000 -1
+frame 0.500000 material
+vertex
+material bone frame bone material bone bone =
+anim bone material bone material 0.500000 frame 0.500000
+texture material =
+bone
+0.500000 -1 material = vertex frame
+vertex frame bone frame bone
+vertex = 1.0 1.0
+frame -1 texture
+texture -1 frame 0.500000
+0.500000 texture
+bone frame 1.0 vertex
+0.500000 texture frame texture -1 vertex texture -1 = frame bone texture =
+bone anim material anim texture 0.500000 -1
+bone
+0.500000
+material -1
+vertex frame
+vertex anim material texture
+vertex bone = -1 = texture
+1.0 material texture vertex frame anim 0.500000 material 1.0 = anim texture anim
+0.500000 anim
+anim
+anim
+texture 0.500000
+frame material -1
+frame texture -1 =
+texture
+vertex -1 -1 -1 = material
+-1
+material -1 anim
+frame material
+1.0 1.0 texture
+-1
+vertex frame = bone frame
+0.500000
+1.0
+anim vertex 1.0
+0.500000 vertex bone
+-1 bone frame bone -1
+vertex
+material frame
+texture
+frame texture
+anim anim
+= 1.0
+-1
+1.0
+1.0
+0.500000 vertex texture
+anim texture vertex material 1.0 bone vertex -1 1.0 bone
+material
+bone bone frame frame texture
+texture bone vertex
+0.500000 vertex bone
+material
+0.500000 material = bone anim texture
+1.0 vertex = bone bone frame vertex
+bone =
+= 0.500000 texture
+texture 1.0 vertex texture vertex material -1 material texture material -1 vertex 0.500000 frame frame
+bone
+texture
+0.500000 bone = 0.500000 0.500000 vertex anim
+vertex material material =
+frame 0.500000 bone texture anim 0.500000
+bone frame texture texture
+bone vertex 1.0 frame texture -1 texture 0.500000 1.0 frame bone
+material = 1.0
+anim vertex = 1.0 0.500000
+material texture
+0.500000
+material
+=
+-1 1.0
+-1
+anim -1 -1
\ No newline at end of file
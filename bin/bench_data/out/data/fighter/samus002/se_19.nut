@@ -0,0 +1,15 @@
+bone 0.500000 frame
+0.500000
+=
+anim anim anim material material =
+anim texture texture frame -1 0.500000 1.0
+vertex
+material
+0.500000 bone -1 0.500000 anim
+0.500000 texture anim vertex -1 vertex
+frame frame texture
+= frame -1
+texture
+-1 =
+anim frame 1.0 anim texture 1.0 texture 1.0
+vertex = anim 1.0 0.500000 texture anim anim material -1 1.0 frame
\ No newline at end of file
@@ -0,0 +1,109 @@
+= material 0.500000
+0.500000
+0.500000 0.500000
+-1 1.0 texture
+material anim = material texture
+anim vertex 1.0 material
+anim =
+material 0.500000
+material
+bone 1.0 0.500000 0.500000 anim 0.500000 vertex bone texture
+0.500000 vertex material material material anim material -1
+anim 1.0 1.0 texture frame 1.0 frame bone anim 1.0 frame bone anim frame
+material frame 1.0
+1.0 material material
+texture
+1.0 anim vertex -1
+bone vertex
+= bone -1
+bone material 1.0 frame material
+bone 0.500000
+0.500000 frame 0.500000 vertex anim frame 0.500000 anim = texture 1.0 frame -1
+bone bone 1.0 = texture
+bone frame vertex -1 material anim vertex
+frame 1.0
+bone material
+frame anim frame anim
+1.0 material -1 0.500000
+1.0 bone frame 1.0
+material anim bone
+frame = material 1.0 material frame anim texture vertex -1 =
+1.0 = bone
+-1
+anim frame bone
+= vertex vertex material = material
+vertex 0.500000 0.500000 bone
+-1 = frame = frame vertex -1 1.0 material frame
+vertex = 1.0
+0.500000 anim
+1.0 material 1.0 frame bone -1 = material
+frame texture texture anim vertex = 1.0 = material vertex bone
+1.0 1.0 bone anim 0.500000 1.0
+-1 vertex frame
+= 0.500000 frame frame texture
+bone texture -1
+anim
+texture anim texture anim texture material
+=
+texture frame material 1.0
+anim anim texture anim vertex =
+texture
+0.500000 texture anim bone anim = texture
+= bone 0.500000
+vertex
+bone = -1 vertex 0.500000 vertex frame -1
+texture
+= -1 =
+= anim bone 0.500000 material -1 anim =
+frame vertex -1 = material texture material bone texture texture anim anim material
+1.0
+1.0
+vertex 1.0 texture anim material 0.500000 -1 bone material
+material
+vertex texture
+-1 material
+0.500000 vertex
+= bone 1.0 1.0 vertex 0.500000 -1 -1 anim bone
+material
+frame 0.500000
+bone 0.500000 0.500000 = frame
+-1 anim -1 1.0 1.0
+material
+bone 1.0 frame 0.500000 = 1.0 frame
+0.500000 -1 -1 texture frame -1 texture anim frame material texture 0.500000 1.0 -1 0.500000 =
+material vertex vertex material anim frame
+bone
+frame
+-1 vertex
+material
+1.0 = bone vertex 1.0
+0.500000 vertex bone
+vertex texture
+material bone texture frame anim = -1 bone =
+1.0 frame
+1.0 vertex 0.500000 = 1.0 material vertex anim
+anim vertex
+texture 0.500000 frame -1 material 0.500000 vertex 0.500000 frame bone bone 1.0 1.0 texture bone -1
+texture 1.0 -1
+texture vertex anim frame texture
+texture frame =
+-1 =
+1.0 frame 1.0 frame 1.0 vertex bone
+anim -1 bone anim frame
+bone -1
+bone
+vertex anim -1 -1
+texture
+bone 1.0 material -1 frame anim
+0.500000 -1 frame vertex 0.500000 frame material bone = 0.500000 1.0 -1 0.500000 1.0 bone material bone vertex
+texture vertex
+vertex texture 1.0
+anim =
+= 0.500000 bone -1 -1 vertex texture -1
+material 0.500000
+-1 anim
+texture vertex bone texture -1 1.0
+0.500000 anim 1.0 anim -1 anim
+texture = bone
+= vertex 1.0 = texture anim bone
+verte
\ No newline at end of file
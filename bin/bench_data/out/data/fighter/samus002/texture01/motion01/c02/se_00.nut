@@ -0,0 +1,35 @@
+0.500000 1.0
+anim material material = =
+bone -1 1.0 vertex vertex anim
+material
+0.500000
+1.0 texture
+-1 = 0.500000 -1 texture bone = 1.0
+= frame vertex anim
+texture
+frame vertex
+0.500000
+texture 1.0 frame -1
+1.0
+0.500000 material anim
+vertex frame
+anim vertex -1
+frame material
+1.0
+-1 anim frame =
+bone material anim -1 -1
+bone texture -1 bone
+material
+= vertex anim
+frame
+texture =
+anim
+anim -1
+material 1.0
+=
+texture anim vertex -1 texture -1 frame
+frame
+vertex 1.0
+0.500000
+material = bone -1
+vertex ma
\ No newline at end of file
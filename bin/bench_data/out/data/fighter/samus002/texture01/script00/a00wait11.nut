@@ -0,0 +1,15 @@
+frame texture vertex = anim
+-1
+= anim =
+1.0 -1 -1 frame = -1 texture -1 0.500000 anim -1 vertex -1 texture = 1.0
+1.0 =
+texture -1 bone
+bone = 1.0 bone
+vertex frame frame
+0.500000
+-1 = -1 vertex texture anim texture 0.500000 bone -1
+texture -1
+= texture vertex anim frame
+vertex anim 1.0 -1 anim frame -1 -1 anim
+bone 0.500000
+= 
\ No newline at end of file
@@ -0,0 +1,2 @@
+= material vertex frame 1.0
+0.500000 0.500000 vertex frame 1.
\ No newline at end of file
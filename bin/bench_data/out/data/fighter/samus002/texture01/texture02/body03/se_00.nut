@@ -0,0 +1,2 @@
+s2Έ:Ћ
+gi^h}$g1Ol^ctgZ#~MuwHU6ecT,6\m2羧<b9~$ZԱ~/Ɖ%*}
\ No newline at end of file
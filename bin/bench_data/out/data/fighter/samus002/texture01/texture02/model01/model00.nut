@@ -0,0 +1,32 @@
+texture material 0.500000
+bone vertex anim 0.500000 1.0
+0.500000
+texture frame 0.500000 vertex -1 -1
+frame material anim frame 1.0 vertex = frame bone frame
+0.500000 bone 1.0 anim 0.500000
+= vertex material -1 material frame 1.0 texture frame 0.500000 0.500000 =
+-1 material material material material frame
+1.0 frame
+=
+frame =
+= -1
+0.500000 bone
+= -1 bone 0.500000 1.0 -1 frame material
+1.0 frame anim 1.0 texture 0.500000
+= = frame
+0.500000 anim
+=
+1.0 vertex 1.0 0.500000 0.500000 1.0 = vertex anim texture texture frame texture
+0.500000 0.500000 = bone bone -1 bone vertex texture
+material bone
+-1 frame bone
+frame
+bone vertex
+texture -1
+texture anim 1.0 frame bone bone material -1 anim material 0.500000
+0.500000 anim 1.0 texture frame material bone texture 1.0 texture 1.0 anim
+bone
+0.500000 material
+anim frame bone 1.0 bone bone = = bone 1.0 texture vertex -1 = 1.0 1.0 frame 0.500000 = =
+0.500000 vertex
+material texture = mat
\ No newline at end of file
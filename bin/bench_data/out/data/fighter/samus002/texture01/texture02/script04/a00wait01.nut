@@ -0,0 +1,278 @@
+material material 1.0 -1
+frame -1
+-1 texture bone
+bone vertex material frame
+bone texture = bone bone anim 1.0 bone 0.500000 texture frame 1.0 0.500000 1.0 frame
+material bone texture anim texture vertex 0.500000 anim -1 texture
+0.500000 bone
+1.0
+texture
+bone bone 1.0 material vertex
+vertex texture -1 material
+0.500000 frame texture 1.0 -1
+-1 material
+-1
+0.500000 texture vertex 1.0
+bone frame anim
+bone = = bone texture texture anim frame
+texture 0.500000
+= vertex material vertex bone 1.0 -1 frame 0.500000
+frame 0.500000 anim
+= 1.0 vertex 0.500000 texture 0.500000 bone = vertex
+0.500000 -1 frame material vertex vertex 1.0 vertex 0.500000 =
+bone = texture 0.500000 0.500000 anim frame material 0.500000
+-1
+1.0 material texture -1
+bone frame = vertex =
+vertex 0.500000 frame =
+1.0 texture 0.500000 material = 0.500000 bone = -1
+1.0
+-1
+anim anim
+0.500000 texture -1 vertex material = -1 anim = -1
+bone 0.500000 vertex anim frame
+vertex material frame
+frame
+vertex
+-1 vertex frame 0.500000 texture
+1.0 vertex material
+0.500000 -1 -1 bone frame -1 1.0 -1 vertex frame 0.500000 texture 1.0 texture vertex
+0.500000 -1
+texture bone vertex material 1.0
+vertex 0.500000 material 0.500000
+frame
+material frame
+bone
+texture
+bone vertex
+0.500000 frame 0.500000 material vertex -1
+texture =
+frame 0.500000
+bone frame material
+material = bone = anim anim -1 anim anim
+1.0 -1 1.0
+material -1 0.500000 frame vertex 1.0 frame anim 0.500000 bone anim texture
+anim -1 -1 1.0 = vertex
+= vertex
+frame
+texture
+vertex 0.500000 anim = anim material anim anim
+anim = anim texture -1 texture bone texture
+= vertex bone bone texture vertex texture material
+1.0 anim
+anim
+anim vertex texture
+1.0
+0.500000 0.500000 bone 1.0 vertex vertex 1.0 0.500000 material 0.500000 texture = bone material 1.0 0.500000
+frame material
+vertex 0.500000 1.0
+vertex anim frame -1 vertex
+frame vertex texture frame 1.0
+= material bone 1.0 texture
+-1 anim texture vertex =
+bone frame
+material anim frame 0.500000
+texture anim = = anim
+bone texture = anim
+frame =
+anim texture texture -1
+texture vertex
+= 0.500000
+material texture bone frame bone 1.0 -1 anim vertex
+texture = 1.0 vertex material texture 0.500000 = 1.0
+vertex bone -1 -1
+= bone
+bone frame = =
+1.0 -1
+0.500000 texture bone vertex -1 1.0
+texture
+texture -1
+0.500000
+1.0 vertex frame
+1.0 vertex bone bone material anim frame -1 -1
+0.500000
+vertex anim material anim vertex
+bone texture 1.0 bone material 0.500000 anim material bone 1.0
+= material bone frame 1.0 frame
+material
+anim texture
+texture 1.0 frame bone frame = -1 =
+texture anim
+vertex 0.500000 bone
+1.0
+0.500000
+texture frame material bone 1.0 bone vertex -1 bone
+frame 1.0
+-1 -1
+material 1.0 -1
+vertex
+= 1.0 0.500000 -1 1.0 frame texture material frame
+bone material -1 vertex
+frame = =
+0.500000 = 1.0 anim 1.0
+0.500000 material anim 1.0 -1 anim 0.500000
+=
+anim
+frame -1 frame -1 texture material anim
+texture = = 1.0 =
+0.500000
+vertex
+anim anim -1 = -1 = bone
+1.0 bone 0.500000 bone
+-1
+vertex texture 1.0
+texture 0.500000 1.0 vertex 1.0 material texture
+= -1 anim texture 1.0 material
+anim -1 0.500000
+vertex -1 bone texture 1.0 texture
+frame -1 -1
+texture frame bone anim
+= bone = texture
+material = 0.500000 1.0 frame
+material vertex = bone 0.500000 frame =
+material -1
+frame anim
+1.0 0.500000 anim bone frame
+frame 0.500000
+material
+frame 1.0 -1 -1 texture vertex
+frame bone
+texture material
+anim = = texture vertex -1 0.500000
+material
+-1 texture frame = 0.500000 =
+0.500000 1.0 material bone bone = vertex frame anim frame vertex vertex -1 texture 0.500000
+frame = 0.500000 bone
+anim material
+0.500000 material texture 0.500000
+1.0
+-1
+anim material = = vertex 1.0 -1 bone frame
+-1 bone material
+-1
+vertex bone 1.0 -1 =
+= texture 0.500000 0.500000 frame
+frame bone 0.500000 0.500000
+frame bone
+1.0 material bone bone 0.500000
+0.500000
+vertex 1.0 material
+texture frame 1.0 bone vertex 0.500000 0.500000
+anim anim texture -1 0.500000 bone vertex
+vertex -1
+anim material bone texture bone
+vertex
+frame bone
+anim -1 bone texture bone bone 0.500000 vertex vertex bone anim frame texture vertex frame
+-1 1.0
+= frame
+anim anim
+anim texture
+-1 -1 -1
+-1 bone -1 -1
+vertex 1.0 1.0
+= 1.0 anim texture bone bone =
+0.500000 anim frame texture
+1.0 = frame =
+-1 texture 1.0 frame
+= bone 1.0 0.500000 anim = =
+vertex material frame -1
+1.0 1.0 bone material
+1.0 frame
+= vertex
+0.500000 bone
+0.500000 -1
+texture
+anim 1.0 frame = 0.500000 1.0 1.0 frame anim material
+bone = anim material 0.500000
+1.0 = 0.500000 = bone
+bone vertex = texture 1.0
+frame -1
+frame 0.500000 bone -1 texture -1 bone
+anim -1 bone -1
+texture texture
+bone
+-1 bone 0.500000
+1.0
+material material
+-1 material frame bone bone material vertex vertex
+material material
+anim
+= 1.0 frame
+texture
+frame texture 1.0 1.0 frame = = vertex
+frame texture frame 0.500000 bone vertex = frame texture = frame 0.500000 texture vertex -1
+bone
+0.500000 anim vertex 0.500000
+0.500000 anim anim = frame bone vertex material
+bone anim
+bone vertex
+anim 1.0 1.0 =
+1.0 0.500000 0.500000
+frame
+frame = anim 1.0 texture bone
+bone material = material texture
+anim
+material vertex 0.500000 frame anim
+1.0
+anim bone bone vertex
+-1 = = material frame bone
+anim material -1 -1 1.0 -1 bone 0.500000 frame texture frame =
+-1 frame texture frame frame
+material
+frame vertex anim frame
+-1 anim 1.0 texture frame -1 1.0 vertex 0.500000
+frame material bone anim bone 1.0 frame frame
+0.500000 texture anim
+-1 0.500000 =
+anim vertex
+frame bone 0.500000 = vertex =
+texture vertex anim 0.500000 material
+vertex 0.500000 material anim material
+= 1.0 material 0.500000 -1 -1 -1 vertex 1.0 bone
+material
+bone vertex -1 -1 texture 0.500000 -1 = anim
+-1 -1 0.500000 frame vertex 1.0 = 1.0
+1.0 1.0 1.0 0.500000 vertex material
+vertex 1.0 = vertex
+-1
+bone texture
+material
+frame
+-1
+vertex texture 1.0 =
+= vertex 1.0 =
+bone -1 1.0 0.500000 -1 0.500000 material frame -1 bone frame anim =
+texture 1.0
+material
+1.0 0.500000 -1
+vertex texture = 0.500000 0.500000
+anim texture vertex bone
+0.500000
+= vertex
+bone material vertex =
+material vertex
+= material
+texture
+=
+=
+-1 frame
+anim
+texture 1.0 anim
+1.0 0.500000 vertex = texture
+bone bone anim -1 anim bone
+vertex
+anim -1 vertex 0.500000 texture texture frame 0.500000 material material frame = frame frame vertex frame 1.0 material vertex 0.500000 texture
+vertex -1
+anim -1 texture bone texture material anim 0.500000
+frame
+0.500000 frame
+frame = 1.0 -1
+bone
+frame
+0.500000 material
+frame texture vertex texture frame bone texture material -1 vertex
+texture material material texture material anim anim 0.500000 vertex 1.0
+vertex
+1.0 anim -1 1.0 vertex = vertex = texture 0.500000 bone material
+1.0 0.500000 -1
@@ -0,0 +1,13 @@
+anim
+vertex -1
+vertex
+1.0
+texture
+bone anim
+bone -1 -1
+texture bone material anim = 1.0
+=
+1.0 0.500000 texture 1.0 texture
+1.0 1.0 -1 0.500000 texture vertex vertex vertex -1
+frame bone vertex vertex
+-1 bone
\ No newline at end of file
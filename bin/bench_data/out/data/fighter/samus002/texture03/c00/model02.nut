@@ -0,0 +1,4 @@
+0.500000 vertex
+= texture -1 vertex bone bone bone
+material
+anim vert
\ No newline at end of file
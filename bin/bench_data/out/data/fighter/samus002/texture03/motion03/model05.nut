@@ -0,0 +1,3 @@
+]`|?kIO(0mz@!;-ew@}eY46}	!T
+<72|m݉vрڌlrV);R}m$ie\i1X	sC6"6G>~V(Z!3[O?-!].K{L8Hk$Ro\
+b~c{9Peza/_urjy@>1?uf33fyIOn&jP+SۖdQyifwL}Y96+{p$Ou,(8OD
\ No newline at end of file
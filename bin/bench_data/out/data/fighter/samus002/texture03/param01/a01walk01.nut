@@ -0,0 +1,120 @@
+texture -1
+vertex bone frame = texture anim material texture 1.0 material vertex texture 1.0 =
+vertex -1 texture = =
+=
+0.500000 = bone
+texture -1 -1 anim anim 1.0 material
+frame 1.0
+1.0
+anim texture 0.500000 vertex 1.0 frame anim texture 0.500000 = material 0.500000 = material vertex
+0.500000 1.0
+= bone texture vertex
+vertex anim
+vertex 1.0
+0.500000 0.500000 anim 0.500000
+anim frame texture bone bone
+= material
+texture material
+1.0 0.500000 anim
+texture material bone texture 0.500000 -1 -1 vertex 1.0 bone bone -1 -1 frame -1 = frame 0.500000 =
+frame
+= frame 1.0 bone frame frame 0.500000 vertex
+vertex material texture 0.500000 texture 1.0 texture
+bone texture
+=
+bone
+= material anim anim = = 1.0 vertex 0.500000
+anim anim 1.0 material material = = bone bone
+frame anim vertex
+1.0 frame vertex anim
+0.500000 frame 1.0 bone material frame
+anim
+-1 frame
+texture
+1.0
+0.500000
+1.0 -1 texture -1 -1
+bone material
+0.500000 vertex
+anim vertex
+anim
+=
+anim
+anim material frame material material anim bone = bone = frame bone
+= material -1
+frame material 0.500000 bone material 1.0 -1 = bone 1.0 bone = -1 -1 material 0.500000 = = vertex texture vertex material =
+vertex 0.500000
+0.500000 bone
+frame
+0.500000 = anim
+frame material anim material 1.0 frame = texture bone material 0.500000 bone -1
+-1 =
+1.0 -1 texture anim
+bone vertex -1
+frame vertex bone material anim bone vertex frame vertex vertex anim anim 1.0 1.0 vertex anim frame frame texture bone vertex = 1.0 0.500000 anim frame
+frame -1
+= texture vertex = = bone 1.0 0.500000 1.0 material 1.0
+0.500000 1.0 bone frame
+vertex = anim material
+= -1 -1 0.500000 -1 1.0
+bone texture
+= texture vertex bone frame 1.0 material anim anim frame texture 0.500000 texture -1 0.500000 0.500000 0.500000 -1 anim frame bone 1.0
+bone vertex frame
+frame vertex vertex texture 0.500000
+-1
+texture anim material vertex 0.500000 vertex anim
+1.0 texture 1.0
+frame = anim -1 texture -1 1.0
+= frame anim anim frame 1.0 = 1.0 =
+=
+0.500000 1.0 1.0
+1.0 1.0
+material 1.0 -1 vertex texture = bone = = vertex = -1
+= material bone = texture vertex vertex bone material anim 0.500000 0.500000 frame texture bone material texture bone anim material -1 material vertex 0.500000
+vertex frame anim frame texture vertex vertex = texture
+material 1.0 material vertex
+1.0
+= 0.500000 frame 0.500000 texture material bone 1.0 anim
+anim frame -1
+anim = 1.0 -1 anim
+= anim -1 material 1.0
+= vertex texture texture 0.500000 = bone bone 1.0 frame -1 = material texture 1.0 material
+material anim vertex -1 -1 -1 vertex
+anim frame bone
+1.0 = texture -1 material 0.500000 = material material vertex 0.500000 texture vertex
+frame texture 0.500000 -1 vertex
+frame vertex -1 bone frame -1
+-1
+texture texture
+0.500000 frame material anim 0.500000 texture
+0.500000
+material 1.0 bone
+1.0
+vertex anim bone
+texture material bone -1 anim material texture texture -1 0.500000 texture = texture texture
+frame bone
+-1 -1 bone -1 0.500000 bone 0.500000 material
+1.0 material material 0.500000 frame 1.0 -1 texture
+bone = = texture -1 1.0 anim material 1.0
+-1
+bone
+material texture anim material -1 0.500000 1.0 texture anim 1.0 -1 = anim
+vertex 0.500000
+bone vertex
+texture
+-1
+0.500000 material vertex
+-1
+1.0
+vertex = vertex 0.500000 -1
+1.0 material texture 1.0 frame
+bone
+material
+material vertex anim
+= 1.0 = texture 1.0 anim vertex bone texture
+frame -1 texture texture
+frame = = material
+bone 1.0 1.0 bone 1.0 vertex bone 1.0 anim
+bone material -1
+anim
+= material
\ No newline at end of file
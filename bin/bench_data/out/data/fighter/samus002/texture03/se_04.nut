@@ -0,0 +1,8 @@
+texture texture
+bone
+frame bone
+-1
+-1 vertex material 1.0 frame
+0.500000
+anim 1.0
+frame 1.
\ No newline at end of file
@@ -0,0 +1,29 @@
+material
+-1
+= = material material frame texture 1.0 material 1.0 -1
+bone frame
+1.0
+vertex bone
+material
+1.0 vertex 1.0
+-1 0.500000 0.500000 bone material 1.0 -1 frame = frame vertex 1.0 frame vertex material = vertex material = frame anim vertex anim 0.500000 anim
+-1
+frame material
+vertex frame texture texture 1.0 vertex 0.500000
+bone frame -1 anim bone anim =
+vertex texture 0.500000 = anim texture
+frame bone 0.500000 anim anim
+vertex 1.0 bone texture frame vertex
+frame anim =
+-1 bone
+material
+anim
+-1
+0.500000 = frame 0.500000
+= -1 anim bone
+texture bone material
+= material
+bone 0.500000
+vertex =
+-1
+vertex texture bone 0.5
\ No newline at end of file
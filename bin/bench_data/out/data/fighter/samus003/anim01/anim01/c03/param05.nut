@@ -0,0 +1,2 @@
+= vertex -1 texture bone material
+frame 1.0 = 0.500000 1.0 frame frame texture 0.500000
@@ -0,0 +1,4 @@
+frame 0.500000
+= frame
+= material frame
+= bone texture texture = 1.0 
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex = texture -1
+anim -1 1.0 = -1 = frame
+bone 0.5000
\ No newline at end of file
@@ -0,0 +1,211 @@
+= texture 0.500000 vertex texture texture
+anim
+1.0 bone material 1.0
+anim vertex texture anim -1 material texture bone
+0.500000 material bone bone -1 texture 0.500000 1.0 -1 anim -1 vertex vertex frame
+bone
+0.500000
+anim
+bone -1 0.500000 0.500000 frame 1.0 anim
+material 1.0 frame frame 1.0 frame
+vertex anim -1
+-1 anim material bone -1 frame vertex
+texture frame
+vertex anim 0.500000 =
+0.500000
+texture -1 material 0.500000 texture vertex
+material vertex texture anim anim frame 0.500000 = material 0.500000 0.500000
+bone
+texture = -1 1.0 anim texture anim 0.500000
+vertex
+bone frame
+0.500000
+anim material bone
+frame texture texture
+bone frame 0.500000 texture anim = 0.500000 material =
+texture 0.500000 = vertex
+= 1.0 bone = frame 1.0 = -1 texture -1
+0.500000 frame
+-1 0.500000 anim material
+1.0 vertex anim -1 1.0
+= 0.500000
+material anim -1 0.500000
+frame anim
+anim
+anim
+bone frame anim
+anim 1.0 -1 frame material 0.500000 vertex material material = 0.500000 material
+anim 1.0 anim bone 0.500000 material bone bone anim
+0.500000
+frame
+-1 = texture 0.500000 0.500000 anim 0.500000 material 0.500000
+1.0 vertex
+= frame
+= anim
+-1
+material = bone
+-1 0.500000 anim material frame frame 0.500000 -1 vertex frame = vertex -1 frame material -1 anim frame 0.500000
+anim texture 0.500000 bone
+vertex anim
+= material
+bone bone 1.0 material anim
+1.0
+1.0 bone
+=
+vertex frame material texture anim 1.0
+vertex vertex bone bone vertex bone bone frame =
+anim bone = texture texture
+bone vertex texture vertex frame 0.500000
+texture
+=
+material
+material bone 1.0 -1 1.0
+material frame
+1.0 frame material = vertex bone frame anim texture
+-1 = material texture vertex frame 0.500000
+0.500000
+1.0 = = = -1 vertex vertex frame = -1 -1 frame
+= 1.0
+bone
+= 1.0 1.0 1.0
+1.0 material texture
+material
+1.0 vertex texture texture = 1.0 anim anim material material
+-1
+-1 anim material vertex = = vertex 0.500000 bone bone texture material 0.500000 frame vertex bone bone vertex material =
+bone = 1.0 0.500000 anim
+0.500000 -1 1.0 =
+material
+material = = material
+0.500000 0.500000
+= bone
+vertex 1.0 bone
+texture
+vertex vertex vertex material
+-1
+vertex
+texture
+= texture = 0.500000
+frame vertex 1.0 = -1 anim
+= material anim 1.0
+material frame frame bone = texture
+-1 texture
+1.0
+=
+vertex material bone material bone = vertex anim bone
+0.500000 texture material 1.0
+vertex
+material vertex vertex vertex material frame 0.500000
+vertex
+anim anim anim vertex -1 0.500000 vertex = vertex anim
+bone 1.0 material vertex bone material vertex
+vertex = anim
+= vertex
+frame material anim = vertex bone bone -1
+anim bone frame texture texture -1 frame bone frame
+= frame frame 0.500000 frame -1
+-1 -1 =
+anim -1
+frame =
+-1
+vertex vertex = texture
+1.0 -1 anim frame 1.0 material frame texture frame bone 1.0
+frame
+vertex 0.500000 anim
+-1 1.0 texture = = 1.0 = material
+-1 vertex 1.0 0.500000 1.0
+vertex material anim bone
+frame anim anim vertex 1.0 1.0
+material
+anim = = 1.0 -1 vertex frame
+anim =
+= 0.500000 -1 frame texture -1 anim = material -1 vertex bone texture
+material texture =
+= 1.0 anim -1 material bone 1.0 -1 material
+anim material 0.500000
+0.500000
+vertex
+vertex vertex
+bone frame -1 texture anim anim
+-1 vertex
+frame 1.0 vertex bone
+0.500000 =
+bone 1.0 anim
+0.500000 1.0 = texture
+1.0 =
+bone frame vertex
+anim 0.500000 = 1.0 material
+frame bone 0.500000
+frame 0.500000 vertex material frame 1.0 vertex texture frame material 0.500000 anim
+texture = -1 1.0 vertex anim material = texture material vertex frame anim = 0.500000 vertex texture texture =
+= = vertex anim frame -1
+material material
+0.500000
+bone material texture = frame anim frame
+= frame -1 material 0.500000 frame anim
+1.0
+1.0 anim
+bone frame frame frame texture
+frame
+vertex
+anim
+-1 anim frame bone
+= vertex texture anim vertex
+frame anim texture bone
+= material
+frame 0.500000 0.500000
+frame
+texture texture
+vertex anim bone
+0.500000
+texture material
+-1 = 1.0 bone 0.500000
+vertex
+material material
+vertex
+vertex
+= 0.500000
+0.500000 1.0 0.500000 bone
+frame
+bone 0.500000 1.0 -1 vertex material anim -1 0.500000 frame anim texture 1.0 frame
+= 0.500000 -1 -1 vertex = anim
+anim vertex material
+anim vertex bone 1.0 vertex -1 0.500000
+anim
+anim material bone 1.0 anim frame material texture = material 1.0 vertex material material texture vertex vertex 0.500000
+0.500000 1.0 material 0.500000 vertex -1 bone anim -1 = = bone
+-1 vertex vertex anim anim vertex frame material texture vertex bone material
+1.0 vertex texture texture
+-1
+frame
+frame vertex bone -1 1.0
+1.0 bone vertex = 1.0 bone
+material material frame bone frame -1 frame
+texture frame
+material 0.500000 bone 0.500000 -1 =
+anim
+-1 texture material material -1 bone
+1.0 texture =
+anim
+texture 1.0 texture vertex material bone 0.500000 -1 material = 1.0 = anim vertex
+1.0 vertex = 0.500000 texture 0.500000 bone vertex
+1.0 material -1 texture
+0.500000 0.500000 texture material
+vertex
+-1 vertex vertex frame vertex = 0.500000
+anim 0.500000 = 1.0 bone frame
+frame vertex
+-1
+-1
+= 0.500000
+1.0
+frame
+0.500000 vertex anim vertex frame
+0.500000 bone
+-1 texture anim
+1.0 vertex -1
+= 1.0 frame bone material texture -1 vertex texture material
+frame
+anim anim 1.0 material -1 frame bone -1
+frame bone vertex
+anim material vertex bone anim 0.500000 bone 1.0 frame texture
\ No newline at end of file
@@ -0,0 +1,11 @@
+frame -1 0.500000
+-1 anim vertex texture texture
+anim = 1.0
+vertex
+0.500000 = anim 1.0
+texture vertex frame
+anim
+vertex bone = 0.500000 bone
+anim = -1 vertex
+bone
+material vertex 1.0 frame = te
\ No newline at end of file
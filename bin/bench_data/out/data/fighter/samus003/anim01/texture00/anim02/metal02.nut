@@ -0,0 +1,69 @@
+texture vertex bone texture
+frame = anim
+texture 0.500000 material anim bone vertex =
+-1
+= material frame
+bone 0.500000 1.0
+frame 0.500000
+material
+vertex -1 1.0 frame = 0.500000
+bone material texture material material bone -1 texture
+bone
+-1
+anim anim vertex vertex
+= anim 0.500000 0.500000
+material
+=
+bone 0.500000 -1 0.500000 material 0.500000
+anim frame 1.0 anim material 0.500000 = frame
+1.0 bone 1.0
+bone texture -1
+vertex anim
+=
+frame
+texture texture texture -1 anim
+frame
+= texture bone
+-1 anim
+anim
+anim 0.500000
+vertex material frame bone 1.0 vertex vertex
+material texture bone material vertex bone texture 1.0
+= 0.500000 1.0 0.500000
+-1 bone frame
+-1 1.0 -1 vertex -1
+1.0 texture
+anim -1
+frame 0.500000 material -1
+0.500000 texture
+bone -1
+vertex texture texture 0.500000
+-1 -1
+-1 anim 1.0
+material texture frame
+frame frame = -1 1.0 vertex
+0.500000
+texture vertex bone anim -1 material
+1.0 = material =
+frame anim anim
+bone material material texture anim bone
+1.0 anim bone -1
+= vertex
+vertex anim frame frame material frame 1.0 1.0 anim vertex -1 vertex texture
+bone texture anim anim material
+anim
+1.0 -1
+1.0 vertex = anim material anim texture vertex
+vertex bone bone
+bone = vertex
+material
+1.0 anim
+texture vertex
+=
+bone
+anim
+1.0
+frame 0.500000 -1 frame texture
+bone -1 vertex material 0.500000
+vertex
+frame b
\ No newline at end of file
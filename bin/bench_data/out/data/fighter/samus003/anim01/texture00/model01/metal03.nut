@@ -0,0 +1,74 @@
+0.500000 0.500000 bone 1.0
+texture -1 texture
+vertex 1.0
+texture
+0.500000 material bone
+0.500000
+vertex -1 anim vertex anim vertex 0.500000 frame
+-1 -1 bone -1 -1 -1 vertex vertex material -1 0.500000 material frame 1.0
+1.0
+0.500000
+1.0 bone
+anim 1.0 texture frame frame texture
+material 0.500000 -1
+vertex
+texture texture
+frame 0.500000 anim frame 0.500000 anim
+bone anim
+material anim vertex 1.0 -1 -1 0.500000
+material = frame
+=
+1.0 0.500000 vertex -1 1.0 frame
+-1 vertex -1 frame
+0.500000 bone -1 0.500000
+1.0 texture
+=
+0.500000
+anim
+frame
+material -1 material
+vertex vertex
+texture vertex
+material 0.500000
+vertex frame frame
+-1 anim vertex 1.0 0.500000 frame texture vertex
+0.500000 anim
+0.500000 bone frame material = texture frame
+vertex anim =
+material 1.0 material anim
+material bone anim bone
+bone frame -1 1.0 anim frame 0.500000 bone vertex bone
+bone bone = 1.0
+vertex
+anim
+0.500000
+material 0.500000 anim
+-1 anim 0.500000 frame = texture
+bone 1.0 material -1 bone bone frame
+anim 1.0
+anim = material = frame -1 =
+material material frame -1 material -1
+frame bone frame texture material =
+bone = texture material frame bone
+material = bone anim 0.500000 1.0
+0.500000
+= vertex frame vertex
+bone material texture -1 1.0 frame
+vertex frame
+0.500000 texture -1 -1
+frame vertex 1.0 -1 -1 0.500000 frame frame texture -1 vertex anim 1.0 = bone anim material
+1.0 vertex texture
+0.500000
+frame
+anim
+material -1
+texture
+texture frame = material
+material frame bone
+texture = texture
+frame 0.500000
+1.0 0.500000 frame
+bone
+texture anim -1 =
+material anim = anim anim -1 bone material anim anim
+material 
\ No newline at end of file
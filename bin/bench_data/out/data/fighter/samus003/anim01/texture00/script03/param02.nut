@@ -0,0 +1,48 @@
+-1 vertex -1 bone vertex 0.500000 material -1 texture
+=
+1.0 bone 0.500000 = bone
+texture -1 texture material vertex
+-1 0.500000
+0.500000
+texture material
+frame frame material vertex
+0.500000
+1.0 =
+texture frame vertex 0.500000 bone 0.500000 anim =
+=
+frame bone vertex 1.0
+texture
+bone
+-1 bone texture -1
+bone
+0.500000 frame
+frame texture
+0.500000 frame -1 anim
+texture
+vertex
+frame vertex frame vertex
+texture
+vertex
+-1 anim anim = texture vertex anim 1.0 -1 -1 frame 1.0
+material 1.0 bone = 0.500000
+bone = -1 bone vertex material 0.500000 material vertex vertex vertex vertex
+0.500000 vertex texture
+= vertex anim bone texture -1 -1 frame
+1.0 = 1.0 anim material 0.500000
+vertex 0.500000 = bone 0.500000 -1 = bone bone 1.0 0.500000 1.0 =
+=
+anim -1 material texture 0.500000 bone -1 -1 = material anim texture vertex
+1.0 1.0
+1.0 =
+vertex anim
+0.500000 bone
+-1 1.0 material frame anim texture texture vertex
+bone
+anim = 0.500000 1.0 1.0 material material anim
+= bone
+material frame
+material = = bone material
+0.500000 -1 vertex
+= bone = 1.0 bone texture
+material 0.500000 1.0 = frame material -1 anim frame 0.500000
+frame =
\ No newline at end of file
@@ -0,0 +1,6 @@
+vertex 1.0
+0.500000 0.500000 -1
+= 0.500000 1.0 frame 1.0 = frame -1 bone 1.0 0.500000
+anim vertex
+vertex bone 1.0
+1.
\ No newline at end of file
@@ -0,0 +1,69 @@
+frame 1.0 texture texture -1 frame 1.0
+0.500000
+vertex 1.0 1.0
+=
+material -1 anim texture = frame
+= 0.500000 = anim frame
+1.0 material = 0.500000
+bone vertex
+= material frame 1.0 -1 vertex
+frame texture vertex anim texture anim
+frame = anim
+0.500000 1.0 anim texture 1.0 -1 1.0
+= 1.0 material 0.500000 material bone bone = -1
+anim vertex texture -1 -1 1.0
+vertex material vertex 1.0 bone 1.0 material
+vertex = vertex = 0.500000
+anim =
+1.0
+anim vertex
+bone vertex anim material material texture
+vertex 1.0
+0.500000
+-1
+bone frame bone
+vertex =
+anim -1 frame anim anim
+= -1 frame -1 texture material bone vertex
+1.0
+anim
+anim anim 0.500000 bone 1.0
+=
+texture 0.500000 bone texture
+texture vertex 1.0 frame vertex material bone = material 1.0
+texture
+frame vertex -1
+texture
+material
+= -1 material bone bone anim
+material -1 vertex 1.0
+bone bone 0.500000 = texture texture texture -1 -1
+=
+-1 = vertex
+0.500000
+texture 0.500000
+anim anim vertex
+bone texture frame vertex bone vertex bone = vertex 1.0
+0.500000
+vertex 0.500000 1.0 bone frame frame 0.500000 frame material 1.0
+0.500000 0.500000 frame
+-1 material =
+texture frame -1
+0.500000 bone texture
+vertex -1 anim texture vertex bone texture vertex anim frame 0.500000 1.0 vertex -1 vertex
+anim bone
+frame material = bone 0.500000
+1.0 vertex texture bone
+-1 vertex frame material = = -1
+0.500000 vertex vertex
+vertex
+-1 anim vertex 0.500000 0.500000 texture frame 0.500000
+vertex vertex vertex texture material anim
+= 1.0
+material -1 anim
+frame
+-1 = bone material bone =
+anim
+texture
+material
+1.0 texture 0.500000
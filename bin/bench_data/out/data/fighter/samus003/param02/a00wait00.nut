@@ -0,0 +1,139 @@
+1.0 -1
+1.0 bone material vertex bone vertex frame vertex
+material 1.0 vertex
+anim 0.500000 -1 anim
+bone
+1.0 = vertex anim 0.500000 1.0 bone -1
+-1 texture bone
+0.500000 bone =
+frame anim
+frame 0.500000 anim material =
+-1 1.0 texture -1
+1.0
+1.0 1.0
+0.500000
+1.0 frame frame bone 0.500000
+frame material
+-1 bone 0.500000 vertex =
+=
+material texture material 0.500000 texture bone frame
+-1 vertex vertex -1 anim
+vertex = material
+bone
+anim material vertex = 0.500000 -1 anim bone 1.0 -1 material anim = bone 0.500000 bone vertex 1.0
+0.500000 bone 0.500000 0.500000
+1.0 -1 -1
+texture frame anim material vertex
+vertex bone vertex
+material -1
+anim = anim =
+anim material frame anim anim bone material bone 0.500000 frame texture 1.0 vertex
+-1 material
+1.0 0.500000 0.500000
+=
+= 0.500000 bone vertex = vertex
+anim 1.0 texture = -1 0.500000 = frame anim
+=
+material -1
+vertex anim
+1.0 1.0 bone
+bone
+anim -1 -1
+frame texture
+frame
+0.500000 -1 0.500000
+anim 0.500000
+material = anim material frame texture texture frame 0.500000 texture
+texture
+0.500000
+= = 0.500000 texture
+frame
+-1 texture material texture texture texture texture
+-1 = texture frame bone
+material 1.0 material 0.500000
+-1 -1 1.0 anim
+anim -1 anim
+texture material
+0.500000 -1 1.0 material bone anim = frame 1.0 anim bone material material texture
+vertex texture -1 texture material frame material frame
+0.500000 frame anim bone
+texture texture texture =
+frame frame bone 1.0
+bone
+material 0.500000 frame vertex bone
+texture 1.0 bone anim anim
+= 1.0 vertex
+material texture bone frame material
+bone
+frame bone material frame
+1.0 vertex -1 material -1 1.0
+frame
+material
+0.500000 vertex frame vertex =
+vertex frame anim
+-1 texture frame
+1.0 frame -1 anim anim
+-1 1.0 material vertex frame 0.500000 texture 0.500000
+vertex anim 1.0 material bone frame
+texture
+frame = frame material -1
+material
+0.500000 anim
+bone material anim texture anim material -1 frame 1.0 anim vertex 0.500000 frame 0.500000
+= frame = -1
+1.0
+-1 bone anim -1 bone material frame
+=
+-1 texture 0.500000
+bone 0.500000 frame texture
+material = texture texture vertex -1 bone frame 0.500000 0.500000 -1
+0.500000 texture -1 vertex
+bone -1 material bone material
+vertex = -1
+texture texture = vertex bone
+material
+anim -1 vertex
+0.500000
+anim material
+1.0 anim
+bone = anim frame = texture = anim frame frame material = = anim bone anim bone
+material 1.0 material frame bone -1 texture -1 material material -1
+= material
+0.500000 0.500000 vertex
+-1 1.0 bone frame -1 texture bone -1 texture -1
+material 0.500000
+1.0 = 1.0 vertex vertex = -1 bone
+= texture vertex material texture texture
+frame texture frame
+1.0 0.500000
+frame 0.500000
+frame texture = 1.0 texture vertex bone anim texture vertex -1
+anim frame -1
+anim 0.500000
+-1 = -1
+material material
+-1 material texture 0.500000 frame
+-1 0.500000 anim
+0.500000 anim
+anim
+= material
+0.500000 frame 1.0 bone bone frame anim vertex material 0.500000
+0.500000 bone
+1.0 vertex
+frame
+0.500000 bone 1.0 anim frame 0.500000 texture vertex = anim 1.0 vertex
+material
+anim
+material texture 0.500000 vertex = 1.0 bone
+0.500000 0.500000 anim 0.500000 material frame -1 1.0 material anim
+anim
+frame vertex -1 bone -1
+vertex = =
+material -1 anim -1 anim texture
+0.500000 -1 = vertex -1 frame
+material vertex -1 texture bone frame frame
+0.500000 texture material
+0.500000 1.0 frame -1 material bone 0.500000 material
+material anim texture = =
+1.0 0.500000 texture 0.500000 0.500000 =
+-1 1.0 anim 1.0 0.500000 mater
\ No newline at end of file
@@ -0,0 +1,76 @@
+material
+= 1.0 vertex
+-1 = -1 = vertex
+anim 0.500000 1.0
+texture frame 1.0 material -1 frame vertex texture 0.500000 texture material 0.500000
+vertex texture bone
+= texture material texture -1 -1 1.0 vertex vertex material material bone frame -1 = = frame 1.0 material = material anim =
+vertex anim texture texture
+0.500000 material
+= 1.0 texture
+texture 1.0 material material
+= vertex bone
+texture
+1.0 material 0.500000
+texture
+bone -1
+0.500000 1.0 -1 bone
+1.0 texture frame 0.500000 vertex vertex anim frame bone 0.500000
+texture anim anim
+= anim 1.0 vertex
+material vertex
+material frame texture texture
+texture texture =
+anim
+= 0.500000 material
+texture texture -1
+anim = material =
+-1 bone anim
+frame anim 1.0 vertex -1 vertex vertex -1
+texture frame texture -1 frame texture
+material texture =
+=
+frame frame material
+= material 0.500000 frame anim 1.0
+vertex 1.0 frame
+texture
+texture bone material
+=
+-1 bone frame material
+bone
+1.0 frame 1.0 bone -1 1.0 texture
+= texture -1
+anim frame texture
+anim 1.0 texture -1 texture bone vertex
+= texture vertex texture anim 1.0 anim = -1 = anim
+frame = bone 0.500000
+vertex
+= bone frame 0.500000 material
+frame frame 0.500000 frame 1.0 = bone
+vertex 1.0 anim material material bone texture 1.0 anim frame
+0.500000
+-1
+vertex vertex
+frame bone -1 = 1.0 = -1 1.0 0.500000 bone texture frame -1 anim = frame -1 bone = vertex 0.500000 0.500000 material anim 1.0 = anim = = anim
+material vertex
+1.0
+bone bone
+texture
+1.0 vertex vertex material vertex = bone anim 0.500000
+1.0 = texture = frame
+frame
+bone = bone texture =
+vertex vertex 1.0 material bone
+material material
+0.500000 bone
+-1 1.0 material 0.500000 frame frame 0.500000 = 1.0 bone
+anim 0.500000 0.500000
+material vertex
+-1 1.0 frame 1.0
+-1
+= = -1 bone
+vertex
+0.500000 material 1.0 0.500000
+frame frame bone -1 = texture frame
+anim vertex
+material texture 
\ No newline at end of file
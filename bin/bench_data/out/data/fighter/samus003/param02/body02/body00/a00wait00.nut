@@ -0,0 +1,20 @@
+0.500000 = texture anim = 0.500000 texture frame 0.500000 = = -1 -1
+bone 0.500000
+-1 -1 bone frame bone
+bone 1.0 material anim bone = = bone bone material bone -1 anim -1 anim anim material frame material =
+-1 anim bone 1.0 material
+vertex bone 0.500000 anim
+=
+texture 1.0 texture = 1.0
+material
+material material
+vertex 1.0 anim texture 1.0 vertex texture
+anim vertex vertex bone =
+material
+0.500000
+=
+0.500000 = material 1.0
+-1 = bone
+-1 bone
+bone 0.500000
+0.500000 bone vertex -1 textu
\ No newline at end of file
@@ -0,0 +1,193 @@
+1.0
+= anim
+0.500000 0.500000 vertex 1.0 vertex
+= material
+frame
+material
+= texture 0.500000 bone
+= =
+material frame texture
+-1 = anim texture
+1.0
+material
+= bone
+texture frame
+-1 bone = texture
+= frame
+anim -1 material 1.0 texture
+1.0 1.0 -1 material anim 0.500000 0.500000 bone
+anim
+vertex frame material 1.0 0.500000 -1 anim bone
+= texture vertex
+material texture 1.0 vertex material bone bone bone
+vertex 1.0 frame material anim
+material -1 vertex
+1.0 bone
+-1 texture vertex 1.0
+texture bone
+material
+= anim -1 bone anim -1 anim
+texture 1.0
+frame
+material 0.500000 0.500000
+1.0
+1.0 = bone 1.0 vertex bone
+bone texture vertex frame material
+anim bone
+vertex 0.500000 anim
+bone 1.0 = 0.500000 = material = material
+vertex anim frame bone material vertex
+= anim = 0.500000 frame = frame 1.0 material
+texture
+1.0 -1 frame vertex frame 0.500000
+-1 -1
+0.500000 =
+0.500000 0.500000 material anim frame
+material vertex
+1.0
+material bone 1.0
+= 1.0 0.500000
+texture -1 bone
+0.500000 vertex
+0.500000 vertex
+-1 1.0 bone frame anim -1 = material texture frame =
+vertex
+material texture anim frame
+anim material 1.0 frame vertex -1 texture = 0.500000 -1 -1
+anim
+vertex
+-1 texture bone bone material anim 1.0
+anim vertex texture
+frame -1 frame 1.0 1.0 1.0 bone = vertex material bone material -1 bone vertex 1.0 texture frame -1 = vertex frame
+=
+material bone vertex vertex
+= bone 1.0 vertex
+-1 texture
+-1
+-1
+-1 0.500000 0.500000 0.500000
+texture texture -1 texture
+= = frame
+texture texture anim bone texture vertex
+0.500000 = = =
+frame 1.0 texture 0.500000 texture vertex frame vertex frame frame = anim frame -1 texture 0.500000 frame
+frame 1.0
+= frame =
+anim texture 1.0
+bone material -1
+bone
+anim 1.0
+0.500000
+=
+1.0 texture texture
+= = bone
+bone = 0.500000 texture vertex
+material 0.500000
+= vertex
+frame anim
+texture
+anim
+anim material 0.500000 material 1.0
+frame vertex
+vertex anim frame texture = texture vertex 0.500000
+frame 1.0 1.0
+1.0
+vertex frame
+0.500000 -1
+1.0 anim texture frame frame
+= 1.0 vertex
+= material material -1 = 0.500000
+-1 = 1.0
+material anim bone
+anim
+anim anim
+vertex vertex vertex bone material
+= bone
+-1 frame frame
+= frame
+frame -1 frame frame
+material bone frame bone 0.500000 =
+bone anim texture anim texture 1.0 material texture anim material
+-1 frame
+material
+anim material frame 1.0 frame
+= 1.0 1.0 bone -1 vertex anim vertex
+-1 bone 1.0
+-1 material bone -1 = texture = material
+0.500000 = 0.500000 0.500000
+vertex -1 0.500000 1.0 1.0 bone anim 0.500000 0.500000 frame vertex
+bone frame anim
+vertex 0.500000
+1.0
+anim bone frame texture vertex
+material material vertex texture -1 1.0 frame material
+anim 0.500000 0.500000 -1
+= -1 bone frame -1 bone = vertex frame 0.500000 bone 1.0
+vertex anim vertex
+material
+=
+material bone
+texture bone
+frame frame texture =
+frame 1.0 0.500000 anim material =
+= -1
+vertex 1.0
+anim 0.500000
+anim texture = 0.500000
+-1
+bone frame
+0.500000 -1 anim vertex anim
+bone anim
+texture texture 0.500000
+-1
+anim 0.500000 -1
+texture -1 material vertex texture texture bone vertex = material 0.500000
+texture material =
+material = 1.0 frame
+1.0 anim
+bone 0.500000 material -1 0.500000 vertex material -1
+1.0
+-1 1.0 bone vertex =
+-1
+1.0 material
+-1 vertex
+material anim
+anim texture frame anim material -1 -1 material anim
+material 1.0 1.0
+anim
+bone
+anim bone 0.500000
+0.500000 0.500000 frame =
+1.0 1.0 1.0 vertex texture
+bone bone frame frame = -1 bone
+frame 0.500000 -1 texture
+1.0 0.500000
+= frame
+0.500000
+= anim material
+anim frame 1.0 vertex 0.500000 texture
+frame bone texture = bone 0.500000 0.500000 1.0 material 0.500000
+material
+0.500000 -1 1.0
+vertex 0.500000 material 1.0 = = texture anim
+1.0 frame 0.500000 material material bone 1.0 -1
+= bone
+bone frame frame texture
+texture texture -1 material anim 1.0 =
+bone frame 1.0 =
+= frame
+material texture
+material
+frame bone
+material = frame anim
+-1 vertex 0.500000 frame vertex 1.0
+1.0 texture texture material bone 1.0 anim =
+vertex anim frame = =
+0.500000 -1 -1 -1 vertex -1
+0.500000 =
+frame anim =
+1.0
+1.0 material -1
+1.0 frame bone
+texture vertex 0.500000 0.500000
+material te
\ No newline at end of file
@@ -0,0 +1,221 @@
+frame
+-1 0.500000 texture
+material texture
+1.0
+=
+texture =
+1.0 0.500000 anim 1.0 frame
+vertex anim 0.500000 1.0 =
+frame frame vertex bone frame frame bone material
+0.500000 1.0 bone -1 bone 1.0 0.500000
+-1 anim
+= frame frame -1 1.0 material material
+1.0 1.0 -1 material texture bone vertex 0.500000 1.0
+vertex vertex 1.0
+-1
+bone =
+bone
+bone anim
+-1
+1.0 frame anim =
+-1 1.0 0.500000 -1
+bone bone 1.0 bone 0.500000 texture texture = 1.0
+= frame vertex anim
+-1 anim texture vertex
+material
+1.0
+bone = 0.500000 bone
+anim
+0.500000 material
+-1 vertex 1.0 = texture 1.0 vertex 1.0 texture = 0.500000 1.0 material -1 vertex material anim 1.0 anim = 0.500000 0.500000 0.500000
+-1 bone texture anim bone
+vertex vertex frame = = 1.0 vertex material vertex 1.0 material
+= 0.500000 frame 1.0
+0.500000 0.500000 frame
+frame anim material
+-1 bone vertex vertex = texture texture -1 0.500000 bone 1.0 vertex
+1.0
+material 1.0 bone 1.0 frame -1 0.500000
+frame
+frame
+texture bone = bone
+1.0 vertex vertex = texture anim texture 0.500000 texture 1.0 -1 bone
+=
+texture material frame
+0.500000 bone 0.500000 texture
+0.500000 material
+frame bone
+vertex vertex anim texture =
+material
+vertex 1.0 texture vertex texture
+bone material bone texture
+0.500000
+= bone -1
+0.500000
+0.500000 material 1.0 texture = -1 material anim -1 frame frame vertex
+frame frame anim 0.500000 anim texture material frame
+material 0.500000 1.0 anim bone
+-1
+vertex texture
+bone anim 1.0 = texture 1.0 = 1.0 -1 = = -1 material -1 anim anim -1 -1 0.500000 = material bone 1.0 vertex material frame texture bone material
+= bone texture -1 1.0 bone 0.500000 1.0 anim material
+texture
+texture
+material vertex bone -1 1.0 vertex
+vertex
+0.500000
+0.500000 1.0 anim -1 vertex 1.0 anim
+material -1 anim 1.0 0.500000 0.500000 material vertex material
+bone
+1.0 -1
+anim
+bone 1.0 texture vertex frame 1.0 texture vertex material = material
+1.0 vertex
+material = bone
+-1
+= -1 frame 0.500000 =
+bone
+1.0 bone -1 material = anim 1.0 vertex frame -1
+0.500000 texture
+vertex
+-1 = 0.500000 0.500000 material anim material vertex -1 = frame = material 0.500000 bone vertex vertex
+-1 material
+anim
+vertex texture frame 1.0 bone
+texture -1 frame frame texture texture 1.0 anim = vertex anim
+vertex anim -1 texture frame material
+= frame -1
+= texture 1.0
+0.500000 bone
+bone vertex
+-1 frame frame
+-1
+0.500000
+0.500000
+=
+1.0 vertex =
+anim =
+bone -1
+0.500000 0.500000 material vertex vertex material frame material
+0.500000 material = = bone vertex vertex
+1.0 1.0 anim bone frame bone anim bone
+anim
+= 1.0 1.0 0.500000 anim bone frame
+frame frame
+0.500000
+= -1 = material -1 = 0.500000 anim texture
+texture = anim -1 -1 bone material
+=
+= bone
+anim 0.500000 bone material
+0.500000 0.500000
+bone anim 1.0
+bone frame = material 1.0 bone texture bone -1 1.0 texture =
+frame -1 frame = anim vertex -1
+bone material anim material anim vertex texture 1.0 material
+vertex texture =
+bone
+= bone bone 1.0 0.500000 frame
+anim -1 material frame vertex texture
+material texture
+= vertex anim frame
+vertex frame bone 0.500000 vertex
+1.0 bone material material
+1.0
+texture -1 material -1 material =
+bone anim
+bone -1 frame -1 anim =
+frame anim
+bone vertex material
+-1 -1 texture 1.0 bone 1.0
+material anim 1.0
+0.500000 bone
+-1 vertex
+vertex 1.0 = anim material vertex 0.500000 0.500000
+texture = frame bone bone =
+texture
+material 0.500000 material bone 1.0
+vertex
+bone
+material
+= -1 material vertex material 1.0 0.500000 -1 texture texture -1 texture vertex -1 1.0 1.0
+anim
+texture bone
+= anim vertex 0.500000
+bone -1 -1 =
+bone 0.500000
+0.500000 -1 texture 0.500000
+material
+anim vertex = texture -1
+= =
+1.0 vertex
+frame 1.0 vertex
+0.500000 material material vertex bone vertex vertex anim 1.0 0.500000 = 0.500000
+= -1
+vertex texture = frame material 1.0 frame = material = frame -1 vertex texture 0.500000 anim 0.500000 1.0 = =
+material = = bone 1.0 0.500000 texture 0.500000 0.500000 anim
+= = frame
+0.500000 anim = -1 -1 anim = texture
+anim
+material -1 1.0 anim
+bone vertex material bone bone anim -1 frame
+texture = -1 anim bone texture frame 0.500000 -1
+frame
+material 1.0
+-1
+= frame 1.0 vertex
+material bone texture
+0.500000 1.0
+0.500000 bone material frame 1.0 anim
+material
+material bone texture
+texture
+1.0 -1 bone = frame 0.500000 1.0 = texture anim
+frame
+vertex = anim
+frame anim bone -1 bone anim
+-1 frame
+material texture -1
+bone 1.0 1.0 1.0 1.0 1.0 vertex texture material 1.0 frame -1
+-1 texture -1 vertex texture anim = 1.0 -1 anim
+=
+anim bone vertex
+1.0 anim
+frame material bone
+material frame
+0.500000 0.500000 = 0.500000
+material
+vertex frame frame texture anim = vertex = 0.500000
+1.0 frame frame texture bone bone vertex
+material frame -1
+anim material bone
+material vertex anim 0.500000 bone 1.0 vertex bone frame
+=
+vertex
+frame
+1.0
+anim material
+=
+-1 vertex
+bone frame
+0.500000
+-1 -1 texture = bone anim
+1.0 anim
+bone frame 1.0
+0.500000 = frame material texture vertex material 0.500000 0.500000 0.500000 material material 0.500000 vertex anim = texture 0.500000
+1.0 vertex -1
+texture material
+frame 0.500000 frame vertex
+anim frame frame frame material material 1.0 anim = 0.500000 vertex = -1 vertex
+1.0 = frame -1 = =
+= -1
+vertex frame frame
+frame
+anim
+bone 0.500000 -1 0.500000 bone anim
+-1 1.0 = frame frame anim vertex
+-1
+frame vertex 0.500000
+frame material 0.500000 bone
+anim anim = bone material texture
+vertex vert
\ No newline at end of file
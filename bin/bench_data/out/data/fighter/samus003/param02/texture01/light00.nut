@@ -0,0 +1,213 @@
+texture material material vertex frame 0.500000 frame texture
+frame = anim anim
+anim 1.0 texture vertex
+1.0 bone frame = anim 1.0
+texture
+frame
+texture = 0.500000 0.500000 0.500000 -1 anim 0.500000 1.0 bone texture
+anim frame anim bone =
+texture
+material frame
+-1 frame 1.0 vertex
+bone bone = anim
+-1 frame vertex anim vertex bone frame anim
+texture
+frame -1 anim bone -1 bone
+texture 1.0 texture material
+vertex 1.0 anim -1 1.0 bone
+-1 bone
+1.0
+1.0 vertex -1 1.0 -1 frame
+-1 0.500000
+frame
+-1 vertex 0.500000 texture vertex material bone texture frame material frame bone -1
+material frame vertex vertex vertex vertex material vertex anim
+anim
+bone 0.500000
+frame 1.0 0.500000
+1.0
+=
+bone frame texture bone
+material
+bone texture frame
+material
+frame 0.500000 -1 = vertex
+anim =
+0.500000 -1 material 0.500000 0.500000 = -1
+texture bone -1 vertex
+=
+material -1 1.0
+frame 1.0 bone frame = vertex vertex material 1.0
+= 0.500000
+material -1 vertex -1
+vertex bone material bone material vertex texture material vertex frame anim
+1.0
+anim
+-1
+= frame
+1.0 anim 0.500000
+0.500000
+material =
+= frame frame anim frame -1
+-1
+material 0.500000 1.0
+texture material
+anim bone texture frame texture 0.500000
+texture 1.0 -1
+vertex
+= frame vertex = -1
+material
+-1
+anim
+frame frame frame texture frame = anim vertex anim -1 anim -1 1.0 bone texture bone anim =
+vertex anim
+anim = = anim 1.0
+texture frame
+texture material = texture texture 0.500000 -1 0.500000 frame
+texture texture
+-1 1.0 anim
+1.0 1.0 -1 bone anim 1.0 texture 0.500000 = = frame texture frame texture 1.0 anim 0.500000 -1
+bone anim frame bone vertex =
+bone
+material 1.0
+material vertex
+1.0 anim anim texture 1.0 vertex material 1.0 anim 0.500000
+= -1 anim
+0.500000 texture 1.0
+material = texture 1.0
+material frame frame
+-1 1.0 anim
+bone texture = = material =
+material texture
+texture texture
+texture bone material -1 -1 = = bone
+frame 1.0 1.0 bone texture 0.500000
+frame bone frame
+frame texture 0.500000 = 1.0
+frame anim
+frame
+texture
+1.0 bone frame 1.0 material 1.0
+1.0 material 0.500000 frame vertex 0.500000 frame -1 0.500000 =
+frame 0.500000 anim bone anim frame
+vertex
+anim
+-1 = -1 material anim vertex frame vertex frame material
+-1 0.500000 -1 -1 0.500000 =
+0.500000 vertex
+bone -1 material
+anim vertex material bone 0.500000 -1 frame -1
+1.0
+1.0 vertex material anim 0.500000 texture 1.0 frame material
+vertex = 0.500000 bone 0.500000 vertex vertex
+anim 0.500000
+-1 -1 texture -1
+vertex 1.0
+anim 1.0
+0.500000 material vertex 1.0 -1 anim
+-1 vertex
+-1 0.500000 0.500000
+0.500000 -1 bone
+frame frame vertex 1.0 frame anim vertex 1.0 vertex 1.0
+1.0 frame bone = frame -1
+-1
+0.500000 anim 0.500000 =
+material
+bone frame
+anim vertex texture frame bone 0.500000 =
+texture 0.500000 material
+= bone -1 anim
+vertex 0.500000 anim anim 1.0
+anim 0.500000 1.0
+0.500000
+0.500000 texture material texture = anim bone 1.0 texture frame texture
+vertex bone
+anim bone vertex
+frame material anim
+=
+0.500000 bone
+frame
+-1 material
+material 1.0 = 0.500000
+frame 1.0
+bone
+material 1.0 bone
+1.0
+frame 1.0 anim
+0.500000 material
+vertex
+material 1.0
+frame = material -1
+1.0
+texture vertex
+-1
+=
+=
+bone texture -1
+-1 -1 texture frame 1.0 0.500000 -1
+-1 bone
+0.500000 1.0
+bone
+frame 1.0 material texture texture
+bone 0.500000 material
+vertex bone
+0.500000 anim 1.0
+-1 bone -1
+texture
+-1 vertex 1.0 vertex = frame
+frame anim = 0.500000
+anim
+= = -1 anim frame anim material anim
+0.500000 vertex
+anim
+texture
+material material texture texture
+0.500000 frame 1.0 bone
+bone 1.0 bone
+texture bone
+material
+material 1.0 vertex bone material -1 vertex 1.0 0.500000 texture anim
+1.0 anim -1 = = texture
+vertex 1.0 texture bone frame 0.500000
+vertex
+= texture material
+-1 texture vertex =
+-1 0.500000 =
+-1 material
+0.500000 1.0
+bone bone 0.500000 bone frame
+bone material 1.0 -1 texture
+vertex 1.0
+1.0 0.500000
+=
+=
+material -1 0.500000 bone material
+frame anim anim
+material bone frame bone 1.0
+= -1 = =
+vertex bone frame 1.0 1.0 texture frame texture frame
+-1 0.500000 bone 0.500000
+1.0 material
+frame 0.500000
+0.500000
+material = -1 = frame frame material 0.500000 frame 1.0 vertex
+frame -1
+material
+frame anim
+anim texture 0.500000 bone
+-1 1.0 bone -1 = texture frame frame 0.500000
+0.500000 frame
+0.500000 material frame -1 material =
+anim vertex material bone 0.500000
+= = frame
+-1
+bone material bone -1 -1
+1.0 texture anim bone vertex vertex
+frame = 1.0 anim bone
+bone texture bone -1 vertex
+0.500000
+1.0 vertex bone texture material 1.0 =
+material
+0.500000 frame 1.0
+0.500000 anim vertex bone
+vertex 0.500000
\ No newline at end of file
@@ -0,0 +1,35 @@
+0.500000 anim
+1.0 0.500000 frame 0.500000 =
+bone 0.500000 = bone bone
+anim frame -1 vertex bone texture 1.0 vertex
+texture = 0.500000 material
+frame 0.500000 anim texture 1.0 texture 0.500000 vertex = frame
+1.0
+0.500000 -1
+anim anim vertex texture -1 = 0.500000 1.0
+-1 frame
+material vertex =
+vertex vertex anim
+1.0 0.500000 texture
+1.0
+bone frame
+frame bone material
+material
+1.0 anim material -1
+texture material anim material
+material
+= anim vertex vertex = vertex 1.0 bone -1 = 0.500000 texture vertex
+texture
+1.0
+-1 0.500000
+0.500000 material 1.0 0.500000 0.500000 vertex
+= =
+0.500000 frame bone
+0.500000 frame vertex
+frame
+texture 0.500000 vertex material material -1 1.0 vertex bone -1 material material bone 0.500000 frame
+vertex
+bone = = texture -1 -1 material vertex = -1
+texture
+vertex vertex bone -1 -1 -1 0.500000 = texture -1 anim material
+vertex vertex material = frame 0.500000 vertex mate
\ No newline at end of file
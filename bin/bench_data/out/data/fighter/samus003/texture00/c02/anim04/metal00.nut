@@ -0,0 +1,58 @@
+anim
+-1 = 1.0 texture = 0.500000 = frame vertex texture
+1.0 frame -1 vertex
+-1
+vertex 0.500000
+bone vertex bone 1.0 vertex bone vertex vertex frame = 1.0 =
+vertex -1 vertex bone
+0.500000 = -1 0.500000 -1 frame material
+bone = bone frame frame
+material frame material
+-1 =
+vertex -1 material texture frame frame vertex -1 1.0
+0.500000
+anim frame vertex
+vertex 0.500000
+material = material -1
+0.500000 frame 0.500000
+frame bone = anim anim material
+texture vertex vertex -1 bone anim bone anim
+frame texture -1
+anim -1 anim anim
+1.0 anim 1.0 =
+vertex
+bone bone 1.0
+texture material material
+material material material
+= frame texture bone 0.500000 frame frame material texture bone
+bone -1 frame material -1
+material =
+1.0 = 1.0 bone vertex anim material
+material 0.500000 texture 1.0 -1 bone frame
+0.500000
+frame
+= texture -1 texture 0.500000
+anim 0.500000 vertex -1 0.500000 material
+anim vertex -1 frame
+bone vertex 0.500000 vertex 0.500000 =
+texture
+0.500000 material anim texture anim 0.500000 0.500000
+material frame frame bone = 0.500000 = -1 -1 1.0
+=
+material vertex bone 1.0 frame
+-1 vertex frame -1 frame bone frame -1 vertex material material texture 0.500000 vertex
+= anim frame texture frame vertex
+anim -1 vertex vertex =
+bone = vertex
+1.0 -1
+material anim bone 1.0 1.0 vertex material
+texture -1 0.500000 anim
+bone vertex -1 1.0 bone material bone texture 1.0 texture
+vertex frame material anim frame texture
+bone bone 1.0 anim anim 1.0 anim
+frame 1.0 material 1.0 1.0 -1 bone material
+vertex
+material = 1.0
+frame -1 texture vertex bone
+frame
+bone texture bone bone = frame b
\ No newline at end of file
@@ -0,0 +1,9 @@
+anim
+-1 0.500000 -1 vertex
+anim bone material
+bone 0.500000 = texture = material texture
+= 1.0 1.0 0.500000
+frame 1.0 vertex anim texture 1.0 frame bone texture 0.500000 1.0 texture = frame 0.500000 -1 0.500000 frame
+bone -1 -1 -1
+-1 1.0
+0.500000 -1 1.0 anim = vertex -1 -
\ No newline at end of file
@@ -0,0 +1,25 @@
+= -1 bone = vertex 0.500000 -1 = texture texture material = 1.0 1.0 vertex
+frame
+anim material material -1 texture frame vertex
+0.500000 material
+material
+1.0 0.500000
+material -1 vertex vertex texture anim
+material vertex bone = texture
+bone -1 frame texture
+anim
+-1
+texture 1.0
+= texture anim
+= texture bone -1
+material
+bone
+texture 1.0 material
+texture 1.0
+texture frame frame
+1.0 -1 material texture anim vertex texture
+vertex vertex 0.500000 bone material texture material
+anim bone
+bone -1 0.500000 -1 anim
+-1 material vertex
+anim 0.500000 tex
\ No newline at end of file
@@ -0,0 +1,29 @@
+0.500000 = = texture vertex anim 1.0 vertex bone
+bone -1 material = anim anim =
+1.0 = 0.500000 = = 0.500000 material
+1.0
+1.0 material = vertex bone = 0.500000
+bone
+1.0 0.500000 vertex material frame
+1.0 texture vertex 0.500000 -1 material
+= vertex = = anim = anim
+bone vertex material
+0.500000 frame texture = -1 -1
+anim anim texture anim
+0.500000 texture 1.0 1.0 -1 = bone anim = -1 -1 -1
+1.0 0.500000 1.0 material
+0.500000 0.500000
+frame 0.500000 material bone vertex
+anim frame 1.0
+vertex bone
+0.500000 0.500000 1.0 bone = bone material vertex =
+bone anim =
+material = texture
+material -1
+-1 anim bone frame vertex
+texture
+anim vertex bone
+vertex material frame vertex bone vertex 0.500000
+vertex 0.500000 frame vertex
+-1 anim 0.500000
+anim bone 0.50000
\ No newline at end of file
@@ -0,0 +1,36 @@
+0.500000 1.0 bone vertex 0.500000
+vertex
+vertex
+frame
+-1 -1 0.500000 bone
+vertex anim bone vertex = material
+0.500000 texture frame vertex
+-1 material -1 texture 1.0
+0.500000 vertex anim bone
+0.500000 texture frame 1.0 texture bone frame frame material
+frame
+anim 1.0 -1
+vertex = 0.500000 1.0 1.0 1.0 frame
+1.0 0.500000 vertex vertex 0.500000 = material texture texture anim bone material
+vertex vertex vertex = -1
+bone bone material frame
+frame
+vertex material texture
+anim
+1.0 vertex
+1.0 texture bone
+0.500000 -1
+0.500000
+1.0 1.0
+bone material
+bone 1.0 material material
+anim -1
+vertex =
+anim 0.500000
+vertex =
+texture 0.500000 texture vertex
+texture anim
+vertex texture
+frame anim material -1 bone vertex -1 bone
+bone
+0.5000
\ No newline at end of file
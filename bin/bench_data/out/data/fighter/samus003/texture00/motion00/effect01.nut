@@ -0,0 +1 @@
+0.500000 texture vertex bone vertex vertex an
\ No newline at end of file
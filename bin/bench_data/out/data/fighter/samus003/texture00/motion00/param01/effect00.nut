@@ -0,0 +1,8 @@
+texture 1.0
+material -1 =
+material texture -1 texture anim
+=
+texture material bone material vertex material -1 = = -1
+-1 vertex 0.500000 material
+= vertex
+1.0 = 0.500000 anim
\ No newline at end of file
@@ -0,0 +1,29 @@
+texture 1.0 -1 texture
+vertex frame
+0.500000 1.0 =
+texture texture
+bone
+vertex 1.0 -1
+1.0 1.0 texture 0.500000 1.0 material vertex frame
+=
+1.0 -1 bone -1 0.500000
+frame anim anim 1.0 1.0 = -1 0.500000 0.500000 frame 0.500000 0.500000 0.500000 bone
+vertex 0.500000
+vertex 1.0 anim 0.500000
+1.0 material
+1.0 anim -1
+anim
+-1 anim = 0.500000
+0.500000
+vertex = bone bone frame vertex texture
+anim texture anim
+anim
+anim
+texture 1.0 anim
+bone bone texture material 0.500000
+0.500000
+bone texture
+vertex frame
+0.500000 1.0 0.500000 frame anim bone texture
+anim texture material 0.500000 anim = -1 -1 1.0
+fram
\ No newline at end of file
@@ -0,0 +1,5 @@
+= = vertex = material 0.500000 texture = frame texture = -1 texture -1 frame = frame 0.500000 = 1.0 -1 anim
+0.500000 material bone anim texture vertex 0.500000
+bone
+1.0 frame 1.0 1.0
+0.50000
\ No newline at end of file
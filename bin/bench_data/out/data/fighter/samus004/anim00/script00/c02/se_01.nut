@@ -0,0 +1,13 @@
+= = texture -1
+vertex 0.500000 texture -1
+anim anim bone anim 1.0 = material texture
+bone
+bone texture vertex -1 frame material
+texture
+frame
+frame
+1.0
+-1 bone anim material bone material material
+-1 0.500000 1.0 0.500000 1.0 bone
+1.0 anim material -1
+1.0 
\ No newline at end of file
@@ -0,0 +1,33 @@
+0.500000 bone anim -1 anim texture frame texture bone texture
+= material
+texture texture
+frame = =
+= material = texture anim 0.500000
+vertex -1 bone anim frame frame
+vertex texture -1
+= material frame texture material
+material
+-1 anim = 1.0 material -1
+1.0 bone texture
+vertex
+0.500000 texture
+texture vertex material texture -1 1.0 -1 frame 0.500000 =
+1.0 material
+bone
+= vertex -1 material bone
+material frame
+bone 0.500000 bone anim
+=
+1.0 = texture = anim texture vertex vertex 1.0 vertex = material
+bone = anim 1.0 anim =
+vertex vertex =
+vertex frame = texture
+1.0 bone texture 0.500000 texture anim -1 1.0 bone
+= 1.0 texture -1 -1 0.500000 1.0 frame material vertex anim
+1.0 -1 0.500000 anim
+material texture = anim
+material
+= -1 frame texture -1 0.500000
+material frame 1.0 0.500000 -1 = anim vertex anim bone
+0.500000 = texture
+bone 1.
\ No newline at end of file
@@ -0,0 +1,218 @@
+frame
+1.0 -1
+vertex 1.0 vertex vertex -1 frame vertex
+bone material material material 1.0
+frame
+= frame
+anim material
+-1 bone texture 1.0 vertex 1.0 -1 texture
+material frame texture -1
+vertex anim 0.500000 1.0 -1
+frame 1.0
+texture 1.0 anim 1.0 bone
+= texture 0.500000 0.500000
+material texture 0.500000 frame frame material
+anim vertex =
+bone 1.0 frame material = 0.500000 anim frame
+texture 0.500000
+frame anim
+frame -1 0.500000 anim -1 = vertex 0.500000 frame = 1.0
+1.0 vertex frame
+0.500000 bone anim -1
+vertex
+bone = anim = 0.500000 frame
+vertex = 0.500000 anim -1 0.500000 frame 1.0 bone
+bone
+= frame
+1.0 material anim = anim bone
+vertex vertex texture anim frame texture vertex
+0.500000 -1 anim frame material
+-1 = = texture anim bone 1.0 anim
+anim material 0.500000 material 1.0 -1 texture bone -1 texture material
+frame frame 1.0 material anim vertex frame
+bone material
+1.0 bone
+0.500000 material -1 material bone
+texture texture frame -1 vertex texture texture bone
+-1 = material =
+0.500000 material = 1.0 anim 1.0 0.500000 frame =
+0.500000 frame
+material frame 1.0 0.500000
+vertex = 0.500000 texture vertex 1.0
+-1 vertex 0.500000 0.500000 0.500000 bone
+vertex bone frame material 1.0 1.0 texture -1 material
+frame -1
+1.0 -1 frame frame material texture
+=
+= anim 1.0 material anim anim material
+frame frame bone anim texture =
+0.500000
+texture = anim bone anim -1
+-1 -1 material 1.0
+anim material frame
+material
+1.0 1.0 material -1 texture vertex 0.500000 anim -1 material
+= frame
+=
+0.500000 = -1 texture = material
+bone
+texture
+= 1.0 1.0 texture vertex 1.0
+1.0 1.0
+bone = -1 texture bone bone -1 0.500000
+=
+-1
+anim =
+vertex = anim anim frame 1.0 =
+0.500000 -1 anim
+anim
+anim vertex material texture -1 frame anim
+0.500000 0.500000
+bone anim
+0.500000
+vertex
+0.500000 bone vertex
+frame anim frame
+1.0 anim
+-1 0.500000
+1.0 material -1 frame vertex
+0.500000
+vertex -1
+bone
+vertex texture
+texture 0.500000
+anim
+1.0
+= vertex
+material
+frame
+= anim
+= texture bone texture frame -1 bone
+0.500000 -1 -1
+frame bone
+0.500000
+1.0 1.0 =
+texture texture 1.0
+-1 = 1.0 bone -1 -1
+anim 0.500000
+vertex -1
+texture
+bone material = = = vertex material -1 frame bone
+frame vertex = anim frame texture vertex vertex texture = vertex frame anim material 1.0 1.0 1.0 vertex texture bone anim material
+1.0
+-1
+= -1 vertex
+anim anim
+anim frame = frame
+1.0 -1 vertex
+vertex 1.0 vertex frame 1.0
+-1 anim
+bone material 0.500000
+frame
+anim 1.0 bone
+bone anim -1 texture
+=
+texture =
+0.500000 -1
+vertex = = -1 1.0
+= -1 vertex texture -1
+0.500000 0.500000 0.500000
+vertex
+anim texture
+bone bone
+1.0
+vertex
+-1 material
+= vertex -1 anim 1.0 material vertex
+bone anim material vertex texture material material -1 bone = frame anim material = 1.0 material bone
+= material -1 = texture texture 1.0 0.500000 bone -1 -1 frame frame
+vertex
+-1 texture vertex
+1.0
+frame
+frame frame frame vertex
+vertex 1.0 frame 1.0 frame
+frame
+1.0 = frame 0.500000 1.0
+-1 = =
+-1 vertex
+material
+texture
+bone = frame bone
+frame
+material material
+material -1 material texture vertex vertex texture -1
+material texture
+=
+texture = =
+1.0
+bone
+= texture
+1.0 vertex = -1 texture bone texture 1.0
+0.500000 frame anim
+-1 -1 bone frame bone
+frame
+vertex vertex vertex 1.0 anim
+1.0 -1 -1
+vertex texture = 1.0 bone 0.500000 =
+material bone
+material =
+-1
+= vertex =
+material material frame vertex
+0.500000 bone bone anim
+=
+vertex anim
+1.0 material material = 0.500000 material bone vertex bone -1
+texture 1.0 material
+material = -1
+vertex 1.0 material 0.500000
+1.0 bone
+vertex vertex 1.0 frame material texture anim vertex -1 bone bone material frame 0.500000 anim =
+-1
+anim 0.500000 =
+vertex
+-1 texture anim frame
+frame texture -1 anim = = texture 1.0 = bone =
+1.0 -1 bone
+texture anim anim texture 0.500000 = bone frame texture -1
+= -1
+= -1 vertex 0.500000
+anim vertex material
+1.0 bone 0.500000
+frame
+bone anim = frame bone bone anim
+texture 1.0 frame anim
+-1
+texture 1.0 vertex -1 material = anim material anim material
+texture -1 1.0
+-1 1.0 anim 1.0
+1.0 -1 -1 bone -1 1.0
+anim
+vertex
+material 0.500000 material
+0.500000 texture bone material 1.0
+=
+bone material
+-1 = material
+material texture texture 0.500000 vertex 1.0
+bone anim
+0.500000
+frame frame material 1.0 -1 -1
+bone vertex vertex = frame anim = bone -1
+material 1.0 anim vertex -1
+vertex texture 0.500000 1.0 frame
+frame frame vertex -1
+-1
+0.500000 material = material anim material
+bone
+anim anim 1.0 bone vertex
+anim 0.500000
+frame = vertex texture 0.500000
+vertex = material material = -1 frame
+0.500000 material 0.500000 1.0 1.0 bone texture bone
+= texture texture vertex -1 -1
+= 0.500000 -1 vertex 1.0
+anim
+material vertex bone =
+m
\ No newline at end of file
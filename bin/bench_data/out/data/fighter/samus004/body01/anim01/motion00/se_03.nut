@@ -0,0 +1 @@
+-1 = = bone anim material bone vertex material frame material vertex mat
\ No newline at end of file
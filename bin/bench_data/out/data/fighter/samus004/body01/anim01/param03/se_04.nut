@@ -0,0 +1,144 @@
+material = = bone =
+1.0
+-1 frame
+frame bone
+= anim
+= vertex bone anim = =
+0.500000 frame
+frame material anim -1 vertex 0.500000 material
+anim vertex -1 frame anim anim
+bone -1 = material
+0.500000 0.500000 material 1.0
+1.0 anim 0.500000
+= material
+frame anim material bone 1.0
+0.500000 material anim 1.0 1.0
+vertex
+0.500000
+anim vertex
+frame vertex
+bone frame frame = = = texture frame
+1.0
+bone 1.0
+anim material =
+=
+=
+= 0.500000
+-1
+bone anim 0.500000
+texture vertex bone
+anim = -1 anim -1
+texture -1
+=
+texture =
+bone vertex texture texture 0.500000 bone 1.0 vertex texture frame material material material bone =
+frame
+texture 1.0 texture vertex -1 0.500000 = bone 1.0 texture texture material texture 0.500000
+frame bone 0.500000
+bone
+anim = -1 0.500000
+-1
+bone texture frame
+0.500000
+-1 anim bone anim frame = -1 material = 0.500000
+material anim
+= = frame bone 1.0 = 1.0 material 0.500000 0.500000 frame 1.0 anim
+1.0 1.0 anim
+vertex -1 0.500000 vertex texture 1.0 1.0 bone vertex
+frame vertex -1
+=
+1.0 frame -1
+texture
+0.500000
+material
+texture -1
+texture texture -1 -1 bone frame
+frame texture
+texture frame material
+1.0 texture
+1.0 bone
+bone anim 0.500000 material
+bone
+anim 0.500000 1.0 texture
+frame -1 = = = anim 1.0 bone
+frame = anim -1 = 1.0
+anim vertex material anim vertex
+0.500000
+0.500000
+0.500000 material vertex
+vertex 0.500000 texture 1.0 0.500000
+= -1
+anim
+0.500000 0.500000 0.500000
+bone frame material
+frame bone
+frame 1.0 material 1.0 0.500000 frame vertex 0.500000 0.500000 texture texture = texture
+material 1.0 vertex 1.0 vertex =
+frame anim frame
+bone texture
+frame
+0.500000 material vertex anim -1 anim vertex material 1.0 1.0 texture texture anim -1 vertex 1.0 anim bone frame -1 1.0
+-1 vertex bone anim texture
+-1 bone vertex frame
+vertex vertex -1
+-1 = bone frame
+anim texture 0.500000
+-1 0.500000 texture
+bone 1.0 vertex texture frame vertex texture 0.500000 material -1
+bone -1
+-1 vertex texture frame anim
+material
+= -1 texture
+= -1 -1 -1 bone 1.0 vertex -1
+frame
+anim anim -1
+frame frame material 0.500000 anim texture texture = = = = frame 1.0 0.500000 0.500000 -1 material 1.0
+anim vertex 1.0
+vertex =
+material vertex material vertex 1.0 bone frame anim material
+material 0.500000 frame -1 vertex
+1.0 bone 0.500000
+vertex 1.0 anim material 1.0 -1 1.0 anim vertex
+texture texture 0.500000 0.500000 vertex 0.500000
+bone 0.500000 anim = texture
+texture bone
+bone
+=
+frame frame anim
+frame
+0.500000 vertex = bone vertex frame =
+frame texture frame frame frame
+anim -1
+bone anim
+0.500000 vertex -1
+material
+frame texture 1.0
+anim 1.0
+frame anim vertex
+bone vertex
+texture vertex -1 vertex material anim material -1 vertex frame
+texture -1
+= bone
+material bone bone
+1.0 -1
+bone material 0.500000 frame vertex 0.500000 0.500000 = 0.500000 texture anim bone frame frame anim 0.500000 texture = vertex vertex bone frame = bone
+1.0 texture
+texture
+0.500000 vertex texture anim
+anim material bone anim vertex =
+bone =
+-1
+texture 0.500000 anim
+anim
+frame vertex texture
+= vertex texture frame anim 0.500000 frame 0.500000 frame frame material anim material material
+bone
+0.500000 =
+1.0 material
+texture
+texture texture
+1.0
+0.500000 vertex
+anim texture frame = vertex vertex vertex bone anim =
+-1 = vertex
+bo
\ No newline at end of file
@@ -0,0 +1,104 @@
+1.0
+texture material anim texture anim
+vertex
+frame 1.0 material -1 frame
+anim
+frame = 0.500000 material vertex 0.500000 vertex material = 0.500000 texture bone
+frame
+anim texture anim
+material
+material
+1.0 texture
+= 1.0 anim 1.0
+bone -1
+anim material anim -1 -1 bone bone bone texture anim texture 0.500000 texture 1.0 -1
+1.0 1.0 frame 0.500000 -1 texture anim 1.0
+bone 1.0 anim
+1.0
+bone vertex material
+frame
+frame anim 0.500000 frame
+anim -1 frame anim -1 texture -1 vertex material 0.500000 material
+-1 anim 1.0 -1 texture = 0.500000 material 1.0
+frame texture
+-1
+frame = 0.500000 anim texture texture
+frame texture frame = bone material vertex material = frame
+vertex
+bone bone
+0.500000
+-1 -1
+bone 0.500000 -1 1.0 vertex bone
+frame -1 1.0 -1
+1.0 bone texture anim material bone bone bone material 1.0 0.500000 anim bone bone
+-1
+material texture texture texture vertex texture vertex bone bone anim -1 vertex 1.0 material 1.0 = anim
+bone vertex 1.0 -1 material -1
+anim bone -1 vertex
+bone
+frame vertex 1.0 material vertex -1
+bone frame frame 0.500000 material = bone
+texture vertex
+texture bone
+-1 0.500000 frame
+0.500000
+= texture 0.500000
+1.0 -1 0.500000 = material
+anim frame 0.500000 anim 1.0
+bone -1 = 0.500000 1.0 vertex -1 material texture 1.0
+-1 material 1.0
+frame 0.500000 0.500000 anim texture anim
+0.500000 anim bone material anim vertex vertex anim anim texture
+material vertex frame frame
+-1 bone
+bone
+1.0 frame 1.0 material texture anim 0.500000 1.0 0.500000
+bone vertex
+anim = material frame -1 material bone bone texture bone anim -1 texture
+bone vertex 1.0
+1.0 0.500000 bone anim 0.500000 texture -1 material frame vertex material vertex texture = texture 0.500000 -1 1.0 bone = frame = vertex material 0.500000 = frame bone = =
+anim texture anim texture material
+1.0
+-1
+bone 1.0
+frame vertex
+material bone texture =
+texture 0.500000 1.0
+material 0.500000 bone material texture =
+= bone vertex anim frame texture texture frame
+0.500000
+vertex
+= 0.500000 bone texture anim 0.500000 0.500000 texture 0.500000 -1 material
+bone texture anim
+1.0 frame = bone
+texture 0.500000
+material
+= 0.500000
+texture frame bone 0.500000
+-1
+frame
+anim anim 0.500000 0.500000
+1.0 vertex = frame bone bone vertex
+1.0
+material
+texture 1.0 material
+= 0.500000 frame 0.500000 = vertex
+texture 0.500000 material
+texture vertex 1.0
+anim
+texture anim frame frame 0.500000 texture
+-1 = anim frame -1
+texture frame vertex
+anim anim 0.500000 texture vertex =
+0.500000 -1 texture bone anim -1 =
+-1
+= bone 0.500000
+vertex bone material
+material texture material
+-1
+anim 0.500000 vertex
+1.0 bone
+texture vertex material frame texture texture
+1.0
+bone material
+anim 1.0 anim frame 1.0 = ver
\ No newline at end of file
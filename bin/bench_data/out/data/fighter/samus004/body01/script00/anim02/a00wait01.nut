@@ -0,0 +1,286 @@
+1.0 vertex vertex
+material -1
+anim bone texture texture
+texture
+0.500000 -1
+frame vertex bone
+vertex
+=
+material vertex vertex vertex anim -1 -1
+vertex frame
+= texture frame frame =
+vertex vertex
+vertex -1 0.500000 frame vertex
+1.0 =
+anim -1 = vertex vertex vertex bone
+0.500000 material texture
+anim vertex
+bone = anim material -1 anim vertex frame texture 0.500000 bone
+material texture -1 frame bone -1 bone -1
+frame bone bone
+vertex frame
+material -1 frame material frame anim vertex
+0.500000 =
+vertex 1.0
+1.0 bone texture frame = 1.0 =
+vertex 0.500000 0.500000
+1.0 anim texture 0.500000 anim frame material = texture -1 bone
+texture frame texture bone anim frame frame vertex 0.500000 vertex -1
+vertex 0.500000 -1 material -1
+= texture vertex 0.500000
+= =
+bone frame texture anim bone frame frame texture vertex material
+= 0.500000 vertex vertex frame
+material 0.500000 -1
+anim material -1 material vertex anim anim
+vertex 0.500000
+material 1.0 vertex vertex 0.500000 anim material texture 0.500000 material = texture = bone -1 anim 1.0 = bone
+0.500000 =
+vertex -1 = 0.500000 vertex
+1.0 vertex texture
+= anim frame 0.500000
+anim material
+0.500000 1.0
+material bone texture material vertex -1 -1 frame texture
+texture 1.0 bone material
+0.500000 frame =
+anim
+material
+bone
+material anim
+1.0 vertex
+frame material
+-1 anim
+= 1.0 texture material
+=
+bone texture
+vertex 0.500000 1.0 frame 1.0 = anim
+frame
+texture 1.0
+anim 1.0 material bone 0.500000 bone
+frame 0.500000 0.500000 material material material material vertex vertex anim texture texture frame texture
+material
+material bone 0.500000 1.0
+vertex 1.0 frame
+1.0
+frame frame vertex
+anim vertex
+frame 0.500000 = material anim
+texture -1 vertex 1.0 material frame frame -1 anim
+1.0
+frame 1.0 vertex bone vertex =
+-1 vertex texture bone = vertex 0.500000 vertex
+1.0
+1.0 anim vertex
+-1 0.500000 frame -1 vertex
+bone
+=
+0.500000 vertex
+-1
+material bone
+material = -1 = frame texture frame
+= = material
+1.0
+frame material
+frame vertex -1 material vertex -1
+anim vertex
+anim texture texture
+anim frame anim anim
+texture
+-1 frame
+frame anim 0.500000 texture bone
+0.500000
+= 1.0 frame texture -1 0.500000 1.0 = texture texture texture 0.500000 anim texture bone 0.500000 =
+frame
+frame material frame = frame 1.0
+bone
+= anim frame frame texture texture -1
+1.0 0.500000
+-1 = vertex = = 0.500000 bone
+0.500000 -1
+material bone =
+anim 1.0 -1 frame 0.500000
+-1 anim bone frame 0.500000 =
+= bone
+anim texture frame vertex
+0.500000
+frame -1 = material
+anim = anim
+=
+frame = 0.500000
+-1 1.0 anim = texture texture
+vertex vertex bone =
+= -1 vertex anim
+vertex frame
+vertex frame anim
+= vertex anim anim 0.500000
+vertex = 1.0
+anim
+bone texture bone -1 0.500000 anim bone 0.500000 0.500000 -1 1.0 1.0 bone = material 0.500000 frame
+0.500000 anim material =
+texture 0.500000 bone bone
+vertex 1.0 vertex 0.500000 1.0 frame material material 1.0 frame -1 material -1 vertex -1 material material texture bone bone 1.0 bone -1 material anim
+-1 0.500000 frame anim -1 0.500000 texture
+texture
+material frame bone frame vertex texture anim
+texture frame 0.500000 bone texture texture anim frame
+1.0 frame 0.500000 bone
+bone
+= vertex 0.500000 -1 material -1 0.500000
+1.0 material anim material 0.500000 anim 0.500000 -1 frame
+vertex anim texture 0.500000 0.500000 bone vertex 0.500000 1.0
+1.0 bone frame
+vertex bone
+= anim vertex bone material
+bone
+bone frame texture vertex texture
+vertex
+1.0
+material vertex
+texture -1
+= texture = frame
+material vertex 0.500000 bone vertex material
+vertex frame texture bone texture
+vertex material = 0.500000 material
+frame 0.500000 0.500000 1.0 material frame = 0.500000 texture
+= anim 0.500000
+anim
+0.500000 1.0
+bone 0.500000 bone
+anim texture material texture
+bone = frame frame texture
+material 0.500000 texture vertex material vertex material bone 0.500000 -1
+frame texture vertex vertex texture vertex texture
+frame -1
+1.0 anim 1.0 1.0
+= = texture material frame vertex
+= -1 anim 1.0 bone
+= bone texture bone 1.0 -1
+texture
+1.0 anim texture
+vertex 0.500000 frame 1.0 1.0 = -1 0.500000
+= anim
+0.500000 bone frame
+= -1 bone frame 0.500000 material material = anim anim material frame -1 0.500000
+-1 texture
+1.0 bone -1 = 0.500000 1.0 1.0 bone 0.500000
+frame vertex frame frame 0.500000 texture
+-1 texture frame
+anim anim frame -1 0.500000 1.0 material texture texture
+vertex frame 0.500000 bone = frame frame vertex
+bone
+bone bone
+1.0 1.0
+material anim 1.0 texture -1 0.500000 bone 1.0 frame vertex frame 1.0
+bone anim
+=
+vertex
+bone = vertex material -1 -1 = = -1 material bone frame frame frame frame vertex vertex anim texture 1.0 0.500000 = vertex material =
+frame 0.500000 0.500000
+bone vertex bone vertex
+frame -1 anim vertex vertex vertex 1.0
+texture texture
+anim vertex -1
+frame 0.500000 anim = frame
+material 0.500000 texture -1
+texture
+-1 frame vertex vertex vertex 0.500000 material 1.0 material material
+-1 1.0 frame frame
+anim = =
+vertex 1.0
+0.500000 frame 0.500000 material 1.0 vertex frame 1.0 bone 1.0 0.500000 =
+0.500000 frame material vertex vertex vertex
+anim anim
+vertex vertex 0.500000 -1
+=
+0.500000 = -1 texture vertex 0.500000 texture -1 texture anim anim vertex 1.0 frame frame
+material 1.0 anim
+= texture bone bone
+1.0 vertex bone -1 frame
+= bone
+0.500000 frame anim
+frame
+bone frame anim texture
+1.0 -1 vertex
+frame vertex
+1.0 material 1.0 1.0 anim vertex bone =
+anim -1 bone frame material material
+vertex
+texture material 0.500000 = material -1 = -1 -1
+0.500000 -1 1.0 bone bone vertex
+=
+=
+anim 1.0 frame
+anim frame vertex 0.500000 frame -1 -1 texture
+anim anim
+material 0.500000 1.0 texture vertex
+anim -1 = -1 anim bone 0.500000 1.0 frame =
+= frame bone vertex
+frame -1 bone bone 1.0
+texture -1 bone vertex 0.500000 material 1.0
+-1 texture 1.0 material material material
+bone texture bone 0.500000
+-1
+bone frame anim material
+vertex
+1.0 texture texture
+frame anim texture
+anim
+= frame frame anim 1.0 material
+material
+frame texture anim vertex texture = anim
+= 1.0 anim
+vertex bone 1.0 bone vertex bone
+texture anim bone 1.0 0.500000 = vertex texture vertex anim bone
+1.0 material vertex
+frame frame
+material
+vertex 1.0 texture
+0.500000 material vertex
+bone
+= bone anim anim
+frame 0.500000 0.500000 bone 0.500000
+material =
+frame 1.0
+vertex 1.0 1.0
+vertex -1 1.0 anim
+frame texture anim 0.500000 bone material 0.500000 1.0 anim anim vertex = anim
+frame
+=
+= anim 0.500000 bone
+0.500000 anim frame =
+frame
+-1 anim -1 1.0 0.500000 material 0.500000 0.500000
+material
+= bone -1
+0.500000
+frame 0.500000 1.0 0.500000 texture vertex -1
+0.500000
+= anim anim anim bone bone vertex vertex vertex 1.0 frame
+bone bone bone frame -1 vertex = anim
+1.0 = vertex vertex texture
+material frame
+= vertex frame anim frame
+bone texture frame
+vertex material
+material
+1.0
+= 0.500000
+0.500000 material frame
+0.500000
+0.500000 frame frame
+= vertex frame
+texture = anim -1 = bone texture
+0.500000
+0.500000 material
+texture texture texture
+bone texture -1 anim bone frame texture frame 1.0 texture
+1.0 texture 0.500000 vertex 0.500000 bone
+material -1 vertex bone frame bone texture texture -1 = texture vertex 1.0 bone 1.0 bone texture 0.500000 1.0 bone
+-1 texture anim
+bone material 1.0 -1 material 0.500000 frame bone material vertex
+=
+frame
+frame
+material
+anim vertex bone 1.0 1.0 0.500000 0.
\ No newline at end of file
@@ -0,0 +1,2 @@
+E0#!6-Жr+`2U_@,cK%K-ޜ{!Z$e
+jO|yM,oGNWCYfT.;`Gfrs6|KlQZWb댨p]w)Q۫$!$O=xȡiA߾Z$CnVyڏ4q|,10bOo
\ No newline at end of file
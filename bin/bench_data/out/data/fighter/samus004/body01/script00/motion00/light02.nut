@@ -0,0 +1,118 @@
+material 0.500000
+-1
+bone texture
+material
+bone = material
+frame
+texture frame texture
+material 1.0
+vertex
+texture frame material vertex -1 vertex texture vertex 1.0 bone texture frame frame bone vertex 0.500000 1.0
+= material =
+-1 vertex 1.0 0.500000 anim vertex = texture 0.500000 bone
+vertex bone -1
+bone anim vertex
+anim
+anim vertex
+-1 material frame anim 1.0 frame 1.0 frame bone = anim = 0.500000 bone =
+texture
+texture anim material vertex -1 -1
+0.500000
+vertex vertex
+-1
+material vertex
+bone texture
+bone -1 bone = frame 1.0
+frame
+1.0 vertex
+material -1 anim
+material 1.0 texture material vertex texture 1.0
+vertex
+0.500000
+frame
+0.500000 bone 1.0 material -1 anim frame -1
+vertex bone -1 anim
+0.500000 1.0 0.500000 material vertex
+= frame
+= 0.500000 = 0.500000
+bone vertex texture vertex texture vertex 0.500000 texture frame bone
+anim
+1.0 vertex = material material -1 material material material = -1
+1.0 texture vertex =
+vertex frame
+anim 1.0
+bone 1.0 bone texture
+= 0.500000 vertex
+bone = -1 bone -1 0.500000
+bone bone 0.500000
+-1 vertex 0.500000
+0.500000 bone bone = vertex frame 1.0 bone 0.500000 bone
+0.500000 anim
+vertex
+bone
+texture
+anim
+-1 anim frame
+= 1.0
+anim
+frame anim =
+material =
+material 1.0
+= frame 0.500000 vertex texture material 0.500000 = anim 0.500000
+bone
+anim
+frame anim
+0.500000 frame -1 bone anim
+-1
+0.500000 -1 vertex
+vertex
+-1 = anim
+-1 material -1 vertex bone
+material 0.500000 0.500000
+bone frame vertex
+1.0 anim anim vertex vertex 1.0 frame
+vertex material
+anim bone
+bone 0.500000 1.0 material
+0.500000 anim
+material texture bone anim bone = =
+anim material
+0.500000 vertex
+1.0
+bone vertex
+= anim -1 anim frame texture
+texture 1.0
+-1 0.500000 bone bone texture 1.0 material vertex
+texture
+anim vertex 1.0 vertex vertex 1.0 bone bone
+-1 vertex vertex = 0.500000 anim
+anim
+0.500000 texture
+-1
+bone 1.0 frame anim -1 1.0 0.500000 bone =
+vertex
+vertex bone bone
+vertex
+1.0
+texture 0.500000 frame 1.0 texture anim 0.500000 vertex
+frame anim 1.0 -1 frame texture material 0.500000 material
+= anim -1
+frame vertex
+vertex
+= -1 = material
+=
+1.0 vertex = material
+0.500000 frame -1 bone 1.0
+material 0.500000 = 0.500000
+texture -1
+frame 1.0 -1 =
+bone material material
+material texture texture vertex vertex
+= -1 anim material 1.0 1.0
+material -1 texture
+0.500000
+bone texture
+bone 1.0 -1 texture = vertex -1 vertex bone
+material -1 texture frame 0.500000 bone
+texture material
+frame -
\ No newline at end of file
@@ -0,0 +1,8 @@
+1.0
+1.0 material -1
+bone 0.500000 = material anim material
+1.0 texture bone material
+material
+= 0.500000 vertex material
+-1 frame vertex frame = frame
+texture 
\ No newline at end of file
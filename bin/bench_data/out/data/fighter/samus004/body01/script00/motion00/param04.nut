@@ -0,0 +1,7 @@
+material texture vertex anim
+anim 0.500000 frame 0.500000 1.0 material
+texture
+=
+= frame
+0.500000 -1 -1 vertex
+0.500000 vertex texture 0.
\ No newline at end of file
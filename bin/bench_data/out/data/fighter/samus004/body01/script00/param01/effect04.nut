@@ -0,0 +1,8 @@
+-1 vertex
+material bone anim vertex -1 -1
+frame
+vertex vertex 1.0 anim
+=
+material texture
+bone
+fram
\ No newline at end of file
@@ -0,0 +1,41 @@
+0.500000 material
+material
+-1 0.500000
+-1 0.500000 bone material -1 frame = texture =
+frame anim -1
+frame anim
+-1 texture 1.0 material frame bone bone vertex anim
+material 0.500000 vertex
+-1 anim bone frame
+1.0 frame
+material
+texture
+frame material
+anim
+frame texture anim -1
+= vertex
+material 0.500000 vertex = 0.500000 material = material 0.500000 vertex texture
+0.500000
+bone 0.500000 vertex
+texture -1 frame = anim
+1.0 material 0.500000
+0.500000 frame
+frame 1.0
+material
+material 1.0 material bone frame
+anim vertex frame 0.500000 texture bone
+texture -1 texture 0.500000
+material anim -1
+material anim vertex material
+material bone -1 0.500000 material
+texture 1.0 1.0 texture
+bone = material
+= texture frame texture vertex bone -1 vertex
+bone texture material
+= bone
+anim anim -1
+bone anim 0.500000 0.500000
+texture
+0.500000 bone texture frame texture
+-1
+0.500000 texture vertex 1.0 anim 0.500000 anim texture 1.0 
\ No newline at end of file
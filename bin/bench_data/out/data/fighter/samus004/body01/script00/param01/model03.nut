@@ -0,0 +1,4 @@
+bone bone
+frame 0.500000 1.0 bone 1.0
+frame -1 =
+ma
\ No newline at end of file
@@ -0,0 +1,2 @@
+texture bone 0.500000 =
+= vertex 1.0
\ No newline at end of file
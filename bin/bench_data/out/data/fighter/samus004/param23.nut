@@ -0,0 +1,71 @@
+bone
+frame anim anim material 0.500000 vertex vertex
+bone material texture texture 0.500000 texture -1 anim
+texture
+vertex
+1.0 material 0.500000
+vertex
+0.500000 frame
+texture
+frame texture frame material
+bone material = = vertex =
+=
+anim 1.0
+1.0
+frame -1 frame
+= 1.0 bone
+texture material texture
+texture
+texture
+material 1.0 = bone texture = frame -1 frame
+bone = = 1.0 vertex frame
+0.500000
+vertex anim 0.500000 bone material 1.0 anim bone texture -1 -1 vertex = anim vertex
+frame = 0.500000
+material bone anim 1.0 = 0.500000
+texture
+texture 1.0 bone 0.500000 -1 1.0 -1
+vertex
+anim
+0.500000 frame texture vertex vertex material -1 1.0 frame
+=
+material = texture texture vertex frame bone bone bone 0.500000 -1 0.500000
+0.500000 vertex 1.0 vertex frame anim =
+-1 frame material
+anim 0.500000 frame -1
+vertex anim vertex = 0.500000 texture bone material frame anim = texture vertex
+frame bone
+-1 frame 1.0
+texture anim 1.0 bone vertex 1.0 1.0 anim 1.0 material
+= texture anim
+texture
+texture frame -1 0.500000 material
+bone
+1.0
+= = texture 0.500000 frame material 1.0 material
+1.0 frame vertex anim -1 material bone
+0.500000 0.500000
+anim =
+= material material bone 0.500000 material
+bone
+= material = texture 1.0
+anim = material anim bone frame material
+-1 anim
+material
+texture vertex anim bone 0.500000
+1.0 frame =
+frame material material -1 -1 -1 bone bone
+vertex
+1.0 0.500000 vertex anim texture anim
+frame anim
+frame frame
+anim texture
+1.0 vertex anim vertex = 1.0 anim = vertex 0.500000 0.500000 -1 frame 1.0
+texture anim frame
+anim bone
+bone
+0.500000 vertex material material
+-1 0.500000
+bone
+vertex 0.500000 -1
+bone ver
\ No newline at end of file
@@ -0,0 +1,21 @@
+anim
+texture
+material anim 0.500000
+frame frame vertex
+material texture bone anim frame texture =
+anim
+0.500000 1.0 1.0 frame =
+anim 0.500000 = 0.500000
+anim
+0.500000 =
+vertex
+=
+bone
+texture
+vertex frame frame anim vertex
+bone bone anim
+-1 frame material =
+frame
+= texture texture anim anim
+bone texture
+=
@@ -0,0 +1,2 @@
+-1 vertex -1
+vertex anim 1.0 mat
\ No newline at end of file
@@ -0,0 +1,81 @@
+material
+0.500000 -1 material = material bone -1 frame
+frame vertex frame anim -1
+0.500000
+1.0 vertex material anim
+texture frame
+texture frame
+1.0
+0.500000
+= vertex 0.500000 texture bone
+vertex
+vertex 1.0
+= material = -1 0.500000 vertex material 0.500000
+bone 0.500000 texture
+bone vertex
+1.0 material -1
+frame anim frame 1.0 -1 -1 1.0 frame vertex
+texture frame anim 0.500000
+texture =
+anim = = material anim material anim =
+frame
+frame 1.0 bone
+-1 material vertex = = frame material frame
+frame material anim 0.500000 0.500000 = material -1 0.500000 vertex frame frame bone frame
+= 0.500000 = 0.500000 vertex frame
+-1 0.500000
+anim 0.500000 -1 material
+anim
+material anim
+vertex = material
+frame texture 0.500000 1.0 = bone = bone = = -1 texture material
+vertex 1.0 vertex bone -1 -1 anim =
+anim material material
+frame frame material
+=
+anim -1 0.500000 material -1 anim
+1.0 frame frame texture frame
+= frame material
+frame =
+frame = texture 0.500000
+vertex frame material 0.500000 0.500000 frame
+texture bone
+material anim
+-1 texture 0.500000
+= 0.500000 bone
+-1
+vertex texture vertex texture texture 0.500000 -1
+texture -1 texture 1.0 bone
+bone 1.0
+material anim
+-1 anim anim frame bone -1 texture 1.0 frame
+texture vertex 0.500000
+0.500000 bone bone bone
+bone texture = frame -1 -1 material = frame
+1.0
+bone vertex material
+-1
+bone vertex vertex = -1 0.500000
+1.0 1.0
+bone -1
+material -1 -1
+vertex frame 1.0 0.500000 texture
+bone
+texture anim
+1.0 1.0 texture texture frame 1.0 texture
+= material 0.500000
+1.0
+1.0
+bone material frame
+-1 1.0 0.500000 texture material = texture -1 anim -1 material texture texture bone -1
+0.500000 bone = vertex
+=
+material frame texture
+-1
+frame
+material bone
+bone bone
+vertex
+=
+material
+material 0.500000 -1 anim = material -
\ No newline at end of file
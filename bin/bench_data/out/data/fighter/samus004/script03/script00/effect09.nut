@@ -0,0 +1,135 @@
+texture =
+vertex -1 vertex 0.500000 bone material
+vertex 0.500000 1.0 vertex anim bone material
+bone bone vertex -1
+frame -1 0.500000
+texture = vertex texture texture
+texture texture -1
+frame -1 frame 0.500000 texture vertex
+0.500000 texture texture material frame
+bone material = -1 vertex bone 1.0
+frame
+-1
+= material vertex
+frame 1.0 anim material 1.0 frame material bone 0.500000 = material texture 1.0
+vertex
+1.0
+0.500000
+bone
+vertex
+material anim = anim
+vertex texture
+material
+-1 texture = 0.500000 texture
+vertex vertex
+0.500000 anim -1 material = texture -1
+vertex vertex material 1.0 bone material 1.0 anim vertex 1.0 vertex
+bone
+-1 frame 1.0
+1.0 texture
+texture anim frame = material -1 = bone 0.500000 texture =
+1.0 material vertex
+= = 1.0 0.500000
+-1 texture =
+-1 -1 material 0.500000 material 0.500000
+vertex -1
+frame
+vertex
+material -1 1.0
+anim 0.500000
+material 0.500000
+vertex 0.500000 bone
+anim 0.500000 anim = frame texture =
+vertex
+texture -1
+1.0 material 0.500000
+material 1.0
+vertex bone frame anim 1.0
+= bone material -1 = vertex = bone
+-1 material anim anim 1.0 texture frame
+0.500000 frame
+-1 -1
+= texture material
+vertex = 0.500000
+= frame -1 1.0
+-1 anim material bone vertex texture bone
+material
+-1
+frame = -1 -1 bone
+1.0 0.500000 texture -1
+texture anim 1.0 0.500000 =
+=
+anim frame
+vertex frame
+-1 texture material frame 1.0 = = -1 vertex texture 0.500000 material texture anim
+material material
+texture bone 0.500000 anim texture -1 texture frame texture bone bone = bone
+anim
+anim material frame 1.0
+bone texture
+texture texture 1.0 material 1.0 texture
+bone =
+anim
+0.500000 texture material 1.0 frame 1.0
+bone
+frame
+0.500000 0.500000
+bone -1 texture -1 0.500000 -1 vertex anim texture
+1.0 bone vertex anim 1.0 frame texture material material material material material -1 frame = frame texture vertex vertex material vertex bone = material
+frame
+material texture
+anim
+texture
+material vertex texture -1 1.0 1.0 anim -1 frame
+bone
+texture vertex material anim
+material anim
+frame
+1.0 0.500000
+texture
+0.500000 vertex 1.0 material texture 0.500000 texture vertex material 1.0 anim 0.500000 -1 = -1 = vertex 1.0
+1.0 = material frame
+vertex frame frame vertex
+vertex
+0.500000 bone -1 vertex
+0.500000 0.500000
+anim -1 0.500000
+vertex anim bone vertex frame frame 0.500000
+texture
+=
+0.500000 = 1.0 -1 material anim anim = 1.0
+frame anim = 0.500000 material
+anim = frame vertex = vertex material 1.0
+-1 0.500000 anim 1.0
+anim
+anim material
+frame -1 texture =
+texture
+anim
+vertex vertex bone = = frame vertex = 1.0 -1 material -1
+-1 material 1.0 = bone texture material
+1.0 1.0 vertex 0.500000 vertex
+= =
+-1 anim 0.500000 vertex anim 0.500000 anim -1 anim
+bone bone
+anim
+anim material material
+vertex bone
+material frame
+-1 material vertex 0.500000 vertex 1.0 0.500000 bone anim anim = anim
+1.0 frame material vertex 1.0
+0.500000
+-1
+bone texture 1.0 material material material anim frame 0.500000 vertex material
+anim vertex
+0.500000 texture = -1
+0.500000 frame
+vertex 0.500000 material anim anim -1 frame frame
+= 1.0
+frame texture vertex
+= vertex -1
+anim bone 0.500000
+material 1.0 material = material vertex frame bone
+frame
+1.0 anim
+1.0 = anim fra
\ No newline at end of file
@@ -0,0 +1,25 @@
+anim 0.500000 anim material anim anim bone
+vertex 1.0 1.0 texture material
+frame vertex bone 1.0 = texture anim material vertex frame
+0.500000 -1 -1 material
+anim bone -1 0.500000
+1.0 vertex frame anim = -1 1.0 frame = 1.0 frame anim frame 1.0 bone bone
+1.0 anim 1.0 = bone anim
+vertex texture
+=
+texture = 0.500000 bone 0.500000 material
+vertex
+= anim bone vertex 0.500000 -1 = 0.500000 bone vertex
+vertex 1.0 -1 material 0.500000 = anim
+0.500000 anim
+= = material texture
+-1 vertex material vertex frame texture 1.0 anim material 1.0 material vertex vertex
+0.500000 0.500000 material
+vertex anim material
+-1 frame
+vertex material
+-1
+1.0 -1
+frame -1 vertex
+bone material texture = -1 -1 material anim -1 0.500000
+vertex 0.5000
\ No newline at end of file
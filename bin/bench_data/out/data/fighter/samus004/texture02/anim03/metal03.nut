@@ -0,0 +1,2 @@
+vertex bone frame 1.0 frame frame anim frame bone = frame vertex =
+= materia
\ No newline at end of file
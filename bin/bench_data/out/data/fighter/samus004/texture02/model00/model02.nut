@@ -0,0 +1,65 @@
+vertex = frame bone -1
+vertex texture texture =
+frame = 1.0
+-1 = vertex frame texture 1.0 anim vertex texture anim vertex anim texture vertex
+-1 -1 0.500000 material
+1.0 frame material = texture texture
+anim bone frame frame bone
+texture material
+anim texture anim frame =
+0.500000
+-1
+frame
+vertex bone -1 = bone
+frame texture texture =
+0.500000 -1 bone
+vertex -1 anim anim anim frame
+frame bone
+vertex -1 -1 frame
+bone 1.0
+vertex 0.500000
+-1
+-1 -1 material 1.0 -1
+1.0 0.500000
+0.500000 anim
+frame material
+texture 0.500000 anim vertex anim frame vertex anim
+0.500000
+texture 0.500000 vertex
+vertex material
+texture bone texture
+frame material -1
+texture
+texture =
+texture bone
+=
+texture anim frame anim frame
+texture frame
+vertex anim vertex vertex frame -1 material
+0.500000 bone frame anim =
+bone frame frame bone
+=
+vertex bone
+anim
+1.0
+-1 bone = vertex frame material bone bone frame 0.500000
+0.500000
+1.0 0.500000 0.500000 frame 1.0
+anim
+0.500000 vertex material
+frame -1 = material = texture = -1 -1 material 0.500000 material
+-1 -1
+material bone 1.0
+anim
+0.500000 0.500000
+material
+bone vertex = texture texture 0.500000 anim anim frame
+texture
+anim vertex frame bone frame texture vertex 0.500000 anim 0.500000 = frame = =
+0.500000 anim texture vertex 1.0 vertex
+bone anim 1.0
+vertex bone material material bone 0.500000
+0.500000 anim
+bone = frame
+0.500000 1.0 texture -1 bone
+-1 anim material 0.50000
\ No newline at end of file
@@ -0,0 +1,19 @@
+1.0
+bone 0.500000 anim bone 0.500000 material vertex 0.500000 material bone 1.0
+material anim -1 anim =
+bone
+material anim texture
+bone -1
+1.0 vertex vertex = bone
+bone -1 material = -1 vertex -1 -1 frame vertex texture
+anim frame bone 0.500000 texture
+texture 1.0 vertex -1
+texture
+anim
+vertex -1
+anim vertex
+-1
+vertex
+anim anim -1
+0.500000 -1 material bone bone
+-
\ No newline at end of file
@@ -0,0 +1,10 @@
+= 0.500000
+-1
+vertex texture texture
+vertex -1 bone anim material bone
+vertex
+= 0.500000 texture
+-1 frame texture
+= -1 material vertex bone =
+-1
+text
\ No newline at end of file
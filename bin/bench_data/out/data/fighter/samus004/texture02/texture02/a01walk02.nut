@@ -0,0 +1,10 @@
+material anim 0.500000 texture
+anim
+0.500000 0.500000 0.500000
+frame -1
+texture
+-1 =
+frame bone material 0.500000 frame = = = vertex 0.500000 -1
+-1 frame material
+0.500000
+frame = vertex 
\ No newline at end of file
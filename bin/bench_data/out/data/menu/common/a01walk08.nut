@@ -0,0 +1 @@
+ܼ_':L@@GiVJ]6lr
\ No newline at end of file
@@ -0,0 +1,62 @@
+vertex vertex =
+frame
+0.500000 1.0 -1 0.500000 material =
+anim bone -1 anim texture material = texture 0.500000 texture
+anim vertex material vertex frame
+vertex
+0.500000
+vertex 1.0 0.500000 -1 1.0 =
+frame -1 texture
+= anim = -1 texture texture 0.500000 anim
+bone
+1.0 vertex 0.500000 = -1 1.0 1.0 bone material frame
+vertex -1 material = = texture = = frame material = 1.0 0.500000
+material -1 texture bone texture
+= material material bone frame frame
+frame
+material bone frame = texture anim
+-1 texture bone = anim material -1 texture -1 -1
+= 0.500000 1.0 1.0
+1.0 texture
+anim 1.0 bone bone
+frame material
+vertex anim
+-1 vertex -1
+texture -1 bone texture 0.500000 anim vertex anim material frame
+texture vertex frame
+vertex bone
+vertex 1.0
+texture
+vertex material bone anim vertex -1
+texture =
+= 0.500000 anim texture
+0.500000 anim -1 = bone
+texture material bone texture material anim
+0.500000 1.0
+material
+0.500000
+1.0 texture 1.0
+texture = anim
+bone frame anim texture anim -1
+vertex vertex anim 0.500000 -1 = = frame
+vertex material frame 0.500000
+bone vertex = texture texture vertex 1.0 vertex
+material = 1.0 = anim 0.500000
+anim
+frame 1.0 bone anim texture
+anim
+1.0 -1 1.0 = bone material
+frame
+texture
+bone
+material
+-1 anim
+anim vertex material 0.500000
+material vertex =
+anim bone material vertex 1.0
+vertex
+texture texture 1.0 bone vertex material anim anim
+1.0 -1 vertex anim 0.500000 0.500000 =
+anim 1.0 vertex 0.500000 bone vertex 0.500000 material material
+bone bone
+0.500000 m
\ No newline at end of file
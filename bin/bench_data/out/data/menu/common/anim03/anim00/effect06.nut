@@ -0,0 +1,154 @@
+bone
+anim
+= -1
+anim
+= material
+texture texture
+anim 0.500000 vertex = texture bone 0.500000
+texture = bone = 1.0 vertex 1.0 frame anim 0.500000 texture
+0.500000 bone frame =
+= material anim frame = -1 bone
+vertex material 1.0 vertex -1 -1 bone
+anim = bone material texture 1.0
+1.0
+vertex 1.0 vertex
+material 1.0 texture
+anim = bone frame
+bone texture material -1 0.500000 texture
+1.0 anim
+= frame material -1 1.0 frame frame bone anim = bone -1 anim = vertex 1.0
+1.0 -1 texture = anim
+material
+anim = 0.500000 -1 0.500000
+bone bone texture -1
+frame
+frame 0.500000 bone
+1.0
+frame bone
+vertex
+1.0 -1 frame bone 1.0 material
+material material -1 bone bone
+1.0 bone
+1.0 -1 bone
+= texture bone texture 1.0 1.0 anim
+anim
+material frame -1 1.0 anim
+-1 material
+0.500000 material = texture material texture texture
+frame anim 0.500000
+anim frame material vertex frame material -1 vertex material bone
+bone frame 0.500000 1.0
+0.500000 frame 0.500000 frame material 0.500000 frame
+bone
+vertex texture frame
+bone
+1.0
+0.500000 vertex 0.500000 texture
+vertex
+material =
+-1
+texture
+bone = -1 anim
+material material frame frame -1 0.500000 anim material 0.500000 0.500000
+texture
+anim texture -1 -1 material anim vertex = texture = material 1.0 1.0 anim anim
+= bone bone
+1.0 vertex 1.0
+bone vertex
+vertex material 0.500000 = = 0.500000 frame texture frame material material material = frame anim
+material texture
+= vertex anim vertex texture frame vertex texture bone material texture vertex bone
+bone 1.0 bone texture bone
+= -1 -1
+vertex 1.0 bone 0.500000 material = -1 1.0 bone
+anim
+bone 0.500000 =
+bone
+-1 -1
+vertex
+vertex vertex
+-1 =
+texture frame frame anim -1 = anim
+anim
+-1 material texture = material vertex material 0.500000
+material -1
+material texture =
+bone
+1.0 anim -1 material
+1.0 anim frame texture material 1.0 vertex 1.0 material
+-1
+texture = bone
+material 1.0 = material bone vertex 0.500000
+bone vertex frame material = bone vertex vertex vertex
+0.500000 -1
+vertex 1.0 vertex
+material -1
+1.0 material
+= frame anim
+0.500000 0.500000
+-1 0.500000 material -1 0.500000 anim
+0.500000 material = frame anim texture texture
+bone
+texture material 0.500000 = 0.500000 = 0.500000 material texture = material frame anim bone frame frame
+1.0 0.500000
+=
+0.500000
+material bone vertex
+frame
+0.500000
+1.0 anim
+= =
+frame 0.500000 material 0.500000 =
+-1 1.0 vertex -1 frame material = frame vertex -1 texture texture texture anim vertex 1.0 material vertex anim = bone frame anim
+-1 0.500000 0.500000
+texture frame texture 1.0 vertex material vertex vertex
+-1 1.0 bone
+anim anim
+bone
+texture frame
+= 1.0 frame 0.500000 texture anim
+= material
+= 1.0
+vertex
+0.500000 bone anim
+frame
+texture texture bone -1 = bone 0.500000
+anim 0.500000 vertex material material
+bone frame material = frame -1 vertex
+-1 frame = bone frame texture bone texture material -1 -1 texture 0.500000 -1
+material bone frame -1 bone anim 1.0 texture anim 0.500000 vertex texture 0.500000
+-1 frame 1.0
+vertex vertex
+vertex
+anim bone =
+= bone =
+1.0 -1 1.0 0.500000
+-1
+frame
+1.0 texture
+= texture anim = 1.0 -1
+1.0
+vertex 0.500000
+1.0 material texture
+bone -1 frame -1 -1 frame
+texture
+vertex = -1 1.0 0.500000 0.500000
+anim
+bone
+texture vertex = material
+bone 0.500000
+frame
+anim = anim vertex frame
+vertex bone = -1 0.500000 anim 1.0
+anim anim 1.0 material 1.0 frame
+-1 material 0.500000 -1 anim
+frame vertex texture 1.0 -1
+frame vertex vertex
+vertex anim
+texture material 0.500000 0.500000 1.0 vertex -1
+bone 0.500000 texture material vertex -1
+vertex
+bone
+vertex 1.0 material
+anim texture
+vertex 1
\ No newline at end of file
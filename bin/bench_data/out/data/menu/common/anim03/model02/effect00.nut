@@ -0,0 +1,138 @@
+material 1.0
+material texture material
+= -1 bone material
+vertex
+1.0 0.500000 0.500000 1.0
+anim vertex 1.0 frame texture anim
+0.500000 vertex material -1 frame 0.500000 = bone anim vertex 1.0 1.0
+anim -1 frame 0.500000 material 1.0 texture
+bone 1.0 material 1.0 1.0 1.0 = vertex frame
+vertex material bone bone 1.0
+= vertex -1 material texture
+bone 1.0 bone texture frame
+anim 0.500000 vertex anim vertex = -1 = frame
+texture frame frame
+material 1.0
+material anim texture 1.0 0.500000 1.0
+texture material = -1 texture -1 =
+=
+-1 anim 0.500000 =
+bone -1 material -1 1.0 vertex -1
+vertex vertex
+bone = texture
+texture material vertex
+anim 1.0 texture vertex 1.0
+0.500000 vertex
+vertex texture 1.0 bone 0.500000 1.0 1.0
+vertex 1.0 1.0 bone vertex 1.0 bone
+1.0 anim material anim bone texture -1
+material texture
+= 1.0
+1.0 =
+vertex bone frame
+1.0
+1.0 anim
+anim vertex bone -1
+anim 0.500000
+= material
+bone bone
+texture frame material 1.0 anim
+anim 1.0 vertex 1.0 frame 1.0
+frame
+bone texture frame bone = bone bone
+anim -1
+texture -1 0.500000 =
+frame
+frame anim frame
+material vertex material 0.500000 frame =
+-1 anim
+-1 = bone vertex texture frame
+1.0 -1 frame = frame frame anim material anim -1 vertex -1 -1
+anim frame frame vertex anim
+anim
+material -1 material bone
+texture material -1 0.500000
+anim bone vertex frame anim
+vertex =
+texture 0.500000
+vertex material = material -1
+bone vertex material
+bone 1.0
+anim
+= bone texture material 0.500000 -1 vertex frame material vertex texture anim material texture texture -1 anim bone vertex vertex texture
+texture bone
+material
+texture frame = material -1 0.500000
+= material texture =
+= anim
+anim texture 1.0 = bone 1.0 anim bone anim
+frame bone = bone frame
+bone 0.500000
+anim
+material vertex vertex -1 bone -1 anim bone vertex 0.500000 vertex anim frame =
+= = anim =
+anim
+anim
+anim frame frame texture vertex material texture frame frame vertex =
+frame 0.500000
+vertex bone
+material -1 material texture vertex
+vertex -1 bone 1.0 bone 0.500000 anim -1
+anim = 0.500000 =
+material bone anim -1 material frame texture anim bone 1.0
+vertex
+-1 -1 = bone =
+material 0.500000 anim 0.500000
+vertex texture
+0.500000 frame
+texture =
+vertex -1 =
+1.0 frame
+1.0
+bone frame anim
+bone material
+bone
+-1 vertex
+-1 -1
+1.0 = anim
+bone 1.0 texture = anim texture 1.0 vertex frame anim vertex bone -1 = vertex
+anim material
+texture vertex vertex bone texture
+material texture =
+bone texture texture bone =
+-1
+frame anim vertex
+0.500000 material = bone 1.0 0.500000
+bone
+material 0.500000 frame
+material
+texture 1.0 frame material vertex vertex vertex texture vertex -1 0.500000 texture
+vertex
+frame bone -1 bone
+bone vertex
+= vertex frame anim
+vertex texture
+material 1.0 0.500000 1.0 -1 -1 frame =
+0.500000 vertex vertex 0.500000 anim
+= bone -1 material material -1 material
+material
+vertex anim material frame texture -1 = -1 bone = 0.500000
+= texture texture = vertex
+frame anim material texture bone texture = 1.0
+1.0
+1.0 0.500000 anim 0.500000 anim
+vertex material
+= 1.0 0.500000 texture -1 -1 frame
+anim frame
+-1 1.0 anim material frame bone material anim 1.0 anim texture 0.500000 texture vertex
+frame frame
+frame -1 1.0 frame anim
+texture anim material anim vertex 1.0 anim vertex =
+texture = anim texture bone vertex frame material 0.500000 = frame bone bone 0.500000 vertex material frame vertex frame 0.500000 0.500000 bone bone vertex texture anim 1.0
+bone
+-1 bone anim
+vertex
+vertex material
+material bone 1.0 1.0
+=
+bone bone frame ani
\ No newline at end of file
@@ -0,0 +1,163 @@
+= -1 vertex material
+bone anim material vertex -1 0.500000 material 1.0 0.500000
+bone
+bone vertex
+frame 0.500000 vertex material
+material material material =
+1.0
+bone frame
+material 1.0 anim anim anim = 0.500000 1.0 -1 =
+= frame = 0.500000 anim texture
+anim material texture =
+bone = frame
+texture bone bone 1.0 texture vertex -1 -1 bone 0.500000
+1.0 vertex
+-1 -1
+-1
+frame
+texture
+texture frame = frame = 1.0 anim 1.0
+texture anim
+bone -1 material frame
+frame = vertex -1
+-1 = 0.500000
+material bone material 0.500000
+=
+bone anim texture 1.0
+1.0 texture
+anim =
+material
+0.500000 0.500000
+-1 anim 0.500000
+vertex
+= 1.0
+anim vertex
+material 0.500000 texture frame texture
+texture texture 0.500000 anim anim
+anim vertex material
+vertex 0.500000 -1 -1 -1
+1.0 vertex anim frame texture material anim = material
+bone
+0.500000 0.500000
+=
+material vertex material bone
+vertex bone 1.0 vertex anim vertex anim = material material anim 1.0 bone
+anim
+= bone
+frame
+frame material bone 0.500000 0.500000 frame
+-1 -1 1.0 1.0 1.0
+vertex texture
+-1 bone = material anim frame material 0.500000 anim -1
+1.0 anim
+texture material
+-1 1.0
+anim material vertex material -1 material = anim
+texture bone bone material =
+vertex texture bone vertex vertex 1.0 1.0 1.0 -1 = =
+-1 texture -1 anim bone -1 0.500000
+= frame
+anim -1 vertex -1
+material vertex 0.500000 anim material
+-1 1.0 vertex = -1 bone
+0.500000
+texture material = 0.500000 vertex 0.500000 1.0
+= frame anim
+texture material frame = texture anim = 1.0 bone
+vertex
+vertex 0.500000 texture material material -1
+= bone 0.500000
+=
+= anim material vertex frame
+vertex
+= -1
+= 0.500000 0.500000 -1 1.0 = -1 -1 anim 0.500000
+material =
+texture anim anim = frame material
+frame 0.500000
+bone = vertex vertex 1.0 anim material vertex bone material anim -1
+texture vertex anim vertex anim vertex 0.500000 -1
+frame frame frame vertex
+material vertex = vertex -1 = -1
+anim
+= vertex material -1 frame 1.0
+frame = 0.500000
+bone material material anim
+1.0
+anim = anim anim texture =
+1.0 vertex 0.500000 material -1 material -1
+vertex frame texture anim -1 = 1.0 anim material 0.500000 1.0 -1
+= texture
+1.0 vertex frame
+bone 1.0
+anim texture frame bone = anim bone
+= anim 0.500000 =
+anim
+-1 = texture anim
+1.0
+bone
+0.500000
+vertex 1.0 bone =
+0.500000 frame
+= frame
+0.500000 texture
+anim anim
+material material 0.500000 -1
+vertex = frame 1.0 = =
+vertex bone texture
+1.0 frame
+0.500000 vertex
+0.500000 bone vertex anim -1 frame vertex 0.500000
+material 1.0 bone frame
+0.500000 vertex -1 0.500000 = -1 material anim
+0.500000 1.0 texture 1.0 = texture -1 vertex vertex texture 1.0 anim 1.0
+vertex
+material
+1.0 anim bone material =
+material
+-1 1.0
+bone -1
+-1 0.500000 1.0 -1 = = vertex 0.500000 vertex texture 1.0 frame 0.500000
+=
+material 0.500000 =
+frame material
+texture material material
+anim vertex
+material
+vertex 0.500000 1.0 material texture 1.0 1.0 material material 1.0 -1
+frame texture vertex anim bone
+vertex 0.500000 bone
+vertex bone
+anim -1
+frame vertex
+texture bone
+= 1.0 -1 frame 1.0 0.500000 material texture anim
+anim
+frame
+bone texture
+vertex frame bone texture material material
+material
+frame frame
+texture vertex = frame
+vertex -1 vertex frame
+0.500000
+bone vertex
+bone texture bone frame frame texture
+anim texture -1
+bone anim vertex 0.500000 vertex
+-1 material
+0.500000 anim 0.500000
+-1 frame bone
+material 1.0
+texture frame -1 1.0
+1.0 0.500000 = anim
+bone bone
+0.500000 1.0 vertex 0.500000 material frame
+0.500000
+anim
+bone vertex
+= -1
+material
+vertex material
+-1 bone vertex material
+0.500000 ve
\ No newline at end of file
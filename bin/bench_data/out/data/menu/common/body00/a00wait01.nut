@@ -0,0 +1,6 @@
+texture vertex frame
+0.500000
+texture material -1
+-1 vertex texture anim material texture
+vertex
+-1 1.0 = 
\ No newline at end of file
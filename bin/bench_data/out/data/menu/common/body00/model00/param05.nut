@@ -0,0 +1,19 @@
+anim =
+texture
+frame 0.500000 0.500000 0.500000 0.500000
+texture texture 0.500000 texture
+bone anim
+anim anim -1 vertex =
+material anim
+vertex vertex
+frame
+vertex 1.0 frame bone
+texture material texture
+-1 1.0 -1 1.0 frame anim bone material 0.500000 -1
+bone
+-1 texture 1.0 vertex = texture texture
+texture frame
+-1
+frame 1.0 texture
+bone bone texture texture anim vertex vertex
+material -1 ve
\ No newline at end of file
@@ -0,0 +1,7 @@
+material 1.0 0.500000 bone = 1.0 frame
+vertex bone vertex anim
+-1 = 1.0
+-1 1.0 bone bone
+frame bone
+frame frame anim vertex
+texture bone 0.500000 texture -1 vertex vertex
\ No newline at end of file
@@ -0,0 +1,10 @@
+1.0 0.500000
+texture -1
+texture 0.500000 frame texture
+0.500000 frame texture = material
+material -1 =
+-1 vertex texture texture material 1.0 1.0
+texture
+-1 bone
+vertex material
+1.0 = bone -1 tex
\ No newline at end of file
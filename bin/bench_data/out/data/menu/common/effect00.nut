@@ -0,0 +1,102 @@
+texture
+-1
+material -1
+-1 material
+1.0
+1.0 texture bone vertex material
+material material texture vertex -1 1.0 bone vertex 0.500000 = vertex 1.0 bone
+anim anim frame texture 0.500000 texture frame 1.0 frame frame
+material vertex material anim 1.0 = bone vertex anim material 1.0 vertex -1 vertex
+0.500000 frame -1 anim frame
+0.500000 = vertex material 0.500000 = -1 -1 0.500000 anim texture = 0.500000
+1.0 texture = -1 0.500000 frame = anim anim
+anim -1 -1 material
+1.0
+bone bone 0.500000 = frame 1.0
+1.0 0.500000 vertex 0.500000 texture 0.500000 texture -1 frame
+-1
+bone
+material
+= vertex bone 0.500000
+bone 0.500000 texture
+0.500000 vertex
+-1 texture
+material
+frame vertex = texture 0.500000 material anim
+= 1.0
+-1 bone = 0.500000
+material frame
+anim vertex material =
+anim -1 frame
+texture -1 bone
+0.500000
+texture bone anim texture anim anim =
+material
+frame =
+texture
+vertex
+1.0 0.500000 = anim texture
+0.500000 texture
+anim bone =
+bone
+0.500000 anim frame vertex anim vertex
+material texture
+material = bone material -1 texture anim bone material bone frame frame 0.500000 -1 1.0
+texture -1 1.0 texture material texture anim
+=
+1.0
+texture
+0.500000 1.0 0.500000 vertex material frame texture
+frame -1 = anim
+material 0.500000 -1 vertex material
+anim
+material 0.500000 vertex material frame 1.0 material texture material anim vertex vertex 1.0
+anim
+-1 frame bone 0.500000 -1
+material texture
+bone = bone material
+= material vertex 1.0
+vertex
+texture
+texture anim = anim anim anim frame 1.0 material
+1.0
+vertex anim frame
+texture 1.0 frame -1
+vertex vertex = anim
+0.500000
+-1
+vertex material bone
+frame
+1.0 bone 1.0 material texture texture vertex frame = =
+texture material material texture = 1.0 bone material 1.0 0.500000 vertex
+frame = = texture bone anim
+material material = vertex -1 vertex
+material anim material
+bone -1 texture texture texture 1.0 -1 frame
+frame vertex
+vertex
+0.500000 vertex material bone
+= frame =
+anim frame 1.0 = -1
+frame 1.0 texture
+material frame frame = texture 0.500000 vertex
+vertex bone
+0.500000 -1 1.0 texture frame
+= 1.0
+vertex 0.500000
+1.0
+texture
+material = material anim texture
+= -1 -1 material
+bone vertex frame 1.0
+vertex bone material 1.0 1.0
+anim
+0.500000
+0.500000 = bone texture texture
+bone bone frame bone vertex
+-1
+= -1
+= anim 1.0 frame
+anim
+frame texture = -1 1.0 1.0 -1 1.0
+anim mater
\ No newline at end of file
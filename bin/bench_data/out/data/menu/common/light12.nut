@@ -0,0 +1,8 @@
+vertex
+-1 material
+-1
+anim -1 bone -1 texture -1 anim -1 -1 -1
+texture texture material frame
+-1 anim texture = vertex 1.0 bone 0.500000 = 1.0 1.0 -1
+1.0
+frame materi
\ No newline at end of file
@@ -0,0 +1,23 @@
+bone
+= anim
+1.0
+material 1.0 -1 material anim = vertex -1
+=
+anim 0.500000 frame
+texture =
+= frame
+1.0 = -1 bone material
+material bone = vertex 0.500000
+texture anim vertex texture texture
+anim
+vertex texture
+= =
+frame material frame = material anim
+vertex anim frame
+-1 texture bone material
+vertex texture frame = = 1.0 vertex 0.500000 1.0 0.500000 bone = -1
+frame = frame 0.500000 texture frame 0.500000 =
+bone material 0.500000 0.500000
+bone
+0.500000
+vert
\ No newline at end of file
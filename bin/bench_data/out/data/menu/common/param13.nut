@@ -0,0 +1,10 @@
+-1 anim 0.500000 1.0 material anim = anim 0.500000 bone vertex
+bone
+bone
+=
+anim bone
+1.0 0.500000 1.0 anim
+-1
+anim
+1.0 bone -1 0.500000 frame -1 texture
+1.0 0.500000 frame texture fra
\ No newline at end of file
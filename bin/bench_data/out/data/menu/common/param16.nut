@@ -0,0 +1,109 @@
+anim
+1.0 texture -1 0.500000
+vertex -1 texture
+0.500000 -1 anim bone texture 0.500000 anim
+bone
+1.0
+material texture
+0.500000 0.500000
+vertex 0.500000 frame anim
+anim vertex
+vertex frame = frame texture -1
+vertex = 0.500000 bone frame = 1.0 texture anim material
+frame frame
+material 0.500000
+1.0 0.500000
+texture 1.0 1.0 1.0 -1 frame -1 vertex
+-1 texture
+0.500000
+1.0 bone bone 0.500000 anim
+frame bone 0.500000 material
+frame material texture anim
+vertex material frame frame 1.0 0.500000 = 1.0 bone
+0.500000
+vertex -1 texture
+texture -1 =
+material material anim
+anim -1 vertex
+vertex
+bone
+texture material
+frame
+material material 1.0
+1.0 anim
+vertex 0.500000 1.0
+frame = 1.0 texture
+anim
+anim
+anim
+vertex
+-1 material 0.500000 -1 0.500000 0.500000 1.0 0.500000
+vertex texture
+material
+= = anim bone 0.500000 0.500000 material
+material material texture
+1.0 bone material
+1.0 vertex 1.0 frame vertex
+texture
+texture material frame bone anim 0.500000 vertex frame frame material texture vertex
+0.500000 texture
+anim
+anim
+anim material -1 anim texture texture anim
+bone texture 0.500000 -1 1.0 texture 1.0
+texture -1 material = anim anim texture frame 1.0 bone = 1.0 frame texture -1 texture material
+-1 vertex bone = vertex -1 frame texture 0.500000
+1.0 bone 0.500000
+0.500000 texture material
+0.500000 1.0 0.500000
+vertex -1 frame frame
+frame material
+material vertex 0.500000 bone
+material vertex 1.0
+-1
+bone = vertex anim material = -1 0.500000 1.0 material = frame material = -1
+0.500000 1.0 anim vertex
+vertex
+bone
+frame vertex 0.500000 bone vertex bone
+vertex
+1.0
+1.0 1.0 -1 -1 vertex texture vertex 1.0 0.500000 = = bone bone vertex
+material 0.500000
+1.0 anim bone
+material -1 = anim
+0.500000 frame bone texture bone 1.0 texture
+-1 texture 1.0 material texture
+0.500000 frame
+vertex bone
+anim
+bone =
+-1
+= bone vertex 0.500000 0.500000
+frame vertex
+material vertex texture frame vertex 1.0
+0.500000
+1.0 vertex texture -1 1.0 texture material anim 0.500000 anim vertex anim texture = anim anim material 1.0 = 1.0 vertex -1 1.0 material 1.0 material
+= frame bone bone 0.500000 frame frame
+bone
+frame 0.500000 material material
+1.0
+1.0
+material
+0.500000
+texture 1.0
+-1
+material =
+material -1 vertex anim anim
+frame anim frame 0.500000 anim vertex texture material texture
+0.500000 anim bone vertex anim frame
+texture bone
+texture anim
+vertex anim =
+bone material = 1.0 frame vertex 0.500000 = vertex bone vertex bone 0.500000 -1 anim -1
+1.0
+0.500000 frame = -1 frame vertex
+texture vertex vertex frame vertex
+-1 -1 -1 = 1.0
+1.0 1.0 0.500000 frame
+= t
\ No newline at end of file
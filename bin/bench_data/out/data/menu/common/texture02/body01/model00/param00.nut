@@ -0,0 +1,5 @@
+= =
+material
+vertex
+-1 1.0 bone frame
+materi
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame -1 bone =
+bone
+= anim 1.0 1.0 anim -1 0.500000 -1 = bone texture anim =
+frame bone
+anim 0.500000 texture 1.0 frame 
\ No newline at end of file
@@ -0,0 +1,73 @@
+frame
+material 0.500000
+frame bone texture material frame
+material material
+frame 1.0 frame 0.500000 -1 = 1.0 -1 = frame frame material
+anim
+-1 1.0 0.500000
+anim 0.500000 0.500000
+material anim texture
+texture bone texture bone texture vertex 1.0 1.0 texture anim -1 texture -1 1.0
+material material 0.500000 1.0
+bone material frame -1 texture
+-1 0.500000
+vertex bone 1.0
+anim material 1.0 bone 1.0 vertex bone
+anim 1.0
+bone 0.500000
+vertex -1 1.0 anim
+1.0 0.500000 texture -1 anim material texture material 1.0 texture
+texture -1 0.500000 vertex
+material
+frame frame frame
+vertex
+texture material vertex -1 material frame 1.0 bone material texture
+anim frame 0.500000 material
+material frame
+-1
+anim
+= material = 0.500000 texture
+1.0
+1.0 0.500000 texture
+bone
+bone material material
+1.0
+material material
+texture
+anim frame = =
+material bone 1.0 texture 0.500000 anim anim bone
+vertex -1
+vertex material -1 = = 1.0 bone
+texture
+texture 0.500000 frame 0.500000 1.0 =
+texture
+material = material -1
+0.500000 bone
+material anim frame material texture vertex anim
+texture
+1.0 material
+-1 vertex texture
+frame texture bone
+-1 bone frame -1 -1 frame texture bone = -1 anim texture
+bone 0.500000
+texture = bone vertex -1 -1
+1.0 0.500000 1.0 -1 1.0 vertex -1 anim
+= frame
+material vertex frame
+vertex texture
+vertex frame
+0.500000 = -1 =
+= material frame
+anim =
+frame -1
+material vertex
+vertex -1 -1
+frame
+= frame
+= vertex 1.0 0.500000 texture anim = 0.500000 1.0 = material anim -1
+material = 0.500000 bone anim bone 0.500000 0.500000
+=
+anim anim
+frame
+bone vertex vertex frame
+bone anim 1.0 f
\ No newline at end of file
@@ -0,0 +1,26 @@
+bone texture vertex
+1.0 vertex anim anim -1 texture
+1.0
+0.500000 material
+1.0
+anim
+material = texture material texture vertex
+0.500000
+vertex 1.0 bone texture
+texture 0.500000 = -1 1.0 0.500000
+1.0 1.0 bone
+-1 = vertex = frame material vertex 1.0 0.500000 texture texture 0.500000 -1 texture anim vertex
+vertex
+texture material anim anim 1.0 vertex frame material
+1.0 frame 0.500000 frame -1
+1.0 frame texture
+texture 0.500000
+vertex vertex -1
+1.0 anim =
+vertex material
+vertex
+bone anim texture bone material material bone
+anim frame 0.500000 material
+anim bone material 0.500000 anim frame vertex
+material -1 = frame 1.0 1.0 anim 0.500000 frame anim vertex anim
+1.
\ No newline at end of file
@@ -0,0 +1,114 @@
+texture 0.500000 -1
+0.500000 -1 bone 0.500000 anim material 0.500000 = bone vertex 1.0 texture 0.500000
+0.500000 texture vertex vertex 1.0 1.0
+-1
+anim 1.0 bone bone texture frame
+1.0
+bone
+0.500000 = 1.0 -1 anim
+frame frame material
+vertex
+frame material anim = = 1.0
+-1
+1.0 frame vertex = anim 1.0 vertex
+anim 1.0 vertex 0.500000 bone
+0.500000 texture 1.0 vertex
+material frame frame bone material frame anim
+= vertex = 0.500000
+0.500000 0.500000 frame bone 0.500000
+texture material bone
+vertex 1.0 texture texture 1.0 1.0 texture
+0.500000
+0.500000 bone 0.500000 0.500000 = bone anim = frame material
+-1 anim = frame 0.500000 = material texture -1 vertex vertex
+frame = 0.500000
+vertex frame -1
+=
+-1 texture 0.500000
+1.0
+-1 = -1 bone
+= vertex texture
+-1 bone texture material texture frame =
+-1 1.0 texture material
+anim -1 -1 anim material material texture anim vertex frame
+material -1 vertex vertex texture
+-1 1.0 anim anim -1 material vertex
+1.0
+=
+texture bone material vertex 0.500000 material material
+frame 0.500000 anim material material anim material
+bone anim 0.500000
+-1 texture 0.500000 anim frame 0.500000
+texture bone = 0.500000
+1.0 0.500000 texture
+= vertex = frame vertex
+-1 frame
+vertex frame
+frame frame -1
+bone bone
+texture bone material = anim
+0.500000 1.0
+texture texture bone
+texture anim
+texture vertex 1.0 bone
+material texture
+-1 frame material =
+anim
+texture 0.500000 material material texture vertex texture vertex bone
+1.0 frame bone vertex bone
+vertex = texture
+1.0 = vertex anim anim 0.500000 texture 0.500000 frame vertex
+1.0 vertex material -1 = -1 0.500000 material texture 1.0 bone anim
+bone frame anim 1.0 0.500000 bone 0.500000 vertex =
+bone 0.500000 material
+=
+0.500000 0.500000 material
+1.0 frame
+-1
+bone anim 1.0
+1.0 material 0.500000 1.0
+1.0 -1 frame anim 1.0 texture -1 1.0 1.0 = texture vertex 1.0
+material 0.500000 = frame vertex frame
+0.500000 material
+1.0 bone 1.0
+bone 1.0 0.500000 -1 -1 0.500000 -1
+1.0 vertex -1 0.500000
+anim
+anim 1.0
+texture
+anim -1 anim material frame -1 bone 0.500000 -1 -1 0.500000 = bone = texture texture 0.500000
+= texture -1 1.0 bone = bone = -1 =
+vertex =
+bone -1 0.500000
+material anim
+frame material
+1.0 texture anim = 0.500000 vertex anim 1.0 bone
+texture material texture 0.500000 bone material vertex bone -1 frame anim frame frame frame vertex
+bone texture bone -1 0.500000
+material frame
+anim
+0.500000 = vertex bone material material
+bone 1.0
+vertex -1
+material bone
+frame
+material material frame material 0.500000 = anim bone texture 0.500000 material vertex texture
+frame
+frame bone
+texture texture
+material
+bone 1.0
+vertex
+1.0
+anim
+=
+material
+frame =
+frame frame vertex -1
+texture 1.0 vertex 1.0 texture 0.500000 anim 0.500000 0.500000 frame bone
+bone = 1.0 0.500000 frame vertex frame
+vertex material
+1.0 = material frame vertex
+texture bone
+material
+-1 =
\ No newline at end of file
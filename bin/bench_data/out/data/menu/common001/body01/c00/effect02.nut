@@ -0,0 +1,322 @@
+frame vertex = texture texture 1.0
+material
+bone = texture frame frame -1
+material -1 material 1.0 =
+frame frame
+anim texture
+frame texture
+material material frame -1 bone
+bone = texture
+frame
+0.500000 1.0 bone
+frame bone anim -1 bone 0.500000
+-1 anim 1.0 = 0.500000 frame
+texture
+anim -1 anim
+texture
+texture
+0.500000 material
+-1
+1.0 texture
+texture texture
+vertex -1 =
+-1 vertex
+vertex 0.500000 -1 frame anim material = 1.0 1.0
+-1 0.500000 1.0 0.500000
+frame bone material 0.500000 = vertex vertex
+0.500000 frame anim frame frame
+vertex
+-1
+-1 anim
+vertex
+= anim
+0.500000
+0.500000 1.0
+texture
+bone -1 0.500000 -1 -1
+1.0 0.500000
+anim texture bone = 0.500000 0.500000
+vertex material texture frame = bone frame
+bone -1 texture 1.0 1.0 bone
+-1 anim frame vertex bone frame =
+-1
+anim bone vertex frame 0.500000 texture frame anim material vertex frame bone bone anim vertex 1.0 = frame -1 frame 0.500000
+vertex vertex
+anim texture
+bone texture
+-1 1.0 bone material = vertex -1 anim
+-1 1.0
+texture 0.500000 vertex vertex
+-1 material
+= anim 1.0
+anim 0.500000
+texture 1.0 bone bone anim = bone -1
+vertex material
+0.500000 -1 material frame
+0.500000 vertex bone
+material
+vertex -1 bone frame
+0.500000 = frame =
+vertex
+-1
+anim texture
+-1 -1
+= anim frame
+anim 0.500000 frame = = bone
+anim
+-1 1.0 material 0.500000
+1.0 anim -1 bone
+material texture
+1.0
+1.0 material bone frame vertex -1 vertex anim frame
+= anim
+anim 0.500000
+bone 1.0 anim
+1.0 0.500000 1.0
+-1 anim = anim 1.0 -1
+vertex material texture vertex
+frame anim -1
+-1 vertex bone vertex = anim
+texture =
+bone vertex vertex frame 0.500000 material bone
+bone 1.0 1.0 = = = 1.0 vertex vertex
+0.500000 vertex material texture -1 frame
+vertex = -1
+frame -1 = bone =
+0.500000 material 0.500000 texture frame texture
+material = bone vertex anim
+frame = 0.500000
+bone texture bone
+frame -1 anim bone
+vertex anim vertex 0.500000
+bone 0.500000 =
+vertex
+material bone
+texture
+bone
+bone material texture -1
+0.500000 frame 0.500000
+anim = 0.500000 1.0 frame -1 texture texture
+anim =
+vertex 0.500000 frame material
+texture bone
+= -1
+material
+-1 vertex -1
+texture anim frame -1 vertex bone vertex anim = bone 1.0 -1
+= material
+1.0 =
+= anim
+1.0 -1 vertex
+frame texture 0.500000 texture anim bone
+=
+frame frame texture
+0.500000 0.500000 texture
+vertex -1
+0.500000 -1 vertex
+0.500000
+vertex
+material = 1.0 anim
+-1 1.0 0.500000 0.500000 0.500000 texture
+0.500000 0.500000
+anim bone frame = vertex -1 texture material -1 -1 = bone
+vertex bone 0.500000 0.500000 0.500000 1.0 -1 vertex bone 0.500000 anim -1
+0.500000 frame vertex frame = -1
+= vertex
+bone -1
+-1 -1 texture vertex vertex -1 0.500000
+=
+anim bone -1 bone bone bone
+bone = 0.500000 material
+material 1.0 bone 0.500000 anim
+-1
+bone frame bone 0.500000 bone frame -1 -1 anim 1.0 1.0 frame
+-1 anim bone bone texture -1 0.500000
+1.0 -1
+anim texture
+bone texture bone
+frame
+bone texture -1 -1 1.0 1.0 = 0.500000 -1
+anim texture vertex
+= -1 bone anim bone bone
+frame material
+=
+material = 0.500000 anim = -1 1.0 bone = anim
+bone
+-1 = frame
+1.0
+=
+vertex bone anim 1.0 vertex bone
+0.500000 bone
+bone texture -1
+1.0 0.500000
+0.500000 vertex bone
+vertex anim bone
+anim frame -1
+=
+= 0.500000 anim =
+-1
+-1 frame frame
+bone material =
+anim =
+material anim texture 0.500000 1.0 texture frame -1
+-1 0.500000 0.500000 vertex
+frame = texture 1.0
+vertex material 0.500000 0.500000
+1.0 -1
+bone bone anim
+anim -1 anim anim -1 anim = frame 1.0 frame anim frame material =
+bone
+material material vertex texture frame
+0.500000
+bone material bone 0.500000
+1.0 0.500000 material texture
+bone -1 1.0
+1.0
+material 1.0 texture frame -1 1.0 material
+1.0 0.500000 vertex
+bone anim 0.500000 -1 0.500000 1.0 bone anim =
+1.0 bone anim
+-1 texture 0.500000 = bone frame anim vertex 1.0 bone
+material anim -1 vertex = 1.0 1.0 -1 texture 1.0
+bone = -1 texture 0.500000
+material frame anim
+vertex
+= 1.0 material
+= 1.0 0.500000 1.0 = bone
+-1
+texture -1 0.500000 material frame
+texture
+material texture 1.0 frame anim frame material
+frame
+material material texture
+material anim frame
+anim vertex texture frame vertex texture 1.0 anim -1 texture
+= vertex anim
+vertex
+frame frame
+texture vertex
+1.0 = texture
+vertex
+-1 vertex =
+1.0
+0.500000
+0.500000 anim =
+bone
+1.0 1.0 frame 0.500000 -1 vertex
+bone material
+material
+vertex
+=
+texture material
+=
+material anim =
+0.500000
+= frame frame = bone anim 0.500000 anim anim anim 0.500000 anim
+= vertex
+=
+anim -1
+bone anim
+anim 1.0
+= texture texture material material
+bone
+= = frame material texture
+= anim -1 vertex -1
+bone frame vertex bone 0.500000
+frame
+bone
+anim frame vertex = texture
+vertex texture = anim 1.0 1.0 1.0
+-1 -1
+1.0 = 0.500000 bone vertex 1.0 frame
+vertex bone =
+material =
+texture
+texture -1 anim -1 = -1
+bone 1.0
+anim frame -1 vertex bone 1.0 1.0 bone material -1 bone material -1
+anim -1 0.500000
+1.0 1.0 material
+-1 anim vertex texture
+-1 0.500000 material anim frame 1.0 0.500000 vertex
+texture vertex anim
+anim frame 1.0
+material
+-1 -1
+-1
+=
+anim
+frame 0.500000
+frame 0.500000
+= material 0.500000 1.0 1.0
+vertex frame
+bone 1.0 texture 0.500000 vertex
+bone
+vertex anim anim texture frame = bone -1 texture -1 =
+vertex material
+material
+anim 1.0 texture anim
+material
+-1 anim texture bone
+0.500000 0.500000 texture
+vertex
+0.500000 frame = frame 0.500000 anim anim anim 1.0 0.500000 vertex
+= 0.500000 0.500000 0.500000 0.500000 material frame = frame
+1.0 -1 0.500000 -1 material = texture
+0.500000 frame -1 1.0 anim texture -1 1.0 0.500000
+0.500000 -1 =
+anim
+bone texture -1
+texture
+texture
+-1
+0.500000
+texture texture
+bone
+texture material frame = anim texture
+1.0 material 0.500000 anim 1.0 anim 0.500000
+bone
+0.500000 -1 -1
+0.500000 -1
+anim
+1.0 = frame 0.500000 0.500000 bone -1 -1 =
+1.0
+texture -1 -1 vertex vertex
+-1 material frame material
+= vertex 0.500000 frame =
+vertex texture texture vertex material 1.0
+anim anim frame anim frame texture 0.500000 0.500000
+material bone
+= vertex bone =
+bone
+-1 = bone
+texture
+0.500000 material texture
+vertex
+bone anim anim frame = -1 0.500000 -1 0.500000 anim -1
+vertex material anim
+= -1 anim frame
+0.500000 -1
+-1 texture vertex frame texture 0.500000
+material = texture 0.500000 frame
+frame material frame = frame bone 1.0 material -1
+texture = anim frame texture bone
+-1
+= bone 0.500000 0.500000 1.0 material
+bone
+1.0 texture
+0.500000 -1
+0.500000
+material -1
+= =
+1.0 frame
+anim -1
+material bone
+0.500000 material -1
+frame
+vertex texture vertex frame 0.500000 frame vertex
+bone vertex texture = frame
+material 0.500000 vertex
+vertex -1 1.0 vertex
+= 1.0
+1.0 frame anim ver
\ No newline at end of file
@@ -0,0 +1,85 @@
+anim anim vertex vertex bone frame texture
+-1 vertex bone material
+texture
+0.500000
+0.500000
+texture
+bone = anim
+vertex = bone frame frame -1 anim material 1.0 vertex =
+-1 = vertex bone -1
+anim vertex material =
+= frame -1 1.0
+vertex 0.500000 =
+anim
+1.0 1.0 1.0 anim 1.0 0.500000 anim 0.500000 texture vertex material = 1.0
+texture
+vertex material
+vertex
+frame = vertex 0.500000 =
+=
+material frame bone anim material
+frame frame 0.500000 0.500000 vertex bone =
+1.0 0.500000
+vertex texture -1
+anim 0.500000 texture
+frame -1 bone
+anim
+1.0 bone bone -1
+texture
+-1 1.0 vertex
+1.0
+material -1 1.0 bone
+texture
+bone anim bone
+-1
+texture -1 material 0.500000
+0.500000 vertex frame frame -1 frame anim texture
+1.0 vertex vertex anim
+material texture anim vertex 1.0 frame = bone
+-1 anim anim bone texture bone
+0.500000 = texture 1.0 texture 1.0 bone anim
+bone 1.0
+=
+bone =
+anim
+anim = -1
+= texture 1.0 = 0.500000
+anim 1.0 bone 1.0 frame =
+texture bone
+anim anim bone frame 0.500000 1.0
+material vertex 0.500000 vertex
+bone 1.0 vertex bone anim frame -1
+texture
+vertex 1.0
+1.0
+1.0
+texture
+-1 0.500000
+vertex
+-1 material
+texture bone
+0.500000
+material -1 anim 1.0 1.0 frame
+0.500000 = frame -1 bone vertex -1 -1 anim
+texture vertex material anim 1.0 = 0.500000 texture material 1.0 -1 anim material frame
+frame 0.500000 1.0
+texture texture frame
+vertex bone vertex bone anim vertex
+-1 -1 1.0 -1 0.500000 -1 0.500000
+0.500000
+vertex
+material material = 0.500000 vertex bone
+0.500000
+material
+texture vertex 1.0 frame
+material texture -1 anim vertex vertex texture = = anim -1 bone = -1
+-1
+texture vertex
+anim
+0.500000 0.500000 bone material 1.0 -1
+anim 1.0 anim texture 1.0 1.0 0.500000
+material material 0.500000 frame anim texture
+=
+anim 0.500000 1.0 = bone vertex
+texture texture
+texture frame 1.0 texture material = bone text
\ No newline at end of file
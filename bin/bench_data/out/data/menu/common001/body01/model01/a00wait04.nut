@@ -0,0 +1,36 @@
+-1 bone 1.0
+anim bone
+vertex = frame frame
+material
+1.0
+texture texture frame
+-1 material
+0.500000 vertex 1.0 bone 0.500000 0.500000 anim 1.0
+texture 1.0 material texture
+0.500000 vertex
+anim 1.0 frame bone bone 1.0 anim
+texture
+bone = material 1.0
+texture 1.0 bone vertex texture anim frame material
+anim texture
+1.0 texture frame 1.0 texture anim 1.0
+vertex material bone frame
+bone texture vertex 1.0 -1
+= frame =
+1.0 0.500000 bone material = material
+1.0
+-1 0.500000 vertex material anim bone vertex bone
+material texture
+1.0 0.500000 texture material
+1.0 bone vertex 0.500000 = texture
+-1 1.0 vertex 1.0
+1.0 0.500000 bone vertex bone 1.0 -1
+vertex
+material -1 frame vertex texture
+bone bone frame
+material texture = 0.500000 anim vertex =
+1.0
+texture frame
+material texture
+=
+0.500000 
\ No newline at end of file
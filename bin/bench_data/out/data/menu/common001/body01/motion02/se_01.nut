@@ -0,0 +1,4 @@
+-1 vertex material anim
+frame
+vertex
+frame anim anim
\ No newline at end of file
@@ -0,0 +1,99 @@
+-1
+material anim
+anim
+texture anim 0.500000 0.500000
+0.500000 =
+bone =
+0.500000 anim
+bone bone 0.500000 -1 texture 0.500000 frame vertex anim vertex bone = frame frame
+frame 0.500000 0.500000 bone
+texture material
+material 0.500000
+texture frame
+bone frame
+frame =
+anim anim bone
+texture material anim texture
+frame =
+-1 frame 1.0
+bone
+0.500000
+vertex -1 anim 1.0 = vertex 0.500000 -1
+= 1.0 0.500000 -1
+1.0 texture frame
+texture 0.500000 0.500000 = 0.500000 -1 0.500000 frame material vertex
+frame
+1.0 0.500000 = = texture vertex 1.0 vertex 1.0 0.500000 vertex
+material vertex vertex vertex frame -1 -1 bone 0.500000 1.0
+-1 frame texture -1 texture
+= vertex frame frame
+frame 1.0 texture
+0.500000
+material texture 0.500000
+texture
+anim
+anim
+vertex = = material -1 -1 texture -1 1.0 material texture frame material
+=
+=
+texture material = frame
+frame =
+1.0
+0.500000
+vertex =
+bone texture material texture material bone texture frame
+0.500000 1.0
+-1 = bone -1 frame 0.500000
+bone texture
+-1 frame texture 0.500000 =
+0.500000 0.500000 -1 material -1 anim texture vertex
+material
+1.0 = 0.500000 0.500000 1.0 material bone 1.0
+= anim bone =
+bone vertex anim bone anim frame 1.0 texture -1 anim anim 1.0 0.500000 -1
+material 1.0 material 1.0 -1 material vertex -1 1.0
+= 1.0
+0.500000
+1.0 texture 0.500000 anim 1.0
+1.0 1.0
+0.500000 frame 1.0 material
+texture = frame vertex 1.0 0.500000 frame texture
+anim
+texture material -1 bone -1
+-1
+texture
+frame 0.500000
+material bone bone
+bone
+material bone
+0.500000 vertex -1
+-1 bone
+bone frame bone material frame -1
+frame =
+-1
+anim texture
+-1 texture
+material bone anim 1.0
+anim 0.500000 material material 1.0
+material vertex material frame 0.500000 frame bone 1.0
+0.500000 vertex
+vertex texture
+frame vertex anim
+-1 1.0 bone 0.500000 anim material
+material
+bone = bone vertex
+-1 material bone bone -1 frame vertex frame 1.0 texture material frame anim = material vertex 0.500000
+vertex texture 0.500000
+1.0 0.500000
+frame texture
+1.0
+bone frame vertex bone = anim vertex material
+frame
+anim
+texture material 0.500000 frame frame
+1.0 0.500000 0.500000 1.0 0.500000
+bone -1 bone 1.0
+1.0
+anim
+frame
+= material 1.0 0.500000 frame mate
\ No newline at end of file
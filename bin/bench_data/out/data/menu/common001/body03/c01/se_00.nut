@@ -0,0 +1,110 @@
+vertex 1.0
+vertex
+frame texture 0.500000 bone anim anim anim material
+material
+0.500000 1.0 anim frame 1.0 -1
+material texture vertex =
+0.500000 material 1.0 anim
+1.0 bone
+0.500000 material anim anim
+texture vertex
+=
+-1 =
+texture
+-1
+bone 0.500000
+bone vertex
+texture
+0.500000 anim
+texture anim = vertex vertex vertex
+0.500000 =
+texture frame
+material frame
+0.500000
+= 0.500000 -1 material vertex 0.500000
+1.0 = material 1.0 vertex bone frame 1.0
+material -1 1.0 texture =
+material
+vertex
+= material texture = 1.0
+texture frame anim material anim bone
+frame -1 frame anim frame frame
+0.500000 anim texture material = frame 0.500000 0.500000 -1
+-1 frame texture vertex bone material frame vertex 1.0 anim anim vertex = 0.500000 vertex =
+texture = anim frame
+anim -1
+frame vertex frame
+frame vertex texture
+material 0.500000
+0.500000
+-1 material texture = -1 = texture 1.0 0.500000 bone texture
+-1 material bone anim vertex bone 1.0 frame 1.0 vertex
+vertex 0.500000 -1 bone material 1.0 0.500000 texture anim = bone texture
+material material bone material 0.500000 = 1.0 -1
+vertex material -1 1.0 frame bone texture frame = 1.0
+= =
+-1 material
+1.0 material 0.500000
+texture anim = anim 0.500000 anim vertex
+-1 1.0
+= bone 1.0 =
+1.0 0.500000 vertex texture
+1.0 material texture -1 anim 1.0 1.0 frame texture vertex bone texture -1 anim 1.0 = bone bone bone 0.500000
+1.0 0.500000
+frame 1.0 1.0 1.0 = frame -1 texture = bone 1.0 1.0 bone
+texture
+bone material 1.0 frame =
+bone =
+material = 0.500000
+1.0 vertex texture -1 texture 1.0
+= 1.0
+0.500000
+-1 1.0 anim frame bone vertex -1 0.500000 vertex bone
+= =
+vertex vertex 1.0
+1.0
+1.0 frame -1 bone
+=
+frame -1 1.0 frame
+0.500000 1.0
+frame material vertex
+1.0
+bone
+-1 anim bone
+-1 = anim anim material 0.500000 vertex -1 anim texture vertex =
+material vertex frame
+vertex texture
+1.0 vertex 0.500000
+bone 0.500000
+bone vertex vertex bone
+anim = bone vertex -1 = material
+bone -1 -1 1.0 0.500000 bone
+vertex frame bone 1.0
+1.0 0.500000 bone bone -1 1.0
+bone
+0.500000 =
+0.500000 -1 frame anim -1 vertex vertex -1 anim = 0.500000 vertex
+texture frame anim 0.500000 texture
+anim -1 texture = anim 1.0 bone
+0.500000 vertex 1.0
+vertex
+frame
+1.0 bone
+material 0.500000 = 0.500000 = 0.500000 texture = frame
+material = frame = bone 1.0
+vertex 1.0 0.500000 vertex
+bone anim anim
+0.500000 vertex texture bone anim -1 material
+vertex vertex -1 0.500000 -1 1.0 frame 0.500000 material frame -1 -1 bone = vertex anim = -1
+0.500000
+-1 material -1 =
+= material anim 1.0 vertex 0.500000 = material 0.500000 bone anim
+-1
+bone texture frame frame -1 bone = frame 0.500000 anim material frame
+frame texture vertex anim
+=
+1.0 0.500000 frame bone
+vertex
+texture 1.0 = texture -1
+1.0 -1 0.500000
+1.0 material
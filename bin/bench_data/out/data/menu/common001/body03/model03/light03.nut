@@ -0,0 +1,5 @@
+anim 1.0 texture bone vertex
+1.0
+1.0 frame material
+0.500000
+0
\ No newline at end of file
@@ -0,0 +1,283 @@
+frame texture -1 anim 1.0 texture anim
+-1 vertex material bone -1 bone
+vertex frame texture
+material texture = material texture 1.0 texture = material
+1.0 = frame = 0.500000
+vertex anim bone -1 anim bone material -1 texture
+1.0
+0.500000 material material 1.0
+texture = 1.0 vertex anim 0.500000
+vertex -1 = frame
+anim material = = = -1 bone
+= 0.500000
+bone anim =
+-1 1.0 1.0 vertex anim anim = material
+bone frame
+texture -1 anim =
+1.0 bone =
+bone texture frame vertex anim = texture
+1.0 1.0 vertex
+texture vertex vertex = 1.0 bone material anim
+=
+material 0.500000 0.500000 texture
+0.500000
+frame vertex vertex = = -1 0.500000 anim =
+anim 0.500000 =
+material anim vertex
+texture frame -1 vertex -1
+-1 anim
+bone frame frame bone 0.500000 0.500000 anim 0.500000
+frame anim = -1
+texture bone material vertex
+material bone 1.0 frame -1 bone
+texture frame
+texture 0.500000 0.500000 anim = = frame 0.500000 vertex 0.500000 = frame
+= bone = vertex 0.500000
+bone
+anim bone
+texture
+1.0 vertex vertex texture frame material
+-1 material 0.500000 anim -1 material vertex
+vertex 0.500000 texture
+1.0 1.0 texture
+texture bone -1 1.0
+material material texture
+=
+-1
+0.500000 anim vertex
+=
+frame anim 0.500000
+1.0 -1 material frame =
+texture texture 1.0 vertex
+texture
+texture = vertex
+anim vertex
+material
+vertex
+1.0 frame material
+texture anim
+1.0 0.500000 material -1
+= 0.500000 texture
+frame frame 1.0 vertex
+vertex
+anim
+-1 texture texture frame
+material vertex bone -1 anim -1
+material
+anim bone = -1
+anim texture frame -1 texture
+vertex material -1
+0.500000 bone bone frame
+0.500000
+1.0 material anim
+frame
+material bone texture material vertex texture
+0.500000 material anim -1 anim 1.0 texture frame = -1 1.0 texture =
+0.500000 vertex bone 1.0 texture
+= bone -1 -1 bone -1 texture 1.0 1.0 -1
+frame texture bone frame
+= frame bone = bone 0.500000 anim
+= texture vertex bone = material
+texture bone material -1 vertex =
+vertex frame
+= vertex texture 1.0 frame
+0.500000 0.500000 anim -1 bone
+1.0 0.500000 material texture vertex 0.500000 texture bone frame
+vertex = 1.0 = 1.0 anim vertex anim material bone 1.0 = 0.500000 -1 vertex 1.0 texture 1.0 anim
+= frame texture
+1.0 1.0 0.500000
+bone 0.500000
+anim 0.500000 texture = =
+vertex
+anim = 0.500000 texture
+frame
+vertex
+bone texture =
+anim =
+1.0
+1.0
+0.500000 0.500000 1.0 texture
+anim vertex anim vertex anim 1.0 anim material bone
+texture
+=
+= 0.500000 bone anim vertex 0.500000
+texture 1.0 material bone
+frame 1.0
+-1 anim
+anim
+1.0
+material
+= material anim = 0.500000 material = frame =
+0.500000 material texture frame 1.0 material -1 0.500000 anim =
+-1 material anim material anim
+= texture
+texture vertex vertex
+anim
+bone texture bone material = texture
+1.0
+1.0 0.500000
+= anim 0.500000 0.500000
+material material material anim
+vertex
+frame 0.500000 bone 1.0
+0.500000
+frame -1
+texture bone bone bone texture 1.0 = frame
+frame = material anim frame -1 -1 vertex
+1.0 frame
+material material 1.0
+bone anim
+1.0 anim
+bone vertex anim anim 1.0
+-1 bone texture vertex = 1.0
+texture = material 1.0 0.500000 vertex 0.500000 1.0 bone
+frame
+frame = texture 1.0 0.500000 0.500000 bone
+= vertex frame anim bone
+1.0 1.0 vertex 0.500000 texture -1 0.500000 0.500000 bone texture
+= 0.500000 1.0 vertex vertex vertex 0.500000 =
+vertex frame =
+0.500000 -1
+anim
+anim -1 anim
+-1 anim 1.0
+frame anim anim frame = 1.0 = anim anim bone anim anim anim = texture bone
+texture = anim material material
+frame vertex
+1.0 0.500000 = = bone bone -1 texture bone
+vertex anim frame
+bone 1.0 texture material
+anim texture 1.0 bone bone vertex bone texture -1 bone = 0.500000 bone -1
+0.500000 anim 0.500000 = 0.500000 0.500000 -1 0.500000 material -1 anim texture
+material
+= material -1
+material material 0.500000 anim
+1.0
+anim bone vertex 1.0
+-1 frame frame
+1.0 anim anim vertex
+1.0
+1.0 bone anim -1
+material bone
+vertex 0.500000 frame -1 anim frame
+texture bone material -1
+material
+material 0.500000 texture
+bone material
+-1 -1 -1 texture
+vertex
+bone bone anim
+anim 1.0 0.500000 =
+vertex material
+1.0 frame
+material vertex vertex 1.0 vertex bone anim vertex anim texture
+vertex material
+material frame -1 bone
+=
+material 0.500000 0.500000 texture 0.500000 anim 1.0 material
+frame texture anim 1.0 anim texture material
+= 1.0 -1 frame
+0.500000 frame frame
+bone material material material 0.500000 frame
+material 0.500000 1.0 frame
+vertex
+texture anim bone 0.500000 -1 frame = anim
+-1 0.500000 1.0 bone vertex texture texture texture vertex
+texture
+anim texture bone
+= 1.0
+1.0 bone
+frame material bone = -1
+1.0
+=
+= -1 bone
+texture = material material 0.500000
+anim vertex anim
+-1 frame =
+material =
+texture bone =
+material
+bone
+material vertex 1.0 vertex bone frame -1
+texture = 1.0 frame 1.0 = vertex 0.500000
+bone
+1.0
+bone bone bone
+bone frame texture
+-1
+= -1 anim
+vertex texture anim = 0.500000 vertex
+1.0
+vertex
+texture frame 0.500000 -1 frame -1
+0.500000 0.500000 bone 1.0 = anim texture bone
+frame = 0.500000 vertex bone
+material = bone bone vertex material -1 frame 1.0 1.0
+-1 1.0
+= material 1.0 frame
+-1 texture anim
+= -1 texture
+= bone
+anim
+0.500000 1.0 0.500000 anim
+bone texture material
+1.0 vertex anim -1 frame
+texture = material vertex material material bone =
+1.0 anim material
+-1 1.0
+anim 1.0 0.500000 frame -1 material
+anim
+vertex =
+texture anim vertex
+texture material -1
+1.0 -1
+bone vertex = material
+-1 bone material material = material anim frame texture vertex
+anim texture frame anim bone material bone = 0.500000 material
+= = bone anim =
+frame
+texture 1.0 material 1.0 material frame vertex texture material
+0.500000
+vertex material material 1.0 frame frame -1
+= 0.500000
+= -1
+frame 1.0 0.500000 -1 0.500000 texture anim frame texture 1.0 texture 1.0 frame material -1 material
+0.500000 anim material anim =
+frame material = bone -1 bone -1 anim = 1.0 1.0 material material
+anim
+= frame material -1 1.0
+texture anim
+texture
+=
+texture anim
+0.500000
+= 1.0 -1 frame anim
+0.500000 0.500000
+-1 material
+vertex 1.0
+bone bone
+frame material
+anim 0.500000 vertex 0.500000 =
+1.0 -1 1.0
+0.500000 1.0 anim bone
+1.0 -1 0.500000 = texture 1.0 -1 anim
+1.0 vertex 0.500000 vertex = = material texture
+0.500000 anim -1
+-1 vertex = 0.500000
+= anim vertex = vertex -1 material
+vertex
+material vertex bone material texture
+0.500000 -1 1.0
+frame vertex
+= bone frame material = material =
+texture 0.500000 1.0 = 1.0 material texture anim
+=
+bone texture bone 1.0 bone anim
+= 0.500000 -1 bone
+vertex
+1.0 -1 0.500000 material texture
+texture -1 texture bone bone 0.500000 vertex -1 =
+1.0 texture texture
+bone = anim bone bone 1.0 texture -1
+frame = frame vertex frame frame
+= material
\ No newline at end of file
@@ -0,0 +1,258 @@
+=
+= 0.500000 vertex anim frame texture 1.0 vertex bone 0.500000 = -1
+texture bone texture material bone = 0.500000 frame -1
+texture bone vertex bone material vertex -1
+material 0.500000 texture
+vertex texture
+1.0 texture = -1 bone anim = frame
+-1
+1.0
+0.500000
+anim anim 1.0 = 0.500000 vertex anim material material vertex frame 0.500000 material 1.0 0.500000 -1 =
+material 0.500000 material
+bone 1.0 bone bone frame
+0.500000
+= 0.500000 bone -1 bone = texture
+1.0 anim 0.500000 = bone frame bone
+material
+1.0 vertex frame material -1
+1.0
+material frame
+anim = anim 1.0 -1 texture 0.500000 0.500000 material
+anim = 1.0 anim
+material
+vertex
+bone texture frame = 0.500000 vertex vertex
+bone
+texture frame -1 bone = = frame -1 material frame frame anim bone material 0.500000 0.500000 1.0
+frame -1 anim 1.0 = 0.500000 material 0.500000 = 0.500000 frame
+0.500000 1.0 bone frame 0.500000 anim = 1.0 = frame
+frame
+texture
+frame bone
+-1
+vertex anim material 1.0 anim
+bone
+vertex
+texture
+material anim
+=
+-1 texture -1 frame vertex
+vertex frame material
+vertex -1 1.0 frame
+material frame 0.500000 1.0 material anim material
+0.500000 material 1.0 vertex 0.500000 frame bone 1.0 texture 0.500000
+-1 frame -1 texture
+texture
+anim 0.500000
+material frame = frame
+1.0 bone anim frame -1
+anim -1 0.500000 -1 1.0 anim 0.500000
+frame 1.0 vertex 0.500000 1.0
+=
+-1 = bone material = -1
+frame texture anim frame -1 -1 0.500000 1.0
+vertex
+bone
+anim bone 1.0 bone vertex 0.500000 0.500000 vertex bone 1.0 vertex vertex 0.500000 material material vertex = 1.0 anim material vertex vertex material
+bone texture material texture bone anim bone 0.500000 texture
+anim
+frame material vertex frame
+anim frame
+material
+vertex bone vertex 0.500000 1.0
+frame 0.500000 frame vertex anim
+vertex material frame bone
+bone
+0.500000
+texture texture -1 texture 1.0 anim
+= frame bone frame
+0.500000 texture -1 vertex frame 0.500000 0.500000 -1 frame
+material -1 material 1.0 anim vertex -1 bone 1.0 material
+-1
+bone
+texture
+= material bone texture bone texture
+1.0
+anim 1.0 1.0 = frame frame
+vertex
+bone frame 1.0 bone -1 anim texture bone vertex anim
+frame frame bone vertex texture -1 anim 1.0 bone
+texture
+bone bone 0.500000 1.0 0.500000
+0.500000 = anim 1.0 1.0
+material frame
+frame frame
+vertex
+-1 material anim bone
+-1 -1 = bone
+material
+= material
+vertex
+= material texture vertex =
+material 0.500000 anim
+=
+frame texture 0.500000 material
+-1 1.0 vertex
+texture texture -1
+bone = -1 vertex 0.500000 1.0 =
+1.0 texture material
+0.500000 0.500000 vertex
+= texture anim
+bone -1 -1 texture 0.500000 frame anim bone texture frame texture material material frame
+1.0 bone
+bone 0.500000 vertex vertex =
+1.0 vertex vertex vertex anim
+texture 0.500000
+1.0 = 1.0 bone frame 1.0 -1 1.0 material frame 0.500000 texture 1.0
+vertex anim
+0.500000 material
+-1 anim
+-1 bone 0.500000
+= -1 1.0
+frame material vertex -1 frame
+-1 1.0 -1
+0.500000 0.500000
+bone = material frame 0.500000 0.500000 bone 1.0 1.0
+frame
+0.500000
+anim material -1 frame bone
+0.500000 -1 material material
+material 1.0
+1.0 1.0
+-1 vertex material -1
+texture material -1
+anim -1
+material anim
+1.0 vertex = vertex
+= 1.0 0.500000 = 0.500000 material
+bone texture anim texture anim 1.0 vertex 1.0 bone
+bone =
+-1
+material
+material 0.500000 frame texture frame = 1.0 -1
+texture 1.0 frame =
+frame texture anim material material
+material = 0.500000 texture 0.500000 material =
+texture material material = vertex 1.0 frame bone 1.0 bone frame 1.0 anim 1.0
+vertex
+=
+frame frame vertex
+-1 1.0 frame
+bone frame -1 1.0 0.500000 anim -1 0.500000 material anim frame bone vertex
+material 1.0 bone
+vertex texture -1 frame
+vertex 0.500000
+vertex
+frame vertex -1
+texture -1
+-1 material =
+frame anim
+anim = 1.0
+-1
+material
+texture 0.500000 bone -1 =
+bone -1
+1.0 =
+anim bone bone =
+-1 0.500000
+-1 0.500000 vertex = vertex
+frame -1 anim 1.0
+anim 1.0 1.0 0.500000
+frame frame frame frame material
+0.500000
+texture
+anim
+=
+1.0 -1
+bone 1.0 anim material texture bone -1 bone -1 = 0.500000 1.0 -1
+1.0 1.0 material -1 anim = -1 texture bone 1.0 texture material anim
+frame 0.500000 frame = bone
+vertex 0.500000 vertex -1 0.500000 1.0 vertex texture vertex
+= material material
+1.0 1.0 -1
+0.500000 = 0.500000 vertex vertex
+bone material material bone 1.0 anim material
+1.0 texture
+anim = texture =
+frame
+vertex
+material
+bone
+material
+-1 = vertex
+-1 anim -1 0.500000 1.0 frame
+1.0
+= anim
+-1 frame
+anim
+0.500000 0.500000 frame
+0.500000 frame texture frame -1
+=
+anim
+-1 material
+1.0 texture texture anim
+0.500000 = bone =
+frame 0.500000 -1 bone
+vertex 1.0 anim vertex -1
+1.0 -1 =
+frame
+vertex anim
+texture material vertex =
+vertex frame 0.500000 bone material
+frame texture bone anim 1.0 anim bone 0.500000
+texture frame
+texture
+texture
+texture vertex vertex
+-1
+0.500000 bone material
+-1 = 0.500000 anim
+vertex bone anim vertex texture =
+=
+texture 1.0 =
+-1 -1 anim frame anim bone
+vertex 1.0
+0.500000 -1 = anim 0.500000 vertex =
+bone anim -1 -1 texture
+frame material -1 material anim
+= frame -1
+1.0
+frame
+=
+anim vertex
+texture -1 0.500000 1.0
+bone
+texture
+0.500000 material texture anim
+= material 0.500000 bone
+material vertex bone 1.0
+0.500000 anim
+vertex -1 1.0 -1 1.0 = bone
+texture 1.0 frame
+texture material anim anim
+vertex anim
+0.500000 0.500000 1.0 1.0 frame -1 texture
+texture vertex material frame 1.0
+texture = bone texture bone
+0.500000 frame frame
+1.0
+texture texture vertex vertex
+texture 1.0
+= texture = frame
+material = = =
+1.0 anim
+material
+= frame anim
+1.0 vertex -1 1.0 =
+frame material anim
+anim =
+material =
+frame material anim anim bone
+0.500000
+= 0.500000 = 0.500000 anim 0.500000 bone bone
+= texture material
+material
+vertex texture bone anim texture bone 0.500000
+vertex
+texture 0.500000 mat
\ No newline at end of file
@@ -0,0 +1,27 @@
+= frame
+0.500000 anim =
+1.0 = vertex -1
+vertex
+material
+0.500000 -1 frame frame 1.0 anim texture -1 0.500000 1.0 0.500000 =
+frame texture
+texture -1 material 0.500000 bone = material anim bone = vertex frame -1 vertex
+vertex -1 1.0
+vertex -1 texture vertex texture 1.0
+-1 bone 1.0 material 1.0 bone
+anim frame 0.500000 material texture = anim texture material
+vertex vertex
+vertex anim texture
+vertex
+= texture texture = frame bone frame 0.500000
+bone
+material -1 = 0.500000 texture texture frame texture
+material material 1.0 =
+material 1.0
+bone material 1.0 =
+1.0 bone
+0.500000 -1 -1
+-1 0.500000 1.0 1.0 vertex anim bone material
+vertex frame vertex
+anim
+0.500000 frame texture fra
\ No newline at end of file
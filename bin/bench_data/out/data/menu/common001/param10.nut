@@ -0,0 +1,19 @@
+bone
+1.0 vertex
+bone anim material
+= bone -1 anim 1.0 vertex bone
+texture
+1.0 1.0 material anim bone texture 1.0 -1 =
+vertex 0.500000 texture bone texture
+= 1.0
+material
+frame vertex frame
+bone 0.500000 1.0 0.500000 anim bone
+1.0 bone
+bone vertex
+0.500000 bone frame frame
+material 1.0 -1 bone
+frame material -1 bone -1 texture
+anim -1
+1.0 bone material vertex 0.500000 texture frame
+fram
\ No newline at end of file
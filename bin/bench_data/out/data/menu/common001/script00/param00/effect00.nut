@@ -0,0 +1,275 @@
+0.500000 vertex 1.0 material texture texture
+bone vertex
+frame = =
+texture frame vertex = texture texture vertex
+frame vertex -1 bone
+bone anim bone frame -1 material frame -1
+1.0 material -1 frame
+texture = 1.0
+0.500000
+bone
+0.500000 material 0.500000 1.0 frame 0.500000 vertex 0.500000 bone
+0.500000 = frame material
+anim
+=
+frame frame 1.0 0.500000 vertex texture texture 0.500000 0.500000 -1 material
+= =
+bone = bone
+1.0
+1.0
+anim texture anim
+material frame
+vertex bone 0.500000
+texture anim frame frame anim
+material
+material
+=
+vertex 1.0 0.500000 frame vertex vertex material vertex
+bone vertex vertex = vertex = -1 anim 0.500000 1.0
+1.0 frame
+0.500000 = material frame
+texture =
+0.500000 texture 0.500000 frame frame 0.500000 = texture =
+1.0 vertex -1 texture texture 1.0 1.0 anim material -1
+material anim material material material
+frame
+bone = = 0.500000 0.500000 vertex 0.500000
+0.500000 anim 1.0
+material 0.500000
+vertex frame
+-1 bone
+0.500000
+-1 frame 0.500000 material -1 0.500000
+-1
+-1 0.500000 =
+0.500000 1.0 vertex
+material material -1
+-1
+= bone bone -1
+0.500000
+-1 vertex -1 0.500000 frame 0.500000
+= material -1 0.500000 texture
+-1 anim bone
+1.0 1.0
+texture vertex anim frame -1 anim -1 1.0 = 0.500000
+vertex -1 material
+-1 0.500000 texture -1
+frame =
+anim material vertex = = frame -1
+texture anim
+-1
+-1 -1
+frame
+-1 -1
+frame 0.500000 frame bone texture
+bone 1.0
+= 1.0
+=
+material -1 material vertex vertex material -1 0.500000 0.500000
+frame
+0.500000 frame material = vertex
+vertex anim
+material bone bone =
+0.500000 material bone 0.500000 texture
+vertex 0.500000 bone -1 vertex anim bone
+texture 0.500000 anim 1.0 material
+= -1 bone
+1.0
+frame texture bone
+anim
+0.500000
+-1 frame 0.500000
+texture = texture bone frame 1.0 = material anim anim texture
+1.0 bone material
+anim -1 =
+texture 0.500000 bone anim material
+0.500000
+bone frame material -1 vertex
+bone vertex material texture vertex vertex
+1.0 bone 0.500000 texture 0.500000 1.0
+texture
+0.500000
+=
+-1 1.0 anim material
+frame = = vertex texture
+vertex anim
+=
+texture bone
+-1 1.0 1.0 0.500000 vertex
+1.0
+frame 1.0 material texture
+0.500000 frame
+anim
+frame
+anim
+1.0 1.0
+material
+material
+-1 anim
+0.500000 -1 0.500000 frame anim bone -1 bone texture bone 0.500000 texture
+0.500000 frame vertex =
+-1
+-1 = = material -1 vertex 0.500000 1.0
+material material -1 = bone material frame bone vertex 0.500000 vertex frame
+anim -1
+= vertex texture =
+bone vertex anim anim vertex vertex material texture 0.500000 frame
+=
+1.0
+bone frame
+anim
+0.500000 frame frame 0.500000
+frame = bone anim 0.500000 vertex frame bone =
+texture
+frame 0.500000 0.500000
+0.500000 anim -1
+frame material
+anim 0.500000
+anim vertex vertex frame frame -1
+-1 =
+bone texture
+= = vertex frame
+anim texture
+bone material
+0.500000 anim material 0.500000 0.500000 -1 texture
+=
+material
+material texture =
+material frame anim -1 anim frame material bone = vertex
+1.0
+1.0 -1 anim texture 0.500000 0.500000 1.0 vertex = =
+=
+0.500000 = bone frame bone 0.500000
+= 1.0
+vertex
+vertex anim
+texture material
+= bone material 0.500000 -1 anim -1
+vertex vertex = 0.500000
+1.0
+anim anim 1.0 vertex texture texture
+0.500000
+0.500000
+vertex texture =
+vertex frame anim =
+1.0 bone
+anim material = material 0.500000 anim -1 texture
+texture bone 0.500000 material -1 texture frame texture anim material = = vertex 1.0 texture = frame 0.500000 -1 texture
+anim anim texture 0.500000 vertex
+texture anim
+texture texture anim frame material material texture
+= 1.0 bone
+texture -1 vertex 1.0 material
+= = bone 0.500000 = texture
+1.0 = material texture bone bone = frame = vertex frame
+1.0 0.500000 frame =
+bone
+= frame
+anim material frame frame
+material
+= 0.500000
+vertex frame 1.0 texture 0.500000 vertex frame 0.500000 material -1 bone bone 0.500000 frame texture vertex texture vertex = material frame texture vertex 0.500000
+vertex anim anim 1.0 = 0.500000 frame
+=
+0.500000
+frame -1
+bone
+=
+0.500000 texture -1 -1
+0.500000 -1 material
+material =
+material vertex 0.500000 vertex -1 0.500000 1.0 0.500000 0.500000 anim material = anim 0.500000 vertex
+= texture
+vertex material
+vertex = bone
+frame material =
+1.0 texture
+1.0 texture -1 =
+material bone anim 0.500000 0.500000 0.500000 material frame
+-1 anim material frame texture anim frame -1 0.500000 material texture vertex 1.0 bone
+bone 0.500000
+= vertex
+bone anim anim -1 1.0 = anim
+material anim 1.0 frame
+vertex texture material
+anim material
+texture frame bone 0.500000 1.0 texture
+bone anim bone anim
+bone 1.0
+0.500000 frame
+1.0 -1
+0.500000
+frame vertex vertex 0.500000 1.0 =
+material
+anim = 0.500000 bone texture 1.0 vertex -1 texture
+vertex -1
+1.0
+vertex
+texture 0.500000 1.0 material 1.0
+material material 0.500000
+0.500000 material 1.0
+anim
+vertex
+0.500000 = -1 anim vertex -1 0.500000
+1.0 texture bone vertex material material 1.0 bone material = texture bone -1
+texture texture 1.0
+1.0 bone 0.500000 material texture material bone
+frame
+bone material
+vertex texture = bone = bone
+0.500000 = vertex texture frame 1.0 frame
+anim 0.500000 = -1
+material =
+1.0
+material -1 material bone bone bone 1.0
+bone
+-1 material
+1.0 material = 0.500000 bone
+vertex texture bone texture texture bone vertex
+1.0 = frame = anim vertex
+-1 texture bone material texture 1.0 -1
+frame 1.0
+bone =
+=
+texture
+material texture 0.500000 material texture texture 0.500000 material -1 anim texture 0.500000 frame =
+anim =
+texture
+vertex = frame 1.0 anim = vertex frame frame bone
+bone = frame vertex = 0.500000 texture material -1 texture material material
+vertex 0.500000
+frame material = anim =
+bone anim
+-1 anim bone
+anim vertex anim
+bone 0.500000
+bone vertex -1
+frame 1.0
+1.0 texture 0.500000 1.0 1.0 1.0 vertex
+1.0 material 1.0 -1 frame
+vertex 0.500000 -1
+material material
+vertex
+texture vertex = vertex bone -1 vertex texture
+0.500000 -1 = 1.0 = material anim
+frame
+-1 frame 0.500000 vertex 0.500000 material
+texture anim texture bone =
+material vertex anim frame vertex
+-1
+-1 vertex material
+=
+texture
+-1 0.500000 vertex 1.0 1.0 =
+=
+-1 -1 frame -1 frame = bone
+1.0
+bone =
+anim 0.500000 material -1 vertex -1
+texture
+frame anim anim 0.500000 texture texture 1.0 -1 -1 anim vertex
+-1 0.500000 1.0 bone vertex frame material 0.500000
+material
+anim anim frame
+0.500000 = material anim
+vertex mat
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex texture
+frame texture material -1
+vertex
+0.50
\ No newline at end of file
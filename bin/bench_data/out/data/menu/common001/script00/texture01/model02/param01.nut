@@ -0,0 +1,4 @@
+frame -1
+texture vertex texture
+texture frame
+1.0 material anim vertex bone material anim = texture vertex 0.50000
\ No newline at end of file
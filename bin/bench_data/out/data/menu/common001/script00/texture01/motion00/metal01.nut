@@ -0,0 +1,23 @@
+texture texture vertex 1.0 = texture
+anim bone 0.500000 bone vertex vertex anim -1
+= texture -1 bone material bone
+0.500000 frame texture
+texture
+1.0 = anim
+frame
+vertex material anim anim 0.500000 =
+1.0 frame 1.0 =
+vertex
+texture frame material material = material
+texture = vertex
+0.500000
+texture texture material = texture 1.0 bone 0.500000 =
+0.500000 vertex vertex 0.500000 -1 anim 1.0 bone bone anim vertex
+vertex material
+bone texture anim texture 0.500000 1.0 1.0
+frame -1 = vertex
+vertex
+bone
+anim
+1.0 texture
+anim frame
\ No newline at end of file
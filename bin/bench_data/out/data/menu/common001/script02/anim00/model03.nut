@@ -0,0 +1,331 @@
+0.500000 0.500000 1.0
+anim 0.500000
+material
+anim 0.500000 anim frame -1
+-1 = bone
+1.0 0.500000 texture
+-1
+material bone vertex texture
+frame -1 texture
+material texture frame -1 frame anim 1.0 material 0.500000
+vertex =
+material frame = texture
+-1
+texture
+vertex -1 = anim
+bone
+material
+anim 0.500000
+=
+1.0 vertex anim anim texture
+frame
+0.500000
+0.500000 -1
+material material frame material texture
+0.500000
+material
+= anim bone
+-1 0.500000 1.0 vertex bone -1 0.500000
+1.0 =
+material material
+-1 bone
+bone
+0.500000 1.0
+= material vertex frame material vertex bone bone = anim
+1.0 anim
+bone
+= 0.500000 vertex = texture vertex = frame = bone frame
+bone anim
+vertex frame material frame bone
+frame 1.0
+1.0 0.500000 = = 1.0 0.500000 frame 1.0 vertex 1.0 vertex =
+-1 1.0 =
+-1
+bone = 1.0
+= = material
+1.0 anim frame anim frame frame 1.0 1.0 frame bone 1.0 =
+material
+anim bone 1.0 0.500000 vertex frame 0.500000 frame 1.0 bone
+material texture = anim
+0.500000 anim vertex texture 0.500000
+bone texture
+0.500000 anim anim material = material
+0.500000 vertex
+1.0
+-1
+bone frame vertex 1.0
+= 1.0
+1.0 0.500000 anim = = texture material vertex material
+anim =
+frame texture material = material -1
+bone anim vertex texture texture bone material 0.500000
+material = anim texture
+0.500000 anim 1.0 anim 1.0 frame 0.500000 0.500000
+vertex
+bone texture bone 0.500000
+material
+-1 texture bone =
+0.500000 bone material = 1.0
+-1 texture texture frame -1 anim frame
+material bone -1 frame material
+0.500000 material
+bone 0.500000 -1 frame -1 material texture
+anim frame anim
+= = 1.0 =
+anim frame anim frame anim vertex material
+frame
+vertex = = anim anim texture bone
+material material
+material 1.0 frame vertex
+0.500000 frame
+texture vertex bone bone
+material material = frame
+= frame 1.0 -1 1.0 frame anim anim 1.0 anim
+vertex
+frame -1 vertex anim frame anim texture 0.500000 material texture
+material bone
+material
+anim frame
+frame = texture = bone 1.0 0.500000 -1
+vertex
+-1 material
+= texture 0.500000
+0.500000
+bone
+= 0.500000 0.500000 texture -1 1.0 -1 =
+bone frame texture
+bone
+texture 0.500000 texture 1.0 -1 bone
+frame -1 anim 0.500000 texture = vertex -1
+bone 1.0 texture 0.500000
+bone frame
+-1 anim
+material material
+material 1.0 1.0 vertex -1
+frame
+1.0 frame
+bone = vertex
+bone vertex
+vertex anim anim 1.0 =
+texture
+anim vertex
+texture 1.0 material
+1.0 frame anim
+1.0
+-1 1.0 material
+bone = texture
+frame texture anim texture
+0.500000 0.500000 1.0 material 1.0 anim material vertex
+0.500000
+anim frame
+0.500000
+material anim
+anim = material bone -1 -1 vertex 0.500000 frame
+= frame
+texture anim =
+anim anim material vertex anim material anim
+= bone bone 0.500000
+0.500000 =
+1.0 1.0
+0.500000 1.0 frame 0.500000 1.0 -1 = anim frame vertex
+0.500000 vertex
+material vertex anim material
+1.0
+1.0 -1
+1.0
+frame texture
+bone 0.500000 -1 = material material texture anim frame
+texture -1
+anim 0.500000 anim -1 texture frame
+= texture
+= = bone
+1.0 1.0
+-1
+-1 1.0
+=
+material = = anim 0.500000 = 1.0 -1 1.0 -1
+0.500000
+0.500000
+texture anim
+texture texture texture 1.0 texture material bone -1
+material
+anim
+-1
+frame vertex = texture
+material vertex 0.500000 material
+material = material vertex
+frame -1 = bone
+bone
+0.500000
+= 0.500000
+anim 0.500000
+-1 anim material 0.500000 material 0.500000 =
+-1
+material vertex
+texture
+vertex frame frame 0.500000 1.0 0.500000 1.0 anim frame = anim 1.0
+frame
+-1 frame -1 texture material bone
+frame texture anim
+-1
+material vertex bone
+frame
+-1 vertex
+1.0
+bone frame texture texture
+-1
+bone -1 bone -1 =
+texture 0.500000 0.500000
+-1 = anim material
+anim anim vertex anim bone = = vertex anim vertex bone 1.0
+anim -1 texture
+vertex 0.500000 0.500000 bone vertex -1 material =
+anim
+anim anim = 0.500000 anim 0.500000 bone 1.0
+frame
+frame vertex bone
+= anim frame
+material 0.500000 0.500000
+0.500000 vertex
+texture
+anim
+=
+vertex
+vertex
+material anim bone 0.500000 anim
+anim 1.0
+vertex = -1
+= 0.500000 = vertex
+anim texture frame anim
+= material anim
+1.0 frame texture frame 0.500000 texture 1.0 1.0 =
+0.500000 bone anim
+texture material vertex
+anim
+anim material
+0.500000 texture = bone
+anim
+-1 frame anim anim anim vertex material -1 texture 1.0 frame
+texture 1.0 anim texture =
+=
+0.500000 vertex = anim 0.500000 = -1 bone
+texture 0.500000 frame 1.0 1.0 -1 vertex
+vertex texture 0.500000 0.500000 = frame
+1.0 bone vertex
+bone frame vertex frame = anim frame -1 texture
+texture vertex
+anim frame anim material = 1.0 anim
+1.0
+vertex 0.500000
+vertex texture 1.0 vertex
+texture frame
+texture frame -1 bone vertex bone
+texture 0.500000 1.0 frame bone vertex = 1.0 0.500000 1.0 bone material = 1.0 texture 0.500000
+1.0
+vertex
+1.0
+anim
+material
+0.500000
+1.0 0.500000
+material
+anim texture texture frame
+vertex anim -1 texture material vertex material vertex
+1.0 0.500000
+1.0 frame 0.500000 1.0 0.500000 texture frame -1 1.0 1.0 material
+vertex 0.500000
+0.500000 frame texture bone
+= vertex
+1.0 0.500000 frame anim bone vertex 1.0 frame vertex bone texture 1.0 0.500000 texture frame texture
+= frame
+texture 0.500000 -1
+-1 material
+=
+0.500000 frame = 0.500000 -1 anim bone =
+1.0 vertex = anim 0.500000 frame
+vertex texture bone material texture material vertex vertex texture
+frame
+bone -1
+texture
+material
+texture anim material material 0.500000 material = frame -1 frame anim frame vertex vertex frame 1.0 1.0 0.500000
+texture
+bone anim texture
+0.500000 material
+texture
+vertex
+material
+-1 1.0 -1 texture = anim bone = vertex = frame -1 = frame vertex texture vertex texture
+=
+frame 1.0
+-1
+bone bone -1 1.0 frame
+1.0 material
+0.500000 -1 0.500000 texture anim bone material 1.0 0.500000 1.0 -1 1.0 frame = -1
+bone vertex
+texture = texture
+texture
+anim 0.500000
+frame texture 0.500000 material
+bone
+bone vertex bone anim 1.0 = texture
+= material 1.0 0.500000 1.0 0.500000 anim
+-1 1.0 vertex anim = vertex
+1.0
+vertex vertex
+= = 0.500000 1.0 = vertex
+1.0 vertex material
+vertex
+anim
+= vertex 0.500000 0.500000
+= vertex 0.500000 material 1.0 0.500000 material = 0.500000 bone vertex texture texture texture
+material texture texture
+material = = =
+= vertex vertex 0.500000 vertex
+bone =
+vertex vertex texture texture
+frame material vertex 1.0 material = texture vertex
+frame
+0.500000 texture = bone -1 -1 anim frame anim
+-1 texture anim texture vertex 0.500000
+frame
+= 0.500000
+bone = = 1.0 anim frame 1.0 frame
+1.0 texture anim
+bone material anim material vertex texture bone texture 0.500000 0.500000 anim 0.500000 0.500000 vertex =
+0.500000 1.0 bone texture -1 vertex bone
+frame frame -1 1.0 1.0
+vertex
+0.500000
+bone bone frame
+0.500000 frame texture 1.0 texture texture
+bone bone -1 1.0 material texture bone frame 0.500000
+texture 1.0 frame =
+bone material -1
+vertex = bone material frame = texture 0.500000 0.500000
+0.500000 -1
+frame
+anim = = 0.500000 material texture
+-1 vertex vertex 1.0 vertex bone anim frame material frame
+= frame 0.500000 anim texture
+texture anim vertex -1 material 1.0
+frame 0.500000
+0.500000
+texture
+1.0
+texture
+1.0 = =
+material frame
+frame anim anim 0.500000
+bone
+-1
+bone
+frame material = =
+= -1
+vertex 0.500000 0.500000 bone 1.0 frame
+0.500000 0.500000 0.500000 -1 frame
+material vertex
+1.0
+anim texture
+1.0 vertex anim -1
+bone 
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 texture = 1.0
+material
+vertex 1.0 0.500000 material ver
\ No newline at end of file
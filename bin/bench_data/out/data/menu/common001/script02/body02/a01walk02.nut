@@ -0,0 +1,5 @@
+1.0 vertex anim
+-1 -1 anim anim material
+1.0 anim vertex
+material
+frame -1 frame = = ve
\ No newline at end of file
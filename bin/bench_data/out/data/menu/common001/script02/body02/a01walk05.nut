@@ -0,0 +1,3 @@
+-1 1.0 = texture material texture
+1.0
+texture texture 0.500000 vertex bone 1.
\ No newline at end of file
@@ -0,0 +1 @@
+8A!aI]wMnCxu#T
\ No newline at end of file
@@ -0,0 +1,11 @@
+0.500000 anim texture 1.0 texture 1.0 frame 0.500000
+anim
+texture = 0.500000 frame texture texture frame
+vertex
+frame
+-1 frame anim vertex
+texture -1 texture frame
+bone 1.0 texture =
+vertex material 1.0
+frame
+anim frame -1 ma
\ No newline at end of file
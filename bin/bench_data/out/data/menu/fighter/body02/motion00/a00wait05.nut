@@ -0,0 +1,18 @@
+anim frame anim vertex = =
+texture texture 0.500000 1.0
+-1 1.0 texture
+texture -1 -1 texture material -1 bone vertex anim
+-1 texture vertex vertex texture texture frame 0.500000 vertex texture material
+texture texture frame
+texture 1.0 1.0
+frame material 0.500000
+frame 0.500000
+anim texture
+0.500000 bone 0.500000 0.500000
+anim material 1.0 bone texture
+= anim -1
+material bone anim 0.500000 anim bone
+vertex -1 bone
+1.0 anim vertex
+-1 bone -1
+-1 ver
\ No newline at end of file
@@ -0,0 +1,36 @@
+bone 1.0 vertex
+-1 bone vertex bone texture
+-1 1.0 1.0 anim 1.0 0.500000
+material
+frame
+vertex
+material anim vertex texture =
+-1 texture -1 1.0
+= = 1.0 texture 0.500000
+0.500000 bone material anim
+vertex material
+anim bone 0.500000 1.0 vertex
+anim texture -1
+-1 -1 -1 material bone 1.0 frame 1.0
+frame -1 -1 0.500000 frame = 1.0 material = frame texture material vertex 1.0
+-1 0.500000 bone 1.0 =
+anim
+= = vertex frame
+anim anim bone anim material anim anim anim anim =
+anim texture frame 0.500000 bone material 1.0 1.0
+-1 = 0.500000 0.500000 =
+1.0 bone
+0.500000
+1.0 =
+bone = 1.0
+anim texture frame material
+texture material bone bone
+texture
+vertex frame material texture
+1.0 -1 = 1.0 anim -1 1.0 anim texture bone anim
+0.500000 1.0
+0.500000 vertex 1.0 texture
+frame texture
+1.0 material bone 1.0 = vertex texture bone 1.0 texture anim frame bone vertex frame texture = 0.500000
+-1 -1
+= bone 0.500000 texture texture vertex texture frame frame tex
\ No newline at end of file
@@ -0,0 +1,89 @@
+= bone =
+1.0
+vertex
+= = = -1 -1
+bone anim
+0.500000
+0.500000 frame
+bone vertex
+anim
+0.500000 1.0
+0.500000 bone
+anim 0.500000 vertex bone
+-1 frame frame material
+-1 anim material vertex = 0.500000 material texture vertex 1.0
+material anim = anim
+-1 -1 0.500000 texture -1 vertex vertex vertex
+bone material 0.500000
+-1 0.500000
+vertex anim
+bone vertex frame 0.500000
+bone = 0.500000 0.500000 texture = -1
+material material anim 0.500000 anim
+-1
+0.500000 material = vertex
+-1 -1 anim vertex 0.500000
+frame
+anim 1.0
+bone material anim
+vertex
+vertex -1 bone vertex = frame
+anim = 0.500000 1.0
+0.500000 = anim bone 0.500000 frame 1.0 material vertex
+texture anim frame frame 0.500000 material
+1.0
+bone
+-1 = material 1.0 texture vertex 1.0
+texture anim frame
+= texture frame bone vertex
+= anim vertex 0.500000 1.0
+0.500000
+anim 0.500000
+= anim 0.500000 = 1.0 bone texture
+bone 1.0 -1 material bone 1.0 frame bone texture
+bone texture anim -1 vertex
+=
+-1 anim
+= =
+bone
+= -1
+-1 =
+material texture anim anim frame -1 texture bone frame bone texture
+-1
+material
+1.0 = 0.500000 texture
+1.0 -1 bone 1.0 texture vertex vertex
+-1 material anim texture material texture
+0.500000 0.500000
+0.500000
+vertex frame
+=
+anim
+material
+-1 = -1 frame material
+texture 1.0 -1 = 1.0 0.500000 vertex 1.0 = = vertex material frame
+bone
+anim material bone
+anim material texture 1.0
+1.0 = 1.0 -1 0.500000 texture 1.0 anim material 0.500000 =
+0.500000
+= anim anim frame texture 0.500000 frame 1.0 0.500000 1.0 bone 1.0 bone 0.500000 bone material
+-1
+0.500000 1.0 -1 -1 frame
+anim material frame =
+material bone material texture frame bone 0.500000 texture frame anim 1.0 texture 0.500000 material bone 1.0 anim 0.500000 anim
+material
+texture =
+texture
+vertex vertex
+1.0 -1 anim = material material 1.0 frame
+material -1 bone material vertex
+-1 texture
+material texture 0.500000
+vertex
+1.0 anim material = -1 vertex material
+texture anim bone
+0.500000 vertex
+0.500000 anim
+material -1 1.0 -1 -1 vertex
+frame 0.5
\ No newline at end of file
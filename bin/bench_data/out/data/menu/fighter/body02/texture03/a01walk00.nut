@@ -0,0 +1,4 @@
+0.500000
+-1 texture bone vertex 1.0 1.0 anim bone
+= texture = anim -1 vertex -1 material
+material -1 material bone 1.0 = 0.500000 an
\ No newline at end of file
@@ -0,0 +1,5 @@
+texture
+-1 vertex frame 1.0 frame
+texture anim texture bone
+anim 1.0
+1.0 material 0.500000
\ No newline at end of file
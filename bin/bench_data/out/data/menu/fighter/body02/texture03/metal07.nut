@@ -0,0 +1,59 @@
+1.0 material anim 0.500000 bone =
+-1
+material material 0.500000 anim material vertex vertex vertex 1.0
+1.0
+anim
+bone anim texture
+bone material = =
+1.0 bone
+bone 0.500000 =
+vertex
+anim
+1.0 texture
+0.500000 1.0 bone
+1.0
+vertex bone bone 0.500000 0.500000
+bone frame 0.500000 vertex
+= 0.500000
+texture anim bone frame frame bone frame
+0.500000
+1.0
+vertex
+material
+frame -1 texture anim = = bone
+material
+-1 bone = vertex material anim material
+texture bone vertex anim vertex
+1.0 1.0
+bone bone
+bone -1 frame
+1.0 = vertex 1.0 bone
+0.500000 vertex -1 0.500000 vertex anim bone -1 texture
+0.500000 = anim texture 0.500000 -1 vertex bone
+texture 1.0 1.0
+=
+bone 0.500000 1.0 material 0.500000 material material bone
+vertex 1.0 -1
+anim bone
+anim -1 = = material 0.500000 bone = anim texture frame
+1.0 material
+material
+bone
+material vertex -1 material -1
+bone 1.0
+vertex -1 1.0
+0.500000 =
+= vertex bone
+= bone 0.500000 material bone
+frame material 1.0 anim bone
+material = = texture texture
+texture texture frame material vertex texture
+texture anim -1 frame
+material = = -1 texture
+frame bone
+vertex -1
+1.0
+frame anim 1.0 frame anim frame 1.0 bone vertex bone
+1.0
+texture 0.500000 frame
+0.500000 anim vertex vertex textur
\ No newline at end of file
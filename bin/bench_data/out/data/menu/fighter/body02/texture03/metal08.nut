@@ -0,0 +1,9 @@
+0.500000 bone frame bone bone
+1.0 0.500000
+bone =
+texture material anim material -1
+material frame bone vertex -1 texture texture -1 0.500000
+material
+material 1.0 texture = vertex
+anim =
+frame 0.500000 0.500000 -1 1.0 = anim anim 0.500000 0.500000 fr
\ No newline at end of file
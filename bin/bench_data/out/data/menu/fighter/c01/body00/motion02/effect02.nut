@@ -0,0 +1,6 @@
+texture 1.0
+= = 1.0
+texture
+anim anim
+= = frame 1.0 vertex
+vertex 0.500000 
\ No newline at end of file
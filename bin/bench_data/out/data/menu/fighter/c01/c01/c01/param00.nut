@@ -0,0 +1,45 @@
+= 1.0 frame
+0.500000
+material
+frame 1.0 -1
+1.0 vertex
+1.0 1.0 1.0 vertex frame = texture 1.0 material frame material anim texture material
+anim
+anim texture
+anim
+vertex 1.0 texture = vertex 1.0 frame
+-1 vertex -1 frame bone anim 1.0
+frame 1.0
+anim = vertex 0.500000 = 0.500000
+bone 0.500000
+texture
+1.0 anim
+0.500000 1.0 material anim
+-1
+1.0 0.500000 1.0 -1 = anim
+vertex 0.500000 anim texture bone frame texture
+texture -1 frame vertex 1.0 vertex texture vertex
+material
+= =
+frame anim 0.500000 bone vertex
+anim -1 = 1.0 texture bone anim vertex vertex 1.0 1.0
+frame 1.0 material material
+frame material
+texture vertex -1
+anim 1.0 = texture anim material
+0.500000 1.0
+bone 0.500000 0.500000 texture bone 0.500000
+=
+vertex bone anim
+vertex material texture 0.500000
+vertex 1.0 1.0
+vertex 1.0
+1.0
+1.0 vertex
+1.0 anim anim =
+= = frame = vertex -1 -1 1.0 bone vertex bone 0.500000 frame bone =
+1.0 =
+anim vertex -1
+material anim texture 0.500000 bone material = -1 frame -1 texture bone texture bone
+0.500000
+m
\ No newline at end of file
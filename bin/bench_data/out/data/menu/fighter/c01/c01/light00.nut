@@ -0,0 +1,6 @@
+0.500000 -1 bone bone = texture texture 0.500000 =
+texture material texture anim
+material = vertex bone 0.500000
+= bone
+texture
+0.500000 frame vertex 0.500000 0.500000
\ No newline at end of file
@@ -0,0 +1,58 @@
+material vertex
+0.500000
+material material 1.0
+0.500000 =
+-1 = bone material
+bone vertex 1.0 anim
+-1 texture anim material 1.0 frame bone -1 1.0 vertex texture material bone frame -1 bone -1 texture texture 0.500000 0.500000 -1 -1 vertex material frame 0.500000
+frame
+-1 1.0
+material texture anim anim = bone bone
+material bone -1 = anim =
+bone
+texture
+0.500000
+-1 = 0.500000 -1 1.0 anim
+vertex 0.500000
+0.500000 -1 bone anim
+= = 0.500000 frame frame frame material anim 0.500000
+0.500000 bone anim texture texture frame 0.500000
+texture 0.500000 frame frame anim material material vertex
+vertex 1.0 -1 0.500000 1.0 1.0 material
+vertex = = vertex -1 vertex texture 1.0 = anim anim -1 material
+anim
+vertex 1.0
+material -1 bone
+= -1
+= material 0.500000 material
+frame
+anim
+= = vertex
+anim frame 1.0 0.500000
+0.500000 -1
+vertex
+vertex 1.0 frame -1 anim -1 bone -1 frame -1 texture material
+material
+-1 bone frame
+= -1
+texture 0.500000 anim 0.500000 0.500000 frame = anim texture -1 bone bone bone material = =
+texture
+0.500000
+texture anim 1.0 vertex
+vertex material
+= -1
+anim 1.0 0.500000 0.500000 -1 anim -1 texture anim
+vertex 1.0 1.0
+frame
+vertex material
+anim
+material bone = anim frame =
+frame -1
+1.0
+-1 texture bone =
+material anim texture
+vertex -1 bone
+1.0 frame texture
+0.500000 anim bone texture frame material 0.500000 anim
+1.0 material
+material
\ No newline at end of file
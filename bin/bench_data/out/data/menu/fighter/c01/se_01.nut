@@ -0,0 +1,8 @@
+vertex
+texture 0.500000 -1 1.0
+=
+0.500000 vertex frame 0.500000
+0.500000
+frame material
+= anim -1 1.0 -1 bone
+texture anim texture texture
\ No newline at end of file
@@ -0,0 +1,27 @@
+vertex vertex
+texture 1.0 frame bone bone = material texture vertex texture
+texture material 0.500000 frame
+bone 1.0
+vertex material 1.0 material
+0.500000 -1
+anim bone vertex =
+-1 -1 texture anim vertex bone -1 frame bone
+vertex frame anim 0.500000 vertex
+vertex vertex 0.500000 frame =
+material
+anim vertex 1.0 0.500000 1.0 = 1.0 bone frame texture 1.0 material
+texture 1.0
+material -1 anim 0.500000
+material = = 1.0 anim anim bone -1
+-1
+vertex = frame 0.500000 bone
+0.500000 vertex 0.500000 texture
+anim anim texture vertex anim
+= -1 0.500000 texture vertex texture bone = anim bone
+= texture 1.0
+= -1 frame 1.0 anim bone
+0.500000 = material
+0.500000
+vertex
+bone
+vertex bone anim = bone -1 bone 1.0
\ No newline at end of file
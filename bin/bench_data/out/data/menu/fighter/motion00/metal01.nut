@@ -0,0 +1,3 @@
+-1 texture texture 0.500000
+anim -1 1.0
+1.0 bone 0.50000
\ No newline at end of file
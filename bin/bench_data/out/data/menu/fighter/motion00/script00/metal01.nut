@@ -0,0 +1,6 @@
+0.500000 anim -1 anim material bone 1.0 frame
+vertex 1.0
+= vertex
+= = 1.0
+-1 = material
+frame material mat
\ No newline at end of file
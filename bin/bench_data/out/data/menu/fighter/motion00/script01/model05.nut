@@ -0,0 +1,3 @@
+material anim material bone texture 1.0 =
+material anim material bone
+-1 -1
\ No newline at end of file
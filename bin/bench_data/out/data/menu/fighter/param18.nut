@@ -0,0 +1,48 @@
+material = material material
+anim anim
+1.0 -1
+material texture frame -1
+= 1.0 1.0 = 0.500000
+0.500000 frame anim material =
+texture 1.0 -1 vertex texture anim material
+frame anim
+-1
+-1 0.500000
+= vertex
+0.500000 -1 bone
+0.500000 bone =
+frame vertex vertex
+= material material vertex vertex 1.0 texture = frame
+material
+material
+-1 1.0 -1 anim bone anim
+-1
+frame
+vertex vertex vertex 1.0 frame
+= anim -1 0.500000 =
+texture 0.500000 anim
+vertex
+material = 0.500000
+1.0 texture texture = texture vertex
+texture frame material anim anim texture bone texture
+1.0 texture anim -1
+texture bone = 0.500000
+material frame anim 0.500000
+bone bone
+material vertex anim bone =
+0.500000
+material
+0.500000 texture material texture
+frame vertex
+1.0 -1 -1
+material
+0.500000 -1 1.0 vertex = = frame texture bone texture 1.0 vertex frame
+frame texture
+1.0
+vertex bone material
+1.0 -1 = anim texture material frame
+anim vertex frame 1.0 bone frame
+vertex = anim bone material
+material anim frame bone vertex material frame 0.500000
+anim
+material = material vertex material vertex
\ No newline at end of file
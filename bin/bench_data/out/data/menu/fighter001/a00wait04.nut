@@ -0,0 +1,5 @@
+0.500000
+anim vertex material =
+1.0
+0.500000
+anim
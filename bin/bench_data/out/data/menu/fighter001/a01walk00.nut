@@ -0,0 +1,311 @@
+anim
+material frame = =
+= 0.500000 texture 0.500000 -1 bone anim texture =
+texture anim -1 material texture 1.0 = material 1.0 1.0 bone vertex = material -1 anim 0.500000 0.500000
+material material -1 material anim texture
+bone -1 1.0 =
+-1
+vertex material 1.0 material vertex frame -1 texture material bone frame anim -1
+1.0
+-1 vertex bone
+1.0
+1.0
+bone -1
+bone 1.0
+vertex
+= texture bone 1.0 bone 1.0 anim = vertex anim texture anim frame vertex =
+= -1 vertex vertex 0.500000 vertex =
+texture 1.0 1.0 bone 1.0 frame texture material frame 1.0 0.500000 frame
+bone bone 0.500000 -1 = bone bone texture material anim = frame material bone 0.500000 = vertex 1.0 vertex material vertex 1.0
+anim frame -1
+anim
+1.0 1.0 bone 0.500000 texture
+vertex 1.0 bone frame material -1
+frame 1.0 1.0
+frame
+bone 1.0
+material texture material texture texture 0.500000 frame
+vertex bone material frame material texture frame texture vertex = -1 = bone = anim
+anim material -1 -1 vertex material
+anim vertex anim anim material
+vertex
+material
+anim texture bone bone -1 frame frame texture
+texture vertex texture
+material texture
+material
+-1 0.500000 anim = -1
+0.500000 vertex material
+vertex 0.500000 vertex = 0.500000 material 0.500000 =
+bone bone 0.500000 bone = material frame material 0.500000 anim material bone frame
+anim 0.500000 anim texture frame 0.500000 texture 0.500000 frame = anim vertex 0.500000 -1
+bone
+= 1.0 1.0 bone vertex = texture
+vertex 1.0 0.500000 frame vertex 1.0 texture frame
+0.500000 0.500000 0.500000 anim = = vertex
+= texture = texture = texture anim
+vertex = material
+anim material = = vertex material 1.0
+bone bone 0.500000 frame -1 texture -1 frame
+vertex bone texture vertex
+-1 vertex anim frame 0.500000 -1
+texture material 0.500000 anim vertex 0.500000 bone material material
+vertex
+material texture
+frame 1.0 texture frame material
+frame
+0.500000 0.500000 = material texture bone frame
+vertex bone vertex anim frame 0.500000 vertex
+bone anim 1.0 anim bone -1 =
+=
+1.0 = frame anim texture material 0.500000 bone vertex bone
+bone
+= material frame
+bone 1.0 -1 anim texture material 1.0 =
+frame 0.500000 frame texture vertex 1.0 -1 frame -1 anim texture 0.500000 bone
+material -1 anim anim vertex anim
+-1 -1 material texture
+vertex
+anim frame anim 0.500000 bone frame -1
+material = material material material 1.0 frame 0.500000 material
+= material = -1 vertex frame = material 1.0 0.500000 = 1.0 -1 vertex = texture frame frame 1.0 material material bone =
+frame
+1.0 frame
+frame frame 1.0
+vertex = vertex vertex -1 0.500000 anim vertex anim
+anim frame material
+anim texture frame
+texture 0.500000 0.500000 -1 texture
+texture texture
+anim = anim
+= 0.500000
+0.500000
+frame 0.500000 bone
+1.0 anim frame anim -1 -1
+frame bone
+1.0 0.500000 -1 bone texture = frame frame 0.500000 frame frame texture -1 1.0
+vertex
+= texture
+material bone
+material texture vertex = texture vertex anim texture
+frame vertex -1 -1 bone 0.500000 material
+anim = frame texture
+0.500000
+vertex material vertex
+= =
+vertex 1.0 -1 frame texture texture -1 material bone
+-1 = frame
+-1 bone -1 1.0 = material bone = material -1
+1.0 anim
+texture 0.500000 1.0 texture frame vertex -1 1.0 bone = = material = frame
+bone = = texture -1 bone frame = 0.500000
+1.0 1.0 -1 frame
+bone 1.0
+-1 vertex material
+vertex bone
+anim -1
+-1 frame
+-1 material vertex = 1.0 bone
+vertex
+texture
+texture
+1.0 0.500000 bone material vertex -1
+-1 texture
+texture = = texture 1.0 anim bone vertex -1 material 0.500000 texture
+texture vertex anim vertex texture frame 1.0
+texture 0.500000
+vertex 1.0 0.500000 1.0 frame vertex texture frame -1 1.0 -1 1.0 0.500000 bone texture
+vertex
+texture material =
+= 1.0 1.0 vertex texture = -1
+1.0 material texture
+0.500000 bone material = = frame frame bone vertex anim
+0.500000 -1 texture vertex
+= vertex anim
+frame
+frame anim -1 material frame frame frame bone vertex material
+material 1.0 -1 material texture 0.500000 bone vertex vertex
+texture -1 bone 0.500000 1.0 frame anim bone -1 vertex frame bone vertex vertex frame = vertex frame
+vertex = vertex material
+anim
+1.0 -1 material bone
+anim texture anim bone vertex frame bone
+= -1 anim anim
+1.0 bone anim -1
+bone 1.0
+-1 vertex
+bone 0.500000
+= 1.0 texture anim frame vertex bone -1 = 1.0 -1 material -1 material = bone frame
+0.500000 -1 0.500000 texture frame =
+vertex 1.0 = vertex -1 -1 1.0 = = texture material material material anim 1.0 = 1.0 1.0
+texture texture 1.0 material frame 0.500000 -1
+-1 0.500000 frame
+material vertex frame texture anim
+texture texture texture 1.0 -1
+anim
+0.500000 -1 = frame
+texture
+= frame material
+anim vertex material 0.500000 vertex -1
+bone 0.500000 = texture 1.0 frame material -1 1.0 -1 vertex material
+0.500000 vertex frame
+frame material anim
+anim 1.0 0.500000 -1 = bone -1 anim vertex
+-1 = -1 material
+frame = bone anim
+vertex 1.0 material
+-1
+= 0.500000
+material vertex texture bone frame anim -1 bone 1.0 frame frame 1.0 anim
+1.0 -1 frame = vertex -1
+0.500000 = = material vertex vertex -1 material 0.500000
+frame anim material frame vertex vertex anim = -1 1.0 =
+0.500000 0.500000 material
+frame vertex frame bone anim texture
+0.500000
+material
+= material texture bone vertex vertex 1.0 = material -1
+material bone
+vertex
+anim
+material bone 1.0 1.0
+bone bone 1.0 0.500000 material
+0.500000 texture
+=
+1.0 texture vertex
+1.0
+= frame = material material material bone material anim 1.0 material vertex vertex -1 -1
+frame 0.500000 1.0 1.0 anim
+material
+bone
+-1 texture = frame
+-1 -1
+vertex
+frame =
+anim vertex -1
+material bone texture 0.500000 material frame bone -1
+1.0 texture
+anim 1.0
+vertex -1 bone bone anim frame
+= bone bone 0.500000 anim
+=
+bone
+1.0
+texture =
+0.500000 0.500000 vertex = -1 vertex -1 texture -1 1.0 frame vertex
+vertex material
+texture bone anim
+-1
+vertex
+frame
+= anim frame vertex frame anim =
+texture bone -1
+frame 1.0 bone 0.500000 -1 anim
+material 0.500000
+-1 frame 0.500000 = material vertex texture texture vertex vertex bone frame
+= 1.0 -1 texture -1
+1.0 anim frame frame frame
+0.500000 anim 0.500000 material = 1.0
+-1 anim material 0.500000 bone
+frame vertex vertex material 0.500000 material bone -1 material texture 1.0 vertex anim
+= -1
+material anim -1 material texture bone frame -1 0.500000
+0.500000 1.0 frame
+1.0 = material = texture
+bone texture
+anim
+anim texture
+anim -1
+bone 0.500000
+anim 1.0 0.500000 = anim = frame material -1 1.0 -1 vertex
+-1 texture bone anim material -1
+bone material
+texture
+0.500000
+anim
+1.0 vertex
+frame frame 0.500000 1.0 1.0
+frame 0.500000 1.0 -1 vertex texture
+1.0 = texture bone -1 = vertex frame =
+0.500000 =
+1.0
+texture material =
+vertex vertex vertex bone frame vertex -1 frame material bone -1
+1.0 0.500000
+anim 0.500000
+=
+texture 1.0 texture 1.0
+frame anim
+0.500000
+=
+frame frame anim anim
+frame
+bone 1.0 material anim
+anim texture texture
+frame texture -1 -1 texture
+0.500000
+1.0 -1 anim
+bone bone anim = = anim 0.500000 texture =
+= = -1
+= vertex
+vertex 1.0 -1
+0.500000 = frame texture bone 0.500000 = bone 1.0 bone vertex
+material material 1.0
+=
+vertex
+=
+= anim
+material bone 1.0 frame 0.500000 material
+anim bone anim material vertex 0.500000 vertex material
+bone frame bone
+anim
+material 0.500000 0.500000 1.0
+material anim -1
+-1 material -1
+= texture
+anim
+bone frame = material anim texture frame
+1.0 frame
+frame 0.500000 = material
+bone
+-1 anim material material frame
+frame
+vertex
+vertex
+material material texture frame
+material
+-1 = texture anim -1 anim
+vertex vertex
+vertex
+material 1.0
+bone anim =
+0.500000 material = texture
+frame
+texture vertex anim anim 1.0 0.500000 bone
+= frame material material
+=
+-1 0.500000 material = anim bone
+vertex
+material
+0.500000
+1.0 -1 vertex 0.500000 1.0
+=
+= =
+frame frame
+1.0 frame anim
+anim
+anim vertex
+-1 =
+vertex
+frame texture anim material
+1.0 material frame
+1.0
+frame vertex = 0.500000 texture vertex
+frame -1 0.500000
+bone material vertex anim
+= anim texture frame -1 anim texture frame -1 -1 0.500000 texture -1
+texture bone 0.500000 bone material -1 texture
+0.500000 =
+anim = bone bone vertex
+= vertex
+1.0 0.500000 vertex texture material
\ No newline at end of file
@@ -0,0 +1,154 @@
+texture 0.500000 texture = texture = -1 frame 1.0 frame anim texture
+=
+=
+0.500000 material anim = 0.500000 = material -1 material material -1 -1 =
+0.500000 = anim
+bone vertex 1.0 frame vertex 1.0
+1.0 0.500000
+anim texture material
+material frame frame
+= anim = vertex -1 anim anim vertex = vertex = texture anim material material 0.500000 frame material material material = 1.0
+0.500000 vertex
+0.500000
+material
+-1 anim
+= vertex
+1.0
+-1 0.500000 0.500000 bone frame
+= anim 1.0
+frame frame bone -1
+frame material texture
+frame 1.0 material 0.500000 material texture
+material vertex
+0.500000 0.500000 1.0 material
+bone vertex material = frame anim
+texture 1.0
+1.0 1.0
+vertex
+frame 1.0 anim = 1.0 1.0
+1.0 texture vertex frame
+vertex
+material
+0.500000
+bone -1 bone
+texture = texture 1.0 = frame
+anim vertex
+texture 1.0 =
+vertex 1.0 material
+-1 vertex frame
+anim material vertex frame
+1.0
+0.500000 vertex -1 0.500000 -1
+anim -1 anim 0.500000 0.500000 -1 anim vertex material
+anim texture = -1 = vertex
+anim frame material -1 =
+material -1
+0.500000 vertex = bone -1 texture 1.0 bone =
+= bone
+1.0
+0.500000 anim vertex = material -1 -1 vertex material
+bone material texture 0.500000
+frame frame
+-1
+material -1 0.500000 anim frame anim texture = bone
+1.0 0.500000 bone
+texture vertex
+material bone texture frame 0.500000
+-1
+material
+= vertex bone
+= frame 0.500000 vertex
+frame texture
+frame bone texture material -1 bone 0.500000 vertex bone frame 1.0 1.0 bone
+1.0 0.500000 vertex texture
+bone
+0.500000 1.0 bone frame 0.500000 texture 0.500000
+-1
+frame
+anim
+1.0 anim
+0.500000
+= vertex =
+0.500000 frame material -1
+0.500000
+anim frame anim 0.500000 vertex =
+anim vertex vertex 1.0 material material
+texture frame 1.0 -1 texture anim 0.500000 vertex 1.0 frame 1.0 frame -1
+bone vertex texture frame vertex
+anim frame texture anim
+frame
+= anim frame 1.0 frame 0.500000 -1 vertex texture bone
+material 0.500000 0.500000 0.500000 vertex
+-1
+vertex 1.0 1.0 -1 frame texture 0.500000 frame frame bone anim texture texture
+material -1 0.500000 -1 bone
+frame material
+material material
+0.500000 bone material bone 0.500000 0.500000 -1 frame vertex
+= texture =
+1.0 frame 1.0 1.0 0.500000 vertex anim
+1.0 vertex bone = 1.0
+1.0 =
+texture = -1 material bone -1 0.500000 texture 1.0 1.0 frame bone vertex anim 1.0
+1.0 texture bone vertex
+texture 1.0 material -1
+anim -1 1.0 =
+vertex -1 texture anim bone = frame texture anim texture = anim 1.0 vertex
+0.500000
+bone anim
+vertex material 0.500000 material texture = texture 1.0 0.500000 material = texture
+frame 1.0 frame material anim bone vertex -1
+texture 0.500000 texture anim texture
+1.0 0.500000 -1 0.500000 frame
+vertex 0.500000
+= 0.500000 material vertex bone
+0.500000 anim
+0.500000 texture 0.500000 vertex anim vertex vertex frame
+0.500000 material
+anim material 0.500000 bone material
+1.0 texture
+0.500000 vertex 0.500000 anim frame 1.0
+1.0 0.500000 frame frame
+0.500000 -1 bone frame
+vertex -1 -1 bone
+anim bone 0.500000
+material
+material
+texture material
+anim 1.0 texture
+1.0 -1 0.500000
+0.500000
+frame = material
+bone frame texture
+1.0 material
+material bone
+anim
+= -1 material texture texture -1
+anim texture
+-1
+0.500000
+bone texture 1.0 = material anim
+=
+0.500000 = = frame
+-1 material texture 1.0 =
+texture
+material anim 0.500000 anim anim = material texture anim bone 0.500000 bone = 0.500000 frame bone 1.0 =
+-1 frame = -1 texture
+1.0 material 0.500000 -1
+frame -1
+texture 1.0
+material bone material
+frame
+= texture = frame 0.500000 material
+=
+vertex
+anim
+frame
+anim
+anim bone -1 anim
+0.500000 material anim
+bone frame anim -1
+1.0
+= vertex -1 = -1 0.500000 material 1.0 -1 texture frame bone texture 1.0 = anim 0.500000 0.500000
+vertex material 1.0 material vertex texture
+0.500000
\ No newline at end of file
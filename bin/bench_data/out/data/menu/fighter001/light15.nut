@@ -0,0 +1,8 @@
+vertex 0.500000 frame frame frame
+anim anim bone texture texture 0.500000
+=
+texture anim frame anim 0.500000
+1.0 bone anim
+=
+anim frame frame anim anim material -1 anim material texture 0.500000 -1
+1.0 texture
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame frame 1.0 anim -1 -1 vertex = vertex frame
+anim bone
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim texture texture 1.0 texture 0.500000
+texture material -1 anim 0.500000 0.500000 0.5000
\ No newline at end of file
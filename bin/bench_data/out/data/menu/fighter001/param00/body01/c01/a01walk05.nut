@@ -0,0 +1,7 @@
+vertex 1.0 material material anim
+=
+anim material bone
+0.500000
+= texture frame anim frame frame bone = bone = frame
+material bone frame bone
+anim textu
\ No newline at end of file
@@ -0,0 +1,260 @@
+frame texture = material texture
+anim
+material -1 material -1
+bone anim
+1.0 = texture 0.500000 anim material material texture texture texture -1
+-1 frame frame vertex 0.500000
+anim
+bone 1.0 frame bone bone frame
+material texture 0.500000
+-1 material texture 1.0 anim frame material 1.0 0.500000 1.0 material anim frame 1.0 = vertex
+material -1 vertex texture 0.500000
+=
+-1 vertex
+=
+1.0 anim frame vertex 0.500000
+frame anim -1 -1 material frame anim
+texture
+material =
+-1 texture
+frame texture
+anim
+= material = material
+vertex frame
+bone = vertex frame
+-1 = texture anim texture bone material
+material = 1.0 bone 0.500000
+material bone frame
+vertex
+= 0.500000
+1.0 =
+-1 texture 1.0 =
+vertex 1.0
+= anim
+material frame frame bone bone
+vertex
+texture
+-1 texture anim
+-1
+1.0
+anim -1
+frame
+material bone anim vertex 1.0 anim frame
+material -1 frame bone anim 1.0 frame -1 texture material bone
+vertex
+anim material
+-1 1.0 texture texture -1 = anim 0.500000 frame 0.500000 anim material frame
+material vertex
+anim
+1.0 vertex
+vertex
+bone 0.500000
+vertex
+-1 bone
+frame
+texture
+material -1 texture vertex material
+1.0
+frame material material 0.500000
+= material
+vertex texture 1.0 1.0 vertex
+frame 0.500000
+frame anim 0.500000 -1 frame
+anim 0.500000
+vertex 1.0 =
+= anim material material
+-1 bone texture
+vertex material bone = vertex -1
+anim
+anim -1
+vertex = 0.500000
+texture material vertex frame
+-1 -1 anim -1 1.0 vertex anim
+texture vertex
+anim material
+= frame vertex -1 texture =
+material
+vertex vertex material 1.0 texture 1.0 frame bone bone texture vertex
+anim texture frame 0.500000 -1 1.0
+anim = =
+vertex bone 1.0
+-1 -1 anim = anim 1.0 = 0.500000 1.0 -1 1.0 = bone anim frame anim = -1 vertex -1 = 0.500000 -1 texture = vertex material 1.0
+-1 texture 0.500000 frame
+vertex texture frame
+bone = -1 vertex
+= texture
+texture
+vertex
+material
+0.500000
+texture frame
+0.500000 frame bone -1
+= material anim anim
+anim 1.0
+1.0 0.500000 bone anim bone vertex vertex bone texture vertex frame bone material 1.0 = material 1.0
+= 1.0
+vertex
+frame material texture 0.500000 material material
+1.0 vertex 1.0 vertex texture
+anim frame
+texture -1
+0.500000
+1.0
+1.0 anim
+frame
+texture material texture bone
+material -1
+0.500000 material material = frame texture material
+-1
+anim material bone vertex
+texture bone anim vertex = -1 material bone vertex
+-1 1.0
+bone
+0.500000 vertex 1.0
+material vertex
+vertex 0.500000 0.500000 frame
+-1 = 1.0 vertex texture
+material
+= vertex bone = bone
+anim vertex material
+frame 0.500000 bone 0.500000
+= bone bone =
+frame bone 1.0
+bone 0.500000
+frame anim material 1.0 0.500000 -1 material
+frame material -1 anim anim frame texture 0.500000 material
+material 0.500000 material frame bone
+material vertex
+texture texture material
+texture texture 1.0 material -1 = frame
+frame = anim
+material texture vertex
+texture
+material 0.500000
+bone
+texture bone frame -1 vertex material frame
+1.0 = anim vertex frame frame anim =
+texture bone texture material material texture anim 0.500000
+1.0 texture bone frame anim vertex frame anim = 1.0
+1.0 bone bone -1 1.0 bone 0.500000 1.0
+anim
+1.0 material frame material
+0.500000
+1.0 material vertex material bone 1.0 0.500000 vertex anim -1 texture texture vertex 1.0 frame vertex
+1.0
+texture = 0.500000 vertex bone anim bone -1 = texture
+frame 1.0 texture -1 material
+material
+anim bone anim
+anim 1.0
+material
+texture 0.500000 1.0
+material
+0.500000
+0.500000 texture -1 texture vertex
+texture frame texture
+1.0 material vertex
+bone texture
+frame texture vertex anim vertex
+vertex
+vertex frame = texture =
+frame
+0.500000 anim vertex
+1.0
+= frame anim material = -1
+material frame material texture
+vertex 0.500000 vertex frame bone
+anim frame anim = 1.0 material vertex texture =
+texture texture vertex
+vertex = anim
+-1 material
+bone
+vertex anim frame 1.0 vertex material
+frame
+frame
+vertex 1.0 texture frame material 1.0 1.0 anim
+= vertex -1
+frame
+= 1.0
+0.500000 frame frame 1.0 = 0.500000
+material anim frame 0.500000 material
+= texture bone frame = texture vertex texture
+texture 1.0 0.500000 anim anim material bone vertex
+texture anim
+material frame frame = bone
+1.0 anim
+0.500000 material frame
+anim
+frame vertex vertex frame anim = texture vertex 1.0 anim texture -1 1.0
+material material
+=
+anim texture bone vertex
+bone material vertex material frame
+anim
+anim =
+-1 = frame material = frame
+vertex -1 1.0 vertex
+bone 0.500000
+1.0
+texture =
+-1 1.0 bone 0.500000 frame
+frame frame
+1.0 vertex
+vertex = texture 1.0 anim vertex texture bone anim
+anim =
+=
+0.500000
+bone anim texture = vertex 1.0 texture material 0.500000 texture
+-1 texture -1
+0.500000
+1.0
+anim anim
+material -1 bone anim
+texture
+0.500000 material
+0.500000 anim 1.0 = vertex frame =
+anim = frame anim bone texture material anim frame vertex -1 material 0.500000 bone = anim 0.500000 frame texture
+anim 0.500000
+= material -1 -1 1.0 vertex bone
+0.500000 vertex
+0.500000 0.500000
+bone frame -1
+0.500000 -1 = 0.500000 0.500000 material frame 0.500000 bone
+texture 0.500000
+1.0 anim
+0.500000 vertex texture = = -1 frame -1
+= vertex 0.500000 vertex
+1.0 = vertex texture 1.0 frame 0.500000 1.0 = frame -1
+anim vertex material -1 anim
+bone -1
+1.0 texture = anim
+anim 0.500000 0.500000 -1 = -1
+vertex frame frame
+= = anim
+material
+bone bone
+=
+anim
+-1
+bone = 0.500000 material
+=
+anim
+frame vertex
+frame vertex anim texture texture -1 anim = anim frame
+vertex 1.0
+= 1.0
+0.500000 vertex 1.0 0.500000 texture 1.0 0.500000
+material frame -1 -1 = anim texture -1 0.500000 0.500000
+texture
+anim
+frame bone 1.0 vertex texture
+= texture -1
+texture -1 = bone 1.0 1.0 = 0.500000 material vertex bone anim 0.500000
+= anim
+frame texture
+anim 1.0 = vertex frame
+1.0
+frame = = 0.500000
+1.0 texture vertex 0.500000
+= 0.500000
+= te
\ No newline at end of file
@@ -0,0 +1,223 @@
+-1 1.0
+-1 -1
+0.500000 = texture
+vertex vertex frame -1 texture vertex
+material
+1.0 frame -1 0.500000 vertex = texture material material = vertex
+anim 1.0 vertex 1.0 anim texture 0.500000
+1.0 -1 anim frame -1 vertex frame
+anim
+frame
+frame bone
+texture
+anim
+frame bone
+0.500000 -1 anim 1.0 anim
+material 1.0 =
+material =
+vertex material material anim 0.500000 vertex
+frame 1.0 -1 = bone
+frame = frame
+frame
+anim texture bone material
+0.500000
+-1 anim bone bone material
+1.0
+= anim frame 1.0 bone 0.500000 frame 0.500000 frame =
+= bone
+0.500000 anim frame texture
+anim frame
+anim 0.500000 bone 1.0 = = texture anim frame 1.0 0.500000 vertex
+texture anim -1
+vertex vertex 0.500000 vertex vertex material
+= texture material
+anim vertex
+= bone bone frame material -1
+0.500000 anim
+bone texture
+= texture material = material material material -1 0.500000
+texture = bone anim 1.0 = 1.0 frame bone 1.0 = vertex bone vertex 0.500000
+material =
+material anim
+material
+anim bone -1 = bone texture material = 0.500000 vertex anim material vertex anim frame texture vertex texture 0.500000 material -1 -1
+texture = 1.0 0.500000
+texture
+vertex -1 anim 0.500000 1.0 vertex -1 -1 frame anim -1 bone
+material vertex
+bone frame 0.500000
+bone -1 bone
+texture 0.500000 texture
+anim frame = 1.0 1.0 vertex material texture bone texture 0.500000 vertex frame frame
+= 1.0 frame
+1.0 vertex texture bone
+-1 1.0 texture anim frame texture vertex material 0.500000 material 1.0
+bone material 1.0 texture
+0.500000 =
+texture
+= frame texture
+-1 = 1.0
+texture bone vertex -1 texture frame 1.0 bone vertex bone
+vertex = 1.0 bone frame 1.0 vertex -1 1.0
+texture vertex bone
+= vertex 1.0 = 1.0 1.0 anim anim -1
+frame material frame vertex
+frame texture frame frame = bone anim = 1.0 bone material
+1.0 frame
+= 0.500000
+= frame
+texture frame anim
+material texture material = vertex
+material 1.0
+texture 0.500000 texture frame 1.0
+vertex
+=
+-1 texture texture 0.500000 material
+vertex =
+texture
+anim
+material material material = material 1.0
+0.500000 frame
+material vertex material material vertex -1 vertex anim
+frame =
+0.500000 -1 -1 bone frame material
+= anim = texture frame 0.500000
+= material 1.0
+anim texture frame
+bone frame bone bone vertex 1.0
+1.0 texture = anim =
+vertex
+-1
+vertex vertex
+-1 =
+0.500000 anim anim = = texture
+anim anim bone texture texture -1 -1 bone texture
+anim
+material anim vertex anim 1.0
+1.0 texture bone anim 0.500000
+= bone texture anim 1.0
+anim
+-1 = 0.500000 frame material -1
+-1 1.0
+texture frame frame
+texture -1 vertex -1 vertex 1.0 anim =
+=
+vertex bone 0.500000 anim material
+vertex 0.500000 vertex
+vertex bone
+= vertex anim
+texture 1.0 1.0
+= vertex
+bone -1
+1.0 anim vertex
+0.500000 bone 0.500000 bone 1.0
+1.0 frame
+material 1.0 1.0 frame anim anim 1.0 vertex anim bone = =
+vertex anim frame bone material 0.500000
+anim frame -1 0.500000 vertex -1 1.0 texture 1.0 -1 bone material 1.0 vertex anim 1.0 vertex
+texture frame texture
+0.500000 anim frame frame anim vertex 0.500000 -1
+material -1 bone bone
+material material texture -1 vertex anim material frame
+0.500000
+1.0 vertex -1 -1 material
+vertex
+anim vertex 1.0 texture material
+vertex bone material
+= vertex
+frame frame bone material texture
+1.0 texture texture 1.0 vertex vertex 1.0 1.0 material
+anim anim =
+anim frame material 0.500000 texture frame
+1.0 0.500000 texture 1.0 -1 0.500000 -1
+texture
+vertex texture
+-1 bone 1.0 anim frame = 0.500000 = frame frame texture
+texture 0.500000 =
+texture anim material
+material
+= bone anim 0.500000 bone material anim -1 0.500000 anim
+material
+vertex =
+-1 = 0.500000 1.0 vertex
+anim = vertex 1.0 1.0 -1 vertex
+bone vertex 1.0 vertex =
+bone -1 = vertex texture vertex material vertex = anim frame bone material 0.500000
+1.0 material =
+anim texture 0.500000 material -1
+texture -1 frame material texture 0.500000 texture material frame vertex vertex texture
+anim
+bone frame frame texture -1
+texture
+0.500000 bone texture -1
+1.0 vertex vertex = 0.500000
+1.0
+texture
+material
+vertex texture = frame bone
+= frame frame bone texture 0.500000 bone 1.0 anim 1.0 bone -1 -1 1.0 0.500000 material = texture = texture material
+frame = 1.0 frame 1.0 frame anim anim material bone frame 1.0
+bone frame texture -1 =
+bone bone vertex 0.500000
+bone 0.500000 bone 1.0 =
+-1 -1 frame = texture
+0.500000 material anim
+material bone vertex 0.500000 = = material
+vertex = material vertex frame
+-1
+anim 1.0 = frame material 0.500000 texture material 0.500000 material frame 1.0 -1 texture 0.500000
+1.0 bone
+texture 0.500000
+= 1.0
+texture 1.0 0.500000 1.0
+bone
+bone 0.500000
+vertex
+vertex 1.0
+texture bone texture 1.0 -1
+bone bone -1 vertex
+vertex -1 1.0 1.0 = 0.500000 texture -1 material 1.0 = material frame -1 -1 bone material vertex
+bone anim
+frame 0.500000 vertex texture
+-1
+1.0 = 0.500000
+anim -1
+texture anim
+-1 -1 texture
+1.0
+-1
+bone
+vertex bone = anim anim
+vertex texture vertex bone anim
+1.0
+1.0 bone material
+texture 1.0
+anim frame texture bone -1 anim -1
+-1
+texture bone
+= material 0.500000 frame anim 1.0 -1
+frame
+0.500000 vertex bone anim 1.0 material
+= 1.0 = -1 vertex bone vertex 0.500000 anim 0.500000 frame =
+texture frame vertex 1.0 bone bone
+bone bone vertex
+frame
+=
+1.0 bone bone
+vertex = = = -1 anim vertex -1 frame anim
+vertex =
+material vertex material 1.0 material vertex texture frame -1 =
+material -1 1.0 -1 anim 0.500000 material = texture material
+bone bone -1
+-1 -1
+= vertex
+texture = -1 vertex =
+-1
+vertex material
+1.0 frame
+1.0
+vertex = anim
+= 0.500000 material 1.0 = -1
+= -1 texture anim material
+0.500000 anim
+text
\ No newline at end of file
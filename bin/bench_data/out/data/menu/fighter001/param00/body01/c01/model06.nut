@@ -0,0 +1,167 @@
+anim
+bone 0.500000 1.0 bone vertex -1 -1 material
+bone
+texture = 1.0 anim vertex vertex
+-1 -1 bone vertex bone texture texture -1
+texture 0.500000 -1 =
+1.0 texture -1 -1 0.500000 anim 1.0 texture material
+anim
+0.500000 material anim bone frame = bone
+anim
+texture bone texture -1 1.0 anim vertex material material bone
+material bone bone
+anim 1.0 vertex material -1 1.0 vertex material texture 0.500000 material 1.0 texture frame anim
+-1 texture anim vertex
+frame
+1.0
+material 0.500000 anim = 1.0 -1
+material texture
+=
+0.500000 = = anim
+0.500000 1.0 = bone -1 vertex
+1.0 frame material
+texture texture
+= 0.500000 1.0 0.500000 0.500000 material anim
+anim -1 = bone frame bone texture 1.0 material 0.500000 frame
+material -1
+= 0.500000 -1
+1.0 frame bone -1 texture vertex texture
+1.0 1.0 1.0
+material
+=
+= = 1.0 = vertex vertex vertex frame -1 bone
+bone bone
+1.0 frame
+-1
+1.0
+1.0 material frame
+vertex bone frame anim
+-1
+= anim texture 0.500000 frame material
+texture anim
+material bone =
+= 1.0 material frame 0.500000 anim vertex material vertex bone -1
+anim frame
+1.0
+anim frame
+1.0 = frame -1 0.500000 texture = =
+bone
+bone frame vertex =
+frame 0.500000 material 1.0
+anim 1.0
+vertex anim vertex = material -1 vertex 0.500000
+anim 1.0
+0.500000
+material bone bone -1 bone bone = 0.500000 vertex frame bone
+frame frame 0.500000 bone frame bone 1.0 -1 1.0 bone bone
+0.500000 1.0
+texture vertex =
+-1 frame
+anim 0.500000 1.0 anim -1 -1 vertex anim 1.0
+vertex vertex vertex anim texture
+material 1.0 anim texture = frame texture 0.500000 1.0 -1 0.500000
+vertex 1.0 -1 1.0 1.0
+0.500000 1.0 vertex
+texture frame vertex
+frame -1 -1 frame 1.0 frame 0.500000 0.500000 frame =
+material frame texture -1 vertex 1.0
+= anim 0.500000 frame
+anim texture
+0.500000
+anim = anim 0.500000 -1
+material
+anim -1 frame frame 0.500000
+material frame texture
+0.500000
+material = = frame 1.0 -1
+anim vertex
+bone =
+texture anim -1
+vertex
+texture texture
+material 1.0 material texture texture vertex
+0.500000
+bone
+1.0 material bone vertex bone 1.0 = = 0.500000 vertex texture
+frame bone
+material
+texture vertex material frame anim
+1.0 bone vertex material 1.0 texture anim
+bone vertex vertex
+1.0 material
+frame 0.500000 = material
+texture bone anim
+1.0 anim material
+anim vertex bone
+-1 frame 0.500000 -1
+vertex vertex
+-1 frame frame vertex 0.500000 texture = -1 = material -1 1.0 vertex =
+material frame
+material = = anim texture
+material anim bone material 0.500000 frame =
+frame -1
+anim texture frame
+1.0 material texture
+-1 texture 0.500000 material = material bone bone texture texture = = = bone
+material -1
+bone
+0.500000
+frame vertex frame =
+-1
+0.500000 material
+0.500000
+anim anim 1.0 =
+-1
+= = = = -1 frame
+= texture material 0.500000
+0.500000 anim
+0.500000 material = material
+1.0 vertex vertex -1
+anim -1 frame bone anim 0.500000 vertex anim vertex vertex = 0.500000 0.500000 anim
+anim
+vertex -1 1.0 frame frame anim 0.500000 texture
+0.500000 frame frame vertex texture
+frame
+= -1 bone -1 anim
+1.0 bone bone material vertex material vertex 0.500000
+= -1 anim texture vertex 1.0 = material
+1.0 bone 1.0 texture 1.0 = -1 frame
+= texture
+texture -1
+0.500000 1.0
+frame bone = bone
+texture material = anim 0.500000 1.0 0.500000
+frame material
+vertex
+1.0 = bone material = frame = frame
+1.0
+texture frame -1 frame vertex vertex material 0.500000 frame -1 material material vertex
+anim 1.0 texture = material
+texture frame
+frame texture = material texture 1.0 -1 1.0
+-1
+texture bone 0.500000 = texture vertex
+vertex 1.0 bone anim
+bone -1 =
+1.0 texture frame
+= bone
+1.0
+frame
+material 1.0 material bone material texture -1
+anim material
+0.500000 anim
+= frame
+anim
+0.500000 frame vertex texture 0.500000
+bone vertex bone texture
+= anim bone 1.0
+= material bone bone vertex
+anim 1.0
+0.500000
+1.0 material
+-1 1.0 = bone frame = 1.0
+1.0 0.500000 1.0
+= 0.500000 0.500000 material = 1.0 material 0.500000
+-1
+frame bone 0.500000 1.0
+anim anim 1.0 bone bone vertex texture bone vertex
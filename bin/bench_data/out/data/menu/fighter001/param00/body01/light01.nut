@@ -0,0 +1,298 @@
+anim texture 0.500000 = anim 0.500000 material vertex texture
+0.500000
+anim
+vertex 0.500000 material anim vertex = = anim
+texture material 0.500000 -1
+1.0 =
+texture = 1.0
+texture -1
+-1 texture
+material
+texture vertex
+vertex frame frame
+anim texture
+frame
+frame vertex
+bone = -1 = vertex -1
+material frame
+= = bone vertex 0.500000 0.500000 frame bone 1.0 vertex material anim = vertex 0.500000 = = 0.500000
+anim frame 0.500000 anim material texture material material = 0.500000 vertex material material anim anim bone 1.0
+bone texture -1 vertex
+0.500000 -1 0.500000 anim vertex
+-1 -1
+0.500000 0.500000 vertex
+bone =
+anim 0.500000
+-1 bone material anim
+-1 = material vertex
+material frame frame -1 texture
+0.500000
+-1 = frame 1.0 1.0
+vertex frame
+material
+=
+material anim
+1.0 frame anim 0.500000 bone vertex = texture
+frame anim
+anim anim -1
+material
+texture
+bone
+-1 material bone frame
+anim material
+bone
+frame texture frame
+material 0.500000 texture
+material
+vertex texture
+texture bone texture
+bone texture vertex vertex vertex frame texture frame 1.0 =
+vertex texture = anim -1 texture -1 anim
+-1
+bone bone 0.500000 frame texture 1.0
+=
+bone material 0.500000
+texture
+anim vertex
+-1 anim material 0.500000 material bone frame -1 anim 1.0
+frame
+anim vertex
+bone
+texture
+texture texture
+-1
+1.0 vertex
+0.500000 bone
+material
+frame 1.0
+-1 anim 0.500000 = bone -1
+texture 1.0 -1 1.0
+frame 1.0 material -1 0.500000 vertex
+frame anim = 0.500000 = -1 frame vertex =
+anim
+vertex texture 0.500000 vertex
+texture frame vertex anim 0.500000 texture frame texture 1.0
+anim vertex 0.500000 anim -1 material
+anim =
+vertex material material 1.0 material frame anim 0.500000 = anim -1 -1 =
+-1 frame vertex anim 1.0 1.0 frame texture frame -1 = bone
+frame anim
+0.500000 texture vertex texture bone material texture frame texture vertex 1.0 frame
+frame anim frame -1 1.0
+1.0 material material =
+material material 0.500000
+bone vertex
+texture = texture 0.500000 0.500000 = bone = =
+frame 1.0 1.0 1.0 = material
+frame texture frame
+texture =
+anim bone material frame -1 texture bone vertex bone 0.500000
+frame
+frame 0.500000 material
+= frame texture 1.0 texture
+-1 vertex texture vertex = frame frame
+= material = frame
+bone -1 bone
+texture anim bone
+anim material frame
+vertex = bone
+-1
+1.0
+frame vertex anim anim 0.500000 vertex
+-1 material anim 0.500000 0.500000 0.500000
+bone texture 0.500000 = 0.500000 = -1
+material
+frame texture anim texture 0.500000
+bone anim = = frame 1.0 texture = frame
+-1
+0.500000 material bone frame = 1.0 1.0 1.0 = -1 material anim
+vertex material texture anim vertex frame = anim
+bone
+= 1.0
+0.500000 = frame
+anim 0.500000 1.0
+bone =
+anim 1.0 frame 1.0 bone 0.500000 1.0 =
+=
+vertex
+anim bone 0.500000 texture vertex bone bone frame frame bone anim vertex material
+frame anim = bone texture
+0.500000 material material -1 0.500000 0.500000 frame frame vertex 0.500000 anim
+-1 = 0.500000
+texture
+material bone 0.500000 -1 material material material bone -1 frame
+0.500000 bone = =
+vertex 0.500000
+1.0 frame frame =
+bone frame
+anim material anim -1 -1 vertex = material
+texture
+= = anim vertex texture material frame bone
+anim
+vertex
+0.500000 material
+bone frame -1 0.500000
+anim
+vertex material texture frame 1.0
+frame
+0.500000 =
+bone = frame texture material 0.500000 material bone 1.0 vertex
+0.500000
+= -1 bone bone 1.0 texture bone = -1 =
+0.500000 1.0 vertex material bone 1.0 texture frame 0.500000 texture -1 frame -1
+1.0
+bone anim frame
+-1 1.0
+vertex
+-1 anim texture texture
+vertex anim -1 texture bone material
+vertex bone anim = 0.500000 =
+material
+1.0
+-1 -1 0.500000 = 0.500000 -1 material texture frame material anim -1 vertex -1
+0.500000
+-1 0.500000
+anim = frame texture texture = vertex = bone frame =
+vertex
+=
+= bone
+anim
+material 1.0 frame vertex -1 bone
+texture 1.0 = 1.0 frame anim frame
+-1 vertex vertex frame 0.500000 -1
+vertex texture frame 0.500000
+texture
+vertex -1 frame 0.500000 bone anim frame material
+texture =
+texture vertex
+1.0 anim
+bone -1 bone frame material 0.500000 1.0
+-1 -1 = 0.500000
+-1 frame
+-1
+anim
+anim
+texture 0.500000 frame frame texture frame
+-1 0.500000 anim 0.500000 bone texture bone material
+= material frame
+1.0 = 0.500000 material
+0.500000
+= 1.0 material vertex material texture vertex texture texture
+-1 1.0
+vertex texture vertex
+texture 1.0 -1 anim -1 material =
+frame anim 0.500000 texture = texture vertex frame
+1.0 vertex = anim
+1.0 anim anim material
+anim anim vertex vertex
+vertex
+0.500000 0.500000 anim 0.500000
+texture material = texture = material texture 0.500000 vertex
+= = bone
+anim
+material
+-1 =
+1.0
+vertex texture = anim 1.0 anim = frame frame bone
+bone
+= vertex 0.500000 texture texture
+-1
+frame -1 1.0
+frame vertex
+anim vertex material
+texture bone frame
+frame texture bone frame = anim
+frame bone 1.0 vertex
+= bone texture
+anim 0.500000 bone 0.500000 material material
+= texture 0.500000 -1 0.500000 frame -1 vertex
+= 0.500000
+anim bone -1 = texture bone texture material 0.500000 vertex vertex texture anim 1.0 material
+1.0 bone
+-1 0.500000
+= bone -1
+anim
+= =
+texture anim -1 material material 1.0 anim
+bone
+material anim
+0.500000 anim 0.500000 = 1.0 texture 1.0 texture
+material -1 -1
+bone -1 1.0 bone
+frame
+vertex
+1.0 vertex vertex bone anim texture
+1.0 0.500000
+= vertex material -1 0.500000 -1
+texture bone 1.0
+texture
+material 1.0 vertex 1.0 frame texture -1
+texture anim
+1.0
+frame bone bone
+vertex frame 1.0
+0.500000 0.500000 material
+vertex anim bone texture 1.0
+frame 1.0
+material = 0.500000
+0.500000 -1
+material 1.0 anim
+-1 anim 0.500000 -1
+vertex 1.0 bone frame anim bone anim texture
+bone vertex material vertex
+material -1
+-1 bone =
+-1 1.0 bone bone anim 0.500000
+material anim -1 -1 material -1 frame bone anim = material material anim
+1.0 bone vertex vertex
+bone 1.0 = 0.500000 anim frame 1.0 -1 0.500000 texture frame -1 bone
+-1 bone
+bone
+texture texture
+-1 material
+vertex 0.500000 0.500000 1.0 = -1
+1.0 material
+texture -1 1.0 1.0 frame 0.500000
+vertex material
+material
+vertex anim
+anim material 1.0
+anim
+1.0 texture texture
+0.500000 bone = 0.500000
+0.500000 0.500000 anim texture
+0.500000
+bone texture bone -1 bone 0.500000 texture 0.500000 material
+anim
+bone anim
+anim
+1.0 1.0 1.0 material frame
+frame 0.500000 anim -1
+= anim
+-1 vertex vertex anim 0.500000 texture material
+1.0 texture
+bone
+-1
+anim
+bone vertex = 1.0 material frame texture
+bone
+= material
+material frame frame frame frame 1.0 anim vertex vertex bone = =
+material
+vertex bone bone 1.0 frame anim
+0.500000 vertex anim = material
+bone material -1 vertex
+1.0 texture
+-1 texture
+frame -1 1.0 frame 1.0 -1 vertex anim -1
+1.0 vertex vertex -1 frame
+material -1
+texture texture bone 1.0 texture texture frame frame material texture 1.0 0.500000 0.500000 material vertex
+=
+anim anim
+-1
+frame = anim anim frame vertex anim 0.500000
+vertex material 1.0 0.500000 -1 0.500000
+= -1
+= texture
+bone
@@ -0,0 +1,63 @@
+1.0 anim anim 0.500000 0.500000 material vertex material =
+1.0 material vertex material
+frame anim =
+anim frame bone bone frame
+vertex frame vertex bone vertex anim texture texture
+bone bone anim vertex bone
+1.0 material
+material
+texture
+bone 0.500000 texture texture frame -1 texture material
+vertex 0.500000
+anim -1 bone texture frame vertex = -1 bone = 0.500000 -1
+material material 1.0
+-1 material anim 1.0 vertex
+0.500000
+material frame = frame
+=
+vertex -1
+1.0
+frame bone = material
+1.0 -1 vertex material
+anim bone -1 vertex anim vertex
+-1
+vertex 0.500000 frame
+0.500000 frame = = vertex vertex
+bone
+bone
+0.500000 bone = = -1 texture texture 1.0 -1
+material
+bone
+0.500000 vertex = material = 0.500000 anim material anim texture 0.500000 material frame anim
+bone bone texture = frame vertex
+anim
+vertex
+texture
+vertex anim 1.0 material texture
+vertex
+vertex =
+vertex bone texture
+vertex bone texture
+=
+bone vertex 0.500000 = -1 material -1
+material anim texture -1 bone material 0.500000 0.500000 -1
+bone texture bone frame material 0.500000 1.0 1.0
+anim material anim 1.0 material
+texture 1.0 0.500000 anim
+texture 1.0 = texture vertex 1.0 = 1.0 material texture texture
+-1 material -1
+bone vertex 1.0 1.0 texture 1.0 0.500000 = 0.500000 -1 = = material vertex
+= frame
+bone = vertex material -1 1.0 vertex
+vertex anim = 0.500000 1.0 frame material 1.0 vertex -1
+texture frame
+vertex 1.0 material -1 texture -1 vertex
+1.0 -1
+=
+0.500000 vertex material bone
+vertex
+texture 0.500000 1.0 bone -1 =
+= 0.500000 material = 1.0 1.0 frame -1 0.500000 frame 1.0 material 0.500000 material
+anim
+0.500000 bone
+= anim 1.0 material anim 0.500000 
\ No newline at end of file
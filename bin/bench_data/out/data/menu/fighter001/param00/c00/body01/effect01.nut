@@ -0,0 +1,233 @@
+anim
+0.500000 -1
+frame
+= anim frame
+0.500000 -1 0.500000 material anim = 0.500000 anim 0.500000 texture anim texture -1 1.0 -1
+-1
+texture
+vertex 0.500000 = vertex 1.0 1.0
+frame
+frame =
+0.500000 -1 anim texture 1.0 anim vertex
+texture
+material
+frame -1 1.0 -1
+1.0 material 1.0 1.0 vertex anim
+= frame
+texture
+-1 0.500000 anim anim -1 bone texture
+anim = vertex texture frame
+= vertex 0.500000 texture
+-1 texture
+-1 material anim -1 1.0
+bone frame
+0.500000 frame material texture texture material frame bone
+-1 -1 = = texture vertex
+texture anim = anim
+1.0 = anim
+vertex 0.500000
+frame
+frame 1.0
+-1 1.0 texture 0.500000 anim texture anim
+texture
+anim =
+frame 0.500000
+0.500000 anim 0.500000 -1
+texture 1.0 1.0 bone frame vertex 1.0 1.0
+= bone anim vertex
+material material -1 texture 0.500000
+1.0 texture
+-1 anim
+frame = 1.0 -1 1.0 bone = frame texture vertex vertex frame
+bone frame frame bone
+= -1 bone anim 0.500000 -1
+anim = 1.0 anim vertex
+1.0 texture frame texture
+=
+frame vertex material = material
+-1 1.0 anim = vertex
+texture texture material 0.500000
+-1 frame texture
+material
+bone -1
+anim = texture vertex
+-1 vertex material 1.0 texture
+material
+0.500000 1.0 texture 0.500000 vertex -1 anim
+-1 frame 0.500000 1.0 = bone
+anim vertex
+bone vertex vertex texture
+0.500000
+0.500000
+bone 0.500000 frame
+vertex = 0.500000 1.0 anim 0.500000
+material
+texture -1 -1 = bone bone material -1 texture texture 1.0
+anim 0.500000 vertex 0.500000 anim vertex = texture
+texture vertex
+bone vertex texture frame
+bone texture 1.0 0.500000 texture -1
+-1 texture anim
+1.0 material texture material vertex bone
+1.0 anim material texture texture texture frame vertex texture
+= 1.0 vertex = frame anim
+0.500000 frame 1.0 = -1 bone
+material texture bone material texture -1
+texture
+anim
+bone material anim
+1.0 -1
+= bone texture = vertex
+vertex 0.500000 1.0 material
+material 1.0 -1 frame -1
+anim bone -1 material material = -1 = material 0.500000 1.0 anim =
+1.0
+vertex
+1.0 vertex = texture frame material bone vertex =
+0.500000 material bone 1.0 anim
+0.500000
+frame frame 0.500000
+-1 anim frame anim
+frame
+=
+texture 0.500000 0.500000 0.500000 anim bone = anim = texture
+0.500000
+frame
+1.0
+= -1 -1 texture
+frame = bone
+frame anim vertex
+= texture 1.0 = 1.0 0.500000 0.500000 texture
+= = 1.0 bone material -1 = 0.500000 1.0 = anim 1.0 anim
+texture 0.500000 anim 1.0 material
+bone 0.500000 bone material vertex
+frame
+frame
+material bone 0.500000
+bone material 1.0 material texture bone 1.0 -1 anim =
+frame vertex vertex frame = anim bone frame = texture 0.500000
+bone 0.500000 = material 1.0 =
+0.500000 frame
+frame frame texture
+anim
+0.500000
+bone
+anim
+-1 -1 = texture -1 anim
+0.500000 frame frame bone
+0.500000 material vertex
+1.0 = 0.500000
+bone bone = -1
+-1 = -1 frame material -1 =
+0.500000 anim
+-1 anim texture
+1.0 1.0 -1 = = vertex
+bone anim 1.0
+frame texture material
+vertex frame frame
+-1 bone vertex vertex frame
+1.0 frame -1
+texture frame 0.500000 1.0
+bone vertex 0.500000 anim vertex vertex
+0.500000 bone -1 material -1 texture = 1.0
+-1 1.0 anim vertex frame
+material frame
+frame bone 1.0 anim 0.500000
+-1 frame 1.0 1.0 = material texture bone anim material
+vertex frame
+=
+=
+vertex vertex -1 frame anim
+0.500000 =
+texture vertex bone frame -1
+anim anim anim -1 1.0 anim
+0.500000 = 0.500000 material 0.500000
+= texture 1.0 material anim 1.0
+vertex material frame
+= = 0.500000
+bone texture
+1.0 =
+frame -1 1.0 -1 -1 1.0 0.500000 0.500000 vertex vertex texture
+bone frame -1 bone -1
+bone texture -1
+texture 0.500000 = vertex
+anim anim 0.500000
+vertex
+texture 1.0 1.0 bone -1 -1
+frame
+bone
+=
+bone frame
+1.0 material
+anim material 1.0 = -1 -1 = 1.0 bone frame 1.0
+anim -1 -1
+=
+1.0
+material anim
+texture bone bone bone material = bone material = 1.0 -1 1.0 0.500000 = frame texture anim 0.500000 = anim = vertex
+0.500000 texture vertex
+bone texture frame
+bone 1.0
+-1 bone texture material anim
+anim
+frame anim -1 0.500000 0.500000 texture 1.0
+0.500000 texture
+frame
+-1 -1 anim
+= = 0.500000 = material bone frame material material
+1.0 = -1 bone frame
+= vertex -1 frame = material material -1 bone
+=
+1.0
+-1 frame
+material 1.0
+1.0
+= bone
+material vertex
+= frame 0.500000 texture vertex anim vertex vertex
+vertex
+material vertex bone vertex
+1.0 frame 0.500000 material bone
+anim
+material -1 frame vertex 1.0 = anim bone
+bone texture material bone
+material 1.0 -1 0.500000 1.0 material 1.0 bone
+vertex
+-1
+bone material 0.500000
+texture -1 bone 0.500000
+-1 1.0
+frame texture -1 1.0 material texture 0.500000 frame anim 0.500000 frame 0.500000
+bone material frame frame anim bone -1
+texture 0.500000 material
+bone material bone vertex frame 0.500000
+=
+vertex
+material frame material bone
+anim bone texture
+anim vertex
+texture = material anim
+material material = -1
+=
+texture
+vertex vertex anim frame texture
+vertex vertex 1.0 anim =
+frame
+vertex
+material -1 1.0 texture 1.0 texture
+0.500000 vertex
+frame bone texture
+bone material -1 1.0 material
+= texture
+vertex material 0.500000 anim
+1.0 anim frame material
+frame = texture vertex -1 1.0 1.0 0.500000 = anim vertex 0.500000 vertex 1.0 bone 0.500000
+vertex material =
+bone texture vertex texture
+-1 vertex bone
+anim
+1.0 frame
+1.0
+-1
+= vertex
+frame ve
\ No newline at end of file
@@ -0,0 +1,167 @@
+=
+=
+texture = 1.0 material
+material = 1.0
+anim texture -1 = vertex
+-1 0.500000
+texture vertex =
+frame vertex
+-1 bone
+0.500000 vertex =
+= 0.500000
+anim 1.0 -1 material
+texture 1.0 vertex texture 1.0 1.0 bone texture vertex
+-1 texture
+frame -1 = vertex bone 0.500000
+texture
+0.500000 vertex
+-1 anim
+= frame -1
+= 1.0 frame vertex vertex vertex 1.0 vertex -1 1.0 frame material
+frame
+= = = anim texture material bone
+texture
+1.0 bone
+= 1.0
+vertex
+vertex
+1.0 texture
+frame anim material =
+material 1.0
+bone
+-1 frame
+texture material frame = 1.0
+anim
+= bone texture -1 frame 1.0 texture texture
+anim
+0.500000 1.0
+anim 0.500000 anim anim bone
+texture
+= 0.500000 vertex 0.500000 vertex material 1.0 texture
+bone
+bone -1 frame material 1.0
+0.500000 bone -1 0.500000
+texture material vertex bone -1 anim
+0.500000 material
+1.0
+frame vertex material material anim texture anim 1.0 -1
+vertex material
+= texture frame anim
+vertex frame = -1 texture vertex
+frame -1 vertex
+texture
+material 1.0 material
+0.500000 anim bone bone
+frame = = frame texture = =
+= bone anim texture 0.500000 bone texture bone 0.500000 anim =
+vertex texture 0.500000 vertex material = 0.500000
+= material
+vertex bone
+texture vertex 0.500000 texture anim 0.500000 vertex
+frame material anim = = -1 -1 0.500000
+texture = frame 1.0 anim
+material 1.0
+material texture texture
+1.0
+bone
+1.0 material 0.500000 vertex texture 1.0 frame = vertex 0.500000 bone
+= = frame -1 vertex
+anim bone material
+material
+material anim
+anim -1 = frame material bone
+1.0 vertex material material = frame 1.0
+bone frame 1.0 vertex frame -1 anim = = texture
+frame bone vertex anim texture
+frame
+anim
+1.0 vertex 0.500000
+vertex vertex 1.0
+0.500000 texture anim frame 0.500000 texture vertex material
+1.0 bone
+frame = = 1.0 0.500000
+texture anim = anim frame
+bone
+texture texture = anim 1.0
+texture
+-1
+texture
+anim = texture material texture vertex material
+vertex
+vertex 1.0 material vertex
+material 1.0 material material
+texture vertex anim = bone texture texture = -1 material -1 -1 bone
+bone
+vertex anim material texture
+texture -1 texture = 1.0 1.0 1.0 -1
+1.0 = material bone
+-1
+-1 bone 1.0 0.500000 -1 1.0 0.500000 texture
+anim frame texture vertex = bone texture texture bone anim anim frame 1.0 1.0 material material
+material =
+0.500000
+0.500000
+0.500000
+= -1
+-1
+-1 0.500000 1.0
+= = vertex
+= anim anim -1 frame anim texture material anim texture 0.500000 bone = vertex bone
+0.500000 material vertex
+vertex
+texture
+0.500000
+texture 0.500000
+frame texture = bone
+frame
+anim
+texture anim anim anim bone = = texture anim
+vertex
+vertex 1.0 texture texture 0.500000 = = 0.500000
+= 1.0
+material 0.500000 texture
+= material frame frame material -1 material bone
+frame 0.500000
+anim material vertex material
+bone 0.500000 texture -1 0.500000 texture -1 bone -1
+0.500000 -1 frame = material frame
+frame texture texture vertex vertex anim 0.500000 bone
+1.0 bone
+anim = material =
+texture material texture anim 0.500000 texture = = material
+-1 0.500000 1.0
+1.0 vertex frame bone vertex frame texture 1.0 bone =
+-1 vertex
+anim = anim 0.500000 vertex anim anim =
+frame texture frame
+vertex -1 material frame texture
+frame
+0.500000 bone anim material 1.0 material texture -1 0.500000 texture
+0.500000 vertex
+bone vertex anim frame vertex bone
+bone -1 texture anim frame 1.0
+-1 0.500000 0.500000
+bone 1.0 vertex -1
+material 1.0 0.500000
+bone texture = 0.500000 bone
+texture frame anim texture
+1.0 0.500000 0.500000 material 1.0 texture -1 1.0
+material frame material
+vertex
+-1 material 1.0 anim -1 bone vertex 0.500000 1.0 0.500000 1.0 bone vertex 1.0 1.0 frame
+material 1.0 texture
+1.0 material frame anim =
+bone texture material = anim texture 1.0 = anim = bone -1 bone material -1 material vertex
+anim = anim frame frame
+material
+=
+bone 1.0 texture vertex = = texture material
+texture material -1
+1.0 vertex -1
+= 0.500000 bone texture
+1.0 anim anim
+frame frame material material = texture 0.500000
+= = material
+0.500000
+bone material
+material frame frame anim materia
\ No newline at end of file
@@ -0,0 +1,35 @@
+material -1 bone
+-1 1.0 -1 material -1 material material bone
+texture 1.0 bone
+texture vertex material
+frame frame
+1.0 = anim
+= texture texture anim -1 -1 anim -1
+vertex
+-1 frame texture
+frame
+vertex 1.0 vertex
+vertex = frame = frame frame
+bone
+anim material texture bone frame material texture texture
+material anim
+texture 1.0 frame
+1.0 texture
+= anim frame
+bone 0.500000
+vertex
+bone
+1.0 0.500000
+frame
+anim 1.0
+anim texture 1.0 =
+0.500000 frame anim frame 1.0
+-1 texture frame bone texture material bone vertex frame
+1.0
+1.0 texture
+material 1.0
+texture =
+1.0 1.0 anim bone =
+material =
+= = material -1 anim material anim 1.0 = anim anim bone
+= -1 = vertex bone = = vertex vertex 
\ No newline at end of file
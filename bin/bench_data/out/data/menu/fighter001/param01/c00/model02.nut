@@ -0,0 +1,15 @@
+material material
+material anim bone anim vertex 1.0
+material texture bone
+1.0 0.500000 = 1.0 material -1
+material anim
+texture vertex bone
+= material 0.500000 1.0 = anim anim
+frame 0.500000 0.500000 material
+texture = material =
+= -1 0.500000 anim bone = vertex frame = anim -1
+texture 1.0 texture
+vertex 0.500000
+texture vertex frame 0.500000 0.500000 1.0 frame
+material
+texture texture vertex anim -1 an
\ No newline at end of file
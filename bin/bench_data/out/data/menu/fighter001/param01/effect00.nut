@@ -0,0 +1,4 @@
+vertex
+0.500000
+texture 0.500000 vertex
+ma
\ No newline at end of file
@@ -0,0 +1,38 @@
+0.500000 texture texture 1.0 = material = vertex material
+bone
+frame bone material -1
+1.0 material 1.0 bone
+vertex material anim frame material bone vertex 1.0 material 0.500000 vertex 1.0
+frame
+material frame
+texture
+1.0 anim
+= 0.500000 vertex bone frame material 0.500000
+texture vertex material 0.500000 material frame
+material -1
+vertex vertex material -1
+1.0
+0.500000 material = vertex 0.500000 0.500000 vertex vertex bone bone 1.0
+vertex vertex texture = anim 1.0 -1
+0.500000 bone frame 0.500000
+frame 0.500000
+material
+-1 frame
+-1 anim 1.0 anim
+anim
+bone frame vertex anim vertex 0.500000 texture 0.500000
+-1 anim bone
+material 0.500000
+-1 material = anim 1.0 = frame
+0.500000 vertex
+1.0 vertex
+= texture 1.0 frame 0.500000 bone frame texture
+1.0 = = vertex texture
+bone
+texture vertex material 1.0 texture = vertex material frame =
+1.0
+material 0.500000 1.0 -1 frame
+texture vertex anim texture frame material
+1.0 material bone anim -1 anim frame -1 0.500000
+frame frame
+material 1
\ No newline at end of file
@@ -0,0 +1,322 @@
+frame -1
+texture material frame texture material = 1.0 frame vertex
+1.0
+= -1 texture vertex -1 = 1.0 vertex -1
+anim = texture = bone
+material vertex bone 0.500000 0.500000
+bone bone anim frame vertex -1 vertex
+bone 1.0 vertex 1.0 texture frame material -1 0.500000 frame
+anim anim anim texture frame
+anim -1
+material 0.500000 1.0 =
+texture 1.0
+material bone
+-1 -1 1.0
+0.500000 0.500000 frame anim bone
+anim 1.0
+material vertex
+bone vertex 1.0 frame
+-1 -1
+material bone frame = -1 bone frame 1.0 texture
+texture anim bone anim -1 vertex material vertex 0.500000 texture texture material bone frame 1.0 vertex
+vertex -1 texture bone
+material
+=
+vertex anim material anim bone = 0.500000
+vertex 0.500000
+texture
+material frame 0.500000
+frame texture -1 -1 frame
+frame 1.0 vertex bone 0.500000 vertex anim -1
+0.500000 material vertex
+frame frame -1 1.0
+anim vertex
+vertex vertex
+vertex material -1 vertex =
+frame bone
+0.500000 = 0.500000 material bone anim frame
+material =
+= anim texture
+-1 frame frame texture 0.500000
+1.0 frame
+bone bone anim texture -1 texture
+1.0
+=
+vertex
+bone vertex
+= -1 bone 0.500000 texture anim = frame vertex 0.500000
+-1 bone
+= -1 frame frame anim material vertex
+0.500000
+-1 -1 material vertex
+1.0
+bone
+= = =
+texture = anim
+0.500000 bone anim bone = 1.0
+=
+-1
+vertex = bone material 0.500000 bone -1 anim
+1.0 material bone texture
+material 0.500000 vertex
+bone
+= vertex texture 0.500000 anim material
+texture
+frame frame
+texture = 0.500000 vertex -1
+= frame texture
+bone -1 texture texture
+bone vertex
+vertex bone vertex frame -1 bone -1 anim
+bone vertex frame
+anim 0.500000 = -1 material = 1.0 = material bone
+material 0.500000 anim bone -1 0.500000 = texture
+anim
+1.0 1.0 1.0 1.0
+frame frame
+bone vertex -1 frame material anim frame vertex 1.0 anim
+1.0 1.0 material bone bone 0.500000 material
+0.500000
+frame texture = = = 1.0
+= vertex
+1.0 frame
+-1 1.0 -1 material
+material -1
+vertex material texture
+anim -1
+= material
+0.500000 = bone material
+= texture 1.0 material frame vertex anim 0.500000 bone material vertex 0.500000 1.0
+anim frame texture 0.500000
+=
+1.0 0.500000 material texture texture frame texture frame
+frame = 0.500000 -1
+material frame vertex
+=
+bone
+-1 = 0.500000
+= 0.500000 -1 vertex vertex
+-1 frame material = 0.500000 texture frame anim
+1.0
+frame vertex 1.0 bone 1.0 -1 frame vertex
+frame bone -1
+-1 texture anim
+texture
+1.0
+0.500000 bone frame 0.500000 -1 vertex vertex -1 anim
+material frame = anim
+bone anim 1.0
+vertex = bone material
+-1 texture anim material -1 anim material
+bone
+texture 0.500000
+= frame
+1.0 0.500000 -1 -1 =
+anim
+0.500000 0.500000
+= bone
+-1 vertex texture 0.500000
+-1 anim = 1.0 frame
+bone = anim
+=
+frame 1.0 frame
+material
+0.500000 -1 vertex 0.500000 texture -1 texture -1 anim
+texture vertex = 0.500000 1.0
+anim 0.500000
+material 0.500000
+-1 material anim vertex 0.500000 texture
+1.0
+frame vertex
+texture = material texture
+texture
+frame texture bone -1 vertex 1.0 bone texture
+-1 0.500000 = bone bone bone bone -1 bone
+1.0 frame
+texture -1 texture texture
+frame
+anim = anim texture frame
+vertex = 1.0
+material -1 vertex texture frame 1.0 1.0 material
+anim =
+-1 texture -1 -1 = 1.0 texture
+1.0 0.500000 1.0 0.500000
+texture anim
+anim anim anim
+0.500000 anim
+= vertex texture
+vertex frame vertex =
+anim 1.0 material
+texture frame vertex
+texture texture = frame vertex material
+frame frame frame 1.0 1.0 0.500000
+vertex anim material frame 1.0 -1 0.500000 = frame material anim 1.0 vertex 1.0 0.500000
+bone = bone bone bone anim
+texture
+0.500000 material = texture vertex 1.0 = bone = bone anim material -1 vertex =
+frame 1.0 0.500000 1.0 bone 1.0 material
+0.500000 = bone
+material vertex vertex vertex bone 1.0 = vertex bone frame texture texture frame
+vertex
+-1
+-1
+0.500000
+frame = material
+texture anim
+-1 bone material -1 anim bone =
+1.0 = material texture 0.500000 -1
+-1 texture frame
+vertex bone
+1.0 material material = = material
+bone vertex 1.0 0.500000 -1 = bone bone anim
+material 1.0
+-1 -1 1.0 texture frame
+1.0 frame
+material
+= -1 bone bone 1.0 -1 -1
+anim = material frame texture anim frame 1.0
+vertex anim texture texture 0.500000 -1
+bone frame
+texture -1 0.500000 bone frame
+=
+bone anim 0.500000 material bone 0.500000 texture vertex bone texture = 0.500000 = vertex
+frame
+vertex 1.0 =
+-1 1.0
+= 0.500000
+1.0 material -1 texture
+1.0 bone
+texture 1.0
+frame frame 0.500000 -1
+texture frame
+0.500000 material anim material 0.500000 frame
+0.500000 = vertex 0.500000 texture material texture = -1 -1 vertex 0.500000
+0.500000 frame
+anim 0.500000 =
+anim frame
+0.500000
+0.500000
+vertex frame material material bone vertex
+frame
+-1 -1 material =
+material 0.500000 vertex -1 vertex frame 0.500000 material material texture anim 0.500000 frame texture texture vertex texture 1.0
+0.500000
+texture = = -1 = vertex texture vertex texture material frame = frame texture
+-1
+material -1 0.500000 vertex material bone texture -1 1.0 anim = material
+1.0
+0.500000 frame = frame frame frame texture frame
+bone = material
+0.500000 frame anim vertex bone bone texture 0.500000 vertex anim = anim bone texture 0.500000 1.0 frame frame 1.0
+frame anim frame vertex = frame frame vertex material anim 1.0 -1 0.500000 texture bone frame texture frame
+= -1
+anim 1.0 = 0.500000 anim -1 bone 1.0 material -1 frame material vertex 0.500000
+anim
+= 0.500000 vertex 1.0
+material frame vertex vertex material texture frame
+anim 1.0 =
+vertex 0.500000 -1 -1
+anim = anim material 0.500000 1.0 -1
+frame 0.500000 frame -1 =
+-1 anim frame
+material
+0.500000 bone -1
+= material bone bone
+texture = frame texture material = bone material 1.0 1.0
+material = material
+= 1.0
+0.500000
+frame
+= -1 = bone texture material frame bone anim = bone -1
+frame
+1.0 -1 = vertex
+0.500000 material frame texture = vertex 0.500000 anim bone
+= frame 0.500000
+anim
+1.0 texture 0.500000
+0.500000 1.0 bone 0.500000
+bone
+bone
+bone
+-1 bone 1.0 = frame material vertex anim bone vertex
+0.500000 anim
+vertex texture
+frame =
+= anim 1.0 -1
+anim = = 0.500000 bone
+0.500000
+anim =
+1.0 0.500000 vertex = material -1 0.500000 frame -1
+= bone = texture -1 vertex -1 -1 vertex material material
+bone -1 vertex
+= texture vertex frame frame anim 0.500000
+= = 0.500000 frame =
+bone material 0.500000 material
+anim bone bone bone material
+frame
+anim 0.500000 -1 material
+texture bone
+-1 texture frame 1.0
+texture = texture vertex texture 1.0 frame 1.0 frame texture = 1.0 = anim vertex anim -1
+vertex
+1.0 frame frame 1.0 bone anim -1 = material vertex -1 texture
+frame
+texture
+bone frame 1.0
+bone anim material material frame
+material
+texture bone texture = = bone -1 0.500000 vertex
+= material frame 0.500000 texture material texture 1.0 -1 -1
+vertex 1.0
+1.0 texture material = -1 0.500000 texture bone material texture material
+texture
+frame 0.500000 bone 0.500000 -1 anim
+frame frame 0.500000
+texture
+anim texture = -1
+-1
+texture material
+-1 frame -1 1.0 vertex -1 frame frame frame 1.0 vertex anim 0.500000 0.500000 1.0
+vertex
+texture anim vertex
+anim 1.0
+bone
+= vertex bone anim =
+frame
+vertex anim 0.500000 = anim anim -1 vertex frame -1 texture material 1.0 texture frame = vertex
+1.0 1.0 1.0 = 0.500000 anim 0.500000 -1 texture = vertex 1.0 frame = anim
+0.500000 -1 =
+bone bone texture -1 0.500000
+frame material
+1.0 = = 0.500000
+frame
+=
+-1
+material frame
+0.500000
+frame
+0.500000 bone texture 0.500000 anim
+material material =
+=
+frame
+anim
+anim material = 1.0 vertex anim
+=
+anim
+anim
+material texture 1.0 1.0
+0.500000
+vertex bone
+vertex
+-1
+bone = material
+-1 texture material vertex
+bone vertex bone
+bone bone 1.0 frame
+texture = -1 bone = frame 0.500000 -1 -1
+-1 texture anim = vertex frame frame
+0.500000 1.0 -1 = frame
+-1
+-1 bone material bone vertex
+1.0
+vertex frame
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone frame vertex vertex
+1.0 texture
+-1 material
+= frame
+0.500000 material ani
\ No newline at end of file
@@ -0,0 +1,61 @@
+1.0
+-1 material 1.0
+bone vertex texture
+-1
+= anim
+frame
+frame frame bone -1
+texture material
+0.500000 material anim
+texture frame texture vertex frame -1 -1
+vertex anim = vertex texture
+bone 1.0 bone bone
+anim bone bone 1.0 1.0 bone
+texture = vertex
+bone bone
+bone -1 bone vertex 0.500000 anim
+texture vertex 1.0 material
+= vertex
+texture anim
+texture texture = -1 0.500000 = texture
+frame anim anim 1.0 0.500000 anim 0.500000 = bone anim anim anim texture
+anim -1 frame vertex bone
+anim bone = vertex 1.0
+bone anim frame = bone anim frame 1.0
+material
+frame
+1.0 vertex 1.0 anim
+vertex
+vertex 1.0 anim frame vertex vertex
+anim frame -1
+bone
+bone 1.0 -1 0.500000 anim bone vertex -1
+1.0
+= 0.500000 = vertex material 1.0 0.500000
+anim vertex bone bone frame = 0.500000 = -1 0.500000 vertex
+1.0
+1.0
+vertex -1 vertex anim = material anim
+= bone
+-1
+vertex bone
+frame texture 0.500000 vertex = frame texture 1.0
+0.500000 0.500000 0.500000 vertex
+-1 -1 1.0
+= 1.0 -1
+anim texture
+frame -1
+anim vertex
+texture
+frame = -1 material texture
+material
+0.500000 0.500000
+texture = 1.0 material -1 texture
+1.0 frame 0.500000 0.500000 anim
+0.500000 0.500000 vertex 1.0 material texture 0.500000 =
+frame texture frame 0.500000 0.500000 material material
+1.0
+= 1.0 texture vertex vertex 1.0 1.0 bone -1 1.0
+material
+frame
+anim
@@ -0,0 +1,4 @@
+texture
+anim
+frame -1 frame material -1 0.500000 material
+mate
\ No newline at end of file
@@ -0,0 +1,81 @@
+1.0
+vertex = vertex anim 0.500000 texture
+0.500000 -1 0.500000 -1
+texture bone
+frame
+texture frame 1.0 material 0.500000 texture = material
+bone
+anim anim anim
+=
+anim 1.0
+bone bone 0.500000 texture = 1.0
+anim bone = 0.500000 0.500000 frame frame = texture =
+0.500000 material material frame 1.0 anim texture
+1.0 1.0
+vertex 1.0 1.0 frame vertex material -1 bone bone bone 1.0 1.0
+= material
+frame
+anim bone
+-1
+=
+material frame 1.0
+texture
+-1 -1 bone anim bone =
+vertex
+anim 1.0
+1.0 = 1.0 anim anim vertex vertex material
+-1
+material
+frame frame = -1 anim = bone = anim anim = -1 bone 1.0
+-1 -1 -1 vertex anim texture frame 1.0 material material
+vertex -1 vertex 0.500000
+material
+1.0 frame anim
+0.500000 material vertex -1 0.500000 material 0.500000
+frame anim texture 0.500000 -1 0.500000 material
+anim anim
+-1 1.0 0.500000
+texture =
+frame 0.500000
+texture -1 anim material 0.500000
+1.0 vertex bone frame texture
+vertex
+anim -1 -1
+texture 0.500000 texture vertex -1 1.0 bone vertex = =
+-1 0.500000 bone
+= frame frame
+texture anim 1.0
+= bone 1.0 -1 bone 0.500000 anim -1 frame material texture -1 =
+texture
+material vertex 1.0 vertex = texture texture 0.500000
+anim -1 anim -1
+= vertex = 1.0
+vertex frame vertex -1 = frame vertex
+=
+material -1 texture 1.0
+vertex -1 texture frame
+bone anim 0.500000
+0.500000
+anim
+vertex frame 1.0 -1 bone bone 0.500000 bone
+-1
+vertex
+0.500000
+0.500000 0.500000
+0.500000 texture vertex -1 anim bone 0.500000 -1
+-1 bone
+-1 material frame texture vertex bone 1.0 bone frame 1.0 0.500000 frame =
+1.0 texture -1 texture 1.0
+= vertex 1.0 = =
+texture
+material 0.500000
+-1 1.0
+frame -1 anim
+bone 1.0 1.0 =
+vertex -1 = frame frame 1.0 vertex bone
+texture = -1 1.0
+bone material frame material bone
+0.500000 texture =
+0.500000 1.0 = anim 0.500000 texture bone
+1.0 texture = texture 0.500000 texture vertex texture = -1
+frame bone 0.500000 vertex mate
\ No newline at end of file
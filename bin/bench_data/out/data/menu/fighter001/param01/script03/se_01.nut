@@ -0,0 +1,58 @@
+frame bone = anim 1.0 frame anim -1
+0.500000 vertex
+frame -1
+1.0 anim
+1.0 1.0
+material frame -1 -1 texture
+texture
+=
+1.0
+1.0 frame
+1.0 frame
+= =
+= -1 vertex texture frame texture
+texture
+anim bone vertex 0.500000 frame = bone
+-1 = anim 0.500000 anim bone 1.0 vertex
+bone
+vertex
+material 1.0 vertex vertex texture anim 0.500000 frame texture -1 texture bone material frame =
+=
+= 1.0 vertex
+vertex anim frame material = vertex
+material vertex anim 1.0
+0.500000 anim 1.0 material
+material 1.0 -1
+material frame
+-1
+1.0 frame 0.500000
+texture = material material -1 0.500000
+material
+frame
+0.500000 anim vertex frame anim = bone bone frame anim -1 vertex 0.500000 = bone material anim
+-1
+0.500000 0.500000 frame 0.500000 texture
+bone frame frame frame frame = texture texture = =
+texture texture bone vertex 1.0 frame 0.500000 1.0 material
+-1 frame 0.500000 material
+material
+vertex anim anim vertex = vertex 1.0
+1.0 bone texture
+anim frame
+0.500000 0.500000 1.0 frame
+anim =
+0.500000 material
+1.0
+anim anim texture
+1.0 material
+texture
+1.0 1.0
+frame material frame bone
+=
+bone 0.500000 0.500000 0.500000
+-1
+anim -1 bone 1.0 material -1
+1.0 material -1
+material bone material bone bone
+vertex
+a
\ No newline at end of file
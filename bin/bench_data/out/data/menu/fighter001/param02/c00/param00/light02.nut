@@ -0,0 +1,36 @@
+frame texture
+material bone
+-1 1.0
+material
+anim 1.0
+1.0 frame vertex bone texture
+anim frame vertex material = 1.0
+frame -1 1.0 vertex
+anim
+material bone texture -1
+0.500000 1.0
+texture anim -1 -1 anim bone
+anim vertex anim anim 0.500000 vertex vertex texture
+bone
+-1
+texture 1.0
+= vertex 1.0 bone = -1
+= = -1 1.0 1.0
+0.500000
+material material vertex = anim
+material
+= frame -1
+vertex 1.0 -1 -1 material
+material anim frame 1.0 0.500000 vertex vertex = vertex
+0.500000 1.0
+frame bone
+anim vertex = bone 0.500000 bone texture anim
+anim 1.0 bone frame material -1 material texture material 1.0
+-1 vertex -1 material
+anim = material 0.500000 = anim
+= material texture frame
+vertex -1 -1 frame
+= vertex -1 0.500000
+frame 1.0 frame 1.0 anim material 1.0 =
+frame 1.0 0.500000 anim 0.500000
+textu
\ No newline at end of file
@@ -0,0 +1,70 @@
+-1 anim
+0.500000 -1 = =
+vertex bone vertex vertex vertex = bone -1 texture
+frame material material
+frame material -1 texture material bone
+anim anim texture
+0.500000 frame vertex texture -1 bone
+frame 1.0 -1
+texture -1
+1.0
+= 0.500000
+frame
+material 1.0 -1 vertex
+1.0 1.0 texture vertex texture
+= anim 1.0
+frame material material texture
+texture = frame = -1 -1
+bone = = 0.500000 texture material frame 0.500000 = 1.0 0.500000 = frame -1
+0.500000 = frame frame
+0.500000 material material
+texture frame anim 1.0 0.500000
+= frame
+anim
+frame
+= anim -1 1.0 -1 anim 0.500000
+vertex bone anim frame bone
+texture vertex texture =
+1.0 1.0 0.500000 = 0.500000
+material
+vertex material frame anim
+frame = texture
+bone -1
+anim material 0.500000
+1.0 anim 0.500000 bone = 0.500000 0.500000 texture 0.500000
+0.500000 1.0
+material bone vertex material
+1.0 =
+frame
+-1 0.500000 0.500000 vertex
+texture -1
+vertex
+-1 -1 = = material
+frame
+1.0 frame -1 vertex material = material
+1.0
+0.500000
+vertex texture frame = frame anim frame
+1.0
+texture 0.500000 1.0 -1
+= bone
+material texture
+vertex -1 = frame = frame frame 1.0 -1 material texture vertex
+0.500000 = bone anim = =
+1.0 0.500000 texture vertex
+material vertex 0.500000 -1 bone
+material = = texture -1 = vertex vertex bone
+-1 -1
+anim vertex -1 bone vertex -1 texture 1.0
+anim
+-1
+0.500000
+-1
+-1 bone
+-1 anim
+0.500000
+bone material 0.500000
+vertex anim 1.0
+=
+1.0 -1 anim bone anim vertex
+f
\ No newline at end of file
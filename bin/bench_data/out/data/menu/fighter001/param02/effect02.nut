@@ -0,0 +1,16 @@
+frame
+-1 anim
+1.0 vertex anim 1.0 anim
+bone frame 1.0 material -1 material =
+1.0 anim
+anim -1 anim = 0.500000 material -1
+vertex texture vertex bone anim
+frame
+0.500000
+frame bone bone frame =
+anim material frame bone
+bone vertex
+vertex 1.0 texture texture = 1.0
+material bone
+-1 1.0 -1 anim material bone vertex vertex frame 0.500000 material frame -1
+bone b
\ No newline at end of file
@@ -0,0 +1,23 @@
+0.500000 = = = 1.0
+vertex
+0.500000 1.0 texture
+bone 1.0 texture = = vertex texture texture anim vertex
+texture bone = material 0.500000 = anim texture texture 0.500000 bone frame frame texture texture vertex texture -1 anim material
+bone material bone bone 1.0 0.500000 1.0
+1.0 bone 1.0
+= bone -1 -1
+material material 0.500000 = texture frame anim 1.0
+-1
+bone = frame = frame bone frame material anim -1 frame = vertex bone -1 texture
+0.500000 frame
+texture -1 0.500000 bone
+= -1
+=
+material 1.0 bone anim texture
+anim 0.500000 bone =
+material
+vertex
+bone material 1.0 vertex = =
+texture anim texture 0.500000 vertex
+0.500000
+frame frame 
\ No newline at end of file
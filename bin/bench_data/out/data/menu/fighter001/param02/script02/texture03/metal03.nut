@@ -0,0 +1 @@
+MgCNjnsz7+Dp7RS.5]EJP(]퐳oI2W27yȳ	}I|H!ĭQz%mGlTڀUr))D*dԆRFsX*oE`'<YU%iX<
\ No newline at end of file
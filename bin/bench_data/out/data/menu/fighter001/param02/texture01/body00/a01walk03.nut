@@ -0,0 +1,4 @@
+IYնud
+Ŏ5m
+J&me,Z9Jm;A(HhE&Lx3,t)59$2\
+,$	&T˿2(@C=rc8HK@Bҟ%*|F/( Y_~>ź6BnZtmhq-&81˿/aZ&ؽF֒o$7ahw
\ No newline at end of file
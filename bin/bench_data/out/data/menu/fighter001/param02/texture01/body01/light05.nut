@@ -0,0 +1,17 @@
+0.500000 vertex bone texture material 0.500000 anim frame
+frame
+1.0
+anim material bone 0.500000 1.0 0.500000 0.500000 frame 0.500000 -1 material 1.0 material 1.0 vertex anim = -1 0.500000 material anim 0.500000 anim = texture =
+bone -1 -1
+texture = material
+-1 frame frame
+0.500000
+anim 1.0 material anim anim = vertex
+frame
+anim
+material
+anim
+vertex bone vertex vertex 0.500000 anim 1.0
+-1 vertex texture
+frame material material
+= 
\ No newline at end of file
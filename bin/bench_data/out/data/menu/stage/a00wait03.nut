@@ -0,0 +1 @@
+V2	j)m?6f*N`PqGK1f<S8s<
\ No newline at end of file
@@ -0,0 +1,27 @@
+=
+= bone material = frame frame material bone
+bone = 0.500000 frame -1 anim anim 0.500000 texture = = frame bone 0.500000
+frame 0.500000 vertex 0.500000 vertex bone texture frame = 0.500000 -1 bone 0.500000 bone
+material bone material
+vertex
+texture 0.500000 texture -1 -1 frame 0.500000
+0.500000 1.0 material =
+anim = 1.0
+-1 0.500000 anim
+frame -1 -1 0.500000 texture anim
+texture
+-1 texture
+texture bone 1.0 anim anim =
+= vertex
+anim vertex material vertex anim 0.500000
+=
+anim vertex 1.0 -1 0.500000 material
+material bone = vertex
+texture bone vertex -1 bone bone vertex bone texture 1.0 = = vertex bone -1 vertex material frame 0.500000 texture texture 1.0 bone
+anim frame bone =
+1.0
+frame material vertex
+bone
+texture
+= 1.0 = = bone vertex vertex texture 0.500000
+0
\ No newline at end of file
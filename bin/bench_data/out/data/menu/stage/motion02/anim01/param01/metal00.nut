@@ -0,0 +1,33 @@
+material texture texture 1.0 -1 vertex material
+material frame vertex
+frame
+0.500000 =
+0.500000 anim
+1.0 frame vertex
+texture texture anim texture anim
+=
+= =
+material
+texture
+-1 material
+material
+1.0 texture 1.0 material
+1.0 bone -1
+-1 texture
+material 0.500000
+1.0 material material bone frame -1 material bone frame =
+material frame
+material
+vertex -1 bone
+texture 0.500000 1.0 -1 texture 0.500000 bone 1.0 = 1.0 anim = anim
+= 0.500000 texture texture
+anim
+frame 0.500000 frame
+vertex -1 material vertex vertex
+bone 0.500000 bone
+material
+texture
+frame 0.500000 vertex vertex frame
+= 1.0 frame frame texture 1.0 texture anim frame
+-1 vertex 0.500000 1.0 bone 1.0 1.0 0.500000
+anim ani
\ No newline at end of file
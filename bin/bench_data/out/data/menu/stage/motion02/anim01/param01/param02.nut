@@ -0,0 +1,3 @@
+texture 1.0 0.500000 bone = material 1.0 = vertex =
+vertex -1
+frame texture t
\ No newline at end of file
@@ -0,0 +1,25 @@
+frame 1.0 anim
+material anim 1.0 vertex anim vertex material =
+vertex anim
+-1 bone
+material texture frame vertex bone material -1
+texture texture -1 material 1.0 frame
+-1 material
+0.500000 vertex
+texture material
+material material
+0.500000 0.500000
+vertex vertex frame material -1
+0.500000 material 0.500000
+=
+material bone
+-1
+texture
+texture material vertex bone 0.500000 1.0 0.500000 texture anim texture 1.0
+material texture vertex bone =
+bone bone
+bone frame -1 1.0 1.0
+bone texture 1.0 texture 0.500000 1.0 anim -1 vertex frame
+texture
+frame
+textur
\ No newline at end of file
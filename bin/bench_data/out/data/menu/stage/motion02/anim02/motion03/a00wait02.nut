@@ -0,0 +1,10 @@
+anim material 0.500000 bone
+bone = -1 texture
+frame frame
+0.500000 material 1.0 vertex frame bone 0.500000 texture material
+material -1
+frame 0.500000 = 1.0 1.0 1.0 texture bone texture material
+material
+= frame bone
+material texture texture vertex =
+bone 0.500000 frame anim 0.500000 anim textur
\ No newline at end of file
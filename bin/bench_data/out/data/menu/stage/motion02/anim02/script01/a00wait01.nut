@@ -0,0 +1 @@
+ZT[@)C'mޛZ$>\x+qzk*l$F-]v9EHY3˅S QEʮ2jިfgJHDUƦ'$hؒ^ktcZo݁|Ͱ
\ No newline at end of file
@@ -0,0 +1,238 @@
+bone anim texture anim 0.500000 1.0
+texture = = texture anim
+= 0.500000
+anim bone vertex -1 texture frame -1 0.500000 frame material anim -1
+1.0 -1
+1.0 texture
+0.500000
+texture anim
+vertex
+texture anim vertex anim bone frame
+anim
+material
+material frame bone
+vertex 1.0 = texture -1
+-1 vertex 0.500000 bone 0.500000 texture -1
+anim vertex
+=
+1.0 material texture vertex vertex frame vertex anim material
+-1
+anim vertex -1
+frame
+vertex vertex 1.0 material -1 bone 0.500000 vertex
+0.500000
+frame
+0.500000 0.500000 1.0 texture frame =
+anim material frame
+= material bone texture -1 -1
+frame -1 vertex
+-1
+0.500000 -1 anim
+material 1.0 1.0
+vertex material anim texture 1.0 anim -1
+bone vertex vertex -1 anim -1 anim 0.500000 frame texture bone -1 1.0
+material vertex
+1.0 texture
+vertex 0.500000
+-1 frame frame
+bone -1
+texture 1.0 vertex 0.500000 -1
+-1 frame frame -1 vertex -1
+anim anim 0.500000 material bone 1.0 vertex
+bone =
+vertex
+-1 1.0
+anim frame 1.0 = bone bone = bone material material texture vertex material
+frame texture = = -1 vertex -1
+= bone -1 bone
+-1 texture 0.500000
+-1 0.500000 frame 0.500000 anim
+bone = =
+0.500000 = material anim
+0.500000 texture
+anim
+bone
+vertex bone 1.0 1.0 0.500000 texture bone 0.500000 1.0
+anim material
+anim
+0.500000
+frame 0.500000 anim material anim -1
+bone material 0.500000
+bone anim
+frame 0.500000 vertex
+bone vertex -1 1.0
+vertex
+vertex anim anim
+=
+0.500000 1.0 material -1
+bone -1 = texture 0.500000 texture 1.0 = texture
+anim = -1 vertex 0.500000 material
+=
+material texture
+vertex
+frame = bone
+material
+vertex 1.0 = texture
+-1 0.500000 anim 1.0 -1 0.500000 0.500000 1.0 anim = 0.500000 vertex frame -1 0.500000 texture
+0.500000 1.0 anim =
+= vertex 0.500000 texture
+material texture
+bone 1.0 = anim = 0.500000 0.500000 material anim texture
+-1 -1
+bone 0.500000
+anim
+material texture
+=
+bone 1.0 1.0
+-1 = anim 0.500000 = -1 bone -1 frame -1 bone texture frame
+texture vertex anim frame bone material anim -1 = -1
+material -1
+-1 vertex 1.0 0.500000
+vertex 1.0 material -1 -1
+frame vertex texture -1 texture -1
+frame anim
+texture -1
+=
+vertex 1.0
+frame 1.0 vertex texture 0.500000 -1 anim bone material =
+bone anim bone
+material
+=
+bone = material
+frame texture texture -1
+1.0 1.0 anim
+bone vertex vertex anim vertex anim 0.500000
+-1
+0.500000 1.0 0.500000 0.500000 anim bone texture
+vertex frame
+=
+-1 anim =
+1.0 1.0 0.500000 frame
+vertex 0.500000 bone 0.500000 1.0 1.0 = 0.500000
+0.500000 anim texture material 1.0 0.500000 anim vertex =
+1.0 = =
+-1 bone 1.0 material -1
+1.0
+frame anim
+bone =
+frame 1.0 -1 0.500000 vertex 0.500000 1.0 bone anim -1 anim material
+material
+0.500000 0.500000 bone material -1 bone = 0.500000 bone texture bone anim = 1.0 1.0 material
+material bone texture frame frame texture = bone texture frame = 1.0 bone 0.500000 bone texture vertex vertex anim vertex bone bone frame
+vertex frame material material -1 frame bone anim frame
+frame texture -1
+anim 1.0 = bone 0.500000 = material material material 0.500000
+-1 bone
+texture
+vertex 1.0 bone vertex = -1 vertex texture frame
+-1 texture texture 0.500000 = vertex texture texture
+1.0 frame 1.0 anim anim bone material
+1.0
+-1 =
+vertex
+=
+bone vertex
+anim bone 1.0
+0.500000 material frame 1.0 texture -1 texture
+anim =
+1.0 -1 material vertex material
+texture = bone
+texture texture anim vertex texture
+= anim 1.0
+vertex material
+bone anim
+material 1.0 0.500000 vertex material
+1.0 frame material 1.0
+-1 0.500000 texture bone 0.500000 frame frame
+frame
+anim vertex
+bone 1.0 vertex anim anim material bone 0.500000 anim
+texture
+= bone bone bone
+=
+-1 anim bone texture texture -1 -1
+1.0 anim
+= texture =
+1.0
+= -1 frame
+bone 1.0 texture -1 anim frame texture 0.500000 frame =
+= -1 anim bone -1 anim -1
+1.0 = vertex 0.500000 material bone bone bone = frame texture material material frame 1.0 frame frame anim
+texture 0.500000 0.500000
+1.0 frame 1.0 =
+0.500000 1.0 vertex frame vertex
+0.500000 1.0
+=
+frame
+frame texture -1
+vertex frame 1.0 material
+= bone anim =
+bone =
+bone
+anim
+anim 0.500000 -1 0.500000
+= 0.500000 vertex bone frame material
+0.500000
+anim
+texture = -1 -1
+material frame frame material
+frame texture
+frame
+-1
+-1 material vertex =
+-1 material = material -1 anim vertex vertex
+material = = 1.0 frame = material
+anim vertex 1.0 -1 texture -1 1.0 -1
+material = anim 1.0
+vertex -1 -1 1.0 anim frame vertex texture anim texture material anim bone frame material texture
+1.0
+= =
+material 0.500000 texture -1 anim vertex
+-1
+-1
+vertex vertex material 1.0 1.0
+vertex -1 1.0
+bone = =
+0.500000 frame 1.0
+=
+= material
+vertex texture anim texture -1
+texture
+texture vertex texture -1 texture vertex material texture
+1.0 frame -1 vertex material
+1.0
+-1 texture
+= bone
+-1 0.500000 vertex
+-1
+= vertex texture =
+-1 material texture texture
+= anim
+0.500000
+=
+vertex
+0.500000 -1
+material -1
+bone
+0.500000 texture material texture 0.500000
+0.500000 0.500000
+texture frame
+material material material anim vertex texture bone texture
+vertex vertex material vertex bone bone 1.0 vertex 0.500000
+0.500000 texture = 0.500000
+= anim material bone
+bone 1.0 0.500000 bone
+texture anim 1.0
+frame 0.500000
+= 0.500000 -1 =
+0.500000
+vertex 1.0
+0.500000 material texture
+material =
+material vertex
+anim =
+bone 0.500000 material
+= = =
+0.500000
+material -1 0.500000 texture anim
+mate
\ No newline at end of file
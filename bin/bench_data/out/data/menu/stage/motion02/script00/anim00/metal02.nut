@@ -0,0 +1,316 @@
+anim frame frame
+texture vertex texture texture -1 frame
+-1 material material -1 frame texture bone
+material = 0.500000
+texture =
+bone = 0.500000 texture vertex 0.500000 texture
+texture bone 1.0 bone vertex 1.0 bone = material 0.500000
+0.500000 frame 0.500000 bone vertex = 1.0 1.0 anim bone
+texture
+0.500000 =
+0.500000 anim frame = material
+material
+bone
+texture texture
+-1 1.0 material
+bone anim texture anim
+anim anim
+anim -1
+vertex texture = vertex vertex vertex
+-1
+material
+-1 vertex = bone bone
+anim -1 anim
+1.0
+-1 frame bone
+frame bone
+-1 anim texture
+material frame material material frame 1.0 frame bone 1.0
+=
+=
+vertex
+material -1 anim -1
+material
+frame material vertex
+anim texture material frame = = 0.500000 1.0 material =
+-1 -1 frame bone
+-1
+anim frame 1.0 = anim -1 0.500000 vertex texture
+0.500000 -1 texture material material material = material 1.0 bone texture
+texture frame
+texture vertex material
+vertex
+-1 = bone material = bone material frame anim
+texture material anim vertex 1.0 frame = frame bone anim -1 1.0 1.0 -1 = vertex bone vertex
+= -1 -1
+texture vertex texture anim texture
+material bone anim bone -1 -1
+texture 1.0 texture texture frame
+= 0.500000 -1 texture texture = material
+= 0.500000 texture
+texture bone
+0.500000
+1.0
+bone 0.500000 vertex =
+anim 0.500000 -1 = vertex =
+-1 1.0
+-1
+-1 material bone
+= 0.500000
+anim
+0.500000 bone 1.0
+texture -1 vertex 0.500000 frame
+bone 0.500000 anim
+texture anim =
+= 1.0 anim -1 anim
+1.0 texture 0.500000
+texture
+bone -1 =
+material
+bone vertex -1 1.0 = 0.500000 vertex texture
+1.0 = vertex material texture
+frame
+1.0 0.500000 bone
+= material frame frame texture texture -1 bone frame vertex 1.0 = anim
+0.500000 texture 1.0 texture material = -1
+0.500000
+frame
+anim
+frame frame anim anim
+texture bone 1.0
+= material
+anim texture -1
+-1 texture = vertex frame 0.500000 1.0
+1.0 frame
+vertex vertex texture texture vertex = 0.500000 bone anim
+= texture 0.500000 -1 material
+1.0
+bone
+-1 1.0 -1
+texture
+vertex 0.500000 -1 -1 1.0
+frame
+-1
+texture -1 anim
+-1 0.500000 = -1
+vertex anim
+1.0 anim material -1 frame = 0.500000 material frame -1 = vertex
+-1 frame texture material anim material bone vertex 1.0
+= =
+0.500000 1.0
+anim -1 -1 = -1 frame -1 bone material texture frame anim frame
+texture
+frame 0.500000 frame material texture
+= 1.0 texture 0.500000
+0.500000 = material
+texture frame
+bone
+-1
+frame anim material vertex -1 bone 0.500000
+texture
+texture = vertex 0.500000 material = 0.500000 anim
+vertex
+texture
+-1 = = 1.0 texture
+material material -1 0.500000
+0.500000 frame -1 -1
+1.0 vertex -1 0.500000 frame -1 bone anim frame vertex texture = anim material bone frame
+texture texture
+vertex
+texture
+vertex
+anim = 1.0 frame anim texture frame -1 -1
+vertex frame bone vertex = frame
+texture =
+anim material
+-1 0.500000 anim
+= = material frame
+0.500000 1.0 vertex -1 -1
+anim anim
+anim frame 1.0
+vertex = frame 1.0
+material
+0.500000
+1.0 anim texture vertex
+texture anim 0.500000 1.0 =
+material vertex = anim 1.0
+frame anim
+anim vertex -1 vertex anim
+0.500000 1.0 0.500000 texture vertex frame
+= texture
+0.500000 material
+= vertex material
+=
+texture = texture texture
+texture = vertex -1 anim texture bone
+1.0 vertex
+vertex = frame texture frame = -1 frame bone anim vertex
+frame texture anim 1.0 material -1 0.500000
+0.500000 bone
+0.500000
+0.500000
+-1
+material material 1.0 -1
+0.500000 1.0 -1 -1
+bone bone 1.0 bone = = = 1.0
+material 1.0 bone 0.500000 = -1
+anim = bone vertex = texture -1 vertex -1 frame
+vertex = material material vertex anim texture
+-1 0.500000 texture texture 1.0 material material 1.0
+vertex
+material
+vertex
+texture
+1.0 = frame
+bone anim 1.0 anim bone bone texture anim
+-1 bone
+bone 1.0 vertex
+vertex texture frame
+1.0
+material
+bone
+vertex vertex
+texture 1.0 0.500000 texture
+anim 0.500000 anim material bone
+0.500000 = vertex texture -1 -1 texture 0.500000
+-1
+bone
+material vertex 1.0
+bone 1.0
+anim anim
+-1 anim texture 1.0 bone bone vertex
+= vertex 1.0 frame bone
+frame bone material 1.0 vertex
+vertex 0.500000 1.0 vertex
+1.0 -1 bone bone 1.0 frame bone
+anim
+material material 1.0
+bone frame material -1 = frame frame bone bone bone bone 0.500000 texture material material
+0.500000
+0.500000 frame anim 1.0
+bone -1 =
+bone 1.0 =
+texture texture
+0.500000
+-1 = 0.500000
+0.500000
+1.0 vertex texture
+frame
+anim 0.500000
+bone 0.500000 0.500000 1.0 bone
+texture -1 0.500000 bone
+1.0 anim
+texture
+=
+frame anim bone 0.500000 material
+vertex frame anim
+material anim anim frame material texture -1
+bone material
+1.0 vertex
+anim
+vertex
+= material 1.0 anim bone = -1 bone anim 0.500000 = -1 = 1.0 anim vertex -1 0.500000 texture material =
+1.0
+= vertex material = anim = texture vertex texture material
+1.0
+frame frame vertex 1.0 = bone bone
+frame
+frame
+1.0 = frame bone texture vertex =
+= vertex vertex anim vertex =
+bone = texture 0.500000 material anim
+vertex
+vertex vertex
+bone anim =
+= material
+texture
+bone -1
+1.0 vertex
+-1 0.500000 -1 bone 1.0 =
+0.500000 frame bone = 1.0 frame frame
+texture -1
+frame -1
+frame = material frame -1 frame
+anim 0.500000 vertex bone
+vertex
+frame = material
+-1 anim 0.500000 1.0 bone
+bone 0.500000
+vertex 0.500000
+material
+bone anim
+= frame
+vertex 1.0
+anim
+texture 0.500000 anim = vertex
+frame bone material 1.0 bone frame frame
+frame
+anim
+0.500000 0.500000 1.0
+0.500000
+anim 0.500000 0.500000 frame = texture vertex
+vertex anim anim texture -1
+-1 1.0 texture material -1 =
+anim texture texture bone anim =
+0.500000 bone bone
+bone anim = -1 anim
+0.500000 vertex
+frame bone -1 -1 1.0
+material anim frame vertex texture -1 0.500000 1.0 1.0 anim -1
+bone
+bone texture
+1.0 -1 bone texture = 1.0 = bone = texture
+frame 0.500000
+vertex -1 material material vertex frame
+texture frame material anim = material
+=
+texture =
+1.0 frame -1 material 1.0 =
+0.500000 frame -1 frame anim
+= -1 material bone 0.500000 vertex -1
+1.0 bone vertex material frame
+-1 = anim material material bone
+1.0
+material = frame frame bone material anim
+frame 1.0 bone = -1 anim frame material anim
+= texture vertex
+-1 0.500000 1.0
+anim bone = vertex bone texture material -1 material anim frame
+0.500000 0.500000
+material anim vertex anim
+1.0 -1 anim frame 1.0 0.500000 1.0 1.0 1.0 anim vertex bone
+anim -1
+bone
+frame material vertex anim texture 1.0 =
+0.500000
+frame anim
+vertex 1.0 texture vertex
+0.500000 bone texture -1
+material vertex
+-1 frame anim 0.500000 frame vertex -1 frame vertex texture
+anim 0.500000 0.500000 = texture 1.0 anim 0.500000 0.500000
+1.0 anim material material = anim frame
+vertex material 1.0 0.500000 material -1 bone texture material
+1.0
+= frame
+1.0
+frame
+frame -1 = 0.500000 anim
+material = material 0.500000 frame
+0.500000 frame
+frame
+= texture material
+=
+vertex 0.500000 frame bone
+-1 anim -1
+frame anim 1.0 -1 anim bone 0.500000
+material material -1 bone
+bone
+0.500000
+1.0 1.0 =
+material
+vertex frame frame 1.0 texture vertex = bone
+bone material
+1.0
+-1 vertex vertex
+f
\ No newline at end of file
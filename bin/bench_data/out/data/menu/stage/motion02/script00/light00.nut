@@ -0,0 +1,154 @@
+= vertex frame -1 1.0 1.0 0.500000 bone vertex
+-1 material material = frame
+0.500000 bone -1 bone anim -1 bone 0.500000
+vertex
+material
+bone bone texture
+0.500000 bone -1 bone
+-1 -1 -1 1.0
+anim = texture
+texture 1.0 material frame anim bone
+frame bone
+texture
+material texture -1 texture
+-1
+vertex 1.0 anim material bone anim texture 1.0
+vertex frame material texture
+anim
+frame 1.0 1.0 texture
+bone
+= anim 0.500000 frame
+material 1.0 material anim bone anim bone 0.500000 1.0 bone frame 0.500000 anim anim -1
+-1 texture texture frame frame texture 0.500000 bone vertex
+frame bone 0.500000 vertex material
+1.0 = 1.0
+1.0 vertex anim 0.500000 bone texture texture material
+-1
+vertex = 1.0 -1 frame vertex anim anim anim 1.0
+= anim bone
+0.500000 bone 0.500000 0.500000 anim material anim 1.0 -1 vertex
+anim
+0.500000 material bone -1 bone -1 1.0 texture 0.500000
+vertex texture frame
+material
+bone -1 material
+=
+-1
+material
+anim = texture bone anim texture vertex frame
+anim -1
+frame 1.0 0.500000 material
+0.500000
+bone
+texture vertex
+-1 = 1.0 material =
+material frame vertex texture
+frame anim
+texture
+frame vertex material texture texture -1 -1 texture vertex -1 anim texture vertex 0.500000 anim =
+1.0 1.0 1.0
+0.500000 vertex vertex 1.0 vertex
+1.0 material bone anim =
+texture bone -1 frame 0.500000 0.500000 0.500000 -1 1.0
+= bone 1.0 vertex
+-1 vertex = texture =
+1.0 frame 0.500000 =
+material
+bone anim bone
+=
+anim bone -1 vertex
+bone anim anim frame anim
+frame bone
+anim 0.500000 material bone
+1.0 texture bone frame -1 -1
+= -1 1.0 1.0 vertex
+vertex texture frame frame frame
+1.0 -1 vertex anim -1
+0.500000 vertex bone 1.0 1.0
+-1 material frame frame material texture frame frame frame anim vertex texture
+texture = =
+material vertex
+frame bone vertex bone = 1.0 -1 bone 0.500000 material vertex -1 frame -1 vertex material
+frame texture 0.500000
+anim anim material frame -1 anim
+0.500000
+texture -1
+frame texture frame material
+anim
+anim 1.0 anim = = vertex bone
+0.500000 bone -1 1.0 -1 =
+texture vertex material -1 1.0 texture
+-1
+0.500000 -1 = -1 material 0.500000 0.500000 bone 0.500000 0.500000 frame frame 0.500000 -1 material
+texture bone
+frame 0.500000 material
+texture frame
+frame
+1.0 anim
+bone 1.0
+material
+frame
+frame
+-1
+bone 0.500000 frame vertex 1.0 -1 1.0 texture
+material texture -1
+anim frame bone texture bone -1
+anim
+-1 0.500000 anim
+1.0 texture
+0.500000 texture 0.500000 frame anim texture texture 1.0
+vertex 0.500000
+0.500000 vertex 1.0 texture 0.500000 1.0
+vertex = texture bone vertex
+frame
+material frame vertex 0.500000 -1 -1 bone vertex anim anim frame = texture
+1.0 anim
+material anim -1 bone 0.500000
+texture
+bone
+=
+material vertex
+vertex frame 0.500000 frame texture vertex texture vertex texture -1 anim
+anim frame
+vertex frame
+texture 0.500000 texture = vertex texture bone frame 0.500000
+texture bone 0.500000 bone 0.500000
+bone 0.500000 material bone
+bone material anim 1.0
+frame
+= anim
+material material anim vertex = bone 1.0
+vertex bone
+1.0
+vertex material frame -1
+texture -1
+0.500000 texture 1.0
+anim
+=
+texture bone
+0.500000 -1
+-1 frame vertex = 0.500000 = material texture anim 0.500000 anim
+= = 1.0 anim
+1.0
+frame 0.500000 -1 anim bone material texture frame
+frame vertex texture material material 0.500000
+material = 1.0 anim vertex
+=
+material
+material 1.0 1.0 0.500000 0.500000
+vertex 1.0 =
+1.0
+0.500000 -1 0.500000 material =
+anim = -1 -1 frame material 0.500000 frame material
+bone -1 -1 anim frame frame -1
+-1 bone = 1.0
+vertex
+vertex texture 0.500000 material = -1
+material
+frame = material 1.0
+-1 frame = vertex anim
+anim anim material texture frame texture
+frame vertex material 1.0
+material =
+texture
+vertex vertex -1 text
\ No newline at end of file
@@ -0,0 +1,5 @@
+= bone anim
+= material 0.500000 material
+material
+frame bone texture
+v
\ No newline at end of file
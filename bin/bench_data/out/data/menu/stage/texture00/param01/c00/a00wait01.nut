@@ -0,0 +1,179 @@
+anim anim
+= vertex
+0.500000 material texture material material 0.500000 material
+material 1.0
+vertex
+1.0
+0.500000 1.0
+-1 = -1 texture
+material -1 material anim texture bone frame
+texture anim vertex
+anim 0.500000 vertex
+0.500000 anim bone material anim
+= -1 1.0
+frame frame texture
+frame 0.500000
+vertex frame
+vertex texture bone texture
+frame
+0.500000 vertex texture
+bone
+0.500000 -1 -1 vertex 1.0
+material
+frame 0.500000 bone material anim material
+1.0 = =
+= 1.0 0.500000
+material frame material 0.500000
+texture -1
+bone anim
+material material 1.0 -1 1.0
+material frame
+0.500000 anim 1.0 0.500000 material -1
+1.0 frame vertex -1 vertex vertex texture bone vertex
+bone frame bone
+0.500000 anim texture
+1.0 -1 frame bone
+1.0 material frame -1
+vertex
+bone vertex vertex -1 1.0 -1 1.0
+= frame
+material = texture frame material anim = -1 anim frame -1 -1 texture 0.500000 material anim frame
+bone -1 -1 material 0.500000
+texture vertex material
+anim anim = 1.0 frame
+texture =
+bone = 1.0 -1 bone 0.500000 frame material
+anim material = = material texture material material anim 0.500000
+bone texture -1 material frame material texture =
+bone texture
+= material =
+frame texture anim texture texture material
+texture
+= texture anim bone -1
+anim anim 0.500000 material 0.500000 1.0
+-1 = 1.0 0.500000 bone anim texture
+bone 1.0 -1 anim material bone 1.0 texture 1.0 0.500000
+material frame 0.500000
+= vertex
+frame anim material -1
+1.0 bone vertex bone 0.500000 bone
+bone
+bone texture 1.0 0.500000 frame
+-1 vertex texture material
+0.500000 1.0 -1 bone 1.0 anim -1 material
+texture anim 0.500000 1.0 material frame
+-1 = 0.500000 texture vertex texture bone
+anim 1.0 texture bone 0.500000 anim texture
+anim material
+vertex -1 -1 bone bone texture 0.500000 frame
+bone material 1.0 1.0 0.500000 0.500000
+1.0 material material bone anim 0.500000 0.500000 material anim 1.0
+material -1 -1 material
+texture 1.0 bone 1.0
+frame
+1.0 bone material
+anim
+anim frame bone frame anim material 1.0 frame
+material frame =
+0.500000
+anim texture
+texture -1 =
+anim
+material
+anim 0.500000 material anim vertex
+texture 1.0
+0.500000 -1 material texture
+vertex 1.0 1.0 = 1.0 0.500000 frame 1.0 bone 1.0 0.500000 0.500000 1.0 = -1 anim vertex vertex 0.500000
+= material vertex = bone texture anim material
+0.500000 0.500000 material material
+1.0 bone vertex frame bone
+anim bone material
+1.0 material 0.500000 anim
+texture vertex = = anim 1.0
+0.500000 material 0.500000
+-1 1.0 texture -1 bone
+0.500000 texture =
+bone =
+bone =
+-1
+1.0 1.0 vertex anim = 0.500000 vertex frame bone -1 anim material
+bone vertex 1.0
+frame bone bone -1
+frame material anim anim material
+anim 1.0 -1 -1 vertex anim 1.0 1.0
+1.0
+texture
+texture 1.0 material
+0.500000
+1.0 texture vertex
+0.500000 texture bone
+0.500000 = anim bone vertex
+-1 bone
+1.0 -1
+frame 1.0
+= = 1.0 texture -1 material anim
+0.500000 -1 0.500000 material
+vertex
+texture 0.500000 vertex anim
+vertex
+material anim frame vertex material frame
+vertex bone
+-1 1.0 anim =
+texture
+material -1 material
+material
+material 1.0 texture 0.500000
+texture texture bone anim frame bone material vertex bone material vertex
+vertex frame
+texture 0.500000
+frame
+-1
+material 0.500000
+1.0 anim
+vertex vertex frame
+frame
+anim bone
+material = material bone material material = texture texture
+texture
+texture frame vertex frame anim -1 frame texture 1.0 -1 vertex 0.500000 0.500000 frame material material bone 1.0
+vertex
+material texture 1.0 -1
+-1 vertex -1 =
+1.0 -1
+-1
+-1
+= texture texture 1.0 1.0 texture
+anim anim bone vertex bone
+vertex 1.0
+material 1.0
+-1
+material -1 bone frame
+anim 0.500000
+-1 texture
+= = texture
+-1
+0.500000 material
+1.0
+anim
+= 0.500000 texture
+anim 0.500000 bone 1.0 frame material 0.500000 -1 vertex
+0.500000
+= =
+1.0
+vertex
+1.0 material -1
+texture bone
+anim vertex anim
+anim
+vertex
+= vertex
+0.500000 anim bone bone bone
+frame frame 0.500000 bone material anim =
+vertex frame vertex 0.500000 bone material frame
+material =
+anim texture material material
+frame
+bone
+-1 vertex texture
+frame
+0.500000 1.0 texture -1 texture 1.0
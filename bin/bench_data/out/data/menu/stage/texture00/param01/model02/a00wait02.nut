@@ -0,0 +1,32 @@
+vertex
+frame texture frame anim bone vertex 1.0 material -1 frame frame = texture = frame = 1.0 bone frame anim
+0.500000
+anim anim = material
+material -1 0.500000 bone frame frame anim material vertex texture
+= anim texture
+texture -1 frame
+-1 texture = anim bone vertex
+-1 -1
+texture bone
+material
+1.0 -1 1.0
+frame -1
+-1 = bone
+texture = bone
+frame
+-1 frame
+1.0 0.500000 1.0 = anim anim 0.500000 = bone
+texture
+-1 texture bone 1.0 = -1 anim bone -1 1.0 anim =
+-1
+-1 0.500000
+bone frame
+= -1
+= material 0.500000 1.0 material material
+-1 vertex texture frame
+0.500000 = frame 0.500000 -1 vertex -1 anim
+1.0 vertex frame
+vertex 0.500000
+= 1.0
+=
+anim frame 1.0 
\ No newline at end of file
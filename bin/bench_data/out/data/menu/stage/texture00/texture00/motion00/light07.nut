@@ -0,0 +1,12 @@
+0.500000 material 1.0 1.0 anim frame = 1.0 bone
+0.500000 vertex 0.500000 material material = -1 frame anim bone anim vertex material anim material material material
+material
+bone 0.500000
+vertex
+bone = = material
+vertex
+bone
+-1 material
+anim 1.0 0.500000 bone anim material
+0.500000 texture 0.500000 texture 1.0 texture frame
+frame vertex 
\ No newline at end of file
@@ -0,0 +1,5 @@
+anim material = texture frame
+vertex = frame anim material bone -1 anim
+frame 1.0 1.0 vertex
+frame 0.500000 anim anim 0.500000 vertex texture
+= vertex bone texture = material 1.0 = anim -1 texture 0.500
\ No newline at end of file
@@ -0,0 +1,6 @@
+texture vertex -1 0.500000 1.0 texture texture anim = = -1 1.0
+0.500000 1.0
+= texture 0.500000 texture
+frame anim = bone 1.0
+0.500000 anim
+=
\ No newline at end of file
@@ -0,0 +1,23 @@
+material
+texture bone anim bone vertex texture = 1.0
+texture bone -1 -1
+vertex frame 0.500000 -1 bone
+frame 1.0 = texture frame
+-1 frame =
+bone anim
+texture = 0.500000 = -1 bone frame frame bone frame = material material
+frame
+0.500000 bone vertex
+-1 frame anim anim anim texture 0.500000 = -1 anim =
+0.500000
+0.500000 1.0 vertex texture 1.0 texture -1
+vertex
+bone anim 0.500000 -1 0.500000
+anim texture vertex 1.0 1.0 bone bone -1 = texture material texture vertex vertex material texture bone
+bone =
+anim bone 0.500000 0.500000 texture -1
+-1 bone
+anim
+anim anim -1 bone texture -1
+0.500000
+material bone text
\ No newline at end of file
@@ -0,0 +1,12 @@
+= texture -1 -1 1.0 frame
+material bone 0.500000 texture 0.500000 0.500000 material -1 = 0.500000 -1
+0.500000 1.0 bone material frame bone
+anim
+0.500000 anim bone texture material frame 1.0 = anim frame
+material frame 1.0 1.0 -1 frame
+vertex
+bone material texture material
+1.0 frame bone -1 vertex
+texture anim vertex vertex = 1.0 = = 0.500000 bone material bone
+-1 frame 1.0 = anim texture
+anim vertex frame 
\ No newline at end of file
@@ -0,0 +1,6 @@
+bone
+material = bone -1 vertex bone 1.0
+anim texture bone texture
+-1 bone 0.500000 0.500000
+material -1 frame 1.0 -1
+material material
@@ -0,0 +1,160 @@
+bone frame anim = 0.500000 texture
+anim 1.0 texture 0.500000 frame
+0.500000 bone 0.500000 -1
+anim anim 0.500000 anim 0.500000 0.500000
+0.500000 texture material frame 0.500000 -1 = 1.0 vertex
+1.0 -1 vertex bone vertex
+vertex
+-1 material anim texture texture texture -1 1.0 frame -1 bone vertex bone frame -1 frame material
+texture 1.0 bone 0.500000 material texture -1 -1 0.500000 material anim 1.0 bone material 1.0
+texture 1.0
+material = -1 bone
+frame = material
+material
+0.500000 vertex bone -1 frame
+material bone
+= vertex anim anim
+=
+1.0
+anim
+material 1.0 = frame -1 1.0
+material frame texture = material 1.0
+anim
+1.0 texture material bone
+vertex vertex =
+-1 texture anim bone vertex 0.500000 material 0.500000 bone
+= 1.0 -1 -1 bone vertex -1 vertex vertex bone =
+bone
+material
+-1 anim frame anim 1.0 frame
+0.500000 vertex texture 0.500000
+0.500000 texture texture
+0.500000 vertex
+material anim -1 -1 frame
+anim texture texture
+anim material 0.500000
+-1 frame 0.500000
+bone 1.0
+-1 bone
+0.500000
+1.0 vertex anim -1 bone -1 frame material bone
+0.500000 texture anim material -1 material
+bone
+bone frame
+frame material
+material
+0.500000 texture -1 bone = vertex material
+bone
+bone -1 1.0 frame material 1.0
+frame
+texture
+texture
+vertex texture anim anim anim 1.0 -1 =
+bone
+material texture vertex vertex -1 vertex 0.500000 bone =
+anim bone
+bone anim material frame = material -1 frame texture texture texture
+material -1 = 1.0
+texture anim frame -1 vertex
+0.500000 0.500000 -1
+bone texture -1 -1 -1
+0.500000 0.500000 = 1.0 bone 0.500000 frame frame material
+vertex
+anim bone = =
+anim bone vertex
+frame -1 = 1.0 frame bone
+frame frame = bone anim bone -1 0.500000
+material anim texture 1.0 frame vertex
+anim vertex 1.0 anim 0.500000 frame = -1 1.0
+frame bone -1 = -1
+anim 0.500000 -1
+0.500000 -1 bone 1.0 material vertex 0.500000 0.500000 -1 0.500000
+texture anim
+= texture
+texture 0.500000 material frame anim 0.500000
+0.500000 -1 -1 1.0 vertex bone =
+vertex = vertex 1.0 frame
+material texture
+frame frame
+0.500000 1.0
+= material vertex bone 0.500000 = bone = -1 texture vertex 0.500000 0.500000 vertex -1 vertex 1.0
+texture texture vertex frame bone -1 anim frame 1.0 anim bone frame material 1.0 anim texture vertex anim
+1.0 anim anim vertex frame
+1.0 = bone
+= texture material
+material material 1.0 1.0 -1
+frame
+anim
+= 0.500000
+anim frame vertex vertex material = vertex 0.500000 vertex 0.500000 vertex texture texture texture
+-1 texture material -1 -1 material = texture
+bone 1.0
+-1 frame bone anim =
+bone vertex material frame texture anim anim 0.500000 1.0 material anim 1.0
+0.500000 -1 frame material
+frame 0.500000 anim vertex 1.0
+anim
+material 1.0 1.0 anim 0.500000 texture material = anim texture frame
+vertex
+0.500000 anim
+-1
+bone
+frame material 1.0 0.500000 = vertex anim bone -1
+material 0.500000 bone texture = 0.500000 1.0 =
+anim anim frame frame vertex
+= bone
+= 1.0 = 1.0 material frame 0.500000 frame bone =
+1.0
+material frame
+=
+-1 1.0 0.500000
+frame
+1.0 0.500000 vertex 1.0 1.0 material material 0.500000
+frame
+texture
+vertex 0.500000 material material 1.0
+bone vertex = -1 =
+1.0
+0.500000 bone -1 bone material bone = texture material 0.500000 vertex bone
+-1
+bone
+bone
+texture
+1.0 0.500000 texture material
+texture texture material
+bone
+texture bone
+material vertex vertex bone frame = vertex
+anim 1.0
+anim 1.0 bone -1
+0.500000 1.0
+-1
+material = = 1.0 texture 0.500000 bone = frame
+anim -1 -1 frame 1.0 texture
+0.500000 material 1.0 texture 0.500000 = = vertex vertex 0.500000 1.0 1.0 -1 bone texture texture bone
+= =
+= 1.0
+bone material material 1.0
+0.500000
+texture
+= material
+bone
+bone
+frame 0.500000 0.500000 anim material frame -1 anim anim material
+texture vertex vertex material bone bone = vertex bone texture bone texture 1.0 -1 material frame texture -1 -1 -1 1.0 = texture
+vertex
+0.500000 0.500000 texture
+bone 0.500000
+-1 anim
+=
+0.500000 material bone 0.500000
+frame
+texture -1 material 0.500000
+texture -1 0.500000 = frame vertex 0.500000 bone frame
+anim anim frame anim frame vertex texture 1.0 bone bone
+bone -1
+texture = texture anim texture
+vertex = vertex -1 0.500000 frame -1 bone
+vertex 0.500000
+material
+texture bone anim material 
\ No newline at end of file
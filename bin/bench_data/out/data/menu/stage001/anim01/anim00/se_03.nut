@@ -0,0 +1,41 @@
+0.500000
+frame frame bone 1.0
+-1 = bone anim = vertex frame 0.500000 = material
+anim anim
+0.500000
+bone frame texture bone
+frame vertex texture anim -1 material vertex vertex bone anim bone texture = -1 texture material bone bone 0.500000 material
+0.500000 texture texture frame
+0.500000 -1 vertex
+1.0
+material bone material -1
+0.500000 anim material material texture vertex
+-1 material frame
+anim -1 texture 0.500000 0.500000 frame
+vertex 0.500000 0.500000 anim
+-1
+bone = bone -1
+material
+-1 -1 -1 1.0 material texture texture
+= bone
+-1 material vertex vertex
+= 0.500000 0.500000 frame 0.500000 0.500000 1.0 -1 = material
+texture
+material vertex material
+material vertex vertex
+= 0.500000 material
+frame
+1.0
+bone -1 bone material
+bone 0.500000 anim frame bone bone anim texture
+bone material anim 0.500000
+vertex -1 frame = 1.0 vertex vertex anim frame 1.0 anim texture
+vertex = material vertex frame -1 texture 0.500000 1.0
+-1 1.0 1.0 1.0 material
+=
+0.500000
+anim = texture 1.0 0.500000 texture vertex frame bone
+anim
+texture material -1 -1 bone anim 1.0 = 0.500000 texture anim = anim anim
+frame -1
+vertex fram
\ No newline at end of file
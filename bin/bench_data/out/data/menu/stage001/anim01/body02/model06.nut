@@ -0,0 +1,10 @@
+vertex frame 0.500000 texture vertex 1.0
+-1
+vertex vertex
+bone frame
+vertex 0.500000 vertex bone texture material
+frame 0.500000 texture -1 bone
+vertex vertex anim frame anim = 0.500000 frame anim 1.0 anim
+= anim -1 vertex
+bone anim = texture -1 vertex
+texture vertex anim
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone frame
+1.0
+anim -1 material anim material
+1.0 frame texture
+= texture ve
\ No newline at end of file
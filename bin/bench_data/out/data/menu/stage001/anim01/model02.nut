@@ -0,0 +1,310 @@
+texture frame 0.500000 bone
+texture
+=
+vertex
+material 1.0 bone texture 0.500000 texture
+1.0 vertex material texture 1.0
+bone 0.500000 anim texture 1.0
+=
+bone 1.0 material
+material
+1.0 anim frame 0.500000 0.500000 material material 1.0
+material frame bone
+0.500000 frame anim 0.500000
+texture anim 0.500000 bone anim 0.500000 -1 bone vertex
+material vertex = frame anim
+frame =
+material
+0.500000 vertex anim anim bone
+texture -1 texture material -1
+bone 0.500000 -1 bone frame texture -1
+frame
+-1 bone bone bone
+bone = frame vertex frame texture 0.500000 -1 0.500000
+= -1 1.0 0.500000 vertex -1 0.500000 1.0
+texture
+texture =
+frame
+1.0 = bone
+vertex bone
+vertex anim texture
+material texture = = texture texture anim -1
+frame anim anim
+0.500000
+-1 -1 bone vertex texture 1.0 = 0.500000 anim
+texture
+frame bone
+bone 1.0 bone
+= texture 1.0 vertex = anim material
+1.0 vertex texture bone texture 0.500000
+texture 1.0 texture
+texture vertex vertex texture
+material vertex
+= anim frame
+bone = anim vertex = bone material 1.0 material bone texture vertex material -1 0.500000 material material 1.0 bone anim vertex
+material vertex = -1 material bone 1.0
+anim texture
+-1 -1 1.0 frame
+-1 bone bone
+frame texture bone bone = 1.0 = material anim
+=
+material bone anim texture = = anim
+material material anim vertex = bone frame
+0.500000 1.0
+0.500000 = texture frame
+material -1 0.500000 -1 vertex
+frame
+texture texture = 0.500000 -1
+vertex texture
+0.500000 0.500000 -1
+bone vertex 1.0 bone texture frame = -1 bone vertex
+vertex vertex 1.0 1.0
+bone frame -1 texture texture 0.500000 = anim
+bone vertex bone bone
+vertex bone material material texture frame
+frame frame = bone bone
+-1 = texture material texture 0.500000 texture -1 texture frame = 0.500000 1.0 texture material frame vertex anim bone frame
+= 0.500000 -1 texture -1 frame
+1.0 vertex 0.500000 texture 1.0
+bone 1.0
+vertex anim = bone material anim = vertex
+texture 1.0 -1
+0.500000 texture 0.500000
+texture
+vertex 1.0 texture vertex = 1.0 = vertex
+material
+0.500000
+= 0.500000 frame frame
+vertex -1
+texture frame
+1.0 0.500000
+frame bone -1
+texture
+vertex 1.0 = -1 anim
+0.500000 texture = bone texture -1 = texture anim vertex -1 material texture anim anim texture -1 frame -1 texture
+texture frame texture 1.0
+-1
+texture bone
+0.500000
+bone frame
+1.0
+material =
+-1
+material bone frame 0.500000 texture bone
+material texture frame material bone
+0.500000 0.500000
+material = frame texture bone bone vertex frame
+bone material
+texture 1.0 -1 -1 material bone anim texture
+material
+1.0 =
+texture 1.0 texture vertex 0.500000 texture frame
+vertex 0.500000 texture
+vertex texture material
+0.500000
+texture material -1 texture
+texture material 1.0
+bone
+1.0
+vertex 1.0
+0.500000 -1 vertex vertex material 1.0 material 1.0 vertex anim bone
+= 1.0 0.500000 = vertex
+-1 0.500000
+bone anim -1 material material
+-1
+-1
+vertex = vertex
+texture anim 1.0
+bone bone = texture -1 texture 0.500000
+material vertex anim material
+material material = -1 material texture = = vertex material material 1.0
+frame
+material
+0.500000
+bone
+vertex
+vertex material material -1 1.0 -1
+texture 0.500000 vertex 1.0
+anim vertex 0.500000 1.0 = 0.500000
+material material vertex bone anim texture material texture texture bone frame = -1 anim
+material frame
+-1 vertex
+= texture bone anim material -1 material = -1 vertex material texture material anim bone anim frame bone -1 1.0
+=
+= 1.0 vertex vertex 0.500000 0.500000 vertex anim texture 0.500000
+material
+texture -1
+0.500000 vertex vertex
+frame vertex =
+1.0
+vertex
+texture material 1.0 texture texture = anim
+anim
+anim anim bone 0.500000 bone = texture vertex texture texture 0.500000 material vertex
+texture 0.500000 1.0 -1 anim anim vertex anim 1.0
+-1 frame 0.500000 material bone material
+bone anim
+texture
+-1
+vertex -1
+vertex
+vertex =
+1.0 bone
+anim vertex = material =
+anim anim 0.500000 0.500000
+anim frame
+material
+0.500000
+frame 0.500000
+= texture
+1.0 material -1 1.0 texture 1.0 material frame
+bone texture -1 = 0.500000 = vertex anim 1.0
+1.0 = 0.500000 material -1
+vertex vertex
+vertex material anim frame material 0.500000
+anim vertex material 1.0 0.500000 1.0 bone material
+material bone frame -1
+bone texture vertex texture 1.0
+vertex frame texture 0.500000 anim 0.500000
+bone material anim
+frame
+1.0
+texture bone frame
+material bone
+material frame material anim anim
+material texture material texture -1 anim 0.500000
+-1 bone -1 anim
+anim material bone material
+bone texture
+bone
+material
+-1 vertex material 1.0 texture 0.500000
+frame = 0.500000 0.500000 texture
+-1
+vertex = texture bone bone
+vertex material
+texture material 0.500000 = vertex vertex 0.500000 1.0 material material anim
+-1 1.0 -1 vertex frame 0.500000 material
+texture 0.500000
+texture texture texture bone -1 vertex anim texture
+= texture
+frame bone 0.500000 -1
+vertex 0.500000 anim 0.500000 =
+= material = vertex vertex
+vertex bone
+1.0 bone
+-1 0.500000
+anim
+anim 1.0 vertex -1 -1 1.0 bone -1 bone 1.0 texture
+texture
+material material
+material
+frame 1.0 material 1.0 0.500000
+anim = vertex texture anim -1 0.500000 material
+material anim material texture 1.0 -1 frame =
+vertex material -1 vertex texture
+=
+vertex -1
+-1 -1
+0.500000 vertex
+-1
+texture 1.0
+-1 anim 0.500000 1.0 bone bone material
+vertex texture
+frame vertex
+= vertex
+anim = material texture = bone
+1.0 = anim 1.0
+0.500000 frame vertex frame frame =
+= anim anim bone vertex
+vertex
+frame
+=
+anim
+vertex 1.0 = = bone texture -1 material anim
+=
+-1 = material = 0.500000 bone
+-1 bone vertex vertex -1 0.500000 texture
+vertex
+anim material frame bone anim
+frame vertex material
+material frame anim 1.0 0.500000 material vertex 0.500000 frame
+1.0 1.0 vertex
+anim =
+-1 frame texture
+1.0 0.500000 bone
+material bone
+1.0 -1 vertex 0.500000 anim -1 = bone = material = anim material 0.500000 texture 0.500000 material vertex bone texture texture
+1.0
+bone
+material anim -1 anim bone anim =
+material = anim -1 -1 anim 1.0 0.500000 bone
+vertex material 0.500000 1.0 material anim -1 0.500000 vertex
+-1
+frame 1.0
+anim
+anim
+vertex texture = 1.0
+-1 bone vertex
+0.500000 vertex
+= -1
+anim = texture
+-1
+0.500000 anim
+-1
+0.500000
+1.0 1.0 material vertex texture
+anim material frame = 0.500000 frame vertex anim texture
+-1 material bone
+frame = material -1 frame 1.0 frame anim material
+1.0 0.500000 material frame 0.500000 1.0 texture 0.500000
+frame
+bone anim material
+vertex vertex frame anim
+bone 0.500000 vertex vertex material
+bone texture texture 1.0 anim -1 =
+= anim 1.0 1.0 bone 1.0 material frame anim vertex 0.500000 anim 1.0 0.500000 0.500000
+1.0 0.500000 =
+anim =
+texture = frame frame = = =
+-1 0.500000 1.0 texture
+material
+frame -1 0.500000 texture 1.0
+anim 0.500000 texture 0.500000 bone bone frame
+bone =
+frame
+frame
+bone
+= texture
+0.500000 texture 1.0 texture = = 0.500000
+vertex bone texture texture -1 -1 vertex 0.500000 vertex frame = vertex texture
+anim
+-1 anim 1.0 anim = vertex -1
+material
+bone
+0.500000 frame 1.0 1.0 0.500000
+0.500000 material texture = texture = 0.500000
+-1 -1 texture frame texture
+material
+vertex vertex anim material 1.0 -1 bone
+= texture texture
+anim
+anim -1 bone -1 texture material =
+1.0 anim anim
+vertex anim = texture
+vertex vertex
+texture 0.500000
+-1 vertex 1.0 material frame material
+= texture anim 1.0 -1
+= vertex vertex vertex vertex 1.0 =
+vertex
+1.0 anim material material anim bone texture
+frame texture anim material material -1 =
+bone vertex = = -1 vertex
+bone frame bone
+0.500000
+anim bone bone
+= -1 -1 0.500000 1.0 = texture -1 frame
+vertex
+texture vertex 1.0 bone material bone
+0.500000 texture -1 anim frame = texture texture vertex vertex mate
\ No newline at end of file
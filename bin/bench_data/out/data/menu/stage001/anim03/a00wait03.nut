@@ -0,0 +1,63 @@
+material
+vertex -1 vertex anim vertex anim
+texture 1.0 1.0 1.0
+-1 0.500000 texture 0.500000 vertex vertex bone
+bone bone -1
+0.500000 material -1 = bone material material anim anim 1.0 vertex
+bone
+-1 vertex texture
+frame texture 1.0 0.500000
+vertex
+1.0
+vertex material anim texture
+bone 1.0 1.0 vertex frame bone
+0.500000 -1 = material = frame 1.0
+anim -1
+frame 0.500000 = vertex
+0.500000
+bone material vertex bone anim vertex
+bone texture vertex -1 anim anim 0.500000 anim
+vertex 0.500000 texture
+frame
+vertex material frame
+vertex anim 1.0
+1.0 frame anim texture
+0.500000 bone = texture material 0.500000
+0.500000 -1 -1 material -1 anim -1 anim 1.0 material
+anim frame vertex =
+-1 texture anim bone 0.500000 1.0 frame 1.0
+0.500000 anim = frame frame 1.0 = vertex frame
+=
+texture
+vertex bone material
+vertex -1 -1 frame -1 texture
+vertex
+vertex
+-1
+vertex anim -1
+1.0 bone
+bone frame texture
+1.0 material
+frame 1.0 vertex 0.500000 1.0
+0.500000
+-1
+bone frame
+bone
+vertex
+frame texture
+anim frame material 0.500000 1.0 = material texture -1 -1
+bone bone
+bone vertex anim 1.0 -1
+frame texture vertex 0.500000 1.0 material bone anim material = frame
+bone vertex
+1.0 0.500000 -1
+vertex vertex
+material -1
+bone
+texture =
+vertex 1.0 0.500000 -1 0.500000 0.500000 frame 1.0 1.0 anim 0.500000
+frame
+0.500000 material vertex texture 1.0 anim 0.500000 0.500000
+vertex frame
+texture 1.0 material anim -1 = 1.0
+-1 texture -1 bone -1 frame anim 1.0 anim -1 anim anim ani
\ No newline at end of file
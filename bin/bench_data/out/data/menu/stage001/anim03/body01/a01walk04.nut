@@ -0,0 +1,5 @@
+anim material 1.0
+0.500000 bone
+0.500000 0.500000 = frame material material 0.500000 material
+anim = 1.0 bone 1.0 -1 material bone
+-1 materi
\ No newline at end of file
@@ -0,0 +1 @@
+_݁>lgzH%]ЛձQ>w/nǗg~JwuGHZD~WqZe8pjaFpY+KoG"dcv gCnb']jT'cS"/2	T
\ No newline at end of file
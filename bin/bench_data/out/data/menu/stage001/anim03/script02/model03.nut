@@ -0,0 +1,156 @@
+-1 0.500000
+-1
+anim anim
+vertex
+anim =
+-1 texture texture =
+material material vertex material = -1 bone
+anim vertex
+bone -1
+bone -1
+texture
+-1 0.500000
+anim -1 0.500000 bone
+0.500000 -1
+1.0
+0.500000 frame
+-1 anim 0.500000 bone 1.0 frame
+anim vertex = frame
+vertex vertex vertex material
+0.500000 1.0 anim
+vertex material
+texture
+material material frame texture
+frame
+material texture
+bone material
+= bone material
+material 1.0 texture
+0.500000 texture
+frame -1
+vertex bone bone
+= -1
+material material texture -1
+frame material anim
+bone anim = bone anim 1.0
+= anim
+bone 1.0 1.0
+0.500000 frame = material material = bone
+-1 material vertex 1.0
+anim bone 1.0 vertex 1.0 material vertex
+material
+texture texture texture
+1.0 anim 0.500000 0.500000 vertex
+1.0
+frame
+bone
+1.0 = vertex -1 material vertex 1.0 1.0
+1.0 material = 0.500000 1.0 material =
+-1 frame vertex
+bone = material 1.0
+frame
+bone
+1.0 =
+material bone anim anim bone frame
+material
+bone 1.0 bone texture material 1.0 1.0 anim
+texture
+1.0 texture 1.0 vertex -1 frame 1.0 0.500000 = bone anim texture
+-1 bone
+bone vertex bone frame -1 anim material -1
+texture frame
+= 1.0
+= 1.0 bone
+1.0
+frame frame
+vertex anim
+0.500000 material -1
+bone =
+-1 frame texture vertex -1 -1 0.500000 vertex
+anim vertex
+vertex texture anim texture material
+1.0 texture 0.500000 frame frame material 1.0 frame -1
+vertex frame bone vertex
+1.0 1.0 bone vertex frame
+vertex -1
+0.500000 0.500000 vertex vertex
+material
+anim -1 = 1.0 anim 0.500000 bone 1.0 bone bone anim = = texture anim vertex
+anim
+frame 0.500000 material texture texture bone
+frame material
+texture texture 0.500000 -1 anim = -1 vertex material texture frame material
+anim material
+= bone
+texture anim
+material bone 1.0 0.500000 frame frame
+texture texture 0.500000
+= anim
+= vertex bone material vertex texture -1
+=
+0.500000 vertex
+1.0 =
+anim frame texture material anim -1 anim 0.500000
+anim = anim
+texture vertex 0.500000 texture = =
+= texture material 0.500000 =
+bone
+texture = frame
+anim material material texture = frame material vertex
+frame bone bone anim anim
+= -1
+bone material frame vertex 0.500000 0.500000 0.500000
+texture 0.500000 0.500000 texture bone 1.0 texture vertex texture bone material 0.500000
+bone frame frame 0.500000
+bone anim = anim bone
+material material anim texture
+material vertex frame 0.500000 0.500000
+texture anim material bone 0.500000 material frame material -1 bone 0.500000 frame
+1.0
+material
+0.500000
+anim
+texture
+frame -1 anim material
+vertex = vertex 1.0 -1 vertex vertex = vertex anim anim anim material 0.500000 0.500000 material material frame
+= frame 1.0 1.0
+frame vertex
+0.500000 1.0
+frame 1.0 anim = vertex
+frame vertex = 1.0 bone frame frame 0.500000
+material
+anim 1.0 -1
+texture
+vertex material material vertex frame -1 = frame
+-1
+texture bone anim texture
+-1 vertex
+anim vertex 1.0 0.500000 1.0 = texture frame 1.0 0.500000 bone
+bone
+frame
+bone texture bone anim vertex
+vertex
+frame =
+anim
+texture = material frame texture texture
+anim 0.500000
+-1 =
+1.0 = texture 0.500000 anim
+-1 anim
+material bone material -1 -1 = texture anim
+texture anim material vertex -1 1.0 = 1.0 anim material = -1 0.500000 frame
+material
+bone -1
+1.0 frame bone vertex bone 1.0
+-1
+frame
+frame material
+= anim anim material anim frame
+1.0 material 1.0 anim
+vertex
+frame
+vertex frame
+-1 bone =
+bone -1 0.500000 material = texture = frame 0.500000 -1 anim
+frame
+0.500000 material 0.500000 
\ No newline at end of file
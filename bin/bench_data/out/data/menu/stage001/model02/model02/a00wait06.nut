@@ -0,0 +1,3 @@
+bone 0.500000 texture texture anim vertex
+anim 0.500000 = frame anim
+vertex
\ No newline at end of file
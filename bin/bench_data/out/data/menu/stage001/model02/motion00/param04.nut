@@ -0,0 +1,9 @@
+anim
+material 0.500000 anim 0.500000 0.500000
+1.0 anim 0.500000 -1 vertex 1.0 =
+material frame
+vertex bone
+-1 0.500000 -1
+-1 0.500000
+= texture vertex texture 0.500000
+fr
\ No newline at end of file
@@ -0,0 +1,23 @@
+material bone frame
+vertex 1.0 vertex material 1.0 1.0
+-1 frame
+material 0.500000
+-1
+anim
+anim
+vertex texture = frame bone -1 1.0
+1.0
+material
+-1 -1 bone -1 0.500000 anim vertex -1 1.0 bone -1
+1.0 anim anim anim 1.0
+0.500000 1.0 vertex
+= 1.0 bone = material 1.0 texture 1.0 =
+1.0
+anim = material
+bone 1.0 texture
+texture -1 bone vertex -1 bone 1.0 frame 0.500000 vertex = vertex material -1 =
+0.500000 bone = 1.0
+= texture vertex frame frame -1 anim vertex 1.0 -1 1.0 vertex -1 material -1 1.0 texture frame
+frame 0.500000 frame texture texture = vertex
+anim
+texture bo
\ No newline at end of file
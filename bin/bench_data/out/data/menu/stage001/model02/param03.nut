@@ -0,0 +1,2 @@
+bone anim frame vertex -1 bone 1.0
+mate
\ No newline at end of file
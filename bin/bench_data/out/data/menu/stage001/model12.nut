@@ -0,0 +1,180 @@
+1.0
+1.0 bone frame anim
+material
+material 0.500000 1.0 1.0 -1 1.0 -1
+0.500000
+0.500000 anim =
+bone 1.0 frame frame frame bone
+material 1.0
+1.0 0.500000 0.500000 -1
+bone
+1.0 vertex
+frame anim vertex
+-1 -1 texture
+vertex
+vertex material
+material
+texture -1
+= 0.500000 vertex 1.0
+1.0 anim bone =
+texture
+0.500000 anim -1 texture =
+= anim 1.0
+material -1 0.500000
+texture
+texture -1 0.500000 =
+bone 0.500000 material
+vertex
+frame texture anim vertex = vertex
+1.0 1.0 -1 material material
+vertex vertex vertex
+frame frame
+texture =
+1.0 frame = texture -1 -1
+= 0.500000 -1 1.0 1.0 vertex frame bone 1.0 0.500000 bone
+anim
+=
+vertex texture
+frame frame 0.500000 -1
+bone
+anim bone
+1.0 frame texture
+0.500000 =
+anim texture frame
+= anim =
+0.500000 1.0 material anim -1 =
+material 0.500000 texture
+vertex bone bone -1 texture
+= texture 1.0 frame
+texture
+1.0 texture texture -1 =
+material anim
+0.500000 anim anim 1.0 = frame -1 frame bone anim 0.500000 0.500000 anim anim
+frame texture -1
+material
+material frame material frame 1.0
+frame 1.0 vertex anim 0.500000 material 1.0 vertex bone
+material texture anim bone anim frame 0.500000 bone
+1.0 material bone 1.0 = texture
+vertex
+vertex 1.0 1.0
+texture -1 0.500000 = texture
+0.500000
+frame
+-1 anim 0.500000 bone frame 1.0
+-1 anim bone bone
+material texture 1.0 bone -1 bone material
+anim
+1.0 vertex texture -1 vertex material bone
+texture 0.500000 material = -1 bone material 1.0 anim 0.500000 =
+frame
+-1
+0.500000 -1 -1
+vertex
+frame
+texture -1 frame = anim 0.500000 0.500000 bone 0.500000
+1.0
+material material
+1.0 material material
+0.500000 = frame bone anim material vertex vertex
+vertex texture anim texture = bone material bone -1 bone vertex anim
+1.0 0.500000 0.500000 bone bone texture anim bone
+bone anim
+anim
+vertex material frame
+0.500000 1.0 1.0 material 1.0 frame frame material 1.0
+texture anim frame texture = vertex = anim
+vertex material -1
+material frame 0.500000 =
+bone
+= bone material frame
+anim bone bone bone anim = material
+material 0.500000 bone
+vertex 0.500000 =
+anim texture texture = bone material
+1.0 frame frame 0.500000 = texture frame material
+1.0 texture anim 1.0
+bone material
+= anim anim texture
+bone anim -1 bone bone
+-1 anim 0.500000 bone = texture material
+anim
+= vertex 0.500000 anim anim frame 0.500000 anim
+-1 -1 anim
+anim
+-1 0.500000 frame = anim 0.500000
+material
+frame frame frame bone frame bone vertex texture bone
+vertex
+= frame bone bone =
+bone -1 anim =
+vertex 1.0
+-1 =
+1.0 anim 1.0 material
+0.500000 = bone
+anim = = frame frame 0.500000 1.0
+frame frame texture -1 = vertex anim 1.0 vertex material
+bone texture frame 1.0 -1 texture texture texture 0.500000 1.0
+bone material -1 1.0 0.500000
+=
+material 0.500000 1.0
+0.500000 material 0.500000 1.0 texture frame -1 texture anim 1.0 material vertex = bone 0.500000
+= -1
+texture
+frame 1.0 1.0 bone -1 -1 bone
+bone frame bone
+anim
+anim 1.0
+=
+bone 1.0 -1
+= = 0.500000 -1
+anim
+= 0.500000 -1
+= frame bone
+0.500000 texture texture vertex -1 texture material
+= 0.500000 anim 1.0
+texture
+texture 0.500000
+1.0 texture
+frame material bone material frame
+texture
+bone anim anim 0.500000 = -1 frame 0.500000 1.0 vertex -1
+1.0 0.500000
+-1 frame anim =
+0.500000
+0.500000 material
+anim frame
+1.0
+-1
+1.0 bone = = 1.0
+= anim frame 0.500000 frame bone frame 0.500000 material vertex -1 material 1.0
+texture
+anim bone
+vertex 0.500000 = bone texture bone anim = anim
+frame texture
+texture -1
+texture vertex frame
+frame 0.500000 bone vertex
+= material
+texture anim
+vertex texture texture material material = -1 1.0 anim 1.0 = -1 -1 bone = -1 material
+material texture material 0.500000 0.500000 bone
+0.500000 1.0 material texture bone -1 0.500000 1.0 material
+1.0
+0.500000 1.0 vertex
+material
+anim 1.0 = texture bone bone material
+-1 anim frame 0.500000 material
+1.0 anim vertex frame frame material anim
+vertex material
+material 1.0 texture 1.0 0.500000 frame anim texture -1 vertex
+1.0 texture material -1 1.0 = 1.0
+-1 frame -1 1.0 bone vertex bone 0.500000
+1.0 anim -1
+material
+1.0 material = bone vertex vertex -1
+material anim = texture
+vertex bone material anim 1.0 frame
+= -1 texture material 0.500000
+frame bone texture -1 -1 -1 vertex texture vertex texture bone bone
+= material 1.0 anim 0.5000
\ No newline at end of file
@@ -0,0 +1 @@
+ScO2ORJqaر:i#<\rA^ԹZ
\ No newline at end of file
@@ -0,0 +1,25 @@
+bone 0.500000
+-1 -1 -1 texture -1
+vertex frame
+-1
+-1 material 1.0 vertex -1
+=
+= material bone
+bone
+texture texture
+material vertex material 0.500000 bone
+anim
+=
+material
+frame
+1.0 anim -1 1.0 bone bone -1 material
+0.500000
+material
+anim -1 bone = -1 material anim
+bone -1 0.500000 -1 anim anim
+-1 texture material
+vertex vertex material
+1.0
+texture anim -1 1.0 -1 anim 0.500000 bone 1.0 bone frame
+texture texture
+vertex frame = 0.500000 anim vertex anim bone vertex texture = texture frame bone fra
\ No newline at end of file
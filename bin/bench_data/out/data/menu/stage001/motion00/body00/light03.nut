@@ -0,0 +1,3 @@
+frame texture
+frame 1.0 =
+bone anim texture texture vertex bone -1 bone anim vertex
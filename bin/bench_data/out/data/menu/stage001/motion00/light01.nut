@@ -0,0 +1,116 @@
+bone -1
+= material texture frame material
+= -1 0.500000 = = 1.0 frame 1.0
+= vertex -1 = 1.0
+vertex anim vertex
+texture bone -1
+= vertex material = 0.500000 =
+bone 0.500000
+bone frame frame bone
+frame texture material 0.500000 -1 frame 0.500000 0.500000 texture material vertex 0.500000 -1 1.0 1.0
+0.500000
+material
+material bone 0.500000 texture bone anim
+vertex 1.0
+frame bone anim material = = anim 1.0
+frame -1 = texture frame =
+vertex = material 0.500000
+1.0 0.500000
+1.0
+0.500000 1.0 texture -1 1.0 = bone
+frame frame
+vertex
+bone = = = vertex 1.0 -1 1.0
+= 1.0 material 0.500000 1.0 0.500000 texture = vertex bone frame anim
+1.0
+= anim anim = texture 0.500000
+texture
+-1 vertex anim vertex texture = 1.0 frame 1.0 1.0 bone material = bone 1.0
+texture = = 0.500000
+texture anim 0.500000 -1 0.500000 = vertex 0.500000 -1 bone bone material 1.0 texture material
+-1 0.500000
+bone 0.500000 =
+anim
+anim = material
+= 0.500000 material -1 1.0
+1.0
+-1 =
+-1 anim vertex
+-1 -1
+1.0 material bone = texture
+-1 =
+1.0 0.500000 -1
+anim texture anim 0.500000 -1
+texture anim vertex
+material bone
+0.500000 0.500000 = anim = bone
+anim anim 0.500000 anim
+-1 1.0 0.500000 = = material
+= 1.0 vertex vertex 1.0 1.0 anim bone
+0.500000
+material material 1.0 1.0 vertex
+-1 = material = material 0.500000
+material
+bone bone = -1 frame anim frame
+material vertex =
+-1 anim bone 1.0 0.500000 bone frame
+anim
+bone texture
+material
+bone bone frame texture
+texture
+=
+frame texture
+1.0 1.0 anim
+bone
+frame 1.0 bone = 0.500000 bone material bone
+1.0 bone texture 0.500000
+-1 1.0 =
+0.500000 -1 0.500000 frame material
+=
+frame material
+vertex vertex = material anim anim
+material material bone 1.0 0.500000
+1.0 frame vertex
+material
+frame bone -1 vertex 1.0 1.0 vertex frame =
+texture = vertex frame =
+anim material vertex = frame frame vertex material -1 1.0
+vertex = anim
+texture bone vertex 0.500000 material texture anim = material texture 0.500000
+bone vertex anim
+material anim
+vertex = vertex anim 1.0 texture
+=
+1.0 frame
+frame
+1.0 material = bone 0.500000 material texture anim 0.500000
+1.0
+frame 1.0
+= texture -1 vertex
+0.500000 =
+material
+anim
+1.0
+vertex texture bone
+bone
+anim bone material 1.0 0.500000 1.0 texture
+frame bone = frame
+anim texture
+1.0 anim =
+-1 = bone
+bone -1 = anim -1 texture -1 vertex -1 anim -1 =
+bone anim bone 1.0 texture
+bone vertex -1
+=
+frame -1 bone
+vertex bone -1 = vertex texture = anim material vertex 0.500000 0.500000
+frame frame
+= 1.0 = = 1.0
+1.0 1.0 1.0 bone = -1 material texture
+-1 anim -1 texture bone anim vertex = frame frame vertex = anim
+vertex anim vertex material
+frame
+-1
+-1 -1 frame anim anim anim material 0.500000 texture =
+vertex 1.0 texture bone
\ No newline at end of file
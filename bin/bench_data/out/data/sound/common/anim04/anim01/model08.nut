@@ -0,0 +1,7 @@
+1.0
+bone vertex frame anim vertex anim
+frame
+frame vertex vertex material
+0.500000 -1 anim 0.500000 material 1.0 anim texture vertex
+texture
+frame 
\ No newline at end of file
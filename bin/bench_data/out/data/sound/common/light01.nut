@@ -0,0 +1,318 @@
+frame bone
+-1 material
+frame
+bone texture frame
+bone 1.0 material material vertex anim -1 vertex 0.500000 1.0 0.500000 frame bone bone
+anim 1.0 anim
+frame
+material
+= bone
+1.0 material 0.500000 0.500000 anim = 1.0 frame vertex
+= 1.0 frame vertex
+=
+bone
+1.0 material
+frame 0.500000 anim
+material frame -1
+vertex material vertex
+bone texture texture 1.0 anim frame bone frame -1 = 0.500000
+vertex bone frame material
+0.500000 1.0 -1 0.500000
+vertex material vertex vertex 1.0 -1 material material 0.500000 bone vertex bone texture = vertex vertex anim anim
+anim -1 0.500000 0.500000 frame 0.500000 texture 1.0
+0.500000 1.0 bone anim 1.0 material anim anim 0.500000
+bone
+1.0 0.500000 material -1
+texture texture anim anim = anim anim =
+material 0.500000 frame
+-1 bone bone = frame material 1.0 0.500000 =
+frame
+frame frame -1 bone -1 bone 0.500000 1.0 1.0 = anim
+vertex material
+anim -1 material 0.500000 material 1.0
+bone
+= frame
+texture
+bone bone frame 0.500000 0.500000
+0.500000 -1 texture
+bone anim vertex 0.500000
+bone frame material
+bone frame -1 vertex anim = -1
+bone
+= vertex 0.500000 =
+vertex frame
+0.500000 frame 1.0 = vertex
+texture frame
+bone
+bone frame texture texture material
+texture -1 bone anim 0.500000 0.500000 vertex
+frame vertex 0.500000 material
+= frame anim anim
+anim 1.0 = bone material 0.500000 anim
+anim =
+-1 vertex bone bone 1.0 texture
+vertex bone texture anim material -1
+material bone vertex bone frame material material -1
+-1 material vertex material
+= vertex
+-1 =
+vertex bone vertex
+1.0 material bone frame 1.0 0.500000 anim bone 0.500000 bone material
+1.0 material texture 1.0 0.500000 -1 material material vertex 0.500000
+-1
+= material
+texture frame anim
+bone vertex 1.0 frame = 0.500000
+material frame bone vertex frame 0.500000 1.0 = frame
+texture -1 0.500000 0.500000 frame
+material
+0.500000
+-1 texture = bone =
+frame bone bone 1.0 bone texture 0.500000 material vertex vertex material 0.500000 0.500000
+frame bone bone frame = vertex
+= frame 0.500000 0.500000 = bone material 1.0 material texture anim texture frame
+frame
+-1
+0.500000
+vertex 0.500000 0.500000 vertex vertex = anim 1.0 bone bone
+texture
+anim vertex
+= 1.0 vertex 0.500000 material bone
+vertex
+= material
+anim
+1.0 = bone
+frame frame =
+vertex anim texture anim texture 0.500000 anim material
+= vertex
+vertex = anim 1.0 frame 1.0 = bone 0.500000 0.500000 bone
+texture material
+bone
+bone texture -1 frame frame texture
+anim texture 0.500000
+bone -1
+1.0 -1 1.0 anim
+-1 vertex 0.500000 material
+texture bone 0.500000 material 1.0 0.500000 1.0 anim 0.500000 texture anim
+anim 1.0
+-1 -1 1.0
+texture bone
+frame texture 1.0 vertex
+texture bone material 0.500000 -1 -1 frame -1 1.0 anim texture -1
+material bone vertex material anim 1.0
+=
+vertex
+anim 0.500000 frame
+texture material frame
+0.500000 0.500000 = 0.500000
+bone -1
+0.500000 bone frame anim frame frame 1.0
+bone texture frame
+anim vertex bone 0.500000 frame 0.500000
+=
+-1 material
+material 0.500000
+frame anim
+anim frame frame
+anim material = texture
+vertex
+texture vertex 0.500000 material anim 0.500000
+vertex frame material
+-1
+0.500000 material anim material material texture anim 0.500000 0.500000
+bone 1.0 anim 1.0 frame
+-1 0.500000 vertex material -1
+1.0
+= 1.0 frame bone anim 1.0 anim
+0.500000 1.0 material
+= bone = =
+0.500000 anim 0.500000 1.0 frame
+frame anim frame -1 = bone
+texture = frame 1.0 vertex anim =
+1.0
+1.0
+0.500000
+1.0 anim vertex frame material bone texture 1.0 anim frame texture material
+material anim -1 vertex
+texture 0.500000 1.0 0.500000
+0.500000 frame
+texture
+-1 frame vertex 1.0 1.0 = anim
+1.0
+texture anim
+anim vertex 0.500000 -1
+= frame
+bone
+vertex bone
+frame 1.0
+-1
+bone 0.500000 bone bone material material 1.0 1.0
+= vertex frame 1.0 -1 anim 1.0 = anim
+frame material 1.0 vertex anim
+frame texture vertex anim texture texture bone texture texture frame anim 0.500000 = frame = -1
+1.0
+-1
+1.0 =
+-1
+0.500000
+anim frame -1 vertex
+texture
+anim
+material 1.0 vertex =
+frame texture vertex = vertex -1 anim bone
+anim material
+0.500000 -1
+-1 material 1.0
+vertex
+anim -1
+bone anim vertex frame vertex 0.500000 material = vertex
+frame
+0.500000 = frame
+-1 0.500000 material = frame texture
+1.0 vertex vertex bone anim 1.0 texture vertex 1.0 texture
+vertex material -1 texture -1 frame material
+1.0
+frame 0.500000
+material 1.0 material = = 1.0 1.0 vertex texture
+= frame = material vertex anim
+vertex -1 1.0 1.0 0.500000
+texture anim anim
+anim
+= 1.0
+-1 bone
+-1 texture 0.500000
+= 0.500000 0.500000 = 1.0 = 1.0 = anim anim 1.0 bone bone
+texture anim 0.500000 bone 1.0
+0.500000 -1 anim vertex 1.0
+vertex
+=
+= 1.0 texture
+vertex
+frame
+bone vertex
+vertex anim
+texture vertex
+= texture anim anim vertex material
+= 0.500000 texture bone
+1.0 0.500000 = 0.500000 bone
+= -1 1.0
+material = texture
+anim
+texture -1 texture texture bone bone vertex anim material
+-1 0.500000
+vertex
+bone material texture
+texture
+material = 0.500000
+0.500000 vertex 0.500000 frame
+frame -1 anim
+anim texture
+1.0 texture vertex = -1
+frame -1 = frame
+bone 0.500000 vertex material 0.500000 -1 bone 1.0 bone 1.0 texture 1.0 -1 frame
+-1 bone -1 -1 material
+anim
+vertex
+0.500000 =
+material 0.500000 1.0
+vertex frame texture
+1.0
+texture frame frame vertex
+-1 1.0 vertex material texture
+frame
+vertex anim anim vertex
+material frame 0.500000 -1 frame frame vertex
+vertex bone vertex -1 vertex = anim texture
+bone
+texture vertex =
+bone texture vertex
+bone bone texture
+frame texture = 0.500000
+= -1 material 0.500000 bone
+bone bone 1.0 material vertex frame =
+vertex 1.0 bone material 0.500000 material texture bone
+1.0
+0.500000
+anim
+texture vertex bone anim texture anim frame
+-1 bone -1
+vertex material 0.500000
+material -1 0.500000
+1.0 -1 -1 0.500000 = texture bone -1 = vertex
+material vertex
+vertex material 1.0
+material = material anim frame vertex 1.0 bone material anim bone 0.500000 -1
+=
+0.500000 bone
+texture
+1.0
+material frame -1 vertex frame
+= vertex frame bone 1.0 -1 frame -1 material
+1.0 0.500000 0.500000 frame
+vertex -1 1.0
+0.500000 frame -1 = =
+vertex
+0.500000 vertex material
+bone -1
+0.500000
+bone
+anim frame
+= -1 -1
+anim vertex anim material
+= anim material
+texture
+frame bone frame anim 1.0 bone 0.500000
+anim texture bone
+texture bone 1.0
+material
+0.500000 anim
+material texture -1 1.0 texture
+0.500000 frame -1 material -1 bone
+frame = -1 anim texture material anim
+material
+texture
+vertex frame vertex frame bone
+vertex -1 material
+vertex frame 1.0 -1 vertex anim
+= bone
+anim 1.0 anim
+vertex
+1.0 = texture anim texture -1 texture anim 1.0 = -1 1.0 anim texture vertex
+frame vertex 0.500000 1.0 bone 1.0 1.0 texture vertex 1.0 texture anim
+texture vertex
+bone
+1.0 anim texture
+anim
+=
+0.500000
+texture frame material vertex
+vertex
+1.0
+bone anim material
+texture 0.500000 material bone vertex
+anim
+bone texture frame anim 0.500000 -1 bone
+material texture =
+= anim =
+1.0 vertex
+1.0 -1 = texture
+0.500000
+0.500000 0.500000 vertex 0.500000 frame
+anim 0.500000 texture bone bone
+texture bone
+1.0 material -1
+material anim bone bone 1.0 texture -1 -1 =
+=
+= vertex anim material
+material texture frame material material
+texture
+frame
+= texture anim = vertex
+bone material material = vertex 1.0 -1
+texture = 1.0 vertex anim
+= anim 0.500000 frame -1 texture = = material anim
+vertex vertex anim -1 = 1.0 material
+anim
+0.500000 0.500000 1.0 vertex
+material 1.0
+0.500000 1.0 texture 0.
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 vertex 0.500000 bone 1.0
+material
+= material te
\ No newline at end of file
@@ -0,0 +1,205 @@
+vertex
+0.500000 -1 -1
+texture 0.500000
+texture
+material bone texture vertex =
+1.0
+anim -1 frame 1.0 = = 1.0 vertex
+texture -1 texture
+material -1 frame
+0.500000 frame material
+vertex 1.0 -1 material 1.0
+=
+1.0
+=
+vertex -1 material material material
+texture bone
+texture
+0.500000 vertex material 0.500000 -1 material bone texture
+0.500000 anim frame 1.0
+texture frame
+texture texture anim bone 0.500000 1.0 anim -1 -1 anim material vertex
+0.500000 texture -1 1.0 vertex -1 texture
+material
+bone
+= 0.500000 material anim vertex
+anim = frame 1.0
+-1 frame
+0.500000
+-1 vertex
+0.500000 = 1.0
+1.0
+1.0 anim anim
+0.500000
+0.500000 1.0 material 1.0
+vertex =
+anim -1
+frame 1.0 texture
+-1 frame 0.500000 frame vertex anim
+0.500000 material 1.0 texture -1 1.0
+-1 frame anim texture
+material material 0.500000 =
+vertex material
+texture 1.0 texture
+bone
+bone
+anim bone frame frame anim 0.500000 material vertex
+frame texture 0.500000 frame texture = texture frame 0.500000 vertex bone frame
+texture bone frame
+texture = texture 0.500000
+material 1.0 bone
+texture -1
+0.500000 = anim 1.0
+material
+bone material
+1.0
+0.500000 0.500000
+anim vertex
+anim
+0.500000
+bone
+1.0 = texture
+anim = =
+material anim = anim bone bone 1.0 frame -1 bone -1 frame
+material 0.500000 texture
+vertex
+1.0 1.0 vertex vertex 1.0 vertex anim
+material bone
+0.500000 anim = texture
+0.500000 bone = -1 -1 anim bone vertex bone frame 0.500000 = material =
+= vertex bone anim vertex material vertex 1.0 -1 1.0 = anim frame -1 0.500000
+texture material
+vertex texture material
+1.0 texture bone
+0.500000
+vertex material vertex bone bone bone 0.500000 anim anim 0.500000 bone vertex
+= 1.0 1.0 1.0 vertex = material bone frame bone vertex = vertex =
+anim vertex bone
+bone 1.0
+=
+-1
+= vertex material
+anim frame frame 1.0
+0.500000
+-1
+texture bone = texture
+0.500000 frame bone
+vertex 0.500000
+1.0
+material -1 texture material
+texture 0.500000 1.0 vertex
+1.0 bone bone texture 1.0 -1
+material = bone bone -1 0.500000
+anim -1 = -1 frame = 1.0 frame vertex = texture vertex -1
+texture material bone 1.0 bone anim bone = texture anim
+anim = -1 texture frame
+frame
+bone 0.500000 =
+= 1.0 = 0.500000 texture
+vertex
+bone
+bone vertex = 0.500000
+frame = anim texture material = 1.0 anim bone
+vertex = vertex texture
+-1
+material 0.500000
+bone
+bone
+0.500000 frame
+vertex
+anim bone anim 1.0 frame -1 bone 0.500000 frame
+1.0 0.500000
+bone material bone texture material bone vertex 0.500000 vertex texture
+anim material bone vertex
+0.500000 material anim = texture material texture vertex texture
+=
+0.500000 0.500000 frame vertex anim
+= frame -1
+= anim = frame
+anim
+frame texture vertex anim 0.500000
+-1 0.500000 bone material frame
+-1 texture -1
+anim
+material = vertex = vertex texture 0.500000
+frame frame vertex
+material frame -1 0.500000 bone material texture
+0.500000
+vertex =
+-1 -1 bone material 1.0
+bone -1 anim frame -1 -1 bone 1.0
+0.500000 material 1.0 bone bone vertex bone -1 1.0 0.500000 frame bone texture material
+vertex = 0.500000 material vertex bone anim vertex
+vertex
+bone bone = frame 0.500000 -1 = anim frame -1 1.0 = 1.0
+1.0 -1 frame material
+= = anim material
+= vertex vertex
+vertex 0.500000 anim material -1 1.0
+anim vertex
+texture 0.500000 anim = anim
+1.0
+1.0 texture frame bone -1
+-1 vertex anim
+vertex texture frame
+texture anim
+material frame -1 frame
+vertex 1.0 bone bone frame = anim
+frame anim anim 1.0 0.500000 -1 anim -1 texture anim
+1.0 frame 0.500000 texture
+material bone 0.500000
+1.0 1.0 -1 frame
+= frame
+material 1.0 0.500000 1.0
+=
+= = vertex material material -1 vertex frame 0.500000 1.0 vertex 1.0 0.500000 1.0
+texture 0.500000 frame bone frame texture vertex material anim bone anim vertex -1 bone
+vertex -1 = anim
+0.500000
+1.0 -1
+anim bone
+vertex bone
+-1
+texture -1 bone
+texture =
+anim anim
+-1 frame
+1.0
+texture 0.500000 0.500000
+vertex = -1
+bone =
+anim 0.500000 material 1.0 1.0 = anim texture texture bone frame
+material bone
+frame
+= -1 anim bone 0.500000 frame
+1.0 texture 0.500000 material = vertex bone texture frame material -1 1.0 texture 0.500000 = =
+material vertex anim
+-1
+material material =
+= -1 = anim bone = 0.500000 -1 frame 0.500000
+vertex material bone anim frame
+texture = -1
+bone frame frame
+vertex 1.0 frame
+frame
+vertex frame = = anim 0.500000 = texture 1.0
+frame
+anim frame = anim 0.500000
+bone
+vertex = bone anim texture anim texture = bone 1.0
+1.0 -1 0.500000 anim frame texture 0.500000 -1
+0.500000 anim bone
+frame
+-1 vertex
+1.0 = vertex vertex = bone vertex 1.0 texture texture bone 0.500000 1.0
+= bone
+0.500000
+= vertex vertex bone bone vertex
+bone
+anim 0.500000 bone texture vertex 0.500000 0.500000 anim
+texture
+material bone
+0.500000 anim anim 0.500000 anim -1 =
+1.0 1.0 material frame 0.500000 anim =
+vertex
+bone material texture = 
\ No newline at end of file
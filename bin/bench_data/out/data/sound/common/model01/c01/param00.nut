@@ -0,0 +1,247 @@
+0.500000
+frame
+1.0 0.500000 vertex -1 1.0 frame 0.500000 bone
+-1 material
+-1 0.500000
+anim
+anim texture anim -1
+-1
+vertex anim
+material = 1.0 vertex material frame
+texture = frame
+frame 0.500000 bone
+= vertex anim bone -1
+1.0 -1 1.0 =
+= frame -1 = frame texture anim -1 material
+-1 vertex
+frame 0.500000 material
+vertex bone bone -1 bone
+1.0 texture bone 0.500000 -1 bone =
+material material material
+vertex 0.500000 1.0 anim
+1.0 texture material anim 0.500000 frame -1 texture texture anim anim bone
+material bone 0.500000 material = anim
+bone material = 0.500000
+material
+1.0 frame
+bone
+0.500000
+= texture frame
+0.500000 -1 texture bone
+-1
+0.500000
+0.500000 material
+anim 0.500000 bone
+anim texture
+texture 0.500000 anim bone texture
+-1
+frame 1.0 0.500000 anim frame material 0.500000
+= frame
+frame material frame
+= anim
+0.500000
+-1 frame =
+-1 vertex 1.0
+0.500000 = frame bone
+1.0 vertex frame
+1.0 material -1 -1 texture =
+1.0
+texture 0.500000 0.500000 material frame -1 -1 = =
+vertex -1 texture texture vertex bone frame
+texture
+-1
+frame
+0.500000 material anim frame vertex anim vertex frame bone vertex texture
+1.0 0.500000 0.500000
+1.0
+texture texture bone bone bone
+0.500000
+1.0
+=
+1.0 vertex = frame vertex
+= 0.500000 anim
+= anim 1.0
+frame vertex frame 1.0 0.500000 = material frame -1 1.0
+frame material = material material material material 1.0 vertex vertex texture material =
+anim material -1 -1 0.500000 material anim
+material frame
+0.500000
+bone 0.500000
+1.0 bone material bone
+material -1 texture 0.500000 anim
+0.500000
+= vertex vertex 1.0 frame material bone anim
+frame bone frame bone bone -1
+anim texture bone vertex 1.0 texture 0.500000
+-1 anim -1
+anim anim -1
+anim frame vertex -1
+texture texture
+texture -1 texture material texture frame texture 0.500000
+= anim
+bone 0.500000 texture 1.0
+bone -1
+frame anim -1 1.0 frame =
+texture bone bone -1 -1 bone bone material
+-1 vertex vertex 1.0 -1 -1 material texture anim frame 1.0 material
+texture vertex
+frame = frame frame frame
+1.0 -1
+1.0
+anim
+material frame 1.0 bone frame bone
+anim
+bone -1
+texture anim
+1.0 1.0 anim = texture anim 0.500000 frame material
+1.0
+anim vertex 1.0 vertex texture 0.500000 1.0
+0.500000 material material
+1.0 -1 frame
+1.0 texture
+material texture bone
+texture anim
+= material frame bone
+-1 frame vertex 1.0 1.0 0.500000 1.0 texture material vertex vertex
+frame 0.500000 bone bone = vertex anim = 0.500000 texture
+1.0 vertex =
+bone material frame -1 -1 = anim
+-1 vertex texture
+anim
+bone bone anim anim texture
+bone
+material material 0.500000 vertex 0.500000 1.0 1.0 = 1.0 anim vertex
+anim vertex bone vertex bone
+frame
+1.0
+=
+vertex 1.0 frame
+anim 1.0 texture = vertex vertex = -1 anim =
+vertex 0.500000 =
+= 1.0 frame anim -1 material
+-1 anim anim -1 texture bone material
+texture
+bone material bone material
+-1
+frame = material = bone vertex vertex texture frame
+material -1 = -1 vertex frame anim frame
+0.500000 0.500000 frame 1.0 bone 0.500000
+anim
+texture 0.500000 frame material
+frame frame anim
+texture 1.0
+= =
+-1 anim 0.500000 = vertex
+texture anim material anim frame vertex 1.0 texture bone -1 material texture 0.500000 -1 anim anim frame
+1.0
+1.0 anim texture anim 0.500000 = anim 1.0 =
+=
+vertex texture vertex texture bone 1.0
+anim
+material
+material 0.500000
+vertex vertex bone texture = vertex vertex
+1.0 material material
+= 0.500000 = frame
+vertex material
+texture texture vertex anim vertex bone texture vertex material -1
+bone
+bone frame vertex -1 texture bone
+material material anim =
+0.500000 frame vertex texture -1 material 1.0 = vertex 0.500000 material 0.500000 1.0 vertex texture
+material
+material frame
+1.0
+anim = -1
+bone
+vertex bone texture material anim frame
+material 1.0 anim bone anim
+material 0.500000
+texture
+-1 frame
+=
+frame anim
+0.500000 -1 material -1 frame
+vertex
+material bone
+-1 anim -1 = texture material 0.500000 material texture bone
+-1
+0.500000
+frame bone vertex texture 0.500000 frame texture 1.0 frame
+0.500000 1.0 bone frame = frame
+material 1.0
+texture
+frame material texture -1 frame frame -1 -1 -1 bone -1 material 1.0
+material
+material
+material = vertex bone texture 0.500000 -1 frame bone frame bone -1 = -1
+-1 frame vertex texture
+vertex frame texture =
+-1 vertex 0.500000 bone
+texture anim texture texture -1 bone
+frame vertex -1 anim -1
+vertex =
+texture vertex anim = anim vertex anim -1 anim = bone =
+bone
+vertex
+vertex
+anim 0.500000 texture
+0.500000
+bone 1.0 texture
+-1 -1 anim texture anim
+-1 = bone -1 frame
+material vertex
+0.500000
+anim frame
+vertex
+=
+frame frame 1.0 -1
+-1
+1.0 material bone
+0.500000 = texture 0.500000
+material vertex =
+bone
+material
+-1 texture = bone frame bone
+bone bone material material bone 0.500000
+-1
+material
+frame frame -1 frame material 1.0 frame anim frame -1 anim 1.0 bone material anim
+= texture bone = frame
+vertex
+anim vertex texture -1 bone anim -1 anim bone material texture anim 0.500000 frame
+bone bone = 1.0 0.500000 0.500000 texture bone -1 material =
+1.0 vertex bone 0.500000 -1 0.500000 1.0
+=
+1.0 -1 frame = 1.0 0.500000
+1.0 1.0 -1 = 0.500000 frame
+-1 material material 1.0 material
+anim texture anim
+texture material material bone
+material anim -1 frame frame -1
+anim
+vertex material 0.500000 anim
+texture = frame texture 1.0 -1
+1.0 material vertex
+1.0 -1 -1 -1 =
+0.500000 vertex anim frame
+1.0 = bone frame = material material bone bone 0.500000
+-1 texture 1.0
+anim = texture material anim 1.0 frame
+= texture
+-1 -1
+-1 0.500000
+vertex material anim
+vertex texture 1.0 = 1.0 1.0 bone frame texture texture anim vertex bone
+0.500000 = material
+1.0 texture
+-1 anim = = texture texture = frame 0.500000 texture
+texture bone frame 0.500000 0.500000 = texture 1.0 0.500000 anim -1 1.0 1.0 vertex 1.0 bone 1.0 frame
+1.0
+= bone texture bone 0.500000 vertex
+1.0 0.500000 texture 0.500000 -1
+material material vertex anim -1
+-1
+-1
+frame 1.0 bone material
+vertex fr
\ No newline at end of file
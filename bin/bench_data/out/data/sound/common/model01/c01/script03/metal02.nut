@@ -0,0 +1,6 @@
+texture material bone
+= bone bone
+frame
+bone anim
+1.0 material 1.0 vertex anim
+frame 1.0
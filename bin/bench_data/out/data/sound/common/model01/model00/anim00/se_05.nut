@@ -0,0 +1,3 @@
+0.500000 material vertex 0.500000 0.500000 bone
+1.0
+vertex frame -1 textur
\ No newline at end of file
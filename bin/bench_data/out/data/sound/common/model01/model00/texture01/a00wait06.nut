@@ -0,0 +1,3 @@
+texture 0.500000 material -1 = texture frame texture frame texture
+anim vertex anim
+bone t
\ No newline at end of file
@@ -0,0 +1,78 @@
+1.0 -1 material 0.500000 frame 1.0 anim anim
+-1
+anim bone
+= anim 1.0
+vertex material vertex 0.500000 = texture = 1.0 frame bone
+-1 frame material 1.0
+0.500000
+vertex = -1 vertex texture 1.0 0.500000 texture texture texture anim
+-1 0.500000 -1 bone 0.500000 1.0 vertex anim texture
+=
+0.500000
+anim 0.500000 frame -1 anim frame 1.0
+= bone -1 frame vertex = -1 material frame vertex
+1.0 -1 anim anim 1.0 -1 vertex
+-1 anim 0.500000 frame anim
+0.500000
+texture
+-1 = -1 0.500000 -1 0.500000
+0.500000
+0.500000
+anim bone frame texture texture 0.500000 texture
+-1
+vertex anim -1 anim material
+bone 1.0 =
+1.0 1.0
+material
+vertex -1 texture
+material
+1.0
+0.500000 0.500000 -1 -1 0.500000 texture texture vertex anim material -1
+bone frame = =
+= frame texture material anim bone frame -1 material material bone =
+material vertex texture anim vertex frame
+anim
+0.500000 vertex -1 -1 frame 0.500000
+=
+0.500000 frame
+bone
+frame
+material
+-1 = 1.0 texture anim
+material 0.500000 -1 = 1.0 = frame
+vertex
+vertex 0.500000
+1.0
+material vertex
+vertex -1 material bone texture
+bone material bone texture
+material vertex =
+texture 1.0 -1 vertex vertex texture vertex texture bone -1
+texture vertex material bone texture
+bone
+material frame frame texture anim texture 0.500000
+texture 1.0 1.0 bone
+bone -1
+0.500000
+1.0 material anim -1 = texture 0.500000
+bone 1.0
+0.500000 bone anim 1.0 bone
+frame = frame -1 0.500000
+-1 =
+material
+anim -1 texture
+1.0
+frame bone 1.0 1.0 vertex anim frame = 1.0 1.0 1.0
+= 1.0
+bone
+anim = anim -1 1.0 frame frame -1 anim frame bone material -1 material -1 frame vertex = 0.500000 = 1.0 = frame 0.500000
+material -1
+vertex -1
+vertex 1.0 = =
+0.500000 0.500000 material texture material texture
+vertex frame
+= vertex 1.0 1.0 vertex material anim
+-1 vertex anim material
+=
+-1
+vertex ve
\ No newline at end of file
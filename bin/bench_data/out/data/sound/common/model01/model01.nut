@@ -0,0 +1,15 @@
+bone anim anim 0.500000 = bone
+1.0
+0.500000
+1.0 bone
+-1 texture frame
+texture
+= bone
+anim texture anim material 1.0
+bone
+texture texture 0.500000 1.0 frame
+frame
+0.500000 material material vertex bone texture frame 1.0
+material
+0.500000
+0.500000 te
\ No newline at end of file
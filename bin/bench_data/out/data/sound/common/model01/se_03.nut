@@ -0,0 +1,2 @@
+material
+texture vertex anim bon
\ No newline at end of file
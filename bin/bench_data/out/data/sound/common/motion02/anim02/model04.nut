@@ -0,0 +1,6 @@
+anim -1 anim
+frame frame = anim -1 bone
+material frame
+= frame -1 texture vertex vertex anim texture anim -1 frame material
+anim 1.0 material frame frame material 1.0 anim texture -1 texture vertex material vertex bone 0.500000
+b
\ No newline at end of file
@@ -0,0 +1,162 @@
+material material texture frame material
+frame bone anim frame = -1 bone texture 0.500000
+0.500000 -1
+vertex texture bone frame = 0.500000 -1 material 0.500000 bone = 0.500000 -1 vertex -1 -1 bone vertex 0.500000 -1 bone 0.500000
+frame vertex anim -1 vertex
+anim
+1.0 texture
+0.500000
+frame texture
+texture frame anim material = bone vertex
+material texture vertex 0.500000 -1
+=
+bone 1.0 anim bone
+material 1.0 material = material anim texture
+vertex 0.500000 = texture anim
+anim material -1
+material texture
+frame
+vertex
+texture bone = vertex = bone frame texture 0.500000 1.0
+bone material
+0.500000
+1.0
+bone = bone 0.500000 frame material
+vertex
+= bone = material material bone vertex
+=
+texture
+frame
+-1
+0.500000
+vertex vertex material texture vertex
+bone frame
+anim 1.0 frame 0.500000 1.0 -1 texture = material
+vertex 1.0 frame
+frame texture 1.0 frame 1.0 -1 0.500000 = material -1
+bone anim
+=
+frame 1.0 0.500000 texture texture = frame
+-1 anim = bone 0.500000
+-1 bone -1 1.0
+bone
+0.500000 material bone
+material = texture bone anim material
+1.0 0.500000 frame
+-1
+1.0 material -1
+texture 0.500000
+-1 -1 material 0.500000 frame anim anim texture anim frame = vertex = vertex vertex 0.500000 anim frame
+vertex vertex =
+0.500000 material frame vertex
+texture 1.0 anim 0.500000 -1 0.500000 material -1 texture =
+texture material -1
+texture
+= 0.500000 material
+material
+texture
+bone
+= -1 -1 -1 material material 1.0 1.0 frame
+-1 vertex =
+-1 vertex
+= frame
+= -1 material 0.500000 frame texture vertex anim
+=
+vertex -1 bone texture vertex
+frame frame bone =
+texture
+material texture 0.500000 1.0 bone 0.500000 frame
+1.0 material frame -1 bone
+1.0 -1
+vertex
+=
+vertex material 0.500000
+0.500000
+-1 0.500000 anim texture 0.500000 1.0 vertex
+material
+vertex -1 0.500000
+-1
+-1 = bone
+1.0 1.0 0.500000 frame texture 1.0
+bone material vertex vertex
+material frame = -1 frame bone = material
+bone frame -1 texture texture
+vertex
+vertex
+texture anim vertex texture
+1.0
+1.0 bone
+frame vertex vertex material
+1.0 bone = -1 0.500000 0.500000 1.0 bone 1.0 material texture 1.0
+0.500000 anim vertex 1.0
+0.500000 =
+texture frame
+frame
+frame
+anim texture
+bone texture = -1 frame
+bone 0.500000
+texture
+0.500000 bone material vertex =
+texture
+0.500000 vertex
+material
+bone 1.0 vertex 1.0
+vertex frame -1
+vertex anim bone 0.500000
+anim
+material bone -1 anim anim 0.500000 = frame material = -1 = 0.500000 vertex
+material material bone
+= anim anim bone 0.500000
+anim = frame frame
+texture bone
+frame -1 vertex material
+bone -1
+= -1 material
+vertex frame
+anim
+frame 1.0 bone -1
+=
+-1 material texture bone anim bone bone bone bone vertex frame vertex
+0.500000 frame vertex 0.500000
+frame -1 -1 anim vertex -1 vertex
+anim
+-1 anim anim
+bone -1
+anim bone = 0.500000 material
+bone -1
+frame vertex frame
+material
+-1 texture
+anim 0.500000 material
+material -1 vertex vertex texture 0.500000 -1 vertex
+material
+vertex material =
+-1 frame frame anim material
+0.500000
+vertex vertex -1 texture
+vertex
+-1
+0.500000 =
+1.0 -1 -1 anim 1.0 1.0
+= 1.0
+1.0 = bone material texture 1.0
+material
+material frame
+frame bone -1 = 0.500000 texture
+texture
+material texture -1 anim
+anim bone
+= = material 1.0 texture = texture anim bone
+texture 1.0 0.500000 vertex texture bone material anim texture -1 = material bone
+-1 bone
+anim anim frame = vertex bone vertex 0.500000 texture vertex bone material
+vertex bone 0.500000 anim bone 1.0
+-1
+0.500000 1.0
+bone
+0.500000 = material 1.0
+vertex = vertex bone frame
+0.500000 frame anim -1
+material anim
+texture material frame -1 frame = vertex
\ No newline at end of file
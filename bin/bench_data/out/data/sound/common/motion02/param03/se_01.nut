@@ -0,0 +1,31 @@
+frame bone vertex bone
+vertex = vertex -1 0.500000 anim material bone = -1 bone frame frame texture
+vertex
+-1 1.0 material bone 0.500000
+bone
+bone = 0.500000 frame frame 1.0 vertex material 0.500000 bone material
+bone
+0.500000 bone 0.500000
+=
+1.0 1.0
+= anim 0.500000 vertex anim
+= -1 material
+-1 -1 0.500000 anim material 0.500000 vertex
+anim texture material bone
+frame vertex vertex bone 0.500000
+anim
+0.500000 = = 1.0 =
+frame texture
+material bone material
+-1 1.0 anim 1.0 = bone 0.500000 0.500000 material
+material 0.500000 0.500000 texture -1 vertex frame material
+material bone 1.0
+vertex vertex texture
+frame 0.500000 anim vertex -1
+anim frame 0.500000 bone texture -1 0.500000
+frame -1 0.500000 1.0 -1 anim bone material bone anim
+vertex 0.500000 material -1 frame texture material -1 anim 0.500000
+vertex anim bone -1 1.0 1.0 material frame bone vertex
+= 0.500000 0.500000
+0.500000 texture vertex =
+bone 0.500000 material texture material frame frame 0.500000 t
\ No newline at end of file
@@ -0,0 +1,209 @@
+texture
+0.500000 0.500000 vertex
+= anim texture 0.500000 frame = frame
+anim
+vertex
+1.0 frame 1.0 = texture 1.0
+= material anim bone material bone vertex = anim texture -1 material
+bone frame frame frame 1.0 vertex
+= =
+-1 vertex vertex
+bone bone
+= 1.0 frame anim 1.0 anim 1.0 0.500000 texture bone
+bone =
+= bone = = =
+= -1 bone
+1.0 0.500000 -1 frame material anim vertex =
+material 1.0 material 0.500000 texture frame -1 1.0 bone
+1.0 frame anim material 0.500000 bone 1.0 vertex frame frame
+0.500000 anim
+= frame 0.500000 = bone = texture -1 vertex 0.500000 = -1 =
+texture vertex material vertex
+material texture -1 texture -1 texture 1.0 0.500000 material
+vertex 0.500000
+texture frame frame 0.500000 texture -1 -1 1.0 anim texture 0.500000 material
+1.0 frame 1.0 anim -1 anim 0.500000 1.0 texture -1
+= bone
+0.500000 0.500000
+vertex frame
+1.0
+bone frame texture texture -1
+0.500000 -1 anim
+-1 texture -1 vertex -1
+0.500000 bone = frame
+vertex -1 material 1.0
+=
+bone 1.0
+1.0 material 1.0 -1 material frame material
+frame anim material = 1.0 vertex 1.0
+anim
+bone
+frame
+= = 0.500000 bone
+vertex texture
+anim vertex
+material bone
+1.0 anim material vertex frame anim
+frame
+0.500000 anim bone vertex
+frame -1 =
+vertex texture frame =
+anim =
+1.0 frame = = vertex anim =
+anim vertex 0.500000
+material
+-1 0.500000 vertex
+-1 anim bone =
+-1
+frame bone material texture frame bone 1.0 vertex
+bone 0.500000
+anim 0.500000
+vertex anim material frame
+= vertex =
+1.0
+material = 1.0 0.500000
+-1 texture material
+1.0 material = frame -1 -1 bone = material
+texture
+vertex material frame anim texture
+1.0
+1.0
+0.500000 1.0 0.500000 bone
+1.0 1.0 0.500000 vertex material 1.0 anim 1.0
+1.0 vertex vertex
+vertex vertex frame =
+frame texture 1.0 bone 0.500000
+-1 0.500000
+1.0 -1
+-1 0.500000
+material texture = 1.0 vertex vertex bone vertex
+0.500000 1.0
+anim 1.0
+1.0 vertex =
+frame
+frame material
+1.0 -1 0.500000 =
+vertex
+1.0 material 1.0
+bone
+bone 1.0
+vertex texture frame material
+material frame material texture bone
+1.0
+frame -1 0.500000 bone -1 texture 1.0 -1 -1 1.0 frame -1
+frame material = anim 0.500000 frame
+texture 1.0 0.500000 -1
+1.0 vertex anim 1.0 material bone anim
+anim vertex anim anim frame = material 0.500000 1.0
+bone frame anim bone material anim = material vertex material
+0.500000 vertex = = bone
+bone anim
+vertex anim frame =
+frame 1.0 anim frame
+= -1
+= -1 bone anim
+texture =
+-1 =
+frame 0.500000 texture
+vertex 1.0 frame frame
+texture 1.0
+material -1 anim = frame vertex material frame frame anim
+1.0 bone
+0.500000 bone
+material 1.0 texture frame
+= bone
+1.0 -1 vertex 0.500000 0.500000 -1 vertex
+=
+vertex
+material
+texture
+0.500000 1.0 1.0
+= 1.0 material 1.0
+vertex
+1.0 bone material frame -1
+texture frame
+bone anim -1 frame texture frame
+= 1.0 anim = =
+material = anim
+frame -1
+bone frame texture texture
+-1 bone
+1.0 texture anim frame vertex texture
+vertex 0.500000 bone 1.0
+= texture vertex
+texture
+bone 1.0 vertex = 0.500000 = = bone texture -1
+1.0 bone material 1.0 material = -1 0.500000 anim material
+vertex anim
+=
+1.0
+0.500000 anim
+0.500000
+anim texture bone =
+=
+frame frame
+material = anim texture
+vertex
+-1 material 0.500000
+frame -1
+frame 1.0
+material -1
+texture
+frame
+0.500000 -1 0.500000
+bone texture
+bone
+bone vertex =
+frame -1 material frame bone texture
+bone texture 1.0 bone material
+texture vertex 0.500000 = 0.500000 1.0 = frame
+= texture material
+=
+1.0 = -1 0.500000 anim -1 material 0.500000 -1 = bone = anim bone vertex vertex
+-1
+vertex vertex = -1
+bone anim anim bone
+frame frame vertex 0.500000 texture 1.0 material
+1.0 -1
+0.500000 = anim -1
+vertex
+0.500000 anim
+vertex 0.500000 frame 1.0 vertex -1 anim material material anim anim 1.0
+texture texture frame bone
+0.500000 bone
+material vertex anim 0.500000
+vertex texture anim -1 1.0 anim frame anim vertex texture
+-1 material frame texture -1 bone material material texture anim -1 0.500000 -1 bone anim bone frame anim
+1.0 1.0
+bone
+frame 0.500000 1.0 texture =
+1.0 1.0 -1
+= vertex = -1 vertex
+vertex
+bone
+texture 0.500000
+-1 0.500000 vertex
+1.0
+texture texture vertex texture -1
+1.0 material -1
+vertex 1.0
+-1 1.0 anim material material
+1.0 material frame bone
+0.500000 vertex anim
+texture -1
+vertex -1 vertex material -1
+bone texture
+texture material material frame 1.0
+vertex
+= material texture 0.500000 anim
+-1 = material
+1.0 anim texture 1.0 texture
+0.500000 material 1.0 material vertex = = -1 anim -1 vertex
+material -1
+= material 0.500000 frame
+= -1 anim anim material
+bone material 1.0 anim bone -1 vertex
+anim material frame vertex -1
+0.500000
+-1
+0.500000 
\ No newline at end of file
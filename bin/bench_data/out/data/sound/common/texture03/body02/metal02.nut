@@ -0,0 +1,87 @@
+vertex anim anim 1.0
+texture texture -1
+0.500000 -1
+bone frame texture material -1 anim
+0.500000
+texture vertex texture =
+vertex
+bone texture
+material vertex frame anim vertex
+texture vertex
+texture
+= texture vertex anim frame
+vertex
+texture anim frame
+bone 1.0 vertex
+1.0 1.0
+-1
+-1 vertex
+bone
+frame vertex 1.0 bone
+material = frame frame frame anim bone material
+vertex
+material
+= bone bone
+frame 0.500000
+material vertex bone 0.500000
+frame material texture
+= 1.0 frame
+1.0 texture material 0.500000
+1.0 = texture 0.500000 vertex frame anim texture 1.0 -1 -1
+0.500000
+bone
+= 0.500000 0.500000 anim anim
+=
+material texture bone
+texture
+bone bone frame 0.500000
+0.500000
+frame = material -1 = bone texture 0.500000 anim = vertex
+material frame
+bone anim bone -1 anim
+-1 vertex -1 1.0
+1.0
+texture
+material bone 0.500000
+material frame 1.0 texture
+0.500000 material
+texture frame
+texture
+1.0 = =
+bone bone
+material = vertex
+vertex
+vertex
+material
+bone
+texture
+vertex 0.500000
+vertex = bone anim
+material vertex -1 vertex -1 vertex
+texture
+anim
+= bone
+anim frame
+vertex vertex vertex 1.0 1.0
+texture anim vertex 1.0
+texture
+frame = = frame frame material -1 texture
+= bone vertex material
+bone 1.0
+vertex = material bone
+-1 frame anim 1.0
+frame texture anim 0.500000 texture = 1.0 frame material -1 0.500000 0.500000 anim 1.0
+= material 0.500000
+anim anim bone
+= texture 0.500000 anim -1 bone texture
+-1 0.500000 0.500000 texture -1 material bone material anim 1.0 0.500000 -1
+material
+texture frame = bone material
+material
+bone
+= = material frame
+bone = texture frame
+0.500000
+vertex material vertex
+material texture 0.500000 frame bone texture anim anim
+0.50000
\ No newline at end of file
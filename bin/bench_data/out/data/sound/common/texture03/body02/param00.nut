@@ -0,0 +1,27 @@
+-1 1.0
+vertex 0.500000 1.0 anim texture -1 vertex material
+=
+vertex texture material texture
+0.500000 0.500000 frame
+-1
+texture 0.500000 bone 0.500000 -1 = 1.0 texture vertex 0.500000 material texture vertex
+1.0 -1
+0.500000 bone
+-1 bone 1.0 frame vertex -1 -1 frame -1 anim frame anim
+anim material texture vertex frame
+vertex
+0.500000 -1 frame 0.500000
+vertex =
+texture material bone
+texture 1.0 -1 texture
+-1
+bone material -1 0.500000 texture
+texture 1.0 0.500000
+-1
+material = = anim
+anim -1 = material =
+material vertex material 1.0 bone 1.0 material anim vertex texture 1.0 1.0 vertex
+texture -1
+0.500000 0.500000
+frame vertex frame
+vertex 
\ No newline at end of file
@@ -0,0 +1,5 @@
+-1 0.500000 anim =
+1.0
+anim anim
+anim bone -1 =
+bone frame 
\ No newline at end of file
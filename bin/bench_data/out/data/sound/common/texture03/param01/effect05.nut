@@ -0,0 +1,80 @@
+1.0
+frame frame 0.500000 anim -1 1.0
+-1 1.0 anim texture
+texture texture = frame anim
+1.0 frame bone
+anim
+0.500000 texture
+=
+texture bone material frame 1.0
+anim texture anim texture -1 1.0 frame material anim anim
+= -1
+texture frame anim -1 vertex material 0.500000 frame bone = bone
+-1
+1.0 frame
+1.0 anim =
+vertex vertex texture 0.500000 = -1
+frame -1 anim =
+= material anim 0.500000
+-1
+material = texture 0.500000
+anim
+-1 anim 0.500000 -1
+texture vertex anim frame anim frame -1 bone anim anim texture 1.0 material anim = 1.0 texture
+= 0.500000 vertex
+anim frame anim anim anim 0.500000 -1
+1.0 material = material 1.0
+-1 frame vertex vertex 0.500000
+bone material
+frame frame
+-1 anim = vertex 0.500000 texture frame texture 1.0
+= frame anim
+0.500000 texture -1 texture vertex material -1 material 0.500000
+frame anim
+frame texture
+1.0 frame vertex 0.500000 material material frame
+0.500000 texture texture = 0.500000
+= 1.0 -1 anim frame 0.500000 1.0
+0.500000 material -1 frame material anim texture 0.500000
+anim material -1 vertex 0.500000 -1 1.0 anim texture material material vertex vertex texture
+bone material vertex
+-1 anim
+0.500000 frame 0.500000 1.0
+anim texture -1
+1.0 material frame anim =
+vertex -1 texture anim
+anim material vertex frame frame 1.0
+material texture texture
+bone texture
+material
+frame
+material material bone anim
+-1 texture 1.0
+bone texture 1.0
+bone -1 vertex = anim 0.500000 bone texture frame
+= = anim bone =
+material frame anim frame anim bone -1 frame anim
+0.500000 0.500000 vertex vertex 1.0 texture
+1.0 = -1 0.500000
+0.500000
+material texture
+anim -1 anim -1 frame = material
+material
+1.0 1.0 = material texture
+-1
+frame texture anim
+0.500000 texture vertex -1 bone
+vertex anim bone frame bone
+bone vertex
+material 1.0 texture material =
+1.0 bone texture
+texture
+vertex 0.500000 anim bone 1.0 -1 material 0.500000 =
+0.500000 -1 bone anim -1 texture frame = -1
+anim frame
+material 1.0
+bone anim -1 0.500000 material = frame bone 0.500000 frame =
+0.500000 -1 anim
+frame -1 0.500000 texture
+anim
+fr
\ No newline at end of file
@@ -0,0 +1,6 @@
+vertex 0.500000 bone frame 1.0
+texture
+1.0 texture = = -1
+0.500000
+texture vertex anim 1.0 1.0
+1.0 bone frame frame mate
\ No newline at end of file
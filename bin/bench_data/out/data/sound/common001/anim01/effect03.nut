@@ -0,0 +1,128 @@
+material -1 frame
+texture vertex texture 0.500000
+texture = vertex vertex vertex vertex frame
+0.500000 anim 0.500000 frame 1.0 frame 1.0 material 1.0 0.500000 frame texture texture frame
+texture bone texture
+= 0.500000
+= anim
+1.0
+texture = =
+1.0
+= vertex
+vertex = material anim anim -1 0.500000 -1 1.0
+vertex -1 anim material vertex = bone material vertex vertex anim frame -1
+texture -1
+=
+frame
+= anim frame vertex frame 0.500000 material bone material frame texture 1.0 1.0 0.500000 frame =
+= = material bone 1.0 anim 1.0 bone 0.500000 material vertex vertex bone frame -1 texture
+1.0
+bone bone 0.500000 frame
+bone
+0.500000 texture -1 1.0
+0.500000
+0.500000 material 0.500000 1.0 material anim frame -1 texture -1 bone 0.500000 vertex 0.500000 frame 0.500000 0.500000 material
+material 1.0 frame vertex bone material = vertex anim
+material
+frame 0.500000 anim material bone
+-1
+material bone 1.0 material = anim
+material = vertex
+vertex =
+0.500000 frame =
+vertex bone material
+-1 -1 = 1.0
+material texture 1.0 frame =
+-1 anim texture vertex
+-1 0.500000
+material 1.0 1.0 -1 anim
+1.0 0.500000
+0.500000 0.500000
+texture
+= anim 1.0
+-1
+vertex vertex
+0.500000
+0.500000
+vertex 1.0
+vertex
+0.500000 material
+-1 bone vertex anim 1.0
+=
+vertex 0.500000
+-1 1.0 1.0 1.0 anim -1
+-1 bone texture vertex
+anim
+material =
+1.0 frame =
+0.500000 texture 0.500000 material texture material
+frame
+= =
+0.500000 0.500000
+1.0 frame =
+texture
+-1 0.500000 bone material vertex material vertex vertex anim =
+0.500000 bone frame
+0.500000 bone texture = texture texture
+texture 1.0
+bone
+anim
+texture bone anim material 1.0 vertex 0.500000 bone vertex anim bone material vertex
+= -1
+frame bone 1.0
+material vertex
+bone material
+= 1.0 frame vertex
+material 1.0
+bone vertex material
+frame bone material 1.0 anim = 0.500000 frame material frame frame 0.500000 = 1.0 0.500000
+material bone texture
+-1 = anim 1.0 1.0 frame vertex texture =
+anim = anim material
+vertex frame
+anim texture material = 0.500000 vertex 0.500000 material
+= 0.500000 material
+anim material texture bone
+= 0.500000
+texture material = 0.500000 = material
+texture -1
+-1
+texture vertex
+= vertex vertex vertex 1.0 -1
+vertex anim 1.0 texture
+vertex vertex bone anim = texture material material =
+1.0 frame
+material -1
+frame = anim
+anim bone anim bone
+= texture -1 bone texture material material bone
+= 0.500000 vertex 1.0 frame 0.500000 = vertex -1 frame 1.0 bone anim 1.0
+1.0 0.500000 frame 1.0
+material 1.0
+texture 0.500000 0.500000
+= texture -1 anim vertex
+anim material = 1.0 bone anim 1.0
+material 0.500000 1.0 material 1.0 0.500000 frame
+bone bone -1 0.500000 frame -1 1.0 1.0 0.500000 bone -1
+texture material
+texture vertex
+frame
+1.0
+material material bone material vertex -1 texture = anim anim bone 1.0 1.0
+vertex bone frame -1 vertex
+-1
+= = frame -1 0.500000 vertex bone 1.0 = -1 -1 = -1 texture vertex
+anim -1 bone texture
+anim
+-1 = -1 material material -1 frame
+-1 = bone frame
+frame
+0.500000
+bone 1.0
+material material =
+= bone texture anim frame material texture -1 bone 1.0 -1
+anim
+bone
+frame frame 0.500000 texture 0.500000 texture
+1.0
+material vertex -1 anim 1.0 bone anim 1.0 
\ No newline at end of file
@@ -0,0 +1,125 @@
+bone
+anim texture
+frame
+bone frame texture
+bone material frame 0.500000 frame frame 1.0
+frame 0.500000 vertex texture frame 0.500000 0.500000 texture material texture bone
+-1 -1 texture material 1.0 vertex material bone
+vertex = texture -1 bone 0.500000 material texture frame
+bone texture frame material anim -1 texture
+0.500000
+bone 1.0 bone vertex anim anim material vertex frame
+bone 0.500000 0.500000 frame
+vertex 0.500000 material = anim
+bone vertex vertex =
+bone = anim bone
+1.0 anim anim vertex bone
+0.500000 vertex 0.500000 bone 1.0 -1 texture
+-1 1.0 frame material frame material vertex material texture -1 1.0
+material
+vertex anim texture 0.500000
+-1 anim vertex anim bone material 0.500000 -1
+material
+texture =
+= -1
+0.500000 bone texture anim
+bone -1 1.0 frame 1.0
+material vertex bone 1.0 bone
+bone = frame
+anim anim
+frame 1.0 texture
+material 1.0
+1.0 vertex vertex -1 0.500000 vertex 1.0 1.0 = -1 frame bone
+anim material 1.0 -1 texture = anim vertex anim
+anim anim -1
+frame texture
+vertex
+= 0.500000 1.0 anim texture vertex anim vertex vertex 0.500000 anim 0.500000 -1 -1 vertex bone
+anim bone
+texture 1.0 bone material
+material = anim -1 texture
+texture
+bone
+bone -1 texture 1.0 vertex
+= 0.500000 frame -1
+1.0 =
+texture texture
+vertex bone
+vertex material vertex -1 bone = =
+vertex vertex 0.500000 material
+material -1 bone 1.0 bone vertex 1.0 0.500000 frame
+vertex bone texture material bone bone frame = vertex texture bone
+frame bone material anim 1.0 -1 anim frame frame
+texture
+0.500000 anim 0.500000 material = texture 1.0 = bone 0.500000 anim frame -1 frame
+0.500000 frame -1 1.0
+=
+material -1 =
+frame bone bone texture 0.500000 1.0 anim
+-1 =
+frame
+-1 texture bone material frame bone anim material bone
+anim
+frame vertex 0.500000 vertex
+texture frame
+vertex anim
+=
+-1 -1
+0.500000 vertex 0.500000 0.500000
+frame anim frame vertex = = 1.0
+0.500000 vertex
+vertex anim texture frame 1.0 anim
+material
+bone 0.500000 bone
+= material 1.0 bone anim anim anim
+0.500000
+frame
+texture bone frame
+vertex
+-1 0.500000
+material
+texture = material 1.0
+vertex 0.500000 material 0.500000 1.0
+bone
+= frame =
+texture frame
+1.0 frame =
+bone
+material material frame -1 vertex texture anim
+vertex =
+vertex
+texture -1 frame 0.500000 0.500000 anim 0.500000 bone anim frame 1.0 -1 0.500000 texture vertex 0.500000
+-1
+= 0.500000 bone frame anim
+= bone = frame -1 anim material bone -1 -1 texture texture = anim anim
+texture
+texture texture 0.500000 material material
+texture frame texture vertex bone vertex
+1.0 frame
+texture =
+-1
+anim -1 anim 0.500000
+-1
+material 0.500000 bone vertex
+0.500000 0.500000
+0.500000 0.500000 vertex 0.500000
+anim anim
+-1
+0.500000 = -1 bone anim vertex
+material material anim 1.0 1.0 bone
+1.0 texture texture frame -1 0.500000 texture -1
+vertex frame material
+0.500000
+vertex =
+vertex frame material bone 1.0 texture frame frame = texture -1 -1 = anim
+material frame 1.0 material = 1.0
+material
+texture = anim frame bone vertex vertex texture bone material
+material -1 -1 bone
+material texture
+texture texture 1.0
+frame vertex
+anim texture texture frame frame
+= texture 0.500000 frame = bone 0.500000
+1.0
+anim material 
\ No newline at end of file
@@ -0,0 +1,55 @@
+vertex
+texture bone 1.0 -1 = vertex frame material -1 vertex -1
+anim material = 1.0 =
+material frame frame
+-1 1.0
+frame bone vertex = material vertex vertex 0.500000 0.500000 texture
+frame -1 -1 -1 vertex
+-1 frame
+bone anim frame
+0.500000 frame -1
+material = 0.500000 frame
+= = frame bone
+anim
+1.0 anim
+1.0 -1
+vertex = 1.0 anim anim texture material frame
+= texture material
+-1 0.500000
+frame frame 1.0 -1 vertex -1 material vertex anim
+material
+1.0 0.500000 1.0
+texture frame bone material texture frame 1.0 material anim frame anim frame 1.0 -1 1.0
+anim 0.500000 vertex bone frame anim texture material material 1.0 -1
+-1
+bone
+=
+-1 vertex 1.0 0.500000 = 0.500000 1.0 material frame frame -1 texture
+vertex -1
+1.0 = vertex -1 vertex =
+frame
+texture -1 0.500000 anim
+-1 -1 frame
+= -1 0.500000 = -1 material frame
+=
+material -1 vertex -1 frame anim -1 =
+-1
+texture
+anim bone -1
+1.0 0.500000 bone
+material frame bone
+bone
+material material texture anim material
+texture anim bone vertex
+anim bone bone
+material = 1.0 0.500000 =
+= frame = -1 vertex = 0.500000 anim -1 vertex frame bone -1 1.0 0.500000 frame -1 vertex 1.0
+1.0 material = material -1
+1.0
+= texture -1 =
+anim
+-1 1.0 material anim vertex -1
+1.0 = texture -1 0.500000 -1 texture
+texture
+texture 0.500000 0.500000
+-1 anim anim b
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex frame 0.500000 -1 frame = = anim material bone frame anim =
+material texture vertex bone bone 1.0
+= texture bone material 0.500000 1.0 material texture material
+=
\ No newline at end of file
@@ -0,0 +1,165 @@
+bone vertex = bone bone material anim texture texture
+0.500000 vertex material -1 0.500000
+bone
+1.0 vertex frame anim
+frame frame
+vertex = 0.500000 anim 1.0 0.500000 frame
+-1 =
+vertex 0.500000 anim
+-1 anim 1.0
+0.500000 -1 anim -1 = material = 1.0
+1.0
+-1
+bone material 1.0 bone bone bone
+vertex material bone material
+anim
+bone bone = -1 0.500000 0.500000 material
+bone =
+bone = 0.500000
+bone material -1
+1.0
+0.500000
+texture 1.0 -1
+texture vertex
+0.500000 bone anim frame 1.0 0.500000 bone texture = -1
+anim material
+1.0 1.0 0.500000 0.500000 -1 vertex frame
+vertex
+bone texture frame vertex vertex
+texture -1
+=
+0.500000
+texture vertex 1.0 material bone bone 1.0 vertex
+material frame
+=
+= = = frame frame
+-1 anim -1 texture
+frame material
+anim =
+material -1
+vertex texture anim =
+texture material texture material 0.500000 material anim 0.500000
+-1 = -1 frame
+bone frame material frame vertex 1.0 1.0
+texture -1 anim frame
+material
+vertex -1 frame
+material
+bone 0.500000
+texture material frame
+texture vertex material -1
+material 1.0 -1 anim -1 -1
+vertex texture = frame 1.0 bone vertex frame
+vertex frame bone texture =
+material frame bone -1
+material material bone =
+material frame frame bone 1.0 -1 bone =
+1.0 texture 0.500000 frame
+texture vertex bone anim
+1.0 frame vertex vertex vertex texture vertex -1
+bone bone anim anim texture 1.0
+material anim material vertex vertex -1 texture 1.0 bone
+-1
+bone
+1.0 0.500000 =
+0.500000 anim material 1.0 1.0
+-1 bone
+0.500000 0.500000
+bone
+anim = vertex anim bone
+vertex texture anim -1 anim
+=
+= material = -1 0.500000 vertex texture
+bone
+-1
+vertex vertex vertex material bone 0.500000 -1 material 0.500000 material
+1.0 frame
+1.0
+material frame vertex
+frame
+anim frame material bone
+-1 1.0 0.500000 material vertex = anim material 0.500000 -1 material
+anim frame -1 1.0
+=
+frame material
+1.0 bone 1.0 -1 bone = frame
+bone
+vertex texture 0.500000 material 1.0 texture frame = texture bone
+bone = -1 frame 0.500000 anim
+material =
+anim 1.0
+-1 material
+anim texture 1.0 0.500000 frame texture
+bone texture bone 1.0
+-1 bone texture 0.500000 material vertex bone texture
+frame
+vertex =
+= -1 material
+texture texture
+= -1 bone 1.0 = 1.0 -1 1.0 = -1 frame bone -1 0.500000
+anim = 0.500000 -1 0.500000 anim
+= 0.500000 anim
+bone vertex 1.0 -1
+= frame frame anim 0.500000 0.500000 texture
+1.0 -1 1.0 = frame anim -1
+frame vertex vertex vertex frame
+1.0 = frame texture -1
+=
+= material anim 0.500000
+bone 0.500000 bone anim frame 0.500000
+frame -1
+frame vertex 0.500000
+vertex 1.0 material
+texture
+= bone vertex
+-1 1.0 material vertex = 0.500000 0.500000 texture -1 frame vertex
+vertex
+frame
+material =
+1.0 anim
+frame frame material vertex -1 0.500000
+vertex texture bone frame 0.500000 anim anim 0.500000 1.0 frame 0.500000 texture 1.0 anim -1 texture = vertex 0.500000
+= -1 -1 0.500000
+1.0
+anim bone -1
+vertex bone anim -1 = -1 -1 -1
+0.500000 texture 1.0 anim = -1
+0.500000
+1.0
+= texture material 1.0
+anim 1.0
+vertex 0.500000 anim 0.500000 anim material bone -1 = -1 vertex
+vertex material
+1.0
+bone
+=
+frame anim = frame = vertex material
+-1
+vertex texture
+= anim bone 1.0 material 1.0 material anim bone
+vertex
+vertex 1.0 bone =
+frame anim 1.0 vertex = bone texture
+=
+bone
+1.0 frame 1.0 -1 0.500000 bone
+texture vertex anim
+texture = frame
+0.500000 0.500000
+= 0.500000 vertex frame
+frame vertex
+= 1.0 = -1 bone frame material bone 1.0
+vertex = frame
+material material bone
+bone anim =
+0.500000 frame anim 0.500000 bone
+vertex
+material = 0.500000 bone material 0.500000
+material
+anim = material anim vertex
+= texture 0.500000
+frame =
+-1 bone 0.500000 vertex = =
+vertex -1 = material anim bone frame 0.500000 anim -1 frame vertex bone texture -1
+frame =
+0.500000 anim 
\ No newline at end of file
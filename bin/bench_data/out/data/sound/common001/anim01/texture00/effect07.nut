@@ -0,0 +1,129 @@
+anim -1 frame texture
+bone 0.500000
+material
+vertex material -1 bone vertex bone -1 vertex frame
+texture texture material -1 -1 = bone
+-1
+1.0
+texture bone 1.0 vertex =
+0.500000
+vertex -1 = -1
+frame bone material
+frame bone texture = bone -1
+= 0.500000
+vertex
+frame -1 texture
+frame texture vertex
+texture -1
+bone -1 texture vertex 0.500000 0.500000 material bone
+bone
+0.500000
+anim texture
+-1 texture material 0.500000 0.500000
+1.0 0.500000 1.0 texture material bone bone
+anim vertex vertex 1.0 material -1 anim anim anim
+texture vertex material texture
+frame vertex bone 1.0 bone
+bone
+0.500000 vertex bone
+-1 = 1.0 0.500000 vertex 0.500000
+texture frame = vertex 0.500000 texture anim vertex
+-1
+-1
+1.0 0.500000 0.500000 vertex
+0.500000 -1
+anim 0.500000 bone 1.0 texture frame
+anim =
+0.500000 vertex 0.500000 0.500000 texture frame 0.500000
+vertex
+frame = anim
+vertex texture
+anim 0.500000
+frame texture
+texture = material 0.500000
+texture 0.500000
+texture texture frame anim 1.0 = frame frame texture 0.500000 vertex material
+bone material bone anim -1 bone frame -1 texture bone vertex anim
+-1 frame 0.500000 -1 anim bone 1.0 texture 1.0
+material -1
+0.500000 0.500000 material -1
+= texture texture material texture 0.500000
+0.500000
+0.500000 texture vertex vertex vertex 1.0
+texture texture material
+vertex = 0.500000
+anim -1 material anim frame frame
+vertex vertex
+-1 1.0 = -1 =
+bone 1.0
+1.0 texture
+= anim bone
+texture bone =
+-1 1.0 material anim -1 texture texture = bone
+1.0 1.0 anim 1.0
+vertex
+-1 texture frame material material = -1 1.0 = anim
+texture 1.0
+0.500000 texture 0.500000 frame
+vertex -1 0.500000 anim = material bone material frame = material 1.0 texture frame
+material = anim
+0.500000 anim 0.500000 0.500000 0.500000 anim vertex bone bone
+material
+bone anim texture anim = frame = anim 1.0 vertex
+=
+1.0 bone bone 1.0 frame bone material vertex
+= frame
+texture
+0.500000
+1.0 anim texture
+bone
+-1
+texture frame 1.0
+anim material texture
+=
+= bone 0.500000 1.0 vertex 1.0
+0.500000 bone -1 texture -1
+texture material
+texture anim anim
+texture 1.0 material 1.0
+texture
+1.0
+material anim frame
+material bone
+vertex frame
+anim texture anim
+-1 frame -1 bone texture
+vertex
+1.0 anim
+1.0
+texture bone
+1.0 = 0.500000
+= -1 bone frame
+0.500000 0.500000 texture frame anim bone
+material 1.0 anim vertex anim vertex material vertex anim
+bone 1.0 frame
+frame bone
+texture 0.500000
+1.0 frame -1 1.0 frame 1.0 -1 0.500000 0.500000
+material
+frame anim = -1 0.500000
+anim vertex = 0.500000 = vertex -1
+frame 0.500000 = vertex = 0.500000 texture 1.0 material = vertex vertex anim = 1.0
+-1 material vertex vertex frame
+material -1 texture frame texture
+0.500000
+1.0 -1
+anim = 1.0 frame
+frame 1.0 = vertex bone 0.500000 = -1 bone texture material bone
+frame
+vertex
+material
+1.0 material bone material -1 bone frame
+material
+0.500000 -1 bone anim material texture vertex anim vertex
+frame 0.500000 texture 0.500000 = frame bone 0.500000 0.500000 anim 1.0 frame vertex =
+frame frame
+1.0 = bone material bone anim 1.0 bone
+1.0 texture anim texture
+0.500000 anim vertex
+bone bone texture 1.0 
\ No newline at end of file
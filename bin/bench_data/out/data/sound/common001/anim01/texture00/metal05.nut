@@ -0,0 +1,19 @@
+material texture anim
+vertex frame frame 0.500000 texture frame 1.0 -1
+= 0.500000 1.0 vertex -1 0.500000
+=
+frame
+0.500000 anim -1
+-1 texture anim
+0.500000 bone 1.0 frame bone 1.0 frame = = -1 anim material frame
+-1 material = = anim
+bone bone bone material
+texture vertex
+texture -1 material -1 bone bone material
+=
+anim texture = material vertex bone bone =
+material 0.500000
+texture
+anim -1
+1.0 0.500000 texture 1.0
+0.500000 0.500000 bone = ani
\ No newline at end of file
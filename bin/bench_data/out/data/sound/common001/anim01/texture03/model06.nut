@@ -0,0 +1,53 @@
+-1 = material frame 0.500000 1.0
+texture texture
+anim material 0.500000 bone texture = 0.500000 = 0.500000 -1 = material bone
+-1 0.500000
+1.0 = material = anim 1.0 texture
+anim =
+0.500000 texture texture
+1.0 0.500000 material vertex bone texture -1 frame = vertex = bone texture
+texture anim = texture frame texture
+material =
+material frame
+bone =
+=
+texture
+vertex frame vertex =
+vertex vertex
+= frame 1.0 bone
+1.0
+texture texture vertex frame frame frame
+texture bone
+material material vertex
+1.0
+1.0 material frame -1 1.0
+-1
+material 0.500000 =
+0.500000 vertex material
+frame
+-1 texture
+frame
+0.500000 -1 frame = bone vertex texture vertex texture
+vertex anim frame material bone 0.500000
+-1
+material = bone material
+bone anim 0.500000 texture bone anim
+= =
+texture anim =
+= texture
+frame bone bone 1.0
+-1 anim = vertex material vertex
+1.0 =
+= = bone 0.500000 0.500000 frame bone -1 vertex frame = frame bone -1 material material
+0.500000 1.0 frame -1 anim
+bone = vertex 1.0
+bone
+anim = = 1.0
+bone
+material -1 material vertex frame
+texture
+frame vertex =
+anim bone =
+material 1.0 bone 1.0
+texture 0.500000 texture 1.0 -1
+ver
\ No newline at end of file
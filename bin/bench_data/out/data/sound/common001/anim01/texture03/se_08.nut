@@ -0,0 +1 @@
+v_?(vÏ<3rg%HShg FiL_4v
\ No newline at end of file
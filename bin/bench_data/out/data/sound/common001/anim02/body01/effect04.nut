@@ -0,0 +1,2 @@
+texture vertex frame 1.0 anim -1 texture
+fr
\ No newline at end of file
@@ -0,0 +1,13 @@
+texture -1
+anim
+texture anim bone = =
+vertex
+1.0 1.0 =
+anim 1.0 frame =
+vertex
+material = 1.0 bone material = 1.0 = frame texture anim
+bone bone
+vertex frame
+1.0 1.0 vertex =
+bone -1 -1 -1 = texture texture 0.500000 -1
+texture 0.500000 anim 0.500000 0.500000 frame material frame -
\ No newline at end of file
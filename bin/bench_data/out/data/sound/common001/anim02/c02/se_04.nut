@@ -0,0 +1,8 @@
+1.0 bone
+vertex 1.0 frame
+texture material
+material frame anim vertex
+texture texture = texture 0.500000
+-1
+frame vertex
+-1 bone -1 0.5
\ No newline at end of file
@@ -0,0 +1,295 @@
+anim material bone 0.500000 0.500000 -1 0.500000
+frame 0.500000 texture = texture
+anim
+frame texture -1 1.0
+anim frame 0.500000 material bone 1.0
+material 1.0
+bone frame anim
+vertex anim 1.0 -1
+-1 texture
+-1
+anim 1.0
+material = anim
+vertex = = 1.0 1.0 material 0.500000 texture anim 1.0 anim 1.0 1.0
+-1 bone
+1.0 material 1.0
+0.500000 -1 -1 -1 -1
+material
+vertex anim -1
+1.0 anim 0.500000 bone vertex anim frame 1.0 vertex 0.500000 -1
+0.500000 anim
+0.500000 0.500000
+0.500000 vertex frame
+material frame texture texture = vertex
+anim vertex
+anim anim material 0.500000 bone
+anim = = anim texture
+anim
+1.0
+0.500000 1.0 -1 material
+texture
+material bone -1 vertex
+bone =
+1.0 anim vertex frame
+frame -1
+1.0 bone material material vertex 1.0
+material
+anim frame
+1.0 =
+texture 0.500000
+-1 = = 0.500000 0.500000 vertex
+vertex vertex material bone
+1.0 1.0
+material bone anim texture frame =
+= -1 0.500000 0.500000
+-1
+material -1 frame texture material 1.0
+anim
+texture
+frame
+texture material
+bone
+1.0 =
+anim vertex material =
+0.500000
+material -1 bone vertex 1.0 material bone
+=
+anim = anim -1
+vertex 0.500000 vertex 1.0
+frame anim bone
+= material
+= 0.500000 bone -1 material -1 -1 bone 1.0 vertex material 1.0 -1 material
+vertex bone anim frame vertex frame
+texture
+vertex texture
+0.500000
+-1 texture
+1.0 vertex
+1.0 bone -1
+texture
+frame vertex
+texture =
+vertex
+bone = texture -1 frame
+1.0 texture 0.500000
+= vertex 1.0 1.0
+anim
+1.0 frame anim anim
+vertex texture 0.500000
+texture = -1 -1 anim frame -1 material -1 frame
+bone 0.500000 vertex = -1 0.500000
+0.500000 -1
+material frame
+-1 material vertex 1.0
+0.500000 material vertex anim bone frame frame texture
+frame vertex bone bone 1.0 1.0 0.500000 = = = 0.500000 anim frame
+texture
+vertex 0.500000 anim vertex texture material
+0.500000 material material anim -1 anim -1
+texture = vertex
+-1 1.0 anim anim bone vertex =
+0.500000 texture anim frame 0.500000 material
+texture
+frame bone
+texture bone
+frame bone frame texture bone vertex vertex
+anim
+frame anim 0.500000 bone texture -1
+-1 bone frame 1.0 =
+-1 =
+= 0.500000 texture vertex bone
+material vertex
+0.500000 1.0 texture bone -1 = material bone anim 1.0
+0.500000 anim bone anim -1 1.0
+1.0 bone frame
+material
+= 1.0 =
+material -1
+frame 1.0
+1.0 bone material material 0.500000 texture
+anim material = vertex material = material
+material = anim material
+frame
+bone material
+material
+1.0
+texture -1
+material material bone vertex frame vertex texture 0.500000 frame texture 1.0 0.500000
+bone
+anim vertex = = anim material material 1.0 -1
+material anim -1
+bone
+anim texture 0.500000 0.500000 vertex frame
+anim vertex
+0.500000 = texture bone vertex 1.0 -1 = frame
+vertex -1 bone bone bone
+frame 0.500000
+0.500000
+0.500000 -1
+texture texture
+frame material material
+material
+anim texture
+anim
+frame
+-1 -1
+0.500000 anim texture material bone
+-1 -1 -1 material -1 material -1 0.500000 -1
+texture frame 1.0 vertex frame material bone anim bone 1.0 material material 1.0
+texture
+-1 texture anim vertex vertex -1 1.0 bone vertex vertex
+texture material bone 1.0
+0.500000
+texture 1.0
+-1 material
+vertex
+texture vertex -1
+anim = anim material material bone texture bone
+frame material 0.500000 -1 anim vertex texture = = texture
+1.0 = frame
+1.0 0.500000 0.500000 material 0.500000 texture bone
+1.0 bone
+anim = texture anim material frame 1.0 -1
+bone bone
+bone
+texture texture
+frame = vertex anim
+texture
+-1
+anim material
+bone =
+vertex vertex frame bone texture frame
+bone 1.0 texture 1.0 -1 anim frame vertex
+anim texture 1.0
+vertex material
+0.500000 -1 -1 vertex vertex anim frame frame 0.500000 texture vertex bone bone 0.500000 frame material
+0.500000 bone 0.500000 1.0 = anim anim
+0.500000 -1 vertex
+vertex bone 1.0 bone =
+material 0.500000 vertex vertex 1.0
+anim
+0.500000 material
+bone bone bone frame 1.0 = bone -1
+bone = 0.500000
+-1
+0.500000 frame =
+material material 1.0 1.0 1.0 texture bone 1.0 = vertex material bone 0.500000 material 0.500000 texture frame
+= vertex texture vertex 1.0 -1 = anim -1 = anim frame 1.0 = bone
+0.500000 bone anim
+vertex
+1.0 texture 0.500000 vertex texture
+-1 texture 0.500000 = vertex vertex
+vertex -1 frame material -1
+texture
+1.0 texture texture texture
+material
+material frame
+anim vertex =
+anim
+1.0 -1 = material
+texture 1.0 1.0 texture texture bone
+frame texture = 1.0 vertex = 0.500000 0.500000 -1 0.500000 1.0 =
+0.500000 anim
+texture
+-1
+anim vertex vertex =
+material frame
+material
+1.0 frame vertex
+vertex -1 material bone bone
+frame = vertex bone 1.0 texture
+-1 -1 frame 0.500000 frame bone vertex -1
+bone material material 1.0 anim material
+vertex bone
+bone 1.0 material 0.500000 frame 0.500000 vertex bone texture
+-1 bone 1.0 vertex 0.500000 0.500000 1.0 -1 bone
+texture bone material
+= texture frame = vertex
+bone vertex bone frame -1 frame texture texture texture anim bone 1.0 -1
+material vertex anim material material frame anim 1.0 frame frame
+-1
+0.500000 = anim
+anim 0.500000 bone
+frame
+frame
+1.0
+material
+0.500000 0.500000 -1 frame
+= material
+bone texture vertex vertex
+frame
+material
+-1 -1 anim bone
+texture -1
+1.0 texture -1 material
+1.0
+-1 bone texture 1.0 material bone 0.500000 = 0.500000
+-1 texture
+texture texture anim
+bone frame 1.0
+0.500000 texture
+bone =
+vertex
+frame vertex
+-1
+material texture =
+frame -1 material texture
+1.0 bone vertex material -1 anim 1.0 = 1.0 0.500000 vertex -1 anim 1.0 0.500000 bone
+frame
+texture = 1.0
+bone material
+1.0 material
+texture frame -1
+anim vertex vertex
+0.500000 anim 0.500000
+material bone
+frame 1.0 -1 anim bone 0.500000 -1 texture 0.500000 anim = bone 1.0 texture
+anim texture =
+1.0 1.0 0.500000 1.0 material anim texture 1.0
+anim
+=
+anim anim = 1.0
+frame material material -1 material anim
+anim frame
+anim 1.0
+= texture
+frame texture frame
+= frame =
+texture bone frame material material
+-1
+texture texture bone
+1.0
+bone
+-1 1.0 1.0 anim =
+bone texture
+-1 0.500000 bone
+bone
+1.0 texture anim
+= frame = frame bone =
+vertex 0.500000 texture frame texture bone frame = texture
+texture 1.0 1.0 = material 1.0 vertex
+1.0 frame 1.0 -1
+=
+anim bone
+material texture anim material
+1.0
+-1 = 1.0 = vertex -1
+texture 1.0 bone texture bone material = 0.500000 anim
+bone anim
+1.0 anim =
+material = frame texture
+= = bone
+material anim
+-1 anim material = material anim material =
+vertex frame
+-1 anim material
+0.500000
+texture -1 1.0 -1 frame
+= texture 1.0
+1.0 material texture bone
+= =
+vertex
+=
+bone texture 0.500000
+texture 0.500000 frame
+fram
\ No newline at end of file
@@ -0,0 +1,11 @@
+= vertex bone
+frame
+texture
+-1 vertex
+bone vertex frame 1.0 = frame bone vertex
+vertex texture frame vertex 1.0 = bone =
+frame
+= = 1.0 material 0.500000 1.0 frame 0.500000 1.0 1.0
+vertex bone bone
+anim material 1.0 vertex vertex = frame
+1.0 bone
\ No newline at end of file
@@ -0,0 +1,21 @@
+bone
+vertex bone texture vertex
+1.0 1.0 anim texture bone -1 = frame bone 0.500000
+material material 0.500000 1.0 frame -1 texture material texture -1 anim frame material texture vertex material
+texture anim
+-1 frame texture texture
+0.500000 frame texture
+anim -1
+vertex anim
+vertex 0.500000 1.0
+anim anim
+texture texture
+0.500000 material anim
+frame vertex = frame
+bone -1 vertex = anim texture
+texture vertex frame
+bone material
+bone 0.500000 texture -1 =
+vertex
+frame frame
+bo
\ No newline at end of file
@@ -0,0 +1,330 @@
+material
+1.0 vertex
+-1 material texture 0.500000 vertex 0.500000
+bone vertex anim anim = material anim 0.500000
+texture 1.0 -1 vertex 1.0 -1
+vertex 1.0 -1 -1 vertex bone 0.500000 0.500000 bone texture =
+frame bone frame = frame anim bone texture anim
+= frame
+1.0 = -1
+-1 material
+material 1.0
+= anim frame
+vertex frame anim 1.0 bone 0.500000 texture anim 0.500000 1.0 vertex 0.500000 anim -1 vertex = -1 frame frame vertex 1.0 anim anim vertex 1.0 anim material -1
+vertex 0.500000 texture 1.0
+vertex 1.0 material
+bone anim 0.500000 vertex = anim frame
+1.0 texture
+frame -1 =
+-1 vertex bone frame = 0.500000
+=
+frame
+texture =
+1.0 vertex
+texture 1.0 -1 bone 0.500000 bone
+1.0 0.500000 material bone material -1
+material vertex 0.500000 texture texture vertex
+1.0 1.0
+material
+vertex material
+vertex
+0.500000 anim frame material bone vertex vertex anim material anim texture texture bone texture bone 0.500000
+= texture anim = anim material material = -1 bone =
+frame texture texture = vertex vertex = material 1.0 1.0
+anim 1.0 anim 0.500000 material frame texture bone anim 1.0 0.500000 1.0 material bone bone anim bone
+bone 0.500000 material
+= 1.0 texture bone
+1.0 texture frame
+anim -1 -1 -1
+frame material =
+1.0 anim bone anim
+= vertex -1 material 1.0 frame anim -1 bone vertex 1.0
+frame -1
+texture texture texture = 0.500000
+-1 frame 0.500000 1.0 = 1.0 1.0 =
+bone
+material anim
+bone 0.500000 =
+1.0 anim
+frame -1 1.0 texture -1 bone
+0.500000 -1 frame vertex 0.500000 texture
+frame bone material = -1 frame material 0.500000 frame
+vertex 1.0
+-1 material bone bone
+bone = anim -1 vertex vertex texture material texture
+bone -1 bone bone vertex = bone bone texture texture material anim
+frame vertex frame texture bone 0.500000 -1
+anim material frame 0.500000 vertex
+anim material
+= -1
+-1 frame bone 0.500000
+frame
+frame
+0.500000 = 0.500000 1.0 anim -1 0.500000 texture frame texture material 0.500000 1.0 -1
+0.500000 texture -1 texture
+1.0 material material anim bone
+texture vertex frame anim =
+vertex anim 1.0 0.500000
+bone = anim anim
+= bone -1
+anim 1.0 texture
+bone frame bone bone
+texture
+material frame 0.500000 vertex 0.500000 bone 1.0 -1 -1 =
+1.0 = frame material = texture = bone bone bone anim bone = texture material frame material frame 1.0 0.500000 1.0 anim 1.0 0.500000 0.500000 texture 1.0 anim texture texture frame anim 1.0 material bone 0.500000 0.500000 material 0.500000 1.0 vertex frame 1.0
+0.500000 0.500000
+anim frame 0.500000 frame 1.0 material
+material
+=
+bone 1.0 bone material material
+vertex 1.0 0.500000 = 0.500000 texture anim 1.0 vertex
+= vertex vertex texture material 1.0 1.0 0.500000
+texture anim vertex frame anim frame 1.0 1.0 material = material material texture anim
+vertex material anim texture -1 frame material vertex frame vertex
+material 0.500000
+0.500000 = 0.500000
+-1 1.0 1.0
+frame = 1.0
+frame texture -1 vertex
+bone
+anim =
+1.0 bone material -1 anim anim
+vertex = frame
+frame -1
+vertex
+frame vertex =
+bone -1 1.0 material
+bone 1.0 vertex
+1.0 = anim
+material 0.500000
+frame material -1 vertex 0.500000 0.500000
+texture 1.0
+frame vertex anim 1.0
+-1
+0.500000 vertex -1
+bone 1.0 anim -1 1.0 frame frame
+vertex bone
+1.0
+texture anim
+-1 -1 0.500000
+=
+-1
+anim 0.500000 = = 0.500000 vertex texture 0.500000 0.500000 bone anim 1.0 =
+material texture -1 -1 -1
+bone frame
+vertex bone
+bone -1
+vertex
+= = -1
+= frame
+frame -1 vertex 1.0 -1 -1 frame -1
+anim
+= anim vertex 0.500000 bone bone material material vertex bone
+vertex
+frame frame
+bone 1.0
+=
+frame material anim
+anim
+vertex frame 1.0 material
+1.0
+-1 anim 1.0 texture frame vertex 0.500000 anim -1 frame vertex = 1.0 =
+texture vertex vertex = frame -1 texture material 1.0 material vertex -1 texture
+0.500000 material
+1.0 -1 = = -1 0.500000 frame material texture -1 bone
+0.500000 = vertex 1.0 1.0 frame
+texture 1.0
+vertex bone 0.500000
+vertex = material
+1.0
+frame vertex frame = material frame
+vertex anim =
+material 0.500000 texture
+1.0 -1 -1 vertex frame
+0.500000 -1 = material texture frame
+-1 = anim 0.500000 =
+anim
+0.500000 anim vertex 1.0
+anim texture 1.0
+= -1 1.0 frame 1.0 bone frame
+= vertex 0.500000
+frame texture vertex bone 0.500000
+-1 vertex
+-1 frame vertex -1 frame = vertex 1.0 bone material = frame
+frame 1.0
+frame material
+bone
+-1 1.0 material anim 1.0 vertex texture -1 anim material
+texture 0.500000 texture vertex = 1.0 vertex frame material texture 0.500000 0.500000 -1
+=
+= 0.500000
+-1 bone
+1.0 1.0 frame anim anim vertex texture material material
+texture
+1.0 texture 0.500000
+bone material material
+1.0 material
+anim -1 0.500000 bone
+= material
+anim -1 texture -1 vertex vertex 0.500000
+0.500000 vertex
+-1
+1.0 texture -1 frame
+vertex vertex =
+-1 bone 0.500000 frame 0.500000 = frame frame
+-1 texture anim texture
+texture
+-1 frame bone -1 material
+vertex texture anim anim bone bone 1.0
+vertex anim
+0.500000 anim 0.500000
+frame 0.500000 material material
+texture
+bone anim material anim vertex -1 vertex anim 0.500000 bone bone
+vertex
+bone bone -1
+=
+frame vertex texture
+texture
+anim vertex
+0.500000 anim 0.500000 anim texture 1.0
+frame vertex
+frame
+0.500000 0.500000 -1 -1 0.500000 -1 texture
+= bone
+= 0.500000 frame frame
+bone material frame
+= = frame vertex 1.0 1.0 anim anim 0.500000
+material =
+anim -1
+vertex 0.500000 bone texture bone
+frame 0.500000 1.0 anim bone
+bone frame
+= =
+anim
+0.500000 anim 0.500000 texture
+frame 1.0 = bone
+= 1.0 anim frame
+0.500000 1.0 material vertex
+material bone
+bone anim bone texture anim texture anim bone anim anim
+anim = = = -1 material -1 material material -1 texture
+-1 = vertex -1 bone
+vertex
+bone texture 0.500000 -1 texture anim
+anim
+0.500000
+1.0 bone -1 = anim -1
+texture vertex frame texture
+texture bone material 1.0 vertex frame 0.500000 1.0 -1 material
+= bone
+texture
+vertex 0.500000
+frame material
+-1 texture vertex anim bone 0.500000
+vertex
+1.0 0.500000 anim texture
+bone frame vertex
+vertex -1
+1.0
+0.500000 anim
+= frame
+1.0
+0.500000 = 1.0 -1 texture = vertex 1.0 anim -1
+vertex frame
+0.500000
+0.500000
+bone texture =
+=
+material
+1.0 -1 -1 -1
+0.500000 1.0 1.0 vertex bone anim 0.500000 -1 = -1 texture
+-1 frame bone
+texture = anim vertex =
+frame frame texture
+frame 1.0 anim
+frame anim
+-1
+0.500000
+bone anim bone material -1 texture 0.500000 1.0 vertex texture frame texture
+material anim texture
+-1 -1
+vertex anim texture vertex
+= material 1.0 anim 1.0 bone
+frame frame
+texture 0.500000 anim
+-1
+material bone 0.500000 frame anim vertex 0.500000 = frame vertex anim -1 vertex anim 0.500000 0.500000
+anim anim = vertex
+material anim vertex texture
+0.500000 anim
+material 1.0 material = = -1 =
+frame
+bone frame
+vertex frame vertex -1
+vertex -1 = 0.500000 = 1.0 1.0
+texture bone
+-1 bone texture -1 1.0
+-1 anim
+texture texture -1 vertex =
+= -1 0.500000 =
+texture
+texture vertex material
+frame
+0.500000 material
+1.0 0.500000
+material -1
+texture
+0.500000
+= material texture -1 1.0
+=
+bone 1.0 bone 1.0 1.0
+frame
+texture 0.500000 1.0 = vertex vertex
+vertex vertex
+anim 1.0 = anim -1
+0.500000 bone
+0.500000 texture texture
+material material 0.500000 bone anim vertex 0.500000 texture anim -1
+vertex -1 frame
+texture 0.500000 = -1 texture 0.500000 vertex 1.0 vertex -1 = bone anim bone frame
+vertex material
+texture vertex = -1 anim -1 material 0.500000
+= anim
+= vertex anim frame texture material
+bone 1.0
+bone material = = = frame material anim texture vertex material
+frame 0.500000 material 1.0 -1 bone vertex -1 anim
+-1
+anim -1 = anim anim 0.500000 material texture = frame anim = anim bone texture 1.0 vertex
+bone = material vertex vertex 0.500000 anim texture = 1.0 0.500000
+-1 material vertex 1.0
+texture = = frame
+vertex anim = = material bone bone bone
+-1 bone texture bone
+material material
+anim 1.0
+frame
+texture frame vertex 1.0 texture = anim frame anim = texture 0.500000 texture 1.0 frame frame anim
+texture texture vertex
+0.500000 1.0 -1
+0.500000 = bone 1.0 1.0
+bone
+material
+1.0
+vertex vertex
+= texture
+bone bone texture
+= texture
+0.500000 = bone frame 1.0
+texture -1
+anim
+texture material frame
+material frame 0.500000
+vertex frame
+= texture 0.500000 vertex -1
+0.500000
+texture
+-1 bone
+anim texture bone anim bone bone
+0
\ No newline at end of file
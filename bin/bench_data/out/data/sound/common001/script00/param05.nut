@@ -0,0 +1,65 @@
+texture -1 bone
+texture
+= bone vertex material texture texture
+= = = frame
+material vertex texture
+bone 0.500000 frame
+texture vertex -1 = material =
+anim frame -1 material = anim
+0.500000 = bone frame -1 anim material 1.0 vertex
+-1 0.500000
+vertex -1
+frame bone frame 1.0 anim vertex 0.500000
+anim
+texture 0.500000
+1.0
+texture 0.500000 vertex
+vertex anim
+vertex bone vertex bone texture
+1.0 frame anim frame texture anim =
+-1
+-1 vertex 0.500000 anim vertex
+texture 1.0 frame vertex = = frame
+1.0
+-1 vertex 1.0 anim =
+1.0 -1 anim 1.0
+-1 frame material frame -1 anim vertex
+material texture frame vertex frame -1
+1.0 frame texture frame 1.0 -1 material = 1.0
+texture
+-1 frame texture
+vertex texture 0.500000 0.500000 =
+vertex
+texture material vertex = bone = texture = -1
+-1 bone 0.500000 -1
+texture
+texture 1.0 anim bone material -1 =
+material material
+bone -1 anim -1 anim material
+frame
+texture
+-1 bone bone
+0.500000 anim -1 anim material
+0.500000
+-1 material anim texture = texture anim
+material 1.0 bone =
+anim frame -1 frame
+=
+bone
+bone frame texture
+bone =
+bone = 0.500000 0.500000 1.0
+anim frame frame
+anim bone 0.500000
+frame 0.500000 anim frame bone
+frame
+frame 1.0 vertex vertex vertex vertex vertex anim vertex =
+0.500000 texture -1 -1 anim vertex vertex
+1.0 = -1 0.500000 0.500000 -1 frame
+vertex 1.0
+= 1.0
+0.500000 0.500000
+anim anim = 0.500000 = frame
+0.500000 texture vertex = anim frame -1
+= -1 vertex vertex bone bone vertex 1.0 1.0 vertex
+-1 1.0 bone
\ No newline at end of file
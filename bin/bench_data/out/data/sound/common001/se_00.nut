@@ -0,0 +1,51 @@
+= 0.500000
+texture
+bone
+texture anim material -1 vertex 0.500000 texture 0.500000 material frame anim bone material 1.0
+0.500000 1.0 1.0 = texture 1.0 0.500000
+frame material = bone 0.500000
+bone
+0.500000 = vertex texture -1 0.500000
+anim vertex texture
+texture 1.0 = frame
+0.500000 1.0 1.0 vertex -1 anim frame 0.500000 anim frame 0.500000 vertex 0.500000 bone -1 vertex
+0.500000 -1 anim
+1.0 0.500000 anim 0.500000 material -1
+-1
+anim texture 1.0 bone =
+-1 1.0 -1 material material
+material material texture
+0.500000 1.0 0.500000
+= bone 1.0 -1 vertex
+bone = vertex anim
+material material -1
+texture texture
+material 0.500000
+-1 texture bone material 0.500000
+frame = -1
+vertex texture frame anim =
+1.0
+vertex
+texture
+= texture
+vertex
+material
+vertex vertex
+vertex anim 0.500000 material
+frame 0.500000 bone 0.500000 vertex anim = 0.500000
+material
+anim texture 1.0 bone frame -1 vertex vertex texture -1 -1
+frame texture 0.500000 texture = -1 material bone anim bone
+1.0
+bone 0.500000 texture -1 material anim 0.500000 texture
+vertex 0.500000 = -1 texture = frame frame bone material -1 vertex 0.500000
+bone = texture = vertex 0.500000 1.0 bone frame bone frame material -1 frame texture bone
+texture
+texture =
+vertex vertex 1.0 -1 texture -1 vertex
+anim 0.500000 vertex bone bone vertex
+-1 = anim
+texture 0.500000
+0.500000 1.0 material anim anim frame vertex frame 1.0
+texture material bone
+anim ma
\ No newline at end of file
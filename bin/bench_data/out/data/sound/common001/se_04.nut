@@ -0,0 +1,107 @@
+1.0 1.0 -1 bone vertex material anim bone bone
+material bone
+bone
+frame vertex material material anim frame
+bone -1 1.0 anim vertex 0.500000 = anim texture anim anim anim 0.500000 bone
+material anim frame 1.0 texture anim
+bone -1 0.500000 -1 =
+vertex
+material frame vertex anim = vertex -1 material = anim -1 =
+1.0 material 1.0
+frame
+vertex texture
+-1
+frame material 1.0 anim
+= material
+material vertex 1.0 0.500000
+bone
+bone =
+1.0
+material 1.0 anim texture
+anim bone 0.500000 bone
+vertex material texture
+bone material bone vertex anim vertex vertex 0.500000 texture material material vertex bone = frame anim 1.0
+1.0 -1
+bone -1
+0.500000 =
+1.0 bone material 1.0 anim = anim 1.0 texture 0.500000
+vertex texture = bone texture
+texture bone 1.0 = vertex vertex -1
+0.500000 frame
+material material bone -1 material -1 anim bone
+material 0.500000 = -1
+texture
+= -1 material
+-1
+bone = texture 0.500000 0.500000 = material 0.500000
+anim material texture -1
+anim = frame = texture texture vertex material = -1 bone material 1.0 1.0 vertex -1 =
+1.0 texture 1.0 1.0 bone frame material = 1.0 bone anim 0.500000 bone 1.0 1.0 1.0
+1.0
+vertex vertex vertex
+0.500000
+vertex
+vertex 1.0
+anim frame
+frame
+anim =
+anim bone = =
+material bone frame
+anim 1.0 = bone texture material anim
+bone 0.500000 1.0
+vertex frame anim = anim anim frame = 0.500000 0.500000 material texture
+0.500000 1.0 vertex 0.500000
+bone frame -1 vertex 1.0
+-1 frame material
+0.500000 vertex material
+frame vertex frame
+vertex 0.500000 anim anim vertex
+frame frame
+material 0.500000 frame bone -1 bone = = vertex frame vertex frame
+= bone material bone anim texture anim = bone 1.0 frame -1 0.500000 anim
+anim
+1.0 frame
+vertex anim -1
+-1 material 1.0 material 0.500000 1.0
+-1 anim texture vertex vertex material frame
+1.0 bone 0.500000 anim
+texture
+material material 0.500000 texture = =
+frame 0.500000 frame material 1.0 vertex
+0.500000 vertex =
+0.500000 material
+=
+bone
+texture
+texture = bone = 1.0 =
+0.500000 frame
+bone
+= anim
+-1 -1 bone anim frame
+vertex 0.500000 texture
+= anim anim material anim = 1.0 0.500000
+frame 0.500000 = vertex
+frame frame 0.500000 texture texture anim 1.0 anim -1 bone anim texture anim -1 bone texture
+0.500000 = -1
+anim 1.0 = material bone
+1.0 texture
+frame anim material
+texture frame material 0.500000 -1
+vertex 0.500000 frame
+= -1 anim texture bone -1 bone 0.500000 material -1
+-1 = anim texture bone texture anim material frame 0.500000 texture 1.0 frame frame
+1.0
+1.0 texture
+bone vertex material anim anim -1 texture
+bone -1 0.500000 1.0 frame 0.500000
+vertex anim anim material frame vertex bone
+= vertex
+bone = -1 = =
+material = material
+anim
+vertex anim material material
+1.0 anim bone bone bone anim
+= 0.500000 bone frame anim
+= -1 bone 1.0 texture
+1.0 = material bone
+1.0 anim vertex
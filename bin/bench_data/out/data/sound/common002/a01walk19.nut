@@ -0,0 +1,25 @@
+0.500000 bone = texture material
+1.0 = 1.0
+material
+frame = vertex vertex
+0.500000
+bone anim =
+vertex vertex vertex 1.0
+= anim = = 1.0 material 1.0 texture bone
+anim -1
+1.0
+=
+= bone frame anim
+material anim anim 1.0 =
+anim frame texture frame = anim
+bone
+material vertex 0.500000 material frame material
+0.500000 frame vertex 1.0 frame
+-1
+bone
+frame -1
+bone frame 0.500000
+-1 -1
+=
+vertex
+fr
\ No newline at end of file
@@ -0,0 +1,4 @@
+bone -1
+texture material -1 material -1 =
+texture
+-1 anim -
\ No newline at end of file
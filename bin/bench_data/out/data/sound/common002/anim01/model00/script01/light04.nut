@@ -0,0 +1,14 @@
+material -1 0.500000 anim
+bone
+0.500000 texture = frame 0.500000 anim -1 material 1.0 frame bone texture vertex 0.500000
+material
+anim vertex 0.500000 1.0 anim 1.0
+anim frame 1.0
+-1 texture
+bone 1.0 anim 0.500000 1.0
+-1 1.0
+1.0 1.0 anim
+material vertex vertex anim bone
+material bone frame 1.0 bone texture = texture =
+bone = anim -1 vertex material -1 -1 anim anim bone -1
+frame vertex vertex material ani
\ No newline at end of file
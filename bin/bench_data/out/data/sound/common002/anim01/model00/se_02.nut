@@ -0,0 +1,3 @@
+material texture anim 1.0
+1.0
+mate
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 material = bone anim = frame vertex
+anim bone anim
+anim
+vertex 0.500000 frame vertex texture anim
+-1 vertex
+-1 
\ No newline at end of file
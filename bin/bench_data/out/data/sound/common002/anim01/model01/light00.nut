@@ -0,0 +1,13 @@
+1.0 frame -1
+1.0 frame bone 1.0 vertex anim
+texture -1 anim
+texture
+frame vertex 0.500000
+= 1.0 material frame = frame
+texture 0.500000 0.500000 texture -1 1.0
+material
+vertex anim texture bone = anim bone texture
+anim texture material
+0.500000 bone 0.500000 material
+1.0 0.500000 bone = -1
+0.500000 bone 0.500000 material texture texture 1.0 -1 an
\ No newline at end of file
@@ -0,0 +1,27 @@
+bone anim 1.0 1.0 bone texture =
+bone material 1.0 1.0 bone 1.0
+-1
+material
+-1 anim anim frame 1.0 texture -1 bone frame texture anim
+0.500000 material 0.500000 anim
+0.500000 material = bone
+vertex
+texture
+= 0.500000 vertex bone
+vertex 0.500000 frame frame vertex material
+-1
+anim frame material texture 0.500000 texture material 0.500000 texture
+= 0.500000 material bone vertex vertex texture 1.0 0.500000
+texture texture = bone material material bone frame texture 0.500000
+bone frame 1.0 texture = frame
+material
+vertex vertex
+-1 vertex
+0.500000
+texture 0.500000 anim -1 frame anim 0.500000 0.500000 texture 0.500000 frame material bone -1 -1
+bone bone material anim -1 texture 0.500000
+texture
+-1 frame = texture
+= texture 1.0 1.0 material 1.0 material 0.500000 vertex bone
+= = vertex
+mat
\ No newline at end of file
@@ -0,0 +1,10 @@
+0.500000 anim 1.0 frame -1 texture
+= 0.500000 1.0 1.0 frame material
+0.500000
+-1 1.0 frame 0.500000 frame
+bone
+bone =
+frame
+0.500000
+vertex 0.500000 texture texture texture vertex
+texture bone anim 
\ No newline at end of file
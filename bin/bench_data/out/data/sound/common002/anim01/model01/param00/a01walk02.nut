@@ -0,0 +1,19 @@
+bone material 0.500000 frame
+-1 bone anim texture frame 1.0
+1.0 -1 material 0.500000
+= bone 1.0 1.0
+anim
+material =
+bone = material bone vertex 1.0 material 1.0
+=
+= anim vertex
+= 1.0 frame
+1.0
+= -1 bone vertex 1.0
+material
+vertex 1.0 bone
+material vertex bone material =
+= anim -1
+1.0 -1 frame material 1.0 1.0 1.0 = material
+material bone
+bone vertex
\ No newline at end of file
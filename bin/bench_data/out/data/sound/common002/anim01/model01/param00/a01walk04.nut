@@ -0,0 +1,92 @@
+anim 0.500000 texture
+frame
+vertex
+material
+-1 frame = material material = texture vertex texture material -1 = frame material
+bone -1 material vertex texture
+1.0
+1.0 -1
+anim bone -1
+vertex 1.0 -1 texture 0.500000 material
+bone anim 0.500000 = = vertex -1
+bone vertex material vertex
+0.500000 material
+0.500000
+1.0 bone 0.500000 = -1 0.500000 texture frame
+1.0 frame
+material = bone 0.500000 -1 frame 1.0 0.500000 frame
+bone vertex texture material vertex vertex material texture -1 1.0
+anim material 0.500000 bone texture anim
+1.0 vertex 0.500000 =
+0.500000
+= -1 vertex vertex -1
+anim bone = bone anim 1.0
+anim frame
+frame material 1.0
+texture bone 0.500000
+texture texture = -1 =
+1.0 texture material bone
+texture
+anim
+1.0 vertex
+texture -1 material 1.0 anim
+frame anim -1
+material
+vertex 0.500000
+vertex
+anim 0.500000 anim bone
+vertex 0.500000
+texture
+1.0 bone 0.500000 1.0 vertex anim -1 anim frame material material = texture = -1 bone -1 frame texture
+anim
+-1 vertex frame
+anim -1 material -1
+0.500000 = frame
+-1
+material
+bone material bone
+anim texture vertex 1.0 0.500000 bone 1.0 anim anim
+frame bone anim anim
+anim = vertex
+anim
+anim
+frame frame -1 material bone
+frame = vertex material frame
+0.500000 frame
+anim -1 1.0
+-1 frame bone texture material vertex
+texture frame = 0.500000 bone bone frame vertex 0.500000
+vertex frame
+bone
+1.0 vertex bone = 0.500000
+material material
+bone
+material = = 1.0 texture
+1.0
+frame
+vertex vertex
+anim frame =
+1.0
+vertex
+0.500000 material frame anim 1.0 0.500000 frame vertex -1 -1 = anim 1.0
+-1 material texture bone = frame -1 anim
+texture 0.500000 0.500000 frame texture = material vertex
+anim material frame = bone material
+-1 vertex bone
+-1 material bone vertex vertex material = -1
+frame
+=
+= frame anim
+-1 -1
+anim vertex
+texture
+= vertex bone -1 texture texture
+texture texture bone bone material
+1.0 material
+bone bone bone = 1.0 frame 0.500000 texture 1.0
+anim
+vertex frame -1
+texture frame bone bone
+= = = anim texture frame
+texture texture frame vertex
+anim 0.500000
\ No newline at end of file
@@ -0,0 +1,54 @@
+bone 1.0 1.0 1.0 frame frame bone 1.0 frame
+1.0 frame
+frame material = = = bone
+material
+anim -1 0.500000 -1 1.0 vertex material
+anim material anim bone -1 bone -1 vertex texture anim texture material -1 bone
+material 0.500000 0.500000 texture
+texture -1 frame frame 1.0 0.500000
+1.0 anim = texture anim material anim texture 0.500000 = anim
+1.0 = 0.500000 texture vertex
+vertex = frame
+frame
+-1 frame anim vertex -1 1.0 material 1.0
+0.500000 vertex
+texture anim texture
+bone texture vertex vertex frame frame texture frame anim 1.0 bone -1 -1 0.500000 texture -1 bone -1 material
+texture frame
+vertex vertex 0.500000
+0.500000 frame anim
+0.500000 -1 frame anim vertex anim bone texture
+0.500000
+anim = 0.500000 frame
+bone
+vertex
+-1
+frame
+0.500000
+0.500000 0.500000 vertex
+-1
+= texture 0.500000 -1 = -1 texture vertex
+vertex -1 1.0 anim -1 -1 vertex bone
+frame 0.500000
+material material vertex anim 0.500000 frame
+vertex anim frame 0.500000 texture -1
+frame
+= 1.0 frame
+vertex texture anim = anim
+anim -1 material = texture
+0.500000 texture
+vertex anim 1.0 texture
+anim = bone
+vertex vertex 0.500000 texture
+vertex material material bone frame material bone anim vertex
+material
+bone 0.500000 vertex bone bone -1
+material anim material
+material material 0.500000 frame vertex
+texture frame -1 texture -1 1.0 material anim anim 1.0 anim
+bone 0.500000 = = bone 0.500000 =
+texture vertex
+vertex 0.500000 frame
+=
+texture anim =
+1.0 anim = 0.50000
\ No newline at end of file
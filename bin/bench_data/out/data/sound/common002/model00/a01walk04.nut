@@ -0,0 +1,22 @@
+bone bone
+bone
+material 0.500000
+frame 0.500000 vertex texture
+texture
+-1 0.500000
+-1
+0.500000 1.0 material 1.0 material
+1.0 -1 0.500000 vertex material texture
+frame = =
+1.0
+-1
+-1
+anim
+1.0 = 1.0 0.500000 -1 vertex material vertex texture 1.0 texture frame
+-1 = texture vertex
+1.0 1.0 material texture 0.500000 material
+0.500000 -1
+anim material
+= material
+material -1 frame vertex frame texture 1.0
+material bone 1.0 anim vertex 0.500000 material vertex vertex anim bone 1.0 1.0 mater
\ No newline at end of file
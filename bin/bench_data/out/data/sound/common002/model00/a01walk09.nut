@@ -0,0 +1,18 @@
+= material material frame
+material = material = anim material 1.0 0.500000 frame -1
+vertex
+=
+= bone bone 1.0 vertex anim texture -1
+=
+frame
+vertex 1.0 frame
+0.500000
+-1 0.500000 anim frame
+bone
+-1 anim
+material -1
+anim frame frame
+1.0 -1 texture 1.0 bone frame -1 vertex -1
+material
+vertex
+material 1.0 = texture texture 1.0 -1 material 1.0 0.500000 ver
\ No newline at end of file
@@ -0,0 +1,3 @@
+texture frame = vertex =
+0.500000 = anim -1 1.0
+material -1 = vertex -1 texture fra
\ No newline at end of file
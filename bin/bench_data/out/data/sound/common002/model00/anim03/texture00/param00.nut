@@ -0,0 +1,19 @@
+anim 0.500000 frame vertex
+frame material 1.0 anim anim
+bone vertex 0.500000 anim
+material
+0.500000 = =
+1.0 vertex vertex 1.0 bone 1.0
+vertex material material -1 bone anim vertex
+1.0 -1 frame 1.0
+1.0 texture
+frame = 0.500000 texture vertex texture anim
+material
+-1 vertex
+bone
+frame -1 -1 -1 vertex bone texture
+texture bone frame texture texture
+material 1.0
+-1 frame texture 1.0 vertex
+= texture anim = bone texture =
+vertex bone 0.500000 frame material texture = fram
\ No newline at end of file
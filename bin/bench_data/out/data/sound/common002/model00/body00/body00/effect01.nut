@@ -0,0 +1,11 @@
+-1 anim
+bone -1
+anim vertex
+frame
+material texture 0.500000 material bone texture = = 1.0 frame texture -1 0.500000 1.0 vertex vertex
+1.0
+texture vertex 0.500000
+vertex
+anim = texture vertex vertex material -1
+vertex
+anim bone tex
\ No newline at end of file
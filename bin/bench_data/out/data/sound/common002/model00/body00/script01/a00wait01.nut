@@ -0,0 +1,4 @@
+= -1 = bone
+frame 0.500000 bone 0.500000 -1
+anim frame frame vertex material texture
+1.0 = material 1.0 = 1
\ No newline at end of file
@@ -0,0 +1,18 @@
+vertex 0.500000 = texture -1 texture frame 0.500000 texture vertex anim -1 -1 material
+anim frame anim 1.0 bone =
+bone material frame
+= -1 -1 frame 0.500000 -1 material
+material texture anim
+texture anim = texture -1
+vertex
+1.0 = frame texture anim 1.0
+-1 vertex
+material vertex =
+frame vertex vertex anim
+frame anim
+bone texture anim
+1.0 0.500000 texture
+texture
+1.0 vertex 1.0 vertex
+-1 0.500000 texture
+-1 an
\ No newline at end of file
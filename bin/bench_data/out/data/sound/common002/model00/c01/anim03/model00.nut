@@ -0,0 +1,4 @@
+= frame 0.500000 =
+anim bone 0.500000 1.0 1.0 bone 1.0 -1 vertex texture frame frame texture frame = vertex 1.0
+material
+0.5
\ No newline at end of file
@@ -0,0 +1,232 @@
+= -1 texture -1 bone material
+bone anim 1.0 = texture
+bone frame 0.500000 = = anim material vertex texture 0.500000 vertex 1.0
+= vertex texture
+0.500000 bone
+-1 vertex -1 vertex bone
+0.500000 frame texture
+material
+material = material texture
+frame
+vertex texture frame vertex
+1.0 1.0 anim bone 0.500000 texture 0.500000
+frame 0.500000 anim
+vertex = material bone
+= vertex vertex frame anim
+1.0 vertex vertex 0.500000 anim bone material 1.0 anim texture
+vertex 0.500000
+= frame
+-1 frame = material vertex anim
+-1 =
+= 0.500000 texture
+1.0 frame
+= anim texture anim frame
+-1 1.0
+bone material bone texture -1 anim 0.500000
+texture 0.500000 anim = bone 1.0 =
+vertex 0.500000 anim anim = material frame
+bone
+0.500000
+vertex bone
+-1 vertex
+vertex bone material
+= vertex texture 0.500000 texture anim
+frame bone vertex 0.500000
+frame material -1 1.0 bone texture bone
+anim 1.0
+bone frame
+1.0
+frame 0.500000 vertex
+frame
+-1 material
+anim -1
+bone = -1 0.500000
+1.0 anim = frame material
+material
+1.0 texture =
+= vertex = 0.500000 material
+material texture anim vertex anim 1.0
+1.0
+bone 0.500000
+vertex vertex = -1
+frame vertex = 0.500000 anim bone
+vertex frame vertex
+texture
+frame texture bone anim -1 anim anim bone =
+= 1.0 anim
+bone
+anim
+0.500000
+0.500000 frame bone texture frame texture bone
+-1
+=
+frame vertex vertex frame bone = 1.0 1.0 anim
+0.500000 0.500000
+anim = bone material 1.0 1.0
+material = frame
+-1 material
+material anim anim texture =
+1.0 texture material
+vertex -1 anim vertex 0.500000 -1
+anim anim 0.500000 texture 0.500000 bone
+= bone -1
+vertex -1
+material anim vertex =
+anim anim -1
+-1 = 0.500000 texture = 1.0 = texture bone anim
+material frame anim anim material 0.500000 frame 0.500000 0.500000 texture 0.500000 material
+0.500000 -1 0.500000
+bone anim bone 1.0 0.500000 bone frame
+texture bone bone -1 texture
+texture vertex bone vertex
+bone = texture -1 1.0 texture texture bone -1 0.500000 bone
+= 0.500000 texture anim 1.0
+bone
+= frame
+=
+0.500000
+-1
+anim =
+0.500000 anim 1.0
+1.0 1.0 vertex
+vertex
+=
+anim
+frame frame
+-1 0.500000 texture vertex frame 0.500000
+bone texture =
+bone = vertex vertex frame = 0.500000 anim
+vertex anim texture texture
+vertex
+0.500000
+vertex = vertex
+1.0 1.0 vertex 0.500000 = anim
+-1 frame vertex 0.500000 0.500000 material 1.0
+anim
+= frame anim
+=
+=
+texture vertex anim 1.0
+texture vertex bone
+0.500000 0.500000 bone 1.0 = 1.0 texture
+texture = vertex anim anim = texture anim 1.0 material frame 1.0
+0.500000 material anim
+1.0
+anim -1 = texture
+-1 = 1.0 bone bone anim 1.0 1.0 = 1.0 -1 anim texture material =
+anim
+= material 1.0 0.500000
+material = 1.0 frame -1
+material bone
+texture 1.0
+vertex frame anim = texture texture
+bone 1.0 bone frame bone anim frame
+bone
+-1 material vertex anim -1 frame bone anim -1
+bone vertex vertex =
+bone texture material
+texture
+bone =
+0.500000
+bone =
+-1 anim =
+material
+= 1.0
+-1 = texture
+texture frame
+-1 0.500000 texture material texture -1 1.0 vertex -1
+1.0 texture
+-1
+anim bone
+0.500000
+-1 vertex bone 1.0 -1 frame bone texture 1.0 = frame =
+material 1.0
+vertex vertex 0.500000 0.500000 bone bone frame material = vertex texture bone
+anim texture 1.0 vertex frame 0.500000 vertex texture frame -1 = anim -1 vertex texture 1.0 vertex 0.500000 anim 1.0
+1.0 frame -1
+texture anim 1.0 = = vertex 1.0 0.500000 0.500000 = anim 0.500000
+anim 0.500000 bone
+= bone texture -1 vertex anim 1.0 anim
+bone
+texture frame anim -1 vertex =
+texture
+frame texture
+= vertex frame 1.0 vertex -1 bone = anim frame texture bone
+bone -1 frame 1.0 0.500000 anim 1.0 bone
+material
+vertex
+anim -1 0.500000 = vertex -1 texture
+bone 1.0 1.0 material bone bone
+bone
+-1
+= material 0.500000
+vertex
+0.500000
+= frame = material
+1.0
+-1 frame frame -1 vertex =
+= texture texture
+anim 1.0
+bone material material 0.500000 anim frame anim anim 0.500000 bone
+anim 1.0 anim frame frame anim 0.500000 -1 frame
+-1
+-1 0.500000
+frame
+anim frame bone -1 0.500000 0.500000 texture frame 1.0 0.500000
+frame bone bone
+1.0 texture frame material vertex
+vertex
+1.0 anim texture
+material frame frame = 0.500000 texture texture 0.500000 = texture bone -1 =
+0.500000 1.0
+texture
+texture 0.500000 material frame anim material anim
+0.500000 -1 = -1 0.500000 0.500000
+material
+anim 1.0 material
+bone -1 texture
+0.500000 texture 0.500000 =
+0.500000 bone bone 1.0
+1.0 bone
+texture texture anim
+frame = anim texture anim
+0.500000
+vertex frame
+anim 0.500000 anim bone material -1 vertex
+1.0 1.0 material frame texture anim -1 material 0.500000 vertex
+-1
+= -1 texture vertex = texture = 0.500000 vertex 1.0 1.0 0.500000
+vertex vertex
+vertex
+1.0 -1 1.0
+anim anim anim frame 1.0 bone 0.500000 1.0 frame
+-1 -1 material
+material anim texture texture =
+frame vertex
+material texture
+1.0
+= = vertex -1 texture -1
+frame =
+anim bone vertex 0.500000 =
+=
+0.500000
+bone frame anim
+1.0
+texture 0.500000
+0.500000 0.500000 = 1.0 1.0 anim -1 material = material vertex
+-1 frame vertex -1 vertex
+material material vertex vertex
+0.500000 = anim vertex anim bone
+1.0 1.0 frame bone
+frame material bone
+1.0
+-1 -1 frame material 0.500000 texture frame frame material 1.0 vertex
+= vertex -1 vertex = frame bone
+vertex
+frame 1.0 -1 -1 0.500000 1.0 =
+anim
+anim =
+texture texture
+0.500000 bone bone 0.500000 vertex
+bone texture
+= bone bone bone -1 verte
\ No newline at end of file
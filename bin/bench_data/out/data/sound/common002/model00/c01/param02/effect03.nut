@@ -0,0 +1,5 @@
+0.500000 anim
+=
+= 0.500000
+texture 1.0 0.500000
+1.0 
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1 material vertex
+-1 anim 0.500000
+anim 
\ No newline at end of file
@@ -0,0 +1,6 @@
+= anim texture vertex 1.0
+-1
+-1 frame texture anim 0.500000 anim
+-1 material texture texture frame
+= -1 vertex
+material 1.0
\ No newline at end of file
@@ -0,0 +1,108 @@
+material
+bone texture 1.0 bone
+-1 1.0
+-1
+1.0 vertex
+texture = vertex texture 1.0
+vertex
+material 1.0 vertex vertex 0.500000 texture
+1.0
+= 1.0
+frame vertex material texture bone 0.500000 vertex =
+anim 0.500000
+frame material
+0.500000 bone texture vertex anim
+= vertex =
+0.500000 0.500000
+frame texture -1 material material = 1.0 -1 anim =
+= material vertex 1.0 material = frame -1 frame 0.500000
+material = material bone texture texture = = anim texture -1 material anim texture bone 1.0 material material
+bone
+frame
+= texture anim texture frame = 0.500000 material texture bone
+anim anim texture
+vertex bone texture frame
+= 1.0 0.500000 vertex frame texture texture frame =
+= bone = 0.500000 bone texture
+material bone bone
+-1
+texture texture
+bone material 1.0
+frame 1.0
+1.0 0.500000 vertex = vertex
+0.500000 =
+=
+1.0 bone -1
+anim vertex 0.500000 vertex 1.0 1.0 vertex texture
+material -1 frame -1 1.0
+= -1 -1 1.0 anim
+1.0 anim -1 anim 1.0 vertex vertex vertex -1 material = 0.500000 -1
+= 1.0 frame 0.500000 texture texture texture -1 0.500000
+bone 1.0 = vertex
+texture -1 anim anim
+anim texture
+anim texture 0.500000 material vertex -1 material texture anim
+material
+bone material anim bone texture = = 0.500000
+= material -1 vertex
+anim texture
+=
+1.0 material bone bone -1
+-1 1.0
+texture frame material vertex -1 -1 frame
+vertex texture vertex material anim
+0.500000 vertex 1.0
+=
+anim 0.500000 -1 1.0 texture
+vertex
+texture bone =
+0.500000 anim =
+material 1.0 material
+bone bone =
+texture frame
+bone = material anim texture 0.500000 frame
+0.500000 1.0 material
+bone -1 0.500000 vertex
+1.0 vertex bone anim bone
+1.0 bone frame 0.500000 frame
+bone anim
+frame anim =
+= anim bone
+material vertex frame texture frame
+-1
+frame bone -1 frame
+texture 1.0 -1 texture = frame bone
+material texture 0.500000 material material
+frame = material anim texture material material anim texture frame 1.0 anim texture 1.0 0.500000 anim
+material
+material frame = material anim texture bone frame anim vertex bone
+texture frame vertex
+material
+-1 vertex 1.0
+anim material bone anim
+0.500000 texture frame
+-1 1.0 material frame frame frame
+0.500000 frame
+0.500000 = -1
+= texture bone
+-1 = vertex
+0.500000 1.0 1.0 vertex vertex
+-1 = vertex
+= anim vertex bone 0.500000 frame 0.500000
+texture
+bone
+vertex
+1.0 anim 0.500000 1.0 1.0 anim = texture 0.500000 frame vertex
+0.500000 = 0.500000 material
+bone texture 0.500000 anim anim 1.0 anim
+-1 0.500000 texture -1 = frame
+1.0 material
+vertex
+frame material
+-1 1.0 = texture -1
+material anim -1
+anim
+material frame vertex vertex anim vertex anim 0.500000 vertex anim 1.0 -1 material 1.0
+anim = =
+-1 bone
+-1 -1 -1 bo
\ No newline at end of file
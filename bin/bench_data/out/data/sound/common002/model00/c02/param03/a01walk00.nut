@@ -0,0 +1,194 @@
+frame
+vertex
+1.0 = texture 1.0 anim frame material = 1.0 = -1
+vertex = bone anim texture 0.500000 1.0 vertex texture material -1 -1 frame anim bone material vertex
+0.500000 material
+material material vertex frame
+0.500000 =
+1.0
+1.0 -1 bone
+bone
+anim texture -1 material anim
+= 1.0 =
+vertex -1 1.0 = = anim
+material
+texture 1.0 = 0.500000 bone bone vertex
+texture material anim 0.500000 0.500000
+material bone 1.0
+material frame material
+0.500000
+texture bone anim =
+bone
+bone bone 1.0 -1
+bone = -1 vertex vertex bone
+material
+= anim
+texture vertex = frame
+anim bone
+material texture
+-1 vertex
+frame
+frame
+= -1 1.0 frame frame
+-1 bone anim -1 -1 0.500000 = vertex 0.500000 bone anim = vertex anim = frame bone bone = =
+vertex =
+vertex = anim
+frame texture material texture
+vertex texture texture frame 1.0 frame 0.500000
+anim = vertex
+texture 1.0 bone
+= 1.0 -1 texture bone bone
+vertex
+-1 texture
+= frame = =
+-1 1.0 -1 frame vertex 1.0 1.0
+material bone
+-1
+bone frame
+frame =
+bone bone texture material texture -1 vertex 0.500000 -1 0.500000 -1
+anim
+anim 0.500000 -1 texture frame
+bone material material 1.0 material material
+anim 0.500000 vertex vertex 1.0 frame material frame
+anim vertex 0.500000 anim material = bone vertex bone vertex bone = anim bone vertex 0.500000 = 1.0 0.500000 = = vertex 0.500000 texture bone anim vertex texture
+anim frame -1 anim vertex anim vertex vertex 0.500000 texture vertex
+material =
+vertex texture = texture material
+0.500000 texture 1.0 bone
+anim
+anim
+0.500000 frame
+bone 1.0 frame
+1.0 bone 1.0 frame bone 1.0 vertex 0.500000
+anim
+bone 1.0 material anim frame texture -1 1.0 frame
+anim bone
+anim bone anim
+anim
+texture
+-1
+-1
+anim vertex vertex material anim bone anim bone
+anim
+= 0.500000
+material vertex = bone
+vertex vertex
+0.500000 frame 0.500000 texture -1 1.0 texture material frame 0.500000 texture
+= material
+1.0
+1.0 = frame -1 frame
+bone -1 1.0 bone -1 1.0
+vertex = material anim texture
+vertex material vertex
+-1
+0.500000
+-1 = = -1 frame
+-1 =
+-1 frame frame
+0.500000
+0.500000 frame 0.500000 = anim 1.0 texture
+anim -1 = frame
+texture
+bone bone anim bone
+frame anim texture =
+material bone
+-1 material 1.0 bone bone = 1.0 0.500000
+texture vertex
+vertex -1 vertex
+anim =
+bone
+= anim 1.0 anim material vertex anim bone texture = anim 1.0 = anim
+texture 0.500000 anim 1.0
+frame material vertex anim anim frame -1 texture = 0.500000 texture frame
+0.500000 bone frame vertex texture anim anim
+texture vertex texture anim = 1.0 vertex 1.0 -1
+bone 1.0 vertex vertex
+0.500000
+vertex vertex 0.500000 vertex vertex texture bone texture = anim
+bone
+bone bone material bone
+=
+material vertex anim material bone anim vertex
+-1 frame texture = 0.500000
+0.500000 anim material 1.0 vertex
+vertex = anim 0.500000 material 0.500000
+texture texture bone frame = texture = vertex frame material texture frame -1 texture 0.500000
+vertex 0.500000
+1.0
+anim frame 0.500000 1.0 0.500000 material anim vertex 1.0 bone texture
+anim
+bone bone 0.500000 anim
+frame bone -1 material material = 0.500000
+vertex material texture =
+material = vertex anim 0.500000
+material bone
+-1 -1 = texture bone
+frame frame texture 1.0 material
+=
+material 1.0
+= frame vertex
+vertex material
+vertex frame material bone -1 vertex material bone anim
+1.0 0.500000 bone material material 1.0 material 1.0 = frame vertex
+texture frame material material frame = bone
+anim
+= -1 bone vertex vertex bone -1 frame
+frame 1.0 -1 texture texture
+anim bone
+-1
+anim -1 texture anim texture material -1 material texture anim frame anim 1.0 -1 0.500000 vertex frame bone -1 = = anim
+bone bone material
+0.500000
+material 1.0 0.500000 bone
+texture anim 0.500000
+bone bone anim material 0.500000
+anim
+-1 0.500000 texture = bone
+1.0
+vertex texture texture 1.0 -1 texture bone 0.500000
+-1 texture
+=
+texture bone anim anim
+-1 bone
+-1 0.500000
+material material material 0.500000 bone texture material
+1.0 frame
+vertex 1.0 texture frame
+vertex anim -1 bone material bone =
+anim
+= texture anim 1.0
+frame anim texture 0.500000
+texture 0.500000 vertex -1 anim texture 0.500000 bone
+bone
+frame frame vertex 1.0
+texture 1.0 bone
+1.0 =
+material vertex -1 anim bone frame
+-1
+vertex anim -1 -1
+frame vertex
+bone 1.0 0.500000 = 0.500000 texture 0.500000 bone
+1.0 anim
+bone -1
+= = texture
+-1 anim
+frame
+anim texture
+= anim vertex anim frame
+frame texture 1.0 = 1.0
+-1 texture = texture 1.0 frame
+vertex
+-1 texture
+=
+bone =
+-1 0.500000 anim material frame
+1.0 = =
+0.500000 = bone vertex texture anim 1.0
+frame texture -1
+-1 frame
+texture anim = = material
+-1 0.500000
+texture
+0.500000 material frame
+texture frame frame vertex mater
\ No newline at end of file
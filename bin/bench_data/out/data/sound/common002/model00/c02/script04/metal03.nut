@@ -0,0 +1,7 @@
+1.0
+anim = =
+0.500000 material -1 frame
+frame =
+1.0 -1 frame
+bone vertex frame bone 0.500000
+texture material 1.0 = texture
\ No newline at end of file
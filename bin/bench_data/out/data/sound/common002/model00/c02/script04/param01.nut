@@ -0,0 +1,58 @@
+bone
+= material
+material =
+material
+bone texture
+-1
+0.500000 1.0 0.500000
+texture
+-1 frame
+1.0 -1
+material bone 1.0 0.500000
+texture 1.0
+bone anim bone -1 material =
+anim frame texture -1 =
+frame
+anim anim frame vertex
+anim
+anim
+frame
+-1 frame frame vertex -1 material bone
+anim vertex frame 0.500000
+-1 bone vertex
+= material frame bone 1.0 anim 1.0 texture 0.500000
+bone
+bone
+1.0 texture vertex 0.500000
+bone
+1.0 0.500000 anim bone anim
+texture -1
+frame texture
+-1 bone anim material 1.0 vertex
+-1 vertex
+bone vertex anim bone frame material
+material
+frame -1 frame vertex
+anim anim anim anim anim
+vertex bone
+texture 1.0 0.500000 frame anim = 0.500000 bone
+anim vertex
+bone 1.0 anim 1.0 -1 texture 1.0 texture
+-1
+0.500000 frame vertex material 1.0 anim
+1.0
+bone = frame
+texture
+texture material 1.0 0.500000 -1
+0.500000
+texture 0.500000 bone vertex
+1.0
+anim 0.500000
+1.0 1.0 material 1.0 frame 1.0
+frame
+bone
+anim = 0.500000
+vertex
+texture texture
+= 0.500000 0.500000 frame frame bone frame 0.500000
+1.0 = frame
\ No newline at end of file
@@ -0,0 +1,13 @@
+material texture frame
+texture frame vertex anim texture vertex
+bone
+0.500000 -1 anim frame
+-1 texture anim frame
+0.500000 frame = texture
+anim vertex
+material vertex material anim vertex texture
+material 0.500000 bone material -1 0.500000 bone anim = -1 0.500000 vertex -1 0.500000 bone texture material frame vertex vertex bone
+texture 1.0 -1 texture 0.500000 anim 1.0 material 0.500000 anim
+texture vertex frame bone
+frame
+1.0 material bone bone -1 anim
@@ -0,0 +1,2 @@
+!)+i|c+`:Zꭎ%ƻAX#-E$V|/wˈZb͵5#,F4T/aC\oV(Dsy>E_"γ-*	
+3%\L4ƟQbV	@^GAlb\ouj[<tPQ3i$AwX?~0	+XtMO+Sĺ$[d7h_P/P""8bϬEjE휩ǰBy88_-yx{|MâNP쯓A1_QHz`8~jbADZGB5dvc}֏%v%5GXsUe"
\ No newline at end of file
@@ -0,0 +1,295 @@
+material frame
+= vertex texture texture
+anim texture -1 vertex vertex
+1.0 vertex
+= anim anim bone frame anim
+= 0.500000 -1 texture texture 1.0
+1.0 texture 0.500000 1.0 0.500000 bone
+-1 bone material 1.0 1.0 texture 1.0 = frame -1 vertex
+-1 texture
+texture 1.0 texture 0.500000 -1
+frame material frame 0.500000
+texture
+=
+0.500000 frame = frame 0.500000 texture 0.500000
+anim
+-1
+texture
+anim texture material
+0.500000 1.0 material 0.500000 1.0 frame bone anim anim frame 0.500000 anim 1.0
+texture vertex
+0.500000 texture -1
+frame 1.0 material -1
+-1
+bone frame
+material
+frame anim
+anim
+frame
+bone
+= frame frame vertex vertex bone anim 1.0 0.500000 vertex frame vertex anim
+frame -1 = texture frame frame
+0.500000
+vertex vertex frame = anim
+anim anim
+1.0 -1 -1 bone
+bone vertex
+0.500000 anim
+material
+bone anim bone bone anim texture vertex 0.500000 frame frame texture texture
+vertex
+-1 1.0
+bone 0.500000 frame
+material
+1.0 -1 vertex vertex 0.500000 anim frame
+vertex
+texture anim frame texture anim anim = bone frame
+material texture = texture bone anim anim bone 1.0 bone = anim 1.0 material
+bone 1.0 1.0 bone bone -1 -1 1.0 texture
+=
+-1
+frame = anim
+vertex frame bone bone 0.500000 anim
+= 1.0 texture 1.0
+-1 texture anim anim -1 1.0
+1.0 vertex -1 -1 anim
+= vertex frame 1.0 1.0
+material 1.0 bone texture frame texture
+texture vertex 0.500000
+=
+bone -1
+frame texture vertex texture texture 1.0 -1 = material 0.500000 0.500000
+= = texture texture 1.0 -1 vertex anim frame
+-1 texture
+frame bone vertex
+vertex
+anim 0.500000 0.500000 bone -1 texture frame 0.500000 texture frame 0.500000
+1.0 vertex 1.0
+1.0 anim vertex material
+0.500000 material vertex 0.500000 frame frame texture frame
+frame -1 texture -1 vertex 1.0 -1 bone 0.500000 0.500000 1.0 1.0
+material material = = bone
+0.500000 frame material anim texture vertex -1 material 0.500000
+0.500000 material
+vertex 1.0 anim 0.500000 vertex -1
+1.0
+material
+=
+material
+-1 frame bone
+bone texture = -1 -1 bone = texture vertex texture 0.500000
+bone material anim
+1.0 material material anim 0.500000
+bone vertex material vertex
+frame 0.500000
+vertex = 1.0 bone
+material vertex frame
+1.0
+frame bone vertex material = -1
+vertex anim material material
+vertex bone -1 bone 1.0
+vertex material bone
+frame bone -1
+anim = vertex
+1.0
+0.500000
+= = =
+anim = texture
+anim
+texture bone frame
+-1
+anim frame frame vertex 0.500000 = frame 1.0
+1.0 texture
+vertex
+bone = texture bone 0.500000 texture material
+anim texture frame = vertex 1.0 vertex -1 anim -1
+1.0
+frame anim vertex 1.0 = bone
+texture
+material
+-1 = bone -1 texture = 0.500000
+frame
+frame anim
+frame -1 1.0 0.500000
+= anim 1.0 bone 0.500000 anim 1.0 0.500000
+texture anim 0.500000 frame -1
+texture
+material -1 anim 1.0 -1
+material anim
+vertex = -1 vertex texture texture 0.500000 = = 0.500000
+vertex
+0.500000 vertex
+0.500000
+bone 0.500000 frame 1.0 0.500000
+material 1.0
+anim 1.0 bone 1.0 -1 anim vertex
+anim bone
+texture -1
+-1 0.500000 bone frame anim
+material -1
+= texture frame bone -1 material 0.500000 vertex frame = 0.500000
+material 1.0
+texture anim anim material
+= -1
+vertex vertex 0.500000 -1 1.0
+0.500000 texture vertex frame =
+0.500000
+0.500000 1.0
+anim material 0.500000 texture anim
+1.0 texture
+bone = bone material = vertex texture 1.0
+1.0 0.500000 0.500000 material
+texture
+1.0 0.500000 frame anim
+vertex anim -1 frame vertex
+vertex 1.0
+frame anim bone texture
+vertex texture =
+anim anim material
+= 1.0 anim
+material 0.500000 frame
+frame 1.0
+vertex 0.500000 bone
+vertex
+frame -1
+anim anim -1 anim 1.0 vertex
+= anim vertex
+frame 0.500000 -1 material texture material 0.500000
+-1 material 0.500000 bone bone vertex
+anim bone vertex
+vertex anim 1.0 anim 0.500000 = 1.0 0.500000 frame bone -1 1.0 frame
+anim = material = = material 1.0 vertex frame
+-1
+-1 frame 0.500000 0.500000 texture texture frame frame anim = material
+anim
+texture 1.0 frame 0.500000 texture
+frame 1.0
+= -1 1.0
+vertex
+1.0 anim -1 = vertex
+0.500000 frame bone anim bone 1.0
+= bone
+0.500000 -1 1.0 -1 frame bone vertex
+0.500000
+0.500000 vertex vertex frame vertex
+texture
+-1
+texture -1 0.500000
+bone = 1.0
+= -1 = = 0.500000 anim
+-1 -1 = material 1.0 frame =
+-1 bone
+frame 0.500000 0.500000 frame material
+1.0 texture
+anim frame = anim -1 vertex anim = material material 1.0
+bone
+-1 0.500000 =
+0.500000 material
+1.0
+texture texture
+material anim material texture = texture material
+material frame =
+1.0
+vertex 1.0 -1 vertex
+= anim -1 1.0
+vertex 0.500000 1.0 vertex
+texture
+bone -1 anim 1.0
+frame -1 = texture
+anim
+frame =
+-1 -1 0.500000 anim texture 0.500000 1.0
+1.0 vertex = frame anim texture 0.500000 frame anim frame
+bone material texture material
+0.500000 frame -1 material =
+material
+material frame -1 0.500000 material material
+vertex
+vertex 1.0 1.0 material
+-1 = bone material vertex anim anim texture -1 1.0 1.0
+-1 = anim material bone material
+texture 0.500000
+1.0 frame
+bone frame = bone 1.0 1.0 1.0 0.500000 material -1 texture anim 0.500000 vertex
+= -1 1.0 anim anim -1 1.0 -1
+-1
+texture
+anim
+= texture material frame texture 1.0 anim texture -1 bone 0.500000 vertex 0.500000
+= texture
+anim material 0.500000 vertex -1
+anim = anim 1.0 texture -1 = texture
+-1 0.500000 vertex
+vertex frame anim
+bone
+0.500000 vertex 1.0 frame frame 0.500000
+texture anim 0.500000 =
+frame
+-1 anim
+-1 bone anim frame texture
+anim
+material 0.500000 -1 material -1 frame 1.0
+frame anim
+material
+texture -1
+material
+anim
+frame texture = anim
+-1 texture = material frame = 1.0 0.500000
+0.500000 1.0 vertex anim -1
+1.0 = anim
+-1
+anim texture -1 material
+vertex frame bone = = 1.0 frame texture frame anim
+frame -1 frame anim frame anim
+-1 material
+-1 bone vertex
+1.0 frame bone material vertex -1 vertex material frame bone anim frame 0.500000
+0.500000 = texture bone frame 0.500000 =
+-1 = material bone 0.500000
+texture frame texture bone bone
+anim anim frame vertex
+= -1
+anim vertex 1.0 material vertex
+material bone =
+0.500000
+anim texture
+1.0 -1 frame bone
+-1 -1
+0.500000 texture
+anim 1.0 bone 1.0 1.0 0.500000
+1.0 anim =
+texture frame
+-1 1.0 vertex
+texture -1 material -1 texture
+frame -1
+anim bone vertex material material
+material
+= =
+0.500000
+frame vertex bone
+=
+texture texture
+= 0.500000 texture
+frame
+bone frame bone frame
+frame texture material 1.0 1.0
+bone 1.0
+-1 frame frame 0.500000
+vertex bone vertex texture
+material 0.500000
+bone bone
+0.500000 material texture 0.500000 anim = vertex =
+frame material
+-1 1.0 texture -1 1.0 1.0 bone
+0.500000 texture = vertex frame = 0.500000 anim
+vertex frame = anim material = -1 1.0 frame 1.0 anim frame
+= = material
+material frame 1.0
+-1 material vertex bone bone
+frame anim
+= 1.0 =
+-1 frame 0.500000 -1 material vertex bone = vertex texture vertex
+frame
+frame
+bone -1 material 
\ No newline at end of file
@@ -0,0 +1,215 @@
+anim 1.0 vertex
+-1
+vertex 1.0 1.0 material
+= frame -1 0.500000 = anim anim 0.500000
+bone -1 -1 anim
+= = -1 material 1.0 texture
+-1 vertex
+anim
+=
+1.0
+frame material texture -1 bone 1.0 texture material texture =
+vertex frame texture -1 material material = = material anim material 1.0 texture -1
+bone -1 = frame texture anim vertex 1.0
+frame vertex 1.0
+bone frame
+-1 texture 1.0 1.0 = frame texture texture
+bone -1
+= vertex frame texture -1 bone
+0.500000 0.500000 1.0 vertex 1.0
+-1 1.0 -1 0.500000 -1 = material
+bone
+vertex -1 = anim
+vertex
+frame material
+frame frame -1
+1.0
+texture 0.500000 frame 0.500000 anim frame anim anim 1.0 vertex 1.0 bone 0.500000
+frame
+frame frame vertex texture frame
+vertex 0.500000
+vertex
+texture vertex frame 1.0 texture -1 frame = -1 anim 1.0 material
+1.0 material anim bone 0.500000 =
+material = bone bone 0.500000 0.500000 0.500000 anim bone
+bone 0.500000 texture -1
+material material
+-1 frame frame
+-1
+1.0 anim =
+vertex 1.0 frame 0.500000 bone bone material anim
+-1 0.500000 frame material 1.0
+texture anim vertex frame frame
+1.0 texture anim material texture frame texture anim -1 frame texture -1
+0.500000 0.500000 anim texture 0.500000 -1 material = -1 1.0 vertex 1.0 frame 0.500000
+bone frame 0.500000 bone
+1.0 0.500000 vertex
+0.500000 bone 1.0 texture frame vertex texture = =
+vertex anim -1
+texture = frame frame
+anim material
+1.0 texture
+frame 0.500000 frame anim material material texture vertex 1.0 material 0.500000 -1 frame
+frame
+= 1.0 -1 anim = bone material
+1.0 vertex
+frame vertex bone
+= vertex
+bone texture =
+bone anim -1 1.0 bone -1 material material bone 0.500000 0.500000 vertex = vertex bone
+material
+frame frame frame 0.500000 = bone
+1.0 texture
+material bone
+= 0.500000 material vertex frame -1 material 0.500000 vertex 1.0 texture material texture
+anim
+frame =
+texture material vertex bone -1 material -1 frame anim bone 1.0 = material = bone = frame -1
+texture bone vertex material 1.0 = bone
+0.500000
+=
+-1 material 0.500000 -1
+texture
+= frame
+anim =
+frame -1 frame
+1.0
+texture
+-1 texture anim =
+1.0 anim
+frame
+= bone
+bone
+= 1.0
+1.0 -1 1.0 texture
+vertex -1 bone anim -1 vertex texture vertex -1
+0.500000
+material texture 1.0 0.500000
+frame 1.0
+anim bone anim frame vertex bone 0.500000 bone 1.0 bone vertex vertex
+texture texture anim texture 1.0 texture
+-1 1.0
+material -1 0.500000 = anim
+bone anim
+anim material = = anim material anim -1 0.500000 texture -1 vertex vertex 0.500000
+= anim 1.0 anim
+-1 vertex
+vertex
+-1 bone -1 bone
+anim anim material
+anim material
+bone
+vertex texture vertex material = bone 0.500000 material 1.0 bone 0.500000 frame bone anim
+frame 1.0 -1 anim 1.0 texture
+texture bone 0.500000 texture
+1.0 -1 texture vertex anim
+material
+vertex
+= 1.0 anim =
+texture 0.500000 vertex
+1.0 texture
+0.500000 texture = texture
+1.0 vertex 1.0
+1.0 -1
+frame bone
+= bone 0.500000 anim
+0.500000 texture anim
+bone 1.0 frame material frame 1.0 -1 = anim 0.500000 material 1.0 vertex
+-1 vertex material texture material 0.500000
+texture 0.500000
+0.500000 material frame
+frame texture
+1.0
+material frame 1.0 0.500000 frame material 1.0 material vertex
+-1 -1 = 0.500000 material texture 0.500000 = material texture material vertex -1 -1
+0.500000 -1
+vertex
+0.500000 bone =
+material -1
+bone
+vertex
+1.0 -1 1.0 frame -1 texture material vertex -1 frame = material = anim texture frame 0.500000 vertex material vertex material vertex texture
+1.0
+anim = 0.500000 material = material bone material frame
+material 0.500000
+vertex 1.0
+=
+= bone 0.500000 material texture
+-1
+0.500000 -1
+texture frame -1 -1 material -1 1.0 1.0 anim
+frame -1 material bone frame =
+bone frame
+0.500000 -1 frame -1
+-1 frame 0.500000 texture = texture -1 0.500000
+anim =
+0.500000
+material frame 1.0 = = material -1 = -1
+material vertex 1.0
+frame
+-1
+= frame
+texture 1.0 material
+0.500000 1.0 vertex -1
+-1 frame
+anim material bone 0.500000 anim = texture bone -1 bone frame vertex 0.500000
+1.0
+bone frame -1 bone
+material
+bone -1 1.0 = 0.500000
+anim
+bone 0.500000
+anim -1 anim bone =
+texture
+anim -1 bone
+1.0 0.500000 anim
+texture
+bone
+1.0 =
+material material
+1.0 vertex bone texture
+texture
+frame material
+anim frame texture vertex -1 =
+vertex 1.0
+vertex frame
+0.500000 material
+vertex
+-1 0.500000
+frame bone -1
+bone 0.500000 texture
+-1 -1 anim
+material
+anim
+frame material frame texture
+bone
+-1 anim 1.0
+-1 = 0.500000
+0.500000 texture material
+material
+frame vertex -1
+frame anim
+1.0 bone material frame texture
+= =
+texture texture 0.500000 anim
+anim material
+1.0 1.0 anim
+0.500000 anim = 1.0 bone bone
+= material texture frame
+anim =
+1.0 = 1.0 texture -1 = 1.0 frame 1.0 vertex material =
+texture bone 1.0 frame
+vertex -1 anim frame -1 1.0 frame -1 material frame 0.500000
+material
+vertex texture
+material material
+bone vertex
+texture
+material anim anim vertex texture anim anim anim anim frame anim vertex
+vertex -1
+frame 1.0
+texture 1.0 bone
+-1 -1
+texture
+bone vertex vertex
+bone bone verte
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim
+= vertex
+bone 1.0 -1 vertex frame textu
\ No newline at end of file
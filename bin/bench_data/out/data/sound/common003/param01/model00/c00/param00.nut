@@ -0,0 +1,32 @@
+anim frame 0.500000
+1.0 -1 vertex frame
+1.0
+frame
+anim frame = texture
+anim
+material
+frame -1 frame material anim
+texture = =
+1.0
+texture
+material material texture = -1
+1.0 material 1.0 = texture bone bone bone = material material bone -1
+material 1.0 anim vertex anim frame
+0.500000 anim material = material bone 0.500000 material
+anim = texture
+texture
+1.0
+1.0
+=
+vertex vertex vertex frame 1.0 0.500000 frame -1
+bone -1 vertex texture
+-1 1.0 bone vertex texture anim texture 0.500000 frame frame
+bone
+= material
+frame 0.500000
+frame 0.500000
+0.500000 vertex 1.0
+frame
+material frame
+frame material material vertex
+vertex 1.0 vertex an
\ No newline at end of file
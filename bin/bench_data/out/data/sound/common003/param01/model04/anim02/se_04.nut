@@ -0,0 +1,2 @@
+= material texture frame -1 1.0 vertex frame =
+frame vert
\ No newline at end of file
@@ -0,0 +1,3 @@
+frame texture texture vertex
+0.500000 texture
+material -1 1.0 -1 = material ani
\ No newline at end of file
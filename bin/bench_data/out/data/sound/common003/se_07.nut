@@ -0,0 +1,7 @@
+vertex
+= 1.0
+anim
+bone bone bone
+material
+1.0
+bone vertex = 1.0 = materi
\ No newline at end of file
@@ -0,0 +1,14 @@
+1.0 0.500000 texture =
+frame vertex texture -1 texture frame = -1
+anim frame = bone -1 frame
+material -1
+-1
+vertex
+material anim
+-1 texture texture
+anim 1.0 material frame texture 1.0 = = 0.500000 anim 1.0 0.500000 0.500000 = 0.500000
+1.0 texture -1 material -1
+bone 0.500000 texture 0.500000 frame frame
+anim material bone bone texture bone
+-1 vertex texture 1.0
+= 0.500000 -
\ No newline at end of file
@@ -0,0 +1,349 @@
+-1 0.500000 1.0 vertex 0.500000
+=
+=
+= vertex frame = bone
+material material anim
+-1 0.500000
+vertex material vertex vertex
+bone texture
+material material
+material material vertex
+1.0 material frame 0.500000 0.500000 = 1.0 0.500000 -1 = 0.500000 frame =
+= material
+frame
+material bone anim frame 0.500000
+vertex texture 1.0 0.500000
+texture 1.0
+bone -1 0.500000 = texture -1
+anim
+= material = material =
+= vertex frame 1.0
+0.500000 vertex frame 0.500000
+-1 texture anim material = material frame 1.0 -1 -1 0.500000 material 0.500000
+-1
+vertex
+-1
+texture
+material 0.500000 texture bone
+= = material 1.0 texture
+frame material frame
+-1 1.0 0.500000 = anim -1
+bone -1 frame frame = 0.500000
+vertex material = -1 1.0
+material anim =
+vertex
+-1 bone -1 texture = = 1.0 0.500000 1.0 -1
+1.0
+bone =
+1.0 bone
+bone texture vertex
+= frame
+anim texture texture anim = anim 0.500000 0.500000 = vertex
+material
+1.0
+0.500000
+texture 1.0 material
+anim -1 0.500000
+1.0 -1 1.0 0.500000 -1 -1 anim
+= vertex material
+vertex frame
+1.0 -1 0.500000
+1.0 texture 0.500000 bone frame bone
+texture material 1.0 anim material frame
+-1 = 0.500000
+frame 1.0
+0.500000 anim material anim -1 1.0 bone texture vertex -1
+frame material -1 vertex 1.0 texture material material material
+texture bone 0.500000 1.0
+anim anim -1
+material texture material vertex material anim 0.500000 anim -1 material 0.500000 1.0 1.0 bone
+texture
+vertex 1.0 texture
+texture -1 1.0 bone anim material
+frame -1
+vertex
+-1
+material -1
+= material
+frame frame =
+0.500000 0.500000
+0.500000 0.500000 -1 = anim =
+bone =
+= = 0.500000 0.500000
+anim
+1.0
+texture -1 bone -1
+anim 0.500000 vertex material frame
+texture
+anim anim 1.0 material 0.500000 texture
+1.0 material texture vertex
+-1 bone 0.500000 vertex -1 = anim = texture vertex
+anim
+bone bone vertex
+vertex -1
+bone
+frame frame 0.500000 material
+material material 1.0
+texture material anim 1.0
+anim frame
+vertex -1
+frame bone frame = 0.500000 material = material = material texture
+=
+vertex material
+bone
+texture
+0.500000 -1 = -1 1.0 texture
+vertex vertex bone = texture anim 1.0 = anim bone texture anim bone vertex -1
+texture =
+material
+anim
+bone -1 anim
+frame 1.0
+material
+texture
+frame anim anim
+-1 0.500000
+bone
+anim 1.0 frame 1.0
+material 1.0
+0.500000
+frame
+= vertex frame bone vertex
+-1 0.500000
+frame bone frame vertex
+0.500000 anim texture = =
+anim
+= texture anim 0.500000 1.0 0.500000
+frame vertex = -1 = frame -1 frame
+= material bone 1.0 material 1.0 frame 1.0 1.0 material material
+material vertex 1.0
+vertex
+1.0 material vertex bone bone
+bone bone vertex = anim
+frame 0.500000 frame
+= -1 -1 bone -1 1.0 = material
+0.500000 frame anim -1 texture
+frame =
+material 0.500000 -1
+-1 anim texture
+material -1 material bone texture
+frame vertex vertex texture
+frame -1
+1.0 bone
+anim 1.0
+material frame
+frame = texture
+bone vertex vertex vertex frame texture -1 frame vertex
+-1
+material
+anim
+1.0 texture vertex -1 bone material texture
+vertex texture
+-1 anim bone vertex frame -1 = 1.0 material -1
+vertex material
+vertex 1.0
+frame vertex anim 0.500000 texture 1.0
+texture
+-1 -1
+-1
+bone anim
+anim 0.500000 material vertex 0.500000
+1.0
+-1 material material texture material anim
+0.500000 vertex anim texture -1 -1 material
+vertex 0.500000 1.0
+frame vertex -1 frame anim
+0.500000 -1
+texture = frame 1.0 bone 0.500000
+anim 0.500000 1.0 texture 1.0 -1 0.500000 0.500000 -1 bone vertex 0.500000 0.500000 frame texture anim frame bone -1 anim vertex bone
+texture
+1.0
+bone 1.0 0.500000 material bone texture 1.0
+anim -1 vertex anim vertex bone bone
+1.0
+vertex =
+texture anim texture -1 0.500000
+vertex -1 -1 bone bone material bone -1 bone
+anim vertex vertex anim
+texture 0.500000 anim frame
+texture -1 0.500000 1.0
+bone
+-1 1.0 material frame vertex
+frame material 0.500000 bone =
+-1 frame texture
+material
+anim 1.0 0.500000
+anim
+= anim 1.0
+anim 1.0 = texture
+texture -1 bone
+texture
+vertex 0.500000 material material anim 0.500000 1.0 texture -1 texture
+= vertex bone anim 1.0 texture 1.0 bone 0.500000 1.0 material -1 -1 -1 texture bone bone vertex 0.500000
+0.500000 frame
+0.500000 bone
+bone anim
+bone
+= texture = texture vertex 0.500000 frame material = vertex =
+bone anim texture 1.0 bone frame frame = anim bone
+-1
+vertex
+frame
+anim
+0.500000 texture
+-1
+1.0 1.0 material -1
+material texture anim frame anim
+bone bone -1 -1 1.0 -1 frame 0.500000 1.0 material 1.0 material material material 0.500000 vertex = texture 1.0 vertex texture
+1.0 frame bone -1 = material 0.500000
+vertex
+0.500000 material anim =
+vertex texture material bone bone
+bone bone = 1.0 frame texture material frame material frame
+1.0
+frame 1.0 anim
+frame = frame 1.0 = =
+= -1 =
+material vertex 1.0
+bone
+frame = texture frame bone texture
+= 1.0
+0.500000 material vertex
+anim anim
+-1 1.0
+material -1
+bone bone texture
+vertex frame frame
+= frame
+= 1.0 bone anim -1
+frame bone
+anim 1.0 -1 anim texture anim = anim
+vertex material
+bone = frame 1.0
+texture frame
+bone bone 1.0
+texture bone 0.500000
+vertex = frame 0.500000
+texture texture frame
+1.0
+vertex = -1 frame = 1.0 anim bone vertex
+anim 1.0 anim =
+0.500000 anim 0.500000 material bone anim frame anim anim vertex anim -1 texture
+anim = 0.500000 = = 0.500000 bone bone
+-1 -1
+0.500000 anim 0.500000 frame 1.0 vertex
+anim frame
+=
+bone frame
+1.0
+texture = frame =
+anim
+bone material anim 1.0 vertex
+texture
+frame material
+vertex 1.0
+vertex -1
+material bone
+anim 0.500000 -1 1.0 -1 frame
+-1 -1 anim bone frame
+-1
+= material 0.500000
+-1 vertex 1.0
+texture 0.500000 =
+vertex
+1.0 texture
+vertex
+bone texture frame 1.0 anim vertex vertex
+0.500000 -1 anim texture frame 1.0 = 1.0 frame bone 1.0
+material
+0.500000 -1
+0.500000 frame 0.500000 frame = = 1.0 material 0.500000 material frame material -1 = frame -1 =
+bone -1 bone
+frame 1.0
+= = = texture
+bone texture anim material bone -1
+anim material -1
+texture texture material anim material material texture
+anim bone 0.500000
+frame vertex
+texture bone bone anim anim -1
+0.500000 frame 1.0 frame material
+material 1.0 1.0 = vertex
+-1 vertex
+1.0
+= vertex 1.0 0.500000
+0.500000 anim
+material -1
+anim frame material frame -1 -1 bone frame 0.500000
+1.0 vertex -1 1.0
+texture frame material material 1.0 0.500000 vertex = frame material vertex
+0.500000 texture -1 frame
+frame
+-1 bone vertex bone texture
+material material bone vertex bone bone 0.500000 vertex texture bone 0.500000 texture frame
+vertex vertex
+0.500000 material frame -1 texture 0.500000
+vertex frame = 1.0
+anim = bone material
+0.500000 -1
+bone
+0.500000
+= bone
+material texture
+texture -1 = 0.500000 = material 1.0 anim =
+=
+anim bone 0.500000 -1 bone vertex -1 0.500000 -1 frame -1
+texture anim = vertex material
+0.500000 texture
+frame vertex texture texture anim vertex
+1.0 anim texture -1 material 0.500000 0.500000
+material
+vertex 1.0
+texture material anim frame
+anim -1 bone =
+frame -1
+frame texture
+material
+-1
+bone texture
+frame texture
+=
+material 1.0 anim 0.500000 anim 1.0 bone bone
+= material =
+= -1 anim -1 material anim
+vertex texture
+anim frame anim bone 0.500000 frame -1 anim
+-1 material frame
+0.500000 0.500000 0.500000
+bone material anim
+vertex anim anim anim -1 -1 bone anim =
+1.0 vertex anim
+0.500000 0.500000
+-1 frame bone -1 texture vertex texture 1.0
+anim material texture -1
+anim bone material anim material anim material
+bone
+-1 0.500000
+material 1.0 anim material 1.0 -1 =
+-1 anim 0.500000 frame -1 = material 0.500000 frame frame 1.0 anim 1.0 bone 1.0 bone frame 1.0 0.500000 texture 0.500000 =
+-1
+material
+material bone
+texture
+-1
+=
+frame
+0.500000 -1
+texture
+-1 -1 1.0
+anim bone texture material -1
+frame
+material
+1.0
+frame
+vertex -1 0.500000 1.0 bone texture = frame = vertex
+1.0 bone texture 0.500000
+= material = -1 bone anim =
+=
+1.0 -1
+-1 0.500000 texture 
\ No newline at end of file
@@ -0,0 +1,265 @@
+vertex bone texture
+-1 -1 texture vertex material frame material vertex
+-1 1.0
+0.500000 frame bone bone 0.500000
+texture bone
+vertex bone vertex
+vertex -1
+-1
+-1 = 0.500000 frame
+1.0 vertex = vertex frame frame 0.500000 -1 bone texture frame
+vertex material
+bone -1 0.500000
+anim texture
+1.0 = bone
+texture -1 1.0
+0.500000 texture = material
+frame
+texture texture material texture
+anim 1.0 vertex -1 = anim 1.0 =
+anim texture -1 anim = anim 0.500000
+material 0.500000
+0.500000 0.500000
+= vertex bone
+0.500000 material
+frame bone material
+0.500000
+material
+vertex
+texture
+bone vertex
+frame material = -1 vertex texture anim bone texture 1.0 1.0 texture
+bone 0.500000 0.500000 1.0
+0.500000 texture anim bone vertex vertex
+1.0 1.0 1.0 material = vertex frame
+texture
+bone
+bone 0.500000 material 1.0
+vertex
+-1 material frame 0.500000 0.500000 bone
+frame 0.500000
+frame texture
+material
+1.0
+texture
+frame 1.0 material
+anim
+=
+bone material
+material 0.500000
+material vertex = bone texture material material texture 0.500000 vertex bone
+anim 1.0 texture
+vertex texture 1.0 texture material = = frame material 1.0
+-1
+anim vertex texture 1.0 material texture material vertex frame
+vertex frame frame material -1 -1 1.0 anim frame
+-1 bone 0.500000 0.500000
+material
+material frame
+= frame =
+1.0 1.0 material bone
+= 0.500000 anim
+material bone 0.500000 anim vertex vertex 1.0 frame bone -1 -1
+vertex frame material texture -1
+frame
+texture material
+1.0
+0.500000
+texture frame -1 anim anim vertex
+texture
+frame 1.0 1.0 material = texture anim
+vertex material = bone frame -1 texture vertex 1.0 1.0 vertex frame 0.500000 1.0 bone material 1.0 texture texture
+anim vertex vertex 1.0 vertex texture 0.500000 0.500000 material anim bone texture anim
+0.500000 material 1.0 1.0 -1
+bone frame material texture vertex texture frame anim frame = vertex bone -1 0.500000
+texture material
+vertex bone anim
+0.500000 =
+-1 bone anim -1
+texture
+=
+= bone 0.500000 bone material anim 1.0
+1.0 texture 1.0 vertex 1.0 1.0 0.500000 vertex =
+bone
+1.0
+material anim material bone -1 0.500000
+1.0 0.500000 vertex bone material material texture vertex material anim texture
+anim frame frame
+= 1.0 bone 0.500000 material 1.0
+vertex bone = frame =
+anim
+1.0 bone -1
+frame bone texture
+anim = -1 vertex bone bone anim texture 0.500000 texture bone anim material -1 frame anim
+material 1.0
+frame
+bone material bone anim texture
+frame bone -1 frame
+bone
+anim
+anim 1.0 -1 -1 texture material
+vertex material -1 1.0 vertex bone
+anim
+anim anim vertex vertex
+vertex
+1.0 anim bone 0.500000 -1 bone
+1.0 anim texture -1 0.500000 anim
+= texture
+vertex texture 1.0
+bone -1 0.500000
+material 0.500000 vertex vertex anim = -1 texture material = material
+1.0 = bone 1.0
+material
+1.0 texture anim
+material 0.500000
+texture 1.0
+vertex 1.0
+= = = bone
+frame 0.500000 = 1.0 bone material =
+vertex material
+1.0 frame = = texture
+= vertex material bone
+= -1 anim -1 anim bone
+texture vertex
+= = bone -1 anim
+0.500000
+anim bone
+frame
+frame
+-1
+anim 1.0
+-1
+1.0 -1 texture bone
+frame bone
+texture
+texture
+-1 1.0 vertex
+vertex texture anim anim 0.500000
+1.0 texture texture vertex
+1.0 1.0 -1 material vertex
+bone
+texture = = -1 = -1 material anim = 1.0
+material bone frame
+0.500000 -1 = -1 vertex = frame
+vertex
+bone
+texture -1 = bone
+bone 0.500000 0.500000 texture anim bone
+= =
+0.500000 -1 = = 0.500000
+-1 texture =
+0.500000
+1.0
+bone anim material 1.0 vertex anim vertex vertex vertex texture vertex 1.0 bone 1.0 frame
+anim 1.0
+-1 frame 0.500000 -1 material = anim
+0.500000 anim
+=
+texture
+-1 anim 0.500000 0.500000
+frame texture vertex material 1.0
+1.0 texture
+0.500000 texture -1 1.0 -1
+0.500000
+frame
+-1 -1 anim
+frame texture bone material material vertex
+material frame
+frame anim
+material
+bone vertex 1.0
+anim material bone -1
+= anim -1 vertex material
+= anim vertex texture texture frame
+-1 1.0 anim anim = vertex = anim bone -1 frame material material vertex
+= = 0.500000 anim 0.500000
+material 1.0 texture material frame
+0.500000 texture -1 bone material
+1.0 anim 1.0 -1
+1.0 -1 anim anim -1
+material vertex 1.0 vertex frame frame bone
+=
+-1
+-1 anim -1
+0.500000 bone vertex bone bone
+= 0.500000 vertex 0.500000 anim vertex -1 anim 0.500000 texture
+vertex texture = 0.500000 material bone anim -1 1.0 = 1.0 = =
+-1 1.0 material bone =
+frame -1
+frame 1.0
+anim 0.500000 bone
+material
+material bone material
+= vertex
+material -1 frame bone
+= material
+frame
+0.500000 vertex = -1 vertex texture bone
+1.0
+0.500000 = -1 vertex
+1.0 texture
+anim
+anim
+texture
+material material -1 -1 material
+vertex 1.0 bone 0.500000 texture
+material
+anim anim frame 0.500000 bone material 0.500000 -1 texture =
+material
+anim bone anim vertex
+-1 anim
+bone = -1
+bone texture
+-1 1.0 material
+vertex
+bone frame
+0.500000
+vertex
+1.0 texture = vertex bone bone -1 anim anim
+bone material -1 0.500000 -1 0.500000
+vertex
+-1 material 1.0 -1 0.500000 -1
+bone 1.0 texture -1 -1 = anim texture
+texture -1 vertex material = = 0.500000 1.0 material bone frame vertex
+-1 frame anim 0.500000
+0.500000 -1 bone vertex
+frame -1 1.0 1.0 frame vertex
+= 0.500000 = material -1 0.500000
+1.0 1.0 vertex anim
+frame
+0.500000
+bone frame anim 1.0 material
+0.500000 0.500000 -1 1.0 0.500000 anim -1 frame
+bone vertex material 1.0
+bone material
+1.0 anim material texture -1
+texture material frame bone 1.0 texture material 1.0 texture
+frame anim anim 0.500000 frame 0.500000
+texture frame = frame
+bone texture 1.0 0.500000 0.500000 = bone frame
+material -1 vertex -1
+vertex material material
+frame 1.0 vertex 1.0
+0.500000 1.0
+frame anim
+0.500000 texture bone 0.500000 anim
+bone 1.0 vertex material -1 texture vertex material vertex
+= 0.500000 =
+bone 1.0 vertex texture -1 material -1 material
+anim frame 0.500000
+= frame texture
+0.500000 -1 anim = = material vertex
+bone
+frame material 0.500000 anim material material
+0.500000 texture material 0.500000 anim 1.0 1.0
+1.0
+0.500000
+-1
+material frame texture material = vertex 1.0
+vertex
+material texture 1.0
+-1 -1
+1.0
+material vertex 0.500000
+texture = texture
+vertex 1.0 1.0 -1 0.500000 0.500
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone 1.0 1.0 0.500000 anim anim
+bone texture
+material frame
\ No newline at end of file
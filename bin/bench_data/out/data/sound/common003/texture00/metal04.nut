@@ -0,0 +1,3 @@
+material
+-1 -1 -1 0.500000 anim
+fra
\ No newline at end of file
@@ -0,0 +1,276 @@
+texture 1.0 1.0
+frame
+material -1 vertex
+-1 frame vertex
+frame material frame -1
+= vertex anim
+1.0 0.500000 frame = 1.0 1.0 -1 -1 anim 0.500000
+material vertex material material 1.0 vertex -1 material anim texture frame
+0.500000 bone
+material = -1 = -1 material =
+vertex vertex 0.500000 anim bone material anim material material frame 0.500000 bone vertex anim vertex
+material anim
+-1 = bone
+material
+vertex
+anim -1 frame anim = material anim vertex texture bone 0.500000 material -1
+vertex
+=
+-1
+-1 texture bone bone material anim
+anim 1.0 -1 vertex bone = 0.500000 = -1
+texture anim vertex = anim
+0.500000 1.0 anim
+anim 0.500000 1.0
+-1 texture
+vertex bone
+-1 texture 1.0 1.0 0.500000 texture vertex
+texture
+anim
+bone =
+bone vertex 0.500000 material 1.0 texture 0.500000
+0.500000 = -1 0.500000 anim -1 = = material material vertex
+anim
+texture
+texture 0.500000 texture material -1
+= anim vertex 1.0 = -1
+anim bone material material bone bone
+texture vertex 1.0
+frame vertex = -1 texture texture
+material anim
+frame material vertex 0.500000
+bone vertex material anim anim vertex
+anim vertex vertex =
+frame =
+material
+0.500000 0.500000 vertex texture
+-1 1.0 vertex 1.0 0.500000 = 1.0 material -1
+bone 0.500000 texture texture -1 anim
+-1 1.0 texture
+material 0.500000
+0.500000 frame anim anim 0.500000
+frame -1 frame
+bone -1 = =
+-1
+anim 1.0 texture
+bone texture -1 material material
+bone texture bone = material =
+1.0
+frame = anim = texture texture frame anim 1.0
+vertex frame -1 vertex frame
+texture anim
+frame anim -1
+-1
+texture anim 0.500000 anim
+vertex
+frame -1
+-1 material -1 -1 vertex texture 1.0 frame
+bone anim
+vertex 1.0
+-1
+frame -1 material vertex material texture vertex
+texture = material anim 1.0 0.500000 bone
+texture
+material frame
+bone 1.0 material bone 0.500000
+= = material anim anim -1 frame = material
+material
+material bone
+texture texture 0.500000 0.500000
+vertex 1.0
+material 0.500000 texture -1 1.0 frame anim anim 1.0 =
+0.500000
+texture 0.500000 0.500000 anim = vertex vertex anim
+anim vertex vertex material anim vertex bone -1 vertex vertex anim -1 anim bone
+-1
+= -1
+vertex 0.500000 vertex texture
+anim 1.0 0.500000 vertex
+1.0 1.0 =
+frame bone -1 =
+vertex texture 1.0 bone texture
+texture material = texture -1 1.0 vertex
+-1 texture
+0.500000 1.0 0.500000 bone 0.500000 -1
+material = vertex = 1.0
+frame 0.500000 frame material vertex bone frame = vertex frame
+-1 1.0 anim bone frame 0.500000
+vertex
+vertex frame material material -1 texture material texture 1.0 =
+=
+= material texture anim anim
+-1
+-1
+1.0 bone vertex texture
+frame bone 0.500000 0.500000 1.0
+bone frame bone texture
+1.0
+texture -1 material vertex 0.500000 bone vertex 1.0 texture -1 =
+1.0 texture = 1.0
+1.0 = frame texture frame texture -1
+material 1.0 bone vertex 0.500000 = vertex frame material
+material = -1 bone anim texture material frame
+vertex bone vertex
+frame 0.500000 frame material frame
+frame frame material
+anim
+0.500000 frame texture 0.500000 bone anim
+material texture texture anim bone bone
+-1 = 0.500000 texture anim vertex anim material texture = 1.0 -1 1.0
+vertex bone -1 frame -1 1.0 texture frame -1 vertex vertex bone vertex 1.0 1.0
+-1
+0.500000 frame anim anim vertex
+= material =
+anim vertex
+bone
+frame anim = -1 texture 0.500000 anim -1 frame
+bone
+bone
+material vertex 0.500000 1.0 -1 material frame
+texture
+anim -1 bone
+1.0 material
+= bone frame material material -1 bone frame frame vertex
+vertex
+vertex
+1.0
+anim
+anim 1.0 0.500000
+= frame vertex anim
+0.500000 frame 1.0 frame anim material
+texture texture material
+-1 material
+material
+1.0 0.500000 bone -1 1.0 frame
+anim texture bone
+texture bone -1 bone
+bone 0.500000 material anim
+anim = -1
+anim frame -1 0.500000 texture material material bone -1 texture
+= -1 1.0 vertex anim 1.0 -1 frame 0.500000 frame
+material bone
+= = = -1 vertex
+vertex -1 anim 1.0 = anim = vertex vertex frame -1
+bone vertex -1
+1.0
+frame anim
+0.500000
+vertex 0.500000 anim
+1.0 bone -1 frame -1 vertex
+1.0 vertex vertex
+=
+-1 =
+vertex
+-1
+anim 1.0 1.0 1.0 texture vertex -1 1.0 -1 -1 frame vertex
+bone 1.0 frame
+frame
+texture 1.0 -1 1.0 material
+texture
+vertex
+texture bone bone vertex anim material frame
+material -1 frame -1 texture -1 anim anim = 0.500000
+material material -1 anim texture
+texture material
+0.500000 material
+vertex 0.500000
+0.500000 -1
+1.0 frame -1 1.0 1.0
+0.500000 -1
+1.0 0.500000
+-1 texture 0.500000 texture -1 vertex anim
+= anim 0.500000 frame 1.0 vertex frame
+anim 0.500000 texture
+0.500000 material vertex
+vertex 0.500000 material -1 -1
+material 0.500000 frame bone
+= = = = frame
+frame anim
+-1 anim 1.0
+frame
+texture
+0.500000 = = anim material 0.500000
+texture 0.500000 anim texture
+frame frame 0.500000
+1.0
+0.500000 anim vertex
+material frame
+bone
+vertex
+bone
+-1
+anim vertex frame
+0.500000 frame = material vertex 1.0
+bone 0.500000
+= -1 anim anim 1.0 vertex -1 anim texture -1 bone anim vertex
+anim
+0.500000 anim bone texture frame frame anim 0.500000 = =
+anim 1.0
+vertex vertex 1.0
+0.500000
+= vertex vertex -1 -1
+anim texture = material
+0.500000 texture texture
+frame vertex -1
+frame -1
+material texture
+-1 -1 texture material bone material anim
+frame texture
+texture 1.0 bone
+texture material material
+1.0 frame -1 anim vertex
+frame
+bone texture = texture vertex anim 0.500000 -1
+0.500000 -1 vertex anim -1 -1
+texture = 1.0 texture 1.0
+-1 1.0 frame bone = frame
+anim anim material texture bone = texture material texture
+frame bone frame
+vertex anim anim
+vertex material 0.500000 =
+1.0 = bone vertex 0.500000
+0.500000
+anim -1 anim = 0.500000 bone
+anim texture frame
+texture =
+bone 0.500000 = anim material
+= -1 1.0 material
+1.0 vertex texture material
+0.500000 =
+material 1.0 material anim frame vertex vertex
+0.500000
+material
+texture = vertex material 0.500000 = frame
+1.0
+-1 material material texture
+0.500000 frame
+vertex
+frame material frame 0.500000 anim material texture texture vertex
+frame anim = anim texture texture frame 0.500000 material bone anim
+= texture texture frame
+frame anim frame material = material
+frame
+= vertex texture frame material -1 vertex 0.500000
+frame anim anim 0.500000 frame
+vertex material
+material frame 1.0 1.0 -1
+vertex
+bone bone texture
+material material material material = bone =
+material vertex bone texture vertex 0.500000 -1 -1 vertex -1 1.0
+=
+-1 = anim frame vertex
+anim anim
+= texture
+0.500000 1.0 bone
+material frame bone 1.0 0.500000 anim bone
+= texture texture anim material material 1.0 vertex material
+=
+frame bone = frame
+-1
+-1 -1 bone
+bone vertex
+-1 material frame
+texture = vertex vertex frame
+0.500000 0.500000
+-1 anim 0.
\ No newline at end of file
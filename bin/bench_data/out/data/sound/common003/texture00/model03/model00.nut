@@ -0,0 +1,85 @@
+anim
+material vertex 1.0 -1 texture frame
+vertex
+= =
+bone vertex 1.0
+anim anim
+0.500000 anim vertex
+anim -1 bone
+bone
+-1 vertex texture = 0.500000
+frame material vertex 1.0 0.500000
+=
+-1 frame
+frame
+= = 1.0 1.0 anim texture 0.500000 material anim bone bone vertex vertex
+vertex bone
+bone = frame bone frame = = -1
+1.0 frame bone
+vertex -1 1.0 material
+-1 0.500000
+frame
+frame 0.500000
+= vertex = vertex
+1.0 0.500000 anim
+anim
+bone
+material texture 1.0
+-1 frame texture
+-1 vertex anim
+bone 1.0
+1.0 0.500000 anim -1 vertex
+material anim
+texture
+material 0.500000 bone texture
+frame material 0.500000 anim texture vertex
+=
+-1 0.500000 = anim vertex anim
+-1
+= -1 material 0.500000 material
+anim
+0.500000
+-1
+0.500000 anim
+= anim 1.0 anim = 1.0 -1
+= =
+= texture = bone = -1 -1 -1 vertex texture material 0.500000 -1 vertex = =
+1.0 texture texture anim material texture 1.0 vertex anim -1 -1 texture vertex anim 1.0 anim texture
+vertex = 1.0 = bone texture anim 1.0 vertex texture texture texture texture = frame 1.0 frame 0.500000 anim bone material
+=
+= material
+1.0 = bone vertex anim
+vertex bone vertex texture material texture = frame = texture anim = texture 0.500000 texture = anim vertex anim -1
+= 1.0 0.500000 = anim
+vertex anim texture
+frame material anim bone 1.0 = bone frame anim anim frame
+0.500000 1.0
+-1 =
+-1 material
+bone texture
+1.0 0.500000 bone vertex bone
+-1 texture
+0.500000 frame -1
+material
+texture 1.0 = anim anim bone anim material 0.500000 -1 1.0
+texture
+bone bone vertex 1.0
+vertex -1 material anim = 1.0 0.500000 frame 0.500000 anim anim
+frame bone 1.0 =
+material vertex anim frame
+= -1 0.500000 1.0
+-1 vertex -1 frame -1 material 0.500000 vertex -1
+texture anim texture
+bone bone =
+vertex bone -1 frame frame
+0.500000 material 0.500000 bone
+texture bone
+frame bone anim
+=
+material 1.0 vertex texture
+material frame =
+0.500000
+-1
+0.500000 anim -1
+frame frame material
+material anim tex
\ No newline at end of file
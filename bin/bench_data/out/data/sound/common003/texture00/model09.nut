@@ -0,0 +1,48 @@
+vertex = frame
+bone vertex 0.500000 frame frame frame =
+bone = frame vertex -1 material
+1.0 vertex
+frame bone
+material texture 0.500000 bone
+material texture
+1.0 bone -1 anim frame texture anim = vertex bone
+= bone
+texture anim anim
+0.500000 anim = 1.0 anim vertex
+frame
+bone anim anim frame texture = bone 1.0 vertex
+texture vertex texture frame 1.0
+texture 1.0 anim
+-1 1.0 frame vertex 1.0
+0.500000 bone 1.0 vertex 1.0 bone
+= texture texture vertex =
+-1 -1 vertex
+texture = anim bone bone vertex frame
+0.500000
+-1
+1.0 = =
+bone anim 1.0
+anim
+frame
+=
+material anim material = bone = material anim vertex
+= -1
+-1
+1.0 0.500000 -1 bone
+frame texture 0.500000 -1 material = vertex 1.0 frame frame
+vertex anim anim texture -1 texture bone =
+texture bone texture -1
+frame
+vertex -1 -1 -1
+frame vertex
+material texture
+vertex anim -1 -1 1.0 texture
+texture bone texture texture
+frame bone
+vertex 0.500000 anim 1.0 texture
+bone bone anim
+material -1 vertex anim 1.0
+material -1 anim
+0.500000 -1 = = -1 = 0.500000 texture
+bone
+= 
\ No newline at end of file
@@ -0,0 +1,4 @@
+material bone
+texture bone
+anim 0.500000 vertex = vertex frame
+texture verte
\ No newline at end of file
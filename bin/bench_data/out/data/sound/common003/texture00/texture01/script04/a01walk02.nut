@@ -0,0 +1,47 @@
+frame -1 frame anim
+frame texture
+0.500000 material
+1.0 frame frame 0.500000 = -1 -1 anim material 0.500000 anim
+-1 bone -1 texture = material = bone 0.500000 bone 0.500000
+texture
+frame vertex anim
+texture texture texture = bone material
+0.500000 vertex -1 frame = 0.500000
+bone 0.500000 texture material texture vertex
+frame
+anim frame anim bone texture 0.500000 anim
+-1
+vertex 1.0 material
+-1 frame texture
+material
+anim 0.500000 material bone vertex vertex vertex frame 0.500000 anim bone
+material
+bone
+vertex
+vertex bone
+bone =
+0.500000
+0.500000
+= anim vertex vertex
+bone -1 0.500000 material
+-1 anim
+frame
+anim
+anim vertex
+-1 = anim
+texture 1.0 anim frame 1.0 =
+= texture vertex texture
+vertex frame vertex vertex 1.0 frame vertex material frame
+= 0.500000 vertex bone anim -1 vertex vertex -1 vertex vertex frame anim
+frame
+=
+-1 = 1.0
+0.500000
+texture
+1.0 texture = = vertex
+= frame =
+anim
+material frame material 0.500000 vertex
+1.0 1.0 frame bone anim vertex bone 1.0 anim -1
+anim material -1
+0.500000 1.0
\ No newline at end of file
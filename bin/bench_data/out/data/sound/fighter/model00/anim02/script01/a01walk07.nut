@@ -0,0 +1,4 @@
+bone 1.0 bone 0.500000 texture -1 = -1 -1 =
+-1
+= 1.0 -1 bone =
+0.500000 1.0 ver
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone frame 1.0
+1.0
+vertex vertex anim =
+texture vertex anim 0.500000 1.0 frame bone anim
+frame bone 0.5000
\ No newline at end of file
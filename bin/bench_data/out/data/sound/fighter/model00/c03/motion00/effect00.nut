@@ -0,0 +1,20 @@
+vertex -1
+0.500000 frame -1 vertex
+0.500000
+0.500000 material vertex 0.500000 frame
+material material frame 0.500000
+frame texture -1
+frame
+1.0
+frame 1.0 0.500000 vertex bone
+texture =
+frame material
+1.0 anim -1
+1.0 material frame frame
+= =
+= material
+anim 0.500000
+texture -1 anim frame 0.500000
+-1 -1
+vertex 0.500000
+vertex verte
\ No newline at end of file
@@ -0,0 +1,3 @@
+= frame -1 anim -1 frame 0.500000
+frame texture anim
+-1 frame =
\ No newline at end of file
@@ -0,0 +1,55 @@
+texture material
+texture material texture material
+1.0 vertex 0.500000
+material material anim material frame
+material 1.0 anim 1.0
+anim
+frame vertex vertex
+0.500000 -1 1.0
+frame frame anim material 0.500000 material 1.0 anim bone 1.0 vertex texture vertex
+vertex 0.500000 = = -1 texture frame texture
+material = bone bone material frame
+vertex texture texture = 0.500000 =
+bone
+material anim -1 1.0
+frame material vertex frame
+-1 material
+material -1 =
+bone 0.500000
+1.0 anim frame
+-1 -1
+frame
+anim 0.500000 vertex 0.500000 = anim =
+texture bone
+= frame
+anim -1 frame
+1.0 0.500000 material bone
+bone material frame texture 0.500000 bone 1.0
+1.0 anim
+anim
+frame -1 = vertex anim texture 0.500000 frame 0.500000 1.0 frame anim 0.500000
+material 1.0 vertex bone
+frame
+frame bone texture
+texture 0.500000
+texture texture
+texture
+texture = anim
+vertex -1 -1 material material anim 0.500000 1.0 1.0
+anim material bone frame frame anim 1.0 0.500000 texture
+1.0 texture
+anim frame -1 material material frame = anim material vertex 0.500000 0.500000 -1 frame material texture frame texture
+-1 anim -1
+= texture = texture
+texture bone -1
+1.0 vertex 0.500000 -1 frame 1.0
+1.0
+anim vertex frame frame -1 -1 1.0 texture
+texture anim material bone bone anim bone frame -1
+bone
+0.500000 bone anim 1.0 bone frame 1.0 = frame 0.500000 -1 texture vertex
+material vertex material
+frame material bone material texture vertex bone
+vertex material frame
+bone 0.500000 anim 0.500000 -1 anim anim bone frame bone texture 1.0 vertex frame texture frame vertex anim material frame = = bone
+bone bon
\ No newline at end of file
@@ -0,0 +1,152 @@
+texture -1 = vertex material vertex material = 1.0 material 0.500000
+texture material = texture vertex anim bone texture frame anim 0.500000 anim anim
+0.500000
+0.500000 texture texture 1.0
+vertex
+-1
+0.500000 texture 1.0 1.0 bone -1 bone
+anim bone
+frame
+vertex vertex -1 texture 0.500000 bone -1 texture anim 1.0 1.0
+material material
+bone texture
+material bone 0.500000 frame -1 bone material
+1.0 bone -1 anim frame 1.0 -1 material anim 1.0 1.0
+-1 texture
+-1 0.500000 frame 0.500000 1.0 vertex = 1.0 frame -1 1.0 anim material frame 0.500000
+0.500000 frame texture
+frame
+bone
+-1 = bone -1
+-1 1.0 0.500000 frame
+texture 1.0 anim anim vertex = material bone -1 anim anim 0.500000 anim frame = = -1 bone texture = bone anim vertex vertex = anim = frame
+anim material vertex
+frame frame 0.500000 0.500000 bone
+material frame texture -1 frame = frame material vertex frame texture anim
+-1 0.500000
+anim 0.500000
+-1 vertex
+1.0 bone -1 frame 1.0 material 0.500000
+-1
+0.500000 =
+1.0 texture material
+vertex
+0.500000
+bone
+0.500000 texture frame -1
+material -1 -1 texture 0.500000
+vertex
+vertex bone anim
+1.0 frame vertex =
+texture 0.500000 frame
+material 1.0 1.0 anim = material bone 1.0
+vertex =
+frame anim -1
+texture
+= 0.500000 1.0 material anim
+=
+texture material
+anim 0.500000 anim -1
+1.0 0.500000 = frame
+texture -1
+-1 =
+frame -1 -1 material -1 frame anim
+vertex = 0.500000 texture bone vertex
+texture =
+bone -1 =
+texture -1 vertex
+= anim -1 = = texture = =
+bone = -1 -1 anim vertex texture material
+vertex 0.500000 -1 bone
+material 0.500000
+-1 -1 vertex anim texture
+1.0 frame vertex bone anim texture 1.0
+anim = frame 0.500000 material texture frame
+anim bone -1 = 1.0 -1 anim texture
+=
+-1 = material
+anim bone -1
+0.500000 -1
+material 1.0 texture vertex anim
+anim
+anim frame 0.500000 texture -1 anim
+frame bone texture
+1.0 =
+frame texture vertex
+-1 anim bone = frame bone material
+0.500000 = 0.500000 anim material vertex -1 -1 0.500000
+material 1.0 -1 0.500000 vertex 0.500000 1.0 anim texture 1.0 1.0
+texture texture frame
+1.0
+frame 0.500000
+texture frame texture
+texture 0.500000 -1 frame texture vertex vertex frame
+material
+texture -1
+vertex
+= texture material texture
+bone =
+-1 texture
+frame -1 anim
+frame 1.0 0.500000 vertex 0.500000 0.500000 1.0
+material frame
+= material
+1.0 anim
+material frame vertex anim bone texture frame bone = bone
+anim bone bone
+texture = = anim -1 frame anim
+texture bone
+texture bone
+0.500000
+frame texture -1 bone
+frame anim
+vertex
+frame
+-1 1.0 material bone 0.500000 frame
+1.0 material texture
+anim
+anim material
+texture texture anim 1.0
+material
+anim 1.0
+0.500000
+frame
+texture 0.500000 bone vertex material 1.0 texture frame
+=
+material 0.500000 vertex
+anim frame
+1.0 anim =
+1.0 material material bone vertex -1 0.500000 -1 0.500000 1.0
+anim = texture bone texture
+frame texture -1 texture 0.500000 bone
+material -1 bone
+anim vertex
+frame frame
+bone texture texture
+texture material 1.0 material 0.500000 = anim
+= = -1 anim 0.500000 bone 1.0 -1 frame texture material -1 -1 = material 1.0 texture anim texture texture 0.500000
+= -1 = -1 -1
+vertex frame
+0.500000 0.500000
+-1 = 1.0 -1 -1
+1.0
+frame
+= 0.500000
+1.0 0.500000
+texture vertex
+-1
+-1 1.0
+frame 0.500000
+-1 frame bone vertex 0.500000 vertex 1.0 texture 0.500000
+material
+anim
+-1 material 1.0 1.0 -1 texture bone
+1.0
+= 1.0 1.0 texture
+material bone
+1.0 texture
+vertex 1.0 -1 anim
+vertex frame bone
+bone
+bone = frame -1 bone bone anim = bone
+1.0 t
\ No newline at end of file
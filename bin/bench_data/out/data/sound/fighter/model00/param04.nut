@@ -0,0 +1,234 @@
+-1 texture
+vertex
+vertex material texture frame -1 anim texture
+vertex
+1.0 0.500000 material -1 0.500000
+1.0 0.500000 vertex texture material
+1.0 frame
+texture -1 1.0 vertex -1 anim 1.0 -1
+0.500000 =
+= anim anim -1 frame texture 1.0 1.0 0.500000 anim -1
+1.0
+material
+texture material
+material frame 1.0 bone bone frame 0.500000 texture
+texture
+material
+material anim
+frame material =
+bone frame
+1.0 = vertex bone material bone 1.0 anim anim 0.500000
+vertex 0.500000 anim vertex 1.0
+texture 1.0
+1.0 -1 vertex anim
+texture vertex
+vertex 0.500000
+material = texture
+texture
+frame 1.0 anim frame anim 1.0 = frame 0.500000
+-1 texture 1.0 vertex 0.500000 = texture
+-1
+texture -1 1.0
+bone texture
+bone 1.0 texture bone anim -1 1.0 -1 vertex = frame frame = anim 1.0
+material
+= anim 0.500000 vertex
+0.500000
+bone
+= anim 1.0 vertex
+texture texture =
+bone anim vertex
+bone material
+vertex
+= texture anim frame frame
+material
+= 1.0 frame vertex = 1.0 0.500000 1.0 0.500000 material
+0.500000 bone material
+anim frame 0.500000 = -1 material bone
+texture 1.0 texture
+= material bone material
+-1 frame
+frame vertex anim
+1.0 texture -1 texture
+anim texture texture vertex = bone frame
+0.500000 1.0
+material vertex material 1.0 material -1 anim anim
+bone material bone -1 vertex 1.0 = material = frame anim anim bone texture anim frame
+material
+texture material -1
+anim bone =
+texture 1.0 material
+bone frame anim frame 0.500000 0.500000 0.500000 material frame material material 0.500000 -1
+0.500000 material material = 1.0 frame bone texture vertex texture
+1.0
+vertex texture
+material bone
+0.500000 -1 material -1 texture
+material
+-1 vertex texture
+bone material
+0.500000
+vertex 0.500000 vertex anim -1 material =
+bone anim
+texture material
+vertex frame vertex vertex texture texture frame
+material -1 1.0
+anim vertex frame 0.500000 frame frame -1 1.0 texture
+bone = 0.500000
+texture
+bone 1.0 -1
+= anim
+= anim 0.500000 0.500000
+frame = =
+anim
+1.0 bone -1 bone vertex
+frame -1 frame material material = frame texture
+vertex -1
+vertex 1.0
+1.0 texture texture
+vertex frame
+vertex 1.0 = texture 1.0 frame
+frame
+1.0 = -1 texture
+vertex
+-1 0.500000
+0.500000 bone vertex
+-1 frame frame
+-1 texture
+anim vertex
+1.0 material
+0.500000 texture vertex material
+material vertex
+texture bone 0.500000 bone
+1.0 anim
+material anim vertex -1 frame 0.500000 vertex
+texture frame
+material texture 1.0 vertex 0.500000 1.0
+=
+anim texture frame vertex anim texture = -1 texture
+-1
+anim
+vertex
+= frame
+material anim -1 = frame frame vertex material frame bone frame 1.0
+vertex frame 1.0 1.0 1.0 vertex -1
+0.500000 -1 vertex
+material texture 1.0 bone frame vertex
+vertex anim
+0.500000 -1 material
+-1 = 1.0 anim vertex -1
+material frame
+frame
+anim =
+anim texture anim -1 material texture 1.0
+vertex
+frame
+anim
+vertex
+anim 0.500000
+texture material
+anim material
+-1 -1 -1 vertex -1
+frame -1 1.0 anim
+-1
+frame -1 0.500000 -1 =
+0.500000
+-1 -1
+bone -1
+-1 1.0 -1 1.0 anim
+vertex texture material material 0.500000 0.500000 bone material vertex
+texture 1.0 -1 0.500000
+0.500000 0.500000 material material 0.500000 = frame anim frame bone 0.500000 = bone =
+material 1.0 vertex vertex 1.0 bone material
+-1 anim
+0.500000 bone -1 vertex =
+-1
+1.0
+vertex 1.0 vertex texture anim -1 anim
+anim
+vertex =
+anim
+bone texture bone = vertex 0.500000 frame =
+frame anim 1.0 texture 1.0 0.500000 =
+1.0 frame material frame bone 0.500000 1.0 texture
+0.500000 material anim 0.500000 material anim
+-1
+0.500000 texture frame 0.500000 0.500000 texture 0.500000 material = = anim texture material anim 0.500000
+material -1 0.500000 bone vertex 1.0 vertex texture
+material frame texture
+-1
+bone
+-1
+= 0.500000
+0.500000
+frame = vertex anim texture
+0.500000 anim vertex frame bone 1.0
+0.500000 material material
+0.500000 frame 1.0 -1 material frame 1.0 texture material 1.0
+1.0 vertex
+frame texture -1 material
+0.500000 texture bone texture anim 1.0 anim -1
+-1 frame =
+1.0 vertex anim 1.0 1.0 vertex vertex
+texture
+1.0 anim material -1
+1.0 frame 0.500000 -1
+vertex
+bone vertex
+bone anim
+1.0
+-1 1.0 material 0.500000 anim
+vertex -1 material texture frame 0.500000 anim -1
+0.500000
+material 0.500000
+0.500000 vertex
+bone
+texture bone -1 0.500000 anim
+-1 frame
+0.500000 1.0 bone material bone material 1.0
+-1
+texture
+vertex texture material 0.500000 material
+vertex bone 0.500000
+frame
+1.0
+anim bone
+frame -1 frame
+material 1.0
+bone material -1
+texture texture = -1 bone anim material
+bone
+vertex
+0.500000
+texture
+-1 material vertex bone bone
+bone texture anim
+0.500000
+vertex =
+bone
+anim
+bone = texture 0.500000
+0.500000 0.500000
+anim anim 1.0 vertex material 0.500000
+texture = anim 0.500000 -1 vertex bone
+1.0 frame =
+0.500000
+vertex frame 1.0 =
+1.0 material anim
+material = bone 1.0 1.0 texture
+texture frame material bone = frame material texture
+anim frame frame frame vertex
+0.500000 material =
+frame 1.0 texture
+texture 0.500000 bone
+= material anim vertex frame material bone
+1.0 material
+vertex 0.500000 anim
+anim anim 0.500000 vertex material vertex
+vertex
+anim frame
+0.500000
+frame 0.500000 -1 1.0 = frame texture frame
+texture bone
+= =
+vertex 
\ No newline at end of file
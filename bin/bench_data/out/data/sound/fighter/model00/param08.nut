@@ -0,0 +1,26 @@
+0.500000
+1.0 vertex frame
+=
+-1 =
+texture bone texture
+0.500000 0.500000
+-1 1.0
+0.500000 anim
+anim material vertex bone material bone vertex bone 1.0 = 0.500000 texture -1 vertex bone -1
+-1 material anim -1 1.0 vertex
+texture
+1.0
+material 1.0 = =
+anim material 0.500000
+anim material -1 frame bone 1.0 vertex material bone
+material 0.500000 texture 0.500000 texture
+texture
+texture texture -1 1.0
+0.500000 1.0
+vertex frame texture 0.500000 frame 0.500000 material material 0.500000 0.500000
+material
+1.0 1.0
+-1 bone
+=
+= vertex = anim bone texture = bone
+vertex vertex bone text
\ No newline at end of file
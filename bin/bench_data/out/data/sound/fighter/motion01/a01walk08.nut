@@ -0,0 +1 @@
+ݖ~>.2TBz'MQ}dͼ.Mֽq\D7Ɇ)+ef9dN9P{pOh
\ No newline at end of file
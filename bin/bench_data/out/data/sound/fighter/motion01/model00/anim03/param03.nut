@@ -0,0 +1,49 @@
+-1 anim frame -1
+frame anim bone -1 0.500000 vertex =
+0.500000 frame
+bone -1
+frame
+anim vertex material
+0.500000
+0.500000 -1 bone -1
+bone -1
+frame -1 -1 bone frame bone = 1.0 anim
+frame = frame
+bone = 1.0
+anim
+1.0
+anim frame
+material texture frame material = -1 1.0 anim
+-1 frame frame 1.0 bone material = 0.500000 vertex
+bone =
+texture
+texture = anim
+0.500000
+1.0 1.0
+1.0 1.0 -1 = material vertex anim 1.0 bone 1.0 material material = -1 anim frame 0.500000 -1 -1
+-1 bone
+0.500000 material frame texture 0.500000 1.0 -1
+bone -1 vertex anim 1.0
+texture -1 = frame
+frame 1.0 material anim vertex anim =
+vertex bone vertex bone material bone vertex material anim -1 = 1.0 texture -1 vertex
+material -1 = bone = frame -1 texture anim material vertex frame vertex 0.500000 = 0.500000
+bone bone material
+vertex
+=
+material -1
+texture anim texture anim
+anim 1.0 frame vertex vertex 1.0
+material texture frame anim bone
+texture anim frame texture
+0.500000
+vertex vertex
+-1 vertex
+frame
+vertex = -1 vertex frame
+1.0 bone bone bone
+anim 1.0 anim
+anim texture
+-1 frame = bone =
+= texture vertex bone 1.0 vertex
+0.500000 material -1 -1 material material 
\ No newline at end of file
@@ -0,0 +1,3 @@
+=
+material anim texture anim frame
+0.500000 1.0 = anim = 
\ No newline at end of file
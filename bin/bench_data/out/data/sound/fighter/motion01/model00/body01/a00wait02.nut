@@ -0,0 +1,3 @@
+material anim = frame
+0.500000
+texture frame -1
\ No newline at end of file
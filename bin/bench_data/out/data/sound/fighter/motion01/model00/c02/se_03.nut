@@ -0,0 +1,320 @@
+vertex texture
+bone frame frame
+frame 1.0
+1.0
+texture
+0.500000 -1 frame -1 -1 -1 frame 1.0 material bone
+-1
+bone -1 vertex
+-1 bone frame material vertex frame 0.500000
+anim
+vertex texture
+texture frame
+frame = vertex texture = = 1.0 -1 anim texture 0.500000 anim material texture
+vertex frame bone
+vertex bone = vertex material bone
+vertex 0.500000 bone frame material vertex 0.500000 material bone material vertex 1.0 =
+vertex
+-1 = bone -1
+anim frame -1 material vertex texture -1 frame
+anim texture texture -1 vertex 0.500000
+= 0.500000 -1 bone vertex 0.500000 frame frame
+anim texture vertex texture
+bone -1 texture material material -1 vertex
+anim 1.0 frame
+= material
+bone bone
+vertex bone 1.0 texture texture = 0.500000 anim
+-1 1.0 vertex material
+frame frame
+1.0 -1 0.500000 texture vertex texture
+frame =
+-1
+texture texture 0.500000 bone vertex anim 1.0 material
+vertex
+vertex =
+= anim anim anim texture
+anim
+material material frame frame
+vertex vertex 1.0 anim
+0.500000 1.0
+frame material
+frame
+0.500000 0.500000 1.0
+anim
+frame texture vertex
+anim anim vertex -1 bone anim =
+-1 = -1 bone = frame 1.0 anim
+bone -1 -1
+anim
+= anim 1.0 = anim vertex material texture
+texture anim 0.500000
+-1
+1.0
+anim texture
+anim
+-1 0.500000
+0.500000
+= material material = 1.0 -1 material 0.500000
+= texture
+= anim material = 1.0 anim texture vertex
+-1 = -1 frame 1.0
+bone
+anim 1.0 -1 0.500000 texture
+bone bone = vertex -1 0.500000
+vertex
+frame frame -1 -1 anim material vertex 0.500000 = material
+anim frame texture frame bone 1.0
+frame
+bone vertex anim vertex
+bone vertex bone = texture material material = texture
+1.0 1.0 bone
+texture frame -1
+0.500000 bone bone vertex
+vertex material 0.500000 0.500000 =
+-1
+material vertex vertex vertex frame anim
+1.0 = bone 1.0 -1 frame texture 1.0
+bone anim -1 -1
+anim bone bone 0.500000 0.500000 anim
+material material anim
+vertex vertex 1.0 vertex vertex vertex
+frame bone material 1.0
+frame
+texture vertex material frame material 0.500000 bone
+material =
+= -1
+vertex
+bone -1 texture vertex
+texture 1.0 -1
+frame anim material 0.500000
+= bone material bone 0.500000
+bone 1.0 -1 bone
+bone bone 0.500000
+= anim = texture bone -1 -1 1.0 = anim vertex frame
+vertex texture bone = bone
+vertex frame bone material bone -1 0.500000 1.0 texture 1.0
+-1 0.500000
+vertex frame texture material frame anim 0.500000 -1
+material texture bone vertex =
+vertex 0.500000 anim 1.0 texture vertex
+= 0.500000
+0.500000 1.0 bone
+vertex = = 1.0 frame bone frame texture
+= vertex 1.0 bone
+0.500000
+= = anim = texture
+= texture material
+frame 0.500000 -1
+1.0 0.500000 bone -1 bone frame bone =
+= anim bone vertex vertex
+bone 1.0 material 1.0 bone
+=
+vertex vertex anim
+0.500000 bone bone bone vertex bone
+vertex bone
+vertex -1
+-1 = anim
+0.500000 material -1 texture 0.500000 -1 vertex anim
+0.500000
+bone texture 1.0
+= = = bone
+frame material bone material texture 0.500000 texture texture 1.0
+-1 anim bone material texture
+vertex bone material
+-1 -1 -1 vertex texture texture 0.500000 texture
+frame
+-1 1.0 -1 1.0
+anim 0.500000
+1.0 -1 -1
+frame
+1.0 0.500000 1.0
+1.0
+texture
+anim material
+texture 0.500000 -1 vertex texture frame texture anim
+frame vertex 0.500000 anim anim vertex material material 1.0 anim material 1.0 vertex frame
+-1
+material material bone anim 1.0 -1 texture frame texture -1 vertex
+frame vertex texture frame frame frame = vertex anim -1 -1
+1.0
+-1 vertex 0.500000 bone
+frame material 0.500000 material texture bone
+bone texture
+frame 0.500000 bone frame 0.500000 = vertex = =
+material texture
+1.0 -1 = -1 frame material
+texture anim 0.500000 anim vertex material material
+texture frame 0.500000 0.500000 material
+vertex material texture 1.0 texture material -1 bone bone frame
+texture bone material 1.0
+0.500000
+-1 1.0 0.500000
+material vertex
+anim = texture -1
+material -1 anim
+frame bone material anim material frame vertex
+material
+0.500000 -1
+bone frame vertex =
+0.500000 0.500000 =
+anim -1 anim material 0.500000 0.500000
+vertex =
+frame 0.500000 -1 vertex 1.0 bone frame texture bone 1.0
+= 1.0 material
+texture -1 1.0
+anim
+bone material
+= = vertex frame 1.0 texture 0.500000 1.0 texture 0.500000 1.0 =
+0.500000 bone anim
+texture
+-1 -1 bone 1.0
+0.500000 material 1.0 -1 frame
+1.0 -1 frame
+bone -1 frame = bone -1
+anim 1.0 texture 0.500000 texture frame -1
+1.0 vertex frame
+texture bone 1.0 vertex = 1.0
+vertex 1.0 frame
+vertex 0.500000 anim bone material 0.500000 -1
+= -1 texture 1.0 1.0 -1 bone = 1.0 1.0 = vertex
+frame frame frame
+anim = 1.0 bone 1.0 bone 1.0 1.0 anim
+anim bone material
+1.0
+texture frame texture bone
+vertex
+=
+frame vertex vertex bone
+texture vertex
+anim
+1.0 anim 0.500000 bone 1.0 texture
+anim
+vertex
+frame bone texture 1.0 bone = anim vertex anim frame
+bone = 1.0 0.500000 bone
+0.500000 material anim
+frame texture bone bone 1.0 0.500000 bone 1.0 bone =
+0.500000 frame frame -1 -1 1.0 material -1 0.500000 frame
+0.500000 = material texture vertex frame -1 0.500000 frame bone =
+-1
+anim material 0.500000 = material =
+0.500000 material
+-1
+bone texture = texture 0.500000 0.500000 material
+-1 anim 1.0
+1.0 = bone
+0.500000
+0.500000 -1 frame 1.0 =
+frame texture bone -1 = material 1.0 vertex frame
+= texture vertex
+0.500000 =
+-1 frame vertex 0.500000 1.0 = material material material texture
+bone bone material
+vertex anim 1.0
+texture -1 1.0 frame anim
+material
+texture
+bone
+= bone =
+= 0.500000 -1 texture
+-1
+bone bone bone
+material anim 0.500000 vertex -1
+texture -1
+-1 material frame
+anim frame = frame -1
+0.500000 frame material -1
+anim
+1.0 vertex texture
+0.500000 anim
+1.0
+1.0
+0.500000 -1 vertex vertex bone vertex = 1.0
+texture texture material
+1.0 0.500000 vertex
+=
+= 0.500000 1.0 texture
+material material
+texture -1
+0.500000
+vertex -1 anim vertex frame = vertex vertex anim
+-1 vertex frame frame =
+material bone
+= -1 bone
+frame = 0.500000 -1 1.0 =
+frame vertex anim anim -1
+material
+vertex frame 1.0
+0.500000 frame frame 0.500000 texture 1.0 vertex anim 0.500000 0.500000 =
+-1 = -1 vertex
+vertex vertex = = =
+frame 1.0 frame frame
+0.500000 frame 0.500000 vertex frame bone
+bone
+= -1 texture 0.500000 1.0 1.0 0.500000 vertex 0.500000 bone anim material = texture 0.500000 texture frame
+vertex bone
+material 1.0 bone
+0.500000 anim -1
+texture -1 =
+vertex
+-1
+vertex
+material texture 1.0 1.0 0.500000 0.500000
+0.500000 material frame vertex 0.500000 material = = texture
+0.500000 -1
+bone vertex frame -1
+0.500000 material -1 vertex material
+material anim bone vertex 1.0
+texture
+texture vertex texture texture
+-1 0.500000 = bone
+frame texture vertex = -1 bone material
+frame = -1
+material
+0.500000
+= material
+frame vertex texture bone
+frame vertex =
+bone 1.0 0.500000 frame material frame vertex
+material frame 1.0 frame
+=
+bone
+frame -1 frame
+anim bone texture
+1.0 0.500000 texture 0.500000
+frame
+material 0.500000 vertex 0.500000 material 0.500000 bone
+anim vertex 0.500000 0.500000 bone
+= texture = = 1.0 frame 0.500000 1.0 material frame 0.500000
+frame material frame = frame frame frame
+1.0
+texture
+anim
+anim 1.0
+0.500000 -1 1.0 anim
+0.500000 =
+texture texture material bone
+0.500000
+material bone bone texture bone
+1.0 material
+=
+frame
+material 0.500000 bone 0.500000 vertex frame material = bone
+1.0 frame
+frame bone 0.500000 texture = texture 1.0
+material anim =
+frame
+bone
+bone
+material
+vertex
+=
+frame material 1.0 vertex
+= =
+frame
+frame
+= -1 = frame 1.0 vertex 1.0 material -1 =
+bone 0.500000 0.500000 -1 frame material 0.500000 0.500000 frame vertex texture material
+frame
+-1 bone -1 material
\ No newline at end of file
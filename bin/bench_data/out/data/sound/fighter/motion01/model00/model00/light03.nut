@@ -0,0 +1,6 @@
+= -1
+1.0 texture
+=
+anim texture -1 anim
+-1 bone -1 texture 0.500000 bone frame
+frame vertex 0.500000 0.50
\ No newline at end of file
@@ -0,0 +1,57 @@
+anim 0.500000 vertex = 0.500000 0.500000 material vertex 1.0 vertex
+frame texture -1 bone texture frame
+texture -1
+texture 0.500000 vertex texture bone texture anim
+0.500000 anim
+=
+-1 texture
+vertex vertex 0.500000 bone
+1.0 texture texture = 0.500000
+texture 1.0 1.0 vertex vertex frame -1 texture vertex
+texture
+material
+material
+0.500000
+1.0 vertex
+frame =
+=
+= frame texture anim material anim 0.500000 bone =
+1.0
+anim
+0.500000 = 0.500000 texture 0.500000
+vertex -1 1.0
+texture
+material frame
+0.500000 bone bone 1.0 -1 -1
+anim -1 vertex 0.500000 =
+bone 0.500000 vertex vertex texture texture = -1 =
+anim texture vertex material 0.500000 -1 frame texture -1 anim bone vertex
+texture 0.500000 -1 bone material bone material
+material vertex
+material 1.0
+1.0 0.500000 material
+anim
+texture anim texture vertex -1 = bone = material anim material
+0.500000 frame material 1.0 anim
+bone anim material vertex 1.0
+anim
+1.0 1.0 vertex anim -1 texture texture 1.0 vertex = 1.0 0.500000 vertex vertex bone
+1.0 0.500000
+vertex bone texture =
+anim = = -1
+= frame vertex vertex =
+bone frame frame material
+1.0
+-1 frame bone vertex 1.0 0.500000 material
+vertex texture vertex material
+anim frame frame
+=
+vertex
+bone anim material vertex
+-1 0.500000 bone vertex material
+1.0
+material material
+anim bone -1 material frame anim bone -1 1.0 frame
+material
+1.0 -1 anim texture 0.500000
+bone
\ No newline at end of file
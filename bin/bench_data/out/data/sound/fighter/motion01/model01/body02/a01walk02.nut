@@ -0,0 +1,83 @@
+frame
+anim frame 0.500000 texture anim
+0.500000
+bone anim bone 1.0 bone
+anim
+-1 frame anim = material texture texture -1
+0.500000
+0.500000 vertex vertex texture
+1.0 texture 1.0 -1 texture
+vertex material frame bone texture = 1.0
+anim material 0.500000 material
+vertex
+material
+frame frame
+frame 1.0 1.0 bone -1 frame 1.0 texture 1.0 texture
+= texture
+frame
+anim material frame 1.0 anim 0.500000 texture
+-1 material 0.500000 vertex material bone material bone texture 0.500000
+vertex texture anim = anim
+anim
+material
+= bone vertex material
+vertex =
+-1 anim anim
+material
+frame bone 1.0 material = material texture vertex
+vertex
+0.500000 =
+vertex frame
+vertex
+anim
+bone
+frame material 0.500000 1.0 anim 0.500000 =
+=
+vertex = -1
+texture
+1.0 bone anim bone frame -1 vertex frame material
+texture 1.0 0.500000 -1 anim material 0.500000 bone bone frame
+texture -1 0.500000 vertex -1 material
+1.0 frame = frame bone -1 bone = = 1.0 bone bone frame material
+0.500000
+-1 frame
+frame frame
+anim = bone 0.500000 bone
+-1
+texture
+-1 1.0
+material
+vertex texture material
+bone texture vertex 0.500000 vertex material material
+= -1 vertex texture material texture vertex 1.0 -1
+-1
+= frame
+anim
+material 0.500000 -1
+=
+0.500000 material 0.500000
+texture frame
+1.0 texture -1
+-1
+0.500000 bone material bone 1.0 bone bone anim 0.500000 frame
+1.0
+bone
+bone anim -1
+anim
+frame 0.500000 bone bone = frame
+= anim -1 vertex 0.500000 -1 texture anim vertex anim
+material
+bone 0.500000 anim -1 texture
+1.0
+bone
+anim texture 0.500000 = material material -1 frame
+vertex material
+1.0 texture texture
+1.0
+material 1.0 material anim
+bone 1.0 vertex -1 -1 -1 bone -1 1.0 texture
+texture =
+bone 1.0
+texture = =
+1.0
+vertex frame texture 1.0 = texture 1.0 = frame bone texture anim 0.50
\ No newline at end of file
@@ -0,0 +1,5 @@
+texture anim bone frame anim
+frame -1 material bone 0.500000 0.500000 -1 anim material anim
+bone vertex 0.500000
+frame material material
+material 0.500000
\ No newline at end of file
@@ -0,0 +1,2 @@
+-1 texture bone anim = vertex
+-1 texture texture material 
\ No newline at end of file
@@ -0,0 +1,6 @@
+vertex anim bone 1.0 1.0 anim texture vertex 0.500000 frame texture
+0.500000 bone = 0.500000 anim -1
+1.0 vertex 1.0 texture frame
+material material material -1 -1 anim 0.500000 material
+bone anim texture bone bone bone
+anim material material anim 
\ No newline at end of file
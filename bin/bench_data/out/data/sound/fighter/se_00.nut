@@ -0,0 +1,22 @@
+texture bone
+vertex vertex material
+anim = material vertex bone
+1.0 bone frame
+= bone
+1.0 bone
+bone
+texture 1.0 = frame 0.500000 1.0 0.500000 -1 texture material
+1.0 = texture 0.500000 texture
+texture
+frame anim material =
+bone texture vertex =
+anim 1.0
+1.0
+anim -1 bone material
+vertex vertex 1.0 bone anim
+material 0.500000 vertex -1 = bone
+anim
+anim
+frame vertex 0.500000 frame material 1.0 anim
+1.0 =
+1.0 anim a
\ No newline at end of file
@@ -0,0 +1,14 @@
+anim
+0.500000
+1.0
+bone = 1.0 anim bone 1.0
+-1 material -1
+vertex
+= -1 1.0
+frame -1 material
+anim vertex 0.500000
+=
+material frame anim frame
+bone frame
+material =
+0.500000 texture = -1 tex
\ No newline at end of file
@@ -0,0 +1,39 @@
+anim vertex material
+0.500000 frame 0.500000 bone texture frame
+= material material -1 1.0 0.500000
+= material anim material
+0.500000
+frame = =
+bone
+texture
+anim
+= vertex material 0.500000
+material =
+vertex bone vertex texture material
+frame vertex 1.0 frame anim
+vertex frame material
+anim material
+= frame -1
+texture
+= frame anim -1 frame vertex bone anim vertex 1.0
+material
+1.0 anim = texture
+bone vertex 0.500000 anim anim = vertex frame frame vertex anim
+= texture
+material =
+bone texture
+anim
+frame = bone anim frame frame = = material
+0.500000 vertex bone
+texture
+texture texture vertex 1.0
+1.0
+-1 bone vertex anim 0.500000 bone bone texture
+= 1.0 frame
+0.500000
+= = frame -1 bone
+frame frame texture material
+material 1.0
+texture material material vertex = texture 0.500000 bone
+bone anim vertex
+0.500000 frame texture bone
\ No newline at end of file
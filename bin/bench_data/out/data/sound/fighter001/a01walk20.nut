@@ -0,0 +1,9 @@
+-1 0.500000 vertex bone
+= -1 = bone = 1.0 bone
+=
+material
+material bone
+0.500000
+-1 material material 1.0 material
+frame anim vertex bone texture
+texture 0.500000
@@ -0,0 +1,228 @@
+anim -1 -1 0.500000 texture
+anim -1 -1 material material bone bone frame 1.0 = frame material
+= -1
+frame material
+1.0
+vertex
+anim texture 0.500000 vertex frame -1
+0.500000 anim =
+= anim material bone
+anim 0.500000 texture
+-1 1.0 = vertex material -1 -1 = 1.0 bone
+= anim frame
+anim bone material 1.0
+material bone -1 anim material bone = bone vertex anim frame 0.500000 bone
+texture 0.500000 anim texture
+frame frame = material frame -1
+material
+0.500000
+0.500000 -1 vertex 0.500000 =
+-1 bone
+1.0 -1 1.0 anim vertex -1 -1 1.0 1.0 1.0 0.500000 -1 texture anim anim frame 1.0 bone =
+vertex anim 1.0 texture 1.0 frame
+anim vertex
+1.0 bone
+anim vertex
+texture vertex vertex
+1.0 frame
+1.0 =
+0.500000
+1.0 = material = 0.500000 0.500000 frame -1
+-1 anim material texture bone material 0.500000 material -1 anim 0.500000
+1.0 1.0 bone texture texture = texture material
+1.0 1.0
+texture
+= texture frame anim 1.0 1.0 -1
+material texture =
+vertex
+anim
+texture vertex anim vertex frame material anim bone 1.0
+bone
+material = =
+= anim
+material 1.0 =
+material material 1.0 texture texture 0.500000 vertex material frame
+frame vertex material
+texture anim
+material frame texture anim texture vertex
+bone frame texture 1.0 bone
+1.0 vertex anim -1 texture =
+material 0.500000 bone frame frame texture
+bone 0.500000
+-1 anim vertex 0.500000 material
+anim texture anim 0.500000
+bone
+texture 1.0 texture anim 0.500000 -1 vertex anim
+0.500000
+frame -1
+texture
+frame = material
+material
+texture = texture 1.0
+0.500000 1.0 material anim 0.500000
+texture texture bone 1.0 texture texture -1 bone 1.0
+= 0.500000
+frame
+-1
+bone
+frame = texture bone
+anim -1
+bone =
+-1 0.500000 -1 anim
+texture -1 texture -1 anim 0.500000 0.500000 anim anim bone material
+= bone
+frame bone = -1
+bone frame frame anim vertex frame material vertex 1.0
+bone
+anim 0.500000
+0.500000 vertex
+texture bone
+anim vertex anim 1.0 0.500000 = texture
+-1
+anim
+frame 0.500000 = anim
+-1 1.0 anim 0.500000 -1 -1 frame material = texture
+-1 bone
+texture material
+0.500000 vertex
+-1
+= texture = anim
+frame
+-1
+1.0 bone -1 0.500000 material
+1.0 texture anim frame
+0.500000 0.500000
+material
+texture vertex -1 0.500000 0.500000 anim = anim
+0.500000 material = 0.500000 frame
+1.0
+vertex = vertex anim
+= -1 bone 1.0 0.500000 frame anim 0.500000 0.500000 1.0
+-1 -1 vertex
+0.500000 vertex anim texture
+-1 vertex
+1.0 vertex
+0.500000 =
+frame
+anim texture 0.500000
+vertex frame
+-1 -1
+=
+anim
+frame 0.500000 vertex
+material bone anim = vertex bone bone vertex -1 1.0 =
+1.0
+0.500000 0.500000
+-1 material vertex bone texture -1
+-1
+vertex frame 0.500000 1.0 texture vertex frame
+vertex material vertex 0.500000
+-1 1.0 vertex material vertex texture
+vertex =
+vertex
+vertex 1.0
+anim frame anim anim 0.500000 anim texture 1.0 = frame
+0.500000 frame 1.0
+vertex 1.0 bone material
+-1 -1 0.500000 anim bone frame anim
+vertex bone
+anim 0.500000 vertex 1.0 texture -1 material vertex texture texture frame frame bone
+1.0 -1 texture material
+vertex bone 0.500000 bone bone 1.0 =
+= anim -1 bone 0.500000
+-1 vertex bone
+bone =
+texture material texture bone anim vertex frame -1
+0.500000 vertex 1.0 0.500000 frame = -1 frame
+1.0 -1 material frame anim 0.500000 -1 texture
+= -1 texture texture
+texture material -1 bone anim anim material texture = 1.0 -1 bone material
+vertex texture bone bone 0.500000 1.0 vertex
+-1 -1 vertex
+vertex
+0.500000
+material 1.0
+= -1 0.500000 frame -1 material
+anim
+frame vertex frame bone frame 0.500000 0.500000 bone -1 anim frame texture
+material
+0.500000
+vertex
+bone
+anim
+1.0 anim frame bone
+anim = = vertex anim = = texture 0.500000 material 0.500000 frame
+bone anim 1.0 =
+frame
+=
+1.0 = bone bone vertex 0.500000 0.500000 frame -1
+frame texture texture
+= -1 0.500000 frame texture -1
+bone texture = texture anim bone frame material -1 frame texture 0.500000 = texture
+0.500000 vertex material
+bone
+-1 material -1 frame 0.500000 bone
+frame
+frame frame
+material vertex bone
+1.0 material
+texture anim
+frame = anim
+frame
+material =
+1.0
+-1 -1 anim -1
+bone 0.500000
+= anim 0.500000
+vertex texture = vertex 0.500000 = material = texture texture texture frame 1.0 0.500000 bone vertex 0.500000 texture =
+= vertex 1.0 anim = anim anim vertex material
+material vertex material texture material 0.500000 -1
+0.500000 vertex =
+frame
+-1 -1 material = vertex frame vertex anim material anim
+texture = -1
+anim 1.0 texture frame
+= -1
+=
+1.0 material
+anim texture =
+0.500000 anim 0.500000 1.0
+bone
+= anim 1.0
+material
+texture
+frame texture vertex
+-1
+0.500000 material 0.500000 bone anim
+frame anim
+-1
+0.500000 frame 1.0 =
+texture
+anim 1.0 anim bone vertex frame material
+texture bone frame vertex = frame vertex = = vertex 1.0 texture
+texture
+frame -1
+frame texture texture material
+1.0 anim vertex
+material 0.500000 -1
+= 1.0 1.0
+anim 1.0
+vertex 1.0 = 0.500000
+frame texture texture
+=
+1.0
+frame
+bone
+vertex
+0.500000
+0.500000 1.0 anim anim bone -1 texture
+texture = anim
+texture
+0.500000 =
+-1 texture anim frame texture bone texture -1
+vertex anim
+= = -1 anim 1.0 1.0 1.0 anim anim anim
+0.500000 -1
+1.0 -1 0.500000
+material 1.0 0.500000 vertex
+0
\ No newline at end of file
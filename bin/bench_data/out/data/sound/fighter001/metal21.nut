@@ -0,0 +1,147 @@
+-1
+material =
+-1 -1 =
+frame
+0.500000 = 1.0 anim 0.500000
+frame 1.0 texture anim texture 1.0 1.0
+0.500000 -1
+frame
+texture anim material vertex
+bone vertex
+texture frame
+-1 vertex = 1.0 vertex frame anim 1.0 frame vertex 0.500000 anim texture = frame
+frame frame anim -1 vertex
+-1 material
+texture
+frame bone material anim material
+0.500000
+bone 0.500000 frame vertex vertex =
+frame vertex material
+bone texture frame 0.500000 texture -1 anim -1
+vertex anim material = texture -1 1.0 0.500000 = -1
+= bone
+anim frame frame bone 1.0
+material
+anim =
+0.500000 =
+= -1 = = 0.500000
+texture = texture 0.500000 anim = 1.0 -1
+anim
+texture material 1.0
+texture 0.500000
+texture
+1.0 bone frame anim anim 0.500000 material 1.0 texture 0.500000 = bone anim vertex material
+texture =
+material = texture frame vertex bone
+bone frame 0.500000 frame bone 1.0 bone
+anim anim
+texture
+vertex = 1.0
+anim texture bone material texture 1.0
+-1
+-1 material =
+vertex anim 0.500000 vertex
+vertex anim texture vertex texture bone -1 vertex
+anim
+bone texture texture 0.500000 material frame bone texture bone -1 frame material = 1.0
+anim anim bone
+vertex
+material texture 0.500000
+material frame = -1 frame anim
+material
+vertex vertex
+-1 frame material bone 0.500000 0.500000 bone =
+material bone bone -1
+0.500000 -1 texture material texture -1 anim 0.500000 -1 -1 material 0.500000 vertex bone
+0.500000
+frame 1.0 texture 1.0 -1 = 1.0 = frame anim bone material 0.500000 frame frame anim
+material vertex frame frame
+vertex frame vertex bone
+-1 0.500000 -1 anim material = vertex
+1.0 0.500000 anim
+0.500000 bone material
+texture =
+-1 anim material material bone -1 material -1 -1 texture anim material material vertex bone
+vertex material
+0.500000 material frame
+-1 0.500000
+frame frame vertex vertex = bone 0.500000 -1 frame
+0.500000 material
+bone 0.500000
+1.0 0.500000 anim =
+vertex texture 0.500000 -1 = -1
+-1 = -1 frame texture 1.0 -1
+texture
+material -1 anim frame bone 1.0 1.0 frame -1 texture bone bone 0.500000 bone texture anim material
+1.0
+anim anim 0.500000 -1 texture 1.0
+1.0
+1.0 anim
+texture -1 -1 1.0
+1.0
+vertex anim = material = bone 0.500000 frame
+vertex
+0.500000 frame
+anim
+vertex 0.500000 1.0 bone
+texture
+vertex vertex 0.500000 vertex 0.500000 bone material anim vertex
+bone texture 0.500000 anim texture anim -1 anim
+1.0 = material 1.0
+texture 0.500000 material = 0.500000 1.0 0.500000 0.500000 texture 0.500000 material frame material material frame bone material anim
+0.500000
+texture frame frame
+-1
+anim 1.0 -1 frame
+bone vertex texture 0.500000 frame -1 1.0 -1 texture anim 1.0 -1 1.0 vertex vertex
+= 0.500000 texture
+vertex bone -1
+1.0 frame 0.500000 anim 1.0 vertex = bone =
+-1 = bone
+material
+bone material
+anim
+bone
+vertex
+-1 texture material
+0.500000
+anim texture vertex 0.500000 -1 vertex
+0.500000 -1
+bone frame
+material
+frame
+frame frame frame = 0.500000 bone -1
+-1 -1
+-1
+anim
+frame -1
+frame frame = material frame
+frame bone
+1.0 vertex material frame = frame =
+= material vertex anim
+material
+-1 texture texture -1
+anim
+bone
+material -1
+material = 0.500000
+anim -1 frame material anim anim bone bone bone 0.500000 texture
+texture material -1
+-1
+= anim texture
+-1 bone
+anim vertex anim frame material frame
+material anim
+1.0
+1.0 vertex = -1 =
+vertex = anim 1.0
+anim frame
+vertex
+-1 frame anim bone vertex -1
+bone anim frame anim 0.500000 vertex -1 = texture
+material material 0.500000 frame 0.500000
+frame frame = -1 0.500000 texture vertex frame
+= material -1
+-1
+bone texture frame
+m
\ No newline at end of file
@@ -0,0 +1,64 @@
+frame frame -1 anim
+texture = = frame
+frame
+0.500000
+bone material -1 frame frame 1.0 vertex 0.500000 frame anim 0.500000 texture 1.0 -1 texture vertex
+material
+vertex
+1.0
+-1 0.500000 frame = -1
+= bone = -1
+anim
+texture 1.0 frame = frame bone -1 texture
+frame frame texture bone 0.500000
+bone =
+-1
+= anim vertex 0.500000
+0.500000 frame
+-1 1.0
+frame bone 0.500000 0.500000 = -1
+material
+frame 0.500000 -1 1.0 vertex
+texture 1.0 bone =
+0.500000
+anim texture
+frame = anim anim anim
+-1
+bone
+bone material
+vertex anim material anim bone texture
+1.0 texture = = -1 frame texture anim
+-1 = frame 1.0 vertex
+vertex bone = texture
+texture 0.500000 material = anim 1.0 frame
+-1 texture
+texture = vertex 0.500000 1.0
+1.0 frame anim 1.0 vertex
+=
+vertex 0.500000
+material -1
+vertex
+= anim bone anim -1 -1
+0.500000 -1 bone anim
+bone
+texture 1.0 frame texture 0.500000
+frame vertex frame
+texture 1.0 material 0.500000 1.0 anim
+material anim
+1.0 frame frame
+1.0
+= material
+0.500000
+anim frame texture
+= = 1.0
+texture material bone 1.0
+texture vertex anim
+-1 frame = frame
+1.0 0.500000 bone bone 1.0 1.0 -1 anim anim anim frame
+anim -1 vertex = frame -1 =
+texture frame -1
+vertex 0.500000 1.0
+material
+1.0 vertex 0.500000 0.500000 vertex -1 1.0 vertex = 1.0 anim texture
+1.0 1.0 1.0
+= material = frame 0.500000 1.
\ No newline at end of file
@@ -0,0 +1,11 @@
+0.500000 1.0 -1 frame 1.0 frame
+bone 1.0
+1.0
+0.500000 = -1 bone 0.500000 -1 texture
+1.0 texture
+vertex anim frame -1 1.0
+anim anim texture 0.500000
+frame
+=
+anim 1.0 0.500000 1.0 = bone
+-1 vertex -1
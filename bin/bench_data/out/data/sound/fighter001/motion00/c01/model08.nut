@@ -0,0 +1,4 @@
+anim material
+-1 1.0
+= frame = 0.500000 = frame -1 material 1.0
+mate
\ No newline at end of file
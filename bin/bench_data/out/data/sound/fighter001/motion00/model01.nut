@@ -0,0 +1,29 @@
+0.500000 1.0
+=
+frame vertex
+frame -1 frame 0.500000 anim 0.500000 vertex material texture
+= bone
+-1
+1.0 vertex
+material frame 1.0
+0.500000 0.500000 material
+frame = texture material texture
+frame bone material 1.0
+bone texture 1.0 1.0 anim
+0.500000 texture
+bone frame bone material material
+= = -1
+=
+= material 0.500000 vertex texture texture texture =
+material texture
+texture frame -1 0.500000
+texture material
+= 0.500000 texture
+vertex frame
+-1 anim -1 -1 frame texture frame frame
+material -1 0.500000
+vertex = -1 frame material -1 material anim 1.0
+0.500000 = texture material frame frame 1.0
+1.0 vertex
+=
+material 1.0 anim
\ No newline at end of file
@@ -0,0 +1,38 @@
+anim material texture = bone 0.500000 frame bone texture 0.500000
+material bone anim -1
+frame material anim
+material
+frame frame 1.0 vertex material bone 1.0
+bone
+material 1.0
+1.0 0.500000
+1.0 material frame texture
+1.0 anim vertex -1 anim vertex =
+texture = anim anim 0.500000 texture
+vertex = 1.0 texture frame texture 1.0
+0.500000
+vertex 1.0 bone texture =
+vertex
+bone
+anim anim bone bone anim vertex frame texture
+anim
+material vertex
+material 1.0
+material bone 0.500000 = 0.500000 material frame material vertex material 1.0 frame 1.0
+frame bone material vertex = 1.0 1.0
+0.500000 = = material anim 1.0
+anim bone 0.500000
+material
+frame material texture bone bone
+1.0 texture frame =
+material vertex 0.500000
+frame
+1.0 vertex texture 0.500000 = -1 anim 1.0 0.500000
+anim 1.0 material texture = texture
+texture texture
+vertex 0.500000 vertex = anim material bone
+frame
+texture bone 0.500000 texture
+frame
+material bone frame
+anim ver
\ No newline at end of file
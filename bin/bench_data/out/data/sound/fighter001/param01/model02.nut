@@ -0,0 +1,297 @@
+1.0
+-1 =
+-1 frame bone 1.0 -1 = bone frame vertex 0.500000 1.0 frame
+1.0 frame anim
+vertex 1.0 frame material bone bone
+bone bone material 1.0 bone anim anim bone anim vertex 0.500000 material
+material
+=
+frame 0.500000 material 1.0 frame material
+bone
+-1
+= = vertex -1 bone frame bone 0.500000 -1 texture 1.0 -1 material = 0.500000 = vertex material
+0.500000 =
+= 1.0 1.0
+= anim
+-1 vertex 1.0 texture material anim
+0.500000
+vertex anim 0.500000 1.0 = texture = material material anim material
+-1 frame texture
+bone = anim material 0.500000
+frame 1.0
+= material texture texture texture bone
+1.0 -1
+1.0
+texture texture vertex vertex
+1.0 material vertex vertex -1
+bone 1.0
+anim
+-1 frame frame
+-1 =
+vertex 0.500000 =
+vertex anim =
+-1 bone anim
+= vertex frame
+-1 bone bone
+frame texture 0.500000 = 1.0 anim 1.0 0.500000 anim
+1.0
+-1 -1 texture vertex = material
+frame material bone anim
+texture
+anim anim frame texture vertex vertex
+anim anim
+= 1.0 texture material anim
+0.500000
+vertex
+= texture
+= material
+frame anim texture frame
+frame 1.0 frame bone anim
+texture
+= anim
+texture anim
+= -1 0.500000 vertex
+= material frame vertex anim 0.500000
+1.0 texture
+frame texture -1 1.0 bone
+anim 1.0 frame
+texture bone material vertex
+material anim
+material frame =
+1.0
+material
+1.0 frame
+vertex
+-1
+frame
+-1 bone bone material bone 1.0 texture -1 = bone
+-1 = bone anim bone material
+0.500000 1.0 texture frame
+texture material bone
+= anim = 0.500000 = 0.500000 0.500000
+bone 0.500000 bone texture material 0.500000
+anim texture =
+material material -1 1.0 vertex -1 material
+texture = -1 = bone frame
+material 1.0 texture
+frame = anim = vertex
+bone
+frame -1 -1 0.500000 bone texture bone texture = anim frame texture frame frame material
+anim =
+texture
+bone anim -1 anim
+1.0 = texture frame
+frame 1.0
+-1 =
+bone
+vertex vertex
+0.500000
+= vertex material bone
+texture =
+bone vertex
+1.0 frame =
+1.0
+material frame texture 0.500000
+anim 0.500000 frame material frame bone -1
+vertex anim 1.0
+frame 1.0
+-1 bone frame bone = material 0.500000
+bone vertex bone 0.500000 frame
+texture frame
+1.0
+1.0 anim 1.0 0.500000
+material frame 1.0 1.0 frame
+-1 anim 1.0 vertex frame 0.500000 1.0 anim 1.0 vertex frame material 1.0 vertex vertex texture vertex bone texture
+anim texture texture frame anim
+texture material
+anim material vertex vertex anim texture
+=
+bone = texture material
+anim
+frame =
+bone = vertex
+vertex texture 0.500000
+-1 anim 0.500000 =
+bone
+1.0 texture anim material bone
+frame
+0.500000 texture 0.500000 0.500000 anim -1 anim frame
+-1
+vertex
+bone
+anim material vertex vertex material texture = texture vertex
+vertex material vertex texture bone bone
+1.0 anim 1.0 texture vertex texture 0.500000 vertex material
+material
+1.0 vertex 0.500000 1.0 -1 = -1
+material 1.0 1.0
+anim frame -1 anim vertex 0.500000 1.0 =
+frame -1 bone -1
+= frame
+-1 0.500000 frame 1.0 0.500000
+anim texture
+anim
+vertex -1 material frame -1 bone -1 =
+anim 1.0 vertex anim
+anim 0.500000 bone frame texture
+bone anim bone = -1 texture texture frame
+texture bone texture -1
+0.500000 material
+anim -1
+vertex
+bone material frame anim texture 1.0
+-1 0.500000 anim 1.0 0.500000 = -1 material
+=
+bone
+anim
+-1 = =
+1.0
+material =
+-1 -1 1.0 1.0 texture -1 bone material = anim = anim anim vertex 0.500000 frame anim anim vertex 1.0
+texture vertex
+1.0 -1
+texture frame texture frame
+-1 -1 0.500000 material bone texture
+vertex material
+material -1 =
+0.500000 0.500000 vertex -1
+1.0 =
+texture bone texture material 0.500000 frame 0.500000 0.500000 = 0.500000 1.0 = anim = texture 1.0
+0.500000 anim
+= 0.500000
+anim = 0.500000 = vertex material material texture -1 anim
+frame vertex bone 1.0 = 1.0
+bone 0.500000 1.0 1.0 material vertex 0.500000 0.500000
+material material texture = -1 -1 frame anim
+0.500000 0.500000 frame 1.0 texture vertex material anim frame -1
+bone anim vertex = 1.0
+material vertex material 1.0
+material = material 0.500000 frame vertex frame -1 frame 0.500000 1.0
+bone frame material
+vertex = anim
+=
+vertex vertex texture
+frame
+bone = 0.500000 frame =
+anim
+bone
+0.500000 -1 material 1.0 anim texture =
+0.500000 1.0 -1
+vertex frame -1
+0.500000
+0.500000
+vertex 0.500000
+bone bone texture material bone bone frame -1 -1 0.500000 anim = vertex
+vertex vertex material texture texture
+bone vertex material -1 frame texture = anim =
+frame
+bone material texture anim 0.500000 material frame anim 0.500000 =
+= frame 0.500000 frame anim anim anim
+vertex
+material frame 1.0 frame material bone frame
+-1
+1.0 =
+anim bone =
+vertex
+texture anim = frame vertex frame frame 1.0
+texture bone vertex
+-1 texture material -1 bone bone anim 0.500000 frame = vertex anim vertex
+0.500000 material texture
+frame material -1
+texture frame -1 =
+vertex frame 1.0 = vertex -1 anim bone material vertex material bone frame material material material frame 0.500000 bone frame = 0.500000
+anim material vertex bone bone = -1
+anim frame anim vertex = 0.500000
+vertex =
+anim material texture vertex
+frame = anim material 0.500000
+vertex bone -1 anim anim
+1.0 0.500000
+bone bone vertex
+anim
+0.500000
+-1
+-1 vertex bone texture vertex bone 1.0 frame vertex -1
+-1 texture bone 0.500000 1.0 1.0 bone
+material texture material
+anim 1.0
+vertex
+= = texture 0.500000 vertex
+= = material frame frame bone
+-1 vertex 0.500000 1.0 vertex 1.0 material 0.500000 0.500000 anim =
+vertex = vertex material
+vertex anim texture material frame
+texture anim frame 1.0 anim vertex 0.500000 0.500000 1.0
+0.500000
+= bone anim
+= frame material 0.500000 1.0 bone material frame -1
+1.0 texture =
+material anim anim 1.0 -1 texture material material material
+texture -1 vertex = 0.500000 -1 frame
+-1 anim = 1.0 = 1.0 texture vertex frame anim 1.0
+1.0 1.0 vertex = 1.0
+=
+material
+1.0 0.500000 0.500000
+0.500000
+frame 1.0 material -1 bone
+anim material
+anim texture anim frame -1
+frame vertex bone 0.500000 material
+texture -1 anim 1.0 frame
+1.0 texture anim
+texture 1.0
+-1 vertex 0.500000 = -1 = -1
+1.0 = 0.500000
+anim = texture texture 0.500000 0.500000 frame 1.0
+texture
+1.0
+anim
+vertex vertex
+1.0 material anim anim -1 frame
+anim
+frame
+anim 0.500000 material 0.500000
+bone vertex material
+material texture frame
+texture frame material bone texture
+anim 1.0 1.0
+anim
+1.0 frame
+1.0 bone bone bone frame 0.500000 texture = material -1 vertex frame vertex anim
+1.0 anim
+= frame 1.0 vertex 1.0
+-1
+texture material anim 0.500000 bone frame
+1.0
+vertex texture -1 vertex
+=
+0.500000 bone = -1 0.500000 -1
+anim 0.500000 texture 0.500000 frame = bone -1 texture
+material anim frame bone 1.0
+= 0.500000 0.500000
+bone vertex texture
+=
+vertex texture material
+1.0
+0.500000 texture anim texture bone texture
+texture 0.500000 anim bone 0.500000 1.0
+0.500000
+texture 0.500000 -1 texture material
+= anim -1 texture material anim frame
+anim = texture texture = -1
+0.500000 0.500000
+frame bone vertex
+-1 material -1 material 0.500000
+anim = frame
+1.0 frame
+anim vertex 1.0
+frame 0.500000 -1 0.500000 material frame
+= frame = anim anim vertex bone material -1 anim
+0.500000 0.500000 0.500000 bone
+frame
+bone anim
+bone -1 anim 1.0 -1 -1
+anim frame
+bone
+1.0 
\ No newline at end of file
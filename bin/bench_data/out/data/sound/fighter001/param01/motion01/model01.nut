@@ -0,0 +1,146 @@
+frame texture 1.0 frame -1
+=
+vertex texture vertex = texture
+-1 material
+-1 vertex 1.0 texture
+-1 material frame -1
+texture
+frame material material
+0.500000 -1 bone frame 0.500000
+bone 0.500000 frame bone vertex
+bone material 1.0 -1
+texture -1 0.500000 1.0
+material
+frame
+bone
+texture vertex anim frame 0.500000 texture
+-1 -1 bone bone -1 -1 bone
+0.500000 frame 1.0 -1
+0.500000 texture
+1.0 bone =
+-1 frame = frame 0.500000 frame
+1.0 texture texture frame
+-1
+anim bone material vertex anim
+-1
+-1 texture
+-1 0.500000 0.500000 anim frame material
+anim texture = -1 0.500000 bone -1 -1 -1 1.0 texture 0.500000 -1 = bone anim frame
+frame
+vertex
+-1 anim
+frame
+vertex bone
+-1 -1 material -1 0.500000
+anim bone vertex anim bone
+material anim anim frame = anim 0.500000 texture
+1.0
+0.500000
+0.500000
+0.500000
+bone anim 0.500000 = bone 1.0
+1.0 0.500000 -1 =
+= frame 0.500000 vertex = 1.0 vertex material
+=
+-1 0.500000 vertex
+anim texture anim
+frame
+-1
+bone anim texture -1 bone
+frame
+vertex
+= 1.0 vertex frame -1
+material bone 0.500000 -1 texture
+= 1.0 1.0 anim frame bone bone 1.0 0.500000
+frame bone = =
+= 1.0
+frame anim texture material -1 vertex 0.500000
+frame texture
+texture frame -1
+vertex material material
+= 1.0
+=
+1.0
+-1 = material 0.500000 material material texture
+frame =
+anim 1.0 = -1 vertex material texture 0.500000 frame -1 vertex anim
+-1
+bone
+anim material
+vertex bone frame
+material
+=
+texture
+anim anim vertex anim = 1.0 frame
+frame texture 1.0 1.0
+frame vertex
+-1 bone = frame texture
+texture bone
+material frame bone bone vertex
+anim 0.500000
+= vertex material anim 0.500000 vertex
+0.500000 0.500000 -1
+1.0
+material -1 =
+0.500000 bone texture bone material anim 1.0 0.500000 vertex frame -1 texture frame 0.500000 = frame anim 1.0 0.500000 frame 0.500000
+1.0 0.500000 vertex frame 0.500000 vertex
+-1
+texture anim
+-1
+frame vertex -1 = bone anim
+frame
+bone frame anim = anim texture 1.0
+= material = 0.500000 0.500000 anim -1 -1 1.0 texture anim bone material =
+1.0 anim bone
+-1 -1
+material 0.500000 = bone -1
+frame
+texture
+anim vertex
+0.500000 bone texture
+= anim vertex
+1.0 vertex frame texture frame frame material -1 anim bone anim
+vertex texture anim 1.0 = frame texture vertex anim
+frame
+vertex anim anim frame texture frame 0.500000 material
+0.500000
+1.0 bone
+texture -1 material
+-1 -1 material 1.0 texture texture bone vertex -1
+anim bone bone texture
+material 1.0 = 1.0 = = 0.500000
+bone
+frame anim = 1.0
+frame vertex texture vertex vertex -1 = texture bone material
+-1 -1 frame vertex material bone 0.500000
+texture
+vertex 0.500000 frame material bone = anim 0.500000 bone material anim
+1.0 = 0.500000 frame material texture vertex vertex -1 0.500000
+vertex bone
+bone 1.0 material bone 0.500000 0.500000 texture anim
+frame vertex
+material texture
+bone
+-1
+frame vertex
+texture frame
+anim 0.500000
+material texture
+frame frame bone vertex = = 0.500000 = = material
+0.500000 = = 0.500000 anim 1.0 material -1
+1.0 bone = 0.500000 texture vertex -1
+vertex = = = 0.500000 -1 = material 1.0 texture
+anim = -1 = material
+0.500000 0.500000 texture
+vertex vertex anim material 1.0 -1 vertex texture -1
+0.500000 = texture -1 vertex
+-1 bone 0.500000 material vertex vertex
+material
+0.500000
+anim
+material frame vertex -1 frame = frame 0.500000 1.0
+texture = anim material frame
+0.500000 1.0 vertex bone -1
+0.500000 = texture anim 0.500000 0.500000 = 0.500000 texture anim bone
+texture anim = 1.0 0.500000 -1 bone frame =
+vertex material = 0.500000 -1 texture 1.0 vert
\ No newline at end of file
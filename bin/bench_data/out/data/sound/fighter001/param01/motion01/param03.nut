@@ -0,0 +1,27 @@
+= vertex -1
+0.500000
+= 1.0 material 1.0
+-1 anim 1.0
+material frame frame bone -1 vertex -1 frame material 1.0 vertex = bone
+= frame = material
+1.0 material 1.0 anim 0.500000 frame frame texture bone material anim bone frame
+vertex
+-1 anim material vertex
+=
+texture vertex material 1.0 1.0 1.0
+texture
+material anim =
+1.0 frame frame texture
+1.0 -1 material material
+material
+anim 1.0 -1 vertex 1.0 frame
+texture vertex 0.500000 bone anim -1 vertex -1 anim 0.500000 = vertex vertex -1 texture material 1.0 bone 1.0 anim frame frame
+vertex
+frame bone = frame frame texture
+vertex
+texture
+1.0 1.0 vertex -1
+bone vertex texture vertex = 0.500000 frame bone = frame
+frame 1.0 -1
+texture vertex anim
+frame = = frame = frame fram
\ No newline at end of file
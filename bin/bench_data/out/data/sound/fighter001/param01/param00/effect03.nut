@@ -0,0 +1,14 @@
+1.0 material
+texture 0.500000 vertex = anim frame material anim
+material
+anim frame = 0.500000 frame
+frame
+anim
+-1
+frame bone 1.0 vertex
+material vertex frame
+0.500000 anim bone frame material 0.500000
+= material anim -1 vertex frame 0.500000
+=
+texture bone -1
+1.0 texture
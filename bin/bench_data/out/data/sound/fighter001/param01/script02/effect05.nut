@@ -0,0 +1 @@
+o҉YpsxH5!V1삯9Z,2J1uc#n A-O>O3ˁH!p=_];5i4#&SwQzϛH0^aČ|
\ No newline at end of file
@@ -0,0 +1,159 @@
+=
+frame = frame texture
+texture = -1 anim vertex
+anim 0.500000
+0.500000 = texture vertex anim bone = material
+frame bone -1 bone bone texture texture frame bone
+bone
+vertex 0.500000
+1.0
+vertex = frame texture
+-1 bone material 1.0 vertex
+anim -1
+bone =
+0.500000 1.0 frame texture frame material anim bone -1 1.0 anim = frame
+0.500000 texture
+texture anim texture
+1.0 = anim vertex 1.0 1.0 bone 1.0 = 0.500000
+-1 frame vertex texture anim
+vertex
+material
+0.500000 anim -1
+-1 0.500000 frame 1.0 anim
+vertex = anim
+= frame frame
+texture vertex 0.500000 anim 1.0 frame
+= anim material -1 texture bone 0.500000 -1 =
+bone -1 -1 1.0
+texture frame
+= = 1.0
+= bone material material = = material bone -1 0.500000
+0.500000 bone frame
+vertex
+0.500000
+anim frame 0.500000 0.500000
+texture 1.0 vertex 1.0 1.0 bone vertex
+vertex 1.0 = anim -1 -1 texture -1 -1
+anim anim
+1.0
+texture
+1.0
+texture anim -1 vertex 0.500000 vertex
+anim frame
+vertex 0.500000 material
+material
+material vertex
+= texture 0.500000
+material bone material frame
+texture -1
+0.500000
+frame bone bone -1
+frame frame -1
+-1
+1.0 texture = vertex
+bone material = 1.0 frame -1 = = 1.0
+1.0 material 1.0 material
+bone vertex material anim bone material vertex 1.0
+vertex -1 texture =
+anim =
+bone -1 1.0 frame material
+=
+material
+anim 1.0
+= -1 vertex 0.500000
+= -1 bone bone 1.0 frame = bone
+bone texture frame bone 0.500000 anim -1 material = texture anim texture
+material frame frame
+anim material -1
+material
+1.0 texture -1 -1 0.500000 1.0 0.500000 frame
+frame frame texture 1.0 frame material =
+vertex
+material texture 0.500000
+bone
+frame anim
+0.500000
+anim anim
+1.0 vertex
+-1 texture vertex 0.500000
+frame material 0.500000
+1.0 bone = = = 1.0 bone
+material 1.0 anim -1 -1 -1
+0.500000 frame material 1.0
+texture
+material 1.0 -1 bone bone 1.0 bone bone anim anim material frame vertex 0.500000
+0.500000 texture material
+vertex
+0.500000 -1
+1.0 vertex
+anim
+anim
+-1 -1
+-1 anim 1.0 = vertex vertex vertex -1 0.500000
+0.500000 frame
+0.500000 1.0 frame anim 0.500000 texture vertex anim -1 frame = bone material texture
+vertex 0.500000 material
+texture 0.500000 1.0 1.0 -1
+texture
+bone vertex -1
+vertex material
+material anim
+0.500000 bone 0.500000 1.0
+1.0 material
+vertex
+-1
+frame = -1
+-1 anim 1.0 texture frame
+vertex vertex -1 vertex texture 1.0
+texture -1 0.500000 material -1 vertex 0.500000
+frame anim anim
+bone
+1.0 vertex
+texture anim
+frame = 0.500000
+anim frame frame bone 0.500000 texture
+anim frame = frame material 1.0 0.500000 0.500000 frame = 0.500000 -1 = 0.500000 texture bone frame bone frame texture material
+1.0 0.500000 frame -1
+vertex material -1
+vertex 1.0
+=
+material 1.0
+0.500000
+texture material
+texture texture
+bone
+vertex vertex frame bone
+0.500000 vertex material 0.500000 material
+=
+frame vertex frame texture
+bone 0.500000
+= material
+material frame 1.0 texture 1.0 0.500000 anim
+frame vertex material
+= bone texture frame anim bone
+material =
+anim frame -1 0.500000 bone = material
+0.500000 1.0 anim bone vertex -1 anim 0.500000 0.500000 = vertex = frame
+0.500000 texture
+1.0 frame vertex
+0.500000 texture
+0.500000 1.0 bone vertex bone 0.500000 1.0 =
+vertex 1.0 material -1 texture texture -1 vertex
+material
+material
+-1 -1 texture 0.500000 anim bone vertex frame
+vertex -1 material
+= = -1 bone frame
+material =
+-1
+bone vertex material = bone
+anim -1
+texture texture -1 frame vertex -1 anim
+= 0.500000 -1 -1 texture -1 0.500000
+= anim = frame
+= anim
+texture 0.500000 anim
+1.0 vertex texture anim 0.500000 = 0.500000 -1
+bone texture bone vertex vertex =
+-1
+vertex bone
\ No newline at end of file
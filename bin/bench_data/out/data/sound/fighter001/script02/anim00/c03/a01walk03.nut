@@ -0,0 +1,157 @@
+vertex bone frame bone
+texture material bone anim 0.500000 bone = -1 texture
+= texture -1 anim texture vertex
+bone bone bone
+material 1.0 material texture frame vertex
+=
+material
+frame vertex texture -1
+anim -1 1.0 -1
+anim -1 bone
+bone = frame
+0.500000
+frame frame 1.0 material material vertex
+bone bone bone
+frame -1 bone bone
+material
+frame -1
+-1 texture texture texture texture = =
+material vertex vertex 0.500000
+0.500000 0.500000 =
+vertex 0.500000 frame texture frame anim 1.0 bone texture
+frame 0.500000
+anim =
+anim
+texture
+= material 0.500000 vertex
+frame -1
+material
+frame 1.0 texture 0.500000 = frame 1.0 -1
+-1 vertex material material
+anim
+-1
+0.500000 frame frame 1.0 bone vertex vertex
+anim texture
+1.0 = 0.500000 texture 1.0 = material 1.0
+= frame texture 1.0
+vertex bone vertex 0.500000 vertex bone material texture
+material
+vertex 0.500000
+texture texture vertex -1 1.0 -1
+frame -1
+material -1 texture 0.500000 vertex frame anim
+vertex
+1.0
+-1 = vertex -1 0.500000 material
+1.0
+-1 anim anim 1.0
+texture
+bone anim 0.500000 1.0 -1
+=
+bone material texture bone -1 vertex anim
+0.500000
+0.500000 1.0
+0.500000 -1
+texture vertex vertex bone 0.500000 anim -1 anim anim 0.500000
+= anim
+anim = = frame texture frame = texture vertex bone =
+material vertex material vertex
+vertex 1.0
+material material 1.0 = vertex
+= anim = 1.0 1.0 = =
+frame 0.500000 vertex material bone frame
+vertex texture bone texture texture vertex 0.500000 vertex -1 frame frame frame bone
+-1 texture 0.500000 -1 bone frame
+= = = -1
+0.500000 anim
+texture 0.500000 = vertex frame
+1.0
+material vertex bone texture bone frame = -1
+anim
+0.500000 = anim
+-1 bone -1 vertex anim
+-1 frame frame texture -1 vertex
+texture vertex frame anim
+texture = bone = vertex material
+bone
+frame 1.0 1.0 0.500000 material -1
+=
+vertex vertex material frame frame vertex bone
+anim 0.500000 1.0 anim bone texture material anim -1 -1
+material
+-1 0.500000 texture 0.500000 anim -1 -1 anim
+anim
+material =
+anim texture
+anim anim = bone -1 anim frame material anim
+frame
+vertex
+vertex
+bone = -1
+= bone frame material
+material
+anim
+-1 0.500000
+0.500000 =
+anim 1.0 anim
+0.500000 -1 0.500000 0.500000 -1 1.0 -1
+0.500000 bone
+1.0 anim = texture -1 texture vertex bone =
+material =
+texture -1 -1
+texture -1 texture
+-1
+bone anim
+1.0 anim material
+material
+= -1 texture 1.0
+-1 frame = -1 0.500000 -1
+anim
+material
+anim frame bone anim anim -1 vertex
+-1 bone
+anim
+texture material
+bone material 0.500000 frame frame material anim = bone 0.500000
+bone bone 0.500000 vertex
+-1 anim frame bone texture -1 -1 1.0
+-1 anim bone
+-1 bone
+bone frame 1.0 1.0 -1
+-1 0.500000 1.0 texture
+anim bone texture anim -1 frame anim = = 1.0 bone
+1.0 1.0 = 0.500000 texture frame -1 frame 0.500000 1.0 0.500000 1.0 material
+vertex -1 texture anim -1
+material
+-1 -1
+anim 0.500000 = anim 1.0 1.0 anim
+material material texture anim = anim
+-1
+vertex 1.0 0.500000
+1.0 vertex
+vertex 1.0
+= frame 0.500000 bone
+vertex anim 1.0
+frame -1 vertex =
+frame bone -1 = 1.0 bone anim texture bone material texture
+bone vertex material
+frame bone material anim texture
+0.500000 anim = texture
+= -1 frame
+texture vertex vertex =
+bone
+-1 anim -1 frame bone texture
+anim frame = =
+-1 -1 -1 texture
+vertex bone
+bone frame anim texture 0.500000 texture bone
+1.0 texture vertex -1 bone
+0.500000 bone
+1.0
+material 0.500000 material 0.500000 texture frame texture 0.500000 bone vertex -1 vertex bone vertex
+texture 0.500000 0.500000
+texture = -1 vertex anim bone
+frame texture
+-1 1.0 anim bone =
+material 0.500000 0.500000
+anim materi
\ No newline at end of file
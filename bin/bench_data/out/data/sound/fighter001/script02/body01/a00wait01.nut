@@ -0,0 +1,29 @@
+frame texture
+frame material frame 1.0 -1 bone 1.0 -1 = frame material -1 vertex bone frame =
+-1 bone 0.500000 texture texture
+1.0 texture
+-1 vertex frame
+vertex -1 vertex -1
+= 0.500000 bone anim 0.500000 -1 vertex frame material frame texture = frame
+1.0 0.500000
+vertex
+= 1.0 1.0 0.500000 -1 0.500000
+anim 0.500000 = 1.0 0.500000 bone
+-1
+frame
+vertex
+1.0
+-1 anim
+vertex -1 bone anim frame -1
+1.0 1.0 anim material 0.500000 material material bone anim
+material vertex
+0.500000 anim 1.0 material frame 1.0
+-1
+material frame
+texture
+frame 0.500000 vertex -1 frame anim
+vertex
+bone vertex frame material vertex -1 bone texture frame
+vertex texture texture anim
+= texture
+an
\ No newline at end of file
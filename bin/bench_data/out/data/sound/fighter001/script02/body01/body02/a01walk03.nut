@@ -0,0 +1,5 @@
+= anim vertex
+frame
+1.0
+= anim vertex -1 -1 -1 =
+1
\ No newline at end of file
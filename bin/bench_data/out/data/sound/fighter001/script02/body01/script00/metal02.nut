@@ -0,0 +1,8 @@
+= texture texture
+= material =
+1.0 vertex
+bone
+= texture 0.500000 0.500000 anim material = 0.500000 1.0 0.500000 -1 = vertex vertex texture 1.0 material
+vertex =
+frame 0.500000 frame texture
+ver
\ No newline at end of file
@@ -0,0 +1,14 @@
+material 1.0 -1 texture 1.0 bone anim bone anim
+vertex -1 bone
+anim
+0.500000
+frame = -1 frame
+vertex = frame frame material
+1.0 =
+bone bone anim 0.500000 anim -1 vertex bone frame -1 vertex bone frame 1.0 0.500000 =
+-1 frame = vertex
+vertex anim
+material texture anim vertex frame
+bone bone
+-1 texture 0.500000 frame -1 -1 0.500000 -1 bone
+ve
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 =
+material 0.500000 -1 anim 1.0 1.0 vertex
+bone
+vertex anim frame 0.500000
+frame
+anim -1 bone 1.0 bone -1 frame
@@ -0,0 +1,18 @@
+bone
+frame -1 material bone material vertex anim -1
+material vertex = 1.0
+texture texture = = 0.500000 anim
+-1 material frame texture bone material vertex anim =
+bone = 0.500000 = 1.0
+0.500000
+bone -1 -1 texture vertex
+anim material anim = 0.500000 = frame
+1.0 bone -1 vertex
+texture 1.0 1.0 1.0 0.500000 -1 material
+material material
+vertex 0.500000 vertex -1
+material texture frame
+frame vertex bone texture frame = -1 material 1.0 0.500000 = = 1.0 anim material bone frame 0.500000 frame =
+frame frame =
+texture -1 bone material material anim = 0.500000
+-1 texture anim 
\ No newline at end of file
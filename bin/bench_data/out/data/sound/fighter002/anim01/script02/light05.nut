@@ -0,0 +1 @@
+P741jrn$-Ptx,eҩ1~V!bH
\ No newline at end of file
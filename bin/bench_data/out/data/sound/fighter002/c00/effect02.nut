@@ -0,0 +1,82 @@
+bone
+bone anim
+-1 0.500000 1.0 1.0 frame 1.0
+bone texture
+anim anim
+anim
+frame bone bone -1 bone material = anim vertex
+frame = = 1.0
+0.500000 0.500000
+frame anim
+anim 1.0 bone
+bone vertex bone texture -1 0.500000 1.0 bone texture texture 1.0
+-1 frame
+-1 -1 -1
+bone -1 texture frame -1 = bone material
+1.0
+0.500000 =
+1.0 1.0
+1.0
+material = anim bone frame
+bone bone 1.0 material material
+anim
+material 1.0 0.500000 bone frame -1 frame bone
+-1
+bone material =
+material = 0.500000 1.0 0.500000 vertex vertex 1.0
+1.0 frame frame vertex -1 texture bone 1.0
+1.0 texture
+-1 0.500000
+bone = anim vertex vertex bone frame anim bone bone
+0.500000 material -1 0.500000 anim
+= anim frame bone = 1.0
+vertex anim
+1.0 material 1.0 vertex -1 frame = -1 frame
+material bone
+frame = vertex -1 0.500000 1.0 anim
+texture =
+texture material vertex = material vertex 0.500000
+frame texture vertex texture bone material frame frame 0.500000 anim vertex
+vertex = 0.500000 vertex bone
+-1 =
+texture bone bone frame
+frame vertex -1
+material
+vertex frame = 1.0 frame
+bone anim material
+anim 1.0 = 0.500000 anim 0.500000 vertex 1.0 texture
+vertex
+= -1 frame
+=
+texture 1.0
+-1 -1 material vertex texture frame
+vertex
+texture frame texture
+frame
+texture = 0.500000 1.0 -1 0.500000 1.0 vertex 0.500000 texture
+1.0 material
+0.500000
+material 0.500000 bone 0.500000 frame -1 -1
+= 0.500000 frame 1.0 -1 texture = anim texture = bone frame
+material anim frame = anim 0.500000 =
+bone
+anim texture material frame -1 vertex bone vertex frame bone -1 -1 =
+material 0.500000
+= anim
+material
+material anim material vertex frame
+texture 0.500000 = vertex = 0.500000 -1 0.500000 bone anim
+vertex 1.0 vertex
+=
+-1 texture
+vertex frame material
+anim 0.500000 frame
+0.500000
+material material
+0.500000
+frame = 1.0 -1 anim = bone 0.500000
+material 0.500000
+texture 0.500000 anim
+= material = = anim vertex material
+texture vertex
+texture anim material = frame anim vertex fram
\ No newline at end of file
@@ -0,0 +1,65 @@
+texture vertex
+bone
+= bone 0.500000 0.500000 vertex bone material bone 0.500000 frame -1 frame 0.500000 anim anim 1.0 vertex -1 frame
+1.0 -1
+frame
+0.500000
+texture bone texture frame -1 frame vertex 0.500000 material
+1.0
+frame frame material
+1.0 frame texture 1.0
+anim
+vertex frame anim 0.500000 material 1.0
+0.500000 vertex
+anim 0.500000 vertex 0.500000 = 0.500000 1.0
+frame
+material frame bone anim 0.500000 anim vertex 1.0 = material
+anim = 0.500000 texture bone
+texture
+texture material 0.500000 bone texture texture 0.500000 anim 1.0 vertex
+material 1.0 texture texture 0.500000
+bone
+-1 frame 1.0 -1 anim bone bone = bone
+frame = 1.0 0.500000 -1 texture material anim vertex
+texture bone anim bone bone -1
+0.500000
+material = anim
+1.0
+-1 texture frame = vertex = anim
+= texture 0.500000 material material
+vertex vertex -1
+bone = 0.500000 -1
+= anim texture
+vertex
+texture -1 -1 = bone 0.500000 frame anim vertex vertex
+texture vertex frame
+texture -1 anim material texture =
+material 1.0 material
+1.0 bone 1.0 material
+texture 0.500000
+frame frame frame texture material
+bone =
+frame = vertex =
+texture
+vertex material
+vertex =
+-1
+-1 1.0 material anim = texture vertex texture bone frame
+-1 bone 0.500000 = anim anim
+-1
+bone vertex bone anim
+= = bone anim 1.0 vertex 0.500000 0.500000 = bone
+vertex 1.0 frame vertex
+= 1.0
+frame
+= anim bone
+-1 0.500000 anim -1 bone
+=
+0.500000
+material frame texture = = vertex anim frame vertex material anim vertex 1.0
+-1
+1.0 0.500000 vertex anim
+vertex material material material texture
+1.0 material bone frame vertex bone bone vertex -1 vertex
+material material frame texture material texture vertex texture anim = -1 texture
+= bone bone material -1 material 1.0 -1 bone materia
\ No newline at end of file
@@ -0,0 +1,13 @@
+= 1.0
+frame 0.500000
+vertex
+bone = bone bone texture
+1.0 1.0 vertex 0.500000 texture -1 frame anim = bone
+frame vertex
+0.500000
+bone =
+=
+frame
+= frame 0.500000 material 1.0 bone material 0.500000
+material
+frame vertex
\ No newline at end of file
@@ -0,0 +1,9 @@
+0.500000
+texture texture anim
+anim
+1.0 =
+= 1.0 bone
+bone
+material vertex
+0.500000 -1 texture = vertex
+0.
\ No newline at end of file
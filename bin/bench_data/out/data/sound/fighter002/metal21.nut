@@ -0,0 +1,78 @@
+vertex texture
+texture = vertex vertex =
+material anim 0.500000 -1 frame anim 0.500000 anim material = frame -1 1.0 material
+texture 1.0
+anim vertex 0.500000 frame
+texture frame anim material material -1 frame = frame
+vertex
+anim
+bone -1 anim bone bone
+anim anim anim anim texture
+vertex texture
+material vertex 0.500000 -1 0.500000 0.500000 texture bone texture 0.500000 0.500000 -1 vertex vertex 1.0 frame 0.500000
+texture anim
+frame
+1.0 frame
+0.500000 = = frame -1 bone 1.0 texture 0.500000 texture vertex anim = -1 = 0.500000
+vertex bone 1.0 anim
+0.500000
+0.500000
+-1
+1.0 -1 texture 1.0 = 1.0
+-1 material anim
+= 0.500000 0.500000 -1 -1 = -1
+= bone 1.0 anim texture
+-1 anim bone
+= bone texture
+-1 1.0 =
+bone anim
+1.0 = frame anim 0.500000 1.0 -1 vertex
+frame 0.500000 0.500000 =
+vertex
+frame -1
+texture texture texture = vertex anim = bone anim bone vertex 0.500000 0.500000 0.500000
+= 0.500000 texture 0.500000
+texture vertex 1.0
+vertex frame = 0.500000 texture anim 0.500000 0.500000 bone -1 texture vertex frame
+texture 0.500000 anim = = 1.0 = bone -1 anim 0.500000
+anim material texture material 1.0
+0.500000 -1 frame material
+vertex 0.500000
+texture
+anim bone bone frame vertex 1.0
+texture vertex anim 0.500000
+texture 1.0 0.500000
+frame vertex texture vertex material
+texture texture vertex vertex texture bone material 0.500000 bone anim texture texture frame bone
+1.0 texture frame vertex vertex texture 1.0
+texture 0.500000
+bone material 0.500000 1.0
+anim
+vertex
+1.0
+texture
+bone
+=
+vertex
+= -1 bone 1.0 -1 0.500000
+vertex
+bone
+bone 1.0 material material frame
+bone 1.0 1.0
+frame =
+texture 0.500000 0.500000 vertex -1 bone
+1.0 material vertex anim anim -1 texture -1 frame
+1.0 frame anim
+material vertex -1 anim 1.0
+frame = =
+0.500000 frame anim
+anim material
+1.0 -1 frame
+anim bone = frame vertex material
+anim anim texture material
+-1 material material frame
+-1 -1 -1 material frame
+vertex
+= material
+anim = 1.0
+0.500000 -1 0.500000 1.0 0.500000 anim texture material
\ No newline at end of file
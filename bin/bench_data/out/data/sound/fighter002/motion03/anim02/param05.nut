@@ -0,0 +1,7 @@
+1.0
+1.0 vertex anim anim vertex texture vertex
+texture = texture -1 texture 1.0 vertex
+anim
+frame 0.500000 bone
+material 0.500000 anim
+= frame frame 
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone
+bone anim texture
+-1 texture frame 0.500000 frame fra
\ No newline at end of file
@@ -0,0 +1,286 @@
+anim material anim vertex
+anim anim
+bone -1 bone 0.500000
+material
+1.0
+material
+0.500000 anim bone
+anim bone 0.500000 anim
+0.500000 frame = bone anim texture vertex
+texture
+= bone
+bone bone anim material
+bone material material material frame material bone
+vertex
+vertex anim
+=
+= anim
+1.0
+frame -1
+vertex vertex = vertex frame -1 texture material texture vertex frame 0.500000 material 0.500000 anim vertex texture frame material texture bone
+frame -1 material anim vertex
+vertex 1.0 frame material
+0.500000
+=
+0.500000 -1 texture
+texture
+anim
+0.500000 = -1 -1
+texture = =
+0.500000 0.500000 bone material vertex bone texture texture
+bone = 0.500000 material = bone
+bone bone 1.0 texture texture -1 =
+material vertex
+0.500000 0.500000 texture
+material material
+bone vertex anim anim texture
+bone vertex material
+material
+vertex 0.500000 frame
+vertex
+anim 0.500000 texture vertex
+1.0
+0.500000
+bone
+material -1 = bone
+vertex = = 1.0 0.500000 frame material 1.0 1.0 -1 material
+-1 material 1.0
+bone bone frame
+bone texture
+vertex
+bone 0.500000 texture
+1.0 vertex =
+anim -1 vertex texture -1
+-1 anim -1
+-1 -1
+vertex
+0.500000 frame = anim
+material
+0.500000 material = -1 -1 anim = texture vertex 0.500000 texture
+material 1.0 frame frame 1.0 texture bone frame -1 texture = -1 = frame bone
+vertex texture 0.500000 0.500000 1.0
+material -1 = frame -1 0.500000 1.0 1.0 anim
+-1 bone 0.500000
+0.500000 bone vertex
+0.500000 0.500000 vertex anim
+material material 0.500000 material -1 = vertex anim -1
+=
+0.500000 material 1.0 frame frame frame 0.500000
+0.500000 vertex
+texture = anim
+= frame
+0.500000
+anim bone texture material -1
+0.500000 frame
+0.500000 1.0 -1 texture material texture anim 0.500000
+-1
+-1 =
+vertex
+material
+bone
+anim material frame -1 material -1 1.0
+bone bone material texture frame vertex 0.500000 material 1.0 vertex
+bone 0.500000 anim
+frame anim 0.500000 -1 frame 1.0 frame
+-1
+1.0 1.0 anim 0.500000 = -1
+1.0 = vertex 1.0
+bone vertex 0.500000 vertex
+frame =
+frame texture -1
+anim 1.0 bone vertex -1 1.0 -1
+= = vertex
+-1
+-1
+vertex
+anim
+frame frame -1 1.0
+material 1.0 -1 -1
+0.500000 bone 0.500000
+anim anim -1
+1.0
+material -1 texture vertex = = anim 1.0
+vertex texture frame =
+anim
+material vertex texture
+bone material bone material material bone
+anim frame material
+0.500000 =
+bone texture texture 1.0 material
+0.500000 0.500000 -1 0.500000 texture 0.500000 texture anim
+bone
+1.0
+0.500000
+texture = =
+0.500000 0.500000
+1.0 vertex -1
+anim texture bone anim vertex 0.500000 0.500000
+1.0 anim texture material vertex bone vertex material vertex
+-1 texture anim
+vertex anim frame 1.0
+1.0 -1 -1 vertex anim = material
+-1 1.0 vertex -1
+=
+= bone frame material bone
+vertex vertex material
+= frame
+-1
+material frame frame -1 material = = -1
+anim bone material vertex
+anim frame
+-1 bone bone material
+-1
+material 0.500000
+1.0
+frame
+1.0 1.0 texture 0.500000 = 0.500000 bone vertex bone =
+0.500000 material
+-1 frame frame
+0.500000 texture anim frame 0.500000 vertex bone
+material -1
+bone
+frame
+-1 0.500000 material
+0.500000 texture
+-1 bone
+=
+anim -1 -1 0.500000 = 0.500000 material vertex
+0.500000 material frame anim frame
+texture
+0.500000 frame 0.500000
+1.0 bone frame bone bone
+0.500000 bone 1.0
+frame 0.500000 anim frame anim 0.500000 frame vertex
+0.500000 texture 0.500000 bone frame anim
+material anim texture = bone
+material
+bone
+bone material
+anim
+bone =
+vertex material frame
+anim bone texture
+texture anim 1.0
+anim texture
+0.500000 material
+anim
+material frame texture vertex vertex anim vertex vertex vertex
+texture frame anim = -1 vertex
+material bone frame
+frame bone frame bone 1.0
+material = bone texture 0.500000 vertex = bone frame
+vertex 0.500000 frame frame material bone vertex material texture anim texture anim material
+-1
+bone -1 1.0 -1
+material anim vertex 0.500000 0.500000 anim
+1.0 = anim
+1.0 = =
+texture
+frame 1.0 vertex
+0.500000 frame 1.0 vertex
+= -1 = bone -1 -1 = 0.500000 -1
+bone bone material -1
+bone anim texture
+0.500000
+1.0
+texture = frame -1 = anim
+texture
+= material vertex = vertex texture
+material
+bone 0.500000
+-1 frame vertex -1 0.500000
+bone vertex bone vertex texture vertex anim bone frame
+texture vertex
+bone
+material 1.0
+0.500000
+texture texture vertex = 1.0 vertex 0.500000 material -1 texture anim
+-1
+material 1.0 anim
+0.500000
+frame 0.500000 0.500000
+1.0 vertex 1.0
+= material frame 0.500000 = 0.500000 bone
+bone vertex material = =
+-1 1.0
+-1 bone
+-1
+-1 bone anim vertex 1.0
+vertex anim
+1.0 anim 1.0 material
+= bone material 0.500000 bone texture frame 0.500000 vertex anim anim =
+1.0 anim frame = anim vertex 0.500000 material
+texture bone
+-1
+material frame frame
+anim bone vertex
+-1 0.500000
+anim
+=
+1.0 anim -1 1.0 vertex
+material anim
+-1 bone = bone anim 0.500000
+=
+frame
+= -1 -1 frame 0.500000 frame
+-1 texture
+= 0.500000
+texture
+0.500000 0.500000 vertex
+= vertex frame
+bone -1 material 1.0 material = vertex 1.0 =
+1.0 frame bone
+texture texture anim =
+-1
+anim
+material texture = = anim
+texture vertex 1.0 frame texture vertex
+bone anim bone
+1.0 texture -1 -1 anim
+texture material 0.500000
+frame bone frame = anim 0.500000 texture
+1.0
+0.500000 vertex bone bone texture
+0.500000 vertex = 1.0
+frame vertex frame -1 bone anim bone anim frame bone = texture
+frame vertex 1.0 1.0
+anim frame anim material
+-1 material 1.0 vertex vertex
+material -1 texture
+texture 0.500000
+anim 0.500000 =
+texture
+vertex anim vertex
+frame
+material material -1
+= material frame -1
+1.0 material bone
+frame -1 = frame texture
+1.0 vertex texture frame texture vertex frame
+material anim 1.0 vertex
+-1 material 0.500000
+vertex material anim
+=
+=
+anim bone
+anim texture material
+anim 0.500000 = anim = anim texture
+0.500000
+material
+bone 0.500000
+anim bone 1.0
+-1 bone vertex frame vertex material anim 1.0 anim -1
+=
+-1 frame 1.0 vertex
+anim bone
+1.0 -1 bone
+texture 1.0 0.500000 anim frame material material
+0.500000 frame
+vertex material
+0.500000 1.0 1.0 -1
+1.0 frame texture frame 1.0 frame
+-1 -1
+frame anim 0.500000
+bone
+= anim 0.500000 =
+vertex
\ No newline at end of file
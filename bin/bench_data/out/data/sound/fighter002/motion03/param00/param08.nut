@@ -0,0 +1,116 @@
+0.500000
+texture -1
+1.0
+anim
+-1
+anim 0.500000 anim
+anim
+-1 vertex
+= frame =
+vertex
+1.0 anim
+bone -1
+frame
+= 0.500000
+anim
+bone material 1.0 bone
+0.500000 bone anim -1 material
+texture vertex vertex texture
+texture 0.500000 = = = vertex 0.500000 1.0 0.500000
+1.0 texture frame
+1.0 = texture
+bone 1.0
+frame
+= frame 1.0 bone vertex 0.500000
+0.500000 material 1.0 0.500000
+anim vertex
+1.0 1.0 vertex
+1.0 texture -1 0.500000 vertex
+-1 1.0 -1 frame frame anim = vertex = = anim 1.0 = vertex anim
+0.500000 bone 0.500000
+frame
+material
+-1 frame
+-1 frame frame
+=
+frame 1.0 bone -1 -1 bone -1
+texture material 0.500000
+texture 1.0
+anim frame anim -1 vertex -1 anim
+vertex 1.0
+material frame bone
+0.500000 vertex material material -1 texture -1 texture = material -1 texture 0.500000 -1 anim -1
+0.500000 frame -1
+0.500000 vertex anim anim anim frame texture material = vertex 1.0 texture
+texture vertex
+-1
+= 0.500000 frame vertex
+= material
+= -1
+texture frame
+bone -1
+bone frame frame 0.500000
+vertex
+vertex
+texture -1 1.0 material frame
+1.0
+-1
+vertex frame bone frame = anim -1 material frame frame bone frame vertex
+1.0
+bone = 0.500000 =
+anim material
+bone
+= vertex vertex material 1.0 vertex
+-1 0.500000 -1 -1 material 1.0
+frame frame vertex
+material
+bone anim
+frame = 1.0 bone
+anim = anim
+material 0.500000
+0.500000
+material material material anim
+0.500000 1.0
+-1
+-1 0.500000 anim 1.0 1.0 -1 vertex -1 bone = anim
+vertex vertex -1 texture
+texture
+material anim 1.0 bone vertex vertex
+material anim
+vertex = anim 1.0 anim
+frame 1.0 texture frame -1 = -1 frame
+bone 0.500000 texture frame
+material 1.0 anim -1 anim =
+frame
+frame frame
+vertex bone
+= material anim anim texture frame
+0.500000 -1 bone anim
+vertex material texture anim
+bone anim = = vertex
+frame
+1.0 = -1 1.0 material bone vertex vertex vertex 0.500000
+material frame
+-1 material material frame 1.0
+0.500000 bone material -1 bone -1
+anim
+0.500000
+vertex 0.500000 = frame vertex anim frame 1.0 texture material
+material -1 vertex
+vertex
+frame material anim anim frame anim 0.500000 anim vertex bone
+vertex
+anim anim
+texture = vertex frame frame bone = anim = -1 bone =
+anim
+vertex -1 texture
+vertex
+= bone texture texture material
+1.0 material =
+bone
+-1 vertex
+anim = material anim anim 1.0
+anim frame
+0.500000 material bone
+material vertex -1 anim 0.500000 vertex 1.0 1.0
+bone texture 0
\ No newline at end of file
@@ -0,0 +1,23 @@
+1.0 frame
+1.0 0.500000
+texture 1.0 = = 0.500000 material frame vertex bone bone frame
+vertex anim 1.0 1.0 frame 1.0 material 0.500000 frame 1.0
+anim bone vertex texture vertex
+1.0 texture 1.0 anim anim material anim
+texture
+0.500000
+vertex
+material vertex = anim bone bone = -1 frame
+frame
+vertex vertex anim 1.0 vertex 1.0
+bone
+bone
+material vertex bone texture material frame anim
+frame frame 1.0
+0.500000
+frame
+-1 bone 0.500000
+-1
+frame texture vertex -1
+anim
+vertex anim 0.500000 -1 texture frame texture bone vertex 0.500000 material
\ No newline at end of file
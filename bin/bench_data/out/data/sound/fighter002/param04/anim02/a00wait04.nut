@@ -0,0 +1,92 @@
+0.500000
+anim bone bone anim bone
+anim -1 vertex 0.500000 1.0
+material bone frame
+= 1.0 anim material bone frame
+1.0 vertex =
+1.0 bone = -1 anim = = material vertex texture
+texture vertex = -1
+bone
+1.0
+material
+anim frame material anim = 0.500000 vertex 1.0 -1 1.0 bone bone anim material anim
+material frame material
+frame
+1.0
+texture anim = vertex vertex frame
+anim
+texture =
+texture
+1.0 anim
+anim texture vertex
+=
+= = -1
+0.500000
+1.0 frame 1.0 1.0 0.500000 bone material 0.500000 -1 frame
+0.500000 1.0
+= bone texture anim -1 bone
+texture bone
+texture
+texture 1.0
+vertex
+vertex 1.0 0.500000
+= 1.0 =
+frame = 0.500000
+= = vertex =
+texture = vertex = texture
+= vertex 1.0
+0.500000 0.500000 frame -1 material 0.500000 1.0 material 1.0
+-1 texture texture
+1.0 anim =
+texture
+-1
+bone
+=
+= 0.500000
+frame material material material texture 0.500000 texture
+-1 texture 1.0 bone
+bone frame material vertex bone
+material texture vertex 0.500000 anim vertex
+1.0 1.0
+anim
+anim anim -1 bone
+vertex anim 0.500000 = -1
+material material
+-1 0.500000
+anim
+-1
+vertex 0.500000 frame 1.0 =
+= 0.500000 1.0
+-1
+texture =
+material bone bone texture 1.0 anim
+vertex material frame bone
+1.0
+vertex material anim
+0.500000
+frame -1 1.0 material texture -1
+texture bone bone
+material 1.0 0.500000
+anim 0.500000 = material
+texture 1.0 vertex 1.0 texture 1.0 texture bone frame = anim
+vertex frame = anim 0.500000 vertex =
+anim -1 =
+anim frame -1 bone vertex material
+1.0 frame bone texture
+material = anim vertex 1.0 texture 1.0 -1 material -1 frame
+= = -1 material vertex vertex frame
+= texture 1.0
+0.500000 1.0
+material
+material
+bone texture
+anim 0.500000 -1 anim texture -1
+texture
+-1 0.500000 vertex
+-1 = = = frame anim texture material anim -1 1.0
+1.0 frame
+texture
+-1 material
+texture texture 1.0
+material
+0.500000 vertex 
\ No newline at end of file
@@ -0,0 +1,14 @@
+frame frame anim 1.0 texture
+1.0 anim anim
+frame vertex vertex -1 = vertex texture anim = bone material texture
+anim
+frame vertex
+texture
+vertex
+bone vertex frame frame
+= = 0.500000 bone
+0.500000 -1 material frame anim
+anim material anim -1
+= frame anim -1 0.500000
+vertex -1 frame
+frame material material ma
\ No newline at end of file
@@ -0,0 +1,188 @@
+vertex
+frame
+material
+frame frame = =
+bone
+-1
+vertex 0.500000
+1.0
+anim 1.0
+-1 material anim frame frame vertex anim -1 anim
+frame 1.0 frame
+frame anim
+material
+vertex bone vertex vertex
+anim frame anim = material
+frame -1 1.0 frame
+0.500000 texture material bone material material 0.500000
+bone 1.0 0.500000 -1
+= 0.500000 bone
+-1 material = vertex
+0.500000 texture material texture 1.0 anim anim vertex bone anim -1
+anim 1.0 anim vertex bone 0.500000 vertex frame anim
+anim -1 =
+1.0
+1.0 anim
+1.0 material = bone bone bone
+vertex 1.0 1.0 -1 texture 1.0
+vertex -1
+1.0 material vertex
+bone bone
+bone vertex vertex anim
+vertex material 0.500000 0.500000 anim 0.500000 material frame = material 1.0 texture frame
+-1 -1 bone 0.500000 0.500000 material = vertex anim -1 texture material texture
+material
+-1 = -1 frame texture
+frame frame -1 = -1 anim texture material
+bone vertex bone frame
+bone 0.500000 material 0.500000
+bone bone
+-1
+vertex 1.0 vertex texture 0.500000
+bone -1
+vertex frame = 1.0 anim 1.0 -1 bone 1.0 1.0
+texture anim bone
+bone = frame anim texture = -1 = material texture texture = anim 1.0
+frame vertex = = 0.500000 -1 frame
+texture anim 0.500000 anim
+-1 bone frame -1 bone frame 1.0 1.0 = frame material vertex 1.0 0.500000 vertex
+-1 -1
+anim 1.0 1.0 texture
+frame
+material bone
+texture texture anim = =
+bone bone
+texture 0.500000 anim vertex anim frame texture -1
+-1 = bone
+1.0 bone texture 1.0 material material
+vertex bone vertex vertex bone
+texture texture
+vertex anim vertex anim = frame -1 -1 0.500000 0.500000 -1 texture texture =
+1.0 =
+texture
+vertex 1.0
+anim
+vertex vertex material = = vertex texture
+bone material frame texture
+bone bone 0.500000 frame 1.0 vertex
+material
+material material texture bone anim
+1.0 0.500000 anim material anim -1 -1 0.500000 bone
+frame frame texture anim = = 1.0 -1
+material =
+frame 1.0 texture frame
+bone texture frame frame bone = 0.500000 vertex 1.0
+1.0 material texture anim
+vertex
+texture = texture
+1.0
+material 0.500000 material frame
+-1
+anim 1.0 0.500000
+-1 1.0 anim = -1
+-1 bone -1 material anim -1 texture 1.0 0.500000 texture
+texture vertex frame 0.500000 anim 1.0
+1.0
+1.0 1.0
+anim anim -1 anim 0.500000 -1 =
+frame anim
+material 0.500000 anim =
+0.500000
+bone 1.0
+frame = 0.500000 bone -1 texture texture frame
+1.0
+material anim
+0.500000 bone 1.0 material texture texture 1.0 frame 0.500000 texture
+anim vertex
+= =
+anim material 0.500000 1.0 anim vertex texture
+1.0 frame
+1.0 0.500000 0.500000
+anim
+0.500000 1.0 = =
+= material material material material anim -1 = material = anim material 1.0 1.0
+1.0 0.500000 frame bone material bone material anim
+material vertex anim -1
+vertex bone 1.0 0.500000 -1 = bone frame 0.500000 anim 1.0 texture anim texture -1 anim frame -1
+-1 anim 0.500000 = bone material 0.500000
+0.500000
+texture
+frame
+0.500000 bone bone frame frame -1
+vertex
+frame material
+= texture vertex
+bone
+1.0 -1 vertex vertex 0.500000 material
+texture bone
+1.0 frame vertex anim texture -1
+bone texture = anim 0.500000
+0.500000 material anim = frame frame vertex anim anim
+0.500000 -1 1.0 material material = =
+texture
+-1 = -1
+frame
+1.0
+texture = material
+bone texture texture anim vertex texture
+=
+anim
+0.500000 = anim = frame = -1 texture vertex material frame anim 1.0 0.500000
+bone bone
+0.500000 0.500000 1.0 material anim
+material 1.0 = texture 1.0 1.0 = vertex material frame
+1.0
+material vertex vertex vertex -1
+= vertex frame texture
+vertex
+0.500000 -1 1.0 = 1.0 1.0 texture texture = -1 material vertex 1.0 material 0.500000 0.500000 1.0 0.500000 = vertex
+0.500000 bone -1 0.500000 frame
+anim vertex anim anim 1.0
+material -1 texture material
+vertex
+-1 texture bone
+0.500000
+= 1.0
+anim 1.0 texture
+material 0.500000
+= texture texture 0.500000 texture bone -1 texture
+1.0 = = frame 0.500000
+bone
+= 1.0
+vertex texture =
+1.0 1.0 bone material 1.0 texture
+frame bone
+bone -1 anim texture bone = 0.500000 frame frame 0.500000 -1 frame
+anim anim
+frame vertex anim
+1.0
+anim texture = 1.0
+0.500000 bone anim
+-1 1.0 1.0 bone bone bone
+1.0 = 0.500000 = -1
+material vertex frame bone 0.500000
+anim
+1.0 -1 bone -1
+vertex texture frame frame 0.500000 texture vertex bone frame vertex
+anim vertex
+-1 = vertex = = texture
+material vertex
+vertex 1.0 -1
+anim texture 0.500000 material
+texture
+frame 1.0 -1 1.0 material
+frame
+0.500000
+frame 0.500000 -1
+-1 0.500000 -1 -1 frame bone frame -1
+1.0 frame frame
+material material
+bone
+-1 vertex material frame vertex
+-1 1.0 material
+0.500000 bone vertex
+= texture
+frame 1.0 vertex anim bone 1.0
+=
+vertex vertex frame anim texture =
+1.0 -1 bone
\ No newline at end of file
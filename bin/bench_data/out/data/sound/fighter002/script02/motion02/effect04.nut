@@ -0,0 +1,36 @@
+0.500000
+= 0.500000
+bone -1
+anim bone bone
+-1 bone
+material
+anim
+bone texture 1.0 = = material
+1.0 1.0 vertex anim
+0.500000 1.0 anim anim vertex
+-1 = anim 0.500000 = texture = material anim
+= -1
+texture frame texture anim
+= material -1 bone
+frame
+frame 0.500000 material texture 0.500000
+frame frame
+vertex
+1.0 texture
+vertex
+frame texture 1.0 1.0 bone vertex
+bone
+material 0.500000
+0.500000 anim frame
+1.0 texture 1.0 anim texture
+-1
+texture -1 -1 anim
+0.500000
+texture
+texture 0.500000 = frame anim vertex
+frame material -1
+= material
+1.0
+= anim material 1.0 material material 0.500000 -1 vertex texture bone anim
+material anim texture anim 1.0 texture vertex
+material 0.500000 vertex vertex 0.500000 bo
\ No newline at end of file
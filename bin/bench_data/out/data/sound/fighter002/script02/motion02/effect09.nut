@@ -0,0 +1,5 @@
+material frame anim 1.0
+vertex
+anim = vertex frame anim material bone bone
+anim frame bone texture texture frame bone texture
+0.500000 0.500000 ani
\ No newline at end of file
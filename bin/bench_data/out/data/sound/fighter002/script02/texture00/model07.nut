@@ -0,0 +1,88 @@
+= material
+frame
+material texture frame = 0.500000
+1.0 bone 0.500000
+-1 anim 1.0
+frame
+texture =
+bone
+vertex frame anim 0.500000 vertex vertex frame
+frame anim vertex
+-1 vertex
+1.0 0.500000 = texture frame 0.500000 -1 material bone 1.0 texture bone
+= material bone vertex bone frame = frame anim anim 1.0 -1
+frame -1 material
+material texture frame bone anim -1 -1
+material
+-1
+= bone material
+frame -1 vertex -1 bone texture 0.500000 bone material =
+-1 bone
+frame
+anim
+1.0
+-1 bone = vertex vertex material 0.500000 texture
+vertex -1 1.0 vertex -1 material
+material
+frame 0.500000 bone
+0.500000 texture texture -1 material texture
+anim frame material
+material = bone
+material anim
+1.0
+1.0 frame -1 = material
+0.500000 1.0 bone vertex =
+anim
+frame material -1 1.0
+-1 1.0 texture
+= -1 anim =
+material
+anim
+bone
+bone = vertex
+anim bone = frame 0.500000 texture
+vertex frame frame vertex -1
+material vertex -1
+vertex 1.0
+1.0 texture vertex
+= 0.500000
+=
+frame bone texture 0.500000 0.500000 vertex =
+vertex -1 anim texture 0.500000 texture -1 1.0 1.0 bone frame
+material
+texture frame
+bone -1 -1 frame anim texture
+-1 frame bone
+= material bone frame
+0.500000
+anim 1.0
+frame
+=
+frame
+bone material
+bone vertex 1.0 vertex 0.500000 -1 -1 texture
+material
+frame 1.0
+anim
+vertex 1.0 vertex
+=
+=
+frame material
+0.500000
+material anim 1.0 material frame
+frame anim vertex 1.0 vertex material 0.500000 texture
+vertex
+material =
+anim
+anim anim bone -1 -1 vertex bone bone -1
+bone
+anim vertex -1 material
+vertex
+texture
+frame bone 0.500000 bone = 0.500000 1.0 vertex anim 1.0 -1
+-1 = 0.500000 anim frame anim
+texture frame material vertex 1.0 frame
+frame frame
+frame frame
+0.500000 material 0.500000 0.500000 1.0
+anim 0.500000 -1 0.500000 materi
\ No newline at end of file
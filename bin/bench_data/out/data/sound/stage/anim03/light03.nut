@@ -0,0 +1,43 @@
+texture anim 0.500000 bone -1 texture bone
+bone texture
+= =
+0.500000 anim = 1.0 -1 = 0.500000 = texture texture 0.500000 0.500000 bone 0.500000 material anim 1.0 bone 1.0 0.500000 anim anim bone bone vertex -1
+anim = -1 0.500000 material material = vertex vertex
+-1 bone
+vertex -1 anim anim anim 0.500000
+0.500000
+= bone
+=
+texture = frame
+0.500000 0.500000
+material anim 0.500000 -1 material 1.0
+bone
+vertex texture -1
+= 0.500000 material material -1
+= vertex
+vertex -1
+bone
+bone anim
+anim bone -1 vertex bone
+= 1.0
+frame frame anim bone 0.500000 frame
+bone frame vertex =
+1.0 0.500000
+texture
+material = vertex
+1.0 vertex
+= -1 material = anim texture 0.500000 -1 1.0 vertex
+texture material -1 -1
+= texture 0.500000
+0.500000 anim material texture = material vertex material
+vertex frame
+0.500000 1.0 texture = frame =
+0.500000 material 0.500000
+frame 0.500000 anim texture texture 1.0 frame material vertex bone
+= -1 vertex =
+anim frame frame
+bone vertex vertex
+anim -1 -1 -1 texture bone vertex texture
+-1 anim
+texture texture
+frame material
\ No newline at end of file
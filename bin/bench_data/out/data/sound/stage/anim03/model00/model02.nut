@@ -0,0 +1,259 @@
+frame bone
+=
+-1 material = anim vertex texture 1.0 vertex anim
+1.0 0.500000
+0.500000
+0.500000
+texture -1 vertex -1 bone
+bone
+anim 0.500000 1.0 texture 0.500000 -1 -1 = 0.500000 frame 0.500000 1.0 -1 texture bone 0.500000 0.500000
+frame frame -1
+bone
+0.500000 frame frame anim texture vertex
+1.0 texture 1.0 = anim =
+0.500000 0.500000 0.500000 = texture vertex 0.500000
+texture 1.0 bone vertex = texture bone anim
+bone -1 texture =
+bone material vertex
+-1 anim anim vertex = = anim vertex
+bone frame anim texture material material
+-1 bone frame vertex
+texture bone anim -1 = bone texture
+texture material anim bone material bone 0.500000 anim
+material vertex anim
+vertex
+= texture
+material texture
+1.0 = material material
+bone
+vertex
+-1 frame vertex
+= texture bone 1.0 0.500000 texture material
+-1 bone vertex bone frame =
+texture vertex
+frame 1.0 bone bone texture anim texture bone bone
+-1
+=
+0.500000 bone frame
+vertex -1 -1
+material
+bone
+vertex anim -1 material 0.500000
+texture vertex
+vertex bone
+texture =
+=
+1.0 -1
+-1 = vertex frame -1
+0.500000 frame -1 =
+vertex frame anim
+= 0.500000 material bone
+anim 0.500000 vertex 1.0 texture texture
+vertex bone
+frame anim anim
+material = texture vertex
+vertex anim
+= 0.500000 = -1 1.0 1.0 frame 1.0
+1.0 texture 1.0 bone 1.0 frame vertex
+1.0 anim vertex 1.0
+anim 0.500000 1.0 material 0.500000
+0.500000 1.0 material
+bone = material 1.0 0.500000 material
+material
+= anim texture texture
+vertex -1
+texture
+1.0 0.500000 anim
+material -1 bone 0.500000 vertex frame vertex 1.0 vertex anim -1 1.0
+material
+anim 1.0
+= frame bone -1 frame texture -1 = bone 0.500000
+anim = frame material
+anim frame
+= texture
+bone
+vertex
+bone material = =
+-1
+-1 anim -1
+material 1.0 frame
+material 0.500000 = anim
+anim material frame bone material texture
+0.500000 frame texture
+0.500000 texture
+anim material
+texture
+anim = frame bone
+0.500000 = bone material vertex vertex material 1.0
+texture material
+bone 0.500000 frame 1.0
+anim
+frame frame = bone
+=
+1.0 = frame vertex anim = -1 texture vertex bone texture anim
+= vertex material 1.0 texture bone
+-1
+1.0 1.0 bone
+material vertex = 1.0
+-1 material
+anim
+-1 0.500000 anim 1.0 -1
+vertex = anim
+0.500000 texture = = texture
+-1
+0.500000 vertex material material
+vertex material
+anim
+frame texture
+0.500000 1.0 vertex
+0.500000
+anim 0.500000 vertex
+material -1 frame anim frame bone anim material
+vertex frame 1.0
+1.0 = = bone
+bone 0.500000 1.0 frame
+vertex
+0.500000 0.500000 = 1.0
+texture anim 1.0 anim 1.0 material material anim 0.500000
+1.0
+material texture frame vertex material
+anim
+-1
+frame bone 1.0 bone frame texture texture material = 1.0 0.500000 -1
+vertex 0.500000 -1 frame = texture bone frame -1 frame
+material material -1 =
+1.0 vertex -1 material
+bone vertex
+material =
+vertex
+anim -1 texture 0.500000 0.500000 texture anim -1 texture =
+-1
+1.0 vertex texture -1 1.0 -1 texture texture material -1 texture =
+bone 0.500000 bone
+anim texture 1.0 material bone frame = material
+= frame texture 0.500000
+1.0 vertex
+frame texture anim = 0.500000 0.500000 vertex -1
+bone
+frame 1.0 texture material texture bone
+anim frame 1.0 frame anim = = anim vertex anim -1 bone -1 texture 1.0
+anim anim material
+frame -1 frame bone
+texture texture material
+= 1.0
+anim frame texture 1.0
+frame material
+anim 0.500000
+-1 = anim 1.0 -1 anim material material -1
+frame 1.0 -1 =
+0.500000 frame frame bone
+anim
+material frame 1.0 = 1.0
+0.500000 -1 bone anim vertex = 0.500000 bone anim =
+frame
+bone
+-1
+-1
+0.500000 material vertex -1 material bone -1
+frame 1.0
+anim bone 1.0 material bone vertex
+0.500000 anim material anim
+1.0 1.0 texture
+anim
+material
+1.0 bone = frame
+texture vertex material 0.500000 anim -1 1.0
+texture -1 -1 -1 -1 frame frame
+frame vertex 1.0 -1 -1 1.0 -1 texture 0.500000 frame vertex
+0.500000
+material
+vertex = 0.500000 anim 0.500000 -1 frame
+1.0 vertex frame texture bone
+frame
+frame 1.0 material bone anim vertex = material anim = -1
+1.0 frame -1
+bone 1.0 texture anim 0.500000 material anim bone bone material bone bone 1.0 -1
+material
+-1 material -1 frame
+-1
+0.500000 bone material material -1 1.0 frame bone
+material frame
+vertex texture bone bone
+anim material 1.0 material 0.500000 1.0 anim bone vertex 1.0
+anim -1 0.500000
+1.0 bone texture 1.0 = 1.0
+1.0
+anim 1.0 vertex 0.500000 vertex anim
+= vertex vertex
+anim
+0.500000 =
+1.0 0.500000
+vertex
+0.500000 1.0 material frame material -1 anim
+material = vertex =
+material anim vertex
+bone 1.0
+1.0 bone 0.500000
+texture material bone
+1.0 = frame frame
+bone bone 1.0 -1 =
+-1
+= 1.0 0.500000 = anim frame
+texture material 1.0 texture anim
+=
+texture
+texture = bone texture anim 0.500000 -1 anim anim 1.0
+texture -1
+anim frame frame
+anim vertex = =
+bone texture texture
+-1
+material texture material
+-1
+=
+anim bone
+anim
+bone vertex vertex material
+-1
+material 1.0 1.0 vertex
+bone -1
+1.0 material frame = texture material
+anim -1 material
+material -1 bone vertex anim
+material -1 texture
+-1 0.500000 material 1.0 1.0 -1 = vertex vertex
+anim 0.500000
+1.0 0.500000 texture -1
+0.500000 1.0 vertex -1 = bone = -1 1.0 -1 frame material
+-1 vertex
+frame anim 1.0 frame
+= 0.500000
+frame texture anim material frame vertex
+bone
+material 1.0
+anim anim frame 1.0
+0.500000 frame =
+= material texture
+1.0 vertex vertex texture frame 1.0
+=
+material =
+frame vertex
+frame frame -1 -1
+material material frame
+-1
+= = =
+anim
+material = anim
+1.0 texture 1.0
+anim
+vertex 0.500000 = 1.0 anim vertex vertex texture vertex -1
+1.0 = 0.500000 texture
+bone anim frame texture vertex material vertex -1 -1 vertex texture texture
+anim material
+= 1.0
+-1 material
+-1
+texture
+-1 1.0 -1 =
+bone
+0.500000 bone -1 vertex vertex frame 0.500000 -1 0.500000
\ No newline at end of file
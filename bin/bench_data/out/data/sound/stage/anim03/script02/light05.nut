@@ -0,0 +1,252 @@
+-1 frame -1
+1.0 bone vertex vertex vertex vertex -1 = vertex anim 0.500000 0.500000
+anim vertex
+bone = 0.500000 bone material = material anim
+= material -1 bone
+anim frame
+vertex bone anim frame 0.500000 = frame 0.500000 frame frame
+anim
+material texture
+= frame vertex
+anim anim texture -1
+material
+vertex material 1.0
+anim
+-1 =
+texture
+1.0 frame -1 0.500000 0.500000
+-1
+bone 1.0 bone
+-1
+texture
+frame frame bone 0.500000 frame -1 1.0
+bone
+texture -1
+anim = bone frame 1.0 = frame 0.500000 vertex
+bone vertex frame
+frame = material material = 0.500000 texture
+-1 1.0
+-1 bone
+1.0 material material material = bone
+1.0 bone 1.0 frame =
+frame material frame anim 1.0
+material
+material
+material 1.0 frame -1 material anim anim bone 0.500000 vertex bone anim = -1 0.500000 texture 0.500000 1.0
+vertex 0.500000 texture anim = frame vertex 1.0 = 0.500000
+-1 =
+0.500000 -1
+anim
+bone texture material -1 material
+= 1.0 frame
+bone material = 0.500000 =
+0.500000 texture
+bone material
+material 1.0 1.0 0.500000
+anim 1.0 -1 texture
+1.0 1.0
+vertex
+frame frame bone material frame
+bone texture frame -1 bone
+frame = frame 1.0 0.500000 1.0
+texture
+anim
+anim -1 texture vertex -1 -1
+-1
+material frame material material 0.500000
+frame
+texture texture
+1.0
+1.0 bone material -1 anim -1
+texture -1 material bone -1 material 1.0 -1
+= texture -1
+texture frame -1
+anim anim
+anim = 0.500000 = vertex texture bone vertex
+material vertex bone frame
+-1 anim -1 frame 0.500000 1.0 anim
+bone bone
+vertex 1.0
+texture
+material anim 1.0
+1.0 -1
+texture vertex = anim 1.0 texture
+-1 vertex -1 vertex =
+material material texture texture 1.0 anim
+0.500000 -1
+-1
+-1 -1
+frame vertex -1 anim anim = bone
+= frame
+1.0 material bone
+= material
+1.0 anim anim 0.500000
+bone = 1.0 material 0.500000
+= 1.0 = = vertex
+0.500000
+vertex
+=
+= frame frame -1 anim
+anim anim bone =
+texture bone texture
+vertex
+material frame 0.500000
+vertex
+-1 anim
+anim material anim -1
+bone 0.500000 frame material bone
+=
+1.0 vertex =
+= material 1.0 anim = material 1.0 bone -1 -1 anim
+bone anim = frame texture -1
+texture -1 = 0.500000 = bone bone
+= 1.0 =
+frame
+-1 bone -1
+bone
+=
+material 1.0 bone 1.0 material
+0.500000 0.500000 anim
+0.500000 texture -1
+vertex material 1.0 =
+material
+material frame material
+material
+= texture =
+bone
+material material
+bone anim bone 1.0
+material
+1.0
+bone
+anim vertex =
+vertex = 0.500000 texture
+-1 = = texture -1 vertex bone
+= material 1.0 anim material material 1.0 vertex vertex
+texture bone -1 texture 1.0
+material
+anim material frame
+anim
+material anim 0.500000 texture 1.0 1.0 0.500000 vertex
+bone -1 material frame
+texture
+0.500000 0.500000 1.0
+texture material vertex
+anim texture frame 0.500000 0.500000 = bone vertex
+0.500000
+vertex frame bone
+frame texture bone texture material frame bone 0.500000 anim anim 1.0 frame -1
+0.500000 0.500000 0.500000 = anim material
+bone bone bone = = -1 anim =
+vertex = bone vertex
+0.500000 1.0
+0.500000 vertex
+bone anim frame texture 0.500000 vertex
+1.0
+texture vertex =
+= -1 material 1.0 bone = texture =
+-1 vertex 0.500000 -1 material 0.500000 material 0.500000 = -1 vertex
+anim material
+= material
+frame material anim
+material frame anim texture
+bone 1.0 frame 0.500000
+= material 0.500000 anim 0.500000 frame texture anim
+= -1 = material bone texture bone bone anim texture
+bone
+bone 1.0 texture -1 1.0 texture frame 0.500000 0.500000 material 1.0 texture bone anim bone frame material
+1.0 bone 1.0
+-1 anim 0.500000 anim vertex vertex texture vertex vertex frame 1.0 0.500000 anim bone
+material
+-1
+bone texture = frame
+anim
+frame anim 1.0 vertex anim
+anim frame material
+0.500000
+bone frame
+-1 material frame 1.0
+anim
+texture material texture
+1.0 -1 bone material vertex
+vertex bone 0.500000
+-1
+-1 frame
+texture
+bone 1.0
+bone vertex texture -1
+material frame
+bone vertex
+1.0 texture -1
+0.500000 anim texture -1 material anim -1
+0.500000 vertex material 1.0
+bone -1
+texture vertex material texture
+bone 1.0 0.500000 vertex vertex 1.0 anim
+0.500000 anim
+frame =
+frame material
+texture bone
+anim = material 1.0 bone material anim =
+texture -1
+frame texture 1.0 texture texture = bone
+frame material frame -1 frame vertex vertex -1
+vertex vertex material texture =
+material
+frame
+0.500000 bone
+anim material bone bone bone
+texture
+bone = texture vertex bone material = -1 0.500000 material
+= frame anim
+texture
+vertex anim frame texture bone bone
+vertex
+material
+anim 1.0 = material texture = texture vertex vertex frame
+texture 0.500000 frame frame
+0.500000
+material
+vertex material material material vertex vertex anim
+1.0 bone
+0.500000 frame
+frame 1.0 -1 bone
+anim = 0.500000 bone
+vertex = material bone
+= frame
+anim
+vertex anim
+0.500000 1.0 -1 material material bone -1 =
+1.0 1.0 vertex = vertex = material 0.500000 0.500000 1.0 frame = anim
+bone
+vertex
+texture material frame =
+texture anim 0.500000
+vertex
+bone 0.500000
+vertex material frame texture 1.0 vertex = bone
+-1
+0.500000
+frame
+1.0 -1 -1 1.0
+anim 0.500000 -1 material vertex vertex -1
+texture 1.0 -1 -1 bone frame
+0.500000
+= vertex =
+0.500000 material anim 0.500000 -1 0.500000 material 0.500000
+material texture -1 1.0 anim 1.0 anim 1.0 frame anim bone 0.500000
+material vertex 0.500000
+vertex bone frame vertex
+material bone material -1 bone = texture texture vertex bone
+-1 vertex anim =
+texture vertex -1
+vertex texture frame bone vertex bone = 1.0 1.0
+bone = =
+0.500000 anim 1.0 -1
+vertex vertex
+frame =
+0.500000
+anim -1 -1 =
+= material -1
+material frame
+vertex 
\ No newline at end of file
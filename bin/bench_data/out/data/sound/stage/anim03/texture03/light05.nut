@@ -0,0 +1,34 @@
+0.500000 0.500000
+anim material vertex 1.0 -1 material frame frame
+texture
+frame 0.500000 material
+frame vertex anim
+material
+0.500000
+vertex 1.0 texture vertex -1 anim 0.500000
+material =
+1.0
+-1 -1 =
+= material texture
+-1 -1 bone vertex 0.500000 -1 anim material frame
+bone texture
+-1 -1 anim
+vertex
+texture
+texture 1.0
+material bone = = 1.0 bone anim material frame material 1.0 bone vertex
+material texture
+bone anim
+material anim 0.500000 bone material vertex
+frame vertex
+anim 1.0
+vertex 0.500000 vertex
+bone -1 material vertex material texture
+material -1 vertex
+anim 0.500000
+1.0 1.0 material 0.500000
+-1 anim material bone
+vertex
+anim
+bone
+vertex 0.
\ No newline at end of file
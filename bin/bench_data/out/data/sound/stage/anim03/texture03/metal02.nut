@@ -0,0 +1,132 @@
+0.500000
+= frame = texture 1.0 material texture
+-1 1.0
+1.0 texture vertex -1
+texture texture vertex 1.0 frame
+vertex bone anim 1.0 -1
+vertex -1 anim
+vertex frame
+anim = anim 0.500000 1.0 = texture 1.0 -1 texture
+texture vertex frame 1.0 bone bone 1.0 material anim anim -1
+= 1.0 texture
+1.0 frame = vertex
+-1 bone frame texture -1 frame bone 0.500000
+anim -1 material = -1 texture -1 -1 bone anim anim bone texture texture
+= 0.500000 bone frame
+material anim
+anim
+texture anim bone
+0.500000
+anim 1.0 material
+=
+1.0 1.0 material
+vertex 1.0 -1 material bone -1 material texture texture material
+anim -1 -1 =
+texture anim
+1.0 vertex = texture vertex 1.0 material 0.500000
+anim material bone
+= anim 1.0
+frame bone vertex 0.500000
+0.500000 texture material = = vertex
+= texture vertex bone material 1.0
+texture
+0.500000 1.0
+1.0
+vertex
+vertex
+material
+texture 0.500000 texture frame
+anim = -1
+material vertex = 0.500000 anim
+-1 -1 frame
+1.0 material = 0.500000 0.500000
+= 0.500000 = vertex bone anim = -1 0.500000 = frame 0.500000 material anim -1 bone 0.500000 -1
+texture frame
+vertex bone anim 0.500000 vertex
+bone -1 1.0 -1 0.500000 material texture 1.0 0.500000 1.0 frame
+frame bone vertex
+0.500000 material
+frame bone anim 0.500000 = anim bone -1 texture texture 0.500000 frame = material
+bone -1
+1.0
+bone bone frame -1 texture
+= -1
+texture 0.500000 anim
+bone 1.0 vertex texture bone 0.500000
+frame anim bone frame = texture 1.0 bone material vertex 1.0 bone -1
+1.0
+1.0 1.0 material
+anim material
+bone texture -1 0.500000 1.0 frame material vertex
+anim bone 1.0 1.0 texture
+-1 = -1 texture
+0.500000 vertex
+bone 1.0
+texture
+1.0 material vertex bone frame
+anim frame -1
+anim material 0.500000 anim texture -1 1.0 anim
+0.500000 material -1 1.0 vertex
+0.500000 = 1.0 0.500000 1.0 = texture
+texture material bone 1.0 frame frame = anim frame
+=
+1.0 1.0
+texture 0.500000 material -1 frame
+material anim 0.500000 vertex texture anim
+-1 -1
+= frame -1 bone
+frame 1.0 material
+material anim material = = 0.500000 material bone 1.0 -1
+bone anim
+material =
+0.500000 anim = 0.500000
+-1 anim 0.500000 bone = -1 vertex frame frame
+0.500000
+-1 texture anim 1.0
+anim frame texture = 1.0
+1.0
+vertex
+=
+anim
+0.500000 = vertex
+material texture material bone bone
+frame bone
+-1 -1
+vertex 0.500000 material anim = frame -1 anim bone
+texture anim
+frame
+frame
+1.0 0.500000 bone anim
+texture material frame
+vertex vertex 0.500000 = material frame anim 1.0 texture anim
+texture anim
+frame frame texture bone frame 1.0
+1.0 -1 bone
+=
+0.500000
+1.0 vertex material 0.500000
+1.0 vertex
+vertex = 0.500000 0.500000
+vertex
+anim material material bone texture = 1.0 = =
+anim 1.0 material
+texture
+texture
+frame 1.0 0.500000
+0.500000 1.0 texture
+-1 vertex
+-1 1.0
+frame bone bone material frame bone
+0.500000
+-1 material texture material
+vertex bone bone bone
+bone 1.0 0.500000 0.500000 vertex
+material texture anim
+0.500000 material texture 1.0 material anim
+anim
+frame
+0.500000 1.0 bone anim = anim anim bone
+anim anim
+bone -1 1.0 -1 anim
+material -1 material = = texture = bone
+frame 0.500000 bone vertex texture texture = vertex 1.0 vertex = texture 0.500000 anim
\ No newline at end of file
@@ -0,0 +1,358 @@
+0.500000 = anim vertex anim texture anim
+bone -1 -1 bone
+= 1.0 texture vertex vertex 0.500000 -1
+= vertex frame
+material -1 -1 1.0
+0.500000
+vertex vertex
+-1 vertex anim material = 0.500000 -1
+-1 frame
+frame = 1.0 material bone 1.0 frame 1.0 texture 1.0
+frame bone
+anim anim 0.500000
+frame 1.0 bone 1.0 -1 =
+bone frame vertex material anim anim = -1 -1
+-1
+texture -1 0.500000 frame anim material anim
+vertex
+-1 bone
+0.500000 anim frame
+bone
+bone
+1.0
+frame vertex -1
+=
+= anim =
+0.500000 vertex
+texture -1
+-1 0.500000
+-1 texture =
+-1 = -1
+0.500000 anim vertex bone material frame
+-1 frame
+bone anim frame anim bone material
+bone
+-1
+texture
+vertex
+0.500000
+anim frame
+material
+-1 bone
+0.500000 bone vertex bone frame
+texture
+1.0
+= frame -1 material 1.0
+anim frame 1.0
+-1 material
+=
+0.500000
+-1 texture material
+= 0.500000 0.500000 = 0.500000 vertex anim = vertex
+bone
+vertex texture =
+texture material 1.0
+frame
+vertex
+vertex 0.500000
+frame anim = bone
+= texture frame
+0.500000 texture =
+= frame vertex 0.500000 frame vertex texture anim =
+material -1 anim
+texture
+vertex
+material anim
+frame
+bone anim texture
+frame -1 material 1.0 1.0 =
+anim vertex 0.500000 1.0 = 1.0 material texture
+vertex material
+bone -1
+texture -1
+texture 0.500000 bone texture texture -1 bone texture 0.500000 0.500000
+0.500000
+vertex texture anim frame 0.500000 1.0 0.500000 bone
+bone material
+-1 frame vertex
+= 1.0 0.500000 -1 anim anim 0.500000 frame texture texture
+frame 1.0
+1.0 frame
+= material vertex 1.0 = material
+= material 1.0 vertex 1.0
+texture vertex 1.0 1.0
+0.500000 0.500000 texture bone
+= texture material bone 1.0 = frame 1.0
+1.0
+frame anim bone vertex anim 0.500000
+bone material anim
+0.500000
+frame
+frame
+= = anim frame vertex material -1 material material = anim -1 frame frame anim
+anim 0.500000
+vertex vertex = vertex bone 1.0
+texture = frame 1.0
+frame
+-1 texture
+anim texture
+bone
+anim 1.0 0.500000 anim = material 1.0 texture 1.0 vertex -1
+0.500000
+-1 -1 vertex
+1.0
+-1
+= bone
+material 1.0 -1
+texture
+anim
+bone -1 anim 0.500000 bone
+-1 material bone
+1.0 material material anim frame
+material 0.500000 vertex vertex bone 1.0 bone = -1 -1 -1 texture bone material 0.500000 vertex 0.500000 frame -1 bone
+1.0 frame
+-1 vertex 0.500000 -1 vertex 0.500000 1.0 =
+1.0
+bone bone material
+0.500000 bone anim frame bone
+0.500000 texture
+vertex 0.500000 -1
+-1
+anim 1.0 = anim vertex -1
+-1 0.500000 vertex anim
+= 0.500000 texture 0.500000 frame 1.0 texture bone 0.500000
+0.500000 -1 material frame 1.0 frame bone anim
+anim
+=
+anim bone -1
+vertex = frame = anim bone vertex = 1.0 1.0
+texture 0.500000 anim frame
+1.0 1.0
+frame bone vertex = bone anim
+-1
+= bone
+=
+0.500000 texture texture anim texture texture 0.500000 1.0 -1 0.500000 bone = material
+material frame = material anim
+anim vertex
+frame 0.500000
+texture 1.0
+1.0 1.0 1.0 = anim bone = anim
+=
+vertex
+bone texture
+anim
+anim
+material
+material -1 vertex
+vertex 1.0 vertex = 1.0
+1.0 vertex 0.500000 1.0
+1.0 1.0 1.0
+vertex vertex
+vertex = bone -1 bone vertex -1 -1 vertex 0.500000 0.500000
+=
+1.0 1.0 -1 bone -1 vertex
+-1 -1 0.500000
+frame texture anim
+0.500000 = frame
+1.0 texture frame vertex material frame material frame 1.0 material
+anim material -1 material
+anim
+anim
+vertex
+material texture 1.0
+material 1.0 0.500000 1.0 bone bone texture material 0.500000 vertex anim texture material bone 0.500000 -1
+-1 frame
+0.500000 bone -1 frame 1.0
+texture
+bone
+frame material bone material 1.0 vertex vertex
+frame =
+=
+= vertex material material
+bone anim material
+=
+0.500000
+bone
+-1 vertex vertex anim texture material vertex bone frame vertex bone
+material texture
+frame 0.500000 frame 0.500000 0.500000 anim
+anim 1.0 bone
+1.0 = bone 0.500000 1.0 texture 1.0 -1 material frame frame vertex anim frame -1
+1.0 anim -1 0.500000 = vertex anim
+anim frame
+anim
+texture -1
+-1 frame
+material 1.0 -1 0.500000 =
+texture vertex bone 0.500000 = 1.0
+texture bone -1
+vertex 0.500000 anim bone 1.0
+= texture -1
+texture =
+frame -1 material = -1 texture bone frame
+texture texture
+0.500000 frame 0.500000 -1 frame material frame frame texture vertex texture texture 0.500000
+texture -1 anim anim vertex anim -1 material
+vertex = texture vertex
+0.500000 bone material =
+bone
+vertex
+-1
+0.500000
+vertex -1 material
+frame = bone
+1.0 1.0 1.0 material
+bone vertex 1.0 material anim anim material
+material = -1
+-1 vertex =
+= frame 1.0 vertex
+0.500000
+material frame frame material -1 =
+0.500000 vertex
+anim material frame
+0.500000
+vertex -1 texture
+=
+frame
+anim material texture texture -1 anim texture
+= bone vertex
+0.500000 0.500000 texture texture bone 0.500000 0.500000
+anim frame
+frame
+0.500000 1.0 -1 texture
+material -1 1.0 =
+texture frame = = texture vertex bone material 1.0 0.500000
+0.500000 anim
+texture texture bone = bone texture 0.500000
+material
+-1 -1 vertex material frame frame 1.0 bone
+= 1.0
+texture
+= anim texture texture frame vertex -1
+material anim material 0.500000 0.500000
+material texture -1
+bone -1 1.0 material
+bone material bone frame 1.0 1.0 texture -1
+vertex vertex 0.500000 = frame = vertex
+material = -1 texture frame 1.0 frame 1.0
+frame
+=
+frame
+anim 1.0 bone =
+material vertex = = vertex anim 1.0 bone vertex anim material = material = vertex
+0.500000
+1.0 = frame = -1
+1.0 material texture =
+-1
+vertex
+frame material = texture vertex = material material 1.0 0.500000 1.0
+texture
+= bone frame
+texture texture anim = = texture frame vertex
+material 1.0 1.0
+texture
+bone -1 material
+material vertex 1.0
+bone 0.500000 vertex texture = 1.0 = texture = =
+texture vertex vertex texture
+= frame 0.500000 vertex
+frame 1.0
+texture
+anim -1 = vertex bone
+1.0
+bone
+material -1 0.500000 -1 frame frame
+0.500000 anim
+1.0 texture
+texture
+material -1
+0.500000 texture = frame 1.0 = material 0.500000 1.0 vertex -1
+texture
+0.500000 bone
+bone 1.0
+texture 0.500000 -1 material 0.500000
+1.0 texture vertex
+= 0.500000 -1
+material =
+bone material vertex
+0.500000
+material texture
+bone -1 vertex texture 1.0 1.0 1.0 -1 -1 frame -1 anim
+bone vertex texture
+vertex 1.0 material = vertex
+frame frame anim = 0.500000 vertex anim texture = frame -1 1.0 vertex
+bone
+frame
+material
+bone anim anim frame frame
+=
+material texture 1.0 material texture -1 vertex -1 texture
+anim =
+anim 1.0 anim anim material 0.500000 frame = 1.0 anim material bone vertex 1.0
+texture bone frame texture
+1.0 0.500000 1.0 frame anim
+= material vertex bone 0.500000 = texture anim texture 1.0 anim
+-1
+= vertex
+=
+anim
+vertex 0.500000 anim
+-1 anim 0.500000 -1
+frame
+anim bone frame bone
+texture anim -1 anim = = texture bone frame texture anim anim anim anim vertex 1.0
+1.0 bone texture vertex
+anim frame frame bone texture texture = =
+material material frame bone vertex vertex
+material bone 1.0 = anim frame -1
+= 1.0 0.500000 frame
+-1 bone 0.500000 -1 = bone material
+material
+-1 = bone -1 bone 0.500000 material anim material
+material 0.500000 material frame 0.500000 material
+1.0 -1 texture = frame = vertex frame bone -1 0.500000 = material bone bone vertex -1 0.500000 bone
+= frame 1.0 1.0 = -1
+material 1.0 material texture
+bone = texture anim -1 1.0 1.0 texture vertex = =
+=
+1.0 frame vertex texture bone 1.0 anim bone -1 material frame frame
+frame 1.0 texture vertex texture frame 0.500000 bone anim bone texture bone texture texture bone
+anim 1.0 anim 1.0
+-1 vertex vertex vertex 0.500000 material
+vertex vertex = 1.0 bone material material frame bone frame 0.500000 -1 anim vertex
+1.0 = texture vertex anim vertex anim frame anim
+frame 1.0 vertex texture frame bone
+frame -1 anim frame
+vertex
+1.0 texture
+1.0
+anim material texture vertex 1.0 -1
+-1
+vertex -1
+vertex
+material material texture anim 0.500000 bone material
+bone 1.0 material vertex frame 1.0 0.500000 material
+frame 0.500000 material vertex vertex 1.0 frame anim bone texture bone anim texture
+0.500000 -1
+vertex
+-1
+0.500000
+0.500000
+anim vertex material vertex bone material
+1.0 bone
+= anim -1 frame
+anim bone
+0.500000
+0.500000 texture
+1.0 0.500000 -1 vertex
+= bone 0.500000 frame texture vertex anim
+bone
+1.0 material material vertex bone =
+material = frame = -1 -1 1.0 1.0 frame 0.500000 frame
+1.0
+0.500000 texture 1.0 0.500000 material 1.0
+1.0
+bone
+anim material
+frame texture bone anim f
\ No newline at end of file
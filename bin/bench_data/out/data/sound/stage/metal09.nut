@@ -0,0 +1,11 @@
+material
+1.0
+frame frame -1 texture bone
+material vertex -1 vertex 1.0
+material 1.0 frame -1 vertex 1.0 frame 1.0
+=
+= texture = bone bone material = texture anim material =
+frame
+vertex 1.0
+vertex frame material
+anim 0.5
\ No newline at end of file
@@ -0,0 +1,8 @@
+material
+1.0 texture
+vertex texture material = 1.0 -1
+= 0.500000 bone
+anim anim
+bone frame 1.0 = 1.0 0.500000 texture frame material = frame
+vertex 0.500000
+0.500000 frame 0.500000 material 0.500000 tex
\ No newline at end of file
@@ -0,0 +1,202 @@
+frame 0.500000 0.500000
+bone texture anim texture
+0.500000 anim texture
+= 0.500000
+anim = =
+-1 vertex material
+anim 0.500000
+material -1
+frame material
+1.0 1.0 texture material
+frame vertex -1
+vertex frame 0.500000 anim texture -1 vertex -1 0.500000
+frame -1 material vertex bone
+vertex vertex 0.500000 bone 0.500000
+vertex vertex frame anim 0.500000 = = anim anim
+frame frame 0.500000 material material texture bone 1.0 =
+1.0
+0.500000 texture 0.500000 material = vertex -1 texture frame bone
+bone =
+0.500000
+frame -1 -1 texture frame 0.500000
+frame = texture 0.500000 vertex texture 0.500000 bone
+vertex vertex
+-1 1.0 -1 anim -1 bone -1 -1 = -1 -1 anim 1.0 material material
+anim =
+1.0 = frame bone bone 1.0 frame material
+0.500000 anim 1.0 bone 1.0 -1 anim 1.0 = bone
+0.500000 frame
+=
+= 0.500000 texture frame vertex
+frame frame -1
+frame -1 1.0
+vertex 1.0
+bone -1
+-1 bone bone
+1.0 texture = anim vertex = 1.0 material frame anim frame
+= = vertex 1.0 vertex frame texture
+-1 0.500000 1.0 bone 1.0 -1
+vertex bone material texture
+1.0 bone = 0.500000
+bone
+= 0.500000 0.500000
+texture 0.500000
+bone frame texture vertex anim = = anim = -1 texture bone
+anim material bone vertex = -1
+texture
+texture 0.500000 = material material =
+material
+anim
+bone frame 1.0
+frame 0.500000 material
+frame vertex vertex = = -1 texture -1 = = 0.500000 frame
+vertex texture frame vertex 1.0
+1.0 texture bone frame bone material -1
+-1
+1.0
+bone -1 anim = = -1
+bone anim
+1.0 = texture material = 0.500000 bone vertex
+frame 1.0 frame -1 frame material frame frame bone 0.500000 bone anim material
+anim frame bone texture
+bone
+1.0 vertex 0.500000 1.0 anim bone
+texture bone frame
+anim
+texture bone 0.500000
+bone anim
+= material = -1 texture = -1 vertex
+anim frame 0.500000
+frame
+1.0
+-1
+bone anim -1
+1.0 anim vertex anim vertex anim
+vertex 1.0 anim
+0.500000 texture = material
+1.0 vertex -1 frame anim
+=
+bone frame -1 0.500000 bone texture
+0.500000 bone
+texture 1.0 bone
+frame
+bone =
+-1 1.0 texture
+-1 0.500000 texture 1.0
+anim = -1 material
+-1 frame
+material material frame = vertex texture texture bone anim anim material
+0.500000 texture anim bone bone
+-1 material frame 0.500000 -1 material
+anim bone
+1.0 bone
+0.500000 texture
+texture
+bone 0.500000 = texture anim anim anim
+vertex frame vertex -1 anim anim 1.0 0.500000 1.0 vertex
+-1 material
+texture -1 material vertex bone
+vertex anim anim 0.500000
+frame frame
+texture
+=
+1.0
+vertex texture vertex =
+-1 frame vertex frame vertex -1 bone
+bone vertex 1.0 frame texture =
+vertex anim frame
+vertex 0.500000
+bone bone 0.500000 frame material = 0.500000 vertex texture 1.0 1.0 0.500000 0.500000
+0.500000
+frame material 1.0 0.500000
+frame bone vertex
+anim 1.0 frame
+anim -1
+bone
+texture -1 0.500000 =
+frame
+frame
+vertex
+= frame vertex
+anim
+= bone bone
+0.500000 anim bone
+frame
+0.500000
+anim material
+bone
+anim
+bone =
+anim frame
+frame vertex -1 material 0.500000
+texture 1.0 anim bone vertex vertex
+0.500000
+bone bone
+vertex = frame material
+vertex 1.0 anim anim anim
+= =
+texture 0.500000 -1 anim = texture 0.500000 texture texture
+1.0
+0.500000 bone bone bone -1 -1 1.0 -1 0.500000 frame 0.500000 1.0 bone texture 1.0
+vertex
+1.0 frame material
+material 0.500000 bone material texture = bone
+-1 vertex
+0.500000
+= 0.500000 material 0.500000 vertex vertex
+frame
+anim bone anim 0.500000 vertex -1
+anim 0.500000 = -1 material bone 0.500000 bone 0.500000 -1 =
+bone frame
+1.0
+-1 bone
+vertex bone bone material
+anim material -1 0.500000 1.0 1.0 1.0
+=
+frame =
+anim
+= 1.0 -1 = anim vertex
+anim
+0.500000 texture
+-1
+texture -1
+-1 vertex bone frame material anim
+vertex anim -1
+bone texture material frame
+anim bone 0.500000 bone anim 1.0 = texture texture = -1 frame frame = -1 1.0 0.500000
+material anim -1 texture = 0.500000
+material
+-1 material bone
+anim anim material 0.500000 =
+material
+frame material = -1 material 0.500000 1.0 material material anim =
+frame -1 frame
+material -1
+0.500000
+anim
+frame anim frame -1 vertex
+material 1.0 bone
+anim 1.0
+=
+bone 1.0 vertex
+0.500000 anim
+anim
+-1 texture material 0.500000 material 1.0
+bone vertex frame texture texture
+vertex anim -1
+-1 0.500000 material
+=
+0.500000 -1
+0.500000 1.0 vertex anim frame frame
+-1
+bone
+-1
+-1
+0.500000 bone -1 -1 frame frame anim = bone
+0.500000
+vertex frame
+bone texture frame = 0.500000 vertex
+-1 frame -1 0.500000 texture = texture = 1.0
+-1
+0.500000 0.500000
+frame 
\ No newline at end of file
@@ -0,0 +1,2 @@
+material texture
+vertex 0.500000
\ No newline at end of file
@@ -0,0 +1,65 @@
+anim = frame 0.500000 = anim vertex
+vertex bone = frame bone vertex 0.500000 anim material
+0.500000
+anim
+bone -1 0.500000
+material texture
+0.500000 vertex
+bone = material texture frame bone 0.500000 frame material material frame anim
+texture = frame
+1.0
+0.500000 frame 1.0 1.0 1.0 texture 1.0 vertex anim 0.500000 0.500000 frame
+0.500000 = -1 bone vertex
+texture 1.0 0.500000
+anim 1.0 =
+0.500000
+material 1.0 texture
+0.500000 0.500000 frame
+texture = bone anim = = material -1 bone bone
+bone vertex
+=
+texture -1
+= vertex
+material bone material frame vertex texture texture material bone texture material 1.0 0.500000 material texture vertex texture anim =
+vertex
+vertex material vertex frame
+texture
+=
+0.500000
+-1 material
+texture frame 1.0 -1
+anim anim bone vertex bone bone
+0.500000 bone frame material 0.500000 1.0 0.500000
+anim
+frame -1 material = anim 1.0 =
+frame 1.0 anim texture frame anim = anim material 1.0
+0.500000 texture 0.500000
+-1 anim texture 1.0
+anim frame
+bone 1.0 vertex bone
+-1 0.500000 frame
+-1 -1 anim anim = vertex
+anim texture 1.0 1.0 bone anim bone 1.0 anim bone bone -1 -1 1.0 material -1 material -1 0.500000
+frame 0.500000
+bone vertex
+frame anim
+bone = frame texture = bone bone
+vertex -1 texture 0.500000 material vertex 0.500000 -1 bone
+anim
+frame 0.500000
+frame -1 1.0 = -1 texture anim anim material
+-1 bone anim bone
+vertex 1.0 frame vertex bone 0.500000 bone material -1 = -1 material vertex anim texture texture
+-1
+material texture texture -1 texture -1 anim -1 frame 0.500000
+1.0
+0.500000 vertex bone 0.500000 texture 0.500000
+1.0 frame bone texture bone texture frame
+anim vertex 0.500000 vertex material texture frame 1.0 0.500000 = frame
+1.0
+= = material
+0.500000 material
+frame anim 1.0 bone anim 1.0 0.500000 -1 = texture anim = frame
+1.0 anim
+material
+1.0 texture frame 0.5000
\ No newline at end of file
@@ -0,0 +1,80 @@
+1.0 bone
+0.500000 0.500000 material frame material =
+anim texture anim vertex = -1 = texture
+-1 frame
+bone vertex material
+texture vertex
+1.0
+texture
+= material -1 texture texture bone
+material frame = 0.500000 -1 -1 anim material
+vertex texture
+frame = anim 1.0 bone material bone anim 0.500000 vertex = 0.500000 texture vertex 1.0 -1 vertex
+0.500000
+vertex
+material 0.500000 -1 frame = frame bone
+= texture 1.0 frame material
+=
+material = anim
+-1 vertex vertex = = = vertex = texture anim -1 frame frame
+1.0 anim
+1.0 anim
+=
+0.500000 material
+-1 material =
+-1 = frame
+frame material bone vertex
+frame = -1 texture 0.500000 texture material vertex anim
+vertex
+vertex 1.0 material 0.500000 = 0.500000 -1 =
+vertex
+0.500000 texture 0.500000 material = material -1 1.0 bone = material anim
+frame bone
+vertex frame = texture
+material = =
+texture = = vertex 1.0 vertex
+anim 0.500000
+texture 1.0 1.0 = anim material vertex material
+texture = anim frame vertex
+bone 0.500000 0.500000 = 0.500000 vertex bone bone 0.500000 vertex
+1.0 1.0
+bone
+material 0.500000 frame 1.0 texture frame 1.0 -1
+0.500000
+material material bone 0.500000
+-1 texture texture frame
+texture material material anim texture texture
+texture
+0.500000 anim 0.500000
+texture
+vertex -1 = vertex
+=
+frame frame vertex bone
+=
+0.500000 anim material =
+texture 1.0
+= vertex = anim vertex frame anim texture 0.500000
+anim texture anim
+anim anim
+anim
+1.0 frame 0.500000
+bone
+texture anim
+texture 1.0 -1 anim -1 = vertex anim vertex
+frame 1.0 texture
+-1
+frame = material material bone anim
+= bone material
+1.0 1.0 vertex bone bone
+vertex
+-1 -1 -1 1.0 0.500000 frame frame
+bone frame 0.500000 1.0 -1 0.500000 anim = vertex
+bone
+texture = anim -1 texture bone
+texture =
+-1
+material vertex 0.500000
+texture
+bone vertex texture anim
+frame = 1.0 0.500000 frame 0.500000 material
+bone = material 1.
\ No newline at end of file
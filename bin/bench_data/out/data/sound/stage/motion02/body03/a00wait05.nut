@@ -0,0 +1,109 @@
+1.0 bone anim
+material
+vertex =
+0.500000 -1 bone
+= bone vertex frame bone -1 -1 -1
+-1 frame 1.0
+0.500000 frame vertex
+texture
+material
+frame texture anim anim
+texture anim vertex vertex vertex
+material anim texture texture
+vertex
+= vertex anim
+texture 0.500000 vertex -1 bone
+vertex -1
+material texture -1
+texture bone bone vertex
+0.500000 material texture vertex = 1.0
+0.500000 anim = -1
+material 0.500000
+1.0 texture frame texture anim texture frame anim 1.0 1.0
+material vertex vertex
+texture
+texture anim
+anim = frame 0.500000 bone texture bone = frame 0.500000
+-1 vertex
+1.0 texture
+1.0 -1 anim bone anim vertex vertex
+1.0 texture bone bone vertex material bone texture frame 1.0 bone -1 bone bone =
+1.0 1.0 vertex 1.0 -1 bone frame bone 0.500000 0.500000
+-1 bone
+-1 vertex bone anim
+material
+vertex vertex material = texture texture -1 0.500000
+material bone
+-1 = -1
+material 0.500000 texture bone =
+bone 1.0 bone texture
+material
+material
+-1 vertex =
+texture -1 frame 1.0 anim
+frame frame 1.0 texture
+texture bone
+material -1 material 0.500000
+frame anim
+material texture -1 texture material -1 vertex = texture anim bone texture 0.500000 anim 0.500000 anim anim bone
+1.0 material 1.0 frame
+0.500000
+texture material material 1.0 texture 0.500000 bone -1
+1.0 texture 1.0 1.0
+0.500000 vertex bone frame texture
+0.500000 1.0 frame vertex = texture
+frame anim
+frame
+= 0.500000 vertex 0.500000 0.500000
+vertex bone 1.0 frame 1.0 1.0
+material -1 frame bone bone 1.0 bone anim = 1.0 anim
+vertex frame
+= material 0.500000 frame
+bone frame frame bone
+= =
+-1 texture -1 frame anim material
+vertex texture
+texture frame bone bone = vertex anim = 0.500000 0.500000 material = -1 =
+1.0 anim texture 1.0 =
+anim frame anim -1 -1 = 0.500000
+= 1.0 0.500000
+frame 0.500000
+texture 1.0
+-1 0.500000 1.0 anim material 1.0 bone texture -1 -1
+bone material 0.500000 1.0 anim texture
+bone vertex texture texture = vertex
+anim
+-1
+0.500000 0.500000 vertex texture
+=
+0.500000 texture = 0.500000 0.500000 frame -1 texture texture vertex texture = anim
+vertex anim
+-1 vertex material bone = = 1.0 1.0 = texture bone
+vertex bone
+bone frame bone vertex
+-1 -1 -1
+= frame
+1.0 1.0 anim frame
+= 0.500000 1.0
+anim 0.500000 bone
+vertex material vertex
+texture vertex vertex bone -1 0.500000
+anim
+vertex
+anim bone
+texture anim material
+1.0 bone
+bone -1
+texture anim 1.0
+=
+0.500000 =
+=
+= = texture
+-1
+vertex 0.500000 1.0 0.500000 vertex
+= -1 = 0.500000 0.500000
+-1 vertex vertex 1.0 vertex
+-1 bone
+= 0.500000 1.0 texture texture
+texture
+1.0 -1 textu
\ No newline at end of file
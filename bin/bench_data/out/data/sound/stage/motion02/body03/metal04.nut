@@ -0,0 +1 @@
+7\d|T=JF۶sh'!6*J*~q)g9
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex material -1
+= -1 = -1
+1.0 material frame frame
+fram
\ No newline at end of file
@@ -0,0 +1,4 @@
+= 1.0 frame
+frame
+-1 vertex anim bone
+0.500000 -1 anim frame texture bone anim te
\ No newline at end of file
@@ -0,0 +1,12 @@
+-1
+material texture texture material
+anim anim material 0.500000 anim = vertex bone
+=
+0.500000 texture
+= vertex
+vertex frame anim
+texture -1
+1.0 vertex anim vertex
+vertex
+1.0 1.0 1.0 bone 1.0 frame
+material material
\ No newline at end of file
@@ -0,0 +1,8 @@
+1.0 -1 -1
+0.500000 material
+texture
+= anim
+0.500000 -1 bone material 0.500000 bone material
+0.500000 1.0 0.500000 = 0.500000 = frame
+vertex -1 frame 0.500000 frame bone material vertex
+vertex material 1.0 1.0 
\ No newline at end of file
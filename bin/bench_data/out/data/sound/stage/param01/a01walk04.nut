@@ -0,0 +1,102 @@
+texture texture
+frame
+0.500000 -1 bone 1.0
+= material vertex 0.500000
+0.500000 -1 1.0 1.0 anim
+vertex material =
+= bone frame texture texture 0.500000 anim vertex
+frame 1.0
+= 1.0 = frame bone
+= texture frame
+0.500000
+anim material
+anim 1.0 1.0 vertex 0.500000 frame
+texture 1.0 anim
+anim
+texture vertex -1 material
+0.500000 0.500000 -1 bone
+anim
+texture 0.500000
+texture bone
+material =
+-1 frame texture
+vertex -1
+=
+= bone
+1.0 texture vertex 0.500000 bone vertex -1 vertex anim
+vertex -1 vertex material
+anim = bone bone texture
+anim 0.500000 texture
+texture
+-1
+anim 0.500000
+frame
+-1
+frame texture
+texture 0.500000
+frame vertex
+bone frame
+-1 bone
+texture anim material texture frame 1.0 frame vertex
+-1 texture material texture material -1 1.0
+texture 0.500000 0.500000 anim frame material anim
+bone 0.500000
+-1
+0.500000 1.0 -1 1.0
+1.0 material anim anim
+vertex 0.500000 texture texture 1.0 material frame bone -1
+= texture 1.0 vertex
+-1 texture 0.500000
+frame bone bone = anim texture 1.0
+1.0
+frame 1.0 material 1.0 = = = anim bone frame
+material = 1.0
+frame material 0.500000 -1 anim anim frame 1.0 frame =
+vertex
+= = material
+vertex -1 anim 0.500000 1.0 0.500000 1.0 = texture 0.500000 material
+anim anim frame material 1.0 vertex = bone
+vertex 1.0
+-1 material -1 1.0 1.0 vertex
+= frame 0.500000 frame 1.0 frame vertex
+-1 =
+0.500000 1.0 0.500000 frame = = 1.0 frame
+material
+texture
+1.0 -1 frame 0.500000
+1.0 bone frame vertex
+1.0 texture material
+frame material texture texture -1 -1 0.500000 material frame = vertex
+texture
+material
+= frame
+anim frame texture 0.500000 1.0 vertex -1 vertex
+1.0 texture anim vertex 0.500000 frame
+frame
+-1 texture
+frame vertex
+vertex
+1.0 -1 frame
+0.500000 =
+=
+bone
+anim
+-1 0.500000 material vertex -1 anim
+material
+0.500000 bone material frame frame
+bone 1.0
+= = vertex 0.500000 bone vertex
+anim
+bone
+1.0
+= anim vertex
+anim 1.0 = vertex 1.0 material anim
+vertex
+material -1 0.500000 texture -1
+= = bone
+anim -1 0.500000 -1 texture vertex anim material
+bone = 0.500000
+frame vertex vertex =
+texture
+1.0
+v
\ No newline at end of file
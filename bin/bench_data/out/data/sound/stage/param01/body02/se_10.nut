@@ -0,0 +1,3 @@
+frame vertex texture texture vertex texture
+bone
+= bon
\ No newline at end of file
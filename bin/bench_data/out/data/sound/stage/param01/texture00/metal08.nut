@@ -0,0 +1,94 @@
+1.0
+0.500000
+-1 = material bone 1.0
+vertex anim 0.500000 frame
+anim -1 = = -1
+frame material vertex frame vertex vertex 0.500000 anim frame
+bone texture texture
+material
+bone 0.500000 texture =
+texture bone
+material
+0.500000 = 1.0
+= material 0.500000 1.0 vertex anim 0.500000 -1 frame material material texture texture
+0.500000 = 0.500000 -1
+vertex
+0.500000 -1
+bone -1 vertex 0.500000 material
+anim
+anim anim
+anim 0.500000
+= = material = 0.500000 vertex bone 0.500000 1.0 anim = 0.500000
+vertex material 1.0 texture bone
+texture
+frame vertex 1.0 bone frame vertex material vertex
+-1 bone 1.0 texture
+0.500000 vertex material
+=
+material -1 material 0.500000 vertex -1 frame texture
+0.500000 0.500000 anim -1
+-1 material = frame texture
+= texture bone 0.500000
+bone
+texture 0.500000 material vertex material
+material -1 0.500000
+-1 frame anim 1.0 =
+material 0.500000 1.0 material material 0.500000
+texture -1
+anim
+material 0.500000 0.500000 anim frame
+anim
+bone frame texture
+0.500000 vertex = bone
+frame
+frame
+bone -1 1.0 anim -1 anim 0.500000 bone anim frame vertex 0.500000 -1 texture vertex texture anim
+texture anim anim texture anim anim texture -1 texture vertex 0.500000 bone frame 0.500000
+vertex bone
+texture frame frame
+bone frame frame 0.500000
+= anim -1 -1 frame frame material frame texture bone bone vertex 1.0 anim bone = anim
+material -1 0.500000
+= anim texture vertex 1.0 material
+texture
+anim texture texture frame frame anim 1.0 frame anim texture 1.0
+= frame vertex material -1 material =
+anim vertex texture =
+1.0
+vertex anim
+vertex bone material
+1.0 = -1 material vertex
+=
+bone anim vertex = 0.500000 = vertex
+= bone texture 1.0 1.0 vertex bone material frame
+= 1.0 bone bone
+1.0 1.0 bone
+vertex material 1.0
+bone texture bone -1 0.500000 frame = frame -1
+frame frame
+texture 1.0 -1 material material = 0.500000 material 0.500000 vertex 0.500000 bone texture bone
+texture =
+vertex
+texture
+bone 0.500000 vertex frame = -1 -1 texture anim texture bone anim = anim material 1.0 vertex -1 -1 anim 1.0 vertex 1.0 = texture anim
+-1 0.500000 1.0 anim
+texture =
+frame frame = -1 1.0
+1.0
+anim material anim
+0.500000 frame vertex -1
+vertex
+= frame = anim anim vertex anim
+anim vertex frame -1 vertex 1.0 anim material bone
+vertex bone 1.0 texture 1.0 1.0 anim = texture
+1.0 -1 -1 vertex
+-1
+anim vertex
+bone material -1
+-1 = anim frame
+0.500000 frame
+texture -1 material 1.0
+anim
+texture 0.500000 texture frame
+anim frame 1.0 bone
+0.50
\ No newline at end of file
@@ -0,0 +1,69 @@
+vertex texture = material
+vertex texture -1 = 1.0
+1.0
+vertex
+bone
+anim anim vertex
+anim
+texture frame 1.0
+vertex bone
+1.0
+material anim vertex bone =
+0.500000 vertex vertex -1 material
+0.500000 texture 1.0 frame anim =
+material 1.0 anim 0.500000 material material vertex anim bone bone material 1.0 0.500000 frame vertex
+= anim frame bone material vertex texture = material anim -1 = 1.0
+vertex 1.0 =
+0.500000
+texture 1.0 vertex texture
+texture -1 bone
+frame frame material
+bone material material 1.0
+bone 1.0 bone
+frame =
+-1 1.0 anim frame material -1 0.500000 = = 1.0
+vertex texture vertex = 0.500000
+1.0 = 1.0
+=
+= vertex texture
+texture 1.0 1.0 frame
+anim = texture anim
+0.500000 1.0 =
+= 0.500000
+material
+texture anim frame material 1.0 anim -1 anim
+material material
+vertex vertex anim
+texture
+1.0 =
+frame bone = frame anim vertex vertex frame frame
+anim 1.0 = 1.0 = vertex -1
+texture frame
+material 1.0
+vertex bone anim
+frame anim anim vertex =
+bone -1 material = 0.500000
+vertex anim
+1.0 anim 0.500000 -1
+anim frame 0.500000 bone
+1.0
+frame -1 -1
+-1 material
+texture
+material material 1.0 0.500000
+frame material 1.0 texture frame -1 material -1 texture 0.500000 bone bone vertex bone frame
+vertex
+0.500000 texture 1.0
+-1 anim frame = bone 0.500000 material
+-1 0.500000 material
+0.500000 0.500000
+frame -1 bone -1
+anim anim
+1.0 bone
+1.0 -1 vertex vertex =
+vertex texture 1.0 -1 anim 1.0 texture bone bone texture
+= frame texture bone
+vertex 0.500000 anim -1
+bone
+texture material 0.500000 bone 1.0 anim 1.0
+-1 material 0.500000 frame
\ No newline at end of file
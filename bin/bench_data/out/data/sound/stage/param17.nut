@@ -0,0 +1,7 @@
+texture
+texture anim
+vertex 1.0 -1 frame bone
+vertex bone
+1.0 vertex vertex
+anim bone 0.500000 1.0 texture vertex 1.0 1.0
+material 0.500000 texture bone = 0.500000 material -1 anim ve
\ No newline at end of file
@@ -0,0 +1,13 @@
+anim 1.0 vertex
+anim bone bone 1.0 texture
+anim 1.0 bone material 1.0 material
+1.0 texture texture
+frame material
+0.500000 vertex 1.0 1.0 bone vertex =
+material
+frame = vertex 0.500000 -1
+anim vertex 0.500000 = anim material anim -1 = -1 anim bone = material
+= 0.500000
+anim -1 material -1 bone material texture -1
+= texture = texture 1.0
+texture bone 0.
\ No newline at end of file
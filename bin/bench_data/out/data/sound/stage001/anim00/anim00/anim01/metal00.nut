@@ -0,0 +1,15 @@
+frame frame
+-1
+1.0 =
+bone
+vertex bone bone vertex
+bone 1.0 frame bone frame bone vertex
+vertex texture
+= texture vertex 0.500000
+1.0
+material anim frame material vertex anim bone frame vertex bone texture material frame vertex
+0.500000 -1 vertex 1.0 texture =
+vertex vertex
+0.500000 texture
+vertex vertex vertex = material vertex 0.500000 texture frame bone material texture = frame 1.0 material anim anim -1 =
+0.500000 material = 1.0 bone vertex 1.0 ma
\ No newline at end of file
@@ -0,0 +1,41 @@
+1.0 1.0
+frame frame material vertex
+=
+0.500000 frame
+anim 1.0
+1.0 vertex
+vertex material -1 material
+1.0 bone
+=
+texture texture bone
+texture
+0.500000
+-1 bone
+= = 1.0
+material
+texture
+-1
+-1 texture bone
+0.500000 texture 0.500000 texture 0.500000 = vertex texture texture
+0.500000
+anim anim
+texture
+anim
+-1 1.0 material
+frame 1.0 frame vertex 1.0
+vertex 1.0
+frame vertex 1.0 texture -1 -1 vertex material vertex frame = bone -1 bone
+=
+1.0
+vertex = vertex frame
+= bone bone bone anim texture bone = bone frame = frame texture
+frame material 1.0 frame
+-1
+material vertex texture 1.0
+bone
+0.500000 material
+bone
+frame bone 0.500000 = texture 0.500000 1.0 texture anim vertex material 0.500000 vertex
+=
+texture frame
+0.500000 material 0.500000 = 
\ No newline at end of file
@@ -0,0 +1,41 @@
+-1 -1 bone
+material anim anim vertex bone = material -1 material anim 0.500000
+frame
+1.0 anim vertex 0.500000 texture anim frame
+bone anim bone =
+texture material vertex anim material
+frame
+texture frame -1 vertex vertex 1.0
+bone texture
+1.0 1.0 bone = -1 anim vertex 0.500000 frame vertex material
+material = material
+material
+texture texture 1.0 frame
+anim
+material bone vertex -1
+1.0 vertex 0.500000 vertex 0.500000
+texture
+texture vertex
+-1 -1 frame = vertex
+frame 1.0 bone
+frame frame
+0.500000 =
+1.0 -1 0.500000 vertex texture material 0.500000 0.500000 frame
+1.0 -1 = 1.0 anim -1 -1 0.500000 material
+bone texture anim 0.500000 0.500000 = frame
+texture vertex -1 = vertex frame vertex
+bone bone -1 = 0.500000
+frame -1 frame = anim = vertex
+1.0 0.500000 texture texture 1.0 vertex
+frame
+0.500000
+texture
+bone
+anim 1.0 anim
+material vertex vertex frame material = 1.0 1.0 1.0 vertex -1 texture = vertex 1.0
+1.0 bone 0.500000
+texture vertex vertex material vertex texture anim = anim bone frame bone bone
+-1 0.500000 bone
+= -1
+texture 1.0 bone -1 = frame material anim frame anim
+texture frame -1 ve
\ No newline at end of file
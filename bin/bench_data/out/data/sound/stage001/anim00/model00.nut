@@ -0,0 +1,3 @@
+vertex -1
+texture bone anim
+material -1 anim anim material -1 1.0 = v
\ No newline at end of file
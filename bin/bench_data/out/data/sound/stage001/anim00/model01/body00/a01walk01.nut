@@ -0,0 +1,244 @@
+frame
+= vertex
+material vertex
+anim
+material frame anim anim
+anim
+vertex texture material texture frame anim
+texture 1.0 material -1 0.500000 vertex -1
+anim
+frame texture
+= vertex -1
+0.500000 anim
+bone
+texture
+-1 vertex
+bone
+material anim frame 1.0 0.500000 anim
+vertex
+-1 anim bone
+1.0 0.500000 frame
+= vertex material
+bone vertex -1 texture
+anim = bone
+vertex 1.0 =
+frame
+0.500000
+1.0 bone
+vertex 1.0 frame -1 vertex =
+anim frame
+bone
+1.0
+texture -1
+0.500000
+0.500000 =
+=
+texture -1 0.500000
+anim material
+vertex frame -1 1.0 vertex
+frame
+frame
+1.0 = texture -1
+vertex
+1.0 =
+frame -1 0.500000 vertex
+frame =
+material
+vertex = -1
+frame =
+frame 0.500000 bone bone material material vertex bone material vertex
+anim 0.500000 -1 -1 material vertex 0.500000 -1 vertex = -1 vertex vertex 0.500000 1.0
+0.500000 = 0.500000
+-1 anim
+bone
+1.0 = 1.0 bone -1 anim
+vertex
+= frame -1 material 1.0
+0.500000
+bone bone texture
+0.500000 -1 material frame -1 bone frame
+1.0 1.0 vertex = anim bone
+anim bone 0.500000 bone
+material texture
+1.0 bone anim frame
+vertex frame
+bone 1.0 bone material vertex
+vertex vertex
+texture vertex
+anim
+=
+anim anim anim material texture material anim frame bone 0.500000 texture 0.500000 0.500000 -1 anim
+-1 -1 texture
+1.0 vertex
+anim frame material bone
+anim material -1 material
+bone texture 1.0 = 1.0 texture bone bone texture anim
+anim material
+-1 =
+material material vertex material frame vertex vertex
+material 1.0 =
+frame 1.0 1.0 material
+anim vertex texture vertex frame bone
+vertex
+frame = frame 1.0 0.500000 1.0 texture 0.500000 0.500000 material
+0.500000 anim bone texture frame 0.500000 vertex 1.0 texture
+=
+1.0 = vertex texture texture vertex bone = texture anim
+anim
+0.500000 = 1.0 0.500000 anim 0.500000
+vertex frame frame 1.0 = =
+1.0 texture
+frame = bone texture 0.500000
+0.500000 bone = bone
+texture material bone frame
+material frame material
+bone vertex = texture bone
+bone 0.500000 =
+frame
+texture vertex bone texture
+-1 vertex
+material vertex vertex material bone 0.500000 texture frame frame vertex texture anim texture =
+material
+vertex anim 0.500000 texture bone material
+bone
+frame 1.0 frame bone texture 0.500000 1.0 0.500000 texture -1 material
+anim
+bone
+vertex vertex material texture 0.500000 anim
+-1 frame -1 bone
+1.0 texture =
+0.500000 vertex bone bone frame
+texture
+texture = bone 1.0 1.0 1.0 frame
+vertex 1.0
+anim 0.500000
+1.0 0.500000 frame 1.0 bone
+-1 frame frame 1.0
+vertex
+frame vertex bone
+bone 0.500000 frame
+texture = frame bone frame bone
+texture bone anim vertex vertex anim
+bone material vertex bone 0.500000 vertex =
+bone
+anim anim =
+bone vertex texture frame
+0.500000 -1 texture
+vertex frame 0.500000 vertex bone texture -1
+1.0 0.500000 texture 1.0 anim texture
+= = material anim
+-1 vertex frame vertex texture =
+= -1 = vertex -1 texture
+material vertex anim -1 1.0
+frame bone =
+material bone
+-1 material material
+1.0 bone
+frame
+anim
+frame = vertex texture anim bone = 1.0 anim = bone = -1 vertex anim
+-1 material bone
+0.500000 0.500000 material texture 1.0 bone
+0.500000 bone 0.500000 0.500000 frame texture -1 bone anim vertex frame frame frame = material bone 0.500000 material 0.500000 vertex
+frame bone = frame 1.0 bone material
+vertex anim bone -1 1.0
+0.500000 vertex frame
+-1 anim =
+1.0 texture
+material -1
+bone
+= material 1.0
+-1
+= -1 material frame -1 material -1 1.0 material anim 0.500000 vertex anim material frame
+anim texture
+material
+bone texture -1 vertex 1.0 anim
+vertex anim anim texture -1 texture frame texture 0.500000 bone = texture texture frame -1 vertex texture material 0.500000 = vertex -1 anim
+material bone
+frame -1 bone texture -1
+-1
+-1 material 1.0
+texture anim frame = 0.500000 0.500000
+vertex
+-1 0.500000 bone vertex frame = 0.500000 =
+-1 vertex
+vertex vertex material bone frame anim 1.0 = -1 1.0 -1
+= texture bone bone 1.0
+vertex frame anim
+frame
+=
+material
+0.500000
+0.500000 = frame anim material
+bone = 1.0
+texture bone texture texture vertex
+0.500000 -1 =
+anim texture
+anim
+0.500000
+bone 1.0 material vertex 1.0 = =
+anim -1 = material texture
+vertex frame texture
+1.0 anim -1
+material -1 anim anim = 1.0 texture
+texture = 0.500000
+anim frame bone material material bone
+anim texture
+bone
+texture vertex vertex
+material texture
+1.0
+-1
+texture vertex texture = = bone 0.500000
+frame anim 1.0 0.500000 -1 vertex anim texture
+= bone 0.500000 bone anim
+frame =
+anim 0.500000 bone
+anim texture 0.500000 0.500000 -1 bone
+texture 1.0 = texture 0.500000 vertex texture anim =
+texture 0.500000 vertex
+anim =
+frame bone
+anim -1 -1 material anim -1 -1 bone texture =
+texture texture texture frame texture 0.500000
+material
+texture bone bone bone
+= bone
+1.0
+0.500000
+1.0 = frame vertex anim vertex bone frame
+frame -1 material frame 1.0 1.0
+frame
+= 1.0 material 1.0 = -1
+0.500000
+material
+frame
+bone
+-1
+bone texture
+1.0 anim frame vertex texture material vertex -1 1.0 material material -1
+0.500000 anim texture
+= bone vertex anim -1 1.0
+=
+bone frame texture anim = texture 1.0 vertex anim frame material anim
+frame
+material 1.0 vertex vertex
+material material anim material bone
+texture 0.500000 = 0.500000 vertex -1 frame anim 1.0 bone
+texture 0.500000
+vertex 0.500000 material -1
+vertex
+texture
+-1
+material =
+frame material anim material -1 1.0 anim =
+bone 1.0 = frame frame
+frame -1
+bone
+bone
+0.500000 anim bone frame = material texture
+material 0.500000 frame 1.0
+texture bone
+= = material = anim vertex
+1.0 bone =
+texture vert
\ No newline at end of file
@@ -0,0 +1,3 @@
+vertex texture material vertex anim 1.0 texture vertex
+bone = = 0.500000 -1 = frame bone = -1
+frame textu
\ No newline at end of file
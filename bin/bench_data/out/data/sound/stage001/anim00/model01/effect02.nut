@@ -0,0 +1,21 @@
+= texture
+0.500000 0.500000
+bone 1.0
+frame frame texture bone
+texture
+0.500000 vertex anim -1 bone
+0.500000 anim
+bone bone vertex vertex anim =
+-1 anim material
+bone frame 0.500000 1.0 =
+bone frame
+-1 anim bone 1.0 anim 1.0
+bone 1.0
+vertex =
+texture -1 texture
+=
+texture -1 0.500000 = bone
+vertex vertex
+-1 frame vertex -1
+= 1.0 bone
+vertex 1.0 -1 vertex -1 frame 0.5000
\ No newline at end of file
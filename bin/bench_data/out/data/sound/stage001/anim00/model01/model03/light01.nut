@@ -0,0 +1,22 @@
+bone texture
+bone material texture 0.500000 anim 1.0 texture
+frame bone texture =
+bone texture = -1 0.500000 -1 anim texture = 1.0 anim
+=
+=
+material
+= texture 0.500000 0.500000 vertex
+material material texture
+-1 material
+texture -1 bone 0.500000 -1
+0.500000 = vertex
+texture
+material
+frame material 0.500000 bone
+texture 0.500000 anim texture 1.0 bone
+texture 1.0
+material bone bone -1 vertex vertex 1.0 texture anim
+material vertex
+texture
+anim
+1
\ No newline at end of file
@@ -0,0 +1,211 @@
+-1
+material texture -1 anim = = anim 0.500000
+material frame vertex material vertex texture vertex 0.500000 0.500000 0.500000 bone
+1.0 anim
+anim 0.500000 -1 bone material
+0.500000 = 1.0 bone bone 1.0
+= texture
+bone
+0.500000 = = material bone
+frame anim bone frame
+texture material bone -1 0.500000 1.0 = material vertex
+0.500000 1.0 frame
+vertex material bone
+texture frame
+texture texture
+material frame anim material 1.0 anim material
+1.0 1.0 material
+texture -1 frame vertex
+bone
+texture 1.0 texture
+frame frame 0.500000 bone bone -1 anim
+-1 = anim 0.500000 texture = vertex = bone
+0.500000 vertex 0.500000 anim
+-1 1.0 1.0 anim
+texture = vertex bone material material -1
+frame
+material texture material bone vertex 0.500000
+material 0.500000 anim vertex frame vertex
+-1 = frame
+material
+0.500000
+anim = -1 0.500000 material -1 bone 0.500000 bone 0.500000 material anim
+-1 texture
+texture
+1.0 frame -1 1.0
+=
+vertex -1 vertex anim
+material texture anim texture
+1.0 vertex -1 texture
+= -1 texture 0.500000 1.0
+texture
+vertex -1 -1
+anim -1 anim frame material material texture vertex vertex vertex bone
+0.500000
+texture anim -1 frame frame frame texture
+vertex texture
+0.500000 anim texture 0.500000 = vertex
+=
+0.500000 -1 = vertex material
+-1 texture 1.0
+bone bone
+0.500000 material material 1.0
+-1
+bone bone material -1
+frame
+1.0 vertex frame frame = anim = 1.0
+frame texture bone
+anim
+vertex anim
+vertex
+vertex -1
+frame
+-1 1.0 material -1 frame =
+0.500000 = 1.0 = material 0.500000 0.500000 texture material -1 texture =
+vertex vertex frame vertex texture frame -1 frame
+bone vertex = 0.500000
+texture
+= 0.500000 -1 0.500000 vertex vertex 1.0
+material 0.500000 vertex 0.500000 = texture frame
+0.500000 frame anim = -1
+material material 1.0 bone =
+= 0.500000 -1
+1.0 texture 0.500000 material bone
+= frame
+vertex frame 0.500000 texture vertex = material -1 frame =
+= anim vertex texture bone texture =
+anim texture vertex material anim vertex
+texture texture
+1.0 1.0
+vertex
+= texture frame
+vertex
+anim
+material
+vertex = bone 1.0 material
+0.500000 frame
+frame material material vertex vertex
+bone bone frame 0.500000
+1.0 bone bone 0.500000 vertex texture bone vertex 0.500000 frame
+bone frame
+anim anim 0.500000 -1 vertex 1.0
+anim frame = 1.0 texture 0.500000 frame -1 1.0 texture
+material material material texture -1
+1.0
+1.0 -1 1.0 texture 1.0
+anim bone
+material
+-1 0.500000 0.500000 0.500000 anim texture frame -1
+texture texture = 1.0 -1 vertex material anim
+1.0 0.500000 =
+frame
+vertex texture -1 material 0.500000 material
+vertex
+1.0 material 1.0 = bone 0.500000
+1.0
+1.0 material -1
+0.500000 vertex -1 vertex vertex texture bone vertex texture -1 bone frame material vertex bone bone
+1.0 -1
+frame 1.0 material anim
+0.500000 material 1.0 -1
+-1
+frame material
+= 1.0 material bone
+= anim material = -1 0.500000 bone anim frame material vertex texture
+frame frame bone 0.500000
+frame 0.500000
+bone
+frame 1.0 anim
+bone
+vertex frame material -1 0.500000 material
+bone vertex bone anim
+vertex -1 1.0 bone -1 frame 0.500000 anim
+0.500000
+anim 1.0 bone
+1.0
+material
+-1 bone
+0.500000 material = = texture
+anim
+anim vertex -1
+1.0 0.500000
+material
+bone bone = anim vertex texture
+1.0 = bone material 1.0 texture texture material -1
+anim
+texture frame 1.0 bone material anim texture frame vertex
+-1 vertex -1
+bone 1.0 anim anim
+= = material
+1.0
+0.500000 = anim
+bone = vertex
+frame texture 0.500000 -1 anim
+1.0 texture
+1.0 frame
+bone anim 1.0 vertex 1.0 vertex material
+1.0 0.500000 vertex frame bone texture =
+vertex frame vertex vertex
+frame
+frame 1.0
+-1 -1
+0.500000
+anim frame bone frame bone frame = texture
+material frame frame
+-1 = -1 1.0 material frame bone bone vertex material 0.500000
+-1
+frame
+frame anim -1 bone vertex =
+vertex frame frame
+vertex
+material vertex anim
+vertex -1
+= bone texture = vertex anim material -1 anim
+anim -1 1.0
+0.500000
+= texture vertex
+vertex vertex
+0.500000 1.0 vertex
+material
+0.500000 =
+-1 anim
+anim vertex bone 0.500000 bone 1.0 material -1
+= material = material
+vertex
+-1
+1.0 bone anim
+vertex bone
+bone texture vertex bone
+bone material texture
+-1 frame
+0.500000
+anim anim = =
+1.0
+0.500000 vertex anim 1.0 frame frame 1.0 bone texture
+vertex material -1 frame
+vertex
+texture = anim
+bone bone = -1
+1.0
+vertex bone
+vertex
+texture = 1.0
+frame -1 bone bone
+material texture vertex anim 1.0 = = material 1.0 bone 0.500000 frame
+anim texture 1.0
+material
+bone = vertex 0.500000
+bone = frame -1
+vertex vertex =
+texture texture bone bone
+bone 0.500000
+1.0
+bone
+frame anim material material bone vertex
+0.500000
+material 1.0 bone
+vertex frame = vertex
+frame anim material texture 1.0 1.0 frame -1 texture frame bone 1.0 0.500000 material = material 1.0
+bone material bone
+-1
+texture -1 frame
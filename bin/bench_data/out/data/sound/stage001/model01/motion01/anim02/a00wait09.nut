@@ -0,0 +1,2 @@
+^w,[V}Pqm˵',9STP;\g=K*~>ybgm&dZ!ٙ)˔o6B`	;X5X._^T1xt{
++3j*Lo"1
\ No newline at end of file
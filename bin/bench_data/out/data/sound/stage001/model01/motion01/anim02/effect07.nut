@@ -0,0 +1,70 @@
+vertex -1 vertex
+= frame anim
+1.0 anim anim
+= vertex = frame frame
+bone material texture =
+vertex frame
+vertex anim
+material
+1.0 texture texture vertex bone bone 0.500000 texture bone vertex 0.500000 1.0 -1 bone =
+= material frame bone bone bone vertex vertex
+bone
+anim = = 0.500000 anim = anim
+anim = 1.0 0.500000
+frame vertex 1.0 frame frame
+= 1.0
+0.500000 anim 0.500000 vertex 0.500000 = material =
+frame -1 vertex 1.0
+frame texture
+vertex
+-1 frame 0.500000 1.0
+anim material
+material frame
+vertex 1.0 0.500000 frame 0.500000 0.500000 -1 1.0 1.0
+-1
+=
+material anim vertex frame texture anim 0.500000 1.0 bone -1 1.0 texture
+-1 material anim texture =
+texture
+= vertex
+0.500000 texture vertex bone frame = texture bone bone anim
+bone
+anim 1.0
+1.0 vertex =
+=
+material
+bone 1.0 1.0
+frame bone 1.0 bone texture =
+vertex bone material vertex bone material 1.0 = anim -1 frame = vertex 1.0 0.500000 = frame anim anim -1 texture 1.0 bone material anim 0.500000 frame vertex frame anim -1 0.500000 frame
+anim bone
+1.0 vertex
+=
+1.0 0.500000 texture material
+= -1 vertex 1.0 1.0 = texture
+material
+-1 vertex anim frame vertex
+-1
+texture material 1.0 vertex -1 material -1 1.0
+texture frame vertex vertex
+frame material texture texture = bone bone bone
+vertex
+texture
+material anim -1 -1 = frame texture
+=
+frame
+vertex frame vertex
+anim vertex -1 anim material =
+bone texture
+texture
+1.0
+-1 1.0
+frame
+anim frame = frame
+1.0 = texture anim texture 0.500000 anim 1.0 =
+anim vertex vertex material 1.0 -1 0.500000 bone -1
+=
+vertex
+texture
+0.500000 anim anim bone
+material texture
+1.0 0.
\ No newline at end of file
@@ -0,0 +1,34 @@
+frame material
+anim = vertex anim anim -1 anim
+anim anim 0.500000
+frame
+texture
+material -1
+-1 -1
+material = -1 -1
+material vertex
+1.0 anim bone vertex -1 vertex frame
+vertex 0.500000 material
+0.500000
+0.500000 anim 0.500000 anim
+= 1.0
+anim
+frame 1.0 anim
+= 1.0 0.500000
+bone -1
+anim = bone
+1.0 =
+texture
+bone vertex 1.0 frame texture 1.0
+bone -1 = -1 anim
+frame
+anim frame
+1.0
+vertex material 0.500000 anim vertex 0.500000 material vertex frame material
+bone
+material 0.500000 -1 1.0 1.0 1.0 -1 texture 1.0 =
+anim anim
+= texture = = vertex bone
+1.0 anim
+bone = vertex -1
+= material anim frame anim 1.0 materia
\ No newline at end of file
@@ -0,0 +1,293 @@
+vertex bone anim -1 vertex 0.500000 = anim
+texture vertex
+1.0
+frame bone =
+anim 1.0 vertex bone
+vertex
+1.0 1.0 frame vertex 1.0
+material = = material frame material anim vertex 1.0 0.500000 frame anim vertex
+material = -1 frame texture frame vertex frame vertex bone bone 1.0 = vertex 0.500000 bone 1.0 material = frame
+texture 1.0
+= -1 texture
+0.500000 1.0
+1.0 bone
+anim -1 =
+vertex 1.0 -1 =
+anim
+1.0 anim bone
+anim frame vertex 0.500000 1.0 0.500000
+frame frame = 1.0
+anim material
+-1
+anim bone material anim = -1 frame 0.500000 0.500000 1.0
+-1
+-1
+vertex = anim
+bone texture
+texture
+anim anim
+= =
+1.0
+material
+bone vertex
+-1
+-1 -1 anim texture 0.500000 anim bone bone
+texture -1 1.0 = bone =
+bone material -1 frame -1
+1.0
+-1 =
+0.500000
+1.0
+vertex texture vertex
+= material = 0.500000
+texture 1.0 vertex
+material 0.500000 frame anim
+1.0 texture vertex
+texture
+1.0
+= texture
+anim texture
+texture
+1.0 bone
+frame 1.0 texture texture = texture
+bone
+anim anim
+anim texture anim
+=
+material vertex 0.500000
+texture bone
+frame 0.500000
+anim texture
+0.500000 0.500000
+0.500000
+= = anim anim frame 0.500000
+0.500000 0.500000 = 1.0 texture 1.0 -1 = -1
+bone -1 material -1
+vertex 1.0 bone
+texture 0.500000
+= vertex material = = frame texture
+frame =
+texture texture frame
+anim 0.500000 0.500000 vertex -1 1.0 0.500000
+texture
+anim =
+= frame bone vertex -1 0.500000
+1.0
+texture bone anim frame bone
+texture texture 1.0 anim
+-1 frame texture material bone
+texture
+anim 0.500000 texture
+-1
+vertex
+frame = anim texture bone 0.500000
+texture vertex frame
+= frame anim = = vertex
+1.0 vertex
+1.0 -1 material material
+bone bone
+= bone vertex frame 1.0
+vertex -1 1.0 0.500000 anim = frame
+material texture
+bone
+1.0
+anim
+1.0
+texture texture
+bone = vertex
+= = bone texture 0.500000 texture bone
+material material -1 frame
+vertex texture
+= material = 1.0 = = material
+-1 =
+material texture 1.0 0.500000 bone
+material
+bone = = -1 0.500000
+material
+= = texture
+1.0 anim texture vertex
+anim material texture 0.500000 1.0 0.500000 texture frame material -1 = = -1
+material anim bone 0.500000
+vertex material
+0.500000 vertex material
+texture
+texture bone texture 0.500000 texture anim = -1 0.500000
+= -1
+bone 0.500000
+frame vertex 0.500000 =
+1.0 material =
+texture anim texture material -1 vertex
+material 1.0 -1
+-1 vertex bone
+-1 material vertex anim
+-1 texture -1 vertex 0.500000 0.500000 =
+vertex bone
+0.500000 material 0.500000 vertex vertex bone texture vertex 0.500000
+material
+1.0 material frame
+texture = =
+-1 =
+texture bone anim = anim 1.0 anim -1
+frame 0.500000
+bone vertex 0.500000 frame vertex material bone
+bone 1.0
+=
+0.500000 vertex
+bone vertex
+material
+vertex 0.500000 0.500000 -1 bone anim 0.500000 0.500000
+=
+vertex bone =
+vertex = material material
+1.0 frame frame frame
+bone
+0.500000 bone -1 bone
+frame material frame bone anim = = texture texture = -1 bone 1.0 anim texture 0.500000
+=
+bone
+anim 0.500000 =
+=
+material 1.0 -1
+vertex 1.0 anim anim frame vertex texture texture anim = 1.0
+texture
+texture 1.0 =
+anim vertex 0.500000 1.0 texture anim vertex
+1.0 =
+frame vertex
+-1 anim texture anim frame frame texture anim
+vertex -1 frame = bone texture -1 bone
+= vertex anim
+texture vertex
+material 1.0
+texture = frame 1.0
+material
+frame 0.500000 frame -1 frame texture
+vertex bone bone material anim bone material = 1.0 1.0 0.500000
+0.500000 -1 bone
+-1 frame = 1.0 bone 0.500000 frame -1 bone -1 0.500000 texture texture vertex
+1.0 frame -1 vertex 0.500000 0.500000 0.500000 frame 0.500000 1.0 material
+material
+1.0 = 1.0 0.500000 = -1 bone anim
+-1 bone
+material anim anim
+bone = = = -1 0.500000
+= frame
+frame 0.500000
+= 0.500000 bone frame -1
+bone anim
+vertex texture texture = frame texture anim
+anim anim =
+= 1.0
+frame
+material
+texture material 0.500000 frame bone
+anim bone material bone
+bone -1
+= 0.500000 frame texture = -1 vertex 0.500000 anim
+bone = 1.0
+anim 0.500000 vertex frame vertex
+anim frame vertex vertex frame bone texture anim anim = bone = 1.0 -1 texture 1.0 frame 0.500000 bone material frame
+material vertex vertex = anim 0.500000 frame 1.0 0.500000 1.0 0.500000 bone vertex frame bone = vertex 0.500000 texture texture 1.0 0.500000 -1 frame 1.0 vertex
+0.500000 -1 vertex bone anim bone vertex 1.0 vertex material frame -1
+vertex
+anim texture texture material
+anim
+texture -1
+material texture bone material
+= 0.500000 anim 1.0 vertex frame -1 material texture 1.0
+-1
+vertex bone =
+anim 1.0 material texture = texture frame material
+texture material anim
+frame
+0.500000 frame 0.500000
+vertex frame
+vertex 1.0
+= 0.500000 vertex anim 1.0 = texture
+1.0 -1
+=
+vertex 1.0 frame
+vertex texture =
+vertex -1
+1.0 -1 texture
+frame material material 1.0 0.500000 anim anim 1.0 -1 = anim =
+texture
+vertex material vertex bone
+bone vertex -1 -1
+material 0.500000 = =
+anim
+vertex 1.0 frame
+vertex frame
+bone -1
+= anim texture
+frame material
+bone
+-1 0.500000 frame vertex bone 1.0 bone 1.0 = -1
+-1 bone anim frame anim
+bone
+anim texture material frame frame 0.500000
+= 0.500000 vertex material = texture texture material
+= anim = vertex frame
+= bone
+frame
+vertex material
+anim material
+vertex
+0.500000
+bone
+frame 1.0 = vertex
+frame -1 material 1.0 =
+texture bone
+texture texture frame frame material anim anim vertex
+0.500000 texture
+-1
+1.0 texture anim texture texture
+0.500000 1.0
+= texture
+bone bone bone 1.0 0.500000
+anim = 0.500000 vertex anim
+vertex anim anim anim =
+frame -1 =
+bone vertex -1
+0.500000 bone bone =
+bone bone =
+=
+=
+frame texture texture
+= texture bone frame vertex material vertex 1.0 -1
+texture material texture = material vertex 0.500000
+0.500000 1.0
+material
+=
+material texture 1.0 1.0 texture -1
+frame bone -1 material bone frame -1 material frame material
+1.0 -1 -1 frame vertex -1 material bone frame
+texture frame material =
+texture
+anim
+bone anim bone vertex material vertex frame
+= texture bone frame =
+0.500000 texture -1
+-1 frame texture =
+0.500000
+1.0 bone bone material = frame material = texture
+bone =
+0.500000 = vertex = material frame bone frame -1 texture 0.500000
+bone -1 = material bone
+bone material bone =
+anim 1.0 material
+anim 1.0
+material texture 1.0
+vertex material material 1.0 material
+anim material
+bone
+anim bone anim bone anim vertex material = material
+material 0.500000
+frame material = 1.0 1.0 -1 material material -1 -1
+material
+anim anim frame 0.500000 material bone
+0.500000 material
+material = 1.0 frame bone
+texture = frame bone material
+frame texture anim bone bone anim 1.0 frame
+bone material material texture -1 texture bone tex
\ No newline at end of file
@@ -0,0 +1,187 @@
+1.0 material 1.0 frame frame vertex = vertex
+1.0 =
+vertex
+1.0 frame
+0.500000 vertex bone
+texture texture material 1.0 frame vertex 0.500000
+0.500000 material frame vertex
+-1 anim
+vertex bone anim 1.0 anim bone bone
+0.500000 bone vertex material 0.500000 bone
+-1
+0.500000
+0.500000 texture
+bone texture
+0.500000
+material
+material = = bone = texture material anim material 1.0 = vertex 1.0 vertex
+1.0 -1 -1 -1 1.0 material vertex
+vertex bone = 1.0 material material -1
+1.0 vertex texture = bone
+-1 = bone 0.500000 frame 1.0
+frame vertex anim vertex anim texture vertex 1.0 material frame 0.500000
+texture = material vertex
+-1 -1 texture 1.0 1.0 0.500000
+texture
+vertex texture
+0.500000
+1.0 anim -1 = vertex
+= anim
+0.500000 0.500000
+1.0 -1 texture texture material = frame 1.0 0.500000
+-1 0.500000 bone
+material bone bone vertex
+frame 0.500000
+frame anim bone frame
+frame
+= bone bone texture frame material vertex bone anim 0.500000
+material anim = frame -1 material bone vertex
+0.500000 0.500000 material
+-1 1.0 -1
+vertex 0.500000 = 0.500000 = -1 frame -1
+1.0 vertex 0.500000 anim anim anim
+0.500000 1.0 vertex
+vertex 0.500000
+frame vertex
+= = 0.500000 bone
+-1 0.500000 texture
+= frame 0.500000
+0.500000 vertex =
+frame frame 0.500000 anim frame material material vertex
+0.500000 material
+texture
+frame -1 material -1 1.0 frame = bone
+-1 vertex texture frame 0.500000 material anim anim anim texture
+1.0 texture =
+material
+1.0 vertex bone 1.0 vertex -1
+0.500000 0.500000 material bone frame bone bone 0.500000
+frame -1
+1.0 1.0 bone anim
+= frame anim texture -1 bone
+vertex 1.0
+bone frame 0.500000 0.500000 = -1 material
+material
+texture 0.500000
+0.500000 1.0 -1 bone -1 -1 texture texture vertex
+material material 0.500000 vertex frame 0.500000 anim bone -1 bone anim material frame 0.500000 frame 1.0 anim bone frame
+-1 -1 texture vertex
+1.0 frame vertex -1 -1 frame 1.0 texture -1 vertex
+-1 material texture material frame
+= 1.0 vertex
+-1
+-1 0.500000 0.500000 anim
+0.500000 0.500000 bone = texture -1
+vertex frame 1.0 texture 0.500000
+1.0 = = -1 material vertex texture material = 0.500000
+-1 = material -1 = texture bone
+texture
+1.0 bone vertex -1 = anim anim bone material -1 frame
+0.500000
+bone 0.500000 vertex texture 0.500000 0.500000 -1 texture 1.0 1.0
+-1 bone bone
+vertex
+texture frame = texture 1.0 material bone 1.0 0.500000 frame texture material texture
+0.500000 texture 0.500000 material
+= 1.0 -1 = texture bone bone
+bone texture frame
+bone 1.0 anim anim material bone frame
+material frame texture
+-1
+0.500000 frame anim =
+1.0 1.0 texture frame
+= frame anim
+vertex bone 1.0
+frame
+material = vertex
+anim
+material material anim frame
+vertex frame
+-1 bone vertex 1.0
+texture
+frame
+frame anim =
+material
+frame 1.0 -1 =
+vertex material bone
+1.0 texture frame 0.500000 frame frame 1.0 0.500000 -1 frame
+bone 1.0
+-1 1.0 bone -1
+bone
+frame bone anim =
+material 0.500000 bone =
+texture frame texture vertex =
+texture =
+0.500000 frame -1 -1
+vertex
+= bone 0.500000 vertex material 1.0 =
+=
+bone vertex
+0.500000 frame -1 1.0 bone
+vertex
+material -1 0.500000 0.500000
+anim vertex texture 1.0
+bone vertex 1.0 vertex anim
+bone = texture
+texture bone 1.0 0.500000 1.0
+texture vertex = bone vertex 0.500000 bone texture
+0.500000 bone
+=
+1.0
+vertex
+bone
+-1 =
+vertex material 0.500000 bone texture anim anim 1.0 1.0 texture anim bone bone
+bone anim
+material 1.0 bone
+texture -1
+-1
+= 0.500000 -1 -1 -1 anim frame bone
+material
+0.500000 texture
+1.0 =
+bone 1.0
+bone 0.500000 frame vertex texture vertex frame anim
+0.500000 1.0 = vertex material -1 frame
+anim texture
+frame 1.0 0.500000 material -1 bone 0.500000 vertex material
+0.500000 -1 -1 bone -1 1.0 1.0 texture bone 0.500000
+=
+frame
+vertex -1
+vertex bone material
+frame -1 1.0 anim 1.0 anim frame -1
+frame 1.0
+= frame texture vertex frame = bone texture texture anim
+anim anim vertex
+material frame
+vertex frame 0.500000
+1.0 bone texture frame = = material vertex texture material frame 1.0 -1 -1 0.500000 material -1 bone texture anim 0.500000 material vertex
+material = -1 = vertex 1.0
+-1 vertex material
+material frame texture anim bone material
+material texture
+0.500000 1.0 texture -1 texture bone 1.0 1.0 0.500000 -1 =
+material 1.0 0.500000 bone = -1 bone
+frame -1
+frame =
+1.0 0.500000 frame
+anim 0.500000
+bone -1 anim material vertex material material = -1
+frame
+bone texture frame
+anim 0.500000 anim
+bone
+vertex = 1.0 = 1.0 1.0 bone
+1.0
+1.0
+1.0 frame material anim anim anim bone bone =
+= vertex = material vertex =
+anim
+texture vertex bone = material frame vertex frame
+bone
+-1 vertex = bone frame
+texture 1.0 1.0 material
+0.500000 0.500000 -1
+0.500000 vertex -1 material 0.500000 bone material anim material material bone bone vertex 0.500000
+= texture frame material -1 material 0.500000 0.500000 1.0 materia
\ No newline at end of file
@@ -0,0 +1,59 @@
+0.500000 1.0 = bone -1 -1 1.0 0.500000 texture anim
+frame
+=
+material texture
+bone
+1.0 material 1.0
+bone 1.0 vertex 0.500000 bone anim
+=
+texture =
+vertex
+1.0 0.500000
+anim bone
+1.0 texture = anim vertex
+anim
+texture 0.500000 -1
+material
+texture 1.0 -1 material 0.500000 vertex -1 vertex texture 0.500000 1.0 1.0 = anim =
+frame texture -1 0.500000 vertex anim = material material
+texture bone 1.0
+anim anim 1.0
+material
+material 1.0
+anim texture vertex 0.500000 vertex -1 -1
+material
+material bone bone 0.500000 anim 1.0
+bone vertex texture
+0.500000 texture frame
+anim frame 0.500000 bone 1.0 bone -1 material anim 1.0 -1 -1 1.0 bone 1.0 texture
+material
+-1 -1 bone texture -1 material bone vertex frame texture 0.500000 = bone -1
+1.0 material
+0.500000 = texture frame
+material anim 0.500000 texture texture frame 1.0 material bone vertex texture texture bone -1 0.500000 bone anim vertex vertex = = 0.500000 0.500000 bone vertex vertex 0.500000
+material frame =
+anim -1
+texture
+-1
+material = 0.500000 material -1
+texture bone material anim =
+anim = vertex bone
+vertex
+=
+-1
+-1 1.0 -1 vertex 0.500000 anim
+anim
+0.500000 1.0 0.500000 frame vertex frame
+bone -1 0.500000 texture
+frame
+= 0.500000
+1.0 -1 anim texture texture bone = -1 -1
+material anim anim -1 0.500000 material 0.500000 -1
+frame texture
+anim 1.0
+frame 1.0
+vertex
+texture frame
+1.0 =
+texture 1.0 vertex bone bone 1.0
+vertex frame texture = 0.500000 vertex anim 0.500000 ma
\ No newline at end of file
@@ -0,0 +1,7 @@
+bone
+texture material 1.0 material 1.0 -1 = = texture 0.500000 texture vertex 1.0 anim
+texture 0.500000 -1
+vertex 1.0 0.500000 = bone 0.500000 material texture 1.0 vertex material =
+bone
+0.500000 vertex 1.0 bone anim material material anim
+1.0 1.0 anim bone = = 0.500000
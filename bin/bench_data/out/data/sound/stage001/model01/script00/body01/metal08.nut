@@ -0,0 +1,136 @@
+texture 0.500000 bone bone texture frame 1.0 anim vertex anim texture texture
+0.500000 bone material vertex bone
+vertex bone 0.500000 texture
+bone
+-1 material 0.500000
+= 1.0 = 0.500000 frame 0.500000
+texture
+vertex 1.0 1.0 bone
+frame
+1.0 material vertex anim
+1.0
+vertex bone 0.500000
+frame
+= vertex = frame =
+vertex 1.0 vertex frame -1 0.500000 0.500000
+bone
+bone frame frame material
+bone 1.0
+1.0 material 0.500000 texture
+texture frame frame texture -1 texture
+bone material bone anim bone
+frame
+vertex 1.0 0.500000 -1 = 1.0 anim
+-1 -1 anim 1.0 1.0 frame anim
+texture anim 1.0 bone =
+anim
+vertex anim
+frame material bone -1
+frame material
+material material
+0.500000
+= 1.0 = = 1.0
+1.0
+-1 0.500000 vertex material
+vertex -1 frame
+bone frame 0.500000 vertex
+0.500000 texture
+bone 1.0 frame
+frame -1 texture frame material vertex -1
+texture
+0.500000
+texture = 0.500000 1.0 = frame material
+1.0 texture vertex frame 0.500000
+1.0
+-1
+-1 vertex
+bone -1 material
+vertex bone
+frame
+frame vertex
+= = material
+0.500000 1.0 texture texture 1.0 frame -1 anim
+texture -1 0.500000 anim texture vertex frame material texture vertex
+-1 1.0 0.500000
+texture vertex =
+frame 0.500000 frame = bone bone
+material 1.0
+= vertex 0.500000
+0.500000 = material 0.500000 material
+0.500000 1.0 -1 = 1.0 vertex 1.0
+0.500000 1.0 material
+anim texture frame bone
+material -1
+bone 1.0 0.500000 0.500000
+= -1 0.500000 texture = vertex vertex -1 vertex
+1.0 texture = anim vertex -1
+-1
+-1 -1 bone texture bone
+anim 1.0
+vertex 1.0 0.500000 vertex
+-1 texture bone frame vertex vertex material frame 0.500000 -1
+1.0
+texture vertex
+material
+bone anim 0.500000
+0.500000 1.0 texture 1.0 texture 0.500000 0.500000 texture material anim bone bone
+0.500000
+frame
+1.0
+bone = -1
+-1 0.500000 texture frame material anim
+1.0
+vertex 1.0 vertex bone
+=
+vertex 0.500000 0.500000
+0.500000
+=
+= material
+anim -1
+vertex bone frame texture bone material 1.0
+anim -1 anim
+frame material
+bone texture bone 0.500000 anim = -1 texture
+0.500000 texture
+frame
+anim vertex vertex 0.500000 vertex texture = 0.500000
+anim
+material vertex vertex
+texture
+-1 material
+anim 1.0 vertex material frame material texture 0.500000
+frame -1
+bone material 1.0 vertex
+frame vertex frame vertex 0.500000 texture 1.0 -1 anim = anim frame anim
+= material 0.500000 1.0 bone vertex 0.500000 = anim 1.0 0.500000 -1
+0.500000 frame 0.500000 bone material
+material texture anim
+1.0
+bone -1
+material texture
+0.500000 material =
+bone
+= frame material
+= vertex
+material bone bone
+-1
+-1 vertex frame
+0.500000 texture frame
+0.500000 vertex
+= 0.500000 material
+frame vertex
+-1
+texture =
+texture
+1.0 bone
+-1 vertex -1 bone = bone vertex 1.0 material -1 0.500000 anim bone texture 1.0
+= 1.0 material
+-1 material anim -1 0.500000 = material frame frame = -1 =
+vertex vertex texture frame texture = 1.0 texture -1 bone -1 frame bone texture anim 0.500000 frame
+0.500000 anim bone =
+anim 1.0 -1 frame anim anim anim vertex vertex 1.0
+= -1
+anim
+1.0 vertex anim 1.0 bone = 0.500000 texture
+0.500000 -1
+anim material anim material 0.500000 frame = vertex bone -1 bone
\ No newline at end of file
@@ -0,0 +1,4 @@
+anim vertex anim 0.500000 1.0 vertex -1
+texture 1.0 1.0
+= -1 frame vertex material 0.500000 1.0 frame frame material anim 0.500000 anim texture
+1.0 anim bone texture texture material -1 anim -1 bone 0.50
\ No newline at end of file
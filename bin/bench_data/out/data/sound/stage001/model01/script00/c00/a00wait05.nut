@@ -0,0 +1,10 @@
+frame frame
+-1 1.0 bone frame vertex
+material anim
+frame
+0.500000 vertex anim vertex 1.0 material
+texture
+0.500000 bone bone 0.500000 material
+bone anim -1 texture texture
+frame bone frame vertex =
+1.0 -
\ No newline at end of file
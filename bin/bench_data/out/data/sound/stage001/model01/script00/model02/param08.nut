@@ -0,0 +1,2 @@
+= bone vertex anim
+-1 material = anim 
\ No newline at end of file
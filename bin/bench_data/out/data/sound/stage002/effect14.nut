@@ -0,0 +1,3 @@
+frame bone = frame
+-1 texture
+anim mat
\ No newline at end of file
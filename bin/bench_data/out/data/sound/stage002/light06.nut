@@ -0,0 +1,136 @@
+0.500000 bone anim frame
+material vertex frame 0.500000 anim frame frame
+0.500000 texture
+vertex anim texture 1.0
+= 1.0
+material
+-1 0.500000 texture bone 1.0 material vertex
+anim vertex texture = texture =
+texture material anim
+-1 anim texture
+frame
+-1
+= vertex
+texture
+0.500000 material
+= = material anim
+material material = frame
+= anim frame 0.500000 0.500000
+bone anim = anim -1 texture
+anim
+anim 0.500000
+frame 1.0 1.0 material material bone anim texture = vertex
+bone material texture bone bone vertex -1 texture vertex 1.0
+material -1 0.500000
+material
+0.500000 = texture 0.500000 0.500000 texture -1 0.500000 material
+-1 -1 vertex -1 vertex material bone
+material texture 0.500000 -1 1.0
+1.0
+vertex =
+=
+= 1.0 texture
+-1 material vertex
+bone 0.500000 vertex vertex 0.500000 vertex texture frame bone 0.500000
+-1 frame texture texture = bone
+anim -1
+anim
+bone frame anim 0.500000 0.500000 0.500000
+anim
+vertex vertex vertex
+=
+frame anim material frame frame bone vertex vertex 0.500000 texture anim 0.500000 anim 1.0 0.500000 1.0 = anim vertex bone
+1.0 texture material vertex anim = 0.500000 0.500000 bone frame
+= bone vertex = material 1.0 =
+= = texture texture
+vertex bone =
+= -1
+texture
+anim
+anim frame material -1 -1 = = =
+= anim
+= bone
+= frame = frame material 1.0 material
+= 0.500000 bone
+anim anim 0.500000
+anim frame frame texture texture 1.0 texture bone frame
+frame
+0.500000 = 0.500000 texture material bone 1.0 texture frame vertex vertex
+texture
+= 0.500000
+1.0
+material vertex texture -1 texture anim bone 0.500000 1.0 0.500000 frame bone
+anim 1.0 material material frame
+bone
+bone material
+= anim frame 0.500000 vertex 0.500000 vertex texture vertex texture -1 -1 bone
+= 0.500000 = material
+material
+-1 1.0 vertex
+=
+texture = anim vertex material 1.0 0.500000 texture bone anim texture material
+bone
+texture 1.0
+0.500000 anim
+frame anim material 1.0 = 0.500000
+1.0 bone -1 0.500000 texture -1 texture
+bone bone texture
+0.500000 texture frame 0.500000 = material material texture vertex material -1 -1 1.0
+texture = vertex vertex 0.500000
+1.0 texture vertex texture 1.0 bone vertex texture frame =
+bone
+anim
+0.500000 bone
+0.500000 -1
+frame
+frame 1.0 0.500000 =
+anim frame bone vertex material material
+anim texture
+frame 1.0 0.500000 anim anim 1.0 0.500000
+texture
+texture = material bone 1.0
+material material
+texture
+bone
+bone
+0.500000 vertex -1 bone 1.0
+vertex material -1 vertex
+texture material texture =
+bone
+anim = bone texture -1
+= vertex texture bone texture 1.0 -1 = material
+0.500000 -1
+1.0 = anim
+bone
+1.0 anim
+vertex
+1.0
+=
+1.0 0.500000
+texture frame bone vertex 1.0 frame -1 bone
+bone
+vertex 0.500000
+=
+bone bone frame
+= vertex frame texture texture anim vertex frame
+-1 bone
+anim
+0.500000
+anim
+bone frame 0.500000
+vertex frame vertex = 1.0 material anim bone -1 1.0
+0.500000
+= anim bone 0.500000
+vertex material -1 vertex vertex frame 1.0 material bone 1.0 material 1.0 anim
+texture frame frame
+vertex -1 = vertex vertex
+1.0 material frame
+material 0.500000 vertex bone texture texture 0.500000 texture anim material 0.500000 anim anim material anim
+texture texture = bone = material vertex = vertex texture
+frame
+0.500000
+frame
+anim material frame =
+= = 0.500000
+texture texture 0.500000 bone texture texture 1.0 material material texture material material anim frame 0.500000
+frame 1.0 texture anim material 0
\ No newline at end of file
@@ -0,0 +1,16 @@
+texture vertex frame 1.0 0.500000 bone texture 1.0 -1 vertex
+1.0
+frame
+1.0 material frame 1.0
+bone material material
+vertex
+1.0 anim
+0.500000 material frame bone 1.0 texture anim anim =
+vertex bone -1 -1 texture anim
+= 1.0 texture anim bone
+-1 frame bone
+0.500000 texture
+-1 texture material =
+1.0 bone =
+bone
+fra
\ No newline at end of file
@@ -0,0 +1,283 @@
+texture -1
+-1 material
+1.0
+0.500000 1.0 vertex anim 0.500000 frame
+-1 texture -1
+material
+= 1.0 anim bone 0.500000 anim material
+material
+material 0.500000 bone
+-1 anim
+1.0 bone bone
+= vertex bone frame material
+frame = frame
+frame -1 -1 anim
+= texture material = texture
+0.500000 frame 1.0 anim 1.0 bone
+0.500000 texture anim 1.0 frame
+anim 0.500000 frame
+texture 0.500000 1.0 1.0 0.500000
+vertex material 0.500000 bone anim
+material 0.500000 texture anim material anim
+anim = texture
+anim 0.500000
+texture bone texture frame -1
+-1 bone frame texture frame = vertex anim texture vertex frame texture texture 0.500000 1.0 vertex bone
+-1 vertex texture texture -1 1.0 frame bone 1.0 texture -1
+vertex frame -1
+material 0.500000 material -1 = vertex bone -1 1.0
+frame texture
+= 0.500000 texture material 0.500000
+0.500000 bone
+bone vertex vertex =
+= frame frame vertex texture anim frame
+texture
+anim
+-1 anim texture vertex
+1.0 material 1.0 frame anim anim bone bone
+texture -1 vertex 1.0 material texture frame
+-1 = 1.0
+anim 1.0 anim 0.500000 = material
+material 1.0 bone bone frame vertex
+bone
+anim bone
+material 0.500000
+anim 1.0 texture = material 0.500000 bone =
+= texture
+texture vertex texture bone vertex material
+1.0 0.500000 -1 -1 = texture vertex -1 -1
+anim frame anim
+texture texture
+texture
+frame
+0.500000
+material frame vertex 0.500000 material 0.500000 frame bone
+=
+-1
+frame = bone =
+=
+bone texture
+bone
+vertex 0.500000 frame anim = 0.500000 frame
+texture 0.500000 anim frame
+anim anim frame
+anim anim = material anim
+vertex = = vertex = texture material anim
+material texture vertex frame bone material bone
+=
+-1
+frame frame 0.500000
+bone anim vertex 0.500000 material 0.500000 0.500000 -1 texture
+vertex
+frame 1.0 0.500000
+texture
+vertex anim 0.500000 vertex anim bone bone -1 vertex =
+vertex vertex material = material frame texture 1.0 vertex
+bone 1.0
+material -1 1.0 vertex material bone -1 texture
+vertex frame material bone frame bone bone anim
+vertex
+anim = -1
+-1
+frame anim 1.0
+bone anim anim texture frame 0.500000 vertex anim -1 0.500000 frame vertex -1 0.500000 vertex
+material 0.500000
+vertex vertex = texture
+1.0 vertex anim 1.0 =
+bone anim
+frame texture texture 0.500000
+1.0 1.0
+-1 material
+vertex
+frame frame 0.500000 1.0 1.0 = anim
+frame
+1.0 bone vertex 0.500000 bone material bone = -1 anim 1.0 bone texture 0.500000 material -1
+=
+texture
+bone vertex vertex texture -1 bone 0.500000 texture
+vertex
+-1
+1.0
+material
+= bone 1.0
+texture
+texture texture anim
+1.0 1.0 frame anim -1 material = -1
+vertex bone -1
+material
+= anim 0.500000 -1 -1 anim 1.0 0.500000 material -1 bone
+0.500000 frame
+bone anim 1.0 1.0 anim
+material texture bone -1 material
+-1 bone material vertex
+texture material
+material -1
+frame material bone 0.500000 anim = = -1 material = frame
+vertex anim texture material
+bone texture 1.0 0.500000
+vertex 0.500000 bone 0.500000 texture
+bone bone texture frame material anim texture
+= anim 0.500000 bone texture vertex = material
+bone material material bone vertex vertex
+frame
+texture bone 0.500000
+frame 0.500000
+1.0 anim = frame bone
+-1
+bone texture vertex
+anim
+frame bone anim
+0.500000 anim
+bone texture bone bone -1 = vertex -1
+0.500000
+bone = 1.0 bone 0.500000 0.500000 -1 material anim texture = material texture 0.500000 bone anim vertex
+vertex 0.500000 texture 0.500000 0.500000 vertex
+= 0.500000 -1 texture 0.500000
+vertex 0.500000
+1.0 texture
+vertex -1
+vertex -1
+vertex
+1.0 material = 1.0 frame texture -1 1.0 anim frame bone bone bone 1.0
+vertex = bone 1.0
+vertex texture anim frame vertex 0.500000 -1 1.0 material
+texture = material 1.0 -1 texture anim anim frame =
+vertex 1.0
+anim
+0.500000 -1
+frame frame
+= 0.500000 material frame
+0.500000 anim
+0.500000
+=
+=
+bone -1 material
+= -1 1.0
+vertex material
+0.500000 material vertex
+anim = -1 frame material vertex 1.0
+texture anim bone
+anim texture
+material
+bone bone bone bone vertex
+vertex material -1 anim 1.0
+= material material bone frame
+bone -1 -1 = texture frame
+vertex 1.0
+0.500000
+material material anim -1
+material
+0.500000 0.500000 -1 0.500000 bone vertex frame 0.500000 anim texture 1.0 0.500000 frame
+=
+vertex texture = 0.500000 material = texture = bone anim
+=
+vertex -1 1.0 = bone
+anim
+-1
+1.0 vertex = frame bone 1.0 0.500000 material material
+anim
+anim material 1.0 = anim bone texture 1.0 0.500000
+vertex vertex -1 bone 0.500000
+vertex -1 vertex 1.0 1.0
+-1 1.0 = anim = 1.0 vertex -1 = bone material bone anim frame 0.500000 bone
+bone texture -1 bone -1 material = vertex texture
+vertex
+=
+1.0
+1.0 = =
+= material texture = texture material frame material texture -1 bone vertex 0.500000 frame = vertex = -1
+1.0 vertex vertex = 0.500000 1.0 material
+texture anim 0.500000 = bone = 0.500000 0.500000 0.500000 texture texture
+1.0
+bone frame texture anim texture 1.0 0.500000 bone =
+texture -1
+-1 -1 frame
+= -1
+vertex
+material -1
+= material bone 1.0 texture frame frame frame vertex -1 = frame
+vertex anim vertex = -1 texture vertex vertex 0.500000 0.500000 1.0
+bone = material
+frame texture -1 vertex 0.500000 -1 = 0.500000 material vertex
+0.500000
+1.0
+vertex 0.500000
+0.500000 = bone 0.500000
+1.0 texture bone bone
+1.0
+texture 0.500000 0.500000 -1 anim bone anim texture anim 0.500000 -1
+texture -1 0.500000 anim 1.0 bone frame
+bone frame
+=
+material 1.0
+-1 1.0
+vertex
+vertex texture 0.500000 1.0 anim texture = frame
+material -1
+-1
+frame 1.0 = anim 1.0 1.0
+=
+1.0
+bone material anim texture
+= texture bone texture
+anim 0.500000 frame 0.500000 frame
+material material material bone 1.0
+texture bone anim frame = vertex -1 -1 -1 0.500000 texture
+0.500000 0.500000
+texture bone 1.0 texture
+bone material bone bone anim 1.0 -1 frame bone vertex texture
+0.500000 vertex
+material
+-1 material material
+vertex 1.0 bone 0.500000 material
+1.0 material 1.0
+material -1
+texture anim -1 anim material 1.0
+material frame
+texture
+vertex material = bone
+bone texture -1 vertex 0.500000 -1 material
+vertex anim vertex
+anim bone material
+material bone 1.0 -1 1.0
+-1
+material vertex bone = frame material vertex = texture bone vertex texture texture -1 material anim bone
+0.500000 texture 0.500000 frame texture vertex = = 1.0 bone anim material
+anim material frame 0.500000
+material 1.0 1.0
+bone
+bone texture anim = vertex material
+vertex = vertex -1 -1 -1
+frame texture vertex 1.0 vertex
+0.500000 vertex 0.500000 vertex 0.500000
+0.500000 texture 1.0 -1
+= 1.0
+= -1 frame
+anim material -1
+-1 = 1.0 -1 anim -1 1.0 texture
+0.500000 vertex bone material anim 0.500000 material material anim
+anim bone 0.500000 0.500000 texture texture anim
+= vertex
+1.0
+= =
+1.0
+frame
+texture
+0.500000 = 1.0 0.500000 1.0 material -1 frame
+bone 1.0 bone 0.500000 texture
+1.0 0.500000 0.500000 material
+-1 material anim anim 1.0 bone frame
+anim 1.0 texture bone anim = vertex
+texture vertex anim frame texture
+= -1 material 0.500000 0.500000
+frame material
+vertex =
+material
+material anim anim
+frame texture anim bone bone anim frame -1 vertex -1 -1
+0.500000 texture = texture anim
+material texture
+0.500000 frame
+1.0
+vertex bone
+frame 0.5
\ No newline at end of file
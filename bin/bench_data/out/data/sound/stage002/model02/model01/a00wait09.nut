@@ -0,0 +1,86 @@
+1.0 anim frame texture material
+1.0 1.0
+frame 1.0 bone texture = material = = vertex
+0.500000 vertex
+= texture frame bone anim = = -1 1.0 texture -1 bone frame = = texture 1.0 frame texture bone material
+1.0
+-1 -1
+0.500000 texture
+vertex texture = 1.0 bone texture = frame anim anim vertex texture 0.500000 0.500000 vertex frame vertex -1 texture texture
+texture material frame
+vertex 0.500000
+-1 -1 1.0
+vertex texture vertex 1.0 1.0 = texture = anim 0.500000 bone
+bone frame =
+frame texture
+texture anim anim 1.0 0.500000
+0.500000 vertex 0.500000
+0.500000 vertex material bone 0.500000 1.0
+material material 1.0 bone
+=
+bone frame material material =
+texture texture -1
+frame texture material 0.500000 frame material frame vertex 0.500000
+1.0 -1 1.0
+bone anim anim bone -1 texture material 1.0 vertex
+frame texture
+anim -1 =
+texture vertex -1 material texture 1.0 frame
+-1
+vertex -1 frame
+bone 0.500000 -1
+vertex bone -1 texture anim
+texture bone 0.500000 vertex frame texture
+anim
+-1
+0.500000 material
+-1 anim anim 1.0 anim vertex -1
+material bone
+-1 frame 1.0 anim anim
+0.500000 0.500000
+anim
+bone bone 1.0 = vertex texture =
+-1 material 0.500000 anim
+= frame bone material = 0.500000 bone anim 0.500000 = 1.0
+0.500000 material anim texture
+bone vertex 0.500000
+texture -1 vertex texture
+0.500000 bone 1.0
+-1
+anim 0.500000 frame 0.500000 material
+1.0
+texture vertex anim =
+frame frame
+frame bone vertex
+-1 frame 0.500000 texture
+-1 bone
+0.500000 texture vertex material frame texture
+=
+texture
+texture frame vertex 1.0 anim = 0.500000 material = material
+anim = 1.0
+bone =
+-1 bone material bone
+-1
+frame texture material material texture vertex bone anim =
+vertex frame anim texture
+1.0 vertex vertex
+0.500000 texture
+0.500000 0.500000 bone
+bone vertex -1 bone material 1.0 bone 1.0
+material bone
+=
+material = texture
+frame -1 bone -1 1.0 = vertex -1
+material -1 material
+vertex 0.500000
+-1 texture = -1
+= frame texture bone
+material -1 =
+material
+anim -1 anim frame 1.0 vertex 1.0 0.500000 frame anim
+-1 frame 1.0 1.0 anim =
+0.500000
+-1 0.500000 anim material = 1.0
+-1 material bone
+frame vertex texture frame vertex 1.0 vertex -1 mater
\ No newline at end of file
@@ -0,0 +1,3 @@
+= = =
+1.0 1.0
+-1 bone frame texture 1.0 texture verte
\ No newline at end of file
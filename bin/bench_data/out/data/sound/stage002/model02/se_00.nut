@@ -0,0 +1,56 @@
+frame material
+vertex material vertex material
+=
+anim material 1.0
+-1 = vertex bone
+bone -1
+vertex anim
+frame -1 frame 1.0
+1.0
+frame
+-1 texture anim
+bone bone -1 vertex material anim texture material -1
+texture
+1.0 frame -1 bone =
+bone
+texture -1 0.500000 -1
+bone
+vertex
+material texture
+= material vertex anim
+bone vertex
+vertex material frame bone
+1.0
+anim anim
+-1 anim
+-1 material =
+vertex texture -1
+texture -1 1.0 frame 0.500000 -1 = = -1 -1 vertex 1.0 frame
+1.0 1.0 0.500000
+vertex texture material frame vertex
+bone -1 vertex texture frame -1
+0.500000 0.500000
+texture
+= frame
+material = 0.500000 1.0 frame 0.500000 = = -1 0.500000
+texture texture anim frame = frame 0.500000 texture frame
+bone 0.500000
+anim material
+material
+frame = material
+-1 anim vertex anim 0.500000 0.500000 vertex
+material 1.0 -1 vertex vertex
+vertex
+anim material
+material 1.0 1.0 -1 anim =
+= bone -1 texture frame
+vertex = -1
+texture frame 1.0 frame
+-1 bone = anim
+frame 0.500000 material 1.0 -1 bone
+frame
+0.500000 0.500000
+bone frame
+-1 -1 0.500000
+bone
+vertex bo
\ No newline at end of file
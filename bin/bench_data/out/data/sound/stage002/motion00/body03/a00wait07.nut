@@ -0,0 +1,37 @@
+material texture
+vertex
+material texture vertex vertex =
+= =
+frame 0.500000 texture -1 bone
+anim
+= = = frame bone
+-1 bone frame texture anim 0.500000 =
+material anim =
+texture anim anim material 1.0 vertex texture
+texture frame
+1.0 texture -1 0.500000 material -1 frame 0.500000 1.0 1.0 bone = bone 0.500000 material bone vertex material frame texture bone frame
+frame -1 material 1.0 1.0
+bone = 1.0 anim
+bone texture anim
+=
+1.0 texture frame -1 -1 bone frame material texture bone
+texture texture 0.500000 material 0.500000 anim
+0.500000 anim bone
+vertex = frame bone material 0.500000 -1
+anim
+-1 vertex
+0.500000 1.0 anim
+1.0 bone
+-1 = vertex vertex = -1 -1 -1
+frame
+= -1 1.0
+bone bone 0.500000 0.500000
+vertex bone 1.0 0.500000 bone vertex 1.0 0.500000 = anim anim
+=
+bone = 0.500000 = vertex = material 1.0
+-1 texture anim vertex frame material frame
+texture
+=
+1.0 texture
+1.0 frame bone = 0.500000 -1 -1 bone anim material -1
+a
\ No newline at end of file
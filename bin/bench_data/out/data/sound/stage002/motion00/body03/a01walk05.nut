@@ -0,0 +1,4 @@
+texture 1.0 texture
+-1
+= bone 1.0 frame = texture
+=
\ No newline at end of file
@@ -0,0 +1,105 @@
+frame
+vertex -1 material texture frame 0.500000
+0.500000 bone
+vertex = frame
+material frame
+frame vertex texture -1 anim =
+material frame -1
+-1
+-1 -1 vertex material
+= =
+1.0
+material
+bone = texture vertex = 1.0 1.0
+vertex 0.500000 1.0 vertex texture material = = 1.0 vertex
+0.500000 material
+1.0 0.500000 material
+1.0 material texture bone
+0.500000 0.500000 =
+vertex vertex
+vertex 0.500000 texture 1.0
+texture
+1.0
+0.500000 vertex -1 texture vertex vertex =
+-1
+0.500000 frame texture
+vertex
+= -1
+= bone
+material
+0.500000 vertex anim -1
+anim texture vertex 1.0 anim
+vertex material vertex anim material texture = 0.500000 vertex frame
+0.500000 bone = 1.0 material anim material bone texture bone material frame
+frame vertex bone texture vertex bone =
+texture
+frame
+-1 1.0
+1.0 0.500000 = = material
+= material anim
+0.500000 anim
+anim material
+1.0
+0.500000 vertex 1.0 anim
+anim
+-1 anim bone
+0.500000
+anim anim frame -1
+vertex frame 1.0 anim anim
+= material
+-1
+texture vertex
+texture vertex 1.0 1.0 material -1 vertex
+-1 texture anim frame =
+bone texture texture
+frame anim vertex 1.0
+material
+0.500000 0.500000 texture frame texture = material -1 -1 bone -1 0.500000 = material 0.500000 0.500000 1.0 material vertex
+vertex anim anim anim 1.0 vertex
+0.500000
+bone anim 1.0 bone material
+texture 0.500000 material
+vertex
+=
+= = anim bone
+bone vertex material 1.0 bone 1.0
+vertex
+1.0 vertex texture -1 0.500000 -1 bone bone
+1.0 =
+-1
+anim anim material bone
+anim
+anim anim
+frame anim 0.500000 bone vertex material 0.500000 texture 0.500000 0.500000
+material 0.500000 material 1.0
+material material texture 1.0 anim
+-1 texture 1.0
+material 1.0 -1 vertex frame
+1.0 0.500000
+0.500000 anim
+1.0 -1 anim =
+frame
+0.500000 material frame 0.500000 -1 1.0 anim anim = material
+0.500000 frame
+bone anim
+0.500000 material anim
+material vertex anim 1.0 0.500000 bone = = 1.0 0.500000 anim vertex texture = vertex bone anim
+0.500000 frame
+=
+material material
+vertex 1.0 bone bone
+= 1.0 anim vertex vertex
+-1 0.500000 material
+texture 0.500000 material 0.500000
+anim
+texture
+-1 0.500000 0.500000 = -1 material 1.0 = vertex vertex 0.500000 vertex anim
+frame
+1.0 0.500000 vertex anim -1 -1 vertex vertex texture
+-1 0.500000 1.0 bone 1.0 -1 anim bone
+0.500000 frame
+frame 0.500000
+1.0 -1
+-1 frame
+material = vertex anim
+0.500000 1.0 1.0 tex
\ No newline at end of file
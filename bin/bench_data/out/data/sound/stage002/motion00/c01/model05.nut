@@ -0,0 +1,7 @@
+$hBS􎙦"DqH2#Y|onIqZ}3`F:o<,0ynKD5C`p(*|׫m\7-_z]%v?ؼ~ogAcаQYlJ6qg(tD]=NwQG`9bP\3#]K%=f0'2)~Cw2+
+UD
+,G-BNɿLnM$SSU2h!Ѧo&T5Tz+{g,["t4On!k>SNQ1}\u(a]Q!,fqG1IcqHFFQb;߿95)@ct߾IjhGx&߰GVܳ%oG'&wޏqv/J|f̶K5¦
+ʁPH5f9<
+)C	j!$.W
+$y9؀JVHS¹j?
+B*:]	 EGPq9!ΔqBmiΆ1<C48#VW]}rrZǻfD)mƻ*߆$0_(x~e_)a&D}ϝ.gNP>L۳Z7|-LP3k_ˡ'*E԰Zy:;#Gqw0Y qU
\ No newline at end of file
@@ -0,0 +1,27 @@
+bone vertex texture -1 material anim texture 1.0 texture 1.0 0.500000
+texture texture
+1.0
+anim 0.500000 vertex bone
+-1 -1
+vertex
+-1 -1 -1 0.500000 1.0
+-1
+=
+anim anim anim 1.0 bone
+material = -1 1.0 texture bone anim
+bone bone -1 -1 texture
+= -1 material
+frame frame
+-1
+frame = = material material 0.500000 = 1.0 0.500000
+=
+0.500000 1.0
+= vertex -1 frame texture texture texture
+material -1 texture 0.500000 bone
+1.0
+1.0
+-1 material material
+0.500000 = bone -1
+-1 0.500000
+vertex 0.500000 vertex
+0.500000 0.500000 mat
\ No newline at end of file
@@ -0,0 +1,78 @@
+material frame material anim texture anim
+anim frame -1
+frame
+1.0
+frame
+= 0.500000 bone -1
+-1
+texture 0.500000 = anim
+bone bone
+vertex anim
+anim -1
+anim bone frame
+texture texture frame anim -1
+1.0 bone
+-1 bone =
+-1 = 1.0 frame
+vertex material vertex anim vertex frame =
+0.500000 frame -1
+texture
+frame
+texture 0.500000
+frame anim 0.500000 0.500000
+anim
+vertex = -1 1.0 material anim texture texture 0.500000 anim -1 bone material 1.0 -1
+0.500000 = = vertex 0.500000 -1 1.0 -1 anim = texture 1.0
+vertex 0.500000 0.500000
+frame bone material = texture anim = 1.0 texture -1 material
+frame vertex frame material 0.500000 frame material 1.0 vertex texture material frame frame
+-1 vertex
+material
+vertex
+0.500000 = material =
+material
+anim frame anim anim -1
+frame 0.500000 vertex
+-1 =
+material anim bone 0.500000 0.500000 -1
+texture
+vertex
+1.0 material bone material frame 1.0 = vertex bone vertex material
+vertex 0.500000
+=
+vertex
+vertex = 0.500000 bone
+anim frame -1 -1 anim texture -1 = -1
+bone
+vertex 1.0 bone
+1.0 = 0.500000 0.500000 anim texture
+1.0 frame 0.500000 texture bone anim -1
+bone anim -1
+texture bone texture frame
+1.0 anim = material anim anim
+bone material
+-1 = vertex bone anim
+frame =
+-1
+0.500000 material material texture vertex frame vertex anim frame vertex anim
+= anim bone
+vertex
+anim
+= bone
+-1 0.500000 material frame material bone
+texture bone -1 texture texture 0.500000
+material 1.0 0.500000 material
+bone 0.500000 bone bone
+0.500000 = -1 texture texture texture frame
+= 0.500000
+material 0.500000 1.0
+bone frame = -1 1.0 anim vertex vertex -1 vertex
+1.0
+bone = -1 frame vertex material frame vertex = bone 1.0 material
+0.500000 material
+-1 0.500000 1.0 anim vertex 1.0
+material
+anim 1.0
+-1 0.500000 texture vertex
+frame texture = anim material material vertex frame material
+ani
\ No newline at end of file
@@ -0,0 +1,326 @@
+vertex bone = =
+1.0 material
+anim texture
+= frame texture
+material -1
+material texture = bone
+0.500000 bone bone anim -1 0.500000 anim frame -1 =
+vertex 0.500000 vertex texture texture frame bone texture vertex frame anim 0.500000 -1 bone
+0.500000 vertex
+texture
+frame texture texture vertex -1 =
+anim 0.500000 texture
+0.500000
+anim texture
+bone material
+texture 1.0 frame frame frame texture = material frame material material anim
+=
+= texture -1 vertex 1.0 =
+anim
+-1
+vertex
+vertex bone 0.500000 = 1.0 1.0
+-1 frame 1.0 frame
+-1 material -1 1.0 texture
+-1 bone
+-1 frame
+= texture
+= 0.500000
+material bone material
+0.500000 1.0 frame
+=
+1.0
+-1 -1 anim
+material
+anim
+material
+anim texture texture 0.500000 -1 -1 material
+bone bone material texture vertex vertex
+frame =
+texture texture
+-1 1.0 material frame
+0.500000 frame
+bone
+1.0 0.500000 bone
+material
+bone frame anim 0.500000 vertex bone bone vertex -1 bone 1.0
+vertex
+=
+1.0 bone
+1.0 material
+1.0 bone material
+bone -1 vertex
+frame -1 0.500000 material 1.0 = vertex
+texture
+texture material
+1.0 -1 -1 anim 1.0
+1.0
+= frame 0.500000 anim texture
+anim
+frame texture
+vertex
+frame
+texture anim material
+bone texture material texture anim texture
+anim 0.500000 1.0 material
+bone 0.500000
+material vertex material bone frame 1.0 vertex material bone = texture
+anim bone = anim material
+material 1.0 -1 material = texture
+bone material material vertex
+frame anim material -1 -1 = vertex 0.500000 = = material
+vertex 1.0 material frame
+0.500000 bone = bone
+0.500000
+anim 1.0 0.500000 bone texture
+= 0.500000 vertex
+frame frame = material vertex frame 1.0
+1.0
+texture material = texture
+bone 1.0 texture texture anim material 1.0
+-1 0.500000 = 1.0 vertex vertex
+1.0 -1
+-1 0.500000 vertex vertex vertex -1
+texture = texture
+= anim 1.0 bone
+anim
+anim texture
+1.0
+anim 0.500000 -1 bone
+-1 frame 0.500000 texture = texture
+= 1.0 -1 anim -1
+= 0.500000 frame
+anim anim
+material texture texture texture =
+1.0 1.0 material
+0.500000 texture material
+material anim texture
+1.0
+texture
+anim texture
+material texture texture frame material 1.0
+anim
+texture anim anim
+material frame 1.0 -1 vertex
+0.500000 1.0 frame -1 bone
+bone frame bone
+texture
+0.500000 bone -1 anim
+anim
+=
+anim texture bone 1.0 =
+texture anim
+texture frame bone frame 0.500000 = material
+-1
+1.0 frame
+-1 vertex bone 1.0 = bone
+frame texture =
+texture bone vertex bone
+frame 0.500000
+vertex bone bone
+anim
+bone 0.500000 = vertex 0.500000 0.500000 0.500000 anim -1 -1 bone
+anim
+= frame 1.0 frame bone material frame material 1.0 = 0.500000 anim = frame anim bone =
+texture
+1.0 =
+texture 1.0 -1 material
+anim
+material = 0.500000 0.500000 =
+anim material = 0.500000
+-1
+= =
+0.500000 1.0
+1.0 bone vertex
+vertex -1 texture material
+= material -1
+material frame
+anim -1 = =
+vertex 1.0 frame material 0.500000 texture vertex texture = texture 1.0
+anim anim texture 1.0 anim material 1.0 bone material = bone 1.0 vertex 0.500000 vertex
+bone 0.500000 =
+material material = -1 0.500000 anim anim anim anim =
+texture anim material -1 vertex 1.0 =
+texture
+texture frame
+-1 0.500000 material
+texture vertex material 1.0 texture
+0.500000 frame = frame vertex -1 -1 material
+0.500000 vertex
+vertex
+anim
+anim 1.0 = 0.500000 0.500000 bone -1 anim -1 frame = 1.0 frame 1.0 -1 bone material 1.0 frame anim = vertex
+frame anim = 0.500000 vertex 0.500000 texture =
+bone
+texture material bone
+-1 -1 1.0
+= 1.0 texture = 0.500000 1.0
+1.0 bone texture -1
+bone
+vertex -1
+anim 0.500000 bone frame = texture frame = vertex anim
+0.500000 -1
+material
+anim 1.0 texture anim
+frame anim anim vertex
+texture anim texture bone
+vertex frame anim 1.0 anim vertex -1
+-1
+-1
+-1
+anim 1.0
+= texture 1.0 vertex anim material -1
+-1 1.0
+-1
+anim 0.500000 0.500000 bone = 1.0 texture material anim
+bone
+=
+0.500000
+1.0 vertex frame texture
+material
+texture frame frame vertex
+frame 1.0 anim bone material texture 0.500000
+bone frame vertex texture texture 1.0
+-1 material vertex
+1.0 1.0 material
+1.0
+1.0 = material
+= 0.500000 =
+-1 frame
+material 0.500000 frame 1.0
+0.500000 1.0
+material
+vertex -1 frame material =
+-1 -1
+frame bone
+texture vertex frame
+1.0 0.500000
+= frame
+anim 1.0 bone anim 0.500000 frame texture bone vertex bone texture = frame
+texture vertex frame
+1.0 vertex
+-1
+anim texture texture
+material frame vertex
+1.0 bone -1
+frame vertex -1 -1 = material
+anim bone
+-1 anim vertex anim texture 1.0 anim bone texture frame
+-1 bone
+texture material material
+= bone 0.500000 = anim bone
+texture texture 0.500000
+1.0 material
+anim bone material frame -1 bone bone anim
+-1 texture
+vertex = vertex 1.0 vertex frame frame vertex texture 1.0 -1
+material -1 material vertex material
+texture bone
+anim vertex anim
+texture
+texture vertex texture -1 0.500000 vertex 0.500000 0.500000 material anim
+1.0 vertex = 0.500000 texture 0.500000 -1 0.500000
+-1
+texture 0.500000 anim = -1 -1 anim = -1 texture vertex texture anim vertex -1 vertex
+1.0
+vertex
+1.0
+-1 0.500000
+vertex frame -1
+texture material frame material
+= vertex texture
+vertex bone
+-1 = texture 0.500000 -1 anim bone
+frame frame
+material material 0.500000 0.500000 frame
+-1 texture material
+texture anim anim 1.0 material frame vertex anim
+texture 1.0 material frame bone
+0.500000 frame
+0.500000 1.0
+anim 1.0
+= texture
+texture -1 =
+1.0
+vertex texture 0.500000 frame -1 material
+texture vertex texture
+material
+bone -1
+frame
+material frame vertex
+texture vertex anim 1.0 =
+vertex
+1.0 material vertex anim material -1
+=
+1.0 material
+bone 1.0 anim 0.500000 -1 bone bone -1 = 1.0 material material
+-1 0.500000 vertex 0.500000 -1 texture frame texture 1.0 anim texture anim 0.500000 anim material -1 anim -1 1.0 vertex frame anim -1 bone 1.0 frame
+texture 1.0 1.0
+bone material frame = 0.500000 texture anim material
+frame 0.500000 vertex 0.500000
+material vertex
+-1
+anim
+= 0.500000 frame vertex 1.0 bone vertex frame anim = anim -1 = -1
+vertex frame 1.0 anim 0.500000 bone
+0.500000 = 0.500000 1.0 bone 1.0 -1
+0.500000 -1 -1 frame anim material
+0.500000 bone
+1.0 bone frame = -1
+-1 material = -1
+= anim texture
+1.0 frame
+bone material -1 material =
+vertex vertex bone frame texture frame 1.0 1.0 material
+= texture vertex -1 1.0 bone = 0.500000
+-1 texture = -1 anim texture
+1.0 0.500000
+1.0 = texture 0.500000 vertex anim -1
+material 1.0 anim = anim 1.0 texture vertex bone 0.500000 vertex
+texture bone anim = vertex -1 0.500000 material 0.500000 1.0 bone bone frame 1.0 material
+anim frame
+1.0
+vertex vertex texture bone texture -1
+0.500000 frame anim material
+bone 1.0 1.0 bone 1.0
+= vertex bone
+anim
+material texture anim bone
+anim material bone 0.500000 0.500000
+1.0 material material texture =
+= -1 =
+-1 frame vertex vertex texture material -1
+=
+= -1
+material anim
+material
+vertex
+= texture anim 1.0
+vertex 1.0 = 0.500000
+anim frame material texture bone material
+frame texture = 1.0
+frame vertex frame bone
+frame -1 texture bone material
+-1 -1 material texture
+vertex material bone vertex vertex = = frame
+= 0.500000 frame texture frame anim 1.0 0.500000
+0.500000
+bone material -1 -1 vertex anim texture frame material -1
+0.500000
+material material vertex 0.500000 = material = frame = -1 frame vertex bone
+anim =
+material 1.0 anim vertex bone frame frame
+texture texture anim -1 = frame texture
+bone vertex anim vertex
+0.500000 texture
+1.0 anim frame material
+1.0
+1.0
+bone
+anim 0.500000
+anim vertex frame
+-1 0.500000 bone = -1
+frame = frame anim
+0.500000
+texture
+bone a
\ No newline at end of file
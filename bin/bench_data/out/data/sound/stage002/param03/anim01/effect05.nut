@@ -0,0 +1,79 @@
+material anim 1.0 1.0
+= = -1
+material 0.500000
+texture -1 anim frame
+-1 material frame = texture 1.0 = material
+= vertex frame =
+anim -1 vertex
+-1 frame texture
+material -1 texture
+=
+1.0 texture 0.500000 0.500000 -1 bone anim anim frame 1.0 -1 vertex
+frame 1.0 0.500000
+material bone anim = vertex 0.500000 texture material
+-1 1.0 bone bone 1.0 1.0 texture bone
+1.0 0.500000
+1.0 0.500000
+vertex -1
+vertex frame anim
+anim texture 1.0 0.500000 = vertex bone
+vertex
+frame material
+frame
+material
+texture bone = = 0.500000 texture material
+0.500000 -1 frame texture frame vertex 1.0
+bone bone
+anim anim material 1.0 vertex
+anim 1.0
+texture
+frame texture
+vertex
+material texture frame
+= material frame bone 1.0 frame 0.500000 1.0 material -1 0.500000 texture = vertex
+frame 1.0 texture 0.500000 -1 bone frame texture
+bone material
+frame vertex -1
+-1 -1 texture
+bone =
+1.0 -1
+0.500000 texture
+texture
+anim material 0.500000 -1 = vertex 0.500000 material
+material texture vertex -1 texture 1.0
+bone 1.0 frame frame frame frame vertex -1 texture
+material 0.500000 frame texture bone
+vertex 1.0 texture = 0.500000 -1 texture
+anim frame
+0.500000
+0.500000 anim
+frame texture -1 frame texture 0.500000 bone anim material vertex frame = texture bone -1 = material anim material texture vertex vertex frame bone 0.500000 vertex 0.500000
+vertex
+bone
+1.0
+1.0 =
+vertex 1.0 vertex
+frame 0.500000 frame = texture
+material 0.500000 =
+-1 bone frame vertex material texture
+0.500000 vertex 1.0
+0.500000
+= -1 texture
+1.0 = -1 0.500000 anim material 1.0
+1.0 1.0 bone texture
+1.0 bone
+bone material
+anim
+0.500000 0.500000
+1.0 frame material vertex 1.0 = vertex = = anim
+1.0 anim frame vertex texture vertex texture
+-1
+vertex -1 1.0 bone anim -1 vertex
+vertex frame
+vertex vertex bone
+= frame bone
+anim
+= material
+material anim anim
+1.0
+bone = 1.0 frame texture = frame texture -1 vertex material vertex
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000 0.500000 texture 1.0 =
+= texture
+vertex
+vertex bone 1.
\ No newline at end of file
@@ -0,0 +1,7 @@
+material material
+1.0 vertex vertex texture
+-1 frame anim bone
+= -1
+texture = -1 vertex bone
+texture frame = = frame
+bone 0.500
\ No newline at end of file
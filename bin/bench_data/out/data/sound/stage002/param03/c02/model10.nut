@@ -0,0 +1,3 @@
+frame texture
+anim bone bone
+= texture -1 fram
\ No newline at end of file
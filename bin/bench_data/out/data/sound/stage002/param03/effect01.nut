@@ -0,0 +1,171 @@
+frame vertex vertex -1 vertex
+1.0 bone frame frame bone 1.0
+anim
+frame -1 = = material
+anim anim -1 texture
+bone texture
+bone -1
+bone material = frame
+0.500000 texture texture bone material anim bone = texture texture 1.0 1.0 frame frame bone texture
+anim = material texture 1.0 1.0
+bone =
+=
+vertex bone
+bone -1 0.500000 = =
+texture -1
+= bone -1 1.0
+= texture
+material 0.500000 frame 0.500000
+bone frame
+= bone =
+-1 anim
+1.0 texture material material texture
+0.500000 frame
+anim frame material bone
+material bone vertex = texture -1 texture frame -1
+material 1.0
+0.500000
+vertex = frame texture frame texture -1 = bone bone vertex
+material = = anim 1.0 bone material anim vertex 1.0 0.500000
+= texture texture material
+anim vertex material -1 vertex frame
+vertex vertex material -1 vertex vertex vertex
+anim bone vertex bone
+1.0 0.500000
+anim anim 1.0
+1.0 -1
+= anim
+anim 0.500000 bone -1 frame material vertex
+texture
+anim vertex texture frame 1.0 vertex bone
+material bone
+1.0 texture 1.0 -1 frame vertex
+vertex bone = = material material 0.500000 -1 1.0 anim
+1.0 vertex vertex vertex material
+bone 1.0 bone anim frame
+1.0 = texture vertex
+frame vertex
+vertex texture bone
+0.500000 vertex 0.500000 material frame bone frame 0.500000 material -1
+0.500000 material bone
+=
+frame frame
+vertex anim
+material vertex
+vertex frame 1.0 material bone 0.500000 texture -1
+anim 1.0
+0.500000
+0.500000 frame anim vertex bone
+=
+anim vertex
+vertex = anim
+texture texture material 1.0 vertex
+anim frame vertex texture 0.500000 1.0 1.0 1.0 material texture frame
+frame anim texture -1 = 1.0
+bone anim frame -1
+material
+bone
+texture material
+1.0 = material material =
+vertex
+vertex anim
+0.500000 material 1.0 frame
+= -1 0.500000 0.500000 -1 vertex bone 0.500000 material 1.0 vertex 0.500000 bone = -1
+anim texture anim texture material frame frame
+texture -1 material bone bone -1 -1
+1.0
+0.500000 anim = anim -1 1.0 bone -1 -1 1.0 frame frame anim 1.0
+texture anim -1 anim
+bone -1 frame bone material 1.0
+0.500000 -1 material = bone 0.500000 vertex
+1.0 material 1.0 material vertex bone -1 0.500000
+vertex
+1.0 bone
+bone texture
+1.0
+anim
+texture
+frame vertex 1.0 anim vertex
+material 1.0 vertex vertex texture
+0.500000 texture anim 0.500000
+texture anim
+bone
+-1
+material
+0.500000 = frame
+anim bone
+= anim vertex 1.0 material = material
+0.500000
+bone
+anim frame frame anim 1.0 = -1 0.500000
+material
+frame material bone 1.0
+anim vertex 0.500000 anim
+bone vertex
+frame 1.0 anim anim
+material texture vertex vertex
+-1 =
+frame
+1.0 -1 0.500000 0.500000
+frame frame frame -1
+texture =
+bone -1
+1.0 1.0 anim
+0.500000 frame
+-1 -1 1.0 -1 texture
+-1 =
+= vertex anim frame 0.500000 bone material frame frame
+1.0 material frame vertex bone
+material
+texture
+material bone
+bone texture
+frame anim
+vertex = anim texture vertex
+1.0 bone
+material bone
+-1
+texture frame -1 0.500000 1.0 = anim vertex vertex 0.500000 texture
+1.0 -1
+vertex material
+=
+bone vertex material =
+frame bone = 0.500000 bone material 0.500000 texture anim 1.0 bone frame anim 1.0 bone texture material -1 frame anim -1 -1
+0.500000 material anim
+bone
+material texture bone -1
+texture
+= frame bone = frame
+0.500000 frame 1.0 0.500000 =
+anim -1 vertex 1.0
+material anim
+-1 vertex anim
+texture frame vertex 1.0 0.500000 bone bone -1 material 0.500000 bone vertex texture 0.500000 anim bone -1 vertex
+bone
+-1 frame
+vertex -1 texture 0.500000 texture =
+1.0 frame vertex frame anim material = texture vertex = = anim
+-1 1.0
+1.0 texture
+= vertex bone bone 0.500000 1.0 vertex bone vertex
+texture material bone -1 anim
+texture = bone
+bone
+anim
+frame 0.500000
+=
+0.500000 material
+bone
+texture material
+= anim anim
+bone = frame =
+vertex
+material = 0.500000 vertex bone bone bone material = = bone 0.500000 0.500000
+= bone 1.0 vertex
+frame 1.0 material texture vertex texture bone frame
+material
+vertex 0.500000 -1
+1.0 = vertex texture texture -1 anim bone -1 0.500000 bone
+1.0 -1 anim -1
+1.0 texture
+= fram
\ No newline at end of file
@@ -0,0 +1,51 @@
+vertex
+=
+texture bone frame 1.0
+frame
+1.0 0.500000 bone
+material
+0.500000 0.500000 0.500000 = material
+material -1
+anim 0.500000
+frame
+frame
+texture material -1 material = frame -1 -1
+texture vertex -1
+1.0 0.500000 bone 1.0 frame
+vertex 0.500000 frame
+anim
+= bone
+material = frame 0.500000
+-1 texture -1 bone
+= frame anim texture
+= anim
+anim
+material -1
+vertex material texture
+1.0 material
+frame material frame frame = material 0.500000 frame
+texture 0.500000 0.500000
+bone 1.0 bone 1.0 0.500000 texture 0.500000
+bone
+-1 texture
+=
+frame
+=
+-1 texture frame 1.0
+-1 texture frame material texture
+texture
+bone = texture vertex 1.0
+1.0 bone -1
+vertex
+-1 anim anim vertex bone
+anim
+anim bone -1 bone 1.0
+vertex = -1 frame
+bone 1.0
+= material
+1.0 material
+anim = anim 0.500000
+1.0 vertex
+frame material material material 1.0 vertex
+= frame bone 1.0 frame = frame
+vertex texture anim 0.500000 frame bone 0.500000 -1 0.5000
\ No newline at end of file
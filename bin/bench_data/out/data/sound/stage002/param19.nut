@@ -0,0 +1,20 @@
+vertex frame material bone
+-1 frame
+vertex 1.0 frame frame
+0.500000 frame
+vertex 1.0
+frame texture
+material -1 anim -1 frame texture frame 1.0
+material
+bone vertex
+vertex
+material 1.0 texture texture bone vertex = material material material = vertex
+vertex texture vertex vertex = bone texture bone vertex material vertex vertex -1 texture 0.500000
+1.0
+frame anim anim
+vertex =
+texture
+vertex
+frame anim anim =
+texture bone = 0.500000 frame frame 1.0
+texture vert
\ No newline at end of file
@@ -0,0 +1,3 @@
+1.0
+anim -1 vertex
+0.500000 0.500000 texture frame
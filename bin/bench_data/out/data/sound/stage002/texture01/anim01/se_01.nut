@@ -0,0 +1,25 @@
+1.0
+anim
+bone
+= frame
+bone 0.500000
+= material
+-1 = =
+-1 bone anim anim texture anim bone texture vertex texture frame
+anim -1 -1
+-1 =
+frame material
+vertex texture material anim vertex -1
+frame material -1 bone 0.500000
+1.0 frame -1 texture 0.500000 texture bone frame 0.500000 -1 frame 0.500000 1.0 anim frame = bone 1.0 = frame texture vertex
+bone bone
+material
+-1
+-1 material =
+1.0 = =
+anim texture bone =
+-1 anim bone bone
+anim vertex texture 0.500000 bone
+= frame material
+bone 0.500000 0.500000 -1 1.0 1.0 = -1 bone frame material -1
+0.50
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000
+anim 0.500000
+texture
+0.500000 -1 material frame material vertex
+material vertex material
+1
\ No newline at end of file
@@ -0,0 +1,149 @@
+bone -1 vertex
+bone frame anim
+bone 1.0 =
+frame vertex
+=
+bone texture 1.0
+vertex bone anim
+texture material 0.500000 texture
+-1 frame frame vertex 0.500000 vertex 1.0
+-1 -1 0.500000 anim texture vertex
+= frame 0.500000 0.500000 0.500000 bone = anim anim
+material -1
+texture frame bone
+vertex bone
+1.0 anim 0.500000 = 1.0 frame material -1 frame -1 texture frame
+-1
+anim
+= vertex bone texture -1 material 1.0
+-1 anim -1 -1
+-1
+vertex
+frame = 1.0 -1 frame bone -1
+-1 bone material vertex frame
+0.500000
+material vertex material -1 = texture
+texture 0.500000 0.500000
+1.0 0.500000 =
+bone = anim
+-1 texture frame
+bone
+bone bone bone 1.0
+bone texture material
+1.0 0.500000 material bone bone frame = material
+-1 -1 anim vertex vertex material bone texture 1.0 texture
+vertex anim
+bone material
+texture bone
+frame
+-1
+= 1.0
+material texture bone 1.0 frame
+-1 vertex 0.500000
+material bone material 0.500000 = material material = vertex
+bone frame 1.0 = =
+= 1.0
+=
+0.500000 0.500000 vertex frame texture bone = anim frame
+anim material texture
+material texture vertex = -1
+1.0 = bone material
+bone
+0.500000
+vertex texture texture material 1.0
+texture
+bone -1 bone texture bone frame bone
+bone
+texture
+texture texture frame frame anim = material texture texture = 0.500000 0.500000 = anim 0.500000
+frame
+material
+bone -1 -1 bone
+anim frame texture bone frame texture -1 material
+vertex bone texture texture frame 0.500000
+anim 1.0
+-1 vertex material vertex = 0.500000 0.500000 vertex
+= material bone frame
+vertex 1.0
+material bone 1.0
+= =
+= frame vertex bone texture 1.0 frame
+material 0.500000 bone
+1.0 anim bone bone bone vertex material 1.0
+frame bone
+material 0.500000 -1 texture frame = material vertex material texture material frame 0.500000
+frame
+anim
+0.500000
+texture
+material texture 1.0 = 0.500000 material frame 1.0 texture -1 material
+vertex
+0.500000 bone texture 0.500000 frame bone texture material
+anim
+bone 0.500000 0.500000
+= vertex -1 material anim
+= anim 0.500000 anim vertex
+= =
+0.500000 vertex vertex -1 texture 0.500000 anim
+frame anim frame 0.500000
+bone
+anim 0.500000
+anim
+texture
+1.0
+= bone bone -1 0.500000
+0.500000 = frame -1 vertex material texture material = material
+= 0.500000 1.0 0.500000 = frame frame
+1.0 texture material texture
+material 1.0
+bone
+vertex
+frame anim 1.0 -1 0.500000 -1 material
+texture 1.0
+-1 -1 anim frame material texture -1 anim anim
+=
+1.0
+bone =
+1.0
+texture frame bone vertex texture bone frame frame -1 1.0 1.0 vertex
+frame 0.500000
+anim
+= texture 0.500000 -1 vertex frame texture -1
+anim frame texture
+vertex 1.0
+=
+material material -1 -1 anim
+vertex texture -1 -1
+frame 0.500000 vertex
+0.500000
+vertex
+material frame bone -1
+frame
+bone vertex anim texture
+vertex material frame anim
+1.0
+frame
+vertex vertex
+0.500000 anim frame anim vertex
+frame
+material anim vertex 1.0 1.0
+-1 anim anim
+texture anim material =
+-1 =
+-1 0.500000 anim 1.0 bone texture anim texture texture
+material
+-1 = vertex
+vertex
+vertex =
+material
+bone -1
+= =
+= 1.0
+0.500000
+bone = texture
+-1 frame
+1.0 bone
+vertex -1 frame bone
+-1 = anim material
+vertex
+-1 vert
\ No newline at end of file
@@ -0,0 +1,76 @@
+anim texture 0.500000 0.500000 0.500000 material anim 0.500000 anim material bone = 1.0 bone 1.0 -1 anim texture
+vertex anim
+bone frame anim 1.0 0.500000 material -1 -1
+texture 0.500000 1.0 1.0
+bone texture
+texture 0.500000
+-1
+1.0 texture 0.500000
+texture vertex = anim
+texture
+1.0 =
+texture = 0.500000 0.500000 -1 anim material -1
+= anim bone
+frame vertex = bone -1 bone
+1.0 vertex -1 bone material
+material 0.500000
+vertex bone =
+texture 0.500000
+texture -1 bone 1.0
+bone
+material material
+material texture
+bone =
+vertex bone = vertex
+= bone anim frame 0.500000 texture
+texture anim = 1.0
+0.500000 -1 -1
+frame 1.0 texture = texture
+1.0 0.500000
+1.0 1.0 material anim frame
+texture bone vertex bone vertex anim texture
+= frame
+bone frame frame 1.0
+vertex
+1.0 anim = vertex 0.500000 1.0 material texture vertex -1 0.500000 texture vertex anim
+frame vertex 1.0 = frame frame bone -1 0.500000
+anim =
+1.0 = = texture = 0.500000 frame frame 0.500000
+=
+vertex texture
+material
+-1 1.0
+=
+texture
+1.0 texture 0.500000 frame 0.500000 anim 0.500000 1.0
+frame
+vertex vertex bone
+= vertex 0.500000 frame texture 0.500000
+frame
+bone
+vertex texture = frame -1 1.0
+1.0 -1 = 1.0 -1 texture anim material texture 1.0
+anim texture
+frame
+0.500000 0.500000 -1
+material
+vertex = -1
+= texture bone anim anim
+texture anim
+frame -1
+= frame frame
+-1 anim material -1 texture vertex anim texture = texture anim frame texture anim = texture anim -1 = anim
+material texture bone -1 material
+material
+0.500000
+anim frame
+anim
+material
+= material 1.0 anim bone material material anim 0.500000 texture texture
+vertex 0.500000 = -1 bone material
+-1
+vertex bone -1 = frame
+texture
+bone texture frame vertex 1.0 vertex 0.500000 anim
+frame vertex 0.500000 material
+texture -1 0.500000 anim frame texture = -1 texture anim vertex bone frame vertex -1 texture texture material 0.500000 ver
\ No newline at end of file
@@ -0,0 +1,145 @@
+= -1 anim
+= 0.500000 bone bone = material
+frame
+= texture 1.0
+bone anim anim
+0.500000 bone frame 0.500000 frame 0.500000
+-1 = material bone
+1.0 anim
+1.0 anim -1
+anim texture anim
+1.0 0.500000 =
+frame
+frame -1 material vertex
+material
+bone 1.0 texture vertex -1 anim
+material 0.500000 1.0 -1 0.500000 0.500000 0.500000 0.500000 material vertex -1 frame
+bone bone
+= 0.500000
+frame texture
+= 0.500000 vertex
+vertex bone material anim vertex =
+0.500000 0.500000
+anim -1
+-1 1.0 anim texture 1.0 0.500000 material material vertex material
+material
+texture -1 = -1 1.0
+bone texture bone
+frame 1.0
+frame
+material
+material
+= vertex vertex
+vertex bone 0.500000 -1
+0.500000
+vertex texture texture
+-1
+texture
+0.500000
+vertex
+0.500000
+material anim material texture 1.0 material texture 0.500000 frame frame material 1.0 material 1.0 -1 1.0 1.0 material
+material -1 -1 = = 0.500000 =
+frame bone vertex
+material frame
+texture
+frame
+material
+frame bone vertex 0.500000
+frame frame
+= frame vertex texture frame frame
+= 0.500000 0.500000 frame = texture 0.500000 material frame frame 0.500000
+texture frame
+= vertex frame = anim
+= bone
+bone = material anim 0.500000 texture frame bone
+-1 anim -1 bone
+0.500000 bone anim material
+texture anim 0.500000 bone
+frame vertex
+frame -1 vertex
+anim vertex material 0.500000 0.500000 1.0 0.500000 bone = material bone 0.500000 -1 vertex
+-1 texture
+bone 1.0 texture 0.500000 1.0 0.500000 material
+vertex = frame 0.500000 vertex =
+frame -1 texture =
+frame -1
+frame
+frame
+vertex anim 0.500000 texture 0.500000
+= bone material frame -1 0.500000
+frame vertex texture texture
+material vertex
+material texture
+frame =
+1.0
+vertex
+anim frame material
+1.0 material 1.0 0.500000
+material =
+1.0 0.500000 vertex -1 1.0 -1
+= texture vertex
+bone 1.0 1.0
+material material 0.500000 material
+= vertex vertex anim 0.500000 0.500000 -1
+= 1.0 bone 1.0 = -1 anim frame vertex = bone
+vertex 1.0 bone texture anim
+frame 1.0 =
+vertex texture -1
+anim texture bone 1.0 material 0.500000 texture material -1 texture -1 -1
+vertex bone anim 1.0
+0.500000 bone 1.0 -1
+texture material bone = 1.0
+material 0.500000 texture texture anim anim
+vertex 0.500000
+bone
+1.0 vertex = -1 bone
+0.500000 texture 0.500000 = anim 0.500000 vertex
+= material 1.0 -1
+bone anim
+vertex
+-1 -1 bone vertex -1
+= = anim material
+1.0 1.0 -1
+material
+vertex texture material 0.500000
+0.500000 1.0 0.500000 texture anim texture texture
+bone =
+=
+=
+texture 1.0 = -1
+-1 = anim
+0.500000
+vertex bone texture 0.500000 0.500000 -1 anim bone frame texture
+bone 1.0
+anim texture
+-1 anim frame
+vertex bone
+anim material anim
+= vertex anim vertex texture
+-1 texture = -1 = texture vertex frame material
+anim -1 vertex =
+= = =
+texture material 0.500000
+material frame 1.0 texture bone
+bone = 0.500000 1.0 -1 -1 anim material -1 texture
+material bone
+= bone
+material
+material
+-1 0.500000 1.0 vertex vertex anim vertex material -1 bone bone texture
+texture frame anim
+0.500000 texture bone texture vertex -1
+texture anim
+= bone vertex texture anim frame 0.500000 material 1.0
+anim texture 1.0 bone
+0.500000 1.0
+vertex 0.500000 vertex texture 1.0
+1.0 = 1.0 material material vertex 1.0
+vertex
+material
+1.0 frame frame = texture 1.0 -1 frame bone 1.0 material 1.0
+texture bone texture frame bone frame
+0.500000 material
+vertex = 1.0 0.500000 material
+1.0 1.0 bone
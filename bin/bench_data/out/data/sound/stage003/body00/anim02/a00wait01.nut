@@ -0,0 +1,74 @@
+vertex = -1 1.0 vertex
+= frame 0.500000 texture anim bone
+material
+frame texture
+-1 = texture = 1.0
+anim bone
+material
+texture -1 vertex bone
+frame 1.0
+bone 0.500000 -1 texture
+anim
+anim 1.0
+frame material 0.500000
+texture frame texture 1.0 bone -1 bone
+texture texture
+= texture = 1.0 vertex
+material material bone -1
+1.0 1.0 bone
+material material -1
+-1 texture
+material anim -1 0.500000 0.500000 0.500000 texture vertex material -1 -1
+= = vertex vertex material material
+frame anim frame vertex texture bone =
+vertex material 1.0 -1 anim
+vertex 0.500000 = vertex frame frame frame material
+vertex bone
+-1 = -1 0.500000 1.0 -1 material anim vertex
+material frame texture texture frame material
+vertex 0.500000 texture
+vertex anim anim
+material vertex
+frame frame vertex vertex -1
+frame
+texture anim
+anim anim anim
+bone
+vertex vertex
+frame -1 = 0.500000 texture material 0.500000 texture 0.500000 anim anim anim
+bone
+anim frame 0.500000 1.0
+-1 = texture vertex 0.500000 0.500000 frame material 0.500000
+= = -1 -1
+material
+0.500000 0.500000 bone
+1.0 anim -1 vertex frame =
+anim 0.500000 1.0 0.500000 anim bone
+vertex vertex
+1.0 1.0
+anim anim texture -1 frame 1.0 -1
+material
+= frame
+frame
+= = 1.0 = = anim frame vertex texture
+vertex
+bone texture 0.500000 bone
+-1 = anim 1.0 material anim
+anim vertex
+-1 texture texture
+anim bone texture
+texture 1.0 1.0 anim bone
+-1 = vertex = 1.0 0.500000
+anim bone vertex bone vertex material
+anim = bone bone material 1.0 texture 1.0
+= material anim anim 0.500000 anim 0.500000 anim
+-1 = vertex texture vertex
+1.0 -1 bone
+texture frame material vertex
+anim = texture 1.0 texture anim = -1 = = 1.0 anim 1.0 -1 texture = material
+1.0
+1.0
+vertex 0.500000 texture frame 1.0 vertex texture frame vertex =
+-1 anim anim
+0.500000 0.500000 texture
+anim texture frame = 0.500000 material
\ No newline at end of file
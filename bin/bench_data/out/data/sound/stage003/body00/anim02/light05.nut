@@ -0,0 +1,152 @@
+1.0 material texture
+material
+-1 bone -1
+texture
+1.0 bone
+anim =
+1.0 -1 0.500000 vertex bone
+bone
+vertex
+texture texture material texture 1.0 -1
+1.0 frame
+frame 1.0 frame texture
+-1 frame
+-1 frame 0.500000
+texture
+anim 1.0 -1 texture
+-1 bone
+anim vertex vertex 1.0 -1 = vertex
+bone
+anim frame 1.0 0.500000 1.0
+bone material texture 1.0
+vertex 1.0 -1
+frame material bone anim
+anim texture anim 0.500000 0.500000 = anim
+bone frame
+=
+-1
+bone frame vertex 1.0 = 1.0 0.500000
+= texture
+material frame frame texture vertex -1
+-1 -1 vertex =
+texture -1 material anim 1.0 1.0 frame anim bone 1.0
+1.0 material 1.0
+anim 1.0 texture
+1.0
+1.0 -1 bone bone
+= bone vertex
+material
+=
+bone
+0.500000
+material
+anim texture material frame 0.500000 -1 anim
+1.0 texture texture -1 texture
+0.500000 = 0.500000 frame material 0.500000 vertex -1 0.500000
+vertex = -1 bone 1.0 -1 0.500000 texture frame material = texture 1.0 1.0 -1 bone
+vertex = material
+vertex bone = material
+= 1.0 0.500000 anim anim anim
+= texture
+material
+frame 1.0 1.0 material 0.500000
+-1
+texture -1 texture
+1.0 bone vertex frame anim -1 texture -1 -1
+anim frame anim vertex
+1.0
+0.500000
+anim anim
+vertex
+0.500000
+-1 bone
+material anim 1.0 texture
+0.500000 material 1.0
+0.500000 1.0 bone -1
+bone 0.500000 bone = -1 material = =
+0.500000 texture anim vertex
+= material -1
+vertex 1.0 material 1.0
+-1
+texture 0.500000 vertex texture material
+frame texture 1.0 texture material bone texture -1
+vertex bone vertex 1.0
+-1 vertex texture bone
+bone texture 1.0 = material bone anim material
+1.0 vertex texture texture bone anim
+material = 1.0 1.0 0.500000 anim
+bone texture
+= vertex frame -1
+anim bone frame vertex material frame -1
+frame anim 1.0
+material bone frame 1.0 1.0 material 0.500000 texture
+frame
+frame 1.0 0.500000 0.500000 texture
+=
+=
+material 1.0
+anim -1 anim
+0.500000 = = material texture anim 1.0 vertex bone frame anim frame material
+-1
+frame material 0.500000 material anim vertex texture
+= 0.500000
+frame texture
+anim material 1.0 bone
+anim
+vertex 1.0 bone vertex =
+material material
+frame 1.0 = frame texture frame 1.0 =
+vertex material texture texture
+texture material
+frame
+anim 0.500000 texture anim
+= = bone -1 material frame -1 material anim bone
+texture bone
+material
+-1
+vertex -1 vertex
+-1
+=
+texture 1.0 = anim 1.0 =
+=
+0.500000 = 1.0 material
+anim
+vertex frame
+texture anim texture
+bone frame = -1 bone vertex frame anim frame frame bone
+bone 1.0 = material 1.0
+0.500000 material
+frame bone anim -1 vertex anim vertex = material frame anim vertex
+-1 texture frame
+anim bone texture 0.500000 0.500000
+0.500000 1.0 anim material
+frame 0.500000
+material anim
+-1
+0.500000 bone frame frame
+bone vertex 0.500000 vertex
+0.500000 -1
+texture
+-1 = bone material
+texture
+material
+texture
+bone bone
+texture material 0.500000 frame =
+=
+vertex vertex 0.500000 -1 texture anim
+0.500000 material material anim -1 -1
+material 1.0 anim
+vertex -1
+frame vertex anim bone -1 -1
+bone anim = 1.0 0.500000 -1 frame
+-1 bone
+texture
+bone bone vertex
+vertex material vertex frame vertex frame anim 0.500000 material
+=
+bone -1 1.0 material
+bone 0.500000 anim
+-1 0.500000
+-1 texture bone material frame 1.0 0.500000 1.0 material -1 = frame bone vertex vertex = texture frame -1 0.500000 material texture material -1 -1
+0
\ No newline at end of file
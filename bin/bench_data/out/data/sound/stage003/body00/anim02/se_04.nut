@@ -0,0 +1,104 @@
+-1 anim
+0.500000 -1
+material 1.0
+texture -1
+frame 0.500000 -1 1.0
+frame
+vertex 0.500000 material
+bone vertex texture
+= texture
+vertex texture
+texture texture = bone =
+0.500000 vertex material vertex material material -1
+material material anim material frame frame 0.500000 vertex frame
+bone bone 0.500000
+vertex 0.500000 material anim 0.500000 -1
+=
+0.500000 vertex
+material 1.0 -1 1.0
+vertex
+texture frame material bone
+vertex frame -1
+texture
+1.0 = -1 1.0 =
+bone vertex 1.0 anim vertex texture anim anim
+frame
+bone
+anim 0.500000
+frame -1 bone texture frame anim = = 0.500000
+material frame
+bone material
+-1 -1 material texture texture texture
+material vertex vertex
+frame material
+vertex bone
+vertex anim 1.0 = vertex 0.500000 1.0 anim = vertex 0.500000 vertex
+0.500000 = = texture anim bone frame texture anim vertex -1
+0.500000 0.500000 1.0
+0.500000 anim anim texture 1.0 vertex
+frame vertex
+bone
+texture =
+material anim vertex = material vertex
+= bone bone =
+-1 1.0 1.0
+vertex -1
+bone 1.0 texture frame anim texture = 1.0 texture 0.500000 texture -1 anim material anim 0.500000 bone anim -1 frame bone bone material
+material bone
+texture 1.0
+bone
+vertex
+0.500000
+texture bone bone vertex
+0.500000 frame material -1 anim
+frame 1.0
+frame anim -1
+= vertex frame vertex
+anim
+bone = bone
+bone bone bone 1.0 anim
+anim anim
+texture
+texture vertex =
+0.500000
+material 0.500000
+=
+texture
+frame -1 1.0 0.500000
+1.0 bone
+0.500000
+0.500000 vertex
+texture
+material = frame 1.0 frame
+anim
+texture vertex 1.0 material vertex material 0.500000
+-1
+frame -1 anim
+texture
+-1 texture = bone
+0.500000 1.0 0.500000
+material frame
+bone frame bone texture
+frame
+= texture 1.0 0.500000 material anim frame = material frame frame
+-1
+vertex
+frame
+bone texture = material
+frame bone 1.0 0.500000 anim 0.500000 vertex
+material texture frame
+= material -1
+texture = frame -1 bone bone texture =
+0.500000 -1 material frame = anim = -1
+frame 0.500000 anim
+material
+texture -1 material texture
+bone -1 0.500000
+material = texture =
+material
+vertex vertex 1.0 anim
+bone = = vertex vertex anim anim -1 1.0 = material =
+vertex
+anim
+texture -1
+0.500000 
\ No newline at end of file
@@ -0,0 +1,3 @@
+material
+-1 anim
+anim vertex = texture 1.0 material m
\ No newline at end of file
@@ -0,0 +1,12 @@
+= 1.0 = 0.500000 vertex 0.500000 anim 0.500000
+material 0.500000 -1 texture
+1.0 1.0
+0.500000 material -1 anim -1 anim -1 vertex vertex vertex bone texture frame anim vertex bone -1 = texture frame 1.0
+1.0 bone = frame bone texture texture bone
+1.0 0.500000
+anim anim
+frame bone 0.500000 material anim -1
+1.0 1.0
+0.500000
+texture 0.500000 = frame = = -1
+frame te
\ No newline at end of file
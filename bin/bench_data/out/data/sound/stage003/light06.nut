@@ -0,0 +1,4 @@
+= 0.500000
+= frame 0.500000
+frame 1.0 frame material material -1 vertex -1 0.500000 bone
+texture bone 1.0 anim bone ani
\ No newline at end of file
@@ -0,0 +1,81 @@
+vertex
+1.0
+bone 1.0 frame -1 -1 anim bone bone bone bone material
+0.500000
+vertex
+anim
+frame bone anim texture texture frame frame anim texture
+-1 = frame bone
+= 1.0 material 1.0 =
+1.0
+bone 1.0
+vertex vertex =
+texture bone frame anim 1.0 0.500000 material texture frame frame 0.500000
+material frame 0.500000 = anim texture = texture material frame anim = frame
+frame 0.500000 = -1 bone
+material vertex texture frame frame
+-1 0.500000 -1
+bone
+texture
+1.0
+1.0
+bone -1 1.0 =
+0.500000 -1
+0.500000 texture bone
+frame vertex 0.500000
+frame -1 texture -1 =
+bone bone vertex
+texture
+vertex
+anim 1.0
+-1 -1
+vertex frame =
+texture
+1.0 anim 0.500000 -1 -1 1.0 frame 1.0 texture -1 anim = frame frame -1
+-1 bone material
+texture -1
+1.0 anim texture texture vertex texture -1 -1 1.0 material material texture anim
+vertex vertex
+vertex
+1.0 -1 frame
+0.500000 anim texture
+anim
+frame 0.500000 = -1 anim anim texture
+frame material frame anim bone 0.500000 0.500000
+0.500000 0.500000
+anim material 1.0 material
+material
+1.0 =
+-1 vertex bone
+-1
+frame frame 0.500000
+material 0.500000 texture -1 frame
+material
+bone 1.0 material 1.0 bone anim 1.0 anim = 0.500000 frame 0.500000 material texture 1.0 1.0
+= 0.500000 vertex -1 bone bone bone material -1 material vertex
+-1
+= frame
+bone 0.500000
+material -1 material texture 1.0 bone 1.0 anim 0.500000 bone material
+bone
+frame
+1.0 material bone
+=
+vertex -1 = anim frame frame texture = -1 frame 1.0 bone
+material material
+-1 anim 1.0 1.0 = = = bone anim frame bone texture anim texture
+bone texture = anim bone 0.500000 frame material
+material = = vertex -1 =
+frame
+0.500000 0.500000
+frame = 0.500000 bone 1.0
+material = frame frame -1 texture 0.500000
+vertex 1.0 1.0
+=
+texture 0.500000 -1 material 0.500000
+= texture material anim
+frame material
+texture 1.0
+= anim
+material -1 texture 0.500000
+= anim 1.0 frame -1 = material texture vertex materi
\ No newline at end of file
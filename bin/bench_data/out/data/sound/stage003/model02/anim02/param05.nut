@@ -0,0 +1,218 @@
+-1
+frame =
+bone
+-1
+vertex 1.0 1.0 -1 0.500000 0.500000 -1
+frame -1 texture =
+frame material -1 texture bone 1.0
+anim bone -1 0.500000 = frame
+= 0.500000
+bone anim material
+frame frame 0.500000 bone 1.0 = 1.0 1.0 bone frame =
+0.500000 vertex 0.500000 frame texture anim texture
+bone
+0.500000 =
+=
+anim
+= = material 0.500000
+texture texture bone frame 0.500000 material -1 bone = material anim vertex = vertex frame
+texture frame
+= 0.500000 1.0 texture texture -1 frame material
+-1 bone vertex = material
+texture anim
+1.0 frame material vertex 0.500000 material -1
+= vertex bone material 0.500000
+bone = = frame texture -1 0.500000
+frame -1 1.0 1.0 material 0.500000 anim = -1 -1 vertex material
+-1 1.0 frame
+-1 = 0.500000 0.500000 anim -1 material
+1.0 vertex 0.500000 -1 -1 1.0 bone
+material texture anim texture anim
+bone material
+material 0.500000 -1
+texture anim bone
+bone
+texture 0.500000 0.500000 0.500000 -1 0.500000
+1.0 texture
+texture texture = -1 vertex =
+1.0 -1 0.500000
+frame
+1.0 frame texture
+material
+0.500000
+bone = 0.500000 bone
+frame 1.0 vertex texture
+material bone vertex bone
+texture anim
+texture
+anim = texture = vertex -1 bone vertex
+0.500000 vertex =
+bone frame material vertex =
+vertex = 1.0
+anim
+texture material
+anim texture 0.500000 0.500000
+texture = bone -1 0.500000 1.0 bone anim
+texture -1 = frame frame
+frame
+frame
+vertex
+1.0
+1.0 frame bone 0.500000 1.0 vertex vertex frame 1.0 bone 0.500000 = 1.0 1.0
+-1 bone
+=
+frame frame vertex
+frame -1
+1.0
+bone
+bone
+-1 anim -1
+0.500000 = frame material = material =
+frame anim bone vertex
+1.0 1.0 = 1.0
+=
+-1
+vertex 1.0
+0.500000 bone texture vertex 1.0 material anim texture frame vertex frame
+anim
+1.0 bone -1 texture texture 0.500000 texture vertex frame material
+texture -1 = 1.0
+material frame vertex
+1.0 texture
+frame 0.500000 texture bone bone -1 bone -1 0.500000
+vertex
+texture 0.500000 -1 anim material anim
+= vertex frame
+-1
+anim -1 -1 vertex -1
+1.0 frame bone material material 0.500000 vertex anim frame frame
+= =
+=
+= bone vertex frame material
+texture material
+material frame
+-1 vertex
+frame -1 = -1 material texture
+anim
+texture 0.500000 bone 0.500000 frame anim anim bone
+vertex frame
+1.0 -1 =
+texture
+texture -1 texture 1.0
+-1 vertex anim 1.0 frame
+frame texture vertex 0.500000 frame
+1.0 = anim
+-1 1.0 -1 0.500000 1.0 vertex
+material bone
+vertex
+bone
+texture = 0.500000
+-1 1.0
+vertex frame anim texture -1 vertex
+material
+bone 1.0 texture texture vertex anim =
+material
+0.500000 vertex frame 0.500000 material -1 anim anim
+-1 0.500000 material
+texture
+frame = bone
+anim 0.500000 vertex vertex vertex -1 texture 1.0 -1 anim 0.500000 vertex
+material anim frame texture 1.0 bone =
+1.0
+frame frame = 1.0
+material = texture 0.500000 = -1 1.0 frame vertex
+-1 material = vertex texture material 0.500000 1.0 -1 material texture
+bone vertex -1 1.0 -1
+material
+frame 0.500000
+vertex vertex 1.0 bone bone = texture
+vertex
+vertex
+1.0 material
+anim
+bone texture
+0.500000 0.500000 -1 anim anim material = texture anim
+bone bone material frame bone
+frame
+1.0 texture bone texture texture bone anim =
+frame
+anim
+-1 material
+-1
+vertex 1.0 bone -1 0.500000 = frame texture frame bone vertex -1
+0.500000
+texture 0.500000 vertex vertex anim 1.0 bone 0.500000 bone texture
+vertex anim 0.500000
+vertex texture frame material = =
+texture 1.0 material bone
+= vertex
+1.0 texture texture texture
+0.500000 anim material 0.500000 bone vertex -1 1.0 frame
+vertex texture
+=
+frame bone 0.500000 = = material
+frame 0.500000 anim material
+vertex material
+1.0 1.0 material = frame
+frame
+0.500000 -1 =
+1.0 bone
+material frame
+frame = 1.0 0.500000 1.0
+-1 anim anim material
+texture material
+0.500000
+-1
+=
+frame bone = 1.0 bone texture anim anim frame 0.500000 anim material 0.500000 vertex material = frame -1 = 0.500000 0.500000 -1 texture 1.0
+texture
+vertex anim bone -1 = 0.500000 material
+0.500000 1.0 texture material
+-1 1.0
+vertex anim material frame
+material
+texture material
+anim -1 anim
+frame bone bone anim bone 0.500000 vertex anim
+vertex material
+1.0 = material -1 material = -1 = vertex -1 -1 material -1 -1 -1
+bone texture 0.500000 anim
+-1 0.500000 =
+0.500000
+1.0 anim = vertex anim material material
+0.500000 texture frame 1.0 vertex texture vertex anim
+texture vertex
+1.0 1.0 anim
+1.0 = 0.500000
+anim
+material material
+anim frame -1 vertex material bone 0.500000 vertex material anim bone
+anim material 1.0
+1.0 anim
+bone 0.500000 0.500000 bone vertex
+anim -1 0.500000
+=
+bone 1.0 texture frame texture frame =
+frame 1.0 bone vertex 0.500000
+anim 1.0
+frame 0.500000
+material vertex
+frame -1
+= material anim frame
+= anim material
+1.0 bone
+-1 vertex material
+0.500000 frame 1.0
+material = anim texture frame -1 1.0
+0.500000 bone vertex anim texture = texture = material 0.500000
+material -1 vertex frame 0.500000
+bone texture 0.500000 material 0.500000 0.500000 bone
+texture material
+=
+= material 0.500000 0.500000 -1
+anim frame -1 texture
+1.0 anim vertex -1 1.0 frame material
+=
+-1 bone = bone
+material = anim = texture bone texture vertex bone anim
+bone vertex vertex material 0.500000 bone frame frame material = vertex -1
\ No newline at end of file
@@ -0,0 +1,359 @@
+material anim frame
+=
+0.500000
+frame 1.0 =
+-1 = frame vertex bone =
+1.0 = anim
+0.500000 texture 1.0 vertex vertex texture = -1 = = frame bone frame material
+1.0 texture -1 anim
+bone texture 0.500000
+texture vertex
+vertex vertex
+-1 material anim 1.0
+bone
+= texture = 0.500000 = 1.0 frame 0.500000 frame =
+vertex frame -1 frame
+texture
+1.0 texture bone
+anim material
+-1 1.0 -1 0.500000 1.0 vertex anim bone
+= 1.0
+frame frame -1 frame = -1 vertex = 0.500000
+vertex material vertex vertex vertex
+1.0 = =
+= vertex 0.500000 1.0 bone
+frame bone
+1.0
+anim 0.500000 1.0
+material bone -1 vertex
+material -1 = texture vertex 1.0
+texture frame
+0.500000 bone anim 0.500000 =
+anim 1.0
+vertex
+vertex
+1.0
+-1 anim anim -1 texture -1 bone bone material -1 1.0 1.0 vertex = texture 1.0
+vertex anim vertex = 1.0 texture 0.500000
+-1 = = vertex vertex -1
+frame anim = texture material
+=
+0.500000 bone texture texture frame anim
+texture material
+material 1.0 = material texture
+-1 texture -1 =
+= texture
+0.500000
+frame 1.0 =
+frame = = =
+bone 1.0
+1.0 texture texture
+0.500000
+1.0
+= frame 1.0
+texture
+-1
+frame = material
+= anim 1.0 material material
+material
+bone 0.500000 -1 frame 1.0 bone
+= material 1.0 -1
+vertex anim
+frame texture frame anim -1
+bone 1.0 -1 0.500000 0.500000 frame
+material texture
+=
+frame
+bone bone 0.500000 anim texture 1.0 1.0
+1.0
+frame 0.500000 vertex frame
+vertex texture bone texture = =
+-1
+texture frame material bone 0.500000 frame texture
+-1 -1 -1 vertex frame
+-1
+0.500000 anim frame anim
+bone vertex
+anim = bone
+1.0
+0.500000 0.500000 anim 0.500000
+material material anim
+texture bone vertex vertex texture -1 bone anim material vertex -1 = anim frame bone
+= frame -1 anim bone -1
+1.0
+anim texture vertex -1 texture
+frame = -1 0.500000 =
+vertex vertex 1.0 material
+-1 bone
+0.500000
+0.500000 anim
+1.0 frame material 1.0 texture anim -1 bone -1 anim frame -1 1.0
+-1
+0.500000 anim = 1.0 -1 frame texture texture bone material 1.0 texture vertex
+frame texture -1 texture
+= vertex 1.0 material
+bone -1 material
+=
+bone -1
+= =
+anim
+material -1 0.500000
+1.0
+frame = vertex
+0.500000 bone -1
+1.0 = material 1.0 0.500000
+= bone 0.500000 0.500000 anim vertex -1 anim = texture texture
+frame frame frame 0.500000 vertex frame
+material 1.0
+0.500000 1.0
+vertex
+anim
+-1
+material anim =
+texture vertex material texture texture vertex
+=
+0.500000 frame 0.500000 0.500000 = 1.0 frame
+frame = 1.0
+0.500000 =
+frame 0.500000 material material 0.500000 material material
+1.0 -1 anim -1
+vertex 1.0
+anim
+1.0 1.0 = bone bone 1.0
+material material -1 anim bone
+anim bone = 1.0
+vertex material
+= material anim
+-1 = material anim frame anim
+-1 = 1.0
+1.0 texture = bone
+= -1 = frame frame
+frame frame
+anim -1 1.0 material material bone material -1 material 1.0 anim -1
+0.500000 frame anim
+vertex
+anim = vertex
+0.500000 frame anim -1 bone
+0.500000 vertex vertex
+material 1.0 -1 frame texture material
+-1 0.500000 material -1
+0.500000 texture anim = anim
+material
+=
+vertex
+material frame vertex
+1.0
+frame vertex frame frame material 1.0 anim material -1 bone
+texture
+1.0 bone bone = 0.500000 bone frame 0.500000 = vertex 1.0 material vertex
+anim -1
+0.500000
+1.0 -1
+-1
+texture -1 material texture 0.500000
+anim anim texture vertex
+texture anim vertex bone 1.0
+material material 1.0 material
+1.0 vertex
+texture
+bone vertex frame texture frame anim = frame bone -1 frame bone texture
+0.500000 anim
+anim
+bone
+anim
+vertex = -1 frame vertex -1
+vertex = anim anim 1.0 0.500000 1.0
+bone = -1 vertex anim material 0.500000
+= vertex frame material frame anim texture -1 = bone
+1.0 = anim
+frame
+vertex
+-1 -1 1.0 bone vertex texture 1.0 bone 0.500000 anim 1.0 texture =
+texture material texture anim -1 material vertex -1 bone -1
+= 1.0
+1.0 0.500000 -1
+frame bone texture
+material bone
+= bone material frame -1 0.500000 =
+vertex = anim vertex
+1.0
+vertex 0.500000 1.0 frame material anim bone 0.500000 anim bone =
+texture
+bone
+= anim texture bone
+1.0 frame frame anim 0.500000 -1 anim vertex bone material frame = = anim 1.0 frame material
+bone
+1.0 vertex vertex material bone vertex = -1
+vertex anim
+texture anim
+= frame
+vertex 1.0 material
+material 1.0
+vertex 1.0
+-1 vertex 0.500000 anim -1
+texture
+-1
+1.0 = material vertex -1 bone material texture = bone 0.500000 -1 0.500000 -1 = vertex
+texture
+texture anim 1.0 1.0 frame material 0.500000 anim 1.0 anim
+bone
+anim material
+anim
+1.0 = frame 0.500000 = vertex 1.0
+frame texture -1 anim anim frame -1 material frame
+vertex
+texture -1 material
+vertex bone = vertex 1.0 material
+frame anim vertex anim 1.0 -1
+1.0
+-1
+= vertex texture
+frame
+= -1 anim frame vertex
+1.0 texture vertex -1
+vertex anim vertex material 1.0 material 1.0 vertex frame vertex 1.0
+bone 1.0 material -1
+1.0 1.0
+= bone
+anim 0.500000 -1 -1 vertex material texture vertex
+material 0.500000 texture 1.0
+material bone bone 1.0 material -1 material anim = texture anim bone
+-1 = -1
+anim
+-1 frame anim
+0.500000 texture material bone 1.0 texture 0.500000
+frame 0.500000 material
+anim
+texture material
+frame texture material -1
+-1
+material = bone frame 0.500000
+bone texture vertex 0.500000 -1 material
+1.0
+vertex material frame = bone frame
+material 1.0
+texture
+= vertex texture
+vertex anim
+texture texture material
+1.0 -1 = 0.500000 0.500000 vertex
+texture 1.0 1.0 -1 0.500000 material 1.0 frame anim 1.0 1.0 material =
+bone frame = anim material
+1.0 texture anim
+bone bone
+= 0.500000 material = 1.0
+material frame frame 0.500000 vertex anim texture bone anim frame anim bone -1 0.500000 = -1
+= -1
+material bone texture vertex
+0.500000 0.500000
+frame
+vertex vertex
+material frame 1.0 = vertex material -1 texture vertex
+frame
+bone
+1.0 vertex -1 1.0 vertex vertex vertex = =
+material
+bone
+= vertex
+1.0 texture 0.500000 texture
+0.500000 bone -1 -1 vertex 0.500000 frame
+vertex
+vertex -1 material texture 0.500000 anim anim frame vertex
+vertex texture texture
+0.500000 -1 1.0
+texture frame -1 material
+-1 vertex texture
+0.500000 bone = frame
+material
+1.0
+material -1 material
+frame material = material -1
+bone texture
+frame anim material
+frame texture anim
+-1 anim =
+texture texture
+texture 0.500000 vertex 0.500000 frame = material texture frame texture 1.0 -1
+-1
+1.0 frame bone = = material material frame bone
+vertex
+material
+0.500000 0.500000
+-1 frame
+vertex 1.0 material -1
+= texture anim anim
+material vertex bone 1.0 = material
+=
+frame -1 = 0.500000 frame
+0.500000 bone vertex bone 0.500000 material 1.0
+frame anim vertex
+bone texture 1.0 texture 0.500000
+material bone -1 vertex material anim -1
+-1 1.0 -1 1.0
+material
+bone vertex 1.0 material = 1.0
+= frame 1.0 frame
+frame 0.500000 texture frame 0.500000 vertex 1.0 vertex =
+anim -1 1.0 anim 1.0 0.500000 bone bone texture =
+-1 texture
+vertex material
+material 1.0
+material frame texture bone material vertex material vertex material -1 material anim 0.500000 -1 frame vertex vertex texture texture 0.500000 = =
+frame -1 texture = = material
+material texture vertex texture
+frame -1 anim
+= frame
+vertex
+frame = =
+frame = material
+frame anim 1.0 1.0
+= bone 1.0 vertex
+vertex
+anim vertex
+bone = bone 0.500000 0.500000
+anim bone
+= vertex 0.500000 -1 texture -1
+-1 anim
+-1 bone texture = texture frame
+0.500000
+material = bone
+material anim texture 0.500000
+texture
+texture
+bone
+bone bone bone bone anim bone
+frame texture -1 texture texture vertex 0.500000 anim 0.500000
+=
+-1 material
+= 1.0 0.500000 anim 1.0
+material =
+anim anim material texture material
+-1 anim texture bone =
+material texture
+anim 1.0 texture vertex
+material
+1.0
+-1 1.0 frame anim material 0.500000 material frame vertex anim 0.500000 anim =
+anim
+frame
+frame anim
+texture 0.500000
+1.0 anim 1.0 material 0.500000 anim = 0.500000 vertex material texture 0.500000 vertex material
+bone -1 -1
+anim -1 -1 1.0 material 0.500000 1.0 texture
+= material material anim anim material frame frame 1.0 texture
+material
+material 0.500000 0.500000 anim
+texture = frame frame vertex anim bone anim bone
+texture vertex vertex material vertex
+frame -1 0.500000
+-1 anim = 1.0 0.500000 frame anim 1.0
+1.0 anim
+bone material -1 anim -1 = material =
+= 0.500000 anim -1
+0.500000 frame 1.0 -1
+vertex frame 1.0 texture vertex -1 material frame
+vertex bone bone
+0.500000 bone 0.500000
+=
+frame bone = mater
\ No newline at end of file
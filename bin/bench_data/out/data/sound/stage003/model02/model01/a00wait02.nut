@@ -0,0 +1,324 @@
+1.0 0.500000 = 0.500000 anim
+0.500000
+frame
+1.0 anim bone 0.500000 texture
+material anim 1.0 anim frame -1
+-1 texture anim
+anim
+0.500000 0.500000 bone anim frame 1.0 1.0
+anim bone bone 0.500000 bone 1.0 texture bone frame
+anim anim = vertex
+bone
+anim
+vertex bone vertex
+bone = texture
+vertex bone frame -1 vertex
+anim -1 -1 frame
+-1
+frame 1.0 vertex 1.0 anim vertex 0.500000
+material bone bone frame
+material bone -1 texture material
+frame vertex texture vertex anim
+0.500000 material -1 bone anim
+bone
+= texture anim vertex material
+material 1.0 vertex 0.500000 frame
+material vertex 1.0
+anim -1 material texture material
+texture frame
+-1 1.0 1.0 anim = bone material bone anim -1
+texture bone frame material 0.500000 frame bone
+1.0
+-1 anim material anim anim
+bone 1.0 = vertex
+= frame material -1 = material vertex
+-1 = -1 -1 0.500000 1.0 1.0 bone = frame = 1.0 = 1.0 material = 1.0
+material 1.0
+bone texture material 1.0 1.0 = texture anim
+anim 1.0 0.500000 anim material vertex anim 0.500000 frame anim vertex = = =
+0.500000 0.500000 material bone -1 anim
+material =
+material -1 material
+-1 1.0 material
+-1 -1 -1 anim
+-1 1.0
+-1
+bone 0.500000 =
+anim -1 0.500000
+frame
+vertex 0.500000 anim material 1.0 = -1
+texture vertex frame
+0.500000 = material
+material 1.0 -1 0.500000 material material
+= material
+texture anim 1.0 0.500000 frame frame frame
+-1
+anim -1 = bone material 1.0 frame
+texture -1 vertex texture 1.0 material bone = 1.0
+bone = 0.500000 -1 -1
+texture anim 0.500000 = bone 1.0
+anim -1
+bone material frame vertex 1.0
+texture material = frame
+texture 0.500000
+material
+bone -1
+1.0 -1 =
+vertex 0.500000 1.0 -1 1.0 frame = anim
+bone texture
+frame 0.500000 -1 anim
+anim 1.0 0.500000 material -1 anim texture
+frame
+0.500000
+bone
+-1 texture
+bone frame -1 =
+0.500000 frame anim = vertex vertex texture 0.500000 =
+frame frame 0.500000
+texture = = frame texture
+material = material -1 0.500000
+1.0 -1 1.0 material frame texture anim material bone anim
+texture texture bone texture bone =
+vertex frame -1
+-1
+= anim texture texture =
+= 1.0 vertex frame 1.0
+1.0 vertex =
+vertex 1.0
+vertex vertex vertex
+texture texture anim 0.500000 texture 0.500000 vertex bone 0.500000 vertex frame
+frame
+-1 texture material frame
+1.0 texture frame 0.500000 0.500000
+0.500000 vertex
+= = frame = 0.500000 0.500000 -1 material = frame bone
+material bone 0.500000 =
+1.0 anim material material
+material 0.500000 0.500000 1.0 -1 bone texture
+frame material anim 0.500000 frame
+material 0.500000 = = texture bone
+= = -1
+vertex material texture bone vertex 0.500000 -1 frame bone -1 anim texture material
+frame texture = 1.0 -1 = =
+frame
+1.0
+vertex = material 1.0 1.0
+material frame anim 0.500000
+vertex bone = texture =
+-1 = anim
+bone
+material frame = 1.0 material frame -1 bone frame
+=
+= vertex = 1.0 vertex -1 frame anim vertex vertex texture material bone texture 0.500000
+vertex bone -1 material vertex 1.0 frame material texture -1 bone = = frame -1 texture bone 0.500000 = bone
+bone material 1.0 material vertex -1 = vertex
+material
+1.0 frame frame
+material material
+0.500000 anim 1.0 vertex vertex 1.0 bone 0.500000 = texture anim
+-1 frame 0.500000 = -1 material = vertex texture 1.0
+anim -1 -1
+material -1 =
+texture anim anim
+= material =
+texture
+-1
+frame
+= frame = bone
+-1 anim = -1 vertex material -1 = texture -1 0.500000
+-1 bone 1.0 anim texture anim material
+vertex anim anim
+1.0 texture
+texture
+anim material 1.0 vertex texture anim material -1 -1 anim
+1.0
+material material
+frame texture = material 0.500000
+0.500000 texture 0.500000 anim anim frame -1
+0.500000 -1 material texture
+vertex
+texture
+bone -1 texture -1 anim 1.0 anim frame 0.500000 bone bone texture 0.500000 0.500000
+=
+-1 material frame
+vertex vertex vertex
+material texture
+material vertex bone
+texture bone
+vertex = bone material
+1.0 = 1.0
+texture
+anim material 0.500000
+vertex bone 0.500000 1.0 vertex 0.500000 =
+anim frame -1
+0.500000 vertex
+frame 1.0 vertex vertex 0.500000 -1
+anim 1.0 vertex 1.0 texture vertex vertex 0.500000
+texture bone 0.500000 material 0.500000 anim 0.500000
+0.500000 -1
+vertex frame
+frame vertex 0.500000 0.500000 1.0
+material
+1.0
+1.0
+0.500000 material frame
+-1 -1 texture
+bone vertex
+0.500000 frame 1.0 material
+material
+= material texture 0.500000 material 1.0 1.0 texture
+1.0 vertex bone 1.0 anim =
+-1
+bone -1 anim -1
+vertex 0.500000 =
+= vertex bone anim vertex 1.0 anim
+texture 1.0 = 1.0 material
+material
+= 1.0 vertex anim
+bone 0.500000 frame
+vertex anim -1 frame =
+0.500000 1.0 texture
+1.0 bone material
+bone texture material
+0.500000 anim vertex
+anim anim bone bone vertex bone vertex vertex = bone
+vertex vertex -1 anim
+material
+1.0 0.500000 vertex
+0.500000 -1 0.500000 = =
+bone
+= bone
+1.0 1.0 1.0 = 1.0 material texture texture -1 anim 1.0 0.500000 -1
+vertex
+material
+anim 0.500000 1.0 vertex vertex vertex material
+texture 0.500000 anim
+=
+-1 1.0 1.0 material -1 0.500000 bone anim 0.500000 0.500000 texture vertex texture 0.500000 bone = 0.500000
+anim material material 1.0 vertex texture
+0.500000 material
+0.500000 bone vertex bone 0.500000 texture vertex bone
+-1
+frame texture bone = 1.0 frame 0.500000
+bone frame bone 0.500000 -1 0.500000 frame vertex 0.500000 bone 1.0
+frame bone
+1.0 -1 1.0 frame frame 0.500000 1.0 = 0.500000 frame 0.500000 frame 0.500000 frame
+bone -1 bone 1.0
+1.0 frame anim vertex -1
+anim
+bone anim 0.500000
+vertex
+0.500000
+material
+= frame
+texture bone material
+1.0 = frame
+0.500000 =
+frame texture
+frame material
+-1 vertex = material vertex anim
+material texture 1.0 anim vertex =
+=
+vertex =
+material vertex
+0.500000 = vertex anim anim material
+-1 = texture 1.0
+= 1.0 1.0 =
+vertex 0.500000 0.500000
+1.0 = material -1 bone texture texture
+0.500000 -1
+material 0.500000 frame
+anim
+1.0 -1 texture
+vertex anim frame bone 1.0 -1 anim bone
+material -1
+texture
+material 0.500000 bone vertex
+= =
+frame frame texture 0.500000 material vertex
+0.500000
+-1 frame texture -1 1.0
+bone frame vertex
+texture 0.500000 bone
+material
+anim 1.0 1.0 1.0 frame 1.0 texture bone bone material texture -1
+-1 1.0
+= bone material = -1 frame vertex texture material 1.0 material bone
+1.0 vertex texture material frame texture
+1.0 bone = anim material material 1.0 frame anim 0.500000 anim material vertex
+-1 0.500000 -1 material anim vertex texture
+bone
+-1 vertex
+0.500000 -1 = -1
+1.0 bone bone
+anim
+= vertex
+material 1.0
+frame -1
+texture frame texture =
+vertex anim -1 bone bone anim -1 = -1 material -1 frame -1 1.0 anim -1 1.0 1.0 -1 bone texture
+anim anim vertex -1 bone anim bone bone
+anim -1 anim 0.500000
+texture texture texture
+texture 1.0
+-1 = bone anim texture = texture 0.500000 1.0 frame = = texture anim 1.0 -1 vertex frame bone bone
+vertex bone vertex 0.500000 bone
+material -1 -1 =
+vertex material 0.500000 material
+=
+texture
+1.0
+0.500000 1.0 anim
+1.0
+material
+texture
+-1
+anim -1 texture frame -1 vertex vertex
+-1
+0.500000 1.0 frame material -1 -1 material material 0.500000 vertex
+material texture
+1.0 = anim frame frame material vertex vertex bone = anim = frame
+vertex texture texture texture bone
+-1 1.0 vertex 0.500000 vertex bone bone 0.500000 anim 0.500000
+bone
+anim
+anim 0.500000 = 0.500000
+texture
+bone -1 material
+1.0
+anim
+1.0 frame =
+vertex vertex texture
+texture
+bone material 0.500000 bone
+-1
+bone -1
+bone
+material 1.0 anim frame frame frame texture
+0.500000 anim 1.0 1.0
+texture anim 1.0 0.500000
+vertex
+-1 -1 frame vertex texture =
+vertex 1.0 frame
+vertex -1
+anim anim = 0.500000 -1 anim bone =
+1.0
+= = =
+-1
+material frame bone anim -1 -1
+bone frame
+material
+material frame -1 frame material bone
+0.500000
+1.0 frame texture 0.500000 anim
+0.500000 0.500000
+-1 1.0 = -1 frame texture -1 0.500000 texture
+1.0 1.0 -1 anim vertex
+-1 1.0 0.500000
+0.500000
+anim material -1
+texture anim anim anim material 1.0 1.0
+frame vertex
+frame vertex -1 vertex 0.500000 bone anim
+vertex frame material
+1.0 material 0.
\ No newline at end of file
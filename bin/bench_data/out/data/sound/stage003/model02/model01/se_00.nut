@@ -0,0 +1,9 @@
+material 1.0
+vertex
+vertex =
+1.0 frame material
+material material frame bone bone
+-1 -1 vertex anim anim bone 1.0 1.0
+= vertex
+frame
+material texture 
\ No newline at end of file
@@ -0,0 +1,309 @@
+texture
+-1 texture anim
+material vertex texture
+-1 0.500000 1.0 0.500000 frame vertex bone bone
+material texture
+frame 1.0
+-1
+frame -1
+frame -1 material
+frame 0.500000 texture bone = bone texture vertex
+= vertex anim frame 0.500000
+material bone frame vertex = texture material vertex
+texture frame = anim 1.0 0.500000 1.0 0.500000 material
+= frame anim 0.500000 material material
+material material
+texture
+bone
+texture frame texture 1.0 vertex
+material
+frame frame texture -1 = = 1.0 -1
+frame frame 1.0 0.500000
+frame 1.0 -1 = vertex = anim 1.0 bone 0.500000 anim frame
+0.500000 frame texture
+-1 vertex 1.0 vertex texture frame frame bone -1
+vertex frame anim
+1.0 bone 1.0
+-1 material = frame bone
+frame bone
+bone 0.500000 0.500000 = frame material
+bone = 0.500000
+frame vertex frame
+material 1.0 1.0 vertex = material 0.500000 vertex texture material
+-1 anim vertex
+= = texture
+1.0 material
+anim material texture frame
+=
+-1 1.0 vertex texture 0.500000 -1
+-1
+bone
+1.0
+1.0 bone =
+texture
+vertex
+-1
+texture anim 0.500000 material 0.500000 0.500000 -1 1.0 frame vertex
+anim material -1 anim = 1.0 1.0 = bone =
+1.0 texture texture bone vertex anim -1 material vertex 1.0 anim
+texture anim
+bone
+frame
+0.500000
+texture
+frame 1.0 material frame
+texture vertex 1.0
+vertex 1.0
+anim
+-1 anim texture texture material 0.500000 vertex 0.500000 texture bone
+texture -1 1.0 = texture
+1.0 0.500000
+material
+vertex anim 1.0 bone 0.500000 texture 0.500000 material material vertex -1 texture
+frame material texture =
+vertex
+frame 1.0
+vertex
+bone
+material 0.500000
+bone -1 material texture = frame bone anim vertex frame
+frame -1 anim -1
+vertex -1 0.500000 1.0 texture
+-1 material frame 0.500000 vertex 0.500000 -1 = 0.500000
+frame 1.0
+bone 0.500000 -1 -1 frame
+texture texture 0.500000 bone -1
+bone
+1.0 1.0 material =
+frame
+bone -1 0.500000 material material bone anim frame = material vertex bone texture 1.0 vertex anim
+1.0 texture 0.500000 1.0
+anim bone 0.500000 frame vertex texture material material
+bone = 1.0 anim material anim 1.0
+0.500000 = texture
+texture material
+1.0
+1.0
+material anim bone -1
+texture bone
+1.0
+1.0 bone
+1.0 vertex vertex 0.500000 bone 0.500000 bone vertex
+anim
+0.500000 texture 0.500000 0.500000 1.0 1.0 0.500000
+anim material texture
+bone = material frame bone 0.500000 anim bone 0.500000 bone anim
+1.0 anim
+bone texture texture 0.500000 texture vertex 1.0
+frame
+bone frame bone
+vertex = anim anim frame -1 = anim
+-1 anim texture
+-1 = frame anim anim
+= frame
+frame
+1.0 texture frame
+0.500000 -1 -1
+0.500000
+frame bone
+bone = 1.0 frame 0.500000 -1 0.500000 frame
+material 0.500000 frame = -1 vertex 0.500000
+anim vertex anim vertex material 0.500000 anim frame anim material
+1.0 =
+frame frame anim vertex texture anim
+vertex
+vertex bone vertex texture frame
+material = 0.500000 0.500000 = frame material texture frame 1.0
+vertex 1.0 texture vertex anim material material material frame bone texture
+texture
+vertex 1.0 -1 =
+frame
+anim
+vertex vertex texture bone -1 material texture = -1 frame
+frame frame
+vertex vertex texture texture 0.500000 material -1 vertex 1.0
+0.500000
+= = = anim anim -1 frame vertex 1.0 = vertex material material texture anim
+1.0 anim vertex frame vertex bone
+vertex
+1.0 -1
+texture bone material
+anim anim texture =
+material
+-1 material bone anim 1.0
+= = = bone vertex texture -1
+-1 1.0
+material = = anim material =
+bone -1 frame 0.500000 = material vertex
+0.500000
+frame material 1.0 0.500000 1.0 -1 =
+0.500000 1.0 texture -1 -1 vertex material frame
+anim 1.0 0.500000 anim 1.0 texture 0.500000 1.0
+bone bone vertex vertex = 0.500000
+1.0 0.500000 vertex
+anim material frame frame 0.500000 vertex = texture
+bone 0.500000 material 1.0
+texture
+material
+1.0 anim texture vertex = anim
+frame -1 bone bone anim 0.500000
+anim = material 1.0
+1.0 0.500000 material 1.0
+anim
+material
+= material
+= material
+anim bone 1.0 anim 0.500000 bone bone anim bone bone = = vertex vertex
+texture texture vertex bone frame texture frame texture -1 0.500000
+0.500000 vertex texture = 1.0 texture 1.0 vertex texture frame
+material frame 1.0 texture -1 bone
+frame 1.0
+bone texture
+material texture frame = 0.500000 bone material frame texture -1
+0.500000
+= 1.0 -1 -1
+0.500000 frame anim 0.500000 anim
+texture material 1.0 anim vertex frame texture texture anim texture
+=
+0.500000 anim bone
+frame
+frame vertex texture = frame -1 = 0.500000 frame frame texture = 1.0 texture
+texture frame
+0.500000 -1 texture frame
+1.0
+1.0 -1 =
+0.500000 material 1.0
+-1 -1
+-1 anim
+vertex -1 texture
+texture material vertex
+= texture anim
+0.500000 frame = 1.0 -1
+-1 0.500000 material 0.500000
+1.0 -1 1.0 bone
+0.500000 bone vertex bone =
+frame vertex
+0.500000
+anim frame
+vertex vertex anim anim bone
+-1
+-1
+vertex -1 frame texture
+bone anim anim anim material vertex vertex 1.0 material
+-1 bone material frame material -1
+anim
+0.500000 anim 1.0 material
+material = 0.500000 anim
+0.500000
+-1 texture frame
+texture
+bone -1 -1 vertex
+= -1 texture vertex 0.500000 = -1
+anim
+frame -1 = frame frame vertex
+bone frame material 1.0 frame -1 vertex 1.0 bone vertex -1 1.0 0.500000 texture texture anim 0.500000 frame texture 1.0 material 1.0 frame vertex 1.0 bone 0.500000
+texture material = material frame bone =
+= material 1.0 frame material bone bone material 1.0 bone -1 bone vertex
+anim bone anim -1
+anim
+-1 vertex
+1.0 1.0 = texture
+frame bone
+bone vertex material 0.500000
+1.0 0.500000 vertex vertex
+1.0
+anim 0.500000 frame
+material 0.500000 bone material frame bone
+vertex anim anim frame =
+material texture
+0.500000 frame bone texture texture
+1.0 bone
+1.0 texture texture -1 -1
+anim
+anim material -1 1.0
+bone vertex
+bone -1 texture anim = 0.500000 bone 0.500000 0.500000 bone anim
+frame
+-1 texture bone
+bone -1
+anim frame bone
+1.0
+frame bone vertex texture anim anim anim anim -1
+vertex material vertex texture 1.0 vertex vertex material
+1.0 = -1
+anim
+texture frame material texture 1.0 bone frame = 0.500000 texture
+material
+anim bone = bone 0.500000
+1.0 -1 anim 1.0
+= frame
+= anim
+texture -1 material
+= 0.500000 bone
+material =
+0.500000 texture anim bone 0.500000
+anim bone texture vertex
+vertex = bone -1
+texture 1.0 anim frame
+0.500000 material
+anim =
+bone = = 1.0 vertex = 0.500000
+1.0 vertex
+0.500000 vertex
+1.0 0.500000 anim anim texture texture anim material
+frame -1 0.500000
+= material frame anim
+vertex vertex
+material
+0.500000
+texture frame -1 -1 -1 vertex -1 texture frame -1 anim 1.0
+-1 bone bone
+bone texture bone bone material
+bone
+texture
+frame -1
+material 1.0
+=
+-1 =
+1.0 frame
+0.500000
+texture
+frame texture bone
+texture material
+1.0 anim vertex = = vertex
+material
+0.500000 -1
+1.0
+material texture
+anim anim
+texture vertex frame material -1 0.500000
+anim vertex bone material
+1.0 texture anim = 0.500000
+0.500000 0.500000 -1
+vertex vertex anim vertex -1 -1 1.0 1.0
+= anim bone
+texture anim 0.500000 texture = = material
+-1 bone
+1.0 anim 1.0 0.500000
+texture texture frame material frame
+vertex
+-1
+frame
+1.0 1.0 texture bone
+bone vertex texture
+anim vertex
+bone = material anim material
+anim -1 anim 0.500000
+texture -1
+anim 1.0 texture anim 1.0 texture
+material frame material = -1 anim
+0.500000 anim anim -1 anim = material -1 1.0 frame frame texture bone 1.0
+bone texture 1.0 vertex = bone
+frame 0.500000 material
+1.0
+0.500000 frame 0.500000 1.0
+anim 1.0
+texture bone
+texture vertex
+anim bone frame vertex =
+-1 0.500000 ani
\ No newline at end of file
@@ -0,0 +1,289 @@
+-1 -1 -1 =
+= frame
+anim material
+0.500000
+material bone texture bone anim anim material =
+anim 1.0 = bone 1.0
+bone
+-1 = bone 0.500000
+-1 material vertex
+0.500000 vertex material
+-1 bone anim material material 0.500000 bone material frame vertex = 0.500000 0.500000 bone material frame = 0.500000 -1 bone =
+anim 0.500000 frame
+=
+vertex
+vertex frame
+= = = material 0.500000 1.0
+bone vertex texture material material texture -1 anim = material bone 0.500000 frame
+texture frame = = 0.500000 material -1 anim frame =
+vertex material
+= texture bone -1 vertex
+1.0
+= -1 bone material
+vertex -1 anim -1
+1.0 0.500000
+1.0
+anim anim 0.500000 =
+0.500000 texture material
+-1 =
+anim
+0.500000 texture 0.500000 -1 texture = vertex 1.0 0.500000 1.0 anim texture -1 frame
+texture vertex -1 frame 1.0 = -1 vertex vertex frame
+material
+frame 0.500000
+=
+material texture material vertex =
+texture frame frame bone anim = -1 anim 1.0 bone
+-1
+vertex =
+0.500000 material material texture
+frame
+frame
+material vertex = vertex 0.500000
+anim
+anim bone bone = = vertex -1 vertex frame = bone 0.500000 1.0
+anim anim
+frame bone 0.500000
+1.0
+bone 0.500000 bone -1 vertex vertex 0.500000 1.0 anim
+material texture -1 1.0 anim
+=
+vertex texture 0.500000 1.0 texture anim 0.500000
+anim material
+frame material texture vertex anim anim =
+1.0 texture
+= -1
+material 1.0 vertex
+0.500000 0.500000
+frame material material =
+frame material -1
+anim = material
+material
+anim 0.500000 texture 0.500000 = anim 0.500000
+0.500000 frame -1 material bone anim
+0.500000 material
+texture
+0.500000
+material
+texture anim anim
+1.0
+1.0 -1 bone = 0.500000 0.500000 material -1
+anim frame -1 = bone 0.500000
+material frame -1 anim vertex vertex
+anim bone =
+bone 0.500000 -1 =
+texture material texture bone
+frame 1.0 0.500000 texture = texture vertex texture frame 1.0 material anim texture 0.500000
+texture
+vertex
+material = = material frame
+0.500000
+0.500000 = vertex
+0.500000 1.0 1.0
+1.0 material = 1.0 = -1 =
+bone -1
+frame frame texture 1.0 material 0.500000
+1.0 bone = bone
+-1 0.500000
+anim frame =
+bone
+= bone anim
+anim 1.0 bone = vertex bone material 1.0 texture 0.500000 frame =
+= 1.0 -1 material 0.500000 1.0 = 1.0
+vertex anim anim = 1.0 texture -1
+frame 1.0 -1
+frame
+-1 vertex -1 material vertex
+anim frame bone
+texture
+frame
+-1 = texture texture texture 0.500000
+-1 frame = vertex bone anim material -1
+texture anim
+1.0
+-1 =
+1.0 bone -1 texture 0.500000 vertex
+anim
+texture vertex
+-1 bone 0.500000
+frame bone =
+bone material frame
+material
+anim = anim anim
+texture 1.0
+anim
+anim -1 = vertex anim = texture bone material frame
+texture = texture texture
+frame frame -1
+material 1.0 material frame vertex anim texture texture material
+bone
+1.0 = =
+vertex frame
+1.0 bone
+bone vertex vertex material -1 bone 1.0 frame
+= frame anim texture vertex
+1.0 1.0
+material anim -1
+0.500000 material 0.500000 anim texture
+texture
+= -1
+0.500000 anim 0.500000 = bone material frame texture
+=
+vertex material -1 material
+vertex material vertex -1 texture -1 vertex texture -1 1.0
+bone anim vertex 0.500000 anim =
+0.500000 1.0 1.0 bone anim frame =
+material
+vertex
+frame vertex frame 1.0 -1
+frame anim frame -1 bone material texture 1.0 anim
+1.0 -1 0.500000 =
+frame vertex vertex
+bone 0.500000 frame bone anim bone -1
+= 0.500000 texture vertex material texture 1.0 =
+1.0 material 0.500000 vertex 1.0 =
+vertex
+anim texture texture material
+=
+= -1 =
+texture anim = = 1.0
+0.500000 -1 bone bone frame -1 anim = texture frame frame
+texture -1 anim vertex 1.0 frame
+anim -1 bone -1 anim 1.0 1.0 vertex anim 1.0 frame
+= vertex
+1.0 = frame anim
+texture =
+0.500000 1.0
+anim frame
+=
+bone material = 1.0
+anim -1 frame =
+1.0 =
+0.500000 -1 frame frame vertex frame frame 0.500000
+= =
+material vertex 1.0 1.0 vertex -1 vertex -1
+anim bone
+bone -1
+texture 0.500000 0.500000 bone bone
+= bone anim
+anim material = = frame 0.500000 0.500000
+0.500000 material
+anim = 0.500000 = texture material
+-1
+vertex 1.0
+material = 0.500000 texture anim 0.500000 frame frame -1
+anim -1
+-1
+bone texture material vertex
+vertex
+material
+texture 0.500000 1.0
+0.500000 texture
+vertex texture
+anim material = vertex texture texture material -1 0.500000 = vertex 1.0 1.0 1.0 -1
+texture -1
+bone -1
+= material bone texture = bone 1.0
+vertex bone
+vertex
+0.500000
+frame anim
+vertex material 1.0
+0.500000
+texture 0.500000 material anim bone = vertex texture
+anim
+-1
+vertex
+anim material -1
+vertex
+bone anim 0.500000 frame texture
+= -1 -1 bone texture material 1.0 anim 0.500000 material material material = 0.500000 texture 1.0
+material
+anim vertex
+texture material vertex
+bone frame vertex = = 1.0 vertex vertex 1.0 anim texture frame vertex 0.500000
+anim bone
+frame
+texture
+material anim 1.0 = frame 0.500000 texture anim frame -1 material -1
+0.500000 1.0
+texture texture frame 1.0 frame
+vertex anim 1.0 anim texture = 0.500000 frame -1 -1 = -1 0.500000 0.500000 frame frame
+-1 -1 texture 1.0
+vertex frame
+= -1 -1 bone bone frame 0.500000 material = 0.500000 = anim
+-1 anim -1
+= frame = 1.0 = anim 0.500000
+1.0 1.0 texture 1.0 material 1.0 texture = vertex
+material vertex texture texture material material bone -1 1.0 1.0 -1
+anim texture vertex material material vertex frame
+material texture 1.0 anim -1 bone 1.0 texture frame frame -1 = -1 frame 0.500000
+bone
+0.500000
+bone vertex frame =
+anim 0.500000 texture frame 1.0 bone
+0.500000
+material texture texture
+material anim material 0.500000 = vertex 0.500000 0.500000
+vertex -1 0.500000 anim =
+0.500000 anim
+material = texture
+-1
+bone 0.500000 texture
+texture 1.0 vertex
+0.500000
+frame material 1.0
+frame = material anim
+bone vertex anim frame vertex frame material
+1.0 bone 1.0 vertex vertex texture vertex 0.500000 0.500000 anim frame anim anim
+0.500000 material = anim -1 vertex -1 material 0.500000 0.500000 1.0 0.500000 0.500000 bone
+frame texture anim bone 1.0 texture vertex texture
+0.500000 -1
+anim texture vertex
+bone =
+anim anim = anim -1 0.500000 = -1 texture texture 1.0
+vertex
+0.500000 1.0 vertex frame material
+0.500000 0.500000 vertex bone 1.0 material -1 1.0 texture
+=
+bone 0.500000 material anim -1 material
+0.500000 bone vertex texture anim -1
+0.500000
+material anim
+0.500000
+frame
+texture anim texture
+vertex texture 0.500000 anim
+frame anim frame = -1
+anim = = anim
+frame 0.500000 0.500000 1.0
+= 0.500000 0.500000 0.500000 bone
+material bone
+frame material anim bone material vertex = anim 1.0 1.0 texture 0.500000 anim texture frame texture frame texture texture texture -1 -1
+bone anim 0.500000 texture -1 0.500000 material =
+vertex frame frame frame anim frame texture frame bone bone
+frame
+-1 texture
+0.500000 anim
+vertex bone
+= bone anim frame texture vertex texture texture 0.500000 1.0 material =
+bone
+bone anim
+texture -1
+vertex -1 material frame
+bone material texture
+material
+= frame = anim material texture -1 bone = =
+vertex
+material
+texture 0.500000 material -1 -1 0.500000 vertex -1
+= 1.0 vertex material texture
+1.0
+material anim -1 anim -1
+= -1 1.0 = anim
+-1 bone bone bone
+= anim
+vertex 1.0 material 1.0 frame
+frame -1
+0.500000 = material
+0.500000 texture 0.500000 texture = = t
\ No newline at end of file
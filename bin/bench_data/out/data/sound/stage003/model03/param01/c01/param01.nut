@@ -0,0 +1,6 @@
+= =
+vertex anim =
+0.500000
+vertex anim = -1 1.0 vertex
+material vertex
+1.
\ No newline at end of file
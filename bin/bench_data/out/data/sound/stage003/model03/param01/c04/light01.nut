@@ -0,0 +1,24 @@
+1.0 material frame 0.500000
+vertex
+1.0 -1 frame
+-1 1.0 1.0 material 1.0 texture bone
+anim -1 frame bone material
+bone texture 1.0 material 0.500000 = vertex -1
+1.0 frame
+bone 1.0 = bone vertex =
+1.0
+=
+material -1
+bone = vertex texture 0.500000 vertex anim 1.0 -1 1.0 0.500000 material 0.500000
+frame
+bone
+= anim 1.0
+anim 1.0 bone
+0.500000 anim frame -1 material = 0.500000 anim 0.500000 1.0 vertex
+frame
+anim texture material texture = material 0.500000
+bone
+-1
+1.0 texture anim
+1.0 bone
+= materia
\ No newline at end of file
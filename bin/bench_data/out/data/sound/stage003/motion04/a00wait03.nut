@@ -0,0 +1,12 @@
+anim 0.500000 -1 = 0.500000 = material anim
+frame texture = =
+anim
+-1 anim
+1.0 bone anim texture vertex = frame
+anim texture 0.500000 1.0 = 1.0 = bone 0.500000 0.500000
+texture
+anim 0.500000
+texture vertex
+-1 vertex frame frame material frame material
+texture texture -1
+0
\ No newline at end of file
@@ -0,0 +1,18 @@
+-1 vertex texture
+=
+texture vertex
+material
+material vertex 1.0 -1 material 1.0 0.500000 anim frame -1 anim bone frame anim
+texture bone vertex 1.0 -1 material -1 0.500000
+= bone = bone
+texture
+bone
+-1 frame
+= -1 -1 0.500000
+= = vertex bone frame anim = 0.500000 1.0
+frame 1.0 = vertex texture
+= vertex
+= texture anim 0.500000 bone
+bone texture
+anim
+= 1.0 0.500000 1.0 bone 
\ No newline at end of file
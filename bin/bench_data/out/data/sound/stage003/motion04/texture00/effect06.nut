@@ -0,0 +1,3 @@
+vertex 0.500000 1.0 bone
+anim bone 0.500000
+material 0.500000 texture vertex -1 anim material bone texture = material -1 material 0.500000 frame f
\ No newline at end of file
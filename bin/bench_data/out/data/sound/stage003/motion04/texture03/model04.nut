@@ -0,0 +1,2 @@
+1.0 texture bone = =
+-1 vertex vertex 0.500000 text
\ No newline at end of file
@@ -0,0 +1,13 @@
+texture frame -1
+anim anim
+= 1.0 texture bone 1.0 -1 anim 0.500000 bone 1.0 1.0 material
+material bone bone material 1.0 0.500000 anim anim vertex =
+0.500000 = 1.0 1.0 frame anim 1.0
+0.500000 anim anim
+bone
+texture frame texture
+material bone 0.500000 frame = frame
+-1 -1 = texture
+frame material 0.500000
+-1 0.500000 =
+-1 frame verte
\ No newline at end of file
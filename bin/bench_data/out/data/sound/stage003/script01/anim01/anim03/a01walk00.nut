@@ -0,0 +1,5 @@
+material =
+= vertex texture
+vertex texture
+0.500000 texture bone frame
+-1 -1 material 1.0 texture 1.0 -1 -1 anim 
\ No newline at end of file
@@ -0,0 +1,9 @@
+vertex anim texture
+0.500000
+anim material
+=
+vertex
+frame -1
+-1 frame
+material 0.500000 frame
+0.500000 1.0 frame frame
\ No newline at end of file
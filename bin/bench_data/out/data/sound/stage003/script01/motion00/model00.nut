@@ -0,0 +1,3 @@
+frame bone
+vertex frame 0.500000 texture texture frame 1.0 vertex
+1.0 
\ No newline at end of file
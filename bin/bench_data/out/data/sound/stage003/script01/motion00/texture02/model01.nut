@@ -0,0 +1,86 @@
+1.0
+anim =
+frame 0.500000 vertex
+anim
+= material bone 1.0 = 1.0
+0.500000
+anim anim frame material
+-1
+vertex
+-1 bone
+0.500000
+1.0
+1.0
+vertex
+= anim 0.500000 bone
+frame texture
+texture = vertex = vertex -1 texture
+frame
+0.500000 bone
+-1 vertex bone texture
+material 1.0 material 1.0 texture texture 1.0 texture 0.500000
+anim = anim material texture
+= 0.500000 texture
+frame bone = vertex 1.0 vertex anim texture texture
+anim texture
+texture
+material
+= texture texture
+0.500000 1.0 =
+frame
+frame -1 = vertex
+texture 0.500000 vertex bone vertex 0.500000
+anim = vertex anim material anim
+texture frame frame 1.0 texture material material bone bone
+vertex -1 texture vertex
+material
+vertex 1.0 bone
+= 1.0
+anim = = = bone bone 1.0
+= bone
+texture -1
+vertex vertex -1
+1.0 = bone
+frame 1.0
+0.500000 anim texture frame
+texture texture material
+0.500000 texture = anim = -1 material frame =
+anim
+texture
+material frame frame texture 0.500000
+1.0
+material
+0.500000
+bone anim material anim frame frame anim 0.500000 material vertex anim anim bone
+frame 1.0 0.500000 bone vertex 0.500000
+bone vertex = =
+texture
+=
+texture
+0.500000 anim texture frame bone -1 1.0
+anim material vertex vertex frame frame anim anim anim
+1.0 bone material 0.500000 0.500000
+anim
+texture frame vertex 1.0 bone frame 0.500000 vertex
+= = vertex
+0.500000 frame frame 0.500000 1.0 anim =
+= material =
+-1
+vertex texture =
+anim anim 1.0 texture bone 1.0 -1 1.0 =
+0.500000 bone
+vertex frame
+0.500000 texture 0.500000 bone
+bone texture = vertex 1.0 1.0 material -1
+vertex texture
+frame 1.0 = bone
+1.0 = bone 0.500000 =
+vertex = 1.0 1.0 texture material
+0.500000 = bone
+1.0 = bone 1.0 =
+0.500000 material material 1.0
+vertex 0.500000
+= vertex
+0.500000 anim = = =
+material texture -1 1.0 texture =
+= = anim bone texture
\ No newline at end of file
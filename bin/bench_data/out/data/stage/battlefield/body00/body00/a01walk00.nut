@@ -0,0 +1,48 @@
+vertex -1 -1 bone
+bone 1.0 bone material = texture bone frame -1 bone texture 0.500000
+0.500000 1.0
+bone material anim bone
+texture
+frame material 1.0 = frame -1 vertex 1.0 texture
+material texture
+material material = 1.0 material material anim anim texture vertex material material 1.0
+vertex
+= material 1.0 frame frame
+bone anim -1
+material 0.500000 texture 0.500000
+frame
+0.500000
+bone
+frame 1.0
+material vertex anim 1.0 -1 frame 0.500000 texture bone material texture anim bone vertex
+bone 0.500000 = frame anim texture
+material frame bone
+frame 1.0 material texture -1 material 1.0
+= anim texture frame
+texture material frame = frame
+0.500000 bone bone
+frame = frame frame bone
+-1 material -1 -1 = vertex vertex
+1.0
+texture
+anim 0.500000 material 1.0 anim bone frame 0.500000
+material material material
+= vertex
+texture anim
+0.500000
+texture 0.500000 -1 anim
+-1 = = texture
+0.500000 -1 vertex
+-1 = frame 1.0 frame 1.0 anim bone anim vertex vertex 1.0
+= 1.0 frame bone
+frame -1 frame material texture = -1 1.0 texture material
+0.500000
+anim vertex 0.500000 = texture = frame = vertex 1.0 anim
+material 0.500000
+0.500000 bone vertex bone anim anim -1 = material
+-1 = = bone bone anim 1.0 =
+frame 1.0
+1.0
+bone vertex -1
+1.0 anim material material texture frame frame texture bone 0.500000
+-1 anim vertex = t
\ No newline at end of file
@@ -0,0 +1,61 @@
+texture bone
+-1 0.500000
+bone frame material = anim bone 0.500000 material frame -1 -1
+-1 -1
+frame
+-1
+material 0.500000 material
+texture -1 1.0
+bone
+-1
+anim 0.500000 frame bone
+anim frame
+texture 0.500000 1.0 = 0.500000
+= -1 material frame vertex -1
+anim 1.0 texture 1.0 anim vertex frame -1 texture
+= = material
+-1
+0.500000 frame
+-1 material vertex
+0.500000 vertex frame 1.0 0.500000 frame texture
+vertex anim vertex
+texture bone = material material -1 texture 1.0 vertex bone
+bone anim bone material -1 frame
+frame -1 anim anim = frame
+anim
+anim
+= 1.0 -1 =
+-1 bone
+vertex 1.0 -1 -1 0.500000 -1 -1 1.0 1.0 1.0
+anim
+= 0.500000 -1 1.0 material material texture
+frame frame anim bone
+vertex texture material
+bone 0.500000
+anim vertex 1.0 texture =
+anim vertex vertex
+frame anim 0.500000 =
+vertex material 0.500000 0.500000 material
+0.500000
+texture 0.500000 = vertex
+frame frame vertex -1 0.500000 0.500000 1.0 vertex
+texture = 0.500000 anim bone vertex
+material anim
+= 0.500000
+frame
+= anim bone
+anim frame -1 anim 0.500000 frame
+anim anim
+frame = anim 1.0
+material vertex vertex -1 0.500000 1.0 bone 0.500000 = bone anim anim anim
+bone
+0.500000 vertex
+0.500000 frame vertex
+material texture vertex
+texture texture vertex 1.0 bone
+texture 1.0 frame texture
+-1 =
+1.0 texture
+material anim -1 1.0 frame frame
+= -1
+material vertex te
\ No newline at end of file
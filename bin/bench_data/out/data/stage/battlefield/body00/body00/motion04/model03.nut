@@ -0,0 +1 @@
+n!Z{) quz+H%e[9ofXz*yjEɇ\#y)
\ No newline at end of file
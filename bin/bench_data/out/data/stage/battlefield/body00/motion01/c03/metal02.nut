@@ -0,0 +1 @@
+bcv:IM4l}M@MϭR{BsUu{"^nޒ$J)g&RgŗH'c/`fY(L`ZUQwpPg=\>mUE_NR@\.=:/%4¯}p\c[PA!?xXgfYj"tWq5=$SxjF3F*-@=;<?W -IZީbͶyi<,`@]Bb4Mtul'jEyA+l_|"Ê5,'`x;֠Bulv&(RTe$_"V.VƔCBB ԩU/gTKK8uTY0m,<>'iL4$,DAhgS;/GϑFms@K//<
\ No newline at end of file
@@ -0,0 +1,2 @@
+1.0 -1 1.0 vertex 1.0 1.0 texture texture 0.500000 1.0
+1.0 frame v
\ No newline at end of file
@@ -0,0 +1,100 @@
+material bone 0.500000 material -1
+0.500000 0.500000 0.500000 anim anim vertex texture material texture texture
+bone 1.0 anim = bone -1
+bone bone 1.0 anim anim material 1.0 0.500000 -1 frame texture = -1 material texture anim -1 -1 bone bone
+=
+=
+1.0 bone 0.500000 = frame
+frame
+texture vertex -1 = texture
+1.0 texture anim
+bone =
+0.500000 1.0 -1 texture anim
+= 1.0 = frame =
+=
+bone material = -1
+bone anim 0.500000 texture frame bone
+0.500000 texture material texture =
+= texture vertex =
+0.500000
+anim texture -1 vertex bone vertex bone vertex
+frame texture bone anim = = = 1.0 vertex -1 =
+texture 1.0 texture =
+bone anim vertex material anim texture anim 1.0 1.0
+1.0 0.500000 -1 -1
+1.0 material anim material vertex
+0.500000 1.0 anim
+bone
+vertex frame
+1.0
+= 0.500000 vertex vertex 0.500000
+0.500000 0.500000
+texture frame material
+vertex anim bone
+bone -1 0.500000 vertex
+bone material bone
+texture vertex anim 1.0 anim 1.0 anim bone vertex
+anim 0.500000 material bone anim texture
+-1
+= vertex
+bone bone
+-1 -1 material material frame vertex bone -1 anim bone vertex = 0.500000 1.0 = 1.0
+frame texture frame bone frame -1 0.500000
+texture
+bone frame 0.500000
+material = 0.500000 frame
+-1 vertex -1 material -1 0.500000
+1.0 frame 1.0
+-1 anim = texture
+frame bone vertex
+1.0 frame bone texture
+texture texture -1 vertex frame anim -1 frame
+texture bone 0.500000 0.500000 1.0 texture material bone material = vertex
+material 0.500000
+= bone
+vertex material material
+1.0
+anim -1
+vertex material frame -1 -1
+-1 anim
+frame anim
+anim vertex 1.0 texture
+bone 1.0 bone vertex = 1.0 1.0 0.500000 = bone material 1.0
+-1 -1
+frame 0.500000 0.500000
+0.500000 bone =
+0.500000 texture -1 frame
+1.0 bone 1.0 material = vertex
+frame bone
+bone
+texture
+texture frame 0.500000
+0.500000 vertex
+bone anim -1 frame 0.500000 anim material anim material
+vertex -1 vertex
+0.500000 1.0 0.500000 = = bone bone material
+1.0 texture 1.0
+texture = material = material =
+-1 = texture bone 0.500000
+= 0.500000 bone 0.500000
+texture 0.500000 = bone
+vertex anim anim
+anim anim 0.500000
+1.0 1.0 vertex -1 0.500000 0.500000 vertex = anim frame 0.500000 anim vertex
+bone = texture vertex 1.0 -1
+bone
+anim = 1.0 1.0 = texture anim frame =
+frame 1.0 bone
+anim frame -1
+vertex =
+vertex vertex material = bone bone 0.500000 anim anim vertex
+material = anim = anim vertex 1.0 anim bone -1 bone frame
+frame anim frame bone
+anim vertex
+1.0 -1 =
+vertex
+bone
+vertex vertex 1.0 = bone frame bone
+1.0
+= anim texture material
+0.500000 -1 -
\ No newline at end of file
@@ -0,0 +1,314 @@
+frame
+-1 texture 1.0
+0.500000 vertex -1
+anim vertex = bone texture
+-1 0.500000 texture bone anim = material bone bone texture
+anim
+frame bone vertex frame texture material 0.500000
+-1
+anim = texture material material frame frame anim
+bone
+frame 1.0 material -1
+bone bone =
+1.0 1.0 -1 -1
+material
+material vertex texture
+= 0.500000 material texture
+-1
+= 0.500000 anim
+anim
+texture -1 0.500000 = 0.500000
+1.0 -1 texture -1 frame
+vertex
+texture
+-1 bone vertex -1 -1 vertex
+1.0 0.500000 1.0 vertex =
+bone material
+-1 1.0
+= = 1.0 -1 bone 1.0 0.500000 = material
+= anim -1 texture
+= 1.0
+1.0 1.0 bone -1 frame texture 1.0 frame material texture =
+=
+0.500000 vertex
+-1
+material texture bone material anim frame anim texture frame texture texture 0.500000 anim =
+frame
+material 0.500000
+0.500000 0.500000 anim texture -1 frame bone -1 frame bone
+anim 0.500000
+-1 frame vertex
+-1 vertex 0.500000 1.0 vertex -1 anim 1.0 0.500000 vertex frame
+vertex
+0.500000
+texture anim
+anim 0.500000
+anim -1 = =
+bone 1.0
+vertex vertex =
+bone material -1 -1 frame
+material anim vertex material material
+material
+-1 frame vertex material 1.0 material
+= -1 texture bone = 1.0 = material material anim
+frame
+0.500000
+material texture anim 1.0 frame anim material bone vertex anim
+frame 0.500000 bone anim material 1.0
+texture 0.500000
+frame
+0.500000 vertex
+frame bone material
+anim
+vertex
+vertex
+texture
+0.500000 -1 0.500000
+-1
+1.0 -1 bone 0.500000 material bone -1
+material = 0.500000 1.0 material 1.0
+-1 vertex -1 vertex frame -1 frame 1.0 bone material
+material bone
+frame -1 vertex -1 0.500000 texture
+-1 0.500000
+texture
+= vertex material bone
+1.0 frame texture 0.500000
+vertex -1 vertex -1 vertex material bone
+material
+-1
+-1 frame
+anim -1
+frame =
+-1
+1.0 -1 1.0 1.0 -1 = 1.0 frame 0.500000 bone bone -1 1.0 bone
+-1 0.500000 vertex 1.0
+frame texture
+= 0.500000 1.0 1.0 texture vertex 1.0
+0.500000 texture
+1.0 0.500000
+-1
+0.500000
+material = anim 0.500000 0.500000 frame = 0.500000
+vertex
+0.500000 1.0 texture texture vertex material 1.0
+-1 vertex -1 material = 0.500000 material anim = vertex
+= anim 1.0 vertex 0.500000 0.500000 0.500000 texture anim -1
+anim 1.0 vertex bone -1 vertex
+bone -1 1.0 material
+-1 frame 0.500000 anim texture texture 1.0 frame
+anim
+0.500000
+= material
+anim bone 0.500000
+bone
+-1 bone
+frame material material vertex
+1.0
+1.0 1.0 bone
+-1 1.0
+bone bone frame anim -1 0.500000
+1.0 1.0 material 1.0 anim 0.500000 = -1 vertex material texture vertex -1 = 1.0
+bone vertex frame 1.0 vertex -1 frame -1 frame -1 vertex
+1.0 vertex vertex = frame bone -1 0.500000 anim texture
+anim bone 0.500000 0.500000 -1 vertex 0.500000 = material texture frame
+= -1 = material
+0.500000
+0.500000 bone =
+material material
+frame anim
+1.0 bone
+vertex frame 1.0
+bone 1.0 vertex vertex anim -1 -1 anim vertex texture -1 frame = =
+bone bone 1.0 frame texture
+= = = frame frame frame material texture anim frame 0.500000 frame material 1.0 0.500000 frame
+= = bone 1.0 frame vertex frame
+0.500000
+material bone
+= texture
+texture 1.0 vertex frame vertex texture 1.0
+0.500000 =
+material
+anim -1
+vertex bone 1.0 texture 1.0 anim 0.500000 anim
+= 1.0 0.500000 vertex anim
+bone texture = =
+anim material anim material 1.0 vertex anim frame vertex -1
+vertex =
+anim material texture anim vertex anim frame 1.0 anim anim
+bone = material anim texture
+frame bone
+anim
+texture
+-1 texture
+anim texture frame
+-1 anim anim vertex -1 -1 1.0
+0.500000 anim
+texture vertex frame frame
+=
+vertex bone
+1.0 -1 -1 texture
+0.500000 1.0 frame anim
+anim = vertex 1.0 texture
+anim
+bone
+bone material material =
+anim vertex
+-1 material texture material material
+texture texture
+-1
+anim material anim
+1.0
+vertex anim 1.0 1.0 frame
+frame material anim -1 bone -1 anim 0.500000 vertex
+bone vertex -1 0.500000 texture texture frame texture 1.0
+0.500000
+bone anim bone -1
+-1 vertex
+material bone
+texture 1.0 bone texture vertex
+bone 1.0 =
+-1 -1 frame texture anim frame material vertex
+vertex 1.0 -1 material frame -1 0.500000 = 0.500000
+vertex 0.500000 bone -1 material material texture bone vertex 0.500000 1.0 -1 0.500000 1.0 -1
+frame
+bone -1 material 1.0 bone
+bone 1.0 material texture frame -1 1.0
+-1
+texture -1
+anim -1 bone 0.500000 frame frame 0.500000 0.500000
+vertex 0.500000 = 1.0 =
+vertex
+0.500000 material -1 bone anim bone texture -1 frame anim -1
+vertex material frame 0.500000 -1 -1 -1
+vertex = =
+anim material = texture anim
+bone
+material bone -1 bone texture
+anim
+vertex material anim
+anim material = 0.500000 anim material frame
+material = frame anim 1.0 bone -1
+frame vertex bone anim frame
+bone 0.500000
+bone
+anim vertex
+material
+material vertex vertex frame bone vertex
+anim
+-1 = texture -1 material vertex
+1.0 frame
+texture anim 0.500000
+0.500000 -1
+1.0 anim anim
+anim material = frame anim 1.0 vertex frame texture 0.500000
+vertex
+= 0.500000 0.500000 1.0 anim vertex
+= -1 =
+frame frame 1.0
+anim anim
+-1 texture -1 = vertex
+= vertex vertex bone 1.0 1.0
+bone frame 0.500000 material bone
+0.500000 1.0 material vertex anim material
+material
+0.500000
+anim texture material bone -1 0.500000 bone
+vertex frame 0.500000 0.500000
+frame 0.500000 -1 0.500000 vertex -1 texture bone material
+anim 0.500000 -1 bone 0.500000 0.500000
+vertex
+-1 frame frame =
+= material bone 0.500000 -1 1.0 -1 material material material
+vertex frame -1 0.500000 bone vertex bone
+texture
+frame
+1.0 material material 0.500000 0.500000 0.500000 1.0
+frame
+frame anim
+=
+material =
+vertex bone anim
+material
+bone
+frame
+texture anim bone -1 -1
+texture =
+-1 anim = anim anim 0.500000 -1 frame
+bone
+= 0.500000 frame
+material bone texture material 1.0 =
+material vertex anim anim
+0.500000 frame
+= 0.500000 anim
+-1
+anim =
+bone 1.0 material vertex
+bone material
+1.0 -1 frame
+vertex -1 anim 1.0 = frame anim 0.500000 anim -1 -1
+vertex
+vertex 1.0 =
+=
+anim vertex texture frame bone material
+material material vertex texture frame texture 0.500000 bone anim bone material material -1 texture frame frame
+= 0.500000 material
+texture
+= 0.500000 1.0 vertex -1 -1
+bone 1.0
+bone texture
+texture texture vertex texture
+0.500000 material anim
+frame 0.500000 bone 0.500000 anim anim
+bone
+= bone material texture = anim = texture -1 -1
+anim material =
+bone texture material material bone anim bone =
+1.0 frame 0.500000 0.500000 material
+frame vertex
+texture 1.0
+0.500000 bone = 0.500000
+anim bone
+0.500000
+bone material texture 0.500000 -1 material texture 1.0 anim material 0.500000 frame frame vertex
+bone =
+material anim
+0.500000 material frame anim texture
+frame frame texture -1
+1.0 bone bone material
+frame -1 bone 1.0 anim
+vertex bone
+material frame vertex
+bone
+texture 0.500000 -1 vertex vertex
+frame anim material texture = 0.500000 = frame material vertex
+0.500000 material vertex
+-1 bone vertex 1.0 = bone = frame bone -1 vertex 0.500000
+-1
+1.0 material anim anim 0.500000 0.500000 = 1.0
+anim material vertex
+0.500000 vertex
+-1 1.0 texture = -1 1.0
+anim 0.500000 texture anim vertex
+vertex 1.0 1.0
+-1 anim 0.500000
+anim bone texture 1.0 vertex
+bone
+vertex bone
+=
+vertex
+1.0 frame 1.0 bone anim material material 1.0 1.0 texture vertex vertex anim frame anim material frame frame -1
+material material texture frame = texture 0.500000 0.500000 bone
+vertex
+-1
+material 0.500000 0.500000 =
+material
+texture 1.0
+anim
+1.0
+1.0 material texture texture
+anim texture vertex 1.0
+material material 1.0
+material 0.500000 vertex 1.0 vertex frame = 0.500000
+bone frame texture
+-
\ No newline at end of file
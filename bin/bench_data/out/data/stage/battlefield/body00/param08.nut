@@ -0,0 +1,290 @@
+anim vertex anim material -1 = frame vertex anim = frame -1 vertex
+0.500000 = texture
+vertex -1 1.0
+bone bone
+= frame 1.0
+=
+frame frame material bone 0.500000 material -1 -1 =
+1.0
+vertex bone
+= = material texture vertex 1.0 = vertex anim
+anim
+frame 0.500000 material
+bone material 0.500000 -1 material anim texture bone
+vertex texture anim frame bone
+1.0 =
+bone vertex
+1.0 frame = anim
+1.0
+1.0 vertex frame frame
+= 0.500000 1.0 texture -1 0.500000
+-1 bone vertex anim frame bone frame vertex 0.500000 anim material 0.500000 material
+texture anim texture anim vertex bone bone
+-1 anim anim bone = frame -1
+frame texture vertex bone 1.0 bone vertex 0.500000 material 1.0 0.500000 -1 1.0 frame bone = texture
+-1 0.500000 frame
+vertex
+-1
+texture
+material 0.500000 frame texture 0.500000
+-1
+vertex 0.500000
+bone 0.500000
+1.0 frame 1.0 -1 texture
+-1 1.0 0.500000
+frame bone texture frame frame =
+= 0.500000 -1 vertex 1.0 material
+0.500000 -1 vertex texture bone material = material
+bone material 1.0
+anim material
+texture
+vertex texture 1.0 vertex frame anim -1 frame
+anim = 1.0 anim -1 anim texture 0.500000 1.0 = 0.500000 material -1
+texture -1 bone
+frame 1.0
+= texture bone
+bone anim = 0.500000 material 1.0
+-1
+material vertex vertex -1 frame vertex texture texture
+1.0 1.0 bone vertex texture -1
+frame
+bone anim 1.0 vertex -1 0.500000 frame
+= material bone anim anim frame frame -1 0.500000 1.0 -1 -1
+frame
+bone anim anim anim -1
+-1
+material vertex = texture
+material vertex texture vertex -1 texture frame -1 0.500000 -1 anim 1.0
+material =
+bone bone bone = =
+1.0 vertex
+anim 1.0 anim
+frame
+bone anim anim 0.500000 bone texture anim 0.500000
+anim vertex
+vertex = bone = vertex
+vertex vertex bone
+-1 bone
+-1
+-1 anim material anim 0.500000
+vertex material material frame vertex = 1.0 0.500000
+material
+-1 1.0 = texture = anim frame = 0.500000 = 1.0 frame anim texture -1 texture = material = anim texture material texture texture
+0.500000
+anim frame -1 bone
+bone -1 texture 1.0 -1
+0.500000 =
+bone texture -1 0.500000 =
+= anim
+frame
+material 1.0 -1
+bone
+-1 -1
+= bone
+=
+frame frame 0.500000
+bone texture =
+texture
+frame material
+0.500000 frame = frame
+frame = 1.0 texture frame -1 material bone frame bone
+anim vertex
+-1 frame
+bone anim -1
+material vertex -1 texture anim vertex 1.0 1.0 0.500000 1.0
+texture -1 -1 0.500000 anim =
+vertex
+-1 texture vertex material =
+= 1.0 1.0
+vertex
+bone texture frame anim frame frame anim material
+-1 texture bone
+= =
+material frame material vertex 0.500000 0.500000 -1 frame bone texture material vertex material
+-1
+-1 -1 -1
+material
+bone anim material vertex 0.500000 0.500000 =
+1.0 material anim material -1
+=
+frame 0.500000
+=
+= 0.500000 1.0 -1 texture -1
+vertex
+bone frame frame = vertex =
+0.500000 material = -1
+1.0
+bone frame material = -1 1.0 = anim frame vertex
+-1 bone vertex
+0.500000 anim
+texture 1.0 0.500000
+material texture texture
+texture 1.0 anim material
+bone
+1.0 frame
+bone
+frame texture 0.500000 frame
+texture vertex anim 0.500000 bone
+1.0
+material
+texture = material =
+-1
+anim anim
+texture anim bone bone 1.0
+material texture anim 0.500000 material 1.0 0.500000 material vertex
+1.0 frame bone 0.500000 0.500000
+-1
+anim
+frame bone bone
+anim 1.0 material vertex anim anim texture 0.500000 material = bone 0.500000
+-1 anim 1.0 frame 1.0
+0.500000 1.0 bone
+= vertex = frame
+1.0
+-1
+0.500000
+vertex
+0.500000 anim material texture texture anim 0.500000 1.0 -1 material anim frame frame
+vertex 1.0
+0.500000
+vertex -1 -1
+vertex frame vertex = 0.500000 -1 1.0
+anim anim bone 0.500000 material
+vertex 1.0
+-1 0.500000 0.500000 frame
+anim -1 anim
+= -1 -1 frame
+1.0
+= texture
+bone texture
+frame 1.0 bone vertex
+anim frame -1
+frame
+0.500000 texture 0.500000 frame bone = material
+1.0 1.0
+1.0
+anim material bone -1 -1 material material bone
+vertex anim -1
+0.500000 vertex 0.500000 texture texture = bone vertex anim -1 1.0 1.0 = material frame bone 1.0 frame 1.0 bone = 1.0
+anim frame 0.500000
+material material
+0.500000
+anim
+bone
+1.0
+= bone vertex 0.500000 texture frame material material frame
+texture frame bone bone texture
+anim -1
+0.500000 =
+texture anim material 1.0
+vertex frame material vertex frame anim vertex bone bone frame anim bone
+material 0.500000 frame
+anim
+0.500000 -1 1.0 frame material =
+anim
+=
+anim vertex anim 0.500000 0.500000 -1 0.500000 = vertex anim anim vertex bone
+-1 = -1 -1 material material -1 0.500000 1.0 = material vertex
+-1 1.0 1.0
+anim anim material
+-1 0.500000 anim vertex 0.500000 material material
+bone texture
+0.500000 = -1 material texture material
+0.500000 =
+material bone
+frame = =
+bone frame = -1 1.0 material 0.500000
+anim
+anim frame
+vertex -1
+anim bone
+material frame -1 bone
+texture =
+texture anim =
+= = vertex
+material = =
+material
+texture 0.500000
+bone
+material texture frame -1 1.0 1.0
+= material
+= material -1 texture =
+texture anim = material = texture material -1 vertex
+vertex = texture
+texture
+0.500000 frame -1
+-1 material
+anim texture bone frame frame anim 1.0 -1 bone = bone vertex
+=
+0.500000
+-1 anim texture bone
+vertex vertex
+-1 -1 1.0 1.0
+bone texture texture
+-1
+1.0 -1 bone = 0.500000
+0.500000 = 0.500000
+0.500000 texture frame material anim anim bone bone
+= texture
+1.0 texture = texture anim texture =
+1.0 material = vertex
+texture 1.0 = material material 1.0
+texture material vertex texture anim 0.500000 1.0 0.500000 1.0
+anim vertex material texture 1.0
+vertex = 1.0 -1 = vertex -1
+1.0 -1 -1 anim bone -1 anim texture vertex frame
+vertex 1.0 1.0
+texture =
+frame 1.0
+-1
+0.500000 texture -1 0.500000 frame
+texture bone
+0.500000 1.0 frame vertex frame 1.0
+0.500000 1.0
+frame vertex vertex texture material 0.500000
+0.500000 material -1
+bone material 1.0 texture 0.500000 texture -1 bone = material material = vertex bone 0.500000
+frame
+1.0 1.0
+texture
+anim frame 1.0 = 0.500000 bone texture material vertex anim = texture material
+anim bone = frame = bone 1.0 anim 0.500000 0.500000
+material
+texture
+bone
+0.500000 vertex bone -1
+bone texture
+bone 1.0 1.0 bone vertex material texture
+-1 = 0.500000
+bone frame 0.500000 vertex material 0.500000 = bone
+frame
+= vertex 1.0 0.500000
+anim material texture bone texture -1 vertex
+= material 0.500000 frame
+1.0 material = -1 -1 frame 1.0 -1 bone
+texture vertex texture 0.500000 texture
+= bone
+0.500000 vertex -1 bone -1 -1 1.0 -1 anim
+1.0
+frame
+anim 0.500000 bone
+anim 1.0 -1 frame -1 texture 1.0 1.0
+anim vertex anim material anim
+vertex 1.0
+frame -1 texture -1 anim bone frame 1.0 -1
+material
+1.0 1.0 bone = texture
+texture bone
+= vertex bone material 1.0 vertex
+vertex
+anim = anim vertex anim -1 frame anim 1.0 1.0 = texture
+frame anim 1.0 = vertex texture
+-1 frame
+anim 1.0
+1.0 1.0
+=
+= -1
+bone frame
+1.0
+anim anim texture material -1 vertex 1.0
+0.500000 f
\ No newline at end of file
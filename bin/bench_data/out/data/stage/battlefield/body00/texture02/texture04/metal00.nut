@@ -0,0 +1,44 @@
+material vertex 0.500000 material bone -1 bone 0.500000 =
+1.0 1.0 anim -1 1.0
+= material bone
+material
+bone anim frame vertex bone material
+frame vertex 0.500000 -1 = frame vertex material
+frame 1.0 texture
+-1 bone 0.500000
+frame anim
+anim
+0.500000
+1.0 material 1.0 frame -1 =
+-1 0.500000
+0.500000 frame 0.500000 bone material = material bone = frame material
+material frame -1
+material = frame
+frame 1.0 0.500000 material -1 frame 1.0 anim -1
+-1 frame =
+1.0
+anim vertex -1
+0.500000 -1 1.0 1.0 texture bone texture
+= texture anim material
+anim bone
+anim
+texture material 1.0
+= = anim 0.500000 0.500000 texture anim =
+material
+texture frame
+anim vertex
+= frame
+material
+vertex texture
+material
+-1 1.0
+frame -1 vertex 1.0 texture 0.500000 bone -1 -1 frame -1
+bone
+bone bone anim 1.0 texture 1.0
+0.500000
+texture material vertex -1
+vertex
+= anim
+0.500000 -1 vertex
+material vertex material 1.0 frame
+0.500000 texture textu
\ No newline at end of file
@@ -0,0 +1,12 @@
+texture = 0.500000 material = vertex 0.500000
+0.500000 1.0
+frame texture
+bone texture anim texture 0.500000
+material
+= -1 vertex
+material
+vertex -1
+0.500000 bone bone 1.0 texture bone = anim texture 0.500000 frame 0.500000 texture material
+1.0 texture material = = anim
+=
+material material vertex -1 1.0 frame frame = vertex -1 
\ No newline at end of file
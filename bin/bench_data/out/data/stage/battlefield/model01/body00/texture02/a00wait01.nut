@@ -0,0 +1,96 @@
+texture frame 1.0 bone
+texture
+texture vertex texture 1.0 -1 0.500000 texture
+= 1.0 vertex bone anim frame =
+1.0 material =
+1.0 material 0.500000
+= frame
+texture
+material
+material
+1.0 1.0 vertex
+frame = vertex material -1 = = 0.500000 1.0
+bone anim vertex texture vertex
+texture
+bone vertex frame = material 0.500000 texture = texture 0.500000 -1 0.500000 material
+anim material = texture -1 1.0 frame texture bone = 0.500000 -1 anim texture
+material 1.0 vertex 0.500000 frame -1 vertex material
+-1 frame
+vertex
+0.500000 -1 bone 1.0 0.500000 bone texture
+= frame = frame
+bone
+anim bone = frame =
+bone texture vertex texture 1.0 anim
+= material bone frame 0.500000 1.0 1.0
+= -1 material -1
+-1 = 0.500000
+-1
+-1
+texture material 1.0 frame 1.0
+= -1 -1 texture
+vertex -1 frame
+0.500000
+1.0
+-1 material
+0.500000
+material
+bone
+bone frame vertex
+anim anim =
+anim bone =
+bone
+material texture
+texture = texture 1.0 0.500000 bone
+= anim texture material texture bone material
+material bone -1 material
+0.500000
+frame
+1.0 bone vertex -1 1.0 =
+frame frame 1.0 anim
+texture 1.0 -1
+material -1 anim
+1.0
+vertex
+anim
+-1 =
+texture
+=
+-1
+anim -1 bone = texture 0.500000
+anim frame
+=
+anim
+texture
+vertex
+texture
+anim bone
+texture
+texture 1.0 0.500000
+anim -1
+0.500000
+1.0 0.500000 -1 0.500000 material texture bone 0.500000 vertex =
+frame -1 -1 frame texture
+0.500000
+bone vertex material 1.0 = 0.500000 frame 1.0 -1 texture 0.500000
+texture
+material
+frame
+vertex
+-1 anim 1.0
+material 0.500000 -1
+= material
+material bone material texture = texture
+vertex frame
+= material anim frame frame bone bone texture 1.0 texture 0.500000
+vertex = 0.500000 = 1.0
+material material bone
+anim anim anim -1 vertex anim 0.500000 0.500000 material material
+material 0.500000
+= material texture texture vertex -1
+0.500000 1.0 1.0 anim bone = 1.0 frame anim =
+1.0
+= texture 1.0 vertex 0.500000 0.500000
+anim vertex
+anim frame
+frame vertex 1.0 bone = 0.500000 frame = material bone anim material 0.500000 0.500000 -1 =
\ No newline at end of file
@@ -0,0 +1,5 @@
+anim anim 0.500000
+frame = frame anim frame 1.0 = vertex 0.500000 frame 0.500000
+material texture
+texture -1 = material vertex vertex bone frame
+= texture 1.0 = 0.500000 material 
\ No newline at end of file
@@ -0,0 +1,242 @@
+-1 0.500000 1.0 0.500000
+texture bone -1 bone 0.500000 bone
+1.0 bone anim -1 texture 0.500000
+0.500000 bone = frame
+= texture -1 = bone texture 0.500000 vertex vertex
+bone
+vertex 0.500000 0.500000
+1.0 bone 0.500000 material
+vertex 0.500000
+vertex 0.500000
+bone texture anim 1.0 0.500000 -1 material = frame = = bone
+frame
+anim 1.0 texture
+frame vertex 0.500000 vertex bone frame -1
+vertex bone 1.0
+= bone frame vertex
+-1 anim
+1.0
+-1 anim
+1.0 texture -1 texture anim frame anim material
+material = texture -1 1.0 texture anim 1.0 anim
+anim 1.0 -1 material
+-1 anim frame
+0.500000 0.500000 0.500000
+0.500000 texture
+-1 -1
+material 0.500000 -1
+texture -1 vertex vertex material 0.500000 frame anim material
+frame material material 1.0
+material bone texture
+bone bone
+-1 = -1 frame = texture vertex 1.0 material vertex texture frame
+0.500000 anim
+-1 0.500000
+-1
+vertex anim anim
+frame material frame =
+bone bone = = frame 0.500000 = material texture
+vertex bone
+bone
+material
+vertex
+1.0
+1.0
+0.500000 = bone
+-1 1.0 texture vertex
+bone
+anim
+= material 0.500000 texture bone bone 0.500000 material = texture 1.0
+frame 1.0 anim
+vertex -1 vertex
+vertex 1.0 1.0 1.0
+1.0 texture
+frame frame frame -1 bone texture 1.0
+bone
+0.500000
+anim
+texture anim anim texture
+bone bone bone bone
+frame
+texture = frame bone 0.500000 bone
+material =
+-1 vertex =
+= anim bone material anim material vertex = anim frame texture = = bone vertex frame = vertex material
+-1 bone 0.500000
+vertex
+material
+texture texture = anim -1 vertex 1.0 =
+texture 1.0 = = vertex anim material
+-1
+anim
+0.500000
+= vertex
+0.500000
+vertex anim anim 1.0
+material anim = vertex material = -1 anim vertex material
+frame material bone anim anim
+anim bone
+frame bone texture bone frame -1 =
+frame anim =
+-1
+= frame material anim
+frame vertex
+anim texture frame
+= vertex 1.0
+1.0 0.500000 = -1 vertex material 0.500000 anim
+texture = -1
+anim texture bone
+texture = material
+frame vertex vertex = anim 1.0 anim material
+texture anim = texture bone 1.0 material -1
+anim vertex vertex = =
+=
+material material bone texture vertex -1 1.0
+material
+= vertex anim = material
+frame = 1.0 anim anim material material
+=
+material
+= material anim
+material vertex
+vertex texture texture
+anim material texture =
+1.0 texture 1.0 1.0 material anim vertex = -1 = material -1 0.500000 texture material bone
+anim
+anim anim texture frame
+= -1 material 1.0
+bone -1 material
+material texture 1.0 vertex
+frame -1 bone 1.0 =
+bone 1.0 =
+anim
+vertex 1.0 1.0
+material = -1 frame
+frame bone anim material 1.0 -1 frame -1 texture = material anim anim material 0.500000 = 0.500000 texture
+anim bone
+= frame -1 bone frame frame
+= 1.0
+vertex frame frame
+-1 vertex frame
+material bone
+texture 1.0 =
+1.0 vertex -1 = texture material texture 1.0
+anim
+-1
+1.0 frame = frame
+vertex
+frame = -1
+vertex =
+texture
+frame -1 frame bone 1.0 =
+material
+bone
+bone frame material anim = vertex frame vertex 1.0
+anim frame bone anim 1.0 1.0 texture 0.500000 = -1
+0.500000 -1 vertex bone texture bone 1.0 material
+1.0 1.0 material material frame
+0.500000 vertex material 1.0 1.0 material
+anim frame 1.0 vertex anim 1.0
+-1 texture -1
+frame anim 1.0 bone material 0.500000 texture 0.500000 bone =
+0.500000 anim bone -1 bone material -1 material vertex vertex 1.0 =
+=
+= 0.500000 bone
+frame
+1.0
+-1 anim frame 1.0
+frame 0.500000 1.0 vertex -1 1.0 frame = 1.0 material 1.0 frame vertex bone texture bone anim bone = 1.0
+0.500000
+0.500000 = texture texture frame frame
+vertex 1.0 vertex material 1.0 bone = frame -1 texture 0.500000 anim
+vertex frame material
+1.0
+0.500000 1.0 = = 1.0 -1 texture anim 1.0
+material
+material
+material
+= texture -1 1.0
+bone frame bone
+bone
+1.0 frame
+material vertex
+= 1.0
+-1 0.500000 vertex
+anim texture anim
+=
+0.500000
+vertex anim 0.500000 -1 bone
+frame anim texture bone 1.0 1.0 = material vertex -1 frame frame vertex -1 bone
+frame frame
+vertex -1 frame bone vertex 1.0 anim texture vertex bone 1.0
+1.0 -1
+= = =
+anim
+material 0.500000
+0.500000
+texture anim anim
+material anim 1.0 1.0 anim = 1.0 vertex -1 texture -1 -1 = 1.0 1.0 = anim 0.500000 0.500000 frame
+0.500000 bone texture bone vertex anim
+1.0 bone -1 material texture vertex bone -1 -1 vertex
+texture material frame
+material anim vertex vertex -1
+material frame 1.0
+vertex material
+bone material vertex material 0.500000 1.0 anim
+-1
+bone bone vertex
+-1
+bone anim = frame texture texture 0.500000 0.500000 vertex = -1 bone -1 0.500000 texture -1
+-1
+= = texture -1 0.500000 frame
+anim
+= 0.500000 vertex texture -1 = texture frame 0.500000
+frame
+anim
+texture
+0.500000 1.0 0.500000 frame
+frame
+bone frame
+material
+anim texture 1.0 -1 -1 = bone 0.500000
+1.0 -1 vertex 0.500000 frame = bone
+anim
+= =
+texture = material 0.500000 material 0.500000
+texture texture -1 1.0 -1 texture vertex
+bone
+1.0 1.0 = =
+material texture
+bone -1 -1 anim texture
+anim 0.500000 material 0.500000
+vertex vertex 0.500000 vertex
+anim
+0.500000 anim 1.0 1.0 material
+bone
+0.500000 = texture anim
+0.500000
+bone material frame
+0.500000 material
+1.0 bone anim material anim vertex anim bone -1 0.500000
+0.500000 material
+material material texture material vertex frame
+0.500000 texture texture 0.500000 bone
+frame texture bone
+texture 1.0
+frame
+= bone vertex anim = vertex vertex frame 0.500000 vertex
+-1 vertex
+frame
+1.0 frame vertex frame texture 1.0 -1 1.0 0.500000 0.500000 frame frame 0.500000
+-1 vertex 1.0
+-1 1.0 0.500000
+anim texture texture 1.0
+1.0 bone
+anim -1 material
+0.500000 1.0 1.0
+1.0 material material texture frame
+frame frame 1.0 frame 0.500000 -1 texture anim frame anim
+texture
+0.500000
+bone
+-1 bone -1 anim bone bone frame 1.
\ No newline at end of file
@@ -0,0 +1,7 @@
+0.500000 frame frame -1 texture 1.0
+0.500000
+-1 0.500000 anim
+frame
+texture
+bone -1 frame texture frame material 0.500000 1.0
+material anim frame anim texture anim bone vertex vertex vertex frame texture
\ No newline at end of file
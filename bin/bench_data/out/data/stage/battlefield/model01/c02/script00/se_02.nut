@@ -0,0 +1,296 @@
+frame
+vertex 0.500000 = vertex frame vertex 1.0 0.500000 bone texture
+anim anim
+frame 0.500000 texture 0.500000
+material
+material 0.500000
+= = bone 1.0 anim
+material frame texture -1 0.500000 1.0 0.500000
+frame -1 frame anim texture vertex 0.500000 anim texture bone 1.0 texture texture frame -1 0.500000 bone =
+texture 0.500000 frame
+anim frame texture = texture
+-1
+frame 1.0 1.0 bone bone
+anim
+texture frame
+texture
+frame -1 texture
+vertex
+-1
+bone 1.0 -1 bone
+vertex vertex
+texture vertex
+texture vertex
+= -1 texture anim 1.0 1.0
+anim = bone 1.0 frame
+0.500000 1.0 frame anim 1.0 frame texture bone
+-1 texture bone vertex -1
+anim 0.500000 0.500000 vertex texture material
+= texture =
+1.0 -1 texture
+frame bone texture bone
+= vertex frame texture 1.0 = -1
+0.500000 vertex texture frame anim 0.500000
+material texture bone 1.0 0.500000
+-1 vertex -1
+anim vertex
+vertex
+0.500000 texture texture -1 -1 bone
+material vertex = vertex anim frame vertex bone texture 1.0 texture
+= frame 0.500000
+= vertex 1.0 = = material material
+material bone vertex
+= 1.0 vertex anim
+0.500000 anim 1.0 1.0 = material bone
+-1 vertex texture
+texture frame 1.0 frame 0.500000 vertex bone 0.500000 =
+material
+1.0
+1.0 1.0 1.0 1.0 material 0.500000 anim
+material
+anim frame
+anim vertex =
+-1
+texture frame = material vertex
+frame =
+1.0
+frame
+material texture 0.500000 -1 frame material
+material bone = -1 1.0 frame bone = 1.0 texture material texture material -1 material -1 frame 1.0 material -1
+1.0
+anim = anim -1 texture -1
+frame -1 -1
+anim
+0.500000 texture vertex 1.0 anim frame = -1
+frame
+=
+anim anim -1 frame 0.500000 0.500000 bone bone vertex anim anim 0.500000 1.0 material texture anim
+-1 frame frame material material anim
+1.0
+1.0 1.0 bone texture -1
+-1 -1 bone 0.500000
+=
+= bone
+material texture 1.0 vertex vertex
+-1 material 0.500000 1.0 anim texture 0.500000
+texture vertex material
+0.500000 0.500000 bone
+vertex 0.500000
+material anim material bone
+anim bone -1 material
+frame
+frame = frame vertex frame texture
+0.500000 frame 0.500000 frame
+0.500000 =
+= vertex
+texture 0.500000 1.0 bone vertex
+1.0 vertex material
+-1 -1
+= =
+0.500000
+anim 1.0 0.500000 0.500000 -1 anim -1
+-1
+1.0
+frame
+-1 texture bone -1 -1 texture material vertex anim bone texture = 0.500000 vertex texture frame
+anim = frame 0.500000 bone -1
+vertex 0.500000
+-1
+= frame frame frame
+0.500000
+-1 =
+0.500000 1.0 vertex bone
+frame vertex 1.0 material 1.0 = anim = material anim = anim texture material
+= bone material
+material anim material material
+0.500000 texture
+anim texture bone vertex anim material
+texture
+texture
+anim bone texture frame frame texture -1 1.0 bone -1 material 1.0
+bone -1
+-1 vertex anim texture vertex
+anim
+bone =
+bone 1.0 bone
+= vertex 0.500000 material material
+texture bone material vertex bone =
+material 0.500000 1.0 anim texture 0.500000 bone 1.0 material texture material bone
+frame -1 frame
+= vertex vertex 0.500000 material
+bone
+anim = texture anim 0.500000 anim texture frame texture -1 vertex
+frame 1.0
+0.500000 0.500000 anim material = texture bone
+1.0 frame material vertex -1 anim = 0.500000 bone 0.500000 -1 texture material material vertex 0.500000 =
+vertex 0.500000 0.500000 anim
+0.500000 bone
+-1 0.500000
+1.0
+0.500000
+bone
+frame -1 material bone
+1.0 -1 -1 anim texture 0.500000 1.0
+= bone vertex material material texture frame
+texture texture vertex
+-1 texture anim anim -1 1.0 = material texture 1.0
+bone material anim 1.0 texture texture
+bone frame vertex bone material 0.500000
+0.500000 bone texture anim
+1.0
+-1
+texture anim texture 0.500000 material vertex
+= 1.0 bone
+0.500000 vertex bone anim material frame
+-1 texture
+frame = texture 1.0 = frame anim
+1.0 material bone frame 0.500000
+=
+texture
+material frame 0.500000 0.500000 vertex
+frame
+0.500000 frame texture anim bone vertex -1 anim frame =
+frame 0.500000 frame -1 vertex 1.0 vertex
+anim vertex vertex material texture = vertex -1 -1 texture -1 bone vertex material material material anim 1.0 material 1.0 = vertex 1.0 anim texture anim -1
+vertex material anim texture vertex material material -1 bone
+1.0
+= 0.500000 texture bone
+0.500000 = vertex texture vertex frame
+material anim
+texture 0.500000 0.500000 -1 vertex 1.0 anim -1 anim vertex 0.500000 0.500000
+= =
+= =
+anim anim 1.0 material anim
+material -1 1.0
+= anim frame
+= = vertex texture 0.500000 = -1 vertex bone material bone frame 0.500000 vertex 1.0 vertex material = material =
+frame vertex bone bone frame = =
+vertex texture vertex -1 frame
+-1 texture
+vertex
+=
+anim vertex texture
+bone bone
+= bone texture texture vertex material = frame 1.0
+texture
+texture
+material -1 = 1.0 0.500000 0.500000
+0.500000
+texture 0.500000 = -1 anim texture texture vertex -1 vertex 1.0
+material 1.0 frame material bone bone 0.500000
+0.500000 bone -1 texture
+frame 1.0
+bone
+texture material bone material
+-1
+material 1.0 =
+1.0 anim texture
+material frame material -1 anim bone material
+= -1 = -1 -1 material anim
+0.500000
+-1 anim vertex -1 vertex material
+material frame bone 0.500000
+1.0 bone bone material anim anim
+texture
+vertex -1 frame 0.500000 -1
+= frame texture
+anim anim frame frame texture
+=
+bone anim
+vertex -1
+texture -1 frame bone texture
+anim
+anim
+vertex -1
+= vertex vertex
+bone vertex 0.500000 anim 1.0 frame -1 bone frame 0.500000 =
+-1 =
+= texture material -1 texture texture 0.500000 1.0 -1 = anim
+bone texture bone -1
+material -1 material bone texture 1.0 texture -1
+texture = vertex bone -1 0.500000 -1 0.500000 = =
+0.500000 texture = -1 vertex texture vertex
+texture
+0.500000 vertex frame vertex
+0.500000 bone
+-1 1.0 = texture = material bone 1.0 bone texture
+-1
+anim texture = material
+bone -1
+texture 1.0
+= material anim bone material -1
+0.500000 -1
+vertex =
+bone vertex 0.500000 texture texture -1 frame =
+material anim material
+bone
+0.500000 texture
+0.500000 =
+1.0 frame
+-1 material
+-1 0.500000 vertex texture material anim frame
+= anim 1.0 material texture bone texture material vertex frame -1 texture 0.500000
+texture bone frame vertex
+= bone bone texture material texture
+vertex = texture material -1 bone texture = 1.0 vertex 1.0 bone bone
+anim anim
+material
+material
+vertex =
+vertex frame
+texture texture bone
+0.500000
+= = -1 texture anim anim material
+frame 1.0 material
+vertex -1 -1 texture anim
+vertex 1.0
+0.500000 1.0 vertex vertex 0.500000
+=
+bone
+0.500000 -1 1.0 = =
+bone
+bone 0.500000 -1 1.0 =
+texture anim = bone = anim
+-1
+vertex anim
+-1 bone
+= vertex frame 1.0 bone =
+bone frame -1
+material 1.0
+material anim anim -1 = bone 0.500000 vertex 1.0
+texture frame material
+texture = -1 -1 =
+frame frame frame
+= texture anim
+=
+texture -1 = bone vertex material 1.0 = -1 bone
+anim -1
+material anim =
+= 1.0 material
+texture
+-1 -1 -1
+-1 texture
+1.0 texture material 1.0
+vertex 1.0
+texture
+-1
+1.0
+bone
+= frame
+vertex 1.0 =
+texture
+vertex frame anim
+0.500000 anim = texture 0.500000 -1
+texture 1.0 anim 0.500000 -1 bone 1.0 0.500000 frame material vertex 1.0 bone frame
+1.0 1.0
+vertex 1.0 = vertex = anim
+0.500000 1.0 anim 0.500000 -1 anim material = frame 1.0 = =
+1.0 1.0 material = 0.500000 frame material 1.0 bone material
+vertex = = texture frame anim
+bone bone frame texture 1.0 frame material 0.500000 bone frame 0.500000
+frame texture texture
+0.500000
+material 1.0 = material texture bone
+material texture
+= 1.0
+material 
\ No newline at end of file
@@ -0,0 +1,20 @@
+anim
+0.500000 -1 0.500000 frame texture bone = 0.500000
+material bone
+vertex 1.0 frame 1.0 anim frame vertex 0.500000 vertex
+= frame frame frame frame 0.500000 -1
+frame 0.500000 material frame -1 -1 = material
+vertex bone
+anim 0.500000
+texture
+1.0 vertex -1 material -1 = vertex 0.500000
+anim -1
+anim
+anim
+=
+-1 = anim
+material = vertex 0.500000 material material anim vertex -1 0.500000
+0.500000 0.500000 anim -1 texture -1 material frame
+0.500000 1.0 0.500000
+bone bone vertex
+materi
\ No newline at end of file
@@ -0,0 +1,5 @@
+bone 0.500000 = frame vertex
+1.0 = bone
+texture material anim 1.0 0.500000 vertex -1 material 0.500000
+0.500000 anim
+0.5000
\ No newline at end of file
@@ -0,0 +1,3 @@
+KiNn沮U{i`7._	*'ou}A޷қfZ;G+G
+&B
+d
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000 = 0.500000 bone texture material -1 frame frame bone
+=
+anim 0.500000 -1
+= 0.500000
+0.500000 material -1 1.
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone -1 frame 0.500000 -1 material material -1 0.500000 bone -1
+texture ani
\ No newline at end of file
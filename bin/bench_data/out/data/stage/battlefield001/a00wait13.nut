@@ -0,0 +1,59 @@
+-1 material =
+vertex vertex -1 material frame material
+vertex
+anim anim texture 0.500000 bone frame vertex 0.500000
+frame -1 bone vertex -1 = =
+texture -1 material 1.0 1.0 material frame 0.500000 -1 bone
+texture material bone vertex
+frame frame material bone material texture frame = bone anim anim frame -1 frame -1 -1
+-1
+anim material = bone
+anim anim vertex 0.500000 anim = 1.0 material
+= -1
+1.0 1.0 bone
+vertex frame
+material
+1.0
+texture vertex texture
+frame 0.500000 texture 1.0 texture 0.500000 frame -1 material vertex = -1 material
+material 0.500000 material -1 0.500000 anim
+1.0 = 1.0 texture
+frame -1
+vertex
+bone bone 0.500000 0.500000
+1.0 texture 1.0
+texture anim -1
+anim = material vertex -1
+vertex anim 1.0 vertex
+material anim 1.0 = bone = 1.0 = vertex
+material = material -1 material anim material
+material texture
+material -1 vertex
+frame texture 1.0 -1 0.500000
+-1 texture = texture 1.0 =
+texture 1.0 =
+bone bone bone texture 0.500000 material = frame bone frame bone material anim bone
+frame = texture bone 0.500000 0.500000 1.0 texture
+-1 0.500000 texture frame
+material material texture
+-1 material
+=
+frame material 1.0
+material
+0.500000
+anim
+0.500000 material
+material 1.0 bone 0.500000 bone bone 1.0 texture frame
+frame 1.0
+anim
+-1
+texture
+bone texture vertex =
+texture
+frame 0.500000 texture -1
+0.500000 0.500000 frame anim material vertex
+frame
+1.0
+anim texture bone frame material texture
+-1
+1.0 0.50
\ No newline at end of file
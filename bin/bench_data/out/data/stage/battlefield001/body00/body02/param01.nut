@@ -0,0 +1,3 @@
+anim bone 1.0 vertex -1 = material texture vertex bone material
+texture =
+frame texture 0.500000
\ No newline at end of file
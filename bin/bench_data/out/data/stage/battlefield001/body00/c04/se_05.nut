@@ -0,0 +1,40 @@
+-1
+texture
+bone
+material vertex bone 1.0 1.0
+vertex -1 material bone anim material
+= vertex material
+= frame
+bone bone anim texture material
+bone -1 frame -1 bone frame bone
+vertex
+anim material vertex
+bone 0.500000 -1
+-1 0.500000 -1 bone anim = material texture 0.500000 vertex
+bone
+texture material 0.500000
+0.500000 0.500000 material 1.0 material -1
+texture vertex frame texture 0.500000 anim bone frame vertex
+material anim -1
+0.500000
+material
+-1 texture =
+vertex =
+vertex
+bone material bone 0.500000
+bone -1 material 1.0
+frame texture frame
+anim bone = =
+1.0 anim texture anim
+texture 0.500000 = anim texture frame -1 bone texture texture bone vertex texture anim material frame vertex =
+anim
+bone vertex bone anim frame 1.0 1.0 0.500000 0.500000
+0.500000
+texture material texture = 0.500000 bone -1
+vertex 1.0 bone
+1.0 anim material =
+texture 0.500000
+bone 1.0 texture bone frame 1.0 material = 1.0
+1.0 vertex
+= bone vertex 1.0 frame frame material 0.500000 vertex 1.0
+= mate
\ No newline at end of file
@@ -0,0 +1,12 @@
+bone bone vertex bone texture = anim 1.0 material
+frame
+material
+frame material texture -1
+bone bone
+1.0
+texture
+0.500000 frame anim texture
+material 0.500000 =
+0.500000 vertex texture frame
+anim
+0.500
\ No newline at end of file
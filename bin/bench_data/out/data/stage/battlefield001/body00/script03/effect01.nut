@@ -0,0 +1,13 @@
+texture
+anim
+texture
+-1
+material 1.0 = texture material
+frame 0.500000 bone
+vertex vertex
+vertex anim
+anim 1.0 1.0 anim -1 anim -1
+bone = frame = = frame anim bone
+frame vertex
+vertex frame texture -1 material texture
+material bone material 0.500000 0
\ No newline at end of file
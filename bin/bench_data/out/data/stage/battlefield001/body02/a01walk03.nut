@@ -0,0 +1,18 @@
+0.500000 frame 1.0
+texture
+= = material bone
+anim anim
+vertex material
+texture texture anim vertex -1
+vertex = texture frame bone material
+anim
+= frame anim
+bone frame material texture 0.500000 0.500000 anim = frame vertex bone texture vertex
+= 1.0 bone 1.0 0.500000 0.500000
+texture frame
+bone texture vertex 0.500000 = anim -1 frame anim
+anim
+-1 vertex 1.0 1.0 texture
+texture frame -1 1.0 -1 -1 bone -1 frame
+-1
+texture frame bone anim
\ No newline at end of file
@@ -0,0 +1,246 @@
+1.0 bone =
+vertex bone texture anim
+frame
+-1 1.0 -1 0.500000 = texture frame bone bone = bone anim
+= -1
+anim vertex frame anim
+texture anim material
+anim anim frame texture
+anim anim
+vertex material -1 0.500000 1.0 material vertex bone frame bone -1 anim anim material
+=
+texture vertex
+texture 0.500000 material bone
+vertex vertex 1.0 -1 frame vertex material frame
+texture
+vertex 0.500000 =
+= =
+bone
+-1
+-1 anim anim =
+material material 1.0 -1 texture frame
+= -1 0.500000 material anim bone material = frame
+anim vertex frame 1.0
+-1 -1
+=
+material
+=
+vertex vertex
+texture -1 anim 0.500000 1.0 frame anim vertex frame -1
+texture texture material material bone 0.500000
+1.0
+frame frame 1.0 bone = 0.500000
+frame
+1.0 bone frame
+vertex frame
+vertex
+0.500000 vertex 0.500000 0.500000 bone
+material anim texture = 1.0
+texture
+bone anim bone 1.0
+texture texture
+0.500000 1.0 vertex
+frame frame texture vertex
+vertex 0.500000 =
+frame material vertex
+1.0 1.0 bone anim
+vertex bone bone 1.0
+0.500000 frame 0.500000 = material
+texture texture
+0.500000
+anim bone = texture =
+material = texture material anim = frame
+= frame
+material
+vertex
+vertex material = texture bone =
+0.500000
+vertex -1 frame material
+-1 bone bone 0.500000 -1 -1 frame vertex frame 1.0 frame
+bone
+1.0 texture anim bone -1 texture
+bone
+texture anim anim
+bone frame = anim material material texture material 1.0
+anim bone texture frame frame
+-1 texture
+1.0 0.500000 0.500000
+-1 texture -1 frame -1 material bone bone
+anim 0.500000 anim
+vertex vertex
+1.0 1.0 = anim texture
+= = bone
+-1 =
+frame
+1.0 bone -1 1.0
+texture frame =
+vertex bone 1.0 frame texture texture material 0.500000 =
+-1
+-1
+texture
+1.0
+-1 0.500000 frame material material vertex = 1.0
+0.500000 frame 0.500000
+0.500000 0.500000 anim -1 0.500000 texture
+bone texture 1.0 -1 0.500000
+texture 1.0 texture vertex = 0.500000
+anim material material = texture vertex anim
+texture 1.0 frame 1.0 =
+1.0 texture anim vertex bone
+0.500000 -1 = 1.0
+frame vertex 1.0 1.0 frame = 0.500000 material frame frame
+vertex vertex 0.500000 texture texture =
+1.0
+material
+-1 material = frame
+= bone = 0.500000 0.500000 0.500000 -1 -1
+frame frame
+material frame =
+0.500000 bone bone frame vertex vertex = frame = 0.500000
+anim
+1.0 texture bone
+frame
+-1 1.0 =
+= bone vertex vertex vertex -1 bone frame bone -1 vertex 0.500000 -1 anim 1.0 anim 1.0 = material
+0.500000 bone vertex = vertex texture vertex material 0.500000
+=
+frame
+bone 1.0
+1.0 texture = 0.500000
+0.500000 anim vertex 1.0 anim -1
+0.500000 vertex vertex
+anim -1 bone vertex bone texture -1 texture bone
+material texture material 1.0 bone vertex bone anim anim bone
+frame
+-1 anim =
+1.0
+vertex vertex vertex vertex vertex = frame material 0.500000 anim texture bone material frame -1 frame bone material
+anim vertex bone vertex -1 frame frame bone vertex vertex = = texture 1.0 -1 texture anim
+0.500000
+frame frame anim bone
+material anim
+frame
+-1 bone
+frame = 1.0
+texture
+texture material bone -1
+= texture vertex frame
+material 0.500000 0.500000 material =
+texture material vertex vertex -1 = anim frame texture anim bone 0.500000
+vertex
+vertex
+texture
+material 0.500000
+-1 vertex frame 0.500000 material
+0.500000
+1.0 bone = material 0.500000
+-1 anim bone material bone material bone 1.0 frame vertex texture material 0.500000 frame
+material frame bone material vertex -1 =
+anim texture anim
+vertex
+frame material vertex vertex = -1 texture
+0.500000 material frame
+texture bone 1.0 vertex material
+= -1 0.500000 texture frame bone 1.0 = frame anim
+0.500000 = 1.0 material
+1.0 texture texture
+bone
+anim 1.0 texture
+=
+frame anim texture 1.0 -1 vertex 1.0 frame material texture
+frame 1.0 frame anim vertex bone -1 -1 anim vertex frame anim 0.500000 0.500000 texture texture material
+material =
+texture = 0.500000 vertex 0.500000 0.500000 bone
+-1
+frame 1.0 =
+texture anim bone texture bone 1.0 material bone bone bone
+anim vertex
+anim anim -1 0.500000 frame = frame
+-1
+texture texture 0.500000 -1 -1 0.500000 texture =
+material anim material = texture anim
+-1 -1
+material -1 bone vertex
+0.500000 =
+anim -1
+vertex anim vertex
+frame material
+frame frame -1 vertex 0.500000
+vertex material frame = material
+bone
+=
+anim bone vertex
+frame
+-1
+frame 0.500000 = 0.500000 bone texture -1
+material texture 0.500000 vertex 1.0 bone
+texture
+material vertex
+1.0 vertex
+vertex texture
+material anim bone bone 1.0 texture
+anim vertex anim 1.0
+anim
+material texture texture 1.0 material 0.500000 texture frame 0.500000
+anim
+material -1 = = =
+vertex -1 bone
+frame 1.0 texture = frame
+frame = material
+0.500000 vertex
+anim 1.0
+0.500000 1.0 vertex texture vertex -1 vertex = bone texture bone bone 1.0
+1.0
+-1 frame vertex texture anim
+bone 1.0 anim 0.500000 anim frame = vertex 1.0 material material vertex 0.500000 texture material
+frame 0.500000 1.0 -1 vertex frame -1
+bone -1 0.500000 0.500000
+texture 0.500000 anim bone = anim 0.500000 1.0 vertex =
+material frame
+bone = material vertex frame bone
+texture texture = 1.0 1.0
+texture 1.0
+frame material
+frame -1 bone =
+bone = 1.0
+vertex -1
+0.500000 frame = material vertex 0.500000 -1
+-1 material vertex material -1 material 0.500000 anim bone frame material -1
+vertex = anim 1.0 material 0.500000 anim vertex bone frame frame -1 -1 1.0 1.0 = texture 0.500000 0.500000
+anim vertex texture anim
+0.500000 material -1 anim frame
+-1 frame material bone material texture texture = texture
+bone frame = 1.0 vertex = = vertex 0.500000 1.0 1.0 frame 0.500000 anim
+0.500000 =
+frame = anim texture
+texture
+= material -1 vertex
+vertex
+0.500000 texture 1.0
+frame
+texture material
+1.0
+1.0
+material
+vertex vertex texture anim frame texture
+-1 frame -1
+vertex anim
+-1 0.500000 1.0
+texture frame -1 anim frame material texture 0.500000 1.0 material
+texture -1
+texture =
+-1
+= -1 bone texture 1.0 0.500000 vertex -1 bone = bone bone
+texture =
+= vertex = bone
+frame 1.0 anim frame bone =
+-1 texture anim bone 1.0 -1
+-1 anim anim material frame = frame bone = = material
+anim anim
+texture
+1.0 material texture -1 anim anim = material frame bone frame 1.0 = bone -1 0.500000 1.0 0.500000 = bone
+-1 1.0 material
+material material anim material frame texture = = texture anim
+= bone -1 frame
+-1 frame 1.0
+-1 anim anim bone texture material bone 1.0 material
\ No newline at end of file
@@ -0,0 +1,141 @@
+vertex
+bone frame material material 0.500000 bone bone frame bone frame 1.0 =
+vertex 0.500000 bone = bone
+1.0 0.500000 material material frame
+anim frame texture 0.500000 bone = 0.500000 anim texture
+material vertex frame frame 1.0 frame = vertex vertex -1 = anim
+frame
+vertex material =
+-1 0.500000 0.500000
+frame vertex texture 0.500000 1.0 frame material vertex material frame bone 0.500000
+material anim
+vertex
+texture
+anim 1.0 texture texture -1 frame
+-1 -1 1.0 = texture = 0.500000 1.0 = -1 anim vertex
+frame anim anim = bone -1 -1
+0.500000 -1 0.500000
+-1
+anim material material frame anim =
+= 1.0 frame = material
+-1 -1 frame
+1.0 frame vertex material 1.0 material anim
+frame 1.0
+frame anim 1.0 1.0
+bone material 0.500000 frame -1 vertex bone
+frame frame frame 1.0 frame 0.500000 = bone frame 1.0 vertex 0.500000 texture = frame 0.500000 =
+bone 1.0
+frame anim bone bone material texture frame material 0.500000 bone -1
+texture 1.0
+vertex 0.500000 bone texture anim
+anim 1.0 0.500000
+-1 material bone
+= material anim frame
+bone material 1.0
+vertex = bone bone
+vertex -1 material material
+=
+bone frame 0.500000
+anim -1 = bone frame =
+-1
+-1 vertex
+vertex frame
+0.500000 vertex -1
+material texture
+-1 -1 anim
+1.0 texture
+material material bone frame vertex
+anim 1.0 material texture -1 1.0 texture -1 frame 1.0 0.500000
+1.0 frame frame texture
+vertex
+frame vertex texture bone
+frame 0.500000 bone 1.0 vertex vertex frame = -1 -1 texture
+material frame 1.0 material frame anim 1.0
+1.0
+-1
+-1 1.0 -1 material
+1.0 anim material bone -1 texture -1 bone
+-1 -1 texture texture 1.0 0.500000
+0.500000 vertex material vertex 1.0
+frame 1.0 bone
+= texture material bone texture frame vertex 1.0 material
+-1 1.0 1.0 material texture 0.500000 1.0 material
+material bone texture vertex vertex vertex
+1.0 -1
+bone bone -1 frame
+bone material texture bone
+vertex anim material
+= 0.500000 anim
+frame bone bone anim 0.500000 =
+1.0
+vertex = 0.500000 -1 1.0 material 1.0 texture frame
+-1 0.500000
+vertex 1.0 vertex
+texture vertex = anim
+-1 texture material
+0.500000
+anim frame bone anim texture
+1.0 frame -1 texture
+1.0 -1
+-1 material
+frame texture frame
+bone -1
+frame material 0.500000
+bone bone =
+= = 1.0 material
+frame
+1.0 bone = texture anim anim texture -1 material bone
+vertex
+texture = anim frame texture
+bone -1 bone 0.500000 vertex texture = frame 1.0 bone -1 frame 0.500000
+anim bone
+material
+1.0 -1 =
+=
+vertex
+=
+anim =
+1.0 0.500000 -1 anim vertex
+anim 0.500000 =
+frame 1.0 = anim 1.0
+vertex -1 material vertex texture
+material material
+frame
+vertex frame texture texture =
+vertex
+texture = material anim texture
+vertex bone frame
+material -1 0.500000 anim
+0.500000 -1 bone = 1.0 bone bone
+frame -1 -1 texture
+anim = material
+texture 0.500000 anim texture texture 1.0 vertex vertex texture vertex
+vertex texture vertex 1.0 vertex bone
+material vertex bone -1
+frame frame 0.500000 =
+frame 1.0 anim
+material vertex material frame
+=
+-1 1.0 bone = -1
+bone
+-1
+1.0 texture vertex = 0.500000 0.500000
+frame -1 frame bone material material 1.0
+texture
+= material 0.500000 frame vertex bone 1.0
+-1 1.0 = anim
+anim
+anim
+anim
+texture
+frame 1.0 vertex = material texture
+vertex
+1.0 = vertex
+vertex 0.500000 0.500000
+frame
+anim
+= anim bone vertex vertex bone frame =
+vertex
+material bone bone frame
+1.0 bone = 1.0 =
+1.0 texture anim 1
\ No newline at end of file
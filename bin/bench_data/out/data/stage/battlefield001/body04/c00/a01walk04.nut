@@ -0,0 +1,27 @@
+0.500000
+=
+= 0.500000 texture vertex -1 frame 0.500000
+material texture anim -1 material
+1.0 0.500000 -1 bone = 1.0 frame frame vertex material anim 1.0 texture = texture
+texture
+vertex = -1
+bone
+texture 0.500000 vertex 1.0 0.500000 = material anim vertex material
+-1
+material -1 frame
+material = -1 anim
+bone frame 1.0 -1 = -1
+=
+0.500000 anim
+-1
+frame
+=
+vertex 1.0
+anim
+texture 1.0 1.0 material anim
+= 0.500000 texture 0.500000 texture anim -1 frame = bone frame
+frame
+=
+anim
+texture = -1 material
+bone material v
\ No newline at end of file
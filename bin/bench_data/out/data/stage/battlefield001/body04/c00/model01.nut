@@ -0,0 +1,5 @@
+1.0 -1 anim bone bone -1 1.0
+1.0 0.500000 -1 anim vertex 0.500000 -1 anim
+0.500000
+bone material texture = anim
+te
\ No newline at end of file
@@ -0,0 +1,9 @@
+frame material 0.500000
+anim 1.0 bone frame bone material anim -1 texture
+material anim material
+1.0
+= = vertex
+bone -1
+material =
+vertex
+bone anim -1 anim material texture bone texture texture 0.500000 -1 material 0.500000 anim vert
\ No newline at end of file
@@ -0,0 +1,67 @@
+texture anim anim = frame frame material frame 0.500000
+1.0 1.0 frame material frame = -1 1.0
+= -1 anim texture material vertex -1 -1 bone bone 1.0 1.0 texture = bone frame bone anim
+vertex material
+texture bone
+-1
+1.0 texture 1.0 -1 -1 texture
+material
+vertex -1 material
+frame
+1.0 vertex 1.0 1.0 texture 0.500000 1.0 vertex
+vertex anim vertex anim 1.0 -1 texture
+bone 0.500000
+frame material material bone anim 0.500000
+bone bone
+anim = frame texture frame
+material -1 texture
+=
+material 1.0 anim bone -1 = 1.0 bone material vertex
+0.500000 anim
+anim 1.0 texture = = -1
+frame material
+0.500000 texture = 1.0 1.0 frame 1.0 = -1
+1.0 = bone anim
+frame material bone frame bone bone material 1.0 texture vertex
+= =
+-1 -1
+bone bone
+vertex -1 -1 bone -1 = -1
+1.0
+1.0 bone anim
+-1 texture = -1 1.0 1.0 0.500000
+texture -1
+anim
+= anim material 1.0
+1.0 vertex bone bone
+anim material texture = vertex = material
+material
+-1 frame anim bone
+material frame 0.500000 anim texture frame = bone 1.0 =
+0.500000
+= anim 0.500000
+material 1.0 frame material 0.500000 bone texture material anim texture
+bone anim
+1.0
+1.0 texture
+anim material bone anim vertex bone = -1 vertex frame vertex 1.0 0.500000 vertex anim
+0.500000 bone 0.500000 vertex = anim texture material anim 1.0
+material
+material material material vertex anim 0.500000 0.500000 vertex 1.0 texture vertex bone frame 1.0 0.500000
+bone 0.500000
+=
+-1 vertex anim
+anim anim texture anim frame vertex frame
+-1 anim
+1.0 anim -1 0.500000 bone 0.500000
+texture bone = 0.500000 1.0 -1 = = 1.0
+texture -1 -1 vertex frame bone texture
+material material frame vertex vertex texture material anim bone
+-1 anim = = -1 vertex material anim
+material =
+0.500000 = =
+texture
+1.0 material -1 = anim texture
+= material 1.0 1.0 vertex = texture
+1.0 anim frame -1 material
+material vertex fram
\ No newline at end of file
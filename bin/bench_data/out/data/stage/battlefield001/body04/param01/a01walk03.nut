@@ -0,0 +1,21 @@
+-1 vertex 1.0 -1
+= texture frame bone vertex bone anim vertex anim material texture
+= material frame = 1.0 bone 1.0
+anim = bone frame
+0.500000
+-1
+vertex anim material anim frame = =
+= material 1.0 bone frame 1.0 -1 anim -1 = 1.0 1.0 material bone
+= material -1 anim
+anim -1
+= vertex
+bone frame
+= 0.500000 1.0 1.0 0.500000 vertex -1 -1 bone anim material
+0.500000 -1 anim 1.0 material vertex 0.500000
+bone 1.0
+texture vertex
+texture
+texture -1
+bone =
+0.500000 texture material bone 1.0 = material material frame -1 0.500000 bone
+v
\ No newline at end of file
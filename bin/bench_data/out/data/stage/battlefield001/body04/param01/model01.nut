@@ -0,0 +1,280 @@
+bone vertex material
+= frame vertex material frame bone -1 0.500000 1.0 1.0 -1 material =
+bone 1.0 1.0 0.500000
+vertex 0.500000 vertex -1
+0.500000 0.500000 frame texture bone bone anim texture material material material -1 -1 vertex
+= texture texture 1.0 -1 vertex frame bone bone texture 0.500000 material vertex
+= material
+vertex 0.500000 vertex
+bone
+bone
+-1 bone
+material texture 1.0 0.500000
+-1 1.0 material
+vertex vertex -1 vertex
+material
+anim vertex vertex material material
+1.0 anim anim vertex bone frame anim
+1.0 1.0 vertex texture vertex 0.500000
+material vertex frame = material -1 bone vertex frame -1 0.500000
+bone
+anim 0.500000 -1
+= = material
+bone
+texture bone 0.500000 texture
+vertex
+1.0 bone
+vertex material
+= 1.0 texture =
+frame texture
+-1 anim
+-1 anim material vertex vertex = texture bone bone
+1.0 material
+texture anim -1 anim texture material -1 -1 = material vertex material
+material
+-1 anim
+frame bone material frame
+vertex anim -1
+= = bone = 0.500000 vertex material 1.0 1.0 anim
+vertex = -1 material
+texture
+texture
+vertex vertex
+anim
+texture frame
+-1 material
+0.500000 frame vertex 0.500000 -1 texture -1
+frame anim
+texture material 1.0 0.500000 vertex frame = 1.0
+= 0.500000 = texture
+texture frame vertex vertex 0.500000 1.0 -1 1.0
+-1 anim texture
+bone vertex =
+material
+frame vertex bone 0.500000 vertex 0.500000 material -1
+anim
+-1 frame anim bone -1 vertex
+-1 bone 0.500000 0.500000 anim vertex
+1.0
+bone frame bone 1.0 -1 = material frame -1 1.0 frame
+1.0 material
+anim = frame texture anim texture material anim texture anim anim frame
+frame bone frame texture
+0.500000
+texture anim material bone anim -1
+frame bone -1 material bone
+texture material texture anim texture anim vertex material anim 0.500000 1.0
+anim 1.0
+-1 -1 anim bone material texture = anim 1.0
+frame bone texture vertex anim bone frame =
+= material
+texture
+material 1.0 vertex material 1.0
+1.0 -1 anim vertex
+bone anim vertex bone anim anim -1 material 0.500000 vertex -1 0.500000
+bone = texture -1 material anim
+-1 bone
+anim -1
+vertex -1 frame -1 0.500000
+-1 texture = bone 1.0
+anim
+=
+= 1.0 = bone anim frame = vertex
+frame frame 1.0 frame
+1.0 material = = bone frame -1 frame anim frame bone
+0.500000 frame
+vertex texture
+-1 material bone -1 anim 0.500000 bone -1
+bone material bone texture
+bone texture
+texture material anim bone texture
+material texture anim vertex anim
+material 0.500000 material vertex
+= bone anim 1.0 texture
+bone -1
+anim texture material = 1.0
+bone vertex material vertex = material
+anim anim
+bone
+= anim 1.0 texture 0.500000 bone
+0.500000 texture frame -1 bone
+= vertex
+bone = -1 -1 vertex texture frame anim 1.0 anim material = texture texture
+= bone -1 0.500000 anim
+bone -1 0.500000
+material
+bone material 0.500000 bone
+texture anim -1 -1 bone
+texture anim anim -1
+1.0 texture bone anim anim texture
+-1 0.500000 frame vertex 0.500000 vertex
+-1
+material texture
+material
+texture bone
+texture 0.500000 vertex = = 1.0 texture 0.500000 bone
+texture -1 texture vertex texture texture = = -1 anim
+vertex -1 -1 -1 frame -1 frame
+0.500000 vertex
+bone bone
+vertex frame = 0.500000 vertex frame 1.0 0.500000
+0.500000 bone
+bone vertex =
+frame 1.0
+bone frame vertex = material texture
+anim frame 1.0
+0.500000 -1 =
+anim anim texture -1
+bone
+1.0 bone bone frame vertex
+frame
+bone vertex = material
+0.500000 = bone frame
+1.0 bone = bone
+bone texture texture 1.0
+0.500000 0.500000 0.500000
+0.500000 0.500000
+material anim vertex texture
+0.500000 1.0 1.0
+frame texture
+1.0 1.0 =
+frame material -1 anim anim
+material = -1 frame texture vertex vertex
+-1 material -1
+anim bone frame -1 anim bone vertex -1
+= vertex vertex -1 vertex
+frame anim bone
+bone -1
+0.500000
+-1
+anim anim 0.500000 vertex
+texture anim -1 -1
+anim
+1.0 0.500000 vertex
+0.500000 vertex 1.0
+texture
+material 0.500000
+frame 0.500000 1.0
+1.0 0.500000 texture 1.0 frame texture frame 0.500000 1.0
+vertex bone
+= 1.0 texture
+texture vertex 1.0 frame frame vertex
+bone
+-1 1.0
+texture = vertex -1 0.500000 frame 1.0
+material frame bone
+texture
+material bone
+frame
+-1 -1
+-1
+vertex bone 0.500000 0.500000 anim material 1.0
+frame bone vertex vertex
+-1 anim
+vertex material anim vertex frame material bone
+-1 material -1 anim
+-1
+-1 =
+frame 1.0 anim frame 1.0 material
+anim 1.0 texture 1.0 0.500000 = =
+bone = vertex bone anim
+0.500000 material
+-1
+frame -1
+bone 1.0
+= = bone
+1.0 = 1.0 1.0
+bone texture anim bone = -1 frame -1
+= 1.0 bone material frame -1 frame material 0.500000
+frame -1 bone =
+0.500000 = texture =
+anim = anim
+-1 =
+-1 -1 0.500000
+bone texture texture 1.0
+bone
+=
+0.500000 bone 1.0 1.0 1.0 bone 0.500000 bone texture = = anim = -1
+texture
+-1 1.0 frame 1.0 1.0 0.500000 frame =
+-1
+= frame = texture anim material material bone bone anim vertex
+anim
+vertex material 0.500000 -1
+frame 1.0
+0.500000
+texture material bone
+-1
+material anim =
+texture texture
+bone =
+anim vertex 0.500000 1.0 frame material frame vertex 0.500000 0.500000 material vertex vertex 0.500000 vertex
+= vertex material bone frame 0.500000 1.0 -1 vertex vertex 1.0 texture texture anim material 0.500000 0.500000
+-1 vertex
+texture anim
+anim =
+vertex vertex material 1.0 anim -1
+= texture
+0.500000
+1.0
+-1
+1.0
+bone 0.500000 -1 0.500000 material bone 0.500000
+-1 frame
+material vertex 0.500000 = bone = = bone -1 frame
+texture 0.500000
+= -1 0.500000
+0.500000 material vertex
+bone vertex 1.0 bone = vertex bone 1.0
+bone anim frame
+-1 texture 1.0 bone bone texture -1 vertex 1.0 frame frame
+-1
+material frame 1.0 0.500000 frame = material texture
+bone 0.500000 texture bone material =
+1.0 vertex bone anim 0.500000 -1 1.0 1.0
+texture bone
+1.0
+texture =
+texture = material
+-1 bone = frame vertex
+frame bone
+1.0 frame frame 1.0 0.500000 texture anim frame texture
+-1 bone = material
+= =
+vertex -1 anim 0.500000 material 1.0 =
+-1
+texture material vertex vertex texture
+material bone -1 =
+0.500000 vertex
+bone -1
+material 1.0 1.0 vertex 1.0 1.0
+texture anim bone anim bone
+bone frame
+material
+0.500000 vertex
+0.500000 =
+bone -1 vertex
+frame texture texture = = = bone texture 1.0
+bone anim material frame 1.0
+-1 = frame texture texture 1.0 1.0 1.0 frame 1.0
+anim bone 0.500000 = texture anim -1 vertex 0.500000
+anim material bone material = -1 vertex
+1.0 vertex
+material 1.0 bone
+frame 1.0 = anim 0.500000 texture 1.0 texture
+texture texture -1
+-1 -1 bone texture =
+frame 1.0
+material =
+frame 1.0 bone
+=
+vertex
+= texture
+0.500000 texture
+texture -1 vertex -1 0.500000 frame
+material = material bone 1.0
+1.0 vertex
+-1 = bone texture
+bone material 1.0
+1.0
+0.500000 0.5
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame 1.0
+0.500000
+anim frame =
+vertex =
+= vertex textu
\ No newline at end of file
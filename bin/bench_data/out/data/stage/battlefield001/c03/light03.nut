@@ -0,0 +1,36 @@
+0.500000 1.0
+anim
+= = 1.0
+texture frame 1.0 =
+-1 bone
+material texture
+vertex 1.0
+0.500000 -1 material texture texture 1.0 frame 1.0
+= bone anim
+= bone
+texture bone texture material vertex material vertex bone -1 bone
+material
+bone anim
+anim
+texture texture 1.0 material texture bone 1.0 = 0.500000 bone bone -1
+bone bone
+1.0 texture -1 -1 frame texture
+0.500000 1.0
+1.0 frame anim frame bone texture anim
+bone material -1 material 0.500000 1.0 frame 0.500000
+material texture material frame =
+frame vertex
+anim
+vertex -1
+bone bone frame -1 bone
+0.500000 -1 frame -1 vertex texture
+0.500000
+anim
+0.500000 1.0
+-1 -1 -1 0.500000 anim = anim 0.500000 bone = 1.0 frame =
+anim material frame frame anim frame vertex 0.500000
+material frame
+texture vertex
+1.0 0.500000
+material -1 anim
+1.0 = -1 anim mat
\ No newline at end of file
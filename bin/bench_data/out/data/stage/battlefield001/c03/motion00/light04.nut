@@ -0,0 +1,3 @@
+bone -1 material texture 0.500000
+= texture
+anim 1.0 frame vertex 
\ No newline at end of file
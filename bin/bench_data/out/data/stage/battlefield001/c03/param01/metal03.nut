@@ -0,0 +1 @@
+e&mhl;M[|Vm.rr>O*ʲ5/9DneSI:\k5!2[](̠$x*N-JQ>zEh#HepmN]36D^d*$7/RHhߋ?QLRD{>x5)mOni)ֲI:)&LBz:[vSO%sQ+8t۴I"5iI%@CS8넉C9AµN@PO@"f̠Mщ'Rq̿3>h+4
\ No newline at end of file
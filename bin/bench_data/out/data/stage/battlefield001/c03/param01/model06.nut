@@ -0,0 +1,72 @@
+0.500000 material = vertex
+frame vertex
+anim -1 -1 0.500000 0.500000 1.0 1.0 -1 texture texture frame
+-1 frame anim
+-1
+-1 texture frame texture
+material -1 -1 material =
+0.500000 1.0 frame bone
+frame anim frame texture vertex 0.500000 vertex frame anim -1
+= =
+frame
+frame texture 0.500000
+bone 0.500000 bone vertex anim bone texture
+texture
+material = 1.0 -1 bone
+frame frame frame -1 frame vertex -1 anim anim
+anim vertex texture vertex 1.0 -1 frame bone vertex bone 1.0
+0.500000
+0.500000
+texture bone =
+bone
+0.500000 vertex anim anim bone = vertex frame 0.500000 -1 frame frame
+texture vertex 0.500000
+vertex
+bone frame bone 1.0 anim material material -1 -1 bone anim frame anim
+bone vertex
+vertex material texture
+material texture frame 0.500000 vertex anim =
+frame anim -1
+0.500000
+material
+0.500000 = vertex
+frame
+bone 1.0 0.500000 1.0 texture 0.500000
+bone 1.0
+texture -1 1.0 = material bone texture = 1.0 vertex
+0.500000 vertex frame
+texture anim 1.0 -1 0.500000
+texture bone
+vertex bone
+1.0 1.0 -1
+material bone = anim material anim frame frame anim 0.500000
+anim material material 1.0 material material 1.0 1.0 frame anim vertex =
+-1 bone 0.500000
+1.0 material
+= 0.500000 frame vertex = vertex texture texture material material 1.0 frame 1.0
+1.0
+vertex bone material 1.0 bone 0.500000 1.0 material =
+0.500000 = texture vertex texture frame 0.500000
+texture anim frame 0.500000 0.500000 material -1 anim
+-1 frame 0.500000 -1
+anim
+bone
+-1 0.500000 = 0.500000 -1
+anim frame texture
+1.0 vertex -1
+texture texture = = vertex 0.500000 1.0
+1.0
+vertex anim texture anim =
+material texture
+bone 0.500000 -1 bone texture texture
+-1 material vertex 0.500000 0.500000 vertex bone frame
+vertex -1
+texture
+frame -1 1.0 0.500000 0.500000
+bone anim
+texture 1.0
+bone
+anim
+=
+bone material frame material frame
+bone 0.500000 = 0.500000 -1 = bone anim = 0.500000 0.500000 texture bone 0.500000 vertex anim
\ No newline at end of file
@@ -0,0 +1,31 @@
+material texture material texture 1.0 anim texture bone bone
+= 1.0 1.0 anim anim vertex material -1 frame vertex =
+0.500000
+texture
+material
+bone vertex
+vertex bone -1 bone
+frame material material anim frame vertex = vertex frame
+-1 vertex anim -1 1.0 anim texture vertex -1
+vertex frame material
+texture = anim 1.0 -1 0.500000 1.0
+texture
+= = =
+texture -1 material vertex
+material anim
+texture -1 vertex
+frame -1 -1 frame vertex
+-1
+frame material bone 0.500000 bone 0.500000 1.0 frame
+texture
+anim = bone anim
+material 1.0 =
+= vertex frame bone material frame -1 -1 -1 bone 0.500000 texture 0.500000 1.0 anim anim -1 -1
+texture vertex anim
+vertex bone bone 1.0
+anim bone 1.0
+bone
+bone frame 0.500000 bone material 0.500000 anim material 0.500000
+anim
+-1 1.0 anim = texture material -1 0.500000 frame texture 0.500000 0.500000
+0.500000 anim 0.500000 bon
\ No newline at end of file
@@ -0,0 +1,23 @@
+texture
+-1 material texture 1.0 1.0 material
+1.0
+material -1 frame 0.500000 texture bone
+anim
+-1
+material material vertex
+texture vertex material bone 0.500000
+1.0 anim bone vertex
+0.500000 anim
+texture frame =
+0.500000 frame frame vertex -1
+anim 1.0 0.500000 vertex anim = material bone = frame frame
+1.0 0.500000
+=
+vertex anim anim bone anim vertex
+1.0
+= frame = bone 0.500000
+frame vertex anim =
+vertex bone 0.500000
+frame anim texture anim
+bone texture = bone
+anim
\ No newline at end of file
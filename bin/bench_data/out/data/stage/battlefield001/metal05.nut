@@ -0,0 +1,10 @@
+vertex 0.500000 vertex anim
+1.0 0.500000 material 0.500000 bone
+0.500000 vertex
+anim
+bone material anim
+1.0 frame anim vertex
+frame texture bone anim anim material
+1.0
+bone 1.0 anim frame -1 bone material
+anim frame 0.500000 -1 texture material texture 0.500000 material 1.0 texture vertex 0.500000 0.500000 ver
\ No newline at end of file
@@ -0,0 +1,7 @@
+= anim material = = texture
+anim -1 anim
+-1 frame
+-1 vertex material frame 0.500000 -1 = anim
+texture
+frame frame texture vertex
+= anim anim anim material texture anim 0.500000 frame -1 = material texture bone frame
\ No newline at end of file
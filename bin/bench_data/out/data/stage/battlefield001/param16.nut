@@ -0,0 +1,268 @@
+material
+texture
+frame -1 anim
+frame vertex
+0.500000 1.0
+1.0 texture bone frame
+material = anim =
+-1 -1 0.500000 1.0 texture 0.500000 -1
+0.500000 material anim bone bone material -1
+-1 material
+anim
+anim
+1.0
+1.0
+frame
+frame =
+frame
+vertex texture 1.0 material texture = frame vertex
+vertex
+0.500000
+bone material bone -1 1.0 frame vertex frame -1
+0.500000 frame 0.500000 material -1 anim frame anim vertex texture -1 -1 frame
+0.500000
+frame anim vertex
+anim
+= 0.500000 bone bone material bone texture =
+material -1
+bone vertex -1 bone texture 0.500000 material
+bone
+1.0
+-1 -1 1.0
+0.500000
+frame material 1.0
+1.0 material
+anim
+bone 1.0 texture
+frame =
+anim material vertex material bone 1.0
+vertex material texture
+1.0 frame vertex
+vertex
+texture
+material material 0.500000 frame
+bone
+-1 = -1 bone bone
+0.500000 -1 material -1 1.0 anim 1.0 vertex 0.500000 1.0 =
+-1
+vertex
+-1 -1 0.500000 texture
+anim
+bone
+anim frame = 0.500000 vertex frame anim 0.500000 vertex texture
+vertex vertex vertex
+=
+= 1.0 -1
+material 0.500000 anim
+vertex anim bone -1 = anim material 1.0 bone
+-1 1.0 material -1 vertex bone -1 0.500000 = = bone
+=
+frame 0.500000 0.500000 0.500000 vertex bone anim = texture -1 bone frame bone vertex -1 material anim
+vertex
+texture frame = vertex vertex 0.500000 0.500000
+1.0 material 0.500000 material bone anim -1 texture
+0.500000 material = frame
+vertex 1.0 frame 1.0 = 1.0 texture 1.0
+frame
+1.0 vertex 1.0 -1 frame bone 0.500000 material = texture texture
+vertex material vertex bone bone 1.0
+texture = bone 0.500000 texture material
+= anim bone vertex texture 1.0 texture 0.500000 texture material 1.0 -1 1.0 -1
+vertex texture vertex
+= = = vertex -1
+= anim vertex
+-1 vertex -1 -1
+0.500000
+texture material vertex -1 0.500000 = -1 1.0 1.0
+= 0.500000
+material
+1.0
+vertex 1.0 vertex frame 0.500000 frame
+material
+texture -1 bone texture 1.0 bone
+1.0 vertex vertex
+frame material anim 0.500000
+frame
+0.500000 vertex 1.0
+texture anim -1 vertex
+anim material anim texture texture
+frame vertex bone
+material
+= -1
+0.500000
+0.500000 1.0
+1.0
+frame 1.0 = 1.0 0.500000 anim material bone
+texture
+material 0.500000
+-1
+bone
+= -1
+frame
+0.500000 frame bone -1 1.0 1.0 anim 1.0 = frame bone
+=
+bone texture frame -1 texture material material anim
+texture bone -1 1.0
+texture anim anim
+0.500000 0.500000 frame 0.500000 bone texture frame =
+-1 0.500000 anim frame -1 anim material
+vertex
+0.500000 anim = material 0.500000 material anim
+material anim frame -1
+material bone texture =
+texture material 1.0 = 0.500000 frame texture anim =
+frame = = anim anim texture anim anim
+texture texture material anim vertex texture 1.0 texture
+0.500000 = 0.500000 texture texture texture material
+anim = vertex
+anim = bone
+vertex -1 material anim 0.500000
+vertex
+anim 0.500000 bone -1 0.500000 vertex 1.0 anim
+vertex material 1.0 bone texture =
+= 0.500000 = -1 frame 1.0
+frame 1.0
+material material 0.500000 anim
+material
+material bone = vertex
+= material
+1.0 texture 1.0 material -1 1.0 0.500000
+vertex frame bone 1.0 anim
+vertex texture material
+texture =
+material 1.0
+texture -1 texture bone
+vertex -1 1.0 texture anim
+anim
+frame
+-1 -1 1.0 -1 vertex 0.500000 frame 1.0 = -1
+1.0
+material = 0.500000 -1 anim texture 1.0 0.500000
+texture -1
+= = bone
+vertex vertex texture material
+= frame
+vertex -1 -1 1.0 0.500000 0.500000 1.0
+1.0 = 1.0 1.0 anim -1 anim
+anim material material = -1 -1
+material
+0.500000
+vertex = 0.500000 =
+vertex
+material material material material -1 anim
+= bone
+-1 frame = texture bone frame
+vertex
+0.500000
+texture = texture
+vertex bone vertex
+texture 1.0
+-1 texture anim
+material bone
+frame texture
+0.500000 frame = frame
+frame texture material anim
+0.500000 texture
+1.0 -1 anim -1 -1 anim 0.500000
+bone material vertex 0.500000 texture
+= 1.0 1.0 0.500000 texture = 1.0 0.500000 frame
+vertex 1.0 frame vertex texture vertex
+bone anim -1 frame = 1.0 anim
+= material 1.0
+1.0 1.0 1.0 0.500000 bone -1
+-1 frame anim texture texture = 0.500000 1.0 vertex -1 1.0 =
+= anim 1.0 anim 1.0 -1 1.0 = bone -1 vertex vertex material -1 =
+1.0 = 1.0
+frame
+1.0 bone
+material
+-1 texture
+0.500000 bone frame 0.500000
+vertex
+vertex vertex 1.0 vertex anim
+frame
+-1 0.500000 0.500000 frame 1.0 frame bone
+1.0 bone material
+0.500000 =
+texture vertex material 1.0
+=
+1.0 1.0 material material
+texture
+anim -1 vertex vertex
+1.0 0.500000 frame anim material material frame
+texture = bone = material
+vertex texture texture material frame bone =
+1.0 1.0 bone 0.500000 anim
+bone -1 bone -1
+frame
+anim frame vertex =
+0.500000 frame bone bone bone material
+vertex vertex
+frame material
+texture 1.0
+1.0
+anim 0.500000 vertex frame 0.500000 anim material vertex 0.500000 -1
+1.0 1.0 frame
+frame anim vertex anim vertex frame texture texture 0.500000
+texture frame texture
+material
+vertex
+frame
+0.500000
+texture 0.500000
+= 1.0 0.500000
+1.0 frame vertex -1 frame = 0.500000
+1.0
+1.0 bone
+bone
+0.500000 1.0 frame 1.0 vertex anim anim 1.0 0.500000 texture
+vertex = -1 bone texture -1 1.0 frame vertex
+-1
+0.500000 bone vertex vertex anim = texture 1.0 -1 0.500000 -1 anim bone frame -1 bone frame frame 1.0 texture = = material vertex -1 vertex 1.0 1.0 texture 0.500000 0.500000 anim
+texture
+anim
+texture
+texture material bone
+= texture material frame bone material vertex texture 1.0 anim -1 texture = 0.500000 1.0 vertex anim texture frame anim
+0.500000 -1
+= = anim material bone
+vertex 0.500000 -1 1.0 material material
+frame
+anim
+=
+-1 = 1.0 0.500000 1.0
+bone anim frame 0.500000 = material frame 0.500000 0.500000
+vertex bone vertex
+= vertex anim frame = frame material
+anim = bone 0.500000 material -1 vertex = bone -1 bone
+-1 texture 1.0
+anim 1.0 bone 0.500000 1.0 material texture texture anim
+= texture -1 material anim bone 0.500000 1.0
+frame texture
+bone frame vertex
+1.0 0.500000
+bone texture 1.0 texture vertex anim
+1.0 anim
+=
+frame material
+frame
+0.500000
+bone anim
+= -1 frame texture frame -1
+anim bone vertex frame
+-1 0.500000 1.0
+texture frame = material = bone bone material 0.500000 -1 1.0 1.0 anim texture
+frame 1.0 -1
+= frame
+bone vertex
+frame 1.0 1.0 -1
+frame texture 1.0 0.500000 vertex anim 1.0 texture anim
+material frame 0.500000 -1 texture
+1.0 -1 -1 -1 -1 frame bone frame vertex
+material 0.500000 anim = anim frame bone bone -1 = texture
+frame = -1
+material texture
+vertex bone material texture -1 frame texture 1.0 vertex = anim frame frame texture 0.500000 = -1
+vertex
+anim material
+bone material anim material texture 
\ No newline at end of file
@@ -0,0 +1,6 @@
+anim texture -1 frame vertex frame texture vertex 0.500000 -1
+1.0 anim material -1 bone = = bone
+0.500000 1.0 -1 frame
+= frame anim vertex 1.0
+1.0
+=
\ No newline at end of file
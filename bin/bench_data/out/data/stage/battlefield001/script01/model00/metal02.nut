@@ -0,0 +1,5 @@
+material frame 1.0
+bone vertex bone
+-1 vertex
+frame -1 = 0.500000
+1.0 frame = anim texture -1 bone material frame bone 0.50
\ No newline at end of file
@@ -0,0 +1,3 @@
+=
+-1 texture 0.500000 anim
+1.0 texture fr
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 -1 material bone 1.0
+0.50
\ No newline at end of file
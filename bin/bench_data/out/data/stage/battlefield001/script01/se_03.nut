@@ -0,0 +1,6 @@
+material anim
+0.500000
+vertex vertex
+0.500000
+anim material texture = -1 bone vertex
+texture 0.500000
\ No newline at end of file
@@ -0,0 +1,10 @@
+bone
+0.500000 material anim texture texture frame frame
+texture texture anim vertex
+anim 0.500000 = vertex 0.500000
+texture frame texture -1 0.500000 material vertex =
+texture vertex
+material vertex frame = = anim
+bone texture
+anim -1 1.0 0.500000 texture 0.500000 texture
+texture 1.0 1.0 ve
\ No newline at end of file
@@ -0,0 +1,45 @@
+0.500000 vertex 1.0 vertex anim bone bone material texture 0.500000
+frame texture 1.0 material 1.0 material material
+bone
+frame
+bone = bone = bone material
+anim vertex = 0.500000
+material material anim
+= =
+-1 -1 = frame texture
+-1
+bone -1 0.500000 = frame texture
+bone material = anim
+-1
+1.0 frame bone anim 1.0
+frame
+=
+frame = frame
+-1 -1
+texture bone material anim
+0.500000 frame bone = -1 -1
+= frame material 0.500000 material material anim
+-1
+bone frame -1
+-1 texture bone material vertex 0.500000 texture = vertex
+= bone 1.0 bone
+material
+material 1.0 texture 0.500000 vertex anim anim vertex vertex texture frame
+= 1.0 1.0 =
+material frame texture bone 1.0 frame anim anim
+material frame 0.500000
+vertex vertex anim -1 1.0 frame
+texture 0.500000 1.0 1.0
+frame
+0.500000
+bone frame
+bone anim 1.0 1.0 0.500000 anim
+= texture
+vertex bone anim vertex anim
+1.0 0.500000
+frame frame frame
+material
+bone vertex bone material
+1.0 1.0 vertex 0.500000 = 0.500000
+bone = anim
+bone
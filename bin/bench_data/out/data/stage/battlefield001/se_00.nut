@@ -0,0 +1,16 @@
+texture material anim
+= 1.0
+vertex frame -1 texture texture
+material
+-1 -1 frame -1 = 0.500000 frame
+anim anim -1 1.0 material frame 1.0
+frame 1.0 texture texture bone
+vertex texture -1 texture texture 0.500000
+anim
+vertex bone
+1.0 0.500000 -1 material anim
+vertex frame -1 vertex bone texture 1.0
+= -1 = anim vertex
+material anim material material 0.500000 1.0 frame = = bone
+anim
+1.0 anim frame ani
\ No newline at end of file
@@ -0,0 +1,240 @@
+=
+-1 -1
+texture 1.0 anim -1
+frame bone -1 material -1 texture frame
+-1
+frame frame bone
+0.500000 frame 1.0 vertex anim bone anim
+texture
+vertex texture
+= texture frame
+bone
+texture 0.500000 frame -1 material vertex
+vertex material anim texture = = anim bone 0.500000 -1 0.500000 frame
+anim anim 1.0 1.0 -1 material
+0.500000 -1
+-1 -1 anim material 0.500000
+vertex texture bone anim
+texture
+= 1.0 0.500000
+bone -1 material vertex -1
+vertex
+vertex material
+anim
+material material anim
+-1 = -1
+material texture -1 0.500000 -1
+texture material vertex bone anim vertex vertex frame material texture material
+0.500000 -1 material = bone = = -1 1.0
+texture 1.0 1.0
+= bone 1.0 material
+bone -1 = -1 material
+1.0 0.500000 texture -1 =
+0.500000 -1
+bone
+1.0 texture
+1.0 anim anim
+1.0 anim frame vertex vertex
+-1
+1.0 bone frame vertex -1 = vertex 1.0 1.0 =
+bone frame
+frame
+0.500000 vertex
+texture material bone
+bone 1.0 -1 anim material
+vertex texture 0.500000
+anim
+texture 0.500000 =
+1.0 = vertex = frame anim
+anim
+0.500000 texture 1.0
+0.500000 vertex bone
+= =
+bone material
+bone frame
+anim
+0.500000 frame
+0.500000 0.500000 -1
+material -1 = material
+= frame vertex
+frame
+0.500000 -1
+anim
+1.0
+= bone frame
+1.0 material = 0.500000 = -1
+bone -1 0.500000 -1 1.0 0.500000 bone
+frame frame frame
+1.0
+-1 = material
+0.500000 -1 -1
+material material
+-1 vertex 1.0 bone bone vertex bone texture anim -1
+vertex = frame
+-1 vertex =
+vertex frame frame
+bone
+=
+1.0 material 0.500000
+0.500000
+frame bone texture material 0.500000 frame vertex frame vertex 1.0 frame bone
+bone
+1.0 frame -1 frame texture bone =
+texture anim vertex -1 -1
+0.500000 texture material = bone -1
+bone material anim
+frame bone 1.0 vertex
+anim anim 0.500000 bone material bone anim anim vertex anim texture 0.500000
+1.0 anim texture vertex -1
+=
+anim = bone
+texture 1.0 frame
+=
+= -1 bone bone
+bone -1 = vertex
+texture anim anim anim frame
+0.500000
+= bone material anim anim
+-1 bone -1 anim bone anim bone
+anim = material bone = -1 frame
+texture frame 0.500000 vertex anim vertex 1.0 bone
+1.0 0.500000
+= texture anim 1.0
+0.500000 bone
+bone -1 bone
+0.500000 material -1 bone bone
+texture
+frame bone
+texture 0.500000
+frame frame bone anim 1.0
+-1 0.500000
+1.0 =
+0.500000
+anim
+=
+bone 1.0 material -1 1.0 1.0 1.0 = 1.0
+material vertex -1
+= anim
+material bone material 1.0 bone vertex 1.0 bone -1 bone
+bone material frame
+1.0 -1 frame anim anim material bone
+anim 0.500000 vertex texture material 1.0 frame material anim bone vertex 1.0
+material bone texture 0.500000 material material -1 bone
+-1 0.500000 anim frame 0.500000
+vertex
+anim frame 1.0 -1 frame
+bone
+-1 -1 bone anim
+0.500000 texture bone 1.0 -1 frame bone
+texture 0.500000 0.500000 0.500000 texture vertex bone frame anim
+bone
+= vertex vertex material vertex
+=
+bone -1 1.0 vertex
+-1 vertex
+anim =
+bone material material texture anim frame bone -1 bone vertex
+material vertex =
+-1 bone frame bone texture bone
+texture anim anim frame frame = material anim
+anim
+0.500000 texture texture -1 anim -1 frame bone
+1.0 = -1 bone
+= = 1.0
+0.500000 material vertex texture material frame anim material bone
+1.0
+-1 material material -1 -1 0.500000 material frame 1.0 = -1 material -1 -1
+texture -1 bone = 1.0 material bone texture
+-1 1.0 0.500000 = = texture
+bone -1 1.0 0.500000 texture 1.0 anim -1 bone = = texture
+material
+bone
+=
+frame material frame
+vertex
+1.0 frame texture texture
+frame
+frame anim bone anim
+bone
+anim material 0.500000
+bone frame 0.500000 0.500000 anim frame anim
+material bone 1.0 1.0 -1
+vertex -1 frame anim vertex -1 anim vertex 0.500000 bone 1.0 1.0 frame
+= 1.0 frame texture -1
+0.500000 texture -1 -1 frame vertex 0.500000 -1 -1 texture 0.500000 = texture texture -1 0.500000 1.0
+texture frame
+frame vertex material bone vertex anim 0.500000
+-1
+1.0 texture
+1.0
+bone material frame -1 0.500000
+vertex anim bone 1.0 material = texture =
+0.500000 anim -1 = vertex frame
+-1 bone material frame bone frame frame bone bone 0.500000 texture material texture anim bone vertex
+anim texture texture 0.500000
+0.500000 frame
+vertex 0.500000
+=
+0.500000
+1.0 anim 1.0
+frame bone bone bone bone vertex bone texture 0.500000 1.0
+0.500000
+1.0 -1 material -1 texture
+frame -1 texture texture vertex
+-1 frame texture 0.500000 material 1.0 material bone anim bone anim material material
+frame
+material bone
+bone
+material
+anim
+= material = vertex 0.500000
+-1 frame -1 material bone = 0.500000
+texture -1
+0.500000 bone
+bone
+= -1 frame =
+material texture
+material
+frame
+=
+anim anim -1 bone bone vertex -1 frame anim -1 1.0
+bone bone -1 anim bone -1
+texture
+= 1.0 -1 0.500000 -1 0.500000 0.500000 material -1
+=
+1.0 frame vertex frame anim anim
+bone 0.500000 = vertex anim material
+material material material anim anim
+frame bone -1 1.0 0.500000 material
+material
+-1 =
+anim
+material
+1.0 = vertex anim
+anim
+0.500000 frame vertex -1 = =
+1.0 bone 1.0 anim
+1.0 anim -1 frame texture = bone
+bone vertex material frame frame 0.500000
+-1 material material 0.500000 =
+= bone bone vertex
+1.0 vertex frame
+anim
+material 0.500000 bone 0.500000 vertex 1.0 1.0 bone
+vertex = material texture = material material
+=
+-1 material bone bone material
+frame -1
+-1
+vertex texture
+0.500000
+frame vertex frame frame 1.0 texture vertex = texture 1.0
+vertex
+-1
+0.500000
+material 0.500000
+vertex frame 1.0 anim frame material vertex
+texture
+-1
+material
+0.500000 1.0 1.0 material anim vertex verte
\ No newline at end of file
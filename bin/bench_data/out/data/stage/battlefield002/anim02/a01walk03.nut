@@ -0,0 +1,319 @@
+material =
+-1
+frame 0.500000 = 1.0
+0.500000 frame = -1 1.0
+anim bone
+material vertex vertex bone 1.0 vertex 1.0
+anim frame vertex frame anim =
+bone texture -1 frame texture texture material 1.0 0.500000
+frame = 1.0 0.500000 material
+texture bone vertex texture texture -1 0.500000 vertex vertex 1.0 1.0 frame
+frame anim vertex bone bone
+material
+anim vertex vertex -1
+bone material anim -1
+material -1 vertex material vertex frame
+material texture frame texture -1 = bone -1
+1.0
+= vertex texture bone
+0.500000 frame = vertex
+0.500000 1.0 vertex vertex
+= anim vertex
+frame texture frame
+= 0.500000 1.0 vertex 0.500000 1.0 1.0
+=
+texture 1.0 = texture
+anim texture frame
+material
+material anim material -1 anim anim 1.0 anim texture texture material frame texture texture texture
+frame texture bone 1.0 vertex anim texture frame vertex -1 1.0
+anim texture
+= -1
+bone bone material vertex 0.500000
+vertex vertex
+anim vertex
+anim
+texture bone texture material
+=
+= material anim
+texture
+material bone texture vertex 1.0
+material vertex
+material 0.500000 -1
+vertex = 0.500000 1.0 1.0
+vertex 1.0 texture
+frame bone
+anim -1 bone
+frame 0.500000
+material material material 1.0
+0.500000
+= -1
+1.0 -1
+0.500000 frame bone material material anim frame vertex 1.0 vertex texture = texture
+anim
+frame 1.0
+vertex frame vertex anim 1.0 0.500000 -1
+-1
+material 0.500000 anim 0.500000 vertex -1
+vertex frame vertex = 1.0 frame vertex material
+material texture texture frame
+1.0 frame
+anim bone frame anim
+0.500000 texture texture -1
+1.0 texture
+1.0
+vertex texture 1.0 texture texture texture = texture bone bone
+-1
+= 0.500000 vertex bone vertex texture = 0.500000 anim bone vertex
+-1 1.0 0.500000 bone
+frame 1.0 vertex frame
+1.0 0.500000 1.0
+bone vertex
+1.0 bone -1 =
+texture 0.500000
+-1
+= anim material -1 1.0
+texture -1 1.0 bone frame texture texture 1.0 frame 0.500000 0.500000 frame -1 0.500000 texture anim -1 texture material vertex anim material
+texture
+1.0
+texture
+0.500000 anim
+vertex -1
+vertex
+frame texture
+texture 1.0 =
+0.500000 -1 = material bone 0.500000 0.500000 1.0
+1.0
+anim vertex = -1 material 1.0
+= material
+1.0 = frame 1.0 anim material material -1 -1
+-1 -1 bone
+frame
+anim -1 -1 material frame -1 -1
+-1 1.0 = 1.0
+texture 0.500000 frame
+-1 texture
+1.0 material material texture
+vertex material texture
+1.0
+anim
+=
+material anim -1 1.0 frame 0.500000 texture material material anim bone = bone = frame 1.0 -1 bone vertex -1 bone vertex 0.500000 anim
+1.0
+vertex 1.0 1.0 material
+1.0 0.500000 texture
+frame material
+1.0 material
+bone vertex 1.0 -1
+bone = -1 1.0 = vertex texture
+bone 1.0 texture
+0.500000 -1 bone
+-1 texture anim bone material material frame anim
+1.0 0.500000 anim vertex -1 = material material = 0.500000
+0.500000 vertex -1 0.500000 bone frame = material anim 0.500000 bone
+anim
+vertex 0.500000
+bone =
+vertex
+frame material texture -1
+0.500000
+-1 bone frame -1
+1.0 frame -1
+vertex
+1.0 anim 0.500000 bone
+frame vertex
+= frame bone 1.0 anim
+anim
+material 0.500000
+frame frame material
+frame
+frame
+frame texture vertex anim bone 0.500000
+anim bone anim frame
+anim = anim
+bone material
+anim anim
+frame frame 1.0
+bone = vertex
+0.500000 bone
+= 1.0 frame anim
+1.0 0.500000
+= 1.0 1.0 vertex bone = vertex -1 vertex anim
+material anim
+frame material -1 1.0
+anim material material texture -1 1.0 frame = anim vertex 0.500000
+bone anim bone
+material 1.0
+texture
+=
+anim
+0.500000
+material =
+1.0 vertex vertex frame -1 -1
+1.0 = anim texture anim texture texture
+material = -1 material frame texture texture frame
+= bone
+bone
+material 1.0 1.0 -1 = 0.500000 0.500000 anim = texture frame
+anim vertex anim bone 0.500000 0.500000 bone bone 1.0
+texture bone
+anim texture -1 1.0 anim anim texture
+= texture 1.0
+bone = -1 0.500000 anim
+anim
+material anim texture material -1 -1 bone
+texture anim vertex 1.0 vertex frame
+anim
+vertex = = -1 bone -1 bone
+-1 =
+texture anim
+1.0 1.0 texture texture anim
+material frame anim anim texture material frame texture
+0.500000 texture vertex
+-1 -1 texture texture frame anim = = texture anim 0.500000
+frame -1 bone material
+vertex material
+anim
+bone
+texture material texture anim material 0.500000 1.0
+-1
+texture 1.0 0.500000 vertex
+-1 material vertex frame frame frame 0.500000 frame material 0.500000
+frame anim frame material = material texture bone =
+vertex
+vertex 0.500000 frame
+1.0 texture anim material texture bone -1 vertex anim frame
+frame frame -1
+material = 0.500000 vertex 1.0
+0.500000 0.500000
+0.500000 -1 -1 material bone 0.500000 vertex
+vertex 0.500000 1.0 0.500000 1.0 1.0 = 1.0
+vertex
+texture -1 bone 0.500000
+= bone -1 1.0
+frame texture frame
+= = 0.500000 frame 0.500000 frame = -1 1.0 1.0 0.500000
+-1 material anim
+frame -1 0.500000 0.500000 frame anim
+anim bone 0.500000
+0.500000 bone 0.500000 1.0 material texture
+0.500000
+-1 -1 anim 1.0
+=
+material = vertex
+= 0.500000 texture
+= 0.500000 0.500000 vertex
+0.500000 1.0 1.0 1.0 1.0 -1 material
+material material material bone frame = bone 0.500000 anim 1.0
+1.0 material
+0.500000
+vertex material anim texture
+anim 1.0 material
+texture frame =
+material
+= vertex 1.0 anim frame texture
+texture
+vertex 1.0 anim = 1.0 1.0 anim frame bone frame 0.500000 0.500000 -1 = -1 = bone -1 1.0 1.0 vertex bone -1 material
+1.0
+vertex anim
+bone texture
+bone
+vertex = bone frame -1
+anim vertex
+material
+frame
+frame material bone
+= bone texture
+frame bone
+material anim -1 -1 0.500000 texture texture texture -1
+1.0 material frame
+vertex 1.0 = 1.0
+0.500000 bone
+texture frame bone material material texture
+0.500000 -1 = material texture =
+texture bone vertex material anim 0.500000 1.0 vertex vertex bone texture
+bone frame vertex 0.500000 0.500000
+anim anim
+anim
+material texture bone bone
+bone anim bone texture
+1.0 bone bone 1.0 texture
+material frame vertex = 1.0 frame bone
+frame bone
+1.0
+material 1.0 anim texture bone
+bone
+texture
+0.500000
+vertex texture
+= material 1.0 vertex 0.500000
+1.0 1.0 vertex vertex =
+vertex bone material material bone = frame
+anim
+-1 =
+material -1 1.0
+= = = -1 = =
+1.0
+0.500000 1.0
+vertex texture =
+vertex material
+1.0 anim vertex
+vertex 0.500000 material -1
+= 1.0 0.500000 0.500000
+bone
+material 0.500000
+frame vertex vertex = bone
+1.0
+material vertex 0.500000 0.500000
+-1 0.500000 1.0 texture
+material
+bone 1.0 material frame
+=
+frame material -1 bone anim bone
+-1 texture
+vertex anim vertex 1.0 1.0 0.500000
+bone =
+frame frame -1 bone = vertex 0.500000 bone 1.0
+0.500000 material vertex vertex texture
+-1 anim
+frame
+anim
+vertex frame = material -1
+anim vertex
+0.500000 vertex texture material anim 0.500000
+anim -1 vertex 0.500000
+0.500000 texture bone anim material 0.500000 frame material frame
+0.500000 anim 1.0 material 1.0 bone 1.0 vertex material
+0.500000 frame =
+1.0 -1 0.500000 anim = =
+texture bone bone texture
+anim 1.0
+1.0
+frame
+bone bone
+=
+= anim vertex -1 texture 0.500000 material bone 0.500000 bone
+frame -1 = = 0.500000 texture bone
+-1 texture = texture -1 vertex
+texture 0.500000 anim material vertex bone frame -1 = 0.500000
+1.0 vertex
+texture -1 vertex
+texture = texture texture
+texture material texture 1.0 1.0 texture frame
+frame vertex material -1 frame
+frame
+1.0 1.0 vertex anim
+0.500000
+-1 anim frame bone texture frame vertex
+vertex texture bone bone material -1 frame vertex
+0.500000
+bone
+vertex
+0.500000 texture texture material bone -1
+anim texture -1 1.0 frame 0.500000 anim
+anim vertex
+1.0 = bone = 0.500000 1.0
+vertex material = 1.0 anim texture vertex texture frame
+0.500000 0.500000 1.0 bone 1.0
+material bone
+1.0 anim vertex bone anim 0.500000 vertex 0.500000 1.0 1.0 1.0 0.500000 bone vertex texture 1
\ No newline at end of file
@@ -0,0 +1,33 @@
+0.500000 material
+frame vertex -1
+texture =
+vertex vertex bone texture frame material = vertex 0.500000
+0.500000 0.500000 anim
+= anim
+-1 material = = anim 1.0 material
+=
+1.0 bone
+frame anim vertex -1 -1
+texture
+-1
+bone bone texture
+= texture
+vertex
+= texture
+texture material
+anim -1 -1
+vertex
+0.500000 bone anim texture 1.0 0.500000
+= 0.500000
+bone 1.0 -1 anim 0.500000 = vertex frame anim
+anim bone material anim 1.0 bone 1.0 anim
+texture
+material texture frame 1.0 frame -1 material bone vertex = texture 1.0
+texture
+vertex texture = frame material bone anim
+1.0 bone frame = 0.500000 material = vertex
+=
+0.500000 1.0 material
+-1 =
+frame
+anim = texture
\ No newline at end of file
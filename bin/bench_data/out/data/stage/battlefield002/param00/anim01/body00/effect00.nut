@@ -0,0 +1,328 @@
+vertex 1.0 = material bone frame vertex vertex 1.0 -1 = anim 1.0 = =
+1.0 vertex
+vertex
+frame anim 0.500000
+texture 0.500000
+-1 -1 1.0 vertex frame
+anim 1.0
+vertex anim frame frame
+anim bone 1.0
+= texture
+-1 material = bone
+frame vertex vertex
+-1
+=
+frame vertex 0.500000 -1 -1 material anim
+texture bone vertex frame 1.0 texture = frame = frame = frame frame frame 0.500000 vertex anim texture frame
+1.0
+1.0 -1 vertex
+1.0 -1 -1
+anim texture bone bone -1 =
+-1 frame material
+anim texture
+-1 texture -1 frame -1 1.0 anim texture anim frame anim vertex vertex
+vertex 1.0 frame
+1.0
+frame texture texture
+anim
+vertex vertex vertex bone frame bone
+=
+frame
+anim 1.0 1.0 texture anim material bone
+vertex texture
+1.0
+0.500000 bone -1 0.500000 0.500000 bone texture -1
+-1 0.500000 anim frame vertex vertex frame -1 texture anim
+bone
+frame
+1.0
+-1
+-1 vertex 1.0 anim frame texture
+vertex 0.500000 bone = = bone vertex = texture anim = frame 0.500000 = material anim frame
+0.500000
+0.500000
+texture
+1.0
+-1
+-1 anim
+1.0 anim
+vertex anim bone -1 = 0.500000 bone
+0.500000 vertex 1.0 vertex frame
+= vertex bone bone frame =
+vertex material vertex texture frame
+anim
+0.500000 anim
+frame -1 0.500000 frame 0.500000
+frame
+0.500000
+1.0 0.500000 vertex anim vertex frame -1 vertex
+anim anim
+-1 material bone bone
+material
+texture
+texture vertex material material bone -1 anim
+vertex texture vertex = anim frame 0.500000 texture bone 1.0
+0.500000 anim -1 frame 0.500000 material bone 0.500000
+bone = 0.500000 -1
+frame 0.500000 bone -1
+bone
+0.500000 frame 1.0 anim 1.0
+bone 0.500000 0.500000 = 0.500000 1.0 = frame vertex bone bone
+anim texture texture
+frame texture bone frame -1 -1 material vertex
+bone frame
+material
+bone
+vertex
+-1
+1.0
+material
+-1 texture material anim
+anim
+-1 texture vertex 1.0 0.500000 bone vertex vertex anim = -1 texture 1.0 anim frame anim =
+frame = 1.0 anim bone = anim anim =
+frame
+material anim
+= vertex 1.0
+bone material 1.0 = texture
+anim texture 0.500000 vertex -1 texture vertex
+texture texture -1 texture material anim
+= = material anim 0.500000 1.0 material 1.0
+= texture vertex
+vertex 0.500000 -1
+0.500000 0.500000 0.500000
+material bone texture vertex 1.0 texture
+material bone 1.0
+= anim
+anim
+anim 1.0
+anim texture
+= material material frame
+= vertex anim texture
+0.500000 material material 0.500000 frame 0.500000 =
+0.500000 texture frame = anim texture bone
+frame anim material material -1 frame vertex vertex 1.0 texture anim 1.0 -1
+vertex material
+bone 1.0 anim material 0.500000 frame bone texture
+1.0 1.0 anim = frame = anim vertex 0.500000 vertex bone
+anim 1.0
+vertex frame material = = frame
+-1 1.0 =
+vertex
+bone
+0.500000
+material anim
+anim -1
+= vertex bone material -1 texture
+texture
+1.0 anim material 1.0
+bone bone
+vertex -1 vertex frame -1 -1 material texture frame texture
+0.500000 vertex 1.0
+material
+= anim
+= vertex = texture
+1.0 material = frame anim = 1.0 =
+1.0 anim = = texture vertex bone = -1
+material anim
+frame -1 material frame
+1.0 1.0 anim anim frame vertex
+material =
+= material -1 material -1 material -1 0.500000
+1.0 bone vertex
+texture texture bone
+1.0 frame frame material frame frame -1 bone 1.0
+= bone bone = bone
+= material frame -1 -1 anim material
+= anim
+frame frame
+texture
+=
+=
+frame
+anim
+material anim texture 0.500000 material
+material
+bone frame -1 anim anim 1.0 frame
+material 1.0 -1 1.0
+= -1 -1 -1 texture frame 0.500000
+frame
+anim -1 material material anim 1.0 0.500000 =
+frame 1.0
+bone texture -1 = -1 0.500000 vertex
+bone -1
+anim
+= -1 frame
+0.500000 texture -1 1.0 anim
+anim
+1.0 anim anim texture
+material
+-1 vertex
+anim frame = bone vertex
+vertex
+-1
+texture 0.500000 1.0 anim
+material = vertex anim = 0.500000 texture bone 1.0 1.0 0.500000 -1 material 1.0 anim bone bone
+bone frame 0.500000
+1.0 1.0 =
+material -1
+1.0
+-1
+=
+texture texture texture anim
+frame 0.500000 frame
+bone 1.0 bone frame
+texture
+vertex vertex texture
+-1 texture = vertex texture frame material vertex bone bone texture
+0.500000 0.500000 bone = vertex 0.500000 = 0.500000
+material 1.0 -1 1.0 anim anim bone 0.500000 anim
+= vertex vertex 0.500000 anim
+material frame 1.0 frame vertex bone
+frame 0.500000
+material frame
+texture material frame material texture vertex
+vertex anim bone 0.500000
+0.500000
+-1 vertex
+frame 1.0 texture 1.0 material 0.500000 = bone
+bone 1.0 material frame frame vertex
+0.500000 texture anim
+= -1 1.0 1.0 0.500000 0.500000 vertex -1
+texture
+frame 0.500000 texture
+bone material anim frame anim bone
+material texture -1
+-1 anim material 0.500000
+frame
+vertex 0.500000 anim 0.500000 bone bone material
+0.500000 1.0 bone 0.500000 anim texture 0.500000 anim frame
+vertex -1 bone frame frame
+frame 1.0 vertex = = bone 1.0 material
+frame material 0.500000
+texture
+texture =
+0.500000
+material frame texture 0.500000 1.0
+= bone -1 material vertex
+texture 1.0 material vertex
+material bone = 1.0 -1 = frame
+vertex -1 -1 =
+anim material 1.0 1.0 1.0 bone -1
+texture bone
+bone vertex
+material
+vertex = material vertex 1.0
+0.500000 1.0
+anim bone frame
+bone
+anim
+texture
+= anim =
+material
+-1 material bone texture 0.500000
+0.500000
+-1 bone 1.0
+bone bone vertex
+texture material 1.0 material frame
+0.500000 = 0.500000 texture frame bone 0.500000 vertex bone bone texture
+texture -1 anim
+material material texture
+bone
+bone
+material anim frame -1 bone bone anim 0.500000 0.500000 = anim material 1.0 0.500000 -1
+-1
+0.500000
+frame vertex anim
+anim
+texture
+anim vertex 1.0 bone 0.500000 texture vertex
+material vertex = frame 1.0 frame -1 material texture texture 1.0
+= anim anim bone = vertex texture frame -1 material frame
+bone
+texture frame
+texture texture 1.0 1.0 texture vertex material -1 = texture frame vertex -1
+0.500000
+-1 1.0 -1
+vertex -1 -1
+vertex texture vertex material
+= texture bone
+material frame 0.500000 -1 = -1 -1 texture 0.500000 = vertex = anim bone anim material frame
+0.500000 texture 0.500000 vertex 0.500000 0.500000 frame -1 -1 texture anim
+vertex bone 1.0 1.0 material -1 -1 vertex -1 -1 bone anim frame vertex
+-1 bone frame vertex texture frame
+material texture texture
+texture bone
+frame 1.0 1.0 = material = =
+texture bone anim
+bone -1 material 0.500000
+bone
+1.0
+1.0 -1 0.500000
+anim
+vertex material -1 0.500000 texture anim =
+material -1
+-1
+1.0
+anim material bone 0.500000 texture vertex =
+= -1
+texture = 1.0 bone
+1.0 anim
+= -1 bone =
+vertex
+anim bone 1.0
+bone vertex anim 1.0
+1.0 = material frame 0.500000 material -1 bone
+material
+= frame 0.500000 frame
+= material
+vertex anim
+frame
+frame = material texture texture = material
+= anim material -1 0.500000 -1 =
+vertex vertex
+-1
+0.500000
+material
+1.0 vertex frame -1 -1 vertex texture anim frame 1.0 material anim material
+vertex anim anim bone material frame
+anim texture material material
+1.0 anim texture bone texture frame bone texture = texture
+bone
+0.500000 bone bone anim = -1
+= anim vertex
+-1 0.500000
+anim 0.500000 0.500000 frame texture frame texture anim
+bone frame material -1
+frame
+frame texture 0.500000 material
+frame -1 anim
+frame frame = anim material 0.500000 1.0
+vertex
+frame vertex 0.500000 1.0 -1
+vertex
+bone
+1.0 frame frame 0.500000
+vertex
+frame
+0.500000
+0.500000
+texture
+1.0 material
+=
+-1 1.0
+material
+bone 0.500000 -1
+anim 1.0 0.500000 texture
+0.500000 0.500000 -1 -1 -1 0.500000 material
+anim anim frame
+frame
+texture = =
+=
+-1 bone =
+1.0 bone bone anim = material anim
+0.500000 bone bone
+0.500000 vertex
+texture frame -1
+material anim anim frame
+=
\ No newline at end of file
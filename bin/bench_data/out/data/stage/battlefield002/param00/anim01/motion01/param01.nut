@@ -0,0 +1,10 @@
+bone
+0.500000 texture 1.0 anim
+-1 1.0 0.500000
+frame material vertex -1 1.0 = anim 1.0 texture 1.0 texture anim texture texture
+1.0 =
+=
+vertex frame frame -1 anim 0.500000 frame 1.0 frame vertex = texture bone
+anim -1
+1.0 texture bone -1 = material anim 0.500000 texture material
+0.500000 bone anim
\ No newline at end of file
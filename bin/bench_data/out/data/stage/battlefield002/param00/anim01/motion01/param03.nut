@@ -0,0 +1,129 @@
+frame vertex = bone vertex -1 frame frame frame = bone -1 1.0 material 0.500000 frame bone texture material
+bone anim
+anim bone bone = 1.0 vertex
+anim 0.500000
+texture 1.0 vertex texture anim
+anim
+= frame
+vertex = anim texture = vertex
+texture vertex material
+0.500000
+0.500000 bone bone texture 0.500000 0.500000
+texture material frame
+0.500000 -1 1.0 = frame anim
+1.0
+anim = anim anim material material 0.500000
+= -1 =
+1.0 -1 frame frame frame material 1.0 1.0
+0.500000 -1
+0.500000 texture anim 1.0 0.500000 vertex frame 0.500000 texture
+1.0 = vertex
+frame
+0.500000 frame anim frame
+texture
+bone 0.500000 = frame 0.500000 1.0 vertex frame anim
+-1 =
+1.0 vertex texture frame vertex vertex =
+bone texture anim bone texture bone 0.500000 frame bone = -1 anim material -1 frame
+anim
+texture
+texture
+bone anim = material
+anim 0.500000 bone bone bone texture -1 = 0.500000 material -1 vertex texture 1.0
+1.0 texture texture 0.500000
+-1 -1 -1 frame
+frame -1 material = = texture
+texture bone
+bone bone
+anim
+=
+-1 = anim -1
+0.500000 1.0 0.500000 1.0
+1.0
+frame bone
+anim = = anim vertex 0.500000 material
+anim vertex = -1 1.0 -1
+bone texture material 1.0 =
+= vertex
+-1
+vertex texture
+anim anim texture material 1.0 texture bone frame vertex frame = anim
+material frame material vertex
+texture vertex = anim
+=
+frame = -1 frame vertex = anim material
+= anim
+bone 1.0 anim material 0.500000
+vertex 1.0 anim texture -1 -1 material
+=
+= vertex
+0.500000 = frame
+anim
+bone
+=
+frame texture anim 1.0 0.500000
+= frame =
+vertex
+vertex material
+vertex 1.0
+-1 -1
+bone
+bone -1 1.0 texture -1 bone 1.0 vertex
+= vertex 0.500000
+texture frame -1
+bone 1.0 material
+anim 0.500000 vertex =
+material 0.500000 bone
+frame
+bone bone texture vertex 1.0
+frame
+= -1 = texture texture
+bone texture bone -1 material
+1.0 texture texture anim 0.500000
+= vertex vertex
+0.500000 = material =
+vertex bone anim -1 anim 1.0
+bone frame 1.0 anim vertex
+1.0
+-1 material texture texture 1.0 =
+vertex 1.0
+bone material = =
+material bone anim material
+texture material bone material 0.500000 bone material material material
+= = frame bone = frame =
+material
+= anim bone 0.500000 1.0
+= =
+0.500000 = vertex 1.0 frame texture
+-1
+vertex bone
+anim 1.0 vertex = -1 vertex 1.0 bone anim anim vertex texture 0.500000
+1.0
+1.0
+vertex
+texture 0.500000 texture material
+frame 0.500000 anim material 1.0 = 0.500000 1.0 vertex bone material material material =
+texture frame
+anim material 0.500000 = -1 texture -1 = = anim 1.0
+-1 1.0 = vertex
+-1 anim
+material frame texture material material
+bone -1 = 0.500000 -1 texture texture
+vertex -1
+0.500000 vertex anim 1.0 texture 1.0
+0.500000 material = material
+0.500000 0.500000
+1.0 material vertex
+anim 1.0 anim
+vertex 0.500000 = anim
+bone
+bone 1.0 bone
+frame frame bone texture
+bone vertex
+material -1 -1
+= bone 0.500000 -1
+1.0
+material frame anim -1 -1 vertex texture texture 0.500000 -1
+1.0 anim 1.0
+anim material texture
+-1 frame bone materi
\ No newline at end of file
@@ -0,0 +1,149 @@
+1.0
+=
+frame frame = frame material -1 = 0.500000 = bone texture -1 0.500000
+1.0
+1.0 frame
+-1 = material -1 0.500000 = texture bone
+bone -1 material anim -1 bone -1 =
+-1 -1 material
+vertex
+1.0 texture texture
+0.500000 -1 anim
+bone vertex
+anim
+1.0
+0.500000
+1.0 -1 texture
+material 0.500000 -1 0.500000
+-1 anim 0.500000 texture anim
+0.500000 vertex frame texture -1
+1.0 anim 0.500000 0.500000 = material frame
+frame frame = vertex
+1.0 anim 0.500000 bone 0.500000
+bone
+vertex -1 anim
+-1 bone
+bone texture anim bone vertex
+material texture
+material = anim bone
+0.500000 frame frame
+vertex 1.0 texture
+bone
+texture frame material bone texture
+frame 1.0 bone bone
+anim texture 1.0 bone vertex anim material frame frame
+0.500000 0.500000 1.0
+anim -1 0.500000
+material texture frame = anim 0.500000 1.0 material = =
+material frame anim
+-1
+1.0 frame vertex = anim
+anim frame anim
+frame -1 -1 bone frame
+1.0 bone texture
+0.500000
+=
+frame 1.0 material = frame
+-1 frame
+vertex = frame vertex
+vertex
+=
+bone bone
+bone 1.0 frame material 1.0 anim
+vertex
+frame bone
+frame =
+texture
+bone -1 texture 1.0 frame 1.0
+1.0 texture material
+anim texture
+vertex bone 0.500000 vertex = bone 1.0
+material vertex anim material anim -1 texture anim anim anim 1.0
+bone material frame =
+0.500000 texture 1.0
+vertex bone 1.0 bone -1 material material texture anim vertex anim frame
+1.0
+vertex frame
+=
+vertex material anim 1.0 vertex
+bone
+0.500000 vertex anim material
+= frame material texture = anim bone bone =
+1.0 -1 0.500000
+vertex material texture
+-1 frame anim = frame anim
+= anim 1.0 texture material
+bone material
+anim
+=
+= 0.500000 anim
+frame
+=
+vertex
+0.500000 0.500000 1.0 material =
+1.0 material material 0.500000 texture vertex
+1.0 bone bone texture
+bone vertex frame anim vertex 1.0
+material texture bone material bone frame
+bone 0.500000 texture 1.0 vertex anim
+material = texture material vertex material -1
+1.0
+material
+0.500000 texture bone 1.0
+bone 1.0
+material = 0.500000 = = bone 0.500000 vertex
+frame
+bone
+vertex
+bone
+material vertex texture -1 material = bone material
+0.500000 vertex
+-1 texture vertex = 1.0 = bone 1.0 -1 0.500000
+vertex frame anim texture
+material texture frame vertex
+anim
+0.500000 material
+-1 -1
+-1 1.0 anim
+anim frame vertex
+anim
+anim material texture bone anim
+material
+= material
+bone 1.0 frame
+1.0 texture vertex = anim 0.500000 material 0.500000 frame -1 =
+anim
+vertex material -1 texture 0.500000
+anim bone 0.500000 1.0 0.500000 1.0 bone bone -1 anim
+frame 0.500000 anim
+anim
+= frame
+anim 0.500000 -1 vertex bone material = = material
+material material texture vertex =
+vertex -1 =
+= -1 0.500000 -1
+=
+vertex
+0.500000
+1.0 texture bone vertex -1 1.0
+vertex -1
+0.500000 frame 0.500000 0.500000 0.500000
+vertex frame vertex material
+anim
+vertex 1.0 = = 1.0
+-1 frame vertex 1.0 -1 -1 bone bone vertex anim bone vertex
+= 0.500000
+texture
+1.0 0.500000
+material bone
+= = texture bone vertex frame anim texture 1.0
+vertex
+anim
+texture
+-1
+material 1.0 = texture -1 anim bone -1
+material vertex bone texture
+frame =
+vertex frame bone =
+bone anim anim vertex vertex 0.500000 anim texture 0.500000 -1
+vertex bo
\ No newline at end of file
@@ -0,0 +1,3 @@
+1.0 bone = material vertex
+0.500000 = frame =
+1.0 = frame mate
\ No newline at end of file
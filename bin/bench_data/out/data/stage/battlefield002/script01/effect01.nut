@@ -0,0 +1,305 @@
+=
+material
+vertex vertex vertex anim -1 vertex
+1.0
+= -1 texture
+anim vertex frame =
+bone vertex = anim
+texture bone
+1.0
+1.0 bone
+texture texture vertex 1.0
+= -1
+material vertex
+texture frame 0.500000
+anim
+vertex
+anim 0.500000
+anim material 0.500000 anim texture vertex vertex
+anim
+texture = bone 1.0
+bone texture frame material bone 1.0
+1.0
+bone anim -1 -1
+0.500000 1.0 anim
+texture texture = bone anim
+vertex -1 bone
+texture 1.0 frame 0.500000 0.500000 material 1.0 material
+frame 1.0 anim
+frame anim
+anim frame material material
+frame anim
+texture anim -1 1.0
+material bone
+texture texture texture -1 -1 1.0 anim
+vertex 0.500000 anim 1.0 bone anim 0.500000
+= 0.500000 1.0
+= 0.500000
+-1
+anim = anim bone anim material 1.0
+-1 frame
+bone = anim -1 material
+-1 anim = texture 0.500000 bone anim 0.500000 1.0 = 0.500000 material
+anim frame
+vertex -1 vertex material frame bone
+frame 1.0 1.0 texture vertex frame
+-1 = bone 1.0 bone texture
+-1 = 0.500000 0.500000 bone vertex = = 0.500000 = texture -1 -1 vertex frame = texture texture anim
+1.0 anim anim = -1 anim frame vertex vertex frame 1.0 material
+-1 1.0
+anim
+1.0
+texture bone
+bone 0.500000 material 0.500000
+0.500000 bone
+frame frame -1
+anim 1.0
+1.0 -1 anim bone = 0.500000 anim 0.500000
+1.0 material frame = texture 1.0
+material anim anim
+-1 frame
+texture material vertex 1.0 1.0 = 0.500000 texture
+-1 -1 =
+-1 bone -1 1.0 material
+1.0
+bone texture -1
+vertex 0.500000 bone
+0.500000 0.500000 frame frame
+vertex bone 0.500000
+bone
+anim 1.0 frame 1.0 texture frame material
+bone material material bone =
+bone bone vertex -1 material material -1 0.500000 vertex =
+-1 anim material frame bone bone material -1 -1 0.500000 texture
+texture frame vertex -1
+frame
+vertex texture frame
+bone
+=
+0.500000 vertex vertex anim
+1.0 frame
+anim = = = frame
+= vertex 0.500000 texture
+vertex 0.500000
+texture material = frame vertex 1.0 texture vertex
+material
+texture
+vertex -1
+bone frame
+1.0
+= material texture frame frame bone -1 -1
+frame bone anim vertex
+frame vertex material vertex = 1.0 = material -1 bone
+= anim
+-1
+= = -1 0.500000 anim -1
+0.500000 frame frame material bone -1 anim bone -1 = material bone
+1.0 -1
+0.500000 material bone
+frame frame =
+texture material
+0.500000 texture 0.500000
+bone anim = texture = 0.500000
+anim frame =
+= 1.0 texture anim texture vertex 1.0 frame -1 material frame 1.0
+vertex material = material 0.500000
+anim anim
+texture -1 0.500000 material material
+= 0.500000 material material -1 material = 0.500000 anim texture 0.500000 1.0
+vertex 1.0 1.0
+0.500000
+texture texture bone vertex
+anim = 0.500000
+texture -1
+vertex vertex texture
+texture 1.0 -1
+vertex
+0.500000 vertex material -1 vertex material anim vertex
+-1
+1.0 0.500000
+1.0 1.0 =
+1.0 anim material
+texture 0.500000 frame
+texture
+= frame 1.0 -1 = anim = -1 material anim
+bone = vertex
+anim texture material material = 0.500000
+vertex = frame 0.500000 texture material -1 material 1.0
+1.0
+-1
+material
+1.0 = bone texture texture texture texture vertex vertex texture frame 0.500000 bone anim 0.500000 material anim anim
+anim
+vertex
+vertex material anim
+0.500000 = = vertex 0.500000 frame
+material 0.500000
+anim material vertex
+= -1 frame material 0.500000 = anim 1.0 bone anim bone texture = bone material = anim
+-1
+0.500000 texture = frame
+bone = -1
+texture bone anim bone
+-1 1.0 vertex
+= texture
+vertex -1 1.0
+material -1
+frame
+vertex anim
+frame -1 bone = frame
+-1
+0.500000 = 1.0
+anim texture anim texture -1 frame = bone texture material
+1.0 material
+anim bone anim 1.0
+texture frame frame vertex vertex vertex
+0.500000 frame material texture vertex -1 -1 0.500000
+0.500000 frame
+bone frame
+anim = material
+bone bone 0.500000 vertex = bone
+0.500000
+0.500000 frame vertex texture vertex
+bone = = material 1.0 vertex
+anim bone 0.500000
+= texture
+bone
+bone material frame material bone
+1.0
+frame
+texture 0.500000 = -1 material bone texture material material -1 bone vertex
+-1
+frame -1 1.0
+= bone -1 vertex -1 material
+-1
+0.500000 material
+material 1.0 frame
+vertex -1 texture =
+anim -1
+anim texture -1
+vertex bone
+= bone bone
+texture
+vertex = -1 anim texture
+vertex frame vertex
+1.0 frame bone = texture anim 1.0 0.500000
+-1 anim
+-1 vertex 1.0 1.0 1.0 = 1.0
+-1
+anim material 1.0
+= material -1 vertex
+0.500000 1.0 texture -1
+material bone vertex 0.500000 material texture
+0.500000 = frame bone anim vertex
+frame bone material frame
+material
+bone
+-1 bone
+vertex -1 anim frame -1 texture
+vertex = material -1 vertex vertex frame vertex
+-1
+1.0 anim bone texture
+bone frame -1 -1 1.0 vertex 1.0 bone bone anim 1.0 1.0 1.0 anim
+anim anim anim vertex material frame frame bone vertex anim anim
+material texture = texture 0.500000
+anim material anim bone bone texture material vertex
+bone
+texture material
+0.500000 1.0 1.0
+material frame vertex anim frame bone = anim bone 1.0 -1 1.0 vertex frame
+1.0 texture anim bone
+anim = 0.500000 -1 texture
+anim
+-1 vertex
+bone 0.500000 vertex material texture vertex
+-1
+= 1.0 material 1.0 -1 vertex material frame texture anim frame material bone
+0.500000 vertex
+1.0 = -1 material
+anim material
+frame 0.500000 bone 0.500000 vertex 0.500000
+0.500000 = 1.0 bone
+texture vertex
+frame material anim
+-1 0.500000 bone bone frame -1 =
+anim -1
+anim material bone bone anim 1.0
+vertex
+bone
+-1 frame 1.0
+frame material anim texture
+-1 material 0.500000 frame 1.0
+texture 1.0
+material bone 1.0
+frame -1
+vertex 1.0 bone 1.0 texture = frame texture
+0.500000 -1 0.500000 = vertex texture material -1 material bone vertex -1 vertex 1.0 anim material bone
+material -1
+bone
+vertex vertex 1.0 material
+material vertex material
+bone material
+vertex 0.500000 1.0 1.0
+texture 1.0
+= vertex -1 texture
+texture 1.0 -1 -1
+1.0 frame 1.0 1.0 anim
+1.0 frame bone -1 anim bone vertex material
+frame = frame anim
+anim
+-1
+bone texture vertex material
+vertex
+bone bone -1 0.500000 bone 1.0 material
+anim texture material texture material 0.500000 frame
+-1 frame
+material vertex vertex 1.0 1.0 vertex vertex 0.500000 vertex
+-1
+material 0.500000 = frame 0.500000 frame anim frame
+=
+frame material frame vertex texture bone = = bone
+= bone vertex 1.0 material texture material texture vertex -1 = vertex
+anim material
+material = bone anim
+-1 frame
+material 0.500000
+= frame frame =
+1.0 1.0 vertex 0.500000 frame
+1.0 material
+texture texture
+material 0.500000 = vertex anim
+= frame
+vertex
+material texture frame texture -1 = = material 1.0 0.500000
+vertex 1.0
+= bone 1.0
+0.500000 0.500000 = anim bone = frame bone
+material frame material material
+bone frame -1 anim
+vertex = 1.0
+frame
+vertex -1 bone 0.500000
+anim
+vertex material -1 frame 1.0 0.500000 frame
+material bone
+frame 1.0 1.0
+bone vertex
+frame 1.0 = vertex bone
+0.500000 1.0 -1 0.500000
+=
+frame vertex texture texture
+frame material 0.500000 frame texture bone
+0.500000 frame -1 material vertex
+anim =
+material 1.0 frame vertex texture 0.500000 vertex bone
+frame
+material
+bone
+= material frame bone frame
+-1 frame vertex -1 0.500000 -1 bone frame texture frame bone 0.500000
+bone
+material =
+1.0
+material
+anim texture material anim vertex texture 0.500000 bone vertex texture
+material anim 1.0 = -1 frame bone 0.500000 material textu
\ No newline at end of file
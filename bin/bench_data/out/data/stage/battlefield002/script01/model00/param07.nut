@@ -0,0 +1,89 @@
+-1 bone 1.0 = 0.500000 anim -1 -1 vertex bone bone =
+material
+-1 1.0 1.0 material 0.500000
+-1 frame -1 anim bone -1 0.500000 -1 vertex bone frame
+frame texture 0.500000 anim 0.500000 texture material 1.0 bone texture
+-1
+0.500000
+-1 1.0
+-1 bone 0.500000 bone
+vertex
+vertex -1
+anim
+anim 1.0 0.500000 1.0 texture 0.500000 = material
+vertex bone -1 texture bone 0.500000 = frame
+bone
+0.500000
+= 1.0
+anim
+texture
+vertex frame
+anim frame = texture vertex frame 0.500000
+-1 1.0
+1.0 vertex vertex
+frame
+texture
+anim = 0.500000
+anim frame
+texture -1 0.500000 vertex anim bone 1.0 = anim vertex bone material anim 1.0 anim = -1
+vertex frame 0.500000
+vertex -1
+= material texture
+0.500000
+vertex
+1.0 anim anim bone
+1.0 bone anim 1.0
+0.500000 1.0
+0.500000 vertex anim texture =
+0.500000 bone
+texture
+-1
+vertex material frame
+bone vertex -1 bone vertex material material 1.0 anim anim -1 0.500000 0.500000 1.0
+= 1.0
+texture 1.0 0.500000 0.500000 texture
+1.0
+=
+1.0
+anim texture bone = -1 -1
+= anim vertex =
+bone
+1.0 -1 frame = -1 0.500000 0.500000 = vertex material
+-1
+= texture frame frame anim material material 0.500000 = material material anim anim
+1.0
+0.500000 material 0.500000 -1 frame = frame material
+-1 0.500000
+0.500000 material =
+anim
+material bone
+0.500000
+0.500000 frame texture
+vertex -1 0.500000
+0.500000 texture
+anim vertex vertex bone
+frame -1 material
+= = =
+= 0.500000 frame
+vertex anim anim frame
+1.0 -1 -1
+anim -1 material vertex = 1.0 1.0 texture
+anim
+vertex = frame
+bone =
+0.500000 frame anim texture material bone 1.0 texture material 1.0 material frame
+material frame
+1.0 texture
+texture
+0.500000
+= -1 frame
+1.0 texture texture
+texture
+vertex material =
+anim 0.500000
+frame 1.0
+0.500000
+material bone 1.0 -1
+bone bone
+frame bone
+anim 
\ No newline at end of file
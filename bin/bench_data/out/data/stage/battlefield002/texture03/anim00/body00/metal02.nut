@@ -0,0 +1,3 @@
+bone = 1.0 = vertex 1.0
+-1 = frame
+1
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim = 1.0
+-1 anim
+0.500000 vertex
\ No newline at end of file
@@ -0,0 +1,36 @@
+1.0 1.0 material vertex =
+bone
+= -1 texture bone
+anim
+frame
+frame -1 -1
+bone = material
+texture bone anim = -1 material
+frame -1 0.500000
+anim texture 0.500000 0.500000 vertex -1 frame
+anim 0.500000 anim 1.0 bone
+-1 1.0 -1 anim vertex 1.0
+anim texture = texture texture -1 = anim anim =
+vertex vertex 0.500000 0.500000 frame -1 1.0 vertex 1.0 1.0 anim
+anim
+= bone texture frame anim
+vertex -1 bone vertex
+bone material 0.500000 -1 vertex
+=
+anim material 1.0 anim anim bone anim 1.0 bone 0.500000 vertex bone 0.500000
+material = vertex 0.500000
+0.500000 frame -1 -1 0.500000 1.0
+anim vertex
+anim = vertex bone anim frame bone
+texture bone vertex 1.0
+= bone 0.500000 anim 1.0 frame
+-1 material -1 texture bone anim texture frame 0.500000 texture anim frame texture
+material bone
+-1 0.500000 frame vertex bone 1.0 frame
+vertex
+bone
+= vertex
+1.0 frame = texture
+vertex
+anim material vertex bone frame anim texture
+bone = frame vertex texture 0.500000 bone material 1.0 frame material texture anim 1.0 frame -1 material frame v
\ No newline at end of file
@@ -0,0 +1 @@
+Ev5>-"֜*]+T,{fpɡSsΨ^u9p
\ No newline at end of file
@@ -0,0 +1,2 @@
+1.0 = anim texture
+frame = texture frame 
\ No newline at end of file
@@ -0,0 +1,4 @@
+frame = = frame material
+bone 1.0
+-1 vertex
+0.5000
\ No newline at end of file
@@ -0,0 +1,7 @@
+-1 frame vertex frame 0.500000
+vertex bone 1.0
+material texture material 0.500000 texture 0.500000 0.500000 frame
+anim 1.0
+vertex = frame
+1.0 vertex texture 1.0
+frame
\ No newline at end of file
@@ -0,0 +1,10 @@
+anim
+= material
+1.0 = anim = 0.500000 anim bone vertex frame
+1.0 texture =
+anim material -1 0.500000 texture anim material
+frame frame frame
+bone
+= vertex texture
+-1 bone -1 0.500000 -1 vertex
+bone
\ No newline at end of file
@@ -0,0 +1,273 @@
+bone material material 0.500000
+vertex vertex frame bone = frame material anim material
+anim texture -1
+0.500000
+1.0 texture
+material bone 0.500000 1.0
+bone material frame frame bone = = texture = frame vertex 1.0
+=
+1.0 vertex
+vertex anim material 0.500000 frame
+0.500000
+vertex material texture -1 bone bone material 0.500000 -1 1.0 material -1
+material vertex -1 material
+anim texture 1.0 0.500000 1.0 1.0 bone -1 -1 0.500000 0.500000 vertex -1 0.500000 vertex 1.0 bone 1.0 0.500000 =
+bone
+texture anim frame =
+material
+= material anim texture frame texture vertex frame =
+material -1 anim anim material 0.500000 0.500000
+texture
+texture 1.0 0.500000
+texture
+bone = 0.500000
+texture bone -1 anim
+= anim
+0.500000 vertex
+0.500000
+1.0 1.0 texture vertex -1 texture frame vertex bone
+1.0 0.500000 frame anim texture vertex texture
+0.500000 frame texture 0.500000 texture bone 1.0
+vertex bone = 1.0
+bone
+texture = texture = frame texture
+material frame bone anim -1 -1 0.500000
+texture -1 1.0 material texture
+-1 texture -1 anim frame material
+vertex texture bone texture texture -1
+= texture
+material anim = frame texture = material 0.500000
+texture
+0.500000 anim
+material 0.500000 texture = -1 frame 0.500000 1.0 material anim
+frame vertex material -1 0.500000
+0.500000 bone
+1.0 -1
+bone texture frame texture
+frame 1.0 texture material 1.0 texture vertex 0.500000 -1 anim material anim texture
+material texture = vertex anim 1.0
+frame texture
+anim frame 0.500000 -1 1.0 anim material
+1.0 1.0 vertex
+=
+material
+texture
+0.500000
+material anim -1 0.500000
+vertex bone vertex =
+= 1.0
+bone
+anim anim vertex 0.500000 material = bone
+1.0 -1 texture anim
+material
+-1 texture -1 texture frame anim
+vertex texture
+1.0 texture
+texture bone
+= vertex 1.0 anim frame 1.0 = 1.0 =
+texture
+bone = 1.0
+bone
+frame frame bone
+anim frame anim
+frame 1.0 anim bone
+vertex texture = -1
+vertex 0.500000 = 1.0 material -1 = bone
+= = = texture material -1 anim = -1 1.0 anim = bone
+-1 anim 0.500000
+texture
+vertex vertex 1.0 1.0 vertex vertex 1.0 0.500000 -1
+texture frame frame texture = anim material -1
+-1 anim =
+0.500000 material material anim vertex 0.500000
+= anim
+texture = anim vertex = frame 0.500000 bone = texture frame vertex
+= 0.500000 frame anim
+frame bone = bone material
+-1 texture anim
+0.500000
+= frame -1 vertex texture 0.500000 0.500000 vertex frame 1.0 vertex
+anim anim texture = -1 vertex = material -1 =
+frame material =
+vertex 1.0 texture frame 1.0 0.500000
+anim -1 frame
+= 0.500000 texture vertex material =
+-1 frame = frame
+= vertex anim 0.500000
+= 1.0 anim vertex material 1.0 material material vertex vertex = vertex vertex vertex -1 -1 1.0
+material vertex
+anim = anim vertex vertex =
+-1
+texture
+= anim material 0.500000 anim
+material anim vertex vertex material
+vertex
+anim
+-1
+frame material 1.0
+anim bone 1.0 anim frame
+= frame
+vertex bone 0.500000 material = bone texture -1 0.500000 texture texture anim
+frame bone vertex 0.500000
+texture vertex anim texture frame 0.500000 =
+bone 1.0 0.500000 anim frame frame
+1.0 material vertex vertex 1.0 1.0 0.500000 anim anim
+anim = material -1 anim 0.500000 bone
+1.0 -1 texture material
+bone
+= material frame
+anim bone
+material 0.500000
+material
+material 0.500000
+= -1 0.500000 anim
+0.500000 -1
+bone
+frame -1 anim frame
+0.500000 material
+material vertex bone 1.0 vertex
+vertex = -1 texture
+texture anim anim 0.500000 1.0 1.0 0.500000
+vertex
+frame -1 vertex frame bone
+frame = anim 1.0 material material
+0.500000 -1 material -1
+frame texture
+= anim material = 1.0 0.500000 bone material 1.0 1.0
+vertex frame
+frame anim
+frame
+frame material
+frame
+= bone texture = texture 0.500000 bone texture
+-1 frame -1 = -1 material 0.500000 1.0 anim
+texture bone
+= vertex bone 1.0 0.500000 0.500000 = -1
+1.0 -1 texture texture 1.0 material anim anim frame bone
+= vertex material
+vertex bone anim -1 frame frame = -1 0.500000 frame material vertex
+= 0.500000 bone bone
+texture material texture
+vertex bone vertex frame texture
+bone
+frame bone =
+bone frame
+frame 0.500000 0.500000
+-1 bone 0.500000 -1
+1.0
+bone vertex bone frame texture -1
+material bone frame anim
+vertex =
+bone
+1.0 material -1
+-1 0.500000
+1.0 -1 1.0
+0.500000
+anim frame = texture texture 0.500000 1.0 0.500000 0.500000 1.0 bone -1 vertex texture vertex texture material 1.0
+0.500000
+anim vertex frame
+vertex frame 0.500000 texture vertex vertex frame
+texture
+0.500000 vertex frame
+= 0.500000 material =
+material
+frame texture texture texture 0.500000 bone bone -1 vertex anim material 0.500000 = 0.500000 material frame texture bone 1.0 = bone material
+anim 1.0 bone = bone anim texture = material
+1.0
+vertex
+0.500000
+vertex
+1.0 = -1 -1 frame -1 0.500000 0.500000 anim texture
+vertex vertex frame 1.0 0.500000 0.500000 texture frame 1.0
+= = -1 bone texture 1.0 -1
+texture texture
+=
+material 0.500000 texture = bone 1.0 0.500000 0.500000 -1 material frame 0.500000
+bone bone
+= anim texture bone
+material = frame
+frame anim
+material vertex bone = 1.0
+1.0 =
+material anim 1.0 anim
+material texture 0.500000 material frame material anim 1.0 material frame
+anim = = bone
+material texture 0.500000
+frame frame vertex -1 anim anim anim texture
+-1 anim 1.0
+= 0.500000
+1.0 = 0.500000 vertex frame material -1 1.0 texture
+anim vertex
+anim -1
+vertex bone
+-1
+anim 0.500000 bone texture
+1.0 texture =
+bone material anim material bone texture
+= frame 0.500000 vertex vertex anim
+anim -1 texture
+1.0
+-1 = material bone material 1.0 1.0
+0.500000 bone texture bone
+anim material material = 1.0 0.500000 bone 1.0
+material = -1 texture
+frame -1 material material -1 vertex 0.500000 material 1.0 0.500000 bone 1.0 anim
+bone 0.500000 = vertex anim frame
+= = anim bone
+material texture texture
+0.500000 vertex 1.0 =
+frame bone = 0.500000 frame bone 1.0 0.500000 texture vertex 0.500000 anim texture 1.0 material texture frame texture anim 1.0 frame anim
+material
+bone anim bone bone 0.500000 vertex =
+vertex vertex texture anim 1.0
+-1 vertex 0.500000
+texture
+vertex = -1 vertex
+anim 1.0 -1 = material = vertex texture 1.0 -1
+material 0.500000 -1 material anim vertex
+material 0.500000 anim anim vertex -1 1.0 texture
+texture = frame
+frame
+-1 bone vertex
+bone texture frame 0.500000
+vertex 0.500000 material 1.0 texture anim anim 0.500000 anim
+bone
+-1
+vertex material bone bone
+=
+anim
+material vertex anim -1 frame anim frame
+=
+anim material frame bone
+0.500000 vertex 1.0 1.0 0.500000
+bone vertex material bone
+1.0 anim anim vertex texture =
+vertex vertex texture = bone material frame frame frame
+texture texture bone vertex
+frame -1 vertex texture frame bone frame
+= =
+0.500000 bone
+-1 frame
+-1 frame material
+texture vertex
+1.0 = -1
+0.500000 material -1 0.500000 =
+vertex 1.0 frame
+anim vertex
+-1 = frame = texture bone
+vertex frame 0.500000
+frame
+texture
+anim
+= vertex
+1.0 -1
+bone bone 1.0 material -1 = vertex vertex 1.0 -1
+frame -1 texture bone anim
+1.0 bone
+=
+frame anim material material -1 = texture vertex vertex
+0.500000 material
+material 0.500000 texture texture
+bone 0.500000
+-1
+bone = v
\ No newline at end of file
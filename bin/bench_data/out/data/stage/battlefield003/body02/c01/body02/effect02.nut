@@ -0,0 +1,11 @@
+frame -1 0.500000 vertex vertex -1 1.0 frame material vertex
+0.500000 1.0 vertex
+1.0 1.0 0.500000
+= vertex 1.0 0.500000 -1 bone frame texture material bone =
+0.500000 0.500000 vertex -1 bone anim 0.500000 material = material material -1 1.0 -1 texture bone frame = 0.500000 -1 anim 1.0 = texture anim 0.500000
+bone vertex anim vertex 1.0 vertex bone
+= 0.500000
+frame 1.0 = 1.0 anim 1.0
+texture
+= material vertex frame vertex bone texture -1
+vertex verte
\ No newline at end of file
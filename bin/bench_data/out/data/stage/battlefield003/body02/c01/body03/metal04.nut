@@ -0,0 +1,10 @@
+0.500000 1.0 anim anim frame = 1.0 bone vertex
+bone 1.0
+0.500000
+frame 0.500000 frame frame -1 bone frame frame bone 1.0 -1 anim vertex
+anim vertex frame
+frame
+bone
+=
+0.500000 = texture
+v
\ No newline at end of file
@@ -0,0 +1,49 @@
+-1
+frame
+0.500000 -1
+frame
+1.0 = anim
+bone vertex bone 1.0 bone material = = bone
+anim -1 bone 0.500000 frame
+material frame -1 material
+1.0 bone 1.0 1.0 0.500000 = bone bone anim material
+material -1 texture bone material
+texture -1 vertex -1
+=
+1.0
+vertex
+material
+anim
+material
+0.500000
+texture bone material
+0.500000 -1 frame material vertex vertex =
+= -1 1.0 = 1.0 bone 0.500000 -1
+material material material
+frame material texture 0.500000
+bone
+-1 =
+0.500000 bone
+bone
+material
+bone anim =
+frame bone vertex material
+= material anim
+-1 texture
+0.500000 0.500000 0.500000 bone
+bone
+bone -1 texture bone
+1.0 bone 0.500000
+frame
+0.500000 anim 0.500000 vertex 0.500000 anim
+0.500000
+0.500000 1.0 1.0
+vertex
+-1 vertex -1 bone material 1.0 1.0 0.500000 texture material anim
+1.0
+texture texture 0.500000 1.0 texture material bone anim material
+material vertex
+texture frame vertex
+frame
+-1
+fra
\ No newline at end of file
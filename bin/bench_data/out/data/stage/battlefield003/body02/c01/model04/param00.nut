@@ -0,0 +1,133 @@
+bone
+anim texture
+1.0
+bone -1 = frame vertex
+= -1 0.500000 0.500000 0.500000 -1 1.0
+texture 0.500000 anim 0.500000 1.0
+frame anim -1 = = = vertex -1 0.500000 texture
+1.0 frame = anim vertex
+1.0 =
+vertex frame = =
+anim -1
+vertex =
+1.0 = bone 0.500000
+0.500000
+bone
+-1 vertex
+texture
+anim
+frame
+anim
+texture
+texture material
+anim anim
+-1
+1.0 frame frame bone
+texture frame -1
+texture vertex frame -1 material vertex texture anim texture frame anim
+texture = anim
+-1 1.0 bone bone bone
+1.0
+frame anim = 0.500000 0.500000
+=
+bone frame
+frame 0.500000 anim frame
+vertex material frame 1.0 0.500000
+-1 material
+anim
+bone
+anim vertex = -1
+frame anim bone
+vertex -1 0.500000
+anim
+material texture
+texture 1.0 anim 0.500000 1.0 1.0 vertex frame 0.500000 frame 0.500000 material -1 = 1.0 anim
+texture =
+1.0 bone
+0.500000 frame 0.500000 0.500000
+-1 anim bone
+vertex = -1 material
+-1 1.0
+anim
+= texture 1.0 vertex
+-1 frame material
+anim material material frame
+frame 0.500000 1.0 material
+anim frame =
+anim bone 1.0 anim bone texture 0.500000
+-1
+texture frame 0.500000
+bone = bone 1.0 material
+anim 0.500000 =
+vertex bone anim
+bone
+bone
+0.500000 = texture
+= texture texture material
+0.500000 = frame -1 material vertex = anim frame
+0.500000 0.500000 bone anim vertex frame
+material
+anim 1.0 vertex texture
+1.0 frame
+bone 0.500000 material vertex anim
+vertex bone 1.0
+= -1 material anim -1
+-1 bone 1.0 = texture
+anim -1 = -1
+material bone
+vertex
+texture bone bone
+material vertex frame
+0.500000 vertex
+bone -1 = material vertex vertex frame bone 0.500000 0.500000 frame
+anim frame texture frame 0.500000 texture frame 0.500000 anim
+-1
+frame vertex 0.500000 1.0 frame
+anim frame bone 0.500000
+material -1 vertex material
+0.500000 frame
+bone bone material
+material
+texture 0.500000 -1 = frame 0.500000 -1 = 1.0 vertex = 0.500000 anim texture
+vertex frame =
+0.500000 -1 frame
+bone
+0.500000 -1 texture bone bone anim
+0.500000 anim material vertex material
+material
+anim 0.500000
+-1 0.500000 anim texture anim
+vertex
+1.0 = material = 0.500000
+bone
+anim = frame vertex 0.500000 material vertex -1 texture -1 material 1.0 frame frame vertex vertex frame -1 = material texture 0.500000 anim vertex vertex frame
+material texture -1 material bone anim anim -1 bone texture vertex
+1.0 bone =
+-1 vertex material bone = bone vertex =
+bone bone = 1.0 bone material anim frame
+vertex bone anim
+frame
+vertex -1 material vertex frame = anim 0.500000 bone
+vertex vertex frame anim material
+anim = material frame vertex = = material
+bone material vertex vertex 1.0 0.500000 material
+bone -1
+0.500000
+vertex anim -1 texture = 1.0 material frame
+= texture -1 anim 0.500000 frame anim frame frame
+-1 1.0 =
+-1 vertex
+bone material
+frame material bone anim 0.500000
+texture bone 1.0
+material texture
+1.0
+=
+frame
+0.500000 1.0 frame anim 0.500000 frame =
+frame 0.500000 material
+= texture vertex
+bone
+vertex
+material = vertex material
+-1 = material 
\ No newline at end of file
@@ -0,0 +1,24 @@
+= texture material anim
+0.500000 bone -1 vertex bone bone
+anim vertex vertex 1.0 vertex -1
+-1 frame 1.0
+material vertex anim anim 1.0 bone vertex 0.500000 texture material 0.500000
+0.500000 texture
+material -1 texture = frame -1 texture material frame -1 = anim anim anim 0.500000
+material
+material 0.500000
+1.0 material =
+bone 1.0 vertex 0.500000 vertex
+anim vertex
+vertex anim frame
+bone
+anim
+bone 1.0
+= 1.0 material vertex texture texture frame bone -1 -1 frame vertex vertex bone material 0.500000 vertex material -1 vertex = anim vertex anim bone vertex = texture -1 bone
+-1
+anim =
+texture frame frame texture
+texture 0.500000 texture anim vertex anim anim
+vertex vertex 0.500000
+anim
+material 0.5000
\ No newline at end of file
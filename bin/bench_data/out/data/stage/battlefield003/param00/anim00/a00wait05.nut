@@ -0,0 +1,13 @@
+=
+frame -1 -1 1.0 frame material
+anim bone frame 0.500000 anim texture frame
+0.500000 vertex material 1.0 anim = vertex frame = anim material
+vertex
+bone
+vertex
+1.0 0.500000 0.500000 bone
+anim
+0.500000 frame frame material
+=
+frame frame frame -1 material
+texture textur
\ No newline at end of file
@@ -0,0 +1,327 @@
+-1 frame 0.500000 -1 material bone
+vertex -1 = frame vertex material 1.0 anim -1
+frame material 1.0
+frame bone anim 0.500000
+anim
+bone bone
+bone bone
+=
+vertex anim frame
+vertex 1.0
+material bone 0.500000 1.0 vertex 0.500000
+texture 0.500000 anim
+vertex
+texture 1.0 -1
+texture frame
+texture anim
+frame bone texture
+texture = = texture
+0.500000 bone frame material =
+-1 material vertex 1.0 0.500000 -1 bone frame texture
+0.500000 1.0 anim 1.0
+1.0 material material
+texture 0.500000 = anim frame
+material anim = 1.0 0.500000 bone
+1.0
+anim 1.0 =
+frame
+bone
+texture frame
+texture
+1.0 vertex 0.500000 = bone
+anim vertex material material
+anim frame 1.0 frame
+= -1 vertex vertex bone material
+1.0 bone anim texture -1
+bone 1.0 material
+anim 0.500000
+1.0
+texture vertex material bone
+vertex = vertex = bone anim material
+frame frame material texture
+texture anim vertex vertex bone
+0.500000 material
+vertex
+0.500000 anim anim texture =
+= material = frame vertex
+bone bone bone 1.0 vertex vertex -1
+= bone anim = = bone 0.500000 anim bone vertex
+= texture bone 0.500000
+vertex anim 0.500000 -1 0.500000
+= 1.0 anim = 1.0
+= vertex anim anim
+= -1 frame texture
+material
+texture 0.500000 frame vertex
+0.500000
+texture
+-1
+anim
+1.0 bone texture 1.0 bone = vertex
+= frame 0.500000 vertex vertex
+material material frame 0.500000 vertex material frame anim
+anim anim anim frame material frame =
+texture
+material
+0.500000 vertex texture anim
+texture
+1.0 1.0 frame
+vertex = -1 -1 vertex 0.500000 -1 bone material 1.0
+texture vertex
+frame 0.500000
+-1 = anim -1
+0.500000 1.0 = texture = bone
+bone 1.0 texture -1 vertex
+frame 0.500000 material
+bone
+frame material
+-1 vertex
+vertex =
+frame -1 -1 bone material
+vertex anim anim anim 0.500000 vertex frame anim bone material
+frame 0.500000 anim material anim bone material anim material 1.0 bone 1.0 -1 frame =
+bone texture
+1.0 = bone frame texture material bone bone
+= bone 1.0 bone vertex
+bone material 1.0
+vertex
+-1
+material material frame -1 0.500000 vertex 1.0 anim
+bone 1.0 0.500000 vertex -1 0.500000
+1.0
+anim vertex vertex frame material frame anim
+texture anim material
+1.0 =
+= vertex 1.0 -1 bone -1 material = texture frame 1.0 -1 bone 0.500000 = anim vertex
+1.0
+frame = -1 0.500000 1.0 bone bone -1 0.500000 texture anim frame = bone
+frame 1.0 1.0 -1 bone frame
+0.500000 0.500000 material
+1.0 material
+= frame vertex
+bone frame
+frame frame
+frame
+-1 material material texture
+1.0
+-1 bone frame bone
+anim
+bone -1 = material material
+material 1.0 frame -1 material 1.0
+frame material 0.500000 vertex -1
+vertex material 1.0
+0.500000 bone 0.500000 frame frame = material
+1.0
+bone -1
+=
+anim bone
+bone = material anim =
+1.0 -1 0.500000 material -1 texture frame 1.0 material
+vertex 1.0
+anim 0.500000 texture
+1.0 bone
+frame 1.0 0.500000 frame material vertex
+= bone bone
+anim -1 texture -1
+vertex
+-1 -1
+bone texture texture 0.500000 frame = material
+=
+texture
+0.500000 texture 1.0
+anim =
+= -1 1.0 anim
+-1
+material anim material frame bone anim anim bone material material material 0.500000 -1
+texture bone material anim anim 0.500000
+= bone anim = vertex material
+texture
+1.0 anim bone texture bone
+material -1 anim frame 1.0 bone -1 0.500000 vertex
+texture frame -1
+0.500000 vertex frame bone
+0.500000
+bone
+=
+vertex bone
+texture vertex 0.500000
+= texture
+texture bone vertex frame 0.500000 texture
+vertex frame texture
+bone -1
+=
+1.0
+vertex =
+0.500000 0.500000 material
+vertex 0.500000 0.500000 0.500000 bone texture bone 1.0 vertex vertex bone
+0.500000
+-1 vertex texture
+0.500000
+= 1.0
+anim frame
+1.0 texture frame
+-1
+material
+anim anim texture frame -1
+anim -1
+texture anim = 0.500000 material vertex texture anim
+-1 0.500000 material bone -1
+1.0 1.0 1.0 0.500000
+0.500000 anim 1.0 frame bone 1.0 -1 = -1 vertex anim -1 =
+1.0 -1 1.0 texture 1.0
+= vertex material 0.500000
+vertex bone bone
+-1 bone
+material anim 0.500000 frame 0.500000 vertex
+frame -1 -1 texture
+vertex
+frame bone bone -1 = texture bone frame anim 0.500000 frame texture 1.0 bone texture vertex 1.0 = 1.0 1.0 0.500000
+0.500000 -1 texture vertex 1.0 anim frame bone
+anim
+1.0 vertex = 1.0 anim
+anim frame 0.500000 vertex -1 frame anim
+texture
+1.0 bone material = -1 0.500000 0.500000
+vertex texture material material material vertex material
+bone -1 vertex material anim material frame 1.0 vertex anim 0.500000 anim vertex material
+frame
+0.500000 material anim anim
+texture
+0.500000
+= bone
+= vertex 0.500000
+1.0 vertex
+1.0 frame 1.0 texture 0.500000 bone
+frame
+1.0 texture material = material vertex frame =
+= texture 1.0 frame
+= material -1
+vertex 1.0 1.0
+0.500000 0.500000
+0.500000 vertex = bone bone -1 material
+0.500000 vertex
+frame material frame
+frame = frame material 0.500000 = texture -1
+material bone -1 -1
+frame 1.0 bone
+0.500000 = bone texture = 0.500000
+vertex material
+bone -1 anim 0.500000 material
+0.500000 frame bone anim anim frame 1.0 texture texture = frame
+-1
+1.0 1.0 anim 1.0 vertex anim 1.0 frame
+bone texture
+bone
+= -1 anim vertex
+material
+anim -1
+material 0.500000
+material frame vertex -1 texture bone =
+vertex texture = vertex anim bone texture material -1
+= material 0.500000 0.500000 anim texture vertex
+vertex
+anim frame bone anim -1 vertex texture = bone
+anim -1 =
+texture material
+texture vertex 1.0 texture 1.0 -1
+material vertex vertex
+-1 = anim = frame
+1.0 0.500000 texture frame material 1.0 material 0.500000
+bone
+vertex frame = = -1
+bone material
+anim
+bone material
+= texture -1 anim anim material = vertex
+anim
+material -1 1.0 texture 0.500000 1.0 bone bone
+-1 0.500000 bone vertex anim
+frame 1.0 0.500000 anim -1 anim -1 -1 1.0
+vertex
+1.0 0.500000 material 1.0
+vertex
+1.0 0.500000 1.0
+anim bone anim
+bone material
+texture 1.0 frame texture -1 vertex -1 0.500000
+vertex =
+frame bone
+frame vertex bone = texture material 0.500000 texture texture = texture =
+anim material anim texture = bone
+texture vertex anim frame
+-1 anim anim 1.0 0.500000 -1
+= frame = = 0.500000 -1 1.0 1.0
+0.500000 -1 material anim
+frame -1 texture material 1.0 1.0 bone 0.500000
+1.0 texture anim anim frame vertex
+vertex material vertex
+vertex frame material material
+frame anim 0.500000 bone 1.0
+frame 1.0 vertex
+= anim material -1
+-1 0.500000
+1.0 1.0 bone anim
+= bone
+0.500000 anim
+texture =
+1.0
+0.500000 frame
+texture 0.500000 bone
+0.500000
+vertex 1.0 vertex 0.500000 vertex 1.0 = 1.0 0.500000 -1 vertex frame vertex vertex = = bone bone
+vertex texture 1.0 = 1.0
+anim 0.500000 bone 0.500000
+0.500000 = material anim = frame 1.0 =
+anim
+1.0
+anim vertex
+vertex anim
+= bone bone texture material -1
+1.0
+material
+= 0.500000
+vertex -1 = -1
+frame 1.0 1.0 0.500000 vertex anim vertex
+= 0.500000 1.0 texture vertex
+-1
+material
+vertex frame -1 vertex 1.0 texture anim 0.500000 frame texture
+anim 0.500000 texture texture 0.500000 frame = anim
+texture frame
+anim 0.500000 1.0
+frame
+material
+bone -1
+texture bone material vertex -1 texture
+-1 material
+material
+1.0 material anim texture vertex 1.0 = frame frame
+-1 1.0
+vertex 0.500000 anim = frame 1.0
+= 0.500000
+bone
+vertex vertex = = bone 0.500000 1.0
+1.0 0.500000 vertex
+vertex -1 anim material
+texture -1 frame -1 material
+material frame material anim 1.0 vertex 1.0
+texture
+vertex = = material 1.0
+-1 bone frame material -1 material texture 0.500000 bone vertex frame
+bone
+-1 1.0
+vertex vertex material -1
+= bone bone bone anim
+bone
+1.0 1.0
+frame 1.0
+0.500000 material = anim material 1.0
+anim material = texture bone material -1 = -1 bone
+vertex
+texture
+-1 1.0 vertex material bone
+vertex bone
+frame 0.500000
+1.0 1.0 anim anim
+0.500000 texture
+1.0 0.500000 vertex texture vertex
\ No newline at end of file
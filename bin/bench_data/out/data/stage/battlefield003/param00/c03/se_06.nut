@@ -0,0 +1,20 @@
+material -1 texture
+= anim frame texture
+1.0 bone
+= texture material anim
+texture =
+vertex vertex bone = bone bone -1 material frame
+frame vertex anim frame texture -1 -1 = frame bone
+material
+material anim
+1.0 1.0 vertex material
+material 1.0 texture =
+anim
+0.500000 1.0
+1.0 -1 = frame texture 0.500000 frame 1.0
+0.500000 frame
+vertex
+frame
+texture bone anim -1 = texture material frame texture anim anim 1.0 material
+1.0
+materi
\ No newline at end of file
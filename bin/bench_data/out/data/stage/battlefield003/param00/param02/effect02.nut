@@ -0,0 +1,2 @@
+frame -1 anim texture anim vertex anim
+-1
\ No newline at end of file
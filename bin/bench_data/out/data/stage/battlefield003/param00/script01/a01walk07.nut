@@ -0,0 +1,18 @@
+0.500000
+vertex material 0.500000
+1.0 0.500000 anim
+-1 material bone 1.0
+0.500000 0.500000 texture = bone
+texture
+=
+vertex anim
+texture material vertex material = 0.500000 vertex texture -1 material -1
+= 1.0 -1 vertex 1.0 =
+vertex -1 frame
+0.500000
+vertex texture anim = 0.500000
+bone bone
+frame -1
+= -1 vertex bone 0.500000
+= material anim
+0.500000 anim vertex
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone material frame
+material anim bone frame material anim
+= = bo
\ No newline at end of file
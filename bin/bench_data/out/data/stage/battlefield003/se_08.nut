@@ -0,0 +1,162 @@
+0.500000 1.0 = -1 frame frame material = anim material 0.500000 = 0.500000 0.500000
+bone anim
+= vertex
+= -1
+bone
+anim -1 texture = material 1.0 1.0 material
+= -1 = bone texture
+frame bone vertex bone anim = -1
+vertex frame frame material -1 anim frame bone 0.500000 anim bone 0.500000 material vertex -1 material 1.0
+texture
+material
+frame texture -1 0.500000 frame frame 0.500000 anim texture
+frame frame -1 -1 vertex frame texture
+1.0 -1 frame 1.0 frame
+0.500000 -1 frame -1
+material
+=
+0.500000 vertex
+material anim material 0.500000
+bone bone material material anim bone -1
+vertex
+bone
+frame texture = anim 1.0 = bone anim
+=
+bone vertex texture
+frame
+frame
+bone frame anim vertex material frame bone bone
+-1 =
+-1 vertex -1
+-1 anim frame
+vertex -1 -1 frame
+vertex 1.0 1.0 vertex
+1.0
+material =
+vertex bone
+anim
+= -1
+1.0 1.0 = 1.0 -1 0.500000
+texture -1 vertex
+bone -1 texture frame vertex
+1.0 = material
+frame 0.500000 vertex 1.0 anim anim 0.500000 -1 frame texture texture vertex
+anim material bone -1 0.500000 bone texture = frame vertex
+anim 1.0 bone
+anim 0.500000 material anim 0.500000 anim vertex frame -1 anim material anim
+frame
+texture
+bone 0.500000 vertex
+material
+material frame
+= 1.0
+-1 -1
+texture
+texture
+1.0 0.500000 anim
+texture 1.0 material
+frame vertex frame
+bone
+1.0 = 1.0
+-1 material = texture texture
+texture -1 vertex material
+bone
+1.0 frame -1 material frame frame
+vertex anim texture bone
+vertex texture
+vertex anim bone anim material 0.500000 0.500000 bone material vertex 1.0 -1 0.500000 vertex texture frame -1
+texture frame = frame = vertex
+-1 texture vertex material
+frame -1 frame
+-1 1.0 0.500000 material = vertex bone texture
+-1 1.0
+material 0.500000 texture anim
+texture
+anim = = 1.0 bone -1 vertex material 0.500000 material texture anim
+texture frame bone
+0.500000 = anim material material anim -1
+vertex 1.0 anim material frame vertex -1 -1 anim
+0.500000 frame vertex -1 = 0.500000 0.500000 1.0
+frame vertex anim
+1.0 texture 0.500000 anim vertex 0.500000 = anim texture anim material vertex
+1.0
+-1 texture 1.0 anim
+frame
+vertex -1
+0.500000
+frame
+texture
+texture
+anim
+anim 0.500000 1.0
+material frame
+material
+= -1 anim texture
+material
+frame
+material 0.500000
+material bone -1
+-1 material 0.500000 0.500000 frame anim vertex
+texture
+anim 1.0 0.500000 = =
+texture frame 1.0
+texture bone 0.500000 material vertex texture
+material material bone
+-1
+= 1.0
+1.0 anim vertex
+vertex
+frame =
+anim -1 1.0 texture
+frame
+-1 material anim vertex -1
+bone 1.0 = 1.0
+frame
+frame material
+bone
+anim -1 frame anim = 1.0 material 1.0 texture = -1
+-1
+anim 0.500000 bone frame frame anim texture 1.0 frame
+vertex
+material material
+0.500000
+texture = 0.500000 = material frame = texture material -1 vertex
+= -1 = 0.500000 bone frame anim vertex texture 1.0 bone material 0.500000
+vertex material
+bone
+0.500000
+frame
+frame texture
+frame
+texture texture material bone texture vertex texture vertex anim 0.500000 0.500000 material frame frame = anim
+texture -1 anim
+1.0
+1.0 -1 texture frame
+= bone material 0.500000 1.0 frame
+bone -1
+1.0 texture 1.0
+vertex 1.0 -1 vertex frame 0.500000
+texture vertex
+material
+-1 bone -1
+material anim vertex -1 texture texture
+0.500000 vertex frame bone
+frame vertex material 1.0 anim
+1.0 bone anim
+material vertex
+=
+1.0
+vertex
+-1 0.500000 vertex
+material
+0.500000 frame material vertex material texture = frame bone 0.500000
+vertex 1.0 bone =
+1.0 bone
+texture bone anim = material vertex texture vertex 1.0 -1 anim anim
+= material
+0.500000 -1 = vertex
+material anim texture =
+1.0
+frame
+material 0.500000
+= material
@@ -0,0 +1,5 @@
+0.500000 anim = 0.500000 vertex bone vertex
+1.0
+anim -1 -1 = 1.0
+material
+vertex fr
\ No newline at end of file
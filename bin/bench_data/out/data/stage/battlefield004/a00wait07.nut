@@ -0,0 +1 @@
+fL:g-hm6{Mac]k+p+B0a^jmϾ"dBϧ9}-m*Ƒ>R.*Ut-kxuV||Ѝ/+܋J~Aw<JU2$rIej+h.TJ-Ox*xKe#>2Ll;q{`˿b\(|˥-8d{kwDh_Vk5iNovM\ɱ+6'&MKG[G|&:]z"eAPp-咛{Go*sycЀBylf߲kGOO~	8)Oޢq=GQ6RtR
\ No newline at end of file
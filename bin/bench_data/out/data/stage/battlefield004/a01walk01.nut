@@ -0,0 +1,41 @@
+texture 1.0 anim bone
+bone = frame
+anim texture 0.500000 frame
+= =
+material bone
+texture = frame
+material 1.0
+material 1.0 0.500000
+anim 0.500000 = texture texture vertex
+vertex vertex
+frame
+texture
+anim anim material
+vertex material -1 frame -1 material bone texture
+frame -1 texture 0.500000 0.500000 -1 -1 vertex
+=
+-1
+0.500000 frame material frame material =
+bone frame
+1.0 frame frame
+anim bone 0.500000 anim frame bone -1 = = 1.0 frame
+anim = anim texture -1 vertex
+texture
+-1 0.500000 material
+frame material bone texture anim vertex frame material
+1.0
+-1 0.500000 0.500000 anim vertex bone
+anim texture frame vertex -1 -1
+0.500000 = material -1 anim
+anim
+-1 1.0 material frame
+anim
+1.0 texture
+1.0 bone texture
+1.0 texture bone frame
+texture 0.500000 1.0 vertex -1 1.0 =
+= 0.500000 = 1.0 anim 1.0 -1 -1 1.0
+= 1.0 frame = texture = vertex 1.0
+vertex = texture frame anim = 0.500000 1.0 -1 texture material vertex -1 texture
+anim -1 frame 1.0 0.500000 frame bone = anim 1.0
+vertex 1.0 vertex vertex anim anim frame vertex bone 1.0 = material 0.5
\ No newline at end of file
@@ -0,0 +1,58 @@
+frame anim vertex frame
+frame
+0.500000 -1
+bone
+anim 0.500000 bone anim
+vertex -1 -1
+0.500000 vertex vertex vertex bone texture frame
+material
+-1
+material material
+texture anim = vertex material 1.0 material anim frame
+frame
+material vertex frame material
+vertex material
+-1 anim texture bone
+-1 vertex -1 vertex -1
+material anim
+-1 1.0 = material vertex =
+1.0 anim frame 1.0 material 1.0 -1 material
+= frame frame texture 1.0 0.500000
+frame vertex frame texture texture texture
+anim frame -1 -1 = 0.500000 material 1.0
+= =
+= 0.500000 frame 0.500000 = frame vertex
+vertex
+= 1.0 material anim anim frame vertex 1.0 anim material =
+anim texture vertex
+texture anim material vertex vertex frame material texture
+= frame = vertex material vertex
+frame 0.500000 texture frame 1.0 anim
+bone
+0.500000
+bone -1 =
+=
+texture material
+= texture texture texture texture bone 1.0
+material frame 1.0
+texture
+vertex material = texture = material texture frame vertex = = bone texture -1 -1 =
+texture vertex
+bone anim vertex
+= material
+texture vertex
+material = texture
+texture material frame 0.500000
+material -1
+1.0
+anim
+-1 bone 1.0 texture bone vertex
+frame frame 1.0 = 0.500000 1.0 vertex bone 1.0
+-1 texture
+frame bone material 1.0 1.0
+bone 1.0 0.500000 anim
+material
+anim
+frame
+1.0 -1 -1 texture
+0.500000 
\ No newline at end of file
@@ -0,0 +1,83 @@
+frame =
+= frame
+material = anim
+bone -1 bone
+1.0
+texture -1 texture bone
+frame 0.500000 frame anim
+1.0 vertex
+0.500000 texture vertex material 0.500000 frame bone 1.0 frame = =
+texture 0.500000 bone = material
+0.500000 texture vertex 1.0 texture = anim 0.500000 texture vertex frame anim = 0.500000
+-1 = =
+vertex anim = =
+anim 0.500000 vertex 1.0
+1.0 vertex
+= frame = bone material = material
+frame frame
+frame = material vertex
+vertex -1
+= frame 1.0 = 0.500000 = 1.0 0.500000 texture 1.0 -1 frame vertex 1.0 =
+= 1.0
+1.0 -1 bone material -1 = bone material material 0.500000 texture 0.500000
+bone -1 frame 1.0 0.500000 texture 1.0
+texture
+bone vertex bone 0.500000 = bone texture vertex texture = =
+0.500000 material 1.0 texture anim anim texture vertex 1.0 texture texture -1 texture texture material frame bone bone
+anim -1
+material 1.0
+-1
+bone
+texture bone -1
+texture vertex texture material 0.500000 anim frame material frame 1.0 -1
+-1 vertex vertex texture 0.500000 -1
+0.500000 vertex anim
+anim
+anim
+1.0 frame = material
+-1 0.500000
+texture vertex 0.500000 vertex = 1.0 -1 material vertex frame vertex = anim material = frame
+vertex texture vertex texture frame
+bone
+material anim texture texture -1 texture 0.500000 frame bone
+bone bone anim 0.500000
+0.500000 0.500000 anim anim anim 1.0 texture vertex
+= -1 anim = -1 vertex = = -1 anim material frame anim vertex frame bone
+bone bone
+material
+material texture
+= anim texture vertex
+= 0.500000 anim -1 1.0 0.500000 -1 frame 0.500000
+texture
+1.0 frame
+texture frame texture bone material bone
+-1 texture material
+-1 1.0
+vertex -1 material frame 1.0
+material material
+vertex
+frame
+frame vertex material material
+= 1.0 frame vertex 1.0 0.500000 = frame
+1.0 frame -1 anim texture frame
+= frame bone anim 1.0 0.500000
+0.500000 0.500000 material bone bone
+0.500000
+bone texture =
+anim
+0.500000
+1.0 bone
+frame
+texture
+-1 0.500000
+-1 1.0 bone frame 1.0 -1 texture
+material texture material
+frame texture anim = frame
+0.500000 anim = 0.500000 material material 0.500000 -1 anim anim -1
+1.0
+frame material 1.0 0.500000
+material material vertex material texture bone texture 1.0 anim material 0.500000 1.0 1.0 bone -1 0.500000 -1 -1 texture anim frame 1.0 texture vertex material
+vertex -1
+=
+0.500000 vertex
+texture an
\ No newline at end of file
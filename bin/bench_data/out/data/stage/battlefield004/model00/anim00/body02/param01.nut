@@ -0,0 +1,2 @@
+0.500000 anim frame bone
+1.0 bone fr
\ No newline at end of file
@@ -0,0 +1,120 @@
+anim vertex 1.0 material 0.500000 1.0 0.500000 texture
+0.500000 vertex material = vertex 1.0 frame = = =
+1.0 texture 1.0 1.0 -1 texture bone vertex vertex = frame 1.0 0.500000 frame texture 0.500000
+bone
+= material -1
+0.500000
+frame vertex texture bone 1.0
+1.0
+frame frame
+anim vertex = 1.0 frame material
+0.500000 texture = 1.0
+0.500000
+frame 1.0
+material = anim = 1.0 material 1.0 anim 0.500000 bone
+bone =
+texture
+anim texture bone -1 =
+0.500000 texture frame 1.0 0.500000 texture 1.0 frame material material vertex material anim 1.0 0.500000
+-1 -1 -1 anim 1.0 anim
+-1
+frame = 0.500000 -1
+0.500000
+=
+vertex vertex material vertex anim anim frame 1.0
+1.0 frame
+1.0 anim texture = -1 material material anim texture
+bone texture -1 vertex -1
+anim
+bone -1 bone 1.0 -1
+texture =
+bone
+vertex
+0.500000 -1
+0.500000 frame -1 material 0.500000 texture =
+=
+-1
+bone frame texture anim texture frame anim frame material texture -1
+-1 0.500000 anim material material 0.500000 texture
+1.0 texture frame -1 frame texture bone
+texture
+material
+texture = material
+material frame
+1.0
+bone vertex texture
+-1 frame material =
+material material
+-1 -1 0.500000 anim material anim 1.0 = vertex
+vertex frame material frame 1.0 frame vertex
+1.0 0.500000
+vertex = vertex anim 1.0 0.500000 frame bone 0.500000
+anim material frame = bone
+-1
+vertex = anim anim =
+frame vertex
+anim bone
+anim
+texture frame 1.0 frame frame vertex vertex = bone = 1.0 1.0 bone vertex
+anim = bone 1.0 texture 1.0 material vertex frame texture 1.0
+= material anim frame = vertex = anim
+bone
+vertex anim vertex frame material
+= 1.0
+0.500000 vertex vertex
+anim bone 1.0 vertex frame 1.0 texture
+bone
+bone -1
+texture frame bone
+bone -1 vertex material
+material vertex 1.0 vertex vertex
+0.500000 frame
+frame frame
+0.500000 vertex bone
+frame = vertex material bone vertex -1
+= -1 material -1 = bone frame material 0.500000 = 0.500000
+frame =
+1.0 texture -1 frame
+-1
+frame 1.0 texture 0.500000 frame material 0.500000 material vertex material anim = 1.0
+texture texture = vertex
+0.500000 bone vertex vertex
+texture vertex material
+=
+-1 =
+material frame -1 -1
+-1 1.0 texture 1.0 material -1 bone
+0.500000
+= -1 = vertex bone
+bone 1.0 bone frame anim
+-1 -1
+= material 0.500000 1.0
+frame 1.0 0.500000
+vertex material anim
+texture frame 1.0
+frame = =
+frame -1 texture = vertex
+0.500000
+material -1 vertex 0.500000 texture 0.500000 anim anim
+texture frame anim 1.0 frame 1.0 = 0.500000 material -1 0.500000 material frame material 0.500000
+material 1.0 0.500000 = 1.0 1.0 anim frame material
+bone texture -1
+= 0.500000
+bone frame
+1.0 1.0 material vertex bone texture
+material
+anim anim material vertex
+0.500000 material 1.0 -1 1.0
+texture material
+anim vertex vertex
+-1 -1
+material -1
+anim 0.500000 = frame
+texture
+vertex -1 texture frame 0.500000
+material = anim 0.500000 vertex
+texture frame anim bone 0.500000 -1 0.500000 0.500000
+frame -1 vertex
+frame bone texture
+0.500000 bone material
+0.5000
\ No newline at end of file
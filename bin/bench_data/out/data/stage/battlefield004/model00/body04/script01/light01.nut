@@ -0,0 +1,10 @@
+frame vertex
+frame texture 0.500000 frame 0.500000 vertex
+texture
+-1 material vertex bone bone
+1.0 = frame bone = = texture vertex = anim frame material 1.0 anim anim
+frame anim texture
+frame 0.500000 = frame
+frame material -1 0.500000 =
+1.0 anim
+vertex anim texture anim vertex material bo
\ No newline at end of file
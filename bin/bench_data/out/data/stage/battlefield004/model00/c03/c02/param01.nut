@@ -0,0 +1,65 @@
+anim 0.500000
+anim vertex -1 -1
+material bone -1 material = anim material texture
+anim 1.0 bone bone = -1
+0.500000 1.0 bone texture 1.0 frame vertex texture = anim material anim 0.500000 anim material vertex 0.500000
+bone material 0.500000 texture
+anim 1.0
+vertex texture
+material -1
+=
+-1
+= material frame anim = texture -1 -1 vertex anim texture
+bone anim -1
+vertex = bone anim = = frame vertex -1 material anim anim texture bone anim 0.500000 texture
+-1
+= bone -1 0.500000 anim frame
+frame
+frame
+-1 texture vertex -1 0.500000
+vertex material 1.0 1.0 bone 0.500000 1.0
+bone vertex
+bone
+bone material frame
+texture bone -1 bone bone -1 frame 1.0
+= texture anim 1.0 1.0 1.0 0.500000
+-1 0.500000 frame anim
+0.500000 1.0 anim 1.0
+anim
+1.0
+texture bone bone anim = vertex
+anim anim bone frame frame
+vertex material
+= texture 0.500000 anim bone texture bone = bone
+frame
+texture 1.0 anim
+bone material -1 frame -1 vertex material vertex
+frame frame
+material vertex
+=
+vertex vertex vertex
+= anim material -1 -1 texture 0.500000
+= material anim
+-1 material anim
+0.500000 0.500000 material texture 1.0 1.0
+frame bone
+frame -1 = anim
+bone
+= vertex frame = -1 bone
+= anim frame
+=
+material texture
+material material
+bone bone -1 = anim frame 0.500000
+= vertex vertex 1.0 1.0 1.0 1.0 vertex
+0.500000 0.500000
+anim 0.500000
+= 1.0 material bone 1.0 anim
+texture
+1.0 texture vertex vertex material frame -1 frame
+vertex vertex -1
+material texture material 0.500000
+bone 1.0 frame texture -1 1.0 frame 0.500000 1.0
+1.0 frame frame texture 0.500000 frame = vertex vertex texture = 1.0
+vertex texture
+1.0 bone texture 
\ No newline at end of file
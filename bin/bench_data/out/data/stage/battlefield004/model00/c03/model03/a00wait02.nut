@@ -0,0 +1,8 @@
+-1 texture
+-1
+-1 texture
+1.0 frame
+-1
+texture
+material
+frame material -
\ No newline at end of file
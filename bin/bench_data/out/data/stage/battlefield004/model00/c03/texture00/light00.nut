@@ -0,0 +1,72 @@
+material bone
+0.500000
+texture = 1.0 vertex texture anim =
+1.0 material
+=
+anim
+vertex vertex frame 0.500000 texture 0.500000
+-1 anim 0.500000 vertex 1.0 material 0.500000 bone bone
+frame -1
+frame
+frame -1 =
+frame bone texture = anim 0.500000 0.500000 vertex
+vertex
+vertex anim -1 -1
+material 0.500000 1.0 = bone = vertex
+= vertex -1 bone
+1.0 frame
+vertex vertex
+1.0 anim -1 0.500000 bone -1 frame 1.0 anim vertex 1.0 1.0
+bone material vertex
+-1
+bone anim anim frame frame anim 1.0 material material = anim 1.0 vertex bone frame 0.500000 0.500000 texture
+vertex texture frame
+texture frame frame -1 bone bone bone vertex material bone
+bone vertex
+anim bone bone 1.0 texture 0.500000 bone 0.500000 = material material -1
+frame 1.0 texture
+texture -1
+frame
+anim texture frame = frame
+frame vertex frame vertex = vertex bone material
+bone anim bone material frame
+anim anim texture bone
+-1 = bone
+texture
+frame =
+bone texture 1.0 = material anim vertex
+frame material vertex
+1.0 vertex 0.500000 anim vertex frame bone vertex vertex bone texture vertex
+texture 0.500000 0.500000 = vertex anim =
+bone vertex
+frame bone 0.500000 material vertex texture
+anim bone
+0.500000 vertex bone texture
+material
+bone vertex 0.500000 = 0.500000 = vertex
+frame 1.0 frame
+anim anim frame frame
+texture -1 vertex
+vertex 1.0 1.0 1.0 = frame 1.0 texture bone -1 0.500000 = -1 1.0 bone
+= 0.500000 texture anim = material
+frame vertex =
+1.0 bone 1.0 frame vertex = texture 1.0 0.500000 -1 anim = texture bone bone -1 = frame -1 anim vertex 0.500000 frame = frame material vertex anim = material bone frame vertex = 1.0
+texture frame vertex anim 1.0
+bone bone
+frame bone 0.500000 -1 bone 1.0
+material 0.500000 1.0
+-1 = texture
+material vertex texture -1 material = vertex texture bone frame anim frame
+frame 1.0 anim texture
+vertex material
+texture = vertex anim vertex material
+0.500000 vertex material 0.500000 vertex anim 0.500000 = anim vertex frame bone texture
+-1 vertex texture
+anim 1.0 material 0.500000 vertex anim 1.0 -1
+1.0 anim frame vertex 0.500000 1.0 texture frame 1.0 material bone anim
+-1 1.0 -1 frame 0.500000 texture bone
+bone
+frame vertex -1 bone bone material material 0.500000 0.500000
+vertex
+0.500000
+1.0 vertex 1.0 material =
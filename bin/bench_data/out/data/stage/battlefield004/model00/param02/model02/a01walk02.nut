@@ -0,0 +1,188 @@
+bone
+frame 0.500000
+= anim material
+= 0.500000
+= material anim
+= = anim frame
+frame -1 0.500000 texture material -1 anim material 1.0 = texture frame texture material
+vertex vertex anim bone vertex
+texture vertex = material bone -1 -1 bone
+vertex 1.0
+material
+bone 0.500000 vertex
+= = frame material 1.0 = anim vertex
+frame bone 1.0 = = 0.500000 0.500000 = texture texture bone -1 -1 1.0
+texture 1.0 anim -1
+texture
+1.0 material = anim
+0.500000 material
+anim =
+texture
+anim anim vertex texture 0.500000
+bone frame anim frame anim 1.0 -1 vertex material -1 material frame 1.0 anim bone = 1.0 0.500000 anim 1.0 bone 0.500000 = 1.0 -1 frame bone frame 0.500000 frame bone texture frame 1.0 0.500000 texture anim frame
+-1
+texture material frame
+texture -1 bone bone 0.500000
+material vertex 1.0 texture texture
+anim 0.500000
+vertex
+anim texture texture frame
+= bone 0.500000 1.0 bone -1 texture anim texture -1 0.500000 1.0 1.0
+= -1 bone 0.500000 material 0.500000 texture = = -1 0.500000 texture frame material
+frame vertex 1.0 0.500000 bone bone 1.0
+bone texture 0.500000
+material material
+1.0 1.0
+vertex -1
+bone
+bone vertex =
+texture material =
+texture
+frame 1.0 frame 1.0 material
+material bone texture vertex
+1.0 texture texture vertex
+bone
+1.0 bone anim -1 -1 0.500000 material
+0.500000 1.0 bone
+0.500000 material anim 0.500000 -1 texture
+0.500000
+vertex material
+= anim =
+anim -1 material anim 1.0 anim 1.0
+bone vertex vertex texture texture texture -1
+frame 0.500000
+vertex frame = -1 anim
+anim
+1.0 bone texture = -1
+anim = material = = =
+-1
+frame 0.500000 = bone = bone
+material vertex
+material frame bone texture = texture 0.500000 material vertex frame material
+vertex frame
+= vertex
+0.500000
+bone anim -1 frame 1.0 0.500000
+bone frame anim material
+vertex
+0.500000 texture
+vertex material
+material -1
+anim 0.500000 anim
+bone bone texture material 1.0 0.500000 0.500000 frame texture
+-1 material bone
+anim bone bone bone
+0.500000 texture
+vertex =
+bone 1.0 anim
+vertex
+anim frame bone
+frame
+anim = bone vertex 0.500000 0.500000 =
+1.0
+anim -1 anim -1 frame vertex -1
+1.0 =
+= anim
+material anim
+texture = 0.500000 = vertex bone 1.0 0.500000 material anim bone 1.0
+anim
+bone frame 0.500000 material 0.500000 texture 0.500000
+anim -1 vertex anim texture anim
+0.500000
+1.0 0.500000 =
+-1
+material frame 1.0 material vertex vertex frame = vertex
+= 0.500000
+0.500000 1.0 -1
+material -1 material material
+vertex 0.500000 0.500000 1.0 -1
+bone = -1 material -1 = 1.0 anim 1.0
+anim texture
+material bone = 1.0 material = 0.500000 frame = -1 1.0 frame
+anim vertex vertex
+texture texture anim = -1 1.0
+material material texture vertex material bone 0.500000 -1
+texture texture
+0.500000 texture bone bone -1
+vertex bone 0.500000 = = texture texture = frame 0.500000
+bone 1.0 bone -1 1.0 texture
+1.0 material
+0.500000 0.500000 vertex 0.500000 =
+1.0
+1.0 vertex frame -1 -1 texture material
+material anim 0.500000 0.500000 material anim 1.0 0.500000
+-1 material frame
+-1 1.0 material 0.500000
+texture frame anim
+vertex = -1 frame anim
+-1 vertex frame 1.0 material 1.0 material
+0.500000 1.0
+-1
+material
+1.0 frame bone frame bone
+bone material vertex texture =
+0.500000
+-1
+= vertex material texture
+bone =
+anim 0.500000
+material 0.500000 -1
+frame = bone vertex anim material 1.0 material material
+0.500000 texture frame
+0.500000 1.0 -1
+texture bone
+material
+frame texture
+bone = bone texture bone
+material =
+frame material
+vertex frame bone
+texture vertex
+=
+= texture material
+1.0
+bone frame anim
+0.500000 material anim
+bone vertex
+0.500000 bone = texture frame material = -1 = texture vertex
+-1 frame 0.500000
+1.0
+vertex texture frame 0.500000 frame vertex
+-1 0.500000 vertex bone vertex material vertex bone material anim
+frame 1.0 0.500000 vertex 0.500000 1.0
+= frame 0.500000
+-1 texture 0.500000
+texture
+frame
+frame
+frame -1 frame 1.0 0.500000 anim 0.500000 -1 material -1 frame anim frame material
+vertex 0.500000
+= vertex vertex
+= material material = 1.0 bone 1.0 0.500000
+= = frame frame -1
+texture material material material 1.0 anim material 0.500000 anim texture
+frame = texture = =
+0.500000
+texture 1.0 anim
+material = texture = vertex
+bone
+material texture bone -1 frame anim 1.0 anim = 1.0 -1 bone
+0.500000
+-1 0.500000
+frame
+-1
+-1 anim
+anim
+0.500000 0.500000
+vertex -1 = vertex vertex
+0.500000 -1 vertex = vertex vertex texture
+frame
+-1 = anim anim material frame 0.500000 anim
+= frame material
+material = texture
+1.0
+frame
+vertex 0.500000
+material = -1
+-1
+anim material
\ No newline at end of file
@@ -0,0 +1,2 @@
+texture 0.500000 bone =
+frame bone = vertex bone 1.0 bone anim frame material 0.50000
\ No newline at end of file
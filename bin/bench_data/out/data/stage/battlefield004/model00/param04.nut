@@ -0,0 +1,14 @@
+anim
+=
+-1 = bone bone vertex material vertex bone 1.0 bone material texture
+= 0.500000 vertex -1 vertex texture vertex anim vertex =
+0.500000 material -1 1.0 -1 0.500000
+material vertex -1
+anim = frame frame
+-1
+texture
+0.500000
+-1 frame anim
+vertex = frame = vertex 0.500000 anim -1 0.500000 frame material -1 1.0
+1.0 = 0.500000 1.0 anim
+vertex bone vertex
\ No newline at end of file
@@ -0,0 +1,256 @@
+vertex
+frame 1.0 vertex 0.500000 1.0 frame frame 0.500000 anim 1.0
+0.500000 = -1 frame material anim anim 1.0 material
+anim
+0.500000
+frame -1 vertex frame
+vertex 0.500000
+texture texture material -1 frame
+vertex vertex
+vertex 0.500000
+bone -1 frame bone
+=
+texture
+=
+material
+-1 = vertex 0.500000
+material vertex
+= vertex 1.0 material anim
+material bone frame
+bone = bone material 0.500000 vertex texture anim anim
+anim bone = bone =
+0.500000 texture 1.0
+anim texture
+-1 bone frame -1 frame -1 bone anim 1.0
+vertex frame 0.500000 0.500000
+-1 frame
+1.0 1.0 1.0 = = vertex 0.500000 texture 1.0 frame =
+-1 frame bone = 1.0
+vertex
+bone =
+vertex texture bone bone 0.500000 frame frame = material vertex
+0.500000 texture material 1.0 0.500000 vertex -1 =
+bone
+0.500000 texture vertex =
+frame vertex
+0.500000 -1 1.0
+-1 = 1.0 -1 =
+= 0.500000 0.500000 anim material
+0.500000 0.500000 0.500000 =
+material vertex 0.500000 anim anim -1 1.0 texture texture
+= 0.500000 0.500000
+-1 anim = vertex texture 0.500000 anim vertex 1.0
+anim 1.0 material -1 vertex material 0.500000 vertex
+-1 frame
+vertex anim
+texture
+anim
+texture =
+= anim
+texture
+material 0.500000
+texture 0.500000 vertex material
+= 1.0 0.500000 texture
+bone texture bone
+0.500000 material texture
+bone 1.0 =
+material 0.500000
+bone texture texture
+1.0
+anim bone -1 1.0 material = 0.500000
+vertex
+0.500000 material -1
+material
+= vertex 0.500000 anim material
+anim -1 = bone texture vertex
+-1 1.0 texture texture 1.0 0.500000 = texture
+frame material
+bone vertex texture material -1
+texture material material -1 vertex -1 frame frame -1 anim texture material 1.0 frame material =
+vertex material -1 vertex vertex
+=
+texture frame vertex 0.500000 bone vertex bone frame 1.0 vertex
+texture
+material material
+frame 0.500000
+anim
+0.500000 material =
+0.500000 anim vertex 1.0 -1 1.0
+-1 1.0 texture anim vertex = = texture texture = anim -1 anim anim -1 frame frame -1 vertex vertex -1 bone = 0.500000
+-1 0.500000 0.500000 -1 material
+vertex anim 1.0
+bone bone = = bone -1 vertex frame = anim anim
+material -1 anim vertex anim frame material
+texture frame anim -1 = -1 0.500000 anim
+-1 -1 material material
+bone
+anim
+texture anim 0.500000 frame
+1.0 anim = 0.500000 anim anim -1 anim frame anim anim texture bone -1 vertex = -1
+vertex anim frame bone -1 vertex texture =
+bone = vertex = vertex = frame
+vertex vertex -1 material frame texture bone
+1.0 -1 0.500000 anim
+texture
+0.500000
+material
+frame = 1.0 1.0 vertex 0.500000 = -1
+=
+-1 1.0 material anim texture
+vertex -1
+frame anim
+1.0 anim vertex -1 vertex
+0.500000 0.500000 = bone = frame frame bone
+bone vertex bone frame frame
+=
+material
+-1
+vertex =
+0.500000 bone
+texture anim frame material
+0.500000
+texture 1.0 texture anim vertex vertex
+material frame = vertex
+anim frame material
+texture -1 anim
+texture -1 -1 1.0 frame vertex bone vertex
+0.500000 =
+bone material -1 bone anim bone
+texture vertex bone material bone = = frame bone 0.500000 bone vertex -1
+1.0 material
+1.0 bone
+1.0 bone anim -1 anim -1 -1 texture
+material
+=
+anim anim -1 frame 0.500000 anim 1.0 = material material vertex vertex
+texture 1.0
+0.500000 vertex -1
+anim = texture = -1 bone frame
+frame = anim bone 0.500000 frame
+anim vertex texture
+anim frame 0.500000 -1 anim -1 frame
+bone vertex anim bone bone vertex vertex 1.0 = frame 1.0 bone
+vertex
+anim 0.500000
+-1 anim
+anim -1 0.500000 vertex = texture frame frame 0.500000 material vertex 0.500000 anim
+0.500000 material
+frame frame anim vertex
+1.0
+0.500000
+texture
+frame -1
+anim -1 bone frame
+texture
+0.500000 -1 anim frame vertex 0.500000
+texture vertex texture 0.500000 =
+=
+-1
+1.0 frame
+material 0.500000 1.0 1.0 0.500000 frame texture bone anim bone -1 = -1
+texture = bone
+frame = 1.0 texture = texture vertex material 0.500000 0.500000 anim vertex material 1.0
+0.500000
+-1 texture 1.0
+0.500000
+= frame anim 0.500000
+-1
+vertex = texture bone -1 bone -1 frame -1 0.500000 0.500000 texture
+vertex 0.500000
+-1
+1.0 material 1.0 1.0 material frame -1 vertex
+-1 vertex bone frame anim -1 anim
+bone
+anim
+texture
+1.0 1.0
+0.500000 =
+material vertex bone -1 bone bone bone
+frame bone frame 1.0 anim 0.500000 vertex
+= -1 1.0 1.0
+1.0
+1.0
+vertex
+bone material texture = -1
+bone = material frame material = texture =
+0.500000 bone texture vertex
+-1 frame vertex
+1.0 material anim bone 0.500000 -1 frame anim
+1.0 vertex 1.0 vertex 0.500000 0.500000 material
+material bone anim 1.0
+vertex -1 bone
+vertex anim 0.500000
+material
+0.500000
+0.500000 material frame
+= frame bone anim frame anim frame
+0.500000 =
+bone vertex 1.0 1.0 -1 -1 bone 1.0 1.0 1.0 bone material 1.0 anim texture vertex =
+texture vertex bone -1 texture = vertex 1.0 = 1.0 anim material material = frame frame vertex anim material
+vertex
+texture vertex 0.500000 vertex -1
+texture anim
+=
+texture -1 1.0 texture bone
+anim
+-1 -1 0.500000 material
+anim 0.500000
+1.0 anim bone 1.0 frame frame = frame vertex
+1.0
+material texture frame
+vertex
+= -1
+material
+= vertex 1.0
+1.0 -1
+-1
+material anim frame texture 0.500000 1.0 texture frame 1.0 vertex vertex texture frame material
+-1 0.500000 texture 0.500000 -1 material texture
+material texture material = frame -1 0.500000
+material
+bone 0.500000 -1 0.500000 0.500000 bone = frame frame 1.0 = -1 bone anim
+anim 1.0
+-1 = bone
+texture
+vertex texture bone bone material vertex = 0.500000 texture
+1.0
+= 1.0
+1.0 anim
+material -1
+vertex bone texture material texture
+1.0 anim material
+1.0 bone -1 = bone
+frame 1.0
+-1 -1 frame anim anim bone texture
+material
+frame -1 0.500000 texture
+vertex
+= anim
+frame
+0.500000 texture
+anim 1.0 vertex texture material bone texture 0.500000 -1 material
+vertex bone frame material 0.500000 frame anim frame -1 -1 material frame
+material -1 frame -1 -1 texture frame texture material =
+frame = bone frame
+0.500000 frame 1.0 -1 frame material
+anim
+frame -1 = frame bone frame 0.500000 1.0
+texture bone = anim vertex texture
+bone = anim -1
+0.500000 frame 1.0 anim frame
+-1 1.0
+1.0 vertex frame frame bone 0.500000 -1
+material material material material
+1.0 vertex anim texture texture vertex
+frame texture
+0.500000
+frame material
+material vertex -1
+frame frame =
+vertex anim texture anim vertex texture
+vertex
+-1 1.0
+-1 texture 0.500000 -1
+material = =
+1.0 0.500000 = texture
+0.500000 -1 frame material vertex 1.0
\ No newline at end of file
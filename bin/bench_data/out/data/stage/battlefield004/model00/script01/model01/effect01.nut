@@ -0,0 +1,62 @@
+0.500000 -1 vertex texture
+bone vertex
+1.0 1.0 0.500000 1.0 frame =
+=
+frame material anim
+=
+texture material 1.0
+frame = = =
+material material texture anim 1.0 frame texture -1 bone
+vertex anim material 1.0 -1 -1
+= texture -1 0.500000 texture 1.0
+1.0 texture
+0.500000 bone vertex
+material
+-1 0.500000 bone
+1.0 material frame = vertex vertex
+anim
+1.0 bone frame material 1.0 -1 -1 1.0 = 0.500000 material material bone vertex frame anim texture anim -1 anim material bone -1 -1 material vertex anim
+frame
+material
+anim material = vertex
+texture
+bone = 1.0 texture bone anim frame
+frame bone texture
+0.500000 -1 0.500000 material material
+0.500000
+1.0 frame
+material
+material 1.0 = -1 = frame
+material material texture -1 1.0 anim = anim vertex material anim
+anim =
+material
+vertex
+texture material material -1 anim =
+vertex
+0.500000 0.500000
+material -1 = = = 1.0 bone
+texture frame
+bone anim material
+-1 -1
+vertex -1 = frame = anim vertex 1.0
+= frame -1 -1 material -1 -1
+vertex 1.0 0.500000
+texture
+anim texture
+=
+vertex anim bone 1.0 material
+texture anim
+-1 = anim material
+bone 0.500000 -1 material = =
+texture bone 0.500000
+material anim
+material
+anim bone frame -1
+0.500000
+1.0 texture material
+frame = material bone
+anim texture anim texture frame 1.0 material = anim 0.500000 bone = 1.0
+0.500000 0.500000 1.0 frame = -1 = 1.0
+texture vertex 0.500000 texture vertex
+1.0
+fram
\ No newline at end of file
@@ -0,0 +1,263 @@
+texture 0.500000 0.500000 1.0 material = frame 0.500000 texture
+0.500000
+-1 = = vertex
+0.500000
+0.500000
+anim = material vertex frame
+material -1
+-1
+-1 vertex bone vertex = -1 texture frame material
+vertex -1 frame -1 frame =
+1.0 bone anim =
+-1 anim frame vertex -1 vertex 0.500000 bone bone texture 0.500000 1.0 anim = = 1.0 texture -1 vertex 1.0 bone anim
+bone 1.0
+material frame = texture
+vertex texture frame 0.500000 0.500000 anim -1 anim -1 1.0 vertex -1 anim
+bone frame material vertex 1.0
+1.0
+bone anim 0.500000 = vertex anim 1.0 anim vertex bone texture frame vertex = =
+texture 0.500000
+frame
+frame = material = anim bone material texture frame
+vertex anim 1.0 material bone texture anim -1 -1 1.0
+texture material
+frame anim
+material material
+0.500000
+=
+= 0.500000 1.0 texture material bone anim texture frame anim vertex
+texture 1.0 material texture -1
+0.500000 0.500000
+-1
+anim 1.0 -1 material texture 1.0 material frame -1 texture bone = 1.0 frame bone -1 =
+-1
+texture material -1 material material material
+frame anim 0.500000 vertex material
+material material material material material texture
+bone texture = frame 1.0
+frame vertex -1 -1 texture bone -1
+anim anim 0.500000 = material material material bone vertex frame
+material 1.0
+material texture
+= -1 1.0
+anim -1 texture texture texture 1.0 1.0 material vertex bone texture vertex frame 1.0
+-1 bone anim
+frame
+-1 anim texture vertex anim anim vertex anim anim texture texture anim
+bone
+0.500000 anim bone texture 0.500000
+= material 1.0
+texture texture = bone bone frame
+-1
+bone
+vertex
+0.500000
+0.500000 = 1.0 material 1.0 material material = =
+texture
+= =
+texture material bone
+bone =
+bone texture bone -1 vertex = = 0.500000
+anim
+bone
+frame material
+material anim bone -1 bone
+bone vertex
+bone vertex
+0.500000 texture 1.0 frame frame
+frame vertex
+vertex bone frame anim
+-1 vertex = material
+-1 -1
+0.500000
+0.500000 frame material = -1 -1 bone material frame
+=
+-1 -1 = -1
+=
+0.500000 texture
+material = -1 bone = anim
+frame 1.0
+vertex texture
+texture vertex frame anim 0.500000 0.500000 = frame texture -1 vertex anim
+vertex bone frame
+1.0 -1 anim
+-1 material
+-1
+0.500000 0.500000
+=
+texture
+texture -1 texture 1.0 frame 0.500000 bone texture 0.500000
+bone 1.0 texture vertex
+= bone texture
+frame
+texture -1 material
+bone
+anim -1 anim material frame
+= material 1.0
+1.0 1.0
+=
+anim
+texture anim
+texture 1.0 texture anim 1.0 anim
+bone
+= frame anim vertex
+-1 vertex material texture vertex = texture vertex 0.500000 texture
+anim vertex
+material texture anim bone -1 anim anim anim texture anim -1 anim texture frame 1.0 0.500000
+material texture
+frame material frame anim texture
+bone vertex 0.500000 = 0.500000 = anim
+texture
+frame anim
+frame
+-1 material frame bone 0.500000 bone 1.0 anim frame bone 1.0 1.0
+vertex =
+anim anim frame 1.0
+texture
+anim
+anim
+bone
+material
+0.500000 anim 1.0 vertex texture anim =
+1.0 anim
+= -1
+1.0 anim = 0.500000
+= 1.0
+-1
+-1 bone -1
+bone =
+anim texture
+material vertex material
+bone -1 material bone anim anim anim anim
+=
+-1 -1
+frame
+material
+anim 1.0
+0.500000
+= anim texture = 1.0
+anim 0.500000 material = -1
+vertex
+frame
+-1 = -1
+vertex
+0.500000
+material frame texture 0.500000 texture texture
+vertex
+bone = frame 1.0
+-1 -1 material 1.0
+texture vertex anim texture frame vertex anim frame texture 1.0 material
+bone
+-1 texture frame texture
+anim material -1 0.500000
+0.500000 texture material
+1.0 = 1.0 1.0 -1 texture material anim material
+material texture
+material anim = -1 vertex 1.0
+anim frame
+-1 anim
+1.0 bone material
+= -1 1.0 material bone material texture 0.500000 texture -1 bone
+anim 1.0 bone vertex -1 = -1 anim anim bone frame 0.500000 texture vertex
+anim
+anim
+anim 0.500000
+0.500000 texture bone -1
+bone
+-1
+-1 vertex
+=
+frame bone frame
+0.500000 frame texture bone
+bone frame -1 vertex anim texture -1
+anim material texture texture 1.0
+anim =
+bone frame anim
+1.0 bone
+= =
+vertex vertex material = anim bone 1.0
+1.0 vertex frame material
+frame vertex anim bone 1.0
+frame -1 1.0 frame =
+0.500000 anim -1 frame = frame -1
+bone vertex -1
+= frame 0.500000
+-1
+0.500000 texture bone 1.0
+-1 bone vertex 0.500000
+vertex
+vertex frame anim
+texture material
+vertex
+0.500000 = vertex -1 vertex frame -1 frame
+material = 0.500000 1.0 anim anim anim frame
+1.0 anim bone
+= frame 1.0 texture texture vertex texture bone
+0.500000 bone bone frame 1.0
+material texture
+=
+1.0 texture anim 0.500000 bone 1.0 1.0 anim material 0.500000 1.0 1.0
+= 1.0 material frame -1
+frame anim -1
+frame material frame anim frame
+1.0 -1 material
+-1 anim bone -1 frame = bone
+anim
+vertex
+1.0 material texture anim frame texture bone -1 -1 texture
+bone vertex = = frame
+texture vertex
+bone -1
+0.500000 frame
+-1
+-1 -1 vertex bone
+-1 bone bone 0.500000 material -1 anim = anim
+anim bone = frame
+0.500000 anim anim 0.500000
+material anim anim frame material =
+anim bone texture
+anim = frame 1.0 texture 1.0 texture material vertex
+vertex -1
+1.0 1.0
+1.0
+material
+1.0 1.0
+-1 material -1
+anim anim vertex material -1 anim
+anim bone anim -1
+= bone texture -1 vertex 1.0
+anim material
+frame frame =
+material = bone vertex bone anim frame vertex -1 = vertex vertex texture = -1 anim material = frame
+bone material
+frame
+texture texture material
+bone
+0.500000 vertex bone
+vertex material bone vertex frame frame 1.0 texture
+frame bone bone 0.500000 -1 1.0 vertex bone material 1.0 anim =
+material material 0.500000 anim 0.500000 1.0 1.0 1.0
+= = 1.0 anim
+frame bone anim 1.0 0.500000
+-1 vertex bone 1.0 -1
+material anim
+bone = -1 1.0 0.500000
+1.0
+=
+-1 bone -1 frame vertex = -1
+= 1.0 1.0 vertex material -1 frame
+vertex anim vertex frame frame anim
+texture frame =
+1.0 anim frame 0.500000 1.0
+anim material bone =
+frame bone 0.500000 anim 1.0 material -1 texture frame vertex
+texture frame
+1.0 = bone material = 0.500000 bone material
+anim material anim frame
+= material
+-1 bone vertex anim material
+material 0.500000 -1 material bone
+vertex frame frame
+anim material 1.0 bone = material
+bone bone = texture anim bone -1 vertex 1.0 anim material texture frame bone
+material 1.0 anim vertex vertex 1.0
\ No newline at end of file
@@ -0,0 +1,15 @@
+0.500000 texture 1.0 material 0.500000 frame material anim
+0.500000 = bone -1 bone
+frame
+material 1.0 -1 anim texture frame
+bone 0.500000
+frame anim vertex 0.500000 -1 0.500000 texture anim
+1.0 material
+bone
+frame
+0.500000 anim
+=
+frame anim texture anim 1.0 vertex bone
+=
+frame -1 0.500000
+material 1.0 1.0 
\ No newline at end of file
@@ -0,0 +1,14 @@
+-1 1.0 anim frame frame -1
+= texture vertex
+vertex anim
+bone anim
+bone 1.0 frame anim
+vertex vertex material 0.500000 =
+= -1 1.0
+anim
+=
+texture vertex
+vertex material anim
+0.500000 1.0
+0.500000 anim
+anim vertex frame 
\ No newline at end of file
@@ -0,0 +1,163 @@
+1.0 0.500000 anim texture frame
+texture -1
+=
+frame
+1.0 -1 =
+= 0.500000 bone 1.0 frame = bone texture = material bone 1.0
+anim = anim
+-1 -1 -1 anim frame anim = material
+vertex -1 texture
+frame vertex -1
+anim material
+material
+anim bone -1
+anim
+0.500000 -1
+= -1 = bone = vertex texture -1 0.500000 material material 0.500000 anim material texture bone 0.500000 material frame frame frame bone vertex 0.500000 material 0.500000
+0.500000 texture = texture texture bone material = = frame =
+material bone
+-1
+-1 texture
+1.0 vertex vertex 1.0
+0.500000 bone texture material
+0.500000 1.0 = -1 bone -1 frame material material material texture
+material bone vertex 1.0 anim
+1.0
+texture
+vertex -1 1.0 bone =
+-1 -1 bone -1
+= vertex
+bone 1.0 1.0 vertex 1.0
+texture vertex 0.500000 =
+0.500000 bone 1.0 1.0
+bone frame bone bone vertex -1 = material
+vertex = anim frame material frame
+vertex
+texture material anim 0.500000
+= 1.0 vertex texture
+frame 1.0
+texture
+frame bone
+texture
+bone texture 0.500000
+1.0 anim =
+texture frame -1 texture anim texture texture 1.0 0.500000 0.500000
+material
+0.500000
+= material texture 1.0 bone
+1.0 bone vertex
+0.500000
+-1 frame
+material 0.500000 anim
+vertex -1 frame -1 material
+1.0 -1 -1 -1
+vertex texture frame = anim material anim material anim bone 0.500000 anim
+anim material frame
+=
+frame frame
+0.500000
+-1
+-1 0.500000 = -1 frame
+anim material vertex anim texture anim
+material -1 0.500000 1.0 anim bone material
+material -1 1.0 vertex = frame -1
+vertex frame frame
+material material frame material -1
+1.0 -1
+-1 0.500000 1.0 = bone material
+texture 1.0 anim 0.500000 frame vertex -1 texture
+-1
+-1
+anim 0.500000 bone
+anim
+anim vertex vertex
+texture -1 -1 1.0
+texture -1 = vertex material anim material =
+1.0 anim vertex = 0.500000
+1.0
+-1 1.0 anim -1 0.500000
+material texture -1 texture
+bone texture = 1.0 anim
+vertex texture
+material
+-1 1.0
+texture = material -1
+texture
+-1
+0.500000 material
+-1 texture = frame vertex material
+1.0 frame material
+vertex =
+0.500000 texture 1.0
+anim anim = 1.0 = -1 0.500000 texture vertex =
+frame 0.500000
+frame frame -1 anim
+= anim 1.0 anim = bone vertex
+anim frame 0.500000 anim
+vertex anim frame material frame bone texture = anim = 1.0 -1
+texture =
+vertex
+= 0.500000
+texture anim anim 0.500000 1.0 0.500000 -1 -1 vertex =
+anim vertex anim
+-1
+bone texture = -1
+material material
+0.500000 0.500000 =
+anim -1
+=
+-1 bone frame
+= texture frame frame anim -1 0.500000 -1
+anim
+1.0 -1 anim texture vertex
+= anim material
+bone = =
+1.0 anim anim frame material vertex bone 1.0
+texture 0.500000 1.0
+anim
+0.500000 anim 1.0 = vertex
+anim texture
+1.0
+material 1.0
+=
+1.0 material
+0.500000 -1 anim -1 0.500000 texture frame frame texture -1 1.0
+frame material = 1.0 anim = texture material
+1.0 -1 anim
+bone anim
+= 1.0
+= =
+anim
+-1 1.0 -1 material vertex anim -1 0.500000
+= vertex texture material = 0.500000 0.500000
+anim
+= = 0.500000 texture = vertex =
+vertex
+= texture
+= -1 frame
+vertex 0.500000
+texture
+0.500000 anim
+-1
+material 1.0 material vertex vertex = bone frame anim material
+1.0 1.0 = -1 vertex 1.0 bone anim frame frame
+texture -1 vertex = = anim material texture
+vertex texture 1.0
+vertex material
+= 0.500000 vertex = texture 1.0 0.500000 texture frame material vertex bone -1 bone material = bone anim
+frame -1 texture 1.0 material frame -1 0.500000 texture vertex bone texture texture
+0.500000 = 0.500000
+material texture texture
+bone 1.0 texture bone anim
+-1 1.0 vertex frame anim
+texture
+vertex anim = frame anim
+-1 vertex 0.500000 vertex -1 1.0
+vertex = = vertex
+1.0
+bone
+frame = vertex bone 0.500000 = material
+anim texture = anim -1 frame
+frame
+texture material bone frame vertex anim 0.500000 -1 vertex vertex texture = anim
+materi
\ No newline at end of file
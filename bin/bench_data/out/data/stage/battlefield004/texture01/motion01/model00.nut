@@ -0,0 +1,5 @@
+-1 vertex anim =
+= -1 -1 0.500000
+bone
+0.500000 = texture
+mate
\ No newline at end of file
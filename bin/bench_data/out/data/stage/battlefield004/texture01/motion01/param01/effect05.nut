@@ -0,0 +1,2 @@
+texture 1.0
+material material -1 -1 
\ No newline at end of file
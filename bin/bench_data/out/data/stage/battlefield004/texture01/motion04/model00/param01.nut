@@ -0,0 +1,262 @@
+vertex
+texture anim 1.0 frame -1 anim vertex -1 anim =
+1.0 1.0
+= texture anim material vertex
+frame anim -1 -1
+material 0.500000 1.0 frame 1.0 material = texture material material anim
+texture bone
+0.500000 anim -1 frame 1.0
+anim
+0.500000 bone
+bone -1
+1.0 texture frame
+-1 0.500000 1.0 bone
+texture bone
+anim 1.0
+material 1.0 vertex bone -1 =
+-1 0.500000
+-1 bone
+texture -1 vertex material
+material 1.0 0.500000 = material -1 1.0 0.500000 material bone texture 1.0
+texture
+0.500000 1.0 -1 = bone
+bone anim vertex anim 1.0 1.0 vertex material texture
+1.0 0.500000 bone frame bone texture 1.0
+bone texture bone 0.500000 bone texture = = 1.0
+0.500000
+material 0.500000 material
+frame = anim
+material frame 1.0 texture material bone -1
+material -1 texture
+0.500000 -1 texture anim material anim material bone vertex -1 0.500000
+material
+-1 = bone
+-1 1.0 frame = texture material
+-1 frame
+0.500000
+texture
+-1 = bone material
+frame frame bone 0.500000 = -1 frame bone -1 bone texture
+1.0 1.0 anim vertex
+bone anim
+frame
+texture
+texture = vertex material
+anim anim
+bone
+frame material vertex texture 0.500000 frame material material
+bone bone frame
+frame anim 1.0 -1 0.500000 bone
+0.500000 -1 anim bone 0.500000 material vertex texture vertex
+frame vertex 0.500000
+bone
+0.500000
+bone frame = -1
+= frame frame material
+vertex
+0.500000 frame anim vertex bone material frame
+anim
+vertex material = 1.0 -1
+0.500000 frame
+texture anim
+frame
+= frame -1
+material vertex material frame
+0.500000
+texture bone -1 bone anim
+vertex
+material texture
+frame anim 1.0 texture texture
+texture frame material
+1.0 = frame anim -1 0.500000 vertex frame 1.0 bone texture vertex texture -1
+vertex
+1.0 material texture 1.0 bone texture
+1.0 material frame
+-1 -1 anim
+texture -1
+texture texture material bone anim
+frame 1.0 texture
+texture anim anim material =
+-1 = 1.0
+1.0 = vertex 0.500000 1.0 vertex -1
+0.500000
+material -1 0.500000 material vertex 0.500000 texture 0.500000 bone anim texture anim material
+texture = vertex bone texture 0.500000 1.0
+= frame -1 bone
+texture texture
+texture bone frame vertex
+vertex 1.0 1.0
+0.500000 anim 1.0 = material anim vertex -1 material -1 0.500000
+-1 material
+-1 = bone 1.0
+-1 anim
+material material frame texture 1.0 bone vertex
+frame
+frame
+frame anim anim
+anim -1 -1 anim -1 0.500000
+0.500000 -1 material = -1
+= -1 frame 1.0
+1.0
+bone texture
+1.0 material -1 vertex
+material material = material anim
+-1 vertex
+anim 1.0 1.0 frame = =
+bone
+0.500000 1.0 frame
+vertex 1.0 texture -1 0.500000 = 0.500000 0.500000 anim
+texture frame
+vertex
+frame frame 1.0 material
+-1 material 0.500000 material bone bone texture
+bone anim
+0.500000
+anim 0.500000 = anim bone
+-1 vertex
+anim
+anim
+= bone anim vertex 0.500000 texture
+vertex bone -1
+=
+-1
+0.500000 anim 0.500000
+-1 1.0 = = 0.500000 bone vertex
+frame 0.500000
+bone
+anim
+0.500000 anim frame bone -1 -1
+0.500000 frame frame bone vertex
+0.500000 = material -1 bone 0.500000
+frame bone texture bone
+0.500000 0.500000
+vertex = 0.500000
+bone frame = vertex = -1
+=
+texture 1.0
+anim bone
+anim frame =
+bone 1.0
+anim vertex
+anim 0.500000
+anim texture 1.0 = anim 0.500000 vertex
+texture frame -1 texture
+1.0
+bone frame = bone vertex =
+1.0 1.0 anim 1.0 bone texture frame
+vertex anim bone vertex
+= 1.0 texture 0.500000 material
+frame bone
+vertex vertex frame 0.500000
+0.500000 frame 0.500000 texture 0.500000
+0.500000 1.0 material bone vertex frame bone
+0.500000 -1 0.500000
+anim frame anim bone
+=
+-1
+1.0 material
+anim anim frame
+vertex 1.0
+bone 1.0 material material material
+0.500000
+0.500000
+= anim = 0.500000 vertex anim texture material texture
+material 0.500000 vertex vertex
+vertex
+= vertex frame anim = -1 0.500000 texture
+frame material material bone = 0.500000 anim -1 bone 0.500000
+vertex
+anim anim
+frame -1 material bone 0.500000 =
+-1 bone material -1 0.500000
+material anim bone 1.0
+vertex 0.500000 material 1.0 vertex material bone -1 vertex -1
+=
+texture frame = texture
+texture anim -1 = texture bone frame
+-1 bone texture texture vertex
+bone bone 1.0
+anim =
+bone 0.500000 vertex 0.500000
+0.500000 0.500000 frame vertex =
+-1 1.0
+bone -1 = texture = anim vertex -1
+anim bone material vertex
+vertex -1 texture material texture 1.0 frame -1 texture = 1.0 material = 0.500000
+bone 1.0 material -1 frame bone 0.500000 0.500000
+1.0 0.500000 0.500000 texture -1 anim
+frame
+-1
+0.500000 texture 0.500000 anim 0.500000
+material = -1 1.0
+0.500000
+1.0 vertex material 1.0 vertex
+texture bone 1.0 material
+texture -1
+1.0 material
+bone bone
+material vertex bone -1 texture
+bone -1 0.500000
+texture 1.0 texture
+texture vertex bone
+anim anim 0.500000
+0.500000
+anim vertex 1.0
+frame =
+frame material material =
+material texture
+frame texture 1.0
+0.500000 vertex
+= texture vertex anim material bone
+vertex
+anim
+texture
+vertex texture = anim material bone bone =
+material bone material vertex -1
+anim 1.0 1.0
+texture material texture
+material frame -1
+bone anim
+-1 = vertex
+-1 frame anim 1.0 0.500000 -1 vertex
+anim 0.500000 -1 vertex anim anim -1
+vertex texture 1.0 0.500000 frame = bone texture 0.500000
+material = anim frame 1.0
+bone -1 -1 vertex
+frame
+-1 frame = vertex texture
+= = -1 texture texture vertex material
+texture anim
+-1 0.500000 1.0 texture vertex vertex -1 material texture texture -1
+frame vertex -1 anim vertex -1 vertex -1 0.500000 -1 frame = 0.500000 material vertex 1.0
+0.500000
+material -1 0.500000
+0.500000
+1.0 anim = -1 texture vertex bone texture
+anim anim bone
+material texture -1 texture texture
+vertex bone
+texture
+bone = 1.0
+0.500000 anim anim texture anim vertex texture anim 0.500000 -1
+material
+texture frame -1 1.0
+anim = frame material 0.500000
+0.500000 0.500000
+= 1.0 texture -1
+-1
+1.0 -1
+-1
+1.0
+anim material -1 anim
+1.0 vertex -1 vertex
+bone 0.500000 material texture bone 0.500000
+-1 -1 = -1 material frame frame -1 1.0
+vertex 1.0 bone
+anim -1
+vertex anim -1 1.0 texture
+texture
+1.0
+anim
+texture
+anim 1.0 1.0 material 
\ No newline at end of file
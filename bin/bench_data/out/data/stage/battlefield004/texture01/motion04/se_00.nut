@@ -0,0 +1,238 @@
+texture anim -1 1.0 0.500000 -1
+0.500000
+bone =
+texture 1.0 texture -1 anim
+texture material -1 1.0 =
+material 1.0
+bone
+vertex = = vertex
+texture material bone bone 0.500000 1.0 material 1.0 -1
+1.0 anim 1.0 = = frame
+-1 texture texture bone
+texture -1 frame anim 1.0
+= bone bone = 1.0
+vertex 0.500000 frame -1
+anim
+bone anim 1.0 vertex
+frame vertex
+0.500000
+frame frame -1
+1.0
+-1
+frame bone = vertex 0.500000 0.500000 vertex vertex
+-1 frame
+vertex frame -1 texture 0.500000 anim material frame frame texture 0.500000 texture bone texture -1 material
+1.0 anim
+= vertex
+texture bone 0.500000 material
+0.500000
+bone -1 -1 anim vertex material = material
+=
+vertex -1 frame
+material bone 1.0
+vertex vertex 1.0 0.500000 -1 texture -1 vertex
+0.500000 bone anim
+bone anim =
+anim 1.0
+0.500000
+=
+frame 1.0 texture
+frame anim
+=
+texture
+anim texture anim texture frame 0.500000 bone 0.500000 -1
+1.0 material = -1 frame -1 -1 0.500000
+1.0
+material -1 vertex 1.0 anim 0.500000 frame texture texture = 0.500000 = 0.500000 anim -1 material vertex material = 0.500000
+-1 frame -1 frame 1.0
+anim material anim vertex
+= -1 anim texture frame -1
+=
+= -1 texture material anim material frame
+material -1 anim texture vertex texture 0.500000 1.0 material
+vertex = anim anim vertex -1 -1 vertex bone
+= material vertex vertex
+anim bone vertex -1 0.500000 -1 vertex
+frame = =
+bone
+texture vertex bone anim
+material =
+material
+-1 frame
+frame anim frame texture -1 material
+material
+bone = 0.500000 material material 0.500000 material 0.500000 -1 bone anim = material bone frame = -1 0.500000 -1
+-1 texture -1 -1 -1 texture 0.500000 1.0 bone
+anim
+vertex =
+1.0 bone frame vertex
+1.0 material 1.0 1.0 bone 0.500000 material bone bone material anim = anim -1 0.500000
+bone vertex
+frame frame frame 0.500000 vertex 1.0
+bone
+vertex -1
+frame
+0.500000 vertex -1 0.500000 0.500000 1.0
+texture bone
+material anim anim anim 0.500000 anim
+-1 texture vertex
+0.500000 anim vertex -1 texture material frame material = anim frame bone anim texture
+-1
+anim bone texture vertex
+anim bone texture material anim texture 0.500000
+=
+0.500000 anim
+frame = 1.0 texture
+texture material frame
+0.500000 bone = = anim bone
+material
+0.500000 -1 material anim frame
+1.0 bone
+0.500000 material =
+anim
+= anim 1.0
+0.500000 bone
+-1 frame
+frame
+bone 1.0
+texture frame frame texture anim
+vertex bone material bone bone anim frame
+=
+bone vertex 1.0 frame
+material frame
+material texture anim = frame vertex 1.0
+texture texture
+frame frame
+-1
+vertex 0.500000 anim
+0.500000 anim -1 material texture bone 1.0 material anim 0.500000
+anim texture -1 texture = bone texture anim -1 bone 1.0
+= material 1.0
+vertex texture texture 0.500000 anim
+texture anim
+0.500000
+texture vertex
+material
+-1 -1 texture = 1.0 anim 0.500000
+0.500000
+vertex frame -1 -1
+material = frame material 0.500000 vertex =
+-1 =
+frame material 0.500000
+frame
+1.0 0.500000 vertex texture material 0.500000 frame = texture bone 0.500000 bone
+anim bone
+=
+-1 material frame
+=
+bone 1.0
+texture 0.500000 material texture
+-1 1.0 vertex 0.500000 0.500000 bone bone 1.0 frame -1 0.500000
+frame
+1.0
+-1 anim
+1.0 1.0 bone bone
+1.0 1.0 texture bone vertex material -1
+= frame = frame material = = = anim bone 0.500000 frame
+bone 1.0 0.500000
+0.500000 1.0 -1 material 1.0 material 0.500000 -1 =
+frame frame
+texture anim
+=
+frame frame material 1.0 anim material
+1.0 texture =
+bone
+texture texture material bone =
+0.500000 texture -1 -1
+=
+anim
+texture = bone -1 bone 1.0 0.500000 =
+texture -1 frame vertex 1.0 vertex vertex
+material material anim = anim texture material bone
+bone vertex
+frame 1.0 material
+material texture = anim material = 0.500000 -1
+texture frame
+0.500000
+frame bone
+frame material = vertex frame 1.0 material bone
+-1
+material 1.0 -1 material frame anim 0.500000 = 1.0 material frame 1.0 texture -1 material
+0.500000 -1 frame texture frame 1.0 =
+texture -1 material
+texture frame
+bone
+vertex material material
+frame frame anim frame
+=
+anim texture 1.0 = texture anim vertex 1.0 -1
+anim
+frame
+0.500000 anim
+0.500000 material 0.500000 -1
+bone 0.500000 bone vertex 0.500000
+= 1.0
+bone vertex
+texture bone = anim material
+= material
+bone material texture bone -1
+anim 1.0 0.500000 -1 0.500000
+frame bone
+anim
+anim anim frame bone -1 anim
+= -1 0.500000 vertex
+frame
+-1 1.0
+1.0
+anim
+anim material 1.0 frame bone vertex 0.500000 anim frame bone -1
+= texture anim frame
+anim material = 0.500000
+bone vertex 0.500000 1.0 anim anim = 1.0 material frame
+anim 1.0 =
+0.500000 bone -1 frame
+anim vertex
+= material vertex
+bone texture bone anim vertex = 0.500000 vertex
+anim 0.500000 vertex 1.0 bone 1.0 =
+anim
+material -1 -1
+-1
+texture bone -1 texture
+anim frame
+vertex 1.0 material -1
+anim material
+material frame
+material 1.0
+vertex texture -1 bone anim
+1.0
+bone -1 texture
+texture frame = texture
+= material =
+0.500000
+0.500000 frame material 1.0 =
+vertex = 1.0
+texture bone bone
+texture
+frame 0.500000
+0.500000
+bone -1 texture anim material
+material bone -1 frame
+= 0.500000 1.0
+material
+-1 vertex 0.500000
+bone bone vertex material frame vertex 0.500000 bone 0.500000 material
+material
+-1 texture texture vertex -1 material material
+texture
+material texture = anim frame =
+= =
+1.0 texture 0.500000
+anim -1 bone texture 0.500000 material
+1.0 bone material vertex vertex
+frame -1 vertex = -1
+material vertex frame -1 frame anim bone 0.500000
+texture bone 1.0 material frame -1
+= anim frame texture 0.500000 material anim
+1.0 material
+texture 
\ No newline at end of file
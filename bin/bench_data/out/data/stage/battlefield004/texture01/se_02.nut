@@ -0,0 +1,157 @@
+1.0
+0.500000
+bone 1.0 0.500000 anim
+=
+-1
+bone
+texture texture frame
+material material
+= vertex vertex 0.500000 1.0 frame texture
+texture = texture frame -1
+material
+-1 material 0.500000 texture =
+material 1.0 bone = = = anim vertex
+anim -1 = 1.0 texture
+= bone anim anim 0.500000
+-1 anim material anim = vertex = material texture anim anim 1.0 anim vertex frame anim =
+-1
+texture texture
+-1
+texture =
+anim
+vertex 0.500000 vertex bone 0.500000 frame vertex material vertex
+vertex texture -1 bone =
+= texture -1
+anim material = vertex bone
+-1
+0.500000 vertex
+anim
+material frame vertex frame material anim
+anim texture = material bone 0.500000
+= vertex material texture 0.500000
+= 0.500000 bone material
+0.500000 material texture -1
+material anim = vertex material
+material anim anim texture material
+vertex 1.0 texture
+= 0.500000 anim texture 1.0 frame frame = 1.0 material 1.0 bone bone texture vertex
+0.500000
+1.0 frame frame
+0.500000 anim 1.0
+vertex
+-1
+0.500000
+material 0.500000 0.500000 anim
+material
+1.0 texture
+bone vertex texture
+0.500000 material
+-1 texture =
+anim material vertex anim material
+-1 1.0
+vertex bone vertex frame 0.500000 bone material
+= texture vertex -1 = bone
+frame -1
+vertex 1.0 bone
+frame vertex
+bone material anim 1.0 material 0.500000
+-1 material
+frame vertex = 1.0
+anim
+texture
+-1
+anim -1 vertex bone
+vertex -1 vertex
+= vertex vertex material -1
+0.500000 material 0.500000 0.500000 -1 frame -1 -1
+= 1.0 =
+texture material
+frame anim -1 anim vertex texture 0.500000 0.500000
+frame vertex vertex anim bone vertex vertex anim 1.0
+vertex 0.500000 bone
+-1 -1
+0.500000 vertex
+1.0 bone
+0.500000 -1 bone vertex = frame vertex = 1.0 anim anim material
+anim
+anim
+1.0 = bone
+material bone
+0.500000 bone texture texture
+bone -1 frame material 0.500000 1.0
+frame 0.500000 -1 = frame 1.0 -1 1.0 frame =
+texture anim
+-1
+material frame
+-1 =
+texture 0.500000 1.0 material 1.0 1.0 texture texture vertex anim 1.0 frame
+0.500000 -1 -1 1.0 = material 1.0
+anim -1 material 0.500000 bone 0.500000 anim
+material 0.500000 = 1.0 -1 frame
+-1 texture
+frame = = 0.500000 0.500000
+0.500000 texture =
+frame 1.0
+anim
+0.500000 0.500000 frame =
+1.0 0.500000 = -1
+anim vertex bone 1.0 vertex frame -1 bone = vertex
+= anim frame bone material texture 0.500000
+frame vertex
+=
+anim 1.0 =
+vertex -1 bone = vertex
+1.0 material
+material material -1 vertex anim
+frame vertex 0.500000
+frame = frame material anim -1
+texture -1 vertex
+texture vertex
+frame -1 vertex frame material bone
+frame
+1.0 1.0
+frame bone
+bone anim
+-1 0.500000 bone
+-1
+= -1 1.0 -1 1.0 = 1.0 anim bone material bone
+frame 0.500000 frame texture vertex 0.500000 vertex 1.0 vertex anim frame material material bone
+1.0 1.0
+frame
+vertex
+= bone bone frame bone texture -1 anim 0.500000
+texture
+1.0 0.500000
+bone frame bone 0.500000 =
+= 1.0 anim frame material
+anim
+0.500000 -1 -1 1.0 anim vertex bone 0.500000 bone
+1.0 anim -1 frame
+texture bone -1 bone material texture 1.0 material
+=
+bone
+texture 0.500000 vertex bone vertex vertex
+bone material 1.0 anim
+texture
+anim material frame 1.0
+0.500000 0.500000
+frame -1
+texture
+vertex texture
+bone 0.500000 = frame 1.0
+anim vertex frame =
+material texture
+0.500000 0.500000 bone
+0.500000 material texture
+material texture
+= material = frame
+-1 material vertex bone bone texture frame anim -1 frame
+frame vertex anim material frame 0.500000 anim anim vertex vertex vertex -1 -1 bone anim 1.0 frame texture vertex
+material 0.500000 -1 vertex = material material 1.0 -1 1.0 anim texture 1.0 bone bone texture
+1.0 -1 -1 texture anim texture
+material frame = frame texture material bone -1 material material 0.500000 frame vertex
+vertex anim = vertex 0.500000 material 0.500000
+-1 0.500000 0.500000 bone texture anim
+bone
+bone -1
+1.0 -1 
\ No newline at end of file
@@ -0,0 +1,2 @@
+=
+frame vertex texture frame anim anim anim anim -1 bone fram
\ No newline at end of file
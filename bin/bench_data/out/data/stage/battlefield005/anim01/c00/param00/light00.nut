@@ -0,0 +1,4 @@
+0.500000 -1
+anim
+anim material = anim texture
+frame bone 1.0 -1 0.50
\ No newline at end of file
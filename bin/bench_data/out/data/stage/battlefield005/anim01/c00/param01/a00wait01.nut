@@ -0,0 +1,36 @@
+-1 vertex frame material
+material material 0.500000 frame 0.500000 bone
+-1 -1 vertex material
+0.500000 anim vertex
+= material frame 1.0 = 1.0 material
+bone -1 vertex anim = bone bone bone = anim frame anim = bone -1
+frame
+frame
+1.0 -1
+texture
+texture = frame vertex
+= 1.0
+-1 = bone -1 = bone texture anim vertex texture texture
+bone frame
+material -1 vertex 0.500000 frame bone material -1
+1.0 = frame material
+vertex -1 bone frame
+vertex texture material vertex
+vertex 0.500000 bone vertex 0.500000 = bone 1.0
+0.500000 material bone bone
+bone
+material -1 1.0
+anim
+vertex frame anim material -1 = 0.500000 material = 1.0
+texture frame = vertex = =
+-1 0.500000
+= texture vertex bone
+0.500000
+= -1 anim 1.0 texture
+material
+frame = 0.500000
+1.0 1.0
+material
+texture 0.500000 texture bone = frame 1.0
+texture
+= 1
\ No newline at end of file
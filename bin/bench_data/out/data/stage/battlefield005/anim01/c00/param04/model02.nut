@@ -0,0 +1,24 @@
+vertex bone = frame bone material
+vertex vertex bone texture = frame
+bone texture material
+= 1.0
+= material material frame 0.500000 anim 1.0 = -1 vertex 0.500000 anim 1.0 vertex
+1.0 anim
+frame = 0.500000 1.0 0.500000 1.0 texture texture 0.500000 bone -1 frame = material bone vertex
+material
+anim
+frame = frame anim vertex
+0.500000 1.0 -1 vertex
+anim = anim = vertex
+vertex vertex 1.0 1.0 frame
+bone
+=
+0.500000 bone
+vertex vertex texture vertex
+bone texture -1 vertex
+vertex
+1.0 1.0 = =
+1.0 0.500000
+anim 0.500000 material 1.0 texture anim 0.500000 bone
+material
+texture = vertex -1 = = -1 frame
\ No newline at end of file
@@ -0,0 +1,270 @@
+bone vertex
+bone
+= frame = texture
+= texture material material 0.500000 = material 0.500000
+= -1 anim
+vertex texture = anim -1 = -1 = bone frame 1.0 -1 = frame vertex -1 0.500000
+frame -1 -1 0.500000
+bone bone bone 0.500000
+material = anim -1
+bone
+=
+bone
+anim bone material 0.500000 = anim frame material bone -1 material
+= anim vertex anim
+-1 0.500000 -1 =
+vertex anim =
+= 0.500000 0.500000 0.500000 frame 1.0 1.0
+anim 1.0
+-1 0.500000 0.500000 1.0 vertex anim
+= 0.500000 material material material
+vertex bone
+vertex 1.0
+frame material = 1.0 vertex
+bone 1.0 anim 0.500000 vertex texture 1.0 anim
+= frame frame -1
+1.0 frame frame
+bone
+1.0 texture
+1.0 -1
+0.500000 anim frame texture 0.500000 bone
+frame texture -1
+=
+anim vertex =
+bone texture texture texture -1
+material bone
+= anim bone
+frame anim frame texture anim frame
+-1
+vertex material bone
+vertex anim texture bone anim material 1.0 vertex texture
+-1
+0.500000
+-1 -1 texture = vertex material bone
+vertex = 0.500000 -1 anim 0.500000 frame
+vertex -1 -1
+-1 material frame -1 1.0 frame anim material material bone = 1.0 frame
+material = anim texture
+bone
+-1 bone -1 = -1
+bone material material vertex anim
+texture
+texture texture 0.500000
+texture 1.0
+0.500000 frame vertex
+0.500000 material bone
+material -1 texture = 0.500000
+material
+0.500000 1.0 0.500000 frame = =
+=
+= vertex
+0.500000
+frame
+vertex
+-1
+-1 material 0.500000 vertex anim 1.0 anim
+0.500000
+0.500000 anim
+1.0 = 1.0 = 1.0 -1
+= -1
+frame
+1.0 anim frame 0.500000 0.500000 vertex bone bone frame anim material
+frame 0.500000
+1.0 0.500000 0.500000 -1 1.0 frame vertex
+bone = bone vertex frame anim anim
+0.500000 =
+= 1.0
+-1 bone
+texture vertex 1.0 0.500000
+frame anim bone anim 0.500000
+anim material
+frame 0.500000
+texture
+= 0.500000
+material anim bone
+1.0 1.0 0.500000 = texture 1.0
+0.500000 anim =
+= frame
+vertex 1.0 = material material -1 vertex = vertex vertex
+material = frame = frame
+0.500000 texture 1.0
+= frame material = texture
+1.0
+material
+material material frame = material anim texture frame vertex
+vertex
+0.500000 bone
+anim anim anim
+0.500000 vertex
+-1 -1 =
+material 1.0 -1
+= 0.500000 texture texture
+frame
+texture 1.0
+vertex -1 bone texture 1.0 vertex -1 bone
+frame = bone 0.500000 anim material anim frame = texture -1 frame material =
+material = material anim frame material
+-1 vertex
+anim anim = bone texture = vertex
+material -1 texture frame anim
+frame texture anim texture bone = = vertex vertex texture -1
+material material 0.500000 vertex -1
+1.0
+-1 vertex bone texture frame vertex 0.500000 1.0 texture 0.500000 -1
+0.500000
+vertex 1.0 anim frame material -1 1.0
+bone material texture 1.0
+vertex
+= frame -1 vertex texture frame
+bone texture bone
+vertex material texture
+frame texture -1 material
+bone vertex anim 0.500000
+0.500000 1.0
+-1 1.0
+1.0 -1 anim texture
+= material = frame material
+texture texture 0.500000 bone 0.500000 bone texture bone
+0.500000 -1 -1 texture material 0.500000 bone texture 1.0
+vertex texture texture =
+texture
+0.500000
+vertex
+anim
+-1 0.500000 texture bone = 1.0 0.500000 -1
+bone
+material
+-1
+frame 0.500000 1.0
+frame 0.500000 0.500000
+0.500000 1.0 frame material
+material -1 anim -1 -1
+bone
+vertex
+=
+texture bone 1.0 anim = texture
+0.500000 material
+material 1.0 bone anim frame frame =
+frame frame texture anim = texture bone bone texture
+anim
+bone anim anim -1 texture frame -1 1.0 anim
+bone
+material texture frame = texture -1 frame
+frame vertex anim texture bone
+1.0 texture
+=
+1.0
+1.0 vertex bone bone frame -1 bone texture
+anim
+-1 material material vertex vertex bone bone frame
+vertex = 1.0 = vertex =
+vertex anim
+1.0 texture frame texture material
+texture anim =
+anim texture bone bone
+-1
+1.0
+= = -1 frame vertex bone = bone bone anim anim = texture material
+frame vertex bone
+material = -1 bone vertex
+material frame anim
+0.500000 vertex
+=
+anim
+frame 0.500000 = frame anim 1.0 1.0 material vertex frame frame bone vertex bone -1 texture frame bone = anim vertex -1 frame frame 1.0
+0.500000 texture texture 0.500000 material texture -1 -1 material anim
+material
+=
+-1 material bone = 1.0 material texture material
+anim -1 material 1.0 texture
+0.500000 anim frame vertex
+bone 0.500000 texture frame anim material
+texture -1 anim = bone
+texture
+-1 1.0 =
+1.0
+bone
+-1
+anim
+frame 0.500000 1.0 bone vertex bone 0.500000 anim 1.0
+0.500000 bone
+vertex
+0.500000 1.0 texture
+0.500000 frame -1 frame 1.0 0.500000 = material 1.0 texture anim
+vertex material
+-1 anim 0.500000 -1 bone 0.500000 bone -1
+= texture 1.0 -1
+bone
+-1
+texture
+vertex
+1.0 = -1 1.0 = 0.500000 frame 1.0 0.500000 anim =
+1.0 material = frame -1 anim
+anim material = texture vertex
+bone -1 1.0
+vertex anim
+0.500000 frame anim =
+0.500000
+vertex bone anim =
+material = 1.0 0.500000 texture 0.500000 = vertex -1 texture = anim
+vertex anim frame
+0.500000 = material anim
+bone anim -1 -1 bone =
+1.0 1.0 texture
+-1 anim texture bone
+texture = anim material material 1.0 vertex 1.0 1.0 -1
+texture = texture anim -1
+texture
+bone
+0.500000 vertex anim bone texture 0.500000
+anim
+vertex = texture material
+= bone bone
+frame = -1 anim texture = 0.500000 1.0 =
+material vertex -1 0.500000 = 0.500000 0.500000 = bone bone
+0.500000 frame anim
+frame vertex -1 material 1.0 -1 texture anim
+frame 0.500000 frame frame
+material material 0.500000
+anim vertex
+anim bone =
+frame material vertex
+texture
+= material frame frame = = 1.0
+= = frame texture bone frame
+texture 0.500000 material vertex
+= = 0.500000
+material 0.500000 material bone = texture frame vertex
+vertex -1 bone frame
+bone material material = 1.0 material vertex texture texture
+texture
+0.500000 frame vertex texture texture
+frame frame
+-1 bone -1
+=
+1.0 vertex bone =
+1.0
+-1
+bone 1.0 1.0 material frame vertex bone 1.0
+-1 -1 frame
+frame vertex
+material frame 0.500000 = texture anim material
+1.0 -1 vertex frame material 1.0 = = vertex =
+bone = vertex -1 texture vertex 1.0
+= texture 1.0
+-1 material 1.0 bone -1 anim = anim material vertex 1.0 material
+bone 1.0 1.0 texture = frame bone frame material frame
+material texture -1 frame bone -1 = frame
+vertex -1 texture 0.500000 -1 = vertex
+-1 = frame 1.0 frame texture bone
+anim = frame anim 0.500000
+1.0 =
+= vertex
+texture -1 anim
+texture bone material 0.500000
+anim texture 1.0
+1.0
+vertex anim
+= 1.0 0.500000 anim vertex bone -1 0.500000 texture -1 frame material bone
+-1 1.0 frame anim frame -1 -1 vertex -1
+vertex material vertex -1
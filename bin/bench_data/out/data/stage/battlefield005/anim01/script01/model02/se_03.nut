@@ -0,0 +1,150 @@
+texture
+bone -1 0.500000 vertex 0.500000 frame -1
+material 1.0 bone material
+vertex
+vertex
+=
+1.0 anim
+frame vertex texture
+0.500000
+1.0 -1 1.0 texture bone =
+frame
+vertex texture 1.0 bone = vertex = vertex
+1.0 material -1
+= 1.0 0.500000 vertex 1.0
+1.0 material -1
+frame
+material 0.500000 material 1.0 =
+bone
+vertex bone 0.500000
+vertex = 0.500000 1.0 = -1
+anim 1.0 material -1
+texture frame = anim -1 frame
+0.500000 anim = material frame vertex anim material
+material vertex texture texture
+0.500000 0.500000 anim 0.500000
+-1 bone anim anim frame 1.0
+=
+= material -1
+0.500000 texture -1 1.0
+frame anim
+anim =
+anim anim texture material
+= texture 0.500000 0.500000 texture frame
+material =
+bone vertex
+-1 anim 0.500000 -1 bone frame
+0.500000 frame 0.500000
+bone
+anim = -1 0.500000 1.0 =
+-1 =
+frame texture texture frame texture 0.500000 1.0 vertex 1.0 texture
+vertex -1
+-1 vertex
+0.500000
+material
+1.0 material vertex
+frame -1
+1.0 -1 -1 0.500000 0.500000 anim vertex
+0.500000
+1.0 0.500000
+0.500000 0.500000 1.0 1.0 -1 = frame -1 = 0.500000
+=
+frame 0.500000 anim bone frame 1.0 bone material material
+=
+bone frame
+0.500000 texture vertex vertex = -1 -1 -1
+anim
+texture
+1.0 texture 1.0
+anim
+vertex
+anim vertex
+-1 anim vertex 0.500000 vertex
+1.0 1.0 -1
+frame texture 1.0 texture
+texture
+-1
+0.500000 frame frame 1.0 vertex
+-1 1.0 =
+anim bone -1 material material bone texture
+1.0 -1
+bone = =
+-1 -1 anim
+1.0
+bone
+anim -1 -1 1.0
+material
+material
+bone
+bone vertex material
+anim 0.500000 1.0 vertex frame material -1 frame bone
+frame
+material texture material -1 1.0 1.0
+1.0 bone
+bone bone 1.0 frame -1
+vertex texture frame -1 material bone
+vertex frame vertex
+1.0 frame 1.0 frame 1.0 anim 1.0 vertex = 1.0 0.500000 anim
+frame 1.0 1.0 texture anim
+bone
+vertex texture = anim
+vertex 1.0 material -1 = = material bone
+frame material
+= =
+frame -1 =
+= vertex
+texture -1 anim =
+vertex -1
+-1 -1
+-1 material bone anim texture = texture vertex 0.500000 texture frame -1 material 1.0
+frame
+frame = anim anim bone
+1.0 0.500000
+vertex frame
+1.0 vertex
+texture frame 0.500000 anim 0.500000 frame bone anim material texture frame frame
+bone =
+texture bone 0.500000 = vertex 1.0 material anim -1 1.0 vertex =
+texture
+vertex texture = anim
+frame
+-1 =
+-1 texture anim texture 0.500000 anim
+material frame anim material = -1 -1
+material frame 1.0 1.0
+bone
+vertex
+= anim -1
+= 0.500000
+anim anim material vertex
+anim anim 1.0 =
+= -1 anim -1 0.500000 anim
+vertex
+vertex
+texture
+= bone texture
+bone 1.0
+material
+frame 1.0 0.500000 =
+vertex anim -1 vertex 0.500000
+-1 anim 1.0 bone bone material bone
+-1 anim
+vertex bone vertex texture 0.500000 texture vertex
+anim
+texture texture
+texture anim
+bone
+material material material 1.0 0.500000 material 0.500000
+=
+frame
+0.500000 anim material 0.500000 vertex vertex frame material
+0.500000 material vertex
+0.500000 1.0 material anim
+material -1 -1
+0.500000 texture = frame 0.500000 = bone
+material 0.500000 1.0 texture texture frame 1.0 0.500000 0.500000
+1.0 -1 anim texture material
+vertex
+vertex
+f
\ No newline at end of file
@@ -0,0 +1,169 @@
+frame
+1.0
+0.500000 texture = anim 1.0 anim 0.500000
+material 0.500000 -1 material
+= bone anim
+texture
+-1 1.0 frame = material -1 material
+frame
+0.500000 1.0 bone frame frame texture
+bone bone vertex bone frame
+= frame 1.0 1.0
+0.500000 anim 0.500000 = texture
+bone bone
+1.0 = -1 1.0 =
+0.500000 frame bone vertex 1.0 bone 1.0 frame
+-1 frame
+texture bone -1 1.0 texture frame vertex
+0.500000 = 0.500000 bone
+anim material frame texture bone vertex = frame 1.0 bone
+-1 frame anim -1 vertex frame texture -1 texture
+-1
+texture 0.500000 0.500000 0.500000 texture 0.500000 anim 0.500000 bone -1
+0.500000 material
+1.0 0.500000 frame
+= 0.500000 material -1 frame = bone vertex material frame frame 1.0
+0.500000
+= =
+texture frame
+frame
+bone texture frame frame -1 0.500000
+frame = anim frame anim vertex
+1.0 -1 texture material
+1.0 0.500000 texture frame
+bone
+vertex anim 1.0 1.0 material -1 -1 frame 0.500000 1.0
+1.0 =
+frame texture
+anim anim
+texture 1.0 frame bone
+bone anim
+anim -1 0.500000 bone -1 frame = texture frame bone
+texture -1
+-1 anim
+= 0.500000 -1 material -1 -1 bone
+anim texture vertex =
+texture texture vertex anim = vertex frame
+texture
+vertex -1 -1 0.500000 texture
+=
+texture frame texture
+-1
+= frame material
+material 1.0 anim
+texture anim
+bone
+1.0
+material = bone
+material 0.500000
+anim frame 0.500000 1.0
+bone =
+vertex = 1.0 frame bone vertex =
+vertex texture = material 1.0
+bone
+anim
+vertex anim
+frame frame material
+0.500000 material frame
+texture
+bone bone bone
+material anim
+vertex texture anim vertex texture
+anim 0.500000 -1
+-1
+= 1.0 vertex
+=
+material frame
+anim bone = 1.0 -1
+vertex material texture vertex
+anim
+bone vertex anim 1.0 anim anim texture -1 = material 1.0
+-1
+-1
+anim
+anim
+material = -1 bone texture
+texture
+1.0
+material material
+1.0 material -1
+texture material anim 0.500000 = -1 material
+0.500000 1.0 material vertex 0.500000 -1 -1
+1.0
+0.500000
+1.0 0.500000 texture
+bone texture
+texture 1.0 texture bone 0.500000
+material = anim = 0.500000
+bone texture material 0.500000 -1 anim
+= 0.500000 bone vertex bone texture anim 0.500000 1.0
+frame frame frame frame material
+texture bone anim frame texture vertex vertex material material anim
+0.500000 frame frame
+texture
+material 0.500000 bone
+vertex
+frame material texture
+anim bone anim frame texture = vertex frame
+1.0 = 0.500000
+texture -1 1.0
+bone -1 = frame
+texture vertex texture
+vertex
+anim
+material -1 0.500000 frame
+bone
+anim -1
+anim vertex bone vertex material -1 -1 1.0 vertex
+material
+-1 1.0
+-1 anim vertex
+1.0 vertex
+material
+vertex 0.500000 -1 texture
+1.0 -1 anim vertex 1.0
+0.500000 vertex -1 = texture
+anim 1.0 vertex 0.500000 frame
+vertex texture
+texture -1
+-1 material
+material bone
+frame
+-1
+0.500000 texture
+bone bone = texture = vertex
+texture -1 anim bone frame texture
+0.500000 0.500000
+vertex vertex
+frame
+texture
+1.0 material texture 1.0
+vertex
+= vertex material material vertex
+bone = texture 1.0 1.0
+vertex bone 0.500000 frame frame 0.500000 1.0 1.0 texture 1.0
+-1
+vertex 0.500000 texture
+anim
+vertex material frame texture material material
+material bone -1 anim
+0.500000 = -1 material frame 0.500000
+anim bone = anim 1.0
+=
+-1 anim anim material frame vertex
+anim
+-1
+-1 0.500000 1.0
+bone anim
+1.0 1.0 1.0 -1 bone bone
+0.500000
+material
+0.500000 bone bone
+frame texture 0.500000 anim
+vertex 0.500000 -1 = material 1.0 0.500000 anim -1
+vertex 0.500000 vertex 0.500000 texture = frame bone 1.0 anim vertex bone material
+anim = anim vertex frame
+0.500000 vertex vertex
+0.500000
+-1 0.500000 1.0
+verte
\ No newline at end of file
@@ -0,0 +1,59 @@
+1.0 1.0 frame 0.500000
+0.500000 frame
+texture
+frame -1 1.0
+vertex frame -1 = texture
+texture = vertex = material
+material vertex anim frame bone frame
+0.500000
+bone
+-1
+1.0 1.0 frame 0.500000 1.0
+anim
+0.500000
+texture 1.0
+1.0 frame frame
+texture
+texture
+= vertex
+vertex -1
+1.0 material frame -1 frame frame
+frame
+0.500000 frame frame vertex frame 0.500000
+anim = bone =
+=
+1.0 vertex frame bone 0.500000 texture 0.500000 texture bone material
+-1 vertex anim material 1.0 bone vertex texture material
+anim bone material 0.500000
+bone 1.0 0.500000 anim anim texture frame frame bone anim 1.0 -1 vertex frame
+bone bone
+anim texture 0.500000
+-1
+bone 1.0 =
+= vertex =
+texture
+texture anim 0.500000 -1 anim material -1 anim
+bone = vertex 1.0 bone material texture anim
+anim frame vertex
+1.0 = = 1.0 0.500000 0.500000
+anim anim
+1.0 -1
+= = 1.0 anim = 1.0
+0.500000 = -1 material vertex -1 0.500000 -1 bone
+bone bone anim -1
+material -1 0.500000 0.500000 0.500000 vertex
+frame -1
+=
+vertex =
+anim bone 0.500000 bone = = = bone 1.0 bone -1 texture 1.0
+texture vertex
+bone bone
+frame
+1.0 1.0 0.500000 vertex material
+frame vertex
+1.0 texture 0.500000
+0.500000 = frame frame = 0.500000 vertex texture
+vertex bone frame
+vertex = 1.0 frame frame
+material
+0.500000 ver
\ No newline at end of file
@@ -0,0 +1,170 @@
+vertex frame
+anim vertex = 1.0 texture material texture anim texture
+texture material anim
+anim 1.0
+anim
+= frame 0.500000 anim
+= 1.0 -1 material
+anim 0.500000
+anim -1 material frame = bone bone =
+-1 -1 frame material vertex frame
+texture
+anim vertex 0.500000 anim anim = anim anim
+1.0 material vertex
+-1
+0.500000 -1 = vertex bone
+vertex frame 0.500000
+bone vertex material -1 0.500000 -1 -1 -1
+vertex bone -1 anim = texture
+bone
+0.500000 bone frame bone
+texture frame anim anim
+0.500000 0.500000 = = bone material
+-1
+bone = vertex 0.500000 anim 1.0 bone vertex material
+0.500000 anim -1 texture anim -1 frame material
+anim = 0.500000 =
+-1 material 0.500000 vertex texture vertex 1.0 texture
+1.0 1.0
+bone
+= = = 1.0 material texture material -1
+anim vertex
+= -1
+material
+bone
+bone
+1.0 anim 1.0 -1
+bone 0.500000 anim
+-1 anim material bone = bone vertex -1 1.0
+vertex -1 anim
+-1 0.500000
+bone frame anim frame
+vertex frame 0.500000 -1
+anim anim 1.0 -1
+vertex material
+-1 vertex
+material vertex bone bone
+1.0 texture anim texture 1.0 vertex -1 0.500000 frame 0.500000 =
+0.500000 texture 1.0 bone bone
+-1 texture 1.0
+anim
+0.500000 texture 1.0 1.0 material
+= = -1 0.500000
+texture 1.0 anim bone vertex bone 1.0 anim frame
+anim
+frame material
+texture
+-1 bone = = -1 0.500000
+frame material material 0.500000 anim =
+bone 1.0
+bone -1
+anim material -1 frame bone
+vertex material frame 1.0
+bone material
+bone material
+1.0 anim =
+bone -1 anim -1
+0.500000 material material frame
+anim material anim material
+vertex = material 1.0 =
+bone 1.0
+bone frame
+=
+anim
+frame 1.0
+texture -1 material 0.500000 material material bone material
+=
+1.0 frame frame material 1.0 vertex
+1.0 material 1.0 0.500000 0.500000 = bone vertex
+frame -1 1.0 1.0 vertex
+1.0 vertex
+vertex 0.500000
+=
+texture frame = texture 1.0 bone
+anim
+-1 vertex
+material -1
+texture 1.0 texture bone material material
+vertex bone texture =
+bone bone material texture material vertex 0.500000
+anim
+material 0.500000 1.0 vertex frame
+=
+0.500000 material 1.0
+bone
+material
+frame vertex
+texture texture frame
+-1 = anim bone vertex texture frame texture 0.500000 texture
+0.500000 vertex
+material
+material 1.0 -1 -1 vertex bone
+bone -1 anim
+texture
+anim anim
+vertex texture = 1.0 material
+-1 vertex vertex texture material anim
+1.0
+vertex material frame = -1 -1 1.0 anim 1.0 anim
+1.0 anim = texture
+0.500000 frame texture 1.0
+bone texture
+bone -1 1.0 material frame
+anim
+anim 1.0 frame
+anim bone
+0.500000
+texture 0.500000 frame 1.0 texture anim bone
+-1 anim 1.0 vertex 1.0
+material material -1 vertex =
+1.0 1.0 1.0 texture = vertex material
+1.0 = anim
+frame frame material
+-1 anim
+vertex
+bone 0.500000 material = = = frame -1 material
+1.0 vertex anim 1.0
+vertex material
+-1 1.0
+vertex vertex texture 1.0 -1 vertex 1.0 texture 0.500000
+material =
+material vertex anim
+frame anim 0.500000 texture frame frame
+-1 anim anim 0.500000 = -1 anim 0.500000 0.500000
+= frame anim material
+anim frame 0.500000
+bone
+material -1 -1 vertex = anim vertex frame frame 1.0 vertex vertex texture
+vertex 0.500000 bone
+texture texture
+= vertex texture texture material material 1.0 frame
+material
+material 1.0 1.0 -1 texture vertex
+frame
+0.500000 1.0 -1 texture
+=
+-1 anim texture -1
+1.0 bone bone
+material
+-1 material texture anim anim bone = anim 0.500000
+-1 anim -1 anim frame material
+frame
+bone material frame
+bone
+bone texture
+frame -1 material texture -1 vertex anim 0.500000 material 1.0 vertex -1
+frame
+= anim bone material = frame material 0.500000 -1 0.500000 -1 texture 1.0
+1.0 texture
+frame material anim = material frame
+texture 0.500000 anim
+-1 -1
+vertex -1 0.500000 bone = material vertex = texture
+1.0 vertex =
+anim frame anim -1 frame
+0.500000
+frame 1.0 0.500000
+1.0 0.500000 -1 anim frame
+0.500000 1.0 = anim 0.500000 vertex material
+1.0 material material material material =
+bone 0.500000 anim texture vertex
\ No newline at end of file
@@ -0,0 +1,37 @@
+-1 = 1.0
+anim anim 1.0 texture
+-1 1.0 frame 1.0 material frame anim =
+bone frame 0.500000 material -1 texture = anim -1
+vertex -1
+anim -1 anim vertex frame material 1.0
+0.500000 = 1.0 frame =
+-1 material
+1.0 -1
+1.0 1.0 frame -1 0.500000
+1.0
+texture vertex frame bone
+vertex anim 0.500000 -1
+texture material texture anim bone 0.500000 bone bone texture material material 1.0 0.500000
+vertex texture
+frame 0.500000 texture frame anim texture -1 anim texture
+vertex texture
+0.500000 anim frame
+= vertex anim = = frame
+texture
+frame
+1.0 bone 1.0 1.0 frame
+1.0
+-1 vertex 0.500000
+1.0 vertex anim 1.0 frame = -1 anim
+texture material -1 = -1 material frame
+-1 anim =
+0.500000 0.500000
+vertex 0.500000
+frame material
+-1 frame 1.0 0.500000 -1
+material anim = vertex vertex frame 1.0
+-1 -1 0.500000
+bone frame = material anim 1.0 vertex frame = material
+= -1 1.0 material anim anim
+0.500000 material bone 0.500000 anim 1.0
+1.0 material bone vertex bone frame =
\ No newline at end of file
@@ -0,0 +1,3 @@
+texture frame material -1
+frame
+1.0 vertex ve
\ No newline at end of file
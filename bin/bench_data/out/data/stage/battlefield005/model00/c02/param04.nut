@@ -0,0 +1,2 @@
+-1 frame texture -1 texture frame 0.500000
+text
\ No newline at end of file
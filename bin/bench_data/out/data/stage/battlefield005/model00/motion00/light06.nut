@@ -0,0 +1,6 @@
+vertex vertex
+frame -1 1.0 1.0 vertex bone
+bone
+bone 0.500000 =
+= =
+bone -1 material material vertex -1 bone anim
\ No newline at end of file
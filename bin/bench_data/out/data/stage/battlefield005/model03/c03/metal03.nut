@@ -0,0 +1,2 @@
+0.500000
+-1 bone 1.0 texture -1 1.0 bone 
\ No newline at end of file
@@ -0,0 +1,15 @@
+bone -1 0.500000 frame material = material texture 1.0
+-1 bone texture
+anim 1.0 = vertex = material -1 -1 -1 material = 0.500000 bone texture 1.0 -1 vertex 1.0 bone
+material
+material material material
+0.500000 1.0
+frame material 1.0 anim -1
+material 0.500000 0.500000
+1.0 =
+1.0 = vertex 0.500000
+texture vertex frame
+vertex -1
+0.500000 vertex
+-1 0.500000
+material a
\ No newline at end of file
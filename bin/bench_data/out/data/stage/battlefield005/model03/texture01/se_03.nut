@@ -0,0 +1,120 @@
+= bone = 1.0 -1 bone bone material vertex 1.0 material
+bone bone 0.500000 bone
+=
+0.500000
+frame
+= =
+1.0 anim -1
+bone -1 = material anim
+texture 1.0 1.0 bone -1 vertex =
+frame
+=
+bone -1
+texture 0.500000 bone
+-1 = bone
+frame texture -1
+bone
+1.0 0.500000 1.0
+texture 0.500000 =
+material -1
+0.500000 vertex bone = material 0.500000 texture
+= material
+0.500000
+=
+material material texture bone bone
+texture vertex -1 1.0 bone
+bone anim
+0.500000 texture anim
+anim 1.0 material bone anim vertex =
+bone vertex -1 anim frame =
+material -1 frame 1.0 -1 = frame material frame texture = 0.500000 1.0 = vertex bone texture vertex =
+= vertex 1.0 vertex
+bone anim vertex vertex
+material -1 bone
+bone frame
+texture
+texture = = = 1.0 frame
+frame = = =
+bone -1 bone 0.500000
+frame vertex
+= -1
+1.0 frame frame
+-1 material material
+anim =
+frame 1.0 0.500000 frame frame material -1 0.500000 0.500000 1.0
+texture material =
+= bone
+anim =
+vertex vertex = texture
+frame
+-1 0.500000
+= anim -1 0.500000 0.500000 texture texture frame frame anim material bone anim material
+frame anim
+material 1.0 vertex material 0.500000
+= vertex bone = -1
+frame texture
+frame 0.500000 texture material
+anim material vertex 1.0 -1 texture 1.0 0.500000 frame
+1.0
+bone
+texture =
+= -1 = anim anim 1.0 texture anim = 1.0
+bone frame 1.0
+vertex
+bone anim = texture
+= texture anim = vertex 1.0
+material 0.500000 = = bone material
+0.500000 -1 0.500000 frame
+frame
+= texture
+bone anim bone -1 -1 anim 1.0 material -1 vertex bone 1.0
+1.0 = material vertex material material vertex
+texture
+bone
+1.0
+texture
+frame 0.500000 bone 1.0 texture frame bone material
+-1
+frame
+vertex 0.500000 material bone 1.0 anim vertex vertex 0.500000
+-1 1.0 anim -1
+frame material frame 0.500000 vertex
+0.500000 1.0 anim texture 1.0 texture 1.0 material = 1.0 vertex
+bone bone 1.0 bone bone
+= = texture
+frame
+bone -1 texture
+vertex anim -1
+-1
+frame frame anim vertex
+-1 0.500000 anim -1 -1 frame =
+bone
+bone
+texture material texture = vertex 0.500000 texture texture frame
+1.0
+-1 texture
+material vertex anim
+1.0
+anim material anim 0.500000
+material
+anim
+vertex bone texture bone -1 texture 1.0 -1 -1 vertex anim
+= -1 1.0 = frame
+anim frame -1 texture 0.500000
+1.0 anim
+material anim anim frame 1.0
+= = =
+anim anim -1 vertex
+texture
+anim 1.0
+vertex
+frame texture -1 bone vertex
+vertex frame anim
+vertex frame vertex
+frame texture vertex = 1.0
+texture 0.500000 -1 0.500000 =
+-1 0.500000 frame anim bone
+material bone anim frame material anim = 0.500000 = texture = 0.500000 1.0
+-1 0.500000 bone
+-1 -1 bone 0.500000 frame texture
+material 
\ No newline at end of file
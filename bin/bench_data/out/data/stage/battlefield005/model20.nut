@@ -0,0 +1,158 @@
+anim bone material anim
+frame anim -1 texture texture = = 1.0 vertex material vertex
+anim material
+material 1.0 0.500000 anim vertex 0.500000 anim material 1.0 bone material material texture
+anim = frame bone material 0.500000 frame =
+1.0 1.0 -1
+frame material 0.500000 anim
+material -1 vertex 0.500000 texture -1
+= -1 material 1.0
+material vertex = -1 frame
+texture
+material texture bone
+= -1 0.500000
+1.0 vertex 1.0
+1.0
+frame = vertex =
+-1 texture frame 0.500000
+bone bone
+0.500000 vertex frame
+texture frame -1 anim anim material vertex texture -1
+bone bone 0.500000 0.500000 1.0 -1 -1
+vertex = -1
+1.0 vertex 0.500000 bone = 0.500000 -1
+frame
+material texture frame 1.0 anim -1 -1 texture
+anim = material frame texture = anim = bone frame = -1 0.500000 frame 0.500000 texture texture 1.0 1.0
+1.0 0.500000 -1
+vertex vertex texture 0.500000
+frame texture
+anim -1 vertex
+frame 1.0 anim texture bone frame
+= anim 1.0 anim bone vertex anim -1 bone bone
+vertex texture 1.0 =
+-1
+= material 1.0 texture 0.500000 bone bone -1
+0.500000 0.500000 bone -1 frame 0.500000
+frame texture
+-1
+bone 0.500000 texture frame frame material anim 1.0 = anim anim
+-1 anim
+-1 0.500000 -1 vertex -1 anim
+anim
+material bone 1.0 material
+bone vertex anim
+material
+1.0 -1 = bone 1.0 = material =
+vertex anim = 1.0 vertex 0.500000
+bone
+=
+texture
+bone frame
+-1
+1.0 bone vertex 0.500000
+material
+anim vertex bone = texture bone -1 1.0 material
+bone material bone
+vertex 1.0
+1.0 anim -1 frame anim
+material frame = vertex -1 vertex 1.0
+material frame texture 0.500000
+frame texture = material -1
+texture -1 bone texture bone
+material texture 0.500000
+material anim frame material
+texture 0.500000 frame vertex
+frame
+= material frame =
+= bone =
+0.500000 0.500000 material bone frame
+0.500000 -1 bone bone anim
+material
+bone
+frame anim material material 0.500000
+-1
+vertex
+bone
+-1 texture
+= -1 = 0.500000 -1 frame 0.500000 anim -1 material -1
+0.500000 texture anim -1 = material = 1.0 0.500000 material frame anim vertex anim
+material frame 0.500000
+anim
+0.500000 anim frame 0.500000 1.0
+0.500000 bone vertex =
+1.0
+bone anim
+vertex vertex vertex
+-1
+= -1
+frame frame anim vertex texture = 1.0 1.0
+anim
+0.500000 frame vertex texture 1.0
+anim bone 1.0 material
+0.500000 vertex =
+anim frame 0.500000 material
+anim 0.500000 1.0 1.0 -1 vertex texture texture material 0.500000 = -1
+frame
+1.0 texture
+bone frame -1 material = vertex = anim =
+1.0
+material
+0.500000 material bone = vertex frame
+vertex
+vertex texture bone
+vertex frame 0.500000 vertex
+1.0 -1 bone anim material texture
+material material =
+bone 1.0 0.500000
+-1 texture
+anim vertex anim anim texture
+bone anim
+bone anim
+anim vertex anim 1.0
+vertex
+bone texture
+texture
+0.500000 0.500000 -1 0.500000 0.500000 vertex
+=
+bone bone anim
+0.500000 bone frame anim 1.0 = bone 1.0 anim = vertex texture -1 1.0 anim 0.500000 texture frame 0.500000 vertex -1 bone = frame
+anim bone material vertex -1 0.500000
+bone
+0.500000 anim frame 1.0
+0.500000 0.500000 -1
+material frame
+frame 1.0 anim
+anim 1.0 texture texture -1 vertex anim anim
+frame vertex anim texture
+texture vertex anim
+bone = frame anim frame -1 anim anim 0.500000 -1 bone 0.500000 texture = anim material bone material
+material 0.500000 material anim texture 0.500000 vertex -1 0.500000 material
+bone frame
+0.500000 bone
+0.500000 -1 bone frame vertex 1.0 bone frame -1 texture vertex -1 0.500000 -1 -1
+texture
+bone
+material bone material bone vertex bone vertex texture
+=
+-1 bone
+bone
+anim -1
+vertex
+vertex
+texture bone -1 material bone anim frame material vertex bone material frame
+0.500000 1.0 -1 frame 1.0 material =
+bone 1.0 -1 anim
+vertex = 0.500000 = material anim 1.0 frame 1.0
+frame 0.500000
+vertex 0.500000 frame frame -1
+frame frame
+0.500000 frame
+frame 0.500000 material vertex
+vertex 0.500000 bone texture
+vertex 0.500000 0.500000 = texture =
+frame
+0.500000
+= vertex = anim texture bone bone frame
+frame
+=
\ No newline at end of file
@@ -0,0 +1,73 @@
+vertex
+-1
+anim vertex -1
+anim 0.500000
+= = vertex
+material 1.0 = frame 0.500000 -1 -1 1.0 vertex texture =
+texture
+texture
+bone -1 bone
+bone vertex
+vertex 0.500000 vertex 1.0 texture vertex 0.500000 0.500000 =
+= bone 1.0
+1.0 0.500000 =
+1.0
+-1 material 0.500000 0.500000 0.500000 anim vertex
+0.500000 -1 0.500000 texture bone texture material bone texture
+bone 0.500000 bone frame material = vertex
+texture 1.0 = -1 frame =
+-1 frame bone
+vertex
+=
+= 0.500000 -1 0.500000 bone
+0.500000
+bone
+bone 0.500000 material texture vertex = anim frame
+-1 vertex 1.0
+vertex
+0.500000 1.0 frame frame vertex = frame frame
+bone texture texture bone =
+texture material
+bone bone
+0.500000 = 0.500000 frame 0.500000 vertex 1.0 = 1.0
+-1 -1
+= material anim frame
+bone
+texture material anim frame -1 texture
+=
+0.500000 material = bone frame
+material material texture frame vertex frame 1.0
+anim
+bone anim anim
+0.500000 texture texture frame 1.0 material 1.0 material anim anim 0.500000 bone
+= 0.500000 anim -1
+= 0.500000 0.500000 texture -1 material bone anim texture
+vertex
+-1 = = bone
+vertex texture frame 1.0
+1.0 -1
+frame bone bone
+-1 frame -1 bone 1.0 material
+frame
+frame
+frame
+-1 anim
+anim
+0.500000 1.0
+0.500000 = = anim bone bone frame texture frame texture
+bone
+bone texture material
+frame
+= anim vertex 1.0
+frame material = anim frame frame bone vertex vertex
+bone 1.0 anim material =
+1.0
+bone
+-1 = -1 0.500000 anim 1.0 material bone
+=
+material frame anim
+0.500000 1.0 = vertex
+material 0.500000 bone -1
+vertex
+-1
+anim = mat
\ No newline at end of file
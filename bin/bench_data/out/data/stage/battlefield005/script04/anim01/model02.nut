@@ -0,0 +1,16 @@
+-1 vertex 0.500000 = = vertex 1.0
+material
+vertex 1.0 bone 1.0 1.0 anim 1.0
+material bone anim material
+1.0
+-1
+0.500000
+0.500000 texture vertex -1 0.500000 1.0 -1 = frame vertex
+0.500000
+texture 1.0
+-1 = vertex texture
+vertex frame frame 1.0 anim =
+texture -1 bone bone
+frame
+0.500000 anim = anim material material 1.0 material 1.0 0.500000 anim frame material material =
+anim material frame -1 
\ No newline at end of file
@@ -0,0 +1,3 @@
+0.500000 bone 1.0
+anim material texture
+anim vertex = anim anim -1 vertex material fram
\ No newline at end of file
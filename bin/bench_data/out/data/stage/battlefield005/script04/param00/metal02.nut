@@ -0,0 +1,10 @@
+anim material vertex frame material bone 0.500000
+material =
+anim material
+1.0 = texture vertex bone
+vertex 0.500000 =
+anim = material -1 vertex
+frame 0.500000
+vertex =
+vertex -1
+texture frame material -1 bone =
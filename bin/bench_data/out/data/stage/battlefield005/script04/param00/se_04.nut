@@ -0,0 +1 @@
+pNh0sFȝM/̣rl+D
\ No newline at end of file
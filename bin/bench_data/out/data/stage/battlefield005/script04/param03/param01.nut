@@ -0,0 +1,2 @@
+p	S,Mv7DSx|h3Q&&eG2[# ^4Hx~ɫC.x }OY\oy+ǉ$kL
+K3|!6ջQd"Y8|Td(dYF[nMKmbUC?SҿG-wЖNEw
\ No newline at end of file
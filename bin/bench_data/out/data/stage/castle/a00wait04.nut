@@ -0,0 +1,206 @@
+0.500000
+0.500000 = bone vertex vertex 0.500000 vertex
+-1 frame 0.500000 texture 1.0 vertex 0.500000 texture =
+0.500000
+material anim
+bone vertex material
+-1 vertex 1.0
+1.0 bone bone
+= texture texture
+= 1.0 anim anim bone material -1
+vertex material = vertex anim vertex frame 1.0 1.0
+1.0 0.500000 = texture 0.500000
+frame frame
+anim
+material frame bone 1.0
+= 0.500000
+bone
+1.0 vertex bone = 0.500000 = material material bone = 1.0 anim material = texture
+1.0 bone
+bone
+1.0 texture material
+material frame vertex texture bone 0.500000 vertex frame
+=
+vertex
+texture vertex vertex anim = vertex material
+-1 frame
+-1 -1 texture bone frame = material -1 anim
+vertex anim
+frame
+1.0 anim -1 -1 0.500000 texture
+material frame
+-1 anim 0.500000 anim 1.0
+bone
+= 1.0 anim
+= -1 bone 0.500000 0.500000 vertex texture frame 1.0 -1
+-1 vertex
+1.0 vertex 1.0 -1 frame texture 0.500000 -1 0.500000 texture vertex anim
+anim
+= = 1.0
+vertex texture
+vertex material =
+bone
+0.500000
+-1
+1.0
+0.500000 bone 0.500000
+1.0
+texture bone bone 1.0
+anim
+frame =
+material frame
+-1 bone 0.500000 frame
+= anim
+frame
+0.500000
+material material material
+0.500000 -1 bone
+anim vertex
+=
+vertex
+vertex = material anim anim vertex texture -1
+1.0 = -1
+material vertex
+vertex -1 =
+material frame
+frame
+= = -1 = 0.500000 frame material anim vertex
+texture -1 material 0.500000 texture 1.0 frame material material
+frame vertex
+bone texture 0.500000 texture material texture
+bone 0.500000
+texture
+0.500000 texture texture
+vertex frame 0.500000 0.500000 material -1 bone bone
+0.500000 texture
+-1
+material = 1.0 vertex = bone 0.500000 = 1.0 0.500000
+0.500000 =
+0.500000 texture = 1.0 texture vertex bone frame
+material vertex
+bone anim vertex bone vertex frame
+-1 texture bone 0.500000 =
+= vertex texture
+frame -1 0.500000 material anim material bone bone bone bone
+vertex
+= 1.0 texture
+0.500000
+vertex material
+= anim = bone
+material
+vertex -1 anim
+material texture bone material -1 vertex -1 frame anim anim frame frame 1.0 anim
+-1 = frame 0.500000
+material -1 -1 -1 material
+texture
+bone vertex 1.0 vertex texture 0.500000 vertex -1 -1
+texture anim frame -1 material texture material
+0.500000
+-1 =
+0.500000 bone = texture 0.500000 1.0
+= -1 0.500000
+bone texture 1.0 frame
+texture 1.0
+anim vertex anim vertex
+anim 0.500000 -1
+vertex
+=
+material bone frame 0.500000 texture 1.0 frame = vertex texture bone texture frame
+texture texture bone 0.500000
+texture 1.0 bone texture
+1.0 vertex -1
+= frame 0.500000 -1 1.0 bone vertex
+vertex texture 1.0 material anim material frame
+anim anim = texture material anim texture
+-1 bone
+material = anim -1 -1
+0.500000 0.500000
+frame
+bone = frame 1.0 0.500000
+0.500000 frame material texture bone frame
+= bone = =
+=
+vertex anim 0.500000 frame -1
+texture frame
+1.0 frame
+material frame material
+anim 0.500000
+1.0 anim frame material
+0.500000
+-1 1.0 material vertex bone
+texture frame -1
+texture = 1.0 0.500000 bone 0.500000 material = vertex vertex
+1.0 vertex = frame 0.500000 texture
+-1 =
+material bone frame 1.0
+frame bone texture texture = bone
+=
+frame texture anim texture vertex -1 0.500000 vertex material material anim
+1.0 -1 anim texture
+vertex material
+vertex
+0.500000
+vertex
+= frame texture
+anim material 1.0 1.0
+1.0 = vertex material
+material =
+1.0 0.500000 bone
+bone anim
+bone material
+= frame 0.500000 =
+material
+bone -1 material frame
+anim anim 0.500000
+bone frame material texture 1.0
+1.0 bone anim
+texture
+0.500000
+bone
+-1 texture
+bone 0.500000 0.500000 0.500000 material =
+= -1 bone anim
+=
+frame 0.500000 bone
+-1 anim -1 material
+-1 -1 0.500000 anim vertex material = material vertex texture 0.500000 0.500000 frame texture material vertex 1.0 frame
+material anim -1 = 1.0 frame
+texture 1.0 1.0 material 0.500000 vertex frame
+anim = anim 1.0 -1
+frame
+anim bone
+1.0 vertex 0.500000
+anim 1.0
+1.0 1.0 =
+texture texture
+texture vertex texture material material frame = frame
+anim -1 0.500000
+1.0
+frame vertex anim 0.500000 material material vertex
+0.500000 0.500000
+1.0 0.500000 = frame
+material 0.500000 bone texture = anim
+-1
+-1
+anim bone texture bone bone bone = 0.500000 = 0.500000 texture =
+anim material -1 frame vertex frame -1 frame
+bone 1.0 0.500000 material vertex 0.500000 -1 texture
+=
+material 1.0 frame
+-1 anim
+-1 vertex
+material vertex
+frame bone 0.500000 bone vertex
+vertex
+texture 1.0 texture -1
+= material bone
+=
+-1
+texture -1 = vertex
+=
+material anim -1 vertex 0.500000
+-1 0.500000 texture frame
+-1
+0.500000 bone = -1 vertex 1.0 -1 material vertex texture -1 anim 1.0 vertex 1.0
+vertex
+0.500000 -1 vertex
\ No newline at end of file
@@ -0,0 +1,78 @@
+1.0
+anim = bone 1.0 vertex 0.500000 -1 frame
+=
+material -1 -1 anim material = vertex 1.0 -1 1.0 material frame vertex texture = -1 1.0 anim
+= 0.500000 -1 bone -1
+= frame material bone frame
+vertex material
+0.500000 1.0 frame 1.0
+bone texture anim bone material
+texture 1.0
+texture anim -1 texture vertex bone texture
+texture bone
+frame texture texture frame texture
+-1 0.500000 material
+0.500000
+1.0 -1
+1.0 = = texture
+texture 0.500000 = 0.500000
+frame
+bone frame 0.500000 bone texture frame vertex = frame bone material frame texture 1.0 1.0 material
+0.500000 bone frame bone 0.500000 texture frame -1 0.500000 -1
+= 0.500000 frame
+material texture
+frame bone texture texture anim
+vertex bone -1 -1 bone frame material 1.0 material
+vertex 0.500000 =
+texture texture
+texture
+frame = 1.0 bone bone = 0.500000 anim
+vertex -1 anim material 1.0 material
+anim = frame = 1.0 =
+vertex 1.0 anim material
+1.0 0.500000 bone texture vertex
+frame texture frame texture = 0.500000
+texture
+= = frame anim
+= bone -1 bone 0.500000 0.500000 material -1 1.0 bone anim material texture vertex = bone
+bone bone
+vertex anim anim
+= texture = anim -1 anim -1 =
+texture
+= bone texture material
+1.0 bone material vertex
+= = material
+bone vertex frame 1.0 bone 0.500000 1.0 -1 0.500000 -1 1.0 material 1.0 frame 0.500000 anim frame texture -1 frame = bone vertex frame anim vertex
+vertex 0.500000 0.500000 frame
+0.500000 0.500000
+texture -1 0.500000
+material
+vertex vertex texture frame 0.500000
+0.500000
+0.500000 material 0.500000
+= material texture
+frame vertex anim anim bone
+0.500000 0.500000 -1 vertex -1 texture
+frame
+anim frame
+0.500000 1.0 material anim = =
+-1 0.500000 0.500000 0.500000 material -1 bone 0.500000 frame
+texture -1 texture anim anim bone
+anim 0.500000 anim = =
+-1
+1.0 material -1 texture
+bone bone
+-1
+vertex
+0.500000 0.500000 bone = anim bone vertex anim anim material
+frame material vertex
+frame = bone bone 1.0 vertex vertex
+0.500000 = texture 0.500000 1.0 0.500000
+material
+= 0.500000 material
+vertex texture
+frame bone frame material frame texture 0.500000
+material =
+material 1.0 0.500000 material
+texture
+0.500000 
\ No newline at end of file
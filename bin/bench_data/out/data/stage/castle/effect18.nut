@@ -0,0 +1 @@
+bone material frame 1.0 bone texture material -1 bone
\ No newline at end of file
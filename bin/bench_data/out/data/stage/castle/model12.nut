@@ -0,0 +1,13 @@
+frame frame texture
+= 0.500000 texture
+material frame
+-1
+material
+0.500000 1.0 0.500000 bone frame -1 material
+0.500000 1.0
+-1
+1.0 -1 frame
+vertex texture frame 1.0 1.0 material
+texture
+-1 vertex material frame
+material frame 0.50
\ No newline at end of file
@@ -0,0 +1,187 @@
+anim -1 1.0 =
+anim vertex frame anim
+vertex =
+texture
+texture
+-1
+=
+1.0
+bone anim material = bone
+vertex vertex frame -1
+vertex =
+texture
+vertex frame frame vertex
+material frame
+texture 1.0
+frame -1
+= texture
+0.500000 anim
+0.500000 =
+material texture 0.500000 material texture 1.0
+texture -1 -1
+texture vertex 0.500000
+bone texture 1.0 1.0
+material material material frame bone vertex vertex = 1.0
+material bone 0.500000 0.500000 frame material texture 0.500000
+vertex -1 frame texture
+vertex -1 = bone
+1.0
+0.500000 anim bone 1.0 texture 0.500000 vertex bone
+1.0 frame -1 material vertex texture anim =
+1.0 1.0 bone -1 material material
+0.500000 =
+bone frame frame -1 1.0
+texture
+0.500000 0.500000 -1 vertex
+-1 bone 0.500000
+0.500000 anim
+vertex material bone texture material texture
+0.500000
+texture frame = vertex material texture = = anim texture
+= 1.0 bone material -1
+anim 0.500000
+1.0 frame bone
+= frame 1.0 0.500000 -1
+texture 1.0
+vertex =
+1.0 -1 0.500000 anim
+-1
+= -1
+anim anim material vertex = = 1.0 -1 anim
+anim 1.0 1.0
+=
+1.0 vertex
+1.0 bone
+anim anim frame vertex -1
+texture
+frame -1 texture
+=
+-1 1.0
+bone
+texture
+material
+0.500000 1.0
+0.500000 frame = texture anim anim = texture
+frame
+-1 vertex frame texture texture frame 1.0 0.500000 bone vertex
+frame = -1
+0.500000 1.0
+frame vertex -1
+0.500000
+0.500000
+=
+texture material material bone
+0.500000 bone
+anim
+material texture anim
+= = 0.500000
+0.500000 1.0
+texture texture
+frame 0.500000 material vertex texture
+=
+texture material 0.500000 0.500000
+vertex
+1.0 anim -1 = = anim -1 -1 frame anim bone vertex
+bone -1 0.500000 = texture anim vertex bone 0.500000 anim vertex vertex frame material anim -1 0.500000
+0.500000
+frame 1.0 0.500000
+material
+texture -1
+= 0.500000
+vertex = texture bone -1 0.500000 0.500000 1.0 bone 1.0 frame material 1.0
+1.0 frame vertex bone
+1.0 anim 0.500000 1.0
+=
+vertex vertex 0.500000
+texture vertex anim anim bone
+anim
+bone
+texture
+-1 texture frame bone
+frame frame frame 1.0 texture = -1 bone 0.500000 bone material 0.500000 =
+= anim 0.500000
+vertex 1.0
+= =
+1.0 0.500000 anim material bone
+0.500000 = vertex frame frame frame
+1.0 frame 0.500000 0.500000 bone bone =
+texture = bone anim bone 1.0
+-1 frame material material texture 1.0 bone
+bone vertex = texture vertex = bone anim vertex texture material 1.0 1.0
+1.0 -1 vertex vertex
+anim material material vertex
+0.500000 =
+-1 frame
+texture
+texture =
+material vertex 0.500000 -1 texture frame 0.500000
+material frame = bone bone 0.500000 = 0.500000
+material 0.500000 1.0
+-1 bone bone 1.0
+-1 =
+bone
+texture texture 1.0 frame
+texture
+texture anim
+= vertex 0.500000 anim
+0.500000
+vertex
+-1 frame frame material
+anim frame bone
+=
+1.0 frame texture bone = -1 frame
+texture 0.500000 = texture 0.500000
+1.0 bone 0.500000
+material texture bone vertex 0.500000 =
+1.0 material
+frame anim 0.500000 -1 material
+material frame
+frame bone
+1.0 bone = = material
+texture
+1.0 = anim = material -1 -1 vertex -1
+vertex vertex material material
+bone 1.0
+-1 material material anim 1.0 anim
+0.500000
+material -1
+material -1
+0.500000 anim -1 frame texture frame texture 0.500000 texture material vertex material
+= = anim
+1.0 0.500000
+material anim
+1.0
+1.0 material
+texture = = bone = texture frame anim
+bone -1
+0.500000 0.500000 material -1 material texture = texture
+1.0 anim
+vertex
+1.0
+vertex 0.500000 texture bone -1
+-1 vertex vertex 1.0 vertex frame
+1.0 0.500000 vertex -1 -1
+anim 0.500000 0.500000 material bone -1
+0.500000 vertex
+anim frame vertex material 0.500000 = bone frame anim
+material = bone 0.500000 1.0 =
+anim -1 1.0 frame
+1.0
+1.0 texture 1.0 -1
+texture
+frame = vertex 0.500000 0.500000 anim material
+vertex
+texture bone frame frame -1 -1 1.0 frame = -1
+1.0 texture -1 1.0 0.500000 1.0 vertex
+anim
+bone =
+anim = material
+1.0 frame
+= texture
+frame
+-1 material
+bone -1 1.0 anim texture 0.500000
+0.500000 0.500000
+-1 vertex vertex anim bone bone =
+bone = frame =
+bone 1
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000 1.0 =
+bone frame
+0.500000
+0
\ No newline at end of file
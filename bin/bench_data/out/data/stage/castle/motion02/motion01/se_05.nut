@@ -0,0 +1,92 @@
+material = 0.500000 1.0 -1 material vertex 1.0 bone material texture anim 1.0 0.500000 -1 anim frame 1.0 1.0 -1 = =
+-1
+material 1.0 material texture 1.0 material -1 vertex bone = material
+material anim 0.500000 0.500000 material bone frame material
+bone texture texture frame =
+bone bone
+1.0 =
+=
+frame
+material anim =
+bone texture
+-1 material =
+anim
+vertex -1 texture vertex 1.0 anim bone
+-1 frame material anim anim = material vertex bone material vertex
+0.500000
+anim
+-1 = material 0.500000
+1.0 texture = 1.0 0.500000 frame material frame
+vertex
+vertex
+anim frame 1.0
+texture = material
+anim
+1.0
+-1 = bone bone frame
+anim frame bone texture anim vertex anim
+texture
+-1
+=
+= 1.0 frame
+0.500000 frame material bone 0.500000 -1 = frame anim frame
+0.500000 = 1.0 1.0
+-1 0.500000
+bone frame 1.0 material -1 anim vertex
+-1 =
+-1 material anim vertex frame frame anim =
+vertex anim
+vertex material anim vertex texture frame 0.500000 1.0 bone
+bone material vertex 0.500000
+1.0 vertex
+-1 =
+-1 vertex vertex anim -1 bone vertex frame frame 1.0 anim -1 texture frame 1.0
+0.500000 0.500000 material
+texture material vertex bone
+-1 vertex frame
+bone frame material -1 frame texture frame -1
+frame anim
+-1 anim anim frame material
+anim 1.0 frame texture
+texture frame vertex vertex
+anim
+vertex
+-1
+bone 0.500000 anim -1 bone
+0.500000 1.0 =
+vertex -1 0.500000 bone texture 0.500000 frame
+0.500000 -1 =
+bone vertex = frame
+1.0 vertex 1.0
+=
+= 1.0 anim material frame 1.0 = frame
+bone texture bone 1.0 texture anim
+vertex
+material
+0.500000 bone material
+0.500000 material bone bone
+material
+bone vertex -1
+1.0 bone bone anim frame texture vertex 0.500000
+material = frame
+anim anim vertex
+-1 frame -1 1.0 = bone texture
+vertex 0.500000
+1.0 =
+0.500000 vertex 1.0 anim frame = bone
+1.0 material bone material = vertex texture material 0.500000 0.500000 frame = bone texture
+texture
+0.500000 material texture = = frame
+anim frame frame bone
+texture 0.500000 = 0.500000 anim material bone
+0.500000 material material material anim anim -1 frame texture bone bone 1.0 vertex
+frame 1.0
+vertex texture vertex
+1.0 =
+material -1 vertex vertex
+anim vertex texture
+bone 1.0
+0.500000 1.0 1.0 = 0.500000
+material bone anim
+material anim vertex bone texture
+material a
\ No newline at end of file
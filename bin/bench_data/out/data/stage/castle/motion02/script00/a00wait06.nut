@@ -0,0 +1,8 @@
+=
+frame 1.0 vertex
+= frame
+1.0
+-1
+1.0
+vertex anim
+= f
\ No newline at end of file
@@ -0,0 +1,22 @@
+frame bone
+= vertex
+texture = material bone frame 0.500000 anim material
+anim anim texture
+material bone bone 1.0 -1
+frame
+= bone vertex = material = texture vertex material = texture -1
+-1
+anim vertex 1.0 anim = texture bone material
+texture 0.500000
+0.500000 1.0 frame = texture = material texture vertex frame -1
+-1 -1
+texture texture frame material =
+material texture = = 1.0
+= frame
+material frame anim anim
+= bone 1.0 vertex
+bone
+0.500000 texture anim frame
+0.500000 frame 0.500000 material material 0.500000 0.500000
+1.0
+frame 1.
\ No newline at end of file
@@ -0,0 +1,43 @@
+-1
+-1
+texture
+bone frame
+bone
+= 1.0
+vertex anim
+frame
+=
+0.500000 1.0 frame frame anim
+anim frame frame bone anim
+1.0 frame 1.0
+1.0
+= bone
+=
+frame
+texture frame frame 1.0 = anim = anim material anim -1 material -1
+anim vertex = frame 0.500000
+texture vertex material frame bone bone frame frame frame 1.0 frame -1 =
+1.0 anim
+anim = material
+= =
+vertex material texture
+frame
+-1 anim bone -1 vertex
+= texture anim bone -1
+bone -1 vertex
+texture
+material
+0.500000 anim -1 = = material material = = vertex frame material vertex material 1.0 texture frame 0.500000 0.500000 -1
+material -1 -1 0.500000 anim material = texture anim bone frame
+1.0
+frame = anim texture frame -1 1.0 1.0
+material material texture
+vertex
+material vertex = 1.0 -1 frame bone
+frame frame texture
+-1 = vertex frame anim bone = =
+-1
+vertex anim bone material vertex
+material 0.500000 frame frame
+1.0
+-1 anim vertex 0.500000 anim -1 = = texture bon
\ No newline at end of file
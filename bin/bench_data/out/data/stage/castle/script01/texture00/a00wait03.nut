@@ -0,0 +1,15 @@
+material
+material
+1.0 bone
+frame texture material anim = -1 1.0 anim frame
+1.0
+material = bone
+0.500000 frame -1 texture anim = material anim =
+bone bone
+1.0
+bone 1.0
+texture vertex = bone
+= vertex anim -1 texture -1 -1 bone 1.0 = frame bone 0.500000
+=
+=
+1.0 vertex
\ No newline at end of file
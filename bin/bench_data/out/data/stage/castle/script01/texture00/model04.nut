@@ -0,0 +1,35 @@
+bone -1 material
+frame anim vertex
+bone texture -1 material = vertex frame
+-1 anim
+= 1.0
+bone material anim frame
+1.0 0.500000 bone texture vertex material bone frame 0.500000
+texture anim -1 anim material 1.0
+anim frame frame
+frame material texture 0.500000 texture bone bone material
+material = =
+1.0 frame anim
+bone 1.0 anim 1.0
+bone 0.500000 -1 -1 bone 0.500000 =
+frame bone material
+anim = anim material texture vertex =
+0.500000
+anim material
+anim vertex bone = frame frame -1
+vertex anim
+anim frame 0.500000 frame frame vertex frame 1.0 bone bone
+bone texture
+frame -1 1.0 vertex =
+0.500000 = 0.500000 -1 vertex bone
+material texture
+anim vertex 1.0
+frame = texture vertex 0.500000 anim
+vertex 0.500000 bone -1 0.500000 0.500000 1.0 0.500000
+material
+vertex material vertex -1
+vertex texture frame anim
+texture
+-1 material vertex frame 0.500000 vertex material -1 anim frame texture
+1.0
+-1 1.0
\ No newline at end of file
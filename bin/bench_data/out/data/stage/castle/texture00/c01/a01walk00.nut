@@ -0,0 +1,52 @@
+texture anim 0.500000 material
+anim 1.0 anim vertex texture anim material vertex -1 vertex = vertex material 1.0 0.500000
+anim
+bone
+material = vertex = texture material = frame frame vertex vertex 1.0 = texture 0.500000 vertex 0.500000 = frame texture
+vertex vertex
+bone vertex = frame texture bone -1
+material bone 1.0
+= frame -1 vertex
+anim bone
+frame frame 0.500000 material vertex = bone texture -1 material material 0.500000 material
+vertex texture -1 texture 1.0 bone 0.500000 material material
+0.500000 -1 0.500000
+vertex texture -1 1.0 vertex frame frame vertex frame vertex
+-1 bone material 1.0 1.0 bone vertex vertex anim vertex
+material = = -1
+material anim material = vertex
+frame 1.0
+anim frame frame
+bone texture anim -1 0.500000
+texture material anim texture
+frame
+frame anim
+anim
+vertex bone texture
+-1 1.0
+-1 frame bone = 1.0
+vertex material = material
+-1 bone vertex frame
+bone = vertex anim anim = material -1 bone
+0.500000 bone 1.0 = anim
+anim -1
+=
+bone 0.500000 frame = = 1.0 anim
+anim
+= 0.500000 anim -1 anim = texture
+material material = material
+1.0 0.500000 anim anim
+frame 1.0 -1 bone texture 0.500000 1.0
+material material = frame anim = anim texture 1.0 vertex
+bone vertex = bone 0.500000
+texture bone = bone
+-1
+= anim anim
+vertex -1 texture texture vertex material texture 1.0 -1 anim bone -1 vertex
+bone
+anim
+bone = texture anim
+= material -1
+frame material texture 1.0 vertex 1.0 frame bone 0.500000 texture
+vertex vertex -1 = anim frame -1 vertex
+vert
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim
+texture
+bone material
+anim 0.500000 1.0 -1 vertex bone texture
+texture
+material = 0.500000 0.500000 anim
+material anim frame
+m
\ No newline at end of file
@@ -0,0 +1,36 @@
+vertex = 0.500000 vertex anim 1.0 bone texture 1.0 vertex material
+vertex frame -1
+1.0 1.0 = 0.500000
+anim material
+0.500000 material 1.0 -1 anim bone 1.0 vertex bone = texture -1 1.0 bone
+1.0 0.500000 0.500000 1.0 bone vertex material 1.0 0.500000 texture = = vertex bone texture anim = texture frame
+frame anim
+material texture -1 anim anim
+-1 1.0 vertex material texture
+texture 0.500000 -1
+0.500000 anim 0.500000 vertex -1 material bone
+texture 1.0 material = 1.0
+vertex bone
+vertex vertex
+0.500000 texture bone 0.500000 0.500000 material 1.0
+texture texture = frame anim 1.0 texture texture -1 texture bone
+bone 0.500000 bone material anim = bone 0.500000 bone material
+anim material -1 texture
+0.500000
+-1 1.0 frame vertex 1.0
+1.0 vertex frame frame 0.500000 material
+frame
+0.500000 frame frame texture texture = anim vertex bone -1 -1 -1
+frame frame 0.500000
+1.0 0.500000 anim = 1.0 vertex
+1.0 bone material -1 =
+material material
+anim -1 texture -1 bone 1.0 0.500000 material 1.0
+0.500000 frame material
+bone 1.0 material vertex 0.500000 bone vertex 1.0 anim frame
+-1 -1
+=
+1.0 texture
+texture frame
+material anim
+0.500000 -1 
\ No newline at end of file
@@ -0,0 +1,31 @@
+1.0 frame 1.0 0.500000
+-1
+1.0 bone
+frame -1 = 1.0
+vertex
+-1 material material material 0.500000 vertex
+frame bone material frame texture -1 = -1 bone bone
+-1 vertex vertex 0.500000
+1.0 -1 material bone anim material 1.0 texture
+0.500000 1.0
+1.0 frame anim
+anim
+frame = anim anim
+bone frame anim material = = =
+texture vertex anim bone -1 anim vertex vertex anim
+bone
+frame vertex
+texture
+material bone
+anim texture -1 1.0 vertex anim -1 anim -1 texture vertex
+material bone texture bone material 1.0 bone bone 0.500000 =
+texture
+1.0 =
+0.500000 0.500000
+anim
+texture
+= texture texture texture frame = anim 0.500000
+frame
+frame material vertex
+frame 1.0 0.500000 bone -1 frame anim texture anim bone
+1.0
\ No newline at end of file
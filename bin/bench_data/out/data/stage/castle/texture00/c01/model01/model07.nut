@@ -0,0 +1,187 @@
+anim
+1.0 0.500000
+= material = texture = -1 texture -1
+material vertex
+bone
+bone
+vertex
+material material material =
+1.0
+frame frame texture
+-1 = =
+anim
+bone 0.500000 texture bone material
+frame
+bone 0.500000 vertex 1.0 1.0 material
+0.500000 1.0 vertex =
+= 0.500000 texture material texture 1.0 frame
+anim material 0.500000 texture 0.500000 1.0 texture -1 1.0 = vertex
+anim vertex = 0.500000
+1.0 frame 1.0 vertex frame frame anim 0.500000 = 1.0 0.500000
+1.0 bone 0.500000 = material frame = texture
+anim anim bone anim =
+frame bone texture
+material 0.500000 frame anim
+vertex frame
+0.500000 = material texture = 1.0 texture anim
+-1 anim bone 0.500000
+vertex texture
+0.500000 1.0 texture = = frame vertex 1.0 bone -1
+0.500000 -1 material
+bone
+material
+vertex 0.500000 =
+= material anim bone
+= 1.0 frame frame
+anim
+bone vertex 1.0 bone vertex texture material vertex anim
+texture 1.0 anim bone -1 = frame -1
+anim vertex 0.500000 anim 0.500000 frame
+frame 0.500000 =
+texture anim -1 vertex
+bone = texture =
+frame
+vertex = texture
+anim 0.500000 1.0 anim 1.0 texture
+1.0 -1
+material texture
+vertex vertex frame material frame vertex 0.500000 bone 1.0 1.0 vertex 1.0 vertex 1.0 bone anim
+material 1.0 anim frame material
+texture anim vertex frame
+texture 1.0 anim 0.500000 vertex -1 anim anim 1.0
+material
+0.500000 vertex
+vertex bone -1
+texture =
+1.0 bone texture
+anim = anim
+= 0.500000 = -1 0.500000 1.0
+material -1 1.0 =
+material vertex 1.0 -1
+bone 1.0 bone
+material bone 1.0 =
+texture anim anim
+frame
+texture
+1.0
+-1 material material 1.0 vertex vertex vertex frame
+bone 1.0
+0.500000
+vertex
+frame anim
+vertex -1
+texture anim
+-1 material anim
+texture =
+material material 0.500000 -1 anim frame = texture
+= frame vertex 1.0 =
+frame
+bone =
+bone material
+=
+=
+bone
+vertex -1 -1 texture
+anim =
+frame material material bone texture frame 0.500000
+-1 anim
+0.500000
+vertex = material -1 frame anim anim 1.0 1.0 0.500000 frame 0.500000 frame 1.0 vertex material texture vertex
+anim vertex = = 0.500000 texture frame vertex texture = anim
+anim
+= 0.500000 bone material vertex
+= bone bone
+bone 0.500000 =
+1.0 frame frame material
+0.500000
+anim 0.500000
+frame
+1.0
+-1 = 0.500000 frame vertex = 1.0 anim
+anim
+material
+vertex bone
+vertex
+-1 material
+anim texture -1 anim 0.500000 =
+1.0 -1 -1
+frame
+= 0.500000 -1
+1.0
+texture frame
+vertex
+1.0 frame texture bone material material 0.500000
+material
+1.0 bone 1.0 1.0 material
+-1 material material
+bone vertex 1.0 frame vertex anim 1.0 vertex -1 texture frame
+0.500000
+frame 1.0 material material material -1 vertex 1.0 -1 0.500000
+frame
+-1 frame 1.0
+material frame anim 1.0 material 0.500000 bone texture 0.500000
+frame
+bone vertex 0.500000 bone texture
+vertex vertex anim
+0.500000 anim anim
+vertex vertex bone bone
+1.0
+-1 anim -1 bone anim
+material frame
+=
+-1 1.0
+frame
+material material = = 0.500000 -1 -1
+= anim
+= bone 0.500000 texture anim = 0.500000 frame texture 0.500000 vertex -1 =
+frame 0.500000 material
+-1 -1 frame
+texture texture texture frame texture -1 bone =
+1.0 anim frame 0.500000
+1.0 material anim
+material
+texture 1.0 0.500000 -1
+= texture
+vertex
+0.500000 bone 0.500000 texture texture
+1.0 frame material vertex 1.0 anim texture
+texture 0.500000
+material material anim 1.0 material -1 0.500000 anim anim
+vertex
+= 1.0
+-1
+1.0 anim = texture
+anim
+bone anim -1 texture
+anim
+frame frame
+1.0 1.0 -1 = texture material
+material
+anim
+frame -1
+material = texture
+0.500000
+-1 frame vertex
+0.500000 anim
+frame
+anim -1 bone texture frame =
+bone 1.0
+texture
+texture texture -1 texture -1 anim anim bone bone
+-1 0.500000
+bone bone frame material -1 vertex =
+vertex vertex material material
+frame
+anim 0.500000 -1 frame
+0.500000 frame -1 anim 0.500000
+bone = bone material anim
+=
+-1 =
+-1 frame 0.500000
+vertex anim 0.500000 =
+material -1
+material -1 -1 bone anim texture vertex texture -1
+vertex frame 1.0 vertex bone 1.0 1.0 anim
+frame 0.500000 vertex 1.0 frame material
+-1
+ve
\ No newline at end of file
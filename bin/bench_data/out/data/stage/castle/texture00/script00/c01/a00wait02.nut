@@ -0,0 +1,10 @@
+1.0
+=
+vertex texture
+material bone
+material 0.500000 1.0 frame
+material material frame
+=
+=
+frame -1
+-1 vertex 
\ No newline at end of file
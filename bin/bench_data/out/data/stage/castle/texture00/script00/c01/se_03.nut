@@ -0,0 +1,10 @@
+anim 0.500000
+anim
+bone texture
+vertex anim -1
+texture
+material bone
+frame vertex -1 0.500000 vertex bone
+anim
+frame =
+fram
\ No newline at end of file
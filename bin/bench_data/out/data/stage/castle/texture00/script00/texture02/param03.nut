@@ -0,0 +1,47 @@
+bone frame material anim =
+-1 = texture
+0.500000 -1 1.0 material frame material frame 1.0 material
+0.500000 vertex 1.0 bone vertex vertex = 1.0
+-1 vertex vertex frame material
+material
+anim 1.0
+anim
+vertex 1.0 anim
+-1 anim
+texture
+material texture -1 frame
+1.0
+frame
+frame 1.0
+vertex
+anim
+0.500000 frame -1 material 1.0 material anim =
+frame anim -1
+-1
+texture material
+= vertex
+= 1.0 texture material frame
+0.500000 = texture texture =
+1.0 bone vertex vertex = 0.500000
+anim
+0.500000 =
+frame
+= frame = anim texture texture vertex -1 frame = texture frame anim 1.0 frame
+material bone 0.500000 frame
+anim texture
+=
+1.0 0.500000 -1 bone texture 0.500000 material 0.500000 bone 0.500000
+bone texture vertex
+= vertex
+= frame
+bone anim anim texture frame material
+texture vertex 0.500000 vertex texture texture
+0.500000 frame -1 -1 1.0
+bone anim vertex
+0.500000 vertex
+= 0.500000 1.0 vertex 1.0 bone
+=
+anim
+0.500000 anim vertex = = bone
+anim bone = texture vertex vertex texture texture
+= anim material fr
\ No newline at end of file
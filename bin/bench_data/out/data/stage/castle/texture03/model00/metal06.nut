@@ -0,0 +1,3 @@
+0.500000 0.500000 frame = 1.0 0.500000 vertex
+anim 0.500000 -1 texture frame
+= 0.500
\ No newline at end of file
@@ -0,0 +1,58 @@
+-1 material texture frame 0.500000 = vertex bone anim = anim
+texture
+frame texture bone
+material vertex texture 1.0
+vertex
+bone = anim 0.500000
+material 1.0
+0.500000 1.0 bone material bone
+material =
+bone bone vertex 1.0 anim 1.0 1.0 1.0
+= vertex 1.0 anim =
+= vertex 0.500000 frame 1.0 -1 frame -1 material anim 1.0
+0.500000 material texture 0.500000
+-1 frame frame bone =
+frame
+material -1 anim 1.0 = texture 0.500000
+anim frame
+anim bone = -1 1.0 texture texture texture frame frame 0.500000 =
+vertex texture
+frame = -1 1.0
+material anim
+= 0.500000
+1.0 1.0 material frame bone frame = 1.0 texture material anim -1 -1 frame 1.0 1.0 1.0
+= 1.0 1.0 1.0 =
+-1
+texture 1.0 bone 1.0 bone
+anim
+= vertex -1
+frame -1 = frame anim
+0.500000
+= frame frame material
+frame 0.500000 -1 material texture 0.500000 -1 0.500000 anim frame
+frame
+frame 0.500000 =
+texture texture
+-1 bone =
+vertex
+material material 1.0 texture
+-1 texture
+-1 texture
+texture anim 0.500000 -1 1.0 bone vertex material -1
+vertex bone material frame
+frame
+texture bone anim
+0.500000 bone 1.0
+material bone anim
+-1 frame 0.500000
+1.0 anim = 1.0 1.0 vertex = anim 1.0 frame vertex
+-1 1.0 0.500000 material anim frame texture anim = vertex material texture -1 0.500000 1.0
+0.500000 = anim bone bone frame material 1.0 frame -1 = -1 1.0 texture vertex
+frame vertex
+texture texture vertex frame anim
+frame anim bone anim vertex vertex vertex texture
+frame 1.0 anim
+frame bone
+vertex
+texture frame -1 1.0
+material material material anim material anim frame frame bone -1 material bone 0.500000 texture anim frame bone anim bone 1.0 -
\ No newline at end of file
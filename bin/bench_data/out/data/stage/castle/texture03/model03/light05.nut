@@ -0,0 +1 @@
+Cؽ*M&?(_)cpnk
\ No newline at end of file
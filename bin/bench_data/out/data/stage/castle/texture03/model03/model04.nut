@@ -0,0 +1,127 @@
+texture anim
+material frame anim bone
+=
+anim anim vertex -1
+bone 0.500000 vertex =
+frame
+frame bone texture -1
+-1 vertex bone = texture 1.0 0.500000 texture bone bone = anim vertex texture
+=
+texture bone frame bone
+bone 0.500000 0.500000 frame
+material vertex bone material 0.500000 anim =
+material anim bone 1.0
+anim anim 0.500000 bone = texture texture texture anim 0.500000 0.500000 texture = 0.500000 1.0 -1
+anim
+=
+material
+1.0 bone material
+0.500000 texture
+frame anim material 0.500000
+frame bone material
+-1 anim
+material texture 0.500000 0.500000 0.500000 anim 1.0 0.500000
+material = 0.500000 -1 = frame =
+= 1.0
+texture frame 1.0 frame =
+-1 1.0 frame texture 0.500000 vertex -1 0.500000 -1 1.0 material frame bone bone anim anim texture = =
+texture
+bone
+frame bone
+bone frame
+texture
+texture frame material frame 1.0 -1 -1
+bone anim
+anim 1.0 bone frame 0.500000 = bone
+texture material
+1.0
+anim 0.500000 =
+frame -1 1.0 anim material -1
+-1 texture -1 frame 0.500000 material texture -1
+frame texture 0.500000 0.500000 texture
+1.0 0.500000 -1
+frame 0.500000 =
+-1 texture frame frame texture 0.500000 -1 -1 texture 0.500000 bone
+0.500000 material frame 1.0 frame
+vertex
+texture frame
+-1 texture material frame anim texture frame texture bone
+0.500000 frame 0.500000 1.0 bone
+bone
+frame texture material vertex anim texture anim 1.0 anim
+-1 bone frame anim anim material -1 anim 0.500000 texture
+texture vertex texture frame frame material anim bone
+material texture -1 vertex 1.0
+0.500000 bone vertex bone frame 1.0 -1 bone material frame
+1.0 0.500000 -1
+frame texture anim frame
+bone anim -1 anim 0.500000
+frame material anim 1.0 bone
+anim -1 -1 bone vertex material -1 -1 texture
+anim =
+-1 vertex vertex = frame 0.500000 =
+vertex
+=
+0.500000 -1
+vertex vertex =
+frame frame vertex
+material
+= anim vertex vertex frame bone
+1.0 -1
+anim 1.0 texture 1.0 texture
+0.500000 = = material vertex anim = = texture anim
+= vertex =
+material -1
+texture frame material 1.0
+anim bone vertex vertex
+texture
+texture = -1 0.500000 vertex -1 anim 1.0 vertex bone anim material 1.0
+frame anim material frame frame anim = 0.500000 frame bone texture
+texture -1 vertex
+texture material
+material texture frame 1.0
+bone texture vertex anim
+1.0
+vertex
+bone -1
+vertex bone -1
+-1
+frame
+anim -1 bone
+vertex frame
+frame anim texture = 1.0 -1
+1.0 anim frame
+bone bone -1 1.0
+texture material 1.0 texture material
+material
+frame material 0.500000 texture 0.500000 0.500000 vertex 0.500000 frame
+0.500000
+1.0 -1
+vertex 1.0
+texture
+texture = = frame
+bone vertex
+-1
+vertex 1.0 = 0.500000 frame 1.0 material anim vertex =
+material material
+0.500000 -1 texture 1.0 texture =
+0.500000
+-1 = anim anim texture vertex
+= -1
+= material = frame bone =
+0.500000 material 1.0 vertex 1.0 frame bone
+1.0 -1 texture
+=
+0.500000 anim frame frame material
+0.500000 texture texture 0.500000 vertex
+anim vertex vertex
+texture bone anim
+bone texture
+-1 texture vertex vertex vertex
+vertex texture
+bone 0.500000 0.500000 material anim frame material texture bone 1.0 texture
+= 1.0
+= anim 0.500000 bone frame texture 0.500000 = =
+1.0 vertex
+anim 1.0 material -1 vertex material
+bone = 1.0 material t
\ No newline at end of file
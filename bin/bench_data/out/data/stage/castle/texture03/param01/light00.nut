@@ -0,0 +1,66 @@
+anim anim bone material -1 anim anim
+-1 material frame
+anim 1.0 anim frame bone
+0.500000 vertex = frame 1.0
+anim 0.500000 texture -1 = texture frame
+frame
+frame frame 0.500000 -1
+texture vertex texture anim -1 vertex anim 0.500000
+0.500000 material 1.0 1.0 -1 bone texture 1.0
+0.500000 frame frame texture
+vertex vertex 0.500000
+bone 0.500000 1.0 frame vertex material
+frame frame vertex bone
+vertex bone vertex texture
+= -1
+= material -1 -1 -1 vertex bone material vertex
+texture
+-1 frame bone
+anim material = 1.0 vertex texture frame bone frame texture texture
+0.500000 frame frame
+material 0.500000 texture 0.500000
+frame anim anim 1.0 vertex vertex frame frame = frame texture material anim frame -1 frame 0.500000 1.0 1.0 frame material anim 0.500000
+0.500000 texture -1
+material
+texture 1.0
+-1 = = frame texture bone texture -1 bone material 0.500000 0.500000 0.500000 material material
+1.0
+= anim frame
+vertex
+bone =
+1.0 frame bone = material -1 material -1
+anim
+1.0 vertex 0.500000 vertex -1
+1.0 -1 vertex texture
+vertex vertex
+vertex
+material material bone anim bone bone 1.0 material
+frame vertex 0.500000 = bone texture = frame
+frame
+bone 0.500000 vertex anim =
+bone -1
+-1
+-1 material vertex frame 0.500000 -1 frame vertex = 0.500000 texture = texture vertex texture vertex
+-1 frame = bone -1
+anim = vertex
+material
+vertex texture 0.500000
+vertex bone vertex vertex anim
+material vertex
+1.0 anim frame anim = anim
+material 0.500000 material material -1
+texture frame
+anim = vertex material texture texture bone
+anim vertex
+1.0
+frame
+0.500000 anim
+vertex 1.0 bone texture anim bone 1.0
+frame vertex
+frame
+frame vertex bone anim anim material
+bone
+texture material texture 0.500000 anim bone -1 = material 1.0
+0.500000 -1 material
+0.500000 texture -1 bone
+anim 1.0 -1
@@ -0,0 +1,94 @@
+vertex
+0.500000 -1 anim 0.500000
+anim 1.0 material anim = -1
+1.0
+1.0 frame =
+anim
+frame material anim
+bone anim 0.500000 material texture bone -1
+anim
+-1 0.500000 1.0
+-1 0.500000 anim -1
+-1
+-1
+vertex anim vertex texture 1.0 0.500000 = vertex -1 vertex frame 1.0 frame
+-1
+0.500000
+vertex anim = material =
+0.500000
+-1 vertex
+vertex texture
+1.0
+texture = frame bone -1 bone material bone
+material -1 0.500000
+anim 0.500000 texture -1 1.0
+texture bone
+texture
+anim -1
+texture vertex bone
+bone vertex bone
+material 0.500000 anim = texture
+=
+-1 anim 1.0
+= 0.500000
+anim
+1.0 texture vertex
+-1
+-1 frame
+anim 0.500000
+material
+texture
+anim = anim
+-1
+anim frame -1 bone texture = texture anim -1 anim material 1.0 0.500000 0.500000 bone material = material -1
+0.500000 1.0 anim = material frame vertex
+-1
+1.0 0.500000
+texture 0.500000 vertex material frame
+-1 = anim texture = 0.500000 -1
+= material
+texture bone anim
+frame frame
+texture vertex 0.500000 vertex
+0.500000
+material texture = material 1.0 material
+-1 0.500000
+material frame
+vertex bone
+material 1.0
+=
+-1
+vertex bone material
+1.0
+1.0 = = anim 1.0 vertex 1.0 1.0 = material vertex = -1 1.0 = material 0.500000 0.500000 -1 =
+anim texture anim frame -1 anim bone 0.500000 bone
+anim material
+frame 1.0
+frame
+bone texture material 1.0 0.500000 -1 = material material texture
+1.0 =
+0.500000 material 1.0 1.0
+= =
+=
+-1 anim
+material material anim texture frame material 0.500000 frame frame -1 anim
+vertex anim
+material anim bone vertex
+bone 1.0
+0.500000 texture
+0.500000
+bone frame vertex frame 0.500000 material vertex 1.0 bone = = material vertex 0.500000 1.0 material
+texture -1 = bone = texture anim
+vertex
+= 1.0 material
+0.500000 frame 1.0 texture 1.0
+0.500000 bone
+material -1
+bone
+= -1 1.0 material
+texture -1
+texture texture
+1.0 bone
+frame
+=
+material -1 texture
@@ -0,0 +1,244 @@
+frame -1
+0.500000 0.500000 0.500000 frame 0.500000 =
+material frame
+bone texture =
+vertex
+texture 0.500000
+frame texture
+1.0 frame vertex = anim
+-1 -1
+material frame 0.500000 frame 1.0
+material bone frame anim =
+=
+vertex frame frame frame 0.500000
+= anim 1.0 vertex vertex
+bone
+material -1
+1.0
+= anim
+0.500000
+vertex vertex frame 1.0 frame
+material -1 -1
+material
+0.500000 1.0 -1 frame vertex
+bone
+-1 frame material material 0.500000
+0.500000 frame anim material
+1.0 bone 0.500000 frame 1.0
+material
+= 1.0
+frame texture texture vertex -1
+0.500000 frame 1.0 anim 0.500000 material bone vertex frame
+texture 1.0
+1.0 texture
+bone anim
+vertex anim frame vertex
+1.0
+material 0.500000 1.0 bone frame bone 0.500000 frame
+0.500000
+frame
+0.500000 0.500000 material
+0.500000 1.0
+texture
+texture texture = material material = vertex anim
+= texture frame
+vertex vertex material 0.500000 0.500000
+frame texture 0.500000 bone bone vertex texture anim -1 texture 0.500000
+=
+= frame material
+material material
+anim
+= bone =
+bone frame
+bone
+texture vertex -1 anim -1
+1.0 bone frame frame vertex
+0.500000
+bone 0.500000 = frame bone
+-1 vertex -1 vertex material texture vertex material texture vertex
+0.500000 texture material vertex material bone anim 0.500000
+vertex 0.500000 0.500000 texture anim material anim 1.0
+vertex frame -1 anim bone
+-1 vertex bone 1.0 0.500000
+-1 frame -1
+frame anim
+= anim
+0.500000 1.0 0.500000 texture
+-1 vertex bone frame vertex
+=
+1.0 0.500000 material = -1
+1.0
+texture texture
+0.500000 material -1 0.500000 material vertex 0.500000
+vertex = = 0.500000
+0.500000 frame texture material frame
+texture anim material
+= material
+frame
+bone 0.500000 material = bone vertex
+1.0 0.500000 vertex 0.500000 0.500000 material
+frame texture 1.0
+texture frame frame anim
+bone frame texture anim 0.500000
+1.0 anim frame texture material frame
+1.0
+material anim
+bone frame
+anim
+vertex material anim frame -1 0.500000
+texture
+-1
+0.500000 0.500000 0.500000 bone texture = material 1.0 anim
+=
+0.500000 1.0 -1 frame frame
+anim bone 1.0 bone -1 =
+bone bone bone 1.0 bone
+material vertex
+anim anim = frame
+bone bone frame anim
+1.0
+1.0 material frame -1 = = material -1
+material 0.500000 material bone anim
+frame frame -1
+material frame texture = 1.0 = 1.0 0.500000
+= anim
+=
+frame material texture
+frame 1.0 1.0 -1 0.500000 material bone anim anim
+-1 anim anim bone vertex texture =
+texture 1.0 frame
+1.0 material 0.500000 1.0 texture
+frame texture
+bone vertex anim
+0.500000 vertex frame
+0.500000 -1 bone -1 frame 0.500000 anim
+0.500000 frame
+texture 1.0 1.0 = material bone frame
+bone = 1.0 material = anim
+texture anim 0.500000
+1.0 texture 0.500000 frame -1 frame
+vertex frame = 1.0 1.0
+texture
+=
+-1 material 1.0
+texture frame anim bone 1.0 =
+texture -1
+-1 frame bone 0.500000 material -1 material
+anim 0.500000 = texture texture 0.500000 bone
+bone
+-1 anim
+material anim anim
+bone bone bone 0.500000 1.0
+= vertex 0.500000 frame frame 0.500000 frame vertex 1.0 0.500000 vertex
+vertex texture 0.500000 frame
+frame material
+texture 1.0
+0.500000 bone texture
+anim anim bone 0.500000 bone frame -1 0.500000 texture
+vertex frame frame frame texture vertex
+material frame 0.500000 -1 material frame 1.0
+anim
+frame
+1.0 anim
+frame bone
+texture 0.500000 anim bone vertex texture bone 1.0
+0.500000
+-1
+anim material
+vertex
+frame vertex
+0.500000
+-1 material material = anim vertex =
+= 0.500000 texture
+material vertex
+texture vertex texture 0.500000
+bone texture frame 1.0 anim -1 0.500000
+vertex 0.500000 anim
+-1
+frame vertex texture
+= bone frame texture vertex -1 material vertex
+1.0
+texture -1 -1 0.500000 texture frame
+0.500000 0.500000 -1
+texture bone texture frame 0.500000 anim = anim texture = frame
+material
+anim texture
+frame = -1 material frame 1.0
+= 0.500000 0.500000 texture frame -1 material 0.500000
+bone 0.500000 bone
+= texture
+bone frame bone anim 1.0 1.0 0.500000 bone texture texture material frame -1 1.0 -1 -1
+0.500000
+texture
+texture 1.0 texture texture
+material
+frame texture texture -1 frame -1 -1 material = frame anim anim = bone 1.0 anim texture anim
+-1
+texture = texture texture vertex
+texture = bone
+anim anim
+bone 1.0 texture
+vertex texture texture vertex vertex -1 0.500000
+bone
+material texture material 0.500000
+-1 0.500000
+texture texture -1 -1 vertex = = texture
+bone 1.0 bone
+bone bone
+bone
+-1
+1.0 -1 material 1.0 bone texture -1 material
+1.0
+texture texture -1 bone
+anim anim
+frame 1.0 = material material texture frame 1.0 bone
+0.500000 material
+material 1.0 -1 = vertex = -1 texture material
+bone anim 0.500000 bone vertex texture material frame = 0.500000 = anim material bone
+bone
+= 0.500000
+material -1
+bone bone texture
+1.0 material
+= frame
+vertex frame
+frame texture
+bone bone 0.500000 -1
+material
+1.0
+-1
+-1 vertex
+= 0.500000 -1 1.0 = = material bone 0.500000 material
+frame vertex frame vertex = = 1.0 material material bone material bone =
+frame -1 anim vertex material = texture material
+1.0 anim
+1.0 -1 frame -1 anim
+= -1 -1 0.500000 0.500000 -1 = vertex frame frame vertex 1.0
+1.0 texture anim texture anim texture vertex 1.0 0.500000 texture 0.500000 1.0 anim vertex vertex -1 1.0
+1.0
+texture -1 vertex anim
+material -1
+anim = frame bone material
+bone
+bone frame = texture frame
+frame anim vertex
+bone 0.500000 1.0 anim =
+-1
+1.0 material frame 0.500000 = material texture frame -1 0.500000
+material -1
+vertex 0.500000 frame
+1.0 = bone vertex -1 bone bone material vertex 1.0 0.500000 anim material = 1.0 0.500000 -1 material anim vertex anim
+-1 vertex frame frame anim vertex 1.0
+bone bone anim bone
+=
+0.500000 0.500000 material
+anim
+anim frame
+1.0 1.0
+texture
+anim
+anim 1.0 bone
+bone
+= vertex
+1.0 bone =
+a
\ No newline at end of file
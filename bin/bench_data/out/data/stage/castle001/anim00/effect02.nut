@@ -0,0 +1 @@
+-1 vertex material texture vertex
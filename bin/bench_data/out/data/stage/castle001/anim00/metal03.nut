@@ -0,0 +1,187 @@
+anim -1
+vertex bone anim texture
+anim anim = bone
+bone vertex
+frame frame -1 -1 0.500000 frame 1.0 0.500000 frame texture material anim
+anim bone = 0.500000 anim -1 1.0 texture =
+anim 1.0
+0.500000 1.0 bone
+= texture vertex
+0.500000 bone
+frame vertex material
+0.500000
+material bone bone
+frame material bone 0.500000
+anim vertex
+bone vertex bone
+frame 1.0
+frame =
+anim 0.500000
+material
+texture
+0.500000 vertex vertex
+0.500000 texture material vertex frame
+= vertex 1.0 material -1 =
+-1 = frame
+bone -1
+material texture bone vertex
+frame
+anim =
+= bone anim frame 1.0 anim frame material -1 = bone 1.0 0.500000 frame frame
+0.500000 texture vertex frame vertex vertex 0.500000 anim frame texture
+anim
+anim
+1.0 bone anim = 0.500000 vertex material texture bone material material
+= 0.500000 vertex
+frame
+1.0 frame =
+vertex
+vertex frame vertex texture bone -1 -1 material texture
+-1
+=
+-1 1.0 vertex = anim
+frame -1 vertex
+0.500000 frame bone -1 -1 -1 texture texture =
+vertex
+1.0 1.0 vertex
+0.500000 1.0 = -1 anim -1
+-1 -1 anim 0.500000 texture bone 0.500000
+frame
+material 0.500000 bone texture material anim 0.500000 vertex vertex
+-1 0.500000 = vertex bone = = -1 vertex frame anim 1.0
+material vertex vertex frame
+vertex frame 1.0 =
+1.0 frame 1.0 = =
+1.0 texture anim =
+= 1.0 -1 vertex 1.0
+= vertex material = vertex 1.0 bone
+-1 texture material vertex material bone -1 1.0
+texture
+-1 frame 1.0
+= texture 1.0 texture
+anim texture vertex = texture -1
+bone -1 vertex 1.0 material
+material bone 0.500000
+-1 = bone bone
+anim anim = -1 anim
+texture 0.500000 bone 0.500000 vertex texture material texture -1
+vertex
+frame vertex 1.0 0.500000
+-1 vertex
+vertex texture vertex material
+vertex vertex frame 0.500000 texture = -1
+0.500000 0.500000 -1
+-1
+anim 1.0 anim anim texture bone 0.500000
+bone = frame texture bone texture
+0.500000 texture texture bone 1.0 material material vertex = texture 0.500000 1.0 vertex 0.500000 -1 frame frame -1 material texture bone anim material 0.500000 -1 = = texture bone -1
+-1 material anim 1.0 -1
+0.500000 bone 1.0 vertex bone 1.0
+vertex -1 vertex
+-1
+material
+vertex bone vertex
+frame
+1.0 vertex texture material texture 0.500000
+texture = material material vertex frame 1.0 frame bone 1.0 vertex
+anim vertex vertex texture material texture material frame material
+vertex = = frame
+1.0 vertex = anim vertex texture
+texture
+material vertex vertex -1
+bone =
+-1 0.500000 0.500000 vertex anim 1.0 anim frame anim anim material
+texture =
+vertex material frame 0.500000
+1.0 texture
+1.0 -1 -1 bone frame -1
+-1 1.0
+1.0 texture
+0.500000 -1 frame
+1.0 = frame -1 1.0
+vertex
+anim anim vertex frame texture
+texture
+1.0 frame
+material bone anim 1.0 anim -1 vertex material
+0.500000 1.0
+vertex bone
+material bone 0.500000 texture = bone anim material anim
+= -1 material bone material 1.0 material -1 0.500000 anim material -1 anim
+-1 0.500000
+material bone
+0.500000
+0.500000
+1.0 1.0 0.500000 texture 0.500000 frame =
+= 1.0 vertex
+anim material 0.500000 vertex anim
+0.500000 0.500000
+anim material anim frame 0.500000 frame
+0.500000 = bone texture
+material
+material = bone anim
+vertex = frame vertex
+= texture
+material
+anim -1 vertex
+vertex
+-1 =
+0.500000 material
+bone vertex anim
+vertex
+0.500000
+0.500000 bone =
+bone
+bone bone
+material
+material frame 0.500000 material
+= frame vertex bone bone texture 0.500000 frame 1.0 -1 0.500000 0.500000 anim 0.500000
+anim = texture frame = material = 1.0 texture material
+anim bone vertex 1.0 vertex anim bone
+anim
+frame
+vertex bone
+material anim 1.0 texture frame
+bone vertex
+frame bone material 1.0 = material
+1.0 bone material
+anim 1.0 = frame anim material
+texture bone =
+1.0 0.500000 bone 1.0
+0.500000
+0.500000 -1 frame 0.500000 anim material 1.0 0.500000 = frame anim frame -1 bone frame material bone -1
+0.500000
+anim material material 1.0 0.500000 0.500000 material frame =
+1.0 = frame bone 0.500000 bone anim material frame = bone bone
+material = material
+= 1.0 =
+= -1 0.500000 material -1 = 1.0
+vertex material 1.0 bone frame anim -1 = = 1.0 = texture frame bone 1.0
+material
+bone bone material -1 vertex anim material
+vertex texture anim frame
+frame anim
+bone
+bone vertex
+1.0 anim 0.500000 1.0 = anim texture 0.500000 vertex material anim material bone texture frame bone 1.0
+= material anim material material texture texture
+-1
+1.0 = material vertex vertex vertex
+anim vertex -1 vertex
+vertex texture 1.0
+material material 0.500000 frame
+0.500000 material
+bone material bone frame
+frame
+vertex
+= 1.0
+bone -1 = 0.500000 texture material -1 material frame 0.500000 material 1.0 -1 bone
+bone 0.500000
+vertex vertex 0.500000 -1 frame bone texture
+0.500000 1.0 = material -1 anim 0.500000 texture vertex
+0.500000 frame vertex vertex
+material -1 -1 anim texture
+anim 1.0 bone frame -1 vertex 0.500000 = frame 0.500000
+0.500000 0.500000 texture 1.0 -1
+frame texture 0.500000 texture bone material
+frame bone material bone 0.
\ No newline at end of file
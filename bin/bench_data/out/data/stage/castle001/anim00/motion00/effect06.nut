@@ -0,0 +1,9 @@
+-1 frame
+=
+1.0 frame 0.500000
+vertex
+anim
+frame = 0.500000
+bone
+frame
+texture 1.0 material vertex = vertex texture = 1.0
\ No newline at end of file
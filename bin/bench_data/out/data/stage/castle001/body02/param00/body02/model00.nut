@@ -0,0 +1,87 @@
+0.500000 =
+-1 1.0 1.0 material
+vertex
+anim -1 bone vertex 0.500000
+material 1.0 vertex -1 anim texture frame
+-1 texture
+-1 vertex
+=
+0.500000 vertex 0.500000 -1 1.0 -1 1.0 = -1 -1 -1 vertex frame
+bone =
+material frame bone 1.0 -1 -1 frame vertex anim = bone vertex material
+1.0 0.500000 anim material
+anim frame
+vertex
+1.0 frame bone bone -1 bone frame anim texture
+material vertex
+= material
+0.500000
+0.500000 0.500000 frame vertex texture
+anim vertex -1
+= -1 vertex material
+0.500000 bone
+material texture texture 0.500000 material frame 0.500000
+texture texture material anim
+vertex
+1.0
+0.500000 1.0 1.0
+anim
+= texture frame anim vertex material
+vertex 0.500000
+1.0 =
+0.500000 1.0 =
+anim bone frame 1.0
+anim 0.500000 bone vertex frame -1 0.500000 texture bone 0.500000 anim vertex
+bone -1
+1.0 material = bone
+=
+bone
+1.0 bone material -1 vertex
+frame = bone 1.0 frame
+1.0 material anim
+material bone frame frame material material
+vertex material material vertex vertex material frame 1.0 material material
+anim 1.0 material =
+-1 1.0 -1 1.0
+1.0 material texture texture frame frame 1.0 frame = -1 1.0
+1.0 anim anim texture
+texture 0.500000 material bone
+1.0 1.0 bone
+frame
+= vertex 1.0 texture
+vertex = frame
+= vertex
+bone 0.500000
+frame material bone material anim =
+vertex 0.500000
+0.500000
+anim
+texture 0.500000 -1
+vertex 1.0 texture material -1 vertex 1.0
+1.0
+vertex 1.0
+texture frame frame frame vertex bone anim texture material
+vertex
+1.0 bone bone
+anim anim
+material vertex
+material frame 1.0
+anim frame vertex
+texture bone
+anim texture texture vertex anim 1.0 frame anim bone 1.0 bone anim
+frame texture
+-1
+1.0 bone frame
+material vertex material 1.0 frame
+frame anim
+-1 anim material
+-1 bone
+bone = 0.500000 = frame
+= = texture frame -1 material vertex -1
+vertex material bone material bone
+vertex
+frame
+anim -1 vertex vertex 1.0 0.500000
+frame texture bone texture
+-1 material anim anim 0.500000 material -1
+1.0 material = frame bone 0.500000 1.0 material -1 ve
\ No newline at end of file
@@ -0,0 +1,23 @@
+frame
+1.0 = 0.500000 =
+anim frame
+material
+material anim 1.0 anim 0.500000 =
+bone =
+bone bone texture material vertex material
+frame -1 bone
+= 1.0 texture = texture -1
+texture anim 0.500000 0.500000 -1 anim 1.0
+=
+material
+1.0
+material anim texture vertex bone 1.0 = 0.500000 frame -1 1.0 vertex 1.0
+bone texture -1 frame
+material 0.500000 texture material 1.0 -1
+1.0 0.500000 bone texture bone vertex bone bone texture vertex 1.0 0.500000
+-1
+-1
+frame texture anim 0.500000
+anim material
+frame frame =
+tex
\ No newline at end of file
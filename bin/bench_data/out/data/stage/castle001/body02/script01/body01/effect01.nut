@@ -0,0 +1,8 @@
+material -1 -1 anim
+0.500000 bone 1.0 1.0 1.0
+vertex 1.0 -1 frame 0.500000
+-1 material -1 -1 -1
+vertex anim -1 -1
+0.500000 frame -1 frame 1.0 = -1
+texture frame 1.0 frame frame anim 1.0 anim
+= = -1 texture vertex texture -1
\ No newline at end of file
@@ -0,0 +1,32 @@
+1.0
+vertex vertex anim -1 bone material
+anim vertex 1.0 texture frame vertex bone frame
+1.0 1.0 0.500000 -1 bone
+texture = material bone frame frame
+0.500000 0.500000 vertex texture anim 0.500000
+-1
+0.500000 texture
+vertex -1 anim frame bone 0.500000 1.0 frame
+1.0 texture 0.500000 0.500000
+vertex frame =
+bone frame anim frame bone frame vertex
+0.500000 texture -1 bone 0.500000
+bone = bone -1
+vertex material
+material frame
+1.0 1.0 anim texture vertex anim
+1.0 material 0.500000
+-1 anim =
+frame
+vertex vertex bone -1
+frame
+0.500000 = 0.500000 = vertex 0.500000 vertex
+texture frame material 1.0 material
+-1 -1 1.0 0.500000
+material anim anim 1.0
+1.0 vertex
+= -1 1.0 = bone = 0.500000 frame
+vertex = 1.0
+texture anim 0.500000
+1.0 = texture 1.0 texture
+materia
\ No newline at end of file
@@ -0,0 +1,19 @@
+frame 1.0 anim =
+0.500000 0.500000 1.0 material
+material
+texture
+= frame material
+-1 texture material frame anim texture material texture
+-1
+bone
+=
+-1 1.0 = bone material anim -1 vertex bone 0.500000
+vertex
+vertex
+frame anim 0.500000 = bone 1.0
+=
+frame texture anim
+-1 0.500000 material
+anim vertex
+1.0 0.500000 0.500000 material material texture
+1.0 bone frame 0.500000 texture vertex 1.0 anim 
\ No newline at end of file
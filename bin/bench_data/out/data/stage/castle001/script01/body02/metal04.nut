@@ -0,0 +1,92 @@
+0.500000
+vertex material vertex 0.500000
+frame 1.0 = anim
+0.500000 frame
+bone 1.0 0.500000 material -1 1.0 vertex anim = anim 1.0 bone vertex vertex 0.500000 bone frame bone material 1.0
+anim 0.500000
+frame = frame
+=
+anim vertex
+-1 material
+-1 frame texture bone = bone bone bone = 1.0
+material 0.500000
+frame 0.500000 frame 1.0 = vertex frame bone 1.0 = texture vertex frame
+bone
+0.500000 texture vertex texture vertex 1.0 = bone frame
+bone texture bone
+0.500000
+frame texture
+1.0 frame -1 0.500000
+frame
+frame bone
+bone bone material
+= = vertex bone 0.500000
+frame anim anim -1 frame 0.500000 bone frame 1.0 vertex
+vertex anim -1 1.0 frame = 0.500000 bone
+0.500000
+material = material
+= anim material frame = bone 1.0 -1 frame material -1 bone bone material -1
+material bone
+bone frame vertex anim
+texture frame texture 0.500000 texture -1 vertex 0.500000 vertex vertex -1 0.500000 0.500000
+bone =
+frame 1.0 1.0 texture bone
+frame material texture vertex 0.500000 texture -1
+-1
+vertex -1 texture texture texture
+-1
+=
+anim
+anim -1 material texture frame -1 bone
+= -1 material
+-1
+vertex anim
+vertex =
+texture material texture
+bone 0.500000 bone frame anim
+bone texture = vertex texture anim texture
+anim
+0.500000 frame = 1.0 vertex
+frame frame
+bone
+vertex
+vertex =
+=
+bone -1
+bone anim vertex -1 vertex
+frame frame vertex 1.0
+bone = material 0.500000
+vertex bone =
+material anim texture anim = = 0.500000 anim anim
+material -1 vertex
+anim
+texture 1.0 0.500000 material texture anim bone bone frame -1 -1
+0.500000 bone
+1.0 = -1 1.0 = 1.0 vertex vertex
+=
+=
+texture anim 1.0
+-1 0.500000
+material
+0.500000 vertex texture frame
+0.500000 bone 1.0 =
+= =
+anim anim
+anim -1 1.0
+-1
+1.0 anim
+0.500000
+frame
+0.500000 anim 0.500000 1.0 anim 1.0 bone
+material material
+texture texture -1 0.500000
+material
+texture material
+1.0 -1
+=
+frame -1 = bone
+bone vertex 1.0 bone frame 1.0 frame texture =
+bone
+0.500000 frame vertex frame
+texture vertex 0.500000 = 0.500000 frame material texture 0.500000 anim vertex texture -1 1.0 -1
+anim = =
\ No newline at end of file
@@ -0,0 +1 @@
+%2:2tBq?J0/,e{2RRKȊ)<}hQz)o,*#[ӀڄwzN)z$ttG\4s7A'LQ)j?fYؽ*mrCZhD1UuMZ,j]	hn]搁Iq"vi4'd"gBɖqI!0},,mC+=Pޭ6uI^a2UٗR:&T2Rj%Wz4}|}v:q)JR
\ No newline at end of file
@@ -0,0 +1,4 @@
+= vertex -1
+1.0
+vertex 1.0 frame texture = -1
+frame 0.500000 ve
\ No newline at end of file
@@ -0,0 +1,36 @@
+frame frame anim 0.500000
+vertex -1 bone texture anim -1 =
+frame anim
+0.500000 anim 1.0 frame texture
+anim
+bone
+material material frame -1 material frame
+bone anim material = material =
+material material frame texture texture
+vertex
+frame =
+bone anim frame 1.0 frame frame = = material -1 -1 anim vertex frame
+0.500000 material 1.0 material frame texture
+1.0 0.500000 texture -1
+1.0 bone 0.500000 frame material
+texture anim anim -1
+= material anim anim bone vertex = texture texture
+material 0.500000 material texture texture bone vertex material 0.500000 -1 0.500000 vertex bone frame
+= frame -1 -1 material 1.0
+0.500000
+texture
+vertex -1
+material texture texture 0.500000 frame frame vertex = frame = bone = texture material 0.500000 anim -1 0.500000 vertex frame
+-1 frame
+anim -1 texture vertex -1 bone texture
+0.500000 anim -1 = 1.0
+material = anim = = frame 0.500000 bone
+vertex bone 1.0 material =
+= anim vertex
+frame bone -1 material = frame
+1.0 frame =
+bone
+bone 0.500000 -1 1.0 1.0
+texture =
+texture frame 0.500000 -1 texture anim vertex anim frame bone -1
+0.500000 texture texture material material anim anim fr
\ No newline at end of file
@@ -0,0 +1,8 @@
+texture -1 frame material 1.0 0.500000 material = =
+anim
+frame texture anim bone =
+1.0 anim
+= bone = = material -1 material = 0.500000 1.0
+0.500000
+vertex = bone 0.500000
+anim ve
\ No newline at end of file
@@ -0,0 +1,51 @@
+texture anim -1 vertex 0.500000 vertex 1.0 0.500000 -1 -1
+frame bone
+texture
+0.500000 vertex 1.0
+=
+vertex
+frame 1.0 0.500000 vertex 1.0 material texture
+-1 material bone
+vertex -1 1.0
+0.500000 = vertex
+anim vertex
+-1 =
+bone
+vertex material -1 vertex bone bone
+texture texture -1 anim
+bone
+1.0 -1
+anim -1 1.0 texture frame anim
+frame
+0.500000
+frame
+texture frame =
+frame
+0.500000
+texture
+anim vertex
+frame bone
+0.500000 bone texture
+material
+-1 vertex vertex frame
+texture bone vertex texture bone 0.500000 0.500000 = = = = vertex
+frame 0.500000 frame material bone anim
+= bone 1.0
+0.500000 anim -1 -1 =
+bone
+= 0.500000 1.0
+anim vertex
+anim anim -1 = -1 bone
+anim -1 vertex
+= bone frame
+1.0 0.500000 anim
+texture 1.0
+material
+frame =
+1.0 -1
+-1 bone
+vertex
+bone anim material 0.500000
+vertex
+texture
+1.0 anim 0.500000 -1 texture 1.0 1.0 = -1 -1 0.500000
\ No newline at end of file
@@ -0,0 +1,122 @@
+anim -1 material
+bone texture frame 1.0 material bone
+-1 frame frame anim anim texture material
+frame
+frame = = bone -1 0.500000 =
+bone
+anim frame anim material texture bone material 1.0
+= -1 frame bone vertex
+bone anim -1 bone 0.500000 bone = material = frame -1 1.0
+=
+vertex anim = = vertex material frame 1.0
+= -1
+1.0 anim material material
+material material material anim
+material = texture frame
+0.500000 bone vertex anim anim texture
+texture bone frame vertex
+texture frame 1.0 -1
+vertex
+1.0
+vertex -1 anim vertex
+-1 1.0 anim texture texture
+1.0 frame bone = = -1 0.500000
+0.500000 material bone
+= 1.0 -1 0.500000 bone -1
+= bone -1 texture
+anim
+material 0.500000 vertex material frame bone
+anim frame = frame frame
+bone
+=
+1.0 1.0
+-1 vertex 1.0 -1 0.500000 = = 0.500000 = vertex material =
+frame 0.500000
+bone
+texture anim material material texture 0.500000
+= anim
+0.500000 texture -1 frame anim -1 texture
+material vertex vertex
+texture 1.0 0.500000
+anim 0.500000 -1
+anim
+-1 frame
+bone = texture 1.0 1.0 frame bone vertex vertex
+vertex
+= bone
+= bone
+texture frame bone anim texture 0.500000
+=
+vertex bone material anim bone
+0.500000 texture vertex material 0.500000 1.0 vertex texture -1 =
+bone
+0.500000
+texture
+= texture bone anim
+anim -1 = bone
+material texture texture
+material frame anim frame 0.500000 vertex
+= =
+vertex frame bone 1.0 anim vertex 1.0 0.500000 -1 frame -1 frame vertex = material bone frame 1.0 anim -1 1.0
+bone vertex bone 0.500000 -1 texture -1 material -1 1.0 bone material 1.0 =
+bone 1.0
+0.500000 vertex 0.500000 anim 0.500000
+material
+frame frame = anim
+anim bone =
+0.500000 anim anim frame
+material 1.0
+material frame
+-1
+material anim anim vertex 1.0 frame 1.0 material
+anim texture 1.0 1.0 = anim 0.500000 -1 material bone bone material material 0.500000 -1 frame -1 0.500000 texture texture frame texture
+frame bone 1.0 0.500000
+vertex
+= texture -1 = anim
+0.500000 vertex frame texture
+1.0
+texture anim -1 frame material -1 vertex
+-1 -1 1.0 texture =
+material 0.500000 bone bone material anim 0.500000 material = anim frame anim texture 1.0 0.500000 vertex frame 1.0
+bone bone
+0.500000 texture bone material -1 = 0.500000 = = vertex -1 1.0 vertex = bone anim
+=
+anim anim 0.500000 -1 1.0 bone vertex bone
+=
+material
+frame bone 0.500000 1.0 texture -1 vertex vertex bone material vertex anim 0.500000 material 1.0 1.0 anim
+material anim
+-1 1.0
+material bone -1 material vertex bone -1
+material frame bone
+bone -1 vertex 0.500000 -1
+frame frame
+vertex = material
+=
+bone material
+frame
+bone anim
+vertex
+frame frame =
+= bone anim frame 0.500000 0.500000 vertex anim
+bone 0.500000
+bone 1.0
+0.500000 = texture 0.500000
+1.0 0.500000
+frame
+bone =
+1.0
+frame
+= vertex
+1.0 vertex material vertex 1.0 texture vertex = 1.0 vertex texture frame bone bone anim anim bone bone -1 -1
+texture
+1.0 texture
+frame bone
+1.0 material material anim anim 0.500000 anim
+texture anim bone -1 anim material vertex frame = = anim 1.0 vertex texture = -1
+anim
+texture
+-1 = -1 0.500000 material 0.500000
+frame material -1
+frame -1 texture
+frame anim = 1.0 tex
\ No newline at end of file
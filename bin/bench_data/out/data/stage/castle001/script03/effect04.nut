@@ -0,0 +1,96 @@
+frame
+vertex = bone 0.500000
+texture
+texture 0.500000 material vertex anim frame anim vertex
+= bone texture bone -1
+-1 -1 vertex
+material
+-1 = 1.0 vertex
+bone texture vertex bone = bone frame bone texture
+= texture 1.0
+0.500000 material
+1.0 vertex
+texture anim
+bone 1.0 vertex = texture
+anim texture
+1.0
+=
+anim bone material
+vertex vertex 0.500000 material
+vertex
+1.0 = frame 0.500000
+-1 frame material material material anim 1.0
+0.500000 anim bone texture material 0.500000 vertex vertex -1 -1 bone = -1
+vertex bone
+texture = material texture
+0.500000
+1.0 0.500000 anim bone = 1.0 -1
+-1 anim anim material
+texture anim
+0.500000 material 0.500000
+texture
+frame 0.500000 1.0 vertex
+bone material vertex = 0.500000 -1 1.0 vertex
+0.500000
+1.0 -1 material
+vertex 0.500000
+-1 frame
+frame
+= material bone texture material -1 vertex 0.500000 anim material 0.500000
+bone bone anim =
+material =
+-1 material = = 0.500000 -1 bone -1
+0.500000 vertex vertex
+-1 frame texture
+-1 bone frame
+-1 -1 vertex frame 0.500000 anim
+frame vertex -1 bone vertex material vertex
+frame material vertex 0.500000 0.500000 frame texture vertex 1.0 0.500000 vertex
+1.0 0.500000 texture frame
+texture texture bone texture texture frame
+frame
+frame -1 1.0 anim vertex 0.500000 bone frame anim
+1.0 frame 0.500000 bone -1 0.500000
+vertex frame texture
+1.0 1.0 bone texture texture anim -1 1.0 anim 1.0 anim anim anim texture 0.500000 1.0 frame vertex bone
+texture 1.0 anim 0.500000 frame anim material anim
+-1 frame 0.500000 -1
+1.0 texture material texture vertex texture bone vertex
+0.500000
+material
+-1
+frame bone = bone
+0.500000 -1
+0.500000 -1
+= 1.0 bone
+vertex
+1.0 vertex 1.0 anim =
+=
+texture frame anim
+-1
+1.0 anim frame -1 frame
+material anim material
+-1 anim
+= material texture
+1.0 -1 bone
+1.0 bone material
+vertex anim
+anim
+= texture material frame vertex
+frame bone
+frame = 1.0 0.500000 frame 0.500000
+anim 0.500000 = 1.0
+= texture vertex
+bone frame = frame 0.500000 1.0 texture vertex texture frame bone = frame material 1.0 =
+texture -1
+vertex
+bone 0.500000 -1
+texture -1 anim texture 1.0 0.500000 bone 1.0 material
+texture material texture texture bone
+material
+vertex -1 -1 texture 0.500000 frame
+1.0
+anim anim 0.500000 1.0
+frame 0.500000 anim
+= bone 0.500000 bone anim
+bone material t
\ No newline at end of file
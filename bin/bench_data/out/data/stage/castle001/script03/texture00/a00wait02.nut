@@ -0,0 +1,290 @@
+texture =
+texture material material
+-1 1.0 bone -1 anim anim =
+frame
+texture = = bone vertex -1 -1 0.500000
+texture bone bone vertex frame -1 texture 1.0 frame bone vertex frame 1.0 =
+0.500000 material -1 -1 = bone
+-1 = vertex = material
+-1
+= frame bone vertex
+0.500000 material texture -1 material frame material 1.0 bone material
+vertex = 0.500000 anim vertex vertex
+0.500000 frame -1 -1 texture anim vertex bone
+material anim = anim vertex
+1.0 texture material anim
+= frame
+1.0 anim 0.500000
+=
+anim
+material
+0.500000 texture
+1.0 frame bone frame anim
+-1 -1 1.0 vertex
+vertex material texture material 0.500000
+= material vertex 1.0 =
+vertex 0.500000
+0.500000 bone
+material texture 1.0 vertex 1.0 anim anim bone vertex
+vertex
+1.0 material
+0.500000
+frame frame frame
+material =
+anim texture frame vertex 0.500000 1.0 1.0 frame bone
+=
+vertex
+-1 bone 1.0 material bone
+anim texture bone -1 material frame 1.0 vertex 0.500000 frame =
+bone
+vertex
+vertex material bone frame material vertex texture vertex vertex -1
+-1 bone
+1.0 -1 anim
+anim texture
+0.500000
+= texture anim texture 0.500000 0.500000 anim texture -1 0.500000 texture = anim texture texture = 1.0 0.500000 frame
+material = = 1.0 material -1
+frame anim material
+material
+vertex vertex -1
+material 0.500000 0.500000
+0.500000 1.0 vertex
+texture bone anim
+material
+frame 0.500000 bone
+= texture 0.500000 material 0.500000 = 0.500000 0.500000
+material
+0.500000 frame vertex
+anim = -1 frame
+vertex vertex texture bone
+anim texture bone
+-1
+texture frame -1 texture bone anim
+=
+vertex anim 0.500000 0.500000 1.0 1.0 anim = bone bone bone texture 0.500000 1.0 vertex material frame anim
+anim = 1.0 frame anim 1.0 anim = anim 1.0 anim
+anim = bone frame 1.0 -1 -1 bone
+bone frame frame vertex =
+1.0
+= vertex -1 -1 =
+=
+-1 vertex bone texture
+frame anim vertex vertex 1.0 frame frame
+1.0 -1 bone 0.500000 frame bone
+-1
+-1 anim bone = bone bone 1.0 anim 1.0 1.0
+0.500000
+-1 0.500000 vertex
+1.0 bone anim texture 0.500000 -1 bone
+bone = -1
+frame texture
+material material 0.500000 frame 1.0
+0.500000 1.0
+-1 vertex
+bone = texture -1
+0.500000 = frame
+= vertex 0.500000
+anim texture vertex vertex vertex 0.500000 vertex bone vertex anim anim bone
+anim
+frame texture vertex 0.500000 anim 0.500000 bone
+anim anim 0.500000 = -1 1.0 frame texture
+anim 1.0 texture
+frame
+frame
+0.500000 texture
+0.500000 material frame bone texture anim texture material frame -1 0.500000 vertex
+texture anim texture vertex vertex bone bone anim
+texture
+vertex 0.500000 = bone vertex 1.0 1.0 0.500000 texture = material vertex
+material
+= frame texture bone texture texture vertex 1.0 frame =
+bone frame 0.500000 frame = -1 anim = bone = -1
+bone 1.0
+0.500000 anim
+bone texture 0.500000 frame
+bone vertex material
+-1 -1 0.500000 material anim
+vertex
+bone frame vertex
+= -1 bone material 1.0
+bone 0.500000 anim bone
+anim material
+= material anim
+vertex = anim
+material
+frame vertex anim bone 0.500000 texture 0.500000 0.500000 0.500000 vertex
+1.0 bone 0.500000 = material frame material
+material anim -1 0.500000 vertex
+bone 0.500000 1.0
+-1 = 0.500000 bone anim -1 material
+= vertex
+vertex
+bone frame
+material bone anim -1 anim anim -1 material =
+texture -1 0.500000 1.0 0.500000 bone
+bone
+1.0 vertex = bone
+frame material 0.500000 anim 0.500000 material texture
+anim
+vertex anim -1 -1
+1.0 -1 1.0
+-1 1.0 frame vertex
+vertex frame
+=
+texture vertex
+material
+texture -1 = bone vertex material vertex 0.500000 -1 material texture =
+frame bone vertex vertex texture material -1
+1.0 =
+vertex
+texture 0.500000 -1 1.0 -1
+anim =
+anim
+vertex vertex texture
+frame frame 1.0 0.500000 material
+texture 1.0
+bone
+=
+texture
+anim texture texture
+anim
+material texture material vertex = material anim
+texture texture
+material vertex
+= bone 0.500000 0.500000 texture frame anim 1.0
+vertex material
+anim vertex vertex vertex 1.0 frame
+0.500000 frame
+-1 -1 material = 1.0 -1 0.500000
+= frame 0.500000
+-1 -1 1.0 1.0 =
+frame anim -1
+1.0 =
+-1 frame
+frame vertex
+= 1.0 0.500000 vertex 0.500000 0.500000
+bone bone anim bone anim bone = -1 material
+bone
+= anim vertex vertex 1.0 frame vertex bone vertex vertex =
+-1 -1 1.0 1.0 bone
+anim
+texture frame
+texture
+0.500000 -1 frame texture 1.0
+1.0
+vertex
+bone vertex
+-1 1.0 material frame material 0.500000
+material material vertex
+vertex
+texture 1.0
+bone material bone texture anim texture material
+material
+texture 1.0 1.0 anim =
+1.0 frame 0.500000
+-1 anim
+1.0 material
+frame 0.500000 texture anim = texture -1 texture
+anim texture 1.0 1.0
+bone
+0.500000 -1 1.0 texture
+frame 1.0 vertex
+bone bone anim 0.500000 anim texture 0.500000 material anim
+1.0 = texture
+anim material anim vertex -1
+frame vertex vertex = 1.0
+anim frame
+= texture frame material
+bone
+texture anim -1
+frame vertex anim 1.0 anim 0.500000 anim
+bone frame vertex material bone bone = -1 = vertex
+0.500000 texture vertex material texture vertex bone
+texture 1.0 frame texture frame
+=
+= 1.0 0.500000
+anim
+frame -1 vertex texture vertex
+anim
+texture
+frame anim 0.500000
+vertex 0.500000 = = bone 0.500000 frame
+bone material -1
+vertex 0.500000 vertex
+bone -1 1.0 frame anim
+-1 anim texture texture
+frame 1.0 bone 0.500000 -1 vertex bone bone
+vertex 1.0 vertex
+-1 0.500000
+frame 1.0
+-1 frame texture
+anim -1 0.500000
+frame
+0.500000 bone
+1.0
+0.500000 -1 1.0 = frame =
+texture bone 1.0 -1 material material 1.0 bone vertex 1.0 frame texture anim anim anim -1
+texture 1.0 material -1
+frame
+=
+texture
+1.0 anim 0.500000 material
+0.500000 -1 anim -1
+0.500000 0.500000 1.0 vertex -1 anim
+bone texture anim
+material
+texture
+1.0 -1 0.500000 = -1 -1
+-1 frame bone 1.0 vertex bone bone = 0.500000 frame
+material -1 vertex 1.0 =
+material = bone
+anim
+= 0.500000 anim texture
+0.500000 anim
+1.0 -1 0.500000 anim anim =
+material
+vertex
+bone bone -1 texture
+1.0 vertex frame
+vertex frame
+-1 = 0.500000 vertex
+vertex material 1.0 anim frame 1.0
+material 1.0
+-1 bone 0.500000 material = material material -1 bone frame
+= -1 bone
+-1 = bone vertex
+vertex 0.500000 1.0 material frame
+bone -1 1.0
+= = 0.500000 0.500000 -1
+vertex
+0.500000 =
+material material
+vertex anim
+bone frame anim anim vertex -1
+vertex frame
+1.0 -1 -1 = anim -1 vertex -1 0.500000 frame vertex
+vertex anim bone 1.0 frame
+= = = 0.500000 =
+texture 0.500000 vertex =
+bone vertex
+anim 1.0
+vertex frame =
+0.500000 -1 = material 1.0 material 1.0 vertex = vertex vertex = -1 bone 1.0 0.500000
+texture
+1.0 -1 = vertex anim bone texture anim vertex anim anim material material
+texture
+material 1.0 frame material material anim frame 1.0
+0.500000 bone -1 -1 0.500000 texture material
+1.0
+material vertex frame bone = 0.500000
+=
+0.500000 =
+frame 0.500000
+texture bone anim 1.0
+texture vertex anim 1.0 anim = -1 anim bone vertex texture = 1.0 vertex anim texture -1 texture
+-1
+anim texture
+anim 0.500000 bone 0.500000 -1 1.0 vertex
+0.500000 anim anim 1.0
+vertex anim -1 bo
\ No newline at end of file
@@ -0,0 +1,96 @@
+frame texture
+material bone
+-1
+texture anim -1 bone
+texture -1 1.0 texture material
+frame texture
+texture -1 anim texture -1 frame
+texture 0.500000 bone material anim texture frame anim 0.500000 0.500000 =
+vertex 0.500000
+0.500000 vertex
+frame
+0.500000 1.0 -1 material anim bone
+bone material
+frame 0.500000 1.0
+1.0 bone
+-1 material
+1.0 frame 0.500000
+bone -1 bone frame vertex anim
+bone bone vertex 0.500000 vertex 1.0 vertex texture 1.0 frame = texture anim
+bone 0.500000 material frame vertex frame anim vertex
+vertex 1.0
+-1 vertex vertex anim texture -1 bone
+vertex
+frame
+vertex texture = bone -1 = bone 0.500000 0.500000 frame
+-1 -1 vertex
+-1 0.500000 bone frame material bone bone -1 -1 0.500000 1.0 anim frame -1
+vertex bone
+-1
+material 1.0 vertex
+0.500000 bone 0.500000 texture bone
+1.0 texture vertex 0.500000 frame = material 0.500000 bone -1
+1.0 material vertex
+frame = vertex bone
+anim texture bone bone 0.500000 vertex
+0.500000 anim
+0.500000
+texture 1.0 0.500000 bone -1 1.0 texture
+vertex 1.0 bone texture anim
+texture =
+texture
+0.500000 1.0
+texture
+0.500000 bone anim = material
+1.0
+vertex anim frame frame = vertex
+vertex frame material vertex anim = anim bone
+anim texture 0.500000 vertex =
+texture
+texture material 1.0 = 0.500000 1.0 material
+= texture
+-1
+0.500000 0.500000 anim vertex = texture
+= = = bone
+material 0.500000 vertex 0.500000
+1.0 bone 1.0
+material anim vertex 0.500000 0.500000 texture 0.500000 = texture texture
+frame material 1.0 vertex
+material texture bone -1 vertex anim bone bone bone anim anim bone frame 1.0 material
+bone =
+1.0
+1.0 1.0 material
+-1
+anim material = 1.0 1.0 texture vertex material
+vertex 1.0 -1 vertex = material texture material =
+bone
+material texture frame bone 0.500000
+0.500000 0.500000 vertex anim
+vertex 1.0 0.500000 material -1 0.500000 texture
+= texture vertex = material 1.0 0.500000
+bone
+vertex
+bone bone 1.0 1.0 frame anim 0.500000 1.0
+anim texture
+1.0
+material
+texture texture 1.0 -1
+frame
+1.0 1.0 0.500000 = bone
+-1 0.500000 frame 0.500000 material 1.0 vertex anim
+1.0 bone
+= texture bone texture 1.0 anim texture
+anim
+= material anim bone bone
+vertex -1
+vertex
+vertex =
+frame bone = material frame
+-1 = 0.500000 bone anim
+1.0 texture = vertex frame frame vertex
+0.500000
+frame = 1.0 vertex frame texture texture vertex anim =
+material vertex =
+vertex anim = material vertex vertex material 1.0 -1 frame anim
+= vertex bone 0.500000 anim 0.500000 material -1 -1 bone
+= -1 anim
\ No newline at end of file
@@ -0,0 +1,95 @@
+frame = frame
+-1 = bone
+vertex
+material =
+material anim
+bone 1.0 anim anim bone vertex anim
+texture -1 anim 1.0
+frame = 0.500000 = 0.500000 0.500000 = = texture
+-1 frame 0.500000
+1.0 bone texture 0.500000 frame 0.500000 frame anim -1 frame
+texture bone = 0.500000
+= bone anim 1.0 -1 material
+0.500000
+frame 0.500000 frame texture =
+1.0 texture material vertex anim
+=
+anim
+1.0
+= = vertex 1.0 -1 bone
+-1 texture anim 1.0 1.0 bone anim vertex -1 1.0 vertex frame 0.500000 anim
+material
+texture vertex texture anim
+bone
+vertex 0.500000
+-1
+0.500000 material vertex frame
+bone texture 1.0 -1 texture 0.500000
+bone texture 1.0
+-1 -1 material bone
+=
+texture texture 0.500000
+anim vertex texture
+anim -1 vertex
+frame 1.0
+vertex anim 1.0
+texture bone frame 1.0
+1.0
+= texture frame -1 texture material vertex anim vertex = 0.500000 anim 1.0 material
+frame vertex
+material
+0.500000 1.0 vertex
+0.500000 vertex
+texture 0.500000 frame 1.0 = -1 frame vertex frame 1.0
+anim
+1.0 material
+-1 -1 material 0.500000 1.0 bone texture
+vertex texture anim frame frame anim material -1
+bone 1.0 material bone
+texture anim texture frame 0.500000 anim 1.0 1.0 -1 1.0 anim 1.0
+frame
+anim material frame
+material 1.0 bone
+anim anim anim bone material
+1.0
+= vertex texture
+vertex 0.500000 material material material 1.0 1.0 texture = = material 1.0
+-1 frame vertex -1 bone -1
+vertex texture -1 bone 1.0 = frame vertex bone
+0.500000 anim vertex
+= 0.500000 frame 0.500000 anim 1.0
+-1 = texture 1.0 texture
+-1 vertex 1.0 frame -1 -1 texture = material anim
+= vertex material
+anim
+bone bone
+vertex 0.500000 frame texture =
+-1
+= vertex -1 bone anim = material 0.500000
+texture
+vertex 1.0 texture
+vertex material -1 anim
+1.0 0.500000 =
+frame
+anim frame vertex = bone bone texture texture 0.500000 bone
+bone anim -1 material
+-1 anim vertex
+frame bone 0.500000 texture 1.0 anim anim
+anim
+texture
+material anim vertex
+texture 0.500000
+1.0 1.0 -1 anim anim 1.0 vertex anim frame
+texture 0.500000
+0.500000 texture 0.500000 bone texture
+frame texture vertex vertex material 1.0 = 1.0 vertex texture 0.500000 bone frame vertex
+bone
+texture material frame bone bone material 0.500000 vertex 0.500000
+= bone
+anim material 0.500000 anim = texture
+0.500000 0.500000 1.0 0.500000 texture texture -1 frame bone bone 1.0 material
+vertex anim material
+frame
+= material anim vertex 0.500000 0.500000 -1 texture 0.500000 bone frame bone frame bone = 1.0
+material bone = anim vertex
+bone
\ No newline at end of file
@@ -0,0 +1 @@
+-1 0.500000 frame -1 frame frame vertex 1
\ No newline at end of file
@@ -0,0 +1,145 @@
+= 0.500000 vertex 0.500000 material texture -1
+0.500000 1.0 anim texture = = 1.0 1.0 material frame -1 1.0
+texture vertex texture =
+bone material
+vertex
+anim vertex
+= bone vertex frame -1 material bone frame 0.500000 = bone
+vertex material -1 material
+material 1.0 vertex 0.500000 1.0 material bone
+-1 -1
+vertex frame texture bone 0.500000
+-1 vertex
+material frame vertex
+= -1
+anim
+frame material texture -1 -1 vertex frame = 0.500000 -1 = anim
+-1 anim vertex material 1.0 frame anim
+bone 0.500000 material
+vertex
+texture anim vertex texture = texture vertex -1
+= 1.0
+texture 0.500000 frame material 1.0 material
+bone
+1.0 = vertex -1 anim anim vertex
+0.500000 texture =
+= 0.500000 = anim
+anim texture frame
+-1 bone =
+frame bone
+vertex =
+1.0 material
+vertex bone
+vertex texture
+anim frame texture
+vertex frame texture
+frame frame
+1.0
+vertex material 1.0 -1 1.0 bone vertex 1.0 frame texture material
+material = 0.500000 anim vertex texture
+material
+-1 texture = vertex 1.0 vertex
+0.500000
+= bone vertex
+texture
+anim anim bone vertex frame bone -1 vertex vertex
+material vertex anim 1.0 0.500000 bone vertex
+frame -1
+texture =
+-1 -1 vertex vertex vertex vertex anim bone 1.0 0.500000 1.0 1.0 anim texture anim 0.500000 =
+texture anim frame
+-1 = material frame anim anim texture = material texture
+bone vertex 1.0 anim frame = texture texture
+= 1.0
+= 1.0 1.0 -1 texture bone frame material
+bone 1.0 = anim
+frame material
+=
+texture -1
+-1 anim
+= -1 anim material vertex vertex vertex frame
+frame texture 0.500000 -1 0.500000 texture texture
+frame -1 = anim
+vertex 1.0 vertex
+= frame
+bone texture -1
+1.0 bone texture frame =
+frame 1.0
+material -1 frame -1
+1.0 frame material
+-1
+=
+texture
+texture bone
+= = -1 1.0 -1
+1.0 bone = frame
+texture frame 1.0 vertex anim bone
+bone texture 0.500000 1.0
+anim
+texture = bone texture
+0.500000 anim bone
+0.500000 0.500000 vertex 1.0 frame
+frame vertex frame 1.0 = 0.500000 texture texture
+-1
+frame material bone texture frame bone 1.0 material anim -1 texture frame texture = = 1.0 frame vertex frame 1.0
+1.0 0.500000 bone frame material material bone vertex 0.500000
+bone 0.500000 frame texture = material anim material vertex -1 bone
+-1 1.0 1.0 -1 1.0
+texture 1.0 anim texture = vertex -1 bone material anim frame -1 material material 0.500000 bone frame anim = texture anim 0.500000 bone =
+texture anim material material 0.500000 = anim
+vertex
+bone -1 vertex
+anim frame
+bone 1.0 material 1.0 texture vertex -1 vertex texture anim
+1.0 vertex = material
+frame
+texture
+1.0 anim material bone vertex bone 0.500000 vertex frame
+= bone
+anim 0.500000 bone 1.0 -1 material bone
+1.0
+texture
+0.500000 material bone = 0.500000 bone anim
+anim frame texture
+frame frame
+texture -1 anim vertex bone
+=
+anim material anim frame frame anim
+vertex = frame texture
+1.0 anim
+0.500000 anim 0.500000 0.500000
+bone material texture 1.0
+anim frame material
+= texture = frame frame 0.500000 anim anim material
+texture = bone
+1.0 -1 1.0 frame texture = anim -1 frame 1.0 -1 anim vertex vertex vertex anim
+material
+vertex
+bone vertex
+-1 -1 material
+-1 0.500000 bone bone bone = bone frame 0.500000 1.0
+-1
+material
+= vertex anim bone frame
+vertex 1.0 anim
+-1 anim
+1.0 1.0 vertex vertex texture material frame
+0.500000
+frame vertex anim -1 = material vertex
+bone
+= bone bone
+material
+frame =
+anim -1 anim
+material anim vertex 1.0 texture 1.0 material 1.0
+-1 texture -1 material vertex 0.500000 anim
+= texture
+vertex frame bone = frame
+1.0 vertex texture
+vertex
+0.500000 anim material -1 vertex -1 anim texture -1 1.0 = 1.0 vertex vertex anim 0.500000 = texture
+1.0 material = frame bone
+frame -1 -1
+vertex 1.0
+anim = frame bone
+vertex 0.500000 = material 1.0 ma
\ No newline at end of file
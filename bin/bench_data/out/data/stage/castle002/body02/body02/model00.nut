@@ -0,0 +1,17 @@
+frame
+bone material vertex
+= = anim -1
+material material
+0.500000 anim
+1.0
+vertex
+vertex material
+frame 1.0 -1 material
+= -1 0.500000 anim material
+bone anim
+= frame
+= material frame vertex
+1.0 anim frame material 1.0 1.0
+frame texture
+frame
+-1
\ No newline at end of file
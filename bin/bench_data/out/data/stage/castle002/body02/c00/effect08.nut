@@ -0,0 +1,13 @@
+frame bone anim bone vertex = -1 material
+vertex frame 1.0 0.500000 1.0 material 1.0 vertex
+vertex 0.500000 1.0 0.500000 1.0
+material = material frame
+1.0
+material = 1.0
+bone texture material texture
+1.0 1.0
+texture = vertex
+= bone frame 0.500000 bone -1
+vertex 1.0
+0.500000
+vertex 0.500000 0.500000 = texture 
\ No newline at end of file
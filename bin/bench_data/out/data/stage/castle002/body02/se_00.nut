@@ -0,0 +1,55 @@
+frame 0.500000 vertex = anim -1
+=
+frame texture material
+material material -1
+frame frame anim frame vertex
+vertex material
+anim vertex frame texture frame anim vertex texture vertex material anim anim
+texture
+frame anim texture = vertex
+1.0 vertex anim =
+frame texture material material =
+texture
+vertex 0.500000 =
+bone bone vertex material
+vertex frame -1 material 0.500000 -1 bone -1 frame
+texture = bone 1.0 texture
+material -1 texture = 1.0
+frame texture
+-1
+anim material texture =
+= vertex bone
+frame texture vertex 1.0 anim bone material = 0.500000 1.0 anim = = -1
+0.500000
+= texture
+vertex bone material
+= material frame 0.500000 anim
+bone -1
+vertex = vertex -1 material bone anim = = frame vertex texture
+0.500000 texture 0.500000 material material = 1.0
+bone material anim material material frame bone
+-1 material anim
+texture -1 frame frame 1.0 bone vertex frame texture
+texture anim 0.500000 anim
+texture anim
+material -1 -1 vertex
+texture bone vertex frame
+1.0 anim texture 1.0 1.0 anim anim
+-1 texture
+anim
+1.0 -1 bone texture
+= texture
+1.0 -1
+texture
+anim 1.0 frame texture vertex frame vertex -1 0.500000 frame anim = texture vertex frame -1 0.500000
+anim texture texture anim vertex
+frame
+material = anim 1.0 texture 0.500000 vertex anim
+bone frame 0.500000
+anim vertex =
+frame
+0.500000 anim bone anim 1.0
+-1 material
+-1 frame -1 = texture vertex
+vertex bone texture texture =
+texture vertex verte
\ No newline at end of file
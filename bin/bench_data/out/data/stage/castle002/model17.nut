@@ -0,0 +1,18 @@
+= 0.500000 bone texture =
+frame = frame material -1 = vertex -1 texture -1 anim =
+= anim 1.0 bone frame bone 1.0 bone anim = = frame vertex material 1.0 material
+vertex texture frame texture
+0.500000 0.500000 bone
+bone material -1 -1 material
+frame
+texture 1.0 bone anim texture frame anim vertex -1 bone bone anim 0.500000
+vertex bone
+anim texture
+anim frame 0.500000 material -1 0.500000 0.500000 0.500000
+-1 texture -1 vertex
+anim 0.500000 bone -1
+-1 bone bone 0.500000 texture frame bone
+bone vertex
+vertex bone
+0.500000 bone bone -1 anim texture
+material anim material bone 1.0 1.0 anim = material bone 1.0 0.500000 f
\ No newline at end of file
@@ -0,0 +1 @@
+-1 vertex bone = vertex vertex vertex 1.0 texture texture material anim 0.500000
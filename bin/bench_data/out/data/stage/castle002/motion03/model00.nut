@@ -0,0 +1,5 @@
+1.0 =
+= anim vertex -1 -1 -1 material material material
+vertex 1.0 bone = 0.500000 = 1.0
+bone = texture 0.500000 -1 1.0 = 1.0 -1
+vertex frame = -1 vert
\ No newline at end of file
@@ -0,0 +1,208 @@
+-1 frame bone 1.0 anim
+anim
+vertex texture 0.500000 0.500000 1.0 -1 material bone 1.0
+0.500000 -1 vertex bone
+1.0 vertex -1 = material vertex vertex anim
+material 0.500000 bone
+1.0 frame =
+bone vertex
+anim texture
+material
+anim anim = anim 1.0 bone bone vertex
+anim 0.500000 1.0 1.0 0.500000 texture 0.500000
+-1 -1
+0.500000 texture material material =
+1.0
+texture
+texture 1.0 material anim bone -1
+0.500000 texture bone texture = 0.500000 = 1.0 texture
+1.0
+1.0 material
+0.500000 material 0.500000 vertex
+= bone texture
+texture vertex
+texture
+texture material
+anim frame texture
+= 1.0 -1 vertex anim 0.500000 anim 1.0
+= texture 0.500000 0.500000 -1
+-1 0.500000 0.500000
+anim 1.0 material anim
+bone
+bone anim
+-1
+texture material anim vertex texture texture
+anim anim material
+frame bone
+0.500000 bone
+bone
+material
+1.0 bone 1.0 1.0 texture -1 texture
+vertex vertex bone 0.500000 -1 bone 0.500000 material anim -1 frame material
+texture vertex 1.0 0.500000 frame 0.500000 -1 frame texture
+1.0 texture bone
+frame 0.500000 frame -1 frame -1 texture = material vertex material frame material 0.500000 texture frame 1.0
+texture
+bone =
+=
+= anim vertex frame 0.500000 material
+= 0.500000 anim
+vertex = texture anim
+frame
+0.500000 vertex -1
+frame vertex material
+1.0 0.500000 -1 vertex
+-1 material material
+texture = texture
+1.0 -1 = material = frame bone -1
+vertex
+vertex
+vertex
+texture = bone = 1.0 vertex 0.500000 texture
+1.0 = 1.0 = -1 vertex 1.0 vertex 1.0 bone bone 1.0
+-1 vertex
+= frame frame 1.0
+material bone = frame vertex
+1.0 material = = 0.500000 =
+vertex -1 texture -1 texture vertex
+material texture -1 material vertex 1.0
+0.500000 vertex -1 = vertex
+vertex vertex = frame texture material 0.500000 = 1.0 vertex -1 texture bone
+= 1.0 = bone
+texture material bone
+material
+-1 bone 0.500000 -1
+texture
+frame 0.500000 anim -1
+-1 anim material material anim frame 0.500000
+1.0 = -1
+bone = material bone 1.0 material
+bone 0.500000 = 0.500000 1.0
+material -1
+material
+material
+1.0 material frame bone material
+bone texture frame 1.0 bone
+bone anim
+bone
+texture anim frame vertex
+-1 0.500000 1.0
+frame
+frame material texture frame
+material bone 0.500000
+-1 texture bone bone 0.500000
+anim -1 1.0 -1 texture 1.0 vertex frame anim
+0.500000 1.0 bone texture texture
+1.0 -1
+anim 1.0 -1 1.0 -1
+texture frame anim material texture
+-1 -1
+bone bone texture material = -1 -1 frame -1 frame anim 1.0 vertex = 0.500000
+1.0 texture
+= frame 0.500000 0.500000 bone 0.500000 anim material texture 0.500000 bone -1
+-1 -1 bone
+bone bone texture texture = -1 material -1 material 0.500000
+= 0.500000
+=
+vertex -1 frame 1.0 texture 0.500000 1.0 vertex anim texture 0.500000 -1 texture
+vertex frame = bone texture
+= -1 = 0.500000
+vertex 1.0 1.0 frame
+0.500000
+frame bone bone
+0.500000 -1
+material
+texture anim texture texture
+material anim bone -1
+frame vertex vertex vertex frame bone frame vertex =
+= frame bone anim
+vertex -1 1.0
+= = texture material 1.0 1.0 vertex anim = vertex texture frame = frame
+anim = = anim texture vertex
+bone
+anim frame frame = vertex 1.0 =
+0.500000
+texture 1.0 anim 0.500000
+-1 1.0 = anim texture
+anim vertex bone anim 0.500000
+1.0 frame texture
+anim bone
+texture = anim
+anim frame vertex -1
+bone vertex = material vertex =
+-1 texture bone
+=
+texture = 0.500000 1.0 =
+bone -1 vertex
+0.500000 material 1.0 0.500000 frame material anim = = frame
+texture texture material vertex vertex
+-1 1.0 frame anim anim anim anim 0.500000
+bone material frame -1 1.0 -1 1.0 material anim bone bone 1.0
+material 0.500000 vertex anim = 0.500000
+vertex 1.0 1.0 -1 anim frame 1.0 -1 bone vertex
+vertex bone
+bone frame vertex anim = anim vertex material
+frame frame material = anim material
+material material
+0.500000 1.0 1.0 material frame bone
+vertex frame
+= -1 = material texture frame material vertex texture anim
+1.0 anim texture
+vertex 0.500000 vertex
+frame = texture frame frame = -1
+anim vertex material
+material frame
+texture -1
+1.0
+material material 1.0 frame 0.500000
+anim bone 0.500000 bone
+material
+anim = 0.500000 texture 1.0 vertex vertex bone
+texture
+texture frame 1.0
+material -1 material 1.0 material material 0.500000 material
+texture = material -1
+vertex -1 frame
+frame vertex = anim 1.0
+texture
+bone material -1 1.0 material = 0.500000 bone
+0.500000 1.0 bone anim frame
+= texture anim 0.500000 =
+anim anim frame bone 0.500000
+material vertex bone texture bone -1 frame texture material material
+1.0
+frame -1
+vertex
+vertex frame anim frame vertex
+1.0
+1.0 material 0.500000 1.0 -1 bone -1
+frame 0.500000 0.500000 material
+=
+frame vertex vertex material
+anim material = vertex
+vertex anim 1.0 1.0 0.500000 bone -1 bone material texture = -1 texture bone 0.500000 texture bone anim bone 1.0 0.500000 material
+material -1 frame anim anim
+0.500000
+-1 vertex material anim anim frame
+texture material texture bone 0.500000
+frame vertex bone = =
+frame 1.0 frame 1.0 texture bone
+-1 = frame texture
+= = vertex 0.500000 texture = bone
+0.500000 0.500000 -1 bone frame material bone anim 1.0 -1 bone 0.500000 material = anim 0.500000
+anim
+anim = = bone = frame vertex anim -1 material
+frame
+texture
+= 1.0 frame 0.500000 -1
+anim material = = -1
+1.0 bone
+material
+0.500000 0.500000
+bone
+= material vertex
+anim
+material material
+bone 1.0 -1
+-1
+materi
\ No newline at end of file
@@ -0,0 +1,17 @@
+frame -1
+bone frame material 0.500000 bone 0.500000
+anim
+bone = bone anim 0.500000 anim =
+frame texture
+material material anim vertex 1.0 0.500000 -1 =
+frame 0.500000 1.0 material vertex vertex frame anim vertex
+vertex 0.500000
+vertex 1.0 vertex frame texture frame
+material anim frame = texture bone frame bone anim
+bone texture bone
+anim vertex =
+material =
+material frame vertex
+vertex -1 -1 anim
+=
+texture 1.0 bone anim 0.500000 frame -
\ No newline at end of file
@@ -0,0 +1,30 @@
+= -1
+anim
+anim frame -1 vertex = 1.0 frame =
+frame bone 1.0
+-1 0.500000 vertex texture vertex
+bone frame = 1.0
+bone bone = bone
+vertex texture frame =
+vertex
+1.0 frame anim anim = = 1.0 texture -1
+1.0 0.500000 -1
+anim bone texture
+= vertex vertex 1.0 = anim anim
+=
+-1 frame frame vertex anim texture bone = vertex = = -1
+0.500000 = texture
+texture
+bone anim 0.500000 material =
+= bone =
+= anim
+vertex
+vertex
+= texture = -1 bone material
+1.0 frame bone texture bone texture -1 material
+frame
+0.500000 0.500000 bone frame
+material
+-1 -1 frame vertex anim =
+0.500000 anim 1.0 0.500000
+fram
\ No newline at end of file
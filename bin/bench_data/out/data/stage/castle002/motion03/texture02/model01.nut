@@ -0,0 +1,128 @@
+vertex
+anim bone
+1.0 0.500000 material vertex
+-1 = vertex 0.500000 frame -1 -1 -1 0.500000 material 1.0 bone anim 1.0 frame
+= 0.500000 bone frame 0.500000
+-1 texture bone -1
+1.0 anim bone bone =
+-1 texture
+material =
+=
+material = material
+vertex vertex material bone material
+vertex -1 bone bone texture
+material -1 anim texture -1 0.500000
+anim
+vertex texture 0.500000 vertex 1.0 material
+= frame texture
+bone vertex texture
+= 0.500000
+bone 0.500000 = 0.500000
+bone
+0.500000
+1.0 0.500000 texture
+material
+-1 0.500000 material texture
+frame = 0.500000
+material
+anim
+texture material texture bone 1.0 bone 0.500000 bone -1 frame 1.0 anim frame =
+anim
+bone -1 texture 0.500000 texture vertex
+= = vertex bone anim bone 0.500000 0.500000 -1
+material
+material texture bone
+material material material material texture
+bone -1 0.500000 = bone vertex vertex
+= =
+bone =
+-1 material texture texture 0.500000
+material texture 1.0 frame 1.0 anim vertex
+frame 0.500000 material 1.0
+bone anim anim 0.500000 frame
+texture texture -1 vertex 1.0 1.0 frame frame vertex -1
+1.0 vertex anim vertex material = texture
+texture texture anim
+anim
+frame
+0.500000
+material texture 1.0 anim
+material 0.500000 anim bone vertex
+bone = anim anim
+= texture anim
+anim 0.500000 -1 frame -1 0.500000 -1 -1
+-1 1.0 -1 texture
+material 1.0 = vertex bone
+= anim = bone texture 1.0 vertex = frame
+1.0 anim
+anim vertex texture 1.0 vertex
+vertex frame material bone
+bone -1 anim material
+1.0 1.0 vertex
+bone =
+-1 frame 1.0 = 1.0 0.500000
+material frame = anim = 0.500000 1.0 frame vertex 1.0 0.500000 = vertex
+bone material 0.500000 material 1.0 1.0 -1
+1.0 0.500000 0.500000 bone = anim
+-1 texture 0.500000
+vertex texture 0.500000 =
+-1 1.0
+= bone 1.0
+=
+1.0 anim 1.0 anim
+0.500000 anim 0.500000
+material -1 texture
+anim
+vertex
+-1 0.500000 anim
+0.500000
+-1
+vertex 1.0 -1 0.500000 texture material
+vertex frame
+anim
+vertex anim
+vertex anim anim 0.500000 0.500000 material
+anim
+texture
+0.500000 -1 texture = vertex vertex
+material
+bone
+vertex =
+frame
+= -1 1.0
+0.500000 anim vertex vertex frame
+-1 texture frame material
+= anim
+bone 0.500000 -1 vertex =
+frame 1.0 texture material
+-1 0.500000 bone material texture 0.500000 anim material material frame bone anim texture -1 vertex 0.500000 vertex vertex 1.0 texture frame 1.0 -1
+1.0 texture
+material
+material 1.0 = bone -1 frame -1
+= 1.0 vertex 0.500000 frame vertex vertex bone
+0.500000 vertex texture 1.0 frame 1.0 texture 0.500000 = vertex 1.0 1.0
+material anim
+anim texture 1.0 -1 texture -1 -1 material
+0.500000 -1 bone texture vertex 0.500000
+material
+1.0 anim frame
+0.500000 bone
+1.0 material
+=
+1.0 vertex anim
+0.500000
+= vertex frame 1.0 texture material
+vertex anim 0.500000 anim
+-1
+-1 anim 0.500000 = texture anim
+-1 frame -1
+1.0 material frame
+-1 1.0 1.0 0.500000 bone 0.500000
+-1 -1 material 0.500000 texture material
+frame 1.0 frame
+anim frame anim
+frame vertex
+frame material 0.500000 frame frame anim material anim = vertex
+1.0
+-1 bone
+material m
\ No newline at end of file
@@ -0,0 +1,3 @@
+=
+vertex material 1.0 material anim -1 anim bone
+0.500000 =
\ No newline at end of file
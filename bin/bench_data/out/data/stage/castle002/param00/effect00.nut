@@ -0,0 +1,3 @@
+1.0
+0.500000 bone frame
+= materia
\ No newline at end of file
@@ -0,0 +1,12 @@
+bone vertex = frame frame material frame 1.0 anim
+anim -1 anim texture = vertex
+1.0
+= 0.500000 texture
+-1
+anim 0.500000 bone
+texture = texture
+vertex
+0.500000 anim bone
+anim bone frame texture vertex 1.0 1.0 = material material 0.500000
+anim 1.0
+anim -1 -1 material ver
\ No newline at end of file
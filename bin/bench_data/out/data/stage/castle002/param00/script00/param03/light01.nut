@@ -0,0 +1,21 @@
+-1 anim bone
+frame material texture vertex frame material bone
+anim 0.500000 bone 1.0 bone 1.0 1.0 vertex
+texture anim
+vertex vertex 1.0 = 0.500000 texture = frame bone = 0.500000 frame 0.500000 bone vertex
+=
+material bone bone frame anim =
+bone 0.500000 vertex = 1.0
+= anim material bone -1 = texture = -1
+vertex texture -1 frame bone anim -1
+texture
+bone = material material vertex texture texture 0.500000
+0.500000 bone
+-1 0.500000 anim 1.0 anim
+frame frame bone
+texture = 1.0 vertex
+frame
+1.0
+frame 1.0 material texture frame bone
+vertex anim material frame bone frame 0.500000 frame
+material frame 0.500000 vertex bone texture 1.0
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000 0.500000 anim texture -1 texture
+1.0 1.0 bone vertex
+bone frame frame
+material -1 bone -1 0.500
\ No newline at end of file
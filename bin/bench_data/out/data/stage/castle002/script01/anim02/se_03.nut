@@ -0,0 +1,124 @@
+bone anim
+vertex
+vertex -1
+1.0 material = anim =
+anim anim bone 1.0 frame material 1.0 vertex
+=
+frame material
+0.500000 1.0
+bone material 1.0 0.500000
+frame =
+material 0.500000 -1 texture 1.0
+bone material anim = -1 -1
+frame 0.500000
+0.500000
+texture vertex
+vertex
+anim texture frame
+vertex material anim -1 material
+material material
+anim material bone vertex = material 0.500000 frame 1.0 1.0 -1 frame anim material vertex -1 frame
+0.500000 -1 texture material texture anim vertex 1.0 0.500000
+anim frame vertex 1.0 -1 0.500000 bone frame -1 -1 0.500000 vertex 1.0 frame anim 0.500000 texture anim bone anim
+bone
+vertex texture frame bone frame material bone anim texture 0.500000 =
+1.0 = 0.500000 frame = frame anim texture material anim frame frame texture
+material 1.0 vertex 1.0 vertex texture 0.500000 frame -1
+1.0 -1 frame
+-1 =
+0.500000 1.0 =
+bone frame -1
+anim 1.0 -1 0.500000 material 0.500000
+material bone
+= 1.0 texture 1.0
+0.500000 texture 0.500000 texture material -1 frame vertex material 1.0 anim texture vertex -1 texture -1 vertex texture frame bone frame
+anim = bone
+1.0 vertex
+material bone frame frame frame 1.0 vertex
+-1 texture texture
+0.500000 material
+texture bone bone
+bone
+material 0.500000
+frame 0.500000 anim texture texture texture
+= anim material frame vertex vertex 0.500000 texture
+0.500000 texture
+bone
+frame vertex = material texture texture vertex 1.0 bone
+bone material
+texture material vertex
+= bone
+texture anim
+frame 1.0 0.500000 0.500000 material
+-1 texture 0.500000 1.0 1.0
+material material = 0.500000 material
+0.500000 material =
+= material -1 0.500000 frame bone texture
+frame
+0.500000 vertex frame
+1.0 0.500000
+1.0 material texture
+texture -1
+bone bone
+0.500000 vertex 0.500000 anim frame vertex vertex = -1 frame vertex anim bone texture
+-1 0.500000 -1
+bone 0.500000
+bone
+texture frame vertex material anim texture 1.0 frame 1.0 anim
+bone 1.0 -1 1.0 0.500000 vertex
+bone 0.500000 texture
+= 1.0 anim = -1
+0.500000 -1 vertex anim -1
+anim -1 vertex -1
+frame frame frame
+vertex texture material -1 anim 0.500000
+1.0 -1 0.500000 = = -1 vertex
+vertex = material
+frame -1 anim anim
+1.0 = bone bone
+-1
+1.0 material
+0.500000
+-1
+anim material
+= vertex anim
+texture frame material vertex
+frame material
+vertex
+material material texture vertex = bone -1
+vertex texture frame -1
+= anim
+=
+1.0
+texture texture frame frame texture -1
+texture anim texture
+anim 1.0
+texture 0.500000 1.0 1.0 material
+frame 0.500000 = anim texture bone
+-1 anim
+bone
+bone -1 0.500000 frame =
+anim vertex texture
+0.500000 material frame
+texture = -1 frame
+material bone 1.0 texture texture 0.500000 anim vertex
+texture bone texture texture 1.0 vertex bone -1 1.0 frame
+material material -1
+bone texture vertex 1.0 -1
+frame
+texture
+0.500000
+= material -1
+-1 frame = -1 material anim material -1 = -1 -1
+anim bone material texture material 1.0 frame bone frame
+-1
+anim 0.500000 = 1.0 frame 1.0
+material bone 0.500000
+-1 bone
+texture frame
+texture
+-1
+vertex bone -1 bone =
+-1 0.500000 frame texture = frame material material
+frame texture material frame 1.0 vertex
+material texture -1 material frame 1.0 -1 vertex fr
\ No newline at end of file
@@ -0,0 +1,29 @@
+frame
+bone
+anim = -1 0.500000 anim vertex 0.500000 anim anim vertex texture
+bone bone
+material vertex
+bone
+vertex anim material = = vertex
+1.0
+bone
+bone
+frame anim texture
+1.0 = vertex 0.500000 -1 texture
+anim anim material texture -1 bone -1 anim
+anim frame
+1.0
+0.500000 texture
+0.500000
+material material bone
+-1 anim anim texture = 0.500000 0.500000
+0.500000 0.500000 = frame -1 = material
+bone material bone bone =
+-1 material = vertex = -1
+bone
+anim 0.500000 -1 0.500000 frame 1.0
+-1
+vertex frame bone anim
+texture frame texture
+-1 0.500000 frame
+anim
\ No newline at end of file
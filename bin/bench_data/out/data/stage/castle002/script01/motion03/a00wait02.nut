@@ -0,0 +1,9 @@
+frame bone 0.500000 1.0
+frame = bone bone texture texture vertex
+vertex = anim = texture bone texture = = 0.500000 0.500000 anim = vertex bone = bone vertex
+-1 0.500000
+vertex
+0.500000
+-1
+frame
+vertex frame = 
\ No newline at end of file
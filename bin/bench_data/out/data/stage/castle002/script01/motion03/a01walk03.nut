@@ -0,0 +1,12 @@
+frame
+0.500000 -1 0.500000 anim frame
+texture
+bone texture
+anim
+texture 0.500000
+bone texture
+-1
+texture 1.0 1.0 anim anim texture 0.500000 anim
+0.500000 = 1.0 0.500000 texture frame -1 1.0 0.500000 frame bone = frame frame
+= 0.500000
+-1 = vertex -1 mater
\ No newline at end of file
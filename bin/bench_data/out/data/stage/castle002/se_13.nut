@@ -0,0 +1,16 @@
+vertex
+frame
+vertex anim -1 anim
+vertex 0.500000 -1
+vertex
+vertex vertex
+= bone bone anim 1.0
+material 0.500000 material
+vertex vertex
+vertex -1 vertex material 0.500000
+0.500000 frame = frame
+bone frame bone 0.500000 = bone -1 vertex
+-1 1.0 anim -1 1.0 = texture 0.500000 material texture vertex
+texture
+0.500000
+material material vertex bone texture anim = texture texture textu
\ No newline at end of file
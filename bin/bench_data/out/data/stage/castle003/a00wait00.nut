@@ -0,0 +1,186 @@
+anim bone
+texture anim
+-1 1.0 =
+anim bone 0.500000 1.0 1.0
+texture
+-1
+material bone
+0.500000
+bone bone bone
+1.0
+anim bone 0.500000 -1 = anim
+bone bone
+0.500000
+=
+1.0 1.0
+1.0 anim texture texture
+frame bone vertex frame material frame
+texture
+0.500000
+1.0
+vertex 1.0
+anim texture
+vertex
+texture texture anim anim
+bone
+frame vertex vertex anim
+vertex
+-1 =
+texture anim vertex = 1.0 0.500000 -1
+vertex
+vertex = 1.0 texture anim -1 1.0
+vertex material
+-1 bone
+-1
+frame
+frame = material
+anim material vertex
+1.0 frame
+texture
+material -1
+texture
+texture
+1.0 material = -1 -1
+0.500000 frame vertex anim
+0.500000 1.0 bone bone frame
+bone vertex vertex 1.0 vertex -1
+0.500000
+frame = 0.500000 -1 bone
+material = material
+=
+= vertex = 1.0 material vertex anim vertex
+texture 1.0 material anim
+texture anim
+vertex material 0.500000
+=
+=
+anim
+bone = -1
+1.0 anim bone
+vertex vertex material
+frame material vertex -1 frame -1
+-1 anim material material vertex 1.0 material =
+0.500000 anim
+anim material
+0.500000 1.0 0.500000
+= = 1.0 -1
+= =
+= 0.500000 1.0 = 0.500000
+frame anim
+bone 0.500000
+material
+frame texture = 1.0 bone bone material 0.500000 =
+=
+texture bone
+bone
+vertex texture material texture frame = bone 1.0 material
+anim bone 1.0 material
+material 1.0 frame = 1.0
+texture vertex
+bone
+= 0.500000 vertex
+vertex 0.500000 frame 1.0 frame bone =
+= frame vertex -1 anim -1
+frame frame
+bone texture vertex vertex
+-1 material
+= 0.500000
+0.500000 1.0 anim bone frame vertex
+material material anim texture
+0.500000 -1 bone frame bone
+= vertex anim -1 vertex material 1.0 anim = 1.0
+1.0
+1.0 frame 0.500000
+-1
+material vertex = vertex frame anim 1.0 vertex
+1.0 texture material frame frame
+1.0 vertex vertex 0.500000 -1 anim material material bone texture = frame bone anim
+0.500000
+anim anim
+bone bone texture -1 vertex material
+vertex =
+material anim frame bone vertex bone anim frame bone bone material texture material 1.0 1.0
+= 1.0 1.0 0.500000
+frame anim anim material anim
+= bone
+1.0
+= material =
+vertex texture
+material frame texture
+texture
+bone
+vertex bone
+= material 1.0 frame 1.0 anim 0.500000 -1 0.500000 material =
+-1 bone vertex frame
+texture 0.500000
+1.0 bone texture
+1.0
+0.500000 vertex frame 1.0
+material -1 bone
+1.0 -1 texture vertex texture
+texture texture 1.0 material -1 -1 vertex
+anim
+1.0 0.500000 -1 vertex frame 1.0
+-1 bone
+vertex anim texture = frame 1.0
+1.0 bone
+1.0 =
+bone texture
+=
+= vertex material anim
+1.0 texture 0.500000 = bone bone = anim
+anim
+anim bone material
+anim material -1 = frame vertex
+anim texture
+vertex bone material
+texture
+material texture
+frame texture =
+bone material = material frame = =
+vertex
+anim frame = material bone
+frame 1.0
+texture
+texture 1.0 material 1.0 texture bone -1 texture anim
+0.500000 anim vertex = 1.0
+-1
+texture texture 1.0 0.500000 -1 0.500000 =
+0.500000 bone frame
+bone
+material
+bone
+material 1.0
+texture vertex
+anim bone 0.500000
+0.500000 frame vertex vertex 0.500000
+vertex 0.500000 bone
+0.500000 material texture anim vertex
+texture 0.500000
+1.0 -1 -1 = 0.500000 -1 bone
+-1 0.500000 frame bone
+-1
+material bone = frame
+1.0 material 0.500000 0.500000 frame
+vertex
+0.500000 = 1.0 bone -1
+= bone anim frame frame
+vertex 0.500000 texture anim
+texture vertex vertex
+anim -1 texture = 0.500000 -1 1.0 = -1 = vertex
+anim frame 0.500000 -1
+1.0 0.500000 -1 texture anim = frame 0.500000 frame material
+anim material texture frame anim material frame material frame -1 texture 1.0 vertex = bone texture anim
+vertex texture frame frame
+texture -1 = -1
+texture 1.0 -1 anim
+material =
+anim -1
+=
+material
+texture
+material texture material vertex -1 0.500000 frame
+frame 1.0 vertex 1.0
+1.0 vertex = 1.0
+bone frame bone frame vertex -1 1.0 0.500000 -1 material = anim -1 0.500000 material anim texture -1 bone -1 = anim
+bone material fram
\ No newline at end of file
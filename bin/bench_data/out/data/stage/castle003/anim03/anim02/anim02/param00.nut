@@ -0,0 +1,2 @@
+bone material
+1.0 = 0.500000 texture
\ No newline at end of file
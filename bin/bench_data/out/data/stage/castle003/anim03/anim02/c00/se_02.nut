@@ -0,0 +1,217 @@
+material bone anim
+anim
+0.500000
+frame 0.500000
+= =
+texture = anim 0.500000 0.500000
+vertex frame vertex
+0.500000
+frame texture texture bone bone bone
+frame = vertex
+material material bone vertex
+texture
+anim texture = texture frame frame frame = frame =
+-1 frame bone material
+vertex material texture frame
+vertex 0.500000 1.0 vertex -1 = bone bone bone = = bone
+1.0
+0.500000 frame bone
+0.500000 texture frame material -1 texture -1
+vertex 1.0 bone vertex
+frame texture 0.500000 bone
+0.500000 frame
+-1 -1 1.0 frame anim 1.0 0.500000 anim vertex
+= -1 frame vertex bone material
+vertex
+texture bone texture
+material
+frame bone -1 anim
+-1 vertex 1.0
+0.500000 bone
+material anim
+anim -1 1.0 texture 0.500000 material 0.500000
+0.500000 material vertex texture frame
+bone = texture vertex frame
+texture texture 1.0 anim
+-1
+material
+= = texture frame bone bone frame 1.0 bone material = vertex
+material anim texture texture =
+vertex
+-1
+anim texture -1 texture vertex
+= texture frame frame
+texture 0.500000 vertex material material 1.0 anim anim
+1.0 texture anim 0.500000
+bone anim
+vertex
+anim material 0.500000 material frame
+=
+material bone material bone vertex frame -1 texture -1 vertex -1 anim material
+material bone bone -1 -1
+-1 0.500000 texture 0.500000
+1.0
+frame
+vertex = bone vertex = frame 1.0 vertex =
+material material material anim frame -1 1.0 0.500000 1.0
+0.500000 frame
+vertex frame
+0.500000 anim 1.0 bone material
+vertex bone vertex
+0.500000
+bone frame
+frame
+vertex =
+frame
+0.500000 -1
+1.0 material texture
+vertex anim 1.0 bone -1 texture =
+-1 frame bone
+bone bone
+-1
+=
+bone 1.0 texture frame material anim frame frame anim
+anim 1.0 -1 = 1.0
+texture 1.0
+1.0 texture 0.500000
+= frame
+1.0 -1 vertex material frame bone
+vertex
+=
+bone material 1.0
+material
+bone
+texture
+frame anim = anim 1.0 = = = = frame material vertex -1
+texture 0.500000 1.0 material
+0.500000 = material texture = texture -1
+frame = material anim 0.500000
+= = texture
+0.500000
+material 1.0 0.500000 = material bone = =
+vertex texture 1.0 0.500000
+material 0.500000
+anim texture =
+frame bone
+anim 1.0 0.500000 texture texture anim
+1.0
+1.0
+1.0 1.0 0.500000 = material anim
+bone
+= anim anim bone
+material bone
+texture 0.500000 frame 0.500000 -1 -1 = bone material vertex material bone bone 1.0 0.500000 = =
+texture bone anim
+material = texture material vertex bone material texture material
+bone 0.500000 -1 1.0 0.500000 0.500000 -1
+material texture 0.500000
+vertex 1.0 0.500000 texture material
+bone -1 1.0 material
+frame bone anim
+anim
+1.0 vertex 0.500000
+vertex texture -1 bone material anim
+= frame anim
+texture
+1.0 anim
+vertex
+anim texture
+material frame frame texture anim texture
+texture -1 vertex 0.500000 1.0 -1 anim frame texture
+= 1.0
+-1 texture anim 0.500000 0.500000 vertex
+1.0 frame 0.500000 = vertex 1.0 bone material 0.500000 =
+bone vertex
+bone = anim
+anim
+0.500000 frame frame
+vertex
+frame 1.0 anim anim
+anim material
+texture frame anim
+= bone
+bone
+1.0 0.500000
+texture frame
+vertex
+anim -1 material
+vertex anim =
+0.500000 0.500000 texture material
+bone bone
+-1
+frame 0.500000
+= =
+anim = bone = -1 1.0 -1
+texture vertex
+bone 1.0 anim = frame bone 1.0 material bone vertex material
+vertex
+material vertex vertex 0.500000 anim -1 frame = bone texture
+vertex texture
+bone anim frame -1 texture bone 1.0 anim
+anim = vertex frame
+= texture bone
+frame
+frame
+anim
+1.0 -1 -1
+texture =
+frame
+anim
+vertex
+-1
+0.500000
+bone =
+1.0 bone frame bone bone -1 anim vertex anim frame bone 0.500000 bone frame
+material
+vertex bone
+material 1.0 material = anim -1
+vertex bone
+1.0 texture 1.0
+bone
+1.0 =
+material = bone
+vertex = material
+material frame material =
+1.0
+material 0.500000 anim bone bone -1 -1 texture = anim vertex vertex 1.0 -1 0.500000 0.500000 vertex frame anim texture -1
+vertex
+-1 -1 anim texture anim = texture 1.0 vertex
+frame = 1.0 material anim anim = frame anim
+texture -1 vertex -1
+0.500000 anim frame
+-1 = texture bone bone 0.500000 = 1.0 =
+anim material 1.0 bone vertex 1.0 texture
+1.0 material 1.0
+= = anim
+0.500000 texture bone = vertex
+-1 bone
+anim = material texture -1
+1.0 material material -1 = vertex
+1.0 -1 frame texture
+frame anim
+1.0 material
+= 0.500000 material vertex frame =
+1.0 vertex
+frame -1 texture anim anim vertex texture frame = 0.500000
+-1 frame
+material bone
+vertex vertex 1.0 1.0 1.0
+vertex anim material 1.0 bone
+material vertex texture
+1.0 texture vertex bone 0.500000 0.500000
+frame 0.500000
+vertex vertex -1 0.500000 frame
+anim material bone 1.0 -1 -1 0.500000 =
+texture vertex
+anim material vertex 0.500000 texture texture bone
+vertex bone vertex 0.500000
+1.0
+bone
+1.0 material
+texture frame = texture bone vertex bone frame material material 1.0 frame frame 1.0 anim frame = texture frame
+frame
+1.0 = material -1
+-1 material = bone texture bone = -1
+= texture bone vertex
+-1 frame
+= frame texture = 0.500000 1.0 anim -1 anim bone material -1 vertex ani
\ No newline at end of file
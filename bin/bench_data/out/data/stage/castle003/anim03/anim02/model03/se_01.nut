@@ -0,0 +1,9 @@
+bone vertex
+vertex -1 texture material
+= -1 0.500000 texture bone texture 0.500000
+1.0 frame material frame 1.0 =
+frame
+material anim -1 anim
+frame frame texture = texture -1 anim
+vertex texture 1.0 bone 0.500000 material
+= -1 anim 1.0 vertex -1 0.500000 vertex 0.500000 -1 
\ No newline at end of file
@@ -0,0 +1,51 @@
+1.0
+vertex
+= bone -1 vertex frame
+0.500000
+0.500000 bone
+frame 1.0
+= 1.0
+material anim anim -1 material bone vertex bone texture texture vertex texture
+vertex
+1.0 texture anim material -1 1.0 bone texture 0.500000 anim 0.500000
+texture
+frame frame =
+vertex frame material
+vertex bone = frame 0.500000 texture anim material frame -1 texture bone 1.0 frame
+-1
+vertex texture -1
+frame frame material
+texture = vertex 1.0 bone
+anim frame 1.0
+anim material -1 vertex
+-1 bone -1 -1 anim texture
+0.500000
+1.0 0.500000 frame
+-1 bone
+anim
+-1 = = frame vertex texture
+texture = material
+texture anim
+-1 anim = texture
+frame material
+frame
+bone -1
+material material 0.500000
+= vertex bone vertex
+frame frame -1 bone
+1.0 anim 0.500000
+material 0.500000 = -1
+frame texture 0.500000 -1 0.500000 texture
+texture
+bone
+vertex
+0.500000 texture vertex
+vertex anim material material
+bone = anim -1 1.0 0.500000 texture 1.0
+bone -1 frame vertex frame -1
+bone 0.500000 material vertex 1.0
+vertex
+= anim material
+vertex
+vertex texture
+vert
\ No newline at end of file
@@ -0,0 +1,173 @@
+material -1 bone anim anim 1.0 frame
+frame
+= vertex
+1.0 vertex 0.500000 texture texture 1.0 = bone
+0.500000 =
+bone 0.500000
+material 0.500000 0.500000
+-1 = frame anim anim
+texture
+anim 0.500000 vertex -1 bone frame -1
+vertex =
+1.0 -1 anim -1 frame -1 vertex
+0.500000 anim frame material bone
+0.500000 material 0.500000
+texture
+material
+-1
+vertex
+material 0.500000 anim
+=
+0.500000 anim bone frame bone bone texture anim -1 bone -1 1.0 0.500000 bone 0.500000 anim bone
+0.500000 anim = -1 vertex frame
+= anim bone texture bone
+1.0 =
+texture anim texture anim frame material 0.500000
+material
+1.0 texture 0.500000
+material
+1.0
+frame =
+1.0 texture
+vertex
+bone 1.0 vertex
+anim -1 -1 material
+bone -1
+material material 1.0 bone 0.500000 vertex frame frame 1.0 =
+1.0 = 0.500000 0.500000 -1 material vertex frame frame
+= frame bone -1 -1
+frame anim -1 -1 vertex texture
+bone 1.0 =
+= = =
+bone vertex
+1.0 texture = 0.500000 = frame vertex = frame 1.0 vertex material bone 1.0 -1 vertex -1 -1 1.0
+frame 1.0
+0.500000 = 0.500000 -1 0.500000 = 0.500000 vertex 1.0 frame vertex bone bone 1.0 = anim
+-1 bone vertex
+-1 bone anim anim
+frame bone -1 bone
+= -1 frame frame = -1 = anim texture 1.0 = 1.0
+frame vertex
+material vertex texture vertex =
+bone
+material frame vertex
+vertex
+frame vertex anim -1 frame
+texture = -1
+1.0 anim frame frame texture material texture 0.500000 vertex -1 1.0 material
+vertex 1.0 material vertex vertex texture
+vertex anim
+anim 1.0 frame frame -1 0.500000 vertex material 1.0 texture
+= texture = anim
+frame
+0.500000
+1.0 material frame
+frame
+1.0 material 1.0 material bone texture
+1.0 1.0 material material texture vertex material -1
+anim bone material frame vertex = material 1.0
+bone anim material 1.0
+-1 -1
+0.500000 vertex frame
+material 0.500000 bone texture
+vertex texture
+0.500000 1.0 -1 0.500000 vertex texture
+-1 material
+texture
+1.0 material frame -1 material
+frame frame
+frame 1.0 0.500000 material anim material = material 1.0 material anim 0.500000
+frame bone texture frame
+vertex material
+anim material 0.500000 frame 0.500000 material 0.500000
+vertex
+frame texture
+frame
+frame 1.0
+0.500000 anim 0.500000 0.500000 material texture material texture = = bone anim frame frame vertex = material 0.500000 -1 material
+frame
+-1 = -1 1.0
+bone
+vertex anim bone = material -1 vertex
+bone -1 texture material texture anim texture anim bone bone bone 0.500000 texture -1 bone
+frame
+anim -1 texture = bone -1
+frame material frame 1.0 anim texture anim
+bone -1 0.500000 bone = -1
+1.0
+0.500000 texture frame
+anim -1 bone
+frame anim 0.500000 = -1 bone
+texture =
+vertex
+0.500000 -1
+-1 0.500000
+frame
+= =
+anim
+vertex 1.0 0.500000 texture texture
+anim = frame
+texture texture
+anim
+-1 material texture
+material texture anim
+vertex
+anim frame = vertex = frame bone anim
+anim
+material texture vertex anim
+bone
+= bone 0.500000 frame frame
+frame texture
+anim bone frame texture 0.500000 material material material vertex
+bone -1
+= material
+1.0 bone
+0.500000 1.0
+anim =
+= -1 vertex 0.500000 bone
+1.0
+-1 texture anim 0.500000 0.500000 frame material = bone frame bone frame vertex =
+texture
+=
+frame vertex
+1.0
+0.500000 frame
+material 0.500000
+1.0
+-1 vertex
+vertex texture 1.0 frame 1.0
+= frame
+1.0 texture material
+anim = =
+bone
+vertex = vertex
+0.500000
+anim
+anim frame
+bone =
+= 0.500000 anim
+anim =
+-1 anim material frame -1 material = -1 material
+bone bone bone
+bone
+bone texture 0.500000 = texture
+texture material anim bone
+1.0 texture vertex texture frame
+vertex = anim
+texture frame
+anim 1.0
+bone
+= vertex
+0.500000 = vertex bone -1 =
+texture -1 bone -1 material anim 1.0
+-1 1.0
+1.0 vertex = -1 anim
+=
+vertex -1 -1 texture
+vertex
+vertex
+vertex anim = = bone frame = frame anim
+0.500000 -1 texture frame frame material bone bone 0.500000 = frame vertex frame 1.0
+=
+anim
+material -1 texture texture = bone material
\ No newline at end of file
@@ -0,0 +1,22 @@
+texture frame
+texture
+texture -1 texture bone
+vertex bone frame
+= anim vertex vertex -1
+= 1.0
+frame -1 1.0
+= texture 0.500000 frame
+1.0 anim = bone vertex texture -1 1.0 vertex
+vertex anim 1.0
+texture frame material 0.500000 anim material anim anim material
+texture 0.500000 texture -1
+anim texture =
+0.500000
+anim 0.500000 anim
+material vertex material frame texture frame material material 0.500000 1.0
+bone
+= anim 0.500000 material
+bone
+-1 1.0 0.500000 -1 bone material
+texture frame texture 1.0
+anim t
\ No newline at end of file
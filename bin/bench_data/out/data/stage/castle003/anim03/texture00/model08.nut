@@ -0,0 +1,21 @@
+texture 0.500000 0.500000 0.500000 texture
+-1
+vertex
+= 1.0 frame -1 vertex
+bone anim
+frame
+1.0
+texture
+frame 0.500000 anim texture material
+texture frame 0.500000
+texture
+material
+texture 1.0
+= bone
+vertex 1.0
+bone 0.500000 1.0 1.0 bone 1.0 texture vertex frame frame bone
+1.0 bone -1 1.0 frame = vertex
+texture = vertex anim
+anim 0.500000
+= frame texture
+vertex 1.0 -1 anim -1 -1 anim fr
\ No newline at end of file
@@ -0,0 +1,13 @@
+anim bone
+material 1.0
+= material -1 material bone material vertex 1.0
+texture = anim material
+texture texture frame anim frame -1 texture frame
+-1 bone frame vertex
+bone
+1.0
+vertex 1.0 -1 vertex texture texture
+texture 0.500000 =
+anim -1
+= = 1.0 0.500000 anim vertex texture
+bone = 1.0 anim tex
\ No newline at end of file
@@ -0,0 +1,33 @@
+vertex = texture texture anim bone -1 bone 1.0
+bone 0.500000 texture vertex texture material
+=
+0.500000 1.0 0.500000 anim anim 1.0 vertex
+vertex
+vertex frame bone bone
+0.500000 vertex -1
+anim material vertex bone
+bone material vertex texture texture bone = anim bone
+frame bone
+bone -1 1.0 material -1 bone
+-1 texture 1.0
+= vertex material material 0.500000 0.500000
+vertex bone -1 bone 0.500000 =
+vertex anim texture -1 anim
+bone 1.0 bone vertex
+frame material anim
+bone bone vertex
+bone vertex bone
+anim frame 1.0 bone = -1 1.0 1.0 texture 0.500000 -1 0.500000
+vertex bone texture texture
+= 0.500000 0.500000 material frame 1.0 frame material anim -1
+anim
+1.0 material texture
+-1 1.0 -1 anim anim vertex
+anim bone 1.0
+-1 texture 0.500000 frame vertex
+frame 1.0 anim =
+bone -1
+anim frame texture vertex
+-1 texture 0.500000 = bone texture anim texture anim
+-1 anim material frame frame vertex 0.500000 vertex vertex 0.500000
+0.500000 -1 -1 frame b
\ No newline at end of file
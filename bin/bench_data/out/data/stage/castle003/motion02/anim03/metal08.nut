@@ -0,0 +1,56 @@
+1.0 =
+1.0 = material frame frame anim 0.500000 texture texture
+bone 1.0 0.500000
+vertex = =
+= frame
+texture bone 0.500000 1.0 anim
+texture
+0.500000 1.0 material texture vertex
+1.0 bone vertex
+bone frame vertex anim material bone frame vertex material
+= anim bone
+anim
+material anim -1 1.0 anim bone 1.0 -1 1.0 0.500000 0.500000
+frame
+material -1 anim anim
+-1 frame material
+-1 anim anim material frame anim vertex texture texture
+texture
+0.500000
+1.0 bone = vertex vertex = bone
+1.0
+frame 1.0 1.0 frame 0.500000 vertex anim -1
+-1 bone 1.0 = frame frame 0.500000
+-1
+bone -1 -1 -1 material
+= -1 = texture 1.0 = -1 frame = -1 bone
+-1 material frame
+=
+vertex
+bone material = texture 1.0
+material
+material 0.500000 0.500000 anim texture 0.500000 0.500000 frame
+= texture material
+material vertex frame -1 frame = 1.0 =
+vertex
+0.500000 texture bone
+frame texture vertex -1 frame = frame material texture material bone anim -1 -1
+0.500000 frame
+-1
+texture
+frame = frame material texture bone
+= vertex texture vertex material
+vertex texture bone
+frame
+vertex anim
+1.0 = =
+frame material
+material -1 0.500000 -1
+texture 1.0 1.0
+anim anim bone
+material vertex 0.500000
+material
+texture texture anim anim vertex
+bone anim material anim anim = frame frame vertex 1.0 anim = vertex material 0.500000 1.0 frame bone texture 0.500000 anim = texture anim texture material vertex frame 0.500000 1.0 = vertex 0.500000
+vertex frame
+bone vertex texture 1.0 texture anim material bone -1 1.0 = vertex bone texture t
\ No newline at end of file
@@ -0,0 +1,222 @@
+1.0 bone frame 0.500000 anim anim
+material vertex
+1.0
+-1 anim vertex = vertex anim 0.500000
+0.500000 vertex
+anim 1.0
+frame frame anim
+1.0 = -1
+bone
+1.0 1.0 frame
+bone = material
+= material
+0.500000 vertex 0.500000 = bone
+-1
+-1 anim -1 bone
+texture -1
+frame
+= material -1 = texture 1.0 vertex frame frame frame texture frame 0.500000 1.0 anim bone texture texture vertex -1 = -1 frame -1
+1.0 vertex anim -1 -1 frame 0.500000
+vertex frame
+bone
+= vertex material texture
+= =
+vertex 1.0 frame
+texture -1 1.0 bone texture bone
+texture material frame 0.500000 anim material = -1 1.0
+anim
+1.0
+bone material
+texture = 0.500000 material 1.0 material vertex texture texture frame frame 1.0 material
+= bone
+bone vertex frame
+0.500000
+material
+frame
+bone = vertex texture
+= frame frame = 0.500000 frame texture texture texture
+anim -1 1.0
+anim -1 -1 anim = anim = -1 vertex vertex 1.0 0.500000 vertex
+bone = material 0.500000 = texture anim 0.500000 0.500000
+frame
+bone
+1.0 0.500000 frame
+0.500000 = texture frame material
+material vertex -1 0.500000 frame
+1.0
+frame
+=
+1.0 vertex material
+1.0 texture material 0.500000 material 0.500000 material =
+texture
+material
+= = 1.0
+anim material
+bone -1 anim
+vertex 0.500000
+bone
+material 0.500000 anim texture bone material anim -1
+= vertex frame
+0.500000
+vertex frame bone = = anim vertex material 0.500000 frame
+vertex anim material =
+material
+0.500000
+material frame
+anim texture frame
+1.0 anim anim vertex material
+anim
+vertex 1.0 bone -1
+material
+material anim
+-1 = anim
+0.500000
+1.0 0.500000 texture 0.500000 = vertex texture material vertex -1 = frame vertex
+= 0.500000 bone texture =
+1.0 bone material 0.500000 1.0 1.0 texture material vertex anim -1 =
+vertex material -1 frame bone frame anim
+-1 texture -1 1.0 anim
+=
+1.0 vertex
+bone 1.0 = vertex frame = material frame
+material texture 1.0 anim 1.0 bone
+bone vertex bone -1 texture = -1 = =
+bone bone
+texture vertex = 1.0 anim
+bone = material 0.500000
+texture
+-1 = -1 frame frame vertex 0.500000 -1
+-1
+0.500000 bone 0.500000
+vertex
+anim anim vertex texture bone 1.0 -1 -1
+-1
+frame
+= frame =
+=
+anim
+0.500000 vertex texture vertex 1.0 texture
+0.500000 bone 1.0 0.500000 0.500000
+frame bone vertex -1 1.0 = material material 1.0
+material
+texture = frame
+frame
+-1 texture texture
+anim = = texture material 0.500000
+0.500000
+= vertex
+material
+anim frame
+-1
+anim bone
+bone -1 -1 texture
+bone vertex 1.0 texture
+bone bone = 1.0
+= material
+anim
+0.500000 0.500000 0.500000
+-1
+anim 1.0 1.0 texture material anim 0.500000 material material 1.0 1.0 material bone texture -1 0.500000 1.0
+texture 1.0 0.500000 material
+texture
+anim
+1.0
+bone texture
+-1 frame 1.0 -1
+material
+-1 material anim = 0.500000 = anim = 1.0 frame -1 frame = frame -1 texture = anim frame
+0.500000
+material 0.500000
+0.500000 anim = 1.0 anim
+1.0 0.500000 frame texture bone
+vertex vertex = 0.500000 =
+anim frame texture
+texture anim vertex frame
+vertex -1 anim -1 vertex
+anim -1 vertex 0.500000 anim anim bone texture material bone material bone
+texture 0.500000 = 0.500000 material = =
+1.0 texture 1.0
+material vertex material = = -1 bone = anim frame frame 1.0 = texture vertex
+material frame 0.500000 =
+bone 1.0
+frame
+vertex frame texture frame anim frame -1 frame anim
+1.0 anim texture frame = -1
+-1 texture
+anim 0.500000 vertex 1.0 1.0
+0.500000 = frame frame anim texture -1 1.0 0.500000 bone material vertex
+bone -1 vertex
+frame 1.0
+bone texture = 1.0
+bone vertex anim frame bone
+vertex
+material
+1.0 = material texture material anim frame 1.0 1.0
+texture = vertex
+vertex
+frame
+texture -1 bone
+frame vertex vertex vertex material 0.500000 bone -1
+anim
+1.0 texture 0.500000
+= material 1.0 frame 1.0 vertex texture 0.500000 material
+=
+frame 0.500000 frame 0.500000 = vertex texture
+1.0 0.500000 texture bone anim -1 anim bone
+bone
+= anim 1.0 bone vertex vertex 1.0 vertex
+bone vertex
+-1 anim
+bone anim frame
+bone anim anim 1.0 0.500000 frame bone
+material texture
+bone =
+0.500000 0.500000
+1.0 -1
+=
+= anim vertex
+= texture material bone anim -1 texture 0.500000
+texture bone material
+texture anim bone vertex -1
+frame texture vertex
+= material vertex texture frame anim texture material frame -1 frame
+= 0.500000 anim 1.0 material bone texture texture
+material 0.500000 bone frame
+0.500000 frame anim
+1.0 texture
+material anim -1
+bone -1 vertex bone anim
+frame -1 texture texture 1.0 anim bone 0.500000
+1.0 1.0
+material 0.500000
+anim
+0.500000
+material material 0.500000 0.500000
+bone 1.0 anim 0.500000 texture anim material bone texture texture = material
+= material = 1.0
+0.500000 anim material 0.500000 1.0
+1.0 1.0
+0.500000 anim
+anim frame =
+0.500000 1.0 anim
+texture frame
+anim vertex 1.0 texture vertex material 1.0 material
+-1 vertex bone 1.0 bone
+bone material
+bone vertex
+bone texture 1.0 = 0.500000 = 0.500000
+vertex frame -1 1.0 -1 material = texture
+-1 material bone
+frame vertex bone
+-1 -1 anim texture vertex -1 texture -1
+1.0
+anim 0.500000
+vertex 0.500000 texture anim
+0.500000
+bone texture vertex 0.500000 material material texture bone bone bone anim material material =
+bone
+-1 frame -1
+0.500000
+frame = 0.500000 anim material 0.500000
+= frame 1.0 0.500000 frame =
+-1 
\ No newline at end of file
@@ -0,0 +1,9 @@
+-1 -1
+anim frame material anim
+material texture texture frame 0.500000 = bone -1 0.500000 vertex texture vertex 0.500000 anim 1.0 frame -1 material frame
+=
+1.0
+material texture
+frame
+material -1
+-1 1.0 anim 
\ No newline at end of file
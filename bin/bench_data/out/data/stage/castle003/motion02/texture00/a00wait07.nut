@@ -0,0 +1,8 @@
+material = material
+vertex frame
+texture 0.500000
+material bone anim anim frame
+anim
+vertex vertex material -1 material -1 bone anim 1.0 material
+material 1.0 1.0 0.500000 anim
+anim material
\ No newline at end of file
@@ -0,0 +1,56 @@
+0.500000 1.0
+anim vertex
+bone
+1.0 0.500000 frame
+anim frame 1.0 frame 1.0
+= 1.0 anim -1 bone
+bone 0.500000 bone material = 0.500000
+0.500000
+0.500000
+frame
+vertex
+1.0 vertex 0.500000 bone -1 material
+texture -1 0.500000 anim 0.500000 = 1.0
+-1
+material 1.0 bone
+anim
+vertex 0.500000 material -1 -1
+-1 1.0 texture material
+0.500000
+anim = vertex bone 0.500000
+bone -1 anim
+-1 frame 0.500000
+frame
+1.0
+0.500000 frame material
+-1
+material 0.500000
+= 0.500000 -1 0.500000 material vertex
+frame material bone frame -1
+frame -1 frame
+=
+anim
+anim vertex material 0.500000 frame anim vertex texture
+material vertex bone bone frame bone 1.0 1.0
+frame
+=
+vertex
+bone vertex 1.0 1.0
+= material
+-1 vertex bone 0.500000 bone
+material = = 0.500000 material frame
+1.0 -1
+1.0 vertex
+1.0 = anim anim frame material = 1.0 vertex
+anim 1.0 frame material
+material =
+anim material 1.0 anim -1
+anim =
+material 0.500000 -1 bone 1.0
+frame =
+texture
+0.500000 0.500000 -1 =
+0.500000 bone = bone
+frame anim -1 vertex material
+vertex
+material vertex
\ No newline at end of file
@@ -0,0 +1,95 @@
+bone
+1.0
+-1 texture
+anim material 0.500000 = -1 texture 0.500000 anim frame material 0.500000 bone
+vertex
+anim vertex frame anim -1 -1 1.0 vertex texture texture
+vertex -1 1.0 texture -1 = vertex material -1 bone texture frame bone 1.0 0.500000 0.500000 = material material vertex -1 0.500000 = -1 material
+-1 vertex frame bone 0.500000 material frame material = frame
+=
+=
+0.500000 1.0 texture = bone anim anim texture vertex
+-1
+= 1.0 texture vertex 1.0
+texture -1 = -1 -1
+texture
+material
+frame
+1.0 0.500000 =
+-1 anim
+texture
+vertex material
+material vertex anim 1.0 1.0 anim 0.500000 frame
+0.500000 0.500000 vertex texture frame 0.500000
+-1 0.500000 -1 = -1 texture anim texture
+1.0
+1.0 material
+vertex
+material bone 1.0
+anim
+anim texture -1 1.0 anim material texture anim material
+anim frame
+vertex material 1.0
+frame 1.0 -1 texture -1 texture frame anim frame
+1.0 -1
+material
+= 1.0 -1 texture -1 vertex = = texture -1
+vertex vertex bone frame
+frame anim vertex material 0.500000 = 1.0 0.500000
+1.0 texture material 0.500000 texture texture texture frame
+material -1 frame 1.0 vertex 0.500000 1.0 -1 anim 1.0
+bone
+= = material
+-1
+bone texture material 1.0 material
+anim
+0.500000
+=
+= 1.0 frame
+frame frame
+frame texture material frame frame anim texture 1.0 bone vertex -1 texture bone anim 0.500000 -1
+anim
+-1 texture frame
+bone texture -1 1.0 frame texture texture anim vertex vertex anim 0.500000 vertex bone texture material -1 material vertex 0.500000 texture -1 bone
+frame = 0.500000 material bone material -1 anim vertex texture 1.0 0.500000 vertex texture bone frame
+vertex anim bone -1
+0.500000 texture -1 bone
+vertex texture
+bone = anim 1.0 1.0
+= frame texture bone -1 = texture material 0.500000
+= 0.500000
+material -1 0.500000
+vertex
+anim 1.0
+frame
+vertex material
+texture 1.0
+bone = frame vertex 0.500000
+texture texture
+-1 texture texture
+texture 1.0 anim = bone material frame bone anim 1.0
+0.500000 0.500000 material -1
+-1 texture 0.500000 frame -1 frame bone 0.500000
+vertex = texture 0.500000
+vertex
+-1 vertex -1 bone 1.0 vertex material
+texture
+bone bone
+texture bone frame
+0.500000 material 1.0
+material
+0.500000
+0.500000 0.500000 0.500000 frame 0.500000 frame texture material
+= texture
+material
+anim
+frame 0.500000 0.500000
+-1 texture 1.0 anim = texture =
+1.0 material
+bone -1 0.500000 -1 anim anim vertex vertex -1
+-1 texture
+texture vertex 0.500000 texture
+vertex 0.500000 -1
+bone material texture
+anim -1 1.0 = vertex
+vertex -1 vertex 0.500000 frame textur
\ No newline at end of file
@@ -0,0 +1,6 @@
+-1
+vertex
+0.500000 frame =
+-1 bone bone
+-1 0.500000 texture bone
+vertex tex
\ No newline at end of file
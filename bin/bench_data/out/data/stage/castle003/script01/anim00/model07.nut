@@ -0,0 +1,80 @@
+anim 1.0 anim -1 texture 0.500000 =
+texture
+=
+anim 1.0
+vertex frame -1
+-1 1.0
+texture
+vertex
+vertex 0.500000
+-1 material -1 anim = 0.500000 =
+vertex bone
+material
+frame 1.0 anim -1 vertex 1.0
+texture -1 texture texture = anim anim = frame 0.500000 bone 0.500000
+anim anim anim 1.0
+1.0 1.0 frame frame vertex anim -1
+frame 1.0 anim 0.500000 material 0.500000
+-1 frame anim
+vertex material material
+0.500000 bone
+texture 0.500000
+vertex 0.500000 =
+texture = frame
+=
+bone texture frame
+anim
+bone
+vertex bone 1.0 = bone bone bone
+= 0.500000 anim
+vertex 0.500000 0.500000 =
+bone
+material
+1.0
+frame bone 1.0 = frame vertex frame texture 1.0 vertex 1.0
+frame 0.500000 vertex bone frame anim
+vertex
+texture
+= 0.500000 0.500000 -1 bone
+texture
+texture
+frame
+anim material bone 1.0 0.500000
+texture 1.0 bone
+texture material texture 1.0 texture = anim 1.0
+frame bone -1 = = 1.0 vertex 1.0 1.0 1.0 1.0 bone
+material
+material vertex
+-1 bone frame =
+-1 =
+material anim 0.500000
+texture -1 bone -1 frame -1
+1.0 = texture
+texture vertex frame
+vertex
+1.0 1.0
+1.0
+texture 1.0 1.0 =
+bone 1.0 bone frame anim 0.500000 material frame texture
+= texture bone bone bone 0.500000 -1 frame
+texture 1.0 = anim = material =
+= anim -1 frame -1
+anim bone bone material 0.500000 texture 1.0 = =
+texture -1 =
+anim -1 bone bone vertex bone material 0.500000 anim anim anim bone = material vertex texture =
+texture -1
+frame
+material
+material bone material anim
+-1 -1 vertex texture
+texture texture vertex anim 1.0 material vertex anim material 1.0 0.500000 vertex 1.0 -1 frame = material
+1.0
+anim
+frame 1.0
+1.0 texture
+0.500000 -1 bone
+= texture 1.0 bone texture bone bone anim frame vertex = texture texture 1.0 material anim -1 anim = material bone anim = material
+texture bone
+1.0 = frame material texture bone 0.500000 texture texture
+-1 -1 0.500000
+frame -1
\ No newline at end of file
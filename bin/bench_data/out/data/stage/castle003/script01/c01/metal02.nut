@@ -0,0 +1,34 @@
+vertex 0.500000
+frame texture material texture
+= = bone 0.500000 0.500000 bone
+anim material bone = frame texture 1.0 texture material = texture
+frame vertex
+texture bone texture 1.0 0.500000 bone
+bone
+vertex texture
+anim vertex frame
+anim 1.0 0.500000
+bone frame
+0.500000
+anim vertex
+vertex material
+0.500000 0.500000
+anim
+1.0 -1 0.500000
+frame bone 0.500000 material texture -1 1.0 1.0 -1 anim
+anim texture
+1.0 1.0 0.500000
+1.0 texture 1.0 = vertex anim material
+frame bone texture vertex material = -1
+0.500000 texture texture 1.0
+material 0.500000 texture 1.0
+-1
+0.500000 -1 texture -1 -1
+0.500000 texture = 0.500000
+-1 vertex
+material vertex = bone vertex -1 material frame 1.0
+material material frame 1.0 frame texture
+-1 material 0.500000
+frame frame 1.0 -1 1.0 -1
+frame 0.500000 bone
+anim 
\ No newline at end of file
@@ -0,0 +1,11 @@
+0.500000 texture frame -1 1.0
+anim
+frame -1 =
+vertex vertex bone
+1.0 1.0
+= anim = =
+anim
+texture -1 -1 texture frame
+texture vertex material anim frame -1
+anim texture -1 vertex anim
+vertex 0.500000 1.0 =
\ No newline at end of file
@@ -0,0 +1,245 @@
+material frame anim vertex bone anim
+= frame 1.0
+texture 0.500000 frame
+=
+1.0 vertex bone vertex 0.500000
+vertex material
+0.500000 frame material material 0.500000 anim anim 0.500000 frame vertex
+anim
+material 0.500000
+-1 0.500000 0.500000
+frame
+material bone frame
+0.500000 frame vertex material bone
+vertex vertex
+anim -1 0.500000
+= 1.0 texture
+texture
+material vertex bone
+bone
+0.500000 material material -1 material
+vertex frame vertex anim 1.0
+material frame frame frame
+anim vertex 1.0 frame anim
+material bone texture 0.500000 bone =
+vertex frame
+bone
+anim 1.0
+texture
+-1 material material
+1.0
+texture
+0.500000 material -1 anim
+bone anim texture
+material -1 bone vertex anim -1
+vertex anim
+0.500000 = texture 1.0 -1 bone -1
+0.500000 0.500000
+0.500000
+material 0.500000 material 0.500000 =
+= frame
+anim -1 = 1.0 -1 bone bone = material texture anim 0.500000 0.500000 anim
+1.0
+material frame texture 1.0 material
+= bone -1
+-1
+anim 1.0
+vertex
+material material anim
+vertex anim bone anim anim texture
+-1 vertex
+=
+bone anim
+-1 frame bone anim 1.0 = material frame
+material = texture material
+bone 0.500000 texture = frame -1 0.500000 texture texture bone material = material
+-1 material bone texture material 1.0 frame texture 0.500000 0.500000 vertex = = texture anim
+texture -1 1.0 0.500000 0.500000 material frame -1
+texture
+texture = vertex 0.500000
+material frame
+1.0 vertex anim frame frame texture = frame bone
+0.500000 -1 frame frame
+texture texture = = frame material 1.0 vertex = texture 1.0 vertex frame -1 -1 bone frame
+=
+-1
+frame
+0.500000
+1.0 1.0 0.500000
+0.500000
+1.0 bone texture -1 vertex 1.0 vertex frame frame material texture
+texture 1.0
+anim 0.500000 -1
+anim
+texture 0.500000 anim bone material material 0.500000 vertex -1 -1 material texture bone
+vertex -1
+texture anim 1.0
+= anim -1 bone material texture vertex =
+bone -1 frame -1
+anim 1.0 material 0.500000 material texture bone anim texture
+0.500000
+bone 0.500000 frame -1 1.0 anim
+1.0 bone
+vertex
+= texture = = vertex -1 material =
+anim 0.500000 frame material
+bone
+anim vertex
+frame -1 -1 0.500000 material 0.500000
+0.500000 frame anim texture = vertex
+frame frame
+anim material material vertex anim frame = texture
+material -1 1.0 texture = bone 1.0 texture bone 0.500000 0.500000 vertex
+1.0
+vertex
+anim texture = material 0.500000
+frame anim anim 1.0 1.0
+= frame 0.500000
+anim bone = 0.500000 1.0
+texture
+0.500000 texture -1 bone -1 0.500000
+frame vertex vertex -1 frame 1.0
+1.0
+-1 texture
+vertex
+vertex anim
+1.0 vertex
+frame anim frame bone -1
+1.0
+0.500000 vertex texture vertex texture vertex 0.500000 bone material
+material -1 -1 -1 -1 frame = 0.500000 frame 0.500000
+frame 0.500000
+texture 0.500000 frame
+frame material 0.500000 frame vertex material -1 anim = = -1 = material 0.500000
+texture 0.500000 -1
+0.500000
+frame
+frame
+texture 1.0 0.500000 texture 1.0
+1.0 0.500000 texture -1
+= 1.0 =
+material -1 anim 0.500000 anim 0.500000
+vertex 0.500000 -1 = = 1.0 frame
+vertex bone
+vertex frame 0.500000
+texture vertex vertex -1 1.0 -1 texture = =
+texture
+vertex 0.500000 anim -1 bone frame bone
+material material 1.0
+-1 bone
+texture texture bone bone anim bone vertex
+1.0
+-1 0.500000 vertex 1.0 vertex bone
+vertex
+= = texture
+anim
+1.0 anim = bone bone
+texture -1 1.0 vertex
+anim anim =
+0.500000 bone -1
+1.0 material = = frame vertex -1 = frame anim
+0.500000
+vertex
+= anim 1.0 -1 -1 -1 material anim 1.0 material
+vertex 1.0 -1 material
+material -1
+anim -1 bone vertex texture
+texture material -1 1.0 texture
+vertex anim
+=
+vertex
+-1
+anim
+=
+1.0 anim texture bone 0.500000 = texture vertex frame texture frame 0.500000
+anim
+vertex
+0.500000 material = material = =
+vertex anim material
+material anim vertex
+vertex
+0.500000 1.0 bone bone
+bone 1.0 -1 material
+texture vertex -1
+1.0 frame anim
+anim = 1.0
+0.500000 material texture material material frame texture frame =
+0.500000 = anim texture
+frame 0.500000 vertex
+1.0 -1 vertex material vertex bone
+vertex anim
+1.0 material frame 1.0 bone 0.500000 = material
+bone -1 material vertex texture material -1 =
+bone
+anim anim vertex anim 1.0 1.0 1.0 anim = = -1 anim frame vertex 0.500000 0.500000 anim texture texture bone
+material vertex texture
+0.500000
+bone texture anim texture frame 0.500000
+bone
+bone
+vertex
+0.500000 texture = 1.0 -1 0.500000 texture texture 1.0
+frame 0.500000 texture anim = 0.500000 frame
+anim material
+-1 0.500000 texture frame 0.500000 = 0.500000 -1
+=
+material 0.500000 bone bone frame vertex = material frame texture = 1.0 anim -1 anim
+vertex frame material 0.500000 1.0
+vertex
+vertex vertex
+0.500000
+frame bone texture =
+= frame -1 anim vertex 0.500000 anim
+vertex
+bone vertex
+frame 0.500000 frame 1.0 0.500000
+-1 0.500000 anim bone vertex texture bone 1.0 bone
+frame vertex
+1.0 =
+=
+bone 1.0 texture = = = vertex anim
+frame =
+material
+vertex -1
+-1 texture
+material 0.500000 anim
+0.500000 -1 material
+anim bone
+bone 0.500000
+frame anim bone anim frame = material texture = anim
+material frame
+bone 0.500000
+material
+material
+0.500000 texture material
+frame anim material frame
+texture
+anim 1.0 anim anim texture bone 0.500000 vertex -1 = =
+0.500000 bone = -1
+texture bone 1.0 1.0 -1 anim texture frame bone vertex
+0.500000 material
+vertex
+vertex
+-1 1.0 material anim anim anim bone -1 vertex = -1 texture bone 0.500000 bone
+-1
+0.500000 vertex =
+anim
+material texture vertex frame
+vertex frame
+bone
+texture material texture bone
+0.500000
+1.0 vertex 1.0
+-1
+anim
+texture texture
+vertex 1.0 material
+1.0
+frame texture
+texture -1 material vertex material frame anim frame 0.500000 material vertex material 0.500000 -1 1.0
+1.0 material 1.0 anim vertex -1 vertex 0.500000 texture -1 texture anim texture = 1.0
+1.0 -1 texture = bone =
+-1
+vertex texture vertex vertex
+-1
+-1 1.0 = 1.0 vertex material an
\ No newline at end of file
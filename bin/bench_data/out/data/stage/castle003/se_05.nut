@@ -0,0 +1,6 @@
+material 0.500000 1.0 -1
+material
+frame vertex
+bone 1.0
+0.500000 bone
+material = texture
\ No newline at end of file
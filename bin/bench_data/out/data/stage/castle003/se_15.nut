@@ -0,0 +1,34 @@
+=
+= texture material -1
+material vertex material vertex bone
+1.0 1.0 1.0 bone 1.0 vertex
+frame material = = vertex 0.500000
+0.500000
+= texture 1.0 0.500000
+material -1
+0.500000 anim frame
+= vertex
+1.0 bone 1.0 =
+material 0.500000
+-1 texture -1 -1 frame anim 1.0 0.500000 anim
+= material
+bone
+vertex
+0.500000 texture frame 0.500000 material -1
+frame
+0.500000 frame -1 1.0
+bone frame
+anim -1 -1
+= material 0.500000 texture
+1.0
+-1 vertex = 1.0
+-1 anim -1
+1.0 bone material 1.0 frame
+material
+material
+bone 1.0 anim material
+0.500000
+texture
+frame 1.0 frame
+bone 0.500000 anim anim = 0.500000
+vertex texture texture 1.0 0.500000 b
\ No newline at end of file
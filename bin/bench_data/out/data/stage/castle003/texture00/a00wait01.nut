@@ -0,0 +1,4 @@
+texture bone frame texture
+-1 bone vertex frame material
+0.500000
+-1 0
\ No newline at end of file
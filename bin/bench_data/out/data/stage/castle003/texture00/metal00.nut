@@ -0,0 +1,152 @@
+frame 0.500000
+vertex texture 0.500000 -1 texture frame
+bone frame frame 1.0
+0.500000 anim 0.500000 texture 0.500000
+vertex
+vertex anim bone bone material bone 1.0 1.0 -1 frame material
+frame material 1.0 1.0 = texture
+1.0 texture vertex material frame texture 1.0 -1
+0.500000 =
+1.0
+anim 1.0 1.0
+0.500000 = bone
+frame frame material frame frame material anim
+vertex 1.0 = material 1.0 bone vertex bone frame anim
+bone 0.500000 bone
+texture -1 0.500000 anim bone 0.500000 anim
+-1 =
+1.0 0.500000
+vertex frame -1
+frame -1 1.0
+bone vertex = material
+anim -1 texture vertex texture material texture
+0.500000
+= anim vertex =
+= = anim
+material 0.500000
+0.500000 material
+-1 material
+material anim
+1.0 frame anim = anim texture texture 0.500000 -1 frame
+anim
+-1 frame texture
+1.0
+0.500000 bone
+texture
+-1
+-1 frame 1.0
+= 0.500000 anim material
+bone anim
+anim texture material
+material texture
+1.0 material
+0.500000 vertex vertex
+-1 bone
+0.500000 vertex 1.0 0.500000 frame frame bone 1.0
+-1
+1.0
+= 1.0 bone texture vertex =
+= 1.0 = = anim frame
+0.500000 0.500000 -1 texture vertex texture vertex =
+texture vertex 0.500000 material material material frame
+1.0 0.500000 material texture anim
+bone anim =
+material
+-1
+1.0 vertex
+vertex -1
+=
+texture vertex 1.0 1.0 0.500000 vertex
+vertex texture
+=
+texture
+frame anim
+-1 0.500000 texture frame anim 0.500000 material
+material material -1 frame vertex 0.500000 vertex = vertex bone 1.0
+=
+-1
+=
+1.0 1.0 = =
+0.500000 =
+-1 bone texture bone
+0.500000 frame 1.0 frame material = frame bone texture
+vertex texture
+-1 1.0 -1 anim frame = = material 1.0 texture
+frame anim =
+-1
+=
+frame vertex 1.0 1.0 bone bone vertex
+= 1.0 frame
+texture
+-1 texture -1 =
+texture
+bone
+material
+material vertex 0.500000 bone 0.500000
+=
+anim 0.500000 bone vertex material
+-1 frame 0.500000 frame frame
+frame -1 = 0.500000 -1 frame material = anim vertex 1.0 0.500000 anim
+material = texture frame material
+bone bone bone 1.0
+bone frame 0.500000
+anim
+frame 1.0 = material texture
+anim 0.500000 frame bone anim
+vertex bone
+material
+0.500000
+material bone texture frame texture
+= texture
+texture material material 1.0 -1 1.0
+texture material bone
+-1 0.500000 -1 bone
+anim
+anim
+anim
+material
+material anim texture = frame -1 vertex -1 = bone texture bone =
+1.0 bone = =
+0.500000
+material = =
+1.0 bone bone = vertex anim vertex vertex -1
+= =
+-1
+bone texture material
+frame frame vertex
+vertex -1 -1
+anim -1
+= -1 1.0 -1 bone 1.0 material texture anim 1.0
+frame 0.500000 -1
+frame
+bone -1
+1.0 frame material 0.500000 material anim material
+1.0 texture anim bone bone material
+0.500000 texture 1.0 material -1 frame
+1.0
+-1 vertex vertex material material
+texture 0.500000 0.500000 = frame
+frame vertex = anim bone
+-1 texture = -1
+material 1.0 frame bone
+0.500000
+texture vertex frame material
+frame
+anim
+texture texture = -1
+texture material frame
+-1 frame material vertex material bone -1
+-1
+bone texture vertex material texture frame
+anim
+anim 0.500000
+-1 1.0 1.0
+anim -1
+bone
+vertex
+-1
+-1 texture texture bone frame
+frame
+material =
+= texture bone
+texture frame 0.50
\ No newline at end of file
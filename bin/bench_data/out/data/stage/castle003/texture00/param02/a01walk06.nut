@@ -0,0 +1,97 @@
+frame bone
+texture -1
+texture
+= -1 anim material 1.0 vertex 0.500000
+1.0 frame material frame 1.0 vertex anim
+1.0 1.0 frame vertex 1.0 = -1 vertex material = -1 vertex
+material
+vertex
+0.500000 vertex bone vertex = material 0.500000 bone frame 0.500000 material
+texture -1 vertex
+bone vertex
+texture
+anim anim vertex
+material =
+-1 bone material
+frame material
+-1 0.500000 0.500000 = texture bone bone 0.500000 material anim
+= = vertex texture -1
+bone frame frame 0.500000 texture vertex material vertex bone 0.500000 bone 1.0
+material bone
+bone = material -1 -1 texture
+0.500000 0.500000 vertex
+texture
+1.0 material = =
+vertex frame = material anim anim
+-1
+vertex material -1 texture texture 0.500000 -1
+frame
+material
+= frame frame
+= 0.500000 vertex
+material -1 vertex 1.0
+1.0 -1 vertex 0.500000 material
+bone anim bone
+vertex bone
+bone 0.500000 bone anim frame material 1.0 anim
+frame
+anim anim
+=
+1.0 anim vertex
+anim = vertex
+0.500000
+material frame frame -1 bone 0.500000
+= material = 1.0 -1 0.500000 anim texture anim -1
+0.500000 material = =
+1.0
+frame vertex
+texture
+material texture -1 frame -1
+vertex =
+0.500000
+frame vertex anim =
+0.500000 -1
+anim
+1.0
+1.0 vertex 0.500000
+vertex 1.0 0.500000
+frame texture anim
+1.0 vertex frame = =
+1.0 0.500000
+frame frame 1.0
+material anim 0.500000 vertex vertex vertex frame
+frame = 0.500000 vertex material
+vertex vertex material
+0.500000
+0.500000
+=
+texture texture
+0.500000 -1 anim vertex bone 0.500000 material
+texture
+vertex -1 anim 0.500000 frame texture frame
+anim
+bone 0.500000 vertex
+-1 0.500000 frame
+-1
+texture -1 vertex
+anim
+material
+bone
+material bone 0.500000 -1 anim vertex
+frame vertex 1.0 bone bone frame anim
+= material 0.500000 material 0.500000 bone anim =
+material texture anim -1
+-1
+0.500000 = vertex anim -1
+= 1.0 anim 0.500000 anim 0.500000
+anim =
+texture anim
+vertex = = texture texture material -1 frame bone anim vertex material 1.0 0.500000 1.0
+-1 = vertex material 0.500000 = material 0.500000 anim
+material
+material
+bone bone 0.500000 -1 material anim
+= bone material
+= vertex texture frame texture vertex
+vertex
+vertex -1
\ No newline at end of file
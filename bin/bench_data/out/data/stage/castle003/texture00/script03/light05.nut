@@ -0,0 +1,213 @@
+anim =
+= vertex bone bone texture bone = anim material 1.0
+material = 1.0
+bone frame
+1.0
+1.0 anim vertex
+bone
+bone = texture anim 1.0 anim vertex texture anim
+anim
+anim frame texture
+material -1 frame texture
+1.0
+material
+0.500000 1.0 -1
+bone texture bone = texture bone = = vertex = =
+texture
+frame bone vertex bone frame
+-1 anim bone -1
+bone 1.0
+0.500000
+anim = -1 1.0 bone 0.500000
+texture texture bone 1.0 0.500000 anim
+anim vertex 0.500000 anim 0.500000
+= anim
+bone frame -1
+frame = anim material texture
+texture 1.0 vertex
+=
+bone bone
+= anim anim material anim bone = 1.0 -1 0.500000
+bone
+1.0 anim bone texture material 1.0
+anim frame texture
+anim bone = bone
+material 1.0 vertex
+0.500000
+0.500000
+0.500000 -1 material texture
+bone
+1.0 material
+texture
+-1 material
+0.500000
+anim
+frame -1 1.0 0.500000 1.0 material 1.0 anim = 0.500000 0.500000 -1 vertex = = -1 bone
+-1
+texture 0.500000
+texture vertex 1.0 -1 texture 1.0
+= texture
+texture 0.500000 0.500000 -1 -1 material 1.0 -1 material texture frame 0.500000 -1
+anim = vertex 1.0
+bone 1.0 0.500000
+anim
+texture frame anim bone material 1.0 = anim -1 = texture
+0.500000 texture
+= =
+bone bone bone material vertex
+-1
+0.500000 -1 bone
+texture = material
+bone texture -1 1.0
+0.500000 =
+-1 texture
+texture vertex = vertex material
+material material 1.0 vertex frame frame anim material vertex bone material bone -1
+-1 = -1 bone -1
+=
+= material material anim vertex
+anim bone anim material
+frame
+1.0 vertex 0.500000 -1 -1 0.500000 0.500000 bone
+vertex -1 0.500000
+texture anim anim 1.0 -1 =
+bone
+bone
+bone texture -1 -1 bone frame 1.0 frame 0.500000 anim vertex = material bone
+1.0 -1 bone 1.0
+vertex 1.0
+0.500000 anim 0.500000 vertex
+1.0
+1.0 texture 1.0
+0.500000 1.0
+texture
+-1 0.500000 1.0
+texture frame 1.0 bone material bone texture
+bone frame 0.500000 anim bone 1.0 texture bone
+=
+bone 1.0
+frame frame 1.0
+-1
+-1 0.500000 frame texture -1 bone bone
+anim material material frame anim frame anim texture bone
+0.500000
+=
+frame 1.0 1.0 1.0 -1 bone material
+0.500000 0.500000 -1 = texture 1.0
+0.500000
+1.0 0.500000 = -1 frame anim 1.0 anim
+= texture 1.0
+bone -1 1.0 anim = material texture bone texture material
+= frame
+=
+0.500000
+bone bone 1.0 texture 0.500000 -1 material
+0.500000
+texture vertex = vertex
+anim 0.500000
+bone = vertex = anim 0.500000 -1 0.500000 anim anim frame 1.0 -1 frame bone
+-1 -1 material bone texture 1.0 material 0.500000 -1 1.0 bone
+1.0 material frame bone vertex frame frame anim = material
+0.500000
+material material 1.0
+= vertex anim vertex frame
+material anim -1 -1
+vertex
+anim = vertex bone 0.500000 vertex anim
+0.500000 material
+=
+frame vertex vertex anim 1.0 = frame 0.500000 =
+anim -1 0.500000 frame
+=
+vertex
+material -1 0.500000
+frame
+1.0 vertex -1 material vertex bone 0.500000
+vertex bone bone = frame 0.500000 bone
+texture
+vertex texture texture -1
+1.0 vertex 0.500000 = =
+0.500000
+0.500000 material -1 anim = 0.500000 texture vertex
+1.0 frame
+anim vertex 1.0 0.500000 0.500000 = 0.500000
+frame = texture
+texture frame
+0.500000
+anim 1.0 texture 1.0 = anim 1.0 texture 0.500000
+=
+0.500000 = anim = bone
+bone texture texture material 1.0
+frame -1
+0.500000 texture texture 0.500000 = anim frame
+vertex
+vertex
+vertex
+1.0
+vertex 1.0 -1
+material frame -1
+vertex material -1 frame
+0.500000 = material anim
+anim frame frame texture =
+anim
+-1 material bone
+material = bone anim -1
+bone 0.500000 frame
+bone
+0.500000 material 0.500000
+1.0 texture frame
+material anim -1 0.500000 material texture vertex bone material
+0.500000
+frame = -1 bone texture
+anim anim bone bone frame
+texture texture
+bone 0.500000 0.500000 1.0 material
+bone material -1 = bone
+vertex
+texture -1 anim 0.500000
+texture bone anim
+-1 bone
+vertex
+texture frame bone 1.0 -1 vertex material material
+=
+texture -1 1.0
+bone
+texture anim bone 0.500000 texture vertex anim = vertex 0.500000 -1 -1 anim anim vertex -1 texture
+frame vertex
+-1
+texture 0.500000 frame
+0.500000 0.500000
+vertex texture anim anim = vertex -1 1.0 0.500000 0.500000
+vertex anim -1 material
+frame material texture
+bone texture vertex anim 1.0 texture texture anim anim anim
+= material texture
+1.0 texture 0.500000 bone
+material 0.500000
+0.500000
+= 1.0 frame material = anim bone bone 0.500000 = material 1.0 anim
+0.500000 frame = vertex 0.500000 bone vertex = material material
+vertex texture 1.0 bone anim
+1.0 texture
+texture texture
+0.500000 frame material bone
+-1
+= anim
+0.500000 texture -1 material texture frame material texture
+vertex -1 1.0 texture material vertex = material bone frame frame 0.500000 =
+bone material vertex
+frame anim frame 0.500000 frame anim 0.500000 0.500000 = bone 0.500000 bone vertex frame texture
+vertex anim 0.500000
+-1
+vertex
+material vertex
+bone vertex vertex
+frame 0.500000 0.500000 texture -1 texture =
+0.500000 material 1.0 =
+frame texture 1.0
+bone texture vertex texture material anim material material = 0.500000
+-1 texture vertex material vertex anim 0.500000
+frame 1.0
+1.0 1.0 1.0 bone -1 texture frame -1
+anim texture frame material 0.500000 texture material
+-1 bone
@@ -0,0 +1,5 @@
+texture
+material vertex 0.500000
+frame
+material
+= anim vertex textu
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture 1.0
+0.500000 1.0 frame 1.0
+anim -1 -1
+-1
+= texture texture frame texture anim bone vertex bone 0.500000 material texture 1.0
+material texture
+1.0
+= material 0.500000
+bone 0.500000 bone =
\ No newline at end of file
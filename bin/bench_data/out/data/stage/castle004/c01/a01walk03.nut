@@ -0,0 +1,104 @@
+vertex vertex
+1.0
+material -1 material
+= bone vertex vertex 0.500000 vertex bone
+anim bone
+vertex anim
+-1 vertex
+bone 0.500000
+-1 = frame -1
+bone material bone texture 0.500000
+frame
+= vertex anim -1
+anim frame bone bone vertex 0.500000 -1 0.500000 frame 1.0 anim material vertex -1
+= material anim
+frame
+texture
+vertex frame
+-1
+anim
+-1 texture 0.500000 -1 0.500000 anim vertex bone
+0.500000 anim 1.0 bone -1 1.0 0.500000 texture frame
+bone = 1.0 -1 anim bone 0.500000 material vertex material 1.0 0.500000
+anim
+bone 1.0
+anim = 0.500000 frame frame anim 1.0 anim anim = texture
+1.0 bone 0.500000 bone frame frame
+anim material
+0.500000 -1 anim frame
+0.500000 anim anim
+anim
+vertex texture
+material anim bone 0.500000 texture -1 material 1.0
+1.0 frame = texture 0.500000 vertex bone 0.500000 1.0
+-1 vertex frame -1 frame vertex texture 0.500000 bone texture 1.0
+vertex
+-1 anim = texture
+anim frame bone
+0.500000 material frame
+-1 anim
+texture -1 anim bone
+-1 1.0 anim frame texture material vertex -1
+frame
+= vertex 0.500000 0.500000
+= material
+anim anim 1.0 -1 0.500000 anim 1.0
+bone material anim bone =
+anim
+material texture anim 1.0 anim =
+bone
+= bone
+texture
+bone
+-1
+frame frame bone anim material
+-1 anim
+bone 1.0
+frame bone frame
+material
+=
+material 0.500000
+frame -1
+vertex bone
+texture anim
+0.500000 -1 frame bone anim 0.500000 frame 1.0 = material anim bone = 1.0
+-1
+vertex frame
+material 0.500000
+-1 vertex anim -1 frame = frame 0.500000 frame
+vertex 1.0
+= anim
+vertex
+-1 vertex anim bone
+1.0 frame
+vertex
+anim texture material anim texture vertex texture
+texture -1 1.0 anim material -1
+frame vertex = bone texture bone material 1.0 frame bone -1 -1 frame
+anim anim
+= texture texture anim frame anim vertex texture 1.0 frame
+anim -1 -1 anim anim 1.0 vertex 1.0 material 0.500000
+anim
+frame =
+1.0 0.500000
+-1 vertex vertex 0.500000 material material frame bone texture -1 -1
+anim material bone texture material 1.0 material vertex frame
+material 0.500000
+material -1 material 1.0
+anim 0.500000
+frame material vertex
+anim
+anim 0.500000 0.500000 vertex 0.500000 frame material = anim 0.500000
+-1 texture
+1.0
+= anim
+anim texture 1.0
+= anim texture 0.500000 frame vertex =
+bone = bone material
+anim anim vertex anim = material frame frame = -1 material anim
+1.0
+material
+material bone frame bone 0.500000 1.0
+anim vertex 0.500000 bone bone = anim
+frame frame vertex 1.0
+= vertex fra
\ No newline at end of file
@@ -0,0 +1,23 @@
+= 0.500000
+bone frame 0.500000 frame
+0.500000 bone -1 0.500000 =
+material
+0.500000 bone frame bone anim bone texture
+=
+-1
+material texture =
+bone anim vertex 1.0 frame
+frame texture vertex frame anim material 1.0
+texture frame material -1 frame
+anim material vertex 1.0 -1
+0.500000 bone -1 -1 -1 material
+-1 -1 material material -1 texture =
+-1 0.500000 1.0 material anim
+material frame
+bone 0.500000 material
+vertex 1.0
+texture -1
+texture = 0.500000 0.500000 texture bone anim bone 0.500000
+= vertex = anim material texture bone
+= = -1 0.500000 texture
+bone anim 
\ No newline at end of file
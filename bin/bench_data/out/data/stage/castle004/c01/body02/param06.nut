@@ -0,0 +1,312 @@
+frame 0.500000 -1 0.500000 texture -1
+0.500000 0.500000 1.0 1.0 vertex -1 0.500000 frame -1
+= texture material material -1
+= anim 0.500000 anim 1.0 0.500000 1.0 1.0 vertex 0.500000 1.0 0.500000
+= 1.0 material material material bone
+1.0
+0.500000
+frame vertex bone anim bone = = vertex anim bone texture frame
+material bone
+vertex 1.0 bone
+bone
+material 1.0 frame
+bone 0.500000
+vertex
+anim frame 0.500000 -1 bone -1
+texture
+=
+1.0
+=
+0.500000 bone vertex frame material 1.0 anim
+1.0 1.0 frame
+=
+1.0
+1.0
+frame anim vertex
+vertex = anim
+material
+= bone =
+-1 0.500000 anim 0.500000 = frame material frame
+bone = bone = vertex anim
+-1 texture
+bone -1 frame frame bone frame texture texture 1.0
+-1 1.0 bone texture
+material 0.500000
+texture -1 bone bone
+-1
+-1
+anim bone frame anim frame
+0.500000 0.500000 0.500000
+texture material frame -1 1.0
+frame bone bone
+texture
+frame -1 1.0 vertex texture bone
+= 0.500000 bone anim
+-1 texture
+1.0 texture material
+frame
+anim
+0.500000 1.0 =
+material -1 0.500000
+vertex 0.500000 0.500000 material
+material vertex
+bone
+anim bone material vertex
+texture texture 0.500000
+1.0
+1.0 bone
+bone -1 frame
+0.500000 -1 vertex vertex
+-1
+-1
+anim material bone 1.0
+material 1.0 anim
+frame frame 1.0 frame
+material texture vertex -1 texture
+0.500000 0.500000
+frame frame
+frame bone -1 material =
+-1 vertex 1.0 bone material bone bone material vertex vertex material texture
+1.0 vertex
+bone bone 0.500000 frame material anim frame
+frame frame
+texture
+0.500000 texture
+anim = texture
+material vertex
+vertex
+-1 texture
+material
+bone = anim texture vertex
+texture anim texture material 1.0 frame 0.500000 = 0.500000
+vertex -1 texture
+texture
+texture vertex =
+frame
+0.500000 0.500000 1.0 frame
+1.0 bone vertex material frame 0.500000 bone frame
+0.500000
+-1 material
+vertex texture material 0.500000
+anim
+bone = material bone 0.500000
+material bone -1
+anim 1.0 -1 vertex vertex
+material material
+material bone
+0.500000 material
+material
+frame frame
+anim material texture anim 1.0 material texture 0.500000 0.500000 1.0
+bone
+0.500000 frame vertex material
+-1 1.0 texture -1 vertex 1.0 material
+frame
+anim = -1
+texture
+anim material
+1.0 frame bone
+1.0
+= anim 1.0 0.500000 0.500000 0.500000
+material anim =
+0.500000 anim anim = frame frame texture
+vertex 1.0 anim texture
+0.500000 texture bone anim 0.500000 = texture 0.500000 =
+anim frame vertex anim
+texture bone
+texture = texture
+frame
+= material
+vertex -1 anim frame anim
+0.500000
+-1 vertex frame anim = bone
+frame texture anim
+1.0
+vertex anim
+material 1.0
+texture 1.0 -1 anim
+vertex 1.0
+material = texture
+texture 1.0
+material = bone material
+vertex vertex
+1.0 bone anim 1.0 anim texture 0.500000 -1 material
+vertex anim -1 material material material texture 1.0 0.500000
+1.0 vertex frame =
+0.500000 bone 0.500000 material
+0.500000 0.500000 frame texture
+0.500000 vertex -1 vertex = bone anim
+material
+vertex texture anim -1
+0.500000
+frame 1.0 texture 1.0 1.0 -1
+bone = -1
+=
+-1
+texture frame 0.500000 = 0.500000 bone
+0.500000
+= material frame
+anim =
+= bone texture texture bone bone 0.500000
+vertex texture anim 1.0 anim material -1
+texture vertex =
+1.0 bone -1 anim -1 frame texture vertex material material frame
+anim frame = frame frame texture
+0.500000 1.0 -1 -1 anim
+= frame bone bone -1 1.0 0.500000 anim -1 anim -1
+bone
+-1 1.0 0.500000 = -1 = anim = texture
+-1 texture 0.500000
+frame anim
+vertex anim frame material material texture
+bone
+frame = bone anim
+texture 0.500000 bone = vertex -1 -1 -1 1.0 bone
+frame vertex vertex -1 bone frame vertex = anim = material texture material vertex
+vertex
+-1
+bone bone texture material anim 0.500000 1.0 0.500000
+bone -1 bone 0.500000 material
+1.0 -1 = anim 1.0 material anim 0.500000 anim anim
+0.500000 1.0 1.0 frame material
+vertex anim
+material
+bone frame 0.500000 bone 1.0 bone 1.0
+texture
+material frame bone vertex
+0.500000 material 1.0
+-1 vertex texture material = bone texture 1.0 material material vertex
+=
+bone anim anim 0.500000 bone vertex -1 frame 0.500000 material 0.500000 1.0 texture 1.0 1.0 = 1.0 texture bone
+0.500000 = 0.500000 bone anim = texture -1 anim anim vertex material =
+-1 =
+= bone
+= -1 1.0 1.0 = frame 1.0 frame anim bone
+-1
+=
+anim 0.500000 frame 1.0 texture 1.0 1.0 -1 frame texture bone frame anim anim -1
+0.500000 -1 -1 -1 frame
+anim 0.500000 bone -1 texture -1 texture
+=
+= -1
+frame frame
+=
+frame 1.0 0.500000 anim bone material texture -1
+bone 0.500000
+= -1 material frame
+material vertex bone vertex material = bone anim anim
+1.0 frame
+vertex = =
+anim 0.500000 bone
+vertex bone
+material anim -1 -1
+bone frame vertex texture texture anim =
+vertex bone anim material 0.500000 vertex -1 bone anim anim -1 anim bone frame material 0.500000 anim texture bone vertex texture material bone
+-1
+material texture 1.0 frame texture bone
+1.0 anim
+anim frame material material anim
+1.0 1.0 anim bone -1
+texture
+-1 =
+frame -1
+texture
+1.0 anim 0.500000 texture
+vertex anim
+1.0 anim material
+0.500000
+anim anim 1.0 anim 1.0 -1
+1.0 =
+frame
+texture
+-1
+frame
+material bone 0.500000 frame anim
+texture texture
+bone material
+frame
+bone
+= 1.0
+=
+material
+1.0 texture 1.0 = vertex material 0.500000 frame
+vertex 1.0
+= 1.0
+texture
+material
+anim anim anim bone -1 anim frame -1 bone texture = bone material =
+= = bone
+-1 =
+bone
+bone 0.500000 texture = bone material
+-1
+anim
+frame texture frame vertex vertex anim
+0.500000 -1 anim 0.500000 1.0
+1.0 =
+material material anim -1 bone vertex frame texture -1
+anim texture 1.0 material texture
+vertex anim
+0.500000 -1 vertex
+= bone frame texture
+=
+=
+0.500000 vertex frame frame
+anim
+frame vertex
+anim =
+vertex = 1.0 0.500000 0.500000 -1 material 1.0 vertex vertex vertex = anim texture
+vertex
+vertex vertex -1 1.0
+=
+= =
+bone 1.0
+0.500000 1.0 0.500000
+1.0
+-1 -1 material bone
+1.0 vertex
+bone 1.0 material 1.0
+material texture -1
+anim -1
+-1
+bone -1 vertex
+bone
+= vertex material
+=
+bone
+-1 -1
+frame frame 0.500000 vertex texture 1.0 1.0 material texture vertex -1 0.500000 texture 1.0
+0.500000
+bone 1.0 texture
+0.500000 frame anim frame
+material vertex 1.0 bone texture -1 anim texture texture 0.500000
+frame
+0.500000 texture frame = 1.0 texture
+texture
+texture bone
+=
+frame 0.500000 anim anim
+anim -1 material vertex 1.0 texture texture material anim
+vertex frame 1.0
+material
+material
+texture -1 -1 = bone frame 1.0 material material texture -1 frame texture
+1.0 material material anim bone bone material material 1.0 -1
+bone
+frame texture -1 vertex
+-1
+bone
+vertex 0.500000 texture material bone material -1 -1 = = 1.0 1.0 material
+vertex
+anim
+material -1 1.0
+-1
+vertex bone bone 0.500000 bone
+material
+vertex
+1.0 anim 0.500000 = bone texture texture frame bone material
+= = 0.500000 bone 0.500000
+0.500000
+vertex 1.0
+anim 0.500000 bone anim
+frame bone bone vertex bone vertex 1.0 0
\ No newline at end of file
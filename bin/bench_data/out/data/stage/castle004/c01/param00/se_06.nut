@@ -0,0 +1,14 @@
+= material texture
+0.500000 anim frame = material 1.0 frame bone 1.0 0.500000
+anim 1.0
+texture frame
+anim 0.500000 0.500000 0.500000 1.0 bone frame
+frame bone material = anim 1.0 frame 1.0
+texture bone
+texture -1 1.0 anim
+anim =
+=
+-1
+-1 bone 0.500000
+vertex bone
+vertex 
\ No newline at end of file
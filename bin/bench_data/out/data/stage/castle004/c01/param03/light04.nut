@@ -0,0 +1,5 @@
+-1
+0.500000 = bone -1 vertex
+bone vertex
+vertex vertex = -1 anim bone anim 0.500000 bone
+frame 0.50
\ No newline at end of file
@@ -0,0 +1,31 @@
+material texture =
+frame bone vertex
+frame = = bone 0.500000
+-1 vertex
+material
+material anim bone
+0.500000 bone frame
+=
+=
+1.0 material frame
+texture = bone -1
+frame = texture 1.0 -1 frame frame =
+texture frame vertex frame anim vertex -1 = 0.500000
+anim -1 -1
+0.500000 texture material -1 texture vertex 1.0
+frame texture 0.500000 frame
+anim
+material vertex = -1 -1 frame
+0.500000 1.0
+bone 1.0 bone 1.0
+vertex 1.0 frame vertex anim = = texture
+vertex frame anim material
+bone
+anim
+frame = material anim frame frame vertex material anim vertex texture vertex
+vertex
+=
+frame
+vertex = texture material -1 vertex 0.500000
+texture -1 0.500000
+0.500000 an
\ No newline at end of file
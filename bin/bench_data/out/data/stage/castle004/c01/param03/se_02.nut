@@ -0,0 +1 @@
+vertex bone 0.500000 material anim bone te
\ No newline at end of file
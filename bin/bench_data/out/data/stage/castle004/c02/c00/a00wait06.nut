@@ -0,0 +1,12 @@
+texture material bone vertex texture vertex bone 1.0 anim
+material
+0.500000 anim 1.0
+1.0
+texture 0.500000 1.0 anim material
+=
+1.0 1.0 0.500000 = 1.0
+bone 1.0 material 0.500000
+= 0.500000 vertex
+=
+1.0
+material texture frame frame = -1 
\ No newline at end of file
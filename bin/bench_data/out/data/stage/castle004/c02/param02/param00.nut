@@ -0,0 +1,234 @@
+texture
+anim 0.500000
+-1 texture -1 -1 anim 0.500000 frame
+anim -1 frame anim anim 0.500000 anim 1.0 frame 1.0
+bone frame vertex bone texture frame
+-1
+anim 0.500000 texture texture -1
+texture material vertex texture material -1 = frame bone bone texture texture
+1.0 anim vertex frame
+anim vertex
+-1 = =
+-1 -1 0.500000 = frame
+-1 0.500000 material vertex anim anim 1.0 1.0 -1 frame texture =
+-1 1.0
+frame = vertex anim = vertex = -1 -1 texture
+bone 1.0
+0.500000 texture vertex bone material texture
+= frame anim anim
+frame material texture material
+anim = vertex = anim 0.500000
+bone frame 0.500000 vertex texture
+=
+-1 -1 anim anim material anim material bone
+-1
+bone
+material =
+1.0 texture = =
+-1
+texture 0.500000 anim vertex 1.0 frame
+texture = -1 bone frame 1.0 bone
+= frame vertex frame
+bone bone 0.500000
+0.500000
+-1
+-1 material texture frame material material 0.500000 material 1.0 = vertex = -1
+frame material
+vertex =
+anim
+1.0 anim anim frame bone 1.0
+= vertex frame
+vertex bone 0.500000 frame bone texture bone material
+0.500000 1.0
+1.0 =
+0.500000
+vertex =
+-1
+0.500000
+bone = 1.0 -1 frame 0.500000 1.0 material 1.0 -1 1.0 bone 0.500000 vertex vertex
+1.0 0.500000
+texture frame = -1 anim
+vertex 0.500000 =
+bone
+frame frame -1
+bone 0.500000
+vertex
+= anim frame
+-1
+0.500000
+material anim texture texture anim
+texture material 0.500000 texture anim vertex anim material material = frame material bone material
+anim
+0.500000 1.0 anim
+1.0 material -1 texture
+-1 frame texture
+= material bone bone frame bone = =
+= -1 material bone material frame texture anim vertex bone material texture vertex frame vertex 0.500000 1.0
+0.500000 1.0 material anim
+vertex bone material material 0.500000 vertex 0.500000
+anim bone material vertex -1 1.0 = frame material
+-1 = bone vertex anim texture
+1.0 = = frame
+-1 texture bone
+1.0 bone vertex frame vertex
+bone vertex texture
+frame = bone 1.0
+material 1.0 -1 0.500000
+texture
+= texture vertex
+bone frame frame -1 = = vertex material bone vertex
+bone material = -1
+bone
+anim = = 1.0 bone anim 1.0 0.500000 texture -1 frame -1 frame vertex -1 anim material = -1 frame material frame -1 bone
+1.0 vertex bone = frame vertex 1.0 =
+texture vertex frame material 0.500000 bone
+0.500000 vertex vertex 1.0 -1
+-1 1.0 -1 frame anim
+bone anim 0.500000 = texture frame material
+bone frame texture material frame bone anim vertex =
+-1 anim
+bone frame
+vertex frame texture
+anim
+= bone
+texture 1.0 -1 frame frame
+0.500000 material texture 1.0
+material frame material 0.500000 anim bone
+-1
+-1 bone
+0.500000 vertex
+1.0 1.0 anim
+anim 1.0
+frame -1 -1 1.0 anim anim texture 0.500000
+vertex
+0.500000 0.500000 1.0
+frame
+texture frame vertex 0.500000 -1 anim vertex -1 = vertex = vertex
+frame 1.0 -1
+-1 vertex frame vertex anim =
+texture
+texture
+1.0 1.0
+anim =
+1.0
+texture
+anim 0.500000 = vertex frame bone texture texture bone = 0.500000 = bone vertex
+0.500000
+bone -1 bone 1.0 1.0 vertex anim texture frame
+0.500000
+frame
+= = material = anim frame
+vertex
+1.0 frame material frame texture texture texture texture material 0.500000
+=
+=
+bone = texture
+0.500000 bone =
+0.500000 vertex vertex material
+frame material anim -1 material material 0.500000 = vertex vertex anim vertex -1 0.500000 texture = -1 anim texture bone 0.500000 vertex texture 0.500000
+anim texture = vertex vertex -1 frame 1.0
+frame
+frame
+texture
+anim
+material
+1.0 texture
+= 0.500000
+material -1 0.500000 material vertex = bone
+0.500000
+anim
+frame 0.500000
+anim
+bone
+-1 0.500000
+bone 0.500000 = 0.500000 = = frame
+frame vertex vertex
+= anim texture
+texture frame
+1.0
+anim
+0.500000 = = 1.0 = anim =
+0.500000 anim
+anim
+= texture texture =
+anim -1 bone frame bone
+texture bone
+= anim -1
+1.0
+1.0 texture bone material
+1.0 -1
+0.500000 material 0.500000 vertex
+1.0 1.0 material 0.500000 1.0
+bone -1 1.0 vertex =
+0.500000 vertex 0.500000 bone vertex 0.500000 bone
+-1 bone
+= = 0.500000 =
+texture
+texture
+anim 1.0 0.500000
+vertex bone texture = bone 0.500000
+0.500000
+texture = material frame vertex -1 material anim
+vertex
+-1 -1 texture texture
+-1 texture frame = bone vertex 1.0 0.500000 -1 -1 anim bone
+-1 material frame
+anim anim = vertex
+0.500000 frame =
+texture
+0.500000
+1.0 bone
+=
+-1 1.0
+texture 0.500000 material vertex
+frame texture 1.0 frame vertex frame frame frame frame
+1.0 0.500000 material
+frame vertex
+frame frame
+0.500000 0.500000 = -1 -1 -1 frame frame
+material
+1.0 1.0 texture anim frame texture material texture vertex anim vertex vertex frame vertex 1.0 1.0 texture vertex bone =
+vertex material = = frame vertex
+=
+material vertex 0.500000
+texture vertex frame anim = texture
+bone = bone 0.500000 bone texture anim =
+anim material = 1.0 1.0 0.500000 = texture
+bone
+material material
+1.0 vertex texture = texture material frame vertex 1.0 anim material frame
+frame frame = anim anim 0.500000
+anim 1.0 = anim
+texture = vertex bone vertex anim
+= anim
+material material = vertex frame material
+= texture frame material vertex 1.0 frame frame material
+vertex
+1.0 frame 1.0 texture
+0.500000
+-1
+0.500000 material 0.500000 frame texture 1.0 0.500000 -1
+1.0 frame frame material 1.0
+bone
+1.0
+bone vertex 0.500000 frame bone
+bone
+texture 0.500000
+anim material texture
+material
+-1 material 0.500000
+material bone vertex
+vertex
+1.0
+0.500000 = 0.500000 0.500000 frame bone 1.0 0.500000 0.500000 material anim = frame 1.0
+-1 = frame 1.0 = texture vertex 0.500000 =
+vertex 1.0 frame = material texture = frame
+bone -1 1.0
+texture -1
+vertex frame
+anim 1.0
+vertex bone bone -1 vertex bone 1.0
+0.500000
+= vertex
+0.500000
+1.0 = = 1
\ No newline at end of file
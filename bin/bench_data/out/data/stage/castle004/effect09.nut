@@ -0,0 +1,8 @@
+0.500000 material
+0.500000
+0.500000
+vertex
+= frame bone -1 texture 1.0 bone -1 material bone frame texture = bone
+1.0 0.500000
+0.500000 frame texture material
+texture material 0.5
\ No newline at end of file
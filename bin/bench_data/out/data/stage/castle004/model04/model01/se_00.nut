@@ -0,0 +1,8 @@
+texture = anim = 0.500000 texture material frame 0.500000 vertex 0.500000 0.500000 anim
+frame = 0.500000 -1 1.0
+0.500000
+0.500000
+frame anim
+material
+material 0.500000 material anim = 1.0
+1.0 1.0 texture anim bone anim frame vertex 0.500000 0.500000 0.500000 vertex material material bone 0.500000 a
\ No newline at end of file
@@ -0,0 +1,255 @@
+material 0.500000 frame 0.500000 anim =
+bone 1.0
+texture
+vertex anim
+material texture
+= texture -1 material
+anim -1 bone frame material = = bone -1 = vertex -1
+frame frame
+-1
+1.0 texture -1 = material material -1
+material
+bone bone -1 material
+frame
+1.0 frame
+bone 0.500000 0.500000 -1 anim -1 vertex 0.500000 material = frame texture material texture
+-1 anim 1.0 0.500000 anim frame frame 0.500000 0.500000
+anim 0.500000
+vertex anim texture bone
+-1 bone bone 0.500000 anim bone =
+bone 0.500000 -1 bone anim material = vertex bone bone texture
+frame frame texture anim 1.0 0.500000 material material
+= bone
+0.500000 texture
+material -1 bone = vertex
+vertex bone -1 bone bone
+bone = material
+-1 frame anim 1.0 bone
+anim bone
+-1 bone material vertex =
+texture bone -1
+-1 texture
+texture
+0.500000 0.500000
+texture
+-1
+vertex
+vertex = vertex vertex -1
+-1 = texture
+= 0.500000 texture texture
+=
+anim = bone anim
+=
+texture material 1.0
+bone 1.0 bone material
+-1 texture = 1.0 1.0 0.500000
+material frame
+texture anim
+0.500000 1.0 material material -1 0.500000 0.500000
+=
+= = -1 anim
+texture -1 vertex texture 0.500000
+bone anim texture
+= texture -1 frame frame
+texture -1 anim -1 frame
+frame
+vertex -1 texture
+-1 = 1.0 0.500000
+-1 1.0 anim anim
+vertex
+bone frame
+texture anim texture material frame anim
+material 1.0 0.500000 frame vertex bone anim
+anim 0.500000 vertex 1.0 =
+-1 material -1 material frame 0.500000
+anim
+vertex
+bone -1 frame frame frame
+frame vertex =
+bone
+vertex
+frame
+material texture frame 0.500000 anim = 0.500000 = anim -1 -1 0.500000
+-1 1.0
+= vertex bone -1 0.500000 1.0 = = 1.0 material anim texture material texture anim =
+vertex anim 0.500000
+1.0
+bone 1.0 1.0
+vertex bone bone 1.0
+0.500000 bone = = material texture
+texture =
+frame 1.0 0.500000 -1
+texture
+1.0 material texture vertex frame material anim frame vertex
+frame
+-1 vertex -1 0.500000
+vertex anim -1 vertex 1.0
+0.500000 -1
+vertex
+vertex anim
+frame frame anim texture
+=
+1.0 material -1 material -1 1.0
+texture texture 0.500000 material 0.500000 texture bone =
+material 0.500000 material
+-1
+bone
+anim vertex -1 material vertex =
+bone 1.0 bone
+= bone
+texture anim = = vertex -1 texture
+frame
+texture
+texture 0.500000 texture -1 1.0
+vertex vertex bone
+0.500000 1.0 material
+texture 1.0
+material bone frame vertex frame -1 frame vertex -1 0.500000
+vertex vertex 1.0
+= frame material
+material
+texture anim material -1
+-1 texture -1 material anim = anim vertex
+1.0
+1.0 =
+frame
+bone
+-1
+1.0 0.500000 material anim 1.0 texture
+material
+1.0
+vertex = texture texture
+vertex material material texture = = bone frame
+frame material vertex frame material texture
+bone
+vertex 1.0 1.0 1.0
+bone frame vertex frame bone texture
+texture anim 0.500000 bone vertex
+0.500000 -1 material anim
+-1 bone 0.500000
+0.500000
+=
+= material
+1.0 anim frame 1.0 bone 0.500000 frame anim = frame
+0.500000
+= vertex bone
+frame -1 bone
+= 1.0
+material material
+bone bone =
+vertex anim = anim
+frame anim -1 = 1.0 texture material
+material = = bone anim material
+anim
+0.500000 frame texture texture
+vertex
+anim material 1.0 1.0
+vertex
+frame = bone 1.0 texture frame texture texture bone bone texture
+material 1.0 texture frame = bone vertex
+anim
+anim bone
+bone 1.0 vertex 1.0 frame vertex
+= frame frame vertex frame
+vertex texture
+0.500000
+anim bone anim texture frame = material
+-1 = vertex -1 bone
+1.0 1.0 anim vertex bone material texture
+material frame
+texture texture bone anim material frame 0.500000 texture = =
+frame
+anim
+0.500000 texture texture 1.0 =
+texture bone vertex frame = bone anim
+material
+frame material bone =
+0.500000 vertex -1 1.0 material
+vertex material material bone frame frame -1 material texture 0.500000 bone -1
+vertex -1 material = vertex 0.500000 anim
+0.500000 = frame vertex
+0.500000
+=
+-1 texture anim = vertex frame material = 1.0 material 1.0 0.500000 = frame material
+vertex 1.0
+-1 vertex vertex material
+anim
+0.500000
+vertex
+0.500000 = -1 bone anim vertex
+vertex 0.500000
+material = texture anim
+texture -1 bone frame vertex
+1.0 texture
+vertex -1
+= -1 texture texture material material
+bone vertex frame -1 = frame 1.0 -1 vertex
+bone 1.0
+frame 1.0 = material
+1.0
+material material texture
+frame
+= bone -1 anim texture
+frame frame 1.0
+1.0 frame
+-1 bone vertex frame
+frame
+0.500000 anim
+frame frame 1.0 texture
+material material
+material
+=
+material
+bone
+1.0 vertex
+-1
+0.500000 texture bone frame vertex material
+vertex
+texture
+material = 0.500000
+material 1.0 1.0 = bone anim 1.0 0.500000 = 0.500000 frame -1 1.0 -1 = vertex
+= anim texture -1 1.0 anim 1.0 = = material texture -1 anim bone frame anim texture 0.500000 1.0 -1 texture
+-1 1.0 vertex anim material -1 -1 = frame
+vertex
+= -1 anim material =
+frame material bone texture = texture anim frame
+bone texture
+anim vertex vertex texture bone
+anim
+bone bone anim anim
+= = bone -1 anim bone = = texture texture vertex 1.0 frame anim vertex
+1.0
+bone
+material anim frame frame = texture 1.0 vertex anim frame texture 1.0 -1
+anim
+frame 1.0
+bone -1 frame bone
+anim frame 0.500000
+material texture vertex
+anim 1.0
+1.0 -1 texture frame vertex 1.0 0.500000 0.500000
+bone 1.0
+0.500000 anim vertex 1.0
+anim texture anim
+vertex
+vertex frame
+texture
+= frame -1 vertex texture
+texture material 1.0 texture
+0.500000
+-1 -1 1.0 = 1.0 frame material
+-1
+material
+1.0
+frame vertex 0.500000
+material material
+vertex 0.500000
+0.500000 bone = frame -1 material
+anim
+vertex material texture bone 1.0 1.0 frame material = frame
+0.500000 1.0 bone anim =
+texture anim 1.0 material material frame texture texture
+1.0 -1
+= = bone bone
+texture texture texture
+vertex
\ No newline at end of file
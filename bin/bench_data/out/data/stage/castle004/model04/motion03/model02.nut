@@ -0,0 +1,3 @@
+bone 1.0 0.500000
+0.500000 =
+-1 frame texture = = textu
\ No newline at end of file
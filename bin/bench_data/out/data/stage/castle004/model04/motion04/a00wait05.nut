@@ -0,0 +1,6 @@
+vertex = -1 bone texture =
+frame 0.500000
+vertex material bone = vertex -1 -1 =
+=
+anim anim material anim
+0.500000 vertex bone v
\ No newline at end of file
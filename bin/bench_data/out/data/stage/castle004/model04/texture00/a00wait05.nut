@@ -0,0 +1,87 @@
+anim -1 bone frame frame
+anim
+0.500000
+anim = = 1.0 vertex -1 bone anim
+vertex material texture 1.0 0.500000
+0.500000 texture anim 0.500000
+1.0 0.500000 -1 material texture material 0.500000
+texture = material 0.500000 material 0.500000 1.0 vertex frame -1 texture
+0.500000
+material texture material frame
+texture frame vertex
+bone -1 bone =
+0.500000 0.500000 = bone = anim anim bone
+texture bone 0.500000 = 1.0
+vertex anim
+texture anim anim = =
+material
+0.500000 1.0
+= vertex texture vertex bone vertex 1.0 anim 0.500000 0.500000 vertex
+frame bone frame frame texture 0.500000
+0.500000 texture
+bone anim 1.0 bone 0.500000 bone vertex anim
+bone texture anim texture = -1 texture bone texture -1 frame anim
+vertex
+material = material
+anim -1
+material
+-1
+anim bone bone -1 0.500000 bone frame bone -1 vertex anim
+frame
+texture
+material bone =
+texture anim
+anim
+0.500000 anim =
+= frame =
+1.0 1.0 0.500000 1.0 anim bone
+material material 0.500000
+1.0
+-1 anim material vertex 1.0 bone
+bone anim -1 bone texture anim 0.500000 vertex
+texture bone
+anim
+texture material vertex material
+0.500000 anim vertex 0.500000
+= 1.0 1.0
+0.500000 bone
+1.0 material texture
+frame -1 material
+vertex
+0.500000 anim material = frame frame material -1 =
+vertex -1
+bone 1.0 anim material
+vertex 1.0
+vertex material vertex material frame bone
+anim anim 0.500000 material
+-1
+material
+frame -1 -1 frame 1.0 vertex -1 material material
+anim 1.0 bone texture vertex 1.0
+vertex
+material 0.500000
+frame bone
+anim vertex anim
+-1 bone
+bone material material
+0.500000 texture 0.500000 0.500000 = anim 0.500000 bone
+bone 1.0 frame
+-1 material
+bone frame frame 1.0 -1 1.0
+vertex bone texture vertex
+0.500000 frame -1 =
+material anim = -1 1.0 frame
+1.0 vertex bone
+texture 0.500000
+texture =
+material 1.0
+frame 1.0 0.500000
+texture 0.500000 -1
+bone 1.0
+texture vertex = = vertex -1
+1.0 vertex anim frame 1.0 frame 0.500000 bone vertex frame
+= 1.0 material -1
+texture frame frame texture
+-1
+material material -1 = 0.500000 vertex
+1.0 0.500000 vertex materia
\ No newline at end of file
@@ -0,0 +1,213 @@
+material -1 anim
+0.500000
+frame bone frame texture 1.0
+=
+= = material bone
+vertex = bone bone 1.0 1.0 1.0 1.0 0.500000 -1 0.500000 1.0
+0.500000 frame -1
+anim
+0.500000 texture = material = vertex frame
+material -1
+0.500000
+material material
+texture 0.500000
+-1 -1 anim =
+anim 1.0 bone
+1.0 bone
+bone
+= = material
+vertex texture
+vertex -1 anim frame material anim anim
+vertex
+0.500000 vertex 0.500000 anim 1.0 = =
+= 1.0 -1 1.0 1.0 = frame bone = = = bone 1.0 bone texture bone texture material frame bone = frame frame frame
+0.500000
+=
+texture
+anim
+0.500000
+anim = = bone 1.0 1.0 -1 material -1 1.0 material 0.500000 vertex
+1.0
+anim vertex frame = frame frame = frame
+= -1
+-1 material
+frame texture
+anim = =
+frame 1.0
+bone
+frame
+=
+1.0
+frame 1.0 1.0
+bone 1.0 material frame
+bone material
+1.0 bone bone bone bone texture anim
+material
+bone = vertex bone = 0.500000
+frame
+= bone bone bone 1.0 anim 0.500000 1.0
+texture texture -1 texture bone
+vertex
+-1 0.500000 anim vertex -1
+-1 texture frame material 0.500000 anim frame -1 frame vertex -1 0.500000 bone
+texture frame
+= frame -1 0.500000 =
+material
+anim =
+0.500000
+-1 texture 0.500000 -1 frame bone
+= bone 0.500000
+1.0
+texture texture -1 1.0
+vertex
+vertex
+anim bone -1 frame
+1.0
+1.0 texture material vertex 1.0 vertex material =
+1.0
+material
+bone frame texture frame
+anim
+1.0 vertex 0.500000 material
+frame frame vertex = -1 = material
+vertex 0.500000 vertex = 0.500000 anim 0.500000 bone vertex anim
+bone vertex 1.0 bone -1 texture 0.500000 frame
+texture
+-1 0.500000 0.500000
+material vertex -1 material material vertex
+= texture
+0.500000 1.0 bone texture -1 vertex
+-1 frame = 0.500000 -1
+material texture 1.0 1.0 = anim frame 1.0 texture = 1.0 =
+vertex bone -1
+-1 1.0
+frame
+bone 1.0
+anim =
+-1 1.0
+anim frame bone 0.500000 texture frame anim -1 0.500000
+material
+0.500000 frame anim bone frame 0.500000 material material
+vertex
+material vertex vertex vertex 1.0 vertex
+anim frame
+= 0.500000 bone
+texture 0.500000 frame -1 = 0.500000 = material
+bone frame 1.0 = frame
+vertex 0.500000 -1
+anim vertex
+-1 material 0.500000 texture anim vertex -1 -1 1.0 anim texture -1 1.0
+frame vertex
+material 0.500000
+bone 1.0 bone -1 1.0
+vertex vertex material -1 frame texture
+material texture 0.500000 frame
+material = frame anim -1
+1.0 1.0 0.500000
+= vertex
+anim bone = = material 1.0 1.0 bone 0.500000 0.500000
+frame
+1.0
+frame
+-1 -1 texture material -1 texture material
+vertex 1.0 bone 1.0 material 0.500000 -1
+anim texture bone anim -1 anim texture =
+bone 1.0
+texture -1
+anim
+bone frame 0.500000 frame 1.0 -1
+bone bone bone vertex
+texture bone
+frame texture
+anim 0.500000 1.0
+vertex bone
+vertex
+1.0 texture bone material frame
+1.0
+texture 1.0 1.0
+0.500000 material 1.0 material = vertex frame texture
+-1 1.0 texture bone
+texture vertex frame material = -1 -1
+anim texture 1.0
+material texture =
+texture vertex vertex -1 bone texture =
+-1
+=
+frame
+bone
+frame
+bone
+vertex material vertex vertex material = frame anim material = frame vertex 0.500000 texture
+= 1.0
+1.0 = bone
+-1 1.0
+0.500000
+material frame
+-1 frame texture texture texture
+vertex texture
+anim material vertex bone material = bone = frame bone 0.500000
+material = frame
+0.500000 0.500000 1.0 =
+= = vertex vertex
+frame
+material =
+1.0
+anim = frame anim bone anim
+anim frame anim 1.0
+1.0 anim texture 1.0 =
+anim 1.0
+1.0 1.0 -1 vertex
+frame vertex frame -1
+-1 texture anim -1 frame 1.0
+-1 = anim vertex
+1.0 texture anim
+anim 0.500000 frame -1 texture =
+texture
+1.0 1.0 vertex
+-1 1.0
+texture
+anim = vertex 1.0 material =
+1.0 = frame frame -1 texture 0.500000 =
+vertex texture
+1.0 material -1
+= =
+material 0.500000 0.500000
+-1 bone =
+= 0.500000 =
+= vertex
+anim 0.500000
+0.500000
+1.0 anim frame vertex vertex
+frame material vertex frame
+0.500000 vertex
+frame
+vertex -1 vertex material vertex vertex bone =
+-1 0.500000 anim 0.500000 bone vertex bone 0.500000
+texture material -1 texture
+bone =
+anim 0.500000
+material
+anim bone
+bone
+anim = =
+bone bone frame vertex
+bone texture texture = material
+texture frame = texture
+texture frame frame
+vertex
+vertex
+= frame 0.500000 material = 1.0 bone
+-1 frame 0.500000 frame material = bone frame vertex
+texture
+anim
+0.500000
+frame
+= 1.0 = frame anim = 0.500000 frame bone
+-1 -1
+material anim anim
+-1 -1 bone 1.0 bone bone -1 texture 0.500000
+=
+1.0
+anim material anim
+vertex
+-1 -1 
\ No newline at end of file
@@ -0,0 +1,82 @@
+anim bone material
+material
+= 0.500000 anim = 0.500000 =
+anim texture anim 1.0
+frame = -1 anim = material material 1.0
+1.0 frame 1.0 -1 texture 0.500000 = bone anim
+bone
+material
+material anim
+-1 0.500000 frame
+1.0
+= vertex texture vertex
+frame
+material anim 0.500000 frame
+-1 texture = vertex -1 material 0.500000 = -1
+vertex
+-1
+anim
+1.0 material 1.0 1.0 texture vertex vertex frame 0.500000
+anim
+= = material =
+0.500000 1.0
+material
+1.0
+0.500000
+bone = frame material 1.0 = vertex anim 0.500000 material 1.0 texture 1.0
+bone -1
+1.0
+1.0 0.500000 -1
+texture = vertex bone texture texture texture 1.0 bone = 1.0
+= -1 bone vertex
+bone =
+bone =
+-1 = material
+0.500000 vertex anim 0.500000 vertex
+1.0 frame = frame
+vertex 1.0 1.0 0.500000 0.500000 1.0 bone vertex vertex vertex -1
+1.0 -1 texture 0.500000
+-1
+anim vertex
+1.0 vertex 1.0 frame texture material texture
+texture
+= 1.0
+bone
+0.500000
+-1 bone 0.500000
+frame bone
+1.0 frame frame 1.0
+-1
+0.500000 bone
+material frame
+bone material 0.500000 -1
+bone anim anim =
+0.500000
+bone
+0.500000
+anim
+bone
+texture frame bone anim frame vertex
+0.500000
+1.0 vertex = material frame
+anim frame 0.500000 anim 1.0 material -1 1.0
+-1 -1 0.500000 material anim frame bone anim
+texture 1.0 anim vertex frame 0.500000 =
+= = bone 1.0 material 1.0 -1 anim material material texture bone -1 bone texture = texture
+material material 0.500000 0.500000 vertex texture 0.500000 frame 0.500000 vertex vertex vertex -1 frame bone 0.500000 0.500000 vertex
+frame
+anim texture material
+anim frame frame
+texture 0.500000
+1.0 anim 0.500000 frame 0.500000 bone
+anim vertex anim texture
+material 1.0 0.500000
+= material
+1.0
+0.500000 0.500000 1.0 -1 =
+bone frame bone -1
+1.0 vertex anim
+anim vertex anim 0.500000 1.0
+-1 -1
+texture
+frame anim
\ No newline at end of file
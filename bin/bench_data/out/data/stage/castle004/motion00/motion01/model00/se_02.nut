@@ -0,0 +1,42 @@
+texture -1
+anim
+frame 0.500000 frame 0.500000 vertex -1 anim material anim 1.0 0.500000 material frame frame
+anim frame
+= = 0.500000 bone material 1.0 =
+frame frame
+anim vertex 1.0 frame anim vertex = texture
+vertex bone -1
+0.500000 texture material
+anim
+1.0 0.500000 frame vertex texture vertex material = =
+frame anim anim
+-1 vertex -1 frame
+anim 0.500000 1.0 0.500000 anim texture 0.500000 vertex -1 frame material 0.500000 -1
+texture -1 texture 0.500000 0.500000 material 0.500000 0.500000 0.500000 -1
+anim anim texture anim
+bone frame vertex texture = material
+texture material vertex
+=
+material material
+texture
+0.500000 0.500000 -1 frame texture material
+vertex vertex texture material material
+material anim -1 frame 1.0 -1
+material
+anim vertex
+frame texture anim
+texture vertex vertex vertex -1 -1 bone 1.0 vertex -1
+=
+-1 bone -1 vertex = -1 anim frame frame 1.0 vertex
+material
+anim
+material material 0.500000 material 1.0 -1 texture texture
+bone 0.500000 anim -1
+vertex
+material bone = anim material anim
+1.0 material
+vertex texture
+0.500000 0.500000 frame anim texture texture -1 1.0
+bone 0.500000
+anim -1 frame vertex
+0.500000 anim 0.
\ No newline at end of file
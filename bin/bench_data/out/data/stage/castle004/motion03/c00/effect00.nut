@@ -0,0 +1,2 @@
+vertex = -1 0.500000 = = vertex -1 1.0
+bone mate
\ No newline at end of file
@@ -0,0 +1,29 @@
+frame 1.0 = 0.500000
+1.0 1.0 bone material frame
+1.0 vertex 0.500000 texture texture
+frame bone
+anim =
+material
+bone
+frame frame vertex
+texture -1 frame 1.0 anim vertex
+anim material material frame anim texture frame = frame anim = 1.0
+bone -1
+vertex
+-1
+vertex 0.500000
+material bone 1.0
+1.0 frame
+bone vertex material anim -1 = 1.0 material frame
+material
+material frame 0.500000 vertex 1.0
+= bone
+vertex 1.0 =
+-1 -1 texture vertex
+vertex 0.500000
+1.0
+anim frame -1
+1.0 -1 texture
+vertex texture vertex 1.0 -1 -1 -1 vertex 1.0 = vertex anim anim anim
+material frame
+0.500000 material
\ No newline at end of file
@@ -0,0 +1,85 @@
+1.0 frame -1 0.500000 bone material anim vertex 0.500000
+0.500000 anim
+= texture anim
+texture
+0.500000
+1.0 material vertex 1.0 0.500000 1.0 = vertex material 1.0 1.0 -1 frame frame bone
+bone material bone texture
+= bone material 0.500000 bone 1.0
+frame anim anim
+bone texture vertex 0.500000
+0.500000
+texture
+bone vertex texture material bone
+material frame material
+-1
+-1 1.0 bone
+material
+vertex frame texture bone
+-1
+bone = texture
+frame texture bone bone bone material
+1.0
+-1 0.500000 texture
+-1 material bone
+0.500000 frame 1.0 bone
+= =
+anim frame
+0.500000 anim material anim anim bone bone material
+material =
+bone 1.0 1.0
+0.500000 frame = anim = 0.500000 1.0 0.500000
+= 1.0 vertex -1 vertex vertex frame
+vertex
+frame texture = = texture frame 1.0
+bone = texture 1.0 material
+frame = vertex 1.0 -1 texture -1 anim
+-1 anim 0.500000 material
+texture -1 vertex bone
+-1 = texture texture material 1.0 texture 1.0
+0.500000 frame texture bone
+texture = -1 -1 anim =
+1.0 frame = material
+-1
+bone anim frame = bone
+bone 0.500000 -1 material
+anim material 0.500000 texture -1 frame texture = = frame texture -1 1.0
+1.0 -1 frame frame
+bone 1.0 0.500000 0.500000
+material 0.500000
+1.0 anim texture bone
+texture texture frame
+vertex -1 = = 1.0 frame
+anim = =
+1.0 anim
+bone
+vertex bone texture -1 = material 0.500000
+frame vertex vertex frame
+-1
+material material
+bone bone
+anim frame vertex 0.500000 0.500000
+texture frame
+=
+-1 -1 material = = -1 0.500000
+=
+bone
+1.0 material frame 1.0
+texture bone material
+anim texture material
+material material = vertex frame
+= bone 1.0
+= vertex 0.500000 material -1 bone -1 1.0 1.0 = material 0.500000 -1 anim 1.0 texture
+1.0 texture
+0.500000 texture bone 0.500000 = -1
+anim 1.0 -1 vertex 0.500000 material bone material bone
+material 0.500000 1.0
+anim = anim
+-1 bone material material texture vertex texture = texture texture
+bone texture -1
+frame -1 1.0
+=
+vertex anim
+-1
+1.0 frame -1
+1.0 = -1 1.0 = = -1 = 0.5000
\ No newline at end of file
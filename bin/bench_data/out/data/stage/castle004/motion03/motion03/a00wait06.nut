@@ -0,0 +1,31 @@
+0.500000 -1 frame frame vertex vertex texture frame texture
+0.500000 vertex texture frame 1.0 0.500000 bone vertex
+vertex
+1.0 anim vertex frame
+-1 frame texture material 0.500000 material -1 anim =
+vertex material -1 0.500000 0.500000
+=
+-1 0.500000 -1
+0.500000 texture vertex anim texture bone frame 0.500000
+-1 texture 1.0
+bone -1
+anim vertex anim 0.500000 frame anim
+bone 1.0
+anim material -1 material 0.500000 texture bone
+anim
+1.0 = material
+vertex = vertex bone material texture vertex texture
+bone -1 0.500000
+-1 vertex
+frame vertex anim frame 1.0 = 1.0 anim 0.500000
+texture -1 frame
+material frame = vertex -1 = =
+frame 1.0 0.500000 anim material =
+1.0 material anim vertex 0.500000 material vertex bone material
+bone -1 texture -1 1.0 material anim
+frame
+0.500000 1.0 vertex -1 -1 anim vertex
+= vertex =
+anim vertex 1.0 0.500000 1.0 texture anim material
+=
+frame 0.500000 =
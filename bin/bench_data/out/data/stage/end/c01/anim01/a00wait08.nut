@@ -0,0 +1,4 @@
+-1 0.500000 material anim
+0.500000 -1 1.0 bone frame frame 0.500000 bone
+texture = bone
+frame 0.500000 1.0 material bone vert
\ No newline at end of file
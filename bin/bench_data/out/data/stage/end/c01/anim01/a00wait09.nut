@@ -0,0 +1,19 @@
+-1 bone bone bone
+1.0 frame material = 1.0 vertex anim texture = 1.0
+-1 texture texture frame vertex = frame anim 1.0 1.0 texture -1 =
+anim material 0.500000 -1
+= texture material frame anim frame = -1 1.0 vertex bone -1
+bone 1.0 texture
+material material bone
+vertex vertex bone
+texture
+vertex 0.500000 = bone 1.0 frame anim bone material
+0.500000
+1.0 vertex bone = material = texture
+= =
+material 0.500000 frame 1.0 bone
+vertex anim 0.500000 vertex bone
+bone material
+anim bone -1 = frame -1 texture vertex anim 1.0
+vertex bone frame -1
+0.500000 anim 1
\ No newline at end of file
@@ -0,0 +1,31 @@
+frame 1.0 anim vertex = =
+1.0 = frame vertex material bone
+= material 1.0 frame -1 material bone 1.0 -1 material 0.500000
+frame anim frame anim material texture texture 1.0 bone vertex =
+anim
+= 0.500000 -1
+texture
+frame bone
+bone
+-1 material
+0.500000
+material frame
+bone vertex texture = anim 1.0 0.500000
+texture =
+= bone frame texture material
+=
+anim
+material
+-1 bone bone bone material
+anim = -1 1.0 anim
+0.500000 anim anim
+frame -1
+material texture
+-1
+texture
+0.500000 1.0
+1.0
+material
+frame vertex -1
+-1 frame bone -1 1.0
+frame 0.
\ No newline at end of file
@@ -0,0 +1,159 @@
+frame frame texture = 1.0
+1.0 = 1.0 vertex = bone
+= -1 bone
+1.0
+vertex
+1.0 frame
+frame vertex texture
+0.500000 anim 0.500000 1.0 texture bone
+-1 =
+material bone 0.500000
+1.0 vertex
+vertex material bone 1.0 anim = -1 material vertex
+anim frame frame 1.0
+vertex -1 0.500000 1.0 texture bone 0.500000
+frame
+= 1.0 material -1
+=
+anim
+=
+frame 1.0
+texture bone texture vertex
+1.0 anim 0.500000 = 0.500000 -1 anim -1 anim 1.0 0.500000 bone texture bone frame
+1.0 texture texture
+-1
+frame
+frame texture 1.0 bone texture material anim
+texture 1.0
+0.500000 frame 1.0
+vertex 0.500000 anim 0.500000
+material 1.0
+-1 -1 = anim = = texture texture 0.500000 -1
+material
+= =
+material
+= = -1 0.500000 1.0
+vertex
+vertex 0.500000 0.500000
+1.0 material frame -1
+frame frame
+texture material material texture bone
+frame 0.500000 frame
+1.0 bone vertex frame
+1.0
+anim
+anim
+frame -1 0.500000 -1 0.500000
+-1
+anim
+frame 0.500000 1.0 material material anim anim bone 1.0 = anim frame frame 0.500000
+0.500000 1.0 1.0 = material -1 texture 1.0
+vertex vertex vertex
+bone material 0.500000
+bone anim
+anim texture material
+material
+bone material vertex anim frame
+bone vertex anim
+bone
+frame frame -1 anim = frame =
+= material 1.0 material
+bone
+material texture anim
+texture bone -1
+0.500000 0.500000 bone 0.500000 0.500000 -1 bone 0.500000
+-1 bone vertex bone
+= 1.0 1.0 0.500000 1.0 anim = texture
+frame 1.0 vertex bone 0.500000 bone texture anim vertex anim -1 = -1 1.0 = 0.500000 texture 0.500000 bone anim material material bone -1 -1 material vertex
+anim -1 vertex 1.0 texture =
+material material
+anim
+0.500000 bone
+0.500000 = 1.0 vertex texture -1 0.500000
+vertex
+-1
+texture =
+material texture texture anim 1.0 0.500000
+material bone
+bone
+frame anim 0.500000 1.0 texture
+bone material vertex frame 0.500000 1.0 anim vertex material 1.0
+vertex anim
+= -1
+-1
+texture material frame anim
+frame
+1.0 bone
+vertex -1
+0.500000 texture vertex anim 1.0 anim
+anim anim material material
+bone frame
+anim vertex
+material 1.0 0.500000
+material material -1 vertex vertex 1.0 1.0 0.500000 texture
+1.0 -1
+anim material
+material frame -1
+-1 vertex 0.500000 =
+= 1.0 material frame
+frame frame
+anim
+material texture vertex texture
+vertex -1 vertex
+bone 1.0 -1 bone -1 bone
+texture =
+-1 anim 1.0 = vertex
+bone -1 anim
+texture vertex
+vertex = anim
+1.0
+frame -1 material frame -1 -1 1.0 texture texture frame 0.500000
+vertex 0.500000
+frame = material
+= frame material
+anim
+material frame 1.0 anim 0.500000 material = = 1.0 anim = bone texture anim
+vertex material texture 0.500000 bone anim anim vertex vertex bone -1 anim
+texture
+-1 frame vertex anim anim = -1
+frame 0.500000 frame texture bone material frame anim texture -1
+vertex
+texture = texture
+material frame bone vertex anim
+texture
+= anim
+frame bone frame anim 1.0 = -1 bone
+anim 0.500000 vertex 0.500000 -1 anim texture 1.0 anim 1.0 -1
+texture vertex 0.500000 texture =
+bone -1 frame vertex vertex material = vertex frame
+= bone texture anim
+anim
+texture -1 1.0 1.0
+=
+frame
+bone
+frame -1
+bone frame texture -1
+vertex vertex -1 vertex
+material
+bone
+= vertex material anim vertex = 1.0 0.500000 bone texture
+-1 = = 0.500000 bone bone 1.0 1.0 0.500000 = anim
+= 0.500000 1.0
+anim frame vertex frame texture 1.0 anim
+1.0
+= material texture
+0.500000 -1 -1 frame 0.500000 anim
+material = = 0.500000
+texture anim
+material
+= material = 0.500000 = frame 0.500000
+frame texture = texture
+-1 material 1.0 bone vertex -1 texture =
+texture 0.500000 = bone 0.500000
+-1 texture frame texture frame
+vertex 1.0
+bone
+anim -1 frame -1 texture =
+texture 1.0 vertex
+-1 material 0.500000 verte
\ No newline at end of file
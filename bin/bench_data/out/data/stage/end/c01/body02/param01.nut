@@ -0,0 +1,2 @@
+vertex = vertex vertex
+0.500000 t
\ No newline at end of file
@@ -0,0 +1,83 @@
+frame 1.0 frame bone texture 0.500000
+bone 0.500000 =
+1.0
+material = frame -1 material 0.500000 0.500000 0.500000
+vertex
+texture anim 1.0 1.0 vertex = bone 0.500000 0.500000 vertex
+bone material frame material = 0.500000
+vertex bone =
+frame 0.500000 anim 1.0
+0.500000 0.500000 bone 0.500000 frame
+anim bone frame
+frame frame vertex 0.500000 material =
+0.500000 anim = -1 -1
+bone bone -1 1.0 anim frame frame 1.0 vertex texture
+frame
+-1 vertex vertex
+frame = vertex material -1 anim
+1.0 bone -1 bone
+1.0 bone
+1.0 -1
+1.0
+-1 frame 1.0 0.500000 -1
+-1 material
+vertex 1.0
+texture bone
+-1 0.500000
+bone texture -1 material vertex anim frame
+frame
+-1 anim
+1.0 bone vertex frame = frame vertex texture -1
+-1 0.500000 material anim material bone 1.0 vertex material material bone -1 material -1 material texture material = 0.500000 -1 bone bone 1.0 =
+anim frame -1
+frame
+texture material 0.500000
+material frame material 1.0
+1.0 = = material
+material frame
+-1
+frame frame material anim texture anim
+bone 1.0 1.0 frame vertex
+vertex
+1.0 texture vertex anim -1 bone 1.0
+bone 1.0 anim 1.0 1.0 texture 1.0 1.0 bone
+0.500000
+-1 material material 1.0 material
+frame -1 frame
+anim
+bone bone
+= frame
+vertex -1 vertex =
+texture vertex texture
+-1
+material = 1.0 -1
+= anim vertex -1 0.500000 vertex frame
+-1 vertex texture =
+-1 material
+vertex 1.0 = texture frame vertex 1.0 texture =
+-1 material
+1.0
+1.0
+0.500000 -1 0.500000 anim anim bone frame material
+frame =
+-1 anim frame -1 anim -1 material vertex 0.500000
+0.500000
+frame -1
+material
+anim
+= frame
+= texture vertex
+anim 1.0 anim -1 1.0
+texture
+texture 0.500000 frame texture frame frame 0.500000
+texture
+0.500000
+0.500000 1.0 texture anim 1.0 texture
+1.0 bone 0.500000
+texture frame material 1.0 vertex anim texture
+0.500000 texture -1 vertex
+frame -1 texture texture texture 1.0
+bone vertex -1 texture
+anim bone
+anim anim 0.500000 1.0 texture frame
+texture frame 1.0 frame
\ No newline at end of file
@@ -0,0 +1,15 @@
+texture
+frame material material 0.500000 -1
+frame texture bone anim = 1.0 0.500000 = frame = 1.0 material
+frame anim frame vertex 0.500000 bone -1 = bone vertex vertex =
+0.500000 -1
+0.500000 bone = 0.500000
+0.500000 0.500000 0.500000 -1
+anim
+frame = 1.0 bone
+texture texture frame -1 texture -1
+vertex anim anim
+1.0 -1 1.0 1.0 -1
+vertex 0.500000
+= = material =
+material texture 0.500000 material text
\ No newline at end of file
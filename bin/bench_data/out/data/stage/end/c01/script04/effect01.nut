@@ -0,0 +1,231 @@
+-1 0.500000 -1 0.500000 1.0 vertex
+vertex frame texture
+frame bone material anim frame anim vertex
+texture material texture material
+1.0 material
+material bone
+-1 texture
+-1 bone 0.500000 material 1.0
+0.500000 texture
+0.500000 texture 1.0 vertex texture 0.500000 anim
+vertex
+=
+-1 -1 bone bone frame bone
+vertex bone 0.500000 texture
+0.500000 bone vertex =
+anim = bone vertex material
+0.500000
+texture -1 anim bone -1 bone
+-1 0.500000 0.500000
+texture 1.0 material = bone 0.500000
+1.0
+1.0 frame vertex
+= 1.0 frame
+vertex = bone frame 1.0 frame
+anim texture
+1.0
+1.0 0.500000 0.500000 frame = = texture 0.500000 bone
+bone 0.500000 anim frame 0.500000 = material = material 0.500000 bone texture bone anim texture
+0.500000 bone bone 1.0 1.0
+bone = anim
+bone vertex -1 material
+-1
+= =
+texture texture 1.0 0.500000
+texture vertex 0.500000 bone frame anim material bone 0.500000 =
+bone -1 bone bone = material material vertex frame anim
+texture
+=
+-1 -1 vertex
+texture anim
+material
+anim bone anim texture
+anim frame = frame vertex
+-1 1.0 bone
+-1
+=
+vertex vertex =
+vertex texture vertex
+anim texture anim bone vertex frame bone -1
+bone frame = frame
+0.500000
+1.0 material -1
+-1
+= 1.0 frame bone
+= = vertex 1.0 0.500000 = material
+anim
+bone
+bone texture = = 1.0
+bone =
+texture 0.500000
+= bone anim
+anim
+frame frame vertex texture anim
+anim texture = texture = bone -1
+0.500000 0.500000 -1 anim
+texture texture bone texture frame = frame texture
+0.500000 frame anim
+frame = vertex bone material bone texture anim -1
+material anim 1.0
+material =
+anim bone frame bone
+frame material =
+0.500000 0.500000
+frame =
+anim 1.0 anim = 0.500000 anim vertex = texture material frame material 1.0 bone bone texture material
+-1 -1
+1.0 anim
+1.0 bone =
+1.0 1.0 1.0 material material bone
+-1 -1 = anim
+-1 vertex vertex
+material =
+texture 1.0 -1
+-1
+texture texture anim vertex vertex frame
+0.500000 material anim 0.500000 vertex vertex
+anim material anim anim = 0.500000 1.0
+anim vertex 0.500000 1.0 material
+anim
+texture vertex 0.500000 1.0 texture vertex vertex = material 0.500000
+= vertex frame bone = material material vertex
+0.500000
+0.500000 vertex
+texture
+bone texture texture 0.500000
+frame 1.0 texture 1.0 texture texture texture
+1.0 material
+= bone
+0.500000 anim
+= material
+0.500000 0.500000 vertex bone
+1.0 = material -1 material material 0.500000 texture material = texture frame
+material frame 0.500000 frame
+-1
+1.0 0.500000 1.0 texture 1.0 bone bone texture =
+texture material vertex
+=
+anim anim anim material -1
+0.500000 texture -1 1.0 bone
+material
+texture 0.500000 bone texture
+0.500000 frame anim
+bone
+bone = 0.500000 -1 1.0 vertex 0.500000 = 0.500000 frame
+1.0 material 1.0
+=
+= 1.0 texture bone anim vertex bone = -1 frame
+bone
+frame texture material -1 texture vertex 0.500000 -1
+1.0 vertex
+bone material
+frame -1 material
+texture frame frame vertex
+-1 texture material
+anim = anim 1.0 vertex
+texture vertex vertex
+anim frame 1.0 0.500000 material material bone frame -1 bone 0.500000
+frame anim
+frame material
+bone
+= anim
+vertex
+texture 0.500000 0.500000
+texture bone
+vertex -1 bone =
+texture anim
+bone = anim bone anim = 0.500000 0.500000 anim bone material
+texture
+anim material -1 material 0.500000 anim vertex texture -1
+0.500000 =
+anim = bone
+=
+0.500000 -1 1.0 1.0
+0.500000 1.0 bone frame texture
+frame vertex
+-1 bone material bone -1 0.500000 -1 0.500000 vertex
+frame 1.0 texture texture frame
+1.0 -1 anim 0.500000 bone = material
+anim = texture 0.500000
+1.0 0.500000 texture frame anim frame anim bone material texture = bone material material -1 -1
+-1 vertex texture
+= vertex bone
+texture frame material
+-1
+1.0 vertex anim 1.0 anim vertex frame frame
+frame
+frame vertex anim vertex bone frame material
+vertex
+anim 1.0 -1
+1.0 -1 1.0 0.500000 = anim
+frame texture material -1 = material 1.0
+material 0.500000 1.0 bone
+-1 texture bone frame -1 = bone material material texture -1
+anim = frame = anim
+texture 1.0 1.0
+anim -1
+1.0
+-1
+0.500000 texture -1 =
+0.500000 1.0 bone =
+texture 0.500000
+texture
+0.500000 1.0 0.500000 anim
+vertex texture
+vertex anim 1.0
+texture bone 0.500000
+texture 1.0 anim
+texture
+1.0
+material material vertex =
+anim
+frame -1 1.0
+1.0 anim texture frame material
+texture vertex texture anim 0.500000 bone 1.0 bone anim =
+0.500000
+= material frame 0.500000 frame vertex = anim anim texture 1.0 0.500000 vertex material 1.0
+vertex
+vertex
+1.0 bone 0.500000 1.0
+1.0
+-1 1.0
+-1 bone material bone bone
+texture
+-1 1.0
+texture
+bone 1.0 =
+texture -1
+0.500000 anim vertex
+texture -1
+vertex
+1.0 anim = texture vertex texture -1 = vertex
+vertex vertex 1.0 texture = anim = bone bone 1.0
+0.500000 1.0 texture texture anim anim 1.0
+= anim
+material bone
+frame
+anim material 1.0 vertex -1
+1.0 =
+-1 frame texture
+= = texture 0.500000
+texture 0.500000
+vertex
+texture anim
+0.500000 1.0 vertex
+texture anim
+vertex -1 vertex frame
+material frame anim 0.500000 anim
+1.0 texture material = = 0.500000 texture frame = frame
+bone
+0.500000
+frame
+texture
+bone 0.500000 texture material 1.0 texture
+-1 texture vertex 1.0 bone 1.0
+anim =
+1.0 -1 -1 0.500000
+frame anim texture vertex
+material material vertex material 1.0 bone
+anim = frame anim frame = bone
+texture bone -1 0.500000 bone 1.0 vertex frame = vertex 1.0 0.500000 -1 1.0 bone = bone frame material 0.500000 0.500000
+te
\ No newline at end of file
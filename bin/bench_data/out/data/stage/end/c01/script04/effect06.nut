@@ -0,0 +1 @@
+texture texture texture anim 1.0
\ No newline at end of file
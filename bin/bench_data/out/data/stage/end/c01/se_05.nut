@@ -0,0 +1,72 @@
+1.0 frame 1.0 0.500000 1.0
+texture -1 bone texture material -1 vertex
+= bone bone texture
+bone vertex material -1 frame anim 0.500000 0.500000 0.500000
+0.500000 frame material vertex anim frame frame 0.500000 -1 vertex texture 1.0 1.0 material
+anim
+texture 1.0 bone material -1 bone
+vertex
+frame material material anim vertex
+frame 1.0 frame
+texture = =
+vertex 0.500000 vertex
+1.0
+vertex bone material anim =
+material vertex
+= vertex
+frame
+vertex -1
+1.0
+anim texture vertex 0.500000
+vertex vertex = 0.500000 vertex anim anim texture = texture anim frame
+anim 1.0 texture
+vertex -1 0.500000
+vertex 0.500000 frame
+0.500000 vertex frame vertex 1.0 bone
+material texture anim
+material texture
+vertex texture bone
+vertex vertex
+vertex
+-1 -1 1.0
+texture vertex anim bone bone bone
+vertex material bone
+bone anim texture texture -1 material 1.0 =
+bone frame bone
+-1
+1.0 texture =
+0.500000 frame -1 -1
+0.500000 -1 1.0
+bone frame -1 vertex anim anim
+bone = vertex texture anim material
+frame material 0.500000 texture = -1 texture anim frame vertex vertex
+bone bone -1 vertex frame bone frame 1.0
+anim texture -1 anim 1.0 texture frame
+-1 frame
+0.500000 anim anim frame vertex texture vertex
+anim vertex
+material material texture -1
+texture 0.500000 material
+0.500000 texture texture 0.500000 anim anim material vertex texture
+frame material 0.500000 material texture 0.500000 texture anim material
+bone bone frame bone vertex frame
+0.500000 frame -1 0.500000 material vertex
+bone bone -1 vertex
+0.500000
+vertex = vertex anim material 0.500000 anim material anim vertex frame
+frame frame anim -1 0.500000
+vertex = frame -1
+frame
+bone
+anim -1
+vertex 0.500000 -1 -1 anim 0.500000 material 0.500000 texture 0.500000
+texture
+bone 0.500000 -1 texture frame = -1 material
+= frame bone = material
+vertex material -1 = bone anim vertex frame
+0.500000 material vertex vertex vertex 1.0
+vertex material -1
+= bone 0.500000 material material frame bone
+bone texture
+=
+= texture = 1.0 texture anim frame anim vertex anim material frame
\ No newline at end of file
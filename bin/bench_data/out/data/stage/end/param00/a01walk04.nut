@@ -0,0 +1,2 @@
+frame 0.500000 material = bone 1.0 -1 1.0
+-1 0.500000
\ No newline at end of file
@@ -0,0 +1,23 @@
+vertex texture
+0.500000 anim vertex -1
+= frame 1.0 material 1.0 0.500000 -1 vertex anim bone bone
+bone 1.0 texture 0.500000 1.0 material
+-1 anim vertex bone vertex = vertex
+material anim
+vertex vertex anim -1 material = -1
+=
+material material -1 = texture vertex vertex -1
+frame 1.0 texture anim material anim material material = bone material bone material
+1.0 anim = -1 anim
+1.0 frame bone bone
+-1
+-1 anim 1.0 bone
+0.500000 0.500000 anim 0.500000 material = anim texture 0.500000 -1
+bone vertex anim
+frame
+vertex
+1.0 0.500000 = material 0.500000 1.0 bone
+bone bone = bone vertex =
+bone -1
+material 1.0 bone -1 anim 1.0 0.500000 1.0
+frame 1.0 = bone bone 0.500000 0.5000
\ No newline at end of file
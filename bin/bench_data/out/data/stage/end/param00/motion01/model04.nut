@@ -0,0 +1,359 @@
+anim
+anim texture -1 bone frame
+material 1.0
+material 1.0 = frame 0.500000 anim
+anim
+0.500000 bone -1
+anim vertex vertex
+vertex texture texture
+anim 1.0
+texture = 0.500000 material vertex 1.0 0.500000 frame anim 0.500000 -1 -1 bone material
+bone bone
+material
+texture = frame -1 frame anim
+material 0.500000 0.500000 texture texture texture bone =
+-1 material anim 1.0
+0.500000 = material
+vertex 1.0 0.500000
+anim
+1.0
+anim bone texture vertex
+1.0 vertex 0.500000 vertex frame -1 -1 vertex -1 frame
+frame material material material 1.0 1.0 bone anim 0.500000 anim material frame
+frame = anim
+0.500000
+material frame
+vertex 1.0 bone texture
+-1 = bone anim 0.500000 texture vertex -1 frame material material 0.500000
+-1
+anim bone bone frame
+bone
+material
+material =
+vertex frame texture texture
+0.500000 0.500000 texture
+0.500000 frame texture
+material
+frame 1.0 texture 0.500000
+1.0
+anim = -1 vertex
+0.500000 1.0 anim -1 -1 anim
+1.0
+bone 1.0 anim
+1.0
+vertex vertex
+texture
+frame
+bone
+1.0 = bone
+1.0 bone 1.0 material vertex bone -1
+=
+frame = texture
+frame 0.500000 anim
+anim texture frame
+0.500000
+frame vertex vertex material bone
+anim
+bone
+0.500000 0.500000
+-1 vertex 0.500000 vertex texture material vertex 1.0 texture
+texture
+material
+= =
+vertex texture vertex -1 texture texture frame 1.0 1.0 vertex anim texture material texture texture bone = vertex =
+anim bone frame -1
+material texture =
+0.500000 bone
+anim frame = -1 =
+texture = 1.0 1.0 0.500000
+bone 1.0 -1
+frame bone vertex frame vertex
+0.500000 -1
+texture
+= vertex frame vertex
+frame
+= material
+=
+=
+material -1 vertex -1
+bone vertex -1 0.500000 1.0 frame material
+anim frame
+= 0.500000 0.500000
+anim
+material frame 0.500000 -1 anim bone = 1.0 0.500000
+bone bone vertex anim texture
+= anim
+vertex
+bone anim 1.0 vertex anim -1 = -1 anim vertex texture bone -1 -1 bone frame 0.500000 bone 1.0
+anim 0.500000
+1.0
+bone
+1.0 -1 0.500000 0.500000 bone 1.0 =
+-1 1.0
+material material 1.0 anim anim -1 bone = vertex 0.500000
+=
+-1 1.0 anim texture anim 1.0 bone
+1.0
+bone
+-1 vertex
+anim
+anim 0.500000 = 1.0 bone bone 0.500000 0.500000 frame
+anim material
+= material frame 1.0 bone 1.0
+-1 vertex bone
+vertex 0.500000 frame material -1 frame texture 1.0
+vertex 0.500000
+texture anim texture bone vertex
+bone material 0.500000 anim
+0.500000
+vertex 0.500000 -1
+texture
+= frame bone bone 0.500000 material
+0.500000 frame
+texture
+frame bone =
+frame
+-1 1.0 bone
+1.0
+bone frame texture
+=
+bone material bone texture =
+bone
+anim 0.500000 -1 = anim
+bone
+=
+= = -1 anim anim frame
+frame vertex material
+vertex texture
+0.500000 = frame = frame bone anim frame anim
+-1 vertex vertex
+= frame material -1 = material texture bone = = bone 0.500000 -1 anim
+anim 0.500000 vertex texture material = material anim
+0.500000 = bone vertex
+= 0.500000
+texture
+bone 1.0 -1 1.0
+-1 anim vertex -1
+anim
+frame texture = texture -1 texture
+frame
+material
+=
+bone material texture -1 1.0 -1 anim = frame -1 frame
+-1
+frame
+frame 0.500000 frame -1
+material -1 1.0 -1 vertex = texture bone
+anim 0.500000 bone = texture = bone = material
+frame
+frame bone
+1.0 texture bone 1.0 vertex
+0.500000 anim
+material
+-1 anim texture
+material frame frame
+-1 =
+anim
+material -1 -1
+-1 =
+vertex 0.500000 anim anim
+= 0.500000 0.500000 0.500000 0.500000 texture anim -1 material 0.500000
+0.500000 bone material -1 1.0 bone
+=
+frame 1.0
+-1 frame bone vertex material bone
+vertex frame -1 texture vertex 1.0 frame material
+0.500000 =
+-1
+texture = 0.500000 1.0 vertex texture bone 1.0 anim =
+bone = material 0.500000
+frame
+texture -1
+anim = 0.500000
+anim vertex
+material
+vertex
+anim
+frame anim
+material anim anim texture
+frame 0.500000 = frame texture 0.500000 0.500000
+anim anim anim = anim bone
+frame vertex bone 1.0 material -1 bone bone frame = = 0.500000 material 1.0 anim -1 = 1.0 = anim
+anim
+= 1.0 frame 0.500000
+bone texture
+0.500000 material -1 0.500000 = frame material = = vertex frame 1.0 texture texture material 1.0 frame -1 frame anim
+bone -1 -1 1.0 material
+anim vertex
+1.0 texture
+frame
+-1 bone bone 0.500000 1.0 =
+1.0 = bone 0.500000
+= anim
+frame
+vertex material anim -1 material
+frame anim
+= texture
+1.0 material
+texture bone frame vertex texture = bone anim
+bone vertex material -1 anim anim
+texture anim
+= texture bone anim
+= frame -1 1.0
+bone
+1.0 material
+texture 1.0
+=
+-1 1.0 -1
+1.0
+anim = 1.0 vertex -1
+material frame vertex 0.500000
+material -1
+-1 -1 1.0
+= =
+material 0.500000
+-1 vertex 1.0
+0.500000 texture anim anim
+vertex texture texture
+bone material 1.0
+anim frame -1 0.500000
+bone vertex anim
+frame
+1.0 anim
+material 0.500000 frame -1 -1 -1 material
+-1 texture material
+0.500000 frame anim 1.0
+texture 1.0 material texture 0.500000 material
+-1
+vertex anim
+texture
+vertex
+material = vertex anim texture
+frame anim 0.500000
+texture
+-1 vertex 1.0 frame bone -1 texture 0.500000 frame texture
+vertex
+anim -1 = 0.500000 -1 material vertex vertex texture
+= bone material
+anim = -1
+1.0
+0.500000 material texture vertex bone bone
+-1 anim vertex vertex
+=
+anim = vertex = =
+material material texture material frame = material -1
+1.0 0.500000 bone texture -1 anim anim 1.0 = 0.500000 anim = vertex
+texture vertex
+1.0 vertex material frame bone bone frame = bone vertex anim
+-1
+material material texture
+vertex
+0.500000 0.500000
+= vertex
+0.500000 texture vertex
+frame -1
+= 1.0 texture = texture anim bone 0.500000 texture vertex anim bone frame vertex 0.500000 material 0.500000 material material
+anim vertex
+texture = frame texture
+-1 vertex vertex 1.0 vertex
+material frame 1.0 vertex = -1 = bone 1.0 texture 0.500000
+bone anim 0.500000 frame -1 material frame
+-1
+-1 bone
+= 1.0 material 0.500000
+0.500000
+=
+anim bone
+vertex texture vertex
+= anim anim anim
+texture
+anim texture = vertex anim -1
+frame 0.500000
+0.500000 material frame material bone texture
+anim 0.500000 -1
+vertex -1
+0.500000
+anim frame vertex
+frame = anim
+texture texture anim 0.500000 frame vertex material =
+0.500000 frame material texture texture 0.500000 vertex = texture bone bone bone bone bone = =
+frame = texture texture =
+0.500000
+1.0 material =
+-1 material -1 vertex
+0.500000 anim 1.0 = bone bone 0.500000 vertex
+1.0 frame
+material bone
+1.0
+vertex 1.0 = frame 1.0
+-1
+anim = anim texture material anim bone anim
+material 1.0 anim
+material
+texture bone = frame frame -1 1.0 vertex texture 1.0 frame bone frame
+-1 frame
+bone -1 = vertex 0.500000 texture
+frame 0.500000 = -1 -1
+frame material frame 0.500000
+material 1.0
+anim frame
+1.0 =
+= texture vertex -1 -1 -1
+-1 1.0 texture 0.500000 = anim bone anim material 0.500000 material frame anim -1 texture
+= material vertex anim 0.500000 vertex bone frame texture 0.500000
+vertex
+-1 material
+1.0
+= -1 frame
+=
+anim
+-1 anim
+bone -1 texture -1 material anim 0.500000 -1 vertex texture texture frame 1.0 bone frame
+frame
+frame vertex 1.0
+frame vertex
+-1
+=
+vertex 1.0
+-1
+texture vertex anim bone material frame material frame -1
+-1 bone
+= texture bone vertex = 1.0
+frame = 0.500000
+texture 1.0 -1
+material
+-1 anim -1 -1 material vertex bone 1.0 0.500000 1.0 = material
+material
+vertex frame
+anim
+frame
+0.500000 material 1.0 0.500000 vertex material bone texture frame
+texture anim
+1.0 0.500000
+1.0 1.0 material frame -1 1.0 -1
+texture
+texture texture -1 0.500000 0.500000 frame frame 0.500000 1.0
+= material vertex 1.0 0.500000 anim
+anim bone material
+1.0 material bone bone 0.500000 frame
+-1 texture =
+texture bone anim bone texture
+bone = 1.0
+1.0 texture material
+0.500000
+-1 frame -1 anim
+= vertex = -1 anim 1.0 bone 1.0 material -1 anim 1.0 -1 anim frame material frame vertex 1.0 = texture anim
+anim
+bone = material vertex bone
+material vertex
+anim
+= bone
+0.500000 material
+texture 1.0 vertex anim 1.0 1.0
+texture
+vertex
+anim 1.0 -1 1.0
+texture -1 vertex vertex vertex texture -1 0.500000 frame -1 frame 0.500000
+-1 anim bone vertex
+material bone vertex vertex -1
+bone
\ No newline at end of file
@@ -0,0 +1,2 @@
+texture 0.500000 bone = 1.0 material vertex bone anim frame 1.0 bone 0.500000 frame
+0.50000
\ No newline at end of file
@@ -0,0 +1,32 @@
+1.0 vertex anim 1.0 -1 bone =
+-1
+bone -1 0.500000
+= texture = vertex
+= material
+=
+texture
+frame -1 0.500000 vertex = anim
+material anim = material -1 1.0
+1.0
+anim texture 1.0
+material bone
+anim frame bone
+-1 frame 1.0 1.0 1.0 -1 bone bone bone
+anim texture
+material 1.0 anim texture material bone 1.0 = bone
+bone anim frame material 1.0 -1 0.500000 vertex bone frame 1.0
+vertex -1
+material
+material frame = material -1
+bone material material vertex frame
+frame
+texture 1.0
+-1 texture
+= -1 texture vertex material = material anim 1.0 bone frame texture vertex vertex =
+material frame
+bone vertex frame 0.500000 vertex frame
+1.0 texture anim texture vertex frame anim texture vertex anim frame frame anim bone anim = anim 0.500000 0.500000 vertex -1 frame texture anim bone anim bone anim 0.500000 = -1 1.0 1.0 frame texture -1 material frame -1 -1 texture frame 1.0 -1 =
+material frame -1 = anim 0.500000 anim =
+=
+= -1 bone
+bone 
\ No newline at end of file
@@ -0,0 +1,327 @@
+vertex
+1.0 material
+texture material = material anim texture =
+frame
+vertex -1 frame texture
+frame 0.500000 vertex vertex 1.0
+vertex bone -1
+bone
+= bone vertex anim
+-1 anim frame
+anim
+material
+vertex texture material frame material = bone 1.0
+0.500000 vertex anim anim 0.500000
+-1 vertex texture
+bone frame
+vertex 1.0 texture bone
+1.0
+0.500000 1.0
+frame vertex 0.500000 bone =
+vertex 0.500000 texture bone
+texture 1.0 frame material 1.0
+-1 anim 0.500000
+=
+anim
+-1 bone texture =
+vertex frame = 1.0 -1 material texture bone
+texture
+material frame frame frame -1
+frame
+material
+bone 1.0
+vertex
+texture anim
+vertex texture anim = frame
+vertex 0.500000
+anim 0.500000
+material
+material
+anim frame -1 vertex vertex
+frame
+0.500000 vertex 1.0
+1.0 vertex 1.0 texture texture
+frame frame vertex vertex 1.0 frame 1.0 -1 texture 0.500000 0.500000 material frame
+-1 texture vertex
+= frame frame
+1.0
+bone material
+vertex frame
+-1 anim vertex material material
+vertex
+0.500000 0.500000 -1 bone bone
+1.0 frame = -1 1.0 texture
+texture 0.500000
+vertex bone 0.500000 frame
+texture
+bone anim bone material vertex material anim 1.0 = 1.0 material frame 0.500000 -1 bone vertex bone
+anim
+1.0 0.500000 material material 0.500000 bone
+= material vertex 0.500000
+1.0 material vertex
+1.0 -1 1.0 anim 1.0 0.500000 1.0 1.0 0.500000 material 1.0 texture 0.500000 anim texture
+vertex material bone 1.0 texture bone 0.500000 texture frame bone frame vertex 0.500000 anim 1.0 1.0
+= anim material texture texture anim vertex material
+-1 =
+frame material material vertex = = anim bone -1
+= -1 -1 bone
+= anim -1 bone -1 vertex
+0.500000
+anim 1.0 texture vertex
+vertex anim anim
+bone
+anim bone 0.500000 material vertex
+= texture
+frame -1
+-1 material 1.0 material 1.0 material material bone 0.500000 bone bone -1 1.0 material frame
+1.0 1.0
+material
+frame
+vertex frame frame
+bone frame -1
+= texture frame
+vertex -1 bone bone
+= = = material
+material
+frame 1.0 1.0 bone
+1.0
+texture = texture bone texture frame
+bone 0.500000 bone -1 =
+0.500000 texture bone
+material 1.0 -1 = vertex -1 material 1.0
+material frame
+= 0.500000 0.500000
+material texture material material -1 vertex bone frame material 1.0 0.500000 vertex material vertex anim = material frame anim = = texture material = -1
+material bone frame frame texture
+bone -1 texture texture
+material -1 anim 0.500000 texture anim anim
+bone
+anim material
+vertex bone
+= = 0.500000 bone anim 0.500000
+frame bone = frame vertex texture material 0.500000 = vertex vertex 1.0
+0.500000 0.500000 anim
+bone anim = vertex vertex 0.500000 anim
+1.0 = = material anim 1.0 = 0.500000 vertex
+-1
+0.500000 texture
+material frame anim material
+vertex
+0.500000
+texture
+= bone -1 anim texture vertex 1.0 material -1 texture vertex material bone 1.0
+bone vertex material 1.0 -1 0.500000 frame vertex
+texture -1
+-1
+texture = -1 = 1.0 1.0 texture bone vertex
+-1 -1
+anim vertex bone frame frame vertex 1.0
+vertex texture
+bone bone material anim -1
+= = anim texture anim vertex frame -1 0.500000 frame
+vertex frame =
+0.500000 1.0 1.0
+= material -1 frame anim bone material -1 bone
+anim
+frame = = bone
+=
+=
+texture 1.0 texture texture bone
+1.0
+0.500000 frame bone -1
+0.500000
+vertex vertex texture
+anim
+= bone anim
+-1 -1 = 0.500000 1.0
+material bone
+frame bone
+= = frame 1.0
+vertex -1 vertex
+bone bone 0.500000 1.0 1.0 bone material
+vertex
+1.0 bone 1.0 = 1.0
+0.500000 -1 = bone bone anim bone vertex bone
+texture
+vertex frame
+= bone texture
+frame
+-1 = material texture texture
+=
+= frame
+1.0 0.500000 -1
+=
+texture frame bone
+frame
+-1 anim = bone anim
+anim
+texture bone
+texture
+bone = vertex
+bone 1.0 texture anim texture 0.500000 frame vertex
+anim anim -1 material 1.0 texture bone 0.500000
+0.500000 = 0.500000 vertex 0.500000 texture material 0.500000 texture -1 bone
+anim
+0.500000 material
+bone material 0.500000 = -1
+0.500000 = texture vertex bone =
+-1
+bone -1
+-1 1.0 bone frame texture
+= 0.500000
+vertex
+bone 0.500000 anim -1 frame bone vertex 0.500000
+anim
+1.0 -1 -1 vertex =
+0.500000 vertex 0.500000
+material 0.500000 vertex vertex 0.500000 0.500000 0.500000 vertex bone = 0.500000 -1 material -1 = 0.500000
+= anim -1 texture material bone material
+anim
+anim
+-1 0.500000 anim 0.500000 material
+-1 1.0 anim frame -1 bone bone bone 1.0 bone frame
+material bone frame = -1 bone material anim
+vertex 1.0 frame
+bone
+= 0.500000
+= vertex frame bone
+frame 0.500000
+-1 anim = = texture -1 material vertex frame 1.0 -1 =
+bone -1 anim material anim
+= frame -1 bone 1.0 texture 0.500000 -1 frame -1
+vertex anim material frame bone bone anim 0.500000 material anim
+0.500000
+bone
+frame
+texture frame -1 = frame
+0.500000 0.500000 frame 0.500000
+material -1 0.500000 anim 0.500000 =
+bone =
+frame vertex anim anim 0.500000 anim -1 -1 anim 1.0 vertex material 0.500000 0.500000 vertex bone
+frame vertex bone 1.0 -1
+0.500000 material 0.500000 anim frame
+vertex material
+material anim
+1.0
+0.500000 = bone frame -1 0.500000
+anim material material frame bone vertex -1 frame vertex -1 -1 texture = anim -1 frame 1.0 bone
+1.0 = -1 vertex = material
+texture 0.500000 anim 0.500000
+0.500000
+vertex vertex
+texture 1.0 -1 = = material 0.500000 material vertex
+-1
+-1 vertex vertex texture 0.500000 bone texture anim
+vertex -1
+anim
+vertex 0.500000
+texture
+material 0.500000 bone = anim
+texture = vertex
+-1
+texture -1 frame texture vertex =
+0.500000 1.0 material = frame
+=
+anim bone 0.500000 bone anim material texture
+anim anim vertex
+frame
+vertex
+texture frame bone bone 0.500000
+1.0 0.500000 -1 anim vertex
+material = = -1 texture
+frame 0.500000 material
+anim
+-1 texture vertex vertex material texture frame material 1.0 texture -1 bone
+0.500000 0.500000 material material -1 0.500000
+= 1.0
+vertex -1 bone = anim -1 anim
+material material anim anim vertex
+1.0 anim =
+texture
+1.0
+1.0
+= =
+texture
+material material frame
+= vertex
+vertex anim anim frame texture bone 0.500000
+frame bone -1 frame
+-1
+bone texture =
+frame 1.0
+= -1
+texture 1.0 -1
+material 1.0 anim vertex vertex material
+0.500000
+anim
+vertex
+0.500000 anim 0.500000 vertex texture texture material anim anim
+-1 0.500000 material anim bone texture
+anim anim
+vertex 1.0 texture -1 material anim -1 vertex = material 1.0 vertex 1.0
+texture = bone 1.0 =
+frame bone texture 1.0 vertex -1 0.500000 1.0 -1 -1
+bone
+0.500000 vertex
+material = 0.500000
+material texture 0.500000 vertex anim 0.500000 0.500000 1.0
+material -1 texture
+-1 frame texture anim
+frame
+texture 1.0 anim
+-1 frame
+bone
+anim frame
+anim vertex texture material
+texture -1 frame -1
+1.0
+anim frame bone bone vertex texture anim = -1 anim bone
+frame frame 1.0 -1 frame
+0.500000 texture
+anim
+texture -1 bone material 0.500000 anim material frame = texture bone anim
+material texture 0.500000 =
+= frame -1 0.500000 1.0 material vertex 1.0 anim frame vertex 0.500000 =
+bone 1.0 -1 vertex vertex
+anim
+0.500000 1.0 1.0 1.0 frame texture vertex frame
+-1 material 0.500000 material
+texture 0.500000 vertex
+material texture
+vertex 0.500000 frame 0.500000 vertex
+0.500000 material anim bone
+-1 anim -1 0.500000 0.500000 texture
+-1 0.500000 bone material
+1.0 vertex material 1.0 anim anim frame bone anim
+1.0 = texture texture frame bone bone texture
+frame = frame 0.500000
+1.0 = 1.0 = frame material
+= =
+0.500000 0.500000 frame material 1.0 texture vertex bone
+vertex
+vertex
+1.0
+frame anim
+texture
+0.500000
+-1 -1
+texture frame
+vertex
+vertex material 1.0 1.0 material 1.0
+material
+material texture 0.500000 1.0 bone
+material 1.0
+anim texture 0.500000
+vertex = -1 -1 vertex anim material frame anim frame -1
+1.0
+0.500000
+vertex 0.500000 anim 1.0 1.0 1.0 -1 texture
+-1 = 1.0 0.500000 -1 frame frame 0.500000 anim vertex
+texture frame
+frame
+vertex -1 = anim material texture 1.0 -1 vertex
+vertex 1.0 material material frame
+anim bone -1 1.0 texture material vertex
+anim 0.500000 material -1
+material -1 material frame
+vertex vertex bone material
\ No newline at end of file
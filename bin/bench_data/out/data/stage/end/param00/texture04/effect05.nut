@@ -0,0 +1,23 @@
+frame
+bone
+0.500000
+1.0 bone
+material 1.0 1.0 bone vertex
+-1 vertex bone material
+texture 0.500000 bone bone 1.0
+bone 0.500000 vertex 0.500000 texture
+frame
+texture -1
+= texture
+frame vertex material frame 1.0
+anim bone anim
+material
+anim 0.500000 vertex bone frame anim
+texture
+frame texture frame
+bone texture -1
+= anim =
+bone
+frame material anim = = bone
+bone -1 texture frame texture = vertex material
+frame 0.500000 material 
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim
+material vertex
+0.500000 = anim anim
+-1
+texture anim 1.0
+= frame = frame anim 1.0 0.500000 0.500000 -1 1.0 = anim -1 bone -1 -1 0.500000 -1 anim 0.500000 =
+=
+anim vert
\ No newline at end of file
@@ -0,0 +1,160 @@
+material -1 texture
+0.500000 texture
+material
+-1 0.500000 anim texture = 1.0 anim
+frame vertex material 1.0 frame -1 1.0 anim
+vertex
+material 0.500000 material texture texture 1.0 material anim bone
+vertex
+frame
+1.0
+texture
+frame -1 -1 texture
+= -1
+= 0.500000 frame vertex
+1.0 -1 1.0 = frame texture = anim vertex
+-1 bone
+1.0
+frame
+= -1 bone =
+texture
+1.0 texture
+vertex anim
+0.500000 material
+anim = texture 1.0 material material
+material
+texture
+vertex 0.500000 texture vertex 1.0 -1 anim -1 bone 0.500000 0.500000 0.500000 anim
+=
+material -1
+bone material bone 1.0 frame = = 1.0
+anim 1.0
+bone =
+bone texture -1
+anim
+anim 1.0 frame 0.500000
+vertex anim vertex frame 1.0 =
+-1 = frame bone frame frame vertex texture
+1.0 vertex
+material 1.0 1.0 anim material vertex frame texture material texture
+1.0 -1 texture = = vertex -1 frame bone
+1.0
+texture = anim 0.500000 bone = material
+material = 0.500000 = vertex 0.500000
+material -1 = 1.0 frame vertex anim bone 0.500000
+material material
+bone material =
+anim
+material frame
+vertex texture 0.500000 material anim bone -1 bone
+1.0 -1 = material =
+anim bone anim anim anim bone material texture
+material 0.500000
+-1 vertex -1 vertex
+1.0 = material bone 0.500000 1.0
+anim -1 1.0 =
+bone frame 1.0 anim bone 1.0
+material frame texture 0.500000 = material texture
+frame anim =
+anim vertex
+anim = material
+vertex
+bone
+anim anim 0.500000 vertex
+= texture 1.0
+frame bone 0.500000 anim = frame = frame frame
+texture
+-1 =
+1.0 0.500000 = -1 1.0
+-1 = frame
+1.0
+= anim = anim
+= anim vertex = bone -1
+frame 0.500000 =
+vertex
+frame bone -1
+-1 texture = 1.0
+anim vertex bone 1.0 material bone
+anim 1.0 bone texture
+1.0 0.500000
+anim
+0.500000 material 1.0 material -1 1.0
+0.500000 vertex anim 0.500000 texture anim
+material 1.0 frame
+anim 1.0 -1 anim bone
+anim vertex -1 frame texture texture 1.0 1.0 texture vertex -1 0.500000 anim bone
+-1
+0.500000 1.0
+texture -1 texture
+material vertex material bone vertex frame material vertex vertex = bone -1 material -1 0.500000 texture vertex texture vertex
+anim
+=
+vertex frame 0.500000 frame frame =
+1.0
+frame bone texture = bone material -1
+= = 1.0
+=
+-1 texture 1.0 = anim =
+texture
+bone 1.0 bone 1.0 anim vertex bone
+frame
+texture 0.500000
+vertex -1 1.0 vertex anim
+1.0 0.500000 -1 texture -1
+1.0 -1 material
+anim anim material 1.0 texture material bone =
+=
+material -1 =
+frame 1.0 bone vertex frame texture material
+-1 -1 anim material
+-1 -1
+material anim vertex -1
+1.0 0.500000 frame 1.0 anim material material
+vertex vertex anim texture
+bone frame = vertex
+texture 1.0 vertex
+material 0.500000
+material frame frame
+texture = -1 texture -1 texture anim 0.500000 anim
+=
+vertex
+frame = frame bone vertex = frame
+frame 0.500000 = = anim
+bone texture
+0.500000
+bone texture vertex vertex
+0.500000 texture -1 vertex
+anim texture
+frame 1.0 vertex
+frame bone frame 1.0 anim 0.500000 bone 1.0 -1
+= frame texture
+anim bone frame vertex = 0.500000 vertex anim frame 0.500000 material 0.500000 frame frame material
+vertex 1.0 1.0 material
+=
+material anim -1
+frame
+material 0.500000 texture 0.500000 anim vertex 1.0 frame anim anim bone
+-1
+vertex anim
+-1
+frame vertex
+material -1 bone material material =
+-1 vertex 1.0 texture
+texture material -1 vertex =
+bone
+1.0 frame material texture
+material frame bone
+bone 1.0 frame bone texture bone 0.500000 1.0
+0.500000 -1 bone 1.0 material =
+1.0 bone anim 1.0 frame vertex vertex frame vertex
+0.500000 texture -1 vertex bone texture 0.500000
+0.500000 texture vertex
+vertex vertex
+= -1 =
+bone
+0.500000 material material 1.0 0.500000 anim frame
+0.500000 = material 0.500000 frame
+frame vertex = texture
+0.500000 material vertex bone 1.0 =
+material anim = anim frame vertex
+= 
\ No newline at end of file
@@ -0,0 +1,13 @@
+1.0
+= 1.0 vertex -1 frame texture bone
+bone
+-1 -1 material 0.500000 vertex bone
+anim 1.0
+frame
+material
+0.500000 vertex material 0.500000 texture vertex
+vertex texture material 1.0 texture bone bone = -1
+texture 1.0
+texture frame frame 0.500000 0.500000 bone -1 1.0
+=
+-1 materia
\ No newline at end of file
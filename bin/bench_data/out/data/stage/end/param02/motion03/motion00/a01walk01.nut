@@ -0,0 +1,14 @@
+frame
+bone
+= bone
+texture 1.0 frame
+bone anim
+texture
+frame -1
+= 1.0 = -1 vertex
+-1 bone 1.0 -1 -1
+vertex 1.0
+anim bone 0.500000
+bone anim
+0.500000 -1
+vertex 0.500000 anim material frame -1 texture material -1
\ No newline at end of file
@@ -0,0 +1,7 @@
+1.0 vertex texture 0.500000 = vertex anim 0.500000 -1 anim
+= 1.0 anim
+-1
+bone
+1.0 1.0 -1
+bone -1 1.0
+0.500000 vertex anim ver
\ No newline at end of file
@@ -0,0 +1,7 @@
+anim
+bone bone anim
+bone -1 frame -1 bone bone 0.500000 bone
+-1 anim -1 bone =
+bone texture bone vertex 1.0 bone 1.0 =
+1.0 -1 material 0.500000 bone = 1.0 =
+fra
\ No newline at end of file
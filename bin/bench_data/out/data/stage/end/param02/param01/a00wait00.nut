@@ -0,0 +1,2 @@
+o]L3^+#B{lc&b·4r?[fl㻑]YyL!6⪼M7{!R#<\+Ӻt%d+>Bgq%UD0C
+?O|Gܡs͚ۈQgq$y猁7m-=	9E9``mZUv'IyGf6;Na5mqfCd=fLBY+1tk/گ<w0alR6J,dfwzM:vS7sL716~%Սt0('~zh,4ߵp1c.n*%mni,i<{]S뱬;?Dv!J8-_8
\ No newline at end of file
@@ -0,0 +1,2 @@
+= frame -1
+1.0 material vertex 1.0 bone
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000
+= bone = 0.500000 -1
+vertex frame frame bone -1
+anim texture
\ No newline at end of file
@@ -0,0 +1,158 @@
+= bone -1 0.500000 vertex frame =
+0.500000
+1.0 material -1 0.500000
+material frame vertex = 1.0
+0.500000 frame bone vertex 1.0 1.0 -1 material
+=
+vertex 1.0 texture texture 1.0
+texture anim material texture
+1.0
+vertex 0.500000 anim = -1 0.500000
+=
+texture vertex anim -1 1.0
+frame
+vertex vertex bone material material
+=
+-1 1.0 vertex =
+anim
+frame 1.0 -1 vertex
+vertex = 0.500000 = frame anim vertex
+-1
+texture 1.0 frame -1 = 0.500000 -1 bone
+0.500000 0.500000 frame -1 1.0 material 0.500000 bone
+texture = 1.0 frame anim
+bone
+1.0 1.0 0.500000 material material anim
+anim
+-1 material
+anim vertex material
+-1 0.500000 vertex
+-1 = vertex vertex
+texture frame 1.0
+texture 1.0 texture
+0.500000 anim
+material -1 0.500000
+anim -1 texture texture bone -1 texture texture
+vertex material
+frame
+vertex
+material texture anim texture -1 texture 0.500000 = 1.0 frame -1 anim material 1.0 anim material 1.0 0.500000 material -1
+vertex = 0.500000 material anim frame texture
+0.500000 material
+1.0 1.0 bone bone material
+bone vertex 1.0
+bone = 0.500000 1.0 1.0 frame
+-1 1.0 anim -1 frame =
+bone -1
+texture 1.0 bone
+1.0 1.0 anim = -1 texture 1.0 anim vertex
+material vertex
+bone 0.500000
+vertex bone bone
+-1 material
+0.500000 = anim
+material texture vertex =
+anim
+texture
+-1
+texture anim anim
+-1 0.500000 = 0.500000
+-1 vertex bone -1 vertex frame
+frame 1.0 vertex vertex 1.0
+1.0
+texture -1 vertex
+texture -1 0.500000
+bone
+vertex frame
+texture
+-1 1.0 -1 =
+= vertex vertex 1.0 0.500000
+vertex 1.0
+anim = frame texture
+frame
+frame vertex anim
+material bone anim anim texture 0.500000 bone texture -1 -1 material texture
+material -1
+1.0 bone = vertex 1.0 vertex -1 bone
+texture material vertex = material frame frame -1
+= = frame material anim bone
+1.0 0.500000 vertex
+frame anim bone -1
+0.500000 0.500000
+texture texture texture bone material 1.0 frame bone bone 0.500000 vertex vertex
+1.0 1.0 texture
+material bone
+anim 1.0
+frame frame
+bone = material anim vertex
+= 0.500000 texture anim
+= -1 frame bone
+= 0.500000
+1.0 =
+vertex 0.500000 material -1 vertex -1
+frame
+1.0 = 1.0
+bone frame
+-1 1.0
+0.500000 frame texture vertex
+0.500000 vertex bone 1.0 1.0 0.500000 vertex bone -1
+-1 anim = vertex -1 frame 0.500000 bone bone 1.0 1.0 vertex material texture 1.0 bone texture anim anim -1 material bone -1 bone anim anim
+0.500000 texture material texture 1.0 1.0 material 1.0
+frame anim texture
+1.0
+frame
+texture
+bone
+vertex
+0.500000 = 0.500000 vertex = frame
+material = = texture 0.500000 vertex =
+texture
+texture = 0.500000 texture
+bone = 1.0 texture vertex
+anim
+texture
+anim 1.0 =
+-1 0.500000
+bone frame vertex anim bone bone 1.0 bone
+-1 texture 1.0
+material = -1 = texture 1.0 material frame anim material
+material 0.500000
+material material bone vertex vertex -1 bone
+texture vertex
+bone bone frame bone
+-1 bone -1 0.500000 vertex
+= = vertex frame material frame material
+-1
+1.0 1.0 material vertex vertex material frame
+frame
+material 1.0 material frame texture = anim bone = anim material bone
+= = vertex =
+0.500000
+vertex anim -1
+anim
+texture material 1.0 frame
+material
+-1 anim texture bone bone frame frame 1.0 vertex anim
+-1 anim
+anim = bone frame -1 bone 1.0 anim
+bone bone
+material material =
+frame texture anim = vertex frame
+frame bone
+bone texture
+material texture
+= 0.500000 -1
+-1 -1 = -1
+0.500000
+anim -1 1.0
+anim 0.500000
+bone texture frame
+= bone frame bone = material texture material anim material anim vertex vertex
+= 0.500000 -1 0.500000
+anim
+vertex
+texture vertex texture =
+anim anim -1 -1 anim
+bone -1 bone anim =
+1.0 texture 1.0 texture
+vertex bone vertex bone 
\ No newline at end of file
@@ -0,0 +1 @@
+Ie?9ol	+c`)i!sMQxA}lЪoѕ_Qaв$m~
\ No newline at end of file
@@ -0,0 +1,15 @@
+vertex -1 = texture = anim texture = vertex
+= texture =
+= 0.500000
+0.500000 -1
+-1
+material 1.0 0.500000 anim
+-1 0.500000 1.0 -1
+0.500000 -1 = -1 material -1 = texture material texture -1 bone material anim
+frame
+vertex
+anim 0.500000
+bone
+1.0
+material
+an
\ No newline at end of file
@@ -0,0 +1,105 @@
+-1
+-1 vertex anim
+0.500000 -1 frame
+-1 0.500000 texture bone frame texture bone bone -1 = bone 1.0
+= bone bone bone 0.500000 -1 1.0 texture
+material
+-1 = frame texture material texture bone -1 0.500000 =
+anim -1 texture -1
+material vertex anim 0.500000
+bone
+= vertex bone texture texture = 1.0 vertex vertex 1.0 -1 0.500000 frame
+-1 anim 0.500000 1.0 1.0 frame vertex = anim
+1.0
+-1 bone anim 1.0 vertex bone 1.0 -1 bone 1.0 frame texture 0.500000 -1 vertex texture
+frame frame 0.500000
+frame
+anim
+vertex = 0.500000
+vertex material
+0.500000
+frame
+anim
+= -1 anim material
+vertex
+material 1.0 vertex bone =
+anim
+texture frame material 0.500000 = 0.500000 = vertex vertex material bone vertex 1.0 -1 -1
+= anim 0.500000
+0.500000 1.0
+frame 1.0 frame = material anim bone bone
+frame = vertex texture material texture 0.500000 vertex frame 0.500000
+texture frame 0.500000 vertex texture
+texture = -1 texture
+texture texture texture texture -1 1.0 =
+frame vertex vertex -1 bone material = vertex = frame 1.0 = 1.0
+anim
+material 1.0 frame
+vertex
+vertex
+vertex anim 1.0
+bone 0.500000 anim vertex
+frame bone vertex 0.500000
+frame
+=
+anim -1 anim vertex vertex frame vertex bone material =
+anim material vertex
+anim = frame =
+anim material
+material
+vertex
+bone = frame material texture bone material = texture material vertex -1 bone 1.0 anim 0.500000 1.0 1.0 = anim 1.0 bone
+texture frame = 0.500000 anim -1 material bone vertex frame 0.500000 bone
+vertex -1
+material 0.500000
+1.0 texture 1.0 vertex -1 =
+material 1.0 -1
+texture anim
+vertex frame
+bone
+0.500000 = frame anim
+= material bone material
+anim vertex anim material 0.500000 vertex
+vertex 1.0 frame anim 0.500000 0.500000 =
+vertex = vertex material = 1.0 material vertex
+frame material -1 anim 1.0
+0.500000 0.500000 0.500000 vertex vertex
+0.500000
+texture
+vertex 0.500000 = 0.500000 material bone anim
+texture texture
+-1
+anim vertex
+material frame bone
+material
+0.500000
+anim
+frame = texture 1.0 texture bone texture
+material
+vertex
+anim
+texture material
+1.0 bone bone
+-1
+bone
+frame bone texture = =
+0.500000 frame = material
+anim bone
+-1 -1 material bone =
+anim
+frame bone 1.0
+-1 frame anim 0.500000 anim 1.0 material bone
+anim texture 1.0 0.500000 vertex
+vertex 1.0 bone 1.0 bone 0.500000
+0.500000
+-1 1.0 material material anim vertex 1.0 bone anim -1 frame -1
+-1
+bone 1.0 bone
+material
+= 0.500000 texture
+1.0 0.500000 = frame anim -1
+1.0
+-1 material 1.0 frame anim vertex anim
+-1 1.0 bone vertex
+bone anim
+frame tex
\ No newline at end of file
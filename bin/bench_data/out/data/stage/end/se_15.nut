@@ -0,0 +1,8 @@
+bone material -1 = frame
+= anim 1.0
+0.500000 -1 1.0
+vertex texture 1.0
+material
+bone -1 anim 1.0 anim 1.0
+1.0
+1.0 material 0.50
\ No newline at end of file
@@ -0,0 +1,6 @@
+bone material material = anim
+frame texture bone anim 1.0 bone 0.500000 texture 0.500000
+anim anim bone = = 0.500000 frame 1.0 anim frame -1 material anim bone
+bone vertex
+material material 1.0 1.0
+material -1 texture texture m
\ No newline at end of file
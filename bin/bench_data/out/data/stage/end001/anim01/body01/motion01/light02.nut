@@ -0,0 +1,2 @@
+%8_>|cY7u))O1i5zrpMt[Q{#2TH:iIPSlMMȒJDť5=c6}no>ω@~.Fd;c} i[l@2>-˹3{(ӏlV2xNxts`VH9Z\Fe:PaUr!WV;3枇${qUyt_^
+,]n=p5vIF[t	gcFxfqFWIfgDxKZ(7uff_>?sosgY{;`bwɌ:<e
\ No newline at end of file
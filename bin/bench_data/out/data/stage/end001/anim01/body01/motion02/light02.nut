@@ -0,0 +1,17 @@
+frame material = frame
+material texture bone material
+=
+0.500000 material -1 texture texture
+texture = -1 material
+-1 1.0 -1 0.500000 texture bone
+anim frame
+material -1 0.500000
+= 0.500000
+= material vertex
+material bone vertex
+bone vertex frame bone = = frame
+1.0 -1 0.500000 bone material
+0.500000 texture bone vertex
+vertex vertex anim -1 frame
+-1 material bone =
+1.0 bone material frame vertex 1.0 frame vertex frame 0
\ No newline at end of file
@@ -0,0 +1,12 @@
+0.500000
+-1 vertex -1 frame bone
+anim
+material 0.500000 frame -1 vertex 0.500000 1.0 0.500000 1.0
+1.0
+-1 1.0 vertex frame frame = -1 texture 1.0 material bone
+= bone
+vertex material 0.500000 bone
+bone 1.0 material
+frame anim anim 0.500000
+1.0
+an
\ No newline at end of file
@@ -0,0 +1,40 @@
+= bone bone material
+vertex = 1.0 texture bone vertex texture 1.0 vertex -1 0.500000
+vertex bone material
+material
+1.0 bone
+texture anim material
+material anim vertex
+-1 texture 1.0
+1.0 = vertex 0.500000 bone anim
+0.500000 frame frame
+anim 0.500000 = 0.500000 1.0 vertex
+material 1.0 material -1 vertex anim texture bone 0.500000 material
+-1 texture bone
+-1 frame vertex
+= vertex
+-1 frame 0.500000 -1 0.500000 bone
+0.500000 0.500000
+frame = vertex
+-1
+anim anim
+= frame bone = texture
+-1 bone = anim
+anim material material
+-1 anim texture material material anim 0.500000 -1
+= bone material bone 0.500000 0.500000 0.500000 bone 0.500000 bone bone
+1.0 anim = -1
+=
+frame
+1.0 = material = 1.0 1.0 0.500000
+frame bone anim -1 1.0
+= 0.500000 anim 0.500000 texture vertex 1.0
+0.500000 material vertex -1
+=
+bone -1
+anim
+material
+1.0 = texture frame
+anim frame texture frame
+-1 = material anim
+1.0 0.500000
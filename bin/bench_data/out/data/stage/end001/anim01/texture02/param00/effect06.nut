@@ -0,0 +1,196 @@
+frame
+=
+material 1.0 material -1 texture 1.0 frame anim 1.0
+0.500000 1.0 bone texture anim material material 1.0 material
+0.500000 frame anim 0.500000 -1 anim anim anim bone vertex
+-1 anim 1.0 frame
+texture frame
+-1 texture 1.0 vertex anim -1 -1 material vertex 1.0 bone anim 1.0 1.0 texture
+bone 0.500000 -1 material
+= = texture anim frame bone vertex
+texture texture 1.0 1.0 bone
+0.500000 = bone -1 frame
+0.500000 0.500000 0.500000 0.500000 0.500000 frame vertex
+material
+vertex texture anim = vertex bone 1.0 1.0
+texture material anim
+-1 1.0 0.500000
+=
+0.500000
+= 1.0 bone
+bone
+frame 1.0
+material material bone texture 1.0 1.0
+bone texture vertex bone anim material
+anim
+vertex
+texture
+1.0
+= frame =
+texture
+= =
+frame 0.500000 material texture frame -1 texture -1
+texture anim texture bone vertex material
+vertex =
+material 1.0
+anim frame
+-1 = texture = bone texture
+vertex = 1.0 vertex
+0.500000
+vertex 1.0 = anim 0.500000
+texture vertex frame anim frame bone
+0.500000 bone vertex
+bone vertex vertex -1 material bone
+0.500000
+material material texture bone = frame
+anim
+anim
+-1 material frame anim 1.0 0.500000 frame material
+material 0.500000 0.500000
+anim material = = texture anim
+frame texture
+-1 material texture -1 frame bone vertex
+bone =
+0.500000 -1 vertex texture
+material frame = -1
+bone -1 0.500000
+0.500000 texture texture -1
+-1 frame vertex 0.500000 -1 bone 0.500000 material 0.500000 anim
+-1 anim material
+-1
+-1 material
+frame 0.500000 0.500000 bone anim
+0.500000
+anim
+1.0 0.500000
+0.500000 bone vertex texture
+bone =
+material =
+anim
+frame anim anim bone -1 anim -1 1.0 -1
+1.0
+0.500000
+1.0
+vertex bone -1 material = material bone frame = material bone 0.500000 -1
+vertex = texture 1.0 anim -1 texture
+bone 0.500000 material
+frame
+anim -1 frame 1.0
+= bone = -1
+-1
+anim vertex 0.500000
+anim -1 material material bone material 0.500000 1.0 material anim material
+bone anim
+frame = = vertex texture vertex
+texture
+anim texture 1.0 -1 bone
+0.500000 material
+=
+material
+= bone = 1.0 texture
+material 0.500000
+anim
+1.0 bone 1.0 frame vertex frame 0.500000
+anim vertex vertex 0.500000
+material 0.500000 material anim
+bone
+0.500000
+frame 1.0 texture
+texture 1.0 material
+frame -1 = 1.0 = frame
+0.500000
+material texture = bone anim -1 bone
+anim texture texture = frame anim 0.500000 0.500000 vertex vertex anim bone frame -1
+anim -1 = = material
+material
+-1 material anim
+-1 vertex texture vertex material
+texture 0.500000 texture texture frame 0.500000 1.0
+material texture
+1.0 = 1.0 1.0 bone
+anim frame -1 anim anim anim bone
+-1 1.0 =
+anim
+material
+frame texture
+material texture material 0.500000
+0.500000 =
+0.500000 = texture -1 -1
+1.0 1.0 1.0 bone -1 vertex
+bone 1.0 anim 1.0 material texture material -1 frame -1 1.0 frame 0.500000 material anim material bone
+= frame material vertex texture texture frame anim
+anim frame vertex
+-1
+material texture 0.500000 material bone 1.0 bone
+-1 bone -1 1.0
+0.500000 0.500000 vertex
+anim bone frame
+anim -1 1.0
+anim 1.0 0.500000 0.500000 vertex anim 1.0 material vertex
+material
+1.0 frame -1
+= bone
+0.500000
+bone
+vertex material vertex
+vertex = vertex 0.500000 material =
+=
+anim vertex 0.500000 -1
+=
+vertex anim
+bone
+0.500000 bone -1 anim 1.0 0.500000
+anim frame frame vertex -1
+1.0 = material
+bone bone
+vertex
+= material =
+= vertex anim 0.500000 texture
+vertex 1.0
+vertex
+material texture 0.500000 bone bone texture bone 0.500000 texture = anim 1.0
+anim material bone
+material 1.0
+-1
+0.500000 vertex 0.500000 vertex
+bone -1 anim bone 1.0 vertex -1 vertex material = material
+-1
+= anim material 0.500000
+0.500000 0.500000 material vertex texture anim vertex anim
+= material material material texture bone 1.0 vertex frame material frame anim bone texture vertex texture vertex -1
+0.500000 =
+texture = 1.0 material
+frame
+1.0 anim
+vertex -1 texture vertex
+1.0 anim
+frame =
+= vertex vertex = anim 1.0
+frame anim = 0.500000 0.500000
+bone
+anim
+1.0 frame
+0.500000 anim material vertex = bone frame 0.500000 bone
+= = =
+vertex
+vertex
+frame material -1 =
+0.500000 anim bone texture
+anim texture texture
+bone material material material material frame material texture vertex bone bone 1.0
+-1 vertex 0.500000 texture
+1.0 frame vertex -1 = material texture vertex anim
+-1
+0.500000 1.0
+= texture material -1 frame frame = material
+0.500000 -1 0.500000 texture
+1.0 material 0.500000 anim vertex material anim vertex texture bone
+anim anim
+bone
+-1 texture anim
+0.500000 vertex
+texture 0.500000 texture texture anim texture bone anim
+0.500000 material frame material texture
+material anim -1 frame 1.0
+anim 1.0
+= 0.500000
\ No newline at end of file
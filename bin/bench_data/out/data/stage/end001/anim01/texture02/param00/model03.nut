@@ -0,0 +1,11 @@
+= 1.0 bone
+-1
+frame = vertex
+=
+frame = vertex anim 1.0 1.0
+material texture anim 0.500000
+1.0
+bone material 0.500000 = 1.0 0.500000 frame
+bone vertex
+1.0 material
+a
\ No newline at end of file
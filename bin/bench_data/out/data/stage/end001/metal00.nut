@@ -0,0 +1,170 @@
+anim
+-1
+-1 texture 1.0 frame 1.0 material bone = vertex anim
+texture texture =
+1.0 anim bone -1 anim bone anim anim
+-1 0.500000
+vertex vertex -1 0.500000 material
+bone =
+bone
+frame vertex
+vertex texture = 1.0 0.500000
+= =
+frame material texture 0.500000 material = -1 texture 1.0 -1 = texture
+1.0
+vertex
+= bone bone
+texture -1
+1.0 vertex frame vertex bone -1 texture anim vertex frame
+1.0 = bone
+vertex frame
+texture bone texture anim frame -1 = material
+-1 anim
+bone anim -1 vertex vertex
+vertex frame -1 material anim = frame bone
+1.0
+bone vertex vertex -1
+frame
+frame frame vertex 0.500000 anim material bone
+1.0 -1 anim -1 material vertex 1.0 material texture frame -1 anim vertex frame 0.500000 frame
+-1 frame
+-1 1.0 vertex texture
+frame 0.500000 -1
+1.0 0.500000 texture
+-1 bone
+vertex anim
+-1 frame = 1.0 anim material 1.0 vertex 1.0 vertex vertex
+vertex
+bone vertex -1 bone 1.0 = bone 0.500000 -1
+0.500000 texture vertex 0.500000 vertex
+vertex bone = 0.500000 bone material material
+material bone bone 0.500000 anim -1
+-1
+material -1 bone
+0.500000 1.0 material material
+-1 material bone = bone material 1.0
+material 1.0
+frame bone 1.0 = =
+vertex texture -1 0.500000 = texture
+-1 material vertex 0.500000 0.500000 = texture texture -1 material
+vertex -1 =
+frame texture 0.500000 anim -1 frame frame frame bone bone 1.0 anim bone anim 0.500000 bone vertex
+texture 0.500000
+texture anim texture
+1.0 -1
+bone
+bone 0.500000
+anim
+texture frame vertex texture bone
+frame
+frame material frame
+1.0 bone
+texture -1
+1.0 =
+-1 -1 texture 1.0 0.500000
+0.500000 frame frame anim material material 0.500000 texture 0.500000
+0.500000 0.500000 -1 material 0.500000 bone 1.0 -1 vertex
+anim
+texture
+= 0.500000 1.0 -1
+1.0 material 0.500000 bone anim frame 1.0 texture material -1
+bone -1 1.0 1.0 -1
+vertex =
+bone 0.500000 = bone
+vertex -1 vertex
+frame bone texture
+frame anim
+frame texture -1 frame 0.500000 anim material material
+bone material anim = anim
+texture = vertex vertex = texture -1 bone -1
+anim 0.500000
+1.0 vertex texture anim = 0.500000
+anim vertex
+bone 0.500000 material = bone anim anim
+-1
+=
+texture texture = vertex
+-1
+1.0 1.0 frame 0.500000
+material 0.500000 frame -1 1.0 vertex = bone
+0.500000 material vertex
+1.0 texture -1 = 0.500000 texture = bone material bone anim material frame bone frame bone
+bone
+0.500000 -1 -1 texture bone 0.500000 -1 = -1 material
+material
+bone texture -1 = frame texture frame -1
+0.500000
+=
+texture -1
+material = 0.500000
+anim -1
+-1
+material frame material
+texture
+bone material
+= texture 1.0 bone 0.500000 =
+bone material bone anim bone frame
+=
+0.500000 = vertex texture frame vertex 1.0 -1 -1
+texture 1.0 anim
+texture anim texture
+-1 texture material 1.0 texture
+vertex 0.500000 material -1 -1 vertex texture vertex
+frame anim vertex frame
+0.500000 -1 = 0.500000 1.0 frame
+-1 0.500000
+0.500000 material material -1 = = frame
+1.0
+= = bone
+bone vertex
+frame -1
+0.500000
+0.500000 1.0 texture bone material frame -1 =
+frame bone 0.500000 1.0 0.500000 -1 0.500000 material material material 1.0 frame texture
+material anim bone vertex -1 vertex texture = -1
+material -1
+= anim anim bone 0.500000 0.500000 texture
+-1 bone bone
+= = frame bone texture vertex 0.500000 anim bone frame texture 1.0 = texture = bone texture texture
+vertex
+anim bone vertex
+anim 0.500000
+=
+= texture frame
+vertex texture anim 1.0
+vertex -1 material
+vertex
+0.500000 = -1 anim
+vertex vertex
+0.500000 1.0 = -1 0.500000
+=
+vertex = material = frame 1.0 texture -1 bone material frame
+texture 0.500000
+material vertex vertex 1.0 bone bone
+material vertex -1 texture
+1.0
+0.500000 frame
+= material vertex frame 0.500000
+0.500000
+vertex -1
+1.0
+material texture 1.0 = anim -1 0.500000 0.500000 1.0 vertex texture vertex
+frame vertex 1.0 =
+anim vertex texture vertex
+frame anim
+texture vertex 1.0 bone
+frame = frame
+= frame texture texture 0.500000 material frame
+= anim
+anim material frame anim = anim anim
+-1 0.500000 -1
+vertex
+vertex
+-1 0.500000 frame material
+anim
+0.500000 anim =
+vertex -1 bone 1.0 1.0
+bone anim
+frame = anim bone frame vertex -1
+= texture texture texture 0.500000 -1 frame material 1.0 = texture -1 frame
+-1 
\ No newline at end of file
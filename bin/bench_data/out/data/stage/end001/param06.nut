@@ -0,0 +1,15 @@
+texture
+= vertex
+texture
+frame -1 anim
+-1
+frame
+material
+-1 0.500000 anim anim material = = 0.500000
+1.0 frame -1 0.500000 -1 0.500000 0.500000 -1 vertex -1 frame
+material -1 material
+1.0 frame material
+material 0.500000 texture material material
+=
+material texture
+0.500000 texture f
\ No newline at end of file
@@ -0,0 +1,17 @@
+1.0
+1.0 bone
+texture
+anim
+bone material frame 0.500000 -1 texture 0.500000 texture
+texture bone = vertex = vertex -1 anim texture bone
+0.500000 0.500000
+0.500000 1.0 0.500000
+-1 -1 texture frame
+=
+1.0
+vertex bone
+vertex anim
+texture = texture bone anim material material 1.0
+anim 1.0
+texture bone 0.500000 1.0 bone
+= vertex frame -1 -1 0.500000 ve
\ No newline at end of file
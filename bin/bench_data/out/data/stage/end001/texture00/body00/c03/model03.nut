@@ -0,0 +1,119 @@
+material 0.500000 anim
+anim anim material
+texture bone 0.500000 frame texture 1.0
+bone material
+frame material
+frame = material material 0.500000 1.0 -1 anim bone
+1.0
+frame bone texture bone material -1
+1.0 material frame vertex -1 frame
+frame frame texture anim
+anim
+frame
+1.0 material
+vertex 0.500000 material
+= frame
+bone = = bone 0.500000 0.500000 texture -1 material bone =
+-1 anim
+material texture -1 -1 -1 = 1.0 vertex texture material 0.500000
+1.0 -1 =
+-1 1.0 material
+-1 texture frame anim vertex
+material anim 1.0 0.500000 -1
+-1 material
+material
+texture bone 0.500000 -1 material frame -1 texture anim -1 -1 1.0 -1 material
+0.500000 frame = 0.500000
+1.0
+material frame 1.0
+frame 1.0 0.500000 bone material material frame texture vertex frame material texture
+1.0 = anim vertex
+vertex material material anim
+-1 vertex
+frame
+1.0
+frame texture frame
+anim 1.0 material anim frame
+material bone -1 bone texture
+-1 material material -1 = material frame vertex
+vertex texture bone texture bone
+-1
+anim -1
+1.0 vertex =
+vertex frame anim -1 bone 0.500000
+1.0
+vertex 0.500000 texture vertex 0.500000 0.500000 frame
+= frame texture
+-1 texture
+vertex 0.500000 anim 1.0 vertex bone frame material
+1.0
+= anim
+bone
+vertex
+bone bone frame
+0.500000 vertex
+frame -1
+= = vertex 0.500000
+0.500000 0.500000
+frame frame 0.500000 texture 1.0 bone
+-1 bone 1.0 material anim texture =
+1.0 -1
+=
+texture 1.0 material
+= texture 0.500000
+-1
+bone
+vertex
+0.500000 = texture frame 1.0
+texture texture texture bone
+-1 vertex -1 vertex
+texture frame
+0.500000 bone 1.0 material = -1 = 0.500000 frame frame -1 bone
+frame =
+-1 1.0 = 1.0
+-1 0.500000 1.0
+0.500000
+anim -1 bone
+vertex
+bone vertex texture vertex
+anim bone texture
+=
+vertex 0.500000
+= 0.500000
+-1 texture 0.500000
+anim =
+anim -1 1.0
+1.0 = anim 0.500000
+texture
+frame frame 0.500000 anim -1 -1 0.500000
+texture material material
+material material
+anim vertex -1 frame
+-1
+1.0
+frame texture material = material
+-1 = = frame texture 0.500000 frame anim material material
+material
+bone
+0.500000 bone anim
+-1 anim material 1.0 = 1.0 frame material
+1.0 anim frame 0.500000 anim material bone anim material material = -1 anim bone material material
+vertex 0.500000 anim material texture material texture 1.0
+texture
+vertex 1.0 vertex
+bone material material
+-1
+0.500000 0.500000 texture 1.0 material
+vertex
+-1 1.0 1.0 0.500000 0.500000 texture -1
+-1 texture
+frame texture vertex material anim material material 0.500000 -1 0.500000 bone texture material frame
+frame -1 0.500000
+texture vertex
+material texture
+=
+0.500000 texture texture 0.500000 bone material vertex
+0.500000 vertex vertex 1.0 0.500000 bone vertex vertex -1 anim texture frame
+texture anim anim 0.500000 0.500000 1.0
+frame frame
+anim frame -1 mat
\ No newline at end of file
@@ -0,0 +1,8 @@
+material -1
+= =
+frame vertex bone 1.0 vertex vertex 1.0 bone vertex texture = vertex 1.0
+anim material vertex = frame 1.0
+frame
+0.500000
+texture -1 anim
+1.0 -1 -1 bone material fra
\ No newline at end of file
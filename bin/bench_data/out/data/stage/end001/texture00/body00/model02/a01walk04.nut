@@ -0,0 +1,12 @@
+frame material 0.500000 vertex texture 1.0 -1 vertex bone bone material 1.0 -1 1.0 = anim anim bone anim
+vertex material
+0.500000 =
+0.500000 0.500000
+frame frame frame
+bone 0.500000
+frame 1.0 -1
+material -1 texture bone 0.500000 bone
+1.0
+bone
+texture vertex -1 vertex
+bone material text
\ No newline at end of file
@@ -0,0 +1,47 @@
+= frame anim
+1.0 1.0 bone bone
+bone anim
+0.500000 anim
+material -1 -1 -1
+material
+= texture anim bone anim 0.500000 texture 0.500000 frame 1.0
+bone
+1.0
+bone = anim
+0.500000 texture texture = material anim anim
+frame anim
+anim
+bone 0.500000
+=
+0.500000 vertex 0.500000
+0.500000 texture
+material anim texture frame
+vertex =
+bone vertex frame vertex = =
+-1 bone
+anim
+0.500000
+-1
+texture 0.500000 anim vertex 0.500000 anim -1
+anim material = -1 = bone texture vertex frame
+anim -1 0.500000 0.500000 -1 bone 0.500000 -1 0.500000
+0.500000 anim anim
+anim bone = = = 1.0 frame
+material 0.500000
+1.0
+bone bone texture frame anim texture
+anim =
+= bone vertex texture bone = -1 texture =
+-1
+0.500000 = -1 anim material
+texture texture vertex -1 frame -1 anim vertex -1 bone vertex 1.0 anim -1
+bone 0.500000 =
+bone -1 material
+material frame 1.0 -1 material 1.0
+frame
+-1 vertex 1.0 1.0 0.500000 0.500000
+-1 =
+= 0.500000
+texture material
+texture
+frame anim = -1 
\ No newline at end of file
@@ -0,0 +1,18 @@
+texture 1.0 0.500000 anim
+material
+frame = 0.500000
+1.0 bone 1.0
+1.0
+material 1.0 material 0.500000 = texture
+= anim texture = = bone
+-1 material anim
+-1 = texture material =
+material -1
+-1 bone = 0.500000 1.0 1.0 material
+anim anim anim frame =
+vertex material 0.500000 material frame
+0.500000 material bone = texture anim frame texture
+material = frame frame
+frame anim material 0.500000 0.500000 vertex 0.500000 material =
+0.500000 anim = material anim 0.500000
+= texture material 1.0 texture texture texture
\ No newline at end of file
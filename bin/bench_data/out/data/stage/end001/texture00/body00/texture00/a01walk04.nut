@@ -0,0 +1,336 @@
+vertex texture = 1.0
+0.500000
+1.0
+vertex
+bone vertex
+frame texture bone vertex anim frame anim 1.0 frame
+material =
+frame material
+1.0 0.500000
+vertex texture
+1.0 anim
+texture frame 1.0 frame
+0.500000 vertex -1 0.500000 anim 1.0 anim
+0.500000 1.0 texture -1
+bone 0.500000 -1
+bone 1.0 frame 0.500000 0.500000 material
+frame 0.500000
+material bone
+bone 0.500000 frame = vertex bone
+anim
+1.0
+frame -1 frame
+0.500000 material
+vertex
+vertex texture vertex material
+vertex 0.500000 1.0 frame = frame bone 1.0 = bone
+bone -1 texture
+bone vertex 0.500000 bone
+frame
+vertex anim bone =
+0.500000 bone
+1.0 1.0 -1 0.500000 anim frame = bone
+bone 1.0
+0.500000 -1
+bone -1 material texture -1 texture vertex bone material frame material
+-1 1.0 bone
+frame frame
+1.0
+bone frame 0.500000
+vertex frame 1.0 0.500000 = texture = bone
+1.0 0.500000 vertex texture frame 1.0
+texture 0.500000
+0.500000 material anim frame texture
+-1 -1 bone
+frame frame anim material bone
+frame 1.0 = texture material frame vertex
+anim
+texture
+texture
+anim vertex anim material material
+-1 0.500000
+= texture bone vertex
+= anim -1 material texture 1.0 texture anim bone bone
+-1 anim
+-1 -1 anim 0.500000 anim bone vertex frame anim 0.500000 anim 1.0 anim frame
+-1
+1.0 bone frame = frame 0.500000
+1.0 -1 0.500000
+texture bone vertex texture
+anim
+frame 0.500000 1.0 frame = -1 0.500000
+vertex bone anim
+= 1.0 texture bone 0.500000
+frame bone texture
+= frame 0.500000 -1 = bone vertex
+frame = -1 material vertex
+=
+1.0
+-1 -1
+-1 1.0 -1 frame 1.0 0.500000
+= vertex texture 1.0 bone material -1 bone vertex vertex
+vertex = = =
+material 1.0
+material 0.500000
+frame
+1.0
+texture anim
+0.500000
+texture
+= 0.500000 = 0.500000 0.500000 -1 -1 = texture vertex 1.0 0.500000 bone texture vertex 1.0 frame 1.0 bone anim frame -1 anim 0.500000 vertex -1 anim frame frame
+= -1
+texture =
+frame texture 0.500000 -1 texture vertex material 1.0 texture
+anim vertex
+= frame
+1.0
+bone -1 0.500000
+frame = material 0.500000
+vertex
+0.500000 bone vertex frame
+anim bone
+texture bone frame
+vertex
+0.500000 = =
+-1 frame bone vertex =
+0.500000 = anim = 0.500000 material material anim anim frame anim 1.0 bone bone
+1.0 anim bone 1.0 1.0 =
+texture vertex texture = vertex
+anim
+material
+1.0
+0.500000 anim vertex 1.0 vertex anim texture texture frame -1
+texture 1.0
+bone 1.0 0.500000 material -1 0.500000 -1 vertex
+-1 1.0 1.0 =
+0.500000 -1 material vertex bone
+bone frame anim
+0.500000 1.0 0.500000 = texture 0.500000 texture material
+anim vertex 1.0
+material frame 1.0
+=
+anim anim -1 bone vertex frame
+frame = anim anim material 0.500000 0.500000 material 1.0 texture
+vertex material vertex vertex
+vertex
+frame texture vertex frame -1 anim -1 1.0 material anim -1 vertex
+1.0 -1 vertex frame frame -1 anim =
+frame -1
+texture
+vertex anim texture
+-1 material = vertex
+1.0 -1
+texture texture
+1.0 bone frame = 0.500000 -1 1.0 texture texture texture
+vertex
+0.500000 texture
+material material 1.0
+-1 0.500000
+1.0 -1 0.500000 material anim 1.0 = material
+anim anim frame -1
+vertex material 0.500000 0.500000
+frame
+bone vertex vertex -1
+bone vertex = -1 bone texture bone =
+frame material material
+anim = bone
+0.500000 material texture
+anim frame -1 bone
+= material = texture vertex = anim 0.500000 bone vertex
+anim =
+vertex frame
+frame
+-1
+-1
+= texture texture
+1.0 texture
+1.0 -1 texture frame -1
+anim
+bone frame bone anim bone 0.500000 anim vertex material -1
+frame
+0.500000 texture vertex 0.500000 1.0
+0.500000 material anim = texture 0.500000 texture 0.500000
+anim
+anim
+0.500000 bone texture anim bone bone -1 vertex vertex material
+-1
+1.0
+texture 1.0 vertex
+texture 0.500000 material -1 1.0 material = 1.0 texture vertex -1
+frame frame
+frame bone
+= 1.0 bone = 1.0 anim vertex = anim
+0.500000 frame anim
+material
+0.500000 1.0 = frame
+1.0 -1 1.0 frame
+= vertex = = vertex anim vertex
+bone
+anim
+= vertex 0.500000 material 1.0 texture
+-1
+anim
+0.500000 anim frame anim
+-1 frame 1.0 texture
+bone bone
+material
+1.0
+bone -1 texture
+material texture vertex 1.0 = frame material
+vertex material anim texture -1 vertex -1 texture 0.500000 vertex frame texture texture vertex texture -1 material
+material 1.0 frame -1 anim
+= vertex vertex
+anim texture = bone 1.0
+bone = texture material 1.0 0.500000 bone bone = material texture vertex 0.500000 1.0
+frame
+-1
+frame bone -1 texture
+texture 1.0 = material -1 = bone
+bone = frame material -1
+material 0.500000 0.500000
+texture -1 material texture bone 0.500000
+0.500000
+vertex 1.0 1.0 0.500000 texture 0.500000 anim -1 = bone texture vertex
+anim material
+0.500000 texture vertex bone material -1 anim frame
+vertex = vertex bone -1 anim 1.0 texture
+anim material 0.500000 = texture texture bone
+bone material
+-1 0.500000 1.0 frame
+texture = 1.0 anim 0.500000 = vertex material 0.500000
+= texture
+anim bone bone texture = frame texture
+texture bone =
+vertex = = 0.500000 vertex vertex 0.500000 vertex texture =
+= = -1 = = frame texture -1
+vertex frame =
+frame frame 1.0
+frame anim vertex 1.0 frame material bone texture 0.500000 frame
+0.500000
+1.0
+-1 anim material 1.0
+-1 0.500000 texture
+frame bone -1 bone = bone -1
+0.500000 = frame 0.500000 frame = frame texture 0.500000 material bone
+vertex anim anim
+0.500000 vertex
+material
+texture vertex vertex 0.500000 -1 frame 1.0 frame bone anim 0.500000
+= anim frame = texture vertex material frame bone 0.500000 bone
+0.500000 vertex
+vertex
+vertex
+texture 1.0 frame material vertex
+-1 anim
+material texture -1
+-1 = -1
+=
+vertex material texture
+-1 vertex vertex 1.0 1.0 vertex 1.0 0.500000 vertex 0.500000
+frame frame vertex vertex vertex
+bone frame bone -1 texture vertex texture 0.500000
+0.500000 material -1 -1 frame
+-1 material 1.0 = = texture material =
+material texture
+0.500000 vertex
+-1 0.500000
+0.500000 1.0 material anim 0.500000 material
+texture
+texture
+1.0 material vertex material anim bone texture
+-1 = bone
+-1 material vertex 0.500000 anim 0.500000 -1 bone anim
+1.0 -1 1.0 material material vertex texture 0.500000 texture
+frame anim anim anim material anim
+anim frame
+= frame frame vertex = 0.500000
+texture 0.500000 material -1 vertex -1
+frame 0.500000 vertex 0.500000 anim 1.0 texture 0.500000 anim anim
+anim = =
+-1 frame vertex 1.0
+-1
+texture 1.0 bone vertex 0.500000 0.500000 material
+-1 material bone frame 0.500000
+material = anim vertex = vertex = -1 anim anim bone 0.500000 anim
+bone anim anim 0.500000
+anim anim
+material bone
+bone
+anim
+anim bone 0.500000
+0.500000
+bone frame material -1 0.500000
+bone -1
+bone material vertex = frame
+texture =
+-1 texture frame
+texture
+= 1.0 1.0
+= bone
+0.500000 material bone = anim
+0.500000 = = material -1 bone material
+material -1 1.0 vertex frame
+0.500000 =
+bone texture =
+texture -1 0.500000 1.0 material
+bone
+texture 1.0 material
+anim vertex = frame -1
+texture material anim = -1 0.500000 =
+= bone
+vertex
+1.0 1.0 texture bone anim anim -1 0.500000 texture frame
+1.0
+bone
+0.500000
+frame bone vertex 1.0
+= material
+=
+bone
+anim =
+vertex vertex
+vertex =
+-1
+bone texture texture 0.500000 =
+vertex
+=
+0.500000
+anim bone material frame bone vertex bone
+material
+texture 1.0
+bone
+texture texture 1.0 = 0.500000 anim material anim frame -1
+-1 anim
+= material
+material -1 frame
+-1 frame = 1.0 frame bone
+= 0.500000 anim
+-1 bone
+frame
+=
+material frame anim texture 0.500000 = material frame frame
+texture texture
+material =
+anim
+vertex -1 1.0 anim material texture 1.0 1.0
+1.0
+-1 vertex = 1.0 vertex texture =
+frame anim anim 1.0 -1 frame frame bone 1.0 texture
+1.0
+frame 1.0 material bone anim
+frame frame -1 -1 -1 texture
+material bone material =
+-1 material
+material anim 0.500000 = vertex bone
+bone anim anim vertex 0.500000 0.500000 1.0 1.0 = 1.0
+0.500000 =
+anim texture = 1.0 -1
+= anim anim anim material anim anim
+material bone vertex vertex
+anim = material 1.0 frame
+material texture anim
+frame texture
+bone vertex 0.500000
+frame
+anim material
+mater
\ No newline at end of file
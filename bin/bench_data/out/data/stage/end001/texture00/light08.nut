@@ -0,0 +1,13 @@
+bone bone 0.500000 texture anim -1 0.500000
+material
+vertex frame frame
+bone vertex material material 0.500000
+texture frame 0.500000 texture
+-1
+texture -1
+anim 1.0
+0.500000 bone = material texture -1 = vertex = material
+= frame
+texture anim vertex anim 0.500000 0.500000 texture 1.0
+vertex 1.0 vertex 0.500000 material
+anim bone frame texture
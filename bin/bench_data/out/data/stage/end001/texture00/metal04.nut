@@ -0,0 +1,28 @@
+bone
+vertex -1 frame
+material material = = vertex
+0.500000 anim
+material -1
+vertex = frame -1 material
+bone anim = vertex frame 1.0
+= anim
+frame
+material -1 -1 vertex anim anim
+material -1 = -1 0.500000 -1
+anim -1 anim -1 = material anim
+material
+material =
+bone frame
+= -1 material -1 frame -1 material frame 0.500000 -1 texture = bone
+frame anim
+vertex 0.500000 frame bone material vertex texture material material material -1 1.0 material 0.500000 anim -1 = bone bone
+texture material vertex bone
+frame frame
+bone -1 texture
+= bone anim frame anim = bone bone 0.500000 = -1 0.500000 anim 1.0
+1.0
+-1
+= texture -1
+frame anim material frame
+texture frame texture
+texture = = 
\ No newline at end of file
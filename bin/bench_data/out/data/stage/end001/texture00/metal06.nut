@@ -0,0 +1,57 @@
+-1
+=
+vertex
+bone vertex 1.0 bone anim bone
+0.500000 material frame
+material frame
+-1 bone texture
+frame frame material 1.0 -1 texture 1.0 =
+1.0 texture -1
+anim
+0.500000 anim material material 0.500000 = material = vertex material
+frame anim
+-1 bone
+-1 material
+1.0 material frame
+texture = -1 -1 1.0 0.500000 anim -1
+0.500000 1.0 0.500000 0.500000 bone 0.500000
+-1 frame
+0.500000 =
+frame anim
+=
+vertex 1.0 vertex
+= = 1.0 texture
+texture material
+-1 material 0.500000 vertex frame 0.500000 frame
+bone -1 material
+-1 material
+0.500000 = -1 0.500000
+= 0.500000 = =
+bone 0.500000 anim frame
+= bone frame 0.500000 vertex = 1.0 -1 anim
+-1
+vertex
+texture
+anim frame anim vertex bone -1
+= anim texture anim
+1.0 bone
+texture vertex texture = bone
+1.0 anim = material frame material bone bone bone 0.500000
+texture
+0.500000
+texture 0.500000 vertex frame anim vertex bone 0.500000 anim
+1.0 1.0 -1 anim = texture
+texture
+bone
+anim
+material texture
+-1 frame anim
+texture
+material frame frame texture vertex = material anim texture
+texture 0.500000
+texture anim frame =
+1.0
+1.0
+frame = 0.500000 texture = frame
+-1 1.0 bone
+bone 1
\ No newline at end of file
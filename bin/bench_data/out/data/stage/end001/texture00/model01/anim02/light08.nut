@@ -0,0 +1,57 @@
+0.500000 anim 1.0 0.500000 1.0 0.500000 -1 material
+vertex frame
+1.0 bone
+texture -1 = bone vertex bone frame = texture texture frame
+bone 0.500000
+frame
+bone material
+bone = 0.500000 frame
+anim vertex -1 0.500000 = vertex anim 1.0
+anim
+bone 0.500000 texture 0.500000 vertex vertex material frame bone anim texture anim material
+anim 0.500000 anim bone bone texture =
+-1 = vertex bone frame -1 bone 1.0 frame
+texture anim bone texture
+material frame
+1.0 frame vertex = 1.0 0.500000
+= =
+material bone
+1.0
+1.0 0.500000 = 0.500000 1.0
+anim vertex 1.0 material material
+1.0 0.500000 frame
+anim -1 0.500000 texture = 0.500000 anim vertex =
+material frame 1.0
+= material anim
+0.500000 1.0 vertex -1 material texture = 1.0 frame
+0.500000
+bone = vertex -1 1.0 bone =
+= material -1 anim 1.0 frame texture
+frame material
+material
+= -1 1.0
+bone -1 0.500000 1.0
+texture vertex frame =
+frame 0.500000 1.0 vertex vertex
+1.0
+1.0 vertex
+bone anim =
+=
+-1 frame -1 frame texture 0.500000 anim frame frame 0.500000
+vertex frame anim
+bone -1
+-1
+= anim anim bone = vertex anim vertex 1.0 -1 0.500000 vertex 0.500000
+material
+frame
+anim texture vertex anim =
+material vertex frame 0.500000 1.0 texture bone
+vertex 1.0 0.500000
+1.0 texture anim material
+texture -1 = bone 1.0
+anim
+-1 1.0
+0.500000 anim texture
+-1 vertex frame anim 0.500000
+= anim -1 -1 texture material vertex = 1.0 -1 1.0 material material frame vertex -1 1.0
+0.500000 1.0 -
\ No newline at end of file
@@ -0,0 +1,9 @@
+vertex vertex -1 bone texture vertex material vertex vertex -1
+-1
+bone -1 = anim 1.0 bone anim bone -1 -1
+0.500000 -1 bone vertex material -1 material
+0.500000 0.500000 material 0.500000 anim = anim 1.0 =
+vertex
+vertex = frame material vertex 0.500000 bone -1 anim 0.500000 vertex frame bone
+0.500000 0.500000 1.0 -1
+-1 texture fr
\ No newline at end of file
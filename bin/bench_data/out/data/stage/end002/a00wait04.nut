@@ -0,0 +1,25 @@
+-1 -1 -1
+-1 material -1 = material 1.0 anim material -1 texture material vertex
+texture frame 1.0 frame anim texture material
+frame frame
+bone vertex vertex 1.0 texture material texture bone
+anim frame
+material frame material texture
+material material anim = material
+-1 frame 0.500000 material material 1.0 bone
+anim frame bone -1 anim frame 1.0 anim 0.500000 -1 0.500000 = frame material 0.500000
+-1 1.0 texture bone frame bone texture
+-1
+frame
+material vertex
+1.0 bone anim 1.0 -1 bone
+-1
+-1
+material
+material 0.500000 bone
+bone = = -1
+texture material material
+frame
+material
+0.500000
+mate
\ No newline at end of file
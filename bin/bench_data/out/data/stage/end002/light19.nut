@@ -0,0 +1,4 @@
+vertex vertex 0.500000
+0.500000 texture 0.500000 vertex
+0.500000 frame 0.500000 = vertex texture texture 1.0 material frame vertex vertex
+0.500000 0.500000 texture 0.500
\ No newline at end of file
@@ -0,0 +1 @@
+bone = vertex frame 1.0 1.0 bone vertex ani
\ No newline at end of file
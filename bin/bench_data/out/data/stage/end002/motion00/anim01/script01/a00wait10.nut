@@ -0,0 +1,155 @@
+bone
+=
+0.500000
+material anim
+= 1.0 = 0.500000 = 0.500000 bone frame material frame
+-1
+0.500000 texture material -1
+0.500000 texture
+frame material vertex -1 material
+material frame anim
+-1 frame
+0.500000 = 1.0 vertex vertex anim = texture vertex 0.500000
+0.500000 material = =
+bone material material = 1.0 vertex anim = vertex -1 texture -1 texture 1.0 frame texture 0.500000 0.500000 material 1.0
+vertex texture -1 vertex
+material
+anim
+0.500000
+material vertex =
+vertex vertex bone bone material
+texture frame anim vertex
+=
+0.500000 1.0 material -1
+texture
+bone material
+= =
+0.500000 -1
+texture vertex
+1.0
+0.500000 frame vertex bone
+anim
+anim texture material bone material anim vertex 0.500000
+0.500000
+frame 0.500000 anim
+frame 1.0
+-1
+=
+anim 0.500000 bone
+frame = bone
+-1 texture texture vertex anim vertex
+0.500000
+bone frame vertex
+vertex -1 anim -1 bone
+bone material 1.0
+vertex = 0.500000 frame
+bone material frame bone bone =
+0.500000 1.0 vertex 0.500000 0.500000 -1 anim anim 1.0
+material texture frame
+bone bone -1 -1 bone material frame bone bone vertex material
+bone -1 1.0 vertex anim
+= 1.0 material anim
+-1 1.0
+vertex
+bone 1.0 anim frame
+texture
+-1 =
+= anim vertex vertex bone material vertex anim 1.0
+vertex anim texture
+material material anim
+0.500000 0.500000 0.500000
+material material bone 0.500000 1.0 texture material
+bone
+vertex bone -1 bone frame = -1 -1 0.500000 anim
+= -1 material 0.500000 bone frame anim = bone bone frame =
+frame material
+-1 0.500000
+-1
+1.0 vertex 1.0
+frame anim
+-1
+anim 0.500000 vertex anim bone = texture bone frame -1
+vertex anim bone
+-1
+bone anim 1.0 =
+-1 = material 1.0
+= -1
+1.0
+frame frame 0.500000
+-1 frame bone
+bone anim 0.500000 0.500000 bone frame anim 0.500000 vertex
+material 1.0 texture material 0.500000 anim
+material 0.500000 bone
+frame
+texture anim 0.500000
+frame = 1.0 bone texture material anim -1 1.0 anim -1 1.0 bone 1.0
+= anim vertex = 1.0
+1.0
+texture
+0.500000 texture 0.500000 vertex
+=
+bone vertex vertex bone material
+material texture frame 1.0 anim bone 1.0 0.500000 frame
+vertex
+1.0 0.500000 material
+0.500000 0.500000 = anim = material anim texture material anim vertex -1 vertex -1 = material frame
+-1
+texture texture bone -1 texture bone
+-1 -1 texture
+= material bone material
+anim material bone material 1.0 0.500000
+texture bone 1.0 0.500000 0.500000 vertex -1 0.500000 anim
+-1
+texture vertex bone texture material -1 anim frame 0.500000
+-1 material frame texture frame frame material = anim 1.0 anim 1.0 = 0.500000 0.500000 material material
+bone bone
+anim frame frame vertex
+texture = -1
+vertex
+-1 vertex texture material material anim material texture texture
+anim material
+anim =
+= material
+bone vertex material
+texture
+vertex vertex material
+1.0 bone vertex texture 0.500000 material
+-1 vertex
+material bone
+frame anim
+texture
+frame frame
+bone 1.0 0.500000 0.500000
+bone 1.0 anim vertex bone 0.500000 0.500000 texture =
+vertex texture frame frame = bone vertex = material material bone bone frame frame
+0.500000 -1
+bone =
+bone texture texture anim 1.0 anim
+1.0 texture
+1.0
+-1
+frame texture
+= frame = anim frame anim
+1.0 material bone
+-1 material vertex
+=
+-1 frame material 1.0 bone
+0.500000 frame 1.0 0.500000 texture -1 -1 =
+1.0 anim material vertex
+vertex frame vertex frame
+anim material material
+-1 material = 0.500000 1.0
+vertex 0.500000 frame material anim material bone vertex bone material -1 1.0 = = anim vertex
+= material vertex frame
+bone vertex 0.500000
+bone frame 1.0 vertex material texture texture vertex 0.500000 = 1.0 material -1 bone
+frame material vertex frame -1 =
+0.500000 anim bone bone material = -1 -1 bone texture
+1.0 texture 1.0
+texture
+-1 frame
+vertex = -1
+-1 =
+vertex vertex -1 texture frame 0.500000
+texture -1 -1 material vertex = bone 0.500000 anim -1
+an
\ No newline at end of file
@@ -0,0 +1,30 @@
+vertex
+material = material = texture bone =
+vertex texture anim vertex 1.0 material material vertex
+material frame bone anim -1
+= material -1 1.0 frame 1.0 material texture 1.0
+anim
+material
+anim
+frame anim 1.0
+frame 0.500000 vertex 1.0 -1
+bone frame material material vertex 0.500000
+0.500000
+-1 0.500000
+0.500000 material bone anim material -1 bone
+=
+frame vertex 0.500000 material material anim -1
+bone
+0.500000 frame texture material material vertex anim anim -1 frame bone material
+frame 1.0
+-1 anim
+=
+bone
+bone texture
+bone frame =
+= 0.500000 1.0
+texture vertex vertex
+material
+-1
+-1 frame 0.500000 -1 bone
+anim frame fra
\ No newline at end of file
@@ -0,0 +1,139 @@
+anim
+texture texture -1 = = frame anim
+bone frame texture material -1 texture 0.500000 1.0 = 0.500000
+bone vertex texture anim
+anim -1 -1
+= vertex
+vertex anim
+= material frame bone material -1 0.500000 texture
+texture 0.500000
+anim frame =
+= 1.0 vertex 1.0 1.0 1.0 1.0 -1
+texture 0.500000
+0.500000
+= -1 material
+material material 0.500000 vertex 1.0 0.500000
+anim
+=
+bone material -1 0.500000 1.0 1.0 texture 1.0 -1 vertex material = anim frame 1.0 1.0 bone anim
+frame material frame 0.500000 texture 1.0
+1.0
+material
+material
+-1 texture
+texture
+1.0 frame = vertex = material -1
+anim vertex 1.0 vertex frame vertex 1.0
+1.0 frame 0.500000 = 1.0 frame
+anim anim bone texture material
+0.500000 material bone frame
+1.0 0.500000 vertex bone
+anim material texture
+0.500000
+frame
+=
+vertex = -1 1.0 0.500000 texture bone bone bone texture
+bone anim
+-1
+anim 1.0
+frame -1 material
+material material bone frame
+frame
+bone material texture texture vertex -1
+0.500000 1.0
+bone frame
+material
+= vertex
+-1
+texture 1.0 anim
+vertex 0.500000 texture anim anim -1 texture
+texture
+bone frame anim 0.500000 1.0 -1 1.0 frame material = material = frame vertex material
+= anim 0.500000 frame frame vertex 1.0 anim 1.0 texture bone vertex anim
+anim 1.0
+anim vertex bone 0.500000 vertex frame material 0.500000 material
+material frame 0.500000
+= texture anim texture
+bone material 1.0 1.0 -1 frame -1 bone vertex 0.500000 0.500000 texture anim material 1.0
+frame frame
+texture
+frame = bone frame = anim = anim vertex
+anim =
+-1 texture
+=
+frame 0.500000 texture texture -1
+anim texture vertex material anim anim material texture frame
+bone -1 vertex vertex 0.500000 vertex 1.0 0.500000
+frame anim
+-1 bone material bone
+vertex -1 frame texture bone anim =
+= -1 0.500000 1.0 0.500000 vertex 1.0 material 1.0 texture
+vertex anim frame
+texture anim -1
+1.0 1.0
+material 0.500000 frame
+vertex 0.500000 -1 bone vertex
+frame vertex
+-1 anim
+vertex frame -1
+texture 1.0
+anim frame bone vertex 0.500000 0.500000 material anim anim frame
+frame bone
+texture 0.500000 texture bone
+frame frame
+material vertex anim -1
+1.0
+texture 0.500000
+1.0 1.0 texture =
+bone 0.500000 1.0 1.0 frame material texture
+-1
+0.500000 bone 0.500000
+1.0 frame 1.0 vertex texture bone 1.0 vertex
+=
+1.0 vertex
+bone
+anim 0.500000 frame
+1.0 -1 anim
+-1 texture material bone 1.0 =
+texture frame -1
+bone material material
+texture texture 1.0 0.500000 -1 bone 1.0 material 0.500000
+bone
+anim material
+vertex texture 0.500000
+0.500000 bone
+vertex 0.500000
+= =
+vertex bone texture -1 texture material = 1.0 bone texture material -1 vertex vertex
+frame =
+0.500000 -1
+-1
+vertex
+frame -1 bone frame
+texture anim
+material vertex -1 = frame -1 0.500000
+vertex
+anim -1 1.0
+1.0 frame vertex 0.500000
+1.0 texture -1 material bone = 1.0 texture
+material material bone texture texture frame 0.500000 -1 =
+1.0
+material bone frame
+vertex
+texture texture anim = material material
+1.0 1.0 vertex 0.500000
+= = 0.500000 -1
+0.500000
+0.500000
+material 1.0 anim bone bone
+1.0
+anim -1 1.0
+0.500000 material texture
+= =
+anim bone frame
+frame bone frame frame vertex anim frame
+texture
+0.500000 0.500000 -1 anim material vertex anim material 0.500000 material bone -1 vertex material texture 1.0 -1
+material texture = =
+frame anim material
+-1 -1 vertex 1.0 frame = vertex texture 
\ No newline at end of file
@@ -0,0 +1,89 @@
+texture material 1.0 anim frame = 0.500000 0.500000
+material vertex 0.500000 anim material bone -1 = 0.500000 bone
+1.0 =
+texture 1.0 1.0 0.500000
+1.0 -1 1.0
+bone 0.500000
+frame vertex bone
+texture bone bone
+0.500000
+0.500000 -1 material
+= bone vertex 0.500000 1.0
+0.500000 material 0.500000 texture vertex texture texture
+texture bone 1.0 anim vertex material vertex material 0.500000 -1
+0.500000
+frame 1.0
+0.500000 =
+bone
+anim bone vertex
+-1 material anim
+1.0 -1 0.500000 anim material 0.500000
+-1 =
+0.500000 -1 1.0 0.500000 = vertex frame -1 anim vertex
+texture
+material texture
+=
+material 1.0 0.500000 0.500000
+0.500000 anim = material 1.0 bone texture
+vertex
+vertex anim 1.0
+texture vertex vertex anim material 0.500000 frame
+texture -1 vertex -1 material vertex -1 bone 0.500000 = 1.0 material 0.500000 =
+0.500000 anim
+vertex vertex frame material -1 1.0 1.0 -1 -1 0.500000 1.0 frame
+1.0 -1 anim
+vertex
+= bone 1.0 vertex = vertex =
+material 0.500000 material
+= 1.0 anim material 1.0 = texture anim bone 0.500000 texture -1
+= vertex -1 0.500000 0.500000 frame material frame
+vertex frame frame = vertex vertex texture 0.500000 material -1 = material 1.0 0.500000 material 0.500000 frame texture anim 0.500000
+frame 1.0 texture
+0.500000
+0.500000
+vertex 0.500000 texture vertex
+vertex -1 = 0.500000 frame bone bone vertex
+0.500000 -1
+1.0 vertex -1 0.500000 material 0.500000 0.500000 texture
+= = frame 1.0 material frame -1 vertex = material vertex bone 1.0 texture
+texture anim = -1 frame frame anim 1.0 = texture texture = = 1.0
+0.500000 material anim
+frame frame bone = material material
+= material vertex material = -1 bone 0.500000 frame
+anim anim texture
+0.500000 bone texture = anim texture frame
+material anim frame vertex
+bone 0.500000 bone material anim frame bone = 0.500000
+vertex frame 1.0 material 1.0 = 1.0 vertex frame
+1.0 frame vertex
+-1 0.500000 1.0 frame texture texture -1 bone -1 0.500000 1.0 -1 material vertex texture bone vertex material anim 1.0 bone frame 0.500000
+bone 0.500000 -1
+vertex
+anim = 1.0 frame frame anim frame material
+1.0 1.0 material
+vertex
+texture
+bone = vertex -1 texture texture vertex = bone
+-1 bone frame
+-1 frame = 1.0
+material -1 1.0 -1
+1.0 0.500000 texture
+vertex = 0.500000 1.0 texture bone
+1.0 = texture
+vertex 0.500000 1.0 0.500000 1.0
+-1
+= vertex
+vertex
+= bone
+anim 0.500000 0.500000 1.0 bone 1.0 =
+vertex texture =
+texture -1 vertex
+bone texture -1 bone = vertex = vertex vertex frame 1.0
+1.0 texture anim frame 0.500000 material material
+vertex = frame 1.0
+vertex 1.0 vertex vertex -1 anim 1.0 0.500000
+anim
+-1 vertex
+1.0 -1 vertex texture
+texture anim = 0.500000
+vertex 0
\ No newline at end of file
@@ -0,0 +1,116 @@
+bone material vertex
+1.0 frame 1.0 frame
+-1 texture -1 0.500000 bone -1 0.500000
+bone =
+anim texture 1.0
+material
+0.500000 =
+-1 vertex material 1.0
+frame texture = anim = anim texture
+0.500000 -1 0.500000 material anim 1.0
+1.0
+1.0 -1 bone vertex
+anim vertex 1.0 bone 0.500000 1.0 0.500000 1.0 1.0 texture vertex texture frame material frame anim material 1.0
+anim
+1.0 material material frame 1.0 bone material 1.0 anim
+material bone
+-1 material bone
+bone -1 0.500000 0.500000 material
+=
+texture -1 bone 0.500000 = bone vertex bone
+bone texture =
+1.0 anim =
+texture bone 1.0 bone frame anim -1 frame
+frame bone = -1 material bone 0.500000 bone =
+frame -1 frame 1.0
+0.500000 material anim
+material frame bone anim 1.0
+texture
+1.0 anim 1.0
+0.500000 frame anim vertex
+texture 0.500000
+-1 material -1 vertex 0.500000 = frame 0.500000 bone
+texture frame = bone vertex frame 1.0 texture bone
+texture material texture vertex 0.500000 texture texture -1 bone frame -1 = 0.500000 material material =
+anim
+1.0 vertex
+anim anim 0.500000 texture -1 anim
+= =
+vertex
+= = frame 1.0 -1
+anim -1 bone material -1 = frame material texture texture
+material bone -1 0.500000 -1 bone vertex
+material -1 vertex 1.0 -1 frame anim texture 0.500000 anim
+frame material
+vertex =
+-1 texture 1.0 =
+material
+-1 = anim texture material texture
+frame -1 -1 bone bone material = 1.0 texture vertex
+material 1.0
+1.0 frame 1.0 frame 0.500000 = frame 1.0
+material 0.500000
+frame material
+texture frame
+frame anim vertex 1.0 material texture 1.0 bone -1 material texture 1.0 texture
+1.0
+1.0 vertex material frame = = texture anim
+= = = 1.0 frame anim vertex 1.0 material anim material
+=
+-1
+material
+vertex
+= vertex
+frame material material
+vertex material 0.500000
+anim
+vertex anim
+texture frame vertex anim
+-1 0.500000 0.500000
+frame
+0.500000 -1
+bone vertex anim vertex -1 0.500000
+anim 0.500000 = texture
+vertex material vertex 0.500000
+1.0 texture 0.500000
+bone frame = -1 1.0 bone
+material
+texture = = texture 0.500000 bone texture bone
+material
+1.0 texture
+=
+0.500000 -1 = = 1.0 anim =
+anim bone vertex
+1.0 -1 -1
+vertex
+0.500000 bone vertex = -1 texture texture vertex vertex frame = vertex bone anim texture
+anim anim
+vertex 1.0 1.0 -1 1.0 0.500000 frame anim texture -1
+anim
+texture material 1.0 frame bone 0.500000 bone
+vertex anim
+vertex 0.500000 -1
+frame
+material material bone
+bone = vertex material
+material vertex
+=
+texture bone texture 1.0 vertex = texture
+0.500000 vertex material
+= = material
+vertex bone 0.500000 = texture -1 frame
+anim anim = anim vertex frame
+-1
+= -1 -1
+0.500000 = frame
+1.0 -1 frame vertex material 0.500000
+0.500000
+bone
+material vertex bone bone frame -1
+vertex 1.0 texture = 1.0 texture
+-1 vertex texture
+= -1 material = texture
+=
+texture 0.500000 texture 0.500000
+-1 texture 1.0 -1
+bone
@@ -0,0 +1,56 @@
+-1 bone
+frame -1 vertex 1.0
+material anim
+-1 anim 1.0
+= bone 1.0
+anim material =
+frame frame frame texture texture -1 vertex frame bone
+=
+1.0
+1.0 material -1 texture anim
+frame bone frame = = bone
+frame =
+1.0 anim 0.500000
+frame texture
+material -1 anim frame 1.0 bone frame frame
+anim frame
+texture
+texture frame vertex vertex texture anim
+material -1 texture 0.500000 frame = material bone vertex
+material texture bone vertex -1 bone 0.500000 bone vertex
+0.500000 -1 texture
+anim frame anim anim 0.500000 material material frame material 0.500000 bone texture 0.500000 frame 0.500000 vertex 1.0 -1 anim
+texture
+0.500000
+anim 0.500000 anim
+0.500000
+vertex material material
+material = texture vertex frame -1
+=
+-1
+texture bone 0.500000
+1.0
+1.0 frame 1.0 vertex material
+frame -1 = = frame anim -1 bone -1
+= texture
+vertex 0.500000 -1 1.0 1.0 material -1 texture 0.500000 material 1.0 frame bone = anim = bone material bone
+1.0 =
+material bone frame
+vertex frame = anim vertex anim material 1.0 anim bone
+1.0 frame frame
+bone
+material -1 0.500000 texture material vertex
+1.0 -1 material 0.500000
+anim texture frame material
+vertex material
+vertex
+= bone vertex frame bone texture
+texture bone anim material texture
+anim
+-1 anim anim
+1.0 material
+material material anim
+material bone = frame 0.500000 -1
+0.500000
+material 0.500000 bone vertex
+0.500000 1
\ No newline at end of file
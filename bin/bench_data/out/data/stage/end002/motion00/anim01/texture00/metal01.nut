@@ -0,0 +1,5 @@
+vertex anim = = anim
+texture vertex
+bone bone frame -1 -1
+texture anim -1 0.500000 anim
+materi
\ No newline at end of file
@@ -0,0 +1 @@
+4<QPaKM9^Xϵ!iR
\ No newline at end of file
@@ -0,0 +1,20 @@
+bone
+anim = 0.500000 vertex 1.0
+material
+= material = texture
+vertex
+1.0 1.0 texture anim
+texture
+= texture 0.500000
+0.500000 0.500000 texture
+-1 bone texture frame 0.500000 1.0
+texture 1.0 -1
+= 1.0
+= material -1
+-1 1.0 bone -1
+=
+bone
+bone frame 1.0
+texture bone 1.0 texture frame 1.0 anim 0.500000 1.0 material bone -1 -1 vertex frame
+-1
+fra
\ No newline at end of file
@@ -0,0 +1,8 @@
+frame texture anim -1 bone 0.500000
+-1 -1 frame texture = = 0.500000
+-1 anim texture -1 bone vertex
+bone material anim bone 0.500000
+vertex frame vertex frame 0.500000 1.0 bone texture frame 1.0
+= = 0.500000 1.0 frame frame bone
+bone material 0.500000 vertex vertex
+0.500000 material vertex bone 1.0 texture bone 
\ No newline at end of file
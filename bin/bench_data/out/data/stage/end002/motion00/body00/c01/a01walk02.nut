@@ -0,0 +1,29 @@
+texture frame -1 = 1.0 = vertex vertex bone
+anim bone 1.0
+= anim vertex frame vertex texture -1 -1 vertex bone 0.500000
+1.0 vertex anim vertex -1 frame
+vertex 0.500000 material
+bone -1 bone
+-1 1.0 material
+texture
+anim = frame
+texture
+bone
+anim 1.0
+-1 0.500000
+anim 0.500000 frame
+= -1 0.500000
+-1 material material material bone 0.500000 texture
+vertex vertex
+bone
+-1
+bone material frame
+1.0 vertex
+1.0 0.500000 vertex bone =
+= -1
+0.500000 0.500000 = = 1.0 material frame material material -1
+texture frame 0.500000 texture -1
+vertex 1.0
+material 0.500000 frame
+=
+bone 1.0 materia
\ No newline at end of file
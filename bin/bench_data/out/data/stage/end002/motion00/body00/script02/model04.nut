@@ -0,0 +1,304 @@
+anim bone anim
+bone -1
+0.500000 material 1.0
+= 0.500000
+0.500000 = frame texture =
+anim =
+1.0 vertex -1 vertex bone material 0.500000 bone 1.0 material 1.0
+anim = -1
+1.0 bone texture -1 bone anim -1 -1 = -1 frame texture 1.0
+anim -1 vertex anim -1 material bone frame bone -1 texture
+material vertex bone vertex anim anim texture
+texture
+bone 0.500000
+= 1.0 0.500000 = bone
+texture = material bone
+bone bone frame 0.500000
+material -1 =
+= 1.0 bone material 0.500000 1.0 = 0.500000 frame =
+texture
+texture frame = -1 material frame vertex 1.0 0.500000
+material = anim anim
+bone frame -1
+bone anim
+frame frame =
+bone bone texture vertex frame anim -1 vertex
+texture texture material
+frame 0.500000 bone frame
+anim 0.500000
+frame anim vertex frame material = 0.500000
+texture
+anim anim 0.500000 texture anim
+anim vertex vertex 1.0 1.0 vertex texture -1
+material
+anim
+0.500000 frame -1 frame texture texture
+material texture 1.0 -1
+anim -1
+bone bone = bone bone 0.500000 anim frame frame material frame material material
+texture vertex 1.0 bone
+=
+material -1 texture bone bone texture texture
+-1 bone
+anim
+1.0 material anim 0.500000 = texture vertex texture 0.500000
+-1 bone =
+material
+1.0 0.500000 1.0 bone bone material
+0.500000
+material =
+frame
+material 0.500000 anim
+0.500000
+0.500000 anim anim bone vertex -1 0.500000 vertex bone frame -1 texture material
+anim
+anim
+material vertex
+0.500000
+texture
+1.0 texture = frame material 1.0 vertex anim
+frame bone texture texture anim
+frame texture = material vertex anim anim
+bone
+material frame -1 vertex vertex frame 0.500000
+vertex vertex 0.500000
+anim
+0.500000 = frame vertex
+material 1.0 = frame = = = vertex vertex 0.500000 = vertex
+0.500000 anim anim bone
+vertex
+1.0 texture frame
+1.0 frame 1.0
+=
+0.500000 texture frame
+material 0.500000 frame
+= texture frame frame texture -1 -1 material
+bone anim frame =
+texture 0.500000 material = 0.500000 bone 1.0 -1 1.0 = bone
+vertex
+0.500000
+material 0.500000 =
+bone -1 -1
+-1
+vertex anim bone 1.0
+= = bone vertex 0.500000
+vertex 1.0 texture
+0.500000 = vertex texture
+frame 1.0 -1 bone 0.500000 = texture 0.500000 = anim = texture frame material vertex
+vertex texture texture 1.0
+texture 0.500000
+bone 1.0
+= bone 0.500000 texture
+texture 1.0 vertex anim
+1.0 -1 1.0 1.0 0.500000 material material frame anim
+bone
+material anim
+-1 -1 texture material
+-1
+anim
+vertex
+-1 vertex
+anim bone texture texture
+bone texture texture frame vertex 1.0 texture bone bone 0.500000 =
+anim vertex
+texture -1 bone 0.500000 bone = = 1.0 material
+= vertex anim = frame vertex texture
+frame =
+vertex =
+-1
+texture
+vertex
+anim bone 1.0 1.0 -1 0.500000 = material bone
+bone anim -1 anim -1
+texture
+= texture
+1.0 = frame
+anim
+-1 bone anim 0.500000 bone vertex 1.0
+material
+0.500000 1.0 vertex
+material
+texture material
+= bone frame = -1
+anim material bone vertex 1.0
+texture material -1 frame vertex 1.0
+material texture -1 texture 1.0
+=
+-1 texture vertex = material bone 0.500000 texture =
+vertex 0.500000
+frame 1.0
+-1 frame
+material -1
+texture -1 1.0 1.0 -1 = frame = vertex
+-1 anim 0.500000 material bone texture frame bone anim
+= 1.0 =
+0.500000
+bone
+-1 bone anim material anim frame
+= 0.500000
+anim bone anim texture texture 0.500000 -1 anim vertex
+anim -1 -1 frame
+bone texture = bone texture texture bone anim = 1.0
+texture frame frame frame
+-1 anim texture texture 1.0 material 0.500000 texture texture 1.0 texture 0.500000
+vertex
+-1 vertex frame bone 1.0
+bone material anim texture 1.0
+= -1 0.500000
+vertex vertex material
+material material
+anim
+vertex 1.0 1.0 vertex texture frame texture
+-1
+frame -1 anim
+material 0.500000 0.500000 material
+texture
+anim =
+-1 -1
+material
+frame 0.500000 frame 0.500000 1.0 vertex 1.0 = material
+texture 0.500000 1.0 bone
+bone anim
+texture anim
+material 0.500000
+anim
+frame bone material
+bone bone material
+vertex anim texture 1.0
+bone anim anim frame 1.0
+vertex frame anim material bone frame bone vertex 1.0
+material frame vertex frame
+texture 0.500000 anim 1.0 anim material =
+material 1.0 0.500000 texture
+vertex -1 =
+vertex frame 1.0
+material anim 0.500000
+0.500000 frame
+-1
+0.500000 -1 texture 1.0
+bone material frame 1.0 bone anim bone -1 = -1 vertex -1 anim material =
+-1 frame
+0.500000 0.500000 = 0.500000 -1 frame
+1.0 vertex texture 1.0 = 0.500000
+anim 1.0 vertex
+frame
+0.500000
+= = -1 frame bone bone frame material 0.500000 -1 anim -1 frame
+-1 texture frame 0.500000 texture = material
+bone vertex
+bone frame = frame
+1.0 0.500000
+texture
+material 0.500000 texture bone 1.0
+texture 1.0 0.500000 anim anim = = 0.500000 vertex material anim
+0.500000
+texture anim 0.500000 texture
+1.0
+material bone = texture
+bone
+-1 = vertex = = = bone -1 bone 0.500000
+vertex
+0.500000
+0.500000
+vertex 1.0 bone
+= material
+= bone
+anim 1.0 1.0 0.500000 =
+0.500000 -1 frame vertex anim 1.0 vertex -1
+frame 1.0 bone -1
+frame vertex bone vertex material -1 anim anim -1
+material
+frame =
+vertex
+material texture vertex frame bone anim
+0.500000 material anim 1.0 bone 1.0
+material vertex
+frame 1.0 material = material
+1.0 material vertex 0.500000 anim =
+-1 frame
+anim vertex vertex anim bone
+texture = vertex vertex -1 bone 1.0 frame
+anim
+1.0
+anim
+vertex
+-1 material 1.0 material material anim = material texture 0.500000 frame 1.0 frame texture
+anim material material anim anim frame bone material
+1.0 1.0 = frame
+material anim texture
+0.500000
+0.500000
+0.500000 vertex
+frame material
+1.0 1.0
+vertex
+anim
+= frame texture anim 0.500000 material = vertex
+texture
+-1
+anim
+=
+frame frame
+bone
+material material vertex
+-1 1.0
+texture -1 = frame frame material
+1.0 material material 1.0 vertex -1 frame = material frame texture
+bone
+-1
+-1 0.500000 1.0 frame material
+bone = frame 1.0 = 1.0 bone -1
+0.500000
+texture texture
+material 0.500000 1.0 0.500000 -1 material vertex material
+vertex 0.500000 0.500000 bone -1 1.0 vertex material
+texture -1 bone texture texture anim texture =
+-1 frame = anim = = 1.0 0.500000 frame anim
+texture frame
+material texture texture vertex texture material
+=
+vertex material = material -1
+bone vertex bone 0.500000
+vertex
+frame -1 -1 frame bone = -1 bone -1 1.0 0.500000
+= 1.0 0.500000 bone
+0.500000 texture bone -1 0.500000
+1.0 0.500000
+anim = -1 material -1 =
+1.0 0.500000
+= anim
+0.500000 -1 frame 1.0 1.0 frame -1 texture vertex bone = frame vertex
+vertex
+frame anim = anim frame
+0.500000 bone
+texture 0.500000
+= frame frame frame frame 0.500000 bone 0.500000 0.500000
+0.500000 -1 -1 anim 0.500000 vertex 1.0 = =
+0.500000 -1 vertex = frame -1 anim material frame texture 0.500000 -1 anim -1 bone 1.0 1.0 material 0.500000
+bone material texture 1.0
+0.500000 material
+anim texture frame texture bone vertex frame
+1.0 = bone bone 1.0
+vertex
+vertex anim 1.0 bone
+1.0
+vertex vertex = -1
+anim frame -1 material = material frame -1 material material -1
+anim anim 1.0 texture -1 anim bone = bone -1 =
+texture vertex
+frame bone vertex anim
+anim material
+1.0 1.0 0.500000
+frame = vertex
+vertex
+anim = texture
+material material 1.0 = -1
+1.0 texture 1.0 -1
+1.0 anim material = material bone 1.0 = = 0.500000
+= anim frame bone
+1.0 bone
+anim
+= -1
+anim
+frame
+anim texture material 0.500
\ No newline at end of file
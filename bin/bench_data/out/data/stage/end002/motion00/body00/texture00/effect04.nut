@@ -0,0 +1,5 @@
+1.0 = material frame
+-1 -1 bone vertex
+= -1
+-1 material 1.0 anim -1 texture
+anim 1.0 material bone frame anim 1.0 material 0.500
\ No newline at end of file
@@ -0,0 +1,8 @@
+bone
+frame bone texture 1.0
+-1 = texture 0.500000 material
+texture 0.500000 vertex
+frame
+texture
+frame
+material te
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone anim
+bone bone -1 anim anim ma
\ No newline at end of file
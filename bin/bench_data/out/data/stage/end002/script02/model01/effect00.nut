@@ -0,0 +1,20 @@
+bone bone material
+-1
+1.0
+material texture
+texture texture material = bone 0.500000 0.500000 -1 1.0 vertex 1.0 texture frame 0.500000 -1 vertex -1 vertex texture
+-1 1.0 vertex = material bone vertex
+-1 vertex texture -1 0.500000 material
+material -1 frame 1.0 anim bone frame frame
+1.0 1.0 = 0.500000
+bone material =
+frame -1 bone
+material vertex frame -1 0.500000 -1 bone
+frame
+-1
+frame vertex
+material =
+=
+anim
+frame
+= ma
\ No newline at end of file
@@ -0,0 +1,8 @@
+frame -1 1.0 0.500000 vertex material texture 0.500000 vertex = 1.0
+vertex
+bone texture
+=
+vertex 0.500000 material
+texture bone
+texture material 0.500000 0.500000 vertex
+anim bone 0.500000 texture 0.
\ No newline at end of file
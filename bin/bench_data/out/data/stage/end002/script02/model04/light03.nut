@@ -0,0 +1,3 @@
+bone -1
+0.500000 vertex anim 1.0 -1
+material fra
\ No newline at end of file
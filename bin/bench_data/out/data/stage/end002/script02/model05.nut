@@ -0,0 +1,327 @@
+0.500000 -1 = frame
+bone 0.500000
+=
+vertex =
+frame texture bone 0.500000
+vertex 1.0 -1
+texture = 0.500000 -1 0.500000 = material anim vertex material frame
+= anim 0.500000 vertex -1 bone = texture 1.0 frame
+bone vertex texture bone 1.0 -1 bone material 1.0 anim frame vertex
+= material material
+bone vertex anim
+material material
+bone = vertex 1.0
+vertex texture
+texture -1 =
+1.0 texture 0.500000 anim
+texture material
+frame 0.500000 frame 0.500000 bone = -1 -1 0.500000 bone frame anim vertex
+vertex texture vertex 0.500000 -1 material vertex = = 1.0 anim 1.0 0.500000 anim 1.0 vertex
+material 1.0 anim -1
+=
+bone frame texture vertex
+texture material bone = material frame anim
+1.0 vertex texture vertex frame -1 material frame frame material texture = anim =
+1.0 frame vertex anim -1 = anim 0.500000
+vertex vertex texture 1.0
+frame vertex anim
+1.0
+frame 0.500000
+0.500000 frame material texture material bone vertex material =
+texture
+frame
+0.500000 frame 1.0
+= bone 0.500000
+0.500000
+texture
+anim 0.500000 material = = anim 0.500000
+= -1 -1 vertex material anim anim material vertex
+= material frame
+material bone
+vertex -1
+1.0 = material frame frame vertex -1
+anim = 1.0 anim
+vertex bone bone
+texture frame bone texture
+= anim anim vertex
+material 1.0 texture -1 0.500000 =
+=
+material anim 0.500000 frame vertex anim anim frame
+= anim 0.500000 0.500000
+material anim anim 1.0 0.500000
+-1 -1 bone material
+bone 1.0 = 1.0 vertex =
+frame
+0.500000 anim frame vertex anim anim texture bone material texture -1 bone texture vertex 0.500000
+bone
+bone anim
+frame anim bone bone 1.0 -1 -1
+frame texture
+vertex bone frame material bone 0.500000
+1.0 texture anim
+bone anim vertex bone
+material 0.500000 frame
+material -1 frame vertex texture 1.0 bone = 0.500000 0.500000 vertex anim
+vertex
+1.0
+texture = -1 frame texture anim 0.500000 1.0 anim
+bone 0.500000 1.0
+bone 1.0 = 1.0 frame vertex
+anim anim
+vertex = material texture anim texture -1 vertex
+material = -1 -1
+0.500000 vertex bone
+vertex 1.0
+texture bone anim frame bone texture material anim frame material 0.500000 vertex frame bone
+texture bone texture material
+vertex = vertex 0.500000 texture -1 vertex bone
+material texture material anim =
+frame anim
+1.0 frame
+texture
+= anim material -1 0.500000 1.0
+0.500000 bone -1 vertex
+= material texture texture = -1 texture =
+0.500000 0.500000 anim 0.500000 vertex material -1 frame 0.500000
+anim 0.500000
+anim -1 frame vertex
+anim anim texture frame texture bone bone material vertex vertex bone =
+frame bone bone = = texture 1.0 frame anim 1.0
+vertex = -1 bone
+-1
+frame anim -1
+bone
+vertex texture
+-1 =
+vertex 0.500000 texture frame texture material =
+bone anim -1
+0.500000 material material -1
+=
+frame
+= anim vertex texture
+0.500000 frame
+frame 0.500000
+material texture anim anim
+material = 1.0 texture -1
+0.500000
+=
+-1
+0.500000 1.0
+anim vertex -1
+1.0
+vertex 0.500000 -1
+frame
+frame 1.0
+bone bone vertex
+1.0 material 1.0 texture texture
+0.500000
+=
+frame anim bone =
+bone
+vertex = = -1
+0.500000 vertex = -1
+frame frame
+=
+bone material vertex =
+0.500000
+texture bone = vertex
+= bone anim 1.0 1.0
+bone
+bone
+= bone vertex frame
+0.500000
+material 1.0 material
+anim vertex texture vertex vertex bone
+=
+1.0 anim
+0.500000
+texture vertex texture
+vertex bone
+material 1.0 texture
+vertex 1.0
+bone
+-1 texture 1.0 anim 1.0 = anim
+0.500000 material anim bone material anim anim
+material = frame vertex
+bone
+vertex material frame 1.0 vertex
+bone -1
+material material
+=
+0.500000 = = texture 1.0
+0.500000 0.500000 vertex frame anim vertex bone = frame 1.0 material 1.0 vertex frame anim frame
+texture vertex texture texture texture -1 texture -1 0.500000 -1 anim frame 1.0 material
+0.500000 vertex 1.0
+material anim texture
+texture
+vertex anim frame 1.0 texture anim vertex
+= anim = frame
+material bone
+1.0 frame texture frame 1.0 vertex anim
+texture
+bone vertex frame -1 1.0 material 0.500000
+anim
+= bone 1.0 texture vertex =
+frame bone = -1 frame material
+anim 1.0
+bone
+-1 texture anim
+texture =
+-1 texture vertex frame frame vertex
+frame
+anim bone vertex 1.0
+material -1 1.0
+0.500000 anim bone -1 frame vertex texture
+texture anim texture 0.500000
+anim
+bone -1
+bone texture frame material
+texture
+frame bone material vertex -1
+bone
+anim bone
+= 1.0
+texture 1.0 material frame material
+anim anim bone frame bone
+1.0 vertex vertex 1.0
+0.500000 material 0.500000 bone anim frame = -1 0.500000 texture
+frame -1 anim material
+0.500000 texture
+bone bone 0.500000
+material bone vertex
+1.0 bone texture 0.500000 bone bone -1 1.0
+texture
+material = 1.0
+material anim
+frame texture material
+-1 frame
+vertex bone
+=
+frame = anim frame bone frame frame texture 1.0
+0.500000 frame = 0.500000 texture bone texture 1.0 1.0 bone frame 0.500000 anim = material -1 texture 1.0 -1 anim bone 0.500000 texture
+=
+texture vertex -1
+0.500000 0.500000 -1
+1.0
+bone
+vertex -1
+material
+vertex
+0.500000 texture vertex frame bone anim frame frame
+frame texture = 0.500000 anim frame 0.500000 vertex vertex
+frame 1.0 vertex texture
+0.500000 = 0.500000
+-1 -1 vertex texture
+1.0 1.0 bone =
+1.0 anim bone
+1.0
+1.0
+bone texture
+1.0 frame
+1.0 vertex frame -1
+0.500000 0.500000 texture = anim 1.0 =
+0.500000 bone texture 1.0 = 1.0
+bone material anim
+material texture
+frame bone = =
+0.500000 material -1 0.500000
+anim = 1.0 vertex material texture
+anim anim frame
+anim
+material
+frame frame = 1.0 0.500000 0.500000 1.0 material vertex vertex -1 bone -1 =
+anim = 1.0 1.0 bone 0.500000 bone
+= material
+-1 1.0
+vertex material -1 1.0 = vertex material 0.500000 -1 1.0 =
+0.500000
+vertex 1.0 vertex
+= texture texture 0.500000
+frame bone material material
+bone
+texture bone frame vertex
+anim 1.0 0.500000
+frame texture = 1.0 frame bone material
+material frame
+0.500000 = vertex -1 1.0
+bone material vertex
+anim texture -1 = anim vertex material -1
+texture anim -1 texture
+0.500000 1.0
+texture material 1.0 1.0 vertex
+texture
+frame texture 0.500000 0.500000 frame 0.500000 = frame texture
+0.500000 texture
+0.500000 bone 1.0 frame material -1 bone
+vertex
+0.500000 1.0
+= anim 0.500000 = -1
+-1 texture 0.500000
+anim anim
+1.0
+frame
+vertex vertex anim =
+1.0
+anim 0.500000 material 1.0 0.500000 = texture vertex texture -1 material = anim frame bone -1 -1
+bone = = bone
+anim 0.500000 vertex anim 0.500000 -1
+anim frame
+0.500000 1.0 0.500000 material texture
+texture
+frame 1.0 = texture anim anim frame
+frame vertex -1 = frame
+vertex 0.500000 1.0 = -1 0.500000 anim anim
+0.500000
+0.500000 0.500000 bone anim
+bone bone
+1.0 0.500000 -1 texture
+=
+anim anim anim 0.500000 1.0 texture 0.500000 0.500000 bone frame
+material material 1.0 0.500000 bone 0.500000
+0.500000 texture frame bone -1 vertex frame
+material
+bone texture frame bone 1.0 frame = bone material -1 bone frame = 1.0 0.500000 texture texture vertex
+vertex
+1.0 -1
+texture
+=
+anim = texture texture -1
+=
+texture bone bone 1.0 frame material
+0.500000 material
+frame frame anim anim
+-1 1.0 -1 frame vertex 0.500000 material texture
+0.500000
+0.500000 anim
+= bone = = 1.0 material = texture anim vertex
+bone anim
+anim frame material
+frame vertex texture frame
+frame frame vertex
+bone
+frame 1.0
+bone
+frame -1
+-1 0.500000 vertex
+texture -1 vertex = 1.0
+vertex
+anim bone vertex anim 0.500000 frame vertex vertex 0.500000
+-1 anim
+= bone
+anim -1 0.500000 vertex
+0.500000 anim 1.0 1.0 texture
+vertex = vertex vertex
+frame = -1 vertex 0.500000 anim -1 frame = bone anim -1 bone = anim -1 bone 1.0 frame material = vertex
+bone 1.0
+anim anim vertex 0.500000 1.0 vertex frame bone bone anim
+-1 frame material bone frame -1
+= material frame anim 1.0
+anim 1.0 1.0 =
+anim anim vertex vertex vertex frame anim texture
+texture anim vertex texture texture
+0.500000 = frame material frame material =
+= material =
+0.500000 1.0 frame 0.500000
+texture texture 1.0 anim anim
+anim
+material -1 0.500000 1.0 frame vertex vertex
\ No newline at end of file
@@ -0,0 +1,8 @@
+= frame 1.0 vertex 0.500000 vertex anim
+frame
+frame
+bone =
+= = bone vertex -1 material
+frame
+bone 0.500000
+anim frame 1.0 bone 
\ No newline at end of file
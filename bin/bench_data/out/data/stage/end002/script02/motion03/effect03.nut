@@ -0,0 +1,5 @@
+= =
+texture
+anim =
+0.500000 vertex -1 frame frame bone = bone texture texture
+1.0 0.500000 
\ No newline at end of file
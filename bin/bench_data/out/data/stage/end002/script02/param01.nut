@@ -0,0 +1,4 @@
+1.0 1.0 = 1.0 -1
+= anim -1 frame material =
+= 1.0
+1.0 -1
\ No newline at end of file
@@ -0,0 +1,5 @@
+-1 vertex anim anim
+texture -1 frame anim 0.500000 material anim frame texture
+vertex 0.500000 0.500000 -1
+frame -1 0.500000
+vertex anim material t
\ No newline at end of file
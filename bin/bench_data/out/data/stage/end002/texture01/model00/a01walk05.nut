@@ -0,0 +1,3 @@
+1.0 -1 anim
+vertex material material = anim material bone anim vertex 0.500000 frame bone frame 1.0
+anim frame bon
\ No newline at end of file
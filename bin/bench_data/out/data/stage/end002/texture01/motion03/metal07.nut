@@ -0,0 +1,15 @@
+material
+texture
+= bone 0.500000 anim -1 vertex anim texture bone -1
+frame -1 0.500000 frame
+texture
+1.0 texture
+material
+1.0 texture texture texture material material -1 = material anim texture
+vertex
+material 1.0 vertex frame bone texture
+frame material texture -1 vertex anim = bone = texture
+vertex bone
+vertex = bone = 0.500000
+0.500000 0.500000
+vertex texture bone = texture bone material = 
\ No newline at end of file
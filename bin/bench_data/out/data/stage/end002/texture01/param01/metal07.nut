@@ -0,0 +1,129 @@
+material material anim 0.500000
+1.0 bone -1 anim texture frame
+= 0.500000 frame 0.500000 frame texture
+material = texture bone material
+texture bone
+frame vertex texture 1.0 texture =
+-1 1.0 = frame 1.0
+bone
+vertex -1
+texture -1 = -1 = =
+frame -1
+=
+= frame
+=
+0.500000
+bone
+texture anim 0.500000 vertex
+texture
+vertex 0.500000 material texture
+vertex 1.0
+bone = texture anim
+frame 1.0
+frame
+= = 1.0
+vertex
+0.500000 bone texture 1.0 vertex 1.0 anim frame
+bone -1 frame -1 1.0 0.500000 =
+0.500000
+vertex vertex 0.500000 frame vertex = =
+material texture texture texture
+texture = = vertex bone anim anim -1
+anim bone
+0.500000 vertex -1 1.0
+anim 0.500000 frame -1 bone material
+anim bone material
+vertex material
+1.0 anim texture -1 bone material
+frame anim =
+1.0 1.0
+0.500000
+texture -1
+texture
+-1 bone
+-1 -1 0.500000 bone 0.500000 frame 1.0 = vertex anim
+bone 1.0 = frame
+material vertex texture
+vertex
+anim vertex vertex bone bone -1 texture
+=
+1.0
+= bone -1 bone -1
+-1 bone
+-1 material
+= frame anim material texture = bone
+=
+anim
+-1 = bone vertex texture
+texture -1 0.500000 vertex anim =
+= material 1.0 0.500000 1.0 texture 1.0 bone
+bone material material 1.0 material anim bone frame 1.0 =
+texture
+anim material material anim vertex -1 material -1
+-1 material 0.500000 = -1 bone vertex bone anim texture vertex frame 1.0 =
+-1 0.500000 0.500000 bone 0.500000
+vertex
+1.0
+0.500000 material = 1.0
+anim anim
+= texture anim material 0.500000 texture bone =
+-1
+vertex frame
+material
+frame texture bone bone bone
+vertex 1.0
+bone -1
+0.500000 bone
+vertex bone
+material 1.0 1.0 0.500000
+0.500000 frame texture = 0.500000
+texture = texture 0.500000 frame 1.0 material
+bone bone vertex
+texture frame 0.500000 anim -1 bone vertex vertex frame = 1.0
+material
+frame
+vertex texture vertex material bone frame anim
+vertex
+material vertex
+1.0 vertex material 0.500000 =
+vertex frame 0.500000 -1 vertex
+texture 1.0 material material
+vertex
+= bone vertex texture 1.0 bone = -1 bone 0.500000
+anim bone 1.0
+bone
+-1 0.500000
+material 0.500000
+1.0 vertex vertex anim -1 anim anim 1.0
+1.0 texture = vertex = texture anim vertex vertex
+bone anim -1
+frame anim frame bone
+= frame texture texture -1 bone 1.0 frame -1
+-1 vertex anim 1.0 anim vertex
+-1
+bone
+-1 1.0 anim
+anim material material
+texture vertex
+0.500000 0.500000 vertex 1.0
+=
+bone frame bone vertex =
+= material frame vertex
+bone
+= vertex
+anim 1.0 =
+bone = 1.0 1.0 material
+bone -1
+material bone 1.0 = bone
+bone bone
+1.0
+frame frame bone 1.0 vertex anim texture = vertex 1.0 0.500000 anim
+anim
+0.500000 1.0 material 0.500000 1.0 material
+material anim anim anim 1.0 material material
+= 0.500000 frame anim
+frame -1 1.0 1.0 texture 0.500000 1.0 material = texture frame 0.500000 -1
+0.500000 material
+0.500000
+-1 0.500000 -1 material material -1 1.0
+anim
\ No newline at end of file
@@ -0,0 +1,229 @@
+= -1 0.500000 texture -1
+= 0.500000
+= frame material
+0.500000 bone anim 0.500000 material vertex -1 material
+frame bone material
+material
+1.0
+-1
+vertex
+vertex anim bone frame
+=
+1.0 material vertex bone material vertex material
+material texture texture vertex
+anim material
+material
+bone
+frame
+0.500000 bone 1.0 1.0 bone vertex
+texture
+frame texture material
+texture texture
+texture
+texture = material
+material 0.500000 texture material 0.500000 bone
+frame texture vertex anim anim
+-1 anim 1.0 = 0.500000 bone
+0.500000 bone bone
+1.0 anim material =
+=
+texture -1
+bone vertex
+anim texture
+anim
+0.500000 -1 frame -1
+anim -1
+material -1
+bone texture
+material anim -1 texture bone 0.500000
+0.500000 1.0 = texture
+frame
+1.0 = material 1.0
+anim vertex anim =
+texture texture material texture frame anim
+vertex = bone
+material frame texture 1.0 frame 1.0 frame 0.500000
+1.0
+0.500000
+=
+texture
+1.0 bone texture anim 1.0 material
+bone frame vertex
+= =
+anim material 1.0 bone
+anim = 0.500000 bone =
+-1 material material
+material
+material -1 vertex 0.500000
+anim vertex 0.500000 texture
+frame
+bone bone vertex bone vertex bone vertex texture -1 = = material vertex texture material material material -1
+material -1 -1 bone 1.0
+1.0 material texture 0.500000 texture
+vertex 0.500000 0.500000 = frame
+1.0 vertex
+texture 0.500000 vertex 1.0 bone material
+bone vertex 0.500000 anim = material 1.0
+0.500000 material = frame bone 0.500000 anim bone anim vertex 1.0 -1
+frame bone vertex -1 1.0 vertex
+vertex
+-1 0.500000 =
+anim = texture frame
+= frame 0.500000
+anim anim texture
+1.0 -1 =
+bone = bone
+frame bone -1 0.500000 anim anim texture anim texture = material vertex anim = frame
+0.500000 0.500000 -1 0.500000 bone -1 frame -1 anim vertex texture 1.0 1.0
+anim material anim material vertex bone -1 0.500000 frame = -1 vertex bone vertex bone texture 0.500000 bone 0.500000
+bone
+0.500000
+= 1.0 frame material anim = texture material vertex frame bone bone texture material
+bone vertex 0.500000 bone 1.0 material
+bone 1.0 0.500000
+vertex texture 1.0 vertex bone -1 0.500000 anim 0.500000
+material material
+texture -1 texture frame bone
+= material vertex
+vertex 1.0 bone 1.0
+material anim material texture
+bone
+bone bone bone anim
+material bone =
+-1 texture anim anim bone
+bone 0.500000
+-1 1.0 texture 1.0
+1.0 material
+-1 -1 texture 1.0 material 1.0 -1 bone -1 bone
+anim -1 bone 0.500000 frame
+anim -1 1.0 0.500000 = texture bone texture
+= vertex
+-1
+-1
+anim frame anim 0.500000 -1 anim bone 1.0 anim = anim 1.0
+0.500000
+anim bone frame 1.0
+frame frame
+-1
+1.0
+bone 0.500000 frame =
+bone
+1.0 0.500000 material -1 0.500000
+0.500000 vertex bone =
+material 1.0 frame =
+0.500000 0.500000
+texture -1
+anim =
+vertex bone 0.500000
+-1
+texture 0.500000
+=
+bone texture
+texture texture 0.500000 bone anim vertex 0.500000 anim 1.0
+-1 vertex anim bone
+bone vertex
+-1
+0.500000 -1
+-1 = 1.0
+= anim -1 material
+bone
+= -1 frame -1
+frame texture 1.0
+1.0
+material
+vertex
+1.0
+-1 anim vertex 1.0 anim frame bone frame
+frame -1 bone 0.500000 material material bone material 1.0 vertex bone 1.0
+vertex
+1.0
+bone anim
+frame = 0.500000
+texture
+0.500000 bone vertex = material -1 -1 vertex
+0.500000 1.0 bone
+texture
+frame 1.0 vertex
+0.500000 =
+material 0.500000 0.500000 texture anim -1 anim -1 material anim bone
+material
+-1
+texture
+-1 material
+= bone material bone = frame anim -1 material anim 1.0 0.500000
+= 1.0 0.500000 vertex texture 0.500000 material anim material = anim texture vertex bone texture texture
+1.0 = = frame =
+anim
+frame
+-1
+1.0
+vertex anim 0.500000
+= -1 bone = frame = -1 0.500000 frame anim -1 texture frame
+frame frame -1 material 1.0 anim
+texture 0.500000 bone
+-1
+0.500000
+vertex = -1 =
+1.0 -1 anim =
+bone anim
+=
+frame
+frame vertex
+-1 = 1.0
+texture 1.0 0.500000 vertex 0.500000
+1.0 1.0 frame frame anim =
+-1 material texture 1.0 = frame 1.0 1.0 0.500000
+anim
+frame anim frame
+-1 material 1.0 anim -1 texture
+anim 0.500000 bone anim texture
+frame vertex = 0.500000 anim
+1.0 frame texture vertex 0.500000 frame
+anim
+-1
+-1 = 0.500000
+material vertex frame
+bone texture texture 0.500000 = -1 texture 1.0
+texture
+-1 bone
+bone =
+anim material 0.500000 material -1 texture 1.0 -1 material = -1 bone 0.500000 0.500000 frame
+0.500000 frame =
+-1 bone texture frame vertex texture vertex = 1.0 vertex
+1.0 vertex frame texture -1 material material
+vertex bone 1.0
+anim anim -1
+anim
+-1 material material vertex vertex 1.0
+anim -1 material
+=
+-1 frame -1
+vertex -1 =
+bone texture = anim material frame =
+bone bone
+material bone frame -1 material =
+=
+bone
+0.500000 frame texture =
+vertex -1 -1 bone texture bone 0.500000 texture
+0.500000
+texture
+anim
+vertex
+vertex 0.500000 0.500000 -1 material texture frame anim
+anim = 0.500000 texture -1 0.500000 bone 0.500000 texture
+vertex = 1.0 -1
+anim 0.500000
+bone
+bone = = -1 texture material bone anim -1 anim 0.500000 bone bone
+frame
+frame frame 1.0 frame anim 1.0 bone texture texture = bone =
+= = 0.500000 -1 material anim material anim 1.0 texture 0.500000 vertex 1.0 0.500000
+texture texture -1 material = 1.0 1.0 frame
+texture anim
+0.500000 vertex
+0.500000 0.500000
+anim -1 -1 0.500000 texture 1.0 -1
+bone frame 0.500000 frame vertex frame = 1.0 -1 material
+vertex frame 0.500000
+frame anim te
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone vertex
+-1
+vertex frame frame vertex anim v
\ No newline at end of file
@@ -0,0 +1,57 @@
+texture
+material
+bone vertex anim
+anim
+-1 -1 = vertex texture texture bone 1.0
+texture
+anim texture 0.500000 frame
+= material
+anim 0.500000 material bone anim
+= bone anim material
+-1 1.0 1.0 0.500000 vertex vertex frame bone = texture 1.0 0.500000 texture 0.500000 0.500000 anim 0.500000 -1 0.500000 -1 frame -1 -1 =
+frame
+-1 = bone
+vertex -1 material 0.500000 frame -1 -1 = vertex 1.0
+texture
+1.0
+anim
+texture = material anim frame
+vertex
+1.0 anim frame 1.0 bone vertex texture
+0.500000
+= -1 bone vertex material
+= 0.500000 =
+vertex 1.0 = 1.0 = bone 0.500000 texture 0.500000 frame anim 0.500000 bone material texture
+bone
+vertex anim
+0.500000 material 1.0 texture vertex material
+bone vertex = bone
+0.500000 bone
+-1 material anim material
+1.0 anim =
+1.0 -1 vertex texture -1
+1.0 0.500000 bone vertex anim 0.500000 texture
+frame -1
+material frame 1.0 anim vertex
+material vertex
+anim
+0.500000 anim
+vertex = texture
+texture bone texture material
+anim anim 0.500000
+frame frame -1 material
+texture 0.500000
+0.500000 anim 1.0 bone
+material = bone
+-1 texture vertex frame 1.0 = -1 material frame texture texture material material
+bone 1.0 vertex material 1.0 bone -1 0.500000 1.0 vertex anim frame
+frame frame vertex
+-1 frame vertex
+texture material
+vertex
+anim =
+anim 1.0 material frame bone 0.500000
+-1 vertex frame anim anim frame anim
+1.0
+anim
+bo
\ No newline at end of file
@@ -0,0 +1,4 @@
+vertex = -1 material anim = bone 0.500000 -1 texture
+0.500000
+material frame
+1.0 textur
\ No newline at end of file
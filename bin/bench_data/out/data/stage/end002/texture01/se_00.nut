@@ -0,0 +1,21 @@
+anim
+material
+0.500000 material
+vertex
+-1 1.0
+0.500000 0.500000
+vertex
+bone
+bone 0.500000 bone material anim
+texture bone texture bone frame vertex vertex
+1.0 bone texture 1.0 texture frame -1 = 0.500000
+1.0
+texture material
+vertex bone bone material texture 1.0
+frame -1
+vertex texture =
+material material anim frame bone 1.0 -1 1.0
+vertex texture material
+-1 material bone 0.500000 bone material 1.0
+= = material
+= material anim anim bon
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame
+bone anim
+frame bone frame bone
+= anim
+1.0 texture -
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000 material material
+= anim
\ No newline at end of file
@@ -0,0 +1,20 @@
+texture 0.500000 = 1.0
+texture vertex
+texture vertex -1 bone
+vertex = vertex texture
+anim texture material -1 anim -1 1.0 vertex texture
+bone anim bone vertex
+frame
+bone texture
+vertex texture 0.500000 0.500000
+-1 material anim bone material anim bone anim vertex
+-1 texture 0.500000 0.500000 frame frame frame
+texture = = texture bone -1 vertex
+frame vertex
+frame
+0.500000
+vertex frame =
+anim vertex 0.500000 bone
+-1 1.0 material
+texture texture -1
+= -1 -1 anim texture = 0.500000 -1 bone mater
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame material = anim
+-1 = bone = frame anim 1.0 -1 texture
+1.0 anim bone -1
+frame frame = material
+bone frame 
\ No newline at end of file
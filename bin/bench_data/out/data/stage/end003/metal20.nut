@@ -0,0 +1,22 @@
+-1 material frame frame material 1.0 0.500000
+0.500000 material 1.0
+material =
+-1 vertex = bone -1 frame material texture material
+-1 material
+frame = texture
+-1 -1 frame
+texture
+bone 0.500000 anim 0.500000 texture = anim frame texture bone 0.500000 0.500000
+texture
+-1 -1 material
+anim bone -1 =
+=
+vertex texture texture anim =
+-1 = 0.500000 bone 1.0 texture frame
+texture 1.0 texture -1 frame = 0.500000 anim =
+1.0
+=
+bone vertex material material
+1.0
+-1
+fra
\ No newline at end of file
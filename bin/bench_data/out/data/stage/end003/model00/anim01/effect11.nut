@@ -0,0 +1,89 @@
+0.500000 anim bone
+frame 0.500000 =
+-1 bone 1.0 texture 1.0
+bone
+material = anim frame 1.0 =
+=
+vertex frame
+bone anim
+texture texture anim -1 1.0 0.500000 bone material texture 1.0 -1 frame 1.0 vertex = anim =
+material texture vertex
+=
+= texture -1
+vertex texture bone
+-1 = 0.500000 = anim
+vertex 0.500000 frame anim frame
+material
+-1 = frame -1 0.500000 1.0
+0.500000 0.500000 vertex
+0.500000 material
+anim
+-1 1.0 -1 -1 texture
+= 1.0 0.500000 frame texture
+-1 = vertex -1 -1
+0.500000 vertex bone -1 anim material
+frame bone
+bone texture = texture bone 1.0 frame 1.0 0.500000 material bone vertex texture = -1 bone bone vertex
+frame
+texture 0.500000 texture
+1.0
+frame 0.500000 0.500000
+texture
+frame
+texture material texture
+vertex
+texture
+0.500000 = texture 0.500000
+material texture material texture vertex -1 anim bone
+0.500000
+vertex
+vertex texture vertex material 1.0 texture
+vertex frame bone -1 material
+material texture -1 0.500000 bone
+=
+=
+bone 0.500000
+vertex
+anim -1
+0.500000 anim texture vertex 0.500000 -1 vertex anim
+bone
+= vertex -1 anim
+material
+frame 0.500000
+material 0.500000 frame
+anim -1 -1 texture 0.500000
+texture
+frame vertex 1.0 vertex 1.0
+vertex texture vertex = frame 1.0
+material anim vertex material 0.500000
+1.0
+anim -1 0.500000
+vertex bone -1 material
+material frame texture
+1.0
+-1 frame
+vertex 0.500000 texture
+vertex frame frame 0.500000 vertex
+1.0 1.0
+texture 1.0 -1 anim vertex
+-1 anim -1 material
+material anim vertex 0.500000
+-1 material vertex material
+1.0 bone 1.0 0.500000 -1 vertex frame
+-1 anim 1.0 vertex texture
+1.0
+vertex anim anim vertex
+material vertex bone anim anim frame
+-1 1.0
+frame
+material vertex 0.500000 vertex bone
+frame 1.0 bone
+vertex -1
+frame 1.0 frame
+vertex 0.500000 bone bone
+texture
+0.500000
+frame
+1.0
+material vertex texture texture vertex
+bone texture ma
\ No newline at end of file
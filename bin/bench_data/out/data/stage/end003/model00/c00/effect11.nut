@@ -0,0 +1,42 @@
+-1 material = 1.0
+vertex 1.0 material = 1.0 material material
+material bone 1.0
+= 1.0 anim =
+material -1 1.0 anim frame
+anim texture
+1.0 frame =
+texture
+vertex 1.0 frame 0.500000 bone bone
+texture
+texture
+anim 1.0 vertex 1.0 vertex
+texture -1 material material anim = bone
+0.500000
+vertex
+-1 vertex
+0.500000 =
+material 1.0 bone anim
+material 1.0
+frame
+-1 vertex frame texture
+0.500000 0.500000 material frame material bone frame -1 vertex frame
+anim anim 0.500000
+-1
+vertex bone
+1.0
+vertex -1 texture frame
+0.500000 vertex vertex texture = = vertex anim anim texture
+texture bone = anim -1 bone vertex -1
+-1 0.500000 bone bone frame
+1.0 0.500000 texture bone
+frame
+frame
+frame
+1.0 vertex
+=
+texture
+vertex 1.0 texture anim texture
+texture
+1.0 = 0.500000 frame 1.0 -1 vertex =
+0.500000
+1.0 bone = material bone text
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture material material
+texture material
+-1 = anim bone
+vertex -1 bone = frame 0.500000 bone -1 -1
+bone bone
+anim anim vertex = frame 0.500000 0.500000 vertex
+anim material bone mater
\ No newline at end of file
@@ -0,0 +1,2 @@
+frame
+vertex frame 1.0 frame vertex a
\ No newline at end of file
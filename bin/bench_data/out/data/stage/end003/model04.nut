@@ -0,0 +1,6 @@
+-1
+anim bone frame
+anim -1 anim
+bone = = = material
+material vertex material
+bone texture anim 
\ No newline at end of file
@@ -0,0 +1 @@
+SfʯedЁzG1id'lMl,ӼB
\ No newline at end of file
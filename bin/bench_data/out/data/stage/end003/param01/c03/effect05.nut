@@ -0,0 +1,11 @@
+0.500000 anim texture 0.500000 vertex vertex material vertex
+bone anim bone material
+-1 texture material 0.500000 material
+bone bone frame 1.0 anim texture = 0.500000 material
+material
+vertex anim =
+0.500000 anim 0.500000 bone 0.500000 texture = bone frame =
+1.0 = material frame anim
+anim -1 material 0.500000 frame = material 0.500000 material material
+bone 0.500000
+vertex texture frame = 
\ No newline at end of file
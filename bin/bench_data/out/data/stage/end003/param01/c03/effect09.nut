@@ -0,0 +1,85 @@
+0.500000 frame bone
+1.0 frame vertex 1.0 texture = texture
+vertex bone
+material -1
+anim 0.500000 = anim
+frame anim frame
+anim 0.500000
+1.0
+bone texture
+frame = 0.500000 vertex
+= bone -1 1.0 vertex vertex
+-1
+anim -1 texture
+material 1.0
+vertex vertex
+1.0 = anim vertex
+frame 1.0 texture bone frame frame
+-1 -1 material
+bone
+material
+vertex
+texture
+bone texture
+vertex texture =
+material vertex 0.500000 frame -1
+= 0.500000 vertex = anim
+-1 -1 bone
+bone texture 0.500000 1.0 frame material vertex anim material material frame vertex
+material bone 1.0 texture bone texture -1 anim
+bone
+vertex texture material
+= frame 1.0 -1 texture 1.0
+-1 material
+vertex -1 1.0 material bone
+=
+vertex texture vertex
+= = material 1.0 -1
+vertex 1.0 anim texture material bone -1
+vertex 0.500000 -1 vertex vertex
+0.500000 1.0 frame 1.0 -1 vertex vertex bone = texture 0.500000 frame material frame -1
+-1
+texture
+=
+material bone
+1.0
+=
+0.500000
+=
+0.500000 anim 0.500000
+texture vertex 1.0 = bone = bone texture
+1.0
+bone 1.0
+1.0 =
+= 1.0 vertex bone frame
+texture vertex 0.500000 bone material
+frame 1.0 frame 0.500000 0.500000 anim material
+1.0 material anim 1.0 0.500000 bone material
+material
+anim = 0.500000
+0.500000 vertex bone texture = material
+-1 1.0
+-1 0.500000 -1 vertex frame -1 1.0 texture bone 0.500000 0.500000 anim
+= 1.0 vertex frame bone frame = material frame material vertex
+bone -1 frame
+1.0
+0.500000 texture
+material vertex frame bone anim material = anim
+=
+vertex
+-1
+frame = material 0.500000 1.0 -1 1.0
+texture
+bone 0.500000 texture -1 1.0 =
+frame = frame -1
+vertex texture vertex 1.0 1.0
+vertex 0.500000
+material bone
+bone bone frame vertex frame
+-1
+= -1 0.500000
+anim 1.0 vertex 1.0 texture
+texture 0.500000 material 0.500000 texture -1 -1
+frame = material
+material vertex
+frame texture material a
\ No newline at end of file
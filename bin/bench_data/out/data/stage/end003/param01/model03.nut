@@ -0,0 +1,44 @@
+anim vertex -1 1.0 material 0.500000 material frame
+1.0 vertex 1.0
+-1 vertex bone -1 material 0.500000
+1.0 bone 0.500000
+bone bone texture 1.0 vertex -1
+bone
+-1 1.0
+frame
+1.0 bone
+= texture
+frame bone 1.0 -1
+texture
+1.0 = vertex
+anim vertex
+texture 0.500000 = anim
+anim
+frame
+material material bone texture frame material bone
+vertex = bone material = 1.0 texture -1 texture 1.0 material bone = anim texture 0.500000 texture bone -1
+vertex
+material texture bone vertex
+vertex 1.0
+-1 1.0 1.0 -1 1.0 = vertex material vertex
+bone
+= -1 texture 0.500000 bone -1 = -1
+= texture 0.500000 =
+0.500000
+1.0 material anim -1 frame
+texture frame anim vertex material vertex frame
+anim 0.500000 1.0
+frame texture texture
+1.0
+frame bone vertex vertex = 1.0 0.500000 texture 1.0 anim 1.0 bone -1
+texture vertex
+-1 -1 -1 0.500000 texture bone =
+-1
+frame vertex -1 bone
+1.0 material frame anim anim 1.0 texture = =
+1.0
+bone anim vertex vertex
+texture = anim material 0.500000
+texture =
+bone
+= frame vertex vertex -1 bone 
\ No newline at end of file
@@ -0,0 +1,5 @@
+-1 bone
+0.500000
+vertex
+bone 1.0 anim
+anim bone material material 0
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim
+vertex 0.500000 anim =
+-1 anim 1.0 -1 
\ No newline at end of file
@@ -0,0 +1,36 @@
+bone 1.0
+material -1
+anim
+material vertex
+vertex 1.0 0.500000 0.500000
+=
+0.500000 1.0 0.500000 0.500000 vertex
+-1 frame -1 = frame 1.0 bone -1 anim
+anim bone material bone anim anim
+material = bone -1 vertex -1 anim texture =
+material 1.0 texture
+-1 material = 1.0 vertex
+frame = = anim 1.0 0.500000 texture
+0.500000 anim bone
+material vertex
+texture
+material texture = vertex =
+1.0 texture
+=
+texture
+bone material material
+anim
+vertex anim
+1.0
+bone -1 bone = anim
+anim frame 0.500000
+-1 bone material
+= material
+texture = material 1.0
+frame vertex
+0.500000 material
+material 1.0 vertex texture 1.0 0.500000 -1 texture
+-1 anim material vertex
+0.500000 bone anim
+anim 1.0 -1 0.500000 material
+anim tex
\ No newline at end of file
@@ -0,0 +1,45 @@
+material frame
+vertex = frame material
+anim material texture anim 0.500000 bone vertex 0.500000 anim -1 1.0 vertex
+1.0 frame =
+anim material vertex
+anim
+vertex =
+vertex
+anim
+material = =
+-1
+anim = material bone
+anim -1 -1 bone texture bone anim 0.500000 0.500000 vertex texture vertex bone bone bone material = 0.500000 frame 0.500000
+material
+-1 material vertex
+material
+1.0
+bone frame
+= frame material material texture
+frame 1.0 -1 anim
+vertex texture 0.500000 vertex 1.0 0.500000 0.500000 anim anim
+vertex bone
+1.0
+material anim
+= anim -1 material 0.500000 anim
+anim frame =
+frame anim vertex
+1.0 bone -1
+texture bone
+vertex 0.500000 = bone vertex bone texture bone
+anim vertex
+material
+material
+anim frame
+anim 1.0 anim material vertex
+texture bone
+1.0 0.500000 frame bone
+= material
+anim material anim material anim 0.500000
+bone =
+= vertex anim
+bone -1
+frame bone
+anim texture -1
+material 
\ No newline at end of file
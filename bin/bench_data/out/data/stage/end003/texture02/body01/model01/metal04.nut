@@ -0,0 +1,70 @@
+0.500000 0.500000 1.0
+anim = =
+bone
+= = frame
+1.0 frame vertex
+0.500000
+anim = texture
+= anim bone
+0.500000 = = bone texture material
+-1
+frame anim
+texture bone vertex material anim =
+anim texture 0.500000 anim anim 0.500000 = 1.0
+1.0
+texture 0.500000 anim 1.0 bone frame frame
+frame material material material vertex
+1.0 vertex material
+vertex = material
+= bone texture
+material frame material
+=
+0.500000 vertex vertex vertex bone 0.500000 anim material
+vertex 1.0 -1 -1 1.0
+vertex 0.500000 0.500000
+1.0 vertex material vertex 0.500000 vertex material
+-1 frame
+= = -1 texture 1.0 anim = 1.0
+-1 0.500000 0.500000 frame bone vertex
+bone vertex = material 0.500000
+anim
+= 1.0
+= vertex
+texture anim
+1.0 texture texture
+texture -1 bone -1 texture vertex anim
+vertex = texture
+-1
+material -1 frame
+1.0 frame 0.500000 -1
+0.500000
+anim
+anim frame frame
+frame
+= = = 1.0 anim anim -1 anim 0.500000 bone
+1.0
+0.500000 = -1 frame texture -1 1.0 frame
+anim
+anim texture
+0.500000 anim = bone material bone 0.500000 -1 vertex 0.500000 -1 -1 -1 vertex material material 0.500000
+frame frame
+vertex vertex 1.0 anim
+1.0 = anim = texture texture
+-1 anim vertex
+-1 texture
+anim anim -1 texture anim material 0.500000 vertex = vertex
+anim bone texture
+1.0 1.0
+1.0 frame vertex anim bone texture 0.500000 material anim 1.0 1.0 texture
+-1
+texture 1.0 texture anim -1
+= material material vertex
+= frame -1 frame
+frame bone
+bone anim = -1 bone -1 1.0 vertex frame
+texture material frame
+frame -1 frame 0.500000 bone material
+frame bone = vertex material
+0.500000 texture
+vertex -1 = anim 0.500000 bone 1.0 bone bone 1.0 bone -1 = = 0.500000
+anim anim frame -1 bone texture anim bone
\ No newline at end of file
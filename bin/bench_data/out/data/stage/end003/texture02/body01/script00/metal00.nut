@@ -0,0 +1 @@
+-1 texture material anim material material 1.
\ No newline at end of file
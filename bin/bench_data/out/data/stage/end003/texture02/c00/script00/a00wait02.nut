@@ -0,0 +1,120 @@
+bone
+=
+anim 1.0 frame anim -1 -1 0.500000 vertex 1.0 material
+0.500000 texture =
+material =
+anim
+-1
+bone
+1.0 0.500000 bone = 0.500000 1.0 vertex
+bone bone
+texture frame
+anim bone -1 bone 0.500000 0.500000 0.500000 bone 0.500000
+vertex frame frame = material
+-1 1.0 anim
+vertex = 1.0 -1
+material
+texture
+1.0 material 0.500000 =
+vertex = anim 1.0
+frame anim frame
+=
+= 1.0 anim texture 1.0
+frame texture 1.0 anim 0.500000 frame bone bone frame material bone bone anim
+frame bone
+anim texture 1.0 = 1.0 1.0 texture frame
+frame 1.0 bone
+bone anim
+bone vertex
+0.500000 -1
+=
+anim -1 texture bone frame = bone
+0.500000 bone
+frame anim anim
+1.0 frame
+anim texture vertex 1.0 -1 bone
+1.0 1.0
+bone -1 frame 1.0 anim frame -1
+material vertex
+= -1 frame texture
+texture
+= frame texture 1.0 texture material 1.0 material anim 1.0 anim
+frame 1.0 frame frame = anim texture anim
+-1
+= = frame vertex 1.0 frame -1 bone material
+anim = material texture 0.500000 1.0 frame vertex
+vertex -1
+= = 0.500000 bone
+0.500000
+texture -1 texture frame bone texture
+=
+frame vertex frame anim
+frame
+0.500000 1.0 = 0.500000
+material texture 0.500000
+frame
+0.500000
+vertex
+material 0.500000 = bone 1.0 1.0
+vertex material vertex texture texture
+-1
+-1
+0.500000 anim -1 bone
+bone texture material -1 vertex -1 0.500000 anim material texture texture
+vertex material = material
+= -1
+anim material frame vertex 0.500000
+=
+anim frame frame material
+bone
+bone texture = bone
+bone bone anim 0.500000
+-1 -1
+texture
+material anim bone -1
+vertex texture
+= bone texture anim anim frame texture bone = material
+texture texture material vertex 1.0 frame
+= texture material
+material 1.0 -1 -1
+1.0
+= 0.500000 anim material texture material
+0.500000
+frame
+0.500000
+1.0 frame vertex material
+frame texture = texture
+1.0 material
+= anim
+anim frame
+frame -1
+0.500000 anim 1.0 anim texture anim
+texture
+bone material
+texture = anim bone frame
+material frame
+anim = vertex bone = texture = =
+-1 vertex -1 texture = vertex anim vertex
+0.500000 anim
+0.500000 texture = bone material anim
+bone vertex
+material 0.500000
+anim anim anim bone anim 0.500000 -1 1.0 vertex
+vertex vertex
+0.500000
+frame vertex frame material anim
+material
+-1 vertex frame = 1.0 -1 -1 texture
+material bone texture
+anim frame
+vertex
+anim material 0.500000
+1.0
+vertex
+vertex vertex anim 1.0 frame texture
+vertex material bone frame
+0.500000 bone material vertex bone = bone 0.500000 1.0 -1 anim anim bone frame -1
+material frame texture material anim -1 frame = bone 1.0
+vertex texture 0.500000
+1.0
+texture 0.500000 1.0 vert
\ No newline at end of file
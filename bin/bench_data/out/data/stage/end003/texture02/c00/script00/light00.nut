@@ -0,0 +1,168 @@
+vertex vertex 0.500000 0.500000 frame = anim frame anim
+material texture
+material
+bone
+= material 0.500000 0.500000 -1 0.500000 vertex material =
+anim
+= bone
+texture = vertex =
+bone = -1 0.500000
+texture 0.500000
+= material
+vertex
+frame vertex -1 texture
+0.500000
+anim =
+material frame
+= =
+texture
+texture 1.0 material
+texture vertex
+bone
+frame frame 0.500000 1.0 1.0 = vertex texture anim anim 0.500000 frame
+frame = bone 0.500000 vertex
+=
+1.0 texture
+-1
+frame -1 texture texture bone = anim vertex -1 material 0.500000 bone 1.0
+material
+1.0 bone
+bone
+0.500000
+frame material
+1.0 vertex -1 frame anim 1.0 0.500000 anim
+texture
+anim
+=
+= anim 1.0 vertex 0.500000 material
+bone
+frame
+-1 anim texture frame
+1.0 material material texture material
+texture
+1.0 bone texture vertex anim material vertex = vertex
+vertex frame 0.500000 bone = 0.500000 -1 frame -1 anim anim 0.500000
+texture bone -1
+texture -1 material
+-1 anim 0.500000 1.0
+texture vertex -1
+bone texture frame 0.500000 0.500000
+= frame
+frame anim 1.0 -1 0.500000 1.0 vertex texture
+1.0 0.500000 frame bone
+0.500000
+texture
+frame
+= vertex -1
+0.500000
+-1 bone 0.500000
+bone frame frame
+vertex 0.500000 -1 frame = anim frame frame texture
+frame -1 vertex bone material anim
+-1
+material 0.500000
+anim anim anim material
+frame =
+vertex vertex material frame anim 0.500000 anim material texture texture
+-1 material bone 0.500000 1.0 texture frame
+=
+frame vertex
+-1 0.500000 material 0.500000 anim frame -1 frame vertex vertex vertex texture anim material anim bone 0.500000 = 0.500000 texture
+material material
+1.0 -1 0.500000
+= texture vertex anim texture 1.0 bone
+anim 0.500000
+anim -1 bone -1 = frame
+-1 texture anim material 1.0 anim = 0.500000 = vertex texture frame 1.0
+0.500000 1.0 vertex -1 frame
+material
+1.0 anim 1.0 frame =
+vertex 1.0 texture frame
+bone material texture anim -1 1.0 -1 bone -1 material = -1 bone anim
+1.0 material -1 -1 1.0 texture bone
+texture bone material anim bone = frame bone frame frame bone anim texture -1 anim vertex
+anim material -1
+bone anim anim 0.500000 vertex anim texture texture texture bone material vertex frame frame bone frame 1.0
+0.500000 1.0 material bone vertex
+frame
+material
+= 1.0 -1 = material = material = texture -1 texture texture
+texture 0.500000
+-1 texture
+1.0 material
+bone texture vertex
+material material frame = vertex 1.0 0.500000 bone
+= = bone = 0.500000
+material vertex = =
+=
+material
+texture frame 0.500000 bone 1.0 = anim -1
+bone texture
+1.0 texture material 1.0 -1 anim 1.0 frame material material = texture -1
+texture -1 bone
+0.500000 0.500000 material 1.0 0.500000 =
+-1
+=
+texture
+bone material
+anim
+frame material texture -1 bone frame
+1.0
+= vertex
+=
+material anim frame
+bone =
+anim bone
+vertex 1.0 material
+material texture 1.0 material texture material =
+frame texture vertex bone
+0.500000 1.0 1.0 anim -1 0.500000 material texture anim texture 1.0 = anim anim bone frame bone
+texture anim 1.0 material
+frame = 0.500000 0.500000 anim vertex
+1.0 -1 material
+anim
+vertex anim 1.0 texture frame material material bone texture -1
+frame anim 1.0 texture texture
+anim material bone texture
+texture
+1.0
+= = material vertex texture frame 0.500000 anim
+1.0 texture texture
+frame 1.0 0.500000
+anim
+vertex material vertex
+bone
+material material bone 1.0 = texture -1 1.0 -1 = anim
+material frame anim =
+bone
+= texture texture 0.500000 anim 0.500000 anim frame
+1.0 -1
+vertex 1.0
+= anim
+1.0 texture
+1.0 material -1
+=
+0.500000 frame bone vertex 0.500000 bone bone anim -1 0.500000 frame -1 bone anim
+0.500000 vertex texture -1 -1 frame -1 frame
+0.500000 texture
+0.500000 1.0 material bone = -1 =
+bone
+frame texture 1.0 = texture -1 anim vertex frame
+= frame bone material -1 bone 0.500000 anim 0.500000 -1 frame 1.0 1.0 texture frame
+= material material frame
+anim anim
+1.0 frame bone = anim texture 0.500000 0.500000 = anim 0.500000 anim 0.500000 material frame bone 1.0 -1
+bone material texture
+material =
+anim -1 0.500000 texture
+-1
+anim
+frame -1 texture material 0.500000 material
+anim frame
+frame -1
+vertex vertex
+bone 0.500000 0.500000
+bone anim anim vertex frame material -1 anim 1.0 = = texture anim material texture frame -1 0.500000
+-1 vertex vertex vertex
+texture
+-1 1.0
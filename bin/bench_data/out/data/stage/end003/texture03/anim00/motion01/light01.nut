@@ -0,0 +1,5 @@
+=
+frame
+-1 -1 frame texture
+texture
+bone texture 0
\ No newline at end of file
@@ -0,0 +1,11 @@
+1.0 anim -1 -1 bone anim
+material 1.0 bone texture
+bone = vertex bone = texture
+anim vertex 0.500000 = vertex 1.0
+frame
+texture =
+= 0.500000 anim
+frame
+frame
+frame frame 1.0 anim vertex
+material = ani
\ No newline at end of file
@@ -0,0 +1,87 @@
+vertex -1 anim
+-1 texture
+anim
+1.0 texture
+material bone anim material frame material material anim 0.500000
+= vertex -1 vertex = anim -1
+material frame bone
+0.500000 1.0 0.500000 frame texture
+= 1.0
+vertex material = -1 vertex material bone
+bone frame
+frame
+0.500000 -1 material -1 texture anim
+frame vertex texture
+vertex = material
+frame frame
+frame
+-1 bone 1.0 =
+material -1 anim = 0.500000 -1 bone frame frame
+0.500000 -1 bone = 0.500000 frame material -1 texture =
+texture 1.0
+1.0 1.0 texture 0.500000
+anim = anim anim material material
+anim bone anim -1 =
+frame
+bone 0.500000 vertex vertex -1 frame =
+vertex material bone 0.500000 vertex -1
+anim
+bone = frame texture material 0.500000 anim frame anim
+anim vertex = bone anim
+bone
+vertex 0.500000 material texture vertex
+1.0 -1 material bone bone texture frame vertex 1.0 bone = texture
+1.0 0.500000 bone
+texture
+texture texture 0.500000 = texture
+bone -1 -1 anim frame 0.500000
+bone =
+= frame texture
+1.0
+-1 frame material material 1.0 vertex vertex 0.500000
+frame
+bone
+0.500000 -1 material 0.500000 vertex anim anim =
+frame 0.500000
+-1
+anim 1.0 anim material vertex vertex texture
+frame 1.0 1.0
+=
+texture
+= anim 1.0 = 0.500000 bone
+anim anim material
+vertex -1
+0.500000 anim bone
+-1 0.500000 1.0 vertex -1 bone bone vertex
+frame vertex vertex =
+texture
+frame vertex 0.500000
+material texture material material bone
+1.0
+bone anim
+bone bone material material bone -1 frame anim
+material anim 1.0 material 0.500000 bone material 0.500000 = 0.500000
+material anim vertex -1 = -1 -1 material material -1 vertex vertex -1 vertex frame bone texture
+1.0 frame
+anim -1
+anim anim 0.500000 texture 0.500000 bone
+anim
+0.500000 bone = -1 = 0.500000 frame 0.500000 bone vertex
+texture 0.500000 anim 0.500000 0.500000 bone =
+0.500000
+material = vertex bone
+anim
+frame vertex
+vertex bone frame
+-1
+frame
+anim texture
+= material bone material 1.0 material vertex
+bone =
+0.500000 0.500000 1.0 texture 0.500000 0.500000
+1.0 texture 1.0 frame frame material 1.0 vertex 0.500000 bone material frame =
+1.0 anim 1.0
+vertex anim -1
+frame material 1.0 1.0
+frame
+1.0 = anim texture 1.0 -1 1.0 1.0 bone
\ No newline at end of file
@@ -0,0 +1,44 @@
+bone vertex vertex =
+anim = 0.500000 = 0.500000 0.500000 = frame -1 1.0 anim anim anim 1.0
+bone 1.0 material frame 1.0 -1
+vertex vertex
+= frame material frame
+anim
+frame -1 0.500000 = material material -1 -1 anim material texture
+material material vertex material anim
+anim material texture
+material
+frame
+texture vertex
+vertex frame anim 0.500000 1.0 1.0
+texture
+material = vertex
+vertex 1.0 = anim
+anim material = vertex
+=
+1.0
+0.500000 0.500000 -1 anim bone frame material anim vertex -1
+-1 -1
+0.500000 = bone vertex frame bone frame
+texture vertex 1.0 frame vertex texture bone
+bone material texture 1.0
+0.500000 material anim texture
+-1 frame
+= -1
+frame texture 1.0
+frame texture 0.500000 -1 bone = -1 texture -1 =
+texture material
+anim anim = material bone texture bone vertex texture
+1.0 frame = -1 texture bone =
+frame material texture texture bone bone vertex anim texture 1.0 anim material material -1 material frame bone
+vertex
+1.0 -1 -1 frame
+frame texture = -1 0.500000
+frame 0.500000 anim -1 1.0 frame = vertex = vertex 0.500000 frame texture 1.0
+0.500000 texture
+frame bone vertex vertex bone
+texture anim 0.500000 0.500000 -1
+-1 texture 1.0
+frame vertex
+0.500000 material bone = material
+material 0.500000 vertex -1 -1 
\ No newline at end of file
@@ -0,0 +1,7 @@
+bone anim bone material anim material anim bone vertex material 0.500000
+material
+frame = vertex
+frame vertex bone anim texture frame
+1.0 anim 0.500000 = bone bone texture -1 -1 bone frame =
+vertex vertex 0.500000 bone frame
+frame -1 1.0 v
\ No newline at end of file
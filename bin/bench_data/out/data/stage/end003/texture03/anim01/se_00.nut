@@ -0,0 +1 @@
+texture bone 1.0 texture bone vertex frame
\ No newline at end of file
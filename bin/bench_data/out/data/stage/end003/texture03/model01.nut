@@ -0,0 +1,175 @@
+material
+-1
+bone vertex 0.500000 = material = vertex -1 1.0 -1 frame material bone 0.500000 0.500000 texture material material vertex
+frame 0.500000 = vertex
+= anim anim -1 frame 0.500000 vertex
+vertex =
+-1 -1 bone
+bone 0.500000 0.500000
+-1 frame 1.0 frame vertex 1.0 0.500000 0.500000
+texture bone 0.500000
+anim bone frame material -1 -1 vertex anim -1 =
+frame
+vertex vertex
+1.0 vertex
+frame 0.500000 vertex texture material = 0.500000
+material
+bone
+frame
+bone anim vertex vertex 0.500000 bone
+bone
+1.0 -1 0.500000 bone anim texture
+=
+anim anim
+vertex frame bone = vertex 0.500000
+-1 vertex anim = frame 1.0 frame texture bone vertex
+vertex -1 anim -1 0.500000 frame material frame vertex vertex texture bone texture 0.500000 1.0
+1.0 anim 1.0
+1.0 texture anim
+material vertex
+0.500000
+material = texture =
+1.0 = = vertex frame frame frame frame
+-1 anim material vertex 1.0 vertex =
+=
+anim texture
+texture
+frame material
+1.0
+frame anim bone -1
+vertex -1 -1 frame -1
+1.0 vertex material
+frame material 0.500000
+frame material = frame bone texture
+= bone = -1 0.500000 vertex
+0.500000 = anim
+0.500000 1.0
+anim 0.500000
+= texture anim 1.0
+bone bone = bone texture
+vertex -1
+texture 1.0
+=
+material -1 -1 vertex bone
+texture
+anim material -1 vertex material texture 0.500000 texture =
+anim
+-1 -1 1.0
+=
+vertex
+vertex
+= texture anim texture =
+1.0
+= 1.0 1.0 0.500000 anim bone vertex =
+-1 = texture -1 material anim -1 anim texture = 0.500000 1.0 bone 1.0
+vertex anim material bone material anim
+-1 -1 frame vertex
+bone material
+bone texture -1
+0.500000 texture bone 1.0 frame
+material bone
+bone anim material
+texture 0.500000
+anim
+frame 0.500000 texture 1.0 -1
+bone material bone 0.500000 vertex material bone 1.0 =
+frame bone 0.500000
+bone texture vertex
+bone
+-1
+material
+0.500000
+1.0
+-1 -1
+0.500000 0.500000 -1
+frame
+-1
+material bone bone
+-1 -1
+bone material = -1
+texture
+vertex
+0.500000 texture
+vertex texture bone =
+-1 anim frame -1 bone material vertex vertex texture -1 bone 1.0 texture = = vertex material
+1.0
+1.0 = 1.0 = bone = vertex
+frame
+-1 vertex
+anim
+bone frame bone bone 0.500000
+bone anim anim frame bone bone
+1.0
+material texture 1.0 frame frame anim texture anim material vertex 0.500000
+= anim vertex anim material
+material 1.0 bone
+material
+vertex
+texture
+texture -1
+material
+bone
+texture vertex vertex texture
+anim
+frame = 1.0 texture
+material anim material = texture = bone bone
+frame texture vertex
+0.500000 vertex
+0.500000 texture material 1.0 0.500000 material = vertex frame = 0.500000 1.0
+0.500000 vertex
+frame = anim =
+frame bone
+texture vertex material texture texture anim material
+-1
+0.500000 texture vertex 1.0 texture material material texture
+-1 0.500000
+0.500000 1.0
+material 0.500000 anim 1.0 0.500000
+vertex frame 1.0 frame 0.500000 anim
+= -1
+material anim -1
+1.0
+frame bone
+material
+vertex texture vertex
+anim material material frame 0.500000
+0.500000 anim bone
+anim 0.500000 =
+material material frame vertex
+anim anim
+frame texture bone texture material
+1.0
+bone
+texture -1
+bone 0.500000
+1.0 =
+vertex 0.500000 = 0.500000 -1 texture vertex 1.0 1.0 0.500000 = vertex bone 1.0 vertex material anim
+= = 0.500000
+1.0 0.500000 =
+vertex 0.500000 = bone -1 material
+0.500000
+bone = bone 0.500000
+anim = bone frame frame
+vertex 1.0 1.0 vertex 1.0 1.0 bone
+material
+1.0
+-1 frame frame 0.500000 anim -1 anim -1 anim
+1.0 frame material
+1.0 =
+material 1.0 1.0
+bone 1.0 texture material 0.500000 anim anim
+1.0
+1.0 anim
+-1 anim 0.500000 texture frame bone material 1.0 -1 = 1.0
+0.500000
+1.0
+vertex 1.0 frame
+frame -1 =
+0.500000 frame bone
+material anim
+0.500000 bone
+vertex frame bone vertex texture 1.0
+-1
+anim vertex
+texture texture 1.0 material frame 1.0 -1 material -1 texture
+frame anim
\ No newline at end of file
@@ -0,0 +1,102 @@
+-1
+material = texture
+bone
+anim 1.0 -1 bone 0.500000 material
+material vertex
+material = anim -1 frame bone 0.500000 texture
+0.500000 vertex bone texture 1.0
+frame
+bone 1.0
+material 1.0 anim vertex
+-1
+material frame texture vertex 1.0 bone -1 anim -1
+1.0 1.0 bone
+anim 1.0 bone
+1.0 -1
+vertex material material 0.500000
+0.500000 texture material texture material 1.0 texture = anim material texture 1.0 material 1.0
+anim vertex -1 -1 anim -1 =
+1.0 material texture texture frame material bone bone
+material bone bone material 1.0
+=
+bone vertex 0.500000 -1 frame
+frame
+anim 1.0 frame
+bone vertex texture bone 1.0 vertex
+bone -1 anim vertex anim texture texture texture
+frame bone vertex = vertex 1.0
+-1 0.500000 -1 -1 texture 0.500000 -1 0.500000
+frame frame anim bone 1.0 material -1 frame vertex
+material texture
+=
+bone 0.500000 material
+material -1 anim 1.0 = material
+=
+bone texture anim
+frame
+material frame anim texture
+anim -1
+texture
+-1 0.500000 material bone texture
+-1
+frame = texture vertex = texture anim material 1.0
+material -1
+= anim
+= frame frame vertex texture anim texture 1.0
+anim =
+vertex -1 0.500000 0.500000 1.0 -1 frame -1 texture 0.500000 material frame 1.0 material
+-1
+0.500000 material vertex
+= anim 0.500000 = -1
+1.0 texture = anim 0.500000 -1 -1
+texture -1 frame =
+0.500000 vertex texture = 0.500000 0.500000 1.0 anim 0.500000
+frame frame
+material 1.0 frame 0.500000
+texture bone bone texture = bone 1.0 texture
+vertex bone -1 0.500000 vertex frame = 0.500000
+bone texture 1.0 vertex
+anim vertex =
+-1 -1
+vertex 1.0 bone texture vertex anim
+1.0 material
+anim material
+-1
+bone anim bone frame -1
+bone 1.0 frame
+0.500000 texture frame
+= material 0.500000
+0.500000 texture vertex
+1.0 texture vertex vertex 1.0 anim vertex = bone texture anim frame
+bone frame 0.500000 material anim 1.0 =
+anim -1 frame material -1
+material
+0.500000 texture
+material = vertex
+vertex 1.0
+=
+vertex -1 0.500000 bone anim 1.0 =
+0.500000 frame texture texture material anim = anim
+vertex
+bone anim bone bone material
+-1 0.500000 1.0 texture
+frame
+= -1 material texture 0.500000
+material 1.0 material frame -1 texture anim 0.500000 vertex bone frame vertex -1 texture
+frame -1 material frame
+= frame
+0.500000 0.500000 0.500000 frame
+anim material
+1.0
+1.0
+= 0.500000 1.0
+= =
+1.0
+anim anim frame 1.0 0.500000
+0.500000 texture
+-1 anim material
+bone
+= material -1 -1 bone anim vertex 1.0
+frame
+vertex 1.0 vertex -1 =
+vertex texture materia
\ No newline at end of file
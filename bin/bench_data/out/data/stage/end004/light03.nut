@@ -0,0 +1,7 @@
+frame -1 0.500000 1.0 frame anim 1.0 vertex material
+material -1 material 1.0
+=
+vertex -1
+vertex
+vertex
+1.0 0.5
\ No newline at end of file
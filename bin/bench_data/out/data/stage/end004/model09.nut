@@ -0,0 +1,358 @@
+vertex
+texture vertex 1.0
+anim vertex 0.500000 material
+anim frame 1.0 -1 -1 material frame vertex
+1.0 anim
+bone 0.500000
+= anim frame texture
+0.500000
+anim = bone =
+texture
+texture material bone
+-1 bone bone 0.500000 material frame bone bone material
+anim anim texture =
+1.0 1.0 anim material = frame
+frame texture vertex vertex
+0.500000 anim
+vertex =
+=
+texture anim material texture bone 1.0 frame texture 1.0
+-1
+material bone
+material bone
+1.0
+1.0 material =
+texture 1.0
+0.500000 bone anim
+material
+-1 bone vertex
+material material
+1.0 frame anim 1.0 bone
+anim
+vertex
+frame 1.0 1.0 1.0 1.0 =
+texture texture material 0.500000 frame
+texture material -1 vertex 1.0
+frame vertex
+texture
+frame bone
+vertex anim bone anim
+bone 0.500000 bone texture material 1.0 0.500000 vertex 0.500000 vertex
+= anim material frame material
+vertex
+-1 anim = vertex texture material bone
+-1
+0.500000 0.500000
+0.500000 vertex frame bone material frame
+anim bone texture
+anim
+frame -1 bone 1.0 frame bone 1.0 =
+0.500000
+bone anim =
+-1 = vertex 1.0 = bone material vertex
+vertex vertex 0.500000
+frame frame 1.0 frame bone
+frame
+texture frame anim 0.500000 0.500000 = material frame 1.0 1.0 -1 frame
+0.500000 1.0 frame -1 anim =
+= bone texture 1.0 1.0 material frame texture frame vertex 1.0 frame 1.0
+texture texture
+material frame
+bone -1
+-1 material
+1.0 bone
+anim =
+texture -1 bone texture -1
+bone 1.0
+0.500000 anim frame
+texture vertex = frame
+= =
+1.0
+1.0 material
+= bone 0.500000 frame vertex -1
+vertex 1.0 vertex 0.500000 0.500000 texture
+material
+bone texture material
+frame vertex texture vertex frame
+material anim bone -1 frame
+vertex 1.0
+frame frame 0.500000 texture bone
+0.500000
+0.500000 1.0
+frame vertex frame -1 texture bone 1.0 frame frame material = material 1.0 texture texture
+0.500000
+vertex
+0.500000 anim -1 0.500000 bone 0.500000 bone 1.0 0.500000 frame bone -1 = frame vertex bone frame = 0.500000 material
+1.0
+frame 1.0 vertex -1 texture -1 vertex = -1 -1 texture vertex texture texture
+-1 = anim 1.0 bone
+texture
+anim frame
+vertex = material texture
+0.500000 texture -1 material -1 -1 texture =
+frame material -1
+anim
+1.0 0.500000 =
+vertex bone texture
+1.0 texture 0.500000 1.0
+material 0.500000 material 1.0 0.500000 material 1.0 bone texture material
+bone vertex vertex anim texture material bone
+vertex
+material
+texture
+vertex
+texture
+anim
+material frame vertex bone -1 -1 bone texture -1 frame 1.0 vertex 1.0 texture vertex -1 1.0 =
+texture
+bone frame frame anim anim bone -1 anim texture frame 1.0
+bone texture anim
+anim texture
+anim
+1.0 -1 material
+-1 =
+frame anim 0.500000 texture frame anim
+material frame = frame
+anim anim
+0.500000 bone = anim anim =
+vertex
+vertex vertex =
+material 0.500000 vertex vertex frame texture anim material -1
+frame frame 0.500000
+frame vertex anim texture = texture 0.500000
+-1 0.500000 frame -1 anim anim bone 0.500000 = texture
+anim 1.0 texture vertex
+frame 1.0 1.0
+0.500000
+material anim anim bone -1 0.500000 vertex anim -1
+anim material
+1.0 anim 1.0
+-1
+material vertex
+frame
+1.0 frame frame vertex material -1 frame 1.0 0.500000 frame 1.0 material 0.500000 = texture vertex anim
+texture anim anim anim anim frame bone vertex bone -1 0.500000 anim 1.0 1.0 material 1.0
+bone
+frame texture frame 0.500000 frame = 1.0 texture = = material frame = texture texture bone 0.500000 0.500000 frame material -1 vertex -1 texture material
+frame 0.500000
+texture anim = 1.0
+vertex
+-1
+frame
+texture 0.500000 -1
+bone material
+frame
+anim
+=
+= 0.500000 -1 frame 0.500000 1.0 = bone
+frame
+vertex 0.500000 vertex = -1 = texture texture texture texture texture anim -1
+material bone bone 0.500000 vertex material -1 anim
+vertex
+anim -1
+vertex =
+vertex anim vertex
+-1 anim bone
+-1 material vertex bone texture = bone
+vertex frame = anim texture texture = material vertex texture texture texture texture anim =
+0.500000 =
+-1 anim 1.0 -1
+frame 1.0 =
+vertex
+vertex -1
+vertex
+=
+texture
+frame vertex
+anim bone anim
+vertex anim bone texture vertex =
+vertex
+frame anim frame
+1.0 frame
+0.500000 vertex
+texture vertex =
+material -1 material -1 = anim texture -1 0.500000 0.500000
+bone 1.0
+vertex
+anim bone
+1.0 frame texture frame texture anim vertex frame
+-1
+= 0.500000 -1
+bone material -1 material anim = 0.500000 texture
+1.0 material
+0.500000 anim
+vertex 1.0 1.0
+0.500000 0.500000
+0.500000 bone
+-1 material 1.0 -1
+1.0
+material
+vertex bone anim bone vertex bone 0.500000 1.0 1.0 texture material texture 1.0 vertex texture
+anim anim material frame material
+-1 = = bone
+vertex -1
+anim
+frame -1 anim -1 0.500000 material
+anim material vertex
+anim 0.500000
+-1
+texture vertex bone anim -1 texture = material texture vertex material texture frame 0.500000 0.500000 anim
+=
+texture frame vertex anim texture 1.0
+texture texture =
+anim material 0.500000
+texture 1.0 0.500000 vertex vertex bone
+-1 texture
+1.0 bone -1 frame frame texture
+texture vertex vertex
+material
+material 0.500000 bone
+texture 1.0 -1 0.500000 material
+bone 0.500000 = 1.0 texture vertex vertex 0.500000
+frame frame vertex
+material frame -1 0.500000 =
+material frame
+anim material bone bone
+1.0 vertex =
+= = 1.0 vertex frame texture frame vertex
+0.500000 -1 0.500000 = -1 vertex anim frame
+1.0
+frame bone
+1.0 vertex vertex 0.500000 1.0
+vertex frame material material
+texture 0.500000
+vertex 0.500000 anim = =
+vertex
+material 0.500000 anim frame
+-1 anim anim bone frame vertex
+1.0 bone
+texture vertex material anim texture anim material texture -1 frame
+bone bone
+= -1
+anim
+0.500000 bone anim vertex anim
+-1 texture
+bone texture = anim -1 =
+anim 1.0 material frame frame
+frame
+bone
+texture texture 0.500000 0.500000 0.500000 1.0 1.0 bone -1 1.0 bone 1.0 1.0 vertex
+-1 anim
+=
+anim frame frame texture = anim -1 1.0
+-1
+texture anim bone anim bone anim -1 vertex
+material
+-1 material
+vertex anim =
+0.500000 texture 0.500000 material bone = material frame frame frame anim vertex -1 vertex
+material
+vertex material texture
+bone bone texture vertex
+frame frame anim texture texture frame bone
+bone 1.0 material material vertex
+1.0
+anim = bone
+material
+= = vertex frame material = vertex
+-1 material 0.500000
+frame 1.0 vertex
+0.500000 =
+texture = anim vertex bone =
+frame 1.0 anim texture
+texture frame anim 0.500000 texture bone anim frame material
+1.0 frame bone bone frame =
+= texture
+vertex
+anim
+1.0 -1 1.0
+texture -1 vertex 1.0 -1 anim material 1.0 0.500000
+frame
+frame anim frame material
+bone texture 0.500000 texture
+material 0.500000
+vertex
+-1 0.500000 texture
+1.0 1.0 0.500000 texture vertex vertex frame 0.500000
+vertex 0.500000 material material
+-1 vertex texture anim frame vertex frame -1 frame = texture anim anim 0.500000 0.500000 0.500000 1.0 frame
+material -1 frame
+texture = anim vertex
+-1 bone bone frame 1.0 0.500000
+-1 frame vertex 0.500000 bone -1 1.0 -1 texture
+vertex
+anim -1 =
+=
+bone
+1.0 bone vertex
+1.0
+anim material texture = =
+0.500000 material
+= = anim 1.0 0.500000 bone -1 frame -1
+frame texture texture bone 1.0
+1.0 frame
+frame texture bone
+frame
+-1 -1 -1
+texture
+texture
+0.500000 = vertex texture
+bone 1.0
+= texture -1
+=
+texture material = bone texture
+frame 1.0 material anim texture =
+material material material 0.500000 bone anim material
+= vertex 0.500000 1.0
+material
+texture
+anim
+vertex -1 texture vertex -1 bone
+frame anim vertex frame 1.0 material texture
+vertex texture 1.0
+material
+material bone = vertex
+vertex 1.0 =
+texture texture
+material
+0.500000 = vertex vertex
+texture
+anim anim 1.0
+frame vertex texture vertex 0.500000
+0.500000 texture
+anim material material vertex
+bone
+-1 frame material
+-1
+vertex =
+1.0 1.0 = texture
+1.0 texture
+texture vertex anim material anim vertex bone frame =
+1.0 texture -1 material -1
+bone =
+texture vertex -1 texture vertex texture anim -1
+vertex
+bone material
+1.0 bone anim vertex =
+vertex = 0.500000 =
+-1 bone 1.0 anim bone 1.0 vertex vertex
+texture material 1.0 0.500000 1.0 bone -1
+vertex material anim anim
+anim = frame
+bone -1 = anim vertex
+= material
+anim -1 = -1 material
+material bone
+texture bone vertex
+anim material frame 1.0 1.0
+material vertex 1.0 0.500000 frame anim vertex = anim frame
+0.500000
+anim
+vertex
+0.500000 material anim 1.0 0.500000 bone
+material
+anim material frame
+anim
+= anim
+material 0.500000 0.500000 anim
+0.
\ No newline at end of file
@@ -0,0 +1,59 @@
+material -1
+bone -1 texture 0.500000
+-1 1.0
+anim 0.500000 -1 texture bone 1.0 vertex 0.500000 0.500000
+frame anim texture
+anim -1 0.500000 0.500000
+bone texture anim = vertex texture
+frame
+texture texture 0.500000 -1
+= anim
+1.0 material material vertex anim anim
+anim bone material bone 0.500000 1.0 1.0
+vertex texture vertex = frame = vertex = texture frame 0.500000 anim 1.0 frame 0.500000 vertex
+-1 texture
+bone
+material
+frame 0.500000 bone -1 0.500000 frame = = -1 0.500000 1.0 1.0 vertex = vertex
+frame = material anim
+0.500000 material material = material vertex texture vertex 1.0 0.500000 =
+anim frame bone frame -1 material
+= 0.500000 1.0
+vertex
+0.500000
+frame -1 bone material
+0.500000 frame -1 vertex
+vertex vertex anim vertex frame vertex anim frame vertex texture 0.500000 material =
+= 1.0 anim =
+1.0 texture frame material material texture
+= 1.0 texture
+anim 0.500000 = texture
+texture material
+0.500000 material
+1.0 texture =
+= 0.500000 -1 -1 -1
+-1 frame 0.500000 0.500000 vertex bone vertex material material
+-1 frame 1.0 frame texture texture = texture 0.500000
+texture vertex
+-1 frame vertex frame texture frame 1.0 material -1 = = texture anim
+-1
+0.500000 texture vertex texture texture -1 anim texture
+0.500000 -1
+frame 0.500000 material 0.500000 vertex material 1.0 1.0
+1.0
+1.0
+bone material 1.0 0.500000 texture 0.500000 = bone
+bone -1 1.0 vertex bone 0.500000 -1 0.500000
+frame
+material
+vertex texture frame
+texture 0.500000 frame anim -1 0.500000 = bone material 0.500000 anim = material 1.0 bone 0.500000 material
+vertex anim vertex
+bone 1.0 =
+0.500000 bone bone 1.0 1.0 anim bone texture -1
+0.500000
+-1 frame = vertex material
+bone anim vertex vertex anim vertex texture 1.0 0.500000
+anim anim material vertex -1 texture vertex
+0.500000 bone 0.500000 bone anim
+1.0 1.
\ No newline at end of file
@@ -0,0 +1,53 @@
+-1 frame 0.500000 material bone 0.500000
+material
+anim frame texture material 0.500000 1.0 anim
+-1 texture 0.500000 = vertex -1 -1 bone 0.500000
+= 1.0 frame
+anim
+material vertex 1.0
+texture = = -1 -1 vertex bone
+material texture =
+0.500000 bone bone texture = anim
+material -1
+texture anim
+1.0 -1 bone = frame =
+1.0 1.0
+material material anim
+material 1.0 frame bone frame material -1 anim vertex
+0.500000 1.0 0.500000 material anim bone =
+anim material
+anim
+bone frame = anim = 0.500000 -1 anim material
+1.0 vertex vertex
+1.0 vertex vertex
+frame frame = 1.0 = bone frame = = = 0.500000 vertex material vertex = -1 bone -1 -1 -1
+0.500000 anim = vertex 0.500000 anim anim texture anim
+-1
+vertex 1.0 = bone 0.500000 1.0
+vertex
+texture = texture
+-1
+vertex texture
+frame
+1.0 texture frame =
+1.0 -1
+texture 1.0 0.500000
+texture texture
+0.500000 0.500000 anim 1.0 0.500000 bone material = material bone -1
+bone bone
+0.500000 material 0.500000 =
+1.0 0.500000 0.500000
+material
+-1 anim -1 1.0
+0.500000 vertex frame
+1.0 texture -1 =
+vertex texture material frame material -1 anim material material vertex frame = bone material vertex texture frame vertex bone texture anim 0.500000 1.0 vertex -1 -1
+vertex material frame =
+texture texture frame
+material bone = material texture bone frame anim 1.0
+frame anim
+anim -1
+-1
+-1 bone 0.500000 = vertex
+0.500000
+anim 1.0 texture -1 -1 0.500000 -1 bone anim bone vertex = frame = = = anim texture = 0.500000 texture material vertex 1.0 0.5
\ No newline at end of file
@@ -0,0 +1,192 @@
+bone material
+material anim 1.0 =
+texture material bone
+texture frame -1 material material
+-1 bone
+material bone 0.500000 material vertex
+anim anim vertex anim 0.500000
+frame
+-1 frame bone material
+frame anim = material
+bone 0.500000
+vertex
+vertex vertex frame -1
+bone
+anim
+=
+= material frame = bone
+frame anim
+=
+texture texture bone vertex
+texture 1.0 frame
+material texture vertex frame bone
+= vertex
+1.0 -1
+= texture texture -1 material 1.0 material material vertex
+vertex anim bone
+bone material
+anim 1.0 1.0
+0.500000
+frame
+-1 1.0 anim 1.0 material anim = 0.500000 anim = vertex
+material
+1.0 material
+= -1
+material = bone anim = vertex
+0.500000
+vertex material anim
+bone material bone material texture frame texture
+0.500000 vertex vertex = =
+1.0
+bone anim material
+1.0 vertex = 0.500000 texture anim -1 1.0 bone
+material material = 0.500000
+texture
+vertex
+bone -1 = frame
+-1 frame bone -1 material =
+frame anim 1.0
+material -1 anim 0.500000 bone
+frame
+bone material = =
+anim bone frame 1.0
+bone = vertex 1.0 bone
+anim texture -1 = -1 anim frame
+frame 1.0 frame
+vertex
+0.500000 = bone 1.0 texture
+frame texture 0.500000
+-1
+0.500000 1.0 material
+material = material
+frame -1 0.500000 anim vertex
+material 1.0 1.0
+bone texture frame 0.500000 frame texture material bone -1 material frame 1.0 bone 0.500000 bone material frame 0.500000
+0.500000
+= frame -1 frame
+-1 material bone bone
+texture vertex material -1 anim -1 anim 0.500000 material
+material material vertex material 0.500000
+frame 1.0 texture vertex -1 anim 1.0
+bone
+-1
+texture
+texture texture -1 anim 0.500000 anim vertex vertex bone texture
+texture 1.0 = 0.500000 vertex =
+vertex 0.500000 material
+anim material bone
+vertex
+0.500000 texture
+= -1 vertex material
+material 1.0 1.0 bone
+vertex =
+frame 0.500000 =
+= anim bone = anim 0.500000 = 0.500000 anim -1
+0.500000 texture 1.0
+=
+anim -1 anim
+bone anim
+texture 1.0 1.0 1.0 material = 1.0
+1.0
+bone
+texture material
+material
+bone material =
+frame
+material
+-1 bone vertex
+1.0 anim = -1
+= frame = bone
+frame anim 0.500000
+-1 -1
+=
+vertex texture frame anim 0.500000 material
+texture
+= texture =
+frame
+frame
+material frame
+material
+anim
+bone texture
+1.0 -1
+texture vertex vertex
+vertex = frame vertex = -1 -1 bone = material material vertex bone material -1 material
+0.500000
+frame material texture vertex
+material -1
+-1
+material anim vertex anim
+anim -1
+0.500000 =
+texture
+0.500000 texture frame vertex
+material
+vertex
+frame -1 1.0 0.500000 -1 anim =
+= texture texture
+vertex material texture -1
+-1
+0.500000 -1 frame = bone = vertex -1 0.500000
+0.500000 bone -1 -1
+= 1.0
+=
+material = anim anim bone bone texture
+= texture bone
+anim
+vertex
+0.500000 =
+frame 1.0 0.500000 vertex 1.0
+= bone texture material
+anim -1
+= texture
+texture material
+0.500000
+= 1.0 0.500000 1.0 frame
+material -1 frame material frame anim 1.0
+anim texture 0.500000 bone vertex frame material
+-1 -1 vertex
+= frame -1 material
+anim anim = bone = vertex bone = anim texture material
+1.0 anim material anim 1.0
+0.500000 = vertex frame vertex = 0.500000 = vertex
+=
+anim
+0.500000
+anim vertex
+anim
+0.500000 anim material texture material texture anim frame material
+material frame 0.500000 texture
+texture vertex anim frame texture 0.500000
+frame material bone bone 0.500000 = texture 0.500000
+0.500000 anim = vertex
+material bone texture vertex frame = frame 0.500000 = 0.500000 0.500000 1.0 bone
+texture frame
+material 0.500000 texture material 1.0 frame = texture material = bone material =
+frame material
+vertex 0.500000 texture
+vertex frame anim anim material material
+frame
+= 0.500000 vertex
+bone frame
+anim vertex 1.0 1.0
+vertex
+0.500000 anim anim = material
+= frame material frame
+frame anim 0.500000 bone vertex 0.500000 1.0 anim -1 anim
+anim material -1 frame material texture vertex 0.500000 1.0 texture anim = = frame bone
+bone 0.500000 =
+texture
+bone 1.0 =
+0.500000
+material texture material texture anim
+material frame
+= texture vertex -1
+1.0 1.0 frame material =
+frame anim anim -1 -1 0.500000 0.500000
+vertex
+frame vertex material 0.500000 anim
+0.500000 1.0 -1
+0.500000 frame
+0.500000 frame bone
+vertex
\ No newline at end of file
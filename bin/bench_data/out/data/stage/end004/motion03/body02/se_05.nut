@@ -0,0 +1,16 @@
+-1
+texture
+0.500000
+-1 material
+texture frame = material vertex 1.0
+bone vertex
+1.0 frame
+vertex -1
+= material bone texture material bone
+-1 frame
+texture frame -1
+material frame vertex
+0.500000
+bone
+-1 = = texture -1 frame
+0.500000 a
\ No newline at end of file
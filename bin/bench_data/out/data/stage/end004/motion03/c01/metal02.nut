@@ -0,0 +1,2 @@
+= vertex material vertex material
+1.0 -1 ani
\ No newline at end of file
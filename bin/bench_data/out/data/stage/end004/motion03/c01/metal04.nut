@@ -0,0 +1,318 @@
+anim bone vertex
+vertex
+anim anim texture bone
+material
+-1 frame frame
+= -1 anim = frame 1.0 1.0 bone material -1 -1 1.0
+bone material
+1.0 material
+= 1.0 = texture
+texture texture
+bone material -1 anim
+1.0 bone texture
+material
+bone 1.0 0.500000 1.0
+bone
+frame 1.0 frame
+0.500000 material = 0.500000
+anim frame = =
+vertex -1 anim material anim
+material anim material 0.500000 texture material 1.0
+material
+bone 0.500000
+-1 anim
+vertex
+-1 bone -1 -1 = 0.500000
+material bone vertex frame anim 1.0 bone 0.500000
+1.0 frame
+= frame
+= anim anim material bone =
+anim texture anim
+= texture
+bone frame bone material vertex =
+anim material anim -1 -1 -1 material frame frame 1.0 -1 = bone frame 1.0 texture texture 1.0 -1 -1 anim -1 anim
+material 0.500000 vertex
+bone material anim anim
+1.0 = frame
+1.0 frame material
+1.0 1.0
+= texture texture vertex -1
+1.0 texture
+= texture bone frame anim = frame vertex vertex frame
+-1 1.0 texture 1.0 -1 vertex = material
+0.500000 bone frame 1.0 anim
+-1 -1
+= frame anim texture frame frame
+frame frame -1 material frame
+frame material texture
+vertex 1.0 bone texture frame 1.0 material texture
+anim
+vertex -1 0.500000
+0.500000 texture texture material 0.500000
+material 1.0 material
+0.500000 vertex
+= material 1.0
+-1 bone material
+-1 -1 = anim
+frame vertex bone
+material
+anim frame
+vertex -1
+1.0 0.500000 bone -1 anim
+material
+material material
+texture material vertex = vertex anim -1 bone
+material 0.500000
+-1 frame
+= bone
+anim vertex vertex texture frame = anim -1 0.500000 texture -1 vertex anim 1.0 = 1.0 0.500000 texture
+anim
+texture frame texture
+frame
+-1 vertex 0.500000
+-1
+= texture -1 material
+= = frame texture 1.0 -1
+frame
+texture material anim bone
+texture vertex texture frame bone = bone material 1.0
+material
+0.500000
+-1
+vertex texture material texture
+bone 0.500000 anim 0.500000
+vertex =
+material texture material 0.500000 anim
+anim
+0.500000 anim = material
+bone bone texture 1.0
+1.0 bone
+anim 0.500000
+0.500000
+0.500000 bone vertex material vertex
+material = texture texture 0.500000 material 1.0 texture
+-1 1.0
+1.0 bone 0.500000
+material anim
+vertex 1.0 material = 0.500000 frame 1.0
+bone 1.0 1.0 = = anim -1 texture
+bone
+vertex frame bone material texture = bone = anim vertex -1 bone 1.0 bone 1.0 -1 texture =
+= anim -1 texture 0.500000 anim
+-1
+frame 1.0 0.500000 anim frame anim material vertex 1.0 1.0 texture
+material
+material texture vertex material
+anim frame anim vertex texture
+0.500000
+-1
+frame material
+frame 1.0 vertex -1 1.0 1.0 texture
+= =
+anim = anim texture anim 0.500000 frame
+-1 texture vertex anim anim frame frame
+vertex -1 bone -1 frame bone bone -1 vertex frame texture =
+material -1 vertex
+material
+texture anim
+anim anim -1 frame
+frame
+1.0
+texture 0.500000 1.0 = frame = frame =
+= bone -1 texture
+material
+0.500000
+frame frame 0.500000
+frame material = material -1
+0.500000 = vertex anim vertex = texture 1.0
+frame
+0.500000 frame =
+vertex texture frame anim anim frame -1 anim =
+-1 vertex material material material -1 texture texture -1 0.500000 = -1
+-1 bone
+frame bone 0.500000
+0.500000 frame 0.500000 material texture vertex bone
+texture material vertex -1
+texture vertex anim -1 texture bone texture anim 1.0 0.500000 material 1.0
+1.0 bone anim -1 bone 1.0 1.0
+vertex material frame 1.0 1.0 bone 0.500000
+bone
+vertex bone 1.0 vertex = -1 bone bone =
+bone 0.500000 anim
+material
+texture texture texture 0.500000 =
+material
+vertex
+-1 vertex
+anim vertex 0.500000 anim
+frame bone -1
+1.0 texture
+-1
+1.0
+= frame -1
+-1
+-1 frame
+= bone bone -1
+-1 bone
+vertex
+material texture 0.500000 frame material anim 0.500000 -1
+frame frame material 1.0 frame -1 1.0 vertex anim
+material
+anim frame 1.0
+bone = = texture frame frame bone anim material -1 bone bone anim texture 0.500000
+0.500000 anim texture bone texture 1.0 vertex = -1 vertex bone 0.500000
+texture
+1.0 anim 1.0 material vertex frame vertex anim frame vertex = anim vertex vertex frame -1
+= 0.500000 anim vertex -1 bone 0.500000 = frame
+frame
+anim material
+bone =
+vertex 0.500000 bone texture =
+anim material frame
+frame -1 texture material bone frame
+texture =
+-1
+frame 1.0 -1
+1.0
+vertex
+material
+0.500000 material
+vertex
+texture material anim
+vertex
+-1 texture bone
+=
+texture -1 -1 0.500000 0.500000 -1 1.0 frame vertex
+-1 frame 1.0 texture 1.0 texture material 1.0 -1
+texture anim bone texture -1
+texture
+material
+0.500000 anim
+frame
+-1 = anim
+texture texture = anim = = material 1.0 frame anim 1.0 material material texture -1 = vertex 0.500000 frame frame -1 bone 1.0 texture material anim
+frame 0.500000
+-1
+anim material
+texture
+bone -1 -1 bone anim
+= vertex bone bone material 0.500000 vertex = material -1
+material
+0.500000 bone =
+0.500000 frame = frame
+-1
+1.0 0.500000 -1 texture texture 0.500000 texture 1.0 bone anim =
+texture
+vertex 1.0 0.500000 material -1 anim = 1.0 = = material = -1 texture bone =
+vertex
+0.500000 anim
+vertex = texture 0.500000 anim bone =
+= vertex bone frame 1.0 0.500000
+bone
+1.0 anim bone 1.0 1.0 frame vertex -1 1.0 = bone frame
+0.500000
+1.0 0.500000 bone 1.0 material
+material anim vertex vertex = bone 1.0 bone = 0.500000 frame = = -1 material material
+texture anim = = texture frame bone frame
+0.500000 texture frame texture -1 -1 vertex
+vertex vertex
+-1 vertex material = anim anim -1 texture anim vertex bone 0.500000 material = =
+vertex -1
+= anim
+1.0 texture -1
+anim anim 1.0 0.500000 frame 1.0
+1.0
+bone bone
+bone
+vertex vertex texture material
+0.500000 0.500000 frame
+texture
+-1 material 0.500000 anim = material material
+= anim frame bone
+vertex texture 0.500000 anim frame 1.0 =
+vertex -1 texture texture
+=
+0.500000 material texture 0.500000
+vertex material texture 1.0 frame anim
+bone 1.0 vertex material frame 1.0 material anim 0.500000
+texture
+1.0 material vertex vertex anim 1.0 bone
+1.0 -1 bone bone 1.0 material vertex -1 material bone material bone vertex
+= frame = 1.0 frame
+texture material texture 1.0 material
+-1 texture -1 1.0 anim 0.500000
+1.0 -1 texture
+bone -1 = -1 material
+vertex material 1.0 anim = frame 0.500000
+= texture 1.0 texture
+0.500000 anim = bone -1 frame 1.0 material
+anim vertex
+frame bone
+0.500000
+texture texture texture = vertex bone = frame texture material frame
+anim bone material frame bone 0.500000 bone
+1.0
+anim frame material anim 1.0
+1.0 bone -1 frame frame
+= 0.500000
+= material texture = texture material material = anim vertex
+texture anim bone vertex material texture bone = frame 1.0 frame
+0.500000 frame bone vertex = bone bone -1 0.500000
+0.500000 bone 0.500000
+vertex 1.0 material
+= -1 vertex bone texture anim 0.500000 =
+anim anim
+vertex 1.0
+bone -1 frame material =
+anim = 0.500000 0.500000 frame
+bone
+0.500000 anim bone anim
+material vertex -1 0.500000
+1.0
+texture material anim texture texture = texture
+anim frame 1.0 texture
+texture
+texture 0.500000 texture
+material frame
+1.0 1.0 material
+-1 material material 0.500000 anim -1 texture bone anim = bone frame texture frame anim
+material = material
+-1
+0.500000 material anim material bone
+1.0 1.0
+-1 bone
+0.500000 0.500000 = 1.0
+texture bone
+vertex anim
+frame texture frame bone anim 1.0
+texture bone
+material
+frame vertex -1 0.500000 =
+anim frame 0.500000 frame anim
+0.500000
+= vertex
+material
+texture = bone bone material
+texture
+0.500000 1.0 0.500000 material = material texture
+texture frame
+frame
+1.0 -1 vertex -1 -1 bone
+anim -1 vertex texture vertex 0.500000 0.500000 texture
+material vertex 0.500000 bone
+0.500000 texture =
+bone texture texture vertex frame vertex material -1 vertex texture texture
+=
+anim frame frame vertex
+anim texture =
+vertex
+material 0.500000 texture frame
+bone -1 1.0 0.500000 material texture vertex bone vertex vertex
+frame frame texture -1 texture -1 vertex
+material 1.0
+1.0
+= -1 bone
+0.500000 texture
+= 1.0 0.500000 = 0.500000 vertex 1.0 frame texture frame
+material
+vertex vertex -1 bone ani
\ No newline at end of file
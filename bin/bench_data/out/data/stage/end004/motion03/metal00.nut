@@ -0,0 +1,271 @@
+bone 1.0 vertex bone 0.500000 vertex 1.0 frame
+= material texture
+anim texture -1 1.0 frame frame 0.500000
+-1
+1.0 = =
+bone =
+frame
+= = frame material -1 0.500000 anim
+1.0
+anim
+material
+bone vertex vertex frame 1.0 1.0 vertex 0.500000 anim = bone
+frame 0.500000 anim 0.500000 = material material = anim -1
+vertex bone texture vertex vertex
+1.0 texture vertex vertex 1.0 frame 0.500000 -1
+vertex texture
+anim material 1.0 texture =
+anim
+-1 material material 1.0 bone =
+-1
+texture 0.500000 1.0 texture vertex -1 =
+vertex 1.0 material bone frame
+bone 0.500000 material anim texture
+frame anim -1 anim bone = texture
+bone material
+-1 frame 1.0
+0.500000 vertex frame bone
+0.500000
+0.500000
+anim = = anim bone 0.500000 1.0 = material 1.0 anim texture bone material = anim = material 1.0 = material texture anim 0.500000 0.500000 bone 0.500000 = -1 0.500000
+1.0 anim material -1 texture bone texture anim
+material -1 -1 1.0 -1 1.0 texture = 1.0 anim texture -1 bone 0.500000 frame
+frame vertex frame 0.500000
+vertex vertex texture =
+bone anim vertex 1.0 vertex bone bone
+0.500000 0.500000 1.0 frame texture 0.500000
+1.0 texture 1.0
+material anim material 1.0
+anim anim frame material -1 1.0
+anim
+1.0 0.500000 bone
+frame anim 0.500000 anim 1.0
+bone vertex 0.500000
+bone bone
+-1 frame material
+anim
+anim 0.500000 vertex
+0.500000 frame frame texture anim material frame bone 1.0 -1 -1
+frame 0.500000
+material
+frame
+vertex -1 vertex
+frame = bone anim texture 1.0 vertex material texture = anim texture vertex
+1.0 anim -1
+1.0 frame frame frame vertex anim 0.500000 = material texture material bone
+-1 vertex 1.0 anim 1.0 anim 0.500000 vertex anim anim vertex -1
+anim bone 0.500000 vertex vertex = material 1.0
+texture
+frame 0.500000
+material
+texture 1.0 =
+-1 vertex vertex
+material 1.0 frame material anim texture material
+1.0 frame anim vertex 1.0
+anim
+-1 material bone frame anim frame
+material texture
+frame texture = 1.0 1.0 frame -1 1.0 bone
+vertex material 1.0
+-1 frame 1.0 texture anim anim texture anim
+0.500000 anim =
+frame bone
+=
+frame material material = anim
+material = material
+anim -1
+= -1 anim texture = material 0.500000
+= bone = vertex bone = vertex anim anim frame anim anim anim 0.500000
+0.500000 =
+texture texture vertex bone vertex = -1
+vertex bone 1.0 texture vertex
+bone
+anim -1 texture bone bone
+0.500000 bone material
+frame material -1
+frame texture 1.0
+-1 = -1 bone 0.500000
+bone 1.0 -1 material
+1.0 vertex anim bone frame = vertex texture = 0.500000 bone -1 material material anim
+texture = anim vertex 1.0 bone vertex vertex texture
+1.0 1.0 texture
+bone 1.0 texture frame material bone anim = frame texture 0.500000
+bone bone material material
+0.500000 = 1.0
+-1 = vertex 1.0 frame vertex vertex material anim
+texture anim vertex 0.500000 1.0 material
+frame 1.0 frame vertex = vertex
+bone anim
+0.500000
+-1
+0.500000 vertex 1.0
+material 1.0 0.500000 0.500000 = bone texture -1 vertex
+bone
+= vertex
+frame
+vertex 1.0 anim 1.0
+1.0 bone -1 vertex 1.0 frame
+bone bone
+texture
+material texture frame frame 1.0 vertex -1 bone
+1.0
+bone 0.500000 vertex
+-1
+bone
+vertex
+texture material
+1.0 1.0 vertex frame
+anim
+1.0 bone material
+frame -1
+-1 0.500000 texture
+0.500000 vertex
+0.500000 vertex
+material material
+1.0 vertex 0.500000 frame
+texture
+vertex anim anim 0.500000 bone bone bone
+bone 1.0 1.0
+1.0 anim
+material bone
+vertex 0.500000 =
+-1 =
+1.0 vertex material
+anim frame 0.500000 -1
+= anim anim material frame frame bone 1.0
+bone
+=
+material 0.500000 frame vertex frame anim frame
+1.0 = -1 bone bone anim -1
+material 1.0 frame
+bone material frame frame 0.500000 texture texture = anim anim -1 material
+=
+texture frame texture
+= 1.0 material material
+=
+1.0 vertex
+-1 -1 texture bone texture
+0.500000 bone bone
+= bone 1.0 = = bone
+-1 texture frame material 1.0 material material
+vertex vertex
+frame 1.0 texture
+frame 0.500000 0.500000 0.500000 = texture frame
+bone material anim
+texture = vertex 1.0 material = frame 1.0 frame texture anim material texture
+material bone vertex -1 = anim vertex
+-1 0.500000 -1 -1 vertex = material anim
+= frame 0.500000 vertex frame
+1.0 anim
+texture
+material vertex
+anim 0.500000 -1 =
+material = anim bone 0.500000 anim frame frame bone texture
+anim anim =
+frame bone frame anim 1.0 vertex
+material vertex frame frame
+bone material bone material
+texture vertex 0.500000 anim vertex vertex texture -1 vertex
+1.0 texture 1.0 anim
+material bone vertex frame bone
+0.500000 vertex
+1.0 frame anim anim anim
+frame 1.0 vertex vertex bone frame
+-1 anim 1.0 1.0 -1
+material
+-1 anim
+material -1
+anim texture
+-1 0.500000 bone vertex 0.500000 0.500000 -1 1.0
+0.500000
+frame
+texture
+vertex
+bone
+bone
+frame bone material bone
+-1
+0.500000 frame
+0.500000
+anim material
+0.500000
+0.500000
+anim vertex material anim -1 1.0 material vertex 1.0 frame = texture
+-1 1.0
+vertex
+0.500000
+1.0 -1 vertex -1 bone
+0.500000 = bone
+1.0 vertex anim vertex 0.500000 = -1
+= -1 -1 vertex 0.500000 frame = anim bone
+1.0
+vertex bone -1
+material material 0.500000
+= = material 0.500000 = frame anim texture material 0.500000
+anim anim texture = 1.0 texture
+anim anim bone material
+texture
+material frame
+0.500000 frame anim frame
+vertex vertex 1.0 -1 texture 1.0 texture frame 1.0 frame 1.0 frame bone texture
+1.0
+0.500000 frame frame -1 0.500000
+material frame material
+-1 0.500000
+0.500000 1.0
+-1 bone 1.0 0.500000 frame
+anim frame = vertex
+frame texture bone
+anim frame
+material 1.0 bone texture -1
+vertex = -1 material material
+-1 -1 anim 1.0 anim -1 material 0.500000 anim = bone = vertex bone
+texture material -1 1.0 bone 1.0 anim
+bone -1
+texture vertex
+frame material = 0.500000
+texture
+vertex material frame -1 frame =
+-1 0.500000 material
+0.500000 anim 0.500000 = 1.0 material 1.0
+= 0.500000 anim frame
+0.500000 material -1
+anim = 0.500000
+texture bone =
+1.0 anim frame
+texture
+bone 1.0 texture
+bone texture bone 0.500000
+bone
+=
+1.0 = anim
+-1
+-1 vertex -1 vertex 0.500000 bone = vertex material 0.500000 0.500000
+-1
+bone = vertex texture 1.0
+anim 0.500000 -1 -1 anim
+= frame material = =
+bone = 0.500000 vertex = 0.500000 frame anim = material texture material = anim bone 1.0 material 1.0 frame material texture vertex material frame
+= texture -1 = anim texture texture vertex frame bone 1.0 0.500000
+0.500000
+vertex 1.0 frame material frame material 0.500000 bone vertex texture 1.0 -1 = -1 vertex
+frame
+1.0 texture
+texture 0.500000
+anim texture bone bone
+material -1 material frame vertex
+-1 1.0 bone
+1.0
+material vertex frame 0.500000 vertex
+anim -1 anim
+anim = bone
+-1 = material
+material anim texture material material
+anim material -1
+0.500000
+frame
+1.0
+texture
+= 0.500000 = 1.0 = texture vertex frame texture -1
+frame 1.0 material
+1.0 verte
\ No newline at end of file
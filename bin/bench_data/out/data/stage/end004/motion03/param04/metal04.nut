@@ -0,0 +1 @@
+VuNU_쁙<؛Kߕwwdn$$:=lo*KȣE8|Ι>^ߎgY8NoMA]1Du	!S퉢{tm3×.V/
\ No newline at end of file
@@ -0,0 +1,47 @@
+anim -1 material anim =
+material
+bone -1 bone material frame
+frame material 1.0 0.500000 1.0 0.500000 = 1.0
+= texture bone texture anim = 1.0 material material -1
+anim bone anim frame
+anim material
+1.0 1.0 =
+frame 1.0
+anim
+0.500000 1.0 texture texture
+1.0 bone vertex vertex
+anim texture texture 1.0
+= vertex
+-1 bone texture = bone -1 material = frame material anim
+vertex bone 1.0 vertex bone material material frame 0.500000 bone material material 0.500000 1.0
+-1
+bone texture material bone texture 0.500000 0.500000 anim bone texture = 1.0 frame = frame
+0.500000 = frame 1.0 bone
+-1 anim = texture texture -1 1.0
+anim texture texture
+1.0 0.500000 bone material =
+0.500000 material
+-1 -1 material texture
+= 0.500000
+-1 = texture
+-1 bone
+= vertex texture material
+vertex material anim
+-1 1.0 -1 texture texture 1.0 texture 1.0 0.500000
+anim
+= 0.500000 anim bone vertex texture
+vertex
+frame material bone = vertex anim = material 0.500000 anim frame frame 1.0 bone 1.0
+1.0 frame
+= material vertex -1 0.500000 0.500000 material material 0.500000 = material vertex
+bone vertex frame bone material vertex frame = anim
+anim vertex
+vertex
+1.0 texture material = vertex 0.500000 -1
+anim vertex material anim vertex bone bone vertex 1.0 bone bone 1.0
+0.500000 = material material material
+anim anim texture vertex
+material
+=
+=
+bone texture bone material b
\ No newline at end of file
@@ -0,0 +1,14 @@
+1.0 -1 1.0 texture -1
+anim texture material frame -1
+vertex
+1.0 1.0 = frame = anim texture bone
+texture -1 1.0 -1 texture frame -1
+texture
+-1 bone = frame bone texture vertex -1 1.0 vertex
+bone -1 anim frame
+material
+0.500000 -1
+bone bone bone = anim material
+texture -1 vertex -1
+anim =
+-1 bone f
\ No newline at end of file
@@ -0,0 +1,131 @@
+bone 1.0 texture
+bone
+material
+frame 1.0 0.500000 material material bone vertex -1 anim = =
+anim = 1.0 texture frame -1 0.500000 frame texture
+= vertex
+material frame 1.0
+texture
+material 0.500000 1.0 0.500000 bone
+anim 0.500000
+1.0
+material
+= 1.0 1.0 anim =
+= vertex bone 0.500000 =
+-1 anim
+= 1.0
+-1 frame -1 anim
+0.500000 bone texture texture frame =
+= material
+=
+0.500000
+material bone 1.0 material texture
+texture bone
+anim vertex = 1.0
+1.0 anim anim = texture
+1.0 1.0
+bone 0.500000
+frame anim 1.0 vertex frame -1
+1.0 vertex texture vertex texture frame bone = frame
+vertex 0.500000 material material
+= bone
+0.500000 anim 1.0 vertex anim 0.500000 frame 0.500000 0.500000 material = -1 1.0 bone 0.500000 0.500000 0.500000
+-1 bone material
+-1
+bone texture = anim material = vertex -1
+frame
+frame texture 0.500000 bone 0.500000 0.500000 material material vertex frame
+= -1
+=
+= material texture
+0.500000 texture
+material 0.500000 bone bone 0.500000 material
+1.0 material material vertex texture frame material bone material material -1
+frame anim 0.500000
+frame texture
+frame vertex
+texture 0.500000 anim = material frame bone
+-1 vertex vertex -1 =
+0.500000 1.0
+bone anim bone 1.0
+texture 0.500000 -1 vertex
+texture = 1.0 anim
+bone = anim = -1 frame = =
+1.0
+= frame texture -1 material anim 0.500000
+texture =
+bone
+anim anim anim vertex frame
+bone vertex vertex 0.500000
+= bone material frame =
+frame texture texture 1.0 -1
+1.0
+-1 frame texture 1.0 texture vertex material -1 anim texture
+anim 1.0 frame
+texture -1 material anim
+= -1
+bone bone 0.500000 0.500000 = anim 1.0 material 1.0 bone
+bone anim 0.500000 vertex
+1.0
+material 0.500000 bone
+vertex bone 1.0 bone texture 1.0
+0.500000 bone frame
+bone 0.500000 = material 0.500000
+= -1 1.0 anim = -1 texture -1 0.500000 0.500000 frame
+anim
+0.500000 texture material anim anim texture material
+texture vertex = texture anim anim bone 0.500000 material = -1
+vertex
+vertex 0.500000
+= anim = = -1 = frame
+vertex texture =
+1.0
+bone = =
+0.500000 = frame frame = 1.0 frame 1.0 1.0 material anim frame
+anim -1 texture frame vertex = frame = vertex bone anim 1.0 1.0
+texture
+anim -1
+1.0 frame
+= =
+1.0
+1.0 anim 1.0 material material 0.500000 1.0 -1
+material = 1.0 -1 anim
+0.500000
+texture = material frame = anim bone
+1.0
+0.500000
+texture -1 anim = = texture vertex material -1
+material material texture =
+-1 bone = -1
+= = vertex
+frame frame = material -1 0.500000 vertex 1.0 1.0
+anim
+-1
+frame
+0.500000 texture 0.500000
+material
+= -1 -1 bone material frame bone
+material 0.500000
+material 1.0 material
+frame
+1.0 bone vertex
+bone bone 0.500000 bone
+0.500000 =
+= anim 1.0 material vertex anim bone material 1.0 vertex = frame bone -1 bone
+bone
+vertex 0.500000 frame bone bone
+anim anim
+texture bone =
+1.0 anim material texture -1
+bone bone material 0.500000 = 1.0
+bone vertex bone frame
+anim 0.500000 0.500000 -1
+vertex anim 0.500000
+texture 1.0
+bone bone -1 = anim
+0.500000 0.500000 = material 1.0 0.500000 -1 vertex anim 1.0 1.0 1.0 0.500000 1.0 -1
+texture bone 1.0 = texture 1.0 = 1.0
+anim
+= 0.500000 material material texture 1.0 material material
+frame vertex texture -1 frame anim vertex 1.0
+-1 material = 0.500000 material 0.500000 frame texture ma
\ No newline at end of file
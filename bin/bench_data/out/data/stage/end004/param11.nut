@@ -0,0 +1,40 @@
+bone =
+1.0 bone = texture
+0.500000 vertex texture bone -1 1.0
+bone 1.0 vertex frame texture 0.500000 = 0.500000 = texture 0.500000
+1.0
+1.0 =
+-1 1.0 0.500000 = material texture -1 material 0.500000 material frame
+frame texture
+1.0 anim
+0.500000
+texture 0.500000
+vertex 1.0 -1 0.500000 texture -1
+vertex anim material vertex frame -1 -1 = frame texture = bone 0.500000 = -1 texture material
+1.0 =
+frame 1.0
+vertex 0.500000 0.500000 1.0
+1.0
+frame bone texture
+texture
+= material = 1.0 texture anim
+material
+material material -1
+0.500000 -1
+texture 0.500000 texture anim 1.0 vertex
+1.0
+material vertex -1 frame vertex texture
+material -1
+anim = 0.500000
+vertex = vertex frame material frame -1 =
+vertex frame vertex
+1.0 =
+vertex
+= material
+material 1.0
+anim
+-1
+texture = = texture frame texture
+bone frame
+-1 texture bone -1 -1
+texture texture texture fr
\ No newline at end of file
@@ -0,0 +1,3 @@
+-1
+texture -1
+material anim 1.0 0.50
\ No newline at end of file
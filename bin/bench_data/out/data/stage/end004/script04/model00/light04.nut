@@ -0,0 +1,27 @@
+vertex bone
+anim frame material -1
+anim bone frame vertex
+1.0 vertex material
+anim
+vertex -1 vertex 1.0 texture 1.0
+bone vertex texture frame =
+1.0 frame anim 1.0 = texture
+material vertex anim frame -1 anim material
+vertex
+frame = 1.0
+-1 bone material -1
+vertex 1.0
+= -1 material -1
+texture =
+-1 bone vertex anim = 1.0
+= vertex texture material vertex
+=
+-1
+-1 anim texture anim frame bone vertex -1 0.500000 0.500000 0.500000 1.0 anim texture
+-1 anim anim
+anim
+=
+0.500000 = frame material vertex
+1.0 =
+frame material vertex
+1.0 bone frame material anim bone anim anim texture bone vertex 
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex material anim 1.0
+anim -1
@@ -0,0 +1,55 @@
+texture vertex
+-1 bone
+bone anim
+-1 anim vertex -1 frame anim
+material
+1.0 bone frame -1 1.0 -1 vertex frame 0.500000 vertex
+-1 0.500000 vertex
+material texture texture 0.500000 1.0 bone texture
+material vertex frame 0.500000 texture texture 1.0 frame =
+frame frame 1.0 -1 anim -1 frame frame
+material frame
+bone 1.0 vertex
+-1
+1.0 frame material -1 =
+anim
+=
+bone
+= 0.500000 -1
+material = 1.0 texture texture
+0.500000 -1 vertex -1 vertex
+0.500000
+= 1.0 = frame frame
+0.500000 texture material frame texture -1
+anim material -1 anim texture
+0.500000
+anim vertex
+material = 0.500000 vertex frame texture frame anim 1.0 texture frame 1.0 -1 = 1.0 -1 texture -1
+frame frame
+vertex 0.500000 bone frame 0.500000 bone
+0.500000 material
+frame material anim
+texture
+0.500000 material = 0.500000 texture
+-1 texture = anim frame
+anim
+material 1.0 frame 1.0
+1.0 anim
+= = texture
+texture texture
+anim -1 bone = 0.500000
+=
+bone 0.500000
+bone 1.0
+bone anim -1 frame
+frame 1.0 0.500000 = frame
+frame
+anim
+bone anim 1.0 anim = frame
+1.0 texture frame bone
+anim vertex texture texture
+material -1
+vertex material frame 1.0 1.0 -1
+frame frame vertex 0.500000 -1
+anim frame vertex -1
+vertex texture 1.0 f
\ No newline at end of file
@@ -0,0 +1,49 @@
+= 0.500000 0.500000 anim
+texture material
+0.500000 vertex anim material = material
+material
+material
+bone
+texture anim vertex -1
+texture
+frame = -1 vertex -1 texture = 0.500000
+anim anim = 0.500000 1.0
+texture anim
+bone frame
+material
+texture
+= anim bone anim bone -1 = texture -1 = vertex texture
+0.500000 -1 material vertex 0.500000 bone bone
+material
+-1
+vertex 1.0 texture
+=
+0.500000 vertex
+anim
+anim 1.0 0.500000 material
+texture texture bone = material vertex frame 1.0 material anim anim texture
+0.500000 -1 bone bone
+0.500000 0.500000 material -1 frame material 0.500000 bone bone texture bone 1.0 anim bone bone frame 0.500000 vertex bone bone = anim = bone -1
+vertex texture
+= material material
+=
+frame 0.500000 texture = material 1.0 -1
+=
+vertex bone anim
+1.0 -1 frame
+-1 material texture vertex -1 anim frame
+bone frame frame frame
+frame
+texture = material 1.0 frame 1.0 frame anim vertex texture vertex
+material 0.500000 anim material -1 material
+bone
+texture 1.0 0.500000 -1
+0.500000
+-1 frame
+texture texture
+= = = frame 1.0
+bone vertex bone -1 texture frame anim 0.500000 material frame = 1.0
+frame
+vertex material =
+bone vertex
+mate
\ No newline at end of file
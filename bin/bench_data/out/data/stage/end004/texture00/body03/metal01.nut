@@ -0,0 +1,17 @@
+anim bone vertex vertex
+bone 1.0 bone
+bone
+bone texture bone 0.500000 bone 1.0 bone texture
+vertex 1.0 0.500000
+-1 0.500000 bone vertex
+=
+1.0
+1.0 material material
+= anim 0.500000 0.500000 -1
+frame
+texture
+material
+material
+frame -1 = frame texture texture -1 frame
+texture bone
+material anim vert
\ No newline at end of file
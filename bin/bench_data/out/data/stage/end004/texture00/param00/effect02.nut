@@ -0,0 +1,286 @@
+-1 = material texture 0.500000
+anim 1.0 bone texture
+1.0
+frame 1.0 texture 1.0
+= material material
+1.0
+0.500000
+frame 1.0
+0.500000
+anim texture anim
+= -1 vertex bone
+bone vertex -1 texture -1 anim texture frame texture texture material texture
+texture bone
+vertex 1.0 0.500000 0.500000
+bone bone 1.0
+0.500000 1.0
+bone frame bone -1 material 1.0
+material 0.500000 bone bone frame -1 vertex 0.500000
+material = vertex = -1 texture vertex 1.0 vertex bone
+texture
+texture texture
+1.0
+frame material = -1 -1
+vertex frame =
+frame
+1.0 = 1.0 1.0 1.0 0.500000
+-1
+material
+vertex material
+material = = vertex anim material
+=
+anim =
+material material vertex 0.500000
+vertex
+bone 0.500000 -1 1.0
+vertex texture 1.0 texture frame
+0.500000
+1.0 anim
+-1 0.500000 -1 material vertex frame
+anim anim -1 texture anim
+0.500000
+texture material 1.0 frame vertex
+1.0
+1.0 -1 anim
+vertex 1.0 frame bone -1 =
+= vertex 0.500000 bone frame
+material
+material anim
+bone
+frame vertex =
+0.500000 bone vertex anim
+vertex material
+frame anim
+material
+material texture bone
+texture 1.0 0.500000 material material material
+vertex material 0.500000
+vertex texture texture vertex
+= frame anim texture
+-1 1.0 frame 0.500000
+1.0 anim
+frame -1
+anim
+vertex = bone anim
+-1 -1 = anim 1.0 frame 0.500000 frame
+=
+1.0 bone -1
+anim 0.500000 -1
+material vertex frame
+= -1
+1.0 texture anim -1 material
+= vertex 0.500000
+anim bone = 1.0
+vertex material
+texture
+vertex -1 -1
+0.500000 frame 0.500000 frame bone = frame
+vertex vertex texture
+texture
+texture 1.0 1.0 bone
+material
+anim
+=
+=
+texture
+material
+= frame 1.0 -1 anim frame -1 bone 1.0 bone vertex material
+anim texture
+0.500000
+anim
+frame -1 material 0.500000 vertex vertex 1.0 1.0 bone
+vertex 1.0 vertex texture
+material bone vertex anim
+= anim = frame vertex 0.500000
+vertex
+vertex
+anim 1.0 texture -1 anim anim texture -1
+= texture vertex
+frame 0.500000
+1.0 1.0
+anim = texture
+frame
+1.0 vertex bone
+= texture -1
+= = anim texture 1.0 bone 1.0 -1 anim material bone 1.0
+-1
+0.500000 bone
+material frame
+1.0 frame vertex texture -1
+anim = anim texture 0.500000 frame material 1.0 vertex frame 1.0 1.0 -1 bone 0.500000 anim material material material
+-1 1.0 anim -1
+0.500000 anim material = texture = 0.500000 = 1.0 anim frame bone vertex 1.0 anim frame bone material
+bone anim -1 vertex
+= material texture
+= vertex texture bone 1.0
+1.0 material
+0.500000 vertex material
+material
+0.500000 texture vertex anim
+bone
+-1 anim
+0.500000 frame 0.500000 = 1.0 0.500000
+anim 1.0 =
+bone anim frame = 1.0 0.500000 bone 1.0
+-1
+= texture 1.0 material
+vertex
+1.0 material anim 1.0 material vertex material 1.0 bone anim texture 0.500000
+0.500000 frame 0.500000 bone texture material
+-1 0.500000 material anim vertex -1 bone material texture =
+0.500000
+vertex material 0.500000 = 0.500000
+frame = -1 1.0
+material 0.500000 frame = 1.0 material material frame vertex
+bone 0.500000 -1 texture
+-1 material
+1.0 1.0 -1
+0.500000 texture 0.500000 material
+bone -1 0.500000 =
+anim bone bone anim anim bone 1.0
+-1 frame material = material
+texture
+texture bone bone -1 1.0 texture
+1.0 1.0 frame
+frame = vertex anim bone
+1.0 vertex anim
+vertex
+= anim
+0.500000 -1 -1
+-1 -1
+material = anim = -1
+-1
+frame -1 texture bone 0.500000 0.500000 bone bone
+material
+frame texture
+anim frame vertex vertex
+1.0 material material 0.500000 bone =
+anim 1.0
+bone
+-1
+-1 material bone -1 anim anim vertex =
+texture
+= anim
+texture -1 frame vertex
+0.500000 0.500000 1.0
+bone =
+frame 1.0
+anim bone anim
+bone texture
+= texture 0.500000 texture frame texture 0.500000 texture 1.0 -1
+0.500000 bone 0.500000 texture
+bone
+frame vertex frame 1.0
+bone
+anim frame
+frame anim vertex vertex 1.0
+1.0 0.500000 0.500000 = -1
+0.500000 texture texture bone 0.500000 frame 1.0 0.500000 =
+bone
+material -1
+1.0 frame
+anim -1 bone 1.0 bone 1.0 texture
+bone frame frame material
+1.0 vertex material frame texture -1 =
+texture material bone -1 anim -1
+-1 1.0 frame
+-1
+texture = anim
+texture anim 0.500000 texture
+anim
+0.500000 vertex
+bone
+bone
+material -1
+0.500000 -1 vertex
+= = -1
+= anim -1 frame anim material 1.0 texture
+frame
+=
+frame material = = frame -1 1.0 -1 1.0 -1 -1 bone
+0.500000
+= -1 = 0.500000
+material -1 =
+anim frame material 0.500000
+texture anim 0.500000 bone frame frame bone
+anim
+vertex -1
+1.0
+texture material
+bone
+vertex = material anim vertex anim frame = material
+frame
+0.500000
+vertex
+= 0.500000 frame -1
+texture frame
+frame
+material 0.500000 bone
+bone
+anim = = vertex
+-1 = vertex -1 1.0 = material vertex material texture anim = -1
+= material texture
+-1
+material
+-1 texture
+bone material
+= vertex vertex -1 anim anim 1.0 texture
+1.0 1.0 anim material texture texture vertex
+= bone
+vertex
+anim texture texture = vertex 1.0
+anim -1 -1 vertex
+-1 frame
+vertex -1 anim bone texture texture anim bone 1.0 -1 frame material = anim 1.0 = anim
+texture texture frame texture
+-1
+texture material
+1.0 bone -1
+bone
+=
+= bone
+0.500000
+material
+texture
+=
+0.500000
+0.500000 1.0 0.500000 anim
+anim
+0.500000 texture material
+frame
+=
+-1 frame bone -1 texture 1.0 1.0 bone bone
+material = vertex anim
+0.500000
+anim anim vertex 0.500000
+texture
+texture vertex vertex vertex frame 1.0 -1
+frame anim vertex 1.0 -1
+0.500000
+1.0
+vertex vertex
+frame 0.500000 vertex texture
+material frame texture = bone bone 1.0 = vertex material
+1.0 anim
+material -1
+1.0 material
+material vertex = 1.0 = 0.500000 anim
+frame frame material = = texture texture
+frame bone frame anim
+anim
+1.0
+-1 anim
+bone
+= 0.500000 anim
+vertex 1.0 texture
+bone = 0.500000
+anim
+vertex material
+anim -1 0.500000 material
+frame 0.500000 frame 1.0 material bone vertex 0.500000 frame 1.0
+texture anim anim texture
+frame material = frame 1.0 1.0 frame texture = -1 texture bone
+anim
+-1 material anim anim bone
+=
+= -1 anim vertex = material m
\ No newline at end of file
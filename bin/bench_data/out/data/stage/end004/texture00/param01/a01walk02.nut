@@ -0,0 +1,112 @@
+bone vertex -1 texture 0.500000 anim
+-1 bone 0.500000 =
+frame
+-1 -1 bone
+texture
+0.500000
+material anim vertex bone
+=
+-1 frame frame -1 frame =
+anim = = vertex material 0.500000 material bone
+= -1 0.500000 1.0 texture vertex frame frame frame 1.0
+material -1 material
+anim
+material texture
+= -1 frame bone 1.0 texture
+=
+texture
+texture
+vertex material = -1 texture
+vertex 0.500000
+-1
+-1 frame 1.0
+vertex -1
+anim -1 1.0 bone
+0.500000
+bone anim
+frame texture
+-1 =
+= 1.0 -1 1.0 0.500000 bone vertex
+frame bone frame
+texture vertex
+vertex vertex texture
+-1 -1
+bone
+frame 1.0
+vertex -1 -1 -1 frame material frame material vertex
+bone 0.500000 -1 -1 material frame
+=
+frame 1.0 -1 anim anim bone
+0.500000
+=
+anim frame -1 anim material
+-1
+-1
+frame
+texture material 0.500000 anim 0.500000
+0.500000 anim 1.0 vertex material =
+material
+texture material frame anim =
+material
+0.500000 texture 1.0
+bone bone anim
+= frame 1.0 anim texture anim
+bone texture anim vertex material frame -1 vertex
+vertex = texture =
+anim bone =
+0.500000 1.0 material texture 0.500000 = 1.0 0.500000 anim
+0.500000 = frame 0.500000
+material 0.500000 0.500000
+1.0 -1 = bone
+texture
+frame frame
+material 1.0 bone
+vertex
+vertex
+0.500000 frame
+anim bone texture vertex bone = =
+frame frame texture -1 material material vertex anim = vertex -1
+texture 1.0 -1 texture
+-1
+0.500000
+-1
+-1 vertex
+material vertex =
+anim material vertex 1.0 vertex
+anim
+0.500000 anim 0.500000 anim vertex anim frame = 1.0
+vertex anim frame bone material 0.500000 0.500000 texture =
+material material
+-1
+bone
+vertex material vertex vertex -1 material vertex
+-1
+bone
+1.0
+= 1.0
+= bone vertex material = frame 1.0 anim anim 0.500000 -1 bone bone bone
+texture =
+0.500000 bone texture material
+vertex frame texture material
+anim material anim texture material anim 1.0 0.500000 1.0 material frame = bone material material
+=
+= material frame -1 1.0 -1 texture
+-1
+bone = 1.0 anim frame = 0.500000 vertex
+bone = 1.0
+bone = -1
+0.500000 bone 0.500000
+bone 0.500000 material
+0.500000 1.0
+= texture
+= frame 1.0
+anim frame
+frame vertex texture = anim anim -1 material texture vertex
+vertex bone 0.500000 frame texture texture bone 1.0 -1 texture vertex 0.500000 0.500000 -1 -1 1.0 = vertex anim
+bone -1
+frame
+anim 1.0
+frame anim anim 1.0 material 1.0 texture
+0.500000 frame vertex = 0.500000 vertex frame
+texture
+texture t
\ No newline at end of file
@@ -0,0 +1,17 @@
+= 0.500000 0.500000 anim bone 1.0
+vertex material = frame
+1.0 anim -1
+= material material 1.0 texture
+bone frame 0.500000 vertex bone -1 bone 1.0
+bone =
+texture = 1.0
+0.500000 frame
+bone material material = material material = material 1.0 1.0
+=
+anim anim anim -1 bone frame
+texture 1.0 frame = 0.500000 = frame
+1.0 anim anim = frame
+-1
+-1 1.0 vertex
+1.0 frame material 0.500000
+vertex a
\ No newline at end of file
@@ -0,0 +1,7 @@
+`6iPXs@9]" cd"ކ:iՎ˛n;:?&6{=(?Ɓ-<~î*`@.li^!;܎ൺ-"lG¾fH$(Ĝ)NjߙJJ̙`7Sm&GK*e'Xӎ;FZC:Ɍɹ%6UgaA81*mhצzg,x}EP"m͑Q?CQ^RCMLSxo-J*LZ'%o+E50$-K<KSe	^
+f72e-EҏCg̩Tn<E13'2m6ui
+@ml+Qwl$4G)-ot.Xo̧u(}ɶdy+ٮk$@`A"}<ƖkrD" :\9ESE1wuip_گ9-*L(/2?56݉ rRǪ٨,XȲn#
+G#˞lZM?}A`,2@珯iJ=}a/һ-ޅ;]/J+ؿE4P&<:I;tn-TE	C	9֊UStw$)p_@|=lQt2;m!KmtDɷS(j-J;4,;XA@qbyp%mfm,ֻHFnJغA%k6k\A;'"fe:+FCkfuv5(/S64^=D/S*T';,
+k3=rK]Rce.zl%#7}	ΖCƇ9M~Tn1WC0`R+
+erрC`Guhᠶ0G{e ǽt}>`)xV^uj2YwǢ'UZ,тS&~[+dkգyJ~ѹ6
+R{F|FWqkB>]2E(B/~Eia{FбzDṱ3T|:F:Ѓ&	|r~\Er^_{pr.Ļ{4ڷg6+V3ϒ6<N@CV_ÄWS&y8^~wͿzf"ޚO1!/\&An4EVï: ֍o.oeL]dXZJㅮwmUpi X"H$M,Keꛓb๠$hS[_fS.zMՋj `=<L,^?y?XdaXR={͙Ws""|
\ No newline at end of file
@@ -0,0 +1 @@
+tڊ=zeFD[;:Z>.n&|
\ No newline at end of file
@@ -0,0 +1,7 @@
+bone vertex anim
+texture texture
+= texture material material -1 material anim bone material
+vertex
+bone texture texture =
+-1
+-1 texture material 0.500000 frame anim texture
\ No newline at end of file
@@ -0,0 +1,127 @@
+bone
+texture 0.500000
+0.500000 0.500000 0.500000 frame texture frame anim material vertex
+1.0 0.500000 0.500000
+bone
+bone 0.500000 0.500000 = frame anim
+-1 vertex = frame
+material bone anim
+bone texture texture anim
+texture
+anim
+material 0.500000
+texture bone
+= anim bone = -1
+anim
+frame
+bone bone
+bone 0.500000
+1.0
+1.0 frame
+-1 material -1 bone material material
+vertex = anim
+bone 1.0 1.0
+anim 1.0 frame
+bone
+bone texture
+texture 0.500000 bone
+vertex material material vertex -1 material
+frame 1.0
+0.500000 0.500000 1.0 vertex
+-1 = frame =
+1.0 1.0 texture frame frame anim texture
+vertex 0.500000 vertex -1 0.500000 vertex
+1.0 -1
+1.0 anim anim bone 1.0 vertex -1
+-1 material vertex bone 0.500000 bone 1.0 1.0 0.500000
+= 0.500000 frame bone material = bone anim -1 -1 0.500000 texture anim -1 material
+bone frame frame
+0.500000 frame texture 0.500000 = = anim material material bone vertex 0.500000
+vertex vertex vertex
+vertex
+vertex 1.0 1.0 0.500000 frame -1
+material -1 material 1.0
+0.500000 anim texture
+=
+frame material material frame anim material = = -1 frame 0.500000 anim vertex material bone bone
+= material frame vertex -1 material frame
+1.0 0.500000 vertex vertex
+frame -1 bone
+frame
+-1
+= vertex
+texture anim
+0.500000 frame frame bone 0.500000
+material 1.0 0.500000 material material
+frame -1 frame -1 anim -1 material vertex
+texture
+anim bone = material frame
+0.500000 bone bone vertex = 1.0
+texture material
+0.500000
+0.500000 anim 0.500000 bone frame -1 1.0 bone = frame
+vertex vertex bone vertex material 0.500000 -1 texture texture
+=
+= texture
+frame
+material texture frame 1.0 anim = vertex
+material frame 0.500000
+anim
+=
+= -1 anim material material 0.500000 1.0 material
+vertex
+= bone vertex bone
+anim bone
+anim
+vertex 1.0 =
+anim bone 1.0 vertex
+texture
+material bone bone
+= = -1 material frame material material
+frame -1 vertex -1 0.500000 vertex
+anim anim 0.500000 texture
+vertex =
+anim anim frame frame 0.500000 material -1
+1.0 anim frame 1.0 vertex
+-1 vertex = vertex =
+vertex 0.500000 1.0 texture bone frame 1.0 material = material anim 1.0 texture -1 vertex vertex = frame
+0.500000 frame 1.0 anim
+0.500000 material -1 texture
+frame
+vertex vertex 0.500000 = vertex bone frame -1 material bone 0.500000 vertex -1 1.0 anim material
+bone texture bone material material 0.500000 -1 -1 =
+bone 0.500000 anim -1 texture bone vertex vertex
+bone =
+bone
+material texture 0.500000
+material texture anim -1 frame
+texture
+bone
+vertex bone 0.500000 texture frame material frame
+material -1 anim 1.0 vertex = 1.0 anim
+= vertex bone 0.500000
+-1 0.500000 texture -1
+bone material = bone texture bone material
+bone
+texture frame = -1 anim
+bone
+-1 0.500000 bone anim
+1.0 -1 0.500000 material texture = bone 0.500000 =
+bone =
+material texture -1
+1.0 1.0 vertex frame
+-1 frame
+vertex
+0.500000 =
+frame
+1.0
+= texture 0.500000 frame anim material 1.0 material 1.0 material
+bone
+bone 1.0
+anim 0.500000 anim
+material = texture
+0.500000 bone 1.0
+vertex
+-1 1.0 -1
+material texture frame
+vertex vert
\ No newline at end of file
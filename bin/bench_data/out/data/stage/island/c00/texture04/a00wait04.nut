@@ -0,0 +1,3 @@
+material
+0.500000 vertex = 0.500000 = 1.0 -1 0.500000 -1 texture material texture
+= 1.0 t
\ No newline at end of file
@@ -0,0 +1,8 @@
+material
+frame
+-1 0.500000
+1.0 frame
+vertex bone
+1.0
+= vertex 0.500000 =
+frame
\ No newline at end of file
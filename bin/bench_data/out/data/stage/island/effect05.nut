@@ -0,0 +1,5 @@
+= vertex vertex
+-1 -1 1.0
+= bone 0.500000
+vertex
+vertex material bone texture vertex frame fr
\ No newline at end of file
@@ -0,0 +1,344 @@
+1.0 vertex
+vertex 1.0
+anim
+frame
+= -1
+texture bone material
+-1 1.0 texture 0.500000
+texture material -1
+anim = vertex
+bone =
+anim anim
+frame vertex = material frame bone frame vertex bone frame texture bone
+texture
+frame frame =
+1.0
+material 0.500000 material texture bone vertex -1 frame frame material texture frame material frame material frame 1.0
+1.0 -1 vertex
+= bone
+-1
+-1
+-1 bone 1.0 material 0.500000 anim frame =
+anim -1
+bone material material anim
+1.0 material bone
+bone material anim material = anim
+1.0 material material
+anim frame
+material texture material
+bone bone material
+vertex
+frame =
+frame vertex vertex
+material
+anim
+bone = vertex 0.500000
+1.0
+= bone vertex = 0.500000 bone = texture anim 0.500000 0.500000 anim 0.500000 = frame anim
+texture 1.0 material
+0.500000
+material
+anim
+bone frame
+1.0 0.500000
+0.500000
+bone
+0.500000 frame anim -1 0.500000 0.500000 anim texture vertex material frame anim =
+material texture
+vertex =
+1.0 anim = frame anim frame -1 1.0 vertex texture 1.0
+-1 material material bone frame bone 1.0 bone
+=
+vertex texture =
+vertex material
+anim 0.500000
+frame 1.0 frame anim texture
+= anim 1.0 material
+anim
+texture
+anim
+0.500000
+0.500000
+vertex anim material -1 material =
+-1 -1 0.500000 texture bone
+bone bone frame -1 vertex
+anim 1.0 texture frame texture 1.0
+anim frame vertex vertex material bone
+anim 0.500000
+0.500000
+1.0 frame frame 0.500000 -1 anim vertex
+anim -1 1.0
+1.0 1.0 material 0.500000 =
+material bone vertex
+-1 bone bone frame
+texture anim frame vertex 1.0 anim bone 0.500000 frame vertex texture material -1 1.0 material
+=
+anim
+bone 0.500000 vertex frame anim texture material material -1
+vertex =
+texture 0.500000 texture
+= 1.0
+bone
+frame texture anim =
+vertex 0.500000 frame
+anim vertex = material vertex -1 = frame texture 0.500000
+bone bone texture texture material anim 1.0 vertex frame anim
+material =
+1.0 vertex vertex
+= material texture
+= texture
+texture vertex 1.0
+-1 1.0 bone 0.500000
+frame anim 1.0 0.500000 0.500000 frame = frame 0.500000 0.500000 -1
+=
+vertex bone bone -1 0.500000 0.500000 texture
+= texture
+-1
+-1 -1
+-1
+frame 1.0 frame = 1.0 0.500000
+1.0 1.0 1.0
+= vertex material 1.0
+anim anim
+-1 0.500000
+material texture material 1.0
+vertex
+material = vertex
+0.500000 = = vertex =
+vertex
+vertex frame 1.0
+1.0
+material 0.500000
+texture anim anim anim material material
+anim bone = frame
+frame texture
+0.500000 anim -1 bone =
+1.0 -1
+bone anim bone
+-1 0.500000 -1 1.0 vertex -1
+bone =
+texture 0.500000 1.0 vertex frame bone anim texture frame frame 1.0 material material material texture material
+bone
+frame = -1 -1 vertex material frame frame bone
+anim
+anim
+vertex 0.500000 material
+texture texture
+= texture
+anim
+material material
+vertex 1.0 material bone
+vertex anim anim
+0.500000 bone anim =
+frame
+frame
+anim
+texture material material = 1.0 bone anim frame material
+texture
+anim material anim
+0.500000 bone anim texture frame -1 bone -1 bone 0.500000 -1 1.0
+1.0
+material
+0.500000
+texture texture
+vertex bone vertex
+frame material vertex bone 1.0 -1 = -1 texture
+frame 1.0
+frame texture vertex frame
+0.500000
+material -1 anim anim = frame frame
+bone
+material material vertex 1.0 anim
+-1 -1 anim texture
+frame material vertex anim
+= anim 0.500000 bone vertex material 1.0
+-1 anim bone vertex texture
+0.500000 vertex
+1.0 material -1 0.500000
+bone -1
+vertex 1.0
+= material texture
+1.0 = 1.0 0.500000 -1 0.500000 material vertex
+-1
+-1
+0.500000 1.0 texture material
+vertex
+texture -1 0.500000 anim -1 0.500000
+frame material vertex = -1 anim material 1.0 1.0
+frame frame
+anim frame bone 0.500000
+anim
+= 1.0 frame
+frame 1.0 frame
+0.500000 1.0 bone bone texture 1.0 -1 = bone 0.500000 frame 1.0 frame -1 =
+texture frame material
+vertex 1.0 material bone
+-1 material
+anim
+= 0.500000 1.0 0.500000 0.500000 -1 1.0 bone
+frame 1.0 1.0 anim texture texture
+0.500000
+= = =
+1.0 anim bone
+frame bone 1.0 = 0.500000
+-1 texture
+texture -1
+texture bone
+-1
+1.0 vertex material = texture = bone = vertex
+anim texture material anim bone 0.500000 0.500000 bone frame
+0.500000 1.0 material vertex texture anim vertex
+material vertex anim vertex
+material vertex =
+0.500000 = vertex = vertex =
+= = -1 1.0 = -1 0.500000 1.0 material 0.500000
+texture texture bone
+frame frame material vertex
+material = = texture material vertex
+frame
+material
+frame bone vertex
+=
+1.0 anim bone frame frame
+-1
+bone
+bone texture anim
+0.500000 0.500000 bone bone vertex texture = -1 bone
+material
+= = texture = 0.500000 frame anim = -1 texture bone frame frame 0.500000 vertex
+vertex texture vertex 0.500000
+= 0.500000 material bone 1.0 texture material
+0.500000 frame texture
+material -1 0.500000 = material texture vertex anim -1
+texture anim 1.0
+-1 texture texture
+texture bone 1.0 anim texture texture -1
+=
+material anim texture frame bone bone anim frame 0.500000 texture 1.0 bone anim vertex
+texture -1
+frame bone 1.0 vertex
+texture anim
+vertex anim frame
+1.0 0.500000 anim
+1.0 vertex
+material vertex
+vertex
+material material -1 -1
+1.0 anim
+1.0 1.0
+material
+vertex
+0.500000
+vertex
+vertex 1.0 anim
+frame = 0.500000
+vertex bone bone frame
+frame = -1 -1 =
+= anim
+texture anim vertex 0.500000
+texture anim bone 1.0 1.0 anim bone texture anim
+texture
+0.500000 anim texture texture vertex
+= anim texture material texture
+-1
+anim bone material = material = -1 0.500000
+-1 -1 material
+bone 0.500000 frame texture -1 frame
+bone vertex
+anim 1.0 -1
+vertex -1
+0.500000 =
+= anim anim anim texture 1.0 = = -1 texture = anim
+= 0.500000
+0.500000 bone
+frame frame
+texture frame texture 0.500000 frame frame material frame 1.0 -1
+texture bone material
+bone 1.0
+1.0 vertex 0.500000
+anim frame vertex vertex
+= 0.500000 anim
+frame frame = -1
+0.500000 texture
+0.500000 material = = texture -1 bone anim -1
+texture
+-1 0.500000 1.0 bone
+material texture
+material
+anim
+1.0 =
+texture material
+frame
+texture
+= bone anim frame 1.0 frame
+= material
+frame anim anim
+frame vertex
+anim anim
+-1 bone -1
+anim
+anim
+vertex
+bone
+material
+anim 0.500000 bone 0.500000 = anim texture bone -1 frame -1
+0.500000
+anim texture material anim 1.0 1.0 frame 1.0
+texture -1 = texture material bone 1.0
+= bone anim vertex 1.0 vertex material bone material
+texture texture = 1.0 -1
+bone 0.500000 bone = = =
+bone vertex
+material
+-1 anim -1
+= material
+= material frame
+-1
+vertex
+material = bone frame vertex
+material bone texture -1 material 0.500000 texture 1.0 frame
+texture texture
+material
+texture anim 1.0
+material 0.500000 -1 texture bone vertex material texture
+frame = anim
+bone material vertex bone
+vertex 1.0
+0.500000 1.0 -1 bone 0.500000 0.500000 frame 0.500000 = =
+frame -1
+0.500000 vertex = texture
+0.500000 0.500000
+texture 0.500000 anim
+frame -1
+vertex bone vertex vertex 0.500000 0.500000 anim
+frame texture
+texture =
+0.500000
+anim material -1 -1 = vertex frame -1 frame
+= frame =
+bone vertex -1 bone frame 1.0 texture material 1.0 frame =
+anim -1 0.500000
+-1
+frame
+1.0
+bone
+-1 -1 1.0 frame
+texture
+0.500000 material bone 1.0 bone = bone texture texture vertex anim vertex
+material vertex material -1 0.500000
+1.0
+anim texture 1.0 texture = anim
+material
+1.0 texture
+-1
+-1 material frame bone -1 vertex bone 0.500000 1.0 1.0
+=
+-1 texture -1 material
+bone -1 frame bone
+0.500000 vertex bone material texture material
+material = vertex -1
+-1 material
+frame 1.0 vertex = 1.0 texture texture material
+= material -1 bone bone
+frame material
+bone frame frame 0.50000
\ No newline at end of file
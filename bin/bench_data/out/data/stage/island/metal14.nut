@@ -0,0 +1,21 @@
+vertex 1.0 frame anim -1
+1.0 1.0 bone anim frame anim
+0.500000 0.500000 -1 vertex texture anim 1.0
+=
+texture 1.0 texture 0.500000 frame
+=
+vertex
+0.500000 0.500000
+anim 1.0 1.0 material texture anim -1 bone =
+anim material texture
+bone 0.500000
+0.500000
+0.500000 vertex
+texture = frame 1.0 material
+material anim texture frame = vertex -1
+-1
+-1 frame vertex 1.0 texture vertex 0.500000 1.0 vertex
+material frame -1 vertex bone 0.500000 frame -1 material -1
+anim texture 0.500000 = frame anim
+0.500000 1.0 anim =
+0.5
\ No newline at end of file
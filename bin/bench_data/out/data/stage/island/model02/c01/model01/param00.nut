@@ -0,0 +1,77 @@
+0.500000
+anim
+texture 0.500000 anim vertex anim bone 1.0
+texture
+frame =
+anim
+0.500000 texture frame 1.0 vertex -1 frame material frame 0.500000 texture 1.0
+frame frame 1.0 1.0 texture frame vertex frame
+frame material 1.0 material -1 anim
+frame
+bone vertex vertex material 0.500000 0.500000 -1 bone anim 1.0 bone vertex
+anim
+0.500000
+-1 = vertex -1 anim
+anim
+0.500000 0.500000 bone 1.0
+1.0 texture
+vertex
+= anim -1 vertex
+vertex anim 1.0
+bone
+= vertex
+frame texture frame
+material
+texture = vertex
+texture
+0.500000 = texture -1 texture texture
+-1 anim texture texture frame
+frame anim texture material bone = anim vertex = = anim 0.500000
+vertex
+vertex 1.0
+vertex
+frame -1 material = -1 texture texture vertex
+material 1.0 vertex vertex material bone material
+anim bone 1.0
+texture
+vertex bone 0.500000
+0.500000 1.0 = -1 bone 0.500000 = frame
+texture =
+frame = = vertex -1
+0.500000 frame -1 1.0 material 0.500000
+0.500000 anim material
+vertex material 0.500000 1.0 frame 1.0
+1.0 -1
+0.500000
+material = texture vertex -1 anim
+vertex vertex
+1.0 bone
+-1 bone anim 0.500000 vertex vertex anim
+bone anim
+vertex material vertex 1.0
+-1 0.500000 vertex 0.500000
+anim vertex vertex
+-1
+anim 0.500000 material 1.0
+frame = =
+=
+1.0 0.500000 -1 0.500000
+bone texture texture -1
+bone material = 1.0
+= = frame texture
+vertex 1.0
+texture 1.0
+frame bone
+texture texture -1
+vertex
+frame bone
+-1 frame -1 vertex anim -1 texture
+bone
+0.500000
+frame vertex vertex texture -1 -1
+-1
+1.0 bone
+material 1.0 frame = material vertex
+frame = texture vertex bone material bone frame 0.500000 texture material -1
+= 1.0 1.0
+-1 frame -1 -1 anim anim ve
\ No newline at end of file
@@ -0,0 +1,34 @@
+frame
+-1
+-1 texture 0.500000
+material frame
+= frame =
+frame -1
+frame
+0.500000
+1.0
+vertex frame
+-1 frame 1.0
+1.0 vertex bone anim frame frame anim 1.0 texture vertex
+frame texture
+bone bone
+texture =
+texture anim
+frame
+=
+=
+frame texture vertex 0.500000 1.0 anim frame texture
+0.500000 frame texture
+texture vertex bone 0.500000 vertex material 1.0 =
+anim = 0.500000 vertex texture
+-1 1.0
+0.500000 1.0 = 0.500000
+texture
+anim texture texture -1 1.0
+0.500000
+anim
+1.0 =
+material
+vertex material anim -1 frame material bone =
+texture =
+texture a
\ No newline at end of file
@@ -0,0 +1,8 @@
+material
+bone
+texture 0.500000 bone frame vertex frame frame = anim = = texture material
+1.0 material -1 = 1.0 anim
+= anim vertex
+texture vertex 0.500000
+1.0 frame material
+anim = -1 material bone -1 0.50000
\ No newline at end of file
@@ -0,0 +1,35 @@
+-1 anim material vertex
+frame
+vertex material =
+anim bone
+0.500000 -1 vertex 1.0 -1 material
+texture material -1 = frame anim vertex = -1 = =
+bone vertex
+0.500000 1.0 texture frame
+texture
+texture
+texture
+anim texture -1 bone 0.500000 material
+-1
+material 0.500000 =
+0.500000 -1 frame 1.0 vertex material
+material
+texture 0.500000 -1 1.0 vertex
+-1
+bone frame texture
+frame
+0.500000 frame
+material -1 material 0.500000 material
+frame -1
+frame -1
+material frame anim
+-1 1.0 1.0 frame anim texture material 1.0 0.500000 0.500000 material
+-1
+= texture material anim
+0.500000 bone
+vertex
+=
+frame 0.500000
+texture material texture texture frame
+frame material
+ani
\ No newline at end of file
@@ -0,0 +1 @@
+/JP^2ves1į"|>>8ùܬYz%.4vUhD'Ӂ-#쮇~=Vduk]lU̎}d=ļ*i1@;_f
\ No newline at end of file
@@ -0,0 +1,76 @@
+vertex = -1 =
+-1 texture -1
+frame 0.500000 anim vertex
+= frame
+= = = -1 texture 1.0
+texture 1.0 bone texture = -1 texture
+vertex bone 1.0
+material
+1.0
+-1
+-1 anim
+0.500000 anim
+= = bone anim 1.0 0.500000
+vertex vertex 1.0 0.500000 frame vertex 0.500000
+frame
+anim texture
+frame bone =
+= texture bone texture -1 anim -1 texture frame
+1.0 frame 0.500000 -1
+0.500000 anim
+anim anim
+frame material -1
+1.0
+=
+= anim vertex anim texture
+bone
+= material -1
+texture bone 1.0
+anim
+material vertex frame bone texture bone 1.0 texture vertex material texture
+0.500000 1.0 anim -1
+material
+frame frame 0.500000 texture vertex
+= texture
+= bone -1
+anim = = 0.500000 texture bone 0.500000 -1 1.0 texture =
+vertex =
+anim 1.0 -1 0.500000
+1.0
+1.0
+0.500000 material
+-1 -1 bone frame anim = frame vertex
+0.500000 anim
+bone
+anim anim
+bone bone vertex = -1
+0.500000
+bone bone = 1.0 bone
+-1
+bone
+-1 texture
+material anim texture
+anim texture
+texture
+frame 1.0 material texture -1 0.500000 1.0
+texture vertex anim 1.0 0.500000 1.0 texture bone material frame bone 0.500000
+0.500000 vertex texture bone -1 vertex
+frame
+vertex vertex =
+= frame bone anim
+1.0
+1.0
+= = -1 -1 vertex
+-1 vertex -1 material vertex -1 anim 0.500000 texture -1 anim vertex 0.500000 vertex anim
+anim
+anim = material frame vertex
+0.500000 anim = bone
+anim texture -1 material
+= -1
+vertex 0.500000 vertex material material 0.500000 bone = anim
+= frame texture
+-1 material bone
+bone -1 = vertex
+frame
+anim texture
+= -1 0.500000 -1
\ No newline at end of file
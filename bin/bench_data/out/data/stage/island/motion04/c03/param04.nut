@@ -0,0 +1,24 @@
+anim -1 =
+-1 vertex
+texture
+material = material frame frame 0.500000
+bone
+1.0 frame -1 0.500000 vertex -1 0.500000 texture material anim 1.0 1.0
+=
+frame
+1.0
+1.0 material anim
+bone
+anim
+frame anim 1.0
+0.500000
+material -1 bone
+-1 0.500000
+vertex
+vertex bone 1.0 anim
+0.500000 frame bone 0.500000
+= frame
+-1 anim -1
+0.500000 -1
+bone frame
+anim 0.500000 0.500000 1.0 fra
\ No newline at end of file
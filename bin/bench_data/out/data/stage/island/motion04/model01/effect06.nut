@@ -0,0 +1,47 @@
+anim
+material frame 1.0
+bone
+frame 1.0 frame bone
+-1 1.0 frame
+0.500000 material bone bone = bone =
+-1 vertex 0.500000 bone 0.500000 texture anim material
+anim texture
+anim
+bone texture
+1.0
+-1 0.500000 = texture vertex = texture 0.500000 vertex bone material 0.500000 texture texture =
+texture 0.500000 vertex
+anim bone
+material -1 -1
+= anim =
+-1 -1 -1
+texture 1.0 frame -1 1.0
+texture
+texture -1 material = 1.0 -1
+material =
+=
+anim
+-1 anim 1.0 material material frame
+frame frame vertex
+anim
+texture frame vertex texture texture anim bone =
+material
+texture anim material material material -1 -1 material material texture texture 1.0 vertex -1 material frame frame 0.500000 texture frame texture
+bone = anim anim
+material 0.500000
+-1 1.0
+texture frame
+anim material
+material texture
+bone = bone -1 material = anim
+0.500000 material 1.0 texture frame 0.500000 1.0
+-1 = frame 1.0 = anim anim 1.0 material anim
+frame vertex 1.0 -1 frame anim anim frame frame texture frame -1 0.500000 vertex
+anim
+vertex -1
+anim vertex texture =
+anim material
+material bone texture material vertex anim vertex -1 = texture material anim 0.500000 frame
+bone
+vertex
+anim 0.50000
\ No newline at end of file
@@ -0,0 +1,57 @@
+texture
+0.500000 -1 = frame anim bone bone vertex vertex anim vertex texture bone frame anim frame
+vertex frame 1.0 anim texture
+material
+1.0 material -1 0.500000 0.500000 0.500000
+vertex -1 -1 1.0
+-1
+-1
+1.0 texture
+bone bone bone vertex 0.500000
+material frame bone material
+bone 1.0 = vertex =
+frame
+1.0 frame frame
+anim material anim anim 1.0 = bone frame texture
+bone
+1.0 frame material
+bone 0.500000 material 1.0
+1.0
+1.0 frame
+anim = -1
+vertex vertex material 0.500000
+-1 vertex frame
+vertex
+vertex
+0.500000
+1.0 frame
+0.500000 texture =
+anim anim anim
+= texture texture
+vertex
+0.500000 =
+= =
+1.0 -1 = =
+anim
+0.500000 = anim = =
+texture bone material
+material material
+frame =
+material vertex texture texture vertex material
+anim = bone texture bone anim
+anim frame
+-1 vertex material
+material = vertex frame
+material bone -1 bone -1 frame vertex =
+frame frame frame material frame 1.0 bone anim frame
+bone texture
+anim 1.0 texture = texture
+-1 = texture
+bone
+-1
+frame anim texture anim material 0.500000
+= vertex vertex bone = 0.500000 -1 frame
+material anim 1.0
+vertex
+1.0
+anim anim 0.50
\ No newline at end of file
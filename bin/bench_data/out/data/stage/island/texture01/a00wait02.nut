@@ -0,0 +1,36 @@
+0.500000 -1
+= material material vertex frame -1 vertex vertex
+vertex 1.0 vertex
+-1
+bone = bone 1.0 anim frame texture 0.500000 texture texture 0.500000 = texture -1
+1.0 vertex -1 anim texture -1 material
+-1
+anim 1.0 texture texture
+material anim material 1.0 vertex bone 1.0 frame vertex = -1
+vertex vertex 1.0
+texture anim -1 0.500000 texture
+texture -1 vertex
+anim = 0.500000 vertex
+frame anim
+anim
+= material texture anim
+bone material material material anim 1.0
+material texture -1
+anim -1
+anim
+= 1.0 bone
+anim
+1.0 anim = texture material = = texture -1
+-1 -1 1.0
+texture frame
+texture anim vertex
+anim
+texture
+material = material texture
+texture 0.500000
+material
+1.0
+1.0 anim 1.0 anim material frame 1.0 1.0 anim material material frame vertex
+frame
+material = texture
+frame frame anim 1.0 1.0 1.0 -1 anim = 
\ No newline at end of file
@@ -0,0 +1,319 @@
+texture 1.0 anim bone
+1.0 material anim
+= vertex bone bone
+bone bone -1
+bone material 1.0
+vertex 0.500000 bone
+anim =
+1.0 texture 1.0 frame = = texture material
+vertex
+vertex anim anim material
+material
+frame 0.500000 anim
+1.0
+1.0 -1
+vertex texture anim 0.500000
+= 0.500000 texture 0.500000 frame texture material
+texture material -1
+-1 frame texture texture
+anim = -1 0.500000
+vertex -1
+texture
+vertex 0.500000 0.500000 frame bone bone 0.500000 0.500000 0.500000 anim 0.500000 bone texture material texture anim = 0.500000 -1
+bone frame
+material =
+material 1.0 material = vertex frame
+0.500000 material -1 =
+frame
+vertex vertex
+anim
+bone 0.500000 anim vertex
+0.500000
+frame anim texture bone texture
+-1 material -1 material texture frame material
+bone -1 1.0
+=
+texture texture texture 1.0 = texture
+frame texture texture 1.0 vertex = material -1 1.0 = 1.0 texture = = bone texture -1 1.0
+anim 0.500000 bone
+bone = = 1.0 texture
+=
+bone
+vertex material
+1.0 -1
+anim material vertex = 1.0 texture frame
+material frame bone 1.0
+0.500000 0.500000 -1 texture bone 1.0 = 1.0 0.500000 0.500000 anim -1
+0.500000 1.0 bone frame
+anim 1.0 bone anim
+1.0
+= anim texture bone -1 0.500000 anim anim texture
+1.0
+1.0
+texture texture frame bone
+= material 0.500000 vertex vertex
+texture
+1.0 material = = texture bone
+texture 1.0 1.0 = material 0.500000 vertex
+bone -1 texture anim texture frame
+texture 0.500000 texture vertex frame bone frame 0.500000 frame texture 1.0 = = bone anim material
+bone vertex 1.0
+vertex =
+vertex 1.0 1.0 frame texture =
+1.0 anim -1 1.0 -1 =
+bone vertex
+frame 1.0 = vertex anim bone
+1.0
+= bone
+bone vertex
+= material = -1
+1.0 frame
+bone
+vertex material
+1.0
+frame
+0.500000
+frame bone vertex 0.500000 frame anim material anim
+= -1 material texture 1.0 =
+vertex -1
+bone 1.0 material frame vertex
+bone frame 1.0 frame 1.0 vertex 1.0 =
+anim vertex texture
+anim
+anim
+0.500000
+-1 texture = 1.0 material
+-1 texture vertex
+1.0
+0.500000 material vertex bone anim texture = = bone anim = material 1.0 1.0
+frame frame vertex
+vertex texture
+= 1.0 1.0 -1 0.500000
+bone -1 -1 texture -1 frame 0.500000 -1 vertex texture material bone = bone bone frame bone vertex bone
+texture anim
+frame -1 texture
+-1
+vertex
+0.500000 bone = texture
+vertex
+material anim 1.0 frame
+frame vertex 0.500000
+frame
+frame vertex material 0.500000 0.500000 frame
+vertex
+-1 bone = material -1 texture bone anim bone bone
+material
+material -1 bone
+texture
+texture material texture material
+texture
+1.0 vertex
+material texture material material
+vertex anim material bone -1 frame = anim 1.0 -1 texture texture material texture vertex texture 0.500000 material -1
+bone bone
+= bone
+1.0
+vertex = texture -1 material anim vertex frame
+anim = material = -1 texture vertex material -1 material vertex
+1.0 material material frame texture 0.500000 texture = -1 vertex frame anim
+bone material texture
+anim 1.0
+= frame
+frame 0.500000 bone
+= texture
+material
+frame
+texture texture 0.500000 frame
+= frame
+texture
+anim anim frame -1
+vertex
+bone -1 frame bone
+anim 1.0 -1
+-1 0.500000 0.500000 vertex 0.500000 material frame anim -1 vertex bone 1.0 anim bone anim
+vertex frame texture
+0.500000
+material material bone anim material frame anim 1.0 -1 bone = -1 0.500000
+= frame material 1.0 1.0
+= anim
+bone
+= bone frame 1.0 -1 0.500000 -1 -1 material
+vertex bone
+frame
+-1 bone vertex vertex = texture -1 vertex texture texture
+bone vertex
+anim anim
+bone vertex 0.500000
+1.0 -1 texture 1.0
+texture frame anim
+1.0 1.0 0.500000 frame 1.0 frame anim frame bone frame 0.500000
+vertex anim
+-1 texture
+1.0 1.0
+frame anim frame 0.500000 1.0
+anim 0.500000 1.0 vertex anim
+-1 -1 anim material -1 0.500000 1.0 texture 0.500000 1.0
+texture
+frame vertex
+vertex 0.500000
+1.0
+anim 1.0 frame
+bone 0.500000 frame texture material anim
+frame
+-1
+1.0 anim texture -1
+material vertex
+1.0
+1.0
+1.0
+frame 0.500000 -1 frame = anim material
+material = texture anim material
+0.500000 -1 texture =
+material material anim anim -1 anim
+texture = 0.500000
+texture texture anim texture
+anim material material texture -1
+vertex 0.500000 =
+anim
+bone 0.500000 bone 0.500000 anim =
+0.500000
+anim texture material 1.0 bone texture
+0.500000 0.500000 vertex texture frame vertex
+0.500000 anim
+texture 1.0 bone bone frame
+0.500000 1.0
+frame
+material = = anim
+-1 anim material
+0.500000 1.0 -1 1.0 1.0 -1 bone material frame -1 frame
+0.500000 material vertex bone
+anim material
+bone frame bone -1 vertex = bone vertex material vertex = bone material bone material
+anim frame
+bone = vertex
+frame
+bone
+-1
+bone =
+bone
+bone =
+= bone anim 1.0 0.500000 =
+0.500000
+anim -1 1.0 0.500000 material
+vertex 0.500000 anim 1.0 bone anim -1 bone
+1.0 anim
+-1 material anim 1.0 1.0 =
+1.0
+anim vertex anim = material anim vertex frame
+vertex bone material
+frame 0.500000
+1.0
+anim texture 1.0 1.0 material
+material anim
+material
+= material 1.0 texture 0.500000 vertex 0.500000 0.500000 anim bone frame vertex
+vertex 1.0 vertex frame = texture 0.500000 1.0 texture
+1.0 texture vertex 0.500000 0.500000
+vertex material bone vertex bone frame -1 texture
+= 0.500000
+bone
+frame = = -1 anim
+vertex
+anim anim texture texture
+-1 frame vertex 1.0
+frame bone
+vertex = texture = anim material vertex anim
+frame 0.500000
+frame texture 0.500000 vertex
+frame bone frame bone
+texture texture 1.0 1.0 bone -1 -1 vertex -1
+material
+anim 1.0 frame anim anim material
+texture frame 0.500000 frame
+vertex frame bone = frame texture vertex frame 0.500000
+1.0
+0.500000 bone -1 -1
+material bone
+anim
+= vertex
+texture vertex
+frame bone
+=
+bone texture bone = 0.500000 frame texture
+0.500000 0.500000 texture
+0.500000 vertex 1.0
+vertex anim
+vertex 0.500000 texture =
+material anim
+1.0 0.500000
+vertex vertex = bone
+0.500000 frame material frame texture 1.0 -1 0.500000 bone material texture anim = texture = frame vertex = material
+texture frame texture vertex frame
+bone vertex anim material 0.500000
+-1
+vertex 1.0 1.0
+0.500000
+0.500000
+bone -1
+0.500000 1.0 = bone texture
+texture bone
+= vertex 1.0
+= 1.0 texture 1.0
+texture
+bone -1 material
+material vertex 0.500000 =
+frame
+texture
+anim
+bone vertex bone texture
+frame 1.0
+1.0 1.0 1.0 material 1.0
+-1 bone 0.500000 vertex anim
+texture
+=
+-1 anim anim vertex bone texture 1.0 0.500000 texture material 0.500000 0.500000 anim 0.500000 vertex frame = texture
+material texture
+1.0
+-1 material anim material frame
+=
+=
+vertex
+=
+vertex bone 1.0
+= anim 0.500000 = frame anim = = = material 0.500000 0.500000 material
+frame 1.0
+anim = 1.0 bone
+frame vertex anim 1.0 -1 anim
+texture 0.500000 material frame 0.500000 bone frame
+frame
+= = = = frame
+1.0 anim frame vertex anim = 0.500000 vertex anim material
+texture 0.500000 anim texture
+-1 = texture frame 0.500000 texture vertex -1
+texture bone frame -1 frame -1 -1 -1 -1 -1 texture anim vertex 1.0 texture
+vertex frame bone
+0.500000
+bone 1.0 material 0.500000
+-1 -1 -1 texture anim 1.0 1.0
+texture anim
+1.0 1.0 1.0 vertex 0.500000 vertex
+bone 1.0 texture frame frame material frame
+vertex
+frame anim vertex
+vertex frame
+1.0
+material
+material 1.0 vertex
+texture
+anim
+vertex bone
+=
+vertex 1.0
+bone material = texture 1.0 bone -1 frame vertex texture
+bone frame 0.500000
+= anim bone -1
+anim texture material bone
+1.0
+bone material vertex
+vertex 0.500000 texture texture anim frame material anim texture 1.0 -1 frame anim vertex vertex
+ma
\ No newline at end of file
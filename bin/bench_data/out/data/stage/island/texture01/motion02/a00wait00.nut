@@ -0,0 +1,79 @@
+anim
+bone -1
+1.0 1.0 frame 0.500000 bone
+texture material
+0.500000
+anim vertex -1 texture anim
+1.0 =
+bone 1.0 material 0.500000 -1 1.0
+anim
+vertex material anim
+-1
+=
+1.0
+= texture 0.500000 material material vertex anim 0.500000 1.0 0.500000
+anim
+frame anim -1 frame
+vertex texture 1.0 -1 -1
+texture
+0.500000 texture
+bone =
+-1 = vertex
+vertex = = bone
+bone
+-1 bone 1.0 frame 1.0 1.0 anim 0.500000
+frame texture
+-1 -1 frame
+anim material vertex
+anim
+1.0 0.500000 material anim vertex texture material vertex 1.0
+texture
+1.0 frame frame 1.0
+vertex frame
+bone bone
+vertex = = -1 vertex texture = bone = bone material 0.500000 texture 0.500000 anim anim 0.500000 material 1.0 anim texture bone = anim vertex 0.500000 material 1.0 texture
+bone vertex frame -1
+anim = = 0.500000 0.500000
+= texture
+= material = vertex 0.500000 frame vertex frame anim
+material vertex bone
+vertex
+1.0 vertex bone texture
+bone material material 0.500000 -1 vertex
+=
+bone
+frame
+= bone
+anim
+=
+texture material -1
+0.500000 anim 1.0 material anim
+anim 1.0
+anim
+-1
+0.500000 material material
+bone 1.0 = 1.0 anim anim -1 frame
+-1 frame vertex
+= 1.0
+frame frame anim
+0.500000 anim material -1 frame texture
+-1 material texture material 1.0 0.500000 vertex = anim 0.500000 0.500000
+vertex vertex vertex material texture anim 1.0 1.0 bone
+-1 bone anim =
+=
+anim 1.0 frame
+material
+anim texture 1.0 bone vertex anim =
+= 0.500000 material texture texture bone = = 1.0 = vertex
+anim material -1 anim = = 0.500000
+0.500000
+frame frame texture
+= 0.500000 material
+material bone anim
+material
+-1 0.500000
+material 1.0
+0.500000
+material 1.0 -1
+anim
+1.0 -1 anim 0.500000 verte
\ No newline at end of file
@@ -0,0 +1,181 @@
+1.0
+-1 0.500000
+material
+frame material bone
+vertex vertex
+bone -1 1.0 1.0 1.0 vertex = frame -1 anim -1 material 0.500000 1.0 material frame
+1.0 frame 1.0 bone
+anim 1.0 = -1
+material frame
+1.0 anim frame material anim 1.0 -1 anim anim anim 1.0 vertex
+vertex = 0.500000 material 0.500000 texture
+frame
+texture anim 0.500000 -1 material texture -1
+frame
+bone anim
+1.0 = anim bone vertex vertex
+=
+0.500000 bone =
+=
+frame anim
+vertex vertex
+-1 = 1.0 = anim frame 1.0 -1 bone 1.0
+frame material
+texture vertex texture 1.0 1.0
+1.0 0.500000
+anim 0.500000 0.500000
+frame
+vertex vertex 0.500000 0.500000 -1 bone frame
+anim = vertex
+texture bone vertex vertex 0.500000 0.500000
+anim vertex bone = vertex frame frame anim vertex 0.500000
+frame
+material
+bone
+1.0
+0.500000 bone -1
+vertex 0.500000
+-1 vertex
+1.0 vertex 1.0
+= =
+anim -1 material = vertex frame 1.0 0.500000
+anim anim texture bone bone
+vertex
+vertex vertex -1 material material 1.0
+1.0 texture
+1.0 1.0 material
+0.500000 -1 -1
+material
+anim anim -1
+anim
+=
+material texture -1 texture vertex frame anim vertex
+texture material 0.500000 anim 1.0 1.0
+1.0 -1 bone
+frame
+vertex 0.500000
+= bone frame -1 material vertex -1 = frame
+frame
+1.0
+0.500000 anim
+0.500000 = 1.0 bone anim
+texture =
+texture 1.0 = 0.500000 vertex 0.500000
+= material vertex
+material frame 0.500000 0.500000
+frame texture
+1.0 anim vertex
+material material
+bone
+anim
+vertex
+material anim frame 0.500000 anim texture bone
+frame material 0.500000
+-1 material texture -1 -1 -1 -1 = 0.500000 texture bone material material 0.500000 material texture 1.0 anim -1 0.500000 -1 0.500000 anim material texture anim material vertex = texture
+-1 = 1.0 anim
+texture material texture vertex bone bone 1.0 frame -1
+0.500000 0.500000
+= material material
+material anim -1 bone texture material = texture bone vertex frame
+anim
+anim
+bone frame
+anim
+1.0 vertex vertex texture 0.500000 -1 bone anim bone -1 -1 vertex frame 0.500000 vertex 0.500000 bone
+texture vertex anim anim 0.500000 material frame -1 = material =
+0.500000 bone 0.500000
+vertex
+bone
+bone frame
+texture
+1.0 = bone
+anim material 1.0 -1
+1.0 frame -1 1.0 bone -1 anim -1 frame texture 0.500000 anim
+vertex 0.500000 material bone = material bone 1.0
+frame
+anim
+texture
+anim -1 = anim frame frame anim
+vertex bone frame bone 0.500000 vertex
+vertex -1 material 1.0
+anim vertex
+bone texture bone texture texture
+material texture
+1.0 frame frame bone
+material frame 1.0
+0.500000
+-1 bone 0.500000
+= vertex 1.0 bone material anim material anim frame
+0.500000 =
+bone = =
+frame texture
+1.0 vertex 1.0 anim
+1.0 anim
+bone frame bone anim vertex
+vertex = texture
+texture -1 1.0 material
+bone anim texture -1 bone
+-1 bone bone -1 -1 0.500000 vertex -1 -1 frame 1.0 vertex frame frame 1.0
+0.500000 1.0 anim
+vertex frame
+material bone 0.500000
+0.500000 anim frame material 0.500000 bone vertex -1 bone
+0.500000 anim frame
+texture = 0.500000 anim = = 0.500000 = -1
+texture 1.0 = anim bone vertex -1
+1.0
+vertex frame
+bone =
+-1 1.0 frame material = 0.500000 frame 0.500000 material 0.500000
+=
+= bone 1.0
+vertex -1
+-1 vertex bone 1.0 bone 0.500000 anim frame 0.500000
+= material
+vertex -1 =
+0.500000 material =
+material
+material material
+anim material
+0.500000 texture texture 0.500000 0.500000 material bone
+-1 -1
+material = 0.500000
+bone vertex material -1
+texture texture texture -1 material bone -1 material 1.0 texture -1 texture
+vertex material anim -1 bone
+= 0.500000 0.500000 0.500000
+frame
+material bone
+material anim 1.0
+0.500000 vertex anim 0.500000 -1 = texture frame material frame
+0.500000 material 0.500000 frame
+= 0.500000 = texture frame frame vertex anim 0.500000 1.0
+-1 anim anim bone
+-1
+0.500000 texture 0.500000 1.0
+bone vertex 1.0 texture 1.0 texture vertex vertex bone bone material anim
+frame -1
+frame 1.0 texture anim anim
+-1 0.500000 = = 0.500000
+0.500000 = anim anim material 1.0 -1
+bone anim vertex 0.500000 bone 1.0 vertex = frame
+=
+material anim anim vertex anim 0.500000
+0.500000 material
+material
+material vertex 0.500000 -1 anim anim
+bone bone vertex 0.500000 1.0 anim bone bone
+0.500000
+0.500000 = texture bone frame -1
+-1 anim anim texture anim texture frame material
+bone
+anim
+texture bone
+bone frame 0.500000 = material
+material vertex =
+texture -1 material vertex
+bone
+material
+bone 1.0
+anim 1.0 bone frame anim = material
+bone 1.0 frame -1 0.500000 vertex 0.500000 fram
\ No newline at end of file
@@ -0,0 +1,10 @@
+1.0 frame
+vertex 1.0 texture -1
+vertex frame = 0.500000 anim vertex anim = 0.500000
+1.0
+bone 1.0 =
+frame
+vertex frame vertex material
+frame texture
+1.0 texture
+texture frame texture -1 frame a
\ No newline at end of file
@@ -0,0 +1,42 @@
+frame anim -1 0.500000 anim 1.0
+0.500000 bone vertex
+-1 anim bone vertex frame
+bone bone bone 0.500000 1.0 frame
+bone
+material frame
+vertex 1.0 bone
+texture anim vertex -1 1.0 texture
+bone = frame
+1.0 material anim
+1.0 0.500000 1.0 anim
+1.0 -1 0.500000 material
+= =
+frame bone frame bone -1 vertex anim
+= bone
+material = -1 frame
+-1 -1 bone frame material frame texture
+-1 0.500000
+vertex
+-1 frame texture vertex bone vertex = = anim bone
+anim anim 0.500000 -1 1.0 texture 0.500000 vertex bone
+= vertex -1
+texture
+-1 bone bone 1.0 1.0 1.0 vertex
+vertex
+frame vertex 0.500000 0.500000 -1 texture
+= vertex -1 bone
+bone anim
+= =
+= 1.0 texture vertex 1.0 1.0 = vertex
+texture 0.500000 -1 texture =
+frame anim material bone frame =
+material bone
+texture 1.0 = material 1.0 0.500000
+vertex vertex anim 0.500000 =
+bone 1.0
+0.500000 material =
+vertex vertex
+-1 =
+= frame anim
+vertex bone
+0.500000 vertex 
\ No newline at end of file
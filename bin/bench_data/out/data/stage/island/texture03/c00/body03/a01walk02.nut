@@ -0,0 +1,327 @@
+frame bone texture -1 -1 material material anim vertex 0.500000 -1 vertex 0.500000 vertex texture vertex anim material frame -1 vertex 1.0 -1 -1 0.500000 = bone
+texture = =
+1.0 material
+-1 anim material texture
+-1 material
+frame
+= -1 bone vertex frame frame vertex texture 1.0 frame
+material frame anim bone -1 bone -1 = frame -1 texture 1.0 = 0.500000
+-1 material texture texture anim material
+frame vertex material anim
+texture -1 -1 vertex material bone texture -1
+bone -1 frame bone material
+-1 frame material 0.500000
+-1 0.500000 bone anim anim texture frame 0.500000 1.0 material texture bone
+1.0 texture vertex -1 vertex texture anim bone
+= 1.0 material
+anim frame = bone =
+material material vertex -1 =
+-1
+vertex 1.0 vertex 1.0 bone material frame 1.0 =
+1.0 bone -1 =
+=
+-1 bone 0.500000 vertex texture -1
+anim 1.0 frame 1.0
+anim = anim texture -1 0.500000 material texture
+bone bone vertex frame material
+0.500000 material vertex material frame
+material 1.0 texture
+vertex =
+= -1 anim 0.500000 -1 = bone 0.500000 bone
+vertex
+0.500000
+vertex anim material anim material
+0.500000 texture = vertex 1.0 0.500000 anim material anim material 0.500000 material
+-1 1.0 frame
+1.0 bone 0.500000
+texture texture = -1 frame
+bone frame texture
+bone frame
+1.0
+vertex material bone
+1.0 bone material -1 frame frame -1 bone
+= anim frame anim 0.500000 material
+anim bone 1.0 material material anim anim anim =
+bone 0.500000 material
+frame
+1.0 material material
+anim
+1.0 vertex
+-1 anim vertex
+0.500000 texture
+texture
+=
+= bone frame
+1.0 -1
+frame 1.0 frame texture vertex material texture vertex
+texture
+vertex
+-1
+vertex anim vertex
+0.500000
+=
+texture material texture vertex material 0.500000 -1 0.500000 anim texture 0.500000
+frame bone 0.500000
+= frame bone
+0.500000
+1.0 = = vertex -1 0.500000 frame
+texture 0.500000 bone texture = vertex
+= bone
+bone frame texture 1.0 0.500000 material bone
+frame
+material frame 1.0 material
+bone
+bone 0.500000 -1 1.0 1.0
+1.0 =
+1.0 vertex anim = -1 texture 1.0 vertex
+texture -1
+bone 1.0 texture
+frame -1 1.0
+1.0 texture material 0.500000 0.500000 vertex anim bone -1 vertex
+vertex
+vertex -1 bone 0.500000
+-1
+texture
+1.0 -1 0.500000 vertex 0.500000 1.0 -1
+0.500000 0.500000 vertex
+vertex
+texture vertex texture vertex frame
+vertex 0.500000
+1.0 material = material 1.0 material anim texture
+frame material vertex anim frame
+material material -1
+anim material vertex = -1
+anim
+vertex frame
+material
+bone vertex
+texture vertex -1
+texture bone
+1.0 =
+1.0 texture material -1 bone 1.0
+1.0 texture bone
+texture
+material
+material 0.500000
+frame
+= -1 bone
+material = frame -1 texture frame material vertex = = 0.500000
+vertex vertex
+1.0 1.0 anim
+material
+-1 1.0
+frame 0.500000 texture 0.500000 texture 1.0 texture 0.500000 vertex
+texture bone
+-1
+anim
+material 1.0 = anim bone material material
+vertex
+= -1
+anim texture texture anim -1 vertex 0.500000
+anim
+texture
+texture material
+frame
+0.500000 vertex frame
+anim material frame material 1.0 -1 material bone anim bone -1 anim = 1.0 bone 1.0 anim -1 vertex frame 0.500000 vertex
+-1 frame
+texture 1.0 = 0.500000 material bone texture frame -1 material texture vertex
+0.500000
+bone 1.0 bone 0.500000 -1 bone frame bone
+vertex
+= -1 frame
+frame texture material frame 0.500000 1.0
+0.500000
+0.500000 -1 1.0 frame
+vertex 1.0 -1 vertex
+bone anim vertex 0.500000 -1 anim 0.500000 frame vertex bone
+0.500000 1.0 vertex
+vertex anim
+vertex
+= material material 1.0 1.0 texture material
+frame
+bone anim 1.0 vertex texture bone 0.500000 texture =
+material 1.0
+vertex bone bone
+-1 frame 1.0 bone = -1 anim 0.500000
+bone -1 bone bone
+bone bone anim 0.500000
+material texture bone bone bone 0.500000 1.0 texture texture = texture = 0.500000 -1 frame 0.500000 -1 vertex vertex anim texture 0.500000
+texture
+-1 0.500000 bone
+material 1.0
+1.0
+bone frame bone frame 1.0 = anim =
+= anim frame anim 0.500000 vertex texture
+vertex =
+=
+vertex vertex material
+material bone frame
+material
+material =
+material 1.0 anim 1.0
+vertex
+bone material
+1.0 frame 1.0 anim vertex vertex anim anim material 0.500000 frame
+material frame anim texture -1 0.500000
+vertex 1.0 0.500000 0.500000
+vertex anim = anim texture bone 1.0 anim 0.500000 -1 vertex 0.500000 vertex material
+frame -1
+0.500000 texture frame
+= frame 0.500000 frame frame anim material anim bone anim texture anim
+frame material
+texture 1.0 material
+0.500000 texture
+bone material = material bone = =
+bone
+anim frame
+vertex
+vertex 0.500000 anim material bone frame frame texture material vertex 0.500000
+bone 0.500000 -1
+anim texture
+=
+= anim -1 material
+1.0
+frame
+texture anim 1.0 frame
+frame
+1.0 texture
+0.500000
+-1 bone anim -1 = material bone 1.0
+= frame vertex
+anim
+bone
+=
+= bone vertex -1 =
+-1
+1.0
+bone
+1.0 -1 = 0.500000 =
+frame
+material = anim texture
+1.0
+anim
+anim
+0.500000 0.500000 anim 0.500000 1.0 = frame
+frame material
+bone
+1.0 bone
+bone anim = -1 frame 1.0
+vertex = bone
+bone
+bone = = 0.500000 texture anim 1.0
+frame
+texture vertex
+1.0 = frame bone anim texture texture
+material anim vertex
+bone =
+anim material
+-1 anim texture =
+material
+vertex 1.0
+anim frame 0.500000 texture texture
+material bone 0.500000
+1.0 anim
+material
+= = material anim texture -1 material -1
+=
+-1 -1 1.0
+vertex material texture vertex
+texture vertex
+texture
+= vertex bone frame
+vertex anim -1 1.0
+texture frame
+frame
+anim material -1 texture bone 1.0 = vertex anim bone
+anim 0.500000
+material anim 1.0
+-1 = = 1.0
+anim anim material
+=
+bone -1 bone -1 1.0 1.0 bone anim
+frame anim
+frame = frame -1 -1
+-1
+0.500000 vertex vertex vertex 1.0 bone
+-1 bone material 1.0 vertex 0.500000
+texture 1.0 = 1.0 material
+1.0
+bone vertex frame vertex anim
+material
+anim bone material vertex 1.0
+-1 anim anim texture = 1.0
+= material material bone
+bone
+0.500000 anim = anim =
+0.500000 texture material 0.500000
+= 1.0 anim texture
+frame bone -1 1.0
+0.500000 anim -1 frame vertex = anim
+vertex 0.500000 material material texture material
+material 0.500000 -1 frame texture frame
+material 1.0
+texture
+bone =
+vertex
+vertex frame material vertex
+material frame material vertex texture texture texture
+anim
+anim material anim
+frame -1 material texture 0.500000 1.0 = 1.0 vertex 1.0 frame anim material -1 bone
+bone 0.500000 1.0 bone 1.0 -1 bone anim material material -1 0.500000 frame anim texture frame -1 frame vertex bone
+frame
+vertex
+-1
+0.500000 frame = = -1 =
+-1 texture
+frame 0.500000 material 0.500000
+texture
+material texture material = frame material
+= 0.500000
+texture 1.0 bone frame =
+0.500000 0.500000 1.0 = vertex -1 0.500000
+-1 vertex vertex bone 0.500000 material texture = 1.0 frame
+vertex anim =
+anim anim
+vertex frame
+0.500000 -1
+-1 texture 1.0
+1.0 bone frame
+vertex frame
+material
+frame = anim
+texture -1 1.0 material bone
+anim bone vertex anim bone
+1.0 bone = vertex vertex anim material -1 bone
+material anim
+texture -1 frame bone vertex 0.500000 0.500000 frame
+= 1.0 vertex anim vertex
+texture material 1.0
+anim -1 -1 =
+anim = texture
+texture = material material 0.500000 frame
+material = vertex 0.500000 bone vertex = -1 anim texture =
+=
+-1 material 1.0 texture vertex material 1.0 0.500000 = frame frame -1 bone material anim vertex
+=
+texture
+1.0
+0.500000 material
+bone -1
+material
+-1 0.500000
+vertex
+frame 0.500000 texture
+anim
+1.0 -1 texture frame
+anim vertex vertex texture material 1.0 -1
+bone
+bone vertex
+=
+texture
+vertex texture
+anim texture texture 0.500000 1.0 anim texture bone
+anim vertex -1
+-1 -1 -1 1.0 = texture 0.500000 material 0.500000 1.0
+-1 0.500000 bone 0.500000 0.500000 -1 material an
\ No newline at end of file
@@ -0,0 +1,40 @@
+frame anim vertex
+0.500000 -1 1.0 0.500000
+-1
+texture bone 1.0 texture
+=
+= vertex
+0.500000 bone
+texture 1.0 1.0 material = vertex anim
+1.0 =
+0.500000 -1 vertex
+texture anim -1 anim
+1.0 texture -1 vertex
+bone
+material
+= vertex 1.0 0.500000 bone material frame
+anim = anim bone
+vertex texture anim =
+-1 texture frame
+vertex
+0.500000 1.0 vertex 0.500000 frame texture texture
+0.500000 bone frame 0.500000
+1.0
+-1 bone frame
+anim 1.0 material -1 frame
+vertex frame 0.500000 frame anim
+0.500000
+vertex texture vertex 0.500000
+frame -1 bone 0.500000 anim anim frame
+1.0 0.500000 -1 vertex -1 1.0 texture =
+1.0
+material frame 1.0 frame
+texture 1.0 frame texture
+anim
+1.0 material texture
+vertex frame vertex vertex
+anim
+0.500000 =
+0.500000
+anim
+-1 = -1 anim 1.0 texture -1 = frame = 0.50000
\ No newline at end of file
@@ -0,0 +1,33 @@
+=
+material material 1.0
+1.0 anim
+vertex
+anim vertex
+texture 1.0 anim -1 texture texture = frame
+0.500000 frame
+material frame material vertex texture frame = frame vertex texture -1 = anim anim -1 =
+1.0 vertex anim
+texture bone bone -1 texture
+texture
+material vertex =
+1.0
+0.500000 anim = = -1
+-1 anim = anim frame
+0.500000 bone anim -1 1.0 bone
+bone -1
+-1 -1 0.500000
+-1 vertex
+=
+0.500000 0.500000 = 0.500000 -1 -1 frame bone material 1.0 bone 0.500000 texture
+texture
+vertex anim
+vertex
+anim
+texture 0.500000
+bone vertex texture frame vertex vertex -1 texture = vertex = -1
+= frame
+1.0 1.0 vertex vertex 0.500000 1.0 1.0 texture
+vertex bone frame 0.500000 anim
+-1 -1 -1 -1 0.500000 vertex -1 bone vertex frame
+texture
+frame = -1 material
\ No newline at end of file
@@ -0,0 +1,17 @@
+vertex -1 0.500000
+texture
+= anim material
+texture vertex -1
+=
+1.0 material
+texture
+texture 0.500000 texture -1 material
+frame bone bone
+material 1.0 material = -1
+texture material -1 frame bone 0.500000 1.0 -1 0.500000 anim
+anim texture 1.0 0.500000 -1 vertex = frame
+frame vertex -1 material bone 1.0
+vertex vertex
+texture texture 1.0 -1 bone bone
+frame 1.0
+texture vertex bone bone anim anim 
\ No newline at end of file
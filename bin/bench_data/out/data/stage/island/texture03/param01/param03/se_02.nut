@@ -0,0 +1,361 @@
+bone frame
+anim
+vertex material frame texture frame -1
+-1 anim texture anim = vertex bone
+0.500000 0.500000
+-1 texture
+frame = anim -1 material bone -1
+bone -1 1.0
+anim = 0.500000 vertex
+anim vertex frame
+anim anim
+vertex
+= anim anim
+0.500000 frame
+vertex material texture
+bone
+material 0.500000
+anim 1.0 material vertex
+1.0 1.0 -1 anim anim
+0.500000
+texture 1.0 bone = bone material -1
+=
+texture
+bone
+= frame frame
+-1 1.0
+material bone
+frame 0.500000
+vertex -1
+anim 1.0 -1 -1 texture -1 material frame = texture -1
+bone vertex material -1 -1 frame vertex
+material
+vertex vertex vertex 0.500000
+material = 1.0
+frame =
+material frame = texture
+bone
+=
+anim
+vertex
+-1 material material vertex vertex vertex frame
+anim
+anim
+bone
+bone -1 texture = frame vertex frame
+vertex
+material = frame frame
+0.500000 = -1
+vertex = 1.0 1.0
+bone bone texture texture -1
+frame
+0.500000
+vertex material frame = texture texture anim -1 -1 frame = texture
+bone 0.500000 anim
+frame material
+frame anim bone
+texture
+frame texture anim material
+frame material frame -1
+= frame
+frame -1
+anim bone frame anim material
+anim anim material -1 anim
+anim frame 0.500000 0.500000 frame 1.0 texture 1.0 1.0 material
+anim bone 0.500000 0.500000 0.500000
+bone bone
+-1 texture 1.0 1.0
+-1 texture 1.0 = material 0.500000 = 0.500000 bone -1
+1.0 vertex frame material bone vertex 1.0 vertex bone vertex material frame bone vertex anim material texture
+= 1.0 anim
+-1 texture
+-1 texture material
+anim material anim frame
+frame -1
+material
+vertex bone texture frame texture 0.500000
+-1 material -1
+vertex =
+bone bone -1 -1 0.500000 -1 = 1.0 bone material
+1.0 texture
+vertex = texture
+material 1.0 bone = = = vertex 1.0 frame -1
+material bone
+anim vertex bone
+frame texture
+material 0.500000 =
+texture -1 frame
+=
+-1 material anim 1.0 anim 1.0
+bone =
+0.500000
+bone -1
+anim anim frame vertex vertex -1 texture
+-1 = 1.0
+anim vertex
+anim 0.500000 0.500000
+frame anim anim texture bone 0.500000 -1 frame anim 0.500000 -1
+material = material frame bone
+texture 0.500000 =
+= material bone bone -1 = -1 -1 1.0 1.0
+=
+=
+anim frame frame
+frame anim
+0.500000 frame texture material
+-1 = -1
+= anim material texture
+= material bone material 1.0 texture
+0.500000 frame
+material frame
+anim vertex anim -1 0.500000 0.500000 anim
+material
+0.500000 anim 0.500000
+anim
+bone = -1 bone 1.0 1.0
+1.0 frame
+anim bone
+0.500000 -1
+-1 material frame -1 bone 1.0 = -1 texture bone
+1.0 bone 1.0 bone
+=
+-1 frame frame material 1.0 -1 anim -1
+material
+texture
+bone 0.500000 vertex material
+0.500000 material anim vertex texture
+material vertex =
+bone vertex 0.500000 vertex 1.0 frame anim bone
+1.0
+0.500000
+vertex 1.0 frame
+-1 bone bone anim texture
+vertex vertex
+1.0 texture 1.0
+0.500000 1.0 anim anim anim 0.500000 1.0 -1
+0.500000
+anim 0.500000
+frame
+= bone
+material anim = texture anim frame
+0.500000 bone anim
+texture -1 texture material 0.500000 anim material bone
+frame material texture texture 0.500000 -1
+-1 texture 1.0 0.500000
+0.500000 anim vertex texture -1 texture 1.0 material texture texture -1 material
+frame material 1.0 frame vertex
+-1 anim 0.500000
+anim 0.500000 =
+1.0 frame 0.500000
+frame texture anim 0.500000 1.0 anim 0.500000 texture frame bone vertex = material 0.500000 = = anim texture 0.500000
+texture -1 bone
+anim frame
+= material = material -1
+frame -1 bone texture
+vertex
+bone anim
+0.500000 material 0.500000 anim material 0.500000
+anim
+1.0 texture texture = vertex anim
+bone vertex
+bone 0.500000
+vertex
+material -1 -1
+anim
+1.0
+0.500000 frame
+= 1.0 bone -1 material bone 1.0 texture -1 -1 anim texture material 1.0 frame
+-1 texture texture bone anim material vertex = bone anim 0.500000 anim
+= frame
+1.0 1.0
+frame texture vertex
+vertex material 0.500000 1.0
+frame
+frame vertex = 0.500000
+0.500000 -1 frame vertex anim
+vertex =
+=
+material = vertex -1 -1 bone -1
+anim frame
+material vertex
+texture
+frame 1.0
+texture 1.0 1.0 bone 1.0
+vertex
+frame -1 -1
+material vertex vertex bone
+frame -1 bone
+texture
+1.0 -1 texture =
+frame 0.500000 0.500000 anim -1 bone bone -1
+1.0 anim 0.500000
+material -1
+material frame 1.0
+material -1 texture
+0.500000 0.500000 texture texture vertex
+frame frame -1
+material = vertex anim texture
+0.500000 vertex -1 material vertex
+1.0
+0.500000
+1.0
+0.500000 bone
+material vertex = 1.0 bone
+anim
+frame bone
+0.500000 texture
+bone vertex bone 0.500000 -1 frame
+anim
+-1 texture
+material -1 -1 -1 texture texture material
+= texture anim 0.500000
+anim
+-1 -1 = -1 0.500000 texture -1 bone texture -1
+1.0
+0.500000 frame = texture 1.0 1.0 1.0 0.500000 = bone 1.0 texture 1.0 0.500000 1.0 material 1.0
+= bone anim
+frame vertex frame material anim -1 vertex frame texture texture frame
+-1 1.0 frame anim frame
+0.500000 =
+anim bone vertex frame
+material vertex anim vertex texture 1.0 material anim frame anim vertex material texture
+0.500000 vertex vertex 1.0 vertex anim = -1 anim frame
+vertex
+texture anim 1.0 = 0.500000
+vertex material vertex frame anim -1 anim = 1.0 1.0
+anim
+=
+texture anim
+texture material 0.500000 anim
+material frame
+0.500000 anim
+0.500000 -1 anim bone -1 0.500000 anim 0.500000
+-1 vertex anim =
+-1 -1 frame
+frame
+= vertex 1.0 1.0 anim frame
+bone 0.500000
+bone = 0.500000 texture = bone anim texture frame material
+1.0 = anim material
+anim
+vertex material anim anim 1.0 1.0 =
+= frame anim
+anim -1 1.0 material
+1.0
+anim anim
+material texture
+1.0 = texture
+vertex vertex texture
+texture anim frame 1.0
+=
+material vertex 1.0 texture -1 material -1 bone
+1.0 bone anim -1 texture 0.500000
+material
+1.0
+texture vertex
+texture texture
+0.500000 1.0 0.500000 bone texture = -1 material material
+1.0
+material bone
+anim material
+material anim
+-1 texture frame material -1 texture anim anim -1 0.500000 1.0
+-1 texture =
+material anim material frame texture frame -1 = 0.500000
+= -1 =
+texture 0.500000
+0.500000 1.0 anim anim
+bone 0.500000 bone
+bone material 0.500000 vertex = 0.500000 material -1 texture frame bone material anim texture 0.500000 = texture -1 -1 material vertex bone = material anim anim
+anim
+-1
+anim =
+material bone bone
+anim -1
+bone frame
+material
+vertex
+0.500000 = 1.0 anim = = anim
+material vertex material
+=
+frame -1
+= frame material frame = 0.500000 0.500000 texture 1.0 material
+anim material 1.0 = bone vertex = bone -1 1.0 -1 0.500000 material
+texture -1 texture anim material
+-1 bone frame -1 bone bone vertex
+=
+0.500000 texture texture texture
+1.0 bone anim = 1.0 frame texture
+-1 = = =
+material bone frame = bone -1
+texture texture 1.0 material vertex
+= frame texture
+1.0 frame
+-1 anim texture -1 =
+texture
+1.0 frame anim
+vertex -1 vertex anim
+frame texture texture
+frame = bone
+0.500000 1.0 frame anim material bone = 0.500000 =
+1.0 vertex -1 material
+bone texture
+material texture vertex =
+vertex 1.0 anim texture bone 0.500000 material -1 vertex
+texture 0.500000 texture material -1 -1 1.0 frame 0.500000 frame frame material 1.0
+= material 0.500000 material
+vertex frame texture frame bone 0.500000 vertex
+anim texture
+vertex material
+material material -1
+bone 1.0
+vertex
+anim = 1.0 bone material anim
+= anim vertex = 1.0 frame vertex material anim = 0.500000 texture 1.0 = vertex material vertex 0.500000 frame
+vertex
+bone material frame
+vertex texture = = vertex bone = frame -1 vertex
+texture material 1.0
+1.0 0.500000
+= bone = frame bone 0.500000 texture
+0.500000
+= texture 0.500000 vertex = -1
+material vertex vertex = = 1.0 material -1
+0.500000 texture frame frame material texture
+-1 0.500000 material = material anim
+0.500000 -1 bone
+texture anim
+bone texture 0.500000 1.0 -1 anim -1
+vertex
+0.500000 bone = 0.500000 0.500000 vertex bone
+0.500000
+0.500000 frame frame
+material vertex 0.500000 vertex texture 0.500000
+0.500000 material frame 1.0 bone texture 0.500000
+texture texture bone -1 1.0 bone bone 1.0 bone 1.0 vertex
+material frame -1 1.0 =
+bone
+= bone
+anim
+-1
+-1 material
+1.0 texture frame texture
+material vertex texture 0.500000
+1.0
+texture
+texture 1.0
+texture = material vertex anim
+material
+bone
+-1
+0.500000 material anim vertex frame -1 =
+=
+0.500000 0.500000 material 1.0 bone
+material
+anim material 1.0
+0.500000 = = material material
+-1 anim bone 1.0
+-1 vertex anim vertex texture anim -1 -1
+0.500000 frame bone bone anim 1.0 material anim
+material
+mate
\ No newline at end of file
@@ -0,0 +1,12 @@
+anim vertex =
+bone
+material 0.500000
+anim vertex bone vertex vertex = vertex frame vertex bone material -1
+frame
+material texture
+vertex
+frame anim = 0.500000 = vertex vertex
+1.0 0.500000
+material -1 = bone
+material
+mate
\ No newline at end of file
@@ -0,0 +1,293 @@
+-1 = vertex frame bone material = 0.500000 vertex texture
+bone frame frame bone texture
+1.0 anim material texture = vertex texture 1.0 material
+anim material 1.0 0.500000 material
+0.500000 vertex
+anim material texture texture
+anim -1 material anim frame
+bone frame bone -1 1.0 1.0 -1 anim 1.0
+vertex texture 1.0 = 1.0 anim 1.0 = vertex vertex vertex
+1.0 frame frame texture = 1.0
+1.0 -1 0.500000 vertex material frame texture -1
+bone 0.500000 frame bone bone vertex anim bone
+material
+bone -1 -1 material anim = 1.0 frame material bone texture -1 vertex = 0.500000 =
+material bone 0.500000 texture anim
+anim material frame material frame texture material 0.500000
+frame bone = -1 texture material -1 material
+vertex
+texture
+-1 frame vertex vertex
+material -1 vertex -1 -1 1.0
+bone 0.500000 vertex
+frame frame vertex material bone vertex
+1.0 -1 frame = frame material bone 1.0 texture anim vertex
+bone anim
+bone
+= -1 bone material 1.0
+vertex material vertex
+1.0 vertex = = -1 -1 texture =
+= bone bone 0.500000 material 1.0
+-1 anim texture 0.500000 texture frame bone
+frame bone =
+vertex
+0.500000 1.0
+0.500000 =
+0.500000 0.500000 material
+0.500000 1.0
+material
+texture bone bone -1 material
+0.500000
+anim bone vertex frame = anim vertex material anim
+anim anim texture -1
+0.500000 material anim
+= -1 bone 0.500000 -1 texture
+material bone bone bone 0.500000 1.0
+bone
+= 1.0
+texture
+-1
+material anim anim
+vertex bone vertex frame
+bone vertex -1
+frame 0.500000 material frame frame vertex = anim 1.0 bone anim frame
+frame bone frame texture
+bone bone anim material bone texture = = frame anim
+-1
+-1
+material bone frame anim bone frame anim material material
+texture anim frame 1.0 -1 -1 1.0 = =
+0.500000
+frame frame anim 1.0
+vertex 0.500000 bone
+1.0 anim vertex 1.0
+texture texture
+material texture = anim 1.0 frame -1 bone
+texture texture
+bone
+frame texture texture
+anim -1 0.500000 texture
+texture anim
+0.500000 bone anim 0.500000 anim bone texture 1.0 material material
+material texture 0.500000
+anim -1 1.0 =
+anim
+-1 frame
+vertex frame
+material anim
+frame
+bone =
+1.0
+anim vertex material
+texture texture
+1.0 anim material -1 texture
+anim
+material anim
+anim =
+material -1 1.0 frame frame material
+anim texture texture frame =
+bone frame bone = frame
+texture texture
+1.0 = vertex vertex
+-1 = -1 vertex anim
+frame texture anim = -1
+texture material bone anim -1 frame material texture texture =
+texture
+= vertex 1.0 frame anim material frame
+material 1.0 = vertex
+vertex bone -1 material frame
+frame 1.0
+anim
+anim vertex -1 anim bone
+= frame -1 vertex
+vertex vertex
+anim bone bone = 0.500000 1.0
+vertex material
+vertex 0.500000 -1 bone 1.0
+bone -1
+anim -1
+=
+bone = -1 vertex texture
+0.500000 bone frame
+= texture frame -1 = 0.500000 vertex 0.500000 = texture -1 material anim
+=
+1.0 anim -1 = bone
+material frame frame vertex
+texture
+bone material texture frame 1.0 anim texture frame
+frame
+=
+= vertex
+=
+-1
+1.0 bone
+=
+texture material
+-1 0.500000 texture vertex
+vertex vertex anim frame frame 1.0 1.0 bone
+-1 0.500000 material 1.0
+texture frame
+0.500000 1.0 vertex vertex vertex texture = -1
+vertex 1.0
+-1 material 1.0 anim anim 0.500000 -1 0.500000 frame material
+0.500000 material frame
+anim vertex
+1.0
+= vertex frame
+texture -1 texture anim vertex bone material 1.0 0.500000 bone material anim 0.500000 vertex 0.500000 material texture 0.500000 = frame 0.500000
+material
+texture material
+= bone 0.500000 0.500000
+texture = =
+vertex -1 0.500000 1.0 1.0 -1
+material texture frame -1 frame 1.0 texture bone frame -1 material material 1.0 1.0 vertex vertex anim
+-1 1.0
+1.0 0.500000
+vertex texture texture
+material
+anim vertex
+= vertex 1.0 anim vertex -1
+= 1.0
+frame 1.0 -1 1.0 material 0.500000
+material anim material material anim =
+0.500000 0.500000 texture vertex = =
+texture texture
+1.0 bone anim anim = 0.500000
+frame frame
+vertex frame 1.0
+vertex 1.0 anim
+0.500000
+0.500000
+material anim anim
+1.0
+bone =
+1.0 1.0 -1 material
+1.0 vertex vertex bone
+= 1.0 bone
+frame vertex = 1.0 = -1 -1 bone
+anim texture anim -1 0.500000 1.0
+0.500000
+-1 1.0 frame
+texture texture anim 0.500000 bone frame bone anim 1.0 bone
+texture -1 material = -1 texture 0.500000
+texture anim = vertex material 1.0 frame
+material vertex = anim -1
+frame 0.500000 = frame anim = 1.0 0.500000 -1 frame 0.500000
+bone
+material frame texture = -1
+-1 anim vertex
+= 1.0 = vertex frame bone -1
+vertex
+=
+material 1.0 =
+0.500000 -1 vertex anim -1 = bone -1 texture -1 -1 texture material 0.500000
+1.0 material 0.500000 vertex texture = 0.500000 0.500000 -1 0.500000
+bone vertex 1.0 -1 0.500000 material
+0.500000 0.500000
+bone frame material = 1.0
+frame material texture frame vertex 0.500000 1.0
+texture 1.0 anim texture 1.0 vertex -1
+vertex texture bone = frame = = -1 0.500000 material frame vertex
+= vertex
+material vertex
+vertex =
+vertex frame
+material
+0.500000 texture
+anim
+-1 texture bone 0.500000 frame
+anim frame =
+material 0.500000 0.500000 bone = -1 anim vertex
+1.0
+material texture anim
+-1 -1 -1 -1 -1 0.500000 bone 1.0 bone
+1.0 material
+texture
+vertex
+anim -1 -1
+-1 vertex 0.500000 0.500000 -1
+bone material bone -1
+material 1.0 anim vertex
+material texture anim
+-1 -1 0.500000 =
+vertex
+-1 material vertex 0.500000 anim
+material -1 texture
+-1
+frame vertex = = frame bone anim bone texture =
+vertex
+bone frame 1.0 anim 0.500000 1.0
+vertex
+frame texture anim vertex
+1.0 frame anim frame frame
+frame
+vertex material frame frame frame
+texture material vertex
+frame -1 0.500000
+material 0.500000 0.500000 -1 = anim
+texture -1 0.500000 material
+texture material -1 =
+0.500000 vertex 0.500000
+0.500000 material -1 frame
+= vertex texture
+-1 1.0 material frame
+1.0 -1 texture
+vertex 0.500000 anim -1 frame 0.500000 0.500000 1.0
+0.500000 0.500000 vertex
+anim
+texture frame =
+=
+1.0 bone frame texture
+= = anim texture
+material 1.0 1.0 frame
+vertex -1 texture texture vertex bone frame
+anim
+material bone material frame 0.500000 = texture material
+-1 anim material bone frame -1 1.0 0.500000 vertex 1.0 anim 0.500000 texture -1 material material bone 0.500000 texture anim bone -1 1.0 anim
+frame vertex bone -1 0.500000
+frame -1 = 1.0 texture anim 0.500000 = = vertex -1 0.500000 bone
+anim
+vertex bone frame anim
+material texture material anim material bone 0.500000 texture texture 1.0
+vertex anim 1.0 anim -1 vertex
+-1
+anim
+bone = = texture anim 0.500000 texture = bone vertex
+bone
+material vertex material anim vertex
+-1
+material -1 1.0 -1 0.500000 1.0 anim
+anim
+-1 vertex
+-1 frame = material texture anim frame bone frame
+vertex -1 = bone bone
+bone anim
+material vertex 0.500000
+frame -1 anim
+= texture 0.500000 material -1 0.500000
+vertex 1.0
+vertex = texture
+0.500000 = = = anim
+anim 0.500000 material 1.0 vertex vertex = frame 0.500000 bone = material -1 bone vertex vertex
+material texture frame
+bone texture material 0.500000 1.0 = texture
+material bone
+anim material frame
+1.0 0.500000
+0.500000 1.0 vertex vertex frame 0.500000
+material
+frame material frame texture
+vertex anim material
+frame anim =
+frame 1.0
+frame bone
+bone 0.500000
+0.500000 material = frame bone material 1.0 anim bone 0.500000 -1 vertex
+bone material
+0.500000 frame vertex
+bone 0.500000
+anim anim 1.0
+bone texture 0.500000
+bone 0.500000 frame 0.500000 anim vertex bone
+texture 1.0 0.500000
+0.500000 bone material
\ No newline at end of file
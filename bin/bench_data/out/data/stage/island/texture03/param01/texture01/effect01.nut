@@ -0,0 +1,89 @@
+texture frame
+1.0 bone = anim
+texture texture
+-1 frame vertex -1 texture
+anim
+0.500000 1.0
+anim texture
+material anim
+bone 0.500000 texture
+texture anim texture vertex -1 vertex material 1.0
+texture
+-1 bone frame
+vertex 0.500000 frame
+-1
+anim 0.500000 texture
+bone
+anim 1.0 1.0
+1.0 1.0
+0.500000
+bone texture
+1.0 bone anim
+0.500000 material 1.0 = bone
+vertex bone frame
+vertex vertex material anim
+= anim = bone
+1.0 1.0 0.500000 1.0 vertex 0.500000 anim 0.500000 1.0
+0.500000 material -1
+1.0 material material 0.500000 bone anim
+material
+bone frame frame
+bone bone
+0.500000 vertex 0.500000 texture frame
+material
+1.0 material
+1.0 anim 1.0
+texture bone 0.500000 0.500000 0.500000 -1
+1.0 frame material
+1.0 anim
+anim
+bone bone
+=
+material = -1 texture bone
+texture texture
+vertex = 1.0 texture bone material 0.500000 frame
+anim
+material anim frame anim 1.0 anim
+frame -1 bone texture texture texture
+0.500000
+texture bone
+bone
+-1 -1
+1.0 -1
+anim bone anim
+bone vertex = material frame material
+anim =
+texture 0.500000 1.0 frame -1 -1
+material 0.500000
+vertex vertex
+vertex =
+anim 1.0 -1 =
+anim -1 texture
+frame 0.500000 = material 0.500000 vertex -1 1.0 bone 0.500000
+= = = 1.0
+=
+1.0 vertex vertex 0.500000 anim frame
+-1 texture =
+anim
+-1 vertex anim
+vertex texture anim -1 0.500000
+bone = vertex texture anim 0.500000 0.500000
+bone
+1.0 anim 1.0
+vertex -1 = vertex
+anim
+anim bone bone bone frame bone material
+material vertex texture anim anim material frame 0.500000 anim
+-1 bone bone vertex texture
+material -1
+vertex 0.500000 1.0 vertex vertex = frame bone 0.500000 bone frame 0.500000
+0.500000 -1
+= frame anim anim vertex material
+anim texture frame frame vertex = frame 0.500000 anim -1 bone 0.500000 0.500000
+bone
+= frame
+texture -1 anim
+texture
+texture 0.500000 vertex material frame 0.500000 = = 1.0 anim 1.0
+vertex texture anim
+bone t
\ No newline at end of file
@@ -0,0 +1,6 @@
+vertex
+vertex 1.0
+anim material
+-1
+= bone 1.0 frame =
+m
\ No newline at end of file
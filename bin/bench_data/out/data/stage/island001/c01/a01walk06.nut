@@ -0,0 +1,11 @@
+0.500000 1.0 texture material
+frame
+-1 1.0 -1 material 1.0
+= texture 1.0
+0.500000 1.0 1.0 0.500000 texture texture
+vertex -1
+frame frame bone
+vertex
+= bone -1 anim 1.0 =
+1.0
+frame 1.0 0.500000 ma
\ No newline at end of file
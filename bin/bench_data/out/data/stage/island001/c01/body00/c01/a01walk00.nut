@@ -0,0 +1,68 @@
+vertex frame
+1.0 material
+1.0 1.0 0.500000
+material texture -1 = anim anim
+-1 0.500000
+material 0.500000 vertex -1 0.500000 frame = texture anim
+material 0.500000
+texture -1 vertex
+material bone material
+-1
+-1 vertex
+1.0 1.0 frame frame = -1 frame 1.0 bone
+= anim material frame vertex
+frame anim
+1.0
+material 0.500000
+=
+1.0 vertex 1.0 texture texture frame = vertex material frame texture -1 bone vertex vertex vertex = anim
+frame -1 bone frame = = texture 0.500000 material
+bone
+texture texture 1.0 vertex 1.0
+anim 1.0 frame anim frame
+frame 0.500000
+anim 0.500000
+texture anim -1 anim anim anim frame = material bone material frame frame 1.0
+texture frame 0.500000 -1 =
+bone bone vertex
+-1
+anim anim anim 1.0 0.500000 anim 1.0 anim = material material
+vertex vertex frame 1.0 1.0 vertex
+vertex anim material = 1.0 -1 bone = 1.0 = frame 1.0
+anim 1.0
+0.500000 1.0 -1 anim frame anim -1 frame
+anim vertex 0.500000 vertex
+=
+-1
+0.500000
+frame vertex
+bone = frame 1.0 texture texture -1
+anim frame
+anim -1
+= vertex vertex =
+1.0 vertex =
+0.500000 = texture material
+texture bone vertex
+anim 0.500000 1.0 vertex bone material material texture vertex texture vertex =
+material vertex
+frame vertex
+anim texture
+0.500000 = anim
+0.500000 -1 = 1.0 anim texture material bone vertex
+bone 0.500000 frame 1.0 material texture
+material material texture = material 0.500000 bone 0.500000
+vertex vertex anim 0.500000 vertex -1 1.0 material bone = anim
+bone = vertex
+-1 material
+1.0 frame
+1.0 texture -1 frame vertex
+= texture -1
+material bone texture = texture =
+1.0 0.500000 bone -1 0.500000
+bone bone =
+frame 0.500000 = anim -1 frame texture 0.500000
+anim
+material material bone texture = = anim material 1.0 bone anim frame bone
+bone -1 material
+texture frame texture anim
+texture frame frame bone 1.0
\ No newline at end of file
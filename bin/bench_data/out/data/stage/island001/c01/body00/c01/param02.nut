@@ -0,0 +1,10 @@
+texture material 1.0 -1
+= -1 0.500000
+anim texture
+vertex 0.500000 material 0.500000 = frame -1 = frame anim texture frame bone texture frame
+vertex texture vertex -1 -1
+material =
+bone frame
+texture texture -1 frame texture 1.0 bone
+texture anim = = material frame material -1 -1 anim bone -1 -1 anim bone -1 vertex bone vertex -1
+material = 0.
\ No newline at end of file
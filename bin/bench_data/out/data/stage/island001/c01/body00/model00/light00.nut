@@ -0,0 +1,136 @@
+texture texture = material
+vertex material
+vertex anim frame =
+1.0 0.500000 = frame material vertex = 0.500000
+0.500000
+vertex
+texture anim frame anim -1 frame 0.500000 vertex 0.500000 =
+bone -1 material
+anim = -1 vertex frame =
+1.0 frame = 0.500000 material -1 vertex vertex anim
+texture
+=
+bone
+0.500000 material texture
+texture
+-1
+= = frame 0.500000 frame frame =
+vertex
+0.500000 vertex 1.0 1.0 anim texture material texture
+0.500000 material
+bone
+texture material 1.0 = -1 = 1.0 vertex anim
+= bone -1 -1 frame vertex texture 0.500000 -1 = frame anim
+frame -1
+1.0 material vertex
+vertex frame material frame 0.500000
+-1 1.0 1.0
+bone = anim -1 0.500000 material bone
+-1 frame 0.500000 vertex 0.500000 = 0.500000
+1.0
+material
+-1 anim frame -1 0.500000 bone texture material bone frame frame
+anim vertex = -1 0.500000
+0.500000 frame frame texture = -1
+1.0
+material texture
+frame bone texture
+-1 = texture bone 0.500000 bone texture vertex vertex
+anim
+bone
+-1 texture
+= 1.0 vertex bone texture 0.500000 vertex texture
+1.0
+0.500000
+anim anim
+1.0 vertex bone bone
+-1
+frame = 1.0 -1 vertex 0.500000 vertex = 0.500000 vertex 1.0 -1
+= material -1 anim vertex
+anim texture -1 material 0.500000 anim texture texture texture anim texture 1.0 -1 1.0 anim texture frame
+= 0.500000 texture
+=
+frame 1.0 anim bone bone
+-1
+frame material = 0.500000 vertex texture anim bone
+vertex
+texture 0.500000
+texture
+anim frame 0.500000 = = anim frame
+vertex 0.500000
+0.500000
+=
+bone vertex frame 0.500000 frame = material
+vertex texture
+frame texture
+texture 0.500000 -1
+material
+1.0 texture = 1.0 -1 -1 anim
+vertex material texture 1.0
+1.0 1.0
+-1 frame = anim = bone material = vertex frame = 1.0
+0.500000 vertex 1.0 texture material 0.500000
+bone texture
+frame vertex 1.0
+frame bone anim = -1 vertex
+bone material 1.0
+bone
+material 0.500000 -1 vertex = 0.500000
+frame 0.500000 anim anim bone texture 0.500000 = = vertex anim 1.0 vertex frame frame frame bone -1 material bone material texture frame
+bone
+0.500000 texture texture material 0.500000 texture anim 0.500000
+vertex 1.0
+0.500000 anim = frame anim
+bone
+bone
+vertex
+frame
+0.500000 anim frame vertex frame bone -1 material frame texture frame bone
+anim
+texture texture
+frame
+1.0 frame
+frame bone texture
+0.500000 frame 0.500000
+0.500000 frame anim material material = frame bone material bone
+-1 vertex anim 0.500000 0.500000
+1.0 frame vertex 1.0 -1 material 0.500000 vertex 0.500000 anim bone material bone vertex = 1.0 anim
+-1
+bone bone frame =
+material 0.500000 0.500000 anim -1 bone bone vertex
+0.500000
+vertex 0.500000 -1 anim
+material frame texture frame frame material 1.0
+anim
+frame
+vertex material
+anim 0.500000
+vertex material bone
+1.0
+anim anim anim
+frame -1 = 1.0 bone
+vertex bone bone
+anim 1.0 0.500000 bone bone material
+= 1.0 vertex = 0.500000
+0.500000 1.0 =
+= 0.500000 1.0 -1 0.500000 vertex vertex 0.500000 vertex frame 0.500000 anim material 1.0 vertex
+anim texture
+anim
+texture
+anim = -1
+1.0 bone 0.500000 vertex
+anim -1 =
+material 0.500000 texture texture texture
+anim
+= texture bone -1 material 0.500000
+= frame
+material
+anim texture texture anim material vertex bone
+texture
+anim
+0.500000 1.0 vertex texture anim -1 bone
+texture = texture
+material material
+anim -1
+anim 0.500000 frame
+0.500000 bone = vertex frame bone 1.0 vertex = vertex texture vertex frame 0.500000 vertex frame bo
\ No newline at end of file
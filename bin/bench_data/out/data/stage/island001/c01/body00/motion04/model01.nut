@@ -0,0 +1,4 @@
+frame vertex texture -1
+= 0.500000
+vertex
+vertex
\ No newline at end of file
@@ -0,0 +1,12 @@
+material
+-1 -1
+=
+1.0 anim
+texture 1.0 -1 -1 vertex material texture anim bone
+bone vertex anim bone frame -1 bone bone = vertex anim 1.0 frame vertex 1.0 = 1.0
+anim bone texture material material
+anim bone frame vertex vertex vertex material bone 1.0
+frame -1 -1 -1 vertex 0.500000 bone = = vertex anim 1.0 bone
+0.500000 texture
+anim 1.0 anim anim bone -1 anim
+material vertex frame vertex 0.50
\ No newline at end of file
@@ -0,0 +1,17 @@
+1.0 -1
+0.500000
+-1
+-1 anim = -1
+texture 0.500000
+0.500000
+=
+-1
+bone
+material
+bone anim texture texture -1
+-1 0.500000
+frame bone material bone frame material
+-1
+material
+anim
+-1 frame 
\ No newline at end of file
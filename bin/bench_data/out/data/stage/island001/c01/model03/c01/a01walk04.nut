@@ -0,0 +1,6 @@
+=
+1.0
+= bone 1.0 vertex
+texture vertex material bone
+= texture frame
+anim = texture bone 1.0 = material anim anim 1.0 0.500
\ No newline at end of file
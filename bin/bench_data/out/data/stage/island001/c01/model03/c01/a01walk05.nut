@@ -0,0 +1,23 @@
+vertex
+texture
+=
+bone 0.500000 vertex bone 1.0 material 1.0 bone vertex frame texture
+vertex -1 anim frame -1 1.0
+anim
+frame texture material
+anim -1 -1
+texture
+bone = frame
+0.500000 = 1.0 = frame 1.0 =
+= anim texture
+bone
+-1 vertex
+anim
+bone material 0.500000 -1
+bone
+0.500000
+=
+=
+bone -1 vertex bone
+anim 1.0 1.0 anim
+anim 0.500000 anim texture 1.0
\ No newline at end of file
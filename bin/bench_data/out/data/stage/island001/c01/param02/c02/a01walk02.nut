@@ -0,0 +1,9 @@
+texture
+bone
+0.500000
+= = frame = = texture 0.500000 vertex -1
+1.0 =
+bone
+1.0
+bone bone vertex texture =
+= fr
\ No newline at end of file
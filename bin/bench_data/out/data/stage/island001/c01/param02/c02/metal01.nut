@@ -0,0 +1,3 @@
+anim bone
+1.0 bone vertex vertex texture vertex frame 0.500000 0.500000 texture vertex texture 1.0 bone vertex
+0.
\ No newline at end of file
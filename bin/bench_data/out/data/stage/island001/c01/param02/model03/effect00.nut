@@ -0,0 +1,40 @@
+material
+= 0.500000 texture anim material material
+=
+material anim
+frame anim bone
+1.0
+1.0 vertex texture bone -1 anim = -1 vertex texture bone
+vertex
+bone
+texture 1.0
+0.500000
+-1 bone 0.500000
+material bone -1 1.0
+1.0 bone -1 -1 = bone frame material frame vertex
+0.500000 -1 = bone 0.500000 = bone
+material 0.500000 = -1 frame 0.500000 = frame vertex -1
+bone anim 0.500000 frame -1 = material
+0.500000 bone
+texture bone anim 0.500000 vertex
+frame texture texture bone 1.0 texture
+0.500000
+anim 0.500000 material vertex
+vertex -1 texture 0.500000 -1 vertex material = 1.0
+1.0 anim texture frame
+texture bone 0.500000 1.0
+frame -1 material material 0.500000 texture frame
+bone frame
+vertex anim anim
+frame
+anim vertex
+vertex bone 1.0 material frame anim texture anim 1.0 -1 anim 1.0
+material
+1.0 material bone = texture
+bone
+frame anim bone
+material bone 0.500000
+-1 -1
+0.500000
+= texture
+vertex 0.500000 1.0 frame mate
\ No newline at end of file
@@ -0,0 +1,320 @@
+vertex 0.500000
+bone bone 1.0 frame 1.0 bone texture
+= -1 vertex 0.500000 = 0.500000
+bone material 1.0
+anim vertex bone material =
+=
+anim bone vertex 0.500000 frame frame bone
+frame = material
+texture
+1.0 bone frame vertex anim
+anim frame frame -1 =
+vertex 0.500000 0.500000 frame = 1.0 bone
+bone anim vertex
+1.0 frame material frame 1.0 frame = texture
+frame
+vertex 0.500000
+anim
+-1 0.500000 1.0
+frame anim vertex 1.0 material frame -1 bone texture texture
+bone 1.0 0.500000
+-1
+=
+= 0.500000 0.500000 anim material -1 1.0 1.0 frame material vertex 0.500000 -1
+bone 0.500000
+=
+vertex
+frame bone
+vertex anim -1 material bone texture vertex = 0.500000 bone anim 0.500000 texture anim 1.0
+-1
+vertex texture 1.0 frame 1.0 anim 1.0
+anim 0.500000 -1 bone anim vertex 1.0 1.0 -1
+bone anim
+-1 texture texture
+frame anim vertex 0.500000 -1 frame
+= vertex
+= anim
+1.0
+=
+-1 vertex texture =
+texture material bone
+frame vertex anim
+material = material frame vertex bone 1.0
+bone 1.0 frame bone
+-1
+material
+1.0
+anim anim
+-1 -1 1.0 frame
+bone 0.500000
+= material vertex 1.0
+frame 1.0
+-1 anim 1.0 = anim material
+1.0 material bone frame bone 1.0 = 0.500000 texture bone bone
+vertex 0.500000 -1 texture
+0.500000
+vertex texture
+frame
+-1 = anim -1 vertex = =
+vertex vertex
+material
+material 1.0 frame 1.0 frame vertex
+= 1.0
+frame bone
+frame -1 frame
+material material -1 1.0 bone 0.500000 vertex
+-1 -1 material
+= -1
+-1 vertex 1.0 0.500000 texture frame
+0.500000 frame vertex -1 1.0 anim -1 anim
+-1
+bone frame material bone
+texture
+-1 anim 1.0 0.500000 material
+-1
+material
+= anim 1.0 bone anim frame texture vertex
+vertex 1.0
+-1 -1 1.0 texture 0.500000 0.500000
+anim vertex
+= anim 1.0
+1.0 bone
+0.500000 anim
+-1 0.500000 vertex
+vertex
+bone
+material -1 anim frame = anim 0.500000
+= texture frame 0.500000 bone 1.0 bone
+-1
+bone -1 -1 frame
+=
+= texture -1 frame bone anim vertex 0.500000 0.500000 anim
+texture vertex
+frame
+texture -1 texture vertex = material 0.500000 = = texture bone material 0.500000 material material
+anim 0.500000 -1 texture -1 1.0 frame material material 0.500000
+bone
+0.500000 texture 1.0 bone anim
+0.500000 1.0 vertex texture texture material anim
+1.0 1.0 anim -1 frame = vertex 1.0 1.0 material
+bone vertex material texture
+material 1.0
+anim = bone texture anim vertex
+= texture texture 1.0
+bone =
+frame 0.500000
+frame
+material
+vertex anim vertex material bone
+anim vertex = texture anim material vertex -1 anim
+bone
+material anim -1
+anim =
+=
+material texture bone
+-1 vertex 0.500000 texture 1.0 = frame = vertex anim
+1.0 -1
+bone -1 -1 -1 bone material
+bone 1.0
+= material -1 texture bone material = frame = vertex vertex -1 frame
+anim -1
+= material anim =
+-1 0.500000
+-1 bone frame texture
+frame anim bone texture
+bone 1.0 vertex 1.0 frame = bone
+bone
+anim
+material
+= bone anim bone 1.0 vertex material
+material
+bone 1.0 material =
+material = -1
+material material material bone
+1.0 frame frame anim material 0.500000
+frame 1.0 0.500000 0.500000
+= 0.500000 = = material
+0.500000 anim vertex anim vertex
+frame frame bone 1.0
+0.500000 material 0.500000
+frame -1
+frame bone texture -1 vertex
+0.500000
+anim = texture 0.500000
+0.500000
+material frame = bone frame 0.500000 1.0 bone frame vertex 0.500000 -1
+vertex bone vertex = texture
+frame -1 = anim
+= -1 vertex vertex frame
+0.500000
+1.0 0.500000 = = frame vertex vertex material vertex 0.500000 anim 0.500000 0.500000 frame texture material
+-1 bone bone =
+bone anim texture vertex 0.500000 frame 1.0
+bone vertex
+material bone = 1.0 = bone frame =
+bone texture frame
+bone texture
+frame frame
+0.500000 0.500000
+1.0 =
+vertex = -1 = -1 frame
+material
+frame
+bone anim = bone texture = frame -1 = 0.500000 1.0
+vertex 1.0 0.500000
+material 1.0 frame
+frame
+bone anim -1
+= = 0.500000
+vertex texture frame -1
+-1
+vertex = anim 1.0 1.0 anim
+-1 texture bone material 0.500000 0.500000 1.0
+0.500000 1.0 1.0 bone -1 =
+0.500000 1.0 bone texture 0.500000 anim -1 -1 anim frame anim
+bone bone frame anim
+frame 0.500000
+-1 -1 frame 0.500000 1.0 material anim
+vertex 0.500000 frame
+material texture = 0.500000 -1 anim anim anim -1 texture 0.500000 -1 0.500000 1.0 vertex anim anim
+= -1 material
+bone 1.0 -1 anim -1
+0.500000
+-1 bone anim = anim = = texture
+1.0 material -1 bone
+vertex anim -1
+bone 0.500000
+bone material vertex -1 texture = -1 texture =
+0.500000 bone anim
+bone 1.0 vertex
+0.500000 -1 anim
+material bone vertex
+= vertex 0.500000 1.0 1.0 -1 frame 0.500000 frame frame texture -1 texture material
+0.500000 vertex
+frame
+= vertex material frame vertex frame 0.500000
+vertex material anim 0.500000 material vertex texture texture material bone material 1.0 -1
+texture 1.0
+bone bone
+texture
+0.500000 1.0 -1
+1.0 0.500000 vertex
+frame frame frame
+texture
+frame frame
+= 0.500000 vertex 1.0 texture anim bone 0.500000 vertex = texture vertex material = frame anim
+texture
+material frame bone 0.500000 1.0 bone -1 = bone
+texture 1.0 1.0
+anim
+bone vertex
+= -1 = texture 0.500000 1.0 vertex material -1 material = = 0.500000
+material -1
+anim material
+anim
+-1 anim
+material texture = = texture vertex frame frame bone frame frame
+-1 material =
+frame 1.0
+frame 1.0
+texture material bone 0.500000
+bone -1 -1 -1 -1 1.0
+texture material -1 -1 =
+-1
+material 1.0
+texture
+1.0 0.500000
+0.500000 -1
+material
+1.0
+vertex
+bone frame
+vertex material texture 0.500000 frame texture 0.500000 = vertex
+1.0 bone vertex 1.0
+frame -1
+anim
+bone material -1 anim texture 0.500000 vertex bone texture
+=
+bone = vertex
+vertex vertex -1
+-1 0.500000 0.500000 1.0
+anim vertex texture 0.500000
+= vertex = anim
+1.0 1.0 anim bone vertex
+texture 1.0 bone
+0.500000 vertex material
+-1 texture
+-1 anim vertex
+frame vertex texture texture frame 1.0 material material anim frame = -1 frame
+anim 0.500000 material -1 material material
+vertex
+1.0 -1 0.500000
+vertex
+material = 1.0 -1 anim -1 frame frame
+vertex
+frame texture bone 1.0 = = texture bone vertex anim vertex
+frame bone 1.0 anim 0.500000 vertex
+anim
+material
+texture anim bone = anim bone anim 0.500000
+= bone vertex bone = material material -1 anim = anim 0.500000 1.0 frame 0.500000 bone -1
+material vertex 0.500000 = anim
+material 1.0 texture anim = frame frame 1.0
+-1 bone texture
+0.500000 1.0 texture 1.0
+0.500000 texture -1 material =
+=
+material = bone material -1 -1
+bone
+texture vertex frame texture material texture material 1.0 bone 1.0 anim 1.0
+anim = anim texture
+vertex anim material
+bone anim
+0.500000 texture 1.0 -1 =
+1.0 1.0 material -1
+= -1 -1
+texture anim frame material 1.0 0.500000 vertex 0.500000
+texture frame
+bone material bone anim
+-1
+frame -1 material 0.500000 anim
+vertex 1.0 vertex bone vertex vertex -1
+1.0 anim frame = -1 frame material bone = 1.0 0.500000 vertex anim 0.500000 0.500000 bone
+1.0 vertex
+frame bone vertex 1.0 texture =
+= texture texture texture 1.0 -1 1.0 vertex frame material frame texture material bone -1
+anim bone
+vertex -1 0.500000 =
+texture frame
+= anim -1 bone bone 1.0
+frame frame frame 1.0 -1 frame
+vertex anim 0.500000 bone frame
+1.0 bone 1.0 vertex 0.500000
+-1 1.0 vertex frame material =
+1.0 -1 bone anim 0.500000
+texture frame anim
+0.500000 bone bone = material bone texture texture bone frame
+vertex
+vertex -1 -1
+anim
+anim 1.0 anim
+anim 1.0
+-1 bone
+frame frame = 1.0
+bone = = bone
+0.500000 bone anim anim = anim = vertex
+bone 0.500000 bone vertex material -1
+0.500000 0.500000 texture anim
+1.0 bone bone material texture vertex vertex material bone vertex 0.500000 1.0 frame frame texture
+frame frame = bone material
+texture 1.0
+frame -1 = material -1
+-1 0.500000 vertex
+1.0 material = vertex 1.0 0.500000 1.0 bone vertex 0.500000
+frame frame 1.0 1.0 frame
+0.500000 anim anim texture texture frame 1.0 texture =
+bone vertex material texture frame vertex = 0.500000 -1 bone 1.0 -1 1.0
+bone bone anim
+0.500000 0.500000 anim =
+frame
+1.0 -1 frame 
\ No newline at end of file
@@ -0,0 +1,3 @@
+=
+vertex 1.0 bone 0.500000
+frame fra
\ No newline at end of file
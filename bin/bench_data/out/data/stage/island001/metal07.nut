@@ -0,0 +1,4 @@
+anim frame
+material
+bone vertex bone 0.500000
+0.500
\ No newline at end of file
@@ -0,0 +1 @@
+{2=vj''mq` 	+v-VF,Db(jh$O֦%$)J&
\ No newline at end of file
@@ -0,0 +1,93 @@
+1.0
+frame frame
+= frame anim
+anim vertex -1
+0.500000 texture texture -1 anim frame
+vertex -1 material vertex frame 0.500000 frame bone frame
+frame
+= material vertex 0.500000 1.0 = -1
+vertex
+1.0 0.500000 = -1
+1.0 anim texture anim
+bone 0.500000
+= 0.500000 = =
+frame vertex texture vertex vertex
+frame
+frame frame
+-1 bone 0.500000 texture vertex anim
+0.500000
+texture = = bone vertex bone anim -1
+anim texture vertex vertex texture texture
+1.0 material -1
+bone -1 bone vertex vertex 1.0 = material texture = -1 vertex texture texture frame 1.0 texture texture
+texture 1.0
+vertex
+anim 0.500000 texture
+texture
+material material = vertex
+texture bone material texture texture 0.500000
+1.0 anim
+-1 anim
+material
+0.500000 0.500000
+frame 1.0 anim bone
+-1 = 1.0 bone
+vertex
+texture vertex
+frame = -1 anim material 0.500000 vertex 0.500000 -1 texture material
+material -1 frame anim vertex 0.500000 = material
+1.0 material vertex -1
+1.0 vertex
+bone material vertex vertex -1 anim anim 1.0
+anim
+bone 1.0
+= -1 material
+texture vertex =
+frame material
+1.0 texture -1
+texture
+anim -1 texture anim texture frame anim material anim
+1.0
+anim -1 = 1.0 1.0 texture
+=
+1.0
+-1 1.0 texture =
+bone bone 0.500000 -1 1.0 texture
+material bone
+-1 0.500000 material =
+texture anim -1 frame bone = bone = =
+1.0 texture 1.0 anim bone 1.0
+0.500000 1.0 anim
+= 0.500000 bone frame bone =
+vertex 0.500000 -1 frame frame
+texture
+texture = vertex
+0.500000 material texture bone
+= = 1.0 bone frame 0.500000 bone frame
+frame -1 texture 1.0
+texture vertex frame vertex 0.500000 material 1.0 1.0 anim =
+0.500000 0.500000 frame 0.500000 0.500000 material
+material 1.0 anim = texture
+frame 1.0
+bone
+bone
+0.500000
+material anim 0.500000 vertex 1.0 anim 0.500000 =
+1.0 bone bone -1 = bone bone
+frame frame texture vertex 1.0 anim texture bone
+= texture
+= material = frame -1 anim
+texture texture 0.500000 -1
+-1 bone 1.0
+frame 1.0 -1 material
+vertex vertex anim vertex bone vertex vertex frame frame vertex bone
+vertex bone material frame
+1.0 = material
+1.0 bone anim anim frame anim 0.500000 bone
+frame bone material
+1.0 0.500000 frame material frame
+vertex texture anim frame bone vertex -1 1.0 0.500000 1.0 bone
+anim -1 bone
+bone 1.0 bone
+material
+frame a
\ No newline at end of file
@@ -0,0 +1,181 @@
+-1 -1 material bone frame
+texture -1 = = material material
+bone = = bone
+0.500000 1.0 frame
+0.500000 vertex texture vertex
+material
+anim
+anim vertex 1.0
+1.0
+=
+material 1.0 anim bone bone 1.0 1.0 texture
+frame
+vertex
+frame vertex = anim material bone
+bone
+0.500000 0.500000
+anim vertex bone
+vertex -1 texture anim = vertex bone = = texture
+0.500000 texture 0.500000 -1 frame 0.500000 bone vertex = anim texture
+material -1 0.500000 0.500000
+texture
+-1
+1.0 texture texture
+bone material texture anim texture
+-1
+-1 vertex bone frame 1.0 anim frame vertex = material bone anim bone vertex
+anim anim 0.500000 texture
+bone
+texture bone
+1.0
+vertex vertex = texture
+-1 material vertex vertex = texture frame anim
+1.0 0.500000 = vertex material frame
+= texture material 0.500000 0.500000 anim
+bone material
+vertex
+vertex texture 1.0 vertex vertex frame = bone 1.0 = -1 frame
+=
+frame 0.500000 bone texture 1.0 vertex texture material
+= texture material
+0.500000 texture bone 0.500000 frame
+0.500000
+= 0.500000 = material 0.500000
+frame frame frame texture = 1.0 0.500000 = 1.0
+= anim texture anim = material
+anim frame frame -1 0.500000 vertex 1.0
+1.0
+bone
+bone
+vertex frame material
+-1 anim
+0.500000 texture vertex 0.500000 anim texture anim
+1.0 texture bone frame texture -1 texture material
+1.0
+bone bone
+-1 material vertex vertex 1.0
+= 0.500000
+vertex =
+0.500000 material bone anim frame anim = bone material anim bone
+0.500000 bone anim frame bone 1.0 1.0 vertex 0.500000 =
+0.500000 texture
+bone material
+0.500000 bone -1 material 0.500000 vertex bone 1.0
+1.0 material
+material = frame
+frame vertex 1.0 anim material = bone
+bone material 1.0
+1.0
+anim vertex vertex -1 = bone 0.500000
+1.0 -1 anim 0.500000 anim vertex frame
+=
+bone material texture bone vertex = anim texture 1.0 vertex material 0.500000
+vertex texture frame vertex anim
+= material vertex
+frame
+0.500000
+bone texture =
+0.500000 texture 0.500000 material 1.0 = =
+1.0 -1 -1
+vertex material 1.0
+material 0.500000
+1.0 anim -1 =
+anim -1 texture -1
+anim anim bone 0.500000 texture anim
+= = vertex
+0.500000 1.0
+anim anim vertex texture 1.0 frame 1.0 -1 -1 vertex
+frame -1 anim
+-1
+texture
+frame material frame bone vertex frame 0.500000 0.500000 -1 texture -1 -1 frame
+0.500000
+1.0
+=
+material bone material texture
+1.0 1.0
+=
+frame 1.0 =
+anim
+bone bone vertex frame 0.500000 material
+1.0
+0.500000 1.0 1.0 = 1.0 =
+frame 0.500000
+bone bone material
+anim vertex
+texture bone
+anim 1.0
+frame 0.500000 vertex 0.500000 frame material 1.0 vertex -1 material vertex
+material
+=
+frame vertex anim = 1.0 material material
+anim bone -1 vertex texture texture vertex 0.500000 1.0
+= texture
+= -1 texture -1 -1 material
+material
+bone bone
+material
+=
+frame material -1 vertex anim 0.500000 -1 texture
+0.500000 = texture anim
+= 0.500000 1.0 bone 1.0
+0.500000
+anim
+0.500000 -1 1.0 -1 anim texture 1.0 = =
+texture -1 1.0 frame
+0.500000
+=
+bone bone frame
+texture bone vertex vertex frame bone = 0.500000
+texture anim vertex -1
+-1 texture 1.0 -1 = anim
+1.0 material 1.0
+bone -1
+frame 0.500000 1.0 anim 1.0 1.0 texture 1.0
+vertex
+material -1 -1 1.0 0.500000 bone texture texture
+frame -1
+= anim texture 0.500000 1.0 texture = = 0.500000 vertex frame
+frame texture texture 1.0 1.0
+material
+bone anim
+= anim vertex -1
+= bone 0.500000 = 0.500000
+frame material
+anim
+1.0 bone -1
+texture vertex frame bone 0.500000 0.500000 1.0 1.0 bone
+anim frame bone
+frame 0.500000 bone anim
+0.500000 bone vertex
+material = -1 vertex material vertex material frame 0.500000 vertex vertex -1 -1
+= 1.0 texture
+texture
+vertex 0.500000
+1.0 bone
+material frame vertex frame -1 material 1.0 1.0 bone 1.0 frame bone bone frame -1 1.0
+texture
+anim
+= frame bone 1.0
+bone
+0.500000 -1 vertex vertex bone
+bone = frame
+material
+material 0.500000 vertex anim -1 frame 1.0 -1 anim bone = 1.0 bone 0.500000 -1 1.0 anim anim
+frame
+anim
+anim
+= 0.500000
+frame vertex frame anim 0.500000 -1
+0.500000 1.0 material texture vertex -1 = 1.0 frame -1
+vertex
+frame anim anim 1.0 material bone 0.500000 texture
+vertex 1.0 frame
+0.500000 = 1.0 material 1.0 bone
+bone frame material 1.0 texture 0.500000 vertex 0.500000
+0.500000 frame vertex vertex
+anim 1.0
+texture 0.500000 material
+= bone texture anim 1.0
+texture anim 1.0 material
+-1 vertex bon
\ No newline at end of file
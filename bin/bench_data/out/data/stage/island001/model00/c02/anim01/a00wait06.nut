@@ -0,0 +1,6 @@
+anim
+-1 anim =
+-1 texture
+bone material texture
+anim = anim frame
+= frame
\ No newline at end of file
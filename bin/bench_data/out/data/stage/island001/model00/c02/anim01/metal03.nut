@@ -0,0 +1,271 @@
+material 1.0 frame = bone 1.0 0.500000
+vertex texture
+anim vertex
+1.0 0.500000 1.0 -1 1.0 0.500000
+bone 1.0
+anim anim frame vertex 0.500000
+= frame material texture
+1.0
+anim -1 frame
+anim material 0.500000
+1.0
+texture 0.500000 material bone
+material bone anim vertex = material frame anim -1 =
+-1 bone vertex
+= anim -1 texture 1.0 vertex bone texture
+-1 bone
+vertex frame =
+anim 1.0 frame bone
+material = vertex vertex 1.0 bone = = = vertex vertex anim bone vertex texture bone 1.0 0.500000 1.0 frame frame = 1.0
+1.0
+frame bone anim texture anim
+-1 frame
+bone 0.500000 bone vertex
+-1 = frame material frame
+texture texture 1.0 material 1.0
+anim -1 material
+0.500000 material
+anim texture 0.500000 -1 anim
+frame
+material
+material bone -1
+vertex material
+1.0 = 0.500000 vertex = texture texture 0.500000 vertex bone texture frame -1 texture
+1.0 material vertex bone material bone texture bone
+0.500000 =
+anim
+= -1 -1 1.0 frame 0.500000 0.500000
+bone
+0.500000
+anim -1 -1 material
+anim bone anim anim -1 frame texture
+= 0.500000 bone texture vertex 0.500000 frame 0.500000
+material anim
+texture 1.0 1.0 1.0 =
+= anim bone 0.500000 anim texture 0.500000 vertex material vertex vertex material
+frame
+0.500000
+-1 -1 bone -1 anim anim frame 0.500000
+1.0 frame
+texture
+0.500000
+bone texture -1
+material texture
+-1 material -1 = texture 0.500000 = bone 1.0 0.500000 -1 material
+vertex 0.500000 vertex
+material = vertex
+= texture =
+material vertex texture
+frame frame texture 1.0 bone -1
+anim texture anim
+texture texture texture texture
+anim 1.0
+texture
+frame material vertex
+1.0 0.500000
+0.500000 anim -1 =
+frame texture
+=
+0.500000 0.500000
+-1
+0.500000
+1.0 vertex vertex 0.500000
+bone
+0.500000 -1
+material frame 1.0
+anim texture anim
+material
+texture bone
+0.500000
+0.500000 texture bone 1.0
+bone
+= anim bone
+anim
+-1 0.500000 -1 0.500000 1.0 frame 0.500000 -1 = 0.500000 vertex
+bone texture
+frame material
+1.0 1.0
+vertex 0.500000 anim = texture
+bone = = anim -1 -1 -1
+texture
+material =
+0.500000 vertex vertex vertex bone =
+bone anim texture frame
+anim =
+vertex 0.500000 anim vertex 1.0
+-1 1.0
+0.500000 = frame material texture
+vertex
+vertex texture frame frame material
+= vertex 1.0 =
+vertex bone bone material
+vertex vertex =
+vertex
+bone bone material 1.0 vertex bone 1.0 material
+vertex 0.500000 bone frame 0.500000 frame = 0.500000 frame material anim 1.0 texture
+vertex bone
+vertex
+vertex 1.0 =
+texture material texture anim
+vertex bone -1
+anim = anim material material
+bone -1 texture
+anim 0.500000 =
+1.0 =
+frame vertex 1.0 bone
+anim -1 texture texture anim bone 1.0 bone -1 anim bone
+0.500000
+-1
+texture
+material 1.0 material vertex texture
+= material 0.500000 0.500000 texture texture material =
+anim =
+1.0 vertex texture vertex
+anim
+0.500000 anim texture -1
+1.0 bone 1.0 vertex bone texture 1.0 -1 vertex anim 1.0
+vertex 0.500000 frame anim anim bone 1.0
+frame 0.500000
+0.500000 vertex 0.500000
+= anim anim
+material texture bone material = 0.500000
+material
+frame material 1.0 bone =
+=
+vertex frame
+texture material material
+vertex bone
+material anim
+material material 1.0 frame bone 0.500000
+anim
+bone
+1.0
+frame texture material =
+-1 1.0 1.0 = texture bone
+material -1 0.500000
+bone -1 anim bone texture
+0.500000
+vertex -1 1.0 bone
+material anim vertex frame frame material 1.0 frame 0.500000 bone frame
+bone -1 bone texture
+frame = anim texture bone
+= vertex frame = 1.0 0.500000 vertex 0.500000
+bone -1
+vertex
+1.0 = texture
+texture
+bone anim
+1.0 vertex bone
+1.0 -1 = texture -1
+frame vertex -1 frame frame anim anim -1 vertex bone 0.500000 0.500000
+bone frame bone
+0.500000 material material vertex texture anim 1.0 vertex
+texture vertex material bone
+= -1 = = vertex
+0.500000 0.500000
+texture bone
+1.0 = texture anim bone 0.500000 bone frame = texture =
+bone 0.500000 bone 0.500000 -1 texture 0.500000 anim vertex bone
+material = texture material frame vertex frame
+-1 =
+1.0 anim frame texture 0.500000 =
+frame bone
+0.500000
+frame vertex texture 0.500000 frame
+0.500000
+texture anim material
+material
+bone 1.0 vertex
+texture -1 0.500000 1.0 vertex vertex
+vertex frame texture frame
+1.0
+material 1.0 anim
+material -1
+0.500000 = vertex
+-1 frame
+bone frame frame bone texture texture
+material =
+texture anim
+vertex -1 -1 frame material frame
+frame material 1.0 material vertex -1 -1 1.0
+anim
+frame 0.500000 = frame
+vertex material frame 1.0 bone material
+material 0.500000 anim frame vertex 0.500000 texture bone -1
+0.500000 vertex -1 = frame = = vertex
+bone
+frame
+anim bone material
+= = 0.500000
+0.500000 1.0 anim 0.500000 vertex frame
+anim
+texture bone frame
+1.0 material
+-1 texture 1.0 1.0 material = bone
+bone texture
+vertex texture vertex texture material
+material -1 0.500000 bone
+texture 0.500000 1.0 1.0 texture texture = anim 0.500000 0.500000 =
+texture texture vertex -1 -1 anim 0.500000 bone = = 1.0 frame vertex 0.500000 anim anim frame material frame =
+vertex bone =
+-1 = material anim -1 0.500000
+anim 1.0
+= bone = texture -1 frame texture
+-1 bone bone
+texture
+vertex 1.0 -1 anim texture
+-1 = 0.500000 texture bone texture
+anim 0.500000 0.500000 material anim frame frame -1 material 0.500000
+0.500000
+texture -1
+texture
+frame
+material bone 1.0 bone material frame bone
+1.0 0.500000 material -1 = 0.500000 material
+frame
+1.0 texture = vertex material texture vertex texture anim = bone texture
+material frame = anim 1.0
+vertex 0.500000 1.0 bone anim = = = bone material
+bone vertex bone vertex vertex = bone
+anim 1.0 texture
+= -1 bone
+material bone anim frame = -1 anim 0.500000 frame material -1 vertex frame -1 anim -1 texture 0.500000 -1 1.0 vertex anim bone -1 frame 1.0 anim vertex bone
+frame =
+texture anim =
+vertex 0.500000 texture -1 vertex
+bone = anim frame
+-1 frame
+-1 vertex material
+-1 anim texture
+bone vertex
+vertex
+frame texture material vertex texture
+anim = =
+frame material bone
+1.0 vertex
+-1 material bone
+0.500000 = bone material
+anim
+1.0
+texture vertex frame texture
+1.0 1.0
+anim bone anim frame
+texture = vertex vertex = 0.500000 vertex =
+0.500000 0.500000 vertex -1 vertex -1
+0.500000 -1
+anim -1
+= 0.500000 material texture 0.500000 -1 frame 1.0 bone vertex 0.500000 frame
+= = bone
+= material
+-1
+1.0 texture
+material -1
+anim texture 0.500000
+bone texture
+vertex = vertex 0.500000 -1
+-1 bone
+0.500000 anim
+= = bone = frame anim -1 bone bone -1
+bone
+= material
+frame 0.500000 vertex 
\ No newline at end of file
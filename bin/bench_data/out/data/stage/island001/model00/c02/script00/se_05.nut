@@ -0,0 +1,23 @@
+bone -1 1.0 texture = vertex frame
+-1
+material
+frame
+0.500000 1.0
+anim material anim
+frame = bone
+-1 frame
+= -1
+vertex texture = =
+anim
+material vertex anim anim -1
+texture vertex
+material
+vertex = bone
+1.0 texture frame anim material 1.0 bone bone vertex
+frame
+frame bone -1 vertex
+0.500000 0.500000 0.500000 0.500000 material
+material
+= texture bone
+1.0 -1 -1
+1.0 texture texture material -1 0.500000
\ No newline at end of file
@@ -0,0 +1,154 @@
+frame 0.500000
+-1
+1.0 frame = bone -1 anim bone = 1.0 0.500000 =
+1.0 1.0 vertex bone texture 1.0
+= = material anim vertex 1.0
+anim
+= material bone vertex
+-1
+bone 0.500000
+frame anim vertex bone frame
+bone material vertex frame = texture vertex
+-1 material vertex bone bone vertex
+0.500000
+0.500000 bone vertex 0.500000 texture 1.0 1.0 texture texture
+texture 1.0
+1.0 frame bone material vertex
+anim 1.0 bone vertex
+frame anim texture
+frame texture = texture frame anim texture vertex anim anim vertex bone 0.500000
+1.0 material 0.500000 -1 material 0.500000
+vertex 1.0 bone
+texture bone frame texture frame 0.500000
+vertex texture 0.500000 -1
+-1 1.0
+anim 0.500000
+-1 bone 0.500000 1.0 bone
+1.0 = anim
+anim anim
+= texture
+bone 1.0 vertex -1 material
+0.500000
+material frame anim -1 -1 -1 bone material = 0.500000 vertex
+frame anim texture
+frame -1
+frame anim
+vertex 1.0 0.500000
+= vertex
+= anim
+material
+vertex -1 bone
+0.500000 anim material
+= = material material 0.500000 anim
+anim texture
+frame
+vertex vertex bone frame bone
+1.0 material 0.500000 frame
+vertex vertex
+= 0.500000 -1 = 1.0 1.0 -1 1.0 anim anim frame bone
+-1 frame
+=
+0.500000 anim vertex
+bone 1.0
+material 1.0 bone bone = material texture
+vertex 0.500000
+1.0
+-1 bone anim bone -1 material vertex anim vertex bone
+anim material bone vertex 1.0 anim = vertex
+texture
+texture 0.500000 texture = = texture 0.500000 anim material
+anim texture material = = material anim anim texture
+material -1 frame 0.500000 frame vertex vertex anim -1 = material bone 1.0 vertex material frame anim vertex = 0.500000
+0.500000 frame frame 0.500000 anim 1.0 bone frame frame 1.0
+vertex
+vertex
+texture
+0.500000 0.500000 -1 -1 texture frame material vertex anim 0.500000
+texture 0.500000
+0.500000 frame 1.0 material
+1.0 texture 1.0 anim texture -1 -1 frame material vertex
+bone 0.500000 vertex -1 = = 1.0 texture vertex =
+material
+-1 1.0 material
+bone 1.0
+vertex -1 texture
+= -1
+texture vertex vertex texture
+vertex
+= material bone 0.500000
+vertex 1.0 = anim bone texture -1 texture texture = bone texture 0.500000 vertex frame
+-1 =
+texture vertex vertex frame 1.0 frame =
+anim anim
+frame
+0.500000 0.500000
+material
+texture anim 1.0
+1.0
+material bone = material = 0.500000
+anim 0.500000 vertex anim -1
+-1 -1 bone vertex anim material
+vertex
+bone
+0.500000 frame vertex frame bone 0.500000
+anim = -1 texture anim
+bone
+vertex
+bone =
+texture 1.0 vertex
+1.0 vertex frame
+anim material 0.500000 frame
+material material
+anim anim = anim
+= texture 1.0 0.500000 = texture bone anim material
+frame material 1.0 anim 1.0 texture
+= bone material
+frame = 1.0 1.0 0.500000
+material
+frame
+frame =
+-1
+material bone texture 0.500000 1.0 =
+bone
+frame frame 1.0 vertex frame texture 0.500000 texture texture
+1.0 0.500000 frame frame material texture bone anim 1.0
+frame texture 0.500000 1.0 anim bone 1.0
+-1 -1 anim anim 0.500000 material material
+texture
+1.0 frame 1.0
+material
+material 0.500000 = vertex anim
+-1 -1 0.500000
+frame anim frame frame 1.0 1.0 texture frame frame
+material anim frame
+frame anim vertex
+=
+frame 1.0 =
+0.500000 material 1.0 bone vertex texture
+-1 1.0 frame = frame
+anim
+-1
+material texture anim material bone 1.0
+frame anim
+0.500000 texture 1.0 = -1 frame
+material = material anim 0.500000 bone bone anim =
+bone bone anim 1.0 texture
+material texture 0.500000
+vertex
+-1 bone
+0.500000 -1
+texture anim
+vertex frame
+0.500000
+bone 0.500000
+=
+frame vertex -1 frame
+vertex -1 anim vertex
+= vertex texture 0.500000 vertex frame
+vertex
+= texture
+frame
+frame
+material
+material texture frame texture vertex
+1.0
\ No newline at end of file
@@ -0,0 +1,85 @@
+vertex
+material
+vertex
+material frame
+0.500000
+vertex = = texture vertex anim =
+vertex
+0.500000 = = -1
+material
+vertex texture
+anim bone texture anim
+-1 anim vertex -1 -1 frame 1.0 vertex 1.0
+=
+material anim 1.0 anim
+-1 bone material
+anim 1.0 0.500000 frame 1.0
+texture 0.500000 texture =
+1.0 texture 0.500000
+vertex bone 0.500000 = vertex texture material
+0.500000 0.500000 -1 material
+vertex bone texture -1 bone
+-1
+vertex = vertex -1
+bone
+-1
+vertex
+= vertex bone
+vertex
+-1 frame 1.0 bone vertex 1.0 texture vertex
+vertex 0.500000
+vertex =
+= material material
+bone texture 0.500000 vertex 1.0 -1 material frame bone frame vertex frame bone = -1 1.0 1.0 = material -1 1.0 material anim 1.0 -1 texture material texture 1.0
+1.0 anim bone vertex 0.500000 anim texture texture
+0.500000 =
+1.0 bone anim material bone
+= bone 0.500000 frame vertex = 1.0 1.0 texture = material texture
+frame material anim
+anim
+= vertex
+-1
+bone anim 0.500000 = frame 0.500000 texture
+0.500000 texture 1.0
+material material anim material vertex
+-1 vertex texture = anim bone frame vertex
+=
+0.500000 frame material 0.500000 1.0 -1
+vertex
+0.500000 1.0 -1 anim texture texture
+0.500000 = texture -1
+1.0
+= 0.500000 frame -1 -1 bone anim 1.0 bone frame
+frame
+anim 1.0 0.500000 0.500000 bone material
+material
+-1
+frame texture
+bone
+=
+0.500000 1.0 anim -1 frame texture texture vertex anim texture
+= -1
+anim
+anim -1
+material
+vertex 1.0 = -1 material anim texture
+= material frame = bone -1 -1
+anim texture material 0.500000 texture 0.500000 vertex vertex =
+-1 material
+anim 0.500000 frame
+-1
+anim frame 1.0
+bone 1.0 frame
+-1 texture 1.0 0.500000
+anim 0.500000 1.0 material = 1.0 texture anim
+texture anim anim
+texture
+vertex material
+bone vertex
+bone
+0.500000 anim material -1 1.0 1.0 -1
+vertex 1.0
+-1 -1 vertex material -1 -1 vertex anim
+texture = texture 0.500000 material frame material bone vertex -1 anim
+1.0 vertex vertex
+vertex
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame
+1.0 1.0
+material -1
+anim -1 -1 1.0 anim
+-1 -1
\ No newline at end of file
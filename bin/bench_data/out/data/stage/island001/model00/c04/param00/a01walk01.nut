@@ -0,0 +1,28 @@
+vertex frame texture anim vertex vertex
+texture
+texture =
+1.0
+frame 1.0 anim
+frame 0.500000 1.0 0.500000
+0.500000 -1 anim
+anim
+-1 material frame -1 0.500000 0.500000
+1.0
+vertex texture vertex
+0.500000 anim
+frame
+frame
+1.0
+1.0 1.0 material material -1
+frame
+-1
+0.500000 0.500000
+frame material anim = texture frame texture
+bone
+vertex 1.0 texture 1.0
+material texture 0.500000 1.0 vertex
+material vertex
+texture 0.500000 -1
+material
+bone 0.500000 vertex 1.0 anim
+-1 0.
\ No newline at end of file
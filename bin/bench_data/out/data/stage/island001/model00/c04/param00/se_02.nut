@@ -0,0 +1,6 @@
+0.500000
+anim 1.0 texture
+material texture
+-1 1.0 material
+texture
+ma
\ No newline at end of file
@@ -0,0 +1,68 @@
+vertex texture texture anim
+texture texture -1 material bone 1.0 texture
+1.0 material bone frame 1.0 anim 0.500000
+0.500000 = material -1 vertex = bone 0.500000 0.500000 vertex vertex vertex
+material 1.0
+= material
+vertex
+-1 -1 texture = bone anim material texture frame material
+material
+anim
+-1
+texture frame 1.0
+bone anim texture -1 -1
+anim 0.500000 frame frame
+frame 0.500000
+material 1.0 vertex -1 texture bone 1.0
+0.500000 1.0
+texture frame
+vertex 0.500000 texture = bone
+material anim
+bone material vertex bone =
+vertex
+bone 1.0 0.500000 bone 0.500000 = vertex = anim anim texture texture 0.500000 -1 material texture 1.0
+anim 1.0 0.500000 -1 -1
+-1 texture 1.0
+frame frame
+1.0
+bone
+material 0.500000 -1 vertex vertex 0.500000 anim bone vertex 0.500000 material 1.0 1.0
+-1 = 1.0 texture bone frame vertex bone
+0.500000 bone vertex bone frame frame 0.500000 -1 vertex 0.500000 material
+anim material 0.500000 1.0 frame -1 vertex vertex 1.0 1.0 bone bone 0.500000 -1
+anim anim = 1.0
+-1 anim material vertex
+-1 0.500000 texture vertex material -1 frame 0.500000 frame
+anim
+texture -1 texture 0.500000 frame anim 0.500000
+=
+0.500000 -1
+texture
+= = vertex 1.0
+-1
+frame material
+vertex anim -1 texture vertex 1.0 material material texture vertex 0.500000 anim vertex
+0.500000 material texture anim material 1.0 vertex
+texture 1.0
+= vertex bone
+1.0 1.0 = -1 1.0 = 1.0
+anim 1.0 material frame 1.0 = = 0.500000 0.500000 texture
+bone 0.500000 texture
+bone texture
+0.500000
+frame
+frame = material frame
+material
+1.0
+material = bone = frame 0.500000 frame material
+0.500000
+-1
+texture frame 1.0 vertex texture 0.500000 -1 material frame texture = 0.500000
+vertex material frame vertex
+anim
+texture =
+1.0 vertex 0.500000 material = -1 material 1.0 material = anim
+frame frame 1.0 =
+frame anim material frame = material 1.0 frame 0.500000 frame = 1.0 bone material
+bone vertex
+texture bone anim anim anim material bone = = textur
\ No newline at end of file
@@ -0,0 +1,4 @@
+= frame material
+vertex 0.500000
+texture
+-1 material fr
\ No newline at end of file
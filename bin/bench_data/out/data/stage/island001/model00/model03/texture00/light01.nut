@@ -0,0 +1 @@
+vertex -1 texture 1.0 anim vertex material 1.0 vertex b
\ No newline at end of file
@@ -0,0 +1,19 @@
+material texture 0.500000 bone texture frame frame
+vertex vertex vertex vertex texture 1.0 0.500000
+-1 -1 texture
+-1 1.0 1.0 frame texture frame material
+bone anim
+frame texture
+=
+0.500000
+frame = = anim -1 bone frame
+-1
+bone
+bone
+texture anim texture
+= = -1 = = =
+material = frame material
+anim texture material
+1.0 texture vertex
+-1 = -1 material 1.0 -1 1.0 anim texture
+frame material = frame 0.500000 material = -1 material te
\ No newline at end of file
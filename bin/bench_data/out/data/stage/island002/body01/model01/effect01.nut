@@ -0,0 +1,76 @@
+vertex -1 bone
+-1 bone
+-1
+anim texture
+= material
+bone vertex 0.500000 0.500000 anim material vertex -1 = bone =
+bone bone material
+texture material anim
+-1 texture
+texture =
+anim 0.500000 anim
+bone 1.0 anim bone material
+bone 0.500000 = 1.0 anim frame
+bone
+-1 -1 -1 -1 frame anim bone = bone bone anim vertex material
+material frame vertex
+texture vertex =
+vertex material bone
+frame bone
+vertex anim -1 vertex -1 material material -1 anim 0.500000 material
+vertex frame
+texture bone = = texture frame texture = -1 bone
+texture frame 1.0 -1
+=
+0.500000 vertex = = texture 1.0 0.500000 = 0.500000
+vertex = 0.500000 -1 =
+=
+material -1 1.0
+vertex vertex
+vertex -1
+0.500000 vertex anim -1 0.500000 bone
+0.500000 1.0 0.500000
+anim 0.500000 1.0 1.0 texture -1 bone vertex frame
+bone
+bone =
+material =
+frame material anim vertex bone 0.500000
+1.0 -1
+-1 -1 texture 1.0 1.0 anim -1 0.500000 material 1.0
+vertex frame
+material 1.0
+material vertex -1 0.500000
+material bone frame bone vertex 1.0 -1 0.500000
+anim frame
+frame 1.0 1.0 anim anim anim 0.500000 0.500000 frame
+=
+vertex 1.0 1.0 bone anim
+0.500000 = 1.0 material
+material material frame frame bone -1
+anim 1.0 bone 0.500000
+material 1.0 -1 -1 bone frame = material vertex
+vertex =
+vertex
+texture frame
+bone
+frame -1 frame -1 1.0 -1 vertex
+0.500000 texture
+1.0 = 1.0
+1.0
+=
+frame
+texture texture frame
+anim
+anim 0.500000
+0.500000 = frame 1.0 -1
+material bone = bone material 0.500000 texture = bone material -1
+anim
+1.0 material anim =
+= 1.0
+0.500000 =
+frame frame 0.500000 vertex frame
+material anim
+vertex bone = 1.0 material frame texture texture frame texture anim material vertex
+vertex = vertex vertex = bone 0.500000 texture 0.500000
+texture 1.0 material frame material texture
+frame anim frame t
\ No newline at end of file
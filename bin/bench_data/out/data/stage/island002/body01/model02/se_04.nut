@@ -0,0 +1,6 @@
+frame anim 1.0
+1.0 vertex = -1
+1.0 1.0
+texture 0.500000
+texture bone 0.500000 1.0 texture frame vertex vertex anim material
+texture a
\ No newline at end of file
@@ -0,0 +1,25 @@
+frame bone = =
+1.0 anim 1.0 = 1.0
+1.0
+=
+texture 0.500000 0.500000
+1.0 texture
+bone vertex 0.500000 0.500000
+texture vertex
+vertex = 0.500000
+texture
+vertex frame = vertex vertex vertex frame
+bone vertex bone
+frame
+0.500000 vertex vertex 1.0 bone -1 1.0 vertex
+0.500000
+0.500000 material
+bone texture = -1 -1 anim
+material = anim 0.500000 frame anim
+anim
+vertex 1.0 vertex anim
+texture -1 =
+1.0 anim
+1.0
+texture -1 frame
+frame texture ma
\ No newline at end of file
@@ -0,0 +1,15 @@
+frame material material material
+texture vertex
+0.500000 0.500000 frame anim
+1.0 vertex bone bone 0.500000
+anim =
+frame -1 anim -1 vertex anim 1.0 anim frame 0.500000 material -1 frame bone vertex frame
+bone
+0.500000 = material 1.0 texture 1.0 anim
+anim = bone
+vertex
+texture texture vertex
+1.0 -1 material
+0.500000 1.0 texture
+1.0 -1 = material 1.0 -1 frame vertex 0.500000 = =
+textu
\ No newline at end of file
@@ -0,0 +1,138 @@
+anim -1 1.0 bone
+1.0 0.500000 1.0 bone
+=
+0.500000 texture bone frame 1.0 -1 bone
+anim texture vertex frame -1 frame
+bone
+material bone 0.500000 =
+vertex frame
+0.500000
+frame bone material material
+-1 bone material 1.0 0.500000 frame anim
+-1 1.0 0.500000 -1 1.0
+bone
+0.500000
+1.0
+= frame =
+texture 0.500000 texture 0.500000 anim 0.500000 anim anim
+bone vertex frame -1 -1 bone -1
+bone -1 0.500000 =
+0.500000 = material
+1.0 texture vertex -1 -1
+0.500000
+vertex anim bone =
+frame = frame bone vertex 0.500000 vertex frame frame
+vertex
+-1
+anim
+texture
+frame 0.500000
+frame bone 0.500000
+1.0 0.500000
+1.0
+anim anim
+1.0
+anim bone 1.0 material vertex 1.0 frame = bone
+1.0 bone frame bone frame
+1.0 bone vertex frame
+=
+anim anim frame texture
+texture bone
+material = 1.0 vertex
+anim -1 frame anim 1.0 vertex vertex 0.500000
+material 0.500000 bone
+0.500000 anim anim frame
+-1 0.500000 0.500000 frame 0.500000 1.0 bone = frame
+frame
+1.0 =
+anim anim -1 1.0 1.0 0.500000 texture vertex anim anim
+texture 0.500000 frame 1.0 = 0.500000 1.0
+vertex =
+anim = 0.500000 material bone texture
+bone vertex vertex texture = 1.0 texture =
+= anim anim bone
+frame = anim 0.500000 texture
+frame anim =
+frame =
+0.500000
+material material
+frame
+frame -1 -1
+= vertex -1 vertex frame bone vertex texture texture 1.0 vertex texture -1 0.500000 bone
+1.0 bone 1.0 frame
+= 1.0 anim bone material =
+material -1
+texture =
+material -1
+vertex -1 vertex texture
+frame 1.0 1.0 texture 1.0 1.0 vertex texture texture 0.500000 frame bone = texture
+0.500000
+-1 texture 1.0 material texture -1 1.0
+anim anim -1
+-1
+1.0
+1.0 -1 0.500000
+bone 1.0 anim frame
+=
+0.500000 vertex vertex 1.0 = anim
+= material = texture vertex
+frame material -1 0.500000 bone anim = anim vertex 1.0 = =
+-1 anim texture material anim
+0.500000
+-1 1.0
+-1 anim 1.0 = frame 0.500000 1.0 vertex vertex
+= anim
+bone 1.0 0.500000
+-1
+material
+1.0 1.0 vertex frame frame bone anim = vertex bone texture -1
+-1
+-1 0.500000 vertex = texture anim
+0.500000
+anim = texture vertex
+material = = vertex vertex vertex
+0.500000 1.0 frame -1
+frame vertex anim 1.0 1.0 1.0
+bone vertex texture bone 1.0 1.0 bone bone anim anim bone frame vertex frame bone
+0.500000 bone vertex frame 0.500000 1.0 bone -1
+1.0 = anim -1 bone anim 1.0
+texture
+1.0
+frame anim -1 1.0 anim vertex -1 -1 material
+0.500000 anim 0.500000 frame = anim
+bone bone frame anim 1.0 bone = =
+vertex bone = vertex = 1.0 0.500000 1.0 material 1.0 -1
+vertex
+1.0 = bone anim = 1.0 texture anim material anim material material vertex texture texture anim texture texture 1.0 0.500000 anim
+bone -1
+frame material -1
+0.500000
+material frame frame = vertex -1 texture -1 texture
+=
+bone -1
+frame 0.500000
+0.500000 frame
+vertex texture -1 -1 anim texture material frame 0.500000 bone
+-1 frame bone texture 1.0 texture vertex 1.0 1.0
+0.500000 material texture texture material anim
+1.0 frame material
+-1 frame 0.500000 0.500000 texture material material 0.500000 0.500000
+texture anim material 1.0 -1 frame
+frame material texture anim bone
+= bone 0.500000 bone frame 1.0
+anim 0.500000 bone texture bone vertex -1 frame bone bone = vertex frame frame =
+anim
+material material bone
+bone vertex bone 0.500000 texture 0.500000 = anim 0.500000 frame = bone vertex frame =
+material
+= 0.500000 bone texture bone vertex 0.500000
+texture
+1.0 0.500000 = 0.500000 =
+0.500000
+material frame anim 0.500000 -1 frame material
+0.500000 bone -1 0.500000 texture
+texture
+texture anim bone vertex anim vertex
+material
+vertex -1 material 1.0 -1 -1 frame
+-1 0.5
\ No newline at end of file
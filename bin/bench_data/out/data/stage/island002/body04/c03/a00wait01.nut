@@ -0,0 +1,253 @@
+0.500000 1.0 1.0
+texture anim material =
+anim = =
+1.0 frame texture vertex bone
+texture bone texture 0.500000
+frame
+vertex
+1.0
+-1
+bone -1 texture 1.0 anim -1
+-1 bone 1.0 anim
+frame = = frame frame
+1.0 0.500000
+-1
+material bone material bone vertex = 1.0 vertex material 1.0 = anim
+material 0.500000
+vertex
+anim 1.0 anim
+= material anim vertex material frame material 1.0 frame
+material
+vertex frame
+=
+0.500000 = texture = vertex anim = bone 0.500000 texture
+frame material
+bone
+= bone material anim = = = texture -1
+-1 1.0 bone
+material vertex vertex
+bone material 1.0 bone texture 1.0 frame 0.500000 = 1.0 frame material frame -1
+0.500000 -1 -1 vertex
+0.500000 frame texture
+texture bone texture anim -1 anim frame texture
+=
+0.500000 = anim =
+bone
+0.500000
+bone
+material 0.500000 frame = texture frame 1.0
+texture frame frame anim bone
+-1
+= bone
+frame
+-1 = 1.0 1.0
+= texture vertex material
+= bone anim 1.0 material 1.0
+0.500000 frame
+vertex bone bone -1 bone
+0.500000 frame 0.500000 anim anim material
+-1 texture 0.500000
+texture = bone frame vertex material frame frame anim
+= texture texture -1
+= = bone
+=
+= = anim bone vertex =
+vertex -1 -1 = texture frame -1 0.500000 texture bone 1.0
+frame material
+frame bone
+frame 1.0 texture texture -1 bone texture
+frame texture = 1.0 1.0 anim material
+0.500000 material -1 texture anim
+0.500000
+= 1.0 -1
+bone texture
+1.0 0.500000
+bone bone
+vertex vertex -1
+material texture = anim vertex 0.500000 frame 1.0 1.0 0.500000 anim
+1.0 1.0
+texture
+vertex texture vertex texture bone
+texture -1 frame bone frame
+1.0 texture material
+anim = 1.0 = bone anim
+material
+1.0 bone -1 0.500000 vertex =
+-1
+anim material material texture -1
+=
+vertex 1.0 -1 material material 1.0 vertex 0.500000 = bone 1.0 vertex
+material 1.0 anim material 1.0 = 0.500000
+bone 1.0
+1.0 bone anim -1 = 0.500000
+vertex
+0.500000
+vertex
+frame
+material -1 -1 bone
+vertex 0.500000 material -1
+0.500000
+vertex bone 1.0 bone texture
+0.500000 frame anim bone texture -1
+0.500000 -1
+0.500000 frame texture
+0.500000 frame = -1 bone
+1.0 0.500000 -1 -1 material
+material
+texture frame
+bone material
+texture -1 material 1.0
+bone
+= vertex frame material vertex 0.500000 anim
+0.500000 anim
+=
+1.0 = material
+0.500000
+vertex frame 1.0
+vertex vertex material frame = material -1 frame =
+material texture frame
+vertex 0.500000 material -1 1.0 -1 =
+0.500000 vertex vertex material frame vertex texture 1.0 bone frame 1.0 bone 1.0
+bone 0.500000 anim vertex
+bone
+= vertex = 1.0 -1 -1 bone
+0.500000
+= anim bone anim
+-1 1.0 = -1 -1 -1 1.0 0.500000 anim = 0.500000 -1 -1
+= =
+material vertex anim anim material
+1.0
+= 0.500000 0.500000 0.500000
+1.0 frame bone material
+texture 0.500000 0.500000 1.0 bone bone anim frame 1.0
+anim material frame 1.0 0.500000 anim
+anim texture frame material
+1.0 texture frame frame
+texture anim anim = material frame 0.500000 bone
+anim 0.500000
+= vertex material = bone frame 1.0
+material 0.500000 material material
+frame 1.0 0.500000 0.500000
+frame 0.500000 -1 =
+anim
+material = 1.0 texture
+vertex 1.0 -1 1.0 0.500000 anim 1.0
+-1
+1.0
+bone texture material frame
+material 1.0 -1
+0.500000 = material =
+material vertex
+bone anim frame anim
+vertex
+0.500000 frame bone 1.0 vertex anim
+vertex anim
+frame anim
+= bone vertex
+bone -1
+anim
+1.0 bone material material
+texture 0.500000 bone frame
+bone material texture anim
+frame bone 1.0 texture 1.0 -1
+=
+0.500000 0.500000
+1.0 anim 1.0 frame
+anim -1 1.0 0.500000 texture bone frame 0.500000 bone anim
+material bone material
+bone texture vertex -1 texture -1 frame anim frame anim material
+bone material texture texture frame
+=
+1.0
+vertex = texture -1 vertex -1 texture bone -1 1.0
+frame frame 0.500000 1.0
+anim texture
+texture 1.0 vertex frame 1.0
+bone -1 -1 texture anim = material texture vertex bone
+anim texture vertex 0.500000
+anim vertex material =
+vertex 1.0 1.0 0.500000 -1 -1 texture anim texture
+-1 anim
+frame
+=
+= 1.0 1.0 1.0
+material material =
+texture
+0.500000
+vertex =
+1.0 frame vertex 1.0 frame texture
+-1 -1 texture = material 0.500000 -1 anim
+-1
+anim 0.500000 1.0 -1 = 1.0 vertex
+texture =
+anim -1
+bone anim anim bone 1.0 =
+bone material -1 vertex material anim texture anim texture vertex -1
+anim bone material 1.0 = vertex frame
+material
+texture 0.500000
+frame 0.500000 texture
+texture material vertex = 1.0 bone vertex 1.0 texture frame 1.0 =
+texture material texture
+bone vertex
+1.0 frame frame anim -1 bone 1.0 anim 1.0 anim = vertex
+texture
+1.0 vertex vertex texture texture -1 vertex texture
+0.500000 material texture = frame
+anim material material vertex anim bone
+= vertex vertex 1.0 =
+frame 0.500000 1.0
+bone -1
+material -1 =
+texture
+frame -1 -1
+anim
+texture frame
+-1 vertex
+texture vertex bone 0.500000
+-1 -1 1.0
+0.500000 vertex 0.500000 bone
+-1
+material material -1
+-1
+1.0 -1 = bone material 1.0 0.500000 1.0 vertex 0.500000 frame bone vertex bone frame anim vertex
+vertex anim bone
+1.0
+bone bone vertex 1.0 texture anim texture
+bone 1.0 anim 1.0 bone -1 0.500000 =
+0.500000
+bone = anim
+0.500000 texture
+-1 texture = anim material frame material
+vertex
+texture bone
+-1 frame = texture
+vertex
+= -1 anim anim -1
+-1 bone -1 anim texture bone frame texture material material 0.500000
+-1
+1.0 vertex
+0.500000
+-1 -1
+frame = 0.500000 bone 1.0 frame
+anim material = frame vertex 0.500000 texture -1 anim = material anim frame
+material
+vertex material texture frame
+texture frame = frame vertex anim = 0.500000 0.500000 anim 1.0 bone -1
+0.500000
+= = 0.500000 = material = frame
+=
+texture frame
+1.0 1.0 =
+texture frame frame material
+0.500000 -1
+1.0 anim texture 1.0
+1.0 anim frame = bone bone = bone
+-1 anim frame vertex 0.500000 1.0 0.500000 -1 frame
+texture -1 anim =
+frame
+bone
+-1 -1
+frame
+0.500000 anim frame 0.500000 bone
+-
\ No newline at end of file
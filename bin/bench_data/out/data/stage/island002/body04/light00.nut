@@ -0,0 +1,6 @@
+-1 bone
+anim texture 0.500000 texture frame texture
+vertex frame 0.500000 1.0
+= = texture
+vertex material 0.500000 anim
+a
\ No newline at end of file
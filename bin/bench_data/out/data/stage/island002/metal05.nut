@@ -0,0 +1,260 @@
+0.500000 texture 1.0
+texture frame 0.500000 material
+material anim
+vertex 0.500000 texture material
+0.500000 1.0 texture bone = -1 material material
+0.500000 frame 0.500000 anim vertex
+material
+anim texture
+material
+0.500000 frame material
+texture 1.0 material material 1.0 1.0 material
+-1 anim
+material 1.0 frame anim 1.0 1.0 =
+0.500000 =
+1.0 -1 texture
+material 0.500000
+1.0 frame 0.500000
+texture anim -1 bone material
+0.500000 1.0 -1 frame 0.500000 frame
+vertex
+material anim
+1.0 -1 frame
+anim
+-1 material vertex texture
+bone bone material -1 =
+material vertex material vertex vertex frame anim bone
+0.500000 vertex anim
+= -1
+-1 anim
+vertex -1 texture
+1.0 -1 texture = texture texture frame 0.500000 frame 1.0 frame vertex bone
+anim -1 material material material
+-1 0.500000
+texture 1.0 = bone 1.0 bone
+= texture frame -1 material material -1
+anim vertex 1.0
+bone
+= 0.500000 frame -1 frame =
+frame
+bone 1.0 material = 0.500000 1.0 texture bone -1 1.0 bone texture =
+frame texture anim texture texture
+texture anim
+-1 vertex
+texture anim 0.500000 1.0 material frame texture 1.0
+material 0.500000 = anim
+= 1.0 texture
+frame bone -1 0.500000
+vertex 1.0
+1.0 1.0 frame frame
+frame -1 texture
+bone vertex
+1.0
+anim = -1 vertex material 0.500000
+frame anim 1.0 material
+1.0 anim material
+frame 1.0 material anim bone 0.500000
+texture -1
+0.500000 vertex
+-1 frame -1
+texture
+0.500000
+0.500000
+material
+0.500000 frame
+0.500000 -1 vertex material anim anim texture
+0.500000 bone 1.0 frame -1 = 1.0 bone = material frame texture
+anim = frame
+anim 0.500000 vertex frame vertex vertex
+vertex
+anim material
+anim 1.0 bone vertex 1.0
+vertex = material -1 anim texture material
+anim =
+0.500000
+frame 0.500000 anim
+bone bone
+material bone
+-1 0.500000 1.0 anim vertex
+-1 1.0
+1.0 vertex 1.0 1.0 1.0
+= anim material
+-1 material 1.0 bone
+0.500000 anim material
+-1 anim frame
+1.0
+0.500000 frame
+-1
+frame material
+vertex
+anim texture 1.0 anim
+material anim -1 material 0.500000 anim frame
+vertex
+material
+material 0.500000 = anim 1.0 bone vertex = texture texture 1.0 -1
+0.500000 bone bone
+bone 0.500000 material 1.0 vertex
+bone texture frame
+vertex =
+bone
+vertex -1
+frame 0.500000 material 1.0 = bone 1.0
+1.0
+texture anim 1.0 1.0 1.0
+bone frame =
+texture anim = texture material = 0.500000 0.500000 = = bone = 0.500000
+0.500000 texture 1.0 frame anim
+= -1 vertex
+-1 frame =
+0.500000 material
+-1
+=
+-1 frame = 1.0 1.0 frame 0.500000 texture = bone bone texture
+vertex material vertex texture
+bone = frame material bone vertex material 1.0 -1 =
+anim 1.0 texture
+material 1.0 0.500000 texture frame
+=
+-1
+anim 0.500000 -1 =
+material bone texture texture
+bone
+texture bone
+material 0.500000
+bone
+material vertex = material
+1.0 bone anim bone texture vertex texture
+0.500000 vertex = 1.0 frame = bone
+0.500000 = bone -1 texture =
+texture = bone
+anim frame -1 frame frame
+1.0 frame
+material
+0.500000 0.500000 anim 1.0 anim 1.0 -1 = -1 -1 material frame 1.0 anim
+anim bone 1.0 =
+frame vertex -1 anim -1
+vertex material texture =
+frame 1.0 bone 1.0
+0.500000 bone anim material
+frame frame
+anim bone vertex vertex anim 0.500000 material texture 0.500000 bone bone bone 0.500000
+1.0 -1
+frame
+1.0
+= anim 1.0 0.500000
+1.0
+-1
+1.0 material 1.0 vertex
+frame frame
+0.500000 1.0 bone -1 vertex vertex texture material
+= frame anim
+anim 0.500000 material 1.0
+anim 0.500000 bone -1 0.500000 material
+1.0 texture 1.0 frame frame 1.0 -1 bone frame 0.500000 frame frame -1 material texture
+-1 0.500000 0.500000 texture -1
+0.500000 frame frame -1 material bone = 0.500000 frame 1.0 0.500000 1.0 vertex
+0.500000 vertex material anim bone
+bone -1 frame = 1.0
+texture
+bone
+frame
+texture
+bone -1 -1
+0.500000 -1 = material
+bone
+anim anim material bone material = 1.0 anim frame bone 0.500000 frame
+frame anim
+texture bone vertex frame
+= 0.500000 bone frame 0.500000 vertex vertex 1.0 material
+1.0
+vertex anim bone bone bone
+vertex -1
+= = frame 1.0 bone = 1.0
+0.500000
+vertex
+bone
+texture
+=
+frame bone anim = bone texture material bone bone
+material
+-1
+=
+vertex
+vertex
+anim anim 0.500000
+material
+material
+1.0
+bone material -1 vertex anim texture = bone
+frame =
+material
+-1 texture 1.0 -1
+0.500000
+vertex vertex texture material vertex 0.500000 0.500000 material material texture frame
+1.0 anim frame frame anim 1.0 1.0 frame 0.500000 -1
+frame 1.0
+bone material 1.0 frame 1.0 -1
+frame bone
+= 1.0 bone -1
+bone
+anim
+0.500000 1.0 = 1.0 bone vertex
+= vertex bone bone vertex material bone bone
+material =
+vertex -1 = anim 0.500000 = -1 bone bone
+0.500000 frame 0.500000 anim frame -1 material frame = frame bone -1 0.500000 anim material vertex vertex
+bone anim -1 = 1.0 frame
+-1 bone material bone frame = anim vertex 0.500000 texture =
+frame 1.0 0.500000 vertex
+material
+0.500000 0.500000
+frame
+1.0 vertex -1 1.0 frame texture 1.0 material frame bone =
+0.500000
+1.0 anim
+1.0 1.0 frame 0.500000
+vertex
+frame anim
+vertex material 0.500000 0.500000 material =
+bone vertex
+vertex anim 0.500000
+0.500000 texture 1.0 -1 frame
+= 1.0 anim 1.0 -1 bone 1.0 material
+material
+vertex vertex
+bone anim bone frame vertex frame
+material 0.500000 bone bone
+0.500000 texture
+1.0 material texture anim
+frame vertex -1 texture frame frame anim 0.500000 frame bone = bone vertex
+anim -1 anim
+vertex 1.0 vertex -1 = texture
+= anim bone 0.500000
+-1 material 1.0
+material -1 texture 1.0 bone 0.500000 vertex
+-1
+-1 material frame 0.500000
+0.500000 vertex
+frame bone bone -1 texture
+0.500000 = anim
+= frame bone material vertex 0.500000 vertex
+texture 1.0
+1.0 frame = anim -1 texture
+= material frame anim texture -1 texture 1.0
+frame anim 1.0 vertex
+vertex =
+texture 0.500000 bone 1.0 = frame texture anim anim -1 -1 texture -1 anim texture -1
+1.0 0.500000 frame vertex material material -1 1.0
+anim 0.500000 texture
+-1 bone
+texture 0.500000 frame
+1.0 -1
+1.0 material
+frame vertex 1.0 bone 0.500000 = frame 0.500000
+anim
+-1
+0.500000 frame 1.0 anim 0.500000 anim anim vertex frame bone vertex frame 0.500000 material frame
+-1 anim
+= 0.500000 frame texture
+texture vertex bone
+vert
\ No newline at end of file
@@ -0,0 +1,101 @@
+anim
+vertex 1.0 anim
+vertex
+-1 1.0 material 0.500000 anim -1 =
+material
+frame
+1.0
+0.500000
+texture 0.500000 vertex texture bone material = frame texture anim material frame
+material vertex
+bone material
+-1
+material bone =
+=
+material
+0.500000 0.500000 frame anim anim anim
+1.0 1.0 vertex vertex frame = texture
+material material anim texture bone -1 = vertex
+= -1 0.500000 frame frame 0.500000
+bone 1.0 material
+vertex
+= -1
+anim 1.0 material -1
+texture
+texture bone texture -1
+bone 1.0
+bone texture bone
+0.500000 =
+1.0 anim 1.0 material material frame -1 vertex vertex
+texture 1.0 0.500000 =
+= 0.500000
+vertex
+texture frame vertex vertex frame vertex = bone texture
+texture frame 1.0
+bone anim texture
+-1 bone
+vertex material bone material texture -1 -1 material frame = 1.0 1.0 texture frame
+0.500000 frame = bone
+bone material
+anim bone 1.0
+1.0 -1
+-1 = texture
+frame bone bone texture texture 0.500000 anim -1 anim
+=
+anim
+0.500000
+anim -1 bone
+-1 material 0.500000 -1 -1
+0.500000 1.0 frame -1
+0.500000 frame vertex material frame -1 vertex texture 0.500000 bone = anim
+0.500000 0.500000 1.0 frame texture vertex
+texture frame 1.0 material material
+bone
+1.0 texture
+bone = bone
+0.500000 anim
+0.500000 anim vertex vertex texture
+texture texture texture
+1.0 =
+texture texture material
+bone
+frame
+0.500000 1.0 0.500000
+= =
+frame = 1.0 = frame vertex bone material 1.0 texture
+-1 0.500000
+frame
+anim
+texture
+-1 1.0 bone frame 1.0
+texture -1 anim -1
+0.500000
+frame
+material -1 -1
+-1 frame
+vertex texture vertex material =
+texture
+bone -1 0.500000
+1.0
+vertex
+frame material material bone -1 bone texture
+texture
+1.0
+vertex
+-1 anim vertex vertex anim bone =
+=
+anim bone anim 1.0 texture frame
+material 0.500000 anim
+= -1 -1 -1 texture bone
+material -1 frame -1 -1 bone anim material -1
+texture
+0.500000 material
+vertex
+material material 0.500000 anim
+0.500000 0.500000 1.0
+texture
+-1 material vertex bone anim -1 = vertex frame vertex anim material material
+vertex
+anim -1 texture vertex
+texture -1 1.0
+0.500000 
\ No newline at end of file
@@ -0,0 +1,77 @@
+material
+texture material -1 frame
+frame texture 1.0 anim 1.0 anim = 1.0 anim frame = anim anim frame vertex
+= vertex vertex -1 -1 frame = 0.500000 =
+= bone
+anim 1.0 anim
+1.0 texture vertex vertex vertex anim vertex
+anim
+bone frame 1.0 1.0 material
+anim = frame anim material frame =
+1.0 bone -1 0.500000
+bone bone 1.0 anim
+0.500000 0.500000
+= 0.500000 vertex =
+= texture material anim 0.500000 bone 0.500000 -1 -1
+= bone frame 1.0 bone anim -1 bone vertex material
+0.500000 material bone frame -1 1.0 1.0 anim material = = anim
+0.500000 anim
+bone vertex anim
+texture -1 frame -1 1.0 0.500000
+1.0 -1
+= 1.0 =
+material texture frame texture
+1.0 0.500000 texture bone =
+bone = anim 0.500000 bone
+anim
+-1 -1 = material bone -1 material
+bone 0.500000 -1
+bone
+anim
+texture 0.500000 0.500000 bone material vertex frame bone 0.500000 bone -1
+vertex
+vertex = 0.500000 anim
+= anim
+vertex
+1.0 frame 0.500000 1.0 frame
+vertex 1.0 anim vertex
+0.500000
+bone 1.0 0.500000
+1.0 anim
+frame
+0.500000 vertex -1 frame frame bone
+anim 1.0
+vertex
+bone material -1
+1.0 = anim 0.500000
+-1 -1 texture texture
+frame -1 vertex = bone
+vertex texture
+material 1.0
+vertex
+= anim 1.0 texture 1.0 frame 0.500000 texture bone
+1.0 frame 0.500000 material anim 0.500000 = texture bone = material 1.0 anim material 0.500000
+vertex
+vertex anim texture
+1.0 -1
+1.0 1.0 vertex anim material anim
+= anim texture
+texture material vertex frame frame
+texture
+-1 = vertex anim 0.500000 1.0
+bone bone
+0.500000 anim = bone vertex 1.0 = -1 vertex
+frame vertex frame
+material = -1 vertex
+frame vertex
+-1 bone frame -1 -1 texture material texture texture
+= vertex anim texture texture -1 anim material vertex material bone
+bone 0.500000 = material
+material vertex bone
+0.500000
+-1 texture = 1.0 =
+bone texture
+0.500000
+-1 0.500000 anim = -1 vertex frame texture material anim frame
+frame = texture
+1.0 = 1.0 0.500
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000
+bone texture material 1.0 1.0 1.0 0.500000
+-1
+-1
+1.0 anim texture -1 bone 1.0
+textu
\ No newline at end of file
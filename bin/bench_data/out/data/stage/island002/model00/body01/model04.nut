@@ -0,0 +1 @@
+чQ_F:ebf.c.9E}ʦ
\ No newline at end of file
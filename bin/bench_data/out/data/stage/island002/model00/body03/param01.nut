@@ -0,0 +1,21 @@
+frame = material
+material 0.500000 frame
+1.0 texture = frame
+frame vertex frame
+-1 0.500000
+vertex anim
+bone anim anim
+= bone
+= -1 vertex anim material
+bone -1 frame 1.0
+1.0 -1 bone
+vertex 1.0 material -1
+0.500000 0.500000 0.500000 texture
+texture material vertex -1 vertex 1.0 bone -1
+-1 0.500000
+0.500000
+anim vertex = material -1 1.0 anim bone 0.500000 texture texture frame 0.500000 vertex 1.0 vertex material material -1 frame frame material 0.500000
+1.0 1.0 0.500000
+1.0 material
+bone anim 1.0
+1.0 1.0 fr
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone vertex
+bone 0.500000 texture = 0.500000 1.0 = materia
\ No newline at end of file
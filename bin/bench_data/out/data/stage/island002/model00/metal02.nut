@@ -0,0 +1,13 @@
+= anim texture
+bone = frame bone
+= 0.500000 texture frame = 1.0 1.0 1.0
+vertex 0.500000 1.0 vertex bone -1 frame bone
+-1 material vertex 1.0 -1
+frame anim
+bone -1 0.500000
+bone
+frame
+0.500000 -1 1.0 0.500000 = anim frame
+frame vertex
+vertex anim texture
+frame = bone 1.0
\ No newline at end of file
@@ -0,0 +1,13 @@
+anim -1 anim
+0.500000 bone
+vertex texture bone
+vertex vertex 1.0 texture -1
+vertex
+bone = material bone = 0.500000 vertex
+1.0 vertex
+anim
+= bone bone
+1.0
+0.500000 frame material -1
+anim 0.500000 1.0 -1 vertex anim
+f
\ No newline at end of file
@@ -0,0 +1,203 @@
+= anim vertex vertex material
+anim anim
+-1 frame texture anim
+texture frame
+-1 texture = texture
+-1
+-1 0.500000 = 0.500000 -1
+bone vertex 0.500000 material -1 1.0
+-1
+= frame
+0.500000
+= frame anim material frame 1.0
+-1 1.0 bone -1 =
+= bone
+-1 texture
+frame
+= material bone 0.500000 bone
+frame
+anim
+material -1 = anim
+vertex 0.500000 anim anim frame
+material = 0.500000
+1.0
+vertex material
+frame texture 0.500000 0.500000 anim
+texture frame -1 material
+frame anim anim texture texture -1 material
+frame 0.500000 vertex 0.500000 -1 1.0 -1
+0.500000 anim frame texture -1 material vertex
+-1 texture -1 =
+anim vertex
+-1 texture
+frame anim = = frame 1.0 frame
+texture bone
+material 0.500000 1.0 material material material = -1
+0.500000 texture -1
+material =
+= 1.0 =
+vertex 0.500000 -1 material vertex material texture 0.500000 material
+frame 0.500000 1.0 vertex bone texture vertex
+frame =
+anim frame anim
+material texture bone 1.0 = anim 0.500000 0.500000
+anim vertex frame
+texture 1.0
+-1 bone 0.500000 texture bone
+-1
+frame frame = material 0.500000 frame
+vertex
+vertex
+-1
+frame 0.500000 bone
+bone -1
+-1
+texture anim
+1.0 1.0 material vertex 0.500000 = 1.0
+-1
+texture = bone
+frame texture
+0.500000 0.500000
+material
+1.0
+=
+= 0.500000 0.500000
+bone vertex frame frame
+anim bone
+vertex material
+-1 frame
+1.0 frame 1.0 anim frame 1.0 vertex bone anim vertex texture -1 = anim vertex 1.0
+anim anim anim
+=
+=
+material material texture texture
+frame frame texture
+vertex -1 1.0 texture
+texture anim frame 1.0 -1 vertex
+frame texture texture vertex -1
+=
+-1
+0.500000 0.500000 frame = bone
+bone
+= vertex bone bone bone
+frame 1.0 1.0
+vertex = bone = vertex anim
+material material 1.0 bone
+texture
+material
+frame
+0.500000
+texture anim
+frame vertex 0.500000
+-1 -1 0.500000 texture -1
+1.0 frame 1.0
+-1 material material
+-1 vertex frame
+-1 1.0
+texture frame -1 0.500000
+0.500000 vertex =
+vertex
+1.0 anim
+= material bone 1.0
+vertex = = texture material frame
+0.500000 = 1.0 -1 texture 0.500000 = material =
+0.500000
+1.0 anim 0.500000 vertex frame vertex vertex
+0.500000 -1 -1 frame
+1.0 material -1 0.500000 frame frame frame vertex
+material = 0.500000 =
+anim anim texture texture material -1 -1 bone
+-1 1.0
+vertex texture anim vertex material material frame -1
+bone 0.500000
+0.500000 0.500000 bone = -1 bone
+frame
+-1 vertex
+texture
+0.500000 = frame frame vertex 1.0 material 1.0 -1 = -1 texture anim bone material =
+0.500000 texture 0.500000
+anim 0.500000
+0.500000 0.500000 bone frame 0.500000 1.0
+anim material bone 0.500000 vertex -1 material material texture
+frame
+0.500000
+material -1 anim anim anim
+-1 anim anim
+vertex material
+frame = frame 0.500000 material
+material 1.0 frame
+frame 0.500000
+= material
+=
+bone
+vertex material -1
+0.500000
+frame
+frame vertex texture 1.0 =
+1.0 -1
+frame
+anim 1.0 1.0 material bone frame material -1 frame
+bone anim bone bone texture anim
+anim vertex anim vertex texture frame anim -1 = bone
+texture texture anim
+= 0.500000 material
+vertex anim vertex 1.0
+frame material -1 = bone -1 = -1 bone = 1.0 bone =
+bone bone
+vertex
+material anim 1.0 -1 texture frame -1 1.0 material = frame
+frame
+-1 -1 0.500000 -1 bone
+bone frame anim
+1.0 material -1 texture texture material
+vertex 0.500000 vertex 1.0 frame
+= vertex frame 0.500000 0.500000 bone
+texture =
+material frame 0.500000 bone 0.500000 texture -1
+= vertex bone 0.500000 bone anim texture
+material
+bone frame 0.500000 frame
+frame
+bone =
+anim
+-1 anim = =
+0.500000 frame vertex 1.0 anim
+frame
+= material 1.0 -1 1.0 vertex
+anim bone
+=
+frame texture texture 1.0 material material -1 -1
+material
+material vertex 0.500000 -1
+texture
+texture =
+1.0 0.500000 1.0 vertex -1 material material
+frame -1
+vertex bone material texture
+-1
+texture material vertex frame -1 anim texture bone -1 texture 0.500000 0.500000 material -1 texture vertex
+material -1
+= anim
+= 0.500000 -1
+material
+=
+frame bone texture = -1 -1 texture bone -1 material anim anim material frame -1 texture texture
+bone 1.0 material = 1.0
+1.0 anim material anim texture bone 0.500000 vertex -1
+vertex vertex anim =
+anim 1.0 =
+bone frame anim anim
+frame = 0.500000 -1 frame
+bone
+frame frame material -1
+vertex bone 0.500000
+=
+vertex vertex 1.0 = 1.0
+0.500000 = frame texture anim texture 0.500000
+-1 0.500000 anim bone 0.500000 -1 1.0 frame
+bone
+bone anim
+frame -1 frame anim anim -1 -1 frame frame frame
+vertex
+0.500000 anim
+-1 texture frame bone texture 1.0 = texture 1.0
\ No newline at end of file
@@ -0,0 +1,252 @@
+-1 0.500000 material vertex frame
+frame bone frame texture 0.500000
+bone
+= 0.500000
+texture = -1 anim
+0.500000 1.0 vertex 0.500000
+material anim = vertex -1 bone texture 1.0 = texture vertex texture
+bone 0.500000 bone material = 0.500000 anim
+anim bone anim frame frame texture texture texture 1.0 material frame texture
+material
+-1
+vertex 0.500000 texture anim bone 1.0 material frame frame
+0.500000 anim frame bone vertex bone
+bone material material bone 0.500000 0.500000 anim texture texture -1 material anim texture frame
+bone vertex 1.0
+bone = texture
+0.500000
+bone = texture anim -1 1.0 bone = material
+1.0 bone 1.0
+0.500000 anim
+1.0 1.0
+vertex -1 -1 anim bone bone bone material
+bone anim -1 = -1 bone texture material frame 0.500000 -1 frame material frame -1
+material -1 bone vertex anim
+frame bone -1 -1 vertex = texture bone 0.500000 material 0.500000
+= -1 frame 0.500000
+vertex material vertex texture frame texture
+texture -1 1.0
+=
+0.500000
+bone
+texture anim
+texture
+vertex = material material texture vertex 1.0 anim =
+-1 = texture texture texture
+vertex
+texture = material
+-1 vertex vertex bone vertex
+-1 vertex frame
+anim vertex anim frame material
+-1 bone vertex material
+texture -1 1.0
+anim
+1.0 bone 0.500000 = 1.0 frame vertex anim
+1.0 anim texture = =
+texture
+material texture anim
+frame anim frame -1 material frame vertex 0.500000
+vertex frame anim
+bone vertex -1 bone texture = material vertex
+frame frame 0.500000 frame -1 bone material frame material texture = = 1.0 texture anim frame anim -1 anim = vertex 0.500000
+-1 -1 0.500000
+0.500000 bone frame bone 1.0 bone
+material -1
+texture -1 material
+vertex texture vertex -1 texture texture
+bone texture material = -1 0.500000 material anim material 1.0 vertex bone bone -1 = -1 = vertex
+1.0 anim texture
+anim frame
+material 1.0 1.0 anim vertex vertex frame vertex
+frame frame frame -1 0.500000 anim frame
+0.500000 texture
+anim
+anim 1.0 vertex material 1.0 texture 0.500000 anim 1.0 bone vertex 0.500000 -1 texture
+1.0 0.500000 anim
+bone
+texture texture anim = bone texture -1 1.0 frame bone material vertex frame frame 0.500000 anim 1.0
+0.500000 material frame
+1.0
+=
+vertex bone vertex
+texture
+bone frame frame
+= =
+material 0.500000 1.0 1.0 material 1.0 texture
+0.500000 frame
+anim vertex
+texture frame
+= material material 0.500000 -1 material material vertex
+texture anim
+anim
+-1 -1
+-1 material material
+material
+bone 1.0
+anim 1.0
+vertex material 1.0 material vertex 0.500000 frame
+anim bone
+bone -1 material 1.0 anim
+texture 1.0 bone material anim material anim
+material frame -1 material
+vertex 0.500000 1.0 vertex texture material bone texture 1.0 texture anim bone
+anim anim
+anim
+0.500000 texture vertex vertex vertex -1 = texture vertex 1.0 bone
+bone
+texture bone frame = vertex = bone frame
+0.500000 frame
+=
+texture vertex texture texture
+frame texture
+bone =
+0.500000 0.500000 = frame bone
+= 0.500000
+texture 0.500000 frame -1 frame anim bone
+= 1.0 1.0
+frame
+bone -1 bone 1.0 texture
+anim -1 bone
+anim material 1.0 0.500000 = material -1 frame
+frame texture -1
+-1 vertex
+bone 0.500000
+frame vertex 1.0
+material frame frame 1.0
+texture texture = =
+= 0.500000
+material texture material 0.500000
+1.0
+frame frame 1.0 = frame -1 texture -1 bone 0.500000 vertex material
+frame
+material texture vertex = texture 0.500000 1.0 material vertex vertex
+bone frame vertex
+1.0
+0.500000 -1
+vertex
+texture
+anim
+texture material material 1.0 -1 material material frame
+bone 1.0 bone bone texture
+0.500000
+= frame 0.500000 bone -1 -1
+0.500000 anim frame =
+1.0 texture texture vertex 0.500000 = vertex
+anim
+texture texture frame anim
+anim vertex frame
+bone material bone bone 0.500000
+=
+vertex bone
+anim bone bone bone 1.0 1.0 bone material 0.500000 anim
+1.0 frame vertex
+material
+material 1.0 bone vertex 1.0 material material
+-1 1.0
+=
+0.500000 -1 frame bone texture 1.0 texture
+material -1
+vertex
+-1
+-1 frame frame bone
+bone texture 0.500000
+material vertex anim
+bone
+anim 1.0 frame
+frame
+frame material
+material frame 1.0 texture bone anim bone
+0.500000 frame -1
+bone
+texture
+frame frame texture
+frame 1.0
+anim frame texture vertex
+texture bone vertex material
+texture vertex -1 = =
+frame anim texture material 0.500000 1.0
+bone
+0.500000 0.500000 1.0
+0.500000 1.0
+anim 0.500000 bone
+1.0 vertex -1 = material
+bone material
+vertex vertex -1 texture frame material material 0.500000 material anim texture frame material -1
+= = frame -1 1.0
+0.500000 = anim vertex 1.0 material vertex anim -1 frame anim 1.0
+frame
+1.0 1.0 texture material 0.500000 vertex material -1 frame
+texture -1 texture vertex material
+-1 anim = 1.0 1.0 texture 0.500000
+anim bone 1.0 = 1.0 anim texture 0.500000
+0.500000
+0.500000 anim 1.0 =
+texture texture vertex 0.500000
+1.0 = material
+-1
+= texture vertex -1 vertex
+0.500000
+frame 0.500000 frame frame
+frame -1 vertex
+0.500000 0.500000 0.500000 = texture material
+1.0
+frame -1
+-1 frame 0.500000 -1 vertex vertex
+texture
+0.500000 frame material bone frame
+texture frame vertex anim vertex anim
+vertex
+vertex frame -1 = bone
+frame -1 material -1 frame
+1.0
+frame
+anim = = -1 -1 1.0
+-1
+vertex -1 texture frame
+= = texture -1 1.0 texture anim -1 texture
+texture vertex
+vertex frame texture
+-1 -1 = frame -1 material
+material
+material 0.500000
+material anim material vertex bone = 1.0 material material
+anim
+-1
+bone
+texture
+material frame = =
+anim
+material
+bone frame vertex material
+1.0
+anim 1.0 1.0
+1.0 texture material 0.500000
+= 1.0 anim frame
+bone anim anim
+texture
+-1 frame material
+1.0 0.500000 0.500000 anim anim -1 -1 -1 1.0 anim
+bone bone texture 1.0 frame
+frame -1 bone anim
+bone =
+texture
+texture
+frame texture 0.500000
+0.500000
+bone
+1.0 material 0.500000
+frame = frame vertex
+0.500000
+material bone
+0.500000 material
+material anim frame anim
+0.500000 0.500000
+material
+anim 1.0
+=
+texture -1
+= anim anim
+= vertex texture vertex
+-1 material
+vertex anim frame
+f
\ No newline at end of file
@@ -0,0 +1,24 @@
+-1 frame vertex = 0.500000 vertex
+bone texture
+vertex =
+0.500000 -1 frame material
+0.500000 texture vertex vertex anim
+frame anim = anim frame frame 0.500000 material
+vertex
+= = 0.500000
+frame bone 1.0
+vertex 0.500000 0.500000 vertex anim
+texture anim bone -1 0.500000
+-1 frame vertex =
+anim vertex
+-1
+=
+frame 1.0
+-1
+material 0.500000 anim bone texture material = 1.0 frame
+0.500000 vertex
+texture 1.0
+-1
+anim -1
+0.500000
+-1 vertex b
\ No newline at end of file
@@ -0,0 +1,2 @@
+-1 vertex
+anim -1 anim bone texture frame mater
\ No newline at end of file
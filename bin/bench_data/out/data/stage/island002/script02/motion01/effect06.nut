@@ -0,0 +1,68 @@
+1.0 anim =
+frame material
+-1 1.0
+1.0
+= 0.500000 vertex
+bone
+-1 = = bone vertex
+0.500000 1.0 0.500000 1.0 anim material -1 = anim -1 material texture 0.500000
+texture
+anim frame
+anim -1 0.500000 0.500000 0.500000 = 1.0 bone
+-1 vertex
+material
+bone vertex -1 material
+bone
+=
+=
+= frame = anim bone -1 0.500000 vertex -1 anim material
+bone bone -1 anim material texture vertex = =
+frame 1.0
+frame 1.0
+=
+-1 texture
+bone -1 frame 0.500000
+-1 vertex
+0.500000
+anim
+0.500000
+0.500000
+material 0.500000
+frame =
+anim bone -1
+vertex
+anim -1
+-1 material vertex
+anim -1 bone bone
+anim anim
+-1 -1 material material material anim = vertex frame
+-1 0.500000 -1 anim bone -1 texture frame frame anim frame -1 frame frame bone anim
+texture
+texture
+texture material
+frame anim bone 1.0
+texture vertex 0.500000 =
+vertex frame frame material 1.0 material anim =
+texture
+vertex texture = texture =
+bone anim = bone
+1.0 frame bone bone
+texture material frame frame 0.500000 material material
+bone
+bone texture bone anim material
+texture anim anim -1 1.0 0.500000 = bone anim anim anim = 0.500000
+-1
+vertex material
+texture
+vertex frame bone texture material 0.500000 frame
+1.0 texture anim 0.500000 texture
+= vertex bone
+= anim
+vertex 0.500000 1.0
+-1
+bone 1.0
+texture
+=
+-1 vertex
+anim frame
+vertex = 1.0 =
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000 frame texture
+material texture = frame frame
+vertex
+-1 texture
+0.5
\ No newline at end of file
@@ -0,0 +1,41 @@
+texture 0.500000
+material 0.500000
+anim
+0.500000 0.500000 bone 0.500000 -1 = anim vertex 1.0
+frame
+-1 = -1 anim
+material anim bone bone texture material -1 0.500000 bone
+material
+anim -1
+material
+1.0 1.0
+0.500000 anim -1 -1
+bone 0.500000
+1.0 0.500000 bone
+vertex material vertex material = vertex 0.500000
+vertex texture =
+material anim bone anim = -1
+bone texture texture anim vertex =
+0.500000 texture -1 1.0
+material
+=
+vertex 1.0 = anim vertex
+0.500000
+anim texture
+frame 1.0 = vertex vertex anim material -1 frame
+anim 0.500000 1.0 -1 bone material
+0.500000 frame frame
+frame anim
+1.0 bone
+frame
+= frame texture
+= vertex 0.500000 bone
+-1 bone frame -1 0.500000 0.500000 frame
+-1 frame vertex
+1.0
+anim
+vertex 0.500000
+= vertex
+texture material -1
+texture 1.0 1.0
+bone frame
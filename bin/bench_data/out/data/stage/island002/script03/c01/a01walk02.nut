@@ -0,0 +1,12 @@
+frame
+1.0 anim material -1
+frame anim material 1.0 -1 material 1.0
+0.500000 -1 1.0 frame
+texture 0.500000
+vertex
+vertex anim texture
+1.0 vertex bone vertex
+frame
+material vertex
+1.0
+texture vertex v
\ No newline at end of file
@@ -0,0 +1,35 @@
+1.0 frame
+= vertex bone bone 1.0 -1
+0.500000
+bone
+-1 material 1.0 material texture vertex bone
+material texture
+anim anim
+bone -1
+bone
+0.500000 material frame vertex -1 -1
+= vertex -1 1.0 vertex bone frame texture anim bone 1.0 = 1.0 texture frame = bone
+-1 anim material 0.500000
+anim bone
+material 0.500000 anim bone -1
+= material vertex anim 0.500000 texture texture vertex
+1.0 1.0 frame anim -1
+vertex
+1.0 1.0
+0.500000 texture
+bone
+texture -1
+1.0
+anim -1 0.500000 = 1.0
+-1 vertex vertex bone bone -1 -1
+-1 bone
+= 0.500000 material -1 0.500000 1.0 texture frame vertex texture texture anim -1 =
+anim anim texture material anim 0.500000 anim -1
+1.0 0.500000 anim = 0.500000 texture -1 material 1.0 frame frame texture 0.500000 bone material
+texture
+texture = material -1 =
+vertex texture vertex
+vertex vertex
+texture frame material
+frame vertex vertex vertex
+-1 1
\ No newline at end of file
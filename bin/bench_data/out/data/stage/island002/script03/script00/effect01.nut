@@ -0,0 +1,17 @@
+-1 -1
+material -1 bone texture frame 0.500000 bone texture bone
+material anim texture 0.500000
+=
+material
+0.500000 = frame
+-1
+anim -1 vertex -1 = = bone
+anim texture 1.0
+texture
+material = anim
+anim material bone
+bone anim
+material -1
+vertex vertex material 1.0
+anim
+frame texture 1.0 frame 0.50
\ No newline at end of file
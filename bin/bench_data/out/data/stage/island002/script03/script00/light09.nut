@@ -0,0 +1,2 @@
+1.0 =
+vertex 1.0 1.0 1.0 anim 0.500
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 = frame
+material
+anim anim -1 vertex -1
+fram
\ No newline at end of file
@@ -0,0 +1,9 @@
+vertex 0.500000 texture
+=
+texture =
+frame bone
+texture 0.500000
+anim vertex material bone bone anim vertex
+= 1.0
+1.0 vertex vertex
+bone material texture -1 bo
\ No newline at end of file
@@ -0,0 +1,8 @@
+vertex = =
+1.0 0.500000 material
+anim bone -1 bone anim bone
+anim material material anim =
+frame vertex vertex vertex anim
+frame 0.500000 anim material frame frame
+0.500000 material
+= anim 
\ No newline at end of file
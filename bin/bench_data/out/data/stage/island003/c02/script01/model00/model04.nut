@@ -0,0 +1,11 @@
+= =
+vertex bone material vertex
+texture bone frame
+bone
+anim
+= bone 0.500000 bone -1 bone frame bone 1.0 bone frame 1.0
+material 0.500000
+-1 0.500000 -1 1.0
+bone 1.0
+texture -1
+texture anim = 
\ No newline at end of file
@@ -0,0 +1,4 @@
+frame -1 frame frame
+= bone texture 0.500000 vertex
+frame
+material 0.5
\ No newline at end of file
@@ -0,0 +1,10 @@
+=
+material
+frame anim
+0.500000 0.500000 =
+frame 0.500000 bone -1 material
+frame texture =
+bone 0.500000 1.0 anim frame texture
+texture texture
+frame anim =
+frame 
\ No newline at end of file
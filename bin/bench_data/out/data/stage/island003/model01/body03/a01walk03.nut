@@ -0,0 +1,13 @@
+material frame 1.0 vertex frame anim -1 1.0
+anim
+0.500000
+anim 1.0
+= -1 1.0 bone bone
+anim
+material 1.0 vertex frame = texture
+frame
+texture
+material -1 bone bone anim material
+= 0.500000
+1.0 vertex =
+anim anim -1 material anim = anim texture frame 0.500000 bone vertex 0.500000 
\ No newline at end of file
@@ -0,0 +1,181 @@
+vertex texture material -1 bone vertex 1.0 = 0.500000
+texture -1 =
+= texture 0.500000 texture vertex
+texture vertex
+vertex
+-1
+= texture
+bone =
+bone 1.0 anim anim material 1.0 -1
+vertex
+-1 texture anim texture frame 1.0
+bone anim material 1.0
+anim
+material = frame texture material 1.0 frame -1 anim = vertex frame material material vertex = vertex
+material = 0.500000 bone 1.0 1.0 0.500000 material vertex
+anim 0.500000 frame frame
+texture
+anim texture anim = frame
+1.0
+-1 anim -1 -1 frame vertex material frame texture bone
+frame
+anim
+anim texture = frame
+texture texture frame
+-1 bone texture 1.0
+bone bone -1 material 1.0 bone vertex
+anim vertex frame frame bone material -1
+1.0 0.500000 -1 anim = 1.0 frame 0.500000 = bone
+bone frame = vertex -1
+vertex = -1 0.500000
+0.500000 bone
+anim bone bone frame
+texture
+-1 vertex =
+-1 0.500000 frame 0.500000 frame 1.0
+bone texture material
+1.0
+= =
+anim -1 bone material
+1.0 = 0.500000
+bone 0.500000 material
+vertex anim anim 0.500000 vertex
+texture
+frame frame
+vertex anim =
+-1 -1
+anim
+1.0 0.500000 bone
+material texture material bone texture = vertex anim
+0.500000 bone = 1.0 texture texture -1 = -1 texture anim bone anim 1.0 vertex
+frame bone
+-1 1.0 0.500000 texture 1.0 -1 bone texture bone material anim
+texture 1.0 vertex vertex 1.0 -1 = texture bone 0.500000 0.500000
+= = bone
+bone -1 bone
+bone vertex anim 0.500000
+0.500000
+vertex bone vertex
+-1 texture
+anim texture anim
+vertex frame
+-1 frame frame bone bone -1 anim frame texture 1.0 bone 0.500000
+-1 = = 0.500000 1.0
+texture
+texture vertex texture -1 texture
+vertex
+0.500000 =
+texture
+material = = frame
+texture
+material 1.0 = anim = texture -1
+material 0.500000 -1 1.0 texture vertex 0.500000
+-1
+vertex
+frame texture frame vertex material frame texture vertex
+anim texture
+anim -1 anim
+material frame 1.0 1.0
+material 0.500000 frame bone 0.500000 frame 0.500000 bone anim -1
+bone 0.500000 0.500000 1.0
+texture bone texture
+frame
+anim anim texture 0.500000 texture texture 0.500000 texture texture
+= -1 frame = anim -1 0.500000 0.500000 vertex texture 1.0
+1.0
+frame
+1.0
+bone =
+vertex =
+0.500000 vertex 0.500000
+= bone vertex
+anim bone 0.500000 bone
+texture
+frame
+=
+vertex material
+0.500000
+-1 vertex 0.500000 bone vertex
+bone 1.0 bone material
+1.0 0.500000 frame material frame anim = texture = anim bone frame texture texture 0.500000 frame
+0.500000
+anim 1.0 -1 -1
+0.500000 frame 1.0 vertex
+bone
+-1 1.0
+anim texture -1
+=
+= frame texture = 0.500000
+1.0 -1 -1
+material anim 0.500000
+0.500000 -1
+anim anim = 1.0 0.500000 -1
+vertex frame 1.0
+frame 0.500000 texture
+frame
+0.500000
+frame
+vertex
+= anim vertex frame bone
+material -1 texture
+frame vertex
+0.500000 1.0 = frame vertex anim
+texture = 0.500000
+=
+0.500000 material
+vertex
+1.0 texture bone -1
+= vertex vertex texture bone
+frame 0.500000 material
+anim
+bone vertex material 1.0 = =
+bone
+texture material
+1.0 -1 texture material frame bone material frame anim frame bone
+texture bone vertex material material -1 -1
+0.500000 vertex = 1.0 material frame texture 0.500000 frame
+texture anim
+vertex
+bone
+vertex bone bone =
+material texture
+vertex -1
+-1 material 0.500000 -1 anim
+-1
+anim 0.500000 0.500000
+frame -1 1.0 texture
+bone -1
+material bone
+material 0.500000 vertex 1.0
+vertex
+frame frame 1.0 material frame
+anim texture = = texture 1.0 anim vertex -1 texture anim
+-1
+vertex =
+1.0 1.0 texture
+material 0.500000
+0.500000
+material anim frame texture 0.500000 = 0.500000 material bone frame
+1.0 vertex
+frame material 1.0 0.500000 bone -1
+-1 frame anim anim vertex 0.500000 material
+= material
+vertex 0.500000
+texture
+= 0.500000 bone
+-1
+texture
+1.0 texture vertex
+0.500000 1.0 0.500000
+0.500000 texture 0.500000 0.500000 vertex
+0.500000 0.500000
+vertex material
+anim vertex texture
+texture bone = vertex 1.0 = = anim = frame 1.0 bone -1
+material frame bone = frame anim bone bone 1.0 1.0 texture 1.0 anim 0.500000 -1 anim
+frame
+bone = texture 0.500000
+bone anim
+frame texture 0.500000
+material frame 1.0 vertex
+1.0 ma
\ No newline at end of file
@@ -0,0 +1,6 @@
+texture
+vertex -1 bone
+0.500000 1.0 0.500000 anim -1 0.500000 frame vertex anim
+texture frame
+bone 1.0 1.0 1.0
+te
\ No newline at end of file
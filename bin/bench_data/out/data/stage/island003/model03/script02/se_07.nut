@@ -0,0 +1,15 @@
+-1 frame 1.0 anim =
+= texture 1.0 -1 vertex
+bone
+0.500000 =
+anim anim 0.500000 -1
+frame
+-1
+frame material frame
+bone
+bone
+0.500000
+= 1.0
+frame 1.0 bone
+-1 0.500000
+= 
\ No newline at end of file
@@ -0,0 +1,84 @@
+= material frame -1 material
+-1
+0.500000
+1.0 1.0 anim
+0.500000
+bone bone
+material = vertex -1 bone
+frame
+=
+frame
+0.500000
+bone -1 anim
+= = 0.500000 bone 0.500000 frame
+-1 frame material material texture 0.500000 texture 0.500000 -1
+vertex vertex frame texture = material anim
+frame
+vertex =
+frame = 1.0 texture -1 -1
+anim anim
+texture
+texture -1 0.500000 material =
+texture = -1 anim
+material 1.0 frame = frame 0.500000 frame
+vertex bone texture
+0.500000
+material
+= bone 1.0
+bone -1
+=
+1.0 1.0
+anim anim = 1.0
+frame
+0.500000 texture bone frame material 0.500000 bone anim frame bone bone frame =
+= 0.500000
+texture
+texture texture 1.0 anim 0.500000
+bone
+material texture
+bone = -1 anim frame bone = vertex 0.500000 -1 material material
+-1 -1 vertex 0.500000 1.0 bone -1
+0.500000 vertex
+frame
+texture frame bone anim anim
+bone anim anim vertex material = -1 0.500000 vertex frame 1.0 bone texture 1.0 = -1 bone
+material bone
+1.0
+texture
+-1 frame vertex texture =
+bone frame anim
+= bone = =
+texture -1 material 1.0
+anim
+anim
+-1 1.0 -1 bone texture vertex -1 0.500000
+frame
+vertex frame 0.500000
+vertex material texture anim 1.0
+frame
+=
+anim
+frame bone bone anim vertex
+material bone
+0.500000 -1 frame = -1 -1 vertex frame 0.500000 anim
+= texture material
+material bone
+frame 1.0
+material texture texture texture material
+-1
+texture anim 1.0 = = = -1 -1 anim anim
+-1
+anim vertex 0.500000 -1 vertex
+bone
+1.0 1.0
+bone texture
+frame
+frame
+0.500000 anim
+material 0.500000 frame
+1.0 = vertex
+material 0.500000 bone =
+-1 anim material material anim = -1
+material = -1 frame = anim 1.0 frame
+= anim -1 bone -1
+anim 1.0 bone 0.500000 material 0.500000 vertex v
\ No newline at end of file
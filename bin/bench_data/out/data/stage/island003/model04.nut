@@ -0,0 +1,59 @@
+-1 material 0.500000 = frame bone vertex = 1.0 = vertex -1 anim 1.0 = vertex 0.500000 anim -1 texture texture frame texture frame
+-1 0.500000 -1 vertex
+anim -1 -1 0.500000 bone = anim material
+texture 0.500000 anim material =
+1.0
+frame = bone material bone 1.0 material = 1.0 texture
+1.0 1.0
+= vertex 0.500000
+-1
+frame = material frame -1
+-1 material 0.500000 bone 1.0 = material texture material 0.500000
+-1
+frame frame -1
+0.500000
+material = anim bone anim anim 0.500000
+bone bone = material 0.500000 0.500000 material
+0.500000
+bone
+0.500000
+anim 1.0 frame bone
+material 0.500000 bone 1.0 anim bone = frame
+anim
+frame anim
+-1
+frame
+-1 1.0 anim 0.500000 0.500000 frame frame = frame texture vertex material
+material
+material 0.500000
+texture 0.500000 vertex
+-1 -1 1.0
+texture
+anim 1.0 =
+1.0
+vertex material bone frame 0.500000 0.500000
+material anim anim
+vertex bone frame bone texture 0.500000 = bone texture
+1.0 vertex 0.500000 anim material
+bone = anim = anim bone vertex bone texture material
+= bone -1 1.0
+anim 1.0 texture = texture vertex vertex vertex vertex
+material -1 frame 0.500000 0.500000 0.500000 vertex -1 anim
+= -1 -1 texture texture
+bone frame
+material
+1.0 frame frame texture texture 1.0
+-1 material 1.0 frame
+anim vertex
+-1 frame bone =
+anim 0.500000 -1 texture -1 bone -1 anim
+= -1 anim anim vertex bone =
+1.0 frame material -1 0.500000 bone bone
+frame
+1.0 frame bone vertex
+= frame vertex bone
+texture anim
+material frame
+= =
+texture 1.0 1.0 0.500000 =
+vertex 
\ No newline at end of file
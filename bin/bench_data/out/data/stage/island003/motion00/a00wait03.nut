@@ -0,0 +1,12 @@
+1.0 1.0 frame = = texture bone
+bone
+1.0 bone texture
+frame 0.500000 =
+= material
+1.0 -1 material
+anim
+anim vertex
+=
+1.0 bone anim
+= frame texture
+= frame bo
\ No newline at end of file
@@ -0,0 +1 @@
+0.500000 material = texture anim vertex tex
\ No newline at end of file
@@ -0,0 +1,6 @@
+frame frame
+texture
+bone material frame
+1.0
+bone
+1.0 texture
\ No newline at end of file
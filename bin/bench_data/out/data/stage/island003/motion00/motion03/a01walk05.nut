@@ -0,0 +1,347 @@
+texture 1.0 = = = material texture anim anim
+-1 texture frame bone frame = material
+0.500000
+0.500000 bone
+1.0
+vertex 0.500000 1.0
+vertex
+vertex anim texture
+= anim
+texture vertex bone frame
+vertex
+bone = vertex
+0.500000
+anim texture = -1 0.500000 -1 1.0 texture
+= vertex material vertex
+vertex -1 material vertex vertex vertex anim 0.500000 0.500000
+1.0 anim -1 vertex material 0.500000 material texture -1
+material = anim
+bone 0.500000 =
+1.0 texture material 1.0 0.500000
+anim -1 =
+1.0
+material = vertex anim bone frame vertex = 1.0 vertex 1.0 material material frame
+material
+texture texture frame frame
+-1 material anim frame frame 1.0 anim bone bone 0.500000 material
+frame 0.500000 = 0.500000
+anim
+-1 vertex 1.0 texture texture anim
+bone frame anim
+bone frame
+vertex
+vertex texture
+= material 0.500000
+= anim 1.0
+bone 0.500000
+-1
+1.0 0.500000 anim material
+0.500000 -1 vertex material -1
+1.0 material material 1.0 material
+vertex
+anim 0.500000 material frame = frame 0.500000
+anim texture 1.0 bone bone
+-1 anim
+-1 bone material texture
+-1
+bone bone 1.0 frame 0.500000
+material -1 0.500000 material
+= = = 1.0 1.0
+bone bone material 0.500000
+=
+0.500000 0.500000 anim
+vertex 0.500000
+-1 material
+0.500000
+frame bone anim 1.0
+1.0 = frame material vertex anim anim = 0.500000 -1 0.500000 frame 1.0 anim
+texture 1.0 = frame =
+= vertex
+-1
+0.500000 material anim anim material
+vertex
+anim 0.500000 vertex vertex 0.500000
+frame material vertex
+frame -1 0.500000 -1 vertex texture frame = texture
+texture -1 vertex = vertex =
+texture =
+frame
+anim = frame
+vertex texture material frame
+material texture bone 1.0 bone texture texture texture texture
+1.0
+bone vertex
+frame 1.0 bone =
+texture 1.0 vertex
+-1 anim 1.0 anim material = -1 frame =
+material = 0.500000 bone material texture vertex 0.500000 texture
+texture vertex vertex
+1.0 frame 1.0 frame anim 0.500000 vertex frame
+1.0 vertex
+1.0 0.500000
+vertex bone
+= anim anim bone anim
+0.500000
+-1 texture
+frame bone vertex
+texture anim
+bone 0.500000 frame
+material anim
+1.0 frame 0.500000 bone anim
+frame
+bone frame
+material
+material 0.500000 material frame texture bone = 0.500000 material anim
+1.0 bone =
+1.0 -1 0.500000
+frame 0.500000 0.500000 vertex
+1.0 vertex
+-1 texture anim
+vertex material 0.500000
+frame frame = texture =
+anim
+0.500000 = = -1 1.0 -1 anim -1 bone = = 0.500000
+anim -1 anim frame =
+vertex anim vertex
+frame 0.500000 anim bone material bone bone
+0.500000 1.0 bone bone material material
+0.500000
+bone anim
+texture 1.0
+1.0 = bone 1.0 anim
+frame bone bone -1 material
+= -1 anim -1 texture
+bone
+material -1 material
+-1
+-1
+-1
+vertex
+1.0 frame bone 0.500000
+frame
+-1 material material
+=
+material 0.500000 anim anim bone frame -1 texture
+frame texture anim bone vertex bone 0.500000
+texture frame vertex material material 1.0 1.0
+1.0
+vertex
+texture
+0.500000 vertex
+texture -1 bone frame
+frame
+0.500000 0.500000 texture
+vertex frame bone anim frame
+texture material anim
+vertex frame =
+-1
+-1
+texture
+texture = vertex frame
+1.0 -1 material bone 0.500000
+material
+texture frame
+1.0 0.500000 bone vertex = =
+material -1 anim 1.0
+-1 bone 1.0 texture
+-1 -1
+texture bone = material bone anim 1.0 0.500000 texture bone frame texture = material bone 1.0
+bone 1.0
+vertex
+vertex
+frame -1 bone -1 vertex anim anim material texture
+anim
+-1 1.0
+1.0
+texture frame
+anim
+0.500000 texture vertex texture anim = = = material 1.0 = anim material material 1.0 -1 = -1
+1.0 = texture frame anim = -1 texture
+=
+texture vertex
+=
+anim anim
+-1 0.500000 bone
+vertex
+-1 0.500000 = frame material 0.500000 texture 1.0 vertex
+vertex
+vertex frame 1.0 anim
+bone
+1.0
+anim -1
+0.500000 frame
+material
+material
+material -1 =
+material texture texture
+anim anim -1
+material material 0.500000 0.500000 frame vertex
+texture texture 0.500000
+0.500000 bone
+1.0 1.0 anim frame texture material
+= material
+frame 1.0 frame anim texture -1 frame anim = vertex -1 -1 anim frame -1 bone 0.500000
+= frame = frame
+0.500000 vertex vertex -1 frame
+texture -1 bone
+vertex
+texture = frame 0.500000 = frame
+-1
+texture 0.500000
+material vertex
+0.500000 1.0 -1
+material 1.0 1.0 material bone frame bone vertex
+=
+0.500000 material material anim -1
+1.0 frame texture
+vertex
+= 1.0 frame 1.0
+anim vertex frame
+0.500000
+= =
+bone 1.0
+bone bone 1.0 bone vertex
+-1 -1 anim vertex anim vertex bone
+= material anim
+frame 1.0 1.0 anim -1 0.500000
+bone bone texture
+= texture vertex bone material frame texture vertex frame texture
+anim
+1.0 material
+0.500000 vertex
+frame
+= vertex
+texture
+bone frame frame
+anim material
+bone material
+texture
+-1 1.0 1.0 material frame texture frame vertex
+frame anim texture
+= bone
+0.500000 = = frame vertex -1 1.0
+material material
+anim 0.500000
+material -1
+-1 -1 bone material
+bone frame frame anim vertex frame
+-1 0.500000
+1.0
+bone frame vertex texture frame -1 material texture bone 0.500000 1.0
+1.0
+1.0
+frame = material 0.500000
+bone material
+material anim texture anim -1 0.500000 0.500000 frame anim anim
+anim 0.500000 = texture -1 material
+texture anim = anim anim bone 1.0
+texture 0.500000 = material
+0.500000 -1 texture 0.500000 material -1 =
+-1 0.500000 -1 0.500000 material anim
+= 1.0
+-1
+= -1
+= 0.500000 1.0 bone material texture frame -1
+bone bone bone -1 material frame = 0.500000 -1 0.500000 material vertex
+bone
+1.0 1.0 0.500000 material = =
+0.500000 frame
+vertex 1.0 -1 -1 material = vertex
+frame bone frame material = -1 bone 1.0 texture 0.500000 = material
+frame -1
+0.500000 anim = -1 material 1.0 bone = texture
+material vertex
+= = vertex texture anim bone
+=
+material = vertex
+frame frame 0.500000 1.0 frame 1.0 anim -1
+material 1.0 0.500000 frame anim 1.0 frame
+material texture -1 texture anim 0.500000 bone
+= vertex vertex material
+=
+material bone vertex
+frame
+texture
+0.500000
+-1
+1.0 frame
+vertex -1 -1 1.0 -1 texture frame vertex
+texture bone
+0.500000 bone frame material
+anim frame texture
+texture texture = 0.500000 -1 -1 bone 1.0 0.500000 vertex vertex
+= -1 material bone material
+bone anim bone 0.500000
+texture -1
+vertex 0.500000 anim anim vertex
+1.0 vertex material frame
+vertex
+frame texture 1.0 -1 frame -1
+=
+1.0 material anim =
+0.500000 1.0
+material -1 frame -1 texture vertex 0.500000
+= material vertex anim material -1
+1.0
+anim = -1 bone 1.0 texture 1.0 frame texture 1.0 =
+frame anim
+frame material = =
+bone bone -1 anim anim vertex
+-1 anim
+material
+bone texture texture
+1.0 1.0 material
+0.500000 texture = frame -1
+frame frame
+-1 -1 anim anim anim =
+vertex
+material material texture 0.500000 anim -1 vertex -1 bone
+bone
+material vertex 1.0
+vertex
+frame material texture 0.500000 material -1 = material 1.0 vertex
+0.500000 frame frame 0.500000 -1 vertex bone texture vertex = -1 material
+material = bone vertex
+texture material
+material bone vertex texture 0.500000 anim texture bone = 1.0 material
+material bone material material 1.0 -1 bone -1 material 1.0
+material 1.0 =
+material
+0.500000 bone texture material -1 frame 0.500000
+0.500000 -1 0.500000
+= vertex
+-1 vertex anim vertex 1.0 vertex 1.0
+0.500000 bone vertex anim material bone
+bone
+1.0
+= bone bone 0.500000 vertex -1
+anim material vertex
+=
+1.0
+anim frame bone
+frame
+texture vertex 1.0 anim -1 -1 = texture texture 0.500000 vertex
+0.500000 1.0 1.0 -1
+frame vertex
+1.0 = -1
+frame -1 texture -1
+=
+0.500000
+0.500000 anim
+1.0 = texture anim
+frame
+anim texture
+material
+texture
+-1 texture bone -1 0.500000 texture
+anim
+0.500000 frame = 0.500000 =
+vertex
+texture frame frame bone
+-1
+-1 1.0 1.0 = -1 material
+anim anim
+frame material vertex = texture material frame -1 0.500000
+-1 anim -1 vertex 1.0 -1 frame
+anim 1.0 anim material anim texture material material
+vertex a
\ No newline at end of file
@@ -0,0 +1,5 @@
+vertex 0.500000
+= = anim frame texture 1.0 0.500000
+=
+1.0 bone
+vertex 
\ No newline at end of file
@@ -0,0 +1,90 @@
+-1
+frame bone
+-1 frame 0.500000 0.500000 bone vertex
+anim frame
+material
+frame texture
+material 1.0 bone material =
+-1 material bone
+1.0 vertex 0.500000 -1
+= 1.0 anim
+1.0
+-1 -1 1.0 frame -1 vertex
+texture 0.500000 frame 1.0 material
+bone material 0.500000 texture anim 1.0 anim material vertex =
+anim
+-1
+texture material texture = material material
+bone material
+-1
+texture material 0.500000
+texture -1 vertex material frame anim
+frame
+bone 0.500000 -1 anim -1
+material
+1.0 0.500000 material anim anim 0.500000
+material
+texture vertex
+material
+material texture
+material anim frame
+-1 1.0
+frame texture
+material
+=
+-1 -1 frame
+bone vertex
+material 0.500000 -1 bone
+anim material anim material = -1 vertex 1.0 = bone
+frame = texture vertex anim 1.0 bone
+1.0 vertex texture 0.500000 anim 0.500000 0.500000
+texture 0.500000 material anim 0.500000 vertex
+-1 frame
+material
+-1 vertex texture
+anim
+0.500000
+bone anim 0.500000 texture bone bone = =
+texture
+= 1.0 bone
+bone vertex bone frame texture
+anim anim vertex frame -1 vertex bone = bone = frame material vertex
+-1 anim
+= 1.0 vertex material texture
+-1 anim anim
+texture material
+texture =
+anim -1 material vertex material
+= 0.500000
+material vertex
+texture -1 anim 1.0 vertex
+anim
+0.500000 anim -1
+anim vertex anim texture
+1.0 -1
+0.500000 1.0
+= bone
+anim 0.500000 material = 1.0
+1.0 anim
+vertex anim frame material anim
+1.0 bone material material texture -1 bone
+texture frame anim =
+vertex material = anim
+frame = bone bone texture = =
+bone
+0.500000
+bone anim vertex 1.0 texture = anim frame texture frame =
+frame anim vertex
+= = -1
+frame
+anim frame 0.500000 = anim 1.0 material
+1.0 material anim 1.0
+texture
+anim
+material material
+anim vertex 1.0
+1.0
+texture
+bone -1 bone frame
+=
+= 1.0 frame vertex -1 = -1 -1 fra
\ No newline at end of file
@@ -0,0 +1,10 @@
+anim 0.500000 vertex material material 1.0 = vertex vertex anim
+1.0
+1.0 -1 -1 bone frame
+-1
+0.500000 vertex -1
+anim frame
+texture material 1.0 -1 1.0 =
+-1
+= 1.0 frame anim 1.0 = 0.500000
+vert
\ No newline at end of file
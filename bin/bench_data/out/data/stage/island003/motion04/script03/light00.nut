@@ -0,0 +1,50 @@
+=
+0.500000 frame material 0.500000 material
+vertex frame texture 0.500000 0.500000 -1 bone = anim 1.0 anim
+= 1.0 texture bone frame
+anim vertex anim
+0.500000 frame bone
+material 0.500000 = material frame
+1.0
+bone vertex vertex
+1.0
+0.500000 vertex 1.0 = -1
+bone
+anim 0.500000 frame 0.500000 frame bone texture
+vertex
+bone 0.500000
+texture -1
+bone
+-1
+bone
+0.500000
+texture material 0.500000 anim material frame texture 1.0 vertex
+bone vertex material
+0.500000 texture
+texture -1 texture = 1.0 -1
+0.500000 0.500000 material
+bone
+= material 1.0
+material
+vertex -1 0.500000 = anim -1 vertex vertex 1.0 texture frame
+anim frame 0.500000
+bone material
+= 0.500000 vertex = bone vertex 0.500000 = texture texture frame frame frame
+=
+1.0 1.0 texture bone
+bone anim texture =
+frame
+0.500000
+-1 1.0 anim anim -1
+-1 0.500000 texture
+0.500000 material texture 0.500000 1.0
+vertex = 1.0 anim
+vertex anim
+=
+bone frame 0.500000 frame
+0.500000 = material texture
+material bone -1 -1 texture vertex vertex frame
+texture -1 vertex anim
+= vertex bone texture
+-1 0.500000
+1.0 0.500000 frame fra
\ No newline at end of file
@@ -0,0 +1,189 @@
+0.500000 frame material
+0.500000 -1 texture
+vertex frame =
+= -1 vertex
+frame 1.0 anim -1 0.500000 anim frame 0.500000 anim -1 material -1 = 0.500000
+frame = vertex vertex
+bone
+material
+vertex = =
+texture anim texture bone vertex 0.500000 frame 1.0
+bone
+frame texture -1 anim bone -1 bone material
+1.0 -1
+bone bone vertex 1.0 bone -1 =
+frame 1.0 material
+= bone bone bone 0.500000 =
+0.500000 frame frame texture
+0.500000
+= anim
+bone anim =
+-1 = = frame
+=
+vertex vertex 0.500000 = = =
+bone 1.0 1.0 frame
+frame anim texture material material
+= vertex vertex -1 material frame
+1.0 frame frame anim = = -1 1.0
+bone frame
+0.500000 -1
+frame
+-1 texture 1.0 material material frame anim texture 1.0 bone material
+texture = -1 texture
+material vertex 0.500000 -1 -1 bone
+vertex vertex bone = texture bone 0.500000 vertex = vertex frame anim frame =
+vertex = -1 bone = vertex -1 texture anim anim
+texture 0.500000 anim vertex 0.500000 anim texture texture -1 material vertex texture material anim material
+vertex =
+bone 0.500000 frame texture material
+1.0 0.500000 anim texture =
+0.500000 anim material 0.500000
+1.0 vertex bone
+bone 0.500000 = vertex 0.500000 texture
+bone
+texture material
+frame
+frame material frame texture texture
+material
+texture
+vertex =
+1.0 bone frame -1 vertex
+texture 0.500000 0.500000 material bone 0.500000 = = = vertex -1 frame 1.0
+vertex bone vertex
+frame 0.500000
+-1 0.500000 texture anim
+anim material 0.500000
+bone anim
+vertex texture
+material frame 1.0 anim 1.0
+texture = =
+= vertex
+1.0 frame texture anim texture material 1.0 1.0 =
+anim
+material bone
+1.0 = -1
+0.500000
+anim
+bone texture -1 = anim vertex bone
+bone 0.500000 frame material
+texture -1 1.0 material frame
+texture 0.500000 frame 1.0 anim material vertex bone vertex -1 = frame -1 frame
+frame -1 = =
+vertex -1 = = = 0.500000 -1 -1
+1.0
+anim
+bone
+material =
+frame
+texture anim texture -1 1.0 bone -1 frame texture
+0.500000
+=
+texture
+anim bone
+= anim bone material frame
+anim -1 bone -1 vertex 0.500000 frame -1 = material material 0.500000 anim = bone vertex = texture -1
+vertex
+material 1.0
+-1 vertex
+anim frame texture anim texture bone vertex texture -1
+= 0.500000 -1 1.0 bone 1.0
+bone frame -1 texture texture 0.500000 texture bone -1 1.0
+material frame
+vertex
+material
+texture anim texture
+=
+1.0 vertex
+anim texture anim anim
+0.500000 = 1.0 = texture material
+frame -1 texture vertex 0.500000 texture 0.500000 1.0
+=
+vertex 0.500000 = frame = anim 0.500000 texture bone
+-1 1.0 -1 frame
+-1 -1 bone bone material
+bone 0.500000
+0.500000 material
+= material 1.0 frame
+-1 anim -1
+= 1.0
+vertex vertex =
+frame
+anim 1.0
+0.500000 = anim bone =
+0.500000 1.0 anim
+0.500000 vertex vertex
+vertex
+texture anim
+material anim vertex -1 = 0.500000
+frame 1.0 material anim texture
+anim anim vertex 1.0 frame
+anim material = = material bone = material
+texture
+0.500000 -1
+frame anim 1.0 -1 0.500000 texture 1.0 -1 material texture = vertex
+vertex 0.500000 anim
+1.0 texture bone 1.0 material anim texture
+material texture 1.0 vertex bone
+vertex -1 frame material material material -1 =
+1.0 = -1 texture -1
+0.500000 vertex 0.500000
+anim material
+1.0
+bone
+vertex material
+frame
+texture -1 =
+anim 1.0 vertex
+vertex
+= 1.0
+frame -1 texture anim 0.500000 1.0 texture
+anim anim 0.500000 texture
+1.0 frame
+1.0
+bone -1
+frame anim vertex
+1.0 vertex = -1 texture anim = 1.0
+vertex
+anim = bone 0.500000
+vertex
+texture = frame 0.500000 1.0 material bone
+0.500000 texture
+=
+-1
+texture
+material material vertex =
+0.500000 bone frame bone
+= 0.500000 1.0 texture vertex bone
+anim 1.0
+= vertex
+texture frame 0.500000 material material bone anim -1 frame 0.500000 anim bone vertex frame
+texture bone frame texture frame
+material 1.0 = frame vertex
+0.500000 =
+0.500000
+material
+anim -1 material bone material texture 1.0 material bone texture frame
+bone 1.0 = 1.0 texture
+anim bone 1.0
+texture
+vertex
+= material material -1
+vertex anim
+1.0 frame =
+texture material bone
+texture -1
+-1
+0.500000 = bone bone anim bone = texture
+bone bone frame frame bone texture = frame bone material anim 0.500000 texture frame = material
+material texture frame
+= vertex vertex vertex
+anim vertex material
+material
+bone material texture
+0.500000 anim = = 1.0 vertex -1 material anim
+0.500000 = -1 0.500000 material
+material anim vertex
+frame -1 texture -1
+=
+frame 1.0
+-1 0.500
\ No newline at end of file
@@ -0,0 +1,9 @@
+-1 vertex texture
+frame -1
+-1
+1.0 = 1.0 material
+0.500000 = 0.500000 texture material anim 0.500000 bone
+anim bone 0.500000 bone vertex
+0.500000
+vertex
+frame frame 1
\ No newline at end of file
@@ -0,0 +1,18 @@
+anim bone texture texture anim
+-1 bone 1.0 0.500000 = anim
+0.500000 1.0 texture frame frame -1 texture
+-1 frame
+texture =
+=
+= bone
+texture
+material vertex
+frame
+bone
+frame
+bone frame texture
+material =
+1.0 = -1 anim vertex anim anim anim material bone 1.0 frame 1.0
+0.500000 texture vertex material vertex 0.500000 -1 vertex
+0.500000 1.0
+1.0 0.500000 -1 frame 0.500000 texture frame bone = -1 
\ No newline at end of file
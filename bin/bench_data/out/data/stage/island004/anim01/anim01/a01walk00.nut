@@ -0,0 +1,2 @@
+anim -1 anim
+1.0 texture vertex material material vertex 0.500000 anim
@@ -0,0 +1,17 @@
+bone material texture bone 1.0 texture = 0.500000 =
+material bone material texture -1 material 1.0 frame texture
+anim vertex vertex 0.500000 anim -1 = anim 0.500000
+frame frame
+anim material material
+material 1.0 1.0 1.0
+0.500000 = material = material
+-1 vertex anim material -1 bone
+frame 0.500000
+=
+anim
+vertex
+-1 = = material
+-1 1.0 1.0 frame
+0.500000
+frame texture -1 = material vertex bone bone = frame
+bon
\ No newline at end of file
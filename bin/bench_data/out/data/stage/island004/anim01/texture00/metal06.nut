@@ -0,0 +1,45 @@
+bone -1 bone =
+anim texture texture texture frame anim
+-1 -1 0.500000 material 0.500000 vertex = -1 material vertex
+frame vertex 1.0 = 0.500000 0.500000 material -1 frame 0.500000 1.0 vertex 0.500000
+-1 1.0
+material material
+0.500000
+material bone vertex
+vertex
+frame -1
+bone material anim 0.500000
+texture
+vertex bone material
+bone -1 -1 =
+anim 0.500000 =
+1.0 vertex 1.0 bone
+0.500000 1.0 frame -1 0.500000 1.0
+frame -1 bone
+bone frame vertex material anim frame frame bone 1.0 anim material material texture
+= frame = anim
+-1
+vertex
+anim frame material
+material
+0.500000 1.0 vertex =
+vertex
+= anim
+-1
+frame
+-1 -1 vertex -1 0.500000 1.0 vertex -1 texture material
+texture
+1.0
+vertex -1 material = -1 0.500000 material bone anim frame vertex 1.0 frame
+-1 = vertex texture texture 0.500000 1.0 vertex texture = material
+material
+= =
+frame texture 0.500000 anim bone frame -1 1.0
+texture bone vertex 0.500000 1.0
+-1 anim frame 1.0 material -1 anim anim anim -1
+frame
+1.0 anim
+bone -1 1.0
+material
+= 0.500000 vertex frame 1.0
+texture texture
\ No newline at end of file
@@ -0,0 +1,5 @@
+0.500000 vertex
+-1 = 1.0
+texture -1
+material material anim material
+anim 
\ No newline at end of file
@@ -0,0 +1,19 @@
+material anim
+frame vertex -1 1.0 frame frame material frame -1 vertex material 0.500000 anim material
+frame texture anim material = vertex material
+material anim
+texture = texture
+1.0 texture anim
+material material texture material texture bone
+texture 0.500000 material frame texture texture 1.0 anim -1
+0.500000 anim 0.500000
+0.500000 vertex
+vertex
+frame texture
+bone =
+frame =
+bone frame
+-1 material
+-1 frame
+1.0 1.0 =
+te
\ No newline at end of file
@@ -0,0 +1,184 @@
+texture texture 1.0 0.500000 vertex
+1.0 -1 texture anim
+anim 1.0 vertex -1 -1
+1.0 anim vertex bone frame
+1.0 bone 1.0 frame
+vertex = frame
+= frame material anim -1 bone
+material material bone texture = -1 1.0
+-1 = 1.0 frame vertex texture -1 0.500000 vertex
+anim 0.500000 material
+material anim
+material 0.500000 1.0 texture
+= -1
+bone
+-1
+0.500000
+frame frame anim =
+1.0
+vertex 0.500000 -1 0.500000
+anim 1.0
+-1 bone -1 1.0 anim texture material material 0.500000
+= material = bone -1
+material
+texture 0.500000 frame 1.0 anim bone
+vertex 0.500000 material
+= =
+1.0 =
+vertex 0.500000 frame frame -1 0.500000 1.0 0.500000
+anim
+=
+= material 1.0
+frame texture vertex 1.0 vertex vertex bone vertex
+bone = = 0.500000 = material -1 anim
+=
+vertex bone anim vertex 1.0
+1.0 -1 1.0 = texture material = bone
+-1 texture anim frame anim frame -1 -1
+material vertex
+material anim
+material 0.500000 -1
+0.500000
+-1
+anim bone frame
+frame
+material 0.500000 anim texture vertex
+0.500000 0.500000 texture anim 1.0 1.0
+texture anim = texture material material
+=
+-1 frame anim
+-1 frame texture anim bone bone
+material bone bone 1.0 0.500000 vertex 1.0
+-1 vertex material 1.0 0.500000 anim frame 0.500000 material
+0.500000 1.0 texture
+frame
+=
+= -1 -1
+bone vertex frame -1
+material = vertex frame = 1.0 1.0 anim -1 anim =
+-1 anim 1.0 -1
+-1
+anim
+-1 frame vertex
+= frame bone
+texture frame 1.0 bone texture
+vertex material anim
+material
+1.0 material anim
+= anim frame bone texture texture frame -1 bone
+texture frame bone 1.0 material -1 material
+= material
+material vertex texture = -1
+frame -1 -1 0.500000 anim
+0.500000 bone
+= = vertex bone frame anim
+= -1 =
+1.0 1.0 -1
+vertex = frame
+bone 1.0
+bone material texture -1 vertex frame -1 material 1.0 bone vertex anim
+texture
+material
+=
+0.500000 anim material vertex 1.0 frame
+= frame 0.500000 1.0 -1
+-1 0.500000 -1 texture bone material 1.0 -1 = =
+-1
+anim
+1.0 texture 1.0
+vertex
+material = vertex anim = 1.0 material anim
+anim 0.500000 vertex anim texture texture material material vertex
+vertex texture = = = vertex vertex
+vertex texture texture
+anim =
+0.500000 bone anim
+frame
+vertex 0.500000 = texture
+-1 vertex -1 texture frame -1
+0.500000
+texture frame
+material
+0.500000
+frame bone anim
+bone 0.500000 material -1 -1 bone
+= frame 0.500000
+= frame = = bone material 1.0 material 1.0 1.0 = -1 material vertex 0.500000 anim texture texture vertex
+material material bone vertex 0.500000 frame texture 1.0 bone = frame
+frame texture bone material bone material = anim bone frame texture 0.500000 texture
+frame
+vertex -1 material -1 texture frame
+-1 0.500000 vertex -1
+bone
+bone frame
+1.0
+material
+-1 anim 1.0 -1 1.0 = texture 0.500000 bone anim bone
+material vertex bone
+bone anim frame anim
+material
+material -1 = 1.0 material bone -1 vertex
+1.0 =
+0.500000 bone texture 1.0 anim -1
+texture vertex = =
+vertex
+frame
+frame texture
+bone vertex -1 vertex -1 =
+1.0
+anim
+= = anim 0.500000 0.500000 texture bone bone vertex material
+=
+= vertex
+-1 bone 1.0 1.0 1.0 frame 1.0 texture 1.0
+material
+anim bone 0.500000 0.500000
+0.500000 vertex frame bone 1.0 frame 0.500000 bone frame frame vertex anim frame 1.0 anim frame bone -1
+material frame 0.500000 frame 0.500000
+bone texture
+1.0 bone
+-1 frame 1.0 bone bone bone
+1.0 vertex 1.0 anim
+material
+vertex
+bone -1 0.500000 texture = -1
+vertex
+anim -1 1.0 0.500000 = frame vertex anim 0.500000 texture
+frame -1 -1 0.500000 1.0 -1
+1.0
+material texture 1.0 bone
+material anim
+1.0
+1.0 0.500000 vertex texture -1 material
+= = vertex material 0.500000 vertex
+texture -1 texture 0.500000 bone material vertex
+anim = 0.500000 1.0 texture frame anim frame -1
+0.500000 -1 frame anim 1.0 -1 bone vertex
+anim =
+-1 = bone vertex anim anim frame texture =
+texture 1.0 0.500000 vertex 1.0
+= material anim material = frame bone
+anim bone material -1 material texture texture vertex
+frame material anim
+vertex =
+-1 anim
+= frame
+texture
+-1 anim frame
+anim 0.500000
+= anim
+= anim frame
+material -1 0.500000 anim material frame
+vertex vertex vertex
+= 0.500000 bone frame -1 -1
+material
+1.0
+1.0 -1 =
+0.500000 1.0
+0.500000 -1
+0.500000 frame bone anim
+texture frame 1.0 material anim
+= texture
+0.500000 bone frame 0.500000 frame -1 0.500000 -1
+bone material 0.500000
+-1
\ No newline at end of file
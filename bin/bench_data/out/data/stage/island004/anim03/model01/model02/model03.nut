@@ -0,0 +1,65 @@
+material
+0.500000 texture 1.0 texture = vertex 1.0 bone
+frame
+frame texture
+0.500000 -1 =
+anim frame 1.0 material 0.500000
+-1
+-1 frame 1.0 bone
+-1
+-1
+material
+0.500000
+vertex material 1.0
+material
+0.500000 1.0 0.500000
+frame texture 0.500000 material 1.0 frame anim
+frame bone
+= material -1 0.500000 1.0 texture = vertex 1.0 frame texture vertex
+anim -1
+bone bone vertex bone
+0.500000 anim = vertex 0.500000 0.500000 material
+frame material frame = 0.500000 frame -1 anim
+texture -1 frame 0.500000 frame anim 1.0 bone frame vertex 1.0 texture = -1 anim -1 -1
+material bone
+material vertex 0.500000 vertex frame anim frame bone
+texture material
+-1 bone frame
+texture material -1 anim 0.500000
+-1 material texture
+0.500000 frame frame
+-1 0.500000 bone 1.0
+material = 1.0 0.500000 1.0 = 1.0
+vertex
+frame 0.500000 texture texture bone
+-1
+frame
+frame vertex material texture frame texture
+anim -1 =
+material texture 0.500000 bone material frame
+-1
+= 0.500000 vertex texture bone -1 frame bone
+anim
+texture vertex = frame material vertex anim anim
+material bone = vertex
+vertex frame
+-1 anim vertex bone frame = anim vertex -1 material =
+0.500000 vertex bone texture anim = texture =
+0.500000 =
+-1 vertex texture 0.500000 material vertex bone =
+-1
+bone
+vertex = bone
+frame -1 1.0 texture anim texture
+material frame -1 1.0 -1
+bone anim 0.500000 = bone
+-1 bone material texture texture 1.0 material vertex anim -1 anim material frame bone
+bone 0.500000 =
+0.500000 0.500000 material material
+-1 bone
+=
+bone anim -1 = anim vertex 0.500000 bone -1 vertex
+bone
+vertex
+frame
+= frame vertex material anim
\ No newline at end of file
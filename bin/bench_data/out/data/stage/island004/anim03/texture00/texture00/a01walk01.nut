@@ -0,0 +1,212 @@
+frame bone material -1 anim
+frame material vertex
+frame
+0.500000 = bone
+=
+material frame = frame anim
+vertex bone texture
+= = vertex anim 0.500000 frame frame texture
+anim anim frame
+anim anim
+0.500000
+0.500000
+1.0
+texture frame 1.0 texture texture 0.500000 frame anim frame 0.500000 0.500000 anim vertex =
+material
+anim -1 0.500000 -1 material
+1.0 vertex material material
+0.500000
+0.500000 material
+vertex = frame anim material material
+=
+0.500000 texture bone -1
+texture material frame
+vertex material vertex
+= 0.500000 0.500000 0.500000 = 1.0 bone 0.500000 material frame 0.500000 0.500000 frame 1.0
+0.500000 0.500000
+texture bone material -1 frame 0.500000 0.500000 -1
+0.500000 anim 0.500000 texture
+-1 bone vertex texture texture frame 0.500000
+anim anim
+1.0 = -1 material
+texture = 0.500000
+material
+material
+bone
+anim anim vertex vertex material
+frame 1.0 -1 -1 material frame material
+1.0 bone =
+frame bone 1.0
+vertex frame material
+material vertex
+material vertex = texture
+-1 vertex
+material 1.0
+frame
+-1 vertex material anim
+0.500000 texture bone -1 vertex
+=
+anim frame
+frame bone
+anim = vertex 1.0 bone bone material anim -1 1.0 texture
+bone 0.500000 vertex
+bone
+frame texture 0.500000 vertex frame
+bone
+material material
+-1 1.0
+0.500000 -1 frame
+frame
+= 0.500000 0.500000 1.0 = bone -1
+bone vertex 0.500000
+frame -1 material material material = bone frame
+vertex
+0.500000 -1 vertex
+bone
+bone texture material bone
+0.500000 0.500000
+anim = 0.500000 1.0 bone frame
+texture material vertex
+= anim
+bone -1 -1 vertex -1 texture texture 0.500000
+1.0 1.0 texture
+-1 material texture
+frame anim
+texture bone bone 0.500000 1.0
+anim material
+vertex
+1.0 material 1.0 texture bone anim 1.0 bone
+= 1.0
+-1 1.0 0.500000
+= bone
+= 0.500000
+material anim texture
+vertex
+0.500000 1.0
+1.0 material texture vertex -1 0.500000 frame -1 texture = -1 =
+frame 1.0 anim 1.0 =
+0.500000 texture
+material
+0.500000 = anim
+material anim material texture frame
+bone -1
+anim anim vertex bone 0.500000
+frame
+=
+= 1.0 vertex vertex 1.0 material vertex vertex bone frame vertex
+-1 frame 0.500000 vertex
+0.500000 0.500000 = vertex
+vertex = material frame
+bone material bone 1.0 0.500000 0.500000 1.0 -1 = 1.0 anim
+bone = anim anim 0.500000 -1 1.0 bone 0.500000 vertex frame texture vertex -1 0.500000 anim bone 0.500000 vertex anim -1 frame material 1.0 texture 1.0 1.0 vertex
+material anim
+0.500000 -1 1.0
+frame
+anim vertex material material 1.0
+0.500000 bone
+bone texture
+material vertex frame frame 0.500000 vertex
+bone
+=
+material 0.500000 bone
+bone frame -1
+= 1.0 = anim bone vertex
+material
+anim -1 -1 texture 0.500000 anim anim texture
+bone
+= vertex frame texture
+1.0 texture texture -1
+0.500000
+-1
+anim
+1.0 =
+bone
+texture
+1.0 -1
+0.500000 vertex -1 anim bone 1.0 vertex bone anim 1.0 anim 1.0 bone anim = 1.0 frame texture
+1.0 -1 texture
+frame 1.0 -1 frame 0.500000 vertex vertex 1.0 -1 -1 bone anim vertex bone bone
+= = texture frame 0.500000 texture texture bone
+texture
+bone frame frame
+anim anim frame
+=
+frame -1 frame texture bone
+= anim =
+1.0 material 0.500000 bone bone bone
+anim 0.500000 anim 1.0
+= anim bone -1 frame
+0.500000 texture
+1.0 bone anim
+anim anim 0.500000
+=
+material
+-1 0.500000 vertex bone frame bone frame = vertex 0.500000
+material
+= frame vertex 0.500000 material material
+texture frame
+anim texture vertex vertex texture frame
+texture material
+bone
+= -1 = frame
+material material frame -1 = material 0.500000
+material
+vertex = -1 -1
+anim frame = 1.0
+1.0
+anim frame texture
+bone 0.500000 vertex
+-1 texture
+frame bone -1
+frame bone vertex vertex anim
+bone -1 material material -1 anim 1.0 texture vertex -1 frame 1.0
+material frame vertex
+material anim anim
+material -1
+1.0 texture frame = frame
+= texture bone texture frame frame bone
+frame -1 texture 0.500000 1.0 bone
+0.500000 0.500000 =
+texture material
+bone
+anim -1 frame material
+= frame frame bone vertex
+= 0.500000 =
+material
+vertex 1.0 material 1.0 -1 bone material texture
+texture 0.500000 texture
+-1 bone
+vertex
+1.0 0.500000
+material texture material vertex 1.0 material 1.0 =
+frame =
+1.0
+bone
+0.500000 texture frame texture vertex
+vertex material material frame 0.500000 0.500000 0.500000
+frame
+anim frame = texture
+bone
+anim =
+frame bone
+anim material
+material
+material 1.0
+frame -1 1.0 vertex texture
+texture frame
+1.0 frame
+1.0
+0.500000
+0.500000 frame = bone -1
+frame 0.500000 material 1.0 texture -1 -1
+frame
+frame frame texture 0.500000 bone 1.0 0.500000 =
+-1 vertex anim 0.500000 anim
+-1 frame vertex frame
+-1
+frame
+bone material material 1.0
+frame texture = texture bone =
+1.0 texture 1.0
+1.0 material 0.500000 = 1.0 = texture vertex material 1.0 -1 anim anim anim
+anim anim = anim mat
\ No newline at end of file
@@ -0,0 +1,4 @@
+0.500000 material vertex 0.500000
+bone texture bone texture
+anim anim texture -1 = bone anim
+anim bone anim textur
\ No newline at end of file
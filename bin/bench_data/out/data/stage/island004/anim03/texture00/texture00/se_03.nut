@@ -0,0 +1,9 @@
+frame bone vertex
+-1 =
+= anim vertex
+frame material = texture frame
+1.0 vertex 1.0 bone anim bone
+frame =
+frame -1 frame
+vertex 1.0 anim
+materia
\ No newline at end of file
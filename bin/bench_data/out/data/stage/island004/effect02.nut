@@ -0,0 +1,196 @@
+texture = texture bone bone vertex vertex frame frame
+material bone 1.0
+frame
+1.0 material 1.0 anim 0.500000 bone texture frame texture material material anim texture frame
+= 1.0
+bone material vertex -1 material -1 material -1
+0.500000 material 0.500000 frame frame texture 1.0
+vertex anim
+1.0
+0.500000 -1 frame bone material 0.500000 frame
+anim -1
+material
+material 0.500000 1.0
+material anim frame texture frame
+vertex
+0.500000 0.500000
+material anim
+vertex material
+1.0 frame anim
+= 0.500000 frame anim frame anim
+bone
+bone 1.0 -1 1.0
+vertex bone 1.0 vertex 1.0
+=
+bone frame
+vertex
+= = bone
+0.500000
+material bone frame
+texture frame vertex
+bone material frame
+bone texture anim
+= frame =
+=
+-1
+bone -1 1.0 vertex
+0.500000
+frame bone -1 texture vertex texture
+anim frame material 1.0 = = 0.500000
+=
+material material
+vertex
+bone anim = bone bone frame material vertex 1.0 0.500000 vertex -1 texture anim =
+bone
+frame anim anim
+frame -1 anim
+texture
+bone 1.0
+bone
+material anim vertex material
+= 1.0 =
+bone -1 0.500000 frame = bone
+0.500000 bone
+frame
+1.0
+bone -1 -1
+1.0
+texture =
+vertex material
+material
+vertex -1 vertex bone vertex = vertex 1.0 0.500000 bone
+frame vertex bone
+texture 1.0 anim bone = texture 0.500000 anim 0.500000 0.500000
+1.0 = texture 1.0
+=
+bone = vertex anim
+= bone 1.0 texture
+0.500000 vertex bone
+vertex 0.500000 texture vertex = vertex 1.0 bone anim 0.500000 0.500000 -1 material
+0.500000 0.500000 texture frame -1 1.0 vertex
+1.0 bone
+= 0.500000 material
+bone anim
+texture
+vertex 0.500000 -1 0.500000
+0.500000
+1.0 = texture = -1
+frame
+texture
+frame vertex 1.0 0.500000 0.500000 =
+material anim bone
+material 1.0 material 1.0 = -1 material material
+1.0 -1 0.500000 = material material = = -1 bone = vertex vertex 1.0 frame = bone
+= material 1.0 0.500000 bone bone -1 material
+1.0 vertex
+1.0 bone 1.0 0.500000 texture
+1.0 vertex material -1 texture 0.500000 bone 1.0 material bone frame bone texture 1.0 -1
+-1 -1
+anim vertex -1 0.500000 frame 0.500000 -1 -1 texture 1.0 frame
+bone material bone vertex vertex
+vertex 0.500000 = = -1 0.500000 1.0 anim bone
+bone 1.0 bone vertex
+bone
+material
+1.0 0.500000 frame
+1.0 -1 =
+0.500000 0.500000 material
+frame
+material 1.0 bone frame
+bone = vertex -1 anim anim = material anim frame = texture texture
+frame
+0.500000 frame 1.0
+1.0 =
+texture
+0.500000 frame = material vertex 1.0
+frame -1 texture = frame = 1.0 -1 frame bone anim texture
+bone
+1.0 =
+-1
+frame frame texture 0.500000 0.500000 1.0 frame anim
+1.0
+anim
+-1 material anim anim
+material texture material
+bone
+1.0 bone material = material bone frame 1.0 material anim = 1.0 material
+vertex = vertex
+frame vertex 0.500000 bone vertex 0.500000 material vertex -1 0.500000 -1 -1 vertex 1.0
+anim vertex bone = material
+frame bone 0.500000 =
+0.500000 material material bone
+texture 0.500000 -1 1.0 1.0 1.0 0.500000 = texture 1.0
+0.500000 material texture = vertex -1 material texture frame 0.500000
+1.0
+1.0
+1.0
+1.0 frame =
+vertex
+1.0 1.0 texture
+material anim vertex 0.500000 material texture texture bone 1.0 =
+1.0
+anim -1 -1 -1
+bone vertex frame
+0.500000 frame anim frame 1.0
+frame vertex material bone frame bone 0.500000
+-1 = frame 1.0 = -1
+texture anim = material anim
+anim 1.0
+texture -1 frame 0.500000 texture bone
+material material 0.500000 0.500000 anim texture
+bone texture = =
+vertex frame anim texture
+texture
+= 1.0 -1 vertex
+texture material bone
+vertex anim 1.0 1.0 vertex texture texture anim
+vertex
+frame frame frame texture material -1
+anim = = frame
+-1 material anim texture
+1.0
+material vertex texture
+= = anim texture
+0.500000 0.500000 anim =
+texture vertex
+-1 vertex bone
+0.500000 vertex texture
+anim 0.500000 -1 texture anim
+0.500000
+bone 0.500000 material 0.500000 0.500000 texture -1
+texture
+-1 anim anim anim -1 frame frame =
+bone
+-1 texture material 0.500000 0.500000
+1.0
+material
+=
+anim = anim
+anim = 1.0
+bone
+texture frame 1.0 0.500000 texture 0.500000 0.500000 1.0 =
+0.500000
+1.0
+frame frame
+texture
+texture frame
+frame anim = = texture bone
+texture = bone
+bone = vertex
+= anim
+texture 1.0
+-1 frame vertex
+anim 1.0 vertex anim 0.500000 =
+texture
+0.500000 1.0 vertex frame 0.500000 bone
+anim vertex 1.0 vertex
+= anim -1 bone anim
+anim texture
+material -1 bone vertex material -1 material bone material material vertex 0.500000
+material
+bone bone texture frame bone
+texture bone 0.500000 = vertex -1 1.0 0.500000 vertex vertex 0.500000 material
+1.0 frame frame -1 material 1.0 bone = bone
+vertex 1.0 texture = texture 0.500000 1.0 bone
+frame -1 1.0 1.0 1.0 anim
+frame 1.0
\ No newline at end of file
@@ -0,0 +1,70 @@
+anim 1.0 frame -1 anim 1.0 = = frame
+vertex 0.500000 frame =
+1.0 frame
+bone frame frame
+bone frame anim -1 1.0 1.0 anim
+-1
+material frame
+frame
+0.500000 0.500000 -1 material anim anim material 0.500000 anim
+0.500000 -1 1.0 vertex
+frame bone frame frame
+frame anim
+0.500000 bone material texture = bone 0.500000 material -1 bone texture anim = anim
+vertex anim =
+0.500000 = bone
+texture vertex 1.0 material material vertex texture material material material = =
+-1 anim vertex vertex anim anim
+= -1 frame bone 0.500000
+material
+texture vertex 0.500000 texture 0.500000 material -1
+1.0
+texture 1.0
+texture texture -1
+material vertex
+material 0.500000
+= material frame anim 0.500000 1.0 0.500000 frame
+anim = bone material frame vertex
+bone 1.0 0.500000 bone
+frame frame texture bone
+1.0 1.0 -1 -1 vertex anim
+material frame frame frame 0.500000
+= texture anim vertex anim frame
+material
+vertex
+texture vertex -1 texture
+bone
+1.0 bone
+frame 1.0 vertex 0.500000
+frame
+frame
+texture 0.500000 0.500000 frame bone = = -1
+= bone 0.500000 anim frame
+-1
+1.0 vertex
+anim
+vertex material bone texture bone anim
+bone -1 material =
+frame vertex
+texture 1.0 -1
+vertex bone = frame
+material = 1.0 frame vertex
+bone
+bone anim 1.0
+frame bone
+anim vertex -1 0.500000 bone frame
+=
+frame 0.500000 vertex -1 vertex bone bone material frame 1.0 frame
+material
+anim = vertex -1 material 1.0 bone material
+-1 texture 1.0 material -1 -1 bone bone
+0.500000 bone material 0.500000 1.0 bone frame -1
+material
+material anim texture material
+texture -1 material -1 0.500000 vertex = -1 -1 0.500000 anim 1.0
+material
+-1 =
+vertex
+material material 0.500000 -1
+frame 0.500000 = 0.500000
+material =
\ No newline at end of file
@@ -0,0 +1,8 @@
+=
+0.500000 bone material
+material vertex texture = texture
+vertex = = texture 0.500000 frame
+texture =
+0.500000
+texture material frame
+anim frame = texture bone 0.500000 bone
\ No newline at end of file
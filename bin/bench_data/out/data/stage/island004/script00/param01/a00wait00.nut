@@ -0,0 +1,5 @@
+material frame 0.500000
+bone
+vertex bone
+vertex = = vertex bone = vertex
+vertex -1 vertex
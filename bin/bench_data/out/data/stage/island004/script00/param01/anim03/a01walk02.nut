@@ -0,0 +1,25 @@
+vertex texture
+texture bone
+anim
+1.0
+-1 1.0
+anim
+0.500000
+1.0 frame =
+bone bone vertex frame texture
+-1
+texture frame = -1 texture bone frame -1
+frame bone material
+vertex = frame
+material
+-1 vertex -1 vertex bone 1.0 frame texture
+anim
+-1
+material frame bone anim
+texture
+1.0
+0.500000 vertex frame frame 1.0
+0.500000
+1.0 = anim
+anim =
+ve
\ No newline at end of file
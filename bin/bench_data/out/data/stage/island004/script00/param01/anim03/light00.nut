@@ -0,0 +1,47 @@
+anim -1 texture 0.500000
+vertex texture -1 texture = bone = vertex anim -1 material
+anim anim material 1.0 material anim
+bone
+0.500000
+material frame 1.0 anim 0.500000
+vertex bone frame
+-1
+1.0
+anim
+vertex
+texture
+bone 1.0
+bone frame 0.500000
+texture frame
+= =
+1.0 bone -1 vertex -1 -1 bone frame
+bone
+texture
+0.500000 = -1 material bone material vertex
+0.500000
+material texture anim material 1.0 texture
+material 1.0 bone frame texture bone texture
+-1 anim vertex = 1.0 vertex
+vertex frame texture
+material =
+frame =
+material bone
+anim 0.500000 vertex material
+anim bone material 0.500000
+0.500000 anim
+= 1.0 vertex = frame
+anim -1
+texture vertex 0.500000
+-1 material 0.500000 vertex 1.0
+1.0 frame
+= -1
+bone
+0.500000 0.500000 = =
+vertex frame
+frame 0.500000 bone
+-1 0.500000 texture anim texture 0.500000 1.0 0.500000 anim texture
+0.500000 bone 1.0 0.500000 bone texture
+-1
+anim 0.500000 = vertex bone = vertex 0.500000 0.500000 anim
+frame texture bone vertex = material bone
+0.500000 material 0.5
\ No newline at end of file
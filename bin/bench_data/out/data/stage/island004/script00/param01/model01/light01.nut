@@ -0,0 +1,10 @@
+vertex frame bone anim
+-1
+material 0.500000 material material bone vertex = bone texture 1.0 -1 -1 vertex vertex vertex frame
+frame
+0.500000 1.0
+texture 0.500000 1.0 bone 1.0 1.0 0.500000 = 1.0 vertex
+1.0 texture -1 frame frame 0.500000
+anim
+-1
+-1 anim 0.500
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame vertex
+texture
+frame
+= texture 1.0 bone material
+fram
\ No newline at end of file
@@ -0,0 +1,356 @@
+material 0.500000 material 1.0 vertex texture material bone
+0.500000 material anim
+bone
+-1 material 1.0 material 1.0 bone
+material 1.0 bone anim vertex material 0.500000 bone bone 1.0 anim
+anim frame 1.0 = material material vertex frame -1 vertex 1.0 anim
+material texture 0.500000 1.0 -1
+texture = = anim bone vertex texture bone
+1.0 -1 0.500000 = vertex 1.0 -1 vertex frame
+texture -1 0.500000 material texture
+-1 texture texture -1 anim material
+vertex
+anim 0.500000 bone
+frame 0.500000 texture
+= =
+= vertex anim
+material material =
+= 1.0
+frame
+texture -1 = vertex vertex frame -1 frame
+= vertex 1.0 1.0 1.0 frame
+0.500000
+0.500000
+frame material
+bone anim material vertex anim
+0.500000 anim material 0.500000
+0.500000 anim anim material material = -1 vertex
+-1
+material
+= anim -1 bone -1
+= 0.500000 anim
+0.500000 texture =
+bone
+vertex -1 frame bone 1.0 anim texture texture anim vertex 0.500000 0.500000
+frame material
+1.0 = = anim
+-1
+frame vertex = material 1.0 texture
+bone frame bone = = bone -1 texture vertex
+frame
+-1 vertex 1.0 bone
+1.0 material
+material =
+material =
+1.0 = 0.500000 =
+material bone vertex vertex
+-1
+=
+frame bone
+frame
+vertex
+material
+0.500000 frame
+bone = anim
+-1
+0.500000
+= material
+0.500000 0.500000 vertex
+material texture frame
+1.0 1.0 0.500000 material 0.500000 material 1.0 -1 anim frame material = texture 1.0 material 0.500000 material
+0.500000
+= bone -1 texture anim
+texture
+1.0 =
+material
+0.500000
+material vertex frame anim 1.0
+frame = material material bone
+= -1 anim
+material frame 0.500000 material = bone
+-1
+frame
+frame anim
+material frame anim
+frame material 0.500000
+bone -1
+= vertex vertex 0.500000
+material
+= frame
+bone
+anim anim texture 1.0
+frame
+1.0 material texture
+texture texture anim texture texture
+anim texture anim anim texture frame material
+1.0
+-1 material
+= anim 1.0 1.0
+0.500000 1.0 bone 0.500000 = anim
+texture
+-1 material bone
+0.500000 anim
+texture vertex
+material vertex
+bone
+anim material 0.500000 = frame
+anim -1 texture
+material texture
+texture material anim = anim = material material 1.0
+=
+material frame = frame bone vertex
+material
+= vertex = -1 vertex bone frame
+material = anim bone bone vertex texture -1 1.0
+1.0 frame 1.0 bone vertex anim anim vertex bone vertex
+0.500000 frame anim 0.500000 material
+-1 texture frame vertex vertex
+material frame bone vertex 0.500000 bone material material
+= texture
+anim vertex frame frame frame 1.0 1.0 anim 1.0 1.0 anim material material vertex
+-1 -1 frame
+material 0.500000 -1
+0.500000 1.0 texture
+texture = 0.500000 vertex material anim vertex -1 vertex
+bone 0.500000 frame
+1.0 0.500000 = texture material anim
+frame
+-1 1.0 1.0
+-1 bone
+texture texture
+anim bone bone -1 material -1 bone 0.500000 frame bone
+vertex texture anim material vertex = texture texture 1.0
+1.0 texture 0.500000 =
+frame frame texture bone vertex 0.500000 1.0
+material 1.0 texture
+-1 anim material anim 0.500000
+1.0 0.500000 0.500000 vertex
+0.500000
+anim vertex
+frame vertex 0.500000 frame
+vertex =
+vertex
+frame
+material 1.0
+-1 anim
+-1 =
+frame
+= material
+1.0 texture material anim -1 anim 1.0
+anim
+1.0 anim
+texture
+texture vertex
+0.500000 -1
+-1 0.500000
+texture anim bone bone vertex anim 1.0 texture -1
+= frame = frame bone vertex 0.500000 anim
+-1
+material = vertex 1.0
+bone anim bone -1 frame 0.500000
+1.0 bone texture texture 1.0 = texture anim 0.500000
+0.500000 0.500000 texture bone
+0.500000
+1.0 = -1 vertex -1 1.0 frame 1.0 texture anim
+=
+-1 material texture
+material bone 1.0 1.0
+0.500000 anim
+texture material anim texture anim 0.500000 = 0.500000
+vertex anim 1.0 texture frame material
+= material material
+bone
+0.500000 material -1 0.500000 1.0 texture =
+texture
+vertex
+0.500000
+=
+material texture bone texture frame anim bone
+= material bone texture anim -1
+-1 vertex 0.500000
+anim texture anim 0.500000 = 1.0 1.0 texture frame vertex
+anim
+= 1.0
+0.500000
+bone -1 1.0 1.0 texture material anim
+material frame
+vertex
+texture -1 0.500000 anim anim -1 =
+vertex
+0.500000 texture
+1.0 = vertex 1.0
+anim vertex 1.0 0.500000
+material bone bone texture = -1 vertex
+frame anim
+vertex vertex -1 anim vertex vertex anim bone =
+-1 =
+-1 material material
+anim
+anim texture = 1.0 vertex -1 bone frame 1.0 vertex 1.0 material
+= vertex
+texture anim material texture frame -1
+texture 1.0 -1 1.0 bone -1 bone 0.500000 0.500000 =
+= 1.0 frame
+material
+0.500000
+frame -1 vertex bone 0.500000 -1 0.500000 1.0 vertex anim -1
+bone bone
+=
+material -1 texture material anim 1.0
+vertex vertex bone material -1 vertex anim
+= bone frame
+vertex frame
+vertex frame 0.500000 1.0
+texture 1.0 -1 material
+bone
+bone vertex 1.0 1.0 -1 vertex bone = material bone anim anim bone
+= anim
+vertex bone 0.500000 anim frame
+vertex
+0.500000 vertex texture
+0.500000 vertex bone 0.500000 bone
+vertex frame texture
+vertex bone -1 1.0 -1 vertex anim
+material
+1.0 frame bone frame bone
+vertex bone 1.0 -1 0.500000 texture anim
+= anim vertex
+bone frame
+1.0 -1 texture
+anim 0.500000 -1 material
+material bone anim bone frame texture material
+0.500000 anim
+bone anim vertex 1.0
+vertex
+bone material 0.500000 material bone 1.0 1.0 = material
+-1 1.0 = = 1.0 1.0
+texture 1.0 1.0 material
+= anim 1.0 vertex
+0.500000 = anim frame frame 0.500000
+vertex
+-1 1.0 anim texture bone
+material = -1 anim texture bone =
+frame anim -1 bone
+material
+vertex bone
+anim texture material
+bone material 1.0 0.500000
+texture
+= bone
+bone
+material -1
+1.0 bone 1.0
+anim texture
+1.0 material material vertex
+texture material
+0.500000
+texture material 0.500000 texture 0.500000 material = material bone texture anim bone vertex = frame 1.0 bone
+0.500000 1.0 anim = anim 1.0
+-1 material 1.0 frame anim -1 0.500000 texture anim
+bone texture bone 0.500000
+material -1 0.500000 frame vertex bone
+1.0 1.0 texture texture vertex frame frame texture bone vertex bone
+vertex material
+0.500000 = frame anim material anim = 0.500000 frame
+-1 1.0 1.0 frame
+bone bone anim frame 1.0
+1.0 bone
+material = anim texture material material bone 0.500000 material = = 0.500000
+anim frame anim texture anim
+0.500000 material -1
+anim bone bone frame bone bone frame texture texture -1 material vertex
+0.500000 = =
+1.0 material 0.500000 1.0
+frame 1.0 = frame 1.0 = vertex
+0.500000 1.0 =
+frame =
+=
+anim -1 0.500000 texture anim frame bone material 1.0 material bone anim bone texture
+texture
+-1 = vertex 1.0 -1 = anim vertex 0.500000 bone vertex = = texture
+texture bone frame texture anim vertex texture texture -1 anim texture anim bone texture
+1.0 -1 anim vertex = frame vertex
+frame -1 = material
+anim
+material = 1.0 material
+material texture
+frame
+material 1.0 anim 1.0
+bone
+texture 0.500000
+anim = -1 =
+material anim
+anim 0.500000 1.0
+1.0 -1
+frame vertex
+anim material
+frame = -1 = vertex material 0.500000 1.0 anim anim = 0.500000 1.0 bone anim frame
+bone 1.0 = frame texture 1.0 -1 vertex = material bone
+bone texture bone = bone
+1.0 -1
+0.500000 0.500000 bone bone = texture
+1.0 anim texture material
+-1 texture texture material frame
+material bone vertex
+frame 0.500000 1.0 anim vertex texture vertex frame frame frame vertex anim bone frame texture =
+-1 material 0.500000 texture vertex 1.0 frame anim
+bone
+texture texture = texture bone
+anim
+= anim
+= vertex
+vertex vertex
+0.500000 =
+1.0
+anim vertex bone 1.0 = texture vertex =
+1.0 =
+bone
+anim texture texture anim bone vertex -1 -1
+0.500000 1.0
+1.0 anim material 1.0 frame
+= -1 = bone
+1.0
+anim anim vertex frame bone
+1.0 material anim bone texture vertex
+1.0
+vertex
+anim
+material 0.500000 frame
+texture
+0.500000
+-1 vertex frame
+1.0 frame
+anim vertex =
+anim
+anim
+anim frame -1 texture material =
+material 1.0 =
+material
+anim frame
+vertex vertex 1.0 frame
+texture bone 1.0
+0.500000 -1 -1 frame vertex 1.0 anim
+texture -1 material
+0.500000
+1.0 0.500000
+frame bone frame
+frame
+bone material bone
+frame 1.0 1.0 1.0
+= texture texture material bone 0.500000
+= frame 1.0 frame -1 -1 -1
+-1
+1.0 = 0.500000
+1.0 anim =
+1.0 = =
+bone 1.0 frame material material
+material = material frame -1 material 1.0 frame = 0.500000
+0.500000 = = =
+frame
+vertex frame
+anim 0.500000 = texture frame frame material
+vertex -1 anim material material 1.0 1.0
+-1 -1
+anim frame -1 vertex anim
+bone = frame 0.500000 = frame bone
+= b
\ No newline at end of file
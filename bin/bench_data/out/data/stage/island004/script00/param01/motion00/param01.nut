@@ -0,0 +1,3 @@
+-1 bone
+bone anim material frame =
+frame anim = material
\ No newline at end of file
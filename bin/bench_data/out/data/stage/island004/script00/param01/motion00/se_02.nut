@@ -0,0 +1,8 @@
+bone material =
+-1 texture 0.500000 texture bone -1 vertex -1 bone = material 0.500000
+material vertex
+texture vertex anim frame 1.0 = material
+0.500000
+1.0
+material texture material
+1.0 1.0 ma
\ No newline at end of file
@@ -0,0 +1,122 @@
+= bone bone 0.500000 material
+frame frame vertex material bone
+-1 = frame anim texture
+texture
+-1 bone vertex 1.0
+= material vertex texture
+texture anim 0.500000 1.0 frame bone frame vertex material -1 vertex
+0.500000 anim anim 0.500000
+material 0.500000 1.0 1.0 bone
+-1 frame
+bone
+-1 material 0.500000 material = = -1 material material frame material material
+texture texture anim = material
+= 0.500000 material 1.0 =
+frame
+anim bone
+anim 1.0 0.500000 anim vertex
+1.0 texture =
+0.500000 1.0 texture texture = -1 1.0 anim material
+frame
+anim 0.500000 -1 0.500000 = anim material frame 0.500000
+-1 1.0 texture 1.0
+material vertex texture -1 1.0
+1.0
+= anim
+=
+material vertex texture material -1 -1 anim
+-1
+1.0
+=
+=
+frame material
+-1 frame vertex anim frame 0.500000 0.500000 -1 0.500000
+frame
+anim = frame vertex vertex 0.500000 material
+anim
+vertex
+material 0.500000
+vertex vertex bone material frame frame anim
+material =
+1.0
+texture
+vertex vertex = material
+0.500000
+0.500000
+0.500000 bone texture = 0.500000
+frame anim =
+texture bone 0.500000 material anim bone -1 bone vertex frame vertex anim 0.500000 bone 1.0 frame -1
+texture
+bone = material material anim -1 texture bone vertex
+vertex 0.500000
+texture frame
+bone
+frame frame texture
+anim
+vertex texture -1
+anim 1.0 anim =
+anim
+1.0 anim texture 1.0 bone
+anim =
+anim 0.500000 texture anim bone vertex vertex
+-1 bone
+material frame vertex 0.500000 1.0 vertex -1
+vertex material -1 anim frame bone frame
+texture
+1.0
+anim
+texture
+anim texture material material 0.500000 material vertex
+= 0.500000 1.0
+frame
+-1 vertex material texture -1
+0.500000 texture material 0.500000 1.0
+anim frame vertex anim anim vertex bone material vertex
+texture = vertex = material bone =
+material bone frame frame 0.500000 texture 0.500000 -1 vertex frame
+0.500000
+1.0 bone material texture
+1.0 frame material material vertex
+0.500000 bone = vertex
+bone
+material anim
+-1 anim bone
+vertex 1.0 texture vertex material frame = 1.0 = = vertex
+bone
+0.500000 frame -1 -1 0.500000 bone bone
+material -1 -1 anim
+-1 frame frame
+texture texture frame texture frame material texture
+0.500000 frame bone bone 1.0
+0.500000 1.0 anim 0.500000 = vertex
+bone material = material 1.0 = = 0.500000 frame
+1.0
+vertex frame texture frame = material
+0.500000
+= frame -1 bone
+vertex 0.500000 1.0 texture vertex -1 -1 material material anim 1.0 anim
+1.0 frame
+material texture
+texture anim
+material
+= -1
+vertex material
+frame anim frame -1 bone
+-1 1.0 texture 1.0
+= =
+1.0 0.500000 bone bone vertex 1.0 1.0 0.500000
+frame
+vertex
+anim bone vertex
+anim 1.0 vertex texture
+vertex
+texture texture texture bone vertex vertex 0.500000
+=
+texture
+= bone vertex 0.500000 frame texture =
+= vertex texture anim
+1.0 0.500000
+0.500000
+texture =
+-1
+0.500000 texture frame material texture mater
\ No newline at end of file
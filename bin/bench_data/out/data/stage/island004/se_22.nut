@@ -0,0 +1,14 @@
+texture
+1.0 texture texture 0.500000
+0.500000
+-1 = 0.500000 0.500000 0.500000 material 1.0 = frame vertex -1 0.500000 1.0 texture 1.0
+1.0
+frame 0.500000
+bone
+1.0 material frame = 0.500000 1.0
+=
+=
+anim bone
+=
+0.500000 anim
+-1 texture = frame 0.50000
\ No newline at end of file
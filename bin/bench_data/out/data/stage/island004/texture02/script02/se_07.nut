@@ -0,0 +1,146 @@
+vertex
+vertex = =
+-1 -1 anim
+bone 1.0
+texture bone frame 1.0 -1 bone
+1.0 anim 1.0 = frame material -1 vertex material bone
+-1 material
+vertex
+anim anim
+0.500000
+bone 1.0
+= -1 texture bone bone -1 vertex vertex 0.500000 0.500000 vertex texture texture
+vertex material anim frame 1.0 -1
+frame texture frame 0.500000
+= 0.500000
+anim = 1.0 anim 1.0
+-1 0.500000
+-1 vertex = 1.0 = bone frame vertex anim 0.500000
+1.0
+vertex 0.500000
+1.0 1.0
+bone
+frame
+= frame anim anim frame 0.500000 0.500000 0.500000 1.0 anim vertex 0.500000 material texture 0.500000 frame bone 1.0 texture -1
+-1 1.0 bone = 0.500000
+0.500000 bone texture
+-1 bone
+material
+1.0
+1.0 0.500000 vertex = 0.500000 1.0 vertex
+1.0 frame
+frame
+vertex
+vertex material vertex
+anim frame 1.0
+vertex
+vertex vertex -1 1.0 bone 1.0 0.500000 frame -1 =
+bone bone
+frame
+texture texture
+= frame vertex frame anim bone material
+vertex anim vertex material bone texture material bone -1
+0.500000
+texture material 0.500000 frame -1
+material
+frame = texture
+= anim 1.0 1.0 1.0 bone =
+material bone vertex -1 -1 anim -1 material 1.0 frame
+texture material texture
+anim 0.500000 anim anim
+material vertex material
+-1 =
+-1 material texture material vertex material anim
+material frame
+0.500000 = vertex -1
+frame
+anim texture 0.500000
+texture
+-1 anim -1 vertex = anim
+vertex 0.500000 anim
+bone 0.500000 1.0 0.500000 anim = -1 bone 0.500000
+frame 0.500000 0.500000
+bone 1.0 texture anim
+bone 0.500000 bone 1.0 =
+= frame = bone texture
+bone material 1.0 frame
+= anim 1.0 vertex -1
+1.0 1.0 frame anim vertex
+vertex frame
+frame =
+anim 1.0 0.500000 =
+1.0 bone
+vertex texture -1 vertex texture texture bone texture bone frame vertex anim vertex -1 vertex
+= material anim frame 1.0 0.500000 = material frame 0.500000
+vertex
+bone anim
+anim bone
+material
+=
+texture anim -1 0.500000 0.500000 material =
+material -1 anim
+vertex
+-1 1.0
+anim
+= vertex 1.0 frame =
+=
+material
+vertex anim 1.0 texture 1.0 bone 1.0 =
+1.0 texture vertex 0.500000 1.0 vertex
+texture 0.500000 material frame bone anim
+texture frame
+-1 1.0 -1 material bone
+bone
+-1 texture
+anim
+= anim -1 1.0 texture -1
+= vertex texture
+0.500000
+texture vertex anim anim
+material =
+texture
+1.0 frame vertex vertex 1.0
+frame
+1.0 texture texture 0.500000 texture =
+= 1.0 1.0 0.500000 frame
+frame -1 bone material texture = 1.0
+texture 1.0 anim
+-1 texture anim
+= material anim 0.500000 material bone texture 0.500000
+frame texture bone texture anim
+1.0 anim
+vertex
+frame material texture -1 1.0 material = bone
+-1 = anim bone texture
+-1 frame
+1.0 bone
+= 0.500000
+= frame
+anim
+anim vertex
+material
+0.500000 vertex
+bone vertex frame texture
+-1 frame -1 texture material vertex vertex = material bone
+= 0.500000
+texture material frame 1.0 0.500000 0.500000 0.500000 vertex frame bone frame =
+bone texture anim = -1 frame 0.500000 material bone
+= frame
+vertex
+1.0 1.0 = 0.500000 vertex 0.500000 1.0 0.500000
+anim
+-1 1.0 = = 0.500000 texture -1 material 1.0 1.0 0.500000 1.0 texture 1.0 material material -1
+0.500000
+material = material -1 texture 1.0 0.500000 0.500000 = -1
+texture 0.500000
+vertex frame bone
+1.0 bone
+-1
+material anim 1.0
+texture = material
+anim
+anim texture = anim
+0.500000 material vertex 1.0 frame
+0.500000 bone anim vertex bone anim 1.0 anim = anim -1 frame 0.500000 = vertex bone = frame
+frame frame = frame 1.0
+bo
\ No newline at end of file
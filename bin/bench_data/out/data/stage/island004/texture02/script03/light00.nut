@@ -0,0 +1,36 @@
+bone
+vertex frame
+frame anim bone texture -1 1.0 0.500000 bone bone vertex material anim anim texture anim
+anim
+= frame 1.0
+1.0 anim
+vertex anim
+material texture
+frame 0.500000
+material vertex 0.500000 = material -1 =
+bone frame = texture
+material frame bone = 1.0 texture frame 1.0 -1 frame bone
+1.0
+anim frame
+texture
+frame bone material 0.500000 bone 1.0 texture frame = anim -1
+anim =
+= vertex
+material =
+vertex = -1
+texture 0.500000
+0.500000 1.0 anim -1
+0.500000 1.0 -1 1.0 -1 texture frame texture =
+material 1.0 bone vertex frame
+anim frame vertex = frame vertex
+frame bone
+=
+-1 frame 0.500000 vertex 0.500000
+-1 material
+bone anim = vertex
+frame anim 1.0 texture 0.500000 vertex 1.0
+=
+texture = anim 0.500000 vertex -1 texture -1 anim
+frame anim texture bone texture -1 1.0 0.500000 vertex anim
+vertex vertex
+ve
\ No newline at end of file
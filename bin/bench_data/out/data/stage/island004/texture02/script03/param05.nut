@@ -0,0 +1,8 @@
+= frame -1
+texture frame 0.500000 frame bone
+vertex -1
+anim texture 0.500000 material = = 0.500000 -1 vertex 1.0
+1.0 0.500000 = bone material texture 1.0 anim -1 -1
+vertex anim =
+bone -1 -1 = vertex = bone frame
+-1 0.500000 frame texture texture material vertex bone material
\ No newline at end of file
@@ -0,0 +1,8 @@
+frame 0.500000 anim anim anim frame -1 = texture anim
+0.500000 = vertex texture bone = -1 0.500000 -1 -1
+= -1
+bone
+0.500000 = bone frame texture -1
+1.0
+bone 1.0 anim anim frame anim 1.0
+bone
\ No newline at end of file
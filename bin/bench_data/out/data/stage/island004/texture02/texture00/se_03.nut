@@ -0,0 +1,320 @@
+texture -1 0.500000 0.500000
+= frame frame 1.0
+frame -1 texture texture texture
+material 0.500000 0.500000 anim
+=
+0.500000 1.0 -1 -1 -1 anim texture
+frame anim
+=
+-1 bone texture
+texture bone material
+material
+-1 -1
+bone = anim = anim material =
+frame
+-1 -1 -1 = material
+0.500000 -1
+-1 texture material -1
+1.0 material anim texture vertex material texture texture frame bone vertex texture
+-1 = 1.0
+texture 1.0 vertex frame
+anim
+bone
+1.0
+material
+frame vertex = -1 0.500000 -1 vertex = 1.0 0.500000 anim vertex texture 0.500000 vertex texture
+= =
+bone bone bone
+bone = frame 0.500000 material texture vertex
+vertex anim anim -1 material -1
+-1
+frame 1.0 0.500000 -1 vertex anim -1
+frame = material 0.500000
+frame vertex 1.0 bone 1.0 -1
+-1 1.0 vertex =
+vertex -1
+-1
+frame bone frame 0.500000 texture bone
+anim
+=
+bone vertex anim = -1 1.0 1.0 -1 = bone texture 1.0 anim vertex 1.0
+bone vertex
+material 1.0 0.500000
+= 1.0
+1.0 0.500000 -1 0.500000 frame texture vertex material 1.0 material =
+vertex = material
+vertex texture bone
+-1 -1 vertex bone vertex -1 1.0 1.0 bone anim
+material material vertex -1 texture =
+1.0 anim frame
+frame = material
+-1 material material =
+1.0 anim
+-1 bone = 1.0
+bone bone frame
+= =
+0.500000
+anim material -1 material material
+material anim =
+frame frame
+frame
+material frame bone = texture
+frame vertex texture texture 1.0 frame texture
+= -1 frame -1
+vertex -1 vertex
+vertex
+bone = bone frame 0.500000 1.0 vertex vertex
+-1 1.0 0.500000 anim
+1.0 1.0 -1
+material material
+anim 0.500000 vertex texture -1 1.0
+frame bone
+0.500000 -1
+= frame bone frame 0.500000 material bone anim bone = bone frame vertex material =
+1.0
+1.0 frame -1 anim bone
+=
+vertex
+bone bone texture material
+vertex vertex
+anim frame anim 0.500000 bone bone 0.500000
+1.0 = material 0.500000 -1 -1
+-1 = material anim bone vertex vertex frame
+-1 0.500000
+anim vertex
+bone frame 0.500000 bone anim
+vertex 0.500000
+frame material 1.0 bone
+vertex texture texture = -1 material material 0.500000 texture anim
+1.0 1.0
+0.500000 bone
+bone
+texture frame vertex
+1.0 texture 0.500000
+= material = vertex -1 1.0
+material -1 vertex material
+0.500000 texture 1.0
+frame -1 1.0
+texture vertex 1.0 texture bone vertex
+vertex material bone texture frame frame
+= 0.500000 0.500000 -1 frame material texture = -1 anim bone
+anim frame frame
+-1 bone 0.500000 texture
+anim -1 anim material
+0.500000 material 1.0 1.0
+anim frame
+texture -1
+material
+frame bone 0.500000 -1
+frame bone
+anim -1 bone 1.0 anim texture material bone
+vertex vertex material = 1.0 -1 bone
+= bone bone material 0.500000 frame material 0.500000 1.0 anim -1 frame frame
+-1 vertex 1.0
+-1
+bone 1.0 texture 1.0 -1
+vertex 1.0 material frame material = 1.0 = bone material 1.0 bone 1.0 texture 0.500000 vertex
+0.500000 bone 0.500000 1.0 texture bone frame 1.0 0.500000 0.500000
+bone -1 material bone anim frame -1
+-1
+anim = anim texture material vertex bone frame 1.0 bone 0.500000 material texture 0.500000 frame -1 material -1
+anim vertex anim
+bone anim vertex
+1.0 frame anim -1 0.500000 bone
+0.500000 frame
+bone material texture
+bone frame
+vertex vertex
+= = material
+0.500000 frame bone
+frame 0.500000 frame 0.500000 vertex 1.0 1.0 1.0
+anim
+material
+bone
+texture
+vertex texture
+= 0.500000 =
+vertex
+frame
+bone texture 1.0 -1 0.500000 material 1.0 0.500000 anim
+bone 0.500000 0.500000 texture material
+bone
+0.500000 bone material -1
+material vertex 0.500000 texture material 1.0 vertex
+vertex anim
+= 0.500000 anim
+= -1
+1.0 anim
+anim
+material vertex anim bone
+bone
+= material
+anim bone 1.0 anim -1
+material
+anim frame 1.0 bone bone = texture bone texture anim material 0.500000
+texture bone
+0.500000 frame
+anim -1 1.0 1.0 -1
+=
+= bone
+anim
+1.0 texture texture material material
+anim 1.0 = material -1 bone frame 0.500000 vertex vertex 0.500000 vertex material
+1.0 bone 1.0 anim
+anim
+bone = bone bone
+vertex
+=
+material -1 -1 texture
+frame material
+0.500000
+frame vertex -1 texture
+-1 anim frame frame 1.0 vertex vertex = -1 frame = 0.500000 1.0
+anim -1
+1.0 =
+material texture
+vertex vertex texture
+anim anim texture texture = material 1.0 material texture 0.500000 texture -1 vertex -1 material 0.500000 bone frame vertex texture material = bone 1.0 1.0
+= = frame bone vertex
+vertex frame
+-1 anim
+1.0 vertex bone 1.0 material vertex
+bone
+0.500000 = texture -1 -1
+= frame
+-1 0.500000 bone 1.0 vertex -1 0.500000 0.500000 bone
+frame bone 1.0
+bone
+bone -1 frame
+frame 1.0 vertex frame frame 1.0
+-1 -1 anim texture
+vertex bone -1
+bone bone 1.0 texture bone material 1.0 material = material =
+0.500000 1.0
+= frame -1 vertex
+0.500000 bone =
+texture vertex 1.0
+material frame anim 1.0 = texture bone
+0.500000 frame bone 0.500000 vertex = frame 0.500000 -1
+= 0.500000
+bone anim
+texture anim vertex 1.0 frame frame texture vertex -1
+bone vertex 1.0 anim -1 material -1 vertex frame 0.500000 texture bone frame texture frame -1 anim frame
+texture = frame
+0.500000 1.0 bone vertex frame
+vertex 1.0
+vertex vertex
+frame -1 1.0 material material 0.500000 texture
+0.500000 = =
+-1 texture 0.500000 frame 0.500000
+vertex vertex -1
+vertex
+frame
+1.0 texture anim -1 frame
+bone 0.500000 anim frame
+anim vertex
+frame material
+-1 -1 frame
+0.500000 1.0
+-1 texture -1 bone anim texture
+texture material anim
+1.0 = -1
+texture
+vertex
+material -1 vertex frame
+texture
+vertex -1 texture bone
+= texture bone 0.500000 = frame anim 0.500000 -1 vertex material 1.0 frame 0.500000 = texture texture frame 1.0
+vertex 1.0 texture 1.0 texture texture frame
+material vertex
+frame bone -1
+= 0.500000 -1 1.0 bone -1
+texture anim vertex material = vertex = anim -1 anim = bone
+1.0 anim
+texture 1.0 frame bone
+anim
+0.500000 vertex anim texture bone bone 0.500000
+material =
+= vertex
+1.0
+anim anim bone = 0.500000 = anim bone
+vertex
+material 1.0 texture anim frame vertex
+0.500000 material 0.500000 1.0 anim 0.500000
+0.500000 material material frame
+texture frame material material material
+bone
+bone = -1 anim vertex
+texture
+vertex
+bone 1.0
+anim 1.0 0.500000 = material bone material 1.0 texture texture vertex texture anim anim material 0.500000 = 1.0
+texture vertex
+= frame anim vertex
+anim bone 0.500000 0.500000 frame texture
+vertex anim vertex anim 0.500000
+0.500000 = = anim
+texture material frame bone vertex vertex frame anim texture
+0.500000 frame = -1 = -1
+frame bone anim vertex frame
+0.500000
+material vertex material vertex -1 texture
+-1 material
+frame material frame
+-1 vertex 1.0 0.500000 material anim
+vertex
+frame
+material 1.0 = = 1.0 texture texture -1 frame 1.0 material material
+frame texture -1
+material anim texture = 0.500000 1.0 frame -1 vertex texture bone 1.0 0.500000
+texture
+material bone 1.0 1.0 anim = bone
+frame bone 0.500000 material bone bone = bone
+frame anim anim = anim 1.0 texture
+texture -1 frame bone frame texture anim bone material frame
+0.500000 1.0 0.500000 bone 1.0 = frame 1.0 0.500000 material 1.0 = material texture
+1.0
+material 0.500000 material
+0.500000 = 1.0 1.0
+frame texture 0.500000 1.0
+0.500000
+texture
+anim
+texture 0.500000 1.0 texture
+0.500000
+frame
+texture
+texture 0.500000 1.0 1.0 frame anim -1
+vertex frame vertex texture -1 -1 bone frame
+material 0.500000 vertex -1 =
+texture
+anim 0.500000 frame
+anim = 1.0
+= -1 frame 0.500000 vertex material 1.0 anim anim = frame bone
+-1 -1 frame 0.500000 material
+=
+anim bone vertex texture 1.0 material
+vertex bone material
+bone material =
+anim bone texture
+-1 -1 vertex 0.500000
+-1 texture bone material
+frame
+frame
+bone 1.0 material bone 0.500000 -1 frame
+texture 1.0 frame =
+frame 0.500000 texture 0.500000
+anim = bone =
+-1 anim texture
+vertex
+-1 1.0 vertex texture 0.500000 anim
+0.500000 texture vertex -1 bone
+1.0 0.500000 bone =
+frame bone vertex 0.500000 vertex bone
+texture
+vertex -1
+0.500000 1.0 anim anim
+-1
+0.500000 material
+frame anim
+1.0 bone 
\ No newline at end of file
@@ -0,0 +1,6 @@
+-1 frame 1.0 material
+vertex
+texture = bone texture texture frame anim anim anim material
+1.0
+0.500000
+material bone 
\ No newline at end of file
@@ -0,0 +1,24 @@
+0.500000 frame anim texture texture texture
+1.0 vertex = =
+texture material 0.500000 anim =
+material
+frame material material 0.500000 -1
+1.0 anim vertex
+texture
+vertex anim bone
+frame
+= 0.500000 = vertex
+=
+frame frame -1 0.500000
+frame
+bone
+-1 = 0.500000 = bone 0.500000
+-1 bone
+vertex anim =
+anim
+1.0 material material material 1.0 frame 1.0 anim material frame 1.0 -1 anim = -1
+vertex
+-1 0.500000 bone -1 material 1.0 1.0 bone
+frame
+anim anim bone texture 1.0 =
+bone ma
\ No newline at end of file
@@ -0,0 +1,15 @@
+texture anim 1.0 frame -1 frame vertex frame anim
+0.500000 texture
+bone
+0.500000 anim =
+= 0.500000 frame vertex frame
+anim
+vertex 1.0
+=
+texture anim texture vertex anim vertex texture
+texture -1 -1 bone
+frame 1.0
+0.500000 bone frame anim = vertex -1 = vertex frame
+material frame 0.500000 -1 = 1.0 anim material
+-1 bone
+anim bon
\ No newline at end of file
@@ -0,0 +1,3 @@
+anim bone = material
+0.500000 vertex
+ve
\ No newline at end of file
@@ -0,0 +1,19 @@
+texture material 1.0 = material material 0.500000
+material material frame material frame
+= material vertex texture 1.0 frame frame 1.0 vertex frame anim 0.500000 0.500000 texture
+bone anim = -1 0.500000 1.0 0.500000 frame 1.0 1.0 texture
+material vertex
+vertex -1 = vertex frame texture 0.500000 1.0
+anim bone = bone material vertex
+frame -1 1.0 bone bone anim texture
+anim =
+= texture anim texture bone texture vertex anim
+bone material = material
+frame texture texture
+-1 texture frame = anim 0.500000 0.500000 material
+0.500000 material bone
+= 0.500000 vertex
+0.500000 -1
+texture bone frame texture 0.500000 anim material -1 0.500000 =
+=
+1.0 anim 0.500000 anim material vertex 0.500000 anim -1 -1 vertex = 1.0 -1 bone = ani
\ No newline at end of file
@@ -0,0 +1,6 @@
+AQ2½}OkkkSasTHX;ɡ<u	kX݁5ZMq#'^@ь$y#>"c.0tsE1lJϊ=ByǬ3ު]@ZWn6gI"<|%jmsZV;QAT#qnLpKS1U$f7ʸO_<*#c$mUְ+??֠mM)
+ӎaJs+"d4pTGYVR3$*K;(NV";]Ki[sо@$q(ܭffiɌ^=k
+
+
+\-9^ihIwI*KLS8%VzNO!noWƏafJ梴a
+7\zdݗͥQz54kv\BM(0</^HB*IDoٸPvm:oXcp_+dߠ|ڮPn2D1%n{F4vh"3`.άى9e@_	N}]kȟ?cBMZJ<Tu:E;`z9}q$̞GG,xS.qu@6/#	VdƀCuc2$k7HPg4}r_߼y[Fjp}~nNEde<6܏Io/Hϑ$ݍct	^OXC:|k0!/q\T+Fm5Nt
\ No newline at end of file
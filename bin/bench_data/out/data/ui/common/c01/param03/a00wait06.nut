@@ -0,0 +1,7 @@
+1.0
+1.0 =
+texture = 1.0
+bone -1
+bone material frame texture
+=
+1.0 an
\ No newline at end of file
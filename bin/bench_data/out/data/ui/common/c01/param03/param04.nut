@@ -0,0 +1,88 @@
+0.500000
+=
+bone 0.500000
+1.0
+0.500000 anim 1.0 =
+material bone bone = 1.0 material frame bone anim material
+bone 1.0 anim = material material
+1.0 vertex -1 material anim vertex =
+bone material frame anim 1.0 frame
+1.0 0.500000
+-1
+0.500000 -1
+1.0 = bone
+1.0 material
+vertex vertex texture frame
+vertex
+1.0 bone
+anim
+vertex anim texture = texture texture
+= = anim -1
+0.500000
+= anim
+frame vertex texture 0.500000
+bone
+1.0 bone
+bone vertex
+anim = vertex texture 0.500000 1.0 -1 frame = anim
+0.500000 -1
+texture -1 texture
+-1 bone bone
+anim frame vertex frame
+-1 material
+0.500000 vertex
+material
+-1 texture
+vertex 1.0 vertex
+frame
+0.500000 0.500000 anim material frame material 1.0
+1.0 bone -1 1.0 material -1
+material
+bone 0.500000 -1 texture material -1 material
+anim vertex 1.0 0.500000 = frame frame =
+texture 1.0 -1 -1 material texture anim anim frame frame texture -1 -1 bone frame
+-1 frame
+=
+1.0 material 1.0 anim vertex
+vertex frame = vertex 0.500000
+= -1 0.500000 bone 1.0 texture -1 frame
+frame
+= 0.500000 0.500000 bone texture bone frame
+texture
+= = texture 1.0 bone
+1.0 -1 -1 material 0.500000 vertex
+anim 0.500000 vertex texture anim texture material
+-1 bone 0.500000
+0.500000 = vertex material material
+0.500000 material material -1 = frame frame -1 frame bone material texture anim -1 = vertex
+material material frame
+anim -1 bone = anim
+0.500000 frame
+vertex anim -1 bone
+0.500000 vertex frame 0.500000 anim material
+vertex
+1.0 texture 1.0 = vertex 0.500000 -1 vertex frame -1 -1
+vertex
+= 1.0 = texture 0.500000
+=
+anim
+material bone material
+0.500000
+vertex frame anim vertex = anim 1.0 1.0 vertex
+anim = 0.500000 texture 1.0 bone 0.500000
+= vertex frame 1.0 material
+-1 anim material -1 0.500000 -1 1.0 texture 0.500000 0.500000 -1
+= material
+bone frame
+frame bone material -1 frame frame bone bone bone texture =
+= bone material
+bone
+-1
+0.500000 frame vertex -1
+= bone 0.500000 0.500000 = bone anim
+material 0.500000 material texture texture material 0.500000
+bone -1
+vertex bone =
+= vertex =
+bone 0.500000 0.500000
+0.500000 vertex text
\ No newline at end of file
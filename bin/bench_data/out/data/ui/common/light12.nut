@@ -0,0 +1,7 @@
+material
+texture frame frame anim
+material texture 1.0 1.0
+1.0 texture
+frame
+0.500000 anim
+vertex vertex material = 1.0 bone material bone
\ No newline at end of file
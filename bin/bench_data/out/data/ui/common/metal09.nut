@@ -0,0 +1,178 @@
+texture material -1
+texture texture =
+texture 0.500000
+vertex
+0.500000 -1
+anim
+1.0 -1
+anim 0.500000
+bone
+texture vertex texture 0.500000 bone texture 1.0 1.0 texture texture vertex frame
+= -1
+bone
+1.0 1.0
+anim =
+1.0 anim frame = vertex vertex
+frame frame vertex
+-1 anim 1.0
+anim anim
+texture frame 1.0 frame bone 1.0
+1.0 bone
+bone 1.0 anim frame
+-1 vertex
+1.0
+-1 frame texture vertex bone
+1.0 texture bone = anim = 1.0 texture -1 1.0 frame = anim
+vertex 1.0 anim -1 1.0 0.500000 texture 1.0 = frame = =
+-1 texture
+texture frame 0.500000 -1 texture
+texture bone
+=
+texture texture
+= frame frame bone frame texture vertex bone 1.0 texture material 0.500000 anim 0.500000 vertex frame texture
+frame texture 1.0 bone
+0.500000
+frame anim texture = material
+frame 0.500000
+frame
+material -1 material texture
+frame 0.500000
+frame frame
+frame anim texture 1.0 -1 vertex = 1.0 frame 1.0
+material
+material
+material
+= texture texture material 1.0
+bone 1.0 anim vertex 1.0 frame texture
+0.500000 material
+0.500000 material bone frame bone
+vertex material anim material anim 1.0 texture anim bone
+texture 1.0 = texture
+bone -1 anim =
+1.0 material vertex
+bone
+texture frame 1.0 anim anim
+vertex -1 1.0 bone -1
+= bone 0.500000 bone -1 vertex anim vertex
+texture
+texture 1.0
+bone = 1.0 0.500000
+frame 1.0 anim
+frame vertex vertex material anim vertex
+bone 0.500000 1.0 anim
+material material bone frame 1.0 = -1 bone -1 = bone
+texture =
+1.0
+0.500000 1.0
+-1 = bone = 1.0 frame anim material texture -1 -1
+anim = material
+= material 0.500000 -1 0.500000 bone texture
+-1 = = material
+1.0
+bone anim
+vertex -1 texture
+=
+-1 0.500000
+texture
+= bone vertex anim frame frame vertex
+1.0
+frame
+anim
+0.500000 frame vertex -1
+-1 frame texture anim
+texture 0.500000 material -1 = anim vertex = frame =
+bone
+frame
+0.500000 anim = frame
+= 1.0 -1
+-1
+0.500000
+1.0 bone = material 1.0 anim material frame texture frame texture vertex bone material = texture texture texture 1.0 vertex = -1
+vertex
+texture 0.500000
+0.500000
+texture vertex
+anim bone anim = -1 0.500000 texture
+vertex
+frame material material vertex = 0.500000 anim = = =
+1.0 vertex 1.0
+anim
+frame 1.0
+vertex
+1.0
+1.0 bone = = -1 material bone bone 1.0
+vertex
+bone texture texture = bone -1 vertex 1.0 -1 bone vertex frame
+texture texture vertex frame bone -1 1.0
+= anim 1.0 0.500000 0.500000
+1.0 -1 frame
+material material anim
+material
+1.0
+=
+frame anim frame
+frame texture frame -1 = bone bone 1.0 1.0 anim bone vertex
+vertex
+vertex 0.500000 bone
+1.0 = texture
+bone 1.0
+anim texture anim bone 1.0 frame bone
+bone -1 bone
+material
+1.0 -1 1.0 -1 1.0
+anim
+material bone 1.0 material 1.0
+frame frame texture texture
+anim
+frame texture frame 1.0
+1.0 anim -1
+material 1.0 bone vertex texture 1.0
+anim bone texture frame bone
+=
+frame
+vertex
+-1 texture bone -1 frame
+-1 texture -1 1.0 frame material frame
+0.500000 vertex 0.500000 vertex texture material bone
+vertex
+0.500000 -1 frame bone
+anim bone frame = vertex material
+1.0 1.0
+anim vertex = bone 0.500000
+0.500000 frame
+1.0 material
+material 0.500000 material 0.500000 anim anim 0.500000 0.500000
+material
+material 0.500000
+bone texture 0.500000 bone anim material 0.500000 texture
+-1 vertex
+texture vertex texture
+material vertex
+material frame
+= -1 1.0 frame vertex -1 -1 material vertex 0.500000 1.0
+-1 bone bone bone texture 1.0 texture anim frame frame vertex 1.0 = texture -1
+1.0 -1 -1 0.500000 vertex bone texture frame frame bone
+anim -1 material =
+bone
+frame
+= -1
+-1
+material bone = material 0.500000 texture anim = vertex
+vertex vertex 1.0 texture frame material texture texture texture
+1.0 bone anim
+0.500000 1.0 0.500000 vertex texture
+1.0 bone material 1.0 -1 vertex -1 0.500000 1.0
+=
+= 1.0 material
+1.0
+-1 texture material 1.0 -1
+vertex
+=
+material =
+vertex =
+texture anim -1 vertex
+-1 0.500000 vertex
+vertex -1 = 1.0 vertex 1.0 -1 frame
+material
+1.0
+material -1
\ No newline at end of file
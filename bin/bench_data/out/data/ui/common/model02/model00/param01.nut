@@ -0,0 +1,270 @@
+anim
+vertex -1 -1
+material anim 0.500000 -1
+= = 0.500000 0.500000 = vertex bone -1 vertex bone frame material vertex vertex
+material -1 bone bone -1 material texture
+anim 0.500000 = bone vertex
+= vertex 0.500000 bone material anim -1 0.500000 = texture vertex anim anim material texture frame frame texture frame
+frame material
+material anim 1.0 1.0
+texture
+0.500000
+vertex frame
+0.500000 bone frame
+frame material 0.500000 frame frame
+texture 1.0
+texture
+1.0 bone 0.500000 bone 0.500000 vertex material material
+anim
+bone 0.500000 material -1 texture -1 texture texture bone
+frame -1 frame
+1.0
+frame 1.0
+texture -1
+bone material
+1.0 1.0
+bone 1.0
+-1 -1 frame = bone bone = anim bone
+material 1.0 = frame bone texture material -1
+material material =
+texture bone 0.500000 material
+material 0.500000 anim material -1
+frame anim bone bone vertex frame 0.500000 = anim material =
+-1 -1 texture vertex frame frame = frame vertex frame 0.500000 -1 -1 =
+-1 0.500000 frame 1.0 anim frame
+texture -1
+bone
+= = 0.500000
+vertex texture
+material 0.500000
+0.500000 texture = vertex
+0.500000
+bone
+texture bone anim = =
+1.0
+material vertex
+0.500000 texture =
+-1 -1 -1 anim 1.0 0.500000 vertex frame frame
+-1
+= frame texture texture anim 1.0 texture
+bone anim
+= frame frame anim bone anim
+material 0.500000 1.0 1.0 material
+1.0 =
+= = 1.0 0.500000 vertex anim
+bone 0.500000 vertex 0.500000 1.0 0.500000 material 1.0 texture
+0.500000 anim 0.500000 0.500000 anim frame frame -1
+anim = anim
+vertex
+1.0 frame
+frame
+= =
+anim
+= frame anim vertex -1 0.500000 -1 anim
+material 1.0 vertex texture
+1.0 -1
+-1 0.500000
+vertex material -1 1.0 0.500000 -1 0.500000 anim 1.0 material
+vertex
+0.500000 = vertex
+texture frame 1.0 anim 0.500000
+bone = bone anim bone material -1 0.500000 frame
+-1
+=
+0.500000 = bone -1 material texture vertex = 0.500000 -1
+bone vertex frame bone -1 material = -1 -1 vertex
+bone
+1.0
+-1 bone 0.500000
+texture
+1.0 material vertex
+anim anim 0.500000 material -1 vertex =
+texture
+anim
+material 1.0 anim
+frame anim 0.500000
+anim 0.500000 anim material 0.500000 texture
+frame texture =
+vertex = = anim anim
+frame
+bone material vertex bone
+frame
+-1 vertex anim material
+0.500000 1.0
+0.500000 =
+bone texture
+bone texture -1 texture frame vertex -1 0.500000 vertex frame anim texture -1
+texture texture 0.500000 texture 1.0 anim anim frame -1
+material frame
+frame 0.500000 -1 anim
+=
+material -1
+vertex
+1.0 bone anim material bone anim texture = material
+1.0 bone 1.0 material 0.500000 texture
+anim
+-1
+frame material
+anim 0.500000 bone anim = 1.0
+= =
+1.0
+=
+material vertex anim -1 anim vertex bone material anim anim material 1.0 frame 1.0 bone anim frame anim bone anim frame = 1.0
+-1 frame
+vertex
+anim
+frame 1.0 =
+0.500000
+bone 0.500000 texture -1 1.0 = =
+vertex -1 anim
+texture material
+frame texture
+vertex 1.0 anim anim bone
+1.0
+frame frame material anim
+bone texture
+texture vertex
+0.500000 1.0 material anim = frame material -1 frame bone
+vertex vertex -1 vertex -1 0.500000 texture = bone bone -1
+= -1 0.500000
+material
+texture
+0.500000 frame bone 0.500000 -1
+-1 anim 0.500000 =
+1.0 bone 1.0 texture
+-1
+texture
+0.500000 vertex = 0.500000 1.0
+0.500000 -1
+-1
+frame texture -1
+1.0 vertex anim
+0.500000 frame
+0.500000
+1.0 0.500000 0.500000 texture texture material 0.500000
+bone -1 anim texture = bone material
+vertex =
+anim
+texture = -1 vertex 1.0 bone
+anim texture -1 1.0 vertex vertex texture 1.0
+frame =
+vertex anim
+frame 0.500000 0.500000
+frame
+1.0 anim
+vertex 0.500000
+vertex material material texture
+= 1.0 anim
+vertex -1
+1.0
+texture texture bone material -1 = texture 1.0 1.0 0.500000 vertex texture -1 vertex
+material anim -1 = anim
+= 1.0
+anim
+0.500000 material frame material 0.500000 texture
+anim texture 0.500000 texture
+0.500000
+bone
+1.0 material bone
+=
+bone
+bone
+-1
+material = 0.500000
+= 0.500000
+anim
+1.0 frame anim vertex
+= anim texture
+1.0 vertex
+frame frame frame
+bone -1
+texture
+bone 0.500000
+-1 1.0
+vertex 0.500000
+texture frame frame
+material -1 anim anim material anim
+vertex anim
+anim -1 1.0 material 1.0 bone material 0.500000 0.500000 texture anim 1.0 material vertex texture 1.0 -1 bone
+anim 1.0 = bone
+texture -1
+0.500000 = 0.500000 1.0 anim 1.0 vertex
+anim 1.0 -1
+anim 0.500000 -1 frame = 1.0 vertex anim
+material material
+anim
+bone vertex = bone
+vertex -1
+vertex -1 -1 = vertex
+frame
+bone texture
+1.0
+texture =
+-1 material frame anim anim = = texture texture 0.500000
+frame
+1.0 0.500000 =
+vertex frame material bone 1.0 frame 0.500000 =
+anim texture
+-1 material anim = -1 = frame frame
+-1 0.500000 0.500000 frame vertex bone texture 1.0 0.500000 vertex
+texture 0.500000 vertex material frame texture anim vertex anim vertex -1 frame material 1.0 1.0
+0.500000 vertex bone -1
+= frame vertex vertex
+vertex vertex material 1.0 vertex bone vertex
+texture material anim
+frame
+material bone -1 0.500000 texture =
+frame 0.500000 vertex -1
+-1
+-1 anim 0.500000 material
+frame
+1.0
+texture texture texture texture frame vertex 1.0
+bone
+0.500000
+frame 0.500000 vertex frame material -1
+texture 0.500000 material vertex frame anim vertex
+anim vertex
+bone 1.0 anim vertex texture bone bone material vertex frame bone -1 = bone material frame
+texture bone anim
+anim
+1.0 0.500000 = -1 material
+material
+0.500000 0.500000 texture 1.0
+0.500000
+material vertex texture 1.0 material 0.500000 = bone = vertex bone bone
+frame
+-1 anim anim 0.500000 bone
+-1 bone anim
+texture = bone anim bone vertex texture frame
+vertex = material
+vertex 1.0 1.0 vertex
+material material anim bone
+= =
+bone frame bone anim texture material anim
+bone bone frame -1
+1.0 texture = -1 1.0 frame
+vertex vertex frame texture
+material
+anim bone 1.0 texture
+anim 1.0
+texture 1.0
+1.0 texture texture vertex 1.0 frame bone =
+texture 0.500000 -1
+texture
+=
+frame vertex 1.0
+texture anim vertex =
+= material anim anim material frame = vertex
+material frame bone anim
+bone anim = =
+material
+1.0 material
+vertex 1.0 -1
+vertex
+-1 texture
+0.500000 frame
+anim 0.500000 texture frame material
+1.0 frame -1
+-1
+0.500000 vert
\ No newline at end of file
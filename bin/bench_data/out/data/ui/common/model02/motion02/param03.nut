@@ -0,0 +1,74 @@
+1.0 = anim 0.500000 vertex 1.0
+= -1 vertex
+0.500000 texture frame anim material 1.0
+material
+vertex 1.0 1.0 vertex vertex frame
+= texture vertex vertex -1 bone frame
+texture
+bone bone 1.0
+=
+0.500000
+-1 material
+bone -1
+vertex
+texture
+frame -1 anim material = anim 0.500000
+-1 material
+frame
+0.500000
+-1 vertex anim 1.0 anim bone
+texture material anim frame frame -1
+1.0 texture
+bone vertex
+= anim material
+material 1.0 texture vertex 1.0 1.0 bone = texture
+frame
+0.500000
+frame 1.0
+texture 1.0 texture 0.500000 frame
+-1 1.0
+= 0.500000 frame 0.500000 0.500000
+bone texture frame frame
+bone material frame vertex material material 1.0 texture 1.0 vertex bone bone
+=
+vertex
+anim bone
+-1 material 0.500000 vertex =
+bone bone material anim material bone = = material
+1.0 material 0.500000 anim
+0.500000 material -1 frame -1 bone anim
+=
+frame
+bone 1.0 -1 texture 0.500000
+bone -1 vertex bone anim
+anim bone
+vertex 1.0 = material bone
+vertex
+texture texture =
+bone 0.500000 bone texture
+=
+bone frame anim anim material = frame
+frame anim texture bone
+texture material material
+bone material bone vertex material =
+material 0.500000 material 1.0 anim vertex 0.500000
+anim material bone material material texture texture 0.500000 1.0 anim 1.0
+0.500000
+material 0.500000
+anim 1.0
+0.500000 0.500000
+0.500000 = anim 1.0 1.0 bone anim
+frame
+1.0 frame material bone 1.0
+bone anim
+0.500000
+texture 0.500000
+0.500000 1.0 vertex frame texture material
+texture
+0.500000 anim vertex vertex
+= =
+texture 0.500000
+0.500000 -1 material texture 0.500000
+0.500000
+-1 vertex
+-1 texture -1 frame -1 anim material texture texture anim texture an
\ No newline at end of file
@@ -0,0 +1,15 @@
+-1 =
+frame -1 0.500000 bone -1 = =
+material
+material 0.500000
+frame
+-1 = anim vertex =
+frame material
+=
+vertex bone vertex bone anim 1.0 1.0
+material texture -1 anim 0.500000
+0.500000 frame -1 anim
+material frame -1 vertex frame frame anim
+texture material vertex 1.0 1.0
+vertex 0.500000 = bone = texture frame frame material texture 0.500000 0.500000
+anim -1 0.5
\ No newline at end of file
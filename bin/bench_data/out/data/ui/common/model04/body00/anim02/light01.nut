@@ -0,0 +1,80 @@
+= texture -1 vertex -1 bone 0.500000 material frame = anim
+-1
+material vertex texture
+-1 frame -1 bone =
+0.500000 -1 frame anim frame bone bone -1 material
+-1 -1 texture vertex
+vertex -1 frame
+vertex
+vertex
+-1
+vertex bone
+1.0 0.500000 =
+material 1.0 bone 0.500000 material frame
+= anim bone texture
+frame anim vertex = bone frame frame frame vertex = vertex frame anim
+0.500000
+0.500000 vertex anim vertex -1 texture 1.0
+-1 material anim
+material =
+vertex 1.0 texture -1
+vertex 1.0
+anim -1 anim vertex
+frame 0.500000
+-1
+frame 0.500000 vertex
+bone anim anim bone vertex
+texture = -1 frame -1 bone bone texture 1.0 material = vertex = vertex texture
+= frame 0.500000 bone = -1
+0.500000 0.500000 vertex 0.500000
+1.0 texture
+texture 0.500000 bone vertex
+-1 frame bone bone 0.500000 0.500000 = anim
+1.0 anim vertex
+vertex texture material bone
+-1 -1 vertex bone vertex 0.500000 -1 texture frame anim texture -1 anim texture
+frame frame bone
+material vertex
+anim
+= anim texture 0.500000 bone = 1.0 bone vertex bone 0.500000 -1 vertex
+bone 0.500000 1.0 material anim bone frame material material anim -1
+-1 anim texture anim
+bone frame
+-1 bone
+vertex 0.500000 texture frame 1.0 bone -1 anim 1.0 vertex
+-1
+= -1 = material 1.0 0.500000 = = 0.500000 anim 0.500000 0.500000 frame = =
+texture frame bone anim
+frame texture
+vertex
+0.500000
+material frame texture bone
+1.0 frame material
+anim vertex texture
+anim bone material frame
+texture
+material bone texture -1 frame material
+0.500000 bone material 1.0 material 1.0
+0.500000 =
+1.0 material -1 =
+frame bone vertex vertex = bone frame vertex
+0.500000
+vertex
+frame 1.0 material
+material material
+anim 1.0 0.500000
+1.0 vertex
+texture frame
+1.0 anim
+frame
+= vertex
+1.0
+material = vertex = frame -1 anim 1.0 material
+1.0 material bone material texture frame -1 bone frame texture 1.0
+vertex anim = frame texture frame
+anim material material
+-1 1.0 frame
+1.0 = = frame vertex vertex
+frame = bone vertex 0.500000
+0.500000 -1 -1 anim =
+bone 1.0 frame
\ No newline at end of file
@@ -0,0 +1,2 @@
+0.500000
+= anim material anim anim -1 vertex fram
\ No newline at end of file
@@ -0,0 +1,46 @@
+bone material anim texture material -1 1.0 material frame material
+bone
+material = -1 anim -1 -1
+bone
+vertex material
+1.0
+frame bone
+anim
+0.500000 0.500000 texture frame
+anim frame 1.0 -1 anim 0.500000 bone vertex
+material 0.500000 material
+frame anim
+texture anim anim
+bone frame
+vertex texture
+texture texture 0.500000
+vertex texture vertex material material bone
+anim 0.500000
+material -1 material vertex
+texture
+bone texture
+= 1.0
+material =
+texture -1 material
+frame bone frame
+0.500000 anim
+texture vertex anim
+vertex anim
+1.0
+0.500000
+texture anim
+0.500000
+anim
+1.0 vertex 0.500000 frame
+material = texture 1.0
+-1
+-1 vertex
+= vertex
+=
+bone
+bone 0.500000 1.0
+material
+material
+frame 1.0 vertex material =
+0.500000 -1
+anim =
\ No newline at end of file
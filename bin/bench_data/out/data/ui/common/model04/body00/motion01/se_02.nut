@@ -0,0 +1,5 @@
+1.0 bone frame
+bone 0.500000 = vertex anim frame bone texture
+material vertex 0.500000
+vertex -1 vertex -1
+0.500000 anim 0.50
\ No newline at end of file
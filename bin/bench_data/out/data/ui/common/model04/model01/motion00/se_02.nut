@@ -0,0 +1,122 @@
+bone material material -1 0.500000 -1 material -1 0.500000 vertex
+material material -1 0.500000
+anim material bone
+0.500000
+bone 0.500000 anim vertex 0.500000 0.500000 vertex 0.500000 material
+vertex 0.500000
+frame vertex
+-1
+anim 1.0 anim
+vertex 1.0 anim material material 0.500000 anim bone texture
+bone frame -1
+frame 1.0 = 1.0 material frame -1 0.500000 -1 material bone frame vertex 1.0 material
+material frame texture anim -1
+anim = anim 1.0 anim
+frame
+-1
+anim material material frame bone
+material texture = material 0.500000 = texture = = material
+material bone
+texture frame frame
+vertex
+frame -1
+bone =
+material
+anim
+vertex texture anim material
+0.500000 vertex texture frame anim
+material material 0.500000 bone
+material material texture 0.500000 material frame 0.500000
+frame
+-1 1.0 material 0.500000 texture material
+1.0 0.500000 0.500000 material
+-1
+1.0 material material bone vertex bone
+anim
+material 1.0
+1.0 anim
+1.0 material frame anim bone -1
+bone 1.0 material 0.500000 = texture 1.0
+frame = 1.0 material bone vertex material material vertex vertex = frame 1.0 anim vertex anim material bone bone bone bone -1 0.500000 texture
+=
+anim -1 vertex
+bone vertex =
+0.500000 0.500000
+texture -1
+bone bone material frame
+0.500000 = frame
+frame
+material
+1.0
+material texture = texture texture
+vertex =
+material anim frame texture 0.500000 -1 material 1.0 vertex frame
+-1 1.0 bone -1 bone
+0.500000 vertex vertex = anim texture texture = -1 1.0 vertex vertex texture
+texture 0.500000 anim
+frame
+frame =
+=
+frame -1
+-1
+texture anim material frame 1.0 1.0 anim bone -1
+0.500000 frame
+texture
+vertex -1 frame
+1.0 vertex
+1.0 texture -1
+frame 0.500000 bone 0.500000 material 0.500000 0.500000 vertex frame 0.500000 = anim texture frame frame texture
+frame anim -1 bone
+=
+vertex 0.500000
+=
+material 0.500000
+material anim
+=
+0.500000
+material material anim vertex bone -1 vertex 1.0 vertex -1
+bone texture = = 0.500000 -1 -1 texture 1.0 0.500000
+0.500000 texture 0.500000
+anim texture anim -1 0.500000 bone bone texture vertex
+frame 1.0 = material
+anim texture
+0.500000 bone 0.500000 material 1.0 -1
+anim anim 0.500000 material
+bone texture bone -1 vertex material frame vertex =
+anim
+frame texture frame material anim vertex 1.0 = material bone
+vertex -1
+-1 material
+frame = texture
+anim
+material material
+texture vertex 1.0 = anim
+frame bone bone
+texture 1.0
+frame material -1 frame anim vertex
+-1 1.0 frame -1 -1 anim material vertex -1 1.0 bone frame anim material
+material material
+-1 texture = material 1.0 -1 -1 vertex texture = 1.0 frame frame vertex bone
+texture anim = texture texture 0.500000 anim texture
+texture = vertex -1 vertex vertex
+=
+vertex texture texture 0.500000 vertex 1.0 material material 0.500000
+1.0
+0.500000 1.0 0.500000 1.0 = anim = anim -1 material frame -1
+anim -1 anim frame
+texture vertex -1 0.500000 texture = bone
+frame frame anim anim
+1.0 anim 0.500000 frame texture -1 0.500000 anim material texture bone -1 frame material
+frame 1.0
+1.0 1.0
+texture material vertex
+vertex 0.500000 anim vertex vertex
+texture texture texture bone frame frame 0.500000 material 1.0 vertex 0.500000 frame
+bone vertex vertex 1.0 texture anim texture 1.0 0.500000 frame vertex 1.0 anim
+texture frame 0.500000
+texture 1.0
+bone 1.0 1.0 -1
+-1 vertex texture
+anim material texture vertex vertex -1 frame -1 = -1
+vertex texture texture = material
+0.500000 -1 vertex -1 
\ No newline at end of file
@@ -0,0 +1,162 @@
+1.0
+1.0 texture
+= vertex = vertex anim
+texture -1 frame
+texture
+1.0 bone frame 0.500000
+material
+anim
+vertex
+frame 0.500000 bone anim
+texture anim = vertex bone = 0.500000 material
+frame
+-1 0.500000
+=
+0.500000
+vertex
+1.0 -1
+bone -1 anim vertex
+anim -1 frame frame
+frame anim vertex
+=
+anim
+frame anim =
+-1 anim anim 0.500000
+0.500000 0.500000 texture = frame = -1 bone vertex
+bone
+-1 frame 1.0
+anim 1.0
+-1 bone texture -1
+1.0 anim
+bone texture vertex texture 1.0 frame 1.0 = -1 texture
+1.0 material -1 anim frame
+texture
+material = anim 0.500000
+1.0 = texture = = frame material = = 1.0 frame frame anim texture = vertex
+= material 1.0 -1 = -1 bone -1 frame =
+bone -1 material bone material material
+bone
+material bone bone anim vertex
+0.500000
+bone texture 1.0 vertex =
+frame 1.0 = material vertex = = =
+=
+0.500000 anim vertex
+0.500000
+0.500000 =
+material bone texture bone anim = -1 -1 frame 0.500000
+= 0.500000 anim bone 0.500000 anim bone -1
+texture 1.0 vertex vertex
+0.500000 =
+-1 0.500000
+= vertex vertex
+anim frame
+bone 0.500000 = bone anim texture
+frame texture = frame anim bone texture bone
+material anim = = frame
+frame frame anim material
+frame texture
+0.500000 frame vertex anim =
+vertex anim
+texture
+0.500000 material frame
+material vertex -1 material
+anim = frame material
+= frame
+anim anim anim material 0.500000 vertex
+0.500000
+texture anim -1
+0.500000 =
+= anim frame vertex texture 1.0 frame vertex anim
+vertex frame texture -1 material
+-1 material 0.500000 = texture vertex vertex 0.500000 1.0 bone 0.500000 frame anim anim material = bone anim vertex
+0.500000 frame -1
+-1 anim vertex
+texture material anim
+texture material
+0.500000 frame
+-1 anim
+-1 vertex 1.0
+anim vertex anim
+texture texture
+frame 1.0 vertex 1.0 bone
+= bone 1.0 1.0 -1 1.0
+1.0 vertex
+texture
+1.0 texture = 1.0 frame 0.500000 anim
+vertex anim 1.0
+frame frame anim vertex 0.500000
+bone -1 = anim =
+material material
+anim bone vertex anim
+0.500000 material
+texture
+material bone = anim = 0.500000 1.0
+bone material
+0.500000
+texture frame
+bone frame 1.0 0.500000 vertex frame = vertex
+anim = material vertex frame anim bone vertex frame frame anim vertex frame bone 1.0 1.0 vertex -1 1.0 vertex vertex
+1.0
+0.500000 = 0.500000 0.500000 = frame material anim frame = vertex bone frame
+1.0 frame material -1
+1.0
+1.0 material
+frame bone texture texture
+bone 0.500000
+=
+-1 anim anim
+texture
+-1 = bone =
+vertex frame 0.500000 0.500000 frame 1.0 1.0 -1
+= frame vertex material vertex anim texture material bone
+vertex 0.500000 0.500000 1.0
+frame anim
+1.0 -1 material 0.500000 1.0
+-1 material vertex
+vertex
+1.0 -1 bone vertex material material bone
+= -1
+1.0
+frame material texture bone
+= bone
+texture vertex vertex -1 texture material texture material frame texture
+1.0 =
+0.500000 1.0 0.500000 texture 0.500000
+-1 0.500000 vertex bone bone
+bone texture frame texture texture = 0.500000 = anim anim anim
+vertex bone frame bone -1
+texture 0.500000 frame texture = 1.0 0.500000 = = vertex texture = material anim
+0.500000 = material 1.0 = anim
+=
+anim 1.0 -1 = vertex = 1.0 frame anim bone
+0.500000 material 1.0
+0.500000 material texture frame vertex
+0.500000 vertex 0.500000 anim anim bone
+anim 0.500000 anim 1.0 texture = 0.500000 texture material
+material
+1.0 material
+bone material -1 0.500000 anim
+vertex anim
+-1 vertex 0.500000
+anim
+-1 texture frame
+anim = material -1 anim -1 vertex
+vertex
+vertex 1.0 0.500000 anim
+texture frame
+frame anim
+bone anim vertex frame 1.0 material material texture 1.0
+= frame anim -1
+texture
+vertex frame
+vertex
+vertex anim
+vertex material vertex anim
+-1 -1
+anim 0.500000 bone vertex -1 -1
+0.500000 bone bone
+frame frame vertex 1.0 material anim -1
+anim
+material vertex vertex vertex = material anim material texture -1
+bone 1.0 an
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture
+anim
+frame frame 1.0
+frame
+material
+1.0 frame
+vertex 1.0 1.0 bone vertex 1.0 = material
+bone
+anim material 1.0 m
\ No newline at end of file
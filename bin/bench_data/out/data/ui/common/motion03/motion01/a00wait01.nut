@@ -0,0 +1,100 @@
+anim
+= frame anim
+= vertex material anim
+frame vertex vertex vertex
+0.500000 -1 -1 0.500000 anim texture
+frame
+-1
+1.0 vertex vertex bone 0.500000
+texture
+bone -1 frame -1
+texture 0.500000 0.500000 texture = frame
+material frame vertex bone frame 0.500000 1.0 texture =
+1.0
+-1 bone anim texture -1 =
+anim
+material
+texture -1
+0.500000
+-1 1.0
+bone 0.500000
+bone material 1.0 material -1 0.500000 0.500000 vertex frame
+texture -1 bone vertex
+vertex material
+vertex
+-1 0.500000 vertex
+bone -1 vertex 0.500000
+-1 0.500000 -1 frame vertex
+texture frame
+= anim frame anim = =
+=
+bone texture vertex material material
+1.0 texture anim 1.0 anim anim -1 texture 0.500000 vertex = 1.0 bone frame
+1.0 0.500000 = 1.0 1.0
+vertex material
+texture = frame texture
+anim 1.0 texture 1.0 bone frame anim bone frame
+texture frame frame vertex 1.0 material vertex vertex 0.500000 texture 0.500000 1.0 0.500000
+bone = 0.500000
+-1 frame 0.500000 vertex
+= texture 0.500000
+1.0 bone 1.0
+bone
+0.500000 1.0
+texture
+-1
+1.0 frame anim =
+bone -1
+1.0 0.500000 material texture vertex anim = anim bone bone 0.500000 frame =
+vertex bone texture
+1.0
+texture bone frame vertex texture -1
+texture
+texture material vertex 1.0 vertex material vertex anim
+= anim vertex 1.0 bone 1.0 = texture
+vertex
+material bone
+= material
+=
+vertex
+frame
+-1 anim material vertex vertex material bone vertex
+vertex = = material bone 1.0 frame
+frame
+0.500000 vertex 0.500000
+-1 anim anim 1.0 bone
+frame bone frame frame 1.0 texture 0.500000 = vertex vertex
+frame anim -1 vertex
+texture = texture bone
+0.500000 0.500000 anim -1 frame vertex -1
+-1 frame
+texture material 0.500000
+frame bone
+0.500000 frame
+material material texture
+vertex anim anim anim 1.0 material
+bone material =
+0.500000 -1 = 1.0 frame
+material
+material anim
+= bone 1.0 bone -1 frame 1.0 -1 vertex anim
+0.500000 1.0 -1 texture frame 1.0 texture =
+-1 material
+0.500000 anim
+vertex frame
+material texture
+frame texture = anim 1.0 anim 0.500000 bone frame frame vertex bone
+-1
+bone
+material anim 0.500000 texture material frame 1.0
+anim frame -1 1.0 -1 = =
+texture -1 0.500000 anim
+0.500000 material
+1.0
+bone = frame -1
+= anim material 0.500000 bone vertex material 0.500000 bone 1.0 texture vertex =
+-1 material vertex
+bone 0.500000
+material anim -1
+vertex 1.0 bone
+ve
\ No newline at end of file
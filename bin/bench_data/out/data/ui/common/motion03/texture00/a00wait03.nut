@@ -0,0 +1,320 @@
+frame 1.0 texture bone
+texture = anim material
+texture
+-1 -1 bone anim frame material -1 1.0 frame anim
+texture frame -1 1.0 frame bone 1.0 1.0 anim texture texture
+anim
+1.0 anim -1 0.500000
+material frame vertex vertex frame frame texture
+= anim anim
+frame anim bone texture anim = 1.0 anim 1.0 anim frame material bone bone texture -1
+vertex 0.500000 material anim anim vertex 0.500000
+frame =
+-1
+0.500000 -1 anim 1.0
+0.500000
+vertex texture 1.0 -1 0.500000 = 0.500000 material 0.500000 texture = anim
+texture frame anim texture anim frame vertex anim anim = material -1 material
+-1 -1 frame
+-1
+anim
+material texture frame -1 vertex -1 = 0.500000 texture frame
+-1 frame material
+anim frame frame texture anim anim texture 0.500000 -1 anim
+-1 bone frame
+-1
+bone 0.500000 anim 0.500000 texture -1 material bone material bone bone -1 texture
+vertex texture -1 = frame bone texture bone
+anim bone anim
+0.500000
+anim 0.500000 =
+texture texture anim
+= vertex vertex anim vertex
+1.0 =
+-1 material -1 bone 1.0
+frame
+bone
+1.0 anim bone bone
+0.500000
+-1 anim anim
+anim vertex anim frame
+-1
+=
+vertex
+bone
+anim
+1.0 vertex -1 bone 0.500000 anim -1
+bone
+anim 1.0 -1 bone vertex anim frame material =
+vertex material material -1 anim = 0.500000 material anim 0.500000 texture bone anim texture
+frame vertex material =
+0.500000 =
+= 1.0 frame
+= 0.500000 vertex 1.0
+vertex
+frame frame -1 -1 vertex texture 1.0
+0.500000 0.500000 = frame
+bone texture -1 texture 0.500000 material
+texture bone bone material
+bone frame
+frame 1.0 bone anim
+material texture material
+1.0 = vertex vertex bone
+material anim vertex texture frame vertex =
+material 1.0 texture = 0.500000 vertex material
+0.500000 0.500000 vertex 0.500000 1.0 texture 1.0
+= 1.0 -1
+0.500000
+-1 1.0 material texture -1 0.500000
+= vertex
+0.500000
+vertex texture 0.500000 bone frame 1.0 1.0 = frame frame 0.500000 0.500000
+vertex
+texture 1.0 -1 bone texture material -1 0.500000 -1
+-1 texture -1 vertex
+texture frame
+bone anim vertex = anim
+material material texture -1 0.500000
+1.0
+bone -1
+texture material 1.0 vertex material
+anim
+bone anim
+vertex
+material anim frame
+-1 texture material texture
+= = bone
+vertex -1 bone material 0.500000
+= vertex
+0.500000 1.0 vertex = anim 1.0
+1.0 vertex 1.0 texture
+texture -1 bone -1 1.0
+frame
+frame
+0.500000
+texture
+-1
+-1 vertex frame
+texture = 1.0 material 0.500000 texture 0.500000
+frame
+texture
+texture material 0.500000 texture frame
+0.500000 -1 1.0 = 0.500000
+= anim 1.0
+vertex frame
+vertex frame 1.0
+texture -1 anim material texture frame =
+= = = frame 0.500000 frame 1.0 texture material
+anim
+= bone =
+1.0
+anim -1 frame = 0.500000 texture
+frame 1.0 anim 0.500000 0.500000
+= anim 1.0 = vertex frame -1 vertex material texture bone 1.0 frame texture frame anim texture
+frame texture
+bone 1.0 anim 1.0 anim anim 0.500000 bone
+1.0 1.0 texture texture 1.0
+vertex
+texture material
+texture 1.0 frame material texture 0.500000 vertex bone
+0.500000 anim frame
+1.0
+anim anim -1 anim frame = -1 0.500000 -1 material 0.500000 = 1.0 vertex anim texture -1 anim
+1.0 = 1.0 bone -1 frame frame material 0.500000
+0.500000 anim texture
+=
+0.500000 material anim frame
+material
+texture material -1 material vertex bone bone frame anim 0.500000 -1
+texture anim =
+texture frame 0.500000 = 0.500000 vertex
+texture 1.0 1.0 frame anim
+texture vertex
+1.0 material anim vertex =
+vertex texture -1 anim
+-1 -1 frame 1.0
+1.0
+frame
+-1 material 1.0 bone 0.500000 vertex material 0.500000 vertex texture 1.0 texture
+anim
+anim
+anim 0.500000 material material anim bone anim texture vertex
+vertex = frame -1 1.0 bone anim bone texture
+0.500000
+material texture -1 1.0 texture bone frame vertex 1.0
+vertex texture
+bone vertex vertex frame material texture 1.0 0.500000
+vertex anim anim
+-1 frame frame material texture
+= -1 -1 bone
+texture 0.500000 -1 1.0 vertex material 1.0 texture 1.0
+vertex anim anim
+material
+anim material -1
+=
+0.500000 bone bone
+vertex texture anim = texture
+=
+= 0.500000
+= vertex vertex
+= 0.500000
+1.0 = bone
+bone material -1 texture texture
+=
+-1 bone 0.500000 =
+material
+material -1 = material -1 0.500000 0.500000 frame anim = texture
+=
+vertex texture
+bone anim texture 0.500000
+0.500000 = texture bone
+frame
+0.500000
+frame bone material vertex
+= anim 1.0 0.500000
+= 1.0
+bone texture = frame frame -1 vertex texture -1
+1.0
+1.0 vertex
+frame = -1
+frame =
+1.0 anim
+1.0 1.0 bone vertex texture 0.500000
+anim
+frame
+1.0 texture material vertex
+vertex
+-1 texture frame
+anim
+1.0 material vertex =
+vertex 1.0 -1
+texture
+frame
+material bone texture vertex
+frame frame -1 bone 1.0 = vertex -1
+1.0 0.500000 material
+1.0 vertex vertex 0.500000
+-1 = material = -1 bone vertex anim vertex
+frame material frame vertex anim
+material anim vertex 1.0 = 1.0
+material anim 1.0 1.0
+= = 0.500000 anim anim 0.500000
+anim material = bone
+anim
+-1 material 1.0 material frame
+bone -1 bone
+bone anim vertex vertex -1 0.500000 bone
+= material
+-1 material texture 1.0 material
+-1 =
+vertex vertex frame material = 1.0
+-1 0.500000 frame material 0.500000 0.500000 = frame anim =
+vertex 0.500000 0.500000 1.0 1.0 -1
+texture
+=
+vertex material frame material vertex material
+bone vertex anim -1 bone -1 anim
+anim
+vertex 1.0 = texture 0.500000 vertex texture texture anim bone bone frame
+texture
+texture 0.500000 -1
+0.500000 1.0
+frame vertex
+0.500000 frame
+vertex frame
+0.500000
+bone 0.500000 bone 0.500000
+1.0
+bone
+= vertex = bone -1
+vertex = anim -1 material = 0.500000 anim vertex vertex frame -1 bone
+0.500000 anim -1 vertex bone
+texture bone
+anim -1 vertex -1 -1 material 0.500000 bone material bone anim material
+frame
+0.500000
+= 0.500000 0.500000 -1 = frame texture vertex 1.0 -1 -1
+material
+material bone bone 0.500000 material 1.0 1.0
+texture material 1.0 material
+material -1 -1 anim -1
+material
+bone material = anim -1 0.500000 texture frame 0.500000 texture
+anim
+0.500000 -1 =
+0.500000 0.500000 vertex 1.0 anim anim material
+vertex frame =
+bone
+material
+vertex
+0.500000 1.0 material
+bone
+bone
+1.0 = vertex
+vertex -1 frame = texture anim = frame
+texture 1.0 1.0 0.500000 1.0 0.500000 bone frame -1 1.0 vertex 1.0 vertex 1.0
+material vertex material
+0.500000 frame = vertex vertex
+1.0
+-1 vertex 0.500000 material anim
+texture material material frame frame texture 0.500000
+-1
+vertex 0.500000 -1 -1 bone material material
+bone 0.500000
+anim
+bone
+material = 1.0
+vertex
+anim texture
+texture vertex material -1 = 1.0 frame vertex 0.500000 -1 -1 material
+-1 material bone
+vertex 0.500000 1.0 1.0
+material
+1.0 material -1
+0.500000 anim bone vertex vertex
+vertex bone
+texture frame bone anim
+frame -1
+bone -1
+0.500000 0.500000 bone
+vertex -1
+frame 1.0 material
+bone -1 0.500000 = bone frame texture
+1.0 texture 1.0
+bone
+= bone anim anim -1 1.0 1.0
+vertex
+material
+0.500000 texture -1 0.500000 -1 1.0 material bone bone 0.500000 vertex 0.500000 bone material material bone vertex
+-1 0.500000 1.0 bone vertex material frame =
+texture 0.500000 anim 0.500000 texture frame 1.0 0.500000 texture 1.0 1.0
+texture -1
+0.500000 anim anim material material 1.0 bone bone
+-1 frame 1.0
+-1
+0.500000 texture -1
+1.0 frame = 1.0 frame 1.0 1.0 anim texture =
+texture = anim anim frame anim vertex frame
+bone -1 0.500000 -1 -1
+0.500000 frame texture material
+frame vertex
+frame anim
+1.0 texture material
+vertex anim 1.0 vertex
+-1 material
+frame anim 0.500000 0.500000 anim frame = 0.500000 -1 vertex = frame -1
+vertex
+0.500000 1.0
+vertex anim anim texture
+bone = frame bone anim texture texture -1 -1
+frame
+vertex frame 0.500000 vertex 1.0 -1 0.500000 =
+anim vertex frame 1.0 frame 1.0 anim 1.0 1.0 texture
+anim material 1.0 -1 0.500000 texture
+anim anim texture
+frame bone =
+bone bone 1.0
+0.500000
+material frame 1.0 vertex =
+0.500000 anim -1 anim anim -1 1.0 texture vertex anim vertex
+= vertex material anim 1
\ No newline at end of file
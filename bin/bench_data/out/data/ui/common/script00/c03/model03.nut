@@ -0,0 +1,124 @@
+frame
+material vertex vertex
+material
+=
+texture -1 0.500000 -1 texture frame -1
+texture frame 1.0
+material
+frame
+=
+= 1.0 frame material texture frame texture
+frame anim
+anim = texture
+frame
+bone 1.0 vertex
+= texture vertex texture
+texture vertex texture texture -1 0.500000 texture bone texture vertex
+= -1 anim -1 =
+anim = 0.500000 0.500000 texture bone material 0.500000 0.500000 anim
+=
+frame 0.500000
+= anim frame vertex texture texture = 1.0 =
+frame material
+bone anim frame
+-1 0.500000 texture texture texture vertex
+texture -1
+bone = texture material
+= 1.0 1.0 anim 0.500000 -1 1.0 material anim
+1.0 -1 -1
+bone
+1.0 texture 1.0 vertex frame
+=
+texture
+texture texture -1
+frame 0.500000
+material bone 1.0 texture texture 1.0
+bone bone vertex -1 0.500000 frame -1 anim -1
+vertex bone frame material frame = texture
+material 1.0 frame 0.500000
+texture anim 1.0 bone 0.500000
+-1 -1 frame 0.500000 = vertex 0.500000 0.500000
+-1 frame 1.0 1.0
+frame bone
+= vertex anim vertex
+0.500000 0.500000 0.500000 -1
+vertex = 1.0 -1 bone
+texture 1.0 frame vertex
+= texture anim
+1.0 frame =
+-1
+bone -1 frame vertex 1.0 -1 0.500000 0.500000 texture 0.500000 = frame bone anim 0.500000 anim -1 material frame 0.500000 material = texture
+-1 frame 0.500000 = 0.500000 1.0 -1 material
+-1 material
+vertex
+frame bone anim
+0.500000
+1.0 bone
+vertex anim texture vertex frame vertex 1.0
+material
+= -1 frame -1 texture
+vertex 0.500000 1.0 -1 bone texture anim
+bone
+-1 material anim
+-1
+1.0 = anim material material texture material bone frame anim texture
+1.0
+vertex vertex 1.0 1.0
+bone
+anim
+1.0 = frame =
+frame frame material frame
+texture -1 material vertex anim anim anim anim frame -1
+= material
+frame frame vertex
+1.0
+anim texture anim material 1.0 bone vertex anim bone vertex
+vertex bone 1.0 1.0 vertex 1.0 material texture 0.500000 anim anim bone texture = frame 0.500000
+1.0 = 0.500000 texture
+anim
+texture 1.0
+anim
+= 0.500000 1.0 1.0 1.0 anim anim
+-1
+vertex
+frame anim = anim anim vertex frame
+anim bone 1.0 -1
+vertex material material 0.500000 0.500000 vertex
+1.0 anim = material
+0.500000 1.0 material anim anim 1.0 frame texture material 0.500000 anim bone frame vertex
+0.500000 bone bone texture bone anim
+1.0
+frame 1.0 texture material
+material
+= 0.500000 -1 = =
+vertex frame
+anim -1 material frame
+vertex 1.0 material texture bone material
+frame =
+texture bone vertex material
+-1 bone bone anim 1.0 1.0
+material material 0.500000 = bone anim =
+bone
+anim -1 1.0 frame bone 1.0 vertex frame
+texture frame -1
+= anim -1 bone = -1 frame 1.0 -1 vertex material =
+texture
+anim
+material = frame material anim 1.0 0.500000 -1
+frame bone texture
+bone bone frame
+0.500000 frame
+1.0 anim material bone 1.0 0.500000 0.500000 0.500000
+material material frame
+texture anim =
+frame texture =
+material = anim = bone 1.0 material
+-1 1.0 frame 1.0 anim
+0.500000
+0.500000 frame texture frame
+-1 texture -1 0.500000 frame
+= 0.500000 -1 texture =
+texture =
+0.500000
+vertex bone texture frame anim 1.0 = 1.0 anim
+frame material vertex 
\ No newline at end of file
@@ -0,0 +1,2 @@
+material = material bone
+= -1 anim mate
\ No newline at end of file
@@ -0,0 +1,74 @@
+material anim texture = anim material texture frame -1 = -1 texture vertex 0.500000 -1 texture material 1.0
+anim frame vertex texture 0.500000 1.0 bone
+0.500000 vertex bone
+0.500000 bone
+0.500000 =
+texture anim frame 0.500000 0.500000 anim frame 0.500000 vertex 1.0 material vertex vertex
+= texture
+= 1.0 bone = -1 0.500000
+1.0 -1 -1
+=
+bone frame = texture material -1 frame
+texture 1.0 material = texture bone frame
+-1 0.500000 -1 texture 0.500000 bone = anim bone texture -1
+-1 1.0 texture 1.0 frame
+-1
+texture 1.0
+bone
+anim
+texture vertex
+-1 = bone 0.500000
+=
+bone
+frame
+anim anim -1 texture
+texture
+material 1.0 = texture frame material anim vertex 0.500000 vertex 0.500000 frame texture anim = frame anim material -1
+bone
+= texture =
+1.0
+0.500000 material bone vertex
+texture anim -1
+= 0.500000 material anim 1.0 frame = = 1.0
+material
+vertex -1
+bone
+texture -1 -1 bone
+anim 1.0 1.0 frame frame 0.500000 vertex frame 1.0
+frame frame anim
+= bone
+0.500000
+anim texture anim vertex anim 1.0 1.0 0.500000 material vertex -1 =
+= 1.0 =
+frame vertex texture 1.0 vertex texture vertex
+= vertex
+-1
+frame
+anim = 1.0 -1
+= vertex material texture 0.500000 vertex = 1.0 anim frame = texture vertex
+vertex
+0.500000 -1 0.500000 material vertex 0.500000 anim 1.0 bone material bone
+frame 0.500000
+anim = 1.0
+frame
+0.500000 1.0 bone anim
+anim = bone bone -1 vertex -1 1.0 -1 frame frame vertex anim -1 vertex
+material anim
+0.500000 frame -1 -1
+0.500000
+-1 material vertex vertex -1 = material
+anim bone vertex frame
+vertex -1 0.500000
+frame material
+material vertex texture
+material -1 0.500000 1.0 -1
+texture anim
+1.0 1.0
+frame anim -1
+vertex anim 0.500000
+anim vertex bone bone vertex -1 texture
+frame bone
+-1 vertex frame material texture vertex vertex bone
+1.0 material vertex material vertex bone material
+bone material -1
+vertex texture
\ No newline at end of file
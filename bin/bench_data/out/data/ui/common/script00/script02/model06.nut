@@ -0,0 +1,306 @@
+vertex 0.500000 material -1 -1 vertex vertex 0.500000 material
+=
+bone
+0.500000 = frame -1 =
+material bone bone
+frame
+frame
+frame texture vertex anim = bone
+1.0
+vertex
+anim material anim 0.500000
+frame = 0.500000 material bone
+vertex frame anim vertex texture frame
+= bone
+texture vertex vertex
+1.0 material bone vertex = vertex bone
+anim
+texture bone = texture
+material 1.0 -1 1.0 anim -1 vertex frame material -1
+0.500000 1.0
+bone frame 1.0 texture
+bone
+0.500000
+1.0 = bone
+1.0
+vertex
+frame
+anim
+anim
+-1 anim texture
+texture
+bone
+bone vertex
+texture -1 bone vertex anim
+0.500000
+frame
+anim anim material bone material material -1 texture texture texture 1.0
+texture = 1.0 texture bone =
+1.0 0.500000 = 0.500000 frame 0.500000
+0.500000 bone anim material
+=
+-1
+bone 1.0
+-1 frame 1.0
+material 0.500000 material
+= -1 vertex
+0.500000 1.0
+frame material texture
+1.0 texture 0.500000 frame
+anim texture anim frame bone texture
+texture vertex -1 bone
+material 1.0 material frame 1.0 = anim material vertex anim material 1.0 anim = = frame = material material anim = -1
+-1 = 0.500000 bone =
+material
+texture frame bone -1 0.500000 vertex texture material = material -1 anim anim =
+= -1 material
+1.0 bone vertex 0.500000 material
+bone anim frame -1 1.0 anim 1.0 texture
+material vertex =
+=
+bone
+anim = frame
+bone texture bone material 1.0 1.0 texture 0.500000
+material
+bone -1
+texture
+bone bone anim
+material = -1 material 1.0 vertex anim material -1 -1 = 1.0 material -1 1.0 1.0 frame
+vertex vertex -1 =
+vertex
+bone
+frame
+1.0 texture frame -1 = 0.500000
+material
+0.500000
+-1
+0.500000 -1
+-1 -1 =
+1.0 frame 1.0
+bone anim texture 1.0 vertex
+texture material bone texture
+material
+bone vertex = anim frame 1.0 material texture -1
+1.0 0.500000 frame bone texture 1.0 1.0
+texture = frame texture material
+= bone
+vertex frame 0.500000 vertex material anim anim bone material bone 1.0 material
+bone 0.500000 vertex material 1.0 = -1 material texture 1.0 = 1.0 frame bone = vertex texture 0.500000 material anim -1 = = frame anim
+bone bone 0.500000
+bone
+texture frame frame =
+1.0 material -1 -1
+frame
+bone vertex
+material vertex texture = frame -1 = vertex
+0.500000 = vertex frame
+-1
+1.0 1.0 0.500000 bone 1.0 frame anim frame
+= 1.0 -1 0.500000 anim
+texture bone -1 bone
+1.0 frame
+0.500000
+=
+texture 1.0 bone
+frame = -1 bone -1 frame anim anim
+material frame 0.500000 vertex texture 0.500000 frame
+0.500000 anim 0.500000 1.0 1.0
+bone anim = 1.0 1.0 1.0
+bone
+material material vertex
+texture vertex
+texture 1.0 frame 0.500000 texture bone
+material frame =
+bone material
+texture -1 bone material texture texture 0.500000
+1.0 bone vertex anim 1.0 vertex 1.0 bone texture 1.0
+frame frame -1 texture bone vertex texture
+texture 1.0 anim anim 0.500000 bone anim =
+= -1
+1.0 = texture bone -1 texture anim = texture =
+= vertex
+bone material bone
+1.0 vertex 0.500000
+vertex
+texture
+frame anim vertex =
+vertex
+-1 1.0 bone
+vertex texture = -1 1.0 material bone frame anim material vertex bone anim 1.0
+= = anim
+= 0.500000 1.0 0.500000 material =
+texture frame 0.500000 frame material
+bone 1.0 texture
+= anim bone = 1.0 bone frame material
+vertex vertex material 0.500000
+anim 1.0 = bone
+anim
+material
+=
+anim frame frame 0.500000
+0.500000 1.0 =
+bone
+-1 -1 texture -1 anim vertex vertex material 1.0 texture bone
+1.0
+vertex
+=
+-1 1.0
+1.0
+= texture 1.0 1.0 -1 = anim
+= bone texture bone 1.0 0.500000 material 0.500000
+-1 -1 -1
+1.0 texture
+1.0
+texture 1.0 texture -1 material
+bone vertex anim frame = bone =
+0.500000 = 1.0 texture
+material 1.0
+=
+anim material texture frame 1.0 frame
+frame bone 1.0 texture texture 0.500000 material texture -1
+= texture 1.0 vertex 0.500000 material texture 1.0 vertex
+vertex = material -1 0.500000
+frame = 1.0 texture
+texture 1.0 = material vertex 1.0 frame 0.500000
+texture texture 1.0 1.0 frame
+0.500000 bone 0.500000
+vertex -1 1.0 anim vertex = -1
+= anim bone
+-1 0.500000
+vertex 1.0 =
+bone = bone
+vertex texture
+frame
+bone anim vertex anim
+1.0
+= vertex material = anim 0.500000 1.0 bone anim frame
+1.0 0.500000 -1 =
+1.0
+texture
+material -1 bone vertex 1.0 bone =
+anim = frame 1.0 anim 1.0 =
+anim frame material
+1.0 anim
+material vertex material texture =
+bone
+-1 -1 material vertex bone -1 vertex material
+bone texture bone anim texture frame =
+=
+vertex vertex = material material anim frame vertex vertex frame 0.500000
+material 0.500000
+vertex
+bone
+1.0 1.0 1.0 vertex
+vertex
+-1 material
+0.500000 vertex texture texture 1.0
+texture texture material bone frame 1.0 =
+= material vertex
+1.0 frame 1.0 vertex 0.500000 anim frame bone
+vertex
+texture texture -1 = -1
+= vertex bone material 1.0 bone material 1.0
+bone 1.0 frame anim
+texture material texture bone 1.0 anim = =
+-1 vertex 0.500000 -1
+0.500000
+bone 0.500000
+frame texture
+-1 vertex bone -1 vertex 1.0 vertex -1
+0.500000 = 1.0 texture bone
+vertex texture
+-1
+frame
+frame -1 vertex -1 vertex
+anim
+0.500000
+texture vertex
+vertex vertex anim
+anim vertex 0.500000 bone
+anim 0.500000 material 0.500000 anim
+vertex frame
+=
+material 1.0
+= material 1.0 texture
+texture = texture
+anim = bone
+0.500000 1.0 vertex 1.0 bone vertex texture bone
+1.0 texture
+bone
+bone material 1.0 vertex
+0.500000
+0.500000
+vertex texture vertex texture texture
+bone material
+-1 material texture anim texture bone
+=
+texture
+anim vertex material
+anim material
+material material vertex -1
+-1 material
+1.0 bone
+0.500000 frame
+anim =
+-1 -1 bone -1 -1 0.500000
+anim anim frame 0.500000 0.500000 =
+bone
+-1 bone anim vertex =
+vertex bone frame material bone material
+0.500000
+bone frame 1.0 frame 0.500000 material anim anim 0.500000 =
+-1 texture bone anim
+anim 0.500000
+= bone texture = texture
+-1 frame 0.500000 vertex 1.0
+material
+= material
+-1 vertex 0.500000
+frame anim -1 bone
+anim -1 1.0 =
+frame 1.0
+bone
+= 1.0 0.500000 texture bone = material bone frame frame anim frame texture
+anim 1.0 texture frame
+0.500000 anim material
+= texture
+= vertex texture
+bone anim 1.0 bone -1
+texture
+bone 1.0 =
+1.0
+= -1 0.500000
+0.500000
+bone 1.0
+material bone
+texture
+texture material 1.0
+bone texture frame bone
+-1
+texture
+bone material texture material material -1 bone
+bone -1 0.500000 0.500000 0.500000 bone anim bone
+anim 0.500000 -1 vertex texture 0.500000 texture 0.500000 texture
+anim
+vertex 0.500000 -1
+= 1.0 -1 bone
+material texture
+0.500000 bone material
+1.0 -1 vertex anim -1 =
+anim 1.0
+bone
+1.0 -1 = material
+0.500000 texture texture material
+0.500000 = 1.0 1.0 texture vertex
+material vertex
+vertex
+1.0 bone material
+material
+vertex = frame
+texture frame vertex 1.0 material anim 0.500000 0.500000 -1
+1.0 1.0 anim anim
+material = frame
+bone anim anim -1 material = = =
+bone anim
+0.500000 1.0 -1
+anim
\ No newline at end of file
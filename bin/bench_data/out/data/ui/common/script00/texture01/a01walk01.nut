@@ -0,0 +1,2 @@
+1.0 frame
+bone material vertex 0.500000 1.0 verte
\ No newline at end of file
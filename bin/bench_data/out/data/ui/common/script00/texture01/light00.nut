@@ -0,0 +1,4 @@
+vertex anim vertex anim
+anim material 0.500000 =
+anim
+anim te
\ No newline at end of file
@@ -0,0 +1,70 @@
+texture -1 material
+texture 1.0
+anim 1.0 frame bone anim anim material bone 1.0 -1 frame
+1.0 bone 1.0 -1 -1 anim = material 1.0
+0.500000 1.0 texture -1 = texture texture
+vertex
+0.500000 anim
+1.0 texture frame -1 material anim frame vertex
+0.500000 bone anim = -1 anim 1.0 1.0
+anim bone
+texture
+-1
+1.0
+frame vertex frame
+anim
+1.0 frame
+anim
+0.500000 bone
+vertex bone 1.0 vertex 1.0 anim
+bone 1.0
+-1
+bone
+-1 0.500000
+bone = -1 material
+0.500000 vertex 1.0 frame texture frame anim = vertex material
+vertex frame 1.0
+vertex bone
+material 0.500000 0.500000 frame vertex
+texture 1.0
+vertex
+vertex
+bone = = frame
+material material texture bone -1 1.0
+-1
+1.0
+vertex frame -1 1.0 texture material = anim
+frame vertex
+vertex anim 0.500000 1.0 1.0 frame vertex -1 anim
+vertex
+frame material =
+1.0 1.0 texture
+1.0 texture
+0.500000
+texture bone
+texture -1 vertex material frame
+= 0.500000
+anim anim -1
+-1
+texture
+texture
+material
+= anim
+bone
+0.500000
+material frame frame material =
+bone = -1 anim material 0.500000 anim
+= -1 material anim
+frame
+= vertex frame frame -1 0.500000 anim 1.0
+= vertex 1.0 anim bone 1.0 0.500000 =
+vertex
+anim
+-1 frame
+vertex
+1.0 anim
+bone 0.500000
+1.0 0.500000 bone
+bone bone vertex 0.500000
+bone anim texture
+0.500000
\ No newline at end of file
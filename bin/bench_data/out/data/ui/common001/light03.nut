@@ -0,0 +1,161 @@
+material -1 = 1.0 1.0 texture
+frame anim = anim material vertex texture vertex 0.500000
+=
+anim bone 0.500000
+material anim material texture
+vertex bone frame
+-1 0.500000 =
+0.500000 -1 bone
+-1 0.500000
+frame bone
+0.500000 0.500000 = anim 0.500000 bone -1
+-1
+material
+material
+= material
+anim anim anim
+-1
+anim frame
+-1 material
+texture
+bone frame frame
+bone
+texture
+=
+0.500000
+frame vertex
+0.500000 frame -1 0.500000 bone
+1.0 vertex -1 material frame -1 texture
+frame
+= bone vertex vertex frame vertex
+-1 1.0
+bone
+0.500000 vertex texture anim -1 texture =
+0.500000 bone 1.0
+-1
+bone texture bone 1.0 = 1.0
+texture -1 = =
+frame
+= frame
+0.500000 frame bone texture 1.0 texture
+-1 anim
+material
+0.500000 1.0 vertex material material frame
+material 0.500000 anim =
+bone bone texture
+1.0
+anim 1.0 texture
+vertex anim
+bone -1 frame 0.500000
+texture
+vertex vertex frame material frame bone frame anim
+0.500000 bone bone
+texture 1.0 = 0.500000 material vertex frame = material -1 bone -1 1.0
+texture
+frame 0.500000
+vertex vertex texture =
+frame bone -1 bone vertex 0.500000 material vertex 1.0 -1 material anim bone anim texture anim = material texture
+frame
+frame = anim 0.500000
+frame
+anim 0.500000
+vertex texture
+bone = anim -1 0.500000 1.0
+anim anim 1.0 frame 1.0 frame
+0.500000 material -1 frame = vertex -1 texture = vertex
+bone bone 0.500000
+vertex texture
+1.0 bone material
+anim
+vertex
+frame 1.0 -1 0.500000 bone = frame
+frame = 0.500000 frame bone 1.0 0.500000 vertex vertex anim = -1 frame frame anim
+0.500000 anim
+1.0
+1.0 =
+texture
+texture -1
+0.500000 0.500000
+texture anim bone vertex =
+texture anim bone vertex
+anim
+0.500000 0.500000
+0.500000 bone -1 material
+0.500000
+-1 1.0 material bone vertex bone bone texture
+0.500000 vertex
+anim 0.500000
+= anim anim
+material
+= =
+0.500000 texture frame 0.500000
+anim material bone 0.500000
+frame
+anim 0.500000 material texture material anim material
+= anim frame = -1 0.500000 texture -1
+material = texture
+frame
+bone
+material
+anim anim bone 1.0 1.0 material vertex frame = bone
+-1 -1 vertex -1 texture frame anim
+1.0 frame
+1.0 0.500000
+= material
+anim
+material material anim bone =
+material vertex
+vertex texture bone
+0.500000 material bone 0.500000 material texture material bone
+texture vertex
+anim texture frame material =
+anim texture 1.0
+1.0 material -1 =
+=
+anim =
+=
+bone texture -1
+texture bone
+-1 material = material
+frame frame bone vertex texture texture -1
+frame texture 1.0 texture 1.0 bone vertex
+bone 1.0 vertex 1.0
+anim
+material 1.0 frame texture -1 -1 1.0 anim bone vertex
+=
+-1 1.0 vertex 1.0
+0.500000
+=
+-1 frame anim -1 -1 = = bone
+1.0 -1
+-1 -1 frame anim
+-1 1.0 anim
+0.500000
+frame 0.500000
+bone bone
+texture texture
+vertex bone vertex 1.0
+texture
+vertex texture frame = 0.500000 frame = material frame -1 = -1 =
+-1 frame
+0.500000 1.0 =
+material frame = 0.500000 1.0 = material
+bone -1 frame -1 anim = frame frame bone vertex bone anim frame 0.500000 vertex 1.0 material material = bone bone 0.500000 material material 1.0 -1 material 0.500000 -1 1.0 0.500000 0.500000 bone 0.500000
+bone =
+anim material -1
+1.0 = texture anim texture
+material bone 1.0
+anim material bone bone
+1.0 material -1 1.0
+frame vertex anim
+frame = -1 vertex 1.0
+0.500000 texture material bone bone
+texture vertex
+anim 1.0 frame 1.0 -1 material frame material anim material frame material
+anim
+0.500000 bone 1.0
+= texture material
+= vertex 1.0 = anim
+material anim 1.0 anim bone -1 =
+-1 vertex texture =
+texture 1.
\ No newline at end of file
@@ -0,0 +1,3 @@
+material texture
+vertex = -1 anim material
+frame vertex material 
\ No newline at end of file
@@ -0,0 +1,11 @@
+vertex
+texture
+-1
+0.500000
+=
+= material
+0.500000
+bone vertex 1.0 -1 = = vertex
+0.500000 -1 1.0 bone bone material 1.0
+vertex 0.500000 texture frame
+frame a
\ No newline at end of file
@@ -0,0 +1,21 @@
+1.0 material bone = = material -1 = 0.500000 anim = = anim
+-1 anim
+frame 1.0 1.0 0.500000 1.0 material
+= = frame = 0.500000 anim texture
+vertex anim material
+texture
+1.0 anim bone bone frame material
+texture texture
+texture texture = bone anim material
+0.500000
+0.500000 1.0 anim bone texture texture
+texture bone
+bone 1.0 1.0 0.500000 anim 0.500000 0.500000 vertex texture vertex
+= -1 bone frame -1 1.0
+1.0 material vertex 1.0
+material anim material
+-1 1.0 1.0 0.500000 material texture bone material texture 1.0 texture -1 texture
+texture bone
+texture -1 1.0
+bone = 1.0 1.0 =
+material vertex ver
\ No newline at end of file
@@ -0,0 +1,228 @@
+-1 frame
+material 1.0
+0.500000 1.0 = 0.500000 1.0 anim -1
+frame material -1 vertex texture vertex
+material
+anim texture = 0.500000 vertex 1.0 anim texture material vertex
+= anim =
+-1
+texture
+=
+vertex anim 1.0
+frame -1
+frame texture frame frame
+-1
+vertex
+-1
+-1 bone
+material bone vertex anim anim anim material =
+material
+-1
+anim texture -1 frame
+frame texture frame -1
+0.500000 1.0
+texture 1.0 vertex frame 0.500000 bone frame
+1.0
+= vertex
+-1
+0.500000 1.0 =
+texture material
+= anim frame -1 frame vertex -1 0.500000 texture
+-1
+0.500000 vertex anim 1.0
+= material
+material material -1 1.0
+0.500000 vertex 0.500000 -1 texture frame
+bone 0.500000 0.500000
+material 0.500000
+texture frame vertex anim
+0.500000 = vertex
+frame
+0.500000 frame vertex frame material bone
+bone bone -1 = 0.500000 1.0 = material -1 texture
+= anim vertex vertex vertex = = 0.500000 texture 1.0 material texture bone -1 anim 1.0 = frame texture 1.0 anim 1.0 -1 frame =
+material anim 0.500000 -1 bone vertex material 1.0 bone
+texture texture vertex 1.0 0.500000 0.500000
+frame material 0.500000
+anim bone -1 frame
+texture frame 1.0 texture
+-1 -1 1.0 vertex =
+0.500000
+material
+=
+1.0 material anim =
+vertex 1.0
+texture material
+-1 1.0 vertex
+bone -1 frame = vertex 1.0
+0.500000
+frame bone bone -1
+0.500000 bone bone
+0.500000
+vertex frame = vertex bone -1
+=
+1.0 1.0 texture 0.500000 -1
+0.500000 vertex texture frame
+1.0 anim
+anim 0.500000 material frame
+anim bone
+bone texture bone 0.500000 = material bone 0.500000 anim anim
+frame 1.0 anim 1.0 anim texture =
+texture texture = =
+material
+bone = 1.0 vertex anim
+bone bone
+bone
+anim = frame anim
+0.500000
+material 1.0 frame
+= 0.500000 bone
+= texture texture texture -1 texture 0.500000 bone bone anim bone -1 frame anim
+-1
+anim bone anim
+texture = bone anim
+=
+= frame
+anim 0.500000 1.0
+1.0 1.0 texture texture vertex
+anim bone anim 1.0 bone frame -1 -1 -1
+texture 1.0
+vertex
+bone frame vertex
+texture 0.500000 texture = texture bone = 1.0 frame texture anim
+vertex
+-1
+bone anim
+vertex 1.0 frame
+1.0 vertex 1.0 1.0 texture material texture
+0.500000 1.0
+frame
+=
+vertex anim vertex anim bone bone 1.0 vertex 1.0 1.0 bone bone material 0.500000 -1
+vertex 1.0
+bone
+bone 1.0 bone vertex =
+frame
+frame bone material 0.500000 texture =
+vertex = -1 -1
+1.0
+= frame
+texture 0.500000 -1 vertex = texture
+bone = vertex texture material 1.0 1.0 material
+frame material = material 0.500000
+frame
+frame 0.500000
+=
+vertex material -1 anim vertex material material
+=
+material texture frame
+frame -1 material bone
+anim 0.500000 -1
+anim
+texture
+bone = bone anim
+frame -1 vertex bone 0.500000 material anim 0.500000 = material -1 -1 texture anim -1 vertex -1 frame = 1.0 material 0.500000
+vertex 0.500000 texture vertex anim 0.500000 = anim material
+texture material material
+-1 vertex material 0.500000 0.500000
+texture
+= =
+texture texture material = vertex texture vertex texture
+material bone
+frame
+-1
+=
+0.500000 material vertex -1
+-1 -1 =
+= -1 = 0.500000
+= anim 0.500000 vertex 1.0 material anim
+-1 frame
+-1 vertex -1 = = material
+0.500000
+bone material material texture
+= vertex frame
+anim 0.500000 bone 1.0 0.500000
+0.500000 anim
+material bone 0.500000 vertex
+anim frame -1
+= material anim bone frame
+=
+=
+1.0 -1 anim = 0.500000 texture
+bone vertex
+= vertex 0.500000
+vertex bone 1.0 = bone anim 0.500000 vertex texture anim 0.500000 1.0 anim
+material 1.0 vertex
+-1 1.0 0.500000 -1
+frame
+frame vertex = = 1.0
+1.0 frame texture anim
+=
+bone frame
+material bone bone
+1.0 0.500000 -1 bone = -1
+bone texture frame
+bone
+vertex
+material = bone
+texture vertex
+material
+= frame bone frame 0.500000 vertex texture -1
+-1 bone
+0.500000 =
+bone material frame 0.500000 texture bone 1.0 bone texture -1 material anim bone anim
+1.0 vertex vertex bone 0.500000
+vertex vertex
+= vertex 0.500000 = anim vertex -1 = vertex -1 0.500000 frame vertex
+bone
+0.500000 frame texture frame
+texture
+anim anim -1 vertex
+0.500000 = frame 0.500000
+material texture -1
+anim = 1.0 -1 texture
+0.500000 1.0 bone bone = anim texture
+texture 1.0 0.500000 =
+0.500000 texture bone
+material texture texture 0.500000 anim frame bone 0.500000 = texture
+0.500000
+= frame
+bone
+anim anim 1.0 = material 1.0 1.0 material 0.500000 vertex frame
+bone 1.0 anim 0.500000 0.500000 0.500000 bone =
+anim
+bone 1.0 1.0 anim frame
+= bone bone frame material
+frame -1 = vertex frame vertex frame vertex
+bone -1
+0.500000 = frame -1
+vertex 0.500000 bone anim 1.0 0.500000 frame -1 material texture anim anim 0.500000
+-1 anim = material = anim frame
+=
+-1
+frame material
+-1 bone
+frame
+-1 1.0 -1 -1 anim
+texture frame =
+anim
+material vertex material vertex frame
+bone texture texture
+-1
+bone material -1
+1.0 material bone frame material 1.0 material
+anim
+1.0
+material
+material -1 0.500000 bone bone texture
+frame 1.0 -1 0.500000 0.500000 1.0 -1 frame = bone texture frame 0.500000 anim = vertex texture -1
+1.0
+frame vertex texture 1.0
+0.500000 bone 1.0
+frame anim 0.500000 = = 1.0 anim
+vertex
+texture bone = -1
+frame 1.0 vertex material vertex anim = = frame
+-1 anim 1.0 =
+bone
+texture bone anim vertex bone vertex texture 
\ No newline at end of file
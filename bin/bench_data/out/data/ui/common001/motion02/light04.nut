@@ -0,0 +1,62 @@
+= vertex material anim vertex texture
+-1
+vertex 1.0
+= anim texture -1 0.500000
+texture
+= = material
+-1 texture -1
+-1 -1 vertex -1 0.500000 material material bone 1.0 anim bone 1.0 vertex anim
+frame texture bone material anim bone bone material bone
+anim
+bone vertex
+texture texture anim material material -1 vertex 1.0 frame material material
+frame vertex
+material =
+texture frame material
+anim vertex frame
+-1 0.500000 material 1.0 bone frame 1.0 -1
+frame 0.500000 texture material 1.0 -1 bone
+-1 bone 1.0 = texture
+anim 0.500000 material
+vertex frame bone texture =
+material 1.0 -1
+bone
+bone
+anim
+= 1.0 material bone bone 0.500000
+anim
+anim bone bone
+material
+material texture bone -1 texture vertex
+vertex
+material anim = anim material
+anim 1.0 frame frame frame 0.500000
+0.500000
+bone bone material
+bone
+vertex frame
+texture
+1.0 vertex 0.500000 texture = = anim
+1.0 vertex bone texture =
+1.0 bone texture = bone
+= vertex =
+= 1.0 material -1 material 0.500000 -1 -1 anim 0.500000 texture 1.0 anim
+1.0 material frame vertex material -1 texture
+texture 1.0
+0.500000 anim frame texture bone
+bone = = vertex -1 bone 0.500000 0.500000 = material
+bone 0.500000
+frame material anim 0.500000 -1
+-1
+0.500000 anim
+0.500000 frame
+material 1.0 frame texture 0.500000
+frame bone
+0.500000 texture -1 1.0 vertex
+bone -1 -1 bone
+frame -1
+bone frame
+vertex -1 bone 1.0 = bone
+material = = vertex 0.500000 bone material -1 0.500000
+1.0 = texture anim
+material vertex texture bone 1.0 vertex 0.500000 0.500000 -1 1.0 bone material 
\ No newline at end of file
@@ -0,0 +1,56 @@
+0.500000 = anim -1 1.0 vertex material
+1.0 texture bone
+frame 1.0 -1 bone
+texture 0.500000 bone texture =
+anim
+-1 = vertex bone 0.500000 bone anim vertex texture 1.0 anim
+=
+vertex
+=
+-1 material 1.0 = texture vertex
+0.500000 = material
+anim material
+= = anim material 0.500000 frame bone
+anim bone vertex 1.0 = 1.0 bone bone frame material = anim anim vertex anim 1.0 anim = vertex 1.0 = = frame 0.500000
+frame
+0.500000
+material
+=
+1.0 material anim texture vertex bone vertex
+bone anim frame 1.0 anim vertex = bone material anim frame bone anim -1 = anim anim
+anim 0.500000
+frame material anim -1 frame
+0.500000
+anim material
+frame
+1.0 1.0 -1 anim 0.500000 0.500000 = texture anim 0.500000
+-1 bone
+-1 bone bone -1 = frame
+vertex bone
+frame texture bone 1.0
+frame bone frame vertex vertex 1.0
+material vertex
+= -1 anim frame anim -1 0.500000
+frame anim
+1.0
+-1 0.500000 vertex -1 material
+-1
+anim frame texture = frame -1 = 0.500000 texture texture anim texture vertex frame
+vertex material material -1 bone =
+texture -1 frame
+vertex
+material 0.500000 anim -1 vertex texture anim
+1.0 material bone texture
+=
+frame
+vertex 0.500000 material
+anim
+bone 1.0 -1 vertex texture texture frame material = material
+bone 0.500000 frame texture = 0.500000
+anim
+texture
+0.500000 = vertex = 1.0 vertex
+material 0.500000 texture vertex bone anim
+vertex material =
+bone = =
+bone = b
\ No newline at end of file
@@ -0,0 +1,87 @@
+anim anim
+bone
+vertex
+vertex texture
+material 1.0
+= = anim anim -1 texture 1.0 bone texture
+frame
+texture bone anim frame anim anim material material anim -1
+-1 = texture
+texture 0.500000 1.0 frame
+texture
+vertex
+frame
+bone 0.500000 =
+frame bone material
+vertex texture bone frame
+1.0 bone frame material bone
+vertex -1
+material texture
+material
+= 0.500000 -1 texture 1.0
+1.0 material
+anim texture anim
+1.0 frame
+0.500000 anim frame bone bone frame 0.500000 vertex material 0.500000 bone texture vertex -1 = texture 0.500000 1.0 1.0 vertex 1.0 =
+frame vertex = vertex frame = anim texture -1
+anim frame -1
+vertex vertex
+bone texture 0.500000
+bone 0.500000 frame 1.0 bone -1 0.500000 anim texture texture -1
+= 0.500000 -1 -1
+anim anim vertex
+vertex
+1.0 -1 frame
+texture anim vertex
+0.500000
+texture
+bone
+0.500000 frame -1 0.500000 material 1.0 -1 -1
+= anim material =
+1.0 0.500000 0.500000 material material
+material
+material vertex 1.0 vertex
+vertex anim
+texture frame 0.500000 frame bone vertex material frame
+frame =
+-1 1.0 -1 frame
+0.500000
+1.0
+bone
+texture material
+0.500000 texture 1.0
+0.500000
+material material -1 material -1
+vertex material anim
+bone anim bone anim frame
+= 1.0
+frame anim = vertex
+bone material 1.0 bone vertex anim =
+bone frame vertex = vertex material -1 bone frame anim
+vertex anim
+texture texture texture = material
+0.500000 1.0
+anim
+-1
+1.0 1.0 0.500000
+1.0 frame texture 1.0 texture bone -1
+bone
+= 1.0
+texture 1.0
+frame 0.500000 1.0 texture -1 0.500000
+texture anim anim -1 bone 1.0 0.500000 bone
+0.500000
+0.500000 vertex vertex
+-1 frame bone frame frame
+= bone
+texture frame -1
+texture texture
+1.0 bone -1 bone vertex texture -1 = bone
+1.0 = 0.500000
+0.500000 1.0 1.0 vertex frame material -1 bone anim
+1.0
+-1 0.500000 1.0
+1.0 vertex frame anim material
+0.500000 0.500000 0.500000 =
+= 0.500000 anim 0.500000
+bo
\ No newline at end of file
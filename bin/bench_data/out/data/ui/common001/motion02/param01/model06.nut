@@ -0,0 +1,8 @@
+anim
+anim bone
+1.0
+=
+frame -1
+1.0 anim bone
+-1
+1
\ No newline at end of file
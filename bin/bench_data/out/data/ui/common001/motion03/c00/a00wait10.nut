@@ -0,0 +1,4 @@
+1.0 bone material
+bone
+texture 0.500000 material texture texture bone vertex
+frame material fram
\ No newline at end of file
@@ -0,0 +1,81 @@
+= -1 0.500000 frame -1 1.0 anim 0.500000
+bone texture frame
+frame material 1.0 bone material vertex
+1.0
+-1 vertex
+0.500000 -1 bone = 1.0 material bone frame anim bone
+anim material bone vertex 0.500000 0.500000
+=
+texture
+material
+0.500000 0.500000 0.500000
+frame texture
+texture 0.500000
+bone vertex vertex = 1.0 -1 texture frame bone 0.500000
+0.500000 vertex texture 1.0 vertex
+texture anim -1
+anim frame material vertex frame
+0.500000 material anim anim bone vertex 0.500000 material vertex = bone
+= bone
+1.0
+bone 0.500000 -1 texture anim anim texture = vertex material
+0.500000
+anim vertex
+vertex vertex = texture vertex -1 0.500000 1.0 bone 0.500000 -1 -1 -1
+anim texture = -1 0.500000 = 0.500000 material 1.0
+-1 bone 1.0
+vertex
+1.0
+1.0
+material 1.0 anim texture
+frame
+1.0 1.0
+-1
+bone 1.0 frame anim 1.0
+texture
+vertex = material vertex bone bone frame frame texture material texture anim anim 0.500000 0.500000 anim bone = -1 vertex texture =
+frame
+= frame 1.0 anim
+vertex texture
+0.500000 vertex frame 0.500000 1.0
+frame -1 frame anim texture =
+anim -1 frame
+bone material
+-1
+vertex 1.0
+vertex
+texture material 0.500000
+0.500000
+-1 =
+anim texture 1.0
+texture frame
+vertex -1 anim bone 1.0 1.0 -1 1.0
+texture texture frame texture bone
+0.500000 0.500000 = texture = anim vertex vertex 1.0 bone frame frame 0.500000 frame 1.0 frame
+frame material frame
+1.0 texture vertex frame 1.0 frame = 0.500000 1.0
+vertex material =
+texture anim
+vertex vertex
+bone
+material frame texture 1.0
+vertex -1
+vertex texture 0.500000 bone bone anim bone material vertex 0.500000
+= anim frame bone
+vertex
+vertex
+frame frame 1.0 0.500000
+= bone -1 bone texture texture frame anim frame 1.0 -1
+texture =
+-1 -1 = bone 1.0 =
+vertex 0.500000 -1 material anim anim anim
+frame bone
+frame 1.0
+bone
+texture frame
+1.0 frame
+0.500000 bone vertex vertex anim
+frame
+texture -1
+material 1.0 vertex
+= 1.0 vertex = te
\ No newline at end of file
@@ -0,0 +1,4 @@
+material frame 0.500000
+bone texture
+0.500000 anim
+0.500000 bone anim bone material verte
\ No newline at end of file
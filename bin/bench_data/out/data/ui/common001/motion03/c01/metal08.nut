@@ -0,0 +1,22 @@
+1.0
+frame
+anim material 1.0 anim
+0.500000
+-1 anim
+anim vertex
+texture frame texture 0.500000 vertex -1 frame material material anim anim material
+material vertex -1
+-1 anim = anim =
+1.0 bone -1 material material -1
+anim texture vertex bone material bone texture
+-1 0.500000
+= material = -1 material
+= texture
+frame 1.0
+0.500000
+vertex material vertex = vertex =
+texture anim frame vertex -1
+1.0 vertex anim anim bone -1
+0.500000 1.0
+frame 1.0 -1 texture
+texture
\ No newline at end of file
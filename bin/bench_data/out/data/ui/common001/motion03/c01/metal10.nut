@@ -0,0 +1,3 @@
+texture
+material = 1.0 bone -1
+vertex 1
\ No newline at end of file
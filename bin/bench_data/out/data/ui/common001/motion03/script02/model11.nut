@@ -0,0 +1,9 @@
+material
+vertex material bone texture -1
+texture
+= material 0.500000 0.500000
+texture texture anim 1.0 texture 0.500000 = material -1 -1 material anim material
+vertex anim
+1.0 -1 = 1.0 anim vertex
+-1
+0.500000 vertex material texture b
\ No newline at end of file
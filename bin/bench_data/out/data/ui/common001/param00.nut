@@ -0,0 +1,369 @@
+-1 -1
+frame anim bone 0.500000 vertex = material -1 material 1.0 -1 material 0.500000 anim anim material frame
+frame 0.500000 material anim
+frame anim
+= anim -1 bone material bone
+material = anim texture frame 1.0 -1
+bone = material vertex
+-1 bone -1 1.0 anim
+vertex
+frame
+= bone
+0.500000 0.500000 material = material = =
+material
+-1 texture
+1.0 vertex -1 1.0 bone
+anim
+texture
+=
+0.500000 texture vertex 1.0
+1.0
+0.500000 texture 1.0
+material vertex
+material material =
+1.0 material anim frame = material vertex bone texture -1 texture
+0.500000
+1.0 =
+bone 1.0
+anim
+-1
+frame frame 0.500000
+texture
+vertex 0.500000 bone vertex -1 anim frame 0.500000 1.0 1.0 texture
+0.500000 texture -1
+= vertex =
+= material vertex -1
+-1 bone material texture
+texture 0.500000 0.500000 anim
+0.500000 material vertex texture = anim anim -1
+texture texture anim bone vertex -1 bone bone material material material texture bone 0.500000
+0.500000 frame anim bone 1.0 frame 1.0 0.500000 texture
+= vertex
+1.0 vertex = anim
+vertex 1.0 texture vertex = vertex = material
+1.0 bone anim anim
+anim texture texture anim bone bone 1.0
+= vertex anim texture =
+vertex bone frame material texture texture vertex
+bone 1.0
+frame frame
+texture -1 texture texture 0.500000 anim 0.500000 anim material -1
+material vertex frame frame -1 1.0
+frame
+vertex material bone 1.0 -1 anim 1.0 texture 0.500000 material
+1.0 -1 -1
+= texture 1.0 frame
+-1
+frame frame bone
+bone 1.0 0.500000 bone frame = -1 -1 material =
+frame bone texture 0.500000
+frame
+anim = texture -1 vertex -1 0.500000 0.500000 texture vertex 0.500000 -1 material bone
+1.0
+= 1.0 -1 =
+frame frame material = texture bone bone anim 1.0 anim vertex frame
+=
+1.0 = -1 texture 1.0 0.500000
+anim texture = anim texture 0.500000
+-1 material anim -1 texture texture bone
+=
+vertex
+0.500000 vertex material 0.500000
+vertex -1 = = = vertex =
+bone
+vertex
+material material texture -1
+vertex anim
+1.0 1.0 = -1 0.500000 1.0 -1 material
+-1 1.0 1.0 vertex
+= = anim -1 anim
+material texture = 1.0 -1 -1 material frame 1.0 material -1 bone
+material
+1.0 anim
+frame frame
+0.500000 0.500000 bone
+0.500000 -1 vertex frame
+texture bone 0.500000 bone texture frame
+texture frame = frame texture anim vertex =
+bone
+vertex =
+bone -1
+vertex 0.500000 bone anim
+texture material
+frame =
+1.0 material frame
+bone texture frame material material
+1.0
+anim texture
+texture
+-1 anim =
+texture 1.0 = bone bone vertex texture
+vertex = material
+1.0 1.0 = texture 1.0 bone = frame bone frame bone
+0.500000 texture 0.500000 bone frame 1.0 material bone =
+0.500000 texture =
+= frame
+0.500000 vertex
+texture frame 1.0
+anim frame -1 material
+anim 0.500000 anim material bone 0.500000 texture anim
+vertex
+=
+= frame anim anim frame bone = 0.500000
+material 0.500000
+anim bone
+frame 1.0 1.0 -1
+frame
+material bone texture =
+=
+vertex bone anim 0.500000
+bone -1 bone -1 anim
+-1 -1 bone frame -1
+0.500000 -1 material = 0.500000 0.500000 bone -1
+-1 -1 material 1.0 bone vertex material texture
+-1
+0.500000 = frame texture 0.500000 anim anim bone
+= material anim
+-1 vertex 0.500000 anim 1.0 -1 anim texture vertex frame bone
+vertex
+texture anim
+frame texture bone -1 material anim
+texture 0.500000 =
+anim
+vertex 1.0 material
+texture
+-1 anim
+0.500000 material material 0.500000
+1.0 texture bone anim material 1.0 bone
+-1 -1
+bone
+= 1.0
+vertex
+= bone material material texture = texture texture 1.0
+bone material
+frame
+-1
+bone
+bone frame material texture vertex vertex bone
+texture 0.500000 texture bone = -1
+material
+0.500000 frame vertex
+-1 anim
+material bone bone
+bone -1
+0.500000 = texture anim -1
+= texture =
+texture anim material material
+vertex texture 0.500000 texture texture
+texture material texture frame bone texture
+frame anim bone material 1.0
+frame -1 -1 1.0 vertex -1
+frame bone = -1
+vertex texture anim anim
+0.500000
+=
+=
+anim = material 1.0 1.0 material vertex anim vertex -1 texture 0.500000
+material
+texture
+-1 -1
+1.0 material
+anim bone 0.500000 = texture anim material bone = anim
+material 0.500000
+material anim material 1.0 bone
+0.500000 bone material
+frame texture vertex
+= 1.0 anim vertex
+-1
+-1 anim texture frame material anim frame material vertex frame -1 anim =
+=
+anim 1.0
+= = 1.0
+texture vertex 1.0 vertex = bone material = vertex
+material
+vertex 1.0
+texture texture
+1.0 material vertex anim
+frame
+-1 vertex frame texture -1 frame
+texture
+texture vertex
+-1 1.0 -1 -1 = 0.500000 texture vertex =
+texture 1.0 =
+bone frame -1 bone 1.0 bone 0.500000
+bone -1
+0.500000 material anim 0.500000 1.0 texture -1 = 1.0 0.500000 = anim
+0.500000 material material material
+1.0 anim
+texture bone frame bone
+bone
+anim 1.0 frame bone
+1.0 anim
+bone material 0.500000
+anim
+1.0 anim anim anim = frame material anim vertex frame -1
+0.500000
+vertex material 0.500000 frame material
+texture anim 0.500000 = =
+0.500000
+-1 bone = vertex bone texture
+material texture
+texture -1
+bone 1.0
+0.500000 1.0 1.0 anim vertex
+1.0 frame material bone
+= 0.500000 = vertex
+-1 -1 anim =
+-1 texture vertex bone frame
+0.500000 frame =
+-1 = frame = bone 1.0 bone anim
+anim -1 1.0
+= = vertex
+vertex 1.0 -1 material vertex frame
+material -1 anim
+frame frame frame
+vertex = 1.0 bone -1 -1
+frame texture
+= texture 1.0
+-1 material frame anim anim frame 1.0
+frame = 1.0 = texture
+0.500000 frame = 1.0 1.0 vertex bone material texture = vertex material
+texture vertex = bone anim
+vertex
+1.0 bone
+material 0.500000 anim material texture material material texture anim 0.500000 1.0
+anim 1.0 0.500000 1.0 vertex =
+anim material
+material vertex 1.0
+= texture
+= -1 texture
+frame vertex bone
+anim vertex texture
+vertex texture 0.500000 1.0 anim 0.500000 material
+anim anim bone -1 0.500000 1.0 anim
+bone
+material vertex anim
+vertex = 1.0
+-1 anim vertex anim
+-1 1.0
+anim 0.500000 = anim
+bone
+frame bone 1.0 material
+vertex
+bone vertex bone material
+anim texture texture vertex anim
+1.0
+bone -1
+frame vertex frame vertex = 1.0
+anim 0.500000
+= material vertex anim
+-1 0.500000 -1 0.500000 vertex 0.500000 anim bone
+= vertex
+anim frame
+material = bone 0.500000 material
+vertex 1.0 material -1
+-1 1.0 -1 vertex
+frame
+1.0 -1 =
+-1
+= vertex = 1.0 vertex material texture
+anim
+texture
+1.0 texture texture
+1.0 material
+anim -1
+texture
+0.500000 anim material frame 0.500000 0.500000 vertex frame 1.0
+bone -1 frame texture
+material bone texture
+vertex
+1.0 material -1 0.500000 1.0 1.0 bone =
+frame 1.0 0.500000
+vertex -1 frame =
+1.0
+frame
+material vertex bone -1 1.0 -1
+-1 1.0 1.0 = frame vertex bone
+-1 -1 = material vertex anim 0.500000
+texture = material
+= 0.500000 =
+material anim 1.0 vertex
+vertex 1.0 frame material bone
+= frame
+-1 frame anim
+-1 anim
+texture bone anim material material anim anim 0.500000 material
+-1 0.500000
+0.500000
+frame -1 = = frame
+= bone vertex = frame
+0.500000 0.500000
+material
+0.500000
+1.0
+= -1 1.0 bone
+=
+bone
+vertex
+frame -1
+texture
+vertex vertex =
+frame material
+0.500000 -1 bone vertex
+material
+0.500000 vertex
+texture 1.0 -1 =
+material bone
+anim
+bone texture 1.0
+=
+anim -1 -1 0.500000 -1 bone 0.500000 texture -1
+-1
+anim material
+frame 0.500000 1.0 -1 texture
+material -1
+0.500000 bone material
+-1 1.0 material texture
+bone 0.500000 anim anim anim 1.0 texture -1 texture = 1.0 -1
+0.500000 vertex
+anim 0.500000 material = texture
+bone vertex
+0.500000 anim = texture
+1.0
+-1
+bone anim frame bone 1.0 1.0 -1 vertex
+= vertex texture =
+anim material frame material
+-1 -1 -1 0.500000 0.500000 texture vertex 0.500000
+vertex
+= bone 0.500000 vertex vertex 1.0
+=
+0.500000
+material vertex
+bone
+-1 frame = frame
+anim anim anim anim material bone
+vertex 0.500000
+material
+=
+1.0 bone bone
+anim material
+frame
+anim bone = bone anim bone 1.0
+-1
+-1 bone bone
+-1 -1 0.500000 texture material
+frame
+vertex bone texture vertex anim 0.500000 anim 0.500000 -1
+texture texture anim anim texture 1.0 1.0 -1 material
+bone material bone material = 1.0 texture bone anim vertex
+texture frame material
+frame 0.500000 0.500000
+bone
+= anim texture texture anim texture 1.0
+-1 texture 1.0 texture = 1.0 0.500000 frame vertex anim frame
+bone
+texture -1
+texture -1 frame vertex -1 texture 1.0 anim texture
+-1
+1
\ No newline at end of file
@@ -0,0 +1,22 @@
+frame frame bone material
+= frame -1 -1 0.500000 anim 0.500000 bone texture frame texture
+material texture frame = texture texture frame vertex = material bone frame bone anim -1 1.0 0.500000
+1.0 frame 0.500000 frame
+-1 frame
+frame vertex
+vertex texture 1.0 bone
+= anim
+anim
+bone = material
+-1 texture -1 0.500000 -1
+anim =
+texture -1 -1 -1 1.0 material
+vertex
+vertex frame 0.500000 0.500000
+anim 0.500000 anim texture material
+=
+anim -1 0.500000 frame -1 texture
+material
+= -1 texture 0.500000 0.500000 frame material bone frame
+= texture frame
+0.500000
\ No newline at end of file
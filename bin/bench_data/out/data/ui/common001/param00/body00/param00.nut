@@ -0,0 +1,4 @@
+-1 vertex frame anim frame anim
+1.0
+bone = = anim 0.500000 1.0
+frame
\ No newline at end of file
@@ -0,0 +1,184 @@
+1.0
+texture
+texture anim
+= vertex texture
+=
+0.500000 1.0 bone 1.0 1.0 0.500000
+0.500000 -1 anim 1.0 anim
+material frame 0.500000
+= frame
+= anim -1 1.0 anim
+anim 1.0
+texture -1 -1 frame
+vertex = 0.500000
+frame anim
+texture = anim
+material
+vertex 1.0 texture anim bone
+vertex = 1.0
+material anim
+bone frame vertex = vertex
+material -1 bone =
+texture material
+vertex
+frame = -1 = vertex material 0.500000 material 1.0 -1 = texture
+texture bone
+anim = anim frame bone 1.0
+material
+bone material 0.500000 material
+bone texture = 1.0
+0.500000 0.500000 1.0 vertex frame frame frame = anim frame anim =
+vertex
+1.0 0.500000
+0.500000 0.500000 bone = bone 0.500000
+-1 material
+vertex = -1
+bone vertex
+material material
+vertex 1.0 material
+= 1.0
+texture bone 0.500000 0.500000 vertex -1 -1 texture
+material bone
+vertex 0.500000 vertex frame
+frame
+bone
+texture vertex 0.500000 0.500000 texture -1
+anim 1.0
+0.500000
+= vertex 0.500000 -1
+1.0 anim -1
+0.500000
+-1 = vertex 0.500000 bone vertex 0.500000 vertex vertex
+material
+bone vertex
+0.500000 -1 frame anim
+1.0 = vertex 1.0 0.500000
+material
+bone 1.0 -1 texture frame 0.500000 bone
+= anim anim bone
+anim
+vertex vertex = anim
+anim -1 bone bone 0.500000 1.0
+-1 texture 1.0
+anim 0.500000 material = anim 1.0
+anim 0.500000 bone -1 anim
+bone anim material 0.500000 0.500000 1.0 0.500000 bone frame
+bone
+=
+anim texture bone
+material = 0.500000 vertex bone vertex anim vertex anim 0.500000
+= bone 0.500000 = -1
+0.500000 = bone bone = 0.500000 1.0 0.500000 texture
+texture = 1.0 material
+frame
+-1
+frame bone texture
+texture 0.500000
+vertex
+=
+bone anim vertex
+-1 material texture anim
+material 1.0 texture bone -1 = frame
+bone
+frame 1.0 -1 0.500000 = texture
+= -1 material anim anim
+vertex frame vertex anim
+-1
+frame
+bone bone material -1 0.500000 0.500000 texture texture
+material bone
+1.0 bone texture
+anim -1 vertex
+texture anim
+bone = = frame frame texture
+0.500000 0.500000 -1
+vertex
+texture = material material material vertex texture material
+bone 0.500000 material
+-1 -1 -1
+0.500000 0.500000 -1 anim 0.500000 1.0 bone = 1.0 1.0 bone
+-1 anim material
+bone bone texture 1.0
+frame
+bone frame vertex vertex anim material frame 0.500000 1.0 0.500000 anim frame material frame bone 0.500000
+frame 1.0 texture 1.0 bone 0.500000 vertex bone texture -1 material 0.500000 1.0 vertex
+anim
+bone
+anim texture anim texture =
+frame material =
+material
+anim
+1.0 -1 texture = = frame = 1.0
+frame anim
+vertex frame anim material texture anim
+texture frame 0.500000 bone material anim 1.0 vertex texture 1.0 frame
+anim anim
+vertex bone bone anim bone 0.500000 0.500000 0.500000 0.500000 frame texture texture vertex texture anim frame
+1.0 vertex vertex vertex
+-1 -1 1.0
+1.0 material
+anim = texture texture -1 bone anim
+material
+bone vertex vertex texture material
+bone material 0.500000 texture vertex frame 0.500000 anim material =
+vertex
+= vertex
+texture bone 1.0 bone vertex = material vertex
+anim
+-1
+anim material vertex 1.0
+frame texture anim
+anim anim bone material material 1.0
+anim vertex vertex
+texture 1.0 material -1 bone material
+1.0 -1
+0.500000
+anim texture
+bone material 0.500000 anim bone material 1.0 vertex anim 1.0 frame frame
+vertex texture -1 bone bone
+texture texture = bone 0.500000
+=
+1.0 1.0 = 0.500000 frame
+vertex frame
+= bone
+material frame
+-1
+0.500000 anim 0.500000
+anim 1.0 bone 1.0 texture texture vertex bone anim anim bone texture -1
+material
+1.0 material = 0.500000 1.0 vertex
+texture
+texture vertex -1 texture material anim frame
+material vertex vertex
+texture material anim bone 1.0 texture -1
+material
+bone -1 texture vertex texture frame
+material
+1.0
+-1 anim -1 vertex
+anim bone
+-1 1.0 0.500000 = texture
+vertex
+material anim -1 = =
+frame
+frame vertex -1 -1 anim
+0.500000 0.500000
+material
+-1
+texture material frame
+1.0 -1 1.0 frame
+material material
+material -1 = texture
+texture 0.500000 0.500000
+material texture material bone anim frame
+1.0 1.0 bone
+material 0.500000 anim 0.500000 material vertex =
+-1
+vertex vertex = -1 vertex texture bone vertex 1.0
+frame vertex material 1.0
+1.0 =
+vertex 0.500000 vertex
+material frame texture
+anim = 0.500000 material bone -1 anim
+0.500000
+frame material 0.500000 tex
\ No newline at end of file
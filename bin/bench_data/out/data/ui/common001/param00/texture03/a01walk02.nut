@@ -0,0 +1,363 @@
+material -1 anim material
+material 0.500000
+vertex = bone
+1.0 1.0
+anim bone frame anim 0.500000
+anim =
+bone vertex -1
+vertex
+-1 = 1.0
+material frame frame -1 0.500000 -1 bone =
+anim bone vertex -1 bone anim anim 1.0
+=
+anim -1 = 0.500000
+frame 0.500000 material
+vertex vertex bone
+material texture frame
+bone texture anim =
+anim 0.500000 texture
+0.500000 = frame
+frame bone
+0.500000 texture -1 anim frame texture = bone
+vertex
+vertex texture
+material 1.0 1.0 texture -1 1.0
+anim
+anim
+1.0 =
+bone frame
+-1 -1 bone
+0.500000 texture frame -1 0.500000 1.0 0.500000 0.500000 1.0 anim
+1.0 vertex -1 material texture texture 1.0 = 1.0 1.0 1.0 frame 0.500000 =
+bone vertex = anim
+1.0 frame -1 texture texture material vertex frame
+texture
+frame = anim material 0.500000 = bone = vertex
+bone -1 -1 material
+bone
+=
+material anim bone =
+material vertex bone
+1.0
+frame
+1.0 material = texture anim 0.500000 material
+1.0 material -1 frame vertex =
+bone -1 bone
+texture vertex 1.0
+-1 vertex vertex
+anim 1.0 bone
+-1
+material texture bone
+-1 texture -1 material vertex
+texture 1.0
+-1
+frame material
+frame 0.500000 =
+-1 texture
+frame bone
+= texture = frame
+1.0
+= material material anim
+-1
+frame
+=
+= vertex vertex anim 1.0 anim = texture vertex frame
+-1
+-1 1.0
+= anim
+vertex
+-1 material = 0.500000 bone
+0.500000 = -1
+material frame
+frame -1 bone
+1.0
+bone 1.0 -1
+1.0
+anim
+anim texture bone 0.500000
+-1
+= -1 0.500000 bone
+1.0 -1
+texture 0.500000 1.0 vertex 1.0
+vertex
+vertex vertex -1 bone 0.500000 material
+0.500000 = -1
+material -1 1.0
+vertex anim = material
+frame
+vertex texture texture texture 0.500000 1.0 0.500000 texture anim
+material
+1.0 bone material vertex
+1.0 = frame 1.0 0.500000 anim -1 anim 0.500000
+material anim -1
+1.0 material vertex 1.0
+bone = =
+vertex -1 bone vertex
+bone
+0.500000 -1 0.500000 0.500000 1.0 -1 anim vertex frame 1.0 bone 0.500000 texture vertex 1.0 frame texture -1 frame texture
+frame
+anim
+1.0 0.500000
+bone
+0.500000 material vertex
+0.500000 = anim
+material vertex -1 bone 1.0 frame texture
+texture bone 0.500000 frame
+0.500000 -1 anim vertex anim 1.0 material frame vertex frame 0.500000 1.0
+frame
+material 1.0 texture 0.500000
+material bone texture bone
+vertex
+1.0
+= 1.0 vertex material frame texture
+material anim frame 0.500000 vertex
+= bone 1.0 = -1 0.500000 anim
+texture -1 0.500000
+0.500000
+1.0 -1 vertex 1.0 0.500000 0.500000 1.0 material bone vertex 1.0
+-1 anim material
+0.500000 texture
+anim
+0.500000 material bone
+bone
+frame frame -1 frame vertex =
+frame
+material texture -1
+vertex 1.0
+vertex
+material material vertex vertex
+= =
+1.0 anim 1.0 =
+1.0 0.500000 vertex
+= frame frame = vertex vertex 0.500000 vertex vertex bone
+=
+-1
+anim
+= =
+bone bone
+anim anim anim vertex -1 frame 0.500000 -1
+anim anim 1.0 vertex -1
+0.500000 = -1 = 0.500000 material
+vertex
+texture
+1.0 =
+texture 1.0 -1 1.0 material frame anim
+0.500000 material material 0.500000 material 1.0 1.0 bone -1 frame anim bone frame -1 -1 1.0 vertex 0.500000
+vertex = bone -1 vertex = frame =
+-1
+bone -1 1.0 1.0 0.500000 =
+1.0
+vertex vertex -1 -1 frame frame texture vertex vertex bone vertex = -1 =
+1.0
+anim
+= anim
+texture
+bone 1.0 bone = material 1.0
+1.0 texture 0.500000 -1 frame frame anim
+frame texture anim = anim 1.0 = frame -1 1.0 0.500000 frame texture
+0.500000 bone texture 0.500000 frame material 0.500000 =
+anim material material frame bone =
+0.500000 anim anim 1.0 -1 1.0 bone 1.0 material
+-1
+frame = vertex
+1.0 anim bone vertex material material material 0.500000 0.500000 anim
+vertex
+= bone frame
+vertex = 1.0 bone 0.500000
+1.0 = bone material
+anim -1 frame
+vertex 0.500000 -1 bone = frame texture material vertex material texture = material anim
+frame 0.500000 = material
+= 0.500000 -1
+frame 0.500000 = anim
+bone
+anim 0.500000
+-1 1.0
+0.500000 -1
+vertex
+anim material bone material
+texture
+texture
+bone 1.0
+bone 0.500000 =
+=
+vertex
+0.500000
+frame material
+1.0
+frame anim
+texture -1
+frame
+vertex texture = frame material vertex
+material texture 0.500000 bone texture 0.500000
+texture bone bone
+bone
+material =
+0.500000
+0.500000 vertex
+= frame frame anim
+=
+vertex
+bone texture frame 1.0 vertex 0.500000 0.500000 bone
+texture bone
+texture 0.500000
+bone
+1.0 vertex frame vertex vertex bone = -1
+1.0 material anim 0.500000
+bone texture frame 0.500000
+-1 = vertex material -1 bone
+= vertex frame
+material texture material
+anim material
+texture 1.0 -1 anim material = bone
+material bone texture 0.500000 1.0
+material 0.500000 material
+vertex = bone =
+1.0
+0.500000 -1
+texture vertex
+0.500000 1.0 -1 0.500000
+texture frame bone frame vertex =
+1.0 vertex -1 -1 1.0 0.500000 texture
+= bone bone material = 1.0 bone
+texture
+-1 -1 anim anim bone frame bone vertex
+1.0 -1 -1 bone
+bone
+1.0 =
+1.0 vertex 1.0
+frame vertex texture -1
+-1 frame 1.0 material
+anim
+vertex texture bone
+0.500000 material -1
+frame 1.0
+1.0
+texture anim -1 vertex anim -1 material anim
+texture 0.500000 frame material texture = -1
+texture -1 0.500000 = texture material bone texture 0.500000 0.500000
+0.500000 texture
+1.0 vertex material bone 1.0 bone bone
+anim 0.500000 bone
+frame 1.0 =
+bone frame
+texture
+texture
+bone
+= 0.500000 bone texture texture anim
+= frame = anim bone
+frame bone
+vertex vertex bone = texture material material
+-1 texture texture -1 1.0 frame
+-1 frame
+bone texture 1.0 texture
+texture anim material
+-1 0.500000 anim -1
+-1
+texture material
+vertex -1 1.0 frame bone
+frame 1.0 texture 0.500000
+-1 frame bone texture
+frame 0.500000 =
+bone anim 0.500000 bone
+texture material bone bone 0.500000 -1 0.500000 bone
+texture bone vertex 1.0 frame = vertex = frame anim 0.500000 anim
+frame texture anim frame 1.0 anim = bone
+texture bone -1 vertex material -1
+0.500000 -1 1.0
+material texture
+texture
+bone frame
+anim texture -1 anim
+anim anim
+vertex frame material frame = =
+1.0
+texture 0.500000
+0.500000 0.500000 anim -1 material
+frame bone 0.500000 anim bone bone -1 -1 anim texture 1.0 texture -1 vertex = 0.500000
+vertex 1.0 1.0
+vertex 1.0
+-1 anim
+=
+= 1.0
+0.500000 0.500000 material
+material anim material material
+frame
+texture texture
+vertex
+bone
+0.500000
+bone -1 1.0
+texture texture frame frame texture frame anim -1 vertex = = texture anim bone bone frame bone -1 = 0.500000 anim
+= material
+-1 1.0
+vertex
+anim texture
+texture
+frame bone
+0.500000 material
+1.0 1.0 material
+bone
+vertex
+anim frame frame material frame bone = = -1 texture vertex anim material bone
+-1 texture
+1.0
+anim = = vertex
+1.0 1.0 anim vertex -1 material texture = bone vertex texture 0.500000
+vertex texture frame texture 1.0 material 1.0
+bone
+texture 1.0
+anim
+anim
+material bone
+frame 1.0
+bone frame
+anim 1.0 = frame -1
+1.0 1.0 material material -1
+vertex -1
+-1 frame -1 -1 anim 1.0
+bone texture -1 vertex 1.0 frame = material anim frame texture 0.500000 texture = texture 1.0 anim vertex
+= 1.0 texture vertex bone 0.500000 material -1 -1 anim -1
+=
+bone = bone = texture material vertex texture = frame anim 1.0 -1 0.500000 texture
+1.0
+vertex
+= texture vertex = vertex anim 0.500000 1.0 -1 1.0
+material = vertex = bone vertex bone
+anim
+material 0.500000 = frame 1.0 texture 1.0 -1 anim
+frame material -1 =
+= 1.0
+= -1
+texture
+anim
+texture
+1.0 anim
+bone
+frame vertex material frame
+vertex bone
+= 0.500000 vertex material
+vertex 0.500000 -1 material
+=
+1.0
+bone texture material bone
+bone =
+material
+-1
+texture 1.0 = 1.0 material material 1.0 bone frame 1.0 vertex 0.500000 vertex 1.0 material
+material
+anim =
+texture
+bone texture bone texture frame = frame -1 =
+frame bone
+material 0.500000 material -1 frame material 1.0
+bone
+-1
+vertex
+frame vertex
+bone = material vertex texture
+bone material = texture
+-1
+bone texture anim anim bone 1.0 1.0 0.500000 bone = vertex vertex frame
+= anim
+0.500000 anim frame
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 0.500000
+-1 frame material bone bone -1
+0.500000 0.500000 frame bone = frame = bone bone
+anim vertex frame = frame frame
\ No newline at end of file
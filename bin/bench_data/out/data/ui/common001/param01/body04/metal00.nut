@@ -0,0 +1,80 @@
+texture
+= 1.0 -1 -1
+bone bone
+vertex vertex bone = -1 =
+frame frame
+anim material anim texture anim
+vertex
+bone
+0.500000 -1 bone texture
+1.0
+texture
+frame
+0.500000 =
+material
+bone texture vertex 0.500000 vertex frame
+= material = 1.0
+-1 0.500000 texture
+vertex 0.500000 bone
+frame
+0.500000 frame
+anim
+anim bone
+bone anim bone
+1.0 vertex vertex frame texture
+1.0 material = 1.0 vertex 0.500000 bone bone 0.500000
+frame bone vertex
+bone
+0.500000
+material -1 vertex
+vertex material = bone
+= material
+frame anim =
+frame
+= 1.0
+0.500000 1.0 0.500000 frame
+= vertex material
+0.500000 anim material
+bone bone
+material 1.0 material vertex vertex
+texture texture vertex 0.500000 texture texture texture material 0.500000
+0.500000 0.500000 bone anim anim
+anim 1.0 bone bone 0.500000 material
+vertex
+1.0 1.0 =
+= vertex texture 0.500000 =
+bone
+1.0 =
+-1 0.500000 frame anim 0.500000
+vertex
+frame material frame -1 0.500000
+texture material
+= vertex bone 0.500000 anim
+=
+0.500000 = vertex texture
+anim vertex -1
+frame anim
+frame
+0.500000
+texture
+-1 bone vertex 1.0
+vertex frame 0.500000 material 0.500000 1.0 -1 frame bone vertex
+=
+material = texture 1.0 anim 1.0 texture anim texture texture
+bone =
+= anim anim bone material
+0.500000 1.0 texture texture = frame
+anim 0.500000
+= bone 1.0 1.0 texture 1.0 1.0 texture
+= material material anim material frame -1
+= anim
+frame anim anim -1 anim -1 vertex vertex 1.0 = -1 anim
+bone
+0.500000
+frame
+texture 0.500000 1.0 -1 1.0
+anim 1.0
+texture 1.0
+-1
+frame material
+= 
\ No newline at end of file
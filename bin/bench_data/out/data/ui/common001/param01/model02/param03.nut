@@ -0,0 +1,4 @@
+anim anim material
+0.500000 vertex
+material
+1.0 ani
\ No newline at end of file
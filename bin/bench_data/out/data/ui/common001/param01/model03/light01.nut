@@ -0,0 +1,5 @@
+frame
+= -1 0.500000 texture
+texture bone -1
+1.0 vertex material
+0.500000 vertex 1.0 0.500000 material frame texture material frame material = frame = = -1 material te
\ No newline at end of file
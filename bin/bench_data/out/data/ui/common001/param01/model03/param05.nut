@@ -0,0 +1,13 @@
+vertex = -1 1.0
+vertex bone -1 texture
+0.500000 material frame frame material 1.0 bone
+material anim
+-1 = 0.500000 0.500000 frame texture texture 0.500000 anim frame anim = anim vertex
+material -1
+bone -1 frame texture frame = material anim bone = texture
+-1 -1 bone 1.0 anim
+material -1 frame
+anim
+= material material -1 vertex
+= frame texture 0.500000
+anim 1.0 = material ani
\ No newline at end of file
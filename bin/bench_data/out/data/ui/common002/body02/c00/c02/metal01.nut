@@ -0,0 +1,4 @@
+1.0 frame = material vertex -1 material -1 bone
+frame
+bone vertex bone
+texture material mat
\ No newline at end of file
@@ -0,0 +1,16 @@
+1.0 material -1 -1
+1.0 1.0 texture
+vertex texture
+-1 vertex 0.500000
+vertex
+texture material = -1 -1
+= bone
+=
+-1 1.0 vertex
+1.0 0.500000 vertex frame anim bone texture bone anim vertex bone
+frame frame 1.0 =
+-1 frame
+frame
+bone bone
+-1 -1 0.500000 = bone 1.0 = = material material 0.500000
+0.500000 1.0 anim -1 = a
\ No newline at end of file
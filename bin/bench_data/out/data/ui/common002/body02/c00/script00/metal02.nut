@@ -0,0 +1,210 @@
+material
+bone 1.0 -1
+0.500000 vertex material =
+vertex material frame
+texture frame texture 0.500000 bone vertex 1.0 vertex texture texture anim = 0.500000
+vertex material frame bone 1.0
+bone
+texture vertex texture material material 0.500000 0.500000 anim bone 0.500000 frame 0.500000 anim frame vertex 1.0 texture =
+material texture -1
+vertex
+texture material texture -1
+= anim
+1.0 1.0
+vertex = 1.0 1.0
+material -1
+anim 0.500000 -1 texture 1.0 material
+frame = -1 0.500000 -1 bone vertex anim
+1.0 -1
+0.500000 1.0 bone 0.500000 frame = =
+0.500000
+frame anim frame
+anim
+vertex -1 texture texture
+anim material = 1.0 -1
+material
+0.500000 texture vertex
+= -1 material
+material anim frame 0.500000 texture bone 0.500000 material anim anim
+vertex anim texture anim material
+0.500000 frame material 0.500000 bone
+vertex vertex vertex =
+1.0 -1 vertex
+= =
+bone anim -1 = bone
+-1 0.500000 vertex = texture
+=
+vertex
+vertex vertex bone
+frame bone material bone
+anim anim
+frame
+texture =
+frame texture
+-1 anim texture material
+vertex
+vertex bone texture texture -1 1.0 0.500000 bone = texture vertex
+1.0 anim
+-1
+material
+frame 0.500000 vertex vertex bone material 0.500000
+0.500000
+0.500000 1.0
+1.0 frame frame 1.0 bone material -1 -1 vertex bone 0.500000 anim texture vertex
+1.0 -1 1.0 material vertex 0.500000 -1 bone 0.500000 1.0 0.500000 1.0 texture 1.0
+0.500000 material 1.0 texture frame material
+-1 0.500000
+= 1.0 anim -1
+texture vertex 0.500000 material -1 0.500000 material frame =
+bone anim -1 material
+anim texture anim
+1.0 anim bone material = -1 -1 vertex frame material 1.0 texture -1 texture anim
+1.0
+vertex bone
+vertex texture anim = vertex anim =
+bone 0.500000 bone
+= 0.500000 = texture -1 frame material
+0.500000 = -1 0.500000 = bone
+1.0 texture anim anim = texture material material bone vertex -1 material
+=
+vertex texture material 0.500000 0.500000 texture frame material
+vertex anim
+material frame anim frame -1 vertex
+1.0
+material anim
+=
+frame 1.0
+= frame bone vertex
+bone
+material 0.500000
+frame = bone
+= vertex
+bone vertex frame vertex frame 0.500000 anim 1.0
+vertex 1.0 = frame 1.0 texture
+-1 material
+-1 = bone vertex vertex anim vertex texture
+frame texture material 1.0 vertex
+1.0 bone anim
+material
+= = material
+texture vertex -1 = 0.500000 1.0
+bone
+anim texture 1.0 texture anim = frame material = 1.0 anim texture
+material vertex anim anim =
+1.0 vertex vertex
+1.0 1.0 1.0 bone
+= anim =
+anim = 1.0 -1 0.500000 vertex bone = -1
+anim
+texture 0.500000
+=
+anim frame bone frame anim bone texture =
+bone 0.500000 material 0.500000 vertex = anim 0.500000 material
+texture anim
+0.500000
+material
+1.0 bone bone
+material material anim vertex
+frame
+texture material frame vertex material bone 1.0 0.500000 vertex = texture -1
+1.0
+texture 1.0 0.500000 -1 1.0
+material
+material frame 0.500000 -1 frame
+vertex
+anim
+vertex -1 frame frame 1.0
+1.0 material texture 0.500000 frame 0.500000 = vertex anim vertex texture
+texture texture
+vertex
+0.500000
+material frame vertex
+anim =
+material
+-1 0.500000 anim anim material -1
+= frame
+material anim vertex = = bone vertex
+bone frame -1 -1 bone texture bone texture = -1 frame 1.0 bone texture
+texture texture -1 texture
+material texture material = 1.0 = bone
+1.0 texture bone
+-1 = material
+texture -1
+=
+bone vertex = 1.0 material
+bone bone frame bone
+frame anim -1
+1.0 1.0 anim 1.0
+1.0 material material -1 1.0 -1 material bone bone anim frame bone texture 1.0 1.0 anim 1.0 -1
+bone
+texture anim texture 0.500000
+1.0
+bone 0.500000
+=
+anim texture
+texture vertex frame texture frame anim 1.0 0.500000 frame vertex
+=
+0.500000 frame
+-1 = 0.500000 material
+material -1 anim
+0.500000 anim
+anim 0.500000 1.0 texture = bone =
+1.0 -1 = 0.500000
+texture =
+anim = frame material
+anim
+= frame vertex bone anim -1 anim texture
+frame
+-1 -1 = material -1 = 0.500000 frame
+anim anim = material vertex
+1.0 -1 material 1.0
+= 0.500000
+material material 0.500000 1.0 -1 = texture
+bone -1
+bone
+vertex
+frame -1 = anim = material -1 frame
+1.0 -1
+frame = -1 texture =
+vertex vertex bone = 1.0 0.500000 material
+0.500000
+-1 = -1
+texture
+= 0.500000 1.0 frame texture
+0.500000
+=
+1.0 vertex 0.500000
+0.500000 0.500000 1.0 1.0
+0.500000 0.500000 vertex bone
+frame vertex bone vertex = texture
+bone bone
+-1 texture 1.0 texture
+anim material material anim = -1 = bone -1 material vertex 1.0 texture vertex
+texture bone bone -1 vertex material
+-1 anim
+1.0 frame anim bone
+-1 bone texture -1
+0.500000
+material 0.500000 material material 0.500000 material bone texture -1 bone
+vertex
+1.0 =
+frame
+material -1 texture
+material bone anim
+texture
+= frame 0.500000 0.500000 material frame
+vertex frame vertex
+texture vertex
+frame -1 anim bone 0.500000 material 0.500000 1.0 = 1.0
+vertex
+bone material frame 1.0 texture frame material =
+0.500000 =
+frame texture 0.500000 frame
+bone 1.0
+frame -1 frame = 0.500000 0.500000 -1 =
+= -1
+vertex
+bone texture
+frame anim = frame frame frame 1.0 0.500000 1.0 texture frame 0.500000 frame material frame
+-1 vertex 0.500000
+vertex b
\ No newline at end of file
@@ -0,0 +1,48 @@
+anim texture bone = material anim
+anim
+texture anim
+bone frame frame vertex material bone texture
+material 1.0 =
+anim
+-1 vertex 1.0
+texture frame -1 0.500000 1.0 = vertex = frame -1 -1
+=
+0.500000 anim texture material material 1.0 -1 = 0.500000 vertex 1.0 vertex 1.0 texture texture 1.0 0.500000 bone anim vertex anim
+= 0.500000 anim material anim material
+bone
+1.0 -1 anim -1 0.500000 0.500000 frame frame
+vertex
+frame frame
+-1 = -1 -1 0.500000 vertex texture = 0.500000 frame vertex texture anim anim anim anim anim -1 vertex 1.0
+bone material
+-1 = texture
+frame 1.0 1.0 material
+bone
+frame
+material
+texture anim 0.500000 -1 anim frame =
+0.500000 frame anim 1.0
+texture
+bone 0.500000 vertex bone
+bone
+0.500000 frame texture vertex
+texture -1
+0.500000 texture frame
+frame vertex bone 1.0 = =
+texture
+texture
+bone bone = 1.0
+material
+vertex 1.0
+vertex bone -1 frame 1.0 vertex
+= vertex bone = = texture bone anim
+anim 0.500000
+texture 1.0 -1 material =
+vertex anim material vertex
+0.500000
+0.500000
+bone vertex anim 1.0 bone
+vertex texture -1 texture
+anim frame
+1.0
+te
\ No newline at end of file
@@ -0,0 +1,339 @@
+0.500000 texture material 1.0 texture -1
+= texture
+0.500000 anim -1 anim texture
+1.0 0.500000 = frame
+material bone anim 1.0 vertex
+anim texture
+-1 -1 anim -1 anim bone
+texture
+-1 anim
+= anim 0.500000 material 0.500000 1.0 frame texture 0.500000 = material 1.0
+1.0
+frame vertex texture vertex material texture
+-1
+material 0.500000 texture material texture anim anim vertex frame
+texture frame
+= bone = texture
+anim frame = 0.500000 texture
+material
+anim
+material frame bone 1.0
+texture material 1.0 1.0 texture
+-1
+-1 vertex vertex =
+frame 1.0
+vertex 0.500000 = material
+texture
+1.0 material frame
+vertex = texture texture material
+bone -1 =
+0.500000 material frame -1 anim 1.0 = texture frame =
+frame anim 1.0
+1.0 -1 = frame
+vertex frame texture 0.500000 texture = vertex
+-1 1.0 vertex 1.0 1.0 frame anim texture frame 1.0
+frame bone -1 0.500000
+1.0 =
+0.500000
+1.0
+= frame texture 0.500000 texture bone vertex material
+material bone frame frame
+0.500000 vertex 0.500000 -1 texture 0.500000 bone bone frame -1 frame 1.0
+material
+0.500000 vertex
+vertex texture
+frame 0.500000
+bone material frame 0.500000
+bone 1.0 anim
+1.0 -1
+1.0 = frame frame anim frame frame
+texture -1 -1 anim
+anim vertex vertex
+= 1.0
+1.0 -1 frame 0.500000
+bone texture 1.0
+material bone -1
+-1 texture vertex
+material material anim
+= texture anim bone anim -1
+vertex frame anim
+anim 0.500000
+anim vertex frame frame vertex 0.500000 1.0
+-1 bone
+texture -1 vertex texture vertex vertex
+frame anim material 0.500000
+bone -1 0.500000 material vertex -1 =
+1.0 vertex 1.0 -1 = texture anim 1.0 vertex anim texture bone material
+vertex 1.0 material texture material
+vertex
+bone
+= 1.0
+material texture -1 anim 1.0 -1
+texture
+1.0 vertex
+texture bone frame = material
+= -1 = texture 0.500000 0.500000 vertex
+-1 = anim -1 -1
+bone material material vertex texture
+material texture
+anim material anim frame
+1.0 -1 vertex 0.500000
+= frame material 0.500000 material
+bone frame
+anim = = vertex material -1 1.0 0.500000 -1
+1.0 1.0 0.500000 = bone frame anim anim vertex
+frame
+0.500000 vertex
+-1 bone
+vertex material 1.0 0.500000
+1.0
+texture anim 1.0 0.500000 1.0 frame material bone 1.0 vertex anim anim vertex
+bone anim
+bone vertex 1.0 bone
+frame vertex bone -1 bone frame
+frame
+1.0 anim bone
+texture vertex = material -1 0.500000 -1 bone anim frame
+= 0.500000 =
+anim
+material texture material
+texture -1 material
+1.0
+frame vertex
+=
+vertex
+anim bone = material
+vertex
+bone = 1.0 0.500000 bone vertex texture
+= texture frame 1.0
+texture = material 1.0
+1.0 texture bone material 1.0 0.500000 1.0
+texture
+vertex vertex -1 1.0
+-1 material anim
+anim 1.0 0.500000 0.500000 material
+anim vertex 1.0 material frame material anim bone = = frame texture material frame material anim frame
+vertex bone anim texture =
+anim frame =
+frame
+= texture 1.0 1.0 -1 texture anim bone anim
+texture bone = frame
+bone -1 material 0.500000 frame texture 0.500000 anim 0.500000 0.500000 frame
+material -1 -1 frame bone
+1.0
+vertex =
+bone vertex
+0.500000 =
+bone anim
+anim frame anim -1 -1 bone frame
+0.500000 -1 = frame 0.500000 bone 0.500000 frame 0.500000 texture anim material 0.500000 bone 1.0 -1 = anim 0.500000 1.0
+= vertex
+bone frame
+1.0 texture vertex 0.500000 1.0 frame 1.0 0.500000 frame frame frame 0.500000 anim -1 vertex 0.500000 frame
+vertex vertex
+anim
+= anim
+= bone frame
+bone 1.0 -1 texture vertex material
+-1 = 1.0 1.0 vertex 1.0 = 0.500000
+-1 anim
+texture bone
+bone material =
+bone
+= bone texture -1 texture
+1.0 vertex frame bone anim 0.500000
+1.0 texture bone -1
+texture
+material material = 1.0 bone anim frame
+bone frame 0.500000 vertex frame vertex 0.500000 vertex 0.500000
+texture vertex
+-1 anim bone
+texture material
+0.500000
+frame
+= 1.0
+bone -1
+= texture texture bone
+= vertex bone
+texture frame
+frame
+0.500000 -1 frame anim
+bone
+-1 1.0 vertex
+-1
+-1 frame vertex -1 1.0 0.500000 -1
+1.0 0.500000 material frame anim anim
+1.0
+= texture
+0.500000 vertex = 1.0 1.0 -1 texture
+0.500000 vertex vertex 1.0 = =
+-1 -1
+0.500000 material texture
+vertex
+1.0 -1
+texture
+= vertex frame bone texture
+texture anim bone -1
+-1 texture 0.500000 anim frame
+texture 0.500000 texture
+bone frame texture material
+vertex material 0.500000 -1 anim
+texture material =
+bone -1
+anim vertex
+frame material
+0.500000
+vertex
+1.0 -1 anim 1.0 anim
+1.0
+= = material 1.0 -1 vertex anim
+texture material 0.500000 bone -1 material frame frame
+= vertex
+= 0.500000
+material
+material
+bone anim
+anim material anim
+frame bone 1.0
+anim vertex anim bone 0.500000
+frame bone frame frame frame vertex
+= 1.0 -1 bone vertex bone vertex bone 0.500000 bone
+material bone 1.0
+anim = 1.0 bone texture
+1.0 -1 bone
+0.500000 bone anim -1 -1 texture material 1.0 bone
+material 0.500000 vertex texture frame = 0.500000
+bone -1 bone
+= 1.0
+= texture =
+frame =
+texture texture texture texture
+-1 texture vertex anim vertex
+=
+-1 anim
+= bone
+material
+-1 vertex 0.500000 material texture vertex
+anim anim -1 bone 1.0 vertex
+frame bone
+vertex 1.0 material
+1.0
+vertex 0.500000 0.500000 anim material -1 material
+material vertex vertex texture vertex
+frame 1.0 1.0 texture
+vertex -1 anim
+texture
+material frame
+0.500000 -1 texture -1 0.500000 1.0
+bone
+-1 anim texture texture
+texture = bone -1 bone 0.500000 material texture anim -1 1.0
+frame = -1
+material texture
+=
+texture
+0.500000 texture
+material
+vertex =
+-1 0.500000 texture texture bone
+anim anim = vertex texture 1.0
+material vertex -1
+frame 1.0
+bone 0.500000 vertex
+-1 material frame
+frame vertex anim
+= vertex frame -1
+anim bone anim texture
+-1 bone
+-1 1.0 material material
+texture 1.0 frame
+0.500000 anim bone
+texture = frame
+texture = 0.500000 -1 bone -1
+=
+material frame frame vertex -1 vertex texture = frame material bone frame bone 0.500000 bone texture material
+= -1 -1
+vertex vertex bone = = material 0.500000
+=
+vertex frame -1 0.500000 vertex = -1 -1
+1.0 1.0 anim bone vertex bone
+frame 0.500000 vertex
+bone
+0.500000
+vertex frame material 0.500000 -1 =
+material anim anim
+1.0 anim bone 1.0 material frame material vertex -1 -1 frame texture
+frame
+frame
+bone = anim texture vertex 0.500000 0.500000 =
+bone bone bone anim 1.0 =
+texture bone
+frame frame anim 0.500000 anim =
+texture bone vertex
+vertex material vertex
+texture
+-1 frame vertex = frame anim
+-1
+texture -1 = vertex texture
+bone frame anim 0.500000
+-1 0.500000 -1 texture
+vertex 1.0 0.500000
+-1 anim
+material bone bone
+texture anim
+bone 1.0 texture material
+texture material frame 0.500000
+anim vertex
+= material
+frame 1.0 vertex material texture 0.500000
+bone 0.500000
+frame bone
+= =
+material -1 -1 anim -1 bone
+material texture texture frame vertex
+anim 0.500000
+frame
+texture material
+vertex =
+0.500000 1.0
+1.0
+= -1 0.500000 1.0 1.0 0.500000
+material
+vertex anim -1 -1 material texture
+material =
+0.500000
+=
+vertex frame
+= 1.0 = 0.500000 = anim bone 1.0 texture material
+vertex anim = bone bone 1.0 bone 1.0 vertex bone 1.0 0.500000
+material 0.500000
+anim
+vertex = texture = material vertex texture anim
+frame material = = material frame
+1.0 texture material 1.0 anim
+anim bone 1.0
+vertex
+texture anim vertex = 1.0 bone 1.0 vertex anim
+texture bone texture -1 bone
+0.500000
+0.500000 0.500000 = bone
+=
+bone -1
+1.0 texture -1 vertex anim
+bone anim 0.500000
+-1 -1 vertex -1
+-1
+=
+bone
+vertex 0.500000 anim
+1.0
+material
+= material material
+bone 0.500000 vertex 0.500000 anim material frame
+bone
+texture 1.0 material bone vertex = bone frame
+frame vertex
+1.0 =
+frame vertex bone 0.500000 material 1.0
+0.500000 bone = 1.0 bone = vertex material 0.500000
+frame vertex 1.0 bone textu
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture
+0.500000 material
+texture
+frame = material 1.0 material frame anim 0.500000 frame 0.500000 texture 0.500000 bone -1 = = material anim
+material vertex texture frame texture 0.500000
+bone 1.0 texture 1.0 frame 0.500000
+texture bon
\ No newline at end of file
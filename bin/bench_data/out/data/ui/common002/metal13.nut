@@ -0,0 +1,52 @@
+texture 1.0 -1 material texture
+bone
+texture
+anim
+texture
+texture
+=
+vertex bone texture vertex
+1.0 1.0 frame 0.500000 material material frame vertex anim frame 1.0 texture = texture
+frame frame frame
+texture vertex = bone anim texture -1 = -1 vertex bone = texture anim
+1.0 material
+anim frame texture anim 1.0
+1.0 material
+vertex bone anim
+bone texture -1 1.0 material material
+0.500000 0.500000 bone
+vertex frame 1.0 = = vertex
+bone
+frame texture vertex frame anim -1 1.0 vertex 0.500000 bone
+vertex 0.500000 anim vertex
+vertex
+texture texture =
+bone bone material -1 -1 vertex vertex bone 1.0 = vertex texture -1 material
+frame texture vertex
+material
+1.0 frame vertex =
+= 1.0
+= -1 -1 anim 0.500000 frame vertex bone -1
+-1 bone
+frame 1.0 vertex vertex
+material 0.500000 material texture texture
+bone
+vertex
+vertex -1
+vertex
+-1 -1 = material bone vertex anim texture 1.0 = 1.0 = frame bone bone texture -1 0.500000
+1.0
+material
+frame -1
+vertex
+material material
+0.500000 anim texture
+anim 0.500000 vertex 1.0 1.0
+bone -1 bone texture anim
+frame =
+bone texture frame
+bone 1.0
+texture
+frame texture texture
+0.500000
+text
\ No newline at end of file
@@ -0,0 +1,41 @@
+-1 1.0
+-1 material = vertex
+= 1.0
+= 0.500000 material bone texture 1.0 bone -1 -1 0.500000 1.0
+material -1
+anim anim -1 =
+material bone
+material 1.0
+1.0
+0.500000 1.0
+frame bone frame
+1.0 -1
+1.0 bone
+= =
+bone 1.0
+1.0
+texture frame -1 =
+frame anim
+texture vertex anim frame
+1.0 frame bone 1.0
+vertex material
+texture frame material material
+texture
+bone frame bone 1.0
+material -1 anim
+-1
+frame
+texture bone
+material -1
+= -1 = bone vertex bone
+texture = bone texture 1.0 0.500000 anim
+texture material
+material texture
+1.0 texture
+material vertex
+anim 0.500000 anim frame
+-1 material texture texture
+0.500000
+bone anim bone
+1.0
+1.0 material texture frame texture
\ No newline at end of file
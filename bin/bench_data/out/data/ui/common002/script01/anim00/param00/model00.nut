@@ -0,0 +1,3 @@
+vertex material
+frame texture anim texture 1.0 -1 texture -1 bone bone frame -1 bone bone -1 material vertex 1.0
+ma
\ No newline at end of file
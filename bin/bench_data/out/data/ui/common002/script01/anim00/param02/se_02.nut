@@ -0,0 +1,4 @@
+=
+vertex vertex frame frame
+anim 0.500000 bone = = 1.0
+bone texture 0.500000 fr
\ No newline at end of file
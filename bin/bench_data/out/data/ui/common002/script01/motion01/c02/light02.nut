@@ -0,0 +1,69 @@
+=
+texture
+=
+texture bone
+frame anim frame texture
+anim
+frame bone texture anim vertex
+frame 0.500000 material -1 =
+texture vertex = material anim
+1.0 texture material material anim
+0.500000 anim frame material = anim material -1
+texture
+frame
+frame
+material vertex
+frame anim vertex 1.0 frame
+material
+material material = anim vertex texture
+anim -1 material frame 0.500000 texture 1.0
+texture material =
+vertex texture = material -1 frame bone
+0.500000 bone
+material
+texture
+material
+= material material
+bone material
+bone = material frame
+frame
+texture 1.0 vertex 1.0
+bone frame bone =
+anim material vertex anim
+-1 = bone
+frame 0.500000 bone bone vertex
+bone anim material texture =
+= anim 0.500000
+0.500000 material =
+texture
+anim vertex
+frame 0.500000 texture bone
+bone anim 0.500000 0.500000 frame
+vertex = frame
+0.500000
+1.0
+bone 0.500000
+0.500000
+bone vertex bone texture =
+texture frame texture -1 texture
+vertex 0.500000 1.0 frame -1 anim
+1.0
+vertex 0.500000 frame
+material 1.0
+=
+texture
+bone -1 = texture
+material
+= vertex
+=
+material 1.0 0.500000
+bone
+-1
+frame 0.500000 vertex vertex =
+0.500000 frame
+texture anim texture frame anim =
+= =
+vertex 0.500000 = anim frame 0.500000 0.500000 = = bone
+material vertex -1
+anim
+-1 -1 material texture frame anim -1 1.0 
\ No newline at end of file
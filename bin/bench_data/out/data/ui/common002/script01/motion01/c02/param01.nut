@@ -0,0 +1,44 @@
+frame
+bone 0.500000 = = 1.0
+vertex
+= 1.0
+0.500000 texture vertex texture
+1.0 0.500000 material 1.0
+vertex texture
+0.500000 vertex
+frame
+frame
+= = 1.0 =
+material texture texture material vertex
+material 1.0 anim
+frame bone texture = = = bone texture 1.0 1.0
+texture texture bone -1
+texture frame vertex bone texture anim 0.500000 0.500000 bone 1.0 bone anim frame = texture frame frame texture
+1.0 anim 1.0 vertex 0.500000 bone
+=
+1.0 frame
+=
+-1 bone texture 0.500000 1.0 bone 0.500000 0.500000 bone material frame 0.500000 -1 frame = bone -1
+material -1 material bone bone
+0.500000 anim 1.0
+anim anim 0.500000 0.500000 frame = texture anim anim
+-1 material
+material vertex -1 1.0 material 0.500000
+0.500000 bone = vertex 1.0 vertex 0.500000
+1.0 -1
+material
+anim texture bone vertex
+anim frame -1
+texture frame
+bone = 1.0 -1
+material =
+texture anim
+anim material 1.0 1.0 = 1.0
+frame
+anim
+material bone bone 1.0 -1 anim
+vertex
+= material anim vertex material
+= 1.0 = anim = material texture
+bone 1.0 -1
+mat
\ No newline at end of file
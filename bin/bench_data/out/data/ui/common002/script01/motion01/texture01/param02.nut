@@ -0,0 +1,4 @@
+0.500000
+0.500000 0.500000 frame
+bone = -1 1.0 vertex 0.500000 texture
+1.0 = vertex anim 0.500000 bone = bone 
\ No newline at end of file
@@ -0,0 +1,13 @@
+0.500000 1.0 anim 0.500000 0.500000 material anim 1.0
+anim 1.0 frame 0.500000 vertex
+vertex bone
+0.500000 frame material
+-1
+anim 0.500000
+0.500000
+1.0 -1 frame
+frame -1 frame vertex material 0.500000 bone 0.500000
+anim bone frame anim
+vertex anim 0.500000 bone bone vertex frame texture
+bone frame texture bone -1
+mater
\ No newline at end of file
@@ -0,0 +1,331 @@
+anim material -1 texture -1 -1 0.500000 1.0 0.500000
+0.500000
+anim -1 vertex bone
+anim frame
+0.500000
+bone = -1 material
+bone =
+vertex 0.500000
+anim anim vertex frame vertex 0.500000 anim
+texture
+texture material
+frame
+anim vertex
+texture texture anim 1.0 -1
+frame vertex 0.500000 -1 = material anim -1
+1.0
+frame =
+anim frame anim texture -1 vertex bone texture 1.0 vertex 1.0 1.0 material -1 1.0
+frame texture material = material =
+vertex frame anim anim vertex
+material material texture vertex -1 vertex anim anim bone = -1
+-1 0.500000 anim
+0.500000 =
+anim material
+vertex vertex texture 0.500000
+1.0
+0.500000 material =
+vertex = = frame frame 1.0 1.0 -1 texture bone 1.0 material =
+texture bone
+bone 1.0
+frame 1.0 material texture frame 0.500000 vertex bone
+material
+-1
+material
+-1
+material vertex 0.500000
+0.500000
+texture
+texture 1.0 material
+vertex vertex bone 0.500000 =
+= frame
+anim anim texture 0.500000 texture
+0.500000 bone frame 0.500000
+vertex
+frame bone material frame 1.0 vertex -1
+texture = frame
+anim -1 1.0 bone
+1.0 1.0 texture anim
+=
+= -1 anim anim 0.500000 anim texture
+vertex
+texture
+0.500000 0.500000 vertex = 0.500000
+= material material = anim vertex 1.0 bone
+bone
+texture
+frame
+anim 0.500000
+anim =
+material
+0.500000
+vertex anim texture material material vertex vertex bone -1
+= bone bone anim 0.500000
+-1 material
+0.500000 0.500000 0.500000 -1
+material
+frame
+-1 vertex frame vertex
+anim texture = bone
+anim material
+frame vertex anim frame
+= -1 material
+material 1.0 anim vertex frame 1.0 material = 0.500000 0.500000 frame texture texture
+bone frame frame
+bone frame anim
+anim 0.500000
+0.500000 vertex = bone 0.500000 1.0 anim
+0.500000 frame
+frame anim texture vertex anim texture
+frame frame
+-1 bone 0.500000 vertex
+0.500000 anim -1
+frame
+= bone bone
+anim anim
+1.0 bone texture
+0.500000 = texture
+bone anim anim bone anim 0.500000
+bone 1.0 texture
+texture vertex
+bone 1.0 -1
+-1 1.0 0.500000
+0.500000 -1 -1 = bone
+-1 anim =
+texture 0.500000
+1.0 vertex
+vertex = -1 bone vertex
+-1 texture vertex
+0.500000 material
+-1
+vertex -1 texture -1 bone
+anim
+frame
+material
+anim
+material
+vertex 1.0 = frame material bone -1 anim
+bone = texture 0.500000 1.0
+=
+= 0.500000 anim
+vertex = texture
+-1 = =
+= frame
+vertex
+-1
+texture frame vertex
+0.500000 vertex texture
+material texture =
+texture -1 =
+=
+vertex frame -1
+0.500000 texture frame vertex -1
+1.0
+bone
+1.0
+-1 vertex anim
+anim vertex -1 = texture 1.0 1.0 anim 1.0 vertex anim anim anim
+anim = -1 material
+anim 1.0 -1 0.500000 -1 bone
+material
+texture 0.500000 = anim vertex 1.0 bone material
+frame
+=
+material
+0.500000
+material
+frame
+frame frame frame material
+0.500000 1.0 anim 1.0 1.0 bone material
+anim frame 0.500000 0.500000 1.0
+= =
+anim 1.0 vertex 0.500000 frame texture
+1.0 material vertex
+1.0
+= 0.500000 frame vertex
+bone vertex texture anim
+=
+0.500000 vertex 1.0
+texture 1.0 material texture bone
+frame frame -1 0.500000
+material frame vertex -1
+vertex
+bone 0.500000
+bone 1.0 = bone vertex
+-1 = 1.0 1.0 -1
+texture bone bone anim material
+frame
+frame 0.500000
+0.500000 anim = anim texture 1.0
+= frame texture
+= bone vertex = frame anim
+bone texture = vertex
+anim material texture frame material vertex material frame
+material 1.0
+anim
+0.500000 bone frame 0.500000 bone texture vertex = 0.500000 1.0 texture
+0.500000 = frame material vertex = frame
+texture texture texture texture
+bone anim bone 0.500000 anim
+texture
+-1 1.0 frame -1
+frame 1.0 bone 1.0 bone 0.500000 bone bone
+bone 0.500000 = = vertex
+= material
+frame
+bone texture
+= 1.0 1.0 -1 vertex bone frame texture
+= bone 1.0
+= bone
+0.500000 material vertex
+-1 -1 material = 0.500000 material bone bone -1 vertex -1
+1.0 = texture anim texture texture vertex
+1.0
+vertex anim
+=
+0.500000 1.0 texture -1 vertex frame anim 1.0 0.500000 texture
+vertex = vertex
+= texture 0.500000
+material texture vertex
+bone
+material vertex =
+bone
+texture texture vertex 1.0 = bone material
+bone
+anim
+vertex anim = = vertex
+bone 0.500000 = anim = 1.0 frame
+anim
+-1 texture anim
+frame =
+vertex 0.500000 bone
+vertex -1 texture material bone 0.500000 =
+-1
+material 0.500000 vertex =
+1.0 frame
+frame
+bone 0.500000 1.0 = 0.500000 bone bone frame
+anim
+1.0 anim anim
+frame anim material frame texture 1.0 -1 0.500000 = = -1 1.0 vertex -1 bone anim anim bone
+material -1 texture anim -1 vertex 0.500000 frame = -1 material 1.0 0.500000 -1 bone -1 = 0.500000 -1 anim 1.0 material frame
+bone
+material -1 frame texture texture
+0.500000 bone -1
+-1 anim -1 frame
+vertex
+vertex = anim 0.500000
+frame anim -1 vertex
+vertex anim vertex material
+anim material =
+frame vertex vertex 1.0 vertex 1.0
+= 1.0 -1 = anim frame =
+1.0 1.0
+vertex frame
+bone
+bone bone vertex -1 material 0.500000
+frame bone bone -1 anim bone material material
+= frame vertex 0.500000 0.500000 bone frame -1
+0.500000
+anim = frame material bone texture texture -1 = =
+frame 1.0
+-1 frame frame
+frame
+-1 = 1.0 -1 bone -1 anim
+frame 1.0
+bone
+-1 0.500000 1.0 anim 0.500000 bone frame material
+0.500000 = -1 anim
+-1 texture -1
+-1 material vertex 0.500000 frame = bone anim texture bone
+frame material vertex vertex
+bone = 1.0 1.0 material frame anim anim 0.500000 bone 1.0 0.500000
+1.0 texture
+vertex 0.500000 = = texture = =
+anim bone anim material material 1.0 bone = material texture 1.0 0.500000 = anim 1.0
+= -1 0.500000 frame -1 material
+0.500000
+bone bone
+0.500000
+0.500000 0.500000
+=
+1.0
+frame -1 = texture bone
+frame 0.500000
+vertex texture -1 anim anim 1.0 frame
+= material
+1.0 frame frame vertex texture frame 1.0 0.500000 bone -1 1.0 texture 1.0 bone 0.500000 0.500000 1.0
+frame 1.0 = bone = texture -1
+= texture =
+1.0 -1 frame
+1.0 frame
+frame frame frame
+= frame texture -1 bone
+bone 0.500000
+0.500000 texture
+1.0
+material vertex material
+anim
+frame = vertex frame frame
+anim bone -1
+= anim
+bone anim bone anim 0.500000 bone -1 anim
+texture = material anim vertex vertex
+1.0 texture
+1.0 anim frame 1.0 -1 bone vertex
+0.500000 material 0.500000
+frame
+= material
+vertex vertex = material -1
+material 1.0 anim 0.500000 vertex
+texture texture frame vertex
+1.0 anim bone
+frame vertex 0.500000 bone frame vertex 1.0
+texture material
+bone vertex
+vertex = anim bone
+frame texture = anim 0.500000 anim
+bone
+anim 1.0
+anim bone
+texture vertex bone -1 material bone vertex material = 1.0 material frame frame frame frame vertex frame texture material frame 0.500000
+texture = frame 1.0 = anim 1.0 anim texture frame
+texture anim
+-1 vertex = 0.500000 0.500000 material
+1.0 frame bone anim texture
+1.0 texture material texture
+material
+material
+frame frame bone
+= frame 0.500000
+material material 1.0
+frame
+frame -1 material 1.0 bone
+-1 bone 0.500000 frame bone vertex
+=
+= 0.500000 frame = = 0.500000 bone bone vertex 0.500000 vertex anim
+0.500000
+1.0 1.0
+= 0.500000 material bone material
+anim
+texture
+texture vertex frame
+-1 material 0.500000
+material material texture
+material
+texture texture texture anim 1.0 =
+0.500000
+texture
+vertex vertex texture
+-1 = frame frame
+0.500000 -1
+-1
+= -1 vertex frame
+texture
+bone vertex
+1.0 bone = -1
+vertex
+bone frame
+texture 0.500000
+texture 1.0 vertex =
+= texture = anim tex
\ No newline at end of file
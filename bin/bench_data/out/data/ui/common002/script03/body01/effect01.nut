@@ -0,0 +1,9 @@
+material = 1.0
+vertex
+texture = bone 0.500000 anim vertex
+anim 1.0 frame vertex texture frame
+-1 anim anim
+anim
+1.0 vertex =
+=
+0.500000 0.500000 1.
\ No newline at end of file
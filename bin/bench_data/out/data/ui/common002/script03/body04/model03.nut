@@ -0,0 +1,5 @@
+bone -1 frame 1.0
+material
+anim 0.500000 frame
+anim -1 0.500000
+0.500000 
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim -1
+anim texture bone frame 1.0 0.500000 1.
\ No newline at end of file
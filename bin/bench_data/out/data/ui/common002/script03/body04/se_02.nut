@@ -0,0 +1,2 @@
+0.500000
+bone vertex material -1 -1 vertex m
\ No newline at end of file
@@ -0,0 +1,7 @@
+material vertex
+material frame material
+anim bone anim bone
+vertex
+0.500000 anim frame vertex
+-1 0.500000
+-1 frame anim bon
\ No newline at end of file
@@ -0,0 +1,16 @@
+1.0 = frame 1.0 bone anim
+anim bone anim
+frame anim frame anim vertex
+texture 1.0
+frame
+bone -1 = -1 1.0 anim vertex 1.0 material
+anim 0.500000 0.500000
+0.500000 material texture
+bone
+-1 anim 1.0 0.500000
+-1 vertex 0.500000
+frame vertex material material =
+material
+anim
+1.0 frame material -1
+-1 1.0 vertex anim bone frame mater
\ No newline at end of file
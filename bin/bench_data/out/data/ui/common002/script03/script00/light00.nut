@@ -0,0 +1,70 @@
+material 0.500000 = = 1.0
+= frame material
+=
+anim material
+0.500000 =
+material = vertex vertex anim
+vertex -1 -1
+-1 frame
+0.500000 material =
+vertex texture = anim -1 material material bone anim -1 0.500000 vertex anim
+bone = 1.0 anim
+1.0 frame frame frame 0.500000 frame anim anim frame -1 frame
+frame vertex anim
+material
+0.500000
+vertex material
+vertex
+bone vertex
+0.500000 anim anim 0.500000 frame = vertex 1.0 anim
+bone
+anim 0.500000 -1
+= bone = material texture
+1.0
+0.500000
+-1 anim
+anim
+texture
+-1 = anim 1.0 = = bone vertex 0.500000 =
+bone
+0.500000 1.0 frame
+bone 1.0
+-1 1.0 vertex -1 -1
+frame 0.500000 bone anim anim 0.500000 frame
+texture
+0.500000
+material 1.0 texture bone
+bone
+1.0 0.500000 vertex
+anim anim material frame 1.0 material vertex
+anim -1 vertex frame
+bone frame bone
+= -1
+0.500000 = frame
+anim texture texture =
+= bone = texture vertex
+1.0 vertex
+material vertex = anim anim bone bone
+frame vertex
+material material 0.500000
+vertex 1.0 1.0
+0.500000 material frame bone
+texture
+texture frame vertex 1.0
+-1 frame
+-1 = vertex 0.500000 anim
+frame bone 0.500000 -1 anim 0.500000 1.0 frame frame
+vertex
+0.500000
+-1 anim 0.500000 0.500000 =
+anim material bone
+anim frame
+material -1
+1.0 1.0 vertex material material
+=
+vertex
+= frame bone bone bone material material bone texture material
+-1 -1
+texture
+bone
+bo
\ No newline at end of file
@@ -0,0 +1,4 @@
+=
+1.0
+frame 1.0 anim frame bone 0.500000 -1 frame =
+-1 = 
\ No newline at end of file
@@ -0,0 +1 @@
+0.500000 bone 0.500000 vertex texture = texture = material
\ No newline at end of file
@@ -0,0 +1,85 @@
+texture texture vertex -1 frame = frame
+-1 frame bone bone = =
+= texture material 0.500000
+-1
+0.500000
+vertex 1.0 bone material -1 texture
+frame frame anim frame material
+= -1 texture = = material 0.500000 vertex -1 1.0 bone -1 1.0 -1
+= bone
+bone material bone frame
+texture bone 0.500000 texture
+vertex texture = bone
+bone frame texture anim -1 -1 -1 vertex frame anim -1
+1.0 0.500000
+material = 0.500000 bone anim vertex texture
+-1 vertex material
+texture
+texture = 0.500000 bone texture texture 0.500000 -1 0.500000
+anim bone vertex material bone 1.0 0.500000 1.0 texture
+vertex anim anim frame material 0.500000 1.0 anim 1.0 frame 1.0 bone
+0.500000 1.0 vertex
+anim
+=
+-1 material =
+texture material = 1.0 1.0
+0.500000 vertex
+vertex 1.0 anim anim 0.500000 material material frame anim material
+frame -1 texture
+1.0 -1 1.0 -1
+material texture vertex = 1.0 vertex bone = 0.500000
+-1 0.500000
+=
+material bone 1.0 0.500000 = = frame material bone anim
+= 1.0 = texture = bone
+1.0 material texture bone
+1.0 frame bone material -1
+1.0 frame material material frame
+material 0.500000 frame frame anim anim =
+1.0 0.500000 material -1
+=
+1.0 0.500000
+-1 frame frame frame -1 0.500000 1.0 vertex texture material
+bone
+=
+vertex frame frame texture vertex frame texture = bone
+frame texture
+material
+1.0 -1 1.0
+=
+anim =
+texture =
+0.500000
+-1
+0.500000 bone bone
+1.0
+bone material 0.500000 1.0 frame =
+anim anim texture vertex 1.0
+1.0 =
+= frame 0.500000 =
+1.0 anim 0.500000
+-1
+material texture frame 1.0
+vertex bone -1
+1.0 material = anim
+material -1
+1.0 anim frame texture
+0.500000 frame texture vertex anim -1 texture texture
+frame anim vertex
+anim material texture
+0.500000 -1 anim texture -1
+vertex
+1.0
+1.0
+= anim -1
+frame
+frame 1.0 anim -1 bone =
+anim bone texture 1.0 texture
+material material
+frame
+texture material
+0.500000 bone 1.0 -1 bone -1 bone
+texture frame -1 0.500000 0.500000 anim bone bone
+texture anim frame texture 0.500000 0.500000 bone 1.0 bone
+0.500000 anim
+0.500000 frame bone te
\ No newline at end of file
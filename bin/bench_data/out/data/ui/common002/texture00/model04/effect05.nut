@@ -0,0 +1,139 @@
+frame
+frame bone texture anim
+anim = 0.500000
+frame vertex anim = texture 1.0
+-1
+= frame
+texture vertex = 1.0 = frame
+bone =
+anim bone texture =
+anim vertex 0.500000
+0.500000 0.500000 anim 0.500000 frame vertex
+material frame = bone frame vertex bone bone -1
+0.500000 bone anim material -1 frame texture 0.500000 vertex vertex vertex -1 1.0
+anim
+0.500000
+texture vertex frame = 1.0 anim -1 texture =
+material vertex texture
+vertex frame material
+=
+-1 anim texture bone 0.500000 = vertex vertex vertex
+vertex
+frame = anim
+frame anim 1.0 anim anim material
+0.500000 vertex =
+material material 0.500000 bone
+anim
+texture
+= anim
+frame -1 frame frame
+0.500000 frame -1
+= material
+= bone 1.0 material 0.500000 =
+material
+-1 vertex texture vertex frame texture
+= material material
+-1 -1 bone 0.500000 vertex 0.500000 bone
+0.500000 -1 vertex 0.500000 1.0 = -1
+bone 0.500000 vertex material 1.0 0.500000 texture bone 1.0
+bone vertex texture -1 -1 vertex bone anim
+1.0 1.0 bone 1.0
+1.0 -1
+0.500000 = = bone
+bone material
+= bone -1 -1
+1.0 vertex -1 0.500000
+0.500000
+material material -1 0.500000 -1 bone vertex -1 anim = material texture anim = material bone
+bone 0.500000 texture texture texture 1.0 -1 0.500000 material material =
+-1 texture
+vertex texture
+frame frame 1.0 0.500000
+frame frame frame =
+material
+1.0 = vertex bone bone vertex frame anim 1.0
+bone
+material 1.0 frame -1 bone = frame = vertex
+frame 0.500000 texture vertex material
+vertex anim 1.0 vertex anim frame -1 material material
+frame
+frame
+anim material
+0.500000 vertex bone anim vertex = bone = = bone
+texture bone anim
+frame frame
+bone 1.0 texture material
+vertex anim frame
+vertex material
+=
+vertex -1 =
+material
+0.500000 -1 anim -1 vertex
+-1
+anim anim 1.0 frame
+anim vertex bone
+=
+texture anim
+anim 1.0 0.500000
+0.500000
+frame
+texture 0.500000 texture
+0.500000 -1 vertex
+= = 0.500000 frame frame -1
+frame anim -1 0.500000 vertex frame vertex frame 1.0 material 1.0 = material
+material bone material vertex texture = -1 material
+vertex bone texture anim anim
+bone frame texture anim bone texture bone = -1 frame frame texture = = material = -1 bone = texture material bone frame
+1.0 bone texture vertex
+-1 1.0 frame frame
+0.500000
+anim -1
+anim 0.500000 vertex 1.0 frame anim
+frame vertex material -1 anim anim texture texture frame
+-1 material material anim
+1.0 anim = bone =
+texture vertex material =
+anim
+material material anim
+=
+bone 0.500000 texture
+= bone
+0.500000 anim 1.0 bone = -1 = vertex
+material
+material frame vertex vertex 0.500000
+vertex material frame bone
+material 0.500000 frame bone = material frame bone anim 1.0 -1 bone texture -1 material frame 1.0 bone
+frame anim texture
+frame -1 texture bone material anim 0.500000
+frame 1.0 bone anim -1 1.0 frame vertex =
+vertex vertex 1.0 1.0 =
+vertex vertex -1 -1
+frame -1 vertex material 1.0 texture -1 anim frame 1.0 vertex 1.0 vertex 1.0
+-1 -1 vertex 0.500000 0.500000 =
+1.0 anim texture material
+material vertex material bone 0.500000 -1 bone frame
+material 0.500000 material vertex vertex texture -1 vertex = 1.0 1.0 material
+vertex material vertex
+anim vertex
+bone
+1.0 bone
+0.500000
+material = material
+0.500000 material 1.0 -1
+material
+texture
+bone
+material -1 frame
+bone 0.500000 0.500000 material material texture bone anim
+1.0 texture 1.0
+bone
+material 0.500000 0.500000 texture
+texture bone vertex
+= =
+1.0
+frame vertex 0.500000 material texture texture anim frame
+frame texture 1.0
+anim
+-1 = material anim
+1.0 -1 bone material 1.0 -1 =
+frame texture b
\ No newline at end of file
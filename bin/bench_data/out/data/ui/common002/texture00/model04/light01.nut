@@ -0,0 +1,3 @@
+vertex
+0.500000 = 1.0
+texture bone -1 bone vertex -1 texture
\ No newline at end of file
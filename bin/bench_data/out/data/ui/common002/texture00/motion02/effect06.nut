@@ -0,0 +1,2 @@
+frame material material vertex material = = 0.500000
+frame
@@ -0,0 +1,30 @@
+texture 0.500000 anim material
+anim frame -1 anim 0.500000 1.0 bone vertex
+0.500000 anim texture
+=
+1.0 frame
+texture 1.0 material -1 frame
+vertex 1.0 bone anim material 1.0 vertex 0.500000
+texture
+1.0 0.500000 anim vertex
+0.500000 = 0.500000
+anim =
+texture 1.0 1.0 texture 0.500000
+1.0 0.500000
+vertex
+anim = 1.0
+vertex -1 = 1.0 frame vertex material
+texture bone =
+vertex 0.500000 0.500000 material material = texture
+1.0 frame
+vertex 1.0 vertex material bone -1 material 0.500000
+vertex 0.500000 anim vertex frame texture vertex
+0.500000 = 0.500000
+bone material 1.0
+vertex = 1.0 -1 bone = -1
+anim anim anim
+bone
+bone
+frame
+1.0 -1 bone vertex anim 1.0 texture 0.500000 texture anim = 1.0 vertex
+materi
\ No newline at end of file
@@ -0,0 +1,7 @@
+material 0.500000
+1.0
+= texture
+vertex texture anim 1.0 anim
+vertex frame
+texture = texture material material 0.500000
+material 
\ No newline at end of file
@@ -0,0 +1 @@
+y(`yv	wU_Y(bA*ީE/ٟxs~-hSqBw6A0CZtw|	ڇKSτogzz
\ No newline at end of file
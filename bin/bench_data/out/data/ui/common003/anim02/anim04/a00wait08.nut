@@ -0,0 +1,232 @@
+frame material
+frame
+vertex
+0.500000 material texture -1 = bone bone
+texture -1
+vertex
+frame bone
+frame
+texture bone texture = frame material anim
+-1
+= =
+texture
+1.0 0.500000 bone
+frame material texture
+-1 texture
+0.500000
+frame
+-1 1.0
+1.0 material frame
+bone texture 0.500000 -1 1.0 frame bone frame 1.0 bone material
+0.500000 bone material
+1.0 bone
+0.500000 =
+bone frame bone anim 1.0 anim
+0.500000 anim anim vertex
+-1 1.0 0.500000 -1 material
+vertex
+0.500000 material bone anim = frame = -1 anim anim frame vertex 0.500000 texture
+texture material -1
+-1 material material anim
+0.500000 vertex = -1 bone texture = frame frame bone frame = bone 1.0 1.0
+-1
+texture bone 1.0
+material = -1 = material 1.0 vertex vertex
+material texture -1 = frame material
+-1
+vertex texture material -1 bone = vertex anim 1.0 texture
+material 1.0 anim texture -1 frame = texture anim vertex vertex 1.0 0.500000 frame frame 1.0
+bone vertex =
+bone frame
+texture
+vertex 1.0 anim 1.0
+frame 1.0 bone -1 material
+-1
+-1 bone material texture
+anim -1
+= = vertex 1.0 frame = 0.500000 1.0 bone -1
+0.500000 frame bone texture material bone -1 bone anim 0.500000 anim 0.500000 anim frame
+anim 1.0 texture vertex 1.0 0.500000 anim texture -1 texture vertex texture frame material
+bone
+material frame material
+= 0.500000 frame vertex frame vertex
+1.0 = bone vertex
+vertex -1
+material
+0.500000 = -1 =
+-1
+frame =
+-1 texture frame
+-1 material frame = material texture -1 1.0 -1 0.500000 1.0 vertex texture 0.500000 = vertex anim
+1.0
+0.500000 anim
+frame vertex 1.0 = frame vertex bone
+texture
+vertex vertex
+-1 frame
+anim anim
+frame anim =
+material = vertex -1 = material frame = =
+anim 0.500000 -1 1.0 texture
+-1 1.0
+1.0 frame anim frame vertex vertex
+-1 0.500000 -1 1.0 = material
+frame vertex
+texture bone texture 1.0 0.500000 material 0.500000
+=
+1.0
+anim anim material
+texture 1.0 texture anim -1 vertex vertex -1 1.0 1.0 -1 1.0 1.0 vertex 1.0 material -1 texture texture
+material 0.500000
+-1
+frame material
+material 1.0 bone 1.0
+frame frame -1 material -1 texture
+frame
+0.500000 vertex
+bone
+texture anim anim texture
+-1 frame material frame
+-1
+frame 1.0 anim = 0.500000 1.0
+0.500000
+texture material
+= material bone
+anim texture -1 1.0
+texture material = frame -1 -1 frame -1 0.500000
+bone
+bone
+1.0 anim texture bone
+texture 1.0 anim 0.500000
+frame bone frame -1 1.0 = 1.0 bone texture
+material frame = texture -1 texture vertex anim 1.0 material vertex texture
+material -1 bone bone = vertex material
+1.0 -1 vertex
+= bone frame 1.0 = vertex frame bone 1.0 material
+0.500000
+texture frame
+frame frame
+anim
+bone frame vertex material material bone frame frame frame 1.0 -1 frame anim 1.0 1.0 texture
+0.500000
+-1 texture 1.0 -1 texture
+anim 1.0 texture 0.500000 1.0 frame material anim bone 1.0
+0.500000 texture anim 0.500000 1.0 -1 0.500000 vertex
+frame material frame material vertex frame -1 texture 0.500000 0.500000 = anim = texture material bone bone material anim
+anim 1.0 1.0 1.0 = bone =
+anim texture bone -1 texture frame 0.500000
+vertex texture -1 =
+bone frame texture 0.500000
+texture 0.500000 anim material 0.500000 -1 anim anim = 1.0 vertex = frame texture bone
+bone vertex
+material vertex =
+-1 material
+frame texture 1.0 bone frame vertex -1 -1
+-1 anim material 0.500000
+texture anim 0.500000 material texture
+frame texture anim bone frame frame texture
+vertex = 0.500000 bone anim 0.500000
+material =
+texture = 0.500000 -1 = material -1 bone
+1.0 1.0 1.0 material 0.500000 vertex
+bone material -1 texture
+vertex -1 bone 0.500000 frame texture texture 1.0 = texture material material
+anim material
+-1
+-1 -1
+anim material
+= bone
+1.0
+-1
+vertex bone
+1.0 vertex -1 vertex material bone vertex vertex -1 vertex
+= anim 0.500000
+texture frame -1 1.0 vertex material 0.500000
+texture
+1.0
+vertex texture 1.0 texture
+vertex
+texture -1 anim -1
+anim
+0.500000 frame frame
+material texture = anim anim 1.0 1.0 texture -1
+-1 0.500000 texture vertex
+frame 1.0 anim bone
+0.500000 vertex vertex
+-1
+material texture -1 frame -1 texture texture frame
+= bone -1 0.500000 -1
+texture
+vertex = 1.0 anim -1 material = 1.0 0.500000
+1.0 texture
+material =
+bone
+0.500000 bone anim texture texture
+bone anim
+texture -1 frame texture -1
+0.500000 material anim
+anim 1.0
+texture
+0.500000 0.500000 anim frame 1.0 vertex = = -1 0.500000
+anim 0.500000 material frame anim frame =
+0.500000 = = texture anim 1.0 material bone 1.0
+=
+frame -1 frame frame anim
+0.500000 bone 1.0 0.500000 0.500000 anim bone 1.0
+-1 -1 -1 frame 1.0 = frame = -1 anim 0.500000 = frame frame 0.500000 0.500000 frame
+vertex 0.500000 texture =
+frame -1 0.500000 frame
+material anim bone -1 0.500000 bone -1 bone -1 -1
+0.500000
+frame frame texture 1.0 -1
+frame 0.500000 = -1 anim
+texture
+bone
+0.500000 = texture
+texture
+= 0.500000 material
+bone =
+0.500000 texture -1
+1.0 anim
+bone
+vertex bone bone 1.0 bone material
+-1
+material anim
+anim texture
+0.500000 bone frame texture material
+frame material 0.500000
+anim
+anim texture vertex =
+anim 1.0 1.0
+vertex frame 0.500000
+0.500000 = anim bone
+frame
+texture 1.0 =
+frame
+-1 = frame material vertex anim
+0.500000 0.500000 0.500000 0.500000
+vertex -1 material = anim frame 1.0 -1 bone vertex texture anim =
+bone
+0.500000 texture
+=
+-1 anim vertex -1 frame 0.500000 frame
+material = 1.0 texture 1.0 = -1
+vertex anim vertex = -1 material 0.500000 anim bone bone -1
+1.0
+material = 0.500000
+bone frame vertex frame -1 = frame
+bone = =
+-1 1.0 material
+frame texture bone
+0.500000 anim 1.0 texture 1.0 0.500000 frame bone vertex -1 material
+= bone anim -1 -1 material texture -1 -1 bone
+material
+anim material
+frame bone =
+frame
+texture -1
+0.500000 anim -1 anim
+= -1 anim =
+1.0 vertex frame material material anim material = 1.0 = frame texture
+vertex frame 1.0 anim frame frame
+material 1.0 -1
\ No newline at end of file
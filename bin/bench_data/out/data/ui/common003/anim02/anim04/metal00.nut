@@ -0,0 +1,7 @@
+material
+vertex
+-1
+-1 vertex
+anim
+bone anim material 0.500000 =
+vertex f
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone texture frame anim 0.500000
+an
\ No newline at end of file
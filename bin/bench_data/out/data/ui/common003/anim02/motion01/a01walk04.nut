@@ -0,0 +1,23 @@
+vertex
+0.500000 material bone
+texture
+vertex material
+bone 1.0 texture material bone 0.500000 0.500000 1.0
+= 0.500000 0.500000 texture
+= bone frame vertex frame
+frame
+= vertex vertex bone frame
+bone bone
+material
+anim anim 0.500000 vertex 0.500000
+-1 texture vertex material
+1.0
+frame texture
+0.500000
+bone anim
+vertex anim material frame anim =
+= bone anim 0.500000 -1 0.500000 0.500000 frame frame vertex frame = -1
+=
+anim anim texture
+bone 0.500000
+f
\ No newline at end of file
@@ -0,0 +1,12 @@
+texture vertex 0.500000 anim bone frame
+texture -1 -1 material -1 vertex
+vertex
+material 1.0
+0.500000
+1.0 anim anim 1.0 =
+0.500000 = = 0.500000 = texture
+= texture -1 vertex texture texture texture anim -1 1.0 -1 frame bone = texture material frame
+1.0 bone material material
+bone anim 0.500000 texture
+anim = vertex anim frame 1.0 -1 1.0
+frame -1 frame = material 0.500000 = 0
\ No newline at end of file
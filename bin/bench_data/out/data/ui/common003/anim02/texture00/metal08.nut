@@ -0,0 +1,22 @@
+vertex =
+bone bone frame bone = vertex frame
+1.0 -1 1.0
+texture bone
+material bone -1 texture -1
+material 0.500000 texture texture -1 0.500000 material texture = frame texture vertex anim 1.0
+anim
+material -1 0.500000 1.0 material bone bone bone -1 bone 0.500000 bone
+material vertex
+anim -1
+anim frame material
+vertex frame 1.0
+material 0.500000 0.500000 vertex material = vertex frame
+anim frame anim material texture 0.500000 = 0.500000
+-1
+bone 1.0 vertex frame
+bone frame
+material 0.500000
+1.0 bone = 1.0 1.0
+texture bone
+material texture = vertex 0.500000 0.500000 -1
+1.0 vertex bone 0.500000 0.500000 material material 1.0 bone texture fr
\ No newline at end of file
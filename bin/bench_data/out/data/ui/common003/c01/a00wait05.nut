@@ -0,0 +1,204 @@
+texture bone
+bone 0.500000
+= texture material -1 bone frame 0.500000 bone material -1 frame material anim = 1.0 material
+bone frame 1.0 1.0
+anim anim -1 bone
+1.0 material
+vertex texture 1.0 anim -1 vertex -1
+frame -1 0.500000
+0.500000
+-1 frame 0.500000 -1
+0.500000 anim frame material bone
+texture
+0.500000 0.500000 anim
+1.0
+frame
+material = texture texture 0.500000 0.500000 material 0.500000
+bone frame
+vertex -1 bone texture anim
+= material frame bone material
+texture bone
+-1 frame
+vertex texture frame anim
+1.0 -1 anim texture
+bone 1.0
+-1 texture frame 0.500000
+-1 material
+0.500000 vertex
+bone vertex anim
+vertex
+bone -1 -1 -1
+texture material 0.500000
+texture 1.0
+= -1
+vertex material material material texture
+material texture
+-1 -1 -1
+1.0 bone
+= material 1.0
+material anim 0.500000 material -1 1.0 texture anim texture
+material 0.500000 texture texture -1 0.500000 frame
+1.0 vertex =
+-1 frame -1 1.0 vertex texture frame frame 0.500000 material vertex 1.0
+frame 1.0 0.500000 texture
+-1 anim 1.0 =
+vertex
+0.500000 1.0
+= material frame material 0.500000 frame
+texture -1 0.500000 1.0
+-1 vertex material frame = 1.0 material 1.0 bone anim texture frame
+material
+0.500000 vertex
+0.500000 = bone anim anim frame 0.500000 anim frame texture anim
+0.500000
+texture material material 1.0 bone material texture texture vertex
+0.500000 -1 1.0 0.500000 anim frame 0.500000 vertex
+anim
+= bone
+texture
+-1 anim
+-1
+vertex material
+vertex
+frame
+bone frame
+bone 1.0 vertex
+0.500000 anim frame frame
+= texture
+= = 1.0 anim frame
+texture
+vertex -1
+= frame
+bone -1
+frame vertex
+bone vertex anim
+= frame 1.0 1.0 = frame
+anim
+0.500000
+anim bone 0.500000 0.500000 material 0.500000 =
+anim -1 bone texture vertex 1.0 anim
+frame
+frame = frame
+vertex -1 -1 1.0 material vertex = vertex
+anim -1
+0.500000 1.0 0.500000 =
+frame
+= material vertex texture -1 = frame 1.0
+anim
+texture
+vertex bone
+0.500000 vertex 0.500000 frame
+0.500000 bone
+bone
+bone
+texture 1.0
+anim anim
+frame bone material 1.0 texture bone = vertex = -1
+0.500000 vertex = 1.0 frame material vertex frame material 0.500000 frame vertex
+texture
+vertex
+0.500000 1.0 bone anim -1 0.500000 frame anim
+-1 1.0
+vertex vertex texture
+vertex
+-1 -1 texture
+= anim -1 = material = vertex 0.500000
+anim anim anim -1 anim -1 0.500000 texture 0.500000
+frame material
+=
+= 1.0 = anim
+texture -1
+0.500000 -1 -1 1.0 = frame
+vertex = anim frame
+material
+= bone 0.500000
+anim frame anim
+frame texture
+material -1 anim material material
+anim frame bone -1
+texture anim vertex
+anim vertex bone texture = 1.0 anim anim
+anim = 1.0 frame texture
+1.0
+-1 1.0 anim frame vertex
+= 0.500000 = 0.500000 0.500000 1.0 frame
+0.500000
+bone vertex 0.500000
+texture 0.500000 anim 1.0 texture anim -1 1.0
+= vertex 1.0
+frame material vertex bone material
+vertex 1.0 texture frame
+bone
+texture -1 anim
+anim bone texture -1 vertex bone anim vertex material
+1.0
+1.0 0.500000 1.0 bone texture texture 1.0 -1
+-1 bone 0.500000 material = -1
+bone material vertex
+= texture -1
+0.500000
+-1 -1 -1 material -1 1.0 material
+-1 material 0.500000 frame
+texture -1
+1.0
+0.500000
+bone anim bone texture texture = bone material = frame frame texture texture vertex -1 bone -1 1.0 frame texture
+= anim frame = material = 0.500000 material
+1.0
+vertex bone 0.500000 anim material bone
+0.500000 texture 0.500000 -1 frame
+1.0 frame vertex vertex material
+-1 -1 anim 0.500000
+-1 material anim bone
+-1 = =
+material = 1.0
+texture vertex -1 anim bone -1 -1 bone -1 -1
+anim 1.0 1.0 material
+material bone -1 -1 texture frame 0.500000 0.500000 bone =
+0.500000 vertex
+material 1.0
+texture anim
+material
+anim anim 0.500000 frame texture 1.0
+-1 1.0
+0.500000
+anim bone texture anim anim vertex =
+= texture
+anim
+vertex vertex vertex
+1.0 frame
+-1
+= 1.0 material
+material material texture -1 material
+bone frame vertex = vertex 0.500000 anim vertex frame = anim bone frame bone bone 0.500000 frame -1 0.500000 texture anim -1 0.500000
+bone
+0.500000 0.500000
+anim 1.0
+material
+= = -1 bone anim
+material 1.0 bone 0.500000 material frame texture -1 vertex anim bone material vertex
+-1 -1 0.500000 material
+anim 1.0 frame -1 0.500000
+1.0
+anim 1.0 0.500000 0.500000
+anim bone texture
+bone vertex texture 1.0 material material
+anim
+frame = material bone
+0.500000 0.500000 anim
+vertex -1 1.0 frame 0.500000
+= 1.0 frame anim -1 1.0 anim texture
+vertex frame
+material -1 = material
+0.500000 frame -1
+bone frame frame
+1.0
+1.0
+vertex
+-1
+-1 bone -1 0.500000 anim material
+bone
+1.0 -1 vertex
+material material texture =
+bone material
+= 1.0 texture material anim
\ No newline at end of file
@@ -0,0 +1,76 @@
+0.500000 material bone bone
+-1 texture = texture frame -1
+bone = anim
+0.500000 texture bone 0.500000 anim material anim -1 texture =
+bone bone = frame 1.0 bone material frame frame 0.500000 -1 -1 anim
+= bone
+vertex vertex -1 material
+texture material
+material anim vertex material -1
+material
+anim 1.0 0.500000
+frame 0.500000
+anim 0.500000 -1 bone bone
+anim
+bone -1
+frame texture vertex -1 bone vertex vertex 0.500000 texture 0.500000
+-1 anim bone
+material -1 bone 1.0 -1
+vertex bone -1 1.0 anim
+vertex frame -1 = 0.500000 vertex
+frame texture
+0.500000
+bone texture
+anim frame bone = anim
+-1
+0.500000 anim
+texture texture anim bone
+1.0 texture bone
+1.0
+bone frame
+material texture frame
+bone anim 1.0 0.500000 anim 1.0 material anim material = texture material vertex
+frame material
+=
+1.0 frame vertex frame 0.500000 -1 material
+bone anim 1.0
+-1 bone
+anim
+anim -1 =
+frame
+anim vertex
+texture = -1
+1.0 vertex texture
+material vertex
+-1
+material bone anim 0.500000
+vertex
+-1
+texture 1.0 1.0 frame = texture =
+= anim vertex material
+1.0
+anim
+0.500000
+0.500000 = vertex texture
+1.0 -1 texture vertex vertex anim 0.500000 bone anim material vertex 1.0 texture
+= texture vertex 1.0
+0.500000
+vertex
+anim texture texture 1.0 bone 1.0 0.500000 frame anim
+material =
+bone
+= = 1.0 anim -1 1.0 texture anim
+1.0 = -1 material texture vertex vertex material bone =
+1.0 = frame bone material material anim frame
+0.500000
+frame = material 0.500000 vertex -1
+anim 0.500000
+1.0 frame vertex texture -1 anim texture 0.500000 anim 1.0 = frame 1.0 frame = bone 0.500000 material texture frame frame vertex frame -1
+anim -1 bone frame frame anim frame material
+bone
+frame material 1.0 material = frame -1
+-1
+texture -1 = 1.0 1.0 -1 texture
+frame bone texture
+frame 1.0 0.500000 -1 texture frame
+anim texture
@@ -0,0 +1,31 @@
+0.500000 0.500000
+1.0
+vertex 1.0
+anim
+1.0 = 0.500000 vertex
+frame
+1.0 vertex
+0.500000 = bone -1
+texture anim
+-1 anim -1
+=
+anim bone vertex frame texture
+-1
+1.0
+0.500000 anim 1.0 material material -1 frame anim
+frame vertex -1 anim vertex 1.0
+bone -1 -1 anim anim
+1.0 texture material 0.500000 anim 1.0 0.500000 = 0.500000
+material 1.0
+0.500000 0.500000 material
+= anim
+vertex frame frame anim frame bone 1.0
+1.0 texture anim
+-1 material anim 0.500000 =
+anim 0.500000 = =
+anim
+bone 1.0
+1.0
+1.0 frame texture
+=
+-1
\ No newline at end of file
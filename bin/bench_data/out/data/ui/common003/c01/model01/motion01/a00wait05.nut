@@ -0,0 +1,11 @@
+anim 1.0 frame 0.500000 -1
+texture vertex bone -1 material texture
+= -1 vertex frame bone -1 anim material bone 1.0 material
+0.500000
+frame
+0.500000
+anim
+frame -1 -1 material -1 frame -1 vertex
+anim vertex
+vertex anim 1.0 -1 frame
+-1 bone = v
\ No newline at end of file
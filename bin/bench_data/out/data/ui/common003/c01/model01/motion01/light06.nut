@@ -0,0 +1,7 @@
+vertex
+= 0.500000
+vertex vertex
+1.0 1.0 bone
+vertex texture
+bone 1.0 = frame
+frame 1.0 mat
\ No newline at end of file
@@ -0,0 +1,34 @@
+bone frame 0.500000 material
+vertex
+-1 -1
+bone 0.500000 bone 0.500000 bone anim
+0.500000 1.0
+frame frame -1 =
+= frame texture
+1.0 anim frame
+-1 material anim frame
+material
+anim
+anim
+frame bone
+texture -1 frame texture
+vertex frame vertex
+material frame bone -1 bone 1.0 texture bone
+bone
+= texture
+vertex -1 0.500000 anim
+anim
+material anim bone -1
+= = =
+anim -1 frame frame -1 -1 anim
+vertex
+-1 anim frame material anim = bone -1 vertex
+anim frame = 1.0 0.500000 anim
+-1 vertex
+1.0
+anim
+anim
+bone =
+1.0
+bone bone
+-1 bone = -1 frame vert
\ No newline at end of file
@@ -0,0 +1,3 @@
+= material bone bone
+= frame texture 1.0 bone = vertex 1.0
+0.500000 material anim 0.50000
\ No newline at end of file
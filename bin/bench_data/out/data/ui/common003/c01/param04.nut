@@ -0,0 +1,13 @@
+=
+vertex
+vertex 0.500000 anim frame frame
+1.0 0.500000 texture vertex -1 bone
+1.0
+1.0
+material 1.0
+anim frame anim
+frame =
+vertex vertex
+texture 0.500000 texture =
+0.500000 texture
+f
\ No newline at end of file
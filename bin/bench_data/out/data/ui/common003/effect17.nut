@@ -0,0 +1,163 @@
+-1 -1 0.500000
+vertex material frame bone
+texture anim
+1.0 -1 texture
+bone anim frame frame
+0.500000 =
+vertex texture -1 -1 bone
+bone = anim material -1
+frame frame
+1.0 texture texture = =
+0.500000 anim = frame = material texture texture bone -1 anim -1
+bone
+material -1 0.500000
+texture texture material
+vertex 1.0 vertex vertex vertex
+bone -1 frame
+bone anim material vertex
+frame
+texture = texture = 1.0 0.500000
+1.0 -1 vertex
+texture 1.0 = -1 0.500000 bone 1.0 material bone
+1.0 = frame
+bone bone 0.500000
+anim
+anim
+vertex texture bone
+texture frame frame material texture vertex
+material = material
+-1 0.500000
+=
+-1 frame anim -1 frame texture texture
+material
+material 0.500000
+=
+texture
+texture 1.0 bone =
+1.0
+vertex 0.500000
+-1 texture -1 -1
+texture frame vertex vertex -1
+vertex frame = bone vertex bone material 0.500000 = 1.0 vertex frame -1 -1 anim material
+bone bone 1.0 1.0 bone
+texture 0.500000
+material
+= = -1
+bone 1.0 anim frame
+-1
+-1 bone
+material frame material bone
+texture bone vertex
+bone texture =
+= material vertex material 1.0 1.0
+material bone anim vertex = frame 1.0 0.500000 anim
+= texture -1
+bone = frame = bone = anim 0.500000 -1 vertex 1.0 0.500000
+material bone
+1.0
+= texture
+0.500000 1.0 -1 texture frame bone material = 1.0 texture vertex material
+0.500000
+vertex bone
+frame frame
+=
+vertex
+vertex -1 material -1 0.500000 1.0
+-1 anim material
+anim 0.500000
+texture 0.500000 anim material 0.500000
+1.0
+texture frame
+0.500000 anim 0.500000 = material vertex
+frame vertex
+vertex
+frame
+1.0 -1 = -1
+=
+anim anim 1.0 bone anim
+anim = = material =
+bone
+texture frame texture -1 =
+= 1.0 vertex
+= = anim
+texture
+material -1 0.500000 -1
+material
+texture material
+-1
+0.500000
+vertex = bone = material frame
+texture
+vertex 0.500000
+frame 1.0 anim
+1.0 bone material bone texture texture
+0.500000 texture material = 0.500000 vertex bone
+material
+0.500000
+vertex material texture = frame texture -1 frame -1 1.0
+= 0.500000
+material
+frame anim material 0.500000 -1
+vertex texture 1.0 0.500000 = bone 1.0
+1.0
+1.0 material anim vertex vertex texture frame = vertex = texture anim frame 1.0 bone
+0.500000 -1 -1
+1.0 0.500000
+1.0 bone
+texture = texture 1.0
+vertex
+1.0 0.500000 vertex 1.0 0.500000 frame vertex
+= 0.500000 0.500000 = bone
+frame frame anim
+1.0 -1 1.0 bone vertex bone bone
+1.0 -1
+material -1 anim texture anim vertex vertex anim vertex = vertex bone 1.0
+bone material material texture 0.500000 -1
+0.500000 bone -1
+0.500000 -1 = vertex texture vertex = vertex -1 1.0 bone
+bone vertex
+= bone
+anim -1
+material bone bone -1 anim -1 bone bone = =
+anim bone 1.0
+bone
+0.500000 bone vertex frame
+anim vertex anim vertex
+vertex texture material frame material = =
+bone -1 = 1.0 frame 1.0 1.0 frame anim
+bone material
+material vertex
+-1
+texture
+frame vertex material texture
+0.500000 texture texture anim -1 0.500000
+bone
+0.500000
+texture 1.0
+material bone -1 texture = anim
+= -1
+vertex anim anim
+texture -1 -1 -1
+vertex material vertex 0.500000 bone texture bone bone
+vertex
+-1 anim
+= bone = texture
+frame vertex vertex frame = material texture vertex material
+= 0.500000
+vertex material bone =
+material bone anim frame bone
+bone 1.0 0.500000
+anim material texture -1 material
+texture vertex vertex texture anim
+= 1.0 material frame 0.500000 texture 0.500000 vertex anim frame 1.0 0.500000 bone
+anim -1
+= texture vertex vertex vertex texture anim -1 texture
+1.0
+texture frame
+vertex anim bone
+=
+anim =
+1.0 texture texture 1.0 material frame
+anim frame 0.500000 1.0
+anim material
+material bone vertex frame vertex vertex ve
\ No newline at end of file
@@ -0,0 +1,60 @@
+-1 texture 1.0 texture -1 vertex 0.500000 0.500000 texture anim
+anim vertex bone vertex material
+0.500000 anim texture -1 bone =
+anim frame
+0.500000 vertex 1.0 anim texture vertex 1.0 = material
+=
+vertex =
+0.500000
+anim anim texture = 0.500000
+frame vertex bone
+material 0.500000 -1 frame bone frame
+= -1 frame = bone material vertex texture
+anim
+material 1.0 frame 0.500000 texture texture texture
+texture -1 anim = anim bone -1 1.0 = -1
+anim
+-1 material 0.500000 =
+= 0.500000 material
+-1
+= bone
+frame
+= bone
+texture =
+-1
+vertex -1 bone
+material anim texture
+1.0 material vertex =
+0.500000 texture 1.0
+frame = frame frame 0.500000 =
+material material 1.0 bone 1.0 0.500000
+anim
+frame texture bone -1 0.500000 = frame
+vertex -1
+anim 0.500000 -1
+=
+texture -1 1.0
+0.500000 -1
+bone -1 vertex -1 material
+0.500000 = bone anim frame material frame -1 anim frame bone bone anim
+material
+anim anim anim bone bone
+vertex anim material 0.500000 = bone bone vertex -1 = material 1.0 texture 1.0 1.0
+vertex
+-1 0.500000
+=
+frame anim bone frame anim
+1.0 frame bone
+1.0
+1.0 material
+0.500000
+-1 -1 0.500000 vertex material frame texture 0.500000
+0.500000 vertex -1
+texture vertex = 1.0
+texture 0.500000
+texture
+=
+=
+texture material -1 0.500000
+1.0 texture 0.500000 0.500000 vertex bone anim texture vertex 0.500000 -1 -1 texture frame texture
+anim = ani
\ No newline at end of file
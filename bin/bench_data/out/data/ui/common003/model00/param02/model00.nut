@@ -0,0 +1,6 @@
+= frame
+texture
+bone
+vertex bone 1.0 material =
+-1 texture
+0.
\ No newline at end of file
@@ -0,0 +1,35 @@
+material frame 0.500000 frame
+= 0.500000 0.500000 vertex = frame material
+texture anim -1 anim
+anim 0.500000 anim
+= = anim bone -1
+-1
+vertex = vertex anim bone frame 1.0 frame frame bone material texture
+anim frame texture
+texture = texture frame frame frame texture material = texture material anim vertex = vertex frame
+-1 anim frame material frame
+-1 0.500000 vertex bone 0.500000 1.0
+texture
+anim vertex material
+= = 0.500000 texture frame texture
+vertex = bone
+-1
+0.500000
+= bone anim 1.0 vertex 1.0 = anim material
+=
+= frame anim anim material bone 0.500000 texture = 1.0 material material =
+material
+texture material
+1.0 anim -1 -1 -1 vertex material 0.500000 bone frame material = anim
+vertex 1.0 vertex = bone -1 0.500000
+material
+= 1.0
+= bone 1.0
+vertex anim material frame bone 0.500000 bone
+1.0 texture
+bone
+vertex frame
+0.500000
+texture
+0.500000 = texture anim
+1.0 frame = vertex = bone 1.0 fr
\ No newline at end of file
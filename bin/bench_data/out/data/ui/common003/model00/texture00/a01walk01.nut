@@ -0,0 +1,8 @@
+-1 0.500000
+anim
+anim bone = 1.0
+bone
+=
+= 0.500000 bone 1.0
+texture bone vertex texture frame frame texture
+bone material bo
\ No newline at end of file
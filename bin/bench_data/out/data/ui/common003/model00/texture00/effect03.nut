@@ -0,0 +1,15 @@
+frame vertex 1.0 bone texture frame vertex material anim texture = =
+bone = 1.0
+vertex bone texture = vertex = texture -1
+frame
+0.500000
+frame
+anim anim 1.0
+bone
+= vertex texture bone bone 0.500000 frame
+vertex = 1.0 material anim anim frame bone frame material
+material 0.500000 vertex bone 1.0 -1 -1 material
+0.500000
+texture 0.500000 -1 material
+1.0 vertex texture
+texture texture material frame m
\ No newline at end of file
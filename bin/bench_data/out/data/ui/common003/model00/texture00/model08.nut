@@ -0,0 +1,81 @@
+= = material texture texture bone
+0.500000 vertex material bone
+bone
+anim
+vertex = =
+0.500000
+0.500000 = 1.0 texture bone -1 anim = bone vertex anim anim bone texture anim
+= vertex vertex texture anim
+vertex material
+frame anim vertex 1.0 material vertex
+texture -1
+material vertex
+frame material
+bone = 1.0 frame
+anim 0.500000 material texture 0.500000 vertex frame 0.500000 frame texture vertex material 1.0 texture 0.500000 1.0
+vertex -1
+material 0.500000 =
+material texture
+=
+= 0.500000 bone texture
+-1 -1 anim frame 0.500000 0.500000 -1 -1 0.500000 1.0 material frame 1.0
+-1 vertex -1 = -1 -1 = texture
+frame material = -1
+1.0
+anim texture texture bone bone
+material anim frame 1.0 =
+1.0 = 0.500000
+frame
+-1 0.500000 anim material
+= vertex anim vertex =
+frame material -1 anim
+frame anim 0.500000 vertex bone
+-1 frame
+frame texture
+anim -1 1.0 texture anim 1.0 = bone vertex = 1.0 = 1.0 bone vertex
+material
+0.500000 anim vertex bone -1 bone 1.0 texture vertex material -1 texture frame bone -1 material frame
+texture anim
+0.500000
+-1 anim vertex =
+=
+texture
+frame 0.500000 = = vertex anim
+0.500000
+= frame
+0.500000
+-1
+vertex
+0.500000 bone 1.0 -1
+bone -1 -1
+0.500000 texture material -1 anim 1.0 1.0 1.0
+= vertex
+-1 vertex
+frame 0.500000 =
+material material
+material 1.0 -1 anim vertex bone vertex bone 1.0 anim vertex vertex = bone
+1.0 -1 vertex
+vertex frame
+vertex texture =
+frame
+frame
+= -1 material material material
+0.500000
+1.0 -1 bone 1.0
+bone -1 frame 0.500000 -1 vertex frame
+= texture material bone
+anim
+1.0 vertex = bone
+material bone vertex frame 0.500000 =
+-1 texture
+1.0 material bone frame material 1.0
+vertex -1 vertex frame 1.0 texture anim 0.500000 texture
+material material texture 1.0 -1 0.500000 material frame frame 0.500000 anim
+vertex frame
+-1 -1
+= 1.0 = 1.0 = -1 = 1.0 = 0.500000 = 0.500000 bone = -1 -1 = 1.0
+anim vertex material 1.0 0.500000 anim bone
+-1 anim texture frame bone 0.500000
+bone -1 vertex frame frame material 1.0 1.0 -1 anim bone material
+anim bone bone material texture
+anim 0.500000
\ No newline at end of file
@@ -0,0 +1,86 @@
+-1
+texture frame
+texture material 1.0
+-1 = -1 1.0 material vertex bone bone bone frame
+=
+= frame anim
+frame
+anim frame
+frame material anim material
+bone bone
+1.0 frame texture vertex 0.500000 material texture frame texture
+vertex vertex =
+= frame frame -1 material texture
+bone texture 0.500000 1.0 anim
+0.500000 = 1.0 material
+texture 1.0 1.0 vertex anim 0.500000
+vertex vertex 0.500000
+texture
+= -1 1.0 =
+bone
+vertex
+1.0 bone 0.500000 vertex material 0.500000 0.500000 =
+=
+0.500000
+vertex
+vertex 0.500000
+vertex -1 1.0 texture = material anim texture
+bone 0.500000
+frame = bone vertex vertex
+1.0 texture
+vertex
+material
+bone
+vertex texture 0.500000 -1
+-1 frame bone vertex anim frame vertex -1 0.500000
+texture texture texture
+material texture vertex
+-1 0.500000
+vertex
+anim
+bone 0.500000 vertex anim
+frame 1.0 = vertex = bone = anim anim anim 1.0 vertex texture
+0.500000 = frame frame material texture
+material -1
+= vertex 1.0 -1 bone frame 1.0 texture 1.0 0.500000 1.0 anim texture bone -1 material -1 bone
+frame
+texture vertex anim -1 material material anim -1 texture -1 anim 0.500000 1.0 vertex 1.0 bone 1.0 material
+anim frame anim 1.0 0.500000 bone 1.0 = material -1 texture
+1.0 bone vertex material frame
+bone anim vertex = 1.0 0.500000
+texture 0.500000 texture
+anim
+vertex material
+material = = 1.0 =
+-1 1.0
+vertex frame = frame anim -1 = vertex frame texture bone texture 1.0
+anim material
+0.500000 bone frame = anim 0.500000 -1 0.500000 vertex bone
+texture vertex 1.0 material vertex texture frame
+-1 1.0
+frame bone anim
+vertex 0.500000
+anim = vertex
+1.0 texture
+bone
+material frame = = material texture frame
+= -1 = vertex 0.500000
+=
+bone vertex frame = texture
+vertex = frame =
+vertex
+-1
+1.0 -1 -1
+bone
+frame anim 0.500000 anim texture anim
+vertex vertex bone vertex anim
+vertex 1.0
+0.500000 0.500000 -1 bone 1.0 =
+=
+1.0 0.500000 = 0.500000
+texture
+1.0 = = 0.500000
+material texture
+=
+frame = texture
+material vertex a
\ No newline at end of file
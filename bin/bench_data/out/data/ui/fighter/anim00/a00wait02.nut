@@ -0,0 +1,4 @@
+= = frame anim
+frame anim
+material
+texture mater
\ No newline at end of file
@@ -0,0 +1,59 @@
+bone = material texture texture material
+texture bone -1 =
+bone -1
+= -1 0.500000 0.500000 -1 = = -1 frame
+texture vertex
+material
+1.0 texture = texture
+material texture material -1
+vertex frame
+= bone
+material 1.0 1.0 frame bone 1.0 vertex material
+-1
+bone = material 0.500000 1.0
+-1 bone
+material 0.500000 frame anim bone bone
+material
+frame anim bone 1.0
+texture frame 1.0 -1 anim
+anim 0.500000 vertex =
+0.500000
+texture -1 bone 0.500000
+bone 0.500000 0.500000
+0.500000 1.0
+0.500000 vertex vertex texture bone material anim
+-1 0.500000
+anim 0.500000 anim vertex frame
+1.0
+bone material
+-1 anim 1.0
+1.0 1.0 0.500000 -1 = anim vertex
+0.500000 frame vertex 1.0
+vertex bone 0.500000
+0.500000 bone material texture
+material
+= texture material texture
+material material = material vertex
+0.500000
+0.500000 1.0 bone 0.500000 1.0 texture material anim anim vertex frame frame
+-1 1.0 frame frame vertex bone 1.0 0.500000 texture frame 0.500000
+anim texture material vertex anim 0.500000
+= anim bone 0.500000
+bone 1.0 = 0.500000 vertex bone frame texture 1.0
+vertex 1.0
+vertex frame = frame
+vertex vertex -1 anim 1.0
+=
+bone texture
+vertex material 0.500000 0.500000
+material anim = frame
+0.500000 =
+texture
+texture
+bone
+frame 1.0 texture texture
+=
+bone frame
+anim vertex
+0.500000 = vertex 1.0 anim vertex anim material vertex 0.500000 = = texture = =
+0.500000 1.
\ No newline at end of file
@@ -0,0 +1,49 @@
+=
+bone texture -1 material
+texture 1.0 vertex -1
+vertex 0.500000
+= texture vertex texture material 0.500000 frame 1.0
+texture = 0.500000 vertex anim frame = -1 anim 1.0 1.0 0.500000
+vertex texture
+1.0
+bone texture texture -1
+frame
+anim
+frame 1.0
+=
+vertex
+1.0 vertex material texture
+frame 0.500000 1.0 1.0 = 1.0 frame 1.0 anim anim
+bone 1.0
+material
+vertex 1.0 -1 texture 1.0 = anim material -1 1.0 bone -1
+0.500000 anim -1 bone texture bone bone frame 1.0
+1.0 vertex = vertex bone frame frame frame
+vertex = 0.500000 material frame bone vertex
+texture bone vertex -1 0.500000 anim anim 0.500000 texture =
+frame vertex 1.0 vertex
+1.0 frame texture
+bone bone frame frame texture 0.500000
+anim bone vertex anim 1.0 frame
+1.0 -1
+anim vertex
+vertex material
+-1 -1 material = vertex bone 0.500000 frame bone frame 1.0 bone 1.0 bone
+-1 texture
+vertex = texture
+anim
+0.500000 =
+1.0 bone = bone = -1 frame 1.0 = texture
+anim anim bone
+bone texture bone frame
+frame vertex frame
+texture
+anim
+-1 -1 -1 = anim
+vertex vertex
+1.0 vertex
+anim texture material 1.0 anim
+1.0 bone anim material
+bone
+material texture
+-1 -1 -1 = 0.500000 texture 0.500000 -1 -1 anim frame 
\ No newline at end of file
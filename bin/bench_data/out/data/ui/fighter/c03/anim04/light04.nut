@@ -0,0 +1,16 @@
+anim
+material 1.0 0.500000
+vertex vertex vertex vertex
+vertex 1.0 -1
+= frame 1.0 = vertex frame -1
+-1 anim = bone -1 texture frame vertex
+texture
+vertex
+0.500000 = anim -1
+frame frame anim 0.500000 material
+texture frame = bone 0.500000
+anim anim material
+bone frame material
+-1 = = texture
+1.0 0.500000
+text
\ No newline at end of file
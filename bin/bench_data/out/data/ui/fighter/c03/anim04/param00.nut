@@ -0,0 +1,345 @@
+material texture texture
+anim -1 = anim frame
+texture vertex = 0.500000 1.0 = 0.500000 frame -1 = bone
+bone
+bone 0.500000 bone -1 1.0
+frame bone
+bone 1.0 0.500000
+material
+texture material -1 vertex anim -1 vertex vertex texture frame
+1.0 -1
+1.0 anim 0.500000 anim texture vertex bone -1
+texture -1
+frame 1.0 -1 vertex
+material
+material
+-1 0.500000 1.0
+vertex vertex 1.0 bone 0.500000 vertex
+-1 -1
+vertex frame -1 bone material
+anim
+0.500000 material 1.0 material 0.500000 frame material frame
+1.0 -1 0.500000 frame -1 vertex anim 0.500000 0.500000 0.500000
+0.500000 -1 =
+vertex = frame
+1.0 vertex bone bone frame -1 anim anim 0.500000 material -1 =
+1.0 vertex vertex
+= 1.0
+0.500000 = 0.500000
+bone texture texture
+frame -1 anim material vertex vertex frame 0.500000 bone
+texture =
+frame = texture = vertex vertex
+bone
+texture vertex = 0.500000 anim
+= 0.500000 = vertex material vertex texture
+-1
+0.500000 frame anim 1.0 texture material
+texture material anim texture frame frame bone -1
+texture -1 = bone bone texture
+1.0
+vertex 0.500000 vertex 1.0 0.500000 frame frame
+anim
+bone texture material = vertex
+vertex material frame anim -1 0.500000
+material = -1 = anim
+frame 0.500000 frame 1.0
+1.0 material texture -1
+texture 1.0 bone -1 texture anim texture texture
+frame
+texture vertex -1 bone -1 -1
+anim texture bone
+anim
+1.0 0.500000 texture anim
+texture 0.500000 anim = = bone material material
+1.0 = bone -1 frame
+anim
+frame 1.0 1.0 anim anim anim material
+frame
+= texture -1
+0.500000 material
+material
+vertex texture anim 0.500000 0.500000 -1 0.500000 anim 0.500000
+material texture
+0.500000 material 0.500000 0.500000
+anim frame -1 -1 0.500000 bone -1 1.0 0.500000 1.0 anim
+vertex
+1.0
+material 0.500000 frame 1.0
+-1 material bone 1.0 bone frame bone 1.0 texture material anim -1 -1 bone
+-1 1.0 = frame -1
+0.500000 material
+texture 1.0 -1 frame frame anim material = vertex
+material
+frame
+= 1.0
+texture
+1.0 material texture bone frame vertex
+vertex bone frame
+1.0 bone
+frame
+bone = material
+frame 1.0 material bone 1.0 frame -1
+vertex
+vertex = -1
+vertex material -1 frame =
+vertex -1 frame 1.0 frame -1 material bone -1 material material = 0.500000 anim texture bone
+1.0
+-1 material material anim
+frame -1 material
+anim
+anim bone
+bone anim anim = bone anim 1.0 frame = 1.0 -1 vertex
+1.0
+texture
+frame material material frame bone texture
+= bone texture frame anim
+0.500000 anim
+vertex = anim 1.0
+vertex
+texture frame
+anim
+1.0 vertex material vertex
+bone texture
+texture frame
+frame
+material frame 0.500000 anim frame 0.500000 frame
+= texture texture
+bone = 0.500000 frame
+frame bone
+= vertex 0.500000 texture texture
+anim bone anim texture material material 0.500000 material anim texture frame
+frame -1 material 1.0 1.0
+texture 0.500000 frame
+= -1 vertex vertex frame -1 vertex texture anim
+-1
+-1 material
+vertex
+1.0 bone vertex vertex -1 =
+= 1.0 texture bone 0.500000 bone
+texture bone anim
+material
+material =
+1.0 0.500000 = frame material -1 material bone vertex vertex
+anim 0.500000 0.500000 texture texture bone = 1.0 vertex vertex 0.500000
+texture
+texture bone texture material frame material -1 texture
+1.0
+frame texture
+= frame
+anim
+-1
+anim texture = 1.0 vertex 1.0 frame vertex 0.500000 1.0 0.500000 bone texture = 0.500000
+frame texture material -1
+0.500000 0.500000
+anim = material
+-1 material -1 material
+anim vertex anim = =
+-1
+-1
+1.0 texture
+anim = frame
+texture
+texture
+=
+anim
+1.0 0.500000
+anim 1.0 frame material
+vertex texture frame texture material
+-1
+= frame texture -1 =
+anim 0.500000 0.500000 vertex texture
+= frame vertex -1 -1 bone -1 =
+0.500000 1.0 bone = 0.500000 = bone = bone anim material -1
+-1
+vertex
+frame
+frame
+-1 bone =
+texture -1 anim =
+material bone
+bone
+bone 0.500000 -1 texture anim material
+texture anim
+vertex vertex -1 texture 0.500000 frame
+anim 0.500000 = -1
+texture bone = 1.0
+vertex material bone
+frame -1 bone
+anim
+1.0 material frame
+material
+0.500000
+anim vertex
+-1
+= 1.0 1.0 0.500000
+anim vertex 0.500000 texture -1
+anim = vertex =
+texture = 0.500000 = -1 anim vertex material
+bone
+material = 0.500000
+1.0 material = texture texture 0.500000 1.0
+bone vertex material bone
+material =
+material bone bone = bone frame
+0.500000 =
+vertex bone
+vertex 0.500000
+texture anim bone texture
+vertex
+anim vertex =
+-1 vertex
+anim frame
+vertex = frame bone anim frame bone = material material -1 -1 = 1.0
+bone
+material vertex -1 1.0 bone frame anim frame frame
+anim bone 1.0 bone anim
+1.0 1.0
+anim frame
+material frame
+-1 material anim
+frame anim material texture
+texture
+0.500000 anim -1 vertex 0.500000 0.500000 1.0 material
+-1 = anim -1 -1 vertex 0.500000 1.0 texture texture anim material anim
+0.500000 texture -1
+texture anim material frame frame bone
+0.500000 texture anim
+0.500000 vertex bone
+1.0 bone -1 bone bone anim texture
+= 0.500000
+texture frame =
+vertex anim bone bone
+texture anim material -1 bone frame = 0.500000 0.500000
+1.0 material 1.0 material texture -1
+bone 1.0 1.0 frame bone =
+-1 material
+anim anim
+bone material
+-1
+frame vertex texture
+material 1.0 material anim frame
+texture =
+1.0 0.500000 -1 material bone = texture = 0.500000 -1 texture material texture texture texture
+1.0
+= -1
+1.0 material 0.500000
+vertex frame -1 bone
+anim
+-1
+0.500000 vertex bone texture = 1.0 vertex texture texture
+1.0
+bone material anim -1 -1 texture material
+0.500000 material 0.500000 anim 0.500000 1.0 = bone vertex
+bone texture anim frame
+-1 frame
+texture vertex texture
+frame bone =
+texture anim 1.0 = anim bone 0.500000 -1 -1
+frame
+anim bone texture anim vertex material -1 vertex vertex texture -1 = anim frame frame texture
+bone -1 vertex
+frame -1
+bone
+material frame bone
+-1 anim texture frame anim -1 frame
+1.0 material 1.0 vertex material
+bone
+1.0 -1 frame -1 anim -1 texture material = anim
+vertex = 0.500000 vertex material vertex
+frame material 1.0
+texture vertex = texture
+frame
+frame
+= material frame frame frame
+vertex frame 0.500000 bone texture -1 1.0
+-1 anim
+bone
+vertex = frame
+vertex anim
+=
+material vertex = -1
+texture vertex anim vertex = 1.0
+texture -1 -1
+bone material
+-1 anim bone
+material 1.0
+0.500000 anim texture 0.500000 0.500000 0.500000 anim
+1.0
+1.0 -1
+-1 = texture
+material material texture material vertex frame -1
+texture
+frame
+1.0 1.0 vertex
+anim 1.0 =
+frame material bone = bone -1 =
+bone 0.500000
+texture frame 1.0 bone
+anim frame
+frame texture -1 frame anim anim texture -1
+1.0 = bone bone texture 1.0 0.500000 anim anim bone -1 frame anim
+texture 0.500000 bone 0.500000 anim material = = texture
+frame 1.0
+bone = anim
+anim bone
+vertex 1.0 frame =
+material vertex vertex 1.0 -1 1.0 1.0 0.500000 bone 1.0 vertex 0.500000 material material -1
+texture
+frame frame 1.0
+1.0
+-1 0.500000 anim material
+0.500000 0.500000 anim 0.500000
+material 1.0 anim -1
+bone 1.0 bone bone texture material anim vertex anim
+bone
+0.500000
+-1 vertex
+bone 0.500000
+1.0 anim anim
+anim 1.0 texture
+material 1.0 =
+material 0.500000 bone anim = texture
+= vertex
+anim vertex 1.0
+texture vertex -1 1.0 bone 0.500000
+frame frame
+material
+1.0 frame material frame 0.500000
+bone 1.0 vertex -1 1.0 1.0
+-1 -1 0.500000 = = frame material texture bone bone material material bone
+anim = material 1.0 1.0 = frame frame material
+texture 0.500000 0.500000
+material
+texture = texture = material
+vertex
+bone texture
+material
+texture texture texture material vertex material bone bone 0.500000 bone -1 1.0 = material material frame texture frame -1
+1.0 = = frame -1 texture
+vertex anim vertex
+0.500000
+1.0 anim bone 0.500000 frame material frame bone bone texture material
+-1 anim
+0.500000 material
+material texture =
+0.500000 vertex anim
+=
+-1 vertex
+frame 0.500000 texture vertex vertex
+anim anim
+-1 texture anim
+=
+=
+1.0 anim
+bone 1.0
+texture texture texture -1
+material texture 0.500000 1.0 0.500000 =
+vertex texture material texture vertex 0.500000 material
+bone 1.0
+1.0 material material frame frame
+texture = bone = = = texture bone vertex bone
+texture material
+0.500000 material anim
+vertex
+1.0 bone mate
\ No newline at end of file
@@ -0,0 +1,102 @@
+1.0 texture
+-1 =
+anim
+bone
+bone -1 1.0 1.0 0.500000 bone
+texture texture material bone
+1.0
+= texture -1 frame 0.500000 -1 = 1.0
+bone anim
+= 0.500000 -1 texture bone
+= frame anim frame
+frame material 0.500000 vertex texture
+vertex 1.0 bone material texture frame texture anim
+texture
+1.0 = frame
+1.0 material texture vertex 0.500000
+-1 = 1.0 anim 1.0
+frame vertex frame material -1 -1 -1 frame
+texture
+material
+anim
+texture -1
+texture bone anim material = 1.0 0.500000 -1 = 1.0 bone -1 = material 0.500000
+0.500000 texture bone
+-1
+0.500000 =
+anim
+material 1.0
+1.0
+vertex vertex bone anim material
+0.500000 1.0
+= -1
+texture bone = frame
+0.500000 texture
+vertex anim -1
+frame
+-1 anim texture
+1.0 bone -1 anim bone frame -1 bone
+0.500000
+anim vertex 0.500000 bone 0.500000 1.0 anim anim anim bone texture frame
+texture 0.500000 = vertex bone anim frame texture texture
+= 1.0 bone anim -1 -1 frame =
+=
+bone 0.500000 vertex 0.500000 vertex anim bone anim = frame
+= vertex
+bone anim
+frame anim vertex material material
+vertex bone
+bone anim material -1 1.0
+anim frame
+bone
+material -1 frame frame -1 material texture material bone
+texture = anim 1.0 bone
+frame frame texture
+bone bone = 1.0 texture texture frame anim 0.500000 material = 1.0
+anim bone 1.0 anim
+-1 anim 1.0 texture 1.0 0.500000 anim
+material -1 -1 frame anim
+1.0 bone frame bone material
+0.500000 = material texture frame material
+vertex
+anim anim
+material texture
+-1 texture
+-1 vertex texture material texture 0.500000 texture 0.500000 material frame vertex
+0.500000 -1 0.500000 bone 0.500000
+=
+-1 bone 0.500000
+= material 0.500000 material
+1.0 -1 texture -1 texture -1 bone 0.500000 material
+=
+0.500000
+material 0.500000 frame vertex 0.500000
+= frame
+frame vertex
+frame anim
+0.500000 1.0 =
+texture -1
+texture 0.500000
+0.500000 texture 0.500000
+-1 texture 1.0
+bone 0.500000
+bone
+= = material material texture bone texture 1.0
+vertex
+0.500000 anim anim anim = 0.500000 texture anim bone -1 -1 0.500000 anim vertex =
+texture anim material anim bone material vertex anim
+1.0 vertex -1 = 1.0
+anim -1 bone 1.0 bone material anim bone material 0.500000 material frame
+anim texture = anim frame frame 1.0 bone vertex bone
+0.500000 -1
+frame =
+anim frame frame anim texture
+= vertex anim frame material texture material -1
+vertex bone vertex frame texture
+0.500000 =
+anim
+vertex
+frame
+anim bone anim material -1 frame
+= texture material vertex 1.0 texture
+anim
\ No newline at end of file
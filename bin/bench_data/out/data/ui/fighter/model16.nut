@@ -0,0 +1,17 @@
+bone material = vertex
+vertex
+=
+1.0
+bone bone 1.0
+1.0 material 1.0 1.0 0.500000
+frame
+frame
+0.500000 anim
+vertex 0.500000
+bone
+0.500000 vertex
+texture
+-1 =
+vertex 1.0 vertex 0.500000 anim
+anim 0.500000 1.0 anim
+= -
\ No newline at end of file
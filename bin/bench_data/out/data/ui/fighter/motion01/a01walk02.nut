@@ -0,0 +1,72 @@
+1.0
+=
+anim vertex -1 0.500000 vertex
+vertex anim material frame vertex
+anim
+-1 bone -1 vertex texture -1 1.0 =
+anim frame 0.500000 bone material
+-1 vertex = material
+material frame
+bone 1.0 0.500000 -1 vertex
+1.0 1.0 material
+1.0 frame
+vertex vertex vertex vertex material
+1.0 bone
+frame
+texture
+texture frame -1 = vertex
+bone texture -1 bone
+=
+material material vertex 1.0 0.500000 anim texture
+vertex vertex frame 1.0
+= -1 =
+= vertex 0.500000 -1 0.500000 -1
+1.0
+bone -1 material
+= anim 1.0 =
+frame 1.0 texture 0.500000
+vertex frame frame
+-1 bone
+texture
+1.0 bone anim
+-1
+bone =
+-1 bone 0.500000 texture = vertex
+0.500000 = texture vertex bone vertex
+vertex -1 = = texture
+frame anim
+frame vertex frame frame
+bone 0.500000 frame anim vertex 1.0 1.0 0.500000 1.0 1.0 0.500000 0.500000 texture
+0.500000 -1 anim -1 vertex 1.0 = frame anim material
+-1 anim material bone -1
+1.0 bone
+anim material 0.500000
+vertex texture =
+material material
+vertex vertex 1.0
+anim
+frame material
+texture
+bone bone material anim 0.500000 material
+vertex material
+-1 0.500000 vertex anim vertex frame -1 frame texture -1
+0.500000 texture
+1.0 vertex 1.0 0.500000
+material 0.500000 frame bone bone texture frame frame
+material
+anim frame frame bone
+vertex vertex = texture bone
+anim
+material 0.500000
+1.0 bone vertex
+material -1
+bone bone
+-1 =
+bone bone frame -1 vertex
+-1 frame
+texture frame texture
+bone material 0.500000 texture 1.0 = -1 -1 0.500000 1.0
+1.0 1.0 0.500000 bone material frame 0.500000 vertex anim bone frame 1.0
+1.0 material
+texture 0.500000 vertex texture vertex anim -1 material texture
+anim anim vertex texture -1 mat
\ No newline at end of file
@@ -0,0 +1 @@
+qd6Bd#4_iLT\b4\r'v2쏊PCvQÿ~AvHG49;
\ No newline at end of file
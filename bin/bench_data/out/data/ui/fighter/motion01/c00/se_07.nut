@@ -0,0 +1,12 @@
+texture
+material
+texture frame 1.0 = = 0.500000 bone -1
+anim
+material
+-1
+texture
+-1 vertex -1 anim anim
+=
+anim bone texture
+frame
+frame 1.0 bone material vertex = vertex anim frame frame 0.500000 
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex 1.0 texture
+= anim anim material bone texture bone 
\ No newline at end of file
@@ -0,0 +1,109 @@
+0.500000
+0.500000 0.500000 -1
+material
+1.0 1.0 material material
+0.500000 =
+frame 1.0 = vertex vertex
+1.0 = texture 1.0 -1 1.0 0.500000 vertex
+1.0 texture
+0.500000 texture = material 0.500000 frame 0.500000 anim
+frame bone = vertex vertex material vertex = -1 anim
+material
+material -1 = material bone = 0.500000 = frame 0.500000
+frame
+material material -1 =
+texture vertex = = anim bone 0.500000
+1.0 1.0 material
+1.0 bone
+texture frame
+vertex
+frame bone 1.0
+-1 frame texture frame bone frame material -1 1.0 -1 = = material bone 1.0 material 1.0
+frame material frame vertex 1.0
+frame = vertex
+vertex = vertex bone vertex 0.500000 -1 frame texture material vertex vertex =
+anim bone -1
+texture frame vertex
+0.500000
+anim anim 1.0 =
+texture 0.500000 0.500000 frame frame -1 texture anim anim texture vertex texture -1 -1 vertex anim =
+material bone
+anim
+material material 0.500000 frame -1 =
+anim
+0.500000 0.500000
+vertex texture 0.500000 texture texture material material
+vertex
+anim
+1.0 texture frame texture -1
+1.0 -1 material texture 0.500000 -1 texture
+bone
+-1 anim
+frame anim 1.0 0.500000 1.0
+bone material
+0.500000 anim material bone 0.500000 -1 anim frame
+anim -1 vertex 0.500000 frame = bone texture = 0.500000 -1 frame
+texture 1.0
+frame material 1.0 frame
+= = 0.500000 bone
+1.0 frame
+bone frame 0.500000 1.0 texture bone -1 texture = 1.0 anim
+-1 texture vertex vertex
+frame
+vertex bone = -1
+= frame anim texture texture 0.500000 = 0.500000 frame = -1 vertex texture anim -1 frame anim
+frame bone material frame
+1.0 material frame 0.500000
+1.0 1.0 frame 0.500000 1.0 -1 0.500000 1.0 = frame
+-1 0.500000 -1 1.0
+material 1.0
+vertex 1.0 anim -1 bone 1.0 material material
+0.500000 anim 0.500000 frame 1.0 texture frame -1 vertex 1.0 1.0 1.0 =
+material bone frame bone material
+bone bone -1 -1 = anim = material texture frame
+texture = bone =
+0.500000 anim =
+-1 frame =
+material 1.0 vertex
+0.500000 bone -1
+anim 1.0 = vertex bone vertex
+frame
+bone = texture =
+material 1.0 texture
+bone anim
+=
+material
+vertex vertex = bone bone 0.500000
+bone material vertex frame texture = material 1.0 anim bone anim anim
+= bone anim frame anim
+frame anim 0.500000
+texture bone bone bone
+texture
+anim vertex anim
+-1 anim
+material 0.500000 1.0 vertex
+texture 1.0
+texture vertex anim texture
+bone =
+-1 vertex frame 0.500000
+1.0 = = 0.500000 bone vertex
+vertex
+-1 anim vertex
+texture anim material material =
+0.500000 anim
+-1 bone texture anim anim
+vertex
+bone material material
+texture =
+-1 -1
+anim frame =
+texture
+texture 0.500000 material material
+anim 0.500000 vertex material 0.500000 frame
+0.500000
+material vertex texture bone material bone anim -1 frame -1 1.0 1.0 1.0 0.500000
+0.500000 texture
+0.500000
+1.0
+-1 vertex -1 bone anim material anim -1
+texture
\ No newline at end of file
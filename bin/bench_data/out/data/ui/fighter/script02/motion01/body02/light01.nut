@@ -0,0 +1,7 @@
+material
+0.500000 anim
+-1
+anim
+texture = = material = anim frame bone 0.500000
+texture
+-1
\ No newline at end of file
@@ -0,0 +1,25 @@
+bone frame bone bone -1 = vertex bone
+1.0 = bone 1.0 bone anim bone
+1.0
+texture
+bone frame
+1.0 1.0 0.500000 =
+bone vertex
+texture = =
+vertex = 1.0
+material
+= frame
+material =
+anim vertex 1.0 0.500000 vertex texture
+vertex material -1 0.500000 material texture texture texture
+vertex = material -1 -1
+-1 material vertex vertex 0.500000 texture
+anim texture texture 0.500000 bone
+frame anim
+vertex -1 -1 texture material
+material -1 anim 0.500000
+0.500000 frame -1 texture -1 bone bone vertex texture bone
+bone anim texture 1.0 anim 1.0 0.500000 -1 1.0 material texture 0.500000
+= texture
+-1 -1 anim bone -1 bone
+= 1.0 -1 0
\ No newline at end of file
@@ -0,0 +1,12 @@
+material = vertex 1.0 -1 material = frame = frame texture = 1.0 frame
+frame -1
+0.500000 1.0
+1.0 -1 1.0 vertex texture frame 1.0 0.500000
+0.500000 bone frame
+bone material -1 -1
+frame bone -1 -1 material
+vertex texture texture texture 0.500000
+anim material anim
+frame
+bone vertex vertex vertex material vertex 1.0 frame 0.500000 anim anim anim 1.0
+text
\ No newline at end of file
@@ -0,0 +1 @@
+GC}E*!3JȲ|m!W59kA"DE(>3
\ No newline at end of file
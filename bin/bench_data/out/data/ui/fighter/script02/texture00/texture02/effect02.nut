@@ -0,0 +1,2 @@
+Z+NLGEfsMceԲgq{sb4t&Q$/N
+11
\ No newline at end of file
@@ -0,0 +1 @@
+]z5.зCr?㏋?3YųQX̣El|#2OnA*#OOB{f"u	MYr`HQƜzNP.4O|)L%j@&>4b/P8y(lTR@
\ No newline at end of file
@@ -0,0 +1,92 @@
+anim material 1.0
+=
+0.500000
+bone -1
+-1
+anim bone =
+-1 0.500000
+frame texture 0.500000
+bone
+material -1 texture -1 material
+bone material 1.0 frame vertex texture = vertex texture bone
+bone -1 0.500000 texture bone texture bone = vertex texture -1 anim -1 1.0 bone -1
+bone texture texture material material material
+1.0 anim
+bone bone bone bone -1
+frame = = -1 vertex = = anim = 1.0
+-1 0.500000 -1 0.500000 = bone vertex vertex anim material
+vertex =
+frame
+anim texture material
+texture
+1.0 -1 anim frame
+=
+vertex -1 frame material vertex 1.0
+vertex vertex bone
+frame texture texture 0.500000
+texture 1.0 vertex
+texture
+frame = material frame 0.500000 = 1.0 texture -1 anim material
+1.0 texture 0.500000 = -1 bone anim 1.0
+0.500000 vertex
+frame vertex 0.500000 0.500000 1.0 0.500000 vertex
+material material frame material vertex vertex -1
+-1 = texture material
+bone
+texture
+=
+-1 = anim material vertex texture =
+anim material 0.500000 frame
+-1 material frame texture
+frame
+-1
+1.0
+=
+-1 vertex
+texture
+bone texture bone anim -1
+frame -1 anim material = -1 texture
+frame
+-1 = 1.0 texture 1.0
+1.0 material material = = 1.0 = -1 -1 anim -1
+vertex texture
+texture 0.500000 texture
+= 0.500000 vertex =
+= 0.500000 frame 1.0 1.0 = anim
+-1 1.0
+0.500000 = 1.0 -1 -1 =
+= =
+1.0 0.500000 bone vertex -1
+1.0 -1 0.500000 -1 material 1.0 vertex -1 texture material 0.500000
+anim frame 0.500000
+0.500000 frame 1.0 vertex
+anim
+= = = frame anim material texture material
+1.0 material 0.500000 bone anim anim vertex bone texture 1.0 bone frame -1
+0.500000
+frame -1 anim
+= vertex frame = texture
+0.500000
+frame = bone
+= -1 texture
+texture vertex
+vertex -1
+texture frame = vertex
+frame bone -1 =
+frame 0.500000 frame 0.500000 material = -1 texture = vertex = frame vertex
+texture bone material -1 material anim =
+-1 anim 0.500000
+texture 1.0 bone anim 1.0 1.0 frame anim material 0.500000
+0.500000 1.0 frame material material =
+bone anim
+0.500000 vertex material frame
+-1 0.500000 anim
+frame 0.500000 frame -1 -1
+vertex frame bone 0.500000 texture
+material -1
+bone vertex 0.500000
+texture
+1.0
+anim
+1.0 -1 1.0 1.0 vertex anim texture texture = bone
+frame = 0.500000 vertex anim textu
\ No newline at end of file
@@ -0,0 +1,17 @@
+material
+0.500000
+1.0 1.0
+vertex 1.0 vertex
+anim frame material 0.500000
+vertex
+texture vertex vertex frame frame vertex 1.0
+0.500000 material
+bone
+anim
+material 1.0 vertex material
+bone 0.500000 1.0 frame frame bone vertex frame anim 1.0 material
+0.500000
+material 1.0 texture anim vertex = vertex frame bone
+bone
+bone frame -1 texture
+bone vertex textur
\ No newline at end of file
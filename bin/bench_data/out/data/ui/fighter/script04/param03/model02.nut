@@ -0,0 +1,294 @@
+bone vertex -1 -1 bone vertex anim 1.0 = 0.500000 0.500000 anim 1.0 material
+vertex vertex 1.0 vertex
+material material 1.0 1.0 -1 anim bone bone bone = 0.500000 bone 1.0 -1 anim 1.0 frame 1.0
+bone texture
+0.500000 0.500000 bone material 0.500000 -1
+0.500000
+anim -1 material anim anim 0.500000 = 1.0
+-1 vertex anim frame
+-1 bone 0.500000 frame = texture material -1 material
+0.500000
+vertex anim
+anim
+= -1
+material 1.0 frame
+0.500000 texture bone
+1.0 = texture 1.0 bone frame = anim 0.500000 bone bone
+-1 -1 = -1 anim
+anim
+frame vertex 0.500000 0.500000 vertex
+-1 vertex
+frame
+-1 texture material 1.0 texture 0.500000 =
+bone texture bone = material
+-1 bone material frame
+frame = frame frame vertex
+texture frame material frame texture
+0.500000 -1
+anim
+vertex
+-1
+texture frame material texture bone vertex
+= bone anim
+vertex 1.0
+anim
+frame 0.500000 -1 texture
+0.500000
+vertex = -1 vertex vertex bone = bone 1.0 = material bone
+= bone anim material
+material = material =
+bone 1.0 bone vertex 1.0 -1 vertex = = frame bone -1 material -1 material
+-1 frame anim
+bone
+0.500000
+vertex vertex
+-1 1.0 = material material
+frame material 1.0 -1
+anim -1
+texture
+= bone vertex 1.0
+-1 texture
+=
+bone material frame bone vertex -1 1.0 = vertex
+vertex
+1.0
+1.0 1.0 -1 0.500000
+1.0 vertex
+anim texture
+texture
+texture material -1 =
+1.0 = bone vertex anim = vertex
+0.500000 bone anim bone
+material texture
+-1 material
+bone
+frame
+vertex 1.0 anim
+=
+1.0 0.500000 0.500000
+1.0
+anim
+material
+= vertex = -1 -1
+0.500000 material = -1 texture = 0.500000
+0.500000
+0.500000
+vertex frame
+anim frame 1.0 vertex 0.500000
+0.500000 1.0 -1 texture
+bone vertex
+-1 vertex 1.0
+-1
+anim vertex bone
+texture texture 0.500000 1.0
+0.500000
+0.500000
+vertex
+anim -1 frame 1.0 bone texture anim
+=
+= anim
+texture 1.0 anim =
+vertex material bone -1 -1
+anim = -1
+-1 1.0 bone texture -1
+1.0 anim vertex 0.500000 =
+texture
+texture
+-1 material
+anim =
+= texture frame material 1.0
+vertex 0.500000 vertex 1.0 material material anim anim frame bone = vertex
+bone
+= 1.0 frame
+material anim
+-1 bone texture anim bone
+material bone
+frame
+1.0
+=
+0.500000 anim 1.0 vertex bone
+vertex material
+frame vertex
+1.0
+frame frame anim 0.500000 vertex anim
+material 1.0
+= bone 0.500000 = anim texture
+bone vertex = -1
+= material
+texture texture
+0.500000 frame
+0.500000
+-1 vertex
+frame
+= -1 vertex texture = = texture frame 0.500000 bone anim 1.0 vertex material texture
+frame 1.0 texture vertex 0.500000
+frame
+vertex 0.500000 anim 1.0
+texture bone texture -1 = = vertex
+bone anim
+1.0 = texture
+material
+-1 frame texture material =
+vertex
+0.500000 material bone 1.0 0.500000
+anim texture
+vertex anim
+texture vertex
+texture
+frame 0.500000 material -1
+material 0.500000 =
+material texture vertex
+vertex
+vertex
+anim bone =
+anim = 1.0
+-1
+material vertex 0.500000
+anim
+vertex
+anim anim
+bone
+= material vertex material material frame
+anim -1 =
+texture -1
+vertex
+frame 1.0 anim anim = vertex 1.0 bone material texture 0.500000 =
+anim 1.0 = 0.500000 0.500000 -1 texture material
+anim bone
+-1 -1 material 0.500000 anim vertex
+= anim 0.500000 texture anim bone frame =
+frame material 1.0
+bone bone
+-1 anim
+material
+anim frame 1.0 texture 0.500000 vertex frame -1
+texture
+material
+material frame
+-1 anim anim 1.0 frame
+-1 1.0
+= -1 vertex
+frame anim 0.500000 material bone material anim vertex
+1.0 1.0 material frame vertex frame
+bone texture =
+material texture
+-1 1.0 anim
+vertex bone = texture
+1.0
+frame vertex material = vertex frame
+frame material
+0.500000 vertex
+1.0 material frame -1 texture 0.500000
+bone
+bone texture vertex vertex 0.500000 material anim -1 vertex frame texture frame anim
+vertex 0.500000 anim
+= texture
+=
+1.0 vertex bone
+1.0 =
+vertex frame vertex 1.0 -1
+anim
+frame frame frame material
+texture 0.500000
+texture material 0.500000
+anim -1 1.0 -1 bone texture -1 -1 anim anim -1 = -1 = material
+bone = vertex -1
+anim
+vertex 0.500000 0.500000
+texture bone = -1 texture 0.500000 bone
+= anim vertex texture frame frame texture texture bone
+frame =
+anim bone -1 frame =
+vertex vertex texture texture
+= 0.500000 0.500000 -1 material frame =
+frame 1.0 anim 0.500000 0.500000 frame 1.0 bone anim
+-1 texture 1.0 material bone anim material anim 0.500000 bone -1 material material -1 -1 -1 texture =
+bone = material bone material
+anim
+texture
+vertex = texture
+1.0
+frame -1 -1
+=
+material 1.0
+bone anim 0.500000 anim
+-1
+vertex vertex
+1.0
+1.0 1.0 = 1.0 vertex bone
+vertex material = -1 material anim
+=
+1.0 frame vertex material
+0.500000 -1 anim vertex
+frame texture
+material texture = =
+frame texture bone = -1 -1 vertex 1.0
+material 0.500000 = -1 -1 bone
+vertex vertex texture
+1.0 vertex vertex material = anim -1
+-1
+-1 1.0 =
+frame frame -1
+vertex 0.500000 material anim texture = vertex texture texture
+bone
+= 0.500000 frame anim vertex texture anim 1.0
+bone
+frame
+bone texture anim material vertex -1 vertex
+anim
+anim anim texture
+texture
+0.500000
+1.0
+1.0 1.0 0.500000 texture
+bone 0.500000 anim
+texture anim
+-1 texture 0.500000 bone 0.500000
+vertex texture =
+0.500000 anim 1.0 1.0 -1 = vertex
+texture bone
+1.0 vertex 1.0 material = anim
+vertex 0.500000
+1.0 material
+= 0.500000 frame =
+0.500000 anim
+texture = -1 0.500000
+1.0 frame vertex
+vertex
+0.500000 vertex
+0.500000
+1.0
+1.0 bone material 0.500000 anim frame
+= texture frame
+texture
+texture
+texture 1.0 frame
+frame 0.500000
+0.500000 1.0 frame texture material bone 0.500000 anim
+bone 0.500000
+vertex = texture
+1.0 1.0 -1 texture = frame 0.500000 0.500000 vertex frame 0.500000 material
+anim texture bone -1
+anim = bone anim anim anim bone material material
+-1 bone bone
+texture texture material texture
+= bone material bone vertex vertex 1.0 1.0 vertex material 0.500000 0.500000 0.500000 1.0 bone 0.500000 texture
+-1 bone vertex frame bone
+bone
+0.500000 = material bone anim bone texture
+material
+-1
+bone anim frame =
+0.500000 vertex frame
+material bone 0.500000 material bone
+anim
+0.500000 vertex vertex 1.0 -1
+material = frame texture bone texture -1
+texture
+= vertex texture
+material texture
+texture anim = bone bone 1.0 texture
+bone 1.0 1.0 0.500000
+material bone material
+= frame -1
+texture vertex = 
\ No newline at end of file
@@ -0,0 +1,14 @@
+= 0.500000 = 0.500000 -1 bone
+=
+frame = 0.500000 frame 0.500000 material = 0.500000 texture material anim material anim = vertex
+0.500000 -1
+0.500000 anim bone frame 0.500000 texture bone
+frame anim vertex
+0.500000 bone texture 0.500000
+frame -1 -1 material
+0.500000
+frame vertex -1 0.500000 texture bone 1.0
+1.0 bone 0.500000 bone material bone -1
+frame texture
+vertex
+texture material b
\ No newline at end of file
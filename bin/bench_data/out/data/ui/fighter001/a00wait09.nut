@@ -0,0 +1,6 @@
+1.0 1.0 0.500000 bone
+vertex = frame
+texture material
+-1 anim material -1 = vertex -1 0.500000 1.0 texture
+0.500000 bone bone texture texture 1.0 = = vertex bone
+frame bone 0.500000 0.500000 anim 1.0 texture
\ No newline at end of file
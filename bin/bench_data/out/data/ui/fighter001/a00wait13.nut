@@ -0,0 +1,3 @@
+0.500000 = material bone
+= bone bone anim
+-
\ No newline at end of file
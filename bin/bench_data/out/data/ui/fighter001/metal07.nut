@@ -0,0 +1,28 @@
+anim vertex -1 = 0.500000 texture vertex = 1.0 anim vertex -1 material 0.500000 frame 1.0 texture = frame
+-1 vertex material 1.0
+anim bone texture vertex vertex material -1 frame
+-1 1.0 anim
+-1 -1 bone material -1 frame 0.500000
+1.0 material 0.500000 texture -1 anim frame = frame
+texture 1.0
+frame vertex bone anim 1.0 1.0 texture texture 0.500000 frame 0.500000 -1 bone anim material material 0.500000 vertex material
+= 1.0 0.500000
+vertex -1 bone vertex anim
+material anim 1.0 frame bone material frame texture vertex texture frame -1 bone 0.500000 0.500000 anim
+anim
+vertex bone
+= texture 1.0 anim 0.500000 vertex anim anim 0.500000 1.0 material
+frame -1 =
+bone bone bone anim -1 frame bone
+texture bone bone frame material
+anim 1.0 0.500000 = frame texture 1.0 1.0 =
+vertex
+1.0
+bone material texture vertex 1.0 1.0 -1
+-1 1.0 0.500000
+-1 bone 0.500000 anim 1.0 anim texture
+bone bone bone
+texture vertex
+anim frame 1.0 material vertex material
+anim bone
+vertex tex
\ No newline at end of file
@@ -0,0 +1,62 @@
+frame frame frame 1.0
+anim texture
+-1 = vertex = anim -1 =
+vertex material
+bone 0.500000 -1
+0.500000 1.0 bone
+1.0 -1 frame -1 texture anim material texture 0.500000 =
+bone anim texture 1.0
+material vertex 0.500000 texture 1.0 anim
+1.0
+texture
+bone bone frame frame
+vertex = texture = 0.500000
+anim = =
+anim -1
+texture vertex 1.0 texture -1 anim texture
+1.0 frame vertex material
+material vertex 0.500000 =
+-1 vertex vertex
+-1
+-1 0.500000
+frame anim
+1.0 frame bone texture anim
+-1
+material 0.500000
+frame bone
+anim texture 1.0
+1.0 bone 1.0 -1 material material anim -1 -1 frame anim
+vertex
+1.0
+anim material -1 vertex 0.500000 anim bone anim
+= 1.0 texture anim vertex frame
+frame
+0.500000 texture texture -1 1.0
+frame vertex frame 1.0 bone = 1.0 material 0.500000
+= material 1.0 -1 anim
+vertex anim 0.500000
+vertex bone 1.0 = bone bone
+-1 frame = 1.0 frame frame vertex = = vertex 0.500000
+-1 vertex = 0.500000
+frame frame vertex -1
+bone frame 1.0 bone anim 0.500000 anim texture -1 material = 0.500000
+anim
+0.500000
+anim 0.500000 vertex bone
+anim
+material anim bone 1.0 = = = bone 1.0 vertex anim -1 vertex bone texture vertex 1.0 frame anim vertex 1.0 -1
+material
+bone -1
+frame = bone 0.500000 anim -1
+anim vertex frame 1.0 vertex texture -1 texture 0.500000 texture anim 1.0 texture bone bone -1 1.0
+material anim anim
+-1
+vertex 1.0 bone
+material 0.500000 -1
+=
+frame =
+texture 1.0 = -1
+frame texture 1.0
+vertex bone
+0.500000 frame material
+texture texture 1.0 anim texture = frame = 0.500000
\ No newline at end of file
@@ -0,0 +1,88 @@
+bone frame
+-1 frame frame
+=
+frame = 1.0 frame -1 material
+texture vertex vertex bone vertex
+frame vertex
+bone -1
+1.0 texture vertex
+-1 vertex -1 -1 texture material texture =
+0.500000 texture anim frame 0.500000 vertex vertex anim
+= -1 anim 1.0 texture
+texture = vertex bone -1 bone vertex frame 0.500000 0.500000 texture = 0.500000 1.0 bone -1 -1 0.500000
+vertex texture
+material =
+0.500000
+material = =
+anim bone texture
+texture
+anim bone 0.500000 0.500000 frame
+frame
+vertex = -1 material = vertex 1.0 1.0 anim bone material 1.0 material 1.0
+= = 0.500000 -1 texture texture frame
+bone vertex bone
+texture bone
+material bone 0.500000
+anim material vertex 1.0 bone vertex anim 0.500000
+1.0
+bone
+1.0 anim -1
+= vertex material
+0.500000 anim material -1
+-1
+anim vertex bone vertex texture 1.0 0.500000 0.500000 -1
+anim 0.500000 texture = frame vertex material
+vertex = material = anim -1 -1 bone
+anim frame vertex frame
+material 1.0 vertex bone 0.500000 -1
+vertex 0.500000 -1
+material frame anim 1.0 material
+= 0.500000 = = = texture
+frame bone texture frame anim
+texture
+1.0 anim = anim material =
+vertex material material 1.0
+vertex vertex 1.0 = vertex 0.500000
+-1 -1
+material texture 0.500000 0.500000 anim 0.500000 anim
+frame
+vertex -1 anim 0.500000 frame texture -1 = -1 = 1.0
+texture
+frame frame texture frame material 1.0 material
+material
+texture anim material frame
+bone texture
+vertex vertex
+anim bone anim -1 =
+vertex
+texture = bone
+vertex anim frame
+bone 0.500000 vertex texture -1
+0.500000
+texture = frame material anim 0.500000 =
+vertex anim -1 anim anim frame 0.500000 = = anim
+=
+bone anim anim anim
+= 0.500000 bone anim texture texture frame material vertex
+frame
+frame vertex
+1.0 texture
+-1
+anim
+= -1 material bone
+-1 -1 = anim bone bone
+bone vertex material
+anim anim
+0.500000 -1 1.0 = 0.500000 vertex -1 vertex material 0.500000 vertex
+1.0
+vertex bone 0.500000 frame bone
+1.0 texture frame vertex -1
+1.0
+-1
+bone = texture material
+frame
+texture
+1.0
+0.500000
+material material
+bone -1 material fram
\ No newline at end of file
@@ -0,0 +1,231 @@
+anim
+= frame -1 =
+bone -1
+vertex 1.0 frame 1.0 frame
+-1 -1 material material vertex 1.0 anim = 0.500000
+anim bone
+anim frame = frame 0.500000 material frame bone
+frame bone anim 0.500000 = vertex
+0.500000
+bone 0.500000 1.0 vertex bone
+anim
+1.0
+= anim bone -1 = texture -1 texture
+bone vertex material 1.0
+-1 anim frame anim texture
+-1 0.500000 = 1.0 anim material = frame -1
+0.500000 vertex
+= frame bone vertex vertex 0.500000 material
+texture 0.500000 vertex 1.0 1.0 -1 frame frame
+= frame material bone = bone = bone vertex texture 0.500000 =
+1.0
+bone anim bone
+anim texture frame 1.0
+anim vertex texture material vertex bone = bone anim 0.500000 frame bone
+anim frame anim texture frame
+1.0 bone
+vertex 1.0 1.0 vertex
+bone 0.500000 = frame bone
+1.0
+-1
+bone texture bone
+-1
+texture
+1.0
+bone anim vertex 0.500000 material frame
+frame
+0.500000 0.500000
+texture
+= frame vertex 0.500000 anim 0.500000 vertex texture 1.0 frame texture
+0.500000
+anim bone anim vertex vertex anim 0.500000
+bone anim frame =
+texture
+bone 1.0 material frame anim bone material texture anim
+vertex frame
+= anim frame anim vertex -1 material 1.0 vertex vertex
+bone frame vertex bone
+0.500000
+1.0
+vertex 1.0
+material
+texture vertex anim = -1 0.500000 1.0 = = = material bone 0.500000 1.0 frame material = 1.0 =
+1.0 frame 0.500000 -1
+1.0 anim 1.0 0.500000 = 1.0
+-1 bone
+texture
+= 0.500000 frame material = anim texture anim anim bone bone anim = texture
+texture bone anim 0.500000 anim anim vertex
+anim
+= 0.500000
+texture bone -1
+-1 texture
+frame frame 0.500000
+= material material bone 0.500000
+1.0 = vertex
+frame
+anim material -1 frame 0.500000 -1 material texture
+anim
+0.500000 1.0 bone material
+texture
+bone 0.500000 bone anim -1 0.500000 = frame material anim
+1.0 1.0
+vertex anim 0.500000
+bone material = 0.500000 material anim
+texture vertex frame material 1.0 material anim material frame
+1.0 anim anim frame = bone =
+bone material material
+anim 1.0 frame
+material -1
+bone vertex 0.500000
+frame 1.0
+bone = anim
+1.0 texture anim texture texture
+material 1.0 0.500000
+anim 0.500000 -1
+-1 1.0 material anim bone frame frame -1 anim = texture material
+anim frame 1.0 material material
+-1 1.0 -1 material anim texture 1.0 bone
+vertex
+1.0 texture material material 0.500000 anim
+-1
+1.0
+1.0 = bone -1
+vertex = texture 1.0 vertex -1
+frame texture frame 1.0 -1 frame anim
+vertex
+0.500000 0.500000 frame -1 bone
+texture material
+bone
+frame texture bone anim 1.0 0.500000 -1
+anim vertex material
+0.500000 vertex 1.0 -1 frame
+=
+0.500000
+texture
+1.0 1.0
+=
+anim = bone anim vertex
+texture texture texture bone 1.0 texture -1 bone frame texture frame anim 1.0 frame material -1 0.500000 -1 1.0
+-1 = = anim
+texture
+=
+texture = 0.500000
+anim
+bone material
+-1 1.0 texture
+-1 frame
+vertex = frame
+0.500000 material material
+= vertex anim vertex vertex
+vertex
+texture
+0.500000 1.0 anim frame texture vertex 1.0 material vertex
+vertex 1.0 texture 0.500000 -1 material anim -1 frame material frame bone
+= anim 0.500000 0.500000 0.500000
+0.500000 bone
+= vertex 0.500000 1.0 0.500000 1.0 = -1
+vertex anim frame texture bone = bone =
+frame texture anim = texture vertex
+anim texture material vertex anim bone frame texture -1 0.500000 frame anim
+bone
+= texture
+frame anim bone 0.500000 -1 = -1 = 0.500000 bone
+texture
+anim
+0.500000
+anim 1.0 material
+1.0 material
+= -1 0.500000
+texture
+texture vertex -1 1.0 anim
+0.500000
+1.0
+anim
+= = bone
+frame
+0.500000 = material 0.500000 0.500000
+material
+bone anim texture
+bone
+anim 0.500000 anim texture
+anim -1
+bone bone = frame =
+0.500000 material vertex anim
+= bone -1 1.0 1.0 vertex
+anim
+-1
+-1 = texture -1 frame
+0.500000 anim
+vertex
+texture anim = frame frame vertex vertex vertex -1 material
+material -1
+-1
+material vertex material 0.500000 bone
+vertex material
+material -1 anim 0.500000 bone texture
+vertex bone
+anim -1
+=
+1.0
+vertex 0.500000 vertex 0.500000 texture 1.0 bone material
+material = texture material texture vertex frame 1.0
+= texture
+frame frame 1.0 = bone = texture
+-1 1.0
+anim frame vertex = vertex bone
+vertex 1.0
+1.0 material
+1.0 vertex
+frame texture material 1.0 frame 1.0
+0.500000
+1.0 vertex frame -1 bone
+texture anim
+bone
+texture
+bone texture
+vertex 0.500000 = texture material anim
+frame vertex vertex
+bone
+1.0 vertex
+bone vertex 0.500000
+material bone vertex vertex -1 = 0.500000 texture anim anim bone
+anim 0.500000
+anim bone material vertex -1
+material anim frame -1 material
+= texture vertex texture vertex
+frame anim
+1.0
+material
+material
+-1 vertex
+= material = =
+bone = material
+=
+bone vertex vertex bone
+0.500000
+material frame
+texture vertex
+material
+frame
+0.500000 -1 anim vertex
+= 1.0
+material =
+frame = = frame = =
+1.0 -1 anim = = texture = -1 anim bone texture 1.0
+1.0 vertex
+1.0 = 1.0
+bone texture texture vertex bone material anim
+bone
+= material 0.500000 anim bone
+vertex
+anim texture material -1 1.0 bone material frame 1.0 texture material -1
+vertex texture vertex texture
+bone anim frame texture material material frame frame
+texture anim anim 1.0 texture frame frame anim vertex 0.500000 0.500000 texture -1 texture
+anim bone texture
+texture
+1.0 anim = anim anim 0.500000 material texture vertex 0.500000 = texture 0.500000 0.500000 anim frame bone vertex texture
+material material
+material 1.0 -1 =
+0.500000 vertex frame anim -1 -1 frame bone texture
\ No newline at end of file
@@ -0,0 +1,321 @@
+frame = vertex bone texture vertex = 0.500000 anim
+vertex
+material material bone vertex frame -1
+bone
+bone
+vertex frame vertex 1.0 anim material anim material 0.500000 bone
+frame 0.500000
+-1 bone vertex -1 material texture material
+bone texture material =
+0.500000 bone
+texture
+-1 texture 0.500000 bone =
+vertex texture -1 bone texture 1.0 0.500000 material
+= 1.0 vertex
+texture vertex -1 anim material
+texture = = material
+1.0 = anim 1.0 0.500000
+texture
+vertex
+-1 vertex vertex
+1.0
+material
+0.500000 -1
+vertex = 0.500000
+-1 texture anim
+texture
+anim = vertex
+= 0.500000
+= vertex anim 1.0 1.0 frame 0.500000
+anim material
+vertex
+1.0
+bone anim anim 0.500000
+-1 vertex frame vertex
+-1 material anim bone
+texture
+material
+material anim 0.500000 bone anim -1
+frame 1.0 texture texture bone
+texture
+bone
+texture vertex -1 -1 vertex bone bone = frame -1 =
+texture
+bone 0.500000 material 0.500000
+1.0 anim
+frame
+1.0 vertex bone 0.500000 1.0
+frame 0.500000 bone frame
+frame
+1.0 -1 -1 = anim 0.500000 -1 -1 -1 frame
+vertex
+0.500000 0.500000 =
+bone vertex
+1.0 anim = texture frame material
+= = 0.500000
+vertex frame bone
+= material
+frame material frame frame anim frame anim =
+= material bone frame
+0.500000 bone anim
+anim material 1.0 frame material 1.0
+texture bone -1 1.0 anim = 0.500000 frame
+material frame frame -1 = bone bone vertex 0.500000
+bone 0.500000 vertex 1.0
+vertex
+texture material
+1.0
+-1
+1.0 anim 0.500000 1.0 anim material
+vertex 0.500000
+anim
+= anim
+anim
+anim texture -1 -1 -1 = 0.500000 texture bone anim -1
+bone material anim 0.500000 0.500000 1.0 =
+frame material 1.0
+1.0
+0.500000 texture material bone frame texture anim frame 1.0
+0.500000 = = texture -1
+material texture
+texture -1 vertex frame frame bone
+material 0.500000 vertex
+vertex frame
+= frame = = 0.500000 bone material 1.0
+vertex -1 anim texture frame -1 anim
+vertex
+bone material texture
+vertex
+vertex anim frame
+texture
+anim
+vertex -1 = = material bone frame vertex texture
+bone -1
+frame
+frame =
+0.500000 texture 1.0 material 0.500000 bone 0.500000 = material anim frame vertex -1
+vertex frame 0.500000 -1
+bone texture anim bone -1 = anim 1.0 texture
+frame 0.500000 bone material anim vertex
+texture 1.0 1.0 material anim = texture
+anim 1.0 texture
+-1 vertex vertex bone 1.0 material material
+0.500000 anim = texture
+material 0.500000 1.0 -1 frame material
+-1
+vertex texture vertex
+bone
+vertex frame -1
+material -1 1.0 bone -1 vertex vertex =
+vertex 0.500000
+texture texture
+-1
+= bone
+0.500000 material 1.0
+-1 anim
+anim material bone
+frame -1 vertex 0.500000 vertex -1 bone
+= 1.0 -1 anim anim 0.500000
+=
+1.0 vertex
+anim vertex
+0.500000
+1.0 material
+vertex texture bone
+1.0 -1 0.500000 material
+frame 0.500000
+texture
+frame material frame
+vertex
+frame 0.500000 0.500000 vertex -1
+vertex
+-1 =
+frame
+vertex vertex
+1.0 0.500000 0.500000 anim 1.0 0.500000 1.0 0.500000 vertex texture
+1.0
+1.0
+material vertex
+= 0.500000
+bone 1.0 bone -1
+bone
+frame anim -1 anim 0.500000 anim
+vertex
+-1 0.500000
+vertex anim 0.500000 1.0 bone
+frame 1.0
+frame
+0.500000
+1.0 material 0.500000
+frame bone frame bone 1.0 -1
+texture
+bone 1.0 vertex material texture bone anim
+frame
+1.0
+texture material frame material frame vertex
+vertex
+anim 0.500000 anim texture
+1.0
+anim
+anim 0.500000 -1 0.500000 -1 0.500000 1.0 material vertex frame
+texture
+1.0
+bone
+bone
+frame
+-1 =
+material -1 0.500000 1.0
+material frame
+vertex 0.500000
+0.500000 -1 0.500000
+material material 0.500000 material
+= = -1 -1
+-1
+0.500000 vertex material = 0.500000 vertex 1.0 -1
+=
+anim = =
+vertex 0.500000 material =
+bone vertex -1 frame 1.0 vertex -1 = material 1.0 texture frame 1.0 bone
+0.500000 0.500000 frame
+material bone 0.500000 bone 0.500000 texture bone bone
+-1
+vertex texture 1.0 anim anim bone material
+texture material vertex
+anim -1 -1 1.0 frame
+anim anim -1 material frame
+vertex
+0.500000 frame
+bone anim 0.500000 0.500000 1.0
+1.0 -1 bone 0.500000
+0.500000 vertex
+bone 0.500000
+1.0 bone -1
+frame 1.0 frame frame frame bone =
+1.0 = -1 bone 0.500000 texture anim bone anim -1 0.500000 -1
+1.0 texture bone 0.500000
+frame material material vertex 0.500000 1.0 material bone material -1
+anim texture
+material bone
+frame 0.500000 -1 bone = texture 1.0 vertex = frame 1.0 -1 bone
+0.500000 0.500000 frame -1 = material vertex 0.500000
+vertex -1 frame frame material frame material bone
+0.500000 vertex texture 0.500000
+anim material 1.0 = =
+= 1.0 = vertex bone vertex
+0.500000
+=
+= vertex -1 texture
+-1
+-1 frame bone =
+vertex bone 0.500000 1.0 vertex vertex 0.500000
+vertex
+frame texture 0.500000
+anim
+= -1
+frame anim 0.500000 -1 1.0
+0.500000 material frame material anim vertex frame =
+vertex
+anim
+anim
+material texture texture -1 -1 material material
+texture
+texture bone
+-1 = 0.500000 texture
+vertex anim = texture
+vertex vertex material bone
+1.0 anim texture frame material texture -1 = = -1 1.0
+bone texture material frame
+0.500000 = material
+material frame 1.0 material
+material 0.500000 0.500000 = anim bone texture 0.500000 -1 bone bone anim -1 vertex
+texture anim material vertex 0.500000
+0.500000 texture anim = 0.500000 frame bone texture 0.500000 texture -1 vertex texture = anim material
+bone frame
+anim
+material material -1
+bone bone texture anim bone
+-1
+= =
+0.500000 vertex 0.500000 anim vertex
+vertex 1.0 material 0.500000 -1 texture
+material 1.0 -1
+anim 0.500000 texture
+bone material material material vertex texture anim anim bone texture vertex -1 0.500000
+texture -1 material vertex
+material texture anim 1.0 0.500000 texture material 0.500000 0.500000 = material -1 material 1.0
+bone
+frame bone vertex anim frame
+= frame bone frame -1 anim bone texture = vertex material
+1.0 texture 0.500000 frame vertex bone
+anim
+0.500000 texture 0.500000 1.0 = anim
+texture 1.0 1.0 frame = frame
+frame
+bone material texture vertex bone bone bone
+material 0.500000 vertex anim material 1.0 = -1 anim texture frame frame -1
+-1 material anim
+texture texture
+material material frame 1.0 0.500000 1.0
+0.500000 1.0
+anim frame anim material
+= texture
+1.0 material
+0.500000 -1 texture =
+-1 material
+0.500000 -1 frame -1
+0.500000
+1.0
+-1 bone frame anim texture anim
+anim texture vertex
+texture vertex texture 1.0 texture frame texture
+= texture anim -1 anim frame frame 0.500000 frame = 0.500000 bone frame
+1.0 1.0 material
+0.500000 -1 -1 texture material 1.0 -1 frame -1 vertex
+bone
+0.500000 =
+material -1
+anim material 1.0 1.0 texture 0.500000 frame frame frame material
+bone material texture = anim 1.0
+texture
+-1 anim vertex -1 vertex texture texture texture
+bone material bone 1.0 material = material frame -1 -1
+anim frame bone
+0.500000 texture
+vertex vertex
+bone 0.500000 vertex -1 frame frame bone
+anim texture anim 1.0 vertex
+1.0
+0.500000 -1 bone texture 0.500000 1.0 anim anim
+vertex bone anim frame texture bone bone bone 1.0
+texture
+-1 frame = 1.0 material 0.500000 anim
+1.0 1.0 vertex
+vertex material frame texture 1.0 material =
+bone
+frame material material material
+texture 1.0
+-1 1.0 texture frame
+1.0
+vertex = anim
+anim anim 0.500000 texture vertex texture = material
+vertex
+material 1.0 0.500000 frame
+= =
+vertex = vertex
+1.0 vertex 1.0 material material 1.0 1.0 1.0
+anim frame texture 0.500000 material material
+1.0 bone
+=
+=
+= material frame bone
+frame texture vertex frame texture -1 1.0
+0.500000 anim = frame bone vertex bone
+texture 1.0 material material 1.0 -1
+texture -1 texture
+0.500000 texture material vertex
+1.0
+= material material 0.500000 bone 1.0 anim -1 material
+0.500000 -1 vertex
+= material = texture bone
+frame
+f
\ No newline at end of file
@@ -0,0 +1,7 @@
+bone
+frame 0.500000 texture material 0.500000 vertex material bone anim
+= bone
+vertex
+-1
+1.0 = frame
+material material -1 bone
\ No newline at end of file
@@ -0,0 +1,3 @@
+material
+vertex texture bone
+bone anim vert
\ No newline at end of file
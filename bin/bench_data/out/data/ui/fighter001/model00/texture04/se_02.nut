@@ -0,0 +1,14 @@
+bone
+texture 1.0 vertex anim
+vertex texture = anim =
+vertex frame 1.0
+material 0.500000 =
+anim
+vertex
+anim -1 vertex material anim frame texture anim anim
+0.500000 vertex frame material 0.500000 0.500000
+anim
+vertex = -1
+anim
+frame bone bone frame
+material frame -
\ No newline at end of file
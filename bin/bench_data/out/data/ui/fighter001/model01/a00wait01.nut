@@ -0,0 +1,26 @@
+material =
+vertex =
+frame 0.500000
+= anim material frame
+texture
+texture material
+0.500000 material
+material -1 -1 bone
+-1 = -1 -1 vertex
+1.0
+1.0 bone texture anim texture 1.0 bone bone 1.0 texture bone vertex = vertex -1 frame frame bone = material material
+anim material = vertex
+anim anim vertex -1 anim
+material -1 texture texture anim frame 1.0
+material
+0.500000
+= material 1.0 anim
+bone vertex 1.0 vertex
+0.500000 0.500000 0.500000 bone
+frame
+texture 0.500000 0.500000 -1
+material 0.500000
+frame
+frame
+vertex = material anim 0.500000 1.0
+texture frame texture texture b
\ No newline at end of file
@@ -0,0 +1,8 @@
+bone
+vertex -1 0.500000 = bone
+texture bone
+0.500000 = 0.500000 0.500000 0.500000 frame
+anim
+frame
+texture
+0.50000
\ No newline at end of file
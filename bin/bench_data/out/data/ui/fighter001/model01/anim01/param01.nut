@@ -0,0 +1 @@
+anim frame texture vertex frame materia
\ No newline at end of file
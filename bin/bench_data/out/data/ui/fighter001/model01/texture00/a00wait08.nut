@@ -0,0 +1,4 @@
+anim
+=
+vertex texture anim 0.500000 vertex material 0.500000 vertex 1.0
+anim materi
\ No newline at end of file
@@ -0,0 +1,12 @@
+material -1 = material = -1 frame texture texture -1 bone material frame 0.500000 frame -1 texture 0.500000 vertex frame
+= 1.0 anim 1.0 bone texture texture 0.500000 frame
+=
+vertex -1 anim vertex 0.500000
+anim anim 1.0 -1 texture texture
+1.0 bone =
+1.0 anim vertex = -1 texture vertex
+material -1 vertex frame vertex -1 vertex -1 material vertex -1 material texture -1
+0.500000
+0.500000 vertex
+bone frame frame anim bone vertex 1.0 1.0
+vertex texture material texture = vertex = frame anim bone 1.0 materi
\ No newline at end of file
@@ -0,0 +1,16 @@
+material anim
+anim 1.0 material
+1.0 -1 1.0 0.500000 vertex
+bone
+vertex bone
+bone 1.0 bone frame
+anim vertex 1.0 0.500000 0.500000
+material 1.0 material texture material bone -1 bone = 1.0
+vertex texture 1.0 vertex
+0.500000 0.500000 0.500000 = bone -1 0.500000 texture -1 -1 anim
+material vertex texture -1
+0.500000 = bone =
+anim frame = =
+texture
+= 0.500000 bone =
+frame material material anim = material 1.0 materia
\ No newline at end of file
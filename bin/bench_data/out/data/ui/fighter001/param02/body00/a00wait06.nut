@@ -0,0 +1,133 @@
+= 0.500000 anim -1
+= frame anim =
+= 1.0 vertex = vertex
+frame = bone frame 0.500000 = frame frame texture
+anim 1.0 anim 0.500000 -1 anim anim material 0.500000 1.0 1.0 vertex
+anim frame -1 -1 anim = 0.500000 vertex texture 1.0
+= bone texture material texture material
+= 0.500000
+1.0 1.0 1.0 0.500000 1.0 anim
+material
+vertex frame -1 frame vertex = frame bone anim material 1.0 frame vertex
+bone texture texture -1 1.0 0.500000 texture -1 bone bone material -1 anim -1 -1 anim bone frame
+0.500000 frame
+anim
+anim frame vertex anim 1.0 0.500000
+frame = texture
+anim texture 0.500000 anim 1.0 frame = material = = anim vertex
+material bone anim material vertex vertex vertex 0.500000
+-1 frame vertex texture -1 bone = = 1.0 texture material bone material
+anim texture =
+anim vertex
+-1 material
+bone 0.500000
+anim 0.500000 1.0 material -1 anim anim
+1.0
+0.500000
+frame texture
+material
+-1
+0.500000 1.0 -1
+-1
+texture texture bone material material material -1 material bone texture
+bone vertex texture = = 0.500000 = 0.500000 texture bone
+= -1
+-1 1.0 frame
+vertex
+= texture bone vertex anim = =
+bone
+frame = = material
+-1 = = 0.500000
+0.500000
+-1 material 1.0
+frame frame
+texture = bone frame vertex vertex
+bone texture
+frame material
+bone 0.500000
+texture anim = -1
+bone 1.0
+anim anim = bone 0.500000 vertex
+bone 0.500000
+texture 0.500000
+0.500000 -1
+anim frame material frame
+anim
+-1 0.500000 frame
+1.0 0.500000
+vertex vertex vertex bone frame =
+vertex
+vertex anim -1 vertex vertex anim = vertex material texture 0.500000
+0.500000 bone
+anim material
+anim
+1.0
+bone 1.0
+texture
+1.0 = texture
+0.500000 -1 0.500000 vertex anim
+material
+material 1.0 -1
+bone frame anim vertex texture anim
+frame vertex vertex
+bone -1
+1.0 1.0 0.500000 vertex
+material texture -1 1.0 frame bone material
+texture -1 anim frame -1 anim = = =
+= bone vertex vertex
+-1 texture texture 1.0 = vertex
+anim anim vertex
+material =
+anim vertex 1.0 0.500000
+-1 texture 1.0 1.0 bone 0.500000 frame anim texture = -1 anim
+0.500000 material anim -1 frame -1
+texture bone = -1 anim
+texture
+vertex
+bone 0.500000 frame texture = frame
+vertex 0.500000 -1 -1 0.500000
+bone 1.0
+-1 vertex = material anim = 1.0 -1
+frame
+0.500000
+bone texture vertex frame
+anim
+vertex
+0.500000 frame =
+frame 1.0
+1.0 1.0 vertex = material frame
+1.0 1.0 vertex
+-1
+1.0 texture bone anim vertex frame texture anim bone frame frame frame = -1 frame vertex bone 1.0 anim vertex
+-1
+bone
+material 0.500000 vertex vertex -1
+vertex
+texture 0.500000
+0.500000 anim vertex
+0.500000 vertex texture
+1.0 texture 0.500000 -1 anim vertex anim vertex =
+1.0 anim
+material
+= 1.0
+frame =
+-1 1.0
+=
+-1 vertex material
+bone bone 1.0
+1.0 frame = texture
+-1 0.500000 = = texture texture
+bone
+material texture bone
+anim
+1.0 bone
+0.500000 frame vertex material material -1 vertex 1.0 1.0 anim material
+frame
+bone vertex anim = frame
+frame -1 1.0 = 0.500000 -1
+texture
+-1
+vertex texture = anim 1.0
+1.0 vertex
+material texture
+0.
\ No newline at end of file
@@ -0,0 +1,34 @@
+= 1.0 = material
+bone
+vertex
+anim texture
+vertex 1.0 anim
+-1 0.500000 material = anim 1.0 -1 = frame vertex texture texture -1
+bone texture material bone material 0.500000 anim vertex 0.500000
+vertex bone material
+vertex vertex texture 1.0 -1 frame texture bone -1 -1 anim 0.500000 = bone 1.0 frame texture frame 1.0
+vertex
+texture 0.500000 material vertex 1.0 vertex frame
+anim material bone anim frame
+texture = 0.500000 = -1 anim frame texture
+bone anim anim
+= -1 frame = bone material 1.0 0.500000 bone frame 0.500000 frame
+1.0 1.0 = bone material material texture
+texture =
+material 0.500000 0.500000 = vertex frame 0.500000 bone bone -1 texture bone vertex vertex bone frame material bone
+frame
+anim 0.500000 texture = 1.0 0.500000 frame 0.500000 bone -1
+frame
+frame texture frame anim texture -1 = frame
+texture =
+0.500000
+material 1.0
+-1 material bone
+0.500000 0.500000
+frame texture 0.500000
+texture =
+= vertex
+bone 1.0
+material -1
+material anim texture
+0.500000 material = ma
\ No newline at end of file
@@ -0,0 +1,5 @@
+1.0 bone texture 1.0 frame
+vertex 1.0
+=
+frame bone anim frame
+0.500000 texture material material 0.500000
\ No newline at end of file
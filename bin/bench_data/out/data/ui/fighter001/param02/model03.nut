@@ -0,0 +1,5 @@
+anim
+vertex -1 bone frame bone material vertex bone vertex
+0.500000 0.500000 0.500000 bone vertex vertex texture anim anim frame material material texture = vertex bone anim anim
+= anim
+material 1.
\ No newline at end of file
@@ -0,0 +1,6 @@
+-1 = =
+material
+vertex
+= material
+material
+1.0 material =
\ No newline at end of file
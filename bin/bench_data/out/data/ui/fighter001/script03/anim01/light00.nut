@@ -0,0 +1,3 @@
+1.0
+vertex bone material -1 frame 1.0 texture frame -1 bone frame
+bone 1.0 frame
\ No newline at end of file
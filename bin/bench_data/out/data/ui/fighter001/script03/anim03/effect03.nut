@@ -0,0 +1,32 @@
+bone anim texture
+texture vertex anim 0.500000 anim material vertex bone -1
+texture anim
+frame = vertex bone 0.500000 1.0 bone material 1.0
+vertex vertex bone 0.500000 material texture
+0.500000 0.500000 1.0 vertex -1
+texture anim
+=
+vertex vertex 0.500000 bone texture frame =
+0.500000
+frame anim 1.0 = =
+vertex material bone texture vertex
+texture texture =
+1.0 frame bone bone -1 frame
+0.500000 0.500000 frame
+frame material -1 = anim
+bone =
+vertex bone
+material = frame = bone 1.0 texture
+0.500000
+= vertex bone
+anim material 1.0 frame texture material
+anim
+1.0 material texture material vertex 1.0
+frame vertex 1.0 0.500000
+material
+texture -1 frame
+vertex bone anim bone vertex material anim 0.500000 texture
+bone texture frame material -1 texture texture frame
+1.0 vertex vertex anim
+-1 bone vertex frame bone
+anim frame = -1 texture vertex texture -1 = material = frame 
\ No newline at end of file
@@ -0,0 +1,101 @@
+1.0
+bone 1.0
+-1
+texture material frame 0.500000 0.500000 0.500000 1.0
+vertex anim =
+material bone bone vertex material
+anim
+anim
+0.500000 anim -1 material
+= 0.500000 0.500000
+0.500000 anim texture
+texture
+texture
+bone anim
+material texture vertex
+bone
+material bone material vertex texture frame bone
+vertex
+material frame material = = =
+-1 bone vertex
+1.0 1.0 1.0 texture texture 1.0 1.0 = frame 1.0 frame -1 frame 1.0 -1 anim frame 0.500000 frame
+bone
+0.500000 -1
+material anim material material material 0.500000 1.0 bone material
+vertex frame anim vertex bone bone bone vertex 0.500000 material material =
+0.500000 -1 0.500000 = 1.0 0.500000 vertex anim bone = -1 material bone = frame vertex
+= 0.500000 = =
+anim frame
+vertex 1.0 0.500000 = 1.0
+bone texture = = -1 0.500000
+bone
+vertex
+anim anim
+1.0 =
+material vertex 1.0 -1 0.500000 0.500000 1.0
+vertex 0.500000 frame
+material texture =
+frame -1 -1 bone 0.500000
+-1 material texture frame material bone
+-1 texture texture anim texture 1.0 frame = bone
+-1
+vertex vertex material 0.500000 texture 0.500000 0.500000 -1 = material -1
+anim 1.0
+anim texture = bone
+texture frame vertex texture anim 0.500000 1.0 1.0 = bone =
+texture
+0.500000 texture = frame
+= = frame -1
+anim bone material
+material bone anim
+1.0 0.500000 texture
+texture = 1.0 material
+anim material 1.0 texture
+material bone vertex texture
+1.0 material frame bone frame vertex = 1.0
+0.500000 frame
+anim material 0.500000 = -1 material texture anim bone vertex frame bone vertex
+texture frame frame
+1.0
+vertex
+anim 0.500000 anim anim texture
+bone vertex = bone -1
+-1 vertex = frame
+0.500000 =
+1.0 -1 1.0 anim
+anim
+0.500000 material frame 0.500000 1.0 1.0 -1
+anim 1.0 1.0
+frame 1.0
+anim 0.500000 1.0 anim
+= frame 1.0 -1 anim
+anim
+1.0 bone
+texture texture bone
+frame material material -1 texture =
+1.0 texture
+anim vertex
+material vertex
+0.500000
+anim frame frame 0.500000 bone anim = 0.500000 1.0
+= texture = = 0.500000 frame anim 1.0 material anim
+anim anim
+1.0 frame anim frame 1.0 = 0.500000 -1 0.500000 bone bone
+1.0 anim
+anim anim texture = material texture
+anim
+=
+texture
+-1 0.500000
+0.500000 -1 frame =
+frame -1 frame bone
+1.0
+anim 1.0 material texture
+material = frame
+bone vertex 1.0
+bone
+anim 0.500000 bone material -1 material vertex frame
+1.0 frame frame = frame vertex
+frame 0.500000 material
+texture
+materia
\ No newline at end of file
@@ -0,0 +1,14 @@
+anim -1 material
+-1 anim material 0.500000
+vertex = 0.500000 texture anim
+anim frame
+-1 anim = bone anim
+1.0 bone 1.0 anim texture
+anim
+vertex bone 0.500000
+anim frame 1.0 bone 1.0 =
+anim -1
+texture vertex bone
+frame frame -1 bone vertex
+-1
+texture -1 bone vertex
\ No newline at end of file
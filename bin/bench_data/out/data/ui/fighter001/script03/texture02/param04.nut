@@ -0,0 +1,6 @@
+anim 0.500000 1.0 bone
+bone 1.0 =
+anim frame -1 -1 texture vertex
+frame
+bone
+0.500000 0.500000 0.500000 -1 1.0 frame anim bone = vert
\ No newline at end of file
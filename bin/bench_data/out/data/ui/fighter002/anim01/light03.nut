@@ -0,0 +1,13 @@
+material
+vertex -1 -1 1.0 bone vertex -1 0.500000 vertex
+anim bone material
+texture
+0.500000
+frame material vertex bone material
+vertex -1
+material material anim
+vertex = texture 0.500000 = = 0.500000 bone frame frame = 0.500000
+frame material 0.500000 = 1.0
+-1 material -1 -1
+material
+material 0.500000 bon
\ No newline at end of file
@@ -0,0 +1,7 @@
+texture texture
+material texture
+-1 -1 frame
+1.0 1.0 0.500000
+frame bone vertex vertex
+frame bone material -1 material
+= frame 1.0 anim frame
\ No newline at end of file
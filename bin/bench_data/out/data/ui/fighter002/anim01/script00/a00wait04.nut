@@ -0,0 +1,20 @@
+frame
+= anim bone material -1 1.0 bone frame 0.500000 frame 0.500000 material 1.0
+vertex
+frame -1 bone
+texture texture -1 frame material texture 1.0
+material
+texture 1.0 -1
+0.500000 -1 texture 0.500000 1.0 frame = = 1.0 material material -1 -1 anim bone bone = anim 0.500000 =
+anim material bone 1.0 bone = material vertex texture anim material frame
+texture 1.0 frame
+anim -1 0.500000 1.0 bone frame
+vertex material 1.0 -1 1.0 -1 material bone material 0.500000 1.0 texture 1.0
+=
+= texture material material 1.0 vertex texture
+= -1 0.500000 texture 0.500000 1.0 bone bone
+vertex anim -1
+bone
+texture -1 1.0 frame
+anim texture texture 0.500000
+bone 0.500000 texture material -1 0.500000 -1 1.0 -1 = 1.0 anim frame frame bone 0.500000 vertex 1.0 texture ani
\ No newline at end of file
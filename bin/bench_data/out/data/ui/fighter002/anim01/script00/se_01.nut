@@ -0,0 +1,3 @@
+texture =
+texture
+= material = 1.0 1.0 anim 
\ No newline at end of file
@@ -0,0 +1,9 @@
+0.500000 texture anim frame anim -1 -1 1.0
+anim
+anim 1.0 frame
+bone bone frame anim 1.0 texture vertex -1 vertex
+texture
+0.500000 -1 =
+0.500000 1.0 bone texture vertex bone =
+vertex
+frame bone = material b
\ No newline at end of file
@@ -0,0 +1,339 @@
+material
+= vertex texture -1
+vertex anim anim
+texture texture = material
+material frame anim anim
+1.0 =
+vertex
+vertex
+bone anim anim material material anim anim -1 = texture 0.500000 -1 vertex -1
+texture
+-1 anim frame -1
+0.500000
+=
+vertex texture 1.0 bone texture
+= 0.500000 0.500000
+vertex frame material = -1 = 0.500000 material -1 bone -1 vertex anim texture 1.0 1.0
+frame material 0.500000 material = vertex 1.0
+texture
+texture = vertex material -1 texture = vertex
+bone
+bone 1.0
+anim
+frame 0.500000 anim =
+0.500000
+material = -1 vertex 0.500000
+bone
+anim vertex frame
+frame -1 -1 1.0
+1.0 1.0 vertex texture bone 1.0
+material =
+anim bone anim bone
+= material material vertex 0.500000 frame anim anim 1.0 0.500000
+=
+texture material
+1.0 material bone vertex vertex
+0.500000 material texture vertex =
+1.0
+bone 1.0 texture
+0.500000 1.0 =
+frame texture material
+0.500000 vertex = material material texture bone frame 0.500000 frame 0.500000 vertex vertex 1.0 1.0 texture =
+= 0.500000
+frame
+frame
+anim material material anim bone
+texture bone material material 1.0
+1.0
+1.0
+1.0 vertex anim
+material frame
+material frame 0.500000 frame
+texture bone
+material texture -1 -1 1.0 1.0 = 0.500000 -1
+= 0.500000
+frame texture 0.500000 anim 0.500000 texture texture frame frame
+bone
+material = vertex
+vertex vertex anim = =
+0.500000 bone -1 vertex
+texture = bone
+bone -1 -1 texture 0.500000 material
+1.0 1.0 = material = material
+vertex 0.500000 material anim 1.0 bone = bone
+1.0 material anim texture
+-1 -1
+1.0 material
+0.500000
+texture material
+vertex texture anim 1.0 bone frame
+vertex = vertex anim 1.0
+bone texture
+bone vertex
+-1
+-1 bone
+= 0.500000 vertex texture texture 1.0 1.0 = material -1
+frame
+vertex texture bone frame
+-1
+-1 bone 0.500000 vertex anim material frame
+material
+texture frame 1.0 0.500000 anim -1 frame bone material texture
+material frame
+0.500000 vertex anim
+0.500000 bone -1 = -1
+texture vertex texture frame
+0.500000 vertex
+0.500000 frame vertex -1 material bone = frame
+1.0 frame = texture
+0.500000 anim
+anim
+frame vertex
+vertex vertex anim
+0.500000 bone texture = =
+frame
+bone anim anim anim =
+0.500000 frame 1.0 -1 = texture
+0.500000
+bone 1.0
+0.500000 frame 0.500000 = frame vertex vertex material
+vertex
+anim 0.500000 texture vertex frame anim
+anim 1.0
+1.0 vertex bone 0.500000 = =
+texture 0.500000 frame vertex
+bone bone
+bone
+-1
+material 0.500000 -1 0.500000
+=
+0.500000 anim bone anim 0.500000 vertex
+= texture =
+= texture
+anim 1.0 anim vertex
+-1
+material -1 0.500000 0.500000 anim 0.500000
+texture 1.0
+bone vertex = 1.0
+vertex texture frame anim 0.500000 vertex texture material
+frame 0.500000
+=
+-1 vertex bone frame material
+bone vertex
+=
+vertex vertex -1 =
+-1 = 1.0 1.0
+0.500000 bone
+frame bone
+anim = frame material
+=
+0.500000
+frame
+material
+1.0 material -1 -1 vertex 1.0 frame
+material -1 bone
+texture = material = material 1.0
+-1 -1 = texture
+frame =
+bone material
+texture vertex 0.500000
+bone material = vertex -1 material = material bone
+texture material frame bone anim = material texture -1 vertex 0.500000 1.0
+-1 0.500000 1.0 0.500000 1.0 material frame 1.0 anim -1 1.0 1.0 material
+0.500000 frame 1.0 texture material
+0.500000
+anim
+-1
+vertex =
+anim bone
+material -1 frame 0.500000 0.500000 bone 0.500000
+= = material frame 1.0 frame
+0.500000 anim 0.500000 1.0 texture = 0.500000 texture vertex vertex anim
+0.500000 anim anim =
+bone
+1.0 frame material material anim 0.500000
+material
+= anim material 0.500000
+1.0 = anim 1.0 material material 0.500000 1.0
+anim
+= texture frame 0.500000 anim vertex texture vertex texture material -1 1.0
+texture bone anim texture = anim
+= = 1.0 frame frame
+0.500000 0.500000 = 0.500000
+material frame = = bone -1 -1 1.0 texture texture
+texture
+vertex 0.500000 1.0 texture
+texture texture frame anim texture 1.0
+= = texture
+= material anim
+0.500000 texture
+1.0 -1
+material vertex anim bone material material vertex bone 1.0 -1 1.0
+= frame
+material
+1.0 = -1 vertex 0.500000
+material 1.0
+-1
+bone
+bone
+texture anim frame texture anim vertex
+bone
+1.0 anim 1.0 material texture
+bone = material texture vertex material frame vertex anim frame = 0.500000 frame vertex bone bone texture vertex
+material vertex
+frame
+bone vertex -1 anim -1 0.500000 = vertex -1
+vertex frame 1.0 material 1.0 anim
+-1 0.500000 0.500000 0.500000 = frame = vertex vertex
+1.0 1.0 frame 0.500000 -1 frame -1 vertex material 0.500000
+frame -1
+=
+= material vertex
+anim
+anim
+0.500000 frame bone
+texture
+anim
+0.500000 frame
+1.0 bone
+1.0 material 1.0 bone anim
+vertex -1
+1.0 material anim anim
+bone material = -1 -1 texture
+anim frame bone -1 frame material anim material =
+1.0 = material frame
+bone 1.0 material
+texture 1.0 1.0
+texture = = anim
+vertex = frame texture 1.0 anim frame 0.500000 1.0 material = vertex material =
+1.0 material anim
+1.0 material frame 0.500000 frame vertex
+0.500000 0.500000
+-1
+vertex texture texture anim material frame
+anim texture 0.500000
+texture
+0.500000 1.0
+material
+= 1.0 frame 1.0
+material 1.0 vertex
+anim texture vertex
+0.500000
+vertex bone 1.0 frame
+bone
+material
+texture = anim vertex 1.0
+frame
+material = material = bone -1 frame bone frame texture
+anim material anim material 1.0 texture material texture vertex material 0.500000
+0.500000
+vertex -1 -1 anim
+= anim bone anim
+texture 0.500000 =
+vertex 0.500000 1.0
+vertex frame frame
+anim -1 0.500000 -1 bone = bone
+texture -1
+1.0 texture
+1.0 vertex 1.0 0.500000 material -1
+1.0 bone =
+= texture
+vertex frame 1.0 0.500000 0.500000 1.0 anim
+texture 1.0 0.500000 anim anim anim material
+texture
+frame material frame vertex vertex
+1.0 bone texture -1 0.500000 texture
+= material bone frame anim texture vertex -1 anim 0.500000
+frame vertex
+frame -1
+-1 material texture
+= bone anim vertex
+material
+0.500000
+texture texture
+material
+1.0 texture 1.0 1.0 = frame = = anim =
+material material 0.500000
+-1 frame -1 anim 1.0 anim
+bone anim -1 material bone 1.0 material anim anim
+= = material vertex 0.500000 1.0
+bone
+= texture
+material
+1.0 bone frame -1 -1 anim anim anim = 0.500000 texture
+bone -1 anim -1 1.0 bone
+vertex
+0.500000 frame anim 0.500000 bone material
+0.500000 texture 1.0 = bone 0.500000 bone 1.0 material 0.500000 1.0
+bone 1.0 vertex bone texture frame anim = texture 1.0 vertex 0.500000 bone frame material
+texture material -1 0.500000 -1
+material
+anim texture 1.0 1.0 1.0 vertex
+-1 = bone -1 frame bone anim material
+0.500000 texture vertex anim
+0.500000 anim -1 bone = -1 material texture
+texture vertex -1
+material =
+-1 texture 1.0 vertex
+texture -1 material bone 1.0 anim bone 0.500000
+anim 0.500000
+0.500000 0.500000 0.500000 = texture -1 =
+1.0 material
+vertex -1 texture
+0.500000
+material bone frame anim frame
+frame material bone material 1.0 texture vertex
+texture -1 anim
+texture texture 0.500000 bone =
+frame 0.500000 bone 0.500000 frame anim texture frame 1.0 anim -1 material 1.0 -1 texture -1
+vertex material -1 0.500000 -1
+0.500000
+0.500000 = bone texture
+vertex -1 anim
+= texture anim frame frame
+0.500000 1.0 anim anim bone anim = frame -1
+anim material
+vertex bone bone bone material
+bone 0.500000 material
+frame
+anim bone =
+=
+texture texture frame 1.0 texture material vertex bone -1 vertex 0.500000
+vertex
+0.500000
+0.500000 anim vertex
+1.0 anim
+anim material -1
+=
+-1 vertex
+texture
+vertex
+vertex frame 0.500000 1.0 1.0
+= material anim
+bone = 1.0 texture
+1.0 frame frame frame
+vertex
+0.500000
+anim
+anim material vertex
+anim -1 vertex anim -1 material 0.500000 frame texture frame
+vertex material anim = = 1.0 1.0 texture
+frame 1.0 0.500000 0.500000 anim anim material 1.0 frame texture 0.500000 0.500000
+texture material -1 vertex
+1.0 vertex
+material vertex
+-1 bone frame anim frame
+-1 texture material 0.500000
+= material texture texture material = texture material texture texture texture texture vertex
+frame material anim frame = 0.500000 anim material texture material bone 0.500000 bone 0.500000 -1 material bone material material frame
+frame bone vertex vertex material texture =
+-1 -1 1.0 -1 frame vertex
+anim
+texture vertex -1 bone
+=
+texture bone
+1.0 = texture = material
+frame material
+anim bone vertex texture 0.500000 material 0.500000 = 0.500000
+-1 bone anim
+material texture vertex
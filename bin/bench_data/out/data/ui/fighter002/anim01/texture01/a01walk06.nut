@@ -0,0 +1,47 @@
+vertex
+texture -1 = anim -1 =
+texture anim
+material
+material =
+material -1 0.500000 anim =
+material
+1.0 -1 = anim 0.500000
+anim
+1.0 texture
+bone
+1.0 bone
+vertex
+anim material -1 material 1.0
+anim vertex material bone
+=
+= = 1.0 =
+vertex
+frame 1.0 anim -1 texture vertex texture 0.500000 =
+bone anim anim vertex =
+vertex anim
+texture
+material -1 frame vertex
+material material
+vertex texture bone texture anim anim
+bone =
+1.0 vertex anim frame
+1.0 material anim =
+0.500000 1.0 0.500000
+bone -1 = bone texture 0.500000 0.500000 bone = 0.500000 -1 texture vertex vertex vertex material 1.0 bone texture -1 material bone -1 = 1.0 -1 = -1 -1
+0.500000 frame
+0.500000 1.0 material 0.500000 frame
+1.0 1.0 frame -1 frame
+texture vertex bone vertex 0.500000 = anim
+0.500000 0.500000
+-1 bone
+anim vertex 1.0
+texture bone 0.500000 = -1 material 0.500000 0.500000 anim
+vertex
+anim
+bone
+1.0
+0.500000 = -1
+0.500000
+= = vertex
+bone 0.500000 texture material
+= materia
\ No newline at end of file
@@ -0,0 +1,31 @@
+texture
+material frame texture texture bone vertex texture texture texture
+frame
+material texture 0.500000
+texture = anim 0.500000 anim frame texture
+bone material
+= material -1
+1.0 -1 anim texture vertex frame = -1
+frame vertex texture texture material frame 1.0 vertex 1.0
+anim
+= = -1 texture 0.500000 -1 1.0 1.0 vertex bone
+texture 0.500000 bone 0.500000 0.500000 material 1.0 bone frame frame =
+0.500000
+vertex anim 1.0
+frame anim 0.500000 texture frame 0.500000 frame bone material anim bone
+0.500000 anim
+0.500000 material 0.500000
+frame texture
+anim bone bone frame = texture 0.500000
+texture bone anim
+material bone 1.0 anim -1 = bone
+frame
+= texture bone -1 0.500000 anim material bone vertex = 0.500000 0.500000
+1.0 -1 -1 vertex = vertex anim material
+bone -1
+material vertex = texture = vertex frame material -1
+texture bone frame -1
+vertex frame anim frame texture vertex = 0.500000 frame
+=
+1.0 -1 anim -1 vertex = vertex texture bone =
+1.0 0.500000 bone 0.500000 texture ve
\ No newline at end of file
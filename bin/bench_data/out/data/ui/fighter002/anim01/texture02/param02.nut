@@ -0,0 +1,249 @@
+material texture material 1.0 0.500000 1.0 frame
+vertex -1
+= frame material
+vertex
+texture 0.500000
+material
+-1 anim 0.500000 bone
+anim anim
+bone material 0.500000
+texture 1.0 bone material -1 anim anim
+anim frame = material
+material anim -1 0.500000 material vertex vertex
+=
+bone -1 = frame
+=
+1.0 -1 -1 frame anim -1 texture -1
+frame bone 1.0 texture -1
+anim anim
+material frame -1 -1
+bone
+frame -1 texture 0.500000 bone
+-1 -1 0.500000 vertex -1 material anim anim anim texture
+=
+texture = 1.0
+0.500000 texture anim
+material material -1 0.500000 texture vertex -1 vertex material frame -1 -1 anim vertex
+anim texture 1.0 texture
+1.0 -1 vertex -1 bone 0.500000 frame 1.0 anim texture texture -1 1.0 anim 0.500000 material frame frame
+0.500000
+anim texture vertex
+0.500000 vertex bone bone anim 1.0 -1 1.0
+-1
+vertex bone -1 anim -1 = -1 =
+vertex 0.500000
+texture 1.0 vertex vertex material -1
+-1 vertex vertex vertex 0.500000 texture frame frame anim
+= anim material frame -1
+-1 texture texture
+=
+0.500000 anim frame 1.0
+=
+1.0 frame
+frame material texture
+= bone
+texture vertex
+frame 0.500000 bone
+anim -1 0.500000
+1.0 bone
+-1 =
+vertex vertex 1.0 -1 -1 frame material vertex frame
+-1 material 1.0
+vertex anim
+vertex texture
+1.0
+frame 1.0 bone -1 material -1 anim
+frame
+bone
+= material -1 bone 0.500000
+frame 1.0
+1.0
+= 0.500000 texture material bone frame = 1.0 bone 0.500000 0.500000 1.0 vertex -1 1.0 vertex vertex
+-1 bone vertex 1.0 vertex texture anim frame = 1.0 bone bone = 1.0 vertex
+0.500000
+vertex frame -1 1.0 anim -1 frame
+0.500000 0.500000 texture material 0.500000 = bone bone bone bone 0.500000 0.500000 1.0 anim 1.0 0.500000 anim texture texture anim frame frame
+-1 texture
+vertex 0.500000 -1 = bone vertex 0.500000
+bone
+material frame 0.500000
+anim = anim texture vertex
+1.0 = bone vertex
+texture 1.0 material frame vertex
+0.500000 frame -1 0.500000
+texture = anim = 0.500000 -1 = bone =
+0.500000 material material frame 0.500000 1.0 0.500000
+-1
+frame vertex vertex anim =
+-1 -1 0.500000 anim 1.0 anim material
+-1 -1
+1.0 texture bone
+vertex = texture frame
+frame texture 1.0 anim 0.500000 = texture 0.500000 vertex material anim
+-1 bone 1.0 0.500000 material texture vertex material
+-1 material frame 1.0
+texture frame frame -1 bone material vertex bone anim texture
+texture
+bone bone anim = anim -1 0.500000 frame 1.0
+1.0 vertex anim frame vertex anim anim material = bone = material bone frame -1 1.0 material -1
+-1 1.0 vertex
+material frame
+material = bone = vertex anim
+texture anim
+frame
+vertex texture frame 0.500000 -1 -1
+1.0 bone vertex 1.0
+1.0 0.500000
+vertex 1.0 anim -1 material
+frame 0.500000 1.0 bone
+texture -1 0.500000
+material material
+=
+bone 0.500000
+bone 1.0 frame
+bone texture material 1.0 anim anim material frame texture
+material bone texture
+frame frame material 0.500000 bone vertex 1.0 bone -1
+1.0 = = = frame
+bone 1.0
+frame
+1.0 -1
+bone
+frame texture -1 0.500000 vertex 0.500000 anim
+frame
+=
+texture bone
+=
+-1 material bone material
+-1 -1
+vertex vertex anim 1.0 = 1.0 0.500000 anim
+frame 0.500000 material
+texture frame
+anim
+-1
+anim = -1 vertex = bone frame 1.0 1.0 bone vertex anim
+texture
+vertex
+1.0
+frame texture anim vertex bone
+vertex vertex 1.0 material material frame texture bone frame -1 frame vertex texture 1.0
+-1 frame = bone
+material 1.0 texture 0.500000 0.500000
+bone frame texture 0.500000
+-1 anim 0.500000 material
+0.500000
+1.0
+bone 1.0
+bone -1 material frame vertex 1.0 material texture texture
+vertex -1 material material
+bone anim texture anim
+-1 1.0
+1.0
+frame
+texture -1 -1
+0.500000 anim 1.0
+texture 1.0 -1 texture
+frame
+1.0 1.0 = vertex = -1 bone vertex
+anim frame
+anim material material 0.500000 material
+=
+bone material frame
+0.500000 bone anim
+vertex texture texture frame anim bone texture
+vertex
+0.500000
+=
+vertex vertex -1 bone -1 -1 texture
+bone
+material material frame bone 1.0 -1 bone
+bone -1 1.0 anim frame
+-1 1.0 vertex frame anim
+vertex texture -1 0.500000 texture vertex -1 0.500000 anim anim frame bone -1 bone = = frame
+-1 0.500000
+anim material
+bone
+texture
+vertex texture material bone frame material texture
+vertex 0.500000 texture
+=
+anim vertex
+0.500000 -1 0.500000
+bone
+0.500000 bone texture bone material
+material vertex
+0.500000 1.0
+-1
+vertex 0.500000 vertex material
+bone -1 1.0 bone vertex
+frame
+1.0
+1.0 material material 0.500000
+anim 0.500000 anim = vertex vertex
+vertex texture bone texture anim 1.0
+material 1.0 -1 0.500000
+1.0 anim anim
+vertex -1 frame material -1 texture -1 0.500000 material = = bone
+1.0
+material
+-1 frame texture frame texture
+vertex = =
+-1 texture
+anim
+-1
+frame -1
+frame texture 1.0 = vertex -1 0.500000 anim vertex
+texture =
+vertex vertex
+frame texture material frame 0.500000 1.0 texture vertex
+material
+vertex
+material -1
+=
+bone anim
+bone = vertex frame frame bone texture vertex material
+0.500000 anim = =
+material 0.500000
+frame bone
+bone 0.500000 material
+vertex -1 -1 -1
+bone
+texture material 0.500000 = frame material
+material -1 frame texture
+bone =
+=
+1.0 frame
+1.0
+bone 0.500000 0.500000 1.0 vertex -1
+1.0
+frame -1 material 1.0 vertex texture
+-1 = 1.0
+0.500000
+texture vertex vertex texture 0.500000
+= texture anim
+= texture 0.500000 anim
+0.500000 anim
+-1
+vertex
+frame texture 1.0 0.500000 0.500000 bone
+vertex bone
+= frame -1 1.0 material
+1.0 0.500000 0.500000 texture vertex 1.0 = 1.0 = frame -1
+0.500000
+vertex vertex anim = material =
+vertex
+material
+material -1
+texture vertex vertex material
+vertex bone vertex 1.0 = anim material vertex
+-1 frame
+= anim material 1.0 1.0 =
+bone -1
+bone
+1.0 1.0 0.500000
+-1
+vertex 0.500000 =
+= -1 bone
+material anim texture
+-1 material vertex vertex vertex = material texture
+vertex bone 1.0 texture vertex frame anim bone materi
\ No newline at end of file
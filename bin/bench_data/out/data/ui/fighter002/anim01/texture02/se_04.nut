@@ -0,0 +1,230 @@
+0.500000 0.500000 =
+texture -1
+0.500000 vertex texture
+frame frame 0.500000 1.0
+anim bone -1 frame bone vertex bone texture -1 vertex -1 texture vertex vertex frame
+texture frame anim -1 frame
+1.0 bone -1
+vertex vertex
+frame material frame -1 material vertex vertex
+= = texture frame anim material anim anim 0.500000 frame texture anim frame bone 0.500000 anim anim anim frame anim 0.500000 texture 0.500000
+1.0 1.0 texture
+anim bone
+1.0 1.0
+-1 = 0.500000 = bone frame vertex = = frame 0.500000
+0.500000
+0.500000 anim -1 1.0 -1 1.0 material
+texture 1.0 1.0 0.500000 texture
+-1 0.500000 0.500000
+anim bone texture
+vertex
+bone texture
+material 0.500000 material anim material 1.0 material = 0.500000
+material material vertex
+anim =
+anim texture 1.0 frame material
+= -1 bone
+frame bone texture texture
+frame frame = vertex -1 texture
+bone
+frame
+texture 0.500000 0.500000 -1 anim
+vertex texture
+-1 material -1
+texture anim anim
+material 1.0 = texture frame vertex =
+frame 1.0
+material material -1 frame texture 0.500000 bone 1.0 anim -1 bone
+0.500000 -1
+texture = 0.500000 = 0.500000
+= material =
+bone bone vertex
+bone bone 0.500000 frame
+frame 1.0
+anim 1.0 0.500000 1.0
+texture 0.500000 = material texture vertex
+texture anim
+-1 -1 anim
+-1 =
+frame -1 vertex 1.0 frame frame anim -1 -1 vertex texture vertex texture bone frame bone anim -1 = -1 anim vertex
+0.500000
+anim texture material
+0.500000 bone
+-1 vertex
+vertex
+= vertex texture vertex
+anim -1 material 0.500000 bone =
+= frame texture frame 1.0 texture material 1.0 vertex
+frame
+= 0.500000 -1 frame
+texture
+bone 0.500000 bone 0.500000 bone texture anim 0.500000
+1.0 vertex material -1
+anim = frame 0.500000 bone 0.500000 =
+= material frame 0.500000
+anim anim texture 0.500000
+= bone
+1.0 anim
+texture 1.0 anim =
+= texture frame = = =
+material anim 1.0 1.0 bone
+anim
+0.500000
+material bone frame anim
+bone = -1 material material 0.500000 1.0
+bone anim anim 1.0 -1 frame 1.0 texture anim material vertex
+material -1 -1 bone material frame vertex 0.500000 material 1.0 -1 1.0 bone vertex material 0.500000 texture texture texture
+bone
+1.0 1.0
+0.500000 vertex 1.0 = -1 -1 1.0 0.500000 material vertex frame material
+0.500000 texture 1.0 material anim bone anim
+anim
+0.500000
+frame anim
+bone bone frame bone 0.500000 bone
+anim
+material texture
+texture 1.0 -1 -1 bone vertex -1
+vertex -1 -1 frame
+bone 0.500000
+0.500000 vertex frame anim 1.0
+texture
+texture anim anim anim 1.0
+-1 bone texture =
+material texture texture 1.0 anim
+1.0 material anim anim bone
+-1
+material -1
+= frame anim frame
+frame frame 1.0
+frame vertex material bone texture
+1.0 bone
+vertex
+texture
+= -1 0.500000 1.0 vertex vertex = frame = vertex 0.500000 material 0.500000 anim
+frame 1.0
+0.500000
+texture
+1.0 =
+-1 0.500000 = vertex
+1.0 frame texture
+-1
+texture -1 -1 vertex
+anim bone
+anim
+-1 anim bone = material material 0.500000
+vertex anim = material 1.0 1.0 -1 1.0 = vertex -1 bone
+vertex anim material 0.500000 texture bone
+1.0
+texture -1 1.0 texture =
+anim =
+1.0
+= anim = bone texture 0.500000
+0.500000 frame texture 0.500000
+vertex = material
+=
+0.500000
+anim
+bone =
+= frame -1 material
+texture anim 0.500000 texture
+-1 anim bone = = 0.500000 frame = = frame -1 vertex = vertex 0.500000
+0.500000 = texture
+1.0 =
+-1 material anim
+texture = = -1
+frame vertex =
+anim
+0.500000 0.500000 frame anim frame vertex material -1 frame = 0.500000 texture vertex texture frame
+0.500000 -1 1.0 = = frame -1 0.500000 = 1.0
+1.0 =
+frame =
+0.500000
+anim
+-1 texture texture 1.0 frame
+frame -1
+vertex = vertex -1 anim 0.500000 vertex frame 1.0 =
+bone material material anim bone bone vertex = 0.500000
+= vertex
+= texture
+vertex frame bone
+1.0 texture anim -1 = = = texture anim vertex texture bone material
+0.500000
+1.0
+material material -1 0.500000 vertex vertex
+-1 texture bone
+frame 0.500000 texture 1.0 frame -1
+vertex 0.500000 = = vertex anim vertex -1
+bone
+vertex frame -1 material -1 vertex
+= vertex
+material anim 1.0 material
+-1 material = 1.0 0.500000
+material vertex
+texture anim 0.500000 0.500000 vertex frame 0.500000
+texture
+0.500000 -1 anim
+anim frame anim
+bone anim bone 0.500000 1.0 bone material bone 0.500000
+frame bone vertex
+bone
+vertex
+0.500000 0.500000 anim
+bone frame = = 1.0
+material material
+0.500000
+frame = 0.500000 1.0 0.500000
+anim 1.0 material
+vertex frame anim frame frame -1
+texture anim 1.0 1.0
+bone material 0.500000 1.0 1.0
+vertex anim 1.0 frame bone vertex texture =
+vertex texture bone frame texture frame -1
+material material 0.500000
+= 0.500000 material bone -1 anim =
+=
+material bone vertex
+texture 0.500000
+frame material frame vertex 0.500000 anim material -1 material anim bone 0.500000 texture -1 vertex 1.0 = = bone bone texture texture anim bone frame material material bone material 0.500000
+frame
+0.500000 1.0
+-1
+vertex -1 vertex anim -1 vertex 0.500000 -1 1.0 vertex
+1.0 texture 1.0 -1
+1.0 material 1.0 anim 0.500000 frame 0.500000 bone 1.0 1.0 material 0.500000 1.0 material material material texture texture anim
+= texture
+0.500000 texture 0.500000 0.500000 bone anim 1.0
+1.0 bone -1 texture 0.500000 -1
+material texture
+frame 0.500000 0.500000 =
+frame vertex texture vertex texture material
+vertex
+anim frame vertex material -1 0.500000 -1 anim 0.500000 frame anim material
+= material
+0.500000 anim anim
+vertex vertex frame material vertex material
+bone
+frame bone vertex frame material
+material material
+= material = -1
+anim
+-1 frame bone 1.0 0.500000 vertex bone 1.0 frame anim 0.500000
+0.500000 material vertex texture vertex bone
+0.500000 texture = = 0.500000 -1 texture
+-1 material texture vertex
+anim
+0.500000 vertex -1 bone anim -1 frame bone 0.500000 1.0 -1 =
+0.500000 vertex 1.0 frame 1.0 = vertex 1.0 -1 0.500000 anim 1.0
+vertex texture material
+texture
+material frame
+texture
+vertex -1
+-1 0.500000 material
+frame -1 -1
+bone
+material 1.0
+material
+frame anim anim anim material = 0.500000 -1 1.0 texture material anim vertex
+frame texture texture material -1
+1.0 bone = 1.0 -1 frame material vertex anim bone frame frame 0.500000 1.0 = material frame frame -1 bone bone materia
\ No newline at end of file
@@ -0,0 +1,9 @@
+1.0 0.500000 texture
+1.0 texture
+frame
+0.500000
+0.500000
+bone 1.0 texture 0.500000 texture
+0.500000
+1.0 bone
+frame anim bone texture frame -1 frame bone material texture -1 -1 anim 0.500000 anim 1.
\ No newline at end of file
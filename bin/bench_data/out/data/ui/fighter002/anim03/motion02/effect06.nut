@@ -0,0 +1,312 @@
+1.0 material frame material = frame 1.0
+= vertex material
+1.0 material
+vertex frame 0.500000 material 0.500000 1.0 vertex
+vertex material =
+-1 = 0.500000 0.500000
+-1 vertex vertex -1 material
+= bone bone 1.0 vertex
+texture -1 1.0 1.0 texture bone
+vertex -1
+1.0
+-1 bone frame material bone
+anim 1.0
+vertex
+= 1.0 frame
+bone frame 0.500000 =
+= 0.500000 0.500000 material
+bone
+vertex
+vertex material
+texture
+frame frame
+material material
+material texture material 0.500000 = texture anim -1 texture -1 1.0
+-1 material anim
+texture
+bone frame texture anim -1
+-1 1.0 1.0
+material
+material -1 material 0.500000
+=
+1.0
+vertex anim material 0.500000 = anim 0.500000 0.500000 = vertex texture =
+material
+bone anim
+bone material
+1.0
+frame 0.500000 material -1 0.500000 bone 0.500000 = -1
+material texture 0.500000 anim 0.500000 material
+-1 -1 texture 0.500000
+0.500000
+vertex
+frame 0.500000 = vertex
+anim texture texture material texture frame vertex
+-1 =
+0.500000 bone 0.500000 =
+anim 0.500000 0.500000 = =
+bone
+-1 0.500000 0.500000 -1 0.500000 vertex -1
+0.500000
+vertex
+material vertex texture 0.500000 material frame
+bone -1 1.0 texture 1.0
+= 1.0 anim frame
+frame
+vertex vertex
+=
+texture
+0.500000 -1 bone
+texture bone
+material
+=
+texture
+texture 1.0 anim
+material material anim
+0.500000 vertex frame
+vertex frame
+bone = anim
+vertex
+texture bone texture material 0.500000 anim anim
+anim
+-1 0.500000 bone
+=
+1.0 1.0
+-1
+frame 1.0 0.500000 anim =
+-1
+bone vertex
+1.0 material
+bone
+material frame 1.0 = vertex 1.0
+1.0 0.500000
+1.0 material frame material texture vertex texture -1 anim -1 bone anim -1 0.500000 material 1.0 = 0.500000
+0.500000 material vertex bone anim bone material bone
+vertex 1.0 frame
+material vertex
+material -1 -1 frame 1.0
+vertex anim
+frame
+frame vertex bone =
+= 1.0 anim vertex
+bone 0.500000 bone
+frame
+0.500000 anim anim
+-1 material anim
+1.0 texture = bone material bone anim 1.0 = 1.0 material texture vertex
+vertex -1 texture bone vertex 1.0 frame material -1 bone
+1.0 -1 frame -1 bone
+-1 frame bone texture bone frame
+-1 1.0 1.0 texture 1.0
+material
+bone 0.500000 bone
+-1 -1 frame 0.500000 vertex frame anim = vertex
+= anim anim anim anim
+-1 1.0 texture anim -1
+-1 texture bone
+texture vertex vertex 0.500000 material 1.0
+vertex texture anim
+material anim
+0.500000 vertex vertex 1.0 frame bone anim
+1.0
+= anim anim 0.500000 0.500000 = 0.500000 frame
+-1 vertex
+frame 0.500000
+0.500000 bone -1 =
+-1 bone
+frame
+bone -1 anim
+texture
+0.500000 = texture
+frame material 0.500000
+0.500000 vertex texture bone bone texture
+0.500000 frame
+0.500000 bone = material material anim = material anim
+texture material
+frame
+= 1.0 1.0
+bone
+0.500000 material material anim frame frame texture
+bone -1
+material frame = -1 texture 1.0
+bone
+material bone 0.500000 bone
+vertex
+1.0 bone vertex -1 material frame 0.500000 = texture material
+frame -1
+vertex 1.0
+texture vertex anim
+-1 bone 1.0 texture -1
+0.500000 anim texture -1
+-1 frame
+texture
+0.500000
+texture = -1 = bone = vertex texture = frame vertex bone material vertex 0.500000
+frame
+texture frame
+frame 0.500000 anim vertex frame = bone
+=
+frame material -1 1.0 texture bone 0.500000 anim = anim frame -1 = =
+material
+vertex
+-1
+-1
+-1 material vertex anim = texture material 1.0
+texture
+0.500000 -1 1.0 frame bone vertex
+0.500000 material = vertex -1 anim
+texture
+0.500000 bone 0.500000 material bone material material
+vertex
+1.0 material 1.0
+= 0.500000 texture
+frame texture 0.500000 bone 1.0 texture 1.0 0.500000 = texture 1.0
+material bone
+0.500000
+frame = vertex
+bone -1 texture
+vertex 1.0 -1 0.500000 texture
+0.500000
+texture frame -1
+texture
+-1 anim frame 0.500000 material bone
+-1 frame
+1.0 0.500000 frame
+bone bone frame
+1.0 vertex texture bone vertex =
+vertex anim frame 1.0
+texture vertex 0.500000 0.500000 = material 0.500000
+1.0 material vertex
+frame anim 1.0 -1 frame vertex texture
+0.500000
+vertex material frame bone texture
+anim bone =
+1.0 = vertex frame texture
+material bone
+bone -1 = anim =
+frame -1 =
+material
+frame material
+material
+material material 1.0 material 0.500000
+vertex material bone vertex 0.500000 0.500000
+= vertex texture
+anim -1 anim frame bone 0.500000
+material
+anim
+anim = = texture
+material = 1.0
+-1
+texture 0.500000 = frame frame 1.0
+= frame
+bone bone texture texture
+-1 vertex texture bone
+texture texture = bone 0.500000 vertex material material texture 0.500000 -1 frame anim anim texture = = 1.0 anim texture
+material bone
+material
+=
+anim texture texture
+= bone 1.0
+-1 0.500000
+bone 1.0 frame vertex 0.500000 bone -1 vertex vertex anim texture
+= -1
+1.0 1.0
+frame -1
+vertex =
+-1 frame anim bone -1 vertex
+material bone frame 0.500000 bone
+bone material
+1.0 -1
+anim frame frame -1 -1
+0.500000
+= vertex 0.500000 frame anim anim
+frame frame
+-1 1.0 -1 1.0
+1.0 bone bone
+frame material
+1.0 1.0 -1 vertex 1.0 material
+1.0 1.0 frame
+1.0 frame anim 1.0 0.500000 vertex material
+frame
+-1 vertex vertex bone = vertex 0.500000 bone anim
+texture -1 0.500000 = bone bone 0.500000
+anim = bone -1 vertex vertex -1 anim
+0.500000 0.500000
+0.500000 vertex material anim = material anim
+texture material
+texture anim = bone = material
+vertex frame
+anim texture anim bone
+1.0 = material texture vertex
+bone
+1.0 -1 -1
+material
+-1 vertex vertex anim
+anim -1 texture
+frame
+bone vertex frame bone
+=
+material material anim 1.0 material vertex texture -1 = material -1 bone -1 =
+material frame 0.500000 vertex
+material bone
+1.0 0.500000 texture -1 1.0 1.0
+1.0 -1 -1
+frame material 0.500000 = bone texture bone texture texture bone
+frame 0.500000 vertex
+=
+bone -1
+0.500000 vertex texture
+material 1.0 texture = material vertex anim material vertex material anim 0.500000 =
+vertex texture
+material
+anim texture anim anim texture frame vertex =
+0.500000
+vertex
+-1 -1 1.0 texture anim 1.0 texture texture bone
+0.500000
+vertex
+anim 1.0 anim material 0.500000 material anim
+texture texture 0.500000 = bone texture vertex anim bone -1 anim
+= 0.500000 vertex bone material bone
+texture anim anim texture vertex texture frame bone 0.500000 0.500000
+0.500000 bone anim -1 =
+= 1.0 1.0
+anim
+material material bone texture 0.500000 texture
+frame 1.0 texture anim frame 0.500000 0.500000 0.500000 material bone
+-1
+material 1.0 = 1.0 -1 anim texture vertex
+= bone -1
+0.500000
+bone frame
+texture 0.500000 0.500000 -1
+= bone
+0.500000
+1.0 vertex bone
+texture = -1 frame vertex 1.0
+bone material = 1.0 material material anim
+bone
+1.0 frame material anim 0.500000 bone 0.500000 0.500000 0.500000 = frame
+vertex -1 1.0 1.0 bone anim
+texture
+vertex
+bone
+bone -1 = 1.0 1.0 vertex
+= -1 frame
+bone 1.0
+0.500000 = -1 vertex
+anim -1
+vertex
+1.0 anim 1.0
+= texture 1.0 0.500000
+vertex = frame
+bone frame 1.0 material bone = -1
+material 0.500000
+0.500000
+vertex material frame material = bone bone
+=
+1.0 -1 1.0 bone 1.0
+= frame = anim texture anim anim 1.0 anim vertex
+1.0 =
+-1
+1.0 0.500000 textu
\ No newline at end of file
@@ -0,0 +1,9 @@
+anim anim anim 0.500000 = texture -1 frame vertex bone
+vertex
+0.500000
+vertex material vertex texture bone 0.500000 anim material
+0.500000 vertex
+material
+0.500000 material
+0.500000 vertex anim bone
+vertex ma
\ No newline at end of file
@@ -0,0 +1,6 @@
+0.500000 vertex
+0.500000 -1 0.500000
+=
+anim
+anim
+1.0 -1 materia
\ No newline at end of file
@@ -0,0 +1,66 @@
+texture
+1.0 -1 texture
+1.0 frame = 1.0
+1.0 bone = 1.0 vertex
+1.0
+frame -1
+0.500000 1.0 0.500000 1.0 bone 1.0 frame 1.0 = = 1.0
+texture =
+anim
+0.500000 0.500000 bone vertex material texture
+vertex frame
+texture
+=
+bone
+material
+= = -1 0.500000 = bone -1 anim frame material texture frame
+bone
+1.0 material = bone material =
+0.500000 -1
+-1
+texture = vertex frame 0.500000
+texture texture 1.0 anim
+= 1.0 material material bone bone 0.500000
+= texture
+bone
+1.0 bone
+frame
+texture 1.0 vertex 1.0
+1.0
+= bone
+=
+vertex anim texture vertex anim
+bone texture 1.0 material texture bone vertex texture 0.500000 vertex
+texture vertex frame 1.0 -1 bone anim anim
+=
+vertex
+anim -1 1.0 frame material = vertex 0.500000 -1
+1.0 1.0 0.500000 = vertex texture anim 1.0 material material vertex = texture
+material anim bone
+1.0 material texture = anim
+1.0 = material -1 0.500000
+frame 0.500000 texture = =
+bone frame = material vertex
+= bone vertex anim 0.500000
+frame material bone
+1.0 -1 texture vertex frame
+material 0.500000
+anim anim texture
+texture
+material -1
+anim -1 material
+=
+anim vertex material frame vertex frame 1.0
+1.0 1.0 frame 0.500000 0.500000 frame -1 anim 1.0 0.500000 texture anim 1.0
+bone 0.500000 frame 0.500000 bone material 0.500000
+frame bone bone
+=
+=
+1.0 -1 vertex =
+0.500000 -1
+vertex frame texture texture frame
+bone =
+0.500000 = anim
+material 0.500000 material -1 vertex bone
+1.0 texture
+b
\ No newline at end of file
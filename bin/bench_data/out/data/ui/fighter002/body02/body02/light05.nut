@@ -0,0 +1 @@
+[5(a.t0N_"Ƞ/Zjޏ_rp
\ No newline at end of file
@@ -0,0 +1,12 @@
+material 1.0 frame
+texture -1 0.500000 -1 bone vertex texture = vertex
+-1 0.500000 vertex 0.500000 -1 anim anim 1.0 = 1.0 1.0 material bone
+= anim 0.500000 = bone
+1.0 frame = -1 anim -1
+frame bone texture 0.500000 0.500000 -1 -1 1.0 frame
+frame
+anim
+0.500000 texture frame bone
+-1 frame
+bone = anim material material vertex 0.500000 frame vertex anim -1 -1 = 0.500000
+anim material anim an
\ No newline at end of file
@@ -0,0 +1,3 @@
+bone anim 0.500000
+frame anim vertex vertex
+bone -1 
\ No newline at end of file
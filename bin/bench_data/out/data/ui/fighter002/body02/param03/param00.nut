@@ -0,0 +1,123 @@
+material anim 0.500000
+0.500000 frame
+anim 0.500000
+0.500000 material material 1.0 material -1
+frame vertex = frame 1.0
+vertex frame bone
+anim vertex bone vertex material texture = 0.500000 anim
+texture
+bone
+0.500000 anim
+bone
+frame 0.500000
+= 1.0 anim 1.0 0.500000 vertex bone 1.0 anim frame frame
+texture
+= 1.0 material
+vertex -1 material 1.0
+frame material bone
+texture 0.500000 anim 0.500000 bone 0.500000
+vertex
+texture texture
+-1 texture anim frame -1
+texture
+material bone 1.0
+vertex material -1 anim
+frame texture
+texture texture material material 0.500000 frame bone
+bone
+vertex
+0.500000 = vertex = -1 -1 anim material vertex = 1.0 frame frame material
+texture 1.0 texture vertex = 0.500000 frame material anim vertex bone vertex anim 0.500000 0.500000 bone -1 vertex anim
+0.500000
+vertex = -1 frame
+vertex 1.0
+bone -1
+frame anim vertex
+frame
+material
+bone
+vertex material vertex
+bone 0.500000
+anim 0.500000 0.500000 0.500000 vertex material bone -1 bone 0.500000
+0.500000 texture anim 1.0 0.500000 bone texture = anim frame frame frame
+1.0 1.0 -1
+1.0 = texture frame anim = 0.500000 vertex 1.0 bone -1
+frame anim 1.0 0.500000 1.0 texture -1
+-1 0.500000 =
+= frame 1.0 =
+= bone 1.0 bone anim
+0.500000
+texture -1
+vertex 1.0 material -1 frame 0.500000 frame
+anim frame material
+anim = frame frame 0.500000
+-1 vertex
+material 1.0 anim texture -1 -1
+= = 1.0
+=
+material
+frame 1.0 material -1 texture texture
+anim 1.0
+= =
+1.0 anim material
+=
+frame 0.500000 0.500000 frame vertex bone
+anim 0.500000 0.500000 1.0
+bone -1
+anim
+= anim 0.500000 1.0 frame
+vertex bone
+= bone bone texture
+texture
+vertex material material anim
+texture texture anim anim 0.500000 0.500000 -1 1.0 vertex 1.0
+0.500000 material
+material 1.0 frame frame vertex -1 = 1.0 anim bone texture 1.0 -1 vertex texture material texture material frame 1.0 frame
+0.500000 bone material frame
+= 1.0 anim -1 texture material vertex
+vertex
+-1 bone frame -1 1.0 frame
+0.500000 frame texture texture
+0.500000 material -1 bone bone anim -1 1.0 1.0 frame
+= bone material bone -1
+material
+frame
+vertex
+bone 1.0 vertex
+anim -1 0.500000 anim bone -1 anim vertex frame -1
+0.500000 texture frame material = anim texture frame texture =
+material bone vertex frame texture frame
+frame
+-1 texture vertex vertex bone frame 1.0 anim
+vertex material 0.500000 bone
+texture
+0.500000 =
+1.0
+anim vertex 1.0 -1 0.500000
+anim material anim
+material bone 1.0 frame 1.0
+vertex
+vertex vertex frame 1.0 vertex anim -1 = = material bone material
+anim 1.0 anim
+bone 0.500000 vertex anim vertex vertex anim anim frame vertex 1.0 = texture bone bone -1 frame
+= anim 1.0
+1.0 -1 frame 1.0 0.500000 texture 1.0 = -1
+0.500000 material
+vertex vertex -1 bone -1
+1.0 bone
+= 0.500000 -1 0.500000
+=
+0.500000 bone texture
+1.0 texture
+0.500000
+bone bone 0.500000 = anim
+=
+frame anim
+frame -1
+=
+texture texture 1.0 vertex frame bone material
+0.500000 0.500000
+0.500000 texture -1 material = material bone -1 = 0.500000 frame texture texture vertex 1.0
+anim frame vertex
+material 1.0 -1 vertex 1.0 texture anim texture
+1.0 0.500000
\ No newline at end of file
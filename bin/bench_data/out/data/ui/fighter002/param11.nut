@@ -0,0 +1,3 @@
+0.500000 frame
+-1 anim texture vertex frame
+an
\ No newline at end of file
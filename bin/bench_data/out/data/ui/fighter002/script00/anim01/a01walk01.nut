@@ -0,0 +1,10 @@
+1.0
+bone material
+frame anim
+-1 texture
+texture
+-1
+frame 1.0 0.500000 frame
+bone bone = 0.500000 = vertex frame
+bone 1.0 material 0.500000 texture
+anim 0.50000
\ No newline at end of file
@@ -0,0 +1,23 @@
+material -1 -1 material bone 0.500000 1.0 -1 anim bone bone 0.500000
+1.0 bone material material bone 0.500000 texture bone 0.500000 = = texture vertex bone
+bone frame
+material vertex anim material = vertex 0.500000 frame
+anim texture vertex 0.500000 texture
+1.0 material vertex frame 1.0
+frame 1.0 1.0 1.0 =
+material
+anim -1 texture -1 texture bone frame material anim frame
+-1 anim anim = frame
+material bone material 0.500000
+1.0 0.500000 -1 =
+anim 1.0 frame anim frame bone
+vertex material 0.500000 -1 0.500000 = frame frame anim material texture
+1.0 material material 0.500000 frame anim vertex -1
+0.500000 vertex bone texture bone frame anim 0.500000 material 1.0 0.500000 anim
+material
+vertex 1.0 anim 0.500000 material = material frame 0.500000
+texture 1.0 frame bone
+=
+vertex 0.500000
+0.500000
+0.500000 mater
\ No newline at end of file
@@ -0,0 +1,109 @@
+= bone = texture 0.500000 1.0 vertex = anim texture frame anim
+0.500000 material texture anim = texture
+0.500000 1.0 frame 0.500000 1.0
+vertex = texture frame texture frame 1.0 bone = 0.500000
+= frame 0.500000 -1 = =
+= material 1.0 anim material vertex
+-1 frame vertex 1.0 anim =
+material anim -1 0.500000 bone
+frame anim anim
+1.0
+anim bone
+anim
+=
+texture vertex frame
+bone texture
+= 1.0 anim 1.0
+anim texture 0.500000 1.0 material
+vertex vertex material bone material texture
+texture
+bone
+-1 -1 bone 0.500000 texture texture material frame anim =
+anim frame 0.500000 vertex material 1.0 bone = material texture vertex =
+vertex bone =
+material vertex vertex 1.0 bone vertex
+material 0.500000 0.500000
+vertex 1.0
+1.0 1.0 texture
+0.500000
+1.0 material texture
+frame texture anim 0.500000 = -1 anim frame vertex anim bone material anim
+=
+1.0
+texture -1
+frame material 0.500000 frame material = material vertex
+anim
+vertex
+bone
+vertex = frame material vertex vertex bone 0.500000 material anim texture bone
+= -1
+0.500000 1.0 texture material
+vertex frame 1.0 vertex anim
+bone = bone anim frame material = frame
+vertex bone texture
+0.500000
+bone
+frame bone 0.500000 0.500000 texture -1 texture = vertex texture anim
+-1 anim = frame anim vertex anim frame -1
+= bone vertex
+-1 material
+1.0
+texture = 1.0
+bone =
+texture 0.500000 material
+= anim bone bone anim frame
+frame 1.0 1.0
+vertex frame texture
+frame bone
+texture bone frame material bone -1 = bone bone 0.500000 1.0 1.0 anim material anim 1.0
+= frame anim = 1.0 1.0 vertex bone
+vertex texture texture bone
+= -1
+vertex texture 1.0
+frame 0.500000 anim bone bone anim
+-1 0.500000 bone anim
+anim
+-1 0.500000
+0.500000 frame frame vertex
+-1 texture
+1.0 = = 1.0
+texture bone bone -1 anim anim 0.500000
+bone
+bone
+0.500000 0.500000
+-1
+frame anim vertex -1 bone bone anim bone
+anim anim material 1.0
+anim texture anim 0.500000
+anim bone anim vertex 0.500000 frame 1.0 texture 1.0 bone = 0.500000
+= frame
+-1 frame vertex -1 bone frame -1
+anim bone texture = bone bone
+-1 anim bone vertex
+bone bone = anim -1
+material frame anim anim
+texture 0.500000 1.0
+-1 bone 0.500000 frame material = = vertex texture frame texture
+0.500000 bone bone 0.500000
+material
+-1
+=
+frame bone anim -1 anim vertex texture
+vertex texture
+material anim frame 1.0 1.0 texture -1 0.500000 bone -1 1.0 bone -1 0.500000 texture 0.500000
+bone vertex anim 1.0 material -1 -1 0.500000 anim
+= =
+anim
+0.500000
+material
+material 1.0 vertex = vertex bone bone 0.500000 frame bone anim texture frame bone -1 frame = = texture
+0.500000 frame 0.500000 = 0.500000
+material anim material frame
+-1
+material vertex bone 1.0 material = 1.0
+bone bone bone vertex
+anim
+0.500000 vertex 1.0 material = 1.0 vertex
+material
+bone material -1
+vertex 1.0 vertex frame 
\ No newline at end of file
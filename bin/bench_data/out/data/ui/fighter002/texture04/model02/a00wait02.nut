@@ -0,0 +1,16 @@
+-1 -1
+-1 -1 vertex vertex = frame anim 1.0 = material -1 material 1.0
+vertex =
+material = frame
+frame
+1.0 = 1.0 -1 texture material
+bone bone bone bone
+1.0 1.0 1.0 -1 texture anim bone
+texture frame -1
+anim bone frame = material anim 1.0 bone texture
+bone 1.0 material bone 0.500000 = bone
+material frame texture material material frame vertex vertex 1.0 1.0 =
+= vertex
+=
+0.500000 1.0
+-1 anim 1.0 texture 0.500000
@@ -0,0 +1,77 @@
+vertex material
+0.500000 -1
+material 0.500000
+frame frame 0.500000 = bone -1 anim 0.500000
+frame material 1.0 material material material
+-1 -1
+= = frame
+= 0.500000 anim 1.0 anim
+0.500000 texture 0.500000 bone 1.0 bone 1.0
+1.0 texture -1 anim bone
+anim 0.500000 texture frame 1.0 0.500000 material frame vertex texture
+bone frame
+bone 0.500000 texture
+-1
+1.0 -1 bone
+0.500000 bone = 1.0 texture 0.500000 =
+vertex 1.0
+texture bone -1 bone 0.500000
+bone anim anim -1 texture -1 -1
+= frame
+0.500000 vertex bone
+bone
+0.500000 0.500000
+material -1 anim bone 1.0 1.0 = vertex -1 anim
+1.0 anim 0.500000 material bone vertex -1
+anim texture -1 texture
+0.500000 0.500000 texture 0.500000 0.500000 = -1
+frame 0.500000 -1 1.0 texture
+material texture = anim
+0.500000 0.500000
+1.0 texture bone material texture
+-1
+=
+texture = -1 bone material material 1.0 0.500000 texture texture anim -1
+frame material 0.500000 anim anim =
+-1 material texture 1.0
+1.0
+vertex anim
+texture
+bone material anim texture frame = texture frame material
+1.0 =
+-1 bone material 0.500000 anim
+vertex bone 1.0 -1 bone vertex frame 0.500000 frame vertex
+material = vertex
+vertex frame
+1.0 frame vertex = anim frame 0.500000
+1.0 -1
+-1 anim vertex
+vertex bone frame texture 0.500000 = -1
+= -1
+=
+vertex bone material 1.0 vertex
+bone
+0.500000
+0.500000 -1 texture bone vertex vertex 0.500000 frame = 0.500000 anim
+anim anim anim 1.0 texture frame bone texture material anim frame -1
+1.0 0.500000 texture 1.0 -1 bone
+vertex
+0.500000 frame 1.0 vertex
+= texture 1.0
+=
+vertex vertex bone texture -1
+material frame vertex 1.0 = 1.0 frame
+=
+-1 bone anim material 1.0
+texture frame vertex -1 0.500000
+vertex vertex material
+-1 frame vertex anim
+1.0
+0.500000
+vertex
+material material texture = 1.0
+bone bone anim
+= anim frame vertex
+vertex 0.500000
+texture
+-1 material texture bone -1 = frame fr
\ No newline at end of file
@@ -0,0 +1,40 @@
+anim texture
+= = bone vertex
+-1 anim material = bone frame =
+anim bone -1 vertex material anim 1.0 bone 1.0 1.0 material
+0.500000
+material =
+-1 0.500000 bone 0.500000 0.500000 texture
+vertex = 1.0 1.0 -1 frame frame 1.0 -1 =
+=
+bone frame
+-1
+-1 =
+frame vertex = -1 0.500000 vertex
+vertex texture
+bone bone -1 bone 0.500000 -1
+1.0 bone frame
+-1
+= 0.500000
+material bone = material vertex = 1.0 texture 0.500000 0.500000 -1 texture
+texture vertex vertex -1 vertex 0.500000 frame -1
+-1 anim frame material 0.500000 = 0.500000 -1 anim frame 1.0 -1 0.500000
+= 1.0 1.0
+0.500000 0.500000 frame frame 0.500000
+anim bone -1 frame -1 texture
+anim
+= vertex -1 frame
+bone anim vertex vertex
+material texture bone 1.0
+-1 vertex 0.500000 vertex material material
+frame 0.500000
+vertex
+anim
+bone
+-1
+= texture = 0.500000 texture frame vertex
+anim
+1.0 0.500000 anim texture
+frame = frame
+1.0 0.500000
+-1 1.0 -1 vertex anim -
\ No newline at end of file
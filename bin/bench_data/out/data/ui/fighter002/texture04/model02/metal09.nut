@@ -0,0 +1 @@
+vertex vertex anim 0.500000 material -1 texture bone = bone material
\ No newline at end of file
@@ -0,0 +1,8 @@
+0.500000 0.500000 0.500000
+vertex
+=
+material material vertex bone
+-1 anim texture anim vertex
+0.500000 0.500000 texture =
+= -1
+bone anim material material 0
\ No newline at end of file
@@ -0,0 +1,37 @@
+= 0.500000 bone -1 frame
+= texture bone -1 0.500000 =
+0.500000 texture bone anim material = 1.0
+frame
+anim material = =
+-1 =
+-1 material vertex frame -1
+texture frame = 0.500000 vertex material
+= 0.500000 = 0.500000 = bone
+material bone material
+vertex
+material anim anim = bone 1.0 1.0
+0.500000 1.0 = bone frame
+material material
+0.500000 vertex bone
+0.500000 0.500000
+=
+vertex
+material frame frame vertex -1 1.0 -1 0.500000 anim material = frame
+texture material anim frame 0.500000 texture vertex 1.0 1.0 texture 1.0 vertex material vertex texture = 1.0 vertex 1.0 = -1 frame
+-1 material 0.500000 material 1.0 frame texture anim vertex material 1.0 anim material frame 1.0
+bone 1.0
+anim
+anim material -1
+material
+anim material bone material 0.500000 1.0 anim 1.0 = anim bone = -1 vertex bone
+bone
+anim anim frame bone
+1.0 -1 =
+anim material material
+texture bone frame -1
+1.0
+= texture frame bone texture 0.500000
+texture anim frame material
+material
+texture frame vertex 1.0
+bone =
@@ -0,0 +1,38 @@
+frame
+= anim
+material
+frame texture 0.500000 vertex = = vertex anim 1.0 anim = -1 0.500000
+texture anim material material
+anim 1.0 texture -1 anim -1
+bone texture
+0.500000
+1.0 1.0 = material texture
+material
+1.0 vertex vertex material bone
+bone
+= material = = = 1.0 texture
+0.500000
+anim material frame 0.500000 vertex
+material texture anim
+= material
+-1 frame anim
+vertex
+vertex
+texture vertex 1.0 = material frame bone
+material anim 1.0 0.500000
+vertex 1.0 bone bone frame
+texture -1 texture
+anim
+material texture
+-1 -1 1.0 0.500000 -1 frame anim -1 texture material = material
+-1 0.500000
+material 0.500000 = frame
+1.0 texture frame anim
+0.500000
+0.500000 texture material anim -1 frame texture texture bone texture vertex vertex -1
+vertex frame
+0.500000 material
+anim = 1.0 = anim texture frame
+= 0.500000 -1 frame vertex =
+frame
+1.0 0
\ No newline at end of file
@@ -0,0 +1,11 @@
+-1
+vertex vertex anim 0.500000
+texture = vertex
+0.500000 frame 1.0 = vertex texture anim
+anim =
+-1 bone 1.0 -1 = material texture vertex
+bone vertex 1.0 texture
+1.0
+bone -1 bone bone
+anim vertex
+vertex 0
\ No newline at end of file
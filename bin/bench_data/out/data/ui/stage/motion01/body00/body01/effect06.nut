@@ -0,0 +1,42 @@
+frame
+texture anim texture
+material vertex frame -1 1.0 -1 material anim -1
+frame
+texture
+material 0.500000
+bone -1 -1 1.0
+texture anim frame
+material vertex
+-1 material bone 0.500000 = 0.500000
+texture
+vertex bone anim bone
+0.500000 0.500000
+-1 -1 frame frame vertex
+material frame vertex
+1.0 1.0 -1
+0.500000 bone
+-1 vertex bone 0.500000
+material
+material bone
+anim material
+material
+frame
+1.0 bone frame texture 1.0 -1 anim material = 0.500000 -1 texture = anim anim 1.0
+vertex bone bone
+material -1 vertex
+-1 frame frame
+texture texture material 1.0 frame material anim material frame
+vertex 0.500000 frame material material 1.0
+texture bone 0.500000
+texture frame 0.500000 = frame anim vertex = 0.500000
+1.0 1.0 0.500000 -1 anim bone anim bone 1.0
+= bone 0.500000 bone frame vertex material
+material anim = vertex
+frame =
+vertex 0.500000 vertex = 0.500000 1.0 bone
+material
+texture
+= -1 0.500000 anim anim = 0.500000 = material
+= = vertex =
+= 0.500000
+frame bone vertex frame
\ No newline at end of file
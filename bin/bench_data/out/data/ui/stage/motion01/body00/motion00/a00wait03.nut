@@ -0,0 +1,4 @@
+texture frame
+bone frame bone material material
+material
+b
\ No newline at end of file
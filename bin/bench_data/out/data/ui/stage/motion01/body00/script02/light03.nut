@@ -0,0 +1,21 @@
+bone texture bone texture = bone
+bone
+= frame
+texture material
+frame
+0.500000 = anim -1 0.500000
+vertex frame = -1 -1
+0.500000
+material frame
+1.0 1.0 anim vertex = 0.500000 vertex 1.0
+vertex
+material
+= frame -1 texture vertex 0.500000
+1.0 bone 1.0 material
+bone
+frame
+bone anim 0.500000 vertex 0.500000 1.0 vertex bone 1.0 material 0.500000
+-1
+1.0 -1
+0.500000 bone
+= 1.0 bone frame
\ No newline at end of file
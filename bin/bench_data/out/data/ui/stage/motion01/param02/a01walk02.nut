@@ -0,0 +1,198 @@
+0.500000
+anim material vertex
+frame texture
+material anim anim anim material texture
+= material
+-1 1.0 1.0 1.0 texture texture 1.0 vertex vertex
+bone frame -1
+= frame
+-1 frame texture frame 0.500000 1.0 =
+frame
+material frame material
+0.500000 anim 1.0 -1 0.500000 material bone texture
+frame bone 1.0 vertex texture vertex
+material
+=
+0.500000 texture bone vertex
+anim = frame 1.0
+frame -1 texture = = material vertex 0.500000 anim frame material 1.0
+texture
+=
+0.500000 frame
+vertex bone vertex texture frame = bone
+bone vertex texture
+frame bone =
+anim 1.0 texture 1.0 =
+anim material frame texture bone frame material
+anim 0.500000
+material = material material frame
+0.500000 anim 1.0
+anim
+0.500000 -1 -1 -1 vertex
+-1
+1.0 frame 1.0 0.500000 0.500000
+bone anim texture material material texture 0.500000 = texture
+= frame vertex texture 1.0 -1 texture anim
+1.0
+material anim bone
+frame -1 -1 anim material bone -1 =
+=
+0.500000 material = anim material = =
+-1 material frame material material frame 0.500000 1.0
+= bone vertex
+material material texture
+anim 1.0 frame vertex material 0.500000 -1
+= 1.0 texture anim frame
+bone = bone
+0.500000 texture -1 vertex bone texture bone
+0.500000 = vertex
+frame = material
+anim bone 1.0 0.500000 1.0 vertex 1.0 material
+frame vertex material bone 0.500000 bone vertex 0.500000 -1 frame
+bone texture anim 1.0
+anim anim bone = bone frame 0.500000
+vertex
+-1
+frame frame bone material
+-1 bone texture material material vertex
+vertex frame
+1.0
+bone vertex texture vertex =
+anim
+material
+material
+vertex
+frame frame texture -1 0.500000 frame 0.500000 = frame vertex 1.0
+anim 1.0 texture 1.0 anim bone
+1.0 bone
+texture 1.0 vertex frame material texture
+=
+frame -1 texture 0.500000 0.500000 frame 0.500000
+-1 0.500000 material texture = texture material = texture
+1.0 material -1 =
+0.500000
+= bone 1.0
+anim
+vertex texture 1.0
+= 1.0 frame vertex
+anim vertex 0.500000 0.500000 anim bone material -1 frame -1 = texture
+= anim bone texture
+0.500000 -1 anim vertex texture bone
+texture -1 1.0 = anim bone
+material
+1.0
+frame material bone bone
+vertex anim 1.0 = frame 0.500000 = 0.500000 0.500000 texture anim vertex anim texture 1.0 -1
+0.500000 bone material
+frame
+-1 1.0 -1 frame 1.0 -1
+texture 1.0 -1 = texture
+texture
+material frame -1 anim anim material material frame 0.500000
+frame
+vertex vertex
+-1 0.500000
+1.0 anim 0.500000 = =
+frame material
+anim -1
+texture material -1
+-1 =
+0.500000 anim frame texture frame -1 1.0 -1
+frame anim texture -1
+-1 vertex 0.500000 1.0 frame -1 vertex frame
+0.500000 =
+0.500000 texture
+material 0.500000 vertex 0.500000 0.500000
+anim frame
+1.0 0.500000 0.500000 -1 = vertex 1.0 vertex bone
+texture texture material anim = texture frame 0.500000
+0.500000
+-1 vertex texture -1
+bone
+texture material 1.0
+-1 1.0 = texture anim bone
+material anim
+vertex vertex material bone vertex
+vertex
+vertex vertex anim frame bone 1.0 -1
+texture =
+= bone frame
+-1 -1
+-1 material anim frame
+texture bone 1.0
+1.0 frame texture material vertex 0.500000 0.500000 vertex anim anim = = 1.0
+1.0 -1 1.0
+= frame material material 0.500000 1.0 1.0 frame = material frame vertex 1.0 vertex 0.500000 anim -1 =
+-1 = texture vertex -1
+0.500000 1.0 material
+-1
+1.0 1.0
+-1 anim texture
+1.0 vertex texture = frame vertex vertex vertex texture frame 1.0 -1 frame vertex
+texture material frame 0.500000
+bone 1.0 texture frame anim vertex = 0.500000 0.500000 = anim
+texture -1
+1.0 frame anim
+anim bone 1.0
+vertex texture
+= 1.0
+= 1.0 anim
+vertex
+1.0 frame material
+1.0 frame
+= 0.500000 -1 = anim material 0.500000 0.500000 bone 0.500000 -1 = -1 material
+0.500000 frame
+texture
+bone = vertex 1.0 texture -1
+0.500000 frame
+-1 texture texture 1.0 material frame
+0.500000
+anim 1.0
+0.500000
+material
+texture
+frame texture texture texture
+vertex
+=
+= bone anim 1.0 material frame 1.0 1.0
+frame
+bone vertex anim = anim
+material frame 0.500000 anim 0.500000 material vertex material = bone
+texture anim 1.0 bone 1.0 vertex bone
+anim -1 anim -1 anim vertex bone =
+anim vertex 0.500000
+1.0 texture 1.0 bone frame bone vertex bone -1 1.0 =
+frame material frame vertex frame anim 1.0 0.500000 -1 material
+0.500000 anim
+-1 -1
+texture vertex bone texture texture -1
+vertex 1.0 vertex texture 0.500000 texture texture 0.500000 0.500000 1.0 bone = material material
+texture 1.0
+vertex -1 vertex = 1.0 0.500000 = vertex
+material texture
+1.0 texture
+material 0.500000
+1.0 =
+1.0 0.500000 = texture frame bone 1.0
+-1 frame = 0.500000 material material frame
+anim texture 1.0 texture anim 1.0
+-1 texture 1.0 = =
+1.0 -1 texture frame bone 1.0 material material
+0.500000
+material = material 1.0 anim
+1.0 frame
+-1 = anim bone 0.500000 texture vertex frame
+-1 frame 1.0 1.0 bone = texture 0.500000
+bone material 0.500000 = 0.500000 anim texture frame frame vertex frame texture material frame texture frame
+-1 0.500000 1.0 texture =
+-1 -1 anim 1.0
+frame frame bone
+vertex
+-1
+-1
+0.500000 0.500000 =
+vertex
+frame bone = 0.500000 texture material vertex = 0.500000 1.0
+material
+texture anim
+f
\ No newline at end of file
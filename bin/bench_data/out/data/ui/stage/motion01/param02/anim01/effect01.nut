@@ -0,0 +1,3 @@
+vertex 0.500000 anim frame
+anim material
+vertex 0.50000
\ No newline at end of file
@@ -0,0 +1,25 @@
+frame texture = =
+vertex
+= bone
+bone -1 1.0
+1.0 anim material -1 0.500000
+bone
+frame 1.0 =
+0.500000 1.0 0.500000
+vertex material anim texture vertex
+= vertex material
+anim = -1 1.0 -1 frame material bone
+bone 0.500000 0.500000 texture = vertex 0.500000 texture
+0.500000 0.500000 =
+material
+1.0
+= -1 texture -1 bone
+= vertex
+material bone anim -1
+0.500000
+material = 1.0 material -1
+anim
+-1 1.0 = 0.500000
+anim texture vertex
+texture frame vertex vertex material
+-1 1.0 0.50
\ No newline at end of file
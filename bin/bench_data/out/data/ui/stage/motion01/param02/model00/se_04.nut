@@ -0,0 +1,12 @@
+0.500000 -1
+texture material anim = bone
+vertex
+frame frame vertex frame = = -1 material bone -1 =
+0.500000
+vertex
+material frame
+= texture frame
+1.0 -1 -1 texture frame anim anim vertex vertex vertex
+anim
+-1 -1 texture bone vertex 1.0 material 0.500000 vertex frame texture bone frame
+bone = vertex -1 frame = ver
\ No newline at end of file
@@ -0,0 +1,68 @@
+bone texture
+frame
+0.500000 1.0
+0.500000 frame 0.500000 anim
+bone 1.0 bone
+=
+frame = texture 0.500000 material
+texture 0.500000 texture
+0.500000 bone texture bone
+0.500000 texture texture = anim
+texture texture texture vertex vertex frame
+frame =
+material -1 0.500000 -1 texture texture material texture frame frame bone = = = texture = vertex bone material vertex vertex
+= vertex
+texture 1.0 bone material anim vertex bone 1.0 anim
+material texture -1 texture material -1 material
+0.500000 material
+0.500000
+anim bone vertex = anim
+vertex = bone 1.0 frame anim texture 0.500000 frame
+bone texture frame
+bone 0.500000 0.500000 frame
+-1 -1
+anim 0.500000
+vertex anim
+anim 0.500000 frame = 1.0 vertex = vertex = 1.0 texture frame = =
+bone 0.500000
+material 1.0 0.500000
+frame 1.0 frame
+vertex
+material
+1.0 frame
+bone texture vertex frame -1 texture
+frame texture
+texture texture material texture 0.500000
+-1 vertex
+texture
+-1 vertex -1 1.0 = = frame 1.0 vertex material =
+-1 -1 0.500000 vertex = = frame
+vertex texture bone anim material vertex 1.0 -1 0.500000 frame 1.0 anim frame material texture texture texture
+bone 1.0
+frame 0.500000 0.500000 -1 = material -1
+anim material material 1.0 material 0.500000 1.0 = texture -1 vertex material
+0.500000 frame vertex 0.500000 material 1.0
+vertex texture
+1.0 anim -1 material vertex material texture frame bone 1.0 bone 0.500000 frame frame 0.500000 bone
+0.500000 bone vertex 1.0 1.0 anim
+1.0 =
+1.0 anim 0.500000 anim bone frame = -1
+texture texture -1
+1.0 0.500000 1.0 material -1 -1
+0.500000 frame
+= material frame vertex bone material frame material frame texture -1 -1 = frame bone 1.0
+bone bone 0.500000 bone anim anim
+= 0.500000 -1 = frame
+-1 texture frame 0.500000
+-1 anim
+texture
+anim vertex frame =
+frame
+1.0 1.0 texture anim bone vertex -1 vertex anim -1
+-1 -1 = bone texture
+0.500000 = material
+material
+-1 anim material
+anim vertex 0.500000
+material 0.500000 material -1 vertex vertex
+1.0 material = frame 1.0 vertex 0.500000 0.500000 texture 
\ No newline at end of file
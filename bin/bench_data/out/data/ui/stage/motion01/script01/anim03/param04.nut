@@ -0,0 +1,4 @@
+frame
+bone bone 1.0 material vertex material frame anim anim 1.0 1.0 frame
+vertex texture
+texture = 1.0 text
\ No newline at end of file
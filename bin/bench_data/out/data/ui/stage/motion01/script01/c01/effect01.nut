@@ -0,0 +1,7 @@
+= anim = bone 1.0
+0.500000
+1.0
+frame = 1.0 0.500000 bone vertex
+anim 0.500000
+frame
+-1 material
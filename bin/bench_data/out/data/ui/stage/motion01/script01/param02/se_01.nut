@@ -0,0 +1,5 @@
+-1 frame frame material
+1.0 =
+texture
+-1 = anim 0.500000 frame =
+= 0.500000 texture
\ No newline at end of file
@@ -0,0 +1,2 @@
+bone material anim -1
+frame texture frame bo
\ No newline at end of file
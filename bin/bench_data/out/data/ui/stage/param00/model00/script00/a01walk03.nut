@@ -0,0 +1,201 @@
+1.0 texture 0.500000 anim
+material 1.0 -1 texture
+material
+-1 texture frame
+0.500000 texture
+texture 1.0 bone frame = frame
+frame
+anim 0.500000 frame 1.0 -1 frame -1
+texture
+vertex -1 material = 1.0 frame
+=
+anim frame material bone = 0.500000 =
+= texture 0.500000 = 1.0 texture material frame texture
+frame bone anim =
+= 1.0 0.500000 texture
+texture 0.500000 bone anim frame 1.0 material 1.0 -1 bone = = =
+texture
+frame frame anim material vertex
+-1 = 0.500000 0.500000 bone frame 1.0 1.0 frame
+anim
+texture
+bone vertex
+1.0 = -1 frame material
+anim
+-1 frame vertex 0.500000 0.500000 material frame frame 0.500000 = vertex texture bone
+material vertex bone anim texture 0.500000 1.0
+= material vertex bone material = bone frame vertex anim = vertex =
+bone 1.0 vertex = -1 texture 1.0 anim 1.0 frame -1 -1 1.0 bone
+material = material
+texture bone material frame -1
+frame 0.500000 texture
+texture -1 material
+texture texture bone 1.0 = bone bone bone
+frame texture
+0.500000
+-1 0.500000
+texture 0.500000 anim material vertex 0.500000 frame
+material texture texture
+= 1.0 0.500000 material 0.500000 texture 1.0 1.0
+0.500000 texture 1.0 material bone anim
+= vertex 0.500000
+texture -1 bone vertex vertex 0.500000 -1 vertex 1.0 material bone bone
+= =
+material 0.500000 = anim
+1.0
+0.500000
+texture = material frame 1.0 1.0 -1 -1 = material 0.500000 0.500000
+= vertex
+-1
+= -1
+vertex 0.500000 1.0 material -1 bone anim
+bone bone anim 1.0
+frame = vertex = -1 texture
+vertex anim bone vertex bone = vertex frame 1.0
+material frame texture vertex texture -1
+1.0 texture
+-1 -1
+0.500000 texture frame 0.500000 -1 frame 0.500000 bone vertex 1.0 -1
+frame vertex
+-1 vertex bone anim 0.500000
+bone texture =
+material vertex
+texture frame anim frame
+bone texture material
+anim material texture
+material
+=
+material 0.500000 0.500000
+-1
+1.0 -1 1.0 -1
+vertex
+frame
+material vertex texture frame texture
+-1 1.0
+anim vertex = frame frame = 1.0 anim
+vertex material -1 texture
+bone 0.500000 texture 0.500000
+1.0 0.500000 texture 0.500000
+frame
+0.500000 frame material 0.500000 vertex -1 = 0.500000 1.0 material material texture 0.500000
+= material
+0.500000 texture vertex
+anim 1.0 anim bone frame
+bone
+frame 1.0 bone =
+-1
+texture texture material -1 frame = 1.0 = anim 1.0 frame
+material
+texture texture 0.500000 material
+= material 0.500000 0.500000 material
+1.0 -1
+material 1.0
+vertex material 1.0 vertex
+bone texture vertex material -1 -1 frame bone vertex anim frame
+vertex texture
+-1
+texture texture = vertex material anim vertex
+material 0.500000
+vertex 1.0 -1 bone material = frame =
+=
+= 0.500000
+texture -1 frame frame = texture anim anim material -1
+=
+bone
+anim
+anim vertex 0.500000 1.0
+bone material bone anim = material
+= texture texture material -1
+anim -1 -1 1.0 bone =
+0.500000 = vertex
+-1
+material vertex vertex 1.0 texture -1 0.500000 texture material
+frame 0.500000 vertex -1 frame material material texture bone
+texture
+anim 1.0 1.0
+-1 = frame bone material material 0.500000
+bone anim
+= texture material 1.0 anim vertex texture anim
+1.0 anim -1 -1 = anim texture 1.0 0.500000 -1
+frame anim 1.0 = = frame bone anim = anim
+vertex = -1
+texture bone 0.500000
+frame -1 = anim bone
+= material 1.0 =
+texture -1 anim bone frame
+anim bone 1.0 = 1.0 -1 0.500000 texture material 0.500000 anim anim = frame
+=
+vertex material -1 texture vertex anim vertex vertex =
+= 0.500000 = 0.500000 material -1 bone = texture
+material = material
+0.500000 texture 0.500000 anim bone bone
+vertex 1.0 texture 0.500000 frame texture vertex = 0.500000 vertex 0.500000 1.0 0.500000 -1 frame bone bone material
+bone texture anim -1 frame = bone
+anim vertex frame texture
+1.0
+vertex -1 material bone
+texture
+anim 0.500000 1.0 0.500000
+vertex = 1.0
+texture vertex -1 0.500000 1.0 texture vertex 0.500000
+frame
+vertex
+anim anim 1.0 vertex 1.0
+anim vertex vertex -1 1.0 material
+vertex material = anim texture texture material vertex 0.500000 bone
+anim texture bone anim anim
+0.500000 texture
+1.0
+bone
+anim 1.0 frame
+vertex
+frame bone bone
+bone frame = frame
+bone vertex =
+material
+1.0 vertex
+-1 = anim 1.0
+1.0
+material 0.500000 -1 -1
+=
+texture vertex -1 texture bone
+frame texture texture 0.500000 anim 1.0 1.0
+anim
+0.500000 frame bone 0.500000 bone frame 0.500000
+material -1
+material
+frame
+1.0 texture 1.0 bone bone anim -1
+-1
+bone material bone material = bone
+material 0.500000 material bone bone -1
+frame
+anim material 0.500000 anim frame material 0.500000 material
+0.500000
+1.0 bone vertex material frame 1.0 anim vertex anim
+-1
+texture material texture texture anim vertex
+= anim
+0.500000
+material
+= texture vertex vertex vertex -1
+material = 1.0 bone
+anim
+0.500000
+1.0 0.500000 vertex 1.0 0.500000 =
+texture anim texture -1
+material bone -1
+1.0 -1
+frame -1 vertex bone anim texture
+1.0 vertex 0.500000 1.0 anim = vertex vertex material
+frame -1 1.0 -1 0.500000 1.0
+vertex anim
+anim
+frame -1 0.500000
+bone
+0.500000
+frame bone -1 1.0 texture bone anim bone material material -1 1.0 material 1.0
+-1 = = anim =
+anim material 1.0 vertex
+vertex material -1 1.0
+0.500000 texture fr
\ No newline at end of file
@@ -0,0 +1,3 @@
+frame 0.500000 -1 anim -1 1.0 bone material anim bone anim frame
+1.0
+-1 anim anim material textur
\ No newline at end of file
@@ -0,0 +1,205 @@
+material vertex
+frame 0.500000 1.0 -1
+frame
+texture
+anim
+bone
+texture = -1
+= 0.500000
+bone 0.500000 -1
+1.0 -1
+texture material -1 material bone 1.0 -1
+1.0 1.0 bone
+anim 0.500000
+-1
+texture 1.0 anim =
+bone frame =
+1.0 bone material anim
+0.500000 -1 bone texture
+1.0 vertex material bone vertex -1 texture anim 1.0
+1.0
+bone anim bone vertex anim vertex material vertex -1 =
+texture -1 -1 texture bone
+bone frame -1
+anim
+frame material frame 1.0 material -1 -1 texture
+1.0 1.0 texture 1.0
+texture 1.0 bone
+texture
+frame
+texture 0.500000 bone 1.0 0.500000 material frame
+-1
+frame bone material material 1.0 anim
+vertex vertex =
+1.0 material frame
+0.500000 anim texture 0.500000 -1 -1 -1 frame texture
+texture
+material vertex
+-1 frame texture bone material anim frame
+1.0 0.500000
+0.500000
+material -1 1.0 anim 1.0
+anim vertex vertex = texture material
+bone
+anim -1 0.500000 bone anim material texture = frame frame material vertex 0.500000
+anim material material = bone texture bone bone
+1.0
+vertex = frame vertex
+frame
+anim = bone 0.500000 -1 -1
+0.500000 anim texture frame -1 texture texture
+0.500000 1.0 texture 0.500000
+frame
+0.500000 material 1.0 anim
+-1 = 1.0
+anim bone 1.0 0.500000 0.500000 bone material 1.0 anim 1.0 0.500000 0.500000 vertex 1.0 frame 0.500000
+material
+= texture vertex 1.0 texture
+material frame = anim bone texture = anim 1.0 frame
+= material vertex
+= 1.0
+vertex
+anim = frame
+anim material texture texture
+frame material 1.0 vertex -1 vertex = 1.0 =
+vertex vertex anim bone anim = 0.500000
+anim
+frame 1.0 frame
+frame frame
+0.500000
+1.0 vertex
+vertex anim 1.0
+bone
+texture material texture
+0.500000 vertex = anim
+-1 vertex = = texture 0.500000 1.0 0.500000 = = vertex -1 1.0 material material material frame
+anim frame bone 1.0 anim vertex anim vertex -1 1.0 -1 bone 0.500000 0.500000 -1
+-1 0.500000 1.0 texture vertex frame 0.500000 bone bone
+texture 0.500000 -1
+vertex
+0.500000 1.0 -1 0.500000 -1
+material frame material = bone material
+material anim frame material 1.0 bone vertex material vertex frame
+bone frame
+vertex anim =
+texture 1.0 anim
+material =
+=
+bone texture
+texture material anim -1 material 0.500000 material vertex bone
+vertex bone bone 1.0 texture material
+= 0.500000 -1 bone -1 0.500000 1.0 1.0
+bone anim = frame frame
+0.500000 texture material
+bone
+1.0 1.0
+anim bone anim vertex vertex material vertex
+frame vertex 0.500000 frame 0.500000 texture anim frame = 0.500000 texture frame 1.0 vertex texture
+material 0.500000 =
+anim texture
+material
+= 0.500000 frame anim 0.500000 = frame texture
+material 1.0 anim -1 vertex
+frame frame = vertex
+= -1
+anim -1
+0.500000 frame frame = =
+texture frame frame 1.0
+= frame texture anim material
+anim
+bone material
+-1 texture bone
+= vertex anim bone 0.500000
+vertex bone 0.500000 -1 -1 texture bone -1 -1 -1 bone anim frame
+0.500000 material 1.0 texture vertex vertex 1.0 frame bone texture vertex vertex vertex texture frame material material texture frame 1.0
+anim material -1 bone vertex
+texture = =
+texture -1
+material = -1
+=
+bone texture vertex 1.0 anim vertex
+-1 = 1.0 frame
+= frame anim frame
+material vertex texture bone anim
+0.500000 = vertex bone 0.500000 bone
+texture = 0.500000 material 1.0
+1.0
+frame texture
+frame
+bone
+0.500000 frame texture texture frame
+texture
+vertex frame texture vertex
+-1
+vertex anim 1.0
+1.0 -1
+anim bone material
+texture frame
+bone 1.0 bone 0.500000
+texture vertex -1 -1 frame bone 1.0 texture 0.500000 = texture 1.0 anim -1 material vertex =
+=
+vertex
+vertex texture 1.0 -1 -1 1.0 -1 vertex 0.500000 vertex 1.0 frame material vertex = frame -1 0.500000
+vertex -1 anim texture -1
+frame bone 1.0 1.0 -1 -1 = anim frame
+0.500000 material texture -1
+material
+anim frame 0.500000
+-1 anim
+bone frame anim
+0.500000
+bone material -1 material bone = -1
+= 1.0 vertex
+vertex
+bone texture = anim = 0.500000 = -1 bone 1.0
+0.500000 0.500000 frame vertex -1
+vertex vertex anim
+material bone
+1.0 material -1 -1
+= vertex anim
+material material
+bone material 0.500000 frame =
+1.0 -1 -1 frame 1.0 bone frame frame texture 1.0 1.0 material bone 0.500000 = -1 vertex = = bone = material bone 0.500000
+0.500000 1.0 material 1.0 = anim frame = -1 material 0.500000 -1 frame
+bone
+1.0 vertex
+vertex frame texture bone -1
+-1 frame bone
+= anim
+bone
+frame
+frame = texture frame
+texture 0.500000 =
+1.0 1.0 vertex anim 1.0
+frame
+= anim
+1.0 vertex frame anim texture
+1.0
+material
+vertex frame 0.500000 vertex
+1.0
+-1 1.0 anim 1.0
+material frame bone -1 = 1.0
+1.0 anim vertex
+bone anim material 1.0 0.500000
+1.0 vertex
+0.500000 -1 anim =
+=
+bone
+material frame frame = frame frame
+texture bone
+-1 1.0 material =
+frame
+bone material
+0.500000 bone
+-1 texture anim bone
+0.500000 bone 1.0 = 1.0 material = -1 bone 1.0
+vertex bone 0.500000 frame material texture
+material 1.0 material bone 1.0 1.0
+=
+bone 1.0 1.0 vertex
+texture
+frame 1.0 anim
+1.0 -1 1.0 = anim
+texture vertex 0.500000 anim 0.500000 texture = 0.500000 frame
+frame tex
\ No newline at end of file
@@ -0,0 +1,8 @@
+anim 1.0 0.500000
+0.500000 anim vertex vertex -1 vertex
+= texture
+= 0.500000 1.0
+texture 0.500000 1.0
+-1 = bone -1 frame bone 0.500000 -1 frame -1 material
+bone
+-1 1.0 material frame bone anim vertex = bone texture 1.0 texture 0.500000 0.50
\ No newline at end of file
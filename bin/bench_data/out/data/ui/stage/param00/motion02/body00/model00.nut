@@ -0,0 +1,188 @@
+texture
+frame 1.0 frame = texture = = 0.500000 = 1.0 material -1 -1 anim -1 bone anim -1 vertex -1 0.500000
+material = frame
+texture =
+bone -1 -1 material -1 anim 0.500000 vertex
+frame anim = bone anim vertex vertex = frame anim
+texture anim 1.0 = bone material
+1.0
+vertex 1.0 = anim
+frame anim
+0.500000
+-1
+bone 0.500000 0.500000 = anim
+bone -1
+bone material vertex
+vertex
+1.0 bone anim -1 1.0 material =
+frame anim anim 0.500000 texture
+=
+=
+vertex
+=
+1.0 texture =
+0.500000 bone 1.0 0.500000 1.0 =
+-1 vertex frame = frame =
+texture anim
+1.0 0.500000 anim 1.0 -1 -1 material material -1 -1 vertex
+bone
+bone anim
+frame frame 1.0 material material texture bone
+1.0 vertex 0.500000 anim = -1
+texture
+vertex
+texture material texture -1 material -1 anim
+anim 0.500000
+texture
+-1 -1 1.0 1.0 texture bone
+=
+= texture bone 0.500000 material material bone 1.0 anim = frame 0.500000 -1
+=
+1.0
+0.500000
+material -1 texture
+frame material bone = vertex 0.500000 texture 0.500000
+-1
+anim -1 -1
+vertex
+texture frame
+texture -1 0.500000
+=
+0.500000 1.0 bone
+texture bone 1.0 0.500000 texture
+0.500000 texture
+vertex vertex frame 1.0
+= bone texture vertex texture 0.500000
+= -1 -1 0.500000
+frame 1.0 frame bone texture 1.0
+1.0 = = frame bone bone -1 frame -1 vertex frame bone
+vertex frame = bone texture bone texture frame
+frame 0.500000 1.0 anim
+0.500000
+texture vertex texture = material bone -1
+vertex frame anim = anim
+material texture
+= anim
+bone 1.0 1.0 bone vertex frame texture bone material vertex anim
+vertex
+vertex material
+1.0 bone -1
+texture 1.0 texture
+vertex 0.500000
+anim vertex -1 bone vertex frame 0.500000 vertex = 0.500000 = vertex frame anim -1
+vertex material texture 1.0 vertex -1 1.0 anim -1 texture anim
+material
+material 1.0 frame
+material -1 frame 1.0 texture
+texture vertex 1.0 frame texture -1 anim 1.0 bone 1.0 texture
+= 0.500000 texture
+0.500000 texture material texture material -1 0.500000
+bone material =
+1.0 anim
+anim 1.0
+-1
+anim
+material texture 1.0
+=
+= anim 0.500000 anim
+bone
+anim material
+frame texture bone material 0.500000 0.500000 material
+bone = material material
+texture
+0.500000
+0.500000
+frame anim anim vertex anim 0.500000
+bone vertex = frame -1 frame anim vertex 1.0
+bone vertex 0.500000 material bone
+1.0 -1 0.500000 -1 vertex material texture 1.0 texture 0.500000 texture = -1 1.0 0.500000 material =
+vertex frame anim
+material bone frame texture 0.500000 texture =
+bone 1.0
+vertex frame
+bone
+= texture bone anim texture frame bone texture -1 material anim bone
+anim 0.500000 anim material
+material
+1.0
+vertex vertex 0.500000
+anim
+0.500000 texture vertex
+0.500000 -1 texture
+texture = anim material
+1.0 -1 =
+material
+texture
+anim frame 1.0 texture
+material -1 bone =
+-1
+vertex
+vertex
+1.0
+frame bone
+texture material 0.500000 0.500000
+bone
+material bone frame
+anim =
+bone frame texture
+-1 texture = frame 1.0
+-1 vertex -1 anim =
+bone vertex
+1.0 1.0
+bone vertex 1.0
+bone material frame bone -1 bone bone
+anim frame
+1.0 texture bone 1.0 texture
+vertex bone material material
+anim = = bone
+frame vertex
+material = 1.0 bone frame material vertex
+texture 1.0 anim 1.0
+vertex
+material
+material bone texture
+anim 0.500000 -1 texture
+= anim material 0.500000 1.0 = = frame
+bone =
+material 1.0 vertex
+bone material
+bone texture -1
+anim
+=
+= vertex
+=
+0.500000 frame
+anim 1.0 bone
+vertex
+1.0 -1 material anim -1
+1.0 1.0 material -1
+1.0
+vertex
+0.500000 1.0 anim =
+1.0 material
+texture
+anim material = 1.0 0.500000
+-1 frame texture
+anim = vertex -1 texture 0.500000 vertex -1 material 1.0 1.0
+texture 1.0 -1
+frame
+1.0 bone 1.0 anim
+-1 material 0.500000 -1 texture 0.500000
+0.500000 = texture texture
+vertex
+material vertex
+vertex bone material -1
+= -1 0.500000 texture bone material frame bone frame frame frame -1 anim
+1.0 vertex material 0.500000 frame
+vertex
+1.0 vertex 0.500000 vertex texture
+1.0 frame -1
+texture -1
+vertex
+0.500000 1.0 = vertex 0.500000
+-1 1.0 =
+bone 1.0
+1.0 1.0 material bone 1.0 1.0 texture bone bone 0.500000 = = bone -1 0.500000 vertex =
+bone -1 -1
+texture 0.500000
+vertex material vertex 1.
\ No newline at end of file
@@ -0,0 +1,32 @@
+1.0 = -1 -1 material anim
+vertex = bone
+material 0.500000
+-1 texture anim 0.500000 vertex
+anim frame
+=
+anim material
+frame vertex
+anim 0.500000 material
+texture material -1
+-1
+0.500000 1.0 -1 1.0 -1 = 0.500000 texture bone texture = frame 1.0 1.0
+material 0.500000
+material vertex bone material =
+vertex frame
+0.500000 -1 bone 0.500000 anim material 1.0 bone vertex 1.0 vertex 1.0 0.500000 anim 0.500000
+texture = vertex bone -1
+texture
+1.0 frame texture anim
+bone 1.0 0.500000
+1.0 anim material texture material
+0.500000 texture texture frame vertex 0.500000 -1 frame 1.0 bone
+1.0
+1.0 vertex frame
+material texture
+bone
+material anim -1 = texture vertex
+0.500000 texture vertex -1 =
+material
+1.0 -1 -1 1.0
+frame bone vertex bone vertex 1.0 material
+frame anim 
\ No newline at end of file
@@ -0,0 +1,6 @@
+= 1.0
+bone anim = bone
+vertex vertex 0.500000
+vertex material anim
+material
+frame 0.500000 ani
\ No newline at end of file
@@ -0,0 +1,79 @@
+=
+material
+vertex frame 0.500000 bone
+vertex = texture texture 0.500000 -1
+frame anim
+-1 0.500000 texture material bone -1 = 1.0 frame bone
+texture 1.0 -1 frame anim -1
+frame
+bone
+0.500000 1.0 vertex
+1.0 1.0 vertex bone material
+material bone
+vertex vertex texture
+1.0 = 0.500000 frame anim bone texture
+anim vertex
+material
+frame -1
+bone 0.500000 material material anim
+1.0 anim texture bone
+0.500000
+texture frame
+0.500000 -1 vertex
+vertex
+bone -1 frame bone texture
+0.500000 bone bone texture
+texture frame frame frame anim frame 0.500000 vertex frame material
+anim =
+vertex 1.0
+0.500000
+bone anim 0.500000 1.0 bone = material texture anim -1 texture
+= texture texture anim vertex vertex texture 1.0 -1 anim 1.0 -1
+-1
+0.500000 -1
+texture texture vertex = bone bone =
+texture
+material
+vertex =
+material anim bone anim bone material frame -1 texture vertex
+vertex material = material material material vertex vertex
+=
+anim vertex 1.0 texture = vertex 1.0 vertex
+0.500000
+0.500000
+1.0 texture -1 -1
+-1
+vertex 1.0 = frame material bone material anim material
+bone 0.500000 material =
+texture 0.500000 frame material bone -1 texture anim 1.0
+anim
+0.500000 -1 frame frame
+= = vertex
+bone bone 1.0 texture = material material texture texture -1 1.0
+anim texture texture frame -1 vertex anim 1.0 -1 -1 vertex
+= 1.0 0.500000 texture bone 1.0 material 0.500000
+1.0 anim = 0.500000 0.500000 texture frame texture -1 = 1.0 texture
+anim material
+-1 material
+frame anim
+1.0 = 1.0 1.0 frame frame
+bone vertex
+frame
+texture 0.500000 texture texture 0.500000 vertex
+texture 0.500000
+texture anim material -1 vertex frame
+= frame
+anim -1 vertex 1.0 texture
+-1 -1 frame
+vertex bone =
+-1 frame vertex
+texture 0.500000 frame
+= frame bone
+0.500000 vertex bone 1.0 0.500000 frame anim
+texture frame 0.500000 0.500000 bone -1 =
+1.0 vertex
+1.0
+texture bone material anim 1.0 vertex anim 0.500000 0.500000 -1 frame vertex texture texture -1 -1 anim
+texture
+1.0 material -1
+0.500000 frame bone
\ No newline at end of file
@@ -0,0 +1,15 @@
+0.500000 texture
+material
+material bone bone bone
+vertex frame
+texture
+anim anim material
+1.0 texture
+anim =
+-1
+vertex
+-1 frame
+frame 1.0 frame vertex
+-1 =
+1.0
+anim 1.0 vertex = anim bone tex
\ No newline at end of file
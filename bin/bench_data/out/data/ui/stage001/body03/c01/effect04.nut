@@ -0,0 +1 @@
+\O0ԂY,qIwģ)]^\.`mXVҚOiu~;T܄qGE8ȃdʍRVzaψ,J%fN\A	ƟmL
\ No newline at end of file
@@ -0,0 +1,4 @@
+1.0 bone texture vertex 0.500000
+-1 = vertex
+anim material 0.500000 -1 -1 frame frame texture
+mater
\ No newline at end of file
@@ -0,0 +1,5 @@
+frame vertex 1.0 =
+material material 1.0
+-1
+vertex
+anim 0.500000 frame 
\ No newline at end of file
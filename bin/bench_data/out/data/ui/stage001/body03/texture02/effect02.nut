@@ -0,0 +1,15 @@
+0.500000
+-1
+-1
+frame -1
+bone
+= bone material texture anim anim 0.500000 texture anim bone vertex texture
+1.0
+vertex 0.500000
+bone 0.500000 0.500000
+frame frame = frame frame vertex
+0.500000
+material
+material frame =
+anim 0.500000 vertex -1 frame frame
+1.0 1.
\ No newline at end of file
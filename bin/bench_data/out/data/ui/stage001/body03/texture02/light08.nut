@@ -0,0 +1,42 @@
+-1 -1 frame -1
+vertex
+= material
+bone texture = = 0.500000 frame 0.500000
+0.500000 vertex material texture -1 frame 0.500000 vertex material material 0.500000 0.500000 vertex frame vertex anim texture anim anim texture 1.0 0.500000 anim anim
+frame
+0.500000 0.500000 = bone 1.0 texture
+-1 0.500000 anim -1 1.0
+vertex material = texture vertex material frame
+= = =
+frame
+1.0 vertex
+texture = frame frame = material = frame 1.0 1.0 =
+material 1.0 bone
+-1 1.0 texture
+material texture frame anim frame texture = 1.0 texture anim
+anim -1
+anim vertex 1.0 -1
+=
+anim = material material 0.500000 material 0.500000 1.0
+-1 frame -1
+vertex texture vertex = 1.0
+=
+1.0
+material bone texture bone texture
+0.500000 vertex
+material material = 0.500000 =
+bone -1 1.0
+material bone 1.0 -1 = bone = vertex
+texture 0.500000 -1 texture
+anim texture -1 anim
+=
+anim vertex
+frame -1
+1.0 frame = = 1.0
+1.0 vertex material 0.500000
+frame vertex texture = material frame
+-1 anim 1.0 vertex
+0.500000 frame
+1.0 texture
+-1 =
+tex
\ No newline at end of file
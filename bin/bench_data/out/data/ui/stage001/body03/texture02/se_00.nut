@@ -0,0 +1,59 @@
+frame 0.500000 =
+anim frame -1 -1 texture bone anim
+texture 1.0
+vertex bone -1 vertex bone 1.0 1.0 bone
+vertex frame = -1 anim
+1.0 texture bone material
+material 1.0
+texture material
+= 0.500000 vertex vertex 0.500000
+material anim 1.0 vertex material frame vertex texture
+bone bone
+= anim bone
+=
+frame texture vertex anim 0.500000 vertex anim frame texture vertex
+bone
+-1 material =
+frame 1.0 = anim frame 1.0 1.0 = anim = anim bone
+frame frame 1.0 bone vertex texture 0.500000 0.500000 bone vertex
+material material vertex
+1.0 -1 0.500000 1.0 1.0
+frame
+-1 0.500000 0.500000 bone
+frame frame -1 -1 = 1.0
+frame
+0.500000 -1 frame vertex frame -1 0.500000 -1 material 0.500000
+-1
+anim frame
+1.0 bone
+anim =
+material -1 =
+texture
+anim vertex bone bone bone material frame anim 0.500000 bone
+material 0.500000 material
+1.0 vertex vertex 1.0 bone texture anim
+= frame texture texture
+texture 1.0 bone
+=
+material -1 =
+bone material
+-1 material -1 -1 texture
+material
+frame 1.0 -1
+bone material frame
+texture 0.500000 1.0 anim 0.500000 bone 0.500000 0.500000 bone
+material 0.500000 1.0
+material = vertex
+vertex
+bone vertex vertex material
+anim
+-1 material frame
+-1 1.0 bone -1 material frame 0.500000 vertex texture anim frame
+=
+1.0
+bone -1 -1 frame 0.500000 bone
+1.0 1.0 anim 0.500000 frame vertex frame
+vertex -1 bone material anim
+0.500000 vertex
+frame bone
+bone 1.0 anim anim bone texture bone 
\ No newline at end of file
@@ -0,0 +1,9 @@
+material = texture frame bone frame 0.500000 -1 -1 vertex vertex
+vertex frame vertex frame anim
+= -1 = bone
+0.500000 bone
+=
+0.500000 anim frame bone
+vertex frame
+material =
+bone bon
\ No newline at end of file
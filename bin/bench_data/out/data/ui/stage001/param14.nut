@@ -0,0 +1,2 @@
+0.500000 0.500000 material frame material material 1.0 -1 anim texture frame bone anim
+bone vertex 1.0 vertex anim 0.50
\ No newline at end of file
@@ -0,0 +1,229 @@
+anim
+texture bone material -1 material 1.0
+1.0 texture anim material frame 0.500000 0.500000 1.0
+-1 bone vertex 1.0 0.500000
+anim material frame texture
+-1
+-1 material
+material -1 -1 1.0 material vertex anim frame
+material bone 0.500000 texture
+= -1 frame material frame anim 1.0
+1.0
+vertex anim bone texture material
+frame
+texture anim anim vertex 1.0 texture vertex
+anim texture
+0.500000
+vertex = frame texture frame -1 material
+anim bone material -1 1.0 1.0 anim material
+1.0 anim texture -1 vertex frame 0.500000
+anim vertex
+anim
+frame material
+-1
+frame texture -1 =
+vertex = texture anim material 1.0
+frame frame material -1 bone anim texture -1
+0.500000 vertex material vertex
+texture -1 -1
+material
+= -1 texture -1 texture
+-1 -1
+bone 0.500000 vertex -1
+-1 -1
+texture material = 1.0 texture
+frame -1 texture -1
+texture frame
+texture frame texture material anim
+anim
+bone material
+bone bone frame
+frame material
+-1 0.500000 -1 0.500000 1.0
+anim
+frame 0.500000
+anim
+= anim = material material bone vertex -1
+material -1 frame 0.500000 0.500000 anim vertex
+1.0
+vertex
+material
+frame material bone
+frame frame = = 0.500000
+bone texture material -1 anim anim
+anim -1 0.500000 frame vertex
+=
+vertex material vertex bone
+vertex bone
+bone texture 0.500000 0.500000 = =
+1.0 vertex bone -1 -1 0.500000 texture 1.0 -1 = vertex bone
+0.500000 anim
+anim
+= texture frame =
+vertex frame anim vertex
+1.0
+1.0
+material vertex -1 texture 0.500000 = -1 0.500000 vertex = anim bone
+anim 1.0 =
+vertex bone frame
+frame material texture
+-1 anim texture material
+=
+1.0 anim
+anim
+texture
+0.500000 material material anim material 0.500000 texture frame 1.0
+0.500000
+frame
+vertex
+anim 0.500000 =
+-1
+vertex frame = material
+1.0
+= material anim 1.0
+material
+-1 -1 -1
+vertex 0.500000 -1 material
+material vertex 0.500000 anim -1 1.0
+texture 1.0 =
+frame frame 0.500000 bone
+-1
+material vertex material
+-1
+anim 0.500000 vertex
+anim bone texture frame 1.0 anim 0.500000 texture
+anim
+anim
+0.500000 frame anim 0.500000 bone
+anim frame texture vertex material
+-1
+texture
+= bone
+1.0 0.500000
+bone
+-1
+anim vertex
+= 0.500000 material vertex
+material frame
+anim 0.500000
+texture anim -1 frame
+material = material -1 vertex vertex texture bone frame texture bone 0.500000 -1
+-1 0.500000 material
+bone 0.500000 material
+vertex
+vertex anim texture
+1.0 vertex = -1 frame -1 anim anim
+frame texture
+1.0 frame material 1.0 bone anim -1 frame = texture bone -1 0.500000 0.500000
+-1 anim anim texture 0.500000 anim material
+frame -1 vertex
+1.0 -1 anim
+= anim frame vertex material frame texture 0.500000 1.0
+material 1.0 frame 1.0
+texture
+1.0 = vertex vertex
+material vertex 1.0 0.500000
+vertex = anim texture frame anim
+texture frame texture anim bone =
+0.500000
+frame
+= -1 texture anim bone material 1.0 -1 1.0
+texture -1 frame
+= anim material 1.0 material material 0.500000 anim vertex 1.0 frame texture
+0.500000 bone -1
+vertex anim -1 material
+anim 0.500000
+=
+vertex 0.500000 anim vertex anim 0.500000 texture = material texture
+material anim
+= vertex vertex 0.500000
+anim
+texture 1.0 bone bone 1.0 texture 1.0
+0.500000 anim texture = -1 material texture = frame texture vertex 0.500000 material material material texture anim
+0.500000 vertex bone -1 vertex -1 frame
+bone 1.0
+-1 vertex frame
+bone texture material vertex 1.0
+-1 -1
+material vertex =
+= anim 0.500000 = 1.0
+0.500000
+frame
+texture = vertex vertex -1
+frame
+-1 anim = material frame bone
+vertex bone texture material
+=
+vertex 1.0
+bone
+vertex
+-1 bone
+material
+material 1.0 material texture vertex frame anim
+bone anim
+anim anim
+texture material vertex frame material anim
+texture
+texture material material
+material
+-1 anim frame
+texture frame 0.500000 vertex material
+0.500000
+bone texture texture
+1.0
+texture texture -1 bone 1.0 anim material
+0.500000 bone
+anim
+anim
+bone vertex
+1.0 anim =
+texture = 1.0 material
+1.0 texture anim
+vertex
+anim 1.0 material -1 material texture texture material bone = bone 1.0 texture material material material
+bone frame texture -1
+=
+1.0 frame 0.500000 material bone 0.500000 -1 vertex frame
+material -1
+frame
+material frame anim 0.500000 1.0
+anim vertex texture
+vertex anim
+1.0
+1.0 material
+-1 1.0 material 1.0 frame
+texture -1 1.0 bone 1.0
+texture 0.500000 frame anim vertex
+= material bone = -1 = material texture 1.0
+material 1.0
+bone -1 vertex material texture material
+material vertex anim frame =
+material -1 vertex
+= frame 1.0
+=
+vertex
+1.0 -1
+texture 0.500000 bone
+0.500000 -1 bone =
+1.0 frame vertex material
+0.500000 frame 1.0 frame bone
+-1
+vertex 1.0 anim = 0.500000 0.500000 anim texture anim 0.500000 0.500000 bone vertex anim
+bone texture bone 0.500000 anim
+= texture anim material bone
+texture frame
+0.500000 0.500000 = vertex bone 1.0 anim =
+= = = = = frame anim
+texture
+= 0.500000
+frame -1 bone frame material 0.500000 material
+vertex bone
+texture =
+0.500000 bone material anim = bone
+frame
+1.0 0.500000 frame bone frame texture -1 material
+vertex 0.500000 texture anim
+bone texture frame -1 texture 0.500000 0.500000 0.500000
+= vertex 0.500000
+-1 frame
+texture material materia
\ No newline at end of file
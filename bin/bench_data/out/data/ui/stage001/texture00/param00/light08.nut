@@ -0,0 +1,3 @@
+1.0 = -1 -1
+0.500000 -1 -1 anim material anim texture
+= texture
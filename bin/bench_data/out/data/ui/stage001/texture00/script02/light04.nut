@@ -0,0 +1,5 @@
+bone
+vertex
+= vertex anim anim 0.500000
+material
+0.50
\ No newline at end of file
@@ -0,0 +1,9 @@
+-1 1.0 anim bone
+anim 1.0 = anim 1.0 1.0
+vertex texture = = -1
+0.500000
+frame 1.0 material material 1.0 -1 = anim =
+1.0 -1
+anim 0.500000 = 1.0 material texture
+1.0 frame 0.500000 -1 0.500000 texture 1.0 = bone 1.0
+anim
\ No newline at end of file
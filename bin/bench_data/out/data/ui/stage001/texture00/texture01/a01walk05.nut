@@ -0,0 +1,143 @@
+1.0 =
+-1 anim
+material
+anim vertex frame anim
+material
+texture texture 1.0 1.0 = = material bone texture anim
+bone bone 1.0 anim texture bone vertex
+vertex -1 = material
+-1 texture 0.500000 1.0 vertex
+material 0.500000
+0.500000 =
+0.500000 vertex
+material texture
+-1 texture frame
+-1
+texture
+vertex 1.0
+-1 vertex anim
+vertex vertex
+frame texture
+0.500000 bone vertex bone
+1.0 texture
+anim
+0.500000 frame
+bone bone bone 0.500000 texture
+anim vertex frame
+vertex -1 =
+material anim 0.500000 material 0.500000 bone
+frame 1.0
+texture texture material
+bone
+-1 vertex -1 anim 0.500000 frame
+bone
+1.0 texture anim bone anim
+1.0
+anim -1
+material -1 1.0 bone material -1
+bone vertex 0.500000 1.0 bone 0.500000 frame -1 texture -1 -1
+frame = vertex
+material 0.500000 1.0 0.500000
+frame vertex -1 1.0 0.500000 -1 material
+anim bone
+bone 0.500000
+bone texture material = bone -1 0.500000 material -1 =
+-1 = 1.0 bone anim 0.500000 = anim vertex vertex -1
+vertex
+bone texture bone 0.500000 anim frame frame 1.0 1.0 = -1 -1 material 1.0 texture 1.0
+bone bone =
+bone frame =
+vertex vertex anim frame
+1.0
+-1 material
+material 1.0 1.0 texture
+anim texture texture vertex
+1.0
+= bone
+anim texture vertex 0.500000 -1 0.500000 bone
+anim 0.500000 bone
+=
+0.500000 1.0 = -1 texture frame frame vertex
+frame 0.500000 1.0
+anim texture anim frame 0.500000 vertex
+anim
+0.500000
+anim
+bone
+0.500000 = =
+0.500000 anim texture bone 0.500000 texture
+frame
+vertex
+=
+texture anim texture bone frame
+1.0
+texture 1.0 vertex anim = frame
+bone
+vertex
+bone material 0.500000
+0.500000 texture
+vertex = vertex vertex bone vertex bone bone =
+1.0 vertex 1.0 = material -1
+material material = frame
+=
+frame material material material vertex -1 vertex = 1.0 vertex vertex bone 1.0 frame anim texture
+frame 1.0
+0.500000 1.0 1.0
+vertex bone texture material 0.500000 material bone 0.500000 vertex -1 -1 0.500000 anim frame 1.0
+vertex frame material texture material 1.0
+bone 0.500000
+1.0
+bone
+0.500000 vertex anim bone vertex anim frame anim 0.500000
+bone 0.500000 anim texture
+frame texture texture -1
+vertex
+= frame vertex material material bone 0.500000 1.0 bone
+-1 frame -1
+anim anim 0.500000 vertex anim 1.0
+-1 = 0.500000 bone bone
+anim -1 -1 anim vertex texture
+vertex
+0.500000 0.500000 = texture
+0.500000 frame texture 0.500000 texture bone
+material anim material texture frame anim 0.500000 vertex vertex texture
+bone 0.500000 texture 1.0 frame frame
+= anim bone anim texture anim =
+-1 texture vertex frame
+anim
+vertex bone vertex material -1
+anim 1.0 bone material = anim vertex =
+anim 0.500000 -1 1.0 -1 texture -1 vertex 1.0 anim
+-1 frame
+texture 0.500000
+bone
+-1 anim
+bone
+-1 frame
+1.0 0.500000 anim 1.0
+texture -1 0.500000
+-1 frame 0.500000 0.500000 0.500000 texture material 0.500000 -1 -1 -1 material material bone 1.0 vertex
+1.0 1.0 material 0.500000 texture bone -1
+0.500000 =
+vertex bone 1.0 = 1.0
+material
+1.0 anim
+texture material = -1 = texture -1
+bone bone vertex bone
+bone
+-1 bone anim =
+-1 1.0 anim =
+material = bone -1 vertex texture 0.500000 frame texture bone 1.0 texture = bone anim
+vertex material
+1.0 texture
+0.500000 1.0 1.0
+frame anim 0.500000 texture bone texture
+= bone
+bone frame 1.0 vertex 0.500000 1.0 material 0.500000 vertex vertex = 0.500000 -1 anim frame bone
+vertex anim 1.0 vertex anim vertex
+-1 anim 1.0
+frame texture vertex material vertex 1.0
+=
+-1
+anim texture 1.0
+1.0
@@ -0,0 +1,7 @@
+= anim frame
+material
+-1 vertex -1 texture
+bone vertex texture bone frame vertex
+0.500000
+-1 material vertex bone
+anim anim 0.5
\ No newline at end of file
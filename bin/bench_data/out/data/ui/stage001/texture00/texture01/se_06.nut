@@ -0,0 +1,124 @@
+material = = frame = anim bone
+= vertex material
+= 0.500000 vertex
+1.0 anim
+anim
+=
+0.500000 texture
+=
+anim material
+= vertex
+1.0 = = -1
+-1
+0.500000 = frame frame
+-1 0.500000
+bone anim bone texture
+anim
+frame frame bone 0.500000
+vertex frame bone
+1.0 0.500000 vertex 0.500000
+material
+frame =
+=
+texture
+1.0 frame
+0.500000 anim frame 1.0
+texture 1.0 -1 frame frame material vertex -1 anim texture texture material
+-1 vertex -1 frame -1
+-1 material
+-1 texture = frame vertex texture bone frame
+texture material 1.0 bone vertex vertex anim 0.500000
+texture
+material material vertex frame material anim bone
+1.0
+-1
+vertex 1.0
+anim
+material 0.500000 anim -1 bone 1.0 -1
+frame frame
+anim texture texture vertex 1.0
+0.500000 frame material 1.0
+0.500000
+0.500000 frame =
+bone texture 1.0 bone -1 = = vertex frame
+-1 frame = texture vertex material bone vertex
+= bone vertex =
+1.0
+= =
+anim
+-1 texture
+anim anim 1.0 material 1.0 texture anim
+0.500000 0.500000 -1 anim
+bone anim
+vertex
+vertex 0.500000
+1.0
+= texture bone material anim 1.0
+0.500000 anim vertex vertex bone 0.500000 vertex
+frame 0.500000 = bone frame material bone -1 vertex
+material -1 0.500000 =
+-1 1.0 -1 vertex 1.0 -1 texture anim texture bone -1
+1.0 anim
+-1 1.0 bone =
+material anim anim 1.0 bone anim
+vertex = bone anim -1 0.500000
+anim
+-1 anim vertex 1.0 = material = frame
+anim
+texture bone
+frame material -1
+1.0
+-1 vertex texture texture 0.500000 1.0 -1 -1 -1 vertex
+texture
+texture 0.500000
+1.0 vertex vertex material bone anim 0.500000 anim material 1.0 1.0 frame 0.500000 -1 -1 texture
+1.0 -1 anim bone frame
+1.0
+texture 1.0 0.500000 texture -1
+vertex
+anim
+= 1.0 vertex vertex
+= 0.500000 =
+anim material material texture frame anim =
+-1
+frame
+bone vertex frame
+= vertex bone
+1.0 = anim = vertex frame = material =
+vertex
+-1 material material frame material =
+bone texture 1.0 0.500000 -1
+frame
+material
+vertex -1 1.0 =
+anim vertex anim frame material
+texture frame frame texture texture 0.500000 =
+texture frame
+vertex
+bone bone frame
+1.0 texture
+bone frame
+vertex vertex 1.0
+frame = anim
+frame = texture
+1.0 material
+0.500000
+vertex = -1 anim -1 material 1.0 0.500000
+frame material frame anim
+frame
+material frame texture vertex 1.0 anim
+vertex
+frame material anim = anim anim
+-1
+-1
+-1
+0.500000 1.0 anim = 1.0 texture anim texture texture
+bone
+frame material 1.0
+bone frame anim 0.500000 material
+1.0 0.500000 -1 0.500000 vertex material 1.0 frame
+0.500000 0.500000 anim -1 texture material texture 0.500000 -1 anim texture anim 0.500000 = vertex bone
+bone frame
+1.0 frame texture 0.500000
+material 0.500000
+vert
\ No newline at end of file
@@ -0,0 +1,60 @@
+material -1
+frame
+0.500000 anim 0.500000 0.500000
+-1 = 0.500000 -1
+material vertex =
+=
+= bone texture material = 0.500000 = -1 -1 texture
+material
+1.0
+anim vertex 1.0
+= texture = anim anim
+0.500000 0.500000
+material anim vertex
+bone
+texture 1.0 frame 0.500000 anim texture = 1.0 material texture -1 1.0 texture material texture anim
+vertex
+= bone
+= bone -1
+=
+-1 = texture vertex = frame texture anim texture
+bone
+1.0 =
+-1 vertex texture bone 1.0 1.0 anim -1 -1 bone texture material -1 anim texture 0.500000 anim bone
+0.500000
+-1 material 0.500000 vertex
+vertex -1
+frame
+vertex material 1.0 anim vertex 0.500000 vertex texture texture
+1.0 anim frame frame material = material anim vertex
+texture material = material frame -1 1.0 anim frame -1
+0.500000 material vertex = frame anim frame 1.0 frame -1 texture = = vertex 1.0 material
+texture
+1.0 anim
+bone = -1 texture
+anim vertex bone frame material
+1.0
+frame 0.500000
+0.500000
+0.500000 texture 1.0 = -1 texture 0.500000
+frame -1
+1.0 vertex material 0.500000 -1
+-1 anim vertex texture
+material texture
+1.0 =
+=
+frame
+anim 0.500000 material texture 0.500000
+= 1.0 bone texture bone anim
+0.500000 material material 0.500000 bone frame =
+anim material 0.500000 0.500000 1.0 frame = vertex -1 0.500000 frame bone vertex material
+texture frame 0.500000
+-1 0.500000 0.500000
+bone bone material bone =
+frame
+-1 bone vertex vertex
+frame
+texture
+frame bone texture
+0.500000 -1 vertex bone
+verte
\ No newline at end of file
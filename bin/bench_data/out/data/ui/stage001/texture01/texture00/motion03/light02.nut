@@ -0,0 +1,40 @@
+texture 1.0 0.500000
+0.500000 =
+0.500000 bone -1 0.500000
+1.0 bone
+anim vertex
+= vertex -1 frame anim bone -1 0.500000
+bone material = frame frame 1.0 =
+-1 bone
+anim 1.0 0.500000 -1
+vertex bone texture texture bone
+0.500000 frame 0.500000 = bone
+0.500000 -1
+-1 anim -1 = -1
+-1 bone = -1 1.0 frame texture = anim 1.0 0.500000 frame 0.500000 0.500000 = 1.0
+0.500000 = frame
+anim -1
+bone texture bone 0.500000
+bone -1 = -1 = texture
+1.0 1.0
+-1 1.0
+material frame vertex 0.500000 1.0
+vertex = = texture -1 vertex
+bone texture -1 vertex -1 frame 0.500000
+=
+bone frame
+0.500000 material 0.500000 1.0 anim frame 0.500000 frame material
+1.0 -1 material
+frame vertex -1 1.0 frame vertex material bone
+material 0.500000 bone -1
+= 0.500000 texture material = bone
+1.0 frame bone
+anim = anim
+anim anim
+=
+= vertex bone
+bone
+vertex texture frame
+bone = anim vertex
+frame texture anim -1
+material bone bone vertex 0.
\ No newline at end of file
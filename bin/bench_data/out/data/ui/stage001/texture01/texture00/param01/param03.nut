@@ -0,0 +1,5 @@
+-1
+0.500000 0.500000
+frame 1.0
+1.0
+material = bone frame 
\ No newline at end of file
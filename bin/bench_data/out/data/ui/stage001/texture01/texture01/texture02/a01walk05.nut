@@ -0,0 +1,23 @@
+bone texture material 0.500000 vertex anim = material
+bone frame
+vertex material material material
+material anim
+bone
+material -1
+frame 0.500000
+texture material = vertex = 0.500000
+frame texture
+bone
+texture frame = anim
+frame 1.0 =
+=
+= vertex texture
+bone 1.0 vertex vertex -1 =
+anim
+1.0 vertex texture
+material material
+0.500000 anim bone material
+vertex -1 1.0
+frame
+anim -1
+-1 mater
\ No newline at end of file
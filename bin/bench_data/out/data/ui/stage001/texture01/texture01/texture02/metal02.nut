@@ -0,0 +1,4 @@
+texture bone frame -1
+0.500000
+vertex
+1.
\ No newline at end of file
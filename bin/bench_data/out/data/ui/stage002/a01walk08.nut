@@ -0,0 +1,4 @@
+bone 0.500000 vertex frame bone
+bone vertex 1.0 frame 1.0 =
+= material
+0.
\ No newline at end of file
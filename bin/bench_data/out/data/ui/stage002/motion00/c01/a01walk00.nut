@@ -0,0 +1,13 @@
+bone bone 0.500000 texture
+anim 1.0
+= = 1.0
+-1 =
+texture 1.0 0.500000 0.500000
+-1 bone -1 -1
+anim 1.0 vertex frame anim bone
+1.0
+-1 1.0
+1.0
+= vertex frame anim
+=
+1.0 bone material text
\ No newline at end of file
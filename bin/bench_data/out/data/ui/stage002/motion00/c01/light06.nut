@@ -0,0 +1,5 @@
+bone
+vertex anim
+0.500000 material bone 1.0 frame 0.500000 texture
+texture =
+-
\ No newline at end of file
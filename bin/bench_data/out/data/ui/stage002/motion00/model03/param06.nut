@@ -0,0 +1 @@
+material vertex vertex -1 = vertex anim -1 material frame
\ No newline at end of file
@@ -0,0 +1,8 @@
+0.500000 vertex 0.500000 1.0
+bone
+0.500000 vertex material -1 -1
+bone texture texture -1 vertex = material 0.500000 1.0 0.500000 anim frame texture bone vertex
+material 0.500000
+0.500000
+=
+texture 0.500000 ani
\ No newline at end of file
@@ -0,0 +1,4 @@
+-1 bone material -1
+bone bone =
+frame -1 material 1.0
+material frame material bo
\ No newline at end of file
@@ -0,0 +1,165 @@
+bone anim 0.500000 = material material anim vertex anim
+vertex
+-1 frame
+material =
+vertex texture =
+bone material texture vertex frame -1 anim
+anim material vertex
+bone
+vertex
+=
+1.0 anim anim = material bone texture vertex vertex texture -1 material bone = anim material
+anim
+frame 1.0
+frame frame texture 1.0 -1 1.0 bone -1 = bone -1
+bone = material
+-1
+anim
+0.500000 -1 = bone
+0.500000
+anim material texture bone 1.0
+texture -1 material -1 -1 vertex = anim -1 material 1.0 material texture
+= 1.0 bone material 1.0 1.0
+material
+vertex
+-1 frame frame anim -1 -1 = vertex 1.0 0.500000
+texture texture vertex -1 material frame bone 0.500000
+= vertex material texture anim = texture material texture bone vertex
+anim
+0.500000 0.500000 0.500000 bone
+frame texture
+= frame texture anim anim
+vertex
+vertex vertex
+=
+1.0
+0.500000 anim bone material texture vertex material 0.500000 bone
+0.500000 texture frame anim -1
+0.500000
+0.500000 bone frame
+vertex vertex 0.500000
+anim =
+0.500000 0.500000 -1 1.0 texture
+-1 vertex
+bone bone frame texture anim
+texture
+-1 texture
+-1
+0.500000
+frame
+vertex bone bone 1.0 1.0
+vertex = bone 1.0 bone -1 frame anim vertex material vertex
+bone -1
+material material 1.0 anim 1.0
+vertex = bone material
+1.0 bone material anim texture 1.0 -1
+frame anim frame = 0.500000 -1 material
+-1
+anim 0.500000 material vertex -1 texture vertex
+= -1 vertex -1
+1.0 anim
+1.0 material
+1.0
+anim 1.0 1.0
+=
+frame frame material vertex 1.0 texture
+vertex bone
+vertex
+1.0 bone -1 bone texture
+frame 0.500000 bone -1 vertex vertex
+-1
+0.500000 =
+texture
+-1 0.500000 = bone 0.500000
+0.500000 material
+vertex texture vertex texture material = -1
+0.500000 = frame -1 anim = texture material
+0.500000
+bone texture texture anim anim vertex 1.0 0.500000 frame -1 1.0
+1.0 material material
+bone vertex = 0.500000 material
+anim 1.0 material anim frame = 1.0 = =
+0.500000 bone 1.0 bone
+0.500000 0.500000
+anim
+0.500000 vertex material vertex
+1.0 0.500000 vertex texture
+frame bone vertex material
+vertex
+1.0 1.0 frame = -1 vertex texture texture anim texture
+0.500000 anim texture texture
+1.0 material anim 1.0 texture bone bone anim vertex = -1
+vertex 1.0 material frame 0.500000 material
+frame 0.500000 frame vertex anim 0.500000
+-1 0.500000
+1.0 vertex
+texture bone
+anim bone 1.0
+1.0
+bone vertex frame = -1 texture -1 1.0
+bone -1 bone texture
+material
+= -1 1.0 = vertex material
+vertex
+bone anim 0.500000 = vertex
+0.500000 frame
+vertex -1 frame texture
+material anim -1 1.0 material anim
+frame
+1.0 texture 0.500000 texture
+1.0 0.500000 =
+material =
+vertex 0.500000 material = = vertex
+0.500000 material texture
+anim
+frame
+-1 texture texture 0.500000 -1 frame = vertex bone vertex 1.0 = anim =
+anim material
+material
+= material
+1.0 -1 texture frame
+vertex = 1.0
+bone = = frame texture anim
+bone vertex
+= texture 0.500000
+material anim
+1.0 bone
+frame vertex = 0.500000 =
+= 0.500000
+texture = anim bone bone vertex 1.0 material vertex frame
+texture =
+=
+1.0 1.0 material -1 material
+vertex -1 = 0.500000 1.0
+1.0 texture anim bone 1.0 -1
+material 1.0 0.500000 vertex vertex
+texture -1 0.500000 frame 1.0 texture -1
+vertex bone vertex texture 0.500000
+anim frame
+anim = -1 anim
+1.0 = bone 0.500000
+bone anim
+anim material
+=
+0.500000
+vertex 0.500000 anim vertex anim 0.500000 0.500000 material -1 anim
+= texture 1.0 frame frame -1
+0.500000 0.500000 frame vertex bone
+vertex material 0.500000 texture 1.0
+anim frame
+anim -1 anim anim bone 1.0 -1 material = texture bone texture 1.0 = bone
+bone
+=
+0.500000 vertex anim frame anim = 1.0 0.500000
+0.500000 vertex
+material texture 1.0 texture -1 frame 1.0 =
+material
+-1
+frame frame anim 0.500000 bone bone material 1.0 frame
+frame anim frame texture
+frame anim bone
+material -1 bone vertex -1 vertex frame -1 material material
+material 1.0 anim frame vertex = 0.500000
+texture
+= material 1.0
+frame material frame 1.0 material ani
\ No newline at end of file
@@ -0,0 +1,7 @@
+=
+-1 0.500000 1.0 0.500000
+0.500000 -1 texture frame
+texture
+texture 0.500000 material material vertex
+vertex 0.500000 bone bone
+-1 frame vertex fra
\ No newline at end of file
@@ -0,0 +1,2 @@
+anim anim bone anim bone 0.500000 anim bone
+= fram
\ No newline at end of file
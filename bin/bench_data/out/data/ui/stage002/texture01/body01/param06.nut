@@ -0,0 +1,245 @@
+0.500000
+1.0
+texture vertex material material 0.500000
+0.500000 =
+anim
+anim material material frame
+material
+anim 0.500000 1.0 bone
+-1
+material anim texture frame vertex bone -1 frame material = texture texture frame bone frame material frame
+vertex 0.500000 =
+vertex
+frame
+texture vertex 1.0
+1.0 = texture anim 0.500000 1.0 material 1.0 frame
+1.0 bone
+texture 0.500000
+material = =
+vertex 0.500000 1.0 0.500000
+material frame
+1.0 0.500000
+vertex
+bone texture -1 = 1.0 anim anim frame anim anim
+texture 1.0
+material texture frame
+0.500000 material texture
+material material
+= bone
+anim
+=
+-1
+anim vertex vertex anim
+= frame bone texture material vertex
+bone = frame -1 bone bone
+-1 frame
+= 0.500000 frame vertex 0.500000
+texture -1 material
+bone 0.500000 0.500000 frame anim 1.0
+vertex bone
+-1 = frame frame 0.500000
+vertex vertex
+bone 0.500000 texture 1.0 1.0 texture
+texture material = frame texture 1.0 =
+1.0 vertex vertex anim 0.500000 -1 = bone material 1.0 frame
+1.0 1.0 = bone material vertex 0.500000 frame
+1.0 vertex = material =
+-1 0.500000 =
+vertex anim anim frame vertex
+0.500000
+-1 1.0 bone
+texture 1.0 anim anim 0.500000 material =
+bone anim frame
+bone
+1.0 -1 frame 0.500000 frame
+material bone
+0.500000 material
+-1 -1
+1.0 0.500000
+1.0 -1 anim
+bone material
+0.500000 -1 0.500000 = 0.500000
+texture frame frame
+bone
+material anim anim -1 frame anim 1.0
+= 0.500000
+material 1.0 anim
+bone
+vertex frame vertex
+texture 0.500000 = = anim
+bone -1
+anim
+bone texture =
+1.0 1.0 anim bone material 0.500000 0.500000 vertex texture material
+frame
+material 0.500000 vertex = anim material texture texture -1 anim anim -1
+1.0 -1
+material -1 material
+-1
+frame
+material
+0.500000 material vertex 0.500000 -1 = 0.500000
+-1 material
+0.500000 =
+vertex frame -1 texture
+1.0 1.0
+anim frame
+anim anim texture 0.500000 bone
+material material texture anim frame material
+material -1
+0.500000 0.500000
+texture 1.0 1.0
+= texture 0.500000 bone 1.0 anim material material anim
+= bone -1 material frame 1.0
+anim
+-1 vertex
+1.0 1.0
+= -1 anim -1 -1 texture vertex
+0.500000 1.0
+0.500000
+vertex 0.500000
+-1 material -1
+anim 0.500000 material texture frame
+frame -1
+bone vertex anim anim
+-1
+1.0 bone bone anim vertex texture = texture anim = bone -1 anim material texture bone texture frame 1.0
+texture anim
+texture vertex -1 vertex 1.0 material bone
+vertex
+vertex anim
+vertex -1 anim vertex 0.500000 bone -1 0.500000 material material
+vertex anim
+bone
+= frame bone frame 0.500000 bone
+= -1 vertex texture frame
+vertex anim anim frame texture
+vertex vertex 0.500000 bone vertex = material anim
+texture
+material anim vertex anim
+bone -1 0.500000 material vertex anim
+vertex
+-1 vertex 0.500000
+vertex
+0.500000 0.500000 material = 0.500000 bone texture
+= -1 anim anim vertex 1.0
+material vertex texture
+= -1
+anim
+0.500000 anim
+bone texture 1.0
+-1 =
+anim 0.500000 = vertex material 0.500000
+frame texture frame
+bone frame
+1.0 vertex 0.500000 texture
+0.500000
+frame vertex texture = texture
+anim frame texture = vertex = bone anim material material
+vertex vertex = bone material 0.500000 anim anim
+texture bone -1
+-1 vertex =
+= 0.500000 material bone material = texture material material material
+= -1
+vertex
+vertex
+1.0 vertex bone
+anim material vertex vertex
+0.500000 material bone -1 -1
+anim anim
+bone 1.0 anim bone frame 1.0 -1
+material =
+texture 0.500000 0.500000 -1 0.500000 0.500000 bone anim vertex anim
+material bone bone 1.0 frame =
+anim material -1 0.500000 bone material texture -1 -1 frame material
+= = vertex 1.0
+1.0 bone
+anim
+anim vertex vertex anim bone anim material 0.500000
+texture
+1.0 material 1.0
+= bone vertex texture
+-1
+frame texture -1 1.0
+= 1.0
+-1 texture
+material material material anim vertex
+0.500000 texture 1.0
+= 0.500000 = frame = anim texture anim bone texture vertex
+frame
+1.0
+texture -1 0.500000 material vertex bone 1.0 vertex anim
+= anim
+bone
+= texture material
+material
+frame vertex =
+anim
+vertex anim
+texture = frame
+1.0 =
+bone bone bone
+material 0.500000 =
+material anim material -1 -1 vertex bone texture anim material
+material =
+-1 1.0 texture
+= anim
+bone 1.0 vertex frame
+texture texture 0.500000
+frame
+-1 1.0 bone texture bone
+material 0.500000
+anim bone vertex anim texture anim vertex =
+texture texture =
+texture -1 =
+anim frame -1 0.500000 vertex
+material texture
+0.500000 texture -1
+material -1
+1.0
+1.0 bone -1 frame 0.500000
+0.500000 0.500000 bone
+0.500000 -1 vertex 1.0 material frame 1.0 0.500000 =
+texture frame
+anim anim anim material frame vertex -1 1.0 0.500000 texture 0.500000 material 0.500000 bone 1.0
+material 0.500000 anim -1 vertex frame vertex frame bone
+vertex = = -1
+-1 vertex vertex
+= =
+bone material anim frame
+=
+=
+texture bone 0.500000
+1.0
+= 1.0 -1
+texture bone 1.0 bone frame material = 0.500000 anim -1
+1.0 1.0 -1 0.500000 vertex anim
+-1 vertex frame vertex -1 bone
+frame vertex
+1.0 -1
+= 1.0
+vertex
+anim texture -1
+0.500000 texture material 0.500000 material vertex texture 0.500000 texture -1
+vertex 1.0
+bone
+vertex
+vertex
+0.500000
+vertex 0.500000 bone
+= 0.500000 bone
+material vertex 1.0 frame
+1.0 bone vertex -1
+= material material anim
+frame bone -1 bone
+anim frame 1.0 0.500000 texture material anim
+-1 frame texture
+anim vertex frame
+material
+texture 0.500000 anim anim bone = bone material texture 0.500000 bone bone texture 1.0 -1 1.0 bone frame bone 0.500000 anim anim = frame vertex 1.0 vertex -1 frame -1
+texture texture vertex texture anim anim
+anim bone anim material anim -1 1.0 anim 0.500000 bone 0.500000 = texture material material -1 material frame -1 1.0 -1 frame frame =
+0.500000 -1
+= 0.500000 1.0 frame texture anim bone
+-1 texture =
+texture = 1.0 0.500000 0.500
\ No newline at end of file
@@ -0,0 +1,8 @@
+vertex -1 texture
+material texture = material
+-1
+= 0.500000
+anim vertex = texture texture frame
+-1 bone vertex -1 1.0 anim 0.500000 frame frame bone texture texture bone 1.0 -1
+=
+-1 texture 1.0
\ No newline at end of file
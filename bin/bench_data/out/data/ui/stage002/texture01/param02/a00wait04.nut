@@ -0,0 +1,15 @@
+0.500000 bone bone texture material material
+0.500000 vertex
+vertex -1
+vertex vertex frame = frame
+vertex material vertex
+= texture
+vertex
+1.0 anim
+1.0 -1 0.500000 texture 1.0 texture -1 1.0 0.500000
+1.0 anim frame frame
+-1 0.500000 = anim bone 1.0 texture 1.0 material texture
+anim
+frame 0.500000 1.0 0.500000
+= =
+material vertex material f
\ No newline at end of file
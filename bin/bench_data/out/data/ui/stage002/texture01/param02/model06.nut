@@ -0,0 +1,18 @@
+texture frame
+1.0 bone texture bone material
+frame -1 1.0
+anim bone =
+1.0 = bone texture 1.0
+frame 1.0
+1.0 1.0
+= material
+0.500000
+frame 1.0 anim texture
+frame frame vertex anim = 1.0 0.500000
+bone
+vertex
+= 0.500000
+1.0 vertex = 1.0 vertex 1.0
+1.0 bone texture anim texture bone = 0.500000 1.0 = frame texture
+-1
+vertex frame material material frame 0.500000 materi
\ No newline at end of file
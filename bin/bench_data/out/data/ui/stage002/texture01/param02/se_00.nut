@@ -0,0 +1,4 @@
+material bone = anim texture
+vertex bone -1 texture bone
+frame vertex -1
+a
\ No newline at end of file
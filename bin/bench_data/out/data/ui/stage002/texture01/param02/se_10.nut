@@ -0,0 +1,75 @@
+bone anim
+1.0 =
+frame -1 0.500000
+=
+texture material bone
+0.500000 =
+vertex = vertex
+material bone texture anim vertex material anim
+=
+-1 vertex material = material anim = vertex =
+= 0.500000 anim 1.0 anim 1.0 frame frame anim material bone anim material vertex
+-1 material vertex anim texture texture -1 0.500000 0.500000
+frame
+material 0.500000 frame texture
+texture anim 1.0 = material 1.0 =
+0.500000 0.500000 texture bone texture material = material -1 0.500000 0.500000
+texture material material
+texture 0.500000
+bone
+texture 1.0
+0.500000 anim
+vertex 1.0 frame frame
+frame
+= vertex material = anim
+vertex -1 material
+frame texture 1.0
+material
+-1 texture frame anim
+-1 1.0
+vertex anim anim = anim -1
+material -1 frame = = = = material
+frame frame vertex texture
+vertex texture
+texture = frame
+texture = anim
+texture
+material
+= -1 material material anim vertex frame =
+vertex
+anim
+vertex bone bone -1 frame material bone bone
+anim
+frame
+bone
+frame material material material bone
+1.0 bone -1
+1.0
+=
+vertex 0.500000
+anim frame bone anim frame 0.500000 bone 1.0 1.0
+texture 1.0 frame 1.0 vertex anim vertex 1.0
+vertex vertex bone material bone bone
+material
+texture frame frame -1 =
+1.0 1.0 0.500000 anim bone frame
+material -1
+texture anim material
+bone material frame material
+= 1.0 frame anim texture 0.500000 material
+texture vertex bone frame 1.0 bone bone 0.500000 = 0.500000 -1 bone 0.500000 anim frame
+texture anim material 1.0 1.0
+vertex texture 1.0 frame
+anim anim
+bone 1.0 -1 bone bone frame
+-1
+= bone bone
+-1 vertex = 1.0
+material
+bone material
+= bone material anim vertex anim anim
+texture vertex material frame anim
+frame
+bone = 0.500000 texture bone 1.0 -1 =
+texture
+texture 0.500000 = texture frame bone b
\ No newline at end of file
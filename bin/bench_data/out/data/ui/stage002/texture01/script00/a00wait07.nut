@@ -0,0 +1,182 @@
+frame frame bone
+material anim
+1.0 anim vertex
+-1
+anim frame 1.0 -1 material bone bone 1.0 anim anim 1.0 texture
+anim 0.500000
+texture anim material bone -1
+-1 1.0 1.0 bone 0.500000
+1.0 bone material 0.500000 material bone -1 frame material
+vertex = 1.0
+frame
+frame 1.0 -1 bone
+material vertex vertex texture
+vertex 1.0
+frame texture
+0.500000 texture material
+anim -1
+vertex vertex =
+-1 texture
+0.500000
+frame
+-1 = texture vertex =
+bone
+1.0 0.500000 frame vertex -1 bone material
+vertex
+material
+material
+=
+anim -1 material anim -1 bone material frame
+frame material = 0.500000 bone texture texture material 0.500000 anim
+bone texture -1 vertex bone -1 = texture vertex bone
+vertex anim 0.500000
+1.0 -1 =
+vertex bone
+texture -1 bone
+= 1.0
+-1 anim 0.500000 bone 1.0 vertex 1.0 1.0 -1
+vertex anim frame 1.0 = vertex vertex texture -1
+anim vertex bone anim vertex 1.0 vertex anim
+=
+= frame material -1
+1.0 texture
+= anim bone
+material =
+texture =
+vertex
+material texture material frame
+frame = anim = texture
+= anim 0.500000 1.0 vertex bone 0.500000 anim bone
+1.0 vertex -1 0.500000 0.500000
+frame texture
+vertex
+= -1 material 0.500000
+= =
+1.0
+texture frame
+material
+vertex anim material bone material frame frame anim
+-1 1.0 frame bone
+0.500000 bone 0.500000 frame
+0.500000 vertex -1
+vertex
+texture = frame vertex =
+-1
+= -1 frame material texture
+frame 1.0 = bone frame 1.0 1.0
+0.500000 vertex =
+frame
+anim bone 1.0
+-1 vertex
+frame 0.500000 1.0 1.0 bone frame vertex
+= = bone vertex texture 1.0 material vertex anim bone texture
+0.500000 = vertex -1 vertex bone texture
+anim = material texture frame = -1 = vertex
+= anim bone anim -1 vertex material vertex 0.500000 vertex bone
+bone
+1.0
+anim 0.500000 = = anim 0.500000
+frame bone -1 material -1
+vertex
+anim material frame bone 1.0 = material vertex
+-1
+anim
+bone frame =
+vertex
+texture
+material frame = material material bone anim texture
+texture 0.500000 -1 frame = texture frame 1.0
+frame frame 0.500000
+-1
+vertex anim
+frame bone
+texture
+anim frame
+vertex =
+vertex 0.500000 -1
+1.0 texture
+vertex
+0.500000 texture material 1.0 1.0 1.0 -1 0.500000 -1 anim
+texture texture texture bone anim material 1.0
+frame = material
+anim
+frame 0.500000 frame
+vertex material 1.0 = -1 anim
+bone 0.500000 0.500000
+1.0 -1 frame
+texture texture
+vertex anim 0.500000 =
+vertex anim frame
+-1 1.0
+frame bone = 0.500000
+0.500000
+bone frame material frame bone 0.500000 anim material -1
+1.0 1.0
+0.500000 bone -1 texture vertex
+vertex
+0.500000 bone texture vertex
+bone =
+-1 -1
+material
+0.500000 material 0.500000
+vertex vertex texture
+vertex =
+bone 1.0 vertex
+= vertex 1.0 texture 1.0 vertex 1.0 -1 material = bone
+vertex bone 0.500000 frame 0.500000 frame anim 1.0 frame material 1.0 texture 1.0 bone = vertex anim vertex 0.500000
+frame anim
+0.500000
+vertex vertex
+frame -1 material
+= material bone material 1.0 material
+frame = -1 texture bone material material vertex
+bone texture 0.500000 vertex 0.500000
+1.0
+-1 texture anim vertex
+-1 = anim vertex -1 anim frame
+vertex
+-1 bone 1.0
+1.0
+-1
+0.500000 0.500000
+-1 frame = anim 1.0 frame 1.0 texture 1.0 -1 = anim vertex = 1.0 0.500000 material
+frame = 1.0 frame bone 1.0 0.500000 material material bone material vertex bone texture frame texture 0.500000 =
+vertex texture -1 1.0 material 1.0 1.0 vertex 0.500000 frame bone vertex frame
+vertex material bone
+bone frame -1
+anim -1 = -1 anim
+anim
+0.500000
+-1 material
+texture
+vertex bone bone
+vertex frame vertex -1 vertex 0.500000
+0.500000 texture -1 vertex
+1.0 anim anim
+1.0 = texture frame texture -1 = bone 1.0 texture
+bone frame -1
+-1 0.500000
+material material 1.0
+-1 =
+= bone = anim = anim
+vertex -1 bone vertex
+1.0 0.500000 texture frame
+frame anim vertex frame
+0.500000 frame 0.500000 vertex frame texture =
+0.500000 1.0 bone
+anim anim bone 0.500000 frame vertex texture 0.500000 texture
+frame
+0.500000 =
+anim frame
+anim
+frame
+frame 1.0 material frame
+material frame
+0.500000
+anim vertex = texture 0.500000
+1.0 bone anim texture vertex
+= 1.0 1.0 material texture
+texture texture
+1.0 0.500000
+material 0.500000
+0.500000 material frame frame b
\ No newline at end of file
@@ -0,0 +1,31 @@
+material -1
+frame bone vertex
+vertex
+= vertex
+1.0
+= = = bone -1
+1.0 material texture texture material = -1
+0.500000
+= 0.500000 frame 0.500000 vertex -1 texture
+frame
+texture material frame frame bone
+= -1 texture =
+-1 0.500000
+anim material bone texture texture -1 frame anim bone
+1.0 = material 1.0
+1.0 0.500000 frame texture vertex -1 material frame -1 1.0
+0.500000 -1 -1
+anim -1 -1 anim
+1.0 -1 anim = vertex anim -1 vertex
+frame texture texture
+anim texture
+= -1
+1.0 -1 vertex = =
+0.500000 vertex texture
+-1 bone texture -1 0.500000
+frame 1.0 1.0 vertex vertex -1
+material
+texture 0.500000 0.500000 bone
+0.500000 texture 1.0 anim
+vertex anim = vertex -1 = vertex
+bone texture frame 1.0 bone material textur
\ No newline at end of file
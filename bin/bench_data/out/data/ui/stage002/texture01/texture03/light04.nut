@@ -0,0 +1,67 @@
+-1 -1 texture
+material -1 = bone
+frame
+vertex = bone 0.500000 1.0 vertex =
+vertex 1.0 bone anim material material
+texture
+0.500000 vertex texture 1.0 -1 bone
+anim bone vertex material
+texture frame texture anim frame vertex = 1.0 1.0 bone
+bone 0.500000
+= anim
+texture -1
+anim vertex 0.500000 1.0 1.0 0.500000 1.0 frame
+bone vertex 0.500000 anim vertex
+anim vertex vertex bone anim vertex frame -1 material vertex = frame material bone anim
+bone vertex 0.500000
+anim texture material
+texture
+=
+material frame = bone -1 -1 vertex -1 anim -1 anim
+vertex anim anim 1.0
+0.500000 texture bone -1 frame 0.500000 material vertex bone 1.0
+1.0 =
+material
+vertex 0.500000 0.500000 0.500000 texture
+= 1.0 1.0 texture vertex bone 0.500000
+1.0
+0.500000 anim material
+-1 anim =
+vertex -1 material frame
+anim bone
+vertex frame 1.0 -1
+= 0.500000 texture 0.500000 frame
+vertex vertex bone 1.0 vertex -1 =
+texture frame -1 bone vertex
+0.500000 anim bone bone 0.500000 texture 0.500000
+= = anim
+material 0.500000 material bone material frame bone anim anim -1 1.0 material texture -1
+0.500000
+frame 0.500000 anim
+0.500000
+material material = -1 = 0.500000 bone frame = -1 -1 vertex vertex vertex
+texture 0.500000 bone = -1 material
+texture = anim texture 0.500000 frame anim
+0.500000
+= 1.0
+vertex
+bone -1
+anim 0.500000
+texture
+bone vertex bone -1 = bone vertex material bone
+material
+0.500000 =
+bone 1.0 = anim
+texture 0.500000 -1 bone 0.500000 anim anim material
+= frame material 0.500000 anim
+0.500000
+0.500000 = material 1.0 1.0 frame frame anim anim vertex vertex
+-1
+frame
+bone
+= 1.0 frame -1 material bone 0.500000
+1.0 = material bone material 0.500000
+vertex 1.0 -1
+bone material 0.500000
+bone
+0.500000 bone
\ No newline at end of file
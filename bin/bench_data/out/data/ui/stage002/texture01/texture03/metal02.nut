@@ -0,0 +1,15 @@
+frame bone vertex anim
+0.500000
+= frame frame =
+anim material
+anim vertex 1.0 texture 1.0
+1.0 anim
+texture
+anim material
+-1 texture bone
+1.0
+vertex
+vertex anim texture anim =
+frame bone
+= frame -1 vertex 0.500000 -1 vertex -1 frame
+1.
\ No newline at end of file
@@ -0,0 +1,15 @@
+= =
+= frame 1.0
+-1 = -1 -1 0.500000
+vertex anim 1.0
+-1 texture
+bone
+vertex vertex vertex frame -1 1.0 1.0 -1 = material frame 0.500000
+vertex bone -1 0.500000 bone 1.0 anim vertex
+vertex 0.500000
+vertex
+bone 0.500000 1.0
+vertex -1
+material 1.0
+= material vertex bone
+material fram
\ No newline at end of file
@@ -0,0 +1,9 @@
+vertex 1.0 = = 1.0 -1 anim vertex = 1.0 material vertex anim material 1.0 0.500000 anim
+texture frame anim texture =
+material texture material = bone
+1.0 anim anim
+0.500000 bone = = frame 1.0
+0.500000 bone
+= vertex
+material
+texture materi
\ No newline at end of file
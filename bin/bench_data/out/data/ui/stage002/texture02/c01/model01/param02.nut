@@ -0,0 +1,52 @@
+-1
+frame 0.500000 texture vertex
+0.500000 -1 = frame 1.0 vertex texture
+frame -1
+vertex 1.0 frame 1.0
+-1
+vertex
+bone bone 0.500000 1.0 vertex
+bone
+1.0 1.0
+-1 texture -1 bone 1.0 texture bone
+= = bone 0.500000
+0.500000 bone
+bone
+1.0 = 0.500000 anim = -1 texture 1.0 bone
+vertex material texture
+0.500000 -1 texture
+bone
+frame vertex
+anim anim
+1.0 material anim 0.500000 frame frame
+material frame anim frame bone anim bone
+1.0 1.0
+vertex vertex anim
+material =
+anim bone material material bone texture
+anim
+frame
+vertex anim -1 frame anim
+1.0 = frame frame
+frame bone vertex anim anim anim
+material material material
+=
+material bone 0.500000 =
+anim 1.0 0.500000 bone
+frame bone
+frame
+1.0 vertex -1 vertex bone 1.0 frame anim
+anim bone
+bone material 1.0 0.500000
+bone
+bone bone anim frame
+vertex bone vertex
+material
+-1 frame
+material
+texture = anim 0.500000 anim frame 1.0
+bone
+-1 material 0.500000
+bone
+frame texture 1.0 texture -1 1.0 material
+texture -1 texture anim texture 1.0 
\ No newline at end of file
@@ -0,0 +1,73 @@
+vertex = 1.0 -1 0.500000 1.0 = 0.500000 frame frame
+0.500000 material
+-1 1.0 vertex
+0.500000 1.0 anim bone = vertex vertex 1.0
+0.500000 anim
+anim bone bone 1.0 -1 = 0.500000 frame frame material material texture bone material -1 frame 0.500000 =
+texture 0.500000 -1
+material -1 = frame texture bone -1 frame -1 material
+0.500000 bone 1.0 bone
+vertex vertex
+material material
+-1 anim
+texture = = -1 vertex material
+0.500000 -1
+vertex
+texture frame
+= 1.0 bone 0.500000 =
+bone material frame texture material vertex anim anim
+1.0 material
+bone -1 vertex
+0.500000 anim anim bone
+texture
+anim material -1 anim frame anim frame
+bone
+= -1 bone 0.500000 bone bone
+texture
+0.500000 anim frame texture anim
+1.0 vertex 0.500000 0.500000 = material
+texture = texture
+= material anim vertex
+= 0.500000 vertex vertex texture -1 material 0.500000 frame
+1.0
+texture 1.0 texture texture vertex
+frame = 0.500000 anim -1 vertex
+vertex anim 0.500000
+bone
+texture material = bone = material -1
+bone
+material = 0.500000 vertex 1.0
+anim vertex 0.500000 1.0 frame bone texture texture
+vertex 1.0 = = 0.500000 = bone material = material 0.500000 1.0 = frame 0.500000 = -1
+bone
+vertex
+0.500000 anim texture material
+bone
+= 1.0 material = anim texture frame = bone
+= bone
+-1 = anim
+texture
+frame -1
+texture material
+anim = 0.500000 1.0 material
+anim 0.500000 bone -1 texture bone material material bone anim 0.500000 bone 0.500000
+1.0 texture -1 -1 frame -1 frame anim vertex anim 0.500000
+1.0
+anim material
+bone
+bone 0.500000 texture 0.500000 -1 texture
+vertex material texture =
+material =
+vertex material
+1.0 anim -1 bone texture
+anim 0.500000 texture
+0.500000 texture
+0.500000
+-1 bone vertex frame
+material
+bone material 1.0
+-1
+0.500000 -1 0.500000 bone = material
+texture
+=
+0.500000 -1
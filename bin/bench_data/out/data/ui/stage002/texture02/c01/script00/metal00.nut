@@ -0,0 +1,110 @@
+texture
+anim = anim frame 0.500000 anim 1.0 frame
+0.500000 = material frame
+material 0.500000 anim 1.0 anim anim
+material 1.0 -1 anim 1.0 frame frame material
+frame -1 material vertex 0.500000 texture
+anim anim =
+frame frame bone
+vertex 1.0 bone vertex anim anim 0.500000 texture bone vertex
+-1 -1
+vertex anim
+vertex anim
+material texture bone anim texture 0.500000
+-1
+texture anim
+anim bone
+1.0
+0.500000 -1
+vertex material =
+-1 1.0
+texture
+frame
+1.0 0.500000 anim
+bone vertex = 0.500000
+frame -1 -1 1.0 -1
+frame texture
+0.500000
+material
+vertex vertex 0.500000
+material bone
+0.500000
+texture vertex
+-1
+0.500000 bone
+vertex 0.500000 = texture -1
+frame texture
+material = texture material vertex material -1 1.0 anim anim -1 anim 0.500000 vertex frame 1.0
+1.0 vertex bone = material -1 vertex 1.0 vertex
+frame vertex
+anim
+bone
+=
+0.500000 material
+material material -1 anim bone material vertex anim material -1 0.500000 -1 frame
+bone frame -1 -1 bone 0.500000 vertex
+frame material
+bone = vertex vertex 1.0 0.500000
+anim
+frame vertex frame
+-1 frame
+vertex texture texture bone vertex 1.0
+= = frame -1 -1 1.0 = -1 anim texture
+anim
+material
+texture
+0.500000 = vertex anim = material
+= -1 bone anim
+bone texture material
+-1 anim
+vertex frame texture
+1.0 -1
+vertex bone = material frame 1.0 frame vertex
+anim 0.500000 vertex anim anim anim
+= vertex bone 1.0
+bone texture material 0.500000
+-1 = frame
+texture -1 vertex anim vertex 1.0
+0.500000 texture
+frame texture vertex frame
+= =
+material 1.0
+vertex
+anim
+anim
+texture 0.500000 -1 anim texture material vertex
+1.0 -1 texture
+anim frame -1 bone
+material
+bone
+1.0 anim anim
+frame material anim 1.0 material
+texture vertex -1 material anim anim texture
+frame material bone =
+= texture frame -1 bone
+= -1
+vertex material
+=
+= 0.500000
+anim material anim
+anim
+vertex material
+1.0 1.0 frame = = vertex
+vertex 1.0 material frame -1 bone
+material
+anim vertex 1.0
+= -1 frame 0.500000
+anim
+bone
+1.0
+vertex -1
+texture
+anim 0.500000
+frame 1.0 bone = anim 0.500000 =
+0.500000 frame 1.0 1.0 -1 = 1.0 -1 anim frame 0.500000
+material bone -1 -1 = 1.0 -1
+-1 -1
+frame
+material
+1.0 1.0 anim 1.0 0.500000 = vertex
+-1 =
\ No newline at end of file
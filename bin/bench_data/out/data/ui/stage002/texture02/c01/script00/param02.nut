@@ -0,0 +1 @@
+0.500000 frame frame material = -1 -1 0.5
\ No newline at end of file
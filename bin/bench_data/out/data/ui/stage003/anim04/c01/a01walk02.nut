@@ -0,0 +1,16 @@
+material
+anim 1.0 material texture frame -1
+material
+1.0
+0.500000 vertex 0.500000 0.500000
+-1 vertex -1
+texture vertex anim 0.500000 0.500000 anim 0.500000
+vertex -1 1.0 material vertex vertex vertex vertex 0.500000 vertex material vertex texture
+anim
+texture
+-1
+vertex texture
+anim material
+anim vertex
+-1
+bone
\ No newline at end of file
@@ -0,0 +1,46 @@
+frame
+anim material -1
+frame
+material
+material
+bone frame texture
+anim texture
+1.0 vertex bone
+= 0.500000 frame frame
+= vertex frame texture 1.0 vertex anim
+anim = frame vertex vertex -1 0.500000 material vertex 1.0 texture -1 anim texture
+material frame vertex 1.0 = material anim =
+0.500000 =
+material 0.500000 = vertex anim vertex frame = anim frame vertex
+material 1.0 0.500000 =
+0.500000
+1.0 material anim
+frame
+=
+= anim = 1.0
+texture anim texture -1
+1.0 -1
+bone vertex 1.0
+bone material
+1.0
+1.0 texture material
+= frame bone texture material material anim =
+material vertex material 1.0 texture texture material 0.500000 = 0.500000 anim material -1 1.0 frame anim
+bone = 0.500000 material
+-1
+bone texture material vertex bone
+0.500000 texture bone anim 1.0 1.0 0.500000 -1 texture anim -1 vertex bone material
+bone 1.0
+material texture vertex vertex 0.500000 -1 material = material texture 1.0
+bone material
+bone material
+material -1 frame
+0.500000 -1 material
+anim bone bone = frame texture
+bone
+anim frame = anim
+-1 vertex frame texture 1.0
+frame texture
+bone 1.0
+texture -1 =
+1.
\ No newline at end of file
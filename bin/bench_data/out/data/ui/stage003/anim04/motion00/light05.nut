@@ -0,0 +1,82 @@
+-1 vertex texture = -1
+0.500000 anim -1 frame texture bone frame -1 anim vertex
+material vertex
+1.0 vertex bone frame anim 1.0 material
+= = 1.0
+texture texture -1 bone
+material
+vertex
+frame
+anim vertex
+= 0.500000 texture texture texture texture
+bone bone anim
+1.0 -1
+vertex
+vertex frame = texture bone
+vertex material
+0.500000
+= 0.500000
+=
+-1
+texture = frame =
+texture
+1.0 material anim 0.500000 bone
+texture anim material = 1.0 vertex material
+texture
+texture
+0.500000 anim = vertex 1.0 =
+vertex bone
+frame vertex vertex frame -1 anim material
+-1 = bone bone -1 0.500000
+material
+= material bone bone 0.500000 0.500000 bone anim material 0.500000 anim anim frame = 0.500000 anim frame = anim vertex 0.500000 = 0.500000 texture -1 frame = -1 bone bone = vertex -1
+anim frame
+0.500000 0.500000 vertex anim texture
+vertex frame -1 material vertex
+vertex 0.500000 texture
+= texture material anim material material = vertex
+material material texture vertex material texture 0.500000 bone
+material
+vertex 1.0 material anim frame bone -1 = -1
+1.0
+0.500000 material anim 1.0 -1 bone 0.500000 =
+vertex 0.500000
+bone vertex 1.0
+0.500000 0.500000 1.0 1.0 texture = frame bone texture anim material material
+1.0
+-1 1.0 texture -1 bone 1.0 -1 bone vertex material anim = anim material
+1.0 -1 vertex -1 anim 0.500000
+frame
+material frame
+material
+anim
+vertex = =
+-1
+1.0 -1 1.0 =
+material bone 1.0 material 1.0 material
+1.0 vertex frame vertex anim frame anim anim -1 bone
+material frame vertex vertex bone anim texture material 1.0 = material
+1.0 anim -1 bone
+bone anim
+-1 1.0 texture
+texture frame material
+frame vertex -1
+vertex bone vertex
+material
+vertex 0.500000 bone
+-1 material material -1 anim 1.0 bone
+1.0
+frame
+anim = anim anim
+texture
+anim
+bone texture
+texture 1.0 frame
+-1
+frame bone 0.500000 texture texture =
+-1
+0.500000 bone material texture texture
+material bone -1 material 0.500000 material 0.500000
+1.0
+frame bone vertex -1 vertex
+texture frame 0.500000 = 1.0 
\ No newline at end of file
@@ -0,0 +1,2 @@
+vertex
+vertex -1 texture frame bone vertex vertex frame 1.0 1.0 frame 
\ No newline at end of file
@@ -0,0 +1,75 @@
+anim anim -1 anim 0.500000 bone material = -1 = material
+=
+bone 0.500000
+bone vertex bone bone -1 texture 0.500000
+vertex 0.500000 bone bone
+-1
+-1 material
+1.0 anim material
+1.0 1.0 texture frame texture frame anim bone bone 0.500000 -1
+texture texture frame texture
+vertex material
+0.500000
+frame = -1 bone -1 anim
+material = frame texture vertex 0.500000 0.500000 =
+= texture = texture 0.500000
+1.0
+bone
+texture
+anim -1 = bone vertex -1
+= vertex 1.0 vertex -1 anim vertex frame bone frame vertex frame 0.500000 texture
+texture 0.500000 vertex frame frame
+bone vertex texture texture 1.0
+texture
+vertex bone
+vertex vertex anim 1.0
+texture frame frame material
+1.0 -1 anim frame
+0.500000
+anim bone
+frame 0.500000 texture bone vertex
+material
+-1 1.0
+vertex
+material frame texture texture
+0.500000 = anim = frame 1.0 frame -1
+1.0
+texture -1 =
+0.500000 anim -1 frame
+=
+1.0 -1 bone material material
+vertex material
+frame -1 vertex frame vertex vertex vertex
+texture
+-1
+= frame material frame
+anim
+frame
+-1 1.0 bone
+bone =
+-1 vertex bone
+texture
+0.500000 material
+1.0 -1 -1 bone = = anim vertex
+texture 0.500000 = vertex -1
+frame
+=
+1.0
+0.500000
+material texture bone anim
+anim anim bone frame
+=
+material anim anim 0.500000 material vertex frame anim material frame = 1.0 1.0 anim
+-1 -1 texture
+anim 0.500000 1.0 anim anim
+-1 vertex
+material material bone
+= bone
+frame anim
+= material -1 bone 1.0
+=
+1.0 material 1.0 anim
+material frame frame =
+= 1.0 = bone bone texture texture texture
+bone vertex 0.500000 bone
+= 1.0 frame anim vertex bone
\ No newline at end of file
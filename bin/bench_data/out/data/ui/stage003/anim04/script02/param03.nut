@@ -0,0 +1,17 @@
+material vertex
+= texture bone vertex bone = 0.500000
+bone
+bone 0.500000
+0.500000 texture
+texture 1.0
+vertex -1 1.0 bone vertex 1.0 0.500000 frame material = anim 0.500000 anim anim anim
+frame 1.0 material
+material -1 frame -1
+frame frame
+=
+bone
+bone anim = material = = material
+0.500000 anim vertex material -1 -1
+texture frame vertex vertex material
+vertex = 1.0 frame anim material 0.500000 anim 1.0
+vertex anim frame texture -1 1.0 vertex vertex anim bone material bone v
\ No newline at end of file
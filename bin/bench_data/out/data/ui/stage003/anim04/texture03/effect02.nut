@@ -0,0 +1,78 @@
+texture texture bone
+frame frame
+0.500000 0.500000 anim
+0.500000
+texture
+material -1
+1.0
+1.0
+1.0 vertex -1 vertex bone
+bone anim frame
+frame 1.0 bone 0.500000
+0.500000
+0.500000
+= material = bone
+0.500000 frame
+frame texture texture vertex texture -1 material
+= bone frame vertex = vertex
+bone 0.500000 =
+1.0 =
+-1
+bone frame
+-1
+vertex texture anim
+frame vertex frame bone 1.0
+1.0
+bone frame
+=
+anim 0.500000 texture bone 0.500000 vertex vertex 0.500000 -1 vertex
+material =
+1.0 frame 0.500000
+texture anim = texture 1.0 material material = texture = = vertex frame
+bone
+material bone 1.0
+0.500000 vertex texture
+material
+0.500000 frame 1.0
+anim bone -1
+bone
+0.500000 -1 material
+texture
+material -1
+vertex vertex 0.500000 anim bone anim =
+frame
+texture
+1.0 0.500000 vertex texture 1.0
+frame
+bone material anim bone = frame material
+anim bone anim
+material bone -1
+bone
+bone material texture
+vertex anim 1.0 anim material frame vertex bone texture = 0.500000 bone
+anim
+-1 vertex = -1 texture vertex vertex = bone vertex
+-1 texture 1.0 -1
+texture
+bone vertex
+bone = -1 -1 vertex vertex frame -1
+bone material texture bone 0.500000 anim frame
+texture
+frame = texture vertex -1 0.500000 1.0 bone 0.500000 0.500000 material frame anim texture vertex texture bone frame bone -1
+= 0.500000 bone = material frame texture frame texture -1 frame vertex 0.500000 -1
+1.0 =
+1.0
+1.0 1.0 vertex =
+vertex texture frame
+0.500000 1.0 -1
+= -1 bone
+vertex bone frame bone -1 anim
+vertex
+1.0
+0.500000 material 0.500000 = material bone frame
+texture = bone
+-1
+1.0 anim vertex
+0.500000 = -1 texture texture frame
+vertex
+vertex text
\ No newline at end of file
@@ -0,0 +1,11 @@
+frame
+vertex vertex 1.0 anim texture 1.0 texture bone
+vertex bone anim frame -1
+material
+bone
+material anim 0.500000
+frame 1.0 =
+material 1.0
+frame texture material vertex material 0.500000
+anim -1 material material bone 1.0 -1 -1
+bone 0.500000 bone materia
\ No newline at end of file
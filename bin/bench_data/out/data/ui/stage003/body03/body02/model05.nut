@@ -0,0 +1,11 @@
+anim anim bone material 1.0
+=
+frame material bone -1 material
+material frame 1.0
+1.0 anim -1 = frame
+texture texture -1 0.500000
+1.0 texture bone
+bone
+frame material texture
+= material
+anim mater
\ No newline at end of file
@@ -0,0 +1,3 @@
+1.0 vertex material bone bone
+texture anim
+-1 material ver
\ No newline at end of file
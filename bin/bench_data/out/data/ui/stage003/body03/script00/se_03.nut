@@ -0,0 +1,11 @@
+=
+= 1.0 1.0 texture anim 0.500000 -1 1.0 frame anim -1
+vertex
+frame 0.500000 texture bone anim frame -1 1.0 bone frame vertex material anim 0.500000
+bone -1
+1.0 bone
+1.0
+vertex
+texture vertex 0.500000 1.0
+= -1 texture 0.500000 texture bone vertex bone
+a
\ No newline at end of file
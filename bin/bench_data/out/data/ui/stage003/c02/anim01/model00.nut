@@ -0,0 +1,3 @@
+1.0 1.0 vertex
+frame =
+-1 frame 0.500000 1.0 fr
\ No newline at end of file
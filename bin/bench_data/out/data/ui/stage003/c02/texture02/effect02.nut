@@ -0,0 +1,7 @@
+material texture vertex
+texture =
+texture 0.500000 vertex 1.0
+vertex = 0.500000 bone anim anim bone
+= material 0.500000 vertex bone bone material
+frame anim material material
+1.0 
\ No newline at end of file
@@ -0,0 +1,108 @@
+vertex anim anim 1.0 1.0 anim 1.0 bone
+material frame -1 texture material
+1.0
+material texture anim bone texture -1 material texture
+material
+texture material texture
+anim texture texture = vertex anim
+0.500000
+bone 1.0 texture 1.0
+material
+anim 1.0 frame bone 1.0 -1 anim 0.500000
+material vertex frame
+bone
+material 1.0 1.0 bone bone = anim
+texture -1 0.500000 vertex material bone material anim
+texture anim
+-1 0.500000 anim
+= texture
+frame -1 0.500000 bone bone
+-1
+frame frame material
+material 1.0
+bone frame 0.500000 =
+bone bone anim
+0.500000 -1 = vertex frame =
+texture bone
+0.500000 material frame
+texture vertex
+= = bone
+anim 1.0 = -1 0.500000 = 1.0 -1
+texture
+texture texture frame vertex 1.0 bone material 1.0 material vertex
+texture texture vertex 0.500000 vertex bone frame
+1.0 anim = bone bone 0.500000 vertex frame anim material = -1 0.500000 material bone -1
+material 1.0
+vertex frame frame texture texture -1
+0.500000 vertex anim anim bone 1.0 texture anim
+vertex 1.0 material 0.500000 -1 1.0 material -1 bone
+0.500000 1.0 0.500000 = 1.0 0.500000 material
+0.500000 -1 1.0
+= 0.500000 texture 1.0 frame 0.500000 1.0 bone
+bone 1.0 0.500000
+bone =
+frame
+texture texture
+frame anim -1 1.0 anim frame -1 material
+anim bone 1.0 0.500000 material material 1.0 vertex
+anim
+-1 -1 texture
+-1 vertex material frame anim
+texture anim anim anim material = vertex
+1.0
+anim
+0.500000 0.500000
+bone vertex frame 0.500000
+vertex
+vertex
+frame
+frame material -1
+= bone -1 anim anim -1 -1 frame frame
+material =
+0.500000 anim bone texture
+0.500000 texture
+anim texture material
+-1 vertex texture
+bone vertex
+anim texture = -1 anim frame
+0.500000 1.0 vertex
+-1
+anim texture
+texture -1
+bone 1.0 anim bone 1.0 frame texture 1.0 -1 vertex texture anim vertex 0.500000 bone 0.500000 1.0 -1
+material -1 -1
+-1 bone bone
+material
+bone 0.500000 anim
+1.0 frame
+-1 frame frame -1
+anim vertex 0.500000
+0.500000 bone bone
+material vertex anim material =
+material
+0.500000 vertex
+material
+vertex
+bone frame vertex 1.0
+-1
+material
+material anim bone texture
+1.0 frame
+anim
+bone 1.0
+vertex frame bone bone anim =
+vertex =
+anim material
+material anim -1 anim vertex 1.0 -1
+material 0.500000 0.500000 -1 = -1 frame bone 1.0 1.0 anim material material texture 1.0
+= 1.0
+1.0
+0.500000 bone
+1.0
+1.0 0.500000 material 1.0 anim vertex
+frame -1
+bone =
+material bone material
+= material bone frame frame
+-1 = -1 =
+0.500000 bo
\ No newline at end of file
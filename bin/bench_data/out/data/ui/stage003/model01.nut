@@ -0,0 +1,6 @@
+texture 0.500000
+vertex vertex material
+anim texture texture anim
+texture
+0.500000 bone material vertex material
+= 0.500000 -1 = = anim materia
\ No newline at end of file
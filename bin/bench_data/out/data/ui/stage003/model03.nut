@@ -0,0 +1,9 @@
+= vertex anim
+vertex
+0.500000 -1 0.500000
+= vertex = anim material -1 -1 = 0.500000 bone texture
+0.500000 1.0 vertex 0.500000 0.500000
+1.0 frame 1.0
+=
+-1 texture anim = bone
+1.0
\ No newline at end of file
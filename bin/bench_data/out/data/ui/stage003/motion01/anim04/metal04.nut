@@ -0,0 +1,278 @@
+0.500000 = texture bone frame
+0.500000 texture
+bone
+texture frame 1.0 texture bone
+= -1 -1 texture =
+1.0 0.500000 bone frame anim -1 = bone
+texture -1 frame frame anim -1 vertex anim vertex
+bone -1
+0.500000 -1 frame material anim
+1.0 vertex =
+= vertex texture 0.500000 vertex 1.0 frame
+0.500000 material bone texture
+= 0.500000 anim
+= -1 0.500000 material
+bone
+anim material vertex frame anim
+0.500000 0.500000 frame 1.0 1.0 bone anim anim 0.500000
+anim bone 1.0 -1 material = 1.0 anim 1.0 material bone 0.500000
+bone = bone frame material
+texture vertex
+material 1.0 0.500000 frame bone anim material
+material material
+anim =
+anim anim bone
+anim
+texture anim vertex -1 0.500000 bone material
+frame
+material
+bone texture
+frame -1 anim
+=
+material frame 0.500000
+bone material
+1.0
+bone = 1.0
+material = 1.0
+0.500000 vertex texture
+material
+1.0 frame
+anim
+anim = anim -1 frame texture material bone texture material 0.500000 anim = = anim 0.500000 -1
+bone
+vertex anim 0.500000 material = -1 0.500000 frame
+vertex = 1.0 0.500000 = bone =
+1.0
+bone bone frame vertex
+material -1
+bone 1.0 vertex
+material anim 0.500000
+bone 0.500000 vertex bone 1.0 texture vertex anim 1.0 frame material texture 1.0 bone bone
+-1
+bone vertex anim texture
+material frame -1
+anim
+1.0 material
+0.500000 -1 1.0 texture -1 0.500000
+frame 0.500000
+material
+0.500000 anim frame anim vertex frame material 1.0 bone = bone
+texture anim frame bone bone 1.0 1.0 vertex anim bone
+anim -1 texture -1 vertex material bone anim
+frame anim
+1.0 anim 1.0
+bone material bone frame vertex texture vertex 0.500000 texture =
+-1 anim material texture
+anim
+= -1
+texture = bone material bone texture
+material vertex 0.500000 -1 bone texture
+=
+0.500000 texture anim = 1.0 1.0
+-1
+vertex frame
+vertex
+material frame
+1.0
+1.0 material
+frame
+texture = vertex 0.500000 vertex -1 bone vertex texture texture vertex =
+-1 texture
+anim anim material anim bone
+1.0 anim 1.0
+= anim anim =
+1.0
+0.500000 0.500000
+-1 vertex = -1 anim = = frame frame
+anim vertex
+1.0 =
+anim bone 0.500000 frame -1 0.500000
+texture
+anim
+0.500000 material
+0.500000 texture bone
+texture -1 frame 0.500000 material 0.500000 -1 material anim
+= material 1.0 0.500000 anim
+1.0 texture 0.500000
+bone anim frame vertex = = 0.500000 1.0 frame frame = frame
+texture 0.500000 = material anim material
+material bone
+texture bone = texture material
+-1 anim
+0.500000 -1
+0.500000 1.0 texture texture 1.0 vertex material texture frame
+1.0 material frame
+anim 0.500000 bone vertex
+vertex bone
+vertex anim bone material -1 -1 texture
+frame material 1.0 1.0 material = bone frame frame
+= texture bone
+1.0 texture material
+-1 anim anim bone 1.0 1.0
+0.500000 bone
+anim -1
+frame
+frame
+texture 0.500000 0.500000 material frame 1.0 frame anim
+bone
+material 0.500000 0.500000 texture texture 1.0 0.500000 material vertex texture
+vertex = frame anim -1 1.0 bone anim
+= bone anim 0.500000
+vertex bone vertex = texture frame anim vertex texture
+anim
+material anim texture -1
+0.500000 frame
+-1 = =
+vertex =
+texture bone =
+anim -1 1.0 material
+material = 1.0 frame 0.500000 bone -1 =
+vertex
+frame
+1.0 anim
+anim
+anim = bone
+-1 material texture anim frame 0.500000 bone anim vertex 0.500000 anim texture = -1 1.0 0.500000 bone 0.500000
+1.0 texture anim -1 0.500000 texture
+vertex 0.500000 0.500000 -1
+vertex material =
+texture bone
+bone texture = 1.0 vertex texture -1
+bone
+frame bone bone -1
+1.0 -1
+vertex
+frame frame bone
+texture 1.0
+-1 -1 frame anim
+= 0.500000
+bone bone
+frame 0.500000 vertex anim
+bone material
+1.0 texture material vertex vertex
+bone -1 0.500000
+anim
+material frame = anim material -1
+0.500000 frame material
+material = frame texture material frame material texture 1.0 1.0 frame
+1.0 -1
+frame
+vertex
+texture anim bone
+material = anim
+frame -1 texture vertex = = anim 1.0
+-1 bone
+anim
+= -1 frame
+-1 material frame
+material
+-1 material
+-1 1.0 anim = -1 bone anim bone
+bone material texture vertex material 0.500000 0.500000 =
+-1 anim = texture bone
+frame
+0.500000 bone material 0.500000
+bone anim bone 0.500000 bone 1.0
+vertex -1 vertex frame =
+1.0 = anim material
+-1 anim material
+bone texture bone anim frame vertex vertex
+vertex 1.0 material texture anim 1.0 bone texture
+anim vertex texture
+bone anim 1.0 =
+frame bone material
+frame bone =
+anim 1.0 bone
+bone vertex frame
+1.0 1.0 1.0 bone 0.500000 =
+bone = anim bone =
+anim 0.500000 bone -1
+0.500000 vertex vertex 1.0 = texture
+0.500000 frame
+material material material anim frame
+material -1 vertex anim material =
+texture frame bone vertex frame = vertex texture
+vertex -1 vertex anim 0.500000 -1
+material texture 0.500000 material -1
+0.500000 texture
+frame vertex anim vertex 1.0 material
+material bone texture texture
+frame texture frame
+texture -1 -1 frame bone 0.500000
+1.0 0.500000 =
+= -1 vertex -1
+bone
+1.0 bone frame vertex frame bone
+1.0 frame 1.0 0.500000
+anim
+anim texture
+vertex bone 0.500000
+vertex bone
+1.0 vertex 1.0 frame frame bone = 0.500000 texture 1.0 0.500000
+-1 vertex bone vertex vertex anim texture =
+material 0.500000
+-1 0.500000 vertex
+frame =
+0.500000 anim 1.0 vertex
+= vertex texture
+texture -1 texture material vertex texture material
+vertex texture anim = -1 frame anim
+-1 texture
+1.0
+bone = -1
+material
+1.0
+bone texture 1.0 = 1.0 frame texture texture
+0.500000 0.500000 vertex texture
+vertex 0.500000
+= material
+frame
+-1 material 0.500000
+-1 -1 0.500000
+texture
+0.500000 = -1
+bone 1.0 1.0 = = bone
+material anim 1.0 1.0 0.500000 frame material material material 1.0 -1 = texture
+frame bone bone
+-1 anim -1
+frame material 1.0 anim
+0.500000 -1 bone material
+frame frame texture -1 0.500000 material
+frame anim frame =
+-1 vertex material 1.0 vertex -1
+material
+texture 0.500000
+frame -1 bone
+1.0 = anim 1.0
+1.0 1.0 frame 0.500000 0.500000 0.500000 anim 0.500000 frame 0.500000 = = = = frame vertex anim frame
+frame = bone material anim
+bone anim vertex
+anim 1.0 1.0 bone 0.500000 texture 1.0 0.500000
+texture -1 material vertex
+texture material frame anim bone -1 vertex -1
+frame texture 0.500000 -1 material 1.0 texture
+frame anim = frame frame anim 0.500000
+vertex bone texture
+1.0 vertex
+material
+0.500000
+0.500000 texture texture 1.0
+frame anim vertex frame material frame
+-1 anim 1.0 0.500000 = =
+material
+0.500000 =
+0.500000 texture vertex bone -1 1.0 vertex anim texture
+1.0 anim
+1.0 -1 texture
+anim material bone
+anim anim vertex 1.0
+=
+bone bone =
+anim
+material = 0.500000 texture
+material frame frame -1
+frame vertex bone material texture bone vertex material vertex frame
+anim bone = 1.0
+-1 material bone anim anim vertex bone
+0.500000
+material bone bone 
\ No newline at end of file
@@ -0,0 +1,9 @@
+texture bone -1 frame anim -1 =
+vertex texture
+texture anim vertex vertex 0.500000
+vertex -1 1.0 -1
+-1 texture texture texture
+texture vertex 0.500000 -1
+anim texture -1 1.0 texture
+0.500000 texture material frame =
+vertex -1 
\ No newline at end of file
@@ -0,0 +1,190 @@
+anim = material anim 0.500000 bone 1.0 = -1 1.0 -1
+anim 0.500000
+-1 1.0 = 0.500000 frame
+1.0 bone frame vertex
+bone vertex vertex vertex vertex vertex frame = vertex vertex anim anim
+= = bone bone 0.500000 frame 1.0 =
+texture anim texture texture -1 frame =
+material -1 vertex 0.500000
+bone bone frame 1.0
+vertex bone vertex 1.0 =
+texture frame texture 1.0 bone material -1 =
+-1 0.500000
+texture
+frame frame
+texture -1 0.500000 frame texture
+material vertex -1 frame 1.0
+1.0 texture anim 0.500000 = frame = anim
+bone texture =
+bone
+vertex 0.500000 vertex texture texture 1.0
+vertex 0.500000
+anim anim
+anim frame material frame -1 vertex -1 -1 frame vertex vertex 1.0 texture
+material
+frame 0.500000 frame frame
+=
+anim
+vertex 1.0 vertex vertex frame
+-1
+vertex anim vertex anim 0.500000
+texture 0.500000 anim vertex
+anim frame anim anim texture
+anim
+bone material anim frame 1.0 anim
+material bone 1.0 material vertex bone
+bone material material bone 1.0 0.500000 0.500000
+texture texture frame =
+= bone bone frame
+0.500000 -1
+vertex material frame vertex 1.0 =
+material anim
+texture
+frame
+= 0.500000
+vertex
+frame -1 -1
+= vertex texture 1.0 -1
+frame vertex 0.500000 texture vertex 1.0 vertex
+vertex anim 0.500000 texture anim vertex
+1.0 bone
+bone material 1.0 anim bone 0.500000
+vertex = anim
+material bone material texture = vertex -1 material 0.500000 1.0 frame texture bone 1.0 0.500000 bone
+= = = 0.500000 -1
+material material
+0.500000 frame anim -1 anim bone anim
+vertex texture
+anim vertex -1 =
+texture 1.0
+material
+0.500000 1.0
+=
+texture
+bone -1 frame 1.0 -1
+bone texture anim 0.500000
+vertex = = -1 frame
+vertex vertex anim
+material 0.500000 material 1.0 anim = -1 anim material 0.500000 = vertex anim -1 anim =
+0.500000
+0.500000 frame material material vertex 0.500000
+frame -1
+0.500000 material texture material -1 anim frame 1.0
+anim
+=
+1.0
+= = texture
+bone
+frame
+texture material
+bone 1.0 bone material material
+frame anim texture bone 0.500000 bone bone frame 0.500000 texture frame = anim = material vertex vertex material vertex vertex 1.0 bone = bone bone
+texture
+= frame -1 texture 1.0 0.500000
+-1
+-1 0.500000 material = 1.0 bone
+1.0 bone
+-1 bone frame bone material =
+1.0
+texture frame frame = material
+bone = frame 1.0
+anim texture
+-1
+= anim
+anim
+material vertex
+anim bone material vertex 0.500000
+vertex = = 0.500000 texture texture frame -1 1.0
+bone vertex material
+bone anim frame 1.0 = texture anim -1 vertex 1.0 -1 vertex 1.0 texture material bone bone anim
+bone vertex = -1 bone anim anim
+0.500000 bone 0.500000 frame vertex
+-1 bone 0.500000 1.0 vertex
+-1 -1 0.500000 1.0 material
+= frame 0.500000 = 1.0 0.500000
+0.500000 vertex vertex frame
+anim anim
+1.0 anim bone
+frame anim
+0.500000 material frame
+= vertex -1 texture
+-1
+material = vertex =
+anim -1 0.500000 anim anim 1.0 vertex texture 0.500000 anim
+1.0 anim 1.0 frame frame
+bone
+texture
+1.0 frame -1 1.0 bone texture 0.500000 vertex anim 0.500000 texture material -1 material
+texture bone vertex -1 0.500000
+vertex material 0.500000 texture texture 0.500000 frame 0.500000 -1 -1 frame anim anim material
+= -1 material bone anim =
+bone frame anim -1
+1.0 1.0
+0.500000 0.500000 = texture -1 = 0.500000 anim = anim anim
+0.500000 vertex bone 0.500000 0.500000 =
+vertex vertex
+texture 0.500000
+vertex -1 bone texture -1 material 0.500000
+vertex 0.500000
+frame frame vertex vertex bone bone texture 1.0 = material
+-1 = frame material
+texture 0.500000 frame = 0.500000 -1 =
+material frame
+= bone
+frame
+vertex = vertex 0.500000 = vertex anim bone
+frame
+1.0
+anim
+texture 1.0 anim texture frame = texture vertex vertex
+anim
+= frame vertex = -1 frame 1.0 = anim bone texture
+-1 0.500000 -1 -1
+anim -1 bone bone
+1.0 vertex
+= = 0.500000 vertex -1 bone -1 bone bone anim bone = -1 vertex texture -1 0.500000 texture
+0.500000 frame 1.0 bone -1
+anim bone material
+0.500000 = anim
+vertex 1.0 -1
+anim -1 = anim vertex material vertex bone anim -1 frame
+vertex -1 0.500000 0.500000 frame
+0.500000 -1 frame frame material
+texture
+vertex anim vertex -1 -1 -1
+1.0
+frame material bone 1.0 -1 = material
+anim
+= 0.500000 -1 bone bone anim material
+frame frame
+bone
+anim frame vertex vertex material
+anim anim
+texture
+material =
+1.0 material
+0.500000 material 1.0
+1.0 vertex texture 1.0 1.0 0.500000 bone -1
+material = -1 = 0.500000 texture
+1.0 material texture -1 1.0
+-1
+bone bone -1 material -1 material
+anim
+material anim
+bone bone vertex texture 1.0 =
+0.500000 1.0 vertex
+bone
+0.500000 = =
+= material
+material = 0.500000 material
+1.0 anim =
+1.0 1.0
+material
+-1 frame vertex 1.0
+vertex vertex vertex = frame
+-1 texture
+material 0.500000 frame material
+-1 bone vertex -1 anim anim
+-1 bone frame
+bone vertex
+verte
\ No newline at end of file
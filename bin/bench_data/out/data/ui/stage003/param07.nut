@@ -0,0 +1,53 @@
+texture texture
+= vertex texture bone
+0.500000 texture
+= anim frame
+bone vertex -1 vertex material frame -1 material vertex frame =
+frame
+frame material
+-1 0.500000 frame bone bone
+-1 material 1.0 -1 frame material 1.0 1.0 anim bone bone vertex 1.0 material vertex 0.500000
+-1
+frame texture texture 1.0
+frame = 1.0 -1 frame
+1.0 bone -1 anim
+0.500000 -1 1.0 -1 frame 0.500000 = -1 1.0 -1 anim material
+1.0 -1 0.500000 =
+= frame
+vertex texture
+frame material 1.0 1.0 material =
+1.0 -1 vertex bone anim
+vertex 1.0 1.0 bone 0.500000 vertex 1.0 material 0.500000
+0.500000 = -1 texture material material anim = 1.0
+1.0 0.500000
+frame
+bone frame 1.0 texture
+texture 1.0 material
+bone anim
+material anim
+= 0.500000 bone material frame vertex =
+bone 1.0 vertex =
+bone
+material anim = bone = -1 -1 0.500000 texture bone
+1.0 texture texture material 0.500000
+bone 0.500000
+bone frame
+frame
+1.0 0.500000 material frame vertex -1 = 0.500000 1.0 frame bone vertex vertex material
+frame material texture 0.500000 anim vertex frame
+texture texture texture
+frame material = -1 = = = = anim texture
+bone = material frame 0.500000
+bone 0.500000 frame frame texture
+material = anim
+texture
+=
+1.0 frame 1.0 = frame =
+bone
+-1 -1 material anim
+0.500000 material
+1.0 material
+texture frame vertex
+anim
+texture
+0.500000 material bone 
\ No newline at end of file
@@ -0,0 +1,503 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ds.h"
+
+#include "benchgen.h"
+#include "config.h"
+#include "extract.h"
+#include "filetree.h"
+#include "ls.h"
+#include "mem.h"
+#include "patchlist.h"
+#include "rf.h"
+#include "selection.h"
+
+// Microbenchmarks over a generated data set (see benchgen.h), so the hot
+// paths can be measured without the game files. Allocations are counted
+// by wrapping the allocator at link time (see the `bench` target).
+//
+// Baselines are plain `name\tns\tallocs\tbytes` lines. Anything slower
+// than the baseline by more than the threshold, or allocating more, is a
+// regression and makes the run exit non-zero.
+
+#define BENCH_DEFAULT_FILES (20000)
+#define BENCH_DEFAULT_ITERATIONS (5)
+#define BENCH_DEFAULT_THRESHOLD (15.0)
+#define BENCH_MIN_SECONDS (0.5)
+#define BENCH_DEFAULT_DIR "bin/bench_data"
+
+//// Allocation counting
+
+static uint64_t s_allocCount = 0;
+static uint64_t s_allocBytes = 0;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t num, size_t size);
+void* __real_realloc(void *ptr, size_t size);
+char* __real_strdup(const char *str);
+
+static void bench_countAlloc(size_t size)
+{
+    __atomic_add_fetch(&s_allocCount, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&s_allocBytes, size, __ATOMIC_RELAXED);
+}
+
+void* __wrap_malloc(size_t size)
+{
+    bench_countAlloc(size);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t num, size_t size)
+{
+    bench_countAlloc(num * size);
+    return __real_calloc(num, size);
+}
+
+void* __wrap_realloc(void *ptr, size_t size)
+{
+    bench_countAlloc(size);
+    return __real_realloc(ptr, size);
+}
+
+char* __wrap_strdup(const char *str)
+{
+    bench_countAlloc(strlen(str) + 1);
+    return __real_strdup(str);
+}
+
+//// Benchmarks
+
+typedef struct {
+    char dir[2048];
+    benchgen_stats_t stats;
+
+    char rfFilename[4096];
+    char patchlistFilename[4096];
+    char lsFilename[4096];
+    char outDir[4096];
+
+    // long-lived inputs, made once
+    filetree_node_t *tree; // with paths
+    resource_t *resources;
+    filetree_flatcache_t flatCache;
+
+    // per-iteration scratch
+    void *result;
+    int stdoutFd;
+} bench_ctx_t;
+
+typedef struct {
+    const char *name;
+    void (*setup)(bench_ctx_t *ctx); // untimed, before each iteration
+    void (*run)(bench_ctx_t *ctx);
+    void (*teardown)(bench_ctx_t *ctx); // untimed, after each iteration
+} bench_t;
+
+typedef struct {
+    char *key;
+    double ns;
+    double allocs;
+    double bytes;
+} bench_result_t;
+
+static double bench_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_clearPaths(filetree_node_t *node)
+{
+    mem_free(node->path);
+    node->path = NULL;
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        bench_clearPaths(node->children[i]);
+    }
+}
+
+static void bench_freeResult(bench_ctx_t *ctx)
+{
+    freeResources((resource_t*)ctx->result);
+    ctx->result = NULL;
+}
+
+static void bench_freeTree(bench_ctx_t *ctx)
+{
+    filetree_free((filetree_node_t*)ctx->result);
+    ctx->result = NULL;
+}
+
+static void bench_loadRF(bench_ctx_t *ctx)
+{
+    ctx->result = loadResourcesFromRFFile(ctx->rfFilename);
+}
+
+static void bench_treeFromRF(bench_ctx_t *ctx)
+{
+    ctx->result = filetree_fromRFFile(ctx->rfFilename);
+}
+
+static void bench_clearTreePaths(bench_ctx_t *ctx)
+{
+    bench_clearPaths(ctx->tree);
+}
+
+static void bench_fillTreePaths(bench_ctx_t *ctx)
+{
+    fillTreePaths(ctx->tree);
+}
+
+static void bench_flatten(bench_ctx_t *ctx)
+{
+    ctx->result = filetree_flattenToResources(ctx->tree);
+}
+
+// As after a single edit: one leaf, as deep as it gets, has changed since
+// the last flatten.
+static void bench_touchLeaf(bench_ctx_t *ctx)
+{
+    if (!ctx->flatCache.resources) {
+        filetree_flattenCached(ctx->tree, &ctx->flatCache);
+    }
+
+    filetree_node_t *node = ctx->tree;
+    while (stbds_arrlenu(node->children)) {
+        node = node->children[stbds_arrlenu(node->children) - 1];
+    }
+    filetree_touch(node);
+}
+
+static void bench_flattenCached(bench_ctx_t *ctx)
+{
+    filetree_flattenCached(ctx->tree, &ctx->flatCache);
+}
+
+// Deep enough to exercise `**` and pruning under every other category.
+static void bench_select(bench_ctx_t *ctx)
+{
+    char *pattern = "fighter/*/model*/**/*.nut";
+    selection_t *sel = selection_compile(&pattern, 1);
+    ctx->result = selection_run(sel, ctx->tree);
+    selection_free(sel);
+}
+
+static void bench_freeSelection(bench_ctx_t *ctx)
+{
+    stbds_arrfree(ctx->result);
+    ctx->result = NULL;
+}
+
+static void bench_saveRF(bench_ctx_t *ctx)
+{
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s/resource(out)", ctx->dir);
+    saveResourcesToRFFile(ctx->resources, filename);
+}
+
+static void bench_loadLs(bench_ctx_t *ctx)
+{
+    ctx->result = ls_load(ctx->lsFilename);
+}
+
+static void bench_freeLs(bench_ctx_t *ctx)
+{
+    ls_free((ls_t*)ctx->result);
+    ctx->result = NULL;
+}
+
+static void bench_loadPatchlist(bench_ctx_t *ctx)
+{
+    ctx->result = patchlist_loadFromFile(ctx->patchlistFilename);
+}
+
+static void bench_freePatchlist(bench_ctx_t *ctx)
+{
+    patchlist_free((patchlist_t*)ctx->result);
+    ctx->result = NULL;
+}
+
+static void bench_savePatchlist(bench_ctx_t *ctx)
+{
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s/patchlist(out)", ctx->dir);
+    patchlist_saveToFile((patchlist_t*)ctx->result, filename);
+}
+
+// NOTE: extraction logs every file; that's not what's being measured.
+static void bench_muteStdout(bench_ctx_t *ctx)
+{
+    fflush(stdout);
+    ctx->stdoutFd = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    close(devNull);
+}
+
+static void bench_unmuteStdout(bench_ctx_t *ctx)
+{
+    fflush(stdout);
+    dup2(ctx->stdoutFd, STDOUT_FILENO);
+    close(ctx->stdoutFd);
+}
+
+// The table's own root sits under the tree's (see filetree_fromRFFile).
+static void bench_extract(bench_ctx_t *ctx)
+{
+    extractNodeToFile(ctx->tree->children[0], NULL);
+}
+
+static bench_t s_benches[] = {
+    { "rf_load", NULL, bench_loadRF, bench_freeResult },
+    { "filetree_fromRFFile", NULL, bench_treeFromRF, bench_freeTree },
+    { "fillTreePaths", bench_clearTreePaths, bench_fillTreePaths, NULL },
+    { "filetree_flattenToResources", NULL, bench_flatten, bench_freeResult },
+    { "filetree_flattenCached", bench_touchLeaf, bench_flattenCached, NULL },
+    { "selection_run", NULL, bench_select, bench_freeSelection },
+    { "rf_save", NULL, bench_saveRF, NULL },
+    { "ls_load", NULL, bench_loadLs, bench_freeLs },
+    { "patchlist_load", NULL, bench_loadPatchlist, bench_freePatchlist },
+    { "patchlist_save", bench_loadPatchlist, bench_savePatchlist, bench_freePatchlist },
+    { "extract", bench_muteStdout, bench_extract, bench_unmuteStdout },
+};
+
+// Best time over at least `iterations` runs, and enough runs to fill
+// BENCH_MIN_SECONDS; the minimum is what's steady enough to compare
+// against a baseline. Allocations come from the last run, as they don't
+// vary between runs.
+static bench_result_t bench_measure(bench_t *bench, bench_ctx_t *ctx, int iterations)
+{
+    bench_result_t result = { 0 };
+    result.key = (char*)bench->name;
+    result.ns = -1;
+
+    double total = 0;
+    for (int i = 0; i < iterations || total < BENCH_MIN_SECONDS * 1e9; ++i) {
+        if (bench->setup) {
+            bench->setup(ctx);
+        }
+
+        uint64_t allocCount = __atomic_load_n(&s_allocCount, __ATOMIC_RELAXED);
+        uint64_t allocBytes = __atomic_load_n(&s_allocBytes, __ATOMIC_RELAXED);
+        double start = bench_now();
+
+        bench->run(ctx);
+
+        double elapsed = bench_now() - start;
+        result.allocs = __atomic_load_n(&s_allocCount, __ATOMIC_RELAXED) - allocCount;
+        result.bytes = __atomic_load_n(&s_allocBytes, __ATOMIC_RELAXED) - allocBytes;
+
+        if (bench->teardown) {
+            bench->teardown(ctx);
+        }
+
+        total += elapsed;
+        if (result.ns < 0 || elapsed < result.ns) {
+            result.ns = elapsed;
+        }
+    }
+
+    return result;
+}
+
+static bench_result_t* bench_loadBaseline(const char *filename)
+{
+    bench_result_t *baseline = NULL;
+    sh_new_strdup(baseline);
+
+    FILE *f = fopen(filename, "r");
+    if (!f) {
+        return baseline;
+    }
+
+    char line[512];
+    while (fgets(line, sizeof(line), f)) {
+        char name[256];
+        bench_result_t r = { 0 };
+        if (sscanf(line, "%255[^\t]\t%lf\t%lf\t%lf", name, &r.ns, &r.allocs, &r.bytes) == 4) {
+            r.key = name;
+            stbds_shputs(baseline, r);
+        }
+    }
+
+    fclose(f);
+    return baseline;
+}
+
+static void bench_saveBaseline(const char *filename, bench_result_t *results)
+{
+    FILE *f = fopen(filename, "w");
+    assert(f && "cannot write baseline");
+
+    for (int i = 0; i < stbds_arrlen(results); ++i) {
+        bench_result_t *r = &results[i];
+        fprintf(f, "%s\t%.0f\t%.0f\t%.0f\n", r->key, r->ns, r->allocs, r->bytes);
+    }
+
+    fclose(f);
+}
+
+// Entries/s for the table benches, bytes/s of file data for extraction.
+static void bench_printThroughput(bench_ctx_t *ctx, bench_result_t *r)
+{
+    double seconds = r->ns * 1e-9;
+    if (!strcmp(r->key, "extract")) {
+        printf("%10.1f MB/s ", ctx->stats.uncompressedBytes / seconds / (1 << 20));
+    } else if (!strncmp(r->key, "patchlist", 9) || !strncmp(r->key, "ls", 2)) {
+        printf("%10.2f Mf/s ", ctx->stats.numFiles / seconds * 1e-6);
+    } else {
+        printf("%10.2f Me/s ", ctx->stats.numEntries / seconds * 1e-6);
+    }
+}
+
+static void bench_absolute(char *buf, size_t len, const char *path)
+{
+    if (path[0] == '/') {
+        snprintf(buf, len, "%s", path);
+    } else {
+        char cwd[4096];
+        char *ok = getcwd(cwd, sizeof(cwd));
+        assert(ok);
+        snprintf(buf, len, "%s/%s", cwd, path);
+    }
+}
+
+static void bench_usage(const char *argv0)
+{
+    fprintf(stderr,
+        "usage: %s [-n files] [-i iterations] [-d dir] [-b baseline] [-s baseline] [-t percent]\n"
+        "  -n  files in the generated data set (default %d)\n"
+        "  -i  minimum runs per benchmark; the best is reported (default %d)\n"
+        "  -d  where to generate the data set (default %s)\n"
+        "  -b  compare against this baseline; saved there if it doesn't exist\n"
+        "  -s  save results as a baseline\n"
+        "  -t  slowdown over the baseline that counts as a regression (default %.0f%%)\n",
+        argv0, BENCH_DEFAULT_FILES, BENCH_DEFAULT_ITERATIONS, BENCH_DEFAULT_DIR, BENCH_DEFAULT_THRESHOLD
+    );
+}
+
+int main(int argc, char **argv)
+{
+    benchgen_options_t options = { .numFiles = BENCH_DEFAULT_FILES, .seed = 1 };
+    int iterations = BENCH_DEFAULT_ITERATIONS;
+    double threshold = BENCH_DEFAULT_THRESHOLD;
+    char baselineFilename[4096] = { 0 };
+    char saveFilename[4096] = { 0 };
+
+    bench_ctx_t ctx = { 0 };
+    bench_absolute(ctx.dir, sizeof(ctx.dir), BENCH_DEFAULT_DIR);
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:i:d:b:s:t:h")) != -1) {
+        switch (opt) {
+        case 'n': options.numFiles = strtoul(optarg, NULL, 10); break;
+        case 'i': iterations = atoi(optarg); break;
+        case 'd': bench_absolute(ctx.dir, sizeof(ctx.dir), optarg); break;
+        case 'b': bench_absolute(baselineFilename, sizeof(baselineFilename), optarg); break;
+        case 's': bench_absolute(saveFilename, sizeof(saveFilename), optarg); break;
+        case 't': threshold = atof(optarg); break;
+        default:
+            bench_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (iterations < 1 || options.numFiles < 1) {
+        bench_usage(argv[0]);
+        return 2;
+    }
+
+    double start = bench_now();
+    benchgen_run(ctx.dir, &options, &ctx.stats);
+    printf("[bench] generated %zu entries, %zu files (%.1f MiB, %.1f MiB packed) in %.2fs\n",
+        ctx.stats.numEntries, ctx.stats.numFiles,
+        ctx.stats.uncompressedBytes / (double)(1 << 20), ctx.stats.packedBytes / (double)(1 << 20),
+        (bench_now() - start) * 1e-9
+    );
+
+    // NOTE: saving a table leaves a scratch file in the working directory.
+    int ret = chdir(ctx.dir);
+    assert(ret == 0);
+
+    snprintf(ctx.rfFilename, sizeof(ctx.rfFilename), "%s/update/resource(us_en)", ctx.dir);
+    snprintf(ctx.patchlistFilename, sizeof(ctx.patchlistFilename), "%s/update/patchlist", ctx.dir);
+    snprintf(ctx.lsFilename, sizeof(ctx.lsFilename), "%s/base/ls", ctx.dir);
+    snprintf(ctx.outDir, sizeof(ctx.outDir), "%s/out/", ctx.dir);
+
+    // extraction reads these
+    static char updatePath[4096];
+    snprintf(updatePath, sizeof(updatePath), "%s/update/", ctx.dir);
+    UPDATE_CONTENT_PATH = updatePath;
+    EXTRACT_PATH = ctx.outDir;
+
+    ctx.tree = filetree_fromRFFile(ctx.rfFilename);
+    fillTreePaths(ctx.tree);
+    ctx.resources = filetree_flattenToResources(ctx.tree);
+
+    bench_result_t *baseline = NULL;
+    if (baselineFilename[0]) {
+        baseline = bench_loadBaseline(baselineFilename);
+    }
+
+    bench_result_t *results = NULL;
+    int regressions = 0;
+
+    printf("%-28s %12s %15s %12s %14s\n", "benchmark", "time", "throughput", "allocs", "alloc bytes");
+
+    size_t numBenches = sizeof(s_benches) / sizeof(s_benches[0]);
+    for (int i = 0; i < numBenches; ++i) {
+        bench_result_t r = bench_measure(&s_benches[i], &ctx, iterations);
+        stbds_arrput(results, r);
+
+        printf("%-28s %9.2f ms ", r.key, r.ns * 1e-6);
+        bench_printThroughput(&ctx, &r);
+        printf("%12.0f %14.0f", r.allocs, r.bytes);
+
+        if (baseline && stbds_shgeti(baseline, r.key) >= 0) {
+            bench_result_t *b = &baseline[stbds_shgeti(baseline, r.key)];
+            double delta = (r.ns - b->ns) / b->ns * 100.0;
+            bool slower = delta > threshold;
+            bool moreAllocs = r.allocs > b->allocs;
+
+            printf("  %+6.1f%%", delta);
+            if (moreAllocs) {
+                printf(" (%+.0f allocs)", r.allocs - b->allocs);
+            }
+            if (slower || moreAllocs) {
+                printf("  REGRESSION");
+                regressions += 1;
+            }
+        }
+        printf("\n");
+    }
+
+    if (saveFilename[0]) {
+        bench_saveBaseline(saveFilename, results);
+        printf("[bench] saved baseline to %s\n", saveFilename);
+    } else if (baselineFilename[0] && stbds_shlen(baseline) == 0) {
+        bench_saveBaseline(baselineFilename, results);
+        printf("[bench] no baseline yet; saved one to %s\n", baselineFilename);
+    }
+
+    if (regressions) {
+        printf("[bench] %d regression(s) over the baseline\n", regressions);
+    }
+
+    stbds_shfree(baseline);
+    stbds_arrfree(results);
+    freeResources(ctx.resources);
+    filetree_freeFlatCache(&ctx.flatCache);
+    filetree_free(ctx.tree);
+
+    return regressions ? 1 : 0;
+}
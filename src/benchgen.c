@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include <zlib.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "benchgen.h"
+#include "ls.h"
+#include "patchlist.h"
+#include "rf.h"
+
+// Deeper than this and a directory only holds files.
+#define BENCHGEN_MAX_DEPTH (9)
+// Roughly how many files each packing root gets.
+#define BENCHGEN_FILES_PER_ROOT (200)
+
+typedef struct {
+    const char *name;
+    int percent; // share of all files
+    const char **roots; // packing root names; numbered once they run out
+} benchgen_category_t;
+
+static const char *s_fighterRoots[] = { "mario", "link", "kirby", "pikachu", "samus", "fox", "ness", "luigi", NULL };
+static const char *s_stageRoots[] = { "battlefield", "end", "castle", "island", NULL };
+static const char *s_genericRoots[] = { "common", "stage", "fighter", NULL };
+
+static benchgen_category_t s_categories[] = {
+    { "fighter", 40, s_fighterRoots },
+    { "stage", 20, s_stageRoots },
+    { "effect", 15, s_genericRoots },
+    { "ui", 10, s_genericRoots },
+    { "sound", 10, s_genericRoots },
+    { "menu", 5, s_genericRoots },
+};
+
+static const char *s_dirStems[] = { "model", "motion", "body", "c", "texture", "anim", "script", "param" };
+static const char *s_fileStems[] = { "model", "metal", "light", "a00wait", "a01walk", "effect", "param", "se_" };
+static const char *s_fileExts[] = { ".nud", ".nut", ".omo", ".mta", ".bin", ".lm", ".nus3bank" };
+static const char *s_words[] = { "vertex", "bone", "frame", "texture", "0.500000", "material", "1.0", "-1", "anim", "=" };
+
+#define COUNTOF(a) (sizeof(a) / sizeof((a)[0]))
+
+typedef struct {
+    const char *dir;
+    benchgen_stats_t *stats;
+    uint64_t rng;
+
+    resource_t *resources; // stb_ds array, pre-order
+    char path[PATCHLIST_ENTRY_LEN]; // of the directory being filled
+
+    FILE *packed; // current packing root's
+    uint32_t packedLen;
+
+    FILE *patchlist;
+    FILE *ls;
+} benchgen_t;
+
+static uint32_t benchgen_rand(benchgen_t *gen)
+{
+    // xorshift64*
+    gen->rng ^= gen->rng >> 12;
+    gen->rng ^= gen->rng << 25;
+    gen->rng ^= gen->rng >> 27;
+    return (gen->rng * 0x2545F4914F6CDD1DULL) >> 32;
+}
+
+static void benchgen_emit(benchgen_t *gen, const char *filename, int depth, uint32_t flags)
+{
+    resource_t res = { 0 };
+    res.filename = strdup(filename);
+    res.flags = flags | depth;
+    res.timestamp = 0x5A000000 + stbds_arrlenu(gen->resources);
+    stbds_arrput(gen->resources, res);
+
+    gen->stats->numEntries += 1;
+}
+
+static size_t benchgen_pushPath(benchgen_t *gen, const char *name)
+{
+    size_t len = strlen(gen->path);
+    assert(len + strlen(name) + 5 < sizeof(gen->path) && "path too long for a patchlist slot");
+    strcat(gen->path, name);
+    return len;
+}
+
+// Mostly text-like and compressible; every eighth file is noise and ends
+// up stored.
+static uint8_t* benchgen_content(benchgen_t *gen, size_t *len, bool *noise)
+{
+    size_t size = (32u << (benchgen_rand(gen) % 8));
+    size += benchgen_rand(gen) % size;
+
+    uint8_t *data = (uint8_t*)malloc(size);
+    *noise = (benchgen_rand(gen) % 8) == 0;
+
+    if (*noise) {
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = benchgen_rand(gen);
+        }
+    } else {
+        size_t i = 0;
+        while (i < size) {
+            const char *word = s_words[benchgen_rand(gen) % COUNTOF(s_words)];
+            size_t n = strlen(word);
+            for (size_t j = 0; j < n && i < size; ++j) {
+                data[i++] = word[j];
+            }
+            if (i < size) {
+                data[i++] = (benchgen_rand(gen) % 4) ? ' ' : '\n';
+            }
+        }
+    }
+
+    *len = size;
+    return data;
+}
+
+static void benchgen_file(benchgen_t *gen, const char *filename, int depth)
+{
+    size_t len;
+    bool noise;
+    uint8_t *data = benchgen_content(gen, &len, &noise);
+
+    uint32_t packOffset = gen->packedLen;
+    uint32_t sizeCompressed, sizeUncompressed;
+
+    uLongf destLen = compressBound(len);
+    uint8_t *dest = (uint8_t*)malloc(destLen);
+    if (!noise) {
+        int ret = compress2(dest, &destLen, data, len, Z_DEFAULT_COMPRESSION);
+        assert(ret == Z_OK);
+    }
+
+    // NOTE: anything that doesn't shrink is stored, like noise.
+    if (noise || destLen >= len) {
+        uint8_t header[RES_STORED_HEADER_LEN] = { 0 };
+        fwrite(header, sizeof(header), 1, gen->packed);
+        fwrite(data, len, 1, gen->packed);
+        sizeCompressed = sizeUncompressed = len + RES_STORED_HEADER_LEN;
+    } else {
+        fwrite(dest, destLen, 1, gen->packed);
+        sizeCompressed = destLen;
+        sizeUncompressed = len;
+    }
+    free(dest);
+
+    gen->packedLen += sizeCompressed;
+    uint8_t pad[0x80] = { 0 };
+    size_t padLen = (0x80 - (gen->packedLen % 0x80)) % 0x80;
+    fwrite(pad, padLen, 1, gen->packed);
+    gen->packedLen += padLen;
+
+    benchgen_emit(gen, filename, depth, RES_FLAG_PACKED | RES_FLAG_NO_LOC);
+    resource_t *res = &stbds_arrlast(gen->resources);
+    res->packOffset = packOffset;
+    res->sizeCompressed = sizeCompressed;
+    res->sizeUncompressed = sizeUncompressed;
+
+    size_t prev = benchgen_pushPath(gen, filename);
+    // NOTE: roomier than a slot to keep the compiler quiet; pushPath
+    // already made sure it fits.
+    char slot[PATCHLIST_ENTRY_LEN + 8] = { 0 };
+    snprintf(slot, sizeof(slot), "data/%s", gen->path);
+    fwrite(slot, PATCHLIST_ENTRY_LEN, 1, gen->patchlist);
+    gen->path[prev] = '\0';
+
+    ls_entry_t lsEntry = {
+        .crc = crc32(0, (uint8_t*)slot, strlen(slot)),
+        .offset = packOffset,
+        .size = sizeUncompressed,
+        .dtIndex = 0,
+    };
+    fwrite(&lsEntry, sizeof(lsEntry), 1, gen->ls);
+
+    gen->stats->numFiles += 1;
+    gen->stats->uncompressedBytes += len;
+    free(data);
+}
+
+// Spreads `budget` files over a subtree: a few at this level, the rest in
+// 2-5 subdirectories, until the budget or depth runs out.
+static void benchgen_dir(benchgen_t *gen, int depth, size_t budget)
+{
+    size_t here = budget;
+    size_t numDirs = 0;
+    if (budget > 12 && depth < BENCHGEN_MAX_DEPTH) {
+        here = budget / 8;
+        numDirs = 2 + benchgen_rand(gen) % 4;
+    }
+
+    for (size_t i = 0; i < here; ++i) {
+        char name[32];
+        snprintf(name, sizeof(name), "%s%02zu%s",
+            s_fileStems[benchgen_rand(gen) % COUNTOF(s_fileStems)], i,
+            s_fileExts[benchgen_rand(gen) % COUNTOF(s_fileExts)]
+        );
+        benchgen_file(gen, name, depth);
+    }
+
+    size_t rest = budget - here;
+    for (size_t i = 0; i < numDirs; ++i) {
+        size_t share = (i == numDirs - 1) ? rest : rest / (numDirs - i);
+        rest -= share;
+
+        char name[32];
+        snprintf(name, sizeof(name), "%s%02zu/", s_dirStems[benchgen_rand(gen) % COUNTOF(s_dirStems)], i);
+        benchgen_emit(gen, name, depth, RES_FLAG_DIR | RES_FLAG_NO_LOC);
+
+        size_t prev = benchgen_pushPath(gen, name);
+        benchgen_dir(gen, depth + 1, share);
+        gen->path[prev] = '\0';
+    }
+}
+
+static void benchgen_packingRoot(benchgen_t *gen, const char *name, int depth, size_t budget)
+{
+    benchgen_emit(gen, name, depth, RES_FLAG_DIR);
+    size_t prev = benchgen_pushPath(gen, name);
+
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s/update/data/%s", gen->dir, gen->path);
+    mkdir_p(filename);
+    strncat(filename, "packed", sizeof(filename) - strlen(filename) - 1);
+
+    gen->packed = fopen(filename, "wb");
+    assert(gen->packed && "cannot create packed file");
+    gen->packedLen = 0;
+
+    benchgen_dir(gen, depth + 1, budget);
+
+    fclose(gen->packed);
+    gen->packed = NULL;
+    gen->stats->packedBytes += gen->packedLen;
+    gen->path[prev] = '\0';
+}
+
+void benchgen_run(const char *dir, benchgen_options_t *options, benchgen_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    benchgen_t gen = {
+        .dir = dir,
+        .stats = stats,
+        .rng = 0x9E3779B97F4A7C15ULL ^ options->seed,
+    };
+
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s/update/data", dir);
+    mkdir_p(filename);
+    snprintf(filename, sizeof(filename), "%s/base", dir);
+    mkdir_p(filename);
+
+    // Headers first; counts are patched in once everything's written.
+    snprintf(filename, sizeof(filename), "%s/update/patchlist", dir);
+    gen.patchlist = fopen(filename, "wb");
+    patchlist_header_t plHeader = { .magic = 0x1234 };
+    fwrite(&plHeader, sizeof(plHeader), 1, gen.patchlist);
+
+    snprintf(filename, sizeof(filename), "%s/base/ls", dir);
+    gen.ls = fopen(filename, "wb");
+    ls_t lsHeader = { .magic = 0x0001, .version = 1 };
+    fwrite(&lsHeader, 8, 1, gen.ls);
+
+    assert(gen.patchlist && gen.ls);
+
+    benchgen_emit(&gen, "", 0, RES_FLAG_DIR);
+
+    for (size_t c = 0; c < COUNTOF(s_categories); ++c) {
+        benchgen_category_t *cat = &s_categories[c];
+        size_t files = options->numFiles * cat->percent / 100;
+
+        char name[32];
+        snprintf(name, sizeof(name), "%s/", cat->name);
+        benchgen_emit(&gen, name, 1, RES_FLAG_DIR | RES_FLAG_NO_LOC);
+        size_t prev = benchgen_pushPath(&gen, name);
+
+        size_t numNamed = 0;
+        while (cat->roots[numNamed]) {
+            numNamed += 1;
+        }
+
+        size_t numRoots = files / BENCHGEN_FILES_PER_ROOT + 1;
+        for (size_t r = 0; r < numRoots; ++r) {
+            size_t share = (r == numRoots - 1) ? files : files / (numRoots - r);
+            files -= share;
+
+            // NOTE: numbered names keep the shared prefixes real tables have.
+            if (r < numNamed) {
+                snprintf(name, sizeof(name), "%s/", cat->roots[r]);
+            } else {
+                snprintf(name, sizeof(name), "%s%03zu/", cat->roots[r % numNamed], r / numNamed);
+            }
+            benchgen_packingRoot(&gen, name, 2, share);
+        }
+
+        gen.path[prev] = '\0';
+    }
+
+    plHeader.numFiles = stats->numFiles;
+    fseek(gen.patchlist, 0, SEEK_SET);
+    fwrite(&plHeader, sizeof(plHeader), 1, gen.patchlist);
+    fclose(gen.patchlist);
+
+    lsHeader.numEntries = stats->numFiles;
+    fseek(gen.ls, 0, SEEK_SET);
+    fwrite(&lsHeader, 8, 1, gen.ls);
+    fclose(gen.ls);
+
+    snprintf(filename, sizeof(filename), "%s/update/resource(us_en)", dir);
+    saveResourcesToRFFile(gen.resources, filename);
+    freeResources(gen.resources);
+}
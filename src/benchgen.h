@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Synthetic game data for bin/bench, laid out like the real thing:
+//   <dir>/update/resource(us_en)  one table, deep tree, shared-prefix names
+//   <dir>/update/data/<root>packed  one per packing root, entries 0x80-aligned
+//   <dir>/update/patchlist          every file, as data/<path>
+//   <dir>/base/ls                   one entry per file
+// Output only depends on the options, so runs are comparable.
+
+typedef struct {
+    size_t numFiles;
+    uint32_t seed;
+} benchgen_options_t;
+
+typedef struct {
+    size_t numEntries;
+    size_t numFiles;
+    uint64_t uncompressedBytes; // sum of file sizes
+    uint64_t packedBytes; // sum of packed file sizes
+} benchgen_stats_t;
+
+void benchgen_run(const char *dir, benchgen_options_t *options, benchgen_stats_t *stats);
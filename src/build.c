@@ -0,0 +1,68 @@
+#include <stdio.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "build.h"
+#include "config.h"
+#include "filetree.h"
+#include "patchlist.h"
+#include "regions.h"
+#include "repack.h"
+#include "rf.h"
+#include "trace.h"
+
+bool build_run(regions_t *regions, filetree_node_t *localTree)
+{
+    char filename[4096];
+    region_t *primary = regions_getPrimary(regions);
+
+    if (!primary) {
+        printf("[build] no resource tables in %s\n", UPDATE_CONTENT_PATH);
+        return false;
+    }
+
+    bool ok = true;
+    mkdir_p(MOD_CONTENT_PATH);
+
+    TRACE_BEGIN("build");
+
+    {
+        snprintf(filename, sizeof(filename), "%s%s", UPDATE_CONTENT_PATH, "patchlist");
+        patchlist_t *patchlist = patchlist_loadFromFile(filename);
+        writeTreePathsToPatchlist(localTree, patchlist);
+
+        // NOTE: patches offsets and sizes into the trees, so this has to
+        // come before the resource tables are flattened below.
+        // FIXME: workspace files only override the primary region's
+        // localized data; there's no data(xx_yy)/ in the workspace yet.
+        TRACE_BEGIN("repack");
+        ok = repack_build(primary->tree, localTree, patchlist, MOD_CONTENT_PATH);
+        TRACE_END();
+
+        snprintf(filename, sizeof(filename), "%s%s", MOD_CONTENT_PATH, "patchlist");
+        ok = patchlist_saveToFile(patchlist, filename) && ok;
+        patchlist_free(patchlist);
+    }
+
+    size_t numRegions = stbds_arrlenu(regions->regions);
+    for (int i = 0; i < numRegions; ++i) {
+        region_t *region = &regions->regions[i];
+
+        if (region != primary) {
+            TRACE_BEGIN_DETAIL("sync_shared", region->name);
+            regions_syncShared(primary, region);
+            TRACE_END();
+        }
+
+        // NOTE: kept by the region, so saving again after an edit only
+        // re-flattens what the edit touched.
+        resource_t *newResources = filetree_flattenCached(region->tree, &region->flatCache);
+        snprintf(filename, sizeof(filename), "%sresource(%s)", MOD_CONTENT_PATH, region->name);
+        ok = saveResourcesToRFFile(newResources, filename) && ok;
+    }
+
+    TRACE_END();
+
+    return ok;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "filetree.h"
+#include "regions.h"
+
+// Writes the mod out to MOD_CONTENT_PATH: patchlist, repacked data and a
+// resource table per region. The trees are updated to describe the output.
+// False if any of it couldn't be written.
+bool build_run(regions_t *regions, filetree_node_t *localTree);
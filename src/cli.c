@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ds.h"
+
+#include "build.h"
+#include "cli.h"
+#include "config.h"
+#include "diff.h"
+#include "extract.h"
+#include "filetree.h"
+#include "mem.h"
+#include "origin.h"
+#include "path.h"
+#include "regions.h"
+#include "rf.h"
+#include "selection.h"
+#include "trace.h"
+#include "verify.h"
+#include "zipexport.h"
+
+// Headless entry points for scripted builds: the same pipeline as the
+// explorer, minus the window. Results go to stdout; timings go to stderr
+// as `time\t<phase>\t<seconds>` lines, so they're easy to pick out.
+
+typedef int (*cli_command_fn_t)(int argc, char **argv);
+
+typedef struct {
+    const char *name;
+    const char *usage;
+    cli_command_fn_t fn;
+} cli_command_t;
+
+static double cli_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void cli_reportTime(const char *phase, double start)
+{
+    fprintf(stderr, "time\t%s\t%.6f\n", phase, cli_now() - start);
+}
+
+static regions_t *s_regions = NULL;
+
+// Every region's table; freed by `cli_run` once the command is done.
+static regions_t* cli_loadRegions()
+{
+    double start = cli_now();
+    s_regions = regions_load(UPDATE_CONTENT_PATH, CACHE_PATH);
+    cli_reportTime("load", start);
+
+    return s_regions;
+}
+
+static filetree_node_t* cli_loadPrimaryTree()
+{
+    region_t *primary = regions_getPrimary(cli_loadRegions());
+    return primary ? primary->tree : NULL;
+}
+
+// Relative to the data root, e.g. `data(us_en)/ui/foo.bin`.
+static void cli_getFullPath(filetree_node_t *node, char *buf, size_t len)
+{
+    char dataDir[64];
+    filetree_getDataDir(node, dataDir, sizeof(dataDir));
+    snprintf(buf, len, "%s%s", dataDir, node->path);
+}
+
+// Each file on disk once, out of those `sel` picks: shared files from the
+// primary region, plus every region's localized ones.
+static filetree_node_t** cli_collectAllFiles(selection_t *sel)
+{
+    regions_t *regions = cli_loadRegions();
+    region_t *primary = regions_getPrimary(regions);
+    filetree_node_t **files = NULL;
+
+    double start = cli_now();
+
+    size_t numRegions = stbds_arrlenu(regions->regions);
+    for (int i = 0; i < numRegions; ++i) {
+        region_t *region = &regions->regions[i];
+        filetree_node_t **selected = selection_run(sel, region->tree);
+
+        size_t numSelected = stbds_arrlenu(selected);
+        for (int j = 0; j < numSelected; ++j) {
+            if (region == primary || regions_isLocalized(selected[j])) {
+                stbds_arrput(files, selected[j]);
+            }
+        }
+
+        stbds_arrfree(selected);
+    }
+
+    cli_reportTime("select", start);
+
+    return files;
+}
+
+static int cli_list(int argc, char **argv)
+{
+    selection_t *sel = selection_compile(argv + 1, argc - 1);
+    if (!sel) {
+        return 2;
+    }
+
+    filetree_node_t **files = cli_collectAllFiles(sel);
+
+    size_t numFiles = stbds_arrlenu(files);
+    for (int i = 0; i < numFiles; ++i) {
+        resource_t *res = files[i]->res;
+        char path[4096];
+        cli_getFullPath(files[i], path, sizeof(path));
+
+        printf("%s\t%08x\t%u\t%u\t%08x\t%s\n", path,
+            res->packOffset, res->sizeCompressed, res->sizeUncompressed, res->flags,
+            origin_getName(files[i]->origin));
+    }
+
+    stbds_arrfree(files);
+    selection_free(sel);
+
+    return 0;
+}
+
+static int cli_extract(int argc, char **argv)
+{
+    selection_t *sel = argc < 2 ? NULL : selection_compile(argv + 1, argc - 1);
+    if (!sel) {
+        return 2;
+    }
+
+    filetree_node_t **files = cli_collectAllFiles(sel);
+
+    double start = cli_now();
+
+    char manifestFilename[4096];
+    snprintf(manifestFilename, sizeof(manifestFilename), "%s%s", EXTRACT_PATH, EXTRACT_MANIFEST_FILENAME);
+    manifest_t *manifest = manifest_load(manifestFilename);
+
+    size_t numFiles = stbds_arrlenu(files);
+    size_t numFailed = extractNodesToFiles(files, numFiles, manifest);
+
+    manifest_save(manifest);
+    manifest_free(manifest);
+    cli_reportTime("extract", start);
+
+    if (numFailed) {
+        fprintf(stderr, "failed to extract %zu of %zu files\n", numFailed, numFiles);
+    }
+
+    stbds_arrfree(files);
+    selection_free(sel);
+
+    return numFiles && !numFailed ? 0 : 1;
+}
+
+static int cli_build(int argc, char **argv)
+{
+    regions_t *regions = cli_loadRegions();
+
+    double start = cli_now();
+    filetree_node_t *localTree = filetree_fromWorkspacePath(MOD_WORKSPACE_PATH);
+    fillTreePaths(localTree);
+    cli_reportTime("scan", start);
+
+    start = cli_now();
+    bool ok = build_run(regions, localTree);
+    cli_reportTime("build", start);
+
+    filetree_free(localTree);
+
+    return ok ? 0 : 1;
+}
+
+static int cli_diff(int argc, char **argv)
+{
+    selection_t *sel = argc < 2 ? NULL : selection_compile(argv + 2, argc - 2);
+    if (!sel) {
+        return 2;
+    }
+
+    filetree_node_t *tree = cli_loadPrimaryTree();
+    if (!tree) {
+        selection_free(sel);
+        return 1;
+    }
+
+    if (!path_isFile(argv[1])) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        selection_free(sel);
+        return 1;
+    }
+
+    double start = cli_now();
+    filetree_node_t *otherTree = filetree_fromRFFile(argv[1]);
+    fillTreePaths(otherTree);
+
+    diff_entry_t *diff = diff_trees(otherTree, tree, DIFF_COMPARE_METADATA);
+    cli_reportTime("diff", start);
+
+    // NOTE: both sides' paths are the same wherever both exist
+    size_t numKept = 0;
+    size_t numEntries = stbds_arrlenu(diff);
+    for (int i = 0; i < numEntries; ++i) {
+        filetree_node_t *node = diff[i].b ? diff[i].b : diff[i].a;
+        if (node->path && selection_matches(sel, node->path)) {
+            diff[numKept++] = diff[i];
+        }
+    }
+    stbds_arrsetlen(diff, numKept);
+
+    diff_printReport(diff, stdout);
+
+    diff_free(diff);
+    filetree_free(otherTree);
+    selection_free(sel);
+
+    return 0;
+}
+
+// Checks every entry fits in its packed file and inflates to its size.
+static int cli_verify(int argc, char **argv)
+{
+    selection_t *sel = selection_compile(argv + 1, argc - 1);
+    if (!sel) {
+        return 2;
+    }
+
+    filetree_node_t **files = cli_collectAllFiles(sel);
+
+    double start = cli_now();
+    size_t numFiles = stbds_arrlenu(files);
+    uint8_t *statuses = verify_files(files, numFiles);
+    cli_reportTime("verify", start);
+
+    size_t numBad = 0;
+    for (int i = 0; i < numFiles; ++i) {
+        if (statuses[i] != VERIFY_OK) {
+            char path[4096];
+            cli_getFullPath(files[i], path, sizeof(path));
+            printf("%s\t%s\n", verify_statusName(statuses[i]), path);
+            numBad++;
+        }
+    }
+
+    printf("%zu/%zu ok\n", numFiles - numBad, numFiles);
+
+    mem_free(statuses);
+    stbds_arrfree(files);
+    selection_free(sel);
+
+    return numBad ? 1 : 0;
+}
+
+static int cli_export(int argc, char **argv)
+{
+    selection_t *sel = argc < 2 ? NULL : selection_compile(argv + 2, argc - 2);
+    if (!sel) {
+        return 2;
+    }
+
+    filetree_node_t **files = cli_collectAllFiles(sel);
+
+    double start = cli_now();
+    bool ok = zipexport_files(files, stbds_arrlenu(files), argv[1]);
+    cli_reportTime("export", start);
+
+    stbds_arrfree(files);
+    selection_free(sel);
+
+    return ok ? 0 : 1;
+}
+
+static const cli_command_t s_commands[] = {
+    { "list",    "list [pattern...]",       cli_list },
+    { "extract", "extract <pattern...>",    cli_extract },
+    { "build",   "build",                   cli_build },
+    { "diff",    "diff <rf file> [pattern...]", cli_diff },
+    { "verify",  "verify [pattern...]",     cli_verify },
+    { "export",  "export <zip file> [pattern...]", cli_export },
+};
+
+#define CLI_NUM_COMMANDS (sizeof(s_commands) / sizeof(s_commands[0]))
+
+static const cli_command_t* cli_findCommand(const char *name)
+{
+    for (int i = 0; i < CLI_NUM_COMMANDS; ++i) {
+        if (!strcmp(s_commands[i].name, name)) {
+            return &s_commands[i];
+        }
+    }
+
+    return NULL;
+}
+
+bool cli_isCommand(const char *name)
+{
+    return cli_findCommand(name) != NULL;
+}
+
+int cli_run(int argc, char **argv)
+{
+    const cli_command_t *command = cli_findCommand(argv[0]);
+    if (!command) {
+        return 2;
+    }
+
+    double start = cli_now();
+    TRACE_BEGIN_DETAIL("cli", command->name);
+
+    TRACE_BEGIN("config_load");
+    config_load();
+    TRACE_END();
+
+    int ret = command->fn(argc, argv);
+
+    if (s_regions) {
+        regions_free(s_regions);
+        s_regions = NULL;
+    }
+    if (ret == 2) {
+        fprintf(stderr, "usage: dtls %s\n", command->usage);
+    }
+
+    TRACE_END();
+    cli_reportTime("total", start);
+
+    return ret;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stdbool.h>
+
+bool cli_isCommand(const char *name);
+
+// `argv[0]` is the command name. Returns the process exit code.
+int cli_run(int argc, char **argv);
@@ -1,8 +1,11 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "vendor/toml.h"
 #include "config.h"
+#include "mem.h"
 
 int g_configLoaded = 0;
 
@@ -11,6 +14,7 @@ char *UPDATE_CONTENT_PATH = { 0 };
 char *MOD_WORKSPACE_PATH = { 0 };
 char *MOD_CONTENT_PATH = { 0 };
 char *EXTRACT_PATH = { 0 };
+char *CACHE_PATH = { 0 };
 
 void config_load()
 {
@@ -44,5 +48,15 @@ void config_load()
     MOD_CONTENT_PATH = dMOD_CONTENT_PATH.u.s;
     EXTRACT_PATH = dEXTRACT_PATH.u.s;
 
+    // optional; next to the extracted data unless set
+    toml_datum_t dCACHE_PATH = toml_string_in(conf, "CACHE_PATH");
+    if (dCACHE_PATH.ok) {
+        CACHE_PATH = dCACHE_PATH.u.s;
+    } else {
+        size_t len = strlen(EXTRACT_PATH) + strlen(CONFIG_DEFAULT_CACHE_DIRNAME) + 1;
+        CACHE_PATH = (char*)mem_malloc(MEM_TAG_OTHER, len);
+        snprintf(CACHE_PATH, len, "%s%s", EXTRACT_PATH, CONFIG_DEFAULT_CACHE_DIRNAME);
+    }
+
     g_configLoaded = 1;
 }
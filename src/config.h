@@ -7,5 +7,10 @@ extern char *UPDATE_CONTENT_PATH;
 extern char *MOD_WORKSPACE_PATH;
 extern char *MOD_CONTENT_PATH;
 extern char *EXTRACT_PATH;
+extern char *CACHE_PATH;
+
+// Generated data that can always be rebuilt (index and compression
+// caches); kept out of the workspace, which is versioned and shared.
+#define CONFIG_DEFAULT_CACHE_DIRNAME ".dtls_cache/"
 
 void config_load();
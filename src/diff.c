@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ds.h"
+
+#include "diff.h"
+#include "filetree.h"
+#include "hash.h"
+#include "mem.h"
+#include "rf.h"
+#include "vfile.h"
+
+// Every node gets a hash covering its own metadata and, recursively, its
+// children's (combined order-independently, since a workspace directory
+// listing has no particular order). Two trees are then walked side by side,
+// and any pair of nodes with equal hashes is skipped without descending.
+
+typedef struct {
+    char *key;
+    filetree_node_t *value;
+} diff_child_t;
+
+static const char* diff_filename(filetree_node_t *node)
+{
+    return node->filename ? node->filename : "";
+}
+
+static uint64_t diff_hashContent(filetree_node_t *node)
+{
+    hash_state_t *state = (hash_state_t*)mem_malloc(MEM_TAG_FILETREE, sizeof(*state));
+    uint8_t *buf = (uint8_t*)mem_malloc(MEM_TAG_FILETREE, HASH_BLOCK_SIZE);
+    hash_init(state, 0);
+
+    if (node->sourcePath) {
+        int fd = open(node->sourcePath, O_RDONLY);
+        ssize_t n;
+        while (fd >= 0 && (n = read(fd, buf, HASH_BLOCK_SIZE)) > 0) {
+            hash_update(state, buf, n);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    } else {
+        vfile_t *vf = vfile_openNode(node);
+        size_t n;
+        while (vf && (n = vfile_read(vf, buf, HASH_BLOCK_SIZE)) > 0) {
+            hash_update(state, buf, n);
+        }
+        if (vf) {
+            vfile_close(vf);
+        }
+    }
+
+    uint64_t h = hash_final(state);
+    mem_free(buf);
+    mem_free(state);
+
+    return h;
+}
+
+static uint64_t diff_hashSelf(filetree_node_t *node, diff_compare_t compare)
+{
+    uint64_t h = hash_string(diff_filename(node), 0);
+    resource_t *res = node->res;
+
+    if (res) {
+        uint64_t fields[5] = { 0 };
+
+        if (compare & DIFF_COMPARE_SIZE_COMPRESSED) {
+            fields[0] = res->sizeCompressed;
+        }
+        if (compare & DIFF_COMPARE_SIZE_UNCOMPRESSED) {
+            fields[1] = res->sizeUncompressed;
+        }
+        if (compare & DIFF_COMPARE_TIMESTAMP) {
+            fields[2] = res->timestamp;
+        }
+        // NOTE: the low byte is the depth, which follows from the path.
+        if (compare & DIFF_COMPARE_FLAGS) {
+            fields[3] = res->flags & ~0xFF;
+        }
+        if ((compare & DIFF_COMPARE_CONTENT) && !(res->flags & RES_FLAG_DIR)) {
+            fields[4] = node->contentHash;
+        }
+
+        h = hash_bytes(fields, sizeof(fields), h);
+    }
+
+    return h;
+}
+
+static void diff_hashNode(filetree_node_t *node, diff_compare_t compare)
+{
+    node->diffState = DIFF_SAME;
+
+    if ((compare & DIFF_COMPARE_CONTENT) && node->res && !(node->res->flags & RES_FLAG_DIR)) {
+        node->contentHash = diff_hashContent(node);
+    }
+
+    uint64_t childSum = 0;
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        diff_hashNode(node->children[i], compare);
+        childSum += hash_mix(node->children[i]->hash);
+    }
+
+    node->hash = hash_mix(diff_hashSelf(node, compare) ^ hash_mix(childSum + numChildren));
+}
+
+void diff_hashTree(filetree_node_t *root, diff_compare_t compare)
+{
+    diff_hashNode(root, compare);
+}
+
+static void diff_markSubtree(filetree_node_t *node, diff_state_t state)
+{
+    node->diffState = state;
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        diff_markSubtree(node->children[i], state);
+    }
+}
+
+static void diff_push(diff_entry_t **diff, diff_state_t state, filetree_node_t *a, filetree_node_t *b)
+{
+    diff_entry_t entry = { .state = state, .a = a, .b = b };
+    stbds_arrput(*diff, entry);
+}
+
+static void diff_nodes(filetree_node_t *a, filetree_node_t *b, diff_compare_t compare, diff_entry_t **diff)
+{
+    if (a->hash == b->hash) {
+        return;
+    }
+
+    if (diff_hashSelf(a, compare) != diff_hashSelf(b, compare)) {
+        a->diffState = DIFF_CHANGED;
+        b->diffState = DIFF_CHANGED;
+        diff_push(diff, DIFF_CHANGED, a, b);
+    }
+
+    size_t numChildrenA = stbds_arrlenu(a->children);
+    size_t numChildrenB = stbds_arrlenu(b->children);
+    if (numChildrenA == 0 && numChildrenB == 0) {
+        return;
+    }
+
+    // NOTE: keys borrow the nodes' filenames.
+    diff_child_t *byName = NULL;
+    for (int i = 0; i < numChildrenB; ++i) {
+        stbds_shput(byName, diff_filename(b->children[i]), b->children[i]);
+    }
+
+    for (int i = 0; i < numChildrenA; ++i) {
+        filetree_node_t *childA = a->children[i];
+        diff_child_t *match = stbds_shgetp_null(byName, diff_filename(childA));
+
+        if (match) {
+            diff_nodes(childA, match->value, compare, diff);
+            (void)stbds_shdel(byName, diff_filename(childA));
+        } else {
+            diff_markSubtree(childA, DIFF_REMOVED);
+            diff_push(diff, DIFF_REMOVED, childA, NULL);
+        }
+    }
+
+    // whatever is left only exists in `b`
+    for (int i = 0; i < numChildrenB; ++i) {
+        filetree_node_t *childB = b->children[i];
+        if (stbds_shgetp_null(byName, diff_filename(childB))) {
+            diff_markSubtree(childB, DIFF_ADDED);
+            diff_push(diff, DIFF_ADDED, NULL, childB);
+        }
+    }
+
+    stbds_shfree(byName);
+}
+
+// Hashes both trees and returns what changed going from `a` to `b`. Added
+// and removed directories are reported once, not per descendant. Nodes of
+// both trees are left with their `diffState` set.
+diff_entry_t* diff_trees(filetree_node_t *a, filetree_node_t *b, diff_compare_t compare)
+{
+    diff_entry_t *diff = NULL;
+
+    diff_hashTree(a, compare);
+    diff_hashTree(b, compare);
+    diff_nodes(a, b, compare, &diff);
+
+    return diff;
+}
+
+void diff_printReport(diff_entry_t *diff, FILE *out)
+{
+    size_t counts[4] = { 0 };
+
+    size_t numEntries = stbds_arrlenu(diff);
+    for (int i = 0; i < numEntries; ++i) {
+        diff_entry_t *e = &diff[i];
+        counts[e->state]++;
+
+        switch (e->state) {
+            case DIFF_ADDED:
+                fprintf(out, "A\t%s\n", e->b->path);
+                break;
+            case DIFF_REMOVED:
+                fprintf(out, "D\t%s\n", e->a->path);
+                break;
+            case DIFF_CHANGED: {
+                resource_t *ra = e->a->res;
+                resource_t *rb = e->b->res;
+                fprintf(out, "M\t%s", e->b->path);
+                if (ra && rb) {
+                    fprintf(out, "\t0x%X -> 0x%X", ra->sizeUncompressed, rb->sizeUncompressed);
+                }
+                fprintf(out, "\n");
+            } break;
+            default:
+                break;
+        }
+    }
+
+    fprintf(out, "# %zu added, %zu removed, %zu changed\n", counts[DIFF_ADDED], counts[DIFF_REMOVED], counts[DIFF_CHANGED]);
+}
+
+void diff_free(diff_entry_t *diff)
+{
+    stbds_arrfree(diff);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+
+typedef enum {
+    DIFF_COMPARE_SIZE_COMPRESSED   = 1 << 0,
+    DIFF_COMPARE_SIZE_UNCOMPRESSED = 1 << 1,
+    DIFF_COMPARE_TIMESTAMP         = 1 << 2,
+    DIFF_COMPARE_FLAGS             = 1 << 3,
+    DIFF_COMPARE_CONTENT           = 1 << 4,
+
+    DIFF_COMPARE_METADATA = (
+        DIFF_COMPARE_SIZE_COMPRESSED
+        | DIFF_COMPARE_SIZE_UNCOMPRESSED
+        | DIFF_COMPARE_TIMESTAMP
+        | DIFF_COMPARE_FLAGS
+    ),
+} diff_compare_t;
+
+typedef enum {
+    DIFF_SAME = 0,
+    DIFF_ADDED,
+    DIFF_REMOVED,
+    DIFF_CHANGED,
+} diff_state_t;
+
+typedef struct {
+    diff_state_t state;
+    filetree_node_t *a; // NULL if added
+    filetree_node_t *b; // NULL if removed
+} diff_entry_t;
+
+void diff_hashTree(filetree_node_t *root, diff_compare_t compare);
+diff_entry_t* diff_trees(filetree_node_t *a, filetree_node_t *b, diff_compare_t compare);
+void diff_printReport(diff_entry_t *diff, FILE *out);
+void diff_free(diff_entry_t *diff);
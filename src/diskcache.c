@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "diskcache.h"
+#include "mem.h"
+
+typedef struct {
+    char *path;
+    uint64_t size;
+    struct timespec mtime;
+} diskcache_blob_t;
+
+diskcache_t* diskcache_open(const char *dir, uint64_t capacity)
+{
+    if (mkdir_p(dir) != 0) {
+        printf("[diskcache] cannot create %s\n", dir);
+        return NULL;
+    }
+
+    diskcache_t *cache = (diskcache_t*)mem_calloc(MEM_TAG_REPACK, 1, sizeof(*cache));
+    cache->dir = mem_strdup(MEM_TAG_REPACK, dir);
+    cache->capacity = capacity;
+    pthread_mutex_init(&cache->lock, NULL);
+
+    return cache;
+}
+
+void diskcache_close(diskcache_t *cache)
+{
+    if (!cache) {
+        return;
+    }
+
+    diskcache_evict(cache);
+
+    printf("[diskcache] %zu hits, %zu misses, %zu stored\n", cache->hits, cache->misses, cache->stores);
+
+    pthread_mutex_destroy(&cache->lock);
+    mem_free(cache->dir);
+    mem_free(cache);
+}
+
+void diskcache_makeKey(char *key, uint64_t contentHash, uint64_t contentLen, const char *codec, int level)
+{
+    snprintf(key, DISKCACHE_KEY_LEN, "%016llx-%llx.%s%d",
+        (unsigned long long)contentHash, (unsigned long long)contentLen, codec, level);
+}
+
+static void blobPath(diskcache_t *cache, const char *key, char *path, size_t pathLen)
+{
+    snprintf(path, pathLen, "%s/%s", cache->dir, key);
+}
+
+bool diskcache_get(diskcache_t *cache, const char *key, char *path, size_t pathLen, size_t *size)
+{
+    blobPath(cache, key, path, pathLen);
+
+    struct stat st;
+    bool hit = stat(path, &st) == 0 && S_ISREG(st.st_mode);
+
+    if (hit) {
+        *size = st.st_size;
+        // bump it to the front of the LRU order
+        utimensat(AT_FDCWD, path, NULL, 0);
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    if (hit) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    return hit;
+}
+
+bool diskcache_put(diskcache_t *cache, const char *key, const void *data, size_t len)
+{
+    char path[4096];
+    char tmpPath[4096 + 32];
+    blobPath(cache, key, path, sizeof(path));
+
+    // NOTE: unique per thread, so concurrent writers of the same key never
+    // see each other's partial blobs; the last rename wins.
+    snprintf(tmpPath, sizeof(tmpPath), "%s.%lx.tmp", path, (unsigned long)pthread_self());
+
+    int fd = open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    const uint8_t *p = (const uint8_t*)data;
+    size_t left = len;
+    while (left > 0) {
+        ssize_t n = write(fd, p, left);
+        if (n <= 0) {
+            break;
+        }
+        p += n;
+        left -= n;
+    }
+    close(fd);
+
+    if (left != 0 || rename(tmpPath, path) != 0) {
+        unlink(tmpPath);
+        return false;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    cache->stores++;
+    pthread_mutex_unlock(&cache->lock);
+
+    return true;
+}
+
+static int compareBlobAge(const void *a, const void *b)
+{
+    const diskcache_blob_t *ba = (const diskcache_blob_t*)a;
+    const diskcache_blob_t *bb = (const diskcache_blob_t*)b;
+
+    if (ba->mtime.tv_sec != bb->mtime.tv_sec) {
+        return ba->mtime.tv_sec < bb->mtime.tv_sec ? -1 : 1;
+    }
+    if (ba->mtime.tv_nsec != bb->mtime.tv_nsec) {
+        return ba->mtime.tv_nsec < bb->mtime.tv_nsec ? -1 : 1;
+    }
+    return 0;
+}
+
+void diskcache_evict(diskcache_t *cache)
+{
+    DIR *dir = opendir(cache->dir);
+    if (!dir) {
+        return;
+    }
+
+    diskcache_blob_t *blobs = NULL;
+    uint64_t total = 0;
+
+    struct dirent *ent;
+    while ((ent = readdir(dir))) {
+        if (ent->d_name[0] == '.') {
+            continue;
+        }
+
+        char path[4096];
+        blobPath(cache, ent->d_name, path, sizeof(path));
+
+        struct stat st;
+        if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        diskcache_blob_t blob = {
+            .path = mem_strdup(MEM_TAG_REPACK, path),
+            .size = st.st_size,
+            .mtime = st.st_mtim,
+        };
+        stbds_arrput(blobs, blob);
+        total += blob.size;
+    }
+    closedir(dir);
+
+    size_t numBlobs = stbds_arrlenu(blobs);
+    qsort(blobs, numBlobs, sizeof(*blobs), compareBlobAge);
+
+    size_t numEvicted = 0;
+    for (int i = 0; i < numBlobs && total > cache->capacity; ++i) {
+        if (unlink(blobs[i].path) == 0) {
+            total -= blobs[i].size;
+            numEvicted++;
+        }
+    }
+
+    for (int i = 0; i < numBlobs; ++i) {
+        mem_free(blobs[i].path);
+    }
+    stbds_arrfree(blobs);
+
+    if (numEvicted) {
+        printf("[diskcache] evicted %zu blobs\n", numEvicted);
+    }
+}
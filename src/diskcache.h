@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#define DISKCACHE_KEY_LEN (64)
+
+// A directory of immutable blobs, one file per key. Reads refresh a blob's
+// mtime, and `diskcache_close` evicts the stalest ones until the total fits
+// in `capacity`.
+typedef struct {
+    char *dir;
+    uint64_t capacity;
+
+    pthread_mutex_t lock;
+    size_t hits;
+    size_t misses;
+    size_t stores;
+} diskcache_t;
+
+diskcache_t* diskcache_open(const char *dir, uint64_t capacity);
+void diskcache_close(diskcache_t *cache);
+
+void diskcache_makeKey(char *key, uint64_t contentHash, uint64_t contentLen, const char *codec, int level);
+bool diskcache_get(diskcache_t *cache, const char *key, char *path, size_t pathLen, size_t *size);
+bool diskcache_put(diskcache_t *cache, const char *key, const void *data, size_t len);
+
+void diskcache_evict(diskcache_t *cache);
@@ -0,0 +1,12 @@
+#pragma once
+
+// stb_ds, with its allocations accounted for by mem.c under the calling
+// thread's tag. Include this, never vendor/stb_ds.h directly: every user has
+// to agree on the allocator.
+
+#include "mem.h"
+
+#define STBDS_REALLOC(context, ptr, size) mem_stbdsRealloc((ptr), (size))
+#define STBDS_FREE(context, ptr) mem_stbdsFree(ptr)
+
+#include "vendor/stb_ds.h"
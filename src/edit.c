@@ -0,0 +1,288 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds.h"
+
+#include "edit.h"
+#include "filetree.h"
+#include "mem.h"
+#include "rf.h"
+#include "strpool.h"
+
+// NOTE: edits are undone in the reverse order they were applied, so an
+// index recorded when one was applied still points at the same spot among
+// its siblings when it's reverted.
+
+static bool edit_isDir(filetree_node_t *node)
+{
+    return node->res && (node->res->flags & RES_FLAG_DIR);
+}
+
+// Table roots (and the tree's own) hold everything else; they stay.
+static bool edit_isFixed(edit_history_t *history, filetree_node_t *node)
+{
+    return node == history->tree || node->parent == history->tree;
+}
+
+bool edit_isAttached(edit_history_t *history, filetree_node_t *node)
+{
+    filetree_node_t *n = node;
+    while (n->parent) {
+        n = n->parent;
+    }
+
+    return n == history->tree;
+}
+
+static void edit_freeResource(resource_t *res, bool borrowed)
+{
+    if (!borrowed) {
+        mem_free(res->filename);
+    }
+    mem_free(res);
+}
+
+static void edit_swapResource(edit_t *edit)
+{
+    filetree_node_t *node = edit->node;
+
+    resource_t *res = node->res;
+    bool ownsRes = node->ownsRes;
+    node->res = edit->res;
+    node->ownsRes = edit->ownsRes;
+    edit->res = res;
+    edit->ownsRes = ownsRes;
+
+    if (edit_isDir(node)) {
+        filetree_touch(node);
+    } else {
+        filetree_refreshTotals(node);
+    }
+}
+
+static void edit_apply(edit_history_t *history, edit_t *edit)
+{
+    switch (edit->op) {
+    case EDIT_INSERT:
+        filetree_attach(edit->parent, edit->node, edit->index, history->strings);
+        break;
+    case EDIT_DELETE:
+        edit->index = filetree_detach(edit->node);
+        break;
+    case EDIT_MOVE:
+        edit->prevIndex = filetree_detach(edit->node);
+        filetree_attach(edit->parent, edit->node, edit->index, history->strings);
+        break;
+    case EDIT_REPLACE:
+        edit_swapResource(edit);
+        break;
+    }
+}
+
+static void edit_revert(edit_history_t *history, edit_t *edit)
+{
+    switch (edit->op) {
+    case EDIT_INSERT:
+        filetree_detach(edit->node);
+        break;
+    case EDIT_DELETE:
+        filetree_attach(edit->parent, edit->node, edit->index, history->strings);
+        break;
+    case EDIT_MOVE:
+        filetree_detach(edit->node);
+        filetree_attach(edit->prevParent, edit->node, edit->prevIndex, history->strings);
+        break;
+    case EDIT_REPLACE:
+        edit_swapResource(edit);
+        break;
+    }
+}
+
+// Frees whatever `edit` holds that isn't in the tree.
+static void edit_release(edit_t *edit, bool applied)
+{
+    switch (edit->op) {
+    case EDIT_INSERT:
+        if (!applied) {
+            filetree_free(edit->node);
+        }
+        break;
+    case EDIT_DELETE:
+        if (applied) {
+            filetree_free(edit->node);
+        }
+        break;
+    case EDIT_MOVE:
+        break;
+    case EDIT_REPLACE:
+        if (edit->ownsRes) {
+            edit_freeResource(edit->res, edit->borrowed);
+        }
+        break;
+    }
+}
+
+static void edit_push(edit_history_t *history, edit_t edit)
+{
+    // a new edit forks off whatever could've been redone
+    size_t numEdits = stbds_arrlenu(history->edits);
+    for (size_t i = numEdits; i > history->numApplied; --i) {
+        edit_release(&history->edits[i - 1], false);
+    }
+
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_FILETREE);
+    stbds_arrsetlen(history->edits, history->numApplied);
+    stbds_arrput(history->edits, edit);
+    mem_setTag(prevTag);
+
+    edit_apply(history, &history->edits[history->numApplied++]);
+}
+
+edit_history_t* edit_createHistory(filetree_node_t *tree, strpool_t *strings)
+{
+    edit_history_t *history = (edit_history_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*history));
+    history->tree = tree;
+    history->strings = strings;
+
+    return history;
+}
+
+// Everything the tree still uses stays; what's only in the history goes.
+void edit_freeHistory(edit_history_t *history)
+{
+    size_t numEdits = stbds_arrlenu(history->edits);
+    for (size_t i = numEdits; i > 0; --i) {
+        edit_release(&history->edits[i - 1], i <= history->numApplied);
+    }
+
+    stbds_arrfree(history->edits);
+    mem_free(history);
+}
+
+bool edit_insert(edit_history_t *history, filetree_node_t *parent, filetree_node_t *node)
+{
+    if (node->parent || !node->filename || !edit_isDir(parent) || !edit_isAttached(history, parent)) {
+        printf("[edit] cannot insert %s there\n", node->filename ? node->filename : "(unnamed)");
+        return false;
+    }
+    if (filetree_getChildWithFilename(parent, node->filename)) {
+        printf("[edit] %s%s already exists\n", parent->path ? parent->path : "", node->filename);
+        return false;
+    }
+
+    filetree_aggregateTotals(node);
+
+    edit_push(history, (edit_t){
+        .op = EDIT_INSERT,
+        .node = node,
+        .parent = parent,
+        .index = filetree_insertionIndex(parent, node->filename),
+    });
+
+    return true;
+}
+
+bool edit_delete(edit_history_t *history, filetree_node_t *node)
+{
+    if (edit_isFixed(history, node) || !edit_isAttached(history, node)) {
+        printf("[edit] cannot delete %s\n", node->path ? node->path : "(root)");
+        return false;
+    }
+
+    edit_push(history, (edit_t){
+        .op = EDIT_DELETE,
+        .node = node,
+        .parent = node->parent,
+    });
+
+    return true;
+}
+
+// NOTE: only within a packing root, and not of one, since entries stay
+// where they are in its packed file.
+bool edit_move(edit_history_t *history, filetree_node_t *node, filetree_node_t *newParent)
+{
+    bool ok = !edit_isFixed(history, node)
+        && edit_isDir(newParent)
+        && newParent != node->parent
+        && edit_isAttached(history, node)
+        && edit_isAttached(history, newParent)
+        && getPackingRoot(node) != node
+        && getPackingRoot(node->parent) == getPackingRoot(newParent);
+
+    // not into its own subtree
+    for (filetree_node_t *n = newParent; ok && n; n = n->parent) {
+        ok = n != node;
+    }
+
+    if (!ok) {
+        printf("[edit] cannot move %s to %s\n", node->path ? node->path : "(root)", newParent->path ? newParent->path : "(root)");
+        return false;
+    }
+    if (filetree_getChildWithFilename(newParent, node->filename)) {
+        printf("[edit] %s%s already exists\n", newParent->path, node->filename);
+        return false;
+    }
+
+    edit_push(history, (edit_t){
+        .op = EDIT_MOVE,
+        .node = node,
+        .parent = newParent,
+        .index = filetree_insertionIndex(newParent, node->filename),
+        .prevParent = node->parent,
+    });
+
+    return true;
+}
+
+// The node keeps its place and name; `res` only brings new offsets,
+// sizes and flags. Its depth is fixed up to match.
+bool edit_replace(edit_history_t *history, filetree_node_t *node, resource_t *res)
+{
+    if (!node->res || !edit_isAttached(history, node)
+        || (node->res->flags & RES_FLAG_DIR) != (res->flags & RES_FLAG_DIR)
+    ) {
+        printf("[edit] cannot replace %s\n", node->path ? node->path : "(root)");
+        return false;
+    }
+
+    res->flags = (res->flags & ~0xff) | (node->res->flags & 0xff);
+
+    // borrowed nodes' strings all come from the pool
+    if (node->borrowed && history->strings) {
+        char *filename = strpool_intern(history->strings, res->filename);
+        mem_free(res->filename);
+        res->filename = filename;
+    }
+
+    edit_push(history, (edit_t){
+        .op = EDIT_REPLACE,
+        .node = node,
+        .res = res,
+        .ownsRes = true,
+        .borrowed = node->borrowed,
+    });
+
+    return true;
+}
+
+bool edit_undo(edit_history_t *history)
+{
+    if (history->numApplied == 0) {
+        return false;
+    }
+
+    edit_revert(history, &history->edits[--history->numApplied]);
+    return true;
+}
+
+bool edit_redo(edit_history_t *history)
+{
+    if (history->numApplied == stbds_arrlenu(history->edits)) {
+        return false;
+    }
+
+    edit_apply(history, &history->edits[history->numApplied++]);
+    return true;
+}
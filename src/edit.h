@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+#include "rf.h"
+#include "strpool.h"
+
+// Undoable edits to a resource tree: delete, insert, move and replace
+// resource. Each is applied in place, and what it displaced (a detached
+// subtree, the previous resource) is kept in the history rather than
+// copied, so applying, undoing and redoing one only costs its path up to
+// the root (plus redoing paths if something moved).
+//
+// Every edit touches its path (see `filetree_touch`), so a cached flatten
+// afterwards only walks that path again.
+
+typedef enum {
+    EDIT_INSERT,
+    EDIT_DELETE,
+    EDIT_MOVE,
+    EDIT_REPLACE,
+} edit_op_t;
+
+typedef struct {
+    edit_op_t op;
+    filetree_node_t *node;
+
+    // insert and delete: where `node` is while it's in the tree;
+    // move: where it moves to
+    filetree_node_t *parent;
+    size_t index;
+
+    // move: where it came from
+    filetree_node_t *prevParent;
+    size_t prevIndex;
+
+    // replace: whichever of the two resources isn't in the tree
+    resource_t *res;
+    bool ownsRes;
+    bool borrowed; // the node's; its resources' filenames are interned
+} edit_t;
+
+typedef struct {
+    filetree_node_t *tree;
+    strpool_t *strings; // the tree's, if it's interned; for redone paths
+    edit_t *edits; // stb_ds array; only the first `numApplied` are in effect
+    size_t numApplied;
+} edit_history_t;
+
+edit_history_t* edit_createHistory(filetree_node_t *tree, strpool_t *strings);
+void edit_freeHistory(edit_history_t *history);
+
+// All return false, changing nothing, if the edit doesn't make sense.
+// Insert takes `node` (detached, paths filled or not), replace takes `res`.
+bool edit_insert(edit_history_t *history, filetree_node_t *parent, filetree_node_t *node);
+bool edit_delete(edit_history_t *history, filetree_node_t *node);
+bool edit_move(edit_history_t *history, filetree_node_t *node, filetree_node_t *newParent);
+bool edit_replace(edit_history_t *history, filetree_node_t *node, resource_t *res);
+
+bool edit_undo(edit_history_t *history);
+bool edit_redo(edit_history_t *history);
+
+bool edit_isAttached(edit_history_t *history, filetree_node_t *node);
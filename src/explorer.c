@@ -1,113 +1,212 @@
 #include <assert.h>
 #include <stdint.h>
 
-#include <zlib.h>
 #include <raylib.h>
 
 #define RAYGUI_IMPLEMENTATION
 #include "vendor/raygui.h"
 #include "vendor/style_dark.h"
 #include "vendor/mkdir_p.h"
-#include "vendor/stb_ds.h"
+#include "ds.h"
 
 #include "config.h"
+#include "diff.h"
+#include "edit.h"
+#include "extract.h"
 #include "filetree.h"
+#include "mem.h"
+#include "preview.h"
+#include "regions.h"
 #include "rf.h"
+#include "search.h"
+#include "zipexport.h"
 
 #define PANEL_PADDING 8
 #define HEADER_HEIGHT 24
+#define PREVIEW_LINE_HEIGHT 14
+#define PREVIEW_BYTES_PER_LINE 16
 
 static int g_screenWidth = 640;
 static int g_screenHeight = 360;
 
 Vector2 panelScroll;
+Vector2 previewScroll;
+
+static search_index_t *g_search = NULL;
+static bool g_searchStale = false; // the tree was edited since it was built
+static edit_history_t *g_history = NULL;
+static region_t *g_region = NULL;
+
+// While a search is active, only matches and their ancestors are shown,
+// and every ancestor of a match is expanded.
+bool isNodeVisible(filetree_node_t *node)
+{
+    return !g_search->query[0] || search_getHit(g_search, node) != SEARCH_HIT_NONE;
+}
+
+bool isNodeExpanded(filetree_node_t *node)
+{
+    if (g_search->query[0]) {
+        return search_getHit(g_search, node) & SEARCH_HIT_DESCENDANT;
+    }
+
+    return node->expanded;
+}
 
 size_t numExpandedLines(filetree_node_t *node)
 {
     size_t len = 1;
 
-    if (node->expanded) {
+    if (isNodeExpanded(node)) {
         size_t numChildren = stbds_arrlenu(node->children);
         for (int i = 0; i < numChildren; ++i) {
-            len += numExpandedLines(node->children[i]);
+            if (isNodeVisible(node->children[i])) {
+                len += numExpandedLines(node->children[i]);
+            }
         }
     }
 
     return len;
 }
 
-filetree_node_t* getPackingRoot(filetree_node_t *node)
+static filetree_node_t* ui_ctxMenuTarget = NULL;
+static Vector2 ui_ctxMenuPos;
+static filetree_node_t* ui_selected = NULL;
+static char ui_searchText[SEARCH_QUERY_LEN] = { 0 };
+static bool ui_searchEditing = false;
+
+// Size and count columns, from each node's `totals`. Clicking a column's
+// header sorts every directory's children by it, largest first; again
+// for smallest first. "Name" goes back to table order.
+typedef enum {
+    UI_SORT_NAME,
+    UI_SORT_COMPRESSED,
+    UI_SORT_UNCOMPRESSED,
+    UI_SORT_FILES,
+    UI_SORT_OVERRIDES,
+} ui_sort_t;
+
+typedef struct {
+    const char *title;
+    float width;
+} ui_column_t;
+
+static const ui_column_t s_columns[] = {
+    [UI_SORT_COMPRESSED] = { "Compressed", 96 },
+    [UI_SORT_UNCOMPRESSED] = { "Uncompressed", 104 },
+    [UI_SORT_FILES] = { "Files", 64 },
+    [UI_SORT_OVERRIDES] = { "Overrides", 80 },
+};
+
+#define UI_NUM_COLUMNS (sizeof(s_columns) / sizeof(s_columns[0]))
+
+typedef struct {
+    filetree_node_t *key;
+    filetree_node_t **value; // stb_ds array
+} ui_sorted_entry_t;
+
+static ui_sort_t ui_sortKey = UI_SORT_NAME;
+static bool ui_sortAscending = false;
+// Sorted children, per directory, built the first time it's drawn.
+static ui_sorted_entry_t *ui_sortedChildren = NULL;
+static float ui_columnsX = 0;
+
+static uint64_t getSortValue(filetree_node_t *node)
 {
-    filetree_node_t *r = node;
+    switch (ui_sortKey) {
+    case UI_SORT_COMPRESSED: return node->totals.sizeCompressed;
+    case UI_SORT_UNCOMPRESSED: return node->totals.sizeUncompressed;
+    case UI_SORT_FILES: return node->totals.numFiles;
+    case UI_SORT_OVERRIDES: return node->totals.numOverrides;
+    default: return 0;
+    }
+}
 
-    do {
-        if (!(r->res->flags & RES_FLAG_NO_LOC)) {
-            return r;
-        }
-    } while ((r = r->parent));
+static int compareBySortKey(const void *a, const void *b)
+{
+    filetree_node_t *na = *(filetree_node_t**)a;
+    filetree_node_t *nb = *(filetree_node_t**)b;
 
-    return NULL;
-}
+    uint64_t va = getSortValue(na);
+    uint64_t vb = getSortValue(nb);
+    if (va != vb) {
+        return ((va < vb) == ui_sortAscending) ? -1 : 1;
+    }
 
-static filetree_node_t* ui_ctxMenuTarget = NULL;
-static Vector2 ui_ctxMenuPos;
+    return strcmp(na->filename ? na->filename : "", nb->filename ? nb->filename : "");
+}
 
-// FIXME: does not support base file (dt/ls)
-// FIXME: does not support localized files (data(us_en))
-void extractNodeToFile(filetree_node_t *node)
+static void clearSortedChildren()
 {
-    if (node->res->flags & RES_FLAG_DIR) {
-        size_t numChildren = stbds_arrlenu(node->children);
-        for (int i = 0; i < numChildren; ++i) {
-            extractNodeToFile(node->children[i]);
-        }
-        return;
+    size_t len = stbds_hmlenu(ui_sortedChildren);
+    for (int i = 0; i < len; ++i) {
+        stbds_arrfree(ui_sortedChildren[i].value);
     }
+    stbds_hmfree(ui_sortedChildren);
+}
 
-    filetree_node_t *pr = getPackingRoot(node);
-    assert(pr);
-    const char *localFilename = TextFormat("%sdata/%spacked", UPDATE_CONTENT_PATH, pr->path);
-
-    if (!FileExists(localFilename)) {
-        printf("%s does not exist; skipping %s...\n", localFilename, node->path);
-        return;
+static filetree_node_t** getSortedChildren(filetree_node_t *node)
+{
+    if (ui_sortKey == UI_SORT_NAME || stbds_arrlenu(node->children) < 2) {
+        return node->children;
     }
 
-    uint8_t *rawFileData = (uint8_t*)malloc(node->res->sizeCompressed);
+    ptrdiff_t i = stbds_hmgeti(ui_sortedChildren, node);
+    if (i >= 0) {
+        return ui_sortedChildren[i].value;
+    }
 
-    FILE *fIn = fopen(localFilename, "rb");
-    fseek(fIn, node->res->packOffset, SEEK_SET);
-    fread(rawFileData, node->res->sizeCompressed, 1, fIn);
-    fclose(fIn);
+    size_t numChildren = stbds_arrlenu(node->children);
+    filetree_node_t **sorted = NULL;
+    stbds_arrsetlen(sorted, numChildren);
+    memcpy(sorted, node->children, numChildren * sizeof(*sorted));
+    qsort(sorted, numChildren, sizeof(*sorted), compareBySortKey);
 
-    const char *path = TextFormat("%sdata/%s", EXTRACT_PATH, node->path);
-    printf(">>> extracting %s\n", path);
+    stbds_hmput(ui_sortedChildren, node, sorted);
+    return sorted;
+}
 
-    mkdir_p(GetDirectoryPath(path));
-    FILE *fOut = fopen(path, "wb");
-    size_t dataOffset = 0;
+static void setSortKey(ui_sort_t key)
+{
+    ui_sortAscending = (key == ui_sortKey) ? !ui_sortAscending : false;
+    ui_sortKey = key;
+    clearSortedChildren();
+}
 
-    // not compressed
-    if (node->res->sizeCompressed == node->res->sizeUncompressed) {
-        dataOffset = 0x80;
+static const char* formatSize(uint64_t bytes)
+{
+    if (bytes < 1024) {
+        return TextFormat("%llu B", (unsigned long long)bytes);
+    } else if (bytes < 1024 * 1024) {
+        return TextFormat("%.1f KB", bytes / 1024.0);
+    } else if (bytes < 1024ull * 1024 * 1024) {
+        return TextFormat("%.1f MB", bytes / (1024.0 * 1024));
     }
+    return TextFormat("%.2f GB", bytes / (1024.0 * 1024 * 1024));
+}
 
-    {
-        uLongf destLen = node->res->sizeUncompressed;
-        uint8_t *uncompressedFileData = (uint8_t*)calloc(1, destLen);
-
-        uncompress(
-            uncompressedFileData, &destLen,
-            rawFileData+dataOffset, node->res->sizeCompressed-dataOffset
-        );
+static void drawColumns(filetree_node_t *node, float y)
+{
+    int oldAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
+
+    bool isDir = node->res->flags & RES_FLAG_DIR;
+    float x = ui_columnsX;
+
+    for (int i = UI_SORT_COMPRESSED; i < UI_NUM_COLUMNS; ++i) {
+        const char *text = "";
+        switch (i) {
+        case UI_SORT_COMPRESSED: text = formatSize(node->totals.sizeCompressed); break;
+        case UI_SORT_UNCOMPRESSED: text = formatSize(node->totals.sizeUncompressed); break;
+        case UI_SORT_FILES: text = isDir ? TextFormat("%u", node->totals.numFiles) : ""; break;
+        case UI_SORT_OVERRIDES: text = node->totals.numOverrides && isDir ? TextFormat("%u", node->totals.numOverrides) : ""; break;
+        }
 
-        fwrite(uncompressedFileData, destLen, 1, fOut);
-        free(uncompressedFileData);
+        GuiLabel((Rectangle) { x, y, s_columns[i].width - PANEL_PADDING, 16 }, text);
+        x += s_columns[i].width;
     }
 
-    fclose(fOut);
-
-    free(rawFileData);
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, oldAlignment);
 }
 
 void drawFileNode(filetree_node_t *node, int x, int y, int *currentLineIdx, int startI, int endI)
@@ -123,7 +222,7 @@ void drawFileNode(filetree_node_t *node, int x, int y, int *currentLineIdx, int
             const char *icon;
 
             if (res->flags & RES_FLAG_DIR) {
-                if (node->expanded) {
+                if (isNodeExpanded(node)) {
                     icon = "#1#";
                 } else {
                     icon = "#217#";
@@ -144,13 +243,22 @@ void drawFileNode(filetree_node_t *node, int x, int y, int *currentLineIdx, int
             }
 
             int oldColor = GuiGetStyle(LABEL, TEXT_COLOR_NORMAL);
-            if (res->flags & RES_FLAG_OVERRIDE)
+            if (node == ui_selected)
+                GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0xe0c060FF);
+            else if (search_getHit(g_search, node) & SEARCH_HIT_MATCH)
+                GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0x60d060FF);
+            else if (node->diffState == DIFF_ADDED)
+                GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0x40b0e0FF);
+            else if (node->diffState == DIFF_CHANGED)
+                GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0xe09040FF);
+            else if (res->flags & RES_FLAG_OVERRIDE)
                 GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0x8e67d6FF);
             else if (res->flags & RES_FLAG_NO_LOC)
                 GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0x0067d6FF);
 
-            Rectangle btnRect = { x2, y2, 640, 16 };
+            Rectangle btnRect = { x2, y2, ui_columnsX - x2, 16 };
             int btnState = GuiFileLabelButton(btnRect, s);
+            drawColumns(node, y2);
 
             GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, oldColor);
 
@@ -165,6 +273,10 @@ void drawFileNode(filetree_node_t *node, int x, int y, int *currentLineIdx, int
             } else if (btnState == 1) {
                 if (res->flags & RES_FLAG_DIR) {
                     node->expanded = !node->expanded;
+                } else {
+                    ui_selected = node;
+                    previewScroll = (Vector2) { 0 };
+                    preview_request(node);
                 }
             }
         }
@@ -172,20 +284,210 @@ void drawFileNode(filetree_node_t *node, int x, int y, int *currentLineIdx, int
         ++(*currentLineIdx);
     }
 
-    if (node->expanded) {
+    if (isNodeExpanded(node)) {
         size_t numChildren = stbds_arrlenu(node->children);
+        filetree_node_t **children = getSortedChildren(node);
 
         for (int childIdx = 0; childIdx < numChildren; ++childIdx) {
-            drawFileNode(node->children[childIdx], x, y, currentLineIdx, startI, endI);
+            filetree_node_t *child = children[childIdx];
+            if (isNodeVisible(child)) {
+                drawFileNode(child, x, y, currentLineIdx, startI, endI);
+            }
+        }
+    }
+}
+
+void drawPreviewPane(Rectangle bounds)
+{
+    GuiPanel(bounds, NULL);
+
+    float x = bounds.x + PANEL_PADDING;
+    float y = bounds.y + PANEL_PADDING;
+    float w = bounds.width - PANEL_PADDING * 2;
+
+    GuiLabel((Rectangle) { x, y, w, 18 }, ui_selected->path);
+    y += 18;
+
+    // NOTE: inflation happens on the preview thread; until it's done
+    // there's nothing to show.
+    lrucache_blob_t *blob = preview_acquire(ui_selected);
+    if (!blob) {
+        GuiLabel((Rectangle) { x, y, w, 18 }, "inflating...");
+        return;
+    }
+
+    resource_t *res = ui_selected->res;
+    const char *info;
+    if (blob->size < res->sizeUncompressed) {
+        info = TextFormat("%s - first 0x%zX of 0x%X bytes", preview_sniffType(blob->data, blob->size), blob->size, res->sizeUncompressed);
+    } else {
+        info = TextFormat("%s - 0x%zX bytes", preview_sniffType(blob->data, blob->size), blob->size);
+    }
+    GuiLabel((Rectangle) { x, y, w, 18 }, info);
+    y += 18 + PANEL_PADDING;
+
+    size_t numLines = (blob->size + PREVIEW_BYTES_PER_LINE - 1) / PREVIEW_BYTES_PER_LINE;
+    Rectangle scrollRect = { bounds.x, y, bounds.width, bounds.y + bounds.height - y };
+    Rectangle view = { 0 };
+
+    GuiScrollPanel(
+        scrollRect,
+        NULL,
+        (Rectangle) { scrollRect.x, scrollRect.y, w, numLines * PREVIEW_LINE_HEIGHT + PANEL_PADDING * 2 },
+        &previewScroll,
+        &view
+    );
+
+    BeginScissorMode(view.x, view.y, view.width, view.height);
+
+    size_t startLine = fabs(floorf(previewScroll.y / PREVIEW_LINE_HEIGHT));
+    size_t endLine = startLine + (view.height / PREVIEW_LINE_HEIGHT) + 1;
+    if (endLine > numLines) {
+        endLine = numLines;
+    }
+
+    for (size_t line = startLine; line < endLine; ++line) {
+        char hex[PREVIEW_BYTES_PER_LINE * 3 + 1] = { 0 };
+        char ascii[PREVIEW_BYTES_PER_LINE + 1] = { 0 };
+        size_t offset = line * PREVIEW_BYTES_PER_LINE;
+
+        for (int i = 0; i < PREVIEW_BYTES_PER_LINE && offset + i < blob->size; ++i) {
+            uint8_t b = blob->data[offset + i];
+            sprintf(hex + i * 3, "%02X ", b);
+            ascii[i] = (b >= 0x20 && b < 0x7F) ? b : '.';
         }
+
+        float lineY = view.y + PANEL_PADDING + line * PREVIEW_LINE_HEIGHT + previewScroll.y;
+        Rectangle lineRect = { view.x + PANEL_PADDING + previewScroll.x, lineY, w * 2, PREVIEW_LINE_HEIGHT };
+        GuiLabel(lineRect, TextFormat("%08zX  %-48s %s", offset, hex, ascii));
     }
+
+    EndScissorMode();
+
+    preview_release(blob);
+}
+
+// Re-runs the search if the query changed. Returns true if it did.
+//
+// NOTE: a stale index can't be patched (inserted nodes have no index in
+// it, and it may still point at nodes the history has since freed), so
+// it's rebuilt outright, but only once there's a query to run; edits made
+// with the search box empty don't pay for it.
+static bool updateSearch()
+{
+    bool changed = strcmp(ui_searchText, g_search->query) != 0;
+
+    if (g_searchStale && (ui_searchText[0] || g_search->query[0])) {
+        search_freeIndex(g_search);
+        g_search = search_buildIndex(g_region->tree);
+        g_searchStale = false;
+        search_query(g_search, ui_searchText);
+    } else if (changed && !g_searchStale) {
+        search_query(g_search, ui_searchText);
+    }
+
+    return changed;
+}
+
+// Node indices, sorted children and the selection may all be stale now.
+static void onTreeEdited()
+{
+    clearSortedChildren();
+
+    g_searchStale = true;
+    updateSearch();
+
+    if (ui_selected && !edit_isAttached(g_history, ui_selected)) {
+        ui_selected = NULL;
+    }
+    if (ui_ctxMenuTarget && !edit_isAttached(g_history, ui_ctxMenuTarget)) {
+        ui_ctxMenuTarget = NULL;
+    }
+}
+
+// Writes the edited table out as build does; only what changed since the
+// last save is flattened again.
+static void saveRegion()
+{
+    resource_t *resources = filetree_flattenCached(g_region->tree, &g_region->flatCache);
+
+    mkdir_p(MOD_CONTENT_PATH);
+    const char *filename = TextFormat("%sresource(%s)", MOD_CONTENT_PATH, g_region->name);
+    if (saveResourcesToRFFile(resources, filename)) {
+        printf("saved %s\n", filename);
+    }
+}
+
+static void handleShortcuts()
+{
+    if (ui_searchEditing || !(IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL))) {
+        return;
+    }
+
+    bool shift = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+
+    if (IsKeyPressed(KEY_Z) && !shift) {
+        if (edit_undo(g_history)) {
+            onTreeEdited();
+        }
+    } else if (IsKeyPressed(KEY_Y) || (IsKeyPressed(KEY_Z) && shift)) {
+        if (edit_redo(g_history)) {
+            onTreeEdited();
+        }
+    } else if (IsKeyPressed(KEY_S)) {
+        saveRegion();
+    }
+}
+
+void drawSearchBar(Rectangle bounds)
+{
+    Rectangle boxRect = { bounds.x, bounds.y, bounds.width - 120, bounds.height };
+
+    if (GuiTextBox(boxRect, ui_searchText, SEARCH_QUERY_LEN, ui_searchEditing)) {
+        ui_searchEditing = !ui_searchEditing;
+    }
+
+    // NOTE: re-run on every keystroke; the index keeps this cheap.
+    if (updateSearch()) {
+        panelScroll.y = 0;
+    }
+
+    if (g_search->query[0]) {
+        Rectangle countRect = { boxRect.x + boxRect.width + PANEL_PADDING, bounds.y, 120 - PANEL_PADDING, bounds.height };
+        GuiLabel(countRect, TextFormat("%zu matches", stbds_arrlenu(g_search->results)));
+    }
+}
+
+void drawColumnHeaders(Rectangle bounds)
+{
+    GuiPanel(bounds, NULL);
+
+    const char *arrow = ui_sortAscending ? " ^" : " v";
+    Rectangle nameRect = { bounds.x + PANEL_PADDING, bounds.y + 4, 120, bounds.height - 8 };
+    if (GuiLabelButton(nameRect, "Name")) {
+        setSortKey(UI_SORT_NAME);
+    }
+
+    int oldAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
+
+    float x = ui_columnsX;
+    for (int i = UI_SORT_COMPRESSED; i < UI_NUM_COLUMNS; ++i) {
+        const char *title = ui_sortKey == i ? TextFormat("%s%s", s_columns[i].title, arrow) : s_columns[i].title;
+        if (GuiLabelButton((Rectangle) { x, bounds.y + 4, s_columns[i].width - PANEL_PADDING, bounds.height - 8 }, title)) {
+            setSortKey((ui_sort_t)i);
+        }
+        x += s_columns[i].width;
+    }
+
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, oldAlignment);
 }
 
 void drawContextMenu()
 {
     GuiClearExclusive();
     Vector2 mousePoint = GetMousePosition();
-    int numOptions = 2;
+    int numOptions = 3;
 
     float width = 150;
     float height = numOptions * 18 + 8 * 2;
@@ -194,19 +496,41 @@ void drawContextMenu()
 
     GuiPanel(ctxPanelRect, NULL);
     if (GuiLabelButton((Rectangle) { ctxPanelRect.x + 8, y, width - 16, 18 }, "Extract...")) {
-        extractNodeToFile(ui_ctxMenuTarget);
+        manifest_t *manifest = manifest_load(TextFormat("%s%s", EXTRACT_PATH, EXTRACT_MANIFEST_FILENAME));
+        extractNodeToFile(ui_ctxMenuTarget, manifest);
+        manifest_save(manifest);
+        manifest_free(manifest);
         ui_ctxMenuTarget = NULL;
         GuiClearExclusive();
     }
     y += 18;
 
+    // NOTE: named after the node, e.g. `mario.zip`, next to extracted data.
+    if (GuiLabelButton((Rectangle) { ctxPanelRect.x + 8, y, width - 16, 18 }, "Export ZIP...")) {
+        char name[256];
+        snprintf(name, sizeof(name), "%s", ui_ctxMenuTarget->filename[0] ? ui_ctxMenuTarget->filename : "data");
+        size_t len = strlen(name);
+        if (len > 1 && name[len - 1] == '/') {
+            name[len - 1] = '\0';
+        }
+
+        mkdir_p(EXTRACT_PATH);
+        const char *zipFilename = TextFormat("%s%s.zip", EXTRACT_PATH, name);
+        if (zipexport_node(ui_ctxMenuTarget, zipFilename)) {
+            printf("exported %s\n", zipFilename);
+        }
+        ui_ctxMenuTarget = NULL;
+        GuiClearExclusive();
+    }
+    y += 18;
 
-    int prevState = GuiGetState();
-    GuiSetState(STATE_DISABLED);
     if (GuiLabelButton((Rectangle) { ctxPanelRect.x + 8, y, width - 16, 18 }, "Delete")) {
-        printf("afawwfaf\n");
+        if (edit_delete(g_history, ui_ctxMenuTarget)) {
+            onTreeEdited();
+        }
+        ui_ctxMenuTarget = NULL;
+        GuiClearExclusive();
     }
-    GuiSetState(prevState);
 
     GuiSetExclusive(ctxPanelRect);
 
@@ -218,16 +542,23 @@ void drawContextMenu()
     }
 }
 
-void startExplorerWindow(filetree_node_t *tree)
+void startExplorerWindow(region_t *region, strpool_t *strings)
 {
+    filetree_node_t *tree = region->tree;
     tree->expanded = true;
     tree->children[0]->expanded = true;
 
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_EXPLORER);
+
     SetTraceLogLevel(LOG_WARNING);
-    InitWindow(g_screenWidth, g_screenHeight, "resource(us_en)");
+    InitWindow(g_screenWidth, g_screenHeight, TextFormat("resource(%s)", region->name));
     SetWindowState(FLAG_WINDOW_RESIZABLE);
     SetTargetFPS(60);
     GuiLoadStyleDark();
+    preview_init(PREVIEW_CACHE_CAPACITY);
+    g_search = search_buildIndex(tree);
+    g_history = edit_createHistory(tree, strings);
+    g_region = region;
 
     while (!WindowShouldClose()) {
         if (IsWindowResized()) {
@@ -235,13 +566,31 @@ void startExplorerWindow(filetree_node_t *tree)
             g_screenHeight = GetScreenHeight();
         }
 
+        handleShortcuts();
+
         BeginDrawing();
         ClearBackground(BLACK);
 
+        drawSearchBar((Rectangle) { 0, 0, g_screenWidth, HEADER_HEIGHT });
+
         int x = -1;
-        int y = -1;
+        int y = HEADER_HEIGHT * 2 - 1;
         int w = g_screenWidth+2;
-        int h = g_screenHeight+2;
+        int h = g_screenHeight+2 - HEADER_HEIGHT * 2;
+
+        // The preview pane takes the right side once a file is selected.
+        if (ui_selected) {
+            w = g_screenWidth * 0.55f;
+            drawPreviewPane((Rectangle) { x + w, HEADER_HEIGHT - 1, g_screenWidth + 2 - w, h + HEADER_HEIGHT });
+        }
+
+        // NOTE: columns stay put when the tree scrolls sideways; leave
+        // room for the scroll bar.
+        ui_columnsX = x + w - PANEL_PADDING - 14;
+        for (int i = UI_SORT_COMPRESSED; i < UI_NUM_COLUMNS; ++i) {
+            ui_columnsX -= s_columns[i].width;
+        }
+        drawColumnHeaders((Rectangle) { x, HEADER_HEIGHT - 1, w, HEADER_HEIGHT });
 
         Rectangle view = { 0 };
 
@@ -276,4 +625,15 @@ void startExplorerWindow(filetree_node_t *tree)
 
         EndDrawing();
     }
+
+    preview_shutdown();
+    clearSortedChildren();
+    search_freeIndex(g_search);
+    g_search = NULL;
+    g_searchStale = false;
+    edit_freeHistory(g_history);
+    g_history = NULL;
+    g_region = NULL;
+
+    mem_setTag(prevTag);
 }
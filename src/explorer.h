@@ -1,5 +1,9 @@
 #pragma once
 
 #include "filetree.h"
+#include "regions.h"
+#include "strpool.h"
 
-void startExplorerWindow(filetree_node_t *tree);
+// Browses (and edits) `region`'s tree; `strings` is the pool its paths
+// were interned in.
+void startExplorerWindow(region_t *region, strpool_t *strings);
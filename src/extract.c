@@ -0,0 +1,366 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "config.h"
+#include "extract.h"
+#include "file.h"
+#include "filetree.h"
+#include "ioq.h"
+#include "mem.h"
+#include "origin.h"
+#include "path.h"
+#include "regions.h"
+#include "rf.h"
+#include "trace.h"
+
+static uint32_t crcFileRange(int fd, off_t offset, size_t len)
+{
+    uint8_t buf[0x10000];
+    uint32_t crc = crc32(0, NULL, 0);
+
+    while (len > 0) {
+        size_t chunk = len < sizeof(buf) ? len : sizeof(buf);
+        ssize_t n = pread(fd, buf, chunk, offset);
+        if (n <= 0) {
+            break;
+        }
+        crc = crc32(crc, buf, n);
+        offset += n;
+        len -= n;
+    }
+
+    return crc;
+}
+
+// Reads of packed data and writes of the output files go through one ioq,
+// EXTRACT_QUEUE_DEPTH entries at a time; inflating happens here, between
+// a slot's read completing and its write being queued.
+typedef struct {
+    filetree_node_t *node;
+    char localFilename[4096];
+    char path[4096];
+    char key[4096];
+    uint64_t dataOffset; // of the entry, in `localFilename`
+
+    int fdIn;
+    int fdOut;
+    uint8_t *input;
+    uint8_t *output;
+    uint32_t outputCrc;
+    uint64_t bytes; // counted against EXTRACT_MAX_INFLIGHT_BYTES
+    ioq_req_t req;
+} extract_slot_t;
+
+// What's left to do for an entry once extractPrepare has looked at it.
+typedef enum {
+    EXTRACT_DONE, // written, or already up to date
+    EXTRACT_FAILED,
+    EXTRACT_READ, // needs its data read and inflated
+} extract_step_t;
+
+static bool extractStored(extract_slot_t *slot, manifest_t *manifest)
+{
+    TRACE_BEGIN_DETAIL("extract_stored", slot->node->path);
+
+    int fdIn = open(slot->localFilename, O_RDONLY);
+    if (fdIn < 0) {
+        printf("failed to open %s\n", slot->localFilename);
+        TRACE_END();
+        return false;
+    }
+
+    int fdOut = open(slot->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fdOut < 0) {
+        printf("failed to create %s\n", slot->path);
+        close(fdIn);
+        TRACE_END();
+        return false;
+    }
+
+    resource_t *res = slot->node->res;
+    off_t offset = slot->dataOffset + RES_STORED_HEADER_LEN;
+    size_t len = res->sizeCompressed - RES_STORED_HEADER_LEN;
+    bool copied = file_copyRange(fdIn, offset, fdOut, len);
+    if (!copied) {
+        printf("failed to copy stored data for %s\n", slot->node->path);
+    }
+
+    // NOTE: only hashed when a manifest wants it; the source range is
+    // still hot in the page cache at this point. A failed copy isn't
+    // recorded, so the next run tries again.
+    if (manifest && copied) {
+        uint32_t outputCrc = crcFileRange(fdIn, offset, len);
+        manifest_put(manifest, slot->key, slot->localFilename, res, slot->path, outputCrc);
+    }
+
+    close(fdOut);
+    close(fdIn);
+
+    TRACE_END();
+
+    return copied;
+}
+
+static extract_step_t extractPrepare(extract_slot_t *slot, filetree_node_t *node, manifest_t *manifest)
+{
+    slot->node = node;
+
+    if (!origin_locate(node, slot->localFilename, sizeof(slot->localFilename), &slot->dataOffset)) {
+        printf("%s is in neither the update nor the base game; skipping...\n", node->path);
+        return EXTRACT_FAILED;
+    }
+
+    if (!path_exists(slot->localFilename)) {
+        printf("%s does not exist; skipping %s...\n", slot->localFilename, node->path);
+        return EXTRACT_FAILED;
+    }
+
+    char dataDir[64];
+    filetree_getDataDir(node, dataDir, sizeof(dataDir));
+    snprintf(slot->path, sizeof(slot->path), "%s%s%s", EXTRACT_PATH, dataDir, node->path);
+
+    // NOTE: localized files share paths across regions, so they're keyed
+    // by their data(xx_yy)/ path; shared ones keep the bare path.
+    snprintf(slot->key, sizeof(slot->key), "%s%s", regions_isLocalized(node) ? dataDir : "", node->path);
+
+    // Skip anything extracted before from the same source entry, as long
+    // as what we wrote then is still there.
+    if (manifest) {
+        manifest_entry_t *prev = manifest_get(manifest, slot->key);
+        if (prev
+            && manifest_isSourceUnchanged(prev, slot->localFilename, node->res)
+            && manifest_isOutputIntact(manifest, prev, slot->path)
+        ) {
+            return EXTRACT_DONE;
+        }
+    }
+
+    printf(">>> extracting %s\n", slot->path);
+
+    char dir[4096];
+    path_getDirectory(slot->path, dir, sizeof(dir));
+    mkdir_p(dir);
+
+    // Stored entries need no inflating; hand the copy straight to the kernel.
+    if (resource_isStored(node->res)) {
+        return extractStored(slot, manifest) ? EXTRACT_DONE : EXTRACT_FAILED;
+    }
+
+    return EXTRACT_READ;
+}
+
+// Returns false, having queued nothing, if the source can't be opened.
+static bool extractSubmitRead(ioq_t *ioq, extract_slot_t *slot)
+{
+    resource_t *res = slot->node->res;
+
+    slot->fdIn = open(slot->localFilename, O_RDONLY);
+    if (slot->fdIn < 0) {
+        printf("failed to open %s\n", slot->localFilename);
+        return false;
+    }
+    slot->input = (uint8_t*)mem_malloc(MEM_TAG_EXTRACT, res->sizeCompressed);
+
+    slot->req = (ioq_req_t){
+        .op = IOQ_READ,
+        .fd = slot->fdIn,
+        .buf = slot->input,
+        .len = res->sizeCompressed,
+        .offset = slot->dataOffset,
+        .user = slot,
+    };
+    bool queued = ioq_submit(ioq, &slot->req);
+    assert(queued);
+
+    return true;
+}
+
+// Returns true if the output write got queued; anything else is a failure.
+static bool extractOnRead(ioq_t *ioq, extract_slot_t *slot, manifest_t *manifest)
+{
+    filetree_node_t *node = slot->node;
+
+    close(slot->fdIn);
+    if (slot->req.result != node->res->sizeCompressed) {
+        printf("failed to read %s\n", node->path);
+        return false;
+    }
+
+    TRACE_BEGIN_DETAIL("inflate", node->path);
+
+    uLongf destLen = node->res->sizeUncompressed;
+    slot->output = (uint8_t*)mem_calloc(MEM_TAG_EXTRACT, 1, destLen ? destLen : 1);
+
+    int ret = uncompress(
+        slot->output, &destLen,
+        slot->input, node->res->sizeCompressed
+    );
+
+    mem_free(slot->input);
+    slot->input = NULL;
+
+    // NOTE: nothing gets created (or recorded in the manifest) for an
+    // entry that doesn't inflate, so it isn't mistaken for extracted.
+    if (ret != Z_OK) {
+        printf("failed to inflate %s (%d)\n", node->path, ret);
+        TRACE_END();
+        return false;
+    }
+
+    if (manifest) {
+        slot->outputCrc = crc32(crc32(0, NULL, 0), slot->output, destLen);
+    }
+
+    TRACE_END();
+
+    slot->fdOut = open(slot->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (slot->fdOut < 0) {
+        printf("failed to create %s\n", slot->path);
+        return false;
+    }
+
+    slot->req = (ioq_req_t){
+        .op = IOQ_WRITE,
+        .fd = slot->fdOut,
+        .buf = slot->output,
+        .len = destLen,
+        .user = slot,
+    };
+    bool queued = ioq_submit(ioq, &slot->req);
+    assert(queued);
+
+    return true;
+}
+
+static bool extractOnWrite(extract_slot_t *slot, manifest_t *manifest)
+{
+    close(slot->fdOut);
+
+    if (slot->req.result != slot->req.len) {
+        printf("failed to write %s\n", slot->path);
+        return false;
+    }
+
+    if (manifest) {
+        manifest_put(manifest, slot->key, slot->localFilename, slot->node->res, slot->path, slot->outputCrc);
+    }
+
+    return true;
+}
+
+static void extractRelease(extract_slot_t *slot)
+{
+    mem_free(slot->input);
+    mem_free(slot->output);
+    slot->input = NULL;
+    slot->output = NULL;
+}
+
+size_t extractNodesToFiles(filetree_node_t **nodes, size_t numNodes, manifest_t *manifest)
+{
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_EXTRACT);
+    TRACE_BEGIN("extract");
+
+    ioq_t *ioq = ioq_create(EXTRACT_QUEUE_DEPTH);
+    extract_slot_t *slots = (extract_slot_t*)mem_calloc(MEM_TAG_EXTRACT, EXTRACT_QUEUE_DEPTH, sizeof(*slots));
+    extract_slot_t **freeSlots = NULL;
+    for (int i = EXTRACT_QUEUE_DEPTH - 1; i >= 0; --i) {
+        stbds_arrput(freeSlots, &slots[i]);
+    }
+
+    size_t next = 0;
+    size_t numBusy = 0;
+    size_t numFailed = 0;
+    uint64_t inFlightBytes = 0;
+
+    while (next < numNodes || numBusy > 0) {
+        while (next < numNodes && stbds_arrlenu(freeSlots) > 0) {
+            resource_t *res = nodes[next]->res;
+            uint64_t bytes = (uint64_t)res->sizeCompressed + res->sizeUncompressed;
+            if (numBusy > 0 && inFlightBytes + bytes > EXTRACT_MAX_INFLIGHT_BYTES) {
+                break;
+            }
+
+            extract_slot_t *slot = freeSlots[stbds_arrlenu(freeSlots) - 1];
+            extract_step_t step = extractPrepare(slot, nodes[next++], manifest);
+            if (step == EXTRACT_READ && !extractSubmitRead(ioq, slot)) {
+                step = EXTRACT_FAILED;
+            }
+            if (step != EXTRACT_READ) {
+                numFailed += step == EXTRACT_FAILED;
+                continue;
+            }
+
+            (void)stbds_arrpop(freeSlots);
+            slot->bytes = bytes;
+            inFlightBytes += bytes;
+            numBusy++;
+        }
+
+        if (numBusy == 0) {
+            continue;
+        }
+
+        ioq_req_t *done[EXTRACT_QUEUE_DEPTH];
+        size_t numDone = ioq_reap(ioq, done, EXTRACT_QUEUE_DEPTH, true);
+
+        for (int i = 0; i < numDone; ++i) {
+            extract_slot_t *slot = (extract_slot_t*)done[i]->user;
+
+            if (done[i]->op == IOQ_READ) {
+                if (extractOnRead(ioq, slot, manifest)) {
+                    continue;
+                }
+                numFailed++;
+            } else if (!extractOnWrite(slot, manifest)) {
+                numFailed++;
+            }
+
+            extractRelease(slot);
+            inFlightBytes -= slot->bytes;
+            numBusy--;
+            stbds_arrput(freeSlots, slot);
+        }
+    }
+
+    ioq_free(ioq);
+    stbds_arrfree(freeSlots);
+    mem_free(slots);
+
+    TRACE_END();
+    mem_setTag(prevTag);
+
+    return numFailed;
+}
+
+static void collectFiles(filetree_node_t *node, filetree_node_t ***files)
+{
+    if (node->res && !(node->res->flags & RES_FLAG_DIR)) {
+        stbds_arrput(*files, node);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        collectFiles(node->children[i], files);
+    }
+}
+
+size_t extractNodeToFile(filetree_node_t *node, manifest_t *manifest)
+{
+    filetree_node_t **files = NULL;
+    collectFiles(node, &files);
+
+    size_t numFailed = extractNodesToFiles(files, stbds_arrlenu(files), manifest);
+
+    stbds_arrfree(files);
+
+    return numFailed;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "filetree.h"
+#include "manifest.h"
+
+// Lives in EXTRACT_PATH alongside the extracted data.
+#define EXTRACT_MANIFEST_FILENAME ".dtls_manifest"
+
+// Entries read, inflated and written at once. See extract.c.
+#define EXTRACT_QUEUE_DEPTH (64)
+// Compressed plus inflated bytes those may hold between them; an entry
+// bigger than this on its own still goes through, just by itself.
+#define EXTRACT_MAX_INFLIGHT_BYTES (256 * 1024 * 1024)
+
+// Every file in `node`'s subtree. Both return how many entries couldn't
+// be extracted; anything already up to date doesn't count.
+size_t extractNodeToFile(filetree_node_t *node, manifest_t *manifest);
+size_t extractNodesToFiles(filetree_node_t **nodes, size_t numNodes, manifest_t *manifest);
@@ -1,6 +1,12 @@
+#define _GNU_SOURCE
+
 #include "file.h"
+#include "mem.h"
 #include <stdint.h>
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
 
 void swapEndian16(int16_t *num)
 {
@@ -89,7 +95,7 @@ float file_readFloat(filereader_t *file)
 // FIXME: uhh this should actually use the length...
 char* file_readString(filereader_t *file, size_t len)
 {
-    char *str = strdup((char*)file->data+file->ptr);
+    char *str = mem_strdup(MEM_TAG_OTHER, (char*)file->data+file->ptr);
     file->ptr += len;
 
     return str;
@@ -97,8 +103,45 @@ char* file_readString(filereader_t *file, size_t len)
 
 char* file_readCString(filereader_t *file)
 {
-    char *str = strdup((char*)file->data+file->ptr);
+    char *str = mem_strdup(MEM_TAG_OTHER, (char*)file->data+file->ptr);
     file->ptr += (strlen(str) + 1);
 
     return str;
 }
+
+// Copy `len` bytes starting at `offIn` in `fdIn` to the current position of
+// `fdOut`, letting the kernel move the data where it can. Falls back to
+// `sendfile`, then to plain reads for filesystems that support neither.
+bool file_copyRange(int fdIn, off_t offIn, int fdOut, size_t len)
+{
+    loff_t off = offIn;
+
+    while (len > 0) {
+        ssize_t n = copy_file_range(fdIn, &off, fdOut, NULL, len, 0);
+        if (n <= 0) {
+            break;
+        }
+        len -= n;
+    }
+
+    while (len > 0) {
+        ssize_t n = sendfile(fdOut, fdIn, &off, len);
+        if (n <= 0) {
+            break;
+        }
+        len -= n;
+    }
+
+    uint8_t buf[0x10000];
+    while (len > 0) {
+        size_t chunk = len < sizeof(buf) ? len : sizeof(buf);
+        ssize_t n = pread(fdIn, buf, chunk, off);
+        if (n <= 0 || write(fdOut, buf, n) != n) {
+            return false;
+        }
+        off += n;
+        len -= n;
+    }
+
+    return true;
+}
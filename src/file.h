@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdbool.h>
+#include <sys/types.h>
 
 typedef enum {
     ENDIAN_BIG,
@@ -26,3 +28,5 @@ int32_t file_readInt32(filereader_t *file);
 float file_readFloat(filereader_t *file);
 char* file_readString(filereader_t *file, size_t len);
 char* file_readCString(filereader_t *file);
+
+bool file_copyRange(int fdIn, off_t offIn, int fdOut, size_t len);
@@ -1,14 +1,27 @@
 #include <stdio.h>
 #include <assert.h>
 
-#include <raylib.h>
-
-#include "vendor/stb_ds.h"
+#include "ds.h"
 
+#include "config.h"
 #include "filetree.h"
+#include "mem.h"
+#include "path.h"
+#include "patchlist.h"
+#include "trace.h"
 
 filetree_node_t* filetree_fromRFFile(const char *filename)
 {
+    return filetree_fromRFFileInterned(filename, NULL);
+}
+
+// With a `pool`, every string in the tree is interned there instead of
+// owned by its node; see strpool.h.
+filetree_node_t* filetree_fromRFFileInterned(const char *filename, strpool_t *pool)
+{
+    TRACE_BEGIN_DETAIL("filetree_fromRFFile", filename);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_FILETREE);
+
     resource_t *resources = loadResourcesFromRFFile(filename);
     int lastDepth = 0;
     filetree_node_t *prevNode;
@@ -16,22 +29,30 @@ filetree_node_t* filetree_fromRFFile(const char *filename)
     size_t numResources = stbds_arrlenu(resources);
     for (int i = 0; i < numResources; ++i) {
         resource_t *res = resource_clone(&resources[i]);
+        if (pool) {
+            mem_free(res->filename);
+            res->filename = strpool_intern(pool, resources[i].filename);
+        }
+
         // FIXME: probably pull depth out of flags.
         // this isn't terribly expensive, but what's the point?
         int depth = res->flags & 0xff;
 
-        filetree_node_t *node = (filetree_node_t*)calloc(1, sizeof(*node));
+        filetree_node_t *node = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*node));
         node->parent = NULL;
         node->children = NULL;
         node->path = NULL;
-        node->filename = strdup(res->filename);
         node->res = res;
+        node->ownsRes = true;
+        node->borrowed = pool != NULL;
 
         if (depth == 0) {
-            node->filename = strdup("");
+            node->filename = pool ? strpool_intern(pool, "") : mem_strdup(MEM_TAG_FILETREE, "");
             prevNode = node;
             lastDepth = 0;
         } else {
+            node->filename = pool ? res->filename : mem_strdup(MEM_TAG_FILETREE, res->filename);
+
             if (depth > lastDepth) {
                 node->parent = prevNode;
 
@@ -61,61 +82,81 @@ filetree_node_t* filetree_fromRFFile(const char *filename)
         preRoot = preRoot->parent;
     }
 
-    filetree_node_t *root = (filetree_node_t*)calloc(1, sizeof(*root));
+    filetree_node_t *root = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*root));
+    root->borrowed = pool != NULL;
 
     preRoot->parent = root;
     stbds_arrput(root->children, preRoot);
 
     freeResources(resources);
 
+    mem_setTag(prevTag);
+    TRACE_END();
+
     return root;
 }
 
 void filetree_appendFromPath(filetree_node_t *root, const char *path, int depth)
 {
-    FilePathList pathList = LoadDirectoryFiles(path);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_FILETREE);
+    char **pathList = path_listDirectory(path);
 
     assert(depth <= 0xFF);
 
-    for (int i = 0; i < pathList.count; ++i) {
-        filetree_node_t *node = (filetree_node_t*)calloc(1, sizeof(*node));
+    size_t numPaths = stbds_arrlenu(pathList);
+    for (int i = 0; i < numPaths; ++i) {
+        const char *name = path_getFileName(pathList[i]);
+
+        // dotfiles are ours (manifests, caches) or the editor's, not the mod's
+        if (name[0] == '.') {
+            continue;
+        }
+
+        filetree_node_t *node = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*node));
         node->parent = root;
         node->children = NULL;
-        node->path = strdup(pathList.paths[i]);
+        node->path = mem_strdup(MEM_TAG_FILETREE, pathList[i]);
+        node->sourcePath = mem_strdup(MEM_TAG_FILETREE, pathList[i]);
 
-        resource_t *res = (resource_t*)calloc(1, sizeof(*res));
+        resource_t *res = (resource_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*res));
         node->res = res;
+        node->ownsRes = true;
 
-        if (IsPathFile(node->path)) {
+        if (path_isFile(node->path)) {
             // is file
-            node->filename = strdup(GetFileName(pathList.paths[i]));
-            int size = GetFileLength(node->path);
+            node->filename = mem_strdup(MEM_TAG_FILETREE, name);
+            int size = path_getFileLength(node->path);
             res->sizeCompressed = size;
             res->sizeUncompressed = size;
             res->flags = (RES_FLAG_OVERRIDE | RES_FLAG_NO_LOC);
         } else {
-            node->filename = strdup(TextFormat("%s/", GetFileName(pathList.paths[i])));
+            size_t len = strlen(name) + 2;
+            node->filename = (char*)mem_malloc(MEM_TAG_FILETREE, len);
+            snprintf(node->filename, len, "%s/", name);
             // FIXME: oh god
             if (!strcmp(node->filename, "data/")) {
-                free(node->filename);
-                node->filename = strdup("");
+                mem_free(node->filename);
+                node->filename = mem_strdup(MEM_TAG_FILETREE, "");
             }
             res->flags = (RES_FLAG_DIR);
             filetree_appendFromPath(node, node->path, depth + 1);
         }
 
         res->flags |= (depth & 0xFF);
-        res->filename = strdup(node->filename);
+        res->filename = mem_strdup(MEM_TAG_FILETREE, node->filename);
 
         stbds_arrput(root->children, node);
     }
+
+    path_freeList(pathList);
+    mem_setTag(prevTag);
 }
 
 filetree_node_t* filetree_fromWorkspacePath(const char *path)
 {
-    filetree_node_t *root = (filetree_node_t*)calloc(1, sizeof(*root));
-    root->path = strdup("");
-    root->filename = strdup("");
+    filetree_node_t *root = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*root));
+    root->path = mem_strdup(MEM_TAG_FILETREE, "");
+    root->filename = mem_strdup(MEM_TAG_FILETREE, "");
 
     filetree_appendFromPath(root, path, 0);
 
@@ -151,15 +192,61 @@ void filetree_print(filetree_node_t *root)
 
 void filetree_free(filetree_node_t *root)
 {
-    free(root->filename);
-    free(root->path);
+    if (!root->borrowed) {
+        mem_free(root->filename);
+        mem_free(root->path);
+    }
+    if (root->ownsRes) {
+        if (!root->borrowed) {
+            mem_free(root->res->filename);
+        }
+        mem_free(root->res);
+    }
+    mem_free(root->sourcePath);
+    mem_free(root->packedPath);
 
     size_t numChildren = stbds_arrlenu(root->children);
     for (int i = 0; i < numChildren; ++i) {
         filetree_free(root->children[i]);
     }
+    stbds_arrfree(root->children);
+
+    mem_free(root);
+}
+
+// Deep copy, owning all of its strings and resources, and detached.
+filetree_node_t* filetree_clone(filetree_node_t *node)
+{
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_FILETREE);
+
+    filetree_node_t *clone = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*clone));
+    clone->filename = node->filename ? mem_strdup(MEM_TAG_FILETREE, node->filename) : NULL;
+    clone->path = node->path ? mem_strdup(MEM_TAG_FILETREE, node->path) : NULL;
+    clone->sourcePath = node->sourcePath ? mem_strdup(MEM_TAG_FILETREE, node->sourcePath) : NULL;
+    clone->packedPath = node->packedPath ? mem_strdup(MEM_TAG_FILETREE, node->packedPath) : NULL;
+    clone->region = node->region;
+    clone->origin = node->origin;
+    clone->baseDtIndex = node->baseDtIndex;
+    clone->baseOffset = node->baseOffset;
+    clone->totals = node->totals;
+    clone->flatLen = FILETREE_FLAT_UNKNOWN;
+
+    if (node->res) {
+        clone->res = resource_clone(node->res);
+        clone->ownsRes = true;
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    stbds_arrsetcap(clone->children, numChildren);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_node_t *child = filetree_clone(node->children[i]);
+        child->parent = clone;
+        stbds_arrput(clone->children, child);
+    }
 
-    free(root);
+    mem_setTag(prevTag);
+
+    return clone;
 }
 
 filetree_node_t* filetree_getChildWithFilename(filetree_node_t *node, const char *filename)
@@ -195,9 +282,193 @@ void filetree_merge(filetree_node_t *destNode, filetree_node_t *srcNode)
             filetree_merge(destChild, srcChild);
         } else {
             // otherwise, insert cloned src
-            printf("FIXME: <<< can't insert %s yet!\n", srcChild->path);
+            filetree_node_t *clone = filetree_clone(srcChild);
+            filetree_attach(destNode, clone, filetree_insertionIndex(destNode, clone->filename), NULL);
+            printf("inserting %s...\n", clone->path);
+        }
+    }
+}
+
+static uint32_t s_generation = 0;
+
+// Stamps `node` and every ancestor with a new generation, so cached
+// flattens know this subtree changed; see `filetree_flattenCached`.
+void filetree_touch(filetree_node_t *node)
+{
+    uint32_t generation = __atomic_add_fetch(&s_generation, 1, __ATOMIC_RELAXED);
+
+    for (filetree_node_t *n = node; n; n = n->parent) {
+        n->generation = generation;
+    }
+}
+
+static void filetree_addTotals(filetree_node_t *node, filetree_totals_t totals, bool subtract)
+{
+    // NOTE: unsigned wraparound makes subtracting just adding the negation.
+    if (subtract) {
+        totals.sizeCompressed = -totals.sizeCompressed;
+        totals.sizeUncompressed = -totals.sizeUncompressed;
+        totals.numFiles = -totals.numFiles;
+        totals.numOverrides = -totals.numOverrides;
+    }
+
+    for (filetree_node_t *n = node; n; n = n->parent) {
+        n->totals.sizeCompressed += totals.sizeCompressed;
+        n->totals.sizeUncompressed += totals.sizeUncompressed;
+        n->totals.numFiles += totals.numFiles;
+        n->totals.numOverrides += totals.numOverrides;
+    }
+}
+
+// Where a child named `filename` goes among `parent`'s (sorted) children.
+size_t filetree_insertionIndex(filetree_node_t *parent, const char *filename)
+{
+    size_t numChildren = stbds_arrlenu(parent->children);
+    for (size_t i = 0; i < numChildren; ++i) {
+        const char *other = parent->children[i]->filename;
+        if (strcmp(other ? other : "", filename) > 0) {
+            return i;
         }
     }
+
+    return numChildren;
+}
+
+// Unlinks `node`'s subtree, which keeps everything it had, and takes its
+// totals off the ancestors. Returns where it was among its siblings.
+size_t filetree_detach(filetree_node_t *node)
+{
+    filetree_node_t *parent = node->parent;
+    assert(parent);
+
+    size_t index = 0;
+    size_t numChildren = stbds_arrlenu(parent->children);
+    while (index < numChildren && parent->children[index] != node) {
+        index++;
+    }
+    assert(index < numChildren);
+
+    stbds_arrdel(parent->children, index);
+    node->parent = NULL;
+
+    filetree_addTotals(parent, node->totals, true);
+    filetree_touch(parent);
+
+    return index;
+}
+
+static void filetree_setDepth(filetree_node_t *node, int depth)
+{
+    if (node->res) {
+        node->res->flags = (node->res->flags & ~0xff) | (depth & 0xff);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_setDepth(node->children[i], depth + 1);
+    }
+}
+
+// Links a detached subtree (with its totals aggregated) in as `parent`'s
+// `index`th child. Depths and paths are only redone if it moved; `pool` is
+// used for those of borrowed nodes.
+void filetree_attach(filetree_node_t *parent, filetree_node_t *node, size_t index, strpool_t *pool)
+{
+    stbds_arrins(parent->children, index, node);
+    node->parent = parent;
+
+    int depth = parent->res ? (parent->res->flags & 0xff) + 1 : 0;
+    if (node->res && (node->res->flags & 0xff) != depth) {
+        filetree_setDepth(node, depth);
+    }
+
+    const char *parentPath = parent->path ? parent->path : "";
+    size_t parentLen = strlen(parentPath);
+    bool pathOk = node->path && node->filename
+        && !strncmp(node->path, parentPath, parentLen)
+        && !strcmp(node->path + parentLen, node->filename);
+    if (!pathOk) {
+        fillTreePathsInterned(node, node->borrowed ? pool : NULL);
+    }
+
+    filetree_addTotals(parent, node->totals, false);
+    node->flatLen = FILETREE_FLAT_UNKNOWN;
+    filetree_touch(node);
+}
+
+// Look up a node by its tree path (e.g. "fighter/mario/model/body/c00/model.nud").
+// Nameless nodes (the root, `data/`) are transparent.
+filetree_node_t* filetree_findByPath(filetree_node_t *node, const char *path)
+{
+    if (*path == '\0') {
+        return node;
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_node_t *child = node->children[i];
+        const char *filename = child->filename ? child->filename : "";
+        size_t len = strlen(filename);
+
+        if (len == 0) {
+            filetree_node_t *found = filetree_findByPath(child, path);
+            if (found) {
+                return found;
+            }
+        } else if (!strncmp(path, filename, len)) {
+            if (path[len] == '\0') {
+                return child;
+            } else if (filename[len-1] == '/') {
+                return filetree_findByPath(child, path + len);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+filetree_node_t* getPackingRoot(filetree_node_t *node)
+{
+    filetree_node_t *r = node;
+
+    do {
+        if (!(r->res->flags & RES_FLAG_NO_LOC)) {
+            return r;
+        }
+    } while ((r = r->parent));
+
+    return NULL;
+}
+
+// The packed file holding `node`'s data, i.e. its packing root's.
+bool filetree_getPackedFilename(filetree_node_t *node, char *buf, size_t len)
+{
+    filetree_node_t *pr = getPackingRoot(node);
+    if (!pr) {
+        return false;
+    }
+
+    if (pr->packedPath) {
+        snprintf(buf, len, "%s", pr->packedPath);
+    } else {
+        char dataDir[64];
+        filetree_getDataDir(node, dataDir, sizeof(dataDir));
+        snprintf(buf, len, "%s%s%spacked", UPDATE_CONTENT_PATH, dataDir, pr->path);
+    }
+
+    return true;
+}
+
+// "data/", or "data(xx_yy)/" if `node` is under a localized packing root.
+void filetree_getDataDir(filetree_node_t *node, char *buf, size_t len)
+{
+    filetree_node_t *pr = getPackingRoot(node);
+
+    if (pr && pr->region) {
+        snprintf(buf, len, "data(%s)/", pr->region);
+    } else {
+        snprintf(buf, len, "data/");
+    }
 }
 
 size_t filetree_calculateLength(filetree_node_t *node)
@@ -212,13 +483,38 @@ size_t filetree_calculateLength(filetree_node_t *node)
     return len;
 }
 
+static void filetree_collectNodesInner(filetree_node_t *node, filetree_node_t ***nodes)
+{
+    node->index = stbds_arrlenu(*nodes);
+    stbds_arrput(*nodes, node);
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_collectNodesInner(node->children[i], nodes);
+    }
+
+    node->subtreeEnd = stbds_arrlenu(*nodes);
+}
+
+// Flatten the tree into a pre-order array, numbering every node on the way.
+// A node's subtree is then the range [index, subtreeEnd).
+filetree_node_t** filetree_collectNodes(filetree_node_t *root)
+{
+    filetree_node_t **nodes = NULL;
+    stbds_arrsetcap(nodes, filetree_calculateLength(root));
+
+    filetree_collectNodesInner(root, &nodes);
+
+    return nodes;
+}
+
 void filetree_flattenToResourcesInner(filetree_node_t *node, resource_t *resources)
 {
     // XXX: should this really ever be null?
     if (node->res) {
         resource_t res = { 0 };
         res.packOffset = node->res->packOffset;
-        res.filename = strdup(node->res->filename);
+        res.filename = mem_strdup(MEM_TAG_FILETREE, node->res->filename);
         res.sizeCompressed = node->res->sizeCompressed;
         res.sizeUncompressed = node->res->sizeUncompressed;
         res.timestamp = node->res->timestamp;
@@ -232,6 +528,60 @@ void filetree_flattenToResourcesInner(filetree_node_t *node, resource_t *resourc
     }
 }
 
+static filetree_totals_t filetree_ownTotals(filetree_node_t *node)
+{
+    filetree_totals_t totals = { 0 };
+    resource_t *res = node->res;
+
+    if (res && !(res->flags & RES_FLAG_DIR)) {
+        totals.sizeCompressed = res->sizeCompressed;
+        totals.sizeUncompressed = res->sizeUncompressed;
+        totals.numFiles = 1;
+        totals.numOverrides = (res->flags & RES_FLAG_OVERRIDE) ? 1 : 0;
+    }
+
+    return totals;
+}
+
+// One post-order pass, after which every node's `totals` covers its whole
+// subtree. Only needed once per tree; see `filetree_refreshTotals`.
+void filetree_aggregateTotals(filetree_node_t *node)
+{
+    node->totals = filetree_ownTotals(node);
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_node_t *child = node->children[i];
+        filetree_aggregateTotals(child);
+
+        node->totals.sizeCompressed += child->totals.sizeCompressed;
+        node->totals.sizeUncompressed += child->totals.sizeUncompressed;
+        node->totals.numFiles += child->totals.numFiles;
+        node->totals.numOverrides += child->totals.numOverrides;
+    }
+}
+
+// Call after a file's sizes or override flag changed. Only the difference
+// travels up, through its ancestors; nothing is recounted.
+void filetree_refreshTotals(filetree_node_t *node)
+{
+    if (node->res && (node->res->flags & RES_FLAG_DIR)) {
+        return;
+    }
+
+    // NOTE: unsigned wraparound makes these work as negative deltas too.
+    filetree_totals_t own = filetree_ownTotals(node);
+    filetree_totals_t delta = {
+        own.sizeCompressed - node->totals.sizeCompressed,
+        own.sizeUncompressed - node->totals.sizeUncompressed,
+        own.numFiles - node->totals.numFiles,
+        own.numOverrides - node->totals.numOverrides,
+    };
+
+    filetree_addTotals(node, delta, false);
+    filetree_touch(node);
+}
+
 resource_t* filetree_flattenToResources(filetree_node_t *tree)
 {
     // NOTE: failure to allocate enough memory causes stbds to
@@ -244,3 +594,136 @@ resource_t* filetree_flattenToResources(filetree_node_t *tree)
 
     return resources;
 }
+
+static void filetree_flattenCachedInner(filetree_node_t *node, filetree_flatcache_t *cache, resource_t **resources, int64_t oldPos, size_t parentPos)
+{
+    size_t pos = stbds_arrlenu(*resources);
+    bool known = oldPos >= 0 && node->flatLen != FILETREE_FLAT_UNKNOWN;
+
+    if (known && node->generation <= cache->generation) {
+        // untouched since: take its entries over as they were
+        resource_t *old = &cache->resources[oldPos];
+        resource_t *dest = stbds_arraddnptr(*resources, node->flatLen);
+        memcpy(dest, old, node->flatLen * sizeof(*old));
+        for (uint32_t i = 0; i < node->flatLen; ++i) {
+            old[i].filename = NULL;
+        }
+    } else {
+        if (node->res) {
+            resource_t res = *node->res;
+            res.filename = mem_strdup(MEM_TAG_FILETREE, node->res->filename);
+            stbds_arrput(*resources, res);
+        }
+
+        size_t numChildren = stbds_arrlenu(node->children);
+        for (int i = 0; i < numChildren; ++i) {
+            filetree_node_t *child = node->children[i];
+            int64_t childPos = known ? oldPos + child->flatOffset : -1;
+            filetree_flattenCachedInner(child, cache, resources, childPos, pos);
+        }
+    }
+
+    node->flatOffset = pos - parentPos;
+    node->flatLen = stbds_arrlenu(*resources) - pos;
+}
+
+// Like `filetree_flattenToResources`, but subtrees nothing touched since
+// the last call are copied over from its result wholesale, so after an edit
+// only the path down to it is walked again. The result belongs to `cache`
+// and stays valid until the next call.
+resource_t* filetree_flattenCached(filetree_node_t *tree, filetree_flatcache_t *cache)
+{
+    TRACE_BEGIN("filetree_flattenCached");
+
+    uint32_t generation = __atomic_load_n(&s_generation, __ATOMIC_RELAXED);
+
+    resource_t *resources = NULL;
+    stbds_arrsetcap(resources, stbds_arrlenu(cache->resources));
+
+    filetree_flattenCachedInner(tree, cache, &resources, cache->resources ? 0 : -1, 0);
+
+    // whatever wasn't taken over was deleted or redone
+    freeResources(cache->resources);
+    cache->resources = resources;
+    cache->generation = generation;
+
+    TRACE_END();
+
+    return resources;
+}
+
+void filetree_freeFlatCache(filetree_flatcache_t *cache)
+{
+    freeResources(cache->resources);
+    cache->resources = NULL;
+}
+
+// Construct full paths from hierarchy & filenames. not particularly efficient.
+void fillTreePaths(filetree_node_t *node)
+{
+    fillTreePathsInterned(node, NULL);
+}
+
+static void fillTreePathsInner(filetree_node_t *node, strpool_t *pool)
+{
+    char *path = mem_strdup(MEM_TAG_FILETREE, node->filename ? node->filename : "");
+    filetree_node_t *n = node;
+
+    while (n->parent && n->parent->filename) {
+        n = n->parent;
+
+        char *oldPath = path;
+
+        size_t len = strlen(n->filename) + strlen(oldPath) + 1;
+        path = (char*)mem_malloc(MEM_TAG_FILETREE, len);
+        snprintf(path, len, "%s%s", n->filename, oldPath);
+        mem_free(oldPath);
+    }
+
+    // NOTE: workspace nodes come with their on-disk path here.
+    if (!node->borrowed) {
+        mem_free(node->path);
+    }
+
+    if (pool) {
+        node->path = strpool_intern(pool, path);
+        mem_free(path);
+    } else {
+        node->path = path;
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        fillTreePathsInner(node->children[i], pool);
+    }
+}
+
+void fillTreePathsInterned(filetree_node_t *node, strpool_t *pool)
+{
+    TRACE_BEGIN("fillTreePaths");
+    fillTreePathsInner(node, pool);
+    TRACE_END();
+}
+
+void writeTreePathsToPatchlist(filetree_node_t *node, patchlist_t *patchlist)
+{
+    size_t len = strlen(node->path);
+
+    // TODO: I'm not sure if the len check is actually needed here.
+    // if len == 0, then there's likely a corresponding difference
+    // in the resource that should be checked instead.
+
+    if (len != 0 && !(node->res->flags & RES_FLAG_DIR)) {
+        // FIXME: base dir (data/, data(us_en)/), should be stored
+        // in the tree somewhere. Somewhere? near the root, I imagine lol.
+        char path[4096];
+        snprintf(path, sizeof(path), "data/%s", node->path);
+        patchlist_append(patchlist, path);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_node_t *child = node->children[i];
+        writeTreePathsToPatchlist(child, patchlist);
+    }
+}
@@ -2,8 +2,19 @@
 
 // for size_t
 #include <stdio.h>
+#include <stdint.h>
 
+#include "patchlist.h"
 #include "rf.h"
+#include "strpool.h"
+
+// What a subtree holds; a file counts itself.
+typedef struct {
+    uint64_t sizeCompressed;
+    uint64_t sizeUncompressed;
+    uint32_t numFiles;
+    uint32_t numOverrides;
+} filetree_totals_t;
 
 typedef struct filetree_node_t {
     struct filetree_node_t *parent;
@@ -12,20 +23,77 @@ typedef struct filetree_node_t {
     char *path;
     char *filename;
     resource_t *res;
+    char *sourcePath; // file on disk backing a workspace node
+    char *packedPath; // packing roots only: packed file, if not the update's
+    const char *region; // packing roots only: set if localized, see regions.c
+
+    // see origin.c
+    uint8_t origin; // origin_t
+    uint16_t baseDtIndex; // packing roots with a base copy only
+    uint32_t baseOffset;
 
     bool expanded;
+    bool borrowed; // filename/path/res->filename belong to an index cache or string pool
+    bool ownsRes; // res is freed with the node
+
+    // see diff.c
+    uint64_t hash;
+    uint64_t contentHash;
+    uint8_t diffState;
+
+    // see `filetree_aggregateTotals`
+    filetree_totals_t totals;
+
+    // pre-order position, see `filetree_collectNodes`
+    uint32_t index;
+    uint32_t subtreeEnd;
+
+    // see `filetree_touch` and `filetree_flattenCached`
+    uint32_t generation; // of the last change anywhere in this subtree
+    uint32_t flatOffset; // from the parent's first entry, last flatten
+    uint32_t flatLen; // entries for the whole subtree, last flatten
 } filetree_node_t;
 
+// A node's `flatLen` after it's attached somewhere: its entries can't be
+// found in the last flatten any more.
+#define FILETREE_FLAT_UNKNOWN (UINT32_MAX)
+
+// The last `filetree_flattenCached` of one tree; zeroed to start with.
+typedef struct {
+    resource_t *resources; // stb_ds array, filenames owned here
+    uint32_t generation;
+} filetree_flatcache_t;
+
 filetree_node_t* filetree_fromRFFile(const char *filename);
+filetree_node_t* filetree_fromRFFileInterned(const char *filename, strpool_t *pool);
 filetree_node_t* filetree_fromWorkspacePath(const char *path);
 void filetree_free(filetree_node_t *root);
+filetree_node_t* filetree_clone(filetree_node_t *node);
 
 void filetree_merge(filetree_node_t *destNode, filetree_node_t *srcNode);
+size_t filetree_insertionIndex(filetree_node_t *parent, const char *filename);
+size_t filetree_detach(filetree_node_t *node);
+void filetree_attach(filetree_node_t *parent, filetree_node_t *node, size_t index, strpool_t *pool);
+void filetree_touch(filetree_node_t *node);
 void filetree_appendFromPath(filetree_node_t *root, const char *path, int depth);
 
 size_t filetree_calculateLength(filetree_node_t *node);
+filetree_node_t** filetree_collectNodes(filetree_node_t *root);
 void filetree_printNode(filetree_node_t *node, int depth);
 void filetree_print(filetree_node_t *root);
 filetree_node_t* filetree_getChildWithFilename(filetree_node_t *node, const char *filename);
+filetree_node_t* filetree_findByPath(filetree_node_t *node, const char *path);
+filetree_node_t* getPackingRoot(filetree_node_t *node);
+bool filetree_getPackedFilename(filetree_node_t *node, char *buf, size_t len);
+void filetree_getDataDir(filetree_node_t *node, char *buf, size_t len);
+
+void filetree_aggregateTotals(filetree_node_t *node);
+void filetree_refreshTotals(filetree_node_t *node);
 
 resource_t* filetree_flattenToResources(filetree_node_t *tree);
+resource_t* filetree_flattenCached(filetree_node_t *tree, filetree_flatcache_t *cache);
+void filetree_freeFlatCache(filetree_flatcache_t *cache);
+
+void fillTreePaths(filetree_node_t *node);
+void fillTreePathsInterned(filetree_node_t *node, strpool_t *pool);
+void writeTreePathsToPatchlist(filetree_node_t *node, patchlist_t *patchlist);
@@ -0,0 +1,104 @@
+#include <string.h>
+
+#include "hash.h"
+
+// MurmurHash64A (Austin Appleby, public domain). Not cryptographic; used for
+// change detection and content addressing, where callers that can't afford
+// a collision compare the bytes as well.
+
+#define HASH_M (0xc6a4a7935bd1e995ULL)
+#define HASH_R (47)
+
+uint64_t hash_bytes(const void *data, size_t len, uint64_t seed)
+{
+    const uint8_t *p = (const uint8_t*)data;
+    const uint8_t *end = p + (len & ~(size_t)7);
+    uint64_t h = seed ^ (len * HASH_M);
+
+    for (; p != end; p += 8) {
+        uint64_t k;
+        memcpy(&k, p, 8);
+
+        k *= HASH_M;
+        k ^= k >> HASH_R;
+        k *= HASH_M;
+
+        h ^= k;
+        h *= HASH_M;
+    }
+
+    switch (len & 7) {
+        case 7: h ^= (uint64_t)p[6] << 48; // fallthrough
+        case 6: h ^= (uint64_t)p[5] << 40; // fallthrough
+        case 5: h ^= (uint64_t)p[4] << 32; // fallthrough
+        case 4: h ^= (uint64_t)p[3] << 24; // fallthrough
+        case 3: h ^= (uint64_t)p[2] << 16; // fallthrough
+        case 2: h ^= (uint64_t)p[1] << 8; // fallthrough
+        case 1: h ^= (uint64_t)p[0];
+                h *= HASH_M;
+    }
+
+    h ^= h >> HASH_R;
+    h *= HASH_M;
+    h ^= h >> HASH_R;
+
+    return h;
+}
+
+uint64_t hash_string(const char *str, uint64_t seed)
+{
+    return hash_bytes(str, str ? strlen(str) : 0, seed);
+}
+
+// Finalizer from MurmurHash3, for combining values that are already hashes.
+uint64_t hash_mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+void hash_init(hash_state_t *state, uint64_t seed)
+{
+    state->h = seed;
+    state->len = 0;
+}
+
+void hash_update(hash_state_t *state, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t*)data;
+
+    while (len > 0) {
+        // whole blocks straight from the input when nothing is buffered
+        if (state->len == 0 && len >= HASH_BLOCK_SIZE) {
+            state->h = hash_bytes(p, HASH_BLOCK_SIZE, state->h);
+            p += HASH_BLOCK_SIZE;
+            len -= HASH_BLOCK_SIZE;
+            continue;
+        }
+
+        size_t take = HASH_BLOCK_SIZE - state->len;
+        if (take > len) {
+            take = len;
+        }
+
+        memcpy(state->buf + state->len, p, take);
+        state->len += take;
+        p += take;
+        len -= take;
+
+        if (state->len == HASH_BLOCK_SIZE) {
+            state->h = hash_bytes(state->buf, HASH_BLOCK_SIZE, state->h);
+            state->len = 0;
+        }
+    }
+}
+
+uint64_t hash_final(hash_state_t *state)
+{
+    return hash_bytes(state->buf, state->len, state->h);
+}
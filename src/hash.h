@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Data is hashed in blocks of this size, so a streamed hash only depends on
+// the bytes, not on how they were fed in.
+#define HASH_BLOCK_SIZE (0x10000)
+
+typedef struct {
+    uint64_t h;
+    size_t len;
+    uint8_t buf[HASH_BLOCK_SIZE];
+} hash_state_t;
+
+uint64_t hash_bytes(const void *data, size_t len, uint64_t seed);
+uint64_t hash_string(const char *str, uint64_t seed);
+uint64_t hash_mix(uint64_t h);
+
+void hash_init(hash_state_t *state, uint64_t seed);
+void hash_update(hash_state_t *state, const void *data, size_t len);
+uint64_t hash_final(hash_state_t *state);
@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ds.h"
+
+#include "filetree.h"
+#include "hash.h"
+#include "indexcache.h"
+#include "mem.h"
+#include "trace.h"
+
+// A flattened copy of a resource tree, complete with paths, written after
+// the resource table is first loaded. As long as the table doesn't change,
+// later launches map it and hang the tree's strings straight off the
+// mapping instead of inflating and parsing the table and building paths.
+//
+// NOTE: the nodes themselves are still allocated and linked up from the
+// records on every load; the tree is edited in place, so it can't live in
+// a read-only mapping.
+
+typedef struct {
+    char *key;
+    uint32_t value;
+} indexcache_string_entry_t;
+
+typedef struct {
+    indexcache_header_t header;
+    indexcache_node_t *nodes;
+    char *pool; // stb_ds array
+    indexcache_string_entry_t *strings;
+} indexcache_builder_t;
+
+static bool indexcache_statSource(const char *rfFilename, indexcache_header_t *key)
+{
+    int fd = open(rfFilename, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    fstat(fd, &st);
+
+    key->sourceSize = st.st_size;
+    key->sourceMtimeSec = st.st_mtim.tv_sec;
+    key->sourceMtimeNsec = st.st_mtim.tv_nsec;
+
+    // NOTE: the table itself is compressed, so this is cheap next to
+    // inflating it; it catches edits that kept the size and mtime.
+    hash_state_t *state = (hash_state_t*)mem_malloc(MEM_TAG_FILETREE, sizeof(*state));
+    hash_init(state, 0);
+
+    uint8_t *buf = (uint8_t*)mem_malloc(MEM_TAG_FILETREE, HASH_BLOCK_SIZE);
+    ssize_t n;
+    while ((n = read(fd, buf, HASH_BLOCK_SIZE)) > 0) {
+        hash_update(state, buf, n);
+    }
+
+    key->sourceHash = hash_final(state);
+
+    mem_free(buf);
+    mem_free(state);
+    close(fd);
+
+    return true;
+}
+
+static uint32_t indexcache_intern(indexcache_builder_t *builder, const char *str)
+{
+    if (!str) {
+        return INDEXCACHE_NONE;
+    }
+
+    indexcache_string_entry_t *entry = stbds_shgetp_null(builder->strings, str);
+    if (entry) {
+        return entry->value;
+    }
+
+    uint32_t offset = stbds_arrlenu(builder->pool);
+    size_t len = strlen(str) + 1;
+    memcpy(stbds_arraddnptr(builder->pool, len), str, len);
+    stbds_shput(builder->strings, str, offset);
+
+    return offset;
+}
+
+static void indexcache_addNode(indexcache_builder_t *builder, filetree_node_t *node, uint32_t parent)
+{
+    indexcache_node_t record = {
+        .parent = parent,
+        .filename = indexcache_intern(builder, node->filename),
+        .path = indexcache_intern(builder, node->path),
+        .resFilename = INDEXCACHE_NONE,
+    };
+
+    if (node->res) {
+        record.flags |= INDEXCACHE_NODE_HAS_RES;
+        record.resFilename = indexcache_intern(builder, node->res->filename);
+        record.packOffset = node->res->packOffset;
+        record.sizeCompressed = node->res->sizeCompressed;
+        record.sizeUncompressed = node->res->sizeUncompressed;
+        record.timestamp = node->res->timestamp;
+        record.resFlags = node->res->flags;
+    }
+
+    uint32_t idx = stbds_arrlenu(builder->nodes);
+    stbds_arrput(builder->nodes, record);
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        indexcache_addNode(builder, node->children[i], idx);
+    }
+}
+
+void indexcache_save(filetree_node_t *root, const char *rfFilename, const char *cacheFilename)
+{
+    indexcache_builder_t builder = { 0 };
+    sh_new_arena(builder.strings);
+
+    if (!indexcache_statSource(rfFilename, &builder.header)) {
+        return;
+    }
+
+    indexcache_addNode(&builder, root, INDEXCACHE_NONE);
+
+    builder.header.magic = INDEXCACHE_MAGIC;
+    builder.header.version = INDEXCACHE_VERSION;
+    builder.header.numNodes = stbds_arrlenu(builder.nodes);
+    builder.header.stringPoolSize = stbds_arrlenu(builder.pool);
+
+    char tmpFilename[4096];
+    snprintf(tmpFilename, sizeof(tmpFilename), "%s.tmp", cacheFilename);
+
+    FILE *file = fopen(tmpFilename, "wb");
+    if (file) {
+        fwrite(&builder.header, sizeof(builder.header), 1, file);
+        fwrite(builder.nodes, sizeof(*builder.nodes), builder.header.numNodes, file);
+        fwrite(builder.pool, 1, builder.header.stringPoolSize, file);
+
+        bool ok = !ferror(file);
+        fclose(file);
+
+        if (!ok || rename(tmpFilename, cacheFilename) != 0) {
+            printf("[indexcache] failed to write %s\n", cacheFilename);
+            unlink(tmpFilename);
+        }
+    }
+
+    stbds_shfree(builder.strings);
+    stbds_arrfree(builder.pool);
+    stbds_arrfree(builder.nodes);
+}
+
+// Everything the tree will point at has to be in bounds, since nothing
+// gets copied out of the mapping.
+static bool indexcache_validate(const uint8_t *map, size_t mapSize, const indexcache_header_t *key)
+{
+    if (mapSize < sizeof(indexcache_header_t)) {
+        return false;
+    }
+
+    const indexcache_header_t *header = (const indexcache_header_t*)map;
+
+    if (header->magic != INDEXCACHE_MAGIC
+        || header->version != INDEXCACHE_VERSION
+        || header->sourceSize != key->sourceSize
+        || header->sourceMtimeSec != key->sourceMtimeSec
+        || header->sourceMtimeNsec != key->sourceMtimeNsec
+        || header->sourceHash != key->sourceHash
+        || header->numNodes == 0
+    ) {
+        return false;
+    }
+
+    uint64_t expectedSize = sizeof(*header)
+        + (uint64_t)header->numNodes * sizeof(indexcache_node_t)
+        + header->stringPoolSize;
+
+    if (expectedSize != mapSize) {
+        return false;
+    }
+
+    // NOTE: a terminated pool means any in-bounds offset is a valid string.
+    const char *pool = (const char*)map + mapSize - header->stringPoolSize;
+    if (header->stringPoolSize == 0 || pool[header->stringPoolSize - 1] != '\0') {
+        return false;
+    }
+
+    const indexcache_node_t *nodes = (const indexcache_node_t*)(map + sizeof(*header));
+
+    for (uint32_t i = 0; i < header->numNodes; ++i) {
+        const indexcache_node_t *node = &nodes[i];
+        uint32_t strings[] = { node->filename, node->path, node->resFilename };
+
+        for (int j = 0; j < 3; ++j) {
+            if (strings[j] != INDEXCACHE_NONE && strings[j] >= header->stringPoolSize) {
+                return false;
+            }
+        }
+
+        if ((i == 0) != (node->parent == INDEXCACHE_NONE) || (i > 0 && node->parent >= i)) {
+            return false;
+        }
+
+        if ((node->flags & INDEXCACHE_NODE_HAS_RES) && node->resFilename == INDEXCACHE_NONE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static filetree_node_t* indexcache_buildTree(indexcache_t *cache)
+{
+    const indexcache_header_t *header = (const indexcache_header_t*)cache->map;
+    const indexcache_node_t *records = (const indexcache_node_t*)((uint8_t*)cache->map + sizeof(*header));
+    char *pool = (char*)cache->map + cache->mapSize - header->stringPoolSize;
+
+    filetree_node_t **nodes = (filetree_node_t**)mem_malloc(MEM_TAG_FILETREE, header->numNodes * sizeof(*nodes));
+    cache->resources = (resource_t*)mem_calloc(MEM_TAG_FILETREE, header->numNodes, sizeof(*cache->resources));
+
+    for (uint32_t i = 0; i < header->numNodes; ++i) {
+        const indexcache_node_t *record = &records[i];
+
+        filetree_node_t *node = (filetree_node_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*node));
+        node->borrowed = true;
+        node->filename = record->filename == INDEXCACHE_NONE ? NULL : pool + record->filename;
+        node->path = record->path == INDEXCACHE_NONE ? NULL : pool + record->path;
+
+        if (record->flags & INDEXCACHE_NODE_HAS_RES) {
+            resource_t *res = &cache->resources[i];
+            res->filename = pool + record->resFilename;
+            res->packOffset = record->packOffset;
+            res->sizeCompressed = record->sizeCompressed;
+            res->sizeUncompressed = record->sizeUncompressed;
+            res->timestamp = record->timestamp;
+            res->flags = record->resFlags;
+            node->res = res;
+        }
+
+        if (record->parent != INDEXCACHE_NONE) {
+            node->parent = nodes[record->parent];
+            stbds_arrput(node->parent->children, node);
+        }
+
+        nodes[i] = node;
+    }
+
+    filetree_node_t *root = nodes[0];
+    mem_free(nodes);
+
+    return root;
+}
+
+// Maps the cache for `rfFilename` if it's still good; otherwise loads the
+// table the slow way (interning into `pool`, if any) and writes a new cache
+// for next time. Either way the tree comes back with paths filled in.
+// `*cacheOut` must outlive the tree.
+filetree_node_t* indexcache_loadTree(const char *rfFilename, const char *cacheFilename, strpool_t *pool, indexcache_t **cacheOut)
+{
+    *cacheOut = NULL;
+
+    indexcache_header_t key = { 0 };
+    bool haveKey = indexcache_statSource(rfFilename, &key);
+
+    int fd = haveKey ? open(cacheFilename, O_RDONLY) : -1;
+    if (fd >= 0) {
+        struct stat st;
+        fstat(fd, &st);
+
+        void *map = st.st_size > 0 ? mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        close(fd);
+
+        if (map != MAP_FAILED) {
+            if (indexcache_validate((const uint8_t*)map, st.st_size, &key)) {
+                indexcache_t *cache = (indexcache_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*cache));
+                cache->map = map;
+                cache->mapSize = st.st_size;
+
+                *cacheOut = cache;
+
+                TRACE_BEGIN_DETAIL("indexcache_load", cacheFilename);
+                filetree_node_t *tree = indexcache_buildTree(cache);
+                TRACE_END();
+
+                return tree;
+            }
+
+            munmap(map, st.st_size);
+        }
+    }
+
+    filetree_node_t *tree = filetree_fromRFFileInterned(rfFilename, pool);
+    fillTreePathsInterned(tree, pool);
+
+    if (haveKey) {
+        TRACE_BEGIN_DETAIL("indexcache_save", cacheFilename);
+        indexcache_save(tree, rfFilename, cacheFilename);
+        TRACE_END();
+    }
+
+    return tree;
+}
+
+void indexcache_free(indexcache_t *cache)
+{
+    if (!cache) {
+        return;
+    }
+
+    munmap(cache->map, cache->mapSize);
+    mem_free(cache->resources);
+    mem_free(cache);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+#include "strpool.h"
+
+// Under CACHE_PATH, as e.g. index(us_en).
+#define INDEXCACHE_FILENAME "index"
+#define INDEXCACHE_MAGIC (0x58444944) // "DIDX"
+#define INDEXCACHE_VERSION (1)
+
+#define INDEXCACHE_NONE (0xFFFFFFFF)
+
+typedef enum {
+    INDEXCACHE_NODE_HAS_RES = 0x1,
+} indexcache_node_flag_t;
+
+#pragma pack(push, 1)
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+
+    // what it was built from
+    uint64_t sourceSize;
+    int64_t sourceMtimeSec;
+    int64_t sourceMtimeNsec;
+    uint64_t sourceHash;
+
+    uint32_t numNodes;
+    uint32_t stringPoolSize;
+} indexcache_header_t;
+
+// Pre-order, so every parent comes before its children. Strings are
+// offsets into the pool following the records.
+typedef struct {
+    uint32_t parent;
+    uint32_t flags;
+
+    uint32_t filename;
+    uint32_t path;
+    uint32_t resFilename;
+
+    uint32_t packOffset;
+    uint32_t sizeCompressed;
+    uint32_t sizeUncompressed;
+    uint32_t timestamp;
+    uint32_t resFlags;
+} indexcache_node_t;
+#pragma pack(pop)
+
+// Keeps the mapping alive: the tree's strings point into it.
+typedef struct {
+    void *map;
+    size_t mapSize;
+    resource_t *resources;
+} indexcache_t;
+
+filetree_node_t* indexcache_loadTree(const char *rfFilename, const char *cacheFilename, strpool_t *pool, indexcache_t **cacheOut);
+void indexcache_free(indexcache_t *cache);
+
+void indexcache_save(filetree_node_t *root, const char *rfFilename, const char *cacheFilename);
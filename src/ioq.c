@@ -0,0 +1,489 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <linux/io_uring.h>
+
+#include "ds.h"
+
+#include "ioq.h"
+#include "mem.h"
+#include "threadpool.h"
+
+typedef struct ioq_backend_t {
+    const char *name;
+    bool (*init)(ioq_t *q);
+    void (*free)(ioq_t *q);
+    void (*submit)(ioq_t *q, ioq_req_t *req);
+    size_t (*reap)(ioq_t *q, ioq_req_t **done, size_t max, bool wait);
+} ioq_backend_t;
+
+typedef struct ioq_pool_t ioq_pool_t;
+
+static const ioq_backend_t s_poolBackend;
+static void ioq_poolComplete(ioq_pool_t *p, ioq_req_t *req);
+
+// --- io_uring ---
+//
+// Driven through the raw syscalls, so there's no liburing to depend on.
+// Submissions only reach the kernel at the next reap, all in one
+// io_uring_enter; readv/writev keep it working on 5.1 kernels. If the
+// ring itself stops working, whatever's outstanding fails and the queue
+// carries on with the thread pool instead.
+
+typedef struct {
+    int fd;
+
+    uint8_t *sqRing;
+    size_t sqRingSize;
+    uint8_t *cqRing;
+    size_t cqRingSize;
+    struct io_uring_sqe *sqes;
+    size_t sqesSize;
+
+    unsigned *sqHead;
+    unsigned *sqTail;
+    unsigned sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned cqMask;
+    struct io_uring_cqe *cqes;
+
+    unsigned toSubmit; // queued in the ring, not yet entered
+    ioq_req_t **pending; // stb_ds array, submitted and not yet completed
+} ioq_uring_t;
+
+static void ioq_uringFree(ioq_t *q)
+{
+    ioq_uring_t *u = (ioq_uring_t*)q->impl;
+
+    if (u->sqes) {
+        munmap(u->sqes, u->sqesSize);
+    }
+    if (u->cqRing && u->cqRing != u->sqRing) {
+        munmap(u->cqRing, u->cqRingSize);
+    }
+    if (u->sqRing) {
+        munmap(u->sqRing, u->sqRingSize);
+    }
+    close(u->fd);
+    stbds_arrfree(u->pending);
+    mem_free(u);
+}
+
+static void* ioq_uringMap(int fd, size_t size, off_t offset)
+{
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return ptr == MAP_FAILED ? NULL : ptr;
+}
+
+static bool ioq_uringInit(ioq_t *q)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int fd = syscall(__NR_io_uring_setup, q->depth, &params);
+    if (fd < 0) {
+        return false; // too old, or not allowed (seccomp, io_uring_disabled)
+    }
+
+    ioq_uring_t *u = (ioq_uring_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*u));
+    u->fd = fd;
+    q->impl = u;
+
+    u->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    u->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (u->cqRingSize > u->sqRingSize) {
+            u->sqRingSize = u->cqRingSize;
+        }
+        u->cqRingSize = u->sqRingSize;
+    }
+
+    u->sqRing = (uint8_t*)ioq_uringMap(fd, u->sqRingSize, IORING_OFF_SQ_RING);
+    u->cqRing = (params.features & IORING_FEAT_SINGLE_MMAP)
+        ? u->sqRing
+        : (uint8_t*)ioq_uringMap(fd, u->cqRingSize, IORING_OFF_CQ_RING);
+    u->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = (struct io_uring_sqe*)ioq_uringMap(fd, u->sqesSize, IORING_OFF_SQES);
+
+    if (!u->sqRing || !u->cqRing || !u->sqes) {
+        ioq_uringFree(q);
+        q->impl = NULL;
+        return false;
+    }
+
+    u->sqHead = (unsigned*)(u->sqRing + params.sq_off.head);
+    u->sqTail = (unsigned*)(u->sqRing + params.sq_off.tail);
+    u->sqMask = *(unsigned*)(u->sqRing + params.sq_off.ring_mask);
+    u->sqArray = (unsigned*)(u->sqRing + params.sq_off.array);
+    u->cqHead = (unsigned*)(u->cqRing + params.cq_off.head);
+    u->cqTail = (unsigned*)(u->cqRing + params.cq_off.tail);
+    u->cqMask = *(unsigned*)(u->cqRing + params.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe*)(u->cqRing + params.cq_off.cqes);
+
+    return true;
+}
+
+// NOTE: the ring has at least `depth` entries, and nothing gets queued
+// beyond what's in flight, so there's always room.
+static void ioq_uringQueue(ioq_t *q, ioq_req_t *req)
+{
+    ioq_uring_t *u = (ioq_uring_t*)q->impl;
+
+    unsigned tail = *u->sqTail;
+    unsigned index = tail & u->sqMask;
+    struct io_uring_sqe *sqe = &u->sqes[index];
+
+    req->iov.iov_base = (uint8_t*)req->buf + req->done;
+    req->iov.iov_len = req->len - req->done;
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = req->op == IOQ_READ ? IORING_OP_READV : IORING_OP_WRITEV;
+    sqe->fd = req->fd;
+    sqe->addr = (uintptr_t)&req->iov;
+    sqe->len = 1;
+    sqe->off = req->offset + req->done;
+    sqe->user_data = (uintptr_t)req;
+
+    u->sqArray[index] = index;
+    __atomic_store_n(u->sqTail, tail + 1, __ATOMIC_RELEASE);
+    u->toSubmit++;
+}
+
+static void ioq_uringSubmit(ioq_t *q, ioq_req_t *req)
+{
+    ioq_uring_t *u = (ioq_uring_t*)q->impl;
+
+    stbds_arrput(u->pending, req);
+    ioq_uringQueue(q, req);
+}
+
+static void ioq_uringRetire(ioq_uring_t *u, ioq_req_t *req)
+{
+    for (size_t i = 0; i < stbds_arrlenu(u->pending); ++i) {
+        if (u->pending[i] == req) {
+            stbds_arrdelswap(u->pending, i);
+            return;
+        }
+    }
+}
+
+// Returns 0, or -errno once the ring is beyond use. EAGAIN and EBUSY
+// aren't: the caller drains the completion queue and comes back.
+static int ioq_uringEnter(ioq_uring_t *u, bool wait)
+{
+    unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+
+    for (;;) {
+        int ret = syscall(__NR_io_uring_enter, u->fd, u->toSubmit, wait ? 1 : 0, flags, NULL, 0);
+        if (ret >= 0) {
+            u->toSubmit -= ret;
+            return 0;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EBUSY) {
+            return 0;
+        }
+
+        return -errno;
+    }
+}
+
+// Moves the queue over to the thread pool, which then hands back what
+// was outstanding like any other completion. Requests the kernel never
+// picked up fail with `err`. The ones it did are waited out first, since
+// they may still be writing to their buffers, and keep their results;
+// only a short transfer, which can't be carried on, fails too.
+static size_t ioq_uringFallBack(ioq_t *q, int err, ioq_req_t **done, size_t max, bool wait)
+{
+    ioq_uring_t *u = (ioq_uring_t*)q->impl;
+    printf("[ioq] io_uring_enter failed (%s); falling back to %s\n", strerror(-err), s_poolBackend.name);
+
+    ioq_req_t **finished = NULL;
+
+    unsigned sqHead = __atomic_load_n(u->sqHead, __ATOMIC_ACQUIRE);
+    for (unsigned i = sqHead; i != *u->sqTail; ++i) {
+        struct io_uring_sqe *sqe = &u->sqes[u->sqArray[i & u->sqMask]];
+        ioq_req_t *req = (ioq_req_t*)(uintptr_t)sqe->user_data;
+        req->result = err;
+        ioq_uringRetire(u, req);
+        stbds_arrput(finished, req);
+    }
+
+    // NOTE: completions can't be waited for through the ring any more;
+    // the sleep gives the kernel a chance to post them.
+    while (stbds_arrlenu(u->pending) > 0) {
+        unsigned head = *u->cqHead;
+        unsigned tail = __atomic_load_n(u->cqTail, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            nanosleep(&(struct timespec){ .tv_nsec = 1000000 }, NULL);
+            continue;
+        }
+
+        for (; head != tail; ++head) {
+            struct io_uring_cqe *cqe = &u->cqes[head & u->cqMask];
+            ioq_req_t *req = (ioq_req_t*)(uintptr_t)cqe->user_data;
+            int res = cqe->res;
+
+            req->done += res > 0 ? res : 0;
+            if (res < 0) {
+                req->result = res;
+            } else {
+                req->result = res > 0 && req->done < req->len ? err : (ssize_t)req->done;
+            }
+            ioq_uringRetire(u, req);
+            stbds_arrput(finished, req);
+        }
+        __atomic_store_n(u->cqHead, head, __ATOMIC_RELEASE);
+    }
+
+    ioq_uringFree(q);
+
+    s_poolBackend.init(q);
+    q->backend = &s_poolBackend;
+
+    for (size_t i = 0; i < stbds_arrlenu(finished); ++i) {
+        ioq_poolComplete((ioq_pool_t*)q->impl, finished[i]);
+    }
+    stbds_arrfree(finished);
+
+    return s_poolBackend.reap(q, done, max, wait);
+}
+
+static size_t ioq_uringReap(ioq_t *q, ioq_req_t **done, size_t max, bool wait)
+{
+    ioq_uring_t *u = (ioq_uring_t*)q->impl;
+    size_t n = 0;
+
+    for (;;) {
+        bool block = wait && n == 0 && q->inFlight > 0;
+        if (u->toSubmit || block) {
+            int err = ioq_uringEnter(u, block);
+            if (err) {
+                return n + ioq_uringFallBack(q, err, done + n, max - n, wait && n == 0);
+            }
+        }
+
+        unsigned head = *u->cqHead;
+        unsigned tail = __atomic_load_n(u->cqTail, __ATOMIC_ACQUIRE);
+
+        while (head != tail && n < max) {
+            struct io_uring_cqe *cqe = &u->cqes[head & u->cqMask];
+            ioq_req_t *req = (ioq_req_t*)(uintptr_t)cqe->user_data;
+            int res = cqe->res;
+            head++;
+
+            if (res > 0 && req->done + res < req->len) {
+                req->done += res;
+                ioq_uringQueue(q, req); // short; go again for the rest
+                continue;
+            }
+
+            req->done += res > 0 ? res : 0;
+            req->result = res < 0 ? res : (ssize_t)req->done;
+            ioq_uringRetire(u, req);
+            done[n++] = req;
+        }
+
+        __atomic_store_n(u->cqHead, head, __ATOMIC_RELEASE);
+
+        if (n > 0 || !wait || q->inFlight == 0) {
+            break;
+        }
+    }
+
+    // anything resubmitted above shouldn't wait for the next reap
+    if (u->toSubmit) {
+        int err = ioq_uringEnter(u, false);
+        if (err) {
+            return n + ioq_uringFallBack(q, err, done + n, max - n, false);
+        }
+    }
+
+    return n;
+}
+
+static const ioq_backend_t s_uringBackend = {
+    "io_uring", ioq_uringInit, ioq_uringFree, ioq_uringSubmit, ioq_uringReap,
+};
+
+// --- pread/pwrite on a thread pool ---
+
+struct ioq_pool_t {
+    threadpool_t *pool;
+    pthread_mutex_t lock;
+    pthread_cond_t hasDone;
+    ioq_req_t **done; // stb_ds array, in completion order
+};
+
+typedef struct {
+    ioq_pool_t *p;
+    ioq_req_t *req;
+} ioq_poolJob_t;
+
+static bool ioq_poolInit(ioq_t *q)
+{
+    ioq_pool_t *p = (ioq_pool_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*p));
+    p->pool = threadpool_create(q->depth < IOQ_MAX_THREADS ? q->depth : IOQ_MAX_THREADS);
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->hasDone, NULL);
+    q->impl = p;
+
+    return true;
+}
+
+static void ioq_poolFree(ioq_t *q)
+{
+    ioq_pool_t *p = (ioq_pool_t*)q->impl;
+
+    threadpool_free(p->pool);
+    pthread_cond_destroy(&p->hasDone);
+    pthread_mutex_destroy(&p->lock);
+    stbds_arrfree(p->done);
+    mem_free(p);
+}
+
+static void ioq_poolComplete(ioq_pool_t *p, ioq_req_t *req)
+{
+    pthread_mutex_lock(&p->lock);
+    stbds_arrput(p->done, req);
+    pthread_cond_signal(&p->hasDone);
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void ioq_poolJob(void *arg)
+{
+    ioq_poolJob_t *job = (ioq_poolJob_t*)arg;
+    ioq_pool_t *p = job->p;
+    ioq_req_t *req = job->req;
+    mem_free(job);
+
+    int err = 0;
+    while (req->done < req->len) {
+        uint8_t *buf = (uint8_t*)req->buf + req->done;
+        size_t len = req->len - req->done;
+        off_t offset = req->offset + req->done;
+
+        ssize_t n = req->op == IOQ_READ ? pread(req->fd, buf, len, offset) : pwrite(req->fd, buf, len, offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            err = errno;
+        }
+        if (n <= 0) {
+            break;
+        }
+
+        req->done += n;
+    }
+
+    req->result = err ? -err : (ssize_t)req->done;
+    ioq_poolComplete(p, req);
+}
+
+static void ioq_poolSubmit(ioq_t *q, ioq_req_t *req)
+{
+    ioq_poolJob_t *job = (ioq_poolJob_t*)mem_malloc(MEM_TAG_EXTRACT, sizeof(*job));
+    job->p = (ioq_pool_t*)q->impl;
+    job->req = req;
+
+    threadpool_submit(job->p->pool, ioq_poolJob, job);
+}
+
+static size_t ioq_poolReap(ioq_t *q, ioq_req_t **done, size_t max, bool wait)
+{
+    ioq_pool_t *p = (ioq_pool_t*)q->impl;
+
+    pthread_mutex_lock(&p->lock);
+
+    while (wait && q->inFlight > 0 && stbds_arrlenu(p->done) == 0) {
+        pthread_cond_wait(&p->hasDone, &p->lock);
+    }
+
+    size_t n = stbds_arrlenu(p->done);
+    if (n > max) {
+        n = max;
+    }
+    memcpy(done, p->done, n * sizeof(*done));
+    stbds_arrdeln(p->done, 0, n);
+
+    pthread_mutex_unlock(&p->lock);
+
+    return n;
+}
+
+static const ioq_backend_t s_poolBackend = {
+    "pread", ioq_poolInit, ioq_poolFree, ioq_poolSubmit, ioq_poolReap,
+};
+
+// ---
+
+ioq_t* ioq_create(unsigned depth)
+{
+    ioq_t *q = (ioq_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*q));
+    q->depth = depth ? depth : 1;
+
+    const char *setting = getenv(IOQ_ENV_VAR);
+    bool forcePool = setting && !strcmp(setting, s_poolBackend.name);
+
+    if (!forcePool && s_uringBackend.init(q)) {
+        q->backend = &s_uringBackend;
+    } else {
+        s_poolBackend.init(q);
+        q->backend = &s_poolBackend;
+    }
+
+    return q;
+}
+
+// Anything still in flight is waited for first.
+void ioq_free(ioq_t *q)
+{
+    ioq_req_t *done[64];
+    while (q->inFlight > 0) {
+        ioq_reap(q, done, 64, true);
+    }
+
+    q->backend->free(q);
+    mem_free(q);
+}
+
+const char* ioq_backendName(ioq_t *q)
+{
+    return q->backend->name;
+}
+
+bool ioq_submit(ioq_t *q, ioq_req_t *req)
+{
+    if (q->inFlight >= q->depth) {
+        return false;
+    }
+
+    req->done = 0;
+    req->result = 0;
+    q->inFlight++;
+    q->backend->submit(q, req);
+
+    return true;
+}
+
+size_t ioq_reap(ioq_t *q, ioq_req_t **done, size_t max, bool wait)
+{
+    size_t n = q->backend->reap(q, done, max, wait);
+    q->inFlight -= n;
+
+    return n;
+}
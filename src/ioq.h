@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+// Batched positional I/O: queue up reads and writes, then reap them as
+// they finish, in whatever order that is. Backed by io_uring where the
+// kernel allows it, otherwise by a pool of threads doing pread/pwrite.
+// DTLS_IOQ=pread forces the latter.
+//
+// Either way a request is only complete once it transferred everything
+// or hit EOF/an error; short transfers are resubmitted internally.
+
+#define IOQ_ENV_VAR "DTLS_IOQ"
+
+// Fallback threads, at most. More than this stops helping even on
+// network storage.
+#define IOQ_MAX_THREADS (16)
+
+typedef enum {
+    IOQ_READ,
+    IOQ_WRITE,
+} ioq_op_t;
+
+typedef struct {
+    ioq_op_t op;
+    int fd;
+    void *buf;
+    size_t len;
+    uint64_t offset;
+    void *user;
+
+    // bytes transferred (less than `len` only at EOF), or -errno
+    ssize_t result;
+
+    // backend-private
+    size_t done;
+    struct iovec iov;
+} ioq_req_t;
+
+struct ioq_backend_t;
+
+typedef struct {
+    const struct ioq_backend_t *backend;
+    void *impl;
+    unsigned depth;
+    unsigned inFlight;
+} ioq_t;
+
+// `depth` is how many requests may be in flight at once.
+ioq_t* ioq_create(unsigned depth);
+void ioq_free(ioq_t *q);
+const char* ioq_backendName(ioq_t *q);
+
+// `req` has to stay put until it's reaped. Returns false, queueing
+// nothing, if `depth` requests are already in flight.
+bool ioq_submit(ioq_t *q, ioq_req_t *req);
+
+// Up to `max` completed requests into `done`. With `wait`, blocks until
+// there's at least one, unless nothing is in flight.
+size_t ioq_reap(ioq_t *q, ioq_req_t **done, size_t max, bool wait);
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds.h"
+
+#include "lrucache.h"
+#include "mem.h"
+
+static void lrucache_unlink(lrucache_t *cache, lrucache_blob_t *blob)
+{
+    if (blob->prev) {
+        blob->prev->next = blob->next;
+    } else {
+        cache->head = blob->next;
+    }
+
+    if (blob->next) {
+        blob->next->prev = blob->prev;
+    } else {
+        cache->tail = blob->prev;
+    }
+
+    blob->prev = NULL;
+    blob->next = NULL;
+}
+
+static void lrucache_pushFront(lrucache_t *cache, lrucache_blob_t *blob)
+{
+    blob->prev = NULL;
+    blob->next = cache->head;
+
+    if (cache->head) {
+        cache->head->prev = blob;
+    } else {
+        cache->tail = blob;
+    }
+
+    cache->head = blob;
+}
+
+static void lrucache_freeBlob(lrucache_blob_t *blob)
+{
+    mem_free(blob->key);
+    mem_free(blob->data);
+    mem_free(blob);
+}
+
+// Drop `blob` from the cache. It is freed now, or on its last release.
+static void lrucache_evict(lrucache_t *cache, lrucache_blob_t *blob)
+{
+    lrucache_unlink(cache, blob);
+    (void)stbds_shdel(cache->map, blob->key);
+    cache->used -= blob->size;
+    blob->linked = false;
+
+    if (blob->refs == 0) {
+        lrucache_freeBlob(blob);
+    }
+}
+
+lrucache_t* lrucache_create(size_t capacity)
+{
+    lrucache_t *cache = (lrucache_t*)mem_calloc(MEM_TAG_EXPLORER, 1, sizeof(*cache));
+    cache->capacity = capacity;
+    pthread_mutex_init(&cache->lock, NULL);
+
+    return cache;
+}
+
+void lrucache_free(lrucache_t *cache)
+{
+    while (cache->tail) {
+        lrucache_evict(cache, cache->tail);
+    }
+
+    stbds_shfree(cache->map);
+    pthread_mutex_destroy(&cache->lock);
+    mem_free(cache);
+}
+
+lrucache_blob_t* lrucache_get(lrucache_t *cache, const char *key)
+{
+    pthread_mutex_lock(&cache->lock);
+
+    lrucache_blob_t *blob = stbds_shget(cache->map, key);
+    if (blob) {
+        lrucache_unlink(cache, blob);
+        lrucache_pushFront(cache, blob);
+        blob->refs++;
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+
+    return blob;
+}
+
+// Takes ownership of `data` and returns the new blob, already retained.
+// Blobs bigger than the whole cache are handed back without being cached.
+lrucache_blob_t* lrucache_put(lrucache_t *cache, const char *key, uint8_t *data, size_t size)
+{
+    lrucache_blob_t *blob = (lrucache_blob_t*)mem_calloc(MEM_TAG_EXPLORER, 1, sizeof(*blob));
+    blob->key = mem_strdup(MEM_TAG_EXPLORER, key);
+    blob->data = data;
+    blob->size = size;
+    blob->refs = 1;
+
+    if (size > cache->capacity) {
+        return blob;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+
+    lrucache_blob_t *old = stbds_shget(cache->map, key);
+    if (old) {
+        lrucache_evict(cache, old);
+    }
+
+    while (cache->tail && cache->used + size > cache->capacity) {
+        lrucache_evict(cache, cache->tail);
+    }
+
+    stbds_shput(cache->map, blob->key, blob);
+    lrucache_pushFront(cache, blob);
+    cache->used += size;
+    blob->linked = true;
+
+    pthread_mutex_unlock(&cache->lock);
+
+    return blob;
+}
+
+void lrucache_release(lrucache_t *cache, lrucache_blob_t *blob)
+{
+    pthread_mutex_lock(&cache->lock);
+
+    bool dead = (--blob->refs == 0) && !blob->linked;
+
+    pthread_mutex_unlock(&cache->lock);
+
+    if (dead) {
+        lrucache_freeBlob(blob);
+    }
+}
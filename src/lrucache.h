@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+
+typedef struct lrucache_blob_t {
+    char *key;
+    uint8_t *data;
+    size_t size;
+
+    int refs;
+    bool linked; // still owned by the cache
+    struct lrucache_blob_t *prev;
+    struct lrucache_blob_t *next;
+} lrucache_blob_t;
+
+typedef struct {
+    char *key;
+    lrucache_blob_t *value;
+} lrucache_entry_t;
+
+// Size-bounded, thread-safe LRU of heap blobs keyed by string. Blobs handed
+// out are reference counted, so eviction never frees one still in use.
+typedef struct {
+    size_t capacity;
+    size_t used;
+
+    lrucache_blob_t *head; // most recently used
+    lrucache_blob_t *tail;
+    lrucache_entry_t *map;
+
+    pthread_mutex_t lock;
+} lrucache_t;
+
+lrucache_t* lrucache_create(size_t capacity);
+void lrucache_free(lrucache_t *cache);
+
+lrucache_blob_t* lrucache_get(lrucache_t *cache, const char *key);
+lrucache_blob_t* lrucache_put(lrucache_t *cache, const char *key, uint8_t *data, size_t size);
+void lrucache_release(lrucache_t *cache, lrucache_blob_t *blob);
@@ -2,20 +2,23 @@
 #include <assert.h>
 #include <stdlib.h>
 
-#include "stb_ds.h"
+#include "ds.h"
 
 #include "ls.h"
 #include "file.h"
+#include "mem.h"
 
 ls_t* ls_load(const char *filename)
 {
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_LS);
+
     FILE *fd = fopen(filename, "rb");
     assert(fd && "Cannot open file");
 
     fseek(fd, 0, SEEK_END);
     size_t dataSize = ftell(fd);
     fseek(fd, 0, SEEK_SET);
-    uint8_t *data_ = (uint8_t*)malloc(dataSize);
+    uint8_t *data_ = (uint8_t*)mem_malloc(MEM_TAG_LS, dataSize);
 
     filereader_t file = {
         .data = data_,
@@ -26,7 +29,7 @@ ls_t* ls_load(const char *filename)
     fread(file.data, dataSize, 1, fd);
     fclose(fd);
 
-    ls_t *ls = (ls_t*)calloc(1, sizeof(*ls));
+    ls_t *ls = (ls_t*)mem_calloc(MEM_TAG_LS, 1, sizeof(*ls));
     ls->magic = file_readUInt16(&file);
     ls->version = file_readUInt16(&file);
     ls->numEntries = file_readInt32(&file);
@@ -43,7 +46,8 @@ ls_t* ls_load(const char *filename)
         stbds_arrput(ls->entries, entry);
     }
 
-    free(data_);
+    mem_free(data_);
+    mem_setTag(prevTag);
 
     return ls;
 }
@@ -51,7 +55,7 @@ ls_t* ls_load(const char *filename)
 void ls_free(ls_t *ls)
 {
     stbds_arrfree(ls->entries);
-    free(ls);
+    mem_free(ls);
 }
 
 void ls_entry_print(ls_entry_t *entry)
@@ -22,4 +22,4 @@ typedef struct {
 
 ls_t* ls_load(const char *filename);
 void ls_free(ls_t *ls);
-void printLsEntry(ls_entry_t *entry);
+void ls_entry_print(ls_entry_t *entry);
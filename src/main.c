@@ -1,101 +1,93 @@
 #include <stdio.h>
+#include <assert.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <raylib.h>
 #include <raymath.h>
 
-#define STB_DS_IMPLEMENTATION
-#include "vendor/stb_ds.h"
+#include "ds.h"
 
+#include "build.h"
+#include "cli.h"
 #include "config.h"
+#include "diff.h"
 #include "rf.h"
-#include "patchlist.h"
 #include "filetree.h"
 #include "explorer.h"
+#include "mem.h"
+#include "regions.h"
+#include "trace.h"
 
-// Construct full paths from hierarchy & filenames. not particularly efficient.
-void fillTreePaths(filetree_node_t *node)
+int main(int argc, char **argv)
 {
-    node->path = strdup(node->filename ? node->filename : "");
-    filetree_node_t *n = node;
-
-    while (n->parent && n->parent->filename) {
-        n = n->parent;
-
-        char *oldPath = node->path;
-
-        node->path = strdup(TextFormat("%s%s", n->filename, oldPath));
-        free(oldPath);
+    mem_init(getenv(MEM_ENV_VAR));
+
+    // `--trace <file>` (or DTLS_TRACE=<file>) records a Chrome trace of
+    // everything up to the explorer window, or of the whole command.
+    const char *traceFilename = getenv(TRACE_ENV_VAR);
+    if (argc > 2 && !strcmp(argv[1], "--trace")) {
+        traceFilename = argv[2];
+        argc -= 2;
+        argv += 2;
     }
+    trace_init(traceFilename);
 
-    size_t numChildren = stbds_arrlenu(node->children);
-    for (int i = 0; i < numChildren; ++i) {
-        fillTreePaths(node->children[i]);
+    // `dtls <command> ...` runs headless and exits; see cli.c.
+    if (argc > 1 && cli_isCommand(argv[1])) {
+        int ret = cli_run(argc - 1, argv + 1);
+        trace_shutdown();
+        return ret;
     }
-}
 
-void writeTreePathsToPatchlist(filetree_node_t *node, patchlist_t *patchlist)
-{
-    size_t len = strlen(node->path);
+    TRACE_BEGIN("config_load");
+    config_load();
+    TRACE_END();
 
-    // TODO: I'm not sure if the len check is actually needed here.
-    // if len == 0, then there's likely a corresponding difference
-    // in the resource that should be checked instead.
+    TRACE_BEGIN("regions_load");
+    regions_t *regions = regions_load(UPDATE_CONTENT_PATH, CACHE_PATH);
+    region_t *primary = regions_getPrimary(regions);
+    assert(primary && "no resource tables found");
+    TRACE_END();
 
-    if (len != 0 && !(node->res->flags & RES_FLAG_DIR)) {
-        // FIXME: base dir (data/, data(us_en)/), should be stored
-        // in the tree somewhere. Somewhere? near the root, I imagine lol.
-        const char *path = TextFormat("data/%s", node->path);
-        patchlist_append(patchlist, path);
-    }
+    filetree_node_t *resFileTree = primary->tree;
 
-    size_t numChildren = stbds_arrlenu(node->children);
-    for (int i = 0; i < numChildren; ++i) {
-        filetree_node_t *child = node->children[i];
-        writeTreePathsToPatchlist(child, patchlist);
-    }
-}
-
-int main(int argc, char **argv)
-{
-    config_load();
-
-    const char *s;
-    
-    s = TextFormat("%s%s", UPDATE_CONTENT_PATH, "resource(us_en)");
-    filetree_node_t *resFileTree = filetree_fromRFFile(s);
+    TRACE_BEGIN("workspace_load");
     filetree_node_t *localFileTree = filetree_fromWorkspacePath(MOD_WORKSPACE_PATH);
 
     // NOTE: populate `path` fields
-    fillTreePaths(resFileTree);
     fillTreePaths(localFileTree);
+    TRACE_END();
 
     // FIXME: this was the old strategy. rather than clobber the (still useful)
     // original resources, it would be prudent to keep the trees separate until
     // the time of export.
     // filetree_merge(resFileTree, localFileTree);
 
-    {
-        s = TextFormat("%s%s", UPDATE_CONTENT_PATH, "patchlist");
-        patchlist_t *patchlist = patchlist_loadFromFile(s);
-        writeTreePathsToPatchlist(localFileTree, patchlist);
-        s = TextFormat("%s%s", MOD_CONTENT_PATH, "patchlist");
-        patchlist_saveToFile(patchlist, s);
-        patchlist_free(patchlist);
-    }
+    build_run(regions, localFileTree);
+
+    // `--diff <resource file>`: compare against another resource table
+    // (e.g. the previous update's), report what changed and color it in
+    // the explorer.
+    if (argc > 2 && !strcmp(argv[1], "--diff")) {
+        filetree_node_t *otherTree = filetree_fromRFFile(argv[2]);
+        fillTreePaths(otherTree);
 
-    {
-        resource_t *newResources = filetree_flattenToResources(resFileTree);
-        s = TextFormat("%s%s", MOD_CONTENT_PATH, "resource(us_en)");
-        saveResourcesToRFFile(newResources, s);
-        freeResources(newResources);
+        diff_entry_t *diff = diff_trees(otherTree, resFileTree, DIFF_COMPARE_METADATA);
+        diff_printReport(diff, stdout);
+        diff_free(diff);
+
+        filetree_free(otherTree);
     }
 
-    startExplorerWindow(resFileTree);
+    trace_shutdown();
+
+    startExplorerWindow(primary, regions->strings);
 
-    filetree_free(resFileTree);
     filetree_free(localFileTree);
+    regions_free(regions);
 
     return 0;
 }
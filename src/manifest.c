@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include "ds.h"
+
+#include "manifest.h"
+#include "mem.h"
+
+// NOTE: the manifest is plain text so it can be inspected (or deleted)
+// by hand: tab-separated fields, numbers in hex.
+// path, source, packOffset, sizeCompressed, timestamp, outputSize, outputMtime, outputCrc
+
+static void manifest_freeEntry(manifest_entry_t *entry)
+{
+    mem_free(entry->source);
+}
+
+manifest_t* manifest_load(const char *filename)
+{
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_EXTRACT);
+
+    manifest_t *manifest = (manifest_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*manifest));
+    manifest->filename = mem_strdup(MEM_TAG_EXTRACT, filename);
+    sh_new_strdup(manifest->entries);
+
+    FILE *file = fopen(filename, "r");
+    if (!file) {
+        // first extraction into this directory
+        mem_setTag(prevTag);
+        return manifest;
+    }
+
+    char line[2048];
+    while (fgets(line, sizeof(line), file)) {
+        char *fields[8] = { 0 };
+        char *save = NULL;
+        int numFields = 0;
+
+        line[strcspn(line, "\n")] = '\0';
+        for (char *tok = strtok_r(line, "\t", &save); tok && numFields < 8; tok = strtok_r(NULL, "\t", &save)) {
+            fields[numFields++] = tok;
+        }
+
+        if (numFields != 8) {
+            printf("[manifest] ignoring malformed line in %s\n", filename);
+            continue;
+        }
+
+        manifest_entry_t entry = {
+            .key = fields[0],
+            .source = mem_strdup(MEM_TAG_EXTRACT, fields[1]),
+            .packOffset = strtoul(fields[2], NULL, 16),
+            .sizeCompressed = strtoul(fields[3], NULL, 16),
+            .timestamp = strtoul(fields[4], NULL, 16),
+            .outputSize = strtoull(fields[5], NULL, 16),
+            .outputMtime = strtoll(fields[6], NULL, 16),
+            .outputCrc = strtoul(fields[7], NULL, 16),
+        };
+
+        stbds_shputs(manifest->entries, entry);
+    }
+
+    fclose(file);
+    mem_setTag(prevTag);
+
+    return manifest;
+}
+
+void manifest_save(manifest_t *manifest)
+{
+    if (!manifest->dirty) {
+        return;
+    }
+
+    // write next to the real file and swap it in, so an interrupted save
+    // can't leave a truncated manifest behind.
+    size_t tmpLen = strlen(manifest->filename) + 5;
+    char *tmpFilename = (char*)mem_malloc(MEM_TAG_EXTRACT, tmpLen);
+    snprintf(tmpFilename, tmpLen, "%s.tmp", manifest->filename);
+
+    FILE *file = fopen(tmpFilename, "w");
+    assert(file && "[manifest] cannot write manifest");
+
+    size_t numEntries = stbds_shlenu(manifest->entries);
+    for (int i = 0; i < numEntries; ++i) {
+        manifest_entry_t *e = &manifest->entries[i];
+        fprintf(file, "%s\t%s\t%X\t%X\t%X\t%llX\t%llX\t%08X\n",
+            e->key, e->source, e->packOffset, e->sizeCompressed, e->timestamp,
+            (unsigned long long)e->outputSize, (unsigned long long)e->outputMtime, e->outputCrc);
+    }
+
+    fclose(file);
+    rename(tmpFilename, manifest->filename);
+    mem_free(tmpFilename);
+
+    manifest->dirty = false;
+}
+
+void manifest_free(manifest_t *manifest)
+{
+    size_t numEntries = stbds_shlenu(manifest->entries);
+    for (int i = 0; i < numEntries; ++i) {
+        manifest_freeEntry(&manifest->entries[i]);
+    }
+
+    stbds_shfree(manifest->entries);
+    mem_free(manifest->filename);
+    mem_free(manifest);
+}
+
+manifest_entry_t* manifest_get(manifest_t *manifest, const char *path)
+{
+    return stbds_shgetp_null(manifest->entries, path);
+}
+
+void manifest_put(manifest_t *manifest, const char *path, const char *source, resource_t *res, const char *outputPath, uint32_t outputCrc)
+{
+    struct stat st;
+    if (stat(outputPath, &st) != 0) {
+        return;
+    }
+
+    manifest_entry_t entry = {
+        .key = (char*)path,
+        .source = mem_strdup(MEM_TAG_EXTRACT, source),
+        .packOffset = res->packOffset,
+        .sizeCompressed = res->sizeCompressed,
+        .timestamp = res->timestamp,
+        .outputSize = st.st_size,
+        .outputMtime = st.st_mtime,
+        .outputCrc = outputCrc,
+    };
+
+    // NOTE: `shputs` on a key that already exists clobbers it with a stale
+    // key pointer, so existing entries are overwritten in place.
+    manifest_entry_t *old = manifest_get(manifest, path);
+    if (old) {
+        manifest_freeEntry(old);
+        entry.key = old->key;
+        *old = entry;
+    } else {
+        stbds_shputs(manifest->entries, entry);
+    }
+
+    manifest->dirty = true;
+}
+
+bool manifest_isSourceUnchanged(manifest_entry_t *entry, const char *source, resource_t *res)
+{
+    return 1
+        && entry->packOffset == res->packOffset
+        && entry->sizeCompressed == res->sizeCompressed
+        && entry->timestamp == res->timestamp
+        && !strcmp(entry->source, source);
+}
+
+static uint32_t manifest_crcFile(const char *filename)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    uint8_t buf[0x10000];
+    uint32_t crc = crc32(0, NULL, 0);
+    ssize_t n;
+
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        crc = crc32(crc, buf, n);
+    }
+
+    close(fd);
+
+    return crc;
+}
+
+// An untouched output is recognized from its size and mtime alone. If only
+// the mtime moved (copied, touched, restored from backup), fall back to
+// hashing the contents before deciding to rewrite it.
+bool manifest_isOutputIntact(manifest_t *manifest, manifest_entry_t *entry, const char *outputPath)
+{
+    struct stat st;
+    if (stat(outputPath, &st) != 0 || st.st_size != entry->outputSize) {
+        return false;
+    }
+
+    if (st.st_mtime == entry->outputMtime) {
+        return true;
+    }
+
+    if (manifest_crcFile(outputPath) != entry->outputCrc) {
+        return false;
+    }
+
+    entry->outputMtime = st.st_mtime;
+    manifest->dirty = true;
+
+    return true;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rf.h"
+
+// One line per extracted file: where it came from and what was written.
+typedef struct {
+    char *key; // tree path
+    char *source; // packed file the entry was read from
+    uint32_t packOffset;
+    uint32_t sizeCompressed;
+    uint32_t timestamp;
+
+    uint64_t outputSize;
+    int64_t outputMtime;
+    uint32_t outputCrc;
+} manifest_entry_t;
+
+typedef struct {
+    char *filename;
+    manifest_entry_t *entries;
+    bool dirty;
+} manifest_t;
+
+manifest_t* manifest_load(const char *filename);
+void manifest_save(manifest_t *manifest);
+void manifest_free(manifest_t *manifest);
+
+manifest_entry_t* manifest_get(manifest_t *manifest, const char *path);
+void manifest_put(manifest_t *manifest, const char *path, const char *source, resource_t *res, const char *outputPath, uint32_t outputCrc);
+
+bool manifest_isSourceUnchanged(manifest_entry_t *entry, const char *source, resource_t *res);
+bool manifest_isOutputIntact(manifest_t *manifest, manifest_entry_t *entry, const char *outputPath);
@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "mem.h"
+
+// Live allocations sit in a pointer-keyed hash table, split into shards so
+// threads rarely wait on each other. Sizes and tags live there rather than
+// in a header in front of each block, so untracked pointers (libc's,
+// raylib's, anything allocated before `mem_init`) can still be passed to
+// `mem_free` safely.
+//
+// NOTE: this file has to stay off stb_ds; stb_ds allocates through it.
+
+#define MEM_NUM_SHARDS (16)
+#define MEM_MIN_CAPACITY (1024)
+
+typedef struct {
+    uintptr_t ptr; // 0 is empty
+    size_t size;
+    mem_tag_t tag;
+} mem_entry_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    mem_entry_t *entries;
+    size_t capacity; // power of two
+    size_t count;
+} mem_shard_t;
+
+typedef struct {
+    uint64_t allocs;
+    uint64_t live;
+    uint64_t liveBytes;
+    uint64_t peakBytes;
+} mem_stats_t;
+
+bool g_memEnabled = false;
+
+static const char *s_tagNames[MEM_TAG_COUNT] = {
+    [MEM_TAG_OTHER] = "other",
+    [MEM_TAG_RF] = "rf",
+    [MEM_TAG_LS] = "ls",
+    [MEM_TAG_FILETREE] = "filetree",
+    [MEM_TAG_PATCHLIST] = "patchlist",
+    [MEM_TAG_EXPLORER] = "explorer",
+    [MEM_TAG_EXTRACT] = "extract",
+    [MEM_TAG_REPACK] = "repack",
+    [MEM_TAG_COMPRESS] = "compress",
+};
+
+static mem_shard_t s_shards[MEM_NUM_SHARDS];
+static mem_stats_t s_stats[MEM_TAG_COUNT];
+static mem_stats_t s_total;
+
+static __thread mem_tag_t t_tag = MEM_TAG_OTHER;
+
+static uint64_t mem_hash(uintptr_t ptr)
+{
+    uint64_t h = (uint64_t)ptr * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+}
+
+static mem_shard_t* mem_getShard(uint64_t hash)
+{
+    return &s_shards[hash >> 60];
+}
+
+static void mem_addStats(mem_stats_t *stats, size_t size)
+{
+    __atomic_add_fetch(&stats->allocs, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&stats->live, 1, __ATOMIC_RELAXED);
+    uint64_t live = __atomic_add_fetch(&stats->liveBytes, size, __ATOMIC_RELAXED);
+
+    uint64_t peak = __atomic_load_n(&stats->peakBytes, __ATOMIC_RELAXED);
+    while (live > peak && !__atomic_compare_exchange_n(&stats->peakBytes, &peak, live, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+static void mem_subStats(mem_stats_t *stats, size_t size)
+{
+    __atomic_sub_fetch(&stats->live, 1, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&stats->liveBytes, size, __ATOMIC_RELAXED);
+}
+
+// Caller holds the shard lock.
+static size_t mem_findSlot(mem_shard_t *shard, uintptr_t ptr, uint64_t hash)
+{
+    size_t mask = shard->capacity - 1;
+    size_t slot = hash & mask;
+
+    while (shard->entries[slot].ptr && shard->entries[slot].ptr != ptr) {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+static void mem_grow(mem_shard_t *shard)
+{
+    mem_entry_t *old = shard->entries;
+    size_t oldCapacity = shard->capacity;
+
+    shard->capacity = oldCapacity ? oldCapacity * 2 : MEM_MIN_CAPACITY;
+    shard->entries = (mem_entry_t*)calloc(shard->capacity, sizeof(*shard->entries));
+
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (old[i].ptr) {
+            size_t slot = mem_findSlot(shard, old[i].ptr, mem_hash(old[i].ptr));
+            shard->entries[slot] = old[i];
+        }
+    }
+
+    free(old);
+}
+
+static void mem_track(void *ptr, size_t size, mem_tag_t tag)
+{
+    if (!ptr) {
+        return;
+    }
+
+    uint64_t hash = mem_hash((uintptr_t)ptr);
+    mem_shard_t *shard = mem_getShard(hash);
+    mem_entry_t stale = { 0 };
+
+    pthread_mutex_lock(&shard->lock);
+
+    if ((shard->count + 1) * 2 > shard->capacity) {
+        mem_grow(shard);
+    }
+
+    size_t slot = mem_findSlot(shard, (uintptr_t)ptr, hash);
+    if (shard->entries[slot].ptr) {
+        // freed behind our back; whatever was here is long gone
+        stale = shard->entries[slot];
+    } else {
+        shard->count += 1;
+    }
+    shard->entries[slot] = (mem_entry_t){ (uintptr_t)ptr, size, tag };
+
+    pthread_mutex_unlock(&shard->lock);
+
+    if (stale.ptr) {
+        mem_subStats(&s_stats[stale.tag], stale.size);
+        mem_subStats(&s_total, stale.size);
+    }
+    mem_addStats(&s_stats[tag], size);
+    mem_addStats(&s_total, size);
+}
+
+// Linear probing, so removal shifts later entries of the run back into
+// the gap rather than leaving a tombstone.
+static bool mem_untrack(void *ptr, mem_entry_t *out)
+{
+    uint64_t hash = mem_hash((uintptr_t)ptr);
+    mem_shard_t *shard = mem_getShard(hash);
+
+    pthread_mutex_lock(&shard->lock);
+
+    if (!shard->capacity) {
+        pthread_mutex_unlock(&shard->lock);
+        return false;
+    }
+
+    size_t mask = shard->capacity - 1;
+    size_t slot = mem_findSlot(shard, (uintptr_t)ptr, hash);
+    if (!shard->entries[slot].ptr) {
+        pthread_mutex_unlock(&shard->lock);
+        return false;
+    }
+
+    *out = shard->entries[slot];
+    shard->count -= 1;
+
+    size_t gap = slot;
+    for (size_t next = (gap + 1) & mask; shard->entries[next].ptr; next = (next + 1) & mask) {
+        size_t home = mem_hash(shard->entries[next].ptr) & mask;
+
+        // move it back unless its home lies between the gap and it
+        bool stays = (gap <= next) ? (gap < home && home <= next) : (gap < home || home <= next);
+        if (!stays) {
+            shard->entries[gap] = shard->entries[next];
+            gap = next;
+        }
+    }
+    shard->entries[gap].ptr = 0;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    mem_subStats(&s_stats[out->tag], out->size);
+    mem_subStats(&s_total, out->size);
+
+    return true;
+}
+
+static void mem_reportAtExit()
+{
+    mem_report(stderr);
+}
+
+// Any `setting` but unset, empty or "0" turns accounting on. Only call
+// this at startup, before any other threads exist.
+void mem_init(const char *setting)
+{
+    if (!setting || !setting[0] || !strcmp(setting, "0") || g_memEnabled) {
+        return;
+    }
+
+    for (int i = 0; i < MEM_NUM_SHARDS; ++i) {
+        pthread_mutex_init(&s_shards[i].lock, NULL);
+    }
+
+    g_memEnabled = true;
+    atexit(mem_reportAtExit);
+}
+
+void mem_report(FILE *f)
+{
+    if (!g_memEnabled) {
+        return;
+    }
+
+    fprintf(f, "[mem] %-10s %12s %12s %14s %14s\n", "tag", "allocs", "live", "live bytes", "peak bytes");
+
+    for (int i = 0; i <= MEM_TAG_COUNT; ++i) {
+        mem_stats_t *stats = i < MEM_TAG_COUNT ? &s_stats[i] : &s_total;
+        const char *name = i < MEM_TAG_COUNT ? s_tagNames[i] : "total";
+
+        fprintf(f, "[mem] %-10s %12llu %12llu %14llu %14llu\n", name,
+            (unsigned long long)stats->allocs, (unsigned long long)stats->live,
+            (unsigned long long)stats->liveBytes, (unsigned long long)stats->peakBytes
+        );
+    }
+}
+
+void* mem_malloc(mem_tag_t tag, size_t size)
+{
+    void *ptr = malloc(size);
+    if (g_memEnabled) {
+        mem_track(ptr, size, tag);
+    }
+    return ptr;
+}
+
+void* mem_calloc(mem_tag_t tag, size_t num, size_t size)
+{
+    void *ptr = calloc(num, size);
+    if (g_memEnabled) {
+        mem_track(ptr, num * size, tag);
+    }
+    return ptr;
+}
+
+// A block keeps the tag it was first allocated with.
+void* mem_realloc(mem_tag_t tag, void *ptr, size_t size)
+{
+    if (!g_memEnabled) {
+        return realloc(ptr, size);
+    }
+
+    mem_entry_t old = { 0 };
+    bool tracked = ptr && mem_untrack(ptr, &old);
+
+    void *newPtr = realloc(ptr, size);
+    if (!newPtr && size) {
+        // still the old block
+        if (tracked) {
+            mem_track(ptr, old.size, old.tag);
+        }
+        return NULL;
+    }
+
+    mem_track(newPtr, size, tracked ? old.tag : tag);
+    return newPtr;
+}
+
+char* mem_strdup(mem_tag_t tag, const char *str)
+{
+    size_t len = strlen(str) + 1;
+    char *copy = (char*)mem_malloc(tag, len);
+    memcpy(copy, str, len);
+    return copy;
+}
+
+char* mem_strndup(mem_tag_t tag, const char *str, size_t maxLen)
+{
+    size_t len = strnlen(str, maxLen);
+    char *copy = (char*)mem_malloc(tag, len + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+void mem_free(void *ptr)
+{
+    if (g_memEnabled && ptr) {
+        mem_entry_t entry;
+        mem_untrack(ptr, &entry);
+    }
+    free(ptr);
+}
+
+mem_tag_t mem_setTag(mem_tag_t tag)
+{
+    mem_tag_t prev = t_tag;
+    t_tag = tag;
+    return prev;
+}
+
+void* mem_stbdsRealloc(void *ptr, size_t size)
+{
+    return mem_realloc(t_tag, ptr, size);
+}
+
+void mem_stbdsFree(void *ptr)
+{
+    mem_free(ptr);
+}
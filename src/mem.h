@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Allocation accounting by subsystem. With DTLS_MEMSTATS set, every tagged
+// allocation is tracked until freed, and a per-tag report (allocations,
+// peak, and what's still live at exit) goes to stderr when the tool exits.
+// Unset, the wrappers are plain malloc/free behind one branch.
+//
+// Tracked memory has to be released with `mem_free`. Handing it any other
+// pointer is fine; it just isn't counted.
+
+#define MEM_ENV_VAR "DTLS_MEMSTATS"
+
+typedef enum {
+    MEM_TAG_OTHER,
+    MEM_TAG_RF,
+    MEM_TAG_LS,
+    MEM_TAG_FILETREE,
+    MEM_TAG_PATCHLIST,
+    MEM_TAG_EXPLORER,
+    MEM_TAG_EXTRACT,
+    MEM_TAG_REPACK,
+    MEM_TAG_COMPRESS,
+
+    MEM_TAG_COUNT,
+} mem_tag_t;
+
+extern bool g_memEnabled;
+
+void mem_init(const char *setting);
+void mem_report(FILE *f);
+
+void* mem_malloc(mem_tag_t tag, size_t size);
+void* mem_calloc(mem_tag_t tag, size_t num, size_t size);
+void* mem_realloc(mem_tag_t tag, void *ptr, size_t size);
+char* mem_strdup(mem_tag_t tag, const char *str);
+char* mem_strndup(mem_tag_t tag, const char *str, size_t maxLen);
+void mem_free(void *ptr);
+
+// stb_ds has no say in what its allocations are for, so they take the
+// calling thread's current tag (see ds.h). Returns the previous one.
+mem_tag_t mem_setTag(mem_tag_t tag);
+
+void* mem_stbdsRealloc(void *ptr, size_t size);
+void mem_stbdsFree(void *ptr);
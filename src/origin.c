@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+#include "ds.h"
+
+#include "config.h"
+#include "filetree.h"
+#include "ls.h"
+#include "mem.h"
+#include "origin.h"
+#include "patchlist.h"
+#include "path.h"
+#include "trace.h"
+
+typedef struct {
+    origin_index_t *index;
+    filetree_node_t *root; // packing root of whatever's being resolved
+    char dataDir[64]; // the root's
+} origin_ctx_t;
+
+static const char *s_originNames[] = {
+    [ORIGIN_UPDATE] = "update",
+    [ORIGIN_BASE] = "base",
+    [ORIGIN_NONE] = "none",
+};
+
+// Either half may be missing: no `ls` means no base game to fall back on,
+// so everything is the update's; no patchlist means nothing was patched.
+origin_index_t* origin_loadIndex(const char *gamePath, const char *updatePath)
+{
+    TRACE_BEGIN("origin_loadIndex");
+
+    origin_index_t *index = (origin_index_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*index));
+    char filename[4096];
+
+    snprintf(filename, sizeof(filename), "%s%s", gamePath ? gamePath : "", ORIGIN_LS_FILENAME);
+    if (gamePath && path_isFile(filename)) {
+        index->ls = ls_load(filename);
+
+        mem_tag_t prevTag = mem_setTag(MEM_TAG_LS);
+        for (uint32_t i = 0; i < index->ls->numEntries; ++i) {
+            uint32_t crc = index->ls->entries[i].crc;
+            if (stbds_hmgeti(index->lsIndex, crc) < 0) {
+                stbds_hmput(index->lsIndex, crc, i);
+            }
+        }
+        mem_setTag(prevTag);
+    }
+
+    snprintf(filename, sizeof(filename), "%spatchlist", updatePath);
+    if (path_isFile(filename)) {
+        index->patchlist = patchlist_loadFromFile(filename);
+    }
+
+    TRACE_END();
+
+    return index;
+}
+
+void origin_freeIndex(origin_index_t *index)
+{
+    if (index->ls) {
+        ls_free(index->ls);
+    }
+    if (index->patchlist) {
+        patchlist_free(index->patchlist);
+    }
+    stbds_hmfree(index->lsIndex);
+    mem_free(index);
+}
+
+static void origin_resolveRoot(origin_ctx_t *ctx, filetree_node_t *node)
+{
+    ctx->root = node;
+    filetree_getDataDir(node, ctx->dataDir, sizeof(ctx->dataDir));
+
+    node->origin = ORIGIN_NONE;
+    if (!ctx->index->ls) {
+        return;
+    }
+
+    char key[4096];
+    snprintf(key, sizeof(key), "%s%spacked", ctx->dataDir, node->path);
+    uint32_t crc = crc32(0, (const uint8_t*)key, strlen(key));
+
+    ptrdiff_t i = stbds_hmgeti(ctx->index->lsIndex, crc);
+    if (i >= 0) {
+        ls_entry_t *entry = &ctx->index->ls->entries[ctx->index->lsIndex[i].value];
+        node->origin = ORIGIN_BASE;
+        node->baseDtIndex = entry->dtIndex;
+        node->baseOffset = entry->offset;
+    }
+}
+
+static void origin_resolveFile(origin_ctx_t *ctx, filetree_node_t *node)
+{
+    origin_index_t *index = ctx->index;
+
+    if (!index->ls) {
+        node->origin = ORIGIN_UPDATE;
+        return;
+    }
+
+    char path[4096];
+    snprintf(path, sizeof(path), "%s%s", ctx->dataDir, node->path);
+
+    if (index->patchlist && patchlist_contains(index->patchlist, path)) {
+        node->origin = ORIGIN_UPDATE;
+    } else if (ctx->root && ctx->root->origin == ORIGIN_BASE) {
+        node->origin = ORIGIN_BASE;
+    } else {
+        node->origin = ORIGIN_NONE;
+    }
+}
+
+static void origin_resolveNode(origin_ctx_t *ctx, filetree_node_t *node)
+{
+    resource_t *res = node->res;
+    filetree_node_t *prevRoot = ctx->root;
+    char prevDataDir[64];
+
+    if (res && (res->flags & RES_FLAG_DIR) && !(res->flags & RES_FLAG_NO_LOC)) {
+        memcpy(prevDataDir, ctx->dataDir, sizeof(prevDataDir));
+        origin_resolveRoot(ctx, node);
+    } else if (res && !(res->flags & RES_FLAG_DIR)) {
+        origin_resolveFile(ctx, node);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        origin_resolveNode(ctx, node->children[i]);
+    }
+
+    if (ctx->root != prevRoot) {
+        ctx->root = prevRoot;
+        memcpy(ctx->dataDir, prevDataDir, sizeof(prevDataDir));
+    }
+}
+
+// Needs `node->path` and packing roots' `region` filled in first.
+void origin_resolve(filetree_node_t *tree, origin_index_t *index)
+{
+    origin_ctx_t ctx = {
+        .index = index,
+        .dataDir = "data/",
+    };
+
+    origin_resolveNode(&ctx, tree);
+}
+
+const char* origin_getName(origin_t origin)
+{
+    return s_originNames[origin];
+}
+
+// The file holding `node`'s entry, and where in it the entry starts.
+bool origin_locate(filetree_node_t *node, char *filename, size_t len, uint64_t *offset)
+{
+    switch (node->origin) {
+    case ORIGIN_UPDATE:
+        *offset = node->res->packOffset;
+        return filetree_getPackedFilename(node, filename, len);
+
+    case ORIGIN_BASE: {
+        filetree_node_t *root = getPackingRoot(node);
+        snprintf(filename, len, "%s" ORIGIN_DT_FORMAT, GAME_CONTENT_PATH, root->baseDtIndex);
+        *offset = (uint64_t)root->baseOffset + node->res->packOffset;
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
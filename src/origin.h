@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+#include "ls.h"
+#include "patchlist.h"
+
+// Where each file's data really is. The update's resource table lists
+// every file, but only those in its patchlist are in the update's packed
+// files; the rest are still in the base game's dt files, wherever `ls`
+// says their packing root's packed file went.
+//
+// Resolved once per tree, into `origin` on every file (and the base
+// location on every packing root), so readers go straight to the right
+// file and offset with `origin_locate`.
+
+#define ORIGIN_LS_FILENAME "ls"
+#define ORIGIN_DT_FORMAT "dt%02u"
+
+// NOTE: ORIGIN_UPDATE is 0, so trees nobody resolved read from the
+// update's packed files as they always have.
+typedef enum {
+    ORIGIN_UPDATE = 0,
+    ORIGIN_BASE,
+    ORIGIN_NONE, // patched in neither
+} origin_t;
+
+typedef struct {
+    uint32_t key; // crc32 of e.g. `data/fighter/mario/packed`
+    uint32_t value; // into ls->entries
+} origin_ls_entry_t;
+
+typedef struct {
+    ls_t *ls; // NULL without a base game
+    origin_ls_entry_t *lsIndex; // stb_ds hashmap
+    patchlist_t *patchlist; // NULL if the update has none
+} origin_index_t;
+
+origin_index_t* origin_loadIndex(const char *gamePath, const char *updatePath);
+void origin_freeIndex(origin_index_t *index);
+
+void origin_resolve(filetree_node_t *tree, origin_index_t *index);
+
+const char* origin_getName(origin_t origin);
+bool origin_locate(filetree_node_t *node, char *filename, size_t len, uint64_t *offset);
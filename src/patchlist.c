@@ -1,72 +1,186 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
-#include "vendor/stb_ds.h"
+#include "ds.h"
 
+#include "hash.h"
+#include "mem.h"
 #include "patchlist.h"
+#include "trace.h"
+
+#define PATCHLIST_MIN_SET_CAPACITY (64)
+
+static char* slotAt(patchlist_t *patchlist, size_t idx)
+{
+    return (char*)patchlist->data + sizeof(patchlist_header_t) + idx * PATCHLIST_ENTRY_LEN;
+}
+
+// NOTE: a full slot has no terminator.
+static size_t slotLength(const char *slot)
+{
+    return strnlen(slot, PATCHLIST_ENTRY_LEN);
+}
+
+static uint64_t hashEntry(const char *str, size_t len)
+{
+    return hash_bytes(str, len, 0);
+}
+
+// Probes for `str`; returns where it is, or the empty bucket it would go in.
+static size_t findBucket(patchlist_t *patchlist, const char *str, size_t len)
+{
+    size_t mask = patchlist->setCapacity - 1;
+    size_t bucket = hashEntry(str, len) & mask;
+
+    while (patchlist->set[bucket]) {
+        const char *slot = slotAt(patchlist, patchlist->set[bucket] - 1);
+        if (slotLength(slot) == len && !memcmp(slot, str, len)) {
+            break;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+
+    return bucket;
+}
+
+// Keeps the set at most half full.
+static void reserveSet(patchlist_t *patchlist, size_t count)
+{
+    if (patchlist->set && count * 2 <= patchlist->setCapacity) {
+        return;
+    }
+
+    size_t capacity = patchlist->setCapacity ? patchlist->setCapacity : PATCHLIST_MIN_SET_CAPACITY;
+    while (count * 2 > capacity) {
+        capacity *= 2;
+    }
+
+    mem_free(patchlist->set);
+    patchlist->set = (uint32_t*)mem_calloc(MEM_TAG_PATCHLIST, capacity, sizeof(*patchlist->set));
+    patchlist->setCapacity = capacity;
+
+    // NOTE: duplicates already in the buffer are left in the file as they
+    // were; only the first one is indexed.
+    size_t numFiles = patchlist_count(patchlist);
+    for (int i = 0; i < numFiles; ++i) {
+        const char *slot = slotAt(patchlist, i);
+        size_t bucket = findBucket(patchlist, slot, slotLength(slot));
+        if (!patchlist->set[bucket]) {
+            patchlist->set[bucket] = i + 1;
+        }
+    }
+}
 
 patchlist_t* patchlist_loadFromFile(const char *filename)
 {
-    patchlist_t *patchlist = (patchlist_t*)calloc(1, sizeof(*patchlist));
+    TRACE_BEGIN_DETAIL("patchlist_load", filename);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_PATCHLIST);
+    patchlist_t *patchlist = (patchlist_t*)mem_calloc(MEM_TAG_PATCHLIST, 1, sizeof(*patchlist));
 
     FILE *file = fopen(filename, "rb");
-    fread(&patchlist->header, sizeof(patchlist->header), 1, file);
+    assert(file);
 
     fseek(file, 0, SEEK_END);
-    size_t dataSize = ftell(file) - sizeof(patchlist->header);
-    fseek(file, sizeof(patchlist->header), SEEK_SET);
+    size_t fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
 
-    if (dataSize != patchlist->header.numFiles * PATCHLIST_ENTRY_LEN) {
-        assert(0 && "[patchlist] incorrect file count in header");
-    }
+    assert(fileSize >= sizeof(patchlist_header_t));
 
-    char *data = (char*)malloc(dataSize);
-    fread(data, dataSize, 1, file);
+    stbds_arrsetlen(patchlist->data, fileSize);
+    fread(patchlist->data, fileSize, 1, file);
     fclose(file);
 
-    for (int i = 0; i < patchlist->header.numFiles; ++i) {
-        char *name = data + (i * PATCHLIST_ENTRY_LEN);
-        stbds_arrput(patchlist->files, strdup(name));
+    size_t dataSize = fileSize - sizeof(patchlist_header_t);
+    if (dataSize != patchlist_getHeader(patchlist)->numFiles * PATCHLIST_ENTRY_LEN) {
+        assert(0 && "[patchlist] incorrect file count in header");
     }
 
-    free(data);
+    reserveSet(patchlist, patchlist_count(patchlist));
+    mem_setTag(prevTag);
+    TRACE_END();
 
     return patchlist;
 }
 
-// NOTE: mutates (read: updates) header.numFiles
-void patchlist_saveToFile(patchlist_t *patchlist, const char *filename)
+// False, after printing why, if the file couldn't be written.
+bool patchlist_saveToFile(patchlist_t *patchlist, const char *filename)
 {
-    patchlist->header.numFiles = stbds_arrlenu(patchlist->files);
-
-    uint8_t pad[PATCHLIST_ENTRY_LEN] = { 0 };
+    TRACE_BEGIN_DETAIL("patchlist_save", filename);
 
     FILE *file = fopen(filename, "wb");
-    fwrite(&patchlist->header, sizeof(patchlist->header), 1, file);
+    bool ok = file != NULL;
+    if (ok) {
+        size_t len = stbds_arrlenu(patchlist->data);
+        ok = fwrite(patchlist->data, 1, len, file) == len;
+        ok = fclose(file) == 0 && ok;
+    }
 
-    for (int i = 0; i < patchlist->header.numFiles; ++i) {
-        size_t len = strlen(patchlist->files[i]);
-        fwrite(patchlist->files[i], len, 1, file);
-        fwrite(pad, PATCHLIST_ENTRY_LEN-len, 1, file);
+    if (!ok) {
+        printf("[patchlist] cannot write %s\n", filename);
     }
 
-    fclose(file);
+    TRACE_END();
+
+    return ok;
 }
 
 void patchlist_free(patchlist_t *patchlist)
 {
-    size_t numFiles = stbds_arrlenu(patchlist->files);
-    for (int i = 0; i < numFiles; ++i) {
-        free(patchlist->files[i]);
-    }
+    stbds_arrfree(patchlist->data);
+    mem_free(patchlist->set);
+    mem_free(patchlist);
+}
+
+patchlist_header_t* patchlist_getHeader(patchlist_t *patchlist)
+{
+    return (patchlist_header_t*)patchlist->data;
+}
+
+size_t patchlist_count(patchlist_t *patchlist)
+{
+    return patchlist_getHeader(patchlist)->numFiles;
+}
 
-    stbds_arrfree(patchlist->files);
+// NOTE: not necessarily terminated; see `slotLength`.
+const char* patchlist_get(patchlist_t *patchlist, size_t idx)
+{
+    assert(idx < patchlist_count(patchlist));
+    return slotAt(patchlist, idx);
+}
+
+bool patchlist_contains(patchlist_t *patchlist, const char *str)
+{
+    size_t len = strlen(str);
+    if (len > PATCHLIST_ENTRY_LEN) {
+        return false;
+    }
 
-    free(patchlist);
+    return patchlist->set[findBucket(patchlist, str, len)] != 0;
 }
 
-void patchlist_append(patchlist_t *patchlist, const char *str)
+// Returns false (and leaves the list alone) if `str` is already in it.
+// NOTE: keeps header.numFiles up to date.
+bool patchlist_append(patchlist_t *patchlist, const char *str)
 {
-    stbds_arrput(patchlist->files, strdup(str));
+    size_t len = strlen(str);
+    assert(len <= PATCHLIST_ENTRY_LEN && "[patchlist] path too long");
+
+    size_t numFiles = patchlist_count(patchlist);
+    reserveSet(patchlist, numFiles + 1);
+
+    size_t bucket = findBucket(patchlist, str, len);
+    if (patchlist->set[bucket]) {
+        return false;
+    }
+
+    char *slot = (char*)stbds_arraddnptr(patchlist->data, PATCHLIST_ENTRY_LEN);
+    memset(slot, 0, PATCHLIST_ENTRY_LEN);
+    memcpy(slot, str, len);
+
+    patchlist_getHeader(patchlist)->numFiles = numFiles + 1;
+    patchlist->set[bucket] = numFiles + 1;
+
+    return true;
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #define PATCHLIST_ENTRY_LEN (0x80)
 
@@ -11,13 +13,21 @@ typedef struct {
     uint8_t dontKnowDontCare[0x78];
 } patchlist_header_t;
 
+// Kept exactly as it sits on disk: the header, then one zero-padded
+// PATCHLIST_ENTRY_LEN slot per file. `set` is an open-addressing hash set
+// of slot indices (+1, so 0 is empty) for membership checks.
 typedef struct {
-    patchlist_header_t header;
-    char **files;
+    uint8_t *data; // stb_ds array
+    uint32_t *set;
+    size_t setCapacity; // power of two
 } patchlist_t;
 
 patchlist_t* patchlist_loadFromFile(const char *filename);
-void patchlist_saveToFile(patchlist_t *patchlist, const char *filename);
+bool patchlist_saveToFile(patchlist_t *patchlist, const char *filename);
 void patchlist_free(patchlist_t *patchlist);
 
-void patchlist_append(patchlist_t *patchlist, const char *str);
+patchlist_header_t* patchlist_getHeader(patchlist_t *patchlist);
+size_t patchlist_count(patchlist_t *patchlist);
+const char* patchlist_get(patchlist_t *patchlist, size_t idx);
+bool patchlist_contains(patchlist_t *patchlist, const char *str);
+bool patchlist_append(patchlist_t *patchlist, const char *str);
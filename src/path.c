@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "ds.h"
+
+#include "mem.h"
+#include "path.h"
+
+// Points into `path`, past the last separator.
+const char* path_getFileName(const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+// Everything before the last separator ("." if there isn't one).
+void path_getDirectory(const char *path, char *buf, size_t len)
+{
+    const char *slash = strrchr(path, '/');
+
+    if (!slash) {
+        snprintf(buf, len, ".");
+    } else if (slash == path) {
+        snprintf(buf, len, "/");
+    } else {
+        snprintf(buf, len, "%.*s", (int)(slash - path), path);
+    }
+}
+
+void path_join(char *buf, size_t len, const char *dir, const char *name)
+{
+    size_t dirLen = strlen(dir);
+    bool hasSlash = dirLen > 0 && dir[dirLen - 1] == '/';
+
+    snprintf(buf, len, "%s%s%s", dir, hasSlash ? "" : "/", name);
+}
+
+bool path_exists(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0;
+}
+
+bool path_isFile(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+int64_t path_getFileLength(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+static int comparePaths(const void *a, const void *b)
+{
+    return strcmp(*(const char**)a, *(const char**)b);
+}
+
+// Full paths of everything in `path` (not recursive), sorted, as a stb_ds
+// array; free with `path_freeList`.
+char** path_listDirectory(const char *path)
+{
+    char **list = NULL;
+
+    DIR *dir = opendir(path);
+    if (!dir) {
+        return NULL;
+    }
+
+    struct dirent *ent;
+    while ((ent = readdir(dir))) {
+        if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) {
+            continue;
+        }
+
+        char fullPath[4096];
+        path_join(fullPath, sizeof(fullPath), path, ent->d_name);
+        stbds_arrput(list, mem_strdup(MEM_TAG_FILETREE, fullPath));
+    }
+    closedir(dir);
+
+    qsort(list, stbds_arrlenu(list), sizeof(*list), comparePaths);
+
+    return list;
+}
+
+void path_freeList(char **list)
+{
+    size_t len = stbds_arrlenu(list);
+    for (int i = 0; i < len; ++i) {
+        mem_free(list[i]);
+    }
+
+    stbds_arrfree(list);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Reentrant stand-ins for raylib's file helpers: no static buffers, so
+// they're safe to call from pool workers.
+
+const char* path_getFileName(const char *path);
+void path_getDirectory(const char *path, char *buf, size_t len);
+void path_join(char *buf, size_t len, const char *dir, const char *name);
+
+bool path_exists(const char *path);
+bool path_isFile(const char *path);
+int64_t path_getFileLength(const char *path);
+
+char** path_listDirectory(const char *path);
+void path_freeList(char **list);
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <pthread.h>
+
+#include "preview.h"
+#include "lrucache.h"
+#include "mem.h"
+#include "vfile.h"
+
+// Previews are inflated on a single background thread. Only the most recent
+// request matters, so a new selection simply replaces a pending one.
+
+static lrucache_t *g_previewCache = NULL;
+static pthread_t g_previewThread;
+static pthread_mutex_t g_previewLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_previewCond = PTHREAD_COND_INITIALIZER;
+static filetree_node_t *g_previewPending = NULL;
+static bool g_previewQuit = false;
+
+static void preview_load(filetree_node_t *node)
+{
+    lrucache_blob_t *blob = lrucache_get(g_previewCache, node->path);
+    if (blob) {
+        lrucache_release(g_previewCache, blob);
+        return;
+    }
+
+    vfile_t *vf = vfile_openNode(node);
+    if (!vf) {
+        return;
+    }
+
+    uint64_t size = vfile_size(vf);
+    size_t len = size < PREVIEW_MAX_BYTES ? size : PREVIEW_MAX_BYTES;
+    uint8_t *data = (uint8_t*)mem_malloc(MEM_TAG_EXPLORER, len ? len : 1);
+
+    len = vfile_read(vf, data, len);
+    vfile_close(vf);
+
+    blob = lrucache_put(g_previewCache, node->path, data, len);
+    lrucache_release(g_previewCache, blob);
+}
+
+static void* preview_threadMain(void *arg)
+{
+    mem_setTag(MEM_TAG_EXPLORER);
+    pthread_mutex_lock(&g_previewLock);
+
+    while (!g_previewQuit) {
+        if (!g_previewPending) {
+            pthread_cond_wait(&g_previewCond, &g_previewLock);
+            continue;
+        }
+
+        filetree_node_t *node = g_previewPending;
+        g_previewPending = NULL;
+
+        pthread_mutex_unlock(&g_previewLock);
+        preview_load(node);
+        pthread_mutex_lock(&g_previewLock);
+    }
+
+    pthread_mutex_unlock(&g_previewLock);
+
+    return NULL;
+}
+
+void preview_init(size_t cacheCapacity)
+{
+    g_previewCache = lrucache_create(cacheCapacity);
+    g_previewQuit = false;
+    pthread_create(&g_previewThread, NULL, preview_threadMain, NULL);
+}
+
+void preview_shutdown()
+{
+    pthread_mutex_lock(&g_previewLock);
+    g_previewQuit = true;
+    pthread_cond_signal(&g_previewCond);
+    pthread_mutex_unlock(&g_previewLock);
+
+    pthread_join(g_previewThread, NULL);
+
+    lrucache_free(g_previewCache);
+    g_previewCache = NULL;
+
+    // NOTE: previews were the only reader of most indexed entries
+    vfile_clearCache();
+}
+
+void preview_request(filetree_node_t *node)
+{
+    pthread_mutex_lock(&g_previewLock);
+    g_previewPending = node;
+    pthread_cond_signal(&g_previewCond);
+    pthread_mutex_unlock(&g_previewLock);
+}
+
+// Returns the preview for `node` if it's ready (release it when done), or NULL.
+lrucache_blob_t* preview_acquire(filetree_node_t *node)
+{
+    return lrucache_get(g_previewCache, node->path);
+}
+
+void preview_release(lrucache_blob_t *blob)
+{
+    lrucache_release(g_previewCache, blob);
+}
+
+typedef struct {
+    const char *magic;
+    size_t len;
+    const char *description;
+} preview_magic_t;
+
+static const preview_magic_t g_magics[] = {
+    { "NTWU", 4, "NUT texture (Wii U)" },
+    { "NTP3", 4, "NUT texture" },
+    { "NDWD", 4, "NUD model" },
+    { "NDP3", 4, "NUD model" },
+    { " NBV", 4, "VBN skeleton" },
+    { "VBN ", 4, "VBN skeleton" },
+    { "OMO ", 4, "OMO animation" },
+    { "MTA4", 4, "MTA material animation" },
+    { "PACK", 4, "pack archive" },
+    { "XMB ", 4, "XMB" },
+    { "FSB5", 4, "FMOD sound bank" },
+    { "RIFF", 4, "RIFF" },
+    { "SARC", 4, "SARC archive" },
+    { "Yaz0", 4, "Yaz0 compressed" },
+    { "MsgStdBn", 8, "MSBT text" },
+    { "\x89PNG", 4, "PNG image" },
+    { "DDS ", 4, "DDS texture" },
+    { "RF", 2, "resource table" },
+};
+
+const char* preview_sniffType(const uint8_t *data, size_t size)
+{
+    size_t numMagics = sizeof(g_magics) / sizeof(g_magics[0]);
+    for (int i = 0; i < numMagics; ++i) {
+        const preview_magic_t *m = &g_magics[i];
+        if (size >= m->len && !memcmp(data, m->magic, m->len)) {
+            return m->description;
+        }
+    }
+
+    // zlib header: CM=8, and the check bits make it a multiple of 31
+    if (size >= 2 && (data[0] & 0x0F) == 8 && ((data[0] << 8) | data[1]) % 31 == 0) {
+        return "zlib stream";
+    }
+
+    size_t sample = size < 512 ? size : 512;
+    size_t printable = 0;
+    for (int i = 0; i < sample; ++i) {
+        if (isprint(data[i]) || isspace(data[i])) {
+            ++printable;
+        }
+    }
+
+    if (sample > 0 && printable == sample) {
+        return "text";
+    }
+
+    return "binary";
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+#include "lrucache.h"
+
+// Only the head of an entry is inflated for preview.
+#define PREVIEW_MAX_BYTES (1024 * 1024)
+#define PREVIEW_CACHE_CAPACITY (64 * 1024 * 1024)
+
+void preview_init(size_t cacheCapacity);
+void preview_shutdown();
+
+void preview_request(filetree_node_t *node);
+lrucache_blob_t* preview_acquire(filetree_node_t *node);
+void preview_release(lrucache_blob_t *blob);
+
+const char* preview_sniffType(const uint8_t *data, size_t size);
@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "config.h"
+#include "filetree.h"
+#include "indexcache.h"
+#include "mem.h"
+#include "origin.h"
+#include "path.h"
+#include "regions.h"
+#include "threadpool.h"
+#include "trace.h"
+
+// Each region has its own resource table, but only some packing roots are
+// actually localized: those whose packed file lives under data(xx_yy)/
+// rather than data/. Everything else is shared, at the same offsets, by
+// every region.
+
+typedef struct {
+    region_t *region;
+    const char *updatePath;
+    const char *cacheDir;
+    strpool_t *strings;
+    origin_index_t *origins;
+} regions_loadJob_t;
+
+typedef struct {
+    char *key;
+    filetree_node_t *value;
+} regions_path_entry_t;
+
+// Decides, once per packing root, whether its data is localized.
+static void regions_resolvePackingRoots(filetree_node_t *node, const char *updatePath, const char *region)
+{
+    resource_t *res = node->res;
+
+    if (res && (res->flags & RES_FLAG_DIR) && !(res->flags & RES_FLAG_NO_LOC)) {
+        char filename[4096];
+        snprintf(filename, sizeof(filename), "%sdata(%s)/%spacked", updatePath, region, node->path);
+
+        node->region = path_isFile(filename) ? region : NULL;
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        regions_resolvePackingRoots(node->children[i], updatePath, region);
+    }
+}
+
+static void regions_loadJob(void *arg)
+{
+    regions_loadJob_t *job = (regions_loadJob_t*)arg;
+    region_t *region = job->region;
+
+    char cacheFilename[4096];
+    snprintf(cacheFilename, sizeof(cacheFilename), "%s%s(%s)", job->cacheDir, INDEXCACHE_FILENAME, region->name);
+
+    TRACE_BEGIN_DETAIL("load_region", region->name);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_FILETREE);
+    region->tree = indexcache_loadTree(region->rfFilename, cacheFilename, job->strings, &region->indexCache);
+
+    TRACE_BEGIN("resolve_packing_roots");
+    regions_resolvePackingRoots(region->tree, job->updatePath, region->name);
+    TRACE_END();
+
+    TRACE_BEGIN("resolve_origins");
+    origin_resolve(region->tree, job->origins);
+    TRACE_END();
+
+    TRACE_BEGIN("aggregate_totals");
+    filetree_aggregateTotals(region->tree);
+    TRACE_END();
+
+    mem_setTag(prevTag);
+    TRACE_END();
+}
+
+static int compareRegions(const void *a, const void *b)
+{
+    return strcmp(((const region_t*)a)->name, ((const region_t*)b)->name);
+}
+
+// Loads every resource(xx_yy) in `updatePath` at once, one per worker.
+regions_t* regions_load(const char *updatePath, const char *cacheDir)
+{
+    regions_t *regions = (regions_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*regions));
+    regions->strings = strpool_create();
+
+    char **files = path_listDirectory(updatePath);
+
+    size_t numFiles = stbds_arrlenu(files);
+    for (int i = 0; i < numFiles; ++i) {
+        const char *name = path_getFileName(files[i]);
+        size_t len = strlen(name);
+
+        if (strncmp(name, "resource(", 9) != 0 || len < 11 || name[len - 1] != ')') {
+            continue;
+        }
+
+        region_t region = {
+            .name = mem_strndup(MEM_TAG_FILETREE, name + 9, len - 10),
+            .rfFilename = mem_strdup(MEM_TAG_FILETREE, files[i]),
+        };
+        stbds_arrput(regions->regions, region);
+    }
+
+    path_freeList(files);
+
+    size_t numRegions = stbds_arrlenu(regions->regions);
+    qsort(regions->regions, numRegions, sizeof(*regions->regions), compareRegions);
+
+    // NOTE: the index caches are written here on a first load
+    mkdir_p(cacheDir);
+
+    // one base index for every region; it's only read from here on
+    origin_index_t *origins = origin_loadIndex(GAME_CONTENT_PATH, updatePath);
+
+    regions_loadJob_t *jobs = (regions_loadJob_t*)mem_calloc(MEM_TAG_FILETREE, numRegions, sizeof(*jobs));
+    threadpool_t *pool = threadpool_create(numRegions < threadpool_numCores() ? numRegions : 0);
+
+    for (int i = 0; i < numRegions; ++i) {
+        jobs[i].region = &regions->regions[i];
+        jobs[i].updatePath = updatePath;
+        jobs[i].cacheDir = cacheDir;
+        jobs[i].strings = regions->strings;
+        jobs[i].origins = origins;
+        threadpool_submit(pool, regions_loadJob, &jobs[i]);
+    }
+
+    threadpool_wait(pool);
+    threadpool_free(pool);
+    mem_free(jobs);
+    origin_freeIndex(origins);
+
+    return regions;
+}
+
+void regions_free(regions_t *regions)
+{
+    size_t numRegions = stbds_arrlenu(regions->regions);
+    for (int i = 0; i < numRegions; ++i) {
+        region_t *region = &regions->regions[i];
+
+        filetree_freeFlatCache(&region->flatCache);
+        filetree_free(region->tree);
+        indexcache_free(region->indexCache);
+        mem_free(region->name);
+        mem_free(region->rfFilename);
+    }
+
+    stbds_arrfree(regions->regions);
+    strpool_free(regions->strings);
+    mem_free(regions);
+}
+
+region_t* regions_getPrimary(regions_t *regions)
+{
+    size_t numRegions = stbds_arrlenu(regions->regions);
+    for (int i = 0; i < numRegions; ++i) {
+        if (!strcmp(regions->regions[i].name, REGIONS_PRIMARY)) {
+            return &regions->regions[i];
+        }
+    }
+
+    return numRegions ? &regions->regions[0] : NULL;
+}
+
+bool regions_isLocalized(filetree_node_t *node)
+{
+    filetree_node_t *pr = getPackingRoot(node);
+    return pr && pr->region;
+}
+
+static void regions_indexShared(filetree_node_t *node, regions_path_entry_t **map)
+{
+    if (node->res && node->path && !regions_isLocalized(node)) {
+        stbds_shput(*map, node->path, node);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        regions_indexShared(node->children[i], map);
+    }
+}
+
+static void regions_copyShared(filetree_node_t *node, regions_path_entry_t *map)
+{
+    if (node->res && node->path && !regions_isLocalized(node)) {
+        regions_path_entry_t *entry = stbds_shgetp_null(map, node->path);
+
+        if (entry) {
+            filetree_node_t *src = entry->value;
+
+            node->res->packOffset = src->res->packOffset;
+            node->res->sizeCompressed = src->res->sizeCompressed;
+            node->res->sizeUncompressed = src->res->sizeUncompressed;
+            node->res->flags = (node->res->flags & ~RES_FLAG_OVERRIDE) | (src->res->flags & RES_FLAG_OVERRIDE);
+            node->origin = src->origin;
+            filetree_refreshTotals(node);
+
+            mem_free(node->sourcePath);
+            node->sourcePath = src->sourcePath ? mem_strdup(MEM_TAG_FILETREE, src->sourcePath) : NULL;
+            mem_free(node->packedPath);
+            node->packedPath = src->packedPath ? mem_strdup(MEM_TAG_FILETREE, src->packedPath) : NULL;
+        }
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        regions_copyShared(node->children[i], map);
+    }
+}
+
+// Shared (data/) entries are the same in every table, so after `from` was
+// repacked, `to` has to pick up the new offsets and sizes too.
+void regions_syncShared(region_t *from, region_t *to)
+{
+    regions_path_entry_t *map = NULL;
+
+    regions_indexShared(from->tree, &map);
+    regions_copyShared(to->tree, map);
+
+    stbds_shfree(map);
+}
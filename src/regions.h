@@ -0,0 +1,29 @@
+#pragma once
+
+#include "filetree.h"
+#include "indexcache.h"
+#include "strpool.h"
+
+// Shown and built against when there's a choice.
+#define REGIONS_PRIMARY "us_en"
+
+typedef struct {
+    char *name; // "us_en", from resource(us_en)
+    char *rfFilename;
+    filetree_node_t *tree;
+    indexcache_t *indexCache;
+    filetree_flatcache_t flatCache; // for writing `tree` back out
+} region_t;
+
+// Every resource(xx_yy) table in an update, sharing one string pool.
+typedef struct {
+    region_t *regions; // stb_ds array, sorted by name
+    strpool_t *strings;
+} regions_t;
+
+regions_t* regions_load(const char *updatePath, const char *cacheDir);
+void regions_free(regions_t *regions);
+
+region_t* regions_getPrimary(regions_t *regions);
+bool regions_isLocalized(filetree_node_t *node);
+void regions_syncShared(region_t *from, region_t *to);
@@ -0,0 +1,742 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include "vendor/mkdir_p.h"
+#include "ds.h"
+
+#include "config.h"
+#include "diskcache.h"
+#include "file.h"
+#include "filetree.h"
+#include "hash.h"
+#include "mem.h"
+#include "origin.h"
+#include "patchlist.h"
+#include "repack.h"
+#include "rf.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "zparallel.h"
+
+// Rebuilds the `packed` file of every packing root that has a workspace
+// override in it. Overrides are compressed on a thread pool while the
+// packed files are written out in tree order; entries the update already
+// ships for that root are copied across as-is. Offsets and sizes are
+// patched into the tree as each entry is written.
+//
+// Everything gets hashed first, so identical payloads are only compressed
+// once and only stored once per packed file; duplicates just share the
+// first copy's `packOffset`.
+
+typedef struct repack_ctx_t repack_ctx_t;
+
+typedef struct repack_job_t {
+    repack_ctx_t *ctx;
+    filetree_node_t *node;
+    const char *srcFilename; // packed file the entry comes from
+    bool override;
+
+    // override: hash of the workspace file; otherwise of the packed entry
+    uint64_t contentHash;
+    size_t contentLen;
+    bool hashed;
+
+    struct repack_job_t *compressedBy; // job whose compressed data we share
+    struct repack_job_t *storedAs;     // earlier entry in the same packed file
+    int users;                         // writes still waiting on `data`
+
+    uint8_t *data;
+    char *cachedPath; // instead of `data`, when the disk cache had it
+    size_t len;
+    size_t uncompressedLen;
+    bool ok;
+    bool done;
+    bool written;
+    bool deferred; // big enough to compress block-parallel from the writer
+
+    // where it landed in the new packed file; only patched into the tree
+    // once the whole file has been written
+    uint32_t outOffset;
+    uint32_t outSizeCompressed;
+    uint32_t outSizeUncompressed;
+} repack_job_t;
+
+typedef struct {
+    filetree_node_t *key;
+    bool value;
+} repack_root_entry_t;
+
+typedef struct {
+    uint64_t key;
+    repack_job_t **value; // candidates sharing the hash
+} repack_hash_entry_t;
+
+struct repack_ctx_t {
+    pthread_mutex_t lock;
+    pthread_cond_t jobDone;
+
+    diskcache_t *cache;
+    threadpool_t *pool;
+};
+
+static bool readWholeFile(const char *filename, uint8_t **data, size_t *len)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    fstat(fd, &st);
+
+    *len = st.st_size;
+    *data = (uint8_t*)mem_malloc(MEM_TAG_REPACK, *len ? *len : 1);
+
+    size_t got = 0;
+    while (got < *len) {
+        ssize_t n = read(fd, *data + got, *len - got);
+        if (n <= 0) {
+            break;
+        }
+        got += n;
+    }
+
+    close(fd);
+
+    if (got != *len) {
+        mem_free(*data);
+        *data = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static bool writeAll(int fd, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t*)data;
+
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+// Streams `len` bytes at `offset` of `fd` through `fn`, 64K at a time.
+static bool forEachBlock(int fd, off_t offset, size_t len, void (*fn)(void *user, const uint8_t *data, size_t len), void *user)
+{
+    uint8_t *buf = (uint8_t*)mem_malloc(MEM_TAG_REPACK, HASH_BLOCK_SIZE);
+    bool ok = true;
+
+    while (len > 0) {
+        size_t want = len < HASH_BLOCK_SIZE ? len : HASH_BLOCK_SIZE;
+        ssize_t n = pread(fd, buf, want, offset);
+        if (n <= 0) {
+            ok = false;
+            break;
+        }
+
+        fn(user, buf, n);
+        offset += n;
+        len -= n;
+    }
+
+    mem_free(buf);
+    return ok;
+}
+
+static void hashBlock(void *user, const uint8_t *data, size_t len)
+{
+    hash_update((hash_state_t*)user, data, len);
+}
+
+// Where a job's payload can be read from: the workspace file for overrides,
+// the entry's compressed bytes in the update's packed file otherwise.
+static int openPayload(repack_job_t *job, off_t *offset, size_t *len)
+{
+    resource_t *res = job->node->res;
+
+    if (job->override) {
+        int fd = open(job->node->sourcePath, O_RDONLY);
+        if (fd >= 0) {
+            struct stat st;
+            fstat(fd, &st);
+            *offset = 0;
+            *len = st.st_size;
+        }
+        return fd;
+    }
+
+    *offset = res->packOffset;
+    *len = res->sizeCompressed;
+    return open(job->srcFilename, O_RDONLY);
+}
+
+static void repack_hashJob(void *arg)
+{
+    repack_job_t *job = (repack_job_t*)arg;
+    off_t offset;
+    size_t len;
+
+    int fd = openPayload(job, &offset, &len);
+    if (fd < 0) {
+        return;
+    }
+
+    TRACE_BEGIN_DETAIL("hash", job->node->path);
+    hash_state_t *state = (hash_state_t*)mem_malloc(MEM_TAG_REPACK, sizeof(*state));
+    hash_init(state, 0);
+
+    if (forEachBlock(fd, offset, len, hashBlock, state)) {
+        job->contentHash = hash_final(state);
+        job->contentLen = len;
+        job->hashed = true;
+    }
+
+    mem_free(state);
+    close(fd);
+    TRACE_END();
+}
+
+// Hashes only pick the candidates; duplicates are confirmed byte by byte.
+static bool samePayload(repack_job_t *a, repack_job_t *b)
+{
+    if (a->override != b->override || a->contentLen != b->contentLen) {
+        return false;
+    }
+
+    off_t offA, offB;
+    size_t lenA, lenB;
+    int fdA = openPayload(a, &offA, &lenA);
+    int fdB = openPayload(b, &offB, &lenB);
+    bool same = fdA >= 0 && fdB >= 0;
+
+    uint8_t *bufA = (uint8_t*)mem_malloc(MEM_TAG_REPACK, HASH_BLOCK_SIZE);
+    uint8_t *bufB = (uint8_t*)mem_malloc(MEM_TAG_REPACK, HASH_BLOCK_SIZE);
+
+    size_t left = a->contentLen;
+    while (same && left > 0) {
+        size_t want = left < HASH_BLOCK_SIZE ? left : HASH_BLOCK_SIZE;
+
+        same = pread(fdA, bufA, want, offA) == (ssize_t)want
+            && pread(fdB, bufB, want, offB) == (ssize_t)want
+            && memcmp(bufA, bufB, want) == 0;
+
+        offA += want;
+        offB += want;
+        left -= want;
+    }
+
+    mem_free(bufA);
+    mem_free(bufB);
+    if (fdA >= 0) {
+        close(fdA);
+    }
+    if (fdB >= 0) {
+        close(fdB);
+    }
+
+    return same;
+}
+
+// Finds an earlier job in `table` with the same payload, or records `job`
+// as the first of its kind.
+static repack_job_t* findDuplicate(repack_hash_entry_t **table, repack_job_t *job)
+{
+    uint64_t key = hash_mix(job->contentHash ^ job->override);
+
+    repack_hash_entry_t *entry = stbds_hmgetp_null(*table, key);
+    if (entry) {
+        size_t numCandidates = stbds_arrlenu(entry->value);
+        for (int i = 0; i < numCandidates; ++i) {
+            if (samePayload(entry->value[i], job)) {
+                return entry->value[i];
+            }
+        }
+
+        stbds_arrput(entry->value, job);
+        return NULL;
+    }
+
+    repack_job_t **candidates = NULL;
+    stbds_arrput(candidates, job);
+    stbds_hmput(*table, key, candidates);
+
+    return NULL;
+}
+
+static void freeHashTable(repack_hash_entry_t *table)
+{
+    size_t len = stbds_hmlenu(table);
+    for (int i = 0; i < len; ++i) {
+        stbds_arrfree(table[i].value);
+    }
+    stbds_hmfree(table);
+}
+
+// Compresses the workspace file itself, and caches the result under `key`
+// (if there is one) when it's still what was hashed.
+static void repack_compressSource(repack_job_t *job, const char *key, threadpool_t *pool)
+{
+    diskcache_t *cache = job->ctx->cache;
+    uint8_t *src = NULL;
+    size_t srcLen = 0;
+
+    if (!readWholeFile(job->node->sourcePath, &src, &srcLen)) {
+        job->ok = false;
+        return;
+    }
+
+    size_t destLen = zparallel_compressBound(srcLen);
+    job->data = (uint8_t*)mem_malloc(MEM_TAG_REPACK, destLen);
+    job->ok = zparallel_compress(pool, job->data, &destLen, src, srcLen, REPACK_COMPRESSION_LEVEL) == Z_OK;
+    job->len = destLen;
+    job->uncompressedLen = srcLen;
+
+    // NOTE: only cache it under the key if the file didn't change
+    // since it was hashed.
+    if (key && job->ok && srcLen == job->contentLen) {
+        hash_state_t *state = (hash_state_t*)mem_malloc(MEM_TAG_REPACK, sizeof(*state));
+        hash_init(state, 0);
+        hash_update(state, src, srcLen);
+
+        if (hash_final(state) == job->contentHash) {
+            diskcache_put(cache, key, job->data, job->len);
+        }
+        mem_free(state);
+    }
+
+    mem_free(src);
+}
+
+// `pool` is only for splitting up one big file; see zparallel.c.
+static void repack_compress(repack_job_t *job, threadpool_t *pool)
+{
+    diskcache_t *cache = job->hashed ? job->ctx->cache : NULL;
+    char key[DISKCACHE_KEY_LEN];
+
+    TRACE_BEGIN_DETAIL("compress", job->node->path);
+
+    if (cache) {
+        char path[4096];
+        diskcache_makeKey(key, job->contentHash, job->contentLen, "zlib", REPACK_COMPRESSION_LEVEL);
+
+        if (diskcache_get(cache, key, path, sizeof(path), &job->len)) {
+            job->cachedPath = mem_strdup(MEM_TAG_REPACK, path);
+            job->uncompressedLen = job->contentLen;
+            job->ok = true;
+        }
+    }
+
+    if (!job->cachedPath) {
+        repack_compressSource(job, cache ? key : NULL, pool);
+    }
+
+    TRACE_END();
+
+    pthread_mutex_lock(&job->ctx->lock);
+    job->done = true;
+    pthread_cond_broadcast(&job->ctx->jobDone);
+    pthread_mutex_unlock(&job->ctx->lock);
+}
+
+static void repack_compressJob(void *arg)
+{
+    repack_compress((repack_job_t*)arg, NULL);
+}
+
+// Point the resource tree at the workspace copy of every overridden file.
+static void repack_applyOverrides(filetree_node_t *resTree, filetree_node_t *localNode, filetree_node_t ***overrides)
+{
+    if (localNode->sourcePath && localNode->res && !(localNode->res->flags & RES_FLAG_DIR)) {
+        filetree_node_t *target = filetree_findByPath(resTree, localNode->path);
+
+        if (!target) {
+            printf("FIXME: <<< can't insert %s yet!\n", localNode->path);
+        } else {
+            mem_free(target->sourcePath);
+            target->sourcePath = mem_strdup(MEM_TAG_FILETREE, localNode->sourcePath);
+            target->res->flags |= RES_FLAG_OVERRIDE;
+            filetree_refreshTotals(target);
+            stbds_arrput(*overrides, target);
+        }
+    }
+
+    size_t numChildren = stbds_arrlenu(localNode->children);
+    for (int i = 0; i < numChildren; ++i) {
+        repack_applyOverrides(resTree, localNode->children[i], overrides);
+    }
+}
+
+// Every file stored in `root`'s packed file, in tree order: overrides, plus
+// whatever the update itself lists in its patchlist.
+static void repack_collectRootFiles(filetree_node_t *node, patchlist_t *patchlist, filetree_node_t ***files)
+{
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        filetree_node_t *child = node->children[i];
+        resource_t *res = child->res;
+
+        if (res->flags & RES_FLAG_DIR) {
+            // a directory without NO_LOC has a packed file of its own
+            if (res->flags & RES_FLAG_NO_LOC) {
+                repack_collectRootFiles(child, patchlist, files);
+            }
+            continue;
+        }
+
+        char path[4096];
+        char dataDir[64];
+        filetree_getDataDir(child, dataDir, sizeof(dataDir));
+        snprintf(path, sizeof(path), "%s%s", dataDir, child->path);
+
+        if (child->sourcePath || patchlist_contains(patchlist, path)) {
+            stbds_arrput(*files, child);
+        }
+    }
+}
+
+// Copies what `job` has to go into the packed file in the right spot.
+// Shared by every job storing the same payload, so the first one written
+// there decides where the rest point.
+static bool repack_writeEntry(repack_ctx_t *ctx, repack_job_t *job, int fdIn, int fdOut, uint64_t offset)
+{
+    static const uint8_t zeros[REPACK_ALIGNMENT] = { 0 };
+    filetree_node_t *node = job->node;
+    resource_t *res = node->res;
+
+    if (!job->override) {
+        if (fdIn < 0 || !file_copyRange(fdIn, res->packOffset, fdOut, res->sizeCompressed)) {
+            printf("[repack] cannot copy %s from %s\n", node->path, job->srcFilename);
+            return false;
+        }
+
+        job->outOffset = offset;
+        job->outSizeCompressed = res->sizeCompressed;
+        job->outSizeUncompressed = res->sizeUncompressed;
+        return true;
+    }
+
+    repack_job_t *compressed = job->compressedBy;
+
+    if (compressed->deferred) {
+        compressed->deferred = false;
+        repack_compress(compressed, ctx->pool);
+    }
+
+    pthread_mutex_lock(&ctx->lock);
+    while (!compressed->done) {
+        pthread_cond_wait(&ctx->jobDone, &ctx->lock);
+    }
+    pthread_mutex_unlock(&ctx->lock);
+
+    if (!compressed->ok) {
+        printf("[repack] failed to compress %s\n", node->sourcePath);
+        return false;
+    }
+
+    bool written = false;
+    if (compressed->cachedPath) {
+        int fdCached = open(compressed->cachedPath, O_RDONLY);
+        written = fdCached >= 0 && file_copyRange(fdCached, 0, fdOut, compressed->len);
+        if (fdCached >= 0) {
+            close(fdCached);
+        }
+
+        // NOTE: the blob may have been evicted or cut short since it was
+        // looked up; then it's a miss after all. Whatever part of it got
+        // copied is dropped, and every job sharing it uses the new data.
+        if (!written) {
+            printf("[repack] cached %s is unreadable; compressing it again\n", node->path);
+            mem_free(compressed->cachedPath);
+            compressed->cachedPath = NULL;
+
+            bool rewound = lseek(fdOut, offset, SEEK_SET) == (off_t)offset && ftruncate(fdOut, offset) == 0;
+            if (rewound) {
+                repack_compressSource(compressed, NULL, ctx->pool);
+            }
+            if (!rewound || !compressed->ok) {
+                printf("[repack] failed to compress %s\n", node->sourcePath);
+                return false;
+            }
+        }
+    }
+
+    if (!written) {
+        written = writeAll(fdOut, compressed->data, compressed->len);
+    }
+
+    job->outOffset = offset;
+    job->outSizeCompressed = compressed->len;
+    job->outSizeUncompressed = compressed->uncompressedLen;
+
+    // NOTE: matching sizes would mark the entry as stored, so let it
+    // swallow a byte of padding (inflate ignores what follows).
+    if (written && job->outSizeCompressed == job->outSizeUncompressed) {
+        written = writeAll(fdOut, zeros, 1);
+        job->outSizeCompressed++;
+    }
+
+    if (--compressed->users == 0) {
+        mem_free(compressed->data);
+        compressed->data = NULL;
+    }
+
+    if (!written) {
+        printf("[repack] cannot write %s\n", node->path);
+    }
+    return written;
+}
+
+// Writes `root`'s packed file next to where it ends up, then renames it
+// into place. Only if every entry made it are the new offsets patched into
+// the tree; otherwise the partial file goes and the tree still describes
+// the old packed file.
+static bool repack_writeRoot(repack_ctx_t *ctx, filetree_node_t *root, repack_job_t **jobs, const char *outPath)
+{
+    char dataDir[64];
+    filetree_getDataDir(root, dataDir, sizeof(dataDir));
+
+    char outFilename[4096];
+    snprintf(outFilename, sizeof(outFilename), "%s%s%spacked", outPath, dataDir, root->path);
+
+    char tmpFilename[4200];
+    snprintf(tmpFilename, sizeof(tmpFilename), "%s.tmp", outFilename);
+
+    char outDir[4096];
+    snprintf(outDir, sizeof(outDir), "%s%s%s", outPath, dataDir, root->path);
+    mkdir_p(outDir);
+
+    int fdOut = open(tmpFilename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fdOut < 0) {
+        printf("[repack] cannot write %s\n", tmpFilename);
+        return false;
+    }
+
+    int fdIn = stbds_arrlenu(jobs) ? open(jobs[0]->srcFilename, O_RDONLY) : -1;
+
+    static const uint8_t zeros[REPACK_ALIGNMENT] = { 0 };
+    uint64_t offset = 0;
+    size_t numShared = 0;
+    bool ok = true;
+
+    size_t numJobs = stbds_arrlenu(jobs);
+    for (int i = 0; ok && i < numJobs; ++i) {
+        repack_job_t *job = jobs[i];
+
+        if (job->storedAs) {
+            repack_job_t *first = job->storedAs;
+            ok = first->written;
+            job->outOffset = first->outOffset;
+            job->outSizeCompressed = first->outSizeCompressed;
+            job->outSizeUncompressed = first->outSizeUncompressed;
+            job->written = ok;
+            numShared++;
+            continue;
+        }
+
+        size_t pad = (REPACK_ALIGNMENT - (offset % REPACK_ALIGNMENT)) % REPACK_ALIGNMENT;
+        ok = writeAll(fdOut, zeros, pad);
+        offset += pad;
+
+        ok = ok && repack_writeEntry(ctx, job, fdIn, fdOut, offset);
+        job->written = ok;
+        offset += job->outSizeCompressed;
+    }
+
+    if (fdIn >= 0) {
+        close(fdIn);
+    }
+    ok = close(fdOut) == 0 && ok;
+    ok = ok && rename(tmpFilename, outFilename) == 0;
+
+    if (!ok) {
+        printf("[repack] failed to repack %s; leaving it as it was\n", outFilename);
+        unlink(tmpFilename);
+        return false;
+    }
+
+    for (int i = 0; i < numJobs; ++i) {
+        repack_job_t *job = jobs[i];
+        filetree_node_t *node = job->node;
+        resource_t *res = node->res;
+
+        res->packOffset = job->outOffset;
+        res->sizeCompressed = job->outSizeCompressed;
+        res->sizeUncompressed = job->outSizeUncompressed;
+        node->origin = ORIGIN_UPDATE;
+        filetree_refreshTotals(node);
+    }
+
+    // from now on, this root's entries live in the new packed file
+    mem_free(root->packedPath);
+    root->packedPath = mem_strdup(MEM_TAG_FILETREE, outFilename);
+
+    printf(">>> repacked %s (%zu files, %zu shared)\n", outFilename, numJobs, numShared);
+
+    return true;
+}
+
+// False if any packed file couldn't be written; see `repack_writeRoot`.
+bool repack_build(filetree_node_t *resTree, filetree_node_t *localTree, patchlist_t *patchlist, const char *outPath)
+{
+    filetree_node_t **overrides = NULL;
+    repack_applyOverrides(resTree, localTree, &overrides);
+
+    size_t numOverrides = stbds_arrlenu(overrides);
+    if (numOverrides == 0) {
+        stbds_arrfree(overrides);
+        return true;
+    }
+
+    repack_ctx_t ctx;
+    pthread_mutex_init(&ctx.lock, NULL);
+    pthread_cond_init(&ctx.jobDone, NULL);
+
+    char cacheDir[4096];
+    snprintf(cacheDir, sizeof(cacheDir), "%s%s", CACHE_PATH, REPACK_CACHE_DIRNAME);
+    ctx.cache = diskcache_open(cacheDir, REPACK_CACHE_CAPACITY);
+
+    threadpool_t *pool = threadpool_create(0);
+    ctx.pool = pool;
+
+    repack_root_entry_t *roots = NULL;
+    filetree_node_t **rootOrder = NULL;
+
+    for (int i = 0; i < numOverrides; ++i) {
+        filetree_node_t *root = getPackingRoot(overrides[i]);
+        assert(root);
+
+        if (stbds_hmgeti(roots, root) < 0) {
+            stbds_hmput(roots, root, true);
+            stbds_arrput(rootOrder, root);
+        }
+    }
+
+    // One job per entry of every packed file we're about to write, hashed
+    // up front so duplicates are known before anything is compressed.
+    size_t numRoots = stbds_arrlenu(rootOrder);
+    repack_job_t ***rootJobs = NULL;
+    char **srcFilenames = NULL;
+
+    TRACE_BEGIN("repack_hash");
+    for (int i = 0; i < numRoots; ++i) {
+        char srcFilename[4096];
+        filetree_getPackedFilename(rootOrder[i], srcFilename, sizeof(srcFilename));
+        stbds_arrput(srcFilenames, mem_strdup(MEM_TAG_REPACK, srcFilename));
+
+        filetree_node_t **files = NULL;
+        repack_collectRootFiles(rootOrder[i], patchlist, &files);
+
+        repack_job_t **jobs = NULL;
+        size_t numFiles = stbds_arrlenu(files);
+        for (int j = 0; j < numFiles; ++j) {
+            repack_job_t *job = (repack_job_t*)mem_calloc(MEM_TAG_REPACK, 1, sizeof(*job));
+            job->ctx = &ctx;
+            job->node = files[j];
+            job->srcFilename = srcFilenames[i];
+            job->override = files[j]->sourcePath != NULL;
+            stbds_arrput(jobs, job);
+
+            threadpool_submit(pool, repack_hashJob, job);
+        }
+
+        stbds_arrput(rootJobs, jobs);
+        stbds_arrfree(files);
+    }
+
+    threadpool_wait(pool);
+    TRACE_END();
+
+    // Compression is shared across every packed file, storage only within
+    // one. Anything that couldn't be hashed is left alone and fails later.
+    repack_hash_entry_t *compressTable = NULL;
+
+    for (int i = 0; i < numRoots; ++i) {
+        repack_hash_entry_t *storeTable = NULL;
+
+        size_t numJobs = stbds_arrlenu(rootJobs[i]);
+        for (int j = 0; j < numJobs; ++j) {
+            repack_job_t *job = rootJobs[i][j];
+
+            if (job->hashed) {
+                job->storedAs = findDuplicate(&storeTable, job);
+            }
+
+            if (!job->override || job->storedAs) {
+                continue;
+            }
+
+            repack_job_t *dup = job->hashed ? findDuplicate(&compressTable, job) : NULL;
+            job->compressedBy = dup ? dup : job;
+            job->compressedBy->users++;
+
+            // NOTE: submitted in the order they'll be written. Big files
+            // are left to the writer, which splits them across the pool
+            // once it gets to them.
+            if (!dup) {
+                if (job->contentLen >= ZPARALLEL_MIN_SIZE) {
+                    job->deferred = true;
+                } else {
+                    threadpool_submit(pool, repack_compressJob, job);
+                }
+            }
+        }
+
+        freeHashTable(storeTable);
+    }
+
+    // NOTE: a root that fails doesn't stop the rest; everything queued for
+    // them still has to finish before the jobs are freed anyway.
+    bool ok = true;
+
+    TRACE_BEGIN("repack_write");
+    for (int i = 0; i < numRoots; ++i) {
+        TRACE_BEGIN_DETAIL("write_packed", rootOrder[i]->path);
+        ok = repack_writeRoot(&ctx, rootOrder[i], rootJobs[i], outPath) && ok;
+        TRACE_END();
+    }
+
+    threadpool_wait(pool);
+    TRACE_END();
+    threadpool_free(pool);
+
+    for (int i = 0; i < numRoots; ++i) {
+        size_t numJobs = stbds_arrlenu(rootJobs[i]);
+        for (int j = 0; j < numJobs; ++j) {
+            mem_free(rootJobs[i][j]->data);
+            mem_free(rootJobs[i][j]->cachedPath);
+            mem_free(rootJobs[i][j]);
+        }
+        stbds_arrfree(rootJobs[i]);
+        mem_free(srcFilenames[i]);
+    }
+
+    diskcache_close(ctx.cache);
+
+    pthread_cond_destroy(&ctx.jobDone);
+    pthread_mutex_destroy(&ctx.lock);
+
+    freeHashTable(compressTable);
+    stbds_arrfree(srcFilenames);
+    stbds_arrfree(rootJobs);
+    stbds_arrfree(rootOrder);
+    stbds_hmfree(roots);
+    stbds_arrfree(overrides);
+
+    return ok;
+}
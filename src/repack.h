@@ -0,0 +1,15 @@
+#pragma once
+
+#include "filetree.h"
+#include "patchlist.h"
+
+// Entries start on this boundary within a packed file.
+#define REPACK_ALIGNMENT (0x80)
+#define REPACK_COMPRESSION_LEVEL (9)
+
+// Compressed streams of workspace files are kept here, under CACHE_PATH,
+// so unchanged files don't get recompressed on every build.
+#define REPACK_CACHE_DIRNAME "repack"
+#define REPACK_CACHE_CAPACITY (2ULL << 30)
+
+bool repack_build(filetree_node_t *resTree, filetree_node_t *localTree, patchlist_t *patchlist, const char *outPath);
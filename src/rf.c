@@ -5,9 +5,12 @@
 
 #include <zlib.h>
 
-#include "vendor/stb_ds.h"
+#include "ds.h"
 
+#include "mem.h"
 #include "rf.h"
+#include "trace.h"
+#include "zparallel.h"
 
 typedef struct {
     char *key;
@@ -16,6 +19,7 @@ typedef struct {
 
 resource_t* loadResourcesFromRFFile(const char *filename)
 {
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_RF);
     resource_t *resources = NULL;
 
     rf_header_t header = { 0 };
@@ -32,24 +36,26 @@ resource_t* loadResourcesFromRFFile(const char *filename)
         fseek(fd, 0, SEEK_END);
         size_t dataSize = ftell(fd);
         fseek(fd, 0, SEEK_SET);
-        uint8_t *compressedData = (uint8_t*)malloc(dataSize);
+        uint8_t *compressedData = (uint8_t*)mem_malloc(MEM_TAG_RF, dataSize);
 
         fread(compressedData, dataSize, 1, fd);
         fclose(fd);
 
         memcpy(&header, compressedData, sizeof(header));
 
-        uncompressedData = (uint8_t*)calloc(1, header.sizeUncompressed);
+        uncompressedData = (uint8_t*)mem_calloc(MEM_TAG_RF, 1, header.sizeUncompressed);
 
         // NOTE: `uncompress` mutates this, but is a different size
         // so use a new variable to avoid clobbering other header fields.
         uint64_t destLen = header.sizeUncompressed;
+        TRACE_BEGIN("rf_inflate");
         uncompress(
             uncompressedData, &destLen, // dest
             compressedData+header.headerSize, header.sizeCompressed // src
         );
+        TRACE_END();
 
-        free(compressedData);
+        mem_free(compressedData);
 
         entries = (rf_entry_t*)(uncompressedData);
         stringsData = (char*)uncompressedData + header.stringBlockOffset - header.headerSize + 4;
@@ -68,7 +74,7 @@ resource_t* loadResourcesFromRFFile(const char *filename)
 
         for (int i = 0; i < numExtensions; ++i) {
             uint32_t extIdx = *(uint32_t*)(addr + i * 4);
-            char *ext = strdup(stringsData + extIdx);
+            char *ext = mem_strdup(MEM_TAG_RF, stringsData + extIdx);
             stbds_arrput(extensions, ext);
         }
     }
@@ -96,18 +102,18 @@ resource_t* loadResourcesFromRFFile(const char *filename)
             uint16_t off = (ref & 0xE0) >> 6 << 8 | (ref >> 8);
 
             // slice first part
-            char *s = strdup((stringsData + strOffset) - off);
+            char *s = mem_strdup(MEM_TAG_RF, (stringsData + strOffset) - off);
             s[len] = '\0';
 
             char buf[1024] = { 0 };
             sprintf(buf, "%s%s", s, stringsData + strOffset + 2);
-            free(s);
+            mem_free(s);
             name = buf;
         } else {
             name = stringsData + strOffset;
         }
 
-        res.filename = (char*)calloc(1, strlen(name) + strlen(extension) + 1);
+        res.filename = (char*)mem_calloc(MEM_TAG_RF, 1, strlen(name) + strlen(extension) + 1);
         sprintf(res.filename, "%s%s", name, extension);
 
         stbds_arrput(resources, res);
@@ -116,19 +122,36 @@ resource_t* loadResourcesFromRFFile(const char *filename)
     // Free temporary data
     size_t numExtensions = stbds_arrlenu(extensions);
     for (int i = 0; i < numExtensions; ++i) {
-        free(extensions[i]);
+        mem_free(extensions[i]);
     }
     stbds_arrfree(extensions);
 
-    free(uncompressedData);
+    mem_free(uncompressedData);
+    mem_setTag(prevTag);
 
     return resources;
 }
 
-void saveResourcesToRFFile(resource_t *resources, const char *filename)
+static void rf_append(uint8_t **buf, const void *data, size_t len)
 {
+    memcpy(stbds_arraddnptr(*buf, len), data, len);
+}
+
+// Pads `buf` out to a multiple of `alignment` with `fill`.
+static void rf_appendPadding(uint8_t **buf, size_t alignment, uint8_t fill)
+{
+    size_t padSize = (alignment - (stbds_arrlenu(*buf) % alignment)) % alignment;
+    memset(stbds_arraddnptr(*buf, padSize), fill, padSize);
+}
+
+// False, after printing why, if the file couldn't be written.
+bool saveResourcesToRFFile(resource_t *resources, const char *filename)
+{
+    TRACE_BEGIN_DETAIL("rf_save", filename);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_RF);
+
     size_t numResources = stbds_arrlenu(resources);
-    rf_entry_t *entriesOut = (rf_entry_t*)calloc(numResources, sizeof(*entriesOut));
+    rf_entry_t *entriesOut = (rf_entry_t*)mem_calloc(MEM_TAG_RF, numResources, sizeof(*entriesOut));
 
     size_t stringsSize = 0;
     string_table_entry_t *stringMap = NULL;
@@ -157,21 +180,12 @@ void saveResourcesToRFFile(resource_t *resources, const char *filename)
         entry->flags = res->flags;
     }
 
-    // FIXME: this file is just a hack to avoid buffering
-    // but it is helpful for debugging as well at the moment.
-    FILE *decompressedFileOut = fopen("tmp_decomp.bin", "w+b");
-    assert(decompressedFileOut);
-    
-    fwrite(entriesOut, sizeof(rf_entry_t), numResources, decompressedFileOut);
-    
-    // Align to 0x80.
-    {
-        size_t padSize = (0x80 - (ftell(decompressedFileOut) % 0x80)) % 0x80;
-        uint8_t *bbPadBuff = (uint8_t*)malloc(padSize);
-        memset(bbPadBuff, 0xBB, padSize);
-        fwrite(bbPadBuff, padSize, 1, decompressedFileOut);
-        free(bbPadBuff);
-    }
+    // NOTE: the table is staged in memory, since it's compressed as a
+    // whole right after; nothing touches the disk until the final write.
+    uint8_t *table = NULL;
+    rf_append(&table, entriesOut, numResources * sizeof(rf_entry_t));
+    mem_free(entriesOut);
+    rf_appendPadding(&table, 0x80, 0xBB);
 
     // NOTE: strings are in blocks of 0x2000 bytes, so this chunk
     // is necessarily aligned to 0x2000.
@@ -180,31 +194,24 @@ void saveResourcesToRFFile(resource_t *resources, const char *filename)
     size_t stringChunkSize = stringsSize + stringsPadSize;
 
     uint32_t numStringSections = (stringChunkSize / 0x2000);
-    fwrite(&numStringSections, 4, 1, decompressedFileOut);
+    rf_append(&table, &numStringSections, 4);
 
     for (int i = 0; i < numStrings; ++i) {
         string_table_entry_t *str = &stringMap[i];
-        fwrite(str->key, strlen(str->key)+1, 1, decompressedFileOut);
+        rf_append(&table, str->key, strlen(str->key)+1);
     }
+    stbds_shfree(stringMap);
 
-    uint8_t *padBuf = (uint8_t*)calloc(1, stringsPadSize);
-    fwrite(padBuf, stringsPadSize, 1, decompressedFileOut);
-    free(padBuf);
+    memset(stbds_arraddnptr(table, stringsPadSize), 0, stringsPadSize);
 
     // NOTE: extensions are dumb and pointless. we don't use that nonsense.
     uint32_t numExtensions = 1;
-    fwrite(&numExtensions, 4, 1, decompressedFileOut);
+    rf_append(&table, &numExtensions, 4);
     uint32_t nullExt = 0;
-    fwrite(&nullExt, 4, 1, decompressedFileOut);
+    rf_append(&table, &nullExt, 4);
 
     // Again, align to 0x80
-    {
-        size_t padSize = (0x80 - (ftell(decompressedFileOut) % 0x80)) % 0x80;
-        uint8_t *bbPadBuff = (uint8_t*)malloc(padSize);
-        memset(bbPadBuff, 0xBB, padSize);
-        fwrite(bbPadBuff, padSize, 1, decompressedFileOut);
-        free(bbPadBuff);
-    }
+    rf_appendPadding(&table, 0x80, 0xBB);
 
     //// Write header + compressed data
     rf_header_t header = { 0 };
@@ -218,37 +225,54 @@ void saveResourcesToRFFile(resource_t *resources, const char *filename)
     header.entriesBlockSize = numResources * sizeof(rf_entry_t);
     header.timestamp = 0;
     header.sizeCompressed = 0;
-    header.sizeUncompressed = ftell(decompressedFileOut);
+    header.sizeUncompressed = stbds_arrlenu(table);
     header.stringBlockOffset = header.entriesBlockOffset + header.entriesBlockSize;
-    header.stringBlockOffset += (0x80 - (header.stringBlockOffset % 0x80)) % 80;
+    header.stringBlockOffset += (0x80 - (header.stringBlockOffset % 0x80)) % 0x80;
     header.stringBlockSize = stringsSize;
     header.numEntries = numResources;
 
-    uint8_t *uncompressedData = (uint8_t*)malloc(header.sizeUncompressed);
-    fseek(decompressedFileOut, 0, SEEK_SET);
-    fread(uncompressedData, header.sizeUncompressed, 1, decompressedFileOut);
-    fclose(decompressedFileOut);
-
-    free(entriesOut);
+    size_t compressedDataSize = zparallel_compressBound(header.sizeUncompressed);
+    uint8_t *compressedData = (uint8_t*)mem_malloc(MEM_TAG_RF, compressedDataSize);
 
-    uint64_t compressedDataSize = header.sizeUncompressed;
-    uint8_t *compressedData = (uint8_t*)malloc(compressedDataSize);
-
-    compress(
+    TRACE_BEGIN("rf_compress");
+    int ret = zparallel_compress(
+        NULL,
         compressedData, &compressedDataSize,
-        uncompressedData, header.sizeUncompressed
+        table, header.sizeUncompressed,
+        Z_DEFAULT_COMPRESSION
     );
+    TRACE_END();
+
+    stbds_arrfree(table);
 
-    free(uncompressedData);
+    if (ret != Z_OK) {
+        printf("[rf] failed to compress %s (%d)\n", filename, ret);
+        mem_free(compressedData);
+        mem_setTag(prevTag);
+        TRACE_END();
+        return false;
+    }
 
     header.sizeCompressed = compressedDataSize;
 
     // Finally, create the actual resource file.
     FILE *finalOut = fopen(filename, "wb");
-    fwrite(&header, sizeof(header), 1, finalOut);
-    fwrite(compressedData, compressedDataSize, 1, finalOut);
-    free(compressedData);
-    fclose(finalOut);
+    bool ok = finalOut != NULL;
+    if (ok) {
+        ok = fwrite(&header, sizeof(header), 1, finalOut) == 1
+            && fwrite(compressedData, compressedDataSize, 1, finalOut) == 1;
+        ok = fclose(finalOut) == 0 && ok;
+    }
+    mem_free(compressedData);
+
+    if (!ok) {
+        printf("[rf] cannot write %s\n", filename);
+    }
+
+    mem_setTag(prevTag);
+    TRACE_END();
+
+    return ok;
 }
 
 void freeResources(resource_t *resources)
@@ -257,7 +281,7 @@ void freeResources(resource_t *resources)
 
     for (int i = 0; i < numResources; ++i) {
         resource_t *res = &resources[i];
-        free(res->filename);
+        mem_free(res->filename);
     }
 
     stbds_arrfree(resources);
@@ -265,9 +289,9 @@ void freeResources(resource_t *resources)
 
 resource_t *resource_clone(resource_t *res)
 {
-    resource_t *newRes = (resource_t*)malloc(sizeof(*newRes));
+    resource_t *newRes = (resource_t*)mem_malloc(MEM_TAG_RF, sizeof(*newRes));
     newRes->packOffset = res->packOffset;
-    newRes->filename = strdup(res->filename);
+    newRes->filename = mem_strdup(MEM_TAG_RF, res->filename);
     newRes->sizeCompressed = res->sizeCompressed;
     newRes->sizeUncompressed = res->sizeUncompressed;
     newRes->timestamp = res->timestamp;
@@ -275,3 +299,9 @@ resource_t *resource_clone(resource_t *res)
 
     return newRes;
 }
+
+bool resource_isStored(resource_t *res)
+{
+    return res->sizeCompressed == res->sizeUncompressed
+        && res->sizeCompressed >= RES_STORED_HEADER_LEN;
+}
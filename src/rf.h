@@ -14,6 +14,10 @@ typedef enum {
     RES_FLAG_UNK_8000 = 0x8000,
 } resource_flag_t;
 
+// NOTE: entries whose compressed and uncompressed sizes match are stored
+// as-is rather than deflated, behind a header of this size in `packed`.
+#define RES_STORED_HEADER_LEN (0x80)
+
 #pragma pack(push, 1)
 typedef struct {
     char magic[2];
@@ -54,7 +58,8 @@ typedef struct {
 } resource_t;
 
 resource_t* loadResourcesFromRFFile(const char *filename);
-void saveResourcesToRFFile(resource_t *resources, const char *filename);
+bool saveResourcesToRFFile(resource_t *resources, const char *filename);
 void freeResources(resource_t *resources);
 
 resource_t *resource_clone(resource_t *res);
+bool resource_isStored(resource_t *res);
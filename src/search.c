@@ -0,0 +1,190 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "ds.h"
+
+#include "filetree.h"
+#include "mem.h"
+#include "search.h"
+
+// Substring search over every node path. Each path is broken into
+// (lowercased) trigrams, with a posting list of node indices per trigram.
+// A query only has to verify the nodes that contain all of its trigrams.
+
+static uint32_t search_trigram(const char *s)
+{
+    return (uint32_t)(uint8_t)tolower(s[0]) << 16
+        | (uint32_t)(uint8_t)tolower(s[1]) << 8
+        | (uint32_t)(uint8_t)tolower(s[2]);
+}
+
+search_index_t* search_buildIndex(filetree_node_t *root)
+{
+    search_index_t *index = (search_index_t*)mem_calloc(MEM_TAG_EXPLORER, 1, sizeof(*index));
+    index->nodes = filetree_collectNodes(root);
+
+    size_t numNodes = stbds_arrlenu(index->nodes);
+    index->hits = (uint8_t*)mem_calloc(MEM_TAG_EXPLORER, numNodes, 1);
+
+    for (uint32_t i = 0; i < numNodes; ++i) {
+        const char *path = index->nodes[i]->path;
+        size_t len = path ? strlen(path) : 0;
+
+        for (size_t j = 0; j + 3 <= len; ++j) {
+            uint32_t tri = search_trigram(path + j);
+            search_posting_t *p = stbds_hmgetp_null(index->postings, tri);
+
+            if (!p) {
+                stbds_hmput(index->postings, tri, NULL);
+                p = stbds_hmgetp(index->postings, tri);
+            }
+
+            // NOTE: nodes are visited in order, so a trigram repeated
+            // within one path only needs checking against the last entry.
+            size_t numIndices = stbds_arrlenu(p->value);
+            if (numIndices == 0 || p->value[numIndices - 1] != i) {
+                stbds_arrput(p->value, i);
+            }
+        }
+    }
+
+    return index;
+}
+
+void search_freeIndex(search_index_t *index)
+{
+    size_t numPostings = stbds_hmlenu(index->postings);
+    for (int i = 0; i < numPostings; ++i) {
+        stbds_arrfree(index->postings[i].value);
+    }
+
+    stbds_hmfree(index->postings);
+    stbds_arrfree(index->nodes);
+    stbds_arrfree(index->results);
+    mem_free(index->hits);
+    mem_free(index);
+}
+
+// Keep only entries of `a` that also appear in `b` (both ascending).
+static void search_intersect(uint32_t **a, const uint32_t *b)
+{
+    size_t numA = stbds_arrlenu(*a);
+    size_t numB = stbds_arrlenu(b);
+    size_t i = 0;
+    size_t j = 0;
+    size_t out = 0;
+
+    while (i < numA && j < numB) {
+        if ((*a)[i] < b[j]) {
+            ++i;
+        } else if ((*a)[i] > b[j]) {
+            ++j;
+        } else {
+            (*a)[out++] = (*a)[i];
+            ++i;
+            ++j;
+        }
+    }
+
+    stbds_arrsetlen(*a, out);
+}
+
+static void search_clearHits(search_index_t *index)
+{
+    size_t numResults = stbds_arrlenu(index->results);
+    for (int i = 0; i < numResults; ++i) {
+        filetree_node_t *n = index->nodes[index->results[i]];
+        for (; n && index->hits[n->index]; n = n->parent) {
+            index->hits[n->index] = SEARCH_HIT_NONE;
+        }
+    }
+}
+
+// Runs `query` (case-insensitive substring) and marks every match, and
+// every ancestor of a match, in `hits`. Returns the number of matches.
+size_t search_query(search_index_t *index, const char *query)
+{
+    size_t len = strlen(query);
+    size_t numNodes = stbds_arrlenu(index->nodes);
+
+    uint32_t *candidates = NULL;
+
+    // start from the rarest trigram to keep the intersections small
+    search_posting_t *rarest = NULL;
+    for (size_t i = 0; i + 3 <= len; ++i) {
+        search_posting_t *p = stbds_hmgetp_null(index->postings, search_trigram(query + i));
+        if (!p) {
+            goto verify;
+        }
+        if (!rarest || stbds_arrlenu(p->value) < stbds_arrlenu(rarest->value)) {
+            rarest = p;
+        }
+    }
+
+    // When typing extends the last query, its matches are a superset of
+    // the new ones; check those instead if there are fewer of them.
+    size_t numPrev = stbds_arrlenu(index->results);
+    bool narrowing = index->query[0] && strcasestr(query, index->query)
+        && (!rarest || numPrev < stbds_arrlenu(rarest->value));
+
+    if (narrowing) {
+        stbds_arrsetlen(candidates, numPrev);
+        memcpy(candidates, index->results, numPrev * sizeof(*candidates));
+    } else if (rarest) {
+        stbds_arrsetlen(candidates, stbds_arrlenu(rarest->value));
+        memcpy(candidates, rarest->value, stbds_arrlenu(rarest->value) * sizeof(*candidates));
+
+        for (size_t i = 0; i + 3 <= len && stbds_arrlenu(candidates) > 0; ++i) {
+            search_posting_t *p = stbds_hmgetp_null(index->postings, search_trigram(query + i));
+            if (p != rarest) {
+                search_intersect(&candidates, p->value);
+            }
+        }
+    } else if (len > 0) {
+        // too short for trigrams; just scan everything
+        stbds_arrsetlen(candidates, numNodes);
+        for (uint32_t i = 0; i < numNodes; ++i) {
+            candidates[i] = i;
+        }
+    }
+
+verify:
+    search_clearHits(index);
+    stbds_arrsetlen(index->results, 0);
+
+    size_t numCandidates = stbds_arrlenu(candidates);
+    for (int i = 0; i < numCandidates; ++i) {
+        filetree_node_t *node = index->nodes[candidates[i]];
+        if (node->path && strcasestr(node->path, query)) {
+            stbds_arrput(index->results, candidates[i]);
+        }
+    }
+
+    stbds_arrfree(candidates);
+
+    size_t numResults = stbds_arrlenu(index->results);
+    for (int i = 0; i < numResults; ++i) {
+        filetree_node_t *node = index->nodes[index->results[i]];
+        index->hits[node->index] |= SEARCH_HIT_MATCH;
+
+        for (filetree_node_t *n = node->parent; n; n = n->parent) {
+            if (index->hits[n->index] & SEARCH_HIT_DESCENDANT) {
+                break;
+            }
+            index->hits[n->index] |= SEARCH_HIT_DESCENDANT;
+        }
+    }
+
+    snprintf(index->query, sizeof(index->query), "%s", query);
+
+    return numResults;
+}
+
+search_hit_t search_getHit(search_index_t *index, filetree_node_t *node)
+{
+    return index->hits[node->index];
+}
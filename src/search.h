@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filetree.h"
+
+#define SEARCH_QUERY_LEN (256)
+
+typedef enum {
+    SEARCH_HIT_NONE       = 0,
+    SEARCH_HIT_MATCH      = 1 << 0,
+    SEARCH_HIT_DESCENDANT = 1 << 1,
+} search_hit_t;
+
+typedef struct {
+    uint32_t key; // trigram, lowercased
+    uint32_t *value; // ascending node indices
+} search_posting_t;
+
+typedef struct {
+    filetree_node_t **nodes;
+    search_posting_t *postings;
+
+    // results of the last query, indexed by `filetree_node_t.index`
+    uint8_t *hits;
+    uint32_t *results;
+    char query[SEARCH_QUERY_LEN];
+} search_index_t;
+
+search_index_t* search_buildIndex(filetree_node_t *root);
+void search_freeIndex(search_index_t *index);
+
+size_t search_query(search_index_t *index, const char *query);
+search_hit_t search_getHit(search_index_t *index, filetree_node_t *node);
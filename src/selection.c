@@ -0,0 +1,412 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fnmatch.h>
+#include <regex.h>
+
+#include "ds.h"
+
+#include "filetree.h"
+#include "mem.h"
+#include "rf.h"
+#include "selection.h"
+#include "threadpool.h"
+#include "trace.h"
+
+// Globs are split into path segments when compiled, each matched with
+// fnmatch against one segment of the path, so `*` never crosses a `/` and
+// a directory's path alone says whether anything under it could match.
+//
+// Evaluation runs over the pre-order node array in chunks handed out from a
+// shared counter; a pruned directory skips straight to its `subtreeEnd`.
+
+typedef struct {
+    selection_t *sel;
+    filetree_node_t **nodes;
+    size_t numNodes;
+    size_t next; // next chunk to hand out
+    uint8_t *hits; // per node
+} selection_ctx_t;
+
+// NOTE: glibc's regexec locks the regex_t it's given, so every worker
+// matches against its own copy.
+typedef struct {
+    selection_t *sel;
+    regex_t *regexes; // per pattern, only regex ones compiled; NULL to use the patterns' own
+} selection_worker_t;
+
+static bool selection_isDoubleStar(const char *segment)
+{
+    return !strcmp(segment, "**");
+}
+
+// Copies the path segment at `path` into `buf`; returns where it ended.
+static const char* selection_nextSegment(const char *path, char *buf, size_t len)
+{
+    const char *end = strchr(path, '/');
+    if (!end) {
+        end = path + strlen(path);
+    }
+
+    size_t n = end - path;
+    if (n >= len) {
+        n = len - 1;
+    }
+    memcpy(buf, path, n);
+    buf[n] = '\0';
+
+    return end;
+}
+
+static bool selection_globMatches(char **segments, size_t numSegments, const char *path)
+{
+    if (numSegments == 0) {
+        return *path == '\0';
+    }
+
+    if (selection_isDoubleStar(segments[0])) {
+        if (numSegments == 1) {
+            return true;
+        }
+
+        // zero or more whole segments
+        for (const char *p = path; p; p = strchr(p, '/')) {
+            if (*p == '/') {
+                p++;
+            }
+            if (selection_globMatches(segments + 1, numSegments - 1, p)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (*path == '\0') {
+        return false;
+    }
+
+    char segment[256];
+    const char *end = selection_nextSegment(path, segment, sizeof(segment));
+    if (fnmatch(segments[0], segment, 0) != 0) {
+        return false;
+    }
+
+    if (*end == '\0') {
+        return numSegments == 1;
+    }
+    return selection_globMatches(segments + 1, numSegments - 1, end + 1);
+}
+
+// Could a file under `dir` (e.g. `fighter/mario/`) match?
+static bool selection_globCouldContain(char **segments, size_t numSegments, const char *dir)
+{
+    if (*dir == '\0') {
+        return numSegments > 0;
+    }
+    if (numSegments == 0) {
+        return false;
+    }
+    if (selection_isDoubleStar(segments[0])) {
+        return true;
+    }
+
+    char segment[256];
+    const char *end = selection_nextSegment(dir, segment, sizeof(segment));
+    if (fnmatch(segments[0], segment, 0) != 0) {
+        return false;
+    }
+
+    return selection_globCouldContain(segments + 1, numSegments - 1, *end ? end + 1 : end);
+}
+
+// Does every file under `dir` match?
+static bool selection_globCovers(char **segments, size_t numSegments, const char *dir)
+{
+    if (numSegments == 0) {
+        return false;
+    }
+    if (selection_isDoubleStar(segments[0])) {
+        return numSegments == 1;
+    }
+    if (*dir == '\0') {
+        return false;
+    }
+
+    char segment[256];
+    const char *end = selection_nextSegment(dir, segment, sizeof(segment));
+    if (fnmatch(segments[0], segment, 0) != 0) {
+        return false;
+    }
+
+    return selection_globCovers(segments + 1, numSegments - 1, *end ? end + 1 : end);
+}
+
+static bool selection_compilePattern(selection_pattern_t *p, const char *spec)
+{
+    if (spec[0] == '!') {
+        p->exclude = true;
+        spec++;
+    }
+
+    size_t prefixLen = strlen(SELECTION_REGEX_PREFIX);
+    if (!strncmp(spec, SELECTION_REGEX_PREFIX, prefixLen)) {
+        p->isRegex = true;
+        p->source = mem_strdup(MEM_TAG_FILETREE, spec + prefixLen);
+
+        int ret = regcomp(&p->regex, p->source, REG_EXTENDED | REG_NOSUB);
+        if (ret != 0) {
+            char err[256];
+            regerror(ret, &p->regex, err, sizeof(err));
+            printf("[selection] bad regex %s: %s\n", p->source, err);
+            return false;
+        }
+
+        return true;
+    }
+
+    p->source = mem_strdup(MEM_TAG_FILETREE, spec);
+
+    // like .gitignore: a bare name matches at any depth
+    if (!strchr(p->source, '/')) {
+        stbds_arrput(p->segments, mem_strdup(MEM_TAG_FILETREE, "**"));
+    }
+
+    const char *s = p->source;
+    while (*s) {
+        char segment[256];
+        const char *end = selection_nextSegment(s, segment, sizeof(segment));
+
+        // `a//b` and a trailing `/` add nothing
+        if (segment[0]) {
+            stbds_arrput(p->segments, mem_strdup(MEM_TAG_FILETREE, segment));
+        }
+        s = *end ? end + 1 : end;
+    }
+
+    return true;
+}
+
+static void selection_freePattern(selection_pattern_t *p)
+{
+    if (p->isRegex) {
+        regfree(&p->regex);
+    }
+
+    size_t numSegments = stbds_arrlenu(p->segments);
+    for (int i = 0; i < numSegments; ++i) {
+        mem_free(p->segments[i]);
+    }
+    stbds_arrfree(p->segments);
+    mem_free(p->source);
+}
+
+selection_t* selection_compile(char **specs, size_t numSpecs)
+{
+    selection_t *sel = (selection_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*sel));
+
+    for (int i = 0; i < numSpecs; ++i) {
+        selection_pattern_t p = { 0 };
+        bool ok = selection_compilePattern(&p, specs[i]);
+
+        // NOTE: a failed regcomp leaves nothing to regfree
+        p.isRegex = p.isRegex && ok;
+        stbds_arrput(sel->patterns, p);
+
+        if (!ok) {
+            selection_free(sel);
+            return NULL;
+        }
+
+        sel->numIncludes += !p.exclude;
+    }
+
+    return sel;
+}
+
+void selection_free(selection_t *sel)
+{
+    size_t numPatterns = stbds_arrlenu(sel->patterns);
+    for (int i = 0; i < numPatterns; ++i) {
+        selection_freePattern(&sel->patterns[i]);
+    }
+
+    stbds_arrfree(sel->patterns);
+    mem_free(sel);
+}
+
+static bool selection_patternMatches(selection_pattern_t *p, regex_t *regex, const char *path)
+{
+    if (p->isRegex) {
+        return regexec(regex, path, 0, NULL, 0) == 0;
+    }
+
+    return selection_globMatches(p->segments, stbds_arrlenu(p->segments), path);
+}
+
+static bool selection_matchesWith(selection_worker_t *w, const char *path)
+{
+    selection_t *sel = w->sel;
+    bool included = sel->numIncludes == 0;
+
+    size_t numPatterns = stbds_arrlenu(sel->patterns);
+    for (int i = 0; i < numPatterns; ++i) {
+        selection_pattern_t *p = &sel->patterns[i];
+        regex_t *regex = w->regexes ? &w->regexes[i] : &p->regex;
+
+        if (p->exclude) {
+            if (selection_patternMatches(p, regex, path)) {
+                return false;
+            }
+        } else if (!included) {
+            included = selection_patternMatches(p, regex, path);
+        }
+    }
+
+    return included;
+}
+
+bool selection_matches(selection_t *sel, const char *path)
+{
+    selection_worker_t w = { .sel = sel };
+    return selection_matchesWith(&w, path);
+}
+
+// Nothing under `dir` can be selected. Regexes never prune.
+static bool selection_prunes(selection_t *sel, const char *dir)
+{
+    bool couldContain = sel->numIncludes == 0;
+
+    size_t numPatterns = stbds_arrlenu(sel->patterns);
+    for (int i = 0; i < numPatterns; ++i) {
+        selection_pattern_t *p = &sel->patterns[i];
+        size_t numSegments = stbds_arrlenu(p->segments);
+
+        if (p->isRegex) {
+            couldContain = couldContain || !p->exclude;
+        } else if (p->exclude) {
+            if (selection_globCovers(p->segments, numSegments, dir)) {
+                return true;
+            }
+        } else if (!couldContain) {
+            couldContain = selection_globCouldContain(p->segments, numSegments, dir);
+        }
+    }
+
+    return !couldContain;
+}
+
+static bool selection_isDir(filetree_node_t *node)
+{
+    return node->res && (node->res->flags & RES_FLAG_DIR) && node->path;
+}
+
+// Where evaluating from `start` really begins: past the subtree of the
+// outermost pruned directory it's in, if any.
+static size_t selection_resume(selection_ctx_t *ctx, size_t start)
+{
+    size_t resume = start;
+
+    for (filetree_node_t *node = ctx->nodes[start]->parent; node; node = node->parent) {
+        if (selection_isDir(node) && selection_prunes(ctx->sel, node->path)) {
+            resume = node->subtreeEnd;
+        }
+    }
+
+    return resume;
+}
+
+static void selection_job(void *arg)
+{
+    selection_ctx_t *ctx = (selection_ctx_t*)arg;
+    selection_t *sel = ctx->sel;
+
+    size_t numPatterns = stbds_arrlenu(sel->patterns);
+    selection_worker_t w = {
+        .sel = sel,
+        .regexes = (regex_t*)mem_calloc(MEM_TAG_FILETREE, numPatterns + 1, sizeof(regex_t)),
+    };
+    for (int i = 0; i < numPatterns; ++i) {
+        if (sel->patterns[i].isRegex) {
+            regcomp(&w.regexes[i], sel->patterns[i].source, REG_EXTENDED | REG_NOSUB);
+        }
+    }
+
+    for (;;) {
+        size_t chunk = __atomic_fetch_add(&ctx->next, 1, __ATOMIC_RELAXED);
+        size_t start = chunk * SELECTION_CHUNK_SIZE;
+        if (start >= ctx->numNodes) {
+            break;
+        }
+
+        size_t end = start + SELECTION_CHUNK_SIZE;
+        if (end > ctx->numNodes) {
+            end = ctx->numNodes;
+        }
+
+        size_t i = selection_resume(ctx, start);
+        while (i < end) {
+            filetree_node_t *node = ctx->nodes[i];
+
+            if (selection_isDir(node) && selection_prunes(sel, node->path)) {
+                i = node->subtreeEnd;
+                continue;
+            }
+
+            if (node->res && !(node->res->flags & RES_FLAG_DIR) && node->path) {
+                ctx->hits[i] = selection_matchesWith(&w, node->path);
+            }
+            i++;
+        }
+    }
+
+    for (int i = 0; i < numPatterns; ++i) {
+        if (sel->patterns[i].isRegex) {
+            regfree(&w.regexes[i]);
+        }
+    }
+    mem_free(w.regexes);
+}
+
+filetree_node_t** selection_run(selection_t *sel, filetree_node_t *root)
+{
+    TRACE_BEGIN("selection_run");
+
+    filetree_node_t **nodes = filetree_collectNodes(root);
+    size_t numNodes = stbds_arrlenu(nodes);
+
+    selection_ctx_t ctx = {
+        .sel = sel,
+        .nodes = nodes,
+        .numNodes = numNodes,
+        .hits = (uint8_t*)mem_calloc(MEM_TAG_FILETREE, numNodes ? numNodes : 1, 1),
+    };
+
+    // One job per worker, unless there isn't enough to go round.
+    size_t numChunks = (numNodes + SELECTION_CHUNK_SIZE - 1) / SELECTION_CHUNK_SIZE;
+    if (numChunks > 1) {
+        threadpool_t *pool = threadpool_create(0);
+        size_t numJobs = numChunks < pool->numThreads ? numChunks : pool->numThreads;
+        for (int i = 0; i < numJobs; ++i) {
+            threadpool_submit(pool, selection_job, &ctx);
+        }
+
+        threadpool_wait(pool);
+        threadpool_free(pool);
+    } else {
+        selection_job(&ctx);
+    }
+
+    filetree_node_t **files = NULL;
+    for (size_t i = 0; i < numNodes; ++i) {
+        if (ctx.hits[i]) {
+            stbds_arrput(files, nodes[i]);
+        }
+    }
+
+    mem_free(ctx.hits);
+    stbds_arrfree(nodes);
+
+    TRACE_END();
+
+    return files;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <regex.h>
+
+#include "filetree.h"
+
+// Picks files by path (as in `node->path`, e.g. `fighter/mario/model/a.nut`)
+// from a set of include and exclude patterns:
+//
+//   fighter/*/model/**/*.nut   glob; `*` stays within a directory, `**`
+//                              spans any number of them
+//   *.nut                      no slash: matched at any depth
+//   re:^ui/.*\.bin$            POSIX extended regex
+//   !<any of the above>        exclude
+//
+// A file is selected if it matches any include (or there are none) and no
+// exclude. Whole directories are skipped when no include could match
+// anything under them, or an exclude covers everything under them.
+
+#define SELECTION_REGEX_PREFIX "re:"
+
+// Nodes per work item; small enough to spread over every worker, big
+// enough that handing them out costs nothing.
+#define SELECTION_CHUNK_SIZE (4096)
+
+typedef struct {
+    bool exclude;
+    bool isRegex;
+    char *source; // without `!` or `re:`
+    char **segments; // globs only, stb_ds array
+    regex_t regex; // regexes only
+} selection_pattern_t;
+
+typedef struct {
+    selection_pattern_t *patterns; // stb_ds array
+    size_t numIncludes;
+} selection_t;
+
+// NULL, after printing why, if a regex doesn't compile.
+selection_t* selection_compile(char **specs, size_t numSpecs);
+void selection_free(selection_t *sel);
+
+bool selection_matches(selection_t *sel, const char *path);
+
+// Every selected file under `root`, in tree order (stb_ds array). Numbers
+// the tree as `filetree_collectNodes` does.
+filetree_node_t** selection_run(selection_t *sel, filetree_node_t *root);
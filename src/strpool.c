@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds.h"
+
+#include "hash.h"
+#include "mem.h"
+#include "strpool.h"
+
+strpool_t* strpool_create()
+{
+    strpool_t *pool = (strpool_t*)mem_calloc(MEM_TAG_FILETREE, 1, sizeof(*pool));
+
+    for (int i = 0; i < STRPOOL_NUM_SHARDS; ++i) {
+        pthread_mutex_init(&pool->shards[i].lock, NULL);
+        sh_new_arena(pool->shards[i].strings);
+    }
+
+    return pool;
+}
+
+void strpool_free(strpool_t *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    for (int i = 0; i < STRPOOL_NUM_SHARDS; ++i) {
+        stbds_shfree(pool->shards[i].strings);
+        pthread_mutex_destroy(&pool->shards[i].lock);
+    }
+
+    mem_free(pool);
+}
+
+char* strpool_intern(strpool_t *pool, const char *str)
+{
+    strpool_shard_t *shard = &pool->shards[hash_string(str, 0) % STRPOOL_NUM_SHARDS];
+
+    pthread_mutex_lock(&shard->lock);
+
+    strpool_entry_t *entry = stbds_shgetp_null(shard->strings, str);
+    if (!entry) {
+        stbds_shput(shard->strings, str, 0);
+        entry = stbds_shgetp_null(shard->strings, str);
+    }
+    char *interned = entry->key;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    return interned;
+}
+
+// Interns `a` followed by `b`, without the caller needing a buffer.
+char* strpool_internConcat(strpool_t *pool, const char *a, const char *b)
+{
+    size_t lenA = strlen(a);
+    size_t lenB = strlen(b);
+
+    char stackBuf[512];
+    char *buf = lenA + lenB < sizeof(stackBuf) ? stackBuf : (char*)mem_malloc(MEM_TAG_FILETREE, lenA + lenB + 1);
+
+    memcpy(buf, a, lenA);
+    memcpy(buf + lenA, b, lenB + 1);
+
+    char *interned = strpool_intern(pool, buf);
+
+    if (buf != stackBuf) {
+        mem_free(buf);
+    }
+
+    return interned;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <pthread.h>
+
+// Shards keep concurrent loaders from queueing on one lock.
+#define STRPOOL_NUM_SHARDS (16)
+
+typedef struct {
+    char *key;
+    char value; // unused
+} strpool_entry_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    strpool_entry_t *strings; // arena-backed, so keys never move
+} strpool_shard_t;
+
+// Thread-safe string interning: equal strings come back as the same
+// pointer, which stays valid until the pool is freed.
+typedef struct {
+    strpool_shard_t shards[STRPOOL_NUM_SHARDS];
+} strpool_t;
+
+strpool_t* strpool_create();
+void strpool_free(strpool_t *pool);
+
+char* strpool_intern(strpool_t *pool, const char *str);
+char* strpool_internConcat(strpool_t *pool, const char *a, const char *b);
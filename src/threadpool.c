@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "ds.h"
+
+#include "mem.h"
+#include "threadpool.h"
+#include "trace.h"
+
+// Plain FIFO pool: jobs run in submission order, as workers free up.
+
+static __thread bool t_isWorker = false;
+
+static void* threadpool_workerMain(void *arg)
+{
+    threadpool_t *pool = (threadpool_t*)arg;
+    t_isWorker = true;
+    trace_setThreadName("worker");
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;) {
+        while (!pool->quit && pool->queueHead == stbds_arrlenu(pool->queue)) {
+            pthread_cond_wait(&pool->hasWork, &pool->lock);
+        }
+
+        if (pool->queueHead == stbds_arrlenu(pool->queue)) {
+            break; // quitting, and nothing left to do
+        }
+
+        threadpool_job_t job = pool->queue[pool->queueHead++];
+        if (pool->queueHead == stbds_arrlenu(pool->queue)) {
+            pool->queueHead = 0;
+            stbds_arrsetlen(pool->queue, 0);
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+        job.fn(job.arg);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0) {
+            pthread_cond_broadcast(&pool->idle);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+size_t threadpool_numCores()
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+}
+
+// `numThreads` of 0 means one per core.
+threadpool_t* threadpool_create(size_t numThreads)
+{
+    threadpool_t *pool = (threadpool_t*)mem_calloc(MEM_TAG_OTHER, 1, sizeof(*pool));
+    pool->numThreads = numThreads ? numThreads : threadpool_numCores();
+    pool->threads = (pthread_t*)mem_calloc(MEM_TAG_OTHER, pool->numThreads, sizeof(*pool->threads));
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->hasWork, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (int i = 0; i < pool->numThreads; ++i) {
+        pthread_create(&pool->threads[i], NULL, threadpool_workerMain, pool);
+    }
+
+    return pool;
+}
+
+// Finishes everything already submitted, then stops the workers.
+void threadpool_free(threadpool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->hasWork);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->numThreads; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->hasWork);
+    pthread_mutex_destroy(&pool->lock);
+
+    stbds_arrfree(pool->queue);
+    mem_free(pool->threads);
+    mem_free(pool);
+}
+
+void threadpool_submit(threadpool_t *pool, threadpool_fn_t fn, void *arg)
+{
+    threadpool_job_t job = { .fn = fn, .arg = arg };
+
+    pthread_mutex_lock(&pool->lock);
+    stbds_arrput(pool->queue, job);
+    pool->pending++;
+    pthread_cond_signal(&pool->hasWork);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Blocks until every submitted job has finished.
+// NOTE: must not be called from a job, or it waits on itself.
+void threadpool_wait(threadpool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+bool threadpool_isWorker()
+{
+    return t_isWorker;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+
+typedef void (*threadpool_fn_t)(void *arg);
+
+typedef struct {
+    threadpool_fn_t fn;
+    void *arg;
+} threadpool_job_t;
+
+typedef struct {
+    pthread_t *threads;
+    size_t numThreads;
+
+    threadpool_job_t *queue;
+    size_t queueHead;
+    size_t pending; // queued + running
+
+    pthread_mutex_t lock;
+    pthread_cond_t hasWork;
+    pthread_cond_t idle;
+    bool quit;
+} threadpool_t;
+
+size_t threadpool_numCores();
+
+threadpool_t* threadpool_create(size_t numThreads);
+void threadpool_free(threadpool_t *pool);
+
+void threadpool_submit(threadpool_t *pool, threadpool_fn_t fn, void *arg);
+void threadpool_wait(threadpool_t *pool);
+bool threadpool_isWorker();
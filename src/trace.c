@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ds.h"
+
+#include "trace.h"
+
+// Every thread records into its own buffer, so spans cost a clock read and
+// an array push; buffers are only gathered up by `trace_shutdown`.
+
+typedef struct {
+    const char *name;
+    char *detail;
+    uint64_t start; // ns since trace_init
+    uint64_t duration;
+} trace_event_t;
+
+typedef struct {
+    uint32_t tid;
+    char name[32];
+    trace_event_t *events; // stb_ds array, in begin order
+    size_t *open; // stb_ds array, stack of indices into events
+} trace_thread_t;
+
+bool g_traceEnabled = false;
+
+static char *s_filename = NULL;
+static uint64_t s_epoch = 0;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static trace_thread_t **s_threads = NULL;
+
+static __thread trace_thread_t *t_thread = NULL;
+
+static uint64_t trace_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static trace_thread_t* trace_getThread()
+{
+    if (!t_thread) {
+        t_thread = (trace_thread_t*)calloc(1, sizeof(*t_thread));
+
+        pthread_mutex_lock(&s_lock);
+        t_thread->tid = stbds_arrlenu(s_threads) + 1;
+        snprintf(t_thread->name, sizeof(t_thread->name), t_thread->tid == 1 ? "main" : "thread %u", t_thread->tid);
+        stbds_arrput(s_threads, t_thread);
+        pthread_mutex_unlock(&s_lock);
+    }
+
+    return t_thread;
+}
+
+// NULL (e.g. an unset env var) leaves tracing off.
+void trace_init(const char *filename)
+{
+    if (!filename || !filename[0]) {
+        return;
+    }
+
+    s_filename = strdup(filename);
+    s_epoch = trace_now();
+    g_traceEnabled = true;
+
+    trace_getThread();
+}
+
+void trace_begin(const char *name, const char *detail)
+{
+    trace_thread_t *thread = trace_getThread();
+
+    trace_event_t event = {
+        .name = name,
+        .detail = detail ? strdup(detail) : NULL,
+        .start = trace_now() - s_epoch,
+    };
+
+    stbds_arrput(thread->open, stbds_arrlenu(thread->events));
+    stbds_arrput(thread->events, event);
+}
+
+void trace_end()
+{
+    trace_thread_t *thread = trace_getThread();
+    if (stbds_arrlenu(thread->open) == 0) {
+        return;
+    }
+
+    trace_event_t *event = &thread->events[stbds_arrpop(thread->open)];
+    event->duration = trace_now() - s_epoch - event->start;
+}
+
+void trace_setThreadName(const char *name)
+{
+    if (!g_traceEnabled) {
+        return;
+    }
+
+    trace_thread_t *thread = trace_getThread();
+    snprintf(thread->name, sizeof(thread->name), "%s %u", name, thread->tid);
+}
+
+static void trace_writeString(FILE *f, const char *str)
+{
+    fputc('"', f);
+    for (const char *c = str; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            fprintf(f, "\\%c", *c);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(f, "\\u%04x", *c);
+        } else {
+            fputc(*c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+// Writes the trace and turns tracing off. Must only be called once every
+// other traced thread is done.
+void trace_shutdown()
+{
+    if (!g_traceEnabled) {
+        return;
+    }
+
+    g_traceEnabled = false;
+
+    FILE *f = fopen(s_filename, "w");
+    if (!f) {
+        fprintf(stderr, "[trace] cannot write %s\n", s_filename);
+    }
+
+    int pid = getpid();
+    bool first = true;
+    size_t numEvents = 0;
+
+    if (f) {
+        fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    }
+
+    size_t numThreads = stbds_arrlenu(s_threads);
+    for (int i = 0; i < numThreads; ++i) {
+        trace_thread_t *thread = s_threads[i];
+
+        if (f) {
+            fprintf(f, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":",
+                first ? "" : ",", pid, thread->tid);
+            trace_writeString(f, thread->name);
+            fprintf(f, "}}");
+            first = false;
+        }
+
+        size_t numThreadEvents = stbds_arrlenu(thread->events);
+        for (int j = 0; j < numThreadEvents; ++j) {
+            trace_event_t *event = &thread->events[j];
+
+            if (f) {
+                fprintf(f, ",\n{\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"name\":",
+                    pid, thread->tid, event->start / 1000.0, event->duration / 1000.0);
+                trace_writeString(f, event->name);
+                if (event->detail) {
+                    fprintf(f, ",\"args\":{\"detail\":");
+                    trace_writeString(f, event->detail);
+                    fprintf(f, "}");
+                }
+                fprintf(f, "}");
+            }
+
+            free(event->detail);
+        }
+
+        numEvents += numThreadEvents;
+        stbds_arrfree(thread->events);
+        stbds_arrfree(thread->open);
+        free(thread);
+    }
+
+    if (f) {
+        fprintf(f, "\n]}\n");
+        fclose(f);
+        fprintf(stderr, "[trace] wrote %zu spans from %zu threads to %s\n", numEvents, numThreads, s_filename);
+    }
+
+    stbds_arrfree(s_threads);
+    free(s_filename);
+    s_filename = NULL;
+    t_thread = NULL;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Span tracing, written out as a Chrome trace (chrome://tracing, or
+// ui.perfetto.dev). Off unless `trace_init` got a filename; while off, the
+// TRACE_* macros are a single branch.
+//
+// Spans nest per thread and must be closed on the thread that opened them.
+// `name` has to outlive the trace (use literals); `detail` is copied.
+
+#define TRACE_ENV_VAR "DTLS_TRACE"
+
+extern bool g_traceEnabled;
+
+#define TRACE_BEGIN(name) do { if (g_traceEnabled) trace_begin((name), NULL); } while (0)
+#define TRACE_BEGIN_DETAIL(name, detail) do { if (g_traceEnabled) trace_begin((name), (detail)); } while (0)
+#define TRACE_END() do { if (g_traceEnabled) trace_end(); } while (0)
+
+void trace_init(const char *filename);
+void trace_shutdown();
+
+void trace_begin(const char *name, const char *detail);
+void trace_end();
+void trace_setThreadName(const char *name);
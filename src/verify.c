@@ -0,0 +1,248 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include "filetree.h"
+#include "mem.h"
+#include "origin.h"
+#include "rf.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "verify.h"
+
+// Entries are sorted by the file they're read from and their offset in it,
+// then handed out one at a time from a shared counter, so the workers sweep
+// each packed (or dt) file front to back together and the reads stay close
+// to sequential.
+
+typedef struct {
+    filetree_node_t *node;
+    uint64_t source; // packing root, or dt index for base entries
+    uint64_t offset; // in that
+    size_t index; // into the caller's `files`
+} verify_item_t;
+
+typedef struct {
+    verify_item_t *items;
+    size_t numItems;
+    size_t next; // next item to hand out
+    uint8_t *statuses;
+} verify_ctx_t;
+
+typedef struct {
+    char filename[4096]; // packed file `fd` is open on
+    int fd;
+    uint64_t size;
+
+    z_stream strm;
+    uint8_t *input;
+    uint8_t *sink;
+} verify_worker_t;
+
+static const char *s_statusNames[] = {
+    [VERIFY_OK] = "ok",
+    [VERIFY_MISSING] = "missing",
+    [VERIFY_BOUNDS] = "bounds",
+    [VERIFY_HEADER] = "header",
+    [VERIFY_CORRUPT] = "corrupt",
+    [VERIFY_TRUNCATED] = "truncated",
+    [VERIFY_LENGTH] = "length",
+};
+
+const char* verify_statusName(verify_status_t status)
+{
+    return s_statusNames[status];
+}
+
+static int compareItems(const void *a, const void *b)
+{
+    const verify_item_t *ia = (const verify_item_t*)a;
+    const verify_item_t *ib = (const verify_item_t*)b;
+
+    if (ia->node->origin != ib->node->origin) {
+        return (int)ia->node->origin - (int)ib->node->origin;
+    }
+    if (ia->source != ib->source) {
+        return ia->source < ib->source ? -1 : 1;
+    }
+
+    return (ia->offset > ib->offset) - (ia->offset < ib->offset);
+}
+
+// Keeps the last packed file open, since neighbouring items share it.
+static bool verify_open(verify_worker_t *w, filetree_node_t *node, uint64_t *offset)
+{
+    char filename[4096];
+    if (!origin_locate(node, filename, sizeof(filename), offset)) {
+        return false;
+    }
+
+    if (strcmp(filename, w->filename) == 0) {
+        return w->fd >= 0;
+    }
+
+    if (w->fd >= 0) {
+        close(w->fd);
+    }
+    snprintf(w->filename, sizeof(w->filename), "%s", filename);
+
+    struct stat st;
+    w->fd = open(filename, O_RDONLY);
+    if (w->fd >= 0 && fstat(w->fd, &st) != 0) {
+        close(w->fd);
+        w->fd = -1;
+    }
+    if (w->fd < 0) {
+        return false;
+    }
+
+    w->size = st.st_size;
+    posix_fadvise(w->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    return true;
+}
+
+static verify_status_t verify_inflate(verify_worker_t *w, resource_t *res, uint64_t offset)
+{
+    z_stream *strm = &w->strm;
+    inflateReset(strm);
+    strm->avail_in = 0;
+
+    uint64_t remaining = res->sizeCompressed;
+    uint64_t out = 0;
+    int ret = Z_OK;
+
+    while (ret != Z_STREAM_END) {
+        if (strm->avail_in == 0) {
+            if (remaining == 0) {
+                return VERIFY_TRUNCATED;
+            }
+
+            size_t len = remaining < VERIFY_READ_SIZE ? remaining : VERIFY_READ_SIZE;
+            ssize_t n = pread(w->fd, w->input, len, offset);
+            if (n <= 0) {
+                return VERIFY_TRUNCATED; // shrank since we checked
+            }
+
+            offset += n;
+            remaining -= n;
+            strm->next_in = w->input;
+            strm->avail_in = n;
+        }
+
+        strm->next_out = w->sink;
+        strm->avail_out = VERIFY_SINK_SIZE;
+
+        ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
+            return VERIFY_CORRUPT;
+        }
+
+        out += VERIFY_SINK_SIZE - strm->avail_out;
+        if (out > res->sizeUncompressed) {
+            return VERIFY_LENGTH;
+        }
+    }
+
+    return out == res->sizeUncompressed ? VERIFY_OK : VERIFY_LENGTH;
+}
+
+static verify_status_t verify_entry(verify_worker_t *w, filetree_node_t *node)
+{
+    resource_t *res = node->res;
+    uint64_t offset;
+
+    if (!verify_open(w, node, &offset)) {
+        return VERIFY_MISSING;
+    }
+    if (offset + res->sizeCompressed > w->size) {
+        return VERIFY_BOUNDS;
+    }
+    if (resource_isStored(res)) {
+        return VERIFY_OK; // nothing to inflate
+    }
+    if (res->sizeCompressed == res->sizeUncompressed) {
+        return VERIFY_HEADER;
+    }
+
+    return verify_inflate(w, res, offset);
+}
+
+static void verify_job(void *arg)
+{
+    verify_ctx_t *ctx = (verify_ctx_t*)arg;
+
+    verify_worker_t w = { .fd = -1 };
+    w.input = (uint8_t*)mem_malloc(MEM_TAG_EXTRACT, VERIFY_READ_SIZE);
+    w.sink = (uint8_t*)mem_malloc(MEM_TAG_EXTRACT, VERIFY_SINK_SIZE);
+    inflateInit(&w.strm);
+
+    TRACE_BEGIN("verify_worker");
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&ctx->next, 1, __ATOMIC_RELAXED);
+        if (i >= ctx->numItems) {
+            break;
+        }
+
+        verify_item_t *item = &ctx->items[i];
+        ctx->statuses[item->index] = verify_entry(&w, item->node);
+    }
+
+    TRACE_END();
+
+    inflateEnd(&w.strm);
+    if (w.fd >= 0) {
+        close(w.fd);
+    }
+    mem_free(w.sink);
+    mem_free(w.input);
+}
+
+uint8_t* verify_files(filetree_node_t **files, size_t numFiles)
+{
+    TRACE_BEGIN("verify");
+
+    verify_ctx_t ctx = {
+        .items = (verify_item_t*)mem_calloc(MEM_TAG_EXTRACT, numFiles ? numFiles : 1, sizeof(*ctx.items)),
+        .numItems = numFiles,
+        .statuses = (uint8_t*)mem_calloc(MEM_TAG_EXTRACT, numFiles ? numFiles : 1, 1),
+    };
+
+    for (int i = 0; i < numFiles; ++i) {
+        filetree_node_t *root = getPackingRoot(files[i]);
+        verify_item_t *item = &ctx.items[i];
+
+        item->node = files[i];
+        item->index = i;
+        if (files[i]->origin == ORIGIN_BASE) {
+            item->source = root->baseDtIndex;
+            item->offset = (uint64_t)root->baseOffset + files[i]->res->packOffset;
+        } else {
+            item->source = (uintptr_t)root;
+            item->offset = files[i]->res->packOffset;
+        }
+    }
+    qsort(ctx.items, numFiles, sizeof(*ctx.items), compareItems);
+
+    // One job per worker; each pulls items until there are none left.
+    threadpool_t *pool = threadpool_create(0);
+    size_t numJobs = numFiles < pool->numThreads ? numFiles : pool->numThreads;
+    for (int i = 0; i < numJobs; ++i) {
+        threadpool_submit(pool, verify_job, &ctx);
+    }
+
+    threadpool_wait(pool);
+    threadpool_free(pool);
+    mem_free(ctx.items);
+
+    TRACE_END();
+
+    return ctx.statuses;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "filetree.h"
+
+// Input is read in chunks of this size; output is inflated into a sink of
+// VERIFY_SINK_SIZE and thrown away. Both belong to a worker, not a file.
+#define VERIFY_READ_SIZE (256 * 1024)
+#define VERIFY_SINK_SIZE (64 * 1024)
+
+typedef enum {
+    VERIFY_OK = 0,
+    VERIFY_MISSING, // no packed file to look in
+    VERIFY_BOUNDS, // runs past the end of its packed file
+    VERIFY_HEADER, // sizes say stored, but too small to have the header
+    VERIFY_CORRUPT, // deflate stream doesn't decode
+    VERIFY_TRUNCATED, // stream ends early, or never ends
+    VERIFY_LENGTH, // inflates to the wrong length
+} verify_status_t;
+
+const char* verify_statusName(verify_status_t status);
+
+// Checks every one of `files` against its packed file, inflating deflated
+// entries on a pool. Returns a verify_status_t per file, in the same order;
+// free with `mem_free`.
+uint8_t* verify_files(filetree_node_t **files, size_t numFiles);
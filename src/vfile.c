@@ -0,0 +1,478 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <zlib.h>
+
+#include "ds.h"
+
+#include "config.h"
+#include "filetree.h"
+#include "mem.h"
+#include "origin.h"
+#include "rf.h"
+#include "vfile.h"
+
+// Random access into packed entries, after zlib's examples/zran.c: while an
+// entry is inflated front to back, the decoder state at block boundaries is
+// recorded every VFILE_CHECKPOINT_SPAN bytes (input position, leftover bits
+// and the preceding 32 KiB of output). A later read restarts from the
+// nearest checkpoint instead of the start of the entry.
+
+typedef struct {
+    char *key;
+    vfile_index_t *value;
+} vfile_index_entry_t;
+
+static vfile_index_entry_t *g_indices = NULL;
+static size_t g_numCheckpoints = 0; // across every index
+static pthread_mutex_t g_indicesLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void vfile_freeIndex(vfile_index_t *index)
+{
+    size_t numCheckpoints = stbds_arrlenu(index->checkpoints);
+    for (int j = 0; j < numCheckpoints; ++j) {
+        mem_free(index->checkpoints[j]);
+    }
+    g_numCheckpoints -= numCheckpoints;
+
+    stbds_arrfree(index->checkpoints);
+    mem_free(index);
+}
+
+// Drops every index no open vfile is using. Takes the lock held.
+static void vfile_evictIndices()
+{
+    size_t numIndices = stbds_shlenu(g_indices);
+    for (size_t i = numIndices; i > 0; --i) {
+        vfile_index_t *index = g_indices[i - 1].value;
+        if (index->users == 0) {
+            vfile_freeIndex(index);
+            (void)stbds_shdel(g_indices, g_indices[i - 1].key);
+        }
+    }
+}
+
+static vfile_index_t* vfile_getIndex(const char *source, uint64_t dataOffset)
+{
+    char key[4200];
+    snprintf(key, sizeof(key), "%s@%llX", source, (unsigned long long)dataOffset);
+
+    pthread_mutex_lock(&g_indicesLock);
+
+    if (!g_indices) {
+        sh_new_strdup(g_indices);
+    }
+
+    vfile_index_entry_t *kv = stbds_shgetp_null(g_indices, key);
+    vfile_index_t *index;
+
+    if (kv) {
+        index = kv->value;
+    } else {
+        // NOTE: checkpoints are only worth keeping for entries still being
+        // read; past the cap, the idle ones go before anything new is added.
+        if (g_numCheckpoints >= VFILE_MAX_CHECKPOINTS) {
+            vfile_evictIndices();
+        }
+
+        index = (vfile_index_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*index));
+        stbds_shput(g_indices, key, index);
+    }
+    index->users++;
+
+    pthread_mutex_unlock(&g_indicesLock);
+
+    return index;
+}
+
+// Copies the last checkpoint at or before `pos` into `out`.
+static bool vfile_findCheckpoint(vfile_index_t *index, uint64_t pos, vfile_checkpoint_t *out)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&g_indicesLock);
+
+    size_t numCheckpoints = stbds_arrlenu(index->checkpoints);
+    size_t lo = 0;
+    size_t hi = numCheckpoints;
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (index->checkpoints[mid]->out <= pos) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0) {
+        memcpy(out, index->checkpoints[lo - 1], sizeof(*out));
+        found = true;
+    }
+
+    pthread_mutex_unlock(&g_indicesLock);
+
+    return found;
+}
+
+static void vfile_addCheckpoint(vfile_t *vf)
+{
+    vfile_index_t *index = vf->index;
+    uint64_t out = vf->strmOut;
+
+    pthread_mutex_lock(&g_indicesLock);
+
+    if (out > index->covered) {
+        size_t numCheckpoints = stbds_arrlenu(index->checkpoints);
+        uint64_t last = numCheckpoints ? index->checkpoints[numCheckpoints - 1]->out : 0;
+
+        if (out - last >= VFILE_CHECKPOINT_SPAN) {
+            vfile_checkpoint_t *cp = (vfile_checkpoint_t*)mem_malloc(MEM_TAG_EXTRACT, sizeof(*cp));
+            cp->in = vf->strmIn - vf->strm.avail_in;
+            cp->out = out;
+            cp->bits = vf->strm.data_type & 7;
+
+            // unroll the ring so the oldest byte comes first
+            size_t left = vf->strm.avail_out;
+            if (left) {
+                memcpy(cp->window, vf->window + VFILE_WINDOW_SIZE - left, left);
+            }
+            if (left < VFILE_WINDOW_SIZE) {
+                memcpy(cp->window + left, vf->window, VFILE_WINDOW_SIZE - left);
+            }
+
+            stbds_arrput(index->checkpoints, cp);
+            g_numCheckpoints++;
+        }
+
+        index->covered = out;
+    }
+
+    pthread_mutex_unlock(&g_indicesLock);
+}
+
+// Restart inflation at `cp`, or at the start of the entry if NULL.
+static bool vfile_resetStream(vfile_t *vf, vfile_checkpoint_t *cp)
+{
+    if (vf->strmActive) {
+        inflateEnd(&vf->strm);
+        vf->strmActive = false;
+    }
+
+    memset(&vf->strm, 0, sizeof(vf->strm));
+    if (inflateInit2(&vf->strm, -MAX_WBITS) != Z_OK) {
+        return false;
+    }
+    vf->strmActive = true;
+
+    if (cp) {
+        vf->strmIn = cp->in;
+        vf->strmOut = cp->out;
+
+        if (cp->bits) {
+            uint8_t byte;
+            if (pread(vf->fd, &byte, 1, vf->dataOffset + cp->in - 1) != 1) {
+                return false;
+            }
+            inflatePrime(&vf->strm, cp->bits, byte >> (8 - cp->bits));
+        }
+
+        inflateSetDictionary(&vf->strm, cp->window, VFILE_WINDOW_SIZE);
+    } else {
+        // NOTE: inflating raw, so step over the zlib header ourselves:
+        // deflate, no preset dictionary, valid check bits.
+        uint8_t header[2];
+        if (vf->dataSize < sizeof(header)
+            || pread(vf->fd, header, sizeof(header), vf->dataOffset) != sizeof(header)
+            || (header[0] & 0x0f) != Z_DEFLATED
+            || (header[1] & 0x20)
+            || ((header[0] << 8) | header[1]) % 31 != 0
+        ) {
+            printf("[vfile] %s is not a plain zlib stream\n", vf->node->path);
+            return false;
+        }
+
+        vf->strmIn = 2;
+        vf->strmOut = 0;
+    }
+
+    vf->strmBase = vf->strmOut;
+    vf->strm.avail_in = 0;
+    vf->strm.avail_out = 0;
+
+    return true;
+}
+
+// Inflate the next run of output into `window`. Returns the number of
+// bytes produced (contiguous, starting at `*out`), or 0 at the end of the
+// entry or on error.
+static size_t vfile_inflateSome(vfile_t *vf, uint8_t **out)
+{
+    while (vf->strmActive) {
+        if (vf->strm.avail_in == 0) {
+            uint64_t remaining = vf->dataSize - vf->strmIn;
+            size_t chunk = remaining < sizeof(vf->input) ? remaining : sizeof(vf->input);
+            ssize_t n = chunk ? pread(vf->fd, vf->input, chunk, vf->dataOffset + vf->strmIn) : 0;
+
+            if (n <= 0) {
+                printf("[vfile] %s is truncated\n", vf->node->path);
+                return 0;
+            }
+
+            vf->strm.next_in = vf->input;
+            vf->strm.avail_in = n;
+            vf->strmIn += n;
+        }
+
+        if (vf->strm.avail_out == 0) {
+            vf->strm.next_out = vf->window;
+            vf->strm.avail_out = VFILE_WINDOW_SIZE;
+        }
+
+        uint8_t *start = vf->strm.next_out;
+        uInt availOut = vf->strm.avail_out;
+
+        int ret = inflate(&vf->strm, Z_BLOCK);
+        size_t produced = availOut - vf->strm.avail_out;
+        vf->strmOut += produced;
+
+        if (ret == Z_STREAM_END) {
+            if (produced) {
+                *out = start;
+                return produced;
+            }
+            return 0;
+        }
+
+        if (ret != Z_OK) {
+            printf("[vfile] failed to inflate %s (%d)\n", vf->node->path, ret);
+            inflateEnd(&vf->strm);
+            vf->strmActive = false;
+            return 0;
+        }
+
+        // NOTE: bit 7 set and bit 6 clear: end of a block that isn't the last.
+        if (vf->index && (vf->strm.data_type & 128) && !(vf->strm.data_type & 64)) {
+            vfile_addCheckpoint(vf);
+        }
+
+        if (produced) {
+            *out = start;
+            return produced;
+        }
+    }
+
+    return 0;
+}
+
+// How much already-inflated output is still sitting in `window`.
+static uint64_t vfile_windowHave(vfile_t *vf)
+{
+    if (!vf->strmActive) {
+        return 0;
+    }
+
+    uint64_t have = vf->strmOut - vf->strmBase;
+    return have < VFILE_WINDOW_SIZE ? have : VFILE_WINDOW_SIZE;
+}
+
+static void vfile_copyFromWindow(vfile_t *vf, uint8_t *dst, uint64_t from, size_t len)
+{
+    size_t writePos = VFILE_WINDOW_SIZE - vf->strm.avail_out;
+    size_t idx = (writePos + VFILE_WINDOW_SIZE - (vf->strmOut - from)) % VFILE_WINDOW_SIZE;
+
+    while (len > 0) {
+        size_t take = VFILE_WINDOW_SIZE - idx;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(dst, vf->window + idx, take);
+        dst += take;
+        len -= take;
+        idx = 0;
+    }
+}
+
+vfile_t* vfile_openNode(filetree_node_t *node)
+{
+    if (!node || !node->res || (node->res->flags & RES_FLAG_DIR)) {
+        return NULL;
+    }
+
+    vfile_t *vf = (vfile_t*)mem_calloc(MEM_TAG_EXTRACT, 1, sizeof(*vf));
+    vf->node = node;
+    if (!origin_locate(node, vf->source, sizeof(vf->source), &vf->dataOffset)) {
+        mem_free(vf);
+        return NULL;
+    }
+
+    vf->fd = open(vf->source, O_RDONLY);
+    if (vf->fd < 0) {
+        printf("[vfile] %s does not exist; cannot open %s\n", vf->source, node->path);
+        mem_free(vf);
+        return NULL;
+    }
+
+    vf->stored = resource_isStored(node->res);
+    vf->dataSize = node->res->sizeCompressed;
+
+    if (vf->stored) {
+        vf->size = node->res->sizeCompressed - RES_STORED_HEADER_LEN;
+    } else {
+        vf->size = node->res->sizeUncompressed;
+
+        if (vf->size >= VFILE_CHECKPOINT_MIN_SIZE) {
+            vf->index = vfile_getIndex(vf->source, vf->dataOffset);
+        }
+    }
+
+    return vf;
+}
+
+vfile_t* vfile_open(filetree_node_t *root, const char *path)
+{
+    return vfile_openNode(filetree_findByPath(root, path));
+}
+
+void vfile_close(vfile_t *vf)
+{
+    if (vf->strmActive) {
+        inflateEnd(&vf->strm);
+    }
+
+    if (vf->index) {
+        pthread_mutex_lock(&g_indicesLock);
+        vf->index->users--;
+        pthread_mutex_unlock(&g_indicesLock);
+    }
+
+    close(vf->fd);
+    mem_free(vf);
+}
+
+size_t vfile_read(vfile_t *vf, void *buf, size_t len)
+{
+    if (vf->pos >= vf->size) {
+        return 0;
+    }
+
+    if (len > vf->size - vf->pos) {
+        len = vf->size - vf->pos;
+    }
+
+    if (vf->stored) {
+        ssize_t n = pread(vf->fd, buf, len, vf->dataOffset + RES_STORED_HEADER_LEN + vf->pos);
+        if (n <= 0) {
+            return 0;
+        }
+        vf->pos += n;
+        return n;
+    }
+
+    uint8_t *dst = (uint8_t*)buf;
+    size_t copied = 0;
+
+    // Pick up where the live stream is, unless that means going backwards
+    // past what's still in the window or a checkpoint gets us closer.
+    uint64_t have = vfile_windowHave(vf);
+    bool canContinue = vf->strmActive && vf->pos >= vf->strmOut - have;
+
+    vfile_checkpoint_t *cp = NULL;
+    if (vf->index) {
+        cp = (vfile_checkpoint_t*)mem_malloc(MEM_TAG_EXTRACT, sizeof(*cp));
+        if (!vfile_findCheckpoint(vf->index, vf->pos, cp) || (canContinue && cp->out <= vf->strmOut)) {
+            mem_free(cp);
+            cp = NULL;
+        }
+    }
+
+    if (cp || !canContinue) {
+        bool ok = vfile_resetStream(vf, cp);
+        mem_free(cp);
+        if (!ok) {
+            return 0;
+        }
+    } else if (vf->pos < vf->strmOut) {
+        size_t take = vf->strmOut - vf->pos;
+        if (take > len) {
+            take = len;
+        }
+        vfile_copyFromWindow(vf, dst, vf->pos, take);
+        copied += take;
+    }
+
+    while (copied < len) {
+        uint8_t *chunk;
+        size_t n = vfile_inflateSome(vf, &chunk);
+        if (n == 0) {
+            break;
+        }
+
+        uint64_t want = vf->pos + copied;
+        if (vf->strmOut <= want) {
+            continue; // still skipping ahead
+        }
+
+        size_t skip = want - (vf->strmOut - n);
+        size_t take = n - skip;
+        if (take > len - copied) {
+            take = len - copied;
+        }
+
+        memcpy(dst + copied, chunk + skip, take);
+        copied += take;
+    }
+
+    vf->pos += copied;
+
+    return copied;
+}
+
+bool vfile_seek(vfile_t *vf, int64_t offset, int whence)
+{
+    int64_t base = 0;
+
+    switch (whence) {
+        case SEEK_SET: base = 0; break;
+        case SEEK_CUR: base = vf->pos; break;
+        case SEEK_END: base = vf->size; break;
+        default: return false;
+    }
+
+    if (base + offset < 0) {
+        return false;
+    }
+
+    // NOTE: nothing is inflated until the next read.
+    vf->pos = base + offset;
+
+    return true;
+}
+
+uint64_t vfile_tell(vfile_t *vf)
+{
+    return vf->pos;
+}
+
+uint64_t vfile_size(vfile_t *vf)
+{
+    return vf->size;
+}
+
+// Only indices in use by an open vfile survive.
+void vfile_clearCache()
+{
+    pthread_mutex_lock(&g_indicesLock);
+
+    vfile_evictIndices();
+    if (stbds_shlenu(g_indices) == 0) {
+        stbds_shfree(g_indices);
+    }
+
+    pthread_mutex_unlock(&g_indicesLock);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <zlib.h>
+
+#include "filetree.h"
+
+// deflate can refer back this far, so that's what a checkpoint has to keep.
+#define VFILE_WINDOW_SIZE (32 * 1024)
+// Distance (in uncompressed bytes) between checkpoints.
+#define VFILE_CHECKPOINT_SPAN (1024 * 1024)
+// Entries smaller than this simply re-inflate from the start when seeking back.
+#define VFILE_CHECKPOINT_MIN_SIZE (4 * 1024 * 1024)
+// Checkpoints kept across all entries (2048 is 64 MiB of windows) before
+// those of entries nobody has open are dropped.
+#define VFILE_MAX_CHECKPOINTS (2048)
+
+typedef struct {
+    uint64_t in; // offset into the compressed entry of the first full byte
+    uint64_t out; // uncompressed offset
+    int bits; // bits of the byte before `in` still to be fed
+    uint8_t window[VFILE_WINDOW_SIZE];
+} vfile_checkpoint_t;
+
+// Checkpoints for a single entry, shared by every vfile opened on it.
+typedef struct {
+    vfile_checkpoint_t **checkpoints;
+    uint64_t covered; // checkpoints are complete up to here
+    int users; // open vfiles using it
+} vfile_index_t;
+
+typedef struct {
+    filetree_node_t *node;
+    char source[4096];
+    int fd;
+    bool stored;
+
+    uint64_t dataOffset; // start of the entry in `source`
+    uint64_t dataSize; // compressed length
+    uint64_t size; // uncompressed length
+    uint64_t pos;
+
+    vfile_index_t *index;
+
+    // live inflate state. output lands in `window`, which doubles as
+    // the history needed when recording a checkpoint.
+    z_stream strm;
+    bool strmActive;
+    uint64_t strmIn; // compressed bytes read into `input` so far
+    uint64_t strmOut; // uncompressed bytes produced so far
+    uint64_t strmBase; // `strmOut` when the stream was last reset
+    uint8_t input[0x4000];
+    uint8_t window[VFILE_WINDOW_SIZE];
+} vfile_t;
+
+vfile_t* vfile_open(filetree_node_t *root, const char *path);
+vfile_t* vfile_openNode(filetree_node_t *node);
+void vfile_close(vfile_t *vf);
+
+size_t vfile_read(vfile_t *vf, void *buf, size_t len);
+bool vfile_seek(vfile_t *vf, int64_t offset, int whence);
+uint64_t vfile_tell(vfile_t *vf);
+uint64_t vfile_size(vfile_t *vf);
+
+void vfile_clearCache();
@@ -0,0 +1,531 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include "ds.h"
+
+#include "file.h"
+#include "filetree.h"
+#include "mem.h"
+#include "origin.h"
+#include "rf.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "zipexport.h"
+
+// Workers pull entries in archive order from a shared counter and work
+// out each one's CRC and exact deflate length; the writer follows behind,
+// waiting on whichever entry it needs next. See zipexport.h.
+
+#define ZIP_LOCAL_SIG (0x04034b50)
+#define ZIP_CENTRAL_SIG (0x02014b50)
+#define ZIP_END_SIG (0x06054b50)
+#define ZIP64_END_SIG (0x06064b50)
+#define ZIP64_LOCATOR_SIG (0x07064b50)
+
+#define ZIP_VERSION (20)
+#define ZIP64_VERSION (45)
+#define ZIP_MADE_BY_UNIX (3 << 8)
+#define ZIP_FLAG_UTF8 (1 << 11)
+#define ZIP_METHOD_STORE (0)
+#define ZIP_METHOD_DEFLATE (8)
+#define ZIP64_EXTRA_ID (0x0001)
+
+#define ZIP_MAX32 (0xFFFFFFFFull)
+#define ZIP_MAX16 (0xFFFF)
+
+typedef struct {
+    filetree_node_t *node;
+    bool done;
+    bool ok;
+    bool stored;
+    uint64_t dataOffset; // in the packed (or dt) file
+    uint64_t dataLen; // bytes copied into the zip
+    uint64_t uncompressedLen;
+    uint32_t crc;
+} zipexport_item_t;
+
+typedef struct {
+    zipexport_item_t *items;
+    size_t numItems;
+    size_t next; // next item to hand out
+
+    pthread_mutex_t lock;
+    pthread_cond_t itemDone;
+} zipexport_ctx_t;
+
+// The last packed file opened, since neighbouring entries share it.
+typedef struct {
+    char filename[4096];
+    int fd;
+    uint64_t size;
+} zipexport_source_t;
+
+typedef struct {
+    zipexport_source_t source;
+    z_stream strm;
+    uint8_t *input;
+    uint8_t *sink;
+} zipexport_worker_t;
+
+static bool zipexport_open(zipexport_source_t *source, filetree_node_t *node, uint64_t *offset)
+{
+    char filename[4096];
+    if (!origin_locate(node, filename, sizeof(filename), offset)) {
+        return false;
+    }
+
+    if (strcmp(filename, source->filename) == 0) {
+        return source->fd >= 0;
+    }
+
+    if (source->fd >= 0) {
+        close(source->fd);
+    }
+    snprintf(source->filename, sizeof(source->filename), "%s", filename);
+
+    struct stat st;
+    source->fd = open(filename, O_RDONLY);
+    if (source->fd >= 0 && fstat(source->fd, &st) != 0) {
+        close(source->fd);
+        source->fd = -1;
+    }
+    if (source->fd < 0) {
+        return false;
+    }
+
+    source->size = st.st_size;
+    posix_fadvise(source->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    return true;
+}
+
+static void zipexport_close(zipexport_source_t *source)
+{
+    if (source->fd >= 0) {
+        close(source->fd);
+    }
+}
+
+static bool zipexport_scanStored(zipexport_worker_t *w, zipexport_item_t *item)
+{
+    uint64_t offset = item->dataOffset;
+    uint64_t remaining = item->dataLen;
+    uint32_t crc = crc32(0, NULL, 0);
+
+    while (remaining > 0) {
+        size_t len = remaining < ZIPEXPORT_READ_SIZE ? remaining : ZIPEXPORT_READ_SIZE;
+        ssize_t n = pread(w->source.fd, w->input, len, offset);
+        if (n <= 0) {
+            return false;
+        }
+
+        crc = crc32(crc, w->input, n);
+        offset += n;
+        remaining -= n;
+    }
+
+    item->crc = crc;
+    return true;
+}
+
+// Inflates the raw deflate data past the zlib header, which also tells us
+// where it really ends: the adler32 trailer (and any padding) stays behind.
+static bool zipexport_scanDeflated(zipexport_worker_t *w, zipexport_item_t *item, uint64_t maxLen)
+{
+    z_stream *strm = &w->strm;
+    inflateReset(strm);
+    strm->avail_in = 0;
+
+    uint64_t offset = item->dataOffset;
+    uint64_t remaining = maxLen;
+    uint32_t crc = crc32(0, NULL, 0);
+    int ret = Z_OK;
+
+    while (ret != Z_STREAM_END) {
+        if (strm->avail_in == 0) {
+            if (remaining == 0) {
+                return false;
+            }
+
+            size_t len = remaining < ZIPEXPORT_READ_SIZE ? remaining : ZIPEXPORT_READ_SIZE;
+            ssize_t n = pread(w->source.fd, w->input, len, offset);
+            if (n <= 0) {
+                return false;
+            }
+
+            offset += n;
+            remaining -= n;
+            strm->next_in = w->input;
+            strm->avail_in = n;
+        }
+
+        strm->next_out = w->sink;
+        strm->avail_out = ZIPEXPORT_SINK_SIZE;
+
+        ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
+            return false;
+        }
+
+        crc = crc32(crc, w->sink, ZIPEXPORT_SINK_SIZE - strm->avail_out);
+    }
+
+    item->crc = crc;
+    item->dataLen = strm->total_in;
+    return strm->total_out == item->uncompressedLen;
+}
+
+static bool zipexport_scan(zipexport_worker_t *w, zipexport_item_t *item)
+{
+    resource_t *res = item->node->res;
+    uint64_t offset;
+
+    if (!zipexport_open(&w->source, item->node, &offset)
+        || offset + res->sizeCompressed > w->source.size
+    ) {
+        return false;
+    }
+
+    if (resource_isStored(res)) {
+        item->stored = true;
+        item->dataOffset = offset + RES_STORED_HEADER_LEN;
+        item->dataLen = res->sizeCompressed - RES_STORED_HEADER_LEN;
+        item->uncompressedLen = item->dataLen;
+        return zipexport_scanStored(w, item);
+    }
+
+    // zlib header: deflate, no preset dictionary, valid check bits
+    uint8_t header[2];
+    if (res->sizeCompressed < sizeof(header)
+        || pread(w->source.fd, header, sizeof(header), offset) != sizeof(header)
+        || (header[0] & 0x0f) != Z_DEFLATED
+        || (header[1] & 0x20)
+        || ((header[0] << 8) | header[1]) % 31 != 0
+    ) {
+        return false;
+    }
+
+    item->dataOffset = offset + sizeof(header);
+    item->uncompressedLen = res->sizeUncompressed;
+    return zipexport_scanDeflated(w, item, res->sizeCompressed - sizeof(header));
+}
+
+static void zipexport_job(void *arg)
+{
+    zipexport_ctx_t *ctx = (zipexport_ctx_t*)arg;
+
+    zipexport_worker_t w = { .source.fd = -1 };
+    w.input = (uint8_t*)mem_malloc(MEM_TAG_EXTRACT, ZIPEXPORT_READ_SIZE);
+    w.sink = (uint8_t*)mem_malloc(MEM_TAG_EXTRACT, ZIPEXPORT_SINK_SIZE);
+    inflateInit2(&w.strm, -MAX_WBITS);
+
+    TRACE_BEGIN("zipexport_worker");
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&ctx->next, 1, __ATOMIC_RELAXED);
+        if (i >= ctx->numItems) {
+            break;
+        }
+
+        zipexport_item_t *item = &ctx->items[i];
+        bool ok = zipexport_scan(&w, item);
+
+        pthread_mutex_lock(&ctx->lock);
+        item->ok = ok;
+        item->done = true;
+        pthread_cond_broadcast(&ctx->itemDone);
+        pthread_mutex_unlock(&ctx->lock);
+    }
+
+    TRACE_END();
+
+    inflateEnd(&w.strm);
+    zipexport_close(&w.source);
+    mem_free(w.sink);
+    mem_free(w.input);
+}
+
+static void put16(uint8_t **buf, uint16_t v)
+{
+    stbds_arrput(*buf, v & 0xff);
+    stbds_arrput(*buf, v >> 8);
+}
+
+static void put32(uint8_t **buf, uint32_t v)
+{
+    put16(buf, v & 0xffff);
+    put16(buf, v >> 16);
+}
+
+static void put64(uint8_t **buf, uint64_t v)
+{
+    put32(buf, v & 0xffffffff);
+    put32(buf, v >> 32);
+}
+
+static void putBytes(uint8_t **buf, const void *data, size_t len)
+{
+    memcpy(stbds_arraddnptr(*buf, len), data, len);
+}
+
+static uint32_t clamp32(uint64_t v)
+{
+    return v >= ZIP_MAX32 ? ZIP_MAX32 : v;
+}
+
+static void zipexport_dosTime(uint32_t timestamp, uint16_t *dosTime, uint16_t *dosDate)
+{
+    time_t t = timestamp;
+    struct tm tm;
+    localtime_r(&t, &tm);
+
+    // DOS dates start at 1980
+    if (tm.tm_year < 80) {
+        *dosTime = 0;
+        *dosDate = (1 << 5) | 1;
+        return;
+    }
+
+    *dosTime = (tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2);
+    *dosDate = ((tm.tm_year - 80) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday;
+}
+
+static bool zipexport_flush(int fd, uint8_t **buf, uint64_t *offset)
+{
+    size_t len = stbds_arrlenu(*buf);
+    bool ok = write(fd, *buf, len) == (ssize_t)len;
+
+    *offset += len;
+    stbds_arrsetlen(*buf, 0);
+
+    return ok;
+}
+
+static void zipexport_putHeaders(zipexport_item_t *item, const char *name, uint64_t localOffset, uint8_t **local, uint8_t **central)
+{
+    uint16_t nameLen = strlen(name);
+    uint16_t dosTime, dosDate;
+    zipexport_dosTime(item->node->res->timestamp, &dosTime, &dosDate);
+
+    uint16_t method = item->stored ? ZIP_METHOD_STORE : ZIP_METHOD_DEFLATE;
+    bool sizes64 = item->dataLen >= ZIP_MAX32 || item->uncompressedLen >= ZIP_MAX32;
+    bool offset64 = localOffset >= ZIP_MAX32;
+
+    // NOTE: when the local header needs ZIP64 at all, it gets both sizes.
+    put32(local, ZIP_LOCAL_SIG);
+    put16(local, sizes64 ? ZIP64_VERSION : ZIP_VERSION);
+    put16(local, ZIP_FLAG_UTF8);
+    put16(local, method);
+    put16(local, dosTime);
+    put16(local, dosDate);
+    put32(local, item->crc);
+    put32(local, sizes64 ? ZIP_MAX32 : item->dataLen);
+    put32(local, sizes64 ? ZIP_MAX32 : item->uncompressedLen);
+    put16(local, nameLen);
+    put16(local, sizes64 ? 20 : 0);
+    putBytes(local, name, nameLen);
+    if (sizes64) {
+        put16(local, ZIP64_EXTRA_ID);
+        put16(local, 16);
+        put64(local, item->uncompressedLen);
+        put64(local, item->dataLen);
+    }
+
+    // the central directory only carries the fields that overflowed
+    uint16_t extraLen = 0;
+    extraLen += item->uncompressedLen >= ZIP_MAX32 ? 8 : 0;
+    extraLen += item->dataLen >= ZIP_MAX32 ? 8 : 0;
+    extraLen += offset64 ? 8 : 0;
+
+    put32(central, ZIP_CENTRAL_SIG);
+    put16(central, ZIP_MADE_BY_UNIX | ZIP64_VERSION);
+    put16(central, extraLen ? ZIP64_VERSION : ZIP_VERSION);
+    put16(central, ZIP_FLAG_UTF8);
+    put16(central, method);
+    put16(central, dosTime);
+    put16(central, dosDate);
+    put32(central, item->crc);
+    put32(central, clamp32(item->dataLen));
+    put32(central, clamp32(item->uncompressedLen));
+    put16(central, nameLen);
+    put16(central, extraLen ? extraLen + 4 : 0);
+    put16(central, 0); // comment
+    put16(central, 0); // disk
+    put16(central, 0); // internal attributes
+    put32(central, 0100644u << 16);
+    put32(central, clamp32(localOffset));
+    putBytes(central, name, nameLen);
+    if (extraLen) {
+        put16(central, ZIP64_EXTRA_ID);
+        put16(central, extraLen);
+        if (item->uncompressedLen >= ZIP_MAX32) {
+            put64(central, item->uncompressedLen);
+        }
+        if (item->dataLen >= ZIP_MAX32) {
+            put64(central, item->dataLen);
+        }
+        if (offset64) {
+            put64(central, localOffset);
+        }
+    }
+}
+
+static void zipexport_putEnd(uint8_t **buf, uint64_t numEntries, uint64_t centralOffset, uint64_t centralLen)
+{
+    if (numEntries >= ZIP_MAX16 || centralOffset >= ZIP_MAX32 || centralLen >= ZIP_MAX32) {
+        uint64_t endOffset = centralOffset + centralLen;
+
+        put32(buf, ZIP64_END_SIG);
+        put64(buf, 44); // size of the rest of the record
+        put16(buf, ZIP_MADE_BY_UNIX | ZIP64_VERSION);
+        put16(buf, ZIP64_VERSION);
+        put32(buf, 0); // disk
+        put32(buf, 0); // disk with the central directory
+        put64(buf, numEntries);
+        put64(buf, numEntries);
+        put64(buf, centralLen);
+        put64(buf, centralOffset);
+
+        put32(buf, ZIP64_LOCATOR_SIG);
+        put32(buf, 0);
+        put64(buf, endOffset);
+        put32(buf, 1); // total disks
+    }
+
+    put32(buf, ZIP_END_SIG);
+    put16(buf, 0);
+    put16(buf, 0);
+    put16(buf, numEntries >= ZIP_MAX16 ? ZIP_MAX16 : numEntries);
+    put16(buf, numEntries >= ZIP_MAX16 ? ZIP_MAX16 : numEntries);
+    put32(buf, clamp32(centralLen));
+    put32(buf, clamp32(centralOffset));
+    put16(buf, 0); // comment
+}
+
+bool zipexport_files(filetree_node_t **files, size_t numFiles, const char *filename)
+{
+    int fdOut = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fdOut < 0) {
+        printf("[zipexport] cannot create %s\n", filename);
+        return false;
+    }
+
+    TRACE_BEGIN_DETAIL("zipexport", filename);
+    mem_tag_t prevTag = mem_setTag(MEM_TAG_EXTRACT);
+
+    zipexport_ctx_t ctx = {
+        .items = (zipexport_item_t*)mem_calloc(MEM_TAG_EXTRACT, numFiles ? numFiles : 1, sizeof(*ctx.items)),
+        .numItems = numFiles,
+    };
+    pthread_mutex_init(&ctx.lock, NULL);
+    pthread_cond_init(&ctx.itemDone, NULL);
+
+    for (int i = 0; i < numFiles; ++i) {
+        ctx.items[i].node = files[i];
+    }
+
+    threadpool_t *pool = threadpool_create(0);
+    size_t numJobs = numFiles < pool->numThreads ? numFiles : pool->numThreads;
+    for (int i = 0; i < numJobs; ++i) {
+        threadpool_submit(pool, zipexport_job, &ctx);
+    }
+
+    zipexport_source_t source = { .fd = -1 };
+    uint8_t *local = NULL;
+    uint8_t *central = NULL;
+    uint64_t offset = 0;
+    uint64_t numEntries = 0;
+    bool ok = true;
+    bool writeFailed = false;
+
+    for (int i = 0; i < numFiles; ++i) {
+        zipexport_item_t *item = &ctx.items[i];
+
+        pthread_mutex_lock(&ctx.lock);
+        while (!item->done) {
+            pthread_cond_wait(&ctx.itemDone, &ctx.lock);
+        }
+        pthread_mutex_unlock(&ctx.lock);
+
+        char dataDir[64];
+        char name[4096];
+        filetree_getDataDir(item->node, dataDir, sizeof(dataDir));
+        snprintf(name, sizeof(name), "%s%s", dataDir, item->node->path);
+
+        uint64_t entryOffset; // already in `item->dataOffset`
+        if (!item->ok || !zipexport_open(&source, item->node, &entryOffset)) {
+            printf("[zipexport] cannot read %s; leaving it out\n", name);
+            ok = false;
+            continue;
+        }
+
+        uint64_t localOffset = offset + stbds_arrlenu(local);
+        zipexport_putHeaders(item, name, localOffset, &local, &central);
+
+        if (!zipexport_flush(fdOut, &local, &offset)
+            || !file_copyRange(source.fd, item->dataOffset, fdOut, item->dataLen)
+        ) {
+            printf("[zipexport] write failed at %s\n", name);
+            writeFailed = true;
+            break;
+        }
+
+        offset += item->dataLen;
+        numEntries++;
+    }
+
+    threadpool_wait(pool);
+    threadpool_free(pool);
+
+    if (!writeFailed) {
+        uint64_t centralOffset = offset;
+        uint64_t centralLen = stbds_arrlenu(central);
+        zipexport_putEnd(&central, numEntries, centralOffset, centralLen);
+        writeFailed = !zipexport_flush(fdOut, &central, &offset);
+    }
+
+    close(fdOut);
+    zipexport_close(&source);
+    stbds_arrfree(local);
+    stbds_arrfree(central);
+    pthread_cond_destroy(&ctx.itemDone);
+    pthread_mutex_destroy(&ctx.lock);
+    mem_free(ctx.items);
+
+    mem_setTag(prevTag);
+    TRACE_END();
+
+    return ok && !writeFailed;
+}
+
+static void zipexport_collect(filetree_node_t *node, filetree_node_t ***files)
+{
+    if (node->res && !(node->res->flags & RES_FLAG_DIR)) {
+        stbds_arrput(*files, node);
+    }
+
+    size_t numChildren = stbds_arrlenu(node->children);
+    for (int i = 0; i < numChildren; ++i) {
+        zipexport_collect(node->children[i], files);
+    }
+}
+
+bool zipexport_node(filetree_node_t *node, const char *filename)
+{
+    filetree_node_t **files = NULL;
+    zipexport_collect(node, &files);
+
+    bool ok = zipexport_files(files, stbds_arrlenu(files), filename);
+
+    stbds_arrfree(files);
+    return ok;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "filetree.h"
+
+// Deflated entries go into the ZIP as the raw deflate data already in
+// `packed`, minus the zlib wrapper; stored ones are copied as they are.
+// Nothing is recompressed. Entries are only inflated (into a discard sink,
+// on a pool, ahead of the writer) to get their CRC-32.
+//
+// The archive is written front to back without seeking, using ZIP64
+// records wherever sizes or offsets outgrow 32 bits.
+
+#define ZIPEXPORT_READ_SIZE (256 * 1024)
+#define ZIPEXPORT_SINK_SIZE (64 * 1024)
+
+// Entries are named by their data-relative path, e.g. `data/ui/foo.bin`.
+// Returns false if the archive couldn't be written or any entry was left out.
+bool zipexport_files(filetree_node_t **files, size_t numFiles, const char *filename);
+bool zipexport_node(filetree_node_t *node, const char *filename);
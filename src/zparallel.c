@@ -0,0 +1,192 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <zlib.h>
+
+#include "mem.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "zparallel.h"
+
+// Block-parallel zlib compression. Each block becomes a run of raw deflate
+// data: every block but the last is ended with a sync flush (byte-aligned,
+// not final), so they can simply be concatenated. The output is one
+// ordinary zlib stream, with the blocks' Adler-32s combined for the trailer.
+
+typedef struct zparallel_ctx_t zparallel_ctx_t;
+
+typedef struct {
+    zparallel_ctx_t *ctx;
+
+    const uint8_t *in;
+    size_t inLen;
+    const uint8_t *dict;
+    size_t dictLen;
+    bool last;
+
+    uint8_t *out;
+    size_t outLen;
+    uLong adler;
+    int err;
+} zparallel_block_t;
+
+struct zparallel_ctx_t {
+    int level;
+
+    pthread_mutex_t lock;
+    pthread_cond_t allDone;
+    size_t remaining;
+};
+
+static void zparallel_blockJob(void *arg)
+{
+    zparallel_block_t *block = (zparallel_block_t*)arg;
+    z_stream strm = { 0 };
+
+    TRACE_BEGIN("deflate_block");
+    block->err = deflateInit2(&strm, block->ctx->level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+    if (block->err == Z_OK && block->dictLen) {
+        block->err = deflateSetDictionary(&strm, block->dict, block->dictLen);
+    }
+
+    if (block->err == Z_OK) {
+        // NOTE: room for the sync flush's empty stored block, too.
+        size_t cap = deflateBound(&strm, block->inLen) + 16;
+        block->out = (uint8_t*)mem_malloc(MEM_TAG_COMPRESS, cap);
+
+        strm.next_in = (Bytef*)block->in;
+        strm.avail_in = block->inLen;
+        strm.next_out = block->out;
+        strm.avail_out = cap;
+
+        int ret = deflate(&strm, block->last ? Z_FINISH : Z_SYNC_FLUSH);
+        if (block->last ? ret != Z_STREAM_END : (ret != Z_OK || strm.avail_in != 0 || strm.avail_out == 0)) {
+            block->err = Z_BUF_ERROR;
+        }
+
+        block->outLen = cap - strm.avail_out;
+        block->adler = adler32(1, block->in, block->inLen);
+    }
+
+    deflateEnd(&strm);
+    TRACE_END();
+
+    pthread_mutex_lock(&block->ctx->lock);
+    if (--block->ctx->remaining == 0) {
+        pthread_cond_signal(&block->ctx->allDone);
+    }
+    pthread_mutex_unlock(&block->ctx->lock);
+}
+
+size_t zparallel_compressBound(size_t srcLen)
+{
+    size_t numBlocks = srcLen / ZPARALLEL_BLOCK_SIZE + 1;
+    return compressBound(srcLen) + numBlocks * 16;
+}
+
+// Same contract as zlib's `compress2`. `pool` may be NULL, in which case a
+// temporary one is spun up. Called from inside a pool job, it compresses
+// serially instead of waiting on its own pool.
+int zparallel_compress(threadpool_t *pool, uint8_t *dst, size_t *dstLen, const uint8_t *src, size_t srcLen, int level)
+{
+    if (srcLen < ZPARALLEL_MIN_SIZE || threadpool_isWorker()) {
+        uLongf len = *dstLen;
+        int ret = compress2(dst, &len, src, srcLen, level);
+        *dstLen = len;
+        return ret;
+    }
+
+    zparallel_ctx_t ctx = { .level = level };
+    pthread_mutex_init(&ctx.lock, NULL);
+    pthread_cond_init(&ctx.allDone, NULL);
+
+    size_t numBlocks = (srcLen + ZPARALLEL_BLOCK_SIZE - 1) / ZPARALLEL_BLOCK_SIZE;
+    zparallel_block_t *blocks = (zparallel_block_t*)mem_calloc(MEM_TAG_COMPRESS, numBlocks, sizeof(*blocks));
+    ctx.remaining = numBlocks;
+
+    threadpool_t *ownPool = pool ? NULL : threadpool_create(0);
+
+    for (int i = 0; i < numBlocks; ++i) {
+        zparallel_block_t *block = &blocks[i];
+        size_t offset = (size_t)i * ZPARALLEL_BLOCK_SIZE;
+
+        block->ctx = &ctx;
+        block->in = src + offset;
+        block->inLen = srcLen - offset < ZPARALLEL_BLOCK_SIZE ? srcLen - offset : ZPARALLEL_BLOCK_SIZE;
+        block->dictLen = offset < ZPARALLEL_DICT_SIZE ? offset : ZPARALLEL_DICT_SIZE;
+        block->dict = block->in - block->dictLen;
+        block->last = i == numBlocks - 1;
+
+        threadpool_submit(pool ? pool : ownPool, zparallel_blockJob, block);
+    }
+
+    // NOTE: only waits on our blocks; the pool may be busy with other work.
+    pthread_mutex_lock(&ctx.lock);
+    while (ctx.remaining > 0) {
+        pthread_cond_wait(&ctx.allDone, &ctx.lock);
+    }
+    pthread_mutex_unlock(&ctx.lock);
+
+    if (ownPool) {
+        threadpool_free(ownPool);
+    }
+
+    int ret = Z_OK;
+    size_t pos = 0;
+    uLong adler = 1;
+
+    // zlib header: deflate with a 32K window, no preset dictionary, and the
+    // level hint zlib itself would write.
+    int levelFlags = level == Z_DEFAULT_COMPRESSION ? 2
+        : level < 2 ? 0
+        : level < 6 ? 1
+        : level == 6 ? 2
+        : 3;
+    uint8_t header[2] = { 0x78, levelFlags << 6 };
+    header[1] += 31 - ((header[0] << 8 | header[1]) % 31);
+
+    if (*dstLen < sizeof(header)) {
+        ret = Z_BUF_ERROR;
+    } else {
+        memcpy(dst, header, sizeof(header));
+        pos += sizeof(header);
+    }
+
+    for (int i = 0; i < numBlocks && ret == Z_OK; ++i) {
+        zparallel_block_t *block = &blocks[i];
+
+        if (block->err != Z_OK) {
+            ret = block->err;
+        } else if (pos + block->outLen > *dstLen) {
+            ret = Z_BUF_ERROR;
+        } else {
+            memcpy(dst + pos, block->out, block->outLen);
+            pos += block->outLen;
+            adler = adler32_combine(adler, block->adler, block->inLen);
+        }
+    }
+
+    if (ret == Z_OK) {
+        if (pos + 4 > *dstLen) {
+            ret = Z_BUF_ERROR;
+        } else {
+            dst[pos++] = adler >> 24;
+            dst[pos++] = adler >> 16;
+            dst[pos++] = adler >> 8;
+            dst[pos++] = adler;
+            *dstLen = pos;
+        }
+    }
+
+    for (int i = 0; i < numBlocks; ++i) {
+        mem_free(blocks[i].out);
+    }
+    mem_free(blocks);
+
+    pthread_cond_destroy(&ctx.allDone);
+    pthread_mutex_destroy(&ctx.lock);
+
+    return ret;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "threadpool.h"
+
+// Input is deflated in blocks of this size, each primed with the last
+// ZPARALLEL_DICT_SIZE bytes before it, as pigz does.
+#define ZPARALLEL_BLOCK_SIZE (128 * 1024)
+#define ZPARALLEL_DICT_SIZE (32 * 1024)
+
+// Below this, it isn't worth waking up the pool.
+#define ZPARALLEL_MIN_SIZE (1024 * 1024)
+
+size_t zparallel_compressBound(size_t srcLen);
+int zparallel_compress(threadpool_t *pool, uint8_t *dst, size_t *dstLen, const uint8_t *src, size_t srcLen, int level);